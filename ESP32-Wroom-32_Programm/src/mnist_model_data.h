@@ -1,17 +1,17 @@
-unsigned char mnist_cnn_tflite[] = {
+alignas(16) const unsigned char mnist_cnn_tflite[] = {
   0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00,
   0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00,
   0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x8c, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0xdc, 0xd6, 0x00, 0x00,
-  0xec, 0xd6, 0x00, 0x00, 0xd4, 0xdf, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x62, 0x28, 0xff, 0xff,
+  0x8c, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0xfc, 0xd6, 0x00, 0x00,
+  0x0c, 0xd7, 0x00, 0x00, 0xf4, 0xdf, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x42, 0x28, 0xff, 0xff,
   0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
   0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f,
   0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x04, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
   0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70,
   0x75, 0x74, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x6a, 0x28, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x4a, 0x28, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
   0x0c, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x72, 0x61, 0x73, 0x5f, 0x74, 0x65,
   0x6e, 0x73, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
   0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xff,
@@ -21,4775 +21,4777 @@ unsigned char mnist_cnn_tflite[] = {
   0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
   0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f,
   0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73,
-  0x69, 0x6f, 0x6e, 0x00, 0x13, 0x00, 0x00, 0x00, 0xf4, 0xd5, 0x00, 0x00,
-  0xec, 0xd5, 0x00, 0x00, 0x9c, 0x02, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00,
-  0x50, 0x02, 0x00, 0x00, 0x3c, 0x02, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00,
-  0xf8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
-  0xb8, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
-  0xa0, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
-  0x88, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x32, 0x29, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x32, 0x2e, 0x31, 0x36, 0x2e, 0x32, 0x00, 0x00,
-  0x92, 0x29, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x31, 0x2e, 0x31, 0x31, 0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0xff, 0xff, 0x14, 0x22, 0xff, 0xff,
-  0x18, 0x22, 0xff, 0xff, 0x1c, 0x22, 0xff, 0xff, 0x20, 0x22, 0xff, 0xff,
-  0x24, 0x22, 0xff, 0xff, 0x28, 0x22, 0xff, 0xff, 0x2c, 0x22, 0xff, 0xff,
-  0xce, 0x29, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x69, 0x6f, 0x6e, 0x00, 0x13, 0x00, 0x00, 0x00, 0x14, 0xd6, 0x00, 0x00,
+  0x0c, 0xd6, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0x78, 0x02, 0x00, 0x00,
+  0x64, 0x02, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x12, 0x29, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x32, 0x2e, 0x31, 0x36, 0x2e, 0x32, 0x00, 0x00, 0x7a, 0x29, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x31,
+  0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf8, 0x21, 0xff, 0xff, 0xfc, 0x21, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff,
+  0x04, 0x22, 0xff, 0xff, 0x08, 0x22, 0xff, 0xff, 0x0c, 0x22, 0xff, 0xff,
+  0x10, 0x22, 0xff, 0xff, 0x14, 0x22, 0xff, 0xff, 0xb6, 0x29, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
   0x0a, 0x33, 0xb1, 0x3d, 0xdb, 0xa6, 0x3c, 0xbe, 0xb9, 0x64, 0x2d, 0xbd,
   0x22, 0x50, 0xf2, 0xbc, 0x02, 0x06, 0xf4, 0xbb, 0x34, 0xdf, 0x4a, 0x3e,
-  0xce, 0x55, 0xbe, 0xbb, 0x3a, 0xcd, 0x6e, 0xbc, 0xfa, 0x29, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x6f, 0x87, 0x41, 0xbf,
-  0x12, 0xf4, 0x8d, 0xbf, 0x61, 0xa1, 0x6d, 0xbf, 0x2d, 0x3c, 0xbe, 0xbc,
-  0x62, 0x4e, 0x09, 0x3e, 0x3f, 0x2c, 0xa5, 0x3e, 0x27, 0xb5, 0x18, 0x3f,
-  0x05, 0x64, 0x59, 0x3f, 0xc1, 0x30, 0x97, 0x3e, 0x9e, 0x77, 0x79, 0x3e,
-  0x7c, 0x13, 0x69, 0xbd, 0x55, 0xac, 0xed, 0xbe, 0x83, 0xe5, 0xda, 0x3e,
-  0x99, 0x08, 0xf8, 0x3e, 0xc7, 0xee, 0x4b, 0xbd, 0x2b, 0x0e, 0xa8, 0xbe,
-  0x5d, 0x85, 0x39, 0x3e, 0xe8, 0xf9, 0xe6, 0x3e, 0xa3, 0xa5, 0xa6, 0x3e,
-  0xf2, 0x81, 0xe4, 0xbc, 0xef, 0x75, 0xb1, 0x3e, 0xc0, 0x3d, 0x55, 0xbc,
-  0x36, 0x51, 0xc9, 0xbd, 0xee, 0xcc, 0x4a, 0x3e, 0x3a, 0xde, 0xe2, 0x3d,
-  0x14, 0x2b, 0xd4, 0x3d, 0xbd, 0xe4, 0xa2, 0xbd, 0xca, 0x87, 0x0f, 0xbf,
-  0xbb, 0x21, 0x75, 0x3e, 0x70, 0xbd, 0xb8, 0x3e, 0x25, 0x0d, 0xb2, 0xbe,
-  0xf9, 0x9f, 0xf6, 0x3e, 0xfb, 0x6e, 0x9f, 0x3e, 0xfc, 0x1d, 0x84, 0x3e,
-  0xa7, 0xec, 0x8b, 0x3e, 0x03, 0xb6, 0x94, 0xbe, 0xf1, 0xc6, 0x9d, 0x3d,
-  0xf6, 0x14, 0xcc, 0x3e, 0x3b, 0x87, 0x9f, 0x3e, 0x48, 0xdd, 0xa7, 0x3e,
-  0x14, 0x5c, 0xcd, 0x3d, 0xae, 0xc0, 0x37, 0xbd, 0xdc, 0x1a, 0x79, 0xbe,
-  0x4d, 0x09, 0x13, 0xbf, 0x20, 0x26, 0x91, 0xbe, 0xa9, 0x9d, 0x92, 0x3e,
-  0xb3, 0x4c, 0x33, 0x3f, 0x17, 0x1a, 0x5d, 0x3f, 0x25, 0xe3, 0xc1, 0xbe,
-  0x4e, 0xc7, 0xd2, 0xbb, 0x58, 0xb3, 0x98, 0xbc, 0x90, 0x28, 0xac, 0xbf,
-  0xf9, 0x46, 0x48, 0xbf, 0x21, 0xdd, 0x8b, 0xbf, 0x4b, 0x1f, 0xe5, 0xbe,
-  0xe6, 0x6f, 0xe6, 0x3e, 0x3b, 0xf1, 0x8b, 0x3e, 0x36, 0xde, 0x4f, 0x3e,
-  0xa4, 0x19, 0xf8, 0x3e, 0x15, 0x08, 0xbb, 0x3d, 0xfd, 0x18, 0xb0, 0x3d,
-  0x28, 0x74, 0x98, 0xbc, 0xcf, 0x73, 0x9a, 0xbe, 0xa9, 0x16, 0x21, 0x3d,
-  0x50, 0x84, 0x09, 0xbd, 0xe8, 0xe5, 0xee, 0x3d, 0x67, 0xa1, 0x6e, 0x3d,
-  0x8c, 0x51, 0xd8, 0x3e, 0x5f, 0x2f, 0xbb, 0x3e, 0xe9, 0x61, 0x84, 0xbe,
-  0xe0, 0x79, 0xa4, 0x3e, 0xc3, 0x92, 0xb7, 0xbd, 0x26, 0x2b, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x36, 0x2b, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x46, 0x2b, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x48, 0x05, 0x00, 0x00, 0x56, 0x2b, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xcf, 0x77, 0x48, 0x3d,
-  0xa5, 0x81, 0x20, 0x3e, 0xef, 0x41, 0x51, 0xbd, 0x4b, 0xc1, 0xde, 0xbd,
-  0xac, 0xcf, 0xa9, 0x3d, 0x93, 0x2d, 0x36, 0xbc, 0x47, 0x77, 0x03, 0x3d,
-  0xd8, 0x60, 0xae, 0x3d, 0x6c, 0x4c, 0xd5, 0xbd, 0x3f, 0xbc, 0x5c, 0xbd,
-  0x8a, 0x2b, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0xd3, 0x00, 0x00,
-  0xba, 0x9a, 0x89, 0x3d, 0x49, 0xd2, 0x21, 0xbc, 0x03, 0x76, 0x48, 0xbc,
-  0xb9, 0xcc, 0x9d, 0xbd, 0x13, 0x00, 0xb5, 0x3b, 0x6b, 0x04, 0x2d, 0x3d,
-  0x03, 0x80, 0xd8, 0xbb, 0xf0, 0xc0, 0x9b, 0xbd, 0x9f, 0xf0, 0x88, 0x3d,
-  0x99, 0xb2, 0x89, 0xbd, 0x88, 0x16, 0xa3, 0x3d, 0xd4, 0x00, 0x30, 0xbd,
-  0x2c, 0x60, 0x03, 0x3c, 0x9a, 0xf7, 0xe6, 0x3d, 0xe6, 0x0d, 0x61, 0x3d,
-  0x34, 0x9c, 0xd0, 0x3c, 0xd6, 0x73, 0xc4, 0x3c, 0x6f, 0xb1, 0xaa, 0xbd,
-  0x42, 0x83, 0xc1, 0xbd, 0x4e, 0x19, 0x74, 0xbd, 0xb0, 0x72, 0x9c, 0xbd,
-  0x36, 0xeb, 0xd1, 0x3d, 0x40, 0x78, 0x30, 0xbd, 0x82, 0x1a, 0xdb, 0xbd,
-  0x0c, 0x90, 0x00, 0xbd, 0xe7, 0x58, 0xaa, 0xbd, 0xda, 0x98, 0x5c, 0xbd,
-  0x67, 0x9a, 0x33, 0xbd, 0xdc, 0xd4, 0x98, 0xbd, 0xe9, 0x21, 0xee, 0x3d,
-  0xb4, 0xc7, 0x87, 0xbb, 0x19, 0x1c, 0x65, 0xbd, 0x41, 0x81, 0x86, 0xbd,
-  0xcc, 0x52, 0x13, 0xbe, 0xe1, 0x3d, 0x56, 0xbd, 0xda, 0x33, 0x22, 0xbe,
-  0x34, 0x3e, 0x21, 0xbd, 0x1d, 0xb9, 0x94, 0x3d, 0x1b, 0xf1, 0xed, 0xbd,
-  0x60, 0xb0, 0xf1, 0xbd, 0x26, 0xe8, 0xdf, 0xbd, 0x8b, 0xa9, 0x39, 0xbd,
-  0x09, 0x08, 0x02, 0xbe, 0x09, 0x3e, 0x11, 0xbe, 0xd5, 0xee, 0x3a, 0xbd,
-  0x44, 0x63, 0x66, 0x3d, 0x8d, 0xb7, 0x0d, 0xbe, 0xdf, 0xae, 0x83, 0xbd,
-  0x2f, 0x0c, 0xb8, 0xbd, 0x23, 0x36, 0xa7, 0xbc, 0x27, 0x17, 0x1d, 0xbd,
-  0x2e, 0x47, 0x00, 0xbe, 0x4f, 0x25, 0xe8, 0x3c, 0xe3, 0x50, 0xf7, 0x3d,
-  0x91, 0x8f, 0x0e, 0xbe, 0x9a, 0x48, 0x27, 0xbe, 0x24, 0xd6, 0x7c, 0xbc,
-  0xc8, 0xe7, 0xd2, 0xbd, 0xc4, 0x04, 0x9c, 0xbd, 0xa7, 0x48, 0x16, 0xbe,
-  0xde, 0x71, 0x10, 0xbd, 0xec, 0x21, 0xe4, 0x3d, 0x86, 0xc6, 0x02, 0xbe,
-  0x87, 0xd8, 0xe1, 0xbd, 0x14, 0x9f, 0xcf, 0xbd, 0xb6, 0x08, 0x0a, 0xbe,
-  0x82, 0xc5, 0xd9, 0xbd, 0xec, 0x24, 0x80, 0xbd, 0xc5, 0xac, 0xe0, 0xba,
-  0x8e, 0xce, 0xb1, 0x3c, 0x8d, 0x67, 0xb1, 0xbd, 0xfc, 0x98, 0x9f, 0xbd,
-  0x2b, 0xea, 0x83, 0xbd, 0x3b, 0xa3, 0x35, 0xbe, 0x47, 0x93, 0x52, 0xbe,
-  0x89, 0x5b, 0x25, 0xbe, 0xf5, 0x15, 0x50, 0xbe, 0x01, 0x2d, 0x23, 0x3d,
-  0x8c, 0x59, 0x3e, 0xbe, 0xc1, 0x12, 0x53, 0xbe, 0xbd, 0xc5, 0xee, 0xbd,
-  0xfb, 0x19, 0x0d, 0xbe, 0x20, 0x9e, 0x70, 0xbd, 0xa3, 0x40, 0x89, 0xbd,
-  0xe5, 0xaa, 0xfd, 0xbd, 0x42, 0x00, 0x82, 0x3d, 0x27, 0x33, 0x1f, 0xbd,
-  0xf6, 0x51, 0xfe, 0xbd, 0x86, 0xa9, 0x94, 0x3d, 0x36, 0xce, 0xfe, 0xbc,
-  0x4d, 0xf7, 0x79, 0xbd, 0xdc, 0xe4, 0x1e, 0xbe, 0x2a, 0xf8, 0xad, 0xbc,
-  0x43, 0x8d, 0xcd, 0x3d, 0x1d, 0x1d, 0x25, 0xbd, 0x0b, 0x35, 0xe3, 0xbc,
-  0x9f, 0x6a, 0x2a, 0x3c, 0xc7, 0x48, 0x9e, 0xbd, 0x3f, 0x18, 0x63, 0xbd,
-  0x26, 0x9a, 0xa0, 0xbd, 0x1a, 0x32, 0x92, 0xbc, 0x85, 0x7e, 0x07, 0x3d,
-  0xc3, 0x3d, 0x8a, 0xbd, 0xba, 0x72, 0x90, 0xbd, 0x53, 0x34, 0x92, 0x3d,
-  0x97, 0xfa, 0xf2, 0x3c, 0x0d, 0x55, 0x02, 0x3d, 0x0d, 0x39, 0xb1, 0x3d,
-  0x2d, 0x62, 0x23, 0xbc, 0x81, 0xb5, 0x01, 0x3d, 0x76, 0xdf, 0x5d, 0x3d,
-  0xd9, 0x70, 0x7a, 0x3b, 0x9b, 0xcc, 0x5d, 0xbd, 0x35, 0x7b, 0xce, 0xbd,
-  0x99, 0xcf, 0x1a, 0xbe, 0x13, 0x46, 0x1a, 0xbe, 0xe8, 0x64, 0x00, 0xbd,
-  0xce, 0xb0, 0x06, 0x3e, 0xbf, 0xac, 0xbb, 0xbd, 0xdc, 0x73, 0x0c, 0xbe,
-  0xf2, 0xdf, 0xb9, 0x3c, 0x27, 0x7f, 0xb7, 0xbd, 0x41, 0xa0, 0xc4, 0xbd,
-  0xd1, 0x0a, 0xf2, 0xbd, 0x57, 0xd6, 0x0d, 0xbe, 0x7e, 0xd1, 0x92, 0x3d,
-  0xc0, 0x63, 0x36, 0xbe, 0x49, 0x93, 0xad, 0xbd, 0xac, 0xec, 0xd2, 0x3c,
-  0xfc, 0x45, 0x97, 0xbd, 0x62, 0x6d, 0xf2, 0xbc, 0x13, 0x59, 0x2f, 0xbc,
-  0xa8, 0x3a, 0x7b, 0xbd, 0xd2, 0xa0, 0x6f, 0x3c, 0xb8, 0x34, 0x32, 0xbc,
-  0xe3, 0x18, 0x57, 0xbd, 0x4d, 0xcd, 0x4d, 0xbd, 0x1e, 0x4b, 0x13, 0x3d,
-  0x25, 0xfe, 0x08, 0xbe, 0x95, 0x96, 0xc7, 0xbc, 0xb7, 0x72, 0x6f, 0xbd,
-  0x4d, 0x57, 0xaa, 0x3d, 0xdb, 0xaa, 0x02, 0xbe, 0x92, 0xd4, 0xab, 0xbd,
-  0xec, 0xb4, 0x40, 0x3d, 0xe2, 0x5c, 0x27, 0xbd, 0x9e, 0xf4, 0xc9, 0xbd,
-  0x3d, 0xd9, 0xcb, 0xbc, 0xa3, 0x31, 0x82, 0xbd, 0x10, 0xf3, 0x70, 0x3d,
-  0xd4, 0x3c, 0xbc, 0xbd, 0xff, 0xde, 0x8c, 0xbd, 0x64, 0x5d, 0xb3, 0x3d,
-  0xcf, 0xf6, 0xa1, 0x3c, 0x91, 0x89, 0x4a, 0xbc, 0x2f, 0x8b, 0x85, 0xbd,
-  0x71, 0x44, 0x9e, 0xbd, 0x53, 0xf2, 0x94, 0x3d, 0x0c, 0x92, 0xc4, 0xbd,
-  0xd8, 0x3c, 0x9b, 0xbc, 0x32, 0x5c, 0x20, 0x3d, 0x41, 0x16, 0x1b, 0x3d,
-  0x71, 0x20, 0xd5, 0xbd, 0x8a, 0xf7, 0x69, 0xbc, 0xe6, 0x9c, 0x64, 0xbd,
-  0x49, 0x79, 0x6a, 0x3e, 0x6b, 0x17, 0xf5, 0xbd, 0x63, 0x31, 0x48, 0xbd,
-  0x62, 0x8f, 0xaa, 0x3c, 0x0a, 0xc1, 0x21, 0xbd, 0xe7, 0x42, 0xcb, 0xbd,
-  0x63, 0x4e, 0x0c, 0xbd, 0x29, 0xc3, 0x07, 0xbe, 0xb3, 0xff, 0x63, 0x3e,
-  0xc5, 0x09, 0xb0, 0xbd, 0xc2, 0x0e, 0xa6, 0xbd, 0x68, 0xe0, 0x52, 0x3c,
-  0xa3, 0x63, 0x45, 0xbd, 0xb8, 0x6c, 0x32, 0xbd, 0x81, 0xbe, 0x31, 0x3b,
-  0x52, 0x49, 0x0b, 0xbe, 0xd6, 0xb8, 0x5c, 0x3d, 0x10, 0x3c, 0x08, 0xbe,
-  0x11, 0x4b, 0x13, 0xbd, 0x93, 0xb9, 0xaa, 0xbd, 0x61, 0x92, 0x20, 0xbd,
-  0xc7, 0x0b, 0x02, 0xbe, 0x84, 0x5a, 0x40, 0xbc, 0xe5, 0x88, 0x0f, 0xbe,
-  0x5b, 0x80, 0xb8, 0x3d, 0x3d, 0x96, 0x9d, 0xbd, 0xb5, 0xc5, 0xfe, 0xbd,
-  0x96, 0x1e, 0xd7, 0xbb, 0xed, 0xef, 0x4f, 0xbd, 0x29, 0xe2, 0x4e, 0xbd,
-  0x7c, 0x4e, 0x2e, 0xbd, 0x66, 0x27, 0x54, 0xbd, 0xae, 0xf5, 0xa6, 0x3d,
-  0x87, 0x02, 0x24, 0xbc, 0x8b, 0xd1, 0x0c, 0xbe, 0x75, 0xc9, 0x87, 0xbd,
-  0x7f, 0x78, 0x63, 0xbe, 0xed, 0xd9, 0xb9, 0xbd, 0xc7, 0x7a, 0xf4, 0xbd,
-  0xd4, 0x02, 0x08, 0xbe, 0x72, 0x73, 0x37, 0x3d, 0xa3, 0x69, 0x14, 0xbe,
-  0x14, 0x60, 0x09, 0xbe, 0xcd, 0x16, 0xd8, 0x3d, 0x5a, 0x60, 0x1c, 0xbd,
-  0xbc, 0x85, 0x30, 0x3c, 0x4a, 0x9b, 0xb6, 0xbd, 0xf2, 0x6d, 0xf1, 0xbd,
-  0xfb, 0x5a, 0x72, 0x3d, 0x61, 0x42, 0xcd, 0xbc, 0x44, 0x64, 0xc3, 0xbc,
-  0xe4, 0xef, 0xe9, 0x3c, 0x04, 0x82, 0x17, 0xbe, 0x5d, 0xb4, 0x5f, 0xbe,
-  0x69, 0x9e, 0x01, 0xbe, 0xd1, 0x60, 0xf8, 0xbd, 0x09, 0x34, 0x9a, 0x3d,
-  0xb9, 0xe6, 0x03, 0xbe, 0x78, 0xc0, 0xd2, 0xbd, 0x6b, 0x6b, 0xe0, 0xbc,
-  0x8b, 0x68, 0xd5, 0xbd, 0x8b, 0x42, 0xca, 0xbd, 0xe2, 0xfd, 0x02, 0xbe,
-  0xb5, 0x07, 0x55, 0xbe, 0x58, 0xbd, 0xba, 0xbc, 0xce, 0xa6, 0x18, 0xbd,
-  0x60, 0x61, 0x02, 0xbd, 0x46, 0x96, 0xa1, 0xbd, 0x68, 0xf9, 0x0a, 0xbd,
-  0x3f, 0xdb, 0xad, 0xbd, 0x22, 0x9d, 0x8f, 0xbd, 0x29, 0x60, 0xed, 0xbd,
-  0x35, 0x02, 0xdb, 0xbc, 0x2a, 0xd9, 0x0c, 0xbe, 0x4a, 0x8e, 0x26, 0xbe,
-  0x42, 0x61, 0xef, 0xbc, 0x1a, 0x25, 0xa6, 0xbd, 0x79, 0xbc, 0x5c, 0xbd,
-  0x7d, 0x8d, 0x8d, 0xbb, 0x49, 0xe8, 0x23, 0xbe, 0xfc, 0x5e, 0x0d, 0xbe,
-  0x69, 0xe4, 0xb8, 0xbd, 0xc4, 0xff, 0xc4, 0x3c, 0xbc, 0x69, 0x61, 0xbc,
-  0x60, 0xa9, 0x21, 0xbd, 0x01, 0x26, 0xfe, 0xbc, 0xc1, 0xc0, 0x89, 0x3d,
-  0xa3, 0xd4, 0x85, 0xbd, 0xcf, 0x33, 0x41, 0xbe, 0xd9, 0x1d, 0xca, 0xbc,
-  0x3b, 0x91, 0x7a, 0xbd, 0x2a, 0x45, 0xe6, 0xbb, 0x7a, 0xbd, 0x8c, 0x3b,
-  0xc4, 0x77, 0xe5, 0xbb, 0x5d, 0x1b, 0x51, 0x3d, 0x11, 0xdf, 0x35, 0x3d,
-  0x17, 0x45, 0x95, 0xbd, 0x15, 0x8a, 0x4b, 0x3c, 0xc6, 0xa7, 0xb8, 0xbc,
-  0xbe, 0xd8, 0x39, 0x3c, 0x5a, 0x5e, 0xf8, 0xba, 0x0e, 0xa4, 0xc4, 0x3c,
-  0x45, 0x36, 0x12, 0x3d, 0x53, 0x22, 0x33, 0xbd, 0x9e, 0x67, 0x9b, 0x3d,
-  0xd7, 0x1a, 0x7d, 0xbd, 0x80, 0x8e, 0x4a, 0x3d, 0x58, 0xb7, 0xe4, 0x3d,
-  0x94, 0xb0, 0xa2, 0x3d, 0xe6, 0xf5, 0x4d, 0x3d, 0xf9, 0x44, 0x11, 0x3d,
-  0xa8, 0x84, 0x45, 0xbb, 0xdb, 0x3a, 0x86, 0xbd, 0x74, 0x4b, 0xc3, 0xbc,
-  0x91, 0x43, 0x4e, 0x3d, 0x82, 0x85, 0x03, 0x3c, 0x31, 0x41, 0x96, 0x3d,
-  0x50, 0x46, 0x60, 0xbc, 0x69, 0x7e, 0xb8, 0xbc, 0xdf, 0x2a, 0x0e, 0xbd,
-  0x6a, 0x9f, 0x43, 0xbd, 0xa9, 0x39, 0x46, 0xbd, 0x6b, 0x46, 0xc3, 0xbc,
-  0x93, 0x91, 0x98, 0x3c, 0xa8, 0xb0, 0xd1, 0x3d, 0x79, 0x66, 0xa5, 0xbd,
-  0x10, 0x5c, 0xb3, 0x3b, 0x4a, 0x5e, 0x47, 0xbe, 0x65, 0x9b, 0xf1, 0xbd,
-  0xb0, 0xbf, 0x10, 0xbc, 0x4f, 0xbb, 0xfd, 0xbc, 0xb8, 0x4d, 0x7f, 0x3c,
-  0xe0, 0xfa, 0x3b, 0xbd, 0x6e, 0xba, 0xc0, 0x3b, 0xaf, 0xa0, 0x26, 0x3d,
-  0x2a, 0xd3, 0x02, 0xbe, 0xe4, 0x50, 0x92, 0x3b, 0x6c, 0x85, 0xa3, 0xbd,
-  0x21, 0xbf, 0x09, 0xbd, 0xa6, 0xa9, 0x52, 0xbc, 0x13, 0x3e, 0x77, 0xbe,
-  0x91, 0x7b, 0x6c, 0xbd, 0x1b, 0x28, 0x0d, 0xbe, 0x34, 0x6b, 0x3f, 0xbe,
-  0x2e, 0x19, 0x94, 0x3d, 0xab, 0x59, 0x33, 0xbe, 0x5b, 0x15, 0x88, 0xbe,
-  0x1e, 0x1a, 0xcb, 0x3c, 0xc7, 0xdb, 0x40, 0x3d, 0x24, 0x08, 0xb6, 0xbd,
-  0xe4, 0x55, 0xf6, 0x3c, 0xd3, 0x9f, 0x73, 0x3c, 0xb4, 0x01, 0xae, 0x3d,
-  0x3e, 0x0e, 0x68, 0x3d, 0x6b, 0xfb, 0x10, 0x3d, 0x9e, 0x56, 0xac, 0x3d,
-  0x94, 0x69, 0xb2, 0xbd, 0xf2, 0x8b, 0x88, 0xbd, 0x60, 0x40, 0xc9, 0xbd,
-  0xb8, 0x1a, 0x4d, 0xbd, 0x94, 0x38, 0x5c, 0x3c, 0x94, 0x1f, 0xa5, 0xbd,
-  0xc1, 0xa8, 0x8d, 0xbd, 0x55, 0x7b, 0x19, 0xbd, 0x92, 0xd2, 0xd6, 0xbd,
-  0x7c, 0x86, 0xc5, 0xbd, 0x46, 0x55, 0x08, 0xbd, 0xc1, 0x9b, 0xcc, 0xbd,
-  0xdb, 0x2e, 0xbb, 0xbd, 0x1e, 0xc4, 0xe6, 0xbc, 0xb1, 0x00, 0x61, 0xbd,
-  0xe1, 0xa0, 0x4d, 0xbc, 0x3c, 0xd0, 0x58, 0x3c, 0xf2, 0xd8, 0x25, 0xbc,
-  0x47, 0xf4, 0x9c, 0xbd, 0x56, 0x2a, 0xb6, 0xbd, 0x9b, 0xf9, 0x5d, 0xbe,
-  0xee, 0x97, 0x3e, 0xbd, 0xc8, 0xfd, 0xd7, 0x3c, 0xb0, 0xf4, 0x52, 0xbd,
-  0x4b, 0x27, 0x91, 0xbd, 0xb7, 0xf7, 0x83, 0x3c, 0xfc, 0x88, 0x25, 0x3d,
-  0xa5, 0x9a, 0x79, 0xbd, 0xc1, 0x4f, 0x19, 0xbe, 0x2c, 0xdb, 0x06, 0x3c,
-  0xae, 0x09, 0x25, 0x3d, 0xeb, 0x11, 0xdc, 0xbd, 0x04, 0x54, 0x90, 0xbd,
-  0x7d, 0x0c, 0x96, 0xbd, 0x24, 0xa8, 0xfb, 0xbc, 0x0f, 0xec, 0x67, 0xbd,
-  0x51, 0xb3, 0x56, 0xbc, 0x27, 0x26, 0x3c, 0xbd, 0x48, 0x26, 0x36, 0x3b,
-  0xb4, 0x62, 0x8a, 0xbb, 0xbb, 0xfd, 0x24, 0x3d, 0x25, 0xe5, 0x2d, 0x3d,
-  0xc0, 0xcf, 0x30, 0x3c, 0x47, 0x10, 0x9f, 0xbd, 0x5a, 0xe9, 0x18, 0xbd,
-  0xdd, 0x21, 0xc5, 0xbb, 0xb5, 0x51, 0x84, 0x3d, 0x79, 0xa8, 0xe8, 0x3d,
-  0xf0, 0x5f, 0x9d, 0x3d, 0x7c, 0x49, 0x0b, 0x3a, 0x8f, 0x6e, 0x9f, 0x3d,
-  0xbb, 0x97, 0x32, 0x3c, 0xc0, 0x6d, 0xa6, 0x3c, 0x0f, 0xee, 0x1b, 0xbc,
-  0x57, 0x20, 0x4f, 0x3d, 0xa0, 0x03, 0xa3, 0x3d, 0x09, 0x1a, 0x3c, 0x3e,
-  0x22, 0xee, 0x28, 0xba, 0x08, 0x88, 0x92, 0x3d, 0x2f, 0xab, 0x82, 0x3d,
-  0x78, 0x74, 0xc3, 0x3b, 0x6b, 0xd3, 0x2e, 0x3d, 0xe0, 0x79, 0xbd, 0x3d,
-  0xc5, 0x91, 0x56, 0x3d, 0x67, 0x9c, 0xfe, 0x3d, 0x2a, 0xc5, 0xf8, 0xbc,
-  0xc6, 0x34, 0x4b, 0xbc, 0x4e, 0x21, 0xbb, 0xbd, 0xcb, 0x08, 0xcc, 0xbd,
-  0x79, 0xcf, 0x78, 0x3d, 0x57, 0x23, 0x0a, 0x3d, 0x0a, 0xe4, 0xab, 0xbd,
-  0xba, 0x5f, 0xcf, 0x3d, 0xf5, 0xa9, 0x92, 0xbc, 0xe2, 0xaf, 0x9f, 0x3c,
-  0x11, 0xa2, 0x23, 0xbb, 0xcb, 0x68, 0x3a, 0xbd, 0xd0, 0x52, 0xfd, 0x3c,
-  0x13, 0xad, 0x51, 0x3d, 0x8d, 0x9d, 0x6c, 0xbd, 0x4e, 0x5d, 0xe8, 0x3d,
-  0x65, 0x08, 0x8b, 0x3d, 0x26, 0x0b, 0xf2, 0xbc, 0x81, 0x47, 0xcd, 0xbd,
-  0x82, 0x7e, 0x94, 0xbd, 0xe6, 0xaa, 0xe3, 0xbc, 0xd4, 0xe7, 0x9c, 0x3d,
-  0xc6, 0x76, 0x07, 0xbe, 0x0c, 0xb8, 0x09, 0xbe, 0xd5, 0xe9, 0xbb, 0xbd,
-  0x24, 0x99, 0x83, 0xbe, 0x2b, 0xb6, 0xa2, 0xbd, 0x5b, 0x77, 0x8f, 0xbc,
-  0x06, 0x6c, 0x1e, 0xbe, 0x29, 0x7b, 0x5b, 0xbe, 0xc6, 0xcc, 0x07, 0x3d,
-  0x82, 0xc0, 0xb8, 0x3a, 0x9f, 0x3f, 0x8f, 0xbc, 0x86, 0xa9, 0xfb, 0x3c,
-  0x02, 0xb2, 0x0a, 0xbd, 0x50, 0x31, 0x8d, 0x3b, 0x2c, 0xf0, 0xf6, 0xbc,
-  0x7e, 0x9b, 0x95, 0x3d, 0xe7, 0x37, 0xf0, 0xbc, 0x2f, 0x2b, 0xc4, 0xbd,
-  0x63, 0xdb, 0x6e, 0xbd, 0x5f, 0xe1, 0xed, 0xbd, 0x9a, 0x2b, 0xff, 0xbd,
-  0xd5, 0xbf, 0xd4, 0x3d, 0xfe, 0x61, 0xb5, 0xbd, 0xd1, 0x8e, 0xdc, 0xbd,
-  0xdd, 0xf0, 0x97, 0x3b, 0x07, 0xd2, 0xa9, 0x3c, 0xbc, 0x51, 0x96, 0xba,
-  0xa6, 0x57, 0x95, 0xbc, 0xc2, 0x7e, 0xf5, 0xbd, 0x0e, 0xbb, 0xd7, 0xbd,
-  0xb6, 0x2f, 0x3b, 0xbd, 0x0e, 0x61, 0x29, 0xbd, 0x45, 0xd6, 0x15, 0x3d,
-  0x03, 0x30, 0xa6, 0xbd, 0xb8, 0xc7, 0x12, 0xbd, 0xd0, 0xf9, 0x90, 0xbc,
-  0x73, 0x1b, 0xca, 0xbd, 0x7a, 0xd6, 0x6f, 0xbd, 0xfa, 0xdc, 0x81, 0x3d,
-  0xee, 0xb4, 0x8b, 0xbb, 0x6d, 0x6f, 0x36, 0xbd, 0x3a, 0x1a, 0x6a, 0xbd,
-  0xb3, 0xb9, 0x3f, 0xbd, 0x0a, 0x0b, 0x4b, 0xbd, 0x3b, 0xb6, 0x9d, 0x3c,
-  0x58, 0x55, 0x25, 0xbc, 0x9b, 0xa7, 0x5d, 0xbd, 0xdc, 0xae, 0x2f, 0x3d,
-  0xb0, 0xe2, 0x67, 0xbd, 0xf6, 0x00, 0xf6, 0x3c, 0xed, 0x11, 0x7b, 0x3d,
-  0x18, 0x91, 0x8d, 0x3d, 0x51, 0xf6, 0xd2, 0xbc, 0xd9, 0x15, 0x52, 0xbe,
-  0xce, 0x19, 0x91, 0x3d, 0xf9, 0x7d, 0x66, 0xbd, 0x76, 0x5b, 0x2c, 0xbe,
-  0x68, 0x24, 0x82, 0xbd, 0xfc, 0x73, 0x53, 0x3d, 0x31, 0x7e, 0xec, 0xbc,
-  0xe5, 0x74, 0x82, 0x3d, 0x54, 0x86, 0xc8, 0xbd, 0xd2, 0x44, 0x05, 0x3d,
-  0x4a, 0x94, 0x3e, 0x3d, 0xc4, 0xfb, 0xae, 0xbe, 0x19, 0xb9, 0x16, 0x3d,
-  0x89, 0x5d, 0xd3, 0x3d, 0x3d, 0x45, 0xb0, 0x3c, 0x02, 0xec, 0x2d, 0x3d,
-  0x7e, 0x68, 0xa0, 0xbd, 0x1b, 0xe9, 0x92, 0x3d, 0xc2, 0x25, 0xcd, 0xbb,
-  0x04, 0x2e, 0x6f, 0xbe, 0x80, 0x89, 0x3d, 0x3d, 0x0c, 0xa1, 0xde, 0x3d,
-  0x3b, 0x79, 0x5b, 0x3d, 0xbb, 0xa3, 0x8e, 0xbd, 0xaf, 0x4b, 0xbf, 0xbd,
-  0xb0, 0x47, 0xb2, 0x3d, 0x53, 0x6f, 0xf1, 0x3d, 0x3a, 0xd2, 0x7a, 0xbe,
-  0x19, 0x39, 0xcb, 0x3d, 0xb8, 0x77, 0xc5, 0x3b, 0x96, 0x48, 0x98, 0x3c,
-  0x10, 0x22, 0x3a, 0xbd, 0x26, 0x3c, 0x42, 0xbe, 0xb2, 0xa8, 0xad, 0x3c,
-  0x56, 0x03, 0xe8, 0x3d, 0x5f, 0xfd, 0x24, 0xbd, 0xd0, 0xf4, 0xe1, 0x3d,
-  0xb8, 0x70, 0xca, 0x3d, 0x89, 0xb9, 0x4a, 0xbb, 0xc5, 0x1e, 0xc6, 0xbd,
-  0xd9, 0x63, 0x25, 0xbe, 0x6c, 0x11, 0x4e, 0x3d, 0x8d, 0x06, 0xa1, 0x3d,
-  0xd3, 0x43, 0x61, 0xbd, 0x6c, 0xae, 0xa0, 0x3d, 0x9a, 0x46, 0xcd, 0x3b,
-  0xed, 0xe6, 0x0e, 0x3e, 0xe6, 0xcf, 0xc8, 0xbd, 0xf0, 0x7e, 0x09, 0xbe,
-  0xa2, 0xc5, 0xd3, 0x3d, 0x6d, 0x3d, 0x84, 0x3d, 0xe6, 0x84, 0xff, 0xbd,
-  0x02, 0xee, 0xf7, 0xbd, 0x43, 0xda, 0xb2, 0xbd, 0xeb, 0xfe, 0x71, 0xbd,
-  0x34, 0x44, 0x85, 0xbd, 0x4a, 0x1e, 0x96, 0x3d, 0xea, 0xb5, 0x36, 0xbe,
-  0xcc, 0xf7, 0x42, 0xbe, 0x77, 0x97, 0x7e, 0x3d, 0xaf, 0x47, 0x99, 0xbd,
-  0x9f, 0x09, 0x91, 0xbd, 0x2f, 0x43, 0x05, 0x3d, 0x15, 0xbf, 0xad, 0x3d,
-  0xdf, 0xec, 0x8a, 0x3d, 0xec, 0x09, 0xa0, 0xbc, 0xad, 0x7b, 0xcc, 0xbd,
-  0xb1, 0xd7, 0xe5, 0x3c, 0xe4, 0x22, 0x06, 0x3d, 0xba, 0xec, 0xc3, 0xbd,
-  0xe4, 0x82, 0xe3, 0xbd, 0xfc, 0xf9, 0x36, 0xbd, 0x9c, 0x36, 0x02, 0xbd,
-  0x5c, 0xba, 0x37, 0xbd, 0x43, 0x54, 0x01, 0xbe, 0xf2, 0x69, 0xd6, 0x3d,
-  0xdc, 0x10, 0xa8, 0x3d, 0xc5, 0xb8, 0xa6, 0x3c, 0xd7, 0x3b, 0x27, 0x3d,
-  0x73, 0x0c, 0xd9, 0xbd, 0x73, 0xc5, 0x00, 0xbe, 0xb3, 0x07, 0xb3, 0x3c,
-  0x83, 0xbe, 0x8a, 0x3d, 0x31, 0x22, 0xdf, 0x3c, 0x3c, 0xe3, 0x7b, 0xbd,
-  0x20, 0x13, 0x09, 0xbc, 0x11, 0x7f, 0x96, 0x3d, 0x01, 0x28, 0x58, 0xbd,
-  0x2f, 0xd0, 0x4f, 0xbe, 0x8a, 0x46, 0x24, 0x3b, 0xbc, 0xd3, 0x7b, 0xbb,
-  0x9c, 0x75, 0xd0, 0x3a, 0x01, 0x76, 0x55, 0xbd, 0xcd, 0xac, 0x4c, 0xbd,
-  0xbf, 0xb9, 0x99, 0x3d, 0x26, 0x0e, 0x2f, 0xbd, 0x28, 0x97, 0x30, 0xbe,
-  0x47, 0xe3, 0x54, 0xbc, 0x8d, 0x42, 0x03, 0xbd, 0x6a, 0x73, 0xb8, 0xbd,
-  0xe1, 0x7b, 0x2c, 0xbd, 0x69, 0x9a, 0x29, 0xbc, 0x8e, 0xff, 0x90, 0x3c,
-  0xc4, 0x4a, 0x05, 0xbd, 0xcc, 0x71, 0xae, 0xbe, 0xe6, 0x27, 0xad, 0x3d,
-  0x8a, 0x2b, 0x11, 0x3d, 0x71, 0x28, 0xc5, 0xbe, 0xc4, 0x6a, 0x37, 0xbe,
-  0x02, 0x3d, 0xbf, 0xbc, 0x6a, 0xa3, 0x7e, 0xbc, 0xf0, 0x9f, 0xa4, 0xbb,
-  0xfa, 0x3d, 0xcd, 0x39, 0x80, 0xbd, 0xad, 0xbd, 0xdb, 0x84, 0xad, 0xbd,
-  0x18, 0x89, 0x0b, 0xbf, 0xd6, 0x0e, 0x36, 0xbe, 0x82, 0xd1, 0x54, 0xbd,
-  0x63, 0xcb, 0xf8, 0xbd, 0x7f, 0xe1, 0xf8, 0xbc, 0xd6, 0xf2, 0xe3, 0x3d,
-  0xe4, 0x27, 0x19, 0xbe, 0x86, 0x11, 0xa6, 0xbd, 0x7a, 0x20, 0xff, 0xbe,
-  0x21, 0x09, 0x40, 0xbd, 0x04, 0x2b, 0x5d, 0x3d, 0x2e, 0x32, 0x00, 0x3b,
-  0x00, 0x58, 0x0e, 0xbe, 0x4e, 0x2a, 0x10, 0xbe, 0x2d, 0x9d, 0x5c, 0x3d,
-  0xb5, 0xc8, 0x02, 0x3d, 0xb3, 0x06, 0xa5, 0xbe, 0xd2, 0x7f, 0xd8, 0x3d,
-  0x07, 0x8f, 0x88, 0x3d, 0x0c, 0xf2, 0xaa, 0x3d, 0x67, 0x78, 0xb2, 0xbc,
-  0x4d, 0xdb, 0x3d, 0xbe, 0xde, 0x74, 0xf0, 0x3c, 0xa0, 0xbb, 0x5a, 0x3d,
-  0xc5, 0xe3, 0x12, 0xbe, 0x61, 0x80, 0x05, 0x3e, 0xc9, 0x5d, 0xa2, 0x3d,
-  0x5b, 0x65, 0xe8, 0x3d, 0xaa, 0x52, 0x54, 0x3c, 0xf4, 0x81, 0x10, 0xbe,
-  0xe1, 0x85, 0xeb, 0x3d, 0xd9, 0x1c, 0xcc, 0x3d, 0x07, 0xe5, 0x4b, 0xbb,
-  0xba, 0x54, 0x0e, 0x3e, 0x24, 0x76, 0xb7, 0x3d, 0x42, 0x94, 0x04, 0x3e,
-  0x69, 0xe2, 0xf4, 0xbc, 0x91, 0x5c, 0x56, 0xbe, 0xeb, 0xba, 0x11, 0x3e,
-  0xd6, 0xe1, 0x0e, 0x3e, 0x77, 0x1a, 0xce, 0xbc, 0x20, 0xd2, 0x0f, 0x3d,
-  0x9d, 0x4f, 0x3c, 0x3d, 0xf9, 0x53, 0xc1, 0x3b, 0x54, 0x12, 0x76, 0xbc,
-  0x37, 0x77, 0x97, 0xbc, 0xf6, 0x52, 0xdc, 0xbd, 0x06, 0x65, 0x85, 0xbd,
-  0x3d, 0xc7, 0x92, 0xbb, 0xaa, 0xbb, 0x2f, 0xbe, 0x6e, 0x04, 0x9b, 0xbc,
-  0xe9, 0x31, 0x00, 0xbe, 0x48, 0xef, 0xf3, 0xbd, 0x73, 0xc9, 0x1e, 0x3d,
-  0x3f, 0x1d, 0xef, 0xbd, 0xe0, 0xb5, 0x13, 0xbd, 0x9c, 0x5d, 0xd2, 0x3c,
-  0x53, 0xe6, 0x87, 0xbc, 0x36, 0x15, 0x9b, 0xbb, 0x96, 0xdf, 0xa1, 0xbd,
-  0xd3, 0x5b, 0xa1, 0xbd, 0x7c, 0xc5, 0xb1, 0xbd, 0xa0, 0x24, 0xb9, 0xbc,
-  0x17, 0xe0, 0xb2, 0xbc, 0xe8, 0x93, 0xda, 0x3a, 0xce, 0x36, 0xc5, 0x3d,
-  0xe5, 0xff, 0x96, 0x3d, 0x2a, 0xf1, 0x71, 0x3d, 0x06, 0xfc, 0x82, 0x3a,
-  0x64, 0x52, 0x50, 0xbe, 0x5e, 0x37, 0xd8, 0x3d, 0x0e, 0x50, 0xf4, 0x3d,
-  0xd0, 0xa8, 0x51, 0x3d, 0x85, 0xe0, 0x3a, 0x3d, 0xe7, 0x69, 0xdf, 0x3d,
-  0x04, 0xab, 0x72, 0x3d, 0xc9, 0x82, 0xf2, 0xbb, 0xf8, 0x11, 0xd3, 0xbe,
-  0xe3, 0x7a, 0xcb, 0x3d, 0xa1, 0x9e, 0x4b, 0x3c, 0xc6, 0xc4, 0x12, 0xbc,
-  0xf4, 0xed, 0x4d, 0x3d, 0x6b, 0x9b, 0xb1, 0x3d, 0xc2, 0x4c, 0x14, 0x3e,
-  0xc3, 0xf4, 0xa2, 0x3d, 0x17, 0xff, 0xcd, 0xbe, 0x44, 0x31, 0xa3, 0x3c,
-  0x42, 0x89, 0xbb, 0x3d, 0x42, 0x46, 0x96, 0xbe, 0x97, 0x46, 0x78, 0xbd,
-  0xad, 0x29, 0x04, 0x3d, 0x2c, 0xc7, 0xac, 0x3c, 0xb6, 0x00, 0x29, 0x3d,
-  0x9d, 0x01, 0xa5, 0xbe, 0xd3, 0x53, 0xea, 0xbc, 0x0f, 0x1b, 0x1d, 0xbc,
-  0xbe, 0xf3, 0xb8, 0xbe, 0x5f, 0x58, 0x85, 0xbe, 0xd3, 0x9f, 0x53, 0xbe,
-  0x37, 0x49, 0x6f, 0xbe, 0x4a, 0xdf, 0xfc, 0xbc, 0x89, 0xd7, 0x24, 0xbe,
-  0x99, 0x72, 0xb1, 0xbd, 0xee, 0xde, 0x80, 0xbe, 0x7b, 0x14, 0x54, 0xbe,
-  0x60, 0xeb, 0x83, 0xbe, 0xc8, 0x4b, 0x6c, 0xbe, 0x13, 0x66, 0xce, 0xbd,
-  0xaf, 0x78, 0x8a, 0xbe, 0x8b, 0xa8, 0xb7, 0xbd, 0xcb, 0x2e, 0x80, 0xbe,
-  0x76, 0x7a, 0x42, 0xbe, 0xd0, 0xcd, 0x72, 0xbe, 0x37, 0xe1, 0xc6, 0xbd,
-  0xd0, 0x35, 0xd6, 0xbd, 0x7c, 0x91, 0x20, 0x3d, 0x06, 0x27, 0x0c, 0xbe,
-  0x72, 0xdd, 0xcf, 0xbd, 0xd8, 0x8a, 0x18, 0xbd, 0x9e, 0x27, 0x4e, 0xbd,
-  0xb4, 0x8e, 0x8e, 0xbe, 0x58, 0x5d, 0x2b, 0xbd, 0xd0, 0x1a, 0x0f, 0x3d,
-  0xad, 0xe1, 0x3d, 0x3d, 0x9a, 0x78, 0xeb, 0xbc, 0x92, 0x4b, 0xaf, 0x3c,
-  0x78, 0x3e, 0xb7, 0x3d, 0xce, 0x27, 0xd4, 0x3d, 0x98, 0xd9, 0x55, 0xbe,
-  0xae, 0x66, 0xc8, 0x3d, 0x06, 0x81, 0x4e, 0x3c, 0x33, 0x7c, 0x21, 0x3e,
-  0x50, 0x23, 0x0d, 0xbd, 0x44, 0xb1, 0x6e, 0xbd, 0x85, 0x1e, 0x9f, 0x3d,
-  0xb5, 0xc7, 0xce, 0x3d, 0x1f, 0x71, 0x19, 0xbe, 0x48, 0xb3, 0x48, 0x3e,
-  0xa1, 0x62, 0x51, 0x3e, 0xc3, 0x0e, 0x70, 0x3e, 0x32, 0xf0, 0x1a, 0x3d,
-  0x70, 0x6c, 0x07, 0xbe, 0x09, 0x80, 0x20, 0x3e, 0xee, 0xbb, 0x2a, 0x3e,
-  0x4c, 0xfc, 0x87, 0xbd, 0x02, 0x89, 0x8e, 0x3d, 0xe2, 0x5b, 0x15, 0x3e,
-  0x76, 0xff, 0xa0, 0xbc, 0x58, 0x6f, 0xc2, 0x3d, 0x0a, 0x0b, 0x16, 0x3d,
-  0xda, 0xc6, 0x42, 0x3d, 0xf3, 0xbd, 0x4e, 0x3d, 0x7e, 0x26, 0x39, 0x3d,
-  0x0d, 0xe5, 0x5d, 0xbe, 0x44, 0x8b, 0x68, 0xbe, 0xe5, 0x4d, 0x55, 0xbe,
-  0xed, 0xd1, 0x1c, 0xbe, 0xa2, 0xb0, 0x9c, 0x3d, 0x60, 0x0c, 0x53, 0xbe,
-  0x1a, 0x4c, 0x1a, 0xbe, 0x10, 0xb9, 0x3c, 0x3c, 0x43, 0x4f, 0x27, 0xbb,
-  0x04, 0xff, 0xcf, 0x3c, 0x36, 0x19, 0x05, 0x3c, 0x1c, 0xfb, 0x3f, 0xbc,
-  0xdc, 0x9b, 0xe3, 0xbc, 0x35, 0x53, 0x78, 0x3b, 0x43, 0xe3, 0x10, 0x3d,
-  0x53, 0x20, 0x34, 0xbe, 0x49, 0xcb, 0x8e, 0xbb, 0xea, 0x5a, 0xff, 0x3d,
-  0x17, 0xb8, 0x23, 0x3d, 0x9f, 0xec, 0xad, 0xbc, 0xd7, 0xcb, 0x2a, 0xbe,
-  0xbb, 0x6a, 0x4d, 0x3d, 0x39, 0x49, 0xe8, 0x3d, 0x94, 0x85, 0x37, 0xbe,
-  0x65, 0x50, 0x84, 0x3d, 0xc3, 0x05, 0x4d, 0x3d, 0xb6, 0x9a, 0xe6, 0x3d,
-  0xf3, 0x77, 0x0f, 0xb8, 0x7f, 0xab, 0xb5, 0xbe, 0xfb, 0x7c, 0xc9, 0x3d,
-  0x08, 0x8a, 0xac, 0x3d, 0x02, 0x56, 0x89, 0xbe, 0x96, 0xfd, 0xb4, 0x3d,
-  0xeb, 0x0e, 0xe5, 0x3d, 0x64, 0xe1, 0x37, 0x3e, 0xcb, 0x66, 0x80, 0x3d,
-  0x65, 0xb3, 0xca, 0xbe, 0x0a, 0xce, 0xa3, 0x3d, 0x4d, 0x02, 0x1b, 0x3e,
-  0xe8, 0x8c, 0xb2, 0xbe, 0x24, 0xd5, 0x9f, 0xbd, 0x7e, 0xd3, 0xd0, 0xbc,
-  0x52, 0x0f, 0xc9, 0xbb, 0x00, 0x58, 0x88, 0xbd, 0xfa, 0x97, 0xc6, 0xbe,
-  0xd5, 0xb6, 0x25, 0x3c, 0x64, 0x85, 0x48, 0x3d, 0x16, 0xff, 0x24, 0xbe,
-  0x2f, 0xe4, 0x57, 0xbe, 0x33, 0x67, 0x91, 0xbe, 0x9e, 0xec, 0x0c, 0xbe,
-  0x04, 0x39, 0x67, 0xbe, 0x4b, 0x03, 0x59, 0xbe, 0xe4, 0x24, 0x7d, 0xbe,
-  0x4b, 0x39, 0x55, 0xbe, 0x35, 0x7f, 0x14, 0x3c, 0x57, 0x75, 0x70, 0xbe,
-  0xf8, 0x12, 0xf8, 0xbd, 0xcb, 0xcd, 0x9e, 0xbd, 0x5e, 0x16, 0x8e, 0xbe,
-  0x86, 0x18, 0x7a, 0xbe, 0xb2, 0xb3, 0xb9, 0xbd, 0x80, 0x64, 0xf5, 0xbd,
-  0xf8, 0xc4, 0xb3, 0xbd, 0xa1, 0x7b, 0x1a, 0xbe, 0x1c, 0x2d, 0x76, 0xba,
-  0x10, 0xb0, 0x36, 0x3d, 0x66, 0x59, 0x19, 0xbd, 0x5c, 0xf9, 0x0e, 0xbe,
-  0xa2, 0x74, 0x29, 0xbc, 0x29, 0x2e, 0xec, 0x3b, 0xc7, 0xdd, 0x22, 0xbe,
-  0x57, 0x7a, 0xf2, 0xbc, 0x24, 0x12, 0xc8, 0x3d, 0x25, 0x02, 0x0a, 0x3d,
-  0xd1, 0x6d, 0x23, 0x3d, 0x1b, 0xb2, 0x54, 0xbd, 0x8f, 0xc4, 0x71, 0x3c,
-  0x47, 0xc6, 0x20, 0xbc, 0x8c, 0xb7, 0xe8, 0xbd, 0x88, 0x47, 0xb2, 0x3c,
-  0x96, 0x92, 0xa6, 0x3d, 0xff, 0x3c, 0x6a, 0x3d, 0x6f, 0x3d, 0x6e, 0xbb,
-  0xeb, 0x83, 0x81, 0xbd, 0x37, 0x97, 0x2a, 0x3d, 0xd3, 0x95, 0xce, 0x3d,
-  0xfe, 0xc2, 0x81, 0xbe, 0x20, 0x53, 0x3a, 0x3d, 0x09, 0x8a, 0x26, 0x3e,
-  0xf9, 0xa6, 0xc5, 0x3d, 0x26, 0x70, 0x5f, 0x3d, 0x28, 0xbd, 0xa0, 0xbd,
-  0xb7, 0xc4, 0x28, 0x3e, 0x7f, 0xdd, 0x08, 0x3e, 0x25, 0xe7, 0x8d, 0xbb,
-  0x02, 0xdd, 0xf7, 0x3d, 0x3b, 0x4a, 0x27, 0x3e, 0x0c, 0x33, 0x1e, 0xbe,
-  0xfb, 0x4a, 0x79, 0x3d, 0x61, 0xea, 0x84, 0x3d, 0xc3, 0x4a, 0xc2, 0xbd,
-  0x5e, 0xb0, 0x96, 0x3b, 0xe5, 0x51, 0x18, 0x3c, 0x8a, 0x08, 0x58, 0xbe,
-  0xf5, 0x84, 0x1b, 0xbe, 0x8b, 0x32, 0x4d, 0xbe, 0x5b, 0x82, 0xf1, 0xbd,
-  0x00, 0x0c, 0x98, 0xbc, 0xf5, 0x32, 0x2c, 0xbe, 0x81, 0x72, 0x2e, 0xbe,
-  0xbb, 0x6e, 0x07, 0xbd, 0xc0, 0x53, 0x0e, 0x3d, 0xc0, 0xc1, 0xfa, 0x3d,
-  0xa5, 0xd6, 0x12, 0x3d, 0xd7, 0x63, 0xf1, 0x3c, 0x7e, 0xc5, 0x1f, 0x3d,
-  0x5d, 0x2b, 0x5c, 0xba, 0xcd, 0xb1, 0x74, 0x3c, 0x8f, 0x36, 0x7d, 0xbe,
-  0xfb, 0x18, 0x4c, 0x3d, 0xc7, 0x26, 0xc8, 0x3d, 0xab, 0xfb, 0x52, 0x3d,
-  0xf8, 0x88, 0xd2, 0xbc, 0xcc, 0x54, 0xe6, 0xbd, 0x2d, 0x35, 0xb1, 0x3c,
-  0xc0, 0xd6, 0xf8, 0xbb, 0x67, 0xc0, 0x81, 0xbe, 0x06, 0x6a, 0xb2, 0x3d,
-  0x6a, 0xb8, 0xbe, 0x3d, 0x3d, 0x2f, 0xe3, 0x3c, 0xff, 0x95, 0x03, 0x3d,
-  0x93, 0xf3, 0x39, 0xbe, 0x16, 0x98, 0xed, 0x3d, 0x31, 0x4a, 0x6c, 0x3d,
-  0x5e, 0x71, 0x70, 0xbe, 0xd6, 0xac, 0xe6, 0x3d, 0x0f, 0x01, 0x0c, 0x3e,
-  0x2b, 0x41, 0x29, 0x3e, 0x64, 0x51, 0x17, 0x3d, 0x66, 0xfa, 0xb4, 0xbe,
-  0x5f, 0x8c, 0xd5, 0x3d, 0x82, 0xc3, 0x0d, 0x3e, 0x34, 0xe9, 0x1e, 0xbe,
-  0x5a, 0xe7, 0x2c, 0x3d, 0x71, 0xdd, 0x53, 0xbd, 0x03, 0x1a, 0xd6, 0xba,
-  0x7b, 0xc7, 0x86, 0xbd, 0x84, 0x1c, 0xd4, 0xbe, 0x77, 0x24, 0x97, 0xbc,
-  0xe2, 0xcf, 0x89, 0x3c, 0x5f, 0x51, 0x04, 0x3e, 0x26, 0x3e, 0x1e, 0xbe,
-  0xf5, 0xc6, 0x4a, 0xbe, 0xfa, 0x75, 0x27, 0xbe, 0x81, 0xcd, 0x39, 0xbe,
-  0x51, 0xea, 0x86, 0xbe, 0xf5, 0xea, 0x5f, 0xbe, 0x50, 0x46, 0x0d, 0xbe,
-  0x96, 0xd0, 0x87, 0x3c, 0xfa, 0x59, 0xf8, 0xbd, 0x9c, 0xca, 0xd9, 0xbd,
-  0xff, 0xe2, 0x63, 0xbc, 0x95, 0xe0, 0xc7, 0xbd, 0x6e, 0x95, 0x37, 0xbe,
-  0x11, 0x43, 0x09, 0xbe, 0x5d, 0x3e, 0xea, 0xbd, 0xd6, 0x40, 0xdc, 0xbc,
-  0xd3, 0xbc, 0xe4, 0xbd, 0xc0, 0x69, 0xe2, 0xba, 0x73, 0x45, 0x9b, 0x3d,
-  0x48, 0x49, 0xb5, 0xbc, 0xaa, 0xff, 0x3b, 0x3d, 0x20, 0x0b, 0x9e, 0x3d,
-  0x40, 0x73, 0x83, 0x3d, 0x74, 0x8a, 0xc7, 0x3c, 0xf0, 0x35, 0xa8, 0xbd,
-  0x1d, 0x9f, 0xc7, 0x3c, 0x01, 0xbb, 0x66, 0x3d, 0xec, 0x38, 0x80, 0x3d,
-  0x6f, 0xe4, 0xad, 0x3d, 0x03, 0x67, 0x8d, 0x3d, 0xfc, 0x64, 0xdb, 0xbc,
-  0x48, 0x57, 0x9b, 0xbd, 0x7b, 0x15, 0x90, 0xbd, 0xc4, 0xca, 0x8d, 0xbc,
-  0x99, 0x75, 0x0f, 0x3d, 0xc7, 0xb8, 0xb4, 0xbc, 0xa8, 0xea, 0xbf, 0xbb,
-  0xb5, 0x8d, 0xab, 0x3c, 0x47, 0x99, 0xb9, 0x3c, 0x6f, 0x65, 0x94, 0xbe,
-  0xca, 0x10, 0xee, 0x3d, 0x88, 0x78, 0xe0, 0x3d, 0x38, 0x45, 0xa4, 0x3c,
-  0x2c, 0x6b, 0x9b, 0x3d, 0x77, 0x0a, 0x30, 0xbd, 0xbd, 0x84, 0x6c, 0x3d,
-  0x76, 0x1f, 0xee, 0x3d, 0x16, 0xac, 0x52, 0x3b, 0xa9, 0xcc, 0x3e, 0xbc,
-  0x40, 0x9d, 0x04, 0x3e, 0xf8, 0xd5, 0xf5, 0xbd, 0xb2, 0xbc, 0x45, 0xbd,
-  0x3c, 0xa5, 0x5c, 0x3d, 0x5d, 0x96, 0xf1, 0xbd, 0x87, 0xb2, 0x30, 0xbc,
-  0xdf, 0x4f, 0xbe, 0x3d, 0x2d, 0x6a, 0x18, 0xbd, 0x70, 0x2d, 0x08, 0xbe,
-  0xb3, 0x56, 0xbc, 0xbd, 0xf5, 0x87, 0x6c, 0xbd, 0x10, 0x07, 0x7c, 0xbc,
-  0x60, 0x26, 0x30, 0xbe, 0xaa, 0x68, 0x8b, 0xbd, 0x9f, 0xed, 0xdd, 0xbc,
-  0xd9, 0xa3, 0x9a, 0xbc, 0xed, 0xa0, 0x8b, 0x3c, 0xc7, 0xca, 0x48, 0x3d,
-  0x76, 0x3f, 0x0b, 0x3c, 0x99, 0x20, 0xb2, 0xbc, 0x75, 0xa7, 0xb4, 0xba,
-  0xd0, 0x90, 0x80, 0x3d, 0xc1, 0x03, 0x76, 0xbe, 0x6b, 0xf9, 0xac, 0xbc,
-  0x90, 0xbc, 0x78, 0x3d, 0x36, 0x14, 0x19, 0x3d, 0x89, 0xda, 0xba, 0xbd,
-  0xc1, 0x9d, 0x92, 0xbd, 0xc1, 0x75, 0x6e, 0x3d, 0x43, 0x81, 0x18, 0x3d,
-  0x31, 0xb4, 0x72, 0xbe, 0x80, 0xd8, 0x9e, 0x3d, 0x86, 0x2d, 0xdf, 0x3d,
-  0xaa, 0x45, 0x74, 0xb9, 0x48, 0xe8, 0x84, 0xbc, 0xb8, 0x4b, 0x47, 0x3c,
-  0xbe, 0xa3, 0x8a, 0x3d, 0x40, 0x6d, 0xb8, 0x3d, 0x11, 0x14, 0x40, 0xbe,
-  0xe8, 0x6c, 0x03, 0x3e, 0x91, 0x72, 0x05, 0x3e, 0x7c, 0x31, 0x26, 0x3e,
-  0x88, 0x57, 0xbe, 0x3d, 0x46, 0x8e, 0x2a, 0xbd, 0x86, 0x54, 0x96, 0x3d,
-  0xf4, 0xe5, 0x9b, 0x3d, 0x01, 0x66, 0x50, 0x3d, 0x5c, 0xe5, 0xc9, 0x3d,
-  0x4a, 0xdb, 0x8e, 0x3d, 0x42, 0xc0, 0xb0, 0x3d, 0xf6, 0x41, 0xa4, 0x3d,
-  0x8d, 0xfc, 0x09, 0xbe, 0xfa, 0x4c, 0xaf, 0x3d, 0xe4, 0x06, 0xca, 0x3d,
-  0x5c, 0xbc, 0x2b, 0x3e, 0x76, 0x60, 0x74, 0x3c, 0xe3, 0xc8, 0x74, 0xbd,
-  0xbc, 0x26, 0xf9, 0x3c, 0xe6, 0x35, 0x8c, 0x3d, 0x3b, 0x93, 0xcd, 0x3d,
-  0x1e, 0x0a, 0x1b, 0xbd, 0xaf, 0x27, 0x98, 0xbd, 0xfe, 0xcf, 0xdc, 0x3d,
-  0xbe, 0x5b, 0x10, 0xbe, 0x2d, 0x97, 0x8f, 0xbd, 0x75, 0xa7, 0x6f, 0xbc,
-  0x3c, 0xeb, 0x0a, 0xbd, 0x4f, 0x7c, 0x12, 0x3e, 0xb2, 0xe8, 0x69, 0x3d,
-  0x6b, 0xde, 0x3f, 0xbd, 0x95, 0x9d, 0x3e, 0x3e, 0xf3, 0x5b, 0x12, 0xbe,
-  0xa9, 0xce, 0xf4, 0x3b, 0x08, 0x9e, 0x2f, 0x39, 0xb3, 0xd6, 0x9c, 0x3d,
-  0x0e, 0x0d, 0x9e, 0x3c, 0x5e, 0x70, 0x85, 0x3c, 0xd5, 0xcd, 0xfc, 0xbd,
-  0x76, 0x03, 0xbd, 0x3d, 0xb1, 0x93, 0xbc, 0xbd, 0xe6, 0x3a, 0xbe, 0xbd,
-  0x11, 0xd9, 0x05, 0x3d, 0x8f, 0x8d, 0x8d, 0xbd, 0x58, 0x83, 0x80, 0xbd,
-  0x80, 0xfa, 0x20, 0x3b, 0x0e, 0x58, 0x0d, 0x3d, 0xed, 0xf4, 0x95, 0xbd,
-  0xcd, 0xd4, 0x25, 0xbd, 0x72, 0x9b, 0x0d, 0x3d, 0x85, 0x77, 0xd9, 0x3b,
-  0x08, 0x7d, 0xdb, 0x3c, 0xfe, 0xd7, 0x9e, 0xbc, 0x65, 0x39, 0x5e, 0x3d,
-  0x16, 0x66, 0x1a, 0x3c, 0xf6, 0x22, 0x35, 0xbd, 0x0c, 0x06, 0xdf, 0xbc,
-  0x55, 0x6c, 0x39, 0x3d, 0xf8, 0xf6, 0x34, 0x3c, 0x24, 0x58, 0x9e, 0x3b,
-  0x9f, 0x24, 0xa9, 0x3d, 0xd6, 0xe1, 0xb5, 0x3c, 0x18, 0x98, 0x71, 0xbd,
-  0xdd, 0xc1, 0x30, 0x3d, 0xfd, 0xd9, 0x45, 0xbd, 0x2f, 0x99, 0x5c, 0xbd,
-  0x14, 0xc6, 0xc5, 0xbd, 0x90, 0x20, 0xa8, 0xbd, 0x44, 0xc3, 0x33, 0x3d,
-  0x3b, 0xff, 0x1d, 0xbe, 0x90, 0xe8, 0x1a, 0xbd, 0xff, 0x2c, 0x20, 0xbc,
-  0xd2, 0xb1, 0x6d, 0xbd, 0xc8, 0x19, 0x17, 0xbb, 0x1c, 0x42, 0x0e, 0x3c,
-  0xe1, 0x68, 0x8f, 0xbd, 0x75, 0xe3, 0xc9, 0x3d, 0xd7, 0xc2, 0x04, 0x3c,
-  0x1a, 0x8b, 0x05, 0xbe, 0x6f, 0x94, 0xda, 0xbd, 0xeb, 0x53, 0x80, 0xbb,
-  0x7c, 0x6f, 0xd3, 0x3d, 0x2c, 0x92, 0xa6, 0x3c, 0xcd, 0x98, 0x93, 0x3d,
-  0xc7, 0x40, 0x98, 0x3d, 0x7e, 0x87, 0x39, 0x3c, 0x4f, 0x13, 0xc8, 0xbc,
-  0x4b, 0x52, 0x59, 0xbe, 0xe2, 0xff, 0x3d, 0x3c, 0x1a, 0x9b, 0x15, 0x3c,
-  0x00, 0x0b, 0x50, 0x3d, 0x8b, 0xfe, 0x85, 0x3c, 0xaf, 0xb0, 0x09, 0xbc,
-  0x34, 0x4b, 0xe3, 0x3c, 0xda, 0xbb, 0x66, 0x3d, 0x11, 0xae, 0x13, 0xbe,
-  0x41, 0x93, 0x0e, 0xbd, 0xf2, 0x03, 0xf4, 0x3c, 0xc9, 0xa2, 0xb0, 0xbc,
-  0x35, 0xb5, 0x5b, 0xbc, 0x89, 0xa6, 0x4e, 0x3d, 0xc2, 0x91, 0x90, 0x3d,
-  0x6f, 0xf9, 0x3a, 0x3c, 0x56, 0x3d, 0x0b, 0xbe, 0xa4, 0xeb, 0x86, 0xba,
-  0x49, 0x7d, 0xa0, 0x3d, 0xbb, 0x2b, 0xd9, 0x3d, 0x22, 0x5d, 0xed, 0x3c,
-  0xaf, 0x5f, 0xab, 0x3b, 0xb5, 0xb1, 0xcc, 0x3d, 0x46, 0x01, 0x9d, 0x3d,
-  0x5f, 0xbc, 0xc4, 0x3d, 0x39, 0xfd, 0x50, 0x3e, 0x04, 0xd1, 0x46, 0x3c,
-  0x0b, 0xa5, 0x85, 0xbc, 0xf3, 0xb3, 0xa4, 0x3d, 0x0f, 0x74, 0x85, 0x3d,
-  0x3c, 0xe4, 0x71, 0x3d, 0x4b, 0x4f, 0xce, 0x3c, 0x6f, 0xd1, 0x6c, 0x3e,
-  0xaf, 0xe9, 0xc8, 0x3d, 0x64, 0x66, 0x9a, 0xbd, 0x37, 0x47, 0x9f, 0xbc,
-  0x2a, 0x5a, 0xc0, 0xbc, 0x86, 0xe4, 0x44, 0x3d, 0xe8, 0xf7, 0xc5, 0xbc,
-  0x13, 0x49, 0xa0, 0x3c, 0x9b, 0x2e, 0x33, 0x3e, 0x34, 0xc1, 0x66, 0xbc,
-  0x1e, 0x11, 0x1c, 0x3c, 0x4a, 0xd1, 0x89, 0xbd, 0xc4, 0xef, 0x6c, 0x3c,
-  0xc3, 0x43, 0x16, 0xbd, 0xdd, 0xda, 0x8c, 0xbd, 0xae, 0x01, 0x14, 0x3c,
-  0x41, 0xc1, 0x06, 0x3e, 0xdd, 0xf3, 0xf8, 0xbd, 0x0e, 0x5d, 0xab, 0xbc,
-  0x00, 0x86, 0x39, 0xbd, 0xae, 0x1d, 0x83, 0x3c, 0xa7, 0xa5, 0x30, 0xbe,
-  0x02, 0x0f, 0xed, 0x3a, 0x6e, 0x4a, 0xb5, 0xbd, 0x4e, 0xa3, 0xe1, 0x3d,
-  0xce, 0x66, 0x28, 0xbe, 0xd3, 0xf4, 0xb8, 0xbc, 0xe8, 0x92, 0x99, 0xbd,
-  0xa2, 0x22, 0x62, 0x3a, 0x6e, 0x7e, 0xcc, 0xbd, 0x26, 0xdb, 0x61, 0xbc,
-  0x44, 0x5a, 0xa0, 0xbc, 0xd2, 0xd5, 0x07, 0x3d, 0x3a, 0xcc, 0xf2, 0xbd,
-  0x3e, 0xce, 0xb1, 0xbd, 0x87, 0xf3, 0x37, 0xbd, 0x9b, 0xf3, 0x56, 0x3b,
-  0xf1, 0xce, 0x28, 0xbd, 0x42, 0xf0, 0x4a, 0x3d, 0xfe, 0x89, 0x5a, 0xbd,
-  0xa8, 0x17, 0xbe, 0x3d, 0x28, 0xbc, 0x12, 0xbd, 0xa2, 0x81, 0xa5, 0xbc,
-  0xca, 0x26, 0xce, 0xbd, 0x94, 0x22, 0x0c, 0xbd, 0x9a, 0x00, 0xea, 0xbb,
-  0x30, 0x33, 0x01, 0xbe, 0x18, 0x0f, 0x0b, 0xbe, 0xe8, 0xc2, 0xe8, 0x3d,
-  0x11, 0xb4, 0x0c, 0xbd, 0xa3, 0x75, 0xfe, 0xbd, 0x43, 0xb4, 0x25, 0x3d,
-  0x3b, 0x4a, 0x11, 0xbe, 0xb9, 0xdc, 0xc1, 0x3d, 0x92, 0xa0, 0x2b, 0xbc,
-  0x52, 0x05, 0xb1, 0xbd, 0x92, 0x33, 0xb3, 0x3c, 0x16, 0x8a, 0xcb, 0xbd,
-  0x90, 0x11, 0x9c, 0xbd, 0xa5, 0x2a, 0x2a, 0xbe, 0x24, 0x9b, 0x25, 0xbe,
-  0xeb, 0x6d, 0xdb, 0xbb, 0x25, 0xdb, 0x84, 0xbd, 0xc8, 0x6b, 0xaf, 0xbd,
-  0xfa, 0x25, 0x08, 0x3e, 0x91, 0x81, 0xc7, 0xbd, 0xc6, 0x8d, 0x47, 0xbc,
-  0xe9, 0x98, 0xb7, 0xbd, 0x72, 0x55, 0xb1, 0xbd, 0x21, 0x56, 0x98, 0x3c,
-  0x2f, 0xfd, 0x39, 0xbc, 0x85, 0xa8, 0xc0, 0xbd, 0xa8, 0xf4, 0xb4, 0xbc,
-  0x4e, 0xba, 0x98, 0xbd, 0x0a, 0xfb, 0xad, 0xbc, 0x1a, 0x89, 0x5f, 0x3d,
-  0xd8, 0x40, 0x40, 0x3d, 0x33, 0xcc, 0xc8, 0x3d, 0x37, 0xf1, 0x67, 0x3c,
-  0x83, 0x43, 0xf6, 0x3c, 0x54, 0xab, 0x37, 0xbe, 0x94, 0xf3, 0x80, 0xbd,
-  0x38, 0xb9, 0x86, 0x3c, 0x09, 0x5b, 0x5e, 0x3d, 0xb6, 0xb0, 0x07, 0x3d,
-  0x9e, 0x8a, 0xb4, 0x3d, 0x19, 0x7a, 0x1d, 0xbd, 0xe8, 0x55, 0x80, 0xbd,
-  0x17, 0xa3, 0x82, 0xbd, 0x69, 0xa3, 0x14, 0x3d, 0xb7, 0xc5, 0x45, 0x3d,
-  0x6b, 0x7d, 0x99, 0x3d, 0xdf, 0x88, 0x00, 0x3e, 0xd5, 0x40, 0x76, 0x3d,
-  0x00, 0x4f, 0x21, 0x3d, 0x25, 0x2a, 0xcb, 0x3d, 0x62, 0x94, 0xc5, 0x3d,
-  0x25, 0xe6, 0xdb, 0x3d, 0x00, 0x3f, 0x39, 0x3d, 0xd0, 0xaa, 0x69, 0xbc,
-  0xd5, 0x5f, 0x1c, 0x3e, 0x4e, 0x55, 0x36, 0x3e, 0x8a, 0xda, 0xb7, 0x3d,
-  0x4e, 0x41, 0x14, 0x3c, 0x43, 0xbd, 0x9e, 0x3e, 0x32, 0x8a, 0x04, 0x3e,
-  0x21, 0xaf, 0xcc, 0x3d, 0x79, 0xc9, 0xe9, 0x3c, 0xc4, 0x93, 0x09, 0x3d,
-  0xaf, 0xd8, 0x18, 0x3d, 0x08, 0xb1, 0x33, 0xbb, 0xad, 0x54, 0xdb, 0x3d,
-  0xcf, 0x4e, 0x9c, 0x3e, 0x14, 0x95, 0x9e, 0xbc, 0x1d, 0x61, 0x86, 0x3c,
-  0x62, 0xf0, 0xad, 0xbd, 0x83, 0x86, 0xb0, 0x3d, 0xc8, 0xf3, 0x30, 0x3d,
-  0x6e, 0xfc, 0xc4, 0x3c, 0xfe, 0x27, 0x8a, 0x3c, 0x64, 0x23, 0x39, 0x3e,
-  0x34, 0x43, 0xf5, 0xbd, 0x74, 0x1f, 0xae, 0xbd, 0x01, 0xe9, 0x81, 0xbd,
-  0x98, 0xb9, 0x2d, 0x3c, 0xe8, 0xee, 0xa0, 0x3d, 0x62, 0xf0, 0xa0, 0xbd,
-  0xbc, 0x26, 0xbb, 0xbd, 0x56, 0x2d, 0xa5, 0x3d, 0x5a, 0x37, 0x04, 0xbe,
-  0x8f, 0xb9, 0xc3, 0xbd, 0xa3, 0xb7, 0x95, 0xbd, 0x7e, 0xe7, 0xa0, 0xbd,
-  0xa4, 0x1d, 0x70, 0xbd, 0xce, 0x5b, 0xc0, 0xbc, 0x9e, 0x70, 0x21, 0xbe,
-  0xd3, 0xa9, 0x8d, 0x3d, 0xd6, 0x7d, 0x14, 0xbe, 0xa8, 0xe1, 0x55, 0xbd,
-  0x94, 0x6d, 0x0a, 0xbe, 0xf5, 0xd9, 0xa9, 0xbd, 0x10, 0x48, 0x8f, 0x3d,
-  0x43, 0xcb, 0xfb, 0xbd, 0x90, 0x6d, 0x1f, 0xbe, 0x72, 0x30, 0x88, 0x3d,
-  0xd8, 0x8f, 0x3e, 0xbe, 0x88, 0xe8, 0x09, 0xbe, 0x56, 0xd6, 0x9f, 0xbd,
-  0xcd, 0x23, 0xf7, 0xbd, 0x4b, 0x3c, 0xb9, 0x3d, 0x9a, 0x51, 0xb3, 0xbd,
-  0xfc, 0x58, 0x0f, 0xbe, 0xae, 0x3c, 0x15, 0x3d, 0x6e, 0x04, 0x02, 0xbe,
-  0x80, 0xae, 0x06, 0xbb, 0xe4, 0x06, 0x2f, 0xbd, 0xeb, 0x57, 0xfd, 0xbd,
-  0xb9, 0x61, 0xef, 0x3d, 0x0d, 0xad, 0x8e, 0xbd, 0x02, 0xb6, 0x13, 0xbe,
-  0xdb, 0x5d, 0xf2, 0x3d, 0x68, 0x38, 0xc0, 0xbb, 0x12, 0x2e, 0xc5, 0xbd,
-  0xe2, 0x63, 0xa9, 0xbc, 0xd7, 0x7c, 0xd3, 0xbc, 0x44, 0x44, 0xdc, 0xbb,
-  0x12, 0x27, 0xc2, 0xbd, 0x0b, 0x3d, 0x7c, 0xbc, 0x8c, 0xd8, 0x74, 0x3d,
-  0x60, 0x09, 0x67, 0x3c, 0xb4, 0x29, 0x13, 0xbd, 0xf1, 0x17, 0xe2, 0xbd,
-  0xd1, 0x4e, 0x99, 0xbc, 0x74, 0xc3, 0x82, 0x3c, 0xb3, 0x2b, 0xf4, 0xbd,
-  0x36, 0x45, 0xd9, 0xbd, 0x3e, 0x3c, 0x92, 0x3d, 0x30, 0x45, 0x2e, 0xbe,
-  0xd1, 0xc5, 0xde, 0xbd, 0x8b, 0x99, 0xc9, 0xbd, 0xc4, 0x92, 0xee, 0xbd,
-  0x95, 0x65, 0x1a, 0xbd, 0xac, 0x16, 0x3e, 0xbd, 0x58, 0xb7, 0xfb, 0xbd,
-  0x09, 0x80, 0x7b, 0xbc, 0x4e, 0xa7, 0x75, 0xbe, 0x70, 0xea, 0x8c, 0xbd,
-  0xb4, 0xc1, 0xfc, 0xbd, 0x88, 0xe0, 0xc1, 0xbd, 0xc8, 0x62, 0x92, 0xbd,
-  0xe1, 0x05, 0x08, 0xbe, 0x8b, 0x89, 0x16, 0xbe, 0x9e, 0x1a, 0xac, 0x3d,
-  0x14, 0x9e, 0xa6, 0xbe, 0x11, 0x16, 0xb9, 0xbd, 0x23, 0x16, 0x7d, 0xbe,
-  0xf1, 0xc0, 0xcb, 0xbd, 0x7b, 0x90, 0x23, 0x3d, 0xba, 0x57, 0x5b, 0xbe,
-  0x33, 0xde, 0x8d, 0xbe, 0xaa, 0xa7, 0x44, 0x3d, 0xe4, 0xcc, 0xa9, 0xbe,
-  0xa3, 0xec, 0x06, 0xbe, 0x38, 0x04, 0x5a, 0xbe, 0xa0, 0xb1, 0x0a, 0xbe,
-  0xc3, 0x45, 0x9d, 0x3d, 0x8a, 0x11, 0xdf, 0xbd, 0x1d, 0x4f, 0x72, 0xbe,
-  0x63, 0x0b, 0xb1, 0x3d, 0x8d, 0x75, 0x98, 0xbe, 0x79, 0x3b, 0xf4, 0xbc,
-  0x48, 0x53, 0x34, 0xbe, 0x7c, 0x4a, 0x00, 0xbe, 0x7a, 0xec, 0x41, 0x3d,
-  0xd8, 0xfb, 0x2e, 0xbe, 0x3f, 0xf0, 0x84, 0xbe, 0xba, 0x9d, 0x07, 0x3e,
-  0x85, 0x54, 0xac, 0xbe, 0x43, 0xa4, 0xf5, 0xbd, 0x81, 0x74, 0x91, 0xbe,
-  0xd5, 0xf8, 0x07, 0xbe, 0xbe, 0x49, 0x84, 0xbc, 0x2c, 0x0e, 0x83, 0xbe,
-  0xcd, 0x94, 0x76, 0xbe, 0x31, 0x57, 0x0a, 0x3e, 0xe8, 0x69, 0x99, 0xbe,
-  0x94, 0xf1, 0x4f, 0xbd, 0x16, 0x19, 0x60, 0xbe, 0x31, 0x54, 0xb6, 0xbd,
-  0x72, 0xd1, 0x4b, 0xbd, 0xa4, 0x62, 0x36, 0xbe, 0xee, 0x8b, 0x5f, 0xbe,
-  0xe4, 0xdc, 0xc5, 0x3d, 0x81, 0xd1, 0x80, 0xbe, 0x62, 0x8b, 0x53, 0xbe,
-  0x15, 0xe8, 0x50, 0xbe, 0x09, 0xb5, 0x8a, 0xbe, 0x37, 0x2a, 0xa4, 0xbd,
-  0x0f, 0xd6, 0xa6, 0xbe, 0x3c, 0xb0, 0xa1, 0xbe, 0xb3, 0x49, 0x9a, 0x3d,
-  0xc0, 0xca, 0x5a, 0xbe, 0xd2, 0x49, 0x4f, 0xbe, 0x1d, 0x28, 0x2d, 0xbe,
-  0xe0, 0x6a, 0x6a, 0xbe, 0x7d, 0x43, 0x3d, 0x3d, 0x07, 0xd2, 0xf7, 0xbd,
-  0xe6, 0x64, 0x4c, 0xbe, 0x19, 0xc7, 0xad, 0x3d, 0x60, 0xdb, 0xf7, 0xbd,
-  0x96, 0x51, 0x61, 0xbe, 0xb5, 0x23, 0x26, 0xbe, 0x67, 0x8f, 0x5b, 0xbe,
-  0x07, 0x38, 0x9b, 0x3d, 0xfd, 0xe1, 0x1f, 0xbe, 0x11, 0x1d, 0x7b, 0xbe,
-  0x74, 0x43, 0x4c, 0x3d, 0xc9, 0xa4, 0x9e, 0xbc, 0x11, 0xe9, 0xed, 0xbc,
-  0x48, 0x72, 0x95, 0xbd, 0x17, 0xcf, 0x2c, 0xbd, 0x27, 0x79, 0x98, 0x3d,
-  0xcd, 0xc4, 0x6d, 0x3d, 0xe6, 0x10, 0xce, 0xbd, 0xde, 0xcd, 0x1f, 0x3e,
-  0x2b, 0xe4, 0xef, 0x3d, 0x33, 0xfe, 0xe5, 0x3d, 0x3b, 0x28, 0x40, 0x3d,
-  0x89, 0xd8, 0x2a, 0x3e, 0xe7, 0xbd, 0x81, 0x3e, 0x07, 0xf1, 0x01, 0x3e,
-  0xa7, 0x63, 0xd2, 0x3d, 0x1f, 0x5f, 0x31, 0x3e, 0x1a, 0x00, 0xf8, 0x3c,
-  0xe4, 0x82, 0x84, 0x3d, 0x83, 0x9f, 0x6c, 0x3a, 0xf8, 0xcd, 0x21, 0x3d,
-  0xd9, 0x8c, 0x90, 0x3e, 0xe4, 0x6e, 0x19, 0x3e, 0x65, 0x16, 0x86, 0x3d,
-  0x97, 0xc8, 0x7f, 0x3e, 0x08, 0x78, 0x0a, 0xbe, 0x2c, 0x49, 0x2f, 0x3d,
-  0xae, 0x14, 0x6d, 0xbd, 0xb5, 0x03, 0x55, 0x3d, 0xd4, 0xd9, 0x49, 0x3e,
-  0xf8, 0x5f, 0x74, 0x3d, 0xcd, 0x2f, 0x96, 0x3d, 0xcd, 0x15, 0xca, 0x3d,
-  0xa1, 0x3a, 0x43, 0xbe, 0x78, 0x91, 0x93, 0xbd, 0xfa, 0x68, 0xfe, 0xbd,
-  0x7a, 0x52, 0x8a, 0x3d, 0x8b, 0x0b, 0x86, 0x3e, 0x48, 0x5b, 0x9e, 0xbd,
-  0xb9, 0xf6, 0x23, 0xbe, 0x8e, 0xbf, 0x74, 0xbc, 0x44, 0x6c, 0x1e, 0xbe,
-  0xa8, 0x0a, 0xef, 0xbd, 0x6d, 0x14, 0x26, 0xbe, 0x31, 0xc8, 0x09, 0x3d,
-  0xa9, 0x6a, 0x3c, 0x3e, 0xcd, 0x9d, 0x91, 0xbd, 0x76, 0xe0, 0x0d, 0xbe,
-  0x8f, 0x6e, 0xbf, 0xbd, 0xab, 0x4f, 0xa0, 0xbd, 0xa7, 0x9e, 0x89, 0xbd,
-  0xd7, 0xec, 0xdd, 0xbd, 0x58, 0x06, 0xa9, 0x3d, 0x8e, 0x16, 0x44, 0x3e,
-  0x6e, 0xe6, 0x9c, 0xbd, 0xb0, 0xe4, 0x83, 0xbc, 0xa5, 0xdd, 0x38, 0xbd,
-  0x8a, 0xfc, 0x0d, 0x3d, 0x83, 0xf6, 0x9d, 0x3d, 0xa3, 0xf5, 0x1a, 0x3b,
-  0xe5, 0xd7, 0x75, 0x3d, 0xe4, 0x05, 0x35, 0x3e, 0x83, 0xad, 0xbe, 0x3d,
-  0xe4, 0xf9, 0x74, 0x3d, 0x29, 0xe6, 0x26, 0x3c, 0x5a, 0x2c, 0xc9, 0xbb,
-  0xb3, 0x46, 0x77, 0xbd, 0xdd, 0x99, 0xc9, 0x3c, 0x93, 0xfc, 0x2c, 0x3d,
-  0x84, 0xfe, 0x4f, 0x3e, 0xd0, 0xc7, 0x12, 0x3e, 0x9b, 0xe7, 0xfa, 0x3d,
-  0x91, 0x85, 0xdd, 0xbd, 0xf2, 0xaf, 0xe0, 0xbd, 0x51, 0x44, 0x9f, 0xbd,
-  0x24, 0x24, 0x52, 0xbc, 0xa5, 0xff, 0x8e, 0x3d, 0x5b, 0x95, 0x79, 0x3e,
-  0x96, 0x85, 0xb0, 0x3d, 0x32, 0x83, 0x8d, 0xbd, 0x2f, 0xec, 0x29, 0xbd,
-  0xee, 0xb6, 0x1e, 0xbe, 0x50, 0x1b, 0xb7, 0xbd, 0xbb, 0x6a, 0x9e, 0xbd,
-  0x49, 0x8f, 0x76, 0x3c, 0xca, 0xdc, 0x7e, 0x3e, 0xc0, 0x6b, 0xf7, 0xbd,
-  0x5f, 0x5f, 0x3f, 0xbc, 0xb0, 0x44, 0xb9, 0xbc, 0xfc, 0xf5, 0x9d, 0xbd,
-  0x8a, 0xb3, 0x05, 0xbe, 0xd7, 0x8a, 0x09, 0xbe, 0x4e, 0x5f, 0xe0, 0xbc,
-  0xbf, 0xac, 0x88, 0x3e, 0x17, 0x17, 0x14, 0xbe, 0x1b, 0x4f, 0xd6, 0xbd,
-  0x01, 0x44, 0x3a, 0x3e, 0x28, 0xe3, 0xcf, 0xbd, 0x80, 0x8c, 0xcb, 0xbd,
-  0x40, 0xbb, 0xce, 0xbd, 0x97, 0xc7, 0x2e, 0xbd, 0xee, 0xa7, 0x3a, 0x3e,
-  0x08, 0x0b, 0x32, 0xbd, 0x00, 0x04, 0x99, 0xbd, 0xc4, 0x4c, 0x7a, 0x3e,
-  0x6f, 0xca, 0x90, 0xbc, 0x9e, 0x22, 0x1c, 0xbe, 0x97, 0xd9, 0xb2, 0xbd,
-  0x61, 0xdc, 0xd1, 0x3d, 0x1f, 0x0b, 0x4b, 0x3e, 0xf1, 0xf6, 0x65, 0x3d,
-  0x58, 0xde, 0xd8, 0xbc, 0xb4, 0x83, 0x26, 0x3e, 0x27, 0x02, 0x09, 0x3e,
-  0x8e, 0x75, 0xbd, 0x3d, 0xb7, 0x9c, 0xcf, 0x3d, 0x9a, 0xe8, 0x0e, 0x3e,
-  0x08, 0x2a, 0x7f, 0x3e, 0xce, 0xbe, 0x0b, 0x3e, 0xbe, 0x22, 0xea, 0x3d,
-  0xbb, 0xe6, 0x64, 0x3e, 0x19, 0x0d, 0xe2, 0x3d, 0x7e, 0x7b, 0x0d, 0x3d,
-  0x56, 0xe7, 0x4e, 0x3d, 0xcf, 0x47, 0xcf, 0x3d, 0x0a, 0x91, 0x36, 0x3e,
-  0x18, 0x0a, 0x9b, 0x3d, 0x40, 0x51, 0xec, 0x3d, 0xfd, 0xeb, 0x32, 0x3e,
-  0x5e, 0xec, 0x27, 0xbd, 0xd8, 0x1a, 0x4c, 0x3d, 0xb5, 0xdc, 0xfe, 0xbc,
-  0x8b, 0xf1, 0x4c, 0x3b, 0xcb, 0x4f, 0x71, 0x3e, 0x3e, 0xd1, 0x9e, 0xbd,
-  0xb0, 0x28, 0x9c, 0xba, 0x7a, 0x49, 0xa0, 0xbc, 0x7c, 0x1b, 0x31, 0xbd,
-  0xc6, 0x55, 0x82, 0xbc, 0xd2, 0x3a, 0xa1, 0xbd, 0x28, 0x7c, 0x91, 0xbd,
-  0x73, 0x6b, 0x20, 0x3e, 0xb7, 0x9d, 0x5c, 0xbd, 0xed, 0xba, 0xd6, 0xbd,
-  0x9f, 0x50, 0xbf, 0xbc, 0x52, 0x84, 0x7f, 0xbd, 0x21, 0xce, 0xec, 0xbd,
-  0xfd, 0xb5, 0xa6, 0xbd, 0x9c, 0xe4, 0x23, 0xbe, 0xba, 0xf9, 0x0f, 0x3e,
-  0xda, 0x36, 0x3e, 0xbe, 0xf6, 0xfb, 0xe5, 0x3b, 0x9d, 0xd0, 0x1e, 0xbd,
-  0x9e, 0x7a, 0xae, 0x3c, 0x81, 0x2e, 0x04, 0xbe, 0xf0, 0xb9, 0xd3, 0xbd,
-  0x91, 0x2e, 0x46, 0xbe, 0xf4, 0x3c, 0x96, 0x3d, 0x89, 0x04, 0x89, 0xbd,
-  0xa6, 0xd0, 0xb8, 0x3c, 0x1d, 0x97, 0x22, 0x3d, 0xf9, 0x06, 0x46, 0x3d,
-  0x67, 0x28, 0xaa, 0x3d, 0x9a, 0x21, 0xc9, 0x3c, 0x71, 0x63, 0x79, 0xbe,
-  0xa8, 0x1f, 0xb5, 0x3c, 0x99, 0x31, 0x43, 0x3d, 0xa1, 0x8c, 0x8c, 0x3d,
-  0x4c, 0xa9, 0x92, 0xbd, 0x9a, 0xaa, 0x7f, 0xbd, 0x2f, 0x34, 0x1b, 0x3d,
-  0xbe, 0xb8, 0x8d, 0x3d, 0x73, 0xc1, 0xa2, 0xbd, 0x96, 0x64, 0x2d, 0x3e,
-  0xae, 0x5a, 0x3e, 0x3c, 0x66, 0xc8, 0x8d, 0x3d, 0xb6, 0xe8, 0x4f, 0x3d,
-  0x3c, 0x44, 0x5d, 0x3b, 0x3b, 0x83, 0xd9, 0x3c, 0x19, 0xc6, 0xb6, 0xbc,
-  0x48, 0xaa, 0xee, 0xbc, 0x17, 0x05, 0x62, 0x3e, 0x33, 0xf9, 0x6e, 0xbd,
-  0x48, 0x56, 0x27, 0x3c, 0x0a, 0x5d, 0x10, 0x3e, 0xbf, 0x08, 0x89, 0x3d,
-  0xa7, 0xcf, 0xad, 0xbd, 0xf5, 0x82, 0x7c, 0x3d, 0x83, 0xff, 0x9c, 0xbd,
-  0x16, 0x80, 0x41, 0x3e, 0xac, 0xb2, 0x50, 0x3d, 0xda, 0x01, 0x7e, 0x3d,
-  0xa4, 0x01, 0x75, 0x3d, 0xbb, 0x73, 0x9b, 0x3c, 0xd4, 0xb6, 0x17, 0xbd,
-  0xae, 0x4d, 0x97, 0x3c, 0x05, 0xcd, 0x8f, 0xbd, 0xd1, 0xc4, 0x51, 0x3e,
-  0x31, 0x08, 0xb0, 0x3c, 0x7b, 0xcf, 0x1c, 0xbd, 0x56, 0x62, 0x48, 0xbc,
-  0x00, 0x35, 0x70, 0xbb, 0x53, 0x80, 0x05, 0xbe, 0x19, 0xd4, 0x07, 0xbd,
-  0xb2, 0x26, 0x37, 0xbd, 0x27, 0xa6, 0x48, 0x3e, 0x10, 0xad, 0x45, 0xbd,
-  0x67, 0x1f, 0xa1, 0xbc, 0x23, 0x43, 0xb7, 0x3c, 0xe4, 0x87, 0x4b, 0xbe,
-  0x23, 0x7f, 0x0f, 0xbe, 0xca, 0xde, 0x6b, 0xbd, 0x49, 0x50, 0x15, 0xbe,
-  0x4b, 0xab, 0x44, 0x3e, 0xa3, 0x2b, 0xc0, 0xbd, 0x12, 0x86, 0x44, 0xbe,
-  0xf4, 0x32, 0x74, 0x3e, 0xb2, 0xaf, 0x8e, 0xbd, 0x98, 0x94, 0xcf, 0x3b,
-  0x95, 0x48, 0x85, 0xbc, 0xce, 0x9e, 0x13, 0x3e, 0xa9, 0xa2, 0x27, 0x3e,
-  0x9a, 0x9d, 0x86, 0x3d, 0xc0, 0xa2, 0xeb, 0x3c, 0x33, 0x18, 0x22, 0x3e,
-  0xa3, 0xd0, 0x50, 0x3d, 0xdb, 0xcd, 0xe6, 0x3d, 0xd9, 0xe5, 0xea, 0x3d,
-  0xcc, 0x47, 0x89, 0x3d, 0x40, 0x3f, 0x3d, 0x3e, 0xb7, 0x2a, 0xac, 0x3d,
-  0xe9, 0x9c, 0xe4, 0x3d, 0x30, 0x09, 0x44, 0x3c, 0x86, 0x84, 0x97, 0xbc,
-  0x34, 0x54, 0xf5, 0xbc, 0x38, 0xb3, 0xca, 0xbd, 0xb0, 0x10, 0xd7, 0xbc,
-  0xa6, 0xc9, 0x81, 0x3e, 0x51, 0x09, 0x33, 0xbd, 0x28, 0xea, 0xde, 0xbd,
-  0xc0, 0xc6, 0x73, 0xbd, 0x4d, 0xf6, 0xf3, 0xbd, 0xc3, 0x42, 0xdf, 0xbd,
-  0x34, 0xf8, 0x08, 0xbe, 0x18, 0x43, 0x03, 0xbe, 0xcb, 0x1c, 0x32, 0x3e,
-  0xa5, 0xad, 0x26, 0xbe, 0x62, 0x44, 0x0c, 0xbe, 0xf9, 0x19, 0xd8, 0xbd,
-  0xa3, 0x97, 0xc0, 0xbd, 0x74, 0xe8, 0x0c, 0xbe, 0xfa, 0xfe, 0x3b, 0xbd,
-  0xa7, 0x9a, 0x4e, 0xbe, 0xdb, 0xd4, 0xb8, 0xbd, 0x7a, 0xa1, 0x66, 0xbd,
-  0x24, 0x5c, 0x40, 0xbd, 0x89, 0xdc, 0x55, 0xbe, 0xd9, 0xa8, 0x25, 0xbc,
-  0x4f, 0xd9, 0x90, 0xbd, 0x7c, 0xc7, 0xa6, 0xbd, 0x45, 0x09, 0x47, 0xbe,
-  0x54, 0x29, 0x56, 0xbe, 0xa8, 0x54, 0xdb, 0xbd, 0x34, 0xb2, 0x8b, 0xbd,
-  0x99, 0xcb, 0x92, 0xbe, 0x28, 0x3c, 0xbf, 0xbd, 0xff, 0xae, 0x51, 0x3c,
-  0xe5, 0x36, 0xb4, 0xbc, 0x25, 0xf4, 0x54, 0xbe, 0x6d, 0xec, 0xa3, 0xbe,
-  0x85, 0x33, 0x0a, 0xbc, 0x8a, 0x66, 0x10, 0x3c, 0x5a, 0x4f, 0x92, 0xbe,
-  0xc3, 0x23, 0x02, 0xbe, 0x53, 0xff, 0x77, 0xbc, 0x86, 0xfb, 0x86, 0x3c,
-  0x40, 0xdc, 0x77, 0xbe, 0xd7, 0xc7, 0x7f, 0xbe, 0x91, 0xbc, 0xc2, 0xbc,
-  0x40, 0x98, 0x80, 0xbd, 0x6b, 0x79, 0x1f, 0xbe, 0xba, 0xd4, 0x08, 0xbe,
-  0xb8, 0x89, 0x61, 0x3c, 0x46, 0x7b, 0x51, 0x3b, 0x1e, 0xab, 0x51, 0xbe,
-  0xa8, 0x6f, 0x07, 0xbe, 0x3c, 0xa2, 0x63, 0xbd, 0x80, 0x42, 0xed, 0xbd,
-  0x89, 0x72, 0x04, 0xbe, 0x76, 0xb5, 0xed, 0xbc, 0xc9, 0x97, 0x77, 0x3d,
-  0x6a, 0xeb, 0x98, 0x3d, 0xa2, 0x0c, 0x30, 0xbd, 0x96, 0xb9, 0xc8, 0xbd,
-  0x5f, 0xb7, 0x80, 0x3d, 0xbd, 0x04, 0x13, 0x3b, 0x98, 0xe2, 0x40, 0xbc,
-  0xd6, 0xb1, 0x53, 0xbc, 0xfa, 0x8d, 0xb6, 0x3d, 0x86, 0x7c, 0x1d, 0x3d,
-  0x5e, 0x7c, 0x07, 0x3d, 0x90, 0xf4, 0xf1, 0x3c, 0xd4, 0x09, 0x92, 0xbc,
-  0xa6, 0x7e, 0x8a, 0x3c, 0xc1, 0xfe, 0x2f, 0x3d, 0xa6, 0xfd, 0x30, 0xbd,
-  0x0e, 0xd8, 0xdd, 0x3b, 0x11, 0x5b, 0xc1, 0xbd, 0x69, 0x1e, 0xca, 0xbc,
-  0xc0, 0x09, 0x08, 0x3e, 0x8b, 0xa3, 0x3c, 0x3b, 0x35, 0x74, 0x03, 0xbe,
-  0x0e, 0xd0, 0xc9, 0x3d, 0xef, 0xc9, 0x08, 0xbe, 0x08, 0x06, 0xd1, 0xbd,
-  0x14, 0xaf, 0x4c, 0xbe, 0x02, 0x9b, 0xb7, 0xbd, 0xa8, 0x90, 0x62, 0x3e,
-  0xb0, 0xd1, 0x12, 0xbe, 0xd6, 0x6e, 0x13, 0xbe, 0xfb, 0x8c, 0x7a, 0x3e,
-  0xb0, 0x70, 0x0d, 0xbe, 0xd2, 0xdc, 0x08, 0x3d, 0xd0, 0x05, 0x8c, 0xbd,
-  0x3f, 0x3c, 0x49, 0xbc, 0x40, 0xe9, 0x4f, 0x3e, 0x48, 0x35, 0x23, 0xbd,
-  0x7a, 0x65, 0xab, 0x3c, 0x24, 0x0f, 0x03, 0x3e, 0xa4, 0xdc, 0x8e, 0xbd,
-  0x6e, 0xdd, 0xe9, 0x3c, 0x7b, 0x7e, 0x2a, 0x3d, 0x9e, 0x9c, 0x7f, 0x3d,
-  0xa8, 0xbf, 0x48, 0x3e, 0x4a, 0x6c, 0xff, 0x3c, 0xdd, 0x2d, 0xd2, 0xbc,
-  0x5e, 0xd9, 0xba, 0x3d, 0xfc, 0x38, 0x37, 0xbd, 0xe7, 0x8f, 0x71, 0xbc,
-  0x33, 0xe7, 0x81, 0xbd, 0x65, 0xea, 0x67, 0xbd, 0xb8, 0x53, 0x35, 0x3e,
-  0x32, 0xaa, 0xee, 0xbd, 0x2c, 0x8f, 0x4a, 0xbd, 0x22, 0x19, 0x48, 0xbd,
-  0x72, 0x7e, 0xcf, 0xbd, 0x4e, 0x6f, 0xdc, 0xbd, 0xa2, 0x2c, 0xa7, 0xbd,
-  0x01, 0x23, 0x58, 0xbe, 0x97, 0x10, 0x83, 0x3d, 0xcb, 0xd1, 0xb8, 0xbd,
-  0xf2, 0x47, 0x18, 0xbe, 0x78, 0x73, 0x1c, 0xbe, 0x99, 0x3c, 0xd1, 0xbd,
-  0x77, 0xa3, 0x5e, 0xbd, 0xea, 0xd5, 0x4e, 0xbd, 0xe7, 0x51, 0xc8, 0xbd,
-  0xbf, 0xb2, 0x96, 0x3d, 0x9f, 0x3c, 0xd5, 0xbd, 0x83, 0xff, 0x74, 0xbd,
-  0xec, 0x51, 0xb3, 0xbe, 0x99, 0x99, 0x37, 0xbd, 0x7e, 0xa9, 0xe9, 0xbd,
-  0xfe, 0x7d, 0x82, 0xbc, 0x31, 0xc9, 0x48, 0xbe, 0x3a, 0xc4, 0x5d, 0xbe,
-  0xe5, 0x40, 0xba, 0xbd, 0xa7, 0xd9, 0xa0, 0xbd, 0xbc, 0x33, 0xbf, 0xbe,
-  0x73, 0xf1, 0xbf, 0x3b, 0x88, 0xd2, 0x24, 0xbc, 0xcc, 0x75, 0xf1, 0xbc,
-  0x23, 0x63, 0x77, 0xbe, 0x3c, 0x40, 0xd9, 0xbe, 0x77, 0x69, 0x46, 0xbc,
-  0x9d, 0x3d, 0x90, 0xbc, 0x3e, 0x01, 0x27, 0xbe, 0x09, 0x84, 0x85, 0xbd,
-  0x08, 0xa3, 0xb7, 0x3c, 0xf8, 0xb5, 0x3d, 0xbd, 0x87, 0x51, 0xa5, 0xbe,
-  0x1d, 0x78, 0x08, 0xbf, 0x43, 0x06, 0x44, 0xbd, 0x9c, 0x38, 0xce, 0xbd,
-  0xb5, 0xa8, 0x33, 0xbe, 0x6e, 0x80, 0x33, 0xbe, 0xb9, 0xa4, 0x8a, 0xbd,
-  0xe9, 0x74, 0xeb, 0xbc, 0x4b, 0x5a, 0x40, 0xbe, 0x0d, 0xab, 0xb9, 0xbe,
-  0xe5, 0xa4, 0x34, 0xbc, 0x9d, 0xf1, 0x89, 0xbd, 0xe8, 0x60, 0x05, 0xbe,
-  0x8a, 0x9b, 0xa0, 0xbd, 0x0c, 0x1b, 0xee, 0x3c, 0x12, 0x27, 0xd7, 0xba,
-  0x00, 0xfd, 0xe0, 0xbd, 0xf3, 0xe1, 0x3f, 0xbe, 0x12, 0xde, 0x16, 0xbc,
-  0x2e, 0xb2, 0x97, 0xbc, 0xfa, 0x4f, 0x34, 0xbe, 0x8e, 0x82, 0xef, 0xbb,
-  0x80, 0xf2, 0x80, 0xbd, 0xe6, 0x92, 0x2f, 0xbd, 0x76, 0xb4, 0xae, 0xbd,
-  0x79, 0x78, 0xef, 0xbc, 0xb0, 0x38, 0x22, 0xbd, 0x39, 0x79, 0x82, 0xbd,
-  0x2d, 0x05, 0x07, 0xbe, 0x56, 0x50, 0x03, 0xbe, 0x99, 0xc5, 0x45, 0xbd,
-  0xa1, 0xce, 0x2c, 0xbe, 0xde, 0xa3, 0x0a, 0xbe, 0xed, 0xf8, 0x8f, 0x3c,
-  0x21, 0xf1, 0x07, 0xbe, 0x5c, 0x95, 0x18, 0xbe, 0xeb, 0x28, 0x59, 0x3d,
-  0xe5, 0x48, 0x9f, 0xbe, 0xa8, 0x8c, 0x59, 0xbe, 0x5a, 0x9a, 0x9a, 0xbe,
-  0x83, 0xa0, 0x8d, 0xbe, 0x33, 0x13, 0x22, 0x3e, 0x95, 0x50, 0xb4, 0xbe,
-  0xde, 0x4c, 0x77, 0xbe, 0x4a, 0x1c, 0x54, 0x3e, 0x7e, 0x7e, 0xa2, 0x3c,
-  0xad, 0xad, 0x1a, 0xbd, 0xd8, 0x6a, 0x8e, 0xbd, 0xad, 0xfc, 0x97, 0x3b,
-  0xb7, 0xe9, 0x32, 0x3e, 0xa4, 0xe2, 0xf9, 0xbd, 0xbc, 0xc6, 0x69, 0xbd,
-  0x54, 0xc4, 0xc7, 0x3d, 0x86, 0x9d, 0x28, 0xbe, 0x87, 0xdb, 0x05, 0xbe,
-  0xaa, 0xba, 0xec, 0xbd, 0xa0, 0x64, 0x26, 0xbe, 0xff, 0x0b, 0x57, 0x3e,
-  0x45, 0x01, 0x36, 0xbe, 0x20, 0x5c, 0x29, 0xbe, 0xdc, 0x17, 0x21, 0xbd,
-  0xbd, 0xb3, 0x7a, 0xbd, 0x3d, 0x57, 0xf2, 0xbd, 0x04, 0x57, 0x6f, 0xbd,
-  0x25, 0x38, 0xe5, 0xba, 0x2f, 0x4b, 0x3d, 0x3e, 0xcd, 0x44, 0x2e, 0xbd,
-  0xb8, 0xb9, 0xf0, 0xbd, 0xb1, 0x5f, 0x8e, 0xbb, 0xba, 0xfd, 0xde, 0xbd,
-  0x88, 0xf6, 0xae, 0x3a, 0xc7, 0x08, 0xa6, 0xbd, 0x1c, 0xb4, 0xaa, 0x38,
-  0x3e, 0x9e, 0x17, 0x3e, 0xb6, 0xac, 0x31, 0xbd, 0xe3, 0x37, 0xce, 0xbc,
-  0xc3, 0x19, 0xb1, 0xbc, 0x7b, 0xd7, 0xe1, 0xbd, 0x80, 0x16, 0xf3, 0xbd,
-  0x14, 0x4e, 0xa8, 0xbd, 0x53, 0x99, 0x26, 0x3c, 0xad, 0x45, 0x2f, 0x3e,
-  0xf9, 0x69, 0xd3, 0xbd, 0x88, 0xcb, 0x3e, 0x3c, 0xd3, 0x5e, 0x80, 0xbe,
-  0x08, 0x1e, 0x59, 0x3d, 0x57, 0x6f, 0x47, 0xbd, 0xe5, 0x55, 0xd8, 0xbd,
-  0xc2, 0xf8, 0x60, 0xbd, 0xc3, 0x8b, 0xd6, 0xbc, 0xdc, 0xa9, 0xdb, 0x3b,
-  0x1d, 0x58, 0x48, 0xbd, 0x1a, 0xcc, 0xb3, 0xbd, 0x85, 0x5e, 0xf6, 0x3d,
-  0xd5, 0xff, 0x38, 0x3d, 0x79, 0xb1, 0xa4, 0x3d, 0xb6, 0x21, 0xde, 0xbd,
-  0xac, 0x43, 0x7d, 0xbe, 0x51, 0x04, 0x9f, 0x3d, 0x27, 0x3d, 0x24, 0x3e,
-  0xf4, 0xea, 0x05, 0xbe, 0xb0, 0x80, 0x2b, 0x3e, 0x4d, 0x47, 0xe2, 0x3d,
-  0xa7, 0xa5, 0x2a, 0x3d, 0xdb, 0x0e, 0xb9, 0xbd, 0xe6, 0xf9, 0xd3, 0xbe,
-  0xf5, 0xa4, 0xb5, 0x3d, 0x0b, 0xa9, 0x14, 0x3d, 0x25, 0xa8, 0x99, 0xbe,
-  0xe6, 0x0e, 0x02, 0xbd, 0xea, 0x5c, 0xb7, 0xbc, 0x02, 0xbf, 0xe5, 0xbd,
-  0x74, 0x35, 0xdb, 0xbd, 0xff, 0x0e, 0xa1, 0xbe, 0x45, 0xf7, 0x99, 0xbd,
-  0xd0, 0xd0, 0x00, 0xbe, 0xf5, 0x67, 0x92, 0xbe, 0xb5, 0xaf, 0x87, 0xbd,
-  0x50, 0x72, 0x0f, 0xbc, 0xd1, 0x76, 0x9d, 0xbc, 0xa5, 0xb7, 0x2c, 0xbd,
-  0x18, 0x57, 0xfc, 0xbd, 0xdb, 0xa6, 0x08, 0xbe, 0xa0, 0xe6, 0xe4, 0xbd,
-  0xdc, 0x98, 0x29, 0x3d, 0xee, 0xbb, 0xa5, 0xbd, 0xce, 0x76, 0xdf, 0xbd,
-  0x70, 0xef, 0xe5, 0xbd, 0xe3, 0x2d, 0xac, 0xbd, 0x7c, 0xbf, 0x6b, 0x3d,
-  0x18, 0x26, 0x94, 0xbd, 0x70, 0xfc, 0x68, 0xbd, 0xde, 0xf2, 0xde, 0x3d,
-  0xf1, 0x3b, 0x38, 0xbe, 0x7d, 0x24, 0xd9, 0xbd, 0xec, 0x77, 0x12, 0xbe,
-  0x37, 0x6b, 0x49, 0xbe, 0xe0, 0xe9, 0x0c, 0x3e, 0x2b, 0xa4, 0x77, 0xbe,
-  0x5d, 0x78, 0x20, 0xbe, 0xd7, 0xcd, 0x23, 0x3e, 0xc7, 0x83, 0x33, 0xbe,
-  0xef, 0x88, 0x5b, 0xbe, 0x75, 0x1b, 0x41, 0xbe, 0x48, 0x73, 0x89, 0xbe,
-  0xde, 0x68, 0x54, 0x3e, 0xdd, 0x3e, 0x81, 0xbe, 0x7b, 0x4d, 0x6a, 0xbe,
-  0x05, 0xb2, 0x74, 0x3e, 0x69, 0x62, 0x25, 0x3d, 0xa5, 0x76, 0xdd, 0xbd,
-  0xae, 0x71, 0xfb, 0xbd, 0x72, 0x25, 0xd9, 0xbc, 0x8a, 0x53, 0x8c, 0x3e,
-  0xe6, 0xf1, 0xae, 0x3b, 0xb1, 0x6b, 0xcb, 0xbd, 0xe7, 0x8f, 0x32, 0x3e,
-  0x76, 0xe6, 0x89, 0xbd, 0xb7, 0x32, 0x44, 0xbe, 0xa1, 0xd3, 0x04, 0xbe,
-  0x28, 0x26, 0x6c, 0xbe, 0x7f, 0x72, 0x2c, 0x3e, 0x0d, 0x26, 0x32, 0xbe,
-  0x7d, 0x93, 0x07, 0xbe, 0x6e, 0x7a, 0xd3, 0x3d, 0xa7, 0x62, 0xe7, 0xbd,
-  0xc4, 0x1f, 0x16, 0xbe, 0xa1, 0x0f, 0x44, 0xbd, 0x7b, 0x46, 0xee, 0xbd,
-  0x6f, 0x6a, 0x3e, 0x3e, 0x0c, 0x6b, 0x25, 0xbe, 0x50, 0x42, 0x16, 0xbe,
-  0x25, 0x3b, 0x29, 0x3e, 0xd5, 0x31, 0x02, 0xbe, 0xac, 0x2e, 0x84, 0xbc,
-  0x77, 0x35, 0xcd, 0xbd, 0xc9, 0x82, 0xee, 0xbd, 0x8c, 0xc0, 0x96, 0x3d,
-  0xdb, 0xee, 0x0d, 0xbe, 0x6f, 0x14, 0xa8, 0xbd, 0xd4, 0x83, 0xd2, 0xbd,
-  0x9a, 0x13, 0x31, 0xbe, 0x9f, 0x66, 0xe1, 0xbd, 0x95, 0x7d, 0x46, 0xbd,
-  0xd2, 0xc6, 0x86, 0x3d, 0xb4, 0x33, 0x7b, 0x3e, 0x63, 0x4c, 0xed, 0xbc,
-  0x0b, 0x0a, 0x82, 0xbd, 0xe0, 0x2b, 0x77, 0xbe, 0x62, 0xff, 0xe0, 0xbd,
-  0x8b, 0x69, 0x50, 0xbd, 0x43, 0x2f, 0xc5, 0xbd, 0x56, 0x08, 0xa0, 0xbd,
-  0x05, 0x98, 0x5c, 0x3e, 0x94, 0x84, 0xac, 0xbd, 0x85, 0xc3, 0x61, 0xbd,
-  0x7e, 0xb9, 0x87, 0xbd, 0x1d, 0xc7, 0x0d, 0x3e, 0xed, 0x45, 0x2d, 0x3e,
-  0xb6, 0xab, 0x0f, 0x3e, 0x59, 0x46, 0xb6, 0xbc, 0xd5, 0x1a, 0xaa, 0xbd,
-  0x72, 0xa6, 0x14, 0x3e, 0x20, 0x4d, 0x17, 0x3e, 0x70, 0x79, 0xfe, 0xbe,
-  0x2e, 0x4f, 0x25, 0x3e, 0x7b, 0xde, 0xaa, 0x3d, 0xe2, 0x53, 0xc0, 0x3a,
-  0x1e, 0x1b, 0xda, 0xbc, 0x1f, 0x08, 0x10, 0xbf, 0x55, 0xf8, 0x93, 0x3d,
-  0x6d, 0xd1, 0x1e, 0x3e, 0x8d, 0x25, 0xff, 0xbe, 0x53, 0x18, 0xdc, 0xbd,
-  0xbc, 0x64, 0xc1, 0xbc, 0xba, 0xc9, 0x9b, 0xbd, 0xc1, 0xac, 0xa5, 0xbd,
-  0x20, 0x37, 0x90, 0xbe, 0xb2, 0x07, 0xa6, 0xbd, 0x7e, 0x25, 0x6e, 0xbd,
-  0xe9, 0x87, 0xc8, 0xbd, 0x6c, 0xe3, 0xe9, 0xbd, 0x90, 0x36, 0xdd, 0xbb,
-  0x03, 0x92, 0x0d, 0xbd, 0xa7, 0xe0, 0x17, 0xbc, 0x2b, 0x99, 0xcf, 0x3d,
-  0xee, 0x54, 0x59, 0xbd, 0x6f, 0x54, 0xc8, 0xbd, 0xbf, 0x39, 0x97, 0x3d,
-  0xac, 0x18, 0xe7, 0x3a, 0xf8, 0xa7, 0xf5, 0xba, 0x35, 0x6d, 0x94, 0xbd,
-  0xec, 0xc2, 0x53, 0xbc, 0x80, 0x1c, 0x39, 0x3e, 0x3f, 0x89, 0xc8, 0xbd,
-  0xd2, 0xb0, 0x29, 0xbc, 0x15, 0x59, 0x80, 0x3d, 0x68, 0x9c, 0x3e, 0xbe,
-  0x56, 0x33, 0x58, 0xbe, 0x2b, 0x44, 0x01, 0xbe, 0xf6, 0x9e, 0x14, 0xbe,
-  0x9f, 0x05, 0x0c, 0x3e, 0xd5, 0x50, 0x05, 0xbe, 0x1b, 0xaf, 0xfd, 0xbd,
-  0xb1, 0xe8, 0x01, 0x3e, 0x6d, 0xb1, 0x71, 0xbe, 0x6b, 0x32, 0x68, 0xbe,
-  0x1c, 0xdc, 0x1e, 0xbe, 0x57, 0xb1, 0x78, 0xbe, 0x8b, 0xdc, 0x1f, 0x3e,
-  0xf2, 0x32, 0xb2, 0xbd, 0xc1, 0x5b, 0x5e, 0xbe, 0x62, 0x4f, 0x28, 0x3e,
-  0x50, 0x4e, 0xfd, 0x3c, 0xc9, 0xbe, 0x9b, 0x3d, 0x29, 0x85, 0xdb, 0x3d,
-  0xd0, 0x0b, 0x00, 0x3c, 0xa7, 0x62, 0x22, 0x3e, 0xc1, 0x42, 0xa6, 0x3d,
-  0x48, 0x28, 0x25, 0x3d, 0x38, 0xc4, 0xf1, 0x3d, 0xec, 0x2f, 0x24, 0xbc,
-  0x07, 0x8a, 0xa4, 0xbd, 0x4d, 0x04, 0x68, 0xbd, 0x2f, 0xc5, 0x98, 0xbc,
-  0x97, 0x83, 0x0f, 0x3e, 0xc6, 0x8f, 0xcd, 0xbd, 0x1b, 0xfe, 0x0d, 0x3d,
-  0xd7, 0x0d, 0x02, 0x3e, 0xda, 0xf5, 0x98, 0xbd, 0x60, 0x87, 0xdf, 0xbd,
-  0x4a, 0x56, 0x0a, 0xbe, 0x5d, 0x3a, 0x58, 0xbd, 0x4f, 0xe0, 0x45, 0x3e,
-  0x47, 0x58, 0x93, 0xbd, 0x5c, 0xc8, 0xd2, 0xbc, 0x17, 0xc7, 0x9a, 0x3d,
-  0x20, 0xb7, 0xa6, 0x3b, 0xf0, 0x0b, 0xc2, 0xbd, 0x72, 0x57, 0x6d, 0xbd,
-  0x68, 0x10, 0x10, 0x3d, 0x66, 0x1a, 0xc8, 0x3d, 0xae, 0x14, 0xe0, 0xbc,
-  0x42, 0xaa, 0x2d, 0x3d, 0x76, 0xda, 0x9e, 0xbc, 0x0e, 0x89, 0x8e, 0xbe,
-  0x8c, 0x21, 0x4f, 0xbe, 0xac, 0xe3, 0x1b, 0xbe, 0x02, 0x95, 0xf8, 0xbd,
-  0x8a, 0x00, 0xdb, 0x3d, 0x8c, 0x62, 0x06, 0xbe, 0xeb, 0x9f, 0x46, 0xbe,
-  0xfb, 0x50, 0x2a, 0x3c, 0x81, 0xb0, 0x7c, 0xbd, 0xb1, 0x0d, 0xfb, 0xbc,
-  0xba, 0x17, 0x80, 0xbd, 0xba, 0xa8, 0x47, 0xbe, 0x6b, 0x11, 0x9a, 0x3d,
-  0x17, 0x7c, 0xc6, 0xbc, 0xd3, 0xba, 0x3c, 0xbc, 0xe7, 0xff, 0x8c, 0xbe,
-  0xac, 0x6a, 0x40, 0x3d, 0x90, 0x15, 0x21, 0x3e, 0x6f, 0x9b, 0x07, 0x3e,
-  0x88, 0xc7, 0xe6, 0x38, 0xae, 0x24, 0x79, 0xbe, 0xb9, 0x46, 0x3e, 0x3e,
-  0x78, 0x87, 0x65, 0x3e, 0x40, 0x18, 0x15, 0xbf, 0x1a, 0xa7, 0xf3, 0x3d,
-  0xf7, 0x8f, 0xff, 0x3d, 0x74, 0x42, 0x15, 0x3e, 0x76, 0x58, 0x24, 0x3c,
-  0xcf, 0xaf, 0xb7, 0xbe, 0xf2, 0x73, 0x3f, 0x3d, 0x55, 0xd9, 0xba, 0x3d,
-  0x35, 0x76, 0xe1, 0xbe, 0xad, 0x7b, 0x28, 0xbe, 0xc5, 0x4a, 0x07, 0xbd,
-  0xf1, 0x34, 0x96, 0xbd, 0xfc, 0xe1, 0x19, 0xbd, 0x18, 0x82, 0x6c, 0x3d,
-  0x70, 0xd2, 0xb8, 0xbd, 0x90, 0x17, 0xa5, 0xbd, 0x6a, 0xaa, 0xd5, 0xbd,
-  0x65, 0x1d, 0x0f, 0xbe, 0xc0, 0x55, 0xbe, 0xbd, 0x41, 0x04, 0x48, 0xbe,
-  0x02, 0x2c, 0xd3, 0xbd, 0xb6, 0x60, 0xe7, 0x3d, 0xc3, 0x3f, 0x23, 0xbe,
-  0x4f, 0xd2, 0xa1, 0xbd, 0xeb, 0x9f, 0x8d, 0x3d, 0x11, 0xb4, 0x05, 0xbe,
-  0x21, 0x65, 0x0a, 0xbe, 0xd0, 0x6c, 0x11, 0xbe, 0x71, 0xd6, 0x03, 0xbe,
-  0x97, 0x39, 0x57, 0x3e, 0x24, 0x45, 0x39, 0xbe, 0x76, 0xe6, 0x8d, 0xbd,
-  0x56, 0x3d, 0x26, 0x3e, 0x38, 0x97, 0xbf, 0xbd, 0xd0, 0xa6, 0xf7, 0xbd,
-  0x96, 0x3e, 0x5c, 0xbe, 0xe4, 0x1c, 0x45, 0xbe, 0x5e, 0x78, 0x77, 0x3e,
-  0xc9, 0x75, 0x3c, 0xbe, 0x60, 0x08, 0x0c, 0xbe, 0xcc, 0xe0, 0x1b, 0x3e,
-  0xf4, 0x6d, 0x16, 0xbe, 0xee, 0x7e, 0x7d, 0xbe, 0x78, 0x2b, 0x99, 0xbd,
-  0xd6, 0x18, 0x3a, 0xbe, 0xe6, 0xe3, 0x58, 0x3e, 0x3d, 0x67, 0xf9, 0xbd,
-  0xeb, 0x3d, 0x16, 0xbe, 0xea, 0x95, 0x35, 0x3e, 0x29, 0x1b, 0x9a, 0xbc,
-  0xdc, 0xc2, 0xe6, 0x3d, 0xdf, 0x77, 0x8d, 0x3d, 0xe8, 0xa2, 0xae, 0x3d,
-  0xdf, 0xd3, 0x7f, 0x3e, 0x9b, 0xfe, 0x12, 0x3e, 0x2f, 0x46, 0x1d, 0x3e,
-  0x01, 0xed, 0xa3, 0x3d, 0x91, 0x97, 0x75, 0xbe, 0x3e, 0x12, 0xff, 0xbd,
-  0xa4, 0x66, 0x24, 0xbd, 0xab, 0x86, 0x22, 0xbc, 0xc4, 0x90, 0x76, 0x3e,
-  0xe0, 0xc5, 0x8e, 0x3c, 0xf3, 0x5f, 0xa5, 0xbd, 0x29, 0xb7, 0x2d, 0x39,
-  0x49, 0xaf, 0x70, 0xbe, 0x6d, 0x72, 0xcf, 0xbd, 0x13, 0xf8, 0x26, 0xbe,
-  0xb6, 0x05, 0x36, 0xbe, 0x65, 0x89, 0x05, 0x3e, 0x6e, 0xc3, 0x95, 0xbd,
-  0x35, 0x15, 0x01, 0xbe, 0x2d, 0x2f, 0xcb, 0xbc, 0x44, 0x5f, 0x80, 0xbd,
-  0x45, 0x4a, 0x9b, 0x3a, 0x97, 0xad, 0x40, 0xbc, 0x41, 0x20, 0xc3, 0x3c,
-  0xfa, 0xca, 0x7d, 0x3e, 0x88, 0x59, 0x63, 0xbd, 0x05, 0x92, 0xbc, 0xbd,
-  0x01, 0x8c, 0x8d, 0xbd, 0x5b, 0xd2, 0xa5, 0xbd, 0x20, 0x66, 0xd9, 0xbd,
-  0x0d, 0xa4, 0xa3, 0xbd, 0x29, 0x64, 0x82, 0xbe, 0x45, 0x24, 0xec, 0xbd,
-  0x9e, 0x51, 0x4a, 0xbe, 0x82, 0xfb, 0xa2, 0xbd, 0x67, 0x64, 0x8b, 0xbe,
-  0xbb, 0xd4, 0x93, 0xbd, 0xc4, 0x5a, 0x85, 0x3c, 0xf3, 0x7e, 0x89, 0x3c,
-  0x51, 0x4c, 0x8f, 0xbe, 0x0e, 0xc2, 0x03, 0xbe, 0xa5, 0xdf, 0x7b, 0xbd,
-  0x30, 0x41, 0xb3, 0x3b, 0xa3, 0x20, 0x18, 0xbf, 0x75, 0x8d, 0x9e, 0x3d,
-  0x37, 0x7c, 0x0c, 0x3e, 0xb6, 0xc2, 0x0a, 0x3e, 0xc3, 0x14, 0xd4, 0x3c,
-  0xde, 0x76, 0x9c, 0xbe, 0x3f, 0x43, 0xc9, 0x3d, 0xf5, 0xdb, 0x23, 0x3e,
-  0x4c, 0x07, 0x06, 0xbf, 0xe7, 0x64, 0x8e, 0x3d, 0x95, 0x7c, 0x4d, 0x3e,
-  0x8b, 0x55, 0x9d, 0x3b, 0xce, 0x16, 0xd1, 0x3d, 0x94, 0x13, 0xa4, 0xbd,
-  0x2b, 0xc1, 0x45, 0x3d, 0xf0, 0x0d, 0x5a, 0x3d, 0x28, 0x46, 0x52, 0xbe,
-  0xb2, 0x74, 0x1c, 0xbe, 0xd6, 0xe9, 0xff, 0xbd, 0x8b, 0xc4, 0x5f, 0xbe,
-  0xd0, 0xb8, 0x38, 0xbe, 0x6c, 0xde, 0x1a, 0x3d, 0x2f, 0x5c, 0x33, 0xbe,
-  0xf2, 0xed, 0x46, 0xbe, 0x6d, 0x02, 0x16, 0xbd, 0xee, 0xd9, 0x74, 0xbe,
-  0xf8, 0x70, 0x19, 0xbe, 0x93, 0x84, 0x2e, 0xbe, 0xe4, 0xc6, 0x8c, 0xbe,
-  0xb3, 0x33, 0xc6, 0x3d, 0x6a, 0x8d, 0xdf, 0xbd, 0x85, 0x79, 0x40, 0xbe,
-  0xe4, 0x87, 0x05, 0x3e, 0x8e, 0xf4, 0x54, 0xbe, 0x8d, 0xc7, 0x6b, 0xbe,
-  0xf9, 0x67, 0x3d, 0xbe, 0xf4, 0xae, 0x5a, 0xbe, 0x07, 0xc1, 0x46, 0x3e,
-  0xe2, 0xfe, 0x60, 0xbe, 0x5b, 0x8d, 0x59, 0xbe, 0x1f, 0x5e, 0x16, 0x3e,
-  0x3c, 0xa0, 0x2c, 0xbe, 0x5b, 0xc5, 0x1d, 0xbe, 0x3d, 0x03, 0xb3, 0xbc,
-  0x0f, 0x9d, 0x50, 0xbe, 0xbe, 0xcb, 0x75, 0x3e, 0xd5, 0xc1, 0x2f, 0xbe,
-  0xc5, 0x07, 0x0c, 0xbe, 0x07, 0x6f, 0xdc, 0x3d, 0xdb, 0x02, 0xe9, 0xbd,
-  0xfd, 0x96, 0xe2, 0xbd, 0x89, 0xe9, 0xe9, 0xbc, 0xc0, 0x10, 0x09, 0xbe,
-  0x5d, 0xc3, 0x1b, 0x3e, 0x9d, 0x62, 0x89, 0xbc, 0x17, 0xa4, 0xc4, 0xbd,
-  0x54, 0xdb, 0x6e, 0x3e, 0x6d, 0x9b, 0xf1, 0xbd, 0x33, 0xa6, 0x85, 0xbd,
-  0x08, 0x49, 0x81, 0x3b, 0x19, 0xd5, 0x6f, 0x3d, 0x2f, 0x80, 0x29, 0x3e,
-  0x30, 0xbb, 0x97, 0xbc, 0xaa, 0x5b, 0x44, 0xbd, 0xbd, 0x9e, 0x62, 0xbd,
-  0xaf, 0xd5, 0xbb, 0xbe, 0x54, 0x93, 0x19, 0xbe, 0x18, 0xe1, 0x87, 0xbe,
-  0x39, 0x57, 0x45, 0xbe, 0x26, 0x1b, 0x39, 0x3e, 0xc7, 0xb2, 0x54, 0xbe,
-  0x74, 0x8e, 0x80, 0xbe, 0xce, 0x65, 0xac, 0xbd, 0xec, 0xec, 0x13, 0xbe,
-  0x4d, 0x85, 0x3a, 0xbe, 0x60, 0xe5, 0x53, 0xbe, 0xd4, 0x05, 0x55, 0xbe,
-  0x01, 0xcf, 0x3a, 0x3e, 0x9e, 0xc1, 0x3e, 0xbe, 0x56, 0x17, 0x83, 0xbe,
-  0x98, 0x18, 0x9f, 0x3d, 0x18, 0xe9, 0x21, 0xbd, 0x53, 0xc3, 0xcf, 0xbc,
-  0x3b, 0xaa, 0x00, 0xbd, 0xd1, 0xeb, 0x2d, 0xbe, 0xf5, 0xfc, 0x16, 0x3e,
-  0x8c, 0x56, 0x43, 0xbd, 0x85, 0x2c, 0xfc, 0xbc, 0x46, 0x0a, 0x67, 0xbd,
-  0x78, 0xce, 0xca, 0xbd, 0x89, 0x26, 0x9c, 0xbd, 0x01, 0xf8, 0xd4, 0xbd,
-  0x87, 0x80, 0x5a, 0xbe, 0x38, 0x7e, 0xe3, 0xbd, 0xbb, 0x95, 0xfe, 0xbd,
-  0x28, 0xc5, 0xde, 0xbd, 0x01, 0x1b, 0x93, 0xbe, 0x76, 0x8d, 0xd3, 0xbd,
-  0xfd, 0xdf, 0xc6, 0x3c, 0x60, 0x3e, 0xff, 0xbd, 0x56, 0x51, 0x2f, 0xbe,
-  0x5d, 0x12, 0x74, 0xbd, 0x10, 0x51, 0xa2, 0xbd, 0x8d, 0x8a, 0xbf, 0xbd,
-  0xfb, 0x21, 0xd5, 0xbe, 0x93, 0x5e, 0x02, 0x3e, 0x8a, 0x81, 0x2f, 0x3e,
-  0x12, 0x52, 0x2b, 0x3e, 0x95, 0x26, 0xb8, 0x3d, 0x0b, 0xe1, 0x17, 0xbd,
-  0xca, 0x75, 0xb6, 0x3d, 0xf8, 0xee, 0x1a, 0x3e, 0xdf, 0xab, 0x81, 0xbe,
-  0x53, 0x33, 0xbb, 0x3c, 0xc0, 0xa9, 0x90, 0x3c, 0x2b, 0xd9, 0xef, 0xbd,
-  0x18, 0x64, 0x55, 0xbc, 0xa2, 0x05, 0x8f, 0x3c, 0x77, 0xdc, 0x23, 0x3c,
-  0x5c, 0xc5, 0x7c, 0xbd, 0xc9, 0xd8, 0x00, 0x3e, 0x51, 0x9d, 0xf4, 0xbd,
-  0xeb, 0x71, 0x35, 0xbe, 0x03, 0x95, 0xe7, 0xbd, 0x93, 0xc7, 0xad, 0xbe,
-  0xbc, 0xf9, 0xdb, 0xbc, 0x9d, 0xef, 0x49, 0xbe, 0x35, 0x93, 0x2b, 0xbe,
-  0x84, 0x61, 0xc0, 0x3d, 0xbc, 0x05, 0x27, 0xbd, 0x18, 0xb1, 0xdc, 0xbd,
-  0x46, 0x12, 0x4b, 0x3d, 0x32, 0xbb, 0x31, 0xbe, 0x01, 0x32, 0xfb, 0x3d,
-  0xbd, 0x70, 0x68, 0x3c, 0xc3, 0x46, 0x73, 0xbd, 0x0a, 0xb8, 0x25, 0x3e,
-  0x71, 0x05, 0x03, 0xbd, 0x18, 0xc7, 0x53, 0x3c, 0xcb, 0xf8, 0xff, 0xba,
-  0xed, 0xaa, 0x02, 0xbd, 0xd0, 0x0d, 0x87, 0x3e, 0xfe, 0xe2, 0x55, 0xbd,
-  0x31, 0x0b, 0x47, 0xbc, 0x3f, 0x11, 0xda, 0x3d, 0x6c, 0x51, 0x9a, 0xbc,
-  0xa5, 0xbc, 0xbd, 0xbc, 0xc2, 0x65, 0x4f, 0xbd, 0xfb, 0x1c, 0xd5, 0xbd,
-  0x3f, 0x35, 0x54, 0x3e, 0xbd, 0x40, 0xde, 0xbd, 0x86, 0x16, 0x22, 0xbd,
-  0x99, 0xeb, 0x4f, 0x3e, 0x45, 0x53, 0x46, 0xbd, 0x5e, 0xef, 0x7b, 0xbd,
-  0xca, 0xc6, 0xd1, 0xbd, 0xa6, 0xe0, 0xa5, 0xbd, 0xc9, 0xe4, 0x24, 0x3e,
-  0x99, 0xca, 0x94, 0xbc, 0xdc, 0x73, 0x0d, 0xbd, 0x03, 0xfc, 0x55, 0x3e,
-  0xd6, 0x50, 0x1a, 0xbd, 0x25, 0xf4, 0x81, 0xbd, 0x12, 0x95, 0xb3, 0xbd,
-  0xb4, 0x96, 0xb4, 0xbc, 0x59, 0x49, 0x53, 0x3e, 0x71, 0xcc, 0xfd, 0xbd,
-  0x7d, 0x0e, 0xb8, 0xbc, 0x95, 0x23, 0x18, 0x3e, 0xdd, 0xab, 0x29, 0x3d,
-  0x4a, 0x06, 0xa2, 0xbe, 0x54, 0x2e, 0xad, 0xbe, 0x01, 0xc9, 0xa1, 0xbe,
-  0xb1, 0x2e, 0x1d, 0x3e, 0x0e, 0x58, 0x85, 0xbe, 0x66, 0x88, 0x9b, 0xbe,
-  0xb7, 0x2a, 0x80, 0x3e, 0xb2, 0x09, 0x60, 0xbd, 0xb1, 0x20, 0x85, 0xbd,
-  0x3b, 0xfe, 0x4f, 0x3c, 0xd9, 0x7e, 0x3a, 0xbe, 0xd3, 0x46, 0x37, 0x3e,
-  0xf5, 0x89, 0x40, 0xbd, 0x67, 0x0c, 0x71, 0xbd, 0xda, 0x81, 0x2c, 0x3e,
-  0x49, 0x6b, 0xe3, 0xbc, 0x11, 0x7c, 0xe3, 0x3c, 0xb4, 0xf4, 0xbc, 0xbc,
-  0xe0, 0x74, 0x28, 0xbd, 0x83, 0x60, 0x07, 0x3d, 0x1e, 0xb2, 0x7b, 0xbd,
-  0x21, 0x43, 0x65, 0xbc, 0x23, 0x19, 0xec, 0x3c, 0xc0, 0x1b, 0x31, 0x3d,
-  0x64, 0x8d, 0x85, 0xbd, 0x9e, 0x0b, 0x40, 0xbb, 0x86, 0xd6, 0x04, 0xbe,
-  0x61, 0xc5, 0x74, 0xbd, 0x00, 0x92, 0xba, 0xbd, 0x12, 0xa9, 0xae, 0xbc,
-  0x4a, 0xe4, 0x2c, 0xbe, 0x6c, 0xbc, 0x7f, 0xbd, 0xa5, 0xbd, 0x40, 0x3d,
-  0x7d, 0x3f, 0x32, 0x3d, 0x05, 0x4f, 0x12, 0xbd, 0xe3, 0x94, 0xcf, 0xbb,
-  0x35, 0xc5, 0xa8, 0xbc, 0x5a, 0x61, 0x9d, 0x3d, 0xce, 0x7f, 0xae, 0xbe,
-  0x86, 0xeb, 0xdc, 0x3c, 0x9c, 0x06, 0xce, 0x3c, 0xb6, 0xea, 0x08, 0xbd,
-  0x27, 0x93, 0xc5, 0xba, 0x54, 0x7f, 0x02, 0xbd, 0xd2, 0x82, 0x4c, 0xbb,
-  0xff, 0xb4, 0x88, 0x3d, 0xb6, 0x45, 0xfd, 0xbd, 0xe4, 0xca, 0x97, 0x3d,
-  0xc1, 0xaf, 0x9e, 0x3c, 0x27, 0x98, 0x89, 0xbd, 0x2e, 0xe4, 0x1f, 0xbe,
-  0x4f, 0xea, 0xac, 0xbc, 0x15, 0xe2, 0x1d, 0xbe, 0x6d, 0x96, 0x26, 0xbc,
-  0x2e, 0x7d, 0xc7, 0x3d, 0xe9, 0x41, 0x8d, 0xbd, 0xef, 0x8e, 0xb4, 0xbc,
-  0x81, 0xdc, 0x07, 0x3d, 0xad, 0xb9, 0x13, 0xbe, 0x51, 0xe5, 0x9f, 0xbb,
-  0x59, 0x4f, 0x89, 0x3d, 0x85, 0xf6, 0x2d, 0xbd, 0xcb, 0x04, 0x02, 0x3e,
-  0x86, 0x67, 0xad, 0x3d, 0x02, 0x5c, 0xb3, 0x3d, 0xb3, 0x0a, 0x64, 0x3c,
-  0x5e, 0x24, 0x92, 0x3c, 0xfc, 0x85, 0xd0, 0x3d, 0x06, 0xe4, 0x39, 0xbc,
-  0x84, 0xfc, 0x6e, 0x3d, 0x7d, 0x16, 0x8f, 0x3d, 0xf2, 0x9f, 0x38, 0x3b,
-  0x4c, 0xe6, 0x8b, 0x3c, 0x77, 0xa0, 0x53, 0xbc, 0xef, 0x32, 0xc8, 0x3c,
-  0x14, 0xed, 0x13, 0x3e, 0xdc, 0x9a, 0x78, 0xbd, 0x6e, 0x67, 0x9c, 0xbd,
-  0xe7, 0x72, 0x2e, 0x3d, 0x4c, 0x4c, 0xc1, 0xbd, 0x3d, 0xbb, 0xac, 0xbd,
-  0x0f, 0x0a, 0x93, 0xbd, 0x23, 0x64, 0x59, 0xbd, 0xbb, 0x54, 0x49, 0x3e,
-  0xb9, 0xba, 0x4a, 0xbc, 0x56, 0x71, 0x28, 0xbd, 0xbb, 0x5f, 0x09, 0x3e,
-  0x76, 0x32, 0x97, 0x3d, 0xea, 0x8c, 0x7e, 0x3d, 0x7a, 0x5b, 0x2d, 0xbc,
-  0xd2, 0x40, 0xf0, 0x3c, 0x44, 0x4a, 0x11, 0x3e, 0x84, 0xc8, 0xb7, 0x3d,
-  0x16, 0x67, 0xb4, 0x3b, 0xd8, 0x05, 0x3b, 0x3e, 0xdb, 0x30, 0x63, 0xbd,
-  0xae, 0xda, 0x7d, 0x3d, 0x5b, 0xb3, 0x86, 0x3c, 0xb8, 0x37, 0x6c, 0xbb,
-  0x64, 0x3a, 0x81, 0x3e, 0x12, 0xfb, 0x78, 0xbd, 0xc0, 0x36, 0xaf, 0xbd,
-  0x4c, 0x0f, 0x2d, 0x3e, 0xdb, 0x9d, 0x06, 0x3e, 0xca, 0xef, 0x5e, 0xbd,
-  0x09, 0x04, 0x67, 0xbb, 0x37, 0x88, 0x04, 0x3d, 0x36, 0xbf, 0x9b, 0x3d,
-  0x91, 0x29, 0xa6, 0xbb, 0xfe, 0x47, 0x2b, 0x3d, 0xfd, 0x42, 0x6d, 0x3e,
-  0xa6, 0x6b, 0x87, 0xbb, 0x54, 0xd6, 0x83, 0x3c, 0xab, 0x8c, 0x38, 0x3d,
-  0x0f, 0x31, 0xf9, 0xbc, 0x10, 0xa8, 0xc0, 0x3c, 0xbf, 0xff, 0xd8, 0x3d,
-  0xf0, 0x26, 0x5b, 0xbb, 0xc1, 0xd0, 0x15, 0x3d, 0xd6, 0x2f, 0x00, 0xbd,
-  0x75, 0xd9, 0x79, 0x3d, 0x18, 0xb1, 0x82, 0x3d, 0xd1, 0xf3, 0x4a, 0x3d,
-  0x05, 0xc7, 0xbe, 0x3d, 0x35, 0x6b, 0xd4, 0x3d, 0xcd, 0x97, 0x15, 0x3c,
-  0x24, 0x5d, 0x20, 0xbe, 0xf4, 0xcd, 0x9c, 0xbd, 0x06, 0x6b, 0xba, 0x3d,
-  0xd3, 0x4b, 0x46, 0xbd, 0x8a, 0xab, 0x90, 0x3d, 0x86, 0x87, 0xa2, 0xbd,
-  0x3d, 0x26, 0x6b, 0x3d, 0xbc, 0xd2, 0xe0, 0xbb, 0x10, 0x23, 0xce, 0xbe,
-  0x00, 0xa2, 0xb6, 0xbd, 0xac, 0x75, 0x1b, 0xbd, 0xe7, 0x7b, 0x79, 0xbd,
-  0x95, 0x3e, 0x04, 0xbe, 0xad, 0x0b, 0xe2, 0xbd, 0x92, 0x74, 0xed, 0xbd,
-  0x55, 0xb6, 0x88, 0xbd, 0x01, 0xdb, 0x08, 0xbf, 0xe1, 0x17, 0xcb, 0xbc,
-  0x9e, 0x49, 0x9d, 0xbd, 0x08, 0x0f, 0x1e, 0xbc, 0xaa, 0x37, 0x16, 0xbe,
-  0xc8, 0x3b, 0x7e, 0xbd, 0x88, 0xfa, 0xb4, 0xbd, 0x30, 0x86, 0xa6, 0xbd,
-  0x93, 0x4d, 0xbe, 0xbe, 0xbf, 0x84, 0x2e, 0x3d, 0x03, 0xf7, 0x52, 0x3d,
-  0xfb, 0xa7, 0x3f, 0xbd, 0xc8, 0x06, 0xda, 0xbc, 0x0c, 0xd5, 0x95, 0xbc,
-  0x7c, 0xfc, 0xb1, 0xbc, 0xf1, 0xd0, 0x21, 0x3d, 0xd7, 0x4a, 0x80, 0xbd,
-  0x28, 0x23, 0x26, 0x3e, 0x9a, 0xc3, 0xe2, 0x3d, 0x51, 0x36, 0x51, 0x3d,
-  0x43, 0x41, 0x61, 0xbc, 0x9a, 0x11, 0x82, 0x3e, 0x39, 0x6e, 0x2c, 0x3a,
-  0x91, 0x83, 0x00, 0x3d, 0xf6, 0x6f, 0xc0, 0x3d, 0x98, 0x52, 0x21, 0x3c,
-  0xd9, 0x0c, 0x00, 0x3b, 0xec, 0x09, 0x0b, 0xbd, 0x41, 0x2c, 0x88, 0x3c,
-  0x96, 0x0e, 0x2a, 0x3e, 0xa2, 0x33, 0x7c, 0x3c, 0xac, 0x2b, 0x1e, 0xbd,
-  0xab, 0x01, 0x1f, 0x3e, 0xd5, 0x09, 0xa3, 0xbd, 0x56, 0x0f, 0xaa, 0x3c,
-  0xbd, 0x40, 0x59, 0xbc, 0xab, 0x46, 0x65, 0xbd, 0x1c, 0xb3, 0x65, 0x3e,
-  0xac, 0x20, 0x26, 0x3c, 0x17, 0x61, 0xab, 0xbd, 0x2e, 0x0c, 0x2d, 0x3e,
-  0x01, 0x22, 0xcb, 0xbd, 0xe1, 0x78, 0xeb, 0xbd, 0xed, 0x43, 0x89, 0xbd,
-  0xac, 0x59, 0x90, 0xbd, 0x84, 0x54, 0x85, 0x3e, 0xd1, 0xc0, 0xc1, 0xbd,
-  0x6c, 0x7f, 0x09, 0xbe, 0xe9, 0xf0, 0x11, 0x3e, 0xfb, 0x52, 0x29, 0x3d,
-  0xe9, 0x13, 0x24, 0xbd, 0xc9, 0xa9, 0x0c, 0x3d, 0x4a, 0x11, 0xb7, 0x3d,
-  0x45, 0x24, 0x44, 0x3e, 0xb7, 0xdf, 0xae, 0x3d, 0xc9, 0x56, 0xef, 0x3c,
-  0x5b, 0xa8, 0x53, 0x3e, 0x96, 0xdd, 0xce, 0x3c, 0x15, 0x52, 0x0b, 0xbe,
-  0xa5, 0xa6, 0xfb, 0xbd, 0xee, 0x6d, 0xc8, 0xbc, 0xba, 0xfc, 0x66, 0x3e,
-  0x5d, 0x20, 0x0b, 0xbe, 0x45, 0xdd, 0x66, 0xbd, 0x81, 0x7b, 0xbd, 0x3d,
-  0xe8, 0x51, 0xb2, 0xbd, 0x96, 0x5c, 0x0e, 0x3e, 0x3c, 0x3e, 0x36, 0x3d,
-  0xff, 0xe8, 0xb1, 0x3c, 0xf5, 0xee, 0x9b, 0x3e, 0x02, 0xfd, 0xcd, 0x3d,
-  0x06, 0x0a, 0xd5, 0x3d, 0xeb, 0x12, 0xaa, 0x3d, 0xa9, 0x8f, 0xa4, 0x3d,
-  0x66, 0xd7, 0xae, 0x3d, 0x20, 0x7a, 0xd2, 0x3b, 0xd3, 0x1f, 0xbd, 0x3c,
-  0x08, 0x2b, 0x28, 0x3e, 0xa8, 0xf8, 0x02, 0xbc, 0xd7, 0xc8, 0x99, 0x3d,
-  0xf5, 0x83, 0x00, 0x3c, 0x08, 0x22, 0x78, 0xba, 0xc8, 0x8f, 0x25, 0x3b,
-  0xa0, 0x64, 0x83, 0x3d, 0xef, 0xd8, 0xea, 0x3c, 0x88, 0xf6, 0x1f, 0x3e,
-  0x31, 0x00, 0xd8, 0x3c, 0x8c, 0xc3, 0x96, 0x3d, 0xe7, 0xd7, 0x1a, 0xbe,
-  0xeb, 0x77, 0x5a, 0xbd, 0x9f, 0x9d, 0x95, 0xbd, 0x6f, 0x63, 0x57, 0x3b,
-  0xd7, 0x64, 0xbf, 0xbc, 0xb5, 0x2e, 0xf5, 0x3c, 0x6c, 0x92, 0xfe, 0x3b,
-  0x9b, 0x75, 0x26, 0xbd, 0x24, 0x38, 0x7b, 0xbe, 0x23, 0x14, 0x25, 0x3d,
-  0xc3, 0xb4, 0xf5, 0xbd, 0xb6, 0x41, 0x7c, 0xbd, 0xda, 0xfe, 0xef, 0xbd,
-  0xd7, 0x99, 0x00, 0xbd, 0x15, 0x6d, 0x50, 0xbc, 0xf1, 0xf6, 0xb2, 0xbd,
-  0xa3, 0x4c, 0x47, 0xbe, 0x89, 0x49, 0x2f, 0xbd, 0x2d, 0x8c, 0xb1, 0x3c,
-  0x07, 0x66, 0x94, 0x3d, 0x07, 0xa1, 0x44, 0x3c, 0x17, 0xda, 0x1a, 0x3c,
-  0x10, 0xc8, 0x03, 0x3d, 0x43, 0x27, 0x2f, 0x3d, 0x1f, 0xed, 0xd9, 0xbd,
-  0x5a, 0xe0, 0xe0, 0x3d, 0x26, 0x9e, 0xb6, 0x3c, 0x1e, 0x3a, 0x6a, 0x3d,
-  0x59, 0x7d, 0xc1, 0x3c, 0x81, 0xd0, 0xc8, 0x3d, 0x2b, 0x1a, 0x1e, 0xbd,
-  0xb7, 0xbc, 0xcf, 0x3d, 0x5c, 0x18, 0x9a, 0x3c, 0x44, 0xde, 0x91, 0x3d,
-  0xc7, 0xba, 0x99, 0xbb, 0x1e, 0xf8, 0x25, 0x3c, 0x53, 0x84, 0x35, 0x3d,
-  0x25, 0xa0, 0x6c, 0x3e, 0x0b, 0xb0, 0xcb, 0x3d, 0xfe, 0x58, 0xe2, 0x3d,
-  0x46, 0x45, 0x1e, 0x3e, 0xfc, 0x34, 0x86, 0x3d, 0xb7, 0x19, 0x96, 0x3d,
-  0xaf, 0x3d, 0x87, 0x3d, 0x94, 0x01, 0x8c, 0x3d, 0x2e, 0x64, 0x4e, 0x3e,
-  0xd2, 0x51, 0xf6, 0xbb, 0x9f, 0x1e, 0x15, 0xbd, 0x4e, 0x35, 0x28, 0x3e,
-  0x2b, 0xe1, 0x4f, 0x3d, 0x95, 0xc9, 0x5d, 0xbd, 0xa0, 0x9c, 0x1b, 0xbe,
-  0x44, 0x66, 0x7d, 0xbd, 0x65, 0x30, 0x3c, 0x3e, 0xfd, 0x1d, 0x3c, 0xbd,
-  0xf1, 0x1d, 0x16, 0xbd, 0x8c, 0xae, 0x77, 0x3e, 0x8f, 0x84, 0x22, 0xbe,
-  0x69, 0x78, 0xb9, 0xbd, 0x6b, 0x26, 0xd6, 0xbc, 0x2d, 0x31, 0x99, 0xbd,
-  0xc2, 0x6d, 0x61, 0x3e, 0xe2, 0xa3, 0xc2, 0xbd, 0x58, 0x9e, 0xf2, 0xbd,
-  0xf0, 0x23, 0x12, 0x3e, 0x87, 0x88, 0x37, 0x3d, 0x30, 0xa7, 0x44, 0x3a,
-  0x24, 0x30, 0xc3, 0x3d, 0x60, 0x34, 0x36, 0x3d, 0x74, 0x67, 0x72, 0x3e,
-  0xc0, 0xe0, 0x95, 0x3d, 0xf4, 0xcf, 0x9c, 0x3c, 0x3f, 0xa5, 0x2e, 0x3e,
-  0xc5, 0xac, 0x72, 0x3c, 0x9d, 0x4f, 0x19, 0xbc, 0x7f, 0x27, 0x9b, 0xbb,
-  0x2f, 0xc9, 0x97, 0xbd, 0x0b, 0xfe, 0x83, 0x3e, 0x05, 0xa6, 0x23, 0xbd,
-  0xd9, 0x43, 0x43, 0xbd, 0x1d, 0x39, 0x1d, 0x3e, 0xb3, 0xd8, 0xf9, 0xbd,
-  0x4a, 0x8c, 0x29, 0xbe, 0x51, 0x9a, 0xbf, 0xbd, 0x84, 0x22, 0x0f, 0xbe,
-  0x8f, 0x85, 0xe9, 0x3d, 0x20, 0x8e, 0x14, 0xbe, 0x69, 0xfc, 0x30, 0xbe,
-  0xe5, 0x0a, 0x29, 0x3e, 0xad, 0xfb, 0x56, 0xbe, 0x66, 0x97, 0x12, 0xbe,
-  0x29, 0x52, 0x27, 0xbe, 0xe7, 0xd4, 0x8b, 0xbd, 0x97, 0x6d, 0x52, 0x3b,
-  0xd6, 0x0f, 0xe3, 0xbd, 0xc3, 0xb6, 0x3d, 0xbe, 0xfe, 0xd8, 0x7c, 0x3e,
-  0x91, 0x0d, 0xdf, 0xbd, 0x01, 0x58, 0x07, 0xbd, 0x32, 0xa4, 0xe0, 0xbd,
-  0x73, 0x32, 0xbc, 0xbc, 0xac, 0x47, 0xdf, 0x3d, 0xe1, 0xe0, 0xd2, 0xbd,
-  0x78, 0x23, 0xbd, 0xbd, 0x20, 0x56, 0x3d, 0x3e, 0xcf, 0xe9, 0x3d, 0xbe,
-  0x9a, 0xd3, 0x3e, 0xbd, 0x11, 0x12, 0x34, 0xbe, 0x25, 0xdc, 0x33, 0xbd,
-  0x2b, 0x7c, 0x7f, 0x3d, 0xc2, 0x88, 0x0a, 0xbd, 0x8a, 0xd0, 0x2d, 0xbe,
-  0xf7, 0x8e, 0x6a, 0x3e, 0xf6, 0xb8, 0x93, 0xbe, 0xca, 0xc6, 0x08, 0xbd,
-  0x32, 0x44, 0xbd, 0xbd, 0x43, 0xfb, 0xb2, 0xbd, 0x3f, 0x21, 0x1d, 0x3e,
-  0x32, 0xa5, 0xdd, 0xbd, 0x80, 0x28, 0x14, 0xbe, 0xac, 0xfa, 0x65, 0x3e,
-  0x87, 0xed, 0x49, 0xbe, 0x65, 0x3f, 0xae, 0xbc, 0x85, 0x44, 0x89, 0xbd,
-  0x69, 0x58, 0x39, 0xbd, 0xe0, 0x71, 0xda, 0x3d, 0x24, 0x19, 0xee, 0xbd,
-  0x5e, 0x45, 0x07, 0xbe, 0xb6, 0xbb, 0x91, 0x3e, 0x6c, 0x75, 0x74, 0xbe,
-  0x6a, 0xfa, 0x87, 0xbd, 0x32, 0x80, 0xec, 0xbd, 0x15, 0x20, 0x84, 0xbd,
-  0x72, 0x2d, 0x01, 0x3d, 0xfa, 0x57, 0x3e, 0xbe, 0x8e, 0xf1, 0x5d, 0xbe,
-  0x10, 0x73, 0x64, 0x3e, 0xc5, 0x91, 0x8a, 0xbe, 0x75, 0xc1, 0x97, 0xbd,
-  0xf6, 0x68, 0xe4, 0xb9, 0xc1, 0x8a, 0x53, 0xbd, 0xd8, 0xb7, 0x0e, 0x3e,
-  0x22, 0xcd, 0x13, 0xbe, 0x3d, 0x21, 0xa2, 0xbe, 0x21, 0x5a, 0x48, 0x3e,
-  0x73, 0xae, 0x66, 0xbe, 0x1e, 0xa0, 0x59, 0xbd, 0x7d, 0xd2, 0xc9, 0xbb,
-  0x5c, 0x80, 0xd1, 0xbd, 0x26, 0x6f, 0x09, 0x3e, 0x98, 0xfe, 0xd6, 0xbc,
-  0xd8, 0x66, 0x12, 0xbd, 0x69, 0xae, 0x89, 0x3e, 0x80, 0xb1, 0xb7, 0xbd,
-  0x29, 0xd3, 0x15, 0xbd, 0x78, 0xc7, 0xfb, 0xbd, 0x02, 0x18, 0x06, 0xbe,
-  0x61, 0x66, 0x11, 0x3e, 0xc6, 0x18, 0x23, 0xbe, 0x81, 0x0c, 0xb3, 0xbd,
-  0xfe, 0x78, 0x6c, 0x3e, 0x17, 0x27, 0x93, 0xbc, 0xa2, 0xcf, 0x1c, 0xbe,
-  0x42, 0xc9, 0x13, 0xbd, 0x4e, 0xfa, 0x26, 0xbe, 0xfe, 0x2f, 0x28, 0x3e,
-  0xae, 0xb7, 0xe1, 0x39, 0xed, 0x84, 0x20, 0xbd, 0xe7, 0x6d, 0x7d, 0x3e,
-  0x36, 0xda, 0x6d, 0x3d, 0x47, 0xe7, 0xdb, 0xbb, 0x94, 0x5d, 0xdd, 0x3d,
-  0x7d, 0x56, 0x8b, 0x3a, 0xa4, 0x04, 0x29, 0x3e, 0x17, 0x21, 0x37, 0x3e,
-  0x96, 0x33, 0x0e, 0xbc, 0x8e, 0x38, 0xbd, 0xbd, 0x28, 0x7d, 0x92, 0xbd,
-  0x5c, 0xb8, 0x3a, 0xbd, 0x21, 0x99, 0x45, 0x3c, 0xba, 0xbe, 0x7d, 0xbc,
-  0x2e, 0xb2, 0xff, 0xbd, 0xe3, 0xf6, 0x71, 0xbd, 0xcf, 0x03, 0xd7, 0xbd,
-  0x94, 0x00, 0x00, 0xbe, 0xb0, 0xa2, 0xa4, 0xbd, 0x15, 0xc8, 0x59, 0xbc,
-  0xd3, 0x6c, 0x41, 0xbc, 0xee, 0x30, 0x03, 0x3d, 0x70, 0x6e, 0x31, 0xbd,
-  0xb1, 0x5a, 0xfc, 0xbc, 0xae, 0x1e, 0xb4, 0xbd, 0x93, 0x05, 0x7f, 0xbd,
-  0x13, 0x19, 0x39, 0xbd, 0xb5, 0x55, 0xc4, 0xbd, 0x11, 0x1f, 0xe8, 0xbd,
-  0x3d, 0x88, 0xa4, 0xbc, 0x83, 0xa0, 0x52, 0xbd, 0xc0, 0x26, 0x99, 0xbd,
-  0xf4, 0x4b, 0xc7, 0xbd, 0x69, 0x0c, 0x08, 0x3c, 0x4a, 0xdc, 0x0a, 0x3e,
-  0xe6, 0x07, 0x47, 0xbd, 0xa4, 0xf9, 0xc6, 0x3b, 0x6c, 0x1e, 0xb5, 0x3c,
-  0x33, 0x46, 0x8f, 0xbd, 0xee, 0x4a, 0x45, 0xb9, 0x3f, 0xb5, 0x06, 0xbd,
-  0xaa, 0x73, 0x26, 0x3d, 0x28, 0x3a, 0x30, 0x3e, 0x12, 0xb1, 0x7e, 0x3c,
-  0x48, 0xe6, 0xad, 0x3d, 0x2c, 0x6d, 0xc5, 0xbd, 0x83, 0x29, 0xd5, 0xbd,
-  0xb5, 0xba, 0x40, 0x3c, 0x6f, 0x9f, 0xbd, 0x3d, 0x2e, 0x7b, 0xcb, 0x3d,
-  0xe6, 0x7e, 0xde, 0x3d, 0x12, 0x92, 0xe7, 0x3d, 0x96, 0xcf, 0xdf, 0x3a,
-  0xf7, 0x8e, 0xdd, 0xbc, 0x9e, 0x21, 0xa9, 0xbc, 0x52, 0x56, 0x2c, 0xbd,
-  0x2c, 0x9c, 0xa0, 0x3d, 0xea, 0x1f, 0x12, 0xbc, 0xd5, 0x9e, 0x4a, 0xbd,
-  0xfd, 0x74, 0x59, 0x3d, 0x0e, 0xa4, 0x8c, 0xb7, 0x95, 0x02, 0x9e, 0xbd,
-  0x25, 0xae, 0x03, 0xbd, 0xc3, 0x8b, 0xbc, 0xb9, 0xc5, 0x0a, 0xe2, 0xbd,
-  0x0d, 0x88, 0x05, 0xbd, 0x6b, 0xa3, 0x93, 0x3c, 0x8f, 0x41, 0x46, 0x3d,
-  0x92, 0x20, 0x3f, 0x3c, 0xce, 0xdb, 0x1a, 0xbe, 0x85, 0x58, 0xfc, 0x3b,
-  0x4a, 0xc5, 0xbf, 0xbd, 0x58, 0x8f, 0xa4, 0xbd, 0xdd, 0x0d, 0x03, 0xbd,
-  0xde, 0xf7, 0xc6, 0xbd, 0x97, 0x22, 0x43, 0x3d, 0x31, 0x1d, 0x3a, 0x3c,
-  0xaf, 0x15, 0x57, 0xbe, 0x06, 0x8c, 0xc4, 0xbc, 0x3e, 0x81, 0x26, 0xbe,
-  0x5c, 0xde, 0x35, 0xbd, 0xe1, 0x50, 0x45, 0xbe, 0x0d, 0xef, 0x41, 0xbe,
-  0x02, 0xd4, 0x06, 0xbe, 0xa7, 0x0b, 0x2f, 0xbe, 0x13, 0x51, 0x45, 0xbe,
-  0x88, 0x89, 0x9b, 0xbc, 0x71, 0x69, 0x24, 0xbe, 0xd3, 0xd2, 0x56, 0xbe,
-  0xbf, 0xea, 0xcb, 0xbd, 0x80, 0x69, 0xf2, 0xbd, 0x9e, 0x64, 0x86, 0xbd,
-  0xf8, 0x08, 0x0b, 0xbe, 0xb2, 0x52, 0x32, 0xbe, 0xe1, 0x53, 0x7c, 0xbd,
-  0x4c, 0x8f, 0x6f, 0xbe, 0x2e, 0x2f, 0x8d, 0xbd, 0xc3, 0x10, 0x99, 0xbc,
-  0x6e, 0x55, 0x6f, 0x3b, 0xce, 0xda, 0xea, 0xbd, 0xf3, 0x32, 0x6a, 0x3c,
-  0x1d, 0xc3, 0x57, 0xbd, 0x9c, 0xc2, 0x0e, 0xbb, 0x05, 0x99, 0x9a, 0xbd,
-  0x0e, 0xe6, 0xc3, 0xba, 0xd1, 0xe7, 0x7f, 0xbd, 0x0e, 0x33, 0x68, 0x3d,
-  0x75, 0x3e, 0x07, 0x3c, 0x6e, 0xe0, 0x37, 0xbd, 0xf7, 0x09, 0xa8, 0x3d,
-  0x6a, 0xfa, 0x7e, 0xbd, 0xee, 0xf8, 0x3a, 0xbd, 0x3d, 0x22, 0x68, 0x3d,
-  0x1a, 0xb9, 0xdf, 0xbd, 0x8c, 0xdc, 0x6d, 0xbc, 0xb4, 0xbf, 0x57, 0xbc,
-  0xeb, 0x7a, 0xac, 0xbd, 0xc1, 0x6e, 0x4b, 0xbb, 0x02, 0xe5, 0x96, 0xbd,
-  0xe3, 0x83, 0xf1, 0xbc, 0x99, 0x63, 0x1c, 0xbe, 0xda, 0x16, 0x9f, 0xbd,
-  0x9b, 0xa1, 0xb0, 0xbd, 0xbb, 0x21, 0x1f, 0xbe, 0xdb, 0x17, 0x72, 0xbd,
-  0xaf, 0x7a, 0x14, 0xbd, 0x88, 0x67, 0xfe, 0xbc, 0x33, 0x3f, 0xf1, 0xbd,
-  0x39, 0xb3, 0x19, 0xbd, 0xf7, 0xb5, 0x04, 0xbd, 0xc1, 0x2e, 0xbd, 0xbc,
-  0xc3, 0xb0, 0x16, 0xbd, 0x03, 0x07, 0xe6, 0x3c, 0x6b, 0x60, 0xf2, 0xbd,
-  0x6b, 0x4e, 0x39, 0xbd, 0x78, 0x1e, 0x16, 0xbd, 0x52, 0x30, 0x03, 0x3d,
-  0x6a, 0xa8, 0x80, 0xbd, 0xac, 0x0f, 0xa4, 0x3d, 0xeb, 0x11, 0x6c, 0x3d,
-  0xa1, 0x80, 0xa9, 0x3d, 0xa8, 0xee, 0x21, 0x3e, 0xa2, 0x4f, 0x5e, 0xbd,
-  0x7c, 0x3e, 0x0d, 0xbc, 0xa1, 0xde, 0x05, 0x3d, 0xfa, 0x94, 0x84, 0x3b,
-  0x8f, 0x5f, 0x61, 0x3d, 0x1a, 0xbe, 0x36, 0x3c, 0xce, 0x7b, 0x9c, 0x3c,
-  0x4a, 0x83, 0x1d, 0x3e, 0xca, 0xb3, 0x84, 0x3c, 0xed, 0x2d, 0x5f, 0x3d,
-  0xf0, 0x12, 0x4d, 0x3c, 0x93, 0x2d, 0x7b, 0xbc, 0x80, 0x24, 0xd3, 0x3d,
-  0x32, 0x6f, 0xce, 0x3d, 0xff, 0x3d, 0xbd, 0x3c, 0x0d, 0xe4, 0xba, 0x3d,
-  0xac, 0x90, 0xeb, 0x3d, 0xdf, 0xf3, 0x99, 0xbc, 0x9c, 0x20, 0xbe, 0x3d,
-  0x74, 0xb8, 0x42, 0x3d, 0xa9, 0xd0, 0x88, 0x3d, 0x1e, 0xa4, 0x8d, 0x3b,
-  0x3d, 0x3a, 0x92, 0x3b, 0x74, 0xa6, 0x10, 0x3d, 0x11, 0xbe, 0x18, 0x3e,
-  0x45, 0x6e, 0xdc, 0xbc, 0x31, 0x52, 0x91, 0x3d, 0x82, 0x14, 0xcf, 0xbc,
-  0xb5, 0x4b, 0xa1, 0x3d, 0xdf, 0x95, 0x67, 0x3c, 0xb0, 0x91, 0xd1, 0xbd,
-  0x81, 0x40, 0xc2, 0xbd, 0xda, 0xf2, 0x1d, 0x3d, 0x12, 0x6b, 0xb8, 0xbd,
-  0xfe, 0xf3, 0xe7, 0xbc, 0xf4, 0xbc, 0xad, 0xbb, 0x34, 0x18, 0xbc, 0x3b,
-  0x4b, 0x0b, 0x85, 0xbc, 0x8c, 0x98, 0x77, 0xbd, 0x5c, 0xf7, 0x44, 0xbe,
-  0xac, 0xb8, 0xcb, 0xbd, 0x26, 0x8f, 0x5d, 0xbd, 0x5d, 0x18, 0xf5, 0x3c,
-  0xc5, 0xfd, 0x1e, 0xbd, 0x19, 0x0b, 0x8b, 0xbc, 0x3c, 0x91, 0x9c, 0x3c,
-  0x4f, 0xc3, 0xce, 0xbd, 0x02, 0x5c, 0x09, 0xbe, 0x44, 0x30, 0x05, 0xbe,
-  0xf0, 0x28, 0x1b, 0xbe, 0x4b, 0xf0, 0x49, 0xbd, 0x28, 0x51, 0x3e, 0xbd,
-  0x54, 0xc1, 0xb7, 0xbd, 0x3a, 0x69, 0x39, 0xbc, 0x24, 0xe1, 0x23, 0xbd,
-  0x4f, 0xe7, 0x83, 0xbe, 0x49, 0xf5, 0x43, 0xbd, 0x0d, 0xc6, 0xe6, 0xbd,
-  0x38, 0xc9, 0x27, 0xbe, 0x41, 0x26, 0xe3, 0xbd, 0x02, 0x60, 0x73, 0xbe,
-  0x9c, 0x6c, 0x09, 0xbb, 0x72, 0x20, 0xda, 0xbd, 0x89, 0x2d, 0x46, 0xbe,
-  0x3f, 0x13, 0xbf, 0xbc, 0xed, 0x7c, 0x14, 0xbe, 0xc8, 0x6c, 0x31, 0xbe,
-  0xf3, 0x90, 0x25, 0xbd, 0x41, 0xbe, 0xfa, 0xbd, 0x91, 0x0f, 0xb6, 0xbd,
-  0x6d, 0x47, 0x0f, 0xbe, 0x62, 0x69, 0x97, 0xbd, 0x9f, 0xcc, 0xff, 0xbd,
-  0xb3, 0x02, 0x14, 0xbe, 0xdc, 0x5d, 0x3b, 0xbc, 0x7c, 0x26, 0x51, 0x3c,
-  0xe8, 0x48, 0x04, 0xbd, 0xf3, 0xa1, 0x1c, 0xbb, 0xcf, 0xb7, 0xb5, 0x3c,
-  0x6f, 0xfa, 0x9c, 0xbc, 0x1d, 0x78, 0xe5, 0xbd, 0xcc, 0xf5, 0x8a, 0x3c,
-  0x8e, 0xab, 0xf9, 0x3c, 0x41, 0x32, 0x1c, 0xbd, 0x85, 0xa8, 0xd5, 0x3b,
-  0xe8, 0xfd, 0xfb, 0xbc, 0xdf, 0x6b, 0x9a, 0x3d, 0x8c, 0x99, 0x14, 0xbc,
-  0xd5, 0x08, 0xb3, 0xbd, 0xc3, 0x8c, 0xc3, 0x3c, 0xe5, 0x85, 0xca, 0x3d,
-  0x34, 0xed, 0x9d, 0x3a, 0xb0, 0xc0, 0xee, 0x3b, 0x34, 0x5a, 0x10, 0xbc,
-  0x71, 0xc2, 0x82, 0xbd, 0xbc, 0x95, 0x84, 0xbc, 0xc6, 0x13, 0x7a, 0xbc,
-  0xed, 0x31, 0xa6, 0xbb, 0x83, 0xd4, 0x15, 0xbd, 0x89, 0x1a, 0xf3, 0xbc,
-  0x72, 0xe4, 0x2f, 0xbd, 0xea, 0xcf, 0x39, 0xbd, 0x4d, 0x66, 0x0a, 0x3d,
-  0x87, 0x01, 0x3c, 0x3d, 0x45, 0x71, 0x24, 0x3e, 0xa7, 0x4a, 0xc7, 0xbc,
-  0x2f, 0xbf, 0x73, 0xbd, 0x4e, 0x47, 0x1f, 0xbd, 0xe4, 0xc9, 0x17, 0xba,
-  0xed, 0xd7, 0xb0, 0x3d, 0x28, 0x43, 0xbc, 0x3c, 0x87, 0x1c, 0x5c, 0x3d,
-  0x54, 0x1b, 0x0f, 0x3e, 0x13, 0xa2, 0x8a, 0x3d, 0xd2, 0x18, 0x45, 0x3c,
-  0x85, 0x11, 0x78, 0x3c, 0xc5, 0xe5, 0xed, 0xbb, 0xe2, 0x3e, 0x67, 0x3b,
-  0x15, 0xfa, 0x59, 0xbd, 0xb8, 0x19, 0x2d, 0x3d, 0xd7, 0x12, 0x06, 0x3e,
-  0x73, 0xf2, 0xbc, 0xbb, 0xe0, 0x3b, 0x09, 0x3d, 0xe3, 0x2a, 0x0f, 0x3c,
-  0x67, 0x5e, 0x92, 0x3d, 0xb1, 0xb8, 0xe7, 0x3c, 0xc7, 0x02, 0x9d, 0xbd,
-  0xab, 0xfa, 0x2c, 0xbd, 0x51, 0xb9, 0x46, 0x3c, 0x14, 0xf9, 0xbb, 0x3c,
-  0x66, 0x1e, 0x7f, 0x3d, 0x9d, 0x53, 0x80, 0x3b, 0x26, 0x0a, 0x93, 0x3d,
-  0x2b, 0x0c, 0x2b, 0x3d, 0x62, 0x5b, 0x49, 0xbd, 0xeb, 0x9d, 0x5b, 0x3d,
-  0x3e, 0x32, 0x8f, 0xba, 0xc0, 0xe8, 0x49, 0x3c, 0x0c, 0x63, 0xe0, 0x3c,
-  0x82, 0xe5, 0x0b, 0xbe, 0xc1, 0x49, 0xa5, 0x3d, 0x73, 0xab, 0xfb, 0xbc,
-  0x85, 0xf2, 0x02, 0xbe, 0xe3, 0xd0, 0x2a, 0xbd, 0xae, 0x59, 0xc3, 0x3d,
-  0x68, 0xc9, 0x53, 0x3d, 0xda, 0x0d, 0x16, 0x3d, 0x37, 0x84, 0x8d, 0xbd,
-  0xe4, 0x22, 0x2d, 0x3b, 0x44, 0x5b, 0x06, 0x3d, 0xb4, 0x70, 0xe7, 0xbd,
-  0x0e, 0x0c, 0x22, 0xbd, 0x07, 0x43, 0xe3, 0xbd, 0x42, 0xc3, 0xcd, 0xbd,
-  0x49, 0x36, 0x41, 0x3d, 0x2c, 0x94, 0x97, 0xbd, 0xb8, 0xcd, 0xda, 0x3c,
-  0x85, 0x80, 0xe0, 0x3c, 0x2e, 0x7e, 0x91, 0xb9, 0x65, 0x73, 0x7c, 0xbe,
-  0x71, 0xf3, 0x62, 0xbe, 0x06, 0x0f, 0xe5, 0xbd, 0x53, 0x01, 0x58, 0x3d,
-  0x76, 0xa1, 0x5f, 0xbe, 0xd0, 0xbe, 0xe8, 0xbd, 0xf8, 0xdd, 0x74, 0xbd,
-  0x38, 0xa3, 0x91, 0xbd, 0x7f, 0x93, 0x2a, 0xbe, 0x2e, 0xa1, 0xb0, 0xbd,
-  0xce, 0x0b, 0x83, 0xbd, 0xfb, 0xe5, 0x3d, 0xbe, 0x2e, 0x2c, 0x14, 0xbe,
-  0xa9, 0x72, 0x5f, 0xbe, 0xfd, 0xe8, 0x0a, 0xbe, 0x6a, 0x87, 0xe0, 0xbd,
-  0x41, 0x32, 0x25, 0xbe, 0x09, 0xb4, 0xdb, 0xbd, 0x0e, 0x89, 0xe6, 0xbd,
-  0xe5, 0x14, 0x23, 0xbe, 0x62, 0x13, 0xb9, 0xbd, 0xce, 0xc4, 0x6c, 0xbb,
-  0x77, 0xf8, 0xb4, 0x3d, 0xdf, 0x9a, 0x7f, 0x3b, 0xe3, 0xac, 0x82, 0xbd,
-  0x98, 0xa2, 0x84, 0xbd, 0xb1, 0xec, 0x01, 0xbc, 0x90, 0x38, 0x0d, 0xbd,
-  0x06, 0xce, 0x06, 0xbd, 0x9c, 0x12, 0x80, 0x3b, 0x3d, 0x64, 0x67, 0xbd,
-  0x6f, 0x20, 0x3a, 0x3d, 0x5f, 0xda, 0x93, 0x3d, 0x13, 0xcb, 0x99, 0xbc,
-  0x53, 0x93, 0xb7, 0x3c, 0x25, 0x93, 0x8d, 0x3d, 0x5a, 0xad, 0x80, 0xbd,
-  0xf7, 0x1c, 0x32, 0xbd, 0xc8, 0x9c, 0x1f, 0x3d, 0x21, 0x77, 0x97, 0xbd,
-  0x4d, 0x16, 0x56, 0x3d, 0x11, 0x79, 0x00, 0x3e, 0x36, 0xee, 0x2f, 0x3d,
-  0x48, 0x32, 0x69, 0x3c, 0x27, 0xcf, 0xde, 0x3c, 0xc0, 0x81, 0xb4, 0xbd,
-  0x8a, 0x04, 0x44, 0xbd, 0x31, 0x57, 0xf9, 0xbd, 0x56, 0x69, 0xcb, 0x3c,
-  0xd5, 0xe0, 0x74, 0x3e, 0x1d, 0xd4, 0xac, 0xbd, 0x2e, 0x53, 0x77, 0xbd,
-  0xd4, 0x0a, 0x0e, 0x3d, 0x4b, 0x57, 0x2b, 0x3d, 0x33, 0x98, 0x7c, 0x3c,
-  0xb6, 0x34, 0xda, 0x3c, 0x33, 0xe4, 0x64, 0xbd, 0xbd, 0x14, 0x11, 0x3d,
-  0x17, 0xd8, 0x76, 0xbd, 0x10, 0xb0, 0xde, 0xba, 0x03, 0xd8, 0x65, 0x3d,
-  0x0b, 0x4f, 0x50, 0xbd, 0xc3, 0x6a, 0x95, 0x3d, 0xb2, 0x45, 0x1d, 0xbd,
-  0x94, 0x4f, 0xd5, 0xbc, 0x75, 0x99, 0x23, 0x3d, 0xc9, 0xda, 0x69, 0xbd,
-  0xf2, 0x60, 0x09, 0x3d, 0x37, 0x4c, 0xfe, 0xbb, 0xb0, 0xcb, 0x0b, 0x3d,
-  0x64, 0x80, 0x4d, 0xbd, 0xb6, 0x68, 0x9e, 0xbd, 0x1a, 0x41, 0x0a, 0x3d,
-  0x90, 0x69, 0x19, 0x3e, 0x62, 0x8c, 0x87, 0xbb, 0x1a, 0xd2, 0x89, 0x3c,
-  0x26, 0xab, 0x3d, 0xbd, 0x69, 0x5e, 0xcb, 0xbc, 0x57, 0x98, 0x90, 0xbd,
-  0x31, 0x36, 0xf0, 0xbc, 0xfe, 0x36, 0x1a, 0xbc, 0x0b, 0x50, 0xe3, 0x3c,
-  0x45, 0x71, 0xc6, 0xbd, 0x1e, 0x09, 0x99, 0xbb, 0x08, 0x51, 0x2a, 0xbe,
-  0xe0, 0x49, 0x8d, 0x3c, 0x65, 0x8a, 0x91, 0xbd, 0x1d, 0x9a, 0x93, 0x3a,
-  0x44, 0x29, 0x8e, 0xbd, 0x80, 0x8e, 0x82, 0x3c, 0xdb, 0x24, 0x68, 0xbd,
-  0x77, 0x08, 0xa5, 0xbd, 0xc8, 0xc4, 0x12, 0xbe, 0x63, 0xca, 0xe4, 0xbc,
-  0x03, 0xb8, 0x47, 0xbd, 0xc5, 0x34, 0xd2, 0x3b, 0xed, 0x36, 0xef, 0xbd,
-  0xb8, 0xce, 0xe2, 0xbd, 0xbd, 0x2c, 0xc3, 0xbd, 0x89, 0x7f, 0x4a, 0xbd,
-  0x28, 0x94, 0x53, 0xbe, 0x23, 0x93, 0x40, 0x3d, 0x80, 0x8d, 0x80, 0x3d,
-  0x31, 0xea, 0x59, 0x3c, 0x5a, 0x4e, 0x0e, 0xbe, 0xfb, 0xf5, 0xc3, 0xbe,
-  0x9b, 0x18, 0x96, 0xbd, 0xb1, 0xdc, 0xbd, 0x3c, 0x89, 0xb9, 0x40, 0xbe,
-  0x75, 0xff, 0xe2, 0xbd, 0x2a, 0x59, 0x5b, 0x3d, 0x69, 0x7b, 0xa0, 0xbd,
-  0x30, 0x6f, 0x91, 0xbd, 0x81, 0x91, 0x14, 0xbe, 0x04, 0x89, 0xe5, 0xbc,
-  0x5d, 0x5f, 0xc3, 0xbc, 0xcf, 0xec, 0xfe, 0xbd, 0xf6, 0x76, 0x5f, 0xbe,
-  0xa5, 0x95, 0x92, 0xbe, 0x9d, 0x1d, 0x22, 0xbe, 0x57, 0x40, 0x46, 0xbe,
-  0x83, 0x89, 0xaa, 0xbd, 0x91, 0x5d, 0x1b, 0xbe, 0xa0, 0xc7, 0x5a, 0xbe,
-  0xcf, 0x3f, 0x14, 0xbe, 0x0e, 0x24, 0x9f, 0xbd, 0x37, 0x79, 0xc1, 0xbc,
-  0x57, 0x64, 0x78, 0x3c, 0x8d, 0x55, 0x3d, 0xbc, 0x59, 0xf4, 0x34, 0x3c,
-  0x7c, 0x6e, 0x4c, 0x3a, 0x3b, 0x08, 0x84, 0xbd, 0x2b, 0x92, 0x27, 0x3d,
-  0x01, 0x15, 0x3b, 0x3d, 0x33, 0x51, 0xae, 0x3d, 0x11, 0x20, 0x80, 0xbd,
-  0x21, 0x17, 0x28, 0x3d, 0x65, 0x71, 0xec, 0x3d, 0x98, 0x89, 0x8a, 0x3d,
-  0x97, 0x46, 0x27, 0xbd, 0x0f, 0xbe, 0xf5, 0x3d, 0xe7, 0x7c, 0xd0, 0xbd,
-  0x85, 0x54, 0x60, 0xbc, 0xbd, 0x4d, 0xe9, 0xbd, 0x57, 0xfa, 0xd7, 0x3c,
-  0x8e, 0xd2, 0x0d, 0x3e, 0x94, 0x8f, 0xa4, 0xbd, 0xf6, 0x71, 0xce, 0xbd,
-  0xe6, 0x29, 0x3d, 0x3e, 0xb8, 0xfe, 0x54, 0xbe, 0x82, 0xd8, 0x8e, 0xbc,
-  0xb9, 0x37, 0xd3, 0xbd, 0xc9, 0xf7, 0xda, 0xbc, 0x75, 0xa0, 0x9e, 0x3e,
-  0xa1, 0x99, 0x56, 0xbd, 0xbf, 0xd8, 0xaa, 0xbd, 0x98, 0x46, 0xcd, 0xbd,
-  0x1f, 0x99, 0x27, 0xbe, 0x50, 0xc7, 0xc4, 0xbd, 0xa2, 0x3f, 0xd5, 0xbd,
-  0x03, 0xe5, 0x13, 0x3d, 0x1f, 0x25, 0x6a, 0x3e, 0xb3, 0x39, 0x03, 0xbb,
-  0xf3, 0x60, 0xbe, 0xbd, 0xa0, 0x4d, 0x26, 0xbe, 0xae, 0xc5, 0x12, 0xbe,
-  0x15, 0x9f, 0xd1, 0xbb, 0x27, 0x2f, 0xc1, 0xbd, 0x58, 0xe2, 0x20, 0x3d,
-  0x1b, 0x1b, 0x0f, 0x3e, 0x6c, 0x1f, 0x9a, 0xbc, 0x31, 0xae, 0xa2, 0xbc,
-  0xa4, 0xb6, 0x14, 0xbe, 0x59, 0xbd, 0xb0, 0xbd, 0xbd, 0x91, 0xf4, 0xbd,
-  0xfa, 0xea, 0xbf, 0xbd, 0x35, 0xa4, 0xac, 0x3c, 0xb2, 0x60, 0x34, 0x3e,
-  0x39, 0xaf, 0xa4, 0xbd, 0x77, 0x60, 0x5d, 0xbd, 0x4e, 0x89, 0x03, 0xbe,
-  0xb0, 0x32, 0x24, 0x3b, 0x5f, 0x48, 0x6c, 0xbd, 0xb4, 0xa5, 0x97, 0xbc,
-  0x33, 0x0f, 0x88, 0xbd, 0xbc, 0x6d, 0xb8, 0x3d, 0x5c, 0xe6, 0x99, 0xbd,
-  0xf3, 0x9a, 0x69, 0x3c, 0xcc, 0x92, 0x1c, 0xbe, 0x31, 0x7b, 0x28, 0xbc,
-  0xa7, 0x07, 0x73, 0xbd, 0x14, 0x60, 0x4d, 0x3d, 0x20, 0x6e, 0xe9, 0xbc,
-  0x03, 0xbb, 0x2c, 0xbd, 0xf9, 0x93, 0x8b, 0x39, 0xe9, 0x9e, 0x41, 0xbd,
-  0x06, 0x98, 0x60, 0xbe, 0xb0, 0x27, 0x31, 0x3d, 0x26, 0xde, 0xa1, 0x3c,
-  0xc7, 0x68, 0x63, 0x3d, 0x6d, 0x68, 0x91, 0xbd, 0x66, 0xc5, 0x6d, 0xbe,
-  0xe4, 0xdc, 0x6a, 0x3d, 0x5e, 0x4b, 0xbe, 0x3d, 0x29, 0x86, 0x84, 0xbe,
-  0x44, 0xab, 0x3c, 0xbb, 0x4b, 0x48, 0x77, 0x3a, 0x4f, 0xf0, 0xaa, 0x3b,
-  0x25, 0x28, 0x83, 0xbd, 0x48, 0x4a, 0x8a, 0xbe, 0xee, 0x06, 0xc9, 0x3c,
-  0x46, 0x82, 0xc0, 0xbc, 0xfc, 0xc6, 0x39, 0xbe, 0xc3, 0x9c, 0xbd, 0xba,
-  0x9a, 0x82, 0x0f, 0xbd, 0x5e, 0x10, 0xff, 0xbb, 0x45, 0x89, 0xc0, 0xbd,
-  0x10, 0x99, 0x26, 0xbe, 0x82, 0x75, 0x46, 0xbd, 0xdb, 0x1a, 0x82, 0xbc,
-  0x08, 0x0f, 0x83, 0xbc, 0x56, 0xa7, 0x13, 0xbe, 0xdf, 0xf2, 0x0a, 0xbe,
-  0x67, 0x21, 0xd2, 0xbc, 0x77, 0x28, 0x7a, 0xbe, 0x7a, 0xec, 0x03, 0xbd,
-  0xe7, 0x1e, 0xd4, 0xbd, 0xc5, 0xc9, 0x48, 0xbd, 0x91, 0x95, 0x6c, 0xbd,
-  0xe3, 0xef, 0x6c, 0xbd, 0xc2, 0xdb, 0x85, 0xbc, 0x3b, 0x4b, 0x84, 0xbd,
-  0x6c, 0xbd, 0x65, 0xbd, 0xe0, 0x53, 0xdd, 0xbd, 0x2d, 0x87, 0x4f, 0xbb,
-  0x3a, 0xc6, 0xc6, 0xbd, 0xc6, 0xf2, 0x4c, 0xbd, 0xc3, 0xeb, 0x00, 0xbe,
-  0x0c, 0x49, 0x4c, 0x3d, 0x8e, 0x64, 0xe5, 0xbc, 0xbb, 0x89, 0xc8, 0x3d,
-  0xb0, 0x4f, 0x46, 0x3e, 0x40, 0xc7, 0xdb, 0xbc, 0xa4, 0x1b, 0x01, 0xbe,
-  0x6a, 0xe3, 0x14, 0x3e, 0xdb, 0xff, 0x06, 0xbe, 0x7e, 0xe1, 0x18, 0xbe,
-  0xf6, 0xf6, 0xca, 0xbd, 0x8e, 0x8b, 0x30, 0x3e, 0x54, 0xc6, 0xb7, 0x3e,
-  0x75, 0x18, 0xa2, 0xbd, 0x9c, 0x03, 0x6c, 0xbe, 0xf1, 0xde, 0xae, 0x3e,
-  0x5f, 0x75, 0x9d, 0xbe, 0x1f, 0x51, 0xa1, 0xbd, 0x45, 0x91, 0x09, 0xbe,
-  0xe4, 0xda, 0x09, 0x3d, 0xf2, 0x16, 0xe1, 0x3e, 0x6f, 0xac, 0x09, 0xbe,
-  0x4f, 0xa0, 0x44, 0xbe, 0xbe, 0x48, 0x58, 0x3e, 0x85, 0x20, 0x77, 0xbe,
-  0xa3, 0x05, 0x22, 0xbe, 0x41, 0xbc, 0x48, 0xbe, 0xef, 0xb2, 0x9b, 0x3d,
-  0x67, 0x11, 0xb1, 0x3e, 0xf6, 0xdf, 0x06, 0xbe, 0x83, 0x6b, 0x1c, 0xbe,
-  0x16, 0xfd, 0x0b, 0x3e, 0x3f, 0xc8, 0xff, 0xbd, 0xa7, 0x97, 0x5e, 0xbe,
-  0xcb, 0x2c, 0x57, 0xbe, 0x51, 0x0c, 0x50, 0xbb, 0xde, 0xc8, 0x95, 0x3e,
-  0xf8, 0x2a, 0x34, 0xbe, 0xcc, 0xf5, 0x66, 0xbe, 0x75, 0xc0, 0xc8, 0x3d,
-  0xc4, 0x64, 0x6f, 0xbe, 0x6f, 0x36, 0x42, 0xbe, 0x35, 0xe2, 0x2f, 0xbe,
-  0x0e, 0x23, 0xa7, 0xbd, 0x6e, 0x61, 0x15, 0x3e, 0x63, 0xfc, 0xe2, 0xbd,
-  0xf3, 0x7d, 0x10, 0xbe, 0xb3, 0x21, 0x2d, 0xbe, 0x34, 0x71, 0x2a, 0xbe,
-  0x5d, 0x1f, 0x06, 0xbe, 0x7c, 0x6b, 0xd8, 0xbd, 0x5d, 0x5d, 0xa1, 0xbd,
-  0x6f, 0x74, 0x4c, 0x3d, 0x57, 0xab, 0x07, 0xbe, 0xc7, 0x3f, 0xf9, 0xbd,
-  0x89, 0xf8, 0xa3, 0xbe, 0x1c, 0x03, 0x53, 0xbd, 0x48, 0x11, 0xb2, 0xbc,
-  0x0d, 0x4e, 0x05, 0x3d, 0x0c, 0xa7, 0x2f, 0xbe, 0x78, 0x85, 0x50, 0xbe,
-  0x42, 0x48, 0x1a, 0x3d, 0xae, 0x33, 0xdc, 0x3b, 0xc0, 0x90, 0x98, 0xbe,
-  0x11, 0x61, 0x7d, 0xbd, 0x3d, 0x27, 0x51, 0x3d, 0xf6, 0xfb, 0x47, 0x3d,
-  0x2e, 0x57, 0x37, 0xbd, 0xcc, 0x74, 0x95, 0xbe, 0xcd, 0x42, 0xc0, 0x3b,
-  0x1f, 0xa2, 0xa6, 0x3d, 0x1e, 0xbe, 0x6f, 0xbe, 0x62, 0x55, 0x3f, 0xbd,
-  0xc6, 0x89, 0xf0, 0xb7, 0x0f, 0x19, 0x8e, 0x39, 0xfa, 0xbb, 0x08, 0x3d,
-  0x02, 0xa2, 0x6b, 0xbe, 0x5a, 0xf3, 0xa0, 0x3b, 0xa0, 0x98, 0x86, 0x3c,
-  0x89, 0x3c, 0x10, 0x3d, 0xcd, 0xdd, 0xf0, 0xbd, 0x4f, 0xdb, 0xcf, 0xbc,
-  0x55, 0xff, 0x8a, 0x3d, 0x09, 0x15, 0x22, 0x3d, 0x5b, 0x95, 0x6a, 0xbc,
-  0x5e, 0xe6, 0x45, 0x3d, 0x17, 0xca, 0x69, 0xbc, 0x97, 0x3c, 0x57, 0x3e,
-  0x04, 0xdd, 0xe5, 0x3d, 0x86, 0xd0, 0xbd, 0x3d, 0x3a, 0x16, 0x6a, 0x3e,
-  0xb1, 0x03, 0x3b, 0x3d, 0x16, 0xf0, 0xff, 0xbd, 0x75, 0x57, 0xe4, 0x3d,
-  0x85, 0x21, 0x30, 0x3e, 0x77, 0x37, 0xcc, 0x3b, 0xd6, 0xbb, 0xb8, 0x3c,
-  0x32, 0x45, 0x2f, 0xbe, 0xc3, 0xff, 0xdf, 0xbd, 0x01, 0xa6, 0xb3, 0xbd,
-  0x2c, 0x83, 0xdd, 0xbb, 0x89, 0x00, 0x19, 0xbe, 0x4f, 0xc2, 0x85, 0xbd,
-  0xaf, 0xd9, 0x31, 0x3e, 0x8b, 0x4c, 0x62, 0xbd, 0x88, 0x03, 0x31, 0xbe,
-  0x2e, 0x61, 0x36, 0xbe, 0x7f, 0x63, 0x81, 0xbd, 0x5b, 0x2a, 0xe2, 0x3d,
-  0xd1, 0x86, 0x38, 0xbe, 0x1a, 0x6c, 0x3d, 0xbe, 0x2e, 0xa5, 0xf8, 0x3e,
-  0xb0, 0xa2, 0xd4, 0xbd, 0xfa, 0xfe, 0x32, 0xbe, 0xdd, 0xa3, 0x23, 0xbe,
-  0x7a, 0xc2, 0xcb, 0xbd, 0x06, 0xb6, 0x56, 0x3e, 0xc4, 0x58, 0x14, 0xbe,
-  0x84, 0x07, 0x25, 0xbe, 0x92, 0x5d, 0xe6, 0x3e, 0x48, 0x67, 0x38, 0xbe,
-  0x35, 0x46, 0xbd, 0xbd, 0x07, 0x72, 0x93, 0xbd, 0x6d, 0x0a, 0x1c, 0xbd,
-  0xee, 0xb8, 0x20, 0x3e, 0x38, 0x81, 0x92, 0xbc, 0xce, 0xd7, 0xd7, 0xbd,
-  0x5e, 0x41, 0x91, 0x3e, 0x5e, 0x5e, 0x0e, 0xbe, 0xf4, 0x2f, 0xd1, 0xbd,
-  0x6f, 0x85, 0x2f, 0xbd, 0xdf, 0x29, 0xb0, 0xbd, 0x52, 0xef, 0xe6, 0x3d,
-  0xd1, 0xed, 0xec, 0xbc, 0x61, 0xf4, 0xdc, 0xbd, 0x04, 0x20, 0x96, 0x3e,
-  0x27, 0xc9, 0x8d, 0xbd, 0x2b, 0x28, 0xe5, 0xbd, 0x64, 0xc8, 0x0a, 0xbd,
-  0x87, 0x55, 0x71, 0xbd, 0x47, 0x63, 0xc4, 0x3c, 0x3e, 0x56, 0xcd, 0xbd,
-  0x28, 0xfd, 0xc5, 0xbd, 0x34, 0x31, 0x0d, 0x3e, 0x4a, 0x80, 0x22, 0xbd,
-  0xb8, 0xf2, 0x81, 0xbd, 0xa6, 0xc7, 0x1d, 0xbc, 0xdf, 0xb9, 0xe5, 0xbc,
-  0x88, 0x1a, 0x08, 0xbe, 0x09, 0x97, 0x7c, 0xbd, 0xed, 0xcd, 0x22, 0xbc,
-  0xda, 0x1b, 0xb4, 0x3c, 0x8c, 0xc5, 0x1c, 0xbe, 0xc9, 0xe8, 0xb5, 0xbd,
-  0x23, 0x00, 0x77, 0xbd, 0x1c, 0xea, 0xbb, 0xbd, 0x2c, 0xe9, 0x82, 0xbe,
-  0xc9, 0x69, 0xd1, 0xbd, 0x3c, 0xc8, 0x60, 0xbd, 0xa8, 0xd0, 0x32, 0xbd,
-  0xf1, 0x30, 0x19, 0xbe, 0x50, 0x57, 0x9e, 0x3c, 0xbc, 0x83, 0x02, 0x3c,
-  0xa6, 0xea, 0x79, 0xbd, 0x04, 0x1d, 0x66, 0xbe, 0xd6, 0xec, 0x51, 0xbd,
-  0x16, 0xf9, 0xb4, 0xbd, 0xff, 0x0f, 0x54, 0xbe, 0x11, 0x9a, 0x31, 0xbe,
-  0xdd, 0x3d, 0x78, 0xbd, 0xa3, 0x9d, 0x22, 0x3d, 0x08, 0x6f, 0x37, 0x3c,
-  0xd2, 0x24, 0x71, 0xbe, 0x36, 0xf9, 0x97, 0x3d, 0x2f, 0xde, 0x8b, 0x3c,
-  0x26, 0xb7, 0x53, 0xbd, 0xb9, 0x87, 0xeb, 0xbd, 0x60, 0xb0, 0x3a, 0xb6,
-  0xd4, 0x00, 0x17, 0xbd, 0x48, 0xfd, 0xaf, 0x3d, 0xfe, 0xe0, 0x4e, 0xbd,
-  0x70, 0x09, 0xee, 0x3c, 0x28, 0x8d, 0xb0, 0xbd, 0xab, 0x0c, 0x3c, 0x3e,
-  0xe8, 0xf1, 0x20, 0xbd, 0xbd, 0x0d, 0x12, 0xbd, 0x44, 0xe4, 0x3a, 0xbd,
-  0x71, 0xa8, 0x1d, 0x3e, 0x9c, 0xa0, 0x0c, 0x3e, 0x6c, 0x6a, 0x98, 0x3d,
-  0x33, 0xf5, 0xf4, 0xbc, 0xa9, 0x00, 0x33, 0x3e, 0x47, 0x4b, 0x1e, 0x3e,
-  0x3f, 0x89, 0x1f, 0x3e, 0x12, 0xd4, 0x45, 0x3e, 0x52, 0x5d, 0x48, 0x3e,
-  0x48, 0x6f, 0x31, 0x3d, 0x81, 0xe0, 0x47, 0x3e, 0x2b, 0x20, 0x68, 0x3e,
-  0xa3, 0xa6, 0x51, 0xbd, 0xee, 0x1f, 0xc0, 0x3d, 0x36, 0xfc, 0x3a, 0x3c,
-  0xff, 0x90, 0xf0, 0x3c, 0xc4, 0x55, 0x14, 0xbe, 0x1e, 0x0d, 0x61, 0xbd,
-  0x10, 0x38, 0xb3, 0xbc, 0xde, 0x7a, 0xcb, 0x3d, 0x7f, 0x97, 0x65, 0x3d,
-  0x22, 0x3f, 0xd5, 0x3c, 0xdd, 0x10, 0x0f, 0xbd, 0x65, 0x48, 0x1c, 0x3c,
-  0x8e, 0x8d, 0x23, 0xbe, 0xf1, 0xd9, 0x22, 0xbe, 0xbc, 0x5a, 0xfa, 0xbc,
-  0x9b, 0x5f, 0x02, 0x3d, 0x61, 0xe3, 0x36, 0x3e, 0xa2, 0x4c, 0x61, 0xbd,
-  0xea, 0x03, 0x15, 0x3b, 0x63, 0xb7, 0xa8, 0x3c, 0xe5, 0x82, 0x8f, 0xbd,
-  0x83, 0xa1, 0x76, 0xbe, 0x10, 0x0a, 0x4c, 0x3d, 0x62, 0x04, 0x7d, 0x3c,
-  0x55, 0x33, 0xf5, 0x3d, 0x1c, 0xf8, 0x0a, 0xbe, 0xaf, 0xea, 0xe1, 0xbc,
-  0xc0, 0xb7, 0x9b, 0xbc, 0x8f, 0x5c, 0xb2, 0xbc, 0xfb, 0xcf, 0x60, 0xbe,
-  0x20, 0x72, 0x23, 0x3d, 0x34, 0x48, 0x5b, 0xbd, 0x95, 0x9e, 0xc5, 0x3d,
-  0x62, 0x49, 0x08, 0xbd, 0x3c, 0xc8, 0xbc, 0xbd, 0x81, 0x0c, 0xe7, 0x3d,
-  0x35, 0xe5, 0xd4, 0xbc, 0x87, 0x98, 0x8c, 0xbe, 0x1b, 0x68, 0x53, 0x3d,
-  0xc9, 0x45, 0x1a, 0xbd, 0x7f, 0x4a, 0x26, 0x3e, 0x9b, 0xd0, 0x35, 0x3d,
-  0xca, 0x61, 0x21, 0x3c, 0x6d, 0xb8, 0xd6, 0x3d, 0x60, 0xa2, 0x7c, 0x3c,
-  0x1c, 0x16, 0x83, 0xbe, 0xc9, 0xfb, 0x6e, 0x3d, 0x50, 0xbb, 0xcc, 0x3d,
-  0x1a, 0xdb, 0xa2, 0x3d, 0x45, 0x9e, 0x8b, 0xbb, 0x98, 0x3c, 0xb6, 0x3c,
-  0x93, 0x3b, 0xe9, 0x3d, 0x64, 0x77, 0xce, 0x3d, 0x82, 0xc0, 0x64, 0xbe,
-  0x5e, 0x9d, 0xf7, 0x3c, 0x05, 0x1a, 0xf9, 0x3c, 0x1f, 0x5e, 0x1b, 0x3d,
-  0xa4, 0x81, 0x98, 0xbd, 0xec, 0xa0, 0xa8, 0x3c, 0xfb, 0xe6, 0x5e, 0xbd,
-  0xb3, 0xdc, 0x73, 0x3b, 0x56, 0x86, 0x67, 0xbe, 0xae, 0x2e, 0x20, 0xbd,
-  0x29, 0x86, 0x2e, 0xbd, 0x96, 0x3b, 0x0d, 0xbd, 0x32, 0xc6, 0xaf, 0xbd,
-  0x07, 0xb5, 0xcb, 0xbd, 0x57, 0x07, 0x83, 0x3d, 0x5d, 0x1e, 0xbd, 0x3c,
-  0xf1, 0xef, 0x8a, 0xbe, 0xbe, 0x55, 0x3c, 0xbd, 0xc6, 0x24, 0x4a, 0xbc,
-  0x0a, 0xaa, 0x4a, 0x3c, 0x7b, 0x51, 0xc6, 0xbd, 0x8a, 0x72, 0xa8, 0xbd,
-  0xc5, 0xd3, 0x32, 0x3d, 0xfa, 0xd2, 0x08, 0x3d, 0x8f, 0x35, 0x97, 0xbd,
-  0x91, 0x38, 0x3b, 0xbb, 0xff, 0x57, 0x02, 0xbd, 0xf2, 0xa5, 0x75, 0x3e,
-  0x9f, 0xfe, 0xbc, 0xbd, 0x68, 0x0c, 0x99, 0xbd, 0xdd, 0xfa, 0xb1, 0xbd,
-  0xf2, 0xdb, 0xac, 0x3c, 0xdf, 0xfb, 0x41, 0x3e, 0x06, 0xa3, 0x39, 0x3d,
-  0x20, 0x9c, 0xd1, 0x3a, 0x03, 0x0d, 0x47, 0x3e, 0x95, 0xb0, 0xeb, 0xbc,
-  0xac, 0x75, 0x88, 0xbd, 0x1c, 0x51, 0x5c, 0xbd, 0x29, 0xa7, 0x11, 0x3e,
-  0xdc, 0xf0, 0x98, 0x3e, 0xf2, 0x22, 0x19, 0x3d, 0xcd, 0x3f, 0x24, 0x3d,
-  0x31, 0x29, 0x67, 0x3e, 0x8d, 0x4e, 0x66, 0x3e, 0xce, 0x97, 0xad, 0x3d,
-  0x4e, 0x4c, 0x63, 0x3e, 0xb6, 0xe0, 0x39, 0x3e, 0x75, 0xbd, 0x86, 0x3d,
-  0x9b, 0x6c, 0x07, 0x3e, 0x43, 0xf6, 0x68, 0x3e, 0x9b, 0x92, 0x3d, 0xbb,
-  0x7a, 0x1e, 0x95, 0x3c, 0xbf, 0x65, 0x99, 0x3d, 0xde, 0x68, 0x1f, 0x3d,
-  0xee, 0x76, 0x0e, 0x3e, 0x4e, 0x51, 0x4a, 0xbc, 0xcf, 0x76, 0xf1, 0x3c,
-  0xe5, 0x54, 0x8c, 0x3c, 0x3d, 0x8c, 0x74, 0xbd, 0x2d, 0x5c, 0xc3, 0x3d,
-  0x00, 0x99, 0x11, 0xbd, 0xc3, 0x4c, 0x59, 0x3d, 0x9d, 0xc6, 0x23, 0x3d,
-  0x29, 0xad, 0x9e, 0xbd, 0x52, 0x19, 0x8f, 0x3d, 0x57, 0x64, 0x93, 0x3d,
-  0x08, 0xb2, 0xe5, 0xbc, 0xda, 0x63, 0x90, 0x3d, 0x3e, 0x23, 0x24, 0xbd,
-  0xaf, 0x29, 0xd0, 0x3c, 0xaf, 0xee, 0xcd, 0x3d, 0xd6, 0x4e, 0x74, 0xbe,
-  0x48, 0x27, 0x61, 0x3d, 0xb9, 0x22, 0xdb, 0x3d, 0x86, 0x51, 0x00, 0x3e,
-  0xaf, 0xdb, 0x63, 0xbd, 0x8b, 0x5e, 0xb2, 0x3d, 0x47, 0x5f, 0xb7, 0x3c,
-  0x60, 0x54, 0x91, 0x3d, 0x33, 0x43, 0x72, 0xbe, 0xd8, 0x83, 0xb0, 0x3d,
-  0x51, 0xd1, 0xc7, 0x3b, 0x92, 0x64, 0x08, 0xbd, 0x62, 0x3c, 0x88, 0xbd,
-  0x42, 0x12, 0xe3, 0xbb, 0x56, 0x99, 0xbd, 0x3d, 0x76, 0xf7, 0x30, 0x3d,
-  0x7a, 0xeb, 0x93, 0xbe, 0x12, 0x95, 0xe8, 0x3d, 0xef, 0xdd, 0x25, 0x3d,
-  0xee, 0xa6, 0x38, 0xbd, 0xb3, 0x2f, 0x50, 0x3d, 0x69, 0xf3, 0xd5, 0x3d,
-  0x2f, 0x10, 0x36, 0x3e, 0x06, 0x9d, 0x28, 0x3d, 0x29, 0xab, 0x60, 0xbe,
-  0x1d, 0xc7, 0xcf, 0x3d, 0x9e, 0x48, 0x8d, 0x3d, 0x90, 0xf3, 0xb9, 0xbb,
-  0xf8, 0x57, 0x9d, 0x3d, 0x55, 0x4e, 0xbe, 0x3c, 0x2b, 0x4c, 0x96, 0x3d,
-  0x4e, 0x7e, 0xf5, 0x3d, 0xb7, 0xd7, 0x03, 0xbd, 0x0d, 0x3e, 0xb0, 0x3d,
-  0xaa, 0x73, 0xa2, 0xbc, 0x6a, 0x0c, 0x90, 0x3d, 0xf4, 0xc8, 0xb5, 0xbc,
-  0xa3, 0x16, 0x7c, 0xbd, 0x61, 0x5d, 0x05, 0x3d, 0x63, 0x96, 0xd3, 0xbc,
-  0xbb, 0x32, 0x0f, 0xbe, 0x28, 0x8a, 0x5a, 0xbc, 0xbf, 0x0f, 0x97, 0xbd,
-  0x25, 0x17, 0xd3, 0x3b, 0x31, 0x63, 0xc4, 0xbc, 0x17, 0x10, 0x54, 0xbc,
-  0xdf, 0x19, 0x13, 0x3c, 0x70, 0x3f, 0xe1, 0xbb, 0xa2, 0x77, 0xd2, 0xbd,
-  0x85, 0x24, 0xd0, 0xbd, 0x80, 0x68, 0x8a, 0xbc, 0x08, 0x50, 0x14, 0x3e,
-  0x24, 0x79, 0x01, 0xbd, 0x38, 0x64, 0xab, 0xbd, 0x3f, 0x3c, 0x1b, 0xbd,
-  0xed, 0xa8, 0x32, 0x3d, 0x58, 0xe0, 0x1c, 0x3e, 0xd3, 0x42, 0xd9, 0xbc,
-  0x90, 0x76, 0x00, 0xbd, 0xc2, 0x0f, 0x23, 0x3e, 0xa8, 0x4b, 0x6a, 0xbd,
-  0x2c, 0x86, 0x51, 0xbd, 0x9f, 0x62, 0x9c, 0xbd, 0xe3, 0x0d, 0x98, 0x3d,
-  0xce, 0x09, 0x98, 0x3e, 0x2d, 0x6c, 0x4a, 0xbd, 0x3f, 0x06, 0x04, 0xbd,
-  0x76, 0xa9, 0x80, 0x3e, 0x93, 0x75, 0x30, 0xbd, 0xe8, 0x71, 0x0e, 0xbd,
-  0xce, 0x55, 0x13, 0xbd, 0xbe, 0x07, 0xa6, 0x3c, 0xf0, 0x2f, 0x56, 0x3e,
-  0x9f, 0x00, 0x99, 0x3c, 0x29, 0xca, 0xf0, 0x3c, 0x0a, 0x26, 0x25, 0x3e,
-  0xd1, 0x4a, 0xaf, 0x3d, 0xab, 0x09, 0x88, 0x3d, 0xf5, 0x18, 0x28, 0x3e,
-  0xfd, 0x3c, 0x4f, 0x3e, 0x27, 0xfd, 0xee, 0x3d, 0x85, 0xbe, 0x12, 0x3e,
-  0xb2, 0xc5, 0xd5, 0x3d, 0x6e, 0x5e, 0xba, 0xbb, 0x33, 0xbe, 0x8d, 0x3c,
-  0x78, 0x25, 0xb1, 0x3d, 0xca, 0xef, 0xe1, 0xbc, 0x68, 0x60, 0xfd, 0x3c,
-  0xea, 0x73, 0x29, 0xbd, 0x41, 0x6a, 0x85, 0x3c, 0xb9, 0xd3, 0xcb, 0x3c,
-  0x41, 0xe9, 0x87, 0xbc, 0x50, 0x2f, 0x25, 0x3d, 0x72, 0x4b, 0x13, 0x3d,
-  0xb6, 0x32, 0x76, 0x3d, 0x99, 0xa3, 0x65, 0xbc, 0x38, 0xe2, 0x99, 0xbd,
-  0x59, 0x3f, 0xbf, 0x3d, 0x40, 0x58, 0x23, 0x3d, 0x44, 0x6b, 0x2a, 0xbd,
-  0x82, 0xa5, 0x19, 0x3d, 0xcf, 0xcc, 0x9f, 0x3d, 0xd0, 0x09, 0x36, 0x3d,
-  0x8d, 0xd5, 0x91, 0xbb, 0xa7, 0x6a, 0xaa, 0xbd, 0xf6, 0x7d, 0xbf, 0x3d,
-  0x5a, 0x53, 0x8e, 0x3d, 0xa5, 0x3f, 0xb7, 0xbd, 0xa4, 0x8c, 0x8c, 0x3d,
-  0xcb, 0x32, 0xc3, 0x3d, 0x94, 0x8d, 0x2d, 0x3d, 0x5e, 0xa0, 0xbf, 0x3d,
-  0x51, 0x07, 0xd8, 0xbd, 0x58, 0x9e, 0xb0, 0x3c, 0xb0, 0x31, 0x98, 0x3d,
-  0xe1, 0x5d, 0xab, 0xbc, 0x3f, 0xad, 0x8e, 0xbc, 0x70, 0x8f, 0xb1, 0x3d,
-  0x97, 0x83, 0x6d, 0x3d, 0xb5, 0x1c, 0x93, 0x3d, 0x41, 0xba, 0x52, 0xbe,
-  0xf7, 0xd5, 0x12, 0x3e, 0x73, 0xa5, 0xdc, 0x3d, 0x7e, 0x6d, 0xa4, 0xbd,
-  0x71, 0xab, 0x01, 0x3d, 0x2c, 0xa9, 0xcf, 0x3d, 0xb6, 0xca, 0xcc, 0x3d,
-  0xfb, 0xae, 0x8e, 0x3c, 0xdd, 0x89, 0xc4, 0xbd, 0x1c, 0xec, 0xc4, 0x3d,
-  0x7f, 0x2b, 0xc5, 0x3d, 0xf1, 0x0f, 0xbc, 0x3d, 0xa8, 0x26, 0xff, 0x3b,
-  0xe9, 0x39, 0x0d, 0x3d, 0x07, 0xb8, 0xb4, 0xbc, 0xc7, 0x54, 0x9b, 0x3d,
-  0xb0, 0xd5, 0x0c, 0x3d, 0x18, 0x60, 0x8d, 0x3d, 0xf8, 0xa1, 0x10, 0x3d,
-  0x07, 0x9f, 0x28, 0x3e, 0x3e, 0x58, 0x3c, 0x3d, 0xfe, 0x2f, 0x4d, 0x3d,
-  0xec, 0xf2, 0x3f, 0xbc, 0xd9, 0x4e, 0x82, 0x3d, 0x01, 0x27, 0x6d, 0x3d,
-  0xcc, 0x1a, 0xb3, 0x3c, 0x51, 0x0e, 0x48, 0x3d, 0xc7, 0x18, 0x6c, 0x3e,
-  0x0a, 0x6a, 0xbd, 0x3d, 0x11, 0xc9, 0x83, 0x3c, 0xd7, 0x22, 0x94, 0xbd,
-  0x5c, 0x12, 0x00, 0x3d, 0xa3, 0xec, 0x3a, 0x3e, 0x63, 0x6d, 0xc4, 0xbb,
-  0xd9, 0x46, 0x32, 0x3d, 0xa9, 0x28, 0xa1, 0x3e, 0x6c, 0x8f, 0x42, 0x3d,
-  0xf4, 0x75, 0x0d, 0xbd, 0xf1, 0xe9, 0x1a, 0xbc, 0x3b, 0x38, 0x31, 0xbc,
-  0xcf, 0x4c, 0xad, 0x3e, 0xe9, 0xbf, 0xfb, 0xbc, 0x35, 0x71, 0x8f, 0xbc,
-  0xe9, 0x43, 0x93, 0x3e, 0x63, 0xd1, 0x5d, 0x3d, 0x69, 0x15, 0xbf, 0xbd,
-  0x27, 0x90, 0x01, 0xbe, 0xa5, 0xbd, 0xa2, 0xba, 0x61, 0xc8, 0x71, 0x3e,
-  0xf0, 0x08, 0xbc, 0xbd, 0xe4, 0x26, 0x2b, 0x3d, 0x5c, 0xaa, 0xb4, 0x3e,
-  0xfa, 0xe7, 0xef, 0x3c, 0xdb, 0x0b, 0x1b, 0xbd, 0x70, 0x00, 0xdc, 0xbd,
-  0xb8, 0x48, 0x1d, 0x3d, 0xe7, 0x07, 0x18, 0x3e, 0xdc, 0x12, 0x2d, 0x3c,
-  0x22, 0xec, 0x4d, 0xbc, 0x62, 0xd2, 0x82, 0x3d, 0x77, 0xee, 0xbb, 0x3c,
-  0xee, 0xcb, 0x01, 0x3d, 0x00, 0x21, 0xee, 0x3d, 0xd8, 0xd5, 0xc6, 0x3d,
-  0x1e, 0x0f, 0x24, 0xbd, 0x11, 0x25, 0x64, 0x3d, 0xab, 0x64, 0xb5, 0x3d,
-  0x0b, 0x75, 0x03, 0xbd, 0x44, 0xb1, 0x5c, 0xbd, 0x43, 0x24, 0x7e, 0x3c,
-  0xe0, 0x2e, 0x05, 0x3d, 0xd5, 0xd7, 0x46, 0x3d, 0x1c, 0xa6, 0xaa, 0xbd,
-  0x16, 0x03, 0x82, 0x3d, 0x53, 0x33, 0x8c, 0x3d, 0xd2, 0x96, 0x14, 0xbe,
-  0x3c, 0xa8, 0xac, 0x3d, 0x1e, 0x22, 0x6e, 0xbc, 0xe3, 0xb0, 0x21, 0x3d,
-  0xdb, 0x40, 0xb9, 0x3d, 0xdf, 0x30, 0x93, 0xba, 0xe6, 0xfa, 0x88, 0x3d,
-  0xb1, 0x3d, 0xcf, 0x3d, 0x64, 0x58, 0x2d, 0xbe, 0xa0, 0xd0, 0x92, 0x3d,
-  0x33, 0x24, 0x4d, 0x3d, 0x87, 0x1a, 0x24, 0xbc, 0x64, 0x59, 0x49, 0x3d,
-  0x70, 0xa0, 0x0d, 0xbe, 0x03, 0x1b, 0x46, 0x3a, 0x9a, 0x8a, 0xbb, 0xbc,
-  0xb3, 0x8e, 0x60, 0xbe, 0x9c, 0x05, 0xb8, 0xbc, 0x25, 0x48, 0x90, 0x3d,
-  0x0c, 0xa5, 0x99, 0x3d, 0x9b, 0xf4, 0x28, 0xbc, 0xcf, 0x4b, 0x6c, 0xbd,
-  0x2e, 0xe0, 0x9f, 0x3d, 0x00, 0x65, 0x07, 0x3d, 0x01, 0x64, 0x2d, 0xbe,
-  0xb5, 0xfb, 0xf5, 0x3b, 0xad, 0xf2, 0xe3, 0x3d, 0x02, 0x51, 0x1f, 0x39,
-  0xad, 0x6f, 0xbd, 0x3d, 0x82, 0x71, 0xe6, 0xbd, 0xe2, 0xb2, 0xc3, 0x3c,
-  0x80, 0x4f, 0x70, 0x3d, 0xd3, 0xfe, 0xf4, 0xbd, 0xda, 0x5b, 0x27, 0xbd,
-  0x76, 0x9a, 0xcc, 0x3b, 0xde, 0x0e, 0xb9, 0xbc, 0x10, 0x31, 0xb7, 0x3c,
-  0x7e, 0x62, 0xac, 0xbd, 0x8a, 0xc8, 0x3e, 0x3d, 0xa7, 0x24, 0xcc, 0x3b,
-  0x27, 0xf9, 0x71, 0x3d, 0xa6, 0x98, 0xf6, 0xbd, 0x90, 0xd5, 0x6c, 0x3d,
-  0x86, 0xd1, 0xd7, 0xbc, 0x94, 0x7b, 0x74, 0xbd, 0xe7, 0xfa, 0x17, 0xbd,
-  0xbb, 0x31, 0xda, 0xbc, 0x52, 0x3b, 0xe5, 0xbc, 0x14, 0x7c, 0xe7, 0xbc,
-  0x42, 0xf6, 0x8e, 0xbb, 0x2d, 0x0a, 0x89, 0xbc, 0xe4, 0x10, 0xe7, 0xbd,
-  0x00, 0xec, 0x14, 0x3d, 0x85, 0xc8, 0xdd, 0x3d, 0xff, 0xae, 0x55, 0xbc,
-  0x81, 0xe3, 0x84, 0x3c, 0x8e, 0x16, 0x1d, 0x3e, 0xe4, 0x47, 0x68, 0x3d,
-  0x76, 0x0d, 0x48, 0xbb, 0x77, 0x91, 0x0f, 0x3d, 0x8b, 0x33, 0x61, 0x3d,
-  0x12, 0xdf, 0x56, 0x3e, 0xe8, 0x00, 0x1e, 0x3d, 0xfe, 0x17, 0x8c, 0x3d,
-  0xb6, 0x8d, 0x86, 0x3e, 0x6d, 0x58, 0x11, 0x3e, 0x51, 0x2c, 0xe2, 0x3d,
-  0x1d, 0xbe, 0xfb, 0xbc, 0xe8, 0x4e, 0x06, 0x3e, 0x2b, 0xae, 0x24, 0x3e,
-  0xce, 0x12, 0xe8, 0x3c, 0xa2, 0x7c, 0x9b, 0x3d, 0x2d, 0x91, 0xd6, 0x3e,
-  0x96, 0x93, 0x92, 0x3d, 0xa9, 0x61, 0x80, 0x3c, 0x03, 0xee, 0xc6, 0xbc,
-  0x73, 0x27, 0x81, 0xbc, 0xb9, 0xe3, 0x1a, 0x3e, 0x9e, 0xe8, 0xb2, 0xbd,
-  0x94, 0x16, 0xe8, 0xbc, 0x8e, 0xa1, 0x96, 0x3e, 0x79, 0x8c, 0x6d, 0xbc,
-  0xda, 0x7e, 0x7c, 0x3c, 0xb6, 0x54, 0x7e, 0x3c, 0x2e, 0x43, 0xdd, 0xbb,
-  0x7a, 0x90, 0x8b, 0x3d, 0x45, 0x3b, 0xb4, 0xbc, 0xdf, 0x72, 0xc3, 0x3d,
-  0x59, 0x83, 0x12, 0xbd, 0xf5, 0xbe, 0x87, 0x3d, 0x2d, 0x50, 0xbd, 0x3c,
-  0x2b, 0xc9, 0xfd, 0x3c, 0x85, 0x7c, 0x99, 0x3c, 0x5b, 0x82, 0xeb, 0xbd,
-  0x86, 0x4a, 0xab, 0x3d, 0xbb, 0x26, 0x93, 0x3d, 0x1e, 0xcd, 0x40, 0xbd,
-  0xbe, 0x7f, 0x28, 0xbe, 0xf2, 0x7c, 0x3e, 0xbc, 0x68, 0x60, 0xe5, 0xbc,
-  0x27, 0x6e, 0xda, 0x3d, 0x5d, 0xde, 0xe7, 0xbb, 0xb4, 0xd9, 0xa3, 0x3d,
-  0x0f, 0x07, 0x0d, 0xbd, 0x1d, 0x60, 0x43, 0xbe, 0x72, 0x14, 0xee, 0xbd,
-  0x88, 0x0b, 0xca, 0xbc, 0x2e, 0x3d, 0x76, 0x3d, 0x37, 0x5a, 0xd3, 0x3d,
-  0x77, 0x60, 0xa1, 0xbb, 0x5b, 0x00, 0x85, 0xbc, 0x23, 0x0c, 0x7f, 0x3c,
-  0xc4, 0xe4, 0x47, 0xbe, 0x78, 0xa8, 0xf3, 0xbd, 0x52, 0x44, 0xdb, 0xbc,
-  0x18, 0xda, 0x45, 0x3d, 0x53, 0x93, 0x1f, 0x3d, 0xbe, 0xe8, 0xfa, 0x3d,
-  0x0a, 0xaf, 0x8b, 0x3d, 0x64, 0x26, 0x80, 0xbc, 0xce, 0x06, 0x84, 0xbe,
-  0xd8, 0xa8, 0xeb, 0xbc, 0x3d, 0x82, 0x5e, 0xbc, 0x8e, 0x3d, 0x4d, 0xbd,
-  0x22, 0xb0, 0x3f, 0x3d, 0x06, 0x80, 0xa7, 0x3d, 0x4b, 0x2e, 0x95, 0x3d,
-  0x31, 0xc2, 0xc1, 0x3c, 0xd5, 0xd0, 0x54, 0xbe, 0xc6, 0x46, 0x30, 0x3d,
-  0x75, 0x7e, 0x8e, 0x3d, 0x91, 0x9c, 0x55, 0xbd, 0x77, 0x4a, 0x7e, 0x3d,
-  0x4c, 0x0f, 0x2b, 0x3d, 0xa4, 0xab, 0x2c, 0x3a, 0xfd, 0xb3, 0xab, 0xbc,
-  0x9b, 0xd4, 0xcd, 0xbd, 0x1a, 0xc9, 0xb1, 0xbc, 0x5f, 0x01, 0x41, 0xbd,
-  0x4b, 0x92, 0x5d, 0x3c, 0x30, 0xd4, 0xa5, 0x3d, 0xef, 0x67, 0x38, 0xbd,
-  0x7a, 0x47, 0x4c, 0xbd, 0x77, 0x39, 0xb5, 0xbc, 0x0d, 0x0d, 0xda, 0xbd,
-  0x2b, 0x6a, 0xbb, 0x3b, 0xa6, 0x66, 0x8c, 0xbd, 0x23, 0x79, 0xdd, 0xbd,
-  0x72, 0x2c, 0xca, 0xbc, 0x97, 0xb9, 0x3e, 0x3c, 0xbe, 0xc5, 0x12, 0xbd,
-  0x81, 0x0e, 0xc0, 0xbd, 0xc9, 0xbb, 0x61, 0x3d, 0x18, 0x68, 0x80, 0xbd,
-  0x06, 0x7c, 0x66, 0x3b, 0x54, 0x51, 0xe6, 0xbc, 0x90, 0x5d, 0xba, 0xbb,
-  0xe8, 0xca, 0x1e, 0x3d, 0x9c, 0xed, 0xad, 0x3b, 0xd8, 0x5b, 0xa4, 0x3c,
-  0xb1, 0xf3, 0x89, 0x3d, 0x28, 0x1b, 0xa4, 0x3d, 0xdf, 0x25, 0xb3, 0x3d,
-  0x30, 0x03, 0x6a, 0x3d, 0x8f, 0x81, 0x39, 0x3d, 0x92, 0x9b, 0x2c, 0x3e,
-  0x60, 0x66, 0x4b, 0x3d, 0xce, 0x44, 0x5b, 0x3d, 0xc2, 0x3c, 0x3d, 0x3e,
-  0x82, 0xf3, 0xe5, 0x3d, 0x1b, 0x5a, 0xea, 0x3c, 0x66, 0xc3, 0x1a, 0x3b,
-  0x0d, 0xaf, 0xcb, 0x3c, 0xe6, 0x17, 0x08, 0x3e, 0xf3, 0xea, 0x04, 0x3d,
-  0xfd, 0x1a, 0x4b, 0x3c, 0x5b, 0x76, 0x6e, 0x3d, 0x3e, 0x21, 0xa4, 0x3d,
-  0x73, 0xaa, 0xa0, 0x3d, 0xc7, 0x5c, 0xd0, 0x3c, 0x7d, 0x4c, 0x7b, 0x3d,
-  0xa4, 0xc9, 0x2d, 0xbd, 0xd4, 0xc0, 0x74, 0x3d, 0x19, 0x41, 0x9e, 0x3a,
-  0xbe, 0xa6, 0xf0, 0x3b, 0x36, 0x2e, 0x71, 0x3d, 0x88, 0xb1, 0xfc, 0x3c,
-  0xce, 0xa8, 0xc8, 0x3d, 0xf3, 0xa6, 0x91, 0x3d, 0x11, 0x88, 0x62, 0x3d,
-  0xf9, 0x14, 0xea, 0x3d, 0xb0, 0x56, 0x83, 0x3d, 0x03, 0xfe, 0xa5, 0xbd,
-  0xbd, 0x57, 0x98, 0x3d, 0x48, 0x52, 0x25, 0x3e, 0xa0, 0xdf, 0xe1, 0x3b,
-  0x15, 0x61, 0x1f, 0x3e, 0x4b, 0x63, 0xce, 0xbc, 0x04, 0x1b, 0x0a, 0x39,
-  0x78, 0xda, 0xb8, 0x3d, 0x68, 0xb7, 0x0c, 0xbc, 0xdf, 0x52, 0xcb, 0xbd,
-  0xc7, 0x01, 0xd4, 0xbd, 0x33, 0xef, 0x3d, 0xbe, 0xa3, 0x9e, 0xe5, 0xbd,
-  0xf2, 0x40, 0x36, 0xbd, 0x5f, 0x93, 0x01, 0xbe, 0xa2, 0x9c, 0xa3, 0xbd,
-  0x51, 0x35, 0x74, 0xbd, 0xe4, 0x7c, 0xd7, 0xbd, 0x7c, 0x3f, 0x35, 0xbe,
-  0x46, 0xd9, 0x56, 0xbe, 0x81, 0x01, 0x73, 0xbe, 0x12, 0x19, 0x98, 0xbd,
-  0x70, 0xd9, 0x86, 0xbe, 0x8d, 0xab, 0x3b, 0xbe, 0xbc, 0x44, 0x1a, 0xbc,
-  0x34, 0x83, 0x2e, 0xbe, 0x2b, 0x54, 0x4b, 0xbe, 0x1b, 0xb2, 0x3a, 0xbe,
-  0xfb, 0x80, 0x2f, 0xbe, 0x3d, 0x46, 0xe9, 0xbd, 0xf9, 0x26, 0x15, 0xbe,
-  0xcd, 0xd7, 0x7d, 0xbe, 0x0b, 0xb5, 0x51, 0x3b, 0x32, 0xe5, 0x56, 0xbe,
-  0x45, 0x05, 0xc1, 0xbd, 0xb9, 0x33, 0x23, 0xbe, 0x13, 0x8a, 0x1d, 0xbe,
-  0x10, 0xf0, 0x9d, 0xbc, 0x75, 0xc6, 0x3f, 0xbe, 0xbc, 0x39, 0x33, 0xbe,
-  0x62, 0x73, 0x51, 0xbc, 0xa9, 0xf2, 0xca, 0xbe, 0xd8, 0xb7, 0xdd, 0xbd,
-  0xfc, 0x67, 0x3c, 0xbe, 0xc3, 0x18, 0xe5, 0xbd, 0x49, 0x00, 0xd2, 0xbd,
-  0x25, 0x32, 0x0f, 0xbe, 0x41, 0xd8, 0x94, 0xbe, 0x02, 0xfe, 0xb2, 0xbd,
-  0x60, 0x45, 0x95, 0xbe, 0xc7, 0xb0, 0x4d, 0x3d, 0xa8, 0x4d, 0xb8, 0xbd,
-  0x4a, 0x08, 0xea, 0xbc, 0x66, 0x20, 0xed, 0x3c, 0xab, 0xef, 0x65, 0xbd,
-  0xb5, 0x74, 0x93, 0xbd, 0x79, 0x20, 0xe9, 0xbb, 0x73, 0x05, 0xe1, 0xbd,
-  0xbe, 0x43, 0x84, 0xb9, 0x12, 0xee, 0xfd, 0xbd, 0x25, 0xdb, 0xa1, 0xbd,
-  0xa2, 0xbe, 0x49, 0xbd, 0xa0, 0x7c, 0xef, 0xbd, 0xd0, 0xcb, 0x36, 0xbd,
-  0xcf, 0x37, 0xfd, 0xbd, 0x44, 0xe6, 0x1f, 0xbe, 0xb5, 0xa9, 0x32, 0xba,
-  0xd9, 0x5e, 0x28, 0xbe, 0xbc, 0x27, 0xd7, 0xbc, 0x10, 0xc6, 0xaf, 0x3c,
-  0x55, 0x06, 0x0d, 0xbe, 0xc1, 0xe9, 0x49, 0xbd, 0x02, 0x74, 0x0d, 0xbe,
-  0xc7, 0x61, 0x10, 0xbe, 0xc6, 0x61, 0x2e, 0xbd, 0x22, 0x67, 0x5f, 0xbd,
-  0xe5, 0x4d, 0x06, 0xbd, 0x48, 0x58, 0x07, 0xbd, 0xb6, 0x9d, 0xaa, 0xbd,
-  0xa1, 0x26, 0x6f, 0xbd, 0xc4, 0x29, 0x05, 0xbe, 0x12, 0x65, 0x66, 0xbd,
-  0x15, 0xe8, 0x38, 0x3d, 0x8d, 0x37, 0xee, 0xbd, 0xb3, 0x53, 0x44, 0xbc,
-  0x58, 0x48, 0x9b, 0xbc, 0x67, 0xed, 0x30, 0xbe, 0xb8, 0x13, 0x6e, 0xbd,
-  0xa5, 0x4c, 0x75, 0x3c, 0x27, 0xdd, 0x44, 0xbe, 0xd3, 0xaa, 0xd0, 0xbc,
-  0xee, 0x46, 0xc8, 0xbd, 0x1d, 0xc9, 0x98, 0xbd, 0xa8, 0xf3, 0xb2, 0xbd,
-  0x9c, 0x51, 0x15, 0xbd, 0x70, 0x1d, 0xd2, 0xbd, 0x96, 0x0a, 0xd9, 0xbd,
-  0xc7, 0x90, 0x55, 0xbe, 0x2b, 0xc6, 0x2a, 0x3c, 0xb4, 0xd4, 0xd2, 0x3c,
-  0x53, 0x2a, 0xf5, 0x3c, 0x15, 0x7d, 0x0a, 0xbd, 0xe6, 0x5f, 0x1f, 0x3d,
-  0x86, 0xa8, 0x44, 0xbb, 0xc0, 0xa8, 0x99, 0xbd, 0x24, 0x03, 0x41, 0x3c,
-  0xe1, 0x75, 0xb7, 0x3d, 0xa7, 0xcf, 0xa3, 0xba, 0xeb, 0xb1, 0x8c, 0x3d,
-  0x5a, 0xd3, 0xa6, 0xbc, 0x78, 0x8d, 0x6e, 0x3d, 0xc0, 0x4f, 0xd5, 0xbb,
-  0x34, 0x40, 0xad, 0xbd, 0x30, 0xd3, 0x0f, 0xbb, 0x42, 0x35, 0x8d, 0xbd,
-  0x87, 0xf1, 0x8c, 0xbd, 0x82, 0x96, 0xc3, 0xbd, 0x79, 0xc4, 0x13, 0xbe,
-  0x82, 0x98, 0x0f, 0xbe, 0x18, 0xca, 0xdc, 0xbd, 0x71, 0x0a, 0xba, 0xbd,
-  0x98, 0x58, 0x9e, 0xbc, 0xb2, 0x13, 0x99, 0xbd, 0x9d, 0x0f, 0xc1, 0xbc,
-  0x48, 0x1f, 0x9e, 0xbd, 0x63, 0x39, 0xcf, 0xbd, 0x57, 0xa8, 0x8f, 0xbd,
-  0xdb, 0x6f, 0xcf, 0xbd, 0x5e, 0x54, 0xca, 0xbd, 0x45, 0x63, 0x3a, 0x3c,
-  0x37, 0x9b, 0x83, 0x3c, 0x1a, 0x7a, 0x87, 0x3d, 0xf8, 0xa4, 0x16, 0xbe,
-  0x8b, 0xaf, 0x31, 0xbe, 0x03, 0xe0, 0xa6, 0xbc, 0xb6, 0x91, 0x66, 0x3b,
-  0x08, 0x5d, 0x9a, 0xbd, 0x9b, 0x40, 0x97, 0x3c, 0x9e, 0x84, 0x08, 0x3e,
-  0x2f, 0xc3, 0xd7, 0x3d, 0xeb, 0x28, 0x21, 0xbe, 0x58, 0x43, 0x03, 0xbe,
-  0x67, 0x97, 0x8b, 0xbb, 0xf2, 0xd0, 0x0a, 0x3d, 0xb9, 0x64, 0xe3, 0xbd,
-  0xf5, 0xf7, 0x32, 0x3d, 0xcc, 0xca, 0x7e, 0xbb, 0x1d, 0xdb, 0x81, 0x3d,
-  0x3d, 0x20, 0x49, 0xbd, 0xf2, 0x9d, 0x35, 0xbe, 0x88, 0xd5, 0x21, 0xbd,
-  0xbc, 0xe0, 0x9a, 0xbb, 0x5a, 0x91, 0xf4, 0xbc, 0x04, 0x3b, 0x80, 0x3d,
-  0xf5, 0x49, 0xcc, 0xbc, 0xa6, 0x77, 0x53, 0x3d, 0x83, 0xec, 0x93, 0xbd,
-  0x9c, 0x7a, 0x01, 0xbe, 0xf4, 0xe1, 0x01, 0xbd, 0x0d, 0x52, 0xa2, 0x3b,
-  0xbe, 0x38, 0x72, 0x3b, 0x56, 0xd7, 0xb1, 0x3d, 0xf3, 0xd9, 0x3f, 0xbb,
-  0xc1, 0x18, 0x53, 0x3d, 0xd4, 0x04, 0xcf, 0xbd, 0x5e, 0x2a, 0x3c, 0xbe,
-  0xb7, 0x7a, 0x9a, 0x3c, 0x4b, 0x19, 0x27, 0xbd, 0x3c, 0xff, 0xa7, 0x3d,
-  0x9b, 0x33, 0x28, 0x3d, 0x1b, 0xe4, 0x1a, 0xbc, 0x36, 0x82, 0xe0, 0x3d,
-  0x46, 0x06, 0x0a, 0xbe, 0x60, 0x5f, 0xe4, 0xbd, 0xdb, 0xa2, 0x9c, 0xbd,
-  0xd1, 0x05, 0xdf, 0x39, 0x0a, 0x03, 0x9c, 0x3d, 0xdd, 0x23, 0x32, 0xbc,
-  0x85, 0x02, 0xa4, 0x3d, 0x42, 0x49, 0x00, 0x3c, 0xc5, 0xf5, 0x40, 0xbe,
-  0x96, 0xd9, 0x47, 0xbe, 0x26, 0x55, 0xf7, 0xbd, 0xab, 0x60, 0x8c, 0xbd,
-  0x48, 0x79, 0x67, 0xbd, 0xf8, 0xb1, 0xff, 0xbd, 0xef, 0xad, 0x09, 0x3d,
-  0x58, 0x18, 0x55, 0x3d, 0x09, 0x4b, 0x39, 0xbe, 0x23, 0x6d, 0x3f, 0xbe,
-  0x01, 0xca, 0x8d, 0xbd, 0x7d, 0xe4, 0x2b, 0xbe, 0xea, 0x5a, 0x84, 0xbd,
-  0x50, 0x72, 0x59, 0xbe, 0xbc, 0x99, 0xbb, 0x3d, 0xcd, 0xc4, 0xfc, 0x3c,
-  0xc0, 0x11, 0x30, 0xbe, 0xea, 0x97, 0xbf, 0xbd, 0x53, 0x84, 0x0b, 0xbd,
-  0x81, 0xb1, 0xbd, 0xbd, 0x0b, 0xd9, 0x12, 0xbe, 0x79, 0x7e, 0x42, 0xbe,
-  0x7b, 0xdb, 0x5c, 0xbe, 0x8d, 0x41, 0x3d, 0xbe, 0xee, 0xe2, 0x3c, 0xbe,
-  0x84, 0x50, 0x1c, 0xbe, 0x00, 0x08, 0xd3, 0xbd, 0x29, 0xc2, 0xdb, 0xbd,
-  0x08, 0xef, 0x25, 0xbe, 0x02, 0x51, 0x97, 0x3a, 0xb3, 0xdd, 0x08, 0xbe,
-  0xc1, 0x73, 0xe8, 0xbd, 0xd0, 0xbc, 0x28, 0xbe, 0xba, 0x72, 0xa5, 0xbd,
-  0xb6, 0x1b, 0xd8, 0xbd, 0x71, 0x13, 0x8d, 0xbd, 0xd3, 0x37, 0x30, 0xbe,
-  0xb7, 0x0a, 0xee, 0xbc, 0x21, 0x4e, 0xdf, 0x3c, 0x34, 0xad, 0x80, 0xbc,
-  0x69, 0x4d, 0xed, 0xbd, 0x1d, 0x52, 0x51, 0xbe, 0xca, 0x20, 0x88, 0x3a,
-  0x92, 0xc7, 0x1f, 0xbd, 0x11, 0x7b, 0xd3, 0xbb, 0xdc, 0x06, 0xd8, 0x3d,
-  0x64, 0x1e, 0x14, 0x3e, 0xdf, 0x24, 0xe1, 0x3d, 0xb2, 0xa8, 0x49, 0xbd,
-  0x20, 0x12, 0x12, 0xbe, 0x01, 0xf0, 0x99, 0x3d, 0x5f, 0xca, 0x43, 0x3e,
-  0x62, 0x27, 0x35, 0xbc, 0xcb, 0x4f, 0x0e, 0x3e, 0x2f, 0xf1, 0x07, 0x3e,
-  0xf9, 0x74, 0x1e, 0x3e, 0x2d, 0xe0, 0x15, 0x3e, 0x22, 0x43, 0x55, 0xbe,
-  0xcf, 0xc4, 0xad, 0x3d, 0x1a, 0xca, 0xe2, 0x3d, 0x53, 0xc5, 0xa7, 0xbd,
-  0x3e, 0xf7, 0x05, 0x3c, 0x24, 0xd2, 0xc7, 0x3d, 0xa6, 0x2e, 0xfc, 0x3c,
-  0xa3, 0xa8, 0x83, 0x3d, 0x5b, 0x1f, 0x27, 0xbe, 0xb4, 0xe8, 0x7d, 0x3d,
-  0xc1, 0x4a, 0xb8, 0x3d, 0xb8, 0x2c, 0x8b, 0xbd, 0x62, 0xc0, 0x20, 0x3c,
-  0xfa, 0x1f, 0xb9, 0x3c, 0xea, 0xce, 0x8b, 0x3c, 0xb5, 0x38, 0x53, 0x3a,
-  0x62, 0xa0, 0xfa, 0xbd, 0xb2, 0x08, 0x6a, 0x3d, 0x8e, 0x0f, 0xd3, 0x3c,
-  0xc5, 0xe4, 0xc4, 0x3c, 0xe9, 0x03, 0x84, 0x3d, 0x62, 0x60, 0x2d, 0x3d,
-  0x6d, 0x7b, 0xa1, 0xba, 0xba, 0x48, 0xcc, 0x3d, 0x8f, 0xed, 0xdb, 0xbd,
-  0xe5, 0x83, 0x77, 0x3d, 0xb9, 0xfe, 0x13, 0x3d, 0x4a, 0x64, 0xc4, 0x3c,
-  0xed, 0x20, 0x85, 0x3d, 0x9d, 0xd0, 0xe8, 0x3c, 0xe6, 0xf2, 0xce, 0xbc,
-  0xab, 0x1d, 0x25, 0x3e, 0x67, 0xc6, 0xfd, 0xbc, 0x29, 0xfe, 0x4c, 0x3c,
-  0xca, 0x62, 0x04, 0x3d, 0x9a, 0x52, 0x9a, 0x3c, 0x7d, 0x11, 0x47, 0x3d,
-  0xd1, 0xc1, 0xbc, 0x3d, 0xc7, 0xd6, 0x1a, 0xbd, 0xc4, 0x49, 0xa9, 0xbd,
-  0x7e, 0x65, 0xc5, 0xbd, 0xd8, 0x87, 0x5c, 0xbd, 0x9a, 0xc7, 0x12, 0x3d,
-  0x5f, 0xae, 0x2d, 0x3d, 0x0f, 0x8d, 0x27, 0x3d, 0xb4, 0xb5, 0xb2, 0x3d,
-  0xda, 0x9c, 0x06, 0xbd, 0xa0, 0x97, 0x56, 0xbd, 0x57, 0x52, 0x73, 0xbe,
-  0xea, 0x3f, 0x04, 0x3d, 0xa6, 0xf7, 0x5a, 0xbb, 0x09, 0xa5, 0x8b, 0xbd,
-  0x03, 0x78, 0xf9, 0x3c, 0x0c, 0xe0, 0xbf, 0x3d, 0xab, 0x04, 0xde, 0xbc,
-  0x7f, 0x80, 0xae, 0xbd, 0x0f, 0x37, 0x82, 0xbe, 0xb3, 0x8d, 0x25, 0xbd,
-  0x7b, 0xcc, 0x9a, 0x3d, 0x1c, 0x6e, 0xe7, 0xbd, 0xdd, 0x07, 0x54, 0x3d,
-  0x64, 0x77, 0x68, 0x3d, 0x28, 0xd5, 0x53, 0xbc, 0x0f, 0xf0, 0x5c, 0xbe,
-  0xe0, 0x7e, 0x63, 0xbe, 0x6f, 0xb5, 0xe6, 0xbd, 0x8e, 0x92, 0x47, 0x3b,
-  0x69, 0xed, 0x90, 0xbd, 0xab, 0x53, 0x5c, 0xbe, 0xcf, 0xa0, 0x98, 0xbd,
-  0x4b, 0x30, 0xdf, 0xbc, 0x9d, 0x70, 0x31, 0xbe, 0xb0, 0x27, 0x36, 0xbe,
-  0x4c, 0x51, 0x02, 0xbe, 0xc1, 0x93, 0xea, 0xbd, 0x0e, 0x73, 0x1c, 0xbe,
-  0xaf, 0xb5, 0x20, 0xbe, 0x03, 0x79, 0x23, 0xbe, 0x40, 0x2d, 0xbb, 0xbd,
-  0xfc, 0xde, 0x42, 0xbe, 0x23, 0x04, 0x5a, 0xbe, 0x40, 0x41, 0x20, 0xbe,
-  0x23, 0x8a, 0x3d, 0xbe, 0x5c, 0xf0, 0x05, 0xbe, 0xa8, 0xae, 0x72, 0x3d,
-  0xc3, 0x98, 0x27, 0x3c, 0x8b, 0x8f, 0xbe, 0x3c, 0x7f, 0x70, 0x08, 0x3d,
-  0xca, 0x87, 0xc1, 0xbd, 0x5f, 0x02, 0x63, 0x3d, 0xa1, 0x81, 0x34, 0x3b,
-  0x7a, 0x1c, 0x59, 0x3d, 0x6a, 0xf7, 0x68, 0x3d, 0x68, 0x78, 0xac, 0x3d,
-  0x6c, 0x0a, 0x54, 0x3d, 0x4c, 0xe9, 0xac, 0x3d, 0xc6, 0x9d, 0xad, 0xbd,
-  0xbe, 0x0a, 0x8f, 0x3d, 0x76, 0xad, 0x05, 0x3e, 0xbf, 0x01, 0xe6, 0xbc,
-  0x34, 0x4a, 0x1a, 0x3d, 0xf7, 0x6e, 0x1d, 0x3c, 0xc9, 0x7b, 0x48, 0x3d,
-  0x19, 0x82, 0x0c, 0x3e, 0x3b, 0x9f, 0x25, 0xbc, 0xc2, 0x23, 0x90, 0x3d,
-  0x0b, 0x93, 0x61, 0x3d, 0xe7, 0xad, 0xa7, 0x3b, 0xdb, 0x4d, 0x82, 0x3d,
-  0xad, 0x75, 0x06, 0xbd, 0x96, 0x18, 0x1d, 0xbd, 0xc7, 0x2c, 0xec, 0x3d,
-  0x2f, 0x00, 0x02, 0x3e, 0x8b, 0xeb, 0xac, 0x3c, 0xb2, 0x88, 0x25, 0x3d,
-  0xce, 0xe8, 0xf3, 0x3c, 0xdc, 0xd2, 0xb1, 0x3d, 0xe4, 0x19, 0xfe, 0x3c,
-  0x43, 0x15, 0x92, 0x3d, 0x67, 0x29, 0xa8, 0x3d, 0x68, 0xd1, 0x59, 0x3e,
-  0x4e, 0xcc, 0xbe, 0x3c, 0xe1, 0x97, 0x7c, 0xbc, 0xa9, 0x20, 0xe1, 0xbc,
-  0xaf, 0x99, 0x33, 0x3d, 0x8e, 0x24, 0x2a, 0xbd, 0xe6, 0x0f, 0x93, 0xbc,
-  0xaf, 0x0c, 0x62, 0x3d, 0x95, 0xc0, 0x6b, 0x3e, 0x7b, 0xea, 0x80, 0xbb,
-  0x29, 0x94, 0xbc, 0x3d, 0x9e, 0x1d, 0x6d, 0x3c, 0xf4, 0x4b, 0xef, 0x3c,
-  0x5f, 0x8d, 0x59, 0x3d, 0x16, 0x76, 0xd2, 0xbc, 0xd6, 0xfc, 0xf7, 0x3c,
-  0xb9, 0x0d, 0x9f, 0x3d, 0xaf, 0xe4, 0xa9, 0xbc, 0x02, 0x00, 0xb0, 0x3d,
-  0xfa, 0xb9, 0x09, 0xbe, 0x80, 0xae, 0x89, 0x3d, 0x4f, 0x82, 0xfd, 0x3c,
-  0x44, 0x3f, 0x26, 0x3c, 0x70, 0x20, 0x9d, 0xbd, 0x76, 0x48, 0x41, 0xbe,
-  0x77, 0x0c, 0x58, 0x3d, 0xdb, 0x50, 0xe9, 0xbc, 0x71, 0xfd, 0x3f, 0xbe,
-  0x44, 0x06, 0xd6, 0x3c, 0x34, 0x09, 0xbf, 0xbc, 0x1c, 0x21, 0x31, 0xbd,
-  0xb2, 0xf6, 0x39, 0xbd, 0x4b, 0xa6, 0x5a, 0xbe, 0x16, 0x52, 0xc5, 0xbd,
-  0xff, 0x25, 0xb2, 0x3c, 0xe8, 0x18, 0xee, 0xbd, 0x67, 0xc1, 0xd1, 0x3d,
-  0x3e, 0xf3, 0x25, 0xbd, 0xe1, 0x2e, 0x16, 0xbd, 0xbd, 0x93, 0x0e, 0xbd,
-  0x64, 0xcb, 0xa7, 0xbe, 0xb4, 0x4f, 0x3f, 0x3d, 0x7c, 0x00, 0x2d, 0x3c,
-  0xa9, 0x0f, 0x00, 0xbe, 0x6d, 0xdc, 0x0c, 0xbd, 0xad, 0x44, 0xf2, 0xbc,
-  0x69, 0xe9, 0x19, 0x3b, 0x03, 0xa6, 0x80, 0xbd, 0xa0, 0xc3, 0x85, 0xbe,
-  0x83, 0xb9, 0xb1, 0xbc, 0x9f, 0xa8, 0x22, 0xbd, 0xe8, 0x8e, 0x60, 0xbe,
-  0xb4, 0x6d, 0x9d, 0xbd, 0x93, 0x9d, 0xb2, 0xbc, 0x3b, 0xa2, 0xd8, 0xbd,
-  0x8f, 0x28, 0x26, 0xbe, 0x0d, 0x14, 0x0c, 0xbe, 0x3d, 0x2a, 0xd8, 0xbd,
-  0x7f, 0x8f, 0xeb, 0xbd, 0x76, 0xa5, 0xc1, 0xbd, 0x0d, 0x6b, 0x17, 0xbe,
-  0x30, 0xe5, 0xb0, 0xbd, 0x6f, 0xed, 0x07, 0xbe, 0x1c, 0xf8, 0x03, 0xbe,
-  0xdb, 0xff, 0x23, 0xbe, 0x8b, 0x9e, 0xf2, 0xbd, 0xb4, 0xae, 0x2b, 0xbe,
-  0x0c, 0x59, 0x33, 0xbe, 0x81, 0x1a, 0xc5, 0xbc, 0x10, 0x35, 0x8d, 0x3d,
-  0x17, 0xa8, 0xea, 0x3c, 0x93, 0x5a, 0x52, 0x3d, 0x0b, 0x6e, 0x93, 0xbd,
-  0x7c, 0x31, 0x54, 0x3d, 0x4a, 0x0e, 0xbf, 0x3c, 0x75, 0x3b, 0xe6, 0x3d,
-  0x81, 0x88, 0x0c, 0x3d, 0x22, 0x75, 0xd3, 0x3d, 0x04, 0x75, 0x0e, 0x3e,
-  0xe8, 0x72, 0xac, 0x3d, 0x2c, 0x7c, 0xfa, 0xbc, 0x53, 0xdf, 0x03, 0x3e,
-  0xf7, 0x42, 0x18, 0x3e, 0xb7, 0x98, 0xa3, 0x3d, 0x47, 0x5e, 0xf9, 0x3c,
-  0xa6, 0xe5, 0xd2, 0xbb, 0xa5, 0xe9, 0xac, 0xbb, 0x08, 0x8b, 0x1a, 0x3e,
-  0xbb, 0xf3, 0x00, 0x3e, 0x0c, 0x99, 0x7e, 0x3d, 0xcd, 0xb0, 0x69, 0x3c,
-  0xc1, 0x89, 0x92, 0x3d, 0xb0, 0x56, 0x02, 0xbe, 0x27, 0x2d, 0xa5, 0x3c,
-  0xbe, 0xa6, 0xe5, 0xbb, 0x44, 0x32, 0x84, 0x3d, 0x02, 0xe6, 0x7e, 0x3e,
-  0x8d, 0x0a, 0xb8, 0x3c, 0x93, 0xa1, 0x24, 0x3d, 0x63, 0x96, 0x82, 0x3d,
-  0x11, 0x0f, 0xf5, 0xbd, 0x16, 0xc0, 0x6c, 0x3c, 0x15, 0x65, 0xe6, 0x3c,
-  0x98, 0xf4, 0x45, 0x3c, 0xe4, 0x77, 0x71, 0x3e, 0xdc, 0x99, 0x39, 0xbc,
-  0x89, 0x87, 0x00, 0xbd, 0x7c, 0xae, 0x80, 0x3d, 0x7d, 0x1f, 0xc9, 0xbb,
-  0x4b, 0x82, 0x24, 0x3d, 0x77, 0x39, 0x1a, 0xbd, 0xa2, 0xb8, 0xa0, 0x3d,
-  0xd1, 0x3d, 0x0b, 0x3e, 0x06, 0x3c, 0xc1, 0xbb, 0x63, 0x5d, 0xe0, 0x3c,
-  0xcc, 0xa6, 0x45, 0xbd, 0x2d, 0x69, 0x6b, 0x3d, 0x0a, 0xe7, 0xf0, 0x3c,
-  0xb2, 0x8b, 0xae, 0xbb, 0xed, 0xed, 0x35, 0x3d, 0x8f, 0xd2, 0x53, 0xbc,
-  0xc4, 0xbf, 0xff, 0x3c, 0x32, 0x19, 0x4f, 0x3d, 0x79, 0xd6, 0xf8, 0xbd,
-  0xdb, 0xfd, 0xc8, 0x3b, 0x74, 0xdc, 0xc4, 0x3c, 0x3e, 0x27, 0xa5, 0x3b,
-  0x10, 0xda, 0x8e, 0x3d, 0xef, 0x05, 0x01, 0xbe, 0x88, 0x88, 0x1b, 0x3d,
-  0xc4, 0x6a, 0xd1, 0x3d, 0x4e, 0x8e, 0x10, 0xbe, 0xe0, 0xf9, 0x11, 0x3d,
-  0xb5, 0x4c, 0x6a, 0x3d, 0xad, 0x00, 0x60, 0x3d, 0xb8, 0x4a, 0x04, 0xbd,
-  0xec, 0x50, 0x43, 0xbe, 0x5a, 0xc0, 0x9a, 0xbb, 0x5c, 0x7c, 0xae, 0x3a,
-  0x30, 0xb5, 0xa4, 0xbe, 0xea, 0x81, 0xc5, 0xbc, 0x8f, 0xb6, 0x87, 0x3d,
-  0xf7, 0x1e, 0xd3, 0x3d, 0x1d, 0x6f, 0x1c, 0xbd, 0x26, 0xcf, 0xad, 0xbe,
-  0x34, 0x3d, 0x3b, 0xbc, 0xa7, 0x18, 0x1b, 0xbd, 0xdb, 0xb6, 0x8c, 0xbe,
-  0xfc, 0x29, 0xed, 0xbc, 0xda, 0x9e, 0x47, 0x3d, 0x7e, 0x8e, 0x7d, 0x3c,
-  0x51, 0x44, 0x29, 0xbd, 0x42, 0x1c, 0xe0, 0xbe, 0xd7, 0xb4, 0x90, 0x3d,
-  0x38, 0x71, 0x3f, 0x3b, 0x28, 0x3f, 0x51, 0xbe, 0xc4, 0x38, 0xe7, 0xbd,
-  0xff, 0x7b, 0xc7, 0x3c, 0xef, 0xff, 0x78, 0xbd, 0x92, 0x5a, 0x4e, 0xbd,
-  0x60, 0x41, 0x8c, 0xbe, 0xe1, 0x90, 0x78, 0xbd, 0xcb, 0x54, 0xcc, 0xbd,
-  0xec, 0x4b, 0x79, 0xbe, 0xd8, 0xad, 0xd4, 0xbd, 0x76, 0xdf, 0x44, 0xbe,
-  0x42, 0x0f, 0x9c, 0xbe, 0x69, 0x33, 0x33, 0xbe, 0x75, 0xd7, 0x0a, 0xbe,
-  0xed, 0x41, 0x84, 0xbe, 0x5c, 0xc2, 0x68, 0xbe, 0x71, 0xb0, 0xd7, 0xbd,
-  0x4d, 0xef, 0xe9, 0x3c, 0x13, 0x8b, 0x68, 0x3a, 0xf8, 0xcb, 0x0d, 0x3d,
-  0xcf, 0x75, 0xf3, 0x3c, 0x71, 0x46, 0x95, 0xbd, 0xfe, 0x06, 0x2b, 0xbb,
-  0x8b, 0xb2, 0x03, 0x3d, 0xc1, 0x18, 0x48, 0xbc, 0x8c, 0xe6, 0xd5, 0xbb,
-  0x30, 0x19, 0x15, 0x3c, 0x87, 0x67, 0x58, 0x3d, 0x5b, 0xf9, 0x8c, 0x3d,
-  0x03, 0x13, 0x58, 0xbd, 0x17, 0xea, 0x8f, 0x3d, 0x11, 0xd1, 0x8f, 0x3c,
-  0x04, 0x1a, 0xcc, 0x3d, 0x27, 0x37, 0xb2, 0xbd, 0x27, 0xae, 0x62, 0xbd,
-  0x23, 0xeb, 0x05, 0xbc, 0xe3, 0xfb, 0x24, 0x3e, 0xe7, 0x02, 0x05, 0x3e,
-  0xbc, 0xa6, 0x18, 0xbd, 0x41, 0xfc, 0x0f, 0xbc, 0x77, 0x1f, 0x86, 0x3e,
-  0xd7, 0x50, 0x20, 0xbe, 0xc9, 0x26, 0x9e, 0xbd, 0xca, 0xb5, 0x5d, 0xbd,
-  0x39, 0xfb, 0xa9, 0x3d, 0x98, 0x21, 0x79, 0x3e, 0xb2, 0xc3, 0xaf, 0x3c,
-  0xa4, 0xee, 0x26, 0xbd, 0xb7, 0xc7, 0x53, 0x3e, 0x7d, 0xaf, 0x37, 0xbe,
-  0xb1, 0x52, 0x78, 0xbd, 0xc5, 0xef, 0x23, 0xbe, 0x5f, 0xfa, 0x64, 0x3d,
-  0x54, 0x14, 0xb8, 0x3e, 0x65, 0xa6, 0xd2, 0xbd, 0x6f, 0x33, 0xee, 0xbd,
-  0xb9, 0x06, 0x7f, 0x3e, 0x50, 0x9f, 0xd0, 0xbd, 0x95, 0xc7, 0x1e, 0xbc,
-  0x4b, 0xd8, 0x8b, 0xbd, 0x53, 0xa4, 0x7b, 0x3d, 0x88, 0x84, 0xcd, 0x3e,
-  0xa2, 0x77, 0xc8, 0xbd, 0x73, 0xc7, 0x17, 0xbe, 0x7a, 0x90, 0x1f, 0x3e,
-  0xa4, 0xaf, 0x0f, 0xbc, 0x76, 0xb1, 0xd0, 0x3c, 0x33, 0x2e, 0xf6, 0x3d,
-  0x4e, 0x4b, 0xc1, 0x3d, 0x77, 0xc3, 0xd4, 0x3d, 0x47, 0x43, 0x7e, 0x3d,
-  0x0a, 0xd6, 0x9e, 0x3c, 0xd0, 0x44, 0x36, 0x3d, 0xe6, 0x8c, 0x6a, 0xbd,
-  0x50, 0x9c, 0x2e, 0x3d, 0x85, 0x41, 0xe7, 0x3d, 0xa5, 0xa7, 0x21, 0x3e,
-  0x17, 0x10, 0x06, 0xbd, 0x60, 0xfa, 0x12, 0x3e, 0x89, 0xc3, 0xe8, 0x3d,
-  0xfa, 0xcb, 0xa4, 0xbc, 0xf5, 0xc9, 0xd8, 0x3c, 0x8d, 0x33, 0x2b, 0x3d,
-  0x2d, 0x0e, 0x50, 0x3d, 0xda, 0xe3, 0x92, 0x3d, 0xe1, 0xe1, 0xf9, 0xbd,
-  0x36, 0x6e, 0x48, 0x3d, 0x40, 0x01, 0x50, 0x3d, 0xb2, 0x9c, 0x75, 0xbe,
-  0xe7, 0x8e, 0xd7, 0xbc, 0x50, 0x1b, 0x83, 0x3c, 0x22, 0x2e, 0xc1, 0x3d,
-  0x40, 0x4b, 0x93, 0x3d, 0xdf, 0x78, 0x84, 0xbe, 0x82, 0x4d, 0xa5, 0x3d,
-  0x78, 0x8b, 0x06, 0x3d, 0xe7, 0xa6, 0xd4, 0xbe, 0x99, 0x4a, 0x76, 0x3d,
-  0x28, 0x70, 0x72, 0x3d, 0x5e, 0xa5, 0xb5, 0x3d, 0x84, 0xa6, 0x14, 0x3d,
-  0x74, 0x16, 0x86, 0xbe, 0x21, 0x4c, 0xaf, 0x3c, 0xaa, 0xec, 0xa8, 0x3d,
-  0xb0, 0xb6, 0x83, 0xbe, 0xcc, 0x55, 0xf1, 0x3b, 0x8f, 0x8d, 0xe6, 0xbc,
-  0x68, 0x6a, 0xfc, 0xbd, 0x5c, 0xe4, 0xa5, 0xbc, 0xe9, 0xbd, 0x2c, 0xbe,
-  0x3e, 0x8c, 0x8a, 0xbd, 0xea, 0x11, 0xd0, 0xbd, 0x24, 0x5e, 0x3b, 0xbe,
-  0xd6, 0x6c, 0xb3, 0xbe, 0xa0, 0x2a, 0x7d, 0xbe, 0x49, 0x95, 0x8c, 0xbe,
-  0xd5, 0xe0, 0xc8, 0xbe, 0x59, 0xdb, 0x35, 0xbe, 0x8e, 0x0d, 0xaa, 0xbe,
-  0x68, 0xfe, 0x72, 0xbe, 0x85, 0x57, 0x27, 0xbe, 0x8c, 0xc5, 0xb5, 0xbd,
-  0xae, 0xfc, 0x5b, 0x3d, 0x10, 0x91, 0x0a, 0x3d, 0xa5, 0x93, 0x3e, 0x3d,
-  0x15, 0x03, 0xf9, 0xbd, 0x83, 0x3e, 0xb0, 0x3d, 0x7d, 0x8b, 0xc1, 0x3d,
-  0xdc, 0x81, 0x1a, 0xbc, 0xbc, 0x86, 0xf2, 0x3c, 0x5c, 0x76, 0xe7, 0xbc,
-  0xde, 0xe5, 0x2e, 0x3d, 0xca, 0x2c, 0x25, 0x3d, 0x26, 0x19, 0xda, 0xbd,
-  0x9d, 0x16, 0xe9, 0x3b, 0xc0, 0xb2, 0x20, 0x3d, 0x7a, 0x25, 0x86, 0x3d,
-  0xc1, 0x57, 0x49, 0xbe, 0xb1, 0xbd, 0xea, 0xbd, 0x5a, 0x6b, 0xb0, 0xbd,
-  0x7d, 0xff, 0x14, 0x3e, 0xe9, 0xb1, 0x07, 0x3e, 0xde, 0xe5, 0xb2, 0xbb,
-  0x54, 0x53, 0x29, 0xbe, 0xb6, 0x2e, 0x84, 0x3e, 0x4b, 0xd7, 0x79, 0xbe,
-  0xf0, 0x4b, 0x59, 0xbd, 0x50, 0x9f, 0x99, 0xbd, 0x81, 0x43, 0xb9, 0xbb,
-  0x5d, 0x4a, 0x12, 0x3e, 0x0e, 0x0a, 0xb4, 0xbd, 0xd7, 0x70, 0xbb, 0xbd,
-  0x61, 0x69, 0x7e, 0x3e, 0xae, 0xbf, 0x37, 0xbe, 0xe8, 0x3f, 0x44, 0xbe,
-  0x61, 0x61, 0x20, 0xbe, 0x05, 0xd7, 0x66, 0x3d, 0xa8, 0xe0, 0xce, 0x3d,
-  0xbd, 0xb4, 0xa7, 0xbd, 0x3d, 0x40, 0xae, 0xbd, 0xe9, 0xe7, 0x69, 0x3e,
-  0x21, 0x29, 0x28, 0xbe, 0x7d, 0x97, 0x22, 0xbd, 0x45, 0x78, 0x19, 0x3d,
-  0x15, 0x75, 0xde, 0xbc, 0xb1, 0x94, 0xc0, 0x3d, 0x6b, 0x2a, 0x49, 0xbd,
-  0x0d, 0x9d, 0xa4, 0xbd, 0x0c, 0x1b, 0xf8, 0x3d, 0x1b, 0x4c, 0x4c, 0xbd,
-  0x12, 0x90, 0xc2, 0x3d, 0x93, 0x43, 0xf3, 0x3d, 0x3a, 0x74, 0x3c, 0x3d,
-  0x76, 0x38, 0x9d, 0x3c, 0x7d, 0xbb, 0xe2, 0x3d, 0x21, 0x87, 0xfd, 0x3a,
-  0x82, 0x0f, 0x89, 0x3d, 0x5c, 0x84, 0x00, 0xbd, 0x69, 0xf7, 0x73, 0x3d,
-  0x15, 0x44, 0x7d, 0x3d, 0xbf, 0xdf, 0xf5, 0x3d, 0x40, 0x2f, 0x50, 0x3d,
-  0x1d, 0xcd, 0xb1, 0x3c, 0x06, 0xb9, 0xec, 0xbb, 0x7a, 0xcb, 0x7d, 0x3d,
-  0x00, 0x0c, 0xe3, 0xba, 0x34, 0x67, 0x66, 0x3d, 0xde, 0xaf, 0xee, 0xbb,
-  0x5a, 0xff, 0x22, 0x3e, 0xca, 0xb9, 0xf0, 0xbc, 0x81, 0xc6, 0x00, 0x3d,
-  0x81, 0xea, 0x89, 0x3c, 0x88, 0xb9, 0xb7, 0x3c, 0xd6, 0xab, 0xa5, 0xbd,
-  0x78, 0x23, 0xb3, 0x3d, 0x17, 0x7f, 0x4b, 0x3d, 0x0b, 0x59, 0x19, 0x3e,
-  0x9c, 0x0f, 0x88, 0x3d, 0xf1, 0x28, 0x8b, 0x3d, 0xa9, 0xb2, 0x41, 0xbd,
-  0xad, 0x11, 0x44, 0xbe, 0x59, 0x67, 0x13, 0xbe, 0xa3, 0x47, 0xfc, 0x3c,
-  0x0a, 0x60, 0x0e, 0xbe, 0x6f, 0xf2, 0x1a, 0x3e, 0xf6, 0x38, 0x94, 0x3d,
-  0xe4, 0x00, 0x4a, 0xbb, 0x70, 0x49, 0x06, 0xbd, 0x8e, 0x3d, 0x43, 0xbe,
-  0x19, 0xcb, 0xfa, 0xbd, 0x4e, 0x5e, 0x45, 0xbd, 0x0e, 0xba, 0x32, 0xbe,
-  0x0a, 0xb5, 0x69, 0xbd, 0x50, 0x01, 0xff, 0xbd, 0xbb, 0x95, 0x15, 0xbe,
-  0x4f, 0xcf, 0x2f, 0xbe, 0xd0, 0xe9, 0x38, 0xbe, 0x1b, 0x14, 0xa5, 0xbe,
-  0x07, 0xfc, 0x9e, 0xbe, 0x99, 0x91, 0x3f, 0xbd, 0x35, 0x12, 0xba, 0xbe,
-  0x37, 0x33, 0x58, 0xbe, 0x8b, 0x22, 0x25, 0xbe, 0xf4, 0xc8, 0x44, 0xbe,
-  0x2e, 0x93, 0xcc, 0xbd, 0x6e, 0x1a, 0x68, 0x3d, 0xd6, 0x21, 0xa4, 0x3c,
-  0xfb, 0x42, 0x6c, 0xbd, 0x23, 0xe8, 0x91, 0xbd, 0x72, 0xf6, 0x47, 0xbe,
-  0xf2, 0x1b, 0x41, 0xbd, 0x5d, 0xab, 0x28, 0xbb, 0x68, 0x71, 0x5a, 0x3d,
-  0xaf, 0x1a, 0xc8, 0x3c, 0x5d, 0x54, 0xbb, 0xbd, 0xc4, 0xad, 0xd0, 0xbd,
-  0x6a, 0x0e, 0xa2, 0x3b, 0xc5, 0xc0, 0x95, 0xbd, 0xf8, 0x3d, 0x79, 0xbd,
-  0x02, 0xf5, 0x96, 0xbd, 0x63, 0x00, 0xe1, 0x3c, 0x6c, 0x40, 0xdf, 0xbd,
-  0x38, 0x10, 0x54, 0xbe, 0x04, 0x3c, 0x63, 0xbe, 0xee, 0x8e, 0xff, 0xbd,
-  0xc0, 0x3a, 0x03, 0xbb, 0xde, 0xd4, 0x18, 0xbe, 0xe5, 0x1a, 0x4e, 0xbe,
-  0x56, 0x20, 0xea, 0x3b, 0xee, 0x6f, 0x70, 0xbe, 0x3a, 0xcc, 0xf6, 0xbd,
-  0xde, 0xc4, 0x15, 0xbe, 0xbe, 0x77, 0xd1, 0xbd, 0xd4, 0x2f, 0xa4, 0xbd,
-  0x0f, 0x65, 0xe5, 0xbd, 0x7a, 0x17, 0x25, 0xbe, 0x51, 0xa7, 0x38, 0xbd,
-  0x00, 0x1e, 0xc5, 0xbd, 0x2b, 0xfb, 0x9f, 0xbd, 0x45, 0x5e, 0xe3, 0xbd,
-  0x46, 0xee, 0x14, 0xbe, 0x2f, 0x18, 0x8e, 0xbc, 0x0e, 0x78, 0xd8, 0xbd,
-  0x47, 0xfb, 0x25, 0xbe, 0x3c, 0x9b, 0xea, 0x3d, 0xa8, 0x30, 0x9c, 0xbd,
-  0xa4, 0x33, 0x08, 0xbd, 0xcb, 0x3a, 0xf3, 0x3c, 0xfa, 0x16, 0x4a, 0xbd,
-  0xa0, 0xb5, 0xb6, 0x3d, 0xf2, 0xe0, 0x46, 0xbc, 0xa1, 0xe0, 0x05, 0xbd,
-  0xa9, 0xe8, 0x5b, 0x3d, 0xa9, 0x60, 0x0f, 0x3d, 0xfc, 0x17, 0xae, 0x3d,
-  0x7b, 0xaf, 0x4f, 0x3d, 0x47, 0x1a, 0xc3, 0x3d, 0xde, 0x05, 0x00, 0x3d,
-  0xc1, 0x66, 0x7c, 0x3b, 0x06, 0x60, 0xe6, 0x3d, 0x00, 0xe6, 0x1e, 0x3d,
-  0x2e, 0xcd, 0x4e, 0x3d, 0x22, 0xd7, 0x70, 0x3d, 0xa1, 0xd6, 0x9f, 0xbd,
-  0x76, 0x59, 0xde, 0x3c, 0xfa, 0x1b, 0x28, 0x3d, 0x50, 0xeb, 0x87, 0xbd,
-  0x29, 0xa8, 0x11, 0x3d, 0x4a, 0xf0, 0x1c, 0x3e, 0x68, 0x05, 0x3b, 0xbb,
-  0x3a, 0x29, 0x85, 0x3d, 0x60, 0x4c, 0x8a, 0xbd, 0x6a, 0x4c, 0xc0, 0x3d,
-  0xc9, 0xb8, 0x3d, 0x3e, 0x42, 0x78, 0x78, 0xbc, 0xa5, 0xcc, 0x4f, 0xbd,
-  0x95, 0x70, 0x3b, 0x3e, 0x7f, 0x04, 0x8a, 0x3c, 0x7b, 0xb9, 0x48, 0xbb,
-  0xc9, 0x88, 0xe8, 0xbd, 0x62, 0x8a, 0x01, 0xbd, 0x7e, 0x4a, 0x3e, 0x3e,
-  0xfc, 0x29, 0xf9, 0xbd, 0x11, 0xac, 0xb2, 0xbd, 0x89, 0x09, 0xdb, 0x3d,
-  0xdd, 0xf4, 0x8c, 0xbc, 0x0d, 0x4f, 0x3b, 0xbe, 0x25, 0x3c, 0x1c, 0xbe,
-  0xfd, 0x04, 0xca, 0xbd, 0xe0, 0x4a, 0xbf, 0xbb, 0x5f, 0x29, 0x36, 0xbe,
-  0x30, 0xb1, 0xba, 0xbd, 0x73, 0xd4, 0x9e, 0xbc, 0xaa, 0xe3, 0x3b, 0xbe,
-  0x96, 0xa1, 0x18, 0xbe, 0xbb, 0x07, 0xc4, 0xbc, 0xad, 0xa1, 0x71, 0xbe,
-  0x33, 0xf0, 0x1f, 0xbe, 0xb4, 0xea, 0x5e, 0xbe, 0x3f, 0x2c, 0x74, 0xbd,
-  0x2d, 0xa4, 0x30, 0xbe, 0xf8, 0xbb, 0xf5, 0xbd, 0x68, 0xe8, 0x81, 0xbd,
-  0x16, 0x1f, 0x06, 0xbd, 0x41, 0x43, 0xf8, 0xbd, 0x80, 0x63, 0x4c, 0xbe,
-  0xfd, 0x6b, 0x4c, 0xbc, 0xca, 0xa0, 0x44, 0xbe, 0x60, 0xf2, 0x17, 0xba,
-  0x2d, 0xfc, 0xe8, 0x3d, 0xb9, 0x7e, 0x7c, 0x3d, 0xae, 0x02, 0xc5, 0x3d,
-  0x3a, 0x51, 0xb9, 0x3d, 0xca, 0x0a, 0xb5, 0xbd, 0x69, 0xdb, 0x12, 0xbc,
-  0xcf, 0x10, 0xb6, 0x3d, 0xb3, 0x00, 0xfc, 0x3d, 0x83, 0xbc, 0x9b, 0x3d,
-  0xff, 0x76, 0xe6, 0xbb, 0xb0, 0x68, 0x23, 0x3d, 0x09, 0xe0, 0x0a, 0xbd,
-  0x71, 0xb8, 0x65, 0xbe, 0x8b, 0x41, 0xcb, 0x3d, 0x45, 0x6f, 0x0b, 0x3e,
-  0x96, 0x0e, 0x94, 0xbc, 0x65, 0x3f, 0x5d, 0x3d, 0xfb, 0xb0, 0x34, 0xbe,
-  0xf9, 0x12, 0x01, 0xbe, 0xf3, 0x64, 0xf9, 0xbd, 0x06, 0x89, 0x02, 0xbe,
-  0x23, 0x5a, 0x25, 0xbe, 0xec, 0x20, 0xa2, 0xbd, 0xc9, 0xd3, 0xde, 0xbc,
-  0x99, 0xe4, 0xb2, 0xbd, 0x75, 0x26, 0x1d, 0xbe, 0xf4, 0x50, 0x76, 0xbe,
-  0xe3, 0x66, 0xf1, 0xbd, 0x54, 0x34, 0x0a, 0x3e, 0xfb, 0x47, 0x2e, 0xbe,
-  0x4f, 0x05, 0x03, 0xbe, 0x0d, 0xc4, 0x3f, 0xbd, 0x96, 0x3d, 0xfd, 0xbd,
-  0x74, 0xe2, 0x36, 0xbe, 0xa1, 0x68, 0x02, 0xbe, 0x86, 0x9f, 0x1f, 0xbe,
-  0x64, 0x1a, 0x3f, 0x3e, 0xf7, 0x00, 0x03, 0xbe, 0x67, 0xd2, 0xdc, 0xbd,
-  0x0f, 0x31, 0x89, 0xbd, 0x91, 0x7a, 0x8d, 0xbd, 0xcc, 0xb2, 0x33, 0xbd,
-  0x11, 0x41, 0xfa, 0xbd, 0xdc, 0x73, 0x8e, 0xbd, 0x23, 0x06, 0x95, 0x3d,
-  0x36, 0x56, 0xb7, 0xbd, 0x94, 0x2e, 0x73, 0xbd, 0x55, 0x70, 0x9a, 0xbd,
-  0xb7, 0x36, 0x31, 0x3c, 0xcf, 0x50, 0x12, 0x3d, 0x89, 0xe1, 0xb0, 0xbd,
-  0x01, 0x3d, 0x20, 0x3d, 0x72, 0xa8, 0x28, 0x3e, 0x0b, 0x01, 0x75, 0xbc,
-  0x9b, 0xd5, 0x76, 0xbd, 0xcd, 0x6b, 0xb6, 0x3d, 0xbc, 0xb4, 0x20, 0x3d,
-  0xca, 0x2e, 0x0d, 0xbd, 0xdf, 0xf5, 0xb2, 0xbd, 0x57, 0x03, 0x85, 0xbc,
-  0xab, 0x5d, 0x3d, 0x3e, 0x42, 0x54, 0x1e, 0xbd, 0xec, 0x3f, 0x88, 0xbd,
-  0x7f, 0x9a, 0x15, 0x3e, 0xa0, 0x76, 0x04, 0x3c, 0x8e, 0xb2, 0xa9, 0xbb,
-  0x22, 0xd8, 0x96, 0xbd, 0xd9, 0x72, 0x9e, 0x3b, 0x65, 0x4c, 0x2f, 0x3e,
-  0x87, 0xb0, 0xc5, 0xbd, 0x42, 0x2f, 0x41, 0x3d, 0x65, 0x29, 0x67, 0x3d,
-  0x61, 0x8b, 0xc3, 0x3d, 0xca, 0x69, 0x30, 0xbd, 0x5e, 0xcf, 0x2f, 0xbd,
-  0x64, 0xd6, 0x8c, 0xbd, 0x97, 0x1d, 0xa9, 0xbd, 0x5e, 0x92, 0x4a, 0x3c,
-  0x44, 0xec, 0x1c, 0x3d, 0x3a, 0x4b, 0x9f, 0xbd, 0x5f, 0x6a, 0x8b, 0x3d,
-  0xc4, 0xc8, 0x91, 0xbd, 0x43, 0xc5, 0x0a, 0xbd, 0x1b, 0xea, 0x43, 0xbe,
-  0x3e, 0xf2, 0x42, 0xbe, 0x12, 0x99, 0xb7, 0xbd, 0x09, 0x8d, 0xd9, 0xbc,
-  0x7d, 0xc0, 0x9f, 0xbd, 0x90, 0x7e, 0x0f, 0xbd, 0x16, 0xd5, 0xc1, 0xbc,
-  0xb5, 0x54, 0x6f, 0xbc, 0x6d, 0xb8, 0xac, 0xbd, 0xa5, 0x94, 0x9d, 0xbe,
-  0x9b, 0x59, 0x27, 0xbd, 0x08, 0x77, 0x1a, 0x3d, 0x21, 0xea, 0x00, 0xbe,
-  0x12, 0x07, 0x4a, 0x3d, 0xd6, 0x6f, 0x6a, 0x3b, 0xcd, 0x98, 0x29, 0xbe,
-  0x41, 0xb1, 0x57, 0x3d, 0x9e, 0x82, 0x9a, 0xbd, 0xbd, 0x8f, 0x91, 0x3c,
-  0x70, 0x02, 0x00, 0xbe, 0x80, 0x09, 0x90, 0xbd, 0xd9, 0x1b, 0x23, 0x3e,
-  0xae, 0x3b, 0x9e, 0x3d, 0xf0, 0x9a, 0xe5, 0x3d, 0x3a, 0x0b, 0xc2, 0x3d,
-  0x53, 0x9f, 0x36, 0xbe, 0xec, 0xe8, 0x3b, 0x3d, 0xc4, 0x38, 0x14, 0x3e,
-  0x12, 0x81, 0xbe, 0x3c, 0x41, 0xbf, 0x10, 0x3e, 0x93, 0x32, 0xc7, 0x3d,
-  0xf6, 0xba, 0x10, 0x3e, 0x6b, 0xa9, 0xaa, 0x3d, 0x79, 0xf1, 0x32, 0xbe,
-  0x31, 0x64, 0xa5, 0x3d, 0x37, 0x7e, 0x93, 0x3d, 0x13, 0xe8, 0xcb, 0x3d,
-  0xd8, 0xf6, 0x09, 0x3d, 0xbc, 0x7a, 0x83, 0x3a, 0x1e, 0xe0, 0x89, 0x3b,
-  0x18, 0x3f, 0xd0, 0xbd, 0xa8, 0x72, 0x9d, 0x3d, 0x37, 0xd0, 0x49, 0xbd,
-  0xed, 0xc0, 0x67, 0x3c, 0x2f, 0x60, 0x01, 0x3e, 0x1c, 0x5e, 0x12, 0x3d,
-  0x38, 0xe5, 0x20, 0xbe, 0x89, 0x0b, 0x61, 0xbe, 0x48, 0x2a, 0xac, 0xbd,
-  0x6d, 0x53, 0x6c, 0x3e, 0x25, 0xa6, 0xdb, 0xbd, 0xef, 0x05, 0x2d, 0xbe,
-  0x6f, 0x1d, 0x7b, 0x3e, 0x27, 0x0b, 0xae, 0xbd, 0xdf, 0x05, 0x04, 0xbe,
-  0x28, 0x68, 0x67, 0xbe, 0xbc, 0xba, 0xef, 0xbd, 0x7c, 0x1a, 0x9b, 0x3e,
-  0xb9, 0xdf, 0x77, 0xbe, 0x03, 0x5d, 0x48, 0xbe, 0x40, 0x27, 0x25, 0x3e,
-  0x60, 0xe5, 0xa7, 0xbb, 0x7f, 0x74, 0xc2, 0xbd, 0xed, 0x66, 0x6c, 0xbe,
-  0xd5, 0xfc, 0x8f, 0xbd, 0x37, 0xce, 0xe7, 0x3e, 0x9a, 0xd5, 0xc4, 0xbd,
-  0x1b, 0xab, 0xf3, 0xbd, 0x81, 0x5b, 0x52, 0x3e, 0xdc, 0xc4, 0x9b, 0x3d,
-  0xb4, 0xe6, 0xa8, 0xbd, 0x18, 0x9c, 0x3e, 0xbe, 0xb8, 0xc5, 0x89, 0xbd,
-  0x90, 0x31, 0xfa, 0x3e, 0xa2, 0xaf, 0x0e, 0xbe, 0x82, 0xea, 0x20, 0xbd,
-  0xae, 0xbe, 0x86, 0x3e, 0xc2, 0xaf, 0xcc, 0x3d, 0x5d, 0x5e, 0xf8, 0xbc,
-  0x75, 0xd4, 0x44, 0xbb, 0x98, 0x5e, 0xc1, 0xbd, 0xaa, 0xcf, 0x25, 0x3e,
-  0x6d, 0x5a, 0xda, 0xbd, 0x26, 0x17, 0xc4, 0x3a, 0x3f, 0xb7, 0xd4, 0x3c,
-  0x4f, 0xcf, 0xc3, 0x3d, 0xe6, 0xae, 0x43, 0xbc, 0x2b, 0x3e, 0x58, 0x3d,
-  0x20, 0x23, 0x04, 0xbc, 0x31, 0xb8, 0x4e, 0x3b, 0xa2, 0x41, 0x98, 0x3d,
-  0x69, 0xe9, 0x86, 0x3b, 0xed, 0x3b, 0x1f, 0xbe, 0xb1, 0xd8, 0xba, 0x3c,
-  0x01, 0xfc, 0xae, 0xbb, 0x4c, 0xee, 0x38, 0x3d, 0x66, 0x93, 0x42, 0xbd,
-  0x0a, 0x29, 0x63, 0xbe, 0x71, 0xd2, 0xb6, 0x3b, 0xac, 0xff, 0xad, 0x3d,
-  0xb5, 0x7d, 0x5b, 0xbe, 0xdf, 0xca, 0xd7, 0xbc, 0x4e, 0xdb, 0xda, 0x3c,
-  0xcc, 0xdc, 0x3f, 0x3d, 0xaf, 0x70, 0x13, 0xbe, 0x57, 0x99, 0x97, 0xbe,
-  0xf1, 0x37, 0x31, 0x3d, 0x29, 0x9c, 0x5e, 0xbc, 0x5d, 0xcd, 0xae, 0xbe,
-  0x85, 0x98, 0x98, 0x3d, 0xa4, 0xf3, 0x94, 0x3d, 0x93, 0x68, 0xef, 0x3d,
-  0x0f, 0x00, 0x2a, 0x3d, 0x74, 0x84, 0x37, 0xbe, 0xd4, 0xa0, 0x8f, 0x3d,
-  0xbf, 0xd7, 0x4d, 0x3d, 0x2b, 0xfa, 0x6d, 0xbe, 0x24, 0x76, 0xb7, 0xbd,
-  0xd3, 0x24, 0x9b, 0x3d, 0xa9, 0x93, 0x7e, 0xbe, 0x9b, 0xba, 0xbc, 0xbd,
-  0x6e, 0xa4, 0x48, 0xbe, 0xb9, 0x2a, 0x57, 0xbe, 0x86, 0x27, 0x47, 0xbe,
-  0x56, 0xde, 0x06, 0xbe, 0xae, 0xbe, 0xb4, 0x3b, 0x5b, 0x0e, 0xba, 0x3d,
-  0x71, 0x10, 0xea, 0x3d, 0xf0, 0x45, 0xac, 0x3d, 0x87, 0xb0, 0xed, 0xbd,
-  0x64, 0x2f, 0x93, 0x3d, 0x39, 0xfc, 0x6a, 0x3d, 0xf5, 0x90, 0x04, 0x3d,
-  0x7e, 0xa2, 0xf9, 0x3d, 0xbd, 0x25, 0x1b, 0x3e, 0xc5, 0x2b, 0x0a, 0x3e,
-  0xd6, 0xcb, 0x21, 0x3e, 0xd8, 0x9a, 0xfc, 0xbc, 0x55, 0x0c, 0xcf, 0x3d,
-  0x71, 0xbc, 0x8e, 0x3d, 0x40, 0xe8, 0x9f, 0x3d, 0xf9, 0x44, 0x96, 0x3d,
-  0x9a, 0x89, 0x88, 0x3d, 0x23, 0x26, 0x90, 0x3d, 0x57, 0xa5, 0xce, 0x3d,
-  0x8f, 0x47, 0xca, 0x3c, 0x27, 0xc3, 0x31, 0xbc, 0x4c, 0x38, 0x8d, 0x3d,
-  0x5f, 0x25, 0xa8, 0x3d, 0x49, 0xaf, 0xe9, 0x3d, 0xda, 0x53, 0xa0, 0xbc,
-  0x19, 0x43, 0xf4, 0xbd, 0xac, 0x46, 0x41, 0x3c, 0x32, 0x5d, 0x39, 0x3d,
-  0xbf, 0xb7, 0x65, 0xbd, 0x67, 0x45, 0x54, 0x3d, 0x37, 0x38, 0x02, 0x3e,
-  0x7b, 0xf3, 0x9b, 0x3d, 0xee, 0xd0, 0xa1, 0xbd, 0xc7, 0x9c, 0x46, 0xbe,
-  0x40, 0xb8, 0x65, 0xbd, 0x4c, 0xdc, 0xca, 0x3d, 0xcf, 0xba, 0xf1, 0xbd,
-  0x14, 0x73, 0x01, 0xbe, 0xb8, 0xdf, 0x0a, 0x3e, 0x68, 0x1b, 0x13, 0xbc,
-  0x9c, 0x76, 0x1b, 0xbe, 0x50, 0x61, 0x2b, 0xbe, 0x44, 0x7f, 0xe9, 0xbd,
-  0x84, 0x4f, 0x79, 0x3e, 0x05, 0xbc, 0x55, 0xbe, 0x44, 0x1d, 0x9d, 0xbd,
-  0xd3, 0x68, 0x64, 0x3d, 0x04, 0xfc, 0x73, 0x3d, 0x09, 0xf1, 0x98, 0xbd,
-  0x58, 0x53, 0xee, 0xbd, 0x6a, 0xb0, 0x5f, 0xbd, 0xf4, 0xe2, 0xf3, 0x3d,
-  0x6d, 0x94, 0x0d, 0xbe, 0x1f, 0xd9, 0xa1, 0xbd, 0x2f, 0xbf, 0x49, 0x3d,
-  0xf3, 0xe6, 0x01, 0x3d, 0x09, 0x05, 0x1c, 0x3d, 0xf9, 0xe5, 0x9a, 0x3b,
-  0xb8, 0xa1, 0x22, 0x3d, 0xbf, 0xf3, 0x08, 0x3e, 0x21, 0x41, 0x3c, 0x3d,
-  0x5b, 0x04, 0x75, 0x3d, 0xe5, 0x86, 0x44, 0xbd, 0xf5, 0x5f, 0x2c, 0x3d,
-  0x86, 0x05, 0x12, 0x3e, 0xc8, 0x6c, 0x56, 0x3d, 0x82, 0x81, 0xf6, 0x3d,
-  0xdc, 0x7d, 0x07, 0xbe, 0x78, 0x1f, 0x33, 0x3d, 0x02, 0x92, 0xda, 0x3c,
-  0x31, 0x4a, 0x06, 0xbe, 0x84, 0x4e, 0xa6, 0x3d, 0xae, 0x83, 0x6c, 0x3c,
-  0x30, 0x41, 0x14, 0xbd, 0x25, 0xb8, 0x85, 0xbc, 0x10, 0x65, 0x9e, 0xbe,
-  0xa1, 0x95, 0x98, 0xbc, 0x4d, 0x0e, 0x18, 0xbd, 0xa2, 0x7a, 0xb3, 0xbe,
-  0x14, 0x47, 0x2c, 0x3c, 0xf0, 0x67, 0xb8, 0x3d, 0x6f, 0x6e, 0xdb, 0x3c,
-  0xb5, 0x26, 0x24, 0x3d, 0x99, 0x0d, 0x9b, 0xbe, 0x30, 0x84, 0xb6, 0x3d,
-  0x03, 0x8a, 0x94, 0x3d, 0x17, 0x1e, 0x90, 0xbe, 0x63, 0xe6, 0xf4, 0xbb,
-  0xd3, 0xdb, 0xbb, 0xbc, 0x5e, 0xeb, 0x3c, 0x39, 0xbb, 0xa8, 0x0d, 0x3d,
-  0xd8, 0x87, 0xe5, 0xbd, 0xac, 0xf4, 0x24, 0xbd, 0xc1, 0xaa, 0x19, 0xbd,
-  0x99, 0x27, 0x4c, 0xbe, 0x89, 0x66, 0x93, 0xbd, 0x7e, 0x91, 0x3b, 0xbe,
-  0xd7, 0x42, 0xa3, 0xbe, 0x47, 0x27, 0x20, 0xbe, 0xfc, 0x3e, 0x2b, 0xbe,
-  0x2b, 0x85, 0x74, 0xbe, 0x00, 0x99, 0x1d, 0xbe, 0x09, 0x5d, 0xf6, 0xbd,
-  0xdf, 0xbd, 0x2a, 0x3d, 0xd8, 0xb7, 0xa6, 0x3d, 0x92, 0x83, 0x9c, 0xbc,
-  0x4c, 0xd3, 0x86, 0x3d, 0x0b, 0x22, 0x87, 0xbd, 0xbc, 0x37, 0x1d, 0xbd,
-  0x05, 0xf1, 0xff, 0x3c, 0xae, 0xf8, 0x27, 0x3d, 0x26, 0xf8, 0x11, 0x3e,
-  0xf9, 0x8a, 0x80, 0xbb, 0x75, 0xa3, 0xce, 0x3d, 0xad, 0x13, 0xe0, 0x3d,
-  0x88, 0x27, 0x90, 0xbd, 0x76, 0x6e, 0x1d, 0x3d, 0x49, 0x18, 0xaa, 0x3c,
-  0x0d, 0xfd, 0x19, 0x3e, 0xab, 0xd0, 0x5d, 0x3d, 0x98, 0x23, 0xf1, 0x3d,
-  0x92, 0x50, 0xee, 0xbc, 0xda, 0x85, 0x02, 0x3e, 0xad, 0xfe, 0xd4, 0x3d,
-  0xec, 0x8c, 0x35, 0x3d, 0x50, 0x79, 0xdc, 0x3d, 0x61, 0x66, 0xd2, 0x3c,
-  0x9f, 0xbf, 0xaa, 0x3d, 0x39, 0xcf, 0xb8, 0x3c, 0xd3, 0x9d, 0x67, 0x3d,
-  0x6c, 0xf0, 0xe4, 0x3d, 0x73, 0x17, 0xc5, 0x3d, 0x64, 0x97, 0xd8, 0xbc,
-  0x50, 0xc7, 0x96, 0xbb, 0xed, 0x9c, 0xdb, 0x3c, 0x90, 0xda, 0x9a, 0x3d,
-  0xc9, 0xbd, 0x93, 0xbd, 0xb1, 0xdd, 0x93, 0xbd, 0xf8, 0xbb, 0x8c, 0xbc,
-  0x00, 0xf6, 0xcf, 0x3c, 0x80, 0x86, 0x92, 0xbc, 0x48, 0x5f, 0x6b, 0x3d,
-  0xd4, 0xea, 0xaf, 0x39, 0x63, 0x70, 0x5c, 0xbd, 0x22, 0x7c, 0xb5, 0xbd,
-  0x66, 0x19, 0x02, 0xbd, 0xf9, 0x9c, 0xd0, 0xbd, 0x29, 0xa8, 0xbb, 0x3b,
-  0xb4, 0xe9, 0xa1, 0xbd, 0x79, 0x38, 0x8d, 0xbd, 0x0f, 0x2a, 0x43, 0xbd,
-  0xe3, 0x0d, 0x9d, 0x3b, 0x40, 0xd9, 0xb0, 0x3d, 0x8a, 0x97, 0x27, 0x3d,
-  0xcf, 0x3c, 0xb1, 0x3d, 0x3b, 0xed, 0x4f, 0x3c, 0x60, 0xc1, 0x1e, 0x3d,
-  0x45, 0x08, 0xcf, 0x3b, 0x64, 0x43, 0x05, 0x3d, 0xc7, 0xeb, 0x07, 0xbd,
-  0xe3, 0x8f, 0xfb, 0x3d, 0x86, 0x7b, 0x91, 0x3d, 0x37, 0x2f, 0x26, 0x3c,
-  0xaa, 0x51, 0xdb, 0xbb, 0x54, 0x29, 0x92, 0xbc, 0x2a, 0x5d, 0xbc, 0x3c,
-  0x32, 0xea, 0x89, 0xbd, 0x3a, 0x89, 0x3e, 0xbd, 0xc0, 0x9d, 0xca, 0x3d,
-  0x4d, 0x76, 0x88, 0x3d, 0xdd, 0xa8, 0x72, 0x3d, 0xcd, 0x8a, 0xe5, 0xbd,
-  0xe7, 0xb9, 0xa4, 0x3d, 0x01, 0xb5, 0x0b, 0x3b, 0x7e, 0x06, 0x00, 0xbe,
-  0x97, 0x17, 0x85, 0xbd, 0xc1, 0x29, 0xa4, 0xbc, 0xc8, 0x8f, 0x78, 0x3d,
-  0x19, 0x14, 0x16, 0x3d, 0x6a, 0xfb, 0x5c, 0xbe, 0x19, 0x82, 0xc0, 0x3d,
-  0xe5, 0xcd, 0x61, 0x3b, 0x7d, 0xcd, 0x84, 0xbe, 0x14, 0xe5, 0x87, 0xbd,
-  0x71, 0x62, 0xad, 0x3d, 0x8f, 0xe4, 0x07, 0xbd, 0xdd, 0x6a, 0xef, 0x3b,
-  0x32, 0x4c, 0xc6, 0xbd, 0x98, 0xfa, 0x20, 0xbd, 0x44, 0xd7, 0x93, 0xbd,
-  0xfb, 0x4d, 0x24, 0xbe, 0x62, 0xd4, 0x6e, 0xbc, 0xca, 0x8f, 0x48, 0x3d,
-  0x74, 0x75, 0xc8, 0xbd, 0xda, 0x69, 0xbb, 0x3c, 0xeb, 0x0b, 0x35, 0xbe,
-  0x8f, 0x7d, 0xab, 0xbd, 0xa0, 0x1b, 0xf6, 0xbd, 0x68, 0xb2, 0x0c, 0xbe,
-  0x85, 0x02, 0xde, 0xbd, 0x2b, 0x1c, 0x70, 0xbd, 0x78, 0xee, 0xa6, 0xbd,
-  0xef, 0x20, 0x57, 0xbe, 0x1b, 0xd1, 0x3f, 0xbe, 0x37, 0x71, 0x36, 0xbe,
-  0xf5, 0x9e, 0x0c, 0xbe, 0xa9, 0xa5, 0xd0, 0xbd, 0xe2, 0x61, 0x9f, 0x3d,
-  0xef, 0x86, 0xc4, 0x3d, 0x55, 0x38, 0x70, 0x3d, 0xc1, 0xd2, 0x05, 0x3e,
-  0x4f, 0x1a, 0xdf, 0xbd, 0x20, 0x06, 0xde, 0x3d, 0x18, 0x58, 0x55, 0x3d,
-  0x88, 0xd9, 0x41, 0x3d, 0x59, 0x90, 0x11, 0x3e, 0x7f, 0xe8, 0x27, 0x3d,
-  0x8b, 0x04, 0x3d, 0x3d, 0xb0, 0x67, 0x3b, 0x3d, 0x30, 0x6c, 0x10, 0xbe,
-  0x51, 0xea, 0xba, 0x3c, 0x45, 0xb7, 0xb6, 0x3d, 0xaa, 0xdb, 0x6b, 0x3d,
-  0x6e, 0xf3, 0xf6, 0x3d, 0xc6, 0xf3, 0x5a, 0x3d, 0xab, 0xf6, 0xab, 0xba,
-  0xc7, 0xea, 0x0a, 0x3c, 0x82, 0xfd, 0x82, 0xbd, 0x37, 0x37, 0x22, 0x3d,
-  0xff, 0xa9, 0xf9, 0x3c, 0x46, 0xe7, 0xa9, 0x3e, 0x0b, 0x2a, 0x62, 0x3b,
-  0x6b, 0x42, 0x95, 0x3a, 0x6e, 0xe8, 0x07, 0xbb, 0xeb, 0x1b, 0x9d, 0x3c,
-  0xab, 0x71, 0x0a, 0xbd, 0x3f, 0xb4, 0xfc, 0xbb, 0x8a, 0x98, 0xf0, 0x3d,
-  0xcf, 0x78, 0x80, 0x3e, 0xa0, 0xef, 0xa4, 0xbc, 0x2d, 0xd5, 0xe7, 0x3d,
-  0x44, 0x6f, 0xb6, 0xba, 0xde, 0xbb, 0xac, 0x3d, 0x80, 0xa7, 0x1c, 0xbc,
-  0xde, 0x9c, 0xaf, 0x3d, 0xcb, 0xaf, 0x81, 0x3d, 0xcd, 0x50, 0x18, 0x3e,
-  0x0d, 0x0a, 0x04, 0x3d, 0x3a, 0xfd, 0xbe, 0x3d, 0xc0, 0xb0, 0x0d, 0xbc,
-  0x9a, 0xc0, 0x90, 0x3b, 0xcf, 0x41, 0x15, 0x3c, 0x34, 0xc7, 0x71, 0x3d,
-  0x2a, 0xa1, 0x36, 0x3b, 0x25, 0xf3, 0x29, 0x3e, 0x44, 0x77, 0x39, 0x3d,
-  0x67, 0x78, 0xe0, 0x3b, 0x87, 0xf3, 0xdf, 0xbb, 0xcb, 0xfc, 0xd0, 0x3c,
-  0x16, 0x66, 0xb2, 0xbd, 0xa2, 0x99, 0xff, 0x3b, 0x49, 0x5c, 0x19, 0xbd,
-  0xea, 0xc2, 0xd4, 0x3d, 0xf0, 0xd6, 0x90, 0xbd, 0xe3, 0xbf, 0xaf, 0x3d,
-  0x0e, 0x4d, 0x87, 0xbc, 0x15, 0x03, 0xc5, 0x3d, 0xc9, 0x23, 0xf6, 0x3b,
-  0xa4, 0xbf, 0x22, 0xbd, 0xb8, 0x7e, 0xe1, 0x3a, 0xf9, 0xbf, 0xa4, 0xbd,
-  0x5e, 0x0d, 0x87, 0xbd, 0x4b, 0x9d, 0x85, 0x3c, 0xf1, 0x46, 0x4f, 0x3d,
-  0x13, 0x5a, 0x6a, 0x3c, 0x92, 0x3d, 0x9a, 0xbd, 0x2b, 0xb7, 0x4d, 0xbd,
-  0x87, 0x99, 0xb7, 0x3c, 0x1e, 0x83, 0x99, 0xbd, 0xc9, 0xc1, 0x04, 0xbd,
-  0x44, 0x11, 0x8d, 0x3d, 0x1e, 0xa6, 0x69, 0xbd, 0xc0, 0xfd, 0x99, 0x3d,
-  0x36, 0x80, 0x0a, 0xbe, 0xf0, 0x64, 0x95, 0x3d, 0x5b, 0x30, 0x84, 0xbc,
-  0x58, 0x30, 0x54, 0xbe, 0x32, 0x07, 0xe4, 0xbd, 0x29, 0xee, 0x75, 0x3d,
-  0xc5, 0xfe, 0x84, 0xbd, 0x1a, 0xe9, 0x2d, 0x3d, 0xf4, 0x86, 0xa2, 0xbd,
-  0xcf, 0xac, 0x84, 0xbd, 0x58, 0xe7, 0xc7, 0xbd, 0xe1, 0xe7, 0x0f, 0xbe,
-  0x04, 0x1c, 0x05, 0xbe, 0x37, 0x5c, 0x1b, 0xbd, 0x9e, 0xde, 0x23, 0xbe,
-  0x8a, 0xc4, 0xb4, 0xbc, 0x69, 0x60, 0x36, 0xbe, 0x79, 0x53, 0x08, 0xbe,
-  0xa8, 0x04, 0x17, 0xbe, 0x91, 0x90, 0x2b, 0xbe, 0x6e, 0xed, 0x59, 0xbd,
-  0x75, 0x5e, 0x0e, 0xbe, 0x32, 0xa9, 0x14, 0xbe, 0x7c, 0xf0, 0x71, 0xbd,
-  0xb6, 0x14, 0x54, 0xbe, 0xd3, 0xc1, 0x3b, 0xbc, 0x49, 0xb5, 0xa7, 0xbd,
-  0x86, 0x4d, 0xc5, 0xbd, 0xac, 0x2e, 0x8e, 0xbd, 0x18, 0xdf, 0x86, 0x3d,
-  0x2e, 0xeb, 0xea, 0x3c, 0xd2, 0xad, 0x3f, 0x3d, 0xdf, 0x7c, 0x72, 0xbd,
-  0xa3, 0xb7, 0xcd, 0x3d, 0x0b, 0x85, 0xa8, 0x3d, 0x4e, 0xf7, 0x16, 0xbe,
-  0x3d, 0x7c, 0xb6, 0x3c, 0xf7, 0xf1, 0xaa, 0x3d, 0xc1, 0xe8, 0xe2, 0xba,
-  0xab, 0xd3, 0xc5, 0x3d, 0xd7, 0x2f, 0x15, 0xbd, 0x17, 0xac, 0x33, 0x3d,
-  0xbd, 0xf8, 0xad, 0x3c, 0xc0, 0xd1, 0xf9, 0xbd, 0x6d, 0xe2, 0xe7, 0x3d,
-  0x30, 0x20, 0x7d, 0x3d, 0x93, 0x87, 0xe8, 0x3d, 0x19, 0xb1, 0x27, 0x3e,
-  0x85, 0xa7, 0x6e, 0x3d, 0x77, 0xd2, 0x2e, 0x3d, 0x72, 0x45, 0xf0, 0x3d,
-  0x6e, 0xe7, 0xa1, 0xbd, 0xf2, 0x5c, 0x04, 0x3e, 0x75, 0x26, 0xaa, 0x3d,
-  0x99, 0x3f, 0x0c, 0x3e, 0xf3, 0x01, 0xfa, 0x3d, 0x26, 0xfd, 0xa2, 0x3c,
-  0xdd, 0x1f, 0x0f, 0x3e, 0x21, 0xd8, 0xb7, 0x3d, 0xdc, 0xf2, 0xa2, 0xbd,
-  0x13, 0x8b, 0x2c, 0x3e, 0x91, 0x2f, 0x9d, 0x3d, 0x81, 0x69, 0xe4, 0x3d,
-  0xbb, 0x95, 0xdf, 0x3d, 0x6f, 0xed, 0x88, 0x3d, 0x7b, 0x06, 0xc8, 0x3c,
-  0x87, 0xa6, 0x2b, 0x3e, 0x82, 0xeb, 0x95, 0xbd, 0x04, 0x4f, 0xed, 0x3d,
-  0x13, 0xd7, 0x05, 0x3e, 0xa5, 0x7e, 0xe7, 0x3d, 0x77, 0x7c, 0xec, 0x3d,
-  0xaa, 0xe5, 0x98, 0x3a, 0x49, 0x9e, 0x64, 0x3d, 0xca, 0x06, 0xcc, 0x3d,
-  0x5e, 0x80, 0xd0, 0x3c, 0x6f, 0xc1, 0x63, 0x3c, 0x04, 0xa3, 0x7c, 0xbc,
-  0x6c, 0xce, 0xa6, 0xbd, 0x0a, 0x40, 0xa0, 0x3d, 0xfa, 0x99, 0xbe, 0xbc,
-  0xff, 0xd4, 0x34, 0x3d, 0xe9, 0x5d, 0x98, 0x3d, 0x04, 0xdd, 0x65, 0xbd,
-  0x08, 0x84, 0xa1, 0xbc, 0x5d, 0x1b, 0x09, 0xbc, 0x8b, 0x73, 0x5e, 0xbd,
-  0x4e, 0x49, 0x60, 0x3d, 0xdf, 0xd9, 0x1f, 0x3a, 0xbd, 0x87, 0xd4, 0x3c,
-  0x69, 0xa8, 0x5a, 0x3d, 0x63, 0x2d, 0x08, 0xbd, 0x8c, 0xbb, 0x86, 0xbd,
-  0x92, 0xfe, 0xac, 0xbc, 0x19, 0xcc, 0x7a, 0x3d, 0x57, 0xcf, 0x84, 0x3c,
-  0xe7, 0xc7, 0x9a, 0xbd, 0x24, 0xef, 0x7f, 0x3c, 0x85, 0x41, 0x41, 0x3d,
-  0x95, 0x14, 0x1c, 0xbe, 0xb2, 0x27, 0x90, 0x3d, 0xf5, 0x30, 0xa3, 0xbd,
-  0x80, 0xc4, 0x1b, 0x3d, 0x9e, 0x3a, 0x17, 0xbd, 0x81, 0x18, 0x1b, 0xbe,
-  0x2e, 0xc3, 0x1a, 0x3d, 0x9b, 0x16, 0x0b, 0x3d, 0x01, 0x65, 0x46, 0xbe,
-  0x04, 0x18, 0xaa, 0xbd, 0x5e, 0x77, 0xbc, 0x3c, 0xad, 0x77, 0x1c, 0xbb,
-  0xb4, 0xbf, 0x99, 0xbd, 0x85, 0x44, 0xa0, 0xbd, 0x49, 0x70, 0x78, 0xbd,
-  0x25, 0xd6, 0xcc, 0xbc, 0xfe, 0x39, 0x25, 0xbe, 0xa2, 0x00, 0x5b, 0xbd,
-  0xc1, 0xfc, 0xb0, 0xbd, 0xac, 0x67, 0x27, 0xbe, 0xb1, 0x40, 0xb6, 0xbc,
-  0xe1, 0x38, 0x22, 0xbe, 0xae, 0x5f, 0x23, 0xbd, 0xbf, 0xcc, 0x10, 0xbe,
-  0x8a, 0x90, 0xba, 0xbd, 0xb0, 0x7f, 0x87, 0xbd, 0xfb, 0x31, 0xe5, 0xbd,
-  0x3f, 0x07, 0x92, 0xbd, 0x8e, 0xce, 0x20, 0xbe, 0xe0, 0xf7, 0x13, 0xbe,
-  0xb2, 0x40, 0xd6, 0xbd, 0x24, 0x35, 0x24, 0xbe, 0x8a, 0xb8, 0x9a, 0x3d,
-  0x83, 0x21, 0xb9, 0xbd, 0xd2, 0x7c, 0x23, 0x3d, 0x07, 0x3e, 0x05, 0x3d,
-  0x59, 0xf2, 0x0e, 0x3d, 0x89, 0xeb, 0xba, 0x3d, 0x23, 0xec, 0x59, 0x3c,
-  0x1c, 0x2b, 0x8d, 0xbb, 0xa5, 0x5c, 0x18, 0x3d, 0x7d, 0xaa, 0x66, 0xbd,
-  0x62, 0x92, 0x97, 0xbd, 0x25, 0x74, 0xb3, 0xbc, 0xfe, 0x25, 0xe1, 0xbc,
-  0x29, 0x4c, 0x84, 0x3d, 0xf6, 0x50, 0xe3, 0xbc, 0xba, 0xec, 0x7c, 0xbc,
-  0x94, 0xc6, 0x84, 0xbb, 0x0e, 0x5c, 0x60, 0xbd, 0xe2, 0xd8, 0x07, 0xbe,
-  0xd9, 0x74, 0xfe, 0xbd, 0xca, 0x51, 0x0e, 0xbe, 0xc0, 0xf2, 0xed, 0x3d,
-  0x0f, 0xe9, 0xc7, 0xbd, 0x95, 0xed, 0x15, 0xbe, 0xc9, 0x8e, 0x8f, 0xbd,
-  0xae, 0x4a, 0x68, 0xbe, 0xa2, 0x3e, 0xfc, 0xbd, 0x4d, 0xb2, 0x5c, 0xbe,
-  0xfe, 0x7f, 0x32, 0xbd, 0x30, 0xe3, 0xcf, 0x3d, 0xfa, 0x23, 0x28, 0xbe,
-  0xd0, 0x05, 0x56, 0xbe, 0xbb, 0xfb, 0x26, 0xbe, 0x79, 0xaa, 0x82, 0xbe,
-  0x2e, 0x51, 0x72, 0xbe, 0xd1, 0xef, 0x61, 0xbe, 0x56, 0xa0, 0x08, 0xbe,
-  0x8f, 0xcc, 0xe6, 0x3d, 0x15, 0x86, 0xaa, 0xbe, 0x21, 0x74, 0x76, 0xbe,
-  0x6f, 0xcc, 0x61, 0xbe, 0x52, 0x53, 0xa7, 0xbe, 0x0f, 0x29, 0x86, 0xbe,
-  0x58, 0x4c, 0x80, 0xbe, 0x1a, 0x52, 0x08, 0xbe, 0x19, 0x29, 0xe9, 0x3d,
-  0x1d, 0x95, 0x9c, 0xbe, 0x8f, 0x6f, 0x4e, 0xbe, 0x88, 0xdb, 0xa5, 0xbd,
-  0x30, 0x36, 0x88, 0xbe, 0x2e, 0x43, 0xb7, 0xbe, 0x1c, 0x10, 0x20, 0xbe,
-  0x13, 0xdb, 0x8a, 0xbe, 0xc5, 0x91, 0xdc, 0x3d, 0x16, 0xdf, 0x29, 0xbe,
-  0xa8, 0xd2, 0x5e, 0xbe, 0xce, 0xa4, 0x04, 0xbe, 0xf1, 0x6c, 0x69, 0xbe,
-  0x11, 0x2a, 0x68, 0xbe, 0x21, 0x7f, 0x40, 0xbe, 0xfc, 0x2c, 0x26, 0xbe,
-  0x91, 0x26, 0x99, 0x3c, 0x19, 0x21, 0x53, 0xbe, 0x8c, 0x60, 0x47, 0xbe,
-  0xa4, 0x32, 0x40, 0xbd, 0xac, 0xab, 0x65, 0xbe, 0xf8, 0x6b, 0x57, 0xbe,
-  0x96, 0x9f, 0x54, 0xbe, 0x9d, 0xa2, 0x7f, 0xbe, 0x1b, 0x50, 0x7d, 0x3d,
-  0xe9, 0x94, 0x6b, 0xbe, 0x88, 0xa4, 0x84, 0xbe, 0x0b, 0xa5, 0x39, 0xbd,
-  0xc4, 0x24, 0x09, 0xbd, 0x0f, 0x35, 0xcb, 0xbd, 0x59, 0x02, 0x04, 0xbe,
-  0x59, 0xc4, 0xf7, 0xbd, 0x43, 0xca, 0xa0, 0x3d, 0xc4, 0x3c, 0xab, 0xbe,
-  0x79, 0xf9, 0x7e, 0xbd, 0x75, 0x40, 0xe1, 0x3d, 0x50, 0xa7, 0x1a, 0xbe,
-  0xfd, 0x00, 0xd9, 0xbd, 0x10, 0xe6, 0xc5, 0xbd, 0xfa, 0x14, 0xd5, 0xbd,
-  0xb1, 0x47, 0xfa, 0x3d, 0x26, 0xb0, 0x2c, 0xbd, 0x4c, 0xb1, 0x9d, 0xbd,
-  0xbb, 0x99, 0x6c, 0x3c, 0x9a, 0xdc, 0x32, 0xbe, 0x3b, 0x23, 0x20, 0xbd,
-  0xd9, 0x08, 0xd0, 0xbd, 0xe3, 0x5d, 0xcc, 0xbd, 0x07, 0xb9, 0xff, 0x3d,
-  0xc4, 0x86, 0x43, 0xbd, 0x41, 0xb6, 0x3c, 0xbd, 0x78, 0x6d, 0x90, 0x3d,
-  0x17, 0xdb, 0x09, 0xbb, 0x7e, 0xdc, 0x7f, 0xbd, 0xb8, 0x4f, 0xaa, 0xbd,
-  0xa2, 0x6b, 0x4a, 0xbc, 0x4c, 0x1e, 0x8e, 0x3d, 0x1e, 0xf1, 0x36, 0xbd,
-  0xb5, 0x16, 0xf7, 0x3c, 0x8d, 0xd7, 0xf4, 0x3c, 0x73, 0xb1, 0xda, 0xbb,
-  0x7f, 0xfb, 0x88, 0xbd, 0x44, 0x0d, 0xbf, 0xbc, 0x32, 0x7d, 0x52, 0xbd,
-  0x6f, 0xc8, 0x8d, 0x3d, 0x9a, 0x79, 0x10, 0xbd, 0xa1, 0xe5, 0x88, 0x3d,
-  0xf6, 0x8c, 0xa0, 0x3d, 0xd8, 0xcf, 0x2c, 0xbd, 0x3c, 0xc4, 0xf4, 0x3c,
-  0xa0, 0xa4, 0x44, 0x3d, 0x08, 0x5a, 0xc3, 0x3c, 0xc6, 0x11, 0x0c, 0x3e,
-  0x77, 0x7c, 0xe0, 0xbc, 0xbc, 0xb7, 0xca, 0x3c, 0x96, 0x10, 0xc6, 0x3d,
-  0xe6, 0xf0, 0x1a, 0x3d, 0xcd, 0x36, 0x66, 0xbd, 0x3e, 0x4a, 0x98, 0xbd,
-  0x5b, 0x30, 0x13, 0xbe, 0x7d, 0x37, 0x8d, 0x3d, 0x57, 0x4f, 0x04, 0xbd,
-  0x66, 0x94, 0x95, 0x3c, 0x3d, 0xaf, 0xa4, 0x3c, 0x1e, 0xe8, 0x75, 0xbd,
-  0x0c, 0x86, 0xbf, 0xbd, 0x18, 0xa2, 0x5d, 0xbd, 0xf6, 0x6f, 0xc0, 0xbd,
-  0x7b, 0x1d, 0xa3, 0x3d, 0xc2, 0xb7, 0x46, 0xbe, 0xdd, 0x93, 0xf9, 0xbd,
-  0xac, 0x25, 0x78, 0xbc, 0x68, 0x45, 0xde, 0xbd, 0x81, 0xf0, 0x11, 0xbe,
-  0x71, 0x9c, 0x9d, 0xbd, 0x4e, 0xfa, 0x19, 0xbe, 0xcf, 0x0e, 0xf5, 0x3d,
-  0xf8, 0x32, 0xdb, 0xbd, 0x29, 0x10, 0x1f, 0xbe, 0xdc, 0xb1, 0xb0, 0x3c,
-  0x09, 0x57, 0xa7, 0xbd, 0x9e, 0x2c, 0x06, 0xbe, 0x32, 0xcb, 0x00, 0xbe,
-  0xa1, 0xe3, 0x91, 0xbe, 0x46, 0x1c, 0x02, 0x3e, 0xf6, 0xee, 0x15, 0xbe,
-  0x99, 0x5f, 0x4d, 0xbd, 0xf2, 0xb2, 0xa1, 0x3d, 0xf0, 0xa8, 0x70, 0xbd,
-  0x07, 0x78, 0x6e, 0xbd, 0x34, 0xaf, 0x55, 0xbd, 0x15, 0xeb, 0xa9, 0xbe,
-  0x0b, 0x26, 0x7b, 0xbd, 0xb1, 0xc7, 0x16, 0xbe, 0x3f, 0xd7, 0x57, 0xbd,
-  0xfd, 0x98, 0xd9, 0x3d, 0x70, 0xfe, 0x17, 0xbd, 0xa1, 0x00, 0xa2, 0xbb,
-  0x5f, 0x79, 0x91, 0x3d, 0x88, 0x9a, 0x1b, 0xbe, 0x7a, 0xa8, 0x81, 0x3d,
-  0x95, 0x19, 0xa9, 0xbd, 0x40, 0x6b, 0x9c, 0xbd, 0xe3, 0x8f, 0x0b, 0x3d,
-  0x2d, 0xed, 0x27, 0xbd, 0xd1, 0xa2, 0xbe, 0xbc, 0x3a, 0x5a, 0x88, 0x3d,
-  0x13, 0xd3, 0x33, 0xbe, 0x26, 0x42, 0xf0, 0x3d, 0xaa, 0x86, 0x73, 0xbc,
-  0x5a, 0x8f, 0xc3, 0xbc, 0x19, 0x12, 0xc7, 0x3d, 0xe8, 0xe3, 0x28, 0x3d,
-  0xd5, 0x97, 0x55, 0x3d, 0xb0, 0x79, 0xed, 0x3d, 0xe9, 0xa1, 0xeb, 0xbd,
-  0x10, 0x79, 0x08, 0x3e, 0x4f, 0x78, 0x8a, 0x3d, 0x2f, 0xd9, 0xa8, 0x3d,
-  0x8a, 0x7e, 0xcc, 0x3d, 0x10, 0x50, 0xf4, 0x3d, 0x53, 0x87, 0x88, 0x3d,
-  0x39, 0x89, 0xe1, 0xbb, 0x94, 0x05, 0xc7, 0xbb, 0xe0, 0x33, 0xe4, 0x3d,
-  0xbd, 0x3f, 0x55, 0x3c, 0xe7, 0x48, 0x4a, 0x3d, 0x6d, 0x93, 0xc6, 0x3d,
-  0x48, 0x54, 0x1e, 0x3d, 0x5a, 0x29, 0x61, 0x3d, 0xd1, 0xb1, 0x1d, 0x3e,
-  0x8b, 0xbb, 0xac, 0x3c, 0xee, 0x13, 0x92, 0x3d, 0xc7, 0xf7, 0x8f, 0x3d,
-  0xb0, 0xc5, 0xd4, 0x3d, 0x14, 0x65, 0x89, 0x3d, 0x42, 0x55, 0x59, 0xbd,
-  0x69, 0x43, 0x5d, 0x3d, 0xa2, 0x4d, 0x91, 0x3d, 0x85, 0x48, 0xa9, 0x3d,
-  0xd9, 0x7b, 0x1a, 0x3d, 0x8f, 0x0d, 0x8d, 0x3d, 0x2d, 0xe4, 0x84, 0xbc,
-  0x57, 0xc7, 0x3f, 0x3d, 0x5d, 0x17, 0x69, 0xbd, 0xba, 0x2e, 0xe7, 0xbd,
-  0x79, 0x89, 0xc7, 0xbd, 0x45, 0xea, 0xf7, 0x3c, 0x96, 0xda, 0xec, 0x3d,
-  0xab, 0xb6, 0xb6, 0xbd, 0xf5, 0x74, 0xe1, 0xbd, 0x58, 0x94, 0x53, 0x3d,
-  0x03, 0x5f, 0xd1, 0x3d, 0xaf, 0xa2, 0xe7, 0xbc, 0xc8, 0x52, 0xab, 0x3b,
-  0xa8, 0x85, 0xf6, 0xbd, 0x5f, 0x59, 0xbe, 0x3d, 0x85, 0x3b, 0x88, 0x3c,
-  0xf4, 0x94, 0xa4, 0x3c, 0xa7, 0x2a, 0x7c, 0x3c, 0xef, 0xfa, 0x8a, 0x3d,
-  0x2b, 0xdc, 0xf6, 0xbc, 0xf2, 0x14, 0x83, 0x3d, 0xd4, 0xa5, 0x08, 0xbe,
-  0xe9, 0x28, 0x4a, 0x3d, 0xd5, 0xd1, 0x1e, 0xbd, 0xfd, 0xdd, 0xd2, 0xbb,
-  0x87, 0x1c, 0xec, 0x3c, 0xab, 0x39, 0x2d, 0x3d, 0x69, 0xd0, 0xc4, 0xbc,
-  0x8a, 0x95, 0xab, 0x3d, 0x53, 0xf7, 0x6e, 0xbd, 0x44, 0x7e, 0x78, 0x3c,
-  0x3d, 0x53, 0x16, 0xbc, 0xe6, 0x60, 0xa8, 0x3c, 0xa9, 0x3a, 0xe3, 0x3c,
-  0x6d, 0xb9, 0x24, 0x3d, 0x80, 0x10, 0xf2, 0xba, 0x48, 0x68, 0xa7, 0xbc,
-  0x33, 0x0f, 0xb4, 0xbc, 0x05, 0x1b, 0x83, 0x3d, 0x5b, 0x8d, 0x9b, 0xbd,
-  0xf2, 0x82, 0xf9, 0x3a, 0xce, 0xfa, 0x34, 0xbd, 0xfa, 0x21, 0xe6, 0xbd,
-  0x2f, 0xf1, 0xc0, 0xbd, 0x60, 0x82, 0xbe, 0xbb, 0x01, 0x5f, 0x23, 0xbe,
-  0xb8, 0x65, 0x87, 0xbd, 0xea, 0x73, 0x73, 0xbb, 0x43, 0xb9, 0xc9, 0xbd,
-  0x2a, 0x1e, 0xfa, 0xbd, 0xd5, 0x58, 0xf8, 0xbd, 0xaf, 0x37, 0x0d, 0xbd,
-  0x7d, 0x4c, 0x63, 0xbd, 0xa6, 0x92, 0xf2, 0xbd, 0x3d, 0x50, 0xa6, 0xbe,
-  0x97, 0x36, 0x8f, 0xbd, 0x1e, 0x50, 0xc3, 0xbd, 0x2b, 0x71, 0xd3, 0xbd,
-  0xbd, 0x2f, 0x19, 0xbe, 0xf9, 0x75, 0xf4, 0x3b, 0xb7, 0xff, 0x9d, 0xbc,
-  0x37, 0x78, 0x24, 0xbe, 0x8c, 0x6a, 0xbc, 0xbe, 0xed, 0xf4, 0x9a, 0x3c,
-  0xb3, 0x65, 0x35, 0xbd, 0x6f, 0x30, 0x83, 0x3d, 0x7c, 0xb8, 0x9b, 0xbd,
-  0xb7, 0xd2, 0x8b, 0xbd, 0x13, 0x0c, 0x2c, 0x3d, 0xfa, 0x47, 0x91, 0xbd,
-  0x7b, 0xb9, 0x71, 0xbe, 0x57, 0xe5, 0x9f, 0x3d, 0xef, 0xdf, 0x0d, 0x3d,
-  0x1e, 0xb8, 0x88, 0xbd, 0x69, 0x64, 0xbe, 0xbd, 0x82, 0x5d, 0x3f, 0xbd,
-  0x46, 0x47, 0x28, 0x3d, 0x14, 0xc1, 0x3e, 0x3d, 0xd6, 0x0a, 0x85, 0xbd,
-  0xf0, 0x17, 0x4c, 0x3d, 0x5a, 0xda, 0x07, 0x3d, 0xc4, 0x9f, 0xdb, 0x3d,
-  0xb4, 0x9f, 0xa2, 0x3c, 0x5b, 0x58, 0x79, 0x3d, 0x62, 0xfb, 0x19, 0x3e,
-  0x25, 0x15, 0x94, 0x3d, 0xf2, 0x5d, 0x03, 0x3d, 0x2e, 0x2e, 0x03, 0x3e,
-  0xd2, 0x30, 0x09, 0x3d, 0x96, 0x37, 0x27, 0x3e, 0x3c, 0xb5, 0x92, 0x3d,
-  0x74, 0xc2, 0x83, 0x3d, 0x61, 0x80, 0xe5, 0x3d, 0x3f, 0x8c, 0x3f, 0x3e,
-  0x3d, 0x04, 0x74, 0x3d, 0x24, 0xe1, 0x36, 0x3e, 0x87, 0x46, 0x7f, 0x3d,
-  0xc1, 0x01, 0x81, 0x3d, 0xa2, 0xd3, 0x8e, 0x3d, 0x22, 0xb9, 0x6f, 0x3d,
-  0xb1, 0xcf, 0x48, 0x3d, 0x68, 0xb6, 0x78, 0xbc, 0x65, 0x53, 0x8c, 0x3d,
-  0x67, 0x92, 0xfb, 0x3c, 0x7b, 0x0f, 0xdd, 0x3c, 0x81, 0x5f, 0xdf, 0x3d,
-  0x18, 0xf0, 0x99, 0xbd, 0x07, 0xbc, 0x15, 0xbd, 0x22, 0x3d, 0xa5, 0xbd,
-  0xec, 0xc5, 0xb4, 0xbd, 0x5f, 0x3c, 0xa2, 0x3d, 0xc7, 0x24, 0x71, 0xbd,
-  0xe1, 0xdf, 0xda, 0xbc, 0x70, 0x6f, 0xa9, 0xbc, 0x51, 0x07, 0xd7, 0x3b,
-  0x64, 0xa4, 0x87, 0x3d, 0xa3, 0xc9, 0xb5, 0x3d, 0xb8, 0x02, 0xc5, 0xbc,
-  0xfd, 0xfd, 0xfe, 0x3d, 0x33, 0x84, 0x00, 0x3b, 0x83, 0x4c, 0xca, 0x3d,
-  0x0e, 0x88, 0xf3, 0xbd, 0x78, 0x0e, 0xfc, 0x3a, 0x75, 0x14, 0x3f, 0xbd,
-  0x8f, 0x74, 0xdb, 0xbc, 0xb7, 0xba, 0x0c, 0xbe, 0xf4, 0x22, 0x57, 0xbb,
-  0x0d, 0x36, 0x89, 0xbd, 0x39, 0x51, 0x1c, 0x3d, 0x9c, 0x8d, 0x9f, 0xbd,
-  0x32, 0xd8, 0x98, 0x3d, 0x6d, 0xb0, 0x68, 0xbd, 0x48, 0x71, 0x3a, 0xbd,
-  0x26, 0x78, 0xef, 0xbd, 0x5c, 0xbb, 0x01, 0xbe, 0xdb, 0x9a, 0xda, 0x3c,
-  0x80, 0x04, 0xdb, 0xbc, 0x88, 0xf5, 0xae, 0xbd, 0xd0, 0xbe, 0xc1, 0x3c,
-  0x12, 0xbd, 0x53, 0xbd, 0x41, 0x8d, 0xa0, 0xbb, 0x5b, 0x94, 0xe2, 0xbd,
-  0xf9, 0x9c, 0x49, 0xbe, 0x9e, 0xd0, 0x5c, 0xbc, 0x80, 0xe7, 0x25, 0x3d,
-  0xbc, 0x89, 0x28, 0xbe, 0x39, 0x94, 0xb8, 0xbd, 0xed, 0xdd, 0xde, 0xbc,
-  0x1e, 0xb5, 0x2c, 0x3d, 0xf4, 0x5e, 0x2f, 0xbe, 0x7c, 0xd9, 0x04, 0xbf,
-  0x0d, 0x5e, 0x15, 0xbd, 0x84, 0x49, 0xd4, 0xbd, 0x7b, 0x6e, 0xb1, 0xbe,
-  0xa6, 0x4e, 0x6c, 0xbe, 0xa8, 0x0d, 0x1e, 0xbe, 0x95, 0xdb, 0xf3, 0xbc,
-  0xa1, 0x7e, 0x42, 0xbe, 0xa2, 0xd8, 0x2b, 0xbf, 0x66, 0xe3, 0xe8, 0xbd,
-  0x2e, 0x3a, 0xbe, 0xbd, 0x20, 0xaf, 0xe0, 0xbe, 0x2e, 0x9b, 0x1f, 0xbe,
-  0x2f, 0xb9, 0xd7, 0xbd, 0xc5, 0xab, 0x62, 0xbd, 0x64, 0xc5, 0x89, 0xbe,
-  0xab, 0x28, 0x41, 0xbf, 0x3b, 0x5c, 0xeb, 0xbd, 0x37, 0xd0, 0x56, 0xbd,
-  0xcc, 0x90, 0x1a, 0xbe, 0x8a, 0x1e, 0x42, 0xbe, 0x05, 0xf8, 0x75, 0xbd,
-  0x77, 0x58, 0x37, 0x3e, 0x98, 0x8f, 0x2f, 0xbe, 0xb4, 0x51, 0x2a, 0xbf,
-  0xde, 0x34, 0x55, 0x3d, 0x5c, 0x9f, 0xfa, 0x3b, 0x37, 0x6e, 0x83, 0xbc,
-  0xba, 0xf0, 0x26, 0xbe, 0xe9, 0x65, 0x4f, 0x3c, 0x39, 0x98, 0xb4, 0x3d,
-  0xf6, 0x4d, 0xf4, 0x3c, 0x6a, 0x19, 0x91, 0xbe, 0x89, 0x57, 0x87, 0x3d,
-  0xbb, 0x03, 0xd2, 0xbc, 0x5d, 0x41, 0x2f, 0x3d, 0x8e, 0x43, 0xa8, 0xbd,
-  0xa2, 0x5c, 0x66, 0x3d, 0x79, 0xab, 0xb0, 0x3d, 0xd3, 0x3b, 0x8e, 0x3d,
-  0x9f, 0xa8, 0xc8, 0xbd, 0x11, 0xd3, 0x02, 0x3e, 0xd2, 0xc2, 0x1b, 0x3c,
-  0xfd, 0x07, 0x86, 0xbd, 0x59, 0xeb, 0x06, 0xbd, 0xea, 0x7d, 0xb7, 0xbb,
-  0xd5, 0x31, 0x0b, 0x3d, 0x74, 0xda, 0x8d, 0x3d, 0xe8, 0x0d, 0x8a, 0x3c,
-  0x3c, 0x64, 0x0e, 0x3d, 0xb3, 0x1c, 0x85, 0x3d, 0x09, 0xc9, 0x16, 0x3d,
-  0x83, 0xc9, 0x29, 0x3d, 0x92, 0x22, 0x5d, 0x3c, 0x19, 0x22, 0xa3, 0xbc,
-  0xfc, 0x7b, 0xbb, 0x3d, 0x4c, 0x77, 0xc6, 0x3d, 0xfe, 0xfb, 0x90, 0xbb,
-  0x63, 0x59, 0x4c, 0x3d, 0xc0, 0xb5, 0xe6, 0xbc, 0x00, 0xbc, 0x2d, 0xbe,
-  0xe8, 0x34, 0xf9, 0xbd, 0x2e, 0xcd, 0x6b, 0xbe, 0xde, 0xd0, 0xc5, 0xbd,
-  0x47, 0x83, 0x31, 0x3d, 0xaa, 0xe6, 0x35, 0xbe, 0x20, 0xce, 0x54, 0xbe,
-  0x16, 0xad, 0x17, 0xbe, 0x8b, 0x85, 0x08, 0xbe, 0x04, 0x4e, 0x00, 0xbd,
-  0xdd, 0x00, 0x9b, 0xbd, 0x4f, 0x51, 0xe6, 0xbd, 0x78, 0x0b, 0x28, 0x3c,
-  0x5b, 0x8e, 0xa0, 0xbc, 0x69, 0x84, 0xd8, 0xbd, 0x95, 0xae, 0x26, 0xbe,
-  0xc1, 0x1e, 0x0f, 0xbd, 0x68, 0x49, 0xa3, 0xbd, 0x21, 0x13, 0x93, 0xbc,
-  0xb3, 0x48, 0x03, 0xbe, 0xfb, 0xba, 0x2d, 0xbd, 0x05, 0x10, 0xbd, 0xbd,
-  0xe6, 0x1d, 0x2b, 0xbd, 0x83, 0xe9, 0x9d, 0xbd, 0x83, 0x71, 0xfc, 0x3d,
-  0x40, 0x9e, 0x4e, 0x3c, 0x4b, 0x01, 0x61, 0x3d, 0xcd, 0x25, 0x2b, 0xbe,
-  0x38, 0xde, 0x2e, 0xbe, 0x6d, 0xe7, 0xef, 0xbc, 0xed, 0xed, 0x3e, 0x3d,
-  0x3e, 0x0a, 0x26, 0xbd, 0xc4, 0x8e, 0x70, 0x3c, 0x83, 0x69, 0x5d, 0x3d,
-  0x3a, 0x26, 0x72, 0x3d, 0x4a, 0xfe, 0x41, 0xbe, 0x32, 0x02, 0x01, 0xbf,
-  0x2d, 0x24, 0x70, 0x3c, 0x28, 0xeb, 0xcc, 0x3d, 0x9d, 0x88, 0xda, 0xbd,
-  0x91, 0xb1, 0x76, 0xbd, 0xe0, 0x63, 0xe6, 0xbc, 0x49, 0xac, 0x1c, 0x3e,
-  0xcd, 0xe7, 0x95, 0xbc, 0xde, 0x84, 0x02, 0xbf, 0x5c, 0x66, 0x5c, 0x3d,
-  0x8f, 0xe3, 0x4d, 0x3d, 0x11, 0xd9, 0xcc, 0xbe, 0x13, 0xad, 0x58, 0xbe,
-  0x59, 0xf3, 0x32, 0xbe, 0x0d, 0xe7, 0x7c, 0xbc, 0xe1, 0xfd, 0xf2, 0xbd,
-  0x62, 0x0d, 0xc6, 0xbe, 0x4f, 0xe2, 0x53, 0xbd, 0xfc, 0x65, 0x0e, 0xbe,
-  0xb8, 0x4c, 0xa2, 0xbe, 0x12, 0x9d, 0x07, 0xbe, 0xe2, 0xb4, 0x1d, 0xbe,
-  0x71, 0xc0, 0xb8, 0x3c, 0x1f, 0x9b, 0x28, 0xbe, 0xf8, 0x0b, 0xfd, 0xbe,
-  0xbf, 0xdf, 0xfc, 0xbd, 0x2d, 0x01, 0xe2, 0xbc, 0xe4, 0x24, 0x3e, 0xbe,
-  0x17, 0x48, 0x83, 0xbd, 0xcc, 0xb0, 0x0e, 0x3c, 0x4e, 0x19, 0x01, 0x3e,
-  0x77, 0x7e, 0x12, 0xbe, 0xb4, 0x43, 0x3d, 0xbf, 0x8a, 0xa6, 0xc2, 0x3d,
-  0xa8, 0x3f, 0xee, 0x3c, 0x22, 0xf2, 0x30, 0xbc, 0x77, 0x7d, 0x20, 0xbe,
-  0x25, 0xb4, 0x00, 0x3d, 0xd6, 0x04, 0xb9, 0x3d, 0x42, 0x6b, 0x36, 0x3d,
-  0xdd, 0x35, 0x9e, 0xbe, 0xd7, 0x18, 0x29, 0xbc, 0x05, 0x3c, 0x92, 0xbd,
-  0x3c, 0x89, 0x0b, 0xbd, 0x28, 0xb0, 0xf0, 0xbd, 0x04, 0xdf, 0x78, 0x3c,
-  0xed, 0x98, 0x87, 0x3d, 0x55, 0x33, 0x1d, 0x3d, 0xb9, 0x21, 0xd5, 0xbd,
-  0x89, 0xfc, 0xf1, 0x3c, 0xfa, 0x0a, 0x36, 0xbd, 0x39, 0xb5, 0x42, 0xbe,
-  0xe5, 0x23, 0x50, 0xbe, 0x5a, 0x3c, 0x40, 0xbc, 0x91, 0x57, 0x73, 0xbd,
-  0x87, 0x8b, 0x4c, 0x3d, 0x74, 0xd0, 0x4e, 0x3d, 0x44, 0x75, 0x01, 0x3d,
-  0xf0, 0xa9, 0xeb, 0xbd, 0xdf, 0xe9, 0xf8, 0xbd, 0x4f, 0x38, 0xb2, 0xbd,
-  0x91, 0x5b, 0x06, 0xbd, 0x99, 0x69, 0x6e, 0xbe, 0xfa, 0x40, 0xb0, 0xbc,
-  0xc7, 0xdf, 0x99, 0x3d, 0xc8, 0x71, 0x05, 0xbe, 0xd8, 0x9b, 0xec, 0xbd,
-  0x0a, 0x39, 0x5b, 0x3d, 0x54, 0xc0, 0x05, 0xbe, 0x17, 0xa0, 0xfd, 0xbd,
-  0xc5, 0x6e, 0x0d, 0xbe, 0xcf, 0x1f, 0x10, 0xbe, 0xe8, 0xfa, 0x6c, 0x3d,
-  0xe9, 0xb8, 0x3c, 0xbe, 0xf1, 0x10, 0x25, 0xbe, 0xf3, 0xd4, 0xad, 0xbc,
-  0x37, 0x8c, 0xfa, 0xbd, 0x5f, 0xb4, 0xb6, 0xbd, 0xb8, 0xbe, 0xab, 0xbd,
-  0x1b, 0xc8, 0x66, 0xbe, 0x21, 0x54, 0x1c, 0xbc, 0x6b, 0xf7, 0x28, 0xbe,
-  0x88, 0x1d, 0x0e, 0xbe, 0xa1, 0x95, 0xcd, 0x3c, 0x87, 0x23, 0x57, 0x3d,
-  0xb5, 0xdf, 0x4d, 0xbd, 0x82, 0xa7, 0x7e, 0x3d, 0xf5, 0xb9, 0x5e, 0xbe,
-  0x1d, 0x31, 0x01, 0xbe, 0x50, 0xdc, 0xa6, 0xbd, 0xb2, 0x38, 0x0d, 0x3d,
-  0x83, 0xdc, 0x6a, 0x3c, 0x45, 0xb7, 0xaa, 0x3d, 0x2a, 0x29, 0xea, 0x3c,
-  0x52, 0xb9, 0x1e, 0x3e, 0xcd, 0xc1, 0xd6, 0xbd, 0xad, 0x60, 0x49, 0xbe,
-  0xd4, 0x34, 0x5a, 0x3d, 0x45, 0xeb, 0xf7, 0x3d, 0xec, 0x34, 0x8d, 0xbc,
-  0x32, 0xf6, 0xd1, 0x3d, 0xe5, 0x63, 0x92, 0x3d, 0x87, 0x74, 0x1f, 0x3e,
-  0x41, 0x7b, 0xe0, 0x3d, 0x23, 0x1a, 0xa7, 0xbe, 0xe8, 0x3f, 0xd6, 0x3d,
-  0xc6, 0x6d, 0x49, 0x3e, 0xbf, 0x5d, 0x23, 0x3d, 0x86, 0xbb, 0x08, 0x3e,
-  0x08, 0xaa, 0x17, 0x3d, 0x4b, 0x02, 0xf4, 0x3d, 0x0e, 0xcc, 0x09, 0x3e,
-  0x96, 0x58, 0xe5, 0xbe, 0x15, 0x86, 0x1d, 0x3e, 0x0e, 0x2e, 0xa7, 0x3d,
-  0x4f, 0xc5, 0x7c, 0xbd, 0x38, 0x9e, 0xad, 0xbd, 0x01, 0x61, 0x13, 0xbe,
-  0xf8, 0xea, 0x0d, 0xbe, 0x00, 0x82, 0x1b, 0xbe, 0xf5, 0x5b, 0xa1, 0xbe,
-  0x3d, 0x14, 0x73, 0xbe, 0x05, 0x93, 0x61, 0xbe, 0x53, 0x41, 0x0e, 0xbe,
-  0xf6, 0x1f, 0xc5, 0xbd, 0x35, 0x75, 0x17, 0xbe, 0x31, 0xf2, 0x80, 0x3d,
-  0x36, 0x57, 0x86, 0xbe, 0x4e, 0x4c, 0xf1, 0xbe, 0xa4, 0xf6, 0x93, 0xbc,
-  0x72, 0xf9, 0xc1, 0xb9, 0xd4, 0xe6, 0x1d, 0xbe, 0x4a, 0x1b, 0xc7, 0x3d,
-  0x3d, 0xbc, 0x7f, 0xbc, 0x42, 0x0e, 0xb7, 0x3d, 0x53, 0x76, 0x22, 0xbc,
-  0xdd, 0x46, 0x1d, 0xbf, 0xbb, 0x44, 0xfd, 0x3d, 0x74, 0x7f, 0x93, 0x3d,
-  0x45, 0xf1, 0x83, 0x3d, 0x43, 0xee, 0x9f, 0xbd, 0xcb, 0x02, 0x99, 0xbd,
-  0x43, 0xfe, 0xd6, 0x3b, 0x14, 0x8d, 0xee, 0xbd, 0xae, 0xe3, 0x84, 0xbe,
-  0x76, 0x0c, 0xb4, 0x3c, 0xcd, 0x4a, 0xed, 0x3c, 0xd2, 0x6e, 0xc7, 0x3d,
-  0xed, 0x57, 0x90, 0xbd, 0x5c, 0xf6, 0x79, 0xbc, 0x0f, 0x1c, 0x5a, 0xbb,
-  0x47, 0x23, 0x63, 0xbd, 0xee, 0x35, 0xbe, 0xbd, 0x07, 0x7e, 0x58, 0x3d,
-  0x3d, 0x28, 0x18, 0xbd, 0x37, 0x8a, 0xf0, 0xbb, 0x3a, 0xbc, 0x1c, 0xbe,
-  0xef, 0xb9, 0x93, 0xbd, 0xac, 0xa0, 0x88, 0xbd, 0xd6, 0x18, 0x7d, 0xbd,
-  0xcd, 0xa9, 0x33, 0xbd, 0xf4, 0xc9, 0xa6, 0xbd, 0x45, 0x85, 0x4f, 0xbe,
-  0xeb, 0x54, 0x35, 0xbd, 0xc6, 0xf6, 0x6f, 0xbe, 0x63, 0x0f, 0x6d, 0xbe,
-  0xf8, 0xc0, 0x35, 0xbe, 0xe1, 0x85, 0x81, 0xbe, 0x6a, 0x4d, 0xff, 0x3d,
-  0xcd, 0xfe, 0x48, 0xbe, 0x9a, 0x02, 0x51, 0xbe, 0x00, 0xd5, 0xe4, 0x3d,
-  0xa2, 0x43, 0x3d, 0xbd, 0xa9, 0x1c, 0x17, 0xbe, 0x11, 0xcd, 0x0b, 0xbe,
-  0x36, 0x85, 0x3c, 0xbe, 0x2a, 0x06, 0x2d, 0x3c, 0x39, 0x6a, 0x37, 0xbe,
-  0x19, 0x49, 0x05, 0xbe, 0x70, 0x96, 0x32, 0x3d, 0x5a, 0x0a, 0x67, 0x3d,
-  0xb6, 0xbd, 0x5f, 0x3c, 0xa3, 0x93, 0xa3, 0xbc, 0x1d, 0xef, 0x2c, 0xbe,
-  0xf0, 0x81, 0xb3, 0xbc, 0x6a, 0xf2, 0x4f, 0x3b, 0xab, 0x35, 0x2c, 0xbd,
-  0x63, 0x78, 0xb9, 0xbd, 0xc5, 0xe6, 0xfc, 0x3d, 0xbb, 0xd7, 0x98, 0x3d,
-  0x3a, 0x30, 0xe2, 0x3d, 0x88, 0x5a, 0x26, 0xbd, 0x3d, 0xeb, 0x72, 0xbd,
-  0x9c, 0x01, 0xd6, 0x3b, 0xae, 0xbd, 0xad, 0x3d, 0x89, 0xaf, 0xa7, 0xbd,
-  0x11, 0x37, 0x32, 0x3d, 0x28, 0x74, 0x6e, 0x3d, 0xec, 0xdb, 0x02, 0x3e,
-  0xf5, 0xae, 0x14, 0x3c, 0x23, 0xf7, 0xd1, 0xbd, 0x92, 0x3e, 0x20, 0x3e,
-  0xdb, 0xe9, 0xab, 0x3d, 0x0b, 0xeb, 0x05, 0xbe, 0x25, 0x64, 0xb3, 0x3d,
-  0xbe, 0x88, 0x19, 0x3e, 0x29, 0x5b, 0x31, 0x3e, 0x2f, 0x93, 0x24, 0x3e,
-  0x27, 0x9e, 0x79, 0xbc, 0xf8, 0x64, 0x15, 0x3e, 0x2d, 0x99, 0x21, 0x3e,
-  0x7f, 0xc9, 0x9a, 0x3d, 0x73, 0x2e, 0x96, 0x3d, 0x76, 0x12, 0x19, 0x3d,
-  0xcc, 0x37, 0xba, 0x3d, 0x85, 0x26, 0x10, 0x3e, 0xb3, 0x34, 0x4a, 0x3c,
-  0xe3, 0x88, 0x25, 0x3e, 0x2e, 0x5b, 0x90, 0x3c, 0xa5, 0x7c, 0x02, 0x3c,
-  0x21, 0x2e, 0x1e, 0x3d, 0x99, 0x97, 0x92, 0xbd, 0x07, 0x4c, 0xeb, 0xbd,
-  0x8b, 0x50, 0x65, 0xbd, 0xc3, 0x1a, 0x86, 0x3d, 0xdf, 0x46, 0x01, 0xbe,
-  0xd5, 0xdb, 0xe2, 0xbd, 0xfe, 0x3f, 0x1b, 0xbd, 0x1b, 0x3b, 0xbf, 0x3d,
-  0xb8, 0xd3, 0x32, 0xbb, 0x08, 0x4f, 0xef, 0x3d, 0xdc, 0x53, 0x10, 0xbe,
-  0x54, 0x69, 0xb0, 0xbe, 0xbe, 0xfe, 0x00, 0x3c, 0x48, 0xc9, 0x01, 0x3e,
-  0x18, 0xd2, 0xcd, 0xbb, 0x6e, 0xe4, 0x21, 0x3e, 0x37, 0x30, 0x9c, 0x3c,
-  0xc5, 0x60, 0xc8, 0x3d, 0xfd, 0xe2, 0x6e, 0x3d, 0x3e, 0xd4, 0x6e, 0xbe,
-  0x75, 0x91, 0xe6, 0x3d, 0x29, 0xdb, 0xe8, 0x3d, 0xc4, 0x4e, 0x48, 0x3d,
-  0x5e, 0xf7, 0x37, 0x3d, 0x7d, 0x47, 0x2f, 0x3d, 0xf7, 0x16, 0xc6, 0x3d,
-  0xb9, 0x93, 0x22, 0x3d, 0x5d, 0x8e, 0xdb, 0x3d, 0x52, 0xbb, 0xe3, 0x3d,
-  0x7e, 0x28, 0xed, 0x3c, 0x76, 0x58, 0x62, 0x3d, 0x81, 0x3d, 0x97, 0x3d,
-  0xf9, 0xf3, 0x5f, 0xbc, 0x77, 0xb7, 0xaf, 0x3d, 0x03, 0xa8, 0xb8, 0x3d,
-  0xa8, 0xdd, 0x0e, 0x3e, 0x5a, 0xb5, 0xb6, 0x3d, 0xd0, 0x30, 0x60, 0x3d,
-  0x93, 0xfb, 0x78, 0xbd, 0xc5, 0x94, 0x73, 0xbc, 0xee, 0x45, 0xa9, 0xbd,
-  0xf2, 0x8f, 0xd1, 0xbd, 0x60, 0x7e, 0x08, 0x3d, 0xf1, 0x83, 0xd2, 0x3d,
-  0xc2, 0x73, 0x7e, 0xbd, 0xce, 0x02, 0xca, 0xbd, 0xba, 0x1b, 0xec, 0xbd,
-  0xc4, 0x36, 0x01, 0xbe, 0x65, 0xdc, 0x0c, 0xbe, 0x7c, 0xf1, 0x3d, 0xbe,
-  0x74, 0xf9, 0xc2, 0xbd, 0x9d, 0x99, 0xd3, 0x3b, 0xc0, 0xb9, 0x16, 0xbe,
-  0x48, 0x5e, 0x98, 0xbd, 0xe4, 0xd6, 0x8d, 0x3c, 0x88, 0xaf, 0xb8, 0xbd,
-  0xdb, 0xa7, 0x6a, 0xbc, 0xce, 0x4d, 0x07, 0xbd, 0xe7, 0x48, 0x1e, 0x3d,
-  0xaf, 0xc3, 0x81, 0x3d, 0xf3, 0x09, 0x93, 0x3b, 0x11, 0xa9, 0x01, 0xbc,
-  0x05, 0xea, 0x1e, 0xbe, 0x1c, 0xfc, 0xac, 0xbd, 0xa5, 0xd8, 0x75, 0x3c,
-  0x6d, 0xf1, 0x06, 0x3d, 0xf7, 0x8c, 0xa9, 0x3d, 0x6a, 0x8e, 0x54, 0x3e,
-  0x4b, 0x52, 0x17, 0x3d, 0x44, 0xde, 0x04, 0x3a, 0x81, 0x03, 0x0a, 0xbe,
-  0x25, 0x8c, 0xf7, 0xbc, 0x7c, 0x75, 0xa1, 0x3d, 0xeb, 0x05, 0x31, 0x3d,
-  0x94, 0x69, 0x9f, 0x3d, 0xad, 0x4b, 0x26, 0x3e, 0x2f, 0x6b, 0x7a, 0x3d,
-  0xcc, 0x4d, 0xda, 0x3d, 0x22, 0x78, 0x57, 0xbd, 0xef, 0x24, 0xb3, 0x3d,
-  0x12, 0x49, 0xd7, 0x3d, 0x21, 0x9a, 0xb0, 0x3d, 0x0c, 0x8f, 0xb0, 0x3d,
-  0xc4, 0xa4, 0xe4, 0x3c, 0xb8, 0x0e, 0x0f, 0x3e, 0x21, 0xe8, 0xaa, 0x3d,
-  0x58, 0x00, 0x81, 0xbd, 0x43, 0xd5, 0xc3, 0xbc, 0x4d, 0x32, 0x15, 0x3d,
-  0x60, 0x6f, 0x97, 0x3d, 0x74, 0xed, 0x58, 0x3d, 0x20, 0x25, 0xfd, 0x3d,
-  0x62, 0xfb, 0x23, 0x3d, 0x7c, 0x47, 0x96, 0x3d, 0xb8, 0xee, 0x00, 0x3e,
-  0x9b, 0x84, 0xc6, 0x3d, 0x96, 0x7e, 0xf7, 0x3b, 0x69, 0x50, 0xd9, 0xbc,
-  0x67, 0x07, 0x12, 0x3e, 0x4e, 0xd1, 0x95, 0x3e, 0x61, 0x80, 0xd4, 0xbc,
-  0xe0, 0x8b, 0x77, 0xbb, 0x8e, 0xa7, 0x65, 0x3e, 0x1c, 0x5d, 0xbd, 0x3d,
-  0x99, 0x26, 0xec, 0x3c, 0x4e, 0xf8, 0x31, 0x3d, 0xbe, 0x19, 0xa3, 0x3d,
-  0xc5, 0xd7, 0x53, 0x3e, 0xf9, 0x16, 0x64, 0xbc, 0xfa, 0xce, 0xa5, 0x3d,
-  0x70, 0x02, 0x99, 0x3d, 0x7f, 0xb1, 0xd0, 0x3d, 0x33, 0xc2, 0x01, 0x3e,
-  0x32, 0xab, 0x9e, 0x3d, 0x95, 0x87, 0x96, 0x3d, 0x8a, 0x90, 0x93, 0xbc,
-  0x9c, 0x30, 0xa9, 0x3d, 0xe7, 0x5e, 0x1a, 0x3e, 0x1d, 0xf5, 0x3b, 0x3d,
-  0xd8, 0x45, 0xed, 0x3d, 0x7b, 0xc3, 0x84, 0x3d, 0x50, 0x2e, 0x4a, 0x3d,
-  0x57, 0xa3, 0x1f, 0x3e, 0xb2, 0xca, 0x02, 0x3e, 0x1d, 0x4e, 0x91, 0x3d,
-  0x49, 0xcf, 0xb7, 0x3c, 0xe3, 0x4e, 0x22, 0x3e, 0xa8, 0x21, 0x68, 0x3d,
-  0x38, 0xd7, 0x8d, 0x3d, 0xad, 0xc7, 0xbe, 0x3d, 0x09, 0x0a, 0x88, 0x3d,
-  0xe1, 0x26, 0x22, 0x3e, 0xd6, 0xb7, 0x0c, 0x3e, 0x57, 0xe1, 0x0c, 0xba,
-  0xcd, 0x8d, 0xa1, 0x3d, 0xf8, 0x8d, 0x09, 0x3d, 0xd3, 0x8f, 0x95, 0x3d,
-  0x83, 0xaa, 0x27, 0xbd, 0x65, 0xad, 0xbe, 0xbc, 0xbe, 0x50, 0x84, 0x3d,
-  0x35, 0xb4, 0x65, 0xbd, 0x45, 0xf2, 0x2e, 0xbd, 0xbf, 0xbb, 0x94, 0xbd,
-  0x58, 0xfc, 0x93, 0xbd, 0x63, 0x48, 0xe3, 0xbd, 0x96, 0xf3, 0xef, 0xbd,
-  0xa7, 0x91, 0x65, 0xbd, 0xca, 0x6f, 0x90, 0xbc, 0x51, 0x45, 0x25, 0xbe,
-  0x5c, 0x17, 0xb9, 0xbd, 0xcc, 0x57, 0xa3, 0xbd, 0x82, 0x03, 0x65, 0xbe,
-  0x3c, 0xb1, 0x67, 0xbe, 0x2b, 0x39, 0xfe, 0xbd, 0x8e, 0x72, 0xeb, 0xbd,
-  0x37, 0xa9, 0x8b, 0x3d, 0xfb, 0x2b, 0x24, 0xbe, 0xea, 0x7e, 0x33, 0xbe,
-  0x86, 0x35, 0x8f, 0x3d, 0x9f, 0xb9, 0xbc, 0xbd, 0x33, 0x43, 0x45, 0xbe,
-  0xc8, 0x33, 0x15, 0xbe, 0x81, 0x8a, 0x32, 0xbe, 0x49, 0x7d, 0x17, 0x3e,
-  0xed, 0x09, 0xf5, 0xbd, 0x1c, 0xf7, 0x12, 0xbe, 0x70, 0x5f, 0x3b, 0x3e,
-  0x5a, 0xf8, 0x06, 0xbe, 0xde, 0x29, 0x6a, 0xbb, 0x64, 0xae, 0xcf, 0xbd,
-  0x95, 0x5a, 0x97, 0xbd, 0xc3, 0xc9, 0x02, 0x3e, 0x09, 0x5e, 0xfd, 0xba,
-  0x16, 0xb0, 0x81, 0xbd, 0x8e, 0x54, 0xac, 0x3c, 0xfa, 0x7c, 0x9b, 0xbd,
-  0xa5, 0x0d, 0xd4, 0x3d, 0xaa, 0x5b, 0xd1, 0xbb, 0xde, 0x4d, 0x1f, 0xbc,
-  0x24, 0xf7, 0xcc, 0x3d, 0xcc, 0x16, 0x70, 0x3b, 0x20, 0xe1, 0x09, 0x3d,
-  0x84, 0x11, 0x86, 0xbe, 0x1c, 0x7c, 0x43, 0xbd, 0x26, 0xe5, 0xd8, 0x3b,
-  0xea, 0xe9, 0x92, 0x3d, 0x9f, 0xf1, 0x1a, 0x3d, 0xd9, 0xd3, 0x9d, 0x3d,
-  0xda, 0x03, 0x91, 0x3b, 0x70, 0x5e, 0xe5, 0x3c, 0x01, 0x09, 0x12, 0xbe,
-  0x0a, 0x77, 0x8d, 0xbd, 0x46, 0x19, 0x46, 0x3d, 0x18, 0x7b, 0x54, 0xbd,
-  0x07, 0xd6, 0x35, 0x3d, 0x30, 0xb9, 0xc8, 0xbb, 0x58, 0x9a, 0xa4, 0xbc,
-  0x35, 0x0a, 0xbc, 0xbd, 0x33, 0xc4, 0xf2, 0x3d, 0x68, 0x9f, 0x5d, 0x3b,
-  0xad, 0x60, 0xa4, 0x3d, 0xe4, 0x3e, 0x86, 0xbd, 0xaa, 0x82, 0x32, 0x3d,
-  0x71, 0x86, 0xae, 0x3d, 0x24, 0x5f, 0x0f, 0xbd, 0xd9, 0x61, 0xe0, 0x3c,
-  0xbf, 0x00, 0xb6, 0x3d, 0xf3, 0x58, 0xba, 0x3d, 0xb9, 0xf0, 0x57, 0x3d,
-  0xdf, 0x14, 0xb5, 0x3d, 0x93, 0x0e, 0x20, 0x3d, 0xf1, 0x34, 0x4a, 0x3d,
-  0x83, 0x50, 0xc3, 0x3c, 0xb6, 0xa4, 0xa2, 0x3c, 0x37, 0x09, 0xc1, 0xbd,
-  0x7d, 0x5a, 0x85, 0x3d, 0xc5, 0x37, 0xd3, 0x3d, 0x4c, 0x76, 0x85, 0x3d,
-  0x9d, 0x40, 0xcd, 0x3d, 0x35, 0xcc, 0x88, 0x3c, 0x2a, 0x71, 0x9c, 0x3d,
-  0x12, 0xdb, 0xaf, 0x3d, 0x55, 0x4c, 0x48, 0xbe, 0x64, 0xfa, 0xb9, 0x3d,
-  0xe9, 0xe3, 0xba, 0x3d, 0x76, 0xef, 0xe8, 0xbc, 0xd1, 0x5c, 0x8f, 0x3c,
-  0xa5, 0xde, 0x7b, 0x3d, 0x85, 0xe0, 0x31, 0x3d, 0x34, 0xd5, 0x06, 0xbd,
-  0xb9, 0x13, 0x59, 0x3d, 0x38, 0x70, 0x6d, 0xbd, 0x70, 0xc1, 0x4d, 0x3d,
-  0x9e, 0x19, 0x15, 0xbd, 0x1f, 0x3a, 0x06, 0x3e, 0xfd, 0x5f, 0x01, 0x3e,
-  0x3e, 0x09, 0x0e, 0xbb, 0x29, 0xb6, 0x86, 0xbc, 0x83, 0x63, 0x08, 0x3d,
-  0x64, 0x06, 0x10, 0xbd, 0xb6, 0x4c, 0x03, 0x3d, 0x3e, 0x19, 0x2a, 0x3c,
-  0xc9, 0xa1, 0xb0, 0xbc, 0x76, 0xd0, 0x40, 0x3d, 0x99, 0xb5, 0x6d, 0x3d,
-  0xb0, 0x5b, 0x84, 0xbc, 0xee, 0xed, 0x8a, 0x3d, 0xc1, 0x00, 0xf4, 0xbd,
-  0xa7, 0x93, 0x5b, 0xbd, 0x2f, 0xd8, 0x0c, 0xbe, 0x0d, 0x8c, 0xaa, 0xbd,
-  0x97, 0x5c, 0xba, 0x3d, 0x42, 0x1b, 0x82, 0xbd, 0xdc, 0xb5, 0x81, 0xbd,
-  0x6b, 0xde, 0x68, 0xbd, 0x9e, 0x58, 0xf4, 0xbd, 0x1e, 0x06, 0x30, 0xbe,
-  0xf4, 0x64, 0x91, 0xbe, 0x2e, 0xce, 0xe3, 0xbd, 0x72, 0x40, 0xbe, 0x3d,
-  0x65, 0x76, 0x1e, 0xbe, 0x46, 0xe3, 0x14, 0xbe, 0xe9, 0xb3, 0xd1, 0x3d,
-  0x22, 0x9d, 0x7e, 0xbd, 0x5f, 0x7c, 0xa5, 0xbd, 0xeb, 0x87, 0xb6, 0xbd,
-  0x9a, 0xc1, 0x8e, 0xbd, 0xc1, 0x57, 0x60, 0x3d, 0xf2, 0x07, 0x0e, 0xbd,
-  0x03, 0x82, 0x32, 0xbd, 0x9d, 0x7f, 0xbe, 0x3c, 0x48, 0x6b, 0xfb, 0xbd,
-  0x0d, 0x42, 0x2d, 0xbd, 0xda, 0xfe, 0x91, 0xbd, 0xed, 0xae, 0xc5, 0xbc,
-  0xa8, 0x7e, 0xfb, 0x3d, 0xa0, 0xb6, 0x93, 0xbd, 0x87, 0xcd, 0xa2, 0xbd,
-  0x37, 0x72, 0xb2, 0xbd, 0xfe, 0xd2, 0x1e, 0xbe, 0x84, 0x8a, 0x0c, 0xbc,
-  0x91, 0xa2, 0xb7, 0xbd, 0xcb, 0x2f, 0x85, 0xbd, 0xd6, 0xce, 0x03, 0x3e,
-  0x23, 0xcc, 0x3c, 0xbd, 0x5c, 0x95, 0xe1, 0xbc, 0x30, 0x1f, 0xc5, 0xbd,
-  0xb4, 0x7f, 0x2b, 0xbe, 0x32, 0x2d, 0x58, 0xbc, 0xfa, 0xa0, 0xe7, 0xbc,
-  0xb2, 0xd4, 0x8b, 0xbd, 0x76, 0x36, 0x27, 0x3c, 0xb8, 0xd5, 0x64, 0xbd,
-  0x89, 0xcb, 0x22, 0xbd, 0x24, 0xba, 0x1b, 0xbe, 0xc1, 0x49, 0x27, 0xbe,
-  0x3f, 0xbb, 0x99, 0xbd, 0xd8, 0x1d, 0x5e, 0xbd, 0xa3, 0xde, 0xb2, 0xbd,
-  0x4c, 0x1b, 0x45, 0x3d, 0x16, 0x36, 0x36, 0xbe, 0x5a, 0xc1, 0x98, 0xbd,
-  0x22, 0x75, 0x4a, 0xbe, 0xcf, 0x29, 0x28, 0xbe, 0x39, 0x03, 0xbb, 0xbd,
-  0x02, 0x3f, 0x94, 0xbd, 0x57, 0xdb, 0x88, 0x3c, 0x53, 0x5e, 0x17, 0x3c,
-  0x23, 0xf5, 0xb7, 0xbd, 0x64, 0x35, 0x22, 0xbd, 0x3d, 0xb2, 0x94, 0xbe,
-  0xac, 0xdb, 0xaf, 0xbd, 0x67, 0xb4, 0x11, 0x3c, 0xad, 0x99, 0x49, 0x3d,
-  0xde, 0x91, 0x57, 0x3d, 0xbc, 0x75, 0x8c, 0xbc, 0xec, 0x6d, 0xea, 0x3c,
-  0x6e, 0x91, 0x86, 0xbb, 0x2a, 0x2e, 0xbc, 0xbe, 0xc5, 0x3b, 0x48, 0xbc,
-  0x0a, 0x65, 0xf9, 0x3c, 0x22, 0xda, 0x01, 0xbc, 0x5d, 0x07, 0x1b, 0xbc,
-  0x85, 0x8b, 0xa9, 0x3c, 0x14, 0xb2, 0x83, 0x3d, 0x71, 0x74, 0x8d, 0x3d,
-  0x4a, 0xd8, 0xc0, 0xbe, 0x44, 0x7f, 0x57, 0xbd, 0x2a, 0x6c, 0x8a, 0xbd,
-  0xd5, 0x86, 0xbd, 0x3c, 0x3a, 0xc7, 0x25, 0xbd, 0x5e, 0x8b, 0x29, 0x3d,
-  0xaf, 0x50, 0x96, 0xbc, 0xf4, 0x07, 0xa2, 0xbd, 0xe1, 0xdb, 0x15, 0xbe,
-  0x16, 0x60, 0xbd, 0xbc, 0x5a, 0xae, 0xf0, 0xbc, 0x5d, 0xef, 0x91, 0xbd,
-  0x73, 0x4b, 0x96, 0xbc, 0x11, 0xf6, 0x4f, 0x3d, 0xe7, 0x23, 0x21, 0xbd,
-  0x98, 0x93, 0x8c, 0xbd, 0x77, 0x1e, 0x66, 0xbd, 0x02, 0x0b, 0xf1, 0xbd,
-  0x46, 0x02, 0xf2, 0xbd, 0x2c, 0x1a, 0xe5, 0xbd, 0x5f, 0x70, 0xe7, 0xbd,
-  0xb1, 0x65, 0xd1, 0x3d, 0xe7, 0x9b, 0xad, 0xbd, 0xd3, 0x3e, 0xe8, 0xbd,
-  0xca, 0xb8, 0xae, 0x3b, 0xae, 0xef, 0xcc, 0xbd, 0xb1, 0x6c, 0x2e, 0xbe,
-  0x55, 0xad, 0x68, 0xbe, 0xa1, 0xa0, 0x36, 0xbe, 0xbc, 0xd1, 0x09, 0x3e,
-  0x70, 0xcc, 0x4c, 0xbe, 0x24, 0x8f, 0x2a, 0xbe, 0x28, 0x96, 0x88, 0x3d,
-  0x0c, 0xe6, 0x2b, 0xbe, 0xb7, 0x82, 0x00, 0xbe, 0x74, 0xe7, 0x08, 0xbe,
-  0xa1, 0xca, 0x89, 0xbe, 0x3f, 0x55, 0xb5, 0x3d, 0x5b, 0x5f, 0x5c, 0xbe,
-  0xc1, 0xb5, 0x2a, 0xbe, 0x02, 0x62, 0x85, 0x3d, 0xd2, 0x14, 0xdb, 0xbd,
-  0xcc, 0x86, 0x19, 0xbe, 0xf9, 0xe5, 0x2d, 0xbe, 0xc4, 0xe5, 0xdc, 0xbd,
-  0x83, 0x85, 0xa4, 0x3d, 0xb4, 0x7d, 0xba, 0xbd, 0xcb, 0x87, 0x53, 0xbd,
-  0xaa, 0x40, 0xac, 0x3d, 0x37, 0xa0, 0x75, 0xbe, 0x57, 0x6f, 0x1d, 0xbe,
-  0x8e, 0xd7, 0x2c, 0xbe, 0xc2, 0x8c, 0x39, 0xbd, 0x89, 0xa6, 0xab, 0x3d,
-  0xab, 0x88, 0x10, 0xbe, 0x53, 0x7a, 0xc4, 0xbd, 0x54, 0xaf, 0x4f, 0x3d,
-  0x66, 0x39, 0x03, 0xbe, 0x6c, 0xab, 0xae, 0xbd, 0x01, 0x66, 0xd8, 0xbd,
-  0xe9, 0xdf, 0x1b, 0xbe, 0x52, 0x45, 0xfd, 0xbc, 0xab, 0x34, 0x34, 0xbe,
-  0x30, 0x42, 0x0a, 0xbe, 0x31, 0xfc, 0x05, 0x3d, 0x73, 0x69, 0x1c, 0xbe,
-  0xcb, 0xb0, 0xb3, 0xbd, 0x2a, 0xa8, 0xfc, 0xbd, 0x24, 0x29, 0x3b, 0xbe,
-  0x17, 0xb9, 0xfe, 0xbd, 0x61, 0xd6, 0xfe, 0xbd, 0xa4, 0xbd, 0x92, 0xbd,
-  0xd7, 0x89, 0x71, 0xbd, 0xca, 0x76, 0x00, 0xbe, 0x5e, 0x8b, 0x1f, 0xbe,
-  0x25, 0xe3, 0x8b, 0xbd, 0x74, 0x0b, 0xd7, 0xbd, 0x31, 0x80, 0x02, 0xbe,
-  0xe2, 0x4c, 0xf6, 0xbd, 0xd1, 0x15, 0x35, 0xbd, 0xba, 0x7f, 0x83, 0xbe,
-  0x2b, 0x6a, 0x26, 0xbe, 0xb0, 0x0a, 0x26, 0xbe, 0xe2, 0x02, 0xf5, 0xbb,
-  0x04, 0x15, 0x8d, 0xbd, 0x66, 0x67, 0x43, 0xbe, 0x74, 0xe5, 0xae, 0xbd,
-  0x58, 0x1d, 0x81, 0xbd, 0x25, 0x02, 0xb6, 0xbe, 0xa3, 0x1d, 0xce, 0xbd,
-  0xd7, 0x8c, 0xa3, 0xbd, 0x66, 0x53, 0x81, 0x3c, 0x30, 0x35, 0x09, 0xbd,
-  0x2b, 0xeb, 0x53, 0xbe, 0x45, 0x10, 0x23, 0x3c, 0xf1, 0xf6, 0x8c, 0xbd,
-  0x62, 0xcb, 0x13, 0xbf, 0x4e, 0x0a, 0x03, 0xbd, 0x9c, 0xae, 0x18, 0xbc,
-  0xd4, 0x15, 0xa7, 0x3c, 0x1d, 0xc9, 0x62, 0xbd, 0xbc, 0xb0, 0x6b, 0xbc,
-  0xdf, 0xf0, 0xfa, 0x3c, 0xf4, 0x90, 0xbc, 0xbc, 0x00, 0x19, 0xbe, 0xbe,
-  0x41, 0xde, 0x99, 0xbd, 0xf7, 0x42, 0xd1, 0x3c, 0x08, 0xeb, 0x12, 0xbd,
-  0x90, 0x37, 0x9d, 0xbd, 0x3e, 0x4e, 0x84, 0xbb, 0x0d, 0x27, 0xdc, 0xbb,
-  0xc9, 0x03, 0x9b, 0xbd, 0x34, 0xdc, 0x3b, 0xbd, 0x99, 0xcb, 0x7a, 0x3d,
-  0xda, 0x5d, 0xf7, 0xbb, 0x48, 0xc4, 0x0e, 0xbd, 0x0e, 0x41, 0x11, 0xbe,
-  0x24, 0x73, 0x0b, 0x3e, 0xc9, 0x52, 0xcb, 0xbd, 0xd9, 0x3f, 0xb2, 0xbc,
-  0x6f, 0xaf, 0x8d, 0x3d, 0x7f, 0xf9, 0xd7, 0xbc, 0x18, 0xbb, 0x73, 0xbc,
-  0x40, 0x8e, 0x00, 0xbd, 0xfd, 0x6f, 0xfb, 0x3c, 0x71, 0x4c, 0x03, 0x3e,
-  0x0e, 0x3f, 0x7c, 0xbc, 0x4f, 0x24, 0x8d, 0x3c, 0xb9, 0x09, 0xba, 0x3c,
-  0xf1, 0x41, 0xb0, 0x3c, 0xd0, 0xed, 0x8f, 0xbd, 0x27, 0xb1, 0x1a, 0xbe,
-  0xce, 0xff, 0xd1, 0xbc, 0xe8, 0x66, 0xbb, 0xbb, 0x9b, 0xd8, 0xef, 0xbd,
-  0x15, 0x51, 0xd4, 0xbd, 0x94, 0xc1, 0x61, 0x3d, 0x08, 0xa9, 0xa2, 0xbd,
-  0x1a, 0xef, 0xec, 0xbd, 0x7e, 0x01, 0xdf, 0xbd, 0xab, 0xf2, 0xad, 0xbd,
-  0x2a, 0xd5, 0xd6, 0x3d, 0x8b, 0x64, 0x09, 0xbe, 0x68, 0x01, 0xbf, 0xbd,
-  0xae, 0xc9, 0xc2, 0x3d, 0xf6, 0x5b, 0x2a, 0xbc, 0x9a, 0x6c, 0x0f, 0xbe,
-  0x9b, 0xf4, 0xc6, 0xbd, 0x22, 0xf9, 0x2d, 0xbd, 0x25, 0x68, 0xc7, 0x3d,
-  0xbd, 0x52, 0x87, 0xbd, 0xd4, 0xd9, 0x17, 0xbe, 0x09, 0x07, 0x17, 0x3e,
-  0x4b, 0x42, 0x7e, 0xbd, 0xfe, 0x9b, 0x4c, 0xbe, 0xb4, 0xcf, 0x65, 0xbe,
-  0xeb, 0x0a, 0x2d, 0xbe, 0xf1, 0x5f, 0x9d, 0x3d, 0x45, 0x57, 0x16, 0xbe,
-  0xaa, 0x73, 0x53, 0xbe, 0x4d, 0xc3, 0x94, 0x3b, 0xfa, 0xd8, 0x5b, 0xbd,
-  0x93, 0x26, 0x46, 0xbe, 0xe2, 0xf2, 0xf0, 0xbd, 0xa2, 0x49, 0x5a, 0xbe,
-  0x28, 0xfc, 0x05, 0x3c, 0xda, 0x7c, 0x18, 0xbd, 0xa2, 0x07, 0xf5, 0xbc,
-  0x36, 0xe8, 0x86, 0xbd, 0xc2, 0x7a, 0xc5, 0xbd, 0x28, 0x79, 0x02, 0xbe,
-  0x8c, 0x9f, 0xb9, 0xbd, 0x9a, 0x10, 0x17, 0xbe, 0x5e, 0xe1, 0xb2, 0xbd,
-  0xa3, 0x67, 0xcc, 0xbd, 0xcb, 0x37, 0x99, 0x39, 0x9d, 0xa4, 0xb1, 0xbd,
-  0xb1, 0x45, 0x85, 0xbd, 0x44, 0x72, 0x81, 0xbd, 0x60, 0x80, 0x23, 0xbd,
-  0x47, 0x96, 0xab, 0xbd, 0x43, 0x0b, 0xbb, 0xbd, 0x20, 0xe7, 0x6a, 0xbd,
-  0xb0, 0xb2, 0x0e, 0xbd, 0xb6, 0xb9, 0x6d, 0xbe, 0x47, 0x83, 0xca, 0xbd,
-  0xe3, 0xfc, 0xbf, 0xbc, 0x7c, 0xa6, 0x8e, 0x3d, 0xad, 0x94, 0x57, 0xbd,
-  0xef, 0xf5, 0xbb, 0xbd, 0x76, 0xc6, 0xf9, 0xbc, 0x43, 0xb7, 0x9b, 0xbd,
-  0xd3, 0x68, 0x42, 0xbe, 0x76, 0x8e, 0x63, 0xbd, 0x5a, 0x08, 0xc6, 0xbd,
-  0x3f, 0x39, 0x0b, 0xbd, 0xb0, 0xb4, 0xda, 0xbd, 0xfa, 0x42, 0xa1, 0xbd,
-  0x9d, 0x3b, 0x6d, 0xbd, 0x47, 0xec, 0x92, 0xbd, 0x42, 0x3b, 0x91, 0xbe,
-  0x72, 0xa9, 0x4b, 0x3c, 0x59, 0xbb, 0x0b, 0x3c, 0xf8, 0x9f, 0x73, 0x3c,
-  0xd2, 0x6f, 0x4e, 0xbd, 0xd8, 0xc4, 0xf2, 0x3c, 0xe1, 0xc5, 0xd6, 0x3b,
-  0x82, 0x03, 0xc6, 0xbc, 0xed, 0xeb, 0xda, 0x3c, 0x7f, 0x2f, 0xd6, 0x3d,
-  0x12, 0xaa, 0x9b, 0xbc, 0x96, 0x43, 0x69, 0x3d, 0xc2, 0x91, 0x81, 0xbd,
-  0x45, 0x83, 0x7c, 0x3d, 0x40, 0xca, 0xfa, 0x3c, 0x48, 0x74, 0x14, 0x3d,
-  0xe7, 0xf8, 0x9f, 0x3d, 0x55, 0xe9, 0x41, 0x3d, 0x82, 0xf5, 0xc5, 0x3c,
-  0x33, 0x5a, 0x08, 0x3c, 0x2a, 0x11, 0xf5, 0xbc, 0x13, 0x50, 0x21, 0x3e,
-  0x74, 0x3c, 0x17, 0x3d, 0x5c, 0x7c, 0x98, 0x39, 0x82, 0x5b, 0xc9, 0x3d,
-  0xdd, 0x72, 0x2a, 0xbb, 0x06, 0xad, 0xa0, 0xbd, 0xf0, 0x47, 0x26, 0x3d,
-  0xb9, 0xe4, 0x36, 0xbc, 0x71, 0x32, 0xce, 0x3d, 0x9d, 0xcb, 0x8f, 0x3b,
-  0x8a, 0x4e, 0x1a, 0x3d, 0xa2, 0x41, 0x33, 0x3e, 0x8c, 0x35, 0xb3, 0xbd,
-  0x7e, 0xe7, 0xe9, 0x3c, 0x3a, 0x95, 0xa9, 0x3b, 0x82, 0x89, 0xb2, 0x3a,
-  0x5c, 0x7c, 0xed, 0x3d, 0x80, 0x41, 0x49, 0xbd, 0xe9, 0xe3, 0x5a, 0xbc,
-  0x17, 0x28, 0xdc, 0x3d, 0xb0, 0x1b, 0xbe, 0xbd, 0xa7, 0x06, 0xa1, 0xbd,
-  0x1b, 0x59, 0x80, 0x3b, 0x79, 0xcc, 0x1c, 0xb8, 0x99, 0x5d, 0x11, 0x3e,
-  0x7c, 0x15, 0x9f, 0xbc, 0xc9, 0x67, 0x20, 0x3d, 0x71, 0xa6, 0x90, 0x3d,
-  0xcf, 0xb7, 0x2c, 0x3d, 0xd6, 0x4a, 0x71, 0xbc, 0xc4, 0x13, 0x42, 0xbd,
-  0x22, 0x2f, 0x4e, 0x3a, 0xf8, 0xbc, 0x04, 0x3e, 0xfb, 0xf5, 0x7a, 0xbd,
-  0x97, 0x08, 0x76, 0x3d, 0x64, 0x01, 0x2e, 0x3d, 0xec, 0x91, 0x8a, 0x3d,
-  0x21, 0xf9, 0x73, 0xbd, 0x7e, 0xa2, 0xb4, 0xbd, 0x6d, 0x97, 0xa1, 0xbc,
-  0xb5, 0x6c, 0xed, 0x3d, 0x43, 0x91, 0xd9, 0xbd, 0x79, 0x60, 0xd3, 0xbd,
-  0x6e, 0xc8, 0xaa, 0x3d, 0xa5, 0xab, 0x22, 0xbe, 0x72, 0xae, 0x87, 0xbd,
-  0xc7, 0x55, 0xed, 0xbd, 0xb7, 0x7f, 0x43, 0xbd, 0xfa, 0x83, 0x9f, 0x3c,
-  0xca, 0x90, 0xcc, 0xbd, 0xb2, 0x90, 0x2b, 0xbe, 0xa4, 0x39, 0x93, 0x3b,
-  0xd1, 0xc0, 0x4f, 0xbe, 0xc6, 0xd0, 0xd5, 0x3c, 0x6b, 0xe0, 0x1d, 0xbd,
-  0xbc, 0xfb, 0xfb, 0xbb, 0xde, 0x4c, 0xc8, 0x3d, 0x55, 0x1d, 0x52, 0xbd,
-  0x77, 0xea, 0xd0, 0xbd, 0xe3, 0x3b, 0xbe, 0xbc, 0x4e, 0xe2, 0x7a, 0xbd,
-  0x3f, 0x13, 0x12, 0x3d, 0xc2, 0x5e, 0x7a, 0xbc, 0x43, 0xfa, 0x3b, 0xbd,
-  0xec, 0x2e, 0x9d, 0x3d, 0x63, 0xad, 0x58, 0xbd, 0x9c, 0xbf, 0xd4, 0xbd,
-  0x06, 0x06, 0xbc, 0x3d, 0x41, 0x8a, 0xc9, 0xbd, 0x6f, 0xcc, 0xd4, 0xbd,
-  0xe1, 0x15, 0xd2, 0xbd, 0xa5, 0x08, 0xa9, 0xbd, 0xce, 0x45, 0x40, 0x3d,
-  0x36, 0x4c, 0x4c, 0xbd, 0xe7, 0x8f, 0x7e, 0xbd, 0x3e, 0x1e, 0x78, 0x3d,
-  0x1e, 0xf4, 0x09, 0xbe, 0x66, 0x15, 0x78, 0xbd, 0x2d, 0x0a, 0x5b, 0x3d,
-  0x15, 0x44, 0x7a, 0xbd, 0xc0, 0x5f, 0x1c, 0x3e, 0xdb, 0x76, 0xf4, 0x3c,
-  0xc4, 0xc7, 0x84, 0xbd, 0x3b, 0xc3, 0x91, 0x3d, 0x77, 0xff, 0x85, 0xbd,
-  0xd8, 0x0d, 0x30, 0xbd, 0xe6, 0x55, 0xc9, 0x3b, 0xf0, 0x93, 0x8d, 0xbd,
-  0x45, 0x32, 0x0b, 0x3e, 0x05, 0x4d, 0xb6, 0x3c, 0x11, 0x52, 0xec, 0xbd,
-  0xc9, 0x59, 0x01, 0x3e, 0x9c, 0x4a, 0x1b, 0xbe, 0xde, 0xd4, 0x08, 0xbd,
-  0x26, 0x19, 0x1d, 0xbc, 0x22, 0x45, 0xb3, 0xbd, 0xcb, 0xd7, 0x75, 0x3d,
-  0xe3, 0x4c, 0xee, 0xbd, 0xef, 0xe4, 0x06, 0xbe, 0xe0, 0x5c, 0x66, 0x3d,
-  0x99, 0x8b, 0x0d, 0xbe, 0xc5, 0x1a, 0xf6, 0xbc, 0xb7, 0x8a, 0xe1, 0xbd,
-  0x37, 0x05, 0xb2, 0xbc, 0x17, 0x9a, 0xaf, 0x3d, 0x9d, 0x6b, 0xef, 0xbd,
-  0x5d, 0xdb, 0x4e, 0xbe, 0xd7, 0x91, 0x23, 0x3e, 0x8f, 0x15, 0x3c, 0xbe,
-  0x45, 0xed, 0x16, 0xbc, 0x34, 0x84, 0xc1, 0xbc, 0xf8, 0x4c, 0x5b, 0xbd,
-  0xe1, 0xe6, 0xcc, 0x3c, 0x4b, 0xf6, 0xd7, 0xbc, 0x5c, 0xfb, 0xe4, 0xbd,
-  0x7c, 0xf5, 0xe8, 0x3d, 0x4c, 0x55, 0xbc, 0xbc, 0x0a, 0x4a, 0x95, 0x3d,
-  0xe8, 0x60, 0xd5, 0xbc, 0xed, 0x2e, 0x11, 0x3c, 0xc4, 0x0f, 0x0e, 0x3e,
-  0x68, 0x9e, 0x70, 0xbd, 0x74, 0x2c, 0x14, 0xbc, 0xcf, 0x72, 0x0f, 0x3e,
-  0x5e, 0xaf, 0xca, 0xbd, 0xc7, 0xe8, 0x69, 0xbd, 0xfa, 0xb2, 0x10, 0xbc,
-  0xb5, 0x8c, 0x1b, 0xbd, 0x75, 0x7a, 0xf6, 0x3d, 0xa7, 0x5e, 0xa4, 0xbc,
-  0x8e, 0x49, 0xed, 0x3c, 0x01, 0x00, 0x2a, 0x3d, 0x87, 0x81, 0x07, 0x3c,
-  0xb1, 0xa6, 0xa4, 0x3d, 0xe3, 0x6f, 0x51, 0xbd, 0x2e, 0xad, 0xed, 0x3c,
-  0xa6, 0xaf, 0x83, 0xbd, 0xf2, 0x63, 0x1d, 0xbd, 0x6e, 0x71, 0xaa, 0xbd,
-  0xdf, 0x20, 0xab, 0xbc, 0xf6, 0x88, 0x8c, 0xbd, 0x6f, 0x4c, 0x13, 0x3e,
-  0x6f, 0xbf, 0xf8, 0xbb, 0x0a, 0x4f, 0xfc, 0xbb, 0x76, 0x6d, 0x90, 0x3c,
-  0x90, 0x95, 0x61, 0x3c, 0xb0, 0x97, 0x87, 0x3a, 0x02, 0x4d, 0x29, 0xbd,
-  0xe5, 0xd0, 0xe8, 0xbd, 0x7a, 0x97, 0xda, 0x3c, 0x83, 0xec, 0x1a, 0xbd,
-  0x82, 0xe5, 0x23, 0xbc, 0x30, 0x58, 0xa2, 0xbc, 0xd9, 0x23, 0x92, 0xbc,
-  0x99, 0xec, 0xd4, 0xbd, 0xd0, 0x5c, 0xa1, 0xbd, 0x1b, 0xa1, 0x87, 0xbd,
-  0x0f, 0xe1, 0x3f, 0xbe, 0xd9, 0xa6, 0xff, 0xbd, 0xfe, 0x45, 0x79, 0xbd,
-  0x71, 0xdb, 0xd7, 0x3c, 0x34, 0x6e, 0xa1, 0xbd, 0xc1, 0xb0, 0x0e, 0xbe,
-  0x45, 0x4a, 0x59, 0xbc, 0x7b, 0x81, 0x8c, 0xbd, 0x98, 0x14, 0xeb, 0xbd,
-  0x56, 0x9a, 0x6b, 0xbd, 0xdd, 0x74, 0xa4, 0xbd, 0xe3, 0x0e, 0x89, 0xbd,
-  0xe6, 0x65, 0xdf, 0xbd, 0xdf, 0x73, 0x2d, 0xbe, 0x26, 0x04, 0xf9, 0xbc,
-  0xf8, 0xb2, 0x05, 0xbe, 0x56, 0x67, 0x8c, 0xbd, 0x94, 0x6a, 0x01, 0xbe,
-  0x75, 0x9d, 0x6e, 0xbc, 0x96, 0x0c, 0x7c, 0xbd, 0xe7, 0x4c, 0x54, 0xbe,
-  0x55, 0x8f, 0x1e, 0xbe, 0x85, 0x09, 0xbe, 0x3b, 0x7a, 0xee, 0xc9, 0x3b,
-  0xbc, 0x47, 0x64, 0xbd, 0x71, 0x49, 0xa9, 0xbd, 0x16, 0xf1, 0xc4, 0xbd,
-  0x91, 0x1b, 0x28, 0xbd, 0x0e, 0x41, 0xa0, 0xbe, 0xf7, 0x77, 0x04, 0xbe,
-  0xbb, 0x3f, 0xa3, 0x3c, 0xe6, 0x1a, 0xcd, 0xbc, 0xc3, 0xbf, 0x1c, 0x3c,
-  0x23, 0x0a, 0x24, 0xbd, 0x44, 0x85, 0x37, 0xbe, 0x6a, 0x5a, 0x11, 0xbd,
-  0x54, 0xee, 0xfb, 0xbd, 0x77, 0x5f, 0x0f, 0xbd, 0xd4, 0x84, 0x5c, 0xbc,
-  0x8a, 0xf8, 0xc6, 0x3c, 0xec, 0xed, 0x3a, 0xbc, 0x41, 0x97, 0xbb, 0x3d,
-  0x0c, 0x23, 0x27, 0x3d, 0x80, 0x27, 0x5c, 0x3b, 0xce, 0x11, 0x1e, 0x3d,
-  0xb2, 0x19, 0x8a, 0x3c, 0x00, 0x3b, 0x9e, 0xbc, 0xdb, 0x5c, 0x1b, 0xbd,
-  0xd1, 0x49, 0x66, 0x3d, 0x69, 0x86, 0x71, 0x3d, 0x09, 0xbd, 0x05, 0x3d,
-  0xbb, 0x4e, 0x12, 0xbd, 0x21, 0xc0, 0xaa, 0xbd, 0x5b, 0xf7, 0x41, 0x3d,
-  0x69, 0x7e, 0xb8, 0x3d, 0x51, 0x5d, 0x07, 0xbd, 0xe4, 0x52, 0xd2, 0xba,
-  0xd1, 0x48, 0x8e, 0x3d, 0xc6, 0xa7, 0x3a, 0x3d, 0x9a, 0xe7, 0x50, 0x3d,
-  0xd4, 0x63, 0xc1, 0xbd, 0x7f, 0xac, 0xf0, 0xbd, 0x16, 0x15, 0x97, 0x3c,
-  0xef, 0x27, 0x1a, 0xbe, 0x01, 0x82, 0x85, 0xbd, 0x45, 0xcc, 0xca, 0x3b,
-  0xb4, 0xdd, 0xc4, 0xbd, 0xea, 0x04, 0x9e, 0x3b, 0xe0, 0x09, 0x0b, 0xbc,
-  0x3c, 0xea, 0x3d, 0xbd, 0x1d, 0x0d, 0xf1, 0xbb, 0xa1, 0x98, 0x55, 0x3c,
-  0x5b, 0x6d, 0x2f, 0xbd, 0xbd, 0x61, 0x98, 0xbd, 0x12, 0x2a, 0x49, 0x3b,
-  0x8a, 0x1e, 0x2c, 0x39, 0xdb, 0xa6, 0xdf, 0xbd, 0xdd, 0x67, 0xe0, 0x3d,
-  0x90, 0xf7, 0x20, 0xbd, 0x89, 0x13, 0x66, 0x3c, 0xe0, 0xe1, 0x73, 0x3c,
-  0x66, 0x5e, 0x88, 0xbd, 0x0d, 0x3d, 0x95, 0x3b, 0x2c, 0x5e, 0xb8, 0x3c,
-  0x24, 0xa4, 0xc7, 0x3a, 0x6f, 0x53, 0x94, 0xbd, 0x85, 0xa9, 0x5b, 0xbb,
-  0xb0, 0xea, 0x96, 0xbd, 0x46, 0x9d, 0xe2, 0xbd, 0x28, 0xb0, 0x29, 0xbe,
-  0x80, 0x2f, 0x96, 0x3b, 0x72, 0xd2, 0x19, 0x3d, 0x4e, 0xa0, 0x13, 0xbe,
-  0x82, 0x14, 0x25, 0xbe, 0x42, 0x57, 0x27, 0xbc, 0x11, 0x69, 0xd1, 0xbd,
-  0xfe, 0x61, 0xfc, 0xbd, 0xd6, 0x82, 0x07, 0xbe, 0xdf, 0x06, 0xe0, 0xbc,
-  0x9c, 0x4d, 0xfb, 0xbb, 0x29, 0x74, 0xe5, 0xbd, 0xd4, 0xc5, 0x03, 0xbe,
-  0x78, 0x01, 0x96, 0xbb, 0xe2, 0xbe, 0x91, 0xbd, 0x4f, 0x53, 0x50, 0xbd,
-  0x3b, 0xdb, 0xce, 0xbd, 0x73, 0x86, 0x9d, 0xbd, 0x58, 0x22, 0xde, 0xbc,
-  0x8a, 0xe9, 0xb0, 0xbd, 0xdb, 0x86, 0xda, 0xbd, 0xfd, 0x70, 0xc2, 0x3d,
-  0xa8, 0x88, 0xcd, 0xba, 0x49, 0xfe, 0xe5, 0x3a, 0xf9, 0x5a, 0x84, 0xbd,
-  0x1c, 0xd8, 0xf5, 0xbd, 0x7c, 0x71, 0xd1, 0xbd, 0xc1, 0xcd, 0xeb, 0xbd,
-  0xa4, 0x46, 0x34, 0x3d, 0x08, 0x69, 0x50, 0xbc, 0xa5, 0x06, 0xc1, 0xbd,
-  0xe3, 0xc4, 0xe2, 0xbd, 0x81, 0x00, 0x96, 0xbc, 0xff, 0x4f, 0x1a, 0xbe,
-  0xd4, 0x5a, 0x85, 0xbd, 0xbc, 0xf8, 0x1d, 0xbc, 0x1e, 0x6a, 0x3a, 0xbd,
-  0x5d, 0xd7, 0xbd, 0xbd, 0xb1, 0xe2, 0xce, 0xbd, 0xae, 0x74, 0x9c, 0xbd,
-  0x9f, 0x3f, 0x9d, 0xbc, 0x77, 0xb1, 0xc8, 0xbd, 0x6b, 0x7c, 0x38, 0xbd,
-  0xa9, 0x38, 0x41, 0xbd, 0x72, 0xf0, 0xc0, 0xbd, 0x90, 0x02, 0x13, 0xbd,
-  0xb8, 0xcf, 0xe5, 0x3c, 0xb5, 0xb8, 0xcc, 0x3b, 0xf9, 0xe1, 0x54, 0x3d,
-  0xcc, 0xd5, 0x60, 0x3b, 0x02, 0x50, 0xf8, 0xbc, 0x53, 0xd1, 0x02, 0x3b,
-  0x42, 0x9a, 0xf6, 0xbb, 0x52, 0xa1, 0x7c, 0x3d, 0x3c, 0xab, 0x27, 0xbd,
-  0x5b, 0xab, 0x33, 0x3d, 0xd0, 0x01, 0xcf, 0x3d, 0x6b, 0x68, 0x7f, 0x3d,
-  0x7d, 0x3f, 0xde, 0x3c, 0xf9, 0x1d, 0x0d, 0x3e, 0xb4, 0xe3, 0xaa, 0x3d,
-  0x8c, 0xa1, 0x08, 0xbd, 0xc8, 0xe5, 0x66, 0xbc, 0xfd, 0xaf, 0x61, 0xbd,
-  0x68, 0xa6, 0xa6, 0x3c, 0x16, 0x54, 0xa3, 0x3d, 0x2b, 0xa5, 0x82, 0x3c,
-  0x39, 0xb7, 0xaa, 0x3c, 0x9b, 0x4e, 0x5d, 0x3d, 0xec, 0x92, 0xc5, 0x3c,
-  0x61, 0xea, 0x6b, 0x3c, 0xa8, 0x7e, 0xa5, 0xbd, 0xd1, 0xca, 0x90, 0xbd,
-  0x0a, 0x01, 0x54, 0x3d, 0x3f, 0x78, 0x16, 0xbd, 0x74, 0xe5, 0x85, 0xbc,
-  0x7d, 0xd7, 0x34, 0xbd, 0x5f, 0x33, 0x7e, 0x3d, 0x2b, 0x42, 0x0c, 0x3d,
-  0x56, 0x7d, 0x15, 0x3d, 0x58, 0x8a, 0x02, 0x3c, 0xb3, 0x03, 0x00, 0xbd,
-  0x1d, 0xb1, 0x81, 0xbd, 0x38, 0x84, 0x28, 0x3d, 0xaa, 0x80, 0x16, 0x39,
-  0x1f, 0x20, 0x06, 0xbc, 0x28, 0x32, 0xfd, 0x3d, 0xbe, 0xb3, 0xb5, 0x3d,
-  0x77, 0x57, 0x05, 0x3e, 0x6b, 0x6c, 0x25, 0x3c, 0x69, 0xf4, 0x0c, 0x3d,
-  0x74, 0x46, 0x43, 0x3d, 0xb3, 0x59, 0x22, 0x3d, 0x91, 0x3b, 0xac, 0xbd,
-  0x78, 0xeb, 0x03, 0xbe, 0x19, 0xd9, 0x11, 0xbc, 0x26, 0x91, 0x45, 0xbd,
-  0xef, 0xb8, 0x3d, 0xbd, 0xf1, 0xdb, 0x1f, 0x3a, 0xed, 0xbd, 0x37, 0xbc,
-  0x24, 0x78, 0x3a, 0xba, 0xa7, 0x00, 0x16, 0xbe, 0x04, 0x5f, 0x45, 0xbe,
-  0xdb, 0xc1, 0x7e, 0xbd, 0xc4, 0x6f, 0xd0, 0xbd, 0x3b, 0x6f, 0x3e, 0xbe,
-  0x26, 0x40, 0x20, 0xbd, 0x54, 0x31, 0x0a, 0xbe, 0x0b, 0xe7, 0xc1, 0xbd,
-  0x7d, 0xa0, 0x23, 0x3c, 0x19, 0xd6, 0x48, 0x3b, 0x3e, 0x95, 0x89, 0xbd,
-  0x43, 0x25, 0x3b, 0xbd, 0x33, 0x24, 0x87, 0xbe, 0x1b, 0x0f, 0x0f, 0xbe,
-  0x9e, 0xd9, 0xa4, 0xbc, 0xc5, 0x4a, 0x28, 0xbd, 0xdc, 0xce, 0x2c, 0x3d,
-  0xb2, 0x4c, 0x81, 0x3d, 0x8d, 0x43, 0xb4, 0xbc, 0x9c, 0xc2, 0x80, 0x3c,
-  0x22, 0x16, 0x00, 0xbe, 0xd8, 0xa9, 0x81, 0xbe, 0xc9, 0xdb, 0x1b, 0x3d,
-  0xee, 0xd0, 0x20, 0x3d, 0x19, 0x20, 0x29, 0xbd, 0xdb, 0x67, 0x6a, 0x3d,
-  0x6a, 0x5e, 0x00, 0xbc, 0xf7, 0x54, 0x2a, 0xbd, 0x7a, 0xcd, 0xcd, 0xbd,
-  0x3f, 0x56, 0xa6, 0xbe, 0x95, 0xcd, 0xeb, 0xbc, 0x31, 0x72, 0x0f, 0x3b,
-  0xa7, 0x18, 0x33, 0xbc, 0xed, 0x14, 0x02, 0x3c, 0xad, 0x26, 0xe8, 0xbc,
-  0x5a, 0xc2, 0x44, 0xbd, 0x79, 0x8c, 0xd8, 0xbc, 0xd8, 0xcd, 0x4b, 0xbe,
-  0xff, 0x51, 0xe2, 0xbb, 0x6f, 0x9a, 0x20, 0x3d, 0xd6, 0xa3, 0x65, 0xbd,
-  0x3d, 0xf0, 0x2a, 0xbd, 0x0d, 0x0b, 0xaf, 0xbd, 0x97, 0x59, 0x87, 0xbd,
-  0x66, 0x48, 0xbe, 0xbd, 0xaa, 0x33, 0x8b, 0xbd, 0x28, 0xfe, 0x60, 0xbc,
-  0xb8, 0x73, 0x73, 0xbd, 0x58, 0x96, 0x8c, 0xbd, 0x42, 0x85, 0x14, 0x3a,
-  0x17, 0xd2, 0x0d, 0x3d, 0x4a, 0xa9, 0x5d, 0xbb, 0x3c, 0xd4, 0x38, 0xba,
-  0xc9, 0x69, 0x11, 0x3e, 0x2d, 0xde, 0xc5, 0xbc, 0x80, 0x74, 0xdb, 0xbc,
-  0x7a, 0x1f, 0x5f, 0x3d, 0xdc, 0x68, 0xca, 0xbc, 0x29, 0x3b, 0xa3, 0x3d,
-  0xc7, 0xb0, 0x9d, 0x3d, 0x12, 0x12, 0x1f, 0xbc, 0x42, 0x3c, 0xc6, 0x3d,
-  0xc1, 0x37, 0x8e, 0x3d, 0xa4, 0xa2, 0x18, 0x3d, 0x25, 0xf8, 0x0d, 0x3e,
-  0x04, 0xa4, 0xca, 0xbd, 0x99, 0xec, 0x99, 0x3c, 0x2a, 0xef, 0x00, 0x3d,
-  0xe9, 0xa3, 0x8a, 0x3d, 0x31, 0xc9, 0x3b, 0x3e, 0xa5, 0xb1, 0xa1, 0x3d,
-  0xe3, 0xcc, 0xdd, 0x3b, 0xbf, 0x45, 0x92, 0x3c, 0x46, 0xdf, 0x88, 0xbd,
-  0xf0, 0x55, 0xc1, 0xbc, 0x42, 0x4a, 0x41, 0x3d, 0x26, 0xbd, 0x28, 0x3e,
-  0x9e, 0xef, 0x58, 0x3e, 0xee, 0xa5, 0x0e, 0x3a, 0xb6, 0x84, 0x89, 0xbd,
-  0x2b, 0x68, 0x96, 0x3d, 0x7a, 0x87, 0x04, 0x3d, 0x72, 0x76, 0x4a, 0xbc,
-  0x3f, 0xa5, 0x0e, 0x3e, 0x07, 0x56, 0x98, 0x3d, 0xe5, 0x46, 0x25, 0x3d,
-  0x3e, 0x4f, 0x9d, 0x3c, 0xcf, 0x42, 0x3a, 0x3d, 0x02, 0x0c, 0xcd, 0x3a,
-  0x47, 0x50, 0x2f, 0x3e, 0x4a, 0xf3, 0x11, 0x3d, 0xb1, 0x40, 0xfd, 0x3d,
-  0xac, 0xdc, 0xaf, 0x3d, 0x3a, 0xf5, 0x95, 0x3c, 0x26, 0x7f, 0x08, 0x3e,
-  0x06, 0x79, 0xfb, 0x3d, 0x8c, 0x0a, 0x64, 0xbd, 0xf5, 0x16, 0x83, 0xbe,
-  0x4b, 0x9d, 0xdb, 0xbd, 0x5f, 0xf1, 0x34, 0xbe, 0x9b, 0xb5, 0x26, 0xbe,
-  0xc2, 0x68, 0x1d, 0xbc, 0x04, 0x5b, 0x27, 0xbe, 0xdc, 0x20, 0x38, 0xbe,
-  0x7f, 0x9f, 0x63, 0xbe, 0x71, 0x4c, 0x81, 0xbe, 0x71, 0x15, 0xd4, 0xbd,
-  0x4d, 0x02, 0x2d, 0xbe, 0x37, 0x04, 0x57, 0xbe, 0x53, 0x38, 0xd7, 0xbd,
-  0x12, 0x11, 0x3f, 0xbe, 0x04, 0x76, 0x43, 0xbe, 0x63, 0x1a, 0xa4, 0xbd,
-  0xcd, 0xb8, 0xd6, 0x3c, 0x69, 0x1e, 0x9d, 0xbd, 0xb7, 0xe1, 0x79, 0xbd,
-  0xef, 0xe4, 0x29, 0xbe, 0x9b, 0x3a, 0x23, 0xbe, 0xf0, 0x65, 0xbb, 0xbd,
-  0xae, 0x25, 0x90, 0xbd, 0xe1, 0x7e, 0x56, 0xbe, 0x84, 0xc2, 0x6b, 0x3d,
-  0x12, 0x15, 0x3d, 0x3d, 0x22, 0xbe, 0xc2, 0x3c, 0xd9, 0x2a, 0x1b, 0xbe,
-  0x19, 0x54, 0xb0, 0xbe, 0x19, 0xaa, 0xa8, 0x3c, 0x7f, 0xea, 0x0f, 0x3d,
-  0x75, 0xf7, 0x5f, 0xbe, 0x52, 0xe0, 0xe1, 0x3d, 0xf9, 0x4a, 0xc8, 0x3d,
-  0x3a, 0xa7, 0x5b, 0x3d, 0xbe, 0x72, 0xe7, 0xbd, 0xab, 0x54, 0xca, 0xbe,
-  0xed, 0x64, 0x2f, 0x3d, 0xd8, 0x18, 0x7e, 0x3d, 0x2f, 0xe5, 0x75, 0xbd,
-  0x7b, 0xff, 0x01, 0x3e, 0x0e, 0x2a, 0xe9, 0x3c, 0xe9, 0xba, 0x82, 0xbd,
-  0xdf, 0x8d, 0x02, 0xbe, 0x1a, 0xec, 0x48, 0xbe, 0xe5, 0x61, 0xa3, 0xbc,
-  0xdc, 0xd2, 0x0b, 0x3d, 0x57, 0x74, 0xd2, 0xbd, 0xa4, 0x5e, 0x31, 0xbd,
-  0x3e, 0x39, 0xb8, 0xba, 0xb6, 0xfd, 0xa2, 0xbc, 0x4c, 0xd4, 0x2f, 0x3d,
-  0xcc, 0x09, 0x36, 0x3d, 0xd9, 0x25, 0x9d, 0xbd, 0xb8, 0xc2, 0xb3, 0xbc,
-  0x37, 0x49, 0x73, 0x3c, 0x3e, 0x1d, 0x7f, 0xbd, 0xd3, 0x7e, 0xc8, 0xbc,
-  0xa3, 0xa6, 0x2d, 0xbe, 0x6e, 0xfb, 0x29, 0x3b, 0x0d, 0xc9, 0x9e, 0x3e,
-  0x01, 0xd1, 0x5f, 0x3b, 0x87, 0x9f, 0xf9, 0xbc, 0x0c, 0x2f, 0xec, 0x3d,
-  0x49, 0x68, 0x90, 0xbd, 0x58, 0xea, 0x0e, 0x3d, 0x54, 0x1c, 0x02, 0xbe,
-  0x72, 0x6b, 0x2f, 0x3d, 0x9b, 0xe5, 0xa3, 0x3e, 0x16, 0x07, 0x34, 0xbd,
-  0x30, 0x91, 0x22, 0xbd, 0x80, 0x0b, 0x97, 0x3e, 0xec, 0x0b, 0xd7, 0xbd,
-  0x15, 0x5b, 0xc4, 0x3d, 0x22, 0x76, 0x94, 0xbd, 0xb4, 0xea, 0xf4, 0x3d,
-  0x40, 0xd0, 0xc7, 0x3e, 0x88, 0x02, 0x8c, 0x3d, 0x91, 0x1e, 0x03, 0x3d,
-  0x98, 0x75, 0x81, 0x3e, 0x29, 0x92, 0xcc, 0xbd, 0x58, 0x7c, 0x40, 0xbd,
-  0xea, 0xc9, 0x95, 0x3b, 0xb8, 0x0d, 0x1f, 0x3e, 0xd6, 0x0a, 0x6d, 0x3e,
-  0xef, 0x56, 0xe6, 0xbc, 0xcc, 0xb3, 0x6a, 0xbd, 0x31, 0x25, 0x8d, 0x3e,
-  0x81, 0x4d, 0xc2, 0x3d, 0x0c, 0x3f, 0xc4, 0x39, 0x67, 0xc7, 0xe0, 0x3d,
-  0x56, 0x2c, 0x04, 0x3e, 0xa5, 0xcd, 0x17, 0x3e, 0x0e, 0x0d, 0x19, 0x3d,
-  0xea, 0x52, 0x62, 0x3c, 0x97, 0x6f, 0x43, 0x3e, 0x55, 0x16, 0x4a, 0x3e,
-  0xd7, 0x3e, 0xa8, 0x3d, 0x0d, 0x10, 0x4c, 0x3e, 0x62, 0x05, 0x85, 0x3d,
-  0xd4, 0x31, 0xbc, 0xbc, 0xad, 0xf5, 0xd2, 0x3d, 0x95, 0x8d, 0x60, 0x3e,
-  0x83, 0xa1, 0x28, 0x3c, 0x90, 0x83, 0x93, 0xbe, 0x61, 0xa0, 0x68, 0xbe,
-  0xe5, 0xf4, 0x57, 0xbe, 0xf2, 0x33, 0x7d, 0xbe, 0xa7, 0xee, 0xa9, 0xbd,
-  0x1a, 0xa2, 0x62, 0xbe, 0x25, 0xbc, 0x97, 0xbe, 0x01, 0x62, 0xd3, 0xbd,
-  0x50, 0xa8, 0xbe, 0xbd, 0x9b, 0xb1, 0x8a, 0xbd, 0xbe, 0xca, 0x24, 0xbe,
-  0x4a, 0x69, 0x35, 0xbe, 0x8b, 0x95, 0xb7, 0xbd, 0xa1, 0x5b, 0x14, 0xbe,
-  0xa1, 0xdc, 0x93, 0xbd, 0xf7, 0x9b, 0x42, 0xbe, 0xc4, 0x58, 0xb9, 0x3d,
-  0x79, 0x8e, 0xe4, 0x3c, 0xeb, 0x39, 0x0c, 0xbc, 0x4a, 0x41, 0xfd, 0xbd,
-  0x14, 0xfd, 0x1d, 0xbe, 0x99, 0x8d, 0x6e, 0x3d, 0x37, 0x7f, 0x47, 0x3c,
-  0xc6, 0xc1, 0x46, 0xbe, 0x27, 0x69, 0xfb, 0x3d, 0x08, 0x4b, 0x68, 0xbb,
-  0xff, 0xa8, 0xa2, 0xbb, 0x15, 0x1c, 0x01, 0xbc, 0xd1, 0xb2, 0x9c, 0xbe,
-  0x73, 0x06, 0x07, 0x3d, 0xb7, 0x1c, 0x4e, 0x3d, 0x8d, 0xf0, 0x8e, 0xbe,
-  0x7f, 0xf0, 0x29, 0x3e, 0x6d, 0xa2, 0x12, 0x3c, 0xf0, 0x65, 0x52, 0x3d,
-  0x59, 0x12, 0x9d, 0xbd, 0xf7, 0xad, 0x89, 0xbe, 0x6b, 0x95, 0x07, 0xbd,
-  0xe7, 0x0e, 0x51, 0x3d, 0xf6, 0x1c, 0x17, 0xbe, 0xaf, 0x0a, 0x34, 0x3e,
-  0x3f, 0xa4, 0x11, 0x3d, 0xc8, 0x54, 0xf5, 0x3a, 0xb3, 0x68, 0x9c, 0xbd,
-  0xfb, 0xbe, 0x2d, 0xbe, 0xd2, 0xda, 0x33, 0xbd, 0x60, 0x0a, 0x1c, 0x3c,
-  0x7f, 0x09, 0x30, 0xbd, 0x3d, 0x44, 0x0c, 0x3b, 0x04, 0xec, 0x44, 0x3d,
-  0x91, 0xa3, 0x25, 0xbe, 0x59, 0xc6, 0x85, 0xbd, 0xdf, 0x04, 0x88, 0x3d,
-  0x67, 0x07, 0x00, 0xbe, 0x26, 0x76, 0x61, 0xbd, 0x0d, 0xea, 0x9d, 0x3d,
-  0xf4, 0x62, 0x95, 0xbd, 0xa8, 0xce, 0xa9, 0xbd, 0x96, 0xe9, 0x75, 0xbe,
-  0xc9, 0x5c, 0xc8, 0xbd, 0x58, 0xe6, 0x9c, 0x3e, 0xdb, 0xd1, 0x5a, 0xbe,
-  0xec, 0x8c, 0x0d, 0xbe, 0xdc, 0xa7, 0xaa, 0x3d, 0xc2, 0xaa, 0x0a, 0xbe,
-  0x79, 0xa3, 0x8b, 0xbd, 0xbd, 0x9d, 0xb4, 0xbe, 0xe5, 0x1c, 0x2f, 0xbd,
-  0x08, 0x7e, 0xf0, 0x3e, 0x8b, 0xec, 0x4a, 0xbe, 0x20, 0xa8, 0xc9, 0xbd,
-  0x62, 0x69, 0x19, 0x3e, 0x78, 0x19, 0xdd, 0xbd, 0x8c, 0xe6, 0xf7, 0xbd,
-  0x0e, 0xaf, 0x81, 0xbe, 0x8a, 0xa2, 0x38, 0x3d, 0xf4, 0xea, 0xeb, 0x3e,
-  0xdf, 0x4d, 0x60, 0xbe, 0xe2, 0x3b, 0x01, 0xbe, 0x2f, 0x30, 0x6f, 0x3e,
-  0x5e, 0x01, 0xcb, 0xbd, 0xab, 0xeb, 0x31, 0xbd, 0x49, 0xd3, 0x3c, 0xbe,
-  0xc3, 0xb2, 0x98, 0x3d, 0x9d, 0x9d, 0xb5, 0x3e, 0xf6, 0x04, 0x18, 0xbe,
-  0x46, 0xe8, 0x74, 0xbd, 0x64, 0x13, 0xb0, 0x3e, 0xd0, 0xf8, 0xce, 0x3d,
-  0x52, 0xcb, 0x03, 0x3d, 0x4a, 0x57, 0x9e, 0x3b, 0xbd, 0x7a, 0x35, 0x3e,
-  0x55, 0xc5, 0x97, 0x3e, 0x19, 0xfa, 0xe3, 0x3d, 0x31, 0xba, 0x17, 0x3e,
-  0x75, 0x96, 0x60, 0x3e, 0x2b, 0x3a, 0x9d, 0x3e, 0xee, 0x9f, 0x83, 0x3e,
-  0x44, 0x5d, 0x90, 0x3e, 0x98, 0x2c, 0x84, 0x3e, 0xce, 0x07, 0xdb, 0x3d,
-  0xc6, 0x7d, 0x6b, 0x3e, 0x57, 0xe4, 0x8e, 0x3e, 0xb6, 0xbc, 0x79, 0xbd,
-  0x9c, 0xb8, 0xed, 0xbd, 0x62, 0xe8, 0x45, 0xbe, 0x34, 0x06, 0x54, 0xbe,
-  0x56, 0x3e, 0x57, 0xbe, 0x36, 0x2d, 0x96, 0xbd, 0x07, 0x65, 0x44, 0xbe,
-  0xe8, 0xd5, 0x4a, 0xbe, 0xd9, 0x10, 0xd5, 0xbd, 0x7e, 0x98, 0x9b, 0xbd,
-  0x0c, 0x70, 0x3d, 0xbd, 0xd5, 0xaa, 0xd0, 0x3b, 0x16, 0x22, 0xc5, 0xbd,
-  0xda, 0x37, 0xc2, 0x3b, 0xb2, 0x21, 0x92, 0xbd, 0xda, 0x4f, 0xe3, 0xbd,
-  0x3a, 0x05, 0x58, 0xbe, 0xb8, 0xd9, 0xe3, 0x3b, 0xaa, 0x98, 0xfa, 0x3c,
-  0x48, 0x87, 0x8a, 0x3c, 0x8a, 0x87, 0x91, 0xbd, 0xc4, 0xd3, 0xe8, 0xbd,
-  0x0a, 0x8c, 0x41, 0x3d, 0x42, 0x43, 0x52, 0xbc, 0x63, 0x74, 0xb8, 0xbe,
-  0x65, 0xaa, 0xf9, 0x3c, 0xe5, 0xb5, 0x8d, 0x3d, 0xe1, 0x75, 0x40, 0xbd,
-  0x0b, 0x8a, 0x26, 0xbd, 0xff, 0x2d, 0x22, 0xbe, 0x03, 0xb4, 0x78, 0x3d,
-  0xa5, 0x4b, 0x32, 0xbd, 0x1e, 0xbf, 0x4a, 0xbe, 0x8d, 0x9a, 0xad, 0x3d,
-  0xfa, 0x87, 0xa1, 0x3d, 0x0e, 0x53, 0x8d, 0x3c, 0x78, 0x45, 0x41, 0xbd,
-  0x37, 0x7b, 0xd0, 0xbd, 0x72, 0x44, 0x40, 0x3d, 0xc0, 0xf5, 0x8e, 0x3d,
-  0x7c, 0x4d, 0x94, 0xbd, 0xe5, 0xd2, 0x50, 0x3d, 0xa6, 0xc4, 0x78, 0x3c,
-  0x69, 0xc6, 0x1b, 0x3c, 0xdf, 0x77, 0x6b, 0xbb, 0x01, 0x8b, 0x9f, 0x3d,
-  0x7a, 0x71, 0xa8, 0x3d, 0xaf, 0x59, 0x13, 0x3e, 0x26, 0x04, 0x05, 0x3d,
-  0x14, 0x1b, 0x15, 0x3e, 0x03, 0xe7, 0x19, 0xbc, 0x6c, 0x5e, 0x8c, 0xbd,
-  0x6b, 0x61, 0xab, 0x3d, 0x40, 0x64, 0x44, 0x3e, 0x66, 0x75, 0x38, 0xbd,
-  0x82, 0xdd, 0x85, 0xbc, 0x11, 0xc7, 0x6e, 0x3c, 0xc2, 0x29, 0x51, 0xbc,
-  0x22, 0x05, 0xa2, 0xbd, 0xc5, 0x93, 0x94, 0xbe, 0xc0, 0xa2, 0x36, 0xbd,
-  0x0f, 0x1d, 0xc7, 0x3e, 0x00, 0x03, 0x3d, 0xbe, 0x90, 0x2a, 0x0d, 0xbe,
-  0x44, 0xde, 0xee, 0x3d, 0xca, 0x9e, 0x8f, 0xbc, 0x6a, 0x5d, 0x60, 0xbe,
-  0x85, 0x6c, 0xb6, 0xbe, 0xfc, 0x2e, 0x26, 0xbe, 0xde, 0x71, 0xe3, 0x3e,
-  0xb4, 0xbb, 0x6b, 0xbe, 0x27, 0xe9, 0x01, 0xbe, 0x7e, 0xc6, 0x23, 0x3e,
-  0x48, 0xaf, 0x58, 0xbd, 0x08, 0xa6, 0x62, 0xbe, 0xca, 0xed, 0x9f, 0xbe,
-  0x3d, 0xd9, 0x4c, 0xbe, 0x84, 0x8a, 0x9f, 0x3e, 0xef, 0x0e, 0x72, 0xbe,
-  0x73, 0x6c, 0xe7, 0xbd, 0xce, 0xf2, 0x48, 0x3e, 0x7b, 0xc4, 0x0f, 0xbe,
-  0x2f, 0xcd, 0x71, 0xbe, 0x7a, 0x15, 0xaa, 0xbe, 0xb7, 0x41, 0x08, 0xbe,
-  0xce, 0x48, 0x9f, 0x3e, 0x21, 0x6c, 0xb1, 0xbe, 0x36, 0x64, 0x48, 0xbe,
-  0x9a, 0x16, 0x3b, 0x3e, 0x23, 0xae, 0x6a, 0xbe, 0x01, 0x17, 0x4b, 0xbb,
-  0xe9, 0xdc, 0x2a, 0xbe, 0x18, 0xb9, 0x91, 0x3d, 0x0e, 0x5e, 0xbf, 0x3e,
-  0x41, 0x08, 0xd3, 0xbd, 0x49, 0xf5, 0x77, 0xbc, 0x85, 0xbd, 0x8a, 0x3d,
-  0xd5, 0xa1, 0x26, 0x3e, 0xea, 0x0d, 0xeb, 0x3d, 0xc8, 0x37, 0x02, 0x3e,
-  0xca, 0xf1, 0x54, 0x3e, 0xe1, 0xce, 0x26, 0x3e, 0xc7, 0xa8, 0x70, 0x3e,
-  0x0d, 0xf3, 0x7e, 0x3e, 0x35, 0x61, 0xd2, 0xbb, 0xd0, 0x95, 0x43, 0xbd,
-  0x5a, 0x0f, 0x32, 0x3d, 0xb4, 0xa5, 0x48, 0xbd, 0x59, 0xc7, 0x0c, 0xbe,
-  0x01, 0xfb, 0x8f, 0x3c, 0x4f, 0xd1, 0xbc, 0xbd, 0xd2, 0x17, 0x76, 0x3b,
-  0x45, 0x87, 0xd7, 0xbd, 0xeb, 0x57, 0x61, 0xbd, 0xd8, 0xf3, 0xce, 0xbd,
-  0x1e, 0x95, 0x16, 0xbd, 0x9c, 0xba, 0x57, 0xbd, 0x27, 0x89, 0x8a, 0xbd,
-  0x72, 0x84, 0x0f, 0x3c, 0x69, 0x75, 0xd5, 0xbc, 0x1d, 0x66, 0x5b, 0xbe,
-  0x7d, 0x13, 0x50, 0xbd, 0xfa, 0xb4, 0x9b, 0xba, 0xed, 0x41, 0x90, 0x3c,
-  0x1c, 0xcf, 0xe2, 0x3d, 0x79, 0xb4, 0xdb, 0x3d, 0xd2, 0xbc, 0x8d, 0xbd,
-  0xab, 0x70, 0x61, 0xbd, 0xd4, 0x57, 0x9f, 0xbe, 0x14, 0xff, 0x5b, 0x3c,
-  0xe0, 0xc9, 0x68, 0x3d, 0xc6, 0x20, 0xca, 0xbc, 0x56, 0x45, 0x51, 0x3d,
-  0x7e, 0x13, 0x7e, 0x3d, 0xb8, 0xf9, 0x63, 0xbd, 0x1a, 0xd0, 0xc8, 0xbd,
-  0xaa, 0xea, 0x75, 0xbe, 0xb8, 0x24, 0x21, 0x3d, 0xe5, 0x9b, 0xaf, 0x3c,
-  0xe9, 0x9a, 0x42, 0xbd, 0x9a, 0xbf, 0x3c, 0x3c, 0x8a, 0xd3, 0x47, 0xbb,
-  0x8d, 0xb0, 0xa3, 0x3c, 0x28, 0xb1, 0x25, 0xb7, 0x8a, 0x77, 0x05, 0xbe,
-  0x9b, 0x75, 0x4d, 0xbc, 0xe7, 0x13, 0x99, 0x3d, 0xa3, 0x33, 0x97, 0xbc,
-  0x67, 0xb9, 0xff, 0x3c, 0x67, 0x0f, 0x52, 0x3d, 0x8d, 0x94, 0x16, 0x3d,
-  0x9b, 0x29, 0x7d, 0x3d, 0x86, 0xfa, 0x90, 0x3d, 0x1c, 0x3e, 0x11, 0x3d,
-  0x17, 0x31, 0x0d, 0x3d, 0x2d, 0x1a, 0x17, 0xbd, 0x43, 0xf7, 0x5d, 0x3d,
-  0xdf, 0x86, 0x62, 0x3e, 0x90, 0x1f, 0xd8, 0x3c, 0x96, 0xfc, 0x6b, 0xbc,
-  0x3d, 0xce, 0xad, 0x3d, 0x0b, 0x4b, 0x4a, 0xbc, 0x5b, 0xd4, 0x2e, 0xbd,
-  0x18, 0x40, 0x25, 0xbe, 0x6b, 0xf7, 0xfb, 0xbd, 0xec, 0x78, 0x7a, 0x3e,
-  0x50, 0xcc, 0x3b, 0xbe, 0x13, 0xf3, 0xe0, 0xbd, 0xf1, 0x32, 0xba, 0x3d,
-  0xe2, 0xc6, 0x05, 0x3d, 0x2a, 0x93, 0x2c, 0xbe, 0xb7, 0xe7, 0x3f, 0xbe,
-  0xf4, 0x06, 0x43, 0xbe, 0x24, 0xf3, 0x0a, 0x3e, 0x82, 0x3d, 0x61, 0xbe,
-  0x43, 0xb7, 0x0a, 0xbe, 0xfa, 0x1f, 0xb5, 0xbc, 0xee, 0x8d, 0x77, 0x3c,
-  0xf9, 0x0f, 0xf4, 0xbd, 0xf1, 0xf1, 0x5c, 0xbe, 0x35, 0xf3, 0x59, 0xbe,
-  0x71, 0x1e, 0x13, 0xbb, 0x7e, 0x59, 0x0c, 0xbe, 0x86, 0x08, 0xe0, 0xbd,
-  0x7c, 0x75, 0x0e, 0x3e, 0xb6, 0x70, 0x27, 0xbd, 0x23, 0xd7, 0x26, 0xbe,
-  0xbb, 0x21, 0x4f, 0xbe, 0x44, 0x0e, 0xac, 0xbe, 0x85, 0xdb, 0xcb, 0x3c,
-  0xb4, 0x87, 0x8b, 0xbe, 0x94, 0xbc, 0x0d, 0xbe, 0x42, 0xa2, 0x85, 0x3e,
-  0x75, 0x01, 0xf6, 0xbd, 0x8a, 0xe9, 0x35, 0xbe, 0xc8, 0x11, 0x28, 0xbe,
-  0xbd, 0x49, 0xb7, 0xbe, 0x9a, 0xe1, 0x59, 0xbb, 0x18, 0xc1, 0x7b, 0xbe,
-  0xe1, 0xd6, 0x36, 0xbe, 0xd7, 0x8b, 0x1d, 0x3d, 0xd3, 0x66, 0x1d, 0xbe,
-  0x07, 0x70, 0x24, 0xbe, 0x10, 0x40, 0x1a, 0xbd, 0xc4, 0xb3, 0x02, 0xbd,
-  0x3b, 0x20, 0x6f, 0x3d, 0xf0, 0x6f, 0xca, 0x3c, 0x58, 0x58, 0x05, 0xbe,
-  0xb1, 0x87, 0x12, 0xbc, 0x80, 0x06, 0x29, 0xbd, 0x2f, 0x96, 0xb2, 0xbd,
-  0x21, 0xda, 0xb5, 0xbd, 0xf9, 0xb5, 0x08, 0xbd, 0xb2, 0xd1, 0xaf, 0x3c,
-  0x6a, 0x9d, 0x29, 0xbd, 0x20, 0x4f, 0xe1, 0xbd, 0x84, 0xdf, 0xe5, 0xbb,
-  0xdf, 0xd4, 0xaa, 0x3c, 0x69, 0x3c, 0x23, 0xbe, 0x7f, 0x19, 0x37, 0xbe,
-  0xbb, 0x45, 0xa9, 0xbb, 0xd1, 0xe3, 0x63, 0x3d, 0x95, 0x18, 0xf8, 0xbd,
-  0xd3, 0x55, 0x36, 0xbe, 0x65, 0x6f, 0x63, 0x3e, 0xef, 0xe0, 0xf3, 0xbb,
-  0x88, 0x0d, 0x2e, 0xbe, 0x85, 0x39, 0x70, 0xbd, 0xa7, 0xaf, 0x72, 0x3c,
-  0x63, 0x22, 0xbd, 0x3e, 0xc4, 0x04, 0xbd, 0xbd, 0xa1, 0xbf, 0x11, 0xbd,
-  0xba, 0xfb, 0x26, 0xbc, 0x93, 0x58, 0x46, 0xbd, 0xc2, 0xc0, 0xf4, 0xbd,
-  0xd5, 0x4a, 0x57, 0xbe, 0xd6, 0xbb, 0x2e, 0xbd, 0xa9, 0x97, 0xae, 0x3e,
-  0x3b, 0x42, 0x3a, 0xbe, 0xc5, 0xbc, 0x89, 0xbd, 0x31, 0x83, 0x82, 0xbd,
-  0x73, 0x7f, 0x29, 0x3d, 0xbc, 0x63, 0xc6, 0xbc, 0xc8, 0x6e, 0xf3, 0xbd,
-  0xda, 0x96, 0x59, 0x3c, 0x63, 0x20, 0x5c, 0x3e, 0xd1, 0x66, 0x81, 0xbc,
-  0x70, 0x5c, 0xaa, 0xbd, 0x2a, 0x2c, 0xdc, 0x3b, 0x1e, 0xa0, 0x90, 0x3b,
-  0x40, 0x10, 0xb6, 0x3c, 0xbc, 0x07, 0xef, 0xbd, 0x3f, 0xe9, 0x1a, 0x3d,
-  0x15, 0xc1, 0x36, 0x3e, 0x67, 0x60, 0xfa, 0xbc, 0x48, 0x0f, 0xcb, 0xba,
-  0xd2, 0x81, 0x8a, 0xbb, 0xf2, 0xb9, 0x8e, 0xbd, 0x37, 0xf7, 0xac, 0x3b,
-  0xd4, 0xe4, 0x0e, 0xbe, 0xa8, 0x36, 0x94, 0x3b, 0x76, 0x15, 0x42, 0x3e,
-  0x15, 0xd1, 0xcc, 0xbc, 0x0c, 0xfa, 0x9a, 0xbd, 0xe4, 0xa6, 0x97, 0xbc,
-  0x81, 0x7e, 0x3c, 0x3d, 0xda, 0x55, 0x89, 0xbd, 0x1b, 0x3b, 0xf5, 0xbd,
-  0x8a, 0xf1, 0x2c, 0xbe, 0xe2, 0x47, 0xcd, 0x3d, 0x3b, 0x04, 0xf3, 0xbd,
-  0x74, 0x68, 0xf2, 0xbd, 0x82, 0xc2, 0xb8, 0xbc, 0x35, 0x1a, 0x02, 0x3c,
-  0xca, 0xc7, 0xf2, 0xbc, 0xd4, 0x40, 0xe8, 0xbb, 0xa9, 0x9b, 0x3c, 0xbe,
-  0x50, 0x57, 0xe8, 0xbd, 0x3c, 0xe5, 0xde, 0xbd, 0x56, 0x54, 0xde, 0xbc,
-  0xfa, 0x94, 0x09, 0xbe, 0x82, 0x0e, 0x6f, 0x3d, 0xb3, 0x38, 0x1e, 0xbd,
-  0x71, 0x57, 0xf2, 0x3b, 0xd3, 0x35, 0x0d, 0xbe, 0x8a, 0x85, 0x49, 0xbe,
-  0x46, 0x6a, 0xc7, 0xbd, 0xaf, 0x02, 0x30, 0x3d, 0xdd, 0x96, 0x12, 0xbe,
-  0x7a, 0xe7, 0xa5, 0x3c, 0xfd, 0x08, 0x1d, 0xbd, 0x84, 0x6b, 0xb6, 0xbd,
-  0x5a, 0xae, 0x57, 0xbe, 0x52, 0x1d, 0x00, 0xbe, 0xf1, 0x44, 0xad, 0xbd,
-  0xb2, 0xf7, 0x39, 0x3d, 0x23, 0xd7, 0xf6, 0xbb, 0x28, 0xd3, 0x00, 0xbc,
-  0x44, 0x67, 0x94, 0xbc, 0x72, 0x0a, 0x6e, 0xbd, 0x51, 0x72, 0x64, 0xbe,
-  0xf4, 0x4d, 0x3e, 0xbe, 0xfb, 0x3c, 0xda, 0xbd, 0xe5, 0x98, 0x00, 0xbc,
-  0xba, 0xc1, 0x7c, 0x3d, 0xd2, 0x6e, 0x5c, 0xbd, 0xaa, 0x00, 0xe3, 0x3c,
-  0x5d, 0xb6, 0x4b, 0xbd, 0xee, 0x8f, 0xbb, 0xbd, 0x9d, 0x8d, 0x01, 0xbd,
-  0x29, 0xc4, 0x4d, 0xbd, 0x00, 0x9c, 0xe5, 0xbd, 0xc8, 0xde, 0xd1, 0xbc,
-  0x2f, 0x80, 0x93, 0xbd, 0x0e, 0x61, 0xcf, 0xbd, 0xfd, 0x23, 0xae, 0xbd,
-  0xf1, 0x08, 0xb6, 0xbd, 0x90, 0xac, 0xf7, 0x3c, 0x09, 0xe5, 0x7b, 0xbd,
-  0x34, 0xe3, 0x81, 0xbc, 0xfc, 0x87, 0x2a, 0x3e, 0xe2, 0x27, 0xbf, 0x39,
-  0x25, 0xf2, 0x06, 0xbd, 0x29, 0x99, 0xae, 0xbd, 0x25, 0xe5, 0x39, 0x3d,
-  0x97, 0x9e, 0x08, 0x3d, 0xee, 0xa8, 0x56, 0xbd, 0xf4, 0xe9, 0x5b, 0xbc,
-  0x62, 0x1f, 0xa4, 0x3e, 0xd2, 0xcc, 0x95, 0x3c, 0xfe, 0x2e, 0x48, 0xbd,
-  0xb7, 0xe9, 0x77, 0xbd, 0xc4, 0x92, 0x7a, 0x3c, 0xb5, 0x1b, 0x4d, 0x3e,
-  0x47, 0x12, 0xc0, 0xbd, 0x45, 0x12, 0x21, 0x3d, 0x6e, 0x86, 0x89, 0x3e,
-  0x6e, 0x56, 0x47, 0x3d, 0x1c, 0x4b, 0x18, 0xbe, 0x5c, 0xd8, 0xf7, 0xbd,
-  0xf3, 0x13, 0xe4, 0xbd, 0xc9, 0x22, 0xf3, 0x3e, 0xf7, 0xec, 0x0b, 0xbe,
-  0x97, 0xc6, 0x03, 0xbe, 0xba, 0x29, 0x9a, 0x3e, 0xed, 0x94, 0x85, 0xbd,
-  0xbc, 0x06, 0x01, 0xbe, 0xe2, 0x8a, 0x02, 0xbe, 0xa8, 0x93, 0x56, 0xbd,
-  0xa6, 0xae, 0xe2, 0x3e, 0xc8, 0x0e, 0x37, 0xbe, 0xe4, 0x8f, 0xad, 0xbd,
-  0xe8, 0x0c, 0x18, 0x3e, 0xe6, 0x0e, 0x87, 0xbd, 0x9c, 0xb4, 0xfa, 0xbd,
-  0xc0, 0xcd, 0xfa, 0xbd, 0x4f, 0x29, 0x25, 0xbd, 0x15, 0xb2, 0x7a, 0x3e,
-  0x65, 0x01, 0x0d, 0xbe, 0x84, 0x74, 0x94, 0xbd, 0x39, 0xea, 0xda, 0x3d,
-  0x87, 0x69, 0xa8, 0xbc, 0x85, 0xc4, 0x9e, 0xbc, 0xa5, 0xdc, 0xde, 0xbd,
-  0x36, 0x03, 0x17, 0xbe, 0xc4, 0xde, 0x18, 0x3e, 0x0f, 0xf0, 0x8e, 0xbd,
-  0x80, 0x75, 0x9e, 0xbd, 0xfd, 0x47, 0xa6, 0xbc, 0x44, 0x83, 0x15, 0xbd,
-  0xf3, 0x45, 0x04, 0x3d, 0x39, 0xa8, 0xbf, 0xbd, 0x6f, 0xda, 0xdd, 0xbd,
-  0x8c, 0xed, 0xef, 0xbc, 0x5c, 0xb4, 0x8b, 0xbd, 0xdb, 0xd9, 0x3e, 0xbd,
-  0x18, 0x15, 0x29, 0xbe, 0xeb, 0x0a, 0x79, 0xbc, 0x41, 0x60, 0x03, 0xbd,
-  0x41, 0xa9, 0x40, 0xbd, 0x76, 0xb6, 0xe0, 0xbd, 0x1b, 0x95, 0x59, 0xbd,
-  0x60, 0xbf, 0x09, 0xbd, 0x5d, 0x47, 0x9c, 0xbc, 0xe2, 0xa4, 0x7e, 0xbe,
-  0x45, 0x4b, 0x38, 0x3d, 0xf8, 0x63, 0x89, 0x3c, 0x83, 0xb5, 0x25, 0x3d,
-  0x07, 0x30, 0x20, 0xbd, 0x37, 0xf3, 0x4c, 0xbe, 0xd7, 0x08, 0x21, 0xbd,
-  0x53, 0x2d, 0x88, 0x3c, 0x6f, 0x1a, 0x4a, 0xbe, 0x18, 0x3e, 0x40, 0x3d,
-  0xd8, 0x36, 0xd5, 0x3d, 0xef, 0xfa, 0x09, 0x3d, 0xbc, 0xd1, 0x24, 0x3d,
-  0xa9, 0xcd, 0xef, 0xbd, 0x17, 0x5c, 0x14, 0x3d, 0x89, 0x6f, 0xde, 0xb9,
-  0xd0, 0x93, 0xdd, 0xbd, 0xe0, 0x05, 0xf5, 0x3d, 0x0e, 0x33, 0x21, 0xbc,
-  0xd6, 0x2d, 0x94, 0x3d, 0x0b, 0xba, 0x4d, 0xbd, 0xfb, 0xb7, 0x13, 0xbe,
-  0xc8, 0x7b, 0xfe, 0x3d, 0x38, 0x21, 0x11, 0x3d, 0x61, 0xa4, 0xe1, 0x3b,
-  0x5d, 0x3f, 0x91, 0x3d, 0x90, 0x08, 0x3a, 0x3d, 0xea, 0xab, 0x2d, 0xbd,
-  0x5a, 0xd4, 0x90, 0x3d, 0x0b, 0x06, 0x7d, 0xbd, 0xc5, 0xe2, 0x28, 0x3c,
-  0x70, 0x9a, 0x51, 0x3d, 0xda, 0xc9, 0x5d, 0xbd, 0xe6, 0x7c, 0xbd, 0x39,
-  0xd5, 0x13, 0x01, 0xbe, 0x1f, 0xb1, 0x04, 0xbd, 0x38, 0x35, 0x1a, 0xbc,
-  0xff, 0xbc, 0xfa, 0xbb, 0x0d, 0xbe, 0x72, 0xbd, 0x29, 0x36, 0xf8, 0xbb,
-  0x66, 0xf3, 0x06, 0x3e, 0x25, 0xca, 0x2f, 0x3d, 0x79, 0x78, 0x85, 0x3d,
-  0xf6, 0xe8, 0x80, 0x3d, 0x1d, 0x44, 0x87, 0x3d, 0xea, 0xcf, 0x53, 0x3d,
-  0x32, 0x49, 0x9c, 0x3b, 0xa3, 0x13, 0xbd, 0xbc, 0xaf, 0xc5, 0x2f, 0x3e,
-  0x83, 0xf0, 0x75, 0x3d, 0xe1, 0x51, 0x38, 0xbd, 0x5a, 0x33, 0x8b, 0xbd,
-  0x93, 0x4b, 0x2b, 0x3e, 0x16, 0xef, 0x92, 0x3e, 0x6b, 0x34, 0x5d, 0x3d,
-  0x33, 0xdd, 0xc2, 0x3c, 0xef, 0x65, 0x0e, 0x3e, 0xf4, 0x44, 0xc0, 0x3d,
-  0xdc, 0xc0, 0x0d, 0xbc, 0x03, 0x5d, 0xd8, 0xbd, 0xd5, 0x08, 0xac, 0x3c,
-  0xfa, 0x37, 0x6e, 0x3e, 0xd4, 0x53, 0x37, 0xbd, 0x70, 0xfa, 0x0a, 0x3d,
-  0xc9, 0x56, 0xc8, 0x3d, 0xe0, 0xfc, 0x28, 0xbc, 0x0b, 0xac, 0x83, 0x3b,
-  0xe7, 0x78, 0x94, 0xbd, 0x9c, 0x1c, 0x15, 0xbd, 0x06, 0x11, 0x2a, 0x3e,
-  0x81, 0x93, 0xed, 0xbd, 0x2e, 0xcb, 0x17, 0xbb, 0xae, 0x89, 0x3d, 0x3e,
-  0xda, 0x4b, 0x81, 0x3c, 0x7c, 0xcb, 0xba, 0x3c, 0xc8, 0x38, 0x97, 0xbd,
-  0x03, 0x0a, 0x99, 0xbd, 0x3e, 0x7b, 0xf9, 0x3c, 0xa0, 0xb4, 0x2a, 0xbc,
-  0x70, 0x34, 0x87, 0x3c, 0xf8, 0x67, 0x8c, 0x3d, 0xff, 0x0b, 0x9f, 0x3d,
-  0x50, 0x7b, 0x8a, 0xbd, 0xa7, 0xa1, 0x51, 0xbd, 0x92, 0xc7, 0xd7, 0xbd,
-  0x98, 0xad, 0xe2, 0xbc, 0x4a, 0x21, 0x93, 0xbd, 0x0d, 0x62, 0xc7, 0xbd,
-  0xc7, 0xc6, 0xfb, 0xbb, 0xca, 0xa2, 0x4d, 0xbd, 0xbf, 0xf4, 0xd9, 0x3a,
-  0x9e, 0x43, 0x74, 0xbc, 0xe8, 0x6e, 0xb0, 0xbd, 0xa8, 0xdb, 0x2f, 0xbc,
-  0x2c, 0x73, 0x00, 0x3d, 0xa5, 0x2a, 0x5c, 0xbd, 0xf6, 0xb4, 0xb0, 0xbc,
-  0xbf, 0x13, 0x6f, 0x3d, 0x78, 0x81, 0x03, 0x3d, 0x8a, 0xae, 0xd5, 0x3c,
-  0xea, 0x2b, 0xb9, 0xbc, 0x2a, 0x7f, 0x89, 0xbd, 0x1b, 0x5f, 0xbf, 0xbc,
-  0xe3, 0x75, 0x13, 0x3d, 0x36, 0x7e, 0xb5, 0xbd, 0x94, 0xa0, 0x9d, 0x3d,
-  0xb5, 0x43, 0xb8, 0x3d, 0x24, 0x79, 0x26, 0x3d, 0x67, 0x12, 0x60, 0xbc,
-  0x11, 0x23, 0x80, 0xbd, 0x01, 0x6b, 0x19, 0xbd, 0x10, 0x07, 0xbd, 0x3d,
-  0x30, 0x7d, 0x2e, 0xbe, 0x08, 0xd6, 0x3d, 0x3d, 0x9b, 0x4c, 0x77, 0x3d,
-  0x4d, 0x05, 0x9b, 0x3d, 0x23, 0xf0, 0xb1, 0x3d, 0x3e, 0xc6, 0x04, 0xbe,
-  0xd4, 0x5b, 0x93, 0x3d, 0x60, 0x22, 0x62, 0x3d, 0x37, 0xb2, 0x20, 0xbe,
-  0x52, 0x00, 0xe0, 0x3d, 0x7b, 0x5f, 0x31, 0x3d, 0x97, 0x7f, 0x00, 0x3e,
-  0x27, 0x59, 0x36, 0xbb, 0x64, 0x04, 0xd3, 0xbd, 0xcb, 0xa7, 0xe7, 0x3d,
-  0xd5, 0xfe, 0x00, 0x3e, 0x48, 0xef, 0xb0, 0xbd, 0xf6, 0xa0, 0x73, 0x3d,
-  0xc0, 0x72, 0x7e, 0x3d, 0xcf, 0x80, 0x48, 0x3d, 0x99, 0xa1, 0x8f, 0x3d,
-  0x82, 0x9d, 0x15, 0xbd, 0xcb, 0x17, 0x03, 0xbc, 0xd6, 0xb1, 0x4f, 0x3d,
-  0x2e, 0x6e, 0x88, 0xbd, 0x70, 0x04, 0xba, 0x3c, 0xc6, 0x9f, 0x0a, 0xbd,
-  0x58, 0x0b, 0x3f, 0xbd, 0x84, 0x29, 0x82, 0xbd, 0x36, 0x0e, 0x33, 0x3d,
-  0x1c, 0x1d, 0x8d, 0xbd, 0x4d, 0xcb, 0x08, 0xbe, 0x68, 0xbd, 0xef, 0xb8,
-  0x32, 0xed, 0xdb, 0xbc, 0x43, 0xee, 0x0a, 0x3d, 0xf5, 0xe4, 0x73, 0x3c,
-  0xa0, 0xb3, 0x38, 0xbd, 0x39, 0xc0, 0xf5, 0x3c, 0x7e, 0x05, 0xdf, 0x3c,
-  0x1f, 0xb4, 0x34, 0xbc, 0x03, 0x2d, 0x31, 0x3e, 0x79, 0x3e, 0xc7, 0xbd,
-  0x00, 0xbd, 0xfd, 0x3c, 0x4b, 0x29, 0x3b, 0xbc, 0x2a, 0xe5, 0x98, 0x3d,
-  0x10, 0x38, 0x62, 0x3d, 0x07, 0x8c, 0xee, 0x3c, 0x2f, 0xad, 0x9b, 0xbd,
-  0xfa, 0x8a, 0x07, 0x3e, 0x7f, 0xa4, 0x0b, 0xbc, 0x6b, 0x53, 0x56, 0x3d,
-  0xc3, 0x3b, 0x51, 0x3d, 0x95, 0xfb, 0x7f, 0x3d, 0xd2, 0x81, 0x18, 0x3e,
-  0x0c, 0x4a, 0x4a, 0x3d, 0xca, 0x0e, 0xa4, 0x3c, 0xa9, 0x96, 0x86, 0x3d,
-  0x7a, 0x94, 0x3c, 0xbb, 0xfd, 0xdc, 0x06, 0x3d, 0x2e, 0x0d, 0x07, 0xbd,
-  0x2b, 0x55, 0x93, 0x3c, 0x78, 0x94, 0xa3, 0x3d, 0xd3, 0x5f, 0x86, 0xbc,
-  0x74, 0x51, 0x84, 0x3d, 0xdd, 0xb7, 0x8b, 0x3d, 0x68, 0xdf, 0xdf, 0x3d,
-  0xa4, 0xce, 0xcb, 0x3c, 0x67, 0xca, 0x3d, 0x3b, 0xaf, 0x4e, 0x56, 0x3d,
-  0x12, 0xf3, 0x35, 0x3d, 0xa1, 0xfa, 0x32, 0xbd, 0x18, 0xad, 0x7e, 0x3c,
-  0x0d, 0x0d, 0xd4, 0x3c, 0xff, 0xf5, 0x80, 0x3c, 0x18, 0x67, 0xb4, 0x3d,
-  0x57, 0xca, 0x08, 0xbd, 0x93, 0x67, 0x15, 0xbc, 0x13, 0x54, 0xb7, 0xbc,
-  0x65, 0xd3, 0x46, 0x3c, 0x95, 0x60, 0x44, 0x3d, 0xa1, 0xb5, 0xaf, 0xbc,
-  0xed, 0xa0, 0x8a, 0x3d, 0x30, 0xb1, 0x3e, 0x3d, 0x73, 0xb4, 0x88, 0x3d,
-  0x28, 0xfc, 0x89, 0x3d, 0x74, 0x30, 0x8e, 0xbc, 0x17, 0xd8, 0x14, 0xbd,
-  0x4a, 0xae, 0xa8, 0x3d, 0x19, 0xcf, 0x97, 0xbd, 0xff, 0x02, 0x3f, 0xbd,
-  0xc2, 0x31, 0xe6, 0x3c, 0x6f, 0x24, 0xbe, 0x3d, 0xde, 0x55, 0x8d, 0x3b,
-  0x70, 0x83, 0x9f, 0xbd, 0x1e, 0xbc, 0xd5, 0x3d, 0x3e, 0x68, 0x6e, 0x3d,
-  0x83, 0x43, 0x55, 0xbd, 0x4f, 0x15, 0x72, 0x3d, 0xe1, 0xcb, 0xfd, 0xbc,
-  0x16, 0x77, 0x51, 0x3d, 0x57, 0x29, 0x07, 0x3b, 0xf7, 0x6a, 0x0e, 0xbd,
-  0xed, 0xa9, 0x24, 0x3d, 0xdd, 0xb8, 0x90, 0xbc, 0xad, 0x31, 0xd5, 0xbd,
-  0xaf, 0x22, 0xa5, 0x3d, 0x31, 0x9d, 0xa6, 0x3d, 0x38, 0x5a, 0x7d, 0x3d,
-  0xb0, 0x40, 0x4d, 0x3d, 0x5f, 0x78, 0xa8, 0xbc, 0xd5, 0xfd, 0x13, 0x3e,
-  0xaf, 0x5e, 0x0a, 0x3e, 0xff, 0x23, 0xc5, 0xbd, 0xa1, 0x4e, 0x7f, 0x3d,
-  0x08, 0xe5, 0xe4, 0x3d, 0x55, 0x3e, 0xbf, 0x3d, 0xe7, 0x0e, 0xea, 0x3d,
-  0x7f, 0x7b, 0xad, 0xbc, 0x31, 0x48, 0x57, 0x3d, 0xd2, 0xe1, 0xaf, 0x3d,
-  0xf1, 0xba, 0x34, 0xbd, 0xdb, 0xb2, 0x1f, 0x3b, 0x0b, 0xf8, 0xc4, 0x3b,
-  0x1e, 0xaa, 0xa4, 0x3b, 0xcd, 0x0a, 0x0f, 0xbd, 0x3f, 0x42, 0xfb, 0xbb,
-  0x2e, 0x0c, 0x97, 0x3d, 0x48, 0x82, 0xaa, 0x3d, 0x18, 0x63, 0x0a, 0xbd,
-  0x48, 0x5d, 0x40, 0x3d, 0x8a, 0x58, 0x0c, 0xbd, 0xe9, 0xc3, 0x0c, 0x3c,
-  0xba, 0x0f, 0xc2, 0xbd, 0x0d, 0x1c, 0x26, 0xbd, 0x7e, 0x14, 0xce, 0xbd,
-  0x19, 0xa2, 0x0a, 0xbd, 0x26, 0x05, 0x0b, 0x3b, 0x5f, 0xdd, 0xad, 0xbd,
-  0x49, 0x25, 0x6d, 0xbc, 0xd6, 0x1b, 0x12, 0xbd, 0x15, 0x7a, 0x25, 0xbd,
-  0x3b, 0x07, 0x97, 0x3b, 0xa6, 0x3e, 0x5c, 0xbc, 0x25, 0x4a, 0xf6, 0x3c,
-  0xac, 0xfa, 0x43, 0x3b, 0x54, 0xcd, 0xa3, 0xbd, 0xba, 0x9a, 0x3b, 0xbd,
-  0x4d, 0x69, 0xb7, 0xbd, 0x52, 0x80, 0x85, 0xbd, 0x19, 0x0d, 0x44, 0xbd,
-  0x1b, 0xad, 0xa2, 0xbd, 0x59, 0xc5, 0xd6, 0xbd, 0x04, 0x4d, 0xf9, 0x3d,
-  0x4d, 0x15, 0x24, 0xbd, 0x3e, 0xe0, 0xb1, 0xbc, 0x5e, 0x66, 0xae, 0x3d,
-  0x40, 0xd9, 0xbd, 0xbc, 0x6a, 0xcc, 0x6e, 0x3d, 0x14, 0x10, 0x51, 0x3b,
-  0x98, 0x69, 0x3a, 0xbd, 0x69, 0xbe, 0xaf, 0x3d, 0xe5, 0x83, 0x5b, 0x3c,
-  0xf2, 0x70, 0xe0, 0x3b, 0x03, 0x36, 0x17, 0x3d, 0x04, 0x9b, 0x53, 0x3d,
-  0x1b, 0x1d, 0x40, 0xbd, 0xba, 0x66, 0x89, 0x3d, 0x53, 0xff, 0x38, 0x3d,
-  0x70, 0x42, 0xa3, 0x3d, 0xf8, 0x07, 0xf5, 0xba, 0x8b, 0x0d, 0x60, 0xbc,
-  0xfa, 0x60, 0xfb, 0xbc, 0x24, 0x65, 0x36, 0x3d, 0x64, 0x36, 0xe9, 0x3c,
-  0x30, 0xc9, 0x84, 0x3d, 0x16, 0xad, 0x9e, 0x3d, 0xbb, 0xb0, 0xf7, 0x3d,
-  0xf8, 0x98, 0x70, 0x3d, 0x98, 0x49, 0xc9, 0x3b, 0x22, 0x7f, 0x1c, 0xbd,
-  0x48, 0x16, 0x99, 0x3d, 0x9d, 0xc5, 0x1e, 0xbd, 0x4a, 0x3d, 0x45, 0x3c,
-  0x4e, 0xa8, 0x0f, 0x3c, 0x31, 0xf5, 0x92, 0x3d, 0x7b, 0x3c, 0xee, 0x3c,
-  0x23, 0xd2, 0x21, 0x3d, 0xf6, 0x2f, 0xa3, 0xbc, 0x8f, 0x45, 0x93, 0x3c,
-  0x64, 0x8d, 0x88, 0xbd, 0x75, 0x99, 0x14, 0x3d, 0xc9, 0xb2, 0xab, 0xbc,
-  0xc8, 0xd2, 0x02, 0x3d, 0xd1, 0x2e, 0xb5, 0x3c, 0x14, 0x1e, 0xe3, 0x3c,
-  0xa1, 0x7e, 0x61, 0xbd, 0xb2, 0x2c, 0xa0, 0x3c, 0x8e, 0x56, 0x40, 0xbd,
-  0xa5, 0x42, 0xba, 0xbc, 0x64, 0x1f, 0x42, 0x3c, 0x6d, 0x99, 0x33, 0xbc,
-  0xcf, 0xea, 0xa2, 0xbd, 0xe4, 0x2f, 0x8e, 0xbc, 0x4f, 0x46, 0x2f, 0x3d,
-  0x52, 0x55, 0x3d, 0x3d, 0x2d, 0x54, 0xa3, 0xbb, 0x7a, 0x0a, 0x4c, 0xbd,
-  0xd0, 0xbe, 0xbe, 0xbc, 0x92, 0xe0, 0x94, 0x3d, 0x0b, 0xcd, 0x17, 0xbd,
-  0xc8, 0x8e, 0x2c, 0x3c, 0xe3, 0xaf, 0xbb, 0x3d, 0x9d, 0xed, 0x40, 0xbd,
-  0x1f, 0x69, 0xd4, 0x3c, 0x78, 0x06, 0x3d, 0x3d, 0x97, 0x7d, 0xc6, 0xbb,
-  0xfa, 0xb4, 0x47, 0xbd, 0x28, 0xf8, 0x8c, 0xbc, 0x10, 0x14, 0xff, 0x3d,
-  0xe6, 0x54, 0x52, 0x3d, 0x34, 0x4e, 0x46, 0xbd, 0x2a, 0x07, 0xa2, 0x3c,
-  0x5c, 0x40, 0x81, 0x3c, 0xab, 0x02, 0x7d, 0x3c, 0x49, 0x14, 0x47, 0xbd,
-  0x94, 0xd1, 0x3b, 0xbd, 0xbd, 0x20, 0xb2, 0x3b, 0x1f, 0xb5, 0x67, 0x3c,
-  0x94, 0x39, 0xce, 0xbc, 0x89, 0xa2, 0x52, 0xbd, 0x3e, 0xb7, 0xe8, 0x3c,
-  0xf9, 0x54, 0x28, 0x3d, 0x45, 0xe3, 0xdd, 0xbc, 0x5a, 0x1f, 0x13, 0xbc,
-  0x67, 0xdd, 0x0d, 0x3d, 0xd5, 0x5c, 0x26, 0xbc, 0xb2, 0xe8, 0xc5, 0xbc,
-  0x2f, 0xdf, 0x19, 0xbd, 0xdf, 0xe1, 0x45, 0x3d, 0x3d, 0x33, 0x7b, 0xbc,
-  0x02, 0x67, 0x1b, 0x3d, 0x0c, 0x2c, 0x3f, 0xbd, 0x21, 0x31, 0xd4, 0xbc,
-  0x9b, 0x8c, 0x64, 0xbd, 0xef, 0x1a, 0xbd, 0xbd, 0xb1, 0xe1, 0xf4, 0x3b,
-  0x23, 0x78, 0x33, 0xbd, 0xc2, 0x29, 0x55, 0xbd, 0xc5, 0x51, 0x99, 0x3c,
-  0x38, 0x36, 0xc0, 0xbd, 0xe3, 0x04, 0xca, 0xbd, 0x2b, 0x8d, 0x4b, 0xbd,
-  0x87, 0xa7, 0x0d, 0xbd, 0xfd, 0x3f, 0x49, 0x3d, 0xfa, 0x67, 0x2d, 0xbd,
-  0x19, 0x02, 0x75, 0xbd, 0x31, 0x63, 0x39, 0xbc, 0xdb, 0x8f, 0x38, 0xbe,
-  0x87, 0x3a, 0x4a, 0x3c, 0x6f, 0x15, 0x70, 0xbd, 0x29, 0x54, 0x27, 0xbd,
-  0xb2, 0x00, 0x6e, 0x3d, 0xdb, 0xbc, 0xc6, 0xbb, 0xd3, 0xa0, 0xa0, 0xbb,
-  0xb8, 0x69, 0x20, 0x3c, 0x05, 0x94, 0x79, 0xbd, 0x48, 0x40, 0x67, 0x3c,
-  0xc1, 0xe8, 0x53, 0x3d, 0x1a, 0x87, 0x05, 0x3c, 0xf7, 0xda, 0x61, 0xbc,
-  0xb0, 0x0f, 0x1a, 0x3d, 0x79, 0xef, 0x70, 0x3d, 0x1d, 0xc6, 0xab, 0x3d,
-  0x07, 0x7f, 0xa4, 0x3d, 0xc7, 0x5c, 0x80, 0x3d, 0xba, 0x6c, 0x61, 0x3d,
-  0x9d, 0x89, 0xd6, 0x3b, 0x97, 0x81, 0x8b, 0x3d, 0x8f, 0x6a, 0xf8, 0x3c,
-  0xa0, 0xfb, 0x96, 0x3d, 0x6b, 0xcd, 0x65, 0x3c, 0x35, 0xd6, 0x35, 0x3d,
-  0x9a, 0x11, 0x90, 0x3d, 0x14, 0x9e, 0x7f, 0x3c, 0x10, 0xf2, 0xf8, 0xbb,
-  0x5f, 0x31, 0x64, 0x3d, 0xc3, 0x35, 0x95, 0x3c, 0xc5, 0xa4, 0x2d, 0x3b,
-  0x7d, 0xc5, 0x9d, 0x3d, 0xe6, 0xd8, 0x46, 0xbd, 0x31, 0x65, 0xb4, 0x3d,
-  0x2e, 0xbd, 0x75, 0x3b, 0x52, 0x64, 0x0c, 0x3d, 0xeb, 0xd3, 0x14, 0xbc,
-  0x5d, 0xa1, 0x36, 0x3c, 0xee, 0x9a, 0xc7, 0x3d, 0xc3, 0xba, 0xe7, 0xbc,
-  0xc5, 0xb5, 0xd8, 0x3c, 0x29, 0xae, 0xfb, 0xbb, 0xf7, 0x79, 0x8f, 0xbc,
-  0x83, 0xa5, 0xdc, 0xbc, 0x12, 0xc7, 0x34, 0x3c, 0x17, 0x30, 0x97, 0x3c,
-  0x88, 0x2b, 0x60, 0x3d, 0x6d, 0xa3, 0xd5, 0x3c, 0x51, 0x0a, 0xd2, 0x3b,
-  0x5b, 0xdb, 0x82, 0x3b, 0x32, 0xa3, 0xe0, 0xbb, 0x47, 0x18, 0x49, 0xbd,
-  0x96, 0x5c, 0x46, 0x3c, 0x97, 0xef, 0x5e, 0xba, 0x6f, 0x8f, 0xe2, 0x3b,
-  0xdf, 0xc9, 0x26, 0xbc, 0xa2, 0xf8, 0xa1, 0x3a, 0x6c, 0xe6, 0x28, 0x3d,
-  0x07, 0xfd, 0xa8, 0x3d, 0x0b, 0xa0, 0x29, 0x3d, 0xa4, 0x82, 0x6b, 0x3d,
-  0x1b, 0x7b, 0x8b, 0x3d, 0x5f, 0xc5, 0x72, 0x3d, 0xa7, 0x50, 0xe2, 0xbc,
-  0x44, 0x89, 0x20, 0x3e, 0xb7, 0xa4, 0x0d, 0x3d, 0xa9, 0xf8, 0x91, 0x3d,
-  0x9e, 0x84, 0xb0, 0x3d, 0x93, 0xb8, 0x17, 0x3d, 0x5c, 0xeb, 0x81, 0x3d,
-  0xd5, 0x9a, 0x20, 0x3e, 0xd9, 0xcd, 0x07, 0xbd, 0x7d, 0xbe, 0x4a, 0x3d,
-  0x87, 0xf3, 0x48, 0x3d, 0x45, 0xb4, 0x2b, 0xbd, 0x67, 0x0e, 0xa1, 0x3a,
-  0x25, 0x7f, 0xda, 0x3c, 0x63, 0xdb, 0x12, 0x3d, 0x77, 0x87, 0xc6, 0x3d,
-  0xf5, 0x37, 0x94, 0xbb, 0x0f, 0x2d, 0x01, 0xbd, 0x57, 0x54, 0x34, 0x3d,
-  0xa5, 0x6b, 0x35, 0xbd, 0xa4, 0x2f, 0x80, 0x3d, 0x1c, 0xce, 0x75, 0x3c,
-  0x36, 0x9d, 0x96, 0xbd, 0xf1, 0xcc, 0x5e, 0xbd, 0xe5, 0x98, 0xc2, 0x3d,
-  0xd3, 0x8e, 0x77, 0x3d, 0x7a, 0xba, 0x15, 0xbd, 0xe2, 0x7d, 0x08, 0xbd,
-  0x1f, 0xa7, 0xa8, 0xbb, 0xfe, 0xe6, 0x6b, 0xbc, 0x40, 0xed, 0xd8, 0x3c,
-  0xf0, 0x67, 0x3a, 0x3d, 0xbc, 0x2c, 0x0b, 0x3e, 0xd3, 0x8b, 0xf0, 0x3d,
-  0x88, 0x91, 0xdb, 0x3d, 0xe4, 0xe8, 0x14, 0x3e, 0x5a, 0x55, 0x60, 0x3d,
-  0x82, 0x3e, 0xe3, 0x3c, 0xa1, 0xba, 0x3a, 0x3e, 0x0b, 0xbd, 0x15, 0x3e,
-  0xda, 0x2a, 0x12, 0x3e, 0xfa, 0x07, 0x1e, 0x3e, 0x54, 0x29, 0x25, 0x3e,
-  0x17, 0x78, 0x36, 0x3e, 0xcc, 0x55, 0x4c, 0x3d, 0x58, 0x25, 0x11, 0x3d,
-  0x1f, 0xa8, 0x39, 0x3e, 0x13, 0x1b, 0x26, 0x3e, 0x47, 0x24, 0x0e, 0x3e,
-  0x45, 0xd0, 0xa2, 0x3d, 0x98, 0x54, 0x47, 0x3e, 0x02, 0x62, 0xe4, 0x3d,
-  0x04, 0x1f, 0xb1, 0x3d, 0xf5, 0xa5, 0xd9, 0x3c, 0x92, 0x34, 0xbe, 0x3d,
-  0x46, 0xd2, 0x31, 0x3e, 0xbc, 0x80, 0xc9, 0x3c, 0x02, 0x0e, 0x85, 0x3d,
-  0xe5, 0x36, 0x1e, 0x3e, 0x75, 0x2e, 0x00, 0x3e, 0x5d, 0xd6, 0x2f, 0x3e,
-  0x35, 0xb1, 0x2b, 0x3c, 0x62, 0xa6, 0x45, 0x3e, 0x6e, 0xf8, 0x89, 0x3d,
-  0x41, 0x05, 0xb2, 0x3d, 0x55, 0x82, 0x23, 0x3c, 0x4c, 0x98, 0x08, 0x3e,
-  0x23, 0xaa, 0x16, 0x3e, 0x98, 0x81, 0xe7, 0x3d, 0xed, 0x3b, 0x67, 0x3d,
-  0xfd, 0xd3, 0x51, 0x3e, 0x38, 0x83, 0x07, 0x3e, 0xe4, 0x5e, 0x19, 0x3d,
-  0xc2, 0x83, 0x44, 0xbd, 0x60, 0x9a, 0xc3, 0x3d, 0x73, 0xda, 0x00, 0x3e,
-  0x45, 0x54, 0x20, 0x3e, 0xeb, 0xe7, 0xca, 0x3d, 0x1b, 0xc3, 0x95, 0x3d,
-  0x49, 0xad, 0x83, 0x3d, 0xaa, 0x91, 0x97, 0x3c, 0x73, 0x5f, 0x99, 0x3c,
-  0x4b, 0xe5, 0xf7, 0x3c, 0x01, 0x1f, 0xaf, 0x3d, 0xe7, 0xcf, 0x51, 0x3e,
-  0x92, 0x9b, 0xfe, 0x3d, 0x14, 0x26, 0x1b, 0x3e, 0xce, 0x08, 0x30, 0x3e,
-  0xfd, 0x8a, 0xc0, 0x3d, 0xf5, 0x78, 0xd1, 0x3d, 0xde, 0x3e, 0xf0, 0x3d,
-  0xa2, 0xf0, 0x1c, 0x3e, 0x30, 0x5a, 0xdc, 0x3d, 0xee, 0x33, 0x59, 0x3d,
-  0x84, 0xf7, 0x01, 0x3e, 0x04, 0x1f, 0x0d, 0x3e, 0x81, 0xb9, 0x2c, 0x3d,
-  0x35, 0x7c, 0x7a, 0x3e, 0x21, 0xdd, 0x1a, 0x3e, 0xe5, 0x9a, 0x2b, 0x3e,
-  0x4d, 0x69, 0xf4, 0x3d, 0x6b, 0x6c, 0xfd, 0x3c, 0x57, 0xe6, 0x19, 0x3e,
-  0x36, 0x36, 0x41, 0x3e, 0x5d, 0x16, 0x55, 0x3d, 0x12, 0x43, 0x3d, 0x3d,
-  0x9d, 0xbb, 0x03, 0x3e, 0xa4, 0xd0, 0x97, 0x3d, 0xce, 0xd3, 0x36, 0x3e,
-  0x7c, 0x71, 0xc0, 0x3d, 0x2a, 0x81, 0x09, 0x3e, 0x78, 0x04, 0x1a, 0x3d,
-  0x6f, 0x78, 0xe3, 0x3c, 0x29, 0x96, 0x8e, 0xbd, 0x76, 0x91, 0xcd, 0xbc,
-  0xc7, 0x0e, 0xc5, 0xbb, 0x2f, 0xc1, 0x43, 0xbd, 0x04, 0x7a, 0xce, 0xbb,
-  0xa2, 0xfa, 0x3c, 0xbc, 0x5f, 0x93, 0xc3, 0x3b, 0x45, 0xed, 0x43, 0x3d,
-  0x9b, 0x9f, 0xd1, 0xbd, 0xd4, 0xbb, 0x6d, 0x3c, 0xed, 0x13, 0xbf, 0xbc,
-  0xb7, 0xee, 0x2a, 0x3d, 0x02, 0x40, 0x66, 0x3d, 0x04, 0x03, 0x8c, 0xbd,
-  0xe2, 0xdf, 0x13, 0x3d, 0x1f, 0x93, 0x4e, 0x3d, 0x51, 0xbb, 0x01, 0x3a,
-  0x9f, 0x5f, 0xa6, 0x3c, 0xdb, 0xa8, 0x22, 0x3a, 0xa5, 0xcf, 0x15, 0x3d,
-  0x1a, 0x50, 0x95, 0x3d, 0x90, 0xdb, 0x5a, 0x3d, 0x21, 0x0b, 0x85, 0x3d,
-  0xcd, 0xb3, 0x86, 0xbd, 0x94, 0xcd, 0x58, 0xbd, 0x13, 0x76, 0xbc, 0x3d,
-  0x85, 0x3c, 0xbe, 0x3d, 0xb2, 0xcf, 0x72, 0x3d, 0x4c, 0xaf, 0x47, 0xbd,
-  0x0d, 0x1b, 0xdc, 0x3b, 0x99, 0xaf, 0x58, 0x3d, 0xc2, 0x9a, 0x71, 0xbd,
-  0xe0, 0x30, 0x53, 0x3d, 0x26, 0x78, 0xa4, 0x3d, 0xdc, 0x3d, 0x49, 0x3d,
-  0xeb, 0xa6, 0x22, 0xbd, 0x83, 0xf9, 0xce, 0xbc, 0xc9, 0xd9, 0x60, 0x3d,
-  0xf3, 0x01, 0xc0, 0x3d, 0xb4, 0xac, 0xa8, 0xbd, 0xd6, 0xc9, 0xbc, 0xbd,
-  0xc4, 0xd7, 0xcd, 0x3c, 0xfa, 0x60, 0xc6, 0x3d, 0x37, 0x86, 0x13, 0xbd,
-  0xfd, 0x80, 0xad, 0xbd, 0x0b, 0x98, 0xdc, 0x3d, 0x01, 0x37, 0x84, 0x3d,
-  0x7e, 0x1c, 0x0a, 0xbe, 0x62, 0xac, 0x02, 0xbe, 0x89, 0xc2, 0xbf, 0x3d,
-  0xb5, 0x7e, 0x6f, 0xbc, 0x3c, 0x34, 0x6d, 0x3d, 0xc0, 0x6f, 0xda, 0xbd,
-  0xe6, 0xe3, 0xa1, 0xbb, 0xc3, 0x7e, 0x0e, 0x3b, 0xc5, 0x5c, 0xcf, 0xbd,
-  0x2d, 0x3b, 0xd5, 0xbd, 0xa7, 0x99, 0x4f, 0x3d, 0x56, 0xec, 0xaa, 0x3d,
-  0xbe, 0xe6, 0x74, 0x3d, 0x8c, 0xbc, 0xe3, 0xbd, 0x8c, 0xdd, 0xb4, 0xbc,
-  0x87, 0x78, 0x27, 0xbd, 0xd3, 0x1b, 0x34, 0x3b, 0x53, 0x51, 0x41, 0xba,
-  0xcc, 0xff, 0xb8, 0xbb, 0x6d, 0xea, 0xc1, 0xbc, 0x9e, 0x2e, 0x89, 0x3d,
-  0x87, 0x62, 0x09, 0xbd, 0x76, 0x21, 0x82, 0x3c, 0x02, 0x31, 0xad, 0x3c,
-  0x8b, 0x3a, 0xa9, 0x3d, 0x13, 0x01, 0x2c, 0x3d, 0x16, 0x2a, 0xa5, 0x3d,
-  0x7d, 0xd1, 0xa8, 0x3d, 0x50, 0xf9, 0xa9, 0x3d, 0x02, 0x57, 0xf4, 0xbd,
-  0x2b, 0x85, 0x59, 0xbb, 0xd1, 0xb0, 0x2b, 0x3b, 0x16, 0x51, 0x47, 0x3d,
-  0x0b, 0x99, 0xaf, 0x3d, 0x2c, 0x41, 0x99, 0x3d, 0x26, 0xdb, 0x27, 0x3e,
-  0xb2, 0x55, 0xf7, 0x3d, 0x11, 0x3d, 0x52, 0xbc, 0x9b, 0xe4, 0xb5, 0x3d,
-  0x94, 0x9e, 0x9c, 0x3d, 0xc2, 0xdf, 0x80, 0x3d, 0x9a, 0x6b, 0xc5, 0x3d,
-  0x8d, 0x46, 0x02, 0x3e, 0xed, 0x96, 0xae, 0x3d, 0x19, 0x79, 0xdc, 0x3d,
-  0xb0, 0x12, 0x0d, 0x3d, 0x44, 0x04, 0xfc, 0x3d, 0xf6, 0xe8, 0x1d, 0x3e,
-  0x37, 0xce, 0x66, 0xba, 0xbc, 0x54, 0x01, 0x3e, 0x2b, 0xbe, 0x19, 0x3e,
-  0xce, 0xad, 0x15, 0x3e, 0xa8, 0xe7, 0x00, 0x3e, 0x1a, 0x2d, 0x7c, 0xbc,
-  0x46, 0x03, 0x0f, 0x3e, 0xf3, 0x0b, 0xc5, 0x3d, 0x07, 0x0e, 0x6a, 0x3d,
-  0x2b, 0x30, 0xcd, 0xbb, 0x31, 0xdc, 0x88, 0x3d, 0x8c, 0xb1, 0x64, 0xbb,
-  0x2e, 0xfe, 0x7f, 0x3d, 0x2e, 0xf1, 0x0a, 0xbd, 0xc3, 0x44, 0xbe, 0x3c,
-  0x0d, 0x51, 0xf5, 0xbc, 0xb5, 0x06, 0x69, 0x3d, 0x87, 0x9a, 0xd0, 0xbc,
-  0x6e, 0xea, 0xf6, 0xbd, 0x96, 0x45, 0x5d, 0xbd, 0x7f, 0x26, 0xd5, 0xbb,
-  0xe6, 0x09, 0x7d, 0x3d, 0x94, 0x42, 0xce, 0xbd, 0x5a, 0x19, 0xaa, 0xbc,
-  0xf1, 0x69, 0xce, 0x3c, 0x78, 0x81, 0xe6, 0x3c, 0x88, 0x5f, 0x10, 0xbd,
-  0xb3, 0xba, 0xb1, 0x3c, 0x23, 0x57, 0xad, 0xbd, 0xeb, 0x4e, 0x2b, 0x3d,
-  0xc0, 0x90, 0x0a, 0xbc, 0x08, 0x73, 0xbb, 0x3b, 0x7f, 0x65, 0xcf, 0xbd,
-  0xf3, 0x84, 0xe4, 0xbd, 0x88, 0x39, 0xc9, 0xbc, 0xf8, 0xe1, 0xf3, 0xbb,
-  0x8b, 0x62, 0x50, 0xbd, 0x60, 0x27, 0x7f, 0xbd, 0xd3, 0x5c, 0x11, 0x3d,
-  0x82, 0x1f, 0x20, 0x3d, 0xba, 0xac, 0x05, 0xbe, 0xcf, 0xa4, 0xd4, 0xbc,
-  0x01, 0xb0, 0x1b, 0xbd, 0x75, 0x2c, 0x49, 0x3d, 0x09, 0x59, 0x26, 0xbd,
-  0x24, 0xc2, 0x59, 0xbe, 0x61, 0x5c, 0xde, 0x3c, 0x13, 0xb3, 0x7d, 0xbd,
-  0xbd, 0x3e, 0x35, 0xbe, 0x45, 0x6e, 0x54, 0xbd, 0xc4, 0x6e, 0x81, 0xbd,
-  0x7b, 0xe0, 0xe3, 0xbc, 0x10, 0xf8, 0xd2, 0xbd, 0xa4, 0x69, 0x96, 0xbe,
-  0xba, 0xa8, 0x21, 0xbd, 0x74, 0x27, 0x3a, 0xbd, 0x0d, 0xa2, 0x2f, 0xbe,
-  0xff, 0x05, 0x0c, 0xbe, 0x85, 0x79, 0xd2, 0xbc, 0xf8, 0x0e, 0x90, 0xbc,
-  0x31, 0x1d, 0x0c, 0xbe, 0x7f, 0xd3, 0x88, 0xbe, 0x0d, 0xfb, 0xff, 0xbc,
-  0x5c, 0x98, 0x02, 0xbd, 0x83, 0x4a, 0xa0, 0xbc, 0x97, 0x5b, 0x27, 0xbe,
-  0x1f, 0x77, 0xb6, 0xbc, 0x52, 0x4c, 0x25, 0xbd, 0xf6, 0x52, 0x05, 0x3d,
-  0xcc, 0xcd, 0x45, 0xbe, 0x69, 0x97, 0x58, 0xbd, 0x1a, 0xe9, 0x60, 0x3c,
-  0x12, 0x96, 0xcb, 0xbc, 0x87, 0x11, 0x0f, 0xbe, 0xc0, 0x6f, 0x2c, 0x3c,
-  0xd3, 0xcb, 0x2f, 0xbd, 0x04, 0xba, 0x1e, 0x3d, 0xed, 0x26, 0x9a, 0xbd,
-  0xa8, 0x56, 0x0b, 0xbc, 0x3b, 0x57, 0x59, 0xbd, 0x5d, 0x29, 0xf0, 0xbc,
-  0xf2, 0x8a, 0x16, 0xbe, 0xc5, 0xfc, 0x3b, 0x3c, 0xc7, 0x48, 0x0d, 0xbd,
-  0x47, 0xf5, 0x86, 0x3d, 0x86, 0x02, 0xcd, 0xbc, 0x14, 0x9c, 0x5a, 0x3c,
-  0x18, 0xc2, 0x60, 0xbc, 0x52, 0x71, 0x83, 0xbc, 0x4e, 0xce, 0xac, 0xbd,
-  0x42, 0x64, 0x98, 0x3b, 0xb1, 0xcc, 0x14, 0x3d, 0xb0, 0xd4, 0xfa, 0x3d,
-  0x2c, 0xf3, 0xa1, 0x3d, 0x85, 0x7b, 0x80, 0x3c, 0xff, 0x4d, 0x24, 0x3d,
-  0x03, 0xc2, 0xe3, 0xbd, 0x2f, 0x04, 0x90, 0x3c, 0x8f, 0xd8, 0xd7, 0x3d,
-  0x90, 0xec, 0x70, 0x3d, 0x4d, 0xae, 0x36, 0x3d, 0x9d, 0x46, 0x9a, 0x3c,
-  0x02, 0x9f, 0xa5, 0x3d, 0xf9, 0x5f, 0xb0, 0x39, 0x58, 0x8e, 0xbf, 0xbd,
-  0x06, 0xe0, 0xe0, 0x3d, 0xdb, 0x21, 0xdd, 0x3c, 0xc9, 0x41, 0x84, 0x3d,
-  0x54, 0x37, 0xb4, 0x3c, 0x52, 0x8f, 0xbc, 0x3c, 0x39, 0x7b, 0xb9, 0xbc,
-  0x72, 0xbc, 0x01, 0x3d, 0x85, 0xd3, 0xe3, 0x3d, 0x5e, 0x72, 0x45, 0x3d,
-  0xe0, 0x54, 0xa2, 0x3d, 0xfe, 0x31, 0x6d, 0xbc, 0x5c, 0x95, 0x85, 0xb9,
-  0xe3, 0x9e, 0x3b, 0x3b, 0xad, 0xa0, 0x17, 0xbd, 0xd9, 0x80, 0x35, 0x3c,
-  0x48, 0xc4, 0x05, 0x3d, 0x08, 0x68, 0x18, 0xbe, 0x4a, 0x57, 0xbc, 0xbc,
-  0x2d, 0x7e, 0x07, 0xbe, 0x11, 0x9b, 0x8a, 0xbd, 0x5e, 0xd0, 0xa9, 0x3d,
-  0x2c, 0x94, 0x29, 0xbd, 0x9d, 0xca, 0x00, 0xbe, 0x9e, 0x81, 0xd2, 0xbd,
-  0x22, 0x2f, 0x8f, 0xbd, 0x80, 0x9b, 0xc8, 0xbd, 0x54, 0x8d, 0xb4, 0xbc,
-  0x3f, 0x5e, 0x2c, 0xbe, 0xff, 0x85, 0x92, 0xbd, 0xca, 0xbe, 0x3a, 0xbd,
-  0xc3, 0x7d, 0xeb, 0x3c, 0xfb, 0xf0, 0x50, 0xbe, 0xa1, 0xae, 0x01, 0xbd,
-  0x7f, 0xab, 0xd6, 0x3c, 0x4d, 0xd8, 0x62, 0xbd, 0x28, 0x21, 0x18, 0xbe,
-  0x86, 0xfc, 0xb6, 0xbd, 0xaa, 0x79, 0x2e, 0xbd, 0x67, 0x76, 0xa4, 0x3c,
-  0xe6, 0x38, 0x34, 0xbd, 0xa0, 0xc5, 0xaf, 0xbd, 0x27, 0x07, 0x85, 0x3c,
-  0x7f, 0x41, 0x34, 0xbc, 0x11, 0xb7, 0x63, 0xbc, 0x4f, 0x4d, 0x8b, 0xbe,
-  0x95, 0xa9, 0x80, 0xbd, 0x73, 0x14, 0x2e, 0x3d, 0x2e, 0x4e, 0x7a, 0xbd,
-  0x59, 0x24, 0x22, 0xbe, 0xd9, 0x42, 0x73, 0xbc, 0xe9, 0x22, 0x79, 0x3d,
-  0x11, 0x49, 0xd4, 0xbc, 0x0a, 0x3e, 0x77, 0xbe, 0xf1, 0xb0, 0xe2, 0x3c,
-  0x6b, 0x87, 0xb3, 0xbd, 0x32, 0x83, 0x13, 0xbe, 0xfd, 0x56, 0x3e, 0xbe,
-  0x8b, 0x98, 0x1b, 0xbe, 0xcd, 0x73, 0x90, 0xbd, 0xfa, 0xc4, 0xb3, 0xbc,
-  0x48, 0xa7, 0x8a, 0xbe, 0x17, 0xcf, 0xb9, 0xbc, 0x78, 0x7d, 0x59, 0xbd,
-  0x4c, 0xf9, 0x47, 0xbc, 0x6f, 0x20, 0x52, 0xbe, 0x76, 0xac, 0xec, 0xbc,
-  0x4b, 0xe5, 0x02, 0xbd, 0xc3, 0xd2, 0xce, 0xbc, 0xf6, 0x90, 0x11, 0xbe,
-  0x4f, 0x7a, 0xa8, 0x3c, 0xef, 0x7e, 0x8d, 0xbd, 0x9e, 0xcf, 0x9d, 0xbc,
-  0x2a, 0x28, 0x86, 0xbe, 0x4c, 0x5e, 0x0c, 0xbe, 0xc8, 0xed, 0x41, 0xbd,
-  0xac, 0x48, 0x29, 0x3d, 0xe1, 0xdb, 0x99, 0xbd, 0x14, 0x84, 0x55, 0xbd,
-  0xb0, 0x41, 0xd5, 0xbd, 0x94, 0xee, 0x0e, 0xbb, 0xc6, 0xed, 0x65, 0xbe,
-  0xbb, 0xca, 0xaa, 0xbd, 0xd6, 0xa7, 0x24, 0xbe, 0x76, 0x8d, 0x95, 0xbc,
-  0x52, 0xaa, 0xfa, 0x3d, 0x71, 0xc8, 0x10, 0xbe, 0xe6, 0xd1, 0x39, 0xbe,
-  0xcf, 0x24, 0x18, 0x3e, 0xcf, 0xba, 0xcd, 0xbd, 0xbc, 0x42, 0x00, 0xbe,
-  0x3b, 0x15, 0x00, 0xbe, 0x8f, 0x09, 0x87, 0x3d, 0xaf, 0xbc, 0x81, 0x3e,
-  0x8b, 0xf4, 0x30, 0xbc, 0x76, 0x73, 0xfa, 0xbd, 0xb5, 0xe5, 0x95, 0x3d,
-  0xeb, 0x8d, 0x0e, 0xbc, 0xbf, 0x24, 0x8f, 0xbd, 0xea, 0xcc, 0x23, 0xbd,
-  0xe8, 0x52, 0x92, 0x3c, 0x0f, 0x36, 0x92, 0x3e, 0x70, 0xaa, 0x94, 0xbc,
-  0x0c, 0x30, 0xbf, 0xbd, 0x07, 0x0c, 0xb1, 0xbd, 0xac, 0x44, 0xa1, 0xbd,
-  0xf4, 0x25, 0x9a, 0xbd, 0xab, 0x90, 0x5c, 0xbc, 0x71, 0xb5, 0xaf, 0x3d,
-  0x89, 0x80, 0x85, 0x3e, 0xcc, 0x97, 0x3b, 0xbd, 0x14, 0xc6, 0xf4, 0xbd,
-  0x9c, 0xb4, 0x12, 0xbe, 0x75, 0xf1, 0xc8, 0xbd, 0x3f, 0xa8, 0x16, 0xbd,
-  0xa6, 0x0e, 0x27, 0xbe, 0x15, 0x1b, 0x94, 0xbd, 0x9e, 0xc5, 0x9a, 0x3d,
-  0x91, 0xc8, 0x05, 0xbe, 0xf8, 0x4d, 0xf9, 0xbd, 0xb6, 0x6d, 0x82, 0xbd,
-  0x7d, 0x7f, 0x06, 0xbe, 0xd8, 0xa4, 0x19, 0xbe, 0x94, 0x20, 0xb9, 0xbd,
-  0x9b, 0x08, 0xe6, 0xbd, 0xd9, 0x8f, 0xe5, 0xbc, 0x4a, 0x44, 0xab, 0xbd,
-  0x97, 0x8a, 0xb0, 0xbd, 0x08, 0x0d, 0x33, 0xbe, 0x11, 0x80, 0xcf, 0xbd,
-  0xca, 0xe5, 0xfc, 0xbd, 0x4f, 0x4b, 0x05, 0xbe, 0xb2, 0xaa, 0x0e, 0xbe,
-  0xc0, 0x4b, 0xc0, 0xbd, 0x26, 0x21, 0xf6, 0xbd, 0x36, 0x31, 0xf4, 0xbd,
-  0xe0, 0x89, 0x64, 0xbd, 0x01, 0xd7, 0x04, 0x3d, 0x1c, 0x93, 0x6c, 0xbd,
-  0xba, 0x7c, 0x20, 0x3d, 0xec, 0x01, 0x06, 0xbe, 0x6a, 0x02, 0xe7, 0xbd,
-  0x14, 0xf2, 0x54, 0xbc, 0xfb, 0x33, 0x29, 0x3d, 0xb4, 0x7e, 0x73, 0xbd,
-  0x7b, 0x32, 0x28, 0xbd, 0x0e, 0xb1, 0x83, 0xbd, 0x5e, 0x6b, 0x8d, 0x3d,
-  0x38, 0x32, 0xf7, 0xbc, 0x44, 0x85, 0x72, 0xbe, 0x0a, 0x07, 0x1e, 0x3d,
-  0x57, 0x2c, 0x28, 0x3d, 0xc3, 0x77, 0x87, 0xbd, 0x89, 0x6c, 0x04, 0x3c,
-  0x0d, 0xb2, 0x23, 0xbd, 0x14, 0xa6, 0x9d, 0xbc, 0xe9, 0xf8, 0x6f, 0xbc,
-  0xea, 0x60, 0xc4, 0xbe, 0x31, 0xe2, 0x03, 0xbd, 0xfa, 0x17, 0xed, 0xbc,
-  0xc8, 0xf6, 0x03, 0x3c, 0x72, 0x14, 0x18, 0xbd, 0x2b, 0xfe, 0x98, 0xbd,
-  0x13, 0xc6, 0x67, 0xbd, 0x34, 0xa3, 0x18, 0xbe, 0x58, 0x39, 0x95, 0xbe,
-  0x95, 0xb0, 0xa4, 0xbc, 0x4b, 0x0e, 0xbd, 0x3b, 0x1c, 0xbb, 0x39, 0x3e,
-  0xd0, 0xa9, 0x48, 0xbe, 0xfa, 0x6a, 0x14, 0xbd, 0xcd, 0xc8, 0xba, 0x3d,
-  0x28, 0x85, 0x05, 0xbc, 0x03, 0x30, 0xa3, 0xbe, 0x96, 0x0d, 0x9a, 0x3c,
-  0x53, 0xbe, 0xf5, 0xbd, 0x8d, 0xa9, 0x81, 0x3e, 0x96, 0x14, 0x92, 0xbe,
-  0xa1, 0xd9, 0x28, 0xbe, 0xb6, 0xa3, 0x2d, 0xbe, 0x87, 0x8e, 0x16, 0xbb,
-  0x54, 0xf4, 0x09, 0x3d, 0x37, 0x03, 0x41, 0xbe, 0x5b, 0x2e, 0x56, 0xbe,
-  0x05, 0xc4, 0x98, 0x3e, 0x1e, 0x76, 0x42, 0xbe, 0xa7, 0xe8, 0x5a, 0xbe,
-  0xf1, 0x0a, 0x63, 0xbe, 0x53, 0x51, 0x84, 0xbc, 0x8f, 0x63, 0x8b, 0x3e,
-  0xfc, 0xb5, 0x6c, 0xbe, 0xfb, 0x46, 0x84, 0xbe, 0x51, 0x93, 0x7a, 0x3e,
-  0x83, 0x00, 0x36, 0xbe, 0x13, 0xcc, 0x53, 0xbe, 0x9e, 0x24, 0x38, 0xbe,
-  0xb7, 0xc6, 0xbe, 0xbc, 0x5e, 0xe3, 0xb7, 0x3e, 0x56, 0xe4, 0x24, 0xbe,
-  0xee, 0x57, 0x21, 0xbe, 0x3b, 0x79, 0x92, 0x3e, 0xfe, 0x57, 0xdc, 0xbc,
-  0x1c, 0x29, 0x9d, 0xbd, 0xe6, 0xb9, 0xdb, 0xbd, 0x35, 0xf6, 0x2b, 0xbd,
-  0x52, 0x81, 0x59, 0x3e, 0xb8, 0xcb, 0x0b, 0xbe, 0x73, 0xb0, 0x3f, 0xbd,
-  0x79, 0xe7, 0x11, 0x3e, 0x55, 0xf1, 0x00, 0xbd, 0x00, 0x8d, 0x8e, 0xbd,
-  0xc9, 0x72, 0x1b, 0xbe, 0xe4, 0x7e, 0x64, 0xbe, 0x89, 0x0c, 0xac, 0xbb,
-  0x80, 0xfd, 0x71, 0xbe, 0x21, 0x6f, 0xb8, 0xbd, 0x4d, 0x12, 0xa4, 0xbd,
-  0x5b, 0x13, 0x72, 0xbe, 0x64, 0x51, 0x2e, 0xbe, 0x6f, 0x3d, 0x6f, 0xbe,
-  0x7f, 0xff, 0x8b, 0xbe, 0x34, 0xb5, 0x34, 0x3d, 0xbc, 0xa5, 0x6b, 0xbe,
-  0xb2, 0xb2, 0x8e, 0xbe, 0x72, 0xbd, 0xd2, 0xbc, 0xc3, 0xb9, 0x33, 0xbe,
-  0xf1, 0xa9, 0x59, 0xbe, 0x96, 0x5a, 0x5b, 0xbe, 0x0c, 0xe9, 0x03, 0xbe,
-  0xfb, 0x26, 0x90, 0x3d, 0x31, 0x0b, 0x22, 0xbe, 0x02, 0xcc, 0x61, 0xbe,
-  0xb5, 0x61, 0x7d, 0xbd, 0x06, 0xc5, 0x96, 0xbd, 0xd7, 0x38, 0x5d, 0xbd,
-  0x4b, 0xca, 0xf9, 0xbd, 0x29, 0x19, 0x84, 0xbe, 0x74, 0x4f, 0x36, 0xbd,
-  0x4a, 0x10, 0xc3, 0xbd, 0x64, 0xf8, 0xa3, 0xbd, 0x50, 0x6b, 0x67, 0x3c,
-  0x4a, 0x95, 0x19, 0xbc, 0xee, 0xe0, 0x88, 0xbc, 0xbb, 0xa8, 0x96, 0x3d,
-  0xfb, 0xb5, 0xa5, 0xbd, 0xb7, 0x55, 0x89, 0xbe, 0xa9, 0x66, 0x0d, 0x3d,
-  0x64, 0x88, 0x9e, 0x3c, 0x49, 0x12, 0x1d, 0xbe, 0x42, 0xc3, 0xf6, 0x3b,
-  0x66, 0x8b, 0x16, 0x39, 0x1f, 0x00, 0x02, 0x3e, 0x33, 0xa1, 0x14, 0xbd,
-  0xf5, 0xe6, 0x92, 0xbe, 0xb3, 0x07, 0x7b, 0x3d, 0xcd, 0x90, 0xae, 0xba,
-  0xf5, 0x78, 0x21, 0xbe, 0x87, 0x57, 0x23, 0x3c, 0x9b, 0xf4, 0x45, 0xbd,
-  0xa3, 0x13, 0xad, 0x3d, 0xaf, 0x58, 0xd4, 0xbd, 0x6d, 0x3d, 0x1b, 0xbf,
-  0xc2, 0x9e, 0x7f, 0x3d, 0x05, 0xf9, 0x6e, 0xbc, 0x61, 0xfc, 0x7d, 0xbd,
-  0x77, 0xb3, 0x9b, 0xbd, 0xc2, 0x38, 0x88, 0x3d, 0x39, 0x1b, 0x96, 0x3d,
-  0x41, 0xfc, 0xac, 0xbd, 0x2d, 0x81, 0x1d, 0xbf, 0x57, 0x1d, 0xd0, 0x3c,
-  0x45, 0x0e, 0xab, 0xbc, 0xfc, 0x1f, 0x95, 0x3d, 0x25, 0x8b, 0xd1, 0xbd,
-  0xff, 0x70, 0xe6, 0xbd, 0x84, 0x09, 0x7d, 0xbd, 0xcc, 0xd9, 0xe6, 0xbc,
-  0xb4, 0x78, 0x96, 0xbe, 0xcd, 0xe9, 0x29, 0xbc, 0x91, 0x3e, 0x12, 0xbe,
-  0xef, 0x15, 0x8c, 0x3e, 0xf2, 0xa6, 0x99, 0xbd, 0xbf, 0xec, 0x57, 0xbe,
-  0x53, 0x71, 0x27, 0xbe, 0x49, 0x41, 0x5e, 0xbd, 0xc2, 0xf9, 0x46, 0x3d,
-  0x79, 0xc2, 0x40, 0xbe, 0x62, 0xad, 0x44, 0xbe, 0x17, 0x24, 0x7d, 0x3e,
-  0x7d, 0x69, 0x98, 0xbd, 0xab, 0x71, 0x68, 0xbe, 0xa9, 0x4f, 0x39, 0xbe,
-  0xd9, 0x03, 0x8b, 0xbd, 0x7c, 0x50, 0x77, 0x3e, 0xab, 0x97, 0xea, 0xbd,
-  0xad, 0x07, 0x3e, 0xbe, 0x1b, 0x7e, 0x37, 0x3e, 0xab, 0xad, 0x9d, 0xbd,
-  0xb3, 0x3c, 0x35, 0xbe, 0x1d, 0xfc, 0x1f, 0xbe, 0xa0, 0xe4, 0xc3, 0xbd,
-  0x1e, 0xc7, 0x73, 0x3e, 0x29, 0x90, 0x15, 0xbe, 0x32, 0xe0, 0xa4, 0xbd,
-  0xf9, 0x42, 0x3c, 0x3e, 0xdf, 0xb1, 0x83, 0x3d, 0x47, 0x5a, 0xcd, 0xbd,
-  0xb4, 0xb5, 0x15, 0xbb, 0x65, 0xd5, 0xed, 0xbd, 0x60, 0x7a, 0xbe, 0x3d,
-  0xa9, 0xbb, 0x74, 0xbc, 0x7c, 0x85, 0x2b, 0x3c, 0x69, 0xd0, 0x82, 0x3d,
-  0xca, 0x18, 0x79, 0x3d, 0x00, 0x2a, 0x67, 0x3d, 0x80, 0x28, 0x4a, 0x3d,
-  0x28, 0x54, 0xfe, 0xbd, 0x3e, 0xdc, 0x50, 0xbe, 0x30, 0x4e, 0x64, 0xbc,
-  0x34, 0xb6, 0x15, 0x3e, 0x2c, 0xaf, 0xa0, 0xbd, 0xfe, 0x92, 0xe5, 0xbd,
-  0x7c, 0xcd, 0x8a, 0xbc, 0xe8, 0x8d, 0x09, 0xbd, 0xa0, 0x1f, 0x0c, 0xbe,
-  0x9d, 0x52, 0xca, 0xbc, 0x69, 0x8c, 0x34, 0xbe, 0xb4, 0x38, 0xf7, 0xbd,
-  0x42, 0xc9, 0x0e, 0x3c, 0x22, 0xac, 0x05, 0xbe, 0x51, 0xf2, 0x10, 0xbe,
-  0x86, 0x76, 0x3b, 0xbe, 0x03, 0x90, 0xbe, 0xbd, 0x23, 0x79, 0x9f, 0x3c,
-  0x73, 0x3d, 0xfb, 0xbd, 0xed, 0xe5, 0x11, 0xbe, 0xbc, 0x4c, 0xf0, 0xbd,
-  0x1a, 0xb4, 0x90, 0xbd, 0xf9, 0x14, 0x3b, 0xbd, 0x33, 0x1c, 0xfe, 0xbd,
-  0x6f, 0x02, 0x0e, 0xbe, 0x67, 0xc7, 0xa7, 0xbc, 0x81, 0xf0, 0x19, 0xbe,
-  0x96, 0x7e, 0x6f, 0x3b, 0x3a, 0x5f, 0x58, 0xbe, 0x19, 0x92, 0x7f, 0x3d,
-  0x01, 0x17, 0x53, 0xbd, 0x8a, 0x1d, 0xe9, 0x3d, 0xb4, 0xe4, 0x7d, 0xbc,
-  0xec, 0xdd, 0x95, 0xbe, 0xe5, 0xd2, 0x01, 0x3e, 0xdc, 0x90, 0x9f, 0x3d,
-  0x19, 0x58, 0x4e, 0xbe, 0xf4, 0x14, 0x78, 0x3d, 0x59, 0x4d, 0xf9, 0x3b,
-  0x12, 0x16, 0xb9, 0x3d, 0x6c, 0x7b, 0xd6, 0xbd, 0x3d, 0x96, 0xea, 0xbe,
-  0x12, 0x6a, 0xb5, 0x3d, 0xec, 0x01, 0xaf, 0x3d, 0xa4, 0x66, 0x7d, 0xbe,
-  0x09, 0x68, 0xf5, 0xbb, 0xfc, 0x96, 0x20, 0x3d, 0xe4, 0xfd, 0xab, 0x3d,
-  0x45, 0xc1, 0x1f, 0xbd, 0xb7, 0x1d, 0x23, 0xbf, 0xef, 0xe3, 0x84, 0xba,
-  0x89, 0x94, 0xe0, 0x3d, 0x56, 0xf5, 0x7d, 0xbe, 0x63, 0x71, 0x2d, 0x3c,
-  0x13, 0x62, 0x8a, 0x3d, 0x06, 0xee, 0xda, 0x3d, 0xb6, 0x37, 0x7d, 0xbd,
-  0xd7, 0x78, 0x1f, 0xbf, 0x45, 0x66, 0xdc, 0x3b, 0x54, 0xfe, 0x14, 0x3d,
-  0xf9, 0x02, 0x06, 0x3e, 0x82, 0x10, 0xbc, 0xbd, 0x9f, 0xf2, 0xb8, 0xbc,
-  0xa8, 0x35, 0x85, 0x3c, 0x7e, 0xbb, 0x48, 0x3d, 0xbf, 0xc6, 0x9e, 0xbd,
-  0x24, 0xb1, 0xeb, 0x3a, 0x46, 0x7e, 0x6c, 0xbd, 0xa6, 0x16, 0xab, 0x3e,
-  0xc6, 0x52, 0x98, 0x3c, 0x9e, 0xee, 0xf6, 0xbd, 0x71, 0x39, 0x2c, 0xbd,
-  0x64, 0xb1, 0xf8, 0x3d, 0x7a, 0x5e, 0xde, 0x3d, 0xe6, 0x88, 0x53, 0x3d,
-  0xd9, 0x4b, 0x7f, 0xbd, 0x88, 0x26, 0x45, 0x3e, 0x7e, 0x18, 0xa0, 0x3c,
-  0xdf, 0x59, 0x5a, 0xbd, 0xc3, 0xcd, 0xd8, 0xbd, 0xbc, 0xa1, 0xa5, 0xbd,
-  0x9c, 0x1b, 0xee, 0x3d, 0x6d, 0x9b, 0xce, 0xbd, 0x0a, 0xac, 0xd7, 0xbd,
-  0x8f, 0x56, 0xbf, 0x3d, 0xbe, 0xe2, 0x44, 0x3c, 0x13, 0xe1, 0x0e, 0xbe,
-  0xa9, 0xa9, 0x09, 0xbd, 0xf7, 0x5e, 0x7a, 0xbd, 0x02, 0xf6, 0xcc, 0x3d,
-  0xbd, 0x42, 0xdc, 0xbd, 0xa7, 0x51, 0x6e, 0xbb, 0x94, 0x6a, 0xc8, 0xbd,
-  0x6f, 0x62, 0xcd, 0xba, 0x83, 0x65, 0x6f, 0xbc, 0x69, 0x3c, 0x86, 0x3c,
-  0x06, 0xf7, 0xe9, 0xbc, 0xf4, 0x88, 0x9d, 0x3c, 0xe2, 0x7c, 0xb8, 0x3d,
-  0xa5, 0x3b, 0x80, 0x3d, 0x1f, 0xc1, 0xb8, 0xbd, 0x89, 0x97, 0xff, 0x3d,
-  0x21, 0x86, 0x2e, 0x3d, 0xc6, 0xc8, 0x94, 0x3d, 0xfe, 0x34, 0x44, 0x3d,
-  0xad, 0x33, 0x1b, 0xbe, 0x69, 0xaf, 0xdd, 0x3d, 0x2d, 0x6c, 0x0d, 0x3e,
-  0x9a, 0x0a, 0x8d, 0xbd, 0x40, 0x56, 0xb5, 0x3d, 0x68, 0x10, 0xd2, 0x3d,
-  0xca, 0x9c, 0xc9, 0xbd, 0x5a, 0x22, 0xce, 0xbb, 0x51, 0x85, 0xbd, 0xbd,
-  0xd3, 0xa6, 0xac, 0xba, 0x5e, 0x93, 0x73, 0x3d, 0x43, 0x24, 0x3b, 0x3d,
-  0x0a, 0x9d, 0x2d, 0xbe, 0x2f, 0x92, 0x05, 0xbe, 0xe0, 0xbf, 0xe6, 0xbd,
-  0x6f, 0xff, 0x03, 0xbe, 0x00, 0x7e, 0x04, 0xbd, 0x56, 0xca, 0xeb, 0xbd,
-  0x73, 0xa7, 0x01, 0xbe, 0x55, 0x73, 0x2e, 0xbe, 0xcb, 0xe3, 0x61, 0xbd,
-  0x15, 0x2c, 0xce, 0xbb, 0x78, 0xc9, 0xf8, 0xbd, 0x83, 0x92, 0x10, 0xbe,
-  0x0d, 0x73, 0xc0, 0x3c, 0x91, 0xb9, 0xec, 0xbd, 0xfd, 0xe5, 0xbf, 0xbd,
-  0xf5, 0x17, 0x87, 0xbe, 0xf1, 0x1c, 0xab, 0x3c, 0x65, 0xbf, 0x2e, 0x3d,
-  0x0e, 0x34, 0xb9, 0x3d, 0x1e, 0x20, 0xd9, 0xbc, 0xa1, 0xda, 0x4a, 0xbe,
-  0xc4, 0x48, 0xc2, 0x3d, 0xb0, 0x61, 0x38, 0x3c, 0x35, 0x51, 0x8b, 0xbe,
-  0xe2, 0xbc, 0x73, 0x3d, 0xce, 0x9e, 0x52, 0x3d, 0x1c, 0x93, 0xbf, 0x3d,
-  0x4a, 0xa3, 0xb6, 0xbd, 0x81, 0x15, 0xe9, 0xbe, 0x9d, 0x07, 0x87, 0x3c,
-  0x7c, 0xc8, 0xf7, 0x3d, 0x35, 0x3c, 0xd4, 0xbe, 0xb6, 0x71, 0xd0, 0x3d,
-  0xba, 0xe5, 0xc7, 0x3c, 0x27, 0x30, 0x2c, 0x3e, 0x01, 0x07, 0x6c, 0xbd,
-  0x40, 0xb6, 0x26, 0xbf, 0xc9, 0x31, 0x41, 0x3d, 0x93, 0xca, 0xe8, 0x3d,
-  0x6c, 0x69, 0x55, 0xbe, 0x9e, 0x44, 0x65, 0x3c, 0xcc, 0xc4, 0x62, 0x3d,
-  0x71, 0x49, 0xe9, 0x3d, 0xb4, 0x04, 0x99, 0xbd, 0x03, 0xf6, 0xf5, 0xbe,
-  0xfd, 0xde, 0x00, 0x3e, 0xef, 0x28, 0x47, 0x3c, 0xe8, 0x40, 0x30, 0x3e,
-  0x71, 0x28, 0x11, 0x3d, 0x87, 0x43, 0x95, 0x3c, 0xee, 0x89, 0xc4, 0x3d,
-  0xd3, 0xb2, 0xc2, 0xbc, 0x79, 0x12, 0x0b, 0xbe, 0x63, 0xf5, 0xff, 0x3d,
-  0xee, 0x92, 0x7e, 0x3d, 0xc0, 0x54, 0x31, 0x3e, 0x21, 0xa0, 0x59, 0x3c,
-  0x03, 0x35, 0x9d, 0xbb, 0x90, 0xce, 0xbd, 0x3d, 0xe3, 0x59, 0xf1, 0x3c,
-  0x1e, 0x57, 0x6f, 0x3d, 0xe3, 0x97, 0xd6, 0x3c, 0xa2, 0xfd, 0xa7, 0x3d,
-  0xe1, 0x2a, 0x08, 0x3e, 0xfa, 0x0d, 0x0d, 0xbd, 0xb8, 0xa6, 0xa2, 0xbc,
-  0x72, 0xed, 0x99, 0xb9, 0x06, 0x81, 0x82, 0x3d, 0x7a, 0x37, 0x29, 0xbc,
-  0x17, 0x14, 0x59, 0xbd, 0xae, 0x3b, 0x07, 0xbd, 0x1b, 0xdb, 0xa1, 0x3d,
-  0xd9, 0x3e, 0xca, 0xbc, 0x35, 0xdc, 0xd4, 0xbc, 0x4d, 0x50, 0x90, 0x3d,
-  0x9d, 0xcc, 0xd5, 0xbc, 0x2a, 0x04, 0x11, 0xbd, 0xac, 0xcc, 0x2e, 0x3d,
-  0xd6, 0xd3, 0x56, 0x3c, 0x81, 0x1d, 0xd1, 0xbd, 0x31, 0xe5, 0xc4, 0xba,
-  0x32, 0x79, 0xca, 0x3c, 0x7f, 0xa7, 0xd7, 0x3d, 0x99, 0x3d, 0xf4, 0x3d,
-  0xb9, 0x4f, 0x45, 0x3c, 0x65, 0x06, 0xe5, 0x3d, 0xe2, 0xaa, 0xc8, 0x3d,
-  0x55, 0x87, 0x4b, 0xbe, 0x33, 0x96, 0x1f, 0x3d, 0x73, 0xe0, 0x5c, 0x3d,
-  0x0b, 0xde, 0x08, 0x3d, 0x8d, 0x5c, 0xcc, 0x3d, 0x3a, 0xcf, 0xe1, 0xbd,
-  0x3c, 0xd2, 0xc9, 0x3d, 0x77, 0xe0, 0xc2, 0x3d, 0xf7, 0xd4, 0xd0, 0xbd,
-  0x45, 0x98, 0x1f, 0xbc, 0xa3, 0xca, 0xb3, 0x3b, 0x3d, 0x8c, 0x38, 0x3c,
-  0x8f, 0xa4, 0xe5, 0x3b, 0x91, 0x82, 0xf5, 0xbd, 0x72, 0x98, 0x0f, 0x3d,
-  0x2c, 0x72, 0x6f, 0x3d, 0x80, 0x4f, 0x4b, 0x3b, 0x63, 0x96, 0x2d, 0xbe,
-  0xa5, 0xe1, 0x4c, 0xbe, 0x7c, 0x4c, 0x10, 0xbe, 0x79, 0xa9, 0x32, 0xbe,
-  0xe9, 0x95, 0x55, 0x3d, 0xfd, 0xca, 0x09, 0xbe, 0xe1, 0x05, 0x72, 0xbe,
-  0x8d, 0x1e, 0xed, 0xbd, 0x29, 0x25, 0x8c, 0xbe, 0x66, 0xeb, 0xa5, 0x3c,
-  0x2d, 0xea, 0x25, 0xbe, 0x3f, 0xff, 0x79, 0xbd, 0x43, 0x09, 0x7a, 0x3c,
-  0x33, 0x7f, 0x35, 0xbe, 0x2d, 0x39, 0xb4, 0xbd, 0x40, 0xc1, 0xc6, 0xbe,
-  0x3e, 0x2e, 0xbd, 0xbc, 0x6a, 0xba, 0x90, 0x3d, 0xb4, 0xf2, 0xb5, 0x3c,
-  0x35, 0xc4, 0xa3, 0xbd, 0xe9, 0x0e, 0x03, 0x3c, 0x93, 0xca, 0x86, 0x3d,
-  0x37, 0x03, 0x34, 0xbd, 0x99, 0x73, 0x9b, 0xbe, 0xc5, 0xce, 0xdc, 0x3d,
-  0x31, 0x71, 0x90, 0x3d, 0x52, 0x29, 0x5e, 0x3d, 0xf4, 0x20, 0xe1, 0xbc,
-  0xdc, 0x51, 0x68, 0xbe, 0xb6, 0x28, 0x83, 0x3d, 0xe6, 0x20, 0x2b, 0x3d,
-  0xf5, 0x8c, 0xa6, 0xbe, 0x00, 0x8a, 0xf2, 0x3d, 0x84, 0xd2, 0xe6, 0x3d,
-  0x03, 0xcb, 0x4c, 0x3d, 0x0f, 0xf1, 0x6d, 0x3d, 0x26, 0x88, 0x9b, 0xbe,
-  0x46, 0xb2, 0x75, 0x3d, 0x1b, 0x26, 0xad, 0x3d, 0x90, 0x9d, 0x3b, 0xbe,
-  0x17, 0x83, 0x21, 0x3e, 0x0f, 0xb9, 0x1f, 0x3e, 0x14, 0x79, 0x00, 0x3d,
-  0xad, 0x0d, 0x8c, 0xbc, 0x95, 0xea, 0xe9, 0xbe, 0x6d, 0x83, 0xb6, 0x3d,
-  0x8f, 0xe0, 0xa6, 0x3d, 0x4e, 0xb5, 0x34, 0x3b, 0x0c, 0x59, 0x4b, 0x3d,
-  0x5a, 0x41, 0x0c, 0x3d, 0xa9, 0x49, 0xc1, 0x3d, 0x97, 0x58, 0xdb, 0xbd,
-  0x00, 0x3d, 0x80, 0xbe, 0x0e, 0x94, 0x9d, 0xbb, 0x54, 0xf8, 0x32, 0x3c,
-  0xb5, 0xcc, 0x6c, 0x3d, 0xe7, 0x54, 0xee, 0x3d, 0x9b, 0x94, 0x00, 0x3d,
-  0x41, 0xd6, 0x3e, 0x3d, 0x2b, 0x60, 0x76, 0xbd, 0x3e, 0xb6, 0x19, 0xbd,
-  0xc8, 0x0b, 0x34, 0x3c, 0x9b, 0x08, 0xb6, 0x3d, 0x18, 0x0a, 0xb5, 0x3d,
-  0x1c, 0xa8, 0x68, 0x3d, 0x71, 0x4f, 0xdd, 0xbc, 0xc1, 0x0e, 0xcc, 0x3d,
-  0xb6, 0xa3, 0x8e, 0x3d, 0xa0, 0x23, 0x5a, 0x3d, 0xaa, 0xa4, 0xa1, 0x3d,
-  0x52, 0xd9, 0xc7, 0x3c, 0xf4, 0x73, 0xdf, 0x3d, 0x3d, 0x10, 0x1c, 0x3d,
-  0x63, 0x61, 0xd8, 0x3c, 0x66, 0x07, 0x19, 0xbc, 0x08, 0x79, 0x0b, 0x3e,
-  0xb6, 0x14, 0x82, 0x3c, 0x67, 0x96, 0x88, 0x3a, 0xb9, 0x31, 0x77, 0xbc,
-  0xc6, 0x79, 0x32, 0x3d, 0x13, 0xce, 0x00, 0x3b, 0xe9, 0xbf, 0x55, 0x3d,
-  0xf0, 0xbd, 0x12, 0xbb, 0x95, 0xbe, 0x56, 0xbc, 0x57, 0xa5, 0x85, 0x3c,
-  0xd8, 0xdf, 0x04, 0xbc, 0xe6, 0x68, 0x74, 0xbd, 0x73, 0x48, 0x0f, 0xbe,
-  0xbc, 0x58, 0x8c, 0xbd, 0x5a, 0xb1, 0xd1, 0x3b, 0xaf, 0x0e, 0x36, 0xbc,
-  0x64, 0xf6, 0x7d, 0x3d, 0x94, 0x38, 0x42, 0xbd, 0x8a, 0x55, 0x93, 0x3d,
-  0x82, 0x2b, 0xe5, 0x3c, 0x94, 0x4d, 0x9a, 0xbd, 0xd9, 0xd1, 0x89, 0x3d,
-  0xa7, 0xc1, 0xae, 0xbc, 0x40, 0xa5, 0xc3, 0xbd, 0xf2, 0xe2, 0xe0, 0x3c,
-  0x61, 0xf4, 0x47, 0x3b, 0xb2, 0x1a, 0xe8, 0x3c, 0x26, 0x0a, 0x2f, 0x3d,
-  0x0e, 0xec, 0x7f, 0x3d, 0xa6, 0x9b, 0xd3, 0xbd, 0xc6, 0xc1, 0x1d, 0xbe,
-  0x71, 0xbf, 0x05, 0xbe, 0xdf, 0x78, 0x08, 0xbe, 0x0b, 0x61, 0xa3, 0x3c,
-  0x28, 0x84, 0x31, 0xbe, 0x55, 0x09, 0x66, 0xbe, 0x4e, 0x16, 0x0a, 0xbe,
-  0x4a, 0xaa, 0x77, 0xbe, 0xf4, 0x9d, 0xc9, 0xbd, 0x89, 0x3d, 0x32, 0xbe,
-  0xc7, 0xaf, 0x3b, 0xbe, 0x22, 0x9c, 0x45, 0x3c, 0x00, 0x1f, 0x24, 0xbe,
-  0x34, 0xd1, 0xd9, 0xbd, 0x16, 0x43, 0x93, 0xbe, 0x18, 0x54, 0x7d, 0xbd,
-  0xe0, 0x7f, 0xdd, 0xbb, 0x3e, 0x9a, 0xbe, 0xbb, 0xdf, 0xdd, 0x01, 0xbe,
-  0x2c, 0xf3, 0xaa, 0x3d, 0x09, 0x95, 0x93, 0xbd, 0xb3, 0x17, 0x4b, 0xbc,
-  0x28, 0xfe, 0x7f, 0xbe, 0x96, 0x15, 0x74, 0xbd, 0x28, 0x3b, 0xb6, 0xbc,
-  0x41, 0x43, 0x1e, 0xbd, 0x7a, 0x95, 0x39, 0xbd, 0xdf, 0x5a, 0x5b, 0xbc,
-  0xdd, 0x91, 0x17, 0xbb, 0xa2, 0x6c, 0x12, 0x3d, 0x7a, 0x1c, 0xf7, 0xbd,
-  0x93, 0x96, 0x8c, 0x3d, 0x7d, 0x98, 0xe3, 0x3d, 0xd8, 0x47, 0x56, 0x3d,
-  0xed, 0xfb, 0xa7, 0xbb, 0x46, 0x4e, 0x59, 0xbb, 0xb2, 0x48, 0xf8, 0x3d,
-  0x99, 0xe9, 0x17, 0x3e, 0xfb, 0x13, 0x00, 0xbe, 0x36, 0xc9, 0x64, 0x3e,
-  0xfb, 0x5d, 0xb6, 0x3d, 0x3c, 0x85, 0xcb, 0x3d, 0x46, 0x0f, 0xdd, 0x3d,
-  0x0a, 0x0d, 0x8c, 0xbd, 0x33, 0x71, 0x95, 0x3d, 0xe6, 0xb8, 0xbb, 0x3d,
-  0x54, 0x22, 0x06, 0xbc, 0xfa, 0xe1, 0xd0, 0x3d, 0x0a, 0x70, 0xa5, 0x3b,
-  0x50, 0x32, 0xf8, 0x3c, 0xb4, 0x6d, 0xb2, 0x3d, 0x85, 0x9b, 0xe6, 0xbd,
-  0xb6, 0xf6, 0xa9, 0x3d, 0x78, 0xd7, 0x4e, 0x3d, 0x40, 0xe6, 0xd9, 0x3d,
-  0x13, 0xbb, 0x96, 0x3d, 0x99, 0xbb, 0x67, 0x3d, 0x54, 0xac, 0xfb, 0x3d,
-  0xc8, 0x31, 0x35, 0x3e, 0x94, 0xbb, 0x0d, 0x3d, 0x3a, 0x4a, 0x95, 0x3d,
-  0x77, 0x84, 0xee, 0x3c, 0x1f, 0x34, 0xf3, 0x3d, 0xe7, 0xd5, 0x81, 0x3d,
-  0xa7, 0x5d, 0x2f, 0x3d, 0x6a, 0x7f, 0x4b, 0x3d, 0xfe, 0x8d, 0x21, 0x3e,
-  0xfd, 0x53, 0x02, 0x3d, 0x17, 0x1f, 0xbe, 0x3c, 0x25, 0x61, 0x94, 0x3c,
-  0xd5, 0x61, 0x21, 0x3e, 0x42, 0xd7, 0x25, 0xbd, 0xda, 0xac, 0xfb, 0xbc,
-  0xd4, 0x58, 0x15, 0x3d, 0x5a, 0x5f, 0x88, 0x3d, 0x40, 0xfd, 0xba, 0xbd,
-  0x7c, 0xb0, 0x96, 0xba, 0xe5, 0x1e, 0x2b, 0xbd, 0x9a, 0x13, 0x29, 0x3e,
-  0x81, 0x2e, 0x5a, 0xbd, 0xcf, 0x53, 0x1a, 0xbd, 0x7a, 0x55, 0xd6, 0x3c,
-  0xfe, 0x7c, 0x7a, 0x3b, 0xec, 0xf4, 0x1a, 0xbd, 0x72, 0x4a, 0x71, 0x3d,
-  0x31, 0xbd, 0x87, 0xbd, 0x4b, 0xa5, 0x75, 0x3d, 0xc6, 0xc5, 0x85, 0xbd,
-  0xc5, 0x06, 0xd0, 0xbb, 0xb6, 0xda, 0x9b, 0x3d, 0x07, 0x5f, 0x63, 0x3d,
-  0x57, 0x5e, 0x89, 0x3d, 0x34, 0x0b, 0xf5, 0x3c, 0x5c, 0x28, 0x56, 0xbd,
-  0x1d, 0x10, 0x78, 0xbd, 0x88, 0xcd, 0x99, 0xbd, 0xb8, 0x50, 0x72, 0xbd,
-  0x8d, 0xb6, 0x15, 0xbd, 0x47, 0xb8, 0x61, 0xbd, 0x04, 0x7f, 0x17, 0x3d,
-  0x6a, 0x95, 0xf5, 0x3b, 0xf3, 0xbe, 0x25, 0x3b, 0xbf, 0x6a, 0xaa, 0xbc,
-  0x95, 0xa7, 0xd3, 0xbc, 0x5d, 0x50, 0x32, 0xbe, 0x62, 0xfc, 0xdc, 0xbd,
-  0x59, 0x25, 0x0d, 0xbe, 0x9e, 0x77, 0x2f, 0xbd, 0x11, 0x23, 0x0a, 0xbe,
-  0xcb, 0x9f, 0x24, 0xbe, 0x7f, 0x6e, 0x55, 0x3c, 0x0b, 0xa3, 0x45, 0xbe,
-  0xba, 0x6d, 0x02, 0xbe, 0xad, 0x02, 0x58, 0xbe, 0x90, 0x38, 0x09, 0xbe,
-  0xae, 0xcd, 0xb9, 0xbc, 0x42, 0x86, 0x20, 0xbe, 0x60, 0xdf, 0x42, 0xbe,
-  0x9a, 0x75, 0x8c, 0xbd, 0x50, 0x1a, 0x86, 0xbe, 0xd1, 0x8a, 0x28, 0xbd,
-  0xea, 0x16, 0xd8, 0xbd, 0xe2, 0x3f, 0x18, 0xbd, 0x35, 0xa3, 0xa7, 0xbb,
-  0xae, 0x41, 0x77, 0xbd, 0x7b, 0x12, 0x08, 0xbe, 0x9c, 0x1a, 0xa2, 0xbe,
-  0xaf, 0xd8, 0x9f, 0xbd, 0xce, 0x15, 0x6c, 0xbd, 0x23, 0xb3, 0xb0, 0x3c,
-  0xd6, 0x5a, 0x25, 0xbd, 0xf9, 0xc3, 0x8a, 0x3d, 0x26, 0x2b, 0x3c, 0xbc,
-  0x38, 0xe3, 0x17, 0xbc, 0xa4, 0x27, 0x96, 0xbe, 0xdd, 0x4e, 0x48, 0xbd,
-  0x39, 0x2d, 0xfd, 0x3d, 0x04, 0xbd, 0x48, 0x3d, 0xba, 0xfb, 0x1b, 0x3c,
-  0xc4, 0x46, 0x82, 0x3d, 0x9c, 0x17, 0x2e, 0x3d, 0xd0, 0x92, 0x2e, 0x3c,
-  0xbf, 0x33, 0x2e, 0x3c, 0x43, 0xa4, 0xb0, 0x3d, 0x2c, 0xb1, 0x21, 0x3e,
-  0x8f, 0xe0, 0x5b, 0x3d, 0x9d, 0xe4, 0xb6, 0x3d, 0xba, 0xcd, 0xcd, 0x3d,
-  0x60, 0xb6, 0xf3, 0x3d, 0x15, 0x2f, 0x18, 0x3e, 0x3b, 0x44, 0xd9, 0x3d,
-  0x59, 0xe2, 0xdc, 0x3d, 0x4b, 0x6b, 0x82, 0x3d, 0x5d, 0xb2, 0x16, 0x3d,
-  0x5d, 0xbd, 0x6c, 0x3d, 0x05, 0x5b, 0x44, 0x3e, 0x62, 0x5b, 0xfe, 0x3d,
-  0x6c, 0xd9, 0x3d, 0x3e, 0xab, 0xac, 0x87, 0x3e, 0x1a, 0xbb, 0xc5, 0x3d,
-  0x29, 0x68, 0xfc, 0x3d, 0x95, 0xd4, 0x27, 0x3c, 0x61, 0x70, 0xeb, 0x3d,
-  0x9d, 0xff, 0x2c, 0x3e, 0x3c, 0x70, 0xbb, 0x3d, 0x3c, 0x9e, 0x65, 0x3d,
-  0x59, 0x50, 0x5c, 0x3e, 0x0f, 0xbe, 0x2e, 0x3d, 0x7d, 0x1c, 0x57, 0x3d,
-  0x65, 0xa1, 0x6a, 0x3d, 0x25, 0x92, 0xca, 0x3d, 0x98, 0xf7, 0xb4, 0x3d,
-  0x27, 0x01, 0xae, 0x3c, 0xdd, 0x05, 0x42, 0xba, 0xb8, 0x42, 0x02, 0x3e,
-  0x5a, 0x2d, 0xa1, 0xbd, 0x63, 0x31, 0x50, 0xbc, 0xe2, 0xb9, 0x05, 0xbd,
-  0x72, 0xfd, 0x6a, 0x3d, 0xde, 0x8f, 0x17, 0xbd, 0x6c, 0x74, 0x0c, 0xbd,
-  0x4d, 0x7a, 0xa6, 0x3c, 0xe5, 0xdc, 0xff, 0x3c, 0xc7, 0x86, 0x7f, 0xbd,
-  0xff, 0xe7, 0xa0, 0xbd, 0xe4, 0x8d, 0xd7, 0xbd, 0xfe, 0xc8, 0x8b, 0x3c,
-  0xba, 0x76, 0x02, 0xbd, 0xfd, 0xec, 0x24, 0xbd, 0x88, 0x2d, 0xa2, 0xbd,
-  0x05, 0x54, 0x09, 0xbc, 0xf8, 0xe9, 0xc1, 0xbd, 0x2e, 0x6a, 0xf3, 0xbc,
-  0x14, 0x60, 0x1a, 0xbe, 0x55, 0xa3, 0x0a, 0xbc, 0x58, 0x46, 0x6c, 0x3d,
-  0x81, 0x47, 0xe8, 0xbd, 0x4e, 0xfc, 0x18, 0xbe, 0x59, 0x00, 0xc3, 0x3c,
-  0x3d, 0xbc, 0x0c, 0xbe, 0xcd, 0x79, 0xfa, 0xbd, 0xdb, 0xa7, 0x45, 0xbe,
-  0x65, 0x41, 0xb6, 0xbd, 0x0a, 0xec, 0x0e, 0x3d, 0x7d, 0x69, 0xd6, 0xbd,
-  0xbc, 0x4a, 0x10, 0xbe, 0xe5, 0x29, 0x15, 0x3d, 0x7e, 0x58, 0x6a, 0x3d,
-  0xc1, 0x44, 0xfb, 0xbc, 0x19, 0xf6, 0x99, 0xbd, 0xab, 0x0c, 0x7b, 0xbd,
-  0x3e, 0x75, 0x20, 0xbd, 0x30, 0x59, 0x80, 0xbd, 0x13, 0x1d, 0xb6, 0xbd,
-  0x62, 0xec, 0xb7, 0xbc, 0xff, 0x0a, 0xa2, 0xbd, 0x1a, 0x45, 0x2d, 0xbe,
-  0xce, 0x45, 0x41, 0xbe, 0x0d, 0x93, 0x45, 0xbe, 0x6e, 0xc9, 0x01, 0xbd,
-  0x60, 0xa6, 0x42, 0xbe, 0x39, 0x23, 0x55, 0xbe, 0x20, 0x4e, 0x47, 0x3d,
-  0xaa, 0x09, 0x75, 0xbe, 0x22, 0xd3, 0x79, 0xbe, 0xfd, 0xe0, 0x80, 0xbe,
-  0xe8, 0x90, 0xa2, 0xbe, 0x4c, 0xf2, 0x33, 0xbe, 0xef, 0x75, 0x6d, 0xbe,
-  0x4a, 0x2a, 0x84, 0xbe, 0x2a, 0x7b, 0x8e, 0xbc, 0x8b, 0x2a, 0x6c, 0xbe,
-  0x0c, 0x42, 0x8d, 0xbd, 0x8e, 0xfd, 0x91, 0xbd, 0x11, 0x20, 0xeb, 0xbd,
-  0x43, 0xe9, 0x6b, 0xbd, 0xd4, 0x94, 0xba, 0xbd, 0x7e, 0x1b, 0xb1, 0xbd,
-  0x4b, 0x34, 0x8c, 0xbd, 0x49, 0xac, 0x1e, 0xbe, 0xd1, 0x52, 0xe7, 0x3c,
-  0x8f, 0x18, 0x12, 0xbe, 0x5c, 0x1c, 0x85, 0xbd, 0xc5, 0xe4, 0xc8, 0x3d,
-  0x9b, 0x54, 0xc1, 0xbd, 0x98, 0x06, 0x56, 0xbd, 0x21, 0x51, 0x63, 0xbd,
-  0x91, 0xbf, 0xec, 0xbd, 0x92, 0xa9, 0x41, 0xbd, 0xc9, 0x27, 0xb3, 0xbd,
-  0x6f, 0xe2, 0x89, 0xbd, 0xf5, 0x95, 0xa2, 0x3d, 0x82, 0x8e, 0x96, 0xbd,
-  0xae, 0xd4, 0x98, 0x3a, 0x11, 0xa6, 0xea, 0xbb, 0x8f, 0x26, 0x96, 0xbd,
-  0x22, 0xe9, 0xe5, 0x3c, 0x80, 0x69, 0xea, 0xbc, 0x77, 0x0d, 0xb2, 0xbd,
-  0x6a, 0x93, 0xeb, 0x3d, 0xcf, 0xaf, 0x55, 0xbb, 0xa4, 0xe2, 0xd7, 0xbd,
-  0xd6, 0xae, 0xcc, 0xba, 0xb0, 0x32, 0x75, 0xbd, 0x56, 0xdc, 0x28, 0xbd,
-  0x17, 0x7d, 0x90, 0xbd, 0x50, 0x1d, 0x2d, 0xbc, 0xae, 0xf4, 0x23, 0x3d,
-  0x4a, 0xcc, 0xad, 0x3c, 0x1c, 0xef, 0xe5, 0xbb, 0xef, 0x69, 0x90, 0xbc,
-  0x37, 0x1e, 0x5c, 0xbd, 0xfa, 0xb9, 0x21, 0xbd, 0xc5, 0x58, 0x70, 0xbd,
-  0x12, 0x49, 0x10, 0xbd, 0x45, 0x58, 0xa0, 0x3d, 0xdb, 0x37, 0xdf, 0x3b,
-  0x95, 0x4a, 0xcc, 0xbc, 0xf2, 0xe7, 0xae, 0xba, 0x32, 0x68, 0xe6, 0xbc,
-  0x28, 0x24, 0xd6, 0xbd, 0xcb, 0xc5, 0x38, 0xbd, 0x75, 0x48, 0x38, 0x3d,
-  0x78, 0xdd, 0x8f, 0x3d, 0x10, 0xf4, 0x7f, 0x3c, 0x5a, 0x19, 0xa6, 0x3c,
-  0xc2, 0x87, 0xa1, 0xbc, 0x3b, 0x86, 0xeb, 0xb9, 0x2f, 0x05, 0x9e, 0xbd,
-  0xf8, 0xdc, 0x25, 0xbe, 0xfd, 0xb8, 0xe6, 0xbd, 0xe0, 0xd4, 0xaf, 0x3a,
-  0x46, 0x07, 0x99, 0xbd, 0x98, 0xc1, 0xbb, 0xbd, 0x6b, 0xff, 0xbe, 0xbc,
-  0x7f, 0xc1, 0x40, 0xbe, 0xc5, 0x24, 0x61, 0xbe, 0x1d, 0x1c, 0x23, 0xbe,
-  0x27, 0x1f, 0x0b, 0xbe, 0xa2, 0xa6, 0x00, 0xbd, 0xff, 0x06, 0x18, 0xbe,
-  0xb0, 0x7b, 0x66, 0xbe, 0x93, 0x09, 0x48, 0x3c, 0x7e, 0xfc, 0x1e, 0xbe,
-  0xaf, 0x62, 0x44, 0xbe, 0xdb, 0xe1, 0xc5, 0x3b, 0x70, 0xb8, 0x3c, 0xbe,
-  0xd1, 0x0f, 0xb1, 0x3c, 0xeb, 0xc4, 0x7b, 0xbd, 0xed, 0x27, 0xf9, 0xbd,
-  0x2a, 0xf5, 0xa2, 0x3d, 0xa2, 0x9b, 0x49, 0x3c, 0xc2, 0xc6, 0xa2, 0xbc,
-  0xb6, 0x35, 0xaf, 0x3b, 0x8c, 0x17, 0x3b, 0x3d, 0xe4, 0xf3, 0xab, 0xbb,
-  0x8a, 0x16, 0x37, 0x3d, 0xf9, 0x18, 0x82, 0x3c, 0x66, 0xad, 0xbd, 0x3b,
-  0xbb, 0xbb, 0x9c, 0x3d, 0x4a, 0xe0, 0x5a, 0xbd, 0x40, 0xfa, 0x53, 0xbd,
-  0x2a, 0x11, 0xb0, 0x3c, 0x7e, 0x4b, 0x40, 0x3c, 0x92, 0x06, 0xde, 0xbd,
-  0xe0, 0xdb, 0x43, 0xbd, 0xcf, 0xb6, 0x02, 0x3c, 0xb0, 0xa0, 0xee, 0xbd,
-  0xa9, 0x35, 0x45, 0xbe, 0xd0, 0xc4, 0x1c, 0xbe, 0x55, 0x27, 0x81, 0xbe,
-  0x4d, 0xc0, 0x56, 0xbd, 0xee, 0xff, 0x11, 0xbe, 0xdf, 0xec, 0x33, 0xbe,
-  0xa5, 0xcb, 0x13, 0x3b, 0x3a, 0xf9, 0x49, 0xbe, 0xb6, 0x83, 0x4b, 0xbe,
-  0xc2, 0x87, 0x86, 0xbe, 0xd3, 0x42, 0xa2, 0xbe, 0xa5, 0x4f, 0x48, 0xbd,
-  0x80, 0x1d, 0x1f, 0xbe, 0xba, 0x43, 0x57, 0xbe, 0xda, 0xd0, 0x6b, 0x3a,
-  0x03, 0xb6, 0x7a, 0xbe, 0x0a, 0xd3, 0x3e, 0xbe, 0x96, 0xb1, 0x2c, 0xbe,
-  0xb0, 0xd2, 0xaa, 0xbe, 0x9b, 0xe2, 0x36, 0xbe, 0x66, 0x0b, 0x7d, 0xbe,
-  0x8b, 0x72, 0x6b, 0xbe, 0x00, 0x09, 0x77, 0x3d, 0x89, 0xb2, 0x65, 0xbe,
-  0xe3, 0xe5, 0x06, 0xbe, 0x59, 0x5b, 0x15, 0xbe, 0x91, 0xaa, 0x01, 0xbe,
-  0xba, 0xfa, 0x1b, 0xbe, 0xfc, 0x09, 0x28, 0xbe, 0x8e, 0xe4, 0x46, 0xbe,
-  0x2a, 0x68, 0x8c, 0x3d, 0x0a, 0xe2, 0x87, 0xbe, 0x0a, 0xe3, 0xf1, 0xbd,
-  0x9e, 0xfa, 0x41, 0xbe, 0xc0, 0xa0, 0x02, 0xbe, 0x86, 0xe1, 0x02, 0xbe,
-  0xa1, 0x45, 0x8a, 0xbd, 0x73, 0x25, 0xd1, 0xbd, 0xb2, 0x20, 0xf2, 0x3c,
-  0x35, 0x09, 0x86, 0xbe, 0x2f, 0x32, 0xc2, 0xbd, 0x86, 0x35, 0xe8, 0xbd,
-  0xeb, 0xd9, 0xad, 0xbd, 0xc4, 0xd5, 0xfd, 0xbc, 0xee, 0x26, 0x1a, 0xbe,
-  0x5c, 0x9a, 0xdf, 0xbd, 0x10, 0xa7, 0x59, 0x3d, 0x82, 0x7a, 0xb9, 0xbd,
-  0x30, 0xce, 0x94, 0xbd, 0xd7, 0x76, 0xa9, 0xbd, 0x3f, 0x9c, 0xf5, 0xbd,
-  0x46, 0x32, 0xf8, 0xbc, 0x57, 0xc6, 0x3d, 0xbe, 0x7c, 0x09, 0xbb, 0xbd,
-  0x2c, 0xe0, 0x8e, 0x3d, 0x9c, 0x57, 0x8a, 0xbd, 0x2e, 0xf8, 0x23, 0xbe,
-  0x4d, 0x4c, 0xda, 0xbd, 0x35, 0xaa, 0x41, 0xbe, 0xff, 0x2c, 0xf2, 0xbc,
-  0x07, 0xbb, 0xcc, 0xbd, 0x60, 0xd6, 0x17, 0xbe, 0x48, 0x03, 0xe4, 0xbc,
-  0x0a, 0x83, 0x68, 0xbd, 0x26, 0xcc, 0x0f, 0xbe, 0x57, 0x51, 0xc0, 0xbd,
-  0x4a, 0xb8, 0x2b, 0xbe, 0x6e, 0x0a, 0x68, 0x3d, 0x4c, 0x69, 0x21, 0xbe,
-  0x36, 0x8a, 0x41, 0xbe, 0x74, 0x7e, 0x8d, 0x3d, 0x8c, 0xad, 0xb7, 0xbd,
-  0xf3, 0x3b, 0x8e, 0xbd, 0x62, 0x56, 0x05, 0xbd, 0xd7, 0x04, 0x16, 0xbe,
-  0xab, 0x34, 0x64, 0xbc, 0xc8, 0x03, 0x73, 0xbd, 0x73, 0x24, 0xfd, 0xbd,
-  0x14, 0xb9, 0x0d, 0x3d, 0x34, 0xf3, 0x11, 0x3d, 0x7e, 0x33, 0x01, 0x3c,
-  0xdd, 0xf5, 0x1f, 0xbd, 0xdf, 0x2a, 0x41, 0x3c, 0x69, 0xc7, 0x38, 0x3d,
-  0xad, 0x49, 0x82, 0xbb, 0xe1, 0x23, 0x4f, 0xbd, 0x2d, 0x38, 0xbd, 0x3d,
-  0x30, 0x01, 0x88, 0x3d, 0xb9, 0xbc, 0x06, 0x3d, 0x26, 0x50, 0xc5, 0xba,
-  0xb2, 0xf2, 0x9a, 0x3d, 0x23, 0x81, 0x2e, 0x3e, 0xcf, 0xe1, 0x2c, 0x3d,
-  0x4e, 0x97, 0xa2, 0x3c, 0x46, 0x3a, 0x02, 0x3e, 0x1f, 0x5e, 0x81, 0xbd,
-  0x43, 0xa8, 0x00, 0xbc, 0xa2, 0xe9, 0x85, 0x3c, 0xeb, 0x19, 0x25, 0xbc,
-  0x4a, 0xe7, 0xb0, 0x3d, 0x84, 0xf4, 0x88, 0x3d, 0x50, 0xdb, 0xb0, 0xbc,
-  0x5b, 0x12, 0x92, 0x3d, 0xc9, 0xc1, 0xdc, 0xbd, 0xb0, 0x48, 0x8f, 0xbd,
-  0xe9, 0x6a, 0xc7, 0x3c, 0x6b, 0xf8, 0x74, 0xbc, 0x97, 0xbd, 0xf3, 0x3d,
-  0x93, 0x7d, 0x01, 0x3e, 0x5b, 0x8e, 0x82, 0x3c, 0x3b, 0xb6, 0xaa, 0x3b,
-  0x07, 0x39, 0xef, 0xbd, 0x6f, 0x80, 0xd6, 0xbd, 0x26, 0x12, 0x0c, 0xbe,
-  0xd8, 0x44, 0x9a, 0x3d, 0x8c, 0xa5, 0x14, 0x3e, 0x3b, 0x6e, 0x34, 0x3d,
-  0x6e, 0xe2, 0x31, 0xbe, 0x0b, 0xd7, 0x47, 0x3d, 0x00, 0xc8, 0x73, 0xbe,
-  0xfc, 0x87, 0x85, 0xbe, 0xe2, 0x9b, 0x4b, 0xbe, 0xaf, 0x40, 0xa9, 0xbc,
-  0x00, 0xe5, 0x9b, 0x3d, 0xec, 0x64, 0x19, 0xbe, 0x73, 0x55, 0x0d, 0xbe,
-  0x14, 0xb9, 0x60, 0xbb, 0xf6, 0xcb, 0x88, 0xbe, 0x80, 0xdf, 0x64, 0xbe,
-  0xa1, 0x4c, 0x38, 0xbe, 0x66, 0x09, 0x0b, 0xbd, 0x65, 0x8d, 0x1d, 0x3e,
-  0x3e, 0x20, 0x19, 0xbe, 0xa7, 0xe5, 0x3b, 0xbe, 0x95, 0x0e, 0xe6, 0x3c,
-  0x90, 0x00, 0x23, 0xbe, 0xf7, 0xb1, 0x5a, 0xbe, 0xac, 0x7f, 0x6e, 0xbe,
-  0x8d, 0xc0, 0xf8, 0xbd, 0x0e, 0x11, 0x11, 0x3e, 0x34, 0x6f, 0x1d, 0xbe,
-  0x3c, 0x03, 0x56, 0xbe, 0x3d, 0x82, 0x3d, 0x3c, 0x7e, 0x88, 0x2f, 0xbe,
-  0x5c, 0xe0, 0x2a, 0xbe, 0xe3, 0xb5, 0xc6, 0xbd, 0xce, 0x4f, 0xfa, 0xbb,
-  0x6f, 0x58, 0x06, 0x3e, 0x82, 0x24, 0x08, 0xbe, 0x50, 0xbf, 0x37, 0xbe,
-  0x9d, 0x3e, 0x31, 0xbc, 0x54, 0x58, 0x1c, 0xbe, 0x15, 0x43, 0x45, 0xbe,
-  0xd3, 0x99, 0xc4, 0xbd, 0x30, 0x50, 0x1c, 0xbd, 0x4d, 0x02, 0x69, 0x3d,
-  0x62, 0xf2, 0xda, 0xbd, 0x5b, 0x3d, 0xee, 0xbd, 0x7f, 0x6b, 0xff, 0x3d,
-  0xbd, 0x4c, 0x86, 0xbd, 0x59, 0x37, 0x23, 0xbd, 0x9b, 0xae, 0x19, 0xbe,
-  0x8d, 0x26, 0x84, 0xbc, 0x57, 0xe5, 0xe3, 0x3d, 0x4f, 0x72, 0x4f, 0x3c,
-  0x8a, 0x7b, 0x9a, 0xbd, 0xfb, 0x2e, 0x93, 0x3d, 0xdf, 0xbe, 0x40, 0x3c,
-  0xf7, 0x8b, 0x11, 0xbc, 0xab, 0x4b, 0x8d, 0xbd, 0xff, 0x87, 0x2c, 0x3d,
-  0xb4, 0x53, 0x28, 0x3d, 0x86, 0x72, 0x14, 0x3d, 0xed, 0x6c, 0xa1, 0xbd,
-  0x34, 0xac, 0x06, 0x3e, 0x19, 0x15, 0x84, 0x3b, 0x2f, 0x44, 0x9e, 0x3c,
-  0x19, 0xb6, 0xf1, 0xbc, 0xc9, 0x32, 0x08, 0x3d, 0x65, 0xc7, 0x23, 0x3e,
-  0xf2, 0x48, 0xfa, 0x3d, 0x08, 0x7b, 0x18, 0xbd, 0x07, 0x07, 0xe9, 0x3d,
-  0xa0, 0x87, 0x56, 0x3b, 0xc9, 0x92, 0x17, 0xbc, 0xbd, 0x05, 0x22, 0xbd,
-  0x7a, 0x58, 0xb2, 0x3d, 0xbc, 0x76, 0x35, 0x3e, 0x97, 0x4f, 0x78, 0x3d,
-  0x5b, 0x44, 0x64, 0xb8, 0xbf, 0x12, 0x54, 0x3d, 0x89, 0xe8, 0x81, 0xbb,
-  0xfe, 0x2c, 0x8a, 0x3d, 0x9a, 0x57, 0x60, 0xbc, 0x7f, 0xbe, 0x84, 0x3c,
-  0xdc, 0xb2, 0x83, 0x3d, 0x35, 0xb4, 0x90, 0x3d, 0xff, 0x84, 0xb3, 0x3c,
-  0x64, 0x4c, 0xe1, 0x3d, 0x14, 0xf6, 0x6f, 0x3c, 0xaa, 0x14, 0x6d, 0xbd,
-  0xe8, 0x7a, 0x98, 0xbd, 0x6f, 0xe1, 0x91, 0xbb, 0x4b, 0x4d, 0x16, 0x3e,
-  0x42, 0xfc, 0x1d, 0xbd, 0xf1, 0xdb, 0x0d, 0xbe, 0xb4, 0xec, 0xdf, 0x3d,
-  0xab, 0xcd, 0xa8, 0x3d, 0x8e, 0x72, 0x3f, 0xbd, 0x90, 0x8f, 0x1a, 0xbd,
-  0xab, 0x18, 0x05, 0xbb, 0x1d, 0xbf, 0x03, 0x3e, 0xc5, 0x7a, 0x33, 0xbe,
-  0x5a, 0x06, 0xc1, 0xbd, 0xf9, 0x06, 0xc6, 0x3d, 0xe6, 0xda, 0x02, 0x3c,
-  0x6c, 0x01, 0xaa, 0xbd, 0x84, 0x2d, 0x78, 0xbd, 0x22, 0x72, 0xb2, 0xbd,
-  0x80, 0x18, 0x11, 0x3e, 0x73, 0x20, 0x7c, 0xbe, 0xf9, 0xe5, 0x1d, 0xbe,
-  0xe8, 0xa5, 0x89, 0xbd, 0xdc, 0x17, 0x20, 0xbe, 0x31, 0xcb, 0x29, 0xbe,
-  0x0f, 0x2d, 0xbe, 0xbc, 0xd4, 0x25, 0x1f, 0xbe, 0x0d, 0xcf, 0x9e, 0x3d,
-  0xb0, 0x9d, 0xc5, 0xbe, 0x19, 0x55, 0x72, 0xbe, 0xa7, 0x42, 0x6a, 0x3c,
-  0x9e, 0x02, 0x2c, 0xbe, 0x89, 0xf1, 0x12, 0xbe, 0x72, 0x51, 0xf0, 0xbd,
-  0x74, 0x57, 0x4e, 0xbe, 0x66, 0x4b, 0x86, 0x3d, 0xc3, 0xad, 0x9b, 0xbe,
-  0x9d, 0x79, 0x56, 0xbe, 0x39, 0xdc, 0x86, 0xbd, 0xd6, 0x29, 0x96, 0xbd,
-  0xd6, 0x14, 0xfc, 0xbd, 0x8c, 0xac, 0x11, 0xbe, 0xe4, 0xd2, 0x9c, 0xbe,
-  0xe5, 0xc1, 0x4b, 0x3d, 0x21, 0x77, 0x5b, 0xbe, 0x67, 0x23, 0x04, 0xbe,
-  0x46, 0x80, 0x35, 0xbd, 0x16, 0x57, 0xa4, 0xbd, 0x24, 0xff, 0x36, 0xbd,
-  0x6b, 0x50, 0x4d, 0xbc, 0x3e, 0x9e, 0x73, 0xbe, 0x07, 0x51, 0x24, 0x3d,
-  0x58, 0x81, 0x6d, 0xbe, 0xd7, 0xe9, 0xe3, 0xbd, 0xa3, 0x4a, 0x09, 0xbe,
-  0x61, 0xc7, 0x95, 0xbe, 0xd8, 0xce, 0xfe, 0xbd, 0xa7, 0x50, 0xff, 0xbc,
-  0x12, 0x48, 0x11, 0xbe, 0xfb, 0x02, 0x4d, 0x3d, 0xb5, 0xa7, 0x4c, 0xbe,
-  0xec, 0x27, 0xaa, 0xbe, 0xe2, 0x8f, 0x11, 0xbe, 0xbf, 0x7d, 0xbf, 0xbe,
-  0x8b, 0xc3, 0x42, 0xbe, 0x62, 0xa3, 0x32, 0xbe, 0xaf, 0x77, 0xcd, 0xbd,
-  0xe5, 0xb2, 0x0d, 0x3e, 0xf8, 0x51, 0x93, 0xbe, 0x92, 0x6d, 0xc4, 0xbe,
-  0x2d, 0xc0, 0xca, 0xbd, 0x36, 0x4a, 0x48, 0xbe, 0x79, 0x32, 0x6d, 0xbe,
-  0x03, 0xc0, 0x92, 0xbe, 0x8d, 0xd4, 0xd2, 0xbd, 0x59, 0x40, 0xe1, 0x3d,
-  0x3b, 0xab, 0x87, 0xbe, 0x41, 0xb4, 0xef, 0xbd, 0xd2, 0x18, 0x0a, 0x3d,
-  0x9d, 0xf4, 0x6f, 0xbe, 0x00, 0xb2, 0x58, 0xbe, 0x1a, 0x99, 0x67, 0xbe,
-  0x74, 0x4b, 0xd1, 0xbd, 0xab, 0xff, 0xe0, 0x3d, 0xbb, 0x6f, 0x1c, 0xbe,
-  0x01, 0x39, 0x38, 0xbe, 0x8a, 0x67, 0x54, 0x3d, 0x0b, 0xcf, 0x2b, 0xbd,
-  0xf3, 0xfc, 0x38, 0xbe, 0xfb, 0xc2, 0x14, 0xbe, 0x6f, 0x43, 0x97, 0xbd,
-  0xbc, 0x4c, 0xb7, 0x3d, 0xbc, 0x15, 0x6b, 0xbc, 0x12, 0xfb, 0xb4, 0xbd,
-  0x19, 0x9e, 0xb7, 0x3d, 0xd7, 0x51, 0x0a, 0x3d, 0x5d, 0xe0, 0xfc, 0x3d,
-  0x41, 0x17, 0x96, 0x3d, 0xa1, 0xb0, 0xd6, 0xbc, 0x61, 0xd5, 0x27, 0x3e,
-  0x89, 0x10, 0x7b, 0x3d, 0x9a, 0xe0, 0xd1, 0x3d, 0x44, 0xc9, 0x91, 0x3d,
-  0x35, 0xe5, 0xea, 0xbc, 0x48, 0xa2, 0x09, 0x3d, 0xb3, 0x76, 0x89, 0xbc,
-  0xea, 0x9e, 0xab, 0x3d, 0xe5, 0x2f, 0x07, 0x3e, 0x50, 0x94, 0x25, 0x3d,
-  0x86, 0xfa, 0xd6, 0xbc, 0xe5, 0x4f, 0xe1, 0x3d, 0x12, 0x34, 0x14, 0x3e,
-  0x38, 0x20, 0x21, 0xbd, 0x52, 0x5c, 0xc7, 0x3b, 0x41, 0xda, 0xeb, 0x3d,
-  0xe6, 0x33, 0x23, 0x3e, 0x30, 0xf0, 0x87, 0xbb, 0xd1, 0xf2, 0x53, 0x3c,
-  0xf4, 0x0c, 0x78, 0x3d, 0x9e, 0xe3, 0x17, 0x3e, 0x22, 0x41, 0x6b, 0x3d,
-  0xde, 0x74, 0xea, 0xbc, 0x33, 0xb8, 0x7c, 0x3d, 0xdc, 0x4a, 0x82, 0x3e,
-  0x61, 0x41, 0xe9, 0x3c, 0x26, 0x5a, 0x87, 0xbb, 0x1e, 0x67, 0x1d, 0x3e,
-  0x5f, 0xf8, 0xd8, 0x3d, 0xd3, 0x31, 0x5c, 0xbd, 0x89, 0x4f, 0x9a, 0x3b,
-  0x94, 0x15, 0xa8, 0x3d, 0xde, 0x12, 0x68, 0x3e, 0x1f, 0xd5, 0x6f, 0xbc,
-  0x30, 0x58, 0x9a, 0x3d, 0x5c, 0x4e, 0x96, 0x3d, 0x8c, 0x0f, 0x55, 0x3d,
-  0xe5, 0x02, 0x9d, 0xbd, 0x7b, 0x11, 0xe3, 0x3b, 0xc0, 0x42, 0x00, 0x3d,
-  0x93, 0x49, 0x51, 0x3e, 0x58, 0xee, 0x25, 0x3c, 0xe4, 0x4f, 0x11, 0x3d,
-  0xa3, 0x28, 0x13, 0x3c, 0x8f, 0x4b, 0x20, 0xbd, 0xfb, 0x13, 0x97, 0xbd,
-  0xb2, 0xd6, 0xff, 0xbc, 0x58, 0x85, 0xed, 0x3b, 0x19, 0x21, 0x4d, 0x3e,
-  0x3b, 0x7b, 0xa0, 0xbd, 0x17, 0x42, 0xe7, 0xbb, 0xd3, 0x59, 0x3c, 0x3d,
-  0x38, 0xe0, 0x90, 0xbd, 0x2b, 0xa8, 0xdd, 0xbd, 0x2d, 0x95, 0xc2, 0xbd,
-  0x2c, 0x13, 0x1f, 0xbd, 0xf1, 0xb7, 0x27, 0x3e, 0x26, 0x51, 0x6e, 0xbd,
-  0xd9, 0xe0, 0x86, 0xbd, 0x76, 0xdb, 0xf2, 0x3d, 0xa3, 0x52, 0xaa, 0xbd,
-  0x40, 0x39, 0x8c, 0xbc, 0xa6, 0x0f, 0x95, 0xbc, 0x06, 0x58, 0xee, 0xbd,
-  0x30, 0x1f, 0x27, 0x3d, 0x81, 0x28, 0xe2, 0xbd, 0x82, 0xcf, 0x4a, 0xbd,
-  0x5d, 0x1a, 0xc3, 0x3d, 0x95, 0xac, 0x2f, 0xbd, 0x64, 0xce, 0x19, 0xbe,
-  0xf3, 0xd6, 0xd3, 0xbc, 0x57, 0x3c, 0x27, 0xbe, 0x77, 0x13, 0x10, 0x3e,
-  0xca, 0xb3, 0x2b, 0xbe, 0xf9, 0x7c, 0xd2, 0xbd, 0x02, 0xbc, 0x9c, 0xbc,
-  0x97, 0x65, 0x25, 0xbe, 0x21, 0x54, 0x9e, 0xbd, 0xe3, 0x23, 0x1e, 0xbd,
-  0x29, 0xe7, 0xa4, 0xbe, 0xa1, 0xeb, 0x6d, 0x3d, 0x52, 0xe7, 0x33, 0xbe,
-  0x25, 0x27, 0xfb, 0xbd, 0x92, 0x81, 0x18, 0x3d, 0xc3, 0x6f, 0x7b, 0xbe,
-  0x14, 0xd6, 0x2c, 0xbe, 0xa6, 0xe6, 0xc7, 0xbd, 0xf6, 0x50, 0x73, 0xbe,
-  0x9a, 0xdc, 0x39, 0x3e, 0xbd, 0x3a, 0x22, 0xbe, 0x91, 0xf2, 0x54, 0xbe,
-  0x36, 0x27, 0x82, 0x3c, 0x1a, 0x10, 0x7d, 0xbe, 0x93, 0x50, 0x23, 0xbe,
-  0xa7, 0x68, 0x09, 0xbe, 0x6c, 0xa3, 0x4f, 0xbe, 0x6a, 0x35, 0x19, 0x3e,
-  0x3f, 0x63, 0x46, 0xbe, 0x8d, 0xcb, 0x85, 0xbe, 0x7b, 0x42, 0x12, 0x3e,
-  0xa0, 0x8e, 0x69, 0x3d, 0x24, 0xbf, 0x31, 0x3d, 0x61, 0xa8, 0x18, 0x3e,
-  0xb7, 0x76, 0xd4, 0x3d, 0x50, 0xef, 0xed, 0x3d, 0x0c, 0xb2, 0xe3, 0x3d,
-  0x46, 0x04, 0x18, 0x3e, 0x04, 0x18, 0x89, 0x3d, 0x84, 0x80, 0x52, 0x3d,
-  0x6b, 0x64, 0xd1, 0x3d, 0x49, 0xfc, 0x4b, 0xbd, 0x8f, 0x97, 0x99, 0x3d,
-  0x00, 0x59, 0x46, 0x3e, 0x29, 0xf7, 0xe8, 0xbb, 0x3c, 0xdd, 0x86, 0x3b,
-  0x3a, 0x0c, 0xe7, 0x3d, 0xbe, 0xc2, 0x8c, 0x3d, 0x79, 0x0c, 0x53, 0x3c,
-  0x54, 0xcc, 0x2b, 0x3d, 0xd1, 0x45, 0xd8, 0xbc, 0xc1, 0xa0, 0x44, 0x3e,
-  0x8f, 0x87, 0xd6, 0x3b, 0x62, 0x7d, 0x6b, 0x3c, 0xdb, 0x7b, 0x1f, 0x3d,
-  0x2e, 0x59, 0x8b, 0x3d, 0x8d, 0xdc, 0xd7, 0xbc, 0x95, 0xc6, 0x8f, 0x3d,
-  0xcf, 0x3d, 0x2b, 0x3c, 0x73, 0x87, 0x33, 0x3e, 0x71, 0xf5, 0xe2, 0x3c,
-  0x73, 0xc8, 0xcf, 0x3d, 0x0e, 0x21, 0x81, 0x3d, 0x35, 0x2d, 0x43, 0x3e,
-  0xf0, 0xd3, 0xf2, 0x3d, 0x69, 0xf8, 0xf0, 0xbc, 0x4d, 0xbd, 0x00, 0x3d,
-  0x6a, 0x68, 0x8a, 0x3e, 0xea, 0xa9, 0xad, 0x3c, 0xde, 0x6f, 0xba, 0x3d,
-  0x01, 0x50, 0x27, 0x3d, 0x71, 0x25, 0x24, 0x3e, 0x55, 0xc5, 0x76, 0x3d,
-  0x8d, 0x8b, 0xc0, 0xbc, 0x13, 0xec, 0xdb, 0xbc, 0x7c, 0x8c, 0x09, 0x3e,
-  0xb0, 0xa5, 0x2f, 0xbc, 0x8f, 0x7d, 0x9c, 0x3c, 0xb9, 0xe8, 0xbf, 0x3d,
-  0x2b, 0xed, 0xc2, 0x3c, 0x72, 0x86, 0xf5, 0xbb, 0xb4, 0x0a, 0x5c, 0xbd,
-  0x22, 0xad, 0x0d, 0xbc, 0x56, 0xe1, 0x2b, 0x3e, 0x0f, 0x34, 0x68, 0xbc,
-  0x47, 0xdd, 0x8e, 0x3d, 0x4b, 0xa2, 0xbd, 0x3d, 0x8b, 0x68, 0xb5, 0x3b,
-  0x23, 0xa8, 0x48, 0xbd, 0x19, 0x51, 0x9a, 0x3d, 0xdb, 0x7e, 0x28, 0x3d,
-  0x3c, 0xca, 0x06, 0x3d, 0xc6, 0x3e, 0x28, 0x3d, 0xd8, 0xb9, 0xb3, 0x3d,
-  0xf9, 0x05, 0x88, 0x3d, 0xa8, 0x66, 0x05, 0x3e, 0xf0, 0xc5, 0x04, 0x3d,
-  0xc2, 0xac, 0x07, 0x3c, 0x00, 0xa2, 0xc2, 0xbc, 0x9b, 0x2b, 0x8d, 0xbd,
-  0xa6, 0x5f, 0x45, 0x3d, 0x23, 0x7f, 0xf0, 0x3c, 0x3d, 0x91, 0x81, 0x3d,
-  0xbe, 0x3e, 0xd4, 0xbc, 0x9c, 0x85, 0x67, 0x3c, 0x7c, 0x72, 0xb4, 0x3c,
-  0x73, 0x91, 0x51, 0xbd, 0x7f, 0x61, 0xad, 0xbd, 0xab, 0x3a, 0x24, 0xbd,
-  0x4c, 0x20, 0x47, 0x3d, 0xc3, 0xbf, 0xf8, 0x3c, 0x5e, 0x9c, 0x52, 0xbc,
-  0xb4, 0x05, 0x6e, 0x3c, 0x17, 0xcd, 0x86, 0x3d, 0x50, 0x47, 0x35, 0xbd,
-  0x3b, 0x5b, 0xa4, 0x3d, 0x4e, 0x46, 0x89, 0xbc, 0xda, 0x40, 0x34, 0x3d,
-  0xda, 0xb1, 0x9b, 0x3d, 0x58, 0x25, 0x04, 0xbe, 0x9c, 0xfd, 0xc8, 0xbd,
-  0x07, 0xe4, 0x28, 0x3c, 0x74, 0x83, 0xe3, 0xbd, 0xc7, 0x4a, 0x39, 0x3d,
-  0x46, 0x0c, 0xd2, 0xbc, 0xb0, 0x94, 0x1b, 0xbe, 0xfb, 0xb0, 0x81, 0xbd,
-  0x34, 0xd6, 0x7b, 0xbe, 0xb8, 0x81, 0x8c, 0xbe, 0x44, 0x54, 0x76, 0xbe,
-  0xde, 0xff, 0x71, 0xbe, 0x74, 0x35, 0xc7, 0x3d, 0xfe, 0xc8, 0x84, 0xbe,
-  0xf3, 0xcf, 0x97, 0xbe, 0xe5, 0xc7, 0x3d, 0x3e, 0x2d, 0x3a, 0x33, 0x3e,
-  0x24, 0xe9, 0xba, 0x3d, 0x21, 0x22, 0xac, 0x3d, 0xa9, 0xa8, 0xd5, 0x3d,
-  0x19, 0xe2, 0x99, 0x3d, 0xe7, 0x51, 0x41, 0x3e, 0x27, 0xb4, 0xcf, 0x3d,
-  0xf7, 0xff, 0xba, 0x3d, 0x57, 0x59, 0x1d, 0x3e, 0xa8, 0x4b, 0x62, 0x3b,
-  0xde, 0x62, 0x16, 0xbd, 0x23, 0x1a, 0x83, 0x3d, 0xca, 0x2b, 0xd5, 0x3d,
-  0x74, 0xf6, 0x38, 0x3d, 0x66, 0xf9, 0x35, 0x3d, 0xa9, 0x33, 0xd3, 0x3c,
-  0xa8, 0xf5, 0x3d, 0x3d, 0xa3, 0x95, 0x9a, 0x3d, 0xf8, 0xcd, 0xfc, 0xbd,
-  0x3f, 0x64, 0x93, 0xbb, 0x57, 0x52, 0x6e, 0x3e, 0x7d, 0x67, 0x9b, 0xbd,
-  0x58, 0x2d, 0x9f, 0x3b, 0x12, 0x40, 0xc8, 0x3c, 0xd2, 0x2c, 0xeb, 0x3d,
-  0x3a, 0x39, 0x3c, 0xbb, 0x6e, 0x72, 0x90, 0xbd, 0x06, 0x38, 0x08, 0x3d,
-  0xa7, 0x8b, 0x7a, 0x3e, 0x1a, 0x08, 0x7b, 0xbd, 0x9e, 0x70, 0xb3, 0xb9,
-  0xe0, 0x1a, 0x40, 0xbd, 0x2b, 0x21, 0x4e, 0x3d, 0x1c, 0xf9, 0xe7, 0x3c,
-  0x1e, 0x11, 0x24, 0x3d, 0xb2, 0x99, 0x1a, 0xbc, 0xb2, 0x88, 0x61, 0x3e,
-  0xb6, 0xeb, 0xd2, 0x3c, 0x88, 0x2b, 0x1d, 0xbc, 0xdd, 0x7a, 0x35, 0xbd,
-  0xd7, 0x68, 0x86, 0x3d, 0x0c, 0x28, 0x87, 0x3c, 0x4f, 0x9e, 0x99, 0xbd,
-  0xa9, 0x78, 0x3d, 0xbc, 0x30, 0x46, 0x24, 0x3e, 0x2d, 0xb1, 0x94, 0xbd,
-  0xa7, 0xf6, 0x88, 0x3d, 0x73, 0xc4, 0x3e, 0x3d, 0xec, 0x77, 0x00, 0x3d,
-  0x10, 0xa3, 0xcc, 0x3d, 0x68, 0xbb, 0xa4, 0xbb, 0x3b, 0x55, 0x8c, 0x3d,
-  0x7e, 0x94, 0xe1, 0x3d, 0x08, 0x94, 0x6d, 0xbd, 0xd2, 0x0e, 0xc8, 0x3d,
-  0xda, 0x7e, 0xfe, 0x3c, 0x0a, 0x38, 0x0e, 0x3e, 0x83, 0x97, 0x37, 0x3e,
-  0x23, 0x49, 0xdf, 0x3d, 0xae, 0xf5, 0xf7, 0x3d, 0xf9, 0xdb, 0x00, 0xbd,
-  0x6a, 0x7a, 0xf3, 0x3d, 0x12, 0xab, 0x1e, 0x3e, 0xfc, 0x89, 0x17, 0x3d,
-  0x81, 0xfe, 0x94, 0x3d, 0x6c, 0x65, 0xb1, 0x3d, 0x4c, 0x77, 0xf1, 0x3d,
-  0x9d, 0x84, 0x09, 0x3e, 0x89, 0x7e, 0x4b, 0xbe, 0xa7, 0x8d, 0x03, 0x3e,
-  0xbb, 0x00, 0xc8, 0x3d, 0x80, 0x40, 0x84, 0xbd, 0xbc, 0xa2, 0x97, 0x3c,
-  0x53, 0x21, 0x4b, 0x3c, 0xc0, 0xc8, 0xcd, 0x3d, 0x06, 0x71, 0x0b, 0xbd,
-  0xa4, 0xca, 0x78, 0xbe, 0xe9, 0xbc, 0x3d, 0x3c, 0x47, 0x9e, 0x9a, 0x3d,
-  0xd4, 0xaa, 0x60, 0xbc, 0x0b, 0xf9, 0x15, 0xbd, 0x1f, 0x45, 0xe4, 0xbc,
-  0x65, 0x1c, 0xe4, 0x3d, 0x66, 0x87, 0xc5, 0xbb, 0xc8, 0x04, 0x20, 0xbe,
-  0xe5, 0x38, 0x02, 0xbc, 0xee, 0xd9, 0x88, 0x3d, 0xd9, 0x47, 0xe5, 0xbc,
-  0x63, 0x4a, 0x3b, 0xbd, 0xb3, 0xc8, 0x0c, 0xbd, 0x29, 0x51, 0xc8, 0xbc,
-  0x31, 0x26, 0xe8, 0x3c, 0x0b, 0x1c, 0xd3, 0x3d, 0xea, 0x06, 0x8b, 0xbd,
-  0x51, 0x6b, 0x3c, 0xbd, 0x4e, 0x0c, 0x23, 0x3c, 0x3b, 0xd8, 0x5e, 0xbe,
-  0x49, 0x7f, 0x7e, 0xbe, 0x67, 0x07, 0x7e, 0xbe, 0xcf, 0x78, 0x56, 0xbe,
-  0x13, 0x01, 0x10, 0x3e, 0xb3, 0x9d, 0x72, 0xbe, 0x39, 0xa3, 0x31, 0xbe,
-  0x25, 0x21, 0xd7, 0x3d, 0x71, 0xee, 0x6b, 0x3e, 0xbb, 0x97, 0xe4, 0x3d,
-  0xb6, 0xb6, 0xd0, 0x3d, 0x47, 0xcc, 0xb3, 0x3d, 0x04, 0xf2, 0x1f, 0x3e,
-  0x78, 0x88, 0xcd, 0x3d, 0x2c, 0xb7, 0x3f, 0x3e, 0xd3, 0x92, 0xe7, 0x3d,
-  0x34, 0x4a, 0x2a, 0x3d, 0xdb, 0x8b, 0x73, 0x3d, 0xe5, 0x52, 0xb8, 0xbb,
-  0x3f, 0x1b, 0x8e, 0x3d, 0x76, 0x95, 0xc1, 0x3d, 0xee, 0xd9, 0xd3, 0x3d,
-  0xbf, 0x92, 0xb1, 0x3d, 0x9a, 0x87, 0x0c, 0x3d, 0xa7, 0xd1, 0xe7, 0x3b,
-  0x8d, 0x62, 0xeb, 0x3c, 0xf1, 0x88, 0xae, 0xbc, 0xb6, 0x4a, 0x5a, 0xbd,
-  0x5d, 0xc6, 0x21, 0x3e, 0x9e, 0x92, 0x5d, 0xbd, 0xb0, 0x82, 0x2d, 0x3c,
-  0x37, 0xb5, 0x0e, 0x3e, 0xa9, 0x95, 0x46, 0xbd, 0x7b, 0x90, 0x34, 0x3d,
-  0x98, 0xba, 0xd5, 0xbc, 0xe8, 0x7a, 0x92, 0xbd, 0x7e, 0x78, 0xbe, 0x3d,
-  0x91, 0xcc, 0xde, 0xbb, 0x05, 0x6e, 0xb4, 0xbc, 0xe4, 0x01, 0xbf, 0xbd,
-  0x15, 0xc4, 0xd8, 0xbd, 0x37, 0xaf, 0xa1, 0x3d, 0xb9, 0xa2, 0xad, 0xbd,
-  0xb0, 0x1b, 0x51, 0x3d, 0xb2, 0x9c, 0x26, 0x3d, 0x00, 0xdb, 0x30, 0xbd,
-  0xc5, 0x26, 0x39, 0x3d, 0xe9, 0x0d, 0xbf, 0xbe, 0x89, 0xa1, 0x81, 0xbe,
-  0x4d, 0xc7, 0x2f, 0xbd, 0xb2, 0x59, 0x86, 0xbd, 0x48, 0x5d, 0x89, 0x3d,
-  0x97, 0x50, 0xdd, 0x3d, 0x19, 0x85, 0xe2, 0xbd, 0x34, 0x7e, 0xd0, 0xbd,
-  0xfe, 0xd4, 0xe4, 0xbe, 0x58, 0xcb, 0x8b, 0xbd, 0x88, 0x0a, 0x8b, 0x3d,
-  0x16, 0xde, 0x07, 0xbe, 0x8c, 0x72, 0x9e, 0xbb, 0xbd, 0xa1, 0x0e, 0x3e,
-  0xf2, 0xf8, 0x10, 0xbd, 0xab, 0x47, 0x7c, 0xbc, 0xfd, 0xbd, 0x2a, 0xbe,
-  0x95, 0x06, 0x92, 0x3d, 0x63, 0x06, 0xe9, 0x3d, 0x7b, 0x2c, 0x19, 0x3e,
-  0x34, 0x23, 0x1b, 0x3e, 0xf5, 0x44, 0x36, 0xbd, 0x6e, 0xbc, 0x07, 0x3e,
-  0x33, 0x84, 0x5c, 0x3e, 0xc8, 0x0c, 0x0e, 0xbe, 0xbd, 0xfa, 0x18, 0x3d,
-  0x18, 0x3f, 0x0e, 0x3e, 0x49, 0x7b, 0x18, 0x3e, 0x66, 0x07, 0x60, 0x3e,
-  0x46, 0xc0, 0x47, 0xbd, 0x19, 0x41, 0xec, 0x3d, 0xbc, 0x59, 0xc8, 0x3d,
-  0x76, 0xea, 0xdb, 0xbd, 0xc1, 0xd9, 0xc0, 0x3c, 0xd0, 0xe0, 0x9e, 0x3d,
-  0x6b, 0x20, 0x74, 0x3d, 0xc5, 0x88, 0x06, 0x3e, 0x71, 0x01, 0x40, 0xbd,
-  0x52, 0x8c, 0x88, 0x3c, 0x38, 0x39, 0x93, 0x3d, 0xcc, 0x74, 0x9f, 0xbd,
-  0x7b, 0xbb, 0xfb, 0xbc, 0x25, 0x2d, 0x28, 0x3d, 0xad, 0x6a, 0x87, 0x3d,
-  0x67, 0x73, 0xa0, 0x3d, 0xfe, 0x74, 0x83, 0x3c, 0xe5, 0xfd, 0x68, 0xbd,
-  0x87, 0xd4, 0x81, 0x3d, 0xf7, 0xcc, 0x79, 0xbd, 0x75, 0x50, 0x04, 0xbe,
-  0xcc, 0xea, 0x0c, 0xbe, 0x57, 0x29, 0x1b, 0xbe, 0xea, 0x63, 0x83, 0xbd,
-  0x62, 0x66, 0xe8, 0x3d, 0x1a, 0x80, 0x1d, 0xbe, 0xf2, 0x7b, 0x1e, 0xbe,
-  0x7b, 0x69, 0x13, 0x3e, 0xa0, 0x4f, 0x6e, 0xbe, 0x90, 0x5e, 0x6a, 0xbe,
-  0x35, 0xcd, 0x0c, 0xbe, 0xcf, 0x9d, 0x9a, 0xbe, 0xaf, 0x45, 0x00, 0x3d,
-  0x4b, 0xc6, 0x66, 0xbe, 0xe6, 0x90, 0x87, 0xbe, 0x00, 0x34, 0x21, 0x3e,
-  0x50, 0x9a, 0x64, 0x3d, 0x63, 0xce, 0xe9, 0x3d, 0xc4, 0xbb, 0x1d, 0x3e,
-  0xe4, 0xf6, 0x10, 0x3e, 0x15, 0x4d, 0xea, 0x3d, 0xf8, 0xd6, 0x33, 0x3e,
-  0xbe, 0x3c, 0x97, 0x3d, 0x16, 0x69, 0x1e, 0x3e, 0xa1, 0x2b, 0xd6, 0x3c,
-  0xd4, 0x2c, 0x85, 0x3d, 0x42, 0x26, 0xdf, 0x3c, 0x51, 0x18, 0xa8, 0x3d,
-  0xa6, 0x8a, 0x02, 0x3e, 0x79, 0x89, 0x88, 0xbb, 0xea, 0x30, 0xab, 0x3d,
-  0xd2, 0xf7, 0xb7, 0x3d, 0xd8, 0xe8, 0xa2, 0xbb, 0x79, 0xd7, 0x37, 0x3d,
-  0xcc, 0x96, 0x13, 0x3c, 0x5e, 0x99, 0x0c, 0xbd, 0xfd, 0x7e, 0x96, 0x3c,
-  0x7a, 0xc4, 0x76, 0x3c, 0x21, 0x08, 0x5e, 0xbd, 0x57, 0x8a, 0xba, 0x3c,
-  0x5f, 0x6f, 0x9d, 0xbd, 0xea, 0xb4, 0xbb, 0xbb, 0x87, 0xad, 0x2f, 0xbc,
-  0xcc, 0xbe, 0x10, 0x3e, 0x6b, 0x95, 0x0b, 0x3e, 0x39, 0x71, 0xa5, 0x3c,
-  0x99, 0x3b, 0x28, 0xbd, 0xc5, 0x28, 0x2c, 0xbd, 0xbe, 0xf0, 0x26, 0xbe,
-  0x3c, 0xb0, 0x96, 0xbb, 0x89, 0xb3, 0x46, 0xbb, 0xd7, 0x60, 0xea, 0x3d,
-  0x60, 0x72, 0x98, 0x3d, 0x16, 0x9a, 0x2f, 0xbd, 0xe1, 0xab, 0x09, 0x3c,
-  0xf2, 0xb3, 0x34, 0xbe, 0xe6, 0x42, 0x84, 0xbe, 0x04, 0x4e, 0x02, 0xbe,
-  0xdf, 0xe1, 0x78, 0xbe, 0xae, 0xdd, 0xe8, 0xbd, 0x23, 0x29, 0x18, 0x3c,
-  0x4e, 0x5d, 0x77, 0xbe, 0x45, 0xe4, 0x89, 0xbe, 0x50, 0xb2, 0x4b, 0xbe,
-  0x9c, 0x8f, 0x7c, 0xbe, 0xa0, 0x14, 0xc0, 0xbd, 0xe7, 0xda, 0xc1, 0xbd,
-  0x62, 0x97, 0xa1, 0xbe, 0xeb, 0xe8, 0xde, 0xbd, 0x95, 0x31, 0x19, 0xbe,
-  0x2f, 0xd8, 0xe2, 0xbd, 0xb7, 0x59, 0x25, 0xbe, 0x0d, 0x4d, 0xab, 0xbd,
-  0x8d, 0xe8, 0x95, 0x3c, 0x16, 0x56, 0xb0, 0x3d, 0x63, 0xe0, 0x50, 0xbd,
-  0xf8, 0xa2, 0xd4, 0x3d, 0x1c, 0x5d, 0xa2, 0x3d, 0x8c, 0x00, 0x81, 0x3d,
-  0x1b, 0xa9, 0x1c, 0xbd, 0x45, 0x82, 0x0e, 0x3d, 0xae, 0x36, 0xcc, 0x3d,
-  0x90, 0x7b, 0xc4, 0x3d, 0x6a, 0xe6, 0xb6, 0x3d, 0x7d, 0x7d, 0xd0, 0x3d,
-  0x95, 0x34, 0x9f, 0x3d, 0xb8, 0xac, 0xa4, 0x3d, 0xe5, 0xb5, 0x3b, 0x3e,
-  0xc8, 0x34, 0xc4, 0x3c, 0x47, 0xe5, 0x8e, 0x3d, 0x57, 0xc7, 0x92, 0x3d,
-  0x45, 0xa5, 0xc8, 0x3c, 0x1c, 0x56, 0xd8, 0xbb, 0x5f, 0xa3, 0x6e, 0x3d,
-  0x44, 0x30, 0x85, 0x3d, 0x82, 0x8a, 0x8d, 0x3d, 0xf6, 0xdf, 0x74, 0x3d,
-  0xba, 0x6f, 0x43, 0x3d, 0x82, 0x5a, 0x1b, 0x3d, 0x81, 0x10, 0xc0, 0xbb,
-  0x46, 0x2f, 0x02, 0xbc, 0x81, 0x51, 0x7f, 0xbd, 0xd2, 0x19, 0xd1, 0x3c,
-  0x6b, 0xaa, 0x68, 0x3c, 0x82, 0xad, 0x23, 0xbd, 0x82, 0xcf, 0x06, 0xbc,
-  0xd0, 0x13, 0x25, 0xbe, 0x0a, 0xd7, 0x42, 0xbe, 0xd3, 0xba, 0x0e, 0x3c,
-  0xff, 0xae, 0xe2, 0xbd, 0x95, 0xe6, 0x2c, 0xbe, 0xe5, 0xc6, 0x00, 0x3d,
-  0x0c, 0x54, 0x79, 0xbd, 0xb9, 0x11, 0x4c, 0xbe, 0xe3, 0x06, 0x0b, 0xbe,
-  0xb2, 0x29, 0x95, 0xbd, 0x55, 0x60, 0xd6, 0x3d, 0xca, 0x13, 0xa2, 0xbd,
-  0x8d, 0xd0, 0x06, 0xbe, 0x81, 0x27, 0xb6, 0x3d, 0x4d, 0x5e, 0x23, 0x3d,
-  0xd3, 0x27, 0xb9, 0x3d, 0xbf, 0xb6, 0x16, 0x3e, 0xcc, 0x50, 0x9c, 0x3d,
-  0x6a, 0x9b, 0x46, 0x3e, 0xae, 0xc8, 0x86, 0x3d, 0x5b, 0x60, 0xb1, 0x3d,
-  0xb5, 0xe5, 0xc1, 0x3d, 0xbb, 0x89, 0xe7, 0xbd, 0x45, 0x1e, 0xc3, 0x3c,
-  0xc6, 0x66, 0x11, 0xbd, 0xb5, 0xb6, 0x52, 0x3d, 0xef, 0x46, 0x8e, 0x3c,
-  0x51, 0x07, 0x7e, 0xbd, 0xfc, 0x77, 0x36, 0xbc, 0xf4, 0xde, 0x0a, 0x3b,
-  0xec, 0x49, 0x14, 0xbe, 0x10, 0x1f, 0x23, 0xbd, 0xb0, 0x48, 0xa8, 0xbd,
-  0x67, 0x33, 0x3d, 0xbd, 0x86, 0x4c, 0xa2, 0xbc, 0x2c, 0x3a, 0x2c, 0xbd,
-  0x99, 0x7c, 0x0a, 0x3d, 0x57, 0xbf, 0xcd, 0x3c, 0xe6, 0x9f, 0x06, 0xbe,
-  0x27, 0xf0, 0x57, 0xbd, 0x0b, 0x7e, 0xca, 0x3d, 0x30, 0xb7, 0xfb, 0x3b,
-  0x03, 0xc1, 0xe4, 0x3c, 0x89, 0x8e, 0x68, 0x3d, 0xe7, 0xbd, 0x8a, 0x3c,
-  0x5f, 0x45, 0x35, 0xbb, 0x48, 0x25, 0x1e, 0xbe, 0x70, 0xa5, 0x38, 0xbc,
-  0xe4, 0x3a, 0x96, 0xbc, 0x40, 0xe8, 0x7d, 0x3d, 0xbf, 0x21, 0xd3, 0x3c,
-  0x0d, 0x62, 0x35, 0xbc, 0xc8, 0xc2, 0x51, 0xbd, 0x94, 0x7d, 0x8c, 0xbd,
-  0xca, 0xeb, 0x47, 0xbe, 0xb2, 0xc2, 0x0d, 0xbe, 0x85, 0x6c, 0x64, 0xbe,
-  0x59, 0x1d, 0x8b, 0xbe, 0xbc, 0xbc, 0xaf, 0xbe, 0x34, 0xef, 0x1c, 0xbe,
-  0x4c, 0x44, 0x83, 0xbe, 0x55, 0x7c, 0xd5, 0xbd, 0x0a, 0x80, 0xff, 0xbd,
-  0x71, 0xdd, 0x0f, 0xbe, 0xde, 0x50, 0x19, 0xbc, 0x13, 0x0c, 0x99, 0xbe,
-  0x26, 0xd4, 0xfa, 0xbe, 0x5d, 0xfb, 0x1e, 0xbe, 0xcc, 0x1f, 0x27, 0xbe,
-  0x69, 0x22, 0x11, 0xbe, 0x7e, 0x34, 0xa4, 0xbd, 0x8e, 0xd1, 0x3b, 0x3d,
-  0xa1, 0x52, 0x46, 0x3d, 0x4a, 0xd1, 0x7b, 0xbd, 0x42, 0x40, 0x46, 0xbd,
-  0x68, 0xcc, 0xa4, 0xbc, 0x56, 0xa1, 0x18, 0x3d, 0x62, 0x8f, 0x96, 0x3d,
-  0x18, 0x7f, 0xa5, 0x3d, 0xbd, 0xd7, 0x06, 0x3e, 0x37, 0x71, 0x99, 0x3d,
-  0x7f, 0x26, 0x2b, 0x3d, 0x04, 0x59, 0x4f, 0x3e, 0xa5, 0x82, 0x5a, 0x3d,
-  0xb3, 0xec, 0xf7, 0x3d, 0x80, 0x39, 0x7f, 0x3d, 0x33, 0xec, 0x2f, 0x3e,
-  0xbe, 0x98, 0xae, 0x3d, 0x71, 0x5d, 0xdd, 0x3c, 0x75, 0x30, 0xf0, 0x3d,
-  0xda, 0xbd, 0xb6, 0x3d, 0x00, 0x43, 0x93, 0x3d, 0x30, 0x2e, 0x8a, 0x3d,
-  0xf8, 0xc3, 0x4f, 0xbc, 0xb6, 0xe8, 0x76, 0x3d, 0xa6, 0x69, 0xb6, 0x3d,
-  0x7a, 0x8a, 0x4a, 0xbd, 0xf2, 0xeb, 0x23, 0xbc, 0xdc, 0x37, 0xbd, 0x3d,
-  0xfb, 0x46, 0x8b, 0x3d, 0x6e, 0x83, 0xe7, 0x3b, 0xf1, 0xb1, 0xf1, 0xbd,
-  0xaf, 0xa7, 0x95, 0xbd, 0x6d, 0xbd, 0x77, 0xbd, 0xd5, 0x6e, 0x41, 0xbe,
-  0x09, 0x28, 0x3d, 0xbc, 0x76, 0x12, 0x64, 0x3d, 0x7a, 0x6a, 0xae, 0xbd,
-  0x27, 0x75, 0x48, 0xbe, 0x06, 0x53, 0x6d, 0xbc, 0xbe, 0x27, 0x8a, 0xbe,
-  0x2d, 0xd2, 0xa1, 0xbd, 0x4e, 0xae, 0x52, 0xbe, 0x9f, 0xa7, 0xa0, 0xbe,
-  0x22, 0xbd, 0x0b, 0x3e, 0x18, 0xc8, 0x70, 0xbe, 0x01, 0x77, 0x9e, 0xbe,
-  0x33, 0xc2, 0xa7, 0x3d, 0x7f, 0xdb, 0x05, 0xbe, 0x9b, 0xd5, 0x98, 0xbd,
-  0x87, 0xc6, 0x2e, 0xbd, 0x8e, 0x7a, 0x12, 0xbd, 0xc5, 0x93, 0x68, 0x3d,
-  0x31, 0x9d, 0xce, 0xbc, 0x12, 0xa6, 0x23, 0xbc, 0xf9, 0xb6, 0x97, 0x3d,
-  0xa2, 0x92, 0x41, 0xbd, 0x3e, 0x0c, 0x6b, 0xbc, 0x82, 0x7a, 0xd5, 0x3c,
-  0xd8, 0xf5, 0x7a, 0xbd, 0x9f, 0x2c, 0x31, 0x3c, 0xba, 0xf8, 0x64, 0xbd,
-  0x53, 0xa2, 0xb4, 0x3b, 0x09, 0xa3, 0xa5, 0xbc, 0x2b, 0x70, 0x38, 0xbe,
-  0xcd, 0xfb, 0xda, 0xbc, 0x8f, 0x31, 0x71, 0xbc, 0xd6, 0x14, 0xed, 0xbc,
-  0x79, 0x0c, 0x8f, 0x3c, 0xe1, 0xaf, 0x86, 0xbc, 0x73, 0x79, 0xae, 0xbd,
-  0x47, 0x4d, 0xca, 0xbd, 0x4b, 0x5d, 0xfd, 0xbd, 0x63, 0x00, 0x6b, 0xbd,
-  0x3e, 0xd3, 0x86, 0x3c, 0xd4, 0xf4, 0xf3, 0x3a, 0x84, 0x2b, 0x91, 0x3d,
-  0xa9, 0xc0, 0x7f, 0xbd, 0xc1, 0x1e, 0xb2, 0xbc, 0x20, 0xaf, 0xe3, 0x3c,
-  0x70, 0x40, 0x37, 0xbe, 0xf9, 0x7f, 0xa7, 0xbd, 0xc8, 0xb3, 0xd7, 0xbd,
-  0xf7, 0xf3, 0xc7, 0xbd, 0x89, 0x14, 0x0d, 0xbe, 0x23, 0x05, 0x2d, 0xbd,
-  0x02, 0xa3, 0x4a, 0xbe, 0x37, 0xaa, 0x93, 0xbd, 0x55, 0x48, 0x93, 0xbd,
-  0xb1, 0x72, 0x23, 0xbe, 0x49, 0x3a, 0xbe, 0xbd, 0xbf, 0xc6, 0x09, 0xbe,
-  0x05, 0x1b, 0xa5, 0xbe, 0xe4, 0xe1, 0x3f, 0xbe, 0x02, 0xe4, 0xf0, 0xbd,
-  0x5c, 0x9b, 0x6f, 0xbe, 0xaa, 0x7b, 0x2a, 0xbd, 0xc4, 0x9d, 0x47, 0xbd,
-  0x99, 0x25, 0x92, 0x3d, 0x37, 0x5c, 0xf7, 0xbd, 0xa7, 0xfb, 0x80, 0xbe,
-  0x79, 0x55, 0x8b, 0xbd, 0x0c, 0xcd, 0x29, 0xbc, 0xe5, 0xef, 0x73, 0xbe,
-  0xf3, 0x81, 0x6f, 0xbc, 0xc5, 0x81, 0x57, 0x3d, 0xb9, 0x7e, 0x98, 0x3d,
-  0xd3, 0x51, 0x8d, 0x3c, 0xef, 0x99, 0x51, 0xbe, 0x02, 0x02, 0x85, 0x3c,
-  0x33, 0x4a, 0xaa, 0xbd, 0x40, 0x4f, 0x7b, 0xbd, 0x14, 0xb5, 0x94, 0x3b,
-  0xc9, 0xe6, 0x10, 0x3d, 0xa6, 0x62, 0x08, 0x3d, 0x55, 0x51, 0x9f, 0x3d,
-  0x6f, 0x88, 0x84, 0x3d, 0x98, 0x45, 0xa4, 0x3d, 0x45, 0x89, 0xa1, 0x3d,
-  0xf8, 0xf4, 0x78, 0x3d, 0x17, 0x8b, 0x89, 0x3b, 0x40, 0xb6, 0x79, 0x3d,
-  0x08, 0xb7, 0x67, 0x3b, 0x25, 0x9e, 0x2a, 0x3d, 0x53, 0x1e, 0x18, 0x3e,
-  0xfd, 0x08, 0x6f, 0x3c, 0x3d, 0x3c, 0x7c, 0x3c, 0xed, 0x2c, 0x5f, 0xbb,
-  0xc4, 0x8c, 0xf5, 0xbd, 0x98, 0x4d, 0x51, 0xbd, 0xfb, 0x1d, 0xe3, 0xbc,
-  0x45, 0x2d, 0x28, 0x3c, 0x15, 0x39, 0x10, 0x3d, 0x14, 0x79, 0xb3, 0xbd,
-  0x0e, 0x2d, 0x5a, 0xbc, 0x58, 0x51, 0xa2, 0xbd, 0x4e, 0x0a, 0xe0, 0xbd,
-  0x81, 0x62, 0xc4, 0xbd, 0xe1, 0xfe, 0x2e, 0xbe, 0x26, 0x40, 0xa5, 0xbd,
-  0xea, 0xbd, 0xdc, 0x3d, 0xb3, 0xc9, 0xee, 0xbd, 0x4c, 0x0a, 0xb9, 0xbd,
-  0x38, 0xbe, 0x61, 0x3d, 0xc3, 0x08, 0x9e, 0xbd, 0x39, 0x5e, 0xd0, 0xbd,
-  0xb1, 0x78, 0x1e, 0xbe, 0xf8, 0x24, 0x4e, 0xbe, 0x7d, 0x01, 0x5d, 0x3c,
-  0x9c, 0x44, 0x35, 0xbd, 0x9d, 0xae, 0x97, 0xbd, 0xf3, 0x0b, 0xac, 0x3d,
-  0xa0, 0xe9, 0x24, 0xbe, 0xf8, 0x66, 0x9c, 0xbd, 0xa6, 0xbf, 0xb2, 0xbd,
-  0xd1, 0x53, 0x3d, 0x3d, 0xa7, 0x1a, 0xca, 0x3d, 0x9d, 0x21, 0x94, 0xbb,
-  0x60, 0xa4, 0xb6, 0xbd, 0x4f, 0x0f, 0xa2, 0x3d, 0x90, 0x3d, 0x29, 0xbe,
-  0xbd, 0x4f, 0x08, 0xbe, 0x58, 0x58, 0x9c, 0xbd, 0xc5, 0x8f, 0xab, 0x3c,
-  0xc9, 0x73, 0xd5, 0x3d, 0xc3, 0x16, 0xc9, 0x3a, 0xa9, 0x13, 0xbf, 0xbc,
-  0x1e, 0x62, 0x0a, 0xbd, 0xaf, 0xa6, 0x13, 0xbe, 0xed, 0xca, 0x12, 0xbd,
-  0xc2, 0xca, 0x2b, 0xbe, 0xd3, 0xbc, 0x91, 0xbd, 0xc1, 0xd1, 0x86, 0x3d,
-  0x3c, 0x24, 0x16, 0xbe, 0xbc, 0x11, 0x50, 0xbd, 0x05, 0xc3, 0x94, 0xbd,
-  0xcc, 0x5e, 0x12, 0xbe, 0xe1, 0x5b, 0xa7, 0xbd, 0xb0, 0x58, 0x45, 0xbd,
-  0x7b, 0x40, 0xb9, 0xbd, 0xf4, 0x59, 0x82, 0x3a, 0xb2, 0x21, 0xef, 0xbd,
-  0xef, 0x9e, 0xf0, 0xbd, 0xb2, 0x84, 0xb7, 0xbd, 0x80, 0x35, 0xa8, 0xbd,
-  0x02, 0x4f, 0xa5, 0xbd, 0x76, 0x3d, 0xf0, 0xbc, 0x7a, 0x97, 0x25, 0xbe,
-  0xad, 0x00, 0xcd, 0xbd, 0xa3, 0x4e, 0xb2, 0xbd, 0x58, 0x20, 0xc6, 0xbd,
-  0xf4, 0x14, 0x23, 0xbe, 0xa9, 0xb0, 0xc9, 0xbd, 0xbf, 0x6a, 0x34, 0xbd,
-  0xe8, 0x2f, 0x45, 0xbc, 0x2c, 0xdd, 0xb6, 0xbd, 0x8a, 0x68, 0x85, 0xbe,
-  0x22, 0xf4, 0x7b, 0xbd, 0xac, 0x69, 0xa3, 0xbd, 0xe5, 0x86, 0x85, 0xbe,
-  0xcd, 0x44, 0x18, 0xbc, 0x17, 0x02, 0x71, 0xbd, 0x12, 0x65, 0xbd, 0xbc,
-  0xf1, 0x1c, 0xb0, 0x3c, 0xf8, 0x8c, 0x2b, 0xbe, 0xf5, 0xa7, 0x8f, 0xbc,
-  0xfc, 0x42, 0xce, 0x3c, 0x65, 0x47, 0x72, 0xbe, 0xbc, 0x49, 0x34, 0xbd,
-  0x8d, 0x67, 0x96, 0xbb, 0x0c, 0xb4, 0xa2, 0xbd, 0x0c, 0x64, 0x21, 0xbd,
-  0x93, 0x0d, 0x09, 0xbe, 0x9e, 0xa5, 0x39, 0x3c, 0x4a, 0x61, 0xb4, 0xbc,
-  0x59, 0x96, 0x67, 0xbe, 0xf4, 0x82, 0x64, 0xbd, 0xbf, 0x6f, 0x64, 0xbd,
-  0x3f, 0xcc, 0x3e, 0xbd, 0x4d, 0x91, 0x83, 0xbd, 0x21, 0x0b, 0x2d, 0x3d,
-  0x04, 0x07, 0x95, 0xbc, 0x58, 0x1e, 0x0d, 0xbd, 0x4a, 0x43, 0xe2, 0xbd,
-  0x2e, 0xf6, 0xce, 0xbc, 0xd3, 0xdc, 0x0c, 0xbd, 0xab, 0x6b, 0xdb, 0xbd,
-  0xba, 0xfc, 0x8d, 0xbc, 0x46, 0xfa, 0x08, 0x3e, 0x91, 0x08, 0x8b, 0xbc,
-  0xe1, 0x94, 0xdd, 0xbd, 0x1c, 0xf3, 0x0f, 0xbe, 0xd7, 0xbb, 0xc9, 0xbd,
-  0x9a, 0x70, 0xca, 0xbd, 0xc2, 0x1e, 0x5a, 0xbe, 0xb2, 0x75, 0xe7, 0xbc,
-  0xd2, 0xeb, 0x8f, 0x3d, 0xa9, 0x9e, 0xdb, 0xbd, 0xa6, 0x75, 0x3c, 0xbe,
-  0x64, 0x0b, 0x54, 0xbd, 0x0c, 0xd8, 0x6e, 0xbe, 0x68, 0xc5, 0x53, 0xbe,
-  0x97, 0x43, 0x7f, 0xbe, 0x9c, 0x2e, 0x2c, 0xbe, 0x42, 0x1d, 0x1a, 0xbb,
-  0x69, 0x8a, 0x9c, 0xbe, 0x89, 0xe7, 0x4b, 0xbe, 0x4a, 0x1f, 0xc9, 0x3d,
-  0xab, 0xe4, 0x37, 0xbe, 0x71, 0x41, 0x22, 0xbd, 0x61, 0xfd, 0x22, 0xbd,
-  0xdb, 0xab, 0x73, 0xbd, 0x93, 0xaa, 0x19, 0x3e, 0x8d, 0xa9, 0xaa, 0xbd,
-  0x48, 0x64, 0xe3, 0xbd, 0x4f, 0xa9, 0x06, 0x3d, 0xaf, 0xf2, 0x13, 0xbe,
-  0xda, 0x3c, 0x37, 0xbe, 0xc8, 0x6b, 0x69, 0xbe, 0xae, 0x63, 0x89, 0xbe,
-  0x78, 0x14, 0x03, 0x3e, 0x31, 0xde, 0x51, 0xbe, 0xbb, 0xb6, 0xa3, 0xbe,
-  0x8b, 0xee, 0x26, 0x3d, 0x54, 0x55, 0x31, 0xbd, 0x6d, 0xe9, 0xe0, 0xbd,
-  0x32, 0x48, 0xb6, 0xbd, 0x21, 0xe1, 0x40, 0xbe, 0xf6, 0x24, 0x07, 0x3d,
-  0xae, 0xaf, 0x0e, 0xbe, 0x6b, 0x6f, 0xbd, 0xbd, 0x9c, 0x37, 0x0a, 0x3e,
-  0x17, 0xd4, 0x52, 0x3d, 0xd8, 0x9c, 0x98, 0xbd, 0x3c, 0x59, 0xb4, 0xbd,
-  0xf3, 0xf5, 0x4c, 0xbe, 0x7f, 0x0b, 0x57, 0xbd, 0x0e, 0xe4, 0xb0, 0xbd,
-  0x5a, 0x4e, 0xfa, 0xba, 0x4a, 0x36, 0x92, 0x3c, 0xb7, 0x54, 0x31, 0xbd,
-  0xff, 0x59, 0xf2, 0xbd, 0xb3, 0xc0, 0x6e, 0xbd, 0xbd, 0x64, 0x45, 0xbd,
-  0x2f, 0x14, 0xdf, 0xbd, 0x35, 0x45, 0x96, 0x3c, 0x4b, 0x6a, 0x49, 0xbd,
-  0xf7, 0xe6, 0x61, 0xbd, 0x0d, 0xe9, 0xb0, 0xbd, 0x65, 0x73, 0x21, 0xbd,
-  0xfa, 0xb0, 0xb0, 0xbc, 0x68, 0x2c, 0xf9, 0xbd, 0x33, 0x4f, 0x4f, 0xbe,
-  0xc0, 0x31, 0x8e, 0xbd, 0x4a, 0xdd, 0x90, 0xbd, 0x86, 0xb3, 0x38, 0xbe,
-  0x18, 0xc6, 0xa2, 0xbd, 0x37, 0x43, 0x2c, 0xbd, 0x93, 0xfe, 0x22, 0x3c,
-  0x5b, 0x0c, 0x71, 0xbd, 0xfc, 0x43, 0x96, 0xbe, 0x2b, 0xc4, 0x91, 0x3d,
-  0x21, 0xcd, 0x57, 0x3d, 0x29, 0xb7, 0xa3, 0xbe, 0x97, 0xc4, 0xb9, 0xbd,
-  0x51, 0x4c, 0x72, 0xbd, 0x1a, 0x01, 0x0d, 0xbc, 0x5a, 0xcb, 0xdf, 0xbd,
-  0x25, 0xc5, 0x44, 0xbe, 0x13, 0x5b, 0x75, 0x3d, 0x6a, 0xdd, 0xc4, 0xbd,
-  0x87, 0x3e, 0x79, 0xbe, 0xf7, 0x4e, 0x9a, 0xbd, 0x19, 0xdf, 0x09, 0xbd,
-  0xa7, 0xba, 0xb6, 0xbd, 0x88, 0x3f, 0x1e, 0xbe, 0x40, 0xd6, 0x75, 0xbe,
-  0x1c, 0x76, 0xbd, 0xbd, 0xf1, 0x8d, 0xc4, 0xbc, 0xda, 0xfb, 0x84, 0xbe,
-  0x25, 0x8e, 0xbe, 0xbd, 0x5a, 0xe1, 0x16, 0xbd, 0x07, 0x41, 0x19, 0xbc,
-  0x3e, 0xfb, 0xf5, 0xbd, 0x6d, 0x8f, 0x22, 0xbe, 0xd7, 0x33, 0xf8, 0xbd,
-  0xcb, 0xd6, 0xd8, 0xbd, 0x21, 0x29, 0x97, 0xbe, 0x36, 0x5a, 0xfa, 0xbd,
-  0x74, 0x82, 0xf1, 0xbd, 0x5d, 0x90, 0x51, 0xbe, 0x29, 0x62, 0xda, 0xbd,
-  0x17, 0xcb, 0xb9, 0xbd, 0xf7, 0xd3, 0x17, 0xbe, 0x87, 0x29, 0xf2, 0xbd,
-  0x26, 0x05, 0xa0, 0xbc, 0xab, 0xc4, 0x41, 0xbe, 0x4d, 0xfd, 0x5f, 0xbe,
-  0x93, 0x00, 0x8a, 0xbe, 0xcf, 0x28, 0x59, 0xbe, 0xf8, 0x05, 0x7e, 0xbc,
-  0x07, 0x4c, 0x7c, 0xbe, 0x62, 0x50, 0x73, 0xbe, 0x79, 0xef, 0x89, 0xbd,
-  0x1c, 0x3f, 0x71, 0xbe, 0x40, 0xd6, 0x7b, 0xbe, 0xbe, 0x16, 0x8d, 0xbe,
-  0x57, 0xfc, 0x1d, 0xbe, 0xbd, 0x33, 0x45, 0x3d, 0x3f, 0xd6, 0x8a, 0xbe,
-  0xed, 0x2f, 0x5f, 0xbe, 0x84, 0x93, 0xa7, 0x3d, 0xd0, 0xff, 0x99, 0xbd,
-  0xed, 0xd7, 0xd1, 0xbd, 0x75, 0xc9, 0x11, 0xbe, 0xa0, 0x59, 0xbb, 0xbc,
-  0x20, 0xec, 0x4b, 0x3d, 0x87, 0x85, 0x92, 0xbd, 0x30, 0x90, 0x11, 0xbe,
-  0xc4, 0xe5, 0x28, 0x3d, 0xf8, 0xb6, 0x11, 0xbd, 0x96, 0x34, 0x62, 0xbe,
-  0xaf, 0x2c, 0xd7, 0xbd, 0xb3, 0xa0, 0x54, 0xbe, 0xf9, 0x07, 0xbb, 0x3d,
-  0x3b, 0x4e, 0x14, 0xbe, 0x42, 0x44, 0x26, 0xbe, 0xae, 0x01, 0xfc, 0x3d,
-  0xf5, 0x20, 0x62, 0x3c, 0xd6, 0xa9, 0x29, 0x3d, 0x06, 0x2d, 0xc5, 0x3d,
-  0x73, 0xa6, 0xab, 0xbd, 0xeb, 0x05, 0x3d, 0x3d, 0x6e, 0x1c, 0xa5, 0x3d,
-  0xa9, 0x14, 0x16, 0x3d, 0x33, 0x81, 0x7c, 0x3d, 0x17, 0x45, 0xb8, 0x3d,
-  0xb1, 0xb1, 0xa0, 0x3d, 0x8a, 0x4a, 0xc7, 0x3d, 0x89, 0x69, 0x9c, 0x3d,
-  0x5a, 0xf1, 0x01, 0xbd, 0x06, 0x6e, 0x12, 0x3d, 0xb9, 0xb9, 0x4b, 0x3c,
-  0xeb, 0xfd, 0x44, 0x3c, 0x27, 0x9a, 0x84, 0x3d, 0x86, 0x65, 0x79, 0xbd,
-  0x86, 0x06, 0x38, 0xbb, 0xb1, 0x85, 0xcf, 0xbd, 0x21, 0x9e, 0x27, 0xbe,
-  0x2b, 0x6a, 0x4f, 0x3d, 0x55, 0x16, 0x21, 0x3b, 0xe4, 0x2f, 0x03, 0xbe,
-  0xac, 0x3a, 0xb4, 0x3c, 0xe5, 0x86, 0x0e, 0x3d, 0x53, 0x62, 0xd7, 0xbc,
-  0x01, 0x2b, 0x1a, 0xbd, 0x37, 0x79, 0x92, 0xbe, 0x43, 0x7e, 0xdb, 0xba,
-  0x1f, 0xf1, 0xf1, 0xbc, 0x86, 0x34, 0x94, 0xbe, 0xfa, 0x4a, 0xfa, 0xbb,
-  0x85, 0x1f, 0x82, 0xbc, 0xe9, 0x4f, 0xa3, 0xbc, 0x69, 0xee, 0x19, 0xbe,
-  0x7d, 0x6f, 0x9e, 0xbe, 0x34, 0x74, 0x3f, 0xbd, 0x50, 0x58, 0x8a, 0xbc,
-  0x81, 0x8f, 0xab, 0xbe, 0x0a, 0x60, 0x5b, 0x3c, 0x70, 0xe8, 0x42, 0xbc,
-  0x5d, 0x93, 0x54, 0x3d, 0xef, 0x92, 0xd3, 0xbd, 0x86, 0x5f, 0x22, 0xbe,
-  0x5d, 0x0a, 0x7c, 0xbc, 0x8a, 0x12, 0xc0, 0xbc, 0xd8, 0x26, 0x99, 0xbe,
-  0xf1, 0x6e, 0x42, 0xbc, 0x59, 0xe4, 0xfd, 0x3c, 0x15, 0xe5, 0x31, 0x3d,
-  0x64, 0xc7, 0xcf, 0xbc, 0xee, 0x07, 0x19, 0xbe, 0x31, 0xcf, 0x57, 0x3d,
-  0xb2, 0xb3, 0xac, 0xbc, 0xd5, 0x79, 0xb4, 0xbe, 0x80, 0xe2, 0xf8, 0xbb,
-  0x1d, 0x0a, 0x9c, 0xbd, 0xdd, 0x7d, 0x78, 0xbd, 0xc8, 0x30, 0x67, 0xbc,
-  0x8b, 0x6c, 0x13, 0xbe, 0x4b, 0x13, 0xb1, 0xbd, 0x87, 0x41, 0x97, 0xbc,
-  0x12, 0xaf, 0x7b, 0xbd, 0xd9, 0x43, 0xb1, 0xbd, 0x24, 0x67, 0x61, 0xbd,
-  0x25, 0xed, 0x1b, 0xbe, 0xa2, 0x7f, 0x00, 0xbe, 0x48, 0x9e, 0x91, 0xb9,
-  0x2b, 0x8c, 0x28, 0xbe, 0x8d, 0x24, 0x56, 0xbe, 0x20, 0xc6, 0x81, 0x3d,
-  0x38, 0x4d, 0x4b, 0xbe, 0xca, 0xa8, 0x6d, 0xbe, 0xd7, 0xdc, 0x4d, 0xbe,
-  0x49, 0x11, 0x8c, 0xbe, 0xaf, 0x80, 0xe6, 0xbc, 0xdf, 0xe9, 0x27, 0xbe,
-  0x7b, 0x74, 0x16, 0xbe, 0xcd, 0xf6, 0xb4, 0xbc, 0xbc, 0x0d, 0xa2, 0xbe,
-  0x13, 0x78, 0x87, 0xbe, 0x55, 0x7e, 0x8a, 0xbe, 0xb9, 0xd4, 0x9a, 0xbe,
-  0xcf, 0x6b, 0xeb, 0x3d, 0x96, 0x30, 0x90, 0xbe, 0x45, 0xca, 0xc4, 0xbe,
-  0xc1, 0x9c, 0x0f, 0x3e, 0x34, 0x6e, 0x10, 0xbe, 0x3c, 0xec, 0x0d, 0xbe,
-  0xf7, 0x90, 0x45, 0xbe, 0xb5, 0x43, 0x4a, 0xbe, 0xb2, 0xb8, 0x1e, 0x3e,
-  0xa8, 0xeb, 0xe4, 0xbd, 0x9e, 0x55, 0x43, 0xbe, 0x33, 0x8f, 0x1a, 0x3e,
-  0x28, 0xc8, 0x40, 0x3d, 0xff, 0xec, 0xb5, 0x3d, 0x39, 0xd8, 0x24, 0x3d,
-  0x2e, 0x1d, 0x8a, 0xbb, 0x10, 0x4d, 0xf7, 0x3d, 0xba, 0x80, 0x24, 0xbc,
-  0x4e, 0x8b, 0x52, 0x3d, 0x0f, 0x32, 0xc0, 0x3d, 0x7e, 0xf3, 0x7c, 0x3d,
-  0x03, 0xb8, 0x0c, 0x3e, 0x14, 0x21, 0x2a, 0x3d, 0x58, 0x4c, 0x2f, 0x3e,
-  0xa7, 0x18, 0x2c, 0x3e, 0x91, 0xa8, 0x0f, 0x3e, 0x9e, 0x3d, 0xcf, 0x3d,
-  0x30, 0x26, 0xa6, 0xbd, 0xeb, 0x2d, 0x84, 0xbc, 0x4e, 0x4a, 0x11, 0x3e,
-  0x1d, 0x2c, 0x1b, 0x3d, 0xe1, 0xdc, 0x05, 0x3e, 0x9f, 0x77, 0x29, 0x3e,
-  0xbf, 0x1d, 0xa5, 0x3d, 0x09, 0x87, 0xc2, 0x3d, 0xe8, 0xe8, 0xb3, 0x3c,
-  0x21, 0x96, 0xa5, 0x3d, 0xb3, 0xe5, 0xba, 0x3d, 0x19, 0x27, 0x04, 0x3e,
-  0x52, 0x7a, 0x01, 0x3e, 0x36, 0x21, 0x27, 0x3d, 0xc1, 0x95, 0x04, 0x3e,
-  0x10, 0x8a, 0x25, 0x3d, 0xd1, 0x02, 0x61, 0x3d, 0xf5, 0xff, 0x84, 0x3d,
-  0xc2, 0x18, 0x21, 0x3d, 0xb5, 0xd5, 0xad, 0x3d, 0x94, 0xad, 0x10, 0x3d,
-  0x6e, 0x6b, 0x8f, 0xbd, 0xb5, 0xa8, 0xb8, 0x3d, 0x44, 0x8f, 0x81, 0x3d,
-  0x83, 0x87, 0x76, 0xbd, 0x59, 0xac, 0xd6, 0x3d, 0x0f, 0xf5, 0xac, 0x3d,
-  0x70, 0x54, 0x9b, 0x3d, 0x7e, 0xd6, 0xd4, 0x3b, 0xce, 0x72, 0x8c, 0xbd,
-  0x3e, 0x5e, 0x27, 0x3d, 0x8a, 0x44, 0x89, 0x3d, 0xf7, 0x51, 0x7b, 0x3d,
-  0x9c, 0x97, 0x1a, 0x3e, 0xc4, 0x56, 0x64, 0xbb, 0xd1, 0x9c, 0x6b, 0x3d,
-  0xf7, 0x2a, 0x86, 0xbc, 0xb4, 0xc2, 0xf0, 0xbc, 0x2f, 0xdf, 0xd6, 0x3d,
-  0xc1, 0xbb, 0xa7, 0x3d, 0x8c, 0xf6, 0xd0, 0x3c, 0x5e, 0xeb, 0x37, 0x3e,
-  0xb9, 0x60, 0xc3, 0x3d, 0x23, 0x62, 0x2a, 0x3e, 0xbf, 0x6c, 0x76, 0x3c,
-  0x8c, 0x19, 0x58, 0xbd, 0x9e, 0xc1, 0x78, 0x3d, 0x16, 0xe9, 0xa0, 0x3d,
-  0x80, 0xca, 0x92, 0xbc, 0x23, 0x18, 0x2f, 0x3d, 0x23, 0xc2, 0x26, 0x3c,
-  0x06, 0x45, 0x81, 0x3d, 0xdb, 0x74, 0x32, 0x3c, 0x17, 0xe7, 0x17, 0xbe,
-  0x5e, 0xad, 0x94, 0x3c, 0x4e, 0x79, 0x3a, 0x3d, 0xde, 0x20, 0x4b, 0x3d,
-  0xae, 0xeb, 0x0b, 0xbc, 0x74, 0xdc, 0x83, 0xbd, 0x6c, 0x40, 0xbf, 0x3b,
-  0xc5, 0xee, 0x76, 0xbd, 0xf5, 0xcb, 0xf8, 0xbd, 0xef, 0x24, 0x8b, 0xbd,
-  0xb4, 0xaa, 0xc3, 0xbd, 0x0f, 0x5e, 0x29, 0x3e, 0x89, 0xfa, 0xcf, 0xbc,
-  0x88, 0xc5, 0xf6, 0xbd, 0xfd, 0x85, 0x27, 0x3c, 0x61, 0xe1, 0x63, 0xbe,
-  0x6c, 0x5d, 0x95, 0xbd, 0xb8, 0xd5, 0xa5, 0xbc, 0x6e, 0x2e, 0x16, 0xbc,
-  0x60, 0x72, 0xf6, 0x3d, 0x4c, 0x8e, 0x45, 0xbd, 0x48, 0x7d, 0xd4, 0xbd,
-  0xd8, 0x72, 0xaa, 0xbd, 0xc0, 0x23, 0x1f, 0xbe, 0xd0, 0xbe, 0x6f, 0x3d,
-  0xeb, 0xc2, 0x85, 0xbd, 0x40, 0xa4, 0xc0, 0xbd, 0x40, 0x0f, 0x21, 0x3e,
-  0x68, 0x6d, 0xc5, 0xbd, 0x64, 0xf8, 0xbd, 0xbd, 0x73, 0x1e, 0x08, 0x3c,
-  0x9a, 0x22, 0xa6, 0xbd, 0x49, 0x40, 0x53, 0x3d, 0x99, 0xf0, 0xe7, 0x3c,
-  0x44, 0xb3, 0x2b, 0xbe, 0xa7, 0x51, 0xdc, 0xbd, 0xfc, 0xc3, 0x0f, 0xbd,
-  0x49, 0x32, 0x82, 0xbd, 0xbf, 0xa9, 0xa0, 0xbd, 0xfd, 0xc2, 0x2e, 0x3c,
-  0xdb, 0xe7, 0xda, 0xbd, 0x8d, 0x1e, 0x15, 0x39, 0x24, 0xbc, 0x47, 0x3b,
-  0x96, 0x9a, 0x78, 0xbd, 0xc1, 0xe8, 0x61, 0xbd, 0x39, 0xd0, 0xfc, 0xbd,
-  0x92, 0xcc, 0x8a, 0xbd, 0x92, 0xef, 0xe9, 0xbc, 0x55, 0x5e, 0x42, 0xbe,
-  0xff, 0x36, 0x26, 0xbd, 0xff, 0xe2, 0x57, 0x3c, 0xa8, 0x9a, 0xdb, 0xbd,
-  0x9b, 0xb5, 0x01, 0xbe, 0xfc, 0x30, 0x13, 0xbd, 0xb9, 0xca, 0x8f, 0xbd,
-  0x0d, 0xcf, 0x1d, 0x3d, 0xbc, 0x3c, 0x43, 0xbe, 0x1d, 0x6a, 0xff, 0xbb,
-  0x1c, 0xca, 0xa8, 0xbd, 0x64, 0xad, 0x96, 0xbd, 0x88, 0x68, 0x2d, 0xbe,
-  0x5d, 0xbd, 0x2d, 0xbe, 0x71, 0xcc, 0x15, 0xbe, 0xe7, 0x46, 0xf7, 0xbb,
-  0x91, 0xa4, 0x32, 0xbe, 0x50, 0x35, 0x6d, 0xbd, 0x8f, 0xd3, 0xd0, 0xbd,
-  0x67, 0xfb, 0x48, 0xbe, 0x3a, 0xac, 0x30, 0xbe, 0x76, 0x6c, 0x30, 0xbe,
-  0x86, 0x68, 0x23, 0xbe, 0x12, 0x27, 0x1e, 0x3c, 0xa0, 0xd8, 0xc2, 0xbd,
-  0xfd, 0xcd, 0x59, 0xbe, 0x41, 0x55, 0x0d, 0xbe, 0x2d, 0xc3, 0x39, 0xbe,
-  0xc8, 0x11, 0x1b, 0xbe, 0xba, 0x5c, 0x84, 0xbe, 0x69, 0xf5, 0x21, 0xbe,
-  0x2f, 0xee, 0x50, 0xbd, 0x78, 0x0e, 0x0f, 0xbe, 0x17, 0x94, 0x8d, 0xbe,
-  0x04, 0xc1, 0x8b, 0xbe, 0xff, 0xd6, 0x07, 0xbe, 0xb4, 0xdd, 0x22, 0xbe,
-  0xbf, 0x9b, 0xc8, 0xbd, 0x08, 0x4a, 0x1f, 0xbe, 0x01, 0x88, 0xf6, 0xbd,
-  0xe7, 0x24, 0xaf, 0xbd, 0x97, 0x0d, 0x82, 0xbe, 0x43, 0xb6, 0x08, 0xbe,
-  0x6f, 0x48, 0x3d, 0xbe, 0x1d, 0xc1, 0xf0, 0xbd, 0x03, 0xa4, 0x20, 0xbe,
-  0xe6, 0x3a, 0xfc, 0xbd, 0xa5, 0xae, 0x55, 0xbd, 0x0a, 0xe3, 0x18, 0xbe,
-  0x97, 0xc7, 0x3c, 0xbe, 0x5f, 0xdd, 0x25, 0xbe, 0x97, 0xa0, 0x16, 0xbe,
-  0x4c, 0x2f, 0x9b, 0xbd, 0x83, 0x12, 0x6b, 0xbd, 0x42, 0x7e, 0x08, 0xbd,
-  0xfe, 0xff, 0x80, 0xbd, 0x7a, 0xb8, 0xba, 0xbd, 0x2a, 0x4b, 0xa1, 0xbc,
-  0x04, 0x22, 0x96, 0xbd, 0x86, 0x99, 0x84, 0xbd, 0x50, 0x96, 0x92, 0xbd,
-  0x8a, 0x1d, 0x8e, 0xbd, 0xa7, 0x88, 0x82, 0xbb, 0x05, 0x8b, 0x98, 0xbd,
-  0xab, 0x06, 0x9a, 0xbd, 0xb5, 0x37, 0x4a, 0xba, 0x20, 0x60, 0x05, 0xbe,
-  0x60, 0x76, 0xa3, 0xbd, 0xc4, 0x80, 0x67, 0x3c, 0x12, 0x08, 0x9d, 0xbd,
-  0xb7, 0xca, 0xf0, 0xbd, 0xe3, 0x75, 0x9f, 0xbd, 0x39, 0xe8, 0x15, 0xbe,
-  0x53, 0x91, 0x48, 0xbe, 0x7e, 0x51, 0x71, 0x3c, 0x19, 0x6e, 0x5d, 0xbd,
-  0xfd, 0xc8, 0x10, 0xbe, 0xa0, 0x22, 0x0c, 0xbd, 0xb6, 0x0d, 0xd1, 0xbb,
-  0xb8, 0xec, 0xc4, 0xbd, 0x5e, 0x06, 0xe6, 0xbd, 0x95, 0x4c, 0x48, 0xbd,
-  0x7c, 0x23, 0x8d, 0xbd, 0xbf, 0x5e, 0x0c, 0xbe, 0xf2, 0x01, 0xf1, 0xbd,
-  0xf9, 0x7c, 0x45, 0xbd, 0x7b, 0x70, 0x58, 0xbd, 0xaf, 0xc4, 0xab, 0xbc,
-  0x54, 0x4b, 0x0f, 0xbe, 0xa4, 0x54, 0x7a, 0xbd, 0xe6, 0x47, 0xbf, 0xbd,
-  0xa7, 0x24, 0x2b, 0xbe, 0xce, 0x66, 0x01, 0x3d, 0x1e, 0xcb, 0xb9, 0xbb,
-  0xe4, 0x73, 0xaa, 0xbc, 0xd9, 0x6d, 0x93, 0xbd, 0x06, 0x6f, 0x1d, 0xbe,
-  0x6f, 0x95, 0x9b, 0xbd, 0x8b, 0x59, 0x76, 0xbd, 0x75, 0x0c, 0x01, 0xbe,
-  0x3d, 0x95, 0xa2, 0xbd, 0x8d, 0x32, 0x91, 0xbd, 0xb1, 0xdc, 0x26, 0xbe,
-  0xe4, 0x16, 0x82, 0xbd, 0xfc, 0xe4, 0x14, 0xbe, 0x83, 0xfc, 0xd0, 0xbd,
-  0x1a, 0x81, 0xd1, 0xbd, 0x9f, 0xe2, 0x3d, 0xbe, 0x4a, 0x10, 0x05, 0xbc,
-  0x60, 0xc1, 0x6a, 0xbd, 0x9a, 0x0f, 0x95, 0xbd, 0x59, 0x85, 0xd3, 0xbd,
-  0x50, 0x57, 0xd6, 0xbd, 0xbf, 0x15, 0x3e, 0xbe, 0x86, 0xec, 0x06, 0xbd,
-  0x7a, 0x6e, 0x9a, 0xbd, 0xcd, 0x4e, 0xe1, 0x3c, 0x6e, 0xf7, 0xc8, 0xbc,
-  0x14, 0xb9, 0x5d, 0x3d, 0xe1, 0x72, 0x9b, 0xbd, 0xb9, 0x21, 0x53, 0xbe,
-  0x19, 0x55, 0x5c, 0x3d, 0x22, 0xe4, 0x54, 0xbd, 0xfc, 0xb2, 0xbf, 0xbc,
-  0x35, 0x3b, 0x50, 0xbd, 0x2f, 0xda, 0x15, 0xbd, 0xe5, 0x2c, 0xbd, 0x3c,
-  0xf3, 0xa0, 0x85, 0xbd, 0x28, 0x00, 0x32, 0xbe, 0x23, 0x03, 0x24, 0xbd,
-  0xe3, 0x1c, 0xec, 0xbc, 0x23, 0xbb, 0xed, 0x3d, 0xe2, 0xed, 0xd0, 0xba,
-  0xf0, 0xf1, 0x57, 0xbd, 0x52, 0xd4, 0x2f, 0xbd, 0x10, 0x89, 0xa4, 0x3c,
-  0xd1, 0x1e, 0x2d, 0xbe, 0x35, 0xbb, 0x04, 0x3d, 0x1b, 0x61, 0x2e, 0x3d,
-  0x42, 0x11, 0xd2, 0xba, 0x5f, 0x45, 0x52, 0xbc, 0x22, 0xcd, 0x03, 0xbd,
-  0x99, 0x2a, 0x22, 0x3d, 0x56, 0xee, 0x4d, 0x3b, 0x66, 0x10, 0xb5, 0xbd,
-  0x7a, 0xef, 0x7d, 0x3d, 0x1b, 0x0c, 0x7f, 0xbc, 0x2b, 0x4e, 0x92, 0x3d,
-  0xf0, 0x13, 0x20, 0x3d, 0x35, 0xa1, 0x86, 0xbd, 0x27, 0xc1, 0x4e, 0x3d,
-  0x79, 0x42, 0x9a, 0x3d, 0x98, 0x76, 0x52, 0xbe, 0xb2, 0xdf, 0xed, 0x3b,
-  0x92, 0xe1, 0x80, 0xbd, 0xc3, 0x1b, 0x0a, 0x3b, 0x53, 0x28, 0x78, 0x3d,
-  0x58, 0x15, 0x24, 0xbc, 0x69, 0xef, 0x53, 0xbd, 0x99, 0x47, 0xb8, 0x3c,
-  0xe4, 0x9c, 0x66, 0xbd, 0x54, 0x8e, 0x02, 0x3c, 0xb6, 0xfb, 0x8d, 0xbd,
-  0xe9, 0x02, 0x96, 0x3a, 0x9f, 0x32, 0x29, 0xbd, 0x06, 0xd8, 0x06, 0x3c,
-  0x35, 0xff, 0x9b, 0xbd, 0x7d, 0x81, 0x0d, 0x3d, 0x31, 0x23, 0xde, 0xbd,
-  0x28, 0x16, 0x8a, 0xbd, 0x75, 0x16, 0x10, 0xbd, 0x9d, 0xbd, 0x4c, 0x3c,
-  0x70, 0x35, 0x15, 0xbc, 0x08, 0x12, 0x1e, 0xbd, 0x48, 0xb3, 0x0e, 0x3d,
-  0xdd, 0xad, 0x3f, 0xbd, 0xbc, 0x08, 0xef, 0xbd, 0x58, 0x81, 0xc1, 0xbc,
-  0xba, 0x7d, 0x5d, 0xbd, 0xce, 0x58, 0x0c, 0xbe, 0x33, 0x94, 0xc3, 0x3b,
-  0xf3, 0x30, 0xb7, 0xbd, 0x2c, 0xcf, 0xde, 0xbd, 0x61, 0x0a, 0x61, 0x3d,
-  0x1e, 0x00, 0x81, 0xbd, 0xbb, 0xae, 0xd8, 0xbd, 0xcd, 0x57, 0x65, 0xbc,
-  0x93, 0xa8, 0x9e, 0xbb, 0x20, 0x0b, 0x92, 0x3d, 0xc2, 0xab, 0x33, 0xbd,
-  0xac, 0x71, 0x54, 0xbd, 0x5c, 0xdc, 0x39, 0xbd, 0x8d, 0xc1, 0x20, 0xbe,
-  0x57, 0x74, 0x13, 0x3d, 0x7c, 0xe9, 0xc7, 0x3d, 0x99, 0x3d, 0x1b, 0xbe,
-  0xe6, 0xbc, 0x46, 0xbd, 0x4f, 0x38, 0x38, 0xbd, 0x02, 0x76, 0x8f, 0xbd,
-  0x60, 0x79, 0x1b, 0xbd, 0x47, 0x02, 0x4b, 0xbe, 0x5e, 0xec, 0x46, 0xbd,
-  0x36, 0xc7, 0x9e, 0xbd, 0x22, 0xe9, 0xc4, 0xbd, 0x0a, 0xcc, 0xba, 0xbd,
-  0xb4, 0x7c, 0x37, 0xbe, 0x8f, 0x65, 0x0c, 0xbe, 0x0d, 0x16, 0xc8, 0xbd,
-  0x17, 0x34, 0xe3, 0xbd, 0x1f, 0xf1, 0xb0, 0xbd, 0x55, 0xea, 0xe7, 0xbd,
-  0xdc, 0x69, 0x86, 0xbd, 0xb6, 0xed, 0x00, 0xbd, 0x53, 0xfd, 0xce, 0xbd,
-  0x64, 0x66, 0x2e, 0xbd, 0x8a, 0xa8, 0xdb, 0xbd, 0x1c, 0xab, 0x20, 0xbe,
-  0x07, 0x51, 0x81, 0xbd, 0x02, 0x47, 0xda, 0xbc, 0x86, 0x15, 0x1d, 0x3b,
-  0xf1, 0x64, 0x53, 0xbd, 0x4d, 0x12, 0x19, 0x3d, 0x76, 0xed, 0xa9, 0x3d,
-  0x14, 0xcf, 0xc5, 0xba, 0xe9, 0x0b, 0x8c, 0xbe, 0x87, 0x92, 0x54, 0xbd,
-  0xe0, 0xc7, 0x88, 0x3d, 0x83, 0xa9, 0xd2, 0x3c, 0x3e, 0x9f, 0x5e, 0xbd,
-  0x23, 0x4e, 0x27, 0xbd, 0x1e, 0xdf, 0x00, 0x3b, 0xc2, 0xfe, 0x56, 0x3d,
-  0x7b, 0xa4, 0x79, 0xbe, 0x95, 0x45, 0x2b, 0xbd, 0xb4, 0x69, 0x5a, 0x3d,
-  0x34, 0xf3, 0xf0, 0x3c, 0xd4, 0xe0, 0x4f, 0x3d, 0x7e, 0xd0, 0x2c, 0x3d,
-  0xd5, 0xa5, 0xb9, 0x3d, 0x91, 0x72, 0x0a, 0x3e, 0x4a, 0xe4, 0xb9, 0x3d,
-  0x97, 0xf6, 0x16, 0x3d, 0xd5, 0x21, 0xdd, 0x3c, 0xc9, 0x43, 0x6a, 0x3d,
-  0x92, 0x79, 0x0b, 0x3d, 0x3b, 0x8b, 0xd7, 0x3c, 0x8d, 0x1b, 0x7b, 0x3d,
-  0x68, 0xdf, 0x60, 0x3e, 0x01, 0x68, 0x1b, 0x3e, 0xb4, 0xa8, 0xc9, 0xbc,
-  0x17, 0x3b, 0x61, 0x3b, 0xa4, 0xb7, 0xb7, 0x3d, 0x7d, 0x3e, 0x90, 0x3d,
-  0xac, 0xfb, 0x83, 0x3d, 0xb7, 0x2f, 0x90, 0x3c, 0x16, 0x2f, 0xcb, 0x3d,
-  0x39, 0x49, 0x82, 0x3d, 0x2d, 0x1e, 0xca, 0x3c, 0xee, 0x72, 0x4b, 0x3c,
-  0xb1, 0xe8, 0x8b, 0x3d, 0x32, 0x87, 0x53, 0x3d, 0xa6, 0xea, 0xb7, 0xba,
-  0x62, 0x79, 0xb5, 0xbc, 0xcf, 0x44, 0xb8, 0x3d, 0x0e, 0xb2, 0x4c, 0x3b,
-  0x90, 0x34, 0x80, 0x3d, 0x84, 0xe9, 0x6e, 0x3c, 0x83, 0x82, 0x26, 0x3d,
-  0xd7, 0x8c, 0xf3, 0x3c, 0xa1, 0x42, 0x22, 0x3d, 0x2d, 0x46, 0xaa, 0xba,
-  0xd5, 0x5c, 0xae, 0x3d, 0x7b, 0xc7, 0xfb, 0xbc, 0xfc, 0x9b, 0x64, 0x3d,
-  0x3e, 0x3c, 0x6c, 0x3d, 0x70, 0x0c, 0x33, 0x3c, 0xe0, 0x35, 0x13, 0x3c,
-  0x2c, 0xd5, 0x8b, 0x3c, 0xa9, 0xdd, 0xa8, 0xbd, 0x0a, 0x56, 0xa7, 0x3d,
-  0x8e, 0xee, 0x55, 0x3b, 0x4a, 0xc0, 0x2d, 0xbd, 0x3d, 0xac, 0x3d, 0x3d,
-  0xc4, 0xd9, 0x21, 0xbc, 0xab, 0xc4, 0xb6, 0x3c, 0xcc, 0x7c, 0xaf, 0xbc,
-  0xf7, 0x1b, 0xfd, 0x3c, 0x77, 0x92, 0xec, 0xbc, 0x15, 0xa0, 0x15, 0xbe,
-  0x9c, 0x30, 0xcd, 0xbd, 0x20, 0x37, 0x4f, 0x3d, 0xe9, 0xc2, 0x9c, 0xbd,
-  0xb7, 0x64, 0x03, 0xbd, 0x84, 0x85, 0x2f, 0xbc, 0xae, 0x3b, 0xf5, 0x3d,
-  0xcc, 0x45, 0x10, 0x3d, 0x3f, 0x19, 0x20, 0xbe, 0x5d, 0x6a, 0x23, 0x3d,
-  0xd4, 0xd2, 0x0b, 0x3d, 0x22, 0x18, 0x31, 0xbe, 0xb0, 0x6f, 0xb7, 0xbd,
-  0xa4, 0x75, 0x95, 0xbd, 0x7c, 0x1c, 0xe7, 0xbd, 0x8b, 0xe0, 0xda, 0xbd,
-  0xd6, 0xdb, 0xe6, 0xbd, 0x8f, 0xb7, 0xa2, 0xbd, 0x38, 0x47, 0x07, 0xbe,
-  0x15, 0x59, 0xb6, 0xbd, 0x10, 0x67, 0xf4, 0x3c, 0xb7, 0x25, 0x13, 0xbd,
-  0xa5, 0xa6, 0xaf, 0xbd, 0x1d, 0xf8, 0xa6, 0xbd, 0xda, 0x89, 0xa7, 0xbd,
-  0x83, 0xdf, 0xe5, 0x39, 0x44, 0x06, 0x8c, 0xbd, 0x32, 0x31, 0xac, 0xbc,
-  0x36, 0x98, 0xac, 0x3c, 0x40, 0xaa, 0x92, 0x3d, 0x43, 0xda, 0x89, 0x3d,
-  0xa2, 0x8a, 0x66, 0x3b, 0xbd, 0x11, 0x2a, 0xbe, 0x9a, 0xb8, 0xfd, 0x3c,
-  0xdf, 0x8d, 0x8d, 0x3d, 0x6b, 0x4b, 0x5b, 0x3d, 0x16, 0x5f, 0x80, 0x3b,
-  0xb7, 0xf1, 0x76, 0x3d, 0x0a, 0x96, 0xcd, 0x3d, 0xd8, 0x62, 0x39, 0x3d,
-  0x0d, 0xc9, 0x94, 0xbe, 0x12, 0xbf, 0x22, 0x3d, 0xda, 0x42, 0x8f, 0x3c,
-  0xcc, 0x23, 0xcf, 0x3d, 0x73, 0x26, 0x1f, 0xbd, 0x53, 0x81, 0x5c, 0xbd,
-  0x7a, 0xcd, 0x26, 0x3d, 0x06, 0x0c, 0x8b, 0x3d, 0xb1, 0xc2, 0x4a, 0xbe,
-  0x15, 0x04, 0x27, 0xbb, 0x58, 0xe7, 0xe9, 0x3c, 0x1a, 0x77, 0x84, 0x3d,
-  0x0d, 0x60, 0x69, 0xbd, 0xf3, 0x7a, 0x69, 0x3d, 0x41, 0x03, 0x13, 0xbc,
-  0xb7, 0x1a, 0xee, 0x3d, 0x55, 0x42, 0xf0, 0xbd, 0xac, 0xa4, 0xa6, 0x3c,
-  0x48, 0xf4, 0x23, 0x3d, 0x7d, 0x1b, 0xa2, 0x3d, 0x65, 0xcf, 0xd8, 0xbc,
-  0xbd, 0xcc, 0x48, 0x3d, 0x0c, 0x66, 0x27, 0x3c, 0xa3, 0x03, 0x45, 0x3d,
-  0x4f, 0xe9, 0xd2, 0xbb, 0x2c, 0x01, 0x4b, 0x3d, 0x45, 0x5b, 0x1c, 0xbc,
-  0xd9, 0x20, 0xf7, 0x3c, 0x72, 0xac, 0xac, 0xbc, 0x0c, 0x73, 0xb1, 0x3b,
-  0x65, 0xa2, 0x58, 0x3c, 0x54, 0xbe, 0x88, 0x3d, 0xa1, 0xe7, 0x81, 0x3c,
-  0x63, 0xb9, 0xad, 0x3c, 0x47, 0x1d, 0x84, 0x3c, 0xbb, 0x65, 0xa4, 0x3d,
-  0x6f, 0x2e, 0xb7, 0x3c, 0x6c, 0xa3, 0x82, 0xbc, 0x60, 0x0c, 0xc5, 0xba,
-  0xaa, 0xa9, 0x1c, 0x3b, 0x3f, 0x21, 0xc1, 0x3b, 0xac, 0x36, 0x82, 0x3c,
-  0x1e, 0x35, 0xb0, 0x3c, 0xcc, 0x51, 0xc7, 0x3d, 0xec, 0x34, 0x87, 0xbc,
-  0x39, 0xed, 0x6c, 0x3a, 0x15, 0xb1, 0x6c, 0x3d, 0x61, 0x73, 0x83, 0x3d,
-  0x6e, 0xae, 0x2f, 0x3d, 0xad, 0xff, 0x79, 0x3d, 0xb4, 0x1d, 0x41, 0x3d,
-  0xe3, 0xec, 0x26, 0x3c, 0x73, 0xd5, 0x4a, 0x3d, 0x51, 0x41, 0x16, 0x3d,
-  0xab, 0x12, 0x90, 0x3c, 0xe7, 0xa7, 0x78, 0x3d, 0x56, 0x36, 0x53, 0xbd,
-  0x38, 0x4d, 0xa8, 0xbd, 0x3e, 0x6a, 0x18, 0x3c, 0x82, 0xa6, 0xc5, 0x3c,
-  0x36, 0x50, 0xee, 0x3d, 0x73, 0x9e, 0xbe, 0x3a, 0x34, 0x6c, 0x1c, 0x3c,
-  0x00, 0x77, 0x05, 0xbd, 0xe0, 0x30, 0x28, 0xbe, 0xfa, 0x36, 0x23, 0x3c,
-  0x2d, 0x05, 0xd8, 0xbc, 0xb4, 0xb4, 0xc7, 0xbc, 0x21, 0x86, 0x5d, 0x3d,
-  0xe4, 0xa8, 0x27, 0xbc, 0x89, 0xbb, 0x9f, 0x3d, 0xc8, 0xee, 0xc7, 0x3b,
-  0x8e, 0x71, 0xe8, 0xbd, 0x08, 0xff, 0x9f, 0x3c, 0x22, 0x04, 0xd2, 0x3c,
-  0x50, 0x7a, 0x3b, 0xbe, 0xca, 0xbd, 0xdd, 0xbd, 0xab, 0x82, 0x26, 0xbc,
-  0x01, 0x98, 0x23, 0xbd, 0xb0, 0xee, 0xb8, 0xbd, 0x37, 0x59, 0xab, 0xbd,
-  0xdf, 0x54, 0xe2, 0xbd, 0xd4, 0xff, 0xab, 0xbd, 0x7c, 0xac, 0x15, 0xbe,
-  0x95, 0x64, 0x25, 0xbd, 0x7e, 0xff, 0x48, 0xbc, 0x9c, 0x3c, 0x2e, 0xbd,
-  0xaf, 0x5a, 0x89, 0xbc, 0x6a, 0x0e, 0x08, 0xbe, 0x2e, 0x2f, 0xc4, 0x3c,
-  0x7b, 0x7a, 0x54, 0xbc, 0x5c, 0x07, 0x0b, 0xbe, 0xe4, 0x6d, 0x48, 0x3d,
-  0x7f, 0x32, 0x5c, 0x3d, 0x8f, 0xa7, 0x02, 0x3b, 0x43, 0x14, 0x04, 0xbc,
-  0x0a, 0x46, 0x2f, 0xbe, 0xcd, 0x74, 0x8d, 0x3c, 0x1b, 0x4a, 0x0c, 0x3d,
-  0x63, 0x2b, 0xed, 0xbd, 0x3f, 0x19, 0x89, 0x3d, 0xba, 0x9a, 0xee, 0x3c,
-  0xf4, 0xea, 0xcd, 0x3d, 0x26, 0x88, 0x59, 0xbd, 0xe9, 0x9e, 0x73, 0xbe,
-  0x67, 0xd4, 0x81, 0x3c, 0xad, 0x07, 0x86, 0x3c, 0x6f, 0x7e, 0x89, 0xbc,
-  0x5f, 0xc0, 0x23, 0x3e, 0x80, 0x24, 0x8f, 0x3d, 0x3f, 0x80, 0x2f, 0x3d,
-  0x8d, 0x93, 0x13, 0xbd, 0xc2, 0x10, 0x03, 0xbe, 0xac, 0xb2, 0x6d, 0xbc,
-  0xd2, 0xc9, 0x1c, 0xbc, 0x89, 0x27, 0x00, 0x3c, 0x4b, 0x66, 0x3f, 0x3e,
-  0x94, 0xe1, 0xad, 0xbc, 0xcb, 0xee, 0x39, 0xbd, 0x31, 0xa0, 0x20, 0xbd,
-  0x43, 0x7f, 0xc4, 0xbc, 0xb9, 0x70, 0x3d, 0x3d, 0x43, 0xd4, 0x87, 0x3d,
-  0xd2, 0xb3, 0xd7, 0x3d, 0xf4, 0x2c, 0x15, 0x3e, 0xe5, 0xca, 0xfd, 0xbb,
-  0xed, 0x04, 0xda, 0xbb, 0x43, 0x3f, 0xda, 0x3b, 0xa2, 0x42, 0x08, 0xbd,
-  0x11, 0x1f, 0x66, 0xbd, 0x4c, 0x12, 0x8b, 0xbd, 0xa1, 0x8b, 0x98, 0x3d,
-  0x0d, 0x10, 0x94, 0xbd, 0x83, 0x13, 0x74, 0xbd, 0x67, 0xfc, 0x14, 0xbd,
-  0x7c, 0x5c, 0xd2, 0x3b, 0x8c, 0x57, 0x50, 0x3d, 0x90, 0x74, 0x93, 0xbd,
-  0x1b, 0x23, 0xa1, 0xbd, 0x27, 0xea, 0x9a, 0x3d, 0xfb, 0x08, 0x9f, 0xbd,
-  0xf1, 0x8d, 0x3b, 0xbd, 0xab, 0x89, 0xe4, 0x3d, 0x0b, 0xc3, 0xf6, 0x3d,
-  0x56, 0x05, 0xb3, 0x3d, 0x88, 0x05, 0xb8, 0x3d, 0x8d, 0xa1, 0x90, 0x3c,
-  0x78, 0x18, 0x70, 0x3e, 0x91, 0x95, 0xe3, 0x3c, 0x2c, 0x00, 0x7f, 0xbc,
-  0x5b, 0x7b, 0xab, 0x3d, 0x58, 0x54, 0xa8, 0x3d, 0x9c, 0xd7, 0xec, 0x3a,
-  0xd2, 0x15, 0x78, 0x3d, 0xd3, 0xba, 0x1b, 0x3d, 0xd1, 0x55, 0x90, 0x3d,
-  0xfb, 0xe3, 0x0b, 0x3d, 0xb6, 0xaa, 0xec, 0xbb, 0x27, 0xaf, 0xa0, 0x3d,
-  0xa5, 0xba, 0xfd, 0x3d, 0xe7, 0xff, 0x43, 0xbc, 0xf8, 0xe7, 0x05, 0x3d,
-  0x38, 0x40, 0xd7, 0x3d, 0x01, 0x75, 0xa4, 0xbc, 0x2e, 0x46, 0x17, 0x3d,
-  0x9e, 0x0d, 0xd2, 0x3d, 0xd9, 0x2d, 0xad, 0x3d, 0xe3, 0x92, 0x84, 0x3d,
-  0x24, 0xd2, 0x50, 0xbe, 0x47, 0x8e, 0xee, 0x3d, 0x7e, 0x9d, 0xde, 0x3b,
-  0xd1, 0x27, 0x1f, 0xbe, 0x38, 0x3b, 0xa5, 0x3c, 0xb7, 0x9b, 0xe0, 0x3d,
-  0x4b, 0x74, 0x85, 0x3d, 0x0d, 0x1c, 0x7f, 0xbc, 0x3c, 0x7c, 0x6d, 0xbd,
-  0x7a, 0x10, 0x9c, 0x3c, 0x24, 0x67, 0x28, 0xbd, 0x42, 0x11, 0x83, 0xbd,
-  0xcf, 0xf8, 0xd8, 0xbd, 0x4a, 0x02, 0x11, 0xbd, 0x41, 0x76, 0x26, 0xbd,
-  0xa9, 0x78, 0x28, 0xbe, 0xfe, 0x09, 0x47, 0xbe, 0x2d, 0x0b, 0x99, 0xbd,
-  0x7e, 0x2e, 0x64, 0xbd, 0x89, 0x24, 0x41, 0xbe, 0x62, 0xfb, 0xb6, 0xbc,
-  0xc5, 0xa5, 0x7c, 0xbd, 0xd2, 0x64, 0x85, 0x3d, 0xd0, 0xa2, 0x81, 0xbc,
-  0x4f, 0x3c, 0xb4, 0xbd, 0x82, 0xbe, 0xbb, 0xbc, 0x48, 0xcb, 0x31, 0x3d,
-  0xcc, 0xf2, 0x37, 0xbe, 0xae, 0xe5, 0x62, 0x3d, 0xb6, 0xc7, 0x93, 0x3d,
-  0x15, 0x39, 0xa3, 0x3d, 0xb6, 0x0e, 0x19, 0xbd, 0x12, 0x1f, 0x38, 0xbd,
-  0x65, 0x36, 0x82, 0xbb, 0xae, 0xe2, 0x03, 0x3d, 0xb9, 0xa0, 0x1c, 0xbe,
-  0xb7, 0x63, 0xa2, 0x3d, 0x39, 0xdf, 0xf4, 0x3b, 0x42, 0x3d, 0x5a, 0xbd,
-  0x54, 0x26, 0x1f, 0x3d, 0x47, 0xf3, 0xa2, 0xbd, 0x98, 0x4d, 0x5b, 0xbd,
-  0xc4, 0xf1, 0xa7, 0x3a, 0x7b, 0xaa, 0x4c, 0xbe, 0xf0, 0x73, 0x31, 0x3e,
-  0x49, 0x35, 0xdf, 0x3c, 0xb7, 0x91, 0xa5, 0xbc, 0xab, 0xc0, 0x5c, 0x3d,
-  0x98, 0x35, 0xac, 0x3d, 0xec, 0xd4, 0x90, 0xbc, 0x66, 0x2e, 0x1f, 0xbd,
-  0x89, 0xbc, 0xbb, 0x3b, 0x8c, 0x56, 0x81, 0x3e, 0xa7, 0x81, 0x44, 0xba,
-  0xe7, 0x7b, 0x0d, 0x3c, 0x39, 0xc7, 0x70, 0x3b, 0xf3, 0x44, 0x16, 0x3e,
-  0x0d, 0x78, 0xef, 0xbc, 0x9c, 0x66, 0xba, 0x3d, 0xd4, 0x18, 0xe5, 0xbd,
-  0xd2, 0x5a, 0x03, 0x3e, 0xcd, 0x34, 0x05, 0xbd, 0x88, 0x8c, 0x75, 0xbd,
-  0x21, 0x36, 0x2a, 0xbe, 0xcc, 0x24, 0x57, 0xbe, 0xeb, 0xa2, 0x96, 0x3c,
-  0x69, 0x14, 0xb4, 0x3d, 0x1a, 0x8a, 0x47, 0x3e, 0x49, 0x79, 0x1c, 0x3d,
-  0x12, 0x45, 0xf0, 0xbb, 0x87, 0x32, 0x78, 0x3d, 0x14, 0xfe, 0xd3, 0x3c,
-  0x93, 0x31, 0x75, 0xbe, 0x7b, 0x67, 0xb8, 0x3b, 0xa2, 0x2f, 0x41, 0xbd,
-  0x49, 0xd9, 0x0f, 0x3e, 0x0a, 0x6f, 0x1b, 0xbe, 0xb4, 0x60, 0x8b, 0xbd,
-  0x79, 0x92, 0x14, 0x3d, 0xcd, 0x8d, 0x35, 0x3e, 0x5d, 0xde, 0x13, 0xbd,
-  0xbc, 0x65, 0xe9, 0x3c, 0x94, 0x88, 0x39, 0xbd, 0xa8, 0xda, 0x1e, 0x3e,
-  0xb0, 0xb5, 0xb8, 0xbd, 0x08, 0xe9, 0x8e, 0xbc, 0x0c, 0xe1, 0xb3, 0x3d,
-  0x20, 0xf8, 0x20, 0x3e, 0xd9, 0x3c, 0x16, 0xbc, 0x28, 0x1a, 0x51, 0x3d,
-  0x69, 0x99, 0xd3, 0xbb, 0xe1, 0x4b, 0xfc, 0x3d, 0xf9, 0x6f, 0xad, 0x3c,
-  0xf8, 0xdc, 0x1c, 0x3d, 0xbe, 0x05, 0xa9, 0x3d, 0x86, 0x93, 0x2b, 0x3e,
-  0x49, 0x41, 0xca, 0xbd, 0x19, 0x54, 0x06, 0x3e, 0x01, 0x09, 0x9c, 0x3d,
-  0x2e, 0xc1, 0xc0, 0xbd, 0x8b, 0x08, 0xf7, 0x3d, 0xf4, 0x07, 0x99, 0x3d,
-  0x3e, 0xbf, 0x83, 0x3d, 0x8d, 0xe8, 0xb7, 0x3d, 0xcb, 0xf5, 0x2d, 0xbe,
-  0xd1, 0xc0, 0x2b, 0x3d, 0xad, 0x38, 0x91, 0x3b, 0xc1, 0xbe, 0x50, 0xbe,
-  0x4a, 0x9c, 0x83, 0x3d, 0x8b, 0xe1, 0xd8, 0x3d, 0xf4, 0x91, 0x91, 0xbc,
-  0xcf, 0xdf, 0x21, 0x3c, 0x98, 0x99, 0x0e, 0xbe, 0xc3, 0x7d, 0x54, 0x3d,
-  0xcc, 0xea, 0x9c, 0x3d, 0xc1, 0x0d, 0x20, 0xbe, 0x78, 0xf9, 0x04, 0xbe,
-  0x31, 0x03, 0x2b, 0xbd, 0x0e, 0x47, 0x80, 0x3c, 0x56, 0x33, 0x84, 0xbd,
-  0x00, 0xd4, 0x40, 0xbe, 0xfd, 0xbb, 0x72, 0xbd, 0xc4, 0x42, 0x20, 0xbd,
-  0x36, 0x3f, 0x1b, 0xbe, 0xe8, 0x6f, 0x09, 0xbe, 0xf7, 0x23, 0xf9, 0x3c,
-  0x8a, 0x24, 0xe4, 0xbc, 0x86, 0x9c, 0xb7, 0xbc, 0xfd, 0x12, 0x87, 0xbd,
-  0x0f, 0x98, 0x3e, 0x3b, 0x10, 0x4f, 0xf6, 0xbd, 0x0e, 0x27, 0x1c, 0xbd,
-  0x73, 0xd0, 0xaa, 0xbb, 0x02, 0x07, 0x91, 0x3b, 0xe5, 0x41, 0x4b, 0xbd,
-  0x94, 0xbf, 0xbd, 0x3d, 0x8d, 0x24, 0x36, 0xbc, 0x89, 0xc6, 0x0a, 0xbd,
-  0xcf, 0xd2, 0xf9, 0xbc, 0x64, 0xd8, 0xd4, 0x3c, 0x99, 0x54, 0x25, 0x3d,
-  0xc5, 0x50, 0xe3, 0x3c, 0x70, 0xc9, 0x18, 0x3c, 0x8c, 0x13, 0x04, 0x3d,
-  0x51, 0x6f, 0x37, 0x3e, 0x90, 0xe2, 0x5c, 0xbd, 0x04, 0x58, 0x7b, 0x3b,
-  0xce, 0x1e, 0xbb, 0x3d, 0xe7, 0x75, 0x1b, 0x3e, 0x5e, 0x3e, 0x2e, 0x3d,
-  0x1c, 0x48, 0x94, 0xbd, 0x0b, 0xdf, 0x8e, 0xbd, 0xe3, 0x87, 0x59, 0x3e,
-  0x5a, 0x5a, 0xa3, 0xbd, 0xd0, 0x39, 0x1f, 0xbd, 0x8f, 0xd7, 0x9c, 0xbb,
-  0x04, 0x2c, 0x55, 0x3e, 0xd0, 0x47, 0x4b, 0x3d, 0x13, 0x14, 0x3b, 0x3c,
-  0xab, 0x1a, 0x27, 0x3b, 0xa8, 0xe4, 0x5c, 0x3d, 0xed, 0xdd, 0x52, 0x3d,
-  0xb5, 0xbd, 0xae, 0x3d, 0x60, 0x24, 0x50, 0xbe, 0x8b, 0x55, 0x46, 0x3e,
-  0x9f, 0xef, 0xa2, 0x3d, 0xe9, 0x51, 0xa0, 0x3b, 0xaf, 0x8d, 0x0a, 0xbd,
-  0xb7, 0x54, 0x7d, 0xbe, 0xf4, 0xf0, 0x57, 0xbc, 0xa4, 0xeb, 0x16, 0x3d,
-  0xe5, 0xee, 0xbc, 0x3d, 0x18, 0xb7, 0xe6, 0xbc, 0x80, 0xc8, 0xe8, 0x3c,
-  0x5b, 0xff, 0xa8, 0x3d, 0xc7, 0xc5, 0x5f, 0x3d, 0x83, 0xe4, 0x31, 0xbe,
-  0x98, 0x8b, 0x33, 0xbb, 0xb8, 0x52, 0x7a, 0x3c, 0x96, 0x64, 0x80, 0x3e,
-  0x10, 0x56, 0xe1, 0xbd, 0xbf, 0x9c, 0xdf, 0xbd, 0x57, 0x23, 0x6a, 0x3c,
-  0xfa, 0xf0, 0xaa, 0x3d, 0x4d, 0x49, 0x15, 0x3e, 0x7e, 0x06, 0x87, 0x3d,
-  0xbe, 0x1d, 0xa9, 0xbd, 0xf7, 0x16, 0x0d, 0x3e, 0xef, 0xc1, 0xb4, 0xbd,
-  0x30, 0x12, 0xa1, 0xbc, 0x0b, 0xfe, 0x67, 0xbc, 0x98, 0xc9, 0x2c, 0x3e,
-  0x54, 0x86, 0xbd, 0x3d, 0xf8, 0x5a, 0x0c, 0xbd, 0xe2, 0x45, 0xf6, 0xbd,
-  0x6a, 0x85, 0xba, 0xbc, 0xc7, 0xe7, 0x37, 0xbc, 0x0b, 0x9e, 0x81, 0xbd,
-  0x09, 0x9b, 0xdb, 0xbc, 0xb7, 0x89, 0x89, 0x3d, 0x1b, 0xd9, 0xee, 0x3d,
-  0xbe, 0x72, 0x4c, 0xbc, 0xab, 0x8c, 0x05, 0xbd, 0xaf, 0x4b, 0x94, 0xbd,
-  0x73, 0x7f, 0xc5, 0xbc, 0xdf, 0xa6, 0x08, 0x3d, 0x98, 0xa7, 0x89, 0xbd,
-  0xf9, 0x8e, 0xd9, 0x3d, 0x18, 0xb2, 0xaf, 0xbc, 0x34, 0xc5, 0x87, 0x3c,
-  0x6d, 0x14, 0xab, 0xbc, 0x2f, 0xbe, 0x56, 0xbe, 0x6c, 0xbc, 0xbe, 0x3c,
-  0x55, 0x2f, 0xc0, 0xbc, 0x3c, 0x32, 0x8b, 0xbd, 0xc6, 0x94, 0x61, 0x3d,
-  0xd8, 0x3f, 0x1a, 0xbe, 0xcb, 0x6f, 0xd6, 0xbc, 0xfe, 0x1f, 0xac, 0xbb,
-  0x36, 0xc7, 0x90, 0xbd, 0x1d, 0x11, 0xbb, 0xbd, 0xc0, 0xf5, 0xdb, 0xbd,
-  0x1b, 0xae, 0xff, 0xbd, 0xec, 0xac, 0x48, 0xbd, 0x78, 0x5b, 0x01, 0xbe,
-  0xeb, 0x3a, 0x08, 0xbe, 0x4d, 0xd3, 0x8e, 0xbd, 0xc9, 0x86, 0xc3, 0xbd,
-  0xba, 0x86, 0xfd, 0xbd, 0x2b, 0x33, 0xd5, 0xbc, 0xb6, 0x5b, 0x52, 0xbe,
-  0xa6, 0x13, 0x1e, 0xbe, 0xd7, 0x18, 0x2c, 0xbe, 0xd1, 0xfb, 0xea, 0xbd,
-  0xce, 0x0a, 0xed, 0xbd, 0xaa, 0xe4, 0xcb, 0x3d, 0xa1, 0xc4, 0x02, 0xba,
-  0x3f, 0x9d, 0xa3, 0xbc, 0xf8, 0x2d, 0x3b, 0xbd, 0xec, 0x93, 0xf8, 0xbd,
-  0x88, 0x77, 0xfe, 0xbd, 0xba, 0x30, 0x91, 0xbb, 0xed, 0xaa, 0x86, 0xbd,
-  0x6c, 0x0a, 0xd5, 0x3d, 0xc4, 0x4c, 0x9e, 0x3c, 0x4a, 0x10, 0x4e, 0xbb,
-  0x06, 0x7a, 0x14, 0x3d, 0x58, 0x85, 0x57, 0xbd, 0xd9, 0xf4, 0xae, 0xbd,
-  0x93, 0x3a, 0x84, 0x3d, 0x49, 0xe0, 0x83, 0x3d, 0x81, 0x67, 0x1a, 0x3e,
-  0x70, 0x1a, 0x4c, 0xbd, 0x88, 0xbb, 0x44, 0xbd, 0x46, 0xf4, 0xee, 0x3c,
-  0x75, 0xc9, 0x8f, 0x3c, 0x5f, 0xec, 0x34, 0xbe, 0x1f, 0x17, 0x07, 0x3d,
-  0x59, 0xc9, 0x8d, 0x3d, 0xd8, 0x40, 0xe6, 0xbb, 0x9c, 0x86, 0x74, 0x3d,
-  0x72, 0x19, 0x9e, 0x3d, 0x1f, 0x68, 0x21, 0x3e, 0x7c, 0xd5, 0x81, 0x3d,
-  0xb0, 0xba, 0x1f, 0xbe, 0x7d, 0x0c, 0x07, 0x3e, 0x65, 0x6f, 0x1d, 0x3e,
-  0xc1, 0x8f, 0x3c, 0xbe, 0x17, 0x9a, 0x06, 0x3e, 0x00, 0x5c, 0xb6, 0x3d,
-  0x4c, 0x73, 0xb7, 0x3d, 0xea, 0x55, 0xc8, 0x3d, 0x3e, 0x66, 0x33, 0xbe,
-  0x53, 0xfa, 0x2f, 0x3d, 0x82, 0xac, 0x0e, 0xbd, 0x98, 0xdd, 0xb4, 0x3d,
-  0xe5, 0xe4, 0x6f, 0x3d, 0xa0, 0xbe, 0x07, 0x3d, 0x6c, 0x46, 0xe6, 0xbd,
-  0xd4, 0xb4, 0x90, 0x3b, 0xba, 0xc1, 0x89, 0x3d, 0xec, 0xd5, 0x81, 0xbd,
-  0x54, 0x67, 0x6a, 0xbd, 0xe3, 0xe5, 0x62, 0x3e, 0xbe, 0x8f, 0x63, 0xbc,
-  0x5d, 0x98, 0xe2, 0xbc, 0x87, 0x0a, 0xc3, 0xbd, 0x85, 0xea, 0xa8, 0x3d,
-  0x10, 0x0c, 0x4e, 0x3e, 0xbc, 0xe7, 0x9a, 0xbd, 0xa3, 0x0a, 0x73, 0xbd,
-  0xdb, 0xe2, 0x83, 0x3d, 0x9b, 0x2c, 0x39, 0x3d, 0xfc, 0x87, 0x04, 0xbe,
-  0x66, 0x6e, 0x55, 0xbe, 0xda, 0x94, 0x39, 0xbd, 0x91, 0x1c, 0x27, 0x3e,
-  0x94, 0x32, 0x3e, 0xbe, 0xaa, 0x78, 0x12, 0xbe, 0xbd, 0xd6, 0xc1, 0x3d,
-  0x48, 0xe7, 0x8a, 0xbd, 0x75, 0x21, 0xd0, 0xbd, 0x9b, 0x5d, 0x4f, 0xbe,
-  0x69, 0x9d, 0x12, 0xbd, 0xaa, 0xe3, 0x6f, 0x3d, 0x74, 0x79, 0x38, 0xbe,
-  0xb7, 0xd3, 0x5b, 0xbd, 0x89, 0x7b, 0x98, 0x3c, 0x0a, 0xfd, 0x80, 0xbd,
-  0x2d, 0x29, 0x63, 0xbc, 0x99, 0x1a, 0x9f, 0xbd, 0x89, 0x4d, 0x3f, 0xbe,
-  0xb6, 0xd2, 0xba, 0xbd, 0x9d, 0x49, 0xe2, 0xbd, 0x2c, 0x83, 0xa6, 0xbd,
-  0xbe, 0x62, 0x2b, 0xbe, 0xe8, 0xdb, 0xe5, 0xbd, 0xe0, 0xac, 0xd3, 0x37,
-  0x92, 0x9c, 0x76, 0x3d, 0xfe, 0x8b, 0xa6, 0xba, 0x48, 0x71, 0xc6, 0xbd,
-  0x49, 0x70, 0xd4, 0xbc, 0x75, 0x35, 0x82, 0xbd, 0xd3, 0x8b, 0x43, 0xbe,
-  0x80, 0x1e, 0x43, 0xbe, 0x0b, 0x8a, 0xd8, 0xbd, 0xbc, 0x76, 0x32, 0xbd,
-  0x2b, 0xdc, 0x87, 0xbd, 0x5d, 0x53, 0xbd, 0xbd, 0x41, 0x6d, 0x07, 0xbd,
-  0x5a, 0xd8, 0x0c, 0xbe, 0x41, 0x53, 0xc7, 0xbd, 0x70, 0xda, 0x62, 0xbc,
-  0x53, 0x31, 0xa0, 0xbd, 0x93, 0xb5, 0x89, 0xbd, 0x50, 0xb8, 0x51, 0xbe,
-  0x0b, 0x90, 0x24, 0xbe, 0x94, 0x34, 0xcd, 0xbd, 0x61, 0x65, 0xe4, 0xbd,
-  0x76, 0x42, 0x28, 0xbd, 0xce, 0x03, 0xdd, 0xbd, 0x83, 0x4f, 0x1f, 0xbd,
-  0x39, 0xaf, 0xaa, 0x3d, 0x56, 0x5e, 0x12, 0xbd, 0x36, 0xc4, 0x9f, 0xbe,
-  0xbb, 0xda, 0x46, 0xbc, 0x4d, 0x2b, 0xad, 0xbc, 0x57, 0x33, 0xbd, 0xbc,
-  0xf7, 0xa4, 0xce, 0xbb, 0x22, 0xc8, 0xa3, 0x3a, 0xc2, 0x06, 0xb6, 0x3d,
-  0x30, 0x7c, 0xdf, 0x3d, 0x59, 0x07, 0xdd, 0xbe, 0x28, 0xe2, 0x0c, 0x3e,
-  0x0f, 0x51, 0x9d, 0x3b, 0xe7, 0xe5, 0x22, 0xbb, 0xa7, 0x99, 0x78, 0xbd,
-  0xf0, 0xe3, 0xcc, 0x3d, 0xd7, 0x3b, 0x16, 0x3e, 0x19, 0xb3, 0x0c, 0x3e,
-  0x87, 0x1f, 0xc4, 0xbe, 0x09, 0x7d, 0x13, 0x3e, 0xbc, 0x71, 0x0c, 0x3e,
-  0xc9, 0xea, 0xf1, 0xbd, 0xed, 0x11, 0x8c, 0x3d, 0x0a, 0x64, 0x7e, 0x3d,
-  0xd3, 0xe5, 0x60, 0x3e, 0x13, 0x82, 0x2e, 0x3e, 0xfa, 0x52, 0x7d, 0xbe,
-  0x21, 0x09, 0xe3, 0x3d, 0xa7, 0x89, 0x91, 0x3d, 0xdb, 0xc5, 0xc0, 0xbe,
-  0xd9, 0x6e, 0xc2, 0x3d, 0x47, 0x3f, 0x54, 0x3d, 0x31, 0x93, 0x6f, 0xbd,
-  0x48, 0x82, 0x90, 0x3d, 0xad, 0xc9, 0x11, 0xbe, 0x19, 0xc2, 0x8e, 0xbc,
-  0xbe, 0x4a, 0xae, 0xbc, 0x18, 0x78, 0x9b, 0xbd, 0xa2, 0xcf, 0x12, 0x3e,
-  0x29, 0x3b, 0x80, 0xbd, 0x76, 0x87, 0x83, 0xbd, 0xb0, 0xe9, 0xc2, 0xbd,
-  0xc7, 0xee, 0xb7, 0x3c, 0x6b, 0x11, 0x62, 0xbd, 0x9b, 0x03, 0x94, 0x3d,
-  0xfe, 0xb5, 0xdd, 0x3d, 0xe9, 0xb1, 0x1c, 0x3e, 0x3a, 0x8f, 0xc8, 0xbd,
-  0x92, 0x22, 0xca, 0xbd, 0x1a, 0xb2, 0x47, 0xbd, 0x02, 0xc5, 0xdf, 0x3d,
-  0x0d, 0x42, 0xf6, 0xbd, 0x24, 0xfc, 0x4e, 0xbd, 0x62, 0x54, 0xcd, 0xbc,
-  0x15, 0xcb, 0x4c, 0x3d, 0x45, 0x5b, 0xab, 0xbd, 0xa6, 0x53, 0xa4, 0xbd,
-  0xd7, 0x83, 0x2c, 0xbe, 0x78, 0xe3, 0x4b, 0x3d, 0xde, 0x47, 0x23, 0xbd,
-  0xd5, 0x70, 0x1c, 0x3c, 0xae, 0xf3, 0x5b, 0xbd, 0xd4, 0x32, 0x26, 0xbb,
-  0xc4, 0xae, 0x72, 0xbd, 0xe5, 0xee, 0x00, 0xbd, 0x7d, 0xb2, 0xc8, 0xbd,
-  0xe8, 0x97, 0x52, 0xbe, 0xc5, 0x80, 0xfc, 0xbd, 0x8a, 0x90, 0xb0, 0xbd,
-  0x42, 0x53, 0xf9, 0xbd, 0x6d, 0x8d, 0x14, 0xbd, 0x7d, 0xde, 0x4b, 0xbd,
-  0xac, 0x23, 0x74, 0x3d, 0x67, 0x84, 0xb6, 0xbd, 0x00, 0xf6, 0x8e, 0xbe,
-  0x95, 0x60, 0x8e, 0x3c, 0x20, 0x0f, 0xb9, 0x3d, 0xd6, 0xaf, 0x11, 0xbe,
-  0xf2, 0xc3, 0x7d, 0xbd, 0xdc, 0x74, 0xa1, 0xbb, 0xbf, 0x8b, 0x4b, 0xbe,
-  0x60, 0x1b, 0x93, 0xbd, 0xa9, 0x99, 0x3d, 0xbe, 0xc1, 0xc7, 0x7c, 0x3c,
-  0x05, 0x06, 0x16, 0xbe, 0x23, 0x57, 0xd8, 0xbd, 0xab, 0x4f, 0x36, 0xbe,
-  0x64, 0x28, 0xb7, 0xbd, 0x6e, 0xc3, 0x57, 0xbe, 0xbb, 0x01, 0x82, 0xbe,
-  0x98, 0x3e, 0xd6, 0xbd, 0x4a, 0x71, 0x0d, 0xbe, 0x26, 0xfa, 0x06, 0xbe,
-  0xe0, 0xb6, 0xe0, 0xbd, 0x66, 0x43, 0x20, 0xbd, 0x96, 0xee, 0xf4, 0x3c,
-  0x8c, 0x24, 0xe8, 0xbb, 0xb8, 0xf8, 0x0d, 0xbe, 0x30, 0xc3, 0x08, 0xbe,
-  0xb0, 0xdc, 0x13, 0xbd, 0x27, 0x1e, 0x80, 0xbd, 0x08, 0x41, 0x07, 0xbe,
-  0xda, 0xa8, 0x87, 0x3c, 0x63, 0x41, 0x7b, 0xbd, 0x1a, 0x71, 0x45, 0x3c,
-  0xa7, 0x57, 0xc0, 0xbd, 0xbe, 0xb1, 0xad, 0xbe, 0x18, 0x80, 0x51, 0x3c,
-  0x75, 0x4b, 0x23, 0x3d, 0x1f, 0xbc, 0x3f, 0xbe, 0x07, 0x66, 0x67, 0xbd,
-  0xad, 0x33, 0xd4, 0x3b, 0x14, 0x34, 0x05, 0x3e, 0x37, 0xed, 0x8d, 0x3d,
-  0x32, 0xf9, 0x00, 0xbf, 0x9e, 0xbf, 0xd5, 0x3d, 0x00, 0xf2, 0x65, 0x3d,
-  0x36, 0x74, 0x14, 0xbe, 0xe1, 0xae, 0xc6, 0xbd, 0x65, 0x16, 0x07, 0x3c,
-  0x7b, 0xf7, 0xb6, 0x3d, 0x19, 0x8d, 0xb6, 0x3d, 0x4f, 0x56, 0xc3, 0xbe,
-  0x24, 0x55, 0x12, 0x3e, 0x12, 0x2c, 0x44, 0xbd, 0x50, 0x35, 0x13, 0xbe,
-  0xd2, 0x45, 0xc3, 0xbd, 0xd8, 0x55, 0xe0, 0xbc, 0x14, 0x7b, 0x08, 0x3d,
-  0xc2, 0xee, 0x0b, 0x3e, 0x00, 0x20, 0x7a, 0xbe, 0x22, 0x54, 0xfc, 0x3d,
-  0x14, 0x21, 0x11, 0xbd, 0x7f, 0x09, 0x2e, 0xbe, 0x49, 0x7a, 0x92, 0x3c,
-  0x6c, 0x0d, 0x5d, 0xbc, 0xab, 0x0b, 0xf5, 0xbc, 0x96, 0xb9, 0x4a, 0xbc,
-  0xfd, 0x4f, 0x54, 0xbe, 0x85, 0xee, 0x91, 0x3c, 0x8c, 0x3d, 0x7e, 0xbb,
-  0x3e, 0x6d, 0x53, 0xbd, 0xcc, 0x39, 0xa5, 0x3c, 0x06, 0x36, 0x63, 0xbc,
-  0x2f, 0xd4, 0x06, 0xbd, 0x7b, 0xf8, 0xe7, 0x3b, 0x39, 0x1c, 0x03, 0xbd,
-  0x21, 0x9c, 0xa3, 0xbc, 0x79, 0x38, 0xbc, 0xbc, 0xdc, 0x10, 0xfb, 0xbd,
-  0xc7, 0xbc, 0xca, 0x3d, 0x7a, 0xf5, 0x0b, 0x3c, 0xc2, 0x19, 0x49, 0xbb,
-  0x81, 0xdd, 0x7c, 0xbd, 0xb0, 0x3c, 0xb7, 0xbd, 0x23, 0x44, 0x18, 0xbb,
-  0xe5, 0xbc, 0x84, 0xbd, 0x00, 0x7a, 0x08, 0xbe, 0x7e, 0xd9, 0x91, 0xbc,
-  0x36, 0x00, 0x29, 0x3c, 0x2e, 0x27, 0x00, 0xbd, 0xc5, 0x9e, 0x3a, 0xbe,
-  0x94, 0x42, 0x84, 0xbe, 0xdf, 0x39, 0x11, 0xbd, 0x60, 0x1b, 0xac, 0x3c,
-  0x24, 0x31, 0x16, 0xbe, 0xaf, 0x25, 0xb9, 0x3d, 0x83, 0x9b, 0xf6, 0xbc,
-  0xb5, 0x8d, 0xf2, 0x3c, 0xf2, 0x6f, 0xd8, 0xbc, 0x25, 0xb1, 0x80, 0xbe,
-  0xdb, 0x52, 0x2d, 0xbd, 0xed, 0x9a, 0x5d, 0x3c, 0xa7, 0x8d, 0x90, 0xbe,
-  0x87, 0x4e, 0x26, 0xbc, 0x16, 0x38, 0x51, 0xbb, 0x3f, 0x0a, 0xca, 0x3d,
-  0x8b, 0x5d, 0xc5, 0x3d, 0x78, 0xc6, 0xbe, 0xbd, 0x31, 0x41, 0xce, 0x3c,
-  0x8a, 0x4a, 0x57, 0x3b, 0x72, 0x49, 0x3a, 0xbe, 0x45, 0x55, 0xa0, 0xbc,
-  0xea, 0x7f, 0x06, 0xbc, 0x9f, 0xd9, 0x8e, 0xbe, 0x9e, 0xd1, 0xa7, 0x3c,
-  0x6c, 0x0e, 0xd4, 0xbd, 0xef, 0x25, 0x76, 0xbe, 0xc0, 0x70, 0xd5, 0xbd,
-  0xa8, 0x4c, 0x01, 0xbe, 0x08, 0x06, 0x13, 0xbe, 0xf2, 0x33, 0x4c, 0xbd,
-  0x96, 0x7a, 0x1b, 0xbe, 0x8f, 0x61, 0x39, 0xbe, 0xae, 0x1f, 0xa4, 0xbd,
-  0x3d, 0xb4, 0xe8, 0xbd, 0x5c, 0x4c, 0xc3, 0xbd, 0x83, 0xb2, 0x47, 0xbe,
-  0x05, 0x67, 0x82, 0xbd, 0x7f, 0x1a, 0x2b, 0x3d, 0x24, 0x55, 0x88, 0xbd,
-  0x6b, 0x30, 0x17, 0xbe, 0x6b, 0x6e, 0x49, 0xbe, 0x01, 0xb6, 0xdb, 0xbd,
-  0x1e, 0xb8, 0xd4, 0x3c, 0x3e, 0x5f, 0xd4, 0xbe, 0x2a, 0x1a, 0x51, 0x3d,
-  0x59, 0x5d, 0x40, 0x3b, 0xfb, 0xfa, 0x9c, 0xbc, 0xd3, 0x23, 0xa7, 0xbd,
-  0xd5, 0x20, 0x86, 0xbd, 0x1e, 0x58, 0x65, 0x3d, 0x4f, 0xae, 0x6a, 0x3d,
-  0xef, 0xa7, 0x6c, 0xbe, 0x12, 0xc4, 0x99, 0x3c, 0xb2, 0x1c, 0x3b, 0xbc,
-  0xf7, 0xee, 0x9b, 0x3c, 0xb5, 0xe8, 0xdb, 0xbc, 0x72, 0xb9, 0xee, 0xbd,
-  0xe0, 0x87, 0xcd, 0xbc, 0xb4, 0x91, 0x3d, 0xbd, 0x1f, 0x3f, 0x81, 0xbc,
-  0x5b, 0x25, 0x54, 0x3d, 0x06, 0x1b, 0x1e, 0xbe, 0x29, 0xf8, 0xe5, 0xbc,
-  0xff, 0xc5, 0x3e, 0xbd, 0xbd, 0x42, 0x65, 0xbd, 0xd8, 0xf8, 0x7f, 0x3c,
-  0x8f, 0x8e, 0x83, 0xbd, 0x03, 0xd6, 0xd8, 0x3d, 0xce, 0xe4, 0xae, 0x3d,
-  0xe6, 0xbe, 0x9f, 0xbd, 0xa0, 0xd2, 0xd5, 0x3d, 0xc7, 0xe9, 0x81, 0xbd,
-  0xf9, 0x07, 0x9b, 0x3d, 0x4a, 0x74, 0x0a, 0xbd, 0xc5, 0xd8, 0xf3, 0x3c,
-  0xf9, 0x85, 0x14, 0x3e, 0x7e, 0xdf, 0xf4, 0x3d, 0x3f, 0xb1, 0xe7, 0xbc,
-  0x5e, 0xcf, 0x09, 0x3e, 0x5c, 0xa3, 0x9d, 0x3d, 0xcf, 0x33, 0x74, 0x3d,
-  0xe5, 0xe2, 0xad, 0x3c, 0xf7, 0xf2, 0x49, 0x3d, 0x2b, 0xa7, 0x29, 0x3e,
-  0x6e, 0xad, 0x8e, 0x3d, 0x51, 0x43, 0x52, 0xbd, 0x9f, 0xcb, 0xd9, 0x3d,
-  0xdd, 0xbb, 0x8a, 0x3c, 0x85, 0xd3, 0xcf, 0x3d, 0x9f, 0x03, 0x66, 0x3d,
-  0x15, 0xca, 0xde, 0xbc, 0x7d, 0xa0, 0x09, 0xbc, 0x95, 0xa5, 0x6a, 0xbd,
-  0x8b, 0x2a, 0xbd, 0xbb, 0x7c, 0x93, 0xa2, 0x3c, 0x40, 0x11, 0x35, 0x3d,
-  0xb4, 0x12, 0x1f, 0xbe, 0x55, 0x67, 0x7a, 0x3d, 0x60, 0x56, 0x9b, 0xbc,
-  0x71, 0xb2, 0xc8, 0xbd, 0xf5, 0x74, 0x9b, 0xbc, 0x7f, 0xf5, 0x1b, 0x3d,
-  0x50, 0x97, 0xb7, 0x3b, 0x76, 0x98, 0xd1, 0x3c, 0x1c, 0x95, 0xf0, 0xbd,
-  0x58, 0xf7, 0xc0, 0xbc, 0xf3, 0x46, 0x60, 0x3d, 0x19, 0x81, 0xa2, 0xbe,
-  0x48, 0x8c, 0x85, 0x3d, 0x3f, 0xe2, 0x8f, 0x3d, 0x98, 0x30, 0xa3, 0x3d,
-  0x22, 0x17, 0xb3, 0x3c, 0xd6, 0xd6, 0x0a, 0xbe, 0xc8, 0x13, 0x87, 0xbc,
-  0xc2, 0x9d, 0xa9, 0x3d, 0x06, 0xe1, 0x21, 0xbe, 0xe2, 0x65, 0xce, 0xbb,
-  0xc1, 0xf3, 0xcb, 0x3d, 0x41, 0x3b, 0x92, 0xbc, 0x66, 0xb1, 0xc6, 0xbc,
-  0x28, 0x16, 0xa4, 0xbd, 0x9a, 0x10, 0x6f, 0x3c, 0x0e, 0x86, 0x67, 0x3d,
-  0x72, 0xe4, 0x1b, 0xbe, 0xad, 0x9b, 0x25, 0xbe, 0xea, 0xc7, 0x01, 0xbe,
-  0xf7, 0x4b, 0x68, 0xbe, 0x4c, 0x52, 0x0f, 0xbe, 0xde, 0xe5, 0x99, 0xbd,
-  0x8e, 0x60, 0xb3, 0xbe, 0xd2, 0xb1, 0x1f, 0xbe, 0x25, 0xe5, 0x29, 0xbe,
-  0x31, 0x95, 0x03, 0xbe, 0x00, 0x8d, 0x7c, 0xbd, 0x96, 0x9e, 0x02, 0xbe,
-  0x71, 0xa8, 0x32, 0xbe, 0x5c, 0xb4, 0xef, 0xbd, 0x69, 0x3b, 0x49, 0xbd,
-  0x32, 0x87, 0xdd, 0xbd, 0xaa, 0xfd, 0x82, 0xbe, 0x50, 0xf3, 0x36, 0xbe,
-  0xf2, 0x68, 0x21, 0xbd, 0x5d, 0x31, 0x0e, 0xbe, 0x9c, 0xf4, 0x4b, 0xbd,
-  0x89, 0xbf, 0xc8, 0xbd, 0xb1, 0xbc, 0x60, 0xbd, 0xca, 0xc5, 0x3d, 0xbe,
-  0xba, 0x6b, 0xa6, 0xbe, 0x37, 0xe7, 0x10, 0xbe, 0xbd, 0x57, 0x3d, 0x3d,
-  0x1f, 0x3b, 0x86, 0xbc, 0x9b, 0x48, 0x98, 0xbd, 0x85, 0xb0, 0xb1, 0x3c,
-  0x4d, 0x91, 0x63, 0xbd, 0xf0, 0x51, 0xfa, 0xbd, 0x31, 0x21, 0x55, 0xbe,
-  0x52, 0x7f, 0x43, 0x3d, 0xdb, 0x53, 0x42, 0xbd, 0xdd, 0xf9, 0xae, 0xbd,
-  0x1a, 0xb0, 0x9b, 0xbd, 0xfb, 0xa9, 0xf1, 0xbb, 0x3d, 0x15, 0x82, 0xbd,
-  0x9f, 0x14, 0x59, 0xbc, 0x93, 0xd6, 0x46, 0x3d, 0xc6, 0x9a, 0x03, 0xbd,
-  0x82, 0xce, 0x57, 0xbd, 0x02, 0xbf, 0xb4, 0xbd, 0x7a, 0xfe, 0x85, 0xbd,
-  0xce, 0x22, 0x5f, 0x3d, 0x1a, 0x96, 0xd9, 0xbd, 0xc9, 0x16, 0x42, 0xbd,
-  0x3e, 0xdc, 0x3e, 0x3e, 0x43, 0x62, 0xa5, 0x3c, 0x6d, 0x83, 0x95, 0x3d,
-  0xe9, 0x1d, 0x2c, 0x3d, 0x71, 0x58, 0x95, 0xbc, 0xcd, 0x17, 0xb0, 0x3d,
-  0xba, 0xb5, 0x6c, 0x3d, 0xff, 0xeb, 0xd3, 0x3b, 0xbb, 0xb3, 0x7d, 0x3e,
-  0xdb, 0x2e, 0xf4, 0x3d, 0xc3, 0xec, 0xe8, 0x3c, 0xa3, 0x32, 0x8f, 0x3c,
-  0x9b, 0x1c, 0x52, 0x3d, 0x69, 0x14, 0x97, 0x3d, 0x35, 0xf4, 0x97, 0x3d,
-  0x12, 0x5b, 0x88, 0x3d, 0x7e, 0x52, 0x74, 0x3e, 0x19, 0xa4, 0x69, 0x3d,
-  0x72, 0x0f, 0x74, 0x3d, 0xd1, 0x98, 0x53, 0x3d, 0xff, 0x11, 0x83, 0x3d,
-  0x52, 0x9c, 0xf1, 0xbc, 0xf5, 0x02, 0xb8, 0x3d, 0x1c, 0x79, 0x18, 0x3d,
-  0x73, 0x05, 0x8a, 0x3d, 0xe1, 0x1c, 0x5c, 0xbd, 0xf1, 0xf0, 0xc3, 0x3c,
-  0xed, 0x44, 0x80, 0x3c, 0xa2, 0x81, 0x16, 0xbb, 0xcd, 0xbb, 0x97, 0xbd,
-  0x39, 0xcf, 0x4a, 0xbc, 0x7a, 0xd3, 0x80, 0xbc, 0xb1, 0x63, 0x94, 0xbd,
-  0xac, 0xae, 0x86, 0x3d, 0xad, 0x25, 0xa8, 0x3c, 0xa8, 0x71, 0xc8, 0x3c,
-  0x28, 0x5e, 0x5f, 0x3d, 0xd6, 0x7b, 0xba, 0xbd, 0x16, 0xf5, 0xde, 0x38,
-  0x6d, 0xd4, 0x7e, 0x3d, 0xa1, 0xbf, 0x79, 0xbe, 0x6e, 0x88, 0x3f, 0xbd,
-  0x27, 0xe9, 0xb0, 0x3d, 0x6b, 0xa2, 0x9e, 0x3d, 0x22, 0x40, 0x08, 0xbc,
-  0x33, 0x39, 0x24, 0xbe, 0x88, 0x62, 0x5b, 0x3d, 0xff, 0xf3, 0x7f, 0x3d,
-  0x28, 0xd3, 0x1e, 0xbe, 0x89, 0x16, 0x15, 0x3d, 0xfd, 0xd3, 0x5e, 0x3d,
-  0x56, 0xc1, 0xa4, 0xbd, 0xf6, 0x6c, 0x91, 0xbc, 0xff, 0x4f, 0xb1, 0xbd,
-  0xd0, 0xae, 0xab, 0xbc, 0x0b, 0xb0, 0xb1, 0xbd, 0xf1, 0x6a, 0xb7, 0xbd,
-  0x0f, 0xfe, 0x88, 0xbe, 0x7f, 0x39, 0x52, 0xbe, 0x46, 0xf7, 0x63, 0xbe,
-  0xc8, 0xf5, 0x86, 0xbe, 0xda, 0xfb, 0x4c, 0xbe, 0x50, 0x15, 0xaa, 0xbe,
-  0x23, 0xc3, 0x49, 0xbe, 0xda, 0x25, 0xf5, 0xbd, 0x07, 0x38, 0xcb, 0x3c,
-  0xe2, 0x76, 0x09, 0xbe, 0x39, 0x32, 0x64, 0xbc, 0x13, 0x52, 0x9b, 0xbd,
-  0xb4, 0x1c, 0x9c, 0xbd, 0x11, 0x48, 0xf4, 0xbd, 0xf2, 0x7d, 0xd6, 0xbd,
-  0xbc, 0xbd, 0x92, 0xbd, 0x62, 0x24, 0x54, 0xbe, 0x40, 0x57, 0x0c, 0xbe,
-  0x97, 0x48, 0x46, 0xbe, 0x4a, 0xbd, 0x29, 0xbe, 0x2f, 0x1c, 0x17, 0xbe,
-  0x21, 0x8e, 0x1c, 0xbe, 0x7f, 0x36, 0x38, 0xbe, 0xac, 0x1e, 0xbd, 0xbd,
-  0xb9, 0x1b, 0x72, 0xbe, 0xb0, 0xae, 0x68, 0xbd, 0x99, 0x7d, 0xa1, 0xbd,
-  0x73, 0x66, 0x50, 0xbe, 0x3b, 0x90, 0xc9, 0xbd, 0xa9, 0xa1, 0xdd, 0xbd,
-  0x79, 0x29, 0x33, 0xbe, 0xed, 0xbe, 0x1f, 0xbe, 0xc5, 0xc7, 0x36, 0xbe,
-  0x7d, 0x20, 0xf6, 0xbc, 0xef, 0x96, 0x81, 0xbd, 0x57, 0x84, 0x08, 0xbd,
-  0xe4, 0x91, 0xda, 0xbd, 0x3d, 0x85, 0x81, 0xbd, 0x51, 0xd4, 0xc8, 0xbd,
-  0xe7, 0xa9, 0xc5, 0xbd, 0x20, 0x58, 0xea, 0xbd, 0xef, 0x50, 0x8f, 0x3c,
-  0x62, 0x1d, 0x58, 0xbd, 0xa0, 0xa4, 0x85, 0xbd, 0x4f, 0x87, 0xd4, 0xbc,
-  0x6a, 0x8a, 0xfe, 0xbc, 0x05, 0x80, 0x33, 0xbd, 0xf9, 0xa3, 0x57, 0xbe,
-  0xed, 0xa8, 0xc0, 0xbd, 0x75, 0x90, 0x5a, 0x3c, 0x2e, 0x35, 0xdd, 0xbd,
-  0x27, 0x12, 0x03, 0xbd, 0x2f, 0xcb, 0xde, 0xbb, 0xbe, 0x43, 0x87, 0xbd,
-  0xa1, 0x27, 0x07, 0xbd, 0x7c, 0xf9, 0xae, 0xbd, 0x01, 0x32, 0xa1, 0xbd,
-  0x55, 0x19, 0x82, 0x3d, 0x8f, 0x24, 0x5e, 0x3c, 0x0f, 0xcb, 0xe0, 0x3c,
-  0xd8, 0x36, 0xa2, 0xbd, 0x23, 0xf8, 0x03, 0x3d, 0x52, 0x08, 0xfd, 0xbb,
-  0x5d, 0x27, 0x34, 0xbe, 0x17, 0x3e, 0xd5, 0xbd, 0x77, 0x7f, 0xd8, 0x3b,
-  0x69, 0x9d, 0x05, 0x3d, 0x47, 0x37, 0x8b, 0x3d, 0xe4, 0x3f, 0x3f, 0xbd,
-  0x73, 0xc1, 0x0f, 0x3d, 0x05, 0x12, 0xd6, 0xbb, 0xd8, 0xe2, 0xfa, 0xbd,
-  0x80, 0xca, 0x20, 0xbd, 0xf7, 0x74, 0xd0, 0x3c, 0x2c, 0xe0, 0xc3, 0x3d,
-  0xdf, 0xc4, 0xe0, 0xbb, 0xea, 0xf8, 0x2a, 0xbc, 0x75, 0x69, 0xb7, 0xbb,
-  0xf4, 0xcc, 0x8f, 0x3d, 0x72, 0x4c, 0xd6, 0xbd, 0xc2, 0x33, 0x2b, 0xbd,
-  0x99, 0x8a, 0x64, 0x3d, 0xac, 0xfa, 0x4a, 0x3c, 0x11, 0x30, 0xcc, 0x3d,
-  0xce, 0xcd, 0x6d, 0xbd, 0x33, 0xef, 0x03, 0x3d, 0x76, 0xfa, 0x5d, 0x3d,
-  0x98, 0x31, 0x02, 0xbe, 0x5f, 0xa4, 0x45, 0xbd, 0x2a, 0x16, 0x19, 0x3c,
-  0xde, 0x36, 0x28, 0xbe, 0x1e, 0xa7, 0x42, 0x3d, 0x7f, 0x0a, 0x50, 0xbd,
-  0x8b, 0x95, 0xd8, 0xbd, 0x2c, 0xfb, 0xad, 0xbd, 0x58, 0x62, 0x23, 0xbe,
-  0xee, 0x6d, 0x2e, 0xbe, 0x07, 0x69, 0xa5, 0xbc, 0x31, 0xa2, 0x83, 0xbd,
-  0x9a, 0xcc, 0xf1, 0xbc, 0xf5, 0x4e, 0x06, 0xbe, 0xc5, 0xfb, 0xba, 0xbd,
-  0x57, 0xbe, 0x2d, 0xbe, 0x91, 0xd6, 0x9e, 0xbd, 0x18, 0xca, 0x0a, 0xbe,
-  0x1a, 0x51, 0x05, 0xbe, 0x2f, 0x46, 0xd0, 0xbd, 0x5b, 0x25, 0x5c, 0xbe,
-  0x69, 0xb0, 0x8b, 0xbd, 0x8a, 0x31, 0x4d, 0xbe, 0xda, 0xed, 0x19, 0xbe,
-  0x3e, 0x82, 0x34, 0xbd, 0xbd, 0x87, 0x92, 0x3c, 0x3b, 0x22, 0x63, 0x3b,
-  0x39, 0xad, 0x90, 0x3c, 0xee, 0x27, 0xa3, 0xbc, 0xd9, 0xcc, 0xd4, 0xbc,
-  0xac, 0x7a, 0xe7, 0x3b, 0x7a, 0x97, 0xcf, 0xbc, 0x1b, 0x9a, 0xf7, 0xbc,
-  0x86, 0x69, 0x46, 0xbd, 0x2b, 0xc0, 0xd1, 0xbc, 0x0d, 0x07, 0x42, 0x3d,
-  0xd0, 0xec, 0x80, 0xbd, 0x58, 0xe0, 0x03, 0xbd, 0x28, 0xa1, 0xd4, 0xbc,
-  0x4e, 0xca, 0x9a, 0xbb, 0x3b, 0xac, 0x75, 0xbd, 0x1c, 0x04, 0xb0, 0xbd,
-  0x5e, 0xb2, 0xa3, 0xbd, 0xa7, 0xeb, 0x53, 0xbd, 0x96, 0x5a, 0x13, 0x3d,
-  0x19, 0x02, 0x0f, 0xbd, 0x28, 0x1f, 0x38, 0xbc, 0x01, 0x9b, 0xf1, 0x3c,
-  0xe4, 0xf6, 0x7a, 0xbc, 0x45, 0xb7, 0x7e, 0xbd, 0xb3, 0x55, 0xb5, 0xbd,
-  0x85, 0x6f, 0x75, 0xbd, 0xa1, 0x11, 0x51, 0x3d, 0xb8, 0x31, 0x07, 0xbe,
-  0xbf, 0x15, 0x66, 0x3b, 0x27, 0x21, 0xb8, 0xbd, 0x99, 0x8d, 0xd7, 0xbd,
-  0x83, 0xb4, 0x27, 0xbe, 0x51, 0x74, 0x02, 0xbe, 0x54, 0x57, 0xed, 0xbd,
-  0x00, 0xb9, 0xef, 0xbd, 0xe8, 0xd4, 0xa3, 0xbd, 0x4f, 0x23, 0x8a, 0xbd,
-  0xb9, 0x35, 0xf9, 0xbd, 0x56, 0x9c, 0x9e, 0xbd, 0x1c, 0x23, 0x95, 0xbe,
-  0x63, 0x1b, 0x37, 0xbe, 0xcb, 0x06, 0x85, 0xbe, 0x28, 0x7d, 0xbb, 0xbd,
-  0x08, 0x7a, 0xe3, 0xbd, 0x07, 0xf5, 0xb0, 0xbd, 0x1b, 0x98, 0x84, 0xbe,
-  0x13, 0x9a, 0x38, 0xbe, 0x86, 0x1b, 0x93, 0xbe, 0xfd, 0x05, 0x9c, 0xbe,
-  0x50, 0xf5, 0x88, 0xbe, 0x53, 0x7d, 0xc4, 0xbd, 0x8f, 0x2a, 0xcc, 0xbd,
-  0x62, 0xdf, 0x6f, 0xbe, 0xc5, 0x66, 0xa4, 0xbe, 0x7b, 0xcf, 0x70, 0xbe,
-  0x9d, 0x8e, 0x80, 0xbe, 0x2e, 0x62, 0xb3, 0xbe, 0x80, 0x5e, 0xa2, 0xbe,
-  0x69, 0xa6, 0x97, 0xbd, 0x4e, 0xaf, 0x16, 0xbe, 0xfc, 0x12, 0x27, 0xbe,
-  0xe3, 0xd7, 0x86, 0xbe, 0xae, 0x82, 0x18, 0xbe, 0xc4, 0x9b, 0x44, 0xbe,
-  0xa9, 0xee, 0x80, 0xbe, 0x8f, 0xe6, 0x02, 0xbe, 0x73, 0xf9, 0x20, 0xbe,
-  0x38, 0x95, 0xd3, 0xbd, 0xb0, 0x4d, 0x2e, 0xbe, 0x73, 0x4b, 0xdf, 0xbd,
-  0x8a, 0x4b, 0x16, 0xbe, 0xb9, 0x25, 0x5c, 0xbe, 0xda, 0x60, 0x05, 0xbe,
-  0x9b, 0xbf, 0x14, 0xbe, 0xe8, 0xb2, 0x14, 0xbe, 0xbe, 0x74, 0xd1, 0xbd,
-  0x1e, 0xda, 0xc2, 0xbd, 0x0c, 0x37, 0x45, 0xbe, 0x48, 0x56, 0x07, 0xbe,
-  0xec, 0xc2, 0xe4, 0xbd, 0xde, 0xe1, 0x25, 0xbe, 0x38, 0x2b, 0x00, 0xbe,
-  0xaf, 0x2b, 0x21, 0xbd, 0x7f, 0x7d, 0xd5, 0xbc, 0xd8, 0xc8, 0x0a, 0xbe,
-  0x39, 0xcc, 0x6f, 0xbd, 0xf2, 0xcd, 0x8a, 0xba, 0x1f, 0x36, 0x35, 0xbd,
-  0x34, 0x5c, 0xbe, 0xbd, 0xe6, 0x0f, 0x54, 0x3b, 0x45, 0xd8, 0xa8, 0xbd,
-  0x67, 0x2f, 0xed, 0xbd, 0x58, 0xac, 0x7d, 0xbd, 0x3e, 0x07, 0x34, 0xbd,
-  0x10, 0x8b, 0x86, 0xbd, 0xd2, 0xbc, 0x85, 0xbd, 0x08, 0x7e, 0x6f, 0xbc,
-  0x26, 0x10, 0x02, 0x3d, 0xbb, 0x09, 0x30, 0x3d, 0xad, 0x0b, 0x65, 0xbd,
-  0xa9, 0x1b, 0x3e, 0xbd, 0xd0, 0x15, 0x91, 0x3d, 0x49, 0xa4, 0xbe, 0xbd,
-  0x13, 0xde, 0xbc, 0xbd, 0x54, 0x53, 0x6d, 0xbc, 0x0d, 0x31, 0x23, 0xbd,
-  0xf5, 0xde, 0x1d, 0x3d, 0xd0, 0xd0, 0x05, 0xbe, 0x91, 0x14, 0x81, 0xbd,
-  0xc3, 0xfd, 0x80, 0xbc, 0x86, 0x2c, 0x33, 0xbd, 0x8a, 0x44, 0x20, 0xbe,
-  0xe4, 0x6d, 0xcc, 0xbd, 0x4e, 0xd4, 0xa6, 0xbb, 0x82, 0x1d, 0x9b, 0xbd,
-  0xec, 0xf7, 0xab, 0xbd, 0x53, 0x42, 0x87, 0xbc, 0xc4, 0x31, 0xb9, 0x3b,
-  0xb5, 0xdf, 0x0c, 0xbe, 0xd0, 0x22, 0x74, 0xbe, 0x7b, 0x5a, 0x7a, 0xbe,
-  0x56, 0x4e, 0x3c, 0xbe, 0x5d, 0xd9, 0x95, 0xbd, 0x39, 0x56, 0x11, 0xbe,
-  0xbb, 0xcc, 0x9d, 0xbd, 0xe4, 0x12, 0xe5, 0xbd, 0xa5, 0x51, 0x0e, 0xbe,
-  0x45, 0x2a, 0x43, 0xbe, 0x83, 0x0e, 0xa0, 0xbe, 0x66, 0x15, 0x82, 0xbe,
-  0xe7, 0x0d, 0x02, 0xbe, 0x8c, 0x11, 0x6b, 0xbd, 0x9c, 0xdb, 0x27, 0xbe,
-  0xcd, 0x99, 0x40, 0xbe, 0x1d, 0x52, 0x8f, 0xbc, 0xe1, 0x8e, 0xdc, 0x3c,
-  0x3f, 0xa0, 0x4a, 0xbe, 0x69, 0x9c, 0xda, 0xbd, 0x6d, 0xf2, 0x74, 0xbe,
-  0x82, 0xb4, 0x99, 0xbd, 0xef, 0xb8, 0xa6, 0xbe, 0x2e, 0x6e, 0x52, 0xbe,
-  0x73, 0xd5, 0x4f, 0x3d, 0x94, 0xa5, 0x56, 0x3c, 0x10, 0xab, 0x9e, 0xbd,
-  0xb9, 0x43, 0x0d, 0xbd, 0x5a, 0xb7, 0xa7, 0xbe, 0xad, 0xad, 0xa6, 0xbd,
-  0x4e, 0x01, 0x31, 0xbe, 0x52, 0xb3, 0xbb, 0xbd, 0x0d, 0xa3, 0x40, 0xbd,
-  0x28, 0xa3, 0x13, 0xbe, 0x95, 0xee, 0xcf, 0xbd, 0x6d, 0x35, 0x67, 0xbd,
-  0xed, 0x05, 0x52, 0xbe, 0xf6, 0xab, 0x98, 0xbd, 0x27, 0xec, 0xb1, 0xbd,
-  0x16, 0x54, 0xf4, 0xbd, 0x9e, 0x45, 0x8b, 0xbd, 0xe0, 0x83, 0x2c, 0xbe,
-  0x9f, 0xc1, 0x1e, 0xbe, 0x14, 0xc7, 0x43, 0xbe, 0xdf, 0xad, 0xa1, 0xbe,
-  0xe9, 0x39, 0x13, 0xbd, 0x2c, 0x90, 0x45, 0xbe, 0xdd, 0xae, 0x44, 0xbe,
-  0x42, 0x18, 0x3d, 0xbe, 0xbf, 0xc2, 0xe3, 0xbd, 0x14, 0x23, 0x51, 0xbe,
-  0x86, 0xd2, 0x1e, 0xbe, 0x09, 0x08, 0x2e, 0xbe, 0x1d, 0x15, 0xc7, 0xbc,
-  0xc0, 0x5e, 0x74, 0xbe, 0x3f, 0xf1, 0x0b, 0xbe, 0xdd, 0x83, 0x85, 0xbd,
-  0x12, 0x57, 0x23, 0xbe, 0x4e, 0x04, 0xbe, 0xbd, 0x33, 0x2c, 0xe1, 0xbd,
-  0x34, 0xca, 0x07, 0xbe, 0xa1, 0xa8, 0x8f, 0xbd, 0x8a, 0x99, 0x20, 0xbe,
-  0x05, 0x1a, 0x63, 0xbe, 0x75, 0x41, 0xc1, 0xbd, 0x7e, 0x05, 0xb5, 0xbe,
-  0x24, 0xf8, 0xad, 0xbd, 0x17, 0x46, 0x18, 0xbd, 0x12, 0xca, 0x83, 0xbe,
-  0x75, 0x26, 0xab, 0xbd, 0xa0, 0xcd, 0x27, 0xbe, 0x81, 0x11, 0x95, 0xbe,
-  0xa5, 0x82, 0x20, 0xbe, 0x14, 0x52, 0x91, 0xbe, 0x34, 0xe2, 0x8a, 0xbe,
-  0x81, 0x7d, 0x7c, 0xbe, 0x3e, 0xbe, 0x18, 0xbe, 0xd4, 0x8d, 0x56, 0xbd,
-  0x76, 0x98, 0xa0, 0xbe, 0xa1, 0x38, 0x5e, 0xbe, 0xfb, 0xaf, 0xb6, 0xbd,
-  0xd1, 0xe3, 0xbd, 0xbd, 0x6b, 0x5d, 0x58, 0xbe, 0xb4, 0x35, 0xf3, 0xbd,
-  0x47, 0x25, 0xa9, 0xbc, 0xa6, 0x40, 0xc9, 0xbd, 0x8e, 0x1c, 0x51, 0xbe,
-  0x0f, 0x4d, 0xb9, 0xbc, 0xbf, 0xb1, 0x96, 0xbd, 0x64, 0x6f, 0x4f, 0xbe,
-  0x9f, 0x03, 0x06, 0xbe, 0xe3, 0xef, 0x19, 0xbe, 0x12, 0xb1, 0xb7, 0x3c,
-  0x1c, 0x1b, 0x86, 0xbd, 0xfb, 0x11, 0xc8, 0xbd, 0x87, 0x2c, 0x83, 0xbd,
-  0x11, 0x62, 0x2c, 0xbe, 0xed, 0xd3, 0x3e, 0xbe, 0xa5, 0x65, 0xa1, 0xbe,
-  0x58, 0x05, 0x7f, 0xbe, 0x1e, 0x2f, 0x31, 0xbd, 0x22, 0x7e, 0x9b, 0xbd,
-  0xe1, 0x6a, 0x4a, 0xbe, 0x86, 0xe7, 0x5c, 0xbe, 0x35, 0xdf, 0xd0, 0xbd,
-  0x5d, 0xbb, 0xaa, 0xbd, 0xb1, 0xbf, 0xd4, 0xbd, 0x67, 0xbb, 0x58, 0xbe,
-  0x4f, 0x7d, 0x7e, 0xbe, 0x1d, 0x26, 0x01, 0xbd, 0xae, 0x28, 0x73, 0xbe,
-  0xb7, 0x96, 0x0c, 0xbe, 0xe7, 0x19, 0x71, 0xb9, 0xd4, 0x87, 0x47, 0xbc,
-  0x52, 0x68, 0x00, 0xbe, 0x0d, 0x35, 0x01, 0xbc, 0x43, 0x96, 0x6b, 0xbe,
-  0x4d, 0xe8, 0x23, 0xbe, 0xff, 0xa0, 0xed, 0xbd, 0x80, 0xc9, 0xf7, 0xbd,
-  0x30, 0x82, 0x19, 0x3d, 0xbe, 0x4a, 0xe6, 0xbd, 0x73, 0x3d, 0xa2, 0x3d,
-  0x6b, 0x31, 0x99, 0x3c, 0x5b, 0xe6, 0xa1, 0xbc, 0x22, 0x07, 0x50, 0xbe,
-  0x35, 0x2b, 0xa3, 0x3c, 0xe0, 0x21, 0x4b, 0x3d, 0x60, 0x17, 0xc2, 0x3d,
-  0x2f, 0xa5, 0x83, 0xbc, 0x6d, 0xbd, 0xac, 0x3d, 0x45, 0x64, 0x8f, 0x3d,
-  0xf2, 0x07, 0xa0, 0x3d, 0x5f, 0x4e, 0x20, 0xbd, 0x60, 0x68, 0xad, 0x3d,
-  0x69, 0xbb, 0x93, 0xbc, 0xba, 0x3a, 0x14, 0x3e, 0xb9, 0xcb, 0x04, 0x3e,
-  0x51, 0xf0, 0x93, 0xbc, 0x9b, 0xd5, 0xac, 0xbc, 0xb8, 0xfb, 0x22, 0x3e,
-  0xcc, 0xec, 0x85, 0x3e, 0x16, 0x30, 0xd1, 0xbc, 0x0b, 0x38, 0x9c, 0x3d,
-  0x63, 0x58, 0x1c, 0x3e, 0x1f, 0x1f, 0x1c, 0x3e, 0x06, 0x8c, 0xc9, 0xbc,
-  0x5e, 0xa6, 0x51, 0xbd, 0x50, 0x56, 0xf7, 0x3d, 0x4a, 0x28, 0x20, 0x3e,
-  0x82, 0xcf, 0x84, 0xbd, 0xa1, 0x23, 0x0f, 0x3d, 0x16, 0xc3, 0x91, 0x3d,
-  0x78, 0x20, 0x3d, 0x3d, 0x79, 0xde, 0xb2, 0xbb, 0x0e, 0x83, 0x8f, 0x3b,
-  0xf3, 0x9e, 0xc4, 0xbd, 0xb5, 0x4b, 0x42, 0x3e, 0xc1, 0xfa, 0x35, 0xbd,
-  0xed, 0x7c, 0xe0, 0x3b, 0xc4, 0xcb, 0x55, 0xbc, 0x2b, 0xa8, 0x2d, 0x3d,
-  0x87, 0xa0, 0x20, 0xbd, 0x7a, 0x7f, 0xaf, 0xbd, 0xd5, 0xb0, 0xf5, 0xbd,
-  0x63, 0xab, 0x25, 0xbd, 0xa3, 0x14, 0x17, 0xbe, 0x30, 0x72, 0xd0, 0xbd,
-  0xa2, 0xf6, 0x85, 0x3c, 0xe1, 0xb6, 0x4c, 0xbd, 0xc2, 0xa8, 0x9a, 0xbd,
-  0x1d, 0x5b, 0xdf, 0xbc, 0x3a, 0xc6, 0xa2, 0xbe, 0x17, 0x6b, 0xe7, 0xbc,
-  0x17, 0x6d, 0xfc, 0xbd, 0x6d, 0xdd, 0x06, 0xbe, 0xcf, 0x03, 0xd5, 0xbd,
-  0xfe, 0x90, 0x8d, 0xbe, 0x95, 0x6c, 0x0d, 0xbe, 0xbe, 0xc1, 0x06, 0xbe,
-  0x48, 0x85, 0xec, 0xbe, 0xf8, 0x72, 0xb2, 0xbd, 0x6e, 0xd4, 0x96, 0xbe,
-  0xdf, 0x09, 0x57, 0xbe, 0x4d, 0xfa, 0x21, 0xbe, 0xf3, 0x4b, 0x38, 0xbe,
-  0x86, 0xea, 0xee, 0xbd, 0x04, 0x42, 0xbf, 0xbd, 0xd7, 0xea, 0x88, 0xbe,
-  0x30, 0xb3, 0xc5, 0xb9, 0x1e, 0x9a, 0xb6, 0xbd, 0xc4, 0xcd, 0x5f, 0xbe,
-  0xa7, 0x96, 0x22, 0xbd, 0x0c, 0x16, 0xc7, 0xbd, 0xd9, 0xfa, 0x6e, 0xbe,
-  0xc3, 0xe8, 0x55, 0xbe, 0x2b, 0x89, 0x06, 0xbe, 0x33, 0x56, 0x71, 0xbd,
-  0x1e, 0x34, 0x63, 0xbe, 0x45, 0x49, 0x94, 0xbe, 0xe2, 0x49, 0x26, 0xbe,
-  0x31, 0x32, 0x7f, 0xbd, 0x78, 0xc5, 0x18, 0xbe, 0xf4, 0x08, 0x01, 0xbe,
-  0xe7, 0x4d, 0x84, 0xbe, 0xe8, 0x5a, 0x25, 0xbe, 0x4c, 0xb9, 0x32, 0xbe,
-  0x81, 0x6e, 0x52, 0xbe, 0x93, 0x6a, 0x9a, 0x3d, 0xde, 0xa8, 0x1a, 0xbd,
-  0x76, 0xfd, 0xc9, 0xbd, 0x30, 0x84, 0x3f, 0x3d, 0xcc, 0xeb, 0x0d, 0xbe,
-  0x24, 0xf3, 0x26, 0xbe, 0xdd, 0xe0, 0xa1, 0xbd, 0xdb, 0x60, 0x17, 0xbd,
-  0x70, 0xc7, 0xa6, 0x3d, 0x5a, 0x48, 0x5a, 0xbd, 0x43, 0xd1, 0xb1, 0xbd,
-  0x7d, 0xb7, 0x6d, 0x3d, 0x59, 0x0d, 0xc2, 0xbb, 0x19, 0x15, 0x75, 0xbe,
-  0x26, 0x78, 0xc8, 0x3b, 0x3a, 0xd7, 0x09, 0x3d, 0xe5, 0xa5, 0xd1, 0x3c,
-  0xda, 0x28, 0xba, 0xbd, 0xd4, 0xf9, 0xbf, 0xbd, 0x82, 0x2f, 0x8d, 0x3c,
-  0x37, 0x5f, 0x1d, 0x3e, 0x3f, 0xe9, 0xa3, 0xbd, 0x4b, 0xed, 0x39, 0x3d,
-  0x84, 0xfd, 0x00, 0xbd, 0x85, 0x5e, 0x5a, 0x3e, 0x0e, 0x92, 0xcf, 0x3c,
-  0x29, 0x87, 0x04, 0x3d, 0x9b, 0x8d, 0x18, 0x3c, 0xd8, 0x2f, 0x5c, 0x3e,
-  0xb2, 0x87, 0x70, 0x3e, 0x9d, 0xf5, 0x8a, 0x3d, 0xd6, 0x24, 0xde, 0x3d,
-  0xd3, 0xfe, 0x96, 0x3e, 0x8c, 0x36, 0xdd, 0x3d, 0xae, 0xad, 0xb0, 0x3d,
-  0xe7, 0x89, 0x2a, 0x3e, 0x8e, 0x6f, 0x03, 0x3e, 0x69, 0xa5, 0x7b, 0x3e,
-  0x1a, 0xf8, 0x35, 0x3e, 0x64, 0xaa, 0xff, 0x3d, 0x46, 0x5e, 0x8a, 0x3e,
-  0x79, 0x60, 0x3e, 0x3e, 0x9f, 0x88, 0x91, 0x3d, 0x44, 0x7e, 0x56, 0x3d,
-  0xd2, 0x00, 0x2d, 0x3e, 0x94, 0x70, 0x74, 0x3e, 0x5a, 0xeb, 0x45, 0x3e,
-  0x6d, 0x0b, 0x8d, 0x3d, 0xa5, 0x99, 0x45, 0x3d, 0x16, 0xeb, 0x72, 0x3d,
-  0xf7, 0x26, 0x9b, 0x3d, 0x5a, 0xae, 0x0d, 0xbc, 0x72, 0x39, 0x0a, 0xbd,
-  0x70, 0x99, 0x2d, 0x3e, 0x72, 0xd1, 0xb9, 0xbb, 0x24, 0xd4, 0x52, 0x3d,
-  0x5f, 0x89, 0x9b, 0xbd, 0xd6, 0x89, 0xac, 0x3d, 0x69, 0xf8, 0xa4, 0xbd,
-  0x3a, 0xf2, 0x81, 0xbd, 0x24, 0x49, 0x93, 0xbd, 0x06, 0x56, 0xe3, 0x3d,
-  0x88, 0xf2, 0x92, 0xbd, 0x5f, 0x09, 0xaa, 0xba, 0xd3, 0x9a, 0xe3, 0xbd,
-  0xc7, 0xf2, 0x0b, 0x3d, 0x9f, 0x48, 0x78, 0xbc, 0xe7, 0xf4, 0xc1, 0xbd,
-  0x4a, 0x14, 0x02, 0xbe, 0xc6, 0x50, 0x38, 0xbd, 0xec, 0xfd, 0xd0, 0xbd,
-  0x93, 0x32, 0x07, 0xbd, 0x0d, 0xa8, 0x46, 0xbd, 0x16, 0x2a, 0xe0, 0xbd,
-  0x1b, 0x37, 0x9b, 0xbd, 0x49, 0xb9, 0x7c, 0xbe, 0x21, 0xb7, 0x5a, 0xbe,
-  0xef, 0xea, 0xde, 0xbd, 0xf1, 0xb7, 0x2d, 0xbe, 0x10, 0xa7, 0xdc, 0xbd,
-  0xa9, 0xda, 0xb2, 0xbd, 0x13, 0x5c, 0x7a, 0xbe, 0x10, 0x3f, 0x08, 0xbe,
-  0xf1, 0x74, 0x62, 0xbe, 0x59, 0x08, 0x23, 0xbe, 0x5f, 0x2f, 0xb0, 0xbd,
-  0x0b, 0x09, 0x66, 0xbe, 0xcf, 0x32, 0x47, 0xbe, 0x1e, 0x56, 0x07, 0xbe,
-  0x4a, 0xf8, 0x56, 0xbe, 0xfd, 0x69, 0x2b, 0xbe, 0x7b, 0xcf, 0x10, 0xbe,
-  0x93, 0x5a, 0x75, 0xbe, 0x69, 0xf0, 0x33, 0xbd, 0x52, 0x7b, 0xf1, 0xbd,
-  0x87, 0x87, 0x5e, 0xbe, 0xd7, 0xf9, 0xb1, 0x3c, 0xbf, 0x19, 0x9a, 0xbc,
-  0xed, 0xa0, 0x9b, 0xbd, 0xbe, 0xeb, 0x9c, 0xbd, 0x23, 0xe8, 0x97, 0xbe,
-  0x91, 0xb7, 0x0b, 0xbe, 0x01, 0xc4, 0xbb, 0xbd, 0x7c, 0xb3, 0x1c, 0x3d,
-  0xa0, 0x60, 0x84, 0x3d, 0x94, 0x46, 0xcb, 0x3d, 0x01, 0x66, 0x56, 0x3d,
-  0xdb, 0x42, 0x0c, 0x3e, 0x13, 0x31, 0x39, 0x3a, 0x6b, 0x7c, 0xa6, 0xbe,
-  0x9c, 0x75, 0x3c, 0x3d, 0xcf, 0x9b, 0x12, 0x3d, 0x67, 0xbc, 0x00, 0x3d,
-  0xad, 0x79, 0xeb, 0xbc, 0xf9, 0x41, 0xf9, 0xbc, 0x99, 0xef, 0xc3, 0x3d,
-  0xc4, 0xe7, 0xc6, 0x3d, 0xd6, 0xe7, 0xcf, 0xbe, 0xae, 0xa2, 0x79, 0x3c,
-  0xf1, 0xbb, 0xac, 0x3d, 0xa9, 0x7a, 0xec, 0x3d, 0x13, 0x7b, 0xd4, 0x3c,
-  0xe4, 0x9b, 0xd6, 0x3b, 0x78, 0x53, 0xe8, 0x3d, 0x69, 0x20, 0x3a, 0x3d,
-  0x29, 0xcb, 0x81, 0xbe, 0x5d, 0x65, 0x60, 0x3d, 0x89, 0xee, 0xcf, 0x3c,
-  0x87, 0xa3, 0x4c, 0x3e, 0x0f, 0x39, 0x11, 0xbd, 0xc3, 0xcd, 0xf9, 0x3c,
-  0xc9, 0xc6, 0x0f, 0x3e, 0x55, 0x76, 0x72, 0x3d, 0x65, 0x29, 0x2d, 0xbe,
-  0xd8, 0x3e, 0xbc, 0x3d, 0xd7, 0x2f, 0x93, 0x3d, 0xb5, 0xdc, 0x0a, 0x3e,
-  0x6c, 0x35, 0x2a, 0xbd, 0x09, 0x54, 0xc9, 0xbc, 0xea, 0xdd, 0x07, 0x3e,
-  0xcf, 0xee, 0x1f, 0x3d, 0x28, 0xec, 0x7b, 0x3c, 0x04, 0x30, 0x8b, 0x3d,
-  0xa2, 0x35, 0x68, 0xba, 0x95, 0x3f, 0x43, 0x3d, 0x8a, 0x78, 0x10, 0x3d,
-  0x3a, 0xda, 0xa7, 0x3c, 0xec, 0xb5, 0x26, 0x3d, 0x86, 0x21, 0x87, 0xbc,
-  0x4c, 0xf1, 0x06, 0x3d, 0x9b, 0xaa, 0x07, 0x3e, 0x65, 0xb0, 0x4d, 0x3d,
-  0xda, 0xdd, 0x15, 0x3e, 0x99, 0x3e, 0x11, 0x3d, 0x4b, 0x65, 0x15, 0xbd,
-  0x1e, 0xc5, 0x7b, 0xbc, 0xf4, 0xe9, 0xb3, 0xb9, 0x28, 0x1d, 0xed, 0x3d,
-  0x7d, 0x01, 0xb7, 0xba, 0x4a, 0x52, 0x79, 0x3c, 0x24, 0x93, 0xda, 0xbc,
-  0x6f, 0x3b, 0xe2, 0x3d, 0x71, 0x5b, 0xc8, 0x3c, 0x4f, 0xba, 0xe5, 0xbd,
-  0x32, 0x5a, 0xd6, 0xbc, 0xe8, 0xac, 0xeb, 0x3d, 0x15, 0x7b, 0xef, 0xbc,
-  0xbd, 0x7d, 0x89, 0x3c, 0x32, 0xb7, 0x26, 0xbe, 0x79, 0xab, 0x1d, 0xbc,
-  0xe4, 0xe6, 0xa3, 0x3c, 0xdf, 0x12, 0xc6, 0xbd, 0x15, 0x67, 0xee, 0xbd,
-  0xbf, 0x3b, 0x10, 0x3d, 0xfb, 0x1b, 0x86, 0xba, 0x6a, 0x22, 0xc5, 0xbc,
-  0x3f, 0xdd, 0x04, 0xbe, 0x99, 0x81, 0xd2, 0xbc, 0xf4, 0x67, 0xb0, 0xbd,
-  0x0c, 0xa8, 0x1a, 0xbe, 0xc2, 0x77, 0x58, 0xbe, 0xfa, 0x3a, 0xa1, 0xbd,
-  0x76, 0x9f, 0x40, 0xbe, 0xf1, 0x38, 0xe2, 0xbd, 0x18, 0x51, 0x1f, 0xbe,
-  0xd9, 0xcf, 0x22, 0xbe, 0xef, 0xe0, 0xc6, 0xbd, 0x9b, 0xfb, 0x5c, 0xbe,
-  0xc2, 0x95, 0x47, 0xbe, 0x32, 0xfc, 0x32, 0xbd, 0x2d, 0x74, 0x70, 0xbe,
-  0xf6, 0xa2, 0x52, 0xbe, 0x39, 0xdd, 0xa4, 0xbd, 0x80, 0xc3, 0x9f, 0xbd,
-  0xbe, 0x3d, 0xfc, 0xbd, 0xd0, 0x99, 0x4c, 0xbe, 0xed, 0x51, 0x18, 0xbe,
-  0x17, 0x77, 0xff, 0xbd, 0xc6, 0xdf, 0x0d, 0xbe, 0xaa, 0x3b, 0x36, 0xbe,
-  0xde, 0xad, 0xf4, 0x3c, 0x4d, 0x33, 0xef, 0x3d, 0xc3, 0x21, 0x6a, 0x3d,
-  0x12, 0xd4, 0x25, 0x3e, 0xbf, 0x49, 0xa1, 0xbd, 0xeb, 0x6c, 0x3f, 0xbe,
-  0x81, 0x81, 0xa3, 0xbb, 0xfd, 0x37, 0xf9, 0x3d, 0xa8, 0xae, 0x2b, 0xbd,
-  0x5e, 0x21, 0x07, 0x3e, 0xfc, 0x1b, 0x15, 0x3c, 0x0b, 0x75, 0x07, 0x3d,
-  0x84, 0x55, 0x23, 0xbb, 0xc0, 0x3d, 0x7b, 0xbe, 0x87, 0x44, 0x09, 0x3e,
-  0x58, 0x70, 0x63, 0x3d, 0x13, 0xca, 0x0c, 0xbe, 0x7f, 0x63, 0xab, 0x3a,
-  0xa1, 0x83, 0xb3, 0x3d, 0x11, 0xef, 0x52, 0x3c, 0x47, 0x2b, 0xa7, 0x3c,
-  0xb3, 0x63, 0xbd, 0xbe, 0xc8, 0xee, 0x9c, 0x3d, 0xa7, 0x16, 0x90, 0x3d,
-  0x21, 0x4a, 0x0c, 0x3c, 0xa0, 0xe8, 0x0a, 0x3d, 0x03, 0xb5, 0xa4, 0xbc,
-  0x18, 0xff, 0x8f, 0x3d, 0x5f, 0xe9, 0x76, 0x3d, 0x39, 0xc0, 0x8a, 0xbe,
-  0x08, 0xeb, 0xfb, 0x3d, 0x66, 0xd3, 0x19, 0x3c, 0x78, 0x75, 0xb6, 0xbb,
-  0x9d, 0x99, 0x6d, 0xbc, 0x2a, 0x8a, 0xbf, 0xba, 0x33, 0x12, 0x84, 0xbc,
-  0xba, 0xff, 0x34, 0x3d, 0xaf, 0x0a, 0xe0, 0x3c, 0x00, 0xbf, 0x95, 0x3d,
-  0x4d, 0x60, 0x48, 0x3d, 0xf3, 0xfc, 0x62, 0x3e, 0x82, 0x26, 0x8a, 0xbc,
-  0x9c, 0xd5, 0x31, 0xbd, 0x9f, 0x44, 0xae, 0x3d, 0x83, 0xca, 0x83, 0x3d,
-  0x62, 0x04, 0xc3, 0x3c, 0x14, 0xba, 0xa5, 0x3d, 0xc3, 0x20, 0x96, 0x3c,
-  0x6e, 0xae, 0xa2, 0x3d, 0x56, 0x51, 0x1d, 0x3e, 0x92, 0x85, 0x6b, 0x3d,
-  0x8d, 0x6c, 0x82, 0x3b, 0xa8, 0xab, 0xb4, 0xbc, 0xa5, 0x8b, 0xb5, 0xbd,
-  0x3b, 0x52, 0x84, 0x3d, 0x73, 0xe9, 0x94, 0x3c, 0x5a, 0x8f, 0xb3, 0xbd,
-  0x5b, 0xc3, 0xf3, 0x3d, 0xe5, 0x09, 0xd4, 0x3d, 0xf2, 0x1d, 0x1c, 0xbd,
-  0x4a, 0xeb, 0xc2, 0xbd, 0x63, 0xbe, 0xe8, 0xbd, 0xa1, 0x66, 0x5c, 0x3d,
-  0x26, 0xdc, 0x94, 0x3d, 0xd1, 0x5e, 0xcf, 0xbd, 0x52, 0x8c, 0xaa, 0x3d,
-  0x82, 0xf6, 0xec, 0x3d, 0xee, 0x95, 0xd9, 0x3c, 0xc8, 0xb2, 0xae, 0xbd,
-  0x2d, 0x09, 0x7a, 0xbe, 0x32, 0x08, 0xad, 0x3d, 0xbd, 0x61, 0x59, 0x3d,
-  0x99, 0x5a, 0x06, 0xbe, 0x8b, 0x72, 0xb9, 0x3d, 0x4c, 0xe6, 0xa2, 0x39,
-  0x56, 0x19, 0xd0, 0x3d, 0x2a, 0x86, 0x61, 0xbd, 0x99, 0x4d, 0x93, 0xbe,
-  0xbe, 0xb2, 0xde, 0x3d, 0x9c, 0xb4, 0xf4, 0x3d, 0x01, 0x2f, 0x86, 0xbe,
-  0xe8, 0x31, 0x2c, 0x3c, 0x94, 0xcc, 0xb4, 0xbd, 0xc7, 0xd6, 0x53, 0xbd,
-  0xff, 0x1d, 0xdc, 0xbd, 0xb8, 0x30, 0x0f, 0xbe, 0x23, 0xc8, 0x8d, 0x3a,
-  0x3c, 0xa1, 0xa7, 0xbc, 0x72, 0x80, 0x23, 0xbe, 0xdc, 0xa3, 0x14, 0xbe,
-  0xbb, 0x12, 0x21, 0xbe, 0x23, 0xd4, 0x8e, 0xbe, 0x26, 0x48, 0x13, 0xbe,
-  0x63, 0x5c, 0x9c, 0xbd, 0x5f, 0x42, 0x52, 0xbe, 0xad, 0x9f, 0x28, 0xbe,
-  0x47, 0x8f, 0x01, 0xbd, 0x9d, 0x00, 0x94, 0xbc, 0x6c, 0xbf, 0x80, 0xbd,
-  0xb0, 0xf8, 0xea, 0xbd, 0x93, 0x1a, 0xf1, 0xbd, 0x6c, 0xf3, 0x07, 0xbe,
-  0x8b, 0x2b, 0x1c, 0xbe, 0x97, 0x6a, 0x2d, 0xbd, 0xdc, 0xc0, 0x1a, 0xbe,
-  0x24, 0x80, 0xca, 0x3c, 0xb6, 0x15, 0xcd, 0x3d, 0xfd, 0x34, 0xe8, 0x3d,
-  0x97, 0xd9, 0xc9, 0x3b, 0x6e, 0x22, 0x89, 0xbd, 0x81, 0x2e, 0x4e, 0x3e,
-  0xd7, 0xb2, 0x4d, 0x3d, 0x60, 0x71, 0x80, 0xbe, 0xe5, 0x06, 0xcc, 0x3d,
-  0x1e, 0x64, 0xd0, 0x3d, 0x23, 0x49, 0xa0, 0x3d, 0x40, 0x8d, 0xa3, 0x3d,
-  0x1a, 0x7b, 0x11, 0xbe, 0xb2, 0xd2, 0x24, 0x3d, 0x9a, 0x79, 0x5f, 0x3d,
-  0x36, 0xfc, 0x85, 0xbe, 0xdb, 0x45, 0xb4, 0x3d, 0xa0, 0x62, 0xd3, 0xbc,
-  0x08, 0x6e, 0x16, 0x3d, 0xe8, 0x71, 0x76, 0x3c, 0xde, 0xd0, 0x41, 0xbe,
-  0x41, 0x54, 0x9d, 0xbc, 0x62, 0x5c, 0x59, 0x3d, 0x0e, 0x87, 0x7f, 0xbe,
-  0xca, 0x8f, 0x0e, 0x3e, 0xc2, 0xed, 0xd6, 0xbc, 0xd6, 0x0a, 0x5e, 0xbd,
-  0x71, 0x00, 0xb1, 0xbd, 0x61, 0x11, 0x7c, 0xbb, 0x2f, 0xc8, 0x48, 0x3d,
-  0xad, 0x5c, 0xf0, 0xbc, 0x12, 0x58, 0xf2, 0x3d, 0x5e, 0x33, 0x1e, 0x3d,
-  0x08, 0xdb, 0x67, 0xbd, 0x30, 0x46, 0xd8, 0xbd, 0xa2, 0x2a, 0xe6, 0xbb,
-  0x76, 0xac, 0xf6, 0x3d, 0xe9, 0xc6, 0x46, 0xbd, 0x6b, 0x52, 0x24, 0x3c,
-  0x89, 0x3e, 0xb9, 0x3d, 0x1f, 0x3b, 0x34, 0x3d, 0xa5, 0xc9, 0x2c, 0xbd,
-  0xdf, 0x8a, 0x00, 0x3e, 0x72, 0x76, 0x79, 0x3e, 0x8b, 0x2e, 0x80, 0x3e,
-  0xd8, 0xc1, 0xf1, 0x3d, 0x75, 0xd6, 0x06, 0x3d, 0x76, 0xf1, 0xa3, 0xbc,
-  0xf4, 0xc3, 0x1f, 0x3e, 0xb1, 0x51, 0xd6, 0x3d, 0x8b, 0xf8, 0x8d, 0x3c,
-  0x33, 0xcf, 0xbf, 0x3c, 0x35, 0xa2, 0x01, 0xbc, 0x1f, 0x43, 0xb5, 0x3d,
-  0x30, 0x15, 0x00, 0x3d, 0xdb, 0xf1, 0x9e, 0xbe, 0xaf, 0xc2, 0xf6, 0x3c,
-  0x02, 0x18, 0x26, 0x3e, 0x7b, 0xd2, 0xa7, 0x3b, 0x27, 0x0c, 0x33, 0xbd,
-  0xc2, 0xa7, 0x1b, 0xbf, 0xd0, 0x44, 0xbc, 0x3c, 0xa4, 0xd4, 0x0b, 0x3e,
-  0x19, 0xde, 0xad, 0xbe, 0x6c, 0x42, 0x3f, 0x3d, 0x34, 0x47, 0x1a, 0x3e,
-  0x36, 0x24, 0x08, 0x3d, 0xa8, 0x7d, 0x9f, 0xbc, 0x34, 0x8c, 0x72, 0xbe,
-  0x8e, 0xf9, 0x89, 0x3d, 0x8d, 0x02, 0xc1, 0x3c, 0xea, 0x3d, 0xba, 0xbe,
-  0xe0, 0xfb, 0xa0, 0x3d, 0x51, 0xfd, 0x1d, 0x3e, 0xad, 0x45, 0x01, 0x3e,
-  0xf4, 0x84, 0x35, 0x3d, 0x95, 0x7a, 0x45, 0xbe, 0x50, 0x44, 0xae, 0x3d,
-  0x55, 0x2c, 0xfd, 0x3d, 0xb0, 0xdf, 0x92, 0xbe, 0x9a, 0xfa, 0x66, 0x3a,
-  0xa3, 0xd5, 0x13, 0xbd, 0x8a, 0x30, 0xfe, 0xbd, 0x71, 0x33, 0x83, 0x3d,
-  0x68, 0x16, 0x15, 0xbe, 0x02, 0xfc, 0x65, 0x3c, 0xaa, 0x3b, 0x00, 0xbe,
-  0x90, 0x9c, 0x0d, 0xbe, 0x76, 0x96, 0x9f, 0xbe, 0x64, 0x0b, 0x4a, 0xbe,
-  0xbb, 0x51, 0xa5, 0xbe, 0xa9, 0x4a, 0x95, 0xbe, 0x48, 0x63, 0x0e, 0xbe,
-  0x80, 0x3b, 0x97, 0xbe, 0xba, 0x14, 0x9f, 0xbe, 0x24, 0x60, 0x23, 0xbd,
-  0xc8, 0x64, 0x0b, 0xbe, 0xd4, 0x3f, 0x96, 0xbd, 0x9c, 0x28, 0xf5, 0xbd,
-  0xb6, 0x04, 0x42, 0xbd, 0x36, 0x56, 0x84, 0xbd, 0xaf, 0x3b, 0x00, 0xbe,
-  0x0a, 0x20, 0x11, 0xbd, 0xc9, 0x13, 0x5d, 0xbe, 0x17, 0x1c, 0x3c, 0xbc,
-  0x9c, 0x92, 0x58, 0xbc, 0x79, 0x21, 0x3f, 0x3d, 0xec, 0x92, 0x9c, 0x3d,
-  0x33, 0xa6, 0x21, 0xbd, 0xa4, 0x32, 0xb4, 0x3d, 0x7c, 0x15, 0xad, 0x3c,
-  0x38, 0x02, 0xa3, 0xbe, 0x28, 0xa8, 0x82, 0x3d, 0x0c, 0x09, 0xa2, 0xbb,
-  0x3a, 0x60, 0x3f, 0x3d, 0x5d, 0xb4, 0x9a, 0x3d, 0xcc, 0x04, 0x98, 0xbd,
-  0x03, 0x2e, 0x87, 0xbb, 0xd0, 0x76, 0x80, 0x3d, 0xcf, 0xdf, 0xa9, 0xbe,
-  0xd3, 0xdc, 0xec, 0x3d, 0x60, 0x65, 0xa4, 0xbc, 0x0a, 0x64, 0x4e, 0xbd,
-  0x1e, 0x87, 0x87, 0x3b, 0x8c, 0x78, 0xa2, 0x3c, 0x17, 0xee, 0x52, 0x3c,
-  0xf6, 0xc7, 0x86, 0x3d, 0x75, 0xcc, 0x68, 0xbc, 0x4b, 0xc9, 0x45, 0x3e,
-  0xc1, 0x4e, 0x96, 0x3d, 0x51, 0x05, 0x32, 0xbd, 0xa0, 0xb4, 0x35, 0xbd,
-  0x0a, 0x0e, 0xc8, 0x3d, 0x75, 0xb5, 0xaa, 0xbd, 0xe2, 0x17, 0x21, 0x3c,
-  0xb3, 0xed, 0x92, 0x3e, 0x6c, 0x94, 0xab, 0xbb, 0x1b, 0xd8, 0x0a, 0x3d,
-  0xea, 0x95, 0x52, 0x3b, 0xe7, 0x97, 0xa3, 0x3d, 0xdf, 0x28, 0x83, 0x3e,
-  0x7e, 0xe4, 0x40, 0x3d, 0xaf, 0x02, 0x52, 0x3c, 0x4d, 0xc4, 0x0f, 0x3e,
-  0xa6, 0x5a, 0x55, 0xbc, 0x55, 0xa1, 0x2b, 0x3d, 0x0c, 0x81, 0x02, 0x3d,
-  0xa1, 0xe5, 0xc5, 0x3d, 0xbd, 0x48, 0x0b, 0x3e, 0xb6, 0x34, 0xc7, 0x3c,
-  0x9f, 0x82, 0xde, 0xbc, 0x73, 0x0d, 0x6c, 0xbe, 0x8b, 0x09, 0xdd, 0xbd,
-  0x54, 0xc3, 0x6b, 0x3d, 0xd4, 0x2f, 0x88, 0x3d, 0x71, 0xb4, 0xc1, 0x3d,
-  0x5f, 0xb3, 0xdf, 0xbd, 0x49, 0xd7, 0x1d, 0xbc, 0x05, 0x37, 0xcb, 0xbb,
-  0x74, 0xcf, 0xed, 0xbe, 0x9d, 0xc0, 0xa5, 0x3c, 0x85, 0x30, 0x0e, 0x3e,
-  0x45, 0x65, 0x88, 0xbc, 0xa7, 0xcd, 0x9e, 0x3d, 0x8e, 0x38, 0xc9, 0xbe,
-  0x24, 0x1e, 0x41, 0xbc, 0xf2, 0x65, 0x0d, 0x3d, 0xee, 0x79, 0x05, 0xbf,
-  0x61, 0x83, 0x04, 0xbe, 0x4d, 0x7b, 0xe7, 0x3d, 0xf7, 0x21, 0x39, 0x3d,
-  0x57, 0x6a, 0xbb, 0x3c, 0x13, 0x73, 0x95, 0xbe, 0x1a, 0xd3, 0x2c, 0x3d,
-  0xc7, 0x8f, 0x65, 0x3d, 0x69, 0xe0, 0xdb, 0xbe, 0x17, 0x26, 0x5b, 0xbc,
-  0xb8, 0x82, 0xcc, 0x3d, 0x3d, 0x99, 0xa8, 0x3c, 0x2d, 0xc6, 0xb9, 0x3d,
-  0x09, 0x43, 0x51, 0xbe, 0xaa, 0xff, 0x13, 0xbd, 0x38, 0x9a, 0x79, 0x3d,
-  0x91, 0x38, 0x7b, 0xbe, 0xaa, 0xf8, 0xef, 0xbc, 0xd4, 0xf9, 0xc2, 0xbd,
-  0x23, 0x4a, 0x46, 0xbe, 0x50, 0xe7, 0x51, 0xbd, 0x9c, 0x93, 0x14, 0xbe,
-  0xc2, 0xae, 0x17, 0xbe, 0x22, 0x4f, 0x36, 0xbe, 0xb1, 0x0c, 0x00, 0xbe,
-  0x24, 0x0d, 0xa4, 0xbe, 0x07, 0xbd, 0x86, 0xbe, 0x95, 0x9e, 0xb2, 0xbe,
-  0x8a, 0xca, 0xc0, 0xbe, 0xb6, 0x45, 0x07, 0xbd, 0xaa, 0x36, 0xa3, 0xbe,
-  0xd5, 0xc1, 0x97, 0xbe, 0xfb, 0xeb, 0xfe, 0xbd, 0x3d, 0x4d, 0x5f, 0xbe,
-  0x4b, 0x8b, 0xc0, 0xbd, 0xb8, 0xdf, 0x0b, 0xbe, 0x84, 0x10, 0x99, 0xbd,
-  0x1d, 0xc3, 0x19, 0xbd, 0x28, 0x35, 0x00, 0xbe, 0x54, 0x96, 0x34, 0xbe,
-  0x05, 0xfe, 0x1a, 0xbe, 0x1e, 0x3d, 0x24, 0xbe, 0x13, 0x5e, 0x91, 0xbd,
-  0xac, 0xe5, 0x0a, 0xbd, 0x0b, 0xdc, 0x88, 0xbc, 0xd6, 0x80, 0xda, 0xbd,
-  0xb8, 0x75, 0xa2, 0xbd, 0x0c, 0x5d, 0xbe, 0xbd, 0x65, 0xc6, 0x2f, 0xbe,
-  0x2f, 0x32, 0xb3, 0x3d, 0x3e, 0x2a, 0x3f, 0x3d, 0xa6, 0xe0, 0xc6, 0xbb,
-  0x91, 0x46, 0xf4, 0xbc, 0x3f, 0xed, 0x69, 0xbd, 0x5a, 0x0a, 0x3e, 0xbd,
-  0xa9, 0x82, 0x44, 0xbd, 0x43, 0xe3, 0x97, 0xbd, 0x06, 0x10, 0xf4, 0x3c,
-  0xaa, 0x60, 0x9f, 0x3d, 0x24, 0x54, 0x05, 0xbd, 0x5f, 0x14, 0x20, 0x3d,
-  0x51, 0xcd, 0xab, 0x3d, 0x5f, 0x8e, 0x5f, 0xbd, 0xcf, 0xe3, 0x1c, 0x3c,
-  0x92, 0x72, 0x06, 0x3e, 0x4d, 0x2d, 0xea, 0x3c, 0x10, 0x8b, 0x53, 0x3c,
-  0x90, 0xa5, 0x02, 0xbe, 0xe0, 0xc3, 0x06, 0x3b, 0x73, 0x24, 0x26, 0x3e,
-  0xba, 0x33, 0x0b, 0xbd, 0x0f, 0x91, 0xb8, 0x3c, 0x95, 0x78, 0x6a, 0x3e,
-  0x34, 0x2b, 0x7f, 0x3c, 0x6f, 0x40, 0x31, 0xbd, 0x2a, 0x3d, 0x0b, 0xbe,
-  0x86, 0xc8, 0xbd, 0x3c, 0x1b, 0x14, 0x82, 0x3e, 0xfa, 0x52, 0xf0, 0xbd,
-  0x28, 0xba, 0x92, 0xbd, 0x6c, 0x43, 0x18, 0x3e, 0x23, 0xc9, 0xf6, 0xbd,
-  0xf5, 0x40, 0x4f, 0xbd, 0x69, 0x1a, 0x89, 0xbc, 0xe6, 0xf3, 0x60, 0xbd,
-  0x28, 0x4f, 0xdd, 0x3d, 0x88, 0x57, 0x07, 0xbc, 0xe4, 0x66, 0xd0, 0xbc,
-  0x07, 0x57, 0x01, 0xbe, 0x75, 0x10, 0x13, 0xbe, 0x4d, 0xd4, 0x3e, 0x3d,
-  0x89, 0xf1, 0x2d, 0x3c, 0xfe, 0xe2, 0x38, 0x3b, 0x0c, 0x7a, 0x3b, 0xbd,
-  0x2a, 0x77, 0xef, 0x3d, 0x87, 0x5d, 0x29, 0xbd, 0xe6, 0x7b, 0xe9, 0xbe,
-  0x15, 0x97, 0x3c, 0xbd, 0xc9, 0x43, 0x0e, 0xbd, 0x71, 0x96, 0x94, 0xbd,
-  0xb0, 0x91, 0x4e, 0x3d, 0xd6, 0x59, 0x4e, 0xbe, 0x83, 0x00, 0x10, 0x3d,
-  0x9a, 0xe3, 0x45, 0xbc, 0xe2, 0x68, 0xd9, 0xbe, 0x79, 0x99, 0xec, 0xbc,
-  0x59, 0xf6, 0xe3, 0x3c, 0x63, 0x25, 0x88, 0x3d, 0xd5, 0xe3, 0x87, 0xbd,
-  0x26, 0xc4, 0xbe, 0xbe, 0x2e, 0x21, 0xad, 0x3c, 0x21, 0x83, 0x3d, 0xbd,
-  0xbc, 0xd9, 0x6a, 0xbe, 0x2e, 0x0e, 0xa9, 0xbd, 0x15, 0x2d, 0x99, 0x3b,
-  0xc9, 0x80, 0xf1, 0x3c, 0xf0, 0x6b, 0x87, 0xbd, 0x6a, 0x4a, 0xbe, 0xbd,
-  0xfa, 0x8b, 0x70, 0xbd, 0xa2, 0x3a, 0x62, 0xbd, 0xab, 0x75, 0x04, 0xbe,
-  0xcf, 0x6b, 0xc1, 0xbd, 0x8b, 0x72, 0x12, 0xbe, 0xca, 0xdc, 0x82, 0xbe,
-  0xe9, 0x38, 0xb0, 0xbd, 0xfd, 0xa1, 0x0a, 0xbe, 0xd6, 0x33, 0x5d, 0xbe,
-  0xa4, 0xc2, 0x0e, 0xbe, 0xf4, 0xb1, 0x98, 0xbd, 0x4b, 0xe2, 0x76, 0xbe,
-  0x69, 0x94, 0x6a, 0xbe, 0x8d, 0xf6, 0x7f, 0xbd, 0x56, 0x3b, 0x6b, 0xbe,
-  0xb5, 0x5d, 0x04, 0xbd, 0x94, 0xf3, 0x51, 0xbe, 0x5e, 0x33, 0x42, 0xbe,
-  0xd3, 0xa1, 0x15, 0xbd, 0x92, 0xcd, 0x59, 0xbe, 0x65, 0xc8, 0x68, 0xbe,
-  0xb9, 0x68, 0x98, 0xbe, 0xb6, 0xc8, 0x77, 0xbe, 0x4b, 0x99, 0x4d, 0xbd,
-  0xb9, 0xf7, 0x9d, 0xbe, 0x75, 0x64, 0x77, 0xbe, 0xfa, 0x76, 0xb8, 0xbd,
-  0xec, 0x44, 0x26, 0xbd, 0x77, 0xbe, 0x06, 0xbd, 0xbd, 0xd8, 0x18, 0xbe,
-  0xb3, 0x1e, 0x85, 0xbe, 0xe4, 0x3a, 0xb8, 0xbd, 0xdb, 0x50, 0x14, 0xbe,
-  0x5d, 0x31, 0xd1, 0xbd, 0x11, 0xff, 0xfa, 0xbd, 0x71, 0xfa, 0xcc, 0xbd,
-  0xce, 0x1b, 0xaa, 0xbc, 0x35, 0x34, 0xa2, 0xbc, 0xd9, 0x81, 0xcb, 0xbd,
-  0xc7, 0x14, 0xaa, 0xb9, 0xd0, 0x37, 0x74, 0x3b, 0x01, 0x18, 0x93, 0xbd,
-  0x7b, 0x46, 0x4d, 0xbc, 0xbe, 0x16, 0x69, 0xbb, 0x61, 0x9b, 0x4b, 0xbc,
-  0xcf, 0x60, 0x10, 0xbe, 0xed, 0xa5, 0xeb, 0x3c, 0xba, 0x33, 0x01, 0x3e,
-  0xa2, 0x4a, 0x9a, 0xbd, 0x4e, 0x18, 0xa5, 0xbc, 0x09, 0x64, 0xd1, 0x3d,
-  0x5a, 0x7a, 0xed, 0xbd, 0x8f, 0x43, 0x20, 0xbd, 0x41, 0xd4, 0x19, 0xbe,
-  0xa5, 0xb6, 0x71, 0x3d, 0x62, 0x99, 0x4a, 0x3e, 0x1e, 0xa2, 0x1b, 0xbe,
-  0xcd, 0xbf, 0x04, 0xbd, 0x6f, 0x81, 0xa7, 0x3d, 0x01, 0x92, 0xdb, 0xbd,
-  0xc2, 0x7d, 0xc9, 0xbd, 0x02, 0xe6, 0xe1, 0xbd, 0x0f, 0x29, 0xb8, 0xbd,
-  0x58, 0xbe, 0x88, 0x3e, 0xf2, 0x5c, 0x2e, 0xbe, 0xdd, 0xc6, 0x05, 0xbe,
-  0xa6, 0x25, 0x8a, 0x3d, 0x96, 0xab, 0x50, 0xbe, 0x2c, 0x18, 0xad, 0xbd,
-  0x98, 0xb2, 0xb3, 0xbc, 0x24, 0x7a, 0x9d, 0xba, 0xd6, 0x7a, 0xf6, 0x3d,
-  0xb4, 0x58, 0xfd, 0xbc, 0x8f, 0x09, 0x2c, 0xbc, 0x77, 0x9f, 0x87, 0xbd,
-  0x92, 0x71, 0xcb, 0xbd, 0xf8, 0xd3, 0xbd, 0xbc, 0xa0, 0x9b, 0xb0, 0x38,
-  0xf2, 0xb3, 0x70, 0xbd, 0xef, 0xf2, 0xce, 0xbd, 0xc3, 0x6b, 0xa0, 0xbd,
-  0x4c, 0xd3, 0x23, 0xbd, 0xe6, 0x00, 0x8d, 0xbe, 0x5c, 0xa9, 0xa7, 0xbd,
-  0xcd, 0xf9, 0x0f, 0xbe, 0x34, 0x18, 0x1f, 0xb9, 0xb1, 0x6f, 0x8c, 0xbd,
-  0x5d, 0xcc, 0x67, 0xbe, 0x68, 0x94, 0xef, 0xbd, 0x56, 0xc9, 0x17, 0xbe,
-  0x64, 0x08, 0x89, 0xbe, 0xc6, 0xbb, 0xac, 0xbd, 0x55, 0x9d, 0x97, 0xbd,
-  0x4c, 0x0c, 0xb0, 0x3d, 0xa4, 0xbe, 0x57, 0xbd, 0x98, 0x06, 0x48, 0xbe,
-  0x9d, 0x08, 0xc7, 0xbc, 0xe0, 0x1c, 0x85, 0xbd, 0xca, 0xd5, 0x3f, 0xbe,
-  0x2e, 0x31, 0x55, 0xbd, 0x45, 0xf0, 0x37, 0xbd, 0xf7, 0xd9, 0x72, 0xbd,
-  0x6d, 0xc6, 0x2e, 0x3b, 0x9b, 0x6c, 0xbe, 0xbd, 0x8a, 0xed, 0x0a, 0xbd,
-  0x2c, 0xcb, 0x97, 0xbd, 0x2e, 0xd1, 0x99, 0x3b, 0x49, 0xda, 0x22, 0xbe,
-  0xdf, 0xfa, 0x08, 0xbe, 0x5b, 0x7c, 0x2b, 0xbe, 0xc6, 0x02, 0x36, 0xbe,
-  0x1b, 0x2f, 0x83, 0xbd, 0x34, 0x82, 0xca, 0xbd, 0xbc, 0xd3, 0x1b, 0xbe,
-  0x48, 0x5a, 0x89, 0xbd, 0x19, 0xee, 0x50, 0xbd, 0x09, 0x2c, 0x21, 0xbd,
-  0xd5, 0xbd, 0xf8, 0xbc, 0x85, 0xcc, 0x0b, 0xbd, 0xd9, 0x4f, 0x0f, 0xbe,
-  0x63, 0x12, 0x38, 0x3d, 0xdf, 0xf3, 0x94, 0xbc, 0x89, 0x17, 0xef, 0xbd,
-  0xcf, 0x97, 0x16, 0xbd, 0x65, 0xa1, 0x24, 0xbe, 0xa7, 0xca, 0x44, 0xbe,
-  0x61, 0x54, 0x48, 0xbe, 0xcc, 0xf6, 0xc3, 0xbc, 0x49, 0xa3, 0x4c, 0xbe,
-  0xc2, 0x8e, 0x27, 0xbe, 0xe0, 0x62, 0x0b, 0xbe, 0x1e, 0x9c, 0xdf, 0xbd,
-  0x45, 0x14, 0x33, 0x3d, 0x43, 0x3a, 0x87, 0x3d, 0x6b, 0x59, 0x0b, 0x3d,
-  0xdb, 0xf1, 0x0b, 0xbd, 0x98, 0x1b, 0x32, 0xbd, 0xa3, 0x85, 0xaa, 0xbc,
-  0x5d, 0x13, 0xb1, 0xbd, 0x9c, 0x60, 0xb2, 0xbc, 0x4e, 0x0e, 0x82, 0xbd,
-  0x45, 0x0b, 0x1d, 0x3c, 0x9b, 0x5c, 0x12, 0x3d, 0x8b, 0x3f, 0xbc, 0x3c,
-  0x43, 0x0a, 0x73, 0x3c, 0x5e, 0x6e, 0x58, 0xba, 0xef, 0xdb, 0x5f, 0x3d,
-  0xf6, 0x22, 0x61, 0x3d, 0x37, 0x1c, 0xb1, 0xbc, 0xf7, 0x4d, 0x04, 0x3d,
-  0x4f, 0x56, 0x7e, 0xbd, 0x63, 0x6d, 0x4b, 0xbd, 0xc1, 0x30, 0x4d, 0xbd,
-  0xb8, 0x17, 0x6d, 0xbd, 0xa2, 0xa9, 0x3d, 0x3e, 0x21, 0x3a, 0xab, 0xbd,
-  0x4b, 0xfb, 0xa8, 0xbd, 0xb9, 0x8b, 0x25, 0xbc, 0x23, 0xea, 0x4e, 0x3a,
-  0x1b, 0x20, 0x45, 0xbd, 0x87, 0x67, 0x6d, 0xbd, 0x31, 0x5a, 0x94, 0xbd,
-  0x65, 0x33, 0x4a, 0x3e, 0x9d, 0xbb, 0x19, 0xbd, 0xa8, 0x38, 0x01, 0xbe,
-  0x09, 0x25, 0x92, 0xbd, 0xaf, 0x14, 0x45, 0xbd, 0xed, 0xdd, 0xed, 0xbd,
-  0x6f, 0xf7, 0xc7, 0xbc, 0x44, 0x21, 0x2a, 0xbc, 0xaa, 0x0e, 0xd0, 0x3c,
-  0xb0, 0x23, 0xff, 0xbd, 0x1a, 0xe6, 0xff, 0xbd, 0x5f, 0x98, 0x49, 0xbd,
-  0xe4, 0x0e, 0xee, 0xbd, 0x53, 0xb9, 0x45, 0xbe, 0xd0, 0xd4, 0xf3, 0xbd,
-  0x6b, 0xd1, 0x47, 0xbd, 0x04, 0x9a, 0x0f, 0xbd, 0xcb, 0x87, 0x9f, 0xbd,
-  0x20, 0xfa, 0xea, 0xbd, 0x10, 0xbb, 0x67, 0xbb, 0x18, 0x06, 0xc2, 0xbd,
-  0x9a, 0xbf, 0x54, 0xbe, 0x10, 0x5d, 0xf7, 0xbd, 0x9a, 0xad, 0xfc, 0xbb,
-  0x87, 0x79, 0x01, 0xbe, 0x62, 0xc3, 0x92, 0xbd, 0x6a, 0x63, 0x01, 0xbe,
-  0x97, 0xb9, 0x87, 0xbd, 0x1d, 0xc8, 0x8c, 0xbd, 0x65, 0x88, 0x29, 0xbe,
-  0x62, 0x20, 0xc5, 0xbd, 0x97, 0x1e, 0x8c, 0xbc, 0x96, 0xb7, 0x3d, 0xbe,
-  0xef, 0x7e, 0x6b, 0x3c, 0xb2, 0x84, 0x58, 0xbd, 0x27, 0x6c, 0x81, 0xbc,
-  0xaa, 0x45, 0x58, 0xbc, 0x9e, 0xe9, 0x59, 0xbd, 0x16, 0x23, 0xe6, 0xba,
-  0x27, 0x89, 0xcc, 0xbd, 0x0c, 0x48, 0x50, 0x3c, 0xc9, 0xe4, 0x47, 0xbd,
-  0x6c, 0x44, 0xd9, 0x3c, 0x2d, 0x22, 0x1f, 0x3c, 0x09, 0x91, 0xba, 0xbd,
-  0xb9, 0x6e, 0xfd, 0xbd, 0xe8, 0xc9, 0xc1, 0xbd, 0x77, 0x37, 0xce, 0xbc,
-  0xed, 0x5f, 0x8f, 0xbc, 0x72, 0x7c, 0xf4, 0x3c, 0x79, 0xd5, 0x6d, 0xbd,
-  0xb1, 0x55, 0x2d, 0x3d, 0x2c, 0x02, 0xca, 0xbd, 0xd9, 0xba, 0xb8, 0x3c,
-  0xc6, 0x3f, 0xd8, 0x3c, 0x59, 0x40, 0x28, 0xbd, 0x26, 0xa9, 0xcf, 0xbc,
-  0x70, 0xda, 0xd9, 0x3c, 0x63, 0x6f, 0xfa, 0xbc, 0x39, 0xd1, 0x90, 0x3d,
-  0xe0, 0xa8, 0x98, 0x3b, 0x8b, 0x30, 0x00, 0xbd, 0x3e, 0x7b, 0x89, 0xbd,
-  0x78, 0x80, 0x54, 0xbc, 0x49, 0x0c, 0xab, 0xbd, 0x33, 0xb3, 0x18, 0xbe,
-  0x7b, 0xed, 0x36, 0xbd, 0x1d, 0x9f, 0x25, 0xbe, 0xa8, 0xef, 0x22, 0xbe,
-  0x6d, 0x8f, 0x4c, 0xbd, 0x00, 0x88, 0xa4, 0xbd, 0x5b, 0xf6, 0x1b, 0xbe,
-  0x8a, 0x8b, 0xd5, 0xbc, 0x9d, 0x7a, 0xc6, 0xbc, 0xee, 0x62, 0x06, 0xbd,
-  0xb2, 0x13, 0x89, 0xbd, 0x9c, 0x52, 0x92, 0xbd, 0xe6, 0x69, 0xd1, 0xbd,
-  0x6c, 0xd2, 0x77, 0xbd, 0x86, 0xd7, 0x50, 0xbd, 0x69, 0x9a, 0xd4, 0x3d,
-  0x55, 0x59, 0x9b, 0x3c, 0xf4, 0x51, 0xb5, 0xbd, 0x72, 0xed, 0x3d, 0xbd,
-  0x47, 0x11, 0xa3, 0xbd, 0x5d, 0x22, 0x18, 0xbe, 0x50, 0x2c, 0x9d, 0xbd,
-  0x93, 0x18, 0x94, 0x3c, 0xf5, 0x34, 0x89, 0xbd, 0x93, 0x99, 0xa1, 0xbd,
-  0xfa, 0x22, 0xe7, 0xbc, 0x95, 0xcf, 0x26, 0xbd, 0x13, 0xba, 0xb1, 0xbd,
-  0xcf, 0x70, 0x3b, 0xbe, 0xd6, 0x14, 0x8f, 0x3c, 0xfa, 0xb5, 0x69, 0x3c,
-  0x40, 0x8c, 0x42, 0xbd, 0xdf, 0x04, 0x3b, 0xbd, 0xaf, 0xf8, 0x7b, 0xbd,
-  0xe3, 0xf7, 0x68, 0xbc, 0x1b, 0xc9, 0xac, 0xbd, 0x70, 0x15, 0x9c, 0xbd,
-  0x78, 0x80, 0x96, 0x3c, 0x6c, 0x3b, 0x47, 0xbd, 0x19, 0xfe, 0x28, 0xbe,
-  0x37, 0xbb, 0x38, 0xbd, 0x9a, 0x08, 0x0c, 0xbd, 0x98, 0x1b, 0x56, 0x3d,
-  0xba, 0x93, 0x0f, 0xbd, 0x97, 0x45, 0x4f, 0xbe, 0xd0, 0xfc, 0xbc, 0xbd,
-  0xfd, 0x03, 0x54, 0xbd, 0x93, 0xb1, 0xa6, 0xbe, 0xea, 0x44, 0x25, 0xbc,
-  0x91, 0x30, 0x7c, 0x3c, 0xc6, 0x29, 0x4e, 0xbd, 0xe6, 0xde, 0xba, 0xbd,
-  0xbb, 0xbd, 0x13, 0xbe, 0xed, 0x39, 0xca, 0xbd, 0x97, 0x12, 0xaa, 0xbd,
-  0x54, 0x1b, 0xb3, 0xbe, 0x75, 0x22, 0x8b, 0xbd, 0x5e, 0x8c, 0xb5, 0xbc,
-  0x93, 0x7c, 0xab, 0xbd, 0x79, 0x2a, 0x00, 0xbe, 0xa8, 0x2a, 0x00, 0xbe,
-  0xf4, 0x85, 0xac, 0xbd, 0xda, 0xbb, 0xa2, 0xbc, 0xdf, 0xe9, 0x63, 0xbe,
-  0x93, 0xb7, 0x0a, 0xbc, 0xed, 0xa2, 0xac, 0x3c, 0xb9, 0x50, 0xde, 0xbd,
-  0x33, 0x5a, 0x31, 0xbd, 0xdf, 0x04, 0x5c, 0xbd, 0x22, 0xae, 0xf7, 0x3b,
-  0xe9, 0xeb, 0x4a, 0x3a, 0x44, 0x63, 0x3e, 0xbd, 0xb2, 0x71, 0xb5, 0x3d,
-  0x63, 0xde, 0x50, 0xbd, 0x96, 0xd5, 0x75, 0xbc, 0x88, 0x63, 0x82, 0xbd,
-  0x43, 0xc4, 0xa0, 0xbd, 0x46, 0x8a, 0xa5, 0xbd, 0x89, 0xff, 0x88, 0x3d,
-  0x39, 0xf3, 0xee, 0xbd, 0xfb, 0x26, 0xcd, 0x3d, 0x92, 0xbd, 0x95, 0x3d,
-  0xad, 0x70, 0xc1, 0x3d, 0x3c, 0xf7, 0x46, 0x3d, 0xd6, 0x4c, 0x3a, 0xbd,
-  0x64, 0x09, 0xce, 0x3d, 0x0d, 0x24, 0xd2, 0x3d, 0x60, 0xcb, 0x70, 0xbd,
-  0xc8, 0xba, 0xcd, 0x3d, 0x73, 0x19, 0x01, 0x3e, 0xad, 0xe2, 0x39, 0x3d,
-  0x23, 0xf8, 0x5c, 0x3d, 0xe9, 0x30, 0x07, 0xbc, 0x87, 0x64, 0x27, 0x3d,
-  0xa1, 0x5c, 0xbf, 0x3d, 0x62, 0xf2, 0x4d, 0xbc, 0x57, 0x2c, 0x99, 0x3d,
-  0x35, 0x3f, 0x21, 0x3d, 0xb6, 0xf7, 0x9f, 0xbd, 0x01, 0xe3, 0xd7, 0x3b,
-  0xaf, 0xc3, 0xb7, 0x3b, 0x2f, 0xe8, 0x11, 0xbd, 0xec, 0x5c, 0x5e, 0x3c,
-  0x4a, 0xaf, 0xbc, 0xbd, 0x85, 0x50, 0xeb, 0x3c, 0x12, 0xa0, 0xbb, 0xbd,
-  0x88, 0x2d, 0xb1, 0xbd, 0x59, 0x2d, 0xfd, 0xbd, 0xc6, 0x79, 0xa0, 0xbd,
-  0xa0, 0x29, 0xb9, 0xbd, 0x89, 0x41, 0x27, 0xbe, 0x0b, 0x94, 0x87, 0xbc,
-  0xf7, 0xcc, 0x92, 0x3d, 0xa4, 0xfc, 0xcb, 0x3d, 0x74, 0xae, 0x4e, 0x3d,
-  0xbd, 0x60, 0x85, 0x3d, 0x2a, 0xa4, 0x6d, 0xbd, 0x1d, 0xaa, 0x0b, 0x3d,
-  0x7a, 0xc3, 0x9b, 0x3d, 0x0f, 0x43, 0x23, 0x3d, 0x62, 0xf3, 0x03, 0x3e,
-  0x59, 0x67, 0xa0, 0x3d, 0x2e, 0x40, 0x81, 0x3d, 0x75, 0xa2, 0xbc, 0x3d,
-  0xca, 0xbe, 0x8e, 0xbc, 0x75, 0x34, 0xad, 0x3d, 0xb2, 0x99, 0xef, 0x3d,
-  0x68, 0x28, 0x07, 0x3d, 0x2c, 0xeb, 0xf7, 0x3d, 0xcc, 0x94, 0xcd, 0x3d,
-  0x34, 0x3e, 0x9c, 0x3d, 0x68, 0x72, 0x2a, 0xbb, 0x77, 0x58, 0xb8, 0xbc,
-  0x53, 0x60, 0x67, 0x3c, 0x65, 0xea, 0x1b, 0x3e, 0x05, 0x22, 0x75, 0x3d,
-  0x37, 0x35, 0x34, 0x3d, 0xe7, 0xcf, 0xf1, 0x3c, 0x39, 0xb2, 0x07, 0x3d,
-  0x22, 0xdb, 0x80, 0x3d, 0x49, 0x0b, 0xf2, 0xbd, 0xb4, 0xe9, 0x77, 0x3d,
-  0x3e, 0x71, 0x10, 0x3e, 0x24, 0x79, 0x13, 0xbe, 0x3b, 0x39, 0x1a, 0x3e,
-  0xea, 0xee, 0x8b, 0x3d, 0xa8, 0x99, 0xf2, 0x3d, 0x7d, 0x07, 0x55, 0x3d,
-  0xd0, 0x31, 0xce, 0xbd, 0x40, 0x40, 0x11, 0x3d, 0x50, 0xd7, 0xc4, 0x3c,
-  0xac, 0xcc, 0x49, 0xbe, 0x5f, 0x1b, 0x3b, 0x3d, 0xae, 0x9d, 0x0d, 0xbc,
-  0xd5, 0x7e, 0x8f, 0x3d, 0x3f, 0x39, 0x35, 0x3d, 0x67, 0x3b, 0x8e, 0xbd,
-  0x08, 0x17, 0x08, 0x3c, 0x80, 0xe3, 0x04, 0x3b, 0xa6, 0x7b, 0x4e, 0xbe,
-  0x6b, 0x24, 0xe1, 0x3d, 0xfb, 0x31, 0xa3, 0x3d, 0x90, 0x1b, 0xd3, 0x3d,
-  0x4b, 0xbe, 0x20, 0x3c, 0x69, 0xf0, 0x49, 0x3c, 0x62, 0xb3, 0xc8, 0xbc,
-  0x22, 0xf3, 0xcf, 0x3c, 0x81, 0x54, 0x32, 0xbe, 0x38, 0xe7, 0x90, 0x3d,
-  0x26, 0x6c, 0xbc, 0x3d, 0xd4, 0xb9, 0x94, 0xbc, 0xde, 0x79, 0x09, 0xbc,
-  0x5a, 0x0b, 0x94, 0xbc, 0xab, 0x0b, 0x56, 0x3d, 0x15, 0x6b, 0x84, 0x3d,
-  0xbd, 0x68, 0x59, 0xbd, 0x1a, 0xd9, 0xd5, 0x3d, 0x8e, 0xf9, 0xf2, 0x3d,
-  0xf0, 0x15, 0x1e, 0x3e, 0x15, 0xb7, 0x64, 0x3c, 0x20, 0xe9, 0xd7, 0x3b,
-  0x3e, 0x08, 0x41, 0x3d, 0xa6, 0xc1, 0x9f, 0x3d, 0xb0, 0xb6, 0x5a, 0xbd,
-  0xbc, 0x10, 0x11, 0x3e, 0x0f, 0x28, 0x52, 0x3d, 0x1f, 0x95, 0x0d, 0x3d,
-  0xb7, 0x97, 0x1d, 0x3e, 0x1c, 0xb9, 0x3c, 0xbd, 0xa7, 0xd5, 0x02, 0x3e,
-  0xed, 0xe8, 0xf1, 0x3d, 0xcf, 0x01, 0xdf, 0xbd, 0xc7, 0xb3, 0x12, 0x3d,
-  0x61, 0x3b, 0x92, 0x3d, 0x6a, 0x43, 0xf9, 0xbc, 0x3b, 0x2e, 0xad, 0x3d,
-  0xde, 0x96, 0x5d, 0xbd, 0x4b, 0x18, 0x4d, 0xbd, 0x8b, 0x65, 0x08, 0xbd,
-  0x31, 0x97, 0xd2, 0xbd, 0xcb, 0xdb, 0xae, 0xbd, 0x82, 0x1b, 0x09, 0x3d,
-  0x6b, 0x06, 0xc0, 0xbd, 0x30, 0x97, 0xb2, 0xbd, 0x1d, 0xac, 0x78, 0xbd,
-  0xf0, 0x1f, 0x63, 0xbd, 0xaf, 0x79, 0x6a, 0xbd, 0x38, 0xf7, 0xff, 0xff,
-  0x3c, 0xf7, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52,
-  0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
-  0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x4c, 0x02, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0xe4, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
-  0x34, 0x01, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
-  0x7c, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xaa, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x6a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0xda, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-  0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0xfc, 0xf7, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x3b, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x20, 0x24, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xc6, 0xff, 0xff, 0xff,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x1c, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-  0x08, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x14, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x34, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
-  0x18, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00,
-  0x2c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x13, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xf8, 0x05, 0x00, 0x00,
-  0xa0, 0x05, 0x00, 0x00, 0x4c, 0x05, 0x00, 0x00, 0xf8, 0x04, 0x00, 0x00,
-  0x84, 0x04, 0x00, 0x00, 0x44, 0x04, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00,
-  0x60, 0x03, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00,
-  0xe8, 0x01, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00,
-  0xdc, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x5e, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x0a, 0x00, 0x00, 0x00, 0x40, 0xfa, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x00,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74,
-  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x5f,
-  0x31, 0x3a, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0xb6, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x98, 0xfa, 0xff, 0xff,
-  0x38, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0xce, 0x55, 0xbe, 0xbb, 0x3a, 0xcd, 0x6e, 0xbc, 0xe6, 0x29, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00,
+  0x6f, 0x87, 0x41, 0xbf, 0x12, 0xf4, 0x8d, 0xbf, 0x61, 0xa1, 0x6d, 0xbf,
+  0x2d, 0x3c, 0xbe, 0xbc, 0x62, 0x4e, 0x09, 0x3e, 0x3f, 0x2c, 0xa5, 0x3e,
+  0x27, 0xb5, 0x18, 0x3f, 0x05, 0x64, 0x59, 0x3f, 0xc1, 0x30, 0x97, 0x3e,
+  0x9e, 0x77, 0x79, 0x3e, 0x7c, 0x13, 0x69, 0xbd, 0x55, 0xac, 0xed, 0xbe,
+  0x83, 0xe5, 0xda, 0x3e, 0x99, 0x08, 0xf8, 0x3e, 0xc7, 0xee, 0x4b, 0xbd,
+  0x2b, 0x0e, 0xa8, 0xbe, 0x5d, 0x85, 0x39, 0x3e, 0xe8, 0xf9, 0xe6, 0x3e,
+  0xa3, 0xa5, 0xa6, 0x3e, 0xf2, 0x81, 0xe4, 0xbc, 0xef, 0x75, 0xb1, 0x3e,
+  0xc0, 0x3d, 0x55, 0xbc, 0x36, 0x51, 0xc9, 0xbd, 0xee, 0xcc, 0x4a, 0x3e,
+  0x3a, 0xde, 0xe2, 0x3d, 0x14, 0x2b, 0xd4, 0x3d, 0xbd, 0xe4, 0xa2, 0xbd,
+  0xca, 0x87, 0x0f, 0xbf, 0xbb, 0x21, 0x75, 0x3e, 0x70, 0xbd, 0xb8, 0x3e,
+  0x25, 0x0d, 0xb2, 0xbe, 0xf9, 0x9f, 0xf6, 0x3e, 0xfb, 0x6e, 0x9f, 0x3e,
+  0xfc, 0x1d, 0x84, 0x3e, 0xa7, 0xec, 0x8b, 0x3e, 0x03, 0xb6, 0x94, 0xbe,
+  0xf1, 0xc6, 0x9d, 0x3d, 0xf6, 0x14, 0xcc, 0x3e, 0x3b, 0x87, 0x9f, 0x3e,
+  0x48, 0xdd, 0xa7, 0x3e, 0x14, 0x5c, 0xcd, 0x3d, 0xae, 0xc0, 0x37, 0xbd,
+  0xdc, 0x1a, 0x79, 0xbe, 0x4d, 0x09, 0x13, 0xbf, 0x20, 0x26, 0x91, 0xbe,
+  0xa9, 0x9d, 0x92, 0x3e, 0xb3, 0x4c, 0x33, 0x3f, 0x17, 0x1a, 0x5d, 0x3f,
+  0x25, 0xe3, 0xc1, 0xbe, 0x4e, 0xc7, 0xd2, 0xbb, 0x58, 0xb3, 0x98, 0xbc,
+  0x90, 0x28, 0xac, 0xbf, 0xf9, 0x46, 0x48, 0xbf, 0x21, 0xdd, 0x8b, 0xbf,
+  0x4b, 0x1f, 0xe5, 0xbe, 0xe6, 0x6f, 0xe6, 0x3e, 0x3b, 0xf1, 0x8b, 0x3e,
+  0x36, 0xde, 0x4f, 0x3e, 0xa4, 0x19, 0xf8, 0x3e, 0x15, 0x08, 0xbb, 0x3d,
+  0xfd, 0x18, 0xb0, 0x3d, 0x28, 0x74, 0x98, 0xbc, 0xcf, 0x73, 0x9a, 0xbe,
+  0xa9, 0x16, 0x21, 0x3d, 0x50, 0x84, 0x09, 0xbd, 0xe8, 0xe5, 0xee, 0x3d,
+  0x67, 0xa1, 0x6e, 0x3d, 0x8c, 0x51, 0xd8, 0x3e, 0x5f, 0x2f, 0xbb, 0x3e,
+  0xe9, 0x61, 0x84, 0xbe, 0xe0, 0x79, 0xa4, 0x3e, 0xc3, 0x92, 0xb7, 0xbd,
+  0x16, 0x2b, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x2b, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3a, 0x2b, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x48, 0x05, 0x00, 0x00, 0x4a, 0x2b, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0xcf, 0x77, 0x48, 0x3d, 0xa5, 0x81, 0x20, 0x3e,
+  0xef, 0x41, 0x51, 0xbd, 0x4b, 0xc1, 0xde, 0xbd, 0xac, 0xcf, 0xa9, 0x3d,
+  0x93, 0x2d, 0x36, 0xbc, 0x47, 0x77, 0x03, 0x3d, 0xd8, 0x60, 0xae, 0x3d,
+  0x6c, 0x4c, 0xd5, 0xbd, 0x3f, 0xbc, 0x5c, 0xbd, 0x7e, 0x2b, 0xff, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0xd3, 0x00, 0x00, 0xba, 0x9a, 0x89, 0x3d,
+  0x49, 0xd2, 0x21, 0xbc, 0x03, 0x76, 0x48, 0xbc, 0xb9, 0xcc, 0x9d, 0xbd,
+  0x13, 0x00, 0xb5, 0x3b, 0x6b, 0x04, 0x2d, 0x3d, 0x03, 0x80, 0xd8, 0xbb,
+  0xf0, 0xc0, 0x9b, 0xbd, 0x9f, 0xf0, 0x88, 0x3d, 0x99, 0xb2, 0x89, 0xbd,
+  0x88, 0x16, 0xa3, 0x3d, 0xd4, 0x00, 0x30, 0xbd, 0x2c, 0x60, 0x03, 0x3c,
+  0x9a, 0xf7, 0xe6, 0x3d, 0xe6, 0x0d, 0x61, 0x3d, 0x34, 0x9c, 0xd0, 0x3c,
+  0xd6, 0x73, 0xc4, 0x3c, 0x6f, 0xb1, 0xaa, 0xbd, 0x42, 0x83, 0xc1, 0xbd,
+  0x4e, 0x19, 0x74, 0xbd, 0xb0, 0x72, 0x9c, 0xbd, 0x36, 0xeb, 0xd1, 0x3d,
+  0x40, 0x78, 0x30, 0xbd, 0x82, 0x1a, 0xdb, 0xbd, 0x0c, 0x90, 0x00, 0xbd,
+  0xe7, 0x58, 0xaa, 0xbd, 0xda, 0x98, 0x5c, 0xbd, 0x67, 0x9a, 0x33, 0xbd,
+  0xdc, 0xd4, 0x98, 0xbd, 0xe9, 0x21, 0xee, 0x3d, 0xb4, 0xc7, 0x87, 0xbb,
+  0x19, 0x1c, 0x65, 0xbd, 0x41, 0x81, 0x86, 0xbd, 0xcc, 0x52, 0x13, 0xbe,
+  0xe1, 0x3d, 0x56, 0xbd, 0xda, 0x33, 0x22, 0xbe, 0x34, 0x3e, 0x21, 0xbd,
+  0x1d, 0xb9, 0x94, 0x3d, 0x1b, 0xf1, 0xed, 0xbd, 0x60, 0xb0, 0xf1, 0xbd,
+  0x26, 0xe8, 0xdf, 0xbd, 0x8b, 0xa9, 0x39, 0xbd, 0x09, 0x08, 0x02, 0xbe,
+  0x09, 0x3e, 0x11, 0xbe, 0xd5, 0xee, 0x3a, 0xbd, 0x44, 0x63, 0x66, 0x3d,
+  0x8d, 0xb7, 0x0d, 0xbe, 0xdf, 0xae, 0x83, 0xbd, 0x2f, 0x0c, 0xb8, 0xbd,
+  0x23, 0x36, 0xa7, 0xbc, 0x27, 0x17, 0x1d, 0xbd, 0x2e, 0x47, 0x00, 0xbe,
+  0x4f, 0x25, 0xe8, 0x3c, 0xe3, 0x50, 0xf7, 0x3d, 0x91, 0x8f, 0x0e, 0xbe,
+  0x9a, 0x48, 0x27, 0xbe, 0x24, 0xd6, 0x7c, 0xbc, 0xc8, 0xe7, 0xd2, 0xbd,
+  0xc4, 0x04, 0x9c, 0xbd, 0xa7, 0x48, 0x16, 0xbe, 0xde, 0x71, 0x10, 0xbd,
+  0xec, 0x21, 0xe4, 0x3d, 0x86, 0xc6, 0x02, 0xbe, 0x87, 0xd8, 0xe1, 0xbd,
+  0x14, 0x9f, 0xcf, 0xbd, 0xb6, 0x08, 0x0a, 0xbe, 0x82, 0xc5, 0xd9, 0xbd,
+  0xec, 0x24, 0x80, 0xbd, 0xc5, 0xac, 0xe0, 0xba, 0x8e, 0xce, 0xb1, 0x3c,
+  0x8d, 0x67, 0xb1, 0xbd, 0xfc, 0x98, 0x9f, 0xbd, 0x2b, 0xea, 0x83, 0xbd,
+  0x3b, 0xa3, 0x35, 0xbe, 0x47, 0x93, 0x52, 0xbe, 0x89, 0x5b, 0x25, 0xbe,
+  0xf5, 0x15, 0x50, 0xbe, 0x01, 0x2d, 0x23, 0x3d, 0x8c, 0x59, 0x3e, 0xbe,
+  0xc1, 0x12, 0x53, 0xbe, 0xbd, 0xc5, 0xee, 0xbd, 0xfb, 0x19, 0x0d, 0xbe,
+  0x20, 0x9e, 0x70, 0xbd, 0xa3, 0x40, 0x89, 0xbd, 0xe5, 0xaa, 0xfd, 0xbd,
+  0x42, 0x00, 0x82, 0x3d, 0x27, 0x33, 0x1f, 0xbd, 0xf6, 0x51, 0xfe, 0xbd,
+  0x86, 0xa9, 0x94, 0x3d, 0x36, 0xce, 0xfe, 0xbc, 0x4d, 0xf7, 0x79, 0xbd,
+  0xdc, 0xe4, 0x1e, 0xbe, 0x2a, 0xf8, 0xad, 0xbc, 0x43, 0x8d, 0xcd, 0x3d,
+  0x1d, 0x1d, 0x25, 0xbd, 0x0b, 0x35, 0xe3, 0xbc, 0x9f, 0x6a, 0x2a, 0x3c,
+  0xc7, 0x48, 0x9e, 0xbd, 0x3f, 0x18, 0x63, 0xbd, 0x26, 0x9a, 0xa0, 0xbd,
+  0x1a, 0x32, 0x92, 0xbc, 0x85, 0x7e, 0x07, 0x3d, 0xc3, 0x3d, 0x8a, 0xbd,
+  0xba, 0x72, 0x90, 0xbd, 0x53, 0x34, 0x92, 0x3d, 0x97, 0xfa, 0xf2, 0x3c,
+  0x0d, 0x55, 0x02, 0x3d, 0x0d, 0x39, 0xb1, 0x3d, 0x2d, 0x62, 0x23, 0xbc,
+  0x81, 0xb5, 0x01, 0x3d, 0x76, 0xdf, 0x5d, 0x3d, 0xd9, 0x70, 0x7a, 0x3b,
+  0x9b, 0xcc, 0x5d, 0xbd, 0x35, 0x7b, 0xce, 0xbd, 0x99, 0xcf, 0x1a, 0xbe,
+  0x13, 0x46, 0x1a, 0xbe, 0xe8, 0x64, 0x00, 0xbd, 0xce, 0xb0, 0x06, 0x3e,
+  0xbf, 0xac, 0xbb, 0xbd, 0xdc, 0x73, 0x0c, 0xbe, 0xf2, 0xdf, 0xb9, 0x3c,
+  0x27, 0x7f, 0xb7, 0xbd, 0x41, 0xa0, 0xc4, 0xbd, 0xd1, 0x0a, 0xf2, 0xbd,
+  0x57, 0xd6, 0x0d, 0xbe, 0x7e, 0xd1, 0x92, 0x3d, 0xc0, 0x63, 0x36, 0xbe,
+  0x49, 0x93, 0xad, 0xbd, 0xac, 0xec, 0xd2, 0x3c, 0xfc, 0x45, 0x97, 0xbd,
+  0x62, 0x6d, 0xf2, 0xbc, 0x13, 0x59, 0x2f, 0xbc, 0xa8, 0x3a, 0x7b, 0xbd,
+  0xd2, 0xa0, 0x6f, 0x3c, 0xb8, 0x34, 0x32, 0xbc, 0xe3, 0x18, 0x57, 0xbd,
+  0x4d, 0xcd, 0x4d, 0xbd, 0x1e, 0x4b, 0x13, 0x3d, 0x25, 0xfe, 0x08, 0xbe,
+  0x95, 0x96, 0xc7, 0xbc, 0xb7, 0x72, 0x6f, 0xbd, 0x4d, 0x57, 0xaa, 0x3d,
+  0xdb, 0xaa, 0x02, 0xbe, 0x92, 0xd4, 0xab, 0xbd, 0xec, 0xb4, 0x40, 0x3d,
+  0xe2, 0x5c, 0x27, 0xbd, 0x9e, 0xf4, 0xc9, 0xbd, 0x3d, 0xd9, 0xcb, 0xbc,
+  0xa3, 0x31, 0x82, 0xbd, 0x10, 0xf3, 0x70, 0x3d, 0xd4, 0x3c, 0xbc, 0xbd,
+  0xff, 0xde, 0x8c, 0xbd, 0x64, 0x5d, 0xb3, 0x3d, 0xcf, 0xf6, 0xa1, 0x3c,
+  0x91, 0x89, 0x4a, 0xbc, 0x2f, 0x8b, 0x85, 0xbd, 0x71, 0x44, 0x9e, 0xbd,
+  0x53, 0xf2, 0x94, 0x3d, 0x0c, 0x92, 0xc4, 0xbd, 0xd8, 0x3c, 0x9b, 0xbc,
+  0x32, 0x5c, 0x20, 0x3d, 0x41, 0x16, 0x1b, 0x3d, 0x71, 0x20, 0xd5, 0xbd,
+  0x8a, 0xf7, 0x69, 0xbc, 0xe6, 0x9c, 0x64, 0xbd, 0x49, 0x79, 0x6a, 0x3e,
+  0x6b, 0x17, 0xf5, 0xbd, 0x63, 0x31, 0x48, 0xbd, 0x62, 0x8f, 0xaa, 0x3c,
+  0x0a, 0xc1, 0x21, 0xbd, 0xe7, 0x42, 0xcb, 0xbd, 0x63, 0x4e, 0x0c, 0xbd,
+  0x29, 0xc3, 0x07, 0xbe, 0xb3, 0xff, 0x63, 0x3e, 0xc5, 0x09, 0xb0, 0xbd,
+  0xc2, 0x0e, 0xa6, 0xbd, 0x68, 0xe0, 0x52, 0x3c, 0xa3, 0x63, 0x45, 0xbd,
+  0xb8, 0x6c, 0x32, 0xbd, 0x81, 0xbe, 0x31, 0x3b, 0x52, 0x49, 0x0b, 0xbe,
+  0xd6, 0xb8, 0x5c, 0x3d, 0x10, 0x3c, 0x08, 0xbe, 0x11, 0x4b, 0x13, 0xbd,
+  0x93, 0xb9, 0xaa, 0xbd, 0x61, 0x92, 0x20, 0xbd, 0xc7, 0x0b, 0x02, 0xbe,
+  0x84, 0x5a, 0x40, 0xbc, 0xe5, 0x88, 0x0f, 0xbe, 0x5b, 0x80, 0xb8, 0x3d,
+  0x3d, 0x96, 0x9d, 0xbd, 0xb5, 0xc5, 0xfe, 0xbd, 0x96, 0x1e, 0xd7, 0xbb,
+  0xed, 0xef, 0x4f, 0xbd, 0x29, 0xe2, 0x4e, 0xbd, 0x7c, 0x4e, 0x2e, 0xbd,
+  0x66, 0x27, 0x54, 0xbd, 0xae, 0xf5, 0xa6, 0x3d, 0x87, 0x02, 0x24, 0xbc,
+  0x8b, 0xd1, 0x0c, 0xbe, 0x75, 0xc9, 0x87, 0xbd, 0x7f, 0x78, 0x63, 0xbe,
+  0xed, 0xd9, 0xb9, 0xbd, 0xc7, 0x7a, 0xf4, 0xbd, 0xd4, 0x02, 0x08, 0xbe,
+  0x72, 0x73, 0x37, 0x3d, 0xa3, 0x69, 0x14, 0xbe, 0x14, 0x60, 0x09, 0xbe,
+  0xcd, 0x16, 0xd8, 0x3d, 0x5a, 0x60, 0x1c, 0xbd, 0xbc, 0x85, 0x30, 0x3c,
+  0x4a, 0x9b, 0xb6, 0xbd, 0xf2, 0x6d, 0xf1, 0xbd, 0xfb, 0x5a, 0x72, 0x3d,
+  0x61, 0x42, 0xcd, 0xbc, 0x44, 0x64, 0xc3, 0xbc, 0xe4, 0xef, 0xe9, 0x3c,
+  0x04, 0x82, 0x17, 0xbe, 0x5d, 0xb4, 0x5f, 0xbe, 0x69, 0x9e, 0x01, 0xbe,
+  0xd1, 0x60, 0xf8, 0xbd, 0x09, 0x34, 0x9a, 0x3d, 0xb9, 0xe6, 0x03, 0xbe,
+  0x78, 0xc0, 0xd2, 0xbd, 0x6b, 0x6b, 0xe0, 0xbc, 0x8b, 0x68, 0xd5, 0xbd,
+  0x8b, 0x42, 0xca, 0xbd, 0xe2, 0xfd, 0x02, 0xbe, 0xb5, 0x07, 0x55, 0xbe,
+  0x58, 0xbd, 0xba, 0xbc, 0xce, 0xa6, 0x18, 0xbd, 0x60, 0x61, 0x02, 0xbd,
+  0x46, 0x96, 0xa1, 0xbd, 0x68, 0xf9, 0x0a, 0xbd, 0x3f, 0xdb, 0xad, 0xbd,
+  0x22, 0x9d, 0x8f, 0xbd, 0x29, 0x60, 0xed, 0xbd, 0x35, 0x02, 0xdb, 0xbc,
+  0x2a, 0xd9, 0x0c, 0xbe, 0x4a, 0x8e, 0x26, 0xbe, 0x42, 0x61, 0xef, 0xbc,
+  0x1a, 0x25, 0xa6, 0xbd, 0x79, 0xbc, 0x5c, 0xbd, 0x7d, 0x8d, 0x8d, 0xbb,
+  0x49, 0xe8, 0x23, 0xbe, 0xfc, 0x5e, 0x0d, 0xbe, 0x69, 0xe4, 0xb8, 0xbd,
+  0xc4, 0xff, 0xc4, 0x3c, 0xbc, 0x69, 0x61, 0xbc, 0x60, 0xa9, 0x21, 0xbd,
+  0x01, 0x26, 0xfe, 0xbc, 0xc1, 0xc0, 0x89, 0x3d, 0xa3, 0xd4, 0x85, 0xbd,
+  0xcf, 0x33, 0x41, 0xbe, 0xd9, 0x1d, 0xca, 0xbc, 0x3b, 0x91, 0x7a, 0xbd,
+  0x2a, 0x45, 0xe6, 0xbb, 0x7a, 0xbd, 0x8c, 0x3b, 0xc4, 0x77, 0xe5, 0xbb,
+  0x5d, 0x1b, 0x51, 0x3d, 0x11, 0xdf, 0x35, 0x3d, 0x17, 0x45, 0x95, 0xbd,
+  0x15, 0x8a, 0x4b, 0x3c, 0xc6, 0xa7, 0xb8, 0xbc, 0xbe, 0xd8, 0x39, 0x3c,
+  0x5a, 0x5e, 0xf8, 0xba, 0x0e, 0xa4, 0xc4, 0x3c, 0x45, 0x36, 0x12, 0x3d,
+  0x53, 0x22, 0x33, 0xbd, 0x9e, 0x67, 0x9b, 0x3d, 0xd7, 0x1a, 0x7d, 0xbd,
+  0x80, 0x8e, 0x4a, 0x3d, 0x58, 0xb7, 0xe4, 0x3d, 0x94, 0xb0, 0xa2, 0x3d,
+  0xe6, 0xf5, 0x4d, 0x3d, 0xf9, 0x44, 0x11, 0x3d, 0xa8, 0x84, 0x45, 0xbb,
+  0xdb, 0x3a, 0x86, 0xbd, 0x74, 0x4b, 0xc3, 0xbc, 0x91, 0x43, 0x4e, 0x3d,
+  0x82, 0x85, 0x03, 0x3c, 0x31, 0x41, 0x96, 0x3d, 0x50, 0x46, 0x60, 0xbc,
+  0x69, 0x7e, 0xb8, 0xbc, 0xdf, 0x2a, 0x0e, 0xbd, 0x6a, 0x9f, 0x43, 0xbd,
+  0xa9, 0x39, 0x46, 0xbd, 0x6b, 0x46, 0xc3, 0xbc, 0x93, 0x91, 0x98, 0x3c,
+  0xa8, 0xb0, 0xd1, 0x3d, 0x79, 0x66, 0xa5, 0xbd, 0x10, 0x5c, 0xb3, 0x3b,
+  0x4a, 0x5e, 0x47, 0xbe, 0x65, 0x9b, 0xf1, 0xbd, 0xb0, 0xbf, 0x10, 0xbc,
+  0x4f, 0xbb, 0xfd, 0xbc, 0xb8, 0x4d, 0x7f, 0x3c, 0xe0, 0xfa, 0x3b, 0xbd,
+  0x6e, 0xba, 0xc0, 0x3b, 0xaf, 0xa0, 0x26, 0x3d, 0x2a, 0xd3, 0x02, 0xbe,
+  0xe4, 0x50, 0x92, 0x3b, 0x6c, 0x85, 0xa3, 0xbd, 0x21, 0xbf, 0x09, 0xbd,
+  0xa6, 0xa9, 0x52, 0xbc, 0x13, 0x3e, 0x77, 0xbe, 0x91, 0x7b, 0x6c, 0xbd,
+  0x1b, 0x28, 0x0d, 0xbe, 0x34, 0x6b, 0x3f, 0xbe, 0x2e, 0x19, 0x94, 0x3d,
+  0xab, 0x59, 0x33, 0xbe, 0x5b, 0x15, 0x88, 0xbe, 0x1e, 0x1a, 0xcb, 0x3c,
+  0xc7, 0xdb, 0x40, 0x3d, 0x24, 0x08, 0xb6, 0xbd, 0xe4, 0x55, 0xf6, 0x3c,
+  0xd3, 0x9f, 0x73, 0x3c, 0xb4, 0x01, 0xae, 0x3d, 0x3e, 0x0e, 0x68, 0x3d,
+  0x6b, 0xfb, 0x10, 0x3d, 0x9e, 0x56, 0xac, 0x3d, 0x94, 0x69, 0xb2, 0xbd,
+  0xf2, 0x8b, 0x88, 0xbd, 0x60, 0x40, 0xc9, 0xbd, 0xb8, 0x1a, 0x4d, 0xbd,
+  0x94, 0x38, 0x5c, 0x3c, 0x94, 0x1f, 0xa5, 0xbd, 0xc1, 0xa8, 0x8d, 0xbd,
+  0x55, 0x7b, 0x19, 0xbd, 0x92, 0xd2, 0xd6, 0xbd, 0x7c, 0x86, 0xc5, 0xbd,
+  0x46, 0x55, 0x08, 0xbd, 0xc1, 0x9b, 0xcc, 0xbd, 0xdb, 0x2e, 0xbb, 0xbd,
+  0x1e, 0xc4, 0xe6, 0xbc, 0xb1, 0x00, 0x61, 0xbd, 0xe1, 0xa0, 0x4d, 0xbc,
+  0x3c, 0xd0, 0x58, 0x3c, 0xf2, 0xd8, 0x25, 0xbc, 0x47, 0xf4, 0x9c, 0xbd,
+  0x56, 0x2a, 0xb6, 0xbd, 0x9b, 0xf9, 0x5d, 0xbe, 0xee, 0x97, 0x3e, 0xbd,
+  0xc8, 0xfd, 0xd7, 0x3c, 0xb0, 0xf4, 0x52, 0xbd, 0x4b, 0x27, 0x91, 0xbd,
+  0xb7, 0xf7, 0x83, 0x3c, 0xfc, 0x88, 0x25, 0x3d, 0xa5, 0x9a, 0x79, 0xbd,
+  0xc1, 0x4f, 0x19, 0xbe, 0x2c, 0xdb, 0x06, 0x3c, 0xae, 0x09, 0x25, 0x3d,
+  0xeb, 0x11, 0xdc, 0xbd, 0x04, 0x54, 0x90, 0xbd, 0x7d, 0x0c, 0x96, 0xbd,
+  0x24, 0xa8, 0xfb, 0xbc, 0x0f, 0xec, 0x67, 0xbd, 0x51, 0xb3, 0x56, 0xbc,
+  0x27, 0x26, 0x3c, 0xbd, 0x48, 0x26, 0x36, 0x3b, 0xb4, 0x62, 0x8a, 0xbb,
+  0xbb, 0xfd, 0x24, 0x3d, 0x25, 0xe5, 0x2d, 0x3d, 0xc0, 0xcf, 0x30, 0x3c,
+  0x47, 0x10, 0x9f, 0xbd, 0x5a, 0xe9, 0x18, 0xbd, 0xdd, 0x21, 0xc5, 0xbb,
+  0xb5, 0x51, 0x84, 0x3d, 0x79, 0xa8, 0xe8, 0x3d, 0xf0, 0x5f, 0x9d, 0x3d,
+  0x7c, 0x49, 0x0b, 0x3a, 0x8f, 0x6e, 0x9f, 0x3d, 0xbb, 0x97, 0x32, 0x3c,
+  0xc0, 0x6d, 0xa6, 0x3c, 0x0f, 0xee, 0x1b, 0xbc, 0x57, 0x20, 0x4f, 0x3d,
+  0xa0, 0x03, 0xa3, 0x3d, 0x09, 0x1a, 0x3c, 0x3e, 0x22, 0xee, 0x28, 0xba,
+  0x08, 0x88, 0x92, 0x3d, 0x2f, 0xab, 0x82, 0x3d, 0x78, 0x74, 0xc3, 0x3b,
+  0x6b, 0xd3, 0x2e, 0x3d, 0xe0, 0x79, 0xbd, 0x3d, 0xc5, 0x91, 0x56, 0x3d,
+  0x67, 0x9c, 0xfe, 0x3d, 0x2a, 0xc5, 0xf8, 0xbc, 0xc6, 0x34, 0x4b, 0xbc,
+  0x4e, 0x21, 0xbb, 0xbd, 0xcb, 0x08, 0xcc, 0xbd, 0x79, 0xcf, 0x78, 0x3d,
+  0x57, 0x23, 0x0a, 0x3d, 0x0a, 0xe4, 0xab, 0xbd, 0xba, 0x5f, 0xcf, 0x3d,
+  0xf5, 0xa9, 0x92, 0xbc, 0xe2, 0xaf, 0x9f, 0x3c, 0x11, 0xa2, 0x23, 0xbb,
+  0xcb, 0x68, 0x3a, 0xbd, 0xd0, 0x52, 0xfd, 0x3c, 0x13, 0xad, 0x51, 0x3d,
+  0x8d, 0x9d, 0x6c, 0xbd, 0x4e, 0x5d, 0xe8, 0x3d, 0x65, 0x08, 0x8b, 0x3d,
+  0x26, 0x0b, 0xf2, 0xbc, 0x81, 0x47, 0xcd, 0xbd, 0x82, 0x7e, 0x94, 0xbd,
+  0xe6, 0xaa, 0xe3, 0xbc, 0xd4, 0xe7, 0x9c, 0x3d, 0xc6, 0x76, 0x07, 0xbe,
+  0x0c, 0xb8, 0x09, 0xbe, 0xd5, 0xe9, 0xbb, 0xbd, 0x24, 0x99, 0x83, 0xbe,
+  0x2b, 0xb6, 0xa2, 0xbd, 0x5b, 0x77, 0x8f, 0xbc, 0x06, 0x6c, 0x1e, 0xbe,
+  0x29, 0x7b, 0x5b, 0xbe, 0xc6, 0xcc, 0x07, 0x3d, 0x82, 0xc0, 0xb8, 0x3a,
+  0x9f, 0x3f, 0x8f, 0xbc, 0x86, 0xa9, 0xfb, 0x3c, 0x02, 0xb2, 0x0a, 0xbd,
+  0x50, 0x31, 0x8d, 0x3b, 0x2c, 0xf0, 0xf6, 0xbc, 0x7e, 0x9b, 0x95, 0x3d,
+  0xe7, 0x37, 0xf0, 0xbc, 0x2f, 0x2b, 0xc4, 0xbd, 0x63, 0xdb, 0x6e, 0xbd,
+  0x5f, 0xe1, 0xed, 0xbd, 0x9a, 0x2b, 0xff, 0xbd, 0xd5, 0xbf, 0xd4, 0x3d,
+  0xfe, 0x61, 0xb5, 0xbd, 0xd1, 0x8e, 0xdc, 0xbd, 0xdd, 0xf0, 0x97, 0x3b,
+  0x07, 0xd2, 0xa9, 0x3c, 0xbc, 0x51, 0x96, 0xba, 0xa6, 0x57, 0x95, 0xbc,
+  0xc2, 0x7e, 0xf5, 0xbd, 0x0e, 0xbb, 0xd7, 0xbd, 0xb6, 0x2f, 0x3b, 0xbd,
+  0x0e, 0x61, 0x29, 0xbd, 0x45, 0xd6, 0x15, 0x3d, 0x03, 0x30, 0xa6, 0xbd,
+  0xb8, 0xc7, 0x12, 0xbd, 0xd0, 0xf9, 0x90, 0xbc, 0x73, 0x1b, 0xca, 0xbd,
+  0x7a, 0xd6, 0x6f, 0xbd, 0xfa, 0xdc, 0x81, 0x3d, 0xee, 0xb4, 0x8b, 0xbb,
+  0x6d, 0x6f, 0x36, 0xbd, 0x3a, 0x1a, 0x6a, 0xbd, 0xb3, 0xb9, 0x3f, 0xbd,
+  0x0a, 0x0b, 0x4b, 0xbd, 0x3b, 0xb6, 0x9d, 0x3c, 0x58, 0x55, 0x25, 0xbc,
+  0x9b, 0xa7, 0x5d, 0xbd, 0xdc, 0xae, 0x2f, 0x3d, 0xb0, 0xe2, 0x67, 0xbd,
+  0xf6, 0x00, 0xf6, 0x3c, 0xed, 0x11, 0x7b, 0x3d, 0x18, 0x91, 0x8d, 0x3d,
+  0x51, 0xf6, 0xd2, 0xbc, 0xd9, 0x15, 0x52, 0xbe, 0xce, 0x19, 0x91, 0x3d,
+  0xf9, 0x7d, 0x66, 0xbd, 0x76, 0x5b, 0x2c, 0xbe, 0x68, 0x24, 0x82, 0xbd,
+  0xfc, 0x73, 0x53, 0x3d, 0x31, 0x7e, 0xec, 0xbc, 0xe5, 0x74, 0x82, 0x3d,
+  0x54, 0x86, 0xc8, 0xbd, 0xd2, 0x44, 0x05, 0x3d, 0x4a, 0x94, 0x3e, 0x3d,
+  0xc4, 0xfb, 0xae, 0xbe, 0x19, 0xb9, 0x16, 0x3d, 0x89, 0x5d, 0xd3, 0x3d,
+  0x3d, 0x45, 0xb0, 0x3c, 0x02, 0xec, 0x2d, 0x3d, 0x7e, 0x68, 0xa0, 0xbd,
+  0x1b, 0xe9, 0x92, 0x3d, 0xc2, 0x25, 0xcd, 0xbb, 0x04, 0x2e, 0x6f, 0xbe,
+  0x80, 0x89, 0x3d, 0x3d, 0x0c, 0xa1, 0xde, 0x3d, 0x3b, 0x79, 0x5b, 0x3d,
+  0xbb, 0xa3, 0x8e, 0xbd, 0xaf, 0x4b, 0xbf, 0xbd, 0xb0, 0x47, 0xb2, 0x3d,
+  0x53, 0x6f, 0xf1, 0x3d, 0x3a, 0xd2, 0x7a, 0xbe, 0x19, 0x39, 0xcb, 0x3d,
+  0xb8, 0x77, 0xc5, 0x3b, 0x96, 0x48, 0x98, 0x3c, 0x10, 0x22, 0x3a, 0xbd,
+  0x26, 0x3c, 0x42, 0xbe, 0xb2, 0xa8, 0xad, 0x3c, 0x56, 0x03, 0xe8, 0x3d,
+  0x5f, 0xfd, 0x24, 0xbd, 0xd0, 0xf4, 0xe1, 0x3d, 0xb8, 0x70, 0xca, 0x3d,
+  0x89, 0xb9, 0x4a, 0xbb, 0xc5, 0x1e, 0xc6, 0xbd, 0xd9, 0x63, 0x25, 0xbe,
+  0x6c, 0x11, 0x4e, 0x3d, 0x8d, 0x06, 0xa1, 0x3d, 0xd3, 0x43, 0x61, 0xbd,
+  0x6c, 0xae, 0xa0, 0x3d, 0x9a, 0x46, 0xcd, 0x3b, 0xed, 0xe6, 0x0e, 0x3e,
+  0xe6, 0xcf, 0xc8, 0xbd, 0xf0, 0x7e, 0x09, 0xbe, 0xa2, 0xc5, 0xd3, 0x3d,
+  0x6d, 0x3d, 0x84, 0x3d, 0xe6, 0x84, 0xff, 0xbd, 0x02, 0xee, 0xf7, 0xbd,
+  0x43, 0xda, 0xb2, 0xbd, 0xeb, 0xfe, 0x71, 0xbd, 0x34, 0x44, 0x85, 0xbd,
+  0x4a, 0x1e, 0x96, 0x3d, 0xea, 0xb5, 0x36, 0xbe, 0xcc, 0xf7, 0x42, 0xbe,
+  0x77, 0x97, 0x7e, 0x3d, 0xaf, 0x47, 0x99, 0xbd, 0x9f, 0x09, 0x91, 0xbd,
+  0x2f, 0x43, 0x05, 0x3d, 0x15, 0xbf, 0xad, 0x3d, 0xdf, 0xec, 0x8a, 0x3d,
+  0xec, 0x09, 0xa0, 0xbc, 0xad, 0x7b, 0xcc, 0xbd, 0xb1, 0xd7, 0xe5, 0x3c,
+  0xe4, 0x22, 0x06, 0x3d, 0xba, 0xec, 0xc3, 0xbd, 0xe4, 0x82, 0xe3, 0xbd,
+  0xfc, 0xf9, 0x36, 0xbd, 0x9c, 0x36, 0x02, 0xbd, 0x5c, 0xba, 0x37, 0xbd,
+  0x43, 0x54, 0x01, 0xbe, 0xf2, 0x69, 0xd6, 0x3d, 0xdc, 0x10, 0xa8, 0x3d,
+  0xc5, 0xb8, 0xa6, 0x3c, 0xd7, 0x3b, 0x27, 0x3d, 0x73, 0x0c, 0xd9, 0xbd,
+  0x73, 0xc5, 0x00, 0xbe, 0xb3, 0x07, 0xb3, 0x3c, 0x83, 0xbe, 0x8a, 0x3d,
+  0x31, 0x22, 0xdf, 0x3c, 0x3c, 0xe3, 0x7b, 0xbd, 0x20, 0x13, 0x09, 0xbc,
+  0x11, 0x7f, 0x96, 0x3d, 0x01, 0x28, 0x58, 0xbd, 0x2f, 0xd0, 0x4f, 0xbe,
+  0x8a, 0x46, 0x24, 0x3b, 0xbc, 0xd3, 0x7b, 0xbb, 0x9c, 0x75, 0xd0, 0x3a,
+  0x01, 0x76, 0x55, 0xbd, 0xcd, 0xac, 0x4c, 0xbd, 0xbf, 0xb9, 0x99, 0x3d,
+  0x26, 0x0e, 0x2f, 0xbd, 0x28, 0x97, 0x30, 0xbe, 0x47, 0xe3, 0x54, 0xbc,
+  0x8d, 0x42, 0x03, 0xbd, 0x6a, 0x73, 0xb8, 0xbd, 0xe1, 0x7b, 0x2c, 0xbd,
+  0x69, 0x9a, 0x29, 0xbc, 0x8e, 0xff, 0x90, 0x3c, 0xc4, 0x4a, 0x05, 0xbd,
+  0xcc, 0x71, 0xae, 0xbe, 0xe6, 0x27, 0xad, 0x3d, 0x8a, 0x2b, 0x11, 0x3d,
+  0x71, 0x28, 0xc5, 0xbe, 0xc4, 0x6a, 0x37, 0xbe, 0x02, 0x3d, 0xbf, 0xbc,
+  0x6a, 0xa3, 0x7e, 0xbc, 0xf0, 0x9f, 0xa4, 0xbb, 0xfa, 0x3d, 0xcd, 0x39,
+  0x80, 0xbd, 0xad, 0xbd, 0xdb, 0x84, 0xad, 0xbd, 0x18, 0x89, 0x0b, 0xbf,
+  0xd6, 0x0e, 0x36, 0xbe, 0x82, 0xd1, 0x54, 0xbd, 0x63, 0xcb, 0xf8, 0xbd,
+  0x7f, 0xe1, 0xf8, 0xbc, 0xd6, 0xf2, 0xe3, 0x3d, 0xe4, 0x27, 0x19, 0xbe,
+  0x86, 0x11, 0xa6, 0xbd, 0x7a, 0x20, 0xff, 0xbe, 0x21, 0x09, 0x40, 0xbd,
+  0x04, 0x2b, 0x5d, 0x3d, 0x2e, 0x32, 0x00, 0x3b, 0x00, 0x58, 0x0e, 0xbe,
+  0x4e, 0x2a, 0x10, 0xbe, 0x2d, 0x9d, 0x5c, 0x3d, 0xb5, 0xc8, 0x02, 0x3d,
+  0xb3, 0x06, 0xa5, 0xbe, 0xd2, 0x7f, 0xd8, 0x3d, 0x07, 0x8f, 0x88, 0x3d,
+  0x0c, 0xf2, 0xaa, 0x3d, 0x67, 0x78, 0xb2, 0xbc, 0x4d, 0xdb, 0x3d, 0xbe,
+  0xde, 0x74, 0xf0, 0x3c, 0xa0, 0xbb, 0x5a, 0x3d, 0xc5, 0xe3, 0x12, 0xbe,
+  0x61, 0x80, 0x05, 0x3e, 0xc9, 0x5d, 0xa2, 0x3d, 0x5b, 0x65, 0xe8, 0x3d,
+  0xaa, 0x52, 0x54, 0x3c, 0xf4, 0x81, 0x10, 0xbe, 0xe1, 0x85, 0xeb, 0x3d,
+  0xd9, 0x1c, 0xcc, 0x3d, 0x07, 0xe5, 0x4b, 0xbb, 0xba, 0x54, 0x0e, 0x3e,
+  0x24, 0x76, 0xb7, 0x3d, 0x42, 0x94, 0x04, 0x3e, 0x69, 0xe2, 0xf4, 0xbc,
+  0x91, 0x5c, 0x56, 0xbe, 0xeb, 0xba, 0x11, 0x3e, 0xd6, 0xe1, 0x0e, 0x3e,
+  0x77, 0x1a, 0xce, 0xbc, 0x20, 0xd2, 0x0f, 0x3d, 0x9d, 0x4f, 0x3c, 0x3d,
+  0xf9, 0x53, 0xc1, 0x3b, 0x54, 0x12, 0x76, 0xbc, 0x37, 0x77, 0x97, 0xbc,
+  0xf6, 0x52, 0xdc, 0xbd, 0x06, 0x65, 0x85, 0xbd, 0x3d, 0xc7, 0x92, 0xbb,
+  0xaa, 0xbb, 0x2f, 0xbe, 0x6e, 0x04, 0x9b, 0xbc, 0xe9, 0x31, 0x00, 0xbe,
+  0x48, 0xef, 0xf3, 0xbd, 0x73, 0xc9, 0x1e, 0x3d, 0x3f, 0x1d, 0xef, 0xbd,
+  0xe0, 0xb5, 0x13, 0xbd, 0x9c, 0x5d, 0xd2, 0x3c, 0x53, 0xe6, 0x87, 0xbc,
+  0x36, 0x15, 0x9b, 0xbb, 0x96, 0xdf, 0xa1, 0xbd, 0xd3, 0x5b, 0xa1, 0xbd,
+  0x7c, 0xc5, 0xb1, 0xbd, 0xa0, 0x24, 0xb9, 0xbc, 0x17, 0xe0, 0xb2, 0xbc,
+  0xe8, 0x93, 0xda, 0x3a, 0xce, 0x36, 0xc5, 0x3d, 0xe5, 0xff, 0x96, 0x3d,
+  0x2a, 0xf1, 0x71, 0x3d, 0x06, 0xfc, 0x82, 0x3a, 0x64, 0x52, 0x50, 0xbe,
+  0x5e, 0x37, 0xd8, 0x3d, 0x0e, 0x50, 0xf4, 0x3d, 0xd0, 0xa8, 0x51, 0x3d,
+  0x85, 0xe0, 0x3a, 0x3d, 0xe7, 0x69, 0xdf, 0x3d, 0x04, 0xab, 0x72, 0x3d,
+  0xc9, 0x82, 0xf2, 0xbb, 0xf8, 0x11, 0xd3, 0xbe, 0xe3, 0x7a, 0xcb, 0x3d,
+  0xa1, 0x9e, 0x4b, 0x3c, 0xc6, 0xc4, 0x12, 0xbc, 0xf4, 0xed, 0x4d, 0x3d,
+  0x6b, 0x9b, 0xb1, 0x3d, 0xc2, 0x4c, 0x14, 0x3e, 0xc3, 0xf4, 0xa2, 0x3d,
+  0x17, 0xff, 0xcd, 0xbe, 0x44, 0x31, 0xa3, 0x3c, 0x42, 0x89, 0xbb, 0x3d,
+  0x42, 0x46, 0x96, 0xbe, 0x97, 0x46, 0x78, 0xbd, 0xad, 0x29, 0x04, 0x3d,
+  0x2c, 0xc7, 0xac, 0x3c, 0xb6, 0x00, 0x29, 0x3d, 0x9d, 0x01, 0xa5, 0xbe,
+  0xd3, 0x53, 0xea, 0xbc, 0x0f, 0x1b, 0x1d, 0xbc, 0xbe, 0xf3, 0xb8, 0xbe,
+  0x5f, 0x58, 0x85, 0xbe, 0xd3, 0x9f, 0x53, 0xbe, 0x37, 0x49, 0x6f, 0xbe,
+  0x4a, 0xdf, 0xfc, 0xbc, 0x89, 0xd7, 0x24, 0xbe, 0x99, 0x72, 0xb1, 0xbd,
+  0xee, 0xde, 0x80, 0xbe, 0x7b, 0x14, 0x54, 0xbe, 0x60, 0xeb, 0x83, 0xbe,
+  0xc8, 0x4b, 0x6c, 0xbe, 0x13, 0x66, 0xce, 0xbd, 0xaf, 0x78, 0x8a, 0xbe,
+  0x8b, 0xa8, 0xb7, 0xbd, 0xcb, 0x2e, 0x80, 0xbe, 0x76, 0x7a, 0x42, 0xbe,
+  0xd0, 0xcd, 0x72, 0xbe, 0x37, 0xe1, 0xc6, 0xbd, 0xd0, 0x35, 0xd6, 0xbd,
+  0x7c, 0x91, 0x20, 0x3d, 0x06, 0x27, 0x0c, 0xbe, 0x72, 0xdd, 0xcf, 0xbd,
+  0xd8, 0x8a, 0x18, 0xbd, 0x9e, 0x27, 0x4e, 0xbd, 0xb4, 0x8e, 0x8e, 0xbe,
+  0x58, 0x5d, 0x2b, 0xbd, 0xd0, 0x1a, 0x0f, 0x3d, 0xad, 0xe1, 0x3d, 0x3d,
+  0x9a, 0x78, 0xeb, 0xbc, 0x92, 0x4b, 0xaf, 0x3c, 0x78, 0x3e, 0xb7, 0x3d,
+  0xce, 0x27, 0xd4, 0x3d, 0x98, 0xd9, 0x55, 0xbe, 0xae, 0x66, 0xc8, 0x3d,
+  0x06, 0x81, 0x4e, 0x3c, 0x33, 0x7c, 0x21, 0x3e, 0x50, 0x23, 0x0d, 0xbd,
+  0x44, 0xb1, 0x6e, 0xbd, 0x85, 0x1e, 0x9f, 0x3d, 0xb5, 0xc7, 0xce, 0x3d,
+  0x1f, 0x71, 0x19, 0xbe, 0x48, 0xb3, 0x48, 0x3e, 0xa1, 0x62, 0x51, 0x3e,
+  0xc3, 0x0e, 0x70, 0x3e, 0x32, 0xf0, 0x1a, 0x3d, 0x70, 0x6c, 0x07, 0xbe,
+  0x09, 0x80, 0x20, 0x3e, 0xee, 0xbb, 0x2a, 0x3e, 0x4c, 0xfc, 0x87, 0xbd,
+  0x02, 0x89, 0x8e, 0x3d, 0xe2, 0x5b, 0x15, 0x3e, 0x76, 0xff, 0xa0, 0xbc,
+  0x58, 0x6f, 0xc2, 0x3d, 0x0a, 0x0b, 0x16, 0x3d, 0xda, 0xc6, 0x42, 0x3d,
+  0xf3, 0xbd, 0x4e, 0x3d, 0x7e, 0x26, 0x39, 0x3d, 0x0d, 0xe5, 0x5d, 0xbe,
+  0x44, 0x8b, 0x68, 0xbe, 0xe5, 0x4d, 0x55, 0xbe, 0xed, 0xd1, 0x1c, 0xbe,
+  0xa2, 0xb0, 0x9c, 0x3d, 0x60, 0x0c, 0x53, 0xbe, 0x1a, 0x4c, 0x1a, 0xbe,
+  0x10, 0xb9, 0x3c, 0x3c, 0x43, 0x4f, 0x27, 0xbb, 0x04, 0xff, 0xcf, 0x3c,
+  0x36, 0x19, 0x05, 0x3c, 0x1c, 0xfb, 0x3f, 0xbc, 0xdc, 0x9b, 0xe3, 0xbc,
+  0x35, 0x53, 0x78, 0x3b, 0x43, 0xe3, 0x10, 0x3d, 0x53, 0x20, 0x34, 0xbe,
+  0x49, 0xcb, 0x8e, 0xbb, 0xea, 0x5a, 0xff, 0x3d, 0x17, 0xb8, 0x23, 0x3d,
+  0x9f, 0xec, 0xad, 0xbc, 0xd7, 0xcb, 0x2a, 0xbe, 0xbb, 0x6a, 0x4d, 0x3d,
+  0x39, 0x49, 0xe8, 0x3d, 0x94, 0x85, 0x37, 0xbe, 0x65, 0x50, 0x84, 0x3d,
+  0xc3, 0x05, 0x4d, 0x3d, 0xb6, 0x9a, 0xe6, 0x3d, 0xf3, 0x77, 0x0f, 0xb8,
+  0x7f, 0xab, 0xb5, 0xbe, 0xfb, 0x7c, 0xc9, 0x3d, 0x08, 0x8a, 0xac, 0x3d,
+  0x02, 0x56, 0x89, 0xbe, 0x96, 0xfd, 0xb4, 0x3d, 0xeb, 0x0e, 0xe5, 0x3d,
+  0x64, 0xe1, 0x37, 0x3e, 0xcb, 0x66, 0x80, 0x3d, 0x65, 0xb3, 0xca, 0xbe,
+  0x0a, 0xce, 0xa3, 0x3d, 0x4d, 0x02, 0x1b, 0x3e, 0xe8, 0x8c, 0xb2, 0xbe,
+  0x24, 0xd5, 0x9f, 0xbd, 0x7e, 0xd3, 0xd0, 0xbc, 0x52, 0x0f, 0xc9, 0xbb,
+  0x00, 0x58, 0x88, 0xbd, 0xfa, 0x97, 0xc6, 0xbe, 0xd5, 0xb6, 0x25, 0x3c,
+  0x64, 0x85, 0x48, 0x3d, 0x16, 0xff, 0x24, 0xbe, 0x2f, 0xe4, 0x57, 0xbe,
+  0x33, 0x67, 0x91, 0xbe, 0x9e, 0xec, 0x0c, 0xbe, 0x04, 0x39, 0x67, 0xbe,
+  0x4b, 0x03, 0x59, 0xbe, 0xe4, 0x24, 0x7d, 0xbe, 0x4b, 0x39, 0x55, 0xbe,
+  0x35, 0x7f, 0x14, 0x3c, 0x57, 0x75, 0x70, 0xbe, 0xf8, 0x12, 0xf8, 0xbd,
+  0xcb, 0xcd, 0x9e, 0xbd, 0x5e, 0x16, 0x8e, 0xbe, 0x86, 0x18, 0x7a, 0xbe,
+  0xb2, 0xb3, 0xb9, 0xbd, 0x80, 0x64, 0xf5, 0xbd, 0xf8, 0xc4, 0xb3, 0xbd,
+  0xa1, 0x7b, 0x1a, 0xbe, 0x1c, 0x2d, 0x76, 0xba, 0x10, 0xb0, 0x36, 0x3d,
+  0x66, 0x59, 0x19, 0xbd, 0x5c, 0xf9, 0x0e, 0xbe, 0xa2, 0x74, 0x29, 0xbc,
+  0x29, 0x2e, 0xec, 0x3b, 0xc7, 0xdd, 0x22, 0xbe, 0x57, 0x7a, 0xf2, 0xbc,
+  0x24, 0x12, 0xc8, 0x3d, 0x25, 0x02, 0x0a, 0x3d, 0xd1, 0x6d, 0x23, 0x3d,
+  0x1b, 0xb2, 0x54, 0xbd, 0x8f, 0xc4, 0x71, 0x3c, 0x47, 0xc6, 0x20, 0xbc,
+  0x8c, 0xb7, 0xe8, 0xbd, 0x88, 0x47, 0xb2, 0x3c, 0x96, 0x92, 0xa6, 0x3d,
+  0xff, 0x3c, 0x6a, 0x3d, 0x6f, 0x3d, 0x6e, 0xbb, 0xeb, 0x83, 0x81, 0xbd,
+  0x37, 0x97, 0x2a, 0x3d, 0xd3, 0x95, 0xce, 0x3d, 0xfe, 0xc2, 0x81, 0xbe,
+  0x20, 0x53, 0x3a, 0x3d, 0x09, 0x8a, 0x26, 0x3e, 0xf9, 0xa6, 0xc5, 0x3d,
+  0x26, 0x70, 0x5f, 0x3d, 0x28, 0xbd, 0xa0, 0xbd, 0xb7, 0xc4, 0x28, 0x3e,
+  0x7f, 0xdd, 0x08, 0x3e, 0x25, 0xe7, 0x8d, 0xbb, 0x02, 0xdd, 0xf7, 0x3d,
+  0x3b, 0x4a, 0x27, 0x3e, 0x0c, 0x33, 0x1e, 0xbe, 0xfb, 0x4a, 0x79, 0x3d,
+  0x61, 0xea, 0x84, 0x3d, 0xc3, 0x4a, 0xc2, 0xbd, 0x5e, 0xb0, 0x96, 0x3b,
+  0xe5, 0x51, 0x18, 0x3c, 0x8a, 0x08, 0x58, 0xbe, 0xf5, 0x84, 0x1b, 0xbe,
+  0x8b, 0x32, 0x4d, 0xbe, 0x5b, 0x82, 0xf1, 0xbd, 0x00, 0x0c, 0x98, 0xbc,
+  0xf5, 0x32, 0x2c, 0xbe, 0x81, 0x72, 0x2e, 0xbe, 0xbb, 0x6e, 0x07, 0xbd,
+  0xc0, 0x53, 0x0e, 0x3d, 0xc0, 0xc1, 0xfa, 0x3d, 0xa5, 0xd6, 0x12, 0x3d,
+  0xd7, 0x63, 0xf1, 0x3c, 0x7e, 0xc5, 0x1f, 0x3d, 0x5d, 0x2b, 0x5c, 0xba,
+  0xcd, 0xb1, 0x74, 0x3c, 0x8f, 0x36, 0x7d, 0xbe, 0xfb, 0x18, 0x4c, 0x3d,
+  0xc7, 0x26, 0xc8, 0x3d, 0xab, 0xfb, 0x52, 0x3d, 0xf8, 0x88, 0xd2, 0xbc,
+  0xcc, 0x54, 0xe6, 0xbd, 0x2d, 0x35, 0xb1, 0x3c, 0xc0, 0xd6, 0xf8, 0xbb,
+  0x67, 0xc0, 0x81, 0xbe, 0x06, 0x6a, 0xb2, 0x3d, 0x6a, 0xb8, 0xbe, 0x3d,
+  0x3d, 0x2f, 0xe3, 0x3c, 0xff, 0x95, 0x03, 0x3d, 0x93, 0xf3, 0x39, 0xbe,
+  0x16, 0x98, 0xed, 0x3d, 0x31, 0x4a, 0x6c, 0x3d, 0x5e, 0x71, 0x70, 0xbe,
+  0xd6, 0xac, 0xe6, 0x3d, 0x0f, 0x01, 0x0c, 0x3e, 0x2b, 0x41, 0x29, 0x3e,
+  0x64, 0x51, 0x17, 0x3d, 0x66, 0xfa, 0xb4, 0xbe, 0x5f, 0x8c, 0xd5, 0x3d,
+  0x82, 0xc3, 0x0d, 0x3e, 0x34, 0xe9, 0x1e, 0xbe, 0x5a, 0xe7, 0x2c, 0x3d,
+  0x71, 0xdd, 0x53, 0xbd, 0x03, 0x1a, 0xd6, 0xba, 0x7b, 0xc7, 0x86, 0xbd,
+  0x84, 0x1c, 0xd4, 0xbe, 0x77, 0x24, 0x97, 0xbc, 0xe2, 0xcf, 0x89, 0x3c,
+  0x5f, 0x51, 0x04, 0x3e, 0x26, 0x3e, 0x1e, 0xbe, 0xf5, 0xc6, 0x4a, 0xbe,
+  0xfa, 0x75, 0x27, 0xbe, 0x81, 0xcd, 0x39, 0xbe, 0x51, 0xea, 0x86, 0xbe,
+  0xf5, 0xea, 0x5f, 0xbe, 0x50, 0x46, 0x0d, 0xbe, 0x96, 0xd0, 0x87, 0x3c,
+  0xfa, 0x59, 0xf8, 0xbd, 0x9c, 0xca, 0xd9, 0xbd, 0xff, 0xe2, 0x63, 0xbc,
+  0x95, 0xe0, 0xc7, 0xbd, 0x6e, 0x95, 0x37, 0xbe, 0x11, 0x43, 0x09, 0xbe,
+  0x5d, 0x3e, 0xea, 0xbd, 0xd6, 0x40, 0xdc, 0xbc, 0xd3, 0xbc, 0xe4, 0xbd,
+  0xc0, 0x69, 0xe2, 0xba, 0x73, 0x45, 0x9b, 0x3d, 0x48, 0x49, 0xb5, 0xbc,
+  0xaa, 0xff, 0x3b, 0x3d, 0x20, 0x0b, 0x9e, 0x3d, 0x40, 0x73, 0x83, 0x3d,
+  0x74, 0x8a, 0xc7, 0x3c, 0xf0, 0x35, 0xa8, 0xbd, 0x1d, 0x9f, 0xc7, 0x3c,
+  0x01, 0xbb, 0x66, 0x3d, 0xec, 0x38, 0x80, 0x3d, 0x6f, 0xe4, 0xad, 0x3d,
+  0x03, 0x67, 0x8d, 0x3d, 0xfc, 0x64, 0xdb, 0xbc, 0x48, 0x57, 0x9b, 0xbd,
+  0x7b, 0x15, 0x90, 0xbd, 0xc4, 0xca, 0x8d, 0xbc, 0x99, 0x75, 0x0f, 0x3d,
+  0xc7, 0xb8, 0xb4, 0xbc, 0xa8, 0xea, 0xbf, 0xbb, 0xb5, 0x8d, 0xab, 0x3c,
+  0x47, 0x99, 0xb9, 0x3c, 0x6f, 0x65, 0x94, 0xbe, 0xca, 0x10, 0xee, 0x3d,
+  0x88, 0x78, 0xe0, 0x3d, 0x38, 0x45, 0xa4, 0x3c, 0x2c, 0x6b, 0x9b, 0x3d,
+  0x77, 0x0a, 0x30, 0xbd, 0xbd, 0x84, 0x6c, 0x3d, 0x76, 0x1f, 0xee, 0x3d,
+  0x16, 0xac, 0x52, 0x3b, 0xa9, 0xcc, 0x3e, 0xbc, 0x40, 0x9d, 0x04, 0x3e,
+  0xf8, 0xd5, 0xf5, 0xbd, 0xb2, 0xbc, 0x45, 0xbd, 0x3c, 0xa5, 0x5c, 0x3d,
+  0x5d, 0x96, 0xf1, 0xbd, 0x87, 0xb2, 0x30, 0xbc, 0xdf, 0x4f, 0xbe, 0x3d,
+  0x2d, 0x6a, 0x18, 0xbd, 0x70, 0x2d, 0x08, 0xbe, 0xb3, 0x56, 0xbc, 0xbd,
+  0xf5, 0x87, 0x6c, 0xbd, 0x10, 0x07, 0x7c, 0xbc, 0x60, 0x26, 0x30, 0xbe,
+  0xaa, 0x68, 0x8b, 0xbd, 0x9f, 0xed, 0xdd, 0xbc, 0xd9, 0xa3, 0x9a, 0xbc,
+  0xed, 0xa0, 0x8b, 0x3c, 0xc7, 0xca, 0x48, 0x3d, 0x76, 0x3f, 0x0b, 0x3c,
+  0x99, 0x20, 0xb2, 0xbc, 0x75, 0xa7, 0xb4, 0xba, 0xd0, 0x90, 0x80, 0x3d,
+  0xc1, 0x03, 0x76, 0xbe, 0x6b, 0xf9, 0xac, 0xbc, 0x90, 0xbc, 0x78, 0x3d,
+  0x36, 0x14, 0x19, 0x3d, 0x89, 0xda, 0xba, 0xbd, 0xc1, 0x9d, 0x92, 0xbd,
+  0xc1, 0x75, 0x6e, 0x3d, 0x43, 0x81, 0x18, 0x3d, 0x31, 0xb4, 0x72, 0xbe,
+  0x80, 0xd8, 0x9e, 0x3d, 0x86, 0x2d, 0xdf, 0x3d, 0xaa, 0x45, 0x74, 0xb9,
+  0x48, 0xe8, 0x84, 0xbc, 0xb8, 0x4b, 0x47, 0x3c, 0xbe, 0xa3, 0x8a, 0x3d,
+  0x40, 0x6d, 0xb8, 0x3d, 0x11, 0x14, 0x40, 0xbe, 0xe8, 0x6c, 0x03, 0x3e,
+  0x91, 0x72, 0x05, 0x3e, 0x7c, 0x31, 0x26, 0x3e, 0x88, 0x57, 0xbe, 0x3d,
+  0x46, 0x8e, 0x2a, 0xbd, 0x86, 0x54, 0x96, 0x3d, 0xf4, 0xe5, 0x9b, 0x3d,
+  0x01, 0x66, 0x50, 0x3d, 0x5c, 0xe5, 0xc9, 0x3d, 0x4a, 0xdb, 0x8e, 0x3d,
+  0x42, 0xc0, 0xb0, 0x3d, 0xf6, 0x41, 0xa4, 0x3d, 0x8d, 0xfc, 0x09, 0xbe,
+  0xfa, 0x4c, 0xaf, 0x3d, 0xe4, 0x06, 0xca, 0x3d, 0x5c, 0xbc, 0x2b, 0x3e,
+  0x76, 0x60, 0x74, 0x3c, 0xe3, 0xc8, 0x74, 0xbd, 0xbc, 0x26, 0xf9, 0x3c,
+  0xe6, 0x35, 0x8c, 0x3d, 0x3b, 0x93, 0xcd, 0x3d, 0x1e, 0x0a, 0x1b, 0xbd,
+  0xaf, 0x27, 0x98, 0xbd, 0xfe, 0xcf, 0xdc, 0x3d, 0xbe, 0x5b, 0x10, 0xbe,
+  0x2d, 0x97, 0x8f, 0xbd, 0x75, 0xa7, 0x6f, 0xbc, 0x3c, 0xeb, 0x0a, 0xbd,
+  0x4f, 0x7c, 0x12, 0x3e, 0xb2, 0xe8, 0x69, 0x3d, 0x6b, 0xde, 0x3f, 0xbd,
+  0x95, 0x9d, 0x3e, 0x3e, 0xf3, 0x5b, 0x12, 0xbe, 0xa9, 0xce, 0xf4, 0x3b,
+  0x08, 0x9e, 0x2f, 0x39, 0xb3, 0xd6, 0x9c, 0x3d, 0x0e, 0x0d, 0x9e, 0x3c,
+  0x5e, 0x70, 0x85, 0x3c, 0xd5, 0xcd, 0xfc, 0xbd, 0x76, 0x03, 0xbd, 0x3d,
+  0xb1, 0x93, 0xbc, 0xbd, 0xe6, 0x3a, 0xbe, 0xbd, 0x11, 0xd9, 0x05, 0x3d,
+  0x8f, 0x8d, 0x8d, 0xbd, 0x58, 0x83, 0x80, 0xbd, 0x80, 0xfa, 0x20, 0x3b,
+  0x0e, 0x58, 0x0d, 0x3d, 0xed, 0xf4, 0x95, 0xbd, 0xcd, 0xd4, 0x25, 0xbd,
+  0x72, 0x9b, 0x0d, 0x3d, 0x85, 0x77, 0xd9, 0x3b, 0x08, 0x7d, 0xdb, 0x3c,
+  0xfe, 0xd7, 0x9e, 0xbc, 0x65, 0x39, 0x5e, 0x3d, 0x16, 0x66, 0x1a, 0x3c,
+  0xf6, 0x22, 0x35, 0xbd, 0x0c, 0x06, 0xdf, 0xbc, 0x55, 0x6c, 0x39, 0x3d,
+  0xf8, 0xf6, 0x34, 0x3c, 0x24, 0x58, 0x9e, 0x3b, 0x9f, 0x24, 0xa9, 0x3d,
+  0xd6, 0xe1, 0xb5, 0x3c, 0x18, 0x98, 0x71, 0xbd, 0xdd, 0xc1, 0x30, 0x3d,
+  0xfd, 0xd9, 0x45, 0xbd, 0x2f, 0x99, 0x5c, 0xbd, 0x14, 0xc6, 0xc5, 0xbd,
+  0x90, 0x20, 0xa8, 0xbd, 0x44, 0xc3, 0x33, 0x3d, 0x3b, 0xff, 0x1d, 0xbe,
+  0x90, 0xe8, 0x1a, 0xbd, 0xff, 0x2c, 0x20, 0xbc, 0xd2, 0xb1, 0x6d, 0xbd,
+  0xc8, 0x19, 0x17, 0xbb, 0x1c, 0x42, 0x0e, 0x3c, 0xe1, 0x68, 0x8f, 0xbd,
+  0x75, 0xe3, 0xc9, 0x3d, 0xd7, 0xc2, 0x04, 0x3c, 0x1a, 0x8b, 0x05, 0xbe,
+  0x6f, 0x94, 0xda, 0xbd, 0xeb, 0x53, 0x80, 0xbb, 0x7c, 0x6f, 0xd3, 0x3d,
+  0x2c, 0x92, 0xa6, 0x3c, 0xcd, 0x98, 0x93, 0x3d, 0xc7, 0x40, 0x98, 0x3d,
+  0x7e, 0x87, 0x39, 0x3c, 0x4f, 0x13, 0xc8, 0xbc, 0x4b, 0x52, 0x59, 0xbe,
+  0xe2, 0xff, 0x3d, 0x3c, 0x1a, 0x9b, 0x15, 0x3c, 0x00, 0x0b, 0x50, 0x3d,
+  0x8b, 0xfe, 0x85, 0x3c, 0xaf, 0xb0, 0x09, 0xbc, 0x34, 0x4b, 0xe3, 0x3c,
+  0xda, 0xbb, 0x66, 0x3d, 0x11, 0xae, 0x13, 0xbe, 0x41, 0x93, 0x0e, 0xbd,
+  0xf2, 0x03, 0xf4, 0x3c, 0xc9, 0xa2, 0xb0, 0xbc, 0x35, 0xb5, 0x5b, 0xbc,
+  0x89, 0xa6, 0x4e, 0x3d, 0xc2, 0x91, 0x90, 0x3d, 0x6f, 0xf9, 0x3a, 0x3c,
+  0x56, 0x3d, 0x0b, 0xbe, 0xa4, 0xeb, 0x86, 0xba, 0x49, 0x7d, 0xa0, 0x3d,
+  0xbb, 0x2b, 0xd9, 0x3d, 0x22, 0x5d, 0xed, 0x3c, 0xaf, 0x5f, 0xab, 0x3b,
+  0xb5, 0xb1, 0xcc, 0x3d, 0x46, 0x01, 0x9d, 0x3d, 0x5f, 0xbc, 0xc4, 0x3d,
+  0x39, 0xfd, 0x50, 0x3e, 0x04, 0xd1, 0x46, 0x3c, 0x0b, 0xa5, 0x85, 0xbc,
+  0xf3, 0xb3, 0xa4, 0x3d, 0x0f, 0x74, 0x85, 0x3d, 0x3c, 0xe4, 0x71, 0x3d,
+  0x4b, 0x4f, 0xce, 0x3c, 0x6f, 0xd1, 0x6c, 0x3e, 0xaf, 0xe9, 0xc8, 0x3d,
+  0x64, 0x66, 0x9a, 0xbd, 0x37, 0x47, 0x9f, 0xbc, 0x2a, 0x5a, 0xc0, 0xbc,
+  0x86, 0xe4, 0x44, 0x3d, 0xe8, 0xf7, 0xc5, 0xbc, 0x13, 0x49, 0xa0, 0x3c,
+  0x9b, 0x2e, 0x33, 0x3e, 0x34, 0xc1, 0x66, 0xbc, 0x1e, 0x11, 0x1c, 0x3c,
+  0x4a, 0xd1, 0x89, 0xbd, 0xc4, 0xef, 0x6c, 0x3c, 0xc3, 0x43, 0x16, 0xbd,
+  0xdd, 0xda, 0x8c, 0xbd, 0xae, 0x01, 0x14, 0x3c, 0x41, 0xc1, 0x06, 0x3e,
+  0xdd, 0xf3, 0xf8, 0xbd, 0x0e, 0x5d, 0xab, 0xbc, 0x00, 0x86, 0x39, 0xbd,
+  0xae, 0x1d, 0x83, 0x3c, 0xa7, 0xa5, 0x30, 0xbe, 0x02, 0x0f, 0xed, 0x3a,
+  0x6e, 0x4a, 0xb5, 0xbd, 0x4e, 0xa3, 0xe1, 0x3d, 0xce, 0x66, 0x28, 0xbe,
+  0xd3, 0xf4, 0xb8, 0xbc, 0xe8, 0x92, 0x99, 0xbd, 0xa2, 0x22, 0x62, 0x3a,
+  0x6e, 0x7e, 0xcc, 0xbd, 0x26, 0xdb, 0x61, 0xbc, 0x44, 0x5a, 0xa0, 0xbc,
+  0xd2, 0xd5, 0x07, 0x3d, 0x3a, 0xcc, 0xf2, 0xbd, 0x3e, 0xce, 0xb1, 0xbd,
+  0x87, 0xf3, 0x37, 0xbd, 0x9b, 0xf3, 0x56, 0x3b, 0xf1, 0xce, 0x28, 0xbd,
+  0x42, 0xf0, 0x4a, 0x3d, 0xfe, 0x89, 0x5a, 0xbd, 0xa8, 0x17, 0xbe, 0x3d,
+  0x28, 0xbc, 0x12, 0xbd, 0xa2, 0x81, 0xa5, 0xbc, 0xca, 0x26, 0xce, 0xbd,
+  0x94, 0x22, 0x0c, 0xbd, 0x9a, 0x00, 0xea, 0xbb, 0x30, 0x33, 0x01, 0xbe,
+  0x18, 0x0f, 0x0b, 0xbe, 0xe8, 0xc2, 0xe8, 0x3d, 0x11, 0xb4, 0x0c, 0xbd,
+  0xa3, 0x75, 0xfe, 0xbd, 0x43, 0xb4, 0x25, 0x3d, 0x3b, 0x4a, 0x11, 0xbe,
+  0xb9, 0xdc, 0xc1, 0x3d, 0x92, 0xa0, 0x2b, 0xbc, 0x52, 0x05, 0xb1, 0xbd,
+  0x92, 0x33, 0xb3, 0x3c, 0x16, 0x8a, 0xcb, 0xbd, 0x90, 0x11, 0x9c, 0xbd,
+  0xa5, 0x2a, 0x2a, 0xbe, 0x24, 0x9b, 0x25, 0xbe, 0xeb, 0x6d, 0xdb, 0xbb,
+  0x25, 0xdb, 0x84, 0xbd, 0xc8, 0x6b, 0xaf, 0xbd, 0xfa, 0x25, 0x08, 0x3e,
+  0x91, 0x81, 0xc7, 0xbd, 0xc6, 0x8d, 0x47, 0xbc, 0xe9, 0x98, 0xb7, 0xbd,
+  0x72, 0x55, 0xb1, 0xbd, 0x21, 0x56, 0x98, 0x3c, 0x2f, 0xfd, 0x39, 0xbc,
+  0x85, 0xa8, 0xc0, 0xbd, 0xa8, 0xf4, 0xb4, 0xbc, 0x4e, 0xba, 0x98, 0xbd,
+  0x0a, 0xfb, 0xad, 0xbc, 0x1a, 0x89, 0x5f, 0x3d, 0xd8, 0x40, 0x40, 0x3d,
+  0x33, 0xcc, 0xc8, 0x3d, 0x37, 0xf1, 0x67, 0x3c, 0x83, 0x43, 0xf6, 0x3c,
+  0x54, 0xab, 0x37, 0xbe, 0x94, 0xf3, 0x80, 0xbd, 0x38, 0xb9, 0x86, 0x3c,
+  0x09, 0x5b, 0x5e, 0x3d, 0xb6, 0xb0, 0x07, 0x3d, 0x9e, 0x8a, 0xb4, 0x3d,
+  0x19, 0x7a, 0x1d, 0xbd, 0xe8, 0x55, 0x80, 0xbd, 0x17, 0xa3, 0x82, 0xbd,
+  0x69, 0xa3, 0x14, 0x3d, 0xb7, 0xc5, 0x45, 0x3d, 0x6b, 0x7d, 0x99, 0x3d,
+  0xdf, 0x88, 0x00, 0x3e, 0xd5, 0x40, 0x76, 0x3d, 0x00, 0x4f, 0x21, 0x3d,
+  0x25, 0x2a, 0xcb, 0x3d, 0x62, 0x94, 0xc5, 0x3d, 0x25, 0xe6, 0xdb, 0x3d,
+  0x00, 0x3f, 0x39, 0x3d, 0xd0, 0xaa, 0x69, 0xbc, 0xd5, 0x5f, 0x1c, 0x3e,
+  0x4e, 0x55, 0x36, 0x3e, 0x8a, 0xda, 0xb7, 0x3d, 0x4e, 0x41, 0x14, 0x3c,
+  0x43, 0xbd, 0x9e, 0x3e, 0x32, 0x8a, 0x04, 0x3e, 0x21, 0xaf, 0xcc, 0x3d,
+  0x79, 0xc9, 0xe9, 0x3c, 0xc4, 0x93, 0x09, 0x3d, 0xaf, 0xd8, 0x18, 0x3d,
+  0x08, 0xb1, 0x33, 0xbb, 0xad, 0x54, 0xdb, 0x3d, 0xcf, 0x4e, 0x9c, 0x3e,
+  0x14, 0x95, 0x9e, 0xbc, 0x1d, 0x61, 0x86, 0x3c, 0x62, 0xf0, 0xad, 0xbd,
+  0x83, 0x86, 0xb0, 0x3d, 0xc8, 0xf3, 0x30, 0x3d, 0x6e, 0xfc, 0xc4, 0x3c,
+  0xfe, 0x27, 0x8a, 0x3c, 0x64, 0x23, 0x39, 0x3e, 0x34, 0x43, 0xf5, 0xbd,
+  0x74, 0x1f, 0xae, 0xbd, 0x01, 0xe9, 0x81, 0xbd, 0x98, 0xb9, 0x2d, 0x3c,
+  0xe8, 0xee, 0xa0, 0x3d, 0x62, 0xf0, 0xa0, 0xbd, 0xbc, 0x26, 0xbb, 0xbd,
+  0x56, 0x2d, 0xa5, 0x3d, 0x5a, 0x37, 0x04, 0xbe, 0x8f, 0xb9, 0xc3, 0xbd,
+  0xa3, 0xb7, 0x95, 0xbd, 0x7e, 0xe7, 0xa0, 0xbd, 0xa4, 0x1d, 0x70, 0xbd,
+  0xce, 0x5b, 0xc0, 0xbc, 0x9e, 0x70, 0x21, 0xbe, 0xd3, 0xa9, 0x8d, 0x3d,
+  0xd6, 0x7d, 0x14, 0xbe, 0xa8, 0xe1, 0x55, 0xbd, 0x94, 0x6d, 0x0a, 0xbe,
+  0xf5, 0xd9, 0xa9, 0xbd, 0x10, 0x48, 0x8f, 0x3d, 0x43, 0xcb, 0xfb, 0xbd,
+  0x90, 0x6d, 0x1f, 0xbe, 0x72, 0x30, 0x88, 0x3d, 0xd8, 0x8f, 0x3e, 0xbe,
+  0x88, 0xe8, 0x09, 0xbe, 0x56, 0xd6, 0x9f, 0xbd, 0xcd, 0x23, 0xf7, 0xbd,
+  0x4b, 0x3c, 0xb9, 0x3d, 0x9a, 0x51, 0xb3, 0xbd, 0xfc, 0x58, 0x0f, 0xbe,
+  0xae, 0x3c, 0x15, 0x3d, 0x6e, 0x04, 0x02, 0xbe, 0x80, 0xae, 0x06, 0xbb,
+  0xe4, 0x06, 0x2f, 0xbd, 0xeb, 0x57, 0xfd, 0xbd, 0xb9, 0x61, 0xef, 0x3d,
+  0x0d, 0xad, 0x8e, 0xbd, 0x02, 0xb6, 0x13, 0xbe, 0xdb, 0x5d, 0xf2, 0x3d,
+  0x68, 0x38, 0xc0, 0xbb, 0x12, 0x2e, 0xc5, 0xbd, 0xe2, 0x63, 0xa9, 0xbc,
+  0xd7, 0x7c, 0xd3, 0xbc, 0x44, 0x44, 0xdc, 0xbb, 0x12, 0x27, 0xc2, 0xbd,
+  0x0b, 0x3d, 0x7c, 0xbc, 0x8c, 0xd8, 0x74, 0x3d, 0x60, 0x09, 0x67, 0x3c,
+  0xb4, 0x29, 0x13, 0xbd, 0xf1, 0x17, 0xe2, 0xbd, 0xd1, 0x4e, 0x99, 0xbc,
+  0x74, 0xc3, 0x82, 0x3c, 0xb3, 0x2b, 0xf4, 0xbd, 0x36, 0x45, 0xd9, 0xbd,
+  0x3e, 0x3c, 0x92, 0x3d, 0x30, 0x45, 0x2e, 0xbe, 0xd1, 0xc5, 0xde, 0xbd,
+  0x8b, 0x99, 0xc9, 0xbd, 0xc4, 0x92, 0xee, 0xbd, 0x95, 0x65, 0x1a, 0xbd,
+  0xac, 0x16, 0x3e, 0xbd, 0x58, 0xb7, 0xfb, 0xbd, 0x09, 0x80, 0x7b, 0xbc,
+  0x4e, 0xa7, 0x75, 0xbe, 0x70, 0xea, 0x8c, 0xbd, 0xb4, 0xc1, 0xfc, 0xbd,
+  0x88, 0xe0, 0xc1, 0xbd, 0xc8, 0x62, 0x92, 0xbd, 0xe1, 0x05, 0x08, 0xbe,
+  0x8b, 0x89, 0x16, 0xbe, 0x9e, 0x1a, 0xac, 0x3d, 0x14, 0x9e, 0xa6, 0xbe,
+  0x11, 0x16, 0xb9, 0xbd, 0x23, 0x16, 0x7d, 0xbe, 0xf1, 0xc0, 0xcb, 0xbd,
+  0x7b, 0x90, 0x23, 0x3d, 0xba, 0x57, 0x5b, 0xbe, 0x33, 0xde, 0x8d, 0xbe,
+  0xaa, 0xa7, 0x44, 0x3d, 0xe4, 0xcc, 0xa9, 0xbe, 0xa3, 0xec, 0x06, 0xbe,
+  0x38, 0x04, 0x5a, 0xbe, 0xa0, 0xb1, 0x0a, 0xbe, 0xc3, 0x45, 0x9d, 0x3d,
+  0x8a, 0x11, 0xdf, 0xbd, 0x1d, 0x4f, 0x72, 0xbe, 0x63, 0x0b, 0xb1, 0x3d,
+  0x8d, 0x75, 0x98, 0xbe, 0x79, 0x3b, 0xf4, 0xbc, 0x48, 0x53, 0x34, 0xbe,
+  0x7c, 0x4a, 0x00, 0xbe, 0x7a, 0xec, 0x41, 0x3d, 0xd8, 0xfb, 0x2e, 0xbe,
+  0x3f, 0xf0, 0x84, 0xbe, 0xba, 0x9d, 0x07, 0x3e, 0x85, 0x54, 0xac, 0xbe,
+  0x43, 0xa4, 0xf5, 0xbd, 0x81, 0x74, 0x91, 0xbe, 0xd5, 0xf8, 0x07, 0xbe,
+  0xbe, 0x49, 0x84, 0xbc, 0x2c, 0x0e, 0x83, 0xbe, 0xcd, 0x94, 0x76, 0xbe,
+  0x31, 0x57, 0x0a, 0x3e, 0xe8, 0x69, 0x99, 0xbe, 0x94, 0xf1, 0x4f, 0xbd,
+  0x16, 0x19, 0x60, 0xbe, 0x31, 0x54, 0xb6, 0xbd, 0x72, 0xd1, 0x4b, 0xbd,
+  0xa4, 0x62, 0x36, 0xbe, 0xee, 0x8b, 0x5f, 0xbe, 0xe4, 0xdc, 0xc5, 0x3d,
+  0x81, 0xd1, 0x80, 0xbe, 0x62, 0x8b, 0x53, 0xbe, 0x15, 0xe8, 0x50, 0xbe,
+  0x09, 0xb5, 0x8a, 0xbe, 0x37, 0x2a, 0xa4, 0xbd, 0x0f, 0xd6, 0xa6, 0xbe,
+  0x3c, 0xb0, 0xa1, 0xbe, 0xb3, 0x49, 0x9a, 0x3d, 0xc0, 0xca, 0x5a, 0xbe,
+  0xd2, 0x49, 0x4f, 0xbe, 0x1d, 0x28, 0x2d, 0xbe, 0xe0, 0x6a, 0x6a, 0xbe,
+  0x7d, 0x43, 0x3d, 0x3d, 0x07, 0xd2, 0xf7, 0xbd, 0xe6, 0x64, 0x4c, 0xbe,
+  0x19, 0xc7, 0xad, 0x3d, 0x60, 0xdb, 0xf7, 0xbd, 0x96, 0x51, 0x61, 0xbe,
+  0xb5, 0x23, 0x26, 0xbe, 0x67, 0x8f, 0x5b, 0xbe, 0x07, 0x38, 0x9b, 0x3d,
+  0xfd, 0xe1, 0x1f, 0xbe, 0x11, 0x1d, 0x7b, 0xbe, 0x74, 0x43, 0x4c, 0x3d,
+  0xc9, 0xa4, 0x9e, 0xbc, 0x11, 0xe9, 0xed, 0xbc, 0x48, 0x72, 0x95, 0xbd,
+  0x17, 0xcf, 0x2c, 0xbd, 0x27, 0x79, 0x98, 0x3d, 0xcd, 0xc4, 0x6d, 0x3d,
+  0xe6, 0x10, 0xce, 0xbd, 0xde, 0xcd, 0x1f, 0x3e, 0x2b, 0xe4, 0xef, 0x3d,
+  0x33, 0xfe, 0xe5, 0x3d, 0x3b, 0x28, 0x40, 0x3d, 0x89, 0xd8, 0x2a, 0x3e,
+  0xe7, 0xbd, 0x81, 0x3e, 0x07, 0xf1, 0x01, 0x3e, 0xa7, 0x63, 0xd2, 0x3d,
+  0x1f, 0x5f, 0x31, 0x3e, 0x1a, 0x00, 0xf8, 0x3c, 0xe4, 0x82, 0x84, 0x3d,
+  0x83, 0x9f, 0x6c, 0x3a, 0xf8, 0xcd, 0x21, 0x3d, 0xd9, 0x8c, 0x90, 0x3e,
+  0xe4, 0x6e, 0x19, 0x3e, 0x65, 0x16, 0x86, 0x3d, 0x97, 0xc8, 0x7f, 0x3e,
+  0x08, 0x78, 0x0a, 0xbe, 0x2c, 0x49, 0x2f, 0x3d, 0xae, 0x14, 0x6d, 0xbd,
+  0xb5, 0x03, 0x55, 0x3d, 0xd4, 0xd9, 0x49, 0x3e, 0xf8, 0x5f, 0x74, 0x3d,
+  0xcd, 0x2f, 0x96, 0x3d, 0xcd, 0x15, 0xca, 0x3d, 0xa1, 0x3a, 0x43, 0xbe,
+  0x78, 0x91, 0x93, 0xbd, 0xfa, 0x68, 0xfe, 0xbd, 0x7a, 0x52, 0x8a, 0x3d,
+  0x8b, 0x0b, 0x86, 0x3e, 0x48, 0x5b, 0x9e, 0xbd, 0xb9, 0xf6, 0x23, 0xbe,
+  0x8e, 0xbf, 0x74, 0xbc, 0x44, 0x6c, 0x1e, 0xbe, 0xa8, 0x0a, 0xef, 0xbd,
+  0x6d, 0x14, 0x26, 0xbe, 0x31, 0xc8, 0x09, 0x3d, 0xa9, 0x6a, 0x3c, 0x3e,
+  0xcd, 0x9d, 0x91, 0xbd, 0x76, 0xe0, 0x0d, 0xbe, 0x8f, 0x6e, 0xbf, 0xbd,
+  0xab, 0x4f, 0xa0, 0xbd, 0xa7, 0x9e, 0x89, 0xbd, 0xd7, 0xec, 0xdd, 0xbd,
+  0x58, 0x06, 0xa9, 0x3d, 0x8e, 0x16, 0x44, 0x3e, 0x6e, 0xe6, 0x9c, 0xbd,
+  0xb0, 0xe4, 0x83, 0xbc, 0xa5, 0xdd, 0x38, 0xbd, 0x8a, 0xfc, 0x0d, 0x3d,
+  0x83, 0xf6, 0x9d, 0x3d, 0xa3, 0xf5, 0x1a, 0x3b, 0xe5, 0xd7, 0x75, 0x3d,
+  0xe4, 0x05, 0x35, 0x3e, 0x83, 0xad, 0xbe, 0x3d, 0xe4, 0xf9, 0x74, 0x3d,
+  0x29, 0xe6, 0x26, 0x3c, 0x5a, 0x2c, 0xc9, 0xbb, 0xb3, 0x46, 0x77, 0xbd,
+  0xdd, 0x99, 0xc9, 0x3c, 0x93, 0xfc, 0x2c, 0x3d, 0x84, 0xfe, 0x4f, 0x3e,
+  0xd0, 0xc7, 0x12, 0x3e, 0x9b, 0xe7, 0xfa, 0x3d, 0x91, 0x85, 0xdd, 0xbd,
+  0xf2, 0xaf, 0xe0, 0xbd, 0x51, 0x44, 0x9f, 0xbd, 0x24, 0x24, 0x52, 0xbc,
+  0xa5, 0xff, 0x8e, 0x3d, 0x5b, 0x95, 0x79, 0x3e, 0x96, 0x85, 0xb0, 0x3d,
+  0x32, 0x83, 0x8d, 0xbd, 0x2f, 0xec, 0x29, 0xbd, 0xee, 0xb6, 0x1e, 0xbe,
+  0x50, 0x1b, 0xb7, 0xbd, 0xbb, 0x6a, 0x9e, 0xbd, 0x49, 0x8f, 0x76, 0x3c,
+  0xca, 0xdc, 0x7e, 0x3e, 0xc0, 0x6b, 0xf7, 0xbd, 0x5f, 0x5f, 0x3f, 0xbc,
+  0xb0, 0x44, 0xb9, 0xbc, 0xfc, 0xf5, 0x9d, 0xbd, 0x8a, 0xb3, 0x05, 0xbe,
+  0xd7, 0x8a, 0x09, 0xbe, 0x4e, 0x5f, 0xe0, 0xbc, 0xbf, 0xac, 0x88, 0x3e,
+  0x17, 0x17, 0x14, 0xbe, 0x1b, 0x4f, 0xd6, 0xbd, 0x01, 0x44, 0x3a, 0x3e,
+  0x28, 0xe3, 0xcf, 0xbd, 0x80, 0x8c, 0xcb, 0xbd, 0x40, 0xbb, 0xce, 0xbd,
+  0x97, 0xc7, 0x2e, 0xbd, 0xee, 0xa7, 0x3a, 0x3e, 0x08, 0x0b, 0x32, 0xbd,
+  0x00, 0x04, 0x99, 0xbd, 0xc4, 0x4c, 0x7a, 0x3e, 0x6f, 0xca, 0x90, 0xbc,
+  0x9e, 0x22, 0x1c, 0xbe, 0x97, 0xd9, 0xb2, 0xbd, 0x61, 0xdc, 0xd1, 0x3d,
+  0x1f, 0x0b, 0x4b, 0x3e, 0xf1, 0xf6, 0x65, 0x3d, 0x58, 0xde, 0xd8, 0xbc,
+  0xb4, 0x83, 0x26, 0x3e, 0x27, 0x02, 0x09, 0x3e, 0x8e, 0x75, 0xbd, 0x3d,
+  0xb7, 0x9c, 0xcf, 0x3d, 0x9a, 0xe8, 0x0e, 0x3e, 0x08, 0x2a, 0x7f, 0x3e,
+  0xce, 0xbe, 0x0b, 0x3e, 0xbe, 0x22, 0xea, 0x3d, 0xbb, 0xe6, 0x64, 0x3e,
+  0x19, 0x0d, 0xe2, 0x3d, 0x7e, 0x7b, 0x0d, 0x3d, 0x56, 0xe7, 0x4e, 0x3d,
+  0xcf, 0x47, 0xcf, 0x3d, 0x0a, 0x91, 0x36, 0x3e, 0x18, 0x0a, 0x9b, 0x3d,
+  0x40, 0x51, 0xec, 0x3d, 0xfd, 0xeb, 0x32, 0x3e, 0x5e, 0xec, 0x27, 0xbd,
+  0xd8, 0x1a, 0x4c, 0x3d, 0xb5, 0xdc, 0xfe, 0xbc, 0x8b, 0xf1, 0x4c, 0x3b,
+  0xcb, 0x4f, 0x71, 0x3e, 0x3e, 0xd1, 0x9e, 0xbd, 0xb0, 0x28, 0x9c, 0xba,
+  0x7a, 0x49, 0xa0, 0xbc, 0x7c, 0x1b, 0x31, 0xbd, 0xc6, 0x55, 0x82, 0xbc,
+  0xd2, 0x3a, 0xa1, 0xbd, 0x28, 0x7c, 0x91, 0xbd, 0x73, 0x6b, 0x20, 0x3e,
+  0xb7, 0x9d, 0x5c, 0xbd, 0xed, 0xba, 0xd6, 0xbd, 0x9f, 0x50, 0xbf, 0xbc,
+  0x52, 0x84, 0x7f, 0xbd, 0x21, 0xce, 0xec, 0xbd, 0xfd, 0xb5, 0xa6, 0xbd,
+  0x9c, 0xe4, 0x23, 0xbe, 0xba, 0xf9, 0x0f, 0x3e, 0xda, 0x36, 0x3e, 0xbe,
+  0xf6, 0xfb, 0xe5, 0x3b, 0x9d, 0xd0, 0x1e, 0xbd, 0x9e, 0x7a, 0xae, 0x3c,
+  0x81, 0x2e, 0x04, 0xbe, 0xf0, 0xb9, 0xd3, 0xbd, 0x91, 0x2e, 0x46, 0xbe,
+  0xf4, 0x3c, 0x96, 0x3d, 0x89, 0x04, 0x89, 0xbd, 0xa6, 0xd0, 0xb8, 0x3c,
+  0x1d, 0x97, 0x22, 0x3d, 0xf9, 0x06, 0x46, 0x3d, 0x67, 0x28, 0xaa, 0x3d,
+  0x9a, 0x21, 0xc9, 0x3c, 0x71, 0x63, 0x79, 0xbe, 0xa8, 0x1f, 0xb5, 0x3c,
+  0x99, 0x31, 0x43, 0x3d, 0xa1, 0x8c, 0x8c, 0x3d, 0x4c, 0xa9, 0x92, 0xbd,
+  0x9a, 0xaa, 0x7f, 0xbd, 0x2f, 0x34, 0x1b, 0x3d, 0xbe, 0xb8, 0x8d, 0x3d,
+  0x73, 0xc1, 0xa2, 0xbd, 0x96, 0x64, 0x2d, 0x3e, 0xae, 0x5a, 0x3e, 0x3c,
+  0x66, 0xc8, 0x8d, 0x3d, 0xb6, 0xe8, 0x4f, 0x3d, 0x3c, 0x44, 0x5d, 0x3b,
+  0x3b, 0x83, 0xd9, 0x3c, 0x19, 0xc6, 0xb6, 0xbc, 0x48, 0xaa, 0xee, 0xbc,
+  0x17, 0x05, 0x62, 0x3e, 0x33, 0xf9, 0x6e, 0xbd, 0x48, 0x56, 0x27, 0x3c,
+  0x0a, 0x5d, 0x10, 0x3e, 0xbf, 0x08, 0x89, 0x3d, 0xa7, 0xcf, 0xad, 0xbd,
+  0xf5, 0x82, 0x7c, 0x3d, 0x83, 0xff, 0x9c, 0xbd, 0x16, 0x80, 0x41, 0x3e,
+  0xac, 0xb2, 0x50, 0x3d, 0xda, 0x01, 0x7e, 0x3d, 0xa4, 0x01, 0x75, 0x3d,
+  0xbb, 0x73, 0x9b, 0x3c, 0xd4, 0xb6, 0x17, 0xbd, 0xae, 0x4d, 0x97, 0x3c,
+  0x05, 0xcd, 0x8f, 0xbd, 0xd1, 0xc4, 0x51, 0x3e, 0x31, 0x08, 0xb0, 0x3c,
+  0x7b, 0xcf, 0x1c, 0xbd, 0x56, 0x62, 0x48, 0xbc, 0x00, 0x35, 0x70, 0xbb,
+  0x53, 0x80, 0x05, 0xbe, 0x19, 0xd4, 0x07, 0xbd, 0xb2, 0x26, 0x37, 0xbd,
+  0x27, 0xa6, 0x48, 0x3e, 0x10, 0xad, 0x45, 0xbd, 0x67, 0x1f, 0xa1, 0xbc,
+  0x23, 0x43, 0xb7, 0x3c, 0xe4, 0x87, 0x4b, 0xbe, 0x23, 0x7f, 0x0f, 0xbe,
+  0xca, 0xde, 0x6b, 0xbd, 0x49, 0x50, 0x15, 0xbe, 0x4b, 0xab, 0x44, 0x3e,
+  0xa3, 0x2b, 0xc0, 0xbd, 0x12, 0x86, 0x44, 0xbe, 0xf4, 0x32, 0x74, 0x3e,
+  0xb2, 0xaf, 0x8e, 0xbd, 0x98, 0x94, 0xcf, 0x3b, 0x95, 0x48, 0x85, 0xbc,
+  0xce, 0x9e, 0x13, 0x3e, 0xa9, 0xa2, 0x27, 0x3e, 0x9a, 0x9d, 0x86, 0x3d,
+  0xc0, 0xa2, 0xeb, 0x3c, 0x33, 0x18, 0x22, 0x3e, 0xa3, 0xd0, 0x50, 0x3d,
+  0xdb, 0xcd, 0xe6, 0x3d, 0xd9, 0xe5, 0xea, 0x3d, 0xcc, 0x47, 0x89, 0x3d,
+  0x40, 0x3f, 0x3d, 0x3e, 0xb7, 0x2a, 0xac, 0x3d, 0xe9, 0x9c, 0xe4, 0x3d,
+  0x30, 0x09, 0x44, 0x3c, 0x86, 0x84, 0x97, 0xbc, 0x34, 0x54, 0xf5, 0xbc,
+  0x38, 0xb3, 0xca, 0xbd, 0xb0, 0x10, 0xd7, 0xbc, 0xa6, 0xc9, 0x81, 0x3e,
+  0x51, 0x09, 0x33, 0xbd, 0x28, 0xea, 0xde, 0xbd, 0xc0, 0xc6, 0x73, 0xbd,
+  0x4d, 0xf6, 0xf3, 0xbd, 0xc3, 0x42, 0xdf, 0xbd, 0x34, 0xf8, 0x08, 0xbe,
+  0x18, 0x43, 0x03, 0xbe, 0xcb, 0x1c, 0x32, 0x3e, 0xa5, 0xad, 0x26, 0xbe,
+  0x62, 0x44, 0x0c, 0xbe, 0xf9, 0x19, 0xd8, 0xbd, 0xa3, 0x97, 0xc0, 0xbd,
+  0x74, 0xe8, 0x0c, 0xbe, 0xfa, 0xfe, 0x3b, 0xbd, 0xa7, 0x9a, 0x4e, 0xbe,
+  0xdb, 0xd4, 0xb8, 0xbd, 0x7a, 0xa1, 0x66, 0xbd, 0x24, 0x5c, 0x40, 0xbd,
+  0x89, 0xdc, 0x55, 0xbe, 0xd9, 0xa8, 0x25, 0xbc, 0x4f, 0xd9, 0x90, 0xbd,
+  0x7c, 0xc7, 0xa6, 0xbd, 0x45, 0x09, 0x47, 0xbe, 0x54, 0x29, 0x56, 0xbe,
+  0xa8, 0x54, 0xdb, 0xbd, 0x34, 0xb2, 0x8b, 0xbd, 0x99, 0xcb, 0x92, 0xbe,
+  0x28, 0x3c, 0xbf, 0xbd, 0xff, 0xae, 0x51, 0x3c, 0xe5, 0x36, 0xb4, 0xbc,
+  0x25, 0xf4, 0x54, 0xbe, 0x6d, 0xec, 0xa3, 0xbe, 0x85, 0x33, 0x0a, 0xbc,
+  0x8a, 0x66, 0x10, 0x3c, 0x5a, 0x4f, 0x92, 0xbe, 0xc3, 0x23, 0x02, 0xbe,
+  0x53, 0xff, 0x77, 0xbc, 0x86, 0xfb, 0x86, 0x3c, 0x40, 0xdc, 0x77, 0xbe,
+  0xd7, 0xc7, 0x7f, 0xbe, 0x91, 0xbc, 0xc2, 0xbc, 0x40, 0x98, 0x80, 0xbd,
+  0x6b, 0x79, 0x1f, 0xbe, 0xba, 0xd4, 0x08, 0xbe, 0xb8, 0x89, 0x61, 0x3c,
+  0x46, 0x7b, 0x51, 0x3b, 0x1e, 0xab, 0x51, 0xbe, 0xa8, 0x6f, 0x07, 0xbe,
+  0x3c, 0xa2, 0x63, 0xbd, 0x80, 0x42, 0xed, 0xbd, 0x89, 0x72, 0x04, 0xbe,
+  0x76, 0xb5, 0xed, 0xbc, 0xc9, 0x97, 0x77, 0x3d, 0x6a, 0xeb, 0x98, 0x3d,
+  0xa2, 0x0c, 0x30, 0xbd, 0x96, 0xb9, 0xc8, 0xbd, 0x5f, 0xb7, 0x80, 0x3d,
+  0xbd, 0x04, 0x13, 0x3b, 0x98, 0xe2, 0x40, 0xbc, 0xd6, 0xb1, 0x53, 0xbc,
+  0xfa, 0x8d, 0xb6, 0x3d, 0x86, 0x7c, 0x1d, 0x3d, 0x5e, 0x7c, 0x07, 0x3d,
+  0x90, 0xf4, 0xf1, 0x3c, 0xd4, 0x09, 0x92, 0xbc, 0xa6, 0x7e, 0x8a, 0x3c,
+  0xc1, 0xfe, 0x2f, 0x3d, 0xa6, 0xfd, 0x30, 0xbd, 0x0e, 0xd8, 0xdd, 0x3b,
+  0x11, 0x5b, 0xc1, 0xbd, 0x69, 0x1e, 0xca, 0xbc, 0xc0, 0x09, 0x08, 0x3e,
+  0x8b, 0xa3, 0x3c, 0x3b, 0x35, 0x74, 0x03, 0xbe, 0x0e, 0xd0, 0xc9, 0x3d,
+  0xef, 0xc9, 0x08, 0xbe, 0x08, 0x06, 0xd1, 0xbd, 0x14, 0xaf, 0x4c, 0xbe,
+  0x02, 0x9b, 0xb7, 0xbd, 0xa8, 0x90, 0x62, 0x3e, 0xb0, 0xd1, 0x12, 0xbe,
+  0xd6, 0x6e, 0x13, 0xbe, 0xfb, 0x8c, 0x7a, 0x3e, 0xb0, 0x70, 0x0d, 0xbe,
+  0xd2, 0xdc, 0x08, 0x3d, 0xd0, 0x05, 0x8c, 0xbd, 0x3f, 0x3c, 0x49, 0xbc,
+  0x40, 0xe9, 0x4f, 0x3e, 0x48, 0x35, 0x23, 0xbd, 0x7a, 0x65, 0xab, 0x3c,
+  0x24, 0x0f, 0x03, 0x3e, 0xa4, 0xdc, 0x8e, 0xbd, 0x6e, 0xdd, 0xe9, 0x3c,
+  0x7b, 0x7e, 0x2a, 0x3d, 0x9e, 0x9c, 0x7f, 0x3d, 0xa8, 0xbf, 0x48, 0x3e,
+  0x4a, 0x6c, 0xff, 0x3c, 0xdd, 0x2d, 0xd2, 0xbc, 0x5e, 0xd9, 0xba, 0x3d,
+  0xfc, 0x38, 0x37, 0xbd, 0xe7, 0x8f, 0x71, 0xbc, 0x33, 0xe7, 0x81, 0xbd,
+  0x65, 0xea, 0x67, 0xbd, 0xb8, 0x53, 0x35, 0x3e, 0x32, 0xaa, 0xee, 0xbd,
+  0x2c, 0x8f, 0x4a, 0xbd, 0x22, 0x19, 0x48, 0xbd, 0x72, 0x7e, 0xcf, 0xbd,
+  0x4e, 0x6f, 0xdc, 0xbd, 0xa2, 0x2c, 0xa7, 0xbd, 0x01, 0x23, 0x58, 0xbe,
+  0x97, 0x10, 0x83, 0x3d, 0xcb, 0xd1, 0xb8, 0xbd, 0xf2, 0x47, 0x18, 0xbe,
+  0x78, 0x73, 0x1c, 0xbe, 0x99, 0x3c, 0xd1, 0xbd, 0x77, 0xa3, 0x5e, 0xbd,
+  0xea, 0xd5, 0x4e, 0xbd, 0xe7, 0x51, 0xc8, 0xbd, 0xbf, 0xb2, 0x96, 0x3d,
+  0x9f, 0x3c, 0xd5, 0xbd, 0x83, 0xff, 0x74, 0xbd, 0xec, 0x51, 0xb3, 0xbe,
+  0x99, 0x99, 0x37, 0xbd, 0x7e, 0xa9, 0xe9, 0xbd, 0xfe, 0x7d, 0x82, 0xbc,
+  0x31, 0xc9, 0x48, 0xbe, 0x3a, 0xc4, 0x5d, 0xbe, 0xe5, 0x40, 0xba, 0xbd,
+  0xa7, 0xd9, 0xa0, 0xbd, 0xbc, 0x33, 0xbf, 0xbe, 0x73, 0xf1, 0xbf, 0x3b,
+  0x88, 0xd2, 0x24, 0xbc, 0xcc, 0x75, 0xf1, 0xbc, 0x23, 0x63, 0x77, 0xbe,
+  0x3c, 0x40, 0xd9, 0xbe, 0x77, 0x69, 0x46, 0xbc, 0x9d, 0x3d, 0x90, 0xbc,
+  0x3e, 0x01, 0x27, 0xbe, 0x09, 0x84, 0x85, 0xbd, 0x08, 0xa3, 0xb7, 0x3c,
+  0xf8, 0xb5, 0x3d, 0xbd, 0x87, 0x51, 0xa5, 0xbe, 0x1d, 0x78, 0x08, 0xbf,
+  0x43, 0x06, 0x44, 0xbd, 0x9c, 0x38, 0xce, 0xbd, 0xb5, 0xa8, 0x33, 0xbe,
+  0x6e, 0x80, 0x33, 0xbe, 0xb9, 0xa4, 0x8a, 0xbd, 0xe9, 0x74, 0xeb, 0xbc,
+  0x4b, 0x5a, 0x40, 0xbe, 0x0d, 0xab, 0xb9, 0xbe, 0xe5, 0xa4, 0x34, 0xbc,
+  0x9d, 0xf1, 0x89, 0xbd, 0xe8, 0x60, 0x05, 0xbe, 0x8a, 0x9b, 0xa0, 0xbd,
+  0x0c, 0x1b, 0xee, 0x3c, 0x12, 0x27, 0xd7, 0xba, 0x00, 0xfd, 0xe0, 0xbd,
+  0xf3, 0xe1, 0x3f, 0xbe, 0x12, 0xde, 0x16, 0xbc, 0x2e, 0xb2, 0x97, 0xbc,
+  0xfa, 0x4f, 0x34, 0xbe, 0x8e, 0x82, 0xef, 0xbb, 0x80, 0xf2, 0x80, 0xbd,
+  0xe6, 0x92, 0x2f, 0xbd, 0x76, 0xb4, 0xae, 0xbd, 0x79, 0x78, 0xef, 0xbc,
+  0xb0, 0x38, 0x22, 0xbd, 0x39, 0x79, 0x82, 0xbd, 0x2d, 0x05, 0x07, 0xbe,
+  0x56, 0x50, 0x03, 0xbe, 0x99, 0xc5, 0x45, 0xbd, 0xa1, 0xce, 0x2c, 0xbe,
+  0xde, 0xa3, 0x0a, 0xbe, 0xed, 0xf8, 0x8f, 0x3c, 0x21, 0xf1, 0x07, 0xbe,
+  0x5c, 0x95, 0x18, 0xbe, 0xeb, 0x28, 0x59, 0x3d, 0xe5, 0x48, 0x9f, 0xbe,
+  0xa8, 0x8c, 0x59, 0xbe, 0x5a, 0x9a, 0x9a, 0xbe, 0x83, 0xa0, 0x8d, 0xbe,
+  0x33, 0x13, 0x22, 0x3e, 0x95, 0x50, 0xb4, 0xbe, 0xde, 0x4c, 0x77, 0xbe,
+  0x4a, 0x1c, 0x54, 0x3e, 0x7e, 0x7e, 0xa2, 0x3c, 0xad, 0xad, 0x1a, 0xbd,
+  0xd8, 0x6a, 0x8e, 0xbd, 0xad, 0xfc, 0x97, 0x3b, 0xb7, 0xe9, 0x32, 0x3e,
+  0xa4, 0xe2, 0xf9, 0xbd, 0xbc, 0xc6, 0x69, 0xbd, 0x54, 0xc4, 0xc7, 0x3d,
+  0x86, 0x9d, 0x28, 0xbe, 0x87, 0xdb, 0x05, 0xbe, 0xaa, 0xba, 0xec, 0xbd,
+  0xa0, 0x64, 0x26, 0xbe, 0xff, 0x0b, 0x57, 0x3e, 0x45, 0x01, 0x36, 0xbe,
+  0x20, 0x5c, 0x29, 0xbe, 0xdc, 0x17, 0x21, 0xbd, 0xbd, 0xb3, 0x7a, 0xbd,
+  0x3d, 0x57, 0xf2, 0xbd, 0x04, 0x57, 0x6f, 0xbd, 0x25, 0x38, 0xe5, 0xba,
+  0x2f, 0x4b, 0x3d, 0x3e, 0xcd, 0x44, 0x2e, 0xbd, 0xb8, 0xb9, 0xf0, 0xbd,
+  0xb1, 0x5f, 0x8e, 0xbb, 0xba, 0xfd, 0xde, 0xbd, 0x88, 0xf6, 0xae, 0x3a,
+  0xc7, 0x08, 0xa6, 0xbd, 0x1c, 0xb4, 0xaa, 0x38, 0x3e, 0x9e, 0x17, 0x3e,
+  0xb6, 0xac, 0x31, 0xbd, 0xe3, 0x37, 0xce, 0xbc, 0xc3, 0x19, 0xb1, 0xbc,
+  0x7b, 0xd7, 0xe1, 0xbd, 0x80, 0x16, 0xf3, 0xbd, 0x14, 0x4e, 0xa8, 0xbd,
+  0x53, 0x99, 0x26, 0x3c, 0xad, 0x45, 0x2f, 0x3e, 0xf9, 0x69, 0xd3, 0xbd,
+  0x88, 0xcb, 0x3e, 0x3c, 0xd3, 0x5e, 0x80, 0xbe, 0x08, 0x1e, 0x59, 0x3d,
+  0x57, 0x6f, 0x47, 0xbd, 0xe5, 0x55, 0xd8, 0xbd, 0xc2, 0xf8, 0x60, 0xbd,
+  0xc3, 0x8b, 0xd6, 0xbc, 0xdc, 0xa9, 0xdb, 0x3b, 0x1d, 0x58, 0x48, 0xbd,
+  0x1a, 0xcc, 0xb3, 0xbd, 0x85, 0x5e, 0xf6, 0x3d, 0xd5, 0xff, 0x38, 0x3d,
+  0x79, 0xb1, 0xa4, 0x3d, 0xb6, 0x21, 0xde, 0xbd, 0xac, 0x43, 0x7d, 0xbe,
+  0x51, 0x04, 0x9f, 0x3d, 0x27, 0x3d, 0x24, 0x3e, 0xf4, 0xea, 0x05, 0xbe,
+  0xb0, 0x80, 0x2b, 0x3e, 0x4d, 0x47, 0xe2, 0x3d, 0xa7, 0xa5, 0x2a, 0x3d,
+  0xdb, 0x0e, 0xb9, 0xbd, 0xe6, 0xf9, 0xd3, 0xbe, 0xf5, 0xa4, 0xb5, 0x3d,
+  0x0b, 0xa9, 0x14, 0x3d, 0x25, 0xa8, 0x99, 0xbe, 0xe6, 0x0e, 0x02, 0xbd,
+  0xea, 0x5c, 0xb7, 0xbc, 0x02, 0xbf, 0xe5, 0xbd, 0x74, 0x35, 0xdb, 0xbd,
+  0xff, 0x0e, 0xa1, 0xbe, 0x45, 0xf7, 0x99, 0xbd, 0xd0, 0xd0, 0x00, 0xbe,
+  0xf5, 0x67, 0x92, 0xbe, 0xb5, 0xaf, 0x87, 0xbd, 0x50, 0x72, 0x0f, 0xbc,
+  0xd1, 0x76, 0x9d, 0xbc, 0xa5, 0xb7, 0x2c, 0xbd, 0x18, 0x57, 0xfc, 0xbd,
+  0xdb, 0xa6, 0x08, 0xbe, 0xa0, 0xe6, 0xe4, 0xbd, 0xdc, 0x98, 0x29, 0x3d,
+  0xee, 0xbb, 0xa5, 0xbd, 0xce, 0x76, 0xdf, 0xbd, 0x70, 0xef, 0xe5, 0xbd,
+  0xe3, 0x2d, 0xac, 0xbd, 0x7c, 0xbf, 0x6b, 0x3d, 0x18, 0x26, 0x94, 0xbd,
+  0x70, 0xfc, 0x68, 0xbd, 0xde, 0xf2, 0xde, 0x3d, 0xf1, 0x3b, 0x38, 0xbe,
+  0x7d, 0x24, 0xd9, 0xbd, 0xec, 0x77, 0x12, 0xbe, 0x37, 0x6b, 0x49, 0xbe,
+  0xe0, 0xe9, 0x0c, 0x3e, 0x2b, 0xa4, 0x77, 0xbe, 0x5d, 0x78, 0x20, 0xbe,
+  0xd7, 0xcd, 0x23, 0x3e, 0xc7, 0x83, 0x33, 0xbe, 0xef, 0x88, 0x5b, 0xbe,
+  0x75, 0x1b, 0x41, 0xbe, 0x48, 0x73, 0x89, 0xbe, 0xde, 0x68, 0x54, 0x3e,
+  0xdd, 0x3e, 0x81, 0xbe, 0x7b, 0x4d, 0x6a, 0xbe, 0x05, 0xb2, 0x74, 0x3e,
+  0x69, 0x62, 0x25, 0x3d, 0xa5, 0x76, 0xdd, 0xbd, 0xae, 0x71, 0xfb, 0xbd,
+  0x72, 0x25, 0xd9, 0xbc, 0x8a, 0x53, 0x8c, 0x3e, 0xe6, 0xf1, 0xae, 0x3b,
+  0xb1, 0x6b, 0xcb, 0xbd, 0xe7, 0x8f, 0x32, 0x3e, 0x76, 0xe6, 0x89, 0xbd,
+  0xb7, 0x32, 0x44, 0xbe, 0xa1, 0xd3, 0x04, 0xbe, 0x28, 0x26, 0x6c, 0xbe,
+  0x7f, 0x72, 0x2c, 0x3e, 0x0d, 0x26, 0x32, 0xbe, 0x7d, 0x93, 0x07, 0xbe,
+  0x6e, 0x7a, 0xd3, 0x3d, 0xa7, 0x62, 0xe7, 0xbd, 0xc4, 0x1f, 0x16, 0xbe,
+  0xa1, 0x0f, 0x44, 0xbd, 0x7b, 0x46, 0xee, 0xbd, 0x6f, 0x6a, 0x3e, 0x3e,
+  0x0c, 0x6b, 0x25, 0xbe, 0x50, 0x42, 0x16, 0xbe, 0x25, 0x3b, 0x29, 0x3e,
+  0xd5, 0x31, 0x02, 0xbe, 0xac, 0x2e, 0x84, 0xbc, 0x77, 0x35, 0xcd, 0xbd,
+  0xc9, 0x82, 0xee, 0xbd, 0x8c, 0xc0, 0x96, 0x3d, 0xdb, 0xee, 0x0d, 0xbe,
+  0x6f, 0x14, 0xa8, 0xbd, 0xd4, 0x83, 0xd2, 0xbd, 0x9a, 0x13, 0x31, 0xbe,
+  0x9f, 0x66, 0xe1, 0xbd, 0x95, 0x7d, 0x46, 0xbd, 0xd2, 0xc6, 0x86, 0x3d,
+  0xb4, 0x33, 0x7b, 0x3e, 0x63, 0x4c, 0xed, 0xbc, 0x0b, 0x0a, 0x82, 0xbd,
+  0xe0, 0x2b, 0x77, 0xbe, 0x62, 0xff, 0xe0, 0xbd, 0x8b, 0x69, 0x50, 0xbd,
+  0x43, 0x2f, 0xc5, 0xbd, 0x56, 0x08, 0xa0, 0xbd, 0x05, 0x98, 0x5c, 0x3e,
+  0x94, 0x84, 0xac, 0xbd, 0x85, 0xc3, 0x61, 0xbd, 0x7e, 0xb9, 0x87, 0xbd,
+  0x1d, 0xc7, 0x0d, 0x3e, 0xed, 0x45, 0x2d, 0x3e, 0xb6, 0xab, 0x0f, 0x3e,
+  0x59, 0x46, 0xb6, 0xbc, 0xd5, 0x1a, 0xaa, 0xbd, 0x72, 0xa6, 0x14, 0x3e,
+  0x20, 0x4d, 0x17, 0x3e, 0x70, 0x79, 0xfe, 0xbe, 0x2e, 0x4f, 0x25, 0x3e,
+  0x7b, 0xde, 0xaa, 0x3d, 0xe2, 0x53, 0xc0, 0x3a, 0x1e, 0x1b, 0xda, 0xbc,
+  0x1f, 0x08, 0x10, 0xbf, 0x55, 0xf8, 0x93, 0x3d, 0x6d, 0xd1, 0x1e, 0x3e,
+  0x8d, 0x25, 0xff, 0xbe, 0x53, 0x18, 0xdc, 0xbd, 0xbc, 0x64, 0xc1, 0xbc,
+  0xba, 0xc9, 0x9b, 0xbd, 0xc1, 0xac, 0xa5, 0xbd, 0x20, 0x37, 0x90, 0xbe,
+  0xb2, 0x07, 0xa6, 0xbd, 0x7e, 0x25, 0x6e, 0xbd, 0xe9, 0x87, 0xc8, 0xbd,
+  0x6c, 0xe3, 0xe9, 0xbd, 0x90, 0x36, 0xdd, 0xbb, 0x03, 0x92, 0x0d, 0xbd,
+  0xa7, 0xe0, 0x17, 0xbc, 0x2b, 0x99, 0xcf, 0x3d, 0xee, 0x54, 0x59, 0xbd,
+  0x6f, 0x54, 0xc8, 0xbd, 0xbf, 0x39, 0x97, 0x3d, 0xac, 0x18, 0xe7, 0x3a,
+  0xf8, 0xa7, 0xf5, 0xba, 0x35, 0x6d, 0x94, 0xbd, 0xec, 0xc2, 0x53, 0xbc,
+  0x80, 0x1c, 0x39, 0x3e, 0x3f, 0x89, 0xc8, 0xbd, 0xd2, 0xb0, 0x29, 0xbc,
+  0x15, 0x59, 0x80, 0x3d, 0x68, 0x9c, 0x3e, 0xbe, 0x56, 0x33, 0x58, 0xbe,
+  0x2b, 0x44, 0x01, 0xbe, 0xf6, 0x9e, 0x14, 0xbe, 0x9f, 0x05, 0x0c, 0x3e,
+  0xd5, 0x50, 0x05, 0xbe, 0x1b, 0xaf, 0xfd, 0xbd, 0xb1, 0xe8, 0x01, 0x3e,
+  0x6d, 0xb1, 0x71, 0xbe, 0x6b, 0x32, 0x68, 0xbe, 0x1c, 0xdc, 0x1e, 0xbe,
+  0x57, 0xb1, 0x78, 0xbe, 0x8b, 0xdc, 0x1f, 0x3e, 0xf2, 0x32, 0xb2, 0xbd,
+  0xc1, 0x5b, 0x5e, 0xbe, 0x62, 0x4f, 0x28, 0x3e, 0x50, 0x4e, 0xfd, 0x3c,
+  0xc9, 0xbe, 0x9b, 0x3d, 0x29, 0x85, 0xdb, 0x3d, 0xd0, 0x0b, 0x00, 0x3c,
+  0xa7, 0x62, 0x22, 0x3e, 0xc1, 0x42, 0xa6, 0x3d, 0x48, 0x28, 0x25, 0x3d,
+  0x38, 0xc4, 0xf1, 0x3d, 0xec, 0x2f, 0x24, 0xbc, 0x07, 0x8a, 0xa4, 0xbd,
+  0x4d, 0x04, 0x68, 0xbd, 0x2f, 0xc5, 0x98, 0xbc, 0x97, 0x83, 0x0f, 0x3e,
+  0xc6, 0x8f, 0xcd, 0xbd, 0x1b, 0xfe, 0x0d, 0x3d, 0xd7, 0x0d, 0x02, 0x3e,
+  0xda, 0xf5, 0x98, 0xbd, 0x60, 0x87, 0xdf, 0xbd, 0x4a, 0x56, 0x0a, 0xbe,
+  0x5d, 0x3a, 0x58, 0xbd, 0x4f, 0xe0, 0x45, 0x3e, 0x47, 0x58, 0x93, 0xbd,
+  0x5c, 0xc8, 0xd2, 0xbc, 0x17, 0xc7, 0x9a, 0x3d, 0x20, 0xb7, 0xa6, 0x3b,
+  0xf0, 0x0b, 0xc2, 0xbd, 0x72, 0x57, 0x6d, 0xbd, 0x68, 0x10, 0x10, 0x3d,
+  0x66, 0x1a, 0xc8, 0x3d, 0xae, 0x14, 0xe0, 0xbc, 0x42, 0xaa, 0x2d, 0x3d,
+  0x76, 0xda, 0x9e, 0xbc, 0x0e, 0x89, 0x8e, 0xbe, 0x8c, 0x21, 0x4f, 0xbe,
+  0xac, 0xe3, 0x1b, 0xbe, 0x02, 0x95, 0xf8, 0xbd, 0x8a, 0x00, 0xdb, 0x3d,
+  0x8c, 0x62, 0x06, 0xbe, 0xeb, 0x9f, 0x46, 0xbe, 0xfb, 0x50, 0x2a, 0x3c,
+  0x81, 0xb0, 0x7c, 0xbd, 0xb1, 0x0d, 0xfb, 0xbc, 0xba, 0x17, 0x80, 0xbd,
+  0xba, 0xa8, 0x47, 0xbe, 0x6b, 0x11, 0x9a, 0x3d, 0x17, 0x7c, 0xc6, 0xbc,
+  0xd3, 0xba, 0x3c, 0xbc, 0xe7, 0xff, 0x8c, 0xbe, 0xac, 0x6a, 0x40, 0x3d,
+  0x90, 0x15, 0x21, 0x3e, 0x6f, 0x9b, 0x07, 0x3e, 0x88, 0xc7, 0xe6, 0x38,
+  0xae, 0x24, 0x79, 0xbe, 0xb9, 0x46, 0x3e, 0x3e, 0x78, 0x87, 0x65, 0x3e,
+  0x40, 0x18, 0x15, 0xbf, 0x1a, 0xa7, 0xf3, 0x3d, 0xf7, 0x8f, 0xff, 0x3d,
+  0x74, 0x42, 0x15, 0x3e, 0x76, 0x58, 0x24, 0x3c, 0xcf, 0xaf, 0xb7, 0xbe,
+  0xf2, 0x73, 0x3f, 0x3d, 0x55, 0xd9, 0xba, 0x3d, 0x35, 0x76, 0xe1, 0xbe,
+  0xad, 0x7b, 0x28, 0xbe, 0xc5, 0x4a, 0x07, 0xbd, 0xf1, 0x34, 0x96, 0xbd,
+  0xfc, 0xe1, 0x19, 0xbd, 0x18, 0x82, 0x6c, 0x3d, 0x70, 0xd2, 0xb8, 0xbd,
+  0x90, 0x17, 0xa5, 0xbd, 0x6a, 0xaa, 0xd5, 0xbd, 0x65, 0x1d, 0x0f, 0xbe,
+  0xc0, 0x55, 0xbe, 0xbd, 0x41, 0x04, 0x48, 0xbe, 0x02, 0x2c, 0xd3, 0xbd,
+  0xb6, 0x60, 0xe7, 0x3d, 0xc3, 0x3f, 0x23, 0xbe, 0x4f, 0xd2, 0xa1, 0xbd,
+  0xeb, 0x9f, 0x8d, 0x3d, 0x11, 0xb4, 0x05, 0xbe, 0x21, 0x65, 0x0a, 0xbe,
+  0xd0, 0x6c, 0x11, 0xbe, 0x71, 0xd6, 0x03, 0xbe, 0x97, 0x39, 0x57, 0x3e,
+  0x24, 0x45, 0x39, 0xbe, 0x76, 0xe6, 0x8d, 0xbd, 0x56, 0x3d, 0x26, 0x3e,
+  0x38, 0x97, 0xbf, 0xbd, 0xd0, 0xa6, 0xf7, 0xbd, 0x96, 0x3e, 0x5c, 0xbe,
+  0xe4, 0x1c, 0x45, 0xbe, 0x5e, 0x78, 0x77, 0x3e, 0xc9, 0x75, 0x3c, 0xbe,
+  0x60, 0x08, 0x0c, 0xbe, 0xcc, 0xe0, 0x1b, 0x3e, 0xf4, 0x6d, 0x16, 0xbe,
+  0xee, 0x7e, 0x7d, 0xbe, 0x78, 0x2b, 0x99, 0xbd, 0xd6, 0x18, 0x3a, 0xbe,
+  0xe6, 0xe3, 0x58, 0x3e, 0x3d, 0x67, 0xf9, 0xbd, 0xeb, 0x3d, 0x16, 0xbe,
+  0xea, 0x95, 0x35, 0x3e, 0x29, 0x1b, 0x9a, 0xbc, 0xdc, 0xc2, 0xe6, 0x3d,
+  0xdf, 0x77, 0x8d, 0x3d, 0xe8, 0xa2, 0xae, 0x3d, 0xdf, 0xd3, 0x7f, 0x3e,
+  0x9b, 0xfe, 0x12, 0x3e, 0x2f, 0x46, 0x1d, 0x3e, 0x01, 0xed, 0xa3, 0x3d,
+  0x91, 0x97, 0x75, 0xbe, 0x3e, 0x12, 0xff, 0xbd, 0xa4, 0x66, 0x24, 0xbd,
+  0xab, 0x86, 0x22, 0xbc, 0xc4, 0x90, 0x76, 0x3e, 0xe0, 0xc5, 0x8e, 0x3c,
+  0xf3, 0x5f, 0xa5, 0xbd, 0x29, 0xb7, 0x2d, 0x39, 0x49, 0xaf, 0x70, 0xbe,
+  0x6d, 0x72, 0xcf, 0xbd, 0x13, 0xf8, 0x26, 0xbe, 0xb6, 0x05, 0x36, 0xbe,
+  0x65, 0x89, 0x05, 0x3e, 0x6e, 0xc3, 0x95, 0xbd, 0x35, 0x15, 0x01, 0xbe,
+  0x2d, 0x2f, 0xcb, 0xbc, 0x44, 0x5f, 0x80, 0xbd, 0x45, 0x4a, 0x9b, 0x3a,
+  0x97, 0xad, 0x40, 0xbc, 0x41, 0x20, 0xc3, 0x3c, 0xfa, 0xca, 0x7d, 0x3e,
+  0x88, 0x59, 0x63, 0xbd, 0x05, 0x92, 0xbc, 0xbd, 0x01, 0x8c, 0x8d, 0xbd,
+  0x5b, 0xd2, 0xa5, 0xbd, 0x20, 0x66, 0xd9, 0xbd, 0x0d, 0xa4, 0xa3, 0xbd,
+  0x29, 0x64, 0x82, 0xbe, 0x45, 0x24, 0xec, 0xbd, 0x9e, 0x51, 0x4a, 0xbe,
+  0x82, 0xfb, 0xa2, 0xbd, 0x67, 0x64, 0x8b, 0xbe, 0xbb, 0xd4, 0x93, 0xbd,
+  0xc4, 0x5a, 0x85, 0x3c, 0xf3, 0x7e, 0x89, 0x3c, 0x51, 0x4c, 0x8f, 0xbe,
+  0x0e, 0xc2, 0x03, 0xbe, 0xa5, 0xdf, 0x7b, 0xbd, 0x30, 0x41, 0xb3, 0x3b,
+  0xa3, 0x20, 0x18, 0xbf, 0x75, 0x8d, 0x9e, 0x3d, 0x37, 0x7c, 0x0c, 0x3e,
+  0xb6, 0xc2, 0x0a, 0x3e, 0xc3, 0x14, 0xd4, 0x3c, 0xde, 0x76, 0x9c, 0xbe,
+  0x3f, 0x43, 0xc9, 0x3d, 0xf5, 0xdb, 0x23, 0x3e, 0x4c, 0x07, 0x06, 0xbf,
+  0xe7, 0x64, 0x8e, 0x3d, 0x95, 0x7c, 0x4d, 0x3e, 0x8b, 0x55, 0x9d, 0x3b,
+  0xce, 0x16, 0xd1, 0x3d, 0x94, 0x13, 0xa4, 0xbd, 0x2b, 0xc1, 0x45, 0x3d,
+  0xf0, 0x0d, 0x5a, 0x3d, 0x28, 0x46, 0x52, 0xbe, 0xb2, 0x74, 0x1c, 0xbe,
+  0xd6, 0xe9, 0xff, 0xbd, 0x8b, 0xc4, 0x5f, 0xbe, 0xd0, 0xb8, 0x38, 0xbe,
+  0x6c, 0xde, 0x1a, 0x3d, 0x2f, 0x5c, 0x33, 0xbe, 0xf2, 0xed, 0x46, 0xbe,
+  0x6d, 0x02, 0x16, 0xbd, 0xee, 0xd9, 0x74, 0xbe, 0xf8, 0x70, 0x19, 0xbe,
+  0x93, 0x84, 0x2e, 0xbe, 0xe4, 0xc6, 0x8c, 0xbe, 0xb3, 0x33, 0xc6, 0x3d,
+  0x6a, 0x8d, 0xdf, 0xbd, 0x85, 0x79, 0x40, 0xbe, 0xe4, 0x87, 0x05, 0x3e,
+  0x8e, 0xf4, 0x54, 0xbe, 0x8d, 0xc7, 0x6b, 0xbe, 0xf9, 0x67, 0x3d, 0xbe,
+  0xf4, 0xae, 0x5a, 0xbe, 0x07, 0xc1, 0x46, 0x3e, 0xe2, 0xfe, 0x60, 0xbe,
+  0x5b, 0x8d, 0x59, 0xbe, 0x1f, 0x5e, 0x16, 0x3e, 0x3c, 0xa0, 0x2c, 0xbe,
+  0x5b, 0xc5, 0x1d, 0xbe, 0x3d, 0x03, 0xb3, 0xbc, 0x0f, 0x9d, 0x50, 0xbe,
+  0xbe, 0xcb, 0x75, 0x3e, 0xd5, 0xc1, 0x2f, 0xbe, 0xc5, 0x07, 0x0c, 0xbe,
+  0x07, 0x6f, 0xdc, 0x3d, 0xdb, 0x02, 0xe9, 0xbd, 0xfd, 0x96, 0xe2, 0xbd,
+  0x89, 0xe9, 0xe9, 0xbc, 0xc0, 0x10, 0x09, 0xbe, 0x5d, 0xc3, 0x1b, 0x3e,
+  0x9d, 0x62, 0x89, 0xbc, 0x17, 0xa4, 0xc4, 0xbd, 0x54, 0xdb, 0x6e, 0x3e,
+  0x6d, 0x9b, 0xf1, 0xbd, 0x33, 0xa6, 0x85, 0xbd, 0x08, 0x49, 0x81, 0x3b,
+  0x19, 0xd5, 0x6f, 0x3d, 0x2f, 0x80, 0x29, 0x3e, 0x30, 0xbb, 0x97, 0xbc,
+  0xaa, 0x5b, 0x44, 0xbd, 0xbd, 0x9e, 0x62, 0xbd, 0xaf, 0xd5, 0xbb, 0xbe,
+  0x54, 0x93, 0x19, 0xbe, 0x18, 0xe1, 0x87, 0xbe, 0x39, 0x57, 0x45, 0xbe,
+  0x26, 0x1b, 0x39, 0x3e, 0xc7, 0xb2, 0x54, 0xbe, 0x74, 0x8e, 0x80, 0xbe,
+  0xce, 0x65, 0xac, 0xbd, 0xec, 0xec, 0x13, 0xbe, 0x4d, 0x85, 0x3a, 0xbe,
+  0x60, 0xe5, 0x53, 0xbe, 0xd4, 0x05, 0x55, 0xbe, 0x01, 0xcf, 0x3a, 0x3e,
+  0x9e, 0xc1, 0x3e, 0xbe, 0x56, 0x17, 0x83, 0xbe, 0x98, 0x18, 0x9f, 0x3d,
+  0x18, 0xe9, 0x21, 0xbd, 0x53, 0xc3, 0xcf, 0xbc, 0x3b, 0xaa, 0x00, 0xbd,
+  0xd1, 0xeb, 0x2d, 0xbe, 0xf5, 0xfc, 0x16, 0x3e, 0x8c, 0x56, 0x43, 0xbd,
+  0x85, 0x2c, 0xfc, 0xbc, 0x46, 0x0a, 0x67, 0xbd, 0x78, 0xce, 0xca, 0xbd,
+  0x89, 0x26, 0x9c, 0xbd, 0x01, 0xf8, 0xd4, 0xbd, 0x87, 0x80, 0x5a, 0xbe,
+  0x38, 0x7e, 0xe3, 0xbd, 0xbb, 0x95, 0xfe, 0xbd, 0x28, 0xc5, 0xde, 0xbd,
+  0x01, 0x1b, 0x93, 0xbe, 0x76, 0x8d, 0xd3, 0xbd, 0xfd, 0xdf, 0xc6, 0x3c,
+  0x60, 0x3e, 0xff, 0xbd, 0x56, 0x51, 0x2f, 0xbe, 0x5d, 0x12, 0x74, 0xbd,
+  0x10, 0x51, 0xa2, 0xbd, 0x8d, 0x8a, 0xbf, 0xbd, 0xfb, 0x21, 0xd5, 0xbe,
+  0x93, 0x5e, 0x02, 0x3e, 0x8a, 0x81, 0x2f, 0x3e, 0x12, 0x52, 0x2b, 0x3e,
+  0x95, 0x26, 0xb8, 0x3d, 0x0b, 0xe1, 0x17, 0xbd, 0xca, 0x75, 0xb6, 0x3d,
+  0xf8, 0xee, 0x1a, 0x3e, 0xdf, 0xab, 0x81, 0xbe, 0x53, 0x33, 0xbb, 0x3c,
+  0xc0, 0xa9, 0x90, 0x3c, 0x2b, 0xd9, 0xef, 0xbd, 0x18, 0x64, 0x55, 0xbc,
+  0xa2, 0x05, 0x8f, 0x3c, 0x77, 0xdc, 0x23, 0x3c, 0x5c, 0xc5, 0x7c, 0xbd,
+  0xc9, 0xd8, 0x00, 0x3e, 0x51, 0x9d, 0xf4, 0xbd, 0xeb, 0x71, 0x35, 0xbe,
+  0x03, 0x95, 0xe7, 0xbd, 0x93, 0xc7, 0xad, 0xbe, 0xbc, 0xf9, 0xdb, 0xbc,
+  0x9d, 0xef, 0x49, 0xbe, 0x35, 0x93, 0x2b, 0xbe, 0x84, 0x61, 0xc0, 0x3d,
+  0xbc, 0x05, 0x27, 0xbd, 0x18, 0xb1, 0xdc, 0xbd, 0x46, 0x12, 0x4b, 0x3d,
+  0x32, 0xbb, 0x31, 0xbe, 0x01, 0x32, 0xfb, 0x3d, 0xbd, 0x70, 0x68, 0x3c,
+  0xc3, 0x46, 0x73, 0xbd, 0x0a, 0xb8, 0x25, 0x3e, 0x71, 0x05, 0x03, 0xbd,
+  0x18, 0xc7, 0x53, 0x3c, 0xcb, 0xf8, 0xff, 0xba, 0xed, 0xaa, 0x02, 0xbd,
+  0xd0, 0x0d, 0x87, 0x3e, 0xfe, 0xe2, 0x55, 0xbd, 0x31, 0x0b, 0x47, 0xbc,
+  0x3f, 0x11, 0xda, 0x3d, 0x6c, 0x51, 0x9a, 0xbc, 0xa5, 0xbc, 0xbd, 0xbc,
+  0xc2, 0x65, 0x4f, 0xbd, 0xfb, 0x1c, 0xd5, 0xbd, 0x3f, 0x35, 0x54, 0x3e,
+  0xbd, 0x40, 0xde, 0xbd, 0x86, 0x16, 0x22, 0xbd, 0x99, 0xeb, 0x4f, 0x3e,
+  0x45, 0x53, 0x46, 0xbd, 0x5e, 0xef, 0x7b, 0xbd, 0xca, 0xc6, 0xd1, 0xbd,
+  0xa6, 0xe0, 0xa5, 0xbd, 0xc9, 0xe4, 0x24, 0x3e, 0x99, 0xca, 0x94, 0xbc,
+  0xdc, 0x73, 0x0d, 0xbd, 0x03, 0xfc, 0x55, 0x3e, 0xd6, 0x50, 0x1a, 0xbd,
+  0x25, 0xf4, 0x81, 0xbd, 0x12, 0x95, 0xb3, 0xbd, 0xb4, 0x96, 0xb4, 0xbc,
+  0x59, 0x49, 0x53, 0x3e, 0x71, 0xcc, 0xfd, 0xbd, 0x7d, 0x0e, 0xb8, 0xbc,
+  0x95, 0x23, 0x18, 0x3e, 0xdd, 0xab, 0x29, 0x3d, 0x4a, 0x06, 0xa2, 0xbe,
+  0x54, 0x2e, 0xad, 0xbe, 0x01, 0xc9, 0xa1, 0xbe, 0xb1, 0x2e, 0x1d, 0x3e,
+  0x0e, 0x58, 0x85, 0xbe, 0x66, 0x88, 0x9b, 0xbe, 0xb7, 0x2a, 0x80, 0x3e,
+  0xb2, 0x09, 0x60, 0xbd, 0xb1, 0x20, 0x85, 0xbd, 0x3b, 0xfe, 0x4f, 0x3c,
+  0xd9, 0x7e, 0x3a, 0xbe, 0xd3, 0x46, 0x37, 0x3e, 0xf5, 0x89, 0x40, 0xbd,
+  0x67, 0x0c, 0x71, 0xbd, 0xda, 0x81, 0x2c, 0x3e, 0x49, 0x6b, 0xe3, 0xbc,
+  0x11, 0x7c, 0xe3, 0x3c, 0xb4, 0xf4, 0xbc, 0xbc, 0xe0, 0x74, 0x28, 0xbd,
+  0x83, 0x60, 0x07, 0x3d, 0x1e, 0xb2, 0x7b, 0xbd, 0x21, 0x43, 0x65, 0xbc,
+  0x23, 0x19, 0xec, 0x3c, 0xc0, 0x1b, 0x31, 0x3d, 0x64, 0x8d, 0x85, 0xbd,
+  0x9e, 0x0b, 0x40, 0xbb, 0x86, 0xd6, 0x04, 0xbe, 0x61, 0xc5, 0x74, 0xbd,
+  0x00, 0x92, 0xba, 0xbd, 0x12, 0xa9, 0xae, 0xbc, 0x4a, 0xe4, 0x2c, 0xbe,
+  0x6c, 0xbc, 0x7f, 0xbd, 0xa5, 0xbd, 0x40, 0x3d, 0x7d, 0x3f, 0x32, 0x3d,
+  0x05, 0x4f, 0x12, 0xbd, 0xe3, 0x94, 0xcf, 0xbb, 0x35, 0xc5, 0xa8, 0xbc,
+  0x5a, 0x61, 0x9d, 0x3d, 0xce, 0x7f, 0xae, 0xbe, 0x86, 0xeb, 0xdc, 0x3c,
+  0x9c, 0x06, 0xce, 0x3c, 0xb6, 0xea, 0x08, 0xbd, 0x27, 0x93, 0xc5, 0xba,
+  0x54, 0x7f, 0x02, 0xbd, 0xd2, 0x82, 0x4c, 0xbb, 0xff, 0xb4, 0x88, 0x3d,
+  0xb6, 0x45, 0xfd, 0xbd, 0xe4, 0xca, 0x97, 0x3d, 0xc1, 0xaf, 0x9e, 0x3c,
+  0x27, 0x98, 0x89, 0xbd, 0x2e, 0xe4, 0x1f, 0xbe, 0x4f, 0xea, 0xac, 0xbc,
+  0x15, 0xe2, 0x1d, 0xbe, 0x6d, 0x96, 0x26, 0xbc, 0x2e, 0x7d, 0xc7, 0x3d,
+  0xe9, 0x41, 0x8d, 0xbd, 0xef, 0x8e, 0xb4, 0xbc, 0x81, 0xdc, 0x07, 0x3d,
+  0xad, 0xb9, 0x13, 0xbe, 0x51, 0xe5, 0x9f, 0xbb, 0x59, 0x4f, 0x89, 0x3d,
+  0x85, 0xf6, 0x2d, 0xbd, 0xcb, 0x04, 0x02, 0x3e, 0x86, 0x67, 0xad, 0x3d,
+  0x02, 0x5c, 0xb3, 0x3d, 0xb3, 0x0a, 0x64, 0x3c, 0x5e, 0x24, 0x92, 0x3c,
+  0xfc, 0x85, 0xd0, 0x3d, 0x06, 0xe4, 0x39, 0xbc, 0x84, 0xfc, 0x6e, 0x3d,
+  0x7d, 0x16, 0x8f, 0x3d, 0xf2, 0x9f, 0x38, 0x3b, 0x4c, 0xe6, 0x8b, 0x3c,
+  0x77, 0xa0, 0x53, 0xbc, 0xef, 0x32, 0xc8, 0x3c, 0x14, 0xed, 0x13, 0x3e,
+  0xdc, 0x9a, 0x78, 0xbd, 0x6e, 0x67, 0x9c, 0xbd, 0xe7, 0x72, 0x2e, 0x3d,
+  0x4c, 0x4c, 0xc1, 0xbd, 0x3d, 0xbb, 0xac, 0xbd, 0x0f, 0x0a, 0x93, 0xbd,
+  0x23, 0x64, 0x59, 0xbd, 0xbb, 0x54, 0x49, 0x3e, 0xb9, 0xba, 0x4a, 0xbc,
+  0x56, 0x71, 0x28, 0xbd, 0xbb, 0x5f, 0x09, 0x3e, 0x76, 0x32, 0x97, 0x3d,
+  0xea, 0x8c, 0x7e, 0x3d, 0x7a, 0x5b, 0x2d, 0xbc, 0xd2, 0x40, 0xf0, 0x3c,
+  0x44, 0x4a, 0x11, 0x3e, 0x84, 0xc8, 0xb7, 0x3d, 0x16, 0x67, 0xb4, 0x3b,
+  0xd8, 0x05, 0x3b, 0x3e, 0xdb, 0x30, 0x63, 0xbd, 0xae, 0xda, 0x7d, 0x3d,
+  0x5b, 0xb3, 0x86, 0x3c, 0xb8, 0x37, 0x6c, 0xbb, 0x64, 0x3a, 0x81, 0x3e,
+  0x12, 0xfb, 0x78, 0xbd, 0xc0, 0x36, 0xaf, 0xbd, 0x4c, 0x0f, 0x2d, 0x3e,
+  0xdb, 0x9d, 0x06, 0x3e, 0xca, 0xef, 0x5e, 0xbd, 0x09, 0x04, 0x67, 0xbb,
+  0x37, 0x88, 0x04, 0x3d, 0x36, 0xbf, 0x9b, 0x3d, 0x91, 0x29, 0xa6, 0xbb,
+  0xfe, 0x47, 0x2b, 0x3d, 0xfd, 0x42, 0x6d, 0x3e, 0xa6, 0x6b, 0x87, 0xbb,
+  0x54, 0xd6, 0x83, 0x3c, 0xab, 0x8c, 0x38, 0x3d, 0x0f, 0x31, 0xf9, 0xbc,
+  0x10, 0xa8, 0xc0, 0x3c, 0xbf, 0xff, 0xd8, 0x3d, 0xf0, 0x26, 0x5b, 0xbb,
+  0xc1, 0xd0, 0x15, 0x3d, 0xd6, 0x2f, 0x00, 0xbd, 0x75, 0xd9, 0x79, 0x3d,
+  0x18, 0xb1, 0x82, 0x3d, 0xd1, 0xf3, 0x4a, 0x3d, 0x05, 0xc7, 0xbe, 0x3d,
+  0x35, 0x6b, 0xd4, 0x3d, 0xcd, 0x97, 0x15, 0x3c, 0x24, 0x5d, 0x20, 0xbe,
+  0xf4, 0xcd, 0x9c, 0xbd, 0x06, 0x6b, 0xba, 0x3d, 0xd3, 0x4b, 0x46, 0xbd,
+  0x8a, 0xab, 0x90, 0x3d, 0x86, 0x87, 0xa2, 0xbd, 0x3d, 0x26, 0x6b, 0x3d,
+  0xbc, 0xd2, 0xe0, 0xbb, 0x10, 0x23, 0xce, 0xbe, 0x00, 0xa2, 0xb6, 0xbd,
+  0xac, 0x75, 0x1b, 0xbd, 0xe7, 0x7b, 0x79, 0xbd, 0x95, 0x3e, 0x04, 0xbe,
+  0xad, 0x0b, 0xe2, 0xbd, 0x92, 0x74, 0xed, 0xbd, 0x55, 0xb6, 0x88, 0xbd,
+  0x01, 0xdb, 0x08, 0xbf, 0xe1, 0x17, 0xcb, 0xbc, 0x9e, 0x49, 0x9d, 0xbd,
+  0x08, 0x0f, 0x1e, 0xbc, 0xaa, 0x37, 0x16, 0xbe, 0xc8, 0x3b, 0x7e, 0xbd,
+  0x88, 0xfa, 0xb4, 0xbd, 0x30, 0x86, 0xa6, 0xbd, 0x93, 0x4d, 0xbe, 0xbe,
+  0xbf, 0x84, 0x2e, 0x3d, 0x03, 0xf7, 0x52, 0x3d, 0xfb, 0xa7, 0x3f, 0xbd,
+  0xc8, 0x06, 0xda, 0xbc, 0x0c, 0xd5, 0x95, 0xbc, 0x7c, 0xfc, 0xb1, 0xbc,
+  0xf1, 0xd0, 0x21, 0x3d, 0xd7, 0x4a, 0x80, 0xbd, 0x28, 0x23, 0x26, 0x3e,
+  0x9a, 0xc3, 0xe2, 0x3d, 0x51, 0x36, 0x51, 0x3d, 0x43, 0x41, 0x61, 0xbc,
+  0x9a, 0x11, 0x82, 0x3e, 0x39, 0x6e, 0x2c, 0x3a, 0x91, 0x83, 0x00, 0x3d,
+  0xf6, 0x6f, 0xc0, 0x3d, 0x98, 0x52, 0x21, 0x3c, 0xd9, 0x0c, 0x00, 0x3b,
+  0xec, 0x09, 0x0b, 0xbd, 0x41, 0x2c, 0x88, 0x3c, 0x96, 0x0e, 0x2a, 0x3e,
+  0xa2, 0x33, 0x7c, 0x3c, 0xac, 0x2b, 0x1e, 0xbd, 0xab, 0x01, 0x1f, 0x3e,
+  0xd5, 0x09, 0xa3, 0xbd, 0x56, 0x0f, 0xaa, 0x3c, 0xbd, 0x40, 0x59, 0xbc,
+  0xab, 0x46, 0x65, 0xbd, 0x1c, 0xb3, 0x65, 0x3e, 0xac, 0x20, 0x26, 0x3c,
+  0x17, 0x61, 0xab, 0xbd, 0x2e, 0x0c, 0x2d, 0x3e, 0x01, 0x22, 0xcb, 0xbd,
+  0xe1, 0x78, 0xeb, 0xbd, 0xed, 0x43, 0x89, 0xbd, 0xac, 0x59, 0x90, 0xbd,
+  0x84, 0x54, 0x85, 0x3e, 0xd1, 0xc0, 0xc1, 0xbd, 0x6c, 0x7f, 0x09, 0xbe,
+  0xe9, 0xf0, 0x11, 0x3e, 0xfb, 0x52, 0x29, 0x3d, 0xe9, 0x13, 0x24, 0xbd,
+  0xc9, 0xa9, 0x0c, 0x3d, 0x4a, 0x11, 0xb7, 0x3d, 0x45, 0x24, 0x44, 0x3e,
+  0xb7, 0xdf, 0xae, 0x3d, 0xc9, 0x56, 0xef, 0x3c, 0x5b, 0xa8, 0x53, 0x3e,
+  0x96, 0xdd, 0xce, 0x3c, 0x15, 0x52, 0x0b, 0xbe, 0xa5, 0xa6, 0xfb, 0xbd,
+  0xee, 0x6d, 0xc8, 0xbc, 0xba, 0xfc, 0x66, 0x3e, 0x5d, 0x20, 0x0b, 0xbe,
+  0x45, 0xdd, 0x66, 0xbd, 0x81, 0x7b, 0xbd, 0x3d, 0xe8, 0x51, 0xb2, 0xbd,
+  0x96, 0x5c, 0x0e, 0x3e, 0x3c, 0x3e, 0x36, 0x3d, 0xff, 0xe8, 0xb1, 0x3c,
+  0xf5, 0xee, 0x9b, 0x3e, 0x02, 0xfd, 0xcd, 0x3d, 0x06, 0x0a, 0xd5, 0x3d,
+  0xeb, 0x12, 0xaa, 0x3d, 0xa9, 0x8f, 0xa4, 0x3d, 0x66, 0xd7, 0xae, 0x3d,
+  0x20, 0x7a, 0xd2, 0x3b, 0xd3, 0x1f, 0xbd, 0x3c, 0x08, 0x2b, 0x28, 0x3e,
+  0xa8, 0xf8, 0x02, 0xbc, 0xd7, 0xc8, 0x99, 0x3d, 0xf5, 0x83, 0x00, 0x3c,
+  0x08, 0x22, 0x78, 0xba, 0xc8, 0x8f, 0x25, 0x3b, 0xa0, 0x64, 0x83, 0x3d,
+  0xef, 0xd8, 0xea, 0x3c, 0x88, 0xf6, 0x1f, 0x3e, 0x31, 0x00, 0xd8, 0x3c,
+  0x8c, 0xc3, 0x96, 0x3d, 0xe7, 0xd7, 0x1a, 0xbe, 0xeb, 0x77, 0x5a, 0xbd,
+  0x9f, 0x9d, 0x95, 0xbd, 0x6f, 0x63, 0x57, 0x3b, 0xd7, 0x64, 0xbf, 0xbc,
+  0xb5, 0x2e, 0xf5, 0x3c, 0x6c, 0x92, 0xfe, 0x3b, 0x9b, 0x75, 0x26, 0xbd,
+  0x24, 0x38, 0x7b, 0xbe, 0x23, 0x14, 0x25, 0x3d, 0xc3, 0xb4, 0xf5, 0xbd,
+  0xb6, 0x41, 0x7c, 0xbd, 0xda, 0xfe, 0xef, 0xbd, 0xd7, 0x99, 0x00, 0xbd,
+  0x15, 0x6d, 0x50, 0xbc, 0xf1, 0xf6, 0xb2, 0xbd, 0xa3, 0x4c, 0x47, 0xbe,
+  0x89, 0x49, 0x2f, 0xbd, 0x2d, 0x8c, 0xb1, 0x3c, 0x07, 0x66, 0x94, 0x3d,
+  0x07, 0xa1, 0x44, 0x3c, 0x17, 0xda, 0x1a, 0x3c, 0x10, 0xc8, 0x03, 0x3d,
+  0x43, 0x27, 0x2f, 0x3d, 0x1f, 0xed, 0xd9, 0xbd, 0x5a, 0xe0, 0xe0, 0x3d,
+  0x26, 0x9e, 0xb6, 0x3c, 0x1e, 0x3a, 0x6a, 0x3d, 0x59, 0x7d, 0xc1, 0x3c,
+  0x81, 0xd0, 0xc8, 0x3d, 0x2b, 0x1a, 0x1e, 0xbd, 0xb7, 0xbc, 0xcf, 0x3d,
+  0x5c, 0x18, 0x9a, 0x3c, 0x44, 0xde, 0x91, 0x3d, 0xc7, 0xba, 0x99, 0xbb,
+  0x1e, 0xf8, 0x25, 0x3c, 0x53, 0x84, 0x35, 0x3d, 0x25, 0xa0, 0x6c, 0x3e,
+  0x0b, 0xb0, 0xcb, 0x3d, 0xfe, 0x58, 0xe2, 0x3d, 0x46, 0x45, 0x1e, 0x3e,
+  0xfc, 0x34, 0x86, 0x3d, 0xb7, 0x19, 0x96, 0x3d, 0xaf, 0x3d, 0x87, 0x3d,
+  0x94, 0x01, 0x8c, 0x3d, 0x2e, 0x64, 0x4e, 0x3e, 0xd2, 0x51, 0xf6, 0xbb,
+  0x9f, 0x1e, 0x15, 0xbd, 0x4e, 0x35, 0x28, 0x3e, 0x2b, 0xe1, 0x4f, 0x3d,
+  0x95, 0xc9, 0x5d, 0xbd, 0xa0, 0x9c, 0x1b, 0xbe, 0x44, 0x66, 0x7d, 0xbd,
+  0x65, 0x30, 0x3c, 0x3e, 0xfd, 0x1d, 0x3c, 0xbd, 0xf1, 0x1d, 0x16, 0xbd,
+  0x8c, 0xae, 0x77, 0x3e, 0x8f, 0x84, 0x22, 0xbe, 0x69, 0x78, 0xb9, 0xbd,
+  0x6b, 0x26, 0xd6, 0xbc, 0x2d, 0x31, 0x99, 0xbd, 0xc2, 0x6d, 0x61, 0x3e,
+  0xe2, 0xa3, 0xc2, 0xbd, 0x58, 0x9e, 0xf2, 0xbd, 0xf0, 0x23, 0x12, 0x3e,
+  0x87, 0x88, 0x37, 0x3d, 0x30, 0xa7, 0x44, 0x3a, 0x24, 0x30, 0xc3, 0x3d,
+  0x60, 0x34, 0x36, 0x3d, 0x74, 0x67, 0x72, 0x3e, 0xc0, 0xe0, 0x95, 0x3d,
+  0xf4, 0xcf, 0x9c, 0x3c, 0x3f, 0xa5, 0x2e, 0x3e, 0xc5, 0xac, 0x72, 0x3c,
+  0x9d, 0x4f, 0x19, 0xbc, 0x7f, 0x27, 0x9b, 0xbb, 0x2f, 0xc9, 0x97, 0xbd,
+  0x0b, 0xfe, 0x83, 0x3e, 0x05, 0xa6, 0x23, 0xbd, 0xd9, 0x43, 0x43, 0xbd,
+  0x1d, 0x39, 0x1d, 0x3e, 0xb3, 0xd8, 0xf9, 0xbd, 0x4a, 0x8c, 0x29, 0xbe,
+  0x51, 0x9a, 0xbf, 0xbd, 0x84, 0x22, 0x0f, 0xbe, 0x8f, 0x85, 0xe9, 0x3d,
+  0x20, 0x8e, 0x14, 0xbe, 0x69, 0xfc, 0x30, 0xbe, 0xe5, 0x0a, 0x29, 0x3e,
+  0xad, 0xfb, 0x56, 0xbe, 0x66, 0x97, 0x12, 0xbe, 0x29, 0x52, 0x27, 0xbe,
+  0xe7, 0xd4, 0x8b, 0xbd, 0x97, 0x6d, 0x52, 0x3b, 0xd6, 0x0f, 0xe3, 0xbd,
+  0xc3, 0xb6, 0x3d, 0xbe, 0xfe, 0xd8, 0x7c, 0x3e, 0x91, 0x0d, 0xdf, 0xbd,
+  0x01, 0x58, 0x07, 0xbd, 0x32, 0xa4, 0xe0, 0xbd, 0x73, 0x32, 0xbc, 0xbc,
+  0xac, 0x47, 0xdf, 0x3d, 0xe1, 0xe0, 0xd2, 0xbd, 0x78, 0x23, 0xbd, 0xbd,
+  0x20, 0x56, 0x3d, 0x3e, 0xcf, 0xe9, 0x3d, 0xbe, 0x9a, 0xd3, 0x3e, 0xbd,
+  0x11, 0x12, 0x34, 0xbe, 0x25, 0xdc, 0x33, 0xbd, 0x2b, 0x7c, 0x7f, 0x3d,
+  0xc2, 0x88, 0x0a, 0xbd, 0x8a, 0xd0, 0x2d, 0xbe, 0xf7, 0x8e, 0x6a, 0x3e,
+  0xf6, 0xb8, 0x93, 0xbe, 0xca, 0xc6, 0x08, 0xbd, 0x32, 0x44, 0xbd, 0xbd,
+  0x43, 0xfb, 0xb2, 0xbd, 0x3f, 0x21, 0x1d, 0x3e, 0x32, 0xa5, 0xdd, 0xbd,
+  0x80, 0x28, 0x14, 0xbe, 0xac, 0xfa, 0x65, 0x3e, 0x87, 0xed, 0x49, 0xbe,
+  0x65, 0x3f, 0xae, 0xbc, 0x85, 0x44, 0x89, 0xbd, 0x69, 0x58, 0x39, 0xbd,
+  0xe0, 0x71, 0xda, 0x3d, 0x24, 0x19, 0xee, 0xbd, 0x5e, 0x45, 0x07, 0xbe,
+  0xb6, 0xbb, 0x91, 0x3e, 0x6c, 0x75, 0x74, 0xbe, 0x6a, 0xfa, 0x87, 0xbd,
+  0x32, 0x80, 0xec, 0xbd, 0x15, 0x20, 0x84, 0xbd, 0x72, 0x2d, 0x01, 0x3d,
+  0xfa, 0x57, 0x3e, 0xbe, 0x8e, 0xf1, 0x5d, 0xbe, 0x10, 0x73, 0x64, 0x3e,
+  0xc5, 0x91, 0x8a, 0xbe, 0x75, 0xc1, 0x97, 0xbd, 0xf6, 0x68, 0xe4, 0xb9,
+  0xc1, 0x8a, 0x53, 0xbd, 0xd8, 0xb7, 0x0e, 0x3e, 0x22, 0xcd, 0x13, 0xbe,
+  0x3d, 0x21, 0xa2, 0xbe, 0x21, 0x5a, 0x48, 0x3e, 0x73, 0xae, 0x66, 0xbe,
+  0x1e, 0xa0, 0x59, 0xbd, 0x7d, 0xd2, 0xc9, 0xbb, 0x5c, 0x80, 0xd1, 0xbd,
+  0x26, 0x6f, 0x09, 0x3e, 0x98, 0xfe, 0xd6, 0xbc, 0xd8, 0x66, 0x12, 0xbd,
+  0x69, 0xae, 0x89, 0x3e, 0x80, 0xb1, 0xb7, 0xbd, 0x29, 0xd3, 0x15, 0xbd,
+  0x78, 0xc7, 0xfb, 0xbd, 0x02, 0x18, 0x06, 0xbe, 0x61, 0x66, 0x11, 0x3e,
+  0xc6, 0x18, 0x23, 0xbe, 0x81, 0x0c, 0xb3, 0xbd, 0xfe, 0x78, 0x6c, 0x3e,
+  0x17, 0x27, 0x93, 0xbc, 0xa2, 0xcf, 0x1c, 0xbe, 0x42, 0xc9, 0x13, 0xbd,
+  0x4e, 0xfa, 0x26, 0xbe, 0xfe, 0x2f, 0x28, 0x3e, 0xae, 0xb7, 0xe1, 0x39,
+  0xed, 0x84, 0x20, 0xbd, 0xe7, 0x6d, 0x7d, 0x3e, 0x36, 0xda, 0x6d, 0x3d,
+  0x47, 0xe7, 0xdb, 0xbb, 0x94, 0x5d, 0xdd, 0x3d, 0x7d, 0x56, 0x8b, 0x3a,
+  0xa4, 0x04, 0x29, 0x3e, 0x17, 0x21, 0x37, 0x3e, 0x96, 0x33, 0x0e, 0xbc,
+  0x8e, 0x38, 0xbd, 0xbd, 0x28, 0x7d, 0x92, 0xbd, 0x5c, 0xb8, 0x3a, 0xbd,
+  0x21, 0x99, 0x45, 0x3c, 0xba, 0xbe, 0x7d, 0xbc, 0x2e, 0xb2, 0xff, 0xbd,
+  0xe3, 0xf6, 0x71, 0xbd, 0xcf, 0x03, 0xd7, 0xbd, 0x94, 0x00, 0x00, 0xbe,
+  0xb0, 0xa2, 0xa4, 0xbd, 0x15, 0xc8, 0x59, 0xbc, 0xd3, 0x6c, 0x41, 0xbc,
+  0xee, 0x30, 0x03, 0x3d, 0x70, 0x6e, 0x31, 0xbd, 0xb1, 0x5a, 0xfc, 0xbc,
+  0xae, 0x1e, 0xb4, 0xbd, 0x93, 0x05, 0x7f, 0xbd, 0x13, 0x19, 0x39, 0xbd,
+  0xb5, 0x55, 0xc4, 0xbd, 0x11, 0x1f, 0xe8, 0xbd, 0x3d, 0x88, 0xa4, 0xbc,
+  0x83, 0xa0, 0x52, 0xbd, 0xc0, 0x26, 0x99, 0xbd, 0xf4, 0x4b, 0xc7, 0xbd,
+  0x69, 0x0c, 0x08, 0x3c, 0x4a, 0xdc, 0x0a, 0x3e, 0xe6, 0x07, 0x47, 0xbd,
+  0xa4, 0xf9, 0xc6, 0x3b, 0x6c, 0x1e, 0xb5, 0x3c, 0x33, 0x46, 0x8f, 0xbd,
+  0xee, 0x4a, 0x45, 0xb9, 0x3f, 0xb5, 0x06, 0xbd, 0xaa, 0x73, 0x26, 0x3d,
+  0x28, 0x3a, 0x30, 0x3e, 0x12, 0xb1, 0x7e, 0x3c, 0x48, 0xe6, 0xad, 0x3d,
+  0x2c, 0x6d, 0xc5, 0xbd, 0x83, 0x29, 0xd5, 0xbd, 0xb5, 0xba, 0x40, 0x3c,
+  0x6f, 0x9f, 0xbd, 0x3d, 0x2e, 0x7b, 0xcb, 0x3d, 0xe6, 0x7e, 0xde, 0x3d,
+  0x12, 0x92, 0xe7, 0x3d, 0x96, 0xcf, 0xdf, 0x3a, 0xf7, 0x8e, 0xdd, 0xbc,
+  0x9e, 0x21, 0xa9, 0xbc, 0x52, 0x56, 0x2c, 0xbd, 0x2c, 0x9c, 0xa0, 0x3d,
+  0xea, 0x1f, 0x12, 0xbc, 0xd5, 0x9e, 0x4a, 0xbd, 0xfd, 0x74, 0x59, 0x3d,
+  0x0e, 0xa4, 0x8c, 0xb7, 0x95, 0x02, 0x9e, 0xbd, 0x25, 0xae, 0x03, 0xbd,
+  0xc3, 0x8b, 0xbc, 0xb9, 0xc5, 0x0a, 0xe2, 0xbd, 0x0d, 0x88, 0x05, 0xbd,
+  0x6b, 0xa3, 0x93, 0x3c, 0x8f, 0x41, 0x46, 0x3d, 0x92, 0x20, 0x3f, 0x3c,
+  0xce, 0xdb, 0x1a, 0xbe, 0x85, 0x58, 0xfc, 0x3b, 0x4a, 0xc5, 0xbf, 0xbd,
+  0x58, 0x8f, 0xa4, 0xbd, 0xdd, 0x0d, 0x03, 0xbd, 0xde, 0xf7, 0xc6, 0xbd,
+  0x97, 0x22, 0x43, 0x3d, 0x31, 0x1d, 0x3a, 0x3c, 0xaf, 0x15, 0x57, 0xbe,
+  0x06, 0x8c, 0xc4, 0xbc, 0x3e, 0x81, 0x26, 0xbe, 0x5c, 0xde, 0x35, 0xbd,
+  0xe1, 0x50, 0x45, 0xbe, 0x0d, 0xef, 0x41, 0xbe, 0x02, 0xd4, 0x06, 0xbe,
+  0xa7, 0x0b, 0x2f, 0xbe, 0x13, 0x51, 0x45, 0xbe, 0x88, 0x89, 0x9b, 0xbc,
+  0x71, 0x69, 0x24, 0xbe, 0xd3, 0xd2, 0x56, 0xbe, 0xbf, 0xea, 0xcb, 0xbd,
+  0x80, 0x69, 0xf2, 0xbd, 0x9e, 0x64, 0x86, 0xbd, 0xf8, 0x08, 0x0b, 0xbe,
+  0xb2, 0x52, 0x32, 0xbe, 0xe1, 0x53, 0x7c, 0xbd, 0x4c, 0x8f, 0x6f, 0xbe,
+  0x2e, 0x2f, 0x8d, 0xbd, 0xc3, 0x10, 0x99, 0xbc, 0x6e, 0x55, 0x6f, 0x3b,
+  0xce, 0xda, 0xea, 0xbd, 0xf3, 0x32, 0x6a, 0x3c, 0x1d, 0xc3, 0x57, 0xbd,
+  0x9c, 0xc2, 0x0e, 0xbb, 0x05, 0x99, 0x9a, 0xbd, 0x0e, 0xe6, 0xc3, 0xba,
+  0xd1, 0xe7, 0x7f, 0xbd, 0x0e, 0x33, 0x68, 0x3d, 0x75, 0x3e, 0x07, 0x3c,
+  0x6e, 0xe0, 0x37, 0xbd, 0xf7, 0x09, 0xa8, 0x3d, 0x6a, 0xfa, 0x7e, 0xbd,
+  0xee, 0xf8, 0x3a, 0xbd, 0x3d, 0x22, 0x68, 0x3d, 0x1a, 0xb9, 0xdf, 0xbd,
+  0x8c, 0xdc, 0x6d, 0xbc, 0xb4, 0xbf, 0x57, 0xbc, 0xeb, 0x7a, 0xac, 0xbd,
+  0xc1, 0x6e, 0x4b, 0xbb, 0x02, 0xe5, 0x96, 0xbd, 0xe3, 0x83, 0xf1, 0xbc,
+  0x99, 0x63, 0x1c, 0xbe, 0xda, 0x16, 0x9f, 0xbd, 0x9b, 0xa1, 0xb0, 0xbd,
+  0xbb, 0x21, 0x1f, 0xbe, 0xdb, 0x17, 0x72, 0xbd, 0xaf, 0x7a, 0x14, 0xbd,
+  0x88, 0x67, 0xfe, 0xbc, 0x33, 0x3f, 0xf1, 0xbd, 0x39, 0xb3, 0x19, 0xbd,
+  0xf7, 0xb5, 0x04, 0xbd, 0xc1, 0x2e, 0xbd, 0xbc, 0xc3, 0xb0, 0x16, 0xbd,
+  0x03, 0x07, 0xe6, 0x3c, 0x6b, 0x60, 0xf2, 0xbd, 0x6b, 0x4e, 0x39, 0xbd,
+  0x78, 0x1e, 0x16, 0xbd, 0x52, 0x30, 0x03, 0x3d, 0x6a, 0xa8, 0x80, 0xbd,
+  0xac, 0x0f, 0xa4, 0x3d, 0xeb, 0x11, 0x6c, 0x3d, 0xa1, 0x80, 0xa9, 0x3d,
+  0xa8, 0xee, 0x21, 0x3e, 0xa2, 0x4f, 0x5e, 0xbd, 0x7c, 0x3e, 0x0d, 0xbc,
+  0xa1, 0xde, 0x05, 0x3d, 0xfa, 0x94, 0x84, 0x3b, 0x8f, 0x5f, 0x61, 0x3d,
+  0x1a, 0xbe, 0x36, 0x3c, 0xce, 0x7b, 0x9c, 0x3c, 0x4a, 0x83, 0x1d, 0x3e,
+  0xca, 0xb3, 0x84, 0x3c, 0xed, 0x2d, 0x5f, 0x3d, 0xf0, 0x12, 0x4d, 0x3c,
+  0x93, 0x2d, 0x7b, 0xbc, 0x80, 0x24, 0xd3, 0x3d, 0x32, 0x6f, 0xce, 0x3d,
+  0xff, 0x3d, 0xbd, 0x3c, 0x0d, 0xe4, 0xba, 0x3d, 0xac, 0x90, 0xeb, 0x3d,
+  0xdf, 0xf3, 0x99, 0xbc, 0x9c, 0x20, 0xbe, 0x3d, 0x74, 0xb8, 0x42, 0x3d,
+  0xa9, 0xd0, 0x88, 0x3d, 0x1e, 0xa4, 0x8d, 0x3b, 0x3d, 0x3a, 0x92, 0x3b,
+  0x74, 0xa6, 0x10, 0x3d, 0x11, 0xbe, 0x18, 0x3e, 0x45, 0x6e, 0xdc, 0xbc,
+  0x31, 0x52, 0x91, 0x3d, 0x82, 0x14, 0xcf, 0xbc, 0xb5, 0x4b, 0xa1, 0x3d,
+  0xdf, 0x95, 0x67, 0x3c, 0xb0, 0x91, 0xd1, 0xbd, 0x81, 0x40, 0xc2, 0xbd,
+  0xda, 0xf2, 0x1d, 0x3d, 0x12, 0x6b, 0xb8, 0xbd, 0xfe, 0xf3, 0xe7, 0xbc,
+  0xf4, 0xbc, 0xad, 0xbb, 0x34, 0x18, 0xbc, 0x3b, 0x4b, 0x0b, 0x85, 0xbc,
+  0x8c, 0x98, 0x77, 0xbd, 0x5c, 0xf7, 0x44, 0xbe, 0xac, 0xb8, 0xcb, 0xbd,
+  0x26, 0x8f, 0x5d, 0xbd, 0x5d, 0x18, 0xf5, 0x3c, 0xc5, 0xfd, 0x1e, 0xbd,
+  0x19, 0x0b, 0x8b, 0xbc, 0x3c, 0x91, 0x9c, 0x3c, 0x4f, 0xc3, 0xce, 0xbd,
+  0x02, 0x5c, 0x09, 0xbe, 0x44, 0x30, 0x05, 0xbe, 0xf0, 0x28, 0x1b, 0xbe,
+  0x4b, 0xf0, 0x49, 0xbd, 0x28, 0x51, 0x3e, 0xbd, 0x54, 0xc1, 0xb7, 0xbd,
+  0x3a, 0x69, 0x39, 0xbc, 0x24, 0xe1, 0x23, 0xbd, 0x4f, 0xe7, 0x83, 0xbe,
+  0x49, 0xf5, 0x43, 0xbd, 0x0d, 0xc6, 0xe6, 0xbd, 0x38, 0xc9, 0x27, 0xbe,
+  0x41, 0x26, 0xe3, 0xbd, 0x02, 0x60, 0x73, 0xbe, 0x9c, 0x6c, 0x09, 0xbb,
+  0x72, 0x20, 0xda, 0xbd, 0x89, 0x2d, 0x46, 0xbe, 0x3f, 0x13, 0xbf, 0xbc,
+  0xed, 0x7c, 0x14, 0xbe, 0xc8, 0x6c, 0x31, 0xbe, 0xf3, 0x90, 0x25, 0xbd,
+  0x41, 0xbe, 0xfa, 0xbd, 0x91, 0x0f, 0xb6, 0xbd, 0x6d, 0x47, 0x0f, 0xbe,
+  0x62, 0x69, 0x97, 0xbd, 0x9f, 0xcc, 0xff, 0xbd, 0xb3, 0x02, 0x14, 0xbe,
+  0xdc, 0x5d, 0x3b, 0xbc, 0x7c, 0x26, 0x51, 0x3c, 0xe8, 0x48, 0x04, 0xbd,
+  0xf3, 0xa1, 0x1c, 0xbb, 0xcf, 0xb7, 0xb5, 0x3c, 0x6f, 0xfa, 0x9c, 0xbc,
+  0x1d, 0x78, 0xe5, 0xbd, 0xcc, 0xf5, 0x8a, 0x3c, 0x8e, 0xab, 0xf9, 0x3c,
+  0x41, 0x32, 0x1c, 0xbd, 0x85, 0xa8, 0xd5, 0x3b, 0xe8, 0xfd, 0xfb, 0xbc,
+  0xdf, 0x6b, 0x9a, 0x3d, 0x8c, 0x99, 0x14, 0xbc, 0xd5, 0x08, 0xb3, 0xbd,
+  0xc3, 0x8c, 0xc3, 0x3c, 0xe5, 0x85, 0xca, 0x3d, 0x34, 0xed, 0x9d, 0x3a,
+  0xb0, 0xc0, 0xee, 0x3b, 0x34, 0x5a, 0x10, 0xbc, 0x71, 0xc2, 0x82, 0xbd,
+  0xbc, 0x95, 0x84, 0xbc, 0xc6, 0x13, 0x7a, 0xbc, 0xed, 0x31, 0xa6, 0xbb,
+  0x83, 0xd4, 0x15, 0xbd, 0x89, 0x1a, 0xf3, 0xbc, 0x72, 0xe4, 0x2f, 0xbd,
+  0xea, 0xcf, 0x39, 0xbd, 0x4d, 0x66, 0x0a, 0x3d, 0x87, 0x01, 0x3c, 0x3d,
+  0x45, 0x71, 0x24, 0x3e, 0xa7, 0x4a, 0xc7, 0xbc, 0x2f, 0xbf, 0x73, 0xbd,
+  0x4e, 0x47, 0x1f, 0xbd, 0xe4, 0xc9, 0x17, 0xba, 0xed, 0xd7, 0xb0, 0x3d,
+  0x28, 0x43, 0xbc, 0x3c, 0x87, 0x1c, 0x5c, 0x3d, 0x54, 0x1b, 0x0f, 0x3e,
+  0x13, 0xa2, 0x8a, 0x3d, 0xd2, 0x18, 0x45, 0x3c, 0x85, 0x11, 0x78, 0x3c,
+  0xc5, 0xe5, 0xed, 0xbb, 0xe2, 0x3e, 0x67, 0x3b, 0x15, 0xfa, 0x59, 0xbd,
+  0xb8, 0x19, 0x2d, 0x3d, 0xd7, 0x12, 0x06, 0x3e, 0x73, 0xf2, 0xbc, 0xbb,
+  0xe0, 0x3b, 0x09, 0x3d, 0xe3, 0x2a, 0x0f, 0x3c, 0x67, 0x5e, 0x92, 0x3d,
+  0xb1, 0xb8, 0xe7, 0x3c, 0xc7, 0x02, 0x9d, 0xbd, 0xab, 0xfa, 0x2c, 0xbd,
+  0x51, 0xb9, 0x46, 0x3c, 0x14, 0xf9, 0xbb, 0x3c, 0x66, 0x1e, 0x7f, 0x3d,
+  0x9d, 0x53, 0x80, 0x3b, 0x26, 0x0a, 0x93, 0x3d, 0x2b, 0x0c, 0x2b, 0x3d,
+  0x62, 0x5b, 0x49, 0xbd, 0xeb, 0x9d, 0x5b, 0x3d, 0x3e, 0x32, 0x8f, 0xba,
+  0xc0, 0xe8, 0x49, 0x3c, 0x0c, 0x63, 0xe0, 0x3c, 0x82, 0xe5, 0x0b, 0xbe,
+  0xc1, 0x49, 0xa5, 0x3d, 0x73, 0xab, 0xfb, 0xbc, 0x85, 0xf2, 0x02, 0xbe,
+  0xe3, 0xd0, 0x2a, 0xbd, 0xae, 0x59, 0xc3, 0x3d, 0x68, 0xc9, 0x53, 0x3d,
+  0xda, 0x0d, 0x16, 0x3d, 0x37, 0x84, 0x8d, 0xbd, 0xe4, 0x22, 0x2d, 0x3b,
+  0x44, 0x5b, 0x06, 0x3d, 0xb4, 0x70, 0xe7, 0xbd, 0x0e, 0x0c, 0x22, 0xbd,
+  0x07, 0x43, 0xe3, 0xbd, 0x42, 0xc3, 0xcd, 0xbd, 0x49, 0x36, 0x41, 0x3d,
+  0x2c, 0x94, 0x97, 0xbd, 0xb8, 0xcd, 0xda, 0x3c, 0x85, 0x80, 0xe0, 0x3c,
+  0x2e, 0x7e, 0x91, 0xb9, 0x65, 0x73, 0x7c, 0xbe, 0x71, 0xf3, 0x62, 0xbe,
+  0x06, 0x0f, 0xe5, 0xbd, 0x53, 0x01, 0x58, 0x3d, 0x76, 0xa1, 0x5f, 0xbe,
+  0xd0, 0xbe, 0xe8, 0xbd, 0xf8, 0xdd, 0x74, 0xbd, 0x38, 0xa3, 0x91, 0xbd,
+  0x7f, 0x93, 0x2a, 0xbe, 0x2e, 0xa1, 0xb0, 0xbd, 0xce, 0x0b, 0x83, 0xbd,
+  0xfb, 0xe5, 0x3d, 0xbe, 0x2e, 0x2c, 0x14, 0xbe, 0xa9, 0x72, 0x5f, 0xbe,
+  0xfd, 0xe8, 0x0a, 0xbe, 0x6a, 0x87, 0xe0, 0xbd, 0x41, 0x32, 0x25, 0xbe,
+  0x09, 0xb4, 0xdb, 0xbd, 0x0e, 0x89, 0xe6, 0xbd, 0xe5, 0x14, 0x23, 0xbe,
+  0x62, 0x13, 0xb9, 0xbd, 0xce, 0xc4, 0x6c, 0xbb, 0x77, 0xf8, 0xb4, 0x3d,
+  0xdf, 0x9a, 0x7f, 0x3b, 0xe3, 0xac, 0x82, 0xbd, 0x98, 0xa2, 0x84, 0xbd,
+  0xb1, 0xec, 0x01, 0xbc, 0x90, 0x38, 0x0d, 0xbd, 0x06, 0xce, 0x06, 0xbd,
+  0x9c, 0x12, 0x80, 0x3b, 0x3d, 0x64, 0x67, 0xbd, 0x6f, 0x20, 0x3a, 0x3d,
+  0x5f, 0xda, 0x93, 0x3d, 0x13, 0xcb, 0x99, 0xbc, 0x53, 0x93, 0xb7, 0x3c,
+  0x25, 0x93, 0x8d, 0x3d, 0x5a, 0xad, 0x80, 0xbd, 0xf7, 0x1c, 0x32, 0xbd,
+  0xc8, 0x9c, 0x1f, 0x3d, 0x21, 0x77, 0x97, 0xbd, 0x4d, 0x16, 0x56, 0x3d,
+  0x11, 0x79, 0x00, 0x3e, 0x36, 0xee, 0x2f, 0x3d, 0x48, 0x32, 0x69, 0x3c,
+  0x27, 0xcf, 0xde, 0x3c, 0xc0, 0x81, 0xb4, 0xbd, 0x8a, 0x04, 0x44, 0xbd,
+  0x31, 0x57, 0xf9, 0xbd, 0x56, 0x69, 0xcb, 0x3c, 0xd5, 0xe0, 0x74, 0x3e,
+  0x1d, 0xd4, 0xac, 0xbd, 0x2e, 0x53, 0x77, 0xbd, 0xd4, 0x0a, 0x0e, 0x3d,
+  0x4b, 0x57, 0x2b, 0x3d, 0x33, 0x98, 0x7c, 0x3c, 0xb6, 0x34, 0xda, 0x3c,
+  0x33, 0xe4, 0x64, 0xbd, 0xbd, 0x14, 0x11, 0x3d, 0x17, 0xd8, 0x76, 0xbd,
+  0x10, 0xb0, 0xde, 0xba, 0x03, 0xd8, 0x65, 0x3d, 0x0b, 0x4f, 0x50, 0xbd,
+  0xc3, 0x6a, 0x95, 0x3d, 0xb2, 0x45, 0x1d, 0xbd, 0x94, 0x4f, 0xd5, 0xbc,
+  0x75, 0x99, 0x23, 0x3d, 0xc9, 0xda, 0x69, 0xbd, 0xf2, 0x60, 0x09, 0x3d,
+  0x37, 0x4c, 0xfe, 0xbb, 0xb0, 0xcb, 0x0b, 0x3d, 0x64, 0x80, 0x4d, 0xbd,
+  0xb6, 0x68, 0x9e, 0xbd, 0x1a, 0x41, 0x0a, 0x3d, 0x90, 0x69, 0x19, 0x3e,
+  0x62, 0x8c, 0x87, 0xbb, 0x1a, 0xd2, 0x89, 0x3c, 0x26, 0xab, 0x3d, 0xbd,
+  0x69, 0x5e, 0xcb, 0xbc, 0x57, 0x98, 0x90, 0xbd, 0x31, 0x36, 0xf0, 0xbc,
+  0xfe, 0x36, 0x1a, 0xbc, 0x0b, 0x50, 0xe3, 0x3c, 0x45, 0x71, 0xc6, 0xbd,
+  0x1e, 0x09, 0x99, 0xbb, 0x08, 0x51, 0x2a, 0xbe, 0xe0, 0x49, 0x8d, 0x3c,
+  0x65, 0x8a, 0x91, 0xbd, 0x1d, 0x9a, 0x93, 0x3a, 0x44, 0x29, 0x8e, 0xbd,
+  0x80, 0x8e, 0x82, 0x3c, 0xdb, 0x24, 0x68, 0xbd, 0x77, 0x08, 0xa5, 0xbd,
+  0xc8, 0xc4, 0x12, 0xbe, 0x63, 0xca, 0xe4, 0xbc, 0x03, 0xb8, 0x47, 0xbd,
+  0xc5, 0x34, 0xd2, 0x3b, 0xed, 0x36, 0xef, 0xbd, 0xb8, 0xce, 0xe2, 0xbd,
+  0xbd, 0x2c, 0xc3, 0xbd, 0x89, 0x7f, 0x4a, 0xbd, 0x28, 0x94, 0x53, 0xbe,
+  0x23, 0x93, 0x40, 0x3d, 0x80, 0x8d, 0x80, 0x3d, 0x31, 0xea, 0x59, 0x3c,
+  0x5a, 0x4e, 0x0e, 0xbe, 0xfb, 0xf5, 0xc3, 0xbe, 0x9b, 0x18, 0x96, 0xbd,
+  0xb1, 0xdc, 0xbd, 0x3c, 0x89, 0xb9, 0x40, 0xbe, 0x75, 0xff, 0xe2, 0xbd,
+  0x2a, 0x59, 0x5b, 0x3d, 0x69, 0x7b, 0xa0, 0xbd, 0x30, 0x6f, 0x91, 0xbd,
+  0x81, 0x91, 0x14, 0xbe, 0x04, 0x89, 0xe5, 0xbc, 0x5d, 0x5f, 0xc3, 0xbc,
+  0xcf, 0xec, 0xfe, 0xbd, 0xf6, 0x76, 0x5f, 0xbe, 0xa5, 0x95, 0x92, 0xbe,
+  0x9d, 0x1d, 0x22, 0xbe, 0x57, 0x40, 0x46, 0xbe, 0x83, 0x89, 0xaa, 0xbd,
+  0x91, 0x5d, 0x1b, 0xbe, 0xa0, 0xc7, 0x5a, 0xbe, 0xcf, 0x3f, 0x14, 0xbe,
+  0x0e, 0x24, 0x9f, 0xbd, 0x37, 0x79, 0xc1, 0xbc, 0x57, 0x64, 0x78, 0x3c,
+  0x8d, 0x55, 0x3d, 0xbc, 0x59, 0xf4, 0x34, 0x3c, 0x7c, 0x6e, 0x4c, 0x3a,
+  0x3b, 0x08, 0x84, 0xbd, 0x2b, 0x92, 0x27, 0x3d, 0x01, 0x15, 0x3b, 0x3d,
+  0x33, 0x51, 0xae, 0x3d, 0x11, 0x20, 0x80, 0xbd, 0x21, 0x17, 0x28, 0x3d,
+  0x65, 0x71, 0xec, 0x3d, 0x98, 0x89, 0x8a, 0x3d, 0x97, 0x46, 0x27, 0xbd,
+  0x0f, 0xbe, 0xf5, 0x3d, 0xe7, 0x7c, 0xd0, 0xbd, 0x85, 0x54, 0x60, 0xbc,
+  0xbd, 0x4d, 0xe9, 0xbd, 0x57, 0xfa, 0xd7, 0x3c, 0x8e, 0xd2, 0x0d, 0x3e,
+  0x94, 0x8f, 0xa4, 0xbd, 0xf6, 0x71, 0xce, 0xbd, 0xe6, 0x29, 0x3d, 0x3e,
+  0xb8, 0xfe, 0x54, 0xbe, 0x82, 0xd8, 0x8e, 0xbc, 0xb9, 0x37, 0xd3, 0xbd,
+  0xc9, 0xf7, 0xda, 0xbc, 0x75, 0xa0, 0x9e, 0x3e, 0xa1, 0x99, 0x56, 0xbd,
+  0xbf, 0xd8, 0xaa, 0xbd, 0x98, 0x46, 0xcd, 0xbd, 0x1f, 0x99, 0x27, 0xbe,
+  0x50, 0xc7, 0xc4, 0xbd, 0xa2, 0x3f, 0xd5, 0xbd, 0x03, 0xe5, 0x13, 0x3d,
+  0x1f, 0x25, 0x6a, 0x3e, 0xb3, 0x39, 0x03, 0xbb, 0xf3, 0x60, 0xbe, 0xbd,
+  0xa0, 0x4d, 0x26, 0xbe, 0xae, 0xc5, 0x12, 0xbe, 0x15, 0x9f, 0xd1, 0xbb,
+  0x27, 0x2f, 0xc1, 0xbd, 0x58, 0xe2, 0x20, 0x3d, 0x1b, 0x1b, 0x0f, 0x3e,
+  0x6c, 0x1f, 0x9a, 0xbc, 0x31, 0xae, 0xa2, 0xbc, 0xa4, 0xb6, 0x14, 0xbe,
+  0x59, 0xbd, 0xb0, 0xbd, 0xbd, 0x91, 0xf4, 0xbd, 0xfa, 0xea, 0xbf, 0xbd,
+  0x35, 0xa4, 0xac, 0x3c, 0xb2, 0x60, 0x34, 0x3e, 0x39, 0xaf, 0xa4, 0xbd,
+  0x77, 0x60, 0x5d, 0xbd, 0x4e, 0x89, 0x03, 0xbe, 0xb0, 0x32, 0x24, 0x3b,
+  0x5f, 0x48, 0x6c, 0xbd, 0xb4, 0xa5, 0x97, 0xbc, 0x33, 0x0f, 0x88, 0xbd,
+  0xbc, 0x6d, 0xb8, 0x3d, 0x5c, 0xe6, 0x99, 0xbd, 0xf3, 0x9a, 0x69, 0x3c,
+  0xcc, 0x92, 0x1c, 0xbe, 0x31, 0x7b, 0x28, 0xbc, 0xa7, 0x07, 0x73, 0xbd,
+  0x14, 0x60, 0x4d, 0x3d, 0x20, 0x6e, 0xe9, 0xbc, 0x03, 0xbb, 0x2c, 0xbd,
+  0xf9, 0x93, 0x8b, 0x39, 0xe9, 0x9e, 0x41, 0xbd, 0x06, 0x98, 0x60, 0xbe,
+  0xb0, 0x27, 0x31, 0x3d, 0x26, 0xde, 0xa1, 0x3c, 0xc7, 0x68, 0x63, 0x3d,
+  0x6d, 0x68, 0x91, 0xbd, 0x66, 0xc5, 0x6d, 0xbe, 0xe4, 0xdc, 0x6a, 0x3d,
+  0x5e, 0x4b, 0xbe, 0x3d, 0x29, 0x86, 0x84, 0xbe, 0x44, 0xab, 0x3c, 0xbb,
+  0x4b, 0x48, 0x77, 0x3a, 0x4f, 0xf0, 0xaa, 0x3b, 0x25, 0x28, 0x83, 0xbd,
+  0x48, 0x4a, 0x8a, 0xbe, 0xee, 0x06, 0xc9, 0x3c, 0x46, 0x82, 0xc0, 0xbc,
+  0xfc, 0xc6, 0x39, 0xbe, 0xc3, 0x9c, 0xbd, 0xba, 0x9a, 0x82, 0x0f, 0xbd,
+  0x5e, 0x10, 0xff, 0xbb, 0x45, 0x89, 0xc0, 0xbd, 0x10, 0x99, 0x26, 0xbe,
+  0x82, 0x75, 0x46, 0xbd, 0xdb, 0x1a, 0x82, 0xbc, 0x08, 0x0f, 0x83, 0xbc,
+  0x56, 0xa7, 0x13, 0xbe, 0xdf, 0xf2, 0x0a, 0xbe, 0x67, 0x21, 0xd2, 0xbc,
+  0x77, 0x28, 0x7a, 0xbe, 0x7a, 0xec, 0x03, 0xbd, 0xe7, 0x1e, 0xd4, 0xbd,
+  0xc5, 0xc9, 0x48, 0xbd, 0x91, 0x95, 0x6c, 0xbd, 0xe3, 0xef, 0x6c, 0xbd,
+  0xc2, 0xdb, 0x85, 0xbc, 0x3b, 0x4b, 0x84, 0xbd, 0x6c, 0xbd, 0x65, 0xbd,
+  0xe0, 0x53, 0xdd, 0xbd, 0x2d, 0x87, 0x4f, 0xbb, 0x3a, 0xc6, 0xc6, 0xbd,
+  0xc6, 0xf2, 0x4c, 0xbd, 0xc3, 0xeb, 0x00, 0xbe, 0x0c, 0x49, 0x4c, 0x3d,
+  0x8e, 0x64, 0xe5, 0xbc, 0xbb, 0x89, 0xc8, 0x3d, 0xb0, 0x4f, 0x46, 0x3e,
+  0x40, 0xc7, 0xdb, 0xbc, 0xa4, 0x1b, 0x01, 0xbe, 0x6a, 0xe3, 0x14, 0x3e,
+  0xdb, 0xff, 0x06, 0xbe, 0x7e, 0xe1, 0x18, 0xbe, 0xf6, 0xf6, 0xca, 0xbd,
+  0x8e, 0x8b, 0x30, 0x3e, 0x54, 0xc6, 0xb7, 0x3e, 0x75, 0x18, 0xa2, 0xbd,
+  0x9c, 0x03, 0x6c, 0xbe, 0xf1, 0xde, 0xae, 0x3e, 0x5f, 0x75, 0x9d, 0xbe,
+  0x1f, 0x51, 0xa1, 0xbd, 0x45, 0x91, 0x09, 0xbe, 0xe4, 0xda, 0x09, 0x3d,
+  0xf2, 0x16, 0xe1, 0x3e, 0x6f, 0xac, 0x09, 0xbe, 0x4f, 0xa0, 0x44, 0xbe,
+  0xbe, 0x48, 0x58, 0x3e, 0x85, 0x20, 0x77, 0xbe, 0xa3, 0x05, 0x22, 0xbe,
+  0x41, 0xbc, 0x48, 0xbe, 0xef, 0xb2, 0x9b, 0x3d, 0x67, 0x11, 0xb1, 0x3e,
+  0xf6, 0xdf, 0x06, 0xbe, 0x83, 0x6b, 0x1c, 0xbe, 0x16, 0xfd, 0x0b, 0x3e,
+  0x3f, 0xc8, 0xff, 0xbd, 0xa7, 0x97, 0x5e, 0xbe, 0xcb, 0x2c, 0x57, 0xbe,
+  0x51, 0x0c, 0x50, 0xbb, 0xde, 0xc8, 0x95, 0x3e, 0xf8, 0x2a, 0x34, 0xbe,
+  0xcc, 0xf5, 0x66, 0xbe, 0x75, 0xc0, 0xc8, 0x3d, 0xc4, 0x64, 0x6f, 0xbe,
+  0x6f, 0x36, 0x42, 0xbe, 0x35, 0xe2, 0x2f, 0xbe, 0x0e, 0x23, 0xa7, 0xbd,
+  0x6e, 0x61, 0x15, 0x3e, 0x63, 0xfc, 0xe2, 0xbd, 0xf3, 0x7d, 0x10, 0xbe,
+  0xb3, 0x21, 0x2d, 0xbe, 0x34, 0x71, 0x2a, 0xbe, 0x5d, 0x1f, 0x06, 0xbe,
+  0x7c, 0x6b, 0xd8, 0xbd, 0x5d, 0x5d, 0xa1, 0xbd, 0x6f, 0x74, 0x4c, 0x3d,
+  0x57, 0xab, 0x07, 0xbe, 0xc7, 0x3f, 0xf9, 0xbd, 0x89, 0xf8, 0xa3, 0xbe,
+  0x1c, 0x03, 0x53, 0xbd, 0x48, 0x11, 0xb2, 0xbc, 0x0d, 0x4e, 0x05, 0x3d,
+  0x0c, 0xa7, 0x2f, 0xbe, 0x78, 0x85, 0x50, 0xbe, 0x42, 0x48, 0x1a, 0x3d,
+  0xae, 0x33, 0xdc, 0x3b, 0xc0, 0x90, 0x98, 0xbe, 0x11, 0x61, 0x7d, 0xbd,
+  0x3d, 0x27, 0x51, 0x3d, 0xf6, 0xfb, 0x47, 0x3d, 0x2e, 0x57, 0x37, 0xbd,
+  0xcc, 0x74, 0x95, 0xbe, 0xcd, 0x42, 0xc0, 0x3b, 0x1f, 0xa2, 0xa6, 0x3d,
+  0x1e, 0xbe, 0x6f, 0xbe, 0x62, 0x55, 0x3f, 0xbd, 0xc6, 0x89, 0xf0, 0xb7,
+  0x0f, 0x19, 0x8e, 0x39, 0xfa, 0xbb, 0x08, 0x3d, 0x02, 0xa2, 0x6b, 0xbe,
+  0x5a, 0xf3, 0xa0, 0x3b, 0xa0, 0x98, 0x86, 0x3c, 0x89, 0x3c, 0x10, 0x3d,
+  0xcd, 0xdd, 0xf0, 0xbd, 0x4f, 0xdb, 0xcf, 0xbc, 0x55, 0xff, 0x8a, 0x3d,
+  0x09, 0x15, 0x22, 0x3d, 0x5b, 0x95, 0x6a, 0xbc, 0x5e, 0xe6, 0x45, 0x3d,
+  0x17, 0xca, 0x69, 0xbc, 0x97, 0x3c, 0x57, 0x3e, 0x04, 0xdd, 0xe5, 0x3d,
+  0x86, 0xd0, 0xbd, 0x3d, 0x3a, 0x16, 0x6a, 0x3e, 0xb1, 0x03, 0x3b, 0x3d,
+  0x16, 0xf0, 0xff, 0xbd, 0x75, 0x57, 0xe4, 0x3d, 0x85, 0x21, 0x30, 0x3e,
+  0x77, 0x37, 0xcc, 0x3b, 0xd6, 0xbb, 0xb8, 0x3c, 0x32, 0x45, 0x2f, 0xbe,
+  0xc3, 0xff, 0xdf, 0xbd, 0x01, 0xa6, 0xb3, 0xbd, 0x2c, 0x83, 0xdd, 0xbb,
+  0x89, 0x00, 0x19, 0xbe, 0x4f, 0xc2, 0x85, 0xbd, 0xaf, 0xd9, 0x31, 0x3e,
+  0x8b, 0x4c, 0x62, 0xbd, 0x88, 0x03, 0x31, 0xbe, 0x2e, 0x61, 0x36, 0xbe,
+  0x7f, 0x63, 0x81, 0xbd, 0x5b, 0x2a, 0xe2, 0x3d, 0xd1, 0x86, 0x38, 0xbe,
+  0x1a, 0x6c, 0x3d, 0xbe, 0x2e, 0xa5, 0xf8, 0x3e, 0xb0, 0xa2, 0xd4, 0xbd,
+  0xfa, 0xfe, 0x32, 0xbe, 0xdd, 0xa3, 0x23, 0xbe, 0x7a, 0xc2, 0xcb, 0xbd,
+  0x06, 0xb6, 0x56, 0x3e, 0xc4, 0x58, 0x14, 0xbe, 0x84, 0x07, 0x25, 0xbe,
+  0x92, 0x5d, 0xe6, 0x3e, 0x48, 0x67, 0x38, 0xbe, 0x35, 0x46, 0xbd, 0xbd,
+  0x07, 0x72, 0x93, 0xbd, 0x6d, 0x0a, 0x1c, 0xbd, 0xee, 0xb8, 0x20, 0x3e,
+  0x38, 0x81, 0x92, 0xbc, 0xce, 0xd7, 0xd7, 0xbd, 0x5e, 0x41, 0x91, 0x3e,
+  0x5e, 0x5e, 0x0e, 0xbe, 0xf4, 0x2f, 0xd1, 0xbd, 0x6f, 0x85, 0x2f, 0xbd,
+  0xdf, 0x29, 0xb0, 0xbd, 0x52, 0xef, 0xe6, 0x3d, 0xd1, 0xed, 0xec, 0xbc,
+  0x61, 0xf4, 0xdc, 0xbd, 0x04, 0x20, 0x96, 0x3e, 0x27, 0xc9, 0x8d, 0xbd,
+  0x2b, 0x28, 0xe5, 0xbd, 0x64, 0xc8, 0x0a, 0xbd, 0x87, 0x55, 0x71, 0xbd,
+  0x47, 0x63, 0xc4, 0x3c, 0x3e, 0x56, 0xcd, 0xbd, 0x28, 0xfd, 0xc5, 0xbd,
+  0x34, 0x31, 0x0d, 0x3e, 0x4a, 0x80, 0x22, 0xbd, 0xb8, 0xf2, 0x81, 0xbd,
+  0xa6, 0xc7, 0x1d, 0xbc, 0xdf, 0xb9, 0xe5, 0xbc, 0x88, 0x1a, 0x08, 0xbe,
+  0x09, 0x97, 0x7c, 0xbd, 0xed, 0xcd, 0x22, 0xbc, 0xda, 0x1b, 0xb4, 0x3c,
+  0x8c, 0xc5, 0x1c, 0xbe, 0xc9, 0xe8, 0xb5, 0xbd, 0x23, 0x00, 0x77, 0xbd,
+  0x1c, 0xea, 0xbb, 0xbd, 0x2c, 0xe9, 0x82, 0xbe, 0xc9, 0x69, 0xd1, 0xbd,
+  0x3c, 0xc8, 0x60, 0xbd, 0xa8, 0xd0, 0x32, 0xbd, 0xf1, 0x30, 0x19, 0xbe,
+  0x50, 0x57, 0x9e, 0x3c, 0xbc, 0x83, 0x02, 0x3c, 0xa6, 0xea, 0x79, 0xbd,
+  0x04, 0x1d, 0x66, 0xbe, 0xd6, 0xec, 0x51, 0xbd, 0x16, 0xf9, 0xb4, 0xbd,
+  0xff, 0x0f, 0x54, 0xbe, 0x11, 0x9a, 0x31, 0xbe, 0xdd, 0x3d, 0x78, 0xbd,
+  0xa3, 0x9d, 0x22, 0x3d, 0x08, 0x6f, 0x37, 0x3c, 0xd2, 0x24, 0x71, 0xbe,
+  0x36, 0xf9, 0x97, 0x3d, 0x2f, 0xde, 0x8b, 0x3c, 0x26, 0xb7, 0x53, 0xbd,
+  0xb9, 0x87, 0xeb, 0xbd, 0x60, 0xb0, 0x3a, 0xb6, 0xd4, 0x00, 0x17, 0xbd,
+  0x48, 0xfd, 0xaf, 0x3d, 0xfe, 0xe0, 0x4e, 0xbd, 0x70, 0x09, 0xee, 0x3c,
+  0x28, 0x8d, 0xb0, 0xbd, 0xab, 0x0c, 0x3c, 0x3e, 0xe8, 0xf1, 0x20, 0xbd,
+  0xbd, 0x0d, 0x12, 0xbd, 0x44, 0xe4, 0x3a, 0xbd, 0x71, 0xa8, 0x1d, 0x3e,
+  0x9c, 0xa0, 0x0c, 0x3e, 0x6c, 0x6a, 0x98, 0x3d, 0x33, 0xf5, 0xf4, 0xbc,
+  0xa9, 0x00, 0x33, 0x3e, 0x47, 0x4b, 0x1e, 0x3e, 0x3f, 0x89, 0x1f, 0x3e,
+  0x12, 0xd4, 0x45, 0x3e, 0x52, 0x5d, 0x48, 0x3e, 0x48, 0x6f, 0x31, 0x3d,
+  0x81, 0xe0, 0x47, 0x3e, 0x2b, 0x20, 0x68, 0x3e, 0xa3, 0xa6, 0x51, 0xbd,
+  0xee, 0x1f, 0xc0, 0x3d, 0x36, 0xfc, 0x3a, 0x3c, 0xff, 0x90, 0xf0, 0x3c,
+  0xc4, 0x55, 0x14, 0xbe, 0x1e, 0x0d, 0x61, 0xbd, 0x10, 0x38, 0xb3, 0xbc,
+  0xde, 0x7a, 0xcb, 0x3d, 0x7f, 0x97, 0x65, 0x3d, 0x22, 0x3f, 0xd5, 0x3c,
+  0xdd, 0x10, 0x0f, 0xbd, 0x65, 0x48, 0x1c, 0x3c, 0x8e, 0x8d, 0x23, 0xbe,
+  0xf1, 0xd9, 0x22, 0xbe, 0xbc, 0x5a, 0xfa, 0xbc, 0x9b, 0x5f, 0x02, 0x3d,
+  0x61, 0xe3, 0x36, 0x3e, 0xa2, 0x4c, 0x61, 0xbd, 0xea, 0x03, 0x15, 0x3b,
+  0x63, 0xb7, 0xa8, 0x3c, 0xe5, 0x82, 0x8f, 0xbd, 0x83, 0xa1, 0x76, 0xbe,
+  0x10, 0x0a, 0x4c, 0x3d, 0x62, 0x04, 0x7d, 0x3c, 0x55, 0x33, 0xf5, 0x3d,
+  0x1c, 0xf8, 0x0a, 0xbe, 0xaf, 0xea, 0xe1, 0xbc, 0xc0, 0xb7, 0x9b, 0xbc,
+  0x8f, 0x5c, 0xb2, 0xbc, 0xfb, 0xcf, 0x60, 0xbe, 0x20, 0x72, 0x23, 0x3d,
+  0x34, 0x48, 0x5b, 0xbd, 0x95, 0x9e, 0xc5, 0x3d, 0x62, 0x49, 0x08, 0xbd,
+  0x3c, 0xc8, 0xbc, 0xbd, 0x81, 0x0c, 0xe7, 0x3d, 0x35, 0xe5, 0xd4, 0xbc,
+  0x87, 0x98, 0x8c, 0xbe, 0x1b, 0x68, 0x53, 0x3d, 0xc9, 0x45, 0x1a, 0xbd,
+  0x7f, 0x4a, 0x26, 0x3e, 0x9b, 0xd0, 0x35, 0x3d, 0xca, 0x61, 0x21, 0x3c,
+  0x6d, 0xb8, 0xd6, 0x3d, 0x60, 0xa2, 0x7c, 0x3c, 0x1c, 0x16, 0x83, 0xbe,
+  0xc9, 0xfb, 0x6e, 0x3d, 0x50, 0xbb, 0xcc, 0x3d, 0x1a, 0xdb, 0xa2, 0x3d,
+  0x45, 0x9e, 0x8b, 0xbb, 0x98, 0x3c, 0xb6, 0x3c, 0x93, 0x3b, 0xe9, 0x3d,
+  0x64, 0x77, 0xce, 0x3d, 0x82, 0xc0, 0x64, 0xbe, 0x5e, 0x9d, 0xf7, 0x3c,
+  0x05, 0x1a, 0xf9, 0x3c, 0x1f, 0x5e, 0x1b, 0x3d, 0xa4, 0x81, 0x98, 0xbd,
+  0xec, 0xa0, 0xa8, 0x3c, 0xfb, 0xe6, 0x5e, 0xbd, 0xb3, 0xdc, 0x73, 0x3b,
+  0x56, 0x86, 0x67, 0xbe, 0xae, 0x2e, 0x20, 0xbd, 0x29, 0x86, 0x2e, 0xbd,
+  0x96, 0x3b, 0x0d, 0xbd, 0x32, 0xc6, 0xaf, 0xbd, 0x07, 0xb5, 0xcb, 0xbd,
+  0x57, 0x07, 0x83, 0x3d, 0x5d, 0x1e, 0xbd, 0x3c, 0xf1, 0xef, 0x8a, 0xbe,
+  0xbe, 0x55, 0x3c, 0xbd, 0xc6, 0x24, 0x4a, 0xbc, 0x0a, 0xaa, 0x4a, 0x3c,
+  0x7b, 0x51, 0xc6, 0xbd, 0x8a, 0x72, 0xa8, 0xbd, 0xc5, 0xd3, 0x32, 0x3d,
+  0xfa, 0xd2, 0x08, 0x3d, 0x8f, 0x35, 0x97, 0xbd, 0x91, 0x38, 0x3b, 0xbb,
+  0xff, 0x57, 0x02, 0xbd, 0xf2, 0xa5, 0x75, 0x3e, 0x9f, 0xfe, 0xbc, 0xbd,
+  0x68, 0x0c, 0x99, 0xbd, 0xdd, 0xfa, 0xb1, 0xbd, 0xf2, 0xdb, 0xac, 0x3c,
+  0xdf, 0xfb, 0x41, 0x3e, 0x06, 0xa3, 0x39, 0x3d, 0x20, 0x9c, 0xd1, 0x3a,
+  0x03, 0x0d, 0x47, 0x3e, 0x95, 0xb0, 0xeb, 0xbc, 0xac, 0x75, 0x88, 0xbd,
+  0x1c, 0x51, 0x5c, 0xbd, 0x29, 0xa7, 0x11, 0x3e, 0xdc, 0xf0, 0x98, 0x3e,
+  0xf2, 0x22, 0x19, 0x3d, 0xcd, 0x3f, 0x24, 0x3d, 0x31, 0x29, 0x67, 0x3e,
+  0x8d, 0x4e, 0x66, 0x3e, 0xce, 0x97, 0xad, 0x3d, 0x4e, 0x4c, 0x63, 0x3e,
+  0xb6, 0xe0, 0x39, 0x3e, 0x75, 0xbd, 0x86, 0x3d, 0x9b, 0x6c, 0x07, 0x3e,
+  0x43, 0xf6, 0x68, 0x3e, 0x9b, 0x92, 0x3d, 0xbb, 0x7a, 0x1e, 0x95, 0x3c,
+  0xbf, 0x65, 0x99, 0x3d, 0xde, 0x68, 0x1f, 0x3d, 0xee, 0x76, 0x0e, 0x3e,
+  0x4e, 0x51, 0x4a, 0xbc, 0xcf, 0x76, 0xf1, 0x3c, 0xe5, 0x54, 0x8c, 0x3c,
+  0x3d, 0x8c, 0x74, 0xbd, 0x2d, 0x5c, 0xc3, 0x3d, 0x00, 0x99, 0x11, 0xbd,
+  0xc3, 0x4c, 0x59, 0x3d, 0x9d, 0xc6, 0x23, 0x3d, 0x29, 0xad, 0x9e, 0xbd,
+  0x52, 0x19, 0x8f, 0x3d, 0x57, 0x64, 0x93, 0x3d, 0x08, 0xb2, 0xe5, 0xbc,
+  0xda, 0x63, 0x90, 0x3d, 0x3e, 0x23, 0x24, 0xbd, 0xaf, 0x29, 0xd0, 0x3c,
+  0xaf, 0xee, 0xcd, 0x3d, 0xd6, 0x4e, 0x74, 0xbe, 0x48, 0x27, 0x61, 0x3d,
+  0xb9, 0x22, 0xdb, 0x3d, 0x86, 0x51, 0x00, 0x3e, 0xaf, 0xdb, 0x63, 0xbd,
+  0x8b, 0x5e, 0xb2, 0x3d, 0x47, 0x5f, 0xb7, 0x3c, 0x60, 0x54, 0x91, 0x3d,
+  0x33, 0x43, 0x72, 0xbe, 0xd8, 0x83, 0xb0, 0x3d, 0x51, 0xd1, 0xc7, 0x3b,
+  0x92, 0x64, 0x08, 0xbd, 0x62, 0x3c, 0x88, 0xbd, 0x42, 0x12, 0xe3, 0xbb,
+  0x56, 0x99, 0xbd, 0x3d, 0x76, 0xf7, 0x30, 0x3d, 0x7a, 0xeb, 0x93, 0xbe,
+  0x12, 0x95, 0xe8, 0x3d, 0xef, 0xdd, 0x25, 0x3d, 0xee, 0xa6, 0x38, 0xbd,
+  0xb3, 0x2f, 0x50, 0x3d, 0x69, 0xf3, 0xd5, 0x3d, 0x2f, 0x10, 0x36, 0x3e,
+  0x06, 0x9d, 0x28, 0x3d, 0x29, 0xab, 0x60, 0xbe, 0x1d, 0xc7, 0xcf, 0x3d,
+  0x9e, 0x48, 0x8d, 0x3d, 0x90, 0xf3, 0xb9, 0xbb, 0xf8, 0x57, 0x9d, 0x3d,
+  0x55, 0x4e, 0xbe, 0x3c, 0x2b, 0x4c, 0x96, 0x3d, 0x4e, 0x7e, 0xf5, 0x3d,
+  0xb7, 0xd7, 0x03, 0xbd, 0x0d, 0x3e, 0xb0, 0x3d, 0xaa, 0x73, 0xa2, 0xbc,
+  0x6a, 0x0c, 0x90, 0x3d, 0xf4, 0xc8, 0xb5, 0xbc, 0xa3, 0x16, 0x7c, 0xbd,
+  0x61, 0x5d, 0x05, 0x3d, 0x63, 0x96, 0xd3, 0xbc, 0xbb, 0x32, 0x0f, 0xbe,
+  0x28, 0x8a, 0x5a, 0xbc, 0xbf, 0x0f, 0x97, 0xbd, 0x25, 0x17, 0xd3, 0x3b,
+  0x31, 0x63, 0xc4, 0xbc, 0x17, 0x10, 0x54, 0xbc, 0xdf, 0x19, 0x13, 0x3c,
+  0x70, 0x3f, 0xe1, 0xbb, 0xa2, 0x77, 0xd2, 0xbd, 0x85, 0x24, 0xd0, 0xbd,
+  0x80, 0x68, 0x8a, 0xbc, 0x08, 0x50, 0x14, 0x3e, 0x24, 0x79, 0x01, 0xbd,
+  0x38, 0x64, 0xab, 0xbd, 0x3f, 0x3c, 0x1b, 0xbd, 0xed, 0xa8, 0x32, 0x3d,
+  0x58, 0xe0, 0x1c, 0x3e, 0xd3, 0x42, 0xd9, 0xbc, 0x90, 0x76, 0x00, 0xbd,
+  0xc2, 0x0f, 0x23, 0x3e, 0xa8, 0x4b, 0x6a, 0xbd, 0x2c, 0x86, 0x51, 0xbd,
+  0x9f, 0x62, 0x9c, 0xbd, 0xe3, 0x0d, 0x98, 0x3d, 0xce, 0x09, 0x98, 0x3e,
+  0x2d, 0x6c, 0x4a, 0xbd, 0x3f, 0x06, 0x04, 0xbd, 0x76, 0xa9, 0x80, 0x3e,
+  0x93, 0x75, 0x30, 0xbd, 0xe8, 0x71, 0x0e, 0xbd, 0xce, 0x55, 0x13, 0xbd,
+  0xbe, 0x07, 0xa6, 0x3c, 0xf0, 0x2f, 0x56, 0x3e, 0x9f, 0x00, 0x99, 0x3c,
+  0x29, 0xca, 0xf0, 0x3c, 0x0a, 0x26, 0x25, 0x3e, 0xd1, 0x4a, 0xaf, 0x3d,
+  0xab, 0x09, 0x88, 0x3d, 0xf5, 0x18, 0x28, 0x3e, 0xfd, 0x3c, 0x4f, 0x3e,
+  0x27, 0xfd, 0xee, 0x3d, 0x85, 0xbe, 0x12, 0x3e, 0xb2, 0xc5, 0xd5, 0x3d,
+  0x6e, 0x5e, 0xba, 0xbb, 0x33, 0xbe, 0x8d, 0x3c, 0x78, 0x25, 0xb1, 0x3d,
+  0xca, 0xef, 0xe1, 0xbc, 0x68, 0x60, 0xfd, 0x3c, 0xea, 0x73, 0x29, 0xbd,
+  0x41, 0x6a, 0x85, 0x3c, 0xb9, 0xd3, 0xcb, 0x3c, 0x41, 0xe9, 0x87, 0xbc,
+  0x50, 0x2f, 0x25, 0x3d, 0x72, 0x4b, 0x13, 0x3d, 0xb6, 0x32, 0x76, 0x3d,
+  0x99, 0xa3, 0x65, 0xbc, 0x38, 0xe2, 0x99, 0xbd, 0x59, 0x3f, 0xbf, 0x3d,
+  0x40, 0x58, 0x23, 0x3d, 0x44, 0x6b, 0x2a, 0xbd, 0x82, 0xa5, 0x19, 0x3d,
+  0xcf, 0xcc, 0x9f, 0x3d, 0xd0, 0x09, 0x36, 0x3d, 0x8d, 0xd5, 0x91, 0xbb,
+  0xa7, 0x6a, 0xaa, 0xbd, 0xf6, 0x7d, 0xbf, 0x3d, 0x5a, 0x53, 0x8e, 0x3d,
+  0xa5, 0x3f, 0xb7, 0xbd, 0xa4, 0x8c, 0x8c, 0x3d, 0xcb, 0x32, 0xc3, 0x3d,
+  0x94, 0x8d, 0x2d, 0x3d, 0x5e, 0xa0, 0xbf, 0x3d, 0x51, 0x07, 0xd8, 0xbd,
+  0x58, 0x9e, 0xb0, 0x3c, 0xb0, 0x31, 0x98, 0x3d, 0xe1, 0x5d, 0xab, 0xbc,
+  0x3f, 0xad, 0x8e, 0xbc, 0x70, 0x8f, 0xb1, 0x3d, 0x97, 0x83, 0x6d, 0x3d,
+  0xb5, 0x1c, 0x93, 0x3d, 0x41, 0xba, 0x52, 0xbe, 0xf7, 0xd5, 0x12, 0x3e,
+  0x73, 0xa5, 0xdc, 0x3d, 0x7e, 0x6d, 0xa4, 0xbd, 0x71, 0xab, 0x01, 0x3d,
+  0x2c, 0xa9, 0xcf, 0x3d, 0xb6, 0xca, 0xcc, 0x3d, 0xfb, 0xae, 0x8e, 0x3c,
+  0xdd, 0x89, 0xc4, 0xbd, 0x1c, 0xec, 0xc4, 0x3d, 0x7f, 0x2b, 0xc5, 0x3d,
+  0xf1, 0x0f, 0xbc, 0x3d, 0xa8, 0x26, 0xff, 0x3b, 0xe9, 0x39, 0x0d, 0x3d,
+  0x07, 0xb8, 0xb4, 0xbc, 0xc7, 0x54, 0x9b, 0x3d, 0xb0, 0xd5, 0x0c, 0x3d,
+  0x18, 0x60, 0x8d, 0x3d, 0xf8, 0xa1, 0x10, 0x3d, 0x07, 0x9f, 0x28, 0x3e,
+  0x3e, 0x58, 0x3c, 0x3d, 0xfe, 0x2f, 0x4d, 0x3d, 0xec, 0xf2, 0x3f, 0xbc,
+  0xd9, 0x4e, 0x82, 0x3d, 0x01, 0x27, 0x6d, 0x3d, 0xcc, 0x1a, 0xb3, 0x3c,
+  0x51, 0x0e, 0x48, 0x3d, 0xc7, 0x18, 0x6c, 0x3e, 0x0a, 0x6a, 0xbd, 0x3d,
+  0x11, 0xc9, 0x83, 0x3c, 0xd7, 0x22, 0x94, 0xbd, 0x5c, 0x12, 0x00, 0x3d,
+  0xa3, 0xec, 0x3a, 0x3e, 0x63, 0x6d, 0xc4, 0xbb, 0xd9, 0x46, 0x32, 0x3d,
+  0xa9, 0x28, 0xa1, 0x3e, 0x6c, 0x8f, 0x42, 0x3d, 0xf4, 0x75, 0x0d, 0xbd,
+  0xf1, 0xe9, 0x1a, 0xbc, 0x3b, 0x38, 0x31, 0xbc, 0xcf, 0x4c, 0xad, 0x3e,
+  0xe9, 0xbf, 0xfb, 0xbc, 0x35, 0x71, 0x8f, 0xbc, 0xe9, 0x43, 0x93, 0x3e,
+  0x63, 0xd1, 0x5d, 0x3d, 0x69, 0x15, 0xbf, 0xbd, 0x27, 0x90, 0x01, 0xbe,
+  0xa5, 0xbd, 0xa2, 0xba, 0x61, 0xc8, 0x71, 0x3e, 0xf0, 0x08, 0xbc, 0xbd,
+  0xe4, 0x26, 0x2b, 0x3d, 0x5c, 0xaa, 0xb4, 0x3e, 0xfa, 0xe7, 0xef, 0x3c,
+  0xdb, 0x0b, 0x1b, 0xbd, 0x70, 0x00, 0xdc, 0xbd, 0xb8, 0x48, 0x1d, 0x3d,
+  0xe7, 0x07, 0x18, 0x3e, 0xdc, 0x12, 0x2d, 0x3c, 0x22, 0xec, 0x4d, 0xbc,
+  0x62, 0xd2, 0x82, 0x3d, 0x77, 0xee, 0xbb, 0x3c, 0xee, 0xcb, 0x01, 0x3d,
+  0x00, 0x21, 0xee, 0x3d, 0xd8, 0xd5, 0xc6, 0x3d, 0x1e, 0x0f, 0x24, 0xbd,
+  0x11, 0x25, 0x64, 0x3d, 0xab, 0x64, 0xb5, 0x3d, 0x0b, 0x75, 0x03, 0xbd,
+  0x44, 0xb1, 0x5c, 0xbd, 0x43, 0x24, 0x7e, 0x3c, 0xe0, 0x2e, 0x05, 0x3d,
+  0xd5, 0xd7, 0x46, 0x3d, 0x1c, 0xa6, 0xaa, 0xbd, 0x16, 0x03, 0x82, 0x3d,
+  0x53, 0x33, 0x8c, 0x3d, 0xd2, 0x96, 0x14, 0xbe, 0x3c, 0xa8, 0xac, 0x3d,
+  0x1e, 0x22, 0x6e, 0xbc, 0xe3, 0xb0, 0x21, 0x3d, 0xdb, 0x40, 0xb9, 0x3d,
+  0xdf, 0x30, 0x93, 0xba, 0xe6, 0xfa, 0x88, 0x3d, 0xb1, 0x3d, 0xcf, 0x3d,
+  0x64, 0x58, 0x2d, 0xbe, 0xa0, 0xd0, 0x92, 0x3d, 0x33, 0x24, 0x4d, 0x3d,
+  0x87, 0x1a, 0x24, 0xbc, 0x64, 0x59, 0x49, 0x3d, 0x70, 0xa0, 0x0d, 0xbe,
+  0x03, 0x1b, 0x46, 0x3a, 0x9a, 0x8a, 0xbb, 0xbc, 0xb3, 0x8e, 0x60, 0xbe,
+  0x9c, 0x05, 0xb8, 0xbc, 0x25, 0x48, 0x90, 0x3d, 0x0c, 0xa5, 0x99, 0x3d,
+  0x9b, 0xf4, 0x28, 0xbc, 0xcf, 0x4b, 0x6c, 0xbd, 0x2e, 0xe0, 0x9f, 0x3d,
+  0x00, 0x65, 0x07, 0x3d, 0x01, 0x64, 0x2d, 0xbe, 0xb5, 0xfb, 0xf5, 0x3b,
+  0xad, 0xf2, 0xe3, 0x3d, 0x02, 0x51, 0x1f, 0x39, 0xad, 0x6f, 0xbd, 0x3d,
+  0x82, 0x71, 0xe6, 0xbd, 0xe2, 0xb2, 0xc3, 0x3c, 0x80, 0x4f, 0x70, 0x3d,
+  0xd3, 0xfe, 0xf4, 0xbd, 0xda, 0x5b, 0x27, 0xbd, 0x76, 0x9a, 0xcc, 0x3b,
+  0xde, 0x0e, 0xb9, 0xbc, 0x10, 0x31, 0xb7, 0x3c, 0x7e, 0x62, 0xac, 0xbd,
+  0x8a, 0xc8, 0x3e, 0x3d, 0xa7, 0x24, 0xcc, 0x3b, 0x27, 0xf9, 0x71, 0x3d,
+  0xa6, 0x98, 0xf6, 0xbd, 0x90, 0xd5, 0x6c, 0x3d, 0x86, 0xd1, 0xd7, 0xbc,
+  0x94, 0x7b, 0x74, 0xbd, 0xe7, 0xfa, 0x17, 0xbd, 0xbb, 0x31, 0xda, 0xbc,
+  0x52, 0x3b, 0xe5, 0xbc, 0x14, 0x7c, 0xe7, 0xbc, 0x42, 0xf6, 0x8e, 0xbb,
+  0x2d, 0x0a, 0x89, 0xbc, 0xe4, 0x10, 0xe7, 0xbd, 0x00, 0xec, 0x14, 0x3d,
+  0x85, 0xc8, 0xdd, 0x3d, 0xff, 0xae, 0x55, 0xbc, 0x81, 0xe3, 0x84, 0x3c,
+  0x8e, 0x16, 0x1d, 0x3e, 0xe4, 0x47, 0x68, 0x3d, 0x76, 0x0d, 0x48, 0xbb,
+  0x77, 0x91, 0x0f, 0x3d, 0x8b, 0x33, 0x61, 0x3d, 0x12, 0xdf, 0x56, 0x3e,
+  0xe8, 0x00, 0x1e, 0x3d, 0xfe, 0x17, 0x8c, 0x3d, 0xb6, 0x8d, 0x86, 0x3e,
+  0x6d, 0x58, 0x11, 0x3e, 0x51, 0x2c, 0xe2, 0x3d, 0x1d, 0xbe, 0xfb, 0xbc,
+  0xe8, 0x4e, 0x06, 0x3e, 0x2b, 0xae, 0x24, 0x3e, 0xce, 0x12, 0xe8, 0x3c,
+  0xa2, 0x7c, 0x9b, 0x3d, 0x2d, 0x91, 0xd6, 0x3e, 0x96, 0x93, 0x92, 0x3d,
+  0xa9, 0x61, 0x80, 0x3c, 0x03, 0xee, 0xc6, 0xbc, 0x73, 0x27, 0x81, 0xbc,
+  0xb9, 0xe3, 0x1a, 0x3e, 0x9e, 0xe8, 0xb2, 0xbd, 0x94, 0x16, 0xe8, 0xbc,
+  0x8e, 0xa1, 0x96, 0x3e, 0x79, 0x8c, 0x6d, 0xbc, 0xda, 0x7e, 0x7c, 0x3c,
+  0xb6, 0x54, 0x7e, 0x3c, 0x2e, 0x43, 0xdd, 0xbb, 0x7a, 0x90, 0x8b, 0x3d,
+  0x45, 0x3b, 0xb4, 0xbc, 0xdf, 0x72, 0xc3, 0x3d, 0x59, 0x83, 0x12, 0xbd,
+  0xf5, 0xbe, 0x87, 0x3d, 0x2d, 0x50, 0xbd, 0x3c, 0x2b, 0xc9, 0xfd, 0x3c,
+  0x85, 0x7c, 0x99, 0x3c, 0x5b, 0x82, 0xeb, 0xbd, 0x86, 0x4a, 0xab, 0x3d,
+  0xbb, 0x26, 0x93, 0x3d, 0x1e, 0xcd, 0x40, 0xbd, 0xbe, 0x7f, 0x28, 0xbe,
+  0xf2, 0x7c, 0x3e, 0xbc, 0x68, 0x60, 0xe5, 0xbc, 0x27, 0x6e, 0xda, 0x3d,
+  0x5d, 0xde, 0xe7, 0xbb, 0xb4, 0xd9, 0xa3, 0x3d, 0x0f, 0x07, 0x0d, 0xbd,
+  0x1d, 0x60, 0x43, 0xbe, 0x72, 0x14, 0xee, 0xbd, 0x88, 0x0b, 0xca, 0xbc,
+  0x2e, 0x3d, 0x76, 0x3d, 0x37, 0x5a, 0xd3, 0x3d, 0x77, 0x60, 0xa1, 0xbb,
+  0x5b, 0x00, 0x85, 0xbc, 0x23, 0x0c, 0x7f, 0x3c, 0xc4, 0xe4, 0x47, 0xbe,
+  0x78, 0xa8, 0xf3, 0xbd, 0x52, 0x44, 0xdb, 0xbc, 0x18, 0xda, 0x45, 0x3d,
+  0x53, 0x93, 0x1f, 0x3d, 0xbe, 0xe8, 0xfa, 0x3d, 0x0a, 0xaf, 0x8b, 0x3d,
+  0x64, 0x26, 0x80, 0xbc, 0xce, 0x06, 0x84, 0xbe, 0xd8, 0xa8, 0xeb, 0xbc,
+  0x3d, 0x82, 0x5e, 0xbc, 0x8e, 0x3d, 0x4d, 0xbd, 0x22, 0xb0, 0x3f, 0x3d,
+  0x06, 0x80, 0xa7, 0x3d, 0x4b, 0x2e, 0x95, 0x3d, 0x31, 0xc2, 0xc1, 0x3c,
+  0xd5, 0xd0, 0x54, 0xbe, 0xc6, 0x46, 0x30, 0x3d, 0x75, 0x7e, 0x8e, 0x3d,
+  0x91, 0x9c, 0x55, 0xbd, 0x77, 0x4a, 0x7e, 0x3d, 0x4c, 0x0f, 0x2b, 0x3d,
+  0xa4, 0xab, 0x2c, 0x3a, 0xfd, 0xb3, 0xab, 0xbc, 0x9b, 0xd4, 0xcd, 0xbd,
+  0x1a, 0xc9, 0xb1, 0xbc, 0x5f, 0x01, 0x41, 0xbd, 0x4b, 0x92, 0x5d, 0x3c,
+  0x30, 0xd4, 0xa5, 0x3d, 0xef, 0x67, 0x38, 0xbd, 0x7a, 0x47, 0x4c, 0xbd,
+  0x77, 0x39, 0xb5, 0xbc, 0x0d, 0x0d, 0xda, 0xbd, 0x2b, 0x6a, 0xbb, 0x3b,
+  0xa6, 0x66, 0x8c, 0xbd, 0x23, 0x79, 0xdd, 0xbd, 0x72, 0x2c, 0xca, 0xbc,
+  0x97, 0xb9, 0x3e, 0x3c, 0xbe, 0xc5, 0x12, 0xbd, 0x81, 0x0e, 0xc0, 0xbd,
+  0xc9, 0xbb, 0x61, 0x3d, 0x18, 0x68, 0x80, 0xbd, 0x06, 0x7c, 0x66, 0x3b,
+  0x54, 0x51, 0xe6, 0xbc, 0x90, 0x5d, 0xba, 0xbb, 0xe8, 0xca, 0x1e, 0x3d,
+  0x9c, 0xed, 0xad, 0x3b, 0xd8, 0x5b, 0xa4, 0x3c, 0xb1, 0xf3, 0x89, 0x3d,
+  0x28, 0x1b, 0xa4, 0x3d, 0xdf, 0x25, 0xb3, 0x3d, 0x30, 0x03, 0x6a, 0x3d,
+  0x8f, 0x81, 0x39, 0x3d, 0x92, 0x9b, 0x2c, 0x3e, 0x60, 0x66, 0x4b, 0x3d,
+  0xce, 0x44, 0x5b, 0x3d, 0xc2, 0x3c, 0x3d, 0x3e, 0x82, 0xf3, 0xe5, 0x3d,
+  0x1b, 0x5a, 0xea, 0x3c, 0x66, 0xc3, 0x1a, 0x3b, 0x0d, 0xaf, 0xcb, 0x3c,
+  0xe6, 0x17, 0x08, 0x3e, 0xf3, 0xea, 0x04, 0x3d, 0xfd, 0x1a, 0x4b, 0x3c,
+  0x5b, 0x76, 0x6e, 0x3d, 0x3e, 0x21, 0xa4, 0x3d, 0x73, 0xaa, 0xa0, 0x3d,
+  0xc7, 0x5c, 0xd0, 0x3c, 0x7d, 0x4c, 0x7b, 0x3d, 0xa4, 0xc9, 0x2d, 0xbd,
+  0xd4, 0xc0, 0x74, 0x3d, 0x19, 0x41, 0x9e, 0x3a, 0xbe, 0xa6, 0xf0, 0x3b,
+  0x36, 0x2e, 0x71, 0x3d, 0x88, 0xb1, 0xfc, 0x3c, 0xce, 0xa8, 0xc8, 0x3d,
+  0xf3, 0xa6, 0x91, 0x3d, 0x11, 0x88, 0x62, 0x3d, 0xf9, 0x14, 0xea, 0x3d,
+  0xb0, 0x56, 0x83, 0x3d, 0x03, 0xfe, 0xa5, 0xbd, 0xbd, 0x57, 0x98, 0x3d,
+  0x48, 0x52, 0x25, 0x3e, 0xa0, 0xdf, 0xe1, 0x3b, 0x15, 0x61, 0x1f, 0x3e,
+  0x4b, 0x63, 0xce, 0xbc, 0x04, 0x1b, 0x0a, 0x39, 0x78, 0xda, 0xb8, 0x3d,
+  0x68, 0xb7, 0x0c, 0xbc, 0xdf, 0x52, 0xcb, 0xbd, 0xc7, 0x01, 0xd4, 0xbd,
+  0x33, 0xef, 0x3d, 0xbe, 0xa3, 0x9e, 0xe5, 0xbd, 0xf2, 0x40, 0x36, 0xbd,
+  0x5f, 0x93, 0x01, 0xbe, 0xa2, 0x9c, 0xa3, 0xbd, 0x51, 0x35, 0x74, 0xbd,
+  0xe4, 0x7c, 0xd7, 0xbd, 0x7c, 0x3f, 0x35, 0xbe, 0x46, 0xd9, 0x56, 0xbe,
+  0x81, 0x01, 0x73, 0xbe, 0x12, 0x19, 0x98, 0xbd, 0x70, 0xd9, 0x86, 0xbe,
+  0x8d, 0xab, 0x3b, 0xbe, 0xbc, 0x44, 0x1a, 0xbc, 0x34, 0x83, 0x2e, 0xbe,
+  0x2b, 0x54, 0x4b, 0xbe, 0x1b, 0xb2, 0x3a, 0xbe, 0xfb, 0x80, 0x2f, 0xbe,
+  0x3d, 0x46, 0xe9, 0xbd, 0xf9, 0x26, 0x15, 0xbe, 0xcd, 0xd7, 0x7d, 0xbe,
+  0x0b, 0xb5, 0x51, 0x3b, 0x32, 0xe5, 0x56, 0xbe, 0x45, 0x05, 0xc1, 0xbd,
+  0xb9, 0x33, 0x23, 0xbe, 0x13, 0x8a, 0x1d, 0xbe, 0x10, 0xf0, 0x9d, 0xbc,
+  0x75, 0xc6, 0x3f, 0xbe, 0xbc, 0x39, 0x33, 0xbe, 0x62, 0x73, 0x51, 0xbc,
+  0xa9, 0xf2, 0xca, 0xbe, 0xd8, 0xb7, 0xdd, 0xbd, 0xfc, 0x67, 0x3c, 0xbe,
+  0xc3, 0x18, 0xe5, 0xbd, 0x49, 0x00, 0xd2, 0xbd, 0x25, 0x32, 0x0f, 0xbe,
+  0x41, 0xd8, 0x94, 0xbe, 0x02, 0xfe, 0xb2, 0xbd, 0x60, 0x45, 0x95, 0xbe,
+  0xc7, 0xb0, 0x4d, 0x3d, 0xa8, 0x4d, 0xb8, 0xbd, 0x4a, 0x08, 0xea, 0xbc,
+  0x66, 0x20, 0xed, 0x3c, 0xab, 0xef, 0x65, 0xbd, 0xb5, 0x74, 0x93, 0xbd,
+  0x79, 0x20, 0xe9, 0xbb, 0x73, 0x05, 0xe1, 0xbd, 0xbe, 0x43, 0x84, 0xb9,
+  0x12, 0xee, 0xfd, 0xbd, 0x25, 0xdb, 0xa1, 0xbd, 0xa2, 0xbe, 0x49, 0xbd,
+  0xa0, 0x7c, 0xef, 0xbd, 0xd0, 0xcb, 0x36, 0xbd, 0xcf, 0x37, 0xfd, 0xbd,
+  0x44, 0xe6, 0x1f, 0xbe, 0xb5, 0xa9, 0x32, 0xba, 0xd9, 0x5e, 0x28, 0xbe,
+  0xbc, 0x27, 0xd7, 0xbc, 0x10, 0xc6, 0xaf, 0x3c, 0x55, 0x06, 0x0d, 0xbe,
+  0xc1, 0xe9, 0x49, 0xbd, 0x02, 0x74, 0x0d, 0xbe, 0xc7, 0x61, 0x10, 0xbe,
+  0xc6, 0x61, 0x2e, 0xbd, 0x22, 0x67, 0x5f, 0xbd, 0xe5, 0x4d, 0x06, 0xbd,
+  0x48, 0x58, 0x07, 0xbd, 0xb6, 0x9d, 0xaa, 0xbd, 0xa1, 0x26, 0x6f, 0xbd,
+  0xc4, 0x29, 0x05, 0xbe, 0x12, 0x65, 0x66, 0xbd, 0x15, 0xe8, 0x38, 0x3d,
+  0x8d, 0x37, 0xee, 0xbd, 0xb3, 0x53, 0x44, 0xbc, 0x58, 0x48, 0x9b, 0xbc,
+  0x67, 0xed, 0x30, 0xbe, 0xb8, 0x13, 0x6e, 0xbd, 0xa5, 0x4c, 0x75, 0x3c,
+  0x27, 0xdd, 0x44, 0xbe, 0xd3, 0xaa, 0xd0, 0xbc, 0xee, 0x46, 0xc8, 0xbd,
+  0x1d, 0xc9, 0x98, 0xbd, 0xa8, 0xf3, 0xb2, 0xbd, 0x9c, 0x51, 0x15, 0xbd,
+  0x70, 0x1d, 0xd2, 0xbd, 0x96, 0x0a, 0xd9, 0xbd, 0xc7, 0x90, 0x55, 0xbe,
+  0x2b, 0xc6, 0x2a, 0x3c, 0xb4, 0xd4, 0xd2, 0x3c, 0x53, 0x2a, 0xf5, 0x3c,
+  0x15, 0x7d, 0x0a, 0xbd, 0xe6, 0x5f, 0x1f, 0x3d, 0x86, 0xa8, 0x44, 0xbb,
+  0xc0, 0xa8, 0x99, 0xbd, 0x24, 0x03, 0x41, 0x3c, 0xe1, 0x75, 0xb7, 0x3d,
+  0xa7, 0xcf, 0xa3, 0xba, 0xeb, 0xb1, 0x8c, 0x3d, 0x5a, 0xd3, 0xa6, 0xbc,
+  0x78, 0x8d, 0x6e, 0x3d, 0xc0, 0x4f, 0xd5, 0xbb, 0x34, 0x40, 0xad, 0xbd,
+  0x30, 0xd3, 0x0f, 0xbb, 0x42, 0x35, 0x8d, 0xbd, 0x87, 0xf1, 0x8c, 0xbd,
+  0x82, 0x96, 0xc3, 0xbd, 0x79, 0xc4, 0x13, 0xbe, 0x82, 0x98, 0x0f, 0xbe,
+  0x18, 0xca, 0xdc, 0xbd, 0x71, 0x0a, 0xba, 0xbd, 0x98, 0x58, 0x9e, 0xbc,
+  0xb2, 0x13, 0x99, 0xbd, 0x9d, 0x0f, 0xc1, 0xbc, 0x48, 0x1f, 0x9e, 0xbd,
+  0x63, 0x39, 0xcf, 0xbd, 0x57, 0xa8, 0x8f, 0xbd, 0xdb, 0x6f, 0xcf, 0xbd,
+  0x5e, 0x54, 0xca, 0xbd, 0x45, 0x63, 0x3a, 0x3c, 0x37, 0x9b, 0x83, 0x3c,
+  0x1a, 0x7a, 0x87, 0x3d, 0xf8, 0xa4, 0x16, 0xbe, 0x8b, 0xaf, 0x31, 0xbe,
+  0x03, 0xe0, 0xa6, 0xbc, 0xb6, 0x91, 0x66, 0x3b, 0x08, 0x5d, 0x9a, 0xbd,
+  0x9b, 0x40, 0x97, 0x3c, 0x9e, 0x84, 0x08, 0x3e, 0x2f, 0xc3, 0xd7, 0x3d,
+  0xeb, 0x28, 0x21, 0xbe, 0x58, 0x43, 0x03, 0xbe, 0x67, 0x97, 0x8b, 0xbb,
+  0xf2, 0xd0, 0x0a, 0x3d, 0xb9, 0x64, 0xe3, 0xbd, 0xf5, 0xf7, 0x32, 0x3d,
+  0xcc, 0xca, 0x7e, 0xbb, 0x1d, 0xdb, 0x81, 0x3d, 0x3d, 0x20, 0x49, 0xbd,
+  0xf2, 0x9d, 0x35, 0xbe, 0x88, 0xd5, 0x21, 0xbd, 0xbc, 0xe0, 0x9a, 0xbb,
+  0x5a, 0x91, 0xf4, 0xbc, 0x04, 0x3b, 0x80, 0x3d, 0xf5, 0x49, 0xcc, 0xbc,
+  0xa6, 0x77, 0x53, 0x3d, 0x83, 0xec, 0x93, 0xbd, 0x9c, 0x7a, 0x01, 0xbe,
+  0xf4, 0xe1, 0x01, 0xbd, 0x0d, 0x52, 0xa2, 0x3b, 0xbe, 0x38, 0x72, 0x3b,
+  0x56, 0xd7, 0xb1, 0x3d, 0xf3, 0xd9, 0x3f, 0xbb, 0xc1, 0x18, 0x53, 0x3d,
+  0xd4, 0x04, 0xcf, 0xbd, 0x5e, 0x2a, 0x3c, 0xbe, 0xb7, 0x7a, 0x9a, 0x3c,
+  0x4b, 0x19, 0x27, 0xbd, 0x3c, 0xff, 0xa7, 0x3d, 0x9b, 0x33, 0x28, 0x3d,
+  0x1b, 0xe4, 0x1a, 0xbc, 0x36, 0x82, 0xe0, 0x3d, 0x46, 0x06, 0x0a, 0xbe,
+  0x60, 0x5f, 0xe4, 0xbd, 0xdb, 0xa2, 0x9c, 0xbd, 0xd1, 0x05, 0xdf, 0x39,
+  0x0a, 0x03, 0x9c, 0x3d, 0xdd, 0x23, 0x32, 0xbc, 0x85, 0x02, 0xa4, 0x3d,
+  0x42, 0x49, 0x00, 0x3c, 0xc5, 0xf5, 0x40, 0xbe, 0x96, 0xd9, 0x47, 0xbe,
+  0x26, 0x55, 0xf7, 0xbd, 0xab, 0x60, 0x8c, 0xbd, 0x48, 0x79, 0x67, 0xbd,
+  0xf8, 0xb1, 0xff, 0xbd, 0xef, 0xad, 0x09, 0x3d, 0x58, 0x18, 0x55, 0x3d,
+  0x09, 0x4b, 0x39, 0xbe, 0x23, 0x6d, 0x3f, 0xbe, 0x01, 0xca, 0x8d, 0xbd,
+  0x7d, 0xe4, 0x2b, 0xbe, 0xea, 0x5a, 0x84, 0xbd, 0x50, 0x72, 0x59, 0xbe,
+  0xbc, 0x99, 0xbb, 0x3d, 0xcd, 0xc4, 0xfc, 0x3c, 0xc0, 0x11, 0x30, 0xbe,
+  0xea, 0x97, 0xbf, 0xbd, 0x53, 0x84, 0x0b, 0xbd, 0x81, 0xb1, 0xbd, 0xbd,
+  0x0b, 0xd9, 0x12, 0xbe, 0x79, 0x7e, 0x42, 0xbe, 0x7b, 0xdb, 0x5c, 0xbe,
+  0x8d, 0x41, 0x3d, 0xbe, 0xee, 0xe2, 0x3c, 0xbe, 0x84, 0x50, 0x1c, 0xbe,
+  0x00, 0x08, 0xd3, 0xbd, 0x29, 0xc2, 0xdb, 0xbd, 0x08, 0xef, 0x25, 0xbe,
+  0x02, 0x51, 0x97, 0x3a, 0xb3, 0xdd, 0x08, 0xbe, 0xc1, 0x73, 0xe8, 0xbd,
+  0xd0, 0xbc, 0x28, 0xbe, 0xba, 0x72, 0xa5, 0xbd, 0xb6, 0x1b, 0xd8, 0xbd,
+  0x71, 0x13, 0x8d, 0xbd, 0xd3, 0x37, 0x30, 0xbe, 0xb7, 0x0a, 0xee, 0xbc,
+  0x21, 0x4e, 0xdf, 0x3c, 0x34, 0xad, 0x80, 0xbc, 0x69, 0x4d, 0xed, 0xbd,
+  0x1d, 0x52, 0x51, 0xbe, 0xca, 0x20, 0x88, 0x3a, 0x92, 0xc7, 0x1f, 0xbd,
+  0x11, 0x7b, 0xd3, 0xbb, 0xdc, 0x06, 0xd8, 0x3d, 0x64, 0x1e, 0x14, 0x3e,
+  0xdf, 0x24, 0xe1, 0x3d, 0xb2, 0xa8, 0x49, 0xbd, 0x20, 0x12, 0x12, 0xbe,
+  0x01, 0xf0, 0x99, 0x3d, 0x5f, 0xca, 0x43, 0x3e, 0x62, 0x27, 0x35, 0xbc,
+  0xcb, 0x4f, 0x0e, 0x3e, 0x2f, 0xf1, 0x07, 0x3e, 0xf9, 0x74, 0x1e, 0x3e,
+  0x2d, 0xe0, 0x15, 0x3e, 0x22, 0x43, 0x55, 0xbe, 0xcf, 0xc4, 0xad, 0x3d,
+  0x1a, 0xca, 0xe2, 0x3d, 0x53, 0xc5, 0xa7, 0xbd, 0x3e, 0xf7, 0x05, 0x3c,
+  0x24, 0xd2, 0xc7, 0x3d, 0xa6, 0x2e, 0xfc, 0x3c, 0xa3, 0xa8, 0x83, 0x3d,
+  0x5b, 0x1f, 0x27, 0xbe, 0xb4, 0xe8, 0x7d, 0x3d, 0xc1, 0x4a, 0xb8, 0x3d,
+  0xb8, 0x2c, 0x8b, 0xbd, 0x62, 0xc0, 0x20, 0x3c, 0xfa, 0x1f, 0xb9, 0x3c,
+  0xea, 0xce, 0x8b, 0x3c, 0xb5, 0x38, 0x53, 0x3a, 0x62, 0xa0, 0xfa, 0xbd,
+  0xb2, 0x08, 0x6a, 0x3d, 0x8e, 0x0f, 0xd3, 0x3c, 0xc5, 0xe4, 0xc4, 0x3c,
+  0xe9, 0x03, 0x84, 0x3d, 0x62, 0x60, 0x2d, 0x3d, 0x6d, 0x7b, 0xa1, 0xba,
+  0xba, 0x48, 0xcc, 0x3d, 0x8f, 0xed, 0xdb, 0xbd, 0xe5, 0x83, 0x77, 0x3d,
+  0xb9, 0xfe, 0x13, 0x3d, 0x4a, 0x64, 0xc4, 0x3c, 0xed, 0x20, 0x85, 0x3d,
+  0x9d, 0xd0, 0xe8, 0x3c, 0xe6, 0xf2, 0xce, 0xbc, 0xab, 0x1d, 0x25, 0x3e,
+  0x67, 0xc6, 0xfd, 0xbc, 0x29, 0xfe, 0x4c, 0x3c, 0xca, 0x62, 0x04, 0x3d,
+  0x9a, 0x52, 0x9a, 0x3c, 0x7d, 0x11, 0x47, 0x3d, 0xd1, 0xc1, 0xbc, 0x3d,
+  0xc7, 0xd6, 0x1a, 0xbd, 0xc4, 0x49, 0xa9, 0xbd, 0x7e, 0x65, 0xc5, 0xbd,
+  0xd8, 0x87, 0x5c, 0xbd, 0x9a, 0xc7, 0x12, 0x3d, 0x5f, 0xae, 0x2d, 0x3d,
+  0x0f, 0x8d, 0x27, 0x3d, 0xb4, 0xb5, 0xb2, 0x3d, 0xda, 0x9c, 0x06, 0xbd,
+  0xa0, 0x97, 0x56, 0xbd, 0x57, 0x52, 0x73, 0xbe, 0xea, 0x3f, 0x04, 0x3d,
+  0xa6, 0xf7, 0x5a, 0xbb, 0x09, 0xa5, 0x8b, 0xbd, 0x03, 0x78, 0xf9, 0x3c,
+  0x0c, 0xe0, 0xbf, 0x3d, 0xab, 0x04, 0xde, 0xbc, 0x7f, 0x80, 0xae, 0xbd,
+  0x0f, 0x37, 0x82, 0xbe, 0xb3, 0x8d, 0x25, 0xbd, 0x7b, 0xcc, 0x9a, 0x3d,
+  0x1c, 0x6e, 0xe7, 0xbd, 0xdd, 0x07, 0x54, 0x3d, 0x64, 0x77, 0x68, 0x3d,
+  0x28, 0xd5, 0x53, 0xbc, 0x0f, 0xf0, 0x5c, 0xbe, 0xe0, 0x7e, 0x63, 0xbe,
+  0x6f, 0xb5, 0xe6, 0xbd, 0x8e, 0x92, 0x47, 0x3b, 0x69, 0xed, 0x90, 0xbd,
+  0xab, 0x53, 0x5c, 0xbe, 0xcf, 0xa0, 0x98, 0xbd, 0x4b, 0x30, 0xdf, 0xbc,
+  0x9d, 0x70, 0x31, 0xbe, 0xb0, 0x27, 0x36, 0xbe, 0x4c, 0x51, 0x02, 0xbe,
+  0xc1, 0x93, 0xea, 0xbd, 0x0e, 0x73, 0x1c, 0xbe, 0xaf, 0xb5, 0x20, 0xbe,
+  0x03, 0x79, 0x23, 0xbe, 0x40, 0x2d, 0xbb, 0xbd, 0xfc, 0xde, 0x42, 0xbe,
+  0x23, 0x04, 0x5a, 0xbe, 0x40, 0x41, 0x20, 0xbe, 0x23, 0x8a, 0x3d, 0xbe,
+  0x5c, 0xf0, 0x05, 0xbe, 0xa8, 0xae, 0x72, 0x3d, 0xc3, 0x98, 0x27, 0x3c,
+  0x8b, 0x8f, 0xbe, 0x3c, 0x7f, 0x70, 0x08, 0x3d, 0xca, 0x87, 0xc1, 0xbd,
+  0x5f, 0x02, 0x63, 0x3d, 0xa1, 0x81, 0x34, 0x3b, 0x7a, 0x1c, 0x59, 0x3d,
+  0x6a, 0xf7, 0x68, 0x3d, 0x68, 0x78, 0xac, 0x3d, 0x6c, 0x0a, 0x54, 0x3d,
+  0x4c, 0xe9, 0xac, 0x3d, 0xc6, 0x9d, 0xad, 0xbd, 0xbe, 0x0a, 0x8f, 0x3d,
+  0x76, 0xad, 0x05, 0x3e, 0xbf, 0x01, 0xe6, 0xbc, 0x34, 0x4a, 0x1a, 0x3d,
+  0xf7, 0x6e, 0x1d, 0x3c, 0xc9, 0x7b, 0x48, 0x3d, 0x19, 0x82, 0x0c, 0x3e,
+  0x3b, 0x9f, 0x25, 0xbc, 0xc2, 0x23, 0x90, 0x3d, 0x0b, 0x93, 0x61, 0x3d,
+  0xe7, 0xad, 0xa7, 0x3b, 0xdb, 0x4d, 0x82, 0x3d, 0xad, 0x75, 0x06, 0xbd,
+  0x96, 0x18, 0x1d, 0xbd, 0xc7, 0x2c, 0xec, 0x3d, 0x2f, 0x00, 0x02, 0x3e,
+  0x8b, 0xeb, 0xac, 0x3c, 0xb2, 0x88, 0x25, 0x3d, 0xce, 0xe8, 0xf3, 0x3c,
+  0xdc, 0xd2, 0xb1, 0x3d, 0xe4, 0x19, 0xfe, 0x3c, 0x43, 0x15, 0x92, 0x3d,
+  0x67, 0x29, 0xa8, 0x3d, 0x68, 0xd1, 0x59, 0x3e, 0x4e, 0xcc, 0xbe, 0x3c,
+  0xe1, 0x97, 0x7c, 0xbc, 0xa9, 0x20, 0xe1, 0xbc, 0xaf, 0x99, 0x33, 0x3d,
+  0x8e, 0x24, 0x2a, 0xbd, 0xe6, 0x0f, 0x93, 0xbc, 0xaf, 0x0c, 0x62, 0x3d,
+  0x95, 0xc0, 0x6b, 0x3e, 0x7b, 0xea, 0x80, 0xbb, 0x29, 0x94, 0xbc, 0x3d,
+  0x9e, 0x1d, 0x6d, 0x3c, 0xf4, 0x4b, 0xef, 0x3c, 0x5f, 0x8d, 0x59, 0x3d,
+  0x16, 0x76, 0xd2, 0xbc, 0xd6, 0xfc, 0xf7, 0x3c, 0xb9, 0x0d, 0x9f, 0x3d,
+  0xaf, 0xe4, 0xa9, 0xbc, 0x02, 0x00, 0xb0, 0x3d, 0xfa, 0xb9, 0x09, 0xbe,
+  0x80, 0xae, 0x89, 0x3d, 0x4f, 0x82, 0xfd, 0x3c, 0x44, 0x3f, 0x26, 0x3c,
+  0x70, 0x20, 0x9d, 0xbd, 0x76, 0x48, 0x41, 0xbe, 0x77, 0x0c, 0x58, 0x3d,
+  0xdb, 0x50, 0xe9, 0xbc, 0x71, 0xfd, 0x3f, 0xbe, 0x44, 0x06, 0xd6, 0x3c,
+  0x34, 0x09, 0xbf, 0xbc, 0x1c, 0x21, 0x31, 0xbd, 0xb2, 0xf6, 0x39, 0xbd,
+  0x4b, 0xa6, 0x5a, 0xbe, 0x16, 0x52, 0xc5, 0xbd, 0xff, 0x25, 0xb2, 0x3c,
+  0xe8, 0x18, 0xee, 0xbd, 0x67, 0xc1, 0xd1, 0x3d, 0x3e, 0xf3, 0x25, 0xbd,
+  0xe1, 0x2e, 0x16, 0xbd, 0xbd, 0x93, 0x0e, 0xbd, 0x64, 0xcb, 0xa7, 0xbe,
+  0xb4, 0x4f, 0x3f, 0x3d, 0x7c, 0x00, 0x2d, 0x3c, 0xa9, 0x0f, 0x00, 0xbe,
+  0x6d, 0xdc, 0x0c, 0xbd, 0xad, 0x44, 0xf2, 0xbc, 0x69, 0xe9, 0x19, 0x3b,
+  0x03, 0xa6, 0x80, 0xbd, 0xa0, 0xc3, 0x85, 0xbe, 0x83, 0xb9, 0xb1, 0xbc,
+  0x9f, 0xa8, 0x22, 0xbd, 0xe8, 0x8e, 0x60, 0xbe, 0xb4, 0x6d, 0x9d, 0xbd,
+  0x93, 0x9d, 0xb2, 0xbc, 0x3b, 0xa2, 0xd8, 0xbd, 0x8f, 0x28, 0x26, 0xbe,
+  0x0d, 0x14, 0x0c, 0xbe, 0x3d, 0x2a, 0xd8, 0xbd, 0x7f, 0x8f, 0xeb, 0xbd,
+  0x76, 0xa5, 0xc1, 0xbd, 0x0d, 0x6b, 0x17, 0xbe, 0x30, 0xe5, 0xb0, 0xbd,
+  0x6f, 0xed, 0x07, 0xbe, 0x1c, 0xf8, 0x03, 0xbe, 0xdb, 0xff, 0x23, 0xbe,
+  0x8b, 0x9e, 0xf2, 0xbd, 0xb4, 0xae, 0x2b, 0xbe, 0x0c, 0x59, 0x33, 0xbe,
+  0x81, 0x1a, 0xc5, 0xbc, 0x10, 0x35, 0x8d, 0x3d, 0x17, 0xa8, 0xea, 0x3c,
+  0x93, 0x5a, 0x52, 0x3d, 0x0b, 0x6e, 0x93, 0xbd, 0x7c, 0x31, 0x54, 0x3d,
+  0x4a, 0x0e, 0xbf, 0x3c, 0x75, 0x3b, 0xe6, 0x3d, 0x81, 0x88, 0x0c, 0x3d,
+  0x22, 0x75, 0xd3, 0x3d, 0x04, 0x75, 0x0e, 0x3e, 0xe8, 0x72, 0xac, 0x3d,
+  0x2c, 0x7c, 0xfa, 0xbc, 0x53, 0xdf, 0x03, 0x3e, 0xf7, 0x42, 0x18, 0x3e,
+  0xb7, 0x98, 0xa3, 0x3d, 0x47, 0x5e, 0xf9, 0x3c, 0xa6, 0xe5, 0xd2, 0xbb,
+  0xa5, 0xe9, 0xac, 0xbb, 0x08, 0x8b, 0x1a, 0x3e, 0xbb, 0xf3, 0x00, 0x3e,
+  0x0c, 0x99, 0x7e, 0x3d, 0xcd, 0xb0, 0x69, 0x3c, 0xc1, 0x89, 0x92, 0x3d,
+  0xb0, 0x56, 0x02, 0xbe, 0x27, 0x2d, 0xa5, 0x3c, 0xbe, 0xa6, 0xe5, 0xbb,
+  0x44, 0x32, 0x84, 0x3d, 0x02, 0xe6, 0x7e, 0x3e, 0x8d, 0x0a, 0xb8, 0x3c,
+  0x93, 0xa1, 0x24, 0x3d, 0x63, 0x96, 0x82, 0x3d, 0x11, 0x0f, 0xf5, 0xbd,
+  0x16, 0xc0, 0x6c, 0x3c, 0x15, 0x65, 0xe6, 0x3c, 0x98, 0xf4, 0x45, 0x3c,
+  0xe4, 0x77, 0x71, 0x3e, 0xdc, 0x99, 0x39, 0xbc, 0x89, 0x87, 0x00, 0xbd,
+  0x7c, 0xae, 0x80, 0x3d, 0x7d, 0x1f, 0xc9, 0xbb, 0x4b, 0x82, 0x24, 0x3d,
+  0x77, 0x39, 0x1a, 0xbd, 0xa2, 0xb8, 0xa0, 0x3d, 0xd1, 0x3d, 0x0b, 0x3e,
+  0x06, 0x3c, 0xc1, 0xbb, 0x63, 0x5d, 0xe0, 0x3c, 0xcc, 0xa6, 0x45, 0xbd,
+  0x2d, 0x69, 0x6b, 0x3d, 0x0a, 0xe7, 0xf0, 0x3c, 0xb2, 0x8b, 0xae, 0xbb,
+  0xed, 0xed, 0x35, 0x3d, 0x8f, 0xd2, 0x53, 0xbc, 0xc4, 0xbf, 0xff, 0x3c,
+  0x32, 0x19, 0x4f, 0x3d, 0x79, 0xd6, 0xf8, 0xbd, 0xdb, 0xfd, 0xc8, 0x3b,
+  0x74, 0xdc, 0xc4, 0x3c, 0x3e, 0x27, 0xa5, 0x3b, 0x10, 0xda, 0x8e, 0x3d,
+  0xef, 0x05, 0x01, 0xbe, 0x88, 0x88, 0x1b, 0x3d, 0xc4, 0x6a, 0xd1, 0x3d,
+  0x4e, 0x8e, 0x10, 0xbe, 0xe0, 0xf9, 0x11, 0x3d, 0xb5, 0x4c, 0x6a, 0x3d,
+  0xad, 0x00, 0x60, 0x3d, 0xb8, 0x4a, 0x04, 0xbd, 0xec, 0x50, 0x43, 0xbe,
+  0x5a, 0xc0, 0x9a, 0xbb, 0x5c, 0x7c, 0xae, 0x3a, 0x30, 0xb5, 0xa4, 0xbe,
+  0xea, 0x81, 0xc5, 0xbc, 0x8f, 0xb6, 0x87, 0x3d, 0xf7, 0x1e, 0xd3, 0x3d,
+  0x1d, 0x6f, 0x1c, 0xbd, 0x26, 0xcf, 0xad, 0xbe, 0x34, 0x3d, 0x3b, 0xbc,
+  0xa7, 0x18, 0x1b, 0xbd, 0xdb, 0xb6, 0x8c, 0xbe, 0xfc, 0x29, 0xed, 0xbc,
+  0xda, 0x9e, 0x47, 0x3d, 0x7e, 0x8e, 0x7d, 0x3c, 0x51, 0x44, 0x29, 0xbd,
+  0x42, 0x1c, 0xe0, 0xbe, 0xd7, 0xb4, 0x90, 0x3d, 0x38, 0x71, 0x3f, 0x3b,
+  0x28, 0x3f, 0x51, 0xbe, 0xc4, 0x38, 0xe7, 0xbd, 0xff, 0x7b, 0xc7, 0x3c,
+  0xef, 0xff, 0x78, 0xbd, 0x92, 0x5a, 0x4e, 0xbd, 0x60, 0x41, 0x8c, 0xbe,
+  0xe1, 0x90, 0x78, 0xbd, 0xcb, 0x54, 0xcc, 0xbd, 0xec, 0x4b, 0x79, 0xbe,
+  0xd8, 0xad, 0xd4, 0xbd, 0x76, 0xdf, 0x44, 0xbe, 0x42, 0x0f, 0x9c, 0xbe,
+  0x69, 0x33, 0x33, 0xbe, 0x75, 0xd7, 0x0a, 0xbe, 0xed, 0x41, 0x84, 0xbe,
+  0x5c, 0xc2, 0x68, 0xbe, 0x71, 0xb0, 0xd7, 0xbd, 0x4d, 0xef, 0xe9, 0x3c,
+  0x13, 0x8b, 0x68, 0x3a, 0xf8, 0xcb, 0x0d, 0x3d, 0xcf, 0x75, 0xf3, 0x3c,
+  0x71, 0x46, 0x95, 0xbd, 0xfe, 0x06, 0x2b, 0xbb, 0x8b, 0xb2, 0x03, 0x3d,
+  0xc1, 0x18, 0x48, 0xbc, 0x8c, 0xe6, 0xd5, 0xbb, 0x30, 0x19, 0x15, 0x3c,
+  0x87, 0x67, 0x58, 0x3d, 0x5b, 0xf9, 0x8c, 0x3d, 0x03, 0x13, 0x58, 0xbd,
+  0x17, 0xea, 0x8f, 0x3d, 0x11, 0xd1, 0x8f, 0x3c, 0x04, 0x1a, 0xcc, 0x3d,
+  0x27, 0x37, 0xb2, 0xbd, 0x27, 0xae, 0x62, 0xbd, 0x23, 0xeb, 0x05, 0xbc,
+  0xe3, 0xfb, 0x24, 0x3e, 0xe7, 0x02, 0x05, 0x3e, 0xbc, 0xa6, 0x18, 0xbd,
+  0x41, 0xfc, 0x0f, 0xbc, 0x77, 0x1f, 0x86, 0x3e, 0xd7, 0x50, 0x20, 0xbe,
+  0xc9, 0x26, 0x9e, 0xbd, 0xca, 0xb5, 0x5d, 0xbd, 0x39, 0xfb, 0xa9, 0x3d,
+  0x98, 0x21, 0x79, 0x3e, 0xb2, 0xc3, 0xaf, 0x3c, 0xa4, 0xee, 0x26, 0xbd,
+  0xb7, 0xc7, 0x53, 0x3e, 0x7d, 0xaf, 0x37, 0xbe, 0xb1, 0x52, 0x78, 0xbd,
+  0xc5, 0xef, 0x23, 0xbe, 0x5f, 0xfa, 0x64, 0x3d, 0x54, 0x14, 0xb8, 0x3e,
+  0x65, 0xa6, 0xd2, 0xbd, 0x6f, 0x33, 0xee, 0xbd, 0xb9, 0x06, 0x7f, 0x3e,
+  0x50, 0x9f, 0xd0, 0xbd, 0x95, 0xc7, 0x1e, 0xbc, 0x4b, 0xd8, 0x8b, 0xbd,
+  0x53, 0xa4, 0x7b, 0x3d, 0x88, 0x84, 0xcd, 0x3e, 0xa2, 0x77, 0xc8, 0xbd,
+  0x73, 0xc7, 0x17, 0xbe, 0x7a, 0x90, 0x1f, 0x3e, 0xa4, 0xaf, 0x0f, 0xbc,
+  0x76, 0xb1, 0xd0, 0x3c, 0x33, 0x2e, 0xf6, 0x3d, 0x4e, 0x4b, 0xc1, 0x3d,
+  0x77, 0xc3, 0xd4, 0x3d, 0x47, 0x43, 0x7e, 0x3d, 0x0a, 0xd6, 0x9e, 0x3c,
+  0xd0, 0x44, 0x36, 0x3d, 0xe6, 0x8c, 0x6a, 0xbd, 0x50, 0x9c, 0x2e, 0x3d,
+  0x85, 0x41, 0xe7, 0x3d, 0xa5, 0xa7, 0x21, 0x3e, 0x17, 0x10, 0x06, 0xbd,
+  0x60, 0xfa, 0x12, 0x3e, 0x89, 0xc3, 0xe8, 0x3d, 0xfa, 0xcb, 0xa4, 0xbc,
+  0xf5, 0xc9, 0xd8, 0x3c, 0x8d, 0x33, 0x2b, 0x3d, 0x2d, 0x0e, 0x50, 0x3d,
+  0xda, 0xe3, 0x92, 0x3d, 0xe1, 0xe1, 0xf9, 0xbd, 0x36, 0x6e, 0x48, 0x3d,
+  0x40, 0x01, 0x50, 0x3d, 0xb2, 0x9c, 0x75, 0xbe, 0xe7, 0x8e, 0xd7, 0xbc,
+  0x50, 0x1b, 0x83, 0x3c, 0x22, 0x2e, 0xc1, 0x3d, 0x40, 0x4b, 0x93, 0x3d,
+  0xdf, 0x78, 0x84, 0xbe, 0x82, 0x4d, 0xa5, 0x3d, 0x78, 0x8b, 0x06, 0x3d,
+  0xe7, 0xa6, 0xd4, 0xbe, 0x99, 0x4a, 0x76, 0x3d, 0x28, 0x70, 0x72, 0x3d,
+  0x5e, 0xa5, 0xb5, 0x3d, 0x84, 0xa6, 0x14, 0x3d, 0x74, 0x16, 0x86, 0xbe,
+  0x21, 0x4c, 0xaf, 0x3c, 0xaa, 0xec, 0xa8, 0x3d, 0xb0, 0xb6, 0x83, 0xbe,
+  0xcc, 0x55, 0xf1, 0x3b, 0x8f, 0x8d, 0xe6, 0xbc, 0x68, 0x6a, 0xfc, 0xbd,
+  0x5c, 0xe4, 0xa5, 0xbc, 0xe9, 0xbd, 0x2c, 0xbe, 0x3e, 0x8c, 0x8a, 0xbd,
+  0xea, 0x11, 0xd0, 0xbd, 0x24, 0x5e, 0x3b, 0xbe, 0xd6, 0x6c, 0xb3, 0xbe,
+  0xa0, 0x2a, 0x7d, 0xbe, 0x49, 0x95, 0x8c, 0xbe, 0xd5, 0xe0, 0xc8, 0xbe,
+  0x59, 0xdb, 0x35, 0xbe, 0x8e, 0x0d, 0xaa, 0xbe, 0x68, 0xfe, 0x72, 0xbe,
+  0x85, 0x57, 0x27, 0xbe, 0x8c, 0xc5, 0xb5, 0xbd, 0xae, 0xfc, 0x5b, 0x3d,
+  0x10, 0x91, 0x0a, 0x3d, 0xa5, 0x93, 0x3e, 0x3d, 0x15, 0x03, 0xf9, 0xbd,
+  0x83, 0x3e, 0xb0, 0x3d, 0x7d, 0x8b, 0xc1, 0x3d, 0xdc, 0x81, 0x1a, 0xbc,
+  0xbc, 0x86, 0xf2, 0x3c, 0x5c, 0x76, 0xe7, 0xbc, 0xde, 0xe5, 0x2e, 0x3d,
+  0xca, 0x2c, 0x25, 0x3d, 0x26, 0x19, 0xda, 0xbd, 0x9d, 0x16, 0xe9, 0x3b,
+  0xc0, 0xb2, 0x20, 0x3d, 0x7a, 0x25, 0x86, 0x3d, 0xc1, 0x57, 0x49, 0xbe,
+  0xb1, 0xbd, 0xea, 0xbd, 0x5a, 0x6b, 0xb0, 0xbd, 0x7d, 0xff, 0x14, 0x3e,
+  0xe9, 0xb1, 0x07, 0x3e, 0xde, 0xe5, 0xb2, 0xbb, 0x54, 0x53, 0x29, 0xbe,
+  0xb6, 0x2e, 0x84, 0x3e, 0x4b, 0xd7, 0x79, 0xbe, 0xf0, 0x4b, 0x59, 0xbd,
+  0x50, 0x9f, 0x99, 0xbd, 0x81, 0x43, 0xb9, 0xbb, 0x5d, 0x4a, 0x12, 0x3e,
+  0x0e, 0x0a, 0xb4, 0xbd, 0xd7, 0x70, 0xbb, 0xbd, 0x61, 0x69, 0x7e, 0x3e,
+  0xae, 0xbf, 0x37, 0xbe, 0xe8, 0x3f, 0x44, 0xbe, 0x61, 0x61, 0x20, 0xbe,
+  0x05, 0xd7, 0x66, 0x3d, 0xa8, 0xe0, 0xce, 0x3d, 0xbd, 0xb4, 0xa7, 0xbd,
+  0x3d, 0x40, 0xae, 0xbd, 0xe9, 0xe7, 0x69, 0x3e, 0x21, 0x29, 0x28, 0xbe,
+  0x7d, 0x97, 0x22, 0xbd, 0x45, 0x78, 0x19, 0x3d, 0x15, 0x75, 0xde, 0xbc,
+  0xb1, 0x94, 0xc0, 0x3d, 0x6b, 0x2a, 0x49, 0xbd, 0x0d, 0x9d, 0xa4, 0xbd,
+  0x0c, 0x1b, 0xf8, 0x3d, 0x1b, 0x4c, 0x4c, 0xbd, 0x12, 0x90, 0xc2, 0x3d,
+  0x93, 0x43, 0xf3, 0x3d, 0x3a, 0x74, 0x3c, 0x3d, 0x76, 0x38, 0x9d, 0x3c,
+  0x7d, 0xbb, 0xe2, 0x3d, 0x21, 0x87, 0xfd, 0x3a, 0x82, 0x0f, 0x89, 0x3d,
+  0x5c, 0x84, 0x00, 0xbd, 0x69, 0xf7, 0x73, 0x3d, 0x15, 0x44, 0x7d, 0x3d,
+  0xbf, 0xdf, 0xf5, 0x3d, 0x40, 0x2f, 0x50, 0x3d, 0x1d, 0xcd, 0xb1, 0x3c,
+  0x06, 0xb9, 0xec, 0xbb, 0x7a, 0xcb, 0x7d, 0x3d, 0x00, 0x0c, 0xe3, 0xba,
+  0x34, 0x67, 0x66, 0x3d, 0xde, 0xaf, 0xee, 0xbb, 0x5a, 0xff, 0x22, 0x3e,
+  0xca, 0xb9, 0xf0, 0xbc, 0x81, 0xc6, 0x00, 0x3d, 0x81, 0xea, 0x89, 0x3c,
+  0x88, 0xb9, 0xb7, 0x3c, 0xd6, 0xab, 0xa5, 0xbd, 0x78, 0x23, 0xb3, 0x3d,
+  0x17, 0x7f, 0x4b, 0x3d, 0x0b, 0x59, 0x19, 0x3e, 0x9c, 0x0f, 0x88, 0x3d,
+  0xf1, 0x28, 0x8b, 0x3d, 0xa9, 0xb2, 0x41, 0xbd, 0xad, 0x11, 0x44, 0xbe,
+  0x59, 0x67, 0x13, 0xbe, 0xa3, 0x47, 0xfc, 0x3c, 0x0a, 0x60, 0x0e, 0xbe,
+  0x6f, 0xf2, 0x1a, 0x3e, 0xf6, 0x38, 0x94, 0x3d, 0xe4, 0x00, 0x4a, 0xbb,
+  0x70, 0x49, 0x06, 0xbd, 0x8e, 0x3d, 0x43, 0xbe, 0x19, 0xcb, 0xfa, 0xbd,
+  0x4e, 0x5e, 0x45, 0xbd, 0x0e, 0xba, 0x32, 0xbe, 0x0a, 0xb5, 0x69, 0xbd,
+  0x50, 0x01, 0xff, 0xbd, 0xbb, 0x95, 0x15, 0xbe, 0x4f, 0xcf, 0x2f, 0xbe,
+  0xd0, 0xe9, 0x38, 0xbe, 0x1b, 0x14, 0xa5, 0xbe, 0x07, 0xfc, 0x9e, 0xbe,
+  0x99, 0x91, 0x3f, 0xbd, 0x35, 0x12, 0xba, 0xbe, 0x37, 0x33, 0x58, 0xbe,
+  0x8b, 0x22, 0x25, 0xbe, 0xf4, 0xc8, 0x44, 0xbe, 0x2e, 0x93, 0xcc, 0xbd,
+  0x6e, 0x1a, 0x68, 0x3d, 0xd6, 0x21, 0xa4, 0x3c, 0xfb, 0x42, 0x6c, 0xbd,
+  0x23, 0xe8, 0x91, 0xbd, 0x72, 0xf6, 0x47, 0xbe, 0xf2, 0x1b, 0x41, 0xbd,
+  0x5d, 0xab, 0x28, 0xbb, 0x68, 0x71, 0x5a, 0x3d, 0xaf, 0x1a, 0xc8, 0x3c,
+  0x5d, 0x54, 0xbb, 0xbd, 0xc4, 0xad, 0xd0, 0xbd, 0x6a, 0x0e, 0xa2, 0x3b,
+  0xc5, 0xc0, 0x95, 0xbd, 0xf8, 0x3d, 0x79, 0xbd, 0x02, 0xf5, 0x96, 0xbd,
+  0x63, 0x00, 0xe1, 0x3c, 0x6c, 0x40, 0xdf, 0xbd, 0x38, 0x10, 0x54, 0xbe,
+  0x04, 0x3c, 0x63, 0xbe, 0xee, 0x8e, 0xff, 0xbd, 0xc0, 0x3a, 0x03, 0xbb,
+  0xde, 0xd4, 0x18, 0xbe, 0xe5, 0x1a, 0x4e, 0xbe, 0x56, 0x20, 0xea, 0x3b,
+  0xee, 0x6f, 0x70, 0xbe, 0x3a, 0xcc, 0xf6, 0xbd, 0xde, 0xc4, 0x15, 0xbe,
+  0xbe, 0x77, 0xd1, 0xbd, 0xd4, 0x2f, 0xa4, 0xbd, 0x0f, 0x65, 0xe5, 0xbd,
+  0x7a, 0x17, 0x25, 0xbe, 0x51, 0xa7, 0x38, 0xbd, 0x00, 0x1e, 0xc5, 0xbd,
+  0x2b, 0xfb, 0x9f, 0xbd, 0x45, 0x5e, 0xe3, 0xbd, 0x46, 0xee, 0x14, 0xbe,
+  0x2f, 0x18, 0x8e, 0xbc, 0x0e, 0x78, 0xd8, 0xbd, 0x47, 0xfb, 0x25, 0xbe,
+  0x3c, 0x9b, 0xea, 0x3d, 0xa8, 0x30, 0x9c, 0xbd, 0xa4, 0x33, 0x08, 0xbd,
+  0xcb, 0x3a, 0xf3, 0x3c, 0xfa, 0x16, 0x4a, 0xbd, 0xa0, 0xb5, 0xb6, 0x3d,
+  0xf2, 0xe0, 0x46, 0xbc, 0xa1, 0xe0, 0x05, 0xbd, 0xa9, 0xe8, 0x5b, 0x3d,
+  0xa9, 0x60, 0x0f, 0x3d, 0xfc, 0x17, 0xae, 0x3d, 0x7b, 0xaf, 0x4f, 0x3d,
+  0x47, 0x1a, 0xc3, 0x3d, 0xde, 0x05, 0x00, 0x3d, 0xc1, 0x66, 0x7c, 0x3b,
+  0x06, 0x60, 0xe6, 0x3d, 0x00, 0xe6, 0x1e, 0x3d, 0x2e, 0xcd, 0x4e, 0x3d,
+  0x22, 0xd7, 0x70, 0x3d, 0xa1, 0xd6, 0x9f, 0xbd, 0x76, 0x59, 0xde, 0x3c,
+  0xfa, 0x1b, 0x28, 0x3d, 0x50, 0xeb, 0x87, 0xbd, 0x29, 0xa8, 0x11, 0x3d,
+  0x4a, 0xf0, 0x1c, 0x3e, 0x68, 0x05, 0x3b, 0xbb, 0x3a, 0x29, 0x85, 0x3d,
+  0x60, 0x4c, 0x8a, 0xbd, 0x6a, 0x4c, 0xc0, 0x3d, 0xc9, 0xb8, 0x3d, 0x3e,
+  0x42, 0x78, 0x78, 0xbc, 0xa5, 0xcc, 0x4f, 0xbd, 0x95, 0x70, 0x3b, 0x3e,
+  0x7f, 0x04, 0x8a, 0x3c, 0x7b, 0xb9, 0x48, 0xbb, 0xc9, 0x88, 0xe8, 0xbd,
+  0x62, 0x8a, 0x01, 0xbd, 0x7e, 0x4a, 0x3e, 0x3e, 0xfc, 0x29, 0xf9, 0xbd,
+  0x11, 0xac, 0xb2, 0xbd, 0x89, 0x09, 0xdb, 0x3d, 0xdd, 0xf4, 0x8c, 0xbc,
+  0x0d, 0x4f, 0x3b, 0xbe, 0x25, 0x3c, 0x1c, 0xbe, 0xfd, 0x04, 0xca, 0xbd,
+  0xe0, 0x4a, 0xbf, 0xbb, 0x5f, 0x29, 0x36, 0xbe, 0x30, 0xb1, 0xba, 0xbd,
+  0x73, 0xd4, 0x9e, 0xbc, 0xaa, 0xe3, 0x3b, 0xbe, 0x96, 0xa1, 0x18, 0xbe,
+  0xbb, 0x07, 0xc4, 0xbc, 0xad, 0xa1, 0x71, 0xbe, 0x33, 0xf0, 0x1f, 0xbe,
+  0xb4, 0xea, 0x5e, 0xbe, 0x3f, 0x2c, 0x74, 0xbd, 0x2d, 0xa4, 0x30, 0xbe,
+  0xf8, 0xbb, 0xf5, 0xbd, 0x68, 0xe8, 0x81, 0xbd, 0x16, 0x1f, 0x06, 0xbd,
+  0x41, 0x43, 0xf8, 0xbd, 0x80, 0x63, 0x4c, 0xbe, 0xfd, 0x6b, 0x4c, 0xbc,
+  0xca, 0xa0, 0x44, 0xbe, 0x60, 0xf2, 0x17, 0xba, 0x2d, 0xfc, 0xe8, 0x3d,
+  0xb9, 0x7e, 0x7c, 0x3d, 0xae, 0x02, 0xc5, 0x3d, 0x3a, 0x51, 0xb9, 0x3d,
+  0xca, 0x0a, 0xb5, 0xbd, 0x69, 0xdb, 0x12, 0xbc, 0xcf, 0x10, 0xb6, 0x3d,
+  0xb3, 0x00, 0xfc, 0x3d, 0x83, 0xbc, 0x9b, 0x3d, 0xff, 0x76, 0xe6, 0xbb,
+  0xb0, 0x68, 0x23, 0x3d, 0x09, 0xe0, 0x0a, 0xbd, 0x71, 0xb8, 0x65, 0xbe,
+  0x8b, 0x41, 0xcb, 0x3d, 0x45, 0x6f, 0x0b, 0x3e, 0x96, 0x0e, 0x94, 0xbc,
+  0x65, 0x3f, 0x5d, 0x3d, 0xfb, 0xb0, 0x34, 0xbe, 0xf9, 0x12, 0x01, 0xbe,
+  0xf3, 0x64, 0xf9, 0xbd, 0x06, 0x89, 0x02, 0xbe, 0x23, 0x5a, 0x25, 0xbe,
+  0xec, 0x20, 0xa2, 0xbd, 0xc9, 0xd3, 0xde, 0xbc, 0x99, 0xe4, 0xb2, 0xbd,
+  0x75, 0x26, 0x1d, 0xbe, 0xf4, 0x50, 0x76, 0xbe, 0xe3, 0x66, 0xf1, 0xbd,
+  0x54, 0x34, 0x0a, 0x3e, 0xfb, 0x47, 0x2e, 0xbe, 0x4f, 0x05, 0x03, 0xbe,
+  0x0d, 0xc4, 0x3f, 0xbd, 0x96, 0x3d, 0xfd, 0xbd, 0x74, 0xe2, 0x36, 0xbe,
+  0xa1, 0x68, 0x02, 0xbe, 0x86, 0x9f, 0x1f, 0xbe, 0x64, 0x1a, 0x3f, 0x3e,
+  0xf7, 0x00, 0x03, 0xbe, 0x67, 0xd2, 0xdc, 0xbd, 0x0f, 0x31, 0x89, 0xbd,
+  0x91, 0x7a, 0x8d, 0xbd, 0xcc, 0xb2, 0x33, 0xbd, 0x11, 0x41, 0xfa, 0xbd,
+  0xdc, 0x73, 0x8e, 0xbd, 0x23, 0x06, 0x95, 0x3d, 0x36, 0x56, 0xb7, 0xbd,
+  0x94, 0x2e, 0x73, 0xbd, 0x55, 0x70, 0x9a, 0xbd, 0xb7, 0x36, 0x31, 0x3c,
+  0xcf, 0x50, 0x12, 0x3d, 0x89, 0xe1, 0xb0, 0xbd, 0x01, 0x3d, 0x20, 0x3d,
+  0x72, 0xa8, 0x28, 0x3e, 0x0b, 0x01, 0x75, 0xbc, 0x9b, 0xd5, 0x76, 0xbd,
+  0xcd, 0x6b, 0xb6, 0x3d, 0xbc, 0xb4, 0x20, 0x3d, 0xca, 0x2e, 0x0d, 0xbd,
+  0xdf, 0xf5, 0xb2, 0xbd, 0x57, 0x03, 0x85, 0xbc, 0xab, 0x5d, 0x3d, 0x3e,
+  0x42, 0x54, 0x1e, 0xbd, 0xec, 0x3f, 0x88, 0xbd, 0x7f, 0x9a, 0x15, 0x3e,
+  0xa0, 0x76, 0x04, 0x3c, 0x8e, 0xb2, 0xa9, 0xbb, 0x22, 0xd8, 0x96, 0xbd,
+  0xd9, 0x72, 0x9e, 0x3b, 0x65, 0x4c, 0x2f, 0x3e, 0x87, 0xb0, 0xc5, 0xbd,
+  0x42, 0x2f, 0x41, 0x3d, 0x65, 0x29, 0x67, 0x3d, 0x61, 0x8b, 0xc3, 0x3d,
+  0xca, 0x69, 0x30, 0xbd, 0x5e, 0xcf, 0x2f, 0xbd, 0x64, 0xd6, 0x8c, 0xbd,
+  0x97, 0x1d, 0xa9, 0xbd, 0x5e, 0x92, 0x4a, 0x3c, 0x44, 0xec, 0x1c, 0x3d,
+  0x3a, 0x4b, 0x9f, 0xbd, 0x5f, 0x6a, 0x8b, 0x3d, 0xc4, 0xc8, 0x91, 0xbd,
+  0x43, 0xc5, 0x0a, 0xbd, 0x1b, 0xea, 0x43, 0xbe, 0x3e, 0xf2, 0x42, 0xbe,
+  0x12, 0x99, 0xb7, 0xbd, 0x09, 0x8d, 0xd9, 0xbc, 0x7d, 0xc0, 0x9f, 0xbd,
+  0x90, 0x7e, 0x0f, 0xbd, 0x16, 0xd5, 0xc1, 0xbc, 0xb5, 0x54, 0x6f, 0xbc,
+  0x6d, 0xb8, 0xac, 0xbd, 0xa5, 0x94, 0x9d, 0xbe, 0x9b, 0x59, 0x27, 0xbd,
+  0x08, 0x77, 0x1a, 0x3d, 0x21, 0xea, 0x00, 0xbe, 0x12, 0x07, 0x4a, 0x3d,
+  0xd6, 0x6f, 0x6a, 0x3b, 0xcd, 0x98, 0x29, 0xbe, 0x41, 0xb1, 0x57, 0x3d,
+  0x9e, 0x82, 0x9a, 0xbd, 0xbd, 0x8f, 0x91, 0x3c, 0x70, 0x02, 0x00, 0xbe,
+  0x80, 0x09, 0x90, 0xbd, 0xd9, 0x1b, 0x23, 0x3e, 0xae, 0x3b, 0x9e, 0x3d,
+  0xf0, 0x9a, 0xe5, 0x3d, 0x3a, 0x0b, 0xc2, 0x3d, 0x53, 0x9f, 0x36, 0xbe,
+  0xec, 0xe8, 0x3b, 0x3d, 0xc4, 0x38, 0x14, 0x3e, 0x12, 0x81, 0xbe, 0x3c,
+  0x41, 0xbf, 0x10, 0x3e, 0x93, 0x32, 0xc7, 0x3d, 0xf6, 0xba, 0x10, 0x3e,
+  0x6b, 0xa9, 0xaa, 0x3d, 0x79, 0xf1, 0x32, 0xbe, 0x31, 0x64, 0xa5, 0x3d,
+  0x37, 0x7e, 0x93, 0x3d, 0x13, 0xe8, 0xcb, 0x3d, 0xd8, 0xf6, 0x09, 0x3d,
+  0xbc, 0x7a, 0x83, 0x3a, 0x1e, 0xe0, 0x89, 0x3b, 0x18, 0x3f, 0xd0, 0xbd,
+  0xa8, 0x72, 0x9d, 0x3d, 0x37, 0xd0, 0x49, 0xbd, 0xed, 0xc0, 0x67, 0x3c,
+  0x2f, 0x60, 0x01, 0x3e, 0x1c, 0x5e, 0x12, 0x3d, 0x38, 0xe5, 0x20, 0xbe,
+  0x89, 0x0b, 0x61, 0xbe, 0x48, 0x2a, 0xac, 0xbd, 0x6d, 0x53, 0x6c, 0x3e,
+  0x25, 0xa6, 0xdb, 0xbd, 0xef, 0x05, 0x2d, 0xbe, 0x6f, 0x1d, 0x7b, 0x3e,
+  0x27, 0x0b, 0xae, 0xbd, 0xdf, 0x05, 0x04, 0xbe, 0x28, 0x68, 0x67, 0xbe,
+  0xbc, 0xba, 0xef, 0xbd, 0x7c, 0x1a, 0x9b, 0x3e, 0xb9, 0xdf, 0x77, 0xbe,
+  0x03, 0x5d, 0x48, 0xbe, 0x40, 0x27, 0x25, 0x3e, 0x60, 0xe5, 0xa7, 0xbb,
+  0x7f, 0x74, 0xc2, 0xbd, 0xed, 0x66, 0x6c, 0xbe, 0xd5, 0xfc, 0x8f, 0xbd,
+  0x37, 0xce, 0xe7, 0x3e, 0x9a, 0xd5, 0xc4, 0xbd, 0x1b, 0xab, 0xf3, 0xbd,
+  0x81, 0x5b, 0x52, 0x3e, 0xdc, 0xc4, 0x9b, 0x3d, 0xb4, 0xe6, 0xa8, 0xbd,
+  0x18, 0x9c, 0x3e, 0xbe, 0xb8, 0xc5, 0x89, 0xbd, 0x90, 0x31, 0xfa, 0x3e,
+  0xa2, 0xaf, 0x0e, 0xbe, 0x82, 0xea, 0x20, 0xbd, 0xae, 0xbe, 0x86, 0x3e,
+  0xc2, 0xaf, 0xcc, 0x3d, 0x5d, 0x5e, 0xf8, 0xbc, 0x75, 0xd4, 0x44, 0xbb,
+  0x98, 0x5e, 0xc1, 0xbd, 0xaa, 0xcf, 0x25, 0x3e, 0x6d, 0x5a, 0xda, 0xbd,
+  0x26, 0x17, 0xc4, 0x3a, 0x3f, 0xb7, 0xd4, 0x3c, 0x4f, 0xcf, 0xc3, 0x3d,
+  0xe6, 0xae, 0x43, 0xbc, 0x2b, 0x3e, 0x58, 0x3d, 0x20, 0x23, 0x04, 0xbc,
+  0x31, 0xb8, 0x4e, 0x3b, 0xa2, 0x41, 0x98, 0x3d, 0x69, 0xe9, 0x86, 0x3b,
+  0xed, 0x3b, 0x1f, 0xbe, 0xb1, 0xd8, 0xba, 0x3c, 0x01, 0xfc, 0xae, 0xbb,
+  0x4c, 0xee, 0x38, 0x3d, 0x66, 0x93, 0x42, 0xbd, 0x0a, 0x29, 0x63, 0xbe,
+  0x71, 0xd2, 0xb6, 0x3b, 0xac, 0xff, 0xad, 0x3d, 0xb5, 0x7d, 0x5b, 0xbe,
+  0xdf, 0xca, 0xd7, 0xbc, 0x4e, 0xdb, 0xda, 0x3c, 0xcc, 0xdc, 0x3f, 0x3d,
+  0xaf, 0x70, 0x13, 0xbe, 0x57, 0x99, 0x97, 0xbe, 0xf1, 0x37, 0x31, 0x3d,
+  0x29, 0x9c, 0x5e, 0xbc, 0x5d, 0xcd, 0xae, 0xbe, 0x85, 0x98, 0x98, 0x3d,
+  0xa4, 0xf3, 0x94, 0x3d, 0x93, 0x68, 0xef, 0x3d, 0x0f, 0x00, 0x2a, 0x3d,
+  0x74, 0x84, 0x37, 0xbe, 0xd4, 0xa0, 0x8f, 0x3d, 0xbf, 0xd7, 0x4d, 0x3d,
+  0x2b, 0xfa, 0x6d, 0xbe, 0x24, 0x76, 0xb7, 0xbd, 0xd3, 0x24, 0x9b, 0x3d,
+  0xa9, 0x93, 0x7e, 0xbe, 0x9b, 0xba, 0xbc, 0xbd, 0x6e, 0xa4, 0x48, 0xbe,
+  0xb9, 0x2a, 0x57, 0xbe, 0x86, 0x27, 0x47, 0xbe, 0x56, 0xde, 0x06, 0xbe,
+  0xae, 0xbe, 0xb4, 0x3b, 0x5b, 0x0e, 0xba, 0x3d, 0x71, 0x10, 0xea, 0x3d,
+  0xf0, 0x45, 0xac, 0x3d, 0x87, 0xb0, 0xed, 0xbd, 0x64, 0x2f, 0x93, 0x3d,
+  0x39, 0xfc, 0x6a, 0x3d, 0xf5, 0x90, 0x04, 0x3d, 0x7e, 0xa2, 0xf9, 0x3d,
+  0xbd, 0x25, 0x1b, 0x3e, 0xc5, 0x2b, 0x0a, 0x3e, 0xd6, 0xcb, 0x21, 0x3e,
+  0xd8, 0x9a, 0xfc, 0xbc, 0x55, 0x0c, 0xcf, 0x3d, 0x71, 0xbc, 0x8e, 0x3d,
+  0x40, 0xe8, 0x9f, 0x3d, 0xf9, 0x44, 0x96, 0x3d, 0x9a, 0x89, 0x88, 0x3d,
+  0x23, 0x26, 0x90, 0x3d, 0x57, 0xa5, 0xce, 0x3d, 0x8f, 0x47, 0xca, 0x3c,
+  0x27, 0xc3, 0x31, 0xbc, 0x4c, 0x38, 0x8d, 0x3d, 0x5f, 0x25, 0xa8, 0x3d,
+  0x49, 0xaf, 0xe9, 0x3d, 0xda, 0x53, 0xa0, 0xbc, 0x19, 0x43, 0xf4, 0xbd,
+  0xac, 0x46, 0x41, 0x3c, 0x32, 0x5d, 0x39, 0x3d, 0xbf, 0xb7, 0x65, 0xbd,
+  0x67, 0x45, 0x54, 0x3d, 0x37, 0x38, 0x02, 0x3e, 0x7b, 0xf3, 0x9b, 0x3d,
+  0xee, 0xd0, 0xa1, 0xbd, 0xc7, 0x9c, 0x46, 0xbe, 0x40, 0xb8, 0x65, 0xbd,
+  0x4c, 0xdc, 0xca, 0x3d, 0xcf, 0xba, 0xf1, 0xbd, 0x14, 0x73, 0x01, 0xbe,
+  0xb8, 0xdf, 0x0a, 0x3e, 0x68, 0x1b, 0x13, 0xbc, 0x9c, 0x76, 0x1b, 0xbe,
+  0x50, 0x61, 0x2b, 0xbe, 0x44, 0x7f, 0xe9, 0xbd, 0x84, 0x4f, 0x79, 0x3e,
+  0x05, 0xbc, 0x55, 0xbe, 0x44, 0x1d, 0x9d, 0xbd, 0xd3, 0x68, 0x64, 0x3d,
+  0x04, 0xfc, 0x73, 0x3d, 0x09, 0xf1, 0x98, 0xbd, 0x58, 0x53, 0xee, 0xbd,
+  0x6a, 0xb0, 0x5f, 0xbd, 0xf4, 0xe2, 0xf3, 0x3d, 0x6d, 0x94, 0x0d, 0xbe,
+  0x1f, 0xd9, 0xa1, 0xbd, 0x2f, 0xbf, 0x49, 0x3d, 0xf3, 0xe6, 0x01, 0x3d,
+  0x09, 0x05, 0x1c, 0x3d, 0xf9, 0xe5, 0x9a, 0x3b, 0xb8, 0xa1, 0x22, 0x3d,
+  0xbf, 0xf3, 0x08, 0x3e, 0x21, 0x41, 0x3c, 0x3d, 0x5b, 0x04, 0x75, 0x3d,
+  0xe5, 0x86, 0x44, 0xbd, 0xf5, 0x5f, 0x2c, 0x3d, 0x86, 0x05, 0x12, 0x3e,
+  0xc8, 0x6c, 0x56, 0x3d, 0x82, 0x81, 0xf6, 0x3d, 0xdc, 0x7d, 0x07, 0xbe,
+  0x78, 0x1f, 0x33, 0x3d, 0x02, 0x92, 0xda, 0x3c, 0x31, 0x4a, 0x06, 0xbe,
+  0x84, 0x4e, 0xa6, 0x3d, 0xae, 0x83, 0x6c, 0x3c, 0x30, 0x41, 0x14, 0xbd,
+  0x25, 0xb8, 0x85, 0xbc, 0x10, 0x65, 0x9e, 0xbe, 0xa1, 0x95, 0x98, 0xbc,
+  0x4d, 0x0e, 0x18, 0xbd, 0xa2, 0x7a, 0xb3, 0xbe, 0x14, 0x47, 0x2c, 0x3c,
+  0xf0, 0x67, 0xb8, 0x3d, 0x6f, 0x6e, 0xdb, 0x3c, 0xb5, 0x26, 0x24, 0x3d,
+  0x99, 0x0d, 0x9b, 0xbe, 0x30, 0x84, 0xb6, 0x3d, 0x03, 0x8a, 0x94, 0x3d,
+  0x17, 0x1e, 0x90, 0xbe, 0x63, 0xe6, 0xf4, 0xbb, 0xd3, 0xdb, 0xbb, 0xbc,
+  0x5e, 0xeb, 0x3c, 0x39, 0xbb, 0xa8, 0x0d, 0x3d, 0xd8, 0x87, 0xe5, 0xbd,
+  0xac, 0xf4, 0x24, 0xbd, 0xc1, 0xaa, 0x19, 0xbd, 0x99, 0x27, 0x4c, 0xbe,
+  0x89, 0x66, 0x93, 0xbd, 0x7e, 0x91, 0x3b, 0xbe, 0xd7, 0x42, 0xa3, 0xbe,
+  0x47, 0x27, 0x20, 0xbe, 0xfc, 0x3e, 0x2b, 0xbe, 0x2b, 0x85, 0x74, 0xbe,
+  0x00, 0x99, 0x1d, 0xbe, 0x09, 0x5d, 0xf6, 0xbd, 0xdf, 0xbd, 0x2a, 0x3d,
+  0xd8, 0xb7, 0xa6, 0x3d, 0x92, 0x83, 0x9c, 0xbc, 0x4c, 0xd3, 0x86, 0x3d,
+  0x0b, 0x22, 0x87, 0xbd, 0xbc, 0x37, 0x1d, 0xbd, 0x05, 0xf1, 0xff, 0x3c,
+  0xae, 0xf8, 0x27, 0x3d, 0x26, 0xf8, 0x11, 0x3e, 0xf9, 0x8a, 0x80, 0xbb,
+  0x75, 0xa3, 0xce, 0x3d, 0xad, 0x13, 0xe0, 0x3d, 0x88, 0x27, 0x90, 0xbd,
+  0x76, 0x6e, 0x1d, 0x3d, 0x49, 0x18, 0xaa, 0x3c, 0x0d, 0xfd, 0x19, 0x3e,
+  0xab, 0xd0, 0x5d, 0x3d, 0x98, 0x23, 0xf1, 0x3d, 0x92, 0x50, 0xee, 0xbc,
+  0xda, 0x85, 0x02, 0x3e, 0xad, 0xfe, 0xd4, 0x3d, 0xec, 0x8c, 0x35, 0x3d,
+  0x50, 0x79, 0xdc, 0x3d, 0x61, 0x66, 0xd2, 0x3c, 0x9f, 0xbf, 0xaa, 0x3d,
+  0x39, 0xcf, 0xb8, 0x3c, 0xd3, 0x9d, 0x67, 0x3d, 0x6c, 0xf0, 0xe4, 0x3d,
+  0x73, 0x17, 0xc5, 0x3d, 0x64, 0x97, 0xd8, 0xbc, 0x50, 0xc7, 0x96, 0xbb,
+  0xed, 0x9c, 0xdb, 0x3c, 0x90, 0xda, 0x9a, 0x3d, 0xc9, 0xbd, 0x93, 0xbd,
+  0xb1, 0xdd, 0x93, 0xbd, 0xf8, 0xbb, 0x8c, 0xbc, 0x00, 0xf6, 0xcf, 0x3c,
+  0x80, 0x86, 0x92, 0xbc, 0x48, 0x5f, 0x6b, 0x3d, 0xd4, 0xea, 0xaf, 0x39,
+  0x63, 0x70, 0x5c, 0xbd, 0x22, 0x7c, 0xb5, 0xbd, 0x66, 0x19, 0x02, 0xbd,
+  0xf9, 0x9c, 0xd0, 0xbd, 0x29, 0xa8, 0xbb, 0x3b, 0xb4, 0xe9, 0xa1, 0xbd,
+  0x79, 0x38, 0x8d, 0xbd, 0x0f, 0x2a, 0x43, 0xbd, 0xe3, 0x0d, 0x9d, 0x3b,
+  0x40, 0xd9, 0xb0, 0x3d, 0x8a, 0x97, 0x27, 0x3d, 0xcf, 0x3c, 0xb1, 0x3d,
+  0x3b, 0xed, 0x4f, 0x3c, 0x60, 0xc1, 0x1e, 0x3d, 0x45, 0x08, 0xcf, 0x3b,
+  0x64, 0x43, 0x05, 0x3d, 0xc7, 0xeb, 0x07, 0xbd, 0xe3, 0x8f, 0xfb, 0x3d,
+  0x86, 0x7b, 0x91, 0x3d, 0x37, 0x2f, 0x26, 0x3c, 0xaa, 0x51, 0xdb, 0xbb,
+  0x54, 0x29, 0x92, 0xbc, 0x2a, 0x5d, 0xbc, 0x3c, 0x32, 0xea, 0x89, 0xbd,
+  0x3a, 0x89, 0x3e, 0xbd, 0xc0, 0x9d, 0xca, 0x3d, 0x4d, 0x76, 0x88, 0x3d,
+  0xdd, 0xa8, 0x72, 0x3d, 0xcd, 0x8a, 0xe5, 0xbd, 0xe7, 0xb9, 0xa4, 0x3d,
+  0x01, 0xb5, 0x0b, 0x3b, 0x7e, 0x06, 0x00, 0xbe, 0x97, 0x17, 0x85, 0xbd,
+  0xc1, 0x29, 0xa4, 0xbc, 0xc8, 0x8f, 0x78, 0x3d, 0x19, 0x14, 0x16, 0x3d,
+  0x6a, 0xfb, 0x5c, 0xbe, 0x19, 0x82, 0xc0, 0x3d, 0xe5, 0xcd, 0x61, 0x3b,
+  0x7d, 0xcd, 0x84, 0xbe, 0x14, 0xe5, 0x87, 0xbd, 0x71, 0x62, 0xad, 0x3d,
+  0x8f, 0xe4, 0x07, 0xbd, 0xdd, 0x6a, 0xef, 0x3b, 0x32, 0x4c, 0xc6, 0xbd,
+  0x98, 0xfa, 0x20, 0xbd, 0x44, 0xd7, 0x93, 0xbd, 0xfb, 0x4d, 0x24, 0xbe,
+  0x62, 0xd4, 0x6e, 0xbc, 0xca, 0x8f, 0x48, 0x3d, 0x74, 0x75, 0xc8, 0xbd,
+  0xda, 0x69, 0xbb, 0x3c, 0xeb, 0x0b, 0x35, 0xbe, 0x8f, 0x7d, 0xab, 0xbd,
+  0xa0, 0x1b, 0xf6, 0xbd, 0x68, 0xb2, 0x0c, 0xbe, 0x85, 0x02, 0xde, 0xbd,
+  0x2b, 0x1c, 0x70, 0xbd, 0x78, 0xee, 0xa6, 0xbd, 0xef, 0x20, 0x57, 0xbe,
+  0x1b, 0xd1, 0x3f, 0xbe, 0x37, 0x71, 0x36, 0xbe, 0xf5, 0x9e, 0x0c, 0xbe,
+  0xa9, 0xa5, 0xd0, 0xbd, 0xe2, 0x61, 0x9f, 0x3d, 0xef, 0x86, 0xc4, 0x3d,
+  0x55, 0x38, 0x70, 0x3d, 0xc1, 0xd2, 0x05, 0x3e, 0x4f, 0x1a, 0xdf, 0xbd,
+  0x20, 0x06, 0xde, 0x3d, 0x18, 0x58, 0x55, 0x3d, 0x88, 0xd9, 0x41, 0x3d,
+  0x59, 0x90, 0x11, 0x3e, 0x7f, 0xe8, 0x27, 0x3d, 0x8b, 0x04, 0x3d, 0x3d,
+  0xb0, 0x67, 0x3b, 0x3d, 0x30, 0x6c, 0x10, 0xbe, 0x51, 0xea, 0xba, 0x3c,
+  0x45, 0xb7, 0xb6, 0x3d, 0xaa, 0xdb, 0x6b, 0x3d, 0x6e, 0xf3, 0xf6, 0x3d,
+  0xc6, 0xf3, 0x5a, 0x3d, 0xab, 0xf6, 0xab, 0xba, 0xc7, 0xea, 0x0a, 0x3c,
+  0x82, 0xfd, 0x82, 0xbd, 0x37, 0x37, 0x22, 0x3d, 0xff, 0xa9, 0xf9, 0x3c,
+  0x46, 0xe7, 0xa9, 0x3e, 0x0b, 0x2a, 0x62, 0x3b, 0x6b, 0x42, 0x95, 0x3a,
+  0x6e, 0xe8, 0x07, 0xbb, 0xeb, 0x1b, 0x9d, 0x3c, 0xab, 0x71, 0x0a, 0xbd,
+  0x3f, 0xb4, 0xfc, 0xbb, 0x8a, 0x98, 0xf0, 0x3d, 0xcf, 0x78, 0x80, 0x3e,
+  0xa0, 0xef, 0xa4, 0xbc, 0x2d, 0xd5, 0xe7, 0x3d, 0x44, 0x6f, 0xb6, 0xba,
+  0xde, 0xbb, 0xac, 0x3d, 0x80, 0xa7, 0x1c, 0xbc, 0xde, 0x9c, 0xaf, 0x3d,
+  0xcb, 0xaf, 0x81, 0x3d, 0xcd, 0x50, 0x18, 0x3e, 0x0d, 0x0a, 0x04, 0x3d,
+  0x3a, 0xfd, 0xbe, 0x3d, 0xc0, 0xb0, 0x0d, 0xbc, 0x9a, 0xc0, 0x90, 0x3b,
+  0xcf, 0x41, 0x15, 0x3c, 0x34, 0xc7, 0x71, 0x3d, 0x2a, 0xa1, 0x36, 0x3b,
+  0x25, 0xf3, 0x29, 0x3e, 0x44, 0x77, 0x39, 0x3d, 0x67, 0x78, 0xe0, 0x3b,
+  0x87, 0xf3, 0xdf, 0xbb, 0xcb, 0xfc, 0xd0, 0x3c, 0x16, 0x66, 0xb2, 0xbd,
+  0xa2, 0x99, 0xff, 0x3b, 0x49, 0x5c, 0x19, 0xbd, 0xea, 0xc2, 0xd4, 0x3d,
+  0xf0, 0xd6, 0x90, 0xbd, 0xe3, 0xbf, 0xaf, 0x3d, 0x0e, 0x4d, 0x87, 0xbc,
+  0x15, 0x03, 0xc5, 0x3d, 0xc9, 0x23, 0xf6, 0x3b, 0xa4, 0xbf, 0x22, 0xbd,
+  0xb8, 0x7e, 0xe1, 0x3a, 0xf9, 0xbf, 0xa4, 0xbd, 0x5e, 0x0d, 0x87, 0xbd,
+  0x4b, 0x9d, 0x85, 0x3c, 0xf1, 0x46, 0x4f, 0x3d, 0x13, 0x5a, 0x6a, 0x3c,
+  0x92, 0x3d, 0x9a, 0xbd, 0x2b, 0xb7, 0x4d, 0xbd, 0x87, 0x99, 0xb7, 0x3c,
+  0x1e, 0x83, 0x99, 0xbd, 0xc9, 0xc1, 0x04, 0xbd, 0x44, 0x11, 0x8d, 0x3d,
+  0x1e, 0xa6, 0x69, 0xbd, 0xc0, 0xfd, 0x99, 0x3d, 0x36, 0x80, 0x0a, 0xbe,
+  0xf0, 0x64, 0x95, 0x3d, 0x5b, 0x30, 0x84, 0xbc, 0x58, 0x30, 0x54, 0xbe,
+  0x32, 0x07, 0xe4, 0xbd, 0x29, 0xee, 0x75, 0x3d, 0xc5, 0xfe, 0x84, 0xbd,
+  0x1a, 0xe9, 0x2d, 0x3d, 0xf4, 0x86, 0xa2, 0xbd, 0xcf, 0xac, 0x84, 0xbd,
+  0x58, 0xe7, 0xc7, 0xbd, 0xe1, 0xe7, 0x0f, 0xbe, 0x04, 0x1c, 0x05, 0xbe,
+  0x37, 0x5c, 0x1b, 0xbd, 0x9e, 0xde, 0x23, 0xbe, 0x8a, 0xc4, 0xb4, 0xbc,
+  0x69, 0x60, 0x36, 0xbe, 0x79, 0x53, 0x08, 0xbe, 0xa8, 0x04, 0x17, 0xbe,
+  0x91, 0x90, 0x2b, 0xbe, 0x6e, 0xed, 0x59, 0xbd, 0x75, 0x5e, 0x0e, 0xbe,
+  0x32, 0xa9, 0x14, 0xbe, 0x7c, 0xf0, 0x71, 0xbd, 0xb6, 0x14, 0x54, 0xbe,
+  0xd3, 0xc1, 0x3b, 0xbc, 0x49, 0xb5, 0xa7, 0xbd, 0x86, 0x4d, 0xc5, 0xbd,
+  0xac, 0x2e, 0x8e, 0xbd, 0x18, 0xdf, 0x86, 0x3d, 0x2e, 0xeb, 0xea, 0x3c,
+  0xd2, 0xad, 0x3f, 0x3d, 0xdf, 0x7c, 0x72, 0xbd, 0xa3, 0xb7, 0xcd, 0x3d,
+  0x0b, 0x85, 0xa8, 0x3d, 0x4e, 0xf7, 0x16, 0xbe, 0x3d, 0x7c, 0xb6, 0x3c,
+  0xf7, 0xf1, 0xaa, 0x3d, 0xc1, 0xe8, 0xe2, 0xba, 0xab, 0xd3, 0xc5, 0x3d,
+  0xd7, 0x2f, 0x15, 0xbd, 0x17, 0xac, 0x33, 0x3d, 0xbd, 0xf8, 0xad, 0x3c,
+  0xc0, 0xd1, 0xf9, 0xbd, 0x6d, 0xe2, 0xe7, 0x3d, 0x30, 0x20, 0x7d, 0x3d,
+  0x93, 0x87, 0xe8, 0x3d, 0x19, 0xb1, 0x27, 0x3e, 0x85, 0xa7, 0x6e, 0x3d,
+  0x77, 0xd2, 0x2e, 0x3d, 0x72, 0x45, 0xf0, 0x3d, 0x6e, 0xe7, 0xa1, 0xbd,
+  0xf2, 0x5c, 0x04, 0x3e, 0x75, 0x26, 0xaa, 0x3d, 0x99, 0x3f, 0x0c, 0x3e,
+  0xf3, 0x01, 0xfa, 0x3d, 0x26, 0xfd, 0xa2, 0x3c, 0xdd, 0x1f, 0x0f, 0x3e,
+  0x21, 0xd8, 0xb7, 0x3d, 0xdc, 0xf2, 0xa2, 0xbd, 0x13, 0x8b, 0x2c, 0x3e,
+  0x91, 0x2f, 0x9d, 0x3d, 0x81, 0x69, 0xe4, 0x3d, 0xbb, 0x95, 0xdf, 0x3d,
+  0x6f, 0xed, 0x88, 0x3d, 0x7b, 0x06, 0xc8, 0x3c, 0x87, 0xa6, 0x2b, 0x3e,
+  0x82, 0xeb, 0x95, 0xbd, 0x04, 0x4f, 0xed, 0x3d, 0x13, 0xd7, 0x05, 0x3e,
+  0xa5, 0x7e, 0xe7, 0x3d, 0x77, 0x7c, 0xec, 0x3d, 0xaa, 0xe5, 0x98, 0x3a,
+  0x49, 0x9e, 0x64, 0x3d, 0xca, 0x06, 0xcc, 0x3d, 0x5e, 0x80, 0xd0, 0x3c,
+  0x6f, 0xc1, 0x63, 0x3c, 0x04, 0xa3, 0x7c, 0xbc, 0x6c, 0xce, 0xa6, 0xbd,
+  0x0a, 0x40, 0xa0, 0x3d, 0xfa, 0x99, 0xbe, 0xbc, 0xff, 0xd4, 0x34, 0x3d,
+  0xe9, 0x5d, 0x98, 0x3d, 0x04, 0xdd, 0x65, 0xbd, 0x08, 0x84, 0xa1, 0xbc,
+  0x5d, 0x1b, 0x09, 0xbc, 0x8b, 0x73, 0x5e, 0xbd, 0x4e, 0x49, 0x60, 0x3d,
+  0xdf, 0xd9, 0x1f, 0x3a, 0xbd, 0x87, 0xd4, 0x3c, 0x69, 0xa8, 0x5a, 0x3d,
+  0x63, 0x2d, 0x08, 0xbd, 0x8c, 0xbb, 0x86, 0xbd, 0x92, 0xfe, 0xac, 0xbc,
+  0x19, 0xcc, 0x7a, 0x3d, 0x57, 0xcf, 0x84, 0x3c, 0xe7, 0xc7, 0x9a, 0xbd,
+  0x24, 0xef, 0x7f, 0x3c, 0x85, 0x41, 0x41, 0x3d, 0x95, 0x14, 0x1c, 0xbe,
+  0xb2, 0x27, 0x90, 0x3d, 0xf5, 0x30, 0xa3, 0xbd, 0x80, 0xc4, 0x1b, 0x3d,
+  0x9e, 0x3a, 0x17, 0xbd, 0x81, 0x18, 0x1b, 0xbe, 0x2e, 0xc3, 0x1a, 0x3d,
+  0x9b, 0x16, 0x0b, 0x3d, 0x01, 0x65, 0x46, 0xbe, 0x04, 0x18, 0xaa, 0xbd,
+  0x5e, 0x77, 0xbc, 0x3c, 0xad, 0x77, 0x1c, 0xbb, 0xb4, 0xbf, 0x99, 0xbd,
+  0x85, 0x44, 0xa0, 0xbd, 0x49, 0x70, 0x78, 0xbd, 0x25, 0xd6, 0xcc, 0xbc,
+  0xfe, 0x39, 0x25, 0xbe, 0xa2, 0x00, 0x5b, 0xbd, 0xc1, 0xfc, 0xb0, 0xbd,
+  0xac, 0x67, 0x27, 0xbe, 0xb1, 0x40, 0xb6, 0xbc, 0xe1, 0x38, 0x22, 0xbe,
+  0xae, 0x5f, 0x23, 0xbd, 0xbf, 0xcc, 0x10, 0xbe, 0x8a, 0x90, 0xba, 0xbd,
+  0xb0, 0x7f, 0x87, 0xbd, 0xfb, 0x31, 0xe5, 0xbd, 0x3f, 0x07, 0x92, 0xbd,
+  0x8e, 0xce, 0x20, 0xbe, 0xe0, 0xf7, 0x13, 0xbe, 0xb2, 0x40, 0xd6, 0xbd,
+  0x24, 0x35, 0x24, 0xbe, 0x8a, 0xb8, 0x9a, 0x3d, 0x83, 0x21, 0xb9, 0xbd,
+  0xd2, 0x7c, 0x23, 0x3d, 0x07, 0x3e, 0x05, 0x3d, 0x59, 0xf2, 0x0e, 0x3d,
+  0x89, 0xeb, 0xba, 0x3d, 0x23, 0xec, 0x59, 0x3c, 0x1c, 0x2b, 0x8d, 0xbb,
+  0xa5, 0x5c, 0x18, 0x3d, 0x7d, 0xaa, 0x66, 0xbd, 0x62, 0x92, 0x97, 0xbd,
+  0x25, 0x74, 0xb3, 0xbc, 0xfe, 0x25, 0xe1, 0xbc, 0x29, 0x4c, 0x84, 0x3d,
+  0xf6, 0x50, 0xe3, 0xbc, 0xba, 0xec, 0x7c, 0xbc, 0x94, 0xc6, 0x84, 0xbb,
+  0x0e, 0x5c, 0x60, 0xbd, 0xe2, 0xd8, 0x07, 0xbe, 0xd9, 0x74, 0xfe, 0xbd,
+  0xca, 0x51, 0x0e, 0xbe, 0xc0, 0xf2, 0xed, 0x3d, 0x0f, 0xe9, 0xc7, 0xbd,
+  0x95, 0xed, 0x15, 0xbe, 0xc9, 0x8e, 0x8f, 0xbd, 0xae, 0x4a, 0x68, 0xbe,
+  0xa2, 0x3e, 0xfc, 0xbd, 0x4d, 0xb2, 0x5c, 0xbe, 0xfe, 0x7f, 0x32, 0xbd,
+  0x30, 0xe3, 0xcf, 0x3d, 0xfa, 0x23, 0x28, 0xbe, 0xd0, 0x05, 0x56, 0xbe,
+  0xbb, 0xfb, 0x26, 0xbe, 0x79, 0xaa, 0x82, 0xbe, 0x2e, 0x51, 0x72, 0xbe,
+  0xd1, 0xef, 0x61, 0xbe, 0x56, 0xa0, 0x08, 0xbe, 0x8f, 0xcc, 0xe6, 0x3d,
+  0x15, 0x86, 0xaa, 0xbe, 0x21, 0x74, 0x76, 0xbe, 0x6f, 0xcc, 0x61, 0xbe,
+  0x52, 0x53, 0xa7, 0xbe, 0x0f, 0x29, 0x86, 0xbe, 0x58, 0x4c, 0x80, 0xbe,
+  0x1a, 0x52, 0x08, 0xbe, 0x19, 0x29, 0xe9, 0x3d, 0x1d, 0x95, 0x9c, 0xbe,
+  0x8f, 0x6f, 0x4e, 0xbe, 0x88, 0xdb, 0xa5, 0xbd, 0x30, 0x36, 0x88, 0xbe,
+  0x2e, 0x43, 0xb7, 0xbe, 0x1c, 0x10, 0x20, 0xbe, 0x13, 0xdb, 0x8a, 0xbe,
+  0xc5, 0x91, 0xdc, 0x3d, 0x16, 0xdf, 0x29, 0xbe, 0xa8, 0xd2, 0x5e, 0xbe,
+  0xce, 0xa4, 0x04, 0xbe, 0xf1, 0x6c, 0x69, 0xbe, 0x11, 0x2a, 0x68, 0xbe,
+  0x21, 0x7f, 0x40, 0xbe, 0xfc, 0x2c, 0x26, 0xbe, 0x91, 0x26, 0x99, 0x3c,
+  0x19, 0x21, 0x53, 0xbe, 0x8c, 0x60, 0x47, 0xbe, 0xa4, 0x32, 0x40, 0xbd,
+  0xac, 0xab, 0x65, 0xbe, 0xf8, 0x6b, 0x57, 0xbe, 0x96, 0x9f, 0x54, 0xbe,
+  0x9d, 0xa2, 0x7f, 0xbe, 0x1b, 0x50, 0x7d, 0x3d, 0xe9, 0x94, 0x6b, 0xbe,
+  0x88, 0xa4, 0x84, 0xbe, 0x0b, 0xa5, 0x39, 0xbd, 0xc4, 0x24, 0x09, 0xbd,
+  0x0f, 0x35, 0xcb, 0xbd, 0x59, 0x02, 0x04, 0xbe, 0x59, 0xc4, 0xf7, 0xbd,
+  0x43, 0xca, 0xa0, 0x3d, 0xc4, 0x3c, 0xab, 0xbe, 0x79, 0xf9, 0x7e, 0xbd,
+  0x75, 0x40, 0xe1, 0x3d, 0x50, 0xa7, 0x1a, 0xbe, 0xfd, 0x00, 0xd9, 0xbd,
+  0x10, 0xe6, 0xc5, 0xbd, 0xfa, 0x14, 0xd5, 0xbd, 0xb1, 0x47, 0xfa, 0x3d,
+  0x26, 0xb0, 0x2c, 0xbd, 0x4c, 0xb1, 0x9d, 0xbd, 0xbb, 0x99, 0x6c, 0x3c,
+  0x9a, 0xdc, 0x32, 0xbe, 0x3b, 0x23, 0x20, 0xbd, 0xd9, 0x08, 0xd0, 0xbd,
+  0xe3, 0x5d, 0xcc, 0xbd, 0x07, 0xb9, 0xff, 0x3d, 0xc4, 0x86, 0x43, 0xbd,
+  0x41, 0xb6, 0x3c, 0xbd, 0x78, 0x6d, 0x90, 0x3d, 0x17, 0xdb, 0x09, 0xbb,
+  0x7e, 0xdc, 0x7f, 0xbd, 0xb8, 0x4f, 0xaa, 0xbd, 0xa2, 0x6b, 0x4a, 0xbc,
+  0x4c, 0x1e, 0x8e, 0x3d, 0x1e, 0xf1, 0x36, 0xbd, 0xb5, 0x16, 0xf7, 0x3c,
+  0x8d, 0xd7, 0xf4, 0x3c, 0x73, 0xb1, 0xda, 0xbb, 0x7f, 0xfb, 0x88, 0xbd,
+  0x44, 0x0d, 0xbf, 0xbc, 0x32, 0x7d, 0x52, 0xbd, 0x6f, 0xc8, 0x8d, 0x3d,
+  0x9a, 0x79, 0x10, 0xbd, 0xa1, 0xe5, 0x88, 0x3d, 0xf6, 0x8c, 0xa0, 0x3d,
+  0xd8, 0xcf, 0x2c, 0xbd, 0x3c, 0xc4, 0xf4, 0x3c, 0xa0, 0xa4, 0x44, 0x3d,
+  0x08, 0x5a, 0xc3, 0x3c, 0xc6, 0x11, 0x0c, 0x3e, 0x77, 0x7c, 0xe0, 0xbc,
+  0xbc, 0xb7, 0xca, 0x3c, 0x96, 0x10, 0xc6, 0x3d, 0xe6, 0xf0, 0x1a, 0x3d,
+  0xcd, 0x36, 0x66, 0xbd, 0x3e, 0x4a, 0x98, 0xbd, 0x5b, 0x30, 0x13, 0xbe,
+  0x7d, 0x37, 0x8d, 0x3d, 0x57, 0x4f, 0x04, 0xbd, 0x66, 0x94, 0x95, 0x3c,
+  0x3d, 0xaf, 0xa4, 0x3c, 0x1e, 0xe8, 0x75, 0xbd, 0x0c, 0x86, 0xbf, 0xbd,
+  0x18, 0xa2, 0x5d, 0xbd, 0xf6, 0x6f, 0xc0, 0xbd, 0x7b, 0x1d, 0xa3, 0x3d,
+  0xc2, 0xb7, 0x46, 0xbe, 0xdd, 0x93, 0xf9, 0xbd, 0xac, 0x25, 0x78, 0xbc,
+  0x68, 0x45, 0xde, 0xbd, 0x81, 0xf0, 0x11, 0xbe, 0x71, 0x9c, 0x9d, 0xbd,
+  0x4e, 0xfa, 0x19, 0xbe, 0xcf, 0x0e, 0xf5, 0x3d, 0xf8, 0x32, 0xdb, 0xbd,
+  0x29, 0x10, 0x1f, 0xbe, 0xdc, 0xb1, 0xb0, 0x3c, 0x09, 0x57, 0xa7, 0xbd,
+  0x9e, 0x2c, 0x06, 0xbe, 0x32, 0xcb, 0x00, 0xbe, 0xa1, 0xe3, 0x91, 0xbe,
+  0x46, 0x1c, 0x02, 0x3e, 0xf6, 0xee, 0x15, 0xbe, 0x99, 0x5f, 0x4d, 0xbd,
+  0xf2, 0xb2, 0xa1, 0x3d, 0xf0, 0xa8, 0x70, 0xbd, 0x07, 0x78, 0x6e, 0xbd,
+  0x34, 0xaf, 0x55, 0xbd, 0x15, 0xeb, 0xa9, 0xbe, 0x0b, 0x26, 0x7b, 0xbd,
+  0xb1, 0xc7, 0x16, 0xbe, 0x3f, 0xd7, 0x57, 0xbd, 0xfd, 0x98, 0xd9, 0x3d,
+  0x70, 0xfe, 0x17, 0xbd, 0xa1, 0x00, 0xa2, 0xbb, 0x5f, 0x79, 0x91, 0x3d,
+  0x88, 0x9a, 0x1b, 0xbe, 0x7a, 0xa8, 0x81, 0x3d, 0x95, 0x19, 0xa9, 0xbd,
+  0x40, 0x6b, 0x9c, 0xbd, 0xe3, 0x8f, 0x0b, 0x3d, 0x2d, 0xed, 0x27, 0xbd,
+  0xd1, 0xa2, 0xbe, 0xbc, 0x3a, 0x5a, 0x88, 0x3d, 0x13, 0xd3, 0x33, 0xbe,
+  0x26, 0x42, 0xf0, 0x3d, 0xaa, 0x86, 0x73, 0xbc, 0x5a, 0x8f, 0xc3, 0xbc,
+  0x19, 0x12, 0xc7, 0x3d, 0xe8, 0xe3, 0x28, 0x3d, 0xd5, 0x97, 0x55, 0x3d,
+  0xb0, 0x79, 0xed, 0x3d, 0xe9, 0xa1, 0xeb, 0xbd, 0x10, 0x79, 0x08, 0x3e,
+  0x4f, 0x78, 0x8a, 0x3d, 0x2f, 0xd9, 0xa8, 0x3d, 0x8a, 0x7e, 0xcc, 0x3d,
+  0x10, 0x50, 0xf4, 0x3d, 0x53, 0x87, 0x88, 0x3d, 0x39, 0x89, 0xe1, 0xbb,
+  0x94, 0x05, 0xc7, 0xbb, 0xe0, 0x33, 0xe4, 0x3d, 0xbd, 0x3f, 0x55, 0x3c,
+  0xe7, 0x48, 0x4a, 0x3d, 0x6d, 0x93, 0xc6, 0x3d, 0x48, 0x54, 0x1e, 0x3d,
+  0x5a, 0x29, 0x61, 0x3d, 0xd1, 0xb1, 0x1d, 0x3e, 0x8b, 0xbb, 0xac, 0x3c,
+  0xee, 0x13, 0x92, 0x3d, 0xc7, 0xf7, 0x8f, 0x3d, 0xb0, 0xc5, 0xd4, 0x3d,
+  0x14, 0x65, 0x89, 0x3d, 0x42, 0x55, 0x59, 0xbd, 0x69, 0x43, 0x5d, 0x3d,
+  0xa2, 0x4d, 0x91, 0x3d, 0x85, 0x48, 0xa9, 0x3d, 0xd9, 0x7b, 0x1a, 0x3d,
+  0x8f, 0x0d, 0x8d, 0x3d, 0x2d, 0xe4, 0x84, 0xbc, 0x57, 0xc7, 0x3f, 0x3d,
+  0x5d, 0x17, 0x69, 0xbd, 0xba, 0x2e, 0xe7, 0xbd, 0x79, 0x89, 0xc7, 0xbd,
+  0x45, 0xea, 0xf7, 0x3c, 0x96, 0xda, 0xec, 0x3d, 0xab, 0xb6, 0xb6, 0xbd,
+  0xf5, 0x74, 0xe1, 0xbd, 0x58, 0x94, 0x53, 0x3d, 0x03, 0x5f, 0xd1, 0x3d,
+  0xaf, 0xa2, 0xe7, 0xbc, 0xc8, 0x52, 0xab, 0x3b, 0xa8, 0x85, 0xf6, 0xbd,
+  0x5f, 0x59, 0xbe, 0x3d, 0x85, 0x3b, 0x88, 0x3c, 0xf4, 0x94, 0xa4, 0x3c,
+  0xa7, 0x2a, 0x7c, 0x3c, 0xef, 0xfa, 0x8a, 0x3d, 0x2b, 0xdc, 0xf6, 0xbc,
+  0xf2, 0x14, 0x83, 0x3d, 0xd4, 0xa5, 0x08, 0xbe, 0xe9, 0x28, 0x4a, 0x3d,
+  0xd5, 0xd1, 0x1e, 0xbd, 0xfd, 0xdd, 0xd2, 0xbb, 0x87, 0x1c, 0xec, 0x3c,
+  0xab, 0x39, 0x2d, 0x3d, 0x69, 0xd0, 0xc4, 0xbc, 0x8a, 0x95, 0xab, 0x3d,
+  0x53, 0xf7, 0x6e, 0xbd, 0x44, 0x7e, 0x78, 0x3c, 0x3d, 0x53, 0x16, 0xbc,
+  0xe6, 0x60, 0xa8, 0x3c, 0xa9, 0x3a, 0xe3, 0x3c, 0x6d, 0xb9, 0x24, 0x3d,
+  0x80, 0x10, 0xf2, 0xba, 0x48, 0x68, 0xa7, 0xbc, 0x33, 0x0f, 0xb4, 0xbc,
+  0x05, 0x1b, 0x83, 0x3d, 0x5b, 0x8d, 0x9b, 0xbd, 0xf2, 0x82, 0xf9, 0x3a,
+  0xce, 0xfa, 0x34, 0xbd, 0xfa, 0x21, 0xe6, 0xbd, 0x2f, 0xf1, 0xc0, 0xbd,
+  0x60, 0x82, 0xbe, 0xbb, 0x01, 0x5f, 0x23, 0xbe, 0xb8, 0x65, 0x87, 0xbd,
+  0xea, 0x73, 0x73, 0xbb, 0x43, 0xb9, 0xc9, 0xbd, 0x2a, 0x1e, 0xfa, 0xbd,
+  0xd5, 0x58, 0xf8, 0xbd, 0xaf, 0x37, 0x0d, 0xbd, 0x7d, 0x4c, 0x63, 0xbd,
+  0xa6, 0x92, 0xf2, 0xbd, 0x3d, 0x50, 0xa6, 0xbe, 0x97, 0x36, 0x8f, 0xbd,
+  0x1e, 0x50, 0xc3, 0xbd, 0x2b, 0x71, 0xd3, 0xbd, 0xbd, 0x2f, 0x19, 0xbe,
+  0xf9, 0x75, 0xf4, 0x3b, 0xb7, 0xff, 0x9d, 0xbc, 0x37, 0x78, 0x24, 0xbe,
+  0x8c, 0x6a, 0xbc, 0xbe, 0xed, 0xf4, 0x9a, 0x3c, 0xb3, 0x65, 0x35, 0xbd,
+  0x6f, 0x30, 0x83, 0x3d, 0x7c, 0xb8, 0x9b, 0xbd, 0xb7, 0xd2, 0x8b, 0xbd,
+  0x13, 0x0c, 0x2c, 0x3d, 0xfa, 0x47, 0x91, 0xbd, 0x7b, 0xb9, 0x71, 0xbe,
+  0x57, 0xe5, 0x9f, 0x3d, 0xef, 0xdf, 0x0d, 0x3d, 0x1e, 0xb8, 0x88, 0xbd,
+  0x69, 0x64, 0xbe, 0xbd, 0x82, 0x5d, 0x3f, 0xbd, 0x46, 0x47, 0x28, 0x3d,
+  0x14, 0xc1, 0x3e, 0x3d, 0xd6, 0x0a, 0x85, 0xbd, 0xf0, 0x17, 0x4c, 0x3d,
+  0x5a, 0xda, 0x07, 0x3d, 0xc4, 0x9f, 0xdb, 0x3d, 0xb4, 0x9f, 0xa2, 0x3c,
+  0x5b, 0x58, 0x79, 0x3d, 0x62, 0xfb, 0x19, 0x3e, 0x25, 0x15, 0x94, 0x3d,
+  0xf2, 0x5d, 0x03, 0x3d, 0x2e, 0x2e, 0x03, 0x3e, 0xd2, 0x30, 0x09, 0x3d,
+  0x96, 0x37, 0x27, 0x3e, 0x3c, 0xb5, 0x92, 0x3d, 0x74, 0xc2, 0x83, 0x3d,
+  0x61, 0x80, 0xe5, 0x3d, 0x3f, 0x8c, 0x3f, 0x3e, 0x3d, 0x04, 0x74, 0x3d,
+  0x24, 0xe1, 0x36, 0x3e, 0x87, 0x46, 0x7f, 0x3d, 0xc1, 0x01, 0x81, 0x3d,
+  0xa2, 0xd3, 0x8e, 0x3d, 0x22, 0xb9, 0x6f, 0x3d, 0xb1, 0xcf, 0x48, 0x3d,
+  0x68, 0xb6, 0x78, 0xbc, 0x65, 0x53, 0x8c, 0x3d, 0x67, 0x92, 0xfb, 0x3c,
+  0x7b, 0x0f, 0xdd, 0x3c, 0x81, 0x5f, 0xdf, 0x3d, 0x18, 0xf0, 0x99, 0xbd,
+  0x07, 0xbc, 0x15, 0xbd, 0x22, 0x3d, 0xa5, 0xbd, 0xec, 0xc5, 0xb4, 0xbd,
+  0x5f, 0x3c, 0xa2, 0x3d, 0xc7, 0x24, 0x71, 0xbd, 0xe1, 0xdf, 0xda, 0xbc,
+  0x70, 0x6f, 0xa9, 0xbc, 0x51, 0x07, 0xd7, 0x3b, 0x64, 0xa4, 0x87, 0x3d,
+  0xa3, 0xc9, 0xb5, 0x3d, 0xb8, 0x02, 0xc5, 0xbc, 0xfd, 0xfd, 0xfe, 0x3d,
+  0x33, 0x84, 0x00, 0x3b, 0x83, 0x4c, 0xca, 0x3d, 0x0e, 0x88, 0xf3, 0xbd,
+  0x78, 0x0e, 0xfc, 0x3a, 0x75, 0x14, 0x3f, 0xbd, 0x8f, 0x74, 0xdb, 0xbc,
+  0xb7, 0xba, 0x0c, 0xbe, 0xf4, 0x22, 0x57, 0xbb, 0x0d, 0x36, 0x89, 0xbd,
+  0x39, 0x51, 0x1c, 0x3d, 0x9c, 0x8d, 0x9f, 0xbd, 0x32, 0xd8, 0x98, 0x3d,
+  0x6d, 0xb0, 0x68, 0xbd, 0x48, 0x71, 0x3a, 0xbd, 0x26, 0x78, 0xef, 0xbd,
+  0x5c, 0xbb, 0x01, 0xbe, 0xdb, 0x9a, 0xda, 0x3c, 0x80, 0x04, 0xdb, 0xbc,
+  0x88, 0xf5, 0xae, 0xbd, 0xd0, 0xbe, 0xc1, 0x3c, 0x12, 0xbd, 0x53, 0xbd,
+  0x41, 0x8d, 0xa0, 0xbb, 0x5b, 0x94, 0xe2, 0xbd, 0xf9, 0x9c, 0x49, 0xbe,
+  0x9e, 0xd0, 0x5c, 0xbc, 0x80, 0xe7, 0x25, 0x3d, 0xbc, 0x89, 0x28, 0xbe,
+  0x39, 0x94, 0xb8, 0xbd, 0xed, 0xdd, 0xde, 0xbc, 0x1e, 0xb5, 0x2c, 0x3d,
+  0xf4, 0x5e, 0x2f, 0xbe, 0x7c, 0xd9, 0x04, 0xbf, 0x0d, 0x5e, 0x15, 0xbd,
+  0x84, 0x49, 0xd4, 0xbd, 0x7b, 0x6e, 0xb1, 0xbe, 0xa6, 0x4e, 0x6c, 0xbe,
+  0xa8, 0x0d, 0x1e, 0xbe, 0x95, 0xdb, 0xf3, 0xbc, 0xa1, 0x7e, 0x42, 0xbe,
+  0xa2, 0xd8, 0x2b, 0xbf, 0x66, 0xe3, 0xe8, 0xbd, 0x2e, 0x3a, 0xbe, 0xbd,
+  0x20, 0xaf, 0xe0, 0xbe, 0x2e, 0x9b, 0x1f, 0xbe, 0x2f, 0xb9, 0xd7, 0xbd,
+  0xc5, 0xab, 0x62, 0xbd, 0x64, 0xc5, 0x89, 0xbe, 0xab, 0x28, 0x41, 0xbf,
+  0x3b, 0x5c, 0xeb, 0xbd, 0x37, 0xd0, 0x56, 0xbd, 0xcc, 0x90, 0x1a, 0xbe,
+  0x8a, 0x1e, 0x42, 0xbe, 0x05, 0xf8, 0x75, 0xbd, 0x77, 0x58, 0x37, 0x3e,
+  0x98, 0x8f, 0x2f, 0xbe, 0xb4, 0x51, 0x2a, 0xbf, 0xde, 0x34, 0x55, 0x3d,
+  0x5c, 0x9f, 0xfa, 0x3b, 0x37, 0x6e, 0x83, 0xbc, 0xba, 0xf0, 0x26, 0xbe,
+  0xe9, 0x65, 0x4f, 0x3c, 0x39, 0x98, 0xb4, 0x3d, 0xf6, 0x4d, 0xf4, 0x3c,
+  0x6a, 0x19, 0x91, 0xbe, 0x89, 0x57, 0x87, 0x3d, 0xbb, 0x03, 0xd2, 0xbc,
+  0x5d, 0x41, 0x2f, 0x3d, 0x8e, 0x43, 0xa8, 0xbd, 0xa2, 0x5c, 0x66, 0x3d,
+  0x79, 0xab, 0xb0, 0x3d, 0xd3, 0x3b, 0x8e, 0x3d, 0x9f, 0xa8, 0xc8, 0xbd,
+  0x11, 0xd3, 0x02, 0x3e, 0xd2, 0xc2, 0x1b, 0x3c, 0xfd, 0x07, 0x86, 0xbd,
+  0x59, 0xeb, 0x06, 0xbd, 0xea, 0x7d, 0xb7, 0xbb, 0xd5, 0x31, 0x0b, 0x3d,
+  0x74, 0xda, 0x8d, 0x3d, 0xe8, 0x0d, 0x8a, 0x3c, 0x3c, 0x64, 0x0e, 0x3d,
+  0xb3, 0x1c, 0x85, 0x3d, 0x09, 0xc9, 0x16, 0x3d, 0x83, 0xc9, 0x29, 0x3d,
+  0x92, 0x22, 0x5d, 0x3c, 0x19, 0x22, 0xa3, 0xbc, 0xfc, 0x7b, 0xbb, 0x3d,
+  0x4c, 0x77, 0xc6, 0x3d, 0xfe, 0xfb, 0x90, 0xbb, 0x63, 0x59, 0x4c, 0x3d,
+  0xc0, 0xb5, 0xe6, 0xbc, 0x00, 0xbc, 0x2d, 0xbe, 0xe8, 0x34, 0xf9, 0xbd,
+  0x2e, 0xcd, 0x6b, 0xbe, 0xde, 0xd0, 0xc5, 0xbd, 0x47, 0x83, 0x31, 0x3d,
+  0xaa, 0xe6, 0x35, 0xbe, 0x20, 0xce, 0x54, 0xbe, 0x16, 0xad, 0x17, 0xbe,
+  0x8b, 0x85, 0x08, 0xbe, 0x04, 0x4e, 0x00, 0xbd, 0xdd, 0x00, 0x9b, 0xbd,
+  0x4f, 0x51, 0xe6, 0xbd, 0x78, 0x0b, 0x28, 0x3c, 0x5b, 0x8e, 0xa0, 0xbc,
+  0x69, 0x84, 0xd8, 0xbd, 0x95, 0xae, 0x26, 0xbe, 0xc1, 0x1e, 0x0f, 0xbd,
+  0x68, 0x49, 0xa3, 0xbd, 0x21, 0x13, 0x93, 0xbc, 0xb3, 0x48, 0x03, 0xbe,
+  0xfb, 0xba, 0x2d, 0xbd, 0x05, 0x10, 0xbd, 0xbd, 0xe6, 0x1d, 0x2b, 0xbd,
+  0x83, 0xe9, 0x9d, 0xbd, 0x83, 0x71, 0xfc, 0x3d, 0x40, 0x9e, 0x4e, 0x3c,
+  0x4b, 0x01, 0x61, 0x3d, 0xcd, 0x25, 0x2b, 0xbe, 0x38, 0xde, 0x2e, 0xbe,
+  0x6d, 0xe7, 0xef, 0xbc, 0xed, 0xed, 0x3e, 0x3d, 0x3e, 0x0a, 0x26, 0xbd,
+  0xc4, 0x8e, 0x70, 0x3c, 0x83, 0x69, 0x5d, 0x3d, 0x3a, 0x26, 0x72, 0x3d,
+  0x4a, 0xfe, 0x41, 0xbe, 0x32, 0x02, 0x01, 0xbf, 0x2d, 0x24, 0x70, 0x3c,
+  0x28, 0xeb, 0xcc, 0x3d, 0x9d, 0x88, 0xda, 0xbd, 0x91, 0xb1, 0x76, 0xbd,
+  0xe0, 0x63, 0xe6, 0xbc, 0x49, 0xac, 0x1c, 0x3e, 0xcd, 0xe7, 0x95, 0xbc,
+  0xde, 0x84, 0x02, 0xbf, 0x5c, 0x66, 0x5c, 0x3d, 0x8f, 0xe3, 0x4d, 0x3d,
+  0x11, 0xd9, 0xcc, 0xbe, 0x13, 0xad, 0x58, 0xbe, 0x59, 0xf3, 0x32, 0xbe,
+  0x0d, 0xe7, 0x7c, 0xbc, 0xe1, 0xfd, 0xf2, 0xbd, 0x62, 0x0d, 0xc6, 0xbe,
+  0x4f, 0xe2, 0x53, 0xbd, 0xfc, 0x65, 0x0e, 0xbe, 0xb8, 0x4c, 0xa2, 0xbe,
+  0x12, 0x9d, 0x07, 0xbe, 0xe2, 0xb4, 0x1d, 0xbe, 0x71, 0xc0, 0xb8, 0x3c,
+  0x1f, 0x9b, 0x28, 0xbe, 0xf8, 0x0b, 0xfd, 0xbe, 0xbf, 0xdf, 0xfc, 0xbd,
+  0x2d, 0x01, 0xe2, 0xbc, 0xe4, 0x24, 0x3e, 0xbe, 0x17, 0x48, 0x83, 0xbd,
+  0xcc, 0xb0, 0x0e, 0x3c, 0x4e, 0x19, 0x01, 0x3e, 0x77, 0x7e, 0x12, 0xbe,
+  0xb4, 0x43, 0x3d, 0xbf, 0x8a, 0xa6, 0xc2, 0x3d, 0xa8, 0x3f, 0xee, 0x3c,
+  0x22, 0xf2, 0x30, 0xbc, 0x77, 0x7d, 0x20, 0xbe, 0x25, 0xb4, 0x00, 0x3d,
+  0xd6, 0x04, 0xb9, 0x3d, 0x42, 0x6b, 0x36, 0x3d, 0xdd, 0x35, 0x9e, 0xbe,
+  0xd7, 0x18, 0x29, 0xbc, 0x05, 0x3c, 0x92, 0xbd, 0x3c, 0x89, 0x0b, 0xbd,
+  0x28, 0xb0, 0xf0, 0xbd, 0x04, 0xdf, 0x78, 0x3c, 0xed, 0x98, 0x87, 0x3d,
+  0x55, 0x33, 0x1d, 0x3d, 0xb9, 0x21, 0xd5, 0xbd, 0x89, 0xfc, 0xf1, 0x3c,
+  0xfa, 0x0a, 0x36, 0xbd, 0x39, 0xb5, 0x42, 0xbe, 0xe5, 0x23, 0x50, 0xbe,
+  0x5a, 0x3c, 0x40, 0xbc, 0x91, 0x57, 0x73, 0xbd, 0x87, 0x8b, 0x4c, 0x3d,
+  0x74, 0xd0, 0x4e, 0x3d, 0x44, 0x75, 0x01, 0x3d, 0xf0, 0xa9, 0xeb, 0xbd,
+  0xdf, 0xe9, 0xf8, 0xbd, 0x4f, 0x38, 0xb2, 0xbd, 0x91, 0x5b, 0x06, 0xbd,
+  0x99, 0x69, 0x6e, 0xbe, 0xfa, 0x40, 0xb0, 0xbc, 0xc7, 0xdf, 0x99, 0x3d,
+  0xc8, 0x71, 0x05, 0xbe, 0xd8, 0x9b, 0xec, 0xbd, 0x0a, 0x39, 0x5b, 0x3d,
+  0x54, 0xc0, 0x05, 0xbe, 0x17, 0xa0, 0xfd, 0xbd, 0xc5, 0x6e, 0x0d, 0xbe,
+  0xcf, 0x1f, 0x10, 0xbe, 0xe8, 0xfa, 0x6c, 0x3d, 0xe9, 0xb8, 0x3c, 0xbe,
+  0xf1, 0x10, 0x25, 0xbe, 0xf3, 0xd4, 0xad, 0xbc, 0x37, 0x8c, 0xfa, 0xbd,
+  0x5f, 0xb4, 0xb6, 0xbd, 0xb8, 0xbe, 0xab, 0xbd, 0x1b, 0xc8, 0x66, 0xbe,
+  0x21, 0x54, 0x1c, 0xbc, 0x6b, 0xf7, 0x28, 0xbe, 0x88, 0x1d, 0x0e, 0xbe,
+  0xa1, 0x95, 0xcd, 0x3c, 0x87, 0x23, 0x57, 0x3d, 0xb5, 0xdf, 0x4d, 0xbd,
+  0x82, 0xa7, 0x7e, 0x3d, 0xf5, 0xb9, 0x5e, 0xbe, 0x1d, 0x31, 0x01, 0xbe,
+  0x50, 0xdc, 0xa6, 0xbd, 0xb2, 0x38, 0x0d, 0x3d, 0x83, 0xdc, 0x6a, 0x3c,
+  0x45, 0xb7, 0xaa, 0x3d, 0x2a, 0x29, 0xea, 0x3c, 0x52, 0xb9, 0x1e, 0x3e,
+  0xcd, 0xc1, 0xd6, 0xbd, 0xad, 0x60, 0x49, 0xbe, 0xd4, 0x34, 0x5a, 0x3d,
+  0x45, 0xeb, 0xf7, 0x3d, 0xec, 0x34, 0x8d, 0xbc, 0x32, 0xf6, 0xd1, 0x3d,
+  0xe5, 0x63, 0x92, 0x3d, 0x87, 0x74, 0x1f, 0x3e, 0x41, 0x7b, 0xe0, 0x3d,
+  0x23, 0x1a, 0xa7, 0xbe, 0xe8, 0x3f, 0xd6, 0x3d, 0xc6, 0x6d, 0x49, 0x3e,
+  0xbf, 0x5d, 0x23, 0x3d, 0x86, 0xbb, 0x08, 0x3e, 0x08, 0xaa, 0x17, 0x3d,
+  0x4b, 0x02, 0xf4, 0x3d, 0x0e, 0xcc, 0x09, 0x3e, 0x96, 0x58, 0xe5, 0xbe,
+  0x15, 0x86, 0x1d, 0x3e, 0x0e, 0x2e, 0xa7, 0x3d, 0x4f, 0xc5, 0x7c, 0xbd,
+  0x38, 0x9e, 0xad, 0xbd, 0x01, 0x61, 0x13, 0xbe, 0xf8, 0xea, 0x0d, 0xbe,
+  0x00, 0x82, 0x1b, 0xbe, 0xf5, 0x5b, 0xa1, 0xbe, 0x3d, 0x14, 0x73, 0xbe,
+  0x05, 0x93, 0x61, 0xbe, 0x53, 0x41, 0x0e, 0xbe, 0xf6, 0x1f, 0xc5, 0xbd,
+  0x35, 0x75, 0x17, 0xbe, 0x31, 0xf2, 0x80, 0x3d, 0x36, 0x57, 0x86, 0xbe,
+  0x4e, 0x4c, 0xf1, 0xbe, 0xa4, 0xf6, 0x93, 0xbc, 0x72, 0xf9, 0xc1, 0xb9,
+  0xd4, 0xe6, 0x1d, 0xbe, 0x4a, 0x1b, 0xc7, 0x3d, 0x3d, 0xbc, 0x7f, 0xbc,
+  0x42, 0x0e, 0xb7, 0x3d, 0x53, 0x76, 0x22, 0xbc, 0xdd, 0x46, 0x1d, 0xbf,
+  0xbb, 0x44, 0xfd, 0x3d, 0x74, 0x7f, 0x93, 0x3d, 0x45, 0xf1, 0x83, 0x3d,
+  0x43, 0xee, 0x9f, 0xbd, 0xcb, 0x02, 0x99, 0xbd, 0x43, 0xfe, 0xd6, 0x3b,
+  0x14, 0x8d, 0xee, 0xbd, 0xae, 0xe3, 0x84, 0xbe, 0x76, 0x0c, 0xb4, 0x3c,
+  0xcd, 0x4a, 0xed, 0x3c, 0xd2, 0x6e, 0xc7, 0x3d, 0xed, 0x57, 0x90, 0xbd,
+  0x5c, 0xf6, 0x79, 0xbc, 0x0f, 0x1c, 0x5a, 0xbb, 0x47, 0x23, 0x63, 0xbd,
+  0xee, 0x35, 0xbe, 0xbd, 0x07, 0x7e, 0x58, 0x3d, 0x3d, 0x28, 0x18, 0xbd,
+  0x37, 0x8a, 0xf0, 0xbb, 0x3a, 0xbc, 0x1c, 0xbe, 0xef, 0xb9, 0x93, 0xbd,
+  0xac, 0xa0, 0x88, 0xbd, 0xd6, 0x18, 0x7d, 0xbd, 0xcd, 0xa9, 0x33, 0xbd,
+  0xf4, 0xc9, 0xa6, 0xbd, 0x45, 0x85, 0x4f, 0xbe, 0xeb, 0x54, 0x35, 0xbd,
+  0xc6, 0xf6, 0x6f, 0xbe, 0x63, 0x0f, 0x6d, 0xbe, 0xf8, 0xc0, 0x35, 0xbe,
+  0xe1, 0x85, 0x81, 0xbe, 0x6a, 0x4d, 0xff, 0x3d, 0xcd, 0xfe, 0x48, 0xbe,
+  0x9a, 0x02, 0x51, 0xbe, 0x00, 0xd5, 0xe4, 0x3d, 0xa2, 0x43, 0x3d, 0xbd,
+  0xa9, 0x1c, 0x17, 0xbe, 0x11, 0xcd, 0x0b, 0xbe, 0x36, 0x85, 0x3c, 0xbe,
+  0x2a, 0x06, 0x2d, 0x3c, 0x39, 0x6a, 0x37, 0xbe, 0x19, 0x49, 0x05, 0xbe,
+  0x70, 0x96, 0x32, 0x3d, 0x5a, 0x0a, 0x67, 0x3d, 0xb6, 0xbd, 0x5f, 0x3c,
+  0xa3, 0x93, 0xa3, 0xbc, 0x1d, 0xef, 0x2c, 0xbe, 0xf0, 0x81, 0xb3, 0xbc,
+  0x6a, 0xf2, 0x4f, 0x3b, 0xab, 0x35, 0x2c, 0xbd, 0x63, 0x78, 0xb9, 0xbd,
+  0xc5, 0xe6, 0xfc, 0x3d, 0xbb, 0xd7, 0x98, 0x3d, 0x3a, 0x30, 0xe2, 0x3d,
+  0x88, 0x5a, 0x26, 0xbd, 0x3d, 0xeb, 0x72, 0xbd, 0x9c, 0x01, 0xd6, 0x3b,
+  0xae, 0xbd, 0xad, 0x3d, 0x89, 0xaf, 0xa7, 0xbd, 0x11, 0x37, 0x32, 0x3d,
+  0x28, 0x74, 0x6e, 0x3d, 0xec, 0xdb, 0x02, 0x3e, 0xf5, 0xae, 0x14, 0x3c,
+  0x23, 0xf7, 0xd1, 0xbd, 0x92, 0x3e, 0x20, 0x3e, 0xdb, 0xe9, 0xab, 0x3d,
+  0x0b, 0xeb, 0x05, 0xbe, 0x25, 0x64, 0xb3, 0x3d, 0xbe, 0x88, 0x19, 0x3e,
+  0x29, 0x5b, 0x31, 0x3e, 0x2f, 0x93, 0x24, 0x3e, 0x27, 0x9e, 0x79, 0xbc,
+  0xf8, 0x64, 0x15, 0x3e, 0x2d, 0x99, 0x21, 0x3e, 0x7f, 0xc9, 0x9a, 0x3d,
+  0x73, 0x2e, 0x96, 0x3d, 0x76, 0x12, 0x19, 0x3d, 0xcc, 0x37, 0xba, 0x3d,
+  0x85, 0x26, 0x10, 0x3e, 0xb3, 0x34, 0x4a, 0x3c, 0xe3, 0x88, 0x25, 0x3e,
+  0x2e, 0x5b, 0x90, 0x3c, 0xa5, 0x7c, 0x02, 0x3c, 0x21, 0x2e, 0x1e, 0x3d,
+  0x99, 0x97, 0x92, 0xbd, 0x07, 0x4c, 0xeb, 0xbd, 0x8b, 0x50, 0x65, 0xbd,
+  0xc3, 0x1a, 0x86, 0x3d, 0xdf, 0x46, 0x01, 0xbe, 0xd5, 0xdb, 0xe2, 0xbd,
+  0xfe, 0x3f, 0x1b, 0xbd, 0x1b, 0x3b, 0xbf, 0x3d, 0xb8, 0xd3, 0x32, 0xbb,
+  0x08, 0x4f, 0xef, 0x3d, 0xdc, 0x53, 0x10, 0xbe, 0x54, 0x69, 0xb0, 0xbe,
+  0xbe, 0xfe, 0x00, 0x3c, 0x48, 0xc9, 0x01, 0x3e, 0x18, 0xd2, 0xcd, 0xbb,
+  0x6e, 0xe4, 0x21, 0x3e, 0x37, 0x30, 0x9c, 0x3c, 0xc5, 0x60, 0xc8, 0x3d,
+  0xfd, 0xe2, 0x6e, 0x3d, 0x3e, 0xd4, 0x6e, 0xbe, 0x75, 0x91, 0xe6, 0x3d,
+  0x29, 0xdb, 0xe8, 0x3d, 0xc4, 0x4e, 0x48, 0x3d, 0x5e, 0xf7, 0x37, 0x3d,
+  0x7d, 0x47, 0x2f, 0x3d, 0xf7, 0x16, 0xc6, 0x3d, 0xb9, 0x93, 0x22, 0x3d,
+  0x5d, 0x8e, 0xdb, 0x3d, 0x52, 0xbb, 0xe3, 0x3d, 0x7e, 0x28, 0xed, 0x3c,
+  0x76, 0x58, 0x62, 0x3d, 0x81, 0x3d, 0x97, 0x3d, 0xf9, 0xf3, 0x5f, 0xbc,
+  0x77, 0xb7, 0xaf, 0x3d, 0x03, 0xa8, 0xb8, 0x3d, 0xa8, 0xdd, 0x0e, 0x3e,
+  0x5a, 0xb5, 0xb6, 0x3d, 0xd0, 0x30, 0x60, 0x3d, 0x93, 0xfb, 0x78, 0xbd,
+  0xc5, 0x94, 0x73, 0xbc, 0xee, 0x45, 0xa9, 0xbd, 0xf2, 0x8f, 0xd1, 0xbd,
+  0x60, 0x7e, 0x08, 0x3d, 0xf1, 0x83, 0xd2, 0x3d, 0xc2, 0x73, 0x7e, 0xbd,
+  0xce, 0x02, 0xca, 0xbd, 0xba, 0x1b, 0xec, 0xbd, 0xc4, 0x36, 0x01, 0xbe,
+  0x65, 0xdc, 0x0c, 0xbe, 0x7c, 0xf1, 0x3d, 0xbe, 0x74, 0xf9, 0xc2, 0xbd,
+  0x9d, 0x99, 0xd3, 0x3b, 0xc0, 0xb9, 0x16, 0xbe, 0x48, 0x5e, 0x98, 0xbd,
+  0xe4, 0xd6, 0x8d, 0x3c, 0x88, 0xaf, 0xb8, 0xbd, 0xdb, 0xa7, 0x6a, 0xbc,
+  0xce, 0x4d, 0x07, 0xbd, 0xe7, 0x48, 0x1e, 0x3d, 0xaf, 0xc3, 0x81, 0x3d,
+  0xf3, 0x09, 0x93, 0x3b, 0x11, 0xa9, 0x01, 0xbc, 0x05, 0xea, 0x1e, 0xbe,
+  0x1c, 0xfc, 0xac, 0xbd, 0xa5, 0xd8, 0x75, 0x3c, 0x6d, 0xf1, 0x06, 0x3d,
+  0xf7, 0x8c, 0xa9, 0x3d, 0x6a, 0x8e, 0x54, 0x3e, 0x4b, 0x52, 0x17, 0x3d,
+  0x44, 0xde, 0x04, 0x3a, 0x81, 0x03, 0x0a, 0xbe, 0x25, 0x8c, 0xf7, 0xbc,
+  0x7c, 0x75, 0xa1, 0x3d, 0xeb, 0x05, 0x31, 0x3d, 0x94, 0x69, 0x9f, 0x3d,
+  0xad, 0x4b, 0x26, 0x3e, 0x2f, 0x6b, 0x7a, 0x3d, 0xcc, 0x4d, 0xda, 0x3d,
+  0x22, 0x78, 0x57, 0xbd, 0xef, 0x24, 0xb3, 0x3d, 0x12, 0x49, 0xd7, 0x3d,
+  0x21, 0x9a, 0xb0, 0x3d, 0x0c, 0x8f, 0xb0, 0x3d, 0xc4, 0xa4, 0xe4, 0x3c,
+  0xb8, 0x0e, 0x0f, 0x3e, 0x21, 0xe8, 0xaa, 0x3d, 0x58, 0x00, 0x81, 0xbd,
+  0x43, 0xd5, 0xc3, 0xbc, 0x4d, 0x32, 0x15, 0x3d, 0x60, 0x6f, 0x97, 0x3d,
+  0x74, 0xed, 0x58, 0x3d, 0x20, 0x25, 0xfd, 0x3d, 0x62, 0xfb, 0x23, 0x3d,
+  0x7c, 0x47, 0x96, 0x3d, 0xb8, 0xee, 0x00, 0x3e, 0x9b, 0x84, 0xc6, 0x3d,
+  0x96, 0x7e, 0xf7, 0x3b, 0x69, 0x50, 0xd9, 0xbc, 0x67, 0x07, 0x12, 0x3e,
+  0x4e, 0xd1, 0x95, 0x3e, 0x61, 0x80, 0xd4, 0xbc, 0xe0, 0x8b, 0x77, 0xbb,
+  0x8e, 0xa7, 0x65, 0x3e, 0x1c, 0x5d, 0xbd, 0x3d, 0x99, 0x26, 0xec, 0x3c,
+  0x4e, 0xf8, 0x31, 0x3d, 0xbe, 0x19, 0xa3, 0x3d, 0xc5, 0xd7, 0x53, 0x3e,
+  0xf9, 0x16, 0x64, 0xbc, 0xfa, 0xce, 0xa5, 0x3d, 0x70, 0x02, 0x99, 0x3d,
+  0x7f, 0xb1, 0xd0, 0x3d, 0x33, 0xc2, 0x01, 0x3e, 0x32, 0xab, 0x9e, 0x3d,
+  0x95, 0x87, 0x96, 0x3d, 0x8a, 0x90, 0x93, 0xbc, 0x9c, 0x30, 0xa9, 0x3d,
+  0xe7, 0x5e, 0x1a, 0x3e, 0x1d, 0xf5, 0x3b, 0x3d, 0xd8, 0x45, 0xed, 0x3d,
+  0x7b, 0xc3, 0x84, 0x3d, 0x50, 0x2e, 0x4a, 0x3d, 0x57, 0xa3, 0x1f, 0x3e,
+  0xb2, 0xca, 0x02, 0x3e, 0x1d, 0x4e, 0x91, 0x3d, 0x49, 0xcf, 0xb7, 0x3c,
+  0xe3, 0x4e, 0x22, 0x3e, 0xa8, 0x21, 0x68, 0x3d, 0x38, 0xd7, 0x8d, 0x3d,
+  0xad, 0xc7, 0xbe, 0x3d, 0x09, 0x0a, 0x88, 0x3d, 0xe1, 0x26, 0x22, 0x3e,
+  0xd6, 0xb7, 0x0c, 0x3e, 0x57, 0xe1, 0x0c, 0xba, 0xcd, 0x8d, 0xa1, 0x3d,
+  0xf8, 0x8d, 0x09, 0x3d, 0xd3, 0x8f, 0x95, 0x3d, 0x83, 0xaa, 0x27, 0xbd,
+  0x65, 0xad, 0xbe, 0xbc, 0xbe, 0x50, 0x84, 0x3d, 0x35, 0xb4, 0x65, 0xbd,
+  0x45, 0xf2, 0x2e, 0xbd, 0xbf, 0xbb, 0x94, 0xbd, 0x58, 0xfc, 0x93, 0xbd,
+  0x63, 0x48, 0xe3, 0xbd, 0x96, 0xf3, 0xef, 0xbd, 0xa7, 0x91, 0x65, 0xbd,
+  0xca, 0x6f, 0x90, 0xbc, 0x51, 0x45, 0x25, 0xbe, 0x5c, 0x17, 0xb9, 0xbd,
+  0xcc, 0x57, 0xa3, 0xbd, 0x82, 0x03, 0x65, 0xbe, 0x3c, 0xb1, 0x67, 0xbe,
+  0x2b, 0x39, 0xfe, 0xbd, 0x8e, 0x72, 0xeb, 0xbd, 0x37, 0xa9, 0x8b, 0x3d,
+  0xfb, 0x2b, 0x24, 0xbe, 0xea, 0x7e, 0x33, 0xbe, 0x86, 0x35, 0x8f, 0x3d,
+  0x9f, 0xb9, 0xbc, 0xbd, 0x33, 0x43, 0x45, 0xbe, 0xc8, 0x33, 0x15, 0xbe,
+  0x81, 0x8a, 0x32, 0xbe, 0x49, 0x7d, 0x17, 0x3e, 0xed, 0x09, 0xf5, 0xbd,
+  0x1c, 0xf7, 0x12, 0xbe, 0x70, 0x5f, 0x3b, 0x3e, 0x5a, 0xf8, 0x06, 0xbe,
+  0xde, 0x29, 0x6a, 0xbb, 0x64, 0xae, 0xcf, 0xbd, 0x95, 0x5a, 0x97, 0xbd,
+  0xc3, 0xc9, 0x02, 0x3e, 0x09, 0x5e, 0xfd, 0xba, 0x16, 0xb0, 0x81, 0xbd,
+  0x8e, 0x54, 0xac, 0x3c, 0xfa, 0x7c, 0x9b, 0xbd, 0xa5, 0x0d, 0xd4, 0x3d,
+  0xaa, 0x5b, 0xd1, 0xbb, 0xde, 0x4d, 0x1f, 0xbc, 0x24, 0xf7, 0xcc, 0x3d,
+  0xcc, 0x16, 0x70, 0x3b, 0x20, 0xe1, 0x09, 0x3d, 0x84, 0x11, 0x86, 0xbe,
+  0x1c, 0x7c, 0x43, 0xbd, 0x26, 0xe5, 0xd8, 0x3b, 0xea, 0xe9, 0x92, 0x3d,
+  0x9f, 0xf1, 0x1a, 0x3d, 0xd9, 0xd3, 0x9d, 0x3d, 0xda, 0x03, 0x91, 0x3b,
+  0x70, 0x5e, 0xe5, 0x3c, 0x01, 0x09, 0x12, 0xbe, 0x0a, 0x77, 0x8d, 0xbd,
+  0x46, 0x19, 0x46, 0x3d, 0x18, 0x7b, 0x54, 0xbd, 0x07, 0xd6, 0x35, 0x3d,
+  0x30, 0xb9, 0xc8, 0xbb, 0x58, 0x9a, 0xa4, 0xbc, 0x35, 0x0a, 0xbc, 0xbd,
+  0x33, 0xc4, 0xf2, 0x3d, 0x68, 0x9f, 0x5d, 0x3b, 0xad, 0x60, 0xa4, 0x3d,
+  0xe4, 0x3e, 0x86, 0xbd, 0xaa, 0x82, 0x32, 0x3d, 0x71, 0x86, 0xae, 0x3d,
+  0x24, 0x5f, 0x0f, 0xbd, 0xd9, 0x61, 0xe0, 0x3c, 0xbf, 0x00, 0xb6, 0x3d,
+  0xf3, 0x58, 0xba, 0x3d, 0xb9, 0xf0, 0x57, 0x3d, 0xdf, 0x14, 0xb5, 0x3d,
+  0x93, 0x0e, 0x20, 0x3d, 0xf1, 0x34, 0x4a, 0x3d, 0x83, 0x50, 0xc3, 0x3c,
+  0xb6, 0xa4, 0xa2, 0x3c, 0x37, 0x09, 0xc1, 0xbd, 0x7d, 0x5a, 0x85, 0x3d,
+  0xc5, 0x37, 0xd3, 0x3d, 0x4c, 0x76, 0x85, 0x3d, 0x9d, 0x40, 0xcd, 0x3d,
+  0x35, 0xcc, 0x88, 0x3c, 0x2a, 0x71, 0x9c, 0x3d, 0x12, 0xdb, 0xaf, 0x3d,
+  0x55, 0x4c, 0x48, 0xbe, 0x64, 0xfa, 0xb9, 0x3d, 0xe9, 0xe3, 0xba, 0x3d,
+  0x76, 0xef, 0xe8, 0xbc, 0xd1, 0x5c, 0x8f, 0x3c, 0xa5, 0xde, 0x7b, 0x3d,
+  0x85, 0xe0, 0x31, 0x3d, 0x34, 0xd5, 0x06, 0xbd, 0xb9, 0x13, 0x59, 0x3d,
+  0x38, 0x70, 0x6d, 0xbd, 0x70, 0xc1, 0x4d, 0x3d, 0x9e, 0x19, 0x15, 0xbd,
+  0x1f, 0x3a, 0x06, 0x3e, 0xfd, 0x5f, 0x01, 0x3e, 0x3e, 0x09, 0x0e, 0xbb,
+  0x29, 0xb6, 0x86, 0xbc, 0x83, 0x63, 0x08, 0x3d, 0x64, 0x06, 0x10, 0xbd,
+  0xb6, 0x4c, 0x03, 0x3d, 0x3e, 0x19, 0x2a, 0x3c, 0xc9, 0xa1, 0xb0, 0xbc,
+  0x76, 0xd0, 0x40, 0x3d, 0x99, 0xb5, 0x6d, 0x3d, 0xb0, 0x5b, 0x84, 0xbc,
+  0xee, 0xed, 0x8a, 0x3d, 0xc1, 0x00, 0xf4, 0xbd, 0xa7, 0x93, 0x5b, 0xbd,
+  0x2f, 0xd8, 0x0c, 0xbe, 0x0d, 0x8c, 0xaa, 0xbd, 0x97, 0x5c, 0xba, 0x3d,
+  0x42, 0x1b, 0x82, 0xbd, 0xdc, 0xb5, 0x81, 0xbd, 0x6b, 0xde, 0x68, 0xbd,
+  0x9e, 0x58, 0xf4, 0xbd, 0x1e, 0x06, 0x30, 0xbe, 0xf4, 0x64, 0x91, 0xbe,
+  0x2e, 0xce, 0xe3, 0xbd, 0x72, 0x40, 0xbe, 0x3d, 0x65, 0x76, 0x1e, 0xbe,
+  0x46, 0xe3, 0x14, 0xbe, 0xe9, 0xb3, 0xd1, 0x3d, 0x22, 0x9d, 0x7e, 0xbd,
+  0x5f, 0x7c, 0xa5, 0xbd, 0xeb, 0x87, 0xb6, 0xbd, 0x9a, 0xc1, 0x8e, 0xbd,
+  0xc1, 0x57, 0x60, 0x3d, 0xf2, 0x07, 0x0e, 0xbd, 0x03, 0x82, 0x32, 0xbd,
+  0x9d, 0x7f, 0xbe, 0x3c, 0x48, 0x6b, 0xfb, 0xbd, 0x0d, 0x42, 0x2d, 0xbd,
+  0xda, 0xfe, 0x91, 0xbd, 0xed, 0xae, 0xc5, 0xbc, 0xa8, 0x7e, 0xfb, 0x3d,
+  0xa0, 0xb6, 0x93, 0xbd, 0x87, 0xcd, 0xa2, 0xbd, 0x37, 0x72, 0xb2, 0xbd,
+  0xfe, 0xd2, 0x1e, 0xbe, 0x84, 0x8a, 0x0c, 0xbc, 0x91, 0xa2, 0xb7, 0xbd,
+  0xcb, 0x2f, 0x85, 0xbd, 0xd6, 0xce, 0x03, 0x3e, 0x23, 0xcc, 0x3c, 0xbd,
+  0x5c, 0x95, 0xe1, 0xbc, 0x30, 0x1f, 0xc5, 0xbd, 0xb4, 0x7f, 0x2b, 0xbe,
+  0x32, 0x2d, 0x58, 0xbc, 0xfa, 0xa0, 0xe7, 0xbc, 0xb2, 0xd4, 0x8b, 0xbd,
+  0x76, 0x36, 0x27, 0x3c, 0xb8, 0xd5, 0x64, 0xbd, 0x89, 0xcb, 0x22, 0xbd,
+  0x24, 0xba, 0x1b, 0xbe, 0xc1, 0x49, 0x27, 0xbe, 0x3f, 0xbb, 0x99, 0xbd,
+  0xd8, 0x1d, 0x5e, 0xbd, 0xa3, 0xde, 0xb2, 0xbd, 0x4c, 0x1b, 0x45, 0x3d,
+  0x16, 0x36, 0x36, 0xbe, 0x5a, 0xc1, 0x98, 0xbd, 0x22, 0x75, 0x4a, 0xbe,
+  0xcf, 0x29, 0x28, 0xbe, 0x39, 0x03, 0xbb, 0xbd, 0x02, 0x3f, 0x94, 0xbd,
+  0x57, 0xdb, 0x88, 0x3c, 0x53, 0x5e, 0x17, 0x3c, 0x23, 0xf5, 0xb7, 0xbd,
+  0x64, 0x35, 0x22, 0xbd, 0x3d, 0xb2, 0x94, 0xbe, 0xac, 0xdb, 0xaf, 0xbd,
+  0x67, 0xb4, 0x11, 0x3c, 0xad, 0x99, 0x49, 0x3d, 0xde, 0x91, 0x57, 0x3d,
+  0xbc, 0x75, 0x8c, 0xbc, 0xec, 0x6d, 0xea, 0x3c, 0x6e, 0x91, 0x86, 0xbb,
+  0x2a, 0x2e, 0xbc, 0xbe, 0xc5, 0x3b, 0x48, 0xbc, 0x0a, 0x65, 0xf9, 0x3c,
+  0x22, 0xda, 0x01, 0xbc, 0x5d, 0x07, 0x1b, 0xbc, 0x85, 0x8b, 0xa9, 0x3c,
+  0x14, 0xb2, 0x83, 0x3d, 0x71, 0x74, 0x8d, 0x3d, 0x4a, 0xd8, 0xc0, 0xbe,
+  0x44, 0x7f, 0x57, 0xbd, 0x2a, 0x6c, 0x8a, 0xbd, 0xd5, 0x86, 0xbd, 0x3c,
+  0x3a, 0xc7, 0x25, 0xbd, 0x5e, 0x8b, 0x29, 0x3d, 0xaf, 0x50, 0x96, 0xbc,
+  0xf4, 0x07, 0xa2, 0xbd, 0xe1, 0xdb, 0x15, 0xbe, 0x16, 0x60, 0xbd, 0xbc,
+  0x5a, 0xae, 0xf0, 0xbc, 0x5d, 0xef, 0x91, 0xbd, 0x73, 0x4b, 0x96, 0xbc,
+  0x11, 0xf6, 0x4f, 0x3d, 0xe7, 0x23, 0x21, 0xbd, 0x98, 0x93, 0x8c, 0xbd,
+  0x77, 0x1e, 0x66, 0xbd, 0x02, 0x0b, 0xf1, 0xbd, 0x46, 0x02, 0xf2, 0xbd,
+  0x2c, 0x1a, 0xe5, 0xbd, 0x5f, 0x70, 0xe7, 0xbd, 0xb1, 0x65, 0xd1, 0x3d,
+  0xe7, 0x9b, 0xad, 0xbd, 0xd3, 0x3e, 0xe8, 0xbd, 0xca, 0xb8, 0xae, 0x3b,
+  0xae, 0xef, 0xcc, 0xbd, 0xb1, 0x6c, 0x2e, 0xbe, 0x55, 0xad, 0x68, 0xbe,
+  0xa1, 0xa0, 0x36, 0xbe, 0xbc, 0xd1, 0x09, 0x3e, 0x70, 0xcc, 0x4c, 0xbe,
+  0x24, 0x8f, 0x2a, 0xbe, 0x28, 0x96, 0x88, 0x3d, 0x0c, 0xe6, 0x2b, 0xbe,
+  0xb7, 0x82, 0x00, 0xbe, 0x74, 0xe7, 0x08, 0xbe, 0xa1, 0xca, 0x89, 0xbe,
+  0x3f, 0x55, 0xb5, 0x3d, 0x5b, 0x5f, 0x5c, 0xbe, 0xc1, 0xb5, 0x2a, 0xbe,
+  0x02, 0x62, 0x85, 0x3d, 0xd2, 0x14, 0xdb, 0xbd, 0xcc, 0x86, 0x19, 0xbe,
+  0xf9, 0xe5, 0x2d, 0xbe, 0xc4, 0xe5, 0xdc, 0xbd, 0x83, 0x85, 0xa4, 0x3d,
+  0xb4, 0x7d, 0xba, 0xbd, 0xcb, 0x87, 0x53, 0xbd, 0xaa, 0x40, 0xac, 0x3d,
+  0x37, 0xa0, 0x75, 0xbe, 0x57, 0x6f, 0x1d, 0xbe, 0x8e, 0xd7, 0x2c, 0xbe,
+  0xc2, 0x8c, 0x39, 0xbd, 0x89, 0xa6, 0xab, 0x3d, 0xab, 0x88, 0x10, 0xbe,
+  0x53, 0x7a, 0xc4, 0xbd, 0x54, 0xaf, 0x4f, 0x3d, 0x66, 0x39, 0x03, 0xbe,
+  0x6c, 0xab, 0xae, 0xbd, 0x01, 0x66, 0xd8, 0xbd, 0xe9, 0xdf, 0x1b, 0xbe,
+  0x52, 0x45, 0xfd, 0xbc, 0xab, 0x34, 0x34, 0xbe, 0x30, 0x42, 0x0a, 0xbe,
+  0x31, 0xfc, 0x05, 0x3d, 0x73, 0x69, 0x1c, 0xbe, 0xcb, 0xb0, 0xb3, 0xbd,
+  0x2a, 0xa8, 0xfc, 0xbd, 0x24, 0x29, 0x3b, 0xbe, 0x17, 0xb9, 0xfe, 0xbd,
+  0x61, 0xd6, 0xfe, 0xbd, 0xa4, 0xbd, 0x92, 0xbd, 0xd7, 0x89, 0x71, 0xbd,
+  0xca, 0x76, 0x00, 0xbe, 0x5e, 0x8b, 0x1f, 0xbe, 0x25, 0xe3, 0x8b, 0xbd,
+  0x74, 0x0b, 0xd7, 0xbd, 0x31, 0x80, 0x02, 0xbe, 0xe2, 0x4c, 0xf6, 0xbd,
+  0xd1, 0x15, 0x35, 0xbd, 0xba, 0x7f, 0x83, 0xbe, 0x2b, 0x6a, 0x26, 0xbe,
+  0xb0, 0x0a, 0x26, 0xbe, 0xe2, 0x02, 0xf5, 0xbb, 0x04, 0x15, 0x8d, 0xbd,
+  0x66, 0x67, 0x43, 0xbe, 0x74, 0xe5, 0xae, 0xbd, 0x58, 0x1d, 0x81, 0xbd,
+  0x25, 0x02, 0xb6, 0xbe, 0xa3, 0x1d, 0xce, 0xbd, 0xd7, 0x8c, 0xa3, 0xbd,
+  0x66, 0x53, 0x81, 0x3c, 0x30, 0x35, 0x09, 0xbd, 0x2b, 0xeb, 0x53, 0xbe,
+  0x45, 0x10, 0x23, 0x3c, 0xf1, 0xf6, 0x8c, 0xbd, 0x62, 0xcb, 0x13, 0xbf,
+  0x4e, 0x0a, 0x03, 0xbd, 0x9c, 0xae, 0x18, 0xbc, 0xd4, 0x15, 0xa7, 0x3c,
+  0x1d, 0xc9, 0x62, 0xbd, 0xbc, 0xb0, 0x6b, 0xbc, 0xdf, 0xf0, 0xfa, 0x3c,
+  0xf4, 0x90, 0xbc, 0xbc, 0x00, 0x19, 0xbe, 0xbe, 0x41, 0xde, 0x99, 0xbd,
+  0xf7, 0x42, 0xd1, 0x3c, 0x08, 0xeb, 0x12, 0xbd, 0x90, 0x37, 0x9d, 0xbd,
+  0x3e, 0x4e, 0x84, 0xbb, 0x0d, 0x27, 0xdc, 0xbb, 0xc9, 0x03, 0x9b, 0xbd,
+  0x34, 0xdc, 0x3b, 0xbd, 0x99, 0xcb, 0x7a, 0x3d, 0xda, 0x5d, 0xf7, 0xbb,
+  0x48, 0xc4, 0x0e, 0xbd, 0x0e, 0x41, 0x11, 0xbe, 0x24, 0x73, 0x0b, 0x3e,
+  0xc9, 0x52, 0xcb, 0xbd, 0xd9, 0x3f, 0xb2, 0xbc, 0x6f, 0xaf, 0x8d, 0x3d,
+  0x7f, 0xf9, 0xd7, 0xbc, 0x18, 0xbb, 0x73, 0xbc, 0x40, 0x8e, 0x00, 0xbd,
+  0xfd, 0x6f, 0xfb, 0x3c, 0x71, 0x4c, 0x03, 0x3e, 0x0e, 0x3f, 0x7c, 0xbc,
+  0x4f, 0x24, 0x8d, 0x3c, 0xb9, 0x09, 0xba, 0x3c, 0xf1, 0x41, 0xb0, 0x3c,
+  0xd0, 0xed, 0x8f, 0xbd, 0x27, 0xb1, 0x1a, 0xbe, 0xce, 0xff, 0xd1, 0xbc,
+  0xe8, 0x66, 0xbb, 0xbb, 0x9b, 0xd8, 0xef, 0xbd, 0x15, 0x51, 0xd4, 0xbd,
+  0x94, 0xc1, 0x61, 0x3d, 0x08, 0xa9, 0xa2, 0xbd, 0x1a, 0xef, 0xec, 0xbd,
+  0x7e, 0x01, 0xdf, 0xbd, 0xab, 0xf2, 0xad, 0xbd, 0x2a, 0xd5, 0xd6, 0x3d,
+  0x8b, 0x64, 0x09, 0xbe, 0x68, 0x01, 0xbf, 0xbd, 0xae, 0xc9, 0xc2, 0x3d,
+  0xf6, 0x5b, 0x2a, 0xbc, 0x9a, 0x6c, 0x0f, 0xbe, 0x9b, 0xf4, 0xc6, 0xbd,
+  0x22, 0xf9, 0x2d, 0xbd, 0x25, 0x68, 0xc7, 0x3d, 0xbd, 0x52, 0x87, 0xbd,
+  0xd4, 0xd9, 0x17, 0xbe, 0x09, 0x07, 0x17, 0x3e, 0x4b, 0x42, 0x7e, 0xbd,
+  0xfe, 0x9b, 0x4c, 0xbe, 0xb4, 0xcf, 0x65, 0xbe, 0xeb, 0x0a, 0x2d, 0xbe,
+  0xf1, 0x5f, 0x9d, 0x3d, 0x45, 0x57, 0x16, 0xbe, 0xaa, 0x73, 0x53, 0xbe,
+  0x4d, 0xc3, 0x94, 0x3b, 0xfa, 0xd8, 0x5b, 0xbd, 0x93, 0x26, 0x46, 0xbe,
+  0xe2, 0xf2, 0xf0, 0xbd, 0xa2, 0x49, 0x5a, 0xbe, 0x28, 0xfc, 0x05, 0x3c,
+  0xda, 0x7c, 0x18, 0xbd, 0xa2, 0x07, 0xf5, 0xbc, 0x36, 0xe8, 0x86, 0xbd,
+  0xc2, 0x7a, 0xc5, 0xbd, 0x28, 0x79, 0x02, 0xbe, 0x8c, 0x9f, 0xb9, 0xbd,
+  0x9a, 0x10, 0x17, 0xbe, 0x5e, 0xe1, 0xb2, 0xbd, 0xa3, 0x67, 0xcc, 0xbd,
+  0xcb, 0x37, 0x99, 0x39, 0x9d, 0xa4, 0xb1, 0xbd, 0xb1, 0x45, 0x85, 0xbd,
+  0x44, 0x72, 0x81, 0xbd, 0x60, 0x80, 0x23, 0xbd, 0x47, 0x96, 0xab, 0xbd,
+  0x43, 0x0b, 0xbb, 0xbd, 0x20, 0xe7, 0x6a, 0xbd, 0xb0, 0xb2, 0x0e, 0xbd,
+  0xb6, 0xb9, 0x6d, 0xbe, 0x47, 0x83, 0xca, 0xbd, 0xe3, 0xfc, 0xbf, 0xbc,
+  0x7c, 0xa6, 0x8e, 0x3d, 0xad, 0x94, 0x57, 0xbd, 0xef, 0xf5, 0xbb, 0xbd,
+  0x76, 0xc6, 0xf9, 0xbc, 0x43, 0xb7, 0x9b, 0xbd, 0xd3, 0x68, 0x42, 0xbe,
+  0x76, 0x8e, 0x63, 0xbd, 0x5a, 0x08, 0xc6, 0xbd, 0x3f, 0x39, 0x0b, 0xbd,
+  0xb0, 0xb4, 0xda, 0xbd, 0xfa, 0x42, 0xa1, 0xbd, 0x9d, 0x3b, 0x6d, 0xbd,
+  0x47, 0xec, 0x92, 0xbd, 0x42, 0x3b, 0x91, 0xbe, 0x72, 0xa9, 0x4b, 0x3c,
+  0x59, 0xbb, 0x0b, 0x3c, 0xf8, 0x9f, 0x73, 0x3c, 0xd2, 0x6f, 0x4e, 0xbd,
+  0xd8, 0xc4, 0xf2, 0x3c, 0xe1, 0xc5, 0xd6, 0x3b, 0x82, 0x03, 0xc6, 0xbc,
+  0xed, 0xeb, 0xda, 0x3c, 0x7f, 0x2f, 0xd6, 0x3d, 0x12, 0xaa, 0x9b, 0xbc,
+  0x96, 0x43, 0x69, 0x3d, 0xc2, 0x91, 0x81, 0xbd, 0x45, 0x83, 0x7c, 0x3d,
+  0x40, 0xca, 0xfa, 0x3c, 0x48, 0x74, 0x14, 0x3d, 0xe7, 0xf8, 0x9f, 0x3d,
+  0x55, 0xe9, 0x41, 0x3d, 0x82, 0xf5, 0xc5, 0x3c, 0x33, 0x5a, 0x08, 0x3c,
+  0x2a, 0x11, 0xf5, 0xbc, 0x13, 0x50, 0x21, 0x3e, 0x74, 0x3c, 0x17, 0x3d,
+  0x5c, 0x7c, 0x98, 0x39, 0x82, 0x5b, 0xc9, 0x3d, 0xdd, 0x72, 0x2a, 0xbb,
+  0x06, 0xad, 0xa0, 0xbd, 0xf0, 0x47, 0x26, 0x3d, 0xb9, 0xe4, 0x36, 0xbc,
+  0x71, 0x32, 0xce, 0x3d, 0x9d, 0xcb, 0x8f, 0x3b, 0x8a, 0x4e, 0x1a, 0x3d,
+  0xa2, 0x41, 0x33, 0x3e, 0x8c, 0x35, 0xb3, 0xbd, 0x7e, 0xe7, 0xe9, 0x3c,
+  0x3a, 0x95, 0xa9, 0x3b, 0x82, 0x89, 0xb2, 0x3a, 0x5c, 0x7c, 0xed, 0x3d,
+  0x80, 0x41, 0x49, 0xbd, 0xe9, 0xe3, 0x5a, 0xbc, 0x17, 0x28, 0xdc, 0x3d,
+  0xb0, 0x1b, 0xbe, 0xbd, 0xa7, 0x06, 0xa1, 0xbd, 0x1b, 0x59, 0x80, 0x3b,
+  0x79, 0xcc, 0x1c, 0xb8, 0x99, 0x5d, 0x11, 0x3e, 0x7c, 0x15, 0x9f, 0xbc,
+  0xc9, 0x67, 0x20, 0x3d, 0x71, 0xa6, 0x90, 0x3d, 0xcf, 0xb7, 0x2c, 0x3d,
+  0xd6, 0x4a, 0x71, 0xbc, 0xc4, 0x13, 0x42, 0xbd, 0x22, 0x2f, 0x4e, 0x3a,
+  0xf8, 0xbc, 0x04, 0x3e, 0xfb, 0xf5, 0x7a, 0xbd, 0x97, 0x08, 0x76, 0x3d,
+  0x64, 0x01, 0x2e, 0x3d, 0xec, 0x91, 0x8a, 0x3d, 0x21, 0xf9, 0x73, 0xbd,
+  0x7e, 0xa2, 0xb4, 0xbd, 0x6d, 0x97, 0xa1, 0xbc, 0xb5, 0x6c, 0xed, 0x3d,
+  0x43, 0x91, 0xd9, 0xbd, 0x79, 0x60, 0xd3, 0xbd, 0x6e, 0xc8, 0xaa, 0x3d,
+  0xa5, 0xab, 0x22, 0xbe, 0x72, 0xae, 0x87, 0xbd, 0xc7, 0x55, 0xed, 0xbd,
+  0xb7, 0x7f, 0x43, 0xbd, 0xfa, 0x83, 0x9f, 0x3c, 0xca, 0x90, 0xcc, 0xbd,
+  0xb2, 0x90, 0x2b, 0xbe, 0xa4, 0x39, 0x93, 0x3b, 0xd1, 0xc0, 0x4f, 0xbe,
+  0xc6, 0xd0, 0xd5, 0x3c, 0x6b, 0xe0, 0x1d, 0xbd, 0xbc, 0xfb, 0xfb, 0xbb,
+  0xde, 0x4c, 0xc8, 0x3d, 0x55, 0x1d, 0x52, 0xbd, 0x77, 0xea, 0xd0, 0xbd,
+  0xe3, 0x3b, 0xbe, 0xbc, 0x4e, 0xe2, 0x7a, 0xbd, 0x3f, 0x13, 0x12, 0x3d,
+  0xc2, 0x5e, 0x7a, 0xbc, 0x43, 0xfa, 0x3b, 0xbd, 0xec, 0x2e, 0x9d, 0x3d,
+  0x63, 0xad, 0x58, 0xbd, 0x9c, 0xbf, 0xd4, 0xbd, 0x06, 0x06, 0xbc, 0x3d,
+  0x41, 0x8a, 0xc9, 0xbd, 0x6f, 0xcc, 0xd4, 0xbd, 0xe1, 0x15, 0xd2, 0xbd,
+  0xa5, 0x08, 0xa9, 0xbd, 0xce, 0x45, 0x40, 0x3d, 0x36, 0x4c, 0x4c, 0xbd,
+  0xe7, 0x8f, 0x7e, 0xbd, 0x3e, 0x1e, 0x78, 0x3d, 0x1e, 0xf4, 0x09, 0xbe,
+  0x66, 0x15, 0x78, 0xbd, 0x2d, 0x0a, 0x5b, 0x3d, 0x15, 0x44, 0x7a, 0xbd,
+  0xc0, 0x5f, 0x1c, 0x3e, 0xdb, 0x76, 0xf4, 0x3c, 0xc4, 0xc7, 0x84, 0xbd,
+  0x3b, 0xc3, 0x91, 0x3d, 0x77, 0xff, 0x85, 0xbd, 0xd8, 0x0d, 0x30, 0xbd,
+  0xe6, 0x55, 0xc9, 0x3b, 0xf0, 0x93, 0x8d, 0xbd, 0x45, 0x32, 0x0b, 0x3e,
+  0x05, 0x4d, 0xb6, 0x3c, 0x11, 0x52, 0xec, 0xbd, 0xc9, 0x59, 0x01, 0x3e,
+  0x9c, 0x4a, 0x1b, 0xbe, 0xde, 0xd4, 0x08, 0xbd, 0x26, 0x19, 0x1d, 0xbc,
+  0x22, 0x45, 0xb3, 0xbd, 0xcb, 0xd7, 0x75, 0x3d, 0xe3, 0x4c, 0xee, 0xbd,
+  0xef, 0xe4, 0x06, 0xbe, 0xe0, 0x5c, 0x66, 0x3d, 0x99, 0x8b, 0x0d, 0xbe,
+  0xc5, 0x1a, 0xf6, 0xbc, 0xb7, 0x8a, 0xe1, 0xbd, 0x37, 0x05, 0xb2, 0xbc,
+  0x17, 0x9a, 0xaf, 0x3d, 0x9d, 0x6b, 0xef, 0xbd, 0x5d, 0xdb, 0x4e, 0xbe,
+  0xd7, 0x91, 0x23, 0x3e, 0x8f, 0x15, 0x3c, 0xbe, 0x45, 0xed, 0x16, 0xbc,
+  0x34, 0x84, 0xc1, 0xbc, 0xf8, 0x4c, 0x5b, 0xbd, 0xe1, 0xe6, 0xcc, 0x3c,
+  0x4b, 0xf6, 0xd7, 0xbc, 0x5c, 0xfb, 0xe4, 0xbd, 0x7c, 0xf5, 0xe8, 0x3d,
+  0x4c, 0x55, 0xbc, 0xbc, 0x0a, 0x4a, 0x95, 0x3d, 0xe8, 0x60, 0xd5, 0xbc,
+  0xed, 0x2e, 0x11, 0x3c, 0xc4, 0x0f, 0x0e, 0x3e, 0x68, 0x9e, 0x70, 0xbd,
+  0x74, 0x2c, 0x14, 0xbc, 0xcf, 0x72, 0x0f, 0x3e, 0x5e, 0xaf, 0xca, 0xbd,
+  0xc7, 0xe8, 0x69, 0xbd, 0xfa, 0xb2, 0x10, 0xbc, 0xb5, 0x8c, 0x1b, 0xbd,
+  0x75, 0x7a, 0xf6, 0x3d, 0xa7, 0x5e, 0xa4, 0xbc, 0x8e, 0x49, 0xed, 0x3c,
+  0x01, 0x00, 0x2a, 0x3d, 0x87, 0x81, 0x07, 0x3c, 0xb1, 0xa6, 0xa4, 0x3d,
+  0xe3, 0x6f, 0x51, 0xbd, 0x2e, 0xad, 0xed, 0x3c, 0xa6, 0xaf, 0x83, 0xbd,
+  0xf2, 0x63, 0x1d, 0xbd, 0x6e, 0x71, 0xaa, 0xbd, 0xdf, 0x20, 0xab, 0xbc,
+  0xf6, 0x88, 0x8c, 0xbd, 0x6f, 0x4c, 0x13, 0x3e, 0x6f, 0xbf, 0xf8, 0xbb,
+  0x0a, 0x4f, 0xfc, 0xbb, 0x76, 0x6d, 0x90, 0x3c, 0x90, 0x95, 0x61, 0x3c,
+  0xb0, 0x97, 0x87, 0x3a, 0x02, 0x4d, 0x29, 0xbd, 0xe5, 0xd0, 0xe8, 0xbd,
+  0x7a, 0x97, 0xda, 0x3c, 0x83, 0xec, 0x1a, 0xbd, 0x82, 0xe5, 0x23, 0xbc,
+  0x30, 0x58, 0xa2, 0xbc, 0xd9, 0x23, 0x92, 0xbc, 0x99, 0xec, 0xd4, 0xbd,
+  0xd0, 0x5c, 0xa1, 0xbd, 0x1b, 0xa1, 0x87, 0xbd, 0x0f, 0xe1, 0x3f, 0xbe,
+  0xd9, 0xa6, 0xff, 0xbd, 0xfe, 0x45, 0x79, 0xbd, 0x71, 0xdb, 0xd7, 0x3c,
+  0x34, 0x6e, 0xa1, 0xbd, 0xc1, 0xb0, 0x0e, 0xbe, 0x45, 0x4a, 0x59, 0xbc,
+  0x7b, 0x81, 0x8c, 0xbd, 0x98, 0x14, 0xeb, 0xbd, 0x56, 0x9a, 0x6b, 0xbd,
+  0xdd, 0x74, 0xa4, 0xbd, 0xe3, 0x0e, 0x89, 0xbd, 0xe6, 0x65, 0xdf, 0xbd,
+  0xdf, 0x73, 0x2d, 0xbe, 0x26, 0x04, 0xf9, 0xbc, 0xf8, 0xb2, 0x05, 0xbe,
+  0x56, 0x67, 0x8c, 0xbd, 0x94, 0x6a, 0x01, 0xbe, 0x75, 0x9d, 0x6e, 0xbc,
+  0x96, 0x0c, 0x7c, 0xbd, 0xe7, 0x4c, 0x54, 0xbe, 0x55, 0x8f, 0x1e, 0xbe,
+  0x85, 0x09, 0xbe, 0x3b, 0x7a, 0xee, 0xc9, 0x3b, 0xbc, 0x47, 0x64, 0xbd,
+  0x71, 0x49, 0xa9, 0xbd, 0x16, 0xf1, 0xc4, 0xbd, 0x91, 0x1b, 0x28, 0xbd,
+  0x0e, 0x41, 0xa0, 0xbe, 0xf7, 0x77, 0x04, 0xbe, 0xbb, 0x3f, 0xa3, 0x3c,
+  0xe6, 0x1a, 0xcd, 0xbc, 0xc3, 0xbf, 0x1c, 0x3c, 0x23, 0x0a, 0x24, 0xbd,
+  0x44, 0x85, 0x37, 0xbe, 0x6a, 0x5a, 0x11, 0xbd, 0x54, 0xee, 0xfb, 0xbd,
+  0x77, 0x5f, 0x0f, 0xbd, 0xd4, 0x84, 0x5c, 0xbc, 0x8a, 0xf8, 0xc6, 0x3c,
+  0xec, 0xed, 0x3a, 0xbc, 0x41, 0x97, 0xbb, 0x3d, 0x0c, 0x23, 0x27, 0x3d,
+  0x80, 0x27, 0x5c, 0x3b, 0xce, 0x11, 0x1e, 0x3d, 0xb2, 0x19, 0x8a, 0x3c,
+  0x00, 0x3b, 0x9e, 0xbc, 0xdb, 0x5c, 0x1b, 0xbd, 0xd1, 0x49, 0x66, 0x3d,
+  0x69, 0x86, 0x71, 0x3d, 0x09, 0xbd, 0x05, 0x3d, 0xbb, 0x4e, 0x12, 0xbd,
+  0x21, 0xc0, 0xaa, 0xbd, 0x5b, 0xf7, 0x41, 0x3d, 0x69, 0x7e, 0xb8, 0x3d,
+  0x51, 0x5d, 0x07, 0xbd, 0xe4, 0x52, 0xd2, 0xba, 0xd1, 0x48, 0x8e, 0x3d,
+  0xc6, 0xa7, 0x3a, 0x3d, 0x9a, 0xe7, 0x50, 0x3d, 0xd4, 0x63, 0xc1, 0xbd,
+  0x7f, 0xac, 0xf0, 0xbd, 0x16, 0x15, 0x97, 0x3c, 0xef, 0x27, 0x1a, 0xbe,
+  0x01, 0x82, 0x85, 0xbd, 0x45, 0xcc, 0xca, 0x3b, 0xb4, 0xdd, 0xc4, 0xbd,
+  0xea, 0x04, 0x9e, 0x3b, 0xe0, 0x09, 0x0b, 0xbc, 0x3c, 0xea, 0x3d, 0xbd,
+  0x1d, 0x0d, 0xf1, 0xbb, 0xa1, 0x98, 0x55, 0x3c, 0x5b, 0x6d, 0x2f, 0xbd,
+  0xbd, 0x61, 0x98, 0xbd, 0x12, 0x2a, 0x49, 0x3b, 0x8a, 0x1e, 0x2c, 0x39,
+  0xdb, 0xa6, 0xdf, 0xbd, 0xdd, 0x67, 0xe0, 0x3d, 0x90, 0xf7, 0x20, 0xbd,
+  0x89, 0x13, 0x66, 0x3c, 0xe0, 0xe1, 0x73, 0x3c, 0x66, 0x5e, 0x88, 0xbd,
+  0x0d, 0x3d, 0x95, 0x3b, 0x2c, 0x5e, 0xb8, 0x3c, 0x24, 0xa4, 0xc7, 0x3a,
+  0x6f, 0x53, 0x94, 0xbd, 0x85, 0xa9, 0x5b, 0xbb, 0xb0, 0xea, 0x96, 0xbd,
+  0x46, 0x9d, 0xe2, 0xbd, 0x28, 0xb0, 0x29, 0xbe, 0x80, 0x2f, 0x96, 0x3b,
+  0x72, 0xd2, 0x19, 0x3d, 0x4e, 0xa0, 0x13, 0xbe, 0x82, 0x14, 0x25, 0xbe,
+  0x42, 0x57, 0x27, 0xbc, 0x11, 0x69, 0xd1, 0xbd, 0xfe, 0x61, 0xfc, 0xbd,
+  0xd6, 0x82, 0x07, 0xbe, 0xdf, 0x06, 0xe0, 0xbc, 0x9c, 0x4d, 0xfb, 0xbb,
+  0x29, 0x74, 0xe5, 0xbd, 0xd4, 0xc5, 0x03, 0xbe, 0x78, 0x01, 0x96, 0xbb,
+  0xe2, 0xbe, 0x91, 0xbd, 0x4f, 0x53, 0x50, 0xbd, 0x3b, 0xdb, 0xce, 0xbd,
+  0x73, 0x86, 0x9d, 0xbd, 0x58, 0x22, 0xde, 0xbc, 0x8a, 0xe9, 0xb0, 0xbd,
+  0xdb, 0x86, 0xda, 0xbd, 0xfd, 0x70, 0xc2, 0x3d, 0xa8, 0x88, 0xcd, 0xba,
+  0x49, 0xfe, 0xe5, 0x3a, 0xf9, 0x5a, 0x84, 0xbd, 0x1c, 0xd8, 0xf5, 0xbd,
+  0x7c, 0x71, 0xd1, 0xbd, 0xc1, 0xcd, 0xeb, 0xbd, 0xa4, 0x46, 0x34, 0x3d,
+  0x08, 0x69, 0x50, 0xbc, 0xa5, 0x06, 0xc1, 0xbd, 0xe3, 0xc4, 0xe2, 0xbd,
+  0x81, 0x00, 0x96, 0xbc, 0xff, 0x4f, 0x1a, 0xbe, 0xd4, 0x5a, 0x85, 0xbd,
+  0xbc, 0xf8, 0x1d, 0xbc, 0x1e, 0x6a, 0x3a, 0xbd, 0x5d, 0xd7, 0xbd, 0xbd,
+  0xb1, 0xe2, 0xce, 0xbd, 0xae, 0x74, 0x9c, 0xbd, 0x9f, 0x3f, 0x9d, 0xbc,
+  0x77, 0xb1, 0xc8, 0xbd, 0x6b, 0x7c, 0x38, 0xbd, 0xa9, 0x38, 0x41, 0xbd,
+  0x72, 0xf0, 0xc0, 0xbd, 0x90, 0x02, 0x13, 0xbd, 0xb8, 0xcf, 0xe5, 0x3c,
+  0xb5, 0xb8, 0xcc, 0x3b, 0xf9, 0xe1, 0x54, 0x3d, 0xcc, 0xd5, 0x60, 0x3b,
+  0x02, 0x50, 0xf8, 0xbc, 0x53, 0xd1, 0x02, 0x3b, 0x42, 0x9a, 0xf6, 0xbb,
+  0x52, 0xa1, 0x7c, 0x3d, 0x3c, 0xab, 0x27, 0xbd, 0x5b, 0xab, 0x33, 0x3d,
+  0xd0, 0x01, 0xcf, 0x3d, 0x6b, 0x68, 0x7f, 0x3d, 0x7d, 0x3f, 0xde, 0x3c,
+  0xf9, 0x1d, 0x0d, 0x3e, 0xb4, 0xe3, 0xaa, 0x3d, 0x8c, 0xa1, 0x08, 0xbd,
+  0xc8, 0xe5, 0x66, 0xbc, 0xfd, 0xaf, 0x61, 0xbd, 0x68, 0xa6, 0xa6, 0x3c,
+  0x16, 0x54, 0xa3, 0x3d, 0x2b, 0xa5, 0x82, 0x3c, 0x39, 0xb7, 0xaa, 0x3c,
+  0x9b, 0x4e, 0x5d, 0x3d, 0xec, 0x92, 0xc5, 0x3c, 0x61, 0xea, 0x6b, 0x3c,
+  0xa8, 0x7e, 0xa5, 0xbd, 0xd1, 0xca, 0x90, 0xbd, 0x0a, 0x01, 0x54, 0x3d,
+  0x3f, 0x78, 0x16, 0xbd, 0x74, 0xe5, 0x85, 0xbc, 0x7d, 0xd7, 0x34, 0xbd,
+  0x5f, 0x33, 0x7e, 0x3d, 0x2b, 0x42, 0x0c, 0x3d, 0x56, 0x7d, 0x15, 0x3d,
+  0x58, 0x8a, 0x02, 0x3c, 0xb3, 0x03, 0x00, 0xbd, 0x1d, 0xb1, 0x81, 0xbd,
+  0x38, 0x84, 0x28, 0x3d, 0xaa, 0x80, 0x16, 0x39, 0x1f, 0x20, 0x06, 0xbc,
+  0x28, 0x32, 0xfd, 0x3d, 0xbe, 0xb3, 0xb5, 0x3d, 0x77, 0x57, 0x05, 0x3e,
+  0x6b, 0x6c, 0x25, 0x3c, 0x69, 0xf4, 0x0c, 0x3d, 0x74, 0x46, 0x43, 0x3d,
+  0xb3, 0x59, 0x22, 0x3d, 0x91, 0x3b, 0xac, 0xbd, 0x78, 0xeb, 0x03, 0xbe,
+  0x19, 0xd9, 0x11, 0xbc, 0x26, 0x91, 0x45, 0xbd, 0xef, 0xb8, 0x3d, 0xbd,
+  0xf1, 0xdb, 0x1f, 0x3a, 0xed, 0xbd, 0x37, 0xbc, 0x24, 0x78, 0x3a, 0xba,
+  0xa7, 0x00, 0x16, 0xbe, 0x04, 0x5f, 0x45, 0xbe, 0xdb, 0xc1, 0x7e, 0xbd,
+  0xc4, 0x6f, 0xd0, 0xbd, 0x3b, 0x6f, 0x3e, 0xbe, 0x26, 0x40, 0x20, 0xbd,
+  0x54, 0x31, 0x0a, 0xbe, 0x0b, 0xe7, 0xc1, 0xbd, 0x7d, 0xa0, 0x23, 0x3c,
+  0x19, 0xd6, 0x48, 0x3b, 0x3e, 0x95, 0x89, 0xbd, 0x43, 0x25, 0x3b, 0xbd,
+  0x33, 0x24, 0x87, 0xbe, 0x1b, 0x0f, 0x0f, 0xbe, 0x9e, 0xd9, 0xa4, 0xbc,
+  0xc5, 0x4a, 0x28, 0xbd, 0xdc, 0xce, 0x2c, 0x3d, 0xb2, 0x4c, 0x81, 0x3d,
+  0x8d, 0x43, 0xb4, 0xbc, 0x9c, 0xc2, 0x80, 0x3c, 0x22, 0x16, 0x00, 0xbe,
+  0xd8, 0xa9, 0x81, 0xbe, 0xc9, 0xdb, 0x1b, 0x3d, 0xee, 0xd0, 0x20, 0x3d,
+  0x19, 0x20, 0x29, 0xbd, 0xdb, 0x67, 0x6a, 0x3d, 0x6a, 0x5e, 0x00, 0xbc,
+  0xf7, 0x54, 0x2a, 0xbd, 0x7a, 0xcd, 0xcd, 0xbd, 0x3f, 0x56, 0xa6, 0xbe,
+  0x95, 0xcd, 0xeb, 0xbc, 0x31, 0x72, 0x0f, 0x3b, 0xa7, 0x18, 0x33, 0xbc,
+  0xed, 0x14, 0x02, 0x3c, 0xad, 0x26, 0xe8, 0xbc, 0x5a, 0xc2, 0x44, 0xbd,
+  0x79, 0x8c, 0xd8, 0xbc, 0xd8, 0xcd, 0x4b, 0xbe, 0xff, 0x51, 0xe2, 0xbb,
+  0x6f, 0x9a, 0x20, 0x3d, 0xd6, 0xa3, 0x65, 0xbd, 0x3d, 0xf0, 0x2a, 0xbd,
+  0x0d, 0x0b, 0xaf, 0xbd, 0x97, 0x59, 0x87, 0xbd, 0x66, 0x48, 0xbe, 0xbd,
+  0xaa, 0x33, 0x8b, 0xbd, 0x28, 0xfe, 0x60, 0xbc, 0xb8, 0x73, 0x73, 0xbd,
+  0x58, 0x96, 0x8c, 0xbd, 0x42, 0x85, 0x14, 0x3a, 0x17, 0xd2, 0x0d, 0x3d,
+  0x4a, 0xa9, 0x5d, 0xbb, 0x3c, 0xd4, 0x38, 0xba, 0xc9, 0x69, 0x11, 0x3e,
+  0x2d, 0xde, 0xc5, 0xbc, 0x80, 0x74, 0xdb, 0xbc, 0x7a, 0x1f, 0x5f, 0x3d,
+  0xdc, 0x68, 0xca, 0xbc, 0x29, 0x3b, 0xa3, 0x3d, 0xc7, 0xb0, 0x9d, 0x3d,
+  0x12, 0x12, 0x1f, 0xbc, 0x42, 0x3c, 0xc6, 0x3d, 0xc1, 0x37, 0x8e, 0x3d,
+  0xa4, 0xa2, 0x18, 0x3d, 0x25, 0xf8, 0x0d, 0x3e, 0x04, 0xa4, 0xca, 0xbd,
+  0x99, 0xec, 0x99, 0x3c, 0x2a, 0xef, 0x00, 0x3d, 0xe9, 0xa3, 0x8a, 0x3d,
+  0x31, 0xc9, 0x3b, 0x3e, 0xa5, 0xb1, 0xa1, 0x3d, 0xe3, 0xcc, 0xdd, 0x3b,
+  0xbf, 0x45, 0x92, 0x3c, 0x46, 0xdf, 0x88, 0xbd, 0xf0, 0x55, 0xc1, 0xbc,
+  0x42, 0x4a, 0x41, 0x3d, 0x26, 0xbd, 0x28, 0x3e, 0x9e, 0xef, 0x58, 0x3e,
+  0xee, 0xa5, 0x0e, 0x3a, 0xb6, 0x84, 0x89, 0xbd, 0x2b, 0x68, 0x96, 0x3d,
+  0x7a, 0x87, 0x04, 0x3d, 0x72, 0x76, 0x4a, 0xbc, 0x3f, 0xa5, 0x0e, 0x3e,
+  0x07, 0x56, 0x98, 0x3d, 0xe5, 0x46, 0x25, 0x3d, 0x3e, 0x4f, 0x9d, 0x3c,
+  0xcf, 0x42, 0x3a, 0x3d, 0x02, 0x0c, 0xcd, 0x3a, 0x47, 0x50, 0x2f, 0x3e,
+  0x4a, 0xf3, 0x11, 0x3d, 0xb1, 0x40, 0xfd, 0x3d, 0xac, 0xdc, 0xaf, 0x3d,
+  0x3a, 0xf5, 0x95, 0x3c, 0x26, 0x7f, 0x08, 0x3e, 0x06, 0x79, 0xfb, 0x3d,
+  0x8c, 0x0a, 0x64, 0xbd, 0xf5, 0x16, 0x83, 0xbe, 0x4b, 0x9d, 0xdb, 0xbd,
+  0x5f, 0xf1, 0x34, 0xbe, 0x9b, 0xb5, 0x26, 0xbe, 0xc2, 0x68, 0x1d, 0xbc,
+  0x04, 0x5b, 0x27, 0xbe, 0xdc, 0x20, 0x38, 0xbe, 0x7f, 0x9f, 0x63, 0xbe,
+  0x71, 0x4c, 0x81, 0xbe, 0x71, 0x15, 0xd4, 0xbd, 0x4d, 0x02, 0x2d, 0xbe,
+  0x37, 0x04, 0x57, 0xbe, 0x53, 0x38, 0xd7, 0xbd, 0x12, 0x11, 0x3f, 0xbe,
+  0x04, 0x76, 0x43, 0xbe, 0x63, 0x1a, 0xa4, 0xbd, 0xcd, 0xb8, 0xd6, 0x3c,
+  0x69, 0x1e, 0x9d, 0xbd, 0xb7, 0xe1, 0x79, 0xbd, 0xef, 0xe4, 0x29, 0xbe,
+  0x9b, 0x3a, 0x23, 0xbe, 0xf0, 0x65, 0xbb, 0xbd, 0xae, 0x25, 0x90, 0xbd,
+  0xe1, 0x7e, 0x56, 0xbe, 0x84, 0xc2, 0x6b, 0x3d, 0x12, 0x15, 0x3d, 0x3d,
+  0x22, 0xbe, 0xc2, 0x3c, 0xd9, 0x2a, 0x1b, 0xbe, 0x19, 0x54, 0xb0, 0xbe,
+  0x19, 0xaa, 0xa8, 0x3c, 0x7f, 0xea, 0x0f, 0x3d, 0x75, 0xf7, 0x5f, 0xbe,
+  0x52, 0xe0, 0xe1, 0x3d, 0xf9, 0x4a, 0xc8, 0x3d, 0x3a, 0xa7, 0x5b, 0x3d,
+  0xbe, 0x72, 0xe7, 0xbd, 0xab, 0x54, 0xca, 0xbe, 0xed, 0x64, 0x2f, 0x3d,
+  0xd8, 0x18, 0x7e, 0x3d, 0x2f, 0xe5, 0x75, 0xbd, 0x7b, 0xff, 0x01, 0x3e,
+  0x0e, 0x2a, 0xe9, 0x3c, 0xe9, 0xba, 0x82, 0xbd, 0xdf, 0x8d, 0x02, 0xbe,
+  0x1a, 0xec, 0x48, 0xbe, 0xe5, 0x61, 0xa3, 0xbc, 0xdc, 0xd2, 0x0b, 0x3d,
+  0x57, 0x74, 0xd2, 0xbd, 0xa4, 0x5e, 0x31, 0xbd, 0x3e, 0x39, 0xb8, 0xba,
+  0xb6, 0xfd, 0xa2, 0xbc, 0x4c, 0xd4, 0x2f, 0x3d, 0xcc, 0x09, 0x36, 0x3d,
+  0xd9, 0x25, 0x9d, 0xbd, 0xb8, 0xc2, 0xb3, 0xbc, 0x37, 0x49, 0x73, 0x3c,
+  0x3e, 0x1d, 0x7f, 0xbd, 0xd3, 0x7e, 0xc8, 0xbc, 0xa3, 0xa6, 0x2d, 0xbe,
+  0x6e, 0xfb, 0x29, 0x3b, 0x0d, 0xc9, 0x9e, 0x3e, 0x01, 0xd1, 0x5f, 0x3b,
+  0x87, 0x9f, 0xf9, 0xbc, 0x0c, 0x2f, 0xec, 0x3d, 0x49, 0x68, 0x90, 0xbd,
+  0x58, 0xea, 0x0e, 0x3d, 0x54, 0x1c, 0x02, 0xbe, 0x72, 0x6b, 0x2f, 0x3d,
+  0x9b, 0xe5, 0xa3, 0x3e, 0x16, 0x07, 0x34, 0xbd, 0x30, 0x91, 0x22, 0xbd,
+  0x80, 0x0b, 0x97, 0x3e, 0xec, 0x0b, 0xd7, 0xbd, 0x15, 0x5b, 0xc4, 0x3d,
+  0x22, 0x76, 0x94, 0xbd, 0xb4, 0xea, 0xf4, 0x3d, 0x40, 0xd0, 0xc7, 0x3e,
+  0x88, 0x02, 0x8c, 0x3d, 0x91, 0x1e, 0x03, 0x3d, 0x98, 0x75, 0x81, 0x3e,
+  0x29, 0x92, 0xcc, 0xbd, 0x58, 0x7c, 0x40, 0xbd, 0xea, 0xc9, 0x95, 0x3b,
+  0xb8, 0x0d, 0x1f, 0x3e, 0xd6, 0x0a, 0x6d, 0x3e, 0xef, 0x56, 0xe6, 0xbc,
+  0xcc, 0xb3, 0x6a, 0xbd, 0x31, 0x25, 0x8d, 0x3e, 0x81, 0x4d, 0xc2, 0x3d,
+  0x0c, 0x3f, 0xc4, 0x39, 0x67, 0xc7, 0xe0, 0x3d, 0x56, 0x2c, 0x04, 0x3e,
+  0xa5, 0xcd, 0x17, 0x3e, 0x0e, 0x0d, 0x19, 0x3d, 0xea, 0x52, 0x62, 0x3c,
+  0x97, 0x6f, 0x43, 0x3e, 0x55, 0x16, 0x4a, 0x3e, 0xd7, 0x3e, 0xa8, 0x3d,
+  0x0d, 0x10, 0x4c, 0x3e, 0x62, 0x05, 0x85, 0x3d, 0xd4, 0x31, 0xbc, 0xbc,
+  0xad, 0xf5, 0xd2, 0x3d, 0x95, 0x8d, 0x60, 0x3e, 0x83, 0xa1, 0x28, 0x3c,
+  0x90, 0x83, 0x93, 0xbe, 0x61, 0xa0, 0x68, 0xbe, 0xe5, 0xf4, 0x57, 0xbe,
+  0xf2, 0x33, 0x7d, 0xbe, 0xa7, 0xee, 0xa9, 0xbd, 0x1a, 0xa2, 0x62, 0xbe,
+  0x25, 0xbc, 0x97, 0xbe, 0x01, 0x62, 0xd3, 0xbd, 0x50, 0xa8, 0xbe, 0xbd,
+  0x9b, 0xb1, 0x8a, 0xbd, 0xbe, 0xca, 0x24, 0xbe, 0x4a, 0x69, 0x35, 0xbe,
+  0x8b, 0x95, 0xb7, 0xbd, 0xa1, 0x5b, 0x14, 0xbe, 0xa1, 0xdc, 0x93, 0xbd,
+  0xf7, 0x9b, 0x42, 0xbe, 0xc4, 0x58, 0xb9, 0x3d, 0x79, 0x8e, 0xe4, 0x3c,
+  0xeb, 0x39, 0x0c, 0xbc, 0x4a, 0x41, 0xfd, 0xbd, 0x14, 0xfd, 0x1d, 0xbe,
+  0x99, 0x8d, 0x6e, 0x3d, 0x37, 0x7f, 0x47, 0x3c, 0xc6, 0xc1, 0x46, 0xbe,
+  0x27, 0x69, 0xfb, 0x3d, 0x08, 0x4b, 0x68, 0xbb, 0xff, 0xa8, 0xa2, 0xbb,
+  0x15, 0x1c, 0x01, 0xbc, 0xd1, 0xb2, 0x9c, 0xbe, 0x73, 0x06, 0x07, 0x3d,
+  0xb7, 0x1c, 0x4e, 0x3d, 0x8d, 0xf0, 0x8e, 0xbe, 0x7f, 0xf0, 0x29, 0x3e,
+  0x6d, 0xa2, 0x12, 0x3c, 0xf0, 0x65, 0x52, 0x3d, 0x59, 0x12, 0x9d, 0xbd,
+  0xf7, 0xad, 0x89, 0xbe, 0x6b, 0x95, 0x07, 0xbd, 0xe7, 0x0e, 0x51, 0x3d,
+  0xf6, 0x1c, 0x17, 0xbe, 0xaf, 0x0a, 0x34, 0x3e, 0x3f, 0xa4, 0x11, 0x3d,
+  0xc8, 0x54, 0xf5, 0x3a, 0xb3, 0x68, 0x9c, 0xbd, 0xfb, 0xbe, 0x2d, 0xbe,
+  0xd2, 0xda, 0x33, 0xbd, 0x60, 0x0a, 0x1c, 0x3c, 0x7f, 0x09, 0x30, 0xbd,
+  0x3d, 0x44, 0x0c, 0x3b, 0x04, 0xec, 0x44, 0x3d, 0x91, 0xa3, 0x25, 0xbe,
+  0x59, 0xc6, 0x85, 0xbd, 0xdf, 0x04, 0x88, 0x3d, 0x67, 0x07, 0x00, 0xbe,
+  0x26, 0x76, 0x61, 0xbd, 0x0d, 0xea, 0x9d, 0x3d, 0xf4, 0x62, 0x95, 0xbd,
+  0xa8, 0xce, 0xa9, 0xbd, 0x96, 0xe9, 0x75, 0xbe, 0xc9, 0x5c, 0xc8, 0xbd,
+  0x58, 0xe6, 0x9c, 0x3e, 0xdb, 0xd1, 0x5a, 0xbe, 0xec, 0x8c, 0x0d, 0xbe,
+  0xdc, 0xa7, 0xaa, 0x3d, 0xc2, 0xaa, 0x0a, 0xbe, 0x79, 0xa3, 0x8b, 0xbd,
+  0xbd, 0x9d, 0xb4, 0xbe, 0xe5, 0x1c, 0x2f, 0xbd, 0x08, 0x7e, 0xf0, 0x3e,
+  0x8b, 0xec, 0x4a, 0xbe, 0x20, 0xa8, 0xc9, 0xbd, 0x62, 0x69, 0x19, 0x3e,
+  0x78, 0x19, 0xdd, 0xbd, 0x8c, 0xe6, 0xf7, 0xbd, 0x0e, 0xaf, 0x81, 0xbe,
+  0x8a, 0xa2, 0x38, 0x3d, 0xf4, 0xea, 0xeb, 0x3e, 0xdf, 0x4d, 0x60, 0xbe,
+  0xe2, 0x3b, 0x01, 0xbe, 0x2f, 0x30, 0x6f, 0x3e, 0x5e, 0x01, 0xcb, 0xbd,
+  0xab, 0xeb, 0x31, 0xbd, 0x49, 0xd3, 0x3c, 0xbe, 0xc3, 0xb2, 0x98, 0x3d,
+  0x9d, 0x9d, 0xb5, 0x3e, 0xf6, 0x04, 0x18, 0xbe, 0x46, 0xe8, 0x74, 0xbd,
+  0x64, 0x13, 0xb0, 0x3e, 0xd0, 0xf8, 0xce, 0x3d, 0x52, 0xcb, 0x03, 0x3d,
+  0x4a, 0x57, 0x9e, 0x3b, 0xbd, 0x7a, 0x35, 0x3e, 0x55, 0xc5, 0x97, 0x3e,
+  0x19, 0xfa, 0xe3, 0x3d, 0x31, 0xba, 0x17, 0x3e, 0x75, 0x96, 0x60, 0x3e,
+  0x2b, 0x3a, 0x9d, 0x3e, 0xee, 0x9f, 0x83, 0x3e, 0x44, 0x5d, 0x90, 0x3e,
+  0x98, 0x2c, 0x84, 0x3e, 0xce, 0x07, 0xdb, 0x3d, 0xc6, 0x7d, 0x6b, 0x3e,
+  0x57, 0xe4, 0x8e, 0x3e, 0xb6, 0xbc, 0x79, 0xbd, 0x9c, 0xb8, 0xed, 0xbd,
+  0x62, 0xe8, 0x45, 0xbe, 0x34, 0x06, 0x54, 0xbe, 0x56, 0x3e, 0x57, 0xbe,
+  0x36, 0x2d, 0x96, 0xbd, 0x07, 0x65, 0x44, 0xbe, 0xe8, 0xd5, 0x4a, 0xbe,
+  0xd9, 0x10, 0xd5, 0xbd, 0x7e, 0x98, 0x9b, 0xbd, 0x0c, 0x70, 0x3d, 0xbd,
+  0xd5, 0xaa, 0xd0, 0x3b, 0x16, 0x22, 0xc5, 0xbd, 0xda, 0x37, 0xc2, 0x3b,
+  0xb2, 0x21, 0x92, 0xbd, 0xda, 0x4f, 0xe3, 0xbd, 0x3a, 0x05, 0x58, 0xbe,
+  0xb8, 0xd9, 0xe3, 0x3b, 0xaa, 0x98, 0xfa, 0x3c, 0x48, 0x87, 0x8a, 0x3c,
+  0x8a, 0x87, 0x91, 0xbd, 0xc4, 0xd3, 0xe8, 0xbd, 0x0a, 0x8c, 0x41, 0x3d,
+  0x42, 0x43, 0x52, 0xbc, 0x63, 0x74, 0xb8, 0xbe, 0x65, 0xaa, 0xf9, 0x3c,
+  0xe5, 0xb5, 0x8d, 0x3d, 0xe1, 0x75, 0x40, 0xbd, 0x0b, 0x8a, 0x26, 0xbd,
+  0xff, 0x2d, 0x22, 0xbe, 0x03, 0xb4, 0x78, 0x3d, 0xa5, 0x4b, 0x32, 0xbd,
+  0x1e, 0xbf, 0x4a, 0xbe, 0x8d, 0x9a, 0xad, 0x3d, 0xfa, 0x87, 0xa1, 0x3d,
+  0x0e, 0x53, 0x8d, 0x3c, 0x78, 0x45, 0x41, 0xbd, 0x37, 0x7b, 0xd0, 0xbd,
+  0x72, 0x44, 0x40, 0x3d, 0xc0, 0xf5, 0x8e, 0x3d, 0x7c, 0x4d, 0x94, 0xbd,
+  0xe5, 0xd2, 0x50, 0x3d, 0xa6, 0xc4, 0x78, 0x3c, 0x69, 0xc6, 0x1b, 0x3c,
+  0xdf, 0x77, 0x6b, 0xbb, 0x01, 0x8b, 0x9f, 0x3d, 0x7a, 0x71, 0xa8, 0x3d,
+  0xaf, 0x59, 0x13, 0x3e, 0x26, 0x04, 0x05, 0x3d, 0x14, 0x1b, 0x15, 0x3e,
+  0x03, 0xe7, 0x19, 0xbc, 0x6c, 0x5e, 0x8c, 0xbd, 0x6b, 0x61, 0xab, 0x3d,
+  0x40, 0x64, 0x44, 0x3e, 0x66, 0x75, 0x38, 0xbd, 0x82, 0xdd, 0x85, 0xbc,
+  0x11, 0xc7, 0x6e, 0x3c, 0xc2, 0x29, 0x51, 0xbc, 0x22, 0x05, 0xa2, 0xbd,
+  0xc5, 0x93, 0x94, 0xbe, 0xc0, 0xa2, 0x36, 0xbd, 0x0f, 0x1d, 0xc7, 0x3e,
+  0x00, 0x03, 0x3d, 0xbe, 0x90, 0x2a, 0x0d, 0xbe, 0x44, 0xde, 0xee, 0x3d,
+  0xca, 0x9e, 0x8f, 0xbc, 0x6a, 0x5d, 0x60, 0xbe, 0x85, 0x6c, 0xb6, 0xbe,
+  0xfc, 0x2e, 0x26, 0xbe, 0xde, 0x71, 0xe3, 0x3e, 0xb4, 0xbb, 0x6b, 0xbe,
+  0x27, 0xe9, 0x01, 0xbe, 0x7e, 0xc6, 0x23, 0x3e, 0x48, 0xaf, 0x58, 0xbd,
+  0x08, 0xa6, 0x62, 0xbe, 0xca, 0xed, 0x9f, 0xbe, 0x3d, 0xd9, 0x4c, 0xbe,
+  0x84, 0x8a, 0x9f, 0x3e, 0xef, 0x0e, 0x72, 0xbe, 0x73, 0x6c, 0xe7, 0xbd,
+  0xce, 0xf2, 0x48, 0x3e, 0x7b, 0xc4, 0x0f, 0xbe, 0x2f, 0xcd, 0x71, 0xbe,
+  0x7a, 0x15, 0xaa, 0xbe, 0xb7, 0x41, 0x08, 0xbe, 0xce, 0x48, 0x9f, 0x3e,
+  0x21, 0x6c, 0xb1, 0xbe, 0x36, 0x64, 0x48, 0xbe, 0x9a, 0x16, 0x3b, 0x3e,
+  0x23, 0xae, 0x6a, 0xbe, 0x01, 0x17, 0x4b, 0xbb, 0xe9, 0xdc, 0x2a, 0xbe,
+  0x18, 0xb9, 0x91, 0x3d, 0x0e, 0x5e, 0xbf, 0x3e, 0x41, 0x08, 0xd3, 0xbd,
+  0x49, 0xf5, 0x77, 0xbc, 0x85, 0xbd, 0x8a, 0x3d, 0xd5, 0xa1, 0x26, 0x3e,
+  0xea, 0x0d, 0xeb, 0x3d, 0xc8, 0x37, 0x02, 0x3e, 0xca, 0xf1, 0x54, 0x3e,
+  0xe1, 0xce, 0x26, 0x3e, 0xc7, 0xa8, 0x70, 0x3e, 0x0d, 0xf3, 0x7e, 0x3e,
+  0x35, 0x61, 0xd2, 0xbb, 0xd0, 0x95, 0x43, 0xbd, 0x5a, 0x0f, 0x32, 0x3d,
+  0xb4, 0xa5, 0x48, 0xbd, 0x59, 0xc7, 0x0c, 0xbe, 0x01, 0xfb, 0x8f, 0x3c,
+  0x4f, 0xd1, 0xbc, 0xbd, 0xd2, 0x17, 0x76, 0x3b, 0x45, 0x87, 0xd7, 0xbd,
+  0xeb, 0x57, 0x61, 0xbd, 0xd8, 0xf3, 0xce, 0xbd, 0x1e, 0x95, 0x16, 0xbd,
+  0x9c, 0xba, 0x57, 0xbd, 0x27, 0x89, 0x8a, 0xbd, 0x72, 0x84, 0x0f, 0x3c,
+  0x69, 0x75, 0xd5, 0xbc, 0x1d, 0x66, 0x5b, 0xbe, 0x7d, 0x13, 0x50, 0xbd,
+  0xfa, 0xb4, 0x9b, 0xba, 0xed, 0x41, 0x90, 0x3c, 0x1c, 0xcf, 0xe2, 0x3d,
+  0x79, 0xb4, 0xdb, 0x3d, 0xd2, 0xbc, 0x8d, 0xbd, 0xab, 0x70, 0x61, 0xbd,
+  0xd4, 0x57, 0x9f, 0xbe, 0x14, 0xff, 0x5b, 0x3c, 0xe0, 0xc9, 0x68, 0x3d,
+  0xc6, 0x20, 0xca, 0xbc, 0x56, 0x45, 0x51, 0x3d, 0x7e, 0x13, 0x7e, 0x3d,
+  0xb8, 0xf9, 0x63, 0xbd, 0x1a, 0xd0, 0xc8, 0xbd, 0xaa, 0xea, 0x75, 0xbe,
+  0xb8, 0x24, 0x21, 0x3d, 0xe5, 0x9b, 0xaf, 0x3c, 0xe9, 0x9a, 0x42, 0xbd,
+  0x9a, 0xbf, 0x3c, 0x3c, 0x8a, 0xd3, 0x47, 0xbb, 0x8d, 0xb0, 0xa3, 0x3c,
+  0x28, 0xb1, 0x25, 0xb7, 0x8a, 0x77, 0x05, 0xbe, 0x9b, 0x75, 0x4d, 0xbc,
+  0xe7, 0x13, 0x99, 0x3d, 0xa3, 0x33, 0x97, 0xbc, 0x67, 0xb9, 0xff, 0x3c,
+  0x67, 0x0f, 0x52, 0x3d, 0x8d, 0x94, 0x16, 0x3d, 0x9b, 0x29, 0x7d, 0x3d,
+  0x86, 0xfa, 0x90, 0x3d, 0x1c, 0x3e, 0x11, 0x3d, 0x17, 0x31, 0x0d, 0x3d,
+  0x2d, 0x1a, 0x17, 0xbd, 0x43, 0xf7, 0x5d, 0x3d, 0xdf, 0x86, 0x62, 0x3e,
+  0x90, 0x1f, 0xd8, 0x3c, 0x96, 0xfc, 0x6b, 0xbc, 0x3d, 0xce, 0xad, 0x3d,
+  0x0b, 0x4b, 0x4a, 0xbc, 0x5b, 0xd4, 0x2e, 0xbd, 0x18, 0x40, 0x25, 0xbe,
+  0x6b, 0xf7, 0xfb, 0xbd, 0xec, 0x78, 0x7a, 0x3e, 0x50, 0xcc, 0x3b, 0xbe,
+  0x13, 0xf3, 0xe0, 0xbd, 0xf1, 0x32, 0xba, 0x3d, 0xe2, 0xc6, 0x05, 0x3d,
+  0x2a, 0x93, 0x2c, 0xbe, 0xb7, 0xe7, 0x3f, 0xbe, 0xf4, 0x06, 0x43, 0xbe,
+  0x24, 0xf3, 0x0a, 0x3e, 0x82, 0x3d, 0x61, 0xbe, 0x43, 0xb7, 0x0a, 0xbe,
+  0xfa, 0x1f, 0xb5, 0xbc, 0xee, 0x8d, 0x77, 0x3c, 0xf9, 0x0f, 0xf4, 0xbd,
+  0xf1, 0xf1, 0x5c, 0xbe, 0x35, 0xf3, 0x59, 0xbe, 0x71, 0x1e, 0x13, 0xbb,
+  0x7e, 0x59, 0x0c, 0xbe, 0x86, 0x08, 0xe0, 0xbd, 0x7c, 0x75, 0x0e, 0x3e,
+  0xb6, 0x70, 0x27, 0xbd, 0x23, 0xd7, 0x26, 0xbe, 0xbb, 0x21, 0x4f, 0xbe,
+  0x44, 0x0e, 0xac, 0xbe, 0x85, 0xdb, 0xcb, 0x3c, 0xb4, 0x87, 0x8b, 0xbe,
+  0x94, 0xbc, 0x0d, 0xbe, 0x42, 0xa2, 0x85, 0x3e, 0x75, 0x01, 0xf6, 0xbd,
+  0x8a, 0xe9, 0x35, 0xbe, 0xc8, 0x11, 0x28, 0xbe, 0xbd, 0x49, 0xb7, 0xbe,
+  0x9a, 0xe1, 0x59, 0xbb, 0x18, 0xc1, 0x7b, 0xbe, 0xe1, 0xd6, 0x36, 0xbe,
+  0xd7, 0x8b, 0x1d, 0x3d, 0xd3, 0x66, 0x1d, 0xbe, 0x07, 0x70, 0x24, 0xbe,
+  0x10, 0x40, 0x1a, 0xbd, 0xc4, 0xb3, 0x02, 0xbd, 0x3b, 0x20, 0x6f, 0x3d,
+  0xf0, 0x6f, 0xca, 0x3c, 0x58, 0x58, 0x05, 0xbe, 0xb1, 0x87, 0x12, 0xbc,
+  0x80, 0x06, 0x29, 0xbd, 0x2f, 0x96, 0xb2, 0xbd, 0x21, 0xda, 0xb5, 0xbd,
+  0xf9, 0xb5, 0x08, 0xbd, 0xb2, 0xd1, 0xaf, 0x3c, 0x6a, 0x9d, 0x29, 0xbd,
+  0x20, 0x4f, 0xe1, 0xbd, 0x84, 0xdf, 0xe5, 0xbb, 0xdf, 0xd4, 0xaa, 0x3c,
+  0x69, 0x3c, 0x23, 0xbe, 0x7f, 0x19, 0x37, 0xbe, 0xbb, 0x45, 0xa9, 0xbb,
+  0xd1, 0xe3, 0x63, 0x3d, 0x95, 0x18, 0xf8, 0xbd, 0xd3, 0x55, 0x36, 0xbe,
+  0x65, 0x6f, 0x63, 0x3e, 0xef, 0xe0, 0xf3, 0xbb, 0x88, 0x0d, 0x2e, 0xbe,
+  0x85, 0x39, 0x70, 0xbd, 0xa7, 0xaf, 0x72, 0x3c, 0x63, 0x22, 0xbd, 0x3e,
+  0xc4, 0x04, 0xbd, 0xbd, 0xa1, 0xbf, 0x11, 0xbd, 0xba, 0xfb, 0x26, 0xbc,
+  0x93, 0x58, 0x46, 0xbd, 0xc2, 0xc0, 0xf4, 0xbd, 0xd5, 0x4a, 0x57, 0xbe,
+  0xd6, 0xbb, 0x2e, 0xbd, 0xa9, 0x97, 0xae, 0x3e, 0x3b, 0x42, 0x3a, 0xbe,
+  0xc5, 0xbc, 0x89, 0xbd, 0x31, 0x83, 0x82, 0xbd, 0x73, 0x7f, 0x29, 0x3d,
+  0xbc, 0x63, 0xc6, 0xbc, 0xc8, 0x6e, 0xf3, 0xbd, 0xda, 0x96, 0x59, 0x3c,
+  0x63, 0x20, 0x5c, 0x3e, 0xd1, 0x66, 0x81, 0xbc, 0x70, 0x5c, 0xaa, 0xbd,
+  0x2a, 0x2c, 0xdc, 0x3b, 0x1e, 0xa0, 0x90, 0x3b, 0x40, 0x10, 0xb6, 0x3c,
+  0xbc, 0x07, 0xef, 0xbd, 0x3f, 0xe9, 0x1a, 0x3d, 0x15, 0xc1, 0x36, 0x3e,
+  0x67, 0x60, 0xfa, 0xbc, 0x48, 0x0f, 0xcb, 0xba, 0xd2, 0x81, 0x8a, 0xbb,
+  0xf2, 0xb9, 0x8e, 0xbd, 0x37, 0xf7, 0xac, 0x3b, 0xd4, 0xe4, 0x0e, 0xbe,
+  0xa8, 0x36, 0x94, 0x3b, 0x76, 0x15, 0x42, 0x3e, 0x15, 0xd1, 0xcc, 0xbc,
+  0x0c, 0xfa, 0x9a, 0xbd, 0xe4, 0xa6, 0x97, 0xbc, 0x81, 0x7e, 0x3c, 0x3d,
+  0xda, 0x55, 0x89, 0xbd, 0x1b, 0x3b, 0xf5, 0xbd, 0x8a, 0xf1, 0x2c, 0xbe,
+  0xe2, 0x47, 0xcd, 0x3d, 0x3b, 0x04, 0xf3, 0xbd, 0x74, 0x68, 0xf2, 0xbd,
+  0x82, 0xc2, 0xb8, 0xbc, 0x35, 0x1a, 0x02, 0x3c, 0xca, 0xc7, 0xf2, 0xbc,
+  0xd4, 0x40, 0xe8, 0xbb, 0xa9, 0x9b, 0x3c, 0xbe, 0x50, 0x57, 0xe8, 0xbd,
+  0x3c, 0xe5, 0xde, 0xbd, 0x56, 0x54, 0xde, 0xbc, 0xfa, 0x94, 0x09, 0xbe,
+  0x82, 0x0e, 0x6f, 0x3d, 0xb3, 0x38, 0x1e, 0xbd, 0x71, 0x57, 0xf2, 0x3b,
+  0xd3, 0x35, 0x0d, 0xbe, 0x8a, 0x85, 0x49, 0xbe, 0x46, 0x6a, 0xc7, 0xbd,
+  0xaf, 0x02, 0x30, 0x3d, 0xdd, 0x96, 0x12, 0xbe, 0x7a, 0xe7, 0xa5, 0x3c,
+  0xfd, 0x08, 0x1d, 0xbd, 0x84, 0x6b, 0xb6, 0xbd, 0x5a, 0xae, 0x57, 0xbe,
+  0x52, 0x1d, 0x00, 0xbe, 0xf1, 0x44, 0xad, 0xbd, 0xb2, 0xf7, 0x39, 0x3d,
+  0x23, 0xd7, 0xf6, 0xbb, 0x28, 0xd3, 0x00, 0xbc, 0x44, 0x67, 0x94, 0xbc,
+  0x72, 0x0a, 0x6e, 0xbd, 0x51, 0x72, 0x64, 0xbe, 0xf4, 0x4d, 0x3e, 0xbe,
+  0xfb, 0x3c, 0xda, 0xbd, 0xe5, 0x98, 0x00, 0xbc, 0xba, 0xc1, 0x7c, 0x3d,
+  0xd2, 0x6e, 0x5c, 0xbd, 0xaa, 0x00, 0xe3, 0x3c, 0x5d, 0xb6, 0x4b, 0xbd,
+  0xee, 0x8f, 0xbb, 0xbd, 0x9d, 0x8d, 0x01, 0xbd, 0x29, 0xc4, 0x4d, 0xbd,
+  0x00, 0x9c, 0xe5, 0xbd, 0xc8, 0xde, 0xd1, 0xbc, 0x2f, 0x80, 0x93, 0xbd,
+  0x0e, 0x61, 0xcf, 0xbd, 0xfd, 0x23, 0xae, 0xbd, 0xf1, 0x08, 0xb6, 0xbd,
+  0x90, 0xac, 0xf7, 0x3c, 0x09, 0xe5, 0x7b, 0xbd, 0x34, 0xe3, 0x81, 0xbc,
+  0xfc, 0x87, 0x2a, 0x3e, 0xe2, 0x27, 0xbf, 0x39, 0x25, 0xf2, 0x06, 0xbd,
+  0x29, 0x99, 0xae, 0xbd, 0x25, 0xe5, 0x39, 0x3d, 0x97, 0x9e, 0x08, 0x3d,
+  0xee, 0xa8, 0x56, 0xbd, 0xf4, 0xe9, 0x5b, 0xbc, 0x62, 0x1f, 0xa4, 0x3e,
+  0xd2, 0xcc, 0x95, 0x3c, 0xfe, 0x2e, 0x48, 0xbd, 0xb7, 0xe9, 0x77, 0xbd,
+  0xc4, 0x92, 0x7a, 0x3c, 0xb5, 0x1b, 0x4d, 0x3e, 0x47, 0x12, 0xc0, 0xbd,
+  0x45, 0x12, 0x21, 0x3d, 0x6e, 0x86, 0x89, 0x3e, 0x6e, 0x56, 0x47, 0x3d,
+  0x1c, 0x4b, 0x18, 0xbe, 0x5c, 0xd8, 0xf7, 0xbd, 0xf3, 0x13, 0xe4, 0xbd,
+  0xc9, 0x22, 0xf3, 0x3e, 0xf7, 0xec, 0x0b, 0xbe, 0x97, 0xc6, 0x03, 0xbe,
+  0xba, 0x29, 0x9a, 0x3e, 0xed, 0x94, 0x85, 0xbd, 0xbc, 0x06, 0x01, 0xbe,
+  0xe2, 0x8a, 0x02, 0xbe, 0xa8, 0x93, 0x56, 0xbd, 0xa6, 0xae, 0xe2, 0x3e,
+  0xc8, 0x0e, 0x37, 0xbe, 0xe4, 0x8f, 0xad, 0xbd, 0xe8, 0x0c, 0x18, 0x3e,
+  0xe6, 0x0e, 0x87, 0xbd, 0x9c, 0xb4, 0xfa, 0xbd, 0xc0, 0xcd, 0xfa, 0xbd,
+  0x4f, 0x29, 0x25, 0xbd, 0x15, 0xb2, 0x7a, 0x3e, 0x65, 0x01, 0x0d, 0xbe,
+  0x84, 0x74, 0x94, 0xbd, 0x39, 0xea, 0xda, 0x3d, 0x87, 0x69, 0xa8, 0xbc,
+  0x85, 0xc4, 0x9e, 0xbc, 0xa5, 0xdc, 0xde, 0xbd, 0x36, 0x03, 0x17, 0xbe,
+  0xc4, 0xde, 0x18, 0x3e, 0x0f, 0xf0, 0x8e, 0xbd, 0x80, 0x75, 0x9e, 0xbd,
+  0xfd, 0x47, 0xa6, 0xbc, 0x44, 0x83, 0x15, 0xbd, 0xf3, 0x45, 0x04, 0x3d,
+  0x39, 0xa8, 0xbf, 0xbd, 0x6f, 0xda, 0xdd, 0xbd, 0x8c, 0xed, 0xef, 0xbc,
+  0x5c, 0xb4, 0x8b, 0xbd, 0xdb, 0xd9, 0x3e, 0xbd, 0x18, 0x15, 0x29, 0xbe,
+  0xeb, 0x0a, 0x79, 0xbc, 0x41, 0x60, 0x03, 0xbd, 0x41, 0xa9, 0x40, 0xbd,
+  0x76, 0xb6, 0xe0, 0xbd, 0x1b, 0x95, 0x59, 0xbd, 0x60, 0xbf, 0x09, 0xbd,
+  0x5d, 0x47, 0x9c, 0xbc, 0xe2, 0xa4, 0x7e, 0xbe, 0x45, 0x4b, 0x38, 0x3d,
+  0xf8, 0x63, 0x89, 0x3c, 0x83, 0xb5, 0x25, 0x3d, 0x07, 0x30, 0x20, 0xbd,
+  0x37, 0xf3, 0x4c, 0xbe, 0xd7, 0x08, 0x21, 0xbd, 0x53, 0x2d, 0x88, 0x3c,
+  0x6f, 0x1a, 0x4a, 0xbe, 0x18, 0x3e, 0x40, 0x3d, 0xd8, 0x36, 0xd5, 0x3d,
+  0xef, 0xfa, 0x09, 0x3d, 0xbc, 0xd1, 0x24, 0x3d, 0xa9, 0xcd, 0xef, 0xbd,
+  0x17, 0x5c, 0x14, 0x3d, 0x89, 0x6f, 0xde, 0xb9, 0xd0, 0x93, 0xdd, 0xbd,
+  0xe0, 0x05, 0xf5, 0x3d, 0x0e, 0x33, 0x21, 0xbc, 0xd6, 0x2d, 0x94, 0x3d,
+  0x0b, 0xba, 0x4d, 0xbd, 0xfb, 0xb7, 0x13, 0xbe, 0xc8, 0x7b, 0xfe, 0x3d,
+  0x38, 0x21, 0x11, 0x3d, 0x61, 0xa4, 0xe1, 0x3b, 0x5d, 0x3f, 0x91, 0x3d,
+  0x90, 0x08, 0x3a, 0x3d, 0xea, 0xab, 0x2d, 0xbd, 0x5a, 0xd4, 0x90, 0x3d,
+  0x0b, 0x06, 0x7d, 0xbd, 0xc5, 0xe2, 0x28, 0x3c, 0x70, 0x9a, 0x51, 0x3d,
+  0xda, 0xc9, 0x5d, 0xbd, 0xe6, 0x7c, 0xbd, 0x39, 0xd5, 0x13, 0x01, 0xbe,
+  0x1f, 0xb1, 0x04, 0xbd, 0x38, 0x35, 0x1a, 0xbc, 0xff, 0xbc, 0xfa, 0xbb,
+  0x0d, 0xbe, 0x72, 0xbd, 0x29, 0x36, 0xf8, 0xbb, 0x66, 0xf3, 0x06, 0x3e,
+  0x25, 0xca, 0x2f, 0x3d, 0x79, 0x78, 0x85, 0x3d, 0xf6, 0xe8, 0x80, 0x3d,
+  0x1d, 0x44, 0x87, 0x3d, 0xea, 0xcf, 0x53, 0x3d, 0x32, 0x49, 0x9c, 0x3b,
+  0xa3, 0x13, 0xbd, 0xbc, 0xaf, 0xc5, 0x2f, 0x3e, 0x83, 0xf0, 0x75, 0x3d,
+  0xe1, 0x51, 0x38, 0xbd, 0x5a, 0x33, 0x8b, 0xbd, 0x93, 0x4b, 0x2b, 0x3e,
+  0x16, 0xef, 0x92, 0x3e, 0x6b, 0x34, 0x5d, 0x3d, 0x33, 0xdd, 0xc2, 0x3c,
+  0xef, 0x65, 0x0e, 0x3e, 0xf4, 0x44, 0xc0, 0x3d, 0xdc, 0xc0, 0x0d, 0xbc,
+  0x03, 0x5d, 0xd8, 0xbd, 0xd5, 0x08, 0xac, 0x3c, 0xfa, 0x37, 0x6e, 0x3e,
+  0xd4, 0x53, 0x37, 0xbd, 0x70, 0xfa, 0x0a, 0x3d, 0xc9, 0x56, 0xc8, 0x3d,
+  0xe0, 0xfc, 0x28, 0xbc, 0x0b, 0xac, 0x83, 0x3b, 0xe7, 0x78, 0x94, 0xbd,
+  0x9c, 0x1c, 0x15, 0xbd, 0x06, 0x11, 0x2a, 0x3e, 0x81, 0x93, 0xed, 0xbd,
+  0x2e, 0xcb, 0x17, 0xbb, 0xae, 0x89, 0x3d, 0x3e, 0xda, 0x4b, 0x81, 0x3c,
+  0x7c, 0xcb, 0xba, 0x3c, 0xc8, 0x38, 0x97, 0xbd, 0x03, 0x0a, 0x99, 0xbd,
+  0x3e, 0x7b, 0xf9, 0x3c, 0xa0, 0xb4, 0x2a, 0xbc, 0x70, 0x34, 0x87, 0x3c,
+  0xf8, 0x67, 0x8c, 0x3d, 0xff, 0x0b, 0x9f, 0x3d, 0x50, 0x7b, 0x8a, 0xbd,
+  0xa7, 0xa1, 0x51, 0xbd, 0x92, 0xc7, 0xd7, 0xbd, 0x98, 0xad, 0xe2, 0xbc,
+  0x4a, 0x21, 0x93, 0xbd, 0x0d, 0x62, 0xc7, 0xbd, 0xc7, 0xc6, 0xfb, 0xbb,
+  0xca, 0xa2, 0x4d, 0xbd, 0xbf, 0xf4, 0xd9, 0x3a, 0x9e, 0x43, 0x74, 0xbc,
+  0xe8, 0x6e, 0xb0, 0xbd, 0xa8, 0xdb, 0x2f, 0xbc, 0x2c, 0x73, 0x00, 0x3d,
+  0xa5, 0x2a, 0x5c, 0xbd, 0xf6, 0xb4, 0xb0, 0xbc, 0xbf, 0x13, 0x6f, 0x3d,
+  0x78, 0x81, 0x03, 0x3d, 0x8a, 0xae, 0xd5, 0x3c, 0xea, 0x2b, 0xb9, 0xbc,
+  0x2a, 0x7f, 0x89, 0xbd, 0x1b, 0x5f, 0xbf, 0xbc, 0xe3, 0x75, 0x13, 0x3d,
+  0x36, 0x7e, 0xb5, 0xbd, 0x94, 0xa0, 0x9d, 0x3d, 0xb5, 0x43, 0xb8, 0x3d,
+  0x24, 0x79, 0x26, 0x3d, 0x67, 0x12, 0x60, 0xbc, 0x11, 0x23, 0x80, 0xbd,
+  0x01, 0x6b, 0x19, 0xbd, 0x10, 0x07, 0xbd, 0x3d, 0x30, 0x7d, 0x2e, 0xbe,
+  0x08, 0xd6, 0x3d, 0x3d, 0x9b, 0x4c, 0x77, 0x3d, 0x4d, 0x05, 0x9b, 0x3d,
+  0x23, 0xf0, 0xb1, 0x3d, 0x3e, 0xc6, 0x04, 0xbe, 0xd4, 0x5b, 0x93, 0x3d,
+  0x60, 0x22, 0x62, 0x3d, 0x37, 0xb2, 0x20, 0xbe, 0x52, 0x00, 0xe0, 0x3d,
+  0x7b, 0x5f, 0x31, 0x3d, 0x97, 0x7f, 0x00, 0x3e, 0x27, 0x59, 0x36, 0xbb,
+  0x64, 0x04, 0xd3, 0xbd, 0xcb, 0xa7, 0xe7, 0x3d, 0xd5, 0xfe, 0x00, 0x3e,
+  0x48, 0xef, 0xb0, 0xbd, 0xf6, 0xa0, 0x73, 0x3d, 0xc0, 0x72, 0x7e, 0x3d,
+  0xcf, 0x80, 0x48, 0x3d, 0x99, 0xa1, 0x8f, 0x3d, 0x82, 0x9d, 0x15, 0xbd,
+  0xcb, 0x17, 0x03, 0xbc, 0xd6, 0xb1, 0x4f, 0x3d, 0x2e, 0x6e, 0x88, 0xbd,
+  0x70, 0x04, 0xba, 0x3c, 0xc6, 0x9f, 0x0a, 0xbd, 0x58, 0x0b, 0x3f, 0xbd,
+  0x84, 0x29, 0x82, 0xbd, 0x36, 0x0e, 0x33, 0x3d, 0x1c, 0x1d, 0x8d, 0xbd,
+  0x4d, 0xcb, 0x08, 0xbe, 0x68, 0xbd, 0xef, 0xb8, 0x32, 0xed, 0xdb, 0xbc,
+  0x43, 0xee, 0x0a, 0x3d, 0xf5, 0xe4, 0x73, 0x3c, 0xa0, 0xb3, 0x38, 0xbd,
+  0x39, 0xc0, 0xf5, 0x3c, 0x7e, 0x05, 0xdf, 0x3c, 0x1f, 0xb4, 0x34, 0xbc,
+  0x03, 0x2d, 0x31, 0x3e, 0x79, 0x3e, 0xc7, 0xbd, 0x00, 0xbd, 0xfd, 0x3c,
+  0x4b, 0x29, 0x3b, 0xbc, 0x2a, 0xe5, 0x98, 0x3d, 0x10, 0x38, 0x62, 0x3d,
+  0x07, 0x8c, 0xee, 0x3c, 0x2f, 0xad, 0x9b, 0xbd, 0xfa, 0x8a, 0x07, 0x3e,
+  0x7f, 0xa4, 0x0b, 0xbc, 0x6b, 0x53, 0x56, 0x3d, 0xc3, 0x3b, 0x51, 0x3d,
+  0x95, 0xfb, 0x7f, 0x3d, 0xd2, 0x81, 0x18, 0x3e, 0x0c, 0x4a, 0x4a, 0x3d,
+  0xca, 0x0e, 0xa4, 0x3c, 0xa9, 0x96, 0x86, 0x3d, 0x7a, 0x94, 0x3c, 0xbb,
+  0xfd, 0xdc, 0x06, 0x3d, 0x2e, 0x0d, 0x07, 0xbd, 0x2b, 0x55, 0x93, 0x3c,
+  0x78, 0x94, 0xa3, 0x3d, 0xd3, 0x5f, 0x86, 0xbc, 0x74, 0x51, 0x84, 0x3d,
+  0xdd, 0xb7, 0x8b, 0x3d, 0x68, 0xdf, 0xdf, 0x3d, 0xa4, 0xce, 0xcb, 0x3c,
+  0x67, 0xca, 0x3d, 0x3b, 0xaf, 0x4e, 0x56, 0x3d, 0x12, 0xf3, 0x35, 0x3d,
+  0xa1, 0xfa, 0x32, 0xbd, 0x18, 0xad, 0x7e, 0x3c, 0x0d, 0x0d, 0xd4, 0x3c,
+  0xff, 0xf5, 0x80, 0x3c, 0x18, 0x67, 0xb4, 0x3d, 0x57, 0xca, 0x08, 0xbd,
+  0x93, 0x67, 0x15, 0xbc, 0x13, 0x54, 0xb7, 0xbc, 0x65, 0xd3, 0x46, 0x3c,
+  0x95, 0x60, 0x44, 0x3d, 0xa1, 0xb5, 0xaf, 0xbc, 0xed, 0xa0, 0x8a, 0x3d,
+  0x30, 0xb1, 0x3e, 0x3d, 0x73, 0xb4, 0x88, 0x3d, 0x28, 0xfc, 0x89, 0x3d,
+  0x74, 0x30, 0x8e, 0xbc, 0x17, 0xd8, 0x14, 0xbd, 0x4a, 0xae, 0xa8, 0x3d,
+  0x19, 0xcf, 0x97, 0xbd, 0xff, 0x02, 0x3f, 0xbd, 0xc2, 0x31, 0xe6, 0x3c,
+  0x6f, 0x24, 0xbe, 0x3d, 0xde, 0x55, 0x8d, 0x3b, 0x70, 0x83, 0x9f, 0xbd,
+  0x1e, 0xbc, 0xd5, 0x3d, 0x3e, 0x68, 0x6e, 0x3d, 0x83, 0x43, 0x55, 0xbd,
+  0x4f, 0x15, 0x72, 0x3d, 0xe1, 0xcb, 0xfd, 0xbc, 0x16, 0x77, 0x51, 0x3d,
+  0x57, 0x29, 0x07, 0x3b, 0xf7, 0x6a, 0x0e, 0xbd, 0xed, 0xa9, 0x24, 0x3d,
+  0xdd, 0xb8, 0x90, 0xbc, 0xad, 0x31, 0xd5, 0xbd, 0xaf, 0x22, 0xa5, 0x3d,
+  0x31, 0x9d, 0xa6, 0x3d, 0x38, 0x5a, 0x7d, 0x3d, 0xb0, 0x40, 0x4d, 0x3d,
+  0x5f, 0x78, 0xa8, 0xbc, 0xd5, 0xfd, 0x13, 0x3e, 0xaf, 0x5e, 0x0a, 0x3e,
+  0xff, 0x23, 0xc5, 0xbd, 0xa1, 0x4e, 0x7f, 0x3d, 0x08, 0xe5, 0xe4, 0x3d,
+  0x55, 0x3e, 0xbf, 0x3d, 0xe7, 0x0e, 0xea, 0x3d, 0x7f, 0x7b, 0xad, 0xbc,
+  0x31, 0x48, 0x57, 0x3d, 0xd2, 0xe1, 0xaf, 0x3d, 0xf1, 0xba, 0x34, 0xbd,
+  0xdb, 0xb2, 0x1f, 0x3b, 0x0b, 0xf8, 0xc4, 0x3b, 0x1e, 0xaa, 0xa4, 0x3b,
+  0xcd, 0x0a, 0x0f, 0xbd, 0x3f, 0x42, 0xfb, 0xbb, 0x2e, 0x0c, 0x97, 0x3d,
+  0x48, 0x82, 0xaa, 0x3d, 0x18, 0x63, 0x0a, 0xbd, 0x48, 0x5d, 0x40, 0x3d,
+  0x8a, 0x58, 0x0c, 0xbd, 0xe9, 0xc3, 0x0c, 0x3c, 0xba, 0x0f, 0xc2, 0xbd,
+  0x0d, 0x1c, 0x26, 0xbd, 0x7e, 0x14, 0xce, 0xbd, 0x19, 0xa2, 0x0a, 0xbd,
+  0x26, 0x05, 0x0b, 0x3b, 0x5f, 0xdd, 0xad, 0xbd, 0x49, 0x25, 0x6d, 0xbc,
+  0xd6, 0x1b, 0x12, 0xbd, 0x15, 0x7a, 0x25, 0xbd, 0x3b, 0x07, 0x97, 0x3b,
+  0xa6, 0x3e, 0x5c, 0xbc, 0x25, 0x4a, 0xf6, 0x3c, 0xac, 0xfa, 0x43, 0x3b,
+  0x54, 0xcd, 0xa3, 0xbd, 0xba, 0x9a, 0x3b, 0xbd, 0x4d, 0x69, 0xb7, 0xbd,
+  0x52, 0x80, 0x85, 0xbd, 0x19, 0x0d, 0x44, 0xbd, 0x1b, 0xad, 0xa2, 0xbd,
+  0x59, 0xc5, 0xd6, 0xbd, 0x04, 0x4d, 0xf9, 0x3d, 0x4d, 0x15, 0x24, 0xbd,
+  0x3e, 0xe0, 0xb1, 0xbc, 0x5e, 0x66, 0xae, 0x3d, 0x40, 0xd9, 0xbd, 0xbc,
+  0x6a, 0xcc, 0x6e, 0x3d, 0x14, 0x10, 0x51, 0x3b, 0x98, 0x69, 0x3a, 0xbd,
+  0x69, 0xbe, 0xaf, 0x3d, 0xe5, 0x83, 0x5b, 0x3c, 0xf2, 0x70, 0xe0, 0x3b,
+  0x03, 0x36, 0x17, 0x3d, 0x04, 0x9b, 0x53, 0x3d, 0x1b, 0x1d, 0x40, 0xbd,
+  0xba, 0x66, 0x89, 0x3d, 0x53, 0xff, 0x38, 0x3d, 0x70, 0x42, 0xa3, 0x3d,
+  0xf8, 0x07, 0xf5, 0xba, 0x8b, 0x0d, 0x60, 0xbc, 0xfa, 0x60, 0xfb, 0xbc,
+  0x24, 0x65, 0x36, 0x3d, 0x64, 0x36, 0xe9, 0x3c, 0x30, 0xc9, 0x84, 0x3d,
+  0x16, 0xad, 0x9e, 0x3d, 0xbb, 0xb0, 0xf7, 0x3d, 0xf8, 0x98, 0x70, 0x3d,
+  0x98, 0x49, 0xc9, 0x3b, 0x22, 0x7f, 0x1c, 0xbd, 0x48, 0x16, 0x99, 0x3d,
+  0x9d, 0xc5, 0x1e, 0xbd, 0x4a, 0x3d, 0x45, 0x3c, 0x4e, 0xa8, 0x0f, 0x3c,
+  0x31, 0xf5, 0x92, 0x3d, 0x7b, 0x3c, 0xee, 0x3c, 0x23, 0xd2, 0x21, 0x3d,
+  0xf6, 0x2f, 0xa3, 0xbc, 0x8f, 0x45, 0x93, 0x3c, 0x64, 0x8d, 0x88, 0xbd,
+  0x75, 0x99, 0x14, 0x3d, 0xc9, 0xb2, 0xab, 0xbc, 0xc8, 0xd2, 0x02, 0x3d,
+  0xd1, 0x2e, 0xb5, 0x3c, 0x14, 0x1e, 0xe3, 0x3c, 0xa1, 0x7e, 0x61, 0xbd,
+  0xb2, 0x2c, 0xa0, 0x3c, 0x8e, 0x56, 0x40, 0xbd, 0xa5, 0x42, 0xba, 0xbc,
+  0x64, 0x1f, 0x42, 0x3c, 0x6d, 0x99, 0x33, 0xbc, 0xcf, 0xea, 0xa2, 0xbd,
+  0xe4, 0x2f, 0x8e, 0xbc, 0x4f, 0x46, 0x2f, 0x3d, 0x52, 0x55, 0x3d, 0x3d,
+  0x2d, 0x54, 0xa3, 0xbb, 0x7a, 0x0a, 0x4c, 0xbd, 0xd0, 0xbe, 0xbe, 0xbc,
+  0x92, 0xe0, 0x94, 0x3d, 0x0b, 0xcd, 0x17, 0xbd, 0xc8, 0x8e, 0x2c, 0x3c,
+  0xe3, 0xaf, 0xbb, 0x3d, 0x9d, 0xed, 0x40, 0xbd, 0x1f, 0x69, 0xd4, 0x3c,
+  0x78, 0x06, 0x3d, 0x3d, 0x97, 0x7d, 0xc6, 0xbb, 0xfa, 0xb4, 0x47, 0xbd,
+  0x28, 0xf8, 0x8c, 0xbc, 0x10, 0x14, 0xff, 0x3d, 0xe6, 0x54, 0x52, 0x3d,
+  0x34, 0x4e, 0x46, 0xbd, 0x2a, 0x07, 0xa2, 0x3c, 0x5c, 0x40, 0x81, 0x3c,
+  0xab, 0x02, 0x7d, 0x3c, 0x49, 0x14, 0x47, 0xbd, 0x94, 0xd1, 0x3b, 0xbd,
+  0xbd, 0x20, 0xb2, 0x3b, 0x1f, 0xb5, 0x67, 0x3c, 0x94, 0x39, 0xce, 0xbc,
+  0x89, 0xa2, 0x52, 0xbd, 0x3e, 0xb7, 0xe8, 0x3c, 0xf9, 0x54, 0x28, 0x3d,
+  0x45, 0xe3, 0xdd, 0xbc, 0x5a, 0x1f, 0x13, 0xbc, 0x67, 0xdd, 0x0d, 0x3d,
+  0xd5, 0x5c, 0x26, 0xbc, 0xb2, 0xe8, 0xc5, 0xbc, 0x2f, 0xdf, 0x19, 0xbd,
+  0xdf, 0xe1, 0x45, 0x3d, 0x3d, 0x33, 0x7b, 0xbc, 0x02, 0x67, 0x1b, 0x3d,
+  0x0c, 0x2c, 0x3f, 0xbd, 0x21, 0x31, 0xd4, 0xbc, 0x9b, 0x8c, 0x64, 0xbd,
+  0xef, 0x1a, 0xbd, 0xbd, 0xb1, 0xe1, 0xf4, 0x3b, 0x23, 0x78, 0x33, 0xbd,
+  0xc2, 0x29, 0x55, 0xbd, 0xc5, 0x51, 0x99, 0x3c, 0x38, 0x36, 0xc0, 0xbd,
+  0xe3, 0x04, 0xca, 0xbd, 0x2b, 0x8d, 0x4b, 0xbd, 0x87, 0xa7, 0x0d, 0xbd,
+  0xfd, 0x3f, 0x49, 0x3d, 0xfa, 0x67, 0x2d, 0xbd, 0x19, 0x02, 0x75, 0xbd,
+  0x31, 0x63, 0x39, 0xbc, 0xdb, 0x8f, 0x38, 0xbe, 0x87, 0x3a, 0x4a, 0x3c,
+  0x6f, 0x15, 0x70, 0xbd, 0x29, 0x54, 0x27, 0xbd, 0xb2, 0x00, 0x6e, 0x3d,
+  0xdb, 0xbc, 0xc6, 0xbb, 0xd3, 0xa0, 0xa0, 0xbb, 0xb8, 0x69, 0x20, 0x3c,
+  0x05, 0x94, 0x79, 0xbd, 0x48, 0x40, 0x67, 0x3c, 0xc1, 0xe8, 0x53, 0x3d,
+  0x1a, 0x87, 0x05, 0x3c, 0xf7, 0xda, 0x61, 0xbc, 0xb0, 0x0f, 0x1a, 0x3d,
+  0x79, 0xef, 0x70, 0x3d, 0x1d, 0xc6, 0xab, 0x3d, 0x07, 0x7f, 0xa4, 0x3d,
+  0xc7, 0x5c, 0x80, 0x3d, 0xba, 0x6c, 0x61, 0x3d, 0x9d, 0x89, 0xd6, 0x3b,
+  0x97, 0x81, 0x8b, 0x3d, 0x8f, 0x6a, 0xf8, 0x3c, 0xa0, 0xfb, 0x96, 0x3d,
+  0x6b, 0xcd, 0x65, 0x3c, 0x35, 0xd6, 0x35, 0x3d, 0x9a, 0x11, 0x90, 0x3d,
+  0x14, 0x9e, 0x7f, 0x3c, 0x10, 0xf2, 0xf8, 0xbb, 0x5f, 0x31, 0x64, 0x3d,
+  0xc3, 0x35, 0x95, 0x3c, 0xc5, 0xa4, 0x2d, 0x3b, 0x7d, 0xc5, 0x9d, 0x3d,
+  0xe6, 0xd8, 0x46, 0xbd, 0x31, 0x65, 0xb4, 0x3d, 0x2e, 0xbd, 0x75, 0x3b,
+  0x52, 0x64, 0x0c, 0x3d, 0xeb, 0xd3, 0x14, 0xbc, 0x5d, 0xa1, 0x36, 0x3c,
+  0xee, 0x9a, 0xc7, 0x3d, 0xc3, 0xba, 0xe7, 0xbc, 0xc5, 0xb5, 0xd8, 0x3c,
+  0x29, 0xae, 0xfb, 0xbb, 0xf7, 0x79, 0x8f, 0xbc, 0x83, 0xa5, 0xdc, 0xbc,
+  0x12, 0xc7, 0x34, 0x3c, 0x17, 0x30, 0x97, 0x3c, 0x88, 0x2b, 0x60, 0x3d,
+  0x6d, 0xa3, 0xd5, 0x3c, 0x51, 0x0a, 0xd2, 0x3b, 0x5b, 0xdb, 0x82, 0x3b,
+  0x32, 0xa3, 0xe0, 0xbb, 0x47, 0x18, 0x49, 0xbd, 0x96, 0x5c, 0x46, 0x3c,
+  0x97, 0xef, 0x5e, 0xba, 0x6f, 0x8f, 0xe2, 0x3b, 0xdf, 0xc9, 0x26, 0xbc,
+  0xa2, 0xf8, 0xa1, 0x3a, 0x6c, 0xe6, 0x28, 0x3d, 0x07, 0xfd, 0xa8, 0x3d,
+  0x0b, 0xa0, 0x29, 0x3d, 0xa4, 0x82, 0x6b, 0x3d, 0x1b, 0x7b, 0x8b, 0x3d,
+  0x5f, 0xc5, 0x72, 0x3d, 0xa7, 0x50, 0xe2, 0xbc, 0x44, 0x89, 0x20, 0x3e,
+  0xb7, 0xa4, 0x0d, 0x3d, 0xa9, 0xf8, 0x91, 0x3d, 0x9e, 0x84, 0xb0, 0x3d,
+  0x93, 0xb8, 0x17, 0x3d, 0x5c, 0xeb, 0x81, 0x3d, 0xd5, 0x9a, 0x20, 0x3e,
+  0xd9, 0xcd, 0x07, 0xbd, 0x7d, 0xbe, 0x4a, 0x3d, 0x87, 0xf3, 0x48, 0x3d,
+  0x45, 0xb4, 0x2b, 0xbd, 0x67, 0x0e, 0xa1, 0x3a, 0x25, 0x7f, 0xda, 0x3c,
+  0x63, 0xdb, 0x12, 0x3d, 0x77, 0x87, 0xc6, 0x3d, 0xf5, 0x37, 0x94, 0xbb,
+  0x0f, 0x2d, 0x01, 0xbd, 0x57, 0x54, 0x34, 0x3d, 0xa5, 0x6b, 0x35, 0xbd,
+  0xa4, 0x2f, 0x80, 0x3d, 0x1c, 0xce, 0x75, 0x3c, 0x36, 0x9d, 0x96, 0xbd,
+  0xf1, 0xcc, 0x5e, 0xbd, 0xe5, 0x98, 0xc2, 0x3d, 0xd3, 0x8e, 0x77, 0x3d,
+  0x7a, 0xba, 0x15, 0xbd, 0xe2, 0x7d, 0x08, 0xbd, 0x1f, 0xa7, 0xa8, 0xbb,
+  0xfe, 0xe6, 0x6b, 0xbc, 0x40, 0xed, 0xd8, 0x3c, 0xf0, 0x67, 0x3a, 0x3d,
+  0xbc, 0x2c, 0x0b, 0x3e, 0xd3, 0x8b, 0xf0, 0x3d, 0x88, 0x91, 0xdb, 0x3d,
+  0xe4, 0xe8, 0x14, 0x3e, 0x5a, 0x55, 0x60, 0x3d, 0x82, 0x3e, 0xe3, 0x3c,
+  0xa1, 0xba, 0x3a, 0x3e, 0x0b, 0xbd, 0x15, 0x3e, 0xda, 0x2a, 0x12, 0x3e,
+  0xfa, 0x07, 0x1e, 0x3e, 0x54, 0x29, 0x25, 0x3e, 0x17, 0x78, 0x36, 0x3e,
+  0xcc, 0x55, 0x4c, 0x3d, 0x58, 0x25, 0x11, 0x3d, 0x1f, 0xa8, 0x39, 0x3e,
+  0x13, 0x1b, 0x26, 0x3e, 0x47, 0x24, 0x0e, 0x3e, 0x45, 0xd0, 0xa2, 0x3d,
+  0x98, 0x54, 0x47, 0x3e, 0x02, 0x62, 0xe4, 0x3d, 0x04, 0x1f, 0xb1, 0x3d,
+  0xf5, 0xa5, 0xd9, 0x3c, 0x92, 0x34, 0xbe, 0x3d, 0x46, 0xd2, 0x31, 0x3e,
+  0xbc, 0x80, 0xc9, 0x3c, 0x02, 0x0e, 0x85, 0x3d, 0xe5, 0x36, 0x1e, 0x3e,
+  0x75, 0x2e, 0x00, 0x3e, 0x5d, 0xd6, 0x2f, 0x3e, 0x35, 0xb1, 0x2b, 0x3c,
+  0x62, 0xa6, 0x45, 0x3e, 0x6e, 0xf8, 0x89, 0x3d, 0x41, 0x05, 0xb2, 0x3d,
+  0x55, 0x82, 0x23, 0x3c, 0x4c, 0x98, 0x08, 0x3e, 0x23, 0xaa, 0x16, 0x3e,
+  0x98, 0x81, 0xe7, 0x3d, 0xed, 0x3b, 0x67, 0x3d, 0xfd, 0xd3, 0x51, 0x3e,
+  0x38, 0x83, 0x07, 0x3e, 0xe4, 0x5e, 0x19, 0x3d, 0xc2, 0x83, 0x44, 0xbd,
+  0x60, 0x9a, 0xc3, 0x3d, 0x73, 0xda, 0x00, 0x3e, 0x45, 0x54, 0x20, 0x3e,
+  0xeb, 0xe7, 0xca, 0x3d, 0x1b, 0xc3, 0x95, 0x3d, 0x49, 0xad, 0x83, 0x3d,
+  0xaa, 0x91, 0x97, 0x3c, 0x73, 0x5f, 0x99, 0x3c, 0x4b, 0xe5, 0xf7, 0x3c,
+  0x01, 0x1f, 0xaf, 0x3d, 0xe7, 0xcf, 0x51, 0x3e, 0x92, 0x9b, 0xfe, 0x3d,
+  0x14, 0x26, 0x1b, 0x3e, 0xce, 0x08, 0x30, 0x3e, 0xfd, 0x8a, 0xc0, 0x3d,
+  0xf5, 0x78, 0xd1, 0x3d, 0xde, 0x3e, 0xf0, 0x3d, 0xa2, 0xf0, 0x1c, 0x3e,
+  0x30, 0x5a, 0xdc, 0x3d, 0xee, 0x33, 0x59, 0x3d, 0x84, 0xf7, 0x01, 0x3e,
+  0x04, 0x1f, 0x0d, 0x3e, 0x81, 0xb9, 0x2c, 0x3d, 0x35, 0x7c, 0x7a, 0x3e,
+  0x21, 0xdd, 0x1a, 0x3e, 0xe5, 0x9a, 0x2b, 0x3e, 0x4d, 0x69, 0xf4, 0x3d,
+  0x6b, 0x6c, 0xfd, 0x3c, 0x57, 0xe6, 0x19, 0x3e, 0x36, 0x36, 0x41, 0x3e,
+  0x5d, 0x16, 0x55, 0x3d, 0x12, 0x43, 0x3d, 0x3d, 0x9d, 0xbb, 0x03, 0x3e,
+  0xa4, 0xd0, 0x97, 0x3d, 0xce, 0xd3, 0x36, 0x3e, 0x7c, 0x71, 0xc0, 0x3d,
+  0x2a, 0x81, 0x09, 0x3e, 0x78, 0x04, 0x1a, 0x3d, 0x6f, 0x78, 0xe3, 0x3c,
+  0x29, 0x96, 0x8e, 0xbd, 0x76, 0x91, 0xcd, 0xbc, 0xc7, 0x0e, 0xc5, 0xbb,
+  0x2f, 0xc1, 0x43, 0xbd, 0x04, 0x7a, 0xce, 0xbb, 0xa2, 0xfa, 0x3c, 0xbc,
+  0x5f, 0x93, 0xc3, 0x3b, 0x45, 0xed, 0x43, 0x3d, 0x9b, 0x9f, 0xd1, 0xbd,
+  0xd4, 0xbb, 0x6d, 0x3c, 0xed, 0x13, 0xbf, 0xbc, 0xb7, 0xee, 0x2a, 0x3d,
+  0x02, 0x40, 0x66, 0x3d, 0x04, 0x03, 0x8c, 0xbd, 0xe2, 0xdf, 0x13, 0x3d,
+  0x1f, 0x93, 0x4e, 0x3d, 0x51, 0xbb, 0x01, 0x3a, 0x9f, 0x5f, 0xa6, 0x3c,
+  0xdb, 0xa8, 0x22, 0x3a, 0xa5, 0xcf, 0x15, 0x3d, 0x1a, 0x50, 0x95, 0x3d,
+  0x90, 0xdb, 0x5a, 0x3d, 0x21, 0x0b, 0x85, 0x3d, 0xcd, 0xb3, 0x86, 0xbd,
+  0x94, 0xcd, 0x58, 0xbd, 0x13, 0x76, 0xbc, 0x3d, 0x85, 0x3c, 0xbe, 0x3d,
+  0xb2, 0xcf, 0x72, 0x3d, 0x4c, 0xaf, 0x47, 0xbd, 0x0d, 0x1b, 0xdc, 0x3b,
+  0x99, 0xaf, 0x58, 0x3d, 0xc2, 0x9a, 0x71, 0xbd, 0xe0, 0x30, 0x53, 0x3d,
+  0x26, 0x78, 0xa4, 0x3d, 0xdc, 0x3d, 0x49, 0x3d, 0xeb, 0xa6, 0x22, 0xbd,
+  0x83, 0xf9, 0xce, 0xbc, 0xc9, 0xd9, 0x60, 0x3d, 0xf3, 0x01, 0xc0, 0x3d,
+  0xb4, 0xac, 0xa8, 0xbd, 0xd6, 0xc9, 0xbc, 0xbd, 0xc4, 0xd7, 0xcd, 0x3c,
+  0xfa, 0x60, 0xc6, 0x3d, 0x37, 0x86, 0x13, 0xbd, 0xfd, 0x80, 0xad, 0xbd,
+  0x0b, 0x98, 0xdc, 0x3d, 0x01, 0x37, 0x84, 0x3d, 0x7e, 0x1c, 0x0a, 0xbe,
+  0x62, 0xac, 0x02, 0xbe, 0x89, 0xc2, 0xbf, 0x3d, 0xb5, 0x7e, 0x6f, 0xbc,
+  0x3c, 0x34, 0x6d, 0x3d, 0xc0, 0x6f, 0xda, 0xbd, 0xe6, 0xe3, 0xa1, 0xbb,
+  0xc3, 0x7e, 0x0e, 0x3b, 0xc5, 0x5c, 0xcf, 0xbd, 0x2d, 0x3b, 0xd5, 0xbd,
+  0xa7, 0x99, 0x4f, 0x3d, 0x56, 0xec, 0xaa, 0x3d, 0xbe, 0xe6, 0x74, 0x3d,
+  0x8c, 0xbc, 0xe3, 0xbd, 0x8c, 0xdd, 0xb4, 0xbc, 0x87, 0x78, 0x27, 0xbd,
+  0xd3, 0x1b, 0x34, 0x3b, 0x53, 0x51, 0x41, 0xba, 0xcc, 0xff, 0xb8, 0xbb,
+  0x6d, 0xea, 0xc1, 0xbc, 0x9e, 0x2e, 0x89, 0x3d, 0x87, 0x62, 0x09, 0xbd,
+  0x76, 0x21, 0x82, 0x3c, 0x02, 0x31, 0xad, 0x3c, 0x8b, 0x3a, 0xa9, 0x3d,
+  0x13, 0x01, 0x2c, 0x3d, 0x16, 0x2a, 0xa5, 0x3d, 0x7d, 0xd1, 0xa8, 0x3d,
+  0x50, 0xf9, 0xa9, 0x3d, 0x02, 0x57, 0xf4, 0xbd, 0x2b, 0x85, 0x59, 0xbb,
+  0xd1, 0xb0, 0x2b, 0x3b, 0x16, 0x51, 0x47, 0x3d, 0x0b, 0x99, 0xaf, 0x3d,
+  0x2c, 0x41, 0x99, 0x3d, 0x26, 0xdb, 0x27, 0x3e, 0xb2, 0x55, 0xf7, 0x3d,
+  0x11, 0x3d, 0x52, 0xbc, 0x9b, 0xe4, 0xb5, 0x3d, 0x94, 0x9e, 0x9c, 0x3d,
+  0xc2, 0xdf, 0x80, 0x3d, 0x9a, 0x6b, 0xc5, 0x3d, 0x8d, 0x46, 0x02, 0x3e,
+  0xed, 0x96, 0xae, 0x3d, 0x19, 0x79, 0xdc, 0x3d, 0xb0, 0x12, 0x0d, 0x3d,
+  0x44, 0x04, 0xfc, 0x3d, 0xf6, 0xe8, 0x1d, 0x3e, 0x37, 0xce, 0x66, 0xba,
+  0xbc, 0x54, 0x01, 0x3e, 0x2b, 0xbe, 0x19, 0x3e, 0xce, 0xad, 0x15, 0x3e,
+  0xa8, 0xe7, 0x00, 0x3e, 0x1a, 0x2d, 0x7c, 0xbc, 0x46, 0x03, 0x0f, 0x3e,
+  0xf3, 0x0b, 0xc5, 0x3d, 0x07, 0x0e, 0x6a, 0x3d, 0x2b, 0x30, 0xcd, 0xbb,
+  0x31, 0xdc, 0x88, 0x3d, 0x8c, 0xb1, 0x64, 0xbb, 0x2e, 0xfe, 0x7f, 0x3d,
+  0x2e, 0xf1, 0x0a, 0xbd, 0xc3, 0x44, 0xbe, 0x3c, 0x0d, 0x51, 0xf5, 0xbc,
+  0xb5, 0x06, 0x69, 0x3d, 0x87, 0x9a, 0xd0, 0xbc, 0x6e, 0xea, 0xf6, 0xbd,
+  0x96, 0x45, 0x5d, 0xbd, 0x7f, 0x26, 0xd5, 0xbb, 0xe6, 0x09, 0x7d, 0x3d,
+  0x94, 0x42, 0xce, 0xbd, 0x5a, 0x19, 0xaa, 0xbc, 0xf1, 0x69, 0xce, 0x3c,
+  0x78, 0x81, 0xe6, 0x3c, 0x88, 0x5f, 0x10, 0xbd, 0xb3, 0xba, 0xb1, 0x3c,
+  0x23, 0x57, 0xad, 0xbd, 0xeb, 0x4e, 0x2b, 0x3d, 0xc0, 0x90, 0x0a, 0xbc,
+  0x08, 0x73, 0xbb, 0x3b, 0x7f, 0x65, 0xcf, 0xbd, 0xf3, 0x84, 0xe4, 0xbd,
+  0x88, 0x39, 0xc9, 0xbc, 0xf8, 0xe1, 0xf3, 0xbb, 0x8b, 0x62, 0x50, 0xbd,
+  0x60, 0x27, 0x7f, 0xbd, 0xd3, 0x5c, 0x11, 0x3d, 0x82, 0x1f, 0x20, 0x3d,
+  0xba, 0xac, 0x05, 0xbe, 0xcf, 0xa4, 0xd4, 0xbc, 0x01, 0xb0, 0x1b, 0xbd,
+  0x75, 0x2c, 0x49, 0x3d, 0x09, 0x59, 0x26, 0xbd, 0x24, 0xc2, 0x59, 0xbe,
+  0x61, 0x5c, 0xde, 0x3c, 0x13, 0xb3, 0x7d, 0xbd, 0xbd, 0x3e, 0x35, 0xbe,
+  0x45, 0x6e, 0x54, 0xbd, 0xc4, 0x6e, 0x81, 0xbd, 0x7b, 0xe0, 0xe3, 0xbc,
+  0x10, 0xf8, 0xd2, 0xbd, 0xa4, 0x69, 0x96, 0xbe, 0xba, 0xa8, 0x21, 0xbd,
+  0x74, 0x27, 0x3a, 0xbd, 0x0d, 0xa2, 0x2f, 0xbe, 0xff, 0x05, 0x0c, 0xbe,
+  0x85, 0x79, 0xd2, 0xbc, 0xf8, 0x0e, 0x90, 0xbc, 0x31, 0x1d, 0x0c, 0xbe,
+  0x7f, 0xd3, 0x88, 0xbe, 0x0d, 0xfb, 0xff, 0xbc, 0x5c, 0x98, 0x02, 0xbd,
+  0x83, 0x4a, 0xa0, 0xbc, 0x97, 0x5b, 0x27, 0xbe, 0x1f, 0x77, 0xb6, 0xbc,
+  0x52, 0x4c, 0x25, 0xbd, 0xf6, 0x52, 0x05, 0x3d, 0xcc, 0xcd, 0x45, 0xbe,
+  0x69, 0x97, 0x58, 0xbd, 0x1a, 0xe9, 0x60, 0x3c, 0x12, 0x96, 0xcb, 0xbc,
+  0x87, 0x11, 0x0f, 0xbe, 0xc0, 0x6f, 0x2c, 0x3c, 0xd3, 0xcb, 0x2f, 0xbd,
+  0x04, 0xba, 0x1e, 0x3d, 0xed, 0x26, 0x9a, 0xbd, 0xa8, 0x56, 0x0b, 0xbc,
+  0x3b, 0x57, 0x59, 0xbd, 0x5d, 0x29, 0xf0, 0xbc, 0xf2, 0x8a, 0x16, 0xbe,
+  0xc5, 0xfc, 0x3b, 0x3c, 0xc7, 0x48, 0x0d, 0xbd, 0x47, 0xf5, 0x86, 0x3d,
+  0x86, 0x02, 0xcd, 0xbc, 0x14, 0x9c, 0x5a, 0x3c, 0x18, 0xc2, 0x60, 0xbc,
+  0x52, 0x71, 0x83, 0xbc, 0x4e, 0xce, 0xac, 0xbd, 0x42, 0x64, 0x98, 0x3b,
+  0xb1, 0xcc, 0x14, 0x3d, 0xb0, 0xd4, 0xfa, 0x3d, 0x2c, 0xf3, 0xa1, 0x3d,
+  0x85, 0x7b, 0x80, 0x3c, 0xff, 0x4d, 0x24, 0x3d, 0x03, 0xc2, 0xe3, 0xbd,
+  0x2f, 0x04, 0x90, 0x3c, 0x8f, 0xd8, 0xd7, 0x3d, 0x90, 0xec, 0x70, 0x3d,
+  0x4d, 0xae, 0x36, 0x3d, 0x9d, 0x46, 0x9a, 0x3c, 0x02, 0x9f, 0xa5, 0x3d,
+  0xf9, 0x5f, 0xb0, 0x39, 0x58, 0x8e, 0xbf, 0xbd, 0x06, 0xe0, 0xe0, 0x3d,
+  0xdb, 0x21, 0xdd, 0x3c, 0xc9, 0x41, 0x84, 0x3d, 0x54, 0x37, 0xb4, 0x3c,
+  0x52, 0x8f, 0xbc, 0x3c, 0x39, 0x7b, 0xb9, 0xbc, 0x72, 0xbc, 0x01, 0x3d,
+  0x85, 0xd3, 0xe3, 0x3d, 0x5e, 0x72, 0x45, 0x3d, 0xe0, 0x54, 0xa2, 0x3d,
+  0xfe, 0x31, 0x6d, 0xbc, 0x5c, 0x95, 0x85, 0xb9, 0xe3, 0x9e, 0x3b, 0x3b,
+  0xad, 0xa0, 0x17, 0xbd, 0xd9, 0x80, 0x35, 0x3c, 0x48, 0xc4, 0x05, 0x3d,
+  0x08, 0x68, 0x18, 0xbe, 0x4a, 0x57, 0xbc, 0xbc, 0x2d, 0x7e, 0x07, 0xbe,
+  0x11, 0x9b, 0x8a, 0xbd, 0x5e, 0xd0, 0xa9, 0x3d, 0x2c, 0x94, 0x29, 0xbd,
+  0x9d, 0xca, 0x00, 0xbe, 0x9e, 0x81, 0xd2, 0xbd, 0x22, 0x2f, 0x8f, 0xbd,
+  0x80, 0x9b, 0xc8, 0xbd, 0x54, 0x8d, 0xb4, 0xbc, 0x3f, 0x5e, 0x2c, 0xbe,
+  0xff, 0x85, 0x92, 0xbd, 0xca, 0xbe, 0x3a, 0xbd, 0xc3, 0x7d, 0xeb, 0x3c,
+  0xfb, 0xf0, 0x50, 0xbe, 0xa1, 0xae, 0x01, 0xbd, 0x7f, 0xab, 0xd6, 0x3c,
+  0x4d, 0xd8, 0x62, 0xbd, 0x28, 0x21, 0x18, 0xbe, 0x86, 0xfc, 0xb6, 0xbd,
+  0xaa, 0x79, 0x2e, 0xbd, 0x67, 0x76, 0xa4, 0x3c, 0xe6, 0x38, 0x34, 0xbd,
+  0xa0, 0xc5, 0xaf, 0xbd, 0x27, 0x07, 0x85, 0x3c, 0x7f, 0x41, 0x34, 0xbc,
+  0x11, 0xb7, 0x63, 0xbc, 0x4f, 0x4d, 0x8b, 0xbe, 0x95, 0xa9, 0x80, 0xbd,
+  0x73, 0x14, 0x2e, 0x3d, 0x2e, 0x4e, 0x7a, 0xbd, 0x59, 0x24, 0x22, 0xbe,
+  0xd9, 0x42, 0x73, 0xbc, 0xe9, 0x22, 0x79, 0x3d, 0x11, 0x49, 0xd4, 0xbc,
+  0x0a, 0x3e, 0x77, 0xbe, 0xf1, 0xb0, 0xe2, 0x3c, 0x6b, 0x87, 0xb3, 0xbd,
+  0x32, 0x83, 0x13, 0xbe, 0xfd, 0x56, 0x3e, 0xbe, 0x8b, 0x98, 0x1b, 0xbe,
+  0xcd, 0x73, 0x90, 0xbd, 0xfa, 0xc4, 0xb3, 0xbc, 0x48, 0xa7, 0x8a, 0xbe,
+  0x17, 0xcf, 0xb9, 0xbc, 0x78, 0x7d, 0x59, 0xbd, 0x4c, 0xf9, 0x47, 0xbc,
+  0x6f, 0x20, 0x52, 0xbe, 0x76, 0xac, 0xec, 0xbc, 0x4b, 0xe5, 0x02, 0xbd,
+  0xc3, 0xd2, 0xce, 0xbc, 0xf6, 0x90, 0x11, 0xbe, 0x4f, 0x7a, 0xa8, 0x3c,
+  0xef, 0x7e, 0x8d, 0xbd, 0x9e, 0xcf, 0x9d, 0xbc, 0x2a, 0x28, 0x86, 0xbe,
+  0x4c, 0x5e, 0x0c, 0xbe, 0xc8, 0xed, 0x41, 0xbd, 0xac, 0x48, 0x29, 0x3d,
+  0xe1, 0xdb, 0x99, 0xbd, 0x14, 0x84, 0x55, 0xbd, 0xb0, 0x41, 0xd5, 0xbd,
+  0x94, 0xee, 0x0e, 0xbb, 0xc6, 0xed, 0x65, 0xbe, 0xbb, 0xca, 0xaa, 0xbd,
+  0xd6, 0xa7, 0x24, 0xbe, 0x76, 0x8d, 0x95, 0xbc, 0x52, 0xaa, 0xfa, 0x3d,
+  0x71, 0xc8, 0x10, 0xbe, 0xe6, 0xd1, 0x39, 0xbe, 0xcf, 0x24, 0x18, 0x3e,
+  0xcf, 0xba, 0xcd, 0xbd, 0xbc, 0x42, 0x00, 0xbe, 0x3b, 0x15, 0x00, 0xbe,
+  0x8f, 0x09, 0x87, 0x3d, 0xaf, 0xbc, 0x81, 0x3e, 0x8b, 0xf4, 0x30, 0xbc,
+  0x76, 0x73, 0xfa, 0xbd, 0xb5, 0xe5, 0x95, 0x3d, 0xeb, 0x8d, 0x0e, 0xbc,
+  0xbf, 0x24, 0x8f, 0xbd, 0xea, 0xcc, 0x23, 0xbd, 0xe8, 0x52, 0x92, 0x3c,
+  0x0f, 0x36, 0x92, 0x3e, 0x70, 0xaa, 0x94, 0xbc, 0x0c, 0x30, 0xbf, 0xbd,
+  0x07, 0x0c, 0xb1, 0xbd, 0xac, 0x44, 0xa1, 0xbd, 0xf4, 0x25, 0x9a, 0xbd,
+  0xab, 0x90, 0x5c, 0xbc, 0x71, 0xb5, 0xaf, 0x3d, 0x89, 0x80, 0x85, 0x3e,
+  0xcc, 0x97, 0x3b, 0xbd, 0x14, 0xc6, 0xf4, 0xbd, 0x9c, 0xb4, 0x12, 0xbe,
+  0x75, 0xf1, 0xc8, 0xbd, 0x3f, 0xa8, 0x16, 0xbd, 0xa6, 0x0e, 0x27, 0xbe,
+  0x15, 0x1b, 0x94, 0xbd, 0x9e, 0xc5, 0x9a, 0x3d, 0x91, 0xc8, 0x05, 0xbe,
+  0xf8, 0x4d, 0xf9, 0xbd, 0xb6, 0x6d, 0x82, 0xbd, 0x7d, 0x7f, 0x06, 0xbe,
+  0xd8, 0xa4, 0x19, 0xbe, 0x94, 0x20, 0xb9, 0xbd, 0x9b, 0x08, 0xe6, 0xbd,
+  0xd9, 0x8f, 0xe5, 0xbc, 0x4a, 0x44, 0xab, 0xbd, 0x97, 0x8a, 0xb0, 0xbd,
+  0x08, 0x0d, 0x33, 0xbe, 0x11, 0x80, 0xcf, 0xbd, 0xca, 0xe5, 0xfc, 0xbd,
+  0x4f, 0x4b, 0x05, 0xbe, 0xb2, 0xaa, 0x0e, 0xbe, 0xc0, 0x4b, 0xc0, 0xbd,
+  0x26, 0x21, 0xf6, 0xbd, 0x36, 0x31, 0xf4, 0xbd, 0xe0, 0x89, 0x64, 0xbd,
+  0x01, 0xd7, 0x04, 0x3d, 0x1c, 0x93, 0x6c, 0xbd, 0xba, 0x7c, 0x20, 0x3d,
+  0xec, 0x01, 0x06, 0xbe, 0x6a, 0x02, 0xe7, 0xbd, 0x14, 0xf2, 0x54, 0xbc,
+  0xfb, 0x33, 0x29, 0x3d, 0xb4, 0x7e, 0x73, 0xbd, 0x7b, 0x32, 0x28, 0xbd,
+  0x0e, 0xb1, 0x83, 0xbd, 0x5e, 0x6b, 0x8d, 0x3d, 0x38, 0x32, 0xf7, 0xbc,
+  0x44, 0x85, 0x72, 0xbe, 0x0a, 0x07, 0x1e, 0x3d, 0x57, 0x2c, 0x28, 0x3d,
+  0xc3, 0x77, 0x87, 0xbd, 0x89, 0x6c, 0x04, 0x3c, 0x0d, 0xb2, 0x23, 0xbd,
+  0x14, 0xa6, 0x9d, 0xbc, 0xe9, 0xf8, 0x6f, 0xbc, 0xea, 0x60, 0xc4, 0xbe,
+  0x31, 0xe2, 0x03, 0xbd, 0xfa, 0x17, 0xed, 0xbc, 0xc8, 0xf6, 0x03, 0x3c,
+  0x72, 0x14, 0x18, 0xbd, 0x2b, 0xfe, 0x98, 0xbd, 0x13, 0xc6, 0x67, 0xbd,
+  0x34, 0xa3, 0x18, 0xbe, 0x58, 0x39, 0x95, 0xbe, 0x95, 0xb0, 0xa4, 0xbc,
+  0x4b, 0x0e, 0xbd, 0x3b, 0x1c, 0xbb, 0x39, 0x3e, 0xd0, 0xa9, 0x48, 0xbe,
+  0xfa, 0x6a, 0x14, 0xbd, 0xcd, 0xc8, 0xba, 0x3d, 0x28, 0x85, 0x05, 0xbc,
+  0x03, 0x30, 0xa3, 0xbe, 0x96, 0x0d, 0x9a, 0x3c, 0x53, 0xbe, 0xf5, 0xbd,
+  0x8d, 0xa9, 0x81, 0x3e, 0x96, 0x14, 0x92, 0xbe, 0xa1, 0xd9, 0x28, 0xbe,
+  0xb6, 0xa3, 0x2d, 0xbe, 0x87, 0x8e, 0x16, 0xbb, 0x54, 0xf4, 0x09, 0x3d,
+  0x37, 0x03, 0x41, 0xbe, 0x5b, 0x2e, 0x56, 0xbe, 0x05, 0xc4, 0x98, 0x3e,
+  0x1e, 0x76, 0x42, 0xbe, 0xa7, 0xe8, 0x5a, 0xbe, 0xf1, 0x0a, 0x63, 0xbe,
+  0x53, 0x51, 0x84, 0xbc, 0x8f, 0x63, 0x8b, 0x3e, 0xfc, 0xb5, 0x6c, 0xbe,
+  0xfb, 0x46, 0x84, 0xbe, 0x51, 0x93, 0x7a, 0x3e, 0x83, 0x00, 0x36, 0xbe,
+  0x13, 0xcc, 0x53, 0xbe, 0x9e, 0x24, 0x38, 0xbe, 0xb7, 0xc6, 0xbe, 0xbc,
+  0x5e, 0xe3, 0xb7, 0x3e, 0x56, 0xe4, 0x24, 0xbe, 0xee, 0x57, 0x21, 0xbe,
+  0x3b, 0x79, 0x92, 0x3e, 0xfe, 0x57, 0xdc, 0xbc, 0x1c, 0x29, 0x9d, 0xbd,
+  0xe6, 0xb9, 0xdb, 0xbd, 0x35, 0xf6, 0x2b, 0xbd, 0x52, 0x81, 0x59, 0x3e,
+  0xb8, 0xcb, 0x0b, 0xbe, 0x73, 0xb0, 0x3f, 0xbd, 0x79, 0xe7, 0x11, 0x3e,
+  0x55, 0xf1, 0x00, 0xbd, 0x00, 0x8d, 0x8e, 0xbd, 0xc9, 0x72, 0x1b, 0xbe,
+  0xe4, 0x7e, 0x64, 0xbe, 0x89, 0x0c, 0xac, 0xbb, 0x80, 0xfd, 0x71, 0xbe,
+  0x21, 0x6f, 0xb8, 0xbd, 0x4d, 0x12, 0xa4, 0xbd, 0x5b, 0x13, 0x72, 0xbe,
+  0x64, 0x51, 0x2e, 0xbe, 0x6f, 0x3d, 0x6f, 0xbe, 0x7f, 0xff, 0x8b, 0xbe,
+  0x34, 0xb5, 0x34, 0x3d, 0xbc, 0xa5, 0x6b, 0xbe, 0xb2, 0xb2, 0x8e, 0xbe,
+  0x72, 0xbd, 0xd2, 0xbc, 0xc3, 0xb9, 0x33, 0xbe, 0xf1, 0xa9, 0x59, 0xbe,
+  0x96, 0x5a, 0x5b, 0xbe, 0x0c, 0xe9, 0x03, 0xbe, 0xfb, 0x26, 0x90, 0x3d,
+  0x31, 0x0b, 0x22, 0xbe, 0x02, 0xcc, 0x61, 0xbe, 0xb5, 0x61, 0x7d, 0xbd,
+  0x06, 0xc5, 0x96, 0xbd, 0xd7, 0x38, 0x5d, 0xbd, 0x4b, 0xca, 0xf9, 0xbd,
+  0x29, 0x19, 0x84, 0xbe, 0x74, 0x4f, 0x36, 0xbd, 0x4a, 0x10, 0xc3, 0xbd,
+  0x64, 0xf8, 0xa3, 0xbd, 0x50, 0x6b, 0x67, 0x3c, 0x4a, 0x95, 0x19, 0xbc,
+  0xee, 0xe0, 0x88, 0xbc, 0xbb, 0xa8, 0x96, 0x3d, 0xfb, 0xb5, 0xa5, 0xbd,
+  0xb7, 0x55, 0x89, 0xbe, 0xa9, 0x66, 0x0d, 0x3d, 0x64, 0x88, 0x9e, 0x3c,
+  0x49, 0x12, 0x1d, 0xbe, 0x42, 0xc3, 0xf6, 0x3b, 0x66, 0x8b, 0x16, 0x39,
+  0x1f, 0x00, 0x02, 0x3e, 0x33, 0xa1, 0x14, 0xbd, 0xf5, 0xe6, 0x92, 0xbe,
+  0xb3, 0x07, 0x7b, 0x3d, 0xcd, 0x90, 0xae, 0xba, 0xf5, 0x78, 0x21, 0xbe,
+  0x87, 0x57, 0x23, 0x3c, 0x9b, 0xf4, 0x45, 0xbd, 0xa3, 0x13, 0xad, 0x3d,
+  0xaf, 0x58, 0xd4, 0xbd, 0x6d, 0x3d, 0x1b, 0xbf, 0xc2, 0x9e, 0x7f, 0x3d,
+  0x05, 0xf9, 0x6e, 0xbc, 0x61, 0xfc, 0x7d, 0xbd, 0x77, 0xb3, 0x9b, 0xbd,
+  0xc2, 0x38, 0x88, 0x3d, 0x39, 0x1b, 0x96, 0x3d, 0x41, 0xfc, 0xac, 0xbd,
+  0x2d, 0x81, 0x1d, 0xbf, 0x57, 0x1d, 0xd0, 0x3c, 0x45, 0x0e, 0xab, 0xbc,
+  0xfc, 0x1f, 0x95, 0x3d, 0x25, 0x8b, 0xd1, 0xbd, 0xff, 0x70, 0xe6, 0xbd,
+  0x84, 0x09, 0x7d, 0xbd, 0xcc, 0xd9, 0xe6, 0xbc, 0xb4, 0x78, 0x96, 0xbe,
+  0xcd, 0xe9, 0x29, 0xbc, 0x91, 0x3e, 0x12, 0xbe, 0xef, 0x15, 0x8c, 0x3e,
+  0xf2, 0xa6, 0x99, 0xbd, 0xbf, 0xec, 0x57, 0xbe, 0x53, 0x71, 0x27, 0xbe,
+  0x49, 0x41, 0x5e, 0xbd, 0xc2, 0xf9, 0x46, 0x3d, 0x79, 0xc2, 0x40, 0xbe,
+  0x62, 0xad, 0x44, 0xbe, 0x17, 0x24, 0x7d, 0x3e, 0x7d, 0x69, 0x98, 0xbd,
+  0xab, 0x71, 0x68, 0xbe, 0xa9, 0x4f, 0x39, 0xbe, 0xd9, 0x03, 0x8b, 0xbd,
+  0x7c, 0x50, 0x77, 0x3e, 0xab, 0x97, 0xea, 0xbd, 0xad, 0x07, 0x3e, 0xbe,
+  0x1b, 0x7e, 0x37, 0x3e, 0xab, 0xad, 0x9d, 0xbd, 0xb3, 0x3c, 0x35, 0xbe,
+  0x1d, 0xfc, 0x1f, 0xbe, 0xa0, 0xe4, 0xc3, 0xbd, 0x1e, 0xc7, 0x73, 0x3e,
+  0x29, 0x90, 0x15, 0xbe, 0x32, 0xe0, 0xa4, 0xbd, 0xf9, 0x42, 0x3c, 0x3e,
+  0xdf, 0xb1, 0x83, 0x3d, 0x47, 0x5a, 0xcd, 0xbd, 0xb4, 0xb5, 0x15, 0xbb,
+  0x65, 0xd5, 0xed, 0xbd, 0x60, 0x7a, 0xbe, 0x3d, 0xa9, 0xbb, 0x74, 0xbc,
+  0x7c, 0x85, 0x2b, 0x3c, 0x69, 0xd0, 0x82, 0x3d, 0xca, 0x18, 0x79, 0x3d,
+  0x00, 0x2a, 0x67, 0x3d, 0x80, 0x28, 0x4a, 0x3d, 0x28, 0x54, 0xfe, 0xbd,
+  0x3e, 0xdc, 0x50, 0xbe, 0x30, 0x4e, 0x64, 0xbc, 0x34, 0xb6, 0x15, 0x3e,
+  0x2c, 0xaf, 0xa0, 0xbd, 0xfe, 0x92, 0xe5, 0xbd, 0x7c, 0xcd, 0x8a, 0xbc,
+  0xe8, 0x8d, 0x09, 0xbd, 0xa0, 0x1f, 0x0c, 0xbe, 0x9d, 0x52, 0xca, 0xbc,
+  0x69, 0x8c, 0x34, 0xbe, 0xb4, 0x38, 0xf7, 0xbd, 0x42, 0xc9, 0x0e, 0x3c,
+  0x22, 0xac, 0x05, 0xbe, 0x51, 0xf2, 0x10, 0xbe, 0x86, 0x76, 0x3b, 0xbe,
+  0x03, 0x90, 0xbe, 0xbd, 0x23, 0x79, 0x9f, 0x3c, 0x73, 0x3d, 0xfb, 0xbd,
+  0xed, 0xe5, 0x11, 0xbe, 0xbc, 0x4c, 0xf0, 0xbd, 0x1a, 0xb4, 0x90, 0xbd,
+  0xf9, 0x14, 0x3b, 0xbd, 0x33, 0x1c, 0xfe, 0xbd, 0x6f, 0x02, 0x0e, 0xbe,
+  0x67, 0xc7, 0xa7, 0xbc, 0x81, 0xf0, 0x19, 0xbe, 0x96, 0x7e, 0x6f, 0x3b,
+  0x3a, 0x5f, 0x58, 0xbe, 0x19, 0x92, 0x7f, 0x3d, 0x01, 0x17, 0x53, 0xbd,
+  0x8a, 0x1d, 0xe9, 0x3d, 0xb4, 0xe4, 0x7d, 0xbc, 0xec, 0xdd, 0x95, 0xbe,
+  0xe5, 0xd2, 0x01, 0x3e, 0xdc, 0x90, 0x9f, 0x3d, 0x19, 0x58, 0x4e, 0xbe,
+  0xf4, 0x14, 0x78, 0x3d, 0x59, 0x4d, 0xf9, 0x3b, 0x12, 0x16, 0xb9, 0x3d,
+  0x6c, 0x7b, 0xd6, 0xbd, 0x3d, 0x96, 0xea, 0xbe, 0x12, 0x6a, 0xb5, 0x3d,
+  0xec, 0x01, 0xaf, 0x3d, 0xa4, 0x66, 0x7d, 0xbe, 0x09, 0x68, 0xf5, 0xbb,
+  0xfc, 0x96, 0x20, 0x3d, 0xe4, 0xfd, 0xab, 0x3d, 0x45, 0xc1, 0x1f, 0xbd,
+  0xb7, 0x1d, 0x23, 0xbf, 0xef, 0xe3, 0x84, 0xba, 0x89, 0x94, 0xe0, 0x3d,
+  0x56, 0xf5, 0x7d, 0xbe, 0x63, 0x71, 0x2d, 0x3c, 0x13, 0x62, 0x8a, 0x3d,
+  0x06, 0xee, 0xda, 0x3d, 0xb6, 0x37, 0x7d, 0xbd, 0xd7, 0x78, 0x1f, 0xbf,
+  0x45, 0x66, 0xdc, 0x3b, 0x54, 0xfe, 0x14, 0x3d, 0xf9, 0x02, 0x06, 0x3e,
+  0x82, 0x10, 0xbc, 0xbd, 0x9f, 0xf2, 0xb8, 0xbc, 0xa8, 0x35, 0x85, 0x3c,
+  0x7e, 0xbb, 0x48, 0x3d, 0xbf, 0xc6, 0x9e, 0xbd, 0x24, 0xb1, 0xeb, 0x3a,
+  0x46, 0x7e, 0x6c, 0xbd, 0xa6, 0x16, 0xab, 0x3e, 0xc6, 0x52, 0x98, 0x3c,
+  0x9e, 0xee, 0xf6, 0xbd, 0x71, 0x39, 0x2c, 0xbd, 0x64, 0xb1, 0xf8, 0x3d,
+  0x7a, 0x5e, 0xde, 0x3d, 0xe6, 0x88, 0x53, 0x3d, 0xd9, 0x4b, 0x7f, 0xbd,
+  0x88, 0x26, 0x45, 0x3e, 0x7e, 0x18, 0xa0, 0x3c, 0xdf, 0x59, 0x5a, 0xbd,
+  0xc3, 0xcd, 0xd8, 0xbd, 0xbc, 0xa1, 0xa5, 0xbd, 0x9c, 0x1b, 0xee, 0x3d,
+  0x6d, 0x9b, 0xce, 0xbd, 0x0a, 0xac, 0xd7, 0xbd, 0x8f, 0x56, 0xbf, 0x3d,
+  0xbe, 0xe2, 0x44, 0x3c, 0x13, 0xe1, 0x0e, 0xbe, 0xa9, 0xa9, 0x09, 0xbd,
+  0xf7, 0x5e, 0x7a, 0xbd, 0x02, 0xf6, 0xcc, 0x3d, 0xbd, 0x42, 0xdc, 0xbd,
+  0xa7, 0x51, 0x6e, 0xbb, 0x94, 0x6a, 0xc8, 0xbd, 0x6f, 0x62, 0xcd, 0xba,
+  0x83, 0x65, 0x6f, 0xbc, 0x69, 0x3c, 0x86, 0x3c, 0x06, 0xf7, 0xe9, 0xbc,
+  0xf4, 0x88, 0x9d, 0x3c, 0xe2, 0x7c, 0xb8, 0x3d, 0xa5, 0x3b, 0x80, 0x3d,
+  0x1f, 0xc1, 0xb8, 0xbd, 0x89, 0x97, 0xff, 0x3d, 0x21, 0x86, 0x2e, 0x3d,
+  0xc6, 0xc8, 0x94, 0x3d, 0xfe, 0x34, 0x44, 0x3d, 0xad, 0x33, 0x1b, 0xbe,
+  0x69, 0xaf, 0xdd, 0x3d, 0x2d, 0x6c, 0x0d, 0x3e, 0x9a, 0x0a, 0x8d, 0xbd,
+  0x40, 0x56, 0xb5, 0x3d, 0x68, 0x10, 0xd2, 0x3d, 0xca, 0x9c, 0xc9, 0xbd,
+  0x5a, 0x22, 0xce, 0xbb, 0x51, 0x85, 0xbd, 0xbd, 0xd3, 0xa6, 0xac, 0xba,
+  0x5e, 0x93, 0x73, 0x3d, 0x43, 0x24, 0x3b, 0x3d, 0x0a, 0x9d, 0x2d, 0xbe,
+  0x2f, 0x92, 0x05, 0xbe, 0xe0, 0xbf, 0xe6, 0xbd, 0x6f, 0xff, 0x03, 0xbe,
+  0x00, 0x7e, 0x04, 0xbd, 0x56, 0xca, 0xeb, 0xbd, 0x73, 0xa7, 0x01, 0xbe,
+  0x55, 0x73, 0x2e, 0xbe, 0xcb, 0xe3, 0x61, 0xbd, 0x15, 0x2c, 0xce, 0xbb,
+  0x78, 0xc9, 0xf8, 0xbd, 0x83, 0x92, 0x10, 0xbe, 0x0d, 0x73, 0xc0, 0x3c,
+  0x91, 0xb9, 0xec, 0xbd, 0xfd, 0xe5, 0xbf, 0xbd, 0xf5, 0x17, 0x87, 0xbe,
+  0xf1, 0x1c, 0xab, 0x3c, 0x65, 0xbf, 0x2e, 0x3d, 0x0e, 0x34, 0xb9, 0x3d,
+  0x1e, 0x20, 0xd9, 0xbc, 0xa1, 0xda, 0x4a, 0xbe, 0xc4, 0x48, 0xc2, 0x3d,
+  0xb0, 0x61, 0x38, 0x3c, 0x35, 0x51, 0x8b, 0xbe, 0xe2, 0xbc, 0x73, 0x3d,
+  0xce, 0x9e, 0x52, 0x3d, 0x1c, 0x93, 0xbf, 0x3d, 0x4a, 0xa3, 0xb6, 0xbd,
+  0x81, 0x15, 0xe9, 0xbe, 0x9d, 0x07, 0x87, 0x3c, 0x7c, 0xc8, 0xf7, 0x3d,
+  0x35, 0x3c, 0xd4, 0xbe, 0xb6, 0x71, 0xd0, 0x3d, 0xba, 0xe5, 0xc7, 0x3c,
+  0x27, 0x30, 0x2c, 0x3e, 0x01, 0x07, 0x6c, 0xbd, 0x40, 0xb6, 0x26, 0xbf,
+  0xc9, 0x31, 0x41, 0x3d, 0x93, 0xca, 0xe8, 0x3d, 0x6c, 0x69, 0x55, 0xbe,
+  0x9e, 0x44, 0x65, 0x3c, 0xcc, 0xc4, 0x62, 0x3d, 0x71, 0x49, 0xe9, 0x3d,
+  0xb4, 0x04, 0x99, 0xbd, 0x03, 0xf6, 0xf5, 0xbe, 0xfd, 0xde, 0x00, 0x3e,
+  0xef, 0x28, 0x47, 0x3c, 0xe8, 0x40, 0x30, 0x3e, 0x71, 0x28, 0x11, 0x3d,
+  0x87, 0x43, 0x95, 0x3c, 0xee, 0x89, 0xc4, 0x3d, 0xd3, 0xb2, 0xc2, 0xbc,
+  0x79, 0x12, 0x0b, 0xbe, 0x63, 0xf5, 0xff, 0x3d, 0xee, 0x92, 0x7e, 0x3d,
+  0xc0, 0x54, 0x31, 0x3e, 0x21, 0xa0, 0x59, 0x3c, 0x03, 0x35, 0x9d, 0xbb,
+  0x90, 0xce, 0xbd, 0x3d, 0xe3, 0x59, 0xf1, 0x3c, 0x1e, 0x57, 0x6f, 0x3d,
+  0xe3, 0x97, 0xd6, 0x3c, 0xa2, 0xfd, 0xa7, 0x3d, 0xe1, 0x2a, 0x08, 0x3e,
+  0xfa, 0x0d, 0x0d, 0xbd, 0xb8, 0xa6, 0xa2, 0xbc, 0x72, 0xed, 0x99, 0xb9,
+  0x06, 0x81, 0x82, 0x3d, 0x7a, 0x37, 0x29, 0xbc, 0x17, 0x14, 0x59, 0xbd,
+  0xae, 0x3b, 0x07, 0xbd, 0x1b, 0xdb, 0xa1, 0x3d, 0xd9, 0x3e, 0xca, 0xbc,
+  0x35, 0xdc, 0xd4, 0xbc, 0x4d, 0x50, 0x90, 0x3d, 0x9d, 0xcc, 0xd5, 0xbc,
+  0x2a, 0x04, 0x11, 0xbd, 0xac, 0xcc, 0x2e, 0x3d, 0xd6, 0xd3, 0x56, 0x3c,
+  0x81, 0x1d, 0xd1, 0xbd, 0x31, 0xe5, 0xc4, 0xba, 0x32, 0x79, 0xca, 0x3c,
+  0x7f, 0xa7, 0xd7, 0x3d, 0x99, 0x3d, 0xf4, 0x3d, 0xb9, 0x4f, 0x45, 0x3c,
+  0x65, 0x06, 0xe5, 0x3d, 0xe2, 0xaa, 0xc8, 0x3d, 0x55, 0x87, 0x4b, 0xbe,
+  0x33, 0x96, 0x1f, 0x3d, 0x73, 0xe0, 0x5c, 0x3d, 0x0b, 0xde, 0x08, 0x3d,
+  0x8d, 0x5c, 0xcc, 0x3d, 0x3a, 0xcf, 0xe1, 0xbd, 0x3c, 0xd2, 0xc9, 0x3d,
+  0x77, 0xe0, 0xc2, 0x3d, 0xf7, 0xd4, 0xd0, 0xbd, 0x45, 0x98, 0x1f, 0xbc,
+  0xa3, 0xca, 0xb3, 0x3b, 0x3d, 0x8c, 0x38, 0x3c, 0x8f, 0xa4, 0xe5, 0x3b,
+  0x91, 0x82, 0xf5, 0xbd, 0x72, 0x98, 0x0f, 0x3d, 0x2c, 0x72, 0x6f, 0x3d,
+  0x80, 0x4f, 0x4b, 0x3b, 0x63, 0x96, 0x2d, 0xbe, 0xa5, 0xe1, 0x4c, 0xbe,
+  0x7c, 0x4c, 0x10, 0xbe, 0x79, 0xa9, 0x32, 0xbe, 0xe9, 0x95, 0x55, 0x3d,
+  0xfd, 0xca, 0x09, 0xbe, 0xe1, 0x05, 0x72, 0xbe, 0x8d, 0x1e, 0xed, 0xbd,
+  0x29, 0x25, 0x8c, 0xbe, 0x66, 0xeb, 0xa5, 0x3c, 0x2d, 0xea, 0x25, 0xbe,
+  0x3f, 0xff, 0x79, 0xbd, 0x43, 0x09, 0x7a, 0x3c, 0x33, 0x7f, 0x35, 0xbe,
+  0x2d, 0x39, 0xb4, 0xbd, 0x40, 0xc1, 0xc6, 0xbe, 0x3e, 0x2e, 0xbd, 0xbc,
+  0x6a, 0xba, 0x90, 0x3d, 0xb4, 0xf2, 0xb5, 0x3c, 0x35, 0xc4, 0xa3, 0xbd,
+  0xe9, 0x0e, 0x03, 0x3c, 0x93, 0xca, 0x86, 0x3d, 0x37, 0x03, 0x34, 0xbd,
+  0x99, 0x73, 0x9b, 0xbe, 0xc5, 0xce, 0xdc, 0x3d, 0x31, 0x71, 0x90, 0x3d,
+  0x52, 0x29, 0x5e, 0x3d, 0xf4, 0x20, 0xe1, 0xbc, 0xdc, 0x51, 0x68, 0xbe,
+  0xb6, 0x28, 0x83, 0x3d, 0xe6, 0x20, 0x2b, 0x3d, 0xf5, 0x8c, 0xa6, 0xbe,
+  0x00, 0x8a, 0xf2, 0x3d, 0x84, 0xd2, 0xe6, 0x3d, 0x03, 0xcb, 0x4c, 0x3d,
+  0x0f, 0xf1, 0x6d, 0x3d, 0x26, 0x88, 0x9b, 0xbe, 0x46, 0xb2, 0x75, 0x3d,
+  0x1b, 0x26, 0xad, 0x3d, 0x90, 0x9d, 0x3b, 0xbe, 0x17, 0x83, 0x21, 0x3e,
+  0x0f, 0xb9, 0x1f, 0x3e, 0x14, 0x79, 0x00, 0x3d, 0xad, 0x0d, 0x8c, 0xbc,
+  0x95, 0xea, 0xe9, 0xbe, 0x6d, 0x83, 0xb6, 0x3d, 0x8f, 0xe0, 0xa6, 0x3d,
+  0x4e, 0xb5, 0x34, 0x3b, 0x0c, 0x59, 0x4b, 0x3d, 0x5a, 0x41, 0x0c, 0x3d,
+  0xa9, 0x49, 0xc1, 0x3d, 0x97, 0x58, 0xdb, 0xbd, 0x00, 0x3d, 0x80, 0xbe,
+  0x0e, 0x94, 0x9d, 0xbb, 0x54, 0xf8, 0x32, 0x3c, 0xb5, 0xcc, 0x6c, 0x3d,
+  0xe7, 0x54, 0xee, 0x3d, 0x9b, 0x94, 0x00, 0x3d, 0x41, 0xd6, 0x3e, 0x3d,
+  0x2b, 0x60, 0x76, 0xbd, 0x3e, 0xb6, 0x19, 0xbd, 0xc8, 0x0b, 0x34, 0x3c,
+  0x9b, 0x08, 0xb6, 0x3d, 0x18, 0x0a, 0xb5, 0x3d, 0x1c, 0xa8, 0x68, 0x3d,
+  0x71, 0x4f, 0xdd, 0xbc, 0xc1, 0x0e, 0xcc, 0x3d, 0xb6, 0xa3, 0x8e, 0x3d,
+  0xa0, 0x23, 0x5a, 0x3d, 0xaa, 0xa4, 0xa1, 0x3d, 0x52, 0xd9, 0xc7, 0x3c,
+  0xf4, 0x73, 0xdf, 0x3d, 0x3d, 0x10, 0x1c, 0x3d, 0x63, 0x61, 0xd8, 0x3c,
+  0x66, 0x07, 0x19, 0xbc, 0x08, 0x79, 0x0b, 0x3e, 0xb6, 0x14, 0x82, 0x3c,
+  0x67, 0x96, 0x88, 0x3a, 0xb9, 0x31, 0x77, 0xbc, 0xc6, 0x79, 0x32, 0x3d,
+  0x13, 0xce, 0x00, 0x3b, 0xe9, 0xbf, 0x55, 0x3d, 0xf0, 0xbd, 0x12, 0xbb,
+  0x95, 0xbe, 0x56, 0xbc, 0x57, 0xa5, 0x85, 0x3c, 0xd8, 0xdf, 0x04, 0xbc,
+  0xe6, 0x68, 0x74, 0xbd, 0x73, 0x48, 0x0f, 0xbe, 0xbc, 0x58, 0x8c, 0xbd,
+  0x5a, 0xb1, 0xd1, 0x3b, 0xaf, 0x0e, 0x36, 0xbc, 0x64, 0xf6, 0x7d, 0x3d,
+  0x94, 0x38, 0x42, 0xbd, 0x8a, 0x55, 0x93, 0x3d, 0x82, 0x2b, 0xe5, 0x3c,
+  0x94, 0x4d, 0x9a, 0xbd, 0xd9, 0xd1, 0x89, 0x3d, 0xa7, 0xc1, 0xae, 0xbc,
+  0x40, 0xa5, 0xc3, 0xbd, 0xf2, 0xe2, 0xe0, 0x3c, 0x61, 0xf4, 0x47, 0x3b,
+  0xb2, 0x1a, 0xe8, 0x3c, 0x26, 0x0a, 0x2f, 0x3d, 0x0e, 0xec, 0x7f, 0x3d,
+  0xa6, 0x9b, 0xd3, 0xbd, 0xc6, 0xc1, 0x1d, 0xbe, 0x71, 0xbf, 0x05, 0xbe,
+  0xdf, 0x78, 0x08, 0xbe, 0x0b, 0x61, 0xa3, 0x3c, 0x28, 0x84, 0x31, 0xbe,
+  0x55, 0x09, 0x66, 0xbe, 0x4e, 0x16, 0x0a, 0xbe, 0x4a, 0xaa, 0x77, 0xbe,
+  0xf4, 0x9d, 0xc9, 0xbd, 0x89, 0x3d, 0x32, 0xbe, 0xc7, 0xaf, 0x3b, 0xbe,
+  0x22, 0x9c, 0x45, 0x3c, 0x00, 0x1f, 0x24, 0xbe, 0x34, 0xd1, 0xd9, 0xbd,
+  0x16, 0x43, 0x93, 0xbe, 0x18, 0x54, 0x7d, 0xbd, 0xe0, 0x7f, 0xdd, 0xbb,
+  0x3e, 0x9a, 0xbe, 0xbb, 0xdf, 0xdd, 0x01, 0xbe, 0x2c, 0xf3, 0xaa, 0x3d,
+  0x09, 0x95, 0x93, 0xbd, 0xb3, 0x17, 0x4b, 0xbc, 0x28, 0xfe, 0x7f, 0xbe,
+  0x96, 0x15, 0x74, 0xbd, 0x28, 0x3b, 0xb6, 0xbc, 0x41, 0x43, 0x1e, 0xbd,
+  0x7a, 0x95, 0x39, 0xbd, 0xdf, 0x5a, 0x5b, 0xbc, 0xdd, 0x91, 0x17, 0xbb,
+  0xa2, 0x6c, 0x12, 0x3d, 0x7a, 0x1c, 0xf7, 0xbd, 0x93, 0x96, 0x8c, 0x3d,
+  0x7d, 0x98, 0xe3, 0x3d, 0xd8, 0x47, 0x56, 0x3d, 0xed, 0xfb, 0xa7, 0xbb,
+  0x46, 0x4e, 0x59, 0xbb, 0xb2, 0x48, 0xf8, 0x3d, 0x99, 0xe9, 0x17, 0x3e,
+  0xfb, 0x13, 0x00, 0xbe, 0x36, 0xc9, 0x64, 0x3e, 0xfb, 0x5d, 0xb6, 0x3d,
+  0x3c, 0x85, 0xcb, 0x3d, 0x46, 0x0f, 0xdd, 0x3d, 0x0a, 0x0d, 0x8c, 0xbd,
+  0x33, 0x71, 0x95, 0x3d, 0xe6, 0xb8, 0xbb, 0x3d, 0x54, 0x22, 0x06, 0xbc,
+  0xfa, 0xe1, 0xd0, 0x3d, 0x0a, 0x70, 0xa5, 0x3b, 0x50, 0x32, 0xf8, 0x3c,
+  0xb4, 0x6d, 0xb2, 0x3d, 0x85, 0x9b, 0xe6, 0xbd, 0xb6, 0xf6, 0xa9, 0x3d,
+  0x78, 0xd7, 0x4e, 0x3d, 0x40, 0xe6, 0xd9, 0x3d, 0x13, 0xbb, 0x96, 0x3d,
+  0x99, 0xbb, 0x67, 0x3d, 0x54, 0xac, 0xfb, 0x3d, 0xc8, 0x31, 0x35, 0x3e,
+  0x94, 0xbb, 0x0d, 0x3d, 0x3a, 0x4a, 0x95, 0x3d, 0x77, 0x84, 0xee, 0x3c,
+  0x1f, 0x34, 0xf3, 0x3d, 0xe7, 0xd5, 0x81, 0x3d, 0xa7, 0x5d, 0x2f, 0x3d,
+  0x6a, 0x7f, 0x4b, 0x3d, 0xfe, 0x8d, 0x21, 0x3e, 0xfd, 0x53, 0x02, 0x3d,
+  0x17, 0x1f, 0xbe, 0x3c, 0x25, 0x61, 0x94, 0x3c, 0xd5, 0x61, 0x21, 0x3e,
+  0x42, 0xd7, 0x25, 0xbd, 0xda, 0xac, 0xfb, 0xbc, 0xd4, 0x58, 0x15, 0x3d,
+  0x5a, 0x5f, 0x88, 0x3d, 0x40, 0xfd, 0xba, 0xbd, 0x7c, 0xb0, 0x96, 0xba,
+  0xe5, 0x1e, 0x2b, 0xbd, 0x9a, 0x13, 0x29, 0x3e, 0x81, 0x2e, 0x5a, 0xbd,
+  0xcf, 0x53, 0x1a, 0xbd, 0x7a, 0x55, 0xd6, 0x3c, 0xfe, 0x7c, 0x7a, 0x3b,
+  0xec, 0xf4, 0x1a, 0xbd, 0x72, 0x4a, 0x71, 0x3d, 0x31, 0xbd, 0x87, 0xbd,
+  0x4b, 0xa5, 0x75, 0x3d, 0xc6, 0xc5, 0x85, 0xbd, 0xc5, 0x06, 0xd0, 0xbb,
+  0xb6, 0xda, 0x9b, 0x3d, 0x07, 0x5f, 0x63, 0x3d, 0x57, 0x5e, 0x89, 0x3d,
+  0x34, 0x0b, 0xf5, 0x3c, 0x5c, 0x28, 0x56, 0xbd, 0x1d, 0x10, 0x78, 0xbd,
+  0x88, 0xcd, 0x99, 0xbd, 0xb8, 0x50, 0x72, 0xbd, 0x8d, 0xb6, 0x15, 0xbd,
+  0x47, 0xb8, 0x61, 0xbd, 0x04, 0x7f, 0x17, 0x3d, 0x6a, 0x95, 0xf5, 0x3b,
+  0xf3, 0xbe, 0x25, 0x3b, 0xbf, 0x6a, 0xaa, 0xbc, 0x95, 0xa7, 0xd3, 0xbc,
+  0x5d, 0x50, 0x32, 0xbe, 0x62, 0xfc, 0xdc, 0xbd, 0x59, 0x25, 0x0d, 0xbe,
+  0x9e, 0x77, 0x2f, 0xbd, 0x11, 0x23, 0x0a, 0xbe, 0xcb, 0x9f, 0x24, 0xbe,
+  0x7f, 0x6e, 0x55, 0x3c, 0x0b, 0xa3, 0x45, 0xbe, 0xba, 0x6d, 0x02, 0xbe,
+  0xad, 0x02, 0x58, 0xbe, 0x90, 0x38, 0x09, 0xbe, 0xae, 0xcd, 0xb9, 0xbc,
+  0x42, 0x86, 0x20, 0xbe, 0x60, 0xdf, 0x42, 0xbe, 0x9a, 0x75, 0x8c, 0xbd,
+  0x50, 0x1a, 0x86, 0xbe, 0xd1, 0x8a, 0x28, 0xbd, 0xea, 0x16, 0xd8, 0xbd,
+  0xe2, 0x3f, 0x18, 0xbd, 0x35, 0xa3, 0xa7, 0xbb, 0xae, 0x41, 0x77, 0xbd,
+  0x7b, 0x12, 0x08, 0xbe, 0x9c, 0x1a, 0xa2, 0xbe, 0xaf, 0xd8, 0x9f, 0xbd,
+  0xce, 0x15, 0x6c, 0xbd, 0x23, 0xb3, 0xb0, 0x3c, 0xd6, 0x5a, 0x25, 0xbd,
+  0xf9, 0xc3, 0x8a, 0x3d, 0x26, 0x2b, 0x3c, 0xbc, 0x38, 0xe3, 0x17, 0xbc,
+  0xa4, 0x27, 0x96, 0xbe, 0xdd, 0x4e, 0x48, 0xbd, 0x39, 0x2d, 0xfd, 0x3d,
+  0x04, 0xbd, 0x48, 0x3d, 0xba, 0xfb, 0x1b, 0x3c, 0xc4, 0x46, 0x82, 0x3d,
+  0x9c, 0x17, 0x2e, 0x3d, 0xd0, 0x92, 0x2e, 0x3c, 0xbf, 0x33, 0x2e, 0x3c,
+  0x43, 0xa4, 0xb0, 0x3d, 0x2c, 0xb1, 0x21, 0x3e, 0x8f, 0xe0, 0x5b, 0x3d,
+  0x9d, 0xe4, 0xb6, 0x3d, 0xba, 0xcd, 0xcd, 0x3d, 0x60, 0xb6, 0xf3, 0x3d,
+  0x15, 0x2f, 0x18, 0x3e, 0x3b, 0x44, 0xd9, 0x3d, 0x59, 0xe2, 0xdc, 0x3d,
+  0x4b, 0x6b, 0x82, 0x3d, 0x5d, 0xb2, 0x16, 0x3d, 0x5d, 0xbd, 0x6c, 0x3d,
+  0x05, 0x5b, 0x44, 0x3e, 0x62, 0x5b, 0xfe, 0x3d, 0x6c, 0xd9, 0x3d, 0x3e,
+  0xab, 0xac, 0x87, 0x3e, 0x1a, 0xbb, 0xc5, 0x3d, 0x29, 0x68, 0xfc, 0x3d,
+  0x95, 0xd4, 0x27, 0x3c, 0x61, 0x70, 0xeb, 0x3d, 0x9d, 0xff, 0x2c, 0x3e,
+  0x3c, 0x70, 0xbb, 0x3d, 0x3c, 0x9e, 0x65, 0x3d, 0x59, 0x50, 0x5c, 0x3e,
+  0x0f, 0xbe, 0x2e, 0x3d, 0x7d, 0x1c, 0x57, 0x3d, 0x65, 0xa1, 0x6a, 0x3d,
+  0x25, 0x92, 0xca, 0x3d, 0x98, 0xf7, 0xb4, 0x3d, 0x27, 0x01, 0xae, 0x3c,
+  0xdd, 0x05, 0x42, 0xba, 0xb8, 0x42, 0x02, 0x3e, 0x5a, 0x2d, 0xa1, 0xbd,
+  0x63, 0x31, 0x50, 0xbc, 0xe2, 0xb9, 0x05, 0xbd, 0x72, 0xfd, 0x6a, 0x3d,
+  0xde, 0x8f, 0x17, 0xbd, 0x6c, 0x74, 0x0c, 0xbd, 0x4d, 0x7a, 0xa6, 0x3c,
+  0xe5, 0xdc, 0xff, 0x3c, 0xc7, 0x86, 0x7f, 0xbd, 0xff, 0xe7, 0xa0, 0xbd,
+  0xe4, 0x8d, 0xd7, 0xbd, 0xfe, 0xc8, 0x8b, 0x3c, 0xba, 0x76, 0x02, 0xbd,
+  0xfd, 0xec, 0x24, 0xbd, 0x88, 0x2d, 0xa2, 0xbd, 0x05, 0x54, 0x09, 0xbc,
+  0xf8, 0xe9, 0xc1, 0xbd, 0x2e, 0x6a, 0xf3, 0xbc, 0x14, 0x60, 0x1a, 0xbe,
+  0x55, 0xa3, 0x0a, 0xbc, 0x58, 0x46, 0x6c, 0x3d, 0x81, 0x47, 0xe8, 0xbd,
+  0x4e, 0xfc, 0x18, 0xbe, 0x59, 0x00, 0xc3, 0x3c, 0x3d, 0xbc, 0x0c, 0xbe,
+  0xcd, 0x79, 0xfa, 0xbd, 0xdb, 0xa7, 0x45, 0xbe, 0x65, 0x41, 0xb6, 0xbd,
+  0x0a, 0xec, 0x0e, 0x3d, 0x7d, 0x69, 0xd6, 0xbd, 0xbc, 0x4a, 0x10, 0xbe,
+  0xe5, 0x29, 0x15, 0x3d, 0x7e, 0x58, 0x6a, 0x3d, 0xc1, 0x44, 0xfb, 0xbc,
+  0x19, 0xf6, 0x99, 0xbd, 0xab, 0x0c, 0x7b, 0xbd, 0x3e, 0x75, 0x20, 0xbd,
+  0x30, 0x59, 0x80, 0xbd, 0x13, 0x1d, 0xb6, 0xbd, 0x62, 0xec, 0xb7, 0xbc,
+  0xff, 0x0a, 0xa2, 0xbd, 0x1a, 0x45, 0x2d, 0xbe, 0xce, 0x45, 0x41, 0xbe,
+  0x0d, 0x93, 0x45, 0xbe, 0x6e, 0xc9, 0x01, 0xbd, 0x60, 0xa6, 0x42, 0xbe,
+  0x39, 0x23, 0x55, 0xbe, 0x20, 0x4e, 0x47, 0x3d, 0xaa, 0x09, 0x75, 0xbe,
+  0x22, 0xd3, 0x79, 0xbe, 0xfd, 0xe0, 0x80, 0xbe, 0xe8, 0x90, 0xa2, 0xbe,
+  0x4c, 0xf2, 0x33, 0xbe, 0xef, 0x75, 0x6d, 0xbe, 0x4a, 0x2a, 0x84, 0xbe,
+  0x2a, 0x7b, 0x8e, 0xbc, 0x8b, 0x2a, 0x6c, 0xbe, 0x0c, 0x42, 0x8d, 0xbd,
+  0x8e, 0xfd, 0x91, 0xbd, 0x11, 0x20, 0xeb, 0xbd, 0x43, 0xe9, 0x6b, 0xbd,
+  0xd4, 0x94, 0xba, 0xbd, 0x7e, 0x1b, 0xb1, 0xbd, 0x4b, 0x34, 0x8c, 0xbd,
+  0x49, 0xac, 0x1e, 0xbe, 0xd1, 0x52, 0xe7, 0x3c, 0x8f, 0x18, 0x12, 0xbe,
+  0x5c, 0x1c, 0x85, 0xbd, 0xc5, 0xe4, 0xc8, 0x3d, 0x9b, 0x54, 0xc1, 0xbd,
+  0x98, 0x06, 0x56, 0xbd, 0x21, 0x51, 0x63, 0xbd, 0x91, 0xbf, 0xec, 0xbd,
+  0x92, 0xa9, 0x41, 0xbd, 0xc9, 0x27, 0xb3, 0xbd, 0x6f, 0xe2, 0x89, 0xbd,
+  0xf5, 0x95, 0xa2, 0x3d, 0x82, 0x8e, 0x96, 0xbd, 0xae, 0xd4, 0x98, 0x3a,
+  0x11, 0xa6, 0xea, 0xbb, 0x8f, 0x26, 0x96, 0xbd, 0x22, 0xe9, 0xe5, 0x3c,
+  0x80, 0x69, 0xea, 0xbc, 0x77, 0x0d, 0xb2, 0xbd, 0x6a, 0x93, 0xeb, 0x3d,
+  0xcf, 0xaf, 0x55, 0xbb, 0xa4, 0xe2, 0xd7, 0xbd, 0xd6, 0xae, 0xcc, 0xba,
+  0xb0, 0x32, 0x75, 0xbd, 0x56, 0xdc, 0x28, 0xbd, 0x17, 0x7d, 0x90, 0xbd,
+  0x50, 0x1d, 0x2d, 0xbc, 0xae, 0xf4, 0x23, 0x3d, 0x4a, 0xcc, 0xad, 0x3c,
+  0x1c, 0xef, 0xe5, 0xbb, 0xef, 0x69, 0x90, 0xbc, 0x37, 0x1e, 0x5c, 0xbd,
+  0xfa, 0xb9, 0x21, 0xbd, 0xc5, 0x58, 0x70, 0xbd, 0x12, 0x49, 0x10, 0xbd,
+  0x45, 0x58, 0xa0, 0x3d, 0xdb, 0x37, 0xdf, 0x3b, 0x95, 0x4a, 0xcc, 0xbc,
+  0xf2, 0xe7, 0xae, 0xba, 0x32, 0x68, 0xe6, 0xbc, 0x28, 0x24, 0xd6, 0xbd,
+  0xcb, 0xc5, 0x38, 0xbd, 0x75, 0x48, 0x38, 0x3d, 0x78, 0xdd, 0x8f, 0x3d,
+  0x10, 0xf4, 0x7f, 0x3c, 0x5a, 0x19, 0xa6, 0x3c, 0xc2, 0x87, 0xa1, 0xbc,
+  0x3b, 0x86, 0xeb, 0xb9, 0x2f, 0x05, 0x9e, 0xbd, 0xf8, 0xdc, 0x25, 0xbe,
+  0xfd, 0xb8, 0xe6, 0xbd, 0xe0, 0xd4, 0xaf, 0x3a, 0x46, 0x07, 0x99, 0xbd,
+  0x98, 0xc1, 0xbb, 0xbd, 0x6b, 0xff, 0xbe, 0xbc, 0x7f, 0xc1, 0x40, 0xbe,
+  0xc5, 0x24, 0x61, 0xbe, 0x1d, 0x1c, 0x23, 0xbe, 0x27, 0x1f, 0x0b, 0xbe,
+  0xa2, 0xa6, 0x00, 0xbd, 0xff, 0x06, 0x18, 0xbe, 0xb0, 0x7b, 0x66, 0xbe,
+  0x93, 0x09, 0x48, 0x3c, 0x7e, 0xfc, 0x1e, 0xbe, 0xaf, 0x62, 0x44, 0xbe,
+  0xdb, 0xe1, 0xc5, 0x3b, 0x70, 0xb8, 0x3c, 0xbe, 0xd1, 0x0f, 0xb1, 0x3c,
+  0xeb, 0xc4, 0x7b, 0xbd, 0xed, 0x27, 0xf9, 0xbd, 0x2a, 0xf5, 0xa2, 0x3d,
+  0xa2, 0x9b, 0x49, 0x3c, 0xc2, 0xc6, 0xa2, 0xbc, 0xb6, 0x35, 0xaf, 0x3b,
+  0x8c, 0x17, 0x3b, 0x3d, 0xe4, 0xf3, 0xab, 0xbb, 0x8a, 0x16, 0x37, 0x3d,
+  0xf9, 0x18, 0x82, 0x3c, 0x66, 0xad, 0xbd, 0x3b, 0xbb, 0xbb, 0x9c, 0x3d,
+  0x4a, 0xe0, 0x5a, 0xbd, 0x40, 0xfa, 0x53, 0xbd, 0x2a, 0x11, 0xb0, 0x3c,
+  0x7e, 0x4b, 0x40, 0x3c, 0x92, 0x06, 0xde, 0xbd, 0xe0, 0xdb, 0x43, 0xbd,
+  0xcf, 0xb6, 0x02, 0x3c, 0xb0, 0xa0, 0xee, 0xbd, 0xa9, 0x35, 0x45, 0xbe,
+  0xd0, 0xc4, 0x1c, 0xbe, 0x55, 0x27, 0x81, 0xbe, 0x4d, 0xc0, 0x56, 0xbd,
+  0xee, 0xff, 0x11, 0xbe, 0xdf, 0xec, 0x33, 0xbe, 0xa5, 0xcb, 0x13, 0x3b,
+  0x3a, 0xf9, 0x49, 0xbe, 0xb6, 0x83, 0x4b, 0xbe, 0xc2, 0x87, 0x86, 0xbe,
+  0xd3, 0x42, 0xa2, 0xbe, 0xa5, 0x4f, 0x48, 0xbd, 0x80, 0x1d, 0x1f, 0xbe,
+  0xba, 0x43, 0x57, 0xbe, 0xda, 0xd0, 0x6b, 0x3a, 0x03, 0xb6, 0x7a, 0xbe,
+  0x0a, 0xd3, 0x3e, 0xbe, 0x96, 0xb1, 0x2c, 0xbe, 0xb0, 0xd2, 0xaa, 0xbe,
+  0x9b, 0xe2, 0x36, 0xbe, 0x66, 0x0b, 0x7d, 0xbe, 0x8b, 0x72, 0x6b, 0xbe,
+  0x00, 0x09, 0x77, 0x3d, 0x89, 0xb2, 0x65, 0xbe, 0xe3, 0xe5, 0x06, 0xbe,
+  0x59, 0x5b, 0x15, 0xbe, 0x91, 0xaa, 0x01, 0xbe, 0xba, 0xfa, 0x1b, 0xbe,
+  0xfc, 0x09, 0x28, 0xbe, 0x8e, 0xe4, 0x46, 0xbe, 0x2a, 0x68, 0x8c, 0x3d,
+  0x0a, 0xe2, 0x87, 0xbe, 0x0a, 0xe3, 0xf1, 0xbd, 0x9e, 0xfa, 0x41, 0xbe,
+  0xc0, 0xa0, 0x02, 0xbe, 0x86, 0xe1, 0x02, 0xbe, 0xa1, 0x45, 0x8a, 0xbd,
+  0x73, 0x25, 0xd1, 0xbd, 0xb2, 0x20, 0xf2, 0x3c, 0x35, 0x09, 0x86, 0xbe,
+  0x2f, 0x32, 0xc2, 0xbd, 0x86, 0x35, 0xe8, 0xbd, 0xeb, 0xd9, 0xad, 0xbd,
+  0xc4, 0xd5, 0xfd, 0xbc, 0xee, 0x26, 0x1a, 0xbe, 0x5c, 0x9a, 0xdf, 0xbd,
+  0x10, 0xa7, 0x59, 0x3d, 0x82, 0x7a, 0xb9, 0xbd, 0x30, 0xce, 0x94, 0xbd,
+  0xd7, 0x76, 0xa9, 0xbd, 0x3f, 0x9c, 0xf5, 0xbd, 0x46, 0x32, 0xf8, 0xbc,
+  0x57, 0xc6, 0x3d, 0xbe, 0x7c, 0x09, 0xbb, 0xbd, 0x2c, 0xe0, 0x8e, 0x3d,
+  0x9c, 0x57, 0x8a, 0xbd, 0x2e, 0xf8, 0x23, 0xbe, 0x4d, 0x4c, 0xda, 0xbd,
+  0x35, 0xaa, 0x41, 0xbe, 0xff, 0x2c, 0xf2, 0xbc, 0x07, 0xbb, 0xcc, 0xbd,
+  0x60, 0xd6, 0x17, 0xbe, 0x48, 0x03, 0xe4, 0xbc, 0x0a, 0x83, 0x68, 0xbd,
+  0x26, 0xcc, 0x0f, 0xbe, 0x57, 0x51, 0xc0, 0xbd, 0x4a, 0xb8, 0x2b, 0xbe,
+  0x6e, 0x0a, 0x68, 0x3d, 0x4c, 0x69, 0x21, 0xbe, 0x36, 0x8a, 0x41, 0xbe,
+  0x74, 0x7e, 0x8d, 0x3d, 0x8c, 0xad, 0xb7, 0xbd, 0xf3, 0x3b, 0x8e, 0xbd,
+  0x62, 0x56, 0x05, 0xbd, 0xd7, 0x04, 0x16, 0xbe, 0xab, 0x34, 0x64, 0xbc,
+  0xc8, 0x03, 0x73, 0xbd, 0x73, 0x24, 0xfd, 0xbd, 0x14, 0xb9, 0x0d, 0x3d,
+  0x34, 0xf3, 0x11, 0x3d, 0x7e, 0x33, 0x01, 0x3c, 0xdd, 0xf5, 0x1f, 0xbd,
+  0xdf, 0x2a, 0x41, 0x3c, 0x69, 0xc7, 0x38, 0x3d, 0xad, 0x49, 0x82, 0xbb,
+  0xe1, 0x23, 0x4f, 0xbd, 0x2d, 0x38, 0xbd, 0x3d, 0x30, 0x01, 0x88, 0x3d,
+  0xb9, 0xbc, 0x06, 0x3d, 0x26, 0x50, 0xc5, 0xba, 0xb2, 0xf2, 0x9a, 0x3d,
+  0x23, 0x81, 0x2e, 0x3e, 0xcf, 0xe1, 0x2c, 0x3d, 0x4e, 0x97, 0xa2, 0x3c,
+  0x46, 0x3a, 0x02, 0x3e, 0x1f, 0x5e, 0x81, 0xbd, 0x43, 0xa8, 0x00, 0xbc,
+  0xa2, 0xe9, 0x85, 0x3c, 0xeb, 0x19, 0x25, 0xbc, 0x4a, 0xe7, 0xb0, 0x3d,
+  0x84, 0xf4, 0x88, 0x3d, 0x50, 0xdb, 0xb0, 0xbc, 0x5b, 0x12, 0x92, 0x3d,
+  0xc9, 0xc1, 0xdc, 0xbd, 0xb0, 0x48, 0x8f, 0xbd, 0xe9, 0x6a, 0xc7, 0x3c,
+  0x6b, 0xf8, 0x74, 0xbc, 0x97, 0xbd, 0xf3, 0x3d, 0x93, 0x7d, 0x01, 0x3e,
+  0x5b, 0x8e, 0x82, 0x3c, 0x3b, 0xb6, 0xaa, 0x3b, 0x07, 0x39, 0xef, 0xbd,
+  0x6f, 0x80, 0xd6, 0xbd, 0x26, 0x12, 0x0c, 0xbe, 0xd8, 0x44, 0x9a, 0x3d,
+  0x8c, 0xa5, 0x14, 0x3e, 0x3b, 0x6e, 0x34, 0x3d, 0x6e, 0xe2, 0x31, 0xbe,
+  0x0b, 0xd7, 0x47, 0x3d, 0x00, 0xc8, 0x73, 0xbe, 0xfc, 0x87, 0x85, 0xbe,
+  0xe2, 0x9b, 0x4b, 0xbe, 0xaf, 0x40, 0xa9, 0xbc, 0x00, 0xe5, 0x9b, 0x3d,
+  0xec, 0x64, 0x19, 0xbe, 0x73, 0x55, 0x0d, 0xbe, 0x14, 0xb9, 0x60, 0xbb,
+  0xf6, 0xcb, 0x88, 0xbe, 0x80, 0xdf, 0x64, 0xbe, 0xa1, 0x4c, 0x38, 0xbe,
+  0x66, 0x09, 0x0b, 0xbd, 0x65, 0x8d, 0x1d, 0x3e, 0x3e, 0x20, 0x19, 0xbe,
+  0xa7, 0xe5, 0x3b, 0xbe, 0x95, 0x0e, 0xe6, 0x3c, 0x90, 0x00, 0x23, 0xbe,
+  0xf7, 0xb1, 0x5a, 0xbe, 0xac, 0x7f, 0x6e, 0xbe, 0x8d, 0xc0, 0xf8, 0xbd,
+  0x0e, 0x11, 0x11, 0x3e, 0x34, 0x6f, 0x1d, 0xbe, 0x3c, 0x03, 0x56, 0xbe,
+  0x3d, 0x82, 0x3d, 0x3c, 0x7e, 0x88, 0x2f, 0xbe, 0x5c, 0xe0, 0x2a, 0xbe,
+  0xe3, 0xb5, 0xc6, 0xbd, 0xce, 0x4f, 0xfa, 0xbb, 0x6f, 0x58, 0x06, 0x3e,
+  0x82, 0x24, 0x08, 0xbe, 0x50, 0xbf, 0x37, 0xbe, 0x9d, 0x3e, 0x31, 0xbc,
+  0x54, 0x58, 0x1c, 0xbe, 0x15, 0x43, 0x45, 0xbe, 0xd3, 0x99, 0xc4, 0xbd,
+  0x30, 0x50, 0x1c, 0xbd, 0x4d, 0x02, 0x69, 0x3d, 0x62, 0xf2, 0xda, 0xbd,
+  0x5b, 0x3d, 0xee, 0xbd, 0x7f, 0x6b, 0xff, 0x3d, 0xbd, 0x4c, 0x86, 0xbd,
+  0x59, 0x37, 0x23, 0xbd, 0x9b, 0xae, 0x19, 0xbe, 0x8d, 0x26, 0x84, 0xbc,
+  0x57, 0xe5, 0xe3, 0x3d, 0x4f, 0x72, 0x4f, 0x3c, 0x8a, 0x7b, 0x9a, 0xbd,
+  0xfb, 0x2e, 0x93, 0x3d, 0xdf, 0xbe, 0x40, 0x3c, 0xf7, 0x8b, 0x11, 0xbc,
+  0xab, 0x4b, 0x8d, 0xbd, 0xff, 0x87, 0x2c, 0x3d, 0xb4, 0x53, 0x28, 0x3d,
+  0x86, 0x72, 0x14, 0x3d, 0xed, 0x6c, 0xa1, 0xbd, 0x34, 0xac, 0x06, 0x3e,
+  0x19, 0x15, 0x84, 0x3b, 0x2f, 0x44, 0x9e, 0x3c, 0x19, 0xb6, 0xf1, 0xbc,
+  0xc9, 0x32, 0x08, 0x3d, 0x65, 0xc7, 0x23, 0x3e, 0xf2, 0x48, 0xfa, 0x3d,
+  0x08, 0x7b, 0x18, 0xbd, 0x07, 0x07, 0xe9, 0x3d, 0xa0, 0x87, 0x56, 0x3b,
+  0xc9, 0x92, 0x17, 0xbc, 0xbd, 0x05, 0x22, 0xbd, 0x7a, 0x58, 0xb2, 0x3d,
+  0xbc, 0x76, 0x35, 0x3e, 0x97, 0x4f, 0x78, 0x3d, 0x5b, 0x44, 0x64, 0xb8,
+  0xbf, 0x12, 0x54, 0x3d, 0x89, 0xe8, 0x81, 0xbb, 0xfe, 0x2c, 0x8a, 0x3d,
+  0x9a, 0x57, 0x60, 0xbc, 0x7f, 0xbe, 0x84, 0x3c, 0xdc, 0xb2, 0x83, 0x3d,
+  0x35, 0xb4, 0x90, 0x3d, 0xff, 0x84, 0xb3, 0x3c, 0x64, 0x4c, 0xe1, 0x3d,
+  0x14, 0xf6, 0x6f, 0x3c, 0xaa, 0x14, 0x6d, 0xbd, 0xe8, 0x7a, 0x98, 0xbd,
+  0x6f, 0xe1, 0x91, 0xbb, 0x4b, 0x4d, 0x16, 0x3e, 0x42, 0xfc, 0x1d, 0xbd,
+  0xf1, 0xdb, 0x0d, 0xbe, 0xb4, 0xec, 0xdf, 0x3d, 0xab, 0xcd, 0xa8, 0x3d,
+  0x8e, 0x72, 0x3f, 0xbd, 0x90, 0x8f, 0x1a, 0xbd, 0xab, 0x18, 0x05, 0xbb,
+  0x1d, 0xbf, 0x03, 0x3e, 0xc5, 0x7a, 0x33, 0xbe, 0x5a, 0x06, 0xc1, 0xbd,
+  0xf9, 0x06, 0xc6, 0x3d, 0xe6, 0xda, 0x02, 0x3c, 0x6c, 0x01, 0xaa, 0xbd,
+  0x84, 0x2d, 0x78, 0xbd, 0x22, 0x72, 0xb2, 0xbd, 0x80, 0x18, 0x11, 0x3e,
+  0x73, 0x20, 0x7c, 0xbe, 0xf9, 0xe5, 0x1d, 0xbe, 0xe8, 0xa5, 0x89, 0xbd,
+  0xdc, 0x17, 0x20, 0xbe, 0x31, 0xcb, 0x29, 0xbe, 0x0f, 0x2d, 0xbe, 0xbc,
+  0xd4, 0x25, 0x1f, 0xbe, 0x0d, 0xcf, 0x9e, 0x3d, 0xb0, 0x9d, 0xc5, 0xbe,
+  0x19, 0x55, 0x72, 0xbe, 0xa7, 0x42, 0x6a, 0x3c, 0x9e, 0x02, 0x2c, 0xbe,
+  0x89, 0xf1, 0x12, 0xbe, 0x72, 0x51, 0xf0, 0xbd, 0x74, 0x57, 0x4e, 0xbe,
+  0x66, 0x4b, 0x86, 0x3d, 0xc3, 0xad, 0x9b, 0xbe, 0x9d, 0x79, 0x56, 0xbe,
+  0x39, 0xdc, 0x86, 0xbd, 0xd6, 0x29, 0x96, 0xbd, 0xd6, 0x14, 0xfc, 0xbd,
+  0x8c, 0xac, 0x11, 0xbe, 0xe4, 0xd2, 0x9c, 0xbe, 0xe5, 0xc1, 0x4b, 0x3d,
+  0x21, 0x77, 0x5b, 0xbe, 0x67, 0x23, 0x04, 0xbe, 0x46, 0x80, 0x35, 0xbd,
+  0x16, 0x57, 0xa4, 0xbd, 0x24, 0xff, 0x36, 0xbd, 0x6b, 0x50, 0x4d, 0xbc,
+  0x3e, 0x9e, 0x73, 0xbe, 0x07, 0x51, 0x24, 0x3d, 0x58, 0x81, 0x6d, 0xbe,
+  0xd7, 0xe9, 0xe3, 0xbd, 0xa3, 0x4a, 0x09, 0xbe, 0x61, 0xc7, 0x95, 0xbe,
+  0xd8, 0xce, 0xfe, 0xbd, 0xa7, 0x50, 0xff, 0xbc, 0x12, 0x48, 0x11, 0xbe,
+  0xfb, 0x02, 0x4d, 0x3d, 0xb5, 0xa7, 0x4c, 0xbe, 0xec, 0x27, 0xaa, 0xbe,
+  0xe2, 0x8f, 0x11, 0xbe, 0xbf, 0x7d, 0xbf, 0xbe, 0x8b, 0xc3, 0x42, 0xbe,
+  0x62, 0xa3, 0x32, 0xbe, 0xaf, 0x77, 0xcd, 0xbd, 0xe5, 0xb2, 0x0d, 0x3e,
+  0xf8, 0x51, 0x93, 0xbe, 0x92, 0x6d, 0xc4, 0xbe, 0x2d, 0xc0, 0xca, 0xbd,
+  0x36, 0x4a, 0x48, 0xbe, 0x79, 0x32, 0x6d, 0xbe, 0x03, 0xc0, 0x92, 0xbe,
+  0x8d, 0xd4, 0xd2, 0xbd, 0x59, 0x40, 0xe1, 0x3d, 0x3b, 0xab, 0x87, 0xbe,
+  0x41, 0xb4, 0xef, 0xbd, 0xd2, 0x18, 0x0a, 0x3d, 0x9d, 0xf4, 0x6f, 0xbe,
+  0x00, 0xb2, 0x58, 0xbe, 0x1a, 0x99, 0x67, 0xbe, 0x74, 0x4b, 0xd1, 0xbd,
+  0xab, 0xff, 0xe0, 0x3d, 0xbb, 0x6f, 0x1c, 0xbe, 0x01, 0x39, 0x38, 0xbe,
+  0x8a, 0x67, 0x54, 0x3d, 0x0b, 0xcf, 0x2b, 0xbd, 0xf3, 0xfc, 0x38, 0xbe,
+  0xfb, 0xc2, 0x14, 0xbe, 0x6f, 0x43, 0x97, 0xbd, 0xbc, 0x4c, 0xb7, 0x3d,
+  0xbc, 0x15, 0x6b, 0xbc, 0x12, 0xfb, 0xb4, 0xbd, 0x19, 0x9e, 0xb7, 0x3d,
+  0xd7, 0x51, 0x0a, 0x3d, 0x5d, 0xe0, 0xfc, 0x3d, 0x41, 0x17, 0x96, 0x3d,
+  0xa1, 0xb0, 0xd6, 0xbc, 0x61, 0xd5, 0x27, 0x3e, 0x89, 0x10, 0x7b, 0x3d,
+  0x9a, 0xe0, 0xd1, 0x3d, 0x44, 0xc9, 0x91, 0x3d, 0x35, 0xe5, 0xea, 0xbc,
+  0x48, 0xa2, 0x09, 0x3d, 0xb3, 0x76, 0x89, 0xbc, 0xea, 0x9e, 0xab, 0x3d,
+  0xe5, 0x2f, 0x07, 0x3e, 0x50, 0x94, 0x25, 0x3d, 0x86, 0xfa, 0xd6, 0xbc,
+  0xe5, 0x4f, 0xe1, 0x3d, 0x12, 0x34, 0x14, 0x3e, 0x38, 0x20, 0x21, 0xbd,
+  0x52, 0x5c, 0xc7, 0x3b, 0x41, 0xda, 0xeb, 0x3d, 0xe6, 0x33, 0x23, 0x3e,
+  0x30, 0xf0, 0x87, 0xbb, 0xd1, 0xf2, 0x53, 0x3c, 0xf4, 0x0c, 0x78, 0x3d,
+  0x9e, 0xe3, 0x17, 0x3e, 0x22, 0x41, 0x6b, 0x3d, 0xde, 0x74, 0xea, 0xbc,
+  0x33, 0xb8, 0x7c, 0x3d, 0xdc, 0x4a, 0x82, 0x3e, 0x61, 0x41, 0xe9, 0x3c,
+  0x26, 0x5a, 0x87, 0xbb, 0x1e, 0x67, 0x1d, 0x3e, 0x5f, 0xf8, 0xd8, 0x3d,
+  0xd3, 0x31, 0x5c, 0xbd, 0x89, 0x4f, 0x9a, 0x3b, 0x94, 0x15, 0xa8, 0x3d,
+  0xde, 0x12, 0x68, 0x3e, 0x1f, 0xd5, 0x6f, 0xbc, 0x30, 0x58, 0x9a, 0x3d,
+  0x5c, 0x4e, 0x96, 0x3d, 0x8c, 0x0f, 0x55, 0x3d, 0xe5, 0x02, 0x9d, 0xbd,
+  0x7b, 0x11, 0xe3, 0x3b, 0xc0, 0x42, 0x00, 0x3d, 0x93, 0x49, 0x51, 0x3e,
+  0x58, 0xee, 0x25, 0x3c, 0xe4, 0x4f, 0x11, 0x3d, 0xa3, 0x28, 0x13, 0x3c,
+  0x8f, 0x4b, 0x20, 0xbd, 0xfb, 0x13, 0x97, 0xbd, 0xb2, 0xd6, 0xff, 0xbc,
+  0x58, 0x85, 0xed, 0x3b, 0x19, 0x21, 0x4d, 0x3e, 0x3b, 0x7b, 0xa0, 0xbd,
+  0x17, 0x42, 0xe7, 0xbb, 0xd3, 0x59, 0x3c, 0x3d, 0x38, 0xe0, 0x90, 0xbd,
+  0x2b, 0xa8, 0xdd, 0xbd, 0x2d, 0x95, 0xc2, 0xbd, 0x2c, 0x13, 0x1f, 0xbd,
+  0xf1, 0xb7, 0x27, 0x3e, 0x26, 0x51, 0x6e, 0xbd, 0xd9, 0xe0, 0x86, 0xbd,
+  0x76, 0xdb, 0xf2, 0x3d, 0xa3, 0x52, 0xaa, 0xbd, 0x40, 0x39, 0x8c, 0xbc,
+  0xa6, 0x0f, 0x95, 0xbc, 0x06, 0x58, 0xee, 0xbd, 0x30, 0x1f, 0x27, 0x3d,
+  0x81, 0x28, 0xe2, 0xbd, 0x82, 0xcf, 0x4a, 0xbd, 0x5d, 0x1a, 0xc3, 0x3d,
+  0x95, 0xac, 0x2f, 0xbd, 0x64, 0xce, 0x19, 0xbe, 0xf3, 0xd6, 0xd3, 0xbc,
+  0x57, 0x3c, 0x27, 0xbe, 0x77, 0x13, 0x10, 0x3e, 0xca, 0xb3, 0x2b, 0xbe,
+  0xf9, 0x7c, 0xd2, 0xbd, 0x02, 0xbc, 0x9c, 0xbc, 0x97, 0x65, 0x25, 0xbe,
+  0x21, 0x54, 0x9e, 0xbd, 0xe3, 0x23, 0x1e, 0xbd, 0x29, 0xe7, 0xa4, 0xbe,
+  0xa1, 0xeb, 0x6d, 0x3d, 0x52, 0xe7, 0x33, 0xbe, 0x25, 0x27, 0xfb, 0xbd,
+  0x92, 0x81, 0x18, 0x3d, 0xc3, 0x6f, 0x7b, 0xbe, 0x14, 0xd6, 0x2c, 0xbe,
+  0xa6, 0xe6, 0xc7, 0xbd, 0xf6, 0x50, 0x73, 0xbe, 0x9a, 0xdc, 0x39, 0x3e,
+  0xbd, 0x3a, 0x22, 0xbe, 0x91, 0xf2, 0x54, 0xbe, 0x36, 0x27, 0x82, 0x3c,
+  0x1a, 0x10, 0x7d, 0xbe, 0x93, 0x50, 0x23, 0xbe, 0xa7, 0x68, 0x09, 0xbe,
+  0x6c, 0xa3, 0x4f, 0xbe, 0x6a, 0x35, 0x19, 0x3e, 0x3f, 0x63, 0x46, 0xbe,
+  0x8d, 0xcb, 0x85, 0xbe, 0x7b, 0x42, 0x12, 0x3e, 0xa0, 0x8e, 0x69, 0x3d,
+  0x24, 0xbf, 0x31, 0x3d, 0x61, 0xa8, 0x18, 0x3e, 0xb7, 0x76, 0xd4, 0x3d,
+  0x50, 0xef, 0xed, 0x3d, 0x0c, 0xb2, 0xe3, 0x3d, 0x46, 0x04, 0x18, 0x3e,
+  0x04, 0x18, 0x89, 0x3d, 0x84, 0x80, 0x52, 0x3d, 0x6b, 0x64, 0xd1, 0x3d,
+  0x49, 0xfc, 0x4b, 0xbd, 0x8f, 0x97, 0x99, 0x3d, 0x00, 0x59, 0x46, 0x3e,
+  0x29, 0xf7, 0xe8, 0xbb, 0x3c, 0xdd, 0x86, 0x3b, 0x3a, 0x0c, 0xe7, 0x3d,
+  0xbe, 0xc2, 0x8c, 0x3d, 0x79, 0x0c, 0x53, 0x3c, 0x54, 0xcc, 0x2b, 0x3d,
+  0xd1, 0x45, 0xd8, 0xbc, 0xc1, 0xa0, 0x44, 0x3e, 0x8f, 0x87, 0xd6, 0x3b,
+  0x62, 0x7d, 0x6b, 0x3c, 0xdb, 0x7b, 0x1f, 0x3d, 0x2e, 0x59, 0x8b, 0x3d,
+  0x8d, 0xdc, 0xd7, 0xbc, 0x95, 0xc6, 0x8f, 0x3d, 0xcf, 0x3d, 0x2b, 0x3c,
+  0x73, 0x87, 0x33, 0x3e, 0x71, 0xf5, 0xe2, 0x3c, 0x73, 0xc8, 0xcf, 0x3d,
+  0x0e, 0x21, 0x81, 0x3d, 0x35, 0x2d, 0x43, 0x3e, 0xf0, 0xd3, 0xf2, 0x3d,
+  0x69, 0xf8, 0xf0, 0xbc, 0x4d, 0xbd, 0x00, 0x3d, 0x6a, 0x68, 0x8a, 0x3e,
+  0xea, 0xa9, 0xad, 0x3c, 0xde, 0x6f, 0xba, 0x3d, 0x01, 0x50, 0x27, 0x3d,
+  0x71, 0x25, 0x24, 0x3e, 0x55, 0xc5, 0x76, 0x3d, 0x8d, 0x8b, 0xc0, 0xbc,
+  0x13, 0xec, 0xdb, 0xbc, 0x7c, 0x8c, 0x09, 0x3e, 0xb0, 0xa5, 0x2f, 0xbc,
+  0x8f, 0x7d, 0x9c, 0x3c, 0xb9, 0xe8, 0xbf, 0x3d, 0x2b, 0xed, 0xc2, 0x3c,
+  0x72, 0x86, 0xf5, 0xbb, 0xb4, 0x0a, 0x5c, 0xbd, 0x22, 0xad, 0x0d, 0xbc,
+  0x56, 0xe1, 0x2b, 0x3e, 0x0f, 0x34, 0x68, 0xbc, 0x47, 0xdd, 0x8e, 0x3d,
+  0x4b, 0xa2, 0xbd, 0x3d, 0x8b, 0x68, 0xb5, 0x3b, 0x23, 0xa8, 0x48, 0xbd,
+  0x19, 0x51, 0x9a, 0x3d, 0xdb, 0x7e, 0x28, 0x3d, 0x3c, 0xca, 0x06, 0x3d,
+  0xc6, 0x3e, 0x28, 0x3d, 0xd8, 0xb9, 0xb3, 0x3d, 0xf9, 0x05, 0x88, 0x3d,
+  0xa8, 0x66, 0x05, 0x3e, 0xf0, 0xc5, 0x04, 0x3d, 0xc2, 0xac, 0x07, 0x3c,
+  0x00, 0xa2, 0xc2, 0xbc, 0x9b, 0x2b, 0x8d, 0xbd, 0xa6, 0x5f, 0x45, 0x3d,
+  0x23, 0x7f, 0xf0, 0x3c, 0x3d, 0x91, 0x81, 0x3d, 0xbe, 0x3e, 0xd4, 0xbc,
+  0x9c, 0x85, 0x67, 0x3c, 0x7c, 0x72, 0xb4, 0x3c, 0x73, 0x91, 0x51, 0xbd,
+  0x7f, 0x61, 0xad, 0xbd, 0xab, 0x3a, 0x24, 0xbd, 0x4c, 0x20, 0x47, 0x3d,
+  0xc3, 0xbf, 0xf8, 0x3c, 0x5e, 0x9c, 0x52, 0xbc, 0xb4, 0x05, 0x6e, 0x3c,
+  0x17, 0xcd, 0x86, 0x3d, 0x50, 0x47, 0x35, 0xbd, 0x3b, 0x5b, 0xa4, 0x3d,
+  0x4e, 0x46, 0x89, 0xbc, 0xda, 0x40, 0x34, 0x3d, 0xda, 0xb1, 0x9b, 0x3d,
+  0x58, 0x25, 0x04, 0xbe, 0x9c, 0xfd, 0xc8, 0xbd, 0x07, 0xe4, 0x28, 0x3c,
+  0x74, 0x83, 0xe3, 0xbd, 0xc7, 0x4a, 0x39, 0x3d, 0x46, 0x0c, 0xd2, 0xbc,
+  0xb0, 0x94, 0x1b, 0xbe, 0xfb, 0xb0, 0x81, 0xbd, 0x34, 0xd6, 0x7b, 0xbe,
+  0xb8, 0x81, 0x8c, 0xbe, 0x44, 0x54, 0x76, 0xbe, 0xde, 0xff, 0x71, 0xbe,
+  0x74, 0x35, 0xc7, 0x3d, 0xfe, 0xc8, 0x84, 0xbe, 0xf3, 0xcf, 0x97, 0xbe,
+  0xe5, 0xc7, 0x3d, 0x3e, 0x2d, 0x3a, 0x33, 0x3e, 0x24, 0xe9, 0xba, 0x3d,
+  0x21, 0x22, 0xac, 0x3d, 0xa9, 0xa8, 0xd5, 0x3d, 0x19, 0xe2, 0x99, 0x3d,
+  0xe7, 0x51, 0x41, 0x3e, 0x27, 0xb4, 0xcf, 0x3d, 0xf7, 0xff, 0xba, 0x3d,
+  0x57, 0x59, 0x1d, 0x3e, 0xa8, 0x4b, 0x62, 0x3b, 0xde, 0x62, 0x16, 0xbd,
+  0x23, 0x1a, 0x83, 0x3d, 0xca, 0x2b, 0xd5, 0x3d, 0x74, 0xf6, 0x38, 0x3d,
+  0x66, 0xf9, 0x35, 0x3d, 0xa9, 0x33, 0xd3, 0x3c, 0xa8, 0xf5, 0x3d, 0x3d,
+  0xa3, 0x95, 0x9a, 0x3d, 0xf8, 0xcd, 0xfc, 0xbd, 0x3f, 0x64, 0x93, 0xbb,
+  0x57, 0x52, 0x6e, 0x3e, 0x7d, 0x67, 0x9b, 0xbd, 0x58, 0x2d, 0x9f, 0x3b,
+  0x12, 0x40, 0xc8, 0x3c, 0xd2, 0x2c, 0xeb, 0x3d, 0x3a, 0x39, 0x3c, 0xbb,
+  0x6e, 0x72, 0x90, 0xbd, 0x06, 0x38, 0x08, 0x3d, 0xa7, 0x8b, 0x7a, 0x3e,
+  0x1a, 0x08, 0x7b, 0xbd, 0x9e, 0x70, 0xb3, 0xb9, 0xe0, 0x1a, 0x40, 0xbd,
+  0x2b, 0x21, 0x4e, 0x3d, 0x1c, 0xf9, 0xe7, 0x3c, 0x1e, 0x11, 0x24, 0x3d,
+  0xb2, 0x99, 0x1a, 0xbc, 0xb2, 0x88, 0x61, 0x3e, 0xb6, 0xeb, 0xd2, 0x3c,
+  0x88, 0x2b, 0x1d, 0xbc, 0xdd, 0x7a, 0x35, 0xbd, 0xd7, 0x68, 0x86, 0x3d,
+  0x0c, 0x28, 0x87, 0x3c, 0x4f, 0x9e, 0x99, 0xbd, 0xa9, 0x78, 0x3d, 0xbc,
+  0x30, 0x46, 0x24, 0x3e, 0x2d, 0xb1, 0x94, 0xbd, 0xa7, 0xf6, 0x88, 0x3d,
+  0x73, 0xc4, 0x3e, 0x3d, 0xec, 0x77, 0x00, 0x3d, 0x10, 0xa3, 0xcc, 0x3d,
+  0x68, 0xbb, 0xa4, 0xbb, 0x3b, 0x55, 0x8c, 0x3d, 0x7e, 0x94, 0xe1, 0x3d,
+  0x08, 0x94, 0x6d, 0xbd, 0xd2, 0x0e, 0xc8, 0x3d, 0xda, 0x7e, 0xfe, 0x3c,
+  0x0a, 0x38, 0x0e, 0x3e, 0x83, 0x97, 0x37, 0x3e, 0x23, 0x49, 0xdf, 0x3d,
+  0xae, 0xf5, 0xf7, 0x3d, 0xf9, 0xdb, 0x00, 0xbd, 0x6a, 0x7a, 0xf3, 0x3d,
+  0x12, 0xab, 0x1e, 0x3e, 0xfc, 0x89, 0x17, 0x3d, 0x81, 0xfe, 0x94, 0x3d,
+  0x6c, 0x65, 0xb1, 0x3d, 0x4c, 0x77, 0xf1, 0x3d, 0x9d, 0x84, 0x09, 0x3e,
+  0x89, 0x7e, 0x4b, 0xbe, 0xa7, 0x8d, 0x03, 0x3e, 0xbb, 0x00, 0xc8, 0x3d,
+  0x80, 0x40, 0x84, 0xbd, 0xbc, 0xa2, 0x97, 0x3c, 0x53, 0x21, 0x4b, 0x3c,
+  0xc0, 0xc8, 0xcd, 0x3d, 0x06, 0x71, 0x0b, 0xbd, 0xa4, 0xca, 0x78, 0xbe,
+  0xe9, 0xbc, 0x3d, 0x3c, 0x47, 0x9e, 0x9a, 0x3d, 0xd4, 0xaa, 0x60, 0xbc,
+  0x0b, 0xf9, 0x15, 0xbd, 0x1f, 0x45, 0xe4, 0xbc, 0x65, 0x1c, 0xe4, 0x3d,
+  0x66, 0x87, 0xc5, 0xbb, 0xc8, 0x04, 0x20, 0xbe, 0xe5, 0x38, 0x02, 0xbc,
+  0xee, 0xd9, 0x88, 0x3d, 0xd9, 0x47, 0xe5, 0xbc, 0x63, 0x4a, 0x3b, 0xbd,
+  0xb3, 0xc8, 0x0c, 0xbd, 0x29, 0x51, 0xc8, 0xbc, 0x31, 0x26, 0xe8, 0x3c,
+  0x0b, 0x1c, 0xd3, 0x3d, 0xea, 0x06, 0x8b, 0xbd, 0x51, 0x6b, 0x3c, 0xbd,
+  0x4e, 0x0c, 0x23, 0x3c, 0x3b, 0xd8, 0x5e, 0xbe, 0x49, 0x7f, 0x7e, 0xbe,
+  0x67, 0x07, 0x7e, 0xbe, 0xcf, 0x78, 0x56, 0xbe, 0x13, 0x01, 0x10, 0x3e,
+  0xb3, 0x9d, 0x72, 0xbe, 0x39, 0xa3, 0x31, 0xbe, 0x25, 0x21, 0xd7, 0x3d,
+  0x71, 0xee, 0x6b, 0x3e, 0xbb, 0x97, 0xe4, 0x3d, 0xb6, 0xb6, 0xd0, 0x3d,
+  0x47, 0xcc, 0xb3, 0x3d, 0x04, 0xf2, 0x1f, 0x3e, 0x78, 0x88, 0xcd, 0x3d,
+  0x2c, 0xb7, 0x3f, 0x3e, 0xd3, 0x92, 0xe7, 0x3d, 0x34, 0x4a, 0x2a, 0x3d,
+  0xdb, 0x8b, 0x73, 0x3d, 0xe5, 0x52, 0xb8, 0xbb, 0x3f, 0x1b, 0x8e, 0x3d,
+  0x76, 0x95, 0xc1, 0x3d, 0xee, 0xd9, 0xd3, 0x3d, 0xbf, 0x92, 0xb1, 0x3d,
+  0x9a, 0x87, 0x0c, 0x3d, 0xa7, 0xd1, 0xe7, 0x3b, 0x8d, 0x62, 0xeb, 0x3c,
+  0xf1, 0x88, 0xae, 0xbc, 0xb6, 0x4a, 0x5a, 0xbd, 0x5d, 0xc6, 0x21, 0x3e,
+  0x9e, 0x92, 0x5d, 0xbd, 0xb0, 0x82, 0x2d, 0x3c, 0x37, 0xb5, 0x0e, 0x3e,
+  0xa9, 0x95, 0x46, 0xbd, 0x7b, 0x90, 0x34, 0x3d, 0x98, 0xba, 0xd5, 0xbc,
+  0xe8, 0x7a, 0x92, 0xbd, 0x7e, 0x78, 0xbe, 0x3d, 0x91, 0xcc, 0xde, 0xbb,
+  0x05, 0x6e, 0xb4, 0xbc, 0xe4, 0x01, 0xbf, 0xbd, 0x15, 0xc4, 0xd8, 0xbd,
+  0x37, 0xaf, 0xa1, 0x3d, 0xb9, 0xa2, 0xad, 0xbd, 0xb0, 0x1b, 0x51, 0x3d,
+  0xb2, 0x9c, 0x26, 0x3d, 0x00, 0xdb, 0x30, 0xbd, 0xc5, 0x26, 0x39, 0x3d,
+  0xe9, 0x0d, 0xbf, 0xbe, 0x89, 0xa1, 0x81, 0xbe, 0x4d, 0xc7, 0x2f, 0xbd,
+  0xb2, 0x59, 0x86, 0xbd, 0x48, 0x5d, 0x89, 0x3d, 0x97, 0x50, 0xdd, 0x3d,
+  0x19, 0x85, 0xe2, 0xbd, 0x34, 0x7e, 0xd0, 0xbd, 0xfe, 0xd4, 0xe4, 0xbe,
+  0x58, 0xcb, 0x8b, 0xbd, 0x88, 0x0a, 0x8b, 0x3d, 0x16, 0xde, 0x07, 0xbe,
+  0x8c, 0x72, 0x9e, 0xbb, 0xbd, 0xa1, 0x0e, 0x3e, 0xf2, 0xf8, 0x10, 0xbd,
+  0xab, 0x47, 0x7c, 0xbc, 0xfd, 0xbd, 0x2a, 0xbe, 0x95, 0x06, 0x92, 0x3d,
+  0x63, 0x06, 0xe9, 0x3d, 0x7b, 0x2c, 0x19, 0x3e, 0x34, 0x23, 0x1b, 0x3e,
+  0xf5, 0x44, 0x36, 0xbd, 0x6e, 0xbc, 0x07, 0x3e, 0x33, 0x84, 0x5c, 0x3e,
+  0xc8, 0x0c, 0x0e, 0xbe, 0xbd, 0xfa, 0x18, 0x3d, 0x18, 0x3f, 0x0e, 0x3e,
+  0x49, 0x7b, 0x18, 0x3e, 0x66, 0x07, 0x60, 0x3e, 0x46, 0xc0, 0x47, 0xbd,
+  0x19, 0x41, 0xec, 0x3d, 0xbc, 0x59, 0xc8, 0x3d, 0x76, 0xea, 0xdb, 0xbd,
+  0xc1, 0xd9, 0xc0, 0x3c, 0xd0, 0xe0, 0x9e, 0x3d, 0x6b, 0x20, 0x74, 0x3d,
+  0xc5, 0x88, 0x06, 0x3e, 0x71, 0x01, 0x40, 0xbd, 0x52, 0x8c, 0x88, 0x3c,
+  0x38, 0x39, 0x93, 0x3d, 0xcc, 0x74, 0x9f, 0xbd, 0x7b, 0xbb, 0xfb, 0xbc,
+  0x25, 0x2d, 0x28, 0x3d, 0xad, 0x6a, 0x87, 0x3d, 0x67, 0x73, 0xa0, 0x3d,
+  0xfe, 0x74, 0x83, 0x3c, 0xe5, 0xfd, 0x68, 0xbd, 0x87, 0xd4, 0x81, 0x3d,
+  0xf7, 0xcc, 0x79, 0xbd, 0x75, 0x50, 0x04, 0xbe, 0xcc, 0xea, 0x0c, 0xbe,
+  0x57, 0x29, 0x1b, 0xbe, 0xea, 0x63, 0x83, 0xbd, 0x62, 0x66, 0xe8, 0x3d,
+  0x1a, 0x80, 0x1d, 0xbe, 0xf2, 0x7b, 0x1e, 0xbe, 0x7b, 0x69, 0x13, 0x3e,
+  0xa0, 0x4f, 0x6e, 0xbe, 0x90, 0x5e, 0x6a, 0xbe, 0x35, 0xcd, 0x0c, 0xbe,
+  0xcf, 0x9d, 0x9a, 0xbe, 0xaf, 0x45, 0x00, 0x3d, 0x4b, 0xc6, 0x66, 0xbe,
+  0xe6, 0x90, 0x87, 0xbe, 0x00, 0x34, 0x21, 0x3e, 0x50, 0x9a, 0x64, 0x3d,
+  0x63, 0xce, 0xe9, 0x3d, 0xc4, 0xbb, 0x1d, 0x3e, 0xe4, 0xf6, 0x10, 0x3e,
+  0x15, 0x4d, 0xea, 0x3d, 0xf8, 0xd6, 0x33, 0x3e, 0xbe, 0x3c, 0x97, 0x3d,
+  0x16, 0x69, 0x1e, 0x3e, 0xa1, 0x2b, 0xd6, 0x3c, 0xd4, 0x2c, 0x85, 0x3d,
+  0x42, 0x26, 0xdf, 0x3c, 0x51, 0x18, 0xa8, 0x3d, 0xa6, 0x8a, 0x02, 0x3e,
+  0x79, 0x89, 0x88, 0xbb, 0xea, 0x30, 0xab, 0x3d, 0xd2, 0xf7, 0xb7, 0x3d,
+  0xd8, 0xe8, 0xa2, 0xbb, 0x79, 0xd7, 0x37, 0x3d, 0xcc, 0x96, 0x13, 0x3c,
+  0x5e, 0x99, 0x0c, 0xbd, 0xfd, 0x7e, 0x96, 0x3c, 0x7a, 0xc4, 0x76, 0x3c,
+  0x21, 0x08, 0x5e, 0xbd, 0x57, 0x8a, 0xba, 0x3c, 0x5f, 0x6f, 0x9d, 0xbd,
+  0xea, 0xb4, 0xbb, 0xbb, 0x87, 0xad, 0x2f, 0xbc, 0xcc, 0xbe, 0x10, 0x3e,
+  0x6b, 0x95, 0x0b, 0x3e, 0x39, 0x71, 0xa5, 0x3c, 0x99, 0x3b, 0x28, 0xbd,
+  0xc5, 0x28, 0x2c, 0xbd, 0xbe, 0xf0, 0x26, 0xbe, 0x3c, 0xb0, 0x96, 0xbb,
+  0x89, 0xb3, 0x46, 0xbb, 0xd7, 0x60, 0xea, 0x3d, 0x60, 0x72, 0x98, 0x3d,
+  0x16, 0x9a, 0x2f, 0xbd, 0xe1, 0xab, 0x09, 0x3c, 0xf2, 0xb3, 0x34, 0xbe,
+  0xe6, 0x42, 0x84, 0xbe, 0x04, 0x4e, 0x02, 0xbe, 0xdf, 0xe1, 0x78, 0xbe,
+  0xae, 0xdd, 0xe8, 0xbd, 0x23, 0x29, 0x18, 0x3c, 0x4e, 0x5d, 0x77, 0xbe,
+  0x45, 0xe4, 0x89, 0xbe, 0x50, 0xb2, 0x4b, 0xbe, 0x9c, 0x8f, 0x7c, 0xbe,
+  0xa0, 0x14, 0xc0, 0xbd, 0xe7, 0xda, 0xc1, 0xbd, 0x62, 0x97, 0xa1, 0xbe,
+  0xeb, 0xe8, 0xde, 0xbd, 0x95, 0x31, 0x19, 0xbe, 0x2f, 0xd8, 0xe2, 0xbd,
+  0xb7, 0x59, 0x25, 0xbe, 0x0d, 0x4d, 0xab, 0xbd, 0x8d, 0xe8, 0x95, 0x3c,
+  0x16, 0x56, 0xb0, 0x3d, 0x63, 0xe0, 0x50, 0xbd, 0xf8, 0xa2, 0xd4, 0x3d,
+  0x1c, 0x5d, 0xa2, 0x3d, 0x8c, 0x00, 0x81, 0x3d, 0x1b, 0xa9, 0x1c, 0xbd,
+  0x45, 0x82, 0x0e, 0x3d, 0xae, 0x36, 0xcc, 0x3d, 0x90, 0x7b, 0xc4, 0x3d,
+  0x6a, 0xe6, 0xb6, 0x3d, 0x7d, 0x7d, 0xd0, 0x3d, 0x95, 0x34, 0x9f, 0x3d,
+  0xb8, 0xac, 0xa4, 0x3d, 0xe5, 0xb5, 0x3b, 0x3e, 0xc8, 0x34, 0xc4, 0x3c,
+  0x47, 0xe5, 0x8e, 0x3d, 0x57, 0xc7, 0x92, 0x3d, 0x45, 0xa5, 0xc8, 0x3c,
+  0x1c, 0x56, 0xd8, 0xbb, 0x5f, 0xa3, 0x6e, 0x3d, 0x44, 0x30, 0x85, 0x3d,
+  0x82, 0x8a, 0x8d, 0x3d, 0xf6, 0xdf, 0x74, 0x3d, 0xba, 0x6f, 0x43, 0x3d,
+  0x82, 0x5a, 0x1b, 0x3d, 0x81, 0x10, 0xc0, 0xbb, 0x46, 0x2f, 0x02, 0xbc,
+  0x81, 0x51, 0x7f, 0xbd, 0xd2, 0x19, 0xd1, 0x3c, 0x6b, 0xaa, 0x68, 0x3c,
+  0x82, 0xad, 0x23, 0xbd, 0x82, 0xcf, 0x06, 0xbc, 0xd0, 0x13, 0x25, 0xbe,
+  0x0a, 0xd7, 0x42, 0xbe, 0xd3, 0xba, 0x0e, 0x3c, 0xff, 0xae, 0xe2, 0xbd,
+  0x95, 0xe6, 0x2c, 0xbe, 0xe5, 0xc6, 0x00, 0x3d, 0x0c, 0x54, 0x79, 0xbd,
+  0xb9, 0x11, 0x4c, 0xbe, 0xe3, 0x06, 0x0b, 0xbe, 0xb2, 0x29, 0x95, 0xbd,
+  0x55, 0x60, 0xd6, 0x3d, 0xca, 0x13, 0xa2, 0xbd, 0x8d, 0xd0, 0x06, 0xbe,
+  0x81, 0x27, 0xb6, 0x3d, 0x4d, 0x5e, 0x23, 0x3d, 0xd3, 0x27, 0xb9, 0x3d,
+  0xbf, 0xb6, 0x16, 0x3e, 0xcc, 0x50, 0x9c, 0x3d, 0x6a, 0x9b, 0x46, 0x3e,
+  0xae, 0xc8, 0x86, 0x3d, 0x5b, 0x60, 0xb1, 0x3d, 0xb5, 0xe5, 0xc1, 0x3d,
+  0xbb, 0x89, 0xe7, 0xbd, 0x45, 0x1e, 0xc3, 0x3c, 0xc6, 0x66, 0x11, 0xbd,
+  0xb5, 0xb6, 0x52, 0x3d, 0xef, 0x46, 0x8e, 0x3c, 0x51, 0x07, 0x7e, 0xbd,
+  0xfc, 0x77, 0x36, 0xbc, 0xf4, 0xde, 0x0a, 0x3b, 0xec, 0x49, 0x14, 0xbe,
+  0x10, 0x1f, 0x23, 0xbd, 0xb0, 0x48, 0xa8, 0xbd, 0x67, 0x33, 0x3d, 0xbd,
+  0x86, 0x4c, 0xa2, 0xbc, 0x2c, 0x3a, 0x2c, 0xbd, 0x99, 0x7c, 0x0a, 0x3d,
+  0x57, 0xbf, 0xcd, 0x3c, 0xe6, 0x9f, 0x06, 0xbe, 0x27, 0xf0, 0x57, 0xbd,
+  0x0b, 0x7e, 0xca, 0x3d, 0x30, 0xb7, 0xfb, 0x3b, 0x03, 0xc1, 0xe4, 0x3c,
+  0x89, 0x8e, 0x68, 0x3d, 0xe7, 0xbd, 0x8a, 0x3c, 0x5f, 0x45, 0x35, 0xbb,
+  0x48, 0x25, 0x1e, 0xbe, 0x70, 0xa5, 0x38, 0xbc, 0xe4, 0x3a, 0x96, 0xbc,
+  0x40, 0xe8, 0x7d, 0x3d, 0xbf, 0x21, 0xd3, 0x3c, 0x0d, 0x62, 0x35, 0xbc,
+  0xc8, 0xc2, 0x51, 0xbd, 0x94, 0x7d, 0x8c, 0xbd, 0xca, 0xeb, 0x47, 0xbe,
+  0xb2, 0xc2, 0x0d, 0xbe, 0x85, 0x6c, 0x64, 0xbe, 0x59, 0x1d, 0x8b, 0xbe,
+  0xbc, 0xbc, 0xaf, 0xbe, 0x34, 0xef, 0x1c, 0xbe, 0x4c, 0x44, 0x83, 0xbe,
+  0x55, 0x7c, 0xd5, 0xbd, 0x0a, 0x80, 0xff, 0xbd, 0x71, 0xdd, 0x0f, 0xbe,
+  0xde, 0x50, 0x19, 0xbc, 0x13, 0x0c, 0x99, 0xbe, 0x26, 0xd4, 0xfa, 0xbe,
+  0x5d, 0xfb, 0x1e, 0xbe, 0xcc, 0x1f, 0x27, 0xbe, 0x69, 0x22, 0x11, 0xbe,
+  0x7e, 0x34, 0xa4, 0xbd, 0x8e, 0xd1, 0x3b, 0x3d, 0xa1, 0x52, 0x46, 0x3d,
+  0x4a, 0xd1, 0x7b, 0xbd, 0x42, 0x40, 0x46, 0xbd, 0x68, 0xcc, 0xa4, 0xbc,
+  0x56, 0xa1, 0x18, 0x3d, 0x62, 0x8f, 0x96, 0x3d, 0x18, 0x7f, 0xa5, 0x3d,
+  0xbd, 0xd7, 0x06, 0x3e, 0x37, 0x71, 0x99, 0x3d, 0x7f, 0x26, 0x2b, 0x3d,
+  0x04, 0x59, 0x4f, 0x3e, 0xa5, 0x82, 0x5a, 0x3d, 0xb3, 0xec, 0xf7, 0x3d,
+  0x80, 0x39, 0x7f, 0x3d, 0x33, 0xec, 0x2f, 0x3e, 0xbe, 0x98, 0xae, 0x3d,
+  0x71, 0x5d, 0xdd, 0x3c, 0x75, 0x30, 0xf0, 0x3d, 0xda, 0xbd, 0xb6, 0x3d,
+  0x00, 0x43, 0x93, 0x3d, 0x30, 0x2e, 0x8a, 0x3d, 0xf8, 0xc3, 0x4f, 0xbc,
+  0xb6, 0xe8, 0x76, 0x3d, 0xa6, 0x69, 0xb6, 0x3d, 0x7a, 0x8a, 0x4a, 0xbd,
+  0xf2, 0xeb, 0x23, 0xbc, 0xdc, 0x37, 0xbd, 0x3d, 0xfb, 0x46, 0x8b, 0x3d,
+  0x6e, 0x83, 0xe7, 0x3b, 0xf1, 0xb1, 0xf1, 0xbd, 0xaf, 0xa7, 0x95, 0xbd,
+  0x6d, 0xbd, 0x77, 0xbd, 0xd5, 0x6e, 0x41, 0xbe, 0x09, 0x28, 0x3d, 0xbc,
+  0x76, 0x12, 0x64, 0x3d, 0x7a, 0x6a, 0xae, 0xbd, 0x27, 0x75, 0x48, 0xbe,
+  0x06, 0x53, 0x6d, 0xbc, 0xbe, 0x27, 0x8a, 0xbe, 0x2d, 0xd2, 0xa1, 0xbd,
+  0x4e, 0xae, 0x52, 0xbe, 0x9f, 0xa7, 0xa0, 0xbe, 0x22, 0xbd, 0x0b, 0x3e,
+  0x18, 0xc8, 0x70, 0xbe, 0x01, 0x77, 0x9e, 0xbe, 0x33, 0xc2, 0xa7, 0x3d,
+  0x7f, 0xdb, 0x05, 0xbe, 0x9b, 0xd5, 0x98, 0xbd, 0x87, 0xc6, 0x2e, 0xbd,
+  0x8e, 0x7a, 0x12, 0xbd, 0xc5, 0x93, 0x68, 0x3d, 0x31, 0x9d, 0xce, 0xbc,
+  0x12, 0xa6, 0x23, 0xbc, 0xf9, 0xb6, 0x97, 0x3d, 0xa2, 0x92, 0x41, 0xbd,
+  0x3e, 0x0c, 0x6b, 0xbc, 0x82, 0x7a, 0xd5, 0x3c, 0xd8, 0xf5, 0x7a, 0xbd,
+  0x9f, 0x2c, 0x31, 0x3c, 0xba, 0xf8, 0x64, 0xbd, 0x53, 0xa2, 0xb4, 0x3b,
+  0x09, 0xa3, 0xa5, 0xbc, 0x2b, 0x70, 0x38, 0xbe, 0xcd, 0xfb, 0xda, 0xbc,
+  0x8f, 0x31, 0x71, 0xbc, 0xd6, 0x14, 0xed, 0xbc, 0x79, 0x0c, 0x8f, 0x3c,
+  0xe1, 0xaf, 0x86, 0xbc, 0x73, 0x79, 0xae, 0xbd, 0x47, 0x4d, 0xca, 0xbd,
+  0x4b, 0x5d, 0xfd, 0xbd, 0x63, 0x00, 0x6b, 0xbd, 0x3e, 0xd3, 0x86, 0x3c,
+  0xd4, 0xf4, 0xf3, 0x3a, 0x84, 0x2b, 0x91, 0x3d, 0xa9, 0xc0, 0x7f, 0xbd,
+  0xc1, 0x1e, 0xb2, 0xbc, 0x20, 0xaf, 0xe3, 0x3c, 0x70, 0x40, 0x37, 0xbe,
+  0xf9, 0x7f, 0xa7, 0xbd, 0xc8, 0xb3, 0xd7, 0xbd, 0xf7, 0xf3, 0xc7, 0xbd,
+  0x89, 0x14, 0x0d, 0xbe, 0x23, 0x05, 0x2d, 0xbd, 0x02, 0xa3, 0x4a, 0xbe,
+  0x37, 0xaa, 0x93, 0xbd, 0x55, 0x48, 0x93, 0xbd, 0xb1, 0x72, 0x23, 0xbe,
+  0x49, 0x3a, 0xbe, 0xbd, 0xbf, 0xc6, 0x09, 0xbe, 0x05, 0x1b, 0xa5, 0xbe,
+  0xe4, 0xe1, 0x3f, 0xbe, 0x02, 0xe4, 0xf0, 0xbd, 0x5c, 0x9b, 0x6f, 0xbe,
+  0xaa, 0x7b, 0x2a, 0xbd, 0xc4, 0x9d, 0x47, 0xbd, 0x99, 0x25, 0x92, 0x3d,
+  0x37, 0x5c, 0xf7, 0xbd, 0xa7, 0xfb, 0x80, 0xbe, 0x79, 0x55, 0x8b, 0xbd,
+  0x0c, 0xcd, 0x29, 0xbc, 0xe5, 0xef, 0x73, 0xbe, 0xf3, 0x81, 0x6f, 0xbc,
+  0xc5, 0x81, 0x57, 0x3d, 0xb9, 0x7e, 0x98, 0x3d, 0xd3, 0x51, 0x8d, 0x3c,
+  0xef, 0x99, 0x51, 0xbe, 0x02, 0x02, 0x85, 0x3c, 0x33, 0x4a, 0xaa, 0xbd,
+  0x40, 0x4f, 0x7b, 0xbd, 0x14, 0xb5, 0x94, 0x3b, 0xc9, 0xe6, 0x10, 0x3d,
+  0xa6, 0x62, 0x08, 0x3d, 0x55, 0x51, 0x9f, 0x3d, 0x6f, 0x88, 0x84, 0x3d,
+  0x98, 0x45, 0xa4, 0x3d, 0x45, 0x89, 0xa1, 0x3d, 0xf8, 0xf4, 0x78, 0x3d,
+  0x17, 0x8b, 0x89, 0x3b, 0x40, 0xb6, 0x79, 0x3d, 0x08, 0xb7, 0x67, 0x3b,
+  0x25, 0x9e, 0x2a, 0x3d, 0x53, 0x1e, 0x18, 0x3e, 0xfd, 0x08, 0x6f, 0x3c,
+  0x3d, 0x3c, 0x7c, 0x3c, 0xed, 0x2c, 0x5f, 0xbb, 0xc4, 0x8c, 0xf5, 0xbd,
+  0x98, 0x4d, 0x51, 0xbd, 0xfb, 0x1d, 0xe3, 0xbc, 0x45, 0x2d, 0x28, 0x3c,
+  0x15, 0x39, 0x10, 0x3d, 0x14, 0x79, 0xb3, 0xbd, 0x0e, 0x2d, 0x5a, 0xbc,
+  0x58, 0x51, 0xa2, 0xbd, 0x4e, 0x0a, 0xe0, 0xbd, 0x81, 0x62, 0xc4, 0xbd,
+  0xe1, 0xfe, 0x2e, 0xbe, 0x26, 0x40, 0xa5, 0xbd, 0xea, 0xbd, 0xdc, 0x3d,
+  0xb3, 0xc9, 0xee, 0xbd, 0x4c, 0x0a, 0xb9, 0xbd, 0x38, 0xbe, 0x61, 0x3d,
+  0xc3, 0x08, 0x9e, 0xbd, 0x39, 0x5e, 0xd0, 0xbd, 0xb1, 0x78, 0x1e, 0xbe,
+  0xf8, 0x24, 0x4e, 0xbe, 0x7d, 0x01, 0x5d, 0x3c, 0x9c, 0x44, 0x35, 0xbd,
+  0x9d, 0xae, 0x97, 0xbd, 0xf3, 0x0b, 0xac, 0x3d, 0xa0, 0xe9, 0x24, 0xbe,
+  0xf8, 0x66, 0x9c, 0xbd, 0xa6, 0xbf, 0xb2, 0xbd, 0xd1, 0x53, 0x3d, 0x3d,
+  0xa7, 0x1a, 0xca, 0x3d, 0x9d, 0x21, 0x94, 0xbb, 0x60, 0xa4, 0xb6, 0xbd,
+  0x4f, 0x0f, 0xa2, 0x3d, 0x90, 0x3d, 0x29, 0xbe, 0xbd, 0x4f, 0x08, 0xbe,
+  0x58, 0x58, 0x9c, 0xbd, 0xc5, 0x8f, 0xab, 0x3c, 0xc9, 0x73, 0xd5, 0x3d,
+  0xc3, 0x16, 0xc9, 0x3a, 0xa9, 0x13, 0xbf, 0xbc, 0x1e, 0x62, 0x0a, 0xbd,
+  0xaf, 0xa6, 0x13, 0xbe, 0xed, 0xca, 0x12, 0xbd, 0xc2, 0xca, 0x2b, 0xbe,
+  0xd3, 0xbc, 0x91, 0xbd, 0xc1, 0xd1, 0x86, 0x3d, 0x3c, 0x24, 0x16, 0xbe,
+  0xbc, 0x11, 0x50, 0xbd, 0x05, 0xc3, 0x94, 0xbd, 0xcc, 0x5e, 0x12, 0xbe,
+  0xe1, 0x5b, 0xa7, 0xbd, 0xb0, 0x58, 0x45, 0xbd, 0x7b, 0x40, 0xb9, 0xbd,
+  0xf4, 0x59, 0x82, 0x3a, 0xb2, 0x21, 0xef, 0xbd, 0xef, 0x9e, 0xf0, 0xbd,
+  0xb2, 0x84, 0xb7, 0xbd, 0x80, 0x35, 0xa8, 0xbd, 0x02, 0x4f, 0xa5, 0xbd,
+  0x76, 0x3d, 0xf0, 0xbc, 0x7a, 0x97, 0x25, 0xbe, 0xad, 0x00, 0xcd, 0xbd,
+  0xa3, 0x4e, 0xb2, 0xbd, 0x58, 0x20, 0xc6, 0xbd, 0xf4, 0x14, 0x23, 0xbe,
+  0xa9, 0xb0, 0xc9, 0xbd, 0xbf, 0x6a, 0x34, 0xbd, 0xe8, 0x2f, 0x45, 0xbc,
+  0x2c, 0xdd, 0xb6, 0xbd, 0x8a, 0x68, 0x85, 0xbe, 0x22, 0xf4, 0x7b, 0xbd,
+  0xac, 0x69, 0xa3, 0xbd, 0xe5, 0x86, 0x85, 0xbe, 0xcd, 0x44, 0x18, 0xbc,
+  0x17, 0x02, 0x71, 0xbd, 0x12, 0x65, 0xbd, 0xbc, 0xf1, 0x1c, 0xb0, 0x3c,
+  0xf8, 0x8c, 0x2b, 0xbe, 0xf5, 0xa7, 0x8f, 0xbc, 0xfc, 0x42, 0xce, 0x3c,
+  0x65, 0x47, 0x72, 0xbe, 0xbc, 0x49, 0x34, 0xbd, 0x8d, 0x67, 0x96, 0xbb,
+  0x0c, 0xb4, 0xa2, 0xbd, 0x0c, 0x64, 0x21, 0xbd, 0x93, 0x0d, 0x09, 0xbe,
+  0x9e, 0xa5, 0x39, 0x3c, 0x4a, 0x61, 0xb4, 0xbc, 0x59, 0x96, 0x67, 0xbe,
+  0xf4, 0x82, 0x64, 0xbd, 0xbf, 0x6f, 0x64, 0xbd, 0x3f, 0xcc, 0x3e, 0xbd,
+  0x4d, 0x91, 0x83, 0xbd, 0x21, 0x0b, 0x2d, 0x3d, 0x04, 0x07, 0x95, 0xbc,
+  0x58, 0x1e, 0x0d, 0xbd, 0x4a, 0x43, 0xe2, 0xbd, 0x2e, 0xf6, 0xce, 0xbc,
+  0xd3, 0xdc, 0x0c, 0xbd, 0xab, 0x6b, 0xdb, 0xbd, 0xba, 0xfc, 0x8d, 0xbc,
+  0x46, 0xfa, 0x08, 0x3e, 0x91, 0x08, 0x8b, 0xbc, 0xe1, 0x94, 0xdd, 0xbd,
+  0x1c, 0xf3, 0x0f, 0xbe, 0xd7, 0xbb, 0xc9, 0xbd, 0x9a, 0x70, 0xca, 0xbd,
+  0xc2, 0x1e, 0x5a, 0xbe, 0xb2, 0x75, 0xe7, 0xbc, 0xd2, 0xeb, 0x8f, 0x3d,
+  0xa9, 0x9e, 0xdb, 0xbd, 0xa6, 0x75, 0x3c, 0xbe, 0x64, 0x0b, 0x54, 0xbd,
+  0x0c, 0xd8, 0x6e, 0xbe, 0x68, 0xc5, 0x53, 0xbe, 0x97, 0x43, 0x7f, 0xbe,
+  0x9c, 0x2e, 0x2c, 0xbe, 0x42, 0x1d, 0x1a, 0xbb, 0x69, 0x8a, 0x9c, 0xbe,
+  0x89, 0xe7, 0x4b, 0xbe, 0x4a, 0x1f, 0xc9, 0x3d, 0xab, 0xe4, 0x37, 0xbe,
+  0x71, 0x41, 0x22, 0xbd, 0x61, 0xfd, 0x22, 0xbd, 0xdb, 0xab, 0x73, 0xbd,
+  0x93, 0xaa, 0x19, 0x3e, 0x8d, 0xa9, 0xaa, 0xbd, 0x48, 0x64, 0xe3, 0xbd,
+  0x4f, 0xa9, 0x06, 0x3d, 0xaf, 0xf2, 0x13, 0xbe, 0xda, 0x3c, 0x37, 0xbe,
+  0xc8, 0x6b, 0x69, 0xbe, 0xae, 0x63, 0x89, 0xbe, 0x78, 0x14, 0x03, 0x3e,
+  0x31, 0xde, 0x51, 0xbe, 0xbb, 0xb6, 0xa3, 0xbe, 0x8b, 0xee, 0x26, 0x3d,
+  0x54, 0x55, 0x31, 0xbd, 0x6d, 0xe9, 0xe0, 0xbd, 0x32, 0x48, 0xb6, 0xbd,
+  0x21, 0xe1, 0x40, 0xbe, 0xf6, 0x24, 0x07, 0x3d, 0xae, 0xaf, 0x0e, 0xbe,
+  0x6b, 0x6f, 0xbd, 0xbd, 0x9c, 0x37, 0x0a, 0x3e, 0x17, 0xd4, 0x52, 0x3d,
+  0xd8, 0x9c, 0x98, 0xbd, 0x3c, 0x59, 0xb4, 0xbd, 0xf3, 0xf5, 0x4c, 0xbe,
+  0x7f, 0x0b, 0x57, 0xbd, 0x0e, 0xe4, 0xb0, 0xbd, 0x5a, 0x4e, 0xfa, 0xba,
+  0x4a, 0x36, 0x92, 0x3c, 0xb7, 0x54, 0x31, 0xbd, 0xff, 0x59, 0xf2, 0xbd,
+  0xb3, 0xc0, 0x6e, 0xbd, 0xbd, 0x64, 0x45, 0xbd, 0x2f, 0x14, 0xdf, 0xbd,
+  0x35, 0x45, 0x96, 0x3c, 0x4b, 0x6a, 0x49, 0xbd, 0xf7, 0xe6, 0x61, 0xbd,
+  0x0d, 0xe9, 0xb0, 0xbd, 0x65, 0x73, 0x21, 0xbd, 0xfa, 0xb0, 0xb0, 0xbc,
+  0x68, 0x2c, 0xf9, 0xbd, 0x33, 0x4f, 0x4f, 0xbe, 0xc0, 0x31, 0x8e, 0xbd,
+  0x4a, 0xdd, 0x90, 0xbd, 0x86, 0xb3, 0x38, 0xbe, 0x18, 0xc6, 0xa2, 0xbd,
+  0x37, 0x43, 0x2c, 0xbd, 0x93, 0xfe, 0x22, 0x3c, 0x5b, 0x0c, 0x71, 0xbd,
+  0xfc, 0x43, 0x96, 0xbe, 0x2b, 0xc4, 0x91, 0x3d, 0x21, 0xcd, 0x57, 0x3d,
+  0x29, 0xb7, 0xa3, 0xbe, 0x97, 0xc4, 0xb9, 0xbd, 0x51, 0x4c, 0x72, 0xbd,
+  0x1a, 0x01, 0x0d, 0xbc, 0x5a, 0xcb, 0xdf, 0xbd, 0x25, 0xc5, 0x44, 0xbe,
+  0x13, 0x5b, 0x75, 0x3d, 0x6a, 0xdd, 0xc4, 0xbd, 0x87, 0x3e, 0x79, 0xbe,
+  0xf7, 0x4e, 0x9a, 0xbd, 0x19, 0xdf, 0x09, 0xbd, 0xa7, 0xba, 0xb6, 0xbd,
+  0x88, 0x3f, 0x1e, 0xbe, 0x40, 0xd6, 0x75, 0xbe, 0x1c, 0x76, 0xbd, 0xbd,
+  0xf1, 0x8d, 0xc4, 0xbc, 0xda, 0xfb, 0x84, 0xbe, 0x25, 0x8e, 0xbe, 0xbd,
+  0x5a, 0xe1, 0x16, 0xbd, 0x07, 0x41, 0x19, 0xbc, 0x3e, 0xfb, 0xf5, 0xbd,
+  0x6d, 0x8f, 0x22, 0xbe, 0xd7, 0x33, 0xf8, 0xbd, 0xcb, 0xd6, 0xd8, 0xbd,
+  0x21, 0x29, 0x97, 0xbe, 0x36, 0x5a, 0xfa, 0xbd, 0x74, 0x82, 0xf1, 0xbd,
+  0x5d, 0x90, 0x51, 0xbe, 0x29, 0x62, 0xda, 0xbd, 0x17, 0xcb, 0xb9, 0xbd,
+  0xf7, 0xd3, 0x17, 0xbe, 0x87, 0x29, 0xf2, 0xbd, 0x26, 0x05, 0xa0, 0xbc,
+  0xab, 0xc4, 0x41, 0xbe, 0x4d, 0xfd, 0x5f, 0xbe, 0x93, 0x00, 0x8a, 0xbe,
+  0xcf, 0x28, 0x59, 0xbe, 0xf8, 0x05, 0x7e, 0xbc, 0x07, 0x4c, 0x7c, 0xbe,
+  0x62, 0x50, 0x73, 0xbe, 0x79, 0xef, 0x89, 0xbd, 0x1c, 0x3f, 0x71, 0xbe,
+  0x40, 0xd6, 0x7b, 0xbe, 0xbe, 0x16, 0x8d, 0xbe, 0x57, 0xfc, 0x1d, 0xbe,
+  0xbd, 0x33, 0x45, 0x3d, 0x3f, 0xd6, 0x8a, 0xbe, 0xed, 0x2f, 0x5f, 0xbe,
+  0x84, 0x93, 0xa7, 0x3d, 0xd0, 0xff, 0x99, 0xbd, 0xed, 0xd7, 0xd1, 0xbd,
+  0x75, 0xc9, 0x11, 0xbe, 0xa0, 0x59, 0xbb, 0xbc, 0x20, 0xec, 0x4b, 0x3d,
+  0x87, 0x85, 0x92, 0xbd, 0x30, 0x90, 0x11, 0xbe, 0xc4, 0xe5, 0x28, 0x3d,
+  0xf8, 0xb6, 0x11, 0xbd, 0x96, 0x34, 0x62, 0xbe, 0xaf, 0x2c, 0xd7, 0xbd,
+  0xb3, 0xa0, 0x54, 0xbe, 0xf9, 0x07, 0xbb, 0x3d, 0x3b, 0x4e, 0x14, 0xbe,
+  0x42, 0x44, 0x26, 0xbe, 0xae, 0x01, 0xfc, 0x3d, 0xf5, 0x20, 0x62, 0x3c,
+  0xd6, 0xa9, 0x29, 0x3d, 0x06, 0x2d, 0xc5, 0x3d, 0x73, 0xa6, 0xab, 0xbd,
+  0xeb, 0x05, 0x3d, 0x3d, 0x6e, 0x1c, 0xa5, 0x3d, 0xa9, 0x14, 0x16, 0x3d,
+  0x33, 0x81, 0x7c, 0x3d, 0x17, 0x45, 0xb8, 0x3d, 0xb1, 0xb1, 0xa0, 0x3d,
+  0x8a, 0x4a, 0xc7, 0x3d, 0x89, 0x69, 0x9c, 0x3d, 0x5a, 0xf1, 0x01, 0xbd,
+  0x06, 0x6e, 0x12, 0x3d, 0xb9, 0xb9, 0x4b, 0x3c, 0xeb, 0xfd, 0x44, 0x3c,
+  0x27, 0x9a, 0x84, 0x3d, 0x86, 0x65, 0x79, 0xbd, 0x86, 0x06, 0x38, 0xbb,
+  0xb1, 0x85, 0xcf, 0xbd, 0x21, 0x9e, 0x27, 0xbe, 0x2b, 0x6a, 0x4f, 0x3d,
+  0x55, 0x16, 0x21, 0x3b, 0xe4, 0x2f, 0x03, 0xbe, 0xac, 0x3a, 0xb4, 0x3c,
+  0xe5, 0x86, 0x0e, 0x3d, 0x53, 0x62, 0xd7, 0xbc, 0x01, 0x2b, 0x1a, 0xbd,
+  0x37, 0x79, 0x92, 0xbe, 0x43, 0x7e, 0xdb, 0xba, 0x1f, 0xf1, 0xf1, 0xbc,
+  0x86, 0x34, 0x94, 0xbe, 0xfa, 0x4a, 0xfa, 0xbb, 0x85, 0x1f, 0x82, 0xbc,
+  0xe9, 0x4f, 0xa3, 0xbc, 0x69, 0xee, 0x19, 0xbe, 0x7d, 0x6f, 0x9e, 0xbe,
+  0x34, 0x74, 0x3f, 0xbd, 0x50, 0x58, 0x8a, 0xbc, 0x81, 0x8f, 0xab, 0xbe,
+  0x0a, 0x60, 0x5b, 0x3c, 0x70, 0xe8, 0x42, 0xbc, 0x5d, 0x93, 0x54, 0x3d,
+  0xef, 0x92, 0xd3, 0xbd, 0x86, 0x5f, 0x22, 0xbe, 0x5d, 0x0a, 0x7c, 0xbc,
+  0x8a, 0x12, 0xc0, 0xbc, 0xd8, 0x26, 0x99, 0xbe, 0xf1, 0x6e, 0x42, 0xbc,
+  0x59, 0xe4, 0xfd, 0x3c, 0x15, 0xe5, 0x31, 0x3d, 0x64, 0xc7, 0xcf, 0xbc,
+  0xee, 0x07, 0x19, 0xbe, 0x31, 0xcf, 0x57, 0x3d, 0xb2, 0xb3, 0xac, 0xbc,
+  0xd5, 0x79, 0xb4, 0xbe, 0x80, 0xe2, 0xf8, 0xbb, 0x1d, 0x0a, 0x9c, 0xbd,
+  0xdd, 0x7d, 0x78, 0xbd, 0xc8, 0x30, 0x67, 0xbc, 0x8b, 0x6c, 0x13, 0xbe,
+  0x4b, 0x13, 0xb1, 0xbd, 0x87, 0x41, 0x97, 0xbc, 0x12, 0xaf, 0x7b, 0xbd,
+  0xd9, 0x43, 0xb1, 0xbd, 0x24, 0x67, 0x61, 0xbd, 0x25, 0xed, 0x1b, 0xbe,
+  0xa2, 0x7f, 0x00, 0xbe, 0x48, 0x9e, 0x91, 0xb9, 0x2b, 0x8c, 0x28, 0xbe,
+  0x8d, 0x24, 0x56, 0xbe, 0x20, 0xc6, 0x81, 0x3d, 0x38, 0x4d, 0x4b, 0xbe,
+  0xca, 0xa8, 0x6d, 0xbe, 0xd7, 0xdc, 0x4d, 0xbe, 0x49, 0x11, 0x8c, 0xbe,
+  0xaf, 0x80, 0xe6, 0xbc, 0xdf, 0xe9, 0x27, 0xbe, 0x7b, 0x74, 0x16, 0xbe,
+  0xcd, 0xf6, 0xb4, 0xbc, 0xbc, 0x0d, 0xa2, 0xbe, 0x13, 0x78, 0x87, 0xbe,
+  0x55, 0x7e, 0x8a, 0xbe, 0xb9, 0xd4, 0x9a, 0xbe, 0xcf, 0x6b, 0xeb, 0x3d,
+  0x96, 0x30, 0x90, 0xbe, 0x45, 0xca, 0xc4, 0xbe, 0xc1, 0x9c, 0x0f, 0x3e,
+  0x34, 0x6e, 0x10, 0xbe, 0x3c, 0xec, 0x0d, 0xbe, 0xf7, 0x90, 0x45, 0xbe,
+  0xb5, 0x43, 0x4a, 0xbe, 0xb2, 0xb8, 0x1e, 0x3e, 0xa8, 0xeb, 0xe4, 0xbd,
+  0x9e, 0x55, 0x43, 0xbe, 0x33, 0x8f, 0x1a, 0x3e, 0x28, 0xc8, 0x40, 0x3d,
+  0xff, 0xec, 0xb5, 0x3d, 0x39, 0xd8, 0x24, 0x3d, 0x2e, 0x1d, 0x8a, 0xbb,
+  0x10, 0x4d, 0xf7, 0x3d, 0xba, 0x80, 0x24, 0xbc, 0x4e, 0x8b, 0x52, 0x3d,
+  0x0f, 0x32, 0xc0, 0x3d, 0x7e, 0xf3, 0x7c, 0x3d, 0x03, 0xb8, 0x0c, 0x3e,
+  0x14, 0x21, 0x2a, 0x3d, 0x58, 0x4c, 0x2f, 0x3e, 0xa7, 0x18, 0x2c, 0x3e,
+  0x91, 0xa8, 0x0f, 0x3e, 0x9e, 0x3d, 0xcf, 0x3d, 0x30, 0x26, 0xa6, 0xbd,
+  0xeb, 0x2d, 0x84, 0xbc, 0x4e, 0x4a, 0x11, 0x3e, 0x1d, 0x2c, 0x1b, 0x3d,
+  0xe1, 0xdc, 0x05, 0x3e, 0x9f, 0x77, 0x29, 0x3e, 0xbf, 0x1d, 0xa5, 0x3d,
+  0x09, 0x87, 0xc2, 0x3d, 0xe8, 0xe8, 0xb3, 0x3c, 0x21, 0x96, 0xa5, 0x3d,
+  0xb3, 0xe5, 0xba, 0x3d, 0x19, 0x27, 0x04, 0x3e, 0x52, 0x7a, 0x01, 0x3e,
+  0x36, 0x21, 0x27, 0x3d, 0xc1, 0x95, 0x04, 0x3e, 0x10, 0x8a, 0x25, 0x3d,
+  0xd1, 0x02, 0x61, 0x3d, 0xf5, 0xff, 0x84, 0x3d, 0xc2, 0x18, 0x21, 0x3d,
+  0xb5, 0xd5, 0xad, 0x3d, 0x94, 0xad, 0x10, 0x3d, 0x6e, 0x6b, 0x8f, 0xbd,
+  0xb5, 0xa8, 0xb8, 0x3d, 0x44, 0x8f, 0x81, 0x3d, 0x83, 0x87, 0x76, 0xbd,
+  0x59, 0xac, 0xd6, 0x3d, 0x0f, 0xf5, 0xac, 0x3d, 0x70, 0x54, 0x9b, 0x3d,
+  0x7e, 0xd6, 0xd4, 0x3b, 0xce, 0x72, 0x8c, 0xbd, 0x3e, 0x5e, 0x27, 0x3d,
+  0x8a, 0x44, 0x89, 0x3d, 0xf7, 0x51, 0x7b, 0x3d, 0x9c, 0x97, 0x1a, 0x3e,
+  0xc4, 0x56, 0x64, 0xbb, 0xd1, 0x9c, 0x6b, 0x3d, 0xf7, 0x2a, 0x86, 0xbc,
+  0xb4, 0xc2, 0xf0, 0xbc, 0x2f, 0xdf, 0xd6, 0x3d, 0xc1, 0xbb, 0xa7, 0x3d,
+  0x8c, 0xf6, 0xd0, 0x3c, 0x5e, 0xeb, 0x37, 0x3e, 0xb9, 0x60, 0xc3, 0x3d,
+  0x23, 0x62, 0x2a, 0x3e, 0xbf, 0x6c, 0x76, 0x3c, 0x8c, 0x19, 0x58, 0xbd,
+  0x9e, 0xc1, 0x78, 0x3d, 0x16, 0xe9, 0xa0, 0x3d, 0x80, 0xca, 0x92, 0xbc,
+  0x23, 0x18, 0x2f, 0x3d, 0x23, 0xc2, 0x26, 0x3c, 0x06, 0x45, 0x81, 0x3d,
+  0xdb, 0x74, 0x32, 0x3c, 0x17, 0xe7, 0x17, 0xbe, 0x5e, 0xad, 0x94, 0x3c,
+  0x4e, 0x79, 0x3a, 0x3d, 0xde, 0x20, 0x4b, 0x3d, 0xae, 0xeb, 0x0b, 0xbc,
+  0x74, 0xdc, 0x83, 0xbd, 0x6c, 0x40, 0xbf, 0x3b, 0xc5, 0xee, 0x76, 0xbd,
+  0xf5, 0xcb, 0xf8, 0xbd, 0xef, 0x24, 0x8b, 0xbd, 0xb4, 0xaa, 0xc3, 0xbd,
+  0x0f, 0x5e, 0x29, 0x3e, 0x89, 0xfa, 0xcf, 0xbc, 0x88, 0xc5, 0xf6, 0xbd,
+  0xfd, 0x85, 0x27, 0x3c, 0x61, 0xe1, 0x63, 0xbe, 0x6c, 0x5d, 0x95, 0xbd,
+  0xb8, 0xd5, 0xa5, 0xbc, 0x6e, 0x2e, 0x16, 0xbc, 0x60, 0x72, 0xf6, 0x3d,
+  0x4c, 0x8e, 0x45, 0xbd, 0x48, 0x7d, 0xd4, 0xbd, 0xd8, 0x72, 0xaa, 0xbd,
+  0xc0, 0x23, 0x1f, 0xbe, 0xd0, 0xbe, 0x6f, 0x3d, 0xeb, 0xc2, 0x85, 0xbd,
+  0x40, 0xa4, 0xc0, 0xbd, 0x40, 0x0f, 0x21, 0x3e, 0x68, 0x6d, 0xc5, 0xbd,
+  0x64, 0xf8, 0xbd, 0xbd, 0x73, 0x1e, 0x08, 0x3c, 0x9a, 0x22, 0xa6, 0xbd,
+  0x49, 0x40, 0x53, 0x3d, 0x99, 0xf0, 0xe7, 0x3c, 0x44, 0xb3, 0x2b, 0xbe,
+  0xa7, 0x51, 0xdc, 0xbd, 0xfc, 0xc3, 0x0f, 0xbd, 0x49, 0x32, 0x82, 0xbd,
+  0xbf, 0xa9, 0xa0, 0xbd, 0xfd, 0xc2, 0x2e, 0x3c, 0xdb, 0xe7, 0xda, 0xbd,
+  0x8d, 0x1e, 0x15, 0x39, 0x24, 0xbc, 0x47, 0x3b, 0x96, 0x9a, 0x78, 0xbd,
+  0xc1, 0xe8, 0x61, 0xbd, 0x39, 0xd0, 0xfc, 0xbd, 0x92, 0xcc, 0x8a, 0xbd,
+  0x92, 0xef, 0xe9, 0xbc, 0x55, 0x5e, 0x42, 0xbe, 0xff, 0x36, 0x26, 0xbd,
+  0xff, 0xe2, 0x57, 0x3c, 0xa8, 0x9a, 0xdb, 0xbd, 0x9b, 0xb5, 0x01, 0xbe,
+  0xfc, 0x30, 0x13, 0xbd, 0xb9, 0xca, 0x8f, 0xbd, 0x0d, 0xcf, 0x1d, 0x3d,
+  0xbc, 0x3c, 0x43, 0xbe, 0x1d, 0x6a, 0xff, 0xbb, 0x1c, 0xca, 0xa8, 0xbd,
+  0x64, 0xad, 0x96, 0xbd, 0x88, 0x68, 0x2d, 0xbe, 0x5d, 0xbd, 0x2d, 0xbe,
+  0x71, 0xcc, 0x15, 0xbe, 0xe7, 0x46, 0xf7, 0xbb, 0x91, 0xa4, 0x32, 0xbe,
+  0x50, 0x35, 0x6d, 0xbd, 0x8f, 0xd3, 0xd0, 0xbd, 0x67, 0xfb, 0x48, 0xbe,
+  0x3a, 0xac, 0x30, 0xbe, 0x76, 0x6c, 0x30, 0xbe, 0x86, 0x68, 0x23, 0xbe,
+  0x12, 0x27, 0x1e, 0x3c, 0xa0, 0xd8, 0xc2, 0xbd, 0xfd, 0xcd, 0x59, 0xbe,
+  0x41, 0x55, 0x0d, 0xbe, 0x2d, 0xc3, 0x39, 0xbe, 0xc8, 0x11, 0x1b, 0xbe,
+  0xba, 0x5c, 0x84, 0xbe, 0x69, 0xf5, 0x21, 0xbe, 0x2f, 0xee, 0x50, 0xbd,
+  0x78, 0x0e, 0x0f, 0xbe, 0x17, 0x94, 0x8d, 0xbe, 0x04, 0xc1, 0x8b, 0xbe,
+  0xff, 0xd6, 0x07, 0xbe, 0xb4, 0xdd, 0x22, 0xbe, 0xbf, 0x9b, 0xc8, 0xbd,
+  0x08, 0x4a, 0x1f, 0xbe, 0x01, 0x88, 0xf6, 0xbd, 0xe7, 0x24, 0xaf, 0xbd,
+  0x97, 0x0d, 0x82, 0xbe, 0x43, 0xb6, 0x08, 0xbe, 0x6f, 0x48, 0x3d, 0xbe,
+  0x1d, 0xc1, 0xf0, 0xbd, 0x03, 0xa4, 0x20, 0xbe, 0xe6, 0x3a, 0xfc, 0xbd,
+  0xa5, 0xae, 0x55, 0xbd, 0x0a, 0xe3, 0x18, 0xbe, 0x97, 0xc7, 0x3c, 0xbe,
+  0x5f, 0xdd, 0x25, 0xbe, 0x97, 0xa0, 0x16, 0xbe, 0x4c, 0x2f, 0x9b, 0xbd,
+  0x83, 0x12, 0x6b, 0xbd, 0x42, 0x7e, 0x08, 0xbd, 0xfe, 0xff, 0x80, 0xbd,
+  0x7a, 0xb8, 0xba, 0xbd, 0x2a, 0x4b, 0xa1, 0xbc, 0x04, 0x22, 0x96, 0xbd,
+  0x86, 0x99, 0x84, 0xbd, 0x50, 0x96, 0x92, 0xbd, 0x8a, 0x1d, 0x8e, 0xbd,
+  0xa7, 0x88, 0x82, 0xbb, 0x05, 0x8b, 0x98, 0xbd, 0xab, 0x06, 0x9a, 0xbd,
+  0xb5, 0x37, 0x4a, 0xba, 0x20, 0x60, 0x05, 0xbe, 0x60, 0x76, 0xa3, 0xbd,
+  0xc4, 0x80, 0x67, 0x3c, 0x12, 0x08, 0x9d, 0xbd, 0xb7, 0xca, 0xf0, 0xbd,
+  0xe3, 0x75, 0x9f, 0xbd, 0x39, 0xe8, 0x15, 0xbe, 0x53, 0x91, 0x48, 0xbe,
+  0x7e, 0x51, 0x71, 0x3c, 0x19, 0x6e, 0x5d, 0xbd, 0xfd, 0xc8, 0x10, 0xbe,
+  0xa0, 0x22, 0x0c, 0xbd, 0xb6, 0x0d, 0xd1, 0xbb, 0xb8, 0xec, 0xc4, 0xbd,
+  0x5e, 0x06, 0xe6, 0xbd, 0x95, 0x4c, 0x48, 0xbd, 0x7c, 0x23, 0x8d, 0xbd,
+  0xbf, 0x5e, 0x0c, 0xbe, 0xf2, 0x01, 0xf1, 0xbd, 0xf9, 0x7c, 0x45, 0xbd,
+  0x7b, 0x70, 0x58, 0xbd, 0xaf, 0xc4, 0xab, 0xbc, 0x54, 0x4b, 0x0f, 0xbe,
+  0xa4, 0x54, 0x7a, 0xbd, 0xe6, 0x47, 0xbf, 0xbd, 0xa7, 0x24, 0x2b, 0xbe,
+  0xce, 0x66, 0x01, 0x3d, 0x1e, 0xcb, 0xb9, 0xbb, 0xe4, 0x73, 0xaa, 0xbc,
+  0xd9, 0x6d, 0x93, 0xbd, 0x06, 0x6f, 0x1d, 0xbe, 0x6f, 0x95, 0x9b, 0xbd,
+  0x8b, 0x59, 0x76, 0xbd, 0x75, 0x0c, 0x01, 0xbe, 0x3d, 0x95, 0xa2, 0xbd,
+  0x8d, 0x32, 0x91, 0xbd, 0xb1, 0xdc, 0x26, 0xbe, 0xe4, 0x16, 0x82, 0xbd,
+  0xfc, 0xe4, 0x14, 0xbe, 0x83, 0xfc, 0xd0, 0xbd, 0x1a, 0x81, 0xd1, 0xbd,
+  0x9f, 0xe2, 0x3d, 0xbe, 0x4a, 0x10, 0x05, 0xbc, 0x60, 0xc1, 0x6a, 0xbd,
+  0x9a, 0x0f, 0x95, 0xbd, 0x59, 0x85, 0xd3, 0xbd, 0x50, 0x57, 0xd6, 0xbd,
+  0xbf, 0x15, 0x3e, 0xbe, 0x86, 0xec, 0x06, 0xbd, 0x7a, 0x6e, 0x9a, 0xbd,
+  0xcd, 0x4e, 0xe1, 0x3c, 0x6e, 0xf7, 0xc8, 0xbc, 0x14, 0xb9, 0x5d, 0x3d,
+  0xe1, 0x72, 0x9b, 0xbd, 0xb9, 0x21, 0x53, 0xbe, 0x19, 0x55, 0x5c, 0x3d,
+  0x22, 0xe4, 0x54, 0xbd, 0xfc, 0xb2, 0xbf, 0xbc, 0x35, 0x3b, 0x50, 0xbd,
+  0x2f, 0xda, 0x15, 0xbd, 0xe5, 0x2c, 0xbd, 0x3c, 0xf3, 0xa0, 0x85, 0xbd,
+  0x28, 0x00, 0x32, 0xbe, 0x23, 0x03, 0x24, 0xbd, 0xe3, 0x1c, 0xec, 0xbc,
+  0x23, 0xbb, 0xed, 0x3d, 0xe2, 0xed, 0xd0, 0xba, 0xf0, 0xf1, 0x57, 0xbd,
+  0x52, 0xd4, 0x2f, 0xbd, 0x10, 0x89, 0xa4, 0x3c, 0xd1, 0x1e, 0x2d, 0xbe,
+  0x35, 0xbb, 0x04, 0x3d, 0x1b, 0x61, 0x2e, 0x3d, 0x42, 0x11, 0xd2, 0xba,
+  0x5f, 0x45, 0x52, 0xbc, 0x22, 0xcd, 0x03, 0xbd, 0x99, 0x2a, 0x22, 0x3d,
+  0x56, 0xee, 0x4d, 0x3b, 0x66, 0x10, 0xb5, 0xbd, 0x7a, 0xef, 0x7d, 0x3d,
+  0x1b, 0x0c, 0x7f, 0xbc, 0x2b, 0x4e, 0x92, 0x3d, 0xf0, 0x13, 0x20, 0x3d,
+  0x35, 0xa1, 0x86, 0xbd, 0x27, 0xc1, 0x4e, 0x3d, 0x79, 0x42, 0x9a, 0x3d,
+  0x98, 0x76, 0x52, 0xbe, 0xb2, 0xdf, 0xed, 0x3b, 0x92, 0xe1, 0x80, 0xbd,
+  0xc3, 0x1b, 0x0a, 0x3b, 0x53, 0x28, 0x78, 0x3d, 0x58, 0x15, 0x24, 0xbc,
+  0x69, 0xef, 0x53, 0xbd, 0x99, 0x47, 0xb8, 0x3c, 0xe4, 0x9c, 0x66, 0xbd,
+  0x54, 0x8e, 0x02, 0x3c, 0xb6, 0xfb, 0x8d, 0xbd, 0xe9, 0x02, 0x96, 0x3a,
+  0x9f, 0x32, 0x29, 0xbd, 0x06, 0xd8, 0x06, 0x3c, 0x35, 0xff, 0x9b, 0xbd,
+  0x7d, 0x81, 0x0d, 0x3d, 0x31, 0x23, 0xde, 0xbd, 0x28, 0x16, 0x8a, 0xbd,
+  0x75, 0x16, 0x10, 0xbd, 0x9d, 0xbd, 0x4c, 0x3c, 0x70, 0x35, 0x15, 0xbc,
+  0x08, 0x12, 0x1e, 0xbd, 0x48, 0xb3, 0x0e, 0x3d, 0xdd, 0xad, 0x3f, 0xbd,
+  0xbc, 0x08, 0xef, 0xbd, 0x58, 0x81, 0xc1, 0xbc, 0xba, 0x7d, 0x5d, 0xbd,
+  0xce, 0x58, 0x0c, 0xbe, 0x33, 0x94, 0xc3, 0x3b, 0xf3, 0x30, 0xb7, 0xbd,
+  0x2c, 0xcf, 0xde, 0xbd, 0x61, 0x0a, 0x61, 0x3d, 0x1e, 0x00, 0x81, 0xbd,
+  0xbb, 0xae, 0xd8, 0xbd, 0xcd, 0x57, 0x65, 0xbc, 0x93, 0xa8, 0x9e, 0xbb,
+  0x20, 0x0b, 0x92, 0x3d, 0xc2, 0xab, 0x33, 0xbd, 0xac, 0x71, 0x54, 0xbd,
+  0x5c, 0xdc, 0x39, 0xbd, 0x8d, 0xc1, 0x20, 0xbe, 0x57, 0x74, 0x13, 0x3d,
+  0x7c, 0xe9, 0xc7, 0x3d, 0x99, 0x3d, 0x1b, 0xbe, 0xe6, 0xbc, 0x46, 0xbd,
+  0x4f, 0x38, 0x38, 0xbd, 0x02, 0x76, 0x8f, 0xbd, 0x60, 0x79, 0x1b, 0xbd,
+  0x47, 0x02, 0x4b, 0xbe, 0x5e, 0xec, 0x46, 0xbd, 0x36, 0xc7, 0x9e, 0xbd,
+  0x22, 0xe9, 0xc4, 0xbd, 0x0a, 0xcc, 0xba, 0xbd, 0xb4, 0x7c, 0x37, 0xbe,
+  0x8f, 0x65, 0x0c, 0xbe, 0x0d, 0x16, 0xc8, 0xbd, 0x17, 0x34, 0xe3, 0xbd,
+  0x1f, 0xf1, 0xb0, 0xbd, 0x55, 0xea, 0xe7, 0xbd, 0xdc, 0x69, 0x86, 0xbd,
+  0xb6, 0xed, 0x00, 0xbd, 0x53, 0xfd, 0xce, 0xbd, 0x64, 0x66, 0x2e, 0xbd,
+  0x8a, 0xa8, 0xdb, 0xbd, 0x1c, 0xab, 0x20, 0xbe, 0x07, 0x51, 0x81, 0xbd,
+  0x02, 0x47, 0xda, 0xbc, 0x86, 0x15, 0x1d, 0x3b, 0xf1, 0x64, 0x53, 0xbd,
+  0x4d, 0x12, 0x19, 0x3d, 0x76, 0xed, 0xa9, 0x3d, 0x14, 0xcf, 0xc5, 0xba,
+  0xe9, 0x0b, 0x8c, 0xbe, 0x87, 0x92, 0x54, 0xbd, 0xe0, 0xc7, 0x88, 0x3d,
+  0x83, 0xa9, 0xd2, 0x3c, 0x3e, 0x9f, 0x5e, 0xbd, 0x23, 0x4e, 0x27, 0xbd,
+  0x1e, 0xdf, 0x00, 0x3b, 0xc2, 0xfe, 0x56, 0x3d, 0x7b, 0xa4, 0x79, 0xbe,
+  0x95, 0x45, 0x2b, 0xbd, 0xb4, 0x69, 0x5a, 0x3d, 0x34, 0xf3, 0xf0, 0x3c,
+  0xd4, 0xe0, 0x4f, 0x3d, 0x7e, 0xd0, 0x2c, 0x3d, 0xd5, 0xa5, 0xb9, 0x3d,
+  0x91, 0x72, 0x0a, 0x3e, 0x4a, 0xe4, 0xb9, 0x3d, 0x97, 0xf6, 0x16, 0x3d,
+  0xd5, 0x21, 0xdd, 0x3c, 0xc9, 0x43, 0x6a, 0x3d, 0x92, 0x79, 0x0b, 0x3d,
+  0x3b, 0x8b, 0xd7, 0x3c, 0x8d, 0x1b, 0x7b, 0x3d, 0x68, 0xdf, 0x60, 0x3e,
+  0x01, 0x68, 0x1b, 0x3e, 0xb4, 0xa8, 0xc9, 0xbc, 0x17, 0x3b, 0x61, 0x3b,
+  0xa4, 0xb7, 0xb7, 0x3d, 0x7d, 0x3e, 0x90, 0x3d, 0xac, 0xfb, 0x83, 0x3d,
+  0xb7, 0x2f, 0x90, 0x3c, 0x16, 0x2f, 0xcb, 0x3d, 0x39, 0x49, 0x82, 0x3d,
+  0x2d, 0x1e, 0xca, 0x3c, 0xee, 0x72, 0x4b, 0x3c, 0xb1, 0xe8, 0x8b, 0x3d,
+  0x32, 0x87, 0x53, 0x3d, 0xa6, 0xea, 0xb7, 0xba, 0x62, 0x79, 0xb5, 0xbc,
+  0xcf, 0x44, 0xb8, 0x3d, 0x0e, 0xb2, 0x4c, 0x3b, 0x90, 0x34, 0x80, 0x3d,
+  0x84, 0xe9, 0x6e, 0x3c, 0x83, 0x82, 0x26, 0x3d, 0xd7, 0x8c, 0xf3, 0x3c,
+  0xa1, 0x42, 0x22, 0x3d, 0x2d, 0x46, 0xaa, 0xba, 0xd5, 0x5c, 0xae, 0x3d,
+  0x7b, 0xc7, 0xfb, 0xbc, 0xfc, 0x9b, 0x64, 0x3d, 0x3e, 0x3c, 0x6c, 0x3d,
+  0x70, 0x0c, 0x33, 0x3c, 0xe0, 0x35, 0x13, 0x3c, 0x2c, 0xd5, 0x8b, 0x3c,
+  0xa9, 0xdd, 0xa8, 0xbd, 0x0a, 0x56, 0xa7, 0x3d, 0x8e, 0xee, 0x55, 0x3b,
+  0x4a, 0xc0, 0x2d, 0xbd, 0x3d, 0xac, 0x3d, 0x3d, 0xc4, 0xd9, 0x21, 0xbc,
+  0xab, 0xc4, 0xb6, 0x3c, 0xcc, 0x7c, 0xaf, 0xbc, 0xf7, 0x1b, 0xfd, 0x3c,
+  0x77, 0x92, 0xec, 0xbc, 0x15, 0xa0, 0x15, 0xbe, 0x9c, 0x30, 0xcd, 0xbd,
+  0x20, 0x37, 0x4f, 0x3d, 0xe9, 0xc2, 0x9c, 0xbd, 0xb7, 0x64, 0x03, 0xbd,
+  0x84, 0x85, 0x2f, 0xbc, 0xae, 0x3b, 0xf5, 0x3d, 0xcc, 0x45, 0x10, 0x3d,
+  0x3f, 0x19, 0x20, 0xbe, 0x5d, 0x6a, 0x23, 0x3d, 0xd4, 0xd2, 0x0b, 0x3d,
+  0x22, 0x18, 0x31, 0xbe, 0xb0, 0x6f, 0xb7, 0xbd, 0xa4, 0x75, 0x95, 0xbd,
+  0x7c, 0x1c, 0xe7, 0xbd, 0x8b, 0xe0, 0xda, 0xbd, 0xd6, 0xdb, 0xe6, 0xbd,
+  0x8f, 0xb7, 0xa2, 0xbd, 0x38, 0x47, 0x07, 0xbe, 0x15, 0x59, 0xb6, 0xbd,
+  0x10, 0x67, 0xf4, 0x3c, 0xb7, 0x25, 0x13, 0xbd, 0xa5, 0xa6, 0xaf, 0xbd,
+  0x1d, 0xf8, 0xa6, 0xbd, 0xda, 0x89, 0xa7, 0xbd, 0x83, 0xdf, 0xe5, 0x39,
+  0x44, 0x06, 0x8c, 0xbd, 0x32, 0x31, 0xac, 0xbc, 0x36, 0x98, 0xac, 0x3c,
+  0x40, 0xaa, 0x92, 0x3d, 0x43, 0xda, 0x89, 0x3d, 0xa2, 0x8a, 0x66, 0x3b,
+  0xbd, 0x11, 0x2a, 0xbe, 0x9a, 0xb8, 0xfd, 0x3c, 0xdf, 0x8d, 0x8d, 0x3d,
+  0x6b, 0x4b, 0x5b, 0x3d, 0x16, 0x5f, 0x80, 0x3b, 0xb7, 0xf1, 0x76, 0x3d,
+  0x0a, 0x96, 0xcd, 0x3d, 0xd8, 0x62, 0x39, 0x3d, 0x0d, 0xc9, 0x94, 0xbe,
+  0x12, 0xbf, 0x22, 0x3d, 0xda, 0x42, 0x8f, 0x3c, 0xcc, 0x23, 0xcf, 0x3d,
+  0x73, 0x26, 0x1f, 0xbd, 0x53, 0x81, 0x5c, 0xbd, 0x7a, 0xcd, 0x26, 0x3d,
+  0x06, 0x0c, 0x8b, 0x3d, 0xb1, 0xc2, 0x4a, 0xbe, 0x15, 0x04, 0x27, 0xbb,
+  0x58, 0xe7, 0xe9, 0x3c, 0x1a, 0x77, 0x84, 0x3d, 0x0d, 0x60, 0x69, 0xbd,
+  0xf3, 0x7a, 0x69, 0x3d, 0x41, 0x03, 0x13, 0xbc, 0xb7, 0x1a, 0xee, 0x3d,
+  0x55, 0x42, 0xf0, 0xbd, 0xac, 0xa4, 0xa6, 0x3c, 0x48, 0xf4, 0x23, 0x3d,
+  0x7d, 0x1b, 0xa2, 0x3d, 0x65, 0xcf, 0xd8, 0xbc, 0xbd, 0xcc, 0x48, 0x3d,
+  0x0c, 0x66, 0x27, 0x3c, 0xa3, 0x03, 0x45, 0x3d, 0x4f, 0xe9, 0xd2, 0xbb,
+  0x2c, 0x01, 0x4b, 0x3d, 0x45, 0x5b, 0x1c, 0xbc, 0xd9, 0x20, 0xf7, 0x3c,
+  0x72, 0xac, 0xac, 0xbc, 0x0c, 0x73, 0xb1, 0x3b, 0x65, 0xa2, 0x58, 0x3c,
+  0x54, 0xbe, 0x88, 0x3d, 0xa1, 0xe7, 0x81, 0x3c, 0x63, 0xb9, 0xad, 0x3c,
+  0x47, 0x1d, 0x84, 0x3c, 0xbb, 0x65, 0xa4, 0x3d, 0x6f, 0x2e, 0xb7, 0x3c,
+  0x6c, 0xa3, 0x82, 0xbc, 0x60, 0x0c, 0xc5, 0xba, 0xaa, 0xa9, 0x1c, 0x3b,
+  0x3f, 0x21, 0xc1, 0x3b, 0xac, 0x36, 0x82, 0x3c, 0x1e, 0x35, 0xb0, 0x3c,
+  0xcc, 0x51, 0xc7, 0x3d, 0xec, 0x34, 0x87, 0xbc, 0x39, 0xed, 0x6c, 0x3a,
+  0x15, 0xb1, 0x6c, 0x3d, 0x61, 0x73, 0x83, 0x3d, 0x6e, 0xae, 0x2f, 0x3d,
+  0xad, 0xff, 0x79, 0x3d, 0xb4, 0x1d, 0x41, 0x3d, 0xe3, 0xec, 0x26, 0x3c,
+  0x73, 0xd5, 0x4a, 0x3d, 0x51, 0x41, 0x16, 0x3d, 0xab, 0x12, 0x90, 0x3c,
+  0xe7, 0xa7, 0x78, 0x3d, 0x56, 0x36, 0x53, 0xbd, 0x38, 0x4d, 0xa8, 0xbd,
+  0x3e, 0x6a, 0x18, 0x3c, 0x82, 0xa6, 0xc5, 0x3c, 0x36, 0x50, 0xee, 0x3d,
+  0x73, 0x9e, 0xbe, 0x3a, 0x34, 0x6c, 0x1c, 0x3c, 0x00, 0x77, 0x05, 0xbd,
+  0xe0, 0x30, 0x28, 0xbe, 0xfa, 0x36, 0x23, 0x3c, 0x2d, 0x05, 0xd8, 0xbc,
+  0xb4, 0xb4, 0xc7, 0xbc, 0x21, 0x86, 0x5d, 0x3d, 0xe4, 0xa8, 0x27, 0xbc,
+  0x89, 0xbb, 0x9f, 0x3d, 0xc8, 0xee, 0xc7, 0x3b, 0x8e, 0x71, 0xe8, 0xbd,
+  0x08, 0xff, 0x9f, 0x3c, 0x22, 0x04, 0xd2, 0x3c, 0x50, 0x7a, 0x3b, 0xbe,
+  0xca, 0xbd, 0xdd, 0xbd, 0xab, 0x82, 0x26, 0xbc, 0x01, 0x98, 0x23, 0xbd,
+  0xb0, 0xee, 0xb8, 0xbd, 0x37, 0x59, 0xab, 0xbd, 0xdf, 0x54, 0xe2, 0xbd,
+  0xd4, 0xff, 0xab, 0xbd, 0x7c, 0xac, 0x15, 0xbe, 0x95, 0x64, 0x25, 0xbd,
+  0x7e, 0xff, 0x48, 0xbc, 0x9c, 0x3c, 0x2e, 0xbd, 0xaf, 0x5a, 0x89, 0xbc,
+  0x6a, 0x0e, 0x08, 0xbe, 0x2e, 0x2f, 0xc4, 0x3c, 0x7b, 0x7a, 0x54, 0xbc,
+  0x5c, 0x07, 0x0b, 0xbe, 0xe4, 0x6d, 0x48, 0x3d, 0x7f, 0x32, 0x5c, 0x3d,
+  0x8f, 0xa7, 0x02, 0x3b, 0x43, 0x14, 0x04, 0xbc, 0x0a, 0x46, 0x2f, 0xbe,
+  0xcd, 0x74, 0x8d, 0x3c, 0x1b, 0x4a, 0x0c, 0x3d, 0x63, 0x2b, 0xed, 0xbd,
+  0x3f, 0x19, 0x89, 0x3d, 0xba, 0x9a, 0xee, 0x3c, 0xf4, 0xea, 0xcd, 0x3d,
+  0x26, 0x88, 0x59, 0xbd, 0xe9, 0x9e, 0x73, 0xbe, 0x67, 0xd4, 0x81, 0x3c,
+  0xad, 0x07, 0x86, 0x3c, 0x6f, 0x7e, 0x89, 0xbc, 0x5f, 0xc0, 0x23, 0x3e,
+  0x80, 0x24, 0x8f, 0x3d, 0x3f, 0x80, 0x2f, 0x3d, 0x8d, 0x93, 0x13, 0xbd,
+  0xc2, 0x10, 0x03, 0xbe, 0xac, 0xb2, 0x6d, 0xbc, 0xd2, 0xc9, 0x1c, 0xbc,
+  0x89, 0x27, 0x00, 0x3c, 0x4b, 0x66, 0x3f, 0x3e, 0x94, 0xe1, 0xad, 0xbc,
+  0xcb, 0xee, 0x39, 0xbd, 0x31, 0xa0, 0x20, 0xbd, 0x43, 0x7f, 0xc4, 0xbc,
+  0xb9, 0x70, 0x3d, 0x3d, 0x43, 0xd4, 0x87, 0x3d, 0xd2, 0xb3, 0xd7, 0x3d,
+  0xf4, 0x2c, 0x15, 0x3e, 0xe5, 0xca, 0xfd, 0xbb, 0xed, 0x04, 0xda, 0xbb,
+  0x43, 0x3f, 0xda, 0x3b, 0xa2, 0x42, 0x08, 0xbd, 0x11, 0x1f, 0x66, 0xbd,
+  0x4c, 0x12, 0x8b, 0xbd, 0xa1, 0x8b, 0x98, 0x3d, 0x0d, 0x10, 0x94, 0xbd,
+  0x83, 0x13, 0x74, 0xbd, 0x67, 0xfc, 0x14, 0xbd, 0x7c, 0x5c, 0xd2, 0x3b,
+  0x8c, 0x57, 0x50, 0x3d, 0x90, 0x74, 0x93, 0xbd, 0x1b, 0x23, 0xa1, 0xbd,
+  0x27, 0xea, 0x9a, 0x3d, 0xfb, 0x08, 0x9f, 0xbd, 0xf1, 0x8d, 0x3b, 0xbd,
+  0xab, 0x89, 0xe4, 0x3d, 0x0b, 0xc3, 0xf6, 0x3d, 0x56, 0x05, 0xb3, 0x3d,
+  0x88, 0x05, 0xb8, 0x3d, 0x8d, 0xa1, 0x90, 0x3c, 0x78, 0x18, 0x70, 0x3e,
+  0x91, 0x95, 0xe3, 0x3c, 0x2c, 0x00, 0x7f, 0xbc, 0x5b, 0x7b, 0xab, 0x3d,
+  0x58, 0x54, 0xa8, 0x3d, 0x9c, 0xd7, 0xec, 0x3a, 0xd2, 0x15, 0x78, 0x3d,
+  0xd3, 0xba, 0x1b, 0x3d, 0xd1, 0x55, 0x90, 0x3d, 0xfb, 0xe3, 0x0b, 0x3d,
+  0xb6, 0xaa, 0xec, 0xbb, 0x27, 0xaf, 0xa0, 0x3d, 0xa5, 0xba, 0xfd, 0x3d,
+  0xe7, 0xff, 0x43, 0xbc, 0xf8, 0xe7, 0x05, 0x3d, 0x38, 0x40, 0xd7, 0x3d,
+  0x01, 0x75, 0xa4, 0xbc, 0x2e, 0x46, 0x17, 0x3d, 0x9e, 0x0d, 0xd2, 0x3d,
+  0xd9, 0x2d, 0xad, 0x3d, 0xe3, 0x92, 0x84, 0x3d, 0x24, 0xd2, 0x50, 0xbe,
+  0x47, 0x8e, 0xee, 0x3d, 0x7e, 0x9d, 0xde, 0x3b, 0xd1, 0x27, 0x1f, 0xbe,
+  0x38, 0x3b, 0xa5, 0x3c, 0xb7, 0x9b, 0xe0, 0x3d, 0x4b, 0x74, 0x85, 0x3d,
+  0x0d, 0x1c, 0x7f, 0xbc, 0x3c, 0x7c, 0x6d, 0xbd, 0x7a, 0x10, 0x9c, 0x3c,
+  0x24, 0x67, 0x28, 0xbd, 0x42, 0x11, 0x83, 0xbd, 0xcf, 0xf8, 0xd8, 0xbd,
+  0x4a, 0x02, 0x11, 0xbd, 0x41, 0x76, 0x26, 0xbd, 0xa9, 0x78, 0x28, 0xbe,
+  0xfe, 0x09, 0x47, 0xbe, 0x2d, 0x0b, 0x99, 0xbd, 0x7e, 0x2e, 0x64, 0xbd,
+  0x89, 0x24, 0x41, 0xbe, 0x62, 0xfb, 0xb6, 0xbc, 0xc5, 0xa5, 0x7c, 0xbd,
+  0xd2, 0x64, 0x85, 0x3d, 0xd0, 0xa2, 0x81, 0xbc, 0x4f, 0x3c, 0xb4, 0xbd,
+  0x82, 0xbe, 0xbb, 0xbc, 0x48, 0xcb, 0x31, 0x3d, 0xcc, 0xf2, 0x37, 0xbe,
+  0xae, 0xe5, 0x62, 0x3d, 0xb6, 0xc7, 0x93, 0x3d, 0x15, 0x39, 0xa3, 0x3d,
+  0xb6, 0x0e, 0x19, 0xbd, 0x12, 0x1f, 0x38, 0xbd, 0x65, 0x36, 0x82, 0xbb,
+  0xae, 0xe2, 0x03, 0x3d, 0xb9, 0xa0, 0x1c, 0xbe, 0xb7, 0x63, 0xa2, 0x3d,
+  0x39, 0xdf, 0xf4, 0x3b, 0x42, 0x3d, 0x5a, 0xbd, 0x54, 0x26, 0x1f, 0x3d,
+  0x47, 0xf3, 0xa2, 0xbd, 0x98, 0x4d, 0x5b, 0xbd, 0xc4, 0xf1, 0xa7, 0x3a,
+  0x7b, 0xaa, 0x4c, 0xbe, 0xf0, 0x73, 0x31, 0x3e, 0x49, 0x35, 0xdf, 0x3c,
+  0xb7, 0x91, 0xa5, 0xbc, 0xab, 0xc0, 0x5c, 0x3d, 0x98, 0x35, 0xac, 0x3d,
+  0xec, 0xd4, 0x90, 0xbc, 0x66, 0x2e, 0x1f, 0xbd, 0x89, 0xbc, 0xbb, 0x3b,
+  0x8c, 0x56, 0x81, 0x3e, 0xa7, 0x81, 0x44, 0xba, 0xe7, 0x7b, 0x0d, 0x3c,
+  0x39, 0xc7, 0x70, 0x3b, 0xf3, 0x44, 0x16, 0x3e, 0x0d, 0x78, 0xef, 0xbc,
+  0x9c, 0x66, 0xba, 0x3d, 0xd4, 0x18, 0xe5, 0xbd, 0xd2, 0x5a, 0x03, 0x3e,
+  0xcd, 0x34, 0x05, 0xbd, 0x88, 0x8c, 0x75, 0xbd, 0x21, 0x36, 0x2a, 0xbe,
+  0xcc, 0x24, 0x57, 0xbe, 0xeb, 0xa2, 0x96, 0x3c, 0x69, 0x14, 0xb4, 0x3d,
+  0x1a, 0x8a, 0x47, 0x3e, 0x49, 0x79, 0x1c, 0x3d, 0x12, 0x45, 0xf0, 0xbb,
+  0x87, 0x32, 0x78, 0x3d, 0x14, 0xfe, 0xd3, 0x3c, 0x93, 0x31, 0x75, 0xbe,
+  0x7b, 0x67, 0xb8, 0x3b, 0xa2, 0x2f, 0x41, 0xbd, 0x49, 0xd9, 0x0f, 0x3e,
+  0x0a, 0x6f, 0x1b, 0xbe, 0xb4, 0x60, 0x8b, 0xbd, 0x79, 0x92, 0x14, 0x3d,
+  0xcd, 0x8d, 0x35, 0x3e, 0x5d, 0xde, 0x13, 0xbd, 0xbc, 0x65, 0xe9, 0x3c,
+  0x94, 0x88, 0x39, 0xbd, 0xa8, 0xda, 0x1e, 0x3e, 0xb0, 0xb5, 0xb8, 0xbd,
+  0x08, 0xe9, 0x8e, 0xbc, 0x0c, 0xe1, 0xb3, 0x3d, 0x20, 0xf8, 0x20, 0x3e,
+  0xd9, 0x3c, 0x16, 0xbc, 0x28, 0x1a, 0x51, 0x3d, 0x69, 0x99, 0xd3, 0xbb,
+  0xe1, 0x4b, 0xfc, 0x3d, 0xf9, 0x6f, 0xad, 0x3c, 0xf8, 0xdc, 0x1c, 0x3d,
+  0xbe, 0x05, 0xa9, 0x3d, 0x86, 0x93, 0x2b, 0x3e, 0x49, 0x41, 0xca, 0xbd,
+  0x19, 0x54, 0x06, 0x3e, 0x01, 0x09, 0x9c, 0x3d, 0x2e, 0xc1, 0xc0, 0xbd,
+  0x8b, 0x08, 0xf7, 0x3d, 0xf4, 0x07, 0x99, 0x3d, 0x3e, 0xbf, 0x83, 0x3d,
+  0x8d, 0xe8, 0xb7, 0x3d, 0xcb, 0xf5, 0x2d, 0xbe, 0xd1, 0xc0, 0x2b, 0x3d,
+  0xad, 0x38, 0x91, 0x3b, 0xc1, 0xbe, 0x50, 0xbe, 0x4a, 0x9c, 0x83, 0x3d,
+  0x8b, 0xe1, 0xd8, 0x3d, 0xf4, 0x91, 0x91, 0xbc, 0xcf, 0xdf, 0x21, 0x3c,
+  0x98, 0x99, 0x0e, 0xbe, 0xc3, 0x7d, 0x54, 0x3d, 0xcc, 0xea, 0x9c, 0x3d,
+  0xc1, 0x0d, 0x20, 0xbe, 0x78, 0xf9, 0x04, 0xbe, 0x31, 0x03, 0x2b, 0xbd,
+  0x0e, 0x47, 0x80, 0x3c, 0x56, 0x33, 0x84, 0xbd, 0x00, 0xd4, 0x40, 0xbe,
+  0xfd, 0xbb, 0x72, 0xbd, 0xc4, 0x42, 0x20, 0xbd, 0x36, 0x3f, 0x1b, 0xbe,
+  0xe8, 0x6f, 0x09, 0xbe, 0xf7, 0x23, 0xf9, 0x3c, 0x8a, 0x24, 0xe4, 0xbc,
+  0x86, 0x9c, 0xb7, 0xbc, 0xfd, 0x12, 0x87, 0xbd, 0x0f, 0x98, 0x3e, 0x3b,
+  0x10, 0x4f, 0xf6, 0xbd, 0x0e, 0x27, 0x1c, 0xbd, 0x73, 0xd0, 0xaa, 0xbb,
+  0x02, 0x07, 0x91, 0x3b, 0xe5, 0x41, 0x4b, 0xbd, 0x94, 0xbf, 0xbd, 0x3d,
+  0x8d, 0x24, 0x36, 0xbc, 0x89, 0xc6, 0x0a, 0xbd, 0xcf, 0xd2, 0xf9, 0xbc,
+  0x64, 0xd8, 0xd4, 0x3c, 0x99, 0x54, 0x25, 0x3d, 0xc5, 0x50, 0xe3, 0x3c,
+  0x70, 0xc9, 0x18, 0x3c, 0x8c, 0x13, 0x04, 0x3d, 0x51, 0x6f, 0x37, 0x3e,
+  0x90, 0xe2, 0x5c, 0xbd, 0x04, 0x58, 0x7b, 0x3b, 0xce, 0x1e, 0xbb, 0x3d,
+  0xe7, 0x75, 0x1b, 0x3e, 0x5e, 0x3e, 0x2e, 0x3d, 0x1c, 0x48, 0x94, 0xbd,
+  0x0b, 0xdf, 0x8e, 0xbd, 0xe3, 0x87, 0x59, 0x3e, 0x5a, 0x5a, 0xa3, 0xbd,
+  0xd0, 0x39, 0x1f, 0xbd, 0x8f, 0xd7, 0x9c, 0xbb, 0x04, 0x2c, 0x55, 0x3e,
+  0xd0, 0x47, 0x4b, 0x3d, 0x13, 0x14, 0x3b, 0x3c, 0xab, 0x1a, 0x27, 0x3b,
+  0xa8, 0xe4, 0x5c, 0x3d, 0xed, 0xdd, 0x52, 0x3d, 0xb5, 0xbd, 0xae, 0x3d,
+  0x60, 0x24, 0x50, 0xbe, 0x8b, 0x55, 0x46, 0x3e, 0x9f, 0xef, 0xa2, 0x3d,
+  0xe9, 0x51, 0xa0, 0x3b, 0xaf, 0x8d, 0x0a, 0xbd, 0xb7, 0x54, 0x7d, 0xbe,
+  0xf4, 0xf0, 0x57, 0xbc, 0xa4, 0xeb, 0x16, 0x3d, 0xe5, 0xee, 0xbc, 0x3d,
+  0x18, 0xb7, 0xe6, 0xbc, 0x80, 0xc8, 0xe8, 0x3c, 0x5b, 0xff, 0xa8, 0x3d,
+  0xc7, 0xc5, 0x5f, 0x3d, 0x83, 0xe4, 0x31, 0xbe, 0x98, 0x8b, 0x33, 0xbb,
+  0xb8, 0x52, 0x7a, 0x3c, 0x96, 0x64, 0x80, 0x3e, 0x10, 0x56, 0xe1, 0xbd,
+  0xbf, 0x9c, 0xdf, 0xbd, 0x57, 0x23, 0x6a, 0x3c, 0xfa, 0xf0, 0xaa, 0x3d,
+  0x4d, 0x49, 0x15, 0x3e, 0x7e, 0x06, 0x87, 0x3d, 0xbe, 0x1d, 0xa9, 0xbd,
+  0xf7, 0x16, 0x0d, 0x3e, 0xef, 0xc1, 0xb4, 0xbd, 0x30, 0x12, 0xa1, 0xbc,
+  0x0b, 0xfe, 0x67, 0xbc, 0x98, 0xc9, 0x2c, 0x3e, 0x54, 0x86, 0xbd, 0x3d,
+  0xf8, 0x5a, 0x0c, 0xbd, 0xe2, 0x45, 0xf6, 0xbd, 0x6a, 0x85, 0xba, 0xbc,
+  0xc7, 0xe7, 0x37, 0xbc, 0x0b, 0x9e, 0x81, 0xbd, 0x09, 0x9b, 0xdb, 0xbc,
+  0xb7, 0x89, 0x89, 0x3d, 0x1b, 0xd9, 0xee, 0x3d, 0xbe, 0x72, 0x4c, 0xbc,
+  0xab, 0x8c, 0x05, 0xbd, 0xaf, 0x4b, 0x94, 0xbd, 0x73, 0x7f, 0xc5, 0xbc,
+  0xdf, 0xa6, 0x08, 0x3d, 0x98, 0xa7, 0x89, 0xbd, 0xf9, 0x8e, 0xd9, 0x3d,
+  0x18, 0xb2, 0xaf, 0xbc, 0x34, 0xc5, 0x87, 0x3c, 0x6d, 0x14, 0xab, 0xbc,
+  0x2f, 0xbe, 0x56, 0xbe, 0x6c, 0xbc, 0xbe, 0x3c, 0x55, 0x2f, 0xc0, 0xbc,
+  0x3c, 0x32, 0x8b, 0xbd, 0xc6, 0x94, 0x61, 0x3d, 0xd8, 0x3f, 0x1a, 0xbe,
+  0xcb, 0x6f, 0xd6, 0xbc, 0xfe, 0x1f, 0xac, 0xbb, 0x36, 0xc7, 0x90, 0xbd,
+  0x1d, 0x11, 0xbb, 0xbd, 0xc0, 0xf5, 0xdb, 0xbd, 0x1b, 0xae, 0xff, 0xbd,
+  0xec, 0xac, 0x48, 0xbd, 0x78, 0x5b, 0x01, 0xbe, 0xeb, 0x3a, 0x08, 0xbe,
+  0x4d, 0xd3, 0x8e, 0xbd, 0xc9, 0x86, 0xc3, 0xbd, 0xba, 0x86, 0xfd, 0xbd,
+  0x2b, 0x33, 0xd5, 0xbc, 0xb6, 0x5b, 0x52, 0xbe, 0xa6, 0x13, 0x1e, 0xbe,
+  0xd7, 0x18, 0x2c, 0xbe, 0xd1, 0xfb, 0xea, 0xbd, 0xce, 0x0a, 0xed, 0xbd,
+  0xaa, 0xe4, 0xcb, 0x3d, 0xa1, 0xc4, 0x02, 0xba, 0x3f, 0x9d, 0xa3, 0xbc,
+  0xf8, 0x2d, 0x3b, 0xbd, 0xec, 0x93, 0xf8, 0xbd, 0x88, 0x77, 0xfe, 0xbd,
+  0xba, 0x30, 0x91, 0xbb, 0xed, 0xaa, 0x86, 0xbd, 0x6c, 0x0a, 0xd5, 0x3d,
+  0xc4, 0x4c, 0x9e, 0x3c, 0x4a, 0x10, 0x4e, 0xbb, 0x06, 0x7a, 0x14, 0x3d,
+  0x58, 0x85, 0x57, 0xbd, 0xd9, 0xf4, 0xae, 0xbd, 0x93, 0x3a, 0x84, 0x3d,
+  0x49, 0xe0, 0x83, 0x3d, 0x81, 0x67, 0x1a, 0x3e, 0x70, 0x1a, 0x4c, 0xbd,
+  0x88, 0xbb, 0x44, 0xbd, 0x46, 0xf4, 0xee, 0x3c, 0x75, 0xc9, 0x8f, 0x3c,
+  0x5f, 0xec, 0x34, 0xbe, 0x1f, 0x17, 0x07, 0x3d, 0x59, 0xc9, 0x8d, 0x3d,
+  0xd8, 0x40, 0xe6, 0xbb, 0x9c, 0x86, 0x74, 0x3d, 0x72, 0x19, 0x9e, 0x3d,
+  0x1f, 0x68, 0x21, 0x3e, 0x7c, 0xd5, 0x81, 0x3d, 0xb0, 0xba, 0x1f, 0xbe,
+  0x7d, 0x0c, 0x07, 0x3e, 0x65, 0x6f, 0x1d, 0x3e, 0xc1, 0x8f, 0x3c, 0xbe,
+  0x17, 0x9a, 0x06, 0x3e, 0x00, 0x5c, 0xb6, 0x3d, 0x4c, 0x73, 0xb7, 0x3d,
+  0xea, 0x55, 0xc8, 0x3d, 0x3e, 0x66, 0x33, 0xbe, 0x53, 0xfa, 0x2f, 0x3d,
+  0x82, 0xac, 0x0e, 0xbd, 0x98, 0xdd, 0xb4, 0x3d, 0xe5, 0xe4, 0x6f, 0x3d,
+  0xa0, 0xbe, 0x07, 0x3d, 0x6c, 0x46, 0xe6, 0xbd, 0xd4, 0xb4, 0x90, 0x3b,
+  0xba, 0xc1, 0x89, 0x3d, 0xec, 0xd5, 0x81, 0xbd, 0x54, 0x67, 0x6a, 0xbd,
+  0xe3, 0xe5, 0x62, 0x3e, 0xbe, 0x8f, 0x63, 0xbc, 0x5d, 0x98, 0xe2, 0xbc,
+  0x87, 0x0a, 0xc3, 0xbd, 0x85, 0xea, 0xa8, 0x3d, 0x10, 0x0c, 0x4e, 0x3e,
+  0xbc, 0xe7, 0x9a, 0xbd, 0xa3, 0x0a, 0x73, 0xbd, 0xdb, 0xe2, 0x83, 0x3d,
+  0x9b, 0x2c, 0x39, 0x3d, 0xfc, 0x87, 0x04, 0xbe, 0x66, 0x6e, 0x55, 0xbe,
+  0xda, 0x94, 0x39, 0xbd, 0x91, 0x1c, 0x27, 0x3e, 0x94, 0x32, 0x3e, 0xbe,
+  0xaa, 0x78, 0x12, 0xbe, 0xbd, 0xd6, 0xc1, 0x3d, 0x48, 0xe7, 0x8a, 0xbd,
+  0x75, 0x21, 0xd0, 0xbd, 0x9b, 0x5d, 0x4f, 0xbe, 0x69, 0x9d, 0x12, 0xbd,
+  0xaa, 0xe3, 0x6f, 0x3d, 0x74, 0x79, 0x38, 0xbe, 0xb7, 0xd3, 0x5b, 0xbd,
+  0x89, 0x7b, 0x98, 0x3c, 0x0a, 0xfd, 0x80, 0xbd, 0x2d, 0x29, 0x63, 0xbc,
+  0x99, 0x1a, 0x9f, 0xbd, 0x89, 0x4d, 0x3f, 0xbe, 0xb6, 0xd2, 0xba, 0xbd,
+  0x9d, 0x49, 0xe2, 0xbd, 0x2c, 0x83, 0xa6, 0xbd, 0xbe, 0x62, 0x2b, 0xbe,
+  0xe8, 0xdb, 0xe5, 0xbd, 0xe0, 0xac, 0xd3, 0x37, 0x92, 0x9c, 0x76, 0x3d,
+  0xfe, 0x8b, 0xa6, 0xba, 0x48, 0x71, 0xc6, 0xbd, 0x49, 0x70, 0xd4, 0xbc,
+  0x75, 0x35, 0x82, 0xbd, 0xd3, 0x8b, 0x43, 0xbe, 0x80, 0x1e, 0x43, 0xbe,
+  0x0b, 0x8a, 0xd8, 0xbd, 0xbc, 0x76, 0x32, 0xbd, 0x2b, 0xdc, 0x87, 0xbd,
+  0x5d, 0x53, 0xbd, 0xbd, 0x41, 0x6d, 0x07, 0xbd, 0x5a, 0xd8, 0x0c, 0xbe,
+  0x41, 0x53, 0xc7, 0xbd, 0x70, 0xda, 0x62, 0xbc, 0x53, 0x31, 0xa0, 0xbd,
+  0x93, 0xb5, 0x89, 0xbd, 0x50, 0xb8, 0x51, 0xbe, 0x0b, 0x90, 0x24, 0xbe,
+  0x94, 0x34, 0xcd, 0xbd, 0x61, 0x65, 0xe4, 0xbd, 0x76, 0x42, 0x28, 0xbd,
+  0xce, 0x03, 0xdd, 0xbd, 0x83, 0x4f, 0x1f, 0xbd, 0x39, 0xaf, 0xaa, 0x3d,
+  0x56, 0x5e, 0x12, 0xbd, 0x36, 0xc4, 0x9f, 0xbe, 0xbb, 0xda, 0x46, 0xbc,
+  0x4d, 0x2b, 0xad, 0xbc, 0x57, 0x33, 0xbd, 0xbc, 0xf7, 0xa4, 0xce, 0xbb,
+  0x22, 0xc8, 0xa3, 0x3a, 0xc2, 0x06, 0xb6, 0x3d, 0x30, 0x7c, 0xdf, 0x3d,
+  0x59, 0x07, 0xdd, 0xbe, 0x28, 0xe2, 0x0c, 0x3e, 0x0f, 0x51, 0x9d, 0x3b,
+  0xe7, 0xe5, 0x22, 0xbb, 0xa7, 0x99, 0x78, 0xbd, 0xf0, 0xe3, 0xcc, 0x3d,
+  0xd7, 0x3b, 0x16, 0x3e, 0x19, 0xb3, 0x0c, 0x3e, 0x87, 0x1f, 0xc4, 0xbe,
+  0x09, 0x7d, 0x13, 0x3e, 0xbc, 0x71, 0x0c, 0x3e, 0xc9, 0xea, 0xf1, 0xbd,
+  0xed, 0x11, 0x8c, 0x3d, 0x0a, 0x64, 0x7e, 0x3d, 0xd3, 0xe5, 0x60, 0x3e,
+  0x13, 0x82, 0x2e, 0x3e, 0xfa, 0x52, 0x7d, 0xbe, 0x21, 0x09, 0xe3, 0x3d,
+  0xa7, 0x89, 0x91, 0x3d, 0xdb, 0xc5, 0xc0, 0xbe, 0xd9, 0x6e, 0xc2, 0x3d,
+  0x47, 0x3f, 0x54, 0x3d, 0x31, 0x93, 0x6f, 0xbd, 0x48, 0x82, 0x90, 0x3d,
+  0xad, 0xc9, 0x11, 0xbe, 0x19, 0xc2, 0x8e, 0xbc, 0xbe, 0x4a, 0xae, 0xbc,
+  0x18, 0x78, 0x9b, 0xbd, 0xa2, 0xcf, 0x12, 0x3e, 0x29, 0x3b, 0x80, 0xbd,
+  0x76, 0x87, 0x83, 0xbd, 0xb0, 0xe9, 0xc2, 0xbd, 0xc7, 0xee, 0xb7, 0x3c,
+  0x6b, 0x11, 0x62, 0xbd, 0x9b, 0x03, 0x94, 0x3d, 0xfe, 0xb5, 0xdd, 0x3d,
+  0xe9, 0xb1, 0x1c, 0x3e, 0x3a, 0x8f, 0xc8, 0xbd, 0x92, 0x22, 0xca, 0xbd,
+  0x1a, 0xb2, 0x47, 0xbd, 0x02, 0xc5, 0xdf, 0x3d, 0x0d, 0x42, 0xf6, 0xbd,
+  0x24, 0xfc, 0x4e, 0xbd, 0x62, 0x54, 0xcd, 0xbc, 0x15, 0xcb, 0x4c, 0x3d,
+  0x45, 0x5b, 0xab, 0xbd, 0xa6, 0x53, 0xa4, 0xbd, 0xd7, 0x83, 0x2c, 0xbe,
+  0x78, 0xe3, 0x4b, 0x3d, 0xde, 0x47, 0x23, 0xbd, 0xd5, 0x70, 0x1c, 0x3c,
+  0xae, 0xf3, 0x5b, 0xbd, 0xd4, 0x32, 0x26, 0xbb, 0xc4, 0xae, 0x72, 0xbd,
+  0xe5, 0xee, 0x00, 0xbd, 0x7d, 0xb2, 0xc8, 0xbd, 0xe8, 0x97, 0x52, 0xbe,
+  0xc5, 0x80, 0xfc, 0xbd, 0x8a, 0x90, 0xb0, 0xbd, 0x42, 0x53, 0xf9, 0xbd,
+  0x6d, 0x8d, 0x14, 0xbd, 0x7d, 0xde, 0x4b, 0xbd, 0xac, 0x23, 0x74, 0x3d,
+  0x67, 0x84, 0xb6, 0xbd, 0x00, 0xf6, 0x8e, 0xbe, 0x95, 0x60, 0x8e, 0x3c,
+  0x20, 0x0f, 0xb9, 0x3d, 0xd6, 0xaf, 0x11, 0xbe, 0xf2, 0xc3, 0x7d, 0xbd,
+  0xdc, 0x74, 0xa1, 0xbb, 0xbf, 0x8b, 0x4b, 0xbe, 0x60, 0x1b, 0x93, 0xbd,
+  0xa9, 0x99, 0x3d, 0xbe, 0xc1, 0xc7, 0x7c, 0x3c, 0x05, 0x06, 0x16, 0xbe,
+  0x23, 0x57, 0xd8, 0xbd, 0xab, 0x4f, 0x36, 0xbe, 0x64, 0x28, 0xb7, 0xbd,
+  0x6e, 0xc3, 0x57, 0xbe, 0xbb, 0x01, 0x82, 0xbe, 0x98, 0x3e, 0xd6, 0xbd,
+  0x4a, 0x71, 0x0d, 0xbe, 0x26, 0xfa, 0x06, 0xbe, 0xe0, 0xb6, 0xe0, 0xbd,
+  0x66, 0x43, 0x20, 0xbd, 0x96, 0xee, 0xf4, 0x3c, 0x8c, 0x24, 0xe8, 0xbb,
+  0xb8, 0xf8, 0x0d, 0xbe, 0x30, 0xc3, 0x08, 0xbe, 0xb0, 0xdc, 0x13, 0xbd,
+  0x27, 0x1e, 0x80, 0xbd, 0x08, 0x41, 0x07, 0xbe, 0xda, 0xa8, 0x87, 0x3c,
+  0x63, 0x41, 0x7b, 0xbd, 0x1a, 0x71, 0x45, 0x3c, 0xa7, 0x57, 0xc0, 0xbd,
+  0xbe, 0xb1, 0xad, 0xbe, 0x18, 0x80, 0x51, 0x3c, 0x75, 0x4b, 0x23, 0x3d,
+  0x1f, 0xbc, 0x3f, 0xbe, 0x07, 0x66, 0x67, 0xbd, 0xad, 0x33, 0xd4, 0x3b,
+  0x14, 0x34, 0x05, 0x3e, 0x37, 0xed, 0x8d, 0x3d, 0x32, 0xf9, 0x00, 0xbf,
+  0x9e, 0xbf, 0xd5, 0x3d, 0x00, 0xf2, 0x65, 0x3d, 0x36, 0x74, 0x14, 0xbe,
+  0xe1, 0xae, 0xc6, 0xbd, 0x65, 0x16, 0x07, 0x3c, 0x7b, 0xf7, 0xb6, 0x3d,
+  0x19, 0x8d, 0xb6, 0x3d, 0x4f, 0x56, 0xc3, 0xbe, 0x24, 0x55, 0x12, 0x3e,
+  0x12, 0x2c, 0x44, 0xbd, 0x50, 0x35, 0x13, 0xbe, 0xd2, 0x45, 0xc3, 0xbd,
+  0xd8, 0x55, 0xe0, 0xbc, 0x14, 0x7b, 0x08, 0x3d, 0xc2, 0xee, 0x0b, 0x3e,
+  0x00, 0x20, 0x7a, 0xbe, 0x22, 0x54, 0xfc, 0x3d, 0x14, 0x21, 0x11, 0xbd,
+  0x7f, 0x09, 0x2e, 0xbe, 0x49, 0x7a, 0x92, 0x3c, 0x6c, 0x0d, 0x5d, 0xbc,
+  0xab, 0x0b, 0xf5, 0xbc, 0x96, 0xb9, 0x4a, 0xbc, 0xfd, 0x4f, 0x54, 0xbe,
+  0x85, 0xee, 0x91, 0x3c, 0x8c, 0x3d, 0x7e, 0xbb, 0x3e, 0x6d, 0x53, 0xbd,
+  0xcc, 0x39, 0xa5, 0x3c, 0x06, 0x36, 0x63, 0xbc, 0x2f, 0xd4, 0x06, 0xbd,
+  0x7b, 0xf8, 0xe7, 0x3b, 0x39, 0x1c, 0x03, 0xbd, 0x21, 0x9c, 0xa3, 0xbc,
+  0x79, 0x38, 0xbc, 0xbc, 0xdc, 0x10, 0xfb, 0xbd, 0xc7, 0xbc, 0xca, 0x3d,
+  0x7a, 0xf5, 0x0b, 0x3c, 0xc2, 0x19, 0x49, 0xbb, 0x81, 0xdd, 0x7c, 0xbd,
+  0xb0, 0x3c, 0xb7, 0xbd, 0x23, 0x44, 0x18, 0xbb, 0xe5, 0xbc, 0x84, 0xbd,
+  0x00, 0x7a, 0x08, 0xbe, 0x7e, 0xd9, 0x91, 0xbc, 0x36, 0x00, 0x29, 0x3c,
+  0x2e, 0x27, 0x00, 0xbd, 0xc5, 0x9e, 0x3a, 0xbe, 0x94, 0x42, 0x84, 0xbe,
+  0xdf, 0x39, 0x11, 0xbd, 0x60, 0x1b, 0xac, 0x3c, 0x24, 0x31, 0x16, 0xbe,
+  0xaf, 0x25, 0xb9, 0x3d, 0x83, 0x9b, 0xf6, 0xbc, 0xb5, 0x8d, 0xf2, 0x3c,
+  0xf2, 0x6f, 0xd8, 0xbc, 0x25, 0xb1, 0x80, 0xbe, 0xdb, 0x52, 0x2d, 0xbd,
+  0xed, 0x9a, 0x5d, 0x3c, 0xa7, 0x8d, 0x90, 0xbe, 0x87, 0x4e, 0x26, 0xbc,
+  0x16, 0x38, 0x51, 0xbb, 0x3f, 0x0a, 0xca, 0x3d, 0x8b, 0x5d, 0xc5, 0x3d,
+  0x78, 0xc6, 0xbe, 0xbd, 0x31, 0x41, 0xce, 0x3c, 0x8a, 0x4a, 0x57, 0x3b,
+  0x72, 0x49, 0x3a, 0xbe, 0x45, 0x55, 0xa0, 0xbc, 0xea, 0x7f, 0x06, 0xbc,
+  0x9f, 0xd9, 0x8e, 0xbe, 0x9e, 0xd1, 0xa7, 0x3c, 0x6c, 0x0e, 0xd4, 0xbd,
+  0xef, 0x25, 0x76, 0xbe, 0xc0, 0x70, 0xd5, 0xbd, 0xa8, 0x4c, 0x01, 0xbe,
+  0x08, 0x06, 0x13, 0xbe, 0xf2, 0x33, 0x4c, 0xbd, 0x96, 0x7a, 0x1b, 0xbe,
+  0x8f, 0x61, 0x39, 0xbe, 0xae, 0x1f, 0xa4, 0xbd, 0x3d, 0xb4, 0xe8, 0xbd,
+  0x5c, 0x4c, 0xc3, 0xbd, 0x83, 0xb2, 0x47, 0xbe, 0x05, 0x67, 0x82, 0xbd,
+  0x7f, 0x1a, 0x2b, 0x3d, 0x24, 0x55, 0x88, 0xbd, 0x6b, 0x30, 0x17, 0xbe,
+  0x6b, 0x6e, 0x49, 0xbe, 0x01, 0xb6, 0xdb, 0xbd, 0x1e, 0xb8, 0xd4, 0x3c,
+  0x3e, 0x5f, 0xd4, 0xbe, 0x2a, 0x1a, 0x51, 0x3d, 0x59, 0x5d, 0x40, 0x3b,
+  0xfb, 0xfa, 0x9c, 0xbc, 0xd3, 0x23, 0xa7, 0xbd, 0xd5, 0x20, 0x86, 0xbd,
+  0x1e, 0x58, 0x65, 0x3d, 0x4f, 0xae, 0x6a, 0x3d, 0xef, 0xa7, 0x6c, 0xbe,
+  0x12, 0xc4, 0x99, 0x3c, 0xb2, 0x1c, 0x3b, 0xbc, 0xf7, 0xee, 0x9b, 0x3c,
+  0xb5, 0xe8, 0xdb, 0xbc, 0x72, 0xb9, 0xee, 0xbd, 0xe0, 0x87, 0xcd, 0xbc,
+  0xb4, 0x91, 0x3d, 0xbd, 0x1f, 0x3f, 0x81, 0xbc, 0x5b, 0x25, 0x54, 0x3d,
+  0x06, 0x1b, 0x1e, 0xbe, 0x29, 0xf8, 0xe5, 0xbc, 0xff, 0xc5, 0x3e, 0xbd,
+  0xbd, 0x42, 0x65, 0xbd, 0xd8, 0xf8, 0x7f, 0x3c, 0x8f, 0x8e, 0x83, 0xbd,
+  0x03, 0xd6, 0xd8, 0x3d, 0xce, 0xe4, 0xae, 0x3d, 0xe6, 0xbe, 0x9f, 0xbd,
+  0xa0, 0xd2, 0xd5, 0x3d, 0xc7, 0xe9, 0x81, 0xbd, 0xf9, 0x07, 0x9b, 0x3d,
+  0x4a, 0x74, 0x0a, 0xbd, 0xc5, 0xd8, 0xf3, 0x3c, 0xf9, 0x85, 0x14, 0x3e,
+  0x7e, 0xdf, 0xf4, 0x3d, 0x3f, 0xb1, 0xe7, 0xbc, 0x5e, 0xcf, 0x09, 0x3e,
+  0x5c, 0xa3, 0x9d, 0x3d, 0xcf, 0x33, 0x74, 0x3d, 0xe5, 0xe2, 0xad, 0x3c,
+  0xf7, 0xf2, 0x49, 0x3d, 0x2b, 0xa7, 0x29, 0x3e, 0x6e, 0xad, 0x8e, 0x3d,
+  0x51, 0x43, 0x52, 0xbd, 0x9f, 0xcb, 0xd9, 0x3d, 0xdd, 0xbb, 0x8a, 0x3c,
+  0x85, 0xd3, 0xcf, 0x3d, 0x9f, 0x03, 0x66, 0x3d, 0x15, 0xca, 0xde, 0xbc,
+  0x7d, 0xa0, 0x09, 0xbc, 0x95, 0xa5, 0x6a, 0xbd, 0x8b, 0x2a, 0xbd, 0xbb,
+  0x7c, 0x93, 0xa2, 0x3c, 0x40, 0x11, 0x35, 0x3d, 0xb4, 0x12, 0x1f, 0xbe,
+  0x55, 0x67, 0x7a, 0x3d, 0x60, 0x56, 0x9b, 0xbc, 0x71, 0xb2, 0xc8, 0xbd,
+  0xf5, 0x74, 0x9b, 0xbc, 0x7f, 0xf5, 0x1b, 0x3d, 0x50, 0x97, 0xb7, 0x3b,
+  0x76, 0x98, 0xd1, 0x3c, 0x1c, 0x95, 0xf0, 0xbd, 0x58, 0xf7, 0xc0, 0xbc,
+  0xf3, 0x46, 0x60, 0x3d, 0x19, 0x81, 0xa2, 0xbe, 0x48, 0x8c, 0x85, 0x3d,
+  0x3f, 0xe2, 0x8f, 0x3d, 0x98, 0x30, 0xa3, 0x3d, 0x22, 0x17, 0xb3, 0x3c,
+  0xd6, 0xd6, 0x0a, 0xbe, 0xc8, 0x13, 0x87, 0xbc, 0xc2, 0x9d, 0xa9, 0x3d,
+  0x06, 0xe1, 0x21, 0xbe, 0xe2, 0x65, 0xce, 0xbb, 0xc1, 0xf3, 0xcb, 0x3d,
+  0x41, 0x3b, 0x92, 0xbc, 0x66, 0xb1, 0xc6, 0xbc, 0x28, 0x16, 0xa4, 0xbd,
+  0x9a, 0x10, 0x6f, 0x3c, 0x0e, 0x86, 0x67, 0x3d, 0x72, 0xe4, 0x1b, 0xbe,
+  0xad, 0x9b, 0x25, 0xbe, 0xea, 0xc7, 0x01, 0xbe, 0xf7, 0x4b, 0x68, 0xbe,
+  0x4c, 0x52, 0x0f, 0xbe, 0xde, 0xe5, 0x99, 0xbd, 0x8e, 0x60, 0xb3, 0xbe,
+  0xd2, 0xb1, 0x1f, 0xbe, 0x25, 0xe5, 0x29, 0xbe, 0x31, 0x95, 0x03, 0xbe,
+  0x00, 0x8d, 0x7c, 0xbd, 0x96, 0x9e, 0x02, 0xbe, 0x71, 0xa8, 0x32, 0xbe,
+  0x5c, 0xb4, 0xef, 0xbd, 0x69, 0x3b, 0x49, 0xbd, 0x32, 0x87, 0xdd, 0xbd,
+  0xaa, 0xfd, 0x82, 0xbe, 0x50, 0xf3, 0x36, 0xbe, 0xf2, 0x68, 0x21, 0xbd,
+  0x5d, 0x31, 0x0e, 0xbe, 0x9c, 0xf4, 0x4b, 0xbd, 0x89, 0xbf, 0xc8, 0xbd,
+  0xb1, 0xbc, 0x60, 0xbd, 0xca, 0xc5, 0x3d, 0xbe, 0xba, 0x6b, 0xa6, 0xbe,
+  0x37, 0xe7, 0x10, 0xbe, 0xbd, 0x57, 0x3d, 0x3d, 0x1f, 0x3b, 0x86, 0xbc,
+  0x9b, 0x48, 0x98, 0xbd, 0x85, 0xb0, 0xb1, 0x3c, 0x4d, 0x91, 0x63, 0xbd,
+  0xf0, 0x51, 0xfa, 0xbd, 0x31, 0x21, 0x55, 0xbe, 0x52, 0x7f, 0x43, 0x3d,
+  0xdb, 0x53, 0x42, 0xbd, 0xdd, 0xf9, 0xae, 0xbd, 0x1a, 0xb0, 0x9b, 0xbd,
+  0xfb, 0xa9, 0xf1, 0xbb, 0x3d, 0x15, 0x82, 0xbd, 0x9f, 0x14, 0x59, 0xbc,
+  0x93, 0xd6, 0x46, 0x3d, 0xc6, 0x9a, 0x03, 0xbd, 0x82, 0xce, 0x57, 0xbd,
+  0x02, 0xbf, 0xb4, 0xbd, 0x7a, 0xfe, 0x85, 0xbd, 0xce, 0x22, 0x5f, 0x3d,
+  0x1a, 0x96, 0xd9, 0xbd, 0xc9, 0x16, 0x42, 0xbd, 0x3e, 0xdc, 0x3e, 0x3e,
+  0x43, 0x62, 0xa5, 0x3c, 0x6d, 0x83, 0x95, 0x3d, 0xe9, 0x1d, 0x2c, 0x3d,
+  0x71, 0x58, 0x95, 0xbc, 0xcd, 0x17, 0xb0, 0x3d, 0xba, 0xb5, 0x6c, 0x3d,
+  0xff, 0xeb, 0xd3, 0x3b, 0xbb, 0xb3, 0x7d, 0x3e, 0xdb, 0x2e, 0xf4, 0x3d,
+  0xc3, 0xec, 0xe8, 0x3c, 0xa3, 0x32, 0x8f, 0x3c, 0x9b, 0x1c, 0x52, 0x3d,
+  0x69, 0x14, 0x97, 0x3d, 0x35, 0xf4, 0x97, 0x3d, 0x12, 0x5b, 0x88, 0x3d,
+  0x7e, 0x52, 0x74, 0x3e, 0x19, 0xa4, 0x69, 0x3d, 0x72, 0x0f, 0x74, 0x3d,
+  0xd1, 0x98, 0x53, 0x3d, 0xff, 0x11, 0x83, 0x3d, 0x52, 0x9c, 0xf1, 0xbc,
+  0xf5, 0x02, 0xb8, 0x3d, 0x1c, 0x79, 0x18, 0x3d, 0x73, 0x05, 0x8a, 0x3d,
+  0xe1, 0x1c, 0x5c, 0xbd, 0xf1, 0xf0, 0xc3, 0x3c, 0xed, 0x44, 0x80, 0x3c,
+  0xa2, 0x81, 0x16, 0xbb, 0xcd, 0xbb, 0x97, 0xbd, 0x39, 0xcf, 0x4a, 0xbc,
+  0x7a, 0xd3, 0x80, 0xbc, 0xb1, 0x63, 0x94, 0xbd, 0xac, 0xae, 0x86, 0x3d,
+  0xad, 0x25, 0xa8, 0x3c, 0xa8, 0x71, 0xc8, 0x3c, 0x28, 0x5e, 0x5f, 0x3d,
+  0xd6, 0x7b, 0xba, 0xbd, 0x16, 0xf5, 0xde, 0x38, 0x6d, 0xd4, 0x7e, 0x3d,
+  0xa1, 0xbf, 0x79, 0xbe, 0x6e, 0x88, 0x3f, 0xbd, 0x27, 0xe9, 0xb0, 0x3d,
+  0x6b, 0xa2, 0x9e, 0x3d, 0x22, 0x40, 0x08, 0xbc, 0x33, 0x39, 0x24, 0xbe,
+  0x88, 0x62, 0x5b, 0x3d, 0xff, 0xf3, 0x7f, 0x3d, 0x28, 0xd3, 0x1e, 0xbe,
+  0x89, 0x16, 0x15, 0x3d, 0xfd, 0xd3, 0x5e, 0x3d, 0x56, 0xc1, 0xa4, 0xbd,
+  0xf6, 0x6c, 0x91, 0xbc, 0xff, 0x4f, 0xb1, 0xbd, 0xd0, 0xae, 0xab, 0xbc,
+  0x0b, 0xb0, 0xb1, 0xbd, 0xf1, 0x6a, 0xb7, 0xbd, 0x0f, 0xfe, 0x88, 0xbe,
+  0x7f, 0x39, 0x52, 0xbe, 0x46, 0xf7, 0x63, 0xbe, 0xc8, 0xf5, 0x86, 0xbe,
+  0xda, 0xfb, 0x4c, 0xbe, 0x50, 0x15, 0xaa, 0xbe, 0x23, 0xc3, 0x49, 0xbe,
+  0xda, 0x25, 0xf5, 0xbd, 0x07, 0x38, 0xcb, 0x3c, 0xe2, 0x76, 0x09, 0xbe,
+  0x39, 0x32, 0x64, 0xbc, 0x13, 0x52, 0x9b, 0xbd, 0xb4, 0x1c, 0x9c, 0xbd,
+  0x11, 0x48, 0xf4, 0xbd, 0xf2, 0x7d, 0xd6, 0xbd, 0xbc, 0xbd, 0x92, 0xbd,
+  0x62, 0x24, 0x54, 0xbe, 0x40, 0x57, 0x0c, 0xbe, 0x97, 0x48, 0x46, 0xbe,
+  0x4a, 0xbd, 0x29, 0xbe, 0x2f, 0x1c, 0x17, 0xbe, 0x21, 0x8e, 0x1c, 0xbe,
+  0x7f, 0x36, 0x38, 0xbe, 0xac, 0x1e, 0xbd, 0xbd, 0xb9, 0x1b, 0x72, 0xbe,
+  0xb0, 0xae, 0x68, 0xbd, 0x99, 0x7d, 0xa1, 0xbd, 0x73, 0x66, 0x50, 0xbe,
+  0x3b, 0x90, 0xc9, 0xbd, 0xa9, 0xa1, 0xdd, 0xbd, 0x79, 0x29, 0x33, 0xbe,
+  0xed, 0xbe, 0x1f, 0xbe, 0xc5, 0xc7, 0x36, 0xbe, 0x7d, 0x20, 0xf6, 0xbc,
+  0xef, 0x96, 0x81, 0xbd, 0x57, 0x84, 0x08, 0xbd, 0xe4, 0x91, 0xda, 0xbd,
+  0x3d, 0x85, 0x81, 0xbd, 0x51, 0xd4, 0xc8, 0xbd, 0xe7, 0xa9, 0xc5, 0xbd,
+  0x20, 0x58, 0xea, 0xbd, 0xef, 0x50, 0x8f, 0x3c, 0x62, 0x1d, 0x58, 0xbd,
+  0xa0, 0xa4, 0x85, 0xbd, 0x4f, 0x87, 0xd4, 0xbc, 0x6a, 0x8a, 0xfe, 0xbc,
+  0x05, 0x80, 0x33, 0xbd, 0xf9, 0xa3, 0x57, 0xbe, 0xed, 0xa8, 0xc0, 0xbd,
+  0x75, 0x90, 0x5a, 0x3c, 0x2e, 0x35, 0xdd, 0xbd, 0x27, 0x12, 0x03, 0xbd,
+  0x2f, 0xcb, 0xde, 0xbb, 0xbe, 0x43, 0x87, 0xbd, 0xa1, 0x27, 0x07, 0xbd,
+  0x7c, 0xf9, 0xae, 0xbd, 0x01, 0x32, 0xa1, 0xbd, 0x55, 0x19, 0x82, 0x3d,
+  0x8f, 0x24, 0x5e, 0x3c, 0x0f, 0xcb, 0xe0, 0x3c, 0xd8, 0x36, 0xa2, 0xbd,
+  0x23, 0xf8, 0x03, 0x3d, 0x52, 0x08, 0xfd, 0xbb, 0x5d, 0x27, 0x34, 0xbe,
+  0x17, 0x3e, 0xd5, 0xbd, 0x77, 0x7f, 0xd8, 0x3b, 0x69, 0x9d, 0x05, 0x3d,
+  0x47, 0x37, 0x8b, 0x3d, 0xe4, 0x3f, 0x3f, 0xbd, 0x73, 0xc1, 0x0f, 0x3d,
+  0x05, 0x12, 0xd6, 0xbb, 0xd8, 0xe2, 0xfa, 0xbd, 0x80, 0xca, 0x20, 0xbd,
+  0xf7, 0x74, 0xd0, 0x3c, 0x2c, 0xe0, 0xc3, 0x3d, 0xdf, 0xc4, 0xe0, 0xbb,
+  0xea, 0xf8, 0x2a, 0xbc, 0x75, 0x69, 0xb7, 0xbb, 0xf4, 0xcc, 0x8f, 0x3d,
+  0x72, 0x4c, 0xd6, 0xbd, 0xc2, 0x33, 0x2b, 0xbd, 0x99, 0x8a, 0x64, 0x3d,
+  0xac, 0xfa, 0x4a, 0x3c, 0x11, 0x30, 0xcc, 0x3d, 0xce, 0xcd, 0x6d, 0xbd,
+  0x33, 0xef, 0x03, 0x3d, 0x76, 0xfa, 0x5d, 0x3d, 0x98, 0x31, 0x02, 0xbe,
+  0x5f, 0xa4, 0x45, 0xbd, 0x2a, 0x16, 0x19, 0x3c, 0xde, 0x36, 0x28, 0xbe,
+  0x1e, 0xa7, 0x42, 0x3d, 0x7f, 0x0a, 0x50, 0xbd, 0x8b, 0x95, 0xd8, 0xbd,
+  0x2c, 0xfb, 0xad, 0xbd, 0x58, 0x62, 0x23, 0xbe, 0xee, 0x6d, 0x2e, 0xbe,
+  0x07, 0x69, 0xa5, 0xbc, 0x31, 0xa2, 0x83, 0xbd, 0x9a, 0xcc, 0xf1, 0xbc,
+  0xf5, 0x4e, 0x06, 0xbe, 0xc5, 0xfb, 0xba, 0xbd, 0x57, 0xbe, 0x2d, 0xbe,
+  0x91, 0xd6, 0x9e, 0xbd, 0x18, 0xca, 0x0a, 0xbe, 0x1a, 0x51, 0x05, 0xbe,
+  0x2f, 0x46, 0xd0, 0xbd, 0x5b, 0x25, 0x5c, 0xbe, 0x69, 0xb0, 0x8b, 0xbd,
+  0x8a, 0x31, 0x4d, 0xbe, 0xda, 0xed, 0x19, 0xbe, 0x3e, 0x82, 0x34, 0xbd,
+  0xbd, 0x87, 0x92, 0x3c, 0x3b, 0x22, 0x63, 0x3b, 0x39, 0xad, 0x90, 0x3c,
+  0xee, 0x27, 0xa3, 0xbc, 0xd9, 0xcc, 0xd4, 0xbc, 0xac, 0x7a, 0xe7, 0x3b,
+  0x7a, 0x97, 0xcf, 0xbc, 0x1b, 0x9a, 0xf7, 0xbc, 0x86, 0x69, 0x46, 0xbd,
+  0x2b, 0xc0, 0xd1, 0xbc, 0x0d, 0x07, 0x42, 0x3d, 0xd0, 0xec, 0x80, 0xbd,
+  0x58, 0xe0, 0x03, 0xbd, 0x28, 0xa1, 0xd4, 0xbc, 0x4e, 0xca, 0x9a, 0xbb,
+  0x3b, 0xac, 0x75, 0xbd, 0x1c, 0x04, 0xb0, 0xbd, 0x5e, 0xb2, 0xa3, 0xbd,
+  0xa7, 0xeb, 0x53, 0xbd, 0x96, 0x5a, 0x13, 0x3d, 0x19, 0x02, 0x0f, 0xbd,
+  0x28, 0x1f, 0x38, 0xbc, 0x01, 0x9b, 0xf1, 0x3c, 0xe4, 0xf6, 0x7a, 0xbc,
+  0x45, 0xb7, 0x7e, 0xbd, 0xb3, 0x55, 0xb5, 0xbd, 0x85, 0x6f, 0x75, 0xbd,
+  0xa1, 0x11, 0x51, 0x3d, 0xb8, 0x31, 0x07, 0xbe, 0xbf, 0x15, 0x66, 0x3b,
+  0x27, 0x21, 0xb8, 0xbd, 0x99, 0x8d, 0xd7, 0xbd, 0x83, 0xb4, 0x27, 0xbe,
+  0x51, 0x74, 0x02, 0xbe, 0x54, 0x57, 0xed, 0xbd, 0x00, 0xb9, 0xef, 0xbd,
+  0xe8, 0xd4, 0xa3, 0xbd, 0x4f, 0x23, 0x8a, 0xbd, 0xb9, 0x35, 0xf9, 0xbd,
+  0x56, 0x9c, 0x9e, 0xbd, 0x1c, 0x23, 0x95, 0xbe, 0x63, 0x1b, 0x37, 0xbe,
+  0xcb, 0x06, 0x85, 0xbe, 0x28, 0x7d, 0xbb, 0xbd, 0x08, 0x7a, 0xe3, 0xbd,
+  0x07, 0xf5, 0xb0, 0xbd, 0x1b, 0x98, 0x84, 0xbe, 0x13, 0x9a, 0x38, 0xbe,
+  0x86, 0x1b, 0x93, 0xbe, 0xfd, 0x05, 0x9c, 0xbe, 0x50, 0xf5, 0x88, 0xbe,
+  0x53, 0x7d, 0xc4, 0xbd, 0x8f, 0x2a, 0xcc, 0xbd, 0x62, 0xdf, 0x6f, 0xbe,
+  0xc5, 0x66, 0xa4, 0xbe, 0x7b, 0xcf, 0x70, 0xbe, 0x9d, 0x8e, 0x80, 0xbe,
+  0x2e, 0x62, 0xb3, 0xbe, 0x80, 0x5e, 0xa2, 0xbe, 0x69, 0xa6, 0x97, 0xbd,
+  0x4e, 0xaf, 0x16, 0xbe, 0xfc, 0x12, 0x27, 0xbe, 0xe3, 0xd7, 0x86, 0xbe,
+  0xae, 0x82, 0x18, 0xbe, 0xc4, 0x9b, 0x44, 0xbe, 0xa9, 0xee, 0x80, 0xbe,
+  0x8f, 0xe6, 0x02, 0xbe, 0x73, 0xf9, 0x20, 0xbe, 0x38, 0x95, 0xd3, 0xbd,
+  0xb0, 0x4d, 0x2e, 0xbe, 0x73, 0x4b, 0xdf, 0xbd, 0x8a, 0x4b, 0x16, 0xbe,
+  0xb9, 0x25, 0x5c, 0xbe, 0xda, 0x60, 0x05, 0xbe, 0x9b, 0xbf, 0x14, 0xbe,
+  0xe8, 0xb2, 0x14, 0xbe, 0xbe, 0x74, 0xd1, 0xbd, 0x1e, 0xda, 0xc2, 0xbd,
+  0x0c, 0x37, 0x45, 0xbe, 0x48, 0x56, 0x07, 0xbe, 0xec, 0xc2, 0xe4, 0xbd,
+  0xde, 0xe1, 0x25, 0xbe, 0x38, 0x2b, 0x00, 0xbe, 0xaf, 0x2b, 0x21, 0xbd,
+  0x7f, 0x7d, 0xd5, 0xbc, 0xd8, 0xc8, 0x0a, 0xbe, 0x39, 0xcc, 0x6f, 0xbd,
+  0xf2, 0xcd, 0x8a, 0xba, 0x1f, 0x36, 0x35, 0xbd, 0x34, 0x5c, 0xbe, 0xbd,
+  0xe6, 0x0f, 0x54, 0x3b, 0x45, 0xd8, 0xa8, 0xbd, 0x67, 0x2f, 0xed, 0xbd,
+  0x58, 0xac, 0x7d, 0xbd, 0x3e, 0x07, 0x34, 0xbd, 0x10, 0x8b, 0x86, 0xbd,
+  0xd2, 0xbc, 0x85, 0xbd, 0x08, 0x7e, 0x6f, 0xbc, 0x26, 0x10, 0x02, 0x3d,
+  0xbb, 0x09, 0x30, 0x3d, 0xad, 0x0b, 0x65, 0xbd, 0xa9, 0x1b, 0x3e, 0xbd,
+  0xd0, 0x15, 0x91, 0x3d, 0x49, 0xa4, 0xbe, 0xbd, 0x13, 0xde, 0xbc, 0xbd,
+  0x54, 0x53, 0x6d, 0xbc, 0x0d, 0x31, 0x23, 0xbd, 0xf5, 0xde, 0x1d, 0x3d,
+  0xd0, 0xd0, 0x05, 0xbe, 0x91, 0x14, 0x81, 0xbd, 0xc3, 0xfd, 0x80, 0xbc,
+  0x86, 0x2c, 0x33, 0xbd, 0x8a, 0x44, 0x20, 0xbe, 0xe4, 0x6d, 0xcc, 0xbd,
+  0x4e, 0xd4, 0xa6, 0xbb, 0x82, 0x1d, 0x9b, 0xbd, 0xec, 0xf7, 0xab, 0xbd,
+  0x53, 0x42, 0x87, 0xbc, 0xc4, 0x31, 0xb9, 0x3b, 0xb5, 0xdf, 0x0c, 0xbe,
+  0xd0, 0x22, 0x74, 0xbe, 0x7b, 0x5a, 0x7a, 0xbe, 0x56, 0x4e, 0x3c, 0xbe,
+  0x5d, 0xd9, 0x95, 0xbd, 0x39, 0x56, 0x11, 0xbe, 0xbb, 0xcc, 0x9d, 0xbd,
+  0xe4, 0x12, 0xe5, 0xbd, 0xa5, 0x51, 0x0e, 0xbe, 0x45, 0x2a, 0x43, 0xbe,
+  0x83, 0x0e, 0xa0, 0xbe, 0x66, 0x15, 0x82, 0xbe, 0xe7, 0x0d, 0x02, 0xbe,
+  0x8c, 0x11, 0x6b, 0xbd, 0x9c, 0xdb, 0x27, 0xbe, 0xcd, 0x99, 0x40, 0xbe,
+  0x1d, 0x52, 0x8f, 0xbc, 0xe1, 0x8e, 0xdc, 0x3c, 0x3f, 0xa0, 0x4a, 0xbe,
+  0x69, 0x9c, 0xda, 0xbd, 0x6d, 0xf2, 0x74, 0xbe, 0x82, 0xb4, 0x99, 0xbd,
+  0xef, 0xb8, 0xa6, 0xbe, 0x2e, 0x6e, 0x52, 0xbe, 0x73, 0xd5, 0x4f, 0x3d,
+  0x94, 0xa5, 0x56, 0x3c, 0x10, 0xab, 0x9e, 0xbd, 0xb9, 0x43, 0x0d, 0xbd,
+  0x5a, 0xb7, 0xa7, 0xbe, 0xad, 0xad, 0xa6, 0xbd, 0x4e, 0x01, 0x31, 0xbe,
+  0x52, 0xb3, 0xbb, 0xbd, 0x0d, 0xa3, 0x40, 0xbd, 0x28, 0xa3, 0x13, 0xbe,
+  0x95, 0xee, 0xcf, 0xbd, 0x6d, 0x35, 0x67, 0xbd, 0xed, 0x05, 0x52, 0xbe,
+  0xf6, 0xab, 0x98, 0xbd, 0x27, 0xec, 0xb1, 0xbd, 0x16, 0x54, 0xf4, 0xbd,
+  0x9e, 0x45, 0x8b, 0xbd, 0xe0, 0x83, 0x2c, 0xbe, 0x9f, 0xc1, 0x1e, 0xbe,
+  0x14, 0xc7, 0x43, 0xbe, 0xdf, 0xad, 0xa1, 0xbe, 0xe9, 0x39, 0x13, 0xbd,
+  0x2c, 0x90, 0x45, 0xbe, 0xdd, 0xae, 0x44, 0xbe, 0x42, 0x18, 0x3d, 0xbe,
+  0xbf, 0xc2, 0xe3, 0xbd, 0x14, 0x23, 0x51, 0xbe, 0x86, 0xd2, 0x1e, 0xbe,
+  0x09, 0x08, 0x2e, 0xbe, 0x1d, 0x15, 0xc7, 0xbc, 0xc0, 0x5e, 0x74, 0xbe,
+  0x3f, 0xf1, 0x0b, 0xbe, 0xdd, 0x83, 0x85, 0xbd, 0x12, 0x57, 0x23, 0xbe,
+  0x4e, 0x04, 0xbe, 0xbd, 0x33, 0x2c, 0xe1, 0xbd, 0x34, 0xca, 0x07, 0xbe,
+  0xa1, 0xa8, 0x8f, 0xbd, 0x8a, 0x99, 0x20, 0xbe, 0x05, 0x1a, 0x63, 0xbe,
+  0x75, 0x41, 0xc1, 0xbd, 0x7e, 0x05, 0xb5, 0xbe, 0x24, 0xf8, 0xad, 0xbd,
+  0x17, 0x46, 0x18, 0xbd, 0x12, 0xca, 0x83, 0xbe, 0x75, 0x26, 0xab, 0xbd,
+  0xa0, 0xcd, 0x27, 0xbe, 0x81, 0x11, 0x95, 0xbe, 0xa5, 0x82, 0x20, 0xbe,
+  0x14, 0x52, 0x91, 0xbe, 0x34, 0xe2, 0x8a, 0xbe, 0x81, 0x7d, 0x7c, 0xbe,
+  0x3e, 0xbe, 0x18, 0xbe, 0xd4, 0x8d, 0x56, 0xbd, 0x76, 0x98, 0xa0, 0xbe,
+  0xa1, 0x38, 0x5e, 0xbe, 0xfb, 0xaf, 0xb6, 0xbd, 0xd1, 0xe3, 0xbd, 0xbd,
+  0x6b, 0x5d, 0x58, 0xbe, 0xb4, 0x35, 0xf3, 0xbd, 0x47, 0x25, 0xa9, 0xbc,
+  0xa6, 0x40, 0xc9, 0xbd, 0x8e, 0x1c, 0x51, 0xbe, 0x0f, 0x4d, 0xb9, 0xbc,
+  0xbf, 0xb1, 0x96, 0xbd, 0x64, 0x6f, 0x4f, 0xbe, 0x9f, 0x03, 0x06, 0xbe,
+  0xe3, 0xef, 0x19, 0xbe, 0x12, 0xb1, 0xb7, 0x3c, 0x1c, 0x1b, 0x86, 0xbd,
+  0xfb, 0x11, 0xc8, 0xbd, 0x87, 0x2c, 0x83, 0xbd, 0x11, 0x62, 0x2c, 0xbe,
+  0xed, 0xd3, 0x3e, 0xbe, 0xa5, 0x65, 0xa1, 0xbe, 0x58, 0x05, 0x7f, 0xbe,
+  0x1e, 0x2f, 0x31, 0xbd, 0x22, 0x7e, 0x9b, 0xbd, 0xe1, 0x6a, 0x4a, 0xbe,
+  0x86, 0xe7, 0x5c, 0xbe, 0x35, 0xdf, 0xd0, 0xbd, 0x5d, 0xbb, 0xaa, 0xbd,
+  0xb1, 0xbf, 0xd4, 0xbd, 0x67, 0xbb, 0x58, 0xbe, 0x4f, 0x7d, 0x7e, 0xbe,
+  0x1d, 0x26, 0x01, 0xbd, 0xae, 0x28, 0x73, 0xbe, 0xb7, 0x96, 0x0c, 0xbe,
+  0xe7, 0x19, 0x71, 0xb9, 0xd4, 0x87, 0x47, 0xbc, 0x52, 0x68, 0x00, 0xbe,
+  0x0d, 0x35, 0x01, 0xbc, 0x43, 0x96, 0x6b, 0xbe, 0x4d, 0xe8, 0x23, 0xbe,
+  0xff, 0xa0, 0xed, 0xbd, 0x80, 0xc9, 0xf7, 0xbd, 0x30, 0x82, 0x19, 0x3d,
+  0xbe, 0x4a, 0xe6, 0xbd, 0x73, 0x3d, 0xa2, 0x3d, 0x6b, 0x31, 0x99, 0x3c,
+  0x5b, 0xe6, 0xa1, 0xbc, 0x22, 0x07, 0x50, 0xbe, 0x35, 0x2b, 0xa3, 0x3c,
+  0xe0, 0x21, 0x4b, 0x3d, 0x60, 0x17, 0xc2, 0x3d, 0x2f, 0xa5, 0x83, 0xbc,
+  0x6d, 0xbd, 0xac, 0x3d, 0x45, 0x64, 0x8f, 0x3d, 0xf2, 0x07, 0xa0, 0x3d,
+  0x5f, 0x4e, 0x20, 0xbd, 0x60, 0x68, 0xad, 0x3d, 0x69, 0xbb, 0x93, 0xbc,
+  0xba, 0x3a, 0x14, 0x3e, 0xb9, 0xcb, 0x04, 0x3e, 0x51, 0xf0, 0x93, 0xbc,
+  0x9b, 0xd5, 0xac, 0xbc, 0xb8, 0xfb, 0x22, 0x3e, 0xcc, 0xec, 0x85, 0x3e,
+  0x16, 0x30, 0xd1, 0xbc, 0x0b, 0x38, 0x9c, 0x3d, 0x63, 0x58, 0x1c, 0x3e,
+  0x1f, 0x1f, 0x1c, 0x3e, 0x06, 0x8c, 0xc9, 0xbc, 0x5e, 0xa6, 0x51, 0xbd,
+  0x50, 0x56, 0xf7, 0x3d, 0x4a, 0x28, 0x20, 0x3e, 0x82, 0xcf, 0x84, 0xbd,
+  0xa1, 0x23, 0x0f, 0x3d, 0x16, 0xc3, 0x91, 0x3d, 0x78, 0x20, 0x3d, 0x3d,
+  0x79, 0xde, 0xb2, 0xbb, 0x0e, 0x83, 0x8f, 0x3b, 0xf3, 0x9e, 0xc4, 0xbd,
+  0xb5, 0x4b, 0x42, 0x3e, 0xc1, 0xfa, 0x35, 0xbd, 0xed, 0x7c, 0xe0, 0x3b,
+  0xc4, 0xcb, 0x55, 0xbc, 0x2b, 0xa8, 0x2d, 0x3d, 0x87, 0xa0, 0x20, 0xbd,
+  0x7a, 0x7f, 0xaf, 0xbd, 0xd5, 0xb0, 0xf5, 0xbd, 0x63, 0xab, 0x25, 0xbd,
+  0xa3, 0x14, 0x17, 0xbe, 0x30, 0x72, 0xd0, 0xbd, 0xa2, 0xf6, 0x85, 0x3c,
+  0xe1, 0xb6, 0x4c, 0xbd, 0xc2, 0xa8, 0x9a, 0xbd, 0x1d, 0x5b, 0xdf, 0xbc,
+  0x3a, 0xc6, 0xa2, 0xbe, 0x17, 0x6b, 0xe7, 0xbc, 0x17, 0x6d, 0xfc, 0xbd,
+  0x6d, 0xdd, 0x06, 0xbe, 0xcf, 0x03, 0xd5, 0xbd, 0xfe, 0x90, 0x8d, 0xbe,
+  0x95, 0x6c, 0x0d, 0xbe, 0xbe, 0xc1, 0x06, 0xbe, 0x48, 0x85, 0xec, 0xbe,
+  0xf8, 0x72, 0xb2, 0xbd, 0x6e, 0xd4, 0x96, 0xbe, 0xdf, 0x09, 0x57, 0xbe,
+  0x4d, 0xfa, 0x21, 0xbe, 0xf3, 0x4b, 0x38, 0xbe, 0x86, 0xea, 0xee, 0xbd,
+  0x04, 0x42, 0xbf, 0xbd, 0xd7, 0xea, 0x88, 0xbe, 0x30, 0xb3, 0xc5, 0xb9,
+  0x1e, 0x9a, 0xb6, 0xbd, 0xc4, 0xcd, 0x5f, 0xbe, 0xa7, 0x96, 0x22, 0xbd,
+  0x0c, 0x16, 0xc7, 0xbd, 0xd9, 0xfa, 0x6e, 0xbe, 0xc3, 0xe8, 0x55, 0xbe,
+  0x2b, 0x89, 0x06, 0xbe, 0x33, 0x56, 0x71, 0xbd, 0x1e, 0x34, 0x63, 0xbe,
+  0x45, 0x49, 0x94, 0xbe, 0xe2, 0x49, 0x26, 0xbe, 0x31, 0x32, 0x7f, 0xbd,
+  0x78, 0xc5, 0x18, 0xbe, 0xf4, 0x08, 0x01, 0xbe, 0xe7, 0x4d, 0x84, 0xbe,
+  0xe8, 0x5a, 0x25, 0xbe, 0x4c, 0xb9, 0x32, 0xbe, 0x81, 0x6e, 0x52, 0xbe,
+  0x93, 0x6a, 0x9a, 0x3d, 0xde, 0xa8, 0x1a, 0xbd, 0x76, 0xfd, 0xc9, 0xbd,
+  0x30, 0x84, 0x3f, 0x3d, 0xcc, 0xeb, 0x0d, 0xbe, 0x24, 0xf3, 0x26, 0xbe,
+  0xdd, 0xe0, 0xa1, 0xbd, 0xdb, 0x60, 0x17, 0xbd, 0x70, 0xc7, 0xa6, 0x3d,
+  0x5a, 0x48, 0x5a, 0xbd, 0x43, 0xd1, 0xb1, 0xbd, 0x7d, 0xb7, 0x6d, 0x3d,
+  0x59, 0x0d, 0xc2, 0xbb, 0x19, 0x15, 0x75, 0xbe, 0x26, 0x78, 0xc8, 0x3b,
+  0x3a, 0xd7, 0x09, 0x3d, 0xe5, 0xa5, 0xd1, 0x3c, 0xda, 0x28, 0xba, 0xbd,
+  0xd4, 0xf9, 0xbf, 0xbd, 0x82, 0x2f, 0x8d, 0x3c, 0x37, 0x5f, 0x1d, 0x3e,
+  0x3f, 0xe9, 0xa3, 0xbd, 0x4b, 0xed, 0x39, 0x3d, 0x84, 0xfd, 0x00, 0xbd,
+  0x85, 0x5e, 0x5a, 0x3e, 0x0e, 0x92, 0xcf, 0x3c, 0x29, 0x87, 0x04, 0x3d,
+  0x9b, 0x8d, 0x18, 0x3c, 0xd8, 0x2f, 0x5c, 0x3e, 0xb2, 0x87, 0x70, 0x3e,
+  0x9d, 0xf5, 0x8a, 0x3d, 0xd6, 0x24, 0xde, 0x3d, 0xd3, 0xfe, 0x96, 0x3e,
+  0x8c, 0x36, 0xdd, 0x3d, 0xae, 0xad, 0xb0, 0x3d, 0xe7, 0x89, 0x2a, 0x3e,
+  0x8e, 0x6f, 0x03, 0x3e, 0x69, 0xa5, 0x7b, 0x3e, 0x1a, 0xf8, 0x35, 0x3e,
+  0x64, 0xaa, 0xff, 0x3d, 0x46, 0x5e, 0x8a, 0x3e, 0x79, 0x60, 0x3e, 0x3e,
+  0x9f, 0x88, 0x91, 0x3d, 0x44, 0x7e, 0x56, 0x3d, 0xd2, 0x00, 0x2d, 0x3e,
+  0x94, 0x70, 0x74, 0x3e, 0x5a, 0xeb, 0x45, 0x3e, 0x6d, 0x0b, 0x8d, 0x3d,
+  0xa5, 0x99, 0x45, 0x3d, 0x16, 0xeb, 0x72, 0x3d, 0xf7, 0x26, 0x9b, 0x3d,
+  0x5a, 0xae, 0x0d, 0xbc, 0x72, 0x39, 0x0a, 0xbd, 0x70, 0x99, 0x2d, 0x3e,
+  0x72, 0xd1, 0xb9, 0xbb, 0x24, 0xd4, 0x52, 0x3d, 0x5f, 0x89, 0x9b, 0xbd,
+  0xd6, 0x89, 0xac, 0x3d, 0x69, 0xf8, 0xa4, 0xbd, 0x3a, 0xf2, 0x81, 0xbd,
+  0x24, 0x49, 0x93, 0xbd, 0x06, 0x56, 0xe3, 0x3d, 0x88, 0xf2, 0x92, 0xbd,
+  0x5f, 0x09, 0xaa, 0xba, 0xd3, 0x9a, 0xe3, 0xbd, 0xc7, 0xf2, 0x0b, 0x3d,
+  0x9f, 0x48, 0x78, 0xbc, 0xe7, 0xf4, 0xc1, 0xbd, 0x4a, 0x14, 0x02, 0xbe,
+  0xc6, 0x50, 0x38, 0xbd, 0xec, 0xfd, 0xd0, 0xbd, 0x93, 0x32, 0x07, 0xbd,
+  0x0d, 0xa8, 0x46, 0xbd, 0x16, 0x2a, 0xe0, 0xbd, 0x1b, 0x37, 0x9b, 0xbd,
+  0x49, 0xb9, 0x7c, 0xbe, 0x21, 0xb7, 0x5a, 0xbe, 0xef, 0xea, 0xde, 0xbd,
+  0xf1, 0xb7, 0x2d, 0xbe, 0x10, 0xa7, 0xdc, 0xbd, 0xa9, 0xda, 0xb2, 0xbd,
+  0x13, 0x5c, 0x7a, 0xbe, 0x10, 0x3f, 0x08, 0xbe, 0xf1, 0x74, 0x62, 0xbe,
+  0x59, 0x08, 0x23, 0xbe, 0x5f, 0x2f, 0xb0, 0xbd, 0x0b, 0x09, 0x66, 0xbe,
+  0xcf, 0x32, 0x47, 0xbe, 0x1e, 0x56, 0x07, 0xbe, 0x4a, 0xf8, 0x56, 0xbe,
+  0xfd, 0x69, 0x2b, 0xbe, 0x7b, 0xcf, 0x10, 0xbe, 0x93, 0x5a, 0x75, 0xbe,
+  0x69, 0xf0, 0x33, 0xbd, 0x52, 0x7b, 0xf1, 0xbd, 0x87, 0x87, 0x5e, 0xbe,
+  0xd7, 0xf9, 0xb1, 0x3c, 0xbf, 0x19, 0x9a, 0xbc, 0xed, 0xa0, 0x9b, 0xbd,
+  0xbe, 0xeb, 0x9c, 0xbd, 0x23, 0xe8, 0x97, 0xbe, 0x91, 0xb7, 0x0b, 0xbe,
+  0x01, 0xc4, 0xbb, 0xbd, 0x7c, 0xb3, 0x1c, 0x3d, 0xa0, 0x60, 0x84, 0x3d,
+  0x94, 0x46, 0xcb, 0x3d, 0x01, 0x66, 0x56, 0x3d, 0xdb, 0x42, 0x0c, 0x3e,
+  0x13, 0x31, 0x39, 0x3a, 0x6b, 0x7c, 0xa6, 0xbe, 0x9c, 0x75, 0x3c, 0x3d,
+  0xcf, 0x9b, 0x12, 0x3d, 0x67, 0xbc, 0x00, 0x3d, 0xad, 0x79, 0xeb, 0xbc,
+  0xf9, 0x41, 0xf9, 0xbc, 0x99, 0xef, 0xc3, 0x3d, 0xc4, 0xe7, 0xc6, 0x3d,
+  0xd6, 0xe7, 0xcf, 0xbe, 0xae, 0xa2, 0x79, 0x3c, 0xf1, 0xbb, 0xac, 0x3d,
+  0xa9, 0x7a, 0xec, 0x3d, 0x13, 0x7b, 0xd4, 0x3c, 0xe4, 0x9b, 0xd6, 0x3b,
+  0x78, 0x53, 0xe8, 0x3d, 0x69, 0x20, 0x3a, 0x3d, 0x29, 0xcb, 0x81, 0xbe,
+  0x5d, 0x65, 0x60, 0x3d, 0x89, 0xee, 0xcf, 0x3c, 0x87, 0xa3, 0x4c, 0x3e,
+  0x0f, 0x39, 0x11, 0xbd, 0xc3, 0xcd, 0xf9, 0x3c, 0xc9, 0xc6, 0x0f, 0x3e,
+  0x55, 0x76, 0x72, 0x3d, 0x65, 0x29, 0x2d, 0xbe, 0xd8, 0x3e, 0xbc, 0x3d,
+  0xd7, 0x2f, 0x93, 0x3d, 0xb5, 0xdc, 0x0a, 0x3e, 0x6c, 0x35, 0x2a, 0xbd,
+  0x09, 0x54, 0xc9, 0xbc, 0xea, 0xdd, 0x07, 0x3e, 0xcf, 0xee, 0x1f, 0x3d,
+  0x28, 0xec, 0x7b, 0x3c, 0x04, 0x30, 0x8b, 0x3d, 0xa2, 0x35, 0x68, 0xba,
+  0x95, 0x3f, 0x43, 0x3d, 0x8a, 0x78, 0x10, 0x3d, 0x3a, 0xda, 0xa7, 0x3c,
+  0xec, 0xb5, 0x26, 0x3d, 0x86, 0x21, 0x87, 0xbc, 0x4c, 0xf1, 0x06, 0x3d,
+  0x9b, 0xaa, 0x07, 0x3e, 0x65, 0xb0, 0x4d, 0x3d, 0xda, 0xdd, 0x15, 0x3e,
+  0x99, 0x3e, 0x11, 0x3d, 0x4b, 0x65, 0x15, 0xbd, 0x1e, 0xc5, 0x7b, 0xbc,
+  0xf4, 0xe9, 0xb3, 0xb9, 0x28, 0x1d, 0xed, 0x3d, 0x7d, 0x01, 0xb7, 0xba,
+  0x4a, 0x52, 0x79, 0x3c, 0x24, 0x93, 0xda, 0xbc, 0x6f, 0x3b, 0xe2, 0x3d,
+  0x71, 0x5b, 0xc8, 0x3c, 0x4f, 0xba, 0xe5, 0xbd, 0x32, 0x5a, 0xd6, 0xbc,
+  0xe8, 0xac, 0xeb, 0x3d, 0x15, 0x7b, 0xef, 0xbc, 0xbd, 0x7d, 0x89, 0x3c,
+  0x32, 0xb7, 0x26, 0xbe, 0x79, 0xab, 0x1d, 0xbc, 0xe4, 0xe6, 0xa3, 0x3c,
+  0xdf, 0x12, 0xc6, 0xbd, 0x15, 0x67, 0xee, 0xbd, 0xbf, 0x3b, 0x10, 0x3d,
+  0xfb, 0x1b, 0x86, 0xba, 0x6a, 0x22, 0xc5, 0xbc, 0x3f, 0xdd, 0x04, 0xbe,
+  0x99, 0x81, 0xd2, 0xbc, 0xf4, 0x67, 0xb0, 0xbd, 0x0c, 0xa8, 0x1a, 0xbe,
+  0xc2, 0x77, 0x58, 0xbe, 0xfa, 0x3a, 0xa1, 0xbd, 0x76, 0x9f, 0x40, 0xbe,
+  0xf1, 0x38, 0xe2, 0xbd, 0x18, 0x51, 0x1f, 0xbe, 0xd9, 0xcf, 0x22, 0xbe,
+  0xef, 0xe0, 0xc6, 0xbd, 0x9b, 0xfb, 0x5c, 0xbe, 0xc2, 0x95, 0x47, 0xbe,
+  0x32, 0xfc, 0x32, 0xbd, 0x2d, 0x74, 0x70, 0xbe, 0xf6, 0xa2, 0x52, 0xbe,
+  0x39, 0xdd, 0xa4, 0xbd, 0x80, 0xc3, 0x9f, 0xbd, 0xbe, 0x3d, 0xfc, 0xbd,
+  0xd0, 0x99, 0x4c, 0xbe, 0xed, 0x51, 0x18, 0xbe, 0x17, 0x77, 0xff, 0xbd,
+  0xc6, 0xdf, 0x0d, 0xbe, 0xaa, 0x3b, 0x36, 0xbe, 0xde, 0xad, 0xf4, 0x3c,
+  0x4d, 0x33, 0xef, 0x3d, 0xc3, 0x21, 0x6a, 0x3d, 0x12, 0xd4, 0x25, 0x3e,
+  0xbf, 0x49, 0xa1, 0xbd, 0xeb, 0x6c, 0x3f, 0xbe, 0x81, 0x81, 0xa3, 0xbb,
+  0xfd, 0x37, 0xf9, 0x3d, 0xa8, 0xae, 0x2b, 0xbd, 0x5e, 0x21, 0x07, 0x3e,
+  0xfc, 0x1b, 0x15, 0x3c, 0x0b, 0x75, 0x07, 0x3d, 0x84, 0x55, 0x23, 0xbb,
+  0xc0, 0x3d, 0x7b, 0xbe, 0x87, 0x44, 0x09, 0x3e, 0x58, 0x70, 0x63, 0x3d,
+  0x13, 0xca, 0x0c, 0xbe, 0x7f, 0x63, 0xab, 0x3a, 0xa1, 0x83, 0xb3, 0x3d,
+  0x11, 0xef, 0x52, 0x3c, 0x47, 0x2b, 0xa7, 0x3c, 0xb3, 0x63, 0xbd, 0xbe,
+  0xc8, 0xee, 0x9c, 0x3d, 0xa7, 0x16, 0x90, 0x3d, 0x21, 0x4a, 0x0c, 0x3c,
+  0xa0, 0xe8, 0x0a, 0x3d, 0x03, 0xb5, 0xa4, 0xbc, 0x18, 0xff, 0x8f, 0x3d,
+  0x5f, 0xe9, 0x76, 0x3d, 0x39, 0xc0, 0x8a, 0xbe, 0x08, 0xeb, 0xfb, 0x3d,
+  0x66, 0xd3, 0x19, 0x3c, 0x78, 0x75, 0xb6, 0xbb, 0x9d, 0x99, 0x6d, 0xbc,
+  0x2a, 0x8a, 0xbf, 0xba, 0x33, 0x12, 0x84, 0xbc, 0xba, 0xff, 0x34, 0x3d,
+  0xaf, 0x0a, 0xe0, 0x3c, 0x00, 0xbf, 0x95, 0x3d, 0x4d, 0x60, 0x48, 0x3d,
+  0xf3, 0xfc, 0x62, 0x3e, 0x82, 0x26, 0x8a, 0xbc, 0x9c, 0xd5, 0x31, 0xbd,
+  0x9f, 0x44, 0xae, 0x3d, 0x83, 0xca, 0x83, 0x3d, 0x62, 0x04, 0xc3, 0x3c,
+  0x14, 0xba, 0xa5, 0x3d, 0xc3, 0x20, 0x96, 0x3c, 0x6e, 0xae, 0xa2, 0x3d,
+  0x56, 0x51, 0x1d, 0x3e, 0x92, 0x85, 0x6b, 0x3d, 0x8d, 0x6c, 0x82, 0x3b,
+  0xa8, 0xab, 0xb4, 0xbc, 0xa5, 0x8b, 0xb5, 0xbd, 0x3b, 0x52, 0x84, 0x3d,
+  0x73, 0xe9, 0x94, 0x3c, 0x5a, 0x8f, 0xb3, 0xbd, 0x5b, 0xc3, 0xf3, 0x3d,
+  0xe5, 0x09, 0xd4, 0x3d, 0xf2, 0x1d, 0x1c, 0xbd, 0x4a, 0xeb, 0xc2, 0xbd,
+  0x63, 0xbe, 0xe8, 0xbd, 0xa1, 0x66, 0x5c, 0x3d, 0x26, 0xdc, 0x94, 0x3d,
+  0xd1, 0x5e, 0xcf, 0xbd, 0x52, 0x8c, 0xaa, 0x3d, 0x82, 0xf6, 0xec, 0x3d,
+  0xee, 0x95, 0xd9, 0x3c, 0xc8, 0xb2, 0xae, 0xbd, 0x2d, 0x09, 0x7a, 0xbe,
+  0x32, 0x08, 0xad, 0x3d, 0xbd, 0x61, 0x59, 0x3d, 0x99, 0x5a, 0x06, 0xbe,
+  0x8b, 0x72, 0xb9, 0x3d, 0x4c, 0xe6, 0xa2, 0x39, 0x56, 0x19, 0xd0, 0x3d,
+  0x2a, 0x86, 0x61, 0xbd, 0x99, 0x4d, 0x93, 0xbe, 0xbe, 0xb2, 0xde, 0x3d,
+  0x9c, 0xb4, 0xf4, 0x3d, 0x01, 0x2f, 0x86, 0xbe, 0xe8, 0x31, 0x2c, 0x3c,
+  0x94, 0xcc, 0xb4, 0xbd, 0xc7, 0xd6, 0x53, 0xbd, 0xff, 0x1d, 0xdc, 0xbd,
+  0xb8, 0x30, 0x0f, 0xbe, 0x23, 0xc8, 0x8d, 0x3a, 0x3c, 0xa1, 0xa7, 0xbc,
+  0x72, 0x80, 0x23, 0xbe, 0xdc, 0xa3, 0x14, 0xbe, 0xbb, 0x12, 0x21, 0xbe,
+  0x23, 0xd4, 0x8e, 0xbe, 0x26, 0x48, 0x13, 0xbe, 0x63, 0x5c, 0x9c, 0xbd,
+  0x5f, 0x42, 0x52, 0xbe, 0xad, 0x9f, 0x28, 0xbe, 0x47, 0x8f, 0x01, 0xbd,
+  0x9d, 0x00, 0x94, 0xbc, 0x6c, 0xbf, 0x80, 0xbd, 0xb0, 0xf8, 0xea, 0xbd,
+  0x93, 0x1a, 0xf1, 0xbd, 0x6c, 0xf3, 0x07, 0xbe, 0x8b, 0x2b, 0x1c, 0xbe,
+  0x97, 0x6a, 0x2d, 0xbd, 0xdc, 0xc0, 0x1a, 0xbe, 0x24, 0x80, 0xca, 0x3c,
+  0xb6, 0x15, 0xcd, 0x3d, 0xfd, 0x34, 0xe8, 0x3d, 0x97, 0xd9, 0xc9, 0x3b,
+  0x6e, 0x22, 0x89, 0xbd, 0x81, 0x2e, 0x4e, 0x3e, 0xd7, 0xb2, 0x4d, 0x3d,
+  0x60, 0x71, 0x80, 0xbe, 0xe5, 0x06, 0xcc, 0x3d, 0x1e, 0x64, 0xd0, 0x3d,
+  0x23, 0x49, 0xa0, 0x3d, 0x40, 0x8d, 0xa3, 0x3d, 0x1a, 0x7b, 0x11, 0xbe,
+  0xb2, 0xd2, 0x24, 0x3d, 0x9a, 0x79, 0x5f, 0x3d, 0x36, 0xfc, 0x85, 0xbe,
+  0xdb, 0x45, 0xb4, 0x3d, 0xa0, 0x62, 0xd3, 0xbc, 0x08, 0x6e, 0x16, 0x3d,
+  0xe8, 0x71, 0x76, 0x3c, 0xde, 0xd0, 0x41, 0xbe, 0x41, 0x54, 0x9d, 0xbc,
+  0x62, 0x5c, 0x59, 0x3d, 0x0e, 0x87, 0x7f, 0xbe, 0xca, 0x8f, 0x0e, 0x3e,
+  0xc2, 0xed, 0xd6, 0xbc, 0xd6, 0x0a, 0x5e, 0xbd, 0x71, 0x00, 0xb1, 0xbd,
+  0x61, 0x11, 0x7c, 0xbb, 0x2f, 0xc8, 0x48, 0x3d, 0xad, 0x5c, 0xf0, 0xbc,
+  0x12, 0x58, 0xf2, 0x3d, 0x5e, 0x33, 0x1e, 0x3d, 0x08, 0xdb, 0x67, 0xbd,
+  0x30, 0x46, 0xd8, 0xbd, 0xa2, 0x2a, 0xe6, 0xbb, 0x76, 0xac, 0xf6, 0x3d,
+  0xe9, 0xc6, 0x46, 0xbd, 0x6b, 0x52, 0x24, 0x3c, 0x89, 0x3e, 0xb9, 0x3d,
+  0x1f, 0x3b, 0x34, 0x3d, 0xa5, 0xc9, 0x2c, 0xbd, 0xdf, 0x8a, 0x00, 0x3e,
+  0x72, 0x76, 0x79, 0x3e, 0x8b, 0x2e, 0x80, 0x3e, 0xd8, 0xc1, 0xf1, 0x3d,
+  0x75, 0xd6, 0x06, 0x3d, 0x76, 0xf1, 0xa3, 0xbc, 0xf4, 0xc3, 0x1f, 0x3e,
+  0xb1, 0x51, 0xd6, 0x3d, 0x8b, 0xf8, 0x8d, 0x3c, 0x33, 0xcf, 0xbf, 0x3c,
+  0x35, 0xa2, 0x01, 0xbc, 0x1f, 0x43, 0xb5, 0x3d, 0x30, 0x15, 0x00, 0x3d,
+  0xdb, 0xf1, 0x9e, 0xbe, 0xaf, 0xc2, 0xf6, 0x3c, 0x02, 0x18, 0x26, 0x3e,
+  0x7b, 0xd2, 0xa7, 0x3b, 0x27, 0x0c, 0x33, 0xbd, 0xc2, 0xa7, 0x1b, 0xbf,
+  0xd0, 0x44, 0xbc, 0x3c, 0xa4, 0xd4, 0x0b, 0x3e, 0x19, 0xde, 0xad, 0xbe,
+  0x6c, 0x42, 0x3f, 0x3d, 0x34, 0x47, 0x1a, 0x3e, 0x36, 0x24, 0x08, 0x3d,
+  0xa8, 0x7d, 0x9f, 0xbc, 0x34, 0x8c, 0x72, 0xbe, 0x8e, 0xf9, 0x89, 0x3d,
+  0x8d, 0x02, 0xc1, 0x3c, 0xea, 0x3d, 0xba, 0xbe, 0xe0, 0xfb, 0xa0, 0x3d,
+  0x51, 0xfd, 0x1d, 0x3e, 0xad, 0x45, 0x01, 0x3e, 0xf4, 0x84, 0x35, 0x3d,
+  0x95, 0x7a, 0x45, 0xbe, 0x50, 0x44, 0xae, 0x3d, 0x55, 0x2c, 0xfd, 0x3d,
+  0xb0, 0xdf, 0x92, 0xbe, 0x9a, 0xfa, 0x66, 0x3a, 0xa3, 0xd5, 0x13, 0xbd,
+  0x8a, 0x30, 0xfe, 0xbd, 0x71, 0x33, 0x83, 0x3d, 0x68, 0x16, 0x15, 0xbe,
+  0x02, 0xfc, 0x65, 0x3c, 0xaa, 0x3b, 0x00, 0xbe, 0x90, 0x9c, 0x0d, 0xbe,
+  0x76, 0x96, 0x9f, 0xbe, 0x64, 0x0b, 0x4a, 0xbe, 0xbb, 0x51, 0xa5, 0xbe,
+  0xa9, 0x4a, 0x95, 0xbe, 0x48, 0x63, 0x0e, 0xbe, 0x80, 0x3b, 0x97, 0xbe,
+  0xba, 0x14, 0x9f, 0xbe, 0x24, 0x60, 0x23, 0xbd, 0xc8, 0x64, 0x0b, 0xbe,
+  0xd4, 0x3f, 0x96, 0xbd, 0x9c, 0x28, 0xf5, 0xbd, 0xb6, 0x04, 0x42, 0xbd,
+  0x36, 0x56, 0x84, 0xbd, 0xaf, 0x3b, 0x00, 0xbe, 0x0a, 0x20, 0x11, 0xbd,
+  0xc9, 0x13, 0x5d, 0xbe, 0x17, 0x1c, 0x3c, 0xbc, 0x9c, 0x92, 0x58, 0xbc,
+  0x79, 0x21, 0x3f, 0x3d, 0xec, 0x92, 0x9c, 0x3d, 0x33, 0xa6, 0x21, 0xbd,
+  0xa4, 0x32, 0xb4, 0x3d, 0x7c, 0x15, 0xad, 0x3c, 0x38, 0x02, 0xa3, 0xbe,
+  0x28, 0xa8, 0x82, 0x3d, 0x0c, 0x09, 0xa2, 0xbb, 0x3a, 0x60, 0x3f, 0x3d,
+  0x5d, 0xb4, 0x9a, 0x3d, 0xcc, 0x04, 0x98, 0xbd, 0x03, 0x2e, 0x87, 0xbb,
+  0xd0, 0x76, 0x80, 0x3d, 0xcf, 0xdf, 0xa9, 0xbe, 0xd3, 0xdc, 0xec, 0x3d,
+  0x60, 0x65, 0xa4, 0xbc, 0x0a, 0x64, 0x4e, 0xbd, 0x1e, 0x87, 0x87, 0x3b,
+  0x8c, 0x78, 0xa2, 0x3c, 0x17, 0xee, 0x52, 0x3c, 0xf6, 0xc7, 0x86, 0x3d,
+  0x75, 0xcc, 0x68, 0xbc, 0x4b, 0xc9, 0x45, 0x3e, 0xc1, 0x4e, 0x96, 0x3d,
+  0x51, 0x05, 0x32, 0xbd, 0xa0, 0xb4, 0x35, 0xbd, 0x0a, 0x0e, 0xc8, 0x3d,
+  0x75, 0xb5, 0xaa, 0xbd, 0xe2, 0x17, 0x21, 0x3c, 0xb3, 0xed, 0x92, 0x3e,
+  0x6c, 0x94, 0xab, 0xbb, 0x1b, 0xd8, 0x0a, 0x3d, 0xea, 0x95, 0x52, 0x3b,
+  0xe7, 0x97, 0xa3, 0x3d, 0xdf, 0x28, 0x83, 0x3e, 0x7e, 0xe4, 0x40, 0x3d,
+  0xaf, 0x02, 0x52, 0x3c, 0x4d, 0xc4, 0x0f, 0x3e, 0xa6, 0x5a, 0x55, 0xbc,
+  0x55, 0xa1, 0x2b, 0x3d, 0x0c, 0x81, 0x02, 0x3d, 0xa1, 0xe5, 0xc5, 0x3d,
+  0xbd, 0x48, 0x0b, 0x3e, 0xb6, 0x34, 0xc7, 0x3c, 0x9f, 0x82, 0xde, 0xbc,
+  0x73, 0x0d, 0x6c, 0xbe, 0x8b, 0x09, 0xdd, 0xbd, 0x54, 0xc3, 0x6b, 0x3d,
+  0xd4, 0x2f, 0x88, 0x3d, 0x71, 0xb4, 0xc1, 0x3d, 0x5f, 0xb3, 0xdf, 0xbd,
+  0x49, 0xd7, 0x1d, 0xbc, 0x05, 0x37, 0xcb, 0xbb, 0x74, 0xcf, 0xed, 0xbe,
+  0x9d, 0xc0, 0xa5, 0x3c, 0x85, 0x30, 0x0e, 0x3e, 0x45, 0x65, 0x88, 0xbc,
+  0xa7, 0xcd, 0x9e, 0x3d, 0x8e, 0x38, 0xc9, 0xbe, 0x24, 0x1e, 0x41, 0xbc,
+  0xf2, 0x65, 0x0d, 0x3d, 0xee, 0x79, 0x05, 0xbf, 0x61, 0x83, 0x04, 0xbe,
+  0x4d, 0x7b, 0xe7, 0x3d, 0xf7, 0x21, 0x39, 0x3d, 0x57, 0x6a, 0xbb, 0x3c,
+  0x13, 0x73, 0x95, 0xbe, 0x1a, 0xd3, 0x2c, 0x3d, 0xc7, 0x8f, 0x65, 0x3d,
+  0x69, 0xe0, 0xdb, 0xbe, 0x17, 0x26, 0x5b, 0xbc, 0xb8, 0x82, 0xcc, 0x3d,
+  0x3d, 0x99, 0xa8, 0x3c, 0x2d, 0xc6, 0xb9, 0x3d, 0x09, 0x43, 0x51, 0xbe,
+  0xaa, 0xff, 0x13, 0xbd, 0x38, 0x9a, 0x79, 0x3d, 0x91, 0x38, 0x7b, 0xbe,
+  0xaa, 0xf8, 0xef, 0xbc, 0xd4, 0xf9, 0xc2, 0xbd, 0x23, 0x4a, 0x46, 0xbe,
+  0x50, 0xe7, 0x51, 0xbd, 0x9c, 0x93, 0x14, 0xbe, 0xc2, 0xae, 0x17, 0xbe,
+  0x22, 0x4f, 0x36, 0xbe, 0xb1, 0x0c, 0x00, 0xbe, 0x24, 0x0d, 0xa4, 0xbe,
+  0x07, 0xbd, 0x86, 0xbe, 0x95, 0x9e, 0xb2, 0xbe, 0x8a, 0xca, 0xc0, 0xbe,
+  0xb6, 0x45, 0x07, 0xbd, 0xaa, 0x36, 0xa3, 0xbe, 0xd5, 0xc1, 0x97, 0xbe,
+  0xfb, 0xeb, 0xfe, 0xbd, 0x3d, 0x4d, 0x5f, 0xbe, 0x4b, 0x8b, 0xc0, 0xbd,
+  0xb8, 0xdf, 0x0b, 0xbe, 0x84, 0x10, 0x99, 0xbd, 0x1d, 0xc3, 0x19, 0xbd,
+  0x28, 0x35, 0x00, 0xbe, 0x54, 0x96, 0x34, 0xbe, 0x05, 0xfe, 0x1a, 0xbe,
+  0x1e, 0x3d, 0x24, 0xbe, 0x13, 0x5e, 0x91, 0xbd, 0xac, 0xe5, 0x0a, 0xbd,
+  0x0b, 0xdc, 0x88, 0xbc, 0xd6, 0x80, 0xda, 0xbd, 0xb8, 0x75, 0xa2, 0xbd,
+  0x0c, 0x5d, 0xbe, 0xbd, 0x65, 0xc6, 0x2f, 0xbe, 0x2f, 0x32, 0xb3, 0x3d,
+  0x3e, 0x2a, 0x3f, 0x3d, 0xa6, 0xe0, 0xc6, 0xbb, 0x91, 0x46, 0xf4, 0xbc,
+  0x3f, 0xed, 0x69, 0xbd, 0x5a, 0x0a, 0x3e, 0xbd, 0xa9, 0x82, 0x44, 0xbd,
+  0x43, 0xe3, 0x97, 0xbd, 0x06, 0x10, 0xf4, 0x3c, 0xaa, 0x60, 0x9f, 0x3d,
+  0x24, 0x54, 0x05, 0xbd, 0x5f, 0x14, 0x20, 0x3d, 0x51, 0xcd, 0xab, 0x3d,
+  0x5f, 0x8e, 0x5f, 0xbd, 0xcf, 0xe3, 0x1c, 0x3c, 0x92, 0x72, 0x06, 0x3e,
+  0x4d, 0x2d, 0xea, 0x3c, 0x10, 0x8b, 0x53, 0x3c, 0x90, 0xa5, 0x02, 0xbe,
+  0xe0, 0xc3, 0x06, 0x3b, 0x73, 0x24, 0x26, 0x3e, 0xba, 0x33, 0x0b, 0xbd,
+  0x0f, 0x91, 0xb8, 0x3c, 0x95, 0x78, 0x6a, 0x3e, 0x34, 0x2b, 0x7f, 0x3c,
+  0x6f, 0x40, 0x31, 0xbd, 0x2a, 0x3d, 0x0b, 0xbe, 0x86, 0xc8, 0xbd, 0x3c,
+  0x1b, 0x14, 0x82, 0x3e, 0xfa, 0x52, 0xf0, 0xbd, 0x28, 0xba, 0x92, 0xbd,
+  0x6c, 0x43, 0x18, 0x3e, 0x23, 0xc9, 0xf6, 0xbd, 0xf5, 0x40, 0x4f, 0xbd,
+  0x69, 0x1a, 0x89, 0xbc, 0xe6, 0xf3, 0x60, 0xbd, 0x28, 0x4f, 0xdd, 0x3d,
+  0x88, 0x57, 0x07, 0xbc, 0xe4, 0x66, 0xd0, 0xbc, 0x07, 0x57, 0x01, 0xbe,
+  0x75, 0x10, 0x13, 0xbe, 0x4d, 0xd4, 0x3e, 0x3d, 0x89, 0xf1, 0x2d, 0x3c,
+  0xfe, 0xe2, 0x38, 0x3b, 0x0c, 0x7a, 0x3b, 0xbd, 0x2a, 0x77, 0xef, 0x3d,
+  0x87, 0x5d, 0x29, 0xbd, 0xe6, 0x7b, 0xe9, 0xbe, 0x15, 0x97, 0x3c, 0xbd,
+  0xc9, 0x43, 0x0e, 0xbd, 0x71, 0x96, 0x94, 0xbd, 0xb0, 0x91, 0x4e, 0x3d,
+  0xd6, 0x59, 0x4e, 0xbe, 0x83, 0x00, 0x10, 0x3d, 0x9a, 0xe3, 0x45, 0xbc,
+  0xe2, 0x68, 0xd9, 0xbe, 0x79, 0x99, 0xec, 0xbc, 0x59, 0xf6, 0xe3, 0x3c,
+  0x63, 0x25, 0x88, 0x3d, 0xd5, 0xe3, 0x87, 0xbd, 0x26, 0xc4, 0xbe, 0xbe,
+  0x2e, 0x21, 0xad, 0x3c, 0x21, 0x83, 0x3d, 0xbd, 0xbc, 0xd9, 0x6a, 0xbe,
+  0x2e, 0x0e, 0xa9, 0xbd, 0x15, 0x2d, 0x99, 0x3b, 0xc9, 0x80, 0xf1, 0x3c,
+  0xf0, 0x6b, 0x87, 0xbd, 0x6a, 0x4a, 0xbe, 0xbd, 0xfa, 0x8b, 0x70, 0xbd,
+  0xa2, 0x3a, 0x62, 0xbd, 0xab, 0x75, 0x04, 0xbe, 0xcf, 0x6b, 0xc1, 0xbd,
+  0x8b, 0x72, 0x12, 0xbe, 0xca, 0xdc, 0x82, 0xbe, 0xe9, 0x38, 0xb0, 0xbd,
+  0xfd, 0xa1, 0x0a, 0xbe, 0xd6, 0x33, 0x5d, 0xbe, 0xa4, 0xc2, 0x0e, 0xbe,
+  0xf4, 0xb1, 0x98, 0xbd, 0x4b, 0xe2, 0x76, 0xbe, 0x69, 0x94, 0x6a, 0xbe,
+  0x8d, 0xf6, 0x7f, 0xbd, 0x56, 0x3b, 0x6b, 0xbe, 0xb5, 0x5d, 0x04, 0xbd,
+  0x94, 0xf3, 0x51, 0xbe, 0x5e, 0x33, 0x42, 0xbe, 0xd3, 0xa1, 0x15, 0xbd,
+  0x92, 0xcd, 0x59, 0xbe, 0x65, 0xc8, 0x68, 0xbe, 0xb9, 0x68, 0x98, 0xbe,
+  0xb6, 0xc8, 0x77, 0xbe, 0x4b, 0x99, 0x4d, 0xbd, 0xb9, 0xf7, 0x9d, 0xbe,
+  0x75, 0x64, 0x77, 0xbe, 0xfa, 0x76, 0xb8, 0xbd, 0xec, 0x44, 0x26, 0xbd,
+  0x77, 0xbe, 0x06, 0xbd, 0xbd, 0xd8, 0x18, 0xbe, 0xb3, 0x1e, 0x85, 0xbe,
+  0xe4, 0x3a, 0xb8, 0xbd, 0xdb, 0x50, 0x14, 0xbe, 0x5d, 0x31, 0xd1, 0xbd,
+  0x11, 0xff, 0xfa, 0xbd, 0x71, 0xfa, 0xcc, 0xbd, 0xce, 0x1b, 0xaa, 0xbc,
+  0x35, 0x34, 0xa2, 0xbc, 0xd9, 0x81, 0xcb, 0xbd, 0xc7, 0x14, 0xaa, 0xb9,
+  0xd0, 0x37, 0x74, 0x3b, 0x01, 0x18, 0x93, 0xbd, 0x7b, 0x46, 0x4d, 0xbc,
+  0xbe, 0x16, 0x69, 0xbb, 0x61, 0x9b, 0x4b, 0xbc, 0xcf, 0x60, 0x10, 0xbe,
+  0xed, 0xa5, 0xeb, 0x3c, 0xba, 0x33, 0x01, 0x3e, 0xa2, 0x4a, 0x9a, 0xbd,
+  0x4e, 0x18, 0xa5, 0xbc, 0x09, 0x64, 0xd1, 0x3d, 0x5a, 0x7a, 0xed, 0xbd,
+  0x8f, 0x43, 0x20, 0xbd, 0x41, 0xd4, 0x19, 0xbe, 0xa5, 0xb6, 0x71, 0x3d,
+  0x62, 0x99, 0x4a, 0x3e, 0x1e, 0xa2, 0x1b, 0xbe, 0xcd, 0xbf, 0x04, 0xbd,
+  0x6f, 0x81, 0xa7, 0x3d, 0x01, 0x92, 0xdb, 0xbd, 0xc2, 0x7d, 0xc9, 0xbd,
+  0x02, 0xe6, 0xe1, 0xbd, 0x0f, 0x29, 0xb8, 0xbd, 0x58, 0xbe, 0x88, 0x3e,
+  0xf2, 0x5c, 0x2e, 0xbe, 0xdd, 0xc6, 0x05, 0xbe, 0xa6, 0x25, 0x8a, 0x3d,
+  0x96, 0xab, 0x50, 0xbe, 0x2c, 0x18, 0xad, 0xbd, 0x98, 0xb2, 0xb3, 0xbc,
+  0x24, 0x7a, 0x9d, 0xba, 0xd6, 0x7a, 0xf6, 0x3d, 0xb4, 0x58, 0xfd, 0xbc,
+  0x8f, 0x09, 0x2c, 0xbc, 0x77, 0x9f, 0x87, 0xbd, 0x92, 0x71, 0xcb, 0xbd,
+  0xf8, 0xd3, 0xbd, 0xbc, 0xa0, 0x9b, 0xb0, 0x38, 0xf2, 0xb3, 0x70, 0xbd,
+  0xef, 0xf2, 0xce, 0xbd, 0xc3, 0x6b, 0xa0, 0xbd, 0x4c, 0xd3, 0x23, 0xbd,
+  0xe6, 0x00, 0x8d, 0xbe, 0x5c, 0xa9, 0xa7, 0xbd, 0xcd, 0xf9, 0x0f, 0xbe,
+  0x34, 0x18, 0x1f, 0xb9, 0xb1, 0x6f, 0x8c, 0xbd, 0x5d, 0xcc, 0x67, 0xbe,
+  0x68, 0x94, 0xef, 0xbd, 0x56, 0xc9, 0x17, 0xbe, 0x64, 0x08, 0x89, 0xbe,
+  0xc6, 0xbb, 0xac, 0xbd, 0x55, 0x9d, 0x97, 0xbd, 0x4c, 0x0c, 0xb0, 0x3d,
+  0xa4, 0xbe, 0x57, 0xbd, 0x98, 0x06, 0x48, 0xbe, 0x9d, 0x08, 0xc7, 0xbc,
+  0xe0, 0x1c, 0x85, 0xbd, 0xca, 0xd5, 0x3f, 0xbe, 0x2e, 0x31, 0x55, 0xbd,
+  0x45, 0xf0, 0x37, 0xbd, 0xf7, 0xd9, 0x72, 0xbd, 0x6d, 0xc6, 0x2e, 0x3b,
+  0x9b, 0x6c, 0xbe, 0xbd, 0x8a, 0xed, 0x0a, 0xbd, 0x2c, 0xcb, 0x97, 0xbd,
+  0x2e, 0xd1, 0x99, 0x3b, 0x49, 0xda, 0x22, 0xbe, 0xdf, 0xfa, 0x08, 0xbe,
+  0x5b, 0x7c, 0x2b, 0xbe, 0xc6, 0x02, 0x36, 0xbe, 0x1b, 0x2f, 0x83, 0xbd,
+  0x34, 0x82, 0xca, 0xbd, 0xbc, 0xd3, 0x1b, 0xbe, 0x48, 0x5a, 0x89, 0xbd,
+  0x19, 0xee, 0x50, 0xbd, 0x09, 0x2c, 0x21, 0xbd, 0xd5, 0xbd, 0xf8, 0xbc,
+  0x85, 0xcc, 0x0b, 0xbd, 0xd9, 0x4f, 0x0f, 0xbe, 0x63, 0x12, 0x38, 0x3d,
+  0xdf, 0xf3, 0x94, 0xbc, 0x89, 0x17, 0xef, 0xbd, 0xcf, 0x97, 0x16, 0xbd,
+  0x65, 0xa1, 0x24, 0xbe, 0xa7, 0xca, 0x44, 0xbe, 0x61, 0x54, 0x48, 0xbe,
+  0xcc, 0xf6, 0xc3, 0xbc, 0x49, 0xa3, 0x4c, 0xbe, 0xc2, 0x8e, 0x27, 0xbe,
+  0xe0, 0x62, 0x0b, 0xbe, 0x1e, 0x9c, 0xdf, 0xbd, 0x45, 0x14, 0x33, 0x3d,
+  0x43, 0x3a, 0x87, 0x3d, 0x6b, 0x59, 0x0b, 0x3d, 0xdb, 0xf1, 0x0b, 0xbd,
+  0x98, 0x1b, 0x32, 0xbd, 0xa3, 0x85, 0xaa, 0xbc, 0x5d, 0x13, 0xb1, 0xbd,
+  0x9c, 0x60, 0xb2, 0xbc, 0x4e, 0x0e, 0x82, 0xbd, 0x45, 0x0b, 0x1d, 0x3c,
+  0x9b, 0x5c, 0x12, 0x3d, 0x8b, 0x3f, 0xbc, 0x3c, 0x43, 0x0a, 0x73, 0x3c,
+  0x5e, 0x6e, 0x58, 0xba, 0xef, 0xdb, 0x5f, 0x3d, 0xf6, 0x22, 0x61, 0x3d,
+  0x37, 0x1c, 0xb1, 0xbc, 0xf7, 0x4d, 0x04, 0x3d, 0x4f, 0x56, 0x7e, 0xbd,
+  0x63, 0x6d, 0x4b, 0xbd, 0xc1, 0x30, 0x4d, 0xbd, 0xb8, 0x17, 0x6d, 0xbd,
+  0xa2, 0xa9, 0x3d, 0x3e, 0x21, 0x3a, 0xab, 0xbd, 0x4b, 0xfb, 0xa8, 0xbd,
+  0xb9, 0x8b, 0x25, 0xbc, 0x23, 0xea, 0x4e, 0x3a, 0x1b, 0x20, 0x45, 0xbd,
+  0x87, 0x67, 0x6d, 0xbd, 0x31, 0x5a, 0x94, 0xbd, 0x65, 0x33, 0x4a, 0x3e,
+  0x9d, 0xbb, 0x19, 0xbd, 0xa8, 0x38, 0x01, 0xbe, 0x09, 0x25, 0x92, 0xbd,
+  0xaf, 0x14, 0x45, 0xbd, 0xed, 0xdd, 0xed, 0xbd, 0x6f, 0xf7, 0xc7, 0xbc,
+  0x44, 0x21, 0x2a, 0xbc, 0xaa, 0x0e, 0xd0, 0x3c, 0xb0, 0x23, 0xff, 0xbd,
+  0x1a, 0xe6, 0xff, 0xbd, 0x5f, 0x98, 0x49, 0xbd, 0xe4, 0x0e, 0xee, 0xbd,
+  0x53, 0xb9, 0x45, 0xbe, 0xd0, 0xd4, 0xf3, 0xbd, 0x6b, 0xd1, 0x47, 0xbd,
+  0x04, 0x9a, 0x0f, 0xbd, 0xcb, 0x87, 0x9f, 0xbd, 0x20, 0xfa, 0xea, 0xbd,
+  0x10, 0xbb, 0x67, 0xbb, 0x18, 0x06, 0xc2, 0xbd, 0x9a, 0xbf, 0x54, 0xbe,
+  0x10, 0x5d, 0xf7, 0xbd, 0x9a, 0xad, 0xfc, 0xbb, 0x87, 0x79, 0x01, 0xbe,
+  0x62, 0xc3, 0x92, 0xbd, 0x6a, 0x63, 0x01, 0xbe, 0x97, 0xb9, 0x87, 0xbd,
+  0x1d, 0xc8, 0x8c, 0xbd, 0x65, 0x88, 0x29, 0xbe, 0x62, 0x20, 0xc5, 0xbd,
+  0x97, 0x1e, 0x8c, 0xbc, 0x96, 0xb7, 0x3d, 0xbe, 0xef, 0x7e, 0x6b, 0x3c,
+  0xb2, 0x84, 0x58, 0xbd, 0x27, 0x6c, 0x81, 0xbc, 0xaa, 0x45, 0x58, 0xbc,
+  0x9e, 0xe9, 0x59, 0xbd, 0x16, 0x23, 0xe6, 0xba, 0x27, 0x89, 0xcc, 0xbd,
+  0x0c, 0x48, 0x50, 0x3c, 0xc9, 0xe4, 0x47, 0xbd, 0x6c, 0x44, 0xd9, 0x3c,
+  0x2d, 0x22, 0x1f, 0x3c, 0x09, 0x91, 0xba, 0xbd, 0xb9, 0x6e, 0xfd, 0xbd,
+  0xe8, 0xc9, 0xc1, 0xbd, 0x77, 0x37, 0xce, 0xbc, 0xed, 0x5f, 0x8f, 0xbc,
+  0x72, 0x7c, 0xf4, 0x3c, 0x79, 0xd5, 0x6d, 0xbd, 0xb1, 0x55, 0x2d, 0x3d,
+  0x2c, 0x02, 0xca, 0xbd, 0xd9, 0xba, 0xb8, 0x3c, 0xc6, 0x3f, 0xd8, 0x3c,
+  0x59, 0x40, 0x28, 0xbd, 0x26, 0xa9, 0xcf, 0xbc, 0x70, 0xda, 0xd9, 0x3c,
+  0x63, 0x6f, 0xfa, 0xbc, 0x39, 0xd1, 0x90, 0x3d, 0xe0, 0xa8, 0x98, 0x3b,
+  0x8b, 0x30, 0x00, 0xbd, 0x3e, 0x7b, 0x89, 0xbd, 0x78, 0x80, 0x54, 0xbc,
+  0x49, 0x0c, 0xab, 0xbd, 0x33, 0xb3, 0x18, 0xbe, 0x7b, 0xed, 0x36, 0xbd,
+  0x1d, 0x9f, 0x25, 0xbe, 0xa8, 0xef, 0x22, 0xbe, 0x6d, 0x8f, 0x4c, 0xbd,
+  0x00, 0x88, 0xa4, 0xbd, 0x5b, 0xf6, 0x1b, 0xbe, 0x8a, 0x8b, 0xd5, 0xbc,
+  0x9d, 0x7a, 0xc6, 0xbc, 0xee, 0x62, 0x06, 0xbd, 0xb2, 0x13, 0x89, 0xbd,
+  0x9c, 0x52, 0x92, 0xbd, 0xe6, 0x69, 0xd1, 0xbd, 0x6c, 0xd2, 0x77, 0xbd,
+  0x86, 0xd7, 0x50, 0xbd, 0x69, 0x9a, 0xd4, 0x3d, 0x55, 0x59, 0x9b, 0x3c,
+  0xf4, 0x51, 0xb5, 0xbd, 0x72, 0xed, 0x3d, 0xbd, 0x47, 0x11, 0xa3, 0xbd,
+  0x5d, 0x22, 0x18, 0xbe, 0x50, 0x2c, 0x9d, 0xbd, 0x93, 0x18, 0x94, 0x3c,
+  0xf5, 0x34, 0x89, 0xbd, 0x93, 0x99, 0xa1, 0xbd, 0xfa, 0x22, 0xe7, 0xbc,
+  0x95, 0xcf, 0x26, 0xbd, 0x13, 0xba, 0xb1, 0xbd, 0xcf, 0x70, 0x3b, 0xbe,
+  0xd6, 0x14, 0x8f, 0x3c, 0xfa, 0xb5, 0x69, 0x3c, 0x40, 0x8c, 0x42, 0xbd,
+  0xdf, 0x04, 0x3b, 0xbd, 0xaf, 0xf8, 0x7b, 0xbd, 0xe3, 0xf7, 0x68, 0xbc,
+  0x1b, 0xc9, 0xac, 0xbd, 0x70, 0x15, 0x9c, 0xbd, 0x78, 0x80, 0x96, 0x3c,
+  0x6c, 0x3b, 0x47, 0xbd, 0x19, 0xfe, 0x28, 0xbe, 0x37, 0xbb, 0x38, 0xbd,
+  0x9a, 0x08, 0x0c, 0xbd, 0x98, 0x1b, 0x56, 0x3d, 0xba, 0x93, 0x0f, 0xbd,
+  0x97, 0x45, 0x4f, 0xbe, 0xd0, 0xfc, 0xbc, 0xbd, 0xfd, 0x03, 0x54, 0xbd,
+  0x93, 0xb1, 0xa6, 0xbe, 0xea, 0x44, 0x25, 0xbc, 0x91, 0x30, 0x7c, 0x3c,
+  0xc6, 0x29, 0x4e, 0xbd, 0xe6, 0xde, 0xba, 0xbd, 0xbb, 0xbd, 0x13, 0xbe,
+  0xed, 0x39, 0xca, 0xbd, 0x97, 0x12, 0xaa, 0xbd, 0x54, 0x1b, 0xb3, 0xbe,
+  0x75, 0x22, 0x8b, 0xbd, 0x5e, 0x8c, 0xb5, 0xbc, 0x93, 0x7c, 0xab, 0xbd,
+  0x79, 0x2a, 0x00, 0xbe, 0xa8, 0x2a, 0x00, 0xbe, 0xf4, 0x85, 0xac, 0xbd,
+  0xda, 0xbb, 0xa2, 0xbc, 0xdf, 0xe9, 0x63, 0xbe, 0x93, 0xb7, 0x0a, 0xbc,
+  0xed, 0xa2, 0xac, 0x3c, 0xb9, 0x50, 0xde, 0xbd, 0x33, 0x5a, 0x31, 0xbd,
+  0xdf, 0x04, 0x5c, 0xbd, 0x22, 0xae, 0xf7, 0x3b, 0xe9, 0xeb, 0x4a, 0x3a,
+  0x44, 0x63, 0x3e, 0xbd, 0xb2, 0x71, 0xb5, 0x3d, 0x63, 0xde, 0x50, 0xbd,
+  0x96, 0xd5, 0x75, 0xbc, 0x88, 0x63, 0x82, 0xbd, 0x43, 0xc4, 0xa0, 0xbd,
+  0x46, 0x8a, 0xa5, 0xbd, 0x89, 0xff, 0x88, 0x3d, 0x39, 0xf3, 0xee, 0xbd,
+  0xfb, 0x26, 0xcd, 0x3d, 0x92, 0xbd, 0x95, 0x3d, 0xad, 0x70, 0xc1, 0x3d,
+  0x3c, 0xf7, 0x46, 0x3d, 0xd6, 0x4c, 0x3a, 0xbd, 0x64, 0x09, 0xce, 0x3d,
+  0x0d, 0x24, 0xd2, 0x3d, 0x60, 0xcb, 0x70, 0xbd, 0xc8, 0xba, 0xcd, 0x3d,
+  0x73, 0x19, 0x01, 0x3e, 0xad, 0xe2, 0x39, 0x3d, 0x23, 0xf8, 0x5c, 0x3d,
+  0xe9, 0x30, 0x07, 0xbc, 0x87, 0x64, 0x27, 0x3d, 0xa1, 0x5c, 0xbf, 0x3d,
+  0x62, 0xf2, 0x4d, 0xbc, 0x57, 0x2c, 0x99, 0x3d, 0x35, 0x3f, 0x21, 0x3d,
+  0xb6, 0xf7, 0x9f, 0xbd, 0x01, 0xe3, 0xd7, 0x3b, 0xaf, 0xc3, 0xb7, 0x3b,
+  0x2f, 0xe8, 0x11, 0xbd, 0xec, 0x5c, 0x5e, 0x3c, 0x4a, 0xaf, 0xbc, 0xbd,
+  0x85, 0x50, 0xeb, 0x3c, 0x12, 0xa0, 0xbb, 0xbd, 0x88, 0x2d, 0xb1, 0xbd,
+  0x59, 0x2d, 0xfd, 0xbd, 0xc6, 0x79, 0xa0, 0xbd, 0xa0, 0x29, 0xb9, 0xbd,
+  0x89, 0x41, 0x27, 0xbe, 0x0b, 0x94, 0x87, 0xbc, 0xf7, 0xcc, 0x92, 0x3d,
+  0xa4, 0xfc, 0xcb, 0x3d, 0x74, 0xae, 0x4e, 0x3d, 0xbd, 0x60, 0x85, 0x3d,
+  0x2a, 0xa4, 0x6d, 0xbd, 0x1d, 0xaa, 0x0b, 0x3d, 0x7a, 0xc3, 0x9b, 0x3d,
+  0x0f, 0x43, 0x23, 0x3d, 0x62, 0xf3, 0x03, 0x3e, 0x59, 0x67, 0xa0, 0x3d,
+  0x2e, 0x40, 0x81, 0x3d, 0x75, 0xa2, 0xbc, 0x3d, 0xca, 0xbe, 0x8e, 0xbc,
+  0x75, 0x34, 0xad, 0x3d, 0xb2, 0x99, 0xef, 0x3d, 0x68, 0x28, 0x07, 0x3d,
+  0x2c, 0xeb, 0xf7, 0x3d, 0xcc, 0x94, 0xcd, 0x3d, 0x34, 0x3e, 0x9c, 0x3d,
+  0x68, 0x72, 0x2a, 0xbb, 0x77, 0x58, 0xb8, 0xbc, 0x53, 0x60, 0x67, 0x3c,
+  0x65, 0xea, 0x1b, 0x3e, 0x05, 0x22, 0x75, 0x3d, 0x37, 0x35, 0x34, 0x3d,
+  0xe7, 0xcf, 0xf1, 0x3c, 0x39, 0xb2, 0x07, 0x3d, 0x22, 0xdb, 0x80, 0x3d,
+  0x49, 0x0b, 0xf2, 0xbd, 0xb4, 0xe9, 0x77, 0x3d, 0x3e, 0x71, 0x10, 0x3e,
+  0x24, 0x79, 0x13, 0xbe, 0x3b, 0x39, 0x1a, 0x3e, 0xea, 0xee, 0x8b, 0x3d,
+  0xa8, 0x99, 0xf2, 0x3d, 0x7d, 0x07, 0x55, 0x3d, 0xd0, 0x31, 0xce, 0xbd,
+  0x40, 0x40, 0x11, 0x3d, 0x50, 0xd7, 0xc4, 0x3c, 0xac, 0xcc, 0x49, 0xbe,
+  0x5f, 0x1b, 0x3b, 0x3d, 0xae, 0x9d, 0x0d, 0xbc, 0xd5, 0x7e, 0x8f, 0x3d,
+  0x3f, 0x39, 0x35, 0x3d, 0x67, 0x3b, 0x8e, 0xbd, 0x08, 0x17, 0x08, 0x3c,
+  0x80, 0xe3, 0x04, 0x3b, 0xa6, 0x7b, 0x4e, 0xbe, 0x6b, 0x24, 0xe1, 0x3d,
+  0xfb, 0x31, 0xa3, 0x3d, 0x90, 0x1b, 0xd3, 0x3d, 0x4b, 0xbe, 0x20, 0x3c,
+  0x69, 0xf0, 0x49, 0x3c, 0x62, 0xb3, 0xc8, 0xbc, 0x22, 0xf3, 0xcf, 0x3c,
+  0x81, 0x54, 0x32, 0xbe, 0x38, 0xe7, 0x90, 0x3d, 0x26, 0x6c, 0xbc, 0x3d,
+  0xd4, 0xb9, 0x94, 0xbc, 0xde, 0x79, 0x09, 0xbc, 0x5a, 0x0b, 0x94, 0xbc,
+  0xab, 0x0b, 0x56, 0x3d, 0x15, 0x6b, 0x84, 0x3d, 0xbd, 0x68, 0x59, 0xbd,
+  0x1a, 0xd9, 0xd5, 0x3d, 0x8e, 0xf9, 0xf2, 0x3d, 0xf0, 0x15, 0x1e, 0x3e,
+  0x15, 0xb7, 0x64, 0x3c, 0x20, 0xe9, 0xd7, 0x3b, 0x3e, 0x08, 0x41, 0x3d,
+  0xa6, 0xc1, 0x9f, 0x3d, 0xb0, 0xb6, 0x5a, 0xbd, 0xbc, 0x10, 0x11, 0x3e,
+  0x0f, 0x28, 0x52, 0x3d, 0x1f, 0x95, 0x0d, 0x3d, 0xb7, 0x97, 0x1d, 0x3e,
+  0x1c, 0xb9, 0x3c, 0xbd, 0xa7, 0xd5, 0x02, 0x3e, 0xed, 0xe8, 0xf1, 0x3d,
+  0xcf, 0x01, 0xdf, 0xbd, 0xc7, 0xb3, 0x12, 0x3d, 0x61, 0x3b, 0x92, 0x3d,
+  0x6a, 0x43, 0xf9, 0xbc, 0x3b, 0x2e, 0xad, 0x3d, 0xde, 0x96, 0x5d, 0xbd,
+  0x4b, 0x18, 0x4d, 0xbd, 0x8b, 0x65, 0x08, 0xbd, 0x31, 0x97, 0xd2, 0xbd,
+  0xcb, 0xdb, 0xae, 0xbd, 0x82, 0x1b, 0x09, 0x3d, 0x6b, 0x06, 0xc0, 0xbd,
+  0x30, 0x97, 0xb2, 0xbd, 0x1d, 0xac, 0x78, 0xbd, 0xf0, 0x1f, 0x63, 0xbd,
+  0xaf, 0x79, 0x6a, 0xbd, 0x38, 0xf7, 0xff, 0xff, 0x3c, 0xf7, 0xff, 0xff,
+  0x0f, 0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00,
+  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00,
+  0x50, 0x02, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xe4, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00,
+  0xe4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xaa, 0xfe, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x14, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xda, 0xfe, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xfc, 0xf7, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x3e, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b,
+  0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x7a, 0xff, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+  0x24, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xc6, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x37, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x07, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00,
+  0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x34, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x17, 0x00,
+  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00,
+  0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x14, 0x00, 0x13, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xf8, 0x05, 0x00, 0x00, 0xa0, 0x05, 0x00, 0x00,
+  0x4c, 0x05, 0x00, 0x00, 0xf8, 0x04, 0x00, 0x00, 0x84, 0x04, 0x00, 0x00,
+  0x44, 0x04, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00, 0x60, 0x03, 0x00, 0x00,
+  0xb0, 0x02, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0xe8, 0x01, 0x00, 0x00,
+  0x94, 0x01, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x5e, 0xfa, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00,
+  0x40, 0xfa, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74,
+  0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f,
+  0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x5f, 0x31, 0x3a, 0x30, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0xb6, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x0a, 0x00, 0x00, 0x00, 0x98, 0xfa, 0xff, 0xff, 0x38, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31,
+  0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x74,
+  0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
   0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31,
-  0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e,
-  0x73, 0x65, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x2e, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x48, 0x05, 0x00, 0x00, 0x10, 0xfb, 0xff, 0xff,
-  0x1e, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
-  0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e,
-  0x5f, 0x31, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x05, 0x00, 0x00,
-  0x7e, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x34, 0x00, 0x00, 0x00, 0x60, 0xfb, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00,
+  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x2e, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x48, 0x05, 0x00, 0x00, 0x10, 0xfb, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x00,
   0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31,
   0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x5f, 0x31, 0x2f, 0x52,
-  0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2f, 0x73, 0x68, 0x61, 0x70, 0x65,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xd2, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x34, 0x00, 0x00, 0x00, 0xb4, 0xfb, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31,
-  0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x5f, 0x31, 0x2f, 0x73,
-  0x74, 0x72, 0x69, 0x64, 0x65, 0x64, 0x5f, 0x73, 0x6c, 0x69, 0x63, 0x65,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xfd, 0xff, 0xff,
+  0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x48, 0x05, 0x00, 0x00, 0x7e, 0xfc, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2c, 0x00, 0x00, 0x00,
-  0x04, 0xfc, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x34, 0x00, 0x00, 0x00,
+  0x60, 0xfb, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
   0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x66, 0x6c, 0x61,
-  0x74, 0x74, 0x65, 0x6e, 0x5f, 0x31, 0x2f, 0x53, 0x68, 0x61, 0x70, 0x65,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x7a, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x64, 0xfc, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x6d, 0x61, 0x78,
-  0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x32, 0x64, 0x5f, 0x31,
-  0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c, 0x32, 0x64, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xee, 0xfc, 0xff, 0xff,
+  0x74, 0x74, 0x65, 0x6e, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61,
+  0x70, 0x65, 0x2f, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xd2, 0xfc, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x34, 0x00, 0x00, 0x00,
+  0xb4, 0xfb, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x66, 0x6c, 0x61,
+  0x74, 0x74, 0x65, 0x6e, 0x5f, 0x31, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x64,
+  0x65, 0x64, 0x5f, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x2c, 0x00, 0x00, 0x00, 0x04, 0xfc, 0xff, 0xff,
+  0x1c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e,
+  0x5f, 0x31, 0x2f, 0x53, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x7a, 0xfc, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00,
-  0x1a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xd8, 0xfc, 0xff, 0xff,
-  0x5c, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x24, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0d, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x64, 0xfc, 0xff, 0xff,
+  0x26, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f,
+  0x6c, 0x69, 0x6e, 0x67, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x78,
+  0x50, 0x6f, 0x6f, 0x6c, 0x32, 0x64, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0xee, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0xd8, 0xfc, 0xff, 0xff, 0x5c, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31,
+  0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x52, 0x65,
+  0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61,
+  0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31,
+  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x73, 0x65, 0x71,
+  0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f,
+  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f,
+  0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x31, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xee, 0xfd, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x6c, 0xfd, 0xff, 0xff,
+  0x5b, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
   0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
   0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65,
   0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
   0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
   0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f,
   0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x31,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0xee, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
-  0x6c, 0xfd, 0xff, 0xff, 0x5b, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e,
-  0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x73,
-  0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x3b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74,
-  0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69,
-  0x6f, 0x6e, 0x3b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x72, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0xf0, 0xfd, 0xff, 0xff, 0x21, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e,
-  0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f, 0x6c,
-  0x75, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x00, 0x4c, 0xfe, 0xff, 0xff,
-  0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x32, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xa6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x38, 0x00, 0x00, 0x00, 0x88, 0xfe, 0xff, 0xff,
-  0x2a, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x72, 0xfe, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xf0, 0xfd, 0xff, 0xff,
+  0x21, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
+  0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f,
+  0x6e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x6a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x1c, 0x00, 0x00, 0x00, 0x4c, 0xfe, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
+  0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61,
+  0x6e, 0x74, 0x32, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x38, 0x00, 0x00, 0x00, 0x88, 0xfe, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31,
+  0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x5f, 0x31, 0x2f, 0x73,
+  0x74, 0x72, 0x69, 0x64, 0x65, 0x64, 0x5f, 0x73, 0x6c, 0x69, 0x63, 0x65,
+  0x2f, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00,
+  0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x34, 0x00, 0x00, 0x00, 0xf8, 0xfe, 0xff, 0xff,
+  0x26, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69,
   0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e,
-  0x5f, 0x31, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x64, 0x5f, 0x73,
-  0x6c, 0x69, 0x63, 0x65, 0x2f, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
-  0x1c, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00,
+  0x5f, 0x31, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2f, 0x73,
+  0x68, 0x61, 0x70, 0x65, 0x2f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x44, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74,
+  0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x18, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x34, 0x00, 0x00, 0x00,
-  0xf8, 0xfe, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
-  0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x66, 0x6c, 0x61,
-  0x74, 0x74, 0x65, 0x6e, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61,
-  0x70, 0x65, 0x2f, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2f, 0x31, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xc6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x44, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
-  0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61,
-  0x6e, 0x74, 0x31, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x16, 0x00, 0x18, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00,
-  0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x94, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74,
-  0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x48, 0x05, 0x00, 0x00,
-  0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x14, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x94, 0xff, 0xff, 0xff,
+  0x0e, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
+  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x48, 0x05, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x1c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76,
+  0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f,
+  0x6b, 0x65, 0x72, 0x61, 0x73, 0x5f, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72,
+  0x3a, 0x30, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61,
-  0x75, 0x6c, 0x74, 0x5f, 0x6b, 0x65, 0x72, 0x61, 0x73, 0x5f, 0x74, 0x65,
-  0x6e, 0x73, 0x6f, 0x72, 0x3a, 0x30, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x64, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xac, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x19, 0xb8, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xc4, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x16, 0xd0, 0xff, 0xff, 0xff, 0x53, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x53, 0xdc, 0xff, 0xff, 0xff, 0x2d, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x2d, 0xe8, 0xff, 0xff, 0xff, 0x4d, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x4d, 0xf4, 0xff, 0xff, 0xff, 0x11, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x11, 0x0c, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03
+  0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x54, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xac, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+  0xb8, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xc4, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+  0xd0, 0xff, 0xff, 0xff, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53,
+  0xdc, 0xff, 0xff, 0xff, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d,
+  0xe8, 0xff, 0xff, 0xff, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d,
+  0xf4, 0xff, 0xff, 0xff, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x0c, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03
 };
-unsigned int mnist_cnn_tflite_len = 57496;
+const unsigned int mnist_cnn_tflite_len = 57528;
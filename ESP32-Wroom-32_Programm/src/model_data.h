@@ -1,17 +1,17 @@
-unsigned char trained_lstm_tflite[] = {
+alignas(16) const unsigned char trained_lstm_tflite[] = {
   0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00,
   0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00,
   0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x88, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x34, 0x98, 0x00, 0x00,
-  0x44, 0x98, 0x00, 0x00, 0x94, 0xa0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x67, 0xff, 0xff,
+  0x88, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x84, 0x98, 0x00, 0x00,
+  0x94, 0x98, 0x00, 0x00, 0xe4, 0xa0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xb2, 0x66, 0xff, 0xff,
   0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
   0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f,
   0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x04, 0x00, 0x00, 0x00, 0x94, 0xff, 0xff, 0xff, 0x15, 0x00, 0x00, 0x00,
   0x04, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x75,
   0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xb6, 0x67, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x66, 0x67, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
   0x0b, 0x00, 0x00, 0x00, 0x66, 0x69, 0x78, 0x65, 0x64, 0x5f, 0x69, 0x6e,
   0x70, 0x75, 0x74, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
   0x04, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
@@ -21,35 +21,36 @@ unsigned char trained_lstm_tflite[] = {
   0x08, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
   0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74,
   0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x50, 0x97, 0x00, 0x00, 0x48, 0x97, 0x00, 0x00,
-  0x10, 0x97, 0x00, 0x00, 0xb0, 0x96, 0x00, 0x00, 0x98, 0x96, 0x00, 0x00,
-  0x48, 0x90, 0x00, 0x00, 0xf8, 0x89, 0x00, 0x00, 0xa8, 0x83, 0x00, 0x00,
-  0x58, 0x7d, 0x00, 0x00, 0xf8, 0x7c, 0x00, 0x00, 0x98, 0x7c, 0x00, 0x00,
-  0x38, 0x7c, 0x00, 0x00, 0xd8, 0x7b, 0x00, 0x00, 0x08, 0x73, 0x00, 0x00,
-  0x38, 0x6a, 0x00, 0x00, 0x68, 0x61, 0x00, 0x00, 0x98, 0x58, 0x00, 0x00,
-  0x08, 0x01, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00,
-  0x98, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
-  0x68, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x92, 0x68, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x32, 0x2e, 0x31, 0x30, 0x2e, 0x30, 0x00, 0x00, 0xf2, 0x68, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x33,
-  0x2e, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x61, 0xff, 0xff, 0x64, 0x61, 0xff, 0xff, 0x68, 0x61, 0xff, 0xff,
-  0x6c, 0x61, 0xff, 0xff, 0x1e, 0x69, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0xa0, 0x97, 0x00, 0x00, 0x98, 0x97, 0x00, 0x00,
+  0x5c, 0x97, 0x00, 0x00, 0xf0, 0x96, 0x00, 0x00, 0xd4, 0x96, 0x00, 0x00,
+  0x80, 0x90, 0x00, 0x00, 0x2c, 0x8a, 0x00, 0x00, 0xd8, 0x83, 0x00, 0x00,
+  0x84, 0x7d, 0x00, 0x00, 0x20, 0x7d, 0x00, 0x00, 0xbc, 0x7c, 0x00, 0x00,
+  0x58, 0x7c, 0x00, 0x00, 0xf4, 0x7b, 0x00, 0x00, 0x20, 0x73, 0x00, 0x00,
+  0x4c, 0x6a, 0x00, 0x00, 0x78, 0x61, 0x00, 0x00, 0xa4, 0x58, 0x00, 0x00,
+  0x10, 0x01, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
+  0x9c, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x42, 0x68, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x32, 0x2e, 0x31, 0x30, 0x2e, 0x30, 0x00, 0x00,
+  0xa6, 0x68, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x31, 0x2e, 0x31, 0x33, 0x2e, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x61, 0xff, 0xff, 0x18, 0x61, 0xff, 0xff,
+  0x1c, 0x61, 0xff, 0xff, 0x20, 0x61, 0xff, 0xff, 0xd2, 0x68, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x7a, 0x69, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x57, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x69, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x57, 0x00, 0x00,
   0xeb, 0x3f, 0x5f, 0x3e, 0xaa, 0xf0, 0x42, 0xbe, 0x9b, 0x8a, 0xd4, 0xbd,
   0x2d, 0x29, 0x5e, 0x3e, 0x19, 0xdb, 0xb1, 0xbd, 0xe2, 0x88, 0x0e, 0x3d,
   0x1a, 0xa4, 0x67, 0x3d, 0xe1, 0x1f, 0x07, 0x3e, 0x9d, 0xc9, 0xa3, 0x3d,
@@ -1916,383 +1917,384 @@ unsigned char trained_lstm_tflite[] = {
   0x2a, 0xf8, 0x90, 0x3d, 0x94, 0x1b, 0x1a, 0x3e, 0x6c, 0x1f, 0x2d, 0x3e,
   0xd6, 0x1b, 0x1c, 0x3e, 0x4b, 0x99, 0x00, 0x3e, 0xac, 0x01, 0x27, 0x3e,
   0x75, 0x80, 0xb0, 0x3e, 0x15, 0xbb, 0x9c, 0x3e, 0x74, 0x22, 0x91, 0x3e,
-  0x2e, 0xa0, 0x5b, 0xbc, 0x21, 0x50, 0xbd, 0x3e, 0x06, 0xc1, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0xc0, 0x08, 0x00, 0x00, 0xdd, 0xb9, 0xa2, 0xbc,
-  0x03, 0xfe, 0xe6, 0x3d, 0x06, 0xfc, 0x32, 0xbe, 0x05, 0xa8, 0x60, 0xbf,
-  0xdf, 0x84, 0x84, 0xbf, 0x16, 0x8e, 0x33, 0xbf, 0x01, 0x18, 0x83, 0xbf,
-  0x06, 0x81, 0x8f, 0xbf, 0x30, 0x7e, 0x1e, 0xbf, 0x77, 0x30, 0x43, 0xbf,
-  0x6e, 0x48, 0x12, 0xbf, 0x49, 0x83, 0x27, 0xbf, 0x67, 0x23, 0x36, 0xbf,
-  0xb9, 0x98, 0x09, 0xbf, 0xa2, 0x0d, 0x47, 0xbe, 0x7a, 0x89, 0x06, 0x3d,
-  0x7a, 0x7f, 0x12, 0x3e, 0x35, 0x6b, 0x4e, 0x3e, 0x72, 0x9c, 0x6f, 0x3d,
-  0x0d, 0x2e, 0x14, 0xbe, 0xa8, 0x15, 0xa6, 0x3d, 0xc5, 0xd2, 0x98, 0x3e,
-  0x27, 0x73, 0x09, 0x3e, 0xde, 0x3c, 0xfe, 0x3d, 0x62, 0xe5, 0x0f, 0xbd,
-  0xf8, 0x24, 0xf0, 0x3e, 0x96, 0xbd, 0x73, 0xbe, 0x2c, 0xa9, 0xa2, 0x3d,
-  0x5b, 0x28, 0x92, 0xbe, 0x69, 0x1c, 0x01, 0x3d, 0xe6, 0x79, 0x3a, 0xbe,
-  0xc4, 0x9b, 0xe5, 0xbd, 0x42, 0x5e, 0x09, 0xbf, 0xe3, 0x23, 0xf4, 0xbe,
-  0xb9, 0x75, 0xa8, 0xbe, 0xee, 0x5e, 0x30, 0x3d, 0x71, 0xf9, 0x31, 0x3d,
-  0x1f, 0x86, 0x28, 0x3f, 0x53, 0xb9, 0xb5, 0x3e, 0x91, 0xff, 0xa1, 0x3e,
-  0xe4, 0xe4, 0xaa, 0x3d, 0x55, 0xf4, 0x87, 0x3e, 0x7b, 0x95, 0x26, 0x3f,
-  0x2c, 0x51, 0x51, 0x3f, 0xb2, 0x73, 0xbb, 0x3e, 0x07, 0x24, 0x26, 0x3f,
-  0x09, 0x86, 0x35, 0x3f, 0x16, 0x12, 0xfe, 0x3e, 0xca, 0xaa, 0x87, 0x3e,
-  0x9e, 0xd2, 0xe4, 0x3e, 0x1a, 0x88, 0xe5, 0x3e, 0x8c, 0x58, 0x35, 0x3f,
-  0xea, 0x7c, 0xf6, 0x3e, 0x63, 0x51, 0x28, 0x3e, 0x47, 0x10, 0x0f, 0x3f,
-  0xe6, 0x1a, 0xd4, 0x3e, 0xbd, 0x11, 0xb6, 0xbd, 0xe8, 0x04, 0xd7, 0xbd,
-  0xaf, 0xdd, 0xab, 0x3e, 0x92, 0x1c, 0xb0, 0x3e, 0x8c, 0x1c, 0x20, 0x3e,
-  0x1b, 0x54, 0xfe, 0x3d, 0x57, 0x8a, 0x49, 0x3f, 0x1c, 0x31, 0xef, 0x3e,
-  0x51, 0x80, 0x28, 0xbd, 0xc3, 0x4f, 0x93, 0x3e, 0x73, 0x21, 0x34, 0x3d,
-  0xe0, 0x2f, 0x2a, 0xbe, 0xe6, 0xe9, 0x7a, 0xbe, 0x91, 0x0a, 0xd8, 0xbc,
-  0xcf, 0x28, 0xd7, 0x3d, 0x5d, 0x30, 0x0b, 0xbd, 0x63, 0x7a, 0x79, 0x3e,
-  0x2d, 0x01, 0xcf, 0x3e, 0x3f, 0x83, 0xab, 0xbd, 0x61, 0xac, 0xab, 0x3e,
-  0x80, 0x8b, 0x29, 0x3e, 0x4c, 0xd3, 0x24, 0xbe, 0x7d, 0xb1, 0xf5, 0x3d,
-  0x02, 0xef, 0xcb, 0x3e, 0x08, 0x73, 0x30, 0x3f, 0x09, 0xd8, 0x7f, 0x3f,
-  0x8d, 0xa3, 0x0b, 0x3f, 0xf5, 0xc8, 0xa4, 0x3d, 0xed, 0x01, 0x4e, 0xbe,
-  0x9c, 0xfa, 0x8d, 0xbe, 0xec, 0x32, 0x14, 0x3e, 0xe5, 0xb4, 0x47, 0x3e,
-  0x2b, 0x55, 0xe1, 0x3d, 0x10, 0xb9, 0x3b, 0xbe, 0x15, 0xd6, 0xb8, 0xbd,
-  0xe0, 0xc8, 0x87, 0xbe, 0x86, 0x94, 0x54, 0x3d, 0xb2, 0xbe, 0x43, 0xbb,
-  0x61, 0x71, 0x48, 0xbe, 0xe6, 0x00, 0xe6, 0xbe, 0xd1, 0x4d, 0x18, 0xbe,
-  0x98, 0xce, 0xa9, 0x3c, 0x06, 0x27, 0x1d, 0x3e, 0x38, 0xe8, 0x51, 0x3d,
-  0x55, 0xaf, 0xd1, 0x3e, 0x74, 0xec, 0xa3, 0x3e, 0x93, 0x1d, 0x20, 0x3f,
-  0xd0, 0x3b, 0x03, 0x3f, 0xc1, 0x4e, 0x28, 0x3e, 0xf4, 0xac, 0x08, 0x3e,
-  0xc5, 0xb8, 0x35, 0x3f, 0x6c, 0xd1, 0xd3, 0x3e, 0x66, 0xac, 0x1b, 0x3f,
-  0x39, 0x5b, 0xfe, 0x3c, 0x2b, 0x89, 0x0a, 0x3f, 0xce, 0x7e, 0x96, 0x3e,
-  0x66, 0x0c, 0x0d, 0xbd, 0x33, 0x36, 0x3d, 0xbe, 0xf3, 0xfe, 0x4f, 0xbc,
-  0xe9, 0x76, 0x4e, 0xbf, 0xbe, 0x4e, 0x1d, 0xbe, 0x9e, 0xc4, 0x80, 0x3d,
-  0x8d, 0xba, 0xd9, 0x3e, 0x75, 0x31, 0x5d, 0x3e, 0x6d, 0x63, 0x49, 0xbe,
-  0xdb, 0x9d, 0xd0, 0xbe, 0xbb, 0xdd, 0x96, 0x3d, 0xf3, 0x82, 0x5e, 0x3e,
-  0x1f, 0x09, 0x2e, 0x3f, 0x14, 0x07, 0x71, 0xbe, 0x96, 0x61, 0xd6, 0xbe,
-  0x1f, 0xc4, 0x66, 0xbe, 0xb1, 0xc8, 0xb8, 0x3d, 0xf7, 0xba, 0xae, 0x3e,
-  0xfe, 0x60, 0xdd, 0xbd, 0x7e, 0xd6, 0x35, 0xbe, 0x77, 0xfe, 0x71, 0xbe,
-  0x57, 0x40, 0x8f, 0xbc, 0x0b, 0xe3, 0xe8, 0x3e, 0xda, 0x2d, 0xaf, 0x3e,
-  0xb1, 0x85, 0x56, 0xbe, 0x22, 0x7d, 0x10, 0x3e, 0x46, 0x52, 0xf3, 0x3b,
-  0x6a, 0xfa, 0xec, 0xbc, 0xcb, 0x92, 0x4d, 0xbd, 0x96, 0x07, 0x0e, 0x3e,
-  0x3f, 0x9a, 0xcd, 0x3e, 0x28, 0xd3, 0x48, 0x3f, 0x0a, 0x0e, 0x44, 0x3f,
-  0x02, 0xf5, 0xe4, 0x3d, 0x32, 0x37, 0x57, 0x3e, 0xfa, 0xc2, 0x20, 0xbd,
-  0x4b, 0x7d, 0x38, 0xbe, 0xcc, 0x6c, 0x71, 0xbd, 0x0d, 0xf0, 0x79, 0xbe,
-  0x55, 0x13, 0xa3, 0xbe, 0x10, 0xec, 0xa1, 0x3d, 0x9c, 0xc9, 0xf2, 0x3e,
-  0xe4, 0xe7, 0x0c, 0x3f, 0xaf, 0x94, 0xba, 0x3e, 0x21, 0xe9, 0x34, 0x3f,
-  0xae, 0xc3, 0x4e, 0x3f, 0x56, 0x62, 0x32, 0x3f, 0x81, 0x63, 0xe3, 0x3e,
-  0x55, 0x51, 0x27, 0x3f, 0xd7, 0x50, 0xcc, 0x3e, 0x6c, 0xf2, 0xa5, 0x3e,
-  0xd8, 0x30, 0x3d, 0x3f, 0xfc, 0x71, 0x3e, 0x3f, 0x3e, 0xd1, 0x3c, 0x3d,
-  0x31, 0x1b, 0x3c, 0x3e, 0xa3, 0xc7, 0xcc, 0x3d, 0xc7, 0x09, 0x48, 0x3d,
-  0xd7, 0x03, 0x4e, 0x3e, 0xe6, 0xb9, 0xbf, 0x3e, 0x3e, 0xe5, 0xc5, 0x3e,
-  0xe8, 0xdf, 0xdd, 0xbd, 0x7e, 0xa4, 0x55, 0xbd, 0x80, 0x40, 0x2a, 0x3e,
-  0x22, 0xa1, 0x2e, 0x3e, 0x44, 0xd8, 0x55, 0xbc, 0x22, 0x0b, 0xa6, 0x3e,
-  0x3c, 0x99, 0x8b, 0xbd, 0x4b, 0x6c, 0x1a, 0xbc, 0x72, 0x69, 0x52, 0xbe,
-  0x6e, 0xa6, 0x7a, 0xbe, 0xba, 0x21, 0xbb, 0x3e, 0x49, 0x28, 0x82, 0x3e,
-  0xf2, 0xbe, 0x2c, 0xbe, 0x77, 0x57, 0x0f, 0xbd, 0x8d, 0x83, 0xb2, 0x3e,
-  0xd2, 0x78, 0x25, 0x3f, 0x49, 0x78, 0x10, 0x3f, 0xb0, 0xb1, 0x0e, 0x3f,
-  0xff, 0x72, 0x13, 0x3f, 0x48, 0x66, 0x11, 0x3f, 0x34, 0xf7, 0x54, 0x3f,
-  0x3b, 0x36, 0x0c, 0x3f, 0xf4, 0xf1, 0x84, 0x3e, 0xdc, 0x68, 0x81, 0x3e,
-  0x7d, 0x1f, 0x46, 0xbe, 0x46, 0x3a, 0x41, 0xbe, 0xfe, 0x3b, 0xbf, 0xbe,
-  0x6a, 0xc1, 0xe3, 0x3e, 0x1a, 0x8a, 0x48, 0x3e, 0x2d, 0x53, 0xc2, 0x3b,
-  0x0a, 0xe1, 0xae, 0x3e, 0x3a, 0xd0, 0xe7, 0x3e, 0x5f, 0x08, 0x0c, 0x3c,
-  0x02, 0xa1, 0xe2, 0xbd, 0xcd, 0x54, 0x72, 0xbd, 0x42, 0x59, 0x55, 0xbe,
-  0xc8, 0x2e, 0xff, 0xbd, 0x52, 0x72, 0xb3, 0xbe, 0xb8, 0xfa, 0x93, 0xbe,
-  0xb9, 0x66, 0xde, 0xbd, 0x2a, 0xf1, 0x75, 0xbe, 0xc8, 0x0b, 0x17, 0x3d,
-  0x35, 0x62, 0xa2, 0x3d, 0x49, 0x3b, 0x18, 0x3f, 0x7c, 0x33, 0x35, 0x3f,
-  0x29, 0x01, 0x50, 0x3f, 0x12, 0x99, 0x39, 0x3f, 0xe1, 0xf6, 0x1e, 0x3f,
-  0xca, 0x09, 0xbb, 0x3d, 0xd0, 0xb7, 0x0a, 0xbe, 0x74, 0x17, 0x8c, 0xbe,
-  0xe1, 0xc3, 0xe9, 0xbd, 0xf2, 0x4a, 0x3f, 0xbe, 0x12, 0xfc, 0x76, 0xbd,
-  0x1b, 0x03, 0x44, 0x3f, 0xb5, 0x15, 0x92, 0x3f, 0x4e, 0xef, 0xdf, 0x3e,
-  0x17, 0x68, 0x1d, 0x3f, 0x69, 0x6b, 0xfc, 0x3d, 0xda, 0x49, 0xe2, 0x3e,
-  0x13, 0x7c, 0xbf, 0x3e, 0x59, 0x9d, 0x9c, 0xbe, 0x8e, 0x47, 0x80, 0xbe,
-  0xeb, 0x79, 0xa1, 0xbe, 0x11, 0x1f, 0xb8, 0xbd, 0xfd, 0x4c, 0xf8, 0xbd,
-  0xa0, 0x79, 0x00, 0xbe, 0xcf, 0x0e, 0x81, 0xbe, 0x39, 0x32, 0x45, 0xbe,
-  0x74, 0x0c, 0x28, 0x3d, 0x78, 0x06, 0xfb, 0x3e, 0x8e, 0x6e, 0x73, 0x3f,
-  0x66, 0x59, 0x52, 0x3f, 0x97, 0x5f, 0x7f, 0x3f, 0xe0, 0x15, 0x17, 0x3f,
-  0x24, 0xca, 0xe3, 0x3e, 0x05, 0xed, 0xe1, 0x3e, 0x4b, 0xe0, 0x2f, 0xbe,
-  0x79, 0x03, 0x2d, 0x3f, 0xf9, 0x7c, 0x93, 0x3e, 0x81, 0x99, 0x1e, 0x3c,
-  0xc0, 0xf6, 0x83, 0xbe, 0x30, 0x09, 0x3b, 0x3f, 0x77, 0x0a, 0x37, 0x3f,
-  0x3b, 0x30, 0x31, 0x3f, 0x90, 0x59, 0x2a, 0x3f, 0x66, 0xc8, 0x16, 0x3f,
-  0x3b, 0x62, 0x1d, 0x3e, 0x08, 0xca, 0xcd, 0x3d, 0x0d, 0xc4, 0x6d, 0xbe,
-  0x82, 0x9d, 0x69, 0xbe, 0x3a, 0xeb, 0x8a, 0xbd, 0x1a, 0xb0, 0xf3, 0xbd,
-  0xec, 0x2d, 0x8d, 0x3d, 0x71, 0x53, 0xc4, 0x3e, 0x6c, 0xcc, 0xeb, 0x3c,
-  0xd5, 0x61, 0x7e, 0xbe, 0x88, 0xd9, 0x28, 0x3d, 0x81, 0xd5, 0x48, 0x3d,
-  0x62, 0x88, 0x04, 0xbe, 0xfa, 0xd1, 0x8a, 0xbe, 0x95, 0x7f, 0x3c, 0xbe,
-  0x6e, 0x5d, 0x41, 0x3e, 0x5a, 0x4c, 0x14, 0x3e, 0x36, 0x80, 0x82, 0x3e,
-  0x8a, 0xc5, 0x1d, 0xbe, 0xf8, 0x08, 0xfa, 0x3e, 0xc7, 0x1e, 0x28, 0x3f,
-  0x41, 0xde, 0x68, 0xbe, 0x06, 0x76, 0x9d, 0x3e, 0xf0, 0x68, 0x00, 0xbe,
-  0x03, 0xdd, 0x88, 0x3d, 0xaf, 0xcf, 0xce, 0xbc, 0xf6, 0xc8, 0x37, 0xbd,
-  0x17, 0x4d, 0x07, 0x3e, 0x5c, 0x64, 0xfc, 0x3e, 0xd4, 0x1a, 0x37, 0x3f,
-  0x26, 0x25, 0x05, 0x3f, 0xef, 0x34, 0x46, 0x3f, 0x69, 0x09, 0x9e, 0xbd,
-  0x70, 0x9c, 0x5d, 0xbe, 0xc7, 0x50, 0xaf, 0x3d, 0x06, 0x21, 0x0b, 0x3d,
-  0x7c, 0x2b, 0xbd, 0x3e, 0xd3, 0x5e, 0x3b, 0x3e, 0x8f, 0x1e, 0x66, 0xbd,
-  0x2f, 0x24, 0x44, 0xbe, 0x5b, 0xe6, 0x73, 0x3d, 0xca, 0xc6, 0x65, 0x3e,
-  0x91, 0xdd, 0x45, 0x3e, 0xb1, 0x5d, 0x32, 0x3e, 0xa9, 0xbb, 0x68, 0xbc,
-  0x7f, 0x5a, 0xb1, 0x3d, 0xe0, 0x06, 0x9a, 0x3d, 0x62, 0xea, 0xa6, 0x3d,
-  0x9e, 0xd0, 0xbd, 0x3d, 0xc4, 0x44, 0x38, 0x3e, 0x10, 0x3c, 0x75, 0x3e,
-  0x7e, 0x49, 0x14, 0x3f, 0x3c, 0x90, 0xea, 0x3e, 0x9f, 0xc3, 0x86, 0x3e,
-  0xe1, 0x2d, 0xf4, 0x3e, 0x30, 0x96, 0xb3, 0x3e, 0x63, 0x74, 0x6a, 0x3e,
-  0xbe, 0x1f, 0x28, 0x3e, 0x9b, 0x48, 0x5e, 0x3e, 0xf9, 0xe3, 0xed, 0x3e,
-  0x43, 0xe0, 0x18, 0x3f, 0x82, 0x75, 0x49, 0x3e, 0x87, 0xa7, 0xa7, 0xbc,
-  0x26, 0xc1, 0x36, 0xbe, 0xac, 0x89, 0xa1, 0x3e, 0xa0, 0xfa, 0x17, 0x3f,
-  0xd3, 0xbe, 0x14, 0x3f, 0xa3, 0x22, 0x0f, 0x3e, 0xac, 0x4a, 0x98, 0xbc,
-  0xca, 0xc3, 0x6e, 0x3e, 0xab, 0x00, 0x36, 0x3e, 0x46, 0x52, 0x31, 0x3f,
-  0x79, 0x32, 0x51, 0x3f, 0x30, 0xc3, 0x86, 0xbd, 0xbd, 0x94, 0x0f, 0xbf,
-  0xa9, 0xde, 0x6f, 0xbe, 0x9f, 0x56, 0x27, 0xbe, 0xd3, 0x3d, 0x4d, 0xbd,
-  0x05, 0xa0, 0x4f, 0x3d, 0xc8, 0x0d, 0xcc, 0xbc, 0xe6, 0x95, 0x8a, 0x3e,
-  0x24, 0xf2, 0xb0, 0x3d, 0x8a, 0x91, 0x91, 0xbe, 0x1a, 0xb0, 0x0d, 0x3b,
-  0xb0, 0xdf, 0xa7, 0xbe, 0x99, 0x99, 0x4e, 0x3e, 0x1e, 0x99, 0x81, 0xbe,
-  0xd7, 0x97, 0x9e, 0xbe, 0x89, 0xb8, 0x4c, 0x3e, 0x30, 0xd8, 0xd9, 0x3e,
-  0x38, 0xb8, 0x21, 0x3f, 0xa6, 0x2d, 0x2f, 0x3e, 0xb9, 0xcd, 0x3c, 0xbe,
-  0x66, 0x1d, 0x80, 0xbe, 0xbf, 0x66, 0x24, 0x3e, 0x9c, 0x4b, 0x70, 0x3e,
-  0xde, 0x6e, 0x13, 0xbd, 0x7e, 0x41, 0xcf, 0xbe, 0x1d, 0x13, 0x5f, 0xbe,
-  0xf1, 0x54, 0x49, 0x3e, 0xb9, 0x31, 0xbc, 0x3e, 0xb5, 0x96, 0x25, 0x3f,
-  0x90, 0x75, 0x28, 0x3d, 0x6b, 0x75, 0xa4, 0xbd, 0xfe, 0x1a, 0x07, 0xbf,
-  0x21, 0xc5, 0x14, 0xbe, 0x5f, 0xaf, 0x3a, 0x3e, 0xcc, 0x51, 0xbd, 0xbd,
-  0x8f, 0xd3, 0x18, 0xbe, 0x68, 0x7e, 0xdd, 0xbe, 0x80, 0x0e, 0xba, 0xbd,
-  0x5e, 0xad, 0xcb, 0x3e, 0x82, 0x4e, 0xb0, 0x3d, 0xea, 0x08, 0x81, 0xbe,
-  0xc7, 0xbc, 0xa6, 0xbd, 0x72, 0x5d, 0x6e, 0x3e, 0x81, 0xba, 0x2c, 0x3e,
-  0xd1, 0x43, 0xcd, 0x3e, 0xb1, 0xd3, 0xf5, 0x3e, 0xb2, 0x07, 0x2e, 0x3e,
-  0x02, 0xa5, 0xd5, 0xbd, 0xc0, 0x51, 0x02, 0xbf, 0x3a, 0xcc, 0x84, 0xbe,
-  0x37, 0x3d, 0x60, 0xbe, 0x17, 0xae, 0xee, 0xbe, 0x8c, 0xc3, 0x3d, 0xbf,
-  0x28, 0xba, 0xee, 0xbe, 0x1d, 0x14, 0x61, 0xba, 0x5b, 0x43, 0x98, 0x3d,
-  0x49, 0x83, 0xea, 0xbe, 0x5b, 0xbf, 0x14, 0xbf, 0x28, 0x93, 0x78, 0xbe,
-  0x33, 0xdf, 0x5d, 0x3e, 0xc9, 0x9a, 0x80, 0x3e, 0x15, 0x3d, 0x8e, 0x3d,
-  0x38, 0x0c, 0x42, 0x3c, 0xb1, 0x57, 0x1d, 0x3b, 0xca, 0xec, 0xff, 0xbe,
-  0xbb, 0xe1, 0xb3, 0xbe, 0x0d, 0xe2, 0x4e, 0xbf, 0x63, 0xa0, 0x05, 0xbf,
-  0xbc, 0xe7, 0x46, 0xbf, 0xc8, 0xe2, 0x27, 0xbf, 0x36, 0x1a, 0x71, 0xbf,
-  0x15, 0xc0, 0x31, 0xbf, 0x99, 0xfa, 0x5b, 0xbe, 0x99, 0x5c, 0x9c, 0xbb,
-  0xbf, 0x0b, 0x8c, 0x3e, 0x35, 0x68, 0x10, 0x3e, 0xa8, 0xe6, 0x80, 0x3b,
-  0xa3, 0x8e, 0x4b, 0x3e, 0x76, 0x7c, 0x0a, 0xbe, 0xd2, 0x56, 0x6a, 0x3b,
-  0x95, 0x28, 0xf4, 0xbc, 0x1a, 0x4d, 0x88, 0x3e, 0xe5, 0xa7, 0xd1, 0x3c,
-  0xbb, 0x77, 0x3a, 0xbe, 0x15, 0x3b, 0xa3, 0xbc, 0x36, 0x2e, 0x89, 0xbe,
-  0x7a, 0x9b, 0x9f, 0xbe, 0xc0, 0x53, 0x98, 0x3e, 0x97, 0x75, 0x33, 0x3d,
-  0x86, 0x6c, 0xe1, 0x3e, 0xe7, 0x02, 0x00, 0x3f, 0x78, 0x5c, 0x30, 0x3f,
-  0x57, 0x96, 0x08, 0x3f, 0x30, 0x7a, 0x67, 0x3f, 0x92, 0x9a, 0x7a, 0x3f,
-  0x06, 0x7e, 0x57, 0x3f, 0x6e, 0x3c, 0x6d, 0x3d, 0x19, 0xee, 0x38, 0x3e,
-  0x3c, 0x59, 0x1c, 0x3f, 0xa5, 0xc5, 0x18, 0x3f, 0x8a, 0x88, 0x0b, 0x3f,
-  0x32, 0x80, 0x82, 0x3f, 0xa3, 0x2b, 0xc3, 0x3e, 0x58, 0x94, 0x83, 0x3e,
-  0x4b, 0x69, 0x94, 0x3d, 0x0b, 0x8d, 0x13, 0x3f, 0x3f, 0x0e, 0x3f, 0x3f,
-  0xd2, 0xcb, 0x3c, 0x3f, 0xfe, 0x8c, 0xe5, 0x3e, 0xd9, 0xc8, 0x72, 0x3e,
-  0xf8, 0x25, 0x0d, 0x3d, 0x27, 0x59, 0x53, 0x3c, 0x76, 0x9f, 0xa6, 0xbc,
-  0xbf, 0xbb, 0x37, 0xbe, 0x10, 0xee, 0x1c, 0x3e, 0xb5, 0xf0, 0x96, 0xbd,
-  0x1f, 0x2c, 0x52, 0x3d, 0xf6, 0x67, 0x8f, 0xbc, 0x17, 0xa6, 0x25, 0xbe,
-  0xa0, 0xc1, 0x97, 0x3e, 0x8b, 0x95, 0xaa, 0xbd, 0xf1, 0x13, 0x4d, 0x3e,
-  0x12, 0x22, 0x1d, 0xbd, 0xb4, 0x59, 0xa6, 0x3d, 0xb2, 0x00, 0x39, 0xbe,
-  0x75, 0xdc, 0xf9, 0x3d, 0xea, 0xb3, 0x72, 0x3e, 0x4a, 0xe3, 0x8c, 0x3e,
-  0xc3, 0x0b, 0x12, 0x3e, 0x97, 0x60, 0x3d, 0x3e, 0xdc, 0x93, 0x56, 0x3e,
-  0x45, 0xcd, 0x93, 0xbe, 0x8b, 0x29, 0x41, 0xbe, 0x13, 0x4d, 0xe3, 0xbe,
-  0xe0, 0xb5, 0xd2, 0xbe, 0xa0, 0xcb, 0x3f, 0xbc, 0xfb, 0x8c, 0xa9, 0xbe,
-  0x7a, 0x22, 0xac, 0xbe, 0x65, 0x81, 0x13, 0xbf, 0x72, 0xb1, 0x3d, 0xbf,
-  0xc2, 0x02, 0x50, 0xbf, 0x59, 0xc7, 0x9b, 0xbb, 0x7e, 0x60, 0x5b, 0xbe,
-  0xce, 0xba, 0xbb, 0x3e, 0x2e, 0x8d, 0x18, 0xbe, 0x95, 0xc4, 0x17, 0x3f,
-  0x9f, 0xd3, 0x78, 0x3d, 0xae, 0xfb, 0xb7, 0xbe, 0xbd, 0x5f, 0xea, 0xbd,
-  0x99, 0xe5, 0x96, 0xbe, 0xf3, 0x9c, 0xc1, 0xbd, 0x90, 0x48, 0x66, 0x3d,
-  0xce, 0x24, 0x8f, 0xbe, 0x9a, 0xbb, 0x5c, 0xbe, 0xfa, 0x52, 0x16, 0xbf,
-  0x42, 0x37, 0xeb, 0xbe, 0xd3, 0x39, 0xe5, 0x3e, 0x20, 0x1b, 0x77, 0x3f,
-  0xcf, 0xe2, 0x34, 0x3f, 0x57, 0x50, 0x13, 0x3f, 0x12, 0xa3, 0xcd, 0x3e,
-  0x27, 0xa9, 0xab, 0x3e, 0xd4, 0x84, 0x74, 0x3e, 0xea, 0xf9, 0x34, 0xbe,
-  0x49, 0x52, 0x3c, 0xbe, 0x36, 0x7f, 0x9d, 0xbd, 0xdd, 0xd8, 0xe8, 0x3a,
-  0x86, 0x3f, 0x55, 0xbe, 0x65, 0x47, 0x01, 0xbf, 0x8f, 0x96, 0x45, 0xbd,
-  0x7c, 0x68, 0xd3, 0x3e, 0x0e, 0xad, 0x57, 0x3f, 0xe9, 0xa5, 0x70, 0x3e,
-  0xe8, 0x01, 0x2e, 0x3f, 0x63, 0x46, 0x9c, 0xbd, 0x61, 0xa1, 0xc4, 0xbe,
-  0x76, 0x98, 0x7b, 0xbe, 0xd7, 0xc1, 0x84, 0xbe, 0x0c, 0x81, 0xf1, 0xbe,
-  0x1e, 0x55, 0x19, 0xbf, 0x2c, 0xe1, 0xa8, 0xbe, 0xf7, 0x94, 0xf0, 0xbd,
-  0x19, 0xa6, 0xe3, 0xbe, 0x95, 0x93, 0xf2, 0xbe, 0x5e, 0xe2, 0x0b, 0xbf,
-  0x6a, 0xbd, 0x13, 0xbf, 0xa5, 0xce, 0x48, 0x3e, 0x01, 0xaf, 0x9f, 0x3e,
-  0xf2, 0x1c, 0xea, 0x3e, 0x03, 0x77, 0x67, 0x3e, 0x03, 0x16, 0x90, 0xbc,
-  0xd8, 0xef, 0xae, 0xbe, 0xd2, 0x61, 0x82, 0x3b, 0x4d, 0x93, 0x91, 0xbe,
-  0x67, 0x25, 0x98, 0xbc, 0xb6, 0x0f, 0x21, 0xbd, 0x48, 0x1c, 0xf1, 0xbe,
-  0x6f, 0x63, 0x6f, 0xbd, 0x50, 0x70, 0x24, 0x3f, 0xc8, 0x65, 0x44, 0x3e,
-  0xdd, 0x0a, 0x62, 0xbd, 0x7d, 0x9c, 0x95, 0xbe, 0x18, 0xdb, 0x39, 0x3c,
-  0xaa, 0x85, 0x67, 0x3b, 0x4a, 0xbd, 0x2f, 0x3f, 0x42, 0x40, 0x1b, 0x3d,
-  0xc8, 0x2e, 0xb9, 0xbe, 0xfd, 0x15, 0xbc, 0xbe, 0xfd, 0xbf, 0x02, 0xbe,
-  0xf3, 0xc4, 0x4b, 0xbe, 0xef, 0x54, 0xe5, 0x3d, 0x09, 0x92, 0xa8, 0x3e,
-  0xf6, 0x31, 0x60, 0x3f, 0x1f, 0x40, 0x44, 0x3f, 0x60, 0xe3, 0x11, 0x3f,
-  0xde, 0xf2, 0xae, 0x3e, 0xc7, 0xf4, 0xd5, 0x3d, 0xf2, 0x06, 0x51, 0x3e,
-  0x73, 0xac, 0x18, 0xbe, 0x3c, 0xd6, 0x8c, 0x3e, 0x69, 0xec, 0x78, 0x3d,
-  0x40, 0x24, 0x86, 0x3e, 0xd0, 0x86, 0xd9, 0x3d, 0xf5, 0x9a, 0x29, 0x3e,
-  0xd9, 0xe7, 0xf5, 0x3c, 0xad, 0x7a, 0xa6, 0x3e, 0x55, 0x5c, 0x7d, 0x3e,
-  0xfa, 0xe9, 0xed, 0x3c, 0xd2, 0xc9, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0xc0, 0x08, 0x00, 0x00, 0x29, 0xea, 0x2c, 0xbe, 0x6f, 0x8a, 0x97, 0x3e,
-  0x78, 0x82, 0xc7, 0xbd, 0x94, 0x87, 0x40, 0xbf, 0xdd, 0xd3, 0x23, 0xbf,
-  0x33, 0x97, 0x93, 0xbe, 0xbf, 0x4a, 0x72, 0x3e, 0xb4, 0xaa, 0xe7, 0x3c,
-  0x2e, 0xfd, 0xa5, 0x3e, 0xa2, 0x54, 0x51, 0x3e, 0xc3, 0xb5, 0xf8, 0x3e,
-  0x43, 0x87, 0xc4, 0x3e, 0xce, 0xdf, 0x03, 0x3f, 0xf1, 0x15, 0xbf, 0x3e,
-  0x88, 0xc8, 0x0e, 0x3e, 0xdc, 0x69, 0xfb, 0xbd, 0x1c, 0x63, 0x0a, 0xbe,
-  0xa2, 0x8e, 0x46, 0xbe, 0x31, 0xbc, 0x2c, 0xbe, 0xbd, 0x6e, 0xd9, 0xbd,
-  0xb2, 0x2a, 0x5c, 0xbe, 0xa4, 0x25, 0x91, 0x3e, 0x12, 0x15, 0x81, 0x3d,
-  0x9b, 0x9e, 0xe9, 0x3e, 0x54, 0x96, 0x1a, 0xbd, 0x18, 0x8c, 0xa6, 0xbe,
-  0x49, 0x1d, 0xed, 0xbd, 0x60, 0xe6, 0x04, 0x3f, 0x73, 0x8e, 0x4c, 0x3e,
-  0x04, 0x3e, 0x82, 0x3e, 0x96, 0x6c, 0x07, 0xbf, 0x56, 0x44, 0xe0, 0xbe,
-  0x13, 0xa9, 0x1e, 0xbe, 0x7a, 0x9d, 0xf1, 0xbd, 0xab, 0xa9, 0xd9, 0xbc,
-  0xf7, 0x9a, 0xd4, 0x3d, 0x15, 0x78, 0x5a, 0xbd, 0xdd, 0xe5, 0x9b, 0xbd,
-  0xbe, 0xbd, 0xd6, 0x3d, 0xe5, 0xa1, 0x09, 0xbd, 0xa8, 0xb0, 0xb8, 0x3e,
-  0x97, 0x51, 0x11, 0x3e, 0xcf, 0x67, 0xc6, 0x3d, 0x23, 0x19, 0x20, 0xbe,
-  0x6d, 0x89, 0x8c, 0xbe, 0x85, 0x5e, 0xbe, 0x3d, 0x8d, 0x13, 0x35, 0x3e,
-  0x16, 0x0e, 0x6b, 0xbe, 0x65, 0x60, 0x66, 0xbd, 0x84, 0xa2, 0xa2, 0x3e,
-  0x64, 0x87, 0x4b, 0x3e, 0x0f, 0x1b, 0x80, 0x3e, 0xa5, 0xcb, 0xd8, 0x3e,
-  0x0b, 0xb1, 0xcd, 0x3e, 0x8d, 0x32, 0xd9, 0xbd, 0x97, 0x7c, 0x1a, 0x3f,
-  0xda, 0x8f, 0x3a, 0x3d, 0x52, 0xd6, 0x8a, 0xbe, 0xf4, 0x68, 0x29, 0x3e,
-  0x3d, 0x54, 0x7d, 0x3e, 0xa3, 0x98, 0x84, 0x3d, 0x3a, 0x7c, 0xd5, 0xbc,
-  0xb2, 0x2c, 0x3e, 0x3c, 0x58, 0x92, 0x21, 0xbe, 0xa1, 0xb7, 0xb1, 0xbd,
-  0xe9, 0xfb, 0x82, 0xbe, 0x92, 0x69, 0x0c, 0xbe, 0x5a, 0x18, 0x89, 0xbd,
-  0xfa, 0x01, 0x3c, 0xbe, 0x79, 0xe8, 0x90, 0x3e, 0xb8, 0x9d, 0x86, 0x3e,
-  0xd9, 0xc1, 0xaa, 0x3e, 0x66, 0x29, 0x01, 0xbd, 0xab, 0xed, 0x6c, 0x3e,
-  0x3c, 0x08, 0xcf, 0xbc, 0x19, 0xdb, 0x51, 0xbe, 0x9b, 0x1c, 0x58, 0xbe,
-  0xb2, 0x01, 0x3e, 0x3d, 0xeb, 0xdf, 0x29, 0xbe, 0x42, 0x72, 0x17, 0xbd,
-  0xe4, 0x61, 0xa2, 0xb9, 0xf8, 0x20, 0xb3, 0x3e, 0x6d, 0xfd, 0x95, 0xbe,
-  0x79, 0x43, 0x04, 0x3e, 0xcc, 0xad, 0x5d, 0x3e, 0x45, 0x7f, 0xc9, 0x3c,
-  0x9e, 0x3a, 0xf8, 0xbd, 0xfc, 0x2e, 0x1d, 0x3f, 0xd3, 0x10, 0x4c, 0x3f,
-  0xd1, 0x89, 0x9c, 0x3d, 0x49, 0xfe, 0x45, 0x3c, 0x39, 0x3e, 0x43, 0x3e,
-  0x1f, 0x43, 0xb7, 0x3e, 0x2f, 0x50, 0x8a, 0x3e, 0x20, 0x57, 0x81, 0xbe,
-  0x32, 0x05, 0x97, 0xbe, 0x76, 0xfc, 0xd1, 0xbe, 0x1c, 0x0b, 0xdd, 0x3c,
-  0x91, 0x7b, 0x4d, 0x3d, 0x90, 0x0a, 0xc6, 0x3d, 0x06, 0x6f, 0x43, 0xbd,
-  0x89, 0x42, 0xad, 0xbe, 0x6f, 0x14, 0xed, 0xbd, 0xd4, 0xa9, 0x7f, 0xbd,
-  0xe1, 0xa3, 0x70, 0xbc, 0xf3, 0xd1, 0x68, 0xbc, 0xd1, 0xca, 0x27, 0xbd,
-  0xd4, 0xbc, 0xaf, 0xbe, 0xda, 0xe5, 0x2f, 0xbf, 0xcc, 0x0b, 0x4c, 0xbe,
-  0x4d, 0xe3, 0x45, 0x3f, 0xd9, 0x3e, 0x03, 0x3e, 0x60, 0xe4, 0x92, 0x3d,
-  0xd8, 0xed, 0x8a, 0xbe, 0xe1, 0x21, 0x03, 0x3e, 0x42, 0x7a, 0xde, 0x3d,
-  0x08, 0x32, 0xdc, 0x3c, 0x2e, 0x6b, 0xb7, 0x3e, 0x24, 0x69, 0x05, 0xbe,
-  0xf8, 0xfc, 0xe7, 0x3e, 0x92, 0x58, 0x0b, 0x3e, 0x94, 0x46, 0x8a, 0xbe,
-  0xd1, 0x95, 0xf9, 0x3c, 0x84, 0x31, 0x36, 0x3d, 0x13, 0x18, 0x56, 0x3d,
-  0x94, 0x28, 0xb0, 0x3e, 0xcc, 0x21, 0x73, 0x3e, 0x00, 0xd6, 0x23, 0xbd,
-  0x24, 0x5a, 0x6b, 0x3e, 0xc2, 0x4b, 0x9f, 0xbd, 0x2c, 0x95, 0x84, 0xbd,
-  0xdd, 0xdf, 0x1b, 0xbc, 0x82, 0x26, 0x86, 0x3d, 0x5d, 0x8a, 0x09, 0x3d,
-  0xac, 0x57, 0xeb, 0x3e, 0xc1, 0x05, 0xf1, 0x3b, 0x3f, 0x6b, 0x04, 0xbf,
-  0x0b, 0x2c, 0x21, 0x3e, 0x0c, 0xb4, 0x5f, 0x3e, 0x4c, 0xd4, 0x93, 0xbe,
-  0x47, 0xcb, 0x2a, 0x3e, 0xe0, 0x4e, 0x9d, 0xbe, 0x65, 0x69, 0x43, 0xbe,
-  0xc3, 0xdc, 0x1f, 0x3e, 0x58, 0x01, 0xe2, 0x3d, 0x38, 0x0f, 0x6e, 0x3e,
-  0xef, 0xd9, 0xa1, 0x3e, 0xf4, 0xf0, 0x77, 0x3e, 0xb7, 0x2e, 0x8e, 0x3e,
-  0x0b, 0xe3, 0x00, 0x3e, 0xfa, 0xa0, 0x4b, 0xbe, 0xec, 0xcb, 0x04, 0x3d,
-  0x44, 0x2b, 0xd0, 0xbe, 0x1f, 0x31, 0x83, 0xbc, 0x3f, 0x69, 0x00, 0xbe,
-  0x2f, 0x11, 0xb7, 0x3d, 0x3b, 0x91, 0x3c, 0x3d, 0x1b, 0x39, 0x55, 0xbe,
-  0x5e, 0x07, 0x86, 0xbd, 0x30, 0xae, 0x42, 0xbb, 0x5c, 0xfc, 0x11, 0x3e,
-  0x1f, 0x6d, 0xc6, 0xbe, 0xa3, 0xb8, 0xc3, 0xba, 0x8b, 0x83, 0x01, 0xbe,
-  0xd6, 0x2a, 0x3c, 0x3e, 0x44, 0x25, 0x70, 0xbd, 0xc9, 0xeb, 0x97, 0x3e,
-  0x4e, 0x25, 0x75, 0x3e, 0x4c, 0x95, 0x1a, 0xbe, 0x6a, 0x8b, 0x92, 0x3e,
-  0x81, 0xba, 0x69, 0x3d, 0xd7, 0xd8, 0x87, 0x3e, 0xc5, 0x30, 0x52, 0x3f,
-  0x8b, 0xb2, 0x48, 0x3c, 0x61, 0x00, 0x19, 0x3e, 0x4b, 0x95, 0x28, 0xbe,
-  0x57, 0x65, 0x9d, 0x3d, 0x6d, 0x61, 0x90, 0xbd, 0xf7, 0x7f, 0x40, 0xbe,
-  0xa4, 0xe3, 0x52, 0xbe, 0x52, 0x92, 0x37, 0xbe, 0x5d, 0x10, 0xdc, 0x3d,
-  0xe7, 0xfe, 0xd2, 0x3e, 0x8d, 0x3c, 0x80, 0xbd, 0xe7, 0x13, 0xdd, 0xbe,
-  0x07, 0xf0, 0xbc, 0xbe, 0xcb, 0xdc, 0x64, 0xbd, 0x26, 0x93, 0xb4, 0x3e,
-  0xab, 0xa8, 0x64, 0x3c, 0xd2, 0xc3, 0x9d, 0x3d, 0x28, 0xff, 0xb1, 0x3e,
-  0xd8, 0x32, 0xb2, 0x3d, 0xea, 0xeb, 0xdb, 0x3b, 0xc9, 0x7b, 0x89, 0x3e,
-  0x75, 0xb9, 0x6d, 0x3e, 0x0c, 0x10, 0xa9, 0x3e, 0x41, 0x78, 0xd0, 0x3d,
-  0xe7, 0x42, 0xd3, 0x3d, 0xba, 0xfb, 0x8c, 0xbe, 0xc9, 0x93, 0x01, 0xbf,
-  0xee, 0x1e, 0x63, 0x3e, 0x81, 0x44, 0x9f, 0x3d, 0x4d, 0x13, 0x9c, 0xbe,
-  0x45, 0x3a, 0x66, 0x3d, 0x80, 0xb7, 0xb4, 0xbd, 0x25, 0x01, 0x1a, 0xbe,
-  0x40, 0x3b, 0x4b, 0xbd, 0xee, 0x24, 0x94, 0x3d, 0xf7, 0xfd, 0x56, 0xbd,
-  0xc5, 0x70, 0xbf, 0x3e, 0xeb, 0x87, 0xfe, 0x3d, 0xb1, 0xa3, 0x61, 0x3e,
-  0x1b, 0x5a, 0x94, 0xbd, 0x1d, 0x1f, 0xd0, 0xbe, 0x0a, 0xb6, 0x17, 0xbf,
-  0x9a, 0x3a, 0x37, 0xbf, 0xe7, 0x0a, 0xec, 0xbe, 0x27, 0x2e, 0xb3, 0x3d,
-  0xa2, 0xf0, 0xa4, 0x3e, 0x5b, 0xe2, 0x10, 0x3f, 0xf2, 0x76, 0x28, 0x3f,
-  0x52, 0x11, 0x1f, 0x3e, 0x7a, 0x63, 0x2b, 0xbd, 0x55, 0x17, 0xbe, 0x3e,
-  0xa4, 0x75, 0x4d, 0xbd, 0xb2, 0x04, 0x40, 0x3e, 0x21, 0x41, 0x05, 0x3e,
-  0x16, 0x6d, 0x2a, 0x3d, 0x62, 0x5c, 0x83, 0xbe, 0x9e, 0x6f, 0x81, 0xbe,
-  0x8d, 0x98, 0x8d, 0x3c, 0x39, 0x70, 0xaf, 0x3d, 0xc9, 0xf3, 0xa2, 0x3d,
-  0xc5, 0xca, 0xc4, 0xbd, 0x78, 0xe5, 0x8b, 0xbd, 0x80, 0xf0, 0x70, 0x3c,
-  0xb0, 0xfa, 0x42, 0xbe, 0x93, 0x76, 0x80, 0xbe, 0x22, 0x70, 0x37, 0xbd,
-  0x8e, 0x36, 0x2a, 0xbe, 0xd0, 0xd1, 0x70, 0x3e, 0x77, 0xba, 0x90, 0xbd,
-  0x62, 0x08, 0x36, 0x3e, 0x42, 0xda, 0x56, 0xbc, 0xa1, 0x29, 0x1d, 0xbe,
-  0x2d, 0x2e, 0x1a, 0xbe, 0xe7, 0xea, 0x43, 0xbf, 0x27, 0x15, 0xdd, 0xbe,
-  0x41, 0x57, 0x03, 0xbf, 0x9e, 0x98, 0x9e, 0x3c, 0x82, 0x5a, 0x9a, 0xbe,
-  0xb9, 0xff, 0x94, 0x3d, 0xb9, 0x8a, 0xd2, 0x3e, 0x14, 0x5e, 0xda, 0xbe,
-  0x91, 0x2e, 0x33, 0xbe, 0x3d, 0xb5, 0x3d, 0x3f, 0xc6, 0x0d, 0x84, 0xbe,
-  0x0e, 0x68, 0x0c, 0xbf, 0xda, 0x55, 0xd4, 0xbd, 0x35, 0x1a, 0x52, 0x3d,
-  0xd1, 0xea, 0x08, 0x3e, 0xe3, 0x70, 0x8a, 0x3e, 0x26, 0x41, 0xa0, 0x3e,
-  0x07, 0x62, 0x8d, 0x3e, 0x08, 0x7d, 0x03, 0x3e, 0xcb, 0xc1, 0xe4, 0xbe,
-  0xca, 0xe6, 0x96, 0xbd, 0x20, 0x0d, 0x24, 0xbe, 0x73, 0xa4, 0xac, 0xbd,
-  0x66, 0xbe, 0x9e, 0xbd, 0xaf, 0xf2, 0x88, 0x3e, 0xf5, 0xf5, 0x06, 0x3f,
-  0x6e, 0xa6, 0x71, 0x3e, 0xbf, 0xe3, 0x40, 0x3d, 0x2e, 0x9c, 0x90, 0xbd,
-  0x14, 0xdc, 0x16, 0xbf, 0x20, 0x12, 0x49, 0xbf, 0x3b, 0x9f, 0x70, 0xbf,
-  0x42, 0xa3, 0x18, 0xbf, 0x33, 0x20, 0xdb, 0x3d, 0xe5, 0x5d, 0x6a, 0x3d,
-  0x8b, 0xd0, 0x93, 0x3e, 0x06, 0x71, 0x9a, 0xbe, 0x72, 0x2c, 0x4f, 0xbe,
-  0xe6, 0xc9, 0x27, 0x3e, 0x41, 0x32, 0x9e, 0x3e, 0x99, 0x2f, 0xd6, 0x3d,
-  0x88, 0xcf, 0xab, 0x3e, 0x93, 0x24, 0xfe, 0x3c, 0x9f, 0x4f, 0x1a, 0x3e,
-  0xa0, 0xa2, 0xb9, 0x3e, 0x7f, 0xb3, 0x83, 0x3e, 0xda, 0xbf, 0x8e, 0x3e,
-  0x6d, 0x22, 0x71, 0xbe, 0x41, 0x18, 0x83, 0xbe, 0x7b, 0x09, 0xc8, 0xbe,
-  0x11, 0xdd, 0xea, 0xbe, 0xb7, 0x8c, 0x27, 0xbe, 0x0b, 0xd7, 0x38, 0xbd,
-  0xcf, 0x44, 0xaa, 0x3d, 0x71, 0x1a, 0xc6, 0x3d, 0xf1, 0x58, 0xee, 0x3e,
-  0xcf, 0xdd, 0x1a, 0x3e, 0x25, 0xf1, 0xc9, 0x3e, 0x3e, 0x3c, 0x8f, 0x3e,
-  0x4c, 0x58, 0x5c, 0xbe, 0x97, 0x68, 0x1d, 0x3e, 0xf0, 0x93, 0x91, 0x3e,
-  0x81, 0xea, 0x8f, 0x3e, 0x29, 0xba, 0x8b, 0x3e, 0xd3, 0x4b, 0x86, 0xbc,
-  0x30, 0xee, 0xd7, 0x3d, 0x4f, 0x1f, 0x75, 0xbe, 0x86, 0x9e, 0xdd, 0xbb,
-  0xd2, 0xef, 0xc9, 0xbd, 0x98, 0x7b, 0xa8, 0xbe, 0x9d, 0x4e, 0xc1, 0xbe,
-  0xf6, 0xc1, 0x18, 0xbf, 0x36, 0x83, 0x0c, 0xbf, 0x16, 0x12, 0x0e, 0xbf,
-  0x39, 0x0c, 0xb4, 0xbe, 0x8b, 0x6b, 0xb7, 0x3e, 0xf6, 0xc2, 0x97, 0x3e,
-  0x6f, 0x67, 0x0b, 0x3f, 0xd3, 0xd3, 0xc9, 0x3e, 0xf8, 0x31, 0x97, 0xbc,
-  0x4a, 0x09, 0xac, 0xbe, 0x16, 0xa7, 0xa4, 0x3d, 0xb2, 0xde, 0x6d, 0x3d,
-  0x71, 0xf6, 0x92, 0x3e, 0x1c, 0xc2, 0xb3, 0x3e, 0xeb, 0x5a, 0x37, 0x3d,
-  0x68, 0xa1, 0xe5, 0x3d, 0x5e, 0xc5, 0xce, 0x3c, 0xae, 0x69, 0x03, 0x3d,
-  0x80, 0x30, 0xb1, 0x3d, 0x01, 0x89, 0x95, 0x3d, 0x89, 0x2c, 0x3b, 0xbe,
-  0xaf, 0x74, 0x4f, 0xbf, 0x47, 0xe3, 0x74, 0x3e, 0xac, 0x64, 0xac, 0x3e,
-  0xba, 0x27, 0xa8, 0x3e, 0xf0, 0xb1, 0x82, 0x3e, 0x7f, 0xa0, 0xee, 0x3e,
-  0xfa, 0x8c, 0x7f, 0xbd, 0x7b, 0xc0, 0xb1, 0xbd, 0x0c, 0x8f, 0x2d, 0x3d,
-  0x40, 0x92, 0xc8, 0x3d, 0x1f, 0x1f, 0x2f, 0xbe, 0x57, 0x20, 0xa1, 0x3c,
-  0xb1, 0xef, 0x16, 0xbe, 0x06, 0x57, 0xa6, 0xbe, 0x06, 0x7e, 0xa8, 0xbe,
-  0x7d, 0x45, 0x1b, 0x3e, 0xf6, 0xfa, 0x15, 0x3e, 0x0b, 0x90, 0x8d, 0xbe,
-  0x9e, 0x02, 0x92, 0xbe, 0xe7, 0x09, 0x7a, 0xbe, 0x59, 0x75, 0x0b, 0xbe,
-  0x6a, 0x56, 0xbe, 0x3d, 0x3a, 0x6e, 0x6f, 0x3f, 0x64, 0xfe, 0x11, 0x3f,
-  0xe9, 0x9f, 0xad, 0x3d, 0x6b, 0x0e, 0xa4, 0xbe, 0x78, 0x49, 0xa8, 0xbd,
-  0xb2, 0x87, 0x88, 0xbb, 0x22, 0x6e, 0x93, 0xbe, 0xd2, 0x20, 0xcc, 0x3c,
-  0x75, 0xc4, 0xa7, 0xbe, 0x4d, 0x3e, 0x4a, 0x3d, 0x2f, 0x99, 0x4c, 0xbe,
-  0x62, 0x9a, 0x35, 0x3e, 0xbd, 0x56, 0x5f, 0x3e, 0xc9, 0x60, 0x16, 0x3e,
-  0x6f, 0x4b, 0x31, 0x3e, 0x3a, 0xa1, 0x96, 0x3e, 0x7e, 0x48, 0xc6, 0x3d,
-  0x55, 0xe0, 0xd2, 0x3e, 0xe7, 0xbd, 0x03, 0xbe, 0xe5, 0x14, 0x3a, 0xbf,
-  0xd5, 0xea, 0xf6, 0xbe, 0x84, 0x86, 0x76, 0xbe, 0x1b, 0xd8, 0xb3, 0xbe,
-  0x5a, 0x97, 0xf8, 0x3d, 0x27, 0x7c, 0xdd, 0x3e, 0xab, 0xfc, 0x09, 0x3f,
-  0x4a, 0x48, 0xc2, 0x3e, 0xbc, 0xdf, 0xf5, 0x3e, 0x6c, 0x61, 0xea, 0x3d,
-  0x1a, 0xc1, 0x46, 0x3e, 0x30, 0xb2, 0xd3, 0x3e, 0xc4, 0x69, 0x26, 0xbe,
-  0x98, 0x76, 0x89, 0xbe, 0x0c, 0x84, 0xa5, 0x3e, 0xa7, 0x57, 0x35, 0x3e,
-  0x22, 0xe4, 0x13, 0x3e, 0x76, 0x3a, 0x48, 0x3e, 0xf2, 0xff, 0x1a, 0x3f,
-  0xed, 0xaf, 0x3c, 0x3e, 0x21, 0xd2, 0x41, 0x3e, 0x36, 0x5d, 0x4f, 0x3e,
-  0x26, 0x63, 0x6b, 0xbe, 0xa7, 0x60, 0x07, 0xbf, 0xde, 0x31, 0x84, 0xbe,
-  0x9a, 0xd9, 0xc2, 0x3d, 0x9e, 0x1e, 0xaa, 0xbb, 0xb8, 0xee, 0xe6, 0xb8,
-  0x98, 0xf8, 0x6a, 0x3e, 0x54, 0x87, 0x7b, 0x3e, 0x66, 0xd2, 0x25, 0xbd,
-  0xb3, 0xfd, 0x74, 0x3e, 0xad, 0x06, 0x8e, 0xbd, 0xf6, 0xa1, 0x82, 0xbe,
-  0xaf, 0x5f, 0x04, 0x3e, 0x57, 0x00, 0xcf, 0x3d, 0x1d, 0xfc, 0x52, 0x3e,
-  0x09, 0xf1, 0x8f, 0x3e, 0x39, 0x80, 0x0a, 0x3f, 0xb6, 0xa8, 0x85, 0x3d,
-  0x52, 0x94, 0xe1, 0xbd, 0x5f, 0x45, 0xde, 0xbe, 0x7a, 0xda, 0xb4, 0xbe,
-  0x57, 0x0f, 0x07, 0xbf, 0x7d, 0x34, 0x04, 0x3f, 0xb6, 0xc9, 0xbc, 0x3e,
-  0xad, 0x4e, 0xe3, 0xbd, 0xbc, 0xde, 0xbe, 0x3d, 0x97, 0xee, 0x72, 0x3d,
-  0xa9, 0xa4, 0x4f, 0x3e, 0x55, 0x2b, 0xac, 0x3e, 0xa0, 0x86, 0x42, 0xbd,
-  0x50, 0xa7, 0xe6, 0xbd, 0xa6, 0x1c, 0xd5, 0xbe, 0x76, 0x97, 0x8a, 0x3c,
-  0x3c, 0xfc, 0x4b, 0xbe, 0xbd, 0x16, 0x4a, 0xbe, 0xad, 0x9e, 0xf0, 0xbe,
-  0xae, 0xf3, 0xf6, 0xbd, 0x02, 0x73, 0xe0, 0xbd, 0xc3, 0x42, 0x79, 0xbd,
-  0x30, 0x7a, 0xeb, 0xbd, 0x46, 0x35, 0x51, 0xbe, 0x70, 0x6d, 0x10, 0xbd,
-  0x21, 0x75, 0x23, 0xbe, 0xf7, 0x6f, 0x2e, 0x3d, 0xed, 0xc9, 0x85, 0x3e,
-  0x14, 0xfa, 0xf3, 0xbd, 0x1d, 0xb7, 0x89, 0x3d, 0x3d, 0x78, 0x85, 0x3b,
-  0x18, 0xaa, 0x91, 0x3d, 0xe9, 0xbc, 0xc0, 0x3d, 0x0e, 0x10, 0x09, 0x3e,
-  0x66, 0x5f, 0x27, 0xbe, 0x49, 0x27, 0x40, 0x3d, 0x98, 0x01, 0xb2, 0x3e,
-  0x19, 0x56, 0x27, 0x3e, 0x6c, 0xef, 0x7c, 0x3e, 0xec, 0x3c, 0xf1, 0x3d,
-  0x9b, 0x5b, 0x09, 0xbe, 0x2a, 0xc2, 0x3d, 0xbe, 0xb3, 0x19, 0x62, 0xbe,
-  0xfd, 0xe7, 0xb9, 0xbe, 0x67, 0x1d, 0xf2, 0xbc, 0x47, 0x5f, 0x05, 0xbe,
-  0x2c, 0xf3, 0x80, 0x3e, 0xf9, 0xa4, 0x16, 0x3e, 0xa7, 0x7b, 0x2e, 0x3e,
-  0x5e, 0x68, 0xaf, 0xbc, 0x28, 0x40, 0xb7, 0x3d, 0x7d, 0xa4, 0x47, 0xbe,
-  0xd9, 0xf5, 0x7d, 0x3b, 0x11, 0xc1, 0xcd, 0x3e, 0xd9, 0x4c, 0x5a, 0x3e,
-  0x98, 0x0d, 0x84, 0x3e, 0x82, 0x18, 0x0e, 0xbf, 0x4f, 0xd8, 0xa6, 0xbe,
-  0xbc, 0x01, 0xb9, 0x3d, 0x5e, 0x1f, 0x16, 0xbe, 0x5e, 0xa6, 0x3e, 0xbf,
-  0x3a, 0x5f, 0x97, 0xbe, 0x28, 0xbc, 0x9d, 0xbd, 0x99, 0x74, 0x0a, 0x3d,
-  0x0f, 0x2d, 0x3c, 0xbe, 0xe5, 0x33, 0x55, 0x3e, 0x49, 0xb0, 0x5c, 0xbd,
-  0x86, 0x6e, 0xf1, 0x3d, 0xa5, 0xe2, 0x45, 0x3e, 0x94, 0x75, 0xcc, 0x3e,
-  0x35, 0xf5, 0xa9, 0x3d, 0xcc, 0x82, 0x5a, 0x3e, 0xb5, 0xda, 0x92, 0xbe,
-  0xea, 0x29, 0x1b, 0xbf, 0x06, 0x66, 0xa0, 0xbe, 0x43, 0x6e, 0x1e, 0xbd,
-  0x6c, 0xb2, 0x04, 0x3e, 0x61, 0x24, 0x0c, 0x3f, 0x05, 0x73, 0xd5, 0xbd,
-  0x52, 0xc7, 0xa7, 0xbe, 0x33, 0x1a, 0x29, 0xbd, 0xb5, 0xc9, 0xd7, 0xbd,
-  0xcd, 0xfc, 0x0a, 0xbf, 0x0a, 0x19, 0x8d, 0xbe, 0x9d, 0x2a, 0x46, 0xbd,
-  0x3a, 0x22, 0x09, 0x3f, 0x1b, 0xfb, 0x52, 0x3e, 0x7d, 0x3d, 0x95, 0x3e,
-  0x36, 0xae, 0x4f, 0x3e, 0x73, 0xf4, 0xa5, 0x3e, 0x35, 0x83, 0xe8, 0xbd,
-  0xaf, 0x79, 0xee, 0xbe, 0xa1, 0xa5, 0x58, 0xbe, 0xec, 0xf4, 0x36, 0x3d,
-  0xb8, 0x95, 0xf8, 0x3e, 0x33, 0x9d, 0x68, 0x3e, 0x6c, 0x46, 0xcd, 0x3e,
-  0x53, 0x43, 0x84, 0xbd, 0x70, 0x2e, 0xc0, 0xbe, 0x76, 0x3e, 0x55, 0xbf,
-  0x54, 0x61, 0x54, 0xbe, 0x1f, 0x7f, 0x8b, 0x3d, 0x1e, 0x40, 0x6b, 0x3e,
-  0xf6, 0xaa, 0x4f, 0x3e, 0x9d, 0x3a, 0xba, 0x3e, 0x51, 0x21, 0x56, 0x3e,
-  0xc1, 0x30, 0xc4, 0x3e, 0xda, 0x55, 0xf6, 0x3e, 0x42, 0x4d, 0xae, 0x3e,
-  0x30, 0x65, 0x2e, 0xbc, 0x15, 0xc7, 0x71, 0x3c, 0xc5, 0xbb, 0x71, 0x3e,
-  0x59, 0x69, 0x9e, 0x3e, 0xda, 0x5b, 0xb4, 0x3d, 0x46, 0x19, 0x9e, 0x3e,
-  0xbc, 0x28, 0x2a, 0x3f, 0xbf, 0x4a, 0xad, 0x3e, 0xfc, 0xbc, 0x9a, 0x3e,
-  0xb4, 0x2c, 0xd8, 0x3d, 0x14, 0x2d, 0x3e, 0xbe, 0x99, 0xc2, 0x6e, 0x3d,
-  0x83, 0x63, 0x10, 0xbe, 0x16, 0x8c, 0xf4, 0xbd, 0xee, 0xf6, 0x6a, 0x3d,
-  0x03, 0x37, 0x62, 0xbd, 0x92, 0xd1, 0x0a, 0x3e, 0x30, 0x5d, 0xc6, 0xbe,
-  0x59, 0xdd, 0x8f, 0xbe, 0xa0, 0xa6, 0xd0, 0xbe, 0xd8, 0x91, 0xe6, 0x3d,
-  0x89, 0x31, 0xd4, 0xbd, 0x84, 0x2e, 0x06, 0xbe, 0x32, 0x1f, 0x74, 0x3c,
-  0xe1, 0x7f, 0x98, 0xbe, 0xce, 0x32, 0x8c, 0xbe, 0xe8, 0x3c, 0x12, 0x3e,
-  0xad, 0x00, 0x67, 0xbd, 0x52, 0x5a, 0x34, 0x3d, 0xbc, 0x69, 0xf3, 0x3e,
-  0x80, 0xdc, 0xa5, 0xbd, 0x9a, 0xc3, 0x1e, 0x3f, 0xe8, 0x52, 0x4d, 0xbe,
-  0x9e, 0xd2, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xc0, 0x08, 0x00, 0x00,
+  0x2e, 0xa0, 0x5b, 0xbc, 0x21, 0x50, 0xbd, 0x3e, 0xc2, 0xc0, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x08, 0x00, 0x00,
+  0xdd, 0xb9, 0xa2, 0xbc, 0x03, 0xfe, 0xe6, 0x3d, 0x06, 0xfc, 0x32, 0xbe,
+  0x05, 0xa8, 0x60, 0xbf, 0xdf, 0x84, 0x84, 0xbf, 0x16, 0x8e, 0x33, 0xbf,
+  0x01, 0x18, 0x83, 0xbf, 0x06, 0x81, 0x8f, 0xbf, 0x30, 0x7e, 0x1e, 0xbf,
+  0x77, 0x30, 0x43, 0xbf, 0x6e, 0x48, 0x12, 0xbf, 0x49, 0x83, 0x27, 0xbf,
+  0x67, 0x23, 0x36, 0xbf, 0xb9, 0x98, 0x09, 0xbf, 0xa2, 0x0d, 0x47, 0xbe,
+  0x7a, 0x89, 0x06, 0x3d, 0x7a, 0x7f, 0x12, 0x3e, 0x35, 0x6b, 0x4e, 0x3e,
+  0x72, 0x9c, 0x6f, 0x3d, 0x0d, 0x2e, 0x14, 0xbe, 0xa8, 0x15, 0xa6, 0x3d,
+  0xc5, 0xd2, 0x98, 0x3e, 0x27, 0x73, 0x09, 0x3e, 0xde, 0x3c, 0xfe, 0x3d,
+  0x62, 0xe5, 0x0f, 0xbd, 0xf8, 0x24, 0xf0, 0x3e, 0x96, 0xbd, 0x73, 0xbe,
+  0x2c, 0xa9, 0xa2, 0x3d, 0x5b, 0x28, 0x92, 0xbe, 0x69, 0x1c, 0x01, 0x3d,
+  0xe6, 0x79, 0x3a, 0xbe, 0xc4, 0x9b, 0xe5, 0xbd, 0x42, 0x5e, 0x09, 0xbf,
+  0xe3, 0x23, 0xf4, 0xbe, 0xb9, 0x75, 0xa8, 0xbe, 0xee, 0x5e, 0x30, 0x3d,
+  0x71, 0xf9, 0x31, 0x3d, 0x1f, 0x86, 0x28, 0x3f, 0x53, 0xb9, 0xb5, 0x3e,
+  0x91, 0xff, 0xa1, 0x3e, 0xe4, 0xe4, 0xaa, 0x3d, 0x55, 0xf4, 0x87, 0x3e,
+  0x7b, 0x95, 0x26, 0x3f, 0x2c, 0x51, 0x51, 0x3f, 0xb2, 0x73, 0xbb, 0x3e,
+  0x07, 0x24, 0x26, 0x3f, 0x09, 0x86, 0x35, 0x3f, 0x16, 0x12, 0xfe, 0x3e,
+  0xca, 0xaa, 0x87, 0x3e, 0x9e, 0xd2, 0xe4, 0x3e, 0x1a, 0x88, 0xe5, 0x3e,
+  0x8c, 0x58, 0x35, 0x3f, 0xea, 0x7c, 0xf6, 0x3e, 0x63, 0x51, 0x28, 0x3e,
+  0x47, 0x10, 0x0f, 0x3f, 0xe6, 0x1a, 0xd4, 0x3e, 0xbd, 0x11, 0xb6, 0xbd,
+  0xe8, 0x04, 0xd7, 0xbd, 0xaf, 0xdd, 0xab, 0x3e, 0x92, 0x1c, 0xb0, 0x3e,
+  0x8c, 0x1c, 0x20, 0x3e, 0x1b, 0x54, 0xfe, 0x3d, 0x57, 0x8a, 0x49, 0x3f,
+  0x1c, 0x31, 0xef, 0x3e, 0x51, 0x80, 0x28, 0xbd, 0xc3, 0x4f, 0x93, 0x3e,
+  0x73, 0x21, 0x34, 0x3d, 0xe0, 0x2f, 0x2a, 0xbe, 0xe6, 0xe9, 0x7a, 0xbe,
+  0x91, 0x0a, 0xd8, 0xbc, 0xcf, 0x28, 0xd7, 0x3d, 0x5d, 0x30, 0x0b, 0xbd,
+  0x63, 0x7a, 0x79, 0x3e, 0x2d, 0x01, 0xcf, 0x3e, 0x3f, 0x83, 0xab, 0xbd,
+  0x61, 0xac, 0xab, 0x3e, 0x80, 0x8b, 0x29, 0x3e, 0x4c, 0xd3, 0x24, 0xbe,
+  0x7d, 0xb1, 0xf5, 0x3d, 0x02, 0xef, 0xcb, 0x3e, 0x08, 0x73, 0x30, 0x3f,
+  0x09, 0xd8, 0x7f, 0x3f, 0x8d, 0xa3, 0x0b, 0x3f, 0xf5, 0xc8, 0xa4, 0x3d,
+  0xed, 0x01, 0x4e, 0xbe, 0x9c, 0xfa, 0x8d, 0xbe, 0xec, 0x32, 0x14, 0x3e,
+  0xe5, 0xb4, 0x47, 0x3e, 0x2b, 0x55, 0xe1, 0x3d, 0x10, 0xb9, 0x3b, 0xbe,
+  0x15, 0xd6, 0xb8, 0xbd, 0xe0, 0xc8, 0x87, 0xbe, 0x86, 0x94, 0x54, 0x3d,
+  0xb2, 0xbe, 0x43, 0xbb, 0x61, 0x71, 0x48, 0xbe, 0xe6, 0x00, 0xe6, 0xbe,
+  0xd1, 0x4d, 0x18, 0xbe, 0x98, 0xce, 0xa9, 0x3c, 0x06, 0x27, 0x1d, 0x3e,
+  0x38, 0xe8, 0x51, 0x3d, 0x55, 0xaf, 0xd1, 0x3e, 0x74, 0xec, 0xa3, 0x3e,
+  0x93, 0x1d, 0x20, 0x3f, 0xd0, 0x3b, 0x03, 0x3f, 0xc1, 0x4e, 0x28, 0x3e,
+  0xf4, 0xac, 0x08, 0x3e, 0xc5, 0xb8, 0x35, 0x3f, 0x6c, 0xd1, 0xd3, 0x3e,
+  0x66, 0xac, 0x1b, 0x3f, 0x39, 0x5b, 0xfe, 0x3c, 0x2b, 0x89, 0x0a, 0x3f,
+  0xce, 0x7e, 0x96, 0x3e, 0x66, 0x0c, 0x0d, 0xbd, 0x33, 0x36, 0x3d, 0xbe,
+  0xf3, 0xfe, 0x4f, 0xbc, 0xe9, 0x76, 0x4e, 0xbf, 0xbe, 0x4e, 0x1d, 0xbe,
+  0x9e, 0xc4, 0x80, 0x3d, 0x8d, 0xba, 0xd9, 0x3e, 0x75, 0x31, 0x5d, 0x3e,
+  0x6d, 0x63, 0x49, 0xbe, 0xdb, 0x9d, 0xd0, 0xbe, 0xbb, 0xdd, 0x96, 0x3d,
+  0xf3, 0x82, 0x5e, 0x3e, 0x1f, 0x09, 0x2e, 0x3f, 0x14, 0x07, 0x71, 0xbe,
+  0x96, 0x61, 0xd6, 0xbe, 0x1f, 0xc4, 0x66, 0xbe, 0xb1, 0xc8, 0xb8, 0x3d,
+  0xf7, 0xba, 0xae, 0x3e, 0xfe, 0x60, 0xdd, 0xbd, 0x7e, 0xd6, 0x35, 0xbe,
+  0x77, 0xfe, 0x71, 0xbe, 0x57, 0x40, 0x8f, 0xbc, 0x0b, 0xe3, 0xe8, 0x3e,
+  0xda, 0x2d, 0xaf, 0x3e, 0xb1, 0x85, 0x56, 0xbe, 0x22, 0x7d, 0x10, 0x3e,
+  0x46, 0x52, 0xf3, 0x3b, 0x6a, 0xfa, 0xec, 0xbc, 0xcb, 0x92, 0x4d, 0xbd,
+  0x96, 0x07, 0x0e, 0x3e, 0x3f, 0x9a, 0xcd, 0x3e, 0x28, 0xd3, 0x48, 0x3f,
+  0x0a, 0x0e, 0x44, 0x3f, 0x02, 0xf5, 0xe4, 0x3d, 0x32, 0x37, 0x57, 0x3e,
+  0xfa, 0xc2, 0x20, 0xbd, 0x4b, 0x7d, 0x38, 0xbe, 0xcc, 0x6c, 0x71, 0xbd,
+  0x0d, 0xf0, 0x79, 0xbe, 0x55, 0x13, 0xa3, 0xbe, 0x10, 0xec, 0xa1, 0x3d,
+  0x9c, 0xc9, 0xf2, 0x3e, 0xe4, 0xe7, 0x0c, 0x3f, 0xaf, 0x94, 0xba, 0x3e,
+  0x21, 0xe9, 0x34, 0x3f, 0xae, 0xc3, 0x4e, 0x3f, 0x56, 0x62, 0x32, 0x3f,
+  0x81, 0x63, 0xe3, 0x3e, 0x55, 0x51, 0x27, 0x3f, 0xd7, 0x50, 0xcc, 0x3e,
+  0x6c, 0xf2, 0xa5, 0x3e, 0xd8, 0x30, 0x3d, 0x3f, 0xfc, 0x71, 0x3e, 0x3f,
+  0x3e, 0xd1, 0x3c, 0x3d, 0x31, 0x1b, 0x3c, 0x3e, 0xa3, 0xc7, 0xcc, 0x3d,
+  0xc7, 0x09, 0x48, 0x3d, 0xd7, 0x03, 0x4e, 0x3e, 0xe6, 0xb9, 0xbf, 0x3e,
+  0x3e, 0xe5, 0xc5, 0x3e, 0xe8, 0xdf, 0xdd, 0xbd, 0x7e, 0xa4, 0x55, 0xbd,
+  0x80, 0x40, 0x2a, 0x3e, 0x22, 0xa1, 0x2e, 0x3e, 0x44, 0xd8, 0x55, 0xbc,
+  0x22, 0x0b, 0xa6, 0x3e, 0x3c, 0x99, 0x8b, 0xbd, 0x4b, 0x6c, 0x1a, 0xbc,
+  0x72, 0x69, 0x52, 0xbe, 0x6e, 0xa6, 0x7a, 0xbe, 0xba, 0x21, 0xbb, 0x3e,
+  0x49, 0x28, 0x82, 0x3e, 0xf2, 0xbe, 0x2c, 0xbe, 0x77, 0x57, 0x0f, 0xbd,
+  0x8d, 0x83, 0xb2, 0x3e, 0xd2, 0x78, 0x25, 0x3f, 0x49, 0x78, 0x10, 0x3f,
+  0xb0, 0xb1, 0x0e, 0x3f, 0xff, 0x72, 0x13, 0x3f, 0x48, 0x66, 0x11, 0x3f,
+  0x34, 0xf7, 0x54, 0x3f, 0x3b, 0x36, 0x0c, 0x3f, 0xf4, 0xf1, 0x84, 0x3e,
+  0xdc, 0x68, 0x81, 0x3e, 0x7d, 0x1f, 0x46, 0xbe, 0x46, 0x3a, 0x41, 0xbe,
+  0xfe, 0x3b, 0xbf, 0xbe, 0x6a, 0xc1, 0xe3, 0x3e, 0x1a, 0x8a, 0x48, 0x3e,
+  0x2d, 0x53, 0xc2, 0x3b, 0x0a, 0xe1, 0xae, 0x3e, 0x3a, 0xd0, 0xe7, 0x3e,
+  0x5f, 0x08, 0x0c, 0x3c, 0x02, 0xa1, 0xe2, 0xbd, 0xcd, 0x54, 0x72, 0xbd,
+  0x42, 0x59, 0x55, 0xbe, 0xc8, 0x2e, 0xff, 0xbd, 0x52, 0x72, 0xb3, 0xbe,
+  0xb8, 0xfa, 0x93, 0xbe, 0xb9, 0x66, 0xde, 0xbd, 0x2a, 0xf1, 0x75, 0xbe,
+  0xc8, 0x0b, 0x17, 0x3d, 0x35, 0x62, 0xa2, 0x3d, 0x49, 0x3b, 0x18, 0x3f,
+  0x7c, 0x33, 0x35, 0x3f, 0x29, 0x01, 0x50, 0x3f, 0x12, 0x99, 0x39, 0x3f,
+  0xe1, 0xf6, 0x1e, 0x3f, 0xca, 0x09, 0xbb, 0x3d, 0xd0, 0xb7, 0x0a, 0xbe,
+  0x74, 0x17, 0x8c, 0xbe, 0xe1, 0xc3, 0xe9, 0xbd, 0xf2, 0x4a, 0x3f, 0xbe,
+  0x12, 0xfc, 0x76, 0xbd, 0x1b, 0x03, 0x44, 0x3f, 0xb5, 0x15, 0x92, 0x3f,
+  0x4e, 0xef, 0xdf, 0x3e, 0x17, 0x68, 0x1d, 0x3f, 0x69, 0x6b, 0xfc, 0x3d,
+  0xda, 0x49, 0xe2, 0x3e, 0x13, 0x7c, 0xbf, 0x3e, 0x59, 0x9d, 0x9c, 0xbe,
+  0x8e, 0x47, 0x80, 0xbe, 0xeb, 0x79, 0xa1, 0xbe, 0x11, 0x1f, 0xb8, 0xbd,
+  0xfd, 0x4c, 0xf8, 0xbd, 0xa0, 0x79, 0x00, 0xbe, 0xcf, 0x0e, 0x81, 0xbe,
+  0x39, 0x32, 0x45, 0xbe, 0x74, 0x0c, 0x28, 0x3d, 0x78, 0x06, 0xfb, 0x3e,
+  0x8e, 0x6e, 0x73, 0x3f, 0x66, 0x59, 0x52, 0x3f, 0x97, 0x5f, 0x7f, 0x3f,
+  0xe0, 0x15, 0x17, 0x3f, 0x24, 0xca, 0xe3, 0x3e, 0x05, 0xed, 0xe1, 0x3e,
+  0x4b, 0xe0, 0x2f, 0xbe, 0x79, 0x03, 0x2d, 0x3f, 0xf9, 0x7c, 0x93, 0x3e,
+  0x81, 0x99, 0x1e, 0x3c, 0xc0, 0xf6, 0x83, 0xbe, 0x30, 0x09, 0x3b, 0x3f,
+  0x77, 0x0a, 0x37, 0x3f, 0x3b, 0x30, 0x31, 0x3f, 0x90, 0x59, 0x2a, 0x3f,
+  0x66, 0xc8, 0x16, 0x3f, 0x3b, 0x62, 0x1d, 0x3e, 0x08, 0xca, 0xcd, 0x3d,
+  0x0d, 0xc4, 0x6d, 0xbe, 0x82, 0x9d, 0x69, 0xbe, 0x3a, 0xeb, 0x8a, 0xbd,
+  0x1a, 0xb0, 0xf3, 0xbd, 0xec, 0x2d, 0x8d, 0x3d, 0x71, 0x53, 0xc4, 0x3e,
+  0x6c, 0xcc, 0xeb, 0x3c, 0xd5, 0x61, 0x7e, 0xbe, 0x88, 0xd9, 0x28, 0x3d,
+  0x81, 0xd5, 0x48, 0x3d, 0x62, 0x88, 0x04, 0xbe, 0xfa, 0xd1, 0x8a, 0xbe,
+  0x95, 0x7f, 0x3c, 0xbe, 0x6e, 0x5d, 0x41, 0x3e, 0x5a, 0x4c, 0x14, 0x3e,
+  0x36, 0x80, 0x82, 0x3e, 0x8a, 0xc5, 0x1d, 0xbe, 0xf8, 0x08, 0xfa, 0x3e,
+  0xc7, 0x1e, 0x28, 0x3f, 0x41, 0xde, 0x68, 0xbe, 0x06, 0x76, 0x9d, 0x3e,
+  0xf0, 0x68, 0x00, 0xbe, 0x03, 0xdd, 0x88, 0x3d, 0xaf, 0xcf, 0xce, 0xbc,
+  0xf6, 0xc8, 0x37, 0xbd, 0x17, 0x4d, 0x07, 0x3e, 0x5c, 0x64, 0xfc, 0x3e,
+  0xd4, 0x1a, 0x37, 0x3f, 0x26, 0x25, 0x05, 0x3f, 0xef, 0x34, 0x46, 0x3f,
+  0x69, 0x09, 0x9e, 0xbd, 0x70, 0x9c, 0x5d, 0xbe, 0xc7, 0x50, 0xaf, 0x3d,
+  0x06, 0x21, 0x0b, 0x3d, 0x7c, 0x2b, 0xbd, 0x3e, 0xd3, 0x5e, 0x3b, 0x3e,
+  0x8f, 0x1e, 0x66, 0xbd, 0x2f, 0x24, 0x44, 0xbe, 0x5b, 0xe6, 0x73, 0x3d,
+  0xca, 0xc6, 0x65, 0x3e, 0x91, 0xdd, 0x45, 0x3e, 0xb1, 0x5d, 0x32, 0x3e,
+  0xa9, 0xbb, 0x68, 0xbc, 0x7f, 0x5a, 0xb1, 0x3d, 0xe0, 0x06, 0x9a, 0x3d,
+  0x62, 0xea, 0xa6, 0x3d, 0x9e, 0xd0, 0xbd, 0x3d, 0xc4, 0x44, 0x38, 0x3e,
+  0x10, 0x3c, 0x75, 0x3e, 0x7e, 0x49, 0x14, 0x3f, 0x3c, 0x90, 0xea, 0x3e,
+  0x9f, 0xc3, 0x86, 0x3e, 0xe1, 0x2d, 0xf4, 0x3e, 0x30, 0x96, 0xb3, 0x3e,
+  0x63, 0x74, 0x6a, 0x3e, 0xbe, 0x1f, 0x28, 0x3e, 0x9b, 0x48, 0x5e, 0x3e,
+  0xf9, 0xe3, 0xed, 0x3e, 0x43, 0xe0, 0x18, 0x3f, 0x82, 0x75, 0x49, 0x3e,
+  0x87, 0xa7, 0xa7, 0xbc, 0x26, 0xc1, 0x36, 0xbe, 0xac, 0x89, 0xa1, 0x3e,
+  0xa0, 0xfa, 0x17, 0x3f, 0xd3, 0xbe, 0x14, 0x3f, 0xa3, 0x22, 0x0f, 0x3e,
+  0xac, 0x4a, 0x98, 0xbc, 0xca, 0xc3, 0x6e, 0x3e, 0xab, 0x00, 0x36, 0x3e,
+  0x46, 0x52, 0x31, 0x3f, 0x79, 0x32, 0x51, 0x3f, 0x30, 0xc3, 0x86, 0xbd,
+  0xbd, 0x94, 0x0f, 0xbf, 0xa9, 0xde, 0x6f, 0xbe, 0x9f, 0x56, 0x27, 0xbe,
+  0xd3, 0x3d, 0x4d, 0xbd, 0x05, 0xa0, 0x4f, 0x3d, 0xc8, 0x0d, 0xcc, 0xbc,
+  0xe6, 0x95, 0x8a, 0x3e, 0x24, 0xf2, 0xb0, 0x3d, 0x8a, 0x91, 0x91, 0xbe,
+  0x1a, 0xb0, 0x0d, 0x3b, 0xb0, 0xdf, 0xa7, 0xbe, 0x99, 0x99, 0x4e, 0x3e,
+  0x1e, 0x99, 0x81, 0xbe, 0xd7, 0x97, 0x9e, 0xbe, 0x89, 0xb8, 0x4c, 0x3e,
+  0x30, 0xd8, 0xd9, 0x3e, 0x38, 0xb8, 0x21, 0x3f, 0xa6, 0x2d, 0x2f, 0x3e,
+  0xb9, 0xcd, 0x3c, 0xbe, 0x66, 0x1d, 0x80, 0xbe, 0xbf, 0x66, 0x24, 0x3e,
+  0x9c, 0x4b, 0x70, 0x3e, 0xde, 0x6e, 0x13, 0xbd, 0x7e, 0x41, 0xcf, 0xbe,
+  0x1d, 0x13, 0x5f, 0xbe, 0xf1, 0x54, 0x49, 0x3e, 0xb9, 0x31, 0xbc, 0x3e,
+  0xb5, 0x96, 0x25, 0x3f, 0x90, 0x75, 0x28, 0x3d, 0x6b, 0x75, 0xa4, 0xbd,
+  0xfe, 0x1a, 0x07, 0xbf, 0x21, 0xc5, 0x14, 0xbe, 0x5f, 0xaf, 0x3a, 0x3e,
+  0xcc, 0x51, 0xbd, 0xbd, 0x8f, 0xd3, 0x18, 0xbe, 0x68, 0x7e, 0xdd, 0xbe,
+  0x80, 0x0e, 0xba, 0xbd, 0x5e, 0xad, 0xcb, 0x3e, 0x82, 0x4e, 0xb0, 0x3d,
+  0xea, 0x08, 0x81, 0xbe, 0xc7, 0xbc, 0xa6, 0xbd, 0x72, 0x5d, 0x6e, 0x3e,
+  0x81, 0xba, 0x2c, 0x3e, 0xd1, 0x43, 0xcd, 0x3e, 0xb1, 0xd3, 0xf5, 0x3e,
+  0xb2, 0x07, 0x2e, 0x3e, 0x02, 0xa5, 0xd5, 0xbd, 0xc0, 0x51, 0x02, 0xbf,
+  0x3a, 0xcc, 0x84, 0xbe, 0x37, 0x3d, 0x60, 0xbe, 0x17, 0xae, 0xee, 0xbe,
+  0x8c, 0xc3, 0x3d, 0xbf, 0x28, 0xba, 0xee, 0xbe, 0x1d, 0x14, 0x61, 0xba,
+  0x5b, 0x43, 0x98, 0x3d, 0x49, 0x83, 0xea, 0xbe, 0x5b, 0xbf, 0x14, 0xbf,
+  0x28, 0x93, 0x78, 0xbe, 0x33, 0xdf, 0x5d, 0x3e, 0xc9, 0x9a, 0x80, 0x3e,
+  0x15, 0x3d, 0x8e, 0x3d, 0x38, 0x0c, 0x42, 0x3c, 0xb1, 0x57, 0x1d, 0x3b,
+  0xca, 0xec, 0xff, 0xbe, 0xbb, 0xe1, 0xb3, 0xbe, 0x0d, 0xe2, 0x4e, 0xbf,
+  0x63, 0xa0, 0x05, 0xbf, 0xbc, 0xe7, 0x46, 0xbf, 0xc8, 0xe2, 0x27, 0xbf,
+  0x36, 0x1a, 0x71, 0xbf, 0x15, 0xc0, 0x31, 0xbf, 0x99, 0xfa, 0x5b, 0xbe,
+  0x99, 0x5c, 0x9c, 0xbb, 0xbf, 0x0b, 0x8c, 0x3e, 0x35, 0x68, 0x10, 0x3e,
+  0xa8, 0xe6, 0x80, 0x3b, 0xa3, 0x8e, 0x4b, 0x3e, 0x76, 0x7c, 0x0a, 0xbe,
+  0xd2, 0x56, 0x6a, 0x3b, 0x95, 0x28, 0xf4, 0xbc, 0x1a, 0x4d, 0x88, 0x3e,
+  0xe5, 0xa7, 0xd1, 0x3c, 0xbb, 0x77, 0x3a, 0xbe, 0x15, 0x3b, 0xa3, 0xbc,
+  0x36, 0x2e, 0x89, 0xbe, 0x7a, 0x9b, 0x9f, 0xbe, 0xc0, 0x53, 0x98, 0x3e,
+  0x97, 0x75, 0x33, 0x3d, 0x86, 0x6c, 0xe1, 0x3e, 0xe7, 0x02, 0x00, 0x3f,
+  0x78, 0x5c, 0x30, 0x3f, 0x57, 0x96, 0x08, 0x3f, 0x30, 0x7a, 0x67, 0x3f,
+  0x92, 0x9a, 0x7a, 0x3f, 0x06, 0x7e, 0x57, 0x3f, 0x6e, 0x3c, 0x6d, 0x3d,
+  0x19, 0xee, 0x38, 0x3e, 0x3c, 0x59, 0x1c, 0x3f, 0xa5, 0xc5, 0x18, 0x3f,
+  0x8a, 0x88, 0x0b, 0x3f, 0x32, 0x80, 0x82, 0x3f, 0xa3, 0x2b, 0xc3, 0x3e,
+  0x58, 0x94, 0x83, 0x3e, 0x4b, 0x69, 0x94, 0x3d, 0x0b, 0x8d, 0x13, 0x3f,
+  0x3f, 0x0e, 0x3f, 0x3f, 0xd2, 0xcb, 0x3c, 0x3f, 0xfe, 0x8c, 0xe5, 0x3e,
+  0xd9, 0xc8, 0x72, 0x3e, 0xf8, 0x25, 0x0d, 0x3d, 0x27, 0x59, 0x53, 0x3c,
+  0x76, 0x9f, 0xa6, 0xbc, 0xbf, 0xbb, 0x37, 0xbe, 0x10, 0xee, 0x1c, 0x3e,
+  0xb5, 0xf0, 0x96, 0xbd, 0x1f, 0x2c, 0x52, 0x3d, 0xf6, 0x67, 0x8f, 0xbc,
+  0x17, 0xa6, 0x25, 0xbe, 0xa0, 0xc1, 0x97, 0x3e, 0x8b, 0x95, 0xaa, 0xbd,
+  0xf1, 0x13, 0x4d, 0x3e, 0x12, 0x22, 0x1d, 0xbd, 0xb4, 0x59, 0xa6, 0x3d,
+  0xb2, 0x00, 0x39, 0xbe, 0x75, 0xdc, 0xf9, 0x3d, 0xea, 0xb3, 0x72, 0x3e,
+  0x4a, 0xe3, 0x8c, 0x3e, 0xc3, 0x0b, 0x12, 0x3e, 0x97, 0x60, 0x3d, 0x3e,
+  0xdc, 0x93, 0x56, 0x3e, 0x45, 0xcd, 0x93, 0xbe, 0x8b, 0x29, 0x41, 0xbe,
+  0x13, 0x4d, 0xe3, 0xbe, 0xe0, 0xb5, 0xd2, 0xbe, 0xa0, 0xcb, 0x3f, 0xbc,
+  0xfb, 0x8c, 0xa9, 0xbe, 0x7a, 0x22, 0xac, 0xbe, 0x65, 0x81, 0x13, 0xbf,
+  0x72, 0xb1, 0x3d, 0xbf, 0xc2, 0x02, 0x50, 0xbf, 0x59, 0xc7, 0x9b, 0xbb,
+  0x7e, 0x60, 0x5b, 0xbe, 0xce, 0xba, 0xbb, 0x3e, 0x2e, 0x8d, 0x18, 0xbe,
+  0x95, 0xc4, 0x17, 0x3f, 0x9f, 0xd3, 0x78, 0x3d, 0xae, 0xfb, 0xb7, 0xbe,
+  0xbd, 0x5f, 0xea, 0xbd, 0x99, 0xe5, 0x96, 0xbe, 0xf3, 0x9c, 0xc1, 0xbd,
+  0x90, 0x48, 0x66, 0x3d, 0xce, 0x24, 0x8f, 0xbe, 0x9a, 0xbb, 0x5c, 0xbe,
+  0xfa, 0x52, 0x16, 0xbf, 0x42, 0x37, 0xeb, 0xbe, 0xd3, 0x39, 0xe5, 0x3e,
+  0x20, 0x1b, 0x77, 0x3f, 0xcf, 0xe2, 0x34, 0x3f, 0x57, 0x50, 0x13, 0x3f,
+  0x12, 0xa3, 0xcd, 0x3e, 0x27, 0xa9, 0xab, 0x3e, 0xd4, 0x84, 0x74, 0x3e,
+  0xea, 0xf9, 0x34, 0xbe, 0x49, 0x52, 0x3c, 0xbe, 0x36, 0x7f, 0x9d, 0xbd,
+  0xdd, 0xd8, 0xe8, 0x3a, 0x86, 0x3f, 0x55, 0xbe, 0x65, 0x47, 0x01, 0xbf,
+  0x8f, 0x96, 0x45, 0xbd, 0x7c, 0x68, 0xd3, 0x3e, 0x0e, 0xad, 0x57, 0x3f,
+  0xe9, 0xa5, 0x70, 0x3e, 0xe8, 0x01, 0x2e, 0x3f, 0x63, 0x46, 0x9c, 0xbd,
+  0x61, 0xa1, 0xc4, 0xbe, 0x76, 0x98, 0x7b, 0xbe, 0xd7, 0xc1, 0x84, 0xbe,
+  0x0c, 0x81, 0xf1, 0xbe, 0x1e, 0x55, 0x19, 0xbf, 0x2c, 0xe1, 0xa8, 0xbe,
+  0xf7, 0x94, 0xf0, 0xbd, 0x19, 0xa6, 0xe3, 0xbe, 0x95, 0x93, 0xf2, 0xbe,
+  0x5e, 0xe2, 0x0b, 0xbf, 0x6a, 0xbd, 0x13, 0xbf, 0xa5, 0xce, 0x48, 0x3e,
+  0x01, 0xaf, 0x9f, 0x3e, 0xf2, 0x1c, 0xea, 0x3e, 0x03, 0x77, 0x67, 0x3e,
+  0x03, 0x16, 0x90, 0xbc, 0xd8, 0xef, 0xae, 0xbe, 0xd2, 0x61, 0x82, 0x3b,
+  0x4d, 0x93, 0x91, 0xbe, 0x67, 0x25, 0x98, 0xbc, 0xb6, 0x0f, 0x21, 0xbd,
+  0x48, 0x1c, 0xf1, 0xbe, 0x6f, 0x63, 0x6f, 0xbd, 0x50, 0x70, 0x24, 0x3f,
+  0xc8, 0x65, 0x44, 0x3e, 0xdd, 0x0a, 0x62, 0xbd, 0x7d, 0x9c, 0x95, 0xbe,
+  0x18, 0xdb, 0x39, 0x3c, 0xaa, 0x85, 0x67, 0x3b, 0x4a, 0xbd, 0x2f, 0x3f,
+  0x42, 0x40, 0x1b, 0x3d, 0xc8, 0x2e, 0xb9, 0xbe, 0xfd, 0x15, 0xbc, 0xbe,
+  0xfd, 0xbf, 0x02, 0xbe, 0xf3, 0xc4, 0x4b, 0xbe, 0xef, 0x54, 0xe5, 0x3d,
+  0x09, 0x92, 0xa8, 0x3e, 0xf6, 0x31, 0x60, 0x3f, 0x1f, 0x40, 0x44, 0x3f,
+  0x60, 0xe3, 0x11, 0x3f, 0xde, 0xf2, 0xae, 0x3e, 0xc7, 0xf4, 0xd5, 0x3d,
+  0xf2, 0x06, 0x51, 0x3e, 0x73, 0xac, 0x18, 0xbe, 0x3c, 0xd6, 0x8c, 0x3e,
+  0x69, 0xec, 0x78, 0x3d, 0x40, 0x24, 0x86, 0x3e, 0xd0, 0x86, 0xd9, 0x3d,
+  0xf5, 0x9a, 0x29, 0x3e, 0xd9, 0xe7, 0xf5, 0x3c, 0xad, 0x7a, 0xa6, 0x3e,
+  0x55, 0x5c, 0x7d, 0x3e, 0xfa, 0xe9, 0xed, 0x3c, 0x92, 0xc9, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x08, 0x00, 0x00,
+  0x29, 0xea, 0x2c, 0xbe, 0x6f, 0x8a, 0x97, 0x3e, 0x78, 0x82, 0xc7, 0xbd,
+  0x94, 0x87, 0x40, 0xbf, 0xdd, 0xd3, 0x23, 0xbf, 0x33, 0x97, 0x93, 0xbe,
+  0xbf, 0x4a, 0x72, 0x3e, 0xb4, 0xaa, 0xe7, 0x3c, 0x2e, 0xfd, 0xa5, 0x3e,
+  0xa2, 0x54, 0x51, 0x3e, 0xc3, 0xb5, 0xf8, 0x3e, 0x43, 0x87, 0xc4, 0x3e,
+  0xce, 0xdf, 0x03, 0x3f, 0xf1, 0x15, 0xbf, 0x3e, 0x88, 0xc8, 0x0e, 0x3e,
+  0xdc, 0x69, 0xfb, 0xbd, 0x1c, 0x63, 0x0a, 0xbe, 0xa2, 0x8e, 0x46, 0xbe,
+  0x31, 0xbc, 0x2c, 0xbe, 0xbd, 0x6e, 0xd9, 0xbd, 0xb2, 0x2a, 0x5c, 0xbe,
+  0xa4, 0x25, 0x91, 0x3e, 0x12, 0x15, 0x81, 0x3d, 0x9b, 0x9e, 0xe9, 0x3e,
+  0x54, 0x96, 0x1a, 0xbd, 0x18, 0x8c, 0xa6, 0xbe, 0x49, 0x1d, 0xed, 0xbd,
+  0x60, 0xe6, 0x04, 0x3f, 0x73, 0x8e, 0x4c, 0x3e, 0x04, 0x3e, 0x82, 0x3e,
+  0x96, 0x6c, 0x07, 0xbf, 0x56, 0x44, 0xe0, 0xbe, 0x13, 0xa9, 0x1e, 0xbe,
+  0x7a, 0x9d, 0xf1, 0xbd, 0xab, 0xa9, 0xd9, 0xbc, 0xf7, 0x9a, 0xd4, 0x3d,
+  0x15, 0x78, 0x5a, 0xbd, 0xdd, 0xe5, 0x9b, 0xbd, 0xbe, 0xbd, 0xd6, 0x3d,
+  0xe5, 0xa1, 0x09, 0xbd, 0xa8, 0xb0, 0xb8, 0x3e, 0x97, 0x51, 0x11, 0x3e,
+  0xcf, 0x67, 0xc6, 0x3d, 0x23, 0x19, 0x20, 0xbe, 0x6d, 0x89, 0x8c, 0xbe,
+  0x85, 0x5e, 0xbe, 0x3d, 0x8d, 0x13, 0x35, 0x3e, 0x16, 0x0e, 0x6b, 0xbe,
+  0x65, 0x60, 0x66, 0xbd, 0x84, 0xa2, 0xa2, 0x3e, 0x64, 0x87, 0x4b, 0x3e,
+  0x0f, 0x1b, 0x80, 0x3e, 0xa5, 0xcb, 0xd8, 0x3e, 0x0b, 0xb1, 0xcd, 0x3e,
+  0x8d, 0x32, 0xd9, 0xbd, 0x97, 0x7c, 0x1a, 0x3f, 0xda, 0x8f, 0x3a, 0x3d,
+  0x52, 0xd6, 0x8a, 0xbe, 0xf4, 0x68, 0x29, 0x3e, 0x3d, 0x54, 0x7d, 0x3e,
+  0xa3, 0x98, 0x84, 0x3d, 0x3a, 0x7c, 0xd5, 0xbc, 0xb2, 0x2c, 0x3e, 0x3c,
+  0x58, 0x92, 0x21, 0xbe, 0xa1, 0xb7, 0xb1, 0xbd, 0xe9, 0xfb, 0x82, 0xbe,
+  0x92, 0x69, 0x0c, 0xbe, 0x5a, 0x18, 0x89, 0xbd, 0xfa, 0x01, 0x3c, 0xbe,
+  0x79, 0xe8, 0x90, 0x3e, 0xb8, 0x9d, 0x86, 0x3e, 0xd9, 0xc1, 0xaa, 0x3e,
+  0x66, 0x29, 0x01, 0xbd, 0xab, 0xed, 0x6c, 0x3e, 0x3c, 0x08, 0xcf, 0xbc,
+  0x19, 0xdb, 0x51, 0xbe, 0x9b, 0x1c, 0x58, 0xbe, 0xb2, 0x01, 0x3e, 0x3d,
+  0xeb, 0xdf, 0x29, 0xbe, 0x42, 0x72, 0x17, 0xbd, 0xe4, 0x61, 0xa2, 0xb9,
+  0xf8, 0x20, 0xb3, 0x3e, 0x6d, 0xfd, 0x95, 0xbe, 0x79, 0x43, 0x04, 0x3e,
+  0xcc, 0xad, 0x5d, 0x3e, 0x45, 0x7f, 0xc9, 0x3c, 0x9e, 0x3a, 0xf8, 0xbd,
+  0xfc, 0x2e, 0x1d, 0x3f, 0xd3, 0x10, 0x4c, 0x3f, 0xd1, 0x89, 0x9c, 0x3d,
+  0x49, 0xfe, 0x45, 0x3c, 0x39, 0x3e, 0x43, 0x3e, 0x1f, 0x43, 0xb7, 0x3e,
+  0x2f, 0x50, 0x8a, 0x3e, 0x20, 0x57, 0x81, 0xbe, 0x32, 0x05, 0x97, 0xbe,
+  0x76, 0xfc, 0xd1, 0xbe, 0x1c, 0x0b, 0xdd, 0x3c, 0x91, 0x7b, 0x4d, 0x3d,
+  0x90, 0x0a, 0xc6, 0x3d, 0x06, 0x6f, 0x43, 0xbd, 0x89, 0x42, 0xad, 0xbe,
+  0x6f, 0x14, 0xed, 0xbd, 0xd4, 0xa9, 0x7f, 0xbd, 0xe1, 0xa3, 0x70, 0xbc,
+  0xf3, 0xd1, 0x68, 0xbc, 0xd1, 0xca, 0x27, 0xbd, 0xd4, 0xbc, 0xaf, 0xbe,
+  0xda, 0xe5, 0x2f, 0xbf, 0xcc, 0x0b, 0x4c, 0xbe, 0x4d, 0xe3, 0x45, 0x3f,
+  0xd9, 0x3e, 0x03, 0x3e, 0x60, 0xe4, 0x92, 0x3d, 0xd8, 0xed, 0x8a, 0xbe,
+  0xe1, 0x21, 0x03, 0x3e, 0x42, 0x7a, 0xde, 0x3d, 0x08, 0x32, 0xdc, 0x3c,
+  0x2e, 0x6b, 0xb7, 0x3e, 0x24, 0x69, 0x05, 0xbe, 0xf8, 0xfc, 0xe7, 0x3e,
+  0x92, 0x58, 0x0b, 0x3e, 0x94, 0x46, 0x8a, 0xbe, 0xd1, 0x95, 0xf9, 0x3c,
+  0x84, 0x31, 0x36, 0x3d, 0x13, 0x18, 0x56, 0x3d, 0x94, 0x28, 0xb0, 0x3e,
+  0xcc, 0x21, 0x73, 0x3e, 0x00, 0xd6, 0x23, 0xbd, 0x24, 0x5a, 0x6b, 0x3e,
+  0xc2, 0x4b, 0x9f, 0xbd, 0x2c, 0x95, 0x84, 0xbd, 0xdd, 0xdf, 0x1b, 0xbc,
+  0x82, 0x26, 0x86, 0x3d, 0x5d, 0x8a, 0x09, 0x3d, 0xac, 0x57, 0xeb, 0x3e,
+  0xc1, 0x05, 0xf1, 0x3b, 0x3f, 0x6b, 0x04, 0xbf, 0x0b, 0x2c, 0x21, 0x3e,
+  0x0c, 0xb4, 0x5f, 0x3e, 0x4c, 0xd4, 0x93, 0xbe, 0x47, 0xcb, 0x2a, 0x3e,
+  0xe0, 0x4e, 0x9d, 0xbe, 0x65, 0x69, 0x43, 0xbe, 0xc3, 0xdc, 0x1f, 0x3e,
+  0x58, 0x01, 0xe2, 0x3d, 0x38, 0x0f, 0x6e, 0x3e, 0xef, 0xd9, 0xa1, 0x3e,
+  0xf4, 0xf0, 0x77, 0x3e, 0xb7, 0x2e, 0x8e, 0x3e, 0x0b, 0xe3, 0x00, 0x3e,
+  0xfa, 0xa0, 0x4b, 0xbe, 0xec, 0xcb, 0x04, 0x3d, 0x44, 0x2b, 0xd0, 0xbe,
+  0x1f, 0x31, 0x83, 0xbc, 0x3f, 0x69, 0x00, 0xbe, 0x2f, 0x11, 0xb7, 0x3d,
+  0x3b, 0x91, 0x3c, 0x3d, 0x1b, 0x39, 0x55, 0xbe, 0x5e, 0x07, 0x86, 0xbd,
+  0x30, 0xae, 0x42, 0xbb, 0x5c, 0xfc, 0x11, 0x3e, 0x1f, 0x6d, 0xc6, 0xbe,
+  0xa3, 0xb8, 0xc3, 0xba, 0x8b, 0x83, 0x01, 0xbe, 0xd6, 0x2a, 0x3c, 0x3e,
+  0x44, 0x25, 0x70, 0xbd, 0xc9, 0xeb, 0x97, 0x3e, 0x4e, 0x25, 0x75, 0x3e,
+  0x4c, 0x95, 0x1a, 0xbe, 0x6a, 0x8b, 0x92, 0x3e, 0x81, 0xba, 0x69, 0x3d,
+  0xd7, 0xd8, 0x87, 0x3e, 0xc5, 0x30, 0x52, 0x3f, 0x8b, 0xb2, 0x48, 0x3c,
+  0x61, 0x00, 0x19, 0x3e, 0x4b, 0x95, 0x28, 0xbe, 0x57, 0x65, 0x9d, 0x3d,
+  0x6d, 0x61, 0x90, 0xbd, 0xf7, 0x7f, 0x40, 0xbe, 0xa4, 0xe3, 0x52, 0xbe,
+  0x52, 0x92, 0x37, 0xbe, 0x5d, 0x10, 0xdc, 0x3d, 0xe7, 0xfe, 0xd2, 0x3e,
+  0x8d, 0x3c, 0x80, 0xbd, 0xe7, 0x13, 0xdd, 0xbe, 0x07, 0xf0, 0xbc, 0xbe,
+  0xcb, 0xdc, 0x64, 0xbd, 0x26, 0x93, 0xb4, 0x3e, 0xab, 0xa8, 0x64, 0x3c,
+  0xd2, 0xc3, 0x9d, 0x3d, 0x28, 0xff, 0xb1, 0x3e, 0xd8, 0x32, 0xb2, 0x3d,
+  0xea, 0xeb, 0xdb, 0x3b, 0xc9, 0x7b, 0x89, 0x3e, 0x75, 0xb9, 0x6d, 0x3e,
+  0x0c, 0x10, 0xa9, 0x3e, 0x41, 0x78, 0xd0, 0x3d, 0xe7, 0x42, 0xd3, 0x3d,
+  0xba, 0xfb, 0x8c, 0xbe, 0xc9, 0x93, 0x01, 0xbf, 0xee, 0x1e, 0x63, 0x3e,
+  0x81, 0x44, 0x9f, 0x3d, 0x4d, 0x13, 0x9c, 0xbe, 0x45, 0x3a, 0x66, 0x3d,
+  0x80, 0xb7, 0xb4, 0xbd, 0x25, 0x01, 0x1a, 0xbe, 0x40, 0x3b, 0x4b, 0xbd,
+  0xee, 0x24, 0x94, 0x3d, 0xf7, 0xfd, 0x56, 0xbd, 0xc5, 0x70, 0xbf, 0x3e,
+  0xeb, 0x87, 0xfe, 0x3d, 0xb1, 0xa3, 0x61, 0x3e, 0x1b, 0x5a, 0x94, 0xbd,
+  0x1d, 0x1f, 0xd0, 0xbe, 0x0a, 0xb6, 0x17, 0xbf, 0x9a, 0x3a, 0x37, 0xbf,
+  0xe7, 0x0a, 0xec, 0xbe, 0x27, 0x2e, 0xb3, 0x3d, 0xa2, 0xf0, 0xa4, 0x3e,
+  0x5b, 0xe2, 0x10, 0x3f, 0xf2, 0x76, 0x28, 0x3f, 0x52, 0x11, 0x1f, 0x3e,
+  0x7a, 0x63, 0x2b, 0xbd, 0x55, 0x17, 0xbe, 0x3e, 0xa4, 0x75, 0x4d, 0xbd,
+  0xb2, 0x04, 0x40, 0x3e, 0x21, 0x41, 0x05, 0x3e, 0x16, 0x6d, 0x2a, 0x3d,
+  0x62, 0x5c, 0x83, 0xbe, 0x9e, 0x6f, 0x81, 0xbe, 0x8d, 0x98, 0x8d, 0x3c,
+  0x39, 0x70, 0xaf, 0x3d, 0xc9, 0xf3, 0xa2, 0x3d, 0xc5, 0xca, 0xc4, 0xbd,
+  0x78, 0xe5, 0x8b, 0xbd, 0x80, 0xf0, 0x70, 0x3c, 0xb0, 0xfa, 0x42, 0xbe,
+  0x93, 0x76, 0x80, 0xbe, 0x22, 0x70, 0x37, 0xbd, 0x8e, 0x36, 0x2a, 0xbe,
+  0xd0, 0xd1, 0x70, 0x3e, 0x77, 0xba, 0x90, 0xbd, 0x62, 0x08, 0x36, 0x3e,
+  0x42, 0xda, 0x56, 0xbc, 0xa1, 0x29, 0x1d, 0xbe, 0x2d, 0x2e, 0x1a, 0xbe,
+  0xe7, 0xea, 0x43, 0xbf, 0x27, 0x15, 0xdd, 0xbe, 0x41, 0x57, 0x03, 0xbf,
+  0x9e, 0x98, 0x9e, 0x3c, 0x82, 0x5a, 0x9a, 0xbe, 0xb9, 0xff, 0x94, 0x3d,
+  0xb9, 0x8a, 0xd2, 0x3e, 0x14, 0x5e, 0xda, 0xbe, 0x91, 0x2e, 0x33, 0xbe,
+  0x3d, 0xb5, 0x3d, 0x3f, 0xc6, 0x0d, 0x84, 0xbe, 0x0e, 0x68, 0x0c, 0xbf,
+  0xda, 0x55, 0xd4, 0xbd, 0x35, 0x1a, 0x52, 0x3d, 0xd1, 0xea, 0x08, 0x3e,
+  0xe3, 0x70, 0x8a, 0x3e, 0x26, 0x41, 0xa0, 0x3e, 0x07, 0x62, 0x8d, 0x3e,
+  0x08, 0x7d, 0x03, 0x3e, 0xcb, 0xc1, 0xe4, 0xbe, 0xca, 0xe6, 0x96, 0xbd,
+  0x20, 0x0d, 0x24, 0xbe, 0x73, 0xa4, 0xac, 0xbd, 0x66, 0xbe, 0x9e, 0xbd,
+  0xaf, 0xf2, 0x88, 0x3e, 0xf5, 0xf5, 0x06, 0x3f, 0x6e, 0xa6, 0x71, 0x3e,
+  0xbf, 0xe3, 0x40, 0x3d, 0x2e, 0x9c, 0x90, 0xbd, 0x14, 0xdc, 0x16, 0xbf,
+  0x20, 0x12, 0x49, 0xbf, 0x3b, 0x9f, 0x70, 0xbf, 0x42, 0xa3, 0x18, 0xbf,
+  0x33, 0x20, 0xdb, 0x3d, 0xe5, 0x5d, 0x6a, 0x3d, 0x8b, 0xd0, 0x93, 0x3e,
+  0x06, 0x71, 0x9a, 0xbe, 0x72, 0x2c, 0x4f, 0xbe, 0xe6, 0xc9, 0x27, 0x3e,
+  0x41, 0x32, 0x9e, 0x3e, 0x99, 0x2f, 0xd6, 0x3d, 0x88, 0xcf, 0xab, 0x3e,
+  0x93, 0x24, 0xfe, 0x3c, 0x9f, 0x4f, 0x1a, 0x3e, 0xa0, 0xa2, 0xb9, 0x3e,
+  0x7f, 0xb3, 0x83, 0x3e, 0xda, 0xbf, 0x8e, 0x3e, 0x6d, 0x22, 0x71, 0xbe,
+  0x41, 0x18, 0x83, 0xbe, 0x7b, 0x09, 0xc8, 0xbe, 0x11, 0xdd, 0xea, 0xbe,
+  0xb7, 0x8c, 0x27, 0xbe, 0x0b, 0xd7, 0x38, 0xbd, 0xcf, 0x44, 0xaa, 0x3d,
+  0x71, 0x1a, 0xc6, 0x3d, 0xf1, 0x58, 0xee, 0x3e, 0xcf, 0xdd, 0x1a, 0x3e,
+  0x25, 0xf1, 0xc9, 0x3e, 0x3e, 0x3c, 0x8f, 0x3e, 0x4c, 0x58, 0x5c, 0xbe,
+  0x97, 0x68, 0x1d, 0x3e, 0xf0, 0x93, 0x91, 0x3e, 0x81, 0xea, 0x8f, 0x3e,
+  0x29, 0xba, 0x8b, 0x3e, 0xd3, 0x4b, 0x86, 0xbc, 0x30, 0xee, 0xd7, 0x3d,
+  0x4f, 0x1f, 0x75, 0xbe, 0x86, 0x9e, 0xdd, 0xbb, 0xd2, 0xef, 0xc9, 0xbd,
+  0x98, 0x7b, 0xa8, 0xbe, 0x9d, 0x4e, 0xc1, 0xbe, 0xf6, 0xc1, 0x18, 0xbf,
+  0x36, 0x83, 0x0c, 0xbf, 0x16, 0x12, 0x0e, 0xbf, 0x39, 0x0c, 0xb4, 0xbe,
+  0x8b, 0x6b, 0xb7, 0x3e, 0xf6, 0xc2, 0x97, 0x3e, 0x6f, 0x67, 0x0b, 0x3f,
+  0xd3, 0xd3, 0xc9, 0x3e, 0xf8, 0x31, 0x97, 0xbc, 0x4a, 0x09, 0xac, 0xbe,
+  0x16, 0xa7, 0xa4, 0x3d, 0xb2, 0xde, 0x6d, 0x3d, 0x71, 0xf6, 0x92, 0x3e,
+  0x1c, 0xc2, 0xb3, 0x3e, 0xeb, 0x5a, 0x37, 0x3d, 0x68, 0xa1, 0xe5, 0x3d,
+  0x5e, 0xc5, 0xce, 0x3c, 0xae, 0x69, 0x03, 0x3d, 0x80, 0x30, 0xb1, 0x3d,
+  0x01, 0x89, 0x95, 0x3d, 0x89, 0x2c, 0x3b, 0xbe, 0xaf, 0x74, 0x4f, 0xbf,
+  0x47, 0xe3, 0x74, 0x3e, 0xac, 0x64, 0xac, 0x3e, 0xba, 0x27, 0xa8, 0x3e,
+  0xf0, 0xb1, 0x82, 0x3e, 0x7f, 0xa0, 0xee, 0x3e, 0xfa, 0x8c, 0x7f, 0xbd,
+  0x7b, 0xc0, 0xb1, 0xbd, 0x0c, 0x8f, 0x2d, 0x3d, 0x40, 0x92, 0xc8, 0x3d,
+  0x1f, 0x1f, 0x2f, 0xbe, 0x57, 0x20, 0xa1, 0x3c, 0xb1, 0xef, 0x16, 0xbe,
+  0x06, 0x57, 0xa6, 0xbe, 0x06, 0x7e, 0xa8, 0xbe, 0x7d, 0x45, 0x1b, 0x3e,
+  0xf6, 0xfa, 0x15, 0x3e, 0x0b, 0x90, 0x8d, 0xbe, 0x9e, 0x02, 0x92, 0xbe,
+  0xe7, 0x09, 0x7a, 0xbe, 0x59, 0x75, 0x0b, 0xbe, 0x6a, 0x56, 0xbe, 0x3d,
+  0x3a, 0x6e, 0x6f, 0x3f, 0x64, 0xfe, 0x11, 0x3f, 0xe9, 0x9f, 0xad, 0x3d,
+  0x6b, 0x0e, 0xa4, 0xbe, 0x78, 0x49, 0xa8, 0xbd, 0xb2, 0x87, 0x88, 0xbb,
+  0x22, 0x6e, 0x93, 0xbe, 0xd2, 0x20, 0xcc, 0x3c, 0x75, 0xc4, 0xa7, 0xbe,
+  0x4d, 0x3e, 0x4a, 0x3d, 0x2f, 0x99, 0x4c, 0xbe, 0x62, 0x9a, 0x35, 0x3e,
+  0xbd, 0x56, 0x5f, 0x3e, 0xc9, 0x60, 0x16, 0x3e, 0x6f, 0x4b, 0x31, 0x3e,
+  0x3a, 0xa1, 0x96, 0x3e, 0x7e, 0x48, 0xc6, 0x3d, 0x55, 0xe0, 0xd2, 0x3e,
+  0xe7, 0xbd, 0x03, 0xbe, 0xe5, 0x14, 0x3a, 0xbf, 0xd5, 0xea, 0xf6, 0xbe,
+  0x84, 0x86, 0x76, 0xbe, 0x1b, 0xd8, 0xb3, 0xbe, 0x5a, 0x97, 0xf8, 0x3d,
+  0x27, 0x7c, 0xdd, 0x3e, 0xab, 0xfc, 0x09, 0x3f, 0x4a, 0x48, 0xc2, 0x3e,
+  0xbc, 0xdf, 0xf5, 0x3e, 0x6c, 0x61, 0xea, 0x3d, 0x1a, 0xc1, 0x46, 0x3e,
+  0x30, 0xb2, 0xd3, 0x3e, 0xc4, 0x69, 0x26, 0xbe, 0x98, 0x76, 0x89, 0xbe,
+  0x0c, 0x84, 0xa5, 0x3e, 0xa7, 0x57, 0x35, 0x3e, 0x22, 0xe4, 0x13, 0x3e,
+  0x76, 0x3a, 0x48, 0x3e, 0xf2, 0xff, 0x1a, 0x3f, 0xed, 0xaf, 0x3c, 0x3e,
+  0x21, 0xd2, 0x41, 0x3e, 0x36, 0x5d, 0x4f, 0x3e, 0x26, 0x63, 0x6b, 0xbe,
+  0xa7, 0x60, 0x07, 0xbf, 0xde, 0x31, 0x84, 0xbe, 0x9a, 0xd9, 0xc2, 0x3d,
+  0x9e, 0x1e, 0xaa, 0xbb, 0xb8, 0xee, 0xe6, 0xb8, 0x98, 0xf8, 0x6a, 0x3e,
+  0x54, 0x87, 0x7b, 0x3e, 0x66, 0xd2, 0x25, 0xbd, 0xb3, 0xfd, 0x74, 0x3e,
+  0xad, 0x06, 0x8e, 0xbd, 0xf6, 0xa1, 0x82, 0xbe, 0xaf, 0x5f, 0x04, 0x3e,
+  0x57, 0x00, 0xcf, 0x3d, 0x1d, 0xfc, 0x52, 0x3e, 0x09, 0xf1, 0x8f, 0x3e,
+  0x39, 0x80, 0x0a, 0x3f, 0xb6, 0xa8, 0x85, 0x3d, 0x52, 0x94, 0xe1, 0xbd,
+  0x5f, 0x45, 0xde, 0xbe, 0x7a, 0xda, 0xb4, 0xbe, 0x57, 0x0f, 0x07, 0xbf,
+  0x7d, 0x34, 0x04, 0x3f, 0xb6, 0xc9, 0xbc, 0x3e, 0xad, 0x4e, 0xe3, 0xbd,
+  0xbc, 0xde, 0xbe, 0x3d, 0x97, 0xee, 0x72, 0x3d, 0xa9, 0xa4, 0x4f, 0x3e,
+  0x55, 0x2b, 0xac, 0x3e, 0xa0, 0x86, 0x42, 0xbd, 0x50, 0xa7, 0xe6, 0xbd,
+  0xa6, 0x1c, 0xd5, 0xbe, 0x76, 0x97, 0x8a, 0x3c, 0x3c, 0xfc, 0x4b, 0xbe,
+  0xbd, 0x16, 0x4a, 0xbe, 0xad, 0x9e, 0xf0, 0xbe, 0xae, 0xf3, 0xf6, 0xbd,
+  0x02, 0x73, 0xe0, 0xbd, 0xc3, 0x42, 0x79, 0xbd, 0x30, 0x7a, 0xeb, 0xbd,
+  0x46, 0x35, 0x51, 0xbe, 0x70, 0x6d, 0x10, 0xbd, 0x21, 0x75, 0x23, 0xbe,
+  0xf7, 0x6f, 0x2e, 0x3d, 0xed, 0xc9, 0x85, 0x3e, 0x14, 0xfa, 0xf3, 0xbd,
+  0x1d, 0xb7, 0x89, 0x3d, 0x3d, 0x78, 0x85, 0x3b, 0x18, 0xaa, 0x91, 0x3d,
+  0xe9, 0xbc, 0xc0, 0x3d, 0x0e, 0x10, 0x09, 0x3e, 0x66, 0x5f, 0x27, 0xbe,
+  0x49, 0x27, 0x40, 0x3d, 0x98, 0x01, 0xb2, 0x3e, 0x19, 0x56, 0x27, 0x3e,
+  0x6c, 0xef, 0x7c, 0x3e, 0xec, 0x3c, 0xf1, 0x3d, 0x9b, 0x5b, 0x09, 0xbe,
+  0x2a, 0xc2, 0x3d, 0xbe, 0xb3, 0x19, 0x62, 0xbe, 0xfd, 0xe7, 0xb9, 0xbe,
+  0x67, 0x1d, 0xf2, 0xbc, 0x47, 0x5f, 0x05, 0xbe, 0x2c, 0xf3, 0x80, 0x3e,
+  0xf9, 0xa4, 0x16, 0x3e, 0xa7, 0x7b, 0x2e, 0x3e, 0x5e, 0x68, 0xaf, 0xbc,
+  0x28, 0x40, 0xb7, 0x3d, 0x7d, 0xa4, 0x47, 0xbe, 0xd9, 0xf5, 0x7d, 0x3b,
+  0x11, 0xc1, 0xcd, 0x3e, 0xd9, 0x4c, 0x5a, 0x3e, 0x98, 0x0d, 0x84, 0x3e,
+  0x82, 0x18, 0x0e, 0xbf, 0x4f, 0xd8, 0xa6, 0xbe, 0xbc, 0x01, 0xb9, 0x3d,
+  0x5e, 0x1f, 0x16, 0xbe, 0x5e, 0xa6, 0x3e, 0xbf, 0x3a, 0x5f, 0x97, 0xbe,
+  0x28, 0xbc, 0x9d, 0xbd, 0x99, 0x74, 0x0a, 0x3d, 0x0f, 0x2d, 0x3c, 0xbe,
+  0xe5, 0x33, 0x55, 0x3e, 0x49, 0xb0, 0x5c, 0xbd, 0x86, 0x6e, 0xf1, 0x3d,
+  0xa5, 0xe2, 0x45, 0x3e, 0x94, 0x75, 0xcc, 0x3e, 0x35, 0xf5, 0xa9, 0x3d,
+  0xcc, 0x82, 0x5a, 0x3e, 0xb5, 0xda, 0x92, 0xbe, 0xea, 0x29, 0x1b, 0xbf,
+  0x06, 0x66, 0xa0, 0xbe, 0x43, 0x6e, 0x1e, 0xbd, 0x6c, 0xb2, 0x04, 0x3e,
+  0x61, 0x24, 0x0c, 0x3f, 0x05, 0x73, 0xd5, 0xbd, 0x52, 0xc7, 0xa7, 0xbe,
+  0x33, 0x1a, 0x29, 0xbd, 0xb5, 0xc9, 0xd7, 0xbd, 0xcd, 0xfc, 0x0a, 0xbf,
+  0x0a, 0x19, 0x8d, 0xbe, 0x9d, 0x2a, 0x46, 0xbd, 0x3a, 0x22, 0x09, 0x3f,
+  0x1b, 0xfb, 0x52, 0x3e, 0x7d, 0x3d, 0x95, 0x3e, 0x36, 0xae, 0x4f, 0x3e,
+  0x73, 0xf4, 0xa5, 0x3e, 0x35, 0x83, 0xe8, 0xbd, 0xaf, 0x79, 0xee, 0xbe,
+  0xa1, 0xa5, 0x58, 0xbe, 0xec, 0xf4, 0x36, 0x3d, 0xb8, 0x95, 0xf8, 0x3e,
+  0x33, 0x9d, 0x68, 0x3e, 0x6c, 0x46, 0xcd, 0x3e, 0x53, 0x43, 0x84, 0xbd,
+  0x70, 0x2e, 0xc0, 0xbe, 0x76, 0x3e, 0x55, 0xbf, 0x54, 0x61, 0x54, 0xbe,
+  0x1f, 0x7f, 0x8b, 0x3d, 0x1e, 0x40, 0x6b, 0x3e, 0xf6, 0xaa, 0x4f, 0x3e,
+  0x9d, 0x3a, 0xba, 0x3e, 0x51, 0x21, 0x56, 0x3e, 0xc1, 0x30, 0xc4, 0x3e,
+  0xda, 0x55, 0xf6, 0x3e, 0x42, 0x4d, 0xae, 0x3e, 0x30, 0x65, 0x2e, 0xbc,
+  0x15, 0xc7, 0x71, 0x3c, 0xc5, 0xbb, 0x71, 0x3e, 0x59, 0x69, 0x9e, 0x3e,
+  0xda, 0x5b, 0xb4, 0x3d, 0x46, 0x19, 0x9e, 0x3e, 0xbc, 0x28, 0x2a, 0x3f,
+  0xbf, 0x4a, 0xad, 0x3e, 0xfc, 0xbc, 0x9a, 0x3e, 0xb4, 0x2c, 0xd8, 0x3d,
+  0x14, 0x2d, 0x3e, 0xbe, 0x99, 0xc2, 0x6e, 0x3d, 0x83, 0x63, 0x10, 0xbe,
+  0x16, 0x8c, 0xf4, 0xbd, 0xee, 0xf6, 0x6a, 0x3d, 0x03, 0x37, 0x62, 0xbd,
+  0x92, 0xd1, 0x0a, 0x3e, 0x30, 0x5d, 0xc6, 0xbe, 0x59, 0xdd, 0x8f, 0xbe,
+  0xa0, 0xa6, 0xd0, 0xbe, 0xd8, 0x91, 0xe6, 0x3d, 0x89, 0x31, 0xd4, 0xbd,
+  0x84, 0x2e, 0x06, 0xbe, 0x32, 0x1f, 0x74, 0x3c, 0xe1, 0x7f, 0x98, 0xbe,
+  0xce, 0x32, 0x8c, 0xbe, 0xe8, 0x3c, 0x12, 0x3e, 0xad, 0x00, 0x67, 0xbd,
+  0x52, 0x5a, 0x34, 0x3d, 0xbc, 0x69, 0xf3, 0x3e, 0x80, 0xdc, 0xa5, 0xbd,
+  0x9a, 0xc3, 0x1e, 0x3f, 0xe8, 0x52, 0x4d, 0xbe, 0x62, 0xd2, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x08, 0x00, 0x00,
   0x38, 0x4f, 0xca, 0x3c, 0x3d, 0x4d, 0x7f, 0x3e, 0xff, 0xf8, 0x3a, 0x3e,
   0x2f, 0x5b, 0xac, 0x3d, 0xe3, 0xf5, 0xb2, 0x3e, 0xf3, 0xf1, 0x27, 0x3e,
   0xd9, 0xd0, 0x41, 0x3e, 0xe6, 0x91, 0x2d, 0x3e, 0x0e, 0x72, 0x10, 0x3f,
@@ -2479,226 +2481,228 @@ unsigned char trained_lstm_tflite[] = {
   0x3d, 0xe2, 0xb5, 0x3d, 0xe0, 0xe4, 0x06, 0x3e, 0xd4, 0xbf, 0x0c, 0x3e,
   0xa0, 0x20, 0x03, 0x3e, 0x94, 0xfe, 0xf1, 0x3d, 0x6f, 0x43, 0x1c, 0x3e,
   0x04, 0xe6, 0xa6, 0x3d, 0x36, 0xfb, 0xa9, 0xbc, 0x28, 0xc2, 0x10, 0xbe,
-  0x60, 0x4f, 0x9b, 0xbb, 0x94, 0x9a, 0x27, 0x3e, 0x6a, 0xdb, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0xc0, 0x08, 0x00, 0x00, 0x4f, 0x0c, 0x8a, 0xbd,
-  0x11, 0x2b, 0xed, 0x3e, 0xd8, 0x76, 0xf0, 0xbc, 0xc5, 0xfa, 0xf3, 0xbe,
-  0x5b, 0x83, 0xa9, 0xbe, 0xb6, 0xa0, 0x79, 0xbf, 0x8a, 0x0d, 0x9c, 0xbe,
-  0xad, 0x47, 0x1d, 0x3e, 0xb1, 0xea, 0xb9, 0x3e, 0x3e, 0x20, 0xb5, 0x3e,
-  0x1a, 0xa0, 0x04, 0x3f, 0x2e, 0xc2, 0x8e, 0x3e, 0x29, 0x20, 0x46, 0x3e,
-  0x41, 0xe4, 0x83, 0x3e, 0xf2, 0x3c, 0x9d, 0x3d, 0x18, 0x37, 0xe3, 0x3e,
-  0x43, 0xa6, 0x83, 0x3f, 0x46, 0x0c, 0xaf, 0x3f, 0x92, 0xd0, 0xa6, 0x3f,
-  0x4a, 0x39, 0x9d, 0x3f, 0x0b, 0xe3, 0x98, 0x3f, 0x17, 0x01, 0x97, 0x3f,
-  0x5e, 0xec, 0x42, 0x3f, 0x46, 0xf9, 0xba, 0x3e, 0xc0, 0x5c, 0xa4, 0x3e,
-  0x2e, 0xe0, 0xab, 0xbe, 0x0a, 0xb4, 0x4a, 0xbd, 0xe8, 0xf6, 0xdc, 0x3d,
-  0x69, 0x4f, 0x12, 0x3e, 0x63, 0x15, 0x7b, 0x3e, 0x5f, 0x4c, 0x81, 0xbe,
-  0xdd, 0x4f, 0xdb, 0xbc, 0x65, 0xe0, 0x0f, 0xbf, 0x43, 0xfd, 0x08, 0xbf,
-  0xbf, 0x8f, 0xab, 0xbe, 0x94, 0x5b, 0x43, 0xbe, 0xb6, 0x62, 0x13, 0x3e,
-  0xea, 0xd6, 0x2e, 0x3e, 0x94, 0x20, 0x8c, 0x3e, 0x80, 0x4a, 0x39, 0xbe,
-  0x63, 0xad, 0xd8, 0xbb, 0xc7, 0xfe, 0x34, 0x3d, 0x30, 0xbe, 0x19, 0x3e,
-  0xca, 0x97, 0x15, 0x3f, 0xad, 0x91, 0xdc, 0x3e, 0x1a, 0x98, 0x53, 0x3e,
-  0xaf, 0x48, 0xca, 0x3d, 0xef, 0x44, 0xc1, 0x3e, 0xed, 0x2e, 0xa5, 0x3e,
-  0xc4, 0xe6, 0x3a, 0x3e, 0x82, 0xcf, 0xda, 0x3e, 0x8d, 0xf2, 0x82, 0x3d,
-  0xb1, 0xa5, 0xdd, 0xbe, 0xe0, 0xee, 0x11, 0x3c, 0xe0, 0xf9, 0xca, 0x3e,
-  0xfb, 0xa9, 0xb0, 0x3e, 0x9b, 0xbf, 0x2a, 0xbb, 0xf8, 0x78, 0x94, 0x3e,
-  0x8b, 0x7b, 0x89, 0x3e, 0x9d, 0xff, 0xcf, 0x3e, 0xdc, 0x3b, 0x28, 0x3e,
-  0x25, 0x3a, 0x3f, 0x3e, 0x42, 0x34, 0x6b, 0xbe, 0x62, 0xb4, 0xa7, 0xbd,
-  0x04, 0xb9, 0x63, 0xbe, 0xd2, 0x83, 0x5c, 0xbd, 0x70, 0xfc, 0xe3, 0xbe,
-  0x68, 0x73, 0x32, 0xbd, 0x0b, 0x2f, 0xd7, 0xbe, 0xf7, 0x73, 0xfd, 0xbe,
-  0xb2, 0xe8, 0x6c, 0xbe, 0x70, 0x1b, 0x7b, 0xbe, 0x9c, 0xc8, 0xa9, 0xbd,
-  0x07, 0xc9, 0x8f, 0xbe, 0x3d, 0x29, 0x73, 0xbe, 0xe2, 0xb8, 0x64, 0xbd,
-  0x47, 0xfb, 0x78, 0xbe, 0x75, 0xb9, 0x70, 0xbe, 0xa3, 0x03, 0xab, 0x3c,
-  0x12, 0x22, 0x97, 0xbe, 0x64, 0x5a, 0x83, 0xbc, 0xec, 0x78, 0x2b, 0x3f,
-  0xad, 0x3b, 0x32, 0x3f, 0xc8, 0x4f, 0x5f, 0x3e, 0x20, 0x71, 0xfc, 0x3d,
-  0xc9, 0x56, 0x2e, 0xbe, 0x00, 0xa1, 0x81, 0xbe, 0x01, 0x66, 0xb1, 0xbb,
-  0x33, 0x4d, 0xdd, 0x3e, 0x48, 0x7a, 0x8d, 0x3e, 0x89, 0x1b, 0x11, 0x3e,
-  0x8a, 0x9f, 0x29, 0x3f, 0x4c, 0xb0, 0xbd, 0x3e, 0x26, 0x63, 0x72, 0xbe,
-  0xf5, 0x35, 0x54, 0xbe, 0xd9, 0xcc, 0x9d, 0xbd, 0xfe, 0x8c, 0x0d, 0x3f,
-  0x8b, 0x82, 0xf5, 0x3e, 0x87, 0x78, 0x23, 0x3f, 0x16, 0x85, 0x38, 0x3f,
-  0x97, 0x53, 0xb9, 0x3e, 0xfa, 0xfd, 0x51, 0x3f, 0x45, 0xea, 0x64, 0xbc,
-  0x82, 0x3b, 0x38, 0x3e, 0xff, 0x84, 0xee, 0xbb, 0x3c, 0x8c, 0xd8, 0x3e,
-  0x70, 0x17, 0xdf, 0x3e, 0xf7, 0xcd, 0x4a, 0x3f, 0x98, 0x49, 0xc4, 0x3e,
-  0x93, 0xb0, 0xcb, 0xbe, 0xc4, 0x2b, 0x97, 0x3e, 0xb9, 0x11, 0x32, 0xbe,
-  0xd4, 0x61, 0x1e, 0x3e, 0xf9, 0xdc, 0xe8, 0xbe, 0x7f, 0xd5, 0xb4, 0x3d,
-  0x19, 0x90, 0x72, 0x3d, 0xec, 0x0f, 0xff, 0xbe, 0x18, 0xad, 0xf9, 0xbe,
-  0x85, 0xaa, 0x1a, 0x3e, 0x35, 0x21, 0xf0, 0x3d, 0x0d, 0x07, 0x9e, 0x3e,
-  0x33, 0x2b, 0xe7, 0x3e, 0x7f, 0xea, 0x2d, 0x3f, 0xb7, 0x22, 0x81, 0x3f,
-  0x74, 0x09, 0x3d, 0x3f, 0xa2, 0x30, 0x1c, 0x3f, 0xb7, 0x52, 0x23, 0x3e,
-  0x47, 0x2a, 0xcc, 0x3b, 0xb7, 0x38, 0x3c, 0x3e, 0x6d, 0x08, 0x99, 0x3e,
-  0xfa, 0x96, 0xac, 0xbe, 0xc3, 0x79, 0x79, 0xbe, 0x5e, 0xdf, 0x75, 0x3e,
-  0x6d, 0x12, 0x56, 0xbd, 0x82, 0xf7, 0x22, 0xbc, 0xcd, 0x7c, 0x4c, 0xbf,
-  0xc6, 0x0e, 0x2d, 0xbe, 0x8a, 0x56, 0xc2, 0xbd, 0x32, 0x54, 0x45, 0x3e,
-  0x90, 0x20, 0xcc, 0x3e, 0x55, 0x05, 0xa8, 0xbd, 0x72, 0x6d, 0xcc, 0xbd,
-  0xe7, 0x58, 0xe1, 0x3e, 0x78, 0xc3, 0x73, 0x3f, 0x1f, 0xb8, 0x9a, 0x3e,
-  0x29, 0x3e, 0x15, 0x3e, 0x2e, 0x5d, 0x57, 0xbd, 0x7a, 0xea, 0xb3, 0xbe,
-  0x5d, 0xc5, 0x2c, 0xbf, 0xd6, 0x5a, 0xc4, 0xbe, 0x15, 0x52, 0xfa, 0xbe,
-  0x03, 0xb5, 0x9e, 0x3a, 0x14, 0xb6, 0x12, 0x3e, 0xf3, 0x55, 0xbc, 0x3e,
-  0xaf, 0x5b, 0xd3, 0x3e, 0x62, 0x59, 0xf5, 0x3e, 0x51, 0x68, 0x4a, 0x3f,
-  0x63, 0x08, 0x31, 0x3f, 0xdf, 0x3e, 0xe3, 0x3e, 0x46, 0x4f, 0x0a, 0x3e,
-  0xc4, 0xa5, 0xcf, 0x3e, 0xaf, 0x1a, 0xe8, 0x3e, 0x80, 0x7f, 0xdc, 0x3e,
-  0x01, 0x39, 0xc9, 0x3e, 0x2b, 0x91, 0x67, 0x3e, 0x6c, 0x51, 0xc8, 0xbd,
-  0x54, 0xe6, 0xaa, 0xbe, 0x64, 0x80, 0xfc, 0xbd, 0x23, 0x78, 0x12, 0x3c,
-  0x3e, 0x0f, 0xd3, 0x3e, 0x22, 0x1f, 0xb0, 0xbd, 0x3d, 0x40, 0x75, 0x3d,
-  0xc0, 0xae, 0x37, 0x3e, 0xd0, 0x12, 0x21, 0x3e, 0x03, 0x96, 0x56, 0xbd,
-  0x12, 0xcc, 0x14, 0x3f, 0xec, 0xa0, 0x2e, 0x3f, 0x70, 0x25, 0xfa, 0x3e,
-  0xa1, 0x24, 0xc2, 0x3e, 0x6a, 0x9c, 0x50, 0x3d, 0x86, 0x0e, 0xa3, 0xbe,
-  0xde, 0xcc, 0x24, 0x3f, 0xe6, 0x6e, 0x89, 0x3f, 0x99, 0xf3, 0x2f, 0x3f,
-  0x91, 0xe3, 0xa8, 0x3e, 0xa1, 0x42, 0xd6, 0x3b, 0x94, 0x0b, 0x98, 0xbe,
-  0x0f, 0x63, 0xdb, 0xbd, 0xe9, 0xda, 0x43, 0x3d, 0x70, 0x19, 0x70, 0x3e,
-  0xa6, 0x1f, 0xfc, 0x3d, 0x87, 0x22, 0xbb, 0xbe, 0xfb, 0x7c, 0x0c, 0xbf,
-  0x48, 0xab, 0x0b, 0x3e, 0x59, 0xb7, 0x21, 0x3f, 0x93, 0xf8, 0xd2, 0x3e,
-  0xfa, 0x29, 0xcb, 0x3d, 0xf2, 0xaf, 0xc3, 0x3d, 0xe7, 0xbc, 0x73, 0x3e,
-  0xcf, 0x16, 0xba, 0x3e, 0x18, 0x79, 0x89, 0x3e, 0x0e, 0xae, 0x49, 0xbd,
-  0xc1, 0x20, 0x92, 0xbe, 0xa9, 0xbd, 0x21, 0xbe, 0x76, 0x45, 0x04, 0xbf,
-  0x84, 0x4a, 0xaa, 0xbe, 0x0a, 0x66, 0x5e, 0xbe, 0x4a, 0xec, 0xa3, 0x3e,
-  0xe4, 0x6f, 0xa4, 0x3e, 0xa3, 0x69, 0xf7, 0x3e, 0x6a, 0xe9, 0xf5, 0x3e,
-  0x83, 0x6a, 0x81, 0x3e, 0x59, 0x2e, 0x00, 0xbd, 0x11, 0xd4, 0x4f, 0xbf,
-  0x77, 0x80, 0x26, 0xbf, 0x98, 0x30, 0x08, 0xbf, 0x14, 0x62, 0xc4, 0xbd,
-  0xcd, 0x8a, 0x24, 0xbe, 0xe2, 0x25, 0xa3, 0x3e, 0x3f, 0xcc, 0x9b, 0x3e,
-  0x5b, 0x10, 0xfc, 0x3e, 0xd4, 0x17, 0x23, 0x3f, 0x28, 0x78, 0x98, 0xbc,
-  0x13, 0xbc, 0x86, 0xbe, 0xac, 0x77, 0xfc, 0x3d, 0x43, 0xe0, 0xa0, 0x3d,
-  0x33, 0xcf, 0x24, 0x3e, 0x65, 0x7e, 0x09, 0x3f, 0x1f, 0x69, 0x09, 0x3f,
-  0xed, 0x86, 0x1a, 0x3f, 0xa5, 0x41, 0x73, 0x3e, 0xd3, 0xa7, 0xde, 0xbd,
-  0xda, 0x3e, 0xac, 0xbd, 0x99, 0x24, 0xe7, 0xbd, 0xb3, 0x5f, 0xf5, 0x3d,
-  0xb0, 0x3e, 0x6a, 0x3f, 0xc4, 0x24, 0x49, 0x3f, 0x45, 0xca, 0x1b, 0x3f,
-  0xca, 0x31, 0x88, 0x3e, 0x8a, 0x40, 0xdc, 0x3e, 0xa0, 0x49, 0x4d, 0x3d,
-  0x3c, 0x9b, 0x07, 0xbf, 0xe3, 0xd1, 0x55, 0x3d, 0xcc, 0x8c, 0xe2, 0x3e,
-  0xd1, 0xfb, 0x36, 0x3f, 0xf4, 0x78, 0x1d, 0x3f, 0xaf, 0xe7, 0xc6, 0x3e,
-  0xc7, 0xaa, 0x83, 0x3d, 0x21, 0x37, 0x58, 0x3f, 0x3b, 0x0a, 0xf0, 0x3e,
-  0x37, 0x9e, 0x17, 0x3f, 0x0c, 0xb7, 0xc6, 0xba, 0x22, 0x7a, 0xa3, 0x3e,
-  0x11, 0x56, 0x54, 0x3c, 0xe4, 0xb9, 0xad, 0xbe, 0x4e, 0x0f, 0x1b, 0xbf,
-  0x55, 0x30, 0x34, 0xbf, 0x8c, 0xa8, 0x28, 0xbf, 0x7b, 0x90, 0x1b, 0xbf,
-  0xa5, 0x9a, 0x10, 0xbf, 0x9a, 0xf0, 0x96, 0xbd, 0x03, 0xc1, 0x96, 0xbe,
-  0xa1, 0x9f, 0xa5, 0x3e, 0xc2, 0x36, 0xf6, 0x3e, 0x45, 0x2e, 0xf7, 0x3e,
-  0xb8, 0x39, 0x3f, 0x3f, 0x3d, 0x65, 0x39, 0x3f, 0x47, 0x17, 0xe9, 0xbc,
-  0x20, 0x1a, 0xb5, 0xbd, 0xf0, 0x80, 0x08, 0x3e, 0xc9, 0x52, 0x44, 0x3e,
-  0x59, 0xfb, 0xa4, 0x3e, 0x6c, 0x80, 0xa6, 0x3d, 0xf1, 0x04, 0x67, 0xbe,
-  0x6c, 0x1c, 0xb0, 0x3d, 0x6c, 0xaf, 0xc6, 0xbe, 0x7b, 0xd6, 0x1d, 0xbe,
-  0x52, 0xba, 0xe3, 0x3e, 0x8c, 0x25, 0x03, 0x3f, 0x9c, 0x18, 0x1e, 0x3f,
-  0xae, 0x81, 0x41, 0xbe, 0x29, 0x2c, 0x56, 0x3d, 0x59, 0x44, 0x97, 0xbe,
-  0x27, 0xa7, 0xcd, 0xbd, 0xc5, 0xd6, 0x06, 0x3f, 0x90, 0x19, 0x1f, 0x3c,
-  0x6a, 0x19, 0x8f, 0x3d, 0x1b, 0x63, 0xca, 0x3e, 0x29, 0x9d, 0xa4, 0x3e,
-  0x20, 0x54, 0xa5, 0x3e, 0x15, 0x6e, 0x59, 0xba, 0xb7, 0xfe, 0xd7, 0x3c,
-  0x7d, 0x11, 0xf6, 0xbd, 0x4a, 0xc9, 0x19, 0x3e, 0x75, 0xf3, 0x87, 0x3e,
-  0xe1, 0x76, 0xba, 0x3e, 0x69, 0x71, 0xa7, 0x3c, 0xb9, 0x00, 0x9b, 0xbe,
-  0x44, 0x83, 0x7f, 0xbe, 0x0b, 0x74, 0x60, 0x3b, 0xca, 0xc7, 0xd2, 0x3e,
-  0x79, 0x9d, 0x83, 0x3e, 0xf0, 0x14, 0xc8, 0xbd, 0x4b, 0xa6, 0x0f, 0x3e,
-  0x0d, 0xde, 0x08, 0xbe, 0x16, 0x8c, 0x12, 0xbd, 0xf6, 0xe2, 0x0e, 0x3e,
-  0x13, 0x39, 0x45, 0x3e, 0x7a, 0x8a, 0x62, 0x3d, 0x5f, 0x3e, 0x97, 0x3e,
-  0x2b, 0x0e, 0xdb, 0x3e, 0x7d, 0x94, 0xd0, 0x3e, 0xe7, 0x24, 0xfd, 0x3e,
-  0x91, 0x24, 0x19, 0x3e, 0xf2, 0x91, 0x12, 0xbc, 0x87, 0xc9, 0x61, 0xbe,
-  0x71, 0x69, 0x6b, 0xbe, 0x53, 0xf6, 0xc5, 0xbd, 0xd5, 0x1e, 0x1b, 0x3d,
-  0xb6, 0x61, 0x33, 0xbe, 0x8a, 0xe8, 0xa6, 0xbe, 0xd7, 0x89, 0x34, 0xbe,
-  0xbc, 0xe6, 0x5d, 0x3e, 0x17, 0x57, 0x24, 0x3f, 0x8f, 0xe9, 0xad, 0x3f,
-  0xc0, 0x41, 0x5a, 0x3f, 0x93, 0xe0, 0xae, 0x3c, 0x3e, 0x88, 0x2f, 0xbe,
-  0xb6, 0x23, 0x56, 0xbe, 0x8e, 0xa1, 0xbe, 0xbe, 0xc0, 0xc1, 0x6a, 0xbe,
-  0xc5, 0x89, 0x82, 0xbe, 0x4a, 0x3b, 0x0d, 0xbe, 0xc3, 0x74, 0x89, 0xbe,
-  0x5c, 0x96, 0x92, 0xbc, 0x4a, 0x40, 0x9b, 0xbe, 0x66, 0x56, 0xdc, 0x3e,
-  0x8f, 0x30, 0xb0, 0xbd, 0xc2, 0x30, 0x8a, 0xbe, 0xf0, 0x74, 0xdb, 0xbe,
-  0xa3, 0x7d, 0xb0, 0xbe, 0x76, 0x33, 0x8a, 0xbe, 0x70, 0x40, 0x6c, 0x3e,
-  0xe8, 0xc0, 0x03, 0x3e, 0x2f, 0x61, 0xe7, 0xbd, 0xa1, 0x4c, 0xc5, 0xbe,
-  0x86, 0xf8, 0x9a, 0xbe, 0xe5, 0xd0, 0x1e, 0x3e, 0x18, 0x15, 0x20, 0x3d,
-  0xe5, 0x70, 0x09, 0x3e, 0xe7, 0x8b, 0x9d, 0x3c, 0xab, 0x9a, 0xd3, 0x3d,
-  0x47, 0xea, 0x13, 0x3f, 0x9b, 0x92, 0x36, 0x3f, 0xb6, 0xf4, 0x8c, 0x3e,
-  0x7b, 0xd7, 0x05, 0xbf, 0x90, 0x42, 0x2f, 0xbf, 0x95, 0xae, 0x11, 0xbf,
-  0x6d, 0x45, 0x93, 0x3c, 0xa8, 0x8c, 0x03, 0x3e, 0xa5, 0x8c, 0x4d, 0x3c,
-  0xe5, 0x12, 0x90, 0xbc, 0xb3, 0x9e, 0xaa, 0xbe, 0x1e, 0xf0, 0x94, 0xbe,
-  0xad, 0x67, 0x9b, 0xbe, 0x05, 0x05, 0x65, 0xbd, 0x3c, 0x5e, 0xd5, 0xbd,
-  0x84, 0xc5, 0xfa, 0x3d, 0x44, 0x5d, 0x0d, 0xbf, 0xed, 0xe7, 0x30, 0xbf,
-  0x17, 0x7f, 0x36, 0xbe, 0x66, 0x2f, 0x9f, 0xbe, 0xca, 0x69, 0x4a, 0x3e,
-  0x1c, 0xff, 0x46, 0x3d, 0xfb, 0xb8, 0xf2, 0x3e, 0xc7, 0xc8, 0x41, 0x3f,
-  0x52, 0x5f, 0x4a, 0x3f, 0x1a, 0xa8, 0xb0, 0x3e, 0xe3, 0x4c, 0x62, 0xbe,
-  0x5d, 0xa2, 0x8d, 0xbd, 0xac, 0x70, 0x5f, 0x3e, 0x08, 0x6e, 0x43, 0x3e,
-  0x88, 0xb7, 0x22, 0x3f, 0x50, 0x94, 0xad, 0x3e, 0x87, 0x0e, 0x30, 0x3f,
-  0x51, 0x3c, 0x8f, 0x3f, 0x32, 0xf2, 0xa0, 0x3f, 0xbb, 0xbc, 0x9c, 0x3f,
-  0xf0, 0x0b, 0xb2, 0x3d, 0x55, 0xbe, 0x78, 0xbe, 0x3a, 0xb6, 0x2d, 0x3e,
-  0xb5, 0x1b, 0x32, 0x3f, 0x32, 0xc3, 0x15, 0xbe, 0x1d, 0x0d, 0x25, 0xbe,
-  0x44, 0x64, 0x1c, 0xbe, 0x6b, 0x99, 0x4f, 0x3f, 0xf6, 0x77, 0x82, 0x3f,
-  0x39, 0xee, 0x2c, 0x3f, 0x04, 0x9c, 0x56, 0x3f, 0xf0, 0x74, 0xbf, 0x3f,
-  0xc8, 0x9e, 0xbd, 0x3f, 0x33, 0xab, 0x80, 0x3f, 0xfd, 0x7d, 0x72, 0x3e,
-  0xd4, 0x3b, 0x37, 0x3e, 0x61, 0x11, 0x2f, 0xbb, 0x5f, 0x2f, 0x1d, 0xbe,
-  0x27, 0x47, 0xa7, 0x3d, 0xee, 0xd7, 0xc6, 0xbe, 0x6c, 0x68, 0xe1, 0xbd,
-  0x19, 0xdf, 0x3e, 0xbd, 0xc0, 0x22, 0xed, 0x3d, 0xe4, 0xe6, 0x2c, 0x3e,
-  0xcc, 0x90, 0x43, 0xbb, 0x20, 0xc2, 0x2c, 0xbc, 0x42, 0x9c, 0xb2, 0x3e,
-  0xe8, 0x07, 0x8b, 0x3d, 0xd3, 0xeb, 0x99, 0x3d, 0xab, 0x16, 0x2b, 0x3d,
-  0x03, 0x79, 0xe0, 0x3d, 0x55, 0x4e, 0xb2, 0x3e, 0xfc, 0xfb, 0x59, 0x3e,
-  0x67, 0x67, 0xe6, 0x3e, 0xf4, 0xc9, 0x23, 0x3e, 0x57, 0x58, 0x68, 0x3e,
-  0x7f, 0xe3, 0x9b, 0xbd, 0x58, 0xa2, 0x7b, 0xbe, 0x77, 0x70, 0xce, 0xbe,
-  0x9e, 0xa3, 0xbc, 0xbe, 0x36, 0x97, 0xc9, 0xbe, 0x69, 0xb9, 0x6d, 0xbc,
-  0x94, 0x29, 0x47, 0x3d, 0x41, 0x41, 0x8f, 0x3e, 0x5a, 0x4d, 0xca, 0xbc,
-  0x2e, 0xce, 0x67, 0xbd, 0x7f, 0xf6, 0x42, 0x3c, 0x7d, 0x60, 0xbf, 0xbd,
-  0x69, 0x29, 0xad, 0x3e, 0x43, 0x71, 0x39, 0xbc, 0x7c, 0x58, 0xe1, 0xbb,
-  0xeb, 0xb0, 0xef, 0x3e, 0x1e, 0xd0, 0x3f, 0x3b, 0x05, 0x4b, 0x40, 0x3e,
-  0xa7, 0xc1, 0xce, 0x3e, 0xa1, 0x03, 0x1d, 0x3f, 0xde, 0x5c, 0xa5, 0x3e,
-  0xd4, 0x92, 0xf5, 0x3e, 0x07, 0x36, 0x89, 0x3e, 0xcd, 0x0a, 0x0a, 0x3e,
-  0x08, 0x5e, 0x41, 0x3e, 0xc2, 0xb0, 0x3d, 0x3e, 0x78, 0x1b, 0x0b, 0xbc,
-  0xfc, 0x26, 0x55, 0x3f, 0x66, 0xd4, 0x4c, 0x3d, 0x32, 0xcc, 0xd3, 0x3e,
-  0xb5, 0x13, 0x08, 0x3f, 0xc5, 0x23, 0x4d, 0x3f, 0xb9, 0xce, 0x94, 0x3f,
-  0x19, 0xbd, 0xa5, 0x3f, 0x58, 0x43, 0x23, 0x3f, 0x54, 0x92, 0x30, 0x3f,
-  0x11, 0x00, 0x82, 0x3e, 0xf0, 0x23, 0xe6, 0x3e, 0x1f, 0x35, 0x33, 0x3d,
-  0x9e, 0x16, 0x8f, 0xbe, 0xc4, 0x9d, 0xb6, 0x3d, 0x8b, 0xd1, 0xc0, 0xbd,
-  0xe0, 0x97, 0x4f, 0x3b, 0x21, 0x38, 0xb9, 0x3e, 0x84, 0x6e, 0x84, 0x3e,
-  0xb2, 0x7d, 0xfe, 0x3d, 0xf4, 0xb5, 0x12, 0x3e, 0xe7, 0xc2, 0x51, 0x3e,
-  0x67, 0x9f, 0x83, 0x3e, 0x6f, 0x73, 0x25, 0x3f, 0x02, 0x14, 0xd9, 0xbd,
-  0x45, 0xf5, 0xe0, 0x3d, 0x56, 0xec, 0xf4, 0x3d, 0x39, 0x91, 0xa0, 0x3d,
-  0x5c, 0x8c, 0x69, 0xbe, 0xbe, 0x91, 0xf7, 0xbd, 0xda, 0x28, 0x5c, 0xbe,
-  0x12, 0x27, 0x37, 0xbf, 0x44, 0x24, 0x03, 0xbf, 0x93, 0xd1, 0xa9, 0xbe,
-  0xfc, 0x6f, 0x8a, 0xbe, 0x39, 0x3c, 0x0a, 0x3e, 0x6d, 0xb5, 0xfa, 0x3e,
-  0xdb, 0x5d, 0x86, 0x3f, 0x08, 0xcd, 0x8f, 0x3f, 0x9e, 0x41, 0x86, 0x3f,
-  0x27, 0x46, 0xe4, 0x3e, 0xbc, 0x64, 0x01, 0x3e, 0xeb, 0xcb, 0x3e, 0xbe,
-  0x03, 0x2b, 0x4e, 0x3e, 0x20, 0xab, 0xd7, 0x3b, 0x32, 0x59, 0xcc, 0xbc,
-  0x78, 0x75, 0x84, 0xbe, 0xeb, 0xfe, 0x85, 0xbe, 0x7d, 0x87, 0x05, 0xbd,
-  0x3a, 0x48, 0x62, 0xbe, 0xad, 0xa7, 0x48, 0xbe, 0xf2, 0x40, 0xfb, 0xbd,
-  0x2e, 0x75, 0x0e, 0x3f, 0xef, 0x6b, 0x14, 0x3f, 0x69, 0x06, 0x3a, 0xbe,
-  0x89, 0xc7, 0x7d, 0xbd, 0x8a, 0xe4, 0xa7, 0x3d, 0x08, 0x2d, 0xdd, 0xbd,
-  0x6f, 0x71, 0x49, 0xbe, 0xff, 0x7c, 0xaa, 0xbe, 0xb4, 0x30, 0x26, 0xbe,
-  0x30, 0x5f, 0xb8, 0x3e, 0x4f, 0xa6, 0x98, 0x3f, 0x56, 0x9d, 0x3c, 0x3f,
-  0x89, 0xd2, 0x05, 0x3f, 0x1e, 0x3a, 0xcd, 0x3e, 0x53, 0x22, 0x8c, 0xbd,
-  0xe2, 0x08, 0xb0, 0xbe, 0x8c, 0xaa, 0x9c, 0xbe, 0xa4, 0xc2, 0xa0, 0xbd,
-  0x58, 0xfc, 0xc9, 0x3e, 0x4a, 0x1b, 0x28, 0x3f, 0x78, 0xb9, 0xf5, 0x3e,
-  0x0a, 0x52, 0x7b, 0x3e, 0xc6, 0xc0, 0xe2, 0x3d, 0x36, 0x87, 0x3a, 0xbe,
-  0x79, 0xfa, 0xe3, 0xbe, 0xea, 0x6a, 0x59, 0xbf, 0x7c, 0xd6, 0x31, 0xbf,
-  0x3c, 0xc9, 0x06, 0xbf, 0x16, 0x34, 0xac, 0xbc, 0x6f, 0x3b, 0xc2, 0x3e,
-  0x7a, 0xa7, 0x1e, 0x3d, 0x7e, 0xad, 0xb5, 0xbd, 0xcd, 0x1a, 0xdf, 0xbd,
-  0xa9, 0xcf, 0x16, 0xbe, 0x45, 0x52, 0x7a, 0xbe, 0xfa, 0xbd, 0x0f, 0xbe,
-  0xee, 0x58, 0xca, 0xbd, 0xe3, 0xe6, 0x43, 0x3d, 0x15, 0xf2, 0x24, 0x3e,
-  0xc4, 0x24, 0x6f, 0x3e, 0x0a, 0xdc, 0x31, 0x3e, 0xe8, 0x77, 0x05, 0x3f,
-  0x6a, 0x25, 0x41, 0x3e, 0xa9, 0xa6, 0xb3, 0x3e, 0x97, 0x33, 0xfd, 0x3e,
-  0x64, 0x05, 0x26, 0x3f, 0xd1, 0xa5, 0x3a, 0x3f, 0x33, 0x42, 0x8a, 0x3e,
-  0xed, 0x7e, 0xc9, 0xbd, 0xa6, 0x6a, 0x57, 0x3e, 0x18, 0x6d, 0x22, 0x3e,
-  0xf3, 0xd6, 0xd1, 0x3d, 0x4e, 0xbc, 0xb6, 0x3c, 0xbe, 0xfe, 0x60, 0xbd,
-  0x17, 0x55, 0xa9, 0x3e, 0x4b, 0xf3, 0xa1, 0x3e, 0x6f, 0x7f, 0xa7, 0x3d,
-  0xc0, 0x44, 0x11, 0xbc, 0x36, 0xe4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x50, 0x00, 0x00, 0x00, 0xa8, 0x06, 0x2a, 0x3e, 0xa4, 0xaf, 0x9f, 0xbd,
-  0x22, 0x2b, 0x6a, 0x3f, 0xa4, 0x14, 0x88, 0x3b, 0xc3, 0xf4, 0xba, 0x3d,
-  0x25, 0x9b, 0x92, 0xbd, 0xeb, 0x80, 0xc6, 0x3c, 0x90, 0xe7, 0x90, 0x3e,
-  0xb5, 0xae, 0xe1, 0x3e, 0x21, 0x9b, 0x99, 0x3e, 0x2c, 0x6e, 0x7e, 0x3d,
-  0x55, 0xa8, 0x67, 0xbe, 0x69, 0x83, 0xba, 0x3e, 0x1e, 0xf6, 0x80, 0x3e,
-  0x53, 0xe0, 0xad, 0x3e, 0x92, 0xdc, 0x4e, 0x3f, 0xbf, 0x9f, 0xa4, 0x3e,
-  0x15, 0x7a, 0x6f, 0x3d, 0xbb, 0x30, 0xae, 0x3e, 0x83, 0xab, 0xe3, 0xbe,
-  0x92, 0xe4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x60, 0x4f, 0x9b, 0xbb, 0x94, 0x9a, 0x27, 0x3e, 0x32, 0xdb, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x08, 0x00, 0x00,
+  0x4f, 0x0c, 0x8a, 0xbd, 0x11, 0x2b, 0xed, 0x3e, 0xd8, 0x76, 0xf0, 0xbc,
+  0xc5, 0xfa, 0xf3, 0xbe, 0x5b, 0x83, 0xa9, 0xbe, 0xb6, 0xa0, 0x79, 0xbf,
+  0x8a, 0x0d, 0x9c, 0xbe, 0xad, 0x47, 0x1d, 0x3e, 0xb1, 0xea, 0xb9, 0x3e,
+  0x3e, 0x20, 0xb5, 0x3e, 0x1a, 0xa0, 0x04, 0x3f, 0x2e, 0xc2, 0x8e, 0x3e,
+  0x29, 0x20, 0x46, 0x3e, 0x41, 0xe4, 0x83, 0x3e, 0xf2, 0x3c, 0x9d, 0x3d,
+  0x18, 0x37, 0xe3, 0x3e, 0x43, 0xa6, 0x83, 0x3f, 0x46, 0x0c, 0xaf, 0x3f,
+  0x92, 0xd0, 0xa6, 0x3f, 0x4a, 0x39, 0x9d, 0x3f, 0x0b, 0xe3, 0x98, 0x3f,
+  0x17, 0x01, 0x97, 0x3f, 0x5e, 0xec, 0x42, 0x3f, 0x46, 0xf9, 0xba, 0x3e,
+  0xc0, 0x5c, 0xa4, 0x3e, 0x2e, 0xe0, 0xab, 0xbe, 0x0a, 0xb4, 0x4a, 0xbd,
+  0xe8, 0xf6, 0xdc, 0x3d, 0x69, 0x4f, 0x12, 0x3e, 0x63, 0x15, 0x7b, 0x3e,
+  0x5f, 0x4c, 0x81, 0xbe, 0xdd, 0x4f, 0xdb, 0xbc, 0x65, 0xe0, 0x0f, 0xbf,
+  0x43, 0xfd, 0x08, 0xbf, 0xbf, 0x8f, 0xab, 0xbe, 0x94, 0x5b, 0x43, 0xbe,
+  0xb6, 0x62, 0x13, 0x3e, 0xea, 0xd6, 0x2e, 0x3e, 0x94, 0x20, 0x8c, 0x3e,
+  0x80, 0x4a, 0x39, 0xbe, 0x63, 0xad, 0xd8, 0xbb, 0xc7, 0xfe, 0x34, 0x3d,
+  0x30, 0xbe, 0x19, 0x3e, 0xca, 0x97, 0x15, 0x3f, 0xad, 0x91, 0xdc, 0x3e,
+  0x1a, 0x98, 0x53, 0x3e, 0xaf, 0x48, 0xca, 0x3d, 0xef, 0x44, 0xc1, 0x3e,
+  0xed, 0x2e, 0xa5, 0x3e, 0xc4, 0xe6, 0x3a, 0x3e, 0x82, 0xcf, 0xda, 0x3e,
+  0x8d, 0xf2, 0x82, 0x3d, 0xb1, 0xa5, 0xdd, 0xbe, 0xe0, 0xee, 0x11, 0x3c,
+  0xe0, 0xf9, 0xca, 0x3e, 0xfb, 0xa9, 0xb0, 0x3e, 0x9b, 0xbf, 0x2a, 0xbb,
+  0xf8, 0x78, 0x94, 0x3e, 0x8b, 0x7b, 0x89, 0x3e, 0x9d, 0xff, 0xcf, 0x3e,
+  0xdc, 0x3b, 0x28, 0x3e, 0x25, 0x3a, 0x3f, 0x3e, 0x42, 0x34, 0x6b, 0xbe,
+  0x62, 0xb4, 0xa7, 0xbd, 0x04, 0xb9, 0x63, 0xbe, 0xd2, 0x83, 0x5c, 0xbd,
+  0x70, 0xfc, 0xe3, 0xbe, 0x68, 0x73, 0x32, 0xbd, 0x0b, 0x2f, 0xd7, 0xbe,
+  0xf7, 0x73, 0xfd, 0xbe, 0xb2, 0xe8, 0x6c, 0xbe, 0x70, 0x1b, 0x7b, 0xbe,
+  0x9c, 0xc8, 0xa9, 0xbd, 0x07, 0xc9, 0x8f, 0xbe, 0x3d, 0x29, 0x73, 0xbe,
+  0xe2, 0xb8, 0x64, 0xbd, 0x47, 0xfb, 0x78, 0xbe, 0x75, 0xb9, 0x70, 0xbe,
+  0xa3, 0x03, 0xab, 0x3c, 0x12, 0x22, 0x97, 0xbe, 0x64, 0x5a, 0x83, 0xbc,
+  0xec, 0x78, 0x2b, 0x3f, 0xad, 0x3b, 0x32, 0x3f, 0xc8, 0x4f, 0x5f, 0x3e,
+  0x20, 0x71, 0xfc, 0x3d, 0xc9, 0x56, 0x2e, 0xbe, 0x00, 0xa1, 0x81, 0xbe,
+  0x01, 0x66, 0xb1, 0xbb, 0x33, 0x4d, 0xdd, 0x3e, 0x48, 0x7a, 0x8d, 0x3e,
+  0x89, 0x1b, 0x11, 0x3e, 0x8a, 0x9f, 0x29, 0x3f, 0x4c, 0xb0, 0xbd, 0x3e,
+  0x26, 0x63, 0x72, 0xbe, 0xf5, 0x35, 0x54, 0xbe, 0xd9, 0xcc, 0x9d, 0xbd,
+  0xfe, 0x8c, 0x0d, 0x3f, 0x8b, 0x82, 0xf5, 0x3e, 0x87, 0x78, 0x23, 0x3f,
+  0x16, 0x85, 0x38, 0x3f, 0x97, 0x53, 0xb9, 0x3e, 0xfa, 0xfd, 0x51, 0x3f,
+  0x45, 0xea, 0x64, 0xbc, 0x82, 0x3b, 0x38, 0x3e, 0xff, 0x84, 0xee, 0xbb,
+  0x3c, 0x8c, 0xd8, 0x3e, 0x70, 0x17, 0xdf, 0x3e, 0xf7, 0xcd, 0x4a, 0x3f,
+  0x98, 0x49, 0xc4, 0x3e, 0x93, 0xb0, 0xcb, 0xbe, 0xc4, 0x2b, 0x97, 0x3e,
+  0xb9, 0x11, 0x32, 0xbe, 0xd4, 0x61, 0x1e, 0x3e, 0xf9, 0xdc, 0xe8, 0xbe,
+  0x7f, 0xd5, 0xb4, 0x3d, 0x19, 0x90, 0x72, 0x3d, 0xec, 0x0f, 0xff, 0xbe,
+  0x18, 0xad, 0xf9, 0xbe, 0x85, 0xaa, 0x1a, 0x3e, 0x35, 0x21, 0xf0, 0x3d,
+  0x0d, 0x07, 0x9e, 0x3e, 0x33, 0x2b, 0xe7, 0x3e, 0x7f, 0xea, 0x2d, 0x3f,
+  0xb7, 0x22, 0x81, 0x3f, 0x74, 0x09, 0x3d, 0x3f, 0xa2, 0x30, 0x1c, 0x3f,
+  0xb7, 0x52, 0x23, 0x3e, 0x47, 0x2a, 0xcc, 0x3b, 0xb7, 0x38, 0x3c, 0x3e,
+  0x6d, 0x08, 0x99, 0x3e, 0xfa, 0x96, 0xac, 0xbe, 0xc3, 0x79, 0x79, 0xbe,
+  0x5e, 0xdf, 0x75, 0x3e, 0x6d, 0x12, 0x56, 0xbd, 0x82, 0xf7, 0x22, 0xbc,
+  0xcd, 0x7c, 0x4c, 0xbf, 0xc6, 0x0e, 0x2d, 0xbe, 0x8a, 0x56, 0xc2, 0xbd,
+  0x32, 0x54, 0x45, 0x3e, 0x90, 0x20, 0xcc, 0x3e, 0x55, 0x05, 0xa8, 0xbd,
+  0x72, 0x6d, 0xcc, 0xbd, 0xe7, 0x58, 0xe1, 0x3e, 0x78, 0xc3, 0x73, 0x3f,
+  0x1f, 0xb8, 0x9a, 0x3e, 0x29, 0x3e, 0x15, 0x3e, 0x2e, 0x5d, 0x57, 0xbd,
+  0x7a, 0xea, 0xb3, 0xbe, 0x5d, 0xc5, 0x2c, 0xbf, 0xd6, 0x5a, 0xc4, 0xbe,
+  0x15, 0x52, 0xfa, 0xbe, 0x03, 0xb5, 0x9e, 0x3a, 0x14, 0xb6, 0x12, 0x3e,
+  0xf3, 0x55, 0xbc, 0x3e, 0xaf, 0x5b, 0xd3, 0x3e, 0x62, 0x59, 0xf5, 0x3e,
+  0x51, 0x68, 0x4a, 0x3f, 0x63, 0x08, 0x31, 0x3f, 0xdf, 0x3e, 0xe3, 0x3e,
+  0x46, 0x4f, 0x0a, 0x3e, 0xc4, 0xa5, 0xcf, 0x3e, 0xaf, 0x1a, 0xe8, 0x3e,
+  0x80, 0x7f, 0xdc, 0x3e, 0x01, 0x39, 0xc9, 0x3e, 0x2b, 0x91, 0x67, 0x3e,
+  0x6c, 0x51, 0xc8, 0xbd, 0x54, 0xe6, 0xaa, 0xbe, 0x64, 0x80, 0xfc, 0xbd,
+  0x23, 0x78, 0x12, 0x3c, 0x3e, 0x0f, 0xd3, 0x3e, 0x22, 0x1f, 0xb0, 0xbd,
+  0x3d, 0x40, 0x75, 0x3d, 0xc0, 0xae, 0x37, 0x3e, 0xd0, 0x12, 0x21, 0x3e,
+  0x03, 0x96, 0x56, 0xbd, 0x12, 0xcc, 0x14, 0x3f, 0xec, 0xa0, 0x2e, 0x3f,
+  0x70, 0x25, 0xfa, 0x3e, 0xa1, 0x24, 0xc2, 0x3e, 0x6a, 0x9c, 0x50, 0x3d,
+  0x86, 0x0e, 0xa3, 0xbe, 0xde, 0xcc, 0x24, 0x3f, 0xe6, 0x6e, 0x89, 0x3f,
+  0x99, 0xf3, 0x2f, 0x3f, 0x91, 0xe3, 0xa8, 0x3e, 0xa1, 0x42, 0xd6, 0x3b,
+  0x94, 0x0b, 0x98, 0xbe, 0x0f, 0x63, 0xdb, 0xbd, 0xe9, 0xda, 0x43, 0x3d,
+  0x70, 0x19, 0x70, 0x3e, 0xa6, 0x1f, 0xfc, 0x3d, 0x87, 0x22, 0xbb, 0xbe,
+  0xfb, 0x7c, 0x0c, 0xbf, 0x48, 0xab, 0x0b, 0x3e, 0x59, 0xb7, 0x21, 0x3f,
+  0x93, 0xf8, 0xd2, 0x3e, 0xfa, 0x29, 0xcb, 0x3d, 0xf2, 0xaf, 0xc3, 0x3d,
+  0xe7, 0xbc, 0x73, 0x3e, 0xcf, 0x16, 0xba, 0x3e, 0x18, 0x79, 0x89, 0x3e,
+  0x0e, 0xae, 0x49, 0xbd, 0xc1, 0x20, 0x92, 0xbe, 0xa9, 0xbd, 0x21, 0xbe,
+  0x76, 0x45, 0x04, 0xbf, 0x84, 0x4a, 0xaa, 0xbe, 0x0a, 0x66, 0x5e, 0xbe,
+  0x4a, 0xec, 0xa3, 0x3e, 0xe4, 0x6f, 0xa4, 0x3e, 0xa3, 0x69, 0xf7, 0x3e,
+  0x6a, 0xe9, 0xf5, 0x3e, 0x83, 0x6a, 0x81, 0x3e, 0x59, 0x2e, 0x00, 0xbd,
+  0x11, 0xd4, 0x4f, 0xbf, 0x77, 0x80, 0x26, 0xbf, 0x98, 0x30, 0x08, 0xbf,
+  0x14, 0x62, 0xc4, 0xbd, 0xcd, 0x8a, 0x24, 0xbe, 0xe2, 0x25, 0xa3, 0x3e,
+  0x3f, 0xcc, 0x9b, 0x3e, 0x5b, 0x10, 0xfc, 0x3e, 0xd4, 0x17, 0x23, 0x3f,
+  0x28, 0x78, 0x98, 0xbc, 0x13, 0xbc, 0x86, 0xbe, 0xac, 0x77, 0xfc, 0x3d,
+  0x43, 0xe0, 0xa0, 0x3d, 0x33, 0xcf, 0x24, 0x3e, 0x65, 0x7e, 0x09, 0x3f,
+  0x1f, 0x69, 0x09, 0x3f, 0xed, 0x86, 0x1a, 0x3f, 0xa5, 0x41, 0x73, 0x3e,
+  0xd3, 0xa7, 0xde, 0xbd, 0xda, 0x3e, 0xac, 0xbd, 0x99, 0x24, 0xe7, 0xbd,
+  0xb3, 0x5f, 0xf5, 0x3d, 0xb0, 0x3e, 0x6a, 0x3f, 0xc4, 0x24, 0x49, 0x3f,
+  0x45, 0xca, 0x1b, 0x3f, 0xca, 0x31, 0x88, 0x3e, 0x8a, 0x40, 0xdc, 0x3e,
+  0xa0, 0x49, 0x4d, 0x3d, 0x3c, 0x9b, 0x07, 0xbf, 0xe3, 0xd1, 0x55, 0x3d,
+  0xcc, 0x8c, 0xe2, 0x3e, 0xd1, 0xfb, 0x36, 0x3f, 0xf4, 0x78, 0x1d, 0x3f,
+  0xaf, 0xe7, 0xc6, 0x3e, 0xc7, 0xaa, 0x83, 0x3d, 0x21, 0x37, 0x58, 0x3f,
+  0x3b, 0x0a, 0xf0, 0x3e, 0x37, 0x9e, 0x17, 0x3f, 0x0c, 0xb7, 0xc6, 0xba,
+  0x22, 0x7a, 0xa3, 0x3e, 0x11, 0x56, 0x54, 0x3c, 0xe4, 0xb9, 0xad, 0xbe,
+  0x4e, 0x0f, 0x1b, 0xbf, 0x55, 0x30, 0x34, 0xbf, 0x8c, 0xa8, 0x28, 0xbf,
+  0x7b, 0x90, 0x1b, 0xbf, 0xa5, 0x9a, 0x10, 0xbf, 0x9a, 0xf0, 0x96, 0xbd,
+  0x03, 0xc1, 0x96, 0xbe, 0xa1, 0x9f, 0xa5, 0x3e, 0xc2, 0x36, 0xf6, 0x3e,
+  0x45, 0x2e, 0xf7, 0x3e, 0xb8, 0x39, 0x3f, 0x3f, 0x3d, 0x65, 0x39, 0x3f,
+  0x47, 0x17, 0xe9, 0xbc, 0x20, 0x1a, 0xb5, 0xbd, 0xf0, 0x80, 0x08, 0x3e,
+  0xc9, 0x52, 0x44, 0x3e, 0x59, 0xfb, 0xa4, 0x3e, 0x6c, 0x80, 0xa6, 0x3d,
+  0xf1, 0x04, 0x67, 0xbe, 0x6c, 0x1c, 0xb0, 0x3d, 0x6c, 0xaf, 0xc6, 0xbe,
+  0x7b, 0xd6, 0x1d, 0xbe, 0x52, 0xba, 0xe3, 0x3e, 0x8c, 0x25, 0x03, 0x3f,
+  0x9c, 0x18, 0x1e, 0x3f, 0xae, 0x81, 0x41, 0xbe, 0x29, 0x2c, 0x56, 0x3d,
+  0x59, 0x44, 0x97, 0xbe, 0x27, 0xa7, 0xcd, 0xbd, 0xc5, 0xd6, 0x06, 0x3f,
+  0x90, 0x19, 0x1f, 0x3c, 0x6a, 0x19, 0x8f, 0x3d, 0x1b, 0x63, 0xca, 0x3e,
+  0x29, 0x9d, 0xa4, 0x3e, 0x20, 0x54, 0xa5, 0x3e, 0x15, 0x6e, 0x59, 0xba,
+  0xb7, 0xfe, 0xd7, 0x3c, 0x7d, 0x11, 0xf6, 0xbd, 0x4a, 0xc9, 0x19, 0x3e,
+  0x75, 0xf3, 0x87, 0x3e, 0xe1, 0x76, 0xba, 0x3e, 0x69, 0x71, 0xa7, 0x3c,
+  0xb9, 0x00, 0x9b, 0xbe, 0x44, 0x83, 0x7f, 0xbe, 0x0b, 0x74, 0x60, 0x3b,
+  0xca, 0xc7, 0xd2, 0x3e, 0x79, 0x9d, 0x83, 0x3e, 0xf0, 0x14, 0xc8, 0xbd,
+  0x4b, 0xa6, 0x0f, 0x3e, 0x0d, 0xde, 0x08, 0xbe, 0x16, 0x8c, 0x12, 0xbd,
+  0xf6, 0xe2, 0x0e, 0x3e, 0x13, 0x39, 0x45, 0x3e, 0x7a, 0x8a, 0x62, 0x3d,
+  0x5f, 0x3e, 0x97, 0x3e, 0x2b, 0x0e, 0xdb, 0x3e, 0x7d, 0x94, 0xd0, 0x3e,
+  0xe7, 0x24, 0xfd, 0x3e, 0x91, 0x24, 0x19, 0x3e, 0xf2, 0x91, 0x12, 0xbc,
+  0x87, 0xc9, 0x61, 0xbe, 0x71, 0x69, 0x6b, 0xbe, 0x53, 0xf6, 0xc5, 0xbd,
+  0xd5, 0x1e, 0x1b, 0x3d, 0xb6, 0x61, 0x33, 0xbe, 0x8a, 0xe8, 0xa6, 0xbe,
+  0xd7, 0x89, 0x34, 0xbe, 0xbc, 0xe6, 0x5d, 0x3e, 0x17, 0x57, 0x24, 0x3f,
+  0x8f, 0xe9, 0xad, 0x3f, 0xc0, 0x41, 0x5a, 0x3f, 0x93, 0xe0, 0xae, 0x3c,
+  0x3e, 0x88, 0x2f, 0xbe, 0xb6, 0x23, 0x56, 0xbe, 0x8e, 0xa1, 0xbe, 0xbe,
+  0xc0, 0xc1, 0x6a, 0xbe, 0xc5, 0x89, 0x82, 0xbe, 0x4a, 0x3b, 0x0d, 0xbe,
+  0xc3, 0x74, 0x89, 0xbe, 0x5c, 0x96, 0x92, 0xbc, 0x4a, 0x40, 0x9b, 0xbe,
+  0x66, 0x56, 0xdc, 0x3e, 0x8f, 0x30, 0xb0, 0xbd, 0xc2, 0x30, 0x8a, 0xbe,
+  0xf0, 0x74, 0xdb, 0xbe, 0xa3, 0x7d, 0xb0, 0xbe, 0x76, 0x33, 0x8a, 0xbe,
+  0x70, 0x40, 0x6c, 0x3e, 0xe8, 0xc0, 0x03, 0x3e, 0x2f, 0x61, 0xe7, 0xbd,
+  0xa1, 0x4c, 0xc5, 0xbe, 0x86, 0xf8, 0x9a, 0xbe, 0xe5, 0xd0, 0x1e, 0x3e,
+  0x18, 0x15, 0x20, 0x3d, 0xe5, 0x70, 0x09, 0x3e, 0xe7, 0x8b, 0x9d, 0x3c,
+  0xab, 0x9a, 0xd3, 0x3d, 0x47, 0xea, 0x13, 0x3f, 0x9b, 0x92, 0x36, 0x3f,
+  0xb6, 0xf4, 0x8c, 0x3e, 0x7b, 0xd7, 0x05, 0xbf, 0x90, 0x42, 0x2f, 0xbf,
+  0x95, 0xae, 0x11, 0xbf, 0x6d, 0x45, 0x93, 0x3c, 0xa8, 0x8c, 0x03, 0x3e,
+  0xa5, 0x8c, 0x4d, 0x3c, 0xe5, 0x12, 0x90, 0xbc, 0xb3, 0x9e, 0xaa, 0xbe,
+  0x1e, 0xf0, 0x94, 0xbe, 0xad, 0x67, 0x9b, 0xbe, 0x05, 0x05, 0x65, 0xbd,
+  0x3c, 0x5e, 0xd5, 0xbd, 0x84, 0xc5, 0xfa, 0x3d, 0x44, 0x5d, 0x0d, 0xbf,
+  0xed, 0xe7, 0x30, 0xbf, 0x17, 0x7f, 0x36, 0xbe, 0x66, 0x2f, 0x9f, 0xbe,
+  0xca, 0x69, 0x4a, 0x3e, 0x1c, 0xff, 0x46, 0x3d, 0xfb, 0xb8, 0xf2, 0x3e,
+  0xc7, 0xc8, 0x41, 0x3f, 0x52, 0x5f, 0x4a, 0x3f, 0x1a, 0xa8, 0xb0, 0x3e,
+  0xe3, 0x4c, 0x62, 0xbe, 0x5d, 0xa2, 0x8d, 0xbd, 0xac, 0x70, 0x5f, 0x3e,
+  0x08, 0x6e, 0x43, 0x3e, 0x88, 0xb7, 0x22, 0x3f, 0x50, 0x94, 0xad, 0x3e,
+  0x87, 0x0e, 0x30, 0x3f, 0x51, 0x3c, 0x8f, 0x3f, 0x32, 0xf2, 0xa0, 0x3f,
+  0xbb, 0xbc, 0x9c, 0x3f, 0xf0, 0x0b, 0xb2, 0x3d, 0x55, 0xbe, 0x78, 0xbe,
+  0x3a, 0xb6, 0x2d, 0x3e, 0xb5, 0x1b, 0x32, 0x3f, 0x32, 0xc3, 0x15, 0xbe,
+  0x1d, 0x0d, 0x25, 0xbe, 0x44, 0x64, 0x1c, 0xbe, 0x6b, 0x99, 0x4f, 0x3f,
+  0xf6, 0x77, 0x82, 0x3f, 0x39, 0xee, 0x2c, 0x3f, 0x04, 0x9c, 0x56, 0x3f,
+  0xf0, 0x74, 0xbf, 0x3f, 0xc8, 0x9e, 0xbd, 0x3f, 0x33, 0xab, 0x80, 0x3f,
+  0xfd, 0x7d, 0x72, 0x3e, 0xd4, 0x3b, 0x37, 0x3e, 0x61, 0x11, 0x2f, 0xbb,
+  0x5f, 0x2f, 0x1d, 0xbe, 0x27, 0x47, 0xa7, 0x3d, 0xee, 0xd7, 0xc6, 0xbe,
+  0x6c, 0x68, 0xe1, 0xbd, 0x19, 0xdf, 0x3e, 0xbd, 0xc0, 0x22, 0xed, 0x3d,
+  0xe4, 0xe6, 0x2c, 0x3e, 0xcc, 0x90, 0x43, 0xbb, 0x20, 0xc2, 0x2c, 0xbc,
+  0x42, 0x9c, 0xb2, 0x3e, 0xe8, 0x07, 0x8b, 0x3d, 0xd3, 0xeb, 0x99, 0x3d,
+  0xab, 0x16, 0x2b, 0x3d, 0x03, 0x79, 0xe0, 0x3d, 0x55, 0x4e, 0xb2, 0x3e,
+  0xfc, 0xfb, 0x59, 0x3e, 0x67, 0x67, 0xe6, 0x3e, 0xf4, 0xc9, 0x23, 0x3e,
+  0x57, 0x58, 0x68, 0x3e, 0x7f, 0xe3, 0x9b, 0xbd, 0x58, 0xa2, 0x7b, 0xbe,
+  0x77, 0x70, 0xce, 0xbe, 0x9e, 0xa3, 0xbc, 0xbe, 0x36, 0x97, 0xc9, 0xbe,
+  0x69, 0xb9, 0x6d, 0xbc, 0x94, 0x29, 0x47, 0x3d, 0x41, 0x41, 0x8f, 0x3e,
+  0x5a, 0x4d, 0xca, 0xbc, 0x2e, 0xce, 0x67, 0xbd, 0x7f, 0xf6, 0x42, 0x3c,
+  0x7d, 0x60, 0xbf, 0xbd, 0x69, 0x29, 0xad, 0x3e, 0x43, 0x71, 0x39, 0xbc,
+  0x7c, 0x58, 0xe1, 0xbb, 0xeb, 0xb0, 0xef, 0x3e, 0x1e, 0xd0, 0x3f, 0x3b,
+  0x05, 0x4b, 0x40, 0x3e, 0xa7, 0xc1, 0xce, 0x3e, 0xa1, 0x03, 0x1d, 0x3f,
+  0xde, 0x5c, 0xa5, 0x3e, 0xd4, 0x92, 0xf5, 0x3e, 0x07, 0x36, 0x89, 0x3e,
+  0xcd, 0x0a, 0x0a, 0x3e, 0x08, 0x5e, 0x41, 0x3e, 0xc2, 0xb0, 0x3d, 0x3e,
+  0x78, 0x1b, 0x0b, 0xbc, 0xfc, 0x26, 0x55, 0x3f, 0x66, 0xd4, 0x4c, 0x3d,
+  0x32, 0xcc, 0xd3, 0x3e, 0xb5, 0x13, 0x08, 0x3f, 0xc5, 0x23, 0x4d, 0x3f,
+  0xb9, 0xce, 0x94, 0x3f, 0x19, 0xbd, 0xa5, 0x3f, 0x58, 0x43, 0x23, 0x3f,
+  0x54, 0x92, 0x30, 0x3f, 0x11, 0x00, 0x82, 0x3e, 0xf0, 0x23, 0xe6, 0x3e,
+  0x1f, 0x35, 0x33, 0x3d, 0x9e, 0x16, 0x8f, 0xbe, 0xc4, 0x9d, 0xb6, 0x3d,
+  0x8b, 0xd1, 0xc0, 0xbd, 0xe0, 0x97, 0x4f, 0x3b, 0x21, 0x38, 0xb9, 0x3e,
+  0x84, 0x6e, 0x84, 0x3e, 0xb2, 0x7d, 0xfe, 0x3d, 0xf4, 0xb5, 0x12, 0x3e,
+  0xe7, 0xc2, 0x51, 0x3e, 0x67, 0x9f, 0x83, 0x3e, 0x6f, 0x73, 0x25, 0x3f,
+  0x02, 0x14, 0xd9, 0xbd, 0x45, 0xf5, 0xe0, 0x3d, 0x56, 0xec, 0xf4, 0x3d,
+  0x39, 0x91, 0xa0, 0x3d, 0x5c, 0x8c, 0x69, 0xbe, 0xbe, 0x91, 0xf7, 0xbd,
+  0xda, 0x28, 0x5c, 0xbe, 0x12, 0x27, 0x37, 0xbf, 0x44, 0x24, 0x03, 0xbf,
+  0x93, 0xd1, 0xa9, 0xbe, 0xfc, 0x6f, 0x8a, 0xbe, 0x39, 0x3c, 0x0a, 0x3e,
+  0x6d, 0xb5, 0xfa, 0x3e, 0xdb, 0x5d, 0x86, 0x3f, 0x08, 0xcd, 0x8f, 0x3f,
+  0x9e, 0x41, 0x86, 0x3f, 0x27, 0x46, 0xe4, 0x3e, 0xbc, 0x64, 0x01, 0x3e,
+  0xeb, 0xcb, 0x3e, 0xbe, 0x03, 0x2b, 0x4e, 0x3e, 0x20, 0xab, 0xd7, 0x3b,
+  0x32, 0x59, 0xcc, 0xbc, 0x78, 0x75, 0x84, 0xbe, 0xeb, 0xfe, 0x85, 0xbe,
+  0x7d, 0x87, 0x05, 0xbd, 0x3a, 0x48, 0x62, 0xbe, 0xad, 0xa7, 0x48, 0xbe,
+  0xf2, 0x40, 0xfb, 0xbd, 0x2e, 0x75, 0x0e, 0x3f, 0xef, 0x6b, 0x14, 0x3f,
+  0x69, 0x06, 0x3a, 0xbe, 0x89, 0xc7, 0x7d, 0xbd, 0x8a, 0xe4, 0xa7, 0x3d,
+  0x08, 0x2d, 0xdd, 0xbd, 0x6f, 0x71, 0x49, 0xbe, 0xff, 0x7c, 0xaa, 0xbe,
+  0xb4, 0x30, 0x26, 0xbe, 0x30, 0x5f, 0xb8, 0x3e, 0x4f, 0xa6, 0x98, 0x3f,
+  0x56, 0x9d, 0x3c, 0x3f, 0x89, 0xd2, 0x05, 0x3f, 0x1e, 0x3a, 0xcd, 0x3e,
+  0x53, 0x22, 0x8c, 0xbd, 0xe2, 0x08, 0xb0, 0xbe, 0x8c, 0xaa, 0x9c, 0xbe,
+  0xa4, 0xc2, 0xa0, 0xbd, 0x58, 0xfc, 0xc9, 0x3e, 0x4a, 0x1b, 0x28, 0x3f,
+  0x78, 0xb9, 0xf5, 0x3e, 0x0a, 0x52, 0x7b, 0x3e, 0xc6, 0xc0, 0xe2, 0x3d,
+  0x36, 0x87, 0x3a, 0xbe, 0x79, 0xfa, 0xe3, 0xbe, 0xea, 0x6a, 0x59, 0xbf,
+  0x7c, 0xd6, 0x31, 0xbf, 0x3c, 0xc9, 0x06, 0xbf, 0x16, 0x34, 0xac, 0xbc,
+  0x6f, 0x3b, 0xc2, 0x3e, 0x7a, 0xa7, 0x1e, 0x3d, 0x7e, 0xad, 0xb5, 0xbd,
+  0xcd, 0x1a, 0xdf, 0xbd, 0xa9, 0xcf, 0x16, 0xbe, 0x45, 0x52, 0x7a, 0xbe,
+  0xfa, 0xbd, 0x0f, 0xbe, 0xee, 0x58, 0xca, 0xbd, 0xe3, 0xe6, 0x43, 0x3d,
+  0x15, 0xf2, 0x24, 0x3e, 0xc4, 0x24, 0x6f, 0x3e, 0x0a, 0xdc, 0x31, 0x3e,
+  0xe8, 0x77, 0x05, 0x3f, 0x6a, 0x25, 0x41, 0x3e, 0xa9, 0xa6, 0xb3, 0x3e,
+  0x97, 0x33, 0xfd, 0x3e, 0x64, 0x05, 0x26, 0x3f, 0xd1, 0xa5, 0x3a, 0x3f,
+  0x33, 0x42, 0x8a, 0x3e, 0xed, 0x7e, 0xc9, 0xbd, 0xa6, 0x6a, 0x57, 0x3e,
+  0x18, 0x6d, 0x22, 0x3e, 0xf3, 0xd6, 0xd1, 0x3d, 0x4e, 0xbc, 0xb6, 0x3c,
+  0xbe, 0xfe, 0x60, 0xbd, 0x17, 0x55, 0xa9, 0x3e, 0x4b, 0xf3, 0xa1, 0x3e,
+  0x6f, 0x7f, 0xa7, 0x3d, 0xc0, 0x44, 0x11, 0xbc, 0x02, 0xe4, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0xa8, 0x06, 0x2a, 0x3e, 0xa4, 0xaf, 0x9f, 0xbd, 0x22, 0x2b, 0x6a, 0x3f,
+  0xa4, 0x14, 0x88, 0x3b, 0xc3, 0xf4, 0xba, 0x3d, 0x25, 0x9b, 0x92, 0xbd,
+  0xeb, 0x80, 0xc6, 0x3c, 0x90, 0xe7, 0x90, 0x3e, 0xb5, 0xae, 0xe1, 0x3e,
+  0x21, 0x9b, 0x99, 0x3e, 0x2c, 0x6e, 0x7e, 0x3d, 0x55, 0xa8, 0x67, 0xbe,
+  0x69, 0x83, 0xba, 0x3e, 0x1e, 0xf6, 0x80, 0x3e, 0x53, 0xe0, 0xad, 0x3e,
+  0x92, 0xdc, 0x4e, 0x3f, 0xbf, 0x9f, 0xa4, 0x3e, 0x15, 0x7a, 0x6f, 0x3d,
+  0xbb, 0x30, 0xae, 0x3e, 0x83, 0xab, 0xe3, 0xbe, 0x62, 0xe4, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
   0x5a, 0x33, 0x87, 0x3f, 0xb5, 0x14, 0x8c, 0x3f, 0x1d, 0xb2, 0x99, 0x3f,
   0xe3, 0xd5, 0x99, 0x3f, 0x81, 0x2d, 0x73, 0x3f, 0x1a, 0xab, 0x7a, 0x3f,
   0x88, 0x79, 0x8f, 0x3f, 0x4e, 0x35, 0x93, 0x3f, 0x39, 0xad, 0x86, 0x3f,
   0xce, 0xa8, 0x83, 0x3f, 0xd2, 0x0b, 0x8a, 0x3f, 0x44, 0xc7, 0x85, 0x3f,
   0xfa, 0x2e, 0x9d, 0x3f, 0x75, 0x7e, 0x92, 0x3f, 0x31, 0xe5, 0x9f, 0x3f,
   0x09, 0x4e, 0x9c, 0x3f, 0x31, 0x3c, 0x65, 0x3f, 0x67, 0x33, 0x97, 0x3f,
-  0x57, 0x3d, 0x96, 0x3f, 0xde, 0x30, 0x95, 0x3f, 0xee, 0xe4, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xc5, 0xf3, 0x31, 0xbe,
-  0x39, 0x41, 0xee, 0x3d, 0x9b, 0x35, 0x04, 0x3e, 0xc7, 0x36, 0xf3, 0xbd,
-  0xce, 0xe4, 0x59, 0x3d, 0xa8, 0x59, 0x45, 0x3d, 0x33, 0x59, 0x12, 0xbd,
-  0x49, 0x2f, 0x01, 0xbe, 0x8b, 0x7e, 0x00, 0xbe, 0x7e, 0x3b, 0xf1, 0xbd,
-  0xfe, 0xaf, 0x26, 0x3d, 0xe9, 0xde, 0x15, 0xbe, 0x6a, 0xb4, 0x23, 0x3e,
-  0x6a, 0xdd, 0x39, 0xbd, 0x8b, 0x85, 0x98, 0x3b, 0x1f, 0xda, 0x04, 0x3e,
-  0x06, 0x5e, 0xb9, 0xbd, 0xa5, 0x87, 0x97, 0xbd, 0x0a, 0x12, 0x15, 0xbe,
-  0xd6, 0x6e, 0x3e, 0xbe, 0x4a, 0xe5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x50, 0x00, 0x00, 0x00, 0x77, 0x74, 0x46, 0x3f, 0xd3, 0x21, 0xdd, 0x3e,
-  0x4a, 0x8a, 0x30, 0x3f, 0x28, 0x8f, 0x5b, 0x3e, 0xd6, 0x72, 0x3d, 0xbd,
-  0x4b, 0x3f, 0x9b, 0x3e, 0xaa, 0x32, 0xa4, 0x3e, 0x1f, 0x1d, 0x4c, 0x3e,
-  0x09, 0x22, 0x0d, 0x3f, 0x66, 0xa5, 0xfc, 0x3d, 0xd5, 0xa1, 0xbb, 0x3e,
-  0x5f, 0x68, 0x7b, 0x3e, 0x09, 0xf6, 0x3d, 0x3e, 0x36, 0xd2, 0x01, 0x3f,
-  0xe6, 0x23, 0x80, 0x3e, 0x53, 0x10, 0x39, 0x3f, 0x9d, 0x79, 0x45, 0x3f,
-  0x53, 0xe9, 0xdb, 0x3e, 0x15, 0x89, 0xc0, 0x3e, 0x43, 0x36, 0xa6, 0x3e,
-  0xa6, 0xe5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00,
+  0x57, 0x3d, 0x96, 0x3f, 0xde, 0x30, 0x95, 0x3f, 0xc2, 0xe4, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0xc5, 0xf3, 0x31, 0xbe, 0x39, 0x41, 0xee, 0x3d, 0x9b, 0x35, 0x04, 0x3e,
+  0xc7, 0x36, 0xf3, 0xbd, 0xce, 0xe4, 0x59, 0x3d, 0xa8, 0x59, 0x45, 0x3d,
+  0x33, 0x59, 0x12, 0xbd, 0x49, 0x2f, 0x01, 0xbe, 0x8b, 0x7e, 0x00, 0xbe,
+  0x7e, 0x3b, 0xf1, 0xbd, 0xfe, 0xaf, 0x26, 0x3d, 0xe9, 0xde, 0x15, 0xbe,
+  0x6a, 0xb4, 0x23, 0x3e, 0x6a, 0xdd, 0x39, 0xbd, 0x8b, 0x85, 0x98, 0x3b,
+  0x1f, 0xda, 0x04, 0x3e, 0x06, 0x5e, 0xb9, 0xbd, 0xa5, 0x87, 0x97, 0xbd,
+  0x0a, 0x12, 0x15, 0xbe, 0xd6, 0x6e, 0x3e, 0xbe, 0x22, 0xe5, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x77, 0x74, 0x46, 0x3f, 0xd3, 0x21, 0xdd, 0x3e, 0x4a, 0x8a, 0x30, 0x3f,
+  0x28, 0x8f, 0x5b, 0x3e, 0xd6, 0x72, 0x3d, 0xbd, 0x4b, 0x3f, 0x9b, 0x3e,
+  0xaa, 0x32, 0xa4, 0x3e, 0x1f, 0x1d, 0x4c, 0x3e, 0x09, 0x22, 0x0d, 0x3f,
+  0x66, 0xa5, 0xfc, 0x3d, 0xd5, 0xa1, 0xbb, 0x3e, 0x5f, 0x68, 0x7b, 0x3e,
+  0x09, 0xf6, 0x3d, 0x3e, 0x36, 0xd2, 0x01, 0x3f, 0xe6, 0x23, 0x80, 0x3e,
+  0x53, 0x10, 0x39, 0x3f, 0x9d, 0x79, 0x45, 0x3f, 0x53, 0xe9, 0xdb, 0x3e,
+  0x15, 0x89, 0xc0, 0x3e, 0x43, 0x36, 0xa6, 0x3e, 0x82, 0xe5, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00,
   0xcb, 0x1a, 0x35, 0x3f, 0xfc, 0xf6, 0xc4, 0xbe, 0xe7, 0x26, 0x86, 0xbe,
   0x23, 0x93, 0x6e, 0x3e, 0xa3, 0xa7, 0x4e, 0xbe, 0x14, 0xea, 0xa1, 0xbc,
   0x35, 0x10, 0x66, 0x3e, 0x8b, 0xcd, 0x15, 0xbe, 0x44, 0x85, 0x74, 0xbe,
@@ -2832,276 +2836,277 @@ unsigned char trained_lstm_tflite[] = {
   0x4f, 0x3f, 0x16, 0x3f, 0xc2, 0xc8, 0xe6, 0x3e, 0x57, 0x05, 0x90, 0x3e,
   0x1c, 0xac, 0x43, 0xbf, 0x15, 0xdb, 0x84, 0x3e, 0xe3, 0xf7, 0x46, 0x3e,
   0x3c, 0xf6, 0x79, 0xbe, 0x20, 0xd7, 0x40, 0xbe, 0xe3, 0x1d, 0x31, 0x3f,
-  0xad, 0xf1, 0x96, 0xbf, 0xf2, 0xeb, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x06, 0x00, 0x00, 0x58, 0x30, 0x2c, 0xbf, 0x9d, 0xb7, 0x88, 0x3e,
-  0xb3, 0x63, 0xf7, 0xbd, 0x7e, 0x11, 0xe3, 0xbe, 0xde, 0x86, 0x72, 0x3e,
-  0xcb, 0x8e, 0xb5, 0xbc, 0xd3, 0x98, 0xdb, 0xbe, 0xb3, 0x46, 0xc8, 0x3e,
-  0x80, 0x5c, 0x3a, 0xbd, 0x8c, 0x25, 0xdb, 0x3d, 0x96, 0x5f, 0xd7, 0x3e,
-  0x2c, 0xe7, 0xab, 0xbd, 0x57, 0xd3, 0x6e, 0xbe, 0x20, 0xe8, 0x8c, 0x3e,
-  0x27, 0xb4, 0x5c, 0x3d, 0x06, 0xf5, 0x5b, 0xbc, 0xd8, 0xde, 0xa9, 0x3d,
-  0x50, 0x9c, 0xc1, 0xbd, 0xe6, 0x40, 0x0e, 0x3f, 0x39, 0xb4, 0xae, 0xbe,
-  0xa2, 0x2f, 0x8d, 0xbe, 0x25, 0x2f, 0xb7, 0x3d, 0xb4, 0xdf, 0xce, 0x3d,
-  0x77, 0xbd, 0x95, 0xbe, 0x5a, 0x89, 0xca, 0x3e, 0x60, 0xa8, 0x70, 0xbe,
-  0x06, 0x85, 0xdc, 0xbd, 0x4b, 0x1d, 0xda, 0x3e, 0x05, 0x08, 0x06, 0xbd,
-  0x73, 0xa2, 0x28, 0x3d, 0xc4, 0x01, 0x03, 0x3e, 0x26, 0x29, 0xa6, 0xbe,
-  0x15, 0xa0, 0x9d, 0xbe, 0x44, 0xe4, 0xae, 0xbe, 0x09, 0x81, 0x8f, 0xbe,
-  0xc3, 0xac, 0x5e, 0xbe, 0x07, 0xf0, 0xb1, 0xbe, 0xe4, 0x03, 0xf3, 0xbe,
-  0x7f, 0x62, 0xad, 0x3e, 0x4f, 0x40, 0x1d, 0xbf, 0xc7, 0x17, 0xb6, 0xbd,
-  0xcb, 0x15, 0x17, 0xbd, 0x0f, 0x25, 0x29, 0x3e, 0xdb, 0xec, 0x79, 0xbe,
-  0xeb, 0x70, 0xca, 0xbd, 0xf0, 0xb7, 0xf3, 0x3e, 0x80, 0x8b, 0xa2, 0x3d,
-  0x10, 0x12, 0x05, 0x3d, 0x6f, 0x86, 0xb1, 0xbe, 0x9d, 0xef, 0xd8, 0x3c,
-  0xec, 0xc8, 0x01, 0xbe, 0x61, 0xeb, 0xc7, 0x3e, 0xd7, 0x34, 0x2a, 0x3e,
-  0x03, 0x52, 0x49, 0xbe, 0x87, 0x3a, 0x9b, 0x3d, 0xd1, 0xeb, 0x0a, 0x3e,
-  0xc4, 0x07, 0x3c, 0x3f, 0xb2, 0x5f, 0x9e, 0xbe, 0x35, 0xb7, 0xc9, 0xbd,
-  0x33, 0x3b, 0x5b, 0x3d, 0x8c, 0x45, 0x8e, 0xbd, 0x37, 0x4b, 0x94, 0xbe,
-  0xe4, 0xd4, 0xfd, 0xbe, 0xaa, 0xb2, 0x3c, 0x3d, 0xf5, 0xaa, 0x9b, 0x3e,
-  0x92, 0xc0, 0x1d, 0xbe, 0xd2, 0xd2, 0x12, 0x3e, 0x11, 0x15, 0x75, 0x3e,
-  0xb4, 0x1a, 0xb7, 0x3e, 0xeb, 0x3d, 0x55, 0xbe, 0xf7, 0x2f, 0x29, 0xbe,
-  0x76, 0x0b, 0x5b, 0xbe, 0x45, 0x41, 0xb4, 0x3e, 0xed, 0x21, 0xd4, 0x3d,
-  0xda, 0x5c, 0x46, 0xbe, 0x06, 0xf8, 0x83, 0xbd, 0x83, 0x49, 0xcb, 0x3d,
-  0x29, 0x5c, 0x2f, 0x3e, 0x08, 0xd3, 0xea, 0x3d, 0x83, 0x0d, 0x7f, 0x3e,
-  0x17, 0x8c, 0xac, 0xbc, 0x7e, 0xed, 0xef, 0x3d, 0x2a, 0x6a, 0xd8, 0xbe,
-  0x13, 0x7e, 0x48, 0x3e, 0x50, 0x9b, 0x6c, 0x3e, 0x3d, 0x30, 0x1d, 0xbf,
-  0x08, 0x46, 0xfd, 0x3d, 0x2d, 0xa5, 0x3a, 0x3e, 0x0e, 0xe1, 0x96, 0x3e,
-  0xc1, 0x8f, 0x8e, 0x3e, 0x52, 0x59, 0x58, 0xbe, 0x69, 0x76, 0x13, 0xbc,
-  0x6c, 0x5e, 0x4c, 0xbe, 0x14, 0x0e, 0xb7, 0x3e, 0x72, 0x14, 0xd9, 0xbd,
-  0xdc, 0xd2, 0x8c, 0x3d, 0x1e, 0xde, 0x69, 0xbb, 0xb7, 0xca, 0x34, 0xbe,
-  0x8f, 0x83, 0xe8, 0x3e, 0xa4, 0x3c, 0xb8, 0x3d, 0xde, 0x62, 0xe9, 0xbe,
-  0xaf, 0x94, 0xad, 0xbd, 0xa7, 0xdb, 0x9c, 0x3e, 0x2a, 0xac, 0x8a, 0x3e,
-  0x61, 0x83, 0xc8, 0x3e, 0xea, 0xbd, 0xa1, 0xbc, 0xf5, 0x46, 0x71, 0xbe,
-  0x20, 0x43, 0x33, 0x3f, 0xfb, 0x54, 0x24, 0x3f, 0x9c, 0x15, 0x91, 0x3e,
-  0xe7, 0x44, 0x16, 0xbe, 0x00, 0x9f, 0x10, 0x3e, 0x36, 0xee, 0x6d, 0x3e,
-  0x31, 0xa2, 0x98, 0x3d, 0x29, 0x76, 0x36, 0xbe, 0x57, 0x7e, 0x94, 0xbd,
-  0x23, 0x19, 0x55, 0xbe, 0x2e, 0x68, 0xee, 0xbe, 0xfd, 0xea, 0xd4, 0x3e,
-  0x69, 0xbd, 0x4f, 0xbd, 0x08, 0x2e, 0x4a, 0xbd, 0x55, 0x01, 0x09, 0x3e,
-  0xed, 0x06, 0x85, 0xbc, 0xd3, 0x18, 0x01, 0xbf, 0x25, 0x58, 0x59, 0xbe,
-  0x25, 0xa3, 0x01, 0x3e, 0x33, 0x9a, 0x6b, 0x3d, 0x30, 0x82, 0x94, 0xbd,
-  0x67, 0x0c, 0x0f, 0x3e, 0x13, 0xdb, 0xc1, 0x3d, 0xb2, 0x56, 0xe7, 0x3d,
-  0x63, 0xc0, 0x74, 0x3e, 0x5d, 0x9b, 0x89, 0xbd, 0x42, 0x69, 0xb9, 0x3d,
-  0xb1, 0x85, 0x23, 0x3d, 0x02, 0xe8, 0xf0, 0xbd, 0xb3, 0x43, 0x12, 0x3e,
-  0x4b, 0x27, 0xa6, 0x3e, 0xbe, 0x89, 0x72, 0xbd, 0xba, 0x83, 0xde, 0x3d,
-  0xfb, 0x09, 0x84, 0x3e, 0xff, 0xaf, 0xa2, 0x3d, 0xaa, 0x89, 0xd8, 0xbd,
-  0x5f, 0x85, 0x1f, 0xbe, 0x46, 0xf2, 0x24, 0x3e, 0xc0, 0x83, 0x55, 0x3d,
-  0x61, 0x28, 0x73, 0xbd, 0xd0, 0x5e, 0xa4, 0x3d, 0xab, 0x77, 0xc2, 0xbe,
-  0x69, 0x1e, 0xdf, 0x3e, 0x77, 0x41, 0xdb, 0xbc, 0x62, 0xe0, 0xee, 0xbc,
-  0xfc, 0x69, 0x60, 0x3d, 0x50, 0x50, 0x79, 0x3d, 0xd7, 0x59, 0x72, 0x3e,
-  0x8b, 0x95, 0x59, 0xbc, 0x4e, 0xb0, 0x43, 0xbe, 0xd5, 0x53, 0x8a, 0x3e,
-  0x37, 0x00, 0xf3, 0x3d, 0x96, 0x4f, 0x4f, 0x3d, 0x5e, 0xd1, 0x4c, 0x3e,
-  0xa6, 0xfe, 0x8e, 0xbd, 0x2e, 0xdd, 0x60, 0x3e, 0x5a, 0xd1, 0xff, 0xbd,
-  0x50, 0x5c, 0xc0, 0x3d, 0xe0, 0x0f, 0x68, 0xbd, 0x25, 0x1a, 0x6c, 0xbc,
-  0x03, 0x6e, 0x76, 0xbe, 0xc5, 0x5b, 0x27, 0x3d, 0xb9, 0x62, 0x07, 0xbe,
-  0x6b, 0x46, 0xc8, 0xbe, 0x14, 0xef, 0x12, 0x3e, 0xc3, 0x6b, 0x3c, 0xbe,
-  0x73, 0xab, 0x00, 0x3d, 0x65, 0xea, 0xa2, 0xbd, 0x51, 0x81, 0xe1, 0x3c,
-  0x5a, 0xba, 0x27, 0xbd, 0x29, 0x71, 0xe5, 0x3e, 0xe4, 0x72, 0xe1, 0xbd,
-  0x6d, 0xf7, 0x3a, 0x3e, 0x17, 0x84, 0x10, 0xbf, 0x3e, 0x2d, 0x1a, 0xbe,
-  0x77, 0xf9, 0x78, 0x3c, 0x08, 0x4b, 0x98, 0xbe, 0xd0, 0x2d, 0x34, 0xbd,
-  0xbb, 0x1c, 0xd9, 0x3e, 0x8c, 0xa6, 0x7f, 0xbe, 0xeb, 0x86, 0xde, 0x3e,
-  0x4c, 0x90, 0x12, 0x3f, 0x35, 0x07, 0x53, 0xbd, 0x7f, 0xf3, 0xd9, 0xbb,
-  0xe7, 0x33, 0xcd, 0x3d, 0xa7, 0x30, 0xbf, 0xbd, 0x8d, 0x8e, 0x21, 0x3e,
-  0x70, 0xb7, 0x8b, 0xbe, 0xe1, 0xed, 0x77, 0x3e, 0xfb, 0x7c, 0x4f, 0xbd,
-  0xec, 0xc5, 0x0a, 0xbf, 0x04, 0xf6, 0xcb, 0x3e, 0x8e, 0xb3, 0x85, 0xbe,
-  0x23, 0xc7, 0x2c, 0xbd, 0x46, 0xfd, 0xac, 0x3d, 0x59, 0x68, 0x8c, 0x3e,
-  0x46, 0x44, 0xba, 0xbd, 0xe4, 0x07, 0xcd, 0x3e, 0x50, 0x18, 0xf2, 0xbe,
-  0xd9, 0xf6, 0x07, 0xbe, 0xe7, 0x88, 0xc1, 0x3e, 0x6e, 0x52, 0x9b, 0x3e,
-  0xb3, 0x1d, 0x4b, 0xbe, 0x2b, 0x1f, 0x37, 0xbe, 0x96, 0x9e, 0x3d, 0x3e,
-  0x82, 0x7d, 0x0f, 0x3c, 0xf8, 0x6a, 0x40, 0xbe, 0xb6, 0xc7, 0xca, 0xbe,
-  0x1c, 0x8b, 0x38, 0xbc, 0x3d, 0xcd, 0x58, 0xbe, 0x7d, 0x5f, 0xf1, 0x3c,
-  0x8f, 0x52, 0x8c, 0x3e, 0x9b, 0xbb, 0x80, 0x3e, 0x14, 0x13, 0x91, 0xbe,
-  0x6f, 0xb4, 0x13, 0xbe, 0x57, 0x1e, 0x02, 0xbe, 0x1e, 0x82, 0x4d, 0x3d,
-  0x7b, 0x4c, 0x65, 0x3d, 0xa1, 0xa2, 0xf0, 0x3c, 0x82, 0x41, 0x82, 0xbc,
-  0xe4, 0xab, 0xfa, 0x3e, 0xf4, 0x05, 0xee, 0x3e, 0x04, 0xd7, 0x9a, 0x3d,
-  0x96, 0x00, 0x46, 0x3e, 0x0b, 0x88, 0xd6, 0x3e, 0x56, 0xc4, 0xdc, 0xbc,
-  0xdc, 0x45, 0xcc, 0xbe, 0x95, 0x5c, 0x9b, 0x3e, 0x7b, 0x0d, 0x8a, 0xbd,
-  0x2c, 0x1f, 0xdd, 0x3d, 0xba, 0x7b, 0x09, 0xbe, 0xe6, 0x0c, 0x90, 0x3d,
-  0x95, 0x8c, 0x8d, 0x3c, 0xab, 0xda, 0x06, 0x3e, 0x58, 0x96, 0x92, 0xbe,
-  0xc7, 0xda, 0x7d, 0xbb, 0xed, 0xe2, 0x4a, 0xbe, 0x17, 0x34, 0x28, 0x3e,
-  0x89, 0x85, 0x16, 0x3e, 0xe4, 0x43, 0x1a, 0xbe, 0x80, 0x54, 0x24, 0xbe,
-  0xf2, 0x84, 0xed, 0x3e, 0xe2, 0xbc, 0x22, 0xbe, 0x8b, 0xa8, 0x1f, 0xbd,
-  0x09, 0xb9, 0xf1, 0x3c, 0xf0, 0x85, 0x86, 0xbe, 0x36, 0x79, 0x1b, 0xbf,
-  0x96, 0x59, 0xdd, 0xbe, 0xd2, 0xd6, 0xe0, 0xbd, 0x41, 0x7d, 0x61, 0xbe,
-  0x9a, 0x45, 0xab, 0x3d, 0xdf, 0x40, 0x05, 0xbf, 0xe1, 0xaa, 0xd7, 0x3e,
-  0x30, 0x60, 0x0c, 0x3e, 0x24, 0xef, 0xa2, 0x3d, 0x24, 0x6a, 0xeb, 0x3e,
-  0x35, 0x75, 0x26, 0xbf, 0x38, 0xa7, 0xaf, 0x3e, 0xb0, 0x2d, 0x89, 0x3e,
-  0xc2, 0x18, 0x61, 0xbe, 0x6c, 0xce, 0x22, 0x3e, 0x11, 0xe9, 0xc2, 0xbd,
-  0x54, 0xbe, 0x3e, 0x3d, 0xd1, 0x2d, 0xa1, 0x3d, 0xc4, 0x01, 0x24, 0xbf,
-  0x0e, 0x77, 0x80, 0xbe, 0x7f, 0xf4, 0x7a, 0xbe, 0x66, 0x53, 0x51, 0xbe,
-  0x3d, 0x3a, 0x45, 0xbe, 0xff, 0x0c, 0x03, 0xbf, 0xf7, 0x3a, 0xcf, 0x3e,
-  0x80, 0xa4, 0xb1, 0xbe, 0xb7, 0x7d, 0xb0, 0xbd, 0x3d, 0xd8, 0x89, 0xbe,
-  0xe0, 0x60, 0xc7, 0x3c, 0x57, 0x1e, 0x3f, 0xbe, 0xe5, 0x30, 0x0e, 0xbd,
-  0xf8, 0x0b, 0xb4, 0x3d, 0x3e, 0x09, 0x2c, 0x3e, 0x2f, 0xa2, 0x00, 0xbe,
-  0x0f, 0xf4, 0x58, 0x3e, 0x7c, 0xc3, 0x4d, 0x3e, 0x9e, 0xe6, 0xf0, 0xbc,
-  0x1d, 0x26, 0x6e, 0xbe, 0x41, 0xd4, 0x62, 0xbd, 0x89, 0x8b, 0x61, 0xbe,
-  0x96, 0x96, 0x75, 0x3c, 0x66, 0x41, 0x9e, 0x3d, 0xb0, 0xef, 0x87, 0xbe,
-  0xef, 0xcf, 0xe3, 0x3d, 0x70, 0x42, 0xa9, 0x3d, 0x91, 0xf6, 0xcf, 0xbd,
-  0xc1, 0x5d, 0x2c, 0xbe, 0x14, 0xf3, 0x9c, 0x3d, 0xf3, 0x1b, 0x57, 0xbd,
-  0xa9, 0x1c, 0x10, 0xbe, 0xf7, 0x6f, 0x96, 0xbd, 0xb9, 0xaa, 0x04, 0x3f,
-  0x0e, 0x50, 0x3e, 0xbe, 0xba, 0xf7, 0x53, 0x3e, 0x38, 0xf5, 0x10, 0x3e,
-  0xbd, 0xbe, 0x1b, 0x3e, 0x86, 0x81, 0x44, 0x3e, 0xfc, 0x49, 0xbd, 0x3c,
-  0x02, 0x94, 0xbd, 0x3e, 0x60, 0x71, 0x65, 0x3e, 0xe4, 0xe3, 0x00, 0xbf,
-  0xed, 0xee, 0x96, 0x3c, 0x27, 0x71, 0x08, 0x3e, 0xb4, 0x84, 0xcb, 0x3d,
-  0x73, 0x63, 0x26, 0xbe, 0x18, 0x92, 0x44, 0xbd, 0x5a, 0x69, 0x00, 0xbd,
-  0x18, 0x35, 0x72, 0x3e, 0xb0, 0xa7, 0x51, 0x3d, 0x8a, 0xcb, 0xad, 0xbc,
-  0x01, 0xea, 0xcb, 0xbc, 0x48, 0x05, 0x28, 0x3e, 0xce, 0xf6, 0x70, 0xbe,
-  0x76, 0x65, 0x1d, 0x3c, 0x95, 0xdf, 0x90, 0x3e, 0xab, 0xd8, 0xe3, 0x3d,
-  0xb7, 0x86, 0x10, 0xbf, 0x7c, 0x99, 0x1e, 0x3e, 0xa4, 0x42, 0xea, 0xbe,
-  0x60, 0x23, 0xf6, 0x3b, 0xa3, 0x2e, 0x08, 0xbf, 0x21, 0x44, 0xe5, 0x3e,
-  0xba, 0x16, 0x3c, 0x3e, 0x2f, 0x9b, 0xb9, 0xbd, 0x2c, 0xab, 0xe1, 0x3e,
-  0xc6, 0xdf, 0xab, 0xbe, 0xda, 0x56, 0x0e, 0xbf, 0xa0, 0xe8, 0xd7, 0xbc,
-  0xf1, 0xba, 0xba, 0xbd, 0xe7, 0xaa, 0x40, 0x3e, 0x8a, 0x10, 0x1e, 0xbf,
-  0x5a, 0x5b, 0x3d, 0xbe, 0xff, 0x08, 0x83, 0x3d, 0xbb, 0x60, 0x3a, 0xbe,
-  0x20, 0x6d, 0xe9, 0x3d, 0xc1, 0x63, 0x60, 0x3d, 0xc6, 0x87, 0xfc, 0xbe,
-  0x77, 0x05, 0xb3, 0xbe, 0x03, 0x97, 0x96, 0x3d, 0x3b, 0xf6, 0xac, 0xbe,
-  0x42, 0xb8, 0x4e, 0x3e, 0x02, 0x84, 0xa0, 0x3e, 0xf3, 0x1a, 0x7b, 0xbc,
-  0x15, 0xfc, 0x81, 0x3d, 0x8d, 0x0f, 0x9a, 0x3d, 0x44, 0x79, 0xfd, 0xbe,
-  0xc5, 0xf8, 0x2c, 0x3e, 0x73, 0x01, 0xd5, 0xbe, 0x16, 0x14, 0x38, 0x3e,
-  0x6d, 0xd1, 0x19, 0xbe, 0x9f, 0xc2, 0x24, 0x3e, 0x26, 0x71, 0x4e, 0xbd,
-  0x65, 0x10, 0x30, 0x3e, 0xdd, 0x49, 0x56, 0x3e, 0x85, 0x2d, 0x37, 0x3c,
-  0x17, 0xa4, 0x28, 0x3f, 0xbc, 0x83, 0xf5, 0xbd, 0x5f, 0x5a, 0x76, 0xbe,
-  0xf2, 0xbc, 0x58, 0x3e, 0x02, 0xfb, 0x06, 0x3c, 0x6c, 0xb5, 0x93, 0x3e,
-  0x08, 0x42, 0x6e, 0xbd, 0xfc, 0xf5, 0x3e, 0x3d, 0xf8, 0x68, 0x7f, 0xbd,
-  0xda, 0x69, 0xc7, 0xbe, 0xcc, 0x07, 0x83, 0xbe, 0xda, 0x3e, 0x04, 0xbe,
-  0x88, 0xd8, 0x0a, 0xbe, 0x9b, 0xdd, 0xcc, 0xbe, 0x48, 0x8b, 0xac, 0xbe,
-  0xd8, 0xa2, 0x9e, 0xbc, 0xc8, 0xaf, 0x64, 0xbe, 0x87, 0xe5, 0xaa, 0xbe,
-  0xbc, 0x62, 0xce, 0x3e, 0x9a, 0x45, 0x1f, 0x3f, 0x86, 0x20, 0x8c, 0x3e,
-  0x2f, 0xd7, 0x83, 0x3e, 0x3a, 0x32, 0x83, 0xbe, 0xd2, 0x8a, 0x19, 0x3e,
-  0xe3, 0xba, 0x69, 0xbd, 0x00, 0xeb, 0x0d, 0xbe, 0xbc, 0x99, 0x09, 0xbe,
-  0xda, 0x02, 0xdd, 0x3d, 0xeb, 0xf9, 0xcb, 0xbc, 0x9f, 0x95, 0x9b, 0xbe,
-  0x91, 0xde, 0x87, 0x3e, 0xa9, 0x14, 0x2f, 0xbe, 0x3e, 0xf2, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00, 0x35, 0xbd, 0xd9, 0xbc,
-  0x00, 0xb7, 0x63, 0x3e, 0xac, 0xfd, 0x32, 0x3e, 0x9f, 0xf6, 0x85, 0xbe,
-  0xc4, 0x61, 0xa5, 0x3e, 0xdc, 0x49, 0xc0, 0xbe, 0x42, 0xad, 0x6f, 0x3e,
-  0xf3, 0x8d, 0x4f, 0xbd, 0x89, 0xd4, 0xab, 0x3e, 0x61, 0x1d, 0x07, 0x3d,
-  0x1e, 0x89, 0x1d, 0x3e, 0xde, 0x15, 0x13, 0xbd, 0x79, 0xa5, 0x8d, 0x3d,
-  0x8a, 0x39, 0xb2, 0x3e, 0x12, 0x9e, 0xa3, 0x3d, 0xe5, 0xa4, 0xdc, 0x3e,
-  0x82, 0x43, 0xe3, 0xbc, 0x42, 0x27, 0x3a, 0xbb, 0x6c, 0x99, 0x8c, 0x3e,
-  0xab, 0x3a, 0x02, 0xbe, 0x03, 0xbc, 0xa9, 0xbe, 0x8b, 0x11, 0x10, 0xbd,
-  0x68, 0x26, 0xa4, 0xbe, 0xbf, 0xaa, 0xfc, 0x3e, 0x09, 0x63, 0xa8, 0xbc,
-  0x6e, 0x60, 0xc9, 0x3c, 0xa1, 0x59, 0xd7, 0x3b, 0x6b, 0x93, 0xac, 0x3d,
-  0x10, 0x3e, 0xac, 0xbe, 0x02, 0xa9, 0x8e, 0x3e, 0xae, 0x6d, 0x06, 0xbd,
-  0x85, 0x18, 0xf3, 0x3c, 0xe0, 0x18, 0x92, 0xbe, 0x24, 0x98, 0x09, 0x3e,
-  0x7f, 0x6a, 0xca, 0x3c, 0x2b, 0x7b, 0x4b, 0xbc, 0xfe, 0x85, 0x52, 0xbd,
-  0x38, 0x0a, 0x2d, 0xbe, 0xfa, 0xa5, 0x2c, 0x3c, 0x45, 0xda, 0x76, 0xbd,
-  0x9b, 0x48, 0xbe, 0x3d, 0xd6, 0x3e, 0x8d, 0x3e, 0x50, 0x86, 0x88, 0x3e,
-  0x2f, 0x1e, 0xe8, 0x3d, 0xb1, 0x88, 0x3f, 0xbe, 0x2a, 0xcd, 0x9d, 0xbe,
-  0x54, 0x56, 0x53, 0x3c, 0x39, 0xe0, 0x7f, 0xbe, 0x5d, 0xe6, 0x1f, 0x3e,
-  0xa2, 0x16, 0x2b, 0x3e, 0x3c, 0x35, 0x92, 0x3d, 0x9d, 0x65, 0xc1, 0xbe,
-  0x15, 0x27, 0x1f, 0x3e, 0x49, 0x68, 0xc3, 0xbc, 0xeb, 0x78, 0xb0, 0x3d,
-  0xc9, 0xc1, 0xf0, 0x3d, 0x58, 0x03, 0x9e, 0xbe, 0xf7, 0xc5, 0x20, 0x3f,
-  0xb3, 0x91, 0xb3, 0xbe, 0xd4, 0xb4, 0xf1, 0xbd, 0xc2, 0x8c, 0x78, 0xbc,
-  0x80, 0x48, 0x93, 0xba, 0x5f, 0xe9, 0xef, 0x3d, 0xb5, 0xb7, 0xa0, 0x3d,
-  0x4f, 0x67, 0x69, 0x3e, 0x11, 0x5f, 0xfb, 0x3d, 0xea, 0x29, 0x8a, 0xbe,
-  0xa1, 0xef, 0x71, 0x3e, 0x02, 0x8b, 0x0b, 0x3f, 0xcd, 0x98, 0xce, 0x3c,
-  0xb0, 0xb4, 0xdf, 0x3d, 0xc7, 0x33, 0x07, 0xbe, 0x3e, 0x18, 0xa8, 0xbe,
-  0x63, 0xd8, 0xbe, 0x3e, 0x02, 0x1f, 0x93, 0x3e, 0x77, 0x2c, 0x0d, 0x3f,
-  0xd7, 0x86, 0x8d, 0xbd, 0xc4, 0xcd, 0x39, 0xbb, 0xc0, 0xaa, 0x64, 0x3d,
-  0x16, 0xbc, 0xb3, 0xbc, 0x0a, 0xec, 0xbb, 0xbe, 0xb9, 0xa5, 0xa9, 0x3e,
-  0xfd, 0xbd, 0x8e, 0xbe, 0x23, 0x2f, 0x3b, 0xbe, 0x28, 0x4d, 0x07, 0xbc,
-  0xfa, 0xee, 0xe5, 0x3c, 0xe6, 0xc2, 0x8b, 0xbd, 0xe4, 0x7d, 0x81, 0x3e,
-  0xac, 0x96, 0xc1, 0xbe, 0x5a, 0x06, 0x66, 0x3e, 0x17, 0xab, 0xad, 0x3d,
-  0x42, 0xfa, 0xb2, 0x3d, 0x0c, 0xc2, 0xee, 0xbd, 0xd6, 0x01, 0x14, 0xbe,
-  0x21, 0x1c, 0x1c, 0xbf, 0xa2, 0x8c, 0x38, 0x3d, 0xac, 0xba, 0x0d, 0x3d,
-  0xf3, 0x2e, 0x24, 0xbe, 0x35, 0x04, 0x89, 0x3e, 0xac, 0x4e, 0x0b, 0xbe,
-  0x8e, 0x03, 0xb3, 0x3e, 0xfc, 0x5c, 0xc1, 0xbe, 0x58, 0x8d, 0x91, 0x3e,
-  0x43, 0x62, 0x99, 0x3d, 0x4e, 0xd2, 0xb5, 0x3d, 0x10, 0x58, 0x94, 0x3e,
-  0xe9, 0x70, 0xd7, 0x3d, 0x8f, 0xce, 0xef, 0x3d, 0xb9, 0x53, 0xa9, 0x3d,
-  0x30, 0xe5, 0x87, 0xbe, 0x7a, 0xeb, 0xc3, 0xbe, 0xf5, 0x13, 0x63, 0x3d,
-  0x67, 0x29, 0x82, 0x3c, 0x07, 0x65, 0x8b, 0xbc, 0x89, 0x70, 0xe5, 0x3d,
-  0xf4, 0x49, 0xaa, 0xbe, 0x8a, 0x0e, 0xd3, 0x3e, 0x11, 0x54, 0x74, 0xbe,
-  0x81, 0x75, 0xae, 0xbe, 0x9d, 0xb8, 0x7f, 0x3e, 0xfe, 0xf6, 0x18, 0xbf,
-  0x82, 0x98, 0x3b, 0xbe, 0x50, 0x82, 0xfc, 0xbd, 0xa0, 0xd2, 0xd8, 0x3d,
-  0x8e, 0xec, 0x99, 0x3d, 0x54, 0x5b, 0x87, 0x3d, 0xa7, 0xa3, 0x71, 0x3e,
-  0xba, 0xd2, 0x2b, 0x3d, 0x86, 0xe5, 0x5c, 0x3e, 0x50, 0xf6, 0xf5, 0xbd,
-  0x87, 0x0b, 0x6b, 0x3a, 0xe3, 0x54, 0xa3, 0x3e, 0xc5, 0x2e, 0x0d, 0xbe,
-  0x30, 0xc0, 0x73, 0x3e, 0x85, 0x36, 0xa8, 0x3e, 0x70, 0x4d, 0xe0, 0xbd,
-  0xe6, 0x39, 0x93, 0x3e, 0x76, 0x14, 0xfa, 0xbd, 0x9a, 0xab, 0x0c, 0xbe,
-  0x1b, 0x0e, 0x27, 0xbd, 0x16, 0x3c, 0xd8, 0xbe, 0x57, 0x49, 0x18, 0xbd,
-  0x44, 0xdf, 0xb2, 0x3e, 0x15, 0xbb, 0x96, 0xbe, 0xc5, 0x0b, 0xb4, 0x3d,
-  0x22, 0xe2, 0x6d, 0x3e, 0x4d, 0x36, 0x92, 0xbe, 0x64, 0x9d, 0x4a, 0x3d,
-  0xf8, 0xa9, 0xc7, 0x3c, 0xb0, 0x26, 0x8f, 0x3d, 0x06, 0xba, 0xa1, 0x3d,
-  0x45, 0x9a, 0xc5, 0xbd, 0x59, 0x6a, 0x02, 0xbe, 0x7e, 0xfc, 0x15, 0xbe,
-  0x3a, 0xd5, 0x67, 0xbe, 0xc0, 0x18, 0x8d, 0x3d, 0xde, 0x36, 0x16, 0xbe,
-  0x7f, 0x13, 0x8b, 0xbe, 0x87, 0xdd, 0xff, 0xbc, 0x52, 0x30, 0xf4, 0xbd,
-  0x80, 0x7d, 0x2c, 0x3c, 0x24, 0x29, 0x78, 0x3e, 0xe7, 0x40, 0x56, 0xbd,
-  0xae, 0x97, 0xc2, 0xbe, 0xa4, 0x14, 0xcb, 0x3e, 0x3a, 0x43, 0x85, 0x3d,
-  0x07, 0x07, 0xd1, 0xbe, 0x9e, 0x93, 0xe4, 0x3c, 0xfb, 0xe2, 0x15, 0x3e,
-  0x25, 0x17, 0xdc, 0xbd, 0xd7, 0x82, 0x89, 0x3e, 0x46, 0x8a, 0x0f, 0xbf,
-  0x76, 0x3e, 0x76, 0xbe, 0xb0, 0xc6, 0xa1, 0x3d, 0x0a, 0xf3, 0x97, 0xbd,
-  0xe3, 0x17, 0x27, 0x3e, 0xba, 0x20, 0x7f, 0xbe, 0x7c, 0x1e, 0xc8, 0x3e,
-  0x8e, 0xd4, 0x95, 0xbe, 0x19, 0xf5, 0x5b, 0xbe, 0xe8, 0xf9, 0xa8, 0xbe,
-  0xcb, 0x3d, 0xcb, 0xbd, 0xc1, 0x33, 0x2e, 0xbe, 0x77, 0x3b, 0x51, 0xbd,
-  0xb0, 0xcc, 0x80, 0x3d, 0x07, 0x8b, 0x87, 0x3e, 0x43, 0xae, 0xb3, 0xbd,
-  0x1f, 0xc1, 0xa0, 0x3e, 0x7f, 0x0c, 0xb8, 0xba, 0x1a, 0xfd, 0xaa, 0x3d,
-  0xed, 0x6a, 0xe2, 0xbc, 0x8c, 0xa6, 0xa4, 0x3d, 0x9f, 0x0d, 0x20, 0xbe,
-  0x8b, 0x4e, 0xd6, 0x3e, 0x82, 0x5a, 0xb6, 0xbd, 0xaf, 0x6b, 0x2f, 0xbe,
-  0x28, 0x14, 0x9f, 0x3e, 0xd5, 0xcb, 0x7c, 0xbe, 0xbf, 0xa9, 0x96, 0x3e,
-  0x7a, 0xd4, 0xca, 0x3d, 0x6b, 0x83, 0x8c, 0x3d, 0x91, 0xb6, 0xbf, 0x3d,
-  0x6b, 0xcb, 0xbf, 0x3d, 0x38, 0xf9, 0x89, 0x3e, 0x89, 0x33, 0xdd, 0xbe,
-  0xef, 0x97, 0xa1, 0x3e, 0xe2, 0x35, 0x14, 0xbe, 0x86, 0xa0, 0xdb, 0xbd,
-  0x50, 0x28, 0xe9, 0x3d, 0xbe, 0x80, 0x70, 0x3d, 0x6b, 0xf7, 0x23, 0x3e,
-  0xea, 0xf4, 0x93, 0xbe, 0x01, 0x35, 0xe6, 0xbc, 0x3d, 0xe0, 0xd0, 0x3d,
-  0x74, 0x86, 0x19, 0x3e, 0xda, 0xa6, 0x87, 0x3e, 0x03, 0x4a, 0x8a, 0x3e,
-  0x9b, 0x9d, 0xb7, 0xbb, 0x88, 0xbe, 0x8d, 0xbe, 0x4b, 0xc7, 0x23, 0xbe,
-  0x48, 0x1b, 0xdc, 0x3d, 0x13, 0xb5, 0x95, 0x3e, 0xc6, 0x3a, 0xcc, 0x3e,
-  0x07, 0x1b, 0x8d, 0x3d, 0xdd, 0xc3, 0x48, 0xbe, 0x0e, 0xef, 0x65, 0x3e,
-  0xd4, 0xde, 0x73, 0xbd, 0x7e, 0x67, 0x18, 0xbe, 0x20, 0xce, 0x70, 0xbc,
-  0x9a, 0x1f, 0x5e, 0xbc, 0x10, 0x13, 0x05, 0x3d, 0x38, 0x02, 0x84, 0xbd,
-  0x6d, 0x9c, 0x64, 0x3e, 0xf1, 0x3b, 0x00, 0xbe, 0x76, 0x5e, 0x78, 0x3e,
-  0x42, 0xcd, 0x5b, 0x3d, 0x99, 0xe6, 0x02, 0xbe, 0x65, 0x1b, 0xea, 0x3c,
-  0xf4, 0x23, 0x74, 0x3e, 0x7f, 0xe7, 0xc6, 0x3c, 0x14, 0xce, 0x0a, 0x3e,
-  0x18, 0x22, 0x01, 0x3e, 0x4b, 0x41, 0xa0, 0x3b, 0xc2, 0xee, 0x78, 0x3d,
-  0x83, 0x8c, 0x16, 0x3e, 0x86, 0x46, 0x02, 0xbe, 0x20, 0x33, 0xa9, 0xbe,
-  0x41, 0x78, 0x72, 0xbe, 0x58, 0xda, 0x79, 0xbd, 0x3c, 0x4f, 0xaf, 0xbd,
-  0xeb, 0x25, 0x11, 0x3e, 0xda, 0xfa, 0x3a, 0x3d, 0xca, 0x90, 0x5b, 0x3e,
-  0xc7, 0xab, 0x8d, 0xbe, 0x71, 0xd6, 0x6a, 0xbd, 0x5b, 0x32, 0xd7, 0xbd,
-  0x96, 0x85, 0x79, 0xbe, 0x89, 0xc7, 0x86, 0xbe, 0x03, 0xc7, 0x05, 0xbe,
-  0x29, 0x4b, 0x2d, 0xbd, 0x4f, 0x55, 0x69, 0x3d, 0x1a, 0x8a, 0x49, 0xbd,
-  0xed, 0x40, 0x9f, 0xbe, 0x3a, 0x40, 0xc0, 0x3d, 0x81, 0xc9, 0x6c, 0x3e,
-  0xac, 0x05, 0x19, 0xb9, 0x2d, 0x75, 0x54, 0xbe, 0xf9, 0x1c, 0x5b, 0xbe,
-  0x28, 0x07, 0xaa, 0xbe, 0xbc, 0x81, 0xab, 0xbe, 0x2c, 0x25, 0x0a, 0xbe,
-  0x1e, 0x77, 0x62, 0xbe, 0x1c, 0x3f, 0x1d, 0x3e, 0xa4, 0x27, 0x28, 0x3e,
-  0xf6, 0xd6, 0x6c, 0xbd, 0x13, 0x91, 0x0e, 0xbd, 0xed, 0xdc, 0x31, 0x3e,
-  0xde, 0xa5, 0x85, 0x3e, 0x23, 0xe0, 0x98, 0x3d, 0xc1, 0x91, 0x28, 0x3e,
-  0x0f, 0x43, 0xcc, 0xbd, 0x69, 0x9f, 0x17, 0x3d, 0xb2, 0x00, 0x84, 0x3d,
-  0xd3, 0xb7, 0x36, 0x3c, 0xc9, 0xc2, 0x80, 0x3e, 0x7b, 0x02, 0xe6, 0x3e,
-  0xf9, 0x0a, 0x01, 0xbe, 0xe8, 0x4c, 0x54, 0xba, 0x4d, 0xce, 0xa4, 0x3d,
-  0xad, 0x49, 0x83, 0x3c, 0x8a, 0xb9, 0xe0, 0xbc, 0x5b, 0x25, 0x88, 0x3e,
-  0x71, 0xed, 0x0e, 0x3e, 0x71, 0xc7, 0x46, 0x3e, 0x49, 0x08, 0x22, 0x3e,
-  0x6f, 0x06, 0x63, 0x3d, 0x0e, 0x8b, 0x24, 0xbe, 0x0b, 0x1e, 0x16, 0x3e,
-  0x61, 0xa4, 0x39, 0xbe, 0x08, 0x85, 0xcd, 0xbd, 0xa3, 0xf1, 0x5f, 0xbe,
-  0x07, 0x32, 0x39, 0x3e, 0x2f, 0x67, 0xad, 0x3d, 0x33, 0x16, 0xd0, 0xbe,
-  0xdf, 0xe3, 0x39, 0xbe, 0xf9, 0x97, 0x45, 0x3e, 0x6a, 0xdd, 0x26, 0xbe,
-  0xe6, 0xe5, 0x92, 0x3d, 0x97, 0x12, 0x83, 0x3e, 0xcb, 0x41, 0x8a, 0xbe,
-  0xd1, 0xbd, 0x8c, 0x3d, 0x4b, 0x6f, 0x10, 0xbe, 0x5c, 0xcc, 0x90, 0xbe,
-  0x96, 0x6c, 0xb3, 0x3e, 0x82, 0x67, 0x11, 0x3e, 0x39, 0x67, 0x86, 0x3e,
-  0xb0, 0x13, 0xfb, 0x3d, 0x2c, 0x66, 0x43, 0x3e, 0x94, 0x30, 0xd3, 0xbe,
-  0x71, 0xb3, 0x40, 0xbd, 0x41, 0x18, 0x0a, 0x3e, 0x9e, 0x0e, 0x8c, 0xbc,
-  0x96, 0x23, 0xa0, 0x3e, 0xca, 0xa7, 0x0c, 0xbe, 0xf0, 0x6a, 0x8e, 0x3b,
-  0x9e, 0x54, 0x6f, 0x3d, 0x2c, 0xcb, 0x2a, 0xbe, 0x6a, 0x35, 0x7e, 0x3e,
-  0x00, 0x1c, 0xb4, 0x3e, 0x5a, 0xf2, 0xe2, 0xbe, 0xa2, 0x4f, 0xf4, 0x3d,
-  0x70, 0x2c, 0x73, 0x3b, 0x62, 0x1d, 0x18, 0x3e, 0x74, 0x7e, 0xeb, 0xbc,
-  0x16, 0x5c, 0xb4, 0x3e, 0xda, 0xae, 0xe0, 0xbd, 0x06, 0x71, 0x6f, 0x3d,
-  0xb9, 0xe5, 0x23, 0x3d, 0x3d, 0x1c, 0x24, 0x3e, 0xb9, 0x36, 0xf2, 0x3c,
-  0x2d, 0xea, 0xf8, 0xbd, 0x0f, 0x72, 0x0d, 0x3e, 0x4f, 0xfa, 0xe2, 0xbc,
-  0xc6, 0xc8, 0xa3, 0x3d, 0xcb, 0x92, 0x64, 0x3e, 0xf2, 0x4b, 0xcb, 0x3d,
-  0xf2, 0x7d, 0xe7, 0x3d, 0x50, 0x0e, 0x94, 0x3e, 0xfc, 0x31, 0xc8, 0xbe,
-  0x9b, 0x1c, 0xa5, 0x3e, 0x8b, 0x52, 0xa3, 0x3e, 0x04, 0x3a, 0x9f, 0x3e,
-  0xa5, 0xa4, 0x39, 0x3d, 0x53, 0x8b, 0xbd, 0xbe, 0x94, 0x9b, 0xa9, 0xbe,
-  0x66, 0x89, 0x80, 0x3d, 0xa4, 0x5a, 0x64, 0x3e, 0x30, 0xbb, 0x33, 0x3d,
-  0x2b, 0x2d, 0x23, 0x3e, 0xa6, 0x57, 0x02, 0xbd, 0x25, 0x44, 0xe5, 0xbe,
-  0x2c, 0xc9, 0x2c, 0x3e, 0xaa, 0x35, 0x50, 0xbe, 0x70, 0x5e, 0x59, 0xbe,
-  0xb8, 0x80, 0x46, 0xbd, 0x68, 0xac, 0xc7, 0x3e, 0x36, 0xdc, 0xe5, 0xbb,
-  0x51, 0xa5, 0x4d, 0x3c, 0x9a, 0xb0, 0x86, 0xbd, 0xf9, 0x5d, 0x4a, 0x3e,
-  0x4d, 0x90, 0x2d, 0x3d, 0xa7, 0x11, 0x80, 0xbe, 0x32, 0xd8, 0x02, 0xbe,
-  0xe6, 0xea, 0xb5, 0x3e, 0xb7, 0x6a, 0xe5, 0xbd, 0xeb, 0x96, 0x35, 0x3d,
-  0x90, 0xee, 0x41, 0x3e, 0xba, 0x83, 0xf5, 0x3d, 0xb2, 0x5a, 0xd0, 0xbd,
-  0xe3, 0x6a, 0x48, 0x3d, 0xa6, 0x21, 0x1b, 0xbe, 0x92, 0x4b, 0x3c, 0x3e,
-  0xa3, 0xa9, 0xf6, 0x3e, 0xd3, 0x8b, 0xde, 0x3d, 0x58, 0x4a, 0xab, 0x3e,
-  0x4c, 0xc5, 0xe1, 0xbe, 0xf1, 0x96, 0x5e, 0xbc, 0xcd, 0xf3, 0xbd, 0x3d,
-  0x77, 0xcc, 0xe2, 0x3e, 0x48, 0x95, 0x4c, 0xbd, 0x0a, 0x75, 0x09, 0x3e,
-  0xb0, 0xf4, 0xa9, 0x3d, 0x0d, 0x42, 0xa8, 0x3d, 0x27, 0x80, 0x99, 0xbe,
-  0x84, 0x75, 0xd7, 0xbe, 0x4f, 0x2b, 0x56, 0xbd, 0x5e, 0xa6, 0xc6, 0xbe,
-  0xff, 0x36, 0xe9, 0x3d, 0x6d, 0xfb, 0x27, 0xbe, 0x3a, 0xf5, 0x08, 0xbe,
-  0x8a, 0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00,
+  0xad, 0xf1, 0x96, 0xbf, 0xd2, 0xeb, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00, 0x58, 0x30, 0x2c, 0xbf,
+  0x9d, 0xb7, 0x88, 0x3e, 0xb3, 0x63, 0xf7, 0xbd, 0x7e, 0x11, 0xe3, 0xbe,
+  0xde, 0x86, 0x72, 0x3e, 0xcb, 0x8e, 0xb5, 0xbc, 0xd3, 0x98, 0xdb, 0xbe,
+  0xb3, 0x46, 0xc8, 0x3e, 0x80, 0x5c, 0x3a, 0xbd, 0x8c, 0x25, 0xdb, 0x3d,
+  0x96, 0x5f, 0xd7, 0x3e, 0x2c, 0xe7, 0xab, 0xbd, 0x57, 0xd3, 0x6e, 0xbe,
+  0x20, 0xe8, 0x8c, 0x3e, 0x27, 0xb4, 0x5c, 0x3d, 0x06, 0xf5, 0x5b, 0xbc,
+  0xd8, 0xde, 0xa9, 0x3d, 0x50, 0x9c, 0xc1, 0xbd, 0xe6, 0x40, 0x0e, 0x3f,
+  0x39, 0xb4, 0xae, 0xbe, 0xa2, 0x2f, 0x8d, 0xbe, 0x25, 0x2f, 0xb7, 0x3d,
+  0xb4, 0xdf, 0xce, 0x3d, 0x77, 0xbd, 0x95, 0xbe, 0x5a, 0x89, 0xca, 0x3e,
+  0x60, 0xa8, 0x70, 0xbe, 0x06, 0x85, 0xdc, 0xbd, 0x4b, 0x1d, 0xda, 0x3e,
+  0x05, 0x08, 0x06, 0xbd, 0x73, 0xa2, 0x28, 0x3d, 0xc4, 0x01, 0x03, 0x3e,
+  0x26, 0x29, 0xa6, 0xbe, 0x15, 0xa0, 0x9d, 0xbe, 0x44, 0xe4, 0xae, 0xbe,
+  0x09, 0x81, 0x8f, 0xbe, 0xc3, 0xac, 0x5e, 0xbe, 0x07, 0xf0, 0xb1, 0xbe,
+  0xe4, 0x03, 0xf3, 0xbe, 0x7f, 0x62, 0xad, 0x3e, 0x4f, 0x40, 0x1d, 0xbf,
+  0xc7, 0x17, 0xb6, 0xbd, 0xcb, 0x15, 0x17, 0xbd, 0x0f, 0x25, 0x29, 0x3e,
+  0xdb, 0xec, 0x79, 0xbe, 0xeb, 0x70, 0xca, 0xbd, 0xf0, 0xb7, 0xf3, 0x3e,
+  0x80, 0x8b, 0xa2, 0x3d, 0x10, 0x12, 0x05, 0x3d, 0x6f, 0x86, 0xb1, 0xbe,
+  0x9d, 0xef, 0xd8, 0x3c, 0xec, 0xc8, 0x01, 0xbe, 0x61, 0xeb, 0xc7, 0x3e,
+  0xd7, 0x34, 0x2a, 0x3e, 0x03, 0x52, 0x49, 0xbe, 0x87, 0x3a, 0x9b, 0x3d,
+  0xd1, 0xeb, 0x0a, 0x3e, 0xc4, 0x07, 0x3c, 0x3f, 0xb2, 0x5f, 0x9e, 0xbe,
+  0x35, 0xb7, 0xc9, 0xbd, 0x33, 0x3b, 0x5b, 0x3d, 0x8c, 0x45, 0x8e, 0xbd,
+  0x37, 0x4b, 0x94, 0xbe, 0xe4, 0xd4, 0xfd, 0xbe, 0xaa, 0xb2, 0x3c, 0x3d,
+  0xf5, 0xaa, 0x9b, 0x3e, 0x92, 0xc0, 0x1d, 0xbe, 0xd2, 0xd2, 0x12, 0x3e,
+  0x11, 0x15, 0x75, 0x3e, 0xb4, 0x1a, 0xb7, 0x3e, 0xeb, 0x3d, 0x55, 0xbe,
+  0xf7, 0x2f, 0x29, 0xbe, 0x76, 0x0b, 0x5b, 0xbe, 0x45, 0x41, 0xb4, 0x3e,
+  0xed, 0x21, 0xd4, 0x3d, 0xda, 0x5c, 0x46, 0xbe, 0x06, 0xf8, 0x83, 0xbd,
+  0x83, 0x49, 0xcb, 0x3d, 0x29, 0x5c, 0x2f, 0x3e, 0x08, 0xd3, 0xea, 0x3d,
+  0x83, 0x0d, 0x7f, 0x3e, 0x17, 0x8c, 0xac, 0xbc, 0x7e, 0xed, 0xef, 0x3d,
+  0x2a, 0x6a, 0xd8, 0xbe, 0x13, 0x7e, 0x48, 0x3e, 0x50, 0x9b, 0x6c, 0x3e,
+  0x3d, 0x30, 0x1d, 0xbf, 0x08, 0x46, 0xfd, 0x3d, 0x2d, 0xa5, 0x3a, 0x3e,
+  0x0e, 0xe1, 0x96, 0x3e, 0xc1, 0x8f, 0x8e, 0x3e, 0x52, 0x59, 0x58, 0xbe,
+  0x69, 0x76, 0x13, 0xbc, 0x6c, 0x5e, 0x4c, 0xbe, 0x14, 0x0e, 0xb7, 0x3e,
+  0x72, 0x14, 0xd9, 0xbd, 0xdc, 0xd2, 0x8c, 0x3d, 0x1e, 0xde, 0x69, 0xbb,
+  0xb7, 0xca, 0x34, 0xbe, 0x8f, 0x83, 0xe8, 0x3e, 0xa4, 0x3c, 0xb8, 0x3d,
+  0xde, 0x62, 0xe9, 0xbe, 0xaf, 0x94, 0xad, 0xbd, 0xa7, 0xdb, 0x9c, 0x3e,
+  0x2a, 0xac, 0x8a, 0x3e, 0x61, 0x83, 0xc8, 0x3e, 0xea, 0xbd, 0xa1, 0xbc,
+  0xf5, 0x46, 0x71, 0xbe, 0x20, 0x43, 0x33, 0x3f, 0xfb, 0x54, 0x24, 0x3f,
+  0x9c, 0x15, 0x91, 0x3e, 0xe7, 0x44, 0x16, 0xbe, 0x00, 0x9f, 0x10, 0x3e,
+  0x36, 0xee, 0x6d, 0x3e, 0x31, 0xa2, 0x98, 0x3d, 0x29, 0x76, 0x36, 0xbe,
+  0x57, 0x7e, 0x94, 0xbd, 0x23, 0x19, 0x55, 0xbe, 0x2e, 0x68, 0xee, 0xbe,
+  0xfd, 0xea, 0xd4, 0x3e, 0x69, 0xbd, 0x4f, 0xbd, 0x08, 0x2e, 0x4a, 0xbd,
+  0x55, 0x01, 0x09, 0x3e, 0xed, 0x06, 0x85, 0xbc, 0xd3, 0x18, 0x01, 0xbf,
+  0x25, 0x58, 0x59, 0xbe, 0x25, 0xa3, 0x01, 0x3e, 0x33, 0x9a, 0x6b, 0x3d,
+  0x30, 0x82, 0x94, 0xbd, 0x67, 0x0c, 0x0f, 0x3e, 0x13, 0xdb, 0xc1, 0x3d,
+  0xb2, 0x56, 0xe7, 0x3d, 0x63, 0xc0, 0x74, 0x3e, 0x5d, 0x9b, 0x89, 0xbd,
+  0x42, 0x69, 0xb9, 0x3d, 0xb1, 0x85, 0x23, 0x3d, 0x02, 0xe8, 0xf0, 0xbd,
+  0xb3, 0x43, 0x12, 0x3e, 0x4b, 0x27, 0xa6, 0x3e, 0xbe, 0x89, 0x72, 0xbd,
+  0xba, 0x83, 0xde, 0x3d, 0xfb, 0x09, 0x84, 0x3e, 0xff, 0xaf, 0xa2, 0x3d,
+  0xaa, 0x89, 0xd8, 0xbd, 0x5f, 0x85, 0x1f, 0xbe, 0x46, 0xf2, 0x24, 0x3e,
+  0xc0, 0x83, 0x55, 0x3d, 0x61, 0x28, 0x73, 0xbd, 0xd0, 0x5e, 0xa4, 0x3d,
+  0xab, 0x77, 0xc2, 0xbe, 0x69, 0x1e, 0xdf, 0x3e, 0x77, 0x41, 0xdb, 0xbc,
+  0x62, 0xe0, 0xee, 0xbc, 0xfc, 0x69, 0x60, 0x3d, 0x50, 0x50, 0x79, 0x3d,
+  0xd7, 0x59, 0x72, 0x3e, 0x8b, 0x95, 0x59, 0xbc, 0x4e, 0xb0, 0x43, 0xbe,
+  0xd5, 0x53, 0x8a, 0x3e, 0x37, 0x00, 0xf3, 0x3d, 0x96, 0x4f, 0x4f, 0x3d,
+  0x5e, 0xd1, 0x4c, 0x3e, 0xa6, 0xfe, 0x8e, 0xbd, 0x2e, 0xdd, 0x60, 0x3e,
+  0x5a, 0xd1, 0xff, 0xbd, 0x50, 0x5c, 0xc0, 0x3d, 0xe0, 0x0f, 0x68, 0xbd,
+  0x25, 0x1a, 0x6c, 0xbc, 0x03, 0x6e, 0x76, 0xbe, 0xc5, 0x5b, 0x27, 0x3d,
+  0xb9, 0x62, 0x07, 0xbe, 0x6b, 0x46, 0xc8, 0xbe, 0x14, 0xef, 0x12, 0x3e,
+  0xc3, 0x6b, 0x3c, 0xbe, 0x73, 0xab, 0x00, 0x3d, 0x65, 0xea, 0xa2, 0xbd,
+  0x51, 0x81, 0xe1, 0x3c, 0x5a, 0xba, 0x27, 0xbd, 0x29, 0x71, 0xe5, 0x3e,
+  0xe4, 0x72, 0xe1, 0xbd, 0x6d, 0xf7, 0x3a, 0x3e, 0x17, 0x84, 0x10, 0xbf,
+  0x3e, 0x2d, 0x1a, 0xbe, 0x77, 0xf9, 0x78, 0x3c, 0x08, 0x4b, 0x98, 0xbe,
+  0xd0, 0x2d, 0x34, 0xbd, 0xbb, 0x1c, 0xd9, 0x3e, 0x8c, 0xa6, 0x7f, 0xbe,
+  0xeb, 0x86, 0xde, 0x3e, 0x4c, 0x90, 0x12, 0x3f, 0x35, 0x07, 0x53, 0xbd,
+  0x7f, 0xf3, 0xd9, 0xbb, 0xe7, 0x33, 0xcd, 0x3d, 0xa7, 0x30, 0xbf, 0xbd,
+  0x8d, 0x8e, 0x21, 0x3e, 0x70, 0xb7, 0x8b, 0xbe, 0xe1, 0xed, 0x77, 0x3e,
+  0xfb, 0x7c, 0x4f, 0xbd, 0xec, 0xc5, 0x0a, 0xbf, 0x04, 0xf6, 0xcb, 0x3e,
+  0x8e, 0xb3, 0x85, 0xbe, 0x23, 0xc7, 0x2c, 0xbd, 0x46, 0xfd, 0xac, 0x3d,
+  0x59, 0x68, 0x8c, 0x3e, 0x46, 0x44, 0xba, 0xbd, 0xe4, 0x07, 0xcd, 0x3e,
+  0x50, 0x18, 0xf2, 0xbe, 0xd9, 0xf6, 0x07, 0xbe, 0xe7, 0x88, 0xc1, 0x3e,
+  0x6e, 0x52, 0x9b, 0x3e, 0xb3, 0x1d, 0x4b, 0xbe, 0x2b, 0x1f, 0x37, 0xbe,
+  0x96, 0x9e, 0x3d, 0x3e, 0x82, 0x7d, 0x0f, 0x3c, 0xf8, 0x6a, 0x40, 0xbe,
+  0xb6, 0xc7, 0xca, 0xbe, 0x1c, 0x8b, 0x38, 0xbc, 0x3d, 0xcd, 0x58, 0xbe,
+  0x7d, 0x5f, 0xf1, 0x3c, 0x8f, 0x52, 0x8c, 0x3e, 0x9b, 0xbb, 0x80, 0x3e,
+  0x14, 0x13, 0x91, 0xbe, 0x6f, 0xb4, 0x13, 0xbe, 0x57, 0x1e, 0x02, 0xbe,
+  0x1e, 0x82, 0x4d, 0x3d, 0x7b, 0x4c, 0x65, 0x3d, 0xa1, 0xa2, 0xf0, 0x3c,
+  0x82, 0x41, 0x82, 0xbc, 0xe4, 0xab, 0xfa, 0x3e, 0xf4, 0x05, 0xee, 0x3e,
+  0x04, 0xd7, 0x9a, 0x3d, 0x96, 0x00, 0x46, 0x3e, 0x0b, 0x88, 0xd6, 0x3e,
+  0x56, 0xc4, 0xdc, 0xbc, 0xdc, 0x45, 0xcc, 0xbe, 0x95, 0x5c, 0x9b, 0x3e,
+  0x7b, 0x0d, 0x8a, 0xbd, 0x2c, 0x1f, 0xdd, 0x3d, 0xba, 0x7b, 0x09, 0xbe,
+  0xe6, 0x0c, 0x90, 0x3d, 0x95, 0x8c, 0x8d, 0x3c, 0xab, 0xda, 0x06, 0x3e,
+  0x58, 0x96, 0x92, 0xbe, 0xc7, 0xda, 0x7d, 0xbb, 0xed, 0xe2, 0x4a, 0xbe,
+  0x17, 0x34, 0x28, 0x3e, 0x89, 0x85, 0x16, 0x3e, 0xe4, 0x43, 0x1a, 0xbe,
+  0x80, 0x54, 0x24, 0xbe, 0xf2, 0x84, 0xed, 0x3e, 0xe2, 0xbc, 0x22, 0xbe,
+  0x8b, 0xa8, 0x1f, 0xbd, 0x09, 0xb9, 0xf1, 0x3c, 0xf0, 0x85, 0x86, 0xbe,
+  0x36, 0x79, 0x1b, 0xbf, 0x96, 0x59, 0xdd, 0xbe, 0xd2, 0xd6, 0xe0, 0xbd,
+  0x41, 0x7d, 0x61, 0xbe, 0x9a, 0x45, 0xab, 0x3d, 0xdf, 0x40, 0x05, 0xbf,
+  0xe1, 0xaa, 0xd7, 0x3e, 0x30, 0x60, 0x0c, 0x3e, 0x24, 0xef, 0xa2, 0x3d,
+  0x24, 0x6a, 0xeb, 0x3e, 0x35, 0x75, 0x26, 0xbf, 0x38, 0xa7, 0xaf, 0x3e,
+  0xb0, 0x2d, 0x89, 0x3e, 0xc2, 0x18, 0x61, 0xbe, 0x6c, 0xce, 0x22, 0x3e,
+  0x11, 0xe9, 0xc2, 0xbd, 0x54, 0xbe, 0x3e, 0x3d, 0xd1, 0x2d, 0xa1, 0x3d,
+  0xc4, 0x01, 0x24, 0xbf, 0x0e, 0x77, 0x80, 0xbe, 0x7f, 0xf4, 0x7a, 0xbe,
+  0x66, 0x53, 0x51, 0xbe, 0x3d, 0x3a, 0x45, 0xbe, 0xff, 0x0c, 0x03, 0xbf,
+  0xf7, 0x3a, 0xcf, 0x3e, 0x80, 0xa4, 0xb1, 0xbe, 0xb7, 0x7d, 0xb0, 0xbd,
+  0x3d, 0xd8, 0x89, 0xbe, 0xe0, 0x60, 0xc7, 0x3c, 0x57, 0x1e, 0x3f, 0xbe,
+  0xe5, 0x30, 0x0e, 0xbd, 0xf8, 0x0b, 0xb4, 0x3d, 0x3e, 0x09, 0x2c, 0x3e,
+  0x2f, 0xa2, 0x00, 0xbe, 0x0f, 0xf4, 0x58, 0x3e, 0x7c, 0xc3, 0x4d, 0x3e,
+  0x9e, 0xe6, 0xf0, 0xbc, 0x1d, 0x26, 0x6e, 0xbe, 0x41, 0xd4, 0x62, 0xbd,
+  0x89, 0x8b, 0x61, 0xbe, 0x96, 0x96, 0x75, 0x3c, 0x66, 0x41, 0x9e, 0x3d,
+  0xb0, 0xef, 0x87, 0xbe, 0xef, 0xcf, 0xe3, 0x3d, 0x70, 0x42, 0xa9, 0x3d,
+  0x91, 0xf6, 0xcf, 0xbd, 0xc1, 0x5d, 0x2c, 0xbe, 0x14, 0xf3, 0x9c, 0x3d,
+  0xf3, 0x1b, 0x57, 0xbd, 0xa9, 0x1c, 0x10, 0xbe, 0xf7, 0x6f, 0x96, 0xbd,
+  0xb9, 0xaa, 0x04, 0x3f, 0x0e, 0x50, 0x3e, 0xbe, 0xba, 0xf7, 0x53, 0x3e,
+  0x38, 0xf5, 0x10, 0x3e, 0xbd, 0xbe, 0x1b, 0x3e, 0x86, 0x81, 0x44, 0x3e,
+  0xfc, 0x49, 0xbd, 0x3c, 0x02, 0x94, 0xbd, 0x3e, 0x60, 0x71, 0x65, 0x3e,
+  0xe4, 0xe3, 0x00, 0xbf, 0xed, 0xee, 0x96, 0x3c, 0x27, 0x71, 0x08, 0x3e,
+  0xb4, 0x84, 0xcb, 0x3d, 0x73, 0x63, 0x26, 0xbe, 0x18, 0x92, 0x44, 0xbd,
+  0x5a, 0x69, 0x00, 0xbd, 0x18, 0x35, 0x72, 0x3e, 0xb0, 0xa7, 0x51, 0x3d,
+  0x8a, 0xcb, 0xad, 0xbc, 0x01, 0xea, 0xcb, 0xbc, 0x48, 0x05, 0x28, 0x3e,
+  0xce, 0xf6, 0x70, 0xbe, 0x76, 0x65, 0x1d, 0x3c, 0x95, 0xdf, 0x90, 0x3e,
+  0xab, 0xd8, 0xe3, 0x3d, 0xb7, 0x86, 0x10, 0xbf, 0x7c, 0x99, 0x1e, 0x3e,
+  0xa4, 0x42, 0xea, 0xbe, 0x60, 0x23, 0xf6, 0x3b, 0xa3, 0x2e, 0x08, 0xbf,
+  0x21, 0x44, 0xe5, 0x3e, 0xba, 0x16, 0x3c, 0x3e, 0x2f, 0x9b, 0xb9, 0xbd,
+  0x2c, 0xab, 0xe1, 0x3e, 0xc6, 0xdf, 0xab, 0xbe, 0xda, 0x56, 0x0e, 0xbf,
+  0xa0, 0xe8, 0xd7, 0xbc, 0xf1, 0xba, 0xba, 0xbd, 0xe7, 0xaa, 0x40, 0x3e,
+  0x8a, 0x10, 0x1e, 0xbf, 0x5a, 0x5b, 0x3d, 0xbe, 0xff, 0x08, 0x83, 0x3d,
+  0xbb, 0x60, 0x3a, 0xbe, 0x20, 0x6d, 0xe9, 0x3d, 0xc1, 0x63, 0x60, 0x3d,
+  0xc6, 0x87, 0xfc, 0xbe, 0x77, 0x05, 0xb3, 0xbe, 0x03, 0x97, 0x96, 0x3d,
+  0x3b, 0xf6, 0xac, 0xbe, 0x42, 0xb8, 0x4e, 0x3e, 0x02, 0x84, 0xa0, 0x3e,
+  0xf3, 0x1a, 0x7b, 0xbc, 0x15, 0xfc, 0x81, 0x3d, 0x8d, 0x0f, 0x9a, 0x3d,
+  0x44, 0x79, 0xfd, 0xbe, 0xc5, 0xf8, 0x2c, 0x3e, 0x73, 0x01, 0xd5, 0xbe,
+  0x16, 0x14, 0x38, 0x3e, 0x6d, 0xd1, 0x19, 0xbe, 0x9f, 0xc2, 0x24, 0x3e,
+  0x26, 0x71, 0x4e, 0xbd, 0x65, 0x10, 0x30, 0x3e, 0xdd, 0x49, 0x56, 0x3e,
+  0x85, 0x2d, 0x37, 0x3c, 0x17, 0xa4, 0x28, 0x3f, 0xbc, 0x83, 0xf5, 0xbd,
+  0x5f, 0x5a, 0x76, 0xbe, 0xf2, 0xbc, 0x58, 0x3e, 0x02, 0xfb, 0x06, 0x3c,
+  0x6c, 0xb5, 0x93, 0x3e, 0x08, 0x42, 0x6e, 0xbd, 0xfc, 0xf5, 0x3e, 0x3d,
+  0xf8, 0x68, 0x7f, 0xbd, 0xda, 0x69, 0xc7, 0xbe, 0xcc, 0x07, 0x83, 0xbe,
+  0xda, 0x3e, 0x04, 0xbe, 0x88, 0xd8, 0x0a, 0xbe, 0x9b, 0xdd, 0xcc, 0xbe,
+  0x48, 0x8b, 0xac, 0xbe, 0xd8, 0xa2, 0x9e, 0xbc, 0xc8, 0xaf, 0x64, 0xbe,
+  0x87, 0xe5, 0xaa, 0xbe, 0xbc, 0x62, 0xce, 0x3e, 0x9a, 0x45, 0x1f, 0x3f,
+  0x86, 0x20, 0x8c, 0x3e, 0x2f, 0xd7, 0x83, 0x3e, 0x3a, 0x32, 0x83, 0xbe,
+  0xd2, 0x8a, 0x19, 0x3e, 0xe3, 0xba, 0x69, 0xbd, 0x00, 0xeb, 0x0d, 0xbe,
+  0xbc, 0x99, 0x09, 0xbe, 0xda, 0x02, 0xdd, 0x3d, 0xeb, 0xf9, 0xcb, 0xbc,
+  0x9f, 0x95, 0x9b, 0xbe, 0x91, 0xde, 0x87, 0x3e, 0xa9, 0x14, 0x2f, 0xbe,
+  0x22, 0xf2, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x06, 0x00, 0x00, 0x35, 0xbd, 0xd9, 0xbc, 0x00, 0xb7, 0x63, 0x3e,
+  0xac, 0xfd, 0x32, 0x3e, 0x9f, 0xf6, 0x85, 0xbe, 0xc4, 0x61, 0xa5, 0x3e,
+  0xdc, 0x49, 0xc0, 0xbe, 0x42, 0xad, 0x6f, 0x3e, 0xf3, 0x8d, 0x4f, 0xbd,
+  0x89, 0xd4, 0xab, 0x3e, 0x61, 0x1d, 0x07, 0x3d, 0x1e, 0x89, 0x1d, 0x3e,
+  0xde, 0x15, 0x13, 0xbd, 0x79, 0xa5, 0x8d, 0x3d, 0x8a, 0x39, 0xb2, 0x3e,
+  0x12, 0x9e, 0xa3, 0x3d, 0xe5, 0xa4, 0xdc, 0x3e, 0x82, 0x43, 0xe3, 0xbc,
+  0x42, 0x27, 0x3a, 0xbb, 0x6c, 0x99, 0x8c, 0x3e, 0xab, 0x3a, 0x02, 0xbe,
+  0x03, 0xbc, 0xa9, 0xbe, 0x8b, 0x11, 0x10, 0xbd, 0x68, 0x26, 0xa4, 0xbe,
+  0xbf, 0xaa, 0xfc, 0x3e, 0x09, 0x63, 0xa8, 0xbc, 0x6e, 0x60, 0xc9, 0x3c,
+  0xa1, 0x59, 0xd7, 0x3b, 0x6b, 0x93, 0xac, 0x3d, 0x10, 0x3e, 0xac, 0xbe,
+  0x02, 0xa9, 0x8e, 0x3e, 0xae, 0x6d, 0x06, 0xbd, 0x85, 0x18, 0xf3, 0x3c,
+  0xe0, 0x18, 0x92, 0xbe, 0x24, 0x98, 0x09, 0x3e, 0x7f, 0x6a, 0xca, 0x3c,
+  0x2b, 0x7b, 0x4b, 0xbc, 0xfe, 0x85, 0x52, 0xbd, 0x38, 0x0a, 0x2d, 0xbe,
+  0xfa, 0xa5, 0x2c, 0x3c, 0x45, 0xda, 0x76, 0xbd, 0x9b, 0x48, 0xbe, 0x3d,
+  0xd6, 0x3e, 0x8d, 0x3e, 0x50, 0x86, 0x88, 0x3e, 0x2f, 0x1e, 0xe8, 0x3d,
+  0xb1, 0x88, 0x3f, 0xbe, 0x2a, 0xcd, 0x9d, 0xbe, 0x54, 0x56, 0x53, 0x3c,
+  0x39, 0xe0, 0x7f, 0xbe, 0x5d, 0xe6, 0x1f, 0x3e, 0xa2, 0x16, 0x2b, 0x3e,
+  0x3c, 0x35, 0x92, 0x3d, 0x9d, 0x65, 0xc1, 0xbe, 0x15, 0x27, 0x1f, 0x3e,
+  0x49, 0x68, 0xc3, 0xbc, 0xeb, 0x78, 0xb0, 0x3d, 0xc9, 0xc1, 0xf0, 0x3d,
+  0x58, 0x03, 0x9e, 0xbe, 0xf7, 0xc5, 0x20, 0x3f, 0xb3, 0x91, 0xb3, 0xbe,
+  0xd4, 0xb4, 0xf1, 0xbd, 0xc2, 0x8c, 0x78, 0xbc, 0x80, 0x48, 0x93, 0xba,
+  0x5f, 0xe9, 0xef, 0x3d, 0xb5, 0xb7, 0xa0, 0x3d, 0x4f, 0x67, 0x69, 0x3e,
+  0x11, 0x5f, 0xfb, 0x3d, 0xea, 0x29, 0x8a, 0xbe, 0xa1, 0xef, 0x71, 0x3e,
+  0x02, 0x8b, 0x0b, 0x3f, 0xcd, 0x98, 0xce, 0x3c, 0xb0, 0xb4, 0xdf, 0x3d,
+  0xc7, 0x33, 0x07, 0xbe, 0x3e, 0x18, 0xa8, 0xbe, 0x63, 0xd8, 0xbe, 0x3e,
+  0x02, 0x1f, 0x93, 0x3e, 0x77, 0x2c, 0x0d, 0x3f, 0xd7, 0x86, 0x8d, 0xbd,
+  0xc4, 0xcd, 0x39, 0xbb, 0xc0, 0xaa, 0x64, 0x3d, 0x16, 0xbc, 0xb3, 0xbc,
+  0x0a, 0xec, 0xbb, 0xbe, 0xb9, 0xa5, 0xa9, 0x3e, 0xfd, 0xbd, 0x8e, 0xbe,
+  0x23, 0x2f, 0x3b, 0xbe, 0x28, 0x4d, 0x07, 0xbc, 0xfa, 0xee, 0xe5, 0x3c,
+  0xe6, 0xc2, 0x8b, 0xbd, 0xe4, 0x7d, 0x81, 0x3e, 0xac, 0x96, 0xc1, 0xbe,
+  0x5a, 0x06, 0x66, 0x3e, 0x17, 0xab, 0xad, 0x3d, 0x42, 0xfa, 0xb2, 0x3d,
+  0x0c, 0xc2, 0xee, 0xbd, 0xd6, 0x01, 0x14, 0xbe, 0x21, 0x1c, 0x1c, 0xbf,
+  0xa2, 0x8c, 0x38, 0x3d, 0xac, 0xba, 0x0d, 0x3d, 0xf3, 0x2e, 0x24, 0xbe,
+  0x35, 0x04, 0x89, 0x3e, 0xac, 0x4e, 0x0b, 0xbe, 0x8e, 0x03, 0xb3, 0x3e,
+  0xfc, 0x5c, 0xc1, 0xbe, 0x58, 0x8d, 0x91, 0x3e, 0x43, 0x62, 0x99, 0x3d,
+  0x4e, 0xd2, 0xb5, 0x3d, 0x10, 0x58, 0x94, 0x3e, 0xe9, 0x70, 0xd7, 0x3d,
+  0x8f, 0xce, 0xef, 0x3d, 0xb9, 0x53, 0xa9, 0x3d, 0x30, 0xe5, 0x87, 0xbe,
+  0x7a, 0xeb, 0xc3, 0xbe, 0xf5, 0x13, 0x63, 0x3d, 0x67, 0x29, 0x82, 0x3c,
+  0x07, 0x65, 0x8b, 0xbc, 0x89, 0x70, 0xe5, 0x3d, 0xf4, 0x49, 0xaa, 0xbe,
+  0x8a, 0x0e, 0xd3, 0x3e, 0x11, 0x54, 0x74, 0xbe, 0x81, 0x75, 0xae, 0xbe,
+  0x9d, 0xb8, 0x7f, 0x3e, 0xfe, 0xf6, 0x18, 0xbf, 0x82, 0x98, 0x3b, 0xbe,
+  0x50, 0x82, 0xfc, 0xbd, 0xa0, 0xd2, 0xd8, 0x3d, 0x8e, 0xec, 0x99, 0x3d,
+  0x54, 0x5b, 0x87, 0x3d, 0xa7, 0xa3, 0x71, 0x3e, 0xba, 0xd2, 0x2b, 0x3d,
+  0x86, 0xe5, 0x5c, 0x3e, 0x50, 0xf6, 0xf5, 0xbd, 0x87, 0x0b, 0x6b, 0x3a,
+  0xe3, 0x54, 0xa3, 0x3e, 0xc5, 0x2e, 0x0d, 0xbe, 0x30, 0xc0, 0x73, 0x3e,
+  0x85, 0x36, 0xa8, 0x3e, 0x70, 0x4d, 0xe0, 0xbd, 0xe6, 0x39, 0x93, 0x3e,
+  0x76, 0x14, 0xfa, 0xbd, 0x9a, 0xab, 0x0c, 0xbe, 0x1b, 0x0e, 0x27, 0xbd,
+  0x16, 0x3c, 0xd8, 0xbe, 0x57, 0x49, 0x18, 0xbd, 0x44, 0xdf, 0xb2, 0x3e,
+  0x15, 0xbb, 0x96, 0xbe, 0xc5, 0x0b, 0xb4, 0x3d, 0x22, 0xe2, 0x6d, 0x3e,
+  0x4d, 0x36, 0x92, 0xbe, 0x64, 0x9d, 0x4a, 0x3d, 0xf8, 0xa9, 0xc7, 0x3c,
+  0xb0, 0x26, 0x8f, 0x3d, 0x06, 0xba, 0xa1, 0x3d, 0x45, 0x9a, 0xc5, 0xbd,
+  0x59, 0x6a, 0x02, 0xbe, 0x7e, 0xfc, 0x15, 0xbe, 0x3a, 0xd5, 0x67, 0xbe,
+  0xc0, 0x18, 0x8d, 0x3d, 0xde, 0x36, 0x16, 0xbe, 0x7f, 0x13, 0x8b, 0xbe,
+  0x87, 0xdd, 0xff, 0xbc, 0x52, 0x30, 0xf4, 0xbd, 0x80, 0x7d, 0x2c, 0x3c,
+  0x24, 0x29, 0x78, 0x3e, 0xe7, 0x40, 0x56, 0xbd, 0xae, 0x97, 0xc2, 0xbe,
+  0xa4, 0x14, 0xcb, 0x3e, 0x3a, 0x43, 0x85, 0x3d, 0x07, 0x07, 0xd1, 0xbe,
+  0x9e, 0x93, 0xe4, 0x3c, 0xfb, 0xe2, 0x15, 0x3e, 0x25, 0x17, 0xdc, 0xbd,
+  0xd7, 0x82, 0x89, 0x3e, 0x46, 0x8a, 0x0f, 0xbf, 0x76, 0x3e, 0x76, 0xbe,
+  0xb0, 0xc6, 0xa1, 0x3d, 0x0a, 0xf3, 0x97, 0xbd, 0xe3, 0x17, 0x27, 0x3e,
+  0xba, 0x20, 0x7f, 0xbe, 0x7c, 0x1e, 0xc8, 0x3e, 0x8e, 0xd4, 0x95, 0xbe,
+  0x19, 0xf5, 0x5b, 0xbe, 0xe8, 0xf9, 0xa8, 0xbe, 0xcb, 0x3d, 0xcb, 0xbd,
+  0xc1, 0x33, 0x2e, 0xbe, 0x77, 0x3b, 0x51, 0xbd, 0xb0, 0xcc, 0x80, 0x3d,
+  0x07, 0x8b, 0x87, 0x3e, 0x43, 0xae, 0xb3, 0xbd, 0x1f, 0xc1, 0xa0, 0x3e,
+  0x7f, 0x0c, 0xb8, 0xba, 0x1a, 0xfd, 0xaa, 0x3d, 0xed, 0x6a, 0xe2, 0xbc,
+  0x8c, 0xa6, 0xa4, 0x3d, 0x9f, 0x0d, 0x20, 0xbe, 0x8b, 0x4e, 0xd6, 0x3e,
+  0x82, 0x5a, 0xb6, 0xbd, 0xaf, 0x6b, 0x2f, 0xbe, 0x28, 0x14, 0x9f, 0x3e,
+  0xd5, 0xcb, 0x7c, 0xbe, 0xbf, 0xa9, 0x96, 0x3e, 0x7a, 0xd4, 0xca, 0x3d,
+  0x6b, 0x83, 0x8c, 0x3d, 0x91, 0xb6, 0xbf, 0x3d, 0x6b, 0xcb, 0xbf, 0x3d,
+  0x38, 0xf9, 0x89, 0x3e, 0x89, 0x33, 0xdd, 0xbe, 0xef, 0x97, 0xa1, 0x3e,
+  0xe2, 0x35, 0x14, 0xbe, 0x86, 0xa0, 0xdb, 0xbd, 0x50, 0x28, 0xe9, 0x3d,
+  0xbe, 0x80, 0x70, 0x3d, 0x6b, 0xf7, 0x23, 0x3e, 0xea, 0xf4, 0x93, 0xbe,
+  0x01, 0x35, 0xe6, 0xbc, 0x3d, 0xe0, 0xd0, 0x3d, 0x74, 0x86, 0x19, 0x3e,
+  0xda, 0xa6, 0x87, 0x3e, 0x03, 0x4a, 0x8a, 0x3e, 0x9b, 0x9d, 0xb7, 0xbb,
+  0x88, 0xbe, 0x8d, 0xbe, 0x4b, 0xc7, 0x23, 0xbe, 0x48, 0x1b, 0xdc, 0x3d,
+  0x13, 0xb5, 0x95, 0x3e, 0xc6, 0x3a, 0xcc, 0x3e, 0x07, 0x1b, 0x8d, 0x3d,
+  0xdd, 0xc3, 0x48, 0xbe, 0x0e, 0xef, 0x65, 0x3e, 0xd4, 0xde, 0x73, 0xbd,
+  0x7e, 0x67, 0x18, 0xbe, 0x20, 0xce, 0x70, 0xbc, 0x9a, 0x1f, 0x5e, 0xbc,
+  0x10, 0x13, 0x05, 0x3d, 0x38, 0x02, 0x84, 0xbd, 0x6d, 0x9c, 0x64, 0x3e,
+  0xf1, 0x3b, 0x00, 0xbe, 0x76, 0x5e, 0x78, 0x3e, 0x42, 0xcd, 0x5b, 0x3d,
+  0x99, 0xe6, 0x02, 0xbe, 0x65, 0x1b, 0xea, 0x3c, 0xf4, 0x23, 0x74, 0x3e,
+  0x7f, 0xe7, 0xc6, 0x3c, 0x14, 0xce, 0x0a, 0x3e, 0x18, 0x22, 0x01, 0x3e,
+  0x4b, 0x41, 0xa0, 0x3b, 0xc2, 0xee, 0x78, 0x3d, 0x83, 0x8c, 0x16, 0x3e,
+  0x86, 0x46, 0x02, 0xbe, 0x20, 0x33, 0xa9, 0xbe, 0x41, 0x78, 0x72, 0xbe,
+  0x58, 0xda, 0x79, 0xbd, 0x3c, 0x4f, 0xaf, 0xbd, 0xeb, 0x25, 0x11, 0x3e,
+  0xda, 0xfa, 0x3a, 0x3d, 0xca, 0x90, 0x5b, 0x3e, 0xc7, 0xab, 0x8d, 0xbe,
+  0x71, 0xd6, 0x6a, 0xbd, 0x5b, 0x32, 0xd7, 0xbd, 0x96, 0x85, 0x79, 0xbe,
+  0x89, 0xc7, 0x86, 0xbe, 0x03, 0xc7, 0x05, 0xbe, 0x29, 0x4b, 0x2d, 0xbd,
+  0x4f, 0x55, 0x69, 0x3d, 0x1a, 0x8a, 0x49, 0xbd, 0xed, 0x40, 0x9f, 0xbe,
+  0x3a, 0x40, 0xc0, 0x3d, 0x81, 0xc9, 0x6c, 0x3e, 0xac, 0x05, 0x19, 0xb9,
+  0x2d, 0x75, 0x54, 0xbe, 0xf9, 0x1c, 0x5b, 0xbe, 0x28, 0x07, 0xaa, 0xbe,
+  0xbc, 0x81, 0xab, 0xbe, 0x2c, 0x25, 0x0a, 0xbe, 0x1e, 0x77, 0x62, 0xbe,
+  0x1c, 0x3f, 0x1d, 0x3e, 0xa4, 0x27, 0x28, 0x3e, 0xf6, 0xd6, 0x6c, 0xbd,
+  0x13, 0x91, 0x0e, 0xbd, 0xed, 0xdc, 0x31, 0x3e, 0xde, 0xa5, 0x85, 0x3e,
+  0x23, 0xe0, 0x98, 0x3d, 0xc1, 0x91, 0x28, 0x3e, 0x0f, 0x43, 0xcc, 0xbd,
+  0x69, 0x9f, 0x17, 0x3d, 0xb2, 0x00, 0x84, 0x3d, 0xd3, 0xb7, 0x36, 0x3c,
+  0xc9, 0xc2, 0x80, 0x3e, 0x7b, 0x02, 0xe6, 0x3e, 0xf9, 0x0a, 0x01, 0xbe,
+  0xe8, 0x4c, 0x54, 0xba, 0x4d, 0xce, 0xa4, 0x3d, 0xad, 0x49, 0x83, 0x3c,
+  0x8a, 0xb9, 0xe0, 0xbc, 0x5b, 0x25, 0x88, 0x3e, 0x71, 0xed, 0x0e, 0x3e,
+  0x71, 0xc7, 0x46, 0x3e, 0x49, 0x08, 0x22, 0x3e, 0x6f, 0x06, 0x63, 0x3d,
+  0x0e, 0x8b, 0x24, 0xbe, 0x0b, 0x1e, 0x16, 0x3e, 0x61, 0xa4, 0x39, 0xbe,
+  0x08, 0x85, 0xcd, 0xbd, 0xa3, 0xf1, 0x5f, 0xbe, 0x07, 0x32, 0x39, 0x3e,
+  0x2f, 0x67, 0xad, 0x3d, 0x33, 0x16, 0xd0, 0xbe, 0xdf, 0xe3, 0x39, 0xbe,
+  0xf9, 0x97, 0x45, 0x3e, 0x6a, 0xdd, 0x26, 0xbe, 0xe6, 0xe5, 0x92, 0x3d,
+  0x97, 0x12, 0x83, 0x3e, 0xcb, 0x41, 0x8a, 0xbe, 0xd1, 0xbd, 0x8c, 0x3d,
+  0x4b, 0x6f, 0x10, 0xbe, 0x5c, 0xcc, 0x90, 0xbe, 0x96, 0x6c, 0xb3, 0x3e,
+  0x82, 0x67, 0x11, 0x3e, 0x39, 0x67, 0x86, 0x3e, 0xb0, 0x13, 0xfb, 0x3d,
+  0x2c, 0x66, 0x43, 0x3e, 0x94, 0x30, 0xd3, 0xbe, 0x71, 0xb3, 0x40, 0xbd,
+  0x41, 0x18, 0x0a, 0x3e, 0x9e, 0x0e, 0x8c, 0xbc, 0x96, 0x23, 0xa0, 0x3e,
+  0xca, 0xa7, 0x0c, 0xbe, 0xf0, 0x6a, 0x8e, 0x3b, 0x9e, 0x54, 0x6f, 0x3d,
+  0x2c, 0xcb, 0x2a, 0xbe, 0x6a, 0x35, 0x7e, 0x3e, 0x00, 0x1c, 0xb4, 0x3e,
+  0x5a, 0xf2, 0xe2, 0xbe, 0xa2, 0x4f, 0xf4, 0x3d, 0x70, 0x2c, 0x73, 0x3b,
+  0x62, 0x1d, 0x18, 0x3e, 0x74, 0x7e, 0xeb, 0xbc, 0x16, 0x5c, 0xb4, 0x3e,
+  0xda, 0xae, 0xe0, 0xbd, 0x06, 0x71, 0x6f, 0x3d, 0xb9, 0xe5, 0x23, 0x3d,
+  0x3d, 0x1c, 0x24, 0x3e, 0xb9, 0x36, 0xf2, 0x3c, 0x2d, 0xea, 0xf8, 0xbd,
+  0x0f, 0x72, 0x0d, 0x3e, 0x4f, 0xfa, 0xe2, 0xbc, 0xc6, 0xc8, 0xa3, 0x3d,
+  0xcb, 0x92, 0x64, 0x3e, 0xf2, 0x4b, 0xcb, 0x3d, 0xf2, 0x7d, 0xe7, 0x3d,
+  0x50, 0x0e, 0x94, 0x3e, 0xfc, 0x31, 0xc8, 0xbe, 0x9b, 0x1c, 0xa5, 0x3e,
+  0x8b, 0x52, 0xa3, 0x3e, 0x04, 0x3a, 0x9f, 0x3e, 0xa5, 0xa4, 0x39, 0x3d,
+  0x53, 0x8b, 0xbd, 0xbe, 0x94, 0x9b, 0xa9, 0xbe, 0x66, 0x89, 0x80, 0x3d,
+  0xa4, 0x5a, 0x64, 0x3e, 0x30, 0xbb, 0x33, 0x3d, 0x2b, 0x2d, 0x23, 0x3e,
+  0xa6, 0x57, 0x02, 0xbd, 0x25, 0x44, 0xe5, 0xbe, 0x2c, 0xc9, 0x2c, 0x3e,
+  0xaa, 0x35, 0x50, 0xbe, 0x70, 0x5e, 0x59, 0xbe, 0xb8, 0x80, 0x46, 0xbd,
+  0x68, 0xac, 0xc7, 0x3e, 0x36, 0xdc, 0xe5, 0xbb, 0x51, 0xa5, 0x4d, 0x3c,
+  0x9a, 0xb0, 0x86, 0xbd, 0xf9, 0x5d, 0x4a, 0x3e, 0x4d, 0x90, 0x2d, 0x3d,
+  0xa7, 0x11, 0x80, 0xbe, 0x32, 0xd8, 0x02, 0xbe, 0xe6, 0xea, 0xb5, 0x3e,
+  0xb7, 0x6a, 0xe5, 0xbd, 0xeb, 0x96, 0x35, 0x3d, 0x90, 0xee, 0x41, 0x3e,
+  0xba, 0x83, 0xf5, 0x3d, 0xb2, 0x5a, 0xd0, 0xbd, 0xe3, 0x6a, 0x48, 0x3d,
+  0xa6, 0x21, 0x1b, 0xbe, 0x92, 0x4b, 0x3c, 0x3e, 0xa3, 0xa9, 0xf6, 0x3e,
+  0xd3, 0x8b, 0xde, 0x3d, 0x58, 0x4a, 0xab, 0x3e, 0x4c, 0xc5, 0xe1, 0xbe,
+  0xf1, 0x96, 0x5e, 0xbc, 0xcd, 0xf3, 0xbd, 0x3d, 0x77, 0xcc, 0xe2, 0x3e,
+  0x48, 0x95, 0x4c, 0xbd, 0x0a, 0x75, 0x09, 0x3e, 0xb0, 0xf4, 0xa9, 0x3d,
+  0x0d, 0x42, 0xa8, 0x3d, 0x27, 0x80, 0x99, 0xbe, 0x84, 0x75, 0xd7, 0xbe,
+  0x4f, 0x2b, 0x56, 0xbd, 0x5e, 0xa6, 0xc6, 0xbe, 0xff, 0x36, 0xe9, 0x3d,
+  0x6d, 0xfb, 0x27, 0xbe, 0x3a, 0xf5, 0x08, 0xbe, 0x72, 0xf8, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00,
   0x17, 0xa0, 0x10, 0x3f, 0x5d, 0x2a, 0xc4, 0xbe, 0x81, 0x4e, 0x1f, 0xbf,
   0x49, 0x06, 0x5d, 0x3e, 0x68, 0x09, 0x13, 0x3e, 0xc9, 0xf2, 0xaa, 0xbe,
   0x11, 0x63, 0x5a, 0x3f, 0x9e, 0x3c, 0x53, 0xbd, 0x63, 0x1a, 0x4a, 0x3d,
@@ -3235,206 +3240,208 @@ unsigned char trained_lstm_tflite[] = {
   0x1c, 0xa7, 0xe9, 0xbe, 0x0f, 0x12, 0xa9, 0xbd, 0x05, 0x04, 0x1b, 0xbe,
   0x43, 0x5f, 0xc4, 0xbe, 0xbb, 0xea, 0x19, 0xbf, 0x61, 0x98, 0x04, 0xbf,
   0x9c, 0x6f, 0x94, 0x3e, 0x90, 0xe0, 0x3f, 0xbf, 0xc2, 0x4c, 0x1e, 0x3e,
-  0x9a, 0x17, 0x25, 0x3e, 0xd6, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x30, 0x02, 0x00, 0x00,
-  0xea, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x9a, 0x17, 0x25, 0x3e, 0xc2, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x30, 0x02, 0x00, 0x00, 0xda, 0xfe, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0f, 0x83, 0x0c, 0xbe,
-  0x01, 0xa3, 0x29, 0x3e, 0xc4, 0x9c, 0x08, 0x3e, 0xcc, 0x59, 0x8d, 0xbd,
-  0x51, 0x44, 0x0d, 0x3d, 0xa0, 0x45, 0xd3, 0x3d, 0xa7, 0xe4, 0x1c, 0xbe,
-  0x1b, 0x86, 0x12, 0x3e, 0x10, 0x82, 0x00, 0xbe, 0x07, 0xd4, 0xba, 0xbd,
-  0xcc, 0xf7, 0xff, 0xff, 0xd0, 0xf7, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
-  0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
-  0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00,
-  0x94, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00,
-  0x94, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xc6, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x42, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x0f, 0x83, 0x0c, 0xbe, 0x01, 0xa3, 0x29, 0x3e,
+  0xc4, 0x9c, 0x08, 0x3e, 0xcc, 0x59, 0x8d, 0xbd, 0x51, 0x44, 0x0d, 0x3d,
+  0xa0, 0x45, 0xd3, 0x3d, 0xa7, 0xe4, 0x1c, 0xbe, 0x1b, 0x86, 0x12, 0x3e,
+  0x10, 0x82, 0x00, 0xbe, 0x07, 0xd4, 0xba, 0xbd, 0xcc, 0xf7, 0xff, 0xff,
+  0xd0, 0xf7, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52,
+  0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
-  0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-  0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x98, 0xf8, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x20, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00,
-  0x0b, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41,
-  0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x8c, 0x01, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xc6, 0xff, 0xff, 0xff,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f,
+  0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00,
+  0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x98, 0xf8, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x00,
+  0x0f, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x47, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x00, 0x04,
+  0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x3c, 0x06, 0x00, 0x00, 0xc8, 0x05, 0x00, 0x00, 0x80, 0x05, 0x00, 0x00,
-  0x18, 0x05, 0x00, 0x00, 0xc0, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00,
-  0x40, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xc4, 0x03, 0x00, 0x00,
-  0x88, 0x03, 0x00, 0x00, 0x4c, 0x03, 0x00, 0x00, 0x10, 0x03, 0x00, 0x00,
-  0xd0, 0x02, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x6c, 0x01, 0x00, 0x00,
-  0x14, 0x01, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x32, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x1c, 0xfa, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74,
-  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x3a,
-  0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x7a, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x4c, 0x00, 0x00, 0x00, 0x64, 0xfa, 0xff, 0xff, 0x3e, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e,
-  0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2f,
-  0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f,
-  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
-  0x64, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0xe6, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xd0, 0xfa, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e,
-  0x74, 0x69, 0x61, 0x6c, 0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e,
-  0x2f, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00,
-  0x36, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x20, 0xfb, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e,
-  0x75, 0x6e, 0x69, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x61, 0x6c, 0x5f, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x5f,
-  0x6c, 0x73, 0x74, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x3e, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x70, 0xfb, 0xff, 0xff,
-  0x1c, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x73, 0x65,
-  0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6c, 0x73, 0x74,
-  0x6d, 0x2f, 0x7a, 0x65, 0x72, 0x6f, 0x73, 0x31, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0xd2, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
-  0xbc, 0xfb, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x3c, 0x06, 0x00, 0x00,
+  0xc8, 0x05, 0x00, 0x00, 0x80, 0x05, 0x00, 0x00, 0x18, 0x05, 0x00, 0x00,
+  0xc0, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0xc4, 0x03, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00,
+  0x4c, 0x03, 0x00, 0x00, 0x10, 0x03, 0x00, 0x00, 0xd0, 0x02, 0x00, 0x00,
+  0x90, 0x02, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
+  0xb8, 0x01, 0x00, 0x00, 0x6c, 0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x32, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x1c, 0xfa, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74,
+  0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f,
+  0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x3a, 0x30, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x7a, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x64, 0xfa, 0xff, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
   0x6c, 0x2f, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c,
   0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2f, 0x4d, 0x61, 0x74, 0x4d,
-  0x75, 0x6c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x30, 0x02, 0x00, 0x00, 0x1e, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x08, 0xfc, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
-  0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61,
-  0x6e, 0x74, 0x31, 0x31, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x5e, 0xfc, 0xff, 0xff,
+  0x75, 0x6c, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x73, 0x65, 0x71,
+  0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0xe6, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0xd0, 0xfa, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x2f, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c,
+  0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x2f, 0x52, 0x65, 0x73,
+  0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00, 0x36, 0xfb, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x48, 0xfc, 0xff, 0xff,
-  0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x9e, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x88, 0xfc, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74,
-  0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x39, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0xda, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0xc4, 0xfc, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74,
-  0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x38, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x16, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0xfd, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74,
-  0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x37, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x4e, 0xfd, 0xff, 0xff,
+  0x13, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x20, 0xfb, 0xff, 0xff,
+  0x20, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x75, 0x6e, 0x69, 0x64,
+  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x73,
+  0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x5f, 0x6c, 0x73, 0x74, 0x6d,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3e, 0xfc, 0xff, 0xff,
+  0x00, 0x00, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x70, 0xfb, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e,
+  0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x7a, 0x65,
+  0x72, 0x6f, 0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xd2, 0xfb, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x38, 0xfd, 0xff, 0xff,
-  0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x36, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x86, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x70, 0xfd, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0xbc, 0xfb, 0xff, 0xff,
+  0x1e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x73, 0x65,
+  0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6f, 0x75, 0x74,
+  0x70, 0x75, 0x74, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00,
+  0x1e, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0xfc, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74,
+  0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x31,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x5e, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x48, 0xfc, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
   0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61,
-  0x6e, 0x74, 0x35, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0xbe, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0xa8, 0xfd, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74,
-  0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x34, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf6, 0xfd, 0xff, 0xff,
+  0x6e, 0x74, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x9e, 0xfc, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xe0, 0xfd, 0xff, 0xff,
+  0x0e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x88, 0xfc, 0xff, 0xff,
   0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x33, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x32, 0xfe, 0xff, 0xff,
+  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x39, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xda, 0xfc, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x07, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0xfe, 0xff, 0xff,
+  0x0d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xc4, 0xfc, 0xff, 0xff,
   0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x32, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x6e, 0xfe, 0xff, 0xff,
+  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x38, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x16, 0xfd, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x58, 0xfe, 0xff, 0xff,
+  0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff,
   0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xaa, 0xfe, 0xff, 0xff,
+  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x37, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x4e, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x38, 0xfd, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
+  0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61,
+  0x6e, 0x74, 0x36, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x86, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x70, 0xfd, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74,
+  0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x35, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xbe, 0xfd, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x94, 0xfe, 0xff, 0xff,
-  0x0e, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
-  0x1c, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xa8, 0xfd, 0xff, 0xff,
+  0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f,
+  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x34, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xf6, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0xe0, 0xfd, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
+  0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61,
+  0x6e, 0x74, 0x33, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x32, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x1c, 0xfe, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
+  0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61,
+  0x6e, 0x74, 0x32, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x6e, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x58, 0xfe, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
+  0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61,
+  0x6e, 0x74, 0x31, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xaa, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x94, 0xfe, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00,
+  0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61,
+  0x6e, 0x74, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00,
+  0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x2c, 0x00, 0x00, 0x00, 0xec, 0xfe, 0xff, 0xff,
+  0x1e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x73, 0x65,
+  0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x66, 0x6c, 0x61,
+  0x74, 0x74, 0x65, 0x6e, 0x2f, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e,
+  0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6c, 0x73, 0x74, 0x6d, 0x2f, 0x7a, 0x65,
+  0x72, 0x6f, 0x73, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xa6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e,
+  0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2f,
+  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
+  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x18, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2c, 0x00, 0x00, 0x00,
-  0xec, 0xfe, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c,
-  0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x2f, 0x43, 0x6f, 0x6e,
-  0x73, 0x74, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x16, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x0c, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xff,
-  0x1b, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x73, 0x65,
-  0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6c, 0x73, 0x74,
-  0x6d, 0x2f, 0x7a, 0x65, 0x72, 0x6f, 0x73, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xa6, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff,
-  0x2e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x73, 0x65,
-  0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2f, 0x6f, 0x75, 0x74,
-  0x70, 0x75, 0x74, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f,
-  0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x4f, 0x70, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x16, 0x00, 0x18, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00,
-  0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61,
-  0x75, 0x6c, 0x74, 0x5f, 0x66, 0x69, 0x78, 0x65, 0x64, 0x5f, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x3a, 0x30, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xff,
-  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xe8, 0xff, 0xff, 0xff,
-  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xf4, 0xff, 0xff, 0xff,
-  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0c, 0x00, 0x0c, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76,
+  0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f,
+  0x66, 0x69, 0x78, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x3a,
+  0x30, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x19, 0xe8, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xf4, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x16, 0x0c, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2c
 };
-unsigned int trained_lstm_tflite_len = 41240;
+const unsigned int trained_lstm_tflite_len = 41320;
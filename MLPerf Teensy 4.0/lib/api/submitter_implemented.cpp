@@ -16,81 +16,115 @@
  *
  * This file is generated by Gemini based on user inputs.
  * Implements the MLPerf Tiny API for a Teensy 4.0 using TFLM.
+ * Serial I/O, timestamps and low power live in th_hal_teensy40.cpp, loading,
+ * inference, results and the measurement commands in MLPerf_Common/lib/th_tflm.
  */
 
 // 1. API-Header
 #include "submitter_implemented.h"
 #include "internally_implemented.h" // Für ee_get_buffer()
+#include "th_hal.h"
 
 // 2. Arduino & C Standard-Bibliotheken
-#include <Arduino.h>  // Für Serial, micros()
-#include <stdarg.h>   // Für va_list, va_start, va_end
-#include <stdio.h>    // Für vsnprintf
-#include <string.h>   // Für libc-Hooks (memcpy, etc.)
+#include <Arduino.h>  // Für PROGMEM, DMAMEM
+#include <string.h>   // Für strlen
 
 // 3. TFLM-Header
 #include "tensorflow/lite/micro/micro_error_reporter.h"
-#include "tensorflow/lite/micro/micro_interpreter.h"
-#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
-#include "tensorflow/lite/schema/schema_generated.h"
+// TFLM-Teil aller Boards (Resolver, th_load_tensor, th_infer, ...)
+#include "th_tflm.h"
+
+// Cache-/MPU-Richtlinie für Arena und Modell (Befehl "cache")
+#include "m7_cache.h"
+// Komprimierte Modellablage (-D TH_MODEL_LZ=1); das Abbild bleibt im Flash
+#define TH_MODEL_LZ_ATTR PROGMEM
+#include "model_lz.h"
 
 // ===================================================================
 // DEINE MODELL-KONFIGURATION (Übernommen aus deinem Snippet)
 // ===================================================================
 
+// Ablage der Modell-Arrays (TH_TEENSY_LAYOUT, siehe submitter_implemented.h).
+// Ohne PROGMEM kopiert der Startup-Code ein Array als initialisierte Daten
+// in die DTCM, mit PROGMEM bleibt es im Flash (über den Cache gelesen).
+#if TH_MODEL_LZ
+  // Entpackt auf den Heap (OCRAM), das rohe Array wird nicht gelinkt
+  #define TH_MODEL_ATTR
+  #define TH_MODEL_LOCATION "ocram"
+#elif TH_TEENSY_LAYOUT == TH_LAYOUT_DTCM || TH_TEENSY_LAYOUT == TH_LAYOUT_OCRAM_FLASH
+  #define TH_MODEL_ATTR PROGMEM
+  #define TH_MODEL_LOCATION "flash"
+#elif TH_TEENSY_LAYOUT == TH_LAYOUT_OCRAM
+  #define TH_MODEL_ATTR
+  #define TH_MODEL_LOCATION "dtcm"
+#elif TH_MODEL_VERSION == EE_MODEL_VERSION_VWW01
+  // Bisheriges Verhalten: nur vww01 liegt im Flash
+  #define TH_MODEL_ATTR PROGMEM
+  #define TH_MODEL_LOCATION "flash"
+#else
+  #define TH_MODEL_ATTR
+  #define TH_MODEL_LOCATION "dtcm"
+#endif
+
 #if TH_MODEL_VERSION == EE_MODEL_VERSION_IC01
   #include "ic01_model_data.h" // Enthält das ResNet-Modell
-  const unsigned char* g_model = pretrainedResnet_quant_tflite;
+  const unsigned char* g_model = TH_MODEL_FLASH(pretrainedResnet_quant_tflite);
+  constexpr size_t kModelSize = sizeof(pretrainedResnet_quant_tflite);
   constexpr size_t kTensorArenaSize = 150 * 1024; // 100 KB
 
 #elif TH_MODEL_VERSION == EE_MODEL_VERSION_KWS01
   #include "kws01_model_data.h" // Enthält das DS-CNN-Modell
-  const unsigned char* g_model = kws_ref_model_tflite;
+  const unsigned char* g_model = TH_MODEL_FLASH(kws_ref_model_tflite);
+  constexpr size_t kModelSize = sizeof(kws_ref_model_tflite);
   constexpr size_t kTensorArenaSize = 100 * 1024; // 20 KB
 
 #elif TH_MODEL_VERSION == EE_MODEL_VERSION_VWW01
   #include "vww01_model_data.h" // Enthält das MobileNetV1-Modell
-  const unsigned char* g_model = vww_96_int8_tflite;
+  const unsigned char* g_model = TH_MODEL_FLASH(vww_96_int8_tflite);
+  constexpr size_t kModelSize = sizeof(vww_96_int8_tflite);
   constexpr size_t kTensorArenaSize = 250 * 1024; // 335 KB
 
 #elif TH_MODEL_VERSION == EE_MODEL_VERSION_AD01
   #include "ad01_model_data.h" // Enthält das Autoencoder-Modell
-  const unsigned char* g_model = ad01_int8_tflite;
+  const unsigned char* g_model = TH_MODEL_FLASH(ad01_int8_tflite);
+  constexpr size_t kModelSize = sizeof(ad01_int8_tflite);
   constexpr size_t kTensorArenaSize = 50 * 1024; // 50 KB
 
 #elif TH_MODEL_VERSION == EE_MODEL_VERSION_STRWW01
-  #include "strww01_model_data.h" // Enthält das TinyML RNN-Modell
-  const unsigned char* g_model = str_ww_ref_model_tflite;
+  #include "strww01_model_data.h" // Enthält das Streaming-Wakeword-Modell (DS-CNN)
+  const unsigned char* g_model = TH_MODEL_FLASH(str_ww_ref_model_tflite);
+  constexpr size_t kModelSize = sizeof(str_ww_ref_model_tflite);
   constexpr size_t kTensorArenaSize = 30 * 1024; // 30 KB
 
 #else
   #error "TH_MODEL_VERSION wurde nicht auf ein gültiges Modell gesetzt!"
 #endif
 
+#if TH_MODEL_LZ
+  // Komprimiertes Abbild im Flash, g_model wird in th_final_initialize() gesetzt
+  #include "model_lz_data.h"
+#endif
+
 // ===================================================================
 // GLOBALE VARIABLEN FÜR TFLM
 // ===================================================================
 
 
 namespace { // Anonymer Namespace, um globale Variablen "privat" zu halten
-const tflite::Model* model = nullptr;
-tflite::MicroInterpreter* interpreter = nullptr;
-TfLiteTensor* model_input = nullptr;
-TfLiteTensor* model_output = nullptr;
-tflite::MicroOpResolver* op_resolver = nullptr;
-
 tflite::MicroErrorReporter micro_error_reporter;
 tflite::ErrorReporter* error_reporter = &micro_error_reporter;
 
 // Die Tensor Arena!
-// Wird vom Linker in das RAM des Teensy gelegt.
+// Ohne Attribut landet sie im .bss und damit in der DTCM (RAM1, ohne Cache,
+// ein Takt Zugriff). Mit DMAMEM liegt sie in der OCRAM (RAM2, über den
+// L1-Cache) und lässt die DTCM für Modell und Stack frei.
 // `alignas(16)` ist eine TFLM-Anforderung für beste Performance.
+#if TH_TEENSY_LAYOUT == TH_LAYOUT_OCRAM || TH_TEENSY_LAYOUT == TH_LAYOUT_OCRAM_FLASH
+  #define TH_ARENA_LOCATION "ocram"
+alignas(16) DMAMEM static uint8_t tensor_arena[kTensorArenaSize];
+#else
+  #define TH_ARENA_LOCATION "dtcm"
 alignas(16) static uint8_t tensor_arena[kTensorArenaSize];
-
-#if EE_CFG_ENERGY_MODE // Wird nur benötigt, wenn wir im Energiemodus sind
-  // Wähle einen GPIO-Pin auf deinem Teensy, z.B. D5
-  // Du musst den Pin wählen, der mit deinem Level Shifter/Joulescope verbunden ist!
-  constexpr int TH_GPIO_TIMESTAMP_PIN = 5;
 #endif
 } // namespace
 
@@ -102,305 +136,7 @@ alignas(16) static uint8_t tensor_arena[kTensorArenaSize];
  * serielle Schnittstelle des Teensy weiter.
  */
 extern "C" void DebugLog(const char* s) {
-#if EE_CFG_ENERGY_MODE
-  Serial2.print(s); // Energie-Modus: Sende an Hardware-UART (IO Manager)
-#else
-  Serial.print(s);
-#endif
-}
-
-/**
- * @brief Fügt die TFLM-Operatoren hinzu, die für das
- * aktuell ausgewählte Modell benötigt werden.
- *
- * Jedes Modell erhält einen minimalen, maßgeschneiderten Resolver,
- * um den Flash-Speicherverbrauch zu optimieren.
- */
-void AddOpsToResolver() {
-  #if TH_MODEL_VERSION == EE_MODEL_VERSION_IC01 // IC (ResNet)
-    // Dieses ResNet-Modell [cite: 152] benötigt Faltungs-, Additions- (für die
-    // Residual-Blöcke) und Pooling-Operationen.
-    static tflite::MicroMutableOpResolver<6> micro_op_resolver;
-    micro_op_resolver.AddFullyConnected();
-    micro_op_resolver.AddConv2D();
-    micro_op_resolver.AddAdd(); // Wichtig für Residual-Verbindungen
-    micro_op_resolver.AddAveragePool2D();
-    micro_op_resolver.AddReshape();
-    micro_op_resolver.AddSoftmax();
-    op_resolver = &micro_op_resolver; // Weist den lokalen Resolver dem globalen Zeiger zu
-
-  #elif TH_MODEL_VERSION == EE_MODEL_VERSION_KWS01 // KWS (DS-CNN)
-    // Dieses Modell ist ein "Depthwise Separable" CNN.
-    static tflite::MicroMutableOpResolver<6> micro_op_resolver;
-    micro_op_resolver.AddDepthwiseConv2D(); // Speziell für DS-CNN
-    micro_op_resolver.AddConv2D();
-    micro_op_resolver.AddAveragePool2D();
-    micro_op_resolver.AddReshape();
-    micro_op_resolver.AddFullyConnected();
-    micro_op_resolver.AddSoftmax();
-    op_resolver = &micro_op_resolver;
-
-  #elif TH_MODEL_VERSION == EE_MODEL_VERSION_VWW01 // VWW (MobileNetV1)
-    // MobileNetV1 ist ebenfalls ein "Depthwise Separable" CNN.
-    static tflite::MicroMutableOpResolver<7> micro_op_resolver;
-    micro_op_resolver.AddConv2D();
-    micro_op_resolver.AddDepthwiseConv2D();
-    micro_op_resolver.AddAveragePool2D();
-    micro_op_resolver.AddReshape();
-    micro_op_resolver.AddSoftmax();
-    micro_op_resolver.AddFullyConnected();
-    micro_op_resolver.AddMean(); // Oft für das finale Pooling verwendet
-    op_resolver = &micro_op_resolver;
-
-  #elif TH_MODEL_VERSION == EE_MODEL_VERSION_AD01 // AD (Autoencoder)
-    // Dieses Modell ist ein reiner "Fully Connected" (FC) Autoencoder
-    // [cite: 229] [cite_start]und verwendet ReLU als Aktivierung[cite: 230].
-    static tflite::MicroMutableOpResolver<2> micro_op_resolver;
-    micro_op_resolver.AddFullyConnected();
-    micro_op_resolver.AddRelu();
-    op_resolver = &micro_op_resolver;
-    // HINWEIS: Die Berechnung des Anomaly-Scores (MSE) [cite: 232] wird
-    // typischerweise auf dem Host durchgeführt. Das On-Chip-Modell
-    // benötigt daher keine Ops wie Sub, Square oder Mean.
-
-  #elif TH_MODEL_VERSION == EE_MODEL_VERSION_STRWW01 // STRWW (RNN)
-    // Dies ist ein Recurrent Neural Network (RNN).
-    static tflite::MicroMutableOpResolver<4> micro_op_resolver;
-    micro_op_resolver.AddUnidirectionalSequenceLSTM(); // Long Short-Term Memory
-    micro_op_resolver.AddFullyConnected();
-    micro_op_resolver.AddSoftmax();
-    micro_op_resolver.AddReshape();
-    op_resolver = &micro_op_resolver;
-
-  #else
-    #error "TH_MODEL_VERSION nicht erkannt in AddOpsToResolver()"
-  #endif
-}
-
-void th_load_tensor() {
-  size_t input_size_bytes = model_input->bytes;
-  static uint8_t temp_host_buffer[MAX_DB_INPUT_SIZE];
-  
-  size_t host_buffer_size = ee_get_buffer(temp_host_buffer, input_size_bytes);
-
-  if (host_buffer_size != input_size_bytes) {
-    th_printf("FEHLER: Host-Puffer (%d) passt nicht zur Tensor-Groesse (%d)!\r\n", 
-              (int)host_buffer_size, (int)input_size_bytes);
-  }
-  
-  // ===================================================================
-  // MODELLSPEZIFISCHE LADEROUTINE
-  // ===================================================================
-
-  // HINWEIS: model_input->type prüft, was das MODELL erwartet.
-  //          Der #if-Block prüft, was der HOST sendet.
-
-  if (model_input->type == kTfLiteInt8) {
-    int8_t* tensor_data = model_input->data.int8;
-
-#if (TH_MODEL_VERSION == EE_MODEL_VERSION_IC01) || (TH_MODEL_VERSION == EE_MODEL_VERSION_VWW01)
-    //
-    // FALL 1: IC01 (Bilder) & VWW01 (Bilder)
-    // Der Host sendet uint8 (0-255). Das Modell erwartet int8 (-128 bis 127).
-    // Wir müssen den Offset von -128 anwenden.
-    //
-    for (size_t i = 0; i < input_size_bytes; i++) {
-      int16_t temp = (int16_t)temp_host_buffer[i] - 128;
-      tensor_data[i] = (int8_t)temp;
-    }
-    
-#elif (TH_MODEL_VERSION == EE_MODEL_VERSION_KWS01) || \
-      (TH_MODEL_VERSION == EE_MODEL_VERSION_AD01) || \
-      (TH_MODEL_VERSION == EE_MODEL_VERSION_STRWW01)
-    //
-    // KORRIGIERTER FALL 2: KWS01 (Audio), AD01, STRWW01
-    // Der Host sendet .bin-Dateien, die bereits als int8 (-128 bis 127) 
-    // gespeichert sind.
-    // Wir müssen die Bytes nur 1-zu-1 kopieren.
-    //
-    memcpy(tensor_data, temp_host_buffer, input_size_bytes);
-    
-#else
-    #error "Unbekannte TH_MODEL_VERSION fuer kTfLiteInt8-Laderoutine!"
-#endif
-  } 
-  else if (model_input->type == kTfLiteUInt8) {
-    //
-    // FALL 3: Ein uint8-Modell
-    // (Host sendet uint8, Modell erwartet uint8 -> direkte Kopie)
-    //
-    uint8_t* tensor_data = model_input->data.uint8;
-    memcpy(tensor_data, temp_host_buffer, input_size_bytes);
-  }
-  else {
-    th_printf("FEHLER: Unbekannter Input-Tensor-Typ!");
-  }
-}
-/**
- * @brief Gibt die Ergebnisse der Inferenz an den Host zurück.
- *
- * KORRIGIERTE VERSION: Liest den Output-Tensor als int8_t (signed),
- * da das Modell so konvertiert wurde.
- */
-void th_results() {
-  // 1. Sende den erforderlichen Header
-  th_printf("m-results-[");
-
-  // 2. Hole den Output-Tensor
-  TfLiteTensor* output = model_output;
-
-  // 3. Bestimme die Anzahl der Elemente im Output
-  size_t output_size = output->dims->data[output->dims->size - 1];
-
-  // 4. Hole die Quantisierungs-Parameter aus dem Tensor
-  float scale = output->params.scale;
-  int32_t zero_point = output->params.zero_point;
-
-  // 5. HIER IST DER FIX:
-  //    Wir MÜSSEN den Tensor als int8_t (signed) lesen,
-  //    nicht als uint8_t (unsigned).
-  int8_t* output_data = output->data.int8;
-
-  // 6. Schleife: Dequantisiere jeden Wert und drucke ihn
-  for (size_t i = 0; i < output_size; i++) {
-    // DEQUANTISIERUNG: (Wert - Nullpunkt) * Skalierungsfaktor
-    float float_val = ((float)output_data[i] - (float)zero_point) * scale;
-    
-    th_printf("%f", float_val);
-    
-    // Füge ein Komma hinzu, außer beim letzten Wert
-    if (i < output_size - 1) {
-      th_printf(",");
-    }
-  }
-  
-  // 7. Sende den abschließenden Footer
-  th_printf("]\r\n");
-}
-
-/**
- * @brief Führt eine einzelne Inferenz mit TFLM aus.
- */
-void th_infer() {
-  if (interpreter->Invoke() != kTfLiteOk) {
-    th_printf("FEHLER: interpreter->Invoke() ist fehlgeschlagen!");
-  }
-}
-
-/**
- * @brief Sendet einen Zeitstempel an den Host oder generiert ein GPIO-Signal.
- *
- * Das Verhalten hängt vom EE_CFG_ENERGY_MODE ab.
- */
-void th_timestamp(void) {
-#if EE_CFG_ENERGY_MODE
-  // ENERGIE-MODUS: Erzeuge Puls auf GPIO-Pin.
-  // Der Runner erwartet eine "Rising Edge" (0 -> 1).
-  
-  // 1. Trigger Start: Sofort auf HIGH (Rising Edge -> Joulescope Event!)
-  digitalWrite(TH_GPIO_TIMESTAMP_PIN, HIGH);
-  
-  // 2. Haltezeit: Damit das Joulescope (bei 10kHz Sampling) das sicher sieht.
-  // 2µs sind bei 10kHz Sampling (100µs Periode) evtl. zu kurz für den Downsampler, 
-  // aber da der LSB-Modus analog arbeitet, sollte es klappen. 
-  // Sicherer für langsame Sampling-Raten wären evtl. 10-20µs, aber probier es erst soj.
-  delayMicroseconds(500); 
-
-  // 3. Reset: Zurück auf LOW (Idle-Zustand)
-  digitalWrite(TH_GPIO_TIMESTAMP_PIN, LOW);
-
-#else 
-  // PERFORMANCE-MODUS
-  th_printf(EE_MSG_TIMESTAMP, micros());
-#endif
-}
-
-/**
- * @brief Eine Implementierung von printf(), die die serielle Schnittstelle
- * des Teensy (Serial.print) verwendet.
- */
-void th_printf(const char *fmt, ...) {
-  char buffer[128]; // Ein Puffer für die formatierte Zeichenkette
-  va_list args;
-  va_start(args, fmt);
-  // vsnprintf ist die "sichere" Version von sprintf
-  vsnprintf(buffer, sizeof(buffer), fmt, args);
-  va_end(args);
-
-#if EE_CFG_ENERGY_MODE
-  // ENERGIE-MODUS: Ausgabe über Hardware-UART (Serial2) an IO Manager
-  Serial2.print(buffer);
-  //Serial.print(buffer); // Optional: Debug-Ausgabe an USB-Serial
-#else
-  // PERFORMANCE-MODUS: Ausgabe über USB (Serial) an Host-PC
-  Serial.print(buffer);
-#endif
-}
-
-/**
- * @brief Eine Implementierung von getchar(), die auf ein Zeichen
- * von der seriellen Schnittstelle wartet (blockierend).
- */
-char th_getchar() {
-#if EE_CFG_ENERGY_MODE
-  // ENERGIE-MODUS: Lese von Hardware-UART (Serial2)
-  HardwareSerial& active_serial = Serial2;
-#else
-  // PERFORMANCE-MODUS: Lese von USB (Serial)
-  Stream& active_serial = Serial;
-#endif
-
-  // Warte, bis ein Zeichen verfügbar ist
-  while (!active_serial.available()) {
-    yield();
-  }
-  char message = active_serial.read();
-  //message = Serial.read(); // Debug-Zwecke
-  //th_printf("%c", message); // Echo zurück an den Sender; Debug-Zwecke
-  return message;
-}
-
-// ===================================================================
-// OPTIONALE API-FUNKTIONEN (Für Initialisierung benötigt)
-// ===================================================================
-
-/**
- * @brief Initialisiert die serielle Schnittstelle.
- */
-void th_serialport_initialize(void) {
-
-#if EE_CFG_ENERGY_MODE
-  // ENERGIE-MODUS: Starte Hardware-UART (Serial2) mit 9600 Baud für den IO Manager
-  // Wichtig: Du musst die Pins für Serial2 korrekt verbinden (Teensy Pin 0 (Rx1) & 1 (Tx1)).
-  Serial2.begin(9600); 
-  
-  // Im Energiemodus kann es sinnvoll sein, die USB-Serielle (Serial) für reines Debugging zu starten, 
-  // sie wird aber NICHT für die Übertragung von Ergebnissen genutzt.
-  //Serial.begin(115200); 
-  
-#else 
-  // PERFORMANCE-MODUS: Starte USB-CDC (Serial) mit hoher Baudrate
-  Serial.begin(115200); 
-#endif
-  
-  // Warte, bis der Port bereit ist (wichtig für USB, optional für Hardware-UART)
-  while (
-  #if EE_CFG_ENERGY_MODE
-    !Serial2
-  #else
-    !Serial
-  #endif
-  && (micros() < 500000)) { 
-    yield();
-  }
-}
-
-/**
- * @brief Initialisiert den Timer. (Nicht nötig für Teensy/micros())
- */
-void th_timestamp_initialize(void) {
-  // Auf Arduino/Teensy ist keine separate Initialisierung
-  // für micros() oder millis() erforderlich.
+  th_hal_serial_write(s, strlen(s));
 }
 
 /**
@@ -409,31 +145,32 @@ void th_timestamp_initialize(void) {
 void th_final_initialize(void) {
 
   // 2. Modell laden (g_model wird durch den #if-Block oben gesetzt)
-  model = tflite::GetModel(g_model);
-  /*
-  if (model->version() != TFLITE_SCHEMA_VERSION) {
-    th_printf("FEHLER: Modell-Schema-Version stimmt nicht überein!");
-    return;
-  }*/
-
-  // 3. Operatoren zum Resolver hinzufügen (je nach Modell)
-  AddOpsToResolver();
- 
-  // 4. Interpreter initialisieren
+#if TH_MODEL_LZ
+  // Modell einmalig in den RAM entpacken (lib/model_lz)
+  if (g_model == nullptr) g_model = model_lz_load(&model_lz_blob);
+  if (g_model == nullptr) return;
+#endif
+  const tflite::Model* model = th_tflm_model(g_model);
+
+  // 3. Interpreter mit den Operatoren des Modells (th_tflm_resolver)
   static tflite::MicroInterpreter static_interpreter(
-      model, *op_resolver, tensor_arena, kTensorArenaSize, 
+      model, *th_tflm_resolver<>(), tensor_arena, kTensorArenaSize,
       error_reporter, nullptr);
-  interpreter = &static_interpreter;
+  tflite::MicroInterpreter* interpreter = &static_interpreter;
 
-  // 5. Tensoren im Arena-Speicher zuweisen
-  if (interpreter->AllocateTensors() != kTfLiteOk) {
-    th_printf("FEHLER: AllocateTensors() fehlgeschlagen.");
-    return;
-  }
+  // 4. Tensoren zuweisen, Streaming/Batch starten
+  if (!th_tflm_start(interpreter, kTensorArenaSize, TH_ARENA_LOCATION)) return;
+
+  th_printf("DEBUG: Speicherlayout %d: Arena %s (%u Bytes belegt), Modell %s.\r\n",
+            (int)TH_TEENSY_LAYOUT, TH_ARENA_LOCATION,
+            (unsigned)interpreter->arena_used_bytes(), TH_MODEL_LOCATION);
 
-  // 6. Zeiger auf Input- und Output-Tensoren holen
-  model_input = interpreter->input(0);
-  model_output = interpreter->output(0);
+  // Cache-Richtlinie erst jetzt: AllocateTensors() hat die Arena beschrieben
+  m7_cache_init(tensor_arena, kTensorArenaSize, g_model, kModelSize);
+  m7_cache_set_prewarm(TH_CACHE_PREWARM);
+  if (!m7_cache_apply(TH_CACHE_POLICY)) {
+    th_printf("WARN: Cache-Richtlinie %d nicht anwendbar.\r\n", (int)TH_CACHE_POLICY);
+  }
 
   /*// DEBUG: Zeige Input-Tensor-Infos
   th_printf("DEBUG Input Tensor:\r\n");
@@ -454,69 +191,53 @@ void th_final_initialize(void) {
   th_printf("  Scale: %f\r\n", model_output->params.scale);
   th_printf("  Zero point: %d\r\n", model_output->params.zero_point);*/
 
-  #if EE_CFG_ENERGY_MODE
-  // Initialisiere den GPIO-Pin für den Timestamp im Energiemodus
-  pinMode(TH_GPIO_TIMESTAMP_PIN, OUTPUT);
-  // Setze den Pin auf HIGH als Standardzustand (Ruhezustand)
-  digitalWrite(TH_GPIO_TIMESTAMP_PIN, LOW);
-  //th_printf("DEBUG: Energie-Modus initialisiert. Timestamp-Pin %d\r\n", TH_GPIO_TIMESTAMP_PIN);
-  #else
+  #if !EE_CFG_ENERGY_MODE
     th_printf("DEBUG: Performance-Modus initialisiert.\r\n");
   #endif
 
 }
 
 // Leere Implementierungen für die restlichen optionalen Funktionen
-void th_pre() {}
-void th_post() {}
-void th_command_ready(char volatile *msg) {
-  ee_serial_command_parser_callback((char*) msg);
-}
-
-
-// ===================================================================
-// LIBC HOOKS (Erforderlich für das Framework)
-// ===================================================================
-// Diese Funktionen leiten die Anfragen des Frameworks an die
-// Standard-C-Bibliotheken weiter, die mit Arduino/Teensy geliefert werden.
-
-int th_strncmp(const char *str1, const char *str2, size_t n) {
-  return strncmp(str1, str2, n);
-}
-
-char *th_strncpy(char *dest, const char *src, size_t n) {
-  return strncpy(dest, src, n);
-}
-
-size_t th_strnlen(const char *str, size_t maxlen) {
-  return strnlen(str, maxlen);
+// Welche Kernel TFLM nutzt, entscheidet der Build der Bibliothek (CMSIS_NN).
+// Sind CMSIS-NN-Funktionen im Binary gelinkt, rufen die Kernel sie auf; die
+// schwachen Referenzen bleiben sonst 0. So meldet profile, was wirklich läuft.
+extern "C" {
+void arm_convolve_s8(void) __attribute__((weak));
+void arm_depthwise_conv_s8(void) __attribute__((weak));
+void arm_fully_connected_s8(void) __attribute__((weak));
+}
+
+const char* th_kernel_backend(void) {
+  if (arm_convolve_s8 != nullptr || arm_depthwise_conv_s8 != nullptr ||
+      arm_fully_connected_s8 != nullptr) {
+    return "cmsis-nn";
+  }
+  return "tflm-reference";
 }
 
-char *th_strcat(char *dest, const char *src) {
-  return strcat(dest, src);
+// Meldet die aktive Cache-Einstellung, z.B. für profile und Logs
+void th_cache_report(void) {
+  char buf[128];
+  m7_cache_describe(buf, sizeof(buf));
+  th_printf("m-cache-[%s]\r\n", buf);
 }
 
-char *th_strtok(char *str1, const char *sep) {
-  return strtok(str1, sep);
+// 0 = übernommen, -1 = unbekannter Name
+int th_cache_set_policy(const char *name) {
+  int policy = m7_cache_policy_from_name(name);
+  if (policy < 0 || !m7_cache_apply(policy)) return -1;
+  return 0;
 }
 
-int th_atoi(const char *str) {
-  return atoi(str);
+void th_cache_set_prewarm(int on) {
+  m7_cache_set_prewarm(on != 0);
 }
 
-void *th_memset(void *b, int c, size_t len) {
-  return memset(b, c, len);
-}
+// Liegt vor th_timestamp(), zählt also nicht zur gemessenen Zeit
+void th_board_load_done(void) { m7_cache_prewarm(); }
 
-void *th_memcpy(void *dst, const void *src, size_t n) {
-  return memcpy(dst, src, n);
+#if TH_SUMMARY
+void th_board_summary(void) {
+  th_printf("\"cache\":\"%s\",", m7_cache_policy_name(m7_cache_policy()));
 }
-
-int th_vprintf(const char *format, va_list ap) {
-  // Wir leiten dies an unsere th_printf-Implementierung weiter
-  char buffer[128];
-  vsnprintf(buffer, sizeof(buffer), format, ap);
-  Serial.print(buffer);
-  // vsnprintf gibt die Anzahl der geschriebenen Zeichen zurück
-  return strlen(buffer);
-}
\ No newline at end of file
+#endif
@@ -0,0 +1,182 @@
+/*
+ * th_hal_teensy40.cpp
+ *
+ * Board-Schicht (th_hal.h) für den Teensy 4.0.
+ * - PERFORMANCE MODE: USB-CDC (Serial), Zeit über micros()
+ * - ENERGY MODE: Hardware-UART (Serial2) zum IO Manager, Timestamp auf Pin 5
+ * - Speicher: Heap in der OCRAM, kein externer RAM
+ * - TH_LOW_POWER: WFI (und mit 2 ein niedriger Kerntakt) zwischen den Befehlen
+ */
+
+#include "submitter_implemented.h"
+#include "internally_implemented.h"
+#include "th_hal.h"
+
+#include <Arduino.h>  // Für Serial, micros()
+#include <stdlib.h>
+
+#if TH_LOW_POWER >= 2
+// Teensy-Core (clockspeed.c): Kerntakt im Betrieb umschalten
+extern "C" uint32_t set_arm_clock(uint32_t frequency);
+// Kerntakt zwischen zwei Befehlen; UART (PLL3) und USB hängen nicht daran
+#ifndef TH_IDLE_CPU_HZ
+#define TH_IDLE_CPU_HZ 24000000
+#endif
+#endif
+
+namespace {
+#if EE_CFG_ENERGY_MODE // Wird nur benötigt, wenn wir im Energiemodus sind
+  // Wähle einen GPIO-Pin auf deinem Teensy, z.B. D5
+  // Du musst den Pin wählen, der mit deinem Level Shifter/Joulescope verbunden ist!
+  constexpr int TH_GPIO_TIMESTAMP_PIN = 5;
+#endif
+
+#if TH_LOW_POWER >= 2
+  bool idle_clock = false; // true -> Kern läuft mit TH_IDLE_CPU_HZ
+#endif
+} // namespace
+
+// ===================================================================
+// SERIELLE SCHNITTSTELLE
+// ===================================================================
+
+/**
+ * @brief Initialisiert die serielle Schnittstelle.
+ */
+void th_hal_serial_init(void) {
+
+#if EE_CFG_ENERGY_MODE
+  // ENERGIE-MODUS: Starte Hardware-UART (Serial2) mit 9600 Baud für den IO Manager
+  // Wichtig: Du musst die Pins für Serial2 korrekt verbinden (Teensy Pin 0 (Rx1) & 1 (Tx1)).
+  Serial2.begin(9600);
+
+  // Im Energiemodus kann es sinnvoll sein, die USB-Serielle (Serial) für reines Debugging zu starten,
+  // sie wird aber NICHT für die Übertragung von Ergebnissen genutzt.
+  //Serial.begin(115200);
+
+#else
+  // PERFORMANCE-MODUS: Starte USB-CDC (Serial) mit hoher Baudrate
+  Serial.begin(115200);
+#endif
+
+  // Warte, bis der Port bereit ist (wichtig für USB, optional für Hardware-UART)
+  while (
+  #if EE_CFG_ENERGY_MODE
+    !Serial2
+  #else
+    !Serial
+  #endif
+  && (micros() < 500000)) {
+    yield();
+  }
+}
+
+void th_hal_serial_write(const char *buf, size_t len) {
+#if EE_CFG_ENERGY_MODE
+  // ENERGIE-MODUS: Ausgabe über Hardware-UART (Serial2) an IO Manager
+  Serial2.write((const uint8_t*)buf, len);
+#else
+  // PERFORMANCE-MODUS: Ausgabe über USB (Serial) an Host-PC
+  Serial.write((const uint8_t*)buf, len);
+#endif
+}
+
+/**
+ * @brief Wartet auf ein Zeichen von der seriellen Schnittstelle (blockierend).
+ */
+char th_hal_serial_getchar(void) {
+#if EE_CFG_ENERGY_MODE
+  // ENERGIE-MODUS: Lese von Hardware-UART (Serial2)
+  HardwareSerial& active_serial = Serial2;
+#else
+  // PERFORMANCE-MODUS: Lese von USB (Serial)
+  Stream& active_serial = Serial;
+#endif
+
+  // Warte, bis ein Zeichen verfügbar ist
+#if TH_LOW_POWER >= 2
+  if (!idle_clock && !active_serial.available()) {
+    set_arm_clock(TH_IDLE_CPU_HZ);
+    idle_clock = true;
+  }
+#endif
+  while (!active_serial.available()) {
+    yield();
+#if TH_LOW_POWER
+    // Schlafen bis zum nächsten Interrupt: UART/USB-Empfang oder SysTick
+    // (1 ms). Prüfung und WFI laufen maskiert, ein Empfang dazwischen bleibt
+    // anhängig und weckt sofort; der Handler läuft nach enable.
+    __disable_irq();
+    if (!active_serial.available()) asm volatile("wfi");
+    __enable_irq();
+#endif
+  }
+  return active_serial.read();
+}
+
+// ===================================================================
+// ZEIT & TIMESTAMP-PIN
+// ===================================================================
+
+// Auf Arduino/Teensy ist keine separate Initialisierung für micros() nötig
+unsigned long th_hal_micros(void) { return micros(); }
+
+unsigned long th_hal_cpu_mhz(void) { return F_CPU_ACTUAL / 1000000; }
+
+void th_hal_timestamp_init(void) {
+#if EE_CFG_ENERGY_MODE
+  pinMode(TH_GPIO_TIMESTAMP_PIN, OUTPUT);
+  // Ruhezustand LOW, der Runner erwartet eine steigende Flanke
+  digitalWrite(TH_GPIO_TIMESTAMP_PIN, LOW);
+#endif
+}
+
+void th_hal_timestamp_pulse(void) {
+#if EE_CFG_ENERGY_MODE
+  // 1. Trigger Start: Sofort auf HIGH (Rising Edge -> Joulescope Event!)
+  digitalWrite(TH_GPIO_TIMESTAMP_PIN, HIGH);
+
+  // 2. Haltezeit: Damit das Joulescope (bei 10kHz Sampling) das sicher sieht.
+  delayMicroseconds(500);
+
+  // 3. Reset: Zurück auf LOW (Idle-Zustand)
+  digitalWrite(TH_GPIO_TIMESTAMP_PIN, LOW);
+#endif
+}
+
+// ===================================================================
+// SPEICHER
+// ===================================================================
+
+// Der Heap liegt auf dem Teensy 4 in der OCRAM; die Arena selbst ist statisch
+void* th_hal_alloc(th_mem_tier_t tier, size_t bytes) {
+  if (tier != TH_MEM_INTERNAL) return nullptr;
+  return malloc(bytes);
+}
+
+const char* th_hal_tier_name(th_mem_tier_t tier) {
+  return tier == TH_MEM_INTERNAL ? "ocram" : "none";
+}
+
+// ===================================================================
+// LOW POWER
+// ===================================================================
+
+#if TH_LOW_POWER
+// WFI braucht keine Vorbereitung, der Takt sinkt erst in th_hal_serial_getchar()
+void th_hal_power_init(void) {
+}
+
+// Während ee_infer() wieder mit vollem Takt
+void th_busy_begin(void) {
+#if TH_LOW_POWER >= 2
+  if (idle_clock) {
+    set_arm_clock(F_CPU);
+    idle_clock = false;
+  }
+#endif
+}
+
+void th_busy_end(void) {
+}
+#endif
@@ -1,4 +1,4 @@
-unsigned char ad01_int8_tflite[] = {
+unsigned char ad01_int8_tflite[] __attribute__((aligned(16))) TH_MODEL_ATTR = {
   0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x12, 0x00,
   0x1c, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00,
   0x00, 0x00, 0x18, 0x00, 0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
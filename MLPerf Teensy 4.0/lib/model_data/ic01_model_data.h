@@ -1,58 +1,59 @@
-unsigned char pretrainedResnet_quant_tflite[] = {
+unsigned char pretrainedResnet_quant_tflite[] __attribute__((aligned(16))) TH_MODEL_ATTR = {
   0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x12, 0x00,
   0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00,
   0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0xe8, 0x35, 0x01, 0x00, 0xf8, 0x35, 0x01, 0x00,
-  0xd0, 0x7f, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x48, 0x36, 0x01, 0x00, 0x58, 0x36, 0x01, 0x00,
+  0x30, 0x80, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
   0x08, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
   0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74,
   0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x9c, 0x35, 0x01, 0x00, 0x94, 0x35, 0x01, 0x00,
-  0x5c, 0x35, 0x01, 0x00, 0x44, 0x35, 0x01, 0x00, 0xf4, 0x34, 0x01, 0x00,
-  0xa4, 0x34, 0x01, 0x00, 0x14, 0x34, 0x01, 0x00, 0x04, 0x33, 0x01, 0x00,
-  0x74, 0x30, 0x01, 0x00, 0xb4, 0x2e, 0x01, 0x00, 0xa4, 0x25, 0x01, 0x00,
-  0x94, 0x1c, 0x01, 0x00, 0x84, 0x0a, 0x01, 0x00, 0x74, 0xe6, 0x00, 0x00,
-  0x64, 0xe4, 0x00, 0x00, 0x54, 0x9c, 0x00, 0x00, 0x44, 0x0c, 0x00, 0x00,
-  0x34, 0x04, 0x00, 0x00, 0xe4, 0x03, 0x00, 0x00, 0x54, 0x03, 0x00, 0x00,
-  0xc4, 0x02, 0x00, 0x00, 0xb4, 0x01, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
-  0x9c, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00,
-  0x84, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-  0x6c, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
-  0x54, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x52, 0xca, 0xfe, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x35, 0x2e,
-  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x90, 0x82, 0xfe, 0xff, 0x94, 0x82, 0xfe, 0xff, 0x98, 0x82, 0xfe, 0xff,
-  0x9c, 0x82, 0xfe, 0xff, 0xa0, 0x82, 0xfe, 0xff, 0xa4, 0x82, 0xfe, 0xff,
-  0xa8, 0x82, 0xfe, 0xff, 0xac, 0x82, 0xfe, 0xff, 0xb0, 0x82, 0xfe, 0xff,
-  0xb4, 0x82, 0xfe, 0xff, 0xb8, 0x82, 0xfe, 0xff, 0xbc, 0x82, 0xfe, 0xff,
-  0xc0, 0x82, 0xfe, 0xff, 0xc4, 0x82, 0xfe, 0xff, 0xc8, 0x82, 0xfe, 0xff,
-  0xcc, 0x82, 0xfe, 0xff, 0xae, 0xca, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0xa6, 0xf5, 0xff, 0xff, 0x93, 0x01, 0x00, 0x00,
-  0x86, 0xf6, 0xff, 0xff, 0x87, 0xfa, 0xff, 0xff, 0xf2, 0xfc, 0xff, 0xff,
-  0x02, 0xf2, 0xff, 0xff, 0xa6, 0xfb, 0xff, 0xff, 0x95, 0xfc, 0xff, 0xff,
-  0x4d, 0xfc, 0xff, 0xff, 0x99, 0xf9, 0xff, 0xff, 0xb2, 0xfe, 0xff, 0xff,
-  0x45, 0x00, 0x00, 0x00, 0x0f, 0xf7, 0xff, 0xff, 0x93, 0xf8, 0xff, 0xff,
-  0xd9, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0xb7, 0xfe, 0xff, 0xff,
-  0x21, 0xfa, 0xff, 0xff, 0xa7, 0xfe, 0xff, 0xff, 0x6c, 0x02, 0x00, 0x00,
-  0x7c, 0xfc, 0xff, 0xff, 0x37, 0xf9, 0xff, 0xff, 0x49, 0x01, 0x00, 0x00,
-  0x26, 0xfb, 0xff, 0xff, 0xd5, 0xfd, 0xff, 0xff, 0x5e, 0xf9, 0xff, 0xff,
-  0xa6, 0xff, 0xff, 0xff, 0x84, 0xe7, 0xff, 0xff, 0x6a, 0xfa, 0xff, 0xff,
-  0x57, 0xf8, 0xff, 0xff, 0x6d, 0xf8, 0xff, 0xff, 0x62, 0xfd, 0xff, 0xff,
-  0x4c, 0xfb, 0xff, 0xff, 0x11, 0x04, 0x00, 0x00, 0x96, 0xff, 0xff, 0xff,
-  0xe7, 0xf3, 0xff, 0xff, 0x81, 0xfb, 0xff, 0xff, 0xd0, 0xfa, 0xff, 0xff,
-  0x16, 0xf9, 0xff, 0xff, 0x2a, 0x01, 0x00, 0x00, 0x89, 0xfd, 0xff, 0xff,
-  0x15, 0xf8, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0xa6, 0xee, 0xff, 0xff,
-  0x66, 0x02, 0x00, 0x00, 0xdb, 0xfc, 0xff, 0xff, 0x83, 0xfb, 0xff, 0xff,
-  0x1f, 0xf7, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x5a, 0xfa, 0xff, 0xff,
-  0xeb, 0xf6, 0xff, 0xff, 0x9b, 0xf6, 0xff, 0xff, 0x49, 0x00, 0x00, 0x00,
-  0xdf, 0xf3, 0xff, 0xff, 0x69, 0xf3, 0xff, 0xff, 0xbe, 0xf5, 0xff, 0xff,
-  0x57, 0x00, 0x00, 0x00, 0x79, 0xfc, 0xff, 0xff, 0xa3, 0xfe, 0xff, 0xff,
-  0xe8, 0xfd, 0xff, 0xff, 0xe5, 0xf9, 0xff, 0xff, 0xd2, 0x02, 0x00, 0x00,
-  0xc5, 0xf9, 0xff, 0xff, 0x0a, 0xff, 0xff, 0xff, 0xba, 0xcb, 0xfe, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x61, 0x0a, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0xfc, 0x35, 0x01, 0x00, 0xf4, 0x35, 0x01, 0x00,
+  0xb0, 0x35, 0x01, 0x00, 0x94, 0x35, 0x01, 0x00, 0x40, 0x35, 0x01, 0x00,
+  0xec, 0x34, 0x01, 0x00, 0x58, 0x34, 0x01, 0x00, 0x44, 0x33, 0x01, 0x00,
+  0xb0, 0x30, 0x01, 0x00, 0xec, 0x2e, 0x01, 0x00, 0xd8, 0x25, 0x01, 0x00,
+  0xc4, 0x1c, 0x01, 0x00, 0xb0, 0x0a, 0x01, 0x00, 0x9c, 0xe6, 0x00, 0x00,
+  0x88, 0xe4, 0x00, 0x00, 0x74, 0x9c, 0x00, 0x00, 0x60, 0x0c, 0x00, 0x00,
+  0x4c, 0x04, 0x00, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x64, 0x03, 0x00, 0x00,
+  0xd0, 0x02, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf2, 0xc9, 0xfe, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x31, 0x2e, 0x35, 0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x34, 0x82, 0xfe, 0xff, 0x38, 0x82, 0xfe, 0xff,
+  0x3c, 0x82, 0xfe, 0xff, 0x40, 0x82, 0xfe, 0xff, 0x44, 0x82, 0xfe, 0xff,
+  0x48, 0x82, 0xfe, 0xff, 0x4c, 0x82, 0xfe, 0xff, 0x50, 0x82, 0xfe, 0xff,
+  0x54, 0x82, 0xfe, 0xff, 0x58, 0x82, 0xfe, 0xff, 0x5c, 0x82, 0xfe, 0xff,
+  0x60, 0x82, 0xfe, 0xff, 0x64, 0x82, 0xfe, 0xff, 0x68, 0x82, 0xfe, 0xff,
+  0x6c, 0x82, 0xfe, 0xff, 0x70, 0x82, 0xfe, 0xff, 0x52, 0xca, 0xfe, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0xa6, 0xf5, 0xff, 0xff, 0x93, 0x01, 0x00, 0x00, 0x86, 0xf6, 0xff, 0xff,
+  0x87, 0xfa, 0xff, 0xff, 0xf2, 0xfc, 0xff, 0xff, 0x02, 0xf2, 0xff, 0xff,
+  0xa6, 0xfb, 0xff, 0xff, 0x95, 0xfc, 0xff, 0xff, 0x4d, 0xfc, 0xff, 0xff,
+  0x99, 0xf9, 0xff, 0xff, 0xb2, 0xfe, 0xff, 0xff, 0x45, 0x00, 0x00, 0x00,
+  0x0f, 0xf7, 0xff, 0xff, 0x93, 0xf8, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff,
+  0x37, 0xff, 0xff, 0xff, 0xb7, 0xfe, 0xff, 0xff, 0x21, 0xfa, 0xff, 0xff,
+  0xa7, 0xfe, 0xff, 0xff, 0x6c, 0x02, 0x00, 0x00, 0x7c, 0xfc, 0xff, 0xff,
+  0x37, 0xf9, 0xff, 0xff, 0x49, 0x01, 0x00, 0x00, 0x26, 0xfb, 0xff, 0xff,
+  0xd5, 0xfd, 0xff, 0xff, 0x5e, 0xf9, 0xff, 0xff, 0xa6, 0xff, 0xff, 0xff,
+  0x84, 0xe7, 0xff, 0xff, 0x6a, 0xfa, 0xff, 0xff, 0x57, 0xf8, 0xff, 0xff,
+  0x6d, 0xf8, 0xff, 0xff, 0x62, 0xfd, 0xff, 0xff, 0x4c, 0xfb, 0xff, 0xff,
+  0x11, 0x04, 0x00, 0x00, 0x96, 0xff, 0xff, 0xff, 0xe7, 0xf3, 0xff, 0xff,
+  0x81, 0xfb, 0xff, 0xff, 0xd0, 0xfa, 0xff, 0xff, 0x16, 0xf9, 0xff, 0xff,
+  0x2a, 0x01, 0x00, 0x00, 0x89, 0xfd, 0xff, 0xff, 0x15, 0xf8, 0xff, 0xff,
+  0x4c, 0xff, 0xff, 0xff, 0xa6, 0xee, 0xff, 0xff, 0x66, 0x02, 0x00, 0x00,
+  0xdb, 0xfc, 0xff, 0xff, 0x83, 0xfb, 0xff, 0xff, 0x1f, 0xf7, 0xff, 0xff,
+  0x80, 0x00, 0x00, 0x00, 0x5a, 0xfa, 0xff, 0xff, 0xeb, 0xf6, 0xff, 0xff,
+  0x9b, 0xf6, 0xff, 0xff, 0x49, 0x00, 0x00, 0x00, 0xdf, 0xf3, 0xff, 0xff,
+  0x69, 0xf3, 0xff, 0xff, 0xbe, 0xf5, 0xff, 0xff, 0x57, 0x00, 0x00, 0x00,
+  0x79, 0xfc, 0xff, 0xff, 0xa3, 0xfe, 0xff, 0xff, 0xe8, 0xfd, 0xff, 0xff,
+  0xe5, 0xf9, 0xff, 0xff, 0xd2, 0x02, 0x00, 0x00, 0xc5, 0xf9, 0xff, 0xff,
+  0x0a, 0xff, 0xff, 0xff, 0x62, 0xcb, 0xfe, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x61, 0x0a, 0x00, 0x00,
   0x7f, 0xff, 0xff, 0xff, 0x70, 0xf3, 0xff, 0xff, 0xb8, 0x04, 0x00, 0x00,
   0x78, 0x28, 0x00, 0x00, 0x3a, 0xf5, 0xff, 0xff, 0x2d, 0x03, 0x00, 0x00,
   0xbf, 0xf3, 0xff, 0xff, 0xc6, 0x34, 0x00, 0x00, 0x3b, 0x0f, 0x00, 0x00,
@@ -74,3281 +75,3283 @@ unsigned char pretrainedResnet_quant_tflite[] = {
   0xe8, 0x32, 0x00, 0x00, 0xf3, 0x10, 0x00, 0x00, 0xa5, 0x1b, 0x00, 0x00,
   0x28, 0x25, 0x00, 0x00, 0x12, 0x12, 0x00, 0x00, 0x05, 0xef, 0xff, 0xff,
   0x99, 0x1b, 0x00, 0x00, 0x40, 0xf9, 0xff, 0xff, 0x77, 0x1f, 0x00, 0x00,
-  0xc6, 0xcc, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x8b, 0xff, 0xff, 0xff, 0x21, 0x00, 0x00, 0x00, 0x28, 0x05, 0x00, 0x00,
-  0xc2, 0xfb, 0xff, 0xff, 0x95, 0xfe, 0xff, 0xff, 0xf9, 0xf5, 0xff, 0xff,
-  0x5e, 0xff, 0xff, 0xff, 0x91, 0x04, 0x00, 0x00, 0xaa, 0x17, 0x00, 0x00,
-  0x3c, 0xfb, 0xff, 0xff, 0xec, 0xfb, 0xff, 0xff, 0xb6, 0xfe, 0xff, 0xff,
-  0xab, 0xfa, 0xff, 0xff, 0x90, 0xfe, 0xff, 0xff, 0x78, 0x02, 0x00, 0x00,
-  0x6b, 0x01, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x25, 0xfd, 0xff, 0xff,
-  0x75, 0x04, 0x00, 0x00, 0x23, 0x06, 0x00, 0x00, 0x50, 0xf8, 0xff, 0xff,
-  0xba, 0x06, 0x00, 0x00, 0xd2, 0x04, 0x00, 0x00, 0xd9, 0xf8, 0xff, 0xff,
-  0xa3, 0x00, 0x00, 0x00, 0xd2, 0x01, 0x00, 0x00, 0x4a, 0xf5, 0xff, 0xff,
-  0xb5, 0xff, 0xff, 0xff, 0x3e, 0x03, 0x00, 0x00, 0xf2, 0xf2, 0xff, 0xff,
-  0x86, 0x06, 0x00, 0x00, 0x3a, 0x08, 0x00, 0x00, 0x52, 0xcd, 0xfe, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x15, 0x24, 0x00, 0x00,
-  0x0b, 0xf5, 0xff, 0xff, 0x88, 0x1e, 0x00, 0x00, 0xdf, 0xe6, 0xff, 0xff,
-  0xd5, 0x0f, 0x00, 0x00, 0xc8, 0xf4, 0xff, 0xff, 0xf3, 0x4f, 0x00, 0x00,
-  0xf0, 0xfe, 0xff, 0xff, 0xfe, 0x6e, 0x00, 0x00, 0xdb, 0xc2, 0xff, 0xff,
-  0xc5, 0x08, 0x00, 0x00, 0x21, 0x36, 0x00, 0x00, 0xab, 0x14, 0x00, 0x00,
-  0xe3, 0x2a, 0x00, 0x00, 0xec, 0xd2, 0xff, 0xff, 0x47, 0xe5, 0xff, 0xff,
-  0x65, 0x6e, 0x00, 0x00, 0x27, 0x15, 0x00, 0x00, 0x2b, 0x08, 0x00, 0x00,
-  0x78, 0x46, 0x00, 0x00, 0x81, 0xc9, 0xff, 0xff, 0x61, 0x2a, 0x00, 0x00,
-  0x53, 0x2c, 0x00, 0x00, 0x94, 0x03, 0x00, 0x00, 0x85, 0xfa, 0xff, 0xff,
-  0xc1, 0x19, 0x00, 0x00, 0xc1, 0xe4, 0xff, 0xff, 0x41, 0xe6, 0xff, 0xff,
-  0x34, 0x49, 0x00, 0x00, 0x27, 0xf8, 0xff, 0xff, 0x2d, 0x2e, 0x00, 0x00,
-  0xed, 0x1a, 0x00, 0x00, 0xde, 0xcd, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x72, 0xcc, 0xfe, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x8b, 0xff, 0xff, 0xff, 0x21, 0x00, 0x00, 0x00,
+  0x28, 0x05, 0x00, 0x00, 0xc2, 0xfb, 0xff, 0xff, 0x95, 0xfe, 0xff, 0xff,
+  0xf9, 0xf5, 0xff, 0xff, 0x5e, 0xff, 0xff, 0xff, 0x91, 0x04, 0x00, 0x00,
+  0xaa, 0x17, 0x00, 0x00, 0x3c, 0xfb, 0xff, 0xff, 0xec, 0xfb, 0xff, 0xff,
+  0xb6, 0xfe, 0xff, 0xff, 0xab, 0xfa, 0xff, 0xff, 0x90, 0xfe, 0xff, 0xff,
+  0x78, 0x02, 0x00, 0x00, 0x6b, 0x01, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00,
+  0x25, 0xfd, 0xff, 0xff, 0x75, 0x04, 0x00, 0x00, 0x23, 0x06, 0x00, 0x00,
+  0x50, 0xf8, 0xff, 0xff, 0xba, 0x06, 0x00, 0x00, 0xd2, 0x04, 0x00, 0x00,
+  0xd9, 0xf8, 0xff, 0xff, 0xa3, 0x00, 0x00, 0x00, 0xd2, 0x01, 0x00, 0x00,
+  0x4a, 0xf5, 0xff, 0xff, 0xb5, 0xff, 0xff, 0xff, 0x3e, 0x03, 0x00, 0x00,
+  0xf2, 0xf2, 0xff, 0xff, 0x86, 0x06, 0x00, 0x00, 0x3a, 0x08, 0x00, 0x00,
+  0x02, 0xcd, 0xfe, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x15, 0x24, 0x00, 0x00, 0x0b, 0xf5, 0xff, 0xff,
+  0x88, 0x1e, 0x00, 0x00, 0xdf, 0xe6, 0xff, 0xff, 0xd5, 0x0f, 0x00, 0x00,
+  0xc8, 0xf4, 0xff, 0xff, 0xf3, 0x4f, 0x00, 0x00, 0xf0, 0xfe, 0xff, 0xff,
+  0xfe, 0x6e, 0x00, 0x00, 0xdb, 0xc2, 0xff, 0xff, 0xc5, 0x08, 0x00, 0x00,
+  0x21, 0x36, 0x00, 0x00, 0xab, 0x14, 0x00, 0x00, 0xe3, 0x2a, 0x00, 0x00,
+  0xec, 0xd2, 0xff, 0xff, 0x47, 0xe5, 0xff, 0xff, 0x65, 0x6e, 0x00, 0x00,
+  0x27, 0x15, 0x00, 0x00, 0x2b, 0x08, 0x00, 0x00, 0x78, 0x46, 0x00, 0x00,
+  0x81, 0xc9, 0xff, 0xff, 0x61, 0x2a, 0x00, 0x00, 0x53, 0x2c, 0x00, 0x00,
+  0x94, 0x03, 0x00, 0x00, 0x85, 0xfa, 0xff, 0xff, 0xc1, 0x19, 0x00, 0x00,
+  0xc1, 0xe4, 0xff, 0xff, 0x41, 0xe6, 0xff, 0xff, 0x34, 0x49, 0x00, 0x00,
+  0x27, 0xf8, 0xff, 0xff, 0x2d, 0x2e, 0x00, 0x00, 0xed, 0x1a, 0x00, 0x00,
+  0x92, 0xcd, 0xfe, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x40, 0x00, 0x00, 0x00, 0x60, 0x20, 0x00, 0x00, 0xe6, 0x05, 0x00, 0x00,
   0x14, 0xfc, 0xff, 0xff, 0xe7, 0xef, 0xff, 0xff, 0x23, 0x02, 0x00, 0x00,
   0x94, 0x01, 0x00, 0x00, 0x8b, 0xf7, 0xff, 0xff, 0x95, 0xe9, 0xff, 0xff,
   0x88, 0xff, 0xff, 0xff, 0xb0, 0x19, 0x00, 0x00, 0xcc, 0x1a, 0x00, 0x00,
   0xc4, 0xfc, 0xff, 0xff, 0x54, 0xf8, 0xff, 0xff, 0x12, 0x02, 0x00, 0x00,
-  0x33, 0x0a, 0x00, 0x00, 0xf4, 0xe3, 0xff, 0xff, 0x2a, 0xce, 0xfe, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x04, 0xf5, 0x2c,
-  0xfb, 0x35, 0xb7, 0xfc, 0xc4, 0x15, 0x14, 0x0d, 0xcb, 0xd6, 0x39, 0xd8,
-  0x0b, 0x31, 0xc1, 0x17, 0xe8, 0x25, 0x10, 0x1d, 0xf3, 0x81, 0xe7, 0x10,
-  0xac, 0x24, 0x1a, 0xcb, 0xe6, 0x07, 0x30, 0x08, 0x9e, 0xf7, 0xaf, 0xac,
-  0x8c, 0xe6, 0x0d, 0xee, 0xc2, 0xee, 0x36, 0x59, 0xc6, 0x0d, 0x7f, 0x07,
-  0x40, 0x1e, 0xc0, 0xd5, 0xad, 0x7a, 0x2e, 0x3a, 0x84, 0x17, 0x1b, 0x54,
-  0x49, 0x2a, 0xda, 0x81, 0xa8, 0xd6, 0x4f, 0x19, 0xb4, 0xeb, 0x03, 0xf0,
-  0xf3, 0x41, 0x07, 0x28, 0x00, 0xd7, 0x82, 0xbd, 0x0d, 0xdc, 0x42, 0x05,
-  0xe4, 0x37, 0x1e, 0x00, 0xa3, 0xcc, 0xd0, 0xc9, 0x27, 0xf6, 0xf6, 0xf5,
-  0x7f, 0xfd, 0x00, 0x39, 0x48, 0x9b, 0x06, 0xf8, 0x5a, 0xfa, 0xef, 0xcb,
-  0xfe, 0xf4, 0xff, 0x29, 0xc4, 0xdf, 0xe8, 0xed, 0xce, 0xc6, 0xf5, 0x1d,
-  0x5f, 0xfd, 0xe0, 0xd4, 0x3f, 0x02, 0x0a, 0x37, 0x72, 0x12, 0x81, 0xba,
-  0x2c, 0x1d, 0x3e, 0xdd, 0x19, 0xf9, 0x01, 0x8b, 0xb3, 0xf0, 0x14, 0x06,
-  0xdf, 0xf6, 0x20, 0xe2, 0x38, 0xa8, 0x1c, 0x20, 0xf5, 0xe2, 0xd4, 0xe7,
-  0xab, 0xfb, 0xa5, 0x20, 0xf5, 0xeb, 0x83, 0xd8, 0xfd, 0xfc, 0x2a, 0x11,
-  0xee, 0xf3, 0xfe, 0x81, 0x0a, 0x0c, 0xea, 0x24, 0xf1, 0x03, 0xf5, 0xe8,
-  0x05, 0xa8, 0xf9, 0xe2, 0xb6, 0x08, 0xdd, 0xd4, 0xa6, 0xf7, 0x07, 0x12,
-  0xe6, 0xff, 0x81, 0xd9, 0xff, 0xd0, 0x14, 0xd9, 0xde, 0xd1, 0xd8, 0xa6,
-  0xe8, 0x04, 0x2b, 0x22, 0x10, 0xeb, 0xfd, 0xe7, 0x57, 0xbf, 0x03, 0xf6,
-  0xbf, 0xf4, 0xff, 0xf9, 0xb4, 0x1f, 0x83, 0xd0, 0xf0, 0xd3, 0x8c, 0x0a,
-  0x4a, 0x2f, 0x0e, 0x0d, 0x7f, 0xea, 0x1f, 0x3b, 0xe0, 0x0d, 0x02, 0xbe,
-  0xd0, 0x15, 0xd8, 0x0e, 0x36, 0xb1, 0xf5, 0xf5, 0xb1, 0xf7, 0xfa, 0xa9,
-  0xff, 0xde, 0xb9, 0xf0, 0x52, 0x04, 0xe5, 0xff, 0xe4, 0x2b, 0x02, 0x24,
-  0x2c, 0xfc, 0xed, 0xa4, 0x13, 0xfc, 0xbe, 0x1f, 0x18, 0x2c, 0x03, 0xec,
-  0x10, 0x81, 0xec, 0xaf, 0x10, 0x2d, 0x1d, 0xf8, 0x31, 0xf5, 0xeb, 0xdd,
-  0x4b, 0xe2, 0xfd, 0x04, 0xe9, 0xd1, 0xc5, 0xc9, 0xf7, 0x12, 0x2f, 0x9c,
-  0x3d, 0x22, 0x0d, 0xd3, 0x0e, 0xa6, 0x7f, 0xdd, 0xbc, 0x07, 0x07, 0xaf,
-  0x06, 0x03, 0xe7, 0x8c, 0x15, 0xe0, 0x00, 0xda, 0x81, 0xfa, 0xf2, 0x26,
-  0x21, 0x4a, 0x42, 0x1d, 0xd1, 0x3c, 0x10, 0x0f, 0x4c, 0xea, 0x0c, 0xf1,
-  0x03, 0x31, 0x14, 0xb4, 0xc4, 0x04, 0xfa, 0x23, 0x82, 0x2b, 0xe9, 0x02,
-  0x9a, 0x0d, 0x08, 0x5e, 0x12, 0x04, 0x81, 0xd1, 0xcd, 0x2b, 0x4f, 0x00,
-  0xb4, 0xc7, 0x1a, 0xb5, 0xff, 0x45, 0xd7, 0x0e, 0x2a, 0x16, 0xcc, 0xfc,
-  0x7d, 0xbb, 0xf7, 0x3b, 0xa0, 0x2b, 0xf8, 0xe3, 0xc5, 0xff, 0xda, 0x43,
-  0x29, 0x24, 0xf3, 0xb3, 0xeb, 0x0c, 0x1a, 0xe1, 0xe3, 0xc5, 0x0d, 0xd6,
-  0x14, 0x0d, 0xcb, 0xf5, 0x37, 0x32, 0xe0, 0x31, 0x4d, 0x81, 0xf5, 0xd9,
-  0xf7, 0xea, 0x07, 0xbc, 0x02, 0xab, 0xd5, 0xab, 0xd8, 0xef, 0xdf, 0x11,
-  0xbd, 0xfc, 0x13, 0x27, 0x9b, 0xc2, 0xfb, 0xbe, 0xc2, 0x2d, 0xe8, 0x00,
-  0xf4, 0xec, 0x02, 0xe5, 0xce, 0x22, 0x61, 0xd4, 0x7f, 0xdc, 0xde, 0xb8,
-  0xe0, 0xfd, 0x2d, 0x26, 0x29, 0x2b, 0x81, 0x37, 0x6b, 0x01, 0x16, 0x26,
-  0x4e, 0x36, 0xf4, 0x9d, 0xc3, 0x37, 0x36, 0x02, 0x0b, 0x05, 0xbf, 0xe9,
-  0x55, 0x9f, 0x1b, 0x1c, 0xd3, 0x2b, 0xf3, 0xeb, 0x81, 0x3a, 0x22, 0xe2,
-  0xd7, 0xc5, 0xb6, 0x03, 0xbd, 0xe0, 0x26, 0x34, 0x04, 0x1c, 0xda, 0x39,
-  0xdd, 0xc2, 0x30, 0x0a, 0xe5, 0x0e, 0xf1, 0x0c, 0xdd, 0x33, 0x2c, 0x1b,
-  0x0e, 0xcc, 0xce, 0xdd, 0xe6, 0x1b, 0x33, 0x27, 0xf8, 0x18, 0xd4, 0xcd,
-  0x05, 0xfa, 0x0c, 0xd8, 0x01, 0xe5, 0xf9, 0x51, 0xdf, 0x2a, 0x7f, 0x18,
-  0xf0, 0xf4, 0x02, 0x2a, 0xc9, 0x22, 0x04, 0xef, 0xa6, 0xf9, 0x0f, 0xe7,
-  0xae, 0xe3, 0xdd, 0xe4, 0xf6, 0xff, 0x81, 0x44, 0xe4, 0xf0, 0x1b, 0x0f,
-  0xec, 0x17, 0xea, 0x9d, 0xf7, 0xf2, 0xe5, 0x1a, 0xf0, 0x19, 0x0d, 0x02,
-  0x1c, 0xaa, 0x39, 0xfa, 0x9e, 0xf2, 0xeb, 0xf4, 0xa1, 0x1c, 0x08, 0x34,
-  0xcf, 0xf4, 0x81, 0xd5, 0x27, 0x1c, 0xf2, 0x02, 0xc4, 0xf9, 0x1c, 0xd3,
-  0x2c, 0xe4, 0x46, 0xe3, 0x4b, 0x0c, 0xf0, 0x05, 0xf9, 0xbe, 0x26, 0xdc,
-  0xc1, 0x3f, 0x4e, 0x24, 0xce, 0xf9, 0x00, 0x4a, 0x10, 0x2a, 0xa8, 0xf5,
-  0x21, 0x02, 0x29, 0x05, 0x20, 0x1d, 0x1a, 0x81, 0xfe, 0xff, 0x11, 0x43,
-  0x10, 0xe2, 0x13, 0xf7, 0x3a, 0xfc, 0x0c, 0x07, 0xce, 0x0d, 0xe0, 0x15,
-  0x91, 0xfa, 0x1b, 0x39, 0x33, 0x0c, 0xbb, 0xe9, 0xf0, 0xb6, 0x21, 0x08,
-  0xf6, 0xfa, 0xff, 0x81, 0xd9, 0xe9, 0x04, 0x0b, 0xea, 0xd0, 0x07, 0xfd,
-  0x29, 0x02, 0x17, 0x28, 0x0e, 0xd3, 0x2c, 0xfc, 0x14, 0xe4, 0x28, 0x3b,
-  0xc0, 0x4d, 0x88, 0xca, 0x0e, 0xfb, 0x37, 0x59, 0xf4, 0x0d, 0xc3, 0xff,
-  0x81, 0xb2, 0xd9, 0xe3, 0xf4, 0x16, 0xe4, 0x15, 0xbd, 0xcf, 0x19, 0xf9,
-  0x4d, 0xfd, 0x93, 0xe6, 0xa7, 0xf7, 0x17, 0x3a, 0xd6, 0x04, 0x81, 0xdb,
-  0x16, 0xef, 0xfe, 0xc5, 0x25, 0x02, 0xe3, 0xb7, 0xc9, 0x09, 0x51, 0xe9,
-  0x32, 0x10, 0xd2, 0x29, 0xe0, 0xf9, 0x31, 0xbe, 0xcd, 0xfc, 0xfc, 0xf2,
-  0xc9, 0xd6, 0xf5, 0xc3, 0x0f, 0xf2, 0xe2, 0x41, 0x91, 0xb8, 0x30, 0xd6,
-  0xe1, 0x24, 0xfc, 0x81, 0x07, 0x08, 0x04, 0xeb, 0xf6, 0xc8, 0x31, 0x06,
-  0x65, 0x75, 0x45, 0x31, 0x0f, 0x21, 0xe4, 0x04, 0xaa, 0x29, 0xe4, 0x3c,
-  0x07, 0xfb, 0x81, 0xbd, 0xc3, 0xe7, 0x24, 0xf5, 0xb1, 0xfe, 0x13, 0xd2,
-  0x01, 0x27, 0x14, 0xf8, 0x05, 0x16, 0x21, 0xf2, 0x08, 0xe9, 0x05, 0x1c,
-  0x97, 0x05, 0xcc, 0xd2, 0xcf, 0xd9, 0xc8, 0xe7, 0xb3, 0x32, 0x7a, 0xff,
-  0xdd, 0x14, 0x2c, 0x2a, 0xcb, 0x00, 0xf9, 0x81, 0xe7, 0xea, 0xd7, 0x10,
-  0x1a, 0xe5, 0xe6, 0xeb, 0xee, 0x2d, 0xf8, 0x06, 0xc9, 0x0d, 0x24, 0x1c,
-  0xe0, 0xf6, 0xfd, 0x05, 0x0d, 0x0d, 0xbf, 0xe2, 0x06, 0xe0, 0x1a, 0xf1,
-  0xe8, 0x0f, 0xdf, 0x81, 0x06, 0xfb, 0x05, 0x21, 0xff, 0xe9, 0x29, 0x00,
-  0x6b, 0xd2, 0xf6, 0xfd, 0xcd, 0x08, 0x04, 0xf9, 0xab, 0xb4, 0x81, 0x28,
-  0xe4, 0xf1, 0xc9, 0xf9, 0xd3, 0xf4, 0x68, 0x0d, 0xcd, 0xf9, 0xfc, 0x8e,
-  0xff, 0x30, 0xb3, 0x17, 0x37, 0x0e, 0xd1, 0x05, 0xdf, 0xb5, 0xe7, 0xd9,
-  0xbd, 0x06, 0xaa, 0x81, 0xc1, 0x0a, 0xdb, 0x08, 0xf2, 0xfe, 0xce, 0xd8,
-  0xbf, 0xff, 0xfc, 0x3a, 0xec, 0x08, 0xed, 0x81, 0x1b, 0x07, 0xa8, 0x30,
-  0xfc, 0x4b, 0xc2, 0x25, 0xe2, 0xb8, 0x05, 0xd8, 0x94, 0x2b, 0xf1, 0xf4,
-  0xe4, 0xd9, 0xf6, 0xbd, 0xd2, 0x96, 0x36, 0xe0, 0x79, 0x55, 0xfd, 0x8e,
-  0x32, 0x22, 0xd0, 0x06, 0xdf, 0xbb, 0xc3, 0xcd, 0xf6, 0xe3, 0x36, 0xbb,
-  0x14, 0x68, 0x45, 0xeb, 0x05, 0xc0, 0xd1, 0x81, 0x81, 0x08, 0xff, 0xfb,
-  0xf9, 0xfb, 0xb9, 0xed, 0x06, 0xc8, 0x0b, 0xe4, 0xbf, 0xce, 0xc5, 0x91,
-  0xef, 0xe8, 0x37, 0xf0, 0x29, 0x05, 0xe6, 0xfd, 0xcc, 0xe7, 0x2b, 0x15,
-  0xe9, 0xd9, 0x2a, 0xfb, 0x98, 0x1b, 0xdc, 0x33, 0xce, 0x01, 0x81, 0xd7,
-  0x1d, 0x2d, 0xe4, 0xfb, 0xf8, 0xfa, 0xd2, 0x8b, 0xc2, 0xd6, 0xe0, 0x17,
-  0x08, 0x35, 0x1d, 0x16, 0x16, 0xc5, 0xfe, 0xda, 0xea, 0x30, 0x41, 0xe7,
-  0xd5, 0xe2, 0xdd, 0x25, 0xcc, 0x32, 0xdd, 0xe6, 0x06, 0xe1, 0x0e, 0x7f,
-  0xcf, 0xfa, 0xd7, 0xbc, 0xd0, 0xc7, 0xdc, 0x2a, 0x0a, 0x1b, 0xef, 0x01,
-  0x2a, 0x9c, 0x1a, 0xfe, 0xd3, 0xd9, 0xe5, 0x34, 0xf4, 0xe0, 0xf3, 0xaf,
-  0xd0, 0x29, 0x81, 0xd9, 0x10, 0x00, 0x0a, 0x39, 0xc3, 0xda, 0xe9, 0x26,
-  0xed, 0x11, 0xc1, 0xf2, 0xec, 0xf5, 0x06, 0xfe, 0xe2, 0x9f, 0x2a, 0x02,
-  0xcf, 0x10, 0x26, 0x54, 0x57, 0x3c, 0xb5, 0xf0, 0x01, 0xa2, 0x7f, 0x82,
-  0xef, 0xb4, 0xf2, 0xd2, 0xcd, 0x8a, 0xf5, 0x4d, 0xb4, 0xb8, 0x82, 0xaa,
-  0xf9, 0x9c, 0x59, 0x24, 0xae, 0x34, 0xd9, 0xb6, 0x5a, 0xcd, 0xe3, 0x50,
-  0xd6, 0xea, 0x12, 0xd9, 0xe5, 0xf1, 0xae, 0xf1, 0xde, 0xea, 0x00, 0x07,
-  0xf5, 0x23, 0xf4, 0xe8, 0x08, 0x0d, 0xb4, 0x14, 0xf3, 0xfb, 0xf7, 0x01,
-  0x36, 0x81, 0x07, 0xd3, 0xcd, 0xe2, 0xff, 0x04, 0xf7, 0xf2, 0xcb, 0x54,
-  0x12, 0x25, 0xc8, 0xa6, 0xef, 0x37, 0x06, 0xff, 0xc5, 0xdd, 0x0b, 0xbd,
-  0xa6, 0x44, 0xe5, 0xe5, 0x40, 0xe9, 0x23, 0x22, 0x7f, 0xb5, 0xf0, 0xf4,
-  0xa5, 0xf1, 0x1c, 0xe7, 0xa4, 0x04, 0x9d, 0x18, 0xc4, 0xfd, 0x9d, 0xf8,
-  0x38, 0x4b, 0xe7, 0x40, 0xe5, 0xf8, 0x03, 0xf9, 0x13, 0x13, 0x9b, 0xff,
-  0xfe, 0x26, 0xfb, 0xee, 0xfa, 0x81, 0x45, 0xe6, 0xd4, 0x29, 0xf4, 0xdd,
-  0xfb, 0xa0, 0xfb, 0xc2, 0xa6, 0xd6, 0xe9, 0x2f, 0x29, 0x81, 0x12, 0xcc,
-  0xeb, 0x0d, 0xce, 0xc2, 0x00, 0x36, 0xe8, 0xf3, 0xff, 0x02, 0xf2, 0xb2,
-  0xba, 0xe4, 0x4e, 0xf9, 0x3c, 0x13, 0xe6, 0x1f, 0xe0, 0xf7, 0xe4, 0x0a,
-  0xb9, 0x1e, 0x81, 0x16, 0x31, 0x31, 0xf1, 0x3d, 0xd7, 0x0d, 0xfe, 0x26,
-  0x07, 0xe9, 0x24, 0x2f, 0x00, 0x26, 0xeb, 0x0e, 0x08, 0x93, 0x1c, 0xd8,
-  0x95, 0x1f, 0x20, 0x0f, 0x14, 0x20, 0x47, 0x38, 0x4b, 0x17, 0xe7, 0xfe,
-  0x48, 0x19, 0xff, 0xf7, 0x54, 0xfa, 0xf5, 0xb1, 0xe0, 0x20, 0xf4, 0x08,
-  0xf9, 0xe1, 0x11, 0x1a, 0x5b, 0x81, 0x01, 0xd8, 0x1c, 0x18, 0x02, 0xd3,
-  0xc0, 0xb3, 0xde, 0x7f, 0xad, 0x1d, 0xc8, 0x1f, 0x0c, 0x10, 0x05, 0x04,
-  0xbe, 0xcf, 0x0a, 0x95, 0x15, 0x21, 0xca, 0x2d, 0x08, 0x1b, 0xda, 0xf0,
-  0xd2, 0xe2, 0xff, 0xc7, 0xc3, 0x5f, 0xe4, 0xc5, 0xc1, 0xf7, 0xf8, 0xff,
-  0xea, 0xdb, 0x81, 0xc1, 0xcd, 0xed, 0x09, 0xcf, 0xdf, 0xdf, 0xf2, 0x0e,
-  0x25, 0xc9, 0x35, 0x19, 0x4f, 0x2b, 0x49, 0xf4, 0x3f, 0xbc, 0x22, 0xd7,
-  0xb3, 0xdf, 0x12, 0x05, 0x92, 0x02, 0x93, 0xe3, 0xba, 0xf3, 0xee, 0x18,
-  0x38, 0xdd, 0x1c, 0x20, 0xbe, 0x2a, 0xab, 0x97, 0x0d, 0x44, 0xb1, 0x3f,
-  0xce, 0x68, 0x9e, 0x1a, 0xcb, 0x81, 0xf7, 0xce, 0x95, 0x14, 0xf3, 0xd0,
-  0xe0, 0x04, 0xf6, 0x38, 0x13, 0x2d, 0x81, 0xb4, 0x12, 0x1c, 0x22, 0x08,
-  0xc9, 0x05, 0xf6, 0x85, 0xb6, 0x4e, 0xfa, 0xea, 0x0f, 0xfe, 0x02, 0x0c,
-  0x50, 0xf6, 0xf4, 0xfd, 0xe3, 0x07, 0x13, 0x11, 0x3c, 0x14, 0xfa, 0xb6,
-  0xf0, 0x0d, 0x26, 0x03, 0xc5, 0x09, 0xf4, 0x06, 0x0c, 0x1e, 0x35, 0x2a,
-  0x2a, 0xfb, 0x81, 0x0b, 0xe2, 0xe5, 0x12, 0x1c, 0x2f, 0xf9, 0xcd, 0x08,
-  0xd8, 0xe3, 0x01, 0x0f, 0x81, 0xfe, 0xef, 0xc4, 0xf2, 0xed, 0xa8, 0xc7,
-  0x26, 0x01, 0xb6, 0xfe, 0xe7, 0xe6, 0xe5, 0xa0, 0x9f, 0xfe, 0x20, 0xce,
-  0x03, 0xe7, 0xf7, 0x2b, 0x66, 0xad, 0xf4, 0xd9, 0xc9, 0xdf, 0x54, 0x15,
-  0xc4, 0xd8, 0x66, 0x35, 0xb9, 0x30, 0xa4, 0x18, 0xe4, 0xde, 0xee, 0xde,
-  0xf4, 0xd7, 0xde, 0xb2, 0xf3, 0xf7, 0x19, 0xd5, 0x08, 0x39, 0xdb, 0x14,
-  0xb9, 0xa8, 0x1c, 0x9c, 0xdd, 0x1b, 0x7f, 0x06, 0xdf, 0xfb, 0x26, 0xd9,
-  0xb5, 0x0d, 0x4b, 0xf7, 0x19, 0xec, 0xf3, 0x3b, 0xe6, 0x30, 0xf9, 0x81,
-  0xfb, 0x2d, 0x0e, 0x15, 0x39, 0x11, 0xbe, 0xe6, 0xa4, 0x7d, 0x09, 0x34,
-  0xe3, 0x71, 0x00, 0x58, 0x02, 0x2a, 0x30, 0xbb, 0x32, 0xa5, 0x27, 0x25,
-  0xfe, 0xa8, 0xf3, 0xc9, 0x25, 0xec, 0xe6, 0x0a, 0xd9, 0x07, 0x20, 0x1f,
-  0xb6, 0xba, 0x32, 0xf1, 0x93, 0x7f, 0xd7, 0x05, 0x19, 0xde, 0xa8, 0xea,
-  0x8a, 0xba, 0xfe, 0x66, 0xc1, 0x17, 0x8d, 0xce, 0xba, 0x1c, 0x13, 0x2a,
-  0x09, 0xb8, 0x33, 0xc0, 0x16, 0x1c, 0xe5, 0x5d, 0xee, 0x46, 0x9c, 0x00,
-  0x42, 0x9a, 0x09, 0xf8, 0x81, 0x07, 0xb5, 0xe2, 0xdc, 0xe6, 0x02, 0x07,
-  0x4b, 0x04, 0xb8, 0xe4, 0x9c, 0x0c, 0x31, 0x28, 0xd2, 0x0f, 0xfe, 0x99,
-  0x92, 0x17, 0xdc, 0x27, 0x1a, 0x0d, 0x1a, 0xbc, 0x68, 0xb6, 0x14, 0xb8,
-  0x81, 0x10, 0x13, 0x3e, 0x8b, 0x31, 0xb8, 0x2d, 0xce, 0xde, 0x81, 0xf8,
-  0xff, 0x32, 0x39, 0x03, 0xa1, 0xc0, 0xd1, 0xff, 0x22, 0x03, 0x29, 0x19,
-  0xf6, 0x28, 0x17, 0xfd, 0x50, 0xa8, 0x28, 0x00, 0xb0, 0x10, 0xcc, 0xbd,
-  0xc8, 0xee, 0x10, 0xee, 0x0b, 0xfa, 0x20, 0xdd, 0xbb, 0xe0, 0x20, 0x04,
-  0xd0, 0x25, 0xde, 0x81, 0xcc, 0xfe, 0xb4, 0xd4, 0x15, 0xe5, 0x28, 0x00,
-  0xe6, 0xf8, 0x0e, 0xae, 0xc2, 0x21, 0xc9, 0xd3, 0x92, 0xd4, 0x9a, 0xe9,
-  0xfd, 0xd2, 0x81, 0xb1, 0x21, 0xe4, 0xf8, 0xc5, 0xbd, 0x8c, 0xa9, 0x87,
-  0x9f, 0xf1, 0x14, 0xf4, 0xfb, 0x03, 0xeb, 0xfd, 0xcb, 0x97, 0xfc, 0xe4,
-  0x1e, 0xe7, 0x4b, 0x02, 0xbe, 0xef, 0xee, 0xec, 0xe2, 0x02, 0xec, 0xe2,
-  0xe3, 0xf1, 0x1a, 0xf8, 0xc1, 0xe8, 0xd6, 0x81, 0xe2, 0xf3, 0xf6, 0xf4,
-  0x27, 0x0c, 0x27, 0xea, 0x1f, 0xd4, 0x17, 0xd4, 0xdb, 0xf1, 0x21, 0xde,
-  0xe4, 0xe8, 0xf1, 0x08, 0xfb, 0x0e, 0xdf, 0xfa, 0x3c, 0x20, 0x18, 0x3f,
-  0xe4, 0x16, 0x05, 0xf2, 0x2a, 0xfd, 0xff, 0x11, 0x0b, 0x2e, 0xff, 0x01,
-  0x2f, 0x81, 0x12, 0xd2, 0xd6, 0xfa, 0x2a, 0x07, 0xdc, 0x04, 0xbc, 0xb2,
-  0x8f, 0x51, 0xb0, 0xe0, 0x49, 0x41, 0xf3, 0x7f, 0xe3, 0x1f, 0xdc, 0xc2,
-  0xa1, 0x76, 0x2f, 0x05, 0x04, 0x24, 0xef, 0x2f, 0xff, 0x8e, 0xdc, 0xc7,
-  0x05, 0x63, 0x49, 0xec, 0xbe, 0xdd, 0xb8, 0x73, 0x13, 0x0d, 0xbd, 0xbd,
-  0xd1, 0x36, 0x51, 0x44, 0xb1, 0xda, 0x0d, 0x94, 0x1f, 0x3d, 0xe4, 0xf9,
-  0x44, 0x55, 0xb8, 0x03, 0x3e, 0x81, 0xf9, 0x04, 0x9c, 0x48, 0x01, 0xfd,
-  0xbf, 0xc4, 0x25, 0x5a, 0xe2, 0x1d, 0x81, 0xf2, 0xd6, 0xfc, 0x34, 0xec,
-  0xf5, 0xd9, 0x23, 0xf8, 0x1b, 0x00, 0x19, 0x30, 0x23, 0x0a, 0xf5, 0x10,
-  0x3e, 0x86, 0xfb, 0xce, 0x97, 0x08, 0xf1, 0xe1, 0x69, 0xf3, 0xed, 0xb7,
-  0x52, 0xcb, 0x61, 0xca, 0xe8, 0xa0, 0x04, 0xe3, 0xcd, 0x1d, 0xdb, 0x81,
-  0x07, 0x08, 0xc7, 0xcc, 0x07, 0xb1, 0x3e, 0xec, 0xbd, 0x12, 0xf2, 0xe8,
-  0x7d, 0xde, 0x03, 0xc1, 0x98, 0x90, 0x29, 0xea, 0x98, 0x22, 0xf4, 0xe9,
-  0x93, 0xd1, 0x1a, 0xd2, 0xad, 0x03, 0x00, 0x0e, 0x22, 0x81, 0x5d, 0xfb,
-  0x0e, 0x03, 0x0b, 0xcc, 0xa9, 0x76, 0x3c, 0x22, 0xce, 0x01, 0xbf, 0x20,
-  0xe6, 0xc2, 0xf5, 0xfe, 0xdf, 0x16, 0x93, 0xe0, 0x56, 0xc6, 0x0c, 0xeb,
-  0xf9, 0x10, 0xcf, 0x94, 0x07, 0xf9, 0xcc, 0x3b, 0xf7, 0xc3, 0x08, 0xef,
-  0xe7, 0x81, 0x07, 0x1f, 0xbb, 0x01, 0x43, 0x0a, 0xe2, 0xef, 0x4a, 0xe7,
-  0xe7, 0xe7, 0x97, 0x07, 0xcc, 0xe1, 0x0c, 0xdc, 0xdd, 0x1d, 0x1c, 0x81,
-  0x28, 0xca, 0x18, 0xe3, 0x0f, 0x16, 0x5f, 0x02, 0x59, 0xd5, 0x3f, 0xe1,
-  0x97, 0xf4, 0x24, 0xcf, 0x36, 0xd6, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x90, 0x00, 0x00, 0xc3, 0xf1, 0xee, 0xf6, 0xc2, 0x4b, 0x2b, 0x17,
-  0xff, 0x27, 0xb9, 0x1c, 0x0f, 0xe9, 0x2f, 0xd8, 0xfa, 0x17, 0xf0, 0x1f,
-  0x00, 0xd3, 0x4c, 0x10, 0xd7, 0xde, 0xed, 0xff, 0xc2, 0xc2, 0xc8, 0xba,
-  0x0b, 0x2c, 0xdd, 0x3d, 0xe2, 0xcc, 0xc9, 0xf4, 0x0e, 0xe4, 0x04, 0xf5,
-  0xec, 0x23, 0x21, 0xfd, 0x3d, 0x0f, 0x63, 0xf3, 0x12, 0x1e, 0x3f, 0x1a,
-  0xc7, 0xd7, 0x13, 0x21, 0xf4, 0xb8, 0xed, 0x14, 0x1a, 0xfa, 0x14, 0xd1,
-  0xfe, 0x17, 0x1c, 0x00, 0xfc, 0x03, 0xe5, 0x12, 0x51, 0xdd, 0xde, 0xb1,
-  0xe5, 0x0e, 0xf1, 0x0e, 0x2d, 0xf7, 0x7f, 0x10, 0x16, 0xdd, 0xfd, 0xfc,
-  0xe6, 0xa4, 0x29, 0xf7, 0x09, 0xff, 0xc3, 0x35, 0xe0, 0x1a, 0xe4, 0x1b,
-  0x04, 0x07, 0x06, 0x07, 0xeb, 0x1d, 0x14, 0x20, 0x2c, 0xde, 0x57, 0x02,
-  0xe7, 0x4f, 0x3c, 0x0f, 0x09, 0xef, 0xec, 0xfe, 0xf2, 0xa5, 0xfc, 0xef,
-  0x1d, 0xfe, 0x17, 0xfb, 0xd2, 0xe1, 0x35, 0x07, 0x06, 0xec, 0x10, 0xe3,
-  0x72, 0xe3, 0xd9, 0xc7, 0xdf, 0xef, 0xe1, 0xb9, 0x2d, 0x39, 0x30, 0x0d,
-  0x32, 0xfd, 0xf5, 0xe0, 0xe6, 0xd7, 0xfb, 0x0d, 0x31, 0xe2, 0x1c, 0x4f,
-  0xfb, 0xd2, 0xcc, 0xe7, 0xd3, 0xe1, 0x1e, 0xfc, 0x19, 0x25, 0x2d, 0xf9,
-  0x13, 0xe3, 0x1e, 0xec, 0x1d, 0x1f, 0xc7, 0xfc, 0x0d, 0x08, 0xf8, 0xdd,
-  0xca, 0xcd, 0x2c, 0x15, 0xcf, 0xfb, 0x2f, 0xc6, 0xcb, 0x37, 0x45, 0x34,
-  0xcc, 0x29, 0xf6, 0x24, 0xf7, 0xe5, 0x1f, 0xe6, 0x03, 0x0f, 0xd4, 0x17,
-  0x0f, 0x08, 0xf0, 0x3e, 0xb6, 0xfc, 0xb2, 0x01, 0xf5, 0xf7, 0xdb, 0xca,
-  0xee, 0x0e, 0x0f, 0xfc, 0xeb, 0xec, 0xdb, 0x18, 0x07, 0xfe, 0xe0, 0xf9,
-  0x21, 0x09, 0x26, 0x2e, 0x4f, 0xfc, 0xc3, 0x13, 0x09, 0x1d, 0x60, 0x16,
-  0xda, 0xff, 0xd3, 0x13, 0xfd, 0x0c, 0x00, 0xfc, 0xed, 0xcf, 0x02, 0xbc,
-  0xe7, 0x2e, 0x2e, 0xfb, 0xcf, 0xf1, 0xf8, 0x1a, 0x07, 0xe5, 0x0c, 0x07,
-  0xeb, 0x24, 0xeb, 0xfb, 0x21, 0xf2, 0x13, 0x05, 0x09, 0xea, 0xfe, 0xfd,
-  0xec, 0xef, 0x07, 0x06, 0x0d, 0xf3, 0xc3, 0x25, 0xd8, 0x1d, 0xe2, 0x07,
-  0xfb, 0x1d, 0xec, 0x19, 0xeb, 0xf9, 0xef, 0x16, 0x1b, 0xf9, 0xe0, 0x01,
-  0x18, 0x01, 0x32, 0xf8, 0xd6, 0x03, 0xe5, 0x24, 0x05, 0x05, 0xdf, 0x05,
-  0xc4, 0xd6, 0x11, 0xe0, 0xf8, 0x2c, 0x02, 0xef, 0x02, 0x08, 0x05, 0x1a,
-  0x6f, 0xec, 0xfb, 0xd0, 0xf2, 0xbf, 0xd4, 0xf5, 0xbc, 0x19, 0x2b, 0xe4,
-  0x06, 0xd1, 0x06, 0x2e, 0x0a, 0x37, 0xe0, 0x13, 0xfa, 0xea, 0xfd, 0x2f,
-  0xf9, 0x1e, 0x16, 0xe4, 0xe8, 0x32, 0x28, 0x17, 0xf5, 0xf8, 0xed, 0xfa,
-  0x17, 0xf1, 0x02, 0x03, 0x2d, 0xba, 0x04, 0xed, 0xdd, 0x2b, 0x07, 0x2a,
-  0xf4, 0xde, 0x0d, 0xde, 0xeb, 0x01, 0xf4, 0x37, 0xfe, 0xf4, 0x47, 0x1c,
-  0xed, 0xef, 0xf5, 0xdc, 0xc5, 0x0d, 0xea, 0x07, 0xff, 0x37, 0xec, 0xf8,
-  0x3a, 0x54, 0xa7, 0x2d, 0x0f, 0x23, 0xeb, 0x69, 0xd0, 0xf1, 0xfd, 0xf8,
-  0xe7, 0x0b, 0x1e, 0xf5, 0x01, 0x1b, 0xa6, 0x1d, 0xe4, 0xec, 0x10, 0x34,
-  0x40, 0x03, 0xe5, 0x28, 0xef, 0x0d, 0xf2, 0x3c, 0x0d, 0xf6, 0x2b, 0x03,
-  0xf3, 0x2a, 0xde, 0xef, 0x07, 0xfb, 0xb2, 0xe7, 0x09, 0xd4, 0x03, 0x03,
-  0xd1, 0xde, 0x12, 0xd1, 0xed, 0xcc, 0x08, 0xd9, 0xf7, 0x30, 0x0f, 0x3f,
-  0xfd, 0x1d, 0xf6, 0xc9, 0xfd, 0x16, 0xe2, 0x09, 0xf2, 0x08, 0x06, 0x2e,
-  0xb8, 0xf8, 0x07, 0x21, 0x01, 0xd0, 0xec, 0xe6, 0x22, 0xf9, 0xe4, 0x3c,
-  0xcf, 0xf5, 0x1e, 0xdb, 0x29, 0x03, 0xf9, 0x1e, 0xea, 0x01, 0xf0, 0x05,
-  0xd7, 0xbd, 0x29, 0x00, 0xc8, 0x13, 0xf3, 0xfa, 0x00, 0x06, 0x02, 0xc5,
-  0xed, 0xe4, 0xf2, 0xf0, 0xbb, 0x22, 0xc8, 0xdc, 0xff, 0x31, 0x0c, 0x02,
-  0x0f, 0x7c, 0x25, 0x6a, 0xfb, 0x04, 0xf1, 0x14, 0xce, 0xce, 0x22, 0x0e,
-  0xe9, 0x0a, 0xf1, 0x1f, 0xd8, 0x07, 0x06, 0x35, 0xfd, 0x14, 0xca, 0xdf,
-  0x7a, 0x25, 0x1f, 0x27, 0x3f, 0x29, 0xff, 0xbe, 0xda, 0xe4, 0xda, 0xdb,
-  0xfb, 0xee, 0xe6, 0xef, 0xcf, 0xa7, 0x35, 0xe6, 0xea, 0x17, 0xe7, 0xef,
-  0x42, 0x12, 0x56, 0xc3, 0xa6, 0x06, 0x15, 0x12, 0x13, 0xd8, 0xe7, 0x15,
-  0x3a, 0xc8, 0x20, 0xf0, 0xce, 0x19, 0xc5, 0x09, 0xf1, 0x05, 0x52, 0xf1,
-  0xd4, 0x36, 0x19, 0x05, 0xee, 0xf9, 0x66, 0xee, 0xf2, 0x23, 0x43, 0x1b,
-  0xdc, 0xdb, 0xf9, 0xe5, 0xfb, 0xec, 0xc4, 0x3d, 0x29, 0x14, 0xd1, 0xd7,
-  0xc8, 0x02, 0xe5, 0xff, 0xe7, 0xd3, 0xab, 0xde, 0xcf, 0xec, 0x21, 0xc7,
-  0x07, 0xed, 0xe6, 0x0c, 0x30, 0x1e, 0x08, 0xfa, 0x08, 0x4c, 0x3e, 0x0b,
-  0xf3, 0xcc, 0xe5, 0xf2, 0x28, 0x03, 0xb4, 0xeb, 0xdc, 0xf7, 0xea, 0xfe,
-  0x33, 0x22, 0x1c, 0x1a, 0x1e, 0xff, 0x18, 0x24, 0x0d, 0x24, 0xde, 0xc3,
-  0x1a, 0x2d, 0x07, 0x13, 0xfe, 0x27, 0xb8, 0xdd, 0x11, 0x24, 0xd9, 0x1d,
-  0x4e, 0xf8, 0xf1, 0x0e, 0xff, 0xfe, 0xf8, 0xd6, 0x03, 0xee, 0xc2, 0x41,
-  0x1f, 0xe6, 0xca, 0xe2, 0xe6, 0x07, 0xfb, 0xf0, 0xd9, 0x21, 0xeb, 0xf8,
-  0x22, 0x08, 0x41, 0xd0, 0xc2, 0x9c, 0x01, 0xd9, 0x01, 0xee, 0xd9, 0x25,
-  0x02, 0x08, 0xdf, 0xf4, 0x39, 0x32, 0x18, 0xd5, 0x2b, 0x15, 0x23, 0x06,
-  0x24, 0x42, 0xa4, 0xf3, 0x31, 0xdf, 0x36, 0xb5, 0xfb, 0x18, 0xf3, 0xdd,
-  0x03, 0xf4, 0xd4, 0x29, 0x05, 0xf9, 0x1a, 0x0a, 0xdf, 0xce, 0x1d, 0xf2,
-  0xfc, 0x03, 0xc8, 0x2d, 0x2e, 0xf8, 0xc4, 0x0e, 0xee, 0x05, 0x04, 0x0b,
-  0x01, 0xd4, 0xdc, 0xfb, 0xd4, 0x17, 0xe5, 0xee, 0x37, 0x32, 0x34, 0x22,
-  0x0f, 0x01, 0xfc, 0xf1, 0x24, 0x06, 0xe7, 0x2b, 0xee, 0xc9, 0x4a, 0x1e,
-  0xd5, 0xe9, 0x0d, 0x13, 0xf6, 0xd5, 0x55, 0x36, 0xd3, 0x45, 0x52, 0xdc,
-  0x24, 0x05, 0xdc, 0x23, 0x21, 0xfd, 0x07, 0x0f, 0xe7, 0xc6, 0xd0, 0xe0,
-  0xf1, 0xea, 0xea, 0xc5, 0x0f, 0x0d, 0xde, 0x23, 0xe1, 0x28, 0x36, 0xdf,
-  0xeb, 0x06, 0xfe, 0xe8, 0xe8, 0xf0, 0x0b, 0xff, 0xfa, 0x26, 0xc3, 0xef,
-  0x2f, 0xf1, 0x0c, 0x13, 0xfb, 0x25, 0xef, 0xc6, 0xff, 0x1d, 0x35, 0xef,
-  0x31, 0x05, 0x3a, 0x3f, 0xf7, 0xe9, 0x02, 0x30, 0xe1, 0xf0, 0xea, 0x22,
-  0xfa, 0x61, 0x1e, 0xe5, 0x1e, 0x19, 0xd9, 0x02, 0x1b, 0x00, 0xe0, 0x0a,
-  0x02, 0xe6, 0xb1, 0x0d, 0x0b, 0xfe, 0xba, 0xad, 0xf1, 0xf8, 0x3c, 0x2f,
-  0x27, 0xe7, 0xf4, 0xf5, 0xb7, 0xe8, 0x0f, 0xe8, 0x00, 0xec, 0xe9, 0x14,
-  0xee, 0x0a, 0x20, 0xe7, 0x16, 0xdb, 0x01, 0xfc, 0xc5, 0xba, 0x1c, 0x23,
-  0x13, 0x2e, 0x15, 0x14, 0x58, 0xf7, 0x0e, 0x38, 0xd4, 0x25, 0x18, 0x1a,
-  0x10, 0xf1, 0xbd, 0x0a, 0x0e, 0x1e, 0x68, 0x64, 0xf4, 0xdb, 0xfe, 0xcb,
-  0xe9, 0x02, 0xd5, 0x14, 0xb3, 0x11, 0xc1, 0x01, 0x07, 0xad, 0xe5, 0x16,
-  0x1d, 0x31, 0xe0, 0xf3, 0x1b, 0xf0, 0xca, 0x17, 0xbb, 0x30, 0xf9, 0xed,
-  0xdb, 0x0c, 0xe7, 0x32, 0xbf, 0xb7, 0xb6, 0xe6, 0x2e, 0xfb, 0x5a, 0x1a,
-  0x00, 0x18, 0xf7, 0xc1, 0x22, 0xc8, 0xeb, 0x03, 0xda, 0xcc, 0x7f, 0x1d,
-  0x03, 0xee, 0x0f, 0xe7, 0x35, 0xe8, 0x28, 0x5c, 0xd3, 0x29, 0xe0, 0xe8,
-  0x11, 0xec, 0xe3, 0xea, 0x26, 0x0f, 0x70, 0x1e, 0x02, 0xa7, 0xfd, 0xf2,
-  0xc1, 0x27, 0x13, 0x1d, 0xf8, 0xfe, 0x15, 0x43, 0xeb, 0xff, 0x00, 0x20,
-  0x0f, 0xa0, 0xf4, 0xee, 0x99, 0xa3, 0xc5, 0xee, 0xfc, 0x09, 0xdd, 0x13,
-  0x38, 0xed, 0x39, 0x30, 0xef, 0x1c, 0xf9, 0xd3, 0x11, 0xc9, 0xf0, 0xfb,
-  0x3d, 0xd7, 0x59, 0x47, 0xfd, 0x0f, 0x13, 0xed, 0x19, 0x10, 0x08, 0x1f,
-  0x11, 0xf6, 0xcf, 0xf8, 0xff, 0x13, 0x0a, 0xd5, 0x22, 0x2b, 0xd8, 0x04,
-  0x0e, 0xc9, 0xbf, 0xb5, 0x11, 0x10, 0xd8, 0xfc, 0x3c, 0xf3, 0x0d, 0x30,
-  0x63, 0xe9, 0xde, 0x2d, 0xde, 0x99, 0x23, 0xac, 0x1b, 0xf5, 0xf5, 0x22,
-  0x1c, 0x10, 0x3e, 0xff, 0xe1, 0xf3, 0x33, 0x14, 0x20, 0xcc, 0xe9, 0xff,
-  0xec, 0x1b, 0x17, 0x23, 0x0e, 0xdc, 0x22, 0x12, 0x06, 0x27, 0x04, 0x41,
-  0x3e, 0x1d, 0xec, 0xe8, 0x13, 0xc1, 0x2c, 0x3c, 0xf0, 0xf1, 0xe0, 0xe0,
-  0x2d, 0xbc, 0xbf, 0x25, 0xb9, 0x3a, 0xea, 0xbc, 0x0a, 0xcf, 0xe6, 0x15,
-  0x07, 0x00, 0xce, 0xda, 0xff, 0xef, 0x38, 0x4a, 0xee, 0xda, 0xfb, 0xf9,
-  0xd0, 0x00, 0x14, 0x2f, 0xfd, 0x01, 0xc8, 0x48, 0x03, 0xed, 0xfa, 0xed,
-  0xe7, 0x0a, 0x1b, 0xe3, 0x18, 0x01, 0x26, 0x19, 0x21, 0x23, 0xe4, 0xfd,
-  0x0b, 0xb4, 0x38, 0xe0, 0x19, 0xfe, 0xd2, 0xfa, 0xe6, 0x03, 0xcd, 0xd3,
-  0x11, 0x23, 0xfe, 0xe4, 0xe9, 0xda, 0xda, 0xbf, 0xf2, 0x4c, 0x3a, 0xd0,
-  0x0d, 0x2a, 0x0d, 0x3f, 0x41, 0x06, 0x0c, 0xfa, 0x08, 0x2f, 0xf6, 0xff,
-  0x25, 0xc9, 0xf0, 0xe6, 0xcb, 0xfe, 0xfe, 0x7f, 0xeb, 0x01, 0xee, 0x23,
-  0x19, 0xe9, 0xff, 0xd8, 0x0d, 0x0b, 0xec, 0xed, 0xfd, 0x2c, 0x3a, 0x09,
-  0x3e, 0x2b, 0xe2, 0xfa, 0x05, 0x0f, 0x2c, 0x07, 0x15, 0x26, 0xed, 0x01,
-  0xe6, 0xdd, 0xcf, 0x10, 0x05, 0x2e, 0xe2, 0xdf, 0xf3, 0xef, 0xe4, 0x14,
-  0x1a, 0x29, 0x24, 0x01, 0xf8, 0x4b, 0xf5, 0x00, 0x08, 0x3a, 0x00, 0x1f,
-  0x08, 0xea, 0x0e, 0x19, 0x1c, 0x0a, 0xe6, 0x08, 0x10, 0xfb, 0xd5, 0x6d,
-  0xd1, 0xfd, 0xec, 0x34, 0xb5, 0x10, 0xc1, 0xda, 0x17, 0xf4, 0x13, 0xf8,
-  0x2c, 0x27, 0x38, 0x65, 0x5e, 0x2c, 0xe1, 0xe2, 0xf6, 0xf9, 0xf5, 0x00,
-  0xf2, 0x42, 0xea, 0x14, 0xf4, 0xc6, 0xd1, 0x10, 0x1d, 0x17, 0xe4, 0x03,
-  0x08, 0xd0, 0xff, 0xd6, 0x11, 0x14, 0x2c, 0xd9, 0xde, 0xff, 0xc4, 0x25,
-  0x18, 0x19, 0xdb, 0xef, 0x2a, 0xec, 0x04, 0xdf, 0x0d, 0xf7, 0x0b, 0xdf,
-  0xee, 0xf1, 0x37, 0x5b, 0xdf, 0x21, 0x14, 0x12, 0xbf, 0x21, 0xc3, 0xf8,
-  0x14, 0xd3, 0xd8, 0xcd, 0x33, 0x09, 0x3a, 0xef, 0x48, 0x30, 0xf5, 0xf5,
-  0x14, 0xba, 0x1c, 0xe5, 0x02, 0x1c, 0xdf, 0xf2, 0xfb, 0xbd, 0xe5, 0x0e,
-  0xed, 0x3a, 0x25, 0x19, 0xb2, 0xec, 0xe5, 0xe8, 0xef, 0xfe, 0xfb, 0xdc,
-  0x04, 0xee, 0x38, 0x2a, 0x2e, 0xfa, 0xd0, 0x17, 0xd3, 0xfe, 0x2c, 0xf9,
-  0x1e, 0x01, 0xf9, 0x2c, 0xfa, 0x01, 0x1b, 0x10, 0xe3, 0x0a, 0x08, 0xc7,
-  0xd5, 0x2c, 0xde, 0xf7, 0x17, 0xc2, 0xd6, 0xf0, 0xde, 0x26, 0x2d, 0xc5,
-  0x5c, 0x0c, 0x0c, 0xd4, 0x01, 0x06, 0x51, 0xf3, 0x0a, 0x36, 0xea, 0xe4,
-  0xd1, 0xcc, 0x08, 0xc4, 0x04, 0x01, 0xd5, 0x55, 0xdc, 0xfe, 0xe3, 0x27,
-  0xf3, 0xf8, 0x02, 0xe7, 0x0b, 0x0e, 0x13, 0xfc, 0x0b, 0x30, 0xe9, 0x33,
-  0xea, 0x10, 0x2f, 0x0f, 0xd9, 0x06, 0xf4, 0x01, 0xff, 0xec, 0x02, 0xfe,
-  0x11, 0x06, 0xe3, 0xef, 0xd6, 0x3b, 0xe5, 0xca, 0x0e, 0xfb, 0xf6, 0xfe,
-  0xf3, 0x12, 0x2b, 0x1f, 0x5d, 0x04, 0xfb, 0xe1, 0xea, 0xd5, 0x29, 0xf9,
-  0xe3, 0x39, 0x01, 0x2c, 0xe4, 0xb3, 0xdf, 0x07, 0xd9, 0x31, 0x0e, 0x13,
-  0xe5, 0x03, 0x0f, 0x14, 0x13, 0x22, 0x02, 0xac, 0xeb, 0xe1, 0xfa, 0x0d,
-  0xf1, 0x16, 0xf2, 0x06, 0xfa, 0x1c, 0x0b, 0x02, 0x01, 0xe4, 0x1e, 0xf0,
-  0xfd, 0xd0, 0x08, 0x0b, 0xd0, 0x27, 0xfd, 0xf0, 0xe9, 0x07, 0x05, 0xf5,
-  0x20, 0xe8, 0xf3, 0xe4, 0xff, 0x34, 0xf7, 0xf4, 0xfb, 0x21, 0x13, 0x03,
-  0x12, 0xdf, 0x00, 0xf7, 0x16, 0x23, 0xe0, 0x0c, 0xc6, 0xa6, 0xf1, 0x31,
-  0xe9, 0x0e, 0xc6, 0x0d, 0x12, 0xe5, 0xf3, 0xef, 0x12, 0x0b, 0x12, 0x09,
-  0x5d, 0xe1, 0xf5, 0x0f, 0xfb, 0xed, 0xf6, 0x14, 0x34, 0xf2, 0xf5, 0xd7,
-  0x30, 0x0b, 0xfe, 0xf4, 0x05, 0xe9, 0x19, 0xfa, 0xda, 0x03, 0xf6, 0xeb,
-  0xd8, 0x1e, 0xfe, 0xf4, 0x1b, 0xd7, 0xc3, 0x12, 0xe8, 0x27, 0x3f, 0xd1,
-  0xfa, 0x1e, 0x1e, 0xff, 0xef, 0x02, 0x20, 0xf7, 0x16, 0xe1, 0xe1, 0xd9,
-  0xbb, 0xc4, 0xd7, 0xd6, 0xf6, 0xe3, 0xdf, 0x39, 0x01, 0x16, 0xef, 0x19,
-  0xf2, 0xeb, 0x1a, 0x1f, 0x2c, 0x04, 0xf5, 0x0c, 0x30, 0x13, 0x23, 0xf5,
-  0x2d, 0x05, 0x0a, 0xf5, 0x09, 0x00, 0xfa, 0xf0, 0x09, 0x0a, 0x14, 0x23,
-  0x1b, 0xfc, 0xf9, 0x05, 0x08, 0x02, 0xd3, 0xe0, 0x02, 0xf6, 0xe2, 0x09,
-  0x08, 0x18, 0xe1, 0xef, 0x27, 0x27, 0x09, 0xac, 0xfa, 0xf2, 0x08, 0xe2,
-  0xef, 0xf3, 0x22, 0x0f, 0xb9, 0xcb, 0xe1, 0xee, 0xe5, 0x23, 0xd4, 0xe8,
-  0x2b, 0xd3, 0x1f, 0xf0, 0xd9, 0x08, 0x0d, 0x4c, 0xfe, 0x03, 0xf9, 0x13,
-  0xf1, 0x0e, 0x39, 0xf0, 0xfd, 0x16, 0x3c, 0x0a, 0x1f, 0xe6, 0x27, 0xf3,
-  0xf3, 0xf7, 0x49, 0xd7, 0x77, 0x22, 0x21, 0x1f, 0x79, 0x02, 0xdf, 0x56,
-  0xe4, 0x0a, 0x00, 0x27, 0xff, 0x11, 0xd3, 0x26, 0x09, 0xf6, 0x19, 0xf4,
-  0xe6, 0x1b, 0xbb, 0x1c, 0xb2, 0x19, 0x4f, 0x15, 0x01, 0xed, 0x17, 0xda,
-  0xd4, 0xc0, 0x55, 0xf4, 0xaa, 0x48, 0x16, 0xae, 0x24, 0xf8, 0xd1, 0x95,
-  0xac, 0xfe, 0xd2, 0xff, 0xdb, 0xf2, 0xef, 0x49, 0xec, 0xca, 0x63, 0x03,
-  0xe9, 0x11, 0x28, 0xe3, 0x23, 0xc6, 0x2f, 0x10, 0x61, 0xe8, 0x24, 0x2f,
-  0x47, 0xc5, 0xec, 0x0f, 0xf6, 0xe7, 0x09, 0xf6, 0x07, 0xe9, 0xc9, 0x2c,
-  0xd5, 0x21, 0x3d, 0x46, 0xeb, 0x39, 0xf4, 0x2a, 0xf3, 0x2e, 0xe9, 0xfa,
-  0xe8, 0x06, 0x45, 0x3b, 0xd3, 0xfa, 0x13, 0x24, 0x8f, 0x1e, 0x36, 0xd7,
-  0x00, 0xf9, 0x0f, 0xcc, 0xcf, 0xf2, 0xf6, 0xbd, 0xee, 0xe5, 0x2d, 0xdf,
-  0x81, 0x09, 0x3b, 0x0a, 0xb0, 0xe9, 0x0c, 0xe0, 0x0f, 0x1b, 0xf3, 0xf9,
-  0x5b, 0xab, 0xef, 0xda, 0x4e, 0xf6, 0x17, 0x07, 0xe9, 0xc5, 0x02, 0xd2,
-  0x0b, 0xfb, 0xc7, 0x27, 0xe0, 0x1f, 0x14, 0x2a, 0xa0, 0x40, 0xff, 0x10,
-  0x57, 0x0e, 0xed, 0x01, 0xe2, 0x19, 0x22, 0x2c, 0x0a, 0xfd, 0xe3, 0xdf,
-  0x38, 0xc7, 0x2e, 0x1d, 0xc2, 0x30, 0xf8, 0x29, 0xe8, 0xc1, 0x01, 0xc7,
-  0xb6, 0x21, 0x40, 0xfb, 0xe5, 0x21, 0x13, 0x2a, 0xee, 0x3d, 0xdd, 0xff,
-  0xfa, 0xee, 0x01, 0x05, 0x3b, 0x0a, 0xf6, 0xe8, 0x2f, 0x27, 0xe2, 0x1e,
-  0x41, 0x0d, 0x15, 0x56, 0xf1, 0x02, 0x09, 0xc8, 0x42, 0x89, 0xb0, 0xfd,
-  0xde, 0xd5, 0x20, 0x1e, 0xee, 0xe6, 0xbd, 0xa7, 0xe9, 0xc1, 0xde, 0xa2,
-  0xdc, 0x83, 0x39, 0x0b, 0x03, 0xa3, 0xc0, 0xff, 0xd6, 0xca, 0xd3, 0x61,
-  0x8f, 0x32, 0x0a, 0xa6, 0x0c, 0xed, 0xd7, 0x2c, 0x46, 0xfa, 0xc1, 0x45,
-  0x13, 0xc5, 0x2c, 0x03, 0xc5, 0xdc, 0x1e, 0x1e, 0x03, 0x05, 0x00, 0xef,
-  0x0c, 0x20, 0x69, 0xcc, 0x52, 0x0f, 0x0a, 0x5e, 0x01, 0xd1, 0x25, 0xeb,
-  0x57, 0xeb, 0xe5, 0x19, 0x23, 0x1f, 0xe4, 0xee, 0xe9, 0x29, 0xcd, 0xf5,
-  0xfc, 0xfd, 0x0e, 0x43, 0xe8, 0x0f, 0xf7, 0x15, 0xc9, 0xc7, 0xd0, 0x12,
-  0x9a, 0xa8, 0xa9, 0x40, 0xe0, 0xf8, 0x0d, 0xee, 0x3d, 0x35, 0xda, 0x0c,
-  0x4e, 0xb9, 0xc2, 0x21, 0xad, 0xbe, 0xe1, 0xf9, 0xf4, 0xea, 0x9e, 0x0e,
-  0x9d, 0x9b, 0x19, 0x94, 0x19, 0x0f, 0x27, 0xb5, 0xe5, 0xde, 0x49, 0x3f,
-  0xfb, 0xf5, 0x24, 0x31, 0x52, 0x34, 0x48, 0xc4, 0xef, 0xf9, 0x1b, 0x02,
-  0xd1, 0xe8, 0xa1, 0x0c, 0xdb, 0xe8, 0x1b, 0x41, 0xc0, 0x04, 0x94, 0x10,
-  0xf2, 0xee, 0x2d, 0x5b, 0xb6, 0xe8, 0xc9, 0x22, 0xce, 0xb3, 0xf6, 0x30,
-  0xd9, 0x3c, 0xae, 0x0d, 0x11, 0x15, 0x9f, 0xfc, 0xe8, 0xe6, 0xda, 0xe1,
-  0x42, 0x30, 0xf5, 0x0f, 0x31, 0x30, 0x29, 0xfa, 0x9b, 0x36, 0x2a, 0x21,
-  0x37, 0x26, 0xd7, 0x71, 0x3a, 0x14, 0x2b, 0xcc, 0xdd, 0xc0, 0xf2, 0x51,
-  0xe6, 0xd4, 0x3e, 0x2f, 0xc4, 0xf6, 0x9f, 0xcd, 0xda, 0xe0, 0xed, 0xcc,
-  0x5a, 0x05, 0x43, 0xcf, 0x19, 0xdb, 0xd3, 0x24, 0x34, 0xbf, 0xfd, 0x41,
-  0xd9, 0x4a, 0xb8, 0xbf, 0x2a, 0x1c, 0xc9, 0x10, 0x2c, 0x1b, 0xf9, 0x58,
-  0x2e, 0xd1, 0xc4, 0x47, 0xad, 0x3e, 0x1b, 0x06, 0x00, 0x62, 0xed, 0xde,
-  0xb1, 0xdd, 0x2c, 0xd7, 0x31, 0x35, 0xc0, 0x50, 0x1b, 0x2e, 0x1e, 0xf3,
-  0xf5, 0xe4, 0xb5, 0x3d, 0x1f, 0xbf, 0x2a, 0xfb, 0xc1, 0x34, 0xfd, 0x0e,
-  0xd6, 0xf9, 0xf3, 0x0d, 0x26, 0x0c, 0x0b, 0xf0, 0x20, 0x2f, 0xce, 0x4e,
-  0x0b, 0xcb, 0x4d, 0x1e, 0xf2, 0x39, 0xe9, 0x11, 0xf1, 0xfe, 0xf8, 0x0f,
-  0x49, 0x16, 0xf9, 0x1f, 0x0c, 0x16, 0xdc, 0x3c, 0xca, 0x3e, 0x0c, 0xec,
-  0x86, 0xfb, 0xe5, 0xe5, 0x0e, 0xd1, 0x21, 0xed, 0x0a, 0xdd, 0xfd, 0xd7,
-  0xf3, 0x3c, 0x0f, 0x23, 0xf5, 0x00, 0x55, 0x15, 0xfe, 0xe6, 0xfd, 0x0e,
-  0xd0, 0x39, 0xd2, 0xeb, 0xf1, 0xe8, 0x1e, 0x06, 0xc0, 0x0e, 0xe8, 0x0d,
-  0xfd, 0xf9, 0xb4, 0x7c, 0x05, 0x01, 0x5f, 0xa1, 0x10, 0x28, 0x08, 0xe4,
-  0xf2, 0xd8, 0xd7, 0x4d, 0xea, 0x1d, 0xc0, 0x1d, 0x04, 0x1a, 0xfe, 0x36,
-  0xee, 0x16, 0x01, 0xeb, 0xfa, 0xea, 0xe9, 0xe9, 0xc9, 0x21, 0xe1, 0x02,
-  0x26, 0xa0, 0x0e, 0xe6, 0xef, 0x08, 0x4d, 0x38, 0x7c, 0x67, 0xf7, 0xdd,
-  0xfa, 0xdf, 0x18, 0x04, 0xd4, 0xe6, 0x38, 0xc3, 0x11, 0x2e, 0xd6, 0x9a,
-  0xdf, 0x1c, 0x79, 0x17, 0x2a, 0xd2, 0xc9, 0xd8, 0x1e, 0x5b, 0xf8, 0xd8,
-  0xdd, 0x11, 0xcd, 0x01, 0xee, 0xdd, 0xf7, 0x0b, 0xf2, 0x29, 0xec, 0x0a,
-  0x03, 0x23, 0xee, 0x4f, 0x37, 0x17, 0xd9, 0x1d, 0x3c, 0xd5, 0x22, 0xea,
-  0xc5, 0xfd, 0xde, 0xfb, 0x1e, 0xb2, 0xd6, 0x31, 0x05, 0xd2, 0x2d, 0x39,
-  0x47, 0x28, 0x0a, 0x1e, 0x00, 0xfc, 0x03, 0x1f, 0xa6, 0xf8, 0xc7, 0x0c,
-  0x27, 0x0f, 0xbb, 0x9d, 0x0a, 0xc6, 0xed, 0xff, 0xd4, 0xb9, 0xc8, 0xed,
-  0xda, 0x1b, 0xfc, 0xba, 0xfa, 0x11, 0x31, 0x11, 0xda, 0xd9, 0x93, 0xf0,
-  0xfc, 0x0e, 0x09, 0x14, 0xe2, 0xe6, 0x05, 0x23, 0x0f, 0xe2, 0x20, 0x0e,
-  0xfa, 0xcd, 0x00, 0x13, 0x06, 0xdc, 0xeb, 0x00, 0xf6, 0xf0, 0xf9, 0x1b,
-  0x01, 0x1d, 0x1b, 0x05, 0x0d, 0x12, 0x0d, 0x00, 0x13, 0x00, 0x31, 0x30,
-  0xa3, 0x02, 0xe0, 0x0c, 0xc9, 0xe7, 0xf2, 0xf0, 0x43, 0x07, 0xe2, 0x25,
-  0xf0, 0xd3, 0xe7, 0x42, 0x09, 0xe4, 0xf9, 0xca, 0x19, 0x3a, 0xfa, 0xba,
-  0xc2, 0xf2, 0xd8, 0xd4, 0xe3, 0xe8, 0xe5, 0xf1, 0x08, 0x03, 0x23, 0xfb,
-  0x51, 0x18, 0x19, 0x30, 0x09, 0xff, 0xea, 0xd3, 0xf6, 0xf8, 0xf9, 0xef,
-  0x2e, 0x00, 0xa1, 0xe1, 0x17, 0x05, 0x3f, 0x2b, 0x06, 0x41, 0x0c, 0xeb,
-  0x07, 0xea, 0x09, 0x2e, 0xd8, 0x22, 0xf0, 0x02, 0xfa, 0xfa, 0xd0, 0xbf,
-  0x04, 0xe1, 0x42, 0x23, 0xcd, 0xf7, 0x0b, 0xb5, 0x26, 0x67, 0xd6, 0x06,
-  0xdc, 0x3e, 0x88, 0x0e, 0x56, 0xb7, 0xfe, 0xf6, 0x01, 0x29, 0xde, 0xfb,
-  0xfe, 0xca, 0x27, 0xf8, 0xee, 0xdb, 0xf2, 0x10, 0x0b, 0x97, 0x39, 0xcc,
-  0x2c, 0xe0, 0x38, 0xc5, 0xef, 0xbe, 0xa2, 0x2a, 0xe3, 0x1c, 0x40, 0x0a,
-  0xb3, 0x34, 0xfa, 0xe3, 0xf4, 0xfb, 0xdc, 0x0b, 0xec, 0x10, 0xfe, 0xda,
-  0xfb, 0x0d, 0x08, 0xca, 0x07, 0xd5, 0x2d, 0xe1, 0xa6, 0x08, 0xdb, 0xd5,
-  0xed, 0x3a, 0xe6, 0xf6, 0x07, 0x07, 0xde, 0x30, 0x1f, 0xfe, 0xd5, 0xfb,
-  0x2e, 0x51, 0x05, 0x09, 0xe6, 0xce, 0x08, 0x0e, 0xb0, 0x81, 0x3e, 0x2e,
-  0x3f, 0xc4, 0xd0, 0xeb, 0x14, 0xbf, 0xfb, 0x25, 0xe3, 0xef, 0xc2, 0x14,
-  0xb7, 0x31, 0x06, 0xe6, 0xf8, 0x24, 0x18, 0x2a, 0xf4, 0xd4, 0xcf, 0x46,
-  0xd7, 0xe6, 0xdd, 0x23, 0xcc, 0xe5, 0xcb, 0x02, 0x06, 0x14, 0x14, 0xf3,
-  0xe5, 0xf6, 0xdd, 0xf8, 0x03, 0x3f, 0xfb, 0xb2, 0xe4, 0xf3, 0xcf, 0xe5,
-  0xd4, 0x1e, 0x31, 0xdb, 0xc7, 0x31, 0x03, 0xe2, 0xbe, 0xf6, 0x0d, 0xec,
-  0xd4, 0xc2, 0x11, 0x07, 0xda, 0x37, 0xb3, 0x64, 0x30, 0xe6, 0xbd, 0x42,
-  0xd1, 0x26, 0x11, 0xd5, 0x3d, 0xde, 0x16, 0x55, 0xff, 0x07, 0x02, 0x0b,
-  0x04, 0xf6, 0x1b, 0x24, 0x3c, 0x50, 0xe9, 0x34, 0xf0, 0xee, 0xf5, 0xe4,
-  0xf2, 0xe4, 0x02, 0x3b, 0x3d, 0x24, 0x11, 0xee, 0xdb, 0x2b, 0xdd, 0x2e,
-  0xd8, 0x28, 0xb3, 0x22, 0x28, 0x0d, 0x11, 0xcc, 0xfe, 0x89, 0xe0, 0xd6,
-  0x3e, 0xcd, 0xfa, 0xdc, 0x03, 0xe1, 0xec, 0xf5, 0xcb, 0xaa, 0xe9, 0x15,
-  0x45, 0xf3, 0x15, 0x24, 0xdf, 0x1e, 0x07, 0xee, 0x08, 0xe8, 0x08, 0x3a,
-  0xef, 0xe9, 0x28, 0xa4, 0xfa, 0xeb, 0x1c, 0xfa, 0x4f, 0xe6, 0x3c, 0x00,
-  0x3e, 0xf0, 0x48, 0xe0, 0x26, 0x37, 0x1d, 0xe3, 0x12, 0xf8, 0x03, 0x0e,
-  0xf1, 0x27, 0xca, 0xf5, 0xf1, 0xd5, 0xbb, 0xef, 0x22, 0x23, 0x19, 0xf4,
-  0xec, 0xdf, 0xdc, 0xe5, 0x4b, 0x16, 0xd9, 0xc3, 0xf0, 0xd6, 0xf7, 0xf5,
-  0xfc, 0x1b, 0xf7, 0xed, 0x43, 0xfa, 0x11, 0x44, 0xe2, 0x14, 0x1a, 0x0d,
-  0xfe, 0x20, 0xf3, 0x2e, 0x28, 0xf4, 0x2e, 0xde, 0xea, 0xfb, 0xe3, 0x2a,
-  0x1c, 0x08, 0xe6, 0xfa, 0x25, 0x1b, 0x19, 0x24, 0x08, 0x26, 0xfc, 0xf3,
-  0x36, 0x15, 0x14, 0x1f, 0xee, 0x19, 0x06, 0xc7, 0xaf, 0xcc, 0xdc, 0x04,
-  0xe5, 0xf9, 0x15, 0x02, 0xec, 0x0b, 0xdc, 0x07, 0xdf, 0x2e, 0xd1, 0x08,
-  0x92, 0xe5, 0xf2, 0x9a, 0xe6, 0x0a, 0xcf, 0x1d, 0xd8, 0x10, 0xe8, 0xb5,
-  0x3d, 0x10, 0xda, 0x09, 0xf8, 0x04, 0x20, 0x18, 0xe9, 0x30, 0x29, 0xfc,
-  0xc4, 0x18, 0xe5, 0x09, 0xe9, 0xb9, 0x12, 0x50, 0x22, 0xed, 0xdd, 0xda,
-  0x09, 0xbc, 0x2f, 0x26, 0xef, 0xf9, 0xf7, 0xf1, 0xfe, 0xee, 0xfd, 0xbb,
-  0xca, 0xde, 0xf3, 0xe3, 0x01, 0x34, 0xfc, 0x06, 0x08, 0xf3, 0x20, 0x0e,
-  0x0d, 0xe7, 0xc3, 0x0a, 0xcf, 0x20, 0xef, 0xe3, 0x26, 0xf4, 0x0a, 0xf0,
-  0xef, 0xf6, 0xe7, 0x05, 0x1f, 0x19, 0xfb, 0xed, 0xea, 0xfc, 0x23, 0x01,
-  0x0b, 0x27, 0xea, 0x21, 0x08, 0x05, 0x26, 0xf4, 0xc0, 0xf2, 0x2b, 0x0f,
-  0x2f, 0xf0, 0x1d, 0xf7, 0xc9, 0xf1, 0xe5, 0xd3, 0x0a, 0x11, 0xeb, 0x1f,
-  0xe8, 0x0f, 0x28, 0xdf, 0x0f, 0x31, 0x43, 0xe5, 0xee, 0xf2, 0x0b, 0xff,
-  0xc2, 0xdc, 0xee, 0xb4, 0xf7, 0x13, 0xeb, 0x0f, 0xf6, 0x37, 0x06, 0xe6,
-  0xf6, 0xe2, 0x42, 0x1e, 0xef, 0x04, 0x05, 0x0d, 0xe8, 0xf8, 0xdd, 0xe5,
-  0x03, 0x3a, 0xfe, 0xf4, 0xf2, 0x4e, 0xb9, 0xd7, 0x0f, 0x09, 0x30, 0x02,
-  0xcd, 0x29, 0x15, 0xc3, 0x22, 0xe4, 0x41, 0x54, 0x1d, 0xcd, 0xe0, 0xc9,
-  0x1c, 0xe7, 0xc5, 0x2b, 0xc4, 0xfa, 0xf1, 0xfe, 0xe3, 0x3c, 0x59, 0xd8,
-  0xda, 0x2d, 0xec, 0xf0, 0xd6, 0xbf, 0x19, 0xb8, 0xf1, 0xfb, 0xfb, 0xfc,
-  0xfb, 0x3c, 0x1e, 0x16, 0xf1, 0x54, 0x02, 0x1b, 0xfd, 0xe7, 0x04, 0x3b,
-  0x23, 0xfc, 0xea, 0x1c, 0xfa, 0xe7, 0x0b, 0x26, 0x1e, 0x10, 0xec, 0x28,
-  0xdc, 0xe4, 0xd8, 0xf8, 0xd7, 0xd4, 0xf6, 0x1b, 0x11, 0x00, 0xde, 0xed,
-  0xe4, 0xf6, 0x28, 0xd8, 0x00, 0x05, 0xce, 0xfa, 0xf7, 0xc6, 0xf8, 0x05,
-  0x08, 0xdf, 0xaa, 0x0a, 0x1c, 0x17, 0x5c, 0xf2, 0x1a, 0xe0, 0xf2, 0xfe,
-  0xf8, 0xef, 0xfb, 0xe5, 0xc1, 0x15, 0xf4, 0xf7, 0x06, 0xe4, 0x62, 0xf7,
-  0xe1, 0xff, 0xf9, 0x2e, 0x19, 0xd8, 0x07, 0xdc, 0xe6, 0xc6, 0x3f, 0xf8,
-  0x36, 0x08, 0xbc, 0xf2, 0x0a, 0xa0, 0x42, 0x1b, 0xe7, 0xff, 0x1f, 0x4f,
-  0x28, 0x03, 0x1f, 0xf1, 0xee, 0x19, 0xf5, 0xbe, 0x1f, 0xfa, 0x07, 0x0f,
-  0xfc, 0x2a, 0x25, 0x10, 0x03, 0xfd, 0x58, 0x1f, 0xee, 0x15, 0x06, 0xf3,
-  0xe2, 0xe2, 0xde, 0x21, 0x32, 0xee, 0x10, 0xff, 0x01, 0x38, 0xf2, 0x26,
-  0x19, 0xfd, 0x53, 0x12, 0xe5, 0xf2, 0x14, 0x14, 0xe8, 0xe8, 0xf1, 0x10,
-  0x07, 0xee, 0xff, 0x22, 0x07, 0x2d, 0xd1, 0xd9, 0x10, 0x1d, 0x26, 0xd6,
-  0xde, 0x38, 0x03, 0xbf, 0x0d, 0xf9, 0x47, 0x3c, 0xf5, 0x0d, 0xf5, 0xa0,
-  0xe0, 0xfd, 0xe4, 0x35, 0xc5, 0x0e, 0x3a, 0x26, 0x3c, 0x02, 0x27, 0x0b,
-  0x14, 0x0e, 0x22, 0x0b, 0xbe, 0x13, 0xe2, 0x20, 0x2c, 0x09, 0x0e, 0x06,
-  0xed, 0x07, 0x40, 0x13, 0x08, 0x12, 0xe3, 0x21, 0xec, 0xee, 0x09, 0xf7,
-  0xf3, 0xd5, 0xea, 0x3a, 0x2f, 0x29, 0xc0, 0x1d, 0x06, 0xfc, 0xdf, 0x1b,
-  0x39, 0x2d, 0xf5, 0x28, 0x08, 0xce, 0x07, 0x0c, 0x26, 0xfa, 0x0e, 0xe7,
-  0xfb, 0x05, 0x3d, 0xcb, 0xf3, 0xd7, 0x00, 0x1d, 0xe9, 0xbe, 0xea, 0x35,
-  0x12, 0xfe, 0x8f, 0xf2, 0x23, 0x17, 0xe1, 0xcc, 0x66, 0xef, 0xf3, 0x0e,
-  0xe7, 0xd2, 0x0c, 0xc5, 0xe8, 0xf2, 0x00, 0x12, 0xfe, 0x0e, 0x45, 0x0d,
-  0xad, 0x34, 0x2b, 0xd4, 0x0a, 0xc2, 0x07, 0xf7, 0x15, 0xe4, 0x08, 0x20,
-  0x13, 0x10, 0xeb, 0x23, 0xfb, 0x9f, 0x15, 0x00, 0x42, 0xfc, 0xf9, 0x46,
-  0xeb, 0xea, 0x0c, 0xd9, 0x11, 0x1b, 0xf7, 0xdf, 0xe1, 0xeb, 0x09, 0x7f,
-  0x00, 0xfa, 0xfc, 0xe9, 0xe6, 0xc7, 0xf6, 0x18, 0xe3, 0x16, 0x0f, 0x2a,
-  0x20, 0xd6, 0x06, 0x44, 0x18, 0xe5, 0xf7, 0x05, 0xc0, 0xf2, 0x14, 0x13,
-  0x16, 0x62, 0x31, 0x48, 0xc8, 0x43, 0x34, 0x0e, 0x1c, 0xf0, 0xee, 0x2e,
-  0x1a, 0x04, 0xf5, 0x06, 0x27, 0x18, 0x21, 0xbd, 0xd6, 0x0f, 0xec, 0x09,
-  0x20, 0x1f, 0xe8, 0xf4, 0xff, 0xf3, 0xfe, 0xe1, 0xe0, 0xea, 0xcf, 0xfa,
-  0xf6, 0xfe, 0x11, 0x2b, 0xeb, 0xea, 0x46, 0x0f, 0xe5, 0x07, 0xf1, 0x4e,
-  0x07, 0x0c, 0xfa, 0x2b, 0x13, 0x18, 0xec, 0x19, 0x30, 0xdc, 0x0c, 0xd5,
-  0x8d, 0xe1, 0x20, 0x08, 0xe0, 0x12, 0x38, 0xc7, 0xcf, 0x28, 0xbc, 0x2f,
-  0x1f, 0xe7, 0xb6, 0xf5, 0x56, 0xde, 0x52, 0x62, 0xeb, 0x48, 0xc3, 0xea,
-  0xc4, 0xd4, 0x10, 0x2d, 0xad, 0xe9, 0x4d, 0xc5, 0x36, 0x04, 0xfa, 0x39,
-  0xdf, 0x09, 0x03, 0xe0, 0x33, 0xb3, 0x1b, 0xf2, 0xd0, 0x38, 0xe0, 0xbe,
-  0xef, 0xad, 0x0f, 0xbf, 0xcf, 0x50, 0xf4, 0x5c, 0xdf, 0xbf, 0xd7, 0x37,
-  0xe5, 0xba, 0x18, 0x30, 0x19, 0x45, 0xf5, 0x12, 0x2a, 0xed, 0x06, 0x02,
-  0x11, 0x2e, 0xd7, 0xd2, 0x51, 0x23, 0xf9, 0xcc, 0x14, 0x24, 0x18, 0x00,
-  0xbf, 0x17, 0xd3, 0xbb, 0x0d, 0x1a, 0x01, 0x04, 0x97, 0xde, 0x40, 0xe3,
-  0x3a, 0x24, 0x1d, 0xf1, 0x1b, 0x03, 0x0a, 0x45, 0x41, 0xc9, 0x23, 0x20,
-  0x12, 0x32, 0x1f, 0x8b, 0xe2, 0xd2, 0xe8, 0xd8, 0xce, 0x29, 0xcd, 0x0a,
-  0xa9, 0xbe, 0xdc, 0xb5, 0x37, 0xe8, 0xfc, 0x1f, 0xab, 0x18, 0x2a, 0xe8,
-  0x34, 0xf9, 0x0d, 0x1e, 0xe8, 0xe7, 0xda, 0xdc, 0x0d, 0x28, 0xbc, 0xd5,
-  0xd7, 0x1f, 0x0f, 0xf4, 0x04, 0x37, 0xb9, 0xdf, 0x10, 0x24, 0x13, 0x0f,
-  0xb9, 0x49, 0xee, 0x05, 0xee, 0xe6, 0x19, 0x9e, 0xfe, 0x17, 0xe9, 0x0a,
-  0x08, 0xd7, 0x35, 0x21, 0xbb, 0x5b, 0x17, 0xd5, 0x07, 0x26, 0x12, 0xb7,
-  0x03, 0x3f, 0xf6, 0x21, 0xbf, 0x00, 0xbb, 0xe3, 0x2f, 0xc5, 0xcf, 0x25,
-  0xf6, 0xed, 0x54, 0x1e, 0x02, 0xf3, 0xf1, 0xcd, 0xff, 0x24, 0xcf, 0x7f,
-  0xf9, 0x0d, 0xd6, 0xed, 0x16, 0xd2, 0x04, 0xde, 0xde, 0x22, 0xed, 0x01,
-  0xcf, 0x01, 0xe8, 0xf9, 0x0d, 0xe5, 0x12, 0xe3, 0x1b, 0xd2, 0x1b, 0x10,
-  0x0e, 0xc1, 0x05, 0x07, 0xe4, 0x16, 0x30, 0xf2, 0xce, 0x1a, 0x09, 0x41,
-  0xdb, 0xe5, 0x17, 0xd8, 0x35, 0x3d, 0x42, 0x06, 0xe1, 0xef, 0xfe, 0x0d,
-  0xfd, 0xdd, 0x13, 0x02, 0xda, 0xf7, 0x07, 0x25, 0x0d, 0xed, 0xe1, 0xf0,
-  0x03, 0x3a, 0xf1, 0xee, 0x1b, 0xef, 0x1f, 0xd2, 0x1e, 0x18, 0xec, 0xbc,
-  0xca, 0x06, 0xe8, 0xe6, 0xe0, 0x40, 0xf8, 0x04, 0x0b, 0xff, 0x39, 0x1f,
-  0x17, 0xcf, 0x2c, 0x2a, 0x62, 0x14, 0xf4, 0x06, 0xb7, 0x2c, 0x1f, 0xd3,
-  0x05, 0x24, 0xff, 0x17, 0xa8, 0x19, 0x3b, 0xda, 0xde, 0x0a, 0x1f, 0xdd,
-  0xfb, 0x23, 0x14, 0xec, 0x07, 0xb6, 0x07, 0x0b, 0xc5, 0xd4, 0x31, 0xfc,
-  0x2d, 0xe7, 0x20, 0x23, 0xe2, 0x2f, 0xdf, 0x4f, 0x10, 0x35, 0xbe, 0xe8,
-  0xd2, 0xe8, 0xe9, 0xfb, 0xbb, 0x18, 0xb2, 0xdc, 0xfa, 0xef, 0xd3, 0xfd,
-  0xe2, 0x1c, 0xcf, 0x04, 0xde, 0xfd, 0x28, 0xf8, 0x23, 0x13, 0x26, 0xca,
-  0xa9, 0xd6, 0xf7, 0x3b, 0xbc, 0x3a, 0x28, 0xee, 0xdd, 0x22, 0x1d, 0x46,
-  0x0f, 0x2f, 0x3a, 0xd2, 0x02, 0x2a, 0xee, 0xd9, 0x02, 0xcd, 0xcf, 0xd6,
-  0xfe, 0xc5, 0x3a, 0xdd, 0x10, 0x18, 0x1d, 0x2f, 0x04, 0x18, 0x2f, 0x3e,
-  0xb8, 0x06, 0xb8, 0x30, 0x44, 0xf1, 0xb5, 0x05, 0x13, 0x04, 0xe5, 0x0b,
-  0xe9, 0x52, 0x13, 0xfc, 0x50, 0xef, 0x04, 0xec, 0x09, 0x18, 0xdc, 0xc9,
-  0xfc, 0xf0, 0x52, 0x03, 0xf2, 0xf9, 0x23, 0xe7, 0xc0, 0xf1, 0xeb, 0xdf,
-  0xe3, 0x4d, 0x08, 0x24, 0x1f, 0xdb, 0x69, 0xc4, 0xde, 0x06, 0x01, 0xfd,
-  0x3a, 0x10, 0x02, 0x32, 0x37, 0xd2, 0xfe, 0x46, 0xeb, 0x14, 0xd2, 0x1a,
-  0xe7, 0x25, 0x56, 0x10, 0x14, 0xd4, 0x00, 0x22, 0x58, 0x05, 0xbd, 0x2e,
-  0xcb, 0x02, 0x18, 0x06, 0xba, 0x60, 0x23, 0x14, 0x3d, 0xf0, 0x13, 0x15,
-  0x2b, 0x12, 0xe7, 0x2b, 0x1f, 0x12, 0x3f, 0xf7, 0xda, 0x01, 0x53, 0xcb,
-  0xd3, 0x4e, 0xda, 0x24, 0xe0, 0x58, 0xff, 0x1f, 0x23, 0x07, 0xd7, 0xe0,
-  0x5d, 0x1b, 0x06, 0x14, 0x08, 0xeb, 0xf8, 0x0d, 0x57, 0xdc, 0xf3, 0x2a,
-  0x0c, 0x3d, 0x01, 0x42, 0xcc, 0x27, 0xfe, 0x2f, 0xd8, 0x25, 0x82, 0x13,
-  0x01, 0xd8, 0xe8, 0xee, 0x04, 0xcf, 0xf2, 0xbc, 0xb6, 0x12, 0x06, 0xfd,
-  0x44, 0xfc, 0xd6, 0xd6, 0x0e, 0x01, 0xd9, 0x2f, 0xea, 0x4b, 0xe9, 0xe8,
-  0xd4, 0xfc, 0xdf, 0xd2, 0xc6, 0xc9, 0x20, 0xe6, 0xc7, 0x38, 0x23, 0x0a,
-  0xec, 0x25, 0x2d, 0xaf, 0x18, 0x3b, 0x23, 0x10, 0x02, 0xc3, 0xfe, 0x10,
-  0x16, 0xcd, 0xe8, 0xe4, 0x18, 0xe6, 0x08, 0x03, 0xde, 0x07, 0x0a, 0xdc,
-  0x1a, 0xde, 0x19, 0x2a, 0xce, 0xf8, 0x0c, 0xe9, 0xea, 0x30, 0x42, 0x30,
-  0x05, 0x28, 0xc0, 0x1e, 0xf7, 0xde, 0xef, 0x28, 0x01, 0x07, 0x03, 0xfa,
-  0xef, 0x1a, 0x37, 0xf2, 0xf1, 0xfa, 0x02, 0xf4, 0xdd, 0xfe, 0xfd, 0x29,
-  0x01, 0x1f, 0xf2, 0xfe, 0xe1, 0xfc, 0xc5, 0x40, 0xf8, 0x02, 0xf2, 0x1c,
-  0xed, 0xde, 0x27, 0xe6, 0x1e, 0xd9, 0xea, 0x19, 0x1b, 0xf1, 0x2d, 0xcd,
-  0x0b, 0xec, 0x02, 0xe5, 0xfb, 0x11, 0x0c, 0xfc, 0xd3, 0xd3, 0x0e, 0xfb,
-  0xf0, 0xec, 0xe8, 0x30, 0x10, 0x22, 0xeb, 0x4a, 0xef, 0x05, 0x29, 0xe8,
-  0xed, 0x07, 0xfa, 0xe1, 0xec, 0xf7, 0x0f, 0xed, 0xc9, 0x0b, 0x0a, 0xf7,
-  0xf3, 0x30, 0x18, 0x01, 0x18, 0xfc, 0x01, 0x28, 0xe0, 0xdc, 0xdf, 0x34,
-  0x0f, 0x45, 0xe3, 0x04, 0x3a, 0xf7, 0x3c, 0xe3, 0x0a, 0xad, 0xf7, 0x07,
-  0xd8, 0xec, 0x02, 0x1a, 0xfd, 0xdf, 0xfa, 0x15, 0xf2, 0x1c, 0xef, 0x26,
-  0xd2, 0xda, 0xe7, 0xe5, 0x0f, 0x09, 0xf3, 0xf9, 0x40, 0x16, 0x16, 0xf9,
-  0xf4, 0x0c, 0xf9, 0xdf, 0x15, 0xfd, 0xfa, 0xf4, 0x14, 0x1c, 0x01, 0x01,
-  0x18, 0xe8, 0xe3, 0xeb, 0xde, 0x15, 0x0c, 0xee, 0x23, 0x13, 0x0f, 0x07,
-  0xdf, 0x05, 0xb2, 0x08, 0xf0, 0x5e, 0x04, 0x1c, 0xe2, 0xdc, 0x39, 0x12,
-  0x2c, 0xe3, 0x0b, 0xee, 0xd9, 0xfc, 0xe5, 0xfe, 0x1d, 0xf8, 0x10, 0xfe,
-  0x11, 0xf0, 0xe2, 0x27, 0x16, 0x19, 0xf1, 0xfb, 0xf1, 0x27, 0x34, 0x14,
-  0xfa, 0xfd, 0x0a, 0xf8, 0xff, 0xea, 0xfc, 0x05, 0xfc, 0xf9, 0x13, 0xe0,
-  0xfc, 0x26, 0xf4, 0xdf, 0x02, 0x06, 0x0c, 0xd8, 0x0a, 0x1b, 0xd5, 0xef,
-  0x22, 0x19, 0x00, 0xe6, 0xfd, 0xfe, 0xda, 0x08, 0x0f, 0x17, 0xf6, 0xee,
-  0x42, 0xf5, 0x24, 0xef, 0xe1, 0xf4, 0x19, 0x2a, 0xe4, 0x05, 0x21, 0xfb,
-  0x15, 0x03, 0xfd, 0xef, 0xf7, 0x2d, 0x00, 0xcd, 0x0e, 0x20, 0x28, 0x08,
-  0xf4, 0xeb, 0xeb, 0xdf, 0xd5, 0x10, 0xff, 0x1b, 0x08, 0xf9, 0x06, 0xf1,
-  0xdf, 0x09, 0xee, 0xca, 0x14, 0x23, 0xf8, 0x24, 0xe2, 0x19, 0x1b, 0xf9,
-  0xf2, 0x0e, 0x01, 0xd2, 0xff, 0xe5, 0x1d, 0x02, 0xf1, 0xd4, 0xfe, 0x22,
-  0x09, 0xf1, 0xf4, 0x0f, 0x7f, 0x07, 0x24, 0x18, 0x0a, 0xdc, 0x1e, 0xfb,
-  0xe0, 0xe6, 0x0f, 0xf4, 0x16, 0xf6, 0x15, 0x0a, 0x08, 0x24, 0x09, 0xc8,
-  0xfc, 0x28, 0x06, 0x2e, 0xe2, 0x29, 0xfc, 0xe8, 0x18, 0x0f, 0x14, 0xe2,
-  0x17, 0xe6, 0xe7, 0xf2, 0xe6, 0xed, 0x2c, 0xc0, 0x12, 0x35, 0xf7, 0x25,
-  0x13, 0x0d, 0xde, 0xe5, 0x01, 0x11, 0xe5, 0xfd, 0x38, 0xfc, 0x1e, 0xe0,
-  0x15, 0xf4, 0x09, 0x0d, 0xdf, 0x36, 0xfa, 0x1c, 0x10, 0xde, 0x3d, 0x0a,
-  0x2d, 0xc9, 0xfb, 0x05, 0x95, 0xc7, 0xfc, 0x08, 0x07, 0x18, 0xdf, 0x19,
-  0x2b, 0xe8, 0x07, 0x4c, 0x34, 0x25, 0xca, 0x07, 0x06, 0x36, 0x30, 0xdb,
-  0x0a, 0xd0, 0x06, 0xe0, 0xf2, 0x0d, 0xd8, 0xfd, 0xeb, 0xdf, 0xf5, 0xfd,
-  0x37, 0x34, 0xf0, 0xd0, 0xf8, 0xdc, 0xf3, 0xe2, 0x0b, 0xf0, 0xd6, 0xff,
-  0x13, 0x1b, 0xf5, 0x08, 0xf3, 0xf7, 0x00, 0x03, 0x14, 0x0e, 0xf7, 0xb1,
-  0xf5, 0xf7, 0x07, 0x05, 0xf5, 0xe9, 0x1a, 0xff, 0xd5, 0xdf, 0x1f, 0xee,
-  0xe2, 0x3b, 0xf4, 0x1a, 0x2d, 0x06, 0x06, 0xfb, 0x3b, 0x30, 0xfc, 0x3f,
-  0xf4, 0x09, 0xe7, 0x0e, 0xe9, 0xd4, 0x30, 0xf4, 0x03, 0xf3, 0xe8, 0x02,
-  0xf0, 0xed, 0xf8, 0x02, 0x31, 0x2d, 0xf6, 0xf2, 0xd8, 0x1d, 0xe5, 0x1b,
-  0xe7, 0xea, 0xde, 0xd8, 0x02, 0xee, 0xf6, 0xf4, 0x03, 0xec, 0x2b, 0xf4,
-  0xdc, 0xe4, 0xf4, 0xf2, 0x36, 0x0b, 0x26, 0xf9, 0xf4, 0xec, 0x50, 0x03,
-  0xe6, 0xf1, 0x0d, 0xe3, 0xfd, 0x1f, 0x20, 0xf8, 0x19, 0x28, 0x07, 0xe5,
-  0x2f, 0x33, 0xfe, 0x21, 0xe0, 0x26, 0x16, 0xd5, 0x06, 0x06, 0x4d, 0x08,
-  0x0a, 0xea, 0xee, 0x12, 0xfd, 0xf1, 0x06, 0xda, 0xfb, 0x2a, 0x19, 0x19,
-  0xe1, 0x02, 0xe7, 0x14, 0xff, 0xf2, 0xea, 0xf5, 0xf2, 0xe6, 0xf3, 0xde,
-  0x03, 0x33, 0x0a, 0x03, 0xd1, 0x0d, 0xed, 0xf7, 0x05, 0xe6, 0x28, 0xfa,
-  0xef, 0xd4, 0x15, 0xdd, 0x3c, 0x37, 0xcb, 0x11, 0xcf, 0xcf, 0xea, 0x03,
-  0xf7, 0xf6, 0xf6, 0xbf, 0x33, 0xe3, 0x2f, 0xf0, 0x2e, 0xe0, 0x12, 0x03,
-  0xbb, 0x14, 0xc5, 0xdf, 0xe2, 0xdb, 0xf5, 0x19, 0xe7, 0x01, 0xb3, 0xe8,
-  0x22, 0xf4, 0xf2, 0xc9, 0xb2, 0xf7, 0xec, 0xab, 0x00, 0xe2, 0xc3, 0x18,
-  0xee, 0x09, 0xe0, 0xd0, 0x0a, 0x0d, 0x03, 0xbd, 0x34, 0xbf, 0xc2, 0x0f,
-  0x02, 0x2e, 0xfc, 0xfe, 0xc8, 0x12, 0xc4, 0xc5, 0x6d, 0x2a, 0xe2, 0x03,
-  0xe5, 0x10, 0x3c, 0x02, 0x37, 0xf6, 0xce, 0x03, 0x08, 0xeb, 0x33, 0x12,
-  0xdf, 0xe2, 0x15, 0x18, 0xea, 0x09, 0x0f, 0xfb, 0xe0, 0xf7, 0x1e, 0xb3,
-  0xf5, 0x18, 0xed, 0xcc, 0xe8, 0xe0, 0x0e, 0x04, 0xa5, 0xf0, 0xdf, 0xc9,
-  0xec, 0x1a, 0x11, 0x23, 0xcf, 0xd2, 0xff, 0xb9, 0xeb, 0x3f, 0xfe, 0xbc,
-  0xc5, 0xbd, 0x17, 0xe8, 0xfc, 0x6d, 0xff, 0x20, 0x44, 0xea, 0x15, 0xd1,
-  0x57, 0x28, 0xec, 0xcc, 0xcd, 0x1c, 0xff, 0x1a, 0x14, 0xf5, 0xe3, 0xdc,
-  0x4b, 0x4c, 0xdd, 0xe1, 0xf2, 0x1c, 0xfb, 0x21, 0x28, 0x34, 0xcc, 0xfd,
-  0x2b, 0x3a, 0x08, 0xb5, 0xc2, 0x1d, 0x9e, 0xcd, 0x3d, 0xfb, 0x17, 0x00,
-  0xba, 0x07, 0xdf, 0x3c, 0xe0, 0x12, 0xeb, 0x16, 0x13, 0xca, 0x23, 0xf8,
-  0x27, 0x49, 0xcf, 0xce, 0xe7, 0xd8, 0xdb, 0xa5, 0x21, 0x3c, 0xcc, 0xd5,
-  0x30, 0xc4, 0xd6, 0xfd, 0xe1, 0xfc, 0x2b, 0x0c, 0xf4, 0xfd, 0xba, 0x7f,
-  0xe4, 0x1f, 0xfa, 0xde, 0x2c, 0x28, 0xf6, 0x2d, 0xc0, 0xf6, 0xfe, 0x2a,
-  0xec, 0x2b, 0xd8, 0xdf, 0xcf, 0xde, 0x10, 0x3e, 0xfe, 0xe4, 0x1d, 0xd4,
-  0xed, 0x11, 0x12, 0xf2, 0xe0, 0x05, 0x2d, 0xc8, 0xfb, 0xc0, 0xe0, 0x43,
-  0x21, 0xdb, 0xef, 0xf6, 0x07, 0x42, 0xf6, 0xf2, 0x14, 0x0b, 0xf6, 0x28,
-  0x26, 0x64, 0x1c, 0xcd, 0x97, 0x57, 0xa1, 0xc5, 0xe0, 0xc5, 0x4e, 0xeb,
-  0x07, 0x3a, 0x16, 0x04, 0x05, 0x06, 0xeb, 0x1d, 0xb5, 0x0d, 0xc1, 0x0f,
-  0xd0, 0xaa, 0xdf, 0x00, 0xb3, 0x1a, 0xfa, 0xcd, 0xc8, 0xfc, 0x36, 0xee,
-  0x2c, 0xe0, 0x2f, 0xc0, 0x2c, 0xe8, 0x0c, 0xef, 0x18, 0xf3, 0x05, 0xb1,
-  0xd7, 0x95, 0x0a, 0x28, 0x40, 0xcb, 0x05, 0xde, 0xc5, 0x33, 0x18, 0x1a,
-  0xca, 0xfa, 0xec, 0xd0, 0xe8, 0x2d, 0x1b, 0x04, 0x71, 0x04, 0x28, 0xef,
-  0xfb, 0x9a, 0x16, 0xd0, 0xda, 0x05, 0xeb, 0x1d, 0x00, 0xfd, 0xd2, 0x06,
-  0xeb, 0x09, 0xd1, 0xf5, 0xe8, 0xec, 0x17, 0xe8, 0x1f, 0x0f, 0x06, 0xf2,
-  0xf4, 0x07, 0xf7, 0xce, 0x14, 0x19, 0x14, 0xb5, 0x22, 0xde, 0x3e, 0x42,
-  0x09, 0xeb, 0x02, 0x13, 0xc3, 0xbc, 0x34, 0x06, 0x3e, 0xf8, 0x17, 0x61,
-  0xd3, 0x53, 0xbc, 0xf8, 0xcf, 0x15, 0xf7, 0xac, 0x2b, 0x00, 0x22, 0xed,
-  0x19, 0x33, 0x2f, 0x0a, 0xdb, 0xf6, 0xff, 0x03, 0xf2, 0xf2, 0xed, 0x28,
-  0xf1, 0xf9, 0xd0, 0x36, 0x1f, 0xd2, 0xda, 0x3f, 0x09, 0x5c, 0xea, 0x11,
-  0x27, 0x0b, 0x02, 0xfd, 0x11, 0xeb, 0x0d, 0x1d, 0x13, 0x02, 0xf8, 0x26,
-  0xfb, 0xe2, 0x19, 0x05, 0x02, 0x14, 0x05, 0xe1, 0xc4, 0xe7, 0x0a, 0x9f,
-  0xf6, 0x12, 0x0b, 0xcc, 0xef, 0xd6, 0xec, 0x16, 0xe9, 0xf2, 0x24, 0x30,
-  0xee, 0x20, 0x09, 0xd9, 0x95, 0x27, 0xd1, 0x07, 0x9d, 0x9b, 0xd3, 0x0a,
-  0x73, 0xe9, 0xcf, 0x5b, 0x05, 0x38, 0xe8, 0x02, 0xb2, 0xd9, 0xe3, 0x1a,
-  0xc7, 0x4d, 0x23, 0xfc, 0x20, 0x69, 0xc4, 0xc8, 0xf1, 0xfe, 0x1a, 0xf9,
-  0x17, 0x1d, 0x1c, 0x50, 0xcb, 0xcd, 0xd2, 0x01, 0x41, 0xcf, 0x30, 0x01,
-  0xdd, 0xf4, 0xf6, 0x0c, 0xe9, 0x66, 0x00, 0xe1, 0xc7, 0x06, 0xe8, 0x4b,
-  0xeb, 0xee, 0x06, 0x00, 0xe0, 0xfa, 0xc7, 0xf4, 0x3f, 0x07, 0x0a, 0xf4,
-  0xf5, 0x8e, 0xff, 0xef, 0x07, 0xe9, 0xef, 0x2d, 0xde, 0x27, 0xef, 0x21,
-  0xea, 0xe7, 0x05, 0x32, 0xbc, 0x45, 0x17, 0xfa, 0xdd, 0xc8, 0x12, 0x13,
-  0xe7, 0x17, 0x0c, 0xf9, 0xf4, 0x01, 0x38, 0xcb, 0xd0, 0xd7, 0x16, 0xfa,
-  0x1c, 0xcd, 0x3f, 0xf7, 0x0b, 0xe2, 0x28, 0x15, 0xd8, 0x49, 0xdd, 0x09,
-  0xb9, 0x29, 0xbe, 0x02, 0x0b, 0x02, 0x0d, 0x0b, 0x0d, 0x31, 0xc0, 0xd8,
-  0xf4, 0xf4, 0x05, 0x13, 0xf9, 0xe4, 0x3c, 0xea, 0x3f, 0xa2, 0x1f, 0x08,
-  0xea, 0x28, 0x17, 0xf2, 0x14, 0x00, 0xf3, 0xeb, 0x37, 0x17, 0xde, 0x2a,
-  0xd9, 0xf6, 0x4a, 0x21, 0x23, 0x08, 0xd3, 0x06, 0xe5, 0x00, 0x14, 0x35,
-  0xc2, 0x08, 0xf7, 0x0a, 0xc2, 0xe7, 0x22, 0xe1, 0xf8, 0x02, 0xe7, 0x4a,
-  0x0b, 0x04, 0x40, 0x2d, 0x0c, 0x10, 0xe2, 0x16, 0xed, 0xe5, 0xfe, 0x01,
-  0xec, 0x0f, 0xf8, 0x19, 0xb0, 0x2a, 0xce, 0xe6, 0x07, 0xf8, 0xf8, 0xdf,
-  0x1c, 0xcc, 0x17, 0xec, 0xd4, 0x1d, 0xdc, 0x1e, 0x0e, 0x29, 0x0f, 0xf8,
-  0x24, 0xf7, 0x0c, 0x2d, 0xee, 0xf3, 0x20, 0xf3, 0x17, 0x0f, 0xe7, 0x06,
-  0xaf, 0xe0, 0x42, 0xfb, 0xee, 0x1c, 0x10, 0x08, 0xf2, 0xf6, 0xf6, 0xdb,
-  0x12, 0xdb, 0xe2, 0xfd, 0x32, 0x1f, 0x36, 0x16, 0xd0, 0xee, 0x15, 0xee,
-  0x10, 0xbd, 0x22, 0xf0, 0xd6, 0xfe, 0x0d, 0x23, 0xe4, 0xe7, 0xef, 0xc7,
-  0x02, 0x45, 0xf5, 0xd7, 0x0c, 0x27, 0x12, 0xc7, 0x21, 0x06, 0xd2, 0x0e,
-  0xdb, 0x11, 0x39, 0x23, 0xd4, 0xea, 0x4f, 0x09, 0x16, 0xf8, 0x06, 0xe4,
-  0xc5, 0x0b, 0x0b, 0x36, 0xcb, 0xd7, 0x16, 0xd2, 0x28, 0xdc, 0x36, 0xf5,
-  0xdc, 0x06, 0xd4, 0xf6, 0xfc, 0xff, 0xff, 0xd8, 0xf4, 0x02, 0x21, 0xcd,
-  0xb4, 0xeb, 0x42, 0xd8, 0x15, 0xe8, 0x32, 0xd7, 0xe3, 0xe7, 0x16, 0xfd,
-  0xff, 0xe6, 0xf5, 0x05, 0x1c, 0xea, 0xf3, 0xf3, 0x07, 0xc6, 0x09, 0xf1,
-  0xea, 0xec, 0xd3, 0x24, 0xeb, 0x21, 0xda, 0xef, 0xe7, 0xfb, 0xeb, 0x1e,
-  0xde, 0xd5, 0x50, 0xf3, 0x31, 0x09, 0x09, 0x0b, 0xdb, 0xe5, 0x0f, 0x16,
-  0xaa, 0xb1, 0xf5, 0x51, 0x0e, 0xda, 0x0e, 0x27, 0xf0, 0x45, 0xe5, 0xff,
-  0xe7, 0xe9, 0x0d, 0x06, 0xfb, 0xf6, 0x04, 0xf4, 0x31, 0x20, 0x13, 0xf4,
-  0xd7, 0x54, 0x0f, 0xf4, 0xe2, 0xf3, 0xee, 0xe7, 0x32, 0x03, 0xe3, 0xe5,
-  0x2d, 0xe4, 0x1a, 0xdb, 0xd0, 0x03, 0xd0, 0x02, 0x36, 0x2a, 0x0d, 0x03,
-  0x04, 0xdf, 0x0d, 0x05, 0xe5, 0xec, 0x13, 0xfc, 0xff, 0xe8, 0xf9, 0xea,
-  0x07, 0xac, 0xfb, 0xe7, 0x1e, 0x0e, 0x0d, 0x1b, 0xd7, 0xfa, 0x12, 0xdc,
-  0xef, 0xe0, 0xd3, 0xb7, 0xfc, 0x43, 0x0f, 0xe8, 0x0a, 0xf9, 0x0e, 0xfc,
-  0x0e, 0xf2, 0x37, 0xc4, 0xbb, 0x11, 0xe2, 0x2b, 0xf6, 0xd9, 0x0e, 0xd1,
-  0x0a, 0x0b, 0xd1, 0xef, 0xfd, 0x0c, 0x3e, 0xeb, 0xdf, 0xfc, 0xf4, 0x2d,
-  0x21, 0xfd, 0x1b, 0xfc, 0xc7, 0xd4, 0x26, 0xda, 0x0d, 0x2f, 0xf6, 0x08,
-  0xd1, 0x0f, 0xf2, 0xe9, 0x04, 0xd8, 0x11, 0xfb, 0x0c, 0x18, 0x2b, 0x19,
-  0xdb, 0xed, 0xc2, 0xef, 0x2f, 0xe0, 0xeb, 0xff, 0xe8, 0x52, 0x09, 0xf4,
-  0xfa, 0x17, 0xf8, 0x21, 0x00, 0x5d, 0x3f, 0x01, 0xf0, 0xd3, 0xfb, 0x27,
-  0x0a, 0xc1, 0x55, 0x2b, 0xff, 0xa4, 0xf6, 0xf5, 0xd8, 0x41, 0xdf, 0xcb,
-  0xca, 0xfb, 0x18, 0x08, 0xde, 0x3a, 0xd3, 0x37, 0xfd, 0x0b, 0xe1, 0x0c,
-  0xcb, 0xda, 0x15, 0xf3, 0x40, 0x0e, 0x22, 0x08, 0xba, 0xc6, 0xd5, 0xf8,
-  0x15, 0xe7, 0xc7, 0x31, 0x47, 0x06, 0xde, 0x17, 0x26, 0x7f, 0x01, 0xbe,
-  0xc4, 0xbc, 0x13, 0xed, 0xd7, 0x01, 0x31, 0x05, 0xcb, 0xe4, 0x48, 0xe8,
-  0xdc, 0x09, 0xf2, 0xf3, 0xf8, 0xff, 0xd0, 0x0d, 0x38, 0xd3, 0xde, 0x08,
-  0x15, 0x02, 0x08, 0xfb, 0xef, 0xe9, 0xe3, 0xe3, 0xda, 0x1b, 0xe7, 0x0a,
-  0x2f, 0xf4, 0x06, 0x15, 0x2b, 0x12, 0xdf, 0x18, 0x06, 0xf8, 0x26, 0xf5,
-  0xf9, 0xeb, 0xfb, 0xd7, 0x38, 0xff, 0xf0, 0x46, 0x16, 0xf5, 0xe2, 0x12,
-  0xd5, 0x1b, 0xe6, 0xb0, 0xfe, 0xee, 0xf5, 0xe9, 0x17, 0x0b, 0xf3, 0x1e,
-  0xe1, 0x01, 0x14, 0xf4, 0x09, 0x1d, 0xf2, 0x06, 0x27, 0x03, 0x03, 0xe2,
-  0x11, 0xe2, 0xf4, 0xfe, 0x46, 0xfc, 0x35, 0x2e, 0xed, 0xf2, 0xd6, 0xd2,
-  0xea, 0xc2, 0xed, 0x30, 0xc5, 0x01, 0x1a, 0x9c, 0x25, 0x51, 0xf3, 0x25,
-  0xaf, 0x17, 0x15, 0xb0, 0xf6, 0x33, 0x19, 0x18, 0xd9, 0xbb, 0x17, 0x1c,
-  0xeb, 0xf3, 0xd2, 0x23, 0x31, 0xa9, 0xfc, 0x2c, 0x3a, 0x6c, 0xf1, 0xe9,
-  0x18, 0x11, 0xa6, 0x37, 0x12, 0x54, 0xfb, 0x23, 0x0a, 0x20, 0x20, 0x10,
-  0xe0, 0x04, 0xeb, 0x08, 0xc5, 0x0c, 0xef, 0xe7, 0xe9, 0xf6, 0xba, 0xe8,
-  0xed, 0x00, 0xd3, 0xf4, 0x07, 0x31, 0x0e, 0xd3, 0xe3, 0x11, 0xd2, 0xfd,
-  0xf1, 0xdd, 0x10, 0x0c, 0x13, 0x31, 0xe1, 0x21, 0x15, 0x14, 0x03, 0xef,
-  0x16, 0xd5, 0x45, 0x22, 0x29, 0xfa, 0xf0, 0x04, 0x30, 0xb8, 0x14, 0xd6,
-  0xe5, 0x13, 0x0f, 0x2a, 0xdf, 0x2c, 0xb4, 0xee, 0xd7, 0xf9, 0x43, 0xd9,
-  0xde, 0x11, 0xe1, 0x1c, 0xe0, 0xf1, 0xef, 0xb6, 0xd8, 0xf1, 0xd8, 0xcd,
-  0x02, 0x03, 0xda, 0x16, 0x31, 0xed, 0x01, 0x30, 0x0f, 0xfd, 0x0a, 0xb0,
-  0xfa, 0xf5, 0xe4, 0x23, 0x1f, 0x1e, 0x1d, 0x0d, 0xff, 0x32, 0xe1, 0x0d,
-  0x35, 0x1e, 0x26, 0x25, 0x27, 0xc5, 0x26, 0x17, 0xf3, 0xec, 0xe0, 0xf5,
-  0x0f, 0xe0, 0xd0, 0x01, 0xc7, 0x09, 0x33, 0xf4, 0x05, 0x04, 0xc7, 0xfc,
-  0xcd, 0xda, 0x3b, 0xf4, 0xb7, 0xfb, 0xd5, 0xf8, 0xb8, 0x03, 0xea, 0xf6,
-  0xf5, 0x06, 0x1e, 0xef, 0x05, 0x33, 0x12, 0xf6, 0xd4, 0x10, 0xfe, 0x0f,
-  0xfe, 0xf8, 0xe7, 0xdf, 0xe2, 0xeb, 0x12, 0x21, 0xcb, 0xd2, 0xfe, 0x15,
-  0x2e, 0x49, 0x13, 0x24, 0x3c, 0xef, 0x56, 0x1b, 0x10, 0xc6, 0x06, 0xf7,
-  0xe2, 0xfb, 0xd5, 0xe5, 0x0a, 0xe9, 0xe7, 0x2e, 0xfb, 0x0a, 0x3b, 0xe1,
-  0xf3, 0x0b, 0xd0, 0xd4, 0x18, 0xb8, 0xf4, 0x15, 0x0c, 0xd4, 0xe3, 0x06,
-  0xef, 0xd6, 0xd4, 0xad, 0x1d, 0x07, 0xbf, 0xdd, 0x06, 0xe2, 0xd2, 0xde,
-  0x3c, 0x21, 0xe1, 0x1d, 0x13, 0x40, 0xf0, 0x0b, 0xf0, 0x05, 0x0c, 0x3a,
-  0xf5, 0xf1, 0x1d, 0xdc, 0xed, 0x21, 0xff, 0x09, 0x0c, 0xf8, 0xf5, 0xfb,
-  0x26, 0xf2, 0x33, 0x31, 0x7f, 0x19, 0xe2, 0xe9, 0x2f, 0xe7, 0x0c, 0x1c,
-  0x0a, 0x27, 0xdf, 0xf0, 0xec, 0x43, 0xde, 0xfe, 0xe3, 0x1a, 0x2c, 0xd9,
-  0x0e, 0xf9, 0xcd, 0x29, 0xa1, 0x16, 0xfa, 0xdc, 0x28, 0xdb, 0xb4, 0xc3,
-  0x1f, 0x10, 0xe7, 0x08, 0xf7, 0xf8, 0xc9, 0x38, 0x14, 0x02, 0x0c, 0x05,
-  0xf9, 0x0c, 0x03, 0x14, 0xf5, 0x18, 0x11, 0xcc, 0xd7, 0x1c, 0xe6, 0x00,
-  0xe0, 0x0b, 0x19, 0xfc, 0x54, 0xd3, 0x09, 0xe5, 0x08, 0x6b, 0xc0, 0x11,
-  0x00, 0x08, 0x06, 0x15, 0x00, 0xef, 0x0e, 0xde, 0x0d, 0x1d, 0xda, 0xf6,
-  0xfa, 0x10, 0x1d, 0x22, 0x1e, 0xfc, 0x01, 0xe7, 0xd3, 0x02, 0x43, 0x3c,
-  0x64, 0xfd, 0xdf, 0xec, 0x23, 0x26, 0xe8, 0xe1, 0xf1, 0x02, 0xb2, 0xef,
-  0x0c, 0x11, 0x16, 0x40, 0x15, 0x0d, 0x2b, 0x15, 0xf2, 0xbf, 0xfa, 0x06,
-  0xca, 0xf9, 0x11, 0x1b, 0xf2, 0xe7, 0x0e, 0x05, 0x16, 0xda, 0x14, 0xd9,
-  0x09, 0x26, 0xe9, 0xef, 0xfa, 0xdf, 0xf6, 0xe2, 0x22, 0xd3, 0x1e, 0x07,
-  0x22, 0x23, 0xd7, 0xe7, 0x2d, 0xe4, 0x25, 0x0a, 0x0e, 0x08, 0xef, 0x11,
-  0xe2, 0x46, 0x0f, 0x16, 0xd0, 0x34, 0x0f, 0x25, 0x20, 0x05, 0xd4, 0xfe,
-  0x16, 0x16, 0x1b, 0x11, 0x12, 0x16, 0xd1, 0x07, 0x03, 0xcb, 0x22, 0x0a,
-  0x36, 0x29, 0x3e, 0xe2, 0x12, 0xe8, 0xdd, 0x03, 0x23, 0xfb, 0xba, 0xc8,
-  0xc8, 0x27, 0xfd, 0xec, 0x16, 0x14, 0x1b, 0x1b, 0x0b, 0xf7, 0x14, 0x45,
-  0xd9, 0xf0, 0x05, 0x2b, 0xb2, 0xe5, 0xd8, 0xf1, 0xf8, 0xe2, 0x4e, 0xec,
-  0xd0, 0xd0, 0xc0, 0xfd, 0x0d, 0xde, 0xf3, 0xfc, 0xfb, 0xec, 0xef, 0x1e,
-  0xfa, 0x26, 0xfd, 0x0b, 0xf8, 0x05, 0xdd, 0x09, 0x12, 0x29, 0xf3, 0x15,
-  0x52, 0xe1, 0x11, 0x04, 0x03, 0x00, 0x02, 0xdf, 0x1c, 0xdd, 0xc4, 0x2d,
-  0xfe, 0xfa, 0xe2, 0xb0, 0xd1, 0x25, 0xdb, 0xfd, 0xcb, 0x0f, 0xe8, 0x3b,
-  0xb9, 0xf5, 0x09, 0x3b, 0x00, 0xbb, 0xe0, 0x26, 0xd4, 0xf5, 0xef, 0xe5,
-  0x00, 0x09, 0x2c, 0x3c, 0x1f, 0xe1, 0xd4, 0xfa, 0x00, 0xec, 0x56, 0x03,
-  0xe6, 0x01, 0x0b, 0x04, 0xfc, 0x1d, 0x00, 0xf5, 0xf6, 0x11, 0xf9, 0x07,
-  0x40, 0xf7, 0xf9, 0x3f, 0x53, 0xce, 0xf8, 0xdb, 0xde, 0xf9, 0xa0, 0x0f,
-  0x19, 0xc8, 0xed, 0x1d, 0x0d, 0x0c, 0xdf, 0xe3, 0xce, 0x1b, 0xf7, 0xf6,
-  0xcc, 0x02, 0xe4, 0x05, 0xee, 0xde, 0x16, 0xe6, 0x33, 0xbf, 0x0e, 0x32,
-  0x0c, 0xeb, 0x0b, 0xed, 0x0d, 0x1f, 0x25, 0x11, 0x03, 0xee, 0xe9, 0x29,
-  0xe1, 0x14, 0x06, 0x0b, 0xc2, 0x18, 0x27, 0xb4, 0xeb, 0xe5, 0xe8, 0xcd,
-  0xd2, 0xec, 0xf6, 0xba, 0x18, 0xd0, 0x40, 0xeb, 0x46, 0x22, 0xef, 0xf1,
-  0xc5, 0x37, 0x52, 0x06, 0xd9, 0xea, 0xcd, 0x4c, 0xe3, 0xfe, 0xce, 0xbf,
-  0xf4, 0xf9, 0xe9, 0xe5, 0xe4, 0x0b, 0xf0, 0xf6, 0xe9, 0xfd, 0x07, 0xfb,
-  0xf3, 0x18, 0x11, 0x0d, 0x0a, 0x06, 0xdf, 0x2f, 0xf9, 0x02, 0x04, 0x17,
-  0xf0, 0x05, 0xcc, 0xf8, 0xc3, 0xf3, 0x10, 0x16, 0xd8, 0xec, 0x0f, 0xdd,
-  0x09, 0xeb, 0x2c, 0xe4, 0xfc, 0xea, 0xe0, 0xe8, 0x0b, 0x14, 0x16, 0xc4,
-  0x1c, 0x18, 0x06, 0x19, 0xbc, 0x31, 0x1e, 0x03, 0x81, 0x24, 0xea, 0x13,
-  0xf3, 0x1c, 0xcc, 0xd5, 0x2c, 0xe9, 0xf4, 0x01, 0x10, 0xe9, 0xcb, 0x08,
-  0x03, 0xfa, 0x03, 0xf3, 0xed, 0x41, 0x22, 0x01, 0x15, 0xf2, 0x4b, 0xf7,
-  0x0d, 0x30, 0x07, 0xe2, 0x0b, 0xeb, 0xd1, 0x15, 0x0f, 0x26, 0xeb, 0xfe,
-  0x15, 0x06, 0x02, 0xa7, 0xfc, 0x24, 0xfc, 0x0d, 0xd7, 0x0f, 0xd8, 0xf5,
-  0x32, 0xd9, 0x0f, 0xc5, 0x31, 0x19, 0xfd, 0xd8, 0x5a, 0x01, 0x71, 0xc6,
-  0xd6, 0x39, 0xfe, 0xcf, 0xc8, 0x11, 0xca, 0xdd, 0x17, 0xed, 0x09, 0x1b,
-  0xdb, 0x07, 0xea, 0xd7, 0xf4, 0x1b, 0xf3, 0x2b, 0xfa, 0xec, 0x06, 0x0a,
-  0xd8, 0x14, 0x0d, 0x01, 0xf0, 0x38, 0x18, 0xd9, 0xda, 0x07, 0xfb, 0x0b,
-  0xd1, 0xf1, 0xfe, 0x05, 0xe0, 0xff, 0x0f, 0x3a, 0xea, 0xf5, 0x0f, 0xe4,
-  0xe5, 0xd9, 0x0c, 0xeb, 0x1c, 0xcb, 0xfe, 0xfa, 0x27, 0x01, 0xc7, 0x05,
-  0xfe, 0x16, 0x12, 0x0b, 0xf1, 0x27, 0xe2, 0xef, 0xf1, 0xe6, 0xff, 0xda,
-  0xbe, 0xef, 0xff, 0x26, 0x34, 0x27, 0xe2, 0xfe, 0xf3, 0x13, 0xf1, 0xe8,
-  0x16, 0x25, 0xed, 0x10, 0xeb, 0x37, 0xe0, 0x12, 0x1e, 0xfd, 0x33, 0x2f,
-  0x05, 0x02, 0xc5, 0xc8, 0x08, 0xeb, 0x00, 0x28, 0x14, 0xc7, 0x19, 0x2f,
-  0xc5, 0xe9, 0x35, 0xe6, 0xff, 0xde, 0xeb, 0xe2, 0x07, 0x21, 0x14, 0x0d,
-  0x36, 0x12, 0xd9, 0xe7, 0xe9, 0x07, 0xd4, 0xf2, 0xec, 0x06, 0xf7, 0xe1,
-  0xef, 0x0b, 0xe0, 0xee, 0x18, 0xf7, 0xd5, 0xff, 0x18, 0x36, 0xa8, 0x1e,
-  0xe0, 0x0e, 0xeb, 0xe0, 0xfc, 0x1e, 0xe3, 0x0f, 0xe9, 0x0f, 0x21, 0xe4,
-  0xe6, 0x0d, 0x25, 0x07, 0x3d, 0xd0, 0xe3, 0xfd, 0xd6, 0x21, 0xcb, 0x18,
-  0xea, 0xff, 0x0f, 0x1d, 0xeb, 0x12, 0xf9, 0x0f, 0xba, 0xec, 0xf7, 0xf3,
-  0xee, 0x09, 0x2b, 0x0a, 0xf2, 0xcf, 0xf7, 0xf2, 0x08, 0xc2, 0x1a, 0xfb,
-  0xf1, 0x1c, 0x05, 0xf7, 0x2e, 0x0d, 0xf4, 0xe2, 0xdc, 0xe6, 0xf7, 0x28,
-  0xde, 0x1e, 0xe2, 0xe0, 0xd8, 0x21, 0xe1, 0x33, 0x13, 0xf6, 0xff, 0x1e,
-  0xe4, 0xdb, 0x12, 0xf5, 0xec, 0x41, 0x1c, 0x15, 0x0e, 0x05, 0x2d, 0xf4,
-  0xee, 0xee, 0xbf, 0xfe, 0x1f, 0x21, 0xef, 0x74, 0xf0, 0xf4, 0xde, 0xfe,
-  0xfb, 0xc7, 0xc7, 0xad, 0x0f, 0x1f, 0xfc, 0xcf, 0x1a, 0xdb, 0xdc, 0x08,
-  0xad, 0xf0, 0x2b, 0x28, 0x36, 0x1d, 0xff, 0xdf, 0xc9, 0xbf, 0x1c, 0xe2,
-  0xc9, 0x07, 0xe9, 0x0e, 0x32, 0xf0, 0xdc, 0x0a, 0xf9, 0xf9, 0xf0, 0x00,
-  0x23, 0xe5, 0xe5, 0xde, 0xd7, 0x47, 0xff, 0xf9, 0x27, 0xde, 0x43, 0x27,
-  0xf7, 0x0f, 0xf5, 0xe6, 0x3a, 0x12, 0x1b, 0x66, 0x50, 0xdb, 0xcc, 0x5c,
-  0xc9, 0xe4, 0x1e, 0x0e, 0x00, 0xd0, 0xd3, 0xf4, 0xfd, 0x4c, 0x22, 0x0c,
-  0x24, 0xd8, 0xdb, 0xda, 0xe6, 0xea, 0xcc, 0x0f, 0x1e, 0x06, 0x04, 0xd0,
-  0x29, 0xe2, 0xe7, 0xf7, 0xdd, 0xe0, 0xe4, 0x02, 0xf1, 0x2c, 0xef, 0x0f,
-  0xeb, 0x03, 0xd7, 0xd4, 0x38, 0x27, 0xe8, 0x04, 0xe8, 0x22, 0x49, 0xf5,
-  0x05, 0xf8, 0x38, 0xe0, 0xf7, 0xd8, 0xef, 0x24, 0x35, 0x3b, 0xe4, 0x64,
-  0x0d, 0x1a, 0xe1, 0x49, 0xd3, 0x18, 0x06, 0x24, 0xf1, 0xcd, 0xe1, 0xf5,
-  0x16, 0x30, 0x46, 0x00, 0xf9, 0xcb, 0xcd, 0xd1, 0xd4, 0xb8, 0xee, 0x19,
-  0x5a, 0xc8, 0xff, 0xf8, 0xdf, 0xda, 0xf1, 0x0a, 0xb1, 0xe9, 0xf6, 0x08,
-  0xfd, 0x24, 0xe1, 0xdf, 0xe9, 0x1e, 0xf0, 0xf5, 0x33, 0x26, 0xd7, 0x17,
-  0x12, 0xf9, 0x14, 0xe7, 0xd9, 0x3b, 0x1a, 0xda, 0xf4, 0x08, 0x1c, 0xfa,
-  0x3a, 0x19, 0xdb, 0x45, 0xdd, 0xed, 0x2f, 0x56, 0xe3, 0x13, 0x0f, 0x04,
-  0x23, 0xd6, 0xde, 0x01, 0xb1, 0xd5, 0x5b, 0xdf, 0xef, 0x13, 0x16, 0xd6,
-  0x1e, 0xd5, 0xf2, 0xff, 0x14, 0x27, 0xa8, 0xeb, 0xe7, 0xb3, 0xe0, 0xa3,
-  0xe5, 0x2a, 0x12, 0xe0, 0x0f, 0x3a, 0xb3, 0x22, 0xf7, 0xb9, 0xe0, 0x29,
-  0xfe, 0xf3, 0xd8, 0xf2, 0xef, 0xc4, 0x1b, 0x29, 0x24, 0x09, 0x1a, 0x46,
-  0x39, 0xf5, 0x35, 0x42, 0x3a, 0x0b, 0x05, 0xcc, 0x0f, 0x38, 0xd4, 0xfb,
-  0xd4, 0x02, 0x24, 0xf6, 0x10, 0xd9, 0x07, 0x37, 0xf1, 0xd5, 0x27, 0xe1,
-  0x27, 0x19, 0xb3, 0xc3, 0x0c, 0x23, 0xc6, 0x2a, 0x23, 0x1c, 0xdf, 0x00,
-  0xe9, 0xa2, 0x09, 0xc2, 0xf0, 0x3a, 0xe0, 0x17, 0xe5, 0x2b, 0xb1, 0x3a,
-  0x03, 0xd1, 0xfa, 0x32, 0x0f, 0x4b, 0xca, 0x5c, 0xda, 0xed, 0x32, 0x1a,
-  0xff, 0x02, 0x1d, 0x5d, 0x14, 0x36, 0x20, 0x1f, 0x13, 0xd4, 0xe1, 0xb6,
-  0x25, 0xf6, 0xf7, 0x51, 0xa4, 0xf0, 0xe4, 0xb9, 0x1a, 0xc1, 0x07, 0x4d,
-  0x8f, 0x15, 0x3d, 0xe6, 0x38, 0x08, 0x12, 0xd1, 0x21, 0xd6, 0xdd, 0x27,
-  0xe2, 0x29, 0xbb, 0xde, 0xc3, 0xaa, 0xfb, 0xc2, 0x1e, 0xcc, 0xf5, 0x0f,
-  0x06, 0x10, 0xc7, 0x22, 0x0f, 0xd2, 0x0c, 0x1d, 0xe2, 0x43, 0xde, 0x1a,
-  0xeb, 0xde, 0x47, 0x14, 0x14, 0xdd, 0x21, 0x29, 0x17, 0xfd, 0xd3, 0x0b,
-  0xf7, 0xd5, 0x23, 0xcd, 0xd9, 0xe9, 0x01, 0x4f, 0xe6, 0xca, 0x0e, 0x4b,
-  0x31, 0x29, 0xe4, 0xff, 0x30, 0xe0, 0x11, 0xd4, 0xd2, 0xbb, 0xd7, 0x33,
-  0x68, 0xf2, 0x41, 0xdc, 0x04, 0xfd, 0x34, 0x31, 0xd6, 0xdf, 0x00, 0xd8,
-  0xef, 0x45, 0x36, 0x31, 0xf2, 0xf7, 0x12, 0xf7, 0xbb, 0xbb, 0x20, 0x3a,
-  0x35, 0xfb, 0xc3, 0x0c, 0x2f, 0xf5, 0xbc, 0x2e, 0x4f, 0x32, 0xfb, 0xfe,
-  0x05, 0xf1, 0x2f, 0xe7, 0xdd, 0x1c, 0x18, 0x24, 0x04, 0xd7, 0xf9, 0x24,
-  0xda, 0xe0, 0x0b, 0x0d, 0x59, 0xbd, 0xea, 0xf3, 0xfd, 0x1f, 0x28, 0xf1,
-  0xe6, 0x03, 0xcf, 0x00, 0x1f, 0x1f, 0xcd, 0x1d, 0xde, 0xfe, 0x07, 0xe8,
-  0xfe, 0xe2, 0x2d, 0xf0, 0xdf, 0x24, 0xdc, 0x1c, 0xe2, 0xf5, 0xe1, 0x09,
-  0xf5, 0xd1, 0x08, 0x36, 0x40, 0x13, 0x0e, 0x38, 0x0a, 0xf6, 0x81, 0x1a,
-  0x39, 0x48, 0x1f, 0x26, 0xee, 0xdc, 0x23, 0xdc, 0xf5, 0xe4, 0xdc, 0x1e,
-  0x5e, 0x06, 0x10, 0x33, 0xe9, 0xfc, 0xfd, 0xe7, 0x25, 0xc6, 0x00, 0xdd,
-  0x23, 0x31, 0xfc, 0x10, 0x40, 0xd9, 0xf3, 0xc8, 0x24, 0xdf, 0x2a, 0x24,
-  0xdb, 0xe4, 0x24, 0xf0, 0xd1, 0xe3, 0x39, 0x24, 0x3d, 0xee, 0xda, 0xec,
-  0xe2, 0xf6, 0xa9, 0xea, 0x0f, 0xec, 0x3f, 0x04, 0x12, 0x05, 0xec, 0x25,
-  0x20, 0xde, 0x02, 0xe2, 0x1e, 0x00, 0x1e, 0x2d, 0xef, 0xd8, 0xf6, 0xbb,
-  0xe8, 0x01, 0x10, 0x01, 0x0e, 0x41, 0xc1, 0xf2, 0x03, 0x15, 0x25, 0x4f,
-  0x1e, 0x2b, 0xce, 0xac, 0x66, 0x13, 0xf8, 0xc5, 0x0c, 0xf4, 0xe6, 0xf9,
-  0xde, 0xde, 0x53, 0x11, 0x3d, 0x2d, 0xc5, 0x16, 0x39, 0xcf, 0xfa, 0xc1,
-  0x21, 0x0e, 0x3f, 0x0b, 0x44, 0x0c, 0x3f, 0xc6, 0xdc, 0xf3, 0x4e, 0x14,
-  0xe3, 0xd3, 0x02, 0x4f, 0x2a, 0x1c, 0xf4, 0x28, 0x0c, 0x1d, 0x27, 0xda,
-  0xe9, 0xfc, 0xca, 0xf1, 0xd1, 0xd6, 0xe3, 0x2b, 0x1b, 0x10, 0xfb, 0x21,
-  0xe3, 0x03, 0x09, 0x45, 0x17, 0x00, 0xf8, 0xd7, 0x60, 0x3e, 0x0d, 0x97,
-  0xec, 0xe2, 0xdb, 0xdd, 0xd7, 0xcb, 0x43, 0x07, 0x25, 0x10, 0xd5, 0x09,
-  0x26, 0xea, 0xfc, 0x0e, 0xfc, 0xee, 0x09, 0xbc, 0x31, 0xfb, 0x2f, 0xcf,
-  0x18, 0xed, 0x26, 0x19, 0x18, 0xea, 0x11, 0x2e, 0x21, 0xf7, 0xf1, 0x13,
-  0xf5, 0x0e, 0xe6, 0xe6, 0x18, 0xc8, 0xfe, 0xf2, 0xe0, 0x10, 0xa1, 0xf7,
-  0x52, 0x03, 0xc3, 0xe6, 0x05, 0x2c, 0xe8, 0x27, 0x08, 0x12, 0xd8, 0x06,
-  0x2b, 0xe0, 0xe4, 0xe1, 0x31, 0xc6, 0xd0, 0xc0, 0xb2, 0xbe, 0x22, 0xf6,
-  0x38, 0xee, 0x08, 0xf6, 0x3c, 0xf2, 0xe2, 0x1b, 0x18, 0x0b, 0xcd, 0xc8,
-  0xf7, 0x03, 0x2b, 0xef, 0x15, 0xfe, 0x10, 0xff, 0xed, 0x04, 0x1b, 0x4b,
-  0x34, 0xdf, 0xfd, 0xc8, 0xf4, 0xbb, 0x06, 0x12, 0xf2, 0xb2, 0x0c, 0xff,
-  0xd7, 0xf9, 0x8b, 0x26, 0xfd, 0xf1, 0x00, 0xc3, 0xe7, 0xec, 0xf8, 0xfe,
-  0xf2, 0x04, 0x3a, 0xf6, 0x15, 0x26, 0x08, 0xe2, 0x1e, 0x30, 0x01, 0x0e,
-  0x07, 0x21, 0xd6, 0x1f, 0xa8, 0x1c, 0x19, 0x0f, 0x2a, 0xe2, 0xf9, 0xef,
-  0x0d, 0x04, 0xf6, 0xf8, 0xdc, 0x2a, 0xf6, 0xd3, 0x09, 0xe5, 0xd8, 0xef,
-  0xfb, 0xe0, 0x1c, 0x10, 0x17, 0xe4, 0xc1, 0x01, 0x16, 0xc5, 0x05, 0x8c,
-  0xe7, 0xf6, 0xf1, 0xb2, 0x0c, 0x0e, 0xfc, 0xfd, 0x0d, 0x5e, 0xed, 0xd0,
-  0xf4, 0x27, 0xbc, 0xfc, 0xfd, 0xfd, 0x59, 0x81, 0x34, 0xd6, 0xde, 0x19,
-  0xf1, 0x2c, 0x0d, 0x26, 0xce, 0xfd, 0xd3, 0xcc, 0xed, 0x39, 0x12, 0x0c,
-  0x2e, 0xdf, 0xf4, 0xc2, 0x1d, 0xda, 0xe3, 0xba, 0x10, 0xe7, 0xdc, 0xa7,
-  0x01, 0xea, 0x20, 0xde, 0x23, 0xb8, 0x06, 0xf8, 0x0d, 0x12, 0xc9, 0xf1,
-  0x1d, 0x8c, 0x40, 0xa1, 0x1b, 0x53, 0xe6, 0xc6, 0xae, 0xe6, 0xc0, 0x1a,
-  0x15, 0x38, 0x05, 0xd3, 0xf0, 0xf7, 0xe7, 0xff, 0x04, 0xd9, 0x1c, 0xb8,
-  0x1b, 0x0d, 0xe1, 0x14, 0xef, 0x10, 0x02, 0x03, 0xfb, 0x11, 0x0a, 0xf5,
-  0x40, 0x1a, 0x25, 0xac, 0x1e, 0x05, 0xfd, 0xce, 0x19, 0x0b, 0x01, 0xf2,
-  0x45, 0xd3, 0x1c, 0xe9, 0x0b, 0x18, 0x72, 0xfe, 0xe3, 0x1a, 0xda, 0xe0,
-  0x36, 0x19, 0x11, 0x47, 0x34, 0xab, 0x13, 0xf0, 0xfa, 0x3f, 0xfd, 0xe5,
-  0x1b, 0x04, 0xe6, 0xfe, 0xe0, 0xf1, 0xe6, 0xfc, 0xf0, 0xcb, 0xde, 0xea,
-  0xfa, 0xff, 0x0d, 0xea, 0xfd, 0xfe, 0x2e, 0xd3, 0x05, 0xf7, 0xca, 0xf0,
-  0x49, 0x1f, 0xd4, 0x30, 0xc8, 0xea, 0xec, 0x76, 0x15, 0xf1, 0xd4, 0xf2,
-  0xee, 0xca, 0x1d, 0x21, 0xdd, 0xfc, 0xef, 0x36, 0x18, 0x13, 0x33, 0xf1,
-  0x02, 0x1b, 0x03, 0xe4, 0x08, 0xdf, 0x05, 0x27, 0x0f, 0x18, 0xdb, 0x9b,
-  0xdc, 0xfe, 0x26, 0x2d, 0x15, 0xf2, 0x2a, 0xd3, 0xee, 0x08, 0xe1, 0xf7,
-  0x32, 0x10, 0xc2, 0x0f, 0xf0, 0xe5, 0xc9, 0x08, 0x3d, 0xf1, 0xfd, 0xde,
-  0xe5, 0x35, 0xc9, 0x00, 0x2a, 0x03, 0xcc, 0xf5, 0xd7, 0x1f, 0x11, 0x17,
-  0xed, 0xcb, 0xa6, 0xb7, 0x0a, 0xaf, 0xb9, 0xb1, 0xc1, 0xf4, 0xcb, 0xf3,
-  0x0b, 0xbc, 0x19, 0x04, 0x4c, 0x0b, 0xed, 0x00, 0xe5, 0x2d, 0x19, 0xcf,
-  0x74, 0x02, 0xdc, 0xa7, 0x13, 0x15, 0x06, 0x40, 0xb3, 0x00, 0xd9, 0xcf,
-  0x2b, 0x03, 0xec, 0xfb, 0xff, 0xe0, 0xfd, 0x2f, 0xf9, 0xfa, 0x19, 0x2e,
-  0x7e, 0xee, 0x17, 0xec, 0xd4, 0x07, 0xd2, 0xda, 0x1b, 0x36, 0xf9, 0x0f,
-  0x29, 0xef, 0x18, 0xb6, 0xd7, 0x1d, 0xe4, 0xd8, 0x15, 0x89, 0xbd, 0x07,
-  0xdd, 0x1d, 0x1d, 0x05, 0x31, 0x22, 0x59, 0xe1, 0x35, 0x3e, 0x98, 0xff,
-  0x28, 0x14, 0x2f, 0xe4, 0x24, 0xdb, 0xb4, 0x08, 0xf4, 0x05, 0x4f, 0x69,
-  0x2c, 0xf6, 0xe0, 0xeb, 0x08, 0x1d, 0xcc, 0x39, 0xf9, 0xfa, 0xfa, 0x22,
-  0x3a, 0x32, 0x21, 0xcf, 0x04, 0xd6, 0x04, 0x43, 0x25, 0x17, 0xf6, 0xb1,
-  0xf3, 0xe7, 0x14, 0xf5, 0xf4, 0xc6, 0xba, 0x1c, 0xd8, 0x0d, 0x16, 0x2b,
-  0xdd, 0x1d, 0x03, 0x3d, 0x09, 0xa2, 0xe1, 0x0f, 0x29, 0x19, 0xd9, 0xed,
-  0xda, 0xfe, 0xc8, 0x0c, 0xed, 0xe3, 0xf9, 0x35, 0xcc, 0x0e, 0xeb, 0x0b,
-  0xd1, 0xfb, 0xff, 0xd9, 0x05, 0xb4, 0x32, 0x01, 0x00, 0xe2, 0xd8, 0xef,
-  0xfa, 0xc5, 0xdd, 0x20, 0xec, 0x35, 0xe3, 0x15, 0xfb, 0x11, 0x19, 0xee,
-  0xee, 0x45, 0x0f, 0x1c, 0xff, 0xfa, 0x24, 0x23, 0x15, 0xdd, 0xc5, 0xeb,
-  0xcd, 0xff, 0xcb, 0xf7, 0xe5, 0xf7, 0xec, 0xf4, 0x01, 0xef, 0x05, 0xf1,
-  0x05, 0xa9, 0xc0, 0x01, 0x17, 0x20, 0xd7, 0x10, 0xd5, 0xee, 0xea, 0x0c,
-  0xfa, 0x53, 0xf3, 0x03, 0x0b, 0xdb, 0xdb, 0xe4, 0xc7, 0x12, 0x3c, 0xd0,
-  0x3a, 0x07, 0xd8, 0x1f, 0xf5, 0xf4, 0x0d, 0x00, 0xff, 0x0d, 0x03, 0x3a,
-  0x02, 0x3a, 0x05, 0xf0, 0xce, 0xe7, 0xee, 0xe8, 0x06, 0x08, 0xf4, 0x04,
-  0x2b, 0xe5, 0xed, 0xbc, 0xf6, 0x18, 0x10, 0xe5, 0x21, 0x16, 0xb3, 0x10,
-  0xdd, 0x34, 0x15, 0x01, 0x0b, 0x2f, 0x13, 0xf3, 0x0b, 0x1a, 0xd0, 0xf8,
-  0xce, 0x04, 0xfc, 0xf8, 0xe8, 0x60, 0xe8, 0x11, 0xf1, 0x00, 0x21, 0x19,
-  0x3d, 0xfd, 0x4c, 0xdf, 0x08, 0xdf, 0xe1, 0x19, 0x1d, 0xce, 0x18, 0xfc,
-  0x0d, 0x02, 0xf6, 0x02, 0xd3, 0x47, 0xe3, 0x05, 0x3d, 0x1a, 0xaa, 0xdb,
-  0x1f, 0xe9, 0x12, 0xaf, 0x13, 0xd0, 0x00, 0x0b, 0xd4, 0xe6, 0xd4, 0xd5,
-  0xfd, 0x19, 0x0b, 0xfd, 0x29, 0xe5, 0xe9, 0xfb, 0x15, 0x0f, 0xf5, 0x34,
-  0x03, 0xc2, 0x06, 0x15, 0xdf, 0x1e, 0xb6, 0xd8, 0xf3, 0x2d, 0x54, 0xf4,
-  0xda, 0x20, 0x0f, 0xb6, 0xe4, 0xde, 0xca, 0x14, 0xf1, 0x02, 0xb0, 0x2c,
-  0xf9, 0xe0, 0x0a, 0x17, 0x19, 0x1d, 0xd2, 0xfc, 0xd2, 0x46, 0xf7, 0x7f,
-  0xfe, 0x06, 0xf0, 0xfb, 0x38, 0x0c, 0xda, 0xe5, 0xc8, 0xfc, 0xcf, 0x35,
-  0xfd, 0x03, 0xf4, 0xe9, 0x04, 0xfe, 0xee, 0xcd, 0xf9, 0x21, 0x29, 0xde,
-  0x10, 0x34, 0x1f, 0x23, 0x05, 0xec, 0xe4, 0x17, 0xfe, 0xe5, 0xdc, 0xbb,
-  0xf4, 0x23, 0x37, 0x26, 0xda, 0x0a, 0x0f, 0xc0, 0xf5, 0xff, 0xf5, 0x0e,
-  0xe8, 0x24, 0xd7, 0xe1, 0xf8, 0xfc, 0xfa, 0xdc, 0x0a, 0x04, 0xf0, 0xc9,
-  0xe2, 0x14, 0x31, 0x05, 0x14, 0xf2, 0xdb, 0xdf, 0xbe, 0x17, 0x53, 0xc8,
-  0x0d, 0x13, 0xee, 0xfb, 0xf6, 0xeb, 0xfb, 0xc6, 0x0b, 0x37, 0xd6, 0xcb,
-  0x11, 0xcc, 0x3e, 0xc1, 0xc0, 0xf4, 0xf6, 0xf7, 0x01, 0xcf, 0xf5, 0x47,
-  0xe3, 0x11, 0xaf, 0xed, 0x30, 0xc2, 0x19, 0x1c, 0x04, 0x15, 0xf7, 0xbb,
-  0xf5, 0xd5, 0xf7, 0x2f, 0x03, 0x05, 0xfb, 0x0f, 0x0a, 0x1d, 0x25, 0xdd,
-  0x34, 0x04, 0xc5, 0xe9, 0x26, 0xc8, 0xcf, 0xf2, 0x1b, 0xfc, 0x0d, 0xed,
-  0xc6, 0xe9, 0x32, 0xf2, 0xfe, 0xe3, 0x44, 0xd2, 0x0f, 0x23, 0xeb, 0xc2,
-  0x07, 0x20, 0xcb, 0xf4, 0xfd, 0xc8, 0x19, 0x1b, 0xff, 0x25, 0xde, 0x50,
-  0xf1, 0xfe, 0x21, 0x27, 0xc9, 0x10, 0xf2, 0xfd, 0xc0, 0xe8, 0x24, 0x39,
-  0x42, 0x18, 0xed, 0x1f, 0x06, 0xff, 0x23, 0x1d, 0xd4, 0xa1, 0xdb, 0xf9,
-  0x02, 0x27, 0x0e, 0xf5, 0x4b, 0xf6, 0xdb, 0x0c, 0xde, 0xf2, 0x08, 0x30,
-  0x16, 0xd2, 0x42, 0xf6, 0xc0, 0x14, 0xce, 0x29, 0xaa, 0xf7, 0x1a, 0xc0,
-  0x26, 0xc6, 0xb6, 0xf5, 0x18, 0x25, 0xef, 0xe8, 0x47, 0xd1, 0x50, 0x03,
-  0x00, 0xd9, 0x22, 0x12, 0xe3, 0xee, 0x2f, 0x1c, 0xfe, 0xfa, 0xe4, 0xd8,
-  0xdf, 0x1d, 0x06, 0xf5, 0x40, 0xf7, 0x16, 0x01, 0xf0, 0xd9, 0x1d, 0x13,
-  0xe7, 0xe2, 0xf2, 0xe0, 0xea, 0xf8, 0x0f, 0xd9, 0x37, 0x23, 0xec, 0xee,
-  0xd7, 0xfc, 0x1a, 0x21, 0x1f, 0xdc, 0x1a, 0xc0, 0xd6, 0x1a, 0x34, 0xe3,
-  0x10, 0x22, 0x44, 0xbb, 0xfe, 0xc4, 0xf0, 0xf1, 0x47, 0xe8, 0xca, 0xc7,
-  0xfc, 0xc1, 0x14, 0xec, 0xb3, 0xf8, 0xe0, 0x14, 0xf9, 0xe6, 0x53, 0x20,
-  0x2a, 0x29, 0xec, 0xdf, 0x0d, 0x15, 0x08, 0xfa, 0x19, 0x2c, 0xed, 0x2b,
-  0x08, 0xfd, 0xef, 0x0d, 0xe8, 0x0d, 0xc1, 0x51, 0x29, 0x15, 0x18, 0xf7,
-  0x4b, 0xe7, 0xfa, 0xea, 0x47, 0x00, 0x14, 0xf4, 0x16, 0xc3, 0x18, 0xe5,
-  0xca, 0x11, 0x30, 0x1e, 0x0c, 0xf1, 0x08, 0xd9, 0xe4, 0x29, 0x39, 0xe7,
-  0x22, 0x15, 0xd6, 0x36, 0x12, 0xe4, 0x13, 0x3a, 0xf6, 0x10, 0xf8, 0xe4,
-  0xd9, 0xbd, 0x14, 0xee, 0xdd, 0x05, 0xff, 0xd0, 0xe0, 0x1d, 0xfa, 0xee,
-  0x3f, 0xdd, 0xf6, 0x3f, 0xd4, 0x33, 0x3b, 0xf7, 0xdc, 0xf5, 0xd9, 0x1c,
-  0xc1, 0x1d, 0x39, 0x07, 0x2b, 0x1c, 0xec, 0xd3, 0x2b, 0x13, 0x10, 0x19,
-  0x34, 0xaa, 0x29, 0xe5, 0xda, 0x04, 0xf8, 0x20, 0xea, 0xf0, 0xeb, 0xe6,
-  0xdf, 0xdf, 0xe9, 0x01, 0x3d, 0x0a, 0x10, 0xee, 0x2a, 0x05, 0x16, 0x34,
-  0x07, 0xd4, 0x17, 0xe7, 0xef, 0xd2, 0xf4, 0xdb, 0xee, 0xeb, 0x14, 0xf5,
-  0xc7, 0xd6, 0x11, 0x02, 0x67, 0xbc, 0xeb, 0x6f, 0xef, 0x03, 0x23, 0xe3,
-  0x05, 0x24, 0xbf, 0xee, 0x0f, 0xbd, 0x0d, 0x03, 0x08, 0xb8, 0xff, 0xac,
-  0xe1, 0xf3, 0x22, 0x22, 0x4d, 0xcb, 0x1a, 0x08, 0x09, 0xe4, 0x3c, 0xe7,
-  0xe6, 0x2c, 0x1c, 0x0f, 0x04, 0x32, 0x23, 0x14, 0x3b, 0xe1, 0xe8, 0xff,
-  0xfa, 0xe3, 0x14, 0x1b, 0x36, 0xf2, 0xe1, 0x09, 0xd5, 0xaf, 0x0b, 0xdf,
-  0xf3, 0xf7, 0x02, 0xb2, 0xd0, 0x96, 0x3c, 0xd9, 0x2f, 0xf3, 0xf1, 0xed,
-  0x10, 0x38, 0xfa, 0x13, 0xc4, 0x29, 0x17, 0x39, 0x08, 0xe4, 0x09, 0x18,
-  0x0a, 0xee, 0x0b, 0x06, 0x69, 0xfd, 0xc6, 0xf0, 0xe0, 0xe3, 0x2e, 0xb0,
-  0x25, 0x07, 0x3b, 0x25, 0xe1, 0x2f, 0x14, 0x05, 0x3c, 0x39, 0xf5, 0x03,
-  0x1b, 0xf4, 0xf2, 0xc7, 0xf3, 0xca, 0xd6, 0x1e, 0x18, 0x5a, 0xa9, 0x5c,
-  0x23, 0x1d, 0xcd, 0xdb, 0xea, 0xe4, 0x2b, 0xf2, 0xc9, 0xcc, 0x1b, 0x0e,
-  0xf0, 0xdb, 0x46, 0x67, 0xc4, 0x06, 0x15, 0x64, 0x81, 0xfb, 0x01, 0x1e,
-  0x04, 0x38, 0x35, 0xb6, 0xd3, 0xdb, 0x4c, 0x05, 0x1d, 0x16, 0xe2, 0xc5,
-  0x04, 0xce, 0x08, 0xaf, 0x27, 0x34, 0x45, 0x4a, 0x1d, 0x18, 0x47, 0xf7,
-  0xfb, 0x2d, 0x2d, 0xed, 0xf7, 0xb9, 0x20, 0xcb, 0xf4, 0x3f, 0x09, 0xec,
-  0xe2, 0x05, 0xda, 0x1d, 0xe7, 0x14, 0x2e, 0xf6, 0xe4, 0xe2, 0xa6, 0xfe,
-  0xea, 0x5f, 0x32, 0x06, 0x33, 0x05, 0x40, 0x0b, 0x39, 0xad, 0x0b, 0x5c,
-  0xb1, 0x1a, 0x14, 0x21, 0x00, 0x4b, 0xee, 0xec, 0x0e, 0x03, 0xe6, 0xd2,
-  0x2f, 0xc2, 0xf2, 0xd3, 0xc4, 0xa9, 0xfe, 0x36, 0x14, 0x10, 0x36, 0xf8,
-  0xf9, 0xcc, 0x35, 0x17, 0x12, 0x3a, 0x39, 0x31, 0x2e, 0xfc, 0x02, 0xd1,
-  0xa4, 0xaf, 0x06, 0x00, 0xfd, 0x07, 0xaf, 0xc4, 0xd7, 0xb8, 0x1d, 0xf4,
-  0xc8, 0xe3, 0xd7, 0xe9, 0xe1, 0x50, 0x3f, 0xdb, 0x3c, 0xdd, 0xe7, 0x42,
-  0xd5, 0xe5, 0xe2, 0x70, 0xb6, 0x07, 0xf5, 0x29, 0xf2, 0xc8, 0xe0, 0x0d,
-  0x08, 0x00, 0xec, 0xc5, 0x4f, 0xc8, 0xfd, 0x11, 0xcb, 0x27, 0x2c, 0xaa,
-  0x35, 0xd6, 0x58, 0xea, 0xea, 0x04, 0x0e, 0xf3, 0x15, 0xfe, 0x29, 0xd5,
-  0x03, 0xea, 0xfa, 0xe4, 0x1b, 0x1d, 0xd0, 0x07, 0xed, 0x41, 0xdd, 0x36,
-  0x65, 0xde, 0x02, 0x14, 0x25, 0xf1, 0x27, 0xe9, 0xd5, 0x0e, 0x1d, 0x46,
-  0xe3, 0xea, 0x42, 0x0c, 0xe7, 0x2b, 0x25, 0x2b, 0xa9, 0xde, 0xe8, 0x10,
-  0xd6, 0x06, 0xd3, 0xa9, 0xf9, 0x07, 0xc9, 0xfe, 0x34, 0x06, 0x08, 0xfc,
-  0x27, 0x15, 0xd5, 0xbe, 0xb0, 0x31, 0x18, 0x51, 0x04, 0xe9, 0x1b, 0x07,
-  0xfd, 0xf5, 0x0a, 0xc3, 0xfc, 0x0d, 0x00, 0x11, 0x35, 0x3d, 0xdf, 0xdc,
-  0xc0, 0xf9, 0x08, 0xf8, 0x1d, 0xec, 0x24, 0xf5, 0x19, 0xe6, 0xed, 0xed,
-  0x01, 0x22, 0x2a, 0xf5, 0x02, 0x0b, 0x20, 0xee, 0x4a, 0x1e, 0x09, 0xe7,
-  0xc5, 0x02, 0xcf, 0x23, 0xe2, 0x63, 0xfd, 0xe1, 0x29, 0x04, 0xdc, 0x09,
-  0x43, 0xf9, 0xff, 0x1b, 0x07, 0x02, 0xf2, 0xf4, 0xd0, 0xf1, 0x4d, 0x0e,
-  0xdb, 0xf4, 0x20, 0x34, 0x17, 0x08, 0x2c, 0xdb, 0x0c, 0x29, 0xc8, 0x0e,
-  0x0b, 0xb7, 0xe2, 0x17, 0xfb, 0x2b, 0x05, 0xe4, 0x23, 0xf2, 0xfd, 0x24,
-  0xeb, 0xc4, 0x09, 0xff, 0x16, 0x12, 0x3b, 0xd2, 0x4c, 0xf4, 0xc7, 0x08,
-  0x04, 0xf0, 0x02, 0x1d, 0xe1, 0xc9, 0x0f, 0x19, 0xdc, 0xcf, 0x03, 0xce,
-  0x0e, 0xfa, 0xf3, 0x9c, 0xd1, 0x1d, 0xe0, 0xf8, 0x1a, 0xfd, 0xfc, 0xd5,
-  0x45, 0x08, 0x16, 0xd1, 0x1a, 0x05, 0xd9, 0xdb, 0xf7, 0x09, 0x1c, 0x34,
-  0x45, 0xe9, 0x1f, 0x39, 0xe4, 0xd1, 0xd4, 0x1f, 0x27, 0xf7, 0xcc, 0xa2,
-  0x0e, 0x35, 0x17, 0xe5, 0xf6, 0xee, 0xe2, 0xf6, 0xf1, 0x2b, 0x37, 0x1d,
-  0xc7, 0x23, 0x42, 0x1b, 0x24, 0xcc, 0xd3, 0xf4, 0xfc, 0xbb, 0x04, 0xf8,
-  0xdf, 0x04, 0x06, 0xda, 0x15, 0xcf, 0x09, 0xfa, 0xcd, 0x42, 0x03, 0x0e,
-  0x7b, 0xea, 0xdd, 0xea, 0xef, 0x71, 0x16, 0x25, 0xfc, 0xed, 0xf4, 0x23,
-  0xfe, 0x12, 0xe8, 0xef, 0x73, 0x30, 0x19, 0x58, 0xfa, 0xfc, 0x13, 0x15,
-  0x08, 0xec, 0xd4, 0xb9, 0xe6, 0x1c, 0xe4, 0xdf, 0xfb, 0x1f, 0xfd, 0x2a,
-  0x27, 0xc3, 0x45, 0xc8, 0xef, 0x01, 0x21, 0x1e, 0x73, 0xcf, 0xe7, 0xe4,
-  0xdd, 0xe9, 0x08, 0xf7, 0xfa, 0x0d, 0x43, 0xcd, 0x0f, 0xd1, 0xf4, 0xfd,
-  0xe4, 0x08, 0xe6, 0x0c, 0x44, 0xcc, 0xdd, 0xfb, 0xe2, 0x07, 0x5c, 0xea,
-  0xda, 0x02, 0xf1, 0x2a, 0xee, 0x05, 0x53, 0xac, 0x33, 0x32, 0xfc, 0x50,
-  0xf3, 0xde, 0x13, 0x1f, 0x0d, 0x19, 0xc9, 0xc0, 0xf5, 0x04, 0xf2, 0x02,
-  0x3d, 0x11, 0xce, 0x3c, 0x03, 0xfb, 0x38, 0xd4, 0x04, 0xf2, 0xdd, 0x14,
-  0x37, 0xbe, 0x0e, 0x04, 0x1c, 0xec, 0x0f, 0x02, 0xe8, 0x07, 0xee, 0x0c,
-  0x53, 0xd3, 0xc4, 0x37, 0xc7, 0x31, 0xc3, 0xd7, 0x0d, 0x3f, 0x08, 0xf5,
-  0x21, 0x0d, 0x52, 0xf4, 0xf9, 0x25, 0xdd, 0xe1, 0xff, 0x1a, 0xf5, 0xfb,
-  0xb4, 0x45, 0xd7, 0x08, 0x47, 0xe2, 0xd9, 0xcc, 0x0c, 0xe9, 0xfb, 0x2a,
-  0x17, 0x3a, 0x03, 0x2a, 0xf9, 0xc6, 0xde, 0x0c, 0xe2, 0xdc, 0x2f, 0x47,
-  0x1f, 0x04, 0x2e, 0x13, 0x09, 0xde, 0x40, 0x1c, 0xf2, 0xf3, 0xd7, 0x2b,
-  0xfb, 0xbc, 0xf6, 0x0b, 0x6d, 0xde, 0x13, 0x02, 0xe8, 0x12, 0xdc, 0xc2,
-  0xcd, 0x2f, 0x4d, 0x09, 0xe5, 0xd3, 0x4b, 0x1d, 0xad, 0xec, 0xfd, 0xec,
-  0xb1, 0xdf, 0xec, 0x0d, 0xd1, 0x16, 0x0e, 0x03, 0x3b, 0x37, 0xf1, 0xeb,
-  0x2d, 0xcd, 0x43, 0xf4, 0x09, 0x30, 0xda, 0x3a, 0xf5, 0x03, 0xdc, 0x3b,
-  0xff, 0x2f, 0x11, 0xf7, 0xfc, 0x03, 0x14, 0x00, 0x02, 0x11, 0x00, 0xdf,
-  0xfc, 0xef, 0x0a, 0xe1, 0xf6, 0xd6, 0xf2, 0x2e, 0x5a, 0x16, 0x0c, 0xfa,
-  0xcb, 0xe3, 0x08, 0xda, 0x0f, 0x09, 0x05, 0xe0, 0xea, 0xff, 0x0f, 0x2b,
-  0xe2, 0xfb, 0xf5, 0x19, 0xf7, 0xeb, 0x07, 0x2e, 0xda, 0x04, 0x25, 0xfd,
-  0x34, 0xfe, 0xfa, 0x39, 0xfd, 0xd4, 0x57, 0xe4, 0x17, 0x47, 0xe1, 0x02,
-  0xec, 0x07, 0xe0, 0x05, 0xfa, 0x4c, 0xee, 0xdc, 0x17, 0x33, 0x29, 0xec,
-  0xf6, 0xee, 0x9d, 0xf2, 0x33, 0xf6, 0x33, 0x11, 0x2a, 0xcd, 0x1e, 0xc4,
-  0x04, 0xf0, 0xf6, 0x16, 0x01, 0x14, 0xf2, 0x0a, 0x28, 0x3b, 0x20, 0x02,
-  0x34, 0xea, 0x09, 0xd8, 0xfb, 0xef, 0x1c, 0x04, 0xd1, 0x19, 0xee, 0xf0,
-  0xeb, 0x20, 0xc8, 0x14, 0x24, 0xec, 0xc7, 0x14, 0x23, 0x0b, 0x10, 0xfb,
-  0x15, 0x06, 0xcf, 0xff, 0xe9, 0xd9, 0xe2, 0x03, 0xf4, 0xe9, 0x1f, 0xef,
-  0x11, 0xfa, 0x17, 0xf0, 0xca, 0x1b, 0xe8, 0xf5, 0xe3, 0xf2, 0x19, 0xef,
-  0x0d, 0xaf, 0x25, 0xc3, 0x26, 0x31, 0x28, 0xfd, 0x4c, 0x38, 0xed, 0xe3,
-  0xdc, 0x35, 0xea, 0xdd, 0xf5, 0xc3, 0xf5, 0x05, 0xf2, 0xf9, 0x10, 0x0c,
-  0x81, 0xd8, 0xe6, 0xb0, 0xc8, 0xcd, 0xef, 0xe5, 0x07, 0x3a, 0x06, 0xfa,
-  0x16, 0x08, 0x19, 0xb9, 0x1c, 0xe0, 0xdf, 0x2c, 0x00, 0xd6, 0x04, 0x23,
-  0x00, 0xef, 0x07, 0xfd, 0x15, 0xde, 0xfc, 0xed, 0xf5, 0x0a, 0xdb, 0xab,
-  0xee, 0x09, 0x23, 0xda, 0x25, 0xdc, 0x1d, 0xfc, 0xed, 0x0a, 0x15, 0xf3,
-  0x16, 0x23, 0x03, 0xfb, 0x04, 0x03, 0x00, 0xd9, 0x29, 0x37, 0x0b, 0xdd,
-  0x0d, 0x04, 0xe7, 0x18, 0xd2, 0xdb, 0xfa, 0xbf, 0xe2, 0xf3, 0x07, 0xfa,
-  0x18, 0x13, 0xe9, 0x14, 0x1c, 0x0c, 0xfc, 0x16, 0x00, 0x01, 0xe9, 0x1e,
-  0x14, 0xd3, 0x2e, 0xfb, 0xec, 0x51, 0x2a, 0xf8, 0xf0, 0x06, 0x11, 0x06,
-  0xfa, 0x03, 0xa1, 0xc2, 0xe5, 0xe0, 0x16, 0x31, 0x0b, 0xf8, 0x46, 0xfc,
-  0xdb, 0x12, 0xff, 0x34, 0x08, 0x19, 0xf1, 0x0c, 0x49, 0x2f, 0x09, 0x09,
-  0xd7, 0x17, 0x06, 0x1f, 0x1c, 0x29, 0x22, 0xf2, 0x09, 0x16, 0x00, 0xcf,
-  0x15, 0x03, 0xd6, 0x32, 0x18, 0xe9, 0xe7, 0x14, 0xe6, 0x26, 0xea, 0x19,
-  0x03, 0xf5, 0xea, 0xcf, 0xeb, 0xc3, 0xf4, 0x04, 0x16, 0xeb, 0x17, 0x11,
-  0x15, 0xd9, 0xf7, 0xdf, 0x14, 0x44, 0xda, 0xe3, 0xbd, 0xcb, 0xfe, 0xeb,
-  0xff, 0xcb, 0x0a, 0x09, 0xfa, 0x1e, 0x42, 0xe3, 0x42, 0x04, 0x9e, 0xfa,
-  0x2b, 0xed, 0xd5, 0xf1, 0xd7, 0xf8, 0xfc, 0x1f, 0x1d, 0xfe, 0xfe, 0x15,
-  0xe0, 0x09, 0xe5, 0xd7, 0xf7, 0xd3, 0xda, 0x15, 0x0d, 0x3e, 0xc8, 0x11,
-  0xf6, 0x07, 0x0a, 0xc5, 0xdf, 0x10, 0xed, 0xfa, 0x15, 0xd3, 0x0d, 0x11,
-  0x13, 0xf8, 0x17, 0x15, 0x3b, 0xd2, 0xe1, 0xe5, 0x35, 0x48, 0xf0, 0x0a,
-  0x97, 0xe5, 0x1d, 0x0e, 0x14, 0xd6, 0x0f, 0x15, 0xea, 0x06, 0xf3, 0xf5,
-  0x1a, 0x0c, 0xe2, 0xd9, 0xf0, 0x2a, 0xdb, 0x09, 0xf0, 0x31, 0xe2, 0xfe,
-  0x0e, 0x12, 0x28, 0x19, 0x07, 0xeb, 0xdb, 0xb2, 0xf7, 0xf8, 0xfc, 0xe7,
-  0x20, 0xf1, 0x11, 0x12, 0x25, 0x0b, 0xe9, 0x3c, 0xde, 0x1f, 0xf9, 0x0c,
-  0xef, 0xd8, 0x09, 0xd7, 0xe7, 0xfa, 0x25, 0xff, 0x06, 0xe2, 0xf1, 0xe6,
-  0x47, 0x38, 0x03, 0xf4, 0x3a, 0x08, 0xf9, 0xf8, 0xe2, 0x11, 0xe3, 0xd0,
-  0x23, 0x21, 0xfc, 0x3d, 0xef, 0x05, 0x10, 0xe2, 0xf7, 0x21, 0xe4, 0x07,
-  0xca, 0x13, 0xfd, 0x24, 0xea, 0xf3, 0xf5, 0xf2, 0x04, 0xe6, 0xf0, 0xf4,
-  0xfb, 0xd9, 0xfd, 0xf5, 0x03, 0xf1, 0xe4, 0x02, 0x0c, 0xdf, 0x07, 0xf4,
-  0x0d, 0xf1, 0x18, 0xf4, 0xe3, 0x08, 0x2d, 0x03, 0x0b, 0x06, 0x0d, 0x3b,
-  0xf0, 0x0c, 0xfc, 0x0a, 0xca, 0x03, 0x16, 0x09, 0x2e, 0xf6, 0x0f, 0xee,
-  0xe4, 0x06, 0x10, 0xec, 0xf4, 0xf6, 0xf9, 0x1c, 0xde, 0xed, 0xfc, 0x02,
-  0x0a, 0xe5, 0xed, 0xea, 0xcf, 0x03, 0xf5, 0x7f, 0xdd, 0x08, 0x00, 0xe5,
-  0xdb, 0x02, 0xf9, 0x0e, 0xe4, 0xd9, 0x18, 0xec, 0xe4, 0xdb, 0xfb, 0x0d,
-  0x11, 0x07, 0x51, 0xfc, 0xdf, 0x18, 0x16, 0xda, 0xf7, 0x05, 0x0a, 0xfa,
-  0xe6, 0xfd, 0xe3, 0x78, 0x0b, 0x34, 0x10, 0x10, 0x04, 0xfe, 0xe4, 0x18,
-  0x2d, 0xf3, 0x16, 0xfa, 0xcf, 0x04, 0x1e, 0xc3, 0x0b, 0x10, 0xf0, 0x15,
-  0xf6, 0x1d, 0x00, 0x13, 0xe4, 0xf6, 0xf9, 0xed, 0xcd, 0x06, 0xf9, 0xd2,
-  0xd5, 0x0f, 0xfd, 0xe1, 0xef, 0xf2, 0xf8, 0xe9, 0xd5, 0xf3, 0xe8, 0x0a,
-  0xf6, 0xff, 0xfa, 0x11, 0x03, 0xf7, 0x25, 0xf4, 0xdc, 0xde, 0xf7, 0xe0,
-  0xfe, 0xfe, 0x3e, 0xda, 0xf7, 0x17, 0x06, 0x4a, 0x02, 0x06, 0x0c, 0x04,
-  0xe5, 0x14, 0xf2, 0xf5, 0x0c, 0x23, 0x03, 0xdc, 0xf6, 0xee, 0x02, 0xf6,
-  0x47, 0xec, 0x0a, 0x33, 0x09, 0xf0, 0x15, 0xe7, 0xf1, 0x17, 0xe5, 0xe2,
-  0xc7, 0x00, 0x03, 0x0c, 0xec, 0xce, 0xf5, 0x03, 0x0e, 0xe9, 0x27, 0x21,
-  0xf8, 0x02, 0xe2, 0x13, 0x11, 0xfa, 0x0b, 0xee, 0x23, 0xc2, 0xdf, 0xeb,
-  0x07, 0xf6, 0x0f, 0x1b, 0x0f, 0xe7, 0xfa, 0xfd, 0x20, 0xf8, 0x20, 0x1a,
-  0x2e, 0xf7, 0xd1, 0x07, 0xea, 0x0e, 0x21, 0x05, 0xfa, 0x1f, 0xff, 0xe8,
-  0x57, 0xd0, 0x16, 0x33, 0x1d, 0xd3, 0xff, 0xe7, 0x39, 0x0f, 0xfd, 0x20,
-  0x01, 0xd8, 0xbf, 0xcd, 0xfa, 0xf3, 0x2e, 0x37, 0xe9, 0xda, 0x0c, 0x05,
-  0xf1, 0x13, 0x38, 0xf7, 0xdb, 0x17, 0x09, 0xff, 0xcb, 0xf0, 0x1f, 0xfb,
-  0x13, 0xf4, 0xee, 0xea, 0xee, 0x19, 0x1d, 0x1e, 0x11, 0xe4, 0xec, 0xbd,
-  0xf6, 0xe8, 0x0a, 0x16, 0x15, 0xda, 0xed, 0x1e, 0x05, 0xd9, 0x0a, 0x06,
-  0x19, 0x2f, 0x01, 0x01, 0x11, 0xc8, 0x07, 0x08, 0x2a, 0xd7, 0xf5, 0x19,
-  0x3f, 0x1a, 0x15, 0xed, 0xf3, 0xf6, 0xf9, 0x08, 0x07, 0xf4, 0x2a, 0x0f,
-  0xba, 0x29, 0xfe, 0xc9, 0xca, 0xf4, 0xf7, 0xf7, 0xd9, 0x0d, 0x06, 0x18,
-  0xf2, 0xe7, 0x34, 0xe9, 0xd5, 0xd8, 0xf1, 0x36, 0x17, 0xe9, 0x07, 0x0c,
-  0x05, 0x10, 0x1d, 0xd8, 0xdc, 0xf4, 0x0c, 0x23, 0xf0, 0xe9, 0x21, 0x06,
-  0x0a, 0x04, 0x28, 0x15, 0x08, 0x39, 0xf7, 0x2a, 0x09, 0xb8, 0xf8, 0x05,
-  0x1e, 0x00, 0xb0, 0x03, 0x06, 0x24, 0x40, 0x06, 0xe9, 0xfd, 0x28, 0xf1,
-  0xdf, 0xfb, 0xdf, 0x04, 0x0e, 0x00, 0xcd, 0x1a, 0xef, 0xcb, 0xfd, 0x0b,
-  0xef, 0xe7, 0xf8, 0x10, 0xdf, 0xfd, 0xfd, 0x14, 0x07, 0xea, 0xe8, 0xf0,
-  0xf5, 0x36, 0xea, 0x0d, 0x2d, 0xc9, 0x08, 0xf2, 0x19, 0x23, 0x2d, 0xdc,
-  0xfd, 0xe5, 0xd1, 0xe8, 0xec, 0x0b, 0x25, 0x3b, 0xdb, 0x2c, 0xeb, 0x03,
-  0x45, 0xe5, 0xf6, 0x21, 0x1e, 0xdc, 0xb6, 0xdb, 0x48, 0x26, 0x36, 0x4e,
-  0xea, 0xf0, 0x31, 0xdc, 0x1a, 0xf1, 0x02, 0xea, 0x03, 0xe0, 0x1e, 0x1e,
-  0xc1, 0xfb, 0x05, 0xf3, 0xea, 0xfa, 0xff, 0x3b, 0xc2, 0xfa, 0xf3, 0x12,
-  0x39, 0xfb, 0xc6, 0x06, 0xe7, 0x23, 0x28, 0x22, 0x1b, 0xef, 0xc3, 0xe3,
-  0x2b, 0xde, 0x27, 0x15, 0xce, 0xc1, 0xe1, 0x03, 0x20, 0xda, 0x12, 0x1e,
-  0x0c, 0x3a, 0xf2, 0x18, 0x3c, 0xbf, 0x01, 0x1a, 0x09, 0xf7, 0xc5, 0xd5,
-  0x36, 0x0a, 0x25, 0x20, 0xf1, 0xf9, 0x4c, 0xd1, 0x1e, 0x16, 0x0d, 0xec,
-  0xd4, 0x08, 0xd3, 0xe8, 0xe4, 0xe4, 0x07, 0xf1, 0x04, 0xd0, 0x0c, 0x01,
-  0xd8, 0xdc, 0x18, 0xef, 0xe4, 0xf3, 0xf8, 0x32, 0x0c, 0x2e, 0x0c, 0x24,
-  0x18, 0x06, 0x05, 0x11, 0xf5, 0x49, 0xf7, 0xe7, 0xdb, 0xe4, 0xe6, 0xec,
-  0xf4, 0xd9, 0xf2, 0x3d, 0x00, 0xe6, 0xf1, 0xfe, 0xf5, 0xe5, 0x26, 0x5e,
-  0xde, 0xdb, 0xdb, 0xf4, 0x16, 0xe8, 0x34, 0x0e, 0xce, 0xf7, 0xdc, 0xd9,
-  0x0e, 0xce, 0x47, 0xed, 0xc2, 0x2e, 0xdc, 0xcf, 0xf6, 0xd9, 0x53, 0xe3,
-  0xfe, 0xd9, 0x57, 0x07, 0xaa, 0xe1, 0xf4, 0x04, 0xc3, 0xa3, 0xb8, 0xf9,
-  0xcc, 0x26, 0x47, 0xe0, 0xa5, 0x1b, 0x26, 0x04, 0x07, 0x2a, 0x23, 0x26,
-  0xfe, 0x25, 0x1d, 0xfb, 0xf2, 0xd3, 0xd1, 0x24, 0x36, 0xe9, 0xfd, 0x30,
-  0xcb, 0x06, 0x20, 0xde, 0x28, 0xca, 0xed, 0x02, 0xfb, 0x0f, 0x4b, 0xf9,
-  0xfb, 0xfb, 0xe1, 0x1e, 0xd9, 0xd6, 0x66, 0x02, 0xea, 0xf9, 0x0d, 0x0e,
-  0xee, 0xdb, 0x2f, 0x02, 0x14, 0x81, 0x08, 0x18, 0x17, 0xdc, 0xfa, 0x50,
-  0xe0, 0xa3, 0x12, 0xd4, 0x06, 0xe6, 0x01, 0x5d, 0xbc, 0x0d, 0x53, 0xef,
-  0xf5, 0xdc, 0xe8, 0x53, 0xef, 0x03, 0xfa, 0x42, 0xf4, 0x28, 0xbd, 0xcc,
-  0x2a, 0xf1, 0xe5, 0x5f, 0xc7, 0xe3, 0x00, 0xed, 0x50, 0xfc, 0xdd, 0xe0,
-  0x43, 0xd8, 0xeb, 0x00, 0xf2, 0xf0, 0xd0, 0xea, 0xf0, 0xc1, 0xda, 0xf5,
-  0xf8, 0x03, 0x36, 0xef, 0xcb, 0xf1, 0x46, 0xdc, 0x02, 0x90, 0xc1, 0xec,
-  0xee, 0xda, 0xf3, 0x02, 0x01, 0xbb, 0x1c, 0xe4, 0x07, 0x05, 0x19, 0x22,
-  0x2d, 0xf7, 0x3f, 0xe9, 0x24, 0xdb, 0xa8, 0x32, 0x44, 0x36, 0xd0, 0x28,
-  0x39, 0xf3, 0xf5, 0x08, 0xd4, 0x22, 0xd8, 0x06, 0xf5, 0x17, 0xf9, 0x2c,
-  0xe9, 0xe4, 0x3a, 0x26, 0xf1, 0x07, 0xb9, 0x0a, 0xa0, 0x28, 0x13, 0xe6,
-  0xf0, 0xaf, 0xf8, 0xe0, 0x0b, 0x01, 0xec, 0xea, 0xee, 0x07, 0x0e, 0xeb,
-  0xee, 0xfe, 0x20, 0xe4, 0xd5, 0xfa, 0x3e, 0x12, 0xec, 0xdd, 0xa6, 0x7a,
-  0x1c, 0x2a, 0x1d, 0xed, 0xf9, 0xeb, 0xe5, 0x21, 0x1c, 0xf8, 0xdc, 0x34,
-  0xc6, 0x33, 0xf7, 0x16, 0xce, 0xf1, 0xe6, 0x1e, 0xdf, 0x31, 0xed, 0xfb,
-  0xf2, 0x32, 0xf1, 0xee, 0xc8, 0xd3, 0x4a, 0x5b, 0x1e, 0x13, 0xd1, 0xeb,
-  0xe5, 0xdb, 0x0b, 0x0a, 0xcf, 0x89, 0x66, 0xf9, 0x1c, 0x0e, 0x0b, 0x2e,
-  0xe7, 0xdc, 0xfd, 0xf5, 0x20, 0xda, 0x26, 0xfb, 0xec, 0xeb, 0x23, 0x1e,
-  0xf9, 0xd3, 0xc5, 0x5b, 0xfc, 0x2a, 0xfa, 0xc0, 0xe6, 0x00, 0xe7, 0xb5,
-  0x08, 0x07, 0x2c, 0x05, 0xfb, 0x18, 0xf3, 0x20, 0xff, 0x29, 0x0f, 0xf6,
-  0x0e, 0x57, 0xeb, 0x30, 0xe3, 0x0c, 0xed, 0xf0, 0x0f, 0x22, 0x13, 0x17,
-  0x51, 0xe6, 0xc8, 0x1a, 0xf9, 0x15, 0xf6, 0x1e, 0xe8, 0xc9, 0xee, 0x12,
-  0xdb, 0x01, 0x33, 0xf4, 0xb8, 0xf0, 0x18, 0x08, 0xea, 0xef, 0x17, 0xf7,
-  0xf1, 0xdd, 0xec, 0x00, 0xfc, 0x0d, 0x05, 0x12, 0xf4, 0x0f, 0xd7, 0xbe,
-  0x1d, 0xf3, 0x1c, 0xb2, 0x12, 0xed, 0x01, 0x16, 0x4d, 0x07, 0x23, 0x17,
-  0x38, 0x02, 0x1a, 0xf2, 0x01, 0xec, 0xf0, 0xd3, 0x02, 0x3a, 0xee, 0x76,
-  0xe5, 0x33, 0xf2, 0x2d, 0xc2, 0x17, 0xcb, 0x0c, 0xaf, 0x1f, 0xd0, 0xf7,
-  0x19, 0x17, 0xee, 0x08, 0xda, 0x0e, 0xe3, 0xe6, 0xa7, 0x4b, 0xcb, 0xfc,
-  0xce, 0x13, 0x46, 0xea, 0xf5, 0x09, 0x22, 0xcd, 0xf6, 0x26, 0xc7, 0x02,
-  0x21, 0xd3, 0xd7, 0xca, 0x44, 0x33, 0xfe, 0xe8, 0x1a, 0x6e, 0xf0, 0xe5,
-  0xe3, 0x1a, 0xc3, 0x47, 0x0b, 0xb3, 0x38, 0x1c, 0xdb, 0x21, 0x1d, 0xc3,
-  0xc3, 0x4b, 0xe1, 0x0f, 0xb7, 0x38, 0x03, 0x68, 0xdb, 0xce, 0xbc, 0xf4,
-  0xe7, 0xee, 0xdd, 0xdb, 0x03, 0xd8, 0x43, 0x18, 0xfa, 0x2d, 0x16, 0x2e,
-  0xc1, 0x2b, 0xec, 0x10, 0xd9, 0xfe, 0x3d, 0xed, 0xf1, 0x0b, 0x1a, 0xe6,
-  0x26, 0xe2, 0xc8, 0xe7, 0x0a, 0xf4, 0xd5, 0xd7, 0x2f, 0x16, 0xed, 0x05,
-  0x16, 0x20, 0x29, 0xc4, 0x05, 0x02, 0xdd, 0x43, 0x31, 0xfe, 0x28, 0x20,
-  0x30, 0x3f, 0x3a, 0xb6, 0x1f, 0x07, 0x3a, 0x03, 0xd7, 0xe8, 0xc3, 0xe9,
-  0xe8, 0xd0, 0xbd, 0x4f, 0xfd, 0x06, 0x06, 0xde, 0xf2, 0x0a, 0xc8, 0xe9,
-  0xee, 0x0c, 0x2f, 0x00, 0xb5, 0x25, 0xe2, 0xc0, 0x8e, 0xed, 0x0e, 0xf4,
-  0x05, 0xbe, 0x01, 0x0a, 0x11, 0xcb, 0x05, 0xdc, 0x05, 0x0a, 0xdb, 0x0c,
-  0x11, 0xf7, 0x04, 0xcd, 0x1e, 0x20, 0xe3, 0xc8, 0xfd, 0xe4, 0xe2, 0x0a,
-  0x1a, 0xd5, 0x19, 0x12, 0x46, 0xd8, 0xf5, 0xf9, 0xdb, 0x03, 0x00, 0xf0,
-  0x74, 0xe2, 0xe6, 0xe6, 0xee, 0xb4, 0xe6, 0x25, 0xd7, 0x10, 0x3a, 0xff,
-  0x19, 0xf7, 0x1d, 0xbe, 0xa7, 0x29, 0xe4, 0xd7, 0x0d, 0x2f, 0xd6, 0x01,
-  0x37, 0x04, 0xed, 0xe2, 0x29, 0x21, 0x0b, 0x2a, 0x05, 0x04, 0xcd, 0xeb,
-  0x11, 0x0a, 0xfb, 0xd1, 0xfa, 0xf9, 0x0f, 0x5c, 0x00, 0x04, 0x28, 0xfa,
-  0xf0, 0xe3, 0x3b, 0xe7, 0xfb, 0xe2, 0xc3, 0x1f, 0x10, 0xe5, 0xea, 0xf2,
-  0xdb, 0x25, 0x48, 0xfa, 0x66, 0xd7, 0x0b, 0xbf, 0xda, 0xb9, 0xc6, 0x3d,
-  0x1f, 0x08, 0xfa, 0xbd, 0xd2, 0x19, 0x04, 0x99, 0xac, 0xdd, 0x2b, 0xd3,
-  0x47, 0xf7, 0x0c, 0x11, 0x34, 0x1c, 0x06, 0xdc, 0x22, 0x25, 0x0b, 0x58,
-  0x15, 0x1a, 0xc2, 0xe0, 0xdd, 0xea, 0x1f, 0xc6, 0xbd, 0x0b, 0xd8, 0x33,
-  0xcc, 0x15, 0x14, 0xea, 0x0f, 0x0b, 0xd7, 0xf6, 0xd0, 0x01, 0xf1, 0xfd,
-  0x34, 0xf5, 0x29, 0x0e, 0x16, 0x0a, 0x1b, 0x0b, 0x37, 0xf8, 0xd0, 0xb0,
-  0xeb, 0x06, 0xb8, 0x4a, 0xe8, 0x1c, 0x50, 0xd7, 0xfd, 0x3d, 0xfd, 0xd3,
-  0xd5, 0xf4, 0xcf, 0xb7, 0xf3, 0x04, 0xca, 0xdc, 0x71, 0x1f, 0x22, 0x3a,
-  0xfb, 0x0d, 0xf1, 0x49, 0xd5, 0x18, 0xf6, 0xfd, 0xeb, 0x00, 0xfd, 0xd6,
-  0xc7, 0x1e, 0x06, 0x24, 0x00, 0x1d, 0x01, 0x1e, 0x29, 0x09, 0xef, 0x03,
-  0xc2, 0xf8, 0xff, 0xd5, 0x14, 0x1a, 0xec, 0xfa, 0xd2, 0x47, 0x25, 0x1d,
-  0x2f, 0x03, 0x00, 0xf3, 0x00, 0x01, 0xbb, 0x10, 0xfd, 0xd7, 0xe7, 0x1f,
-  0xe8, 0xf9, 0xf4, 0x4e, 0x14, 0x23, 0x15, 0x0a, 0x0b, 0xeb, 0x10, 0xd7,
-  0xdc, 0x0a, 0xe7, 0xee, 0xf1, 0x2f, 0xfa, 0x02, 0x3b, 0xf4, 0xe2, 0x13,
-  0xba, 0xd3, 0xec, 0x0b, 0xfd, 0xf3, 0x18, 0x30, 0x25, 0xe5, 0x55, 0xfd,
-  0xce, 0xd0, 0xed, 0xf3, 0xbe, 0x10, 0xb5, 0x33, 0xe3, 0xd1, 0x03, 0x1a,
-  0x01, 0x39, 0x2a, 0x3a, 0x46, 0x0e, 0xff, 0x1d, 0xbb, 0x39, 0xef, 0x26,
-  0xe2, 0xef, 0xdf, 0xc5, 0x9a, 0x1d, 0x31, 0x36, 0x11, 0xf7, 0x54, 0xc2,
-  0xf4, 0xd4, 0x04, 0x28, 0xc4, 0x03, 0xe3, 0xfa, 0xf5, 0x26, 0x14, 0x1d,
-  0x36, 0xff, 0x11, 0xe0, 0xc6, 0xcb, 0x22, 0x04, 0x01, 0xe8, 0x07, 0xe4,
-  0x02, 0xd8, 0x02, 0x39, 0xef, 0xdf, 0xa1, 0x09, 0xdb, 0x23, 0xfd, 0x49,
-  0x0d, 0x22, 0xee, 0xee, 0x01, 0x07, 0x0d, 0x38, 0xf2, 0x40, 0x11, 0xf9,
-  0xfb, 0x23, 0xdf, 0x40, 0xc7, 0x39, 0x07, 0x01, 0xdb, 0xfa, 0x2b, 0xfa,
-  0x12, 0x12, 0xf6, 0xee, 0xfa, 0xc9, 0xf6, 0xb4, 0x10, 0xfe, 0xf8, 0x0e,
-  0xd9, 0x1e, 0x20, 0xfa, 0x20, 0x11, 0x0f, 0xb6, 0xe8, 0xcc, 0x03, 0x2b,
-  0xfd, 0xce, 0xff, 0xfe, 0x05, 0xe2, 0x33, 0x40, 0x3b, 0xdc, 0xe6, 0x0f,
-  0xee, 0x32, 0xec, 0x36, 0x16, 0x69, 0x06, 0x30, 0xf2, 0xf2, 0x46, 0x16,
-  0x04, 0x15, 0xda, 0xf1, 0x7f, 0x37, 0x1c, 0x19, 0x16, 0xcd, 0x1f, 0x09,
-  0xee, 0xe9, 0x19, 0x2f, 0x0b, 0x02, 0x6d, 0xb9, 0x13, 0x22, 0x27, 0xb3,
-  0x00, 0x0d, 0xc8, 0xd0, 0x14, 0x20, 0x1a, 0xbd, 0xbe, 0xcf, 0xc0, 0x31,
-  0x08, 0xf8, 0x06, 0xfe, 0x0e, 0x4d, 0xec, 0xf9, 0x16, 0x20, 0x17, 0x34,
-  0xc9, 0xc2, 0xf1, 0xf2, 0xdb, 0x06, 0xc9, 0x03, 0x21, 0xef, 0x3d, 0x41,
-  0xf8, 0x15, 0x0e, 0x15, 0x2d, 0x2f, 0xda, 0x05, 0x43, 0xfe, 0x31, 0xd3,
-  0x38, 0xf2, 0x6a, 0x10, 0xd9, 0x59, 0x1c, 0x33, 0xd7, 0xfc, 0x54, 0x0e,
-  0x06, 0x3d, 0x0d, 0xcf, 0x22, 0xfb, 0xc3, 0x05, 0x03, 0x06, 0xfc, 0xaa,
-  0xbd, 0xb8, 0xc1, 0x0d, 0x1e, 0xd8, 0x26, 0x37, 0x3f, 0x34, 0xe6, 0xdb,
-  0x38, 0xd6, 0xc8, 0x12, 0x3c, 0xcd, 0x02, 0xed, 0x09, 0x24, 0xd9, 0x3d,
-  0x2e, 0x24, 0x05, 0xf8, 0xf7, 0xda, 0xf2, 0x02, 0xf4, 0x20, 0xe1, 0xd0,
-  0x28, 0x98, 0x28, 0x10, 0x1d, 0xcb, 0xf9, 0xef, 0xf5, 0x3d, 0x15, 0xe9,
-  0x10, 0x94, 0x35, 0x1e, 0x17, 0xf7, 0x5b, 0xcb, 0x10, 0xed, 0xfb, 0x04,
-  0xc6, 0x06, 0xe1, 0xcf, 0xe2, 0xf9, 0x9b, 0x43, 0x22, 0xfb, 0xe2, 0x3d,
-  0xfe, 0x0b, 0x8d, 0x0f, 0x17, 0xd0, 0xf3, 0x23, 0x64, 0xbb, 0x05, 0x3c,
-  0xef, 0xfe, 0xcb, 0x27, 0x41, 0x08, 0xf4, 0xe1, 0xe6, 0xed, 0x14, 0xc9,
-  0x02, 0x13, 0xd2, 0x2f, 0xbc, 0xb6, 0x38, 0x19, 0xe5, 0x18, 0x01, 0x11,
-  0xfb, 0x00, 0xd0, 0xb2, 0xf2, 0xbf, 0x38, 0xf0, 0x07, 0xa4, 0x00, 0x1d,
-  0x23, 0xff, 0xba, 0xf7, 0x10, 0xea, 0xf3, 0xfe, 0x42, 0x9d, 0x17, 0xdb,
-  0x00, 0xf4, 0x1b, 0xde, 0xe9, 0x07, 0x09, 0x0d, 0xe7, 0x08, 0x29, 0x1b,
-  0xdc, 0x39, 0x09, 0x07, 0xfa, 0x0a, 0xf2, 0xd9, 0x06, 0xfd, 0x03, 0xe4,
-  0xda, 0xde, 0x52, 0x09, 0x2d, 0x09, 0x21, 0x00, 0x09, 0xeb, 0xea, 0xf1,
-  0xdf, 0x3c, 0xda, 0xf5, 0x40, 0x23, 0xdd, 0x06, 0xfa, 0xea, 0x39, 0xf8,
-  0x51, 0x11, 0x3f, 0xe6, 0xfe, 0x05, 0xac, 0xd1, 0x35, 0xe4, 0xb6, 0xfa,
-  0x3b, 0xf6, 0xf5, 0xda, 0x20, 0x37, 0x11, 0xd1, 0xf0, 0xdc, 0xe9, 0x12,
-  0xfd, 0x2c, 0xe7, 0x12, 0x03, 0xe5, 0x27, 0xf5, 0xd0, 0xf9, 0x10, 0xf5,
-  0x0e, 0x01, 0xd0, 0xd7, 0xf6, 0x0b, 0x3c, 0x1c, 0x43, 0xf6, 0x28, 0x0f,
-  0x17, 0xe2, 0xcc, 0xe3, 0xab, 0x28, 0xc6, 0xd6, 0x1e, 0xff, 0xca, 0xed,
-  0x38, 0x2a, 0x18, 0x2a, 0x33, 0x4d, 0xf7, 0xe4, 0x4a, 0x05, 0x01, 0x0b,
-  0x29, 0xd3, 0xdd, 0xcf, 0x66, 0xf1, 0x21, 0xe8, 0x16, 0x37, 0xce, 0xe6,
-  0x11, 0xf8, 0x0b, 0x24, 0x1a, 0x1a, 0xf3, 0x00, 0xdd, 0xde, 0xf8, 0xf2,
-  0xba, 0x0a, 0x2f, 0xe7, 0x15, 0x2d, 0x15, 0xe4, 0xf1, 0xf0, 0x46, 0xda,
-  0xf0, 0x02, 0xd7, 0x00, 0xea, 0xb4, 0x5f, 0xe6, 0x25, 0x00, 0x1e, 0x29,
-  0x18, 0xe2, 0xe9, 0xea, 0xf6, 0x14, 0xf2, 0xc2, 0xd8, 0xa0, 0x13, 0x44,
-  0xfe, 0xea, 0xca, 0xf8, 0xe4, 0xd6, 0x0b, 0x2e, 0x3e, 0x05, 0x42, 0x17,
-  0x1b, 0xf9, 0x09, 0x10, 0x33, 0x04, 0x57, 0xdc, 0xf6, 0x93, 0x22, 0x31,
-  0x01, 0x18, 0x32, 0xcf, 0xeb, 0xf1, 0xd7, 0x39, 0xaa, 0xd2, 0x2a, 0x15,
-  0xf5, 0xfc, 0x0a, 0x12, 0x14, 0xdb, 0xd9, 0xfc, 0x27, 0x19, 0x24, 0xd5,
-  0x31, 0xe5, 0xfb, 0xdc, 0xfc, 0x13, 0x17, 0x10, 0x04, 0xef, 0x37, 0x00,
-  0x51, 0x2e, 0x28, 0xe9, 0x5a, 0xf2, 0xf0, 0xcf, 0xe1, 0xe0, 0x17, 0x28,
-  0x19, 0x0b, 0xe3, 0x12, 0x03, 0xf2, 0x17, 0xe7, 0x1e, 0xe9, 0x1e, 0x19,
-  0x31, 0xf7, 0xc2, 0xf7, 0x3a, 0x0c, 0x15, 0xd7, 0xfa, 0xff, 0xd3, 0x03,
-  0xeb, 0xbb, 0xd9, 0x07, 0xeb, 0x02, 0x1d, 0xfd, 0xe2, 0xe8, 0xd6, 0x1f,
-  0xfa, 0xfb, 0xdf, 0xef, 0x43, 0x1c, 0xee, 0xfc, 0x12, 0x18, 0xf2, 0x06,
-  0xe8, 0x30, 0x0f, 0xf7, 0x2e, 0x0f, 0x11, 0xd6, 0x1f, 0x1b, 0x0d, 0xbb,
-  0x32, 0xe9, 0x21, 0xe3, 0x23, 0xcf, 0xf7, 0x09, 0x32, 0x36, 0xdb, 0xed,
-  0x40, 0x1c, 0x01, 0xe5, 0x1a, 0x06, 0xd6, 0xc9, 0x13, 0x07, 0xd2, 0x99,
-  0xed, 0xfe, 0x2c, 0x0b, 0x32, 0x49, 0xf0, 0xfe, 0x01, 0xeb, 0x22, 0xf0,
-  0x01, 0xb0, 0xc2, 0xc2, 0x01, 0xf6, 0x1e, 0x00, 0x43, 0xca, 0x2f, 0x1e,
-  0x12, 0xe1, 0xe9, 0x0d, 0x25, 0x1a, 0xbd, 0xb4, 0xff, 0xcc, 0x0f, 0x13,
-  0xcf, 0xfe, 0xe2, 0x26, 0xd7, 0x25, 0xf4, 0x3b, 0xf1, 0xeb, 0x12, 0xc2,
-  0xfe, 0xc3, 0x24, 0x02, 0xeb, 0x04, 0x53, 0xe1, 0xed, 0xde, 0xeb, 0x30,
-  0x1f, 0x25, 0x2a, 0x16, 0xe0, 0xc1, 0xe9, 0x07, 0x07, 0xd4, 0xf7, 0xcd,
-  0xd0, 0x01, 0xdd, 0xf7, 0x1b, 0xcd, 0xb7, 0x15, 0x0c, 0x2a, 0x44, 0xda,
-  0x56, 0x9a, 0x4a, 0xe2, 0x17, 0x28, 0x3f, 0x08, 0x10, 0x07, 0x04, 0xe1,
-  0xfe, 0xed, 0xe0, 0xbf, 0x2b, 0xf4, 0x1b, 0x2b, 0xf1, 0x02, 0x1a, 0xea,
-  0xc5, 0xda, 0x11, 0xba, 0x07, 0xc9, 0xff, 0xe1, 0x19, 0x2c, 0x1b, 0x1f,
-  0x03, 0x0a, 0xd2, 0x20, 0x5c, 0x08, 0x10, 0xf8, 0x3c, 0xc4, 0x01, 0xdf,
-  0xfb, 0xee, 0xd5, 0xff, 0xcb, 0x10, 0xb6, 0xcd, 0xef, 0xe7, 0xcd, 0x17,
-  0x0e, 0x16, 0x21, 0xd7, 0x62, 0x01, 0x3e, 0xce, 0xc2, 0x48, 0x23, 0x40,
-  0x1c, 0x55, 0xf9, 0xda, 0x41, 0x19, 0xd9, 0xfa, 0xe8, 0x17, 0x0e, 0x06,
-  0x34, 0xd9, 0x20, 0xe7, 0x9d, 0xd3, 0x16, 0xde, 0x05, 0x22, 0x9b, 0x2c,
-  0x16, 0x38, 0xf9, 0xf3, 0x2f, 0x08, 0xd0, 0xf7, 0x17, 0xff, 0x08, 0xdc,
-  0x38, 0xa1, 0x7f, 0xd7, 0xbf, 0xfe, 0x08, 0x33, 0xf9, 0xcd, 0xf5, 0x10,
-  0x0b, 0xe9, 0xa0, 0xec, 0x18, 0xe9, 0xe0, 0x0a, 0xfc, 0x07, 0xdc, 0x46,
-  0xb9, 0xe1, 0xfe, 0x73, 0xc5, 0x20, 0x1e, 0xcf, 0x51, 0xdc, 0xe9, 0xf3,
-  0x18, 0x02, 0xd0, 0xe6, 0xf5, 0xee, 0xf8, 0xd3, 0x08, 0xe3, 0x1a, 0x11,
-  0x11, 0x04, 0xef, 0x27, 0x39, 0x22, 0x04, 0x0e, 0x6a, 0x2a, 0xeb, 0xfe,
-  0x1e, 0x0f, 0xae, 0x1b, 0xb3, 0x13, 0xff, 0x3f, 0xff, 0x0b, 0x12, 0x05,
-  0xfe, 0xf0, 0xf1, 0x11, 0x0a, 0xfa, 0xcf, 0x17, 0xe2, 0x21, 0xec, 0xfd,
-  0x0c, 0xd7, 0xf2, 0x0d, 0xf9, 0xf2, 0xfb, 0x1d, 0xf2, 0x47, 0xeb, 0xd1,
-  0x14, 0xb6, 0xea, 0xb7, 0x1f, 0xfa, 0xf4, 0x60, 0x52, 0xba, 0x0d, 0x16,
-  0x19, 0xe9, 0x37, 0xf7, 0xfa, 0x03, 0x09, 0x15, 0x11, 0xe2, 0x07, 0xe5,
-  0xf5, 0x17, 0xde, 0xc1, 0x00, 0xec, 0xda, 0x00, 0xd5, 0xfe, 0xee, 0x25,
-  0x1c, 0x09, 0x3d, 0x0e, 0xf8, 0x29, 0x3f, 0x3e, 0xda, 0xf5, 0x2a, 0xf8,
-  0x12, 0x09, 0x05, 0x1c, 0xe6, 0xfe, 0xf3, 0x34, 0x23, 0x2c, 0x08, 0xe6,
-  0x24, 0x13, 0xe2, 0xf3, 0xe3, 0x10, 0xfa, 0xe4, 0x00, 0xfd, 0xe1, 0x38,
-  0xde, 0xf3, 0xcf, 0x12, 0xe6, 0x11, 0x3c, 0x1a, 0x0e, 0x19, 0xfc, 0xcd,
-  0x32, 0x05, 0x3b, 0xf5, 0x0c, 0x1c, 0xef, 0x35, 0xd8, 0xe0, 0xbd, 0xfb,
-  0x91, 0xee, 0xdb, 0x19, 0xe9, 0x15, 0x17, 0x2f, 0x19, 0x04, 0xe5, 0xff,
-  0x3f, 0xc5, 0xd9, 0xea, 0xe7, 0xeb, 0x10, 0xf8, 0xf7, 0xda, 0xf2, 0xd5,
-  0xb8, 0x3b, 0x2e, 0x0e, 0xf9, 0x22, 0xf4, 0x29, 0xfc, 0xf0, 0x0b, 0xd3,
-  0xd2, 0xc4, 0xf0, 0xf1, 0x1a, 0xda, 0xdc, 0xe6, 0x24, 0x05, 0x15, 0x0b,
-  0x26, 0xd9, 0x38, 0x1a, 0xe9, 0xc9, 0x01, 0xe2, 0x0a, 0x0b, 0xda, 0x06,
-  0xef, 0x24, 0xfc, 0x2d, 0xcf, 0x2e, 0x59, 0xdc, 0x12, 0x0f, 0x4f, 0x15,
-  0xe9, 0x09, 0xc7, 0xfc, 0x19, 0xd7, 0xd8, 0x11, 0xe1, 0x47, 0xf2, 0x28,
-  0x01, 0xd0, 0x06, 0xfe, 0x2a, 0x43, 0xf0, 0xf4, 0x24, 0x15, 0xfd, 0xed,
-  0x07, 0xdd, 0xcc, 0x41, 0xdd, 0xb0, 0x0d, 0xfc, 0xeb, 0xf6, 0xd7, 0xfb,
-  0xf3, 0xe7, 0x08, 0xe9, 0x05, 0xda, 0x21, 0x50, 0xe6, 0xeb, 0x1c, 0xe8,
-  0xe5, 0xf9, 0xe0, 0x0c, 0xd7, 0x1d, 0xdc, 0xd8, 0xcc, 0x00, 0x25, 0xe9,
-  0x48, 0x1d, 0x15, 0x21, 0x07, 0x0f, 0xf0, 0x2a, 0x05, 0x1e, 0xcb, 0xef,
-  0xc7, 0x23, 0x04, 0x42, 0xfa, 0x17, 0x14, 0x33, 0xea, 0x35, 0xd6, 0x16,
-  0x06, 0xc9, 0xe4, 0x2e, 0x04, 0xe8, 0xf5, 0x1e, 0xb2, 0xe4, 0x27, 0x1f,
-  0x95, 0xcf, 0xf0, 0xe2, 0xf4, 0xea, 0x1b, 0x19, 0xdf, 0x14, 0xe9, 0x6e,
-  0x44, 0x17, 0xfd, 0xea, 0x2c, 0xcc, 0x10, 0x0d, 0xd2, 0xe8, 0xec, 0xbe,
-  0xaa, 0xf2, 0xf1, 0x21, 0xd1, 0xfd, 0x06, 0xe6, 0x03, 0xfb, 0xfd, 0xe2,
-  0x18, 0xd6, 0x08, 0x19, 0x90, 0x08, 0xfa, 0x46, 0xeb, 0x43, 0x1c, 0x01,
-  0xe8, 0x55, 0xf0, 0xf0, 0x2a, 0xb9, 0x17, 0x01, 0x22, 0xec, 0xc9, 0xfd,
-  0xf3, 0xf8, 0x17, 0xfb, 0xe6, 0x09, 0xd2, 0x1c, 0x18, 0xce, 0xf3, 0x0c,
-  0x3d, 0xd9, 0xd7, 0xec, 0x58, 0xfb, 0x19, 0xdb, 0x18, 0xf9, 0x1e, 0x30,
-  0xf8, 0xeb, 0x28, 0xea, 0x81, 0xda, 0xfd, 0xf3, 0xf5, 0x07, 0x19, 0xf0,
-  0xd2, 0x03, 0xe9, 0xfa, 0x26, 0xc4, 0xf2, 0x07, 0xef, 0x1c, 0xf3, 0x58,
-  0xe6, 0x00, 0x14, 0x3b, 0x11, 0xf3, 0xef, 0x01, 0x08, 0x10, 0xf7, 0x08,
-  0x04, 0xe1, 0xec, 0x11, 0x46, 0xda, 0x0e, 0xbb, 0x03, 0x1e, 0x08, 0xe6,
-  0xec, 0xda, 0x0f, 0x56, 0xea, 0xbb, 0xc7, 0x2d, 0x4b, 0x2e, 0x12, 0xf7,
-  0x38, 0x12, 0xd9, 0x2e, 0x2d, 0x0f, 0xfb, 0xc6, 0xc6, 0xf0, 0xd0, 0xe7,
-  0xfa, 0xec, 0x15, 0xee, 0x1a, 0xf5, 0x07, 0xf2, 0x04, 0x12, 0x0a, 0x32,
-  0x01, 0x1a, 0xfd, 0x25, 0x11, 0xe3, 0x12, 0xe5, 0x16, 0xfc, 0x32, 0xca,
-  0xdd, 0x06, 0x2d, 0x19, 0x23, 0x21, 0x03, 0xeb, 0x0b, 0xbf, 0x00, 0xf6,
-  0x48, 0xde, 0xe5, 0xea, 0x04, 0x99, 0x15, 0x15, 0xbc, 0x19, 0xef, 0x21,
-  0x2e, 0x25, 0xb9, 0x23, 0x15, 0x0a, 0xdc, 0x12, 0x17, 0x25, 0xea, 0x0f,
-  0xf1, 0xe7, 0x04, 0xd6, 0x35, 0x1e, 0xc2, 0x05, 0x01, 0x2a, 0x21, 0xf1,
-  0xcc, 0xcc, 0xe0, 0xf5, 0xa8, 0x35, 0xeb, 0x59, 0xc1, 0x1f, 0x12, 0xf1,
-  0x06, 0xf2, 0xda, 0xbc, 0xf9, 0x1c, 0xae, 0xe2, 0x29, 0xf8, 0x09, 0x14,
-  0xd0, 0xdf, 0xe4, 0x19, 0xdf, 0xe4, 0x15, 0xfd, 0xd4, 0xe4, 0x20, 0xdc,
-  0xfc, 0xe6, 0xd6, 0x1e, 0xf2, 0xf4, 0x3b, 0xe9, 0xf6, 0x00, 0x23, 0xe3,
-  0xfa, 0x2d, 0x32, 0x42, 0x05, 0xc5, 0x6b, 0xd1, 0xf3, 0xe6, 0xcf, 0xc6,
-  0x31, 0x00, 0x0c, 0xe6, 0xd2, 0xde, 0x09, 0x0d, 0xdf, 0x43, 0x2b, 0x10,
-  0xbc, 0xea, 0xfd, 0xc3, 0xff, 0x04, 0x00, 0xfc, 0x1b, 0x0d, 0xc3, 0xe7,
-  0xd3, 0x1c, 0x01, 0xf9, 0xd6, 0xb2, 0x0b, 0x15, 0xfd, 0x00, 0x0f, 0x3f,
-  0x23, 0xbe, 0x5b, 0xdd, 0xce, 0x03, 0xe8, 0x21, 0xd4, 0xe1, 0x14, 0x0c,
-  0xe4, 0xf5, 0xfd, 0xf3, 0xf8, 0x43, 0xf4, 0x3a, 0xab, 0x1c, 0xf8, 0x04,
-  0xff, 0xfd, 0xd5, 0xc9, 0xcf, 0xfe, 0xf4, 0x0f, 0xbc, 0xd9, 0xe3, 0xef,
-  0x48, 0x20, 0x46, 0x30, 0x01, 0xcd, 0xb0, 0xb8, 0x0e, 0x2a, 0xeb, 0x21,
-  0x1c, 0xfb, 0x2b, 0x0c, 0xfe, 0x09, 0xf0, 0xe4, 0xec, 0xdf, 0x2e, 0xe6,
-  0x0f, 0xde, 0x1e, 0x78, 0xbd, 0xda, 0x17, 0x02, 0x29, 0x50, 0x15, 0x00,
-  0xda, 0xcd, 0x3e, 0x38, 0x1a, 0xd1, 0x07, 0xfd, 0x01, 0x28, 0x12, 0x3d,
-  0xb0, 0xd4, 0xcc, 0x1b, 0x7c, 0xf9, 0xe7, 0x45, 0xef, 0x28, 0x29, 0xe7,
-  0xfc, 0x19, 0xe9, 0xf1, 0xcf, 0x27, 0xf9, 0x66, 0xcb, 0x15, 0xff, 0xe0,
-  0xe0, 0x0d, 0x0a, 0x02, 0xec, 0x0b, 0x0c, 0xa8, 0x07, 0x0d, 0x2f, 0x29,
-  0x02, 0xe2, 0xe7, 0x1f, 0xf6, 0xf1, 0xe2, 0x09, 0xe9, 0xfc, 0x21, 0xf9,
-  0xe5, 0xfd, 0xe9, 0xeb, 0xd7, 0x04, 0xfd, 0xc5, 0x2b, 0xc3, 0x19, 0x0b,
-  0xde, 0x0c, 0xe0, 0x03, 0x7f, 0x0a, 0x38, 0xdd, 0x34, 0xfd, 0xe5, 0x26,
-  0x24, 0xf2, 0x16, 0xde, 0xec, 0xff, 0xd6, 0x36, 0x02, 0x23, 0x40, 0x39,
-  0xbe, 0x05, 0xe5, 0xf5, 0xc3, 0x0e, 0x27, 0xf7, 0x0a, 0xe1, 0x0c, 0xe5,
-  0x10, 0x08, 0x06, 0x08, 0xc8, 0xcb, 0x1d, 0x0c, 0xf8, 0x0b, 0x23, 0x26,
-  0x42, 0xef, 0x45, 0xcd, 0xce, 0x0e, 0xfc, 0xc6, 0xfc, 0xe5, 0xca, 0xd1,
-  0x43, 0xd3, 0x01, 0x2a, 0xe9, 0x26, 0xeb, 0x1f, 0x46, 0x37, 0xe5, 0xd9,
-  0x0e, 0xeb, 0xa3, 0x2a, 0xe0, 0xfc, 0x07, 0x04, 0xf5, 0x0b, 0xf6, 0x21,
-  0x36, 0x34, 0x23, 0xf5, 0xb0, 0xf0, 0x9b, 0xda, 0xde, 0x11, 0xf9, 0xf5,
-  0x3f, 0xd4, 0xf6, 0xe9, 0xd9, 0x30, 0x2a, 0x27, 0xe9, 0xd2, 0x2e, 0x1b,
-  0xf8, 0x00, 0x54, 0x1c, 0x20, 0x0a, 0x19, 0xc9, 0xf0, 0x07, 0xe6, 0x13,
-  0x1e, 0xf8, 0xdc, 0xb3, 0x0c, 0xc2, 0x28, 0x0f, 0xed, 0x03, 0x0d, 0x33,
-  0x00, 0xf4, 0xbc, 0xdc, 0xff, 0xf3, 0x0b, 0x20, 0xdb, 0x16, 0x1e, 0xf5,
-  0x1d, 0x3f, 0xee, 0xed, 0xf0, 0x0c, 0x22, 0xf4, 0x29, 0x10, 0x0f, 0xea,
-  0x15, 0xf7, 0x1c, 0xf4, 0xf5, 0xed, 0xfc, 0xb3, 0x23, 0xf3, 0x31, 0x14,
-  0x46, 0xb5, 0xf7, 0xdc, 0xaf, 0xf3, 0xfd, 0x1c, 0x00, 0xce, 0xeb, 0x4e,
-  0xf6, 0x1c, 0x0f, 0x00, 0x10, 0xe3, 0xe3, 0xe9, 0x29, 0xb6, 0xf1, 0xf0,
-  0x0a, 0xc9, 0xe0, 0xb3, 0x1a, 0x18, 0xd6, 0xc1, 0x25, 0x05, 0xf6, 0x0b,
-  0xee, 0xd5, 0x0c, 0xe6, 0x3c, 0x27, 0xe7, 0x0d, 0x20, 0xdf, 0x2d, 0x0d,
-  0x40, 0x0c, 0x07, 0xee, 0x0f, 0xd7, 0x27, 0x02, 0x12, 0x01, 0x10, 0xe0,
-  0x09, 0x05, 0x12, 0xb3, 0x2f, 0xfc, 0x0e, 0x10, 0xed, 0xf0, 0xfd, 0x24,
-  0xf9, 0xda, 0xf8, 0x36, 0xf7, 0xc6, 0x3c, 0xc6, 0xc0, 0xf2, 0xc5, 0xeb,
-  0xf2, 0xb2, 0xfd, 0x14, 0xfd, 0xf5, 0xf7, 0xa9, 0x21, 0x1c, 0xe1, 0xec,
-  0xf6, 0xd3, 0xf1, 0x01, 0xe3, 0xd9, 0x19, 0xf5, 0x0d, 0x51, 0x2c, 0xfd,
-  0x39, 0xde, 0x12, 0xf5, 0xc9, 0xe1, 0xdb, 0xf3, 0xb8, 0xf6, 0x05, 0x0b,
-  0x3d, 0xfe, 0xff, 0xe4, 0x1a, 0x3c, 0x2c, 0x1a, 0x3e, 0xfc, 0xf0, 0xf1,
-  0x0b, 0x27, 0x00, 0x00, 0x25, 0xde, 0x03, 0xf4, 0xd4, 0xb6, 0x39, 0x06,
-  0xec, 0x07, 0xf2, 0xb8, 0x33, 0xd4, 0xfd, 0x12, 0xff, 0x03, 0x09, 0xab,
-  0xf0, 0xfd, 0xb3, 0xfe, 0x13, 0x02, 0xa8, 0xb7, 0x1c, 0x13, 0x1b, 0x13,
-  0xdf, 0x32, 0x24, 0x3a, 0xdf, 0x1d, 0xe0, 0xed, 0xf6, 0x11, 0x01, 0x06,
-  0x08, 0xd4, 0xfc, 0x04, 0x46, 0xe3, 0xf1, 0x51, 0x20, 0x10, 0x02, 0x2b,
-  0xe0, 0x18, 0xf7, 0xfe, 0xb4, 0x23, 0x5f, 0xe3, 0xf7, 0x1b, 0x21, 0xd1,
-  0xb0, 0xe9, 0x0e, 0x10, 0x20, 0x01, 0xba, 0xfa, 0xcd, 0xe1, 0xc8, 0x2a,
-  0xe7, 0x3b, 0xde, 0x32, 0x20, 0xef, 0x94, 0x31, 0xe1, 0xf7, 0xd8, 0xde,
-  0x28, 0x01, 0x13, 0xf1, 0xf2, 0x3c, 0xe3, 0x03, 0xa6, 0xfe, 0xec, 0xfd,
-  0xde, 0x16, 0xf6, 0xd3, 0xde, 0xd8, 0x26, 0x17, 0x3a, 0xe8, 0xcd, 0xef,
-  0xec, 0x11, 0xe1, 0x09, 0xad, 0xf3, 0xf3, 0x38, 0xb1, 0x45, 0x23, 0xdf,
-  0x09, 0xd3, 0xed, 0xda, 0xe2, 0xd7, 0x2c, 0xf8, 0xd3, 0xdf, 0xc3, 0x08,
-  0xf1, 0xfb, 0xb7, 0xe2, 0xd8, 0x73, 0xc1, 0x24, 0x1d, 0xc0, 0xf8, 0x14,
-  0x3d, 0x0c, 0xc4, 0x15, 0xe9, 0xf6, 0x2c, 0xe8, 0xe0, 0x48, 0xe4, 0x0c,
-  0xf4, 0x06, 0xf5, 0x32, 0xcc, 0x54, 0x56, 0xed, 0xe9, 0xa9, 0x16, 0xfe,
-  0x5b, 0xc1, 0xfa, 0x1b, 0xfb, 0x00, 0xdc, 0x04, 0xec, 0x37, 0x29, 0x40,
-  0xf7, 0x12, 0x09, 0xfb, 0x31, 0xee, 0xfe, 0xfe, 0xfc, 0x1b, 0x17, 0xb5,
-  0x9a, 0xf6, 0xa3, 0x16, 0xf6, 0x30, 0xc7, 0xe0, 0x8d, 0x42, 0xde, 0x1b,
-  0x00, 0xbc, 0xdb, 0x35, 0xe5, 0xc7, 0xfa, 0x1c, 0xd8, 0xf6, 0xf5, 0xe1,
-  0x08, 0x48, 0x13, 0x1b, 0x2a, 0x03, 0xe4, 0x2a, 0xe2, 0x5c, 0xe7, 0x37,
-  0xea, 0x30, 0xfa, 0x97, 0xf1, 0xf4, 0xf2, 0x11, 0xf3, 0x06, 0xda, 0x44,
-  0x0a, 0xd8, 0xf4, 0xfd, 0xf6, 0xe5, 0x10, 0xfb, 0xf9, 0x30, 0xec, 0xd7,
-  0xbc, 0x0b, 0x00, 0xdf, 0xe3, 0x07, 0x1c, 0x03, 0xf3, 0xfc, 0x2b, 0x31,
-  0xe4, 0x1b, 0x11, 0x23, 0xbf, 0x07, 0xde, 0x12, 0xef, 0xc0, 0xf1, 0x0d,
-  0xf2, 0x3a, 0x0a, 0xfb, 0x09, 0x3d, 0xfa, 0x03, 0x3e, 0xf0, 0x07, 0x1d,
-  0xf0, 0x3a, 0xf5, 0xfd, 0xd5, 0x6f, 0xd6, 0xe2, 0x1a, 0x27, 0xc8, 0xcc,
-  0xb5, 0x15, 0xd2, 0x2e, 0x20, 0xd2, 0xf2, 0xd2, 0xbf, 0x1a, 0x15, 0xeb,
-  0xe1, 0xf4, 0xe9, 0xc5, 0x0c, 0xe6, 0xf7, 0xcf, 0x07, 0xfa, 0x2f, 0xe4,
-  0x16, 0xef, 0x05, 0xfb, 0x65, 0xdf, 0x34, 0xe7, 0xeb, 0xee, 0x31, 0xdf,
-  0x10, 0xac, 0xf9, 0x0a, 0xda, 0x27, 0x12, 0xeb, 0xf0, 0x58, 0x13, 0x0e,
-  0x0c, 0x08, 0x21, 0x27, 0x9f, 0x53, 0x0f, 0xcd, 0xeb, 0xdd, 0x0b, 0xc5,
-  0x0a, 0xed, 0xea, 0xf3, 0xf5, 0x05, 0x0f, 0x0e, 0x0a, 0x06, 0x09, 0xfd,
-  0xdd, 0xe0, 0xe7, 0xff, 0x2e, 0x16, 0xec, 0xef, 0xe4, 0x04, 0x11, 0xda,
-  0xe4, 0xfb, 0x08, 0x3f, 0xda, 0x2d, 0x38, 0x0d, 0x00, 0x1f, 0x3d, 0xe6,
-  0xe8, 0xd4, 0x4c, 0xf8, 0xec, 0xd3, 0x07, 0x2c, 0xca, 0xd5, 0xff, 0xeb,
-  0xef, 0xd1, 0x09, 0xf2, 0x0e, 0x4e, 0xf6, 0x0a, 0xf2, 0x2e, 0xb9, 0x29,
-  0xf4, 0x21, 0x13, 0xb6, 0xe8, 0xc0, 0x14, 0x34, 0x1c, 0x11, 0x01, 0xc9,
-  0x52, 0x24, 0x2d, 0x45, 0x28, 0xca, 0xf3, 0x4f, 0xf5, 0x1e, 0xff, 0xd8,
-  0xc4, 0xcd, 0x18, 0xf7, 0xe0, 0x02, 0xd9, 0x06, 0x03, 0x00, 0x00, 0x13,
-  0x9f, 0x1e, 0x0a, 0x30, 0x1c, 0x0b, 0xf8, 0x06, 0xbe, 0x01, 0x0b, 0x14,
-  0xf6, 0x2b, 0x0a, 0x22, 0x44, 0x0c, 0xfc, 0x0f, 0x04, 0x3b, 0xf7, 0x18,
-  0xf8, 0x33, 0xd8, 0x46, 0xde, 0x2d, 0xf9, 0xe5, 0xff, 0x07, 0x03, 0xe5,
-  0xf3, 0xf6, 0xee, 0x00, 0x7f, 0xe9, 0xef, 0xf5, 0xe9, 0xd9, 0x02, 0x2b,
-  0x1b, 0xea, 0x06, 0xdb, 0xd4, 0xf2, 0x1c, 0xda, 0x02, 0x31, 0xd6, 0xda,
-  0xe2, 0x07, 0x3f, 0xfa, 0x4f, 0x33, 0x11, 0x0d, 0x29, 0x09, 0x14, 0x1b,
-  0x10, 0xe3, 0xf9, 0x16, 0xff, 0xe9, 0xff, 0xee, 0x40, 0x11, 0xdb, 0xfe,
-  0x18, 0x10, 0x0f, 0x0a, 0xc6, 0x30, 0xe3, 0x04, 0x06, 0xe6, 0xe0, 0xea,
-  0x0b, 0x06, 0xeb, 0xd8, 0xee, 0x27, 0x18, 0xd5, 0x5a, 0x0a, 0xf6, 0xdc,
-  0x30, 0xf2, 0xfd, 0x01, 0x31, 0xc6, 0xd8, 0x19, 0xfb, 0xfa, 0xe3, 0xcd,
-  0x0b, 0xf5, 0xdd, 0x15, 0xcd, 0x2a, 0x0a, 0x0f, 0x3b, 0x22, 0x1d, 0x03,
-  0x3d, 0xfd, 0x32, 0xf0, 0x8e, 0xd4, 0x00, 0xd3, 0x0d, 0x29, 0xd6, 0x2c,
-  0x12, 0xf6, 0xf1, 0xa5, 0xfa, 0xee, 0x1b, 0xbc, 0xdf, 0x0e, 0xe2, 0x09,
-  0xae, 0x13, 0x16, 0x1c, 0xb9, 0xec, 0x08, 0x2d, 0xe8, 0x3c, 0xec, 0xfd,
-  0xf2, 0xcd, 0x4f, 0xdc, 0xe5, 0xe4, 0xcb, 0xfd, 0xd3, 0x31, 0xbf, 0xed,
-  0x07, 0x29, 0x07, 0x29, 0x1a, 0x32, 0xb3, 0x02, 0x14, 0x2d, 0xee, 0x26,
-  0xfc, 0xe1, 0x14, 0x38, 0x01, 0xf3, 0x2c, 0x1c, 0x24, 0xbf, 0x27, 0xf9,
-  0xda, 0x2c, 0xdf, 0x1e, 0x08, 0xf8, 0xd9, 0x21, 0xc5, 0x09, 0x26, 0x1a,
-  0xfb, 0x02, 0x07, 0xfc, 0x1a, 0xf7, 0x0a, 0xda, 0xcd, 0xf3, 0xf6, 0x00,
-  0x0b, 0xf5, 0xd5, 0xf7, 0xea, 0xf1, 0x56, 0x17, 0xd5, 0xf8, 0xf4, 0xe5,
-  0xf7, 0x56, 0xfc, 0xd2, 0x33, 0x2a, 0x29, 0xee, 0x04, 0x3e, 0xf2, 0xfd,
-  0x1c, 0x19, 0x0c, 0x38, 0x0d, 0xf5, 0xfc, 0x0e, 0xbf, 0x05, 0xf3, 0x2c,
-  0x14, 0xcc, 0x17, 0xdd, 0x1d, 0x21, 0xe4, 0x1d, 0x35, 0x1e, 0xfe, 0x19,
-  0xcc, 0xe2, 0x0e, 0xf7, 0x20, 0x07, 0xf8, 0x07, 0x1d, 0x04, 0xca, 0xb0,
-  0xc9, 0x06, 0x5d, 0xdb, 0xf9, 0x18, 0xd2, 0xa9, 0xf6, 0x20, 0x01, 0x1b,
-  0xef, 0x08, 0x12, 0xe2, 0xdf, 0x32, 0x01, 0x1c, 0x34, 0x17, 0xff, 0xed,
-  0xea, 0x1b, 0xe6, 0x40, 0xf2, 0xf8, 0x19, 0xfe, 0xfd, 0x40, 0xd7, 0xe7,
-  0x23, 0x31, 0x00, 0x09, 0xe5, 0xcd, 0xc8, 0xd7, 0xe1, 0xe0, 0x09, 0x2a,
-  0xf9, 0x03, 0xfd, 0xe3, 0xe4, 0xed, 0x22, 0x0c, 0xd4, 0x10, 0x1c, 0x2a,
-  0xb7, 0xe3, 0x25, 0x17, 0xe5, 0xed, 0xf9, 0x57, 0x1c, 0xfc, 0xe3, 0xea,
-  0x2a, 0xff, 0x41, 0x13, 0x2e, 0xf6, 0xf7, 0x05, 0x0f, 0x0c, 0xdc, 0xff,
-  0xfe, 0xed, 0xfc, 0x1e, 0xf3, 0x11, 0x06, 0x03, 0x31, 0x30, 0xff, 0x49,
-  0xf7, 0xf0, 0xff, 0x08, 0x15, 0xd8, 0x27, 0xd2, 0x27, 0x81, 0xf7, 0xf2,
-  0xe2, 0x24, 0xe2, 0x0e, 0x30, 0xda, 0x1e, 0xe5, 0xeb, 0xe2, 0xfe, 0xe4,
-  0x18, 0xd2, 0x2a, 0xfa, 0xed, 0xfe, 0x00, 0xd8, 0xf0, 0xd1, 0xeb, 0x10,
-  0x23, 0xf3, 0xf1, 0x0c, 0x20, 0x02, 0x01, 0x04, 0xe2, 0xfb, 0x39, 0x1d,
-  0x11, 0x3a, 0xe9, 0xdd, 0x41, 0xfa, 0x27, 0x06, 0x4e, 0x2a, 0x09, 0xe5,
-  0x39, 0x42, 0x2b, 0x1d, 0x2a, 0xd4, 0x10, 0xec, 0xed, 0xc5, 0x29, 0x10,
-  0x14, 0xda, 0x23, 0xe2, 0x29, 0x1e, 0x18, 0xfd, 0x13, 0xe1, 0xe9, 0x15,
-  0xff, 0x08, 0xda, 0xf7, 0x11, 0x13, 0xf6, 0xfa, 0xf5, 0xfe, 0xf4, 0xcc,
-  0xe0, 0xe6, 0x4b, 0x03, 0x1f, 0xf0, 0xf7, 0xd2, 0x2f, 0x11, 0xdd, 0x15,
-  0xea, 0x09, 0x3f, 0x41, 0x02, 0x29, 0xfd, 0x0e, 0x16, 0x0d, 0x0d, 0xe0,
-  0x2b, 0xeb, 0xea, 0x0a, 0x0f, 0x52, 0x14, 0x05, 0x0e, 0xf1, 0x14, 0x14,
-  0xcf, 0xde, 0x46, 0xfa, 0x0a, 0x0a, 0x30, 0x15, 0xe9, 0xb3, 0x2e, 0xf4,
-  0xff, 0xf8, 0xfc, 0x32, 0xe9, 0x09, 0xbe, 0x3e, 0xb8, 0x2f, 0x11, 0x04,
-  0xde, 0xf5, 0xdb, 0xe3, 0x34, 0xfb, 0x1c, 0x50, 0x16, 0xcc, 0xec, 0xe7,
-  0xed, 0x22, 0x1f, 0x4e, 0xfd, 0x57, 0xd1, 0x34, 0x04, 0xd7, 0xf7, 0x0b,
-  0x0b, 0xee, 0xdf, 0x18, 0xd7, 0x0f, 0x1b, 0x4b, 0x17, 0xda, 0x12, 0x44,
-  0x01, 0x01, 0x12, 0xea, 0xe6, 0x27, 0xcc, 0xc9, 0x01, 0xaf, 0xef, 0xed,
-  0x83, 0x03, 0x06, 0x32, 0x3a, 0xfd, 0xd2, 0xf9, 0x0b, 0x0a, 0xda, 0xf3,
-  0xde, 0xf2, 0xda, 0xce, 0xfd, 0x55, 0xc6, 0xe0, 0x05, 0xf9, 0x0c, 0x2b,
-  0xf5, 0x16, 0xfa, 0x38, 0x0c, 0x36, 0xfe, 0x08, 0x2c, 0x04, 0x0c, 0xfb,
-  0xe7, 0x02, 0x0f, 0xb0, 0x3a, 0xcf, 0x29, 0x11, 0xf0, 0xe3, 0x03, 0x0e,
-  0x02, 0xd1, 0x2a, 0x0e, 0xea, 0xc2, 0x21, 0x02, 0x88, 0x0e, 0xdb, 0x15,
-  0xe7, 0xdb, 0x14, 0x05, 0x11, 0x07, 0x0f, 0x4a, 0xfa, 0xf9, 0x0e, 0xf5,
-  0x1d, 0x67, 0xff, 0xd0, 0xfd, 0x0f, 0xd2, 0xc3, 0x02, 0x36, 0xe6, 0xe8,
-  0x2a, 0xfd, 0x2a, 0xfc, 0x03, 0xdf, 0x00, 0x15, 0x2b, 0x2c, 0xf1, 0xd7,
-  0x3a, 0xf6, 0x22, 0x0e, 0xc9, 0x03, 0xf8, 0x15, 0x12, 0xde, 0xfc, 0xe5,
-  0x11, 0xbb, 0xea, 0xfe, 0x48, 0xb6, 0x20, 0xf9, 0xf0, 0x03, 0x2d, 0x55,
-  0x96, 0x25, 0x5f, 0x36, 0x41, 0x00, 0x2f, 0xdc, 0x0e, 0x08, 0x09, 0xde,
-  0xda, 0x10, 0x04, 0x09, 0x00, 0x35, 0x07, 0xec, 0x0b, 0x09, 0xf7, 0xff,
-  0x01, 0x0b, 0xf4, 0xda, 0xd2, 0xfd, 0x07, 0xe4, 0x01, 0xcd, 0x14, 0xf6,
-  0xeb, 0x12, 0xb9, 0x18, 0x4c, 0x05, 0x0b, 0xd7, 0xf2, 0xfe, 0x28, 0xf0,
-  0xea, 0xd7, 0xe5, 0x02, 0xf4, 0x32, 0x22, 0xcb, 0xe9, 0xbd, 0x20, 0xff,
-  0xfa, 0x0a, 0x15, 0xcf, 0xe8, 0xfc, 0xc8, 0xef, 0x39, 0xed, 0xf7, 0xfa,
-  0x29, 0xf7, 0x0f, 0xfc, 0x19, 0x15, 0xff, 0xdd, 0x10, 0x11, 0x01, 0xf9,
-  0xe7, 0x36, 0xeb, 0xf0, 0xdf, 0xfe, 0xc6, 0xc2, 0x07, 0xfd, 0x33, 0xf3,
-  0xfe, 0xcb, 0x12, 0xe7, 0xea, 0xde, 0xeb, 0x27, 0x42, 0x04, 0xf6, 0xde,
-  0xf4, 0x10, 0x3c, 0xfc, 0xd4, 0xf2, 0xf7, 0xeb, 0xdb, 0x35, 0x57, 0xe9,
-  0xaf, 0xce, 0x04, 0x2d, 0xf1, 0x0b, 0x0d, 0xec, 0xe1, 0xd7, 0xdb, 0xe4,
-  0x2b, 0xd9, 0x0a, 0xfd, 0x16, 0x07, 0x10, 0xe8, 0xfd, 0x1d, 0xe5, 0xdc,
-  0xec, 0xee, 0x0c, 0x13, 0x04, 0x06, 0x04, 0xf9, 0x04, 0x01, 0xde, 0xe0,
-  0xe8, 0xf9, 0xe4, 0xc0, 0xe6, 0xff, 0xfb, 0x14, 0xf7, 0x15, 0x1e, 0x0f,
-  0x20, 0x23, 0xe3, 0xe5, 0xfc, 0x0f, 0x27, 0x03, 0xf8, 0x0b, 0x20, 0xed,
-  0x02, 0x08, 0x51, 0x0e, 0xd9, 0xee, 0x1b, 0x29, 0x07, 0xf4, 0xf7, 0xfc,
-  0x12, 0xfc, 0xe6, 0xeb, 0xe8, 0x32, 0x29, 0xfe, 0xf5, 0x0d, 0xf9, 0xc7,
-  0x06, 0xf4, 0xf9, 0xfa, 0xf6, 0x1f, 0xfe, 0xec, 0xf2, 0xe7, 0x10, 0xfc,
-  0xe6, 0xe0, 0xf5, 0xe0, 0xeb, 0xec, 0x37, 0x01, 0xfe, 0x12, 0xe5, 0x1c,
-  0xd2, 0xe7, 0x44, 0xe4, 0xf2, 0x22, 0xf7, 0xf1, 0x07, 0xe0, 0x15, 0x11,
-  0x09, 0xe4, 0xec, 0xd6, 0x13, 0x33, 0xd4, 0x29, 0x0a, 0x17, 0xe5, 0x03,
-  0xbf, 0x34, 0x2a, 0xcd, 0xe4, 0x35, 0xf1, 0x05, 0xeb, 0x1d, 0x27, 0xed,
-  0x11, 0x03, 0xe6, 0x10, 0x08, 0xf5, 0xf6, 0x2b, 0xb6, 0x23, 0xfc, 0x04,
-  0x0d, 0xea, 0x07, 0xf4, 0xdc, 0xdb, 0xc2, 0xf9, 0xff, 0x06, 0x34, 0x05,
-  0xe2, 0xf2, 0x08, 0x03, 0xd9, 0xb7, 0x2a, 0x12, 0xdd, 0x0c, 0xe3, 0xe2,
-  0x00, 0xf6, 0x28, 0x32, 0x04, 0xf9, 0xdf, 0x0a, 0x02, 0x42, 0x14, 0x14,
-  0xf7, 0x10, 0xf5, 0x31, 0x04, 0x31, 0x34, 0x0b, 0xd5, 0x17, 0x0f, 0xcc,
-  0xe3, 0x0e, 0x1b, 0x05, 0xdf, 0x23, 0xf8, 0x12, 0xf9, 0xf8, 0xdc, 0x18,
-  0x00, 0xef, 0xf4, 0xe7, 0x10, 0xf6, 0x0a, 0x1c, 0xf7, 0xd0, 0xd5, 0x02,
-  0xf0, 0xe8, 0x1a, 0x35, 0xf0, 0xee, 0x11, 0xf5, 0x08, 0xfa, 0xea, 0xf9,
-  0xee, 0x04, 0xfd, 0xea, 0x10, 0xf6, 0x07, 0x20, 0x18, 0x18, 0x1d, 0x10,
-  0x03, 0xf2, 0xd0, 0x2a, 0x19, 0x41, 0x0f, 0xfb, 0x05, 0x0c, 0xe1, 0x01,
-  0x0e, 0x00, 0x1b, 0x00, 0x39, 0x21, 0xee, 0x1a, 0x17, 0xe1, 0x32, 0x0a,
-  0xd8, 0x13, 0x01, 0xf0, 0xe0, 0x06, 0x0f, 0x1f, 0xfc, 0x02, 0x0b, 0x0b,
-  0x2e, 0x0d, 0x2a, 0x15, 0x14, 0xde, 0xf5, 0xfa, 0x18, 0xf4, 0xef, 0x10,
-  0x1a, 0xbe, 0x4a, 0x43, 0xeb, 0x22, 0x0d, 0x19, 0xe4, 0x09, 0xfd, 0x0c,
-  0x2e, 0xf2, 0xe8, 0x0b, 0xef, 0xee, 0x0d, 0x1a, 0xfd, 0xf6, 0x0b, 0x19,
-  0xf7, 0x12, 0xff, 0xf2, 0xf8, 0x0b, 0x0f, 0x08, 0x55, 0x54, 0xea, 0x2a,
-  0x18, 0x0e, 0xfb, 0xea, 0xa7, 0xab, 0x03, 0x7f, 0xd8, 0x26, 0xff, 0x20,
-  0x14, 0xdf, 0xfc, 0xf7, 0x13, 0xd7, 0x1b, 0x40, 0x1c, 0x17, 0xfc, 0x01,
-  0xf7, 0xc7, 0xf2, 0x03, 0x16, 0xe9, 0x23, 0x35, 0xf2, 0x28, 0xf2, 0xe6,
-  0xff, 0xe7, 0xe6, 0xd9, 0x0c, 0x03, 0xcb, 0x02, 0x09, 0xd6, 0x24, 0xfe,
-  0x16, 0xda, 0x01, 0xf1, 0xf0, 0x2b, 0x0f, 0xdb, 0x06, 0x05, 0x03, 0xf0,
-  0x25, 0x4a, 0xe4, 0x15, 0x07, 0xfd, 0xf4, 0xb6, 0xe5, 0x26, 0x05, 0xec,
-  0x08, 0x15, 0x07, 0x2b, 0xf1, 0xef, 0xed, 0x11, 0xe4, 0xf8, 0xea, 0xfa,
-  0x00, 0xc1, 0x07, 0x0e, 0xf5, 0xdd, 0xef, 0xe0, 0xc2, 0xf3, 0xd4, 0xe3,
-  0xe9, 0x0c, 0xdf, 0x0a, 0x13, 0xd1, 0xca, 0xd8, 0x0d, 0x01, 0x02, 0x0e,
-  0x28, 0x02, 0xda, 0xd3, 0xfd, 0x10, 0x12, 0xce, 0xfa, 0x14, 0xe0, 0xfb,
-  0x04, 0x2c, 0x08, 0x1a, 0xda, 0x05, 0x0a, 0xb8, 0x2c, 0x05, 0xd7, 0xec,
-  0x21, 0x27, 0xc7, 0x2e, 0xd8, 0xe4, 0x15, 0x36, 0x0e, 0x49, 0x0a, 0xe5,
-  0xf0, 0x2a, 0x1e, 0x12, 0x04, 0xcb, 0xe6, 0xdf, 0x14, 0x51, 0xa9, 0x38,
-  0xfe, 0x23, 0x1c, 0x0c, 0x11, 0xe4, 0x19, 0xdf, 0x19, 0x21, 0xef, 0xc8,
-  0xef, 0xda, 0xf1, 0xe0, 0xf7, 0x08, 0xf8, 0xeb, 0xe9, 0xc4, 0x1a, 0xe0,
-  0xfa, 0x07, 0x0c, 0x06, 0xac, 0x0e, 0xf8, 0xfc, 0x08, 0x0b, 0x2c, 0xf3,
-  0x1e, 0x2a, 0xf7, 0xea, 0x1e, 0x27, 0xc6, 0xeb, 0x1f, 0x12, 0xef, 0x0b,
-  0x0f, 0x46, 0x22, 0xbe, 0xe6, 0x1c, 0xfd, 0x16, 0xf3, 0xd6, 0xd1, 0xe5,
-  0x1c, 0x13, 0x17, 0x34, 0x3c, 0x25, 0xf6, 0x01, 0xea, 0x24, 0x20, 0xfa,
-  0x20, 0xfa, 0x08, 0xcd, 0xd6, 0x35, 0x14, 0xbe, 0xe4, 0xfb, 0xd5, 0xe3,
-  0xff, 0xac, 0xe7, 0xe6, 0xe0, 0x2d, 0x19, 0xf2, 0xba, 0xf7, 0x22, 0x01,
-  0xbf, 0x07, 0x2e, 0xf4, 0x30, 0x14, 0x0a, 0xeb, 0xe1, 0x26, 0xdf, 0xb2,
-  0x58, 0xf2, 0xe3, 0xe7, 0x0b, 0x38, 0xed, 0xf1, 0x05, 0x1e, 0x43, 0x06,
-  0xc9, 0xff, 0xb9, 0xd0, 0x10, 0x46, 0xba, 0x17, 0x04, 0x2c, 0xcc, 0xf2,
-  0xd4, 0x18, 0x25, 0xf7, 0xdd, 0x0b, 0x03, 0xfa, 0x0b, 0xf6, 0x0b, 0x9c,
-  0xe5, 0x04, 0xf1, 0xe8, 0xed, 0xd6, 0xeb, 0xe6, 0xfb, 0x17, 0xdb, 0xf0,
-  0x0c, 0xd1, 0x34, 0x12, 0x10, 0x02, 0xbd, 0xdb, 0x06, 0xe3, 0xef, 0xe3,
-  0x51, 0xea, 0xc6, 0x21, 0xc3, 0x02, 0x14, 0x24, 0xbd, 0x30, 0xfb, 0x3d,
-  0x25, 0xcd, 0xea, 0xcf, 0xf3, 0xe1, 0xf1, 0xfa, 0x1c, 0xd7, 0xc9, 0x00,
-  0x00, 0xf6, 0x18, 0x09, 0x0f, 0xe9, 0xed, 0xaa, 0xf8, 0x32, 0xe0, 0x23,
-  0xe0, 0xc2, 0xfe, 0x0f, 0x30, 0x15, 0x1b, 0xea, 0xec, 0x03, 0x20, 0x1c,
-  0x0d, 0x0c, 0x0c, 0xdc, 0xbb, 0x28, 0xf6, 0x22, 0x13, 0xed, 0x91, 0x01,
-  0xe9, 0xd6, 0xe6, 0xe4, 0x56, 0xcd, 0xf5, 0x09, 0x2b, 0x10, 0x0e, 0xf4,
-  0x17, 0xfd, 0xcd, 0xf9, 0x15, 0x16, 0xd7, 0x06, 0x15, 0xd5, 0x00, 0x18,
-  0x14, 0xd0, 0x18, 0x04, 0x4f, 0x01, 0x10, 0xeb, 0xe0, 0x21, 0x1c, 0xf3,
-  0xff, 0x15, 0xe9, 0xef, 0xe8, 0x14, 0xdb, 0xea, 0xeb, 0xfe, 0x1f, 0x0f,
-  0xd9, 0x3d, 0xef, 0xf9, 0x25, 0x05, 0x15, 0xd0, 0xe4, 0x32, 0xff, 0x19,
-  0xcf, 0xf1, 0xca, 0x0a, 0xf6, 0xf1, 0xed, 0xf0, 0x1a, 0x17, 0xec, 0xef,
-  0x1f, 0x20, 0xd3, 0x07, 0xc0, 0x36, 0xb2, 0x1c, 0x0f, 0xf9, 0x18, 0xe7,
-  0xf5, 0xf4, 0xbc, 0xd8, 0x18, 0x0f, 0x03, 0xf2, 0x10, 0xf2, 0xfe, 0x0d,
-  0x09, 0xfd, 0x2c, 0x34, 0xea, 0x3f, 0xfe, 0xfd, 0xf1, 0xd9, 0xf1, 0xed,
-  0x0b, 0x35, 0xcd, 0xf3, 0xc4, 0x42, 0xf7, 0x0d, 0xf0, 0x1c, 0x22, 0xef,
-  0x33, 0xc2, 0x7f, 0x31, 0x38, 0xed, 0xf8, 0x07, 0xfc, 0xef, 0x2c, 0xf0,
-  0x09, 0xb5, 0xe1, 0xeb, 0xe2, 0x25, 0xd7, 0xfc, 0xf5, 0x33, 0xe2, 0x26,
-  0x3f, 0x06, 0xd7, 0xc0, 0x12, 0xf6, 0x11, 0x37, 0x08, 0xcd, 0x0e, 0xf5,
-  0xce, 0xfb, 0xfb, 0x00, 0xe5, 0xeb, 0x20, 0x00, 0xf4, 0xf5, 0xf3, 0x19,
-  0x1e, 0xfa, 0x0d, 0x2d, 0x21, 0xed, 0x1c, 0x0f, 0xe4, 0x0a, 0xe2, 0x19,
-  0xe1, 0x03, 0xf6, 0xfc, 0x01, 0x0e, 0xd7, 0x22, 0x15, 0xd2, 0xab, 0xfa,
-  0x06, 0xe6, 0x32, 0xda, 0x34, 0xcb, 0xef, 0xbe, 0x23, 0x0e, 0xd2, 0xe8,
-  0x2e, 0x08, 0xe5, 0xfc, 0x24, 0x05, 0x11, 0x1a, 0x30, 0xfb, 0x22, 0x2b,
-  0x15, 0xc1, 0x0d, 0x12, 0x28, 0xe0, 0xea, 0xf6, 0x22, 0x12, 0x12, 0xe0,
-  0xce, 0x19, 0xf3, 0xc7, 0x25, 0x04, 0xf3, 0xea, 0xd1, 0xda, 0x05, 0x01,
-  0x27, 0x58, 0xe3, 0x17, 0xf0, 0xda, 0xd5, 0xf6, 0x1d, 0x13, 0xcd, 0x1c,
-  0xe2, 0x22, 0xe8, 0xe9, 0x14, 0xf6, 0xfe, 0x1d, 0x01, 0x21, 0xf2, 0x07,
-  0x25, 0x27, 0xde, 0x44, 0xc9, 0xf5, 0xe9, 0xc2, 0xf4, 0xe9, 0xeb, 0xdd,
-  0x31, 0xf7, 0xfa, 0x20, 0x25, 0xeb, 0xf8, 0xfd, 0xb1, 0x05, 0x15, 0xdf,
-  0x05, 0x06, 0x0d, 0x22, 0xd2, 0x14, 0xef, 0xca, 0x03, 0xe0, 0xe2, 0x0d,
-  0xf9, 0xf5, 0xdb, 0xfc, 0x1a, 0x47, 0xdc, 0x10, 0xcf, 0xde, 0x1a, 0xf8,
-  0x27, 0xe3, 0x22, 0x00, 0xc2, 0x04, 0xf8, 0x0e, 0x01, 0xe1, 0xd0, 0x10,
-  0x07, 0xf5, 0xdb, 0xfc, 0x0f, 0x11, 0x33, 0xd2, 0xf8, 0x17, 0xd7, 0x41,
-  0xdc, 0x65, 0xf8, 0x0a, 0xdd, 0xe4, 0x1a, 0x43, 0x09, 0x36, 0xe6, 0xe7,
-  0xbb, 0xea, 0x15, 0x1b, 0x15, 0xcc, 0x01, 0xd7, 0xf4, 0x40, 0xec, 0xed,
-  0x0b, 0xde, 0xe5, 0xdb, 0xd5, 0xd1, 0xeb, 0x03, 0x37, 0xbd, 0x34, 0xde,
-  0x0f, 0xd5, 0x2d, 0xd9, 0x05, 0xee, 0xe5, 0x53, 0x39, 0x04, 0x53, 0x28,
-  0x0a, 0xc6, 0xc5, 0xed, 0x49, 0x04, 0xe7, 0xd3, 0x00, 0x15, 0x2f, 0xdf,
-  0x22, 0xff, 0x0d, 0x2c, 0x29, 0x22, 0xcf, 0xee, 0xc8, 0x24, 0x3b, 0x5e,
-  0x0e, 0x49, 0x2f, 0x3a, 0xe9, 0x17, 0xed, 0x44, 0x2f, 0xf6, 0xdb, 0x10,
-  0x01, 0x10, 0x14, 0x09, 0x1d, 0x0a, 0x4c, 0xdf, 0xd1, 0x08, 0xe4, 0x00,
-  0xb3, 0xb5, 0x30, 0x95, 0x2a, 0xde, 0x2e, 0x17, 0x2d, 0xee, 0x23, 0x06,
-  0x03, 0xf4, 0x1e, 0x04, 0xfe, 0xb7, 0xc6, 0xfb, 0x04, 0x14, 0x1d, 0xe6,
-  0x44, 0xfd, 0xe2, 0xf3, 0xf2, 0x1a, 0xcc, 0xea, 0x07, 0x3a, 0xf4, 0xbc,
-  0xf9, 0xf2, 0x45, 0xe9, 0x00, 0x58, 0x04, 0x06, 0xb1, 0xe5, 0x01, 0xf5,
-  0x05, 0xe8, 0xed, 0xad, 0x04, 0x34, 0xe7, 0x1e, 0xeb, 0x10, 0x6c, 0xfc,
-  0xeb, 0xeb, 0xc0, 0xef, 0x07, 0xe8, 0x3c, 0xad, 0x41, 0xe8, 0x23, 0x24,
-  0x03, 0xd9, 0x13, 0x43, 0xcd, 0xb6, 0x16, 0xde, 0x2d, 0xd0, 0xd3, 0xe4,
-  0xc6, 0x00, 0xed, 0x3b, 0xfc, 0xf3, 0x37, 0xd2, 0xfc, 0xb9, 0xd6, 0x2b,
-  0xfe, 0x7f, 0x10, 0xf2, 0xf5, 0xfc, 0x1c, 0x2e, 0x33, 0x06, 0x19, 0xef,
-  0xd3, 0xf6, 0x03, 0x15, 0xfd, 0xe9, 0xf1, 0x21, 0x0b, 0x05, 0xd7, 0xc3,
-  0xe9, 0xc8, 0xf9, 0xf3, 0xf1, 0xf4, 0x12, 0xf4, 0x32, 0xe6, 0xf8, 0x08,
-  0xfa, 0xef, 0x23, 0xe0, 0xcf, 0x04, 0xfb, 0xec, 0x2a, 0xeb, 0x28, 0xf3,
-  0x0d, 0x37, 0xfd, 0x00, 0x09, 0xb3, 0xf1, 0x13, 0x28, 0xb5, 0x47, 0xf0,
-  0x0c, 0xb6, 0x0c, 0x03, 0xf5, 0xde, 0xae, 0x31, 0x39, 0xed, 0x28, 0x01,
-  0xe1, 0xee, 0x27, 0x1c, 0xe9, 0xf0, 0xdc, 0xd7, 0xc0, 0xf6, 0x9a, 0x0a,
-  0xf3, 0x16, 0xcc, 0xbf, 0xf2, 0xeb, 0x48, 0xd6, 0xbf, 0xf3, 0xd3, 0xe8,
-  0x0d, 0x0d, 0x30, 0x1e, 0x6d, 0xdb, 0x21, 0x25, 0x00, 0xf0, 0x23, 0xad,
-  0xd1, 0x08, 0x3f, 0xde, 0x21, 0xdd, 0xfd, 0x03, 0x16, 0xff, 0xfb, 0xe8,
-  0x18, 0x06, 0x12, 0xf4, 0x38, 0xe4, 0x48, 0xd6, 0xf7, 0xfb, 0x9d, 0xf3,
-  0x1b, 0xe7, 0x18, 0xf7, 0x2f, 0xef, 0x0c, 0xd2, 0xd6, 0xf5, 0xdb, 0xdd,
-  0xdc, 0xfb, 0xf0, 0xb0, 0xe6, 0xff, 0xde, 0x0d, 0xfe, 0x22, 0x60, 0xd8,
-  0x0c, 0x0c, 0xe9, 0xf6, 0x14, 0x26, 0x1f, 0x2f, 0xd3, 0xd8, 0x41, 0x16,
-  0xeb, 0xfe, 0x23, 0xb8, 0x5e, 0xcf, 0xec, 0xda, 0x08, 0xdc, 0xf1, 0x07,
-  0xe5, 0xda, 0xf1, 0x09, 0xe4, 0x02, 0xe7, 0xd7, 0x00, 0xd0, 0xce, 0x35,
-  0xf9, 0x3a, 0x25, 0xda, 0xbe, 0x21, 0xf1, 0x0a, 0x08, 0x17, 0x02, 0x08,
-  0xf7, 0xd8, 0xf6, 0x16, 0xe5, 0xed, 0x3f, 0xd8, 0xc1, 0x30, 0xfc, 0xcd,
-  0xe4, 0xd3, 0xc9, 0x23, 0xe8, 0x28, 0x10, 0x2a, 0x0e, 0x31, 0x1f, 0xf7,
-  0xdc, 0xf6, 0xf5, 0xbd, 0xcb, 0x04, 0x0c, 0xf4, 0x59, 0xed, 0x34, 0xc9,
-  0x16, 0x1d, 0x2a, 0x11, 0x0b, 0xcd, 0xd5, 0x0f, 0x0b, 0xb8, 0xed, 0x2c,
-  0x19, 0xfa, 0x02, 0xf0, 0x1e, 0x16, 0xc2, 0xde, 0x13, 0x3b, 0x0e, 0x04,
-  0xf6, 0xc5, 0xe8, 0xfc, 0xe6, 0x1b, 0xd2, 0x1b, 0xce, 0x98, 0x49, 0x03,
-  0xe6, 0xbe, 0x1d, 0x18, 0xf7, 0x40, 0x9e, 0x3f, 0xd8, 0x30, 0xe1, 0x67,
-  0x12, 0xe5, 0x21, 0x56, 0x37, 0xcd, 0xd9, 0xfc, 0xf5, 0xea, 0xdf, 0xd8,
-  0x54, 0x1f, 0x1f, 0xc2, 0xf3, 0xfd, 0x20, 0x1d, 0xf4, 0xe9, 0x02, 0x0e,
-  0xdc, 0xf6, 0xfe, 0x16, 0x4a, 0xde, 0x2f, 0xf2, 0x01, 0xea, 0xc1, 0xe3,
-  0x1d, 0xf0, 0xf3, 0x1b, 0x1b, 0xd6, 0xe7, 0xde, 0x07, 0xf3, 0x00, 0x1f,
-  0xf5, 0xf1, 0x01, 0xa3, 0xe3, 0x13, 0x12, 0x22, 0xc2, 0x46, 0xd1, 0x02,
-  0x02, 0x31, 0xff, 0x10, 0xd2, 0x05, 0x3c, 0x20, 0x08, 0xe8, 0xd0, 0xe0,
-  0xd6, 0xcf, 0xf6, 0xf8, 0x39, 0x10, 0x09, 0x0b, 0x03, 0x39, 0x05, 0xfc,
-  0x02, 0x0f, 0xe4, 0xed, 0x36, 0x00, 0x44, 0xe6, 0x3d, 0xce, 0xc7, 0xe8,
-  0xe0, 0xff, 0xf1, 0x17, 0xd4, 0xd3, 0x04, 0xf2, 0xcf, 0x10, 0xde, 0xdd,
-  0x4f, 0xfe, 0xfb, 0xe4, 0x27, 0xed, 0x22, 0xf2, 0xd3, 0xe6, 0x09, 0x0c,
-  0x1a, 0xf8, 0x1b, 0x07, 0x0d, 0x40, 0x30, 0xd1, 0x44, 0xe5, 0x20, 0x3c,
-  0x3e, 0x16, 0xfa, 0x15, 0x1f, 0x14, 0xe7, 0x03, 0x21, 0xf9, 0x04, 0x07,
-  0x14, 0xff, 0x27, 0xf0, 0x08, 0x0c, 0xe7, 0xf1, 0x4e, 0x1e, 0x1d, 0xf7,
-  0x0c, 0xd0, 0xcd, 0xd3, 0xa4, 0x01, 0x3a, 0x20, 0xec, 0x1f, 0xfe, 0xcb,
-  0xdb, 0xf3, 0xe6, 0xca, 0x1c, 0xf4, 0x05, 0xd5, 0x48, 0xe8, 0x27, 0x09,
-  0x10, 0xfa, 0x2c, 0x1a, 0xff, 0xf2, 0x19, 0xf8, 0xfd, 0x51, 0xf4, 0xf9,
-  0x06, 0xc4, 0xe5, 0x2c, 0x0d, 0x1f, 0xc8, 0x05, 0xf0, 0x0e, 0xea, 0x16,
-  0xeb, 0x1e, 0xc9, 0x00, 0xf0, 0xf7, 0x10, 0xee, 0x02, 0x19, 0xb5, 0x09,
-  0x7f, 0x28, 0x01, 0xce, 0x1a, 0xcc, 0xc6, 0x05, 0xf7, 0x2b, 0xe6, 0xfb,
-  0xd4, 0x21, 0xca, 0xdb, 0xe8, 0xfb, 0xc4, 0x23, 0x2c, 0x09, 0xcc, 0xf7,
-  0xe4, 0x05, 0x0e, 0x14, 0xd4, 0xea, 0x23, 0x1a, 0x15, 0x10, 0x1b, 0xc8,
-  0xfb, 0x33, 0xfb, 0x19, 0xe5, 0xe8, 0xda, 0xed, 0xea, 0x18, 0xfc, 0x14,
-  0xe0, 0x21, 0x24, 0x27, 0xe3, 0x14, 0xd5, 0x15, 0x21, 0x1d, 0xde, 0xde,
-  0xd8, 0xe5, 0xee, 0x14, 0xfb, 0xea, 0x2c, 0x23, 0xfb, 0xf5, 0xe5, 0xf6,
-  0xee, 0xff, 0xd9, 0x2f, 0xfd, 0xd5, 0xd6, 0xec, 0xdd, 0xea, 0x16, 0xec,
-  0xc8, 0x1a, 0x39, 0xf2, 0x0b, 0xf3, 0x12, 0xe7, 0xdd, 0xe4, 0xfc, 0xed,
-  0x0a, 0xda, 0xe4, 0x16, 0x33, 0x09, 0x29, 0xd9, 0x21, 0xe7, 0xfb, 0x17,
-  0x2a, 0x0f, 0x09, 0x07, 0xcc, 0x0c, 0x0f, 0x17, 0xe4, 0xe0, 0xee, 0x0b,
-  0x3e, 0xf4, 0xd7, 0xed, 0xeb, 0xfd, 0xfc, 0x06, 0x1c, 0xdc, 0x2a, 0x27,
-  0x1a, 0xd0, 0xd3, 0xf8, 0xed, 0xfe, 0xfa, 0x1d, 0xe4, 0x0f, 0xe3, 0xce,
-  0xe3, 0xc6, 0x2a, 0xd8, 0xb2, 0xf9, 0x27, 0x17, 0x4a, 0xd2, 0x2b, 0x07,
-  0xee, 0x01, 0x12, 0xf4, 0xe9, 0xd9, 0x0c, 0x06, 0xf9, 0x18, 0xe1, 0xd2,
-  0xea, 0xeb, 0xf6, 0x11, 0x11, 0x1e, 0x07, 0x03, 0xdc, 0x0c, 0x0e, 0xf7,
-  0x0a, 0x19, 0xe8, 0x02, 0x1c, 0xf6, 0x05, 0x05, 0xf0, 0xee, 0xdb, 0x05,
-  0x39, 0x32, 0xf8, 0x02, 0xd8, 0xee, 0xd9, 0xd7, 0x14, 0x1b, 0xda, 0xe4,
-  0xc5, 0x2f, 0x0b, 0xd2, 0xea, 0x1e, 0x0a, 0x03, 0xc1, 0xfd, 0xd8, 0xfc,
-  0x00, 0x03, 0x28, 0x17, 0xdb, 0x18, 0xfd, 0x20, 0xf0, 0xdc, 0x03, 0xff,
-  0xfe, 0x25, 0x1b, 0x0f, 0xd3, 0x1f, 0x00, 0x1d, 0xf8, 0x23, 0x17, 0x17,
-  0xd6, 0xf7, 0x33, 0x2a, 0xf6, 0x07, 0xc9, 0xe8, 0x03, 0xf6, 0xfa, 0xca,
-  0xf7, 0xdf, 0xfc, 0x1b, 0xd6, 0xf8, 0x08, 0x1d, 0xb9, 0x3c, 0xe6, 0x24,
-  0x19, 0xfa, 0xd1, 0xf6, 0x1f, 0xcd, 0xcf, 0x14, 0xe2, 0x0d, 0x11, 0x1a,
-  0xde, 0x1b, 0x41, 0x31, 0xc2, 0x33, 0x03, 0xf2, 0xd5, 0xc2, 0x28, 0xbf,
-  0xc7, 0xdc, 0xdb, 0x0e, 0x3a, 0xfe, 0x51, 0xe8, 0xf5, 0x12, 0x2e, 0xf7,
-  0x10, 0x3c, 0x10, 0xf3, 0xc7, 0x23, 0xf8, 0xe8, 0xe8, 0xf7, 0xc4, 0xf5,
-  0x17, 0xf1, 0xf0, 0xe5, 0xd9, 0xff, 0xf0, 0x10, 0x1a, 0xf2, 0x05, 0x17,
-  0xb6, 0x04, 0x91, 0x1a, 0x05, 0x10, 0xdc, 0xf5, 0x0b, 0xd3, 0xe7, 0xfb,
-  0xf7, 0xef, 0xfe, 0x17, 0xe9, 0x16, 0x05, 0x3a, 0xd4, 0x20, 0x02, 0x0f,
-  0xd8, 0xd8, 0x19, 0xf0, 0xd2, 0x13, 0x2d, 0xf0, 0x20, 0x15, 0x35, 0x12,
-  0xcc, 0xdd, 0x35, 0x0d, 0xc4, 0x27, 0xff, 0xff, 0x1c, 0xe5, 0x00, 0xf7,
-  0x21, 0x31, 0xfe, 0xe6, 0xf1, 0xfd, 0xfe, 0x25, 0xd4, 0x14, 0xff, 0x33,
-  0x28, 0x0c, 0xd2, 0x03, 0xba, 0x02, 0xda, 0xe0, 0xf6, 0xfc, 0x17, 0x00,
-  0xeb, 0xfe, 0xfe, 0xe4, 0x07, 0xf9, 0xfd, 0xd9, 0xf2, 0x1e, 0xe9, 0x04,
-  0xc3, 0x0a, 0xf0, 0x39, 0x10, 0xdf, 0x0b, 0xfc, 0x37, 0xe0, 0x1c, 0x25,
-  0xfc, 0x14, 0x3e, 0x07, 0x27, 0xf4, 0x21, 0x0a, 0xe8, 0x17, 0x0a, 0xfa,
-  0xfb, 0x1d, 0xd2, 0x07, 0x0e, 0x25, 0x1c, 0x03, 0x12, 0x05, 0x1d, 0xfc,
-  0x18, 0x17, 0x18, 0xd3, 0x05, 0xf3, 0x7b, 0x06, 0x03, 0xf8, 0xda, 0xfa,
-  0x3e, 0x43, 0xd3, 0x41, 0xfb, 0x16, 0x02, 0x3f, 0x2a, 0x03, 0xef, 0x12,
-  0xfe, 0x25, 0xf9, 0x02, 0x08, 0xf9, 0xb9, 0x55, 0x08, 0x09, 0x16, 0x2f,
-  0x1c, 0x45, 0x0a, 0xeb, 0xfe, 0xfb, 0xb0, 0xde, 0x26, 0xf7, 0xd6, 0x11,
-  0x00, 0xdc, 0xe9, 0x30, 0xd5, 0x0c, 0x2a, 0x2a, 0xf1, 0xdf, 0xe6, 0x01,
-  0xd2, 0xf5, 0xd1, 0xee, 0x44, 0x14, 0xe2, 0x16, 0xe9, 0xee, 0x07, 0xf7,
-  0xeb, 0xdb, 0x27, 0xe8, 0x28, 0x19, 0xf8, 0x3d, 0xea, 0xf9, 0x16, 0x26,
-  0x0f, 0x08, 0xcc, 0xf3, 0x18, 0x0e, 0xbe, 0xf9, 0x48, 0xed, 0x08, 0x1e,
-  0xe8, 0xf2, 0xe5, 0xe8, 0xf8, 0x15, 0x19, 0x15, 0x22, 0x14, 0xbb, 0x07,
-  0x1c, 0x16, 0x1f, 0x1e, 0xf6, 0xdf, 0xca, 0x29, 0xe2, 0xf9, 0x63, 0x19,
-  0x27, 0xf3, 0xfc, 0xe1, 0xe6, 0x1d, 0x33, 0x10, 0x03, 0x1c, 0x17, 0x27,
-  0xf3, 0xd7, 0xeb, 0xee, 0x13, 0x12, 0xeb, 0xff, 0x5c, 0x07, 0xeb, 0x32,
-  0xd9, 0x23, 0x30, 0x45, 0x23, 0xf1, 0xfd, 0xf6, 0x2d, 0x42, 0x81, 0xc1,
-  0x47, 0x15, 0x16, 0x30, 0xf4, 0x23, 0xf8, 0xf3, 0xc0, 0x0b, 0x2a, 0x18,
-  0xfe, 0x0f, 0xdd, 0xe7, 0xf5, 0x22, 0xdc, 0xe1, 0x00, 0x13, 0xe3, 0x09,
-  0x02, 0xd3, 0x0b, 0x1a, 0xdb, 0x28, 0xf2, 0x1b, 0xe4, 0x1b, 0x36, 0xe9,
-  0x2f, 0xf6, 0xa2, 0xe0, 0x07, 0xe5, 0x1b, 0xe8, 0x5e, 0x2b, 0x01, 0x31,
-  0xab, 0x0b, 0x16, 0xfa, 0x11, 0xd4, 0xee, 0xbf, 0x34, 0x20, 0x3e, 0x18,
-  0x16, 0x17, 0x09, 0x26, 0x02, 0xee, 0xf9, 0x1a, 0x2d, 0xee, 0xfc, 0x27,
-  0x1e, 0xf1, 0xf2, 0xc5, 0x19, 0x31, 0x21, 0x16, 0xfe, 0xea, 0xf6, 0xf8,
-  0xeb, 0xd8, 0xc7, 0x3d, 0xc5, 0x05, 0xd4, 0x1e, 0xeb, 0x14, 0xf2, 0x17,
-  0xdb, 0xf5, 0x48, 0xef, 0x05, 0xd8, 0x9c, 0x0d, 0xdb, 0xf8, 0xd1, 0x09,
-  0x12, 0x29, 0x48, 0xe6, 0xdc, 0xf6, 0x29, 0x0b, 0x1e, 0x33, 0x4d, 0xe5,
-  0x10, 0x0d, 0x00, 0xd7, 0xc8, 0x1e, 0xf7, 0xf7, 0x28, 0xda, 0x2f, 0xd9,
-  0x43, 0xf7, 0xf7, 0x0c, 0xe8, 0xf6, 0xf0, 0x15, 0x0b, 0xec, 0xdf, 0x29,
-  0x01, 0xd8, 0x29, 0xe1, 0xfb, 0xfd, 0xa3, 0x17, 0xa6, 0x33, 0x18, 0xf4,
-  0xe2, 0x08, 0xe6, 0x04, 0xe7, 0xfb, 0x4f, 0x01, 0x1a, 0x0a, 0xdc, 0x02,
-  0x0f, 0xc0, 0xcc, 0xfb, 0x44, 0x43, 0xe9, 0xf7, 0x04, 0xf2, 0xde, 0xa2,
-  0xd6, 0x54, 0x51, 0x21, 0x2d, 0xd5, 0x29, 0xf2, 0xf3, 0x1c, 0xec, 0x0b,
-  0x43, 0xe0, 0xee, 0x0b, 0x38, 0x02, 0xf3, 0x07, 0xbb, 0x01, 0xeb, 0x61,
-  0x18, 0x05, 0xd7, 0x13, 0xe3, 0xdd, 0xe4, 0xf5, 0x13, 0xf9, 0xce, 0xee,
-  0xf8, 0xf6, 0x42, 0xf5, 0xcf, 0xda, 0xc2, 0xc8, 0xc8, 0x0f, 0x33, 0xec,
-  0xf3, 0x12, 0xfe, 0x2d, 0x08, 0xd0, 0xe3, 0xc9, 0x20, 0x15, 0xe6, 0xdb,
-  0xdd, 0x1d, 0xc5, 0xd8, 0x02, 0x14, 0x35, 0x0d, 0xdb, 0x05, 0xd9, 0xf5,
-  0x3c, 0xed, 0xe6, 0xef, 0xf3, 0x01, 0xe0, 0xf4, 0x2d, 0x29, 0x0a, 0x01,
-  0xf7, 0xd2, 0xfe, 0xc7, 0x2e, 0x22, 0x2a, 0xbb, 0x14, 0xec, 0xf8, 0xea,
-  0xdf, 0x57, 0xdf, 0x36, 0xea, 0xda, 0xc4, 0xeb, 0xde, 0x09, 0xbb, 0xec,
-  0xf7, 0x1b, 0x59, 0x1e, 0xd0, 0xcc, 0xe0, 0x1c, 0xe4, 0xe8, 0x9c, 0x01,
-  0x3b, 0x25, 0x10, 0xed, 0xf1, 0x29, 0xc1, 0xfb, 0x1a, 0x16, 0x38, 0x04,
-  0xe8, 0x06, 0xe5, 0xfe, 0xe5, 0x1a, 0xf4, 0xed, 0xc4, 0xd9, 0xe1, 0x09,
-  0x19, 0xe9, 0xe6, 0xfa, 0xec, 0xcf, 0xbf, 0x07, 0xee, 0x03, 0x3a, 0xaa,
-  0x1b, 0xf0, 0x13, 0xfd, 0x14, 0x5b, 0xf4, 0x3a, 0xe5, 0x23, 0xe6, 0xf7,
-  0xe3, 0xf9, 0xe0, 0x14, 0x03, 0xdf, 0x1d, 0x4f, 0xce, 0xf5, 0x9b, 0xff,
-  0xf9, 0x0c, 0xc4, 0x00, 0x0d, 0x03, 0x32, 0xed, 0xf1, 0x3c, 0xca, 0xd0,
-  0xf7, 0x0d, 0x18, 0x3a, 0x0b, 0xfe, 0x25, 0x09, 0xcd, 0xea, 0xf9, 0xec,
-  0xf9, 0x01, 0xee, 0x0b, 0xcf, 0x06, 0x21, 0xed, 0xa0, 0xfe, 0xe8, 0x29,
-  0x21, 0xe4, 0xe8, 0xd2, 0x0b, 0xc4, 0xf8, 0xda, 0x17, 0x41, 0xf1, 0x22,
-  0x0a, 0x55, 0x16, 0xf9, 0xd5, 0xd1, 0x1f, 0x22, 0xf7, 0x57, 0xc2, 0x30,
-  0x48, 0xf6, 0xd8, 0xe5, 0x1b, 0xf9, 0x07, 0xe8, 0x14, 0xe9, 0xf6, 0xe6,
-  0xe2, 0x22, 0x00, 0x0b, 0xf4, 0xd2, 0xf2, 0x11, 0x04, 0x0d, 0x1f, 0x21,
-  0x04, 0x1a, 0x01, 0xf4, 0x06, 0xef, 0xea, 0xf0, 0x01, 0x0f, 0xd9, 0xc5,
-  0x17, 0xf0, 0x01, 0xd6, 0x2d, 0x3d, 0x37, 0xe7, 0x0e, 0xf7, 0x0f, 0xf9,
-  0xf1, 0x26, 0x0e, 0x08, 0xf2, 0xff, 0x17, 0xfc, 0xf3, 0xb2, 0x45, 0x13,
-  0xfd, 0x4c, 0xe8, 0x15, 0xfc, 0xee, 0xc5, 0xb0, 0x7f, 0xc8, 0xdb, 0xf6,
-  0x34, 0xb3, 0xed, 0x01, 0xb5, 0x1e, 0x0a, 0x47, 0xdc, 0xdd, 0xec, 0xd2,
-  0xfc, 0xe8, 0x04, 0xff, 0x69, 0x1c, 0xe5, 0xf6, 0xf5, 0xf5, 0x26, 0xdc,
-  0xdf, 0x27, 0xe6, 0xc3, 0xfe, 0xd2, 0xd8, 0xae, 0x38, 0x32, 0x10, 0x00,
-  0x14, 0x2b, 0xcc, 0xf2, 0x37, 0x2f, 0x1f, 0x11, 0xcb, 0xf1, 0x33, 0x35,
-  0xc7, 0xc0, 0x04, 0x10, 0x14, 0x20, 0x09, 0x27, 0x1c, 0xdb, 0x0b, 0xf0,
-  0x36, 0xf8, 0xf9, 0xf4, 0x1b, 0xe6, 0xce, 0xea, 0xd3, 0x53, 0x1f, 0xd9,
-  0xda, 0x2d, 0x07, 0xf4, 0xe7, 0xf9, 0x1c, 0xd8, 0x21, 0x21, 0x29, 0x4e,
-  0xd7, 0x21, 0xda, 0xe7, 0xe0, 0x14, 0xe8, 0xea, 0xf6, 0x16, 0x20, 0xaa,
-  0x47, 0x19, 0x28, 0xf7, 0xfc, 0x20, 0x29, 0xb5, 0x1f, 0x0a, 0x0a, 0x0d,
-  0x15, 0x0c, 0x2c, 0x0d, 0xfa, 0xc2, 0xf2, 0xe6, 0xda, 0x32, 0xcf, 0x1e,
-  0xd9, 0xfa, 0xd0, 0x11, 0x20, 0xf9, 0x14, 0x01, 0xdf, 0xc0, 0xd5, 0x25,
-  0xf7, 0xe4, 0xe0, 0x19, 0x2e, 0xff, 0x07, 0x16, 0x28, 0xdb, 0x10, 0x1a,
-  0x12, 0x05, 0xbd, 0xd6, 0x09, 0xe6, 0xfd, 0xde, 0xcc, 0xef, 0xd3, 0xda,
-  0x31, 0x06, 0x2a, 0x03, 0x09, 0x1b, 0x35, 0x02, 0x00, 0x05, 0x05, 0xdc,
-  0x05, 0x23, 0x13, 0x31, 0xfd, 0xdd, 0xd9, 0xee, 0x0c, 0xcf, 0x0c, 0x16,
-  0x13, 0xfe, 0xe8, 0x13, 0xdf, 0xf7, 0xd5, 0xa8, 0x56, 0xf3, 0xbd, 0x08,
-  0xce, 0xbb, 0xcb, 0xc6, 0xca, 0xce, 0x08, 0xff, 0x29, 0x0d, 0x15, 0x0d,
-  0x3d, 0xfb, 0x0e, 0xb9, 0xef, 0x00, 0x24, 0x05, 0x39, 0xd0, 0x3b, 0xff,
-  0xfd, 0x0c, 0x54, 0xa3, 0x57, 0xc4, 0xdd, 0x0f, 0x04, 0x37, 0xdb, 0x03,
-  0xf1, 0xcb, 0xe2, 0xf8, 0x20, 0x30, 0x04, 0x1b, 0xb9, 0xe4, 0xbd, 0xea,
-  0xec, 0xb9, 0x06, 0x00, 0x18, 0xec, 0xee, 0x02, 0xff, 0x12, 0xe3, 0x11,
-  0x50, 0xf7, 0xd8, 0xeb, 0xd0, 0xd9, 0xdd, 0xe0, 0x17, 0x17, 0x20, 0xe2,
-  0x0b, 0xf8, 0xed, 0xcb, 0x2e, 0xd9, 0x09, 0xfc, 0xfd, 0xdc, 0x37, 0x2e,
-  0x0e, 0xeb, 0x10, 0x0d, 0xcd, 0x0c, 0xe4, 0x07, 0x15, 0x14, 0x19, 0x06,
-  0xfc, 0xfd, 0x31, 0xff, 0xf6, 0x1b, 0x3c, 0x2c, 0xf3, 0xdf, 0x35, 0x01,
-  0xf8, 0xe0, 0xe8, 0xe4, 0x00, 0xbb, 0xfc, 0xc3, 0x4b, 0xfd, 0xf5, 0x0d,
-  0xe4, 0xfe, 0x98, 0x42, 0x15, 0xf2, 0x19, 0xc4, 0xde, 0x0b, 0x0f, 0xee,
-  0x18, 0xd5, 0xfe, 0x38, 0x37, 0xfe, 0xed, 0x22, 0x14, 0xd9, 0xff, 0x00,
-  0xb0, 0x1b, 0x61, 0x0a, 0x0f, 0xd4, 0xda, 0x1b, 0xd2, 0x08, 0xf8, 0xd3,
-  0xf7, 0x22, 0x24, 0xf3, 0xeb, 0xd0, 0xf3, 0x1c, 0xf3, 0x0d, 0xdd, 0xfb,
-  0x06, 0xf5, 0xea, 0xd3, 0x13, 0x35, 0xdf, 0xfe, 0xed, 0xa9, 0x1c, 0xeb,
-  0x19, 0xe6, 0xf3, 0x16, 0x04, 0xf6, 0xd6, 0x2d, 0x09, 0x16, 0x08, 0x01,
-  0xf3, 0x21, 0xe1, 0xe4, 0xef, 0xdd, 0x02, 0xff, 0x24, 0xf9, 0xe8, 0x28,
-  0xfc, 0xd0, 0xf8, 0xe0, 0xcb, 0xfb, 0x2f, 0x39, 0xd6, 0xce, 0xcc, 0x00,
-  0x0d, 0x34, 0xfb, 0xe6, 0xff, 0x0f, 0xf0, 0xee, 0xda, 0x0e, 0xe8, 0x26,
-  0xc3, 0xd3, 0x09, 0x38, 0x2f, 0x0d, 0x06, 0xc7, 0xa7, 0x3c, 0xc2, 0xe0,
-  0xea, 0xda, 0x00, 0x02, 0x47, 0x19, 0x0c, 0xea, 0xe8, 0x18, 0xd0, 0x20,
-  0x1b, 0xf2, 0x0c, 0xde, 0x12, 0x1e, 0xf7, 0xf3, 0x19, 0x03, 0x1a, 0x2b,
-  0x12, 0x17, 0xea, 0x04, 0xf5, 0xd4, 0xe8, 0xd0, 0xb4, 0x11, 0xf5, 0x30,
-  0x16, 0xf6, 0x2a, 0x32, 0xde, 0x1a, 0x18, 0x08, 0x46, 0x43, 0x10, 0xfe,
-  0xb6, 0xf5, 0x0c, 0x22, 0xed, 0xfc, 0xf5, 0x2b, 0xff, 0xea, 0xf8, 0xf5,
-  0x0d, 0x1c, 0x06, 0xdb, 0xe2, 0x1f, 0xe1, 0x0c, 0xd8, 0xf5, 0x55, 0xde,
-  0xe4, 0x35, 0xc5, 0x10, 0xda, 0xe2, 0xf1, 0x39, 0x03, 0xe5, 0x1f, 0x48,
-  0xee, 0x1b, 0x3e, 0xb4, 0xd9, 0xea, 0x26, 0xe8, 0x16, 0xbd, 0x01, 0xa2,
-  0xd2, 0xe4, 0x2b, 0xb7, 0x1e, 0xdd, 0xf9, 0xf4, 0x07, 0xec, 0x2a, 0xd3,
-  0xe7, 0xbb, 0xf4, 0xee, 0x2b, 0x31, 0x44, 0xee, 0xe5, 0xd8, 0xdb, 0xdf,
-  0x17, 0x20, 0xe1, 0x2a, 0x0f, 0xdc, 0xf6, 0x15, 0x00, 0xfc, 0x00, 0xfe,
-  0xd4, 0xc6, 0x15, 0xf6, 0xe6, 0x2f, 0xc0, 0xd9, 0x44, 0xdc, 0xbb, 0xeb,
-  0x22, 0xff, 0x08, 0xb3, 0xb5, 0xfc, 0x40, 0xdd, 0xac, 0xfc, 0x12, 0xe3,
-  0x01, 0xe2, 0x00, 0xe8, 0x30, 0x22, 0x13, 0x9e, 0x36, 0x02, 0x04, 0xe2,
-  0xda, 0xe4, 0x39, 0xd2, 0xe8, 0xdc, 0xc6, 0xd5, 0x1f, 0x57, 0x2e, 0x06,
-  0x13, 0xd9, 0xcf, 0xd6, 0x0f, 0x31, 0xef, 0x13, 0x03, 0x07, 0x28, 0x2a,
-  0x49, 0x30, 0x10, 0xf3, 0x19, 0xf0, 0x54, 0xce, 0xde, 0x24, 0xd2, 0xfb,
-  0xec, 0xdf, 0x00, 0x21, 0x1e, 0x1f, 0xe1, 0xb1, 0xcd, 0x61, 0x26, 0xd8,
-  0xe9, 0xe6, 0x11, 0x0c, 0x07, 0xca, 0xda, 0xe6, 0xbc, 0x20, 0x18, 0xa2,
-  0x0a, 0xec, 0x06, 0x31, 0xff, 0xe2, 0x31, 0xe6, 0xff, 0x1b, 0xfb, 0x0b,
-  0xd6, 0x25, 0x08, 0xe1, 0x23, 0x03, 0xfd, 0x04, 0xe8, 0x5b, 0xba, 0x00,
-  0xc1, 0xf2, 0x31, 0x11, 0xed, 0x15, 0xef, 0x03, 0x39, 0xdb, 0x3b, 0xe7,
-  0xf0, 0xac, 0x99, 0x42, 0xe4, 0xfc, 0xf0, 0xe3, 0xde, 0x2d, 0x1a, 0x16,
-  0x0b, 0x0b, 0x02, 0x25, 0xbf, 0xff, 0xd8, 0xb7, 0x09, 0xc5, 0x13, 0x0e,
-  0xec, 0x1e, 0x16, 0x0a, 0xf9, 0x00, 0xf2, 0xd5, 0xff, 0xe6, 0x3b, 0xbf,
-  0xdf, 0x07, 0xee, 0xf2, 0x3b, 0xfc, 0x2c, 0xcf, 0x3a, 0x0d, 0x19, 0xc7,
-  0xf8, 0xef, 0xca, 0x4c, 0x1f, 0xd9, 0xf8, 0x01, 0xbb, 0xfa, 0xb2, 0xd9,
-  0xec, 0xcf, 0x03, 0xef, 0xdb, 0xe6, 0xb6, 0x1a, 0x1b, 0xd7, 0xeb, 0xdf,
-  0xa9, 0x00, 0x08, 0xb6, 0xbe, 0x02, 0xd9, 0xf3, 0xa2, 0x07, 0xfe, 0xe4,
-  0xd9, 0xc7, 0x05, 0xf0, 0x19, 0xf2, 0xe7, 0x1c, 0xf9, 0xfd, 0xea, 0xa3,
-  0xe9, 0xd7, 0x68, 0xf6, 0xdf, 0x0d, 0xc3, 0x01, 0x09, 0x10, 0xfb, 0xf8,
-  0x31, 0x18, 0x22, 0x08, 0x02, 0x10, 0xeb, 0x43, 0xfe, 0xde, 0x33, 0x13,
-  0x0a, 0x34, 0x03, 0x19, 0x2e, 0xe1, 0x4d, 0xf5, 0xa0, 0x09, 0xe1, 0x10,
-  0xd0, 0x04, 0x2c, 0x20, 0x12, 0x3f, 0xc5, 0x98, 0xdd, 0x35, 0x00, 0xf3,
-  0xba, 0xe4, 0x03, 0x19, 0x0b, 0xa9, 0x08, 0xb9, 0x03, 0xe9, 0x05, 0xf7,
-  0xe5, 0xef, 0xf8, 0x13, 0x0a, 0xde, 0x07, 0xf3, 0xcf, 0x34, 0xde, 0x1b,
-  0x18, 0x0d, 0xeb, 0xc4, 0x33, 0x23, 0x11, 0x21, 0x09, 0xd2, 0xcb, 0xf7,
-  0xf1, 0xd5, 0x57, 0x11, 0x17, 0x24, 0xf7, 0xc7, 0x31, 0x04, 0x53, 0xaf,
-  0x20, 0x14, 0xc2, 0x3b, 0x12, 0x27, 0xe1, 0xe2, 0xb1, 0x0f, 0xfa, 0xfb,
-  0x16, 0x36, 0x2d, 0x49, 0xef, 0x00, 0xd7, 0xf9, 0xe5, 0xe3, 0x2c, 0x0c,
-  0xef, 0xc0, 0x28, 0xf6, 0x50, 0xa6, 0x0a, 0x1c, 0xc5, 0xdc, 0x0a, 0xf2,
-  0x05, 0x4b, 0x1c, 0x11, 0x12, 0xd5, 0x28, 0xd0, 0x01, 0xff, 0x14, 0x12,
-  0x09, 0xa8, 0xdc, 0xf9, 0x13, 0x14, 0xd3, 0x0b, 0xd7, 0xf8, 0xcc, 0xe4,
-  0xd9, 0xfc, 0x67, 0x0c, 0x14, 0xfa, 0xc5, 0x12, 0xf0, 0xf7, 0xea, 0x2c,
-  0xa7, 0xbc, 0xe8, 0xf3, 0xe0, 0x42, 0x03, 0x51, 0xd2, 0xdf, 0xf7, 0xf5,
-  0x1b, 0xf3, 0x55, 0xfa, 0xe3, 0xea, 0x17, 0x0b, 0x0e, 0x01, 0xf3, 0xfd,
-  0xc1, 0xd8, 0xfd, 0x2a, 0xfc, 0xdf, 0x13, 0xf1, 0xed, 0xf4, 0x09, 0xd5,
-  0xe2, 0xf3, 0x0b, 0x62, 0xbb, 0xd5, 0xf7, 0xeb, 0x27, 0xda, 0xeb, 0xff,
-  0xe6, 0xea, 0x16, 0xc8, 0x34, 0x1a, 0x4f, 0x05, 0xe3, 0x15, 0xcc, 0x1d,
-  0x37, 0x0c, 0xf0, 0x19, 0xf0, 0xf9, 0xfa, 0xe1, 0x0e, 0x10, 0xec, 0x29,
-  0x19, 0xd5, 0xe3, 0x49, 0xfd, 0xe5, 0x1b, 0xe9, 0x0c, 0xa4, 0xe6, 0x36,
-  0x32, 0xfa, 0x0e, 0xe9, 0xc2, 0xef, 0xe8, 0x1e, 0xc4, 0x26, 0x26, 0xe3,
-  0x29, 0x22, 0xff, 0xc7, 0x28, 0xc9, 0xfb, 0x7f, 0x0e, 0xb8, 0x47, 0xef,
-  0x3b, 0xd3, 0x01, 0xda, 0x06, 0x09, 0x2f, 0xfe, 0xfc, 0x02, 0x10, 0xd2,
-  0xe6, 0xc4, 0xd3, 0xe7, 0xf7, 0xc8, 0x21, 0x21, 0xfd, 0x0a, 0x17, 0xe8,
-  0x15, 0xbf, 0x0e, 0x0a, 0xfa, 0xdf, 0xd8, 0x43, 0x0a, 0xc9, 0xed, 0xfb,
-  0xe5, 0xf5, 0x0b, 0x21, 0xed, 0xe9, 0xd9, 0x08, 0x25, 0xfe, 0x0d, 0xac,
-  0x0f, 0xac, 0x40, 0xcf, 0xf7, 0x31, 0xf1, 0x2b, 0x1c, 0xf3, 0x46, 0xed,
-  0x1d, 0x10, 0xee, 0x26, 0x07, 0xdf, 0xde, 0xec, 0x0e, 0x40, 0x01, 0xf2,
-  0x12, 0xc5, 0x20, 0xcb, 0xf3, 0xd6, 0xbc, 0xdb, 0x11, 0xbf, 0xe5, 0x0a,
-  0x2e, 0xfa, 0x2d, 0x9c, 0x1c, 0x03, 0x49, 0x19, 0xc1, 0x26, 0xff, 0xc3,
-  0x16, 0xcb, 0xe5, 0x1d, 0x02, 0xf0, 0xef, 0xeb, 0x0b, 0xdc, 0xd5, 0xf2,
-  0xfe, 0x08, 0xd6, 0xe0, 0xec, 0x02, 0x2a, 0xdc, 0xe8, 0xf4, 0x1a, 0x04,
-  0xf6, 0xe6, 0x24, 0xe1, 0x12, 0x3f, 0xf4, 0x04, 0x04, 0xc7, 0x03, 0x35,
-  0xfa, 0x2d, 0xdb, 0xe9, 0x00, 0x29, 0x0c, 0xc2, 0x13, 0xde, 0xe1, 0xd6,
-  0xfe, 0x0b, 0xe6, 0xf9, 0xcf, 0xf4, 0x32, 0xd0, 0x1d, 0xfa, 0x52, 0x0e,
-  0x09, 0x27, 0x25, 0xcc, 0x37, 0xe8, 0x10, 0x03, 0xe3, 0xa2, 0xfc, 0x30,
-  0x32, 0xf5, 0x15, 0xfe, 0xde, 0xff, 0xf2, 0xb7, 0xe1, 0x1c, 0x20, 0xfd,
-  0xdd, 0x14, 0xe6, 0xe9, 0xd6, 0xcd, 0x2b, 0xec, 0x25, 0xe9, 0xe5, 0xd7,
-  0xb8, 0xc6, 0xe4, 0x24, 0xef, 0xfa, 0x1b, 0xff, 0xf1, 0xdf, 0xe0, 0x01,
-  0xd6, 0x34, 0xd9, 0xdd, 0xd5, 0xfa, 0x25, 0xf9, 0x21, 0x2a, 0xcd, 0x03,
-  0x1c, 0xd9, 0x11, 0xf4, 0x18, 0xf7, 0x05, 0x45, 0xed, 0x11, 0x06, 0xe2,
-  0xfb, 0xfe, 0x02, 0xe5, 0xdc, 0xc4, 0xe9, 0x16, 0x1d, 0xf7, 0x15, 0xe1,
-  0x06, 0x0a, 0x52, 0x00, 0xf9, 0x10, 0xf1, 0xd3, 0xd0, 0xce, 0x24, 0xfe,
-  0x1b, 0x07, 0x26, 0x08, 0xd4, 0x26, 0xb5, 0xea, 0xe8, 0xff, 0x0a, 0xff,
-  0x11, 0xe1, 0xf8, 0x22, 0xf4, 0x14, 0xdc, 0x16, 0xea, 0xbd, 0x15, 0x18,
-  0x18, 0xfe, 0xea, 0xdd, 0x22, 0x24, 0x1d, 0x20, 0xe5, 0x16, 0xf1, 0xc6,
-  0xf2, 0x01, 0x20, 0xc3, 0xea, 0x31, 0x0d, 0xc8, 0xe7, 0xe8, 0xe5, 0xf4,
-  0x0c, 0xf6, 0x04, 0x1c, 0x14, 0x03, 0x2c, 0xd5, 0x0f, 0x09, 0xe6, 0xc0,
-  0xf1, 0xf4, 0xec, 0xda, 0xd1, 0x28, 0x39, 0xd1, 0xb3, 0x0f, 0x14, 0xe7,
-  0x0c, 0x1b, 0xb3, 0xf4, 0xfc, 0xae, 0xe6, 0x0e, 0x37, 0x0d, 0xd1, 0x16,
-  0x05, 0xcd, 0xdf, 0xe4, 0xf5, 0x26, 0xe9, 0x17, 0xe0, 0x35, 0x25, 0x05,
-  0x01, 0x28, 0x26, 0xea, 0x19, 0xe7, 0xfb, 0x00, 0xf8, 0x2f, 0x23, 0xf8,
-  0xf0, 0xd7, 0x23, 0xd5, 0xcb, 0xf0, 0xe4, 0xf1, 0xfc, 0x0c, 0xea, 0x07,
-  0xf3, 0x15, 0xf7, 0xe2, 0xf6, 0xdd, 0xe1, 0xf2, 0xf0, 0x0d, 0xfa, 0xd7,
-  0xce, 0xe7, 0x60, 0x01, 0x1a, 0x1d, 0x15, 0xc4, 0xd0, 0xf7, 0xf9, 0x15,
-  0x01, 0x23, 0xc0, 0xe8, 0x1c, 0xcc, 0x02, 0xde, 0x28, 0x24, 0xf2, 0xe8,
-  0xc0, 0xe8, 0xf4, 0xf2, 0x26, 0x28, 0xd7, 0xf9, 0xdb, 0xd8, 0xe5, 0xcf,
-  0xfa, 0xfe, 0xc8, 0xd1, 0xd1, 0xf9, 0xe5, 0x57, 0xff, 0x21, 0x10, 0x06,
-  0xf0, 0xf7, 0x37, 0x16, 0xf6, 0x26, 0x03, 0xd7, 0x0b, 0xfe, 0x11, 0x15,
-  0x27, 0xe8, 0x00, 0xee, 0x81, 0x2b, 0xfc, 0xf1, 0xe4, 0x3c, 0xf5, 0xdd,
-  0xe3, 0x07, 0x07, 0x3c, 0x05, 0x0c, 0xd5, 0xe3, 0x0b, 0xb4, 0xee, 0x1d,
-  0x17, 0x13, 0xd7, 0x0a, 0xdc, 0x15, 0xff, 0x18, 0xf7, 0xfa, 0xdd, 0xf3,
-  0xe9, 0xdb, 0x27, 0xd0, 0x1d, 0xea, 0x14, 0xf1, 0xdc, 0x1a, 0x02, 0x13,
-  0x09, 0x0c, 0x3d, 0x00, 0xc5, 0xdc, 0x1c, 0xf4, 0x08, 0x13, 0xe7, 0xd0,
-  0xef, 0x08, 0x04, 0x10, 0x10, 0xd8, 0x16, 0xd5, 0xa3, 0x01, 0xfc, 0xf6,
-  0xef, 0x24, 0xdb, 0xe8, 0xd0, 0xba, 0xd5, 0x1b, 0x0b, 0x21, 0xc7, 0x2f,
-  0x10, 0xf0, 0xc1, 0xca, 0x59, 0x02, 0xcd, 0x0b, 0xf5, 0x66, 0xd4, 0x1d,
-  0xd1, 0x01, 0xe1, 0x03, 0xea, 0x2f, 0xee, 0xf2, 0x1c, 0x0a, 0xff, 0xe7,
-  0xd4, 0xb4, 0xf2, 0xe9, 0xed, 0x1a, 0xed, 0xe6, 0xfe, 0xe5, 0xec, 0x02,
-  0x1b, 0x00, 0xf8, 0xe6, 0xea, 0x0a, 0x0e, 0x1e, 0xfd, 0xb3, 0xf5, 0xf8,
-  0x04, 0x0e, 0x26, 0x0c, 0x34, 0x14, 0x03, 0xd0, 0x17, 0x03, 0xec, 0xe9,
-  0xe4, 0x2a, 0x1c, 0x0a, 0x47, 0x13, 0xff, 0xe9, 0xec, 0xf6, 0x04, 0xef,
-  0x03, 0x10, 0x13, 0x04, 0x0a, 0xf4, 0xd9, 0x2a, 0x0b, 0x0a, 0xf2, 0xe7,
-  0x33, 0xde, 0xf2, 0x3c, 0xda, 0x00, 0xeb, 0xb6, 0xf9, 0xec, 0x24, 0x04,
-  0x0f, 0x1a, 0x07, 0xf2, 0xf7, 0xed, 0xb5, 0x30, 0x20, 0x30, 0xf8, 0x1e,
-  0xce, 0x1b, 0xf2, 0x28, 0x9f, 0xf6, 0xf2, 0xfa, 0x40, 0x1d, 0x10, 0xda,
-  0x06, 0xf3, 0xfc, 0xc5, 0xe7, 0x24, 0xfb, 0x0c, 0x06, 0xdb, 0x10, 0x01,
-  0xc0, 0x10, 0xf2, 0x32, 0x0c, 0x11, 0x0c, 0x44, 0x3e, 0x11, 0xf3, 0x48,
-  0xc1, 0xe0, 0xfd, 0x1b, 0x11, 0xf7, 0xee, 0x20, 0xd3, 0xee, 0xee, 0xe5,
-  0x0c, 0xe4, 0x1f, 0xf3, 0xfa, 0xf2, 0xf4, 0xd8, 0xb7, 0xf9, 0xdf, 0x0e,
-  0xde, 0x2c, 0x12, 0x18, 0xe5, 0x10, 0x01, 0x21, 0xe8, 0xec, 0xf2, 0x0f,
-  0x02, 0xf9, 0x20, 0x9f, 0xf4, 0x3d, 0xdd, 0xe3, 0xda, 0xdd, 0x0e, 0xf7,
-  0x03, 0xf6, 0xee, 0xcb, 0xe8, 0x02, 0x0d, 0x14, 0xdb, 0x10, 0x37, 0x1d,
-  0x0a, 0x0e, 0xea, 0xe1, 0xcd, 0x39, 0x25, 0xe9, 0x69, 0xdb, 0xf8, 0xc1,
-  0xf6, 0xf9, 0x08, 0x0c, 0x15, 0xc6, 0xe8, 0x34, 0x14, 0xee, 0xe2, 0xfa,
-  0xec, 0x00, 0x2d, 0x26, 0xfb, 0x35, 0x15, 0xfd, 0x1c, 0x20, 0xe8, 0xe2,
-  0x04, 0x0f, 0x0e, 0x18, 0xfd, 0x35, 0x17, 0xfc, 0xf5, 0x13, 0xf8, 0xc0,
-  0xd2, 0x04, 0x2c, 0x2b, 0xed, 0xff, 0x04, 0x1a, 0x03, 0xf3, 0xe5, 0x26,
-  0xf0, 0xe6, 0xdf, 0x0b, 0xe7, 0x05, 0xc4, 0xe4, 0xe4, 0x32, 0x12, 0xb2,
-  0xe3, 0xc7, 0x12, 0x14, 0xf9, 0x1a, 0x00, 0xf2, 0xd8, 0xfe, 0x0a, 0x16,
-  0x0d, 0x0e, 0xe5, 0x0e, 0xee, 0xf4, 0xa0, 0xe9, 0x04, 0xd9, 0x34, 0x19,
-  0xfb, 0x21, 0xe4, 0xf4, 0xfb, 0x22, 0x08, 0xf5, 0x27, 0x31, 0x08, 0x2d,
-  0xff, 0xe9, 0xf0, 0xf9, 0xd0, 0x1f, 0xfe, 0x1b, 0x09, 0xea, 0x07, 0x2e,
-  0xf4, 0x0c, 0xde, 0x38, 0xf6, 0x09, 0xdc, 0x03, 0xe9, 0x02, 0xce, 0x38,
-  0xc5, 0xfc, 0xe6, 0x00, 0xda, 0xca, 0x0d, 0xe1, 0xdf, 0xe0, 0x15, 0xef,
-  0x0d, 0xf7, 0x05, 0xe3, 0x01, 0x1d, 0xfc, 0x0b, 0xea, 0xff, 0xd6, 0x05,
-  0xf5, 0xf5, 0x34, 0x02, 0xd8, 0xfe, 0x08, 0x16, 0xe7, 0xff, 0x05, 0xe9,
-  0x22, 0x17, 0xf1, 0xe6, 0x16, 0x11, 0xdc, 0x09, 0xb3, 0x08, 0xfa, 0x4b,
-  0x24, 0x05, 0x57, 0x45, 0x04, 0xc2, 0x05, 0xdb, 0xda, 0x35, 0xc7, 0x09,
-  0xe9, 0xf7, 0xeb, 0x18, 0xe2, 0x01, 0xf9, 0xb6, 0x09, 0xd9, 0xf2, 0xe9,
-  0x01, 0x24, 0x01, 0xe8, 0x02, 0xe8, 0xff, 0xed, 0xf6, 0x1f, 0xf7, 0x20,
-  0xcd, 0x18, 0xf4, 0x0c, 0x18, 0xf2, 0x27, 0xfa, 0x0a, 0x37, 0x1b, 0xfc,
-  0x0b, 0x2c, 0xd9, 0xde, 0xf4, 0x19, 0xf1, 0x4b, 0x21, 0xf8, 0xdf, 0x00,
-  0x23, 0x18, 0x06, 0x0e, 0xdb, 0x39, 0xed, 0xf5, 0xf1, 0x01, 0x29, 0x34,
-  0xee, 0xf2, 0xd1, 0x0d, 0x2c, 0xe4, 0xf8, 0xc7, 0xc6, 0xe8, 0x2f, 0xb2,
-  0xef, 0xc0, 0xf4, 0xef, 0x74, 0xe7, 0xf9, 0x23, 0xe6, 0x01, 0x2c, 0xfd,
-  0xfd, 0x2d, 0xd6, 0xfa, 0xf0, 0x03, 0x81, 0xe3, 0xff, 0xf5, 0x38, 0x05,
-  0x10, 0x15, 0xfd, 0xff, 0x2a, 0xfa, 0xf3, 0x0a, 0x2b, 0xfb, 0xef, 0x62,
-  0x0c, 0xd8, 0xd8, 0xf1, 0x03, 0x12, 0xf5, 0xfc, 0xfb, 0x17, 0xf5, 0x05,
-  0xf2, 0xf6, 0xff, 0x15, 0xd7, 0x1f, 0xc7, 0x06, 0xeb, 0x0f, 0xdb, 0xec,
-  0xc4, 0x16, 0xd2, 0xd8, 0xcc, 0xcd, 0x2b, 0xd2, 0x45, 0xc5, 0xf2, 0xeb,
-  0x1c, 0x06, 0x23, 0xf3, 0x30, 0x03, 0xec, 0xe3, 0xfe, 0x0a, 0xd6, 0xff,
-  0xea, 0x07, 0x16, 0x15, 0xec, 0x25, 0x27, 0xd8, 0x1b, 0xd1, 0x05, 0x0c,
-  0xde, 0x1f, 0xc9, 0x49, 0xfa, 0xc9, 0xda, 0xf2, 0xff, 0x02, 0xf4, 0x07,
-  0xf9, 0x49, 0xf0, 0x39, 0x0e, 0xdd, 0x20, 0xf0, 0xc9, 0x1b, 0xe1, 0x2a,
-  0x29, 0x05, 0xe9, 0x21, 0x26, 0xe9, 0x04, 0xc0, 0xc9, 0xd6, 0xf6, 0x1e,
-  0x59, 0x1b, 0xf6, 0xd0, 0x01, 0xff, 0x18, 0xd8, 0xf7, 0xfb, 0xe4, 0x0f,
-  0xf0, 0x12, 0xd3, 0xeb, 0xdf, 0x11, 0x43, 0xed, 0x04, 0x0a, 0x38, 0xfb,
-  0xfa, 0x03, 0xfb, 0x29, 0xf3, 0x37, 0x2d, 0x17, 0x35, 0x38, 0x3e, 0xde,
-  0xd7, 0x1f, 0x13, 0xeb, 0x46, 0xe9, 0xeb, 0xfb, 0x12, 0x07, 0xeb, 0xfb,
-  0x04, 0xf4, 0xe0, 0x14, 0x41, 0x08, 0x01, 0x4f, 0xd5, 0xc2, 0x1e, 0x06,
-  0xcb, 0xc6, 0x30, 0xdb, 0xcf, 0xe6, 0x19, 0x3e, 0xe2, 0x07, 0xe8, 0xcf,
-  0xfa, 0xf3, 0xbf, 0x11, 0xf7, 0x50, 0xea, 0xea, 0x35, 0x03, 0xdd, 0x39,
-  0x25, 0x4f, 0x0b, 0xf5, 0x44, 0xc2, 0x7f, 0xf6, 0xae, 0x29, 0x17, 0xfa,
-  0x40, 0x4b, 0x60, 0xdc, 0xb0, 0x2a, 0xe5, 0x78, 0x2d, 0x4a, 0xd7, 0xfd,
-  0xb3, 0xdd, 0x06, 0x1d, 0x30, 0xd1, 0xd7, 0xe7, 0xcf, 0xe1, 0x76, 0x07,
-  0xe3, 0xd8, 0xe9, 0xd6, 0xe5, 0xe8, 0x46, 0x28, 0xe7, 0xe1, 0xe9, 0x2f,
-  0x13, 0xf0, 0x20, 0xed, 0x01, 0x45, 0xe0, 0x0b, 0x01, 0x32, 0x10, 0x0a,
-  0xd9, 0x5c, 0xd9, 0xc4, 0xe0, 0xdf, 0x43, 0x6b, 0x35, 0x2e, 0x08, 0xf5,
-  0xcd, 0x1f, 0x07, 0x00, 0x18, 0x65, 0x37, 0x1f, 0xec, 0x20, 0x0a, 0x1c,
-  0x1b, 0x09, 0x21, 0x24, 0x01, 0xe3, 0xd0, 0xe0, 0x3a, 0x38, 0xc1, 0x02,
-  0x2d, 0xee, 0x01, 0xb9, 0xfc, 0xef, 0x31, 0xf7, 0xe6, 0xe3, 0x35, 0x67,
-  0xf6, 0xda, 0xf2, 0x34, 0xe6, 0xb5, 0x26, 0x3b, 0xe3, 0x0e, 0xc8, 0xee,
-  0x10, 0x35, 0x15, 0xde, 0x14, 0x39, 0xe1, 0x2c, 0xd0, 0x09, 0x3b, 0xbb,
-  0x19, 0x16, 0xe2, 0xca, 0x4d, 0x23, 0x47, 0x1d, 0x28, 0xe4, 0xf4, 0x9e,
-  0xea, 0xef, 0x2b, 0xca, 0x40, 0xd6, 0x2b, 0x4e, 0x39, 0xb4, 0xd0, 0xc6,
-  0xe6, 0x5c, 0xd6, 0x0a, 0x16, 0x01, 0x38, 0x00, 0xde, 0xad, 0x42, 0x0d,
-  0x0d, 0xe3, 0x05, 0xb5, 0x32, 0x06, 0xd2, 0xf9, 0x34, 0x2e, 0xd7, 0xbc,
-  0x21, 0x18, 0xcc, 0xe0, 0x57, 0x4c, 0xf3, 0x10, 0xd0, 0xe8, 0xfa, 0xf3,
-  0xf6, 0x48, 0xfe, 0xe2, 0x13, 0xf5, 0x63, 0xfa, 0x12, 0xfe, 0x0b, 0xee,
-  0x3c, 0xe2, 0x0d, 0xf2, 0x0f, 0x1f, 0xf7, 0x0c, 0x14, 0x42, 0xe8, 0x47,
-  0xbd, 0xd8, 0xe6, 0xed, 0x1f, 0x0b, 0x2f, 0xd7, 0xea, 0x1f, 0x71, 0xef,
-  0xc7, 0xed, 0x4f, 0xac, 0x44, 0xe4, 0x3f, 0xdf, 0x04, 0x0a, 0xc7, 0xf4,
-  0xf9, 0x28, 0x21, 0xa9, 0x27, 0x2b, 0xd8, 0xf1, 0x36, 0x3a, 0xda, 0x0d,
-  0xc0, 0x2c, 0x09, 0xd4, 0xd3, 0xfb, 0xd5, 0xfd, 0x1d, 0x30, 0x53, 0x09,
-  0xfd, 0x11, 0xee, 0xdf, 0x63, 0xbe, 0x13, 0xfa, 0xd1, 0x10, 0x39, 0xde,
-  0xe2, 0x56, 0x05, 0x14, 0x1f, 0xbf, 0xa7, 0xf0, 0x0b, 0x3f, 0x14, 0xd5,
-  0x3c, 0x12, 0x2c, 0xbc, 0xd5, 0xb9, 0x21, 0x17, 0x1a, 0xec, 0x14, 0x17,
-  0x24, 0xf2, 0x1d, 0xda, 0x18, 0xbe, 0x26, 0x14, 0x35, 0xd7, 0xe8, 0xf3,
-  0x27, 0x38, 0xd4, 0xf8, 0xc0, 0x16, 0xff, 0xe0, 0xd3, 0x3d, 0x22, 0xe4,
-  0xea, 0xe5, 0xf6, 0xff, 0x08, 0x49, 0xef, 0x03, 0x10, 0xdd, 0xb0, 0xa5,
-  0x1e, 0xee, 0x16, 0xeb, 0x2d, 0xe3, 0xfe, 0xf2, 0x10, 0x12, 0x02, 0xd9,
-  0xf6, 0x35, 0xcb, 0xca, 0xa8, 0xe2, 0x22, 0x29, 0x38, 0x9b, 0xe3, 0xe3,
-  0x53, 0xbf, 0xee, 0xdc, 0xe5, 0x05, 0xda, 0xb1, 0x00, 0x04, 0xda, 0x95,
-  0x39, 0xe0, 0x18, 0xb1, 0x2a, 0xe5, 0x33, 0x19, 0xd7, 0x1c, 0xb9, 0xd4,
-  0xbf, 0xf3, 0x05, 0x2a, 0x2a, 0xb7, 0x10, 0x23, 0x01, 0x53, 0xe9, 0x09,
-  0xe9, 0xdd, 0xde, 0xe8, 0x41, 0xd6, 0xeb, 0xe6, 0x4c, 0x20, 0x2a, 0xfb,
-  0xa1, 0xf2, 0xf2, 0xde, 0x1a, 0x0b, 0xaf, 0xa8, 0x11, 0x0e, 0x27, 0x42,
-  0xc4, 0xf6, 0x13, 0xe8, 0xe5, 0xcc, 0x48, 0x38, 0xeb, 0xf2, 0xe1, 0xdd,
-  0x02, 0x19, 0xf1, 0xe9, 0x40, 0xfd, 0x33, 0x00, 0xce, 0x05, 0x4e, 0xe6,
-  0xfd, 0x34, 0xf5, 0xc3, 0xe6, 0xde, 0xf6, 0xe5, 0x1c, 0xee, 0x24, 0x54,
-  0x04, 0x25, 0xb3, 0x00, 0x20, 0xbc, 0xe0, 0xc0, 0x05, 0xb5, 0x30, 0xa1,
-  0xee, 0x1e, 0xf4, 0xf1, 0xfb, 0x12, 0x14, 0xc0, 0xf9, 0x47, 0x42, 0xe5,
-  0x06, 0x0b, 0xcc, 0x0e, 0x24, 0xca, 0xed, 0x13, 0x2b, 0xd9, 0x03, 0x32,
-  0xe3, 0xd4, 0x4e, 0xc5, 0x0e, 0xd7, 0xeb, 0x01, 0x40, 0xbb, 0x3a, 0x9c,
-  0xe0, 0x27, 0x50, 0xee, 0xf6, 0x28, 0xe3, 0xc7, 0xf2, 0x01, 0x1f, 0x0e,
-  0x00, 0xaa, 0x1d, 0xe4, 0xc2, 0x2c, 0xea, 0xea, 0x09, 0xea, 0xeb, 0xf6,
-  0x07, 0x24, 0xf0, 0xf1, 0x0f, 0x27, 0xd5, 0xf3, 0xd1, 0xf6, 0x05, 0x1b,
-  0xeb, 0xf9, 0x0e, 0x36, 0x00, 0xc1, 0x31, 0x00, 0x0d, 0x11, 0xe2, 0xcd,
-  0xfd, 0xfc, 0xe2, 0x16, 0x19, 0xf4, 0x03, 0xf7, 0x05, 0x19, 0x27, 0x29,
-  0x0d, 0xfa, 0xfe, 0xd8, 0x02, 0xfb, 0x02, 0x10, 0x0e, 0x3e, 0x1e, 0xed,
-  0xf6, 0xf1, 0xfb, 0x08, 0x23, 0xde, 0x13, 0x28, 0xc8, 0x19, 0xee, 0xf4,
-  0x00, 0xfd, 0x20, 0xe7, 0x0d, 0x12, 0x16, 0xe0, 0x33, 0x27, 0xd9, 0x16,
-  0x09, 0xf9, 0x05, 0x14, 0x02, 0x4c, 0x47, 0x19, 0xdb, 0xe6, 0x2e, 0xe3,
-  0x14, 0x1c, 0x02, 0x12, 0x13, 0x10, 0xdd, 0xee, 0xf9, 0x03, 0xff, 0xc2,
-  0x1e, 0x0e, 0x01, 0x10, 0xf8, 0x05, 0x07, 0xc9, 0x0a, 0x01, 0xdc, 0xfa,
-  0x11, 0x32, 0x0a, 0x46, 0x1e, 0x2c, 0x1a, 0x24, 0x30, 0x06, 0xe0, 0x02,
-  0xce, 0x21, 0x18, 0x09, 0x0d, 0xee, 0x1d, 0xeb, 0x05, 0xe6, 0xcb, 0xe2,
-  0x40, 0xf6, 0x09, 0x29, 0xee, 0x02, 0xeb, 0x0f, 0xfd, 0x12, 0xee, 0x0f,
-  0xd7, 0xee, 0x1a, 0xff, 0x09, 0xfd, 0xeb, 0x13, 0x07, 0x04, 0xda, 0x05,
-  0xff, 0xf8, 0xdb, 0xed, 0xe2, 0x0e, 0x17, 0xe3, 0xda, 0xf5, 0xf5, 0x04,
-  0x07, 0xfd, 0xda, 0xfd, 0xfc, 0x40, 0x2a, 0x27, 0xf7, 0x19, 0x03, 0xfd,
-  0x01, 0x04, 0xff, 0x12, 0xd9, 0x24, 0xfa, 0x2e, 0xfa, 0x07, 0x08, 0x05,
-  0xfe, 0x29, 0xee, 0x0b, 0x03, 0x05, 0xe5, 0xdc, 0xde, 0xfd, 0x08, 0x00,
-  0x0f, 0x1e, 0xcd, 0x20, 0x10, 0x0f, 0x07, 0xda, 0x01, 0xf9, 0xf7, 0xfe,
-  0x09, 0xdf, 0x15, 0xe7, 0x08, 0xf8, 0x07, 0xd2, 0xd3, 0x29, 0xf4, 0x2f,
-  0x63, 0x15, 0x23, 0x04, 0xf2, 0x0e, 0x34, 0xde, 0x22, 0x12, 0x04, 0xf9,
-  0x03, 0xd4, 0xfa, 0xf5, 0xd1, 0xdc, 0x11, 0x06, 0xbf, 0xf8, 0xfd, 0x1c,
-  0x05, 0x19, 0x1e, 0x03, 0x3d, 0x06, 0x0e, 0x2c, 0x32, 0x12, 0x06, 0x04,
-  0xf5, 0xf3, 0xd1, 0xf8, 0xfb, 0x23, 0xee, 0x1b, 0xdf, 0x03, 0x4a, 0xf1,
-  0x27, 0x0c, 0xf6, 0x38, 0x02, 0x09, 0x15, 0xd8, 0xcc, 0x08, 0xe4, 0xda,
-  0xeb, 0xe5, 0xf1, 0x63, 0x1d, 0x12, 0x09, 0x3e, 0x04, 0x08, 0x17, 0xdb,
-  0xfe, 0xf4, 0x0c, 0x02, 0x1d, 0xf5, 0x1f, 0xe0, 0xce, 0x13, 0x20, 0xfa,
-  0xfe, 0x1d, 0xfc, 0x14, 0x28, 0xf0, 0x0b, 0xeb, 0x30, 0xd6, 0xe2, 0x1a,
-  0xfc, 0xdc, 0x15, 0x06, 0x00, 0x0f, 0x04, 0xea, 0x00, 0x0b, 0xcb, 0x37,
-  0xd7, 0xd9, 0xff, 0x07, 0xfc, 0xd7, 0xe4, 0x1f, 0x09, 0xff, 0x08, 0xb0,
-  0xdc, 0x05, 0xda, 0x04, 0xd1, 0xe7, 0xe7, 0x17, 0xfa, 0xfc, 0x0e, 0x3f,
-  0x14, 0xf1, 0x01, 0xeb, 0xfa, 0x08, 0xe9, 0xfe, 0x25, 0xec, 0x29, 0x0a,
-  0xe6, 0x03, 0xee, 0xe9, 0x02, 0x1e, 0x19, 0xec, 0x32, 0x00, 0x15, 0xe8,
-  0xe9, 0xe7, 0xea, 0x38, 0xe8, 0x2b, 0x04, 0x08, 0xf0, 0xe8, 0x2b, 0xee,
-  0xe3, 0x1b, 0xf4, 0xf3, 0xea, 0x21, 0x07, 0xd4, 0xfb, 0x0f, 0x33, 0x9b,
-  0xe5, 0xc1, 0x18, 0xf5, 0x19, 0xf6, 0x22, 0xdc, 0xda, 0x0d, 0x05, 0xe2,
-  0x2e, 0xf2, 0xf6, 0x2e, 0xf4, 0x02, 0x3d, 0x04, 0x03, 0xdc, 0xf3, 0xf8,
-  0xea, 0xeb, 0xfb, 0xfa, 0x04, 0xe0, 0x19, 0xf4, 0xe7, 0x19, 0x0d, 0xbf,
-  0x04, 0xf5, 0x37, 0x11, 0x26, 0xee, 0x03, 0x0f, 0xfb, 0x00, 0xf8, 0x0d,
-  0xf7, 0xf6, 0x21, 0x08, 0xa9, 0xea, 0xec, 0xf9, 0xf7, 0xf2, 0x0f, 0xe1,
-  0xf5, 0xe2, 0x1e, 0xad, 0xe3, 0xd8, 0x23, 0xf4, 0x22, 0x04, 0x2a, 0xd1,
-  0xea, 0xed, 0x09, 0xf8, 0x16, 0xed, 0x11, 0x04, 0xe0, 0xec, 0x7f, 0xf2,
-  0xce, 0x0f, 0xe5, 0xe2, 0xe4, 0xe2, 0x18, 0xd8, 0x05, 0xea, 0x23, 0x1e,
-  0xd1, 0x21, 0x13, 0xf1, 0x1e, 0xfa, 0x38, 0x07, 0x2d, 0xf1, 0xd5, 0x0f,
-  0xeb, 0xf0, 0x2a, 0x34, 0xee, 0x03, 0x33, 0xf4, 0xd9, 0xfe, 0xde, 0x04,
-  0xf4, 0x07, 0x08, 0xf2, 0x0d, 0x0d, 0xcd, 0xd9, 0xb9, 0xd8, 0x41, 0x14,
-  0x1f, 0xf1, 0x0e, 0xda, 0xcd, 0xe0, 0x1f, 0xe8, 0x18, 0xff, 0x03, 0x16,
-  0xea, 0xd0, 0x26, 0xf9, 0xff, 0x12, 0xc2, 0x10, 0x3a, 0xf7, 0x25, 0x05,
-  0x15, 0x03, 0x08, 0x10, 0xf0, 0x15, 0x2b, 0xf4, 0xee, 0x11, 0x25, 0xfe,
-  0x02, 0xf1, 0xe6, 0xde, 0xf0, 0xec, 0x17, 0x28, 0xf6, 0xf4, 0xdb, 0x22,
-  0x22, 0x07, 0xcb, 0x0c, 0x0c, 0xf6, 0xc6, 0xe9, 0xe8, 0xda, 0xd6, 0xb6,
-  0xde, 0x1f, 0x19, 0xe4, 0xc5, 0xf8, 0xc4, 0x3a, 0x00, 0xfd, 0x20, 0x33,
-  0x0d, 0xd0, 0x04, 0xea, 0x24, 0x3e, 0x09, 0x2a, 0x22, 0x30, 0xec, 0xf9,
-  0xe7, 0x16, 0x18, 0x31, 0xf5, 0x1d, 0xf4, 0xfd, 0x3a, 0x0c, 0x10, 0x17,
-  0x0a, 0x34, 0xfa, 0xe4, 0xec, 0x06, 0xd3, 0x03, 0xd9, 0xf7, 0x01, 0x02,
-  0xef, 0x01, 0xf8, 0xf2, 0x08, 0x0e, 0xc9, 0xec, 0xd9, 0xff, 0xec, 0xfd,
-  0xea, 0xfa, 0xf6, 0xf4, 0x05, 0x11, 0xb6, 0xfe, 0x81, 0x25, 0xfd, 0x2c,
-  0xe6, 0xd2, 0xf6, 0xfd, 0x1b, 0x07, 0x20, 0x1e, 0x10, 0x2a, 0x0f, 0x10,
-  0x55, 0x38, 0xef, 0xce, 0xf1, 0x2d, 0x31, 0x20, 0x15, 0x0c, 0x2b, 0x15,
-  0x3f, 0x00, 0x2a, 0x31, 0x23, 0xfd, 0xdd, 0xbd, 0xe6, 0x1e, 0xf8, 0x08,
-  0xe5, 0xd5, 0xfe, 0x02, 0x35, 0x07, 0xf0, 0xf2, 0xfc, 0x1b, 0xdc, 0xef,
-  0x03, 0xd0, 0xef, 0x20, 0xf5, 0x36, 0xf2, 0xe0, 0xea, 0x39, 0xf0, 0xde,
-  0xca, 0x05, 0x06, 0x14, 0x09, 0xf8, 0x25, 0x16, 0xfa, 0x21, 0x1d, 0xff,
-  0x13, 0xf9, 0x27, 0x0b, 0x08, 0x31, 0xfc, 0xe0, 0xec, 0x3b, 0x46, 0x19,
-  0x2d, 0xeb, 0x39, 0x13, 0xda, 0x05, 0x14, 0xee, 0x20, 0x14, 0x0c, 0x0b,
-  0x08, 0xcd, 0x06, 0x15, 0xf6, 0x06, 0xf6, 0x02, 0xfb, 0x0a, 0xd6, 0xde,
-  0x19, 0x13, 0xf9, 0xf2, 0xe3, 0x18, 0xcd, 0xe8, 0xff, 0xf2, 0x09, 0xd2,
-  0xf0, 0x34, 0xfa, 0xf9, 0xc7, 0x0a, 0xec, 0xf2, 0xe3, 0xe6, 0x19, 0x1b,
-  0x13, 0xc9, 0x04, 0x23, 0x12, 0x11, 0xef, 0x3f, 0xf1, 0xfa, 0x00, 0xd9,
-  0x0c, 0xf7, 0x5d, 0xe9, 0xe4, 0xf9, 0x18, 0x02, 0xe2, 0x00, 0xe8, 0x11,
-  0xf2, 0x07, 0x1c, 0xf4, 0xec, 0xed, 0xe6, 0xdc, 0x13, 0x00, 0xe1, 0xe4,
-  0xfb, 0xf9, 0xf2, 0xd8, 0x16, 0x0d, 0xee, 0xf2, 0xce, 0x02, 0xe3, 0x0d,
-  0xf1, 0xfa, 0x04, 0xdf, 0x12, 0x16, 0xf4, 0xe7, 0xd9, 0x01, 0x14, 0xea,
-  0xef, 0x03, 0x21, 0xe5, 0xee, 0xf6, 0x08, 0x0c, 0xe5, 0xdf, 0xed, 0xdc,
-  0xdf, 0x04, 0xf5, 0x1d, 0x0b, 0xde, 0x0a, 0xf5, 0xc1, 0xfa, 0x0b, 0x26,
-  0xf5, 0x18, 0xd0, 0xfc, 0x12, 0x01, 0xef, 0x08, 0x0a, 0x08, 0xef, 0xdc,
-  0xf5, 0xf6, 0x05, 0x01, 0x14, 0xd5, 0xea, 0xa1, 0x07, 0x19, 0xe3, 0xfe,
-  0xf1, 0xf8, 0xdf, 0x20, 0x12, 0x37, 0x19, 0xf8, 0x01, 0x31, 0x14, 0xef,
-  0x08, 0x02, 0xde, 0xea, 0x13, 0x0a, 0x10, 0xfa, 0xe6, 0x2d, 0xf2, 0x00,
-  0xe3, 0xf3, 0x24, 0x1f, 0xff, 0x02, 0x04, 0x1d, 0xe0, 0x00, 0x19, 0x02,
-  0x14, 0xe0, 0xff, 0xd9, 0x05, 0x34, 0xed, 0x05, 0x25, 0xe9, 0xf1, 0x2b,
-  0x0e, 0xd3, 0xeb, 0x00, 0x00, 0x19, 0xf5, 0xe1, 0xf1, 0xee, 0xe3, 0xfa,
-  0xd6, 0x0d, 0x0e, 0xfc, 0x16, 0x3f, 0xe7, 0x40, 0x18, 0x06, 0x1c, 0xe9,
-  0x0c, 0x2b, 0xff, 0xfb, 0x1f, 0xc8, 0x11, 0x0f, 0x02, 0xf1, 0x0c, 0x16,
-  0xf9, 0xd3, 0x16, 0xff, 0xd3, 0xd5, 0xf3, 0x20, 0xf3, 0x00, 0xf5, 0xea,
-  0x19, 0xf3, 0x3f, 0xb9, 0x11, 0xfe, 0x00, 0x09, 0xe5, 0x04, 0xd5, 0x21,
-  0xf5, 0xd1, 0x24, 0xd3, 0x23, 0xee, 0xfb, 0xeb, 0xee, 0x35, 0xf5, 0xff,
-  0xe7, 0xda, 0x23, 0xfa, 0x1d, 0x05, 0x06, 0xd7, 0x0a, 0x16, 0xf4, 0x20,
-  0x1b, 0xee, 0x2c, 0xf7, 0x0e, 0xf8, 0x22, 0xf8, 0x4f, 0xf1, 0x52, 0xfa,
-  0x0b, 0x4f, 0xf6, 0x0a, 0xf3, 0xd7, 0x22, 0xf9, 0x03, 0xe5, 0xc5, 0xda,
-  0xef, 0x13, 0x07, 0x36, 0x11, 0xf2, 0x13, 0x02, 0xf5, 0x14, 0xde, 0x10,
-  0xca, 0xf4, 0xf3, 0x1a, 0xfd, 0xe5, 0x0f, 0x03, 0x29, 0xfc, 0xfa, 0xf7,
-  0xed, 0x31, 0xf4, 0x13, 0xc5, 0xd9, 0x3f, 0xd2, 0xee, 0xeb, 0x31, 0xf0,
-  0x04, 0x05, 0xe4, 0xea, 0x40, 0x02, 0x05, 0x13, 0xf4, 0x09, 0xfc, 0xe0,
-  0x3f, 0xd3, 0x23, 0xea, 0x20, 0x0f, 0x0b, 0xdd, 0xe8, 0x0d, 0xf5, 0xf6,
-  0xe0, 0x35, 0xf2, 0xfc, 0xd9, 0xd6, 0x17, 0x37, 0xd3, 0x05, 0xe6, 0x0f,
-  0x10, 0x09, 0xcc, 0xe8, 0xe9, 0x23, 0x13, 0xe3, 0xe2, 0xc4, 0xec, 0x0a,
-  0xe9, 0xe9, 0xc5, 0x01, 0x16, 0x0d, 0x08, 0xf3, 0x08, 0x0c, 0x04, 0x29,
-  0xe3, 0x12, 0x21, 0xd0, 0x1d, 0xaf, 0x2c, 0x30, 0xfa, 0x05, 0x0c, 0xcd,
-  0x03, 0xd0, 0x13, 0xe9, 0x23, 0xde, 0xef, 0x35, 0xe2, 0xe0, 0x27, 0xf4,
-  0xe4, 0xf0, 0x0b, 0xf0, 0xf9, 0xc4, 0xe4, 0xf4, 0x56, 0x0e, 0x25, 0x2d,
-  0xe0, 0xf2, 0x19, 0xff, 0xfe, 0xe1, 0xb7, 0x22, 0xdf, 0x2d, 0x15, 0x0e,
-  0xda, 0xf0, 0x46, 0xcc, 0x1e, 0xe9, 0xdf, 0x0e, 0x13, 0x0a, 0x65, 0x0d,
-  0x41, 0xfe, 0xdc, 0xf6, 0x2d, 0x5d, 0x02, 0x0d, 0xb6, 0xd3, 0x25, 0x12,
-  0x08, 0xa1, 0xe5, 0xcd, 0x20, 0x2e, 0x59, 0x01, 0x1c, 0xe8, 0xe6, 0xe1,
-  0x28, 0x2b, 0x24, 0xe4, 0xfc, 0x09, 0x09, 0x0a, 0xca, 0xfb, 0xbd, 0x07,
-  0x0c, 0xf5, 0xf9, 0x23, 0x27, 0x07, 0xd8, 0x23, 0x2e, 0x18, 0x20, 0xe7,
-  0xe2, 0x59, 0x07, 0x32, 0xdf, 0xf0, 0xf5, 0x34, 0xc9, 0xc9, 0xdd, 0xea,
-  0xe4, 0xf4, 0xe5, 0xc0, 0x31, 0x04, 0xe1, 0xb6, 0x24, 0x51, 0xe7, 0xe0,
-  0xe8, 0x2d, 0xc4, 0x8b, 0xf5, 0xc1, 0xea, 0xc1, 0xdd, 0xd7, 0xee, 0x27,
-  0xfe, 0xcf, 0xe1, 0x4e, 0x09, 0x32, 0xe0, 0x1f, 0x12, 0x0f, 0xf3, 0xeb,
-  0x2b, 0xef, 0xa9, 0xe4, 0xe2, 0x00, 0x1e, 0x03, 0x44, 0x0e, 0xc8, 0x06,
-  0x51, 0x07, 0x57, 0xde, 0x01, 0xc0, 0xe3, 0x20, 0x28, 0xf1, 0x06, 0xd5,
-  0x02, 0x16, 0xf9, 0x02, 0xe4, 0x0d, 0x14, 0x12, 0xf5, 0x08, 0xf6, 0xe7,
-  0x0b, 0x06, 0x22, 0xcd, 0x0c, 0xee, 0x17, 0x16, 0x03, 0x19, 0x3f, 0x56,
-  0x2a, 0x00, 0xfe, 0xd0, 0x5e, 0x02, 0x15, 0x2c, 0xfc, 0xd4, 0xf5, 0x09,
-  0x04, 0x05, 0xf5, 0x3b, 0x15, 0xf6, 0x18, 0xfa, 0x2f, 0xed, 0x12, 0xcb,
-  0x15, 0x10, 0x17, 0xe5, 0xbc, 0x01, 0xde, 0xce, 0x34, 0x34, 0xfd, 0x02,
-  0x0d, 0xfd, 0x15, 0xd5, 0xed, 0x0e, 0xec, 0xd8, 0x39, 0xf0, 0xf8, 0x49,
-  0xfb, 0x0b, 0xce, 0xdd, 0x21, 0xf1, 0xa1, 0x05, 0xc1, 0xec, 0xef, 0xff,
-  0x0d, 0xb5, 0x53, 0x3f, 0x0a, 0xe5, 0x12, 0xd6, 0xc1, 0xd1, 0x26, 0x18,
-  0x1b, 0x1f, 0xf6, 0xf1, 0xff, 0x1d, 0xfa, 0x0b, 0xfc, 0x2c, 0xef, 0xf1,
-  0xe6, 0xe1, 0xd7, 0xe5, 0x27, 0xf7, 0xdd, 0x0e, 0xec, 0xdb, 0xed, 0xdc,
-  0x08, 0x4d, 0xe1, 0x0b, 0x17, 0x01, 0xca, 0x11, 0xc0, 0xf9, 0xf6, 0x06,
-  0xf7, 0x39, 0xc8, 0x0f, 0xd5, 0x0b, 0xd6, 0xf4, 0x3c, 0x13, 0xde, 0xd0,
-  0xf5, 0xf0, 0x10, 0xb0, 0xfa, 0xd7, 0x2a, 0x4f, 0xd2, 0xb2, 0xed, 0x32,
-  0xeb, 0x1d, 0x06, 0xf4, 0xfa, 0x51, 0xe5, 0x4b, 0x35, 0xd0, 0xff, 0xed,
-  0xff, 0xf8, 0x1e, 0xbc, 0xd7, 0x0f, 0xda, 0x21, 0xf5, 0xfe, 0x1d, 0xe7,
-  0x00, 0x03, 0x3c, 0xcf, 0xf2, 0x0d, 0xe2, 0x0b, 0x04, 0xfc, 0x31, 0x31,
-  0x0d, 0xe8, 0xe5, 0x3c, 0xc9, 0xfe, 0x03, 0xfb, 0xf9, 0x1a, 0x1c, 0xe3,
-  0xb4, 0x0d, 0x15, 0xe6, 0x08, 0xe8, 0xe4, 0xc5, 0xe6, 0x04, 0x1e, 0xde,
-  0xf5, 0x32, 0x0f, 0xd2, 0x06, 0x03, 0xf9, 0x43, 0xca, 0x00, 0xe6, 0x0c,
-  0x1d, 0x31, 0xe1, 0x38, 0xf6, 0xd8, 0x37, 0x2b, 0x14, 0x12, 0x19, 0xc7,
-  0xc1, 0x7f, 0x27, 0xa7, 0xdc, 0xf6, 0x15, 0xde, 0x29, 0x13, 0x08, 0xfc,
-  0xc1, 0x02, 0x0c, 0x4e, 0xf3, 0xd0, 0xd9, 0xf4, 0x27, 0xca, 0xc6, 0xf8,
-  0xf6, 0xe7, 0x0f, 0xfb, 0x0f, 0x08, 0xe3, 0x19, 0xfb, 0xf5, 0xe0, 0x08,
-  0x26, 0x25, 0x3c, 0xfb, 0xc1, 0xd8, 0xfc, 0xdc, 0xd4, 0x3a, 0x2e, 0x1d,
-  0xdf, 0xb8, 0x3b, 0x53, 0x20, 0x32, 0x15, 0x2e, 0xc2, 0xc9, 0x21, 0x3b,
-  0xec, 0x2d, 0xde, 0xd2, 0xbb, 0x1c, 0x06, 0xcc, 0xc2, 0xdb, 0xe5, 0xfe,
-  0xea, 0x0b, 0xd6, 0x1d, 0x0c, 0xcd, 0x10, 0x7b, 0xe8, 0xdb, 0xc0, 0x1c,
-  0x07, 0x31, 0xd2, 0xf0, 0xc0, 0x11, 0x0b, 0xe7, 0x4a, 0xf8, 0xc0, 0xdd,
-  0xef, 0x13, 0xd7, 0x0e, 0x0c, 0x18, 0x20, 0xf7, 0x02, 0xad, 0x13, 0xf6,
-  0xe7, 0x71, 0xfb, 0x0e, 0x08, 0xb9, 0x09, 0x61, 0x10, 0x11, 0xf6, 0x34,
-  0xe8, 0xd2, 0x52, 0x15, 0xda, 0x08, 0xfc, 0x01, 0xe5, 0x02, 0x33, 0xf3,
-  0xdb, 0xb1, 0xcf, 0x27, 0xf1, 0x33, 0xe0, 0xfb, 0x01, 0xd6, 0xcf, 0x17,
-  0x2e, 0xbf, 0x01, 0xcb, 0x3d, 0x1c, 0xcc, 0xf7, 0x2d, 0xfe, 0xa6, 0xed,
-  0xec, 0x0d, 0xef, 0x3e, 0xe7, 0x2a, 0x4a, 0x3e, 0x3b, 0x2c, 0xf9, 0x50,
-  0xc8, 0xc3, 0x0d, 0xf5, 0x1a, 0xf3, 0x1c, 0x0a, 0xc4, 0xf0, 0x21, 0x30,
-  0xfa, 0xd3, 0x26, 0x10, 0xfa, 0xee, 0xe5, 0xb8, 0xdd, 0xd6, 0xf9, 0xd4,
-  0xfd, 0xf3, 0xff, 0x2b, 0x1d, 0x49, 0xc8, 0x25, 0xb5, 0x57, 0xdd, 0xfd,
-  0xff, 0x99, 0xde, 0x1c, 0x39, 0x05, 0x07, 0x00, 0x1d, 0x06, 0x3b, 0x28,
-  0x43, 0x22, 0xd8, 0xca, 0x69, 0x2d, 0xd9, 0xe6, 0xbb, 0x2d, 0xfb, 0x07,
-  0x12, 0xf8, 0xd0, 0x45, 0x29, 0x8f, 0x16, 0xe9, 0xf9, 0xc6, 0x43, 0x56,
-  0xe7, 0xdd, 0xe0, 0xc8, 0xf3, 0xe2, 0x36, 0x0f, 0x1b, 0x06, 0xc7, 0xf4,
-  0xbf, 0xe4, 0xeb, 0xf7, 0x07, 0xd5, 0xf7, 0x56, 0x22, 0xcd, 0xff, 0x12,
-  0x81, 0xd5, 0xd6, 0x23, 0x05, 0xd9, 0xd5, 0xfd, 0x2d, 0x06, 0x01, 0x77,
-  0xca, 0x11, 0x1d, 0xc3, 0x0e, 0x37, 0xda, 0xfb, 0x23, 0xe3, 0xfd, 0xe0,
-  0xda, 0x30, 0xf9, 0xe4, 0x00, 0xd4, 0x2a, 0xd4, 0xdc, 0xb7, 0xc2, 0x2e,
-  0x00, 0xe6, 0x32, 0xe8, 0xbb, 0xf5, 0x27, 0x0b, 0xf1, 0x49, 0x3e, 0x2d,
-  0x18, 0xfe, 0xb1, 0x07, 0xd8, 0x0b, 0x03, 0x12, 0x12, 0xbe, 0x05, 0x11,
-  0x40, 0xe4, 0xf0, 0xe1, 0x3b, 0x13, 0xeb, 0x19, 0xee, 0xe1, 0xeb, 0x27,
-  0x01, 0xdb, 0xd1, 0x39, 0x20, 0x40, 0x04, 0xe4, 0x62, 0xde, 0x16, 0x09,
-  0xf2, 0x08, 0x0a, 0xfe, 0xc1, 0xf9, 0x66, 0x3e, 0xfb, 0xdc, 0xd8, 0x44,
-  0xb9, 0x34, 0x18, 0x4c, 0x04, 0xd9, 0x24, 0x06, 0x0f, 0x7c, 0xe2, 0xc0,
-  0xe4, 0x2f, 0x01, 0xf6, 0x23, 0x0e, 0x18, 0xca, 0xf9, 0x24, 0x07, 0xeb,
-  0xde, 0x1d, 0x08, 0x40, 0x09, 0x1e, 0x10, 0xf3, 0xfe, 0x2d, 0xf4, 0x01,
-  0x00, 0xd4, 0x21, 0x01, 0x2e, 0xf7, 0xd3, 0x25, 0xd3, 0x15, 0x33, 0xfb,
-  0x3b, 0x13, 0x27, 0xea, 0x08, 0x39, 0xe8, 0xf5, 0x10, 0x02, 0xd5, 0x2c,
-  0x10, 0xe0, 0xa1, 0x0c, 0xe8, 0x2b, 0x07, 0x32, 0x0d, 0xe3, 0xdd, 0x23,
-  0xfc, 0x3e, 0xd3, 0xe1, 0x24, 0x3b, 0x23, 0x11, 0x27, 0xe3, 0xd5, 0xb0,
-  0x00, 0x05, 0xec, 0xe3, 0xe4, 0xe6, 0x36, 0x18, 0xfc, 0xd4, 0xf1, 0x23,
-  0x3d, 0xc9, 0xe8, 0x21, 0xf5, 0xc2, 0xff, 0xf1, 0x35, 0x30, 0xd2, 0x32,
-  0xa5, 0x58, 0x22, 0xfc, 0x7f, 0xd4, 0x12, 0xd9, 0xd1, 0xdf, 0x36, 0xfd,
-  0xd3, 0x22, 0x0d, 0x03, 0xff, 0xfa, 0xd8, 0x07, 0xd7, 0x02, 0x15, 0x06,
-  0x26, 0xff, 0x2c, 0xb9, 0xf8, 0x17, 0x1d, 0xd3, 0xee, 0x6a, 0x1d, 0x25,
-  0x14, 0xfc, 0xb2, 0xe2, 0xf4, 0xd0, 0xdd, 0x46, 0xff, 0x03, 0xfe, 0x17,
-  0xc1, 0xd5, 0xfe, 0xde, 0x1c, 0x43, 0x04, 0xff, 0x11, 0xf4, 0xea, 0x29,
-  0xf3, 0xfc, 0x22, 0x3b, 0x64, 0xd7, 0x19, 0xeb, 0x1f, 0xcf, 0x75, 0xf9,
-  0x1f, 0xcc, 0x0f, 0x46, 0xa1, 0x28, 0x39, 0x0b, 0xd5, 0x05, 0x25, 0xe2,
-  0xde, 0xf7, 0xf7, 0x39, 0xfd, 0xd8, 0xd2, 0xfa, 0x2b, 0x1d, 0x0f, 0x97,
-  0xca, 0x11, 0x0c, 0x17, 0x0f, 0xdf, 0xd0, 0xce, 0xad, 0x41, 0x47, 0x09,
-  0x03, 0x0e, 0xfc, 0x08, 0xd9, 0x97, 0x06, 0x0b, 0xd9, 0x2b, 0xdf, 0xfb,
-  0xec, 0x0c, 0x04, 0x34, 0x08, 0x25, 0xf8, 0xfd, 0xe7, 0x0c, 0x18, 0xfd,
-  0xb0, 0x04, 0x68, 0x02, 0xfc, 0x18, 0x09, 0x12, 0xa5, 0xe4, 0x0f, 0xec,
-  0x1e, 0xd4, 0x1a, 0x2e, 0xd0, 0x0a, 0x42, 0xfb, 0xe6, 0x15, 0xbc, 0xf2,
-  0x3a, 0x20, 0x24, 0xfc, 0xc2, 0x41, 0x33, 0xf7, 0x1b, 0x16, 0xd0, 0xcb,
-  0xf5, 0x10, 0xe6, 0x13, 0xf7, 0x36, 0x07, 0xe7, 0xeb, 0xb0, 0x0f, 0xc6,
-  0x06, 0x12, 0x13, 0xdb, 0x0e, 0xf4, 0xd5, 0x10, 0x3c, 0xfc, 0xfd, 0xdb,
-  0xdb, 0x2d, 0x1a, 0x10, 0x21, 0xe0, 0x19, 0xc0, 0xf4, 0xe1, 0xfe, 0xe9,
-  0xc2, 0xf7, 0x16, 0xf0, 0xd6, 0xd5, 0x19, 0x2c, 0x10, 0x11, 0xfb, 0xf5,
-  0x27, 0xf3, 0x06, 0xea, 0xff, 0xfa, 0x03, 0x5c, 0xe4, 0x1f, 0x0a, 0x0c,
-  0xcc, 0x26, 0xd8, 0x9a, 0x0b, 0xee, 0xfb, 0x4b, 0x2c, 0x0b, 0xcc, 0xe4,
-  0xa0, 0xdd, 0x36, 0xcc, 0x30, 0x46, 0x17, 0x9a, 0xf9, 0xd5, 0x27, 0x2d,
-  0x03, 0xd5, 0xfa, 0x35, 0x1a, 0x0a, 0x35, 0xf9, 0x22, 0xca, 0xdd, 0x44,
-  0xe6, 0xf8, 0xe3, 0x43, 0xc4, 0xcf, 0x41, 0xb7, 0xda, 0xe0, 0xe5, 0x00,
-  0xa5, 0xf7, 0x33, 0x9a, 0xe7, 0xd0, 0x31, 0xc4, 0xea, 0xd2, 0x17, 0x42,
-  0x36, 0x2d, 0x10, 0xfd, 0x01, 0xe9, 0x07, 0xcd, 0x53, 0x0e, 0xee, 0xdf,
-  0xc9, 0x0a, 0xe9, 0x08, 0x2d, 0xda, 0x1b, 0xe0, 0x1b, 0x38, 0xf4, 0xd1,
-  0xf8, 0xdb, 0xea, 0xde, 0xd4, 0xde, 0xd9, 0xe9, 0x4e, 0xdf, 0x21, 0xc0,
-  0xe6, 0xe9, 0x09, 0xf3, 0xd3, 0x15, 0x6c, 0x22, 0xdf, 0x1b, 0x2e, 0x0d,
-  0xcb, 0xf6, 0xe7, 0x15, 0x8f, 0xe3, 0x42, 0x24, 0xe1, 0xe8, 0x37, 0xd9,
-  0xf2, 0x0a, 0xfc, 0xf9, 0x0a, 0x23, 0xe3, 0x14, 0x1e, 0x04, 0x06, 0x62,
-  0x0c, 0x03, 0x00, 0x0d, 0xc8, 0xd2, 0x09, 0xdc, 0x16, 0x03, 0x18, 0xcb,
-  0x06, 0x3c, 0x18, 0xe6, 0xfe, 0xd9, 0x38, 0xf0, 0x24, 0x08, 0xea, 0x3f,
-  0x42, 0xda, 0x00, 0xba, 0xec, 0xfb, 0x9c, 0x32, 0x02, 0xf0, 0xe3, 0xfa,
-  0xcc, 0x10, 0x29, 0xe7, 0xdc, 0xff, 0x00, 0x0b, 0xae, 0x27, 0x1f, 0x0c,
-  0xd2, 0xc1, 0x37, 0xfb, 0xb0, 0xf4, 0x46, 0xee, 0x3d, 0xea, 0x0b, 0x15,
-  0x05, 0x21, 0xb7, 0x11, 0x1a, 0x03, 0x1b, 0xe6, 0xce, 0xd1, 0xfd, 0x28,
-  0x26, 0xfd, 0x16, 0x28, 0xf2, 0x5d, 0xf3, 0xaa, 0x1e, 0xec, 0x23, 0xfe,
-  0xd4, 0x22, 0xf1, 0x4d, 0xba, 0x24, 0x2f, 0xd6, 0x25, 0x09, 0x14, 0xe8,
-  0xd5, 0xf1, 0xce, 0x17, 0xb0, 0x0d, 0x09, 0x09, 0xe9, 0xfa, 0x05, 0xa2,
-  0xdc, 0x06, 0x1e, 0xe7, 0xe0, 0x0f, 0x07, 0xc0, 0xf3, 0xf7, 0x01, 0x11,
-  0x2e, 0x02, 0x47, 0xf9, 0x01, 0xe2, 0x1e, 0x85, 0xeb, 0xf6, 0xf8, 0xef,
-  0x0f, 0xe4, 0xf0, 0x05, 0xd5, 0x18, 0x1b, 0xe5, 0xff, 0x2b, 0xe9, 0x9e,
-  0x23, 0xce, 0xe9, 0xd7, 0xc8, 0xf5, 0xf3, 0x26, 0x31, 0xd6, 0x1c, 0xcb,
-  0xf1, 0x30, 0x2e, 0xe8, 0xf8, 0xc8, 0x17, 0xdd, 0xe3, 0x2c, 0xed, 0xee,
-  0xe2, 0xd6, 0x3b, 0x10, 0xc9, 0x08, 0x57, 0x2e, 0xc7, 0xf2, 0x1c, 0xf4,
-  0x13, 0xe4, 0x0f, 0xc6, 0x16, 0x1c, 0x28, 0xff, 0xe0, 0xfd, 0x28, 0x18,
-  0xd0, 0xd8, 0x22, 0xf3, 0x43, 0xd6, 0xfb, 0xef, 0x07, 0xe3, 0x24, 0x0f,
-  0xea, 0x49, 0xe1, 0xbd, 0x1e, 0xe7, 0x1f, 0xd1, 0xf3, 0x25, 0x09, 0x25,
-  0x14, 0x1b, 0x0b, 0xa3, 0xd5, 0x28, 0x2f, 0x10, 0xf6, 0xe1, 0xd2, 0xe8,
-  0xe4, 0xee, 0x10, 0x05, 0xb0, 0xd7, 0x08, 0x01, 0x1c, 0xf3, 0x28, 0x01,
-  0x03, 0xb4, 0x16, 0xe2, 0xed, 0xd4, 0x12, 0xd6, 0x1f, 0xfd, 0x56, 0x26,
-  0xd2, 0xe3, 0xfb, 0xc3, 0xe7, 0xcc, 0x11, 0x30, 0x47, 0x0a, 0xf9, 0x02,
-  0x14, 0x02, 0xea, 0x43, 0x07, 0x05, 0xfa, 0xc1, 0x66, 0xe9, 0x32, 0x0f,
-  0xc9, 0x4a, 0xd7, 0x1f, 0xcb, 0x19, 0x12, 0x12, 0x3b, 0x56, 0x02, 0xd0,
-  0xf9, 0xdb, 0xf3, 0xe3, 0xe2, 0x17, 0xeb, 0x26, 0xe5, 0x04, 0xf2, 0xee,
-  0xef, 0xdd, 0xeb, 0x16, 0xae, 0xe3, 0x00, 0x0a, 0x0e, 0x49, 0xfa, 0xb5,
-  0xb4, 0xe5, 0xe3, 0x03, 0xd9, 0xe4, 0xec, 0x90, 0xec, 0x06, 0x12, 0xc5,
-  0xd3, 0x26, 0x0b, 0x2b, 0xe8, 0xdf, 0x00, 0xcb, 0x15, 0x15, 0xf9, 0xbd,
-  0x53, 0xf8, 0xf1, 0x25, 0xc1, 0x29, 0x94, 0xfa, 0xea, 0xce, 0x03, 0x1b,
-  0x16, 0x79, 0x20, 0xf2, 0xfc, 0x10, 0x2d, 0xce, 0xe2, 0xe7, 0x0b, 0x06,
-  0xfb, 0xef, 0x2c, 0x40, 0x0c, 0xe8, 0xf8, 0x3f, 0xef, 0x18, 0x09, 0x24,
-  0x53, 0x35, 0x20, 0xcd, 0xb8, 0x11, 0xe1, 0xef, 0x07, 0x17, 0xe6, 0x0b,
-  0xd3, 0xc1, 0x14, 0xe9, 0xed, 0x10, 0x26, 0x05, 0x12, 0x9b, 0x26, 0xde,
-  0x07, 0xf8, 0xde, 0xbc, 0x43, 0xe9, 0x16, 0x2a, 0xf0, 0x36, 0xd6, 0xf4,
-  0xe2, 0x0f, 0xde, 0xbe, 0x02, 0x7f, 0x2e, 0x2a, 0x10, 0xee, 0xe5, 0xd0,
-  0xed, 0xe8, 0xdd, 0xe8, 0xbb, 0xfa, 0x39, 0xc6, 0x44, 0xae, 0x11, 0x23,
-  0xff, 0xee, 0xf1, 0x15, 0x22, 0x47, 0x08, 0x1d, 0xe2, 0x29, 0xfd, 0xdc,
-  0x2d, 0xf8, 0xe8, 0xa9, 0xe0, 0xbd, 0xff, 0x06, 0xf6, 0x34, 0xfd, 0xe5,
-  0xf4, 0x04, 0xf7, 0xe1, 0xe9, 0x30, 0xf4, 0xe5, 0xd8, 0xd1, 0x17, 0xcf,
-  0xba, 0xed, 0xe8, 0xea, 0xeb, 0xf0, 0x11, 0xec, 0x0d, 0xdf, 0x15, 0x43,
-  0xf9, 0xfb, 0x4e, 0xac, 0xe8, 0xeb, 0xf1, 0xfd, 0x12, 0x16, 0xf8, 0x98,
-  0xfc, 0xdc, 0xf0, 0x2c, 0xc9, 0xe2, 0x1a, 0x36, 0x5a, 0xdc, 0xfa, 0xa2,
-  0x90, 0x10, 0xbf, 0x30, 0x1d, 0xf5, 0xc8, 0x16, 0xde, 0x3b, 0xfd, 0xd9,
-  0xe9, 0xc0, 0xeb, 0x12, 0xcf, 0xd8, 0x2c, 0xe3, 0xcc, 0xf7, 0xf1, 0x05,
-  0xb9, 0x04, 0x1b, 0xf6, 0x3f, 0xc0, 0xa2, 0xc3, 0x06, 0x4b, 0xe0, 0xe6,
-  0x47, 0x21, 0xe2, 0xf7, 0x09, 0x13, 0x17, 0xd7, 0x33, 0xe3, 0xf6, 0xb9,
-  0x0b, 0x09, 0x2f, 0xc5, 0xf9, 0x1e, 0xd2, 0xd1, 0xd6, 0xd3, 0x1c, 0x04,
-  0x44, 0xf1, 0x08, 0xa5, 0xeb, 0xfb, 0xec, 0xf6, 0x4b, 0x22, 0xb8, 0xd6,
-  0xda, 0x37, 0xef, 0xa3, 0x5c, 0xbc, 0x3a, 0x08, 0xd9, 0x13, 0x57, 0xd1,
-  0xd6, 0xf8, 0x09, 0x12, 0xf5, 0xef, 0x19, 0xdf, 0xe4, 0xc3, 0xda, 0x08,
-  0xfb, 0xf7, 0xc0, 0x0d, 0x17, 0x2b, 0x0c, 0x1c, 0x04, 0x00, 0x15, 0xec,
-  0x2b, 0x43, 0xea, 0x31, 0xbc, 0x1b, 0x07, 0xfb, 0x40, 0x28, 0x0b, 0xfe,
-  0xed, 0xb2, 0xe8, 0x0e, 0x54, 0xdb, 0x1c, 0xfe, 0xfc, 0xce, 0x04, 0xf2,
-  0xe9, 0xef, 0x0e, 0xe6, 0xa4, 0x2c, 0xc5, 0xd6, 0x25, 0xbb, 0x52, 0x07,
-  0xc9, 0xef, 0x02, 0xbe, 0x41, 0x13, 0xc2, 0xf7, 0xf6, 0x08, 0x11, 0xf0,
-  0xf2, 0x14, 0xfb, 0xf2, 0xd8, 0xfa, 0xde, 0xcb, 0xc2, 0xe8, 0x05, 0x53,
-  0x04, 0xd9, 0x07, 0xcb, 0xdb, 0x2f, 0xd3, 0xde, 0x04, 0xb4, 0x1c, 0xf2,
-  0xc7, 0xe7, 0xdd, 0x25, 0xf5, 0xf8, 0xd8, 0x15, 0xdf, 0x2d, 0xf6, 0x0e,
-  0xf1, 0x36, 0x06, 0xfa, 0x1f, 0xf9, 0xf5, 0x1e, 0x27, 0xf8, 0x42, 0x23,
-  0x27, 0x08, 0xe0, 0xe3, 0xe2, 0x05, 0x09, 0x53, 0x11, 0xde, 0xbc, 0xe1,
-  0xcd, 0x0a, 0x04, 0x0a, 0x2a, 0x23, 0xab, 0x1a, 0x2c, 0x45, 0xca, 0xd2,
-  0x2a, 0x36, 0xcd, 0x12, 0x22, 0xe7, 0x22, 0xf7, 0xd5, 0xa3, 0x18, 0xcc,
-  0xf1, 0x9d, 0x32, 0x33, 0x35, 0x20, 0x03, 0x31, 0xfb, 0xf1, 0x33, 0x02,
-  0xdb, 0xdf, 0x1b, 0x0f, 0x0e, 0x3e, 0x03, 0xfb, 0x21, 0xfd, 0x19, 0xce,
-  0x3f, 0x0d, 0x31, 0x05, 0x58, 0x17, 0xf9, 0x1c, 0xca, 0x3d, 0x4b, 0x47,
-  0xf4, 0xeb, 0xeb, 0x34, 0xdb, 0x1b, 0x35, 0x1a, 0x03, 0xff, 0xe3, 0x6c,
-  0xfa, 0xf0, 0xed, 0x04, 0xd0, 0x30, 0x13, 0xd2, 0xe9, 0x0b, 0x01, 0xae,
-  0xf3, 0x0b, 0x27, 0x11, 0xda, 0xf2, 0xe6, 0x0a, 0xf3, 0x0f, 0x21, 0x4a,
-  0x08, 0x00, 0xec, 0x42, 0x07, 0xbb, 0x03, 0x28, 0x52, 0xfd, 0x02, 0x01,
-  0x0b, 0xf7, 0x0e, 0xc2, 0x07, 0x08, 0x35, 0x0d, 0x16, 0x05, 0x34, 0xed,
-  0x0a, 0xdc, 0x37, 0x32, 0x45, 0x53, 0x37, 0x21, 0x21, 0x0b, 0xd0, 0xf8,
-  0xcf, 0xe7, 0x16, 0xeb, 0xd1, 0x41, 0xd2, 0xfc, 0xcf, 0xfc, 0xf5, 0x15,
-  0xf4, 0x1d, 0x20, 0x1e, 0xec, 0x3a, 0xea, 0x45, 0x12, 0xfa, 0xd1, 0xf0,
-  0x09, 0xfc, 0x37, 0x09, 0x5d, 0xab, 0xca, 0xe0, 0xd1, 0x1b, 0x2a, 0x3d,
-  0xe1, 0x19, 0xf1, 0x00, 0xf6, 0x1f, 0xf5, 0x2a, 0x1d, 0xd5, 0x1f, 0x1d,
-  0x29, 0xd9, 0xd2, 0xe1, 0xf4, 0x04, 0xd3, 0xf1, 0xfa, 0x00, 0x26, 0xd4,
-  0xed, 0x2c, 0xef, 0x0d, 0x19, 0xe9, 0x06, 0xf5, 0xe6, 0x1f, 0x05, 0xf5,
-  0x0f, 0x20, 0xf1, 0x20, 0x0b, 0xfb, 0x7f, 0x08, 0x04, 0xf6, 0x3d, 0x09,
-  0xf5, 0xf2, 0xf9, 0x5c, 0x0c, 0x19, 0xe5, 0x01, 0x61, 0xf4, 0xed, 0x15,
-  0xd7, 0x00, 0x1f, 0x33, 0xc7, 0x17, 0xf8, 0xd5, 0xb7, 0x00, 0x1e, 0xdd,
-  0x1f, 0xff, 0xf7, 0xfb, 0x35, 0xf1, 0xc4, 0x0e, 0xe0, 0x03, 0xba, 0xf8,
-  0x04, 0x15, 0x06, 0xeb, 0xfe, 0x68, 0xde, 0x31, 0xc3, 0x0b, 0xfa, 0x27,
-  0x0b, 0x1b, 0xf2, 0xea, 0xeb, 0x03, 0x31, 0x00, 0xe0, 0x19, 0x1d, 0xd9,
-  0x04, 0x16, 0x1f, 0x35, 0x05, 0xda, 0xce, 0x2c, 0x04, 0xd4, 0xef, 0x02,
-  0x0c, 0xe7, 0xd5, 0x02, 0xcc, 0xfa, 0x3a, 0x29, 0xf9, 0xee, 0xf5, 0xed,
-  0x07, 0x01, 0x2b, 0xd5, 0x33, 0x82, 0x1f, 0x1c, 0x4b, 0x07, 0x2c, 0xf9,
-  0x07, 0xf2, 0xc8, 0x05, 0x41, 0xc8, 0x10, 0x44, 0xdc, 0x40, 0xd8, 0x32,
-  0xb7, 0x19, 0xf7, 0x13, 0x3b, 0xf2, 0x2f, 0xe4, 0xee, 0xcc, 0xf3, 0xfa,
-  0xf9, 0x32, 0xf0, 0xce, 0xeb, 0xfa, 0xe1, 0xc1, 0x02, 0x9c, 0x0f, 0xc7,
-  0xda, 0x07, 0xba, 0xc9, 0xef, 0x0b, 0x02, 0xce, 0xce, 0xeb, 0x11, 0x16,
-  0x19, 0xc7, 0x21, 0xe7, 0xf1, 0x53, 0x1a, 0xdd, 0x19, 0xa7, 0x27, 0x5a,
-  0x0f, 0x05, 0x15, 0xd4, 0x9f, 0x02, 0xb4, 0x3d, 0x63, 0x2e, 0x02, 0x42,
-  0xd0, 0x0e, 0xfc, 0x46, 0x43, 0xd5, 0xb1, 0xef, 0x2b, 0xd1, 0x39, 0xff,
-  0xf1, 0xbe, 0xec, 0x93, 0xf5, 0x64, 0x25, 0xe3, 0xc1, 0x11, 0xbf, 0xee,
-  0x45, 0x02, 0xd5, 0xd6, 0xcc, 0x3f, 0xd2, 0xe4, 0xc8, 0x04, 0xe8, 0x34,
-  0xdf, 0xe9, 0x10, 0xcd, 0x35, 0xfb, 0x09, 0xf7, 0xd7, 0x54, 0xdf, 0x1a,
-  0x16, 0xc7, 0x54, 0xe8, 0xfd, 0xcf, 0xe3, 0x0a, 0x0d, 0xf9, 0x11, 0xea,
-  0x2c, 0xff, 0xe6, 0x24, 0xec, 0x0c, 0xd7, 0x02, 0xe7, 0xf3, 0xf7, 0xdd,
-  0x03, 0x00, 0xf5, 0xf8, 0xfd, 0xf6, 0x24, 0xa0, 0xfd, 0x28, 0xef, 0x00,
-  0x12, 0xb8, 0xc1, 0x03, 0x2c, 0x01, 0xe4, 0xf5, 0xc7, 0xf7, 0x23, 0x55,
-  0xe0, 0x0c, 0xdb, 0x44, 0xa2, 0xf7, 0x15, 0xdd, 0xc2, 0x05, 0xde, 0xf3,
-  0xda, 0x0c, 0x11, 0xdc, 0xff, 0x11, 0x04, 0xb8, 0x2b, 0x1d, 0x36, 0xd3,
-  0xe1, 0x16, 0x0b, 0x0a, 0x0e, 0xf1, 0x0a, 0xe8, 0xff, 0x03, 0xed, 0x1b,
-  0xbd, 0xf3, 0xcb, 0x6d, 0x07, 0x05, 0x41, 0x07, 0xf8, 0x1c, 0x07, 0x1c,
-  0x01, 0xd7, 0xd2, 0xda, 0x1a, 0xe2, 0x08, 0x19, 0xd0, 0x92, 0x2a, 0xf0,
-  0x07, 0xf9, 0x0b, 0x0b, 0x11, 0x07, 0x28, 0xf7, 0xef, 0xf4, 0xf1, 0xf4,
-  0x21, 0xf0, 0x11, 0x3f, 0x2f, 0xf2, 0x08, 0x0f, 0xfe, 0xff, 0x47, 0x36,
-  0x12, 0x07, 0xf3, 0xd7, 0xed, 0x4b, 0xec, 0x01, 0x27, 0x18, 0xfb, 0xce,
-  0xd9, 0x08, 0x06, 0x1f, 0x1e, 0xc0, 0xca, 0x14, 0x20, 0xc2, 0x10, 0x0f,
-  0x06, 0xbc, 0xfb, 0xe3, 0xd3, 0x23, 0xe3, 0xf4, 0xf1, 0x06, 0x17, 0xc5,
-  0xc7, 0xbc, 0x13, 0xd8, 0x02, 0x30, 0xe6, 0xcd, 0xdb, 0xef, 0x13, 0x12,
-  0x07, 0xdb, 0xdc, 0xd1, 0x1b, 0x05, 0x5b, 0xfb, 0xec, 0x0e, 0xd8, 0x5b,
-  0x04, 0xed, 0x77, 0x20, 0xd3, 0xc6, 0xda, 0xee, 0x33, 0xfb, 0x5c, 0xf1,
-  0xd5, 0xf4, 0xf3, 0xe7, 0xf4, 0x20, 0xf3, 0x17, 0xc9, 0x31, 0xe2, 0xd4,
-  0x1a, 0x24, 0x0d, 0xfa, 0xc0, 0x1d, 0x1d, 0x05, 0xf0, 0xf3, 0xc6, 0x02,
-  0xfe, 0xf0, 0x21, 0x03, 0xd2, 0x9e, 0xdc, 0xf3, 0xf2, 0xf8, 0x01, 0x2e,
-  0x1f, 0xe7, 0xe1, 0x1d, 0xec, 0xdd, 0x2f, 0xf9, 0x02, 0x26, 0x10, 0xfb,
-  0x22, 0xcd, 0x18, 0x05, 0x0b, 0xed, 0x0d, 0x0f, 0xf6, 0xe1, 0x36, 0xfa,
-  0x2c, 0x31, 0x47, 0x35, 0xe8, 0x06, 0xf0, 0x10, 0xfa, 0xe2, 0x31, 0xcb,
-  0xea, 0xda, 0xda, 0xf5, 0x2d, 0xef, 0x23, 0x12, 0x2b, 0xeb, 0xef, 0x24,
-  0x2e, 0x1b, 0xf1, 0xf1, 0xde, 0x48, 0x0c, 0x11, 0xfb, 0xea, 0x48, 0xed,
-  0xf3, 0xd2, 0xfc, 0x0b, 0x03, 0x03, 0x07, 0xdf, 0xdf, 0x46, 0xed, 0x2a,
-  0xfb, 0x04, 0xe4, 0x01, 0xe8, 0xcb, 0xe7, 0x0b, 0xf2, 0x65, 0xcc, 0xf9,
-  0x19, 0x16, 0xed, 0xbe, 0xe9, 0x13, 0x89, 0x05, 0xf3, 0x13, 0x22, 0xd6,
-  0xed, 0x01, 0x2e, 0xaa, 0x02, 0xe6, 0xbc, 0xc8, 0x57, 0xee, 0x01, 0xd8,
-  0xc8, 0x81, 0xe1, 0xf0, 0x18, 0x4b, 0x14, 0x13, 0xf4, 0x5f, 0x29, 0x32,
-  0x0b, 0x0f, 0x6e, 0x3d, 0xfc, 0xf6, 0xf4, 0xdc, 0xd8, 0xbd, 0xec, 0xc1,
-  0xf3, 0xdc, 0xe9, 0x40, 0xf9, 0x60, 0x13, 0xf9, 0xff, 0xf2, 0xda, 0x12,
-  0x17, 0x43, 0xd0, 0x26, 0xfe, 0xf0, 0x0a, 0xe3, 0xbe, 0xd4, 0x08, 0xff,
-  0xeb, 0xd2, 0xbf, 0xbc, 0xf3, 0x19, 0x09, 0x1d, 0x09, 0x2f, 0xdf, 0xe1,
-  0x09, 0x16, 0xd0, 0x06, 0xfb, 0x0f, 0xeb, 0xf7, 0x27, 0xe1, 0x17, 0x0b,
-  0xd3, 0x10, 0xf6, 0x09, 0xe3, 0xe8, 0x0a, 0x14, 0x13, 0xb4, 0x3a, 0xb9,
-  0x25, 0xf7, 0xdc, 0xd5, 0xef, 0x50, 0x02, 0x1b, 0x5b, 0x24, 0xe5, 0xfe,
-  0x0b, 0xe0, 0x03, 0xe5, 0xe9, 0x0f, 0xb2, 0x14, 0xdc, 0xf5, 0xee, 0x01,
-  0xb4, 0xf4, 0xfa, 0x20, 0xad, 0x94, 0x2a, 0x1b, 0xe5, 0xe1, 0x10, 0xb6,
-  0x11, 0xdb, 0xe6, 0xf0, 0xcf, 0x06, 0xd4, 0xfe, 0xff, 0x10, 0x14, 0xe5,
-  0xf4, 0x04, 0xfb, 0xe1, 0xef, 0xfe, 0xf9, 0xb0, 0xd6, 0x1b, 0xd8, 0x0c,
-  0x33, 0xd8, 0x34, 0x06, 0xb8, 0x03, 0xfd, 0xeb, 0xf6, 0x15, 0x48, 0xda,
-  0x0a, 0x04, 0x0e, 0x0a, 0x12, 0xe6, 0x11, 0x0b, 0xe4, 0xfe, 0xd7, 0x14,
-  0xf7, 0x2e, 0xf9, 0xe5, 0xe0, 0xc3, 0xe4, 0xe9, 0x0e, 0xbd, 0x24, 0x16,
-  0xdc, 0xeb, 0x31, 0xd2, 0x1c, 0x01, 0xed, 0xb6, 0xf2, 0xe3, 0xd5, 0xb6,
-  0xf2, 0x4c, 0x04, 0x10, 0xe9, 0x1f, 0xea, 0xfe, 0x32, 0x26, 0x22, 0xe6,
-  0xf7, 0xe2, 0xa1, 0x0c, 0x1e, 0xf7, 0x32, 0x25, 0x1d, 0xe0, 0x09, 0x05,
-  0xff, 0x0e, 0x34, 0x16, 0x05, 0xc3, 0x0e, 0xc7, 0xf0, 0x02, 0x22, 0xd7,
-  0xdd, 0xe5, 0xca, 0xf8, 0x07, 0x13, 0xe3, 0x46, 0xe5, 0xf7, 0xf3, 0xdc,
-  0x30, 0xc6, 0x17, 0x07, 0xec, 0xf0, 0x01, 0x03, 0xf8, 0xeb, 0xcc, 0xc2,
-  0x1b, 0x15, 0xfa, 0xb4, 0x15, 0x24, 0x02, 0x60, 0xfa, 0x2d, 0xec, 0x0e,
-  0xda, 0xe6, 0xb7, 0x0f, 0x05, 0x1b, 0xd9, 0x42, 0x1f, 0xee, 0x18, 0xf5,
-  0xc0, 0x19, 0x0b, 0x20, 0x38, 0xf4, 0x17, 0x2f, 0xfb, 0xc6, 0x16, 0xf4,
-  0xee, 0xf2, 0xfc, 0x0e, 0x0b, 0xe3, 0xea, 0x08, 0xf0, 0x14, 0xd3, 0x0d,
-  0xd8, 0x07, 0x0c, 0xf7, 0x09, 0xdc, 0xdd, 0xe8, 0xe5, 0xf6, 0xfa, 0xe7,
-  0x31, 0xc9, 0xec, 0x1d, 0x0a, 0x0f, 0xf7, 0x13, 0xe0, 0x0a, 0xe3, 0xda,
-  0x0b, 0xe1, 0x0b, 0xf5, 0xf3, 0xfd, 0xf2, 0x23, 0x1b, 0x04, 0xf1, 0xfa,
-  0x43, 0xd3, 0x18, 0xeb, 0xb7, 0x11, 0xfb, 0xcc, 0xfa, 0xf8, 0x1a, 0xe9,
-  0xde, 0xea, 0x15, 0xde, 0x16, 0xfd, 0x07, 0x1e, 0xe1, 0x16, 0x1a, 0x7f,
-  0xfc, 0xfa, 0xf7, 0x1c, 0xd1, 0xdb, 0xbf, 0x0a, 0x05, 0xe3, 0xe2, 0xfe,
-  0xce, 0xf5, 0xdf, 0xe1, 0xea, 0xe3, 0xf4, 0xeb, 0xb5, 0xfd, 0xbe, 0xe7,
-  0xdb, 0x20, 0xcb, 0xe9, 0x1a, 0xea, 0x08, 0x02, 0xec, 0x46, 0x28, 0x04,
-  0xdf, 0xd5, 0xd1, 0xf2, 0x42, 0xff, 0xff, 0x12, 0x25, 0xde, 0x3e, 0xec,
-  0xcd, 0xe3, 0x2f, 0x0a, 0xfe, 0x0d, 0x0b, 0xe7, 0xeb, 0x33, 0x2e, 0x01,
-  0xfb, 0x1e, 0xec, 0x4f, 0xf0, 0x1f, 0x16, 0x04, 0xd9, 0xef, 0xf8, 0xf5,
-  0x02, 0xd3, 0x19, 0xff, 0xeb, 0x12, 0xff, 0x05, 0x00, 0xdd, 0xd4, 0xf5,
-  0xd6, 0x2f, 0xfc, 0xb5, 0xca, 0x21, 0xee, 0xf2, 0xd4, 0xe3, 0xe9, 0xc0,
-  0xea, 0x31, 0xc8, 0xeb, 0x20, 0xd9, 0xe7, 0x1a, 0x1e, 0xe2, 0x17, 0xeb,
-  0xe8, 0x2b, 0x07, 0x39, 0x1f, 0x0d, 0x0d, 0xf2, 0x1b, 0xc9, 0xf4, 0xeb,
-  0x22, 0x0e, 0x10, 0xe2, 0xfd, 0x39, 0xf0, 0x18, 0xfd, 0x0e, 0x3c, 0x11,
-  0x10, 0xc6, 0xfa, 0xee, 0x1b, 0xf5, 0xd3, 0xe0, 0xdb, 0x12, 0xd9, 0x05,
-  0x23, 0xf5, 0x01, 0x0e, 0x0b, 0x32, 0xff, 0x17, 0xdf, 0xe9, 0xfe, 0xe7,
-  0x08, 0x22, 0x16, 0x32, 0xd8, 0xd4, 0xec, 0x1e, 0x17, 0xec, 0xf5, 0x09,
-  0xf0, 0x33, 0x5f, 0x0a, 0xe9, 0x0f, 0x2e, 0xb0, 0x07, 0xff, 0xca, 0x2e,
-  0xdb, 0xdf, 0x25, 0xcb, 0x23, 0xea, 0xdf, 0x08, 0x03, 0x18, 0x13, 0x2d,
-  0x0a, 0xd6, 0x0a, 0x14, 0xce, 0x43, 0x0d, 0x34, 0x04, 0xe9, 0xe4, 0x0a,
-  0xdb, 0xea, 0xee, 0xd2, 0xee, 0xde, 0x16, 0x04, 0x22, 0x18, 0x04, 0x00,
-  0x14, 0xfc, 0xfe, 0xd6, 0x05, 0x29, 0x1b, 0x28, 0x01, 0x08, 0x1b, 0xd7,
-  0x28, 0x19, 0xc5, 0xe0, 0x0a, 0x29, 0xde, 0x0c, 0x03, 0x13, 0x2a, 0xf9,
-  0x0b, 0xfd, 0xba, 0x1a, 0xdf, 0xf2, 0xf3, 0x1a, 0xd5, 0x27, 0x0b, 0x10,
-  0xee, 0xff, 0x02, 0x15, 0xdf, 0xda, 0x08, 0xfe, 0xd3, 0x44, 0x03, 0x11,
-  0xe8, 0xc3, 0xf1, 0x2f, 0xd9, 0x0a, 0x13, 0x00, 0xd6, 0x1a, 0xd8, 0x46,
-  0xfd, 0x4e, 0x06, 0x12, 0xf8, 0x1a, 0x09, 0xf1, 0x3c, 0x1e, 0xd1, 0x16,
-  0x08, 0x4e, 0x0c, 0x1a, 0x00, 0xef, 0xf5, 0xca, 0xec, 0x15, 0xd6, 0x24,
-  0xd8, 0x13, 0x03, 0x26, 0x18, 0x2e, 0xe8, 0xc6, 0xbe, 0x23, 0x05, 0xeb,
-  0xed, 0x17, 0xc9, 0xe0, 0x16, 0x4e, 0x24, 0x1d, 0xec, 0xd9, 0x20, 0xe6,
-  0xf1, 0xcc, 0x32, 0x47, 0xfe, 0xc7, 0x2c, 0x07, 0xfd, 0xf5, 0x16, 0xe7,
-  0x45, 0x15, 0xe2, 0x19, 0x00, 0xdc, 0x0f, 0x39, 0xf3, 0x34, 0x18, 0xd6,
-  0x13, 0xf3, 0xec, 0x34, 0xdb, 0xdc, 0x27, 0x13, 0xf3, 0xfa, 0x1b, 0x15,
-  0xdf, 0xf2, 0xf5, 0xf9, 0x30, 0x12, 0xfa, 0x10, 0xe2, 0x14, 0xc5, 0xcc,
-  0x03, 0xd9, 0xf0, 0xbe, 0xb8, 0x52, 0xb5, 0x3b, 0x14, 0xe2, 0x25, 0xdb,
-  0x27, 0x0f, 0x1c, 0x38, 0xc6, 0x29, 0xf6, 0xe2, 0x25, 0x1a, 0xdf, 0xde,
-  0x20, 0xfa, 0x0f, 0xd4, 0x09, 0x1f, 0xc7, 0xc6, 0x01, 0xe4, 0xd1, 0x01,
-  0x1f, 0x06, 0x11, 0x97, 0x34, 0x1b, 0xff, 0xf8, 0xd6, 0x32, 0x1f, 0x05,
-  0x16, 0x00, 0xff, 0x10, 0x0a, 0x0f, 0x15, 0xfc, 0x3d, 0xcb, 0x2d, 0x03,
-  0xf6, 0xcd, 0x0a, 0xea, 0xe6, 0xfc, 0xa8, 0xe4, 0x08, 0x32, 0x03, 0x4c,
-  0x00, 0xef, 0x41, 0xa8, 0x54, 0x18, 0xdb, 0x20, 0xe3, 0xf4, 0x54, 0x10,
-  0xf8, 0xcd, 0xfe, 0xd3, 0x06, 0x18, 0xf0, 0x42, 0xe2, 0xe6, 0x3a, 0xe6,
-  0xdd, 0x04, 0xe7, 0x35, 0xb1, 0x1b, 0x1c, 0xb0, 0x2c, 0x01, 0xf4, 0xe5,
-  0xe2, 0x4e, 0x11, 0x20, 0xf7, 0x3d, 0x33, 0xd7, 0xa7, 0xdc, 0xea, 0x03,
-  0xea, 0xd1, 0x07, 0xdf, 0x04, 0x21, 0xb8, 0x05, 0xe4, 0x4f, 0xd4, 0xd1,
-  0xfc, 0xf8, 0xcf, 0x2e, 0xf0, 0x1b, 0x2c, 0xcf, 0x46, 0xea, 0xf0, 0xe7,
-  0x0d, 0x3e, 0x14, 0x32, 0x8a, 0xe0, 0x0e, 0x23, 0xd2, 0xf6, 0x08, 0x06,
-  0x18, 0x1d, 0x2a, 0x56, 0x22, 0xed, 0xeb, 0xfc, 0xd4, 0x3e, 0x0c, 0x39,
-  0x26, 0xca, 0x22, 0xfa, 0x0c, 0xc4, 0x36, 0x2f, 0xe2, 0xd8, 0x0d, 0xdd,
-  0xdf, 0xfe, 0xcc, 0xd6, 0x0b, 0x0d, 0xf8, 0xe9, 0x24, 0xf4, 0x10, 0x11,
-  0x7d, 0x0a, 0x0b, 0xc8, 0x50, 0x2d, 0xe9, 0x30, 0x3b, 0xec, 0x0f, 0x3b,
-  0x0f, 0x1f, 0xc5, 0xec, 0xe2, 0x0b, 0xd5, 0xda, 0x13, 0x7f, 0x0e, 0xee,
-  0xec, 0x01, 0x0e, 0xec, 0x1d, 0x12, 0x3d, 0xe0, 0x57, 0xd7, 0xca, 0xed,
-  0x27, 0x19, 0xc9, 0x06, 0x21, 0xfd, 0xc2, 0x02, 0xee, 0x21, 0xf9, 0xd7,
-  0x23, 0xf8, 0xcc, 0xf0, 0xe0, 0x14, 0x21, 0xc1, 0x00, 0xe4, 0x15, 0xbd,
-  0xfe, 0xfb, 0x2c, 0x30, 0x1f, 0x21, 0xbf, 0xdd, 0x0a, 0x2f, 0x01, 0xfa,
-  0x03, 0x2d, 0xf3, 0x1b, 0x15, 0xff, 0xf9, 0xfc, 0xdc, 0x30, 0xf1, 0x19,
-  0xd7, 0xd8, 0x2f, 0x11, 0xd3, 0x11, 0xfe, 0x37, 0xfa, 0x0a, 0x00, 0x0a,
-  0xdf, 0xdd, 0x0a, 0xd3, 0xdc, 0x0c, 0x24, 0xdc, 0x36, 0x15, 0x3a, 0xf5,
-  0x02, 0x13, 0xee, 0xee, 0x2a, 0x29, 0xf6, 0xf8, 0x03, 0xef, 0x3b, 0xf9,
-  0x27, 0xe1, 0x02, 0xf8, 0xe2, 0x15, 0xd1, 0xe9, 0xf0, 0x30, 0xe7, 0x19,
-  0x18, 0xd7, 0xe1, 0x2b, 0xf4, 0x02, 0xfa, 0xf9, 0xf8, 0xec, 0xfd, 0xea,
-  0xd9, 0x1c, 0xe7, 0x11, 0xab, 0x33, 0x36, 0xed, 0xc7, 0xf9, 0x2f, 0xe8,
-  0x05, 0xfb, 0xc9, 0x37, 0x10, 0x1b, 0x1b, 0xfd, 0xdc, 0x0e, 0xef, 0x20,
-  0xe4, 0xc4, 0xc6, 0x1b, 0x46, 0xd4, 0xff, 0x36, 0x16, 0xfa, 0x1f, 0x0a,
-  0xe1, 0x00, 0xe9, 0xef, 0xf3, 0xf9, 0x3f, 0xb6, 0x25, 0x03, 0x1c, 0x4e,
-  0x3c, 0xe9, 0x00, 0x0a, 0x1f, 0x3e, 0xe3, 0x62, 0x36, 0xd5, 0xfa, 0x08,
-  0xde, 0xc0, 0x15, 0xbb, 0x3c, 0x05, 0xee, 0xd4, 0xfb, 0x57, 0x51, 0xfe,
-  0x05, 0xe2, 0x14, 0xb8, 0x48, 0xfe, 0xde, 0xe6, 0x41, 0xf3, 0x1b, 0x02,
-  0xfe, 0x06, 0xe5, 0x00, 0x41, 0xd5, 0xed, 0x15, 0x20, 0xd2, 0x0d, 0xd8,
-  0xfe, 0xec, 0x06, 0xe0, 0xee, 0x08, 0x08, 0xc2, 0xd1, 0xea, 0x50, 0xac,
-  0x55, 0xde, 0x36, 0x4b, 0x25, 0xfd, 0xe7, 0x31, 0x30, 0x2c, 0xeb, 0xd9,
-  0x15, 0x43, 0xd5, 0x24, 0xe1, 0xf1, 0x50, 0xe8, 0xf9, 0x22, 0xde, 0x00,
-  0xdd, 0xe3, 0xe1, 0x19, 0xcb, 0x32, 0x19, 0xc5, 0x07, 0xfe, 0xd3, 0xd4,
-  0xf8, 0xf2, 0x2a, 0xe8, 0x34, 0xd6, 0xea, 0xd2, 0x21, 0x3e, 0x46, 0xfa,
-  0x0e, 0xf7, 0x0c, 0x11, 0x0b, 0x1c, 0x04, 0xce, 0x0e, 0x23, 0xee, 0xe4,
-  0xdf, 0xd1, 0xc2, 0x08, 0xea, 0x2e, 0x16, 0xb5, 0xea, 0x2d, 0xf3, 0x40,
-  0xfd, 0xee, 0xdd, 0x03, 0xd6, 0xe4, 0xf7, 0x25, 0xf7, 0xda, 0x59, 0x93,
-  0x59, 0xfa, 0xc2, 0x09, 0xd7, 0x05, 0xf2, 0xc1, 0xf4, 0xea, 0xd1, 0x29,
-  0xfa, 0x0b, 0xef, 0x06, 0xb9, 0xe5, 0x17, 0x4c, 0xfd, 0xd7, 0xfe, 0xff,
-  0x19, 0xfd, 0xd8, 0xc4, 0x1c, 0xf5, 0xc7, 0xcf, 0xd9, 0x10, 0x00, 0x2f,
-  0x2a, 0xea, 0x2b, 0x31, 0xf0, 0x02, 0xf8, 0x37, 0x09, 0x24, 0x15, 0x2f,
-  0x00, 0x18, 0xfc, 0xed, 0xe2, 0xc2, 0xe0, 0xf9, 0xeb, 0xe8, 0xfe, 0xf6,
-  0x1b, 0x1f, 0x04, 0x15, 0x19, 0x14, 0x20, 0xe1, 0xff, 0x11, 0x0c, 0xcb,
-  0xe5, 0xf6, 0xfb, 0x24, 0xf4, 0x12, 0xec, 0xd4, 0xca, 0x19, 0xc9, 0x25,
-  0xd3, 0xe4, 0xde, 0x1b, 0x26, 0xcd, 0xf1, 0xcd, 0xef, 0x76, 0xde, 0x1b,
-  0x0e, 0xf4, 0xc4, 0xeb, 0xcd, 0xf6, 0xff, 0xd6, 0x12, 0xd5, 0xdf, 0x46,
-  0x0e, 0xfc, 0x12, 0x0c, 0xe8, 0xe8, 0x27, 0xf3, 0xe5, 0xe4, 0xee, 0x3f,
-  0x00, 0xdd, 0xe7, 0x2a, 0x36, 0x08, 0xdf, 0x17, 0xe0, 0x02, 0x13, 0xfe,
-  0xf5, 0x1c, 0xfd, 0xc9, 0x28, 0x1f, 0xd5, 0x34, 0x29, 0x0a, 0x16, 0xe7,
-  0x03, 0x03, 0xbd, 0x0f, 0xf5, 0x08, 0xe1, 0x15, 0xf2, 0xdc, 0x06, 0xeb,
-  0xec, 0x37, 0x0b, 0x01, 0x07, 0x05, 0x18, 0x04, 0x37, 0xd8, 0xc1, 0x02,
-  0x16, 0xf1, 0xfe, 0x31, 0xff, 0xf6, 0xf5, 0xda, 0xfe, 0xd7, 0x13, 0xf1,
-  0x1b, 0xf0, 0xf9, 0x13, 0xf7, 0xe9, 0x44, 0xf4, 0x0e, 0x18, 0xf0, 0x09,
-  0x19, 0x05, 0x0e, 0xe6, 0xf9, 0xf4, 0xeb, 0xfd, 0xf6, 0xe8, 0xe6, 0xfd,
-  0x04, 0xf2, 0xec, 0x24, 0xb4, 0xf2, 0xc8, 0x07, 0xbe, 0xd3, 0x07, 0xe7,
-  0x24, 0xcf, 0xdc, 0x07, 0xe0, 0xe2, 0xe2, 0x11, 0x27, 0xfc, 0x1e, 0x98,
-  0xfc, 0x1b, 0x27, 0x1b, 0xc9, 0xfa, 0xde, 0xf1, 0xff, 0x1d, 0x00, 0x69,
-  0x3d, 0x46, 0x1a, 0x26, 0x17, 0xff, 0x0a, 0xe9, 0xf4, 0x13, 0xf8, 0xe6,
-  0xf0, 0x07, 0x0f, 0x05, 0xd1, 0x03, 0x09, 0xeb, 0x0c, 0xc7, 0x15, 0x28,
-  0x16, 0x07, 0x22, 0x0b, 0xf8, 0xf5, 0xef, 0xea, 0xb7, 0x03, 0xc7, 0xfb,
-  0xc7, 0xfd, 0xef, 0x16, 0x17, 0xd1, 0x03, 0x0e, 0xdf, 0x6c, 0xd8, 0x10,
-  0x39, 0x00, 0x17, 0xc2, 0xf7, 0xea, 0xfa, 0xce, 0x10, 0xf8, 0xe3, 0xdf,
-  0x1e, 0xfa, 0x01, 0x33, 0xfa, 0x08, 0x0f, 0x31, 0x4e, 0xf0, 0xfb, 0xf6,
-  0x16, 0x15, 0xf4, 0x22, 0xf5, 0xb8, 0xf9, 0x16, 0x03, 0xdb, 0xc4, 0x48,
-  0x18, 0x15, 0x1c, 0x0e, 0x17, 0x0d, 0xf2, 0x1a, 0x06, 0x25, 0xf9, 0xf0,
-  0x12, 0xfe, 0xfb, 0xf9, 0x0f, 0xe6, 0xf6, 0x02, 0xf4, 0xe2, 0x0e, 0xeb,
-  0xd9, 0x5b, 0xe2, 0xe0, 0xfd, 0xf5, 0x15, 0x0a, 0x38, 0xd1, 0xfd, 0xdc,
-  0x0f, 0xfe, 0x21, 0xdf, 0x1e, 0xef, 0xdc, 0xea, 0xcc, 0xf4, 0xf2, 0x37,
-  0x31, 0x06, 0x02, 0xfb, 0x13, 0x32, 0x3a, 0xdd, 0x07, 0xfc, 0x17, 0x09,
-  0x01, 0x25, 0xa6, 0x04, 0xff, 0xe7, 0x0f, 0x1f, 0x04, 0xeb, 0x08, 0xd7,
-  0xde, 0x3f, 0xc5, 0xf1, 0xd1, 0x15, 0x2a, 0x00, 0xd0, 0x19, 0x32, 0xc3,
-  0xe3, 0xc3, 0xf0, 0x1a, 0x29, 0xe7, 0x1b, 0xe6, 0x0b, 0xf5, 0xf7, 0x83,
-  0xdb, 0x16, 0xbe, 0xfb, 0xff, 0x13, 0xee, 0xe2, 0x06, 0x06, 0x08, 0xf8,
-  0x2f, 0x19, 0x0d, 0x2d, 0xde, 0x2c, 0xf7, 0x1a, 0xe8, 0x0e, 0xed, 0x06,
-  0xf6, 0x1b, 0xf8, 0xea, 0x22, 0x06, 0xf2, 0xf1, 0xff, 0xf4, 0xf4, 0x35,
-  0xf5, 0x06, 0x28, 0xbc, 0x20, 0x28, 0xc5, 0x1c, 0xb2, 0x05, 0xea, 0x1a,
-  0x05, 0x15, 0x11, 0x1d, 0x08, 0x1a, 0x18, 0x13, 0x1f, 0x04, 0x02, 0xe1,
-  0x11, 0xe7, 0xd1, 0xd0, 0xf3, 0xff, 0xd6, 0x1b, 0xe5, 0xeb, 0x46, 0xdb,
-  0xfe, 0x20, 0xfb, 0xf3, 0xda, 0xfd, 0x13, 0x4a, 0x03, 0x2b, 0xec, 0xe6,
-  0x12, 0x2c, 0x14, 0x01, 0xf2, 0xe0, 0xf5, 0xda, 0x7f, 0xdd, 0xac, 0x0f,
-  0x01, 0xe7, 0xf2, 0x0d, 0xab, 0xff, 0x10, 0x0f, 0x20, 0x0c, 0xd2, 0x2d,
-  0xdc, 0x14, 0x28, 0xf7, 0x20, 0xf6, 0x03, 0x1d, 0xf4, 0xf8, 0x3b, 0xd9,
-  0x37, 0xda, 0x13, 0xe5, 0xf8, 0xf6, 0xee, 0xf8, 0xfc, 0xc8, 0xc3, 0xef,
-  0x0d, 0xee, 0x14, 0xf6, 0xe5, 0xf0, 0x0e, 0x07, 0xec, 0x01, 0x32, 0x20,
-  0x02, 0xee, 0x02, 0x00, 0x0d, 0x39, 0x12, 0xdf, 0xc3, 0x29, 0x31, 0xef,
-  0x15, 0x25, 0xa5, 0x05, 0x10, 0x97, 0xce, 0x08, 0x10, 0xc4, 0xe4, 0x30,
-  0xf3, 0xf5, 0xc6, 0xfc, 0xf6, 0xcb, 0x03, 0xc9, 0x00, 0xf3, 0xcd, 0x1d,
-  0xf2, 0xea, 0x2a, 0x05, 0x10, 0xf8, 0xd2, 0xff, 0xd8, 0x06, 0x1e, 0x30,
-  0x3d, 0xc4, 0xef, 0x16, 0x08, 0x3d, 0xc9, 0xf3, 0x2a, 0xe0, 0x05, 0x08,
-  0xc9, 0x14, 0x31, 0xe0, 0x3c, 0x17, 0x35, 0xe2, 0x18, 0x02, 0x1f, 0xe6,
-  0x19, 0xe3, 0x3c, 0x33, 0x0a, 0xc3, 0xf7, 0xc3, 0x1e, 0xa3, 0xe9, 0x20,
-  0x3e, 0xca, 0xdc, 0x43, 0x26, 0x11, 0xdd, 0xff, 0xc9, 0xea, 0xda, 0x3c,
-  0xef, 0xdf, 0xfd, 0x29, 0xf2, 0x22, 0x38, 0xf5, 0x32, 0x0a, 0x4e, 0x14,
-  0xfd, 0xff, 0x02, 0x23, 0xf6, 0xfb, 0x17, 0x31, 0xd5, 0xf9, 0xfa, 0x18,
-  0xd3, 0xd1, 0xe6, 0x02, 0xed, 0x25, 0x09, 0xe1, 0x2b, 0x58, 0x30, 0xaf,
-  0x1e, 0xe9, 0x1c, 0xb8, 0x36, 0x1d, 0x25, 0x48, 0xe7, 0x18, 0xef, 0xc6,
-  0x0d, 0xe3, 0x05, 0x1a, 0x06, 0xaf, 0x0e, 0x7f, 0xab, 0xcf, 0xc0, 0xe9,
-  0x10, 0x22, 0xe0, 0xff, 0xe2, 0xfa, 0xce, 0xdb, 0x08, 0x2a, 0x2d, 0x12,
-  0x02, 0xd7, 0xd1, 0xe1, 0xea, 0x23, 0x25, 0xda, 0xed, 0xef, 0xd8, 0x29,
-  0xea, 0x07, 0xe1, 0x1a, 0xce, 0x19, 0xf3, 0xfd, 0xcd, 0x11, 0xf7, 0x09,
-  0x27, 0xd4, 0x08, 0xdf, 0x27, 0x20, 0x10, 0xe9, 0xf7, 0x1e, 0x62, 0xf2,
-  0x13, 0xb1, 0x1e, 0xdc, 0xe9, 0x13, 0x1f, 0xf2, 0xf7, 0x28, 0xe1, 0xe5,
-  0xf4, 0x43, 0xe2, 0x20, 0x27, 0xde, 0xcf, 0xe0, 0x06, 0xcf, 0xeb, 0x1e,
-  0xd2, 0x10, 0xf4, 0x0f, 0x12, 0x1b, 0xd7, 0x01, 0x05, 0xe6, 0xe6, 0xbe,
-  0xdc, 0x13, 0xf8, 0xf1, 0x02, 0x18, 0xbf, 0xad, 0x1d, 0xf8, 0x00, 0x18,
-  0xfb, 0x20, 0x0b, 0x22, 0x3c, 0xfa, 0x08, 0xf4, 0x2f, 0x3d, 0x26, 0x1f,
-  0xeb, 0xdb, 0xd6, 0xe8, 0xfd, 0xf3, 0xdc, 0x1e, 0xfe, 0x03, 0x1e, 0xf2,
-  0xf8, 0x0b, 0xd2, 0x33, 0xec, 0x37, 0xf8, 0x28, 0xfd, 0xf3, 0xc5, 0x30,
-  0xcb, 0xd0, 0x18, 0x0b, 0xe5, 0x12, 0x0e, 0xf8, 0xde, 0xde, 0x2a, 0xe7,
-  0x0a, 0x03, 0xdd, 0x12, 0xc2, 0xf6, 0x12, 0x0a, 0xfe, 0x20, 0x12, 0xe9,
-  0x02, 0xf9, 0xf5, 0xed, 0xdf, 0x3b, 0x07, 0x2e, 0x14, 0xfb, 0xf5, 0xb8,
-  0x46, 0x2b, 0x21, 0xe9, 0xfe, 0xe3, 0xc9, 0x2b, 0x3b, 0x2d, 0xe1, 0x67,
-  0x06, 0x18, 0x29, 0x11, 0x3d, 0x3a, 0xff, 0x3a, 0xda, 0xfe, 0x1e, 0x39,
-  0x03, 0x19, 0xd2, 0x2c, 0xd1, 0xe3, 0x02, 0xc1, 0xe7, 0xef, 0x24, 0xda,
-  0xea, 0xe3, 0x1d, 0xe4, 0x05, 0x47, 0xdd, 0xc1, 0xe6, 0xe0, 0xf9, 0x1a,
-  0x1a, 0x1c, 0xfb, 0xe3, 0x02, 0xee, 0xdf, 0x07, 0x93, 0xf6, 0xfa, 0x1a,
-  0xea, 0xec, 0xfb, 0x0a, 0x2c, 0x07, 0x16, 0xe9, 0xc4, 0xe7, 0x05, 0xf1,
-  0xf6, 0xee, 0xf7, 0x3f, 0x0d, 0x41, 0x12, 0xd9, 0xea, 0x04, 0x0f, 0xc1,
-  0xf1, 0x5e, 0xd7, 0x05, 0x26, 0x01, 0xcb, 0x07, 0xfc, 0xdd, 0xe1, 0x08,
-  0xe3, 0x1d, 0xd6, 0xf5, 0x29, 0x42, 0x21, 0x2d, 0xf8, 0xcd, 0x29, 0xc6,
-  0xed, 0xec, 0xe6, 0x18, 0x35, 0xe9, 0xeb, 0xd3, 0x14, 0x11, 0x07, 0xbe,
-  0x1a, 0xc0, 0xf8, 0x0d, 0x2d, 0x17, 0xee, 0x01, 0x16, 0xf4, 0x12, 0xd0,
-  0xb9, 0x07, 0x0d, 0xd8, 0x0b, 0xf1, 0xbb, 0x06, 0xfe, 0x02, 0xea, 0xf8,
-  0xff, 0xe0, 0xdf, 0xe7, 0xef, 0x5c, 0xae, 0x02, 0x42, 0xfe, 0xd5, 0x13,
-  0xcb, 0x03, 0xd6, 0x23, 0x0d, 0x1a, 0xf6, 0xd4, 0x27, 0x1c, 0x5f, 0x03,
-  0x05, 0xeb, 0x17, 0xef, 0xec, 0x21, 0x17, 0xfa, 0x24, 0xdb, 0xd6, 0x05,
-  0xf9, 0x01, 0x25, 0xc1, 0x14, 0x23, 0xf7, 0x1a, 0x19, 0x02, 0xe3, 0xef,
-  0xe2, 0x05, 0x31, 0xe2, 0xe2, 0x18, 0x20, 0x27, 0x11, 0xfe, 0xdc, 0x1f,
-  0x16, 0xe8, 0x07, 0xfb, 0x14, 0x0c, 0x00, 0x0b, 0x12, 0x2b, 0x13, 0xdd,
-  0x45, 0x16, 0xd3, 0x36, 0xf7, 0x13, 0x0d, 0x04, 0x2b, 0x0c, 0x30, 0xda,
-  0x06, 0xf8, 0x0c, 0xf4, 0x07, 0x0f, 0x22, 0xa4, 0x23, 0xfd, 0x0a, 0x21,
-  0x0f, 0x11, 0x03, 0x1a, 0x03, 0x30, 0xf0, 0x21, 0x00, 0x34, 0xe1, 0x13,
-  0xd4, 0x29, 0xec, 0x05, 0x06, 0xe4, 0x16, 0x17, 0xb2, 0x04, 0x2f, 0x21,
-  0xb4, 0x22, 0xff, 0x3a, 0xd7, 0xe4, 0xda, 0x0b, 0xe2, 0xa0, 0xdb, 0xef,
-  0x68, 0x35, 0xf0, 0xd9, 0xf5, 0x34, 0x19, 0x02, 0xd6, 0xfb, 0x00, 0x2c,
-  0xfe, 0x31, 0xf7, 0x39, 0x20, 0x16, 0x22, 0x02, 0x15, 0xf2, 0xf1, 0x27,
-  0x62, 0xe5, 0x02, 0x26, 0xec, 0xc0, 0x15, 0x0f, 0xc9, 0xd0, 0xf9, 0x5e,
-  0x4b, 0xf8, 0x14, 0xf4, 0xfc, 0xbb, 0xb4, 0xde, 0xe0, 0xf9, 0xf0, 0xc7,
-  0xe2, 0x68, 0x01, 0x34, 0x11, 0xd4, 0x02, 0xf4, 0xda, 0xd6, 0xf8, 0x29,
-  0xee, 0xcd, 0xef, 0x0a, 0xed, 0x17, 0x28, 0xb2, 0xcd, 0x0c, 0x2b, 0x17,
-  0xc4, 0x39, 0xf5, 0x4c, 0xd3, 0x51, 0x1b, 0xfc, 0x21, 0x20, 0xec, 0xd2,
-  0xfd, 0x07, 0x0a, 0x17, 0x08, 0xeb, 0xcb, 0xb3, 0x29, 0xcf, 0x27, 0x0b,
-  0x1e, 0x37, 0x55, 0x2a, 0x21, 0x00, 0xcf, 0xe5, 0xdd, 0xd8, 0xc7, 0xe6,
-  0xcb, 0xc0, 0xef, 0x0b, 0xd0, 0x24, 0x06, 0x10, 0xeb, 0xa9, 0x0a, 0xe1,
-  0xbc, 0x32, 0xdb, 0x29, 0xb1, 0xdb, 0xcf, 0x49, 0xe5, 0x01, 0xe3, 0xe4,
-  0xf4, 0x33, 0xea, 0xeb, 0xf2, 0x12, 0x22, 0xbd, 0x0f, 0xfc, 0x4a, 0xe5,
-  0x22, 0x14, 0xe8, 0xe9, 0x42, 0xfe, 0x5b, 0x42, 0x04, 0xe9, 0xf5, 0x02,
-  0x13, 0xec, 0xe6, 0x32, 0x3a, 0xef, 0x27, 0xcd, 0x0c, 0xf7, 0xed, 0x2c,
-  0xe0, 0xc8, 0x95, 0x1c, 0xc4, 0x2a, 0xff, 0x61, 0x09, 0x6c, 0xa5, 0x0c,
-  0xfd, 0x13, 0xcf, 0xfa, 0x0a, 0x0f, 0x01, 0xbf, 0x08, 0x95, 0x2d, 0x47,
-  0x23, 0x18, 0xc1, 0x51, 0x04, 0x3a, 0x29, 0xec, 0x20, 0xed, 0xe4, 0xdb,
-  0xd9, 0xf0, 0x25, 0xfb, 0xda, 0x27, 0xe4, 0xd1, 0xf0, 0x10, 0xbf, 0x82,
-  0x02, 0x07, 0x14, 0x03, 0xe8, 0x1f, 0x02, 0x19, 0xeb, 0x1f, 0x62, 0x3f,
-  0x49, 0xf2, 0xff, 0x42, 0x38, 0xe6, 0x08, 0x1d, 0x32, 0xdf, 0x00, 0xad,
-  0xe7, 0x13, 0x44, 0x58, 0xe9, 0xda, 0xe3, 0x03, 0xec, 0xd4, 0x21, 0xe5,
-  0xd9, 0xc5, 0x0b, 0x07, 0x01, 0xdc, 0xf9, 0x2e, 0x9d, 0x0a, 0x19, 0x1e,
-  0x25, 0xf7, 0xeb, 0xdf, 0xe4, 0xca, 0x16, 0xa2, 0xd9, 0x43, 0xc0, 0xdd,
-  0xd2, 0x05, 0xe3, 0x0e, 0xd7, 0xc8, 0x2e, 0x02, 0xd8, 0x24, 0x28, 0xfd,
-  0xd5, 0x4b, 0x2d, 0xb5, 0xe6, 0x24, 0x0f, 0xf8, 0xe0, 0x16, 0x23, 0xeb,
-  0x30, 0xcf, 0x30, 0xfd, 0xea, 0xe7, 0x49, 0xd6, 0x14, 0xab, 0xec, 0x00,
-  0xd1, 0xf1, 0xfa, 0xda, 0xd8, 0xe5, 0xde, 0x0b, 0xfa, 0x52, 0xfe, 0xfd,
-  0xe1, 0x19, 0x29, 0xe4, 0x7f, 0xf2, 0xdc, 0x16, 0xe4, 0xde, 0x11, 0xb3,
-  0x06, 0xf6, 0xd3, 0x32, 0xd2, 0xbc, 0xd1, 0xfa, 0x28, 0x03, 0x2d, 0xe7,
-  0xc4, 0xf5, 0x2e, 0xe9, 0xd6, 0x1a, 0x2b, 0x13, 0x0d, 0xf4, 0x20, 0x15,
-  0xf9, 0x53, 0xda, 0xe2, 0x07, 0x02, 0xdf, 0x60, 0x18, 0xf6, 0x1c, 0xf8,
-  0xde, 0x57, 0xa1, 0x04, 0x3a, 0x0f, 0xbb, 0x04, 0xf9, 0xda, 0x44, 0x5f,
-  0xf1, 0x57, 0xee, 0x2a, 0x43, 0xf9, 0x4d, 0xf6, 0x5d, 0x8a, 0xe3, 0xf6,
-  0xc9, 0x55, 0xf1, 0xfc, 0xf6, 0x0b, 0xe1, 0x98, 0xf6, 0x0d, 0xc3, 0x92,
-  0xda, 0x35, 0xf4, 0xe7, 0x00, 0x1c, 0x16, 0xd3, 0xeb, 0xc3, 0x19, 0x3b,
-  0x01, 0xc3, 0x48, 0x47, 0x17, 0xbd, 0xeb, 0xfb, 0x31, 0x38, 0xad, 0x0d,
-  0xfb, 0xf4, 0xda, 0x30, 0xe0, 0xcb, 0xf9, 0xef, 0x36, 0x30, 0xe4, 0xe3,
-  0xdc, 0x11, 0x16, 0x00, 0x2f, 0x30, 0xf4, 0xf9, 0x64, 0x0f, 0x4b, 0x2f,
-  0x12, 0xcc, 0xe5, 0xd9, 0x36, 0x50, 0x2f, 0xd7, 0xff, 0xdf, 0xfb, 0x09,
-  0xb9, 0xec, 0xb3, 0xec, 0x22, 0xee, 0x0e, 0x08, 0xd3, 0xfc, 0x3b, 0xcc,
-  0xe4, 0xe1, 0x06, 0x19, 0xa7, 0xf4, 0xff, 0x2a, 0xf9, 0xec, 0x12, 0x33,
-  0x54, 0x36, 0x0f, 0x39, 0x0a, 0xf7, 0x12, 0x01, 0x19, 0xc2, 0xe6, 0xb3,
-  0x4d, 0x1e, 0x3d, 0xe9, 0x0d, 0xef, 0x15, 0xf6, 0x2c, 0x3d, 0x1d, 0xd8,
-  0x2e, 0xe3, 0x0f, 0xe5, 0x2d, 0xd9, 0xca, 0xf6, 0x10, 0x19, 0x12, 0xf1,
-  0xf8, 0xee, 0xec, 0x03, 0xb1, 0xf1, 0xae, 0xb8, 0x2f, 0x20, 0xd4, 0xe5,
-  0xbb, 0xf9, 0x73, 0xd5, 0xcb, 0x0e, 0x04, 0x50, 0x0b, 0xc2, 0x2e, 0x4f,
-  0xe1, 0x1d, 0x07, 0x36, 0x48, 0xff, 0xc0, 0x28, 0x07, 0xa8, 0x4c, 0x30,
-  0xd8, 0xec, 0xcb, 0xe9, 0x2b, 0x0e, 0x1e, 0x25, 0x00, 0xb7, 0x97, 0xea,
-  0xe9, 0x37, 0xd2, 0x49, 0x0d, 0x0f, 0xcd, 0x16, 0xdd, 0x1e, 0x03, 0x1d,
-  0x22, 0xd8, 0xca, 0xff, 0xc6, 0x0f, 0x2d, 0x13, 0x37, 0xec, 0xf3, 0x54,
-  0xec, 0xcf, 0x2d, 0xfe, 0x2f, 0xb1, 0xeb, 0xfe, 0xe0, 0xe5, 0xed, 0x4a,
-  0x1b, 0xdf, 0x3a, 0x09, 0xfa, 0x10, 0xf8, 0xa4, 0x03, 0xfe, 0x2a, 0x3a,
-  0xdc, 0xe3, 0xe1, 0x1c, 0x04, 0xe3, 0xfd, 0x00, 0x06, 0xf5, 0xf5, 0xe9,
-  0xfa, 0xf8, 0xf9, 0x0f, 0xd2, 0x18, 0x00, 0x2d, 0x68, 0x08, 0xde, 0xb7,
-  0xe0, 0xec, 0xf6, 0xf7, 0xf5, 0x00, 0x0e, 0xf6, 0xdc, 0x0f, 0x63, 0xf1,
-  0x19, 0x07, 0xd4, 0xec, 0xde, 0x39, 0x14, 0xca, 0x08, 0x31, 0x52, 0x8d,
-  0xea, 0xd5, 0x11, 0x7d, 0x42, 0xeb, 0x33, 0x02, 0xed, 0x18, 0xff, 0xca,
-  0x24, 0x10, 0x3c, 0x0b, 0x14, 0x00, 0x02, 0xdf, 0x1a, 0xe7, 0xde, 0xf4,
-  0xc0, 0x22, 0xf5, 0x16, 0x14, 0xec, 0x11, 0x08, 0xd8, 0x40, 0xef, 0x0f,
-  0x52, 0xec, 0xef, 0xf9, 0xe1, 0xe2, 0x00, 0xcb, 0xb5, 0x03, 0x22, 0xbc,
-  0x13, 0x10, 0x35, 0xfd, 0x08, 0xdf, 0xf5, 0x21, 0xa5, 0x2a, 0xee, 0xff,
-  0xc9, 0x28, 0x35, 0xda, 0x00, 0xf3, 0x17, 0xbb, 0xb5, 0xe8, 0xff, 0xe0,
-  0xf5, 0xfd, 0xca, 0x0d, 0x0b, 0x0a, 0x06, 0x5e, 0x33, 0x28, 0x07, 0xf5,
-  0x33, 0xe8, 0xd5, 0xfb, 0x25, 0x08, 0x23, 0xfa, 0x06, 0x17, 0x22, 0xb4,
-  0xee, 0xe3, 0xc8, 0x49, 0x41, 0xdb, 0xed, 0xa3, 0x10, 0x11, 0xff, 0x28,
-  0xfb, 0xad, 0xaa, 0xd4, 0xf7, 0xf9, 0x01, 0x30, 0xee, 0x02, 0x02, 0x1f,
-  0xe8, 0xc4, 0x21, 0xc9, 0xfb, 0xfa, 0xe0, 0xb6, 0x06, 0xe8, 0xe6, 0xcb,
-  0x0a, 0x1a, 0x28, 0x11, 0xeb, 0xe5, 0x11, 0xc3, 0xfc, 0xe9, 0x07, 0xf8,
-  0x17, 0xec, 0xf6, 0x56, 0x36, 0xf6, 0x22, 0xfc, 0xeb, 0xe0, 0xe7, 0x00,
-  0xf2, 0x46, 0x38, 0xdc, 0x0a, 0x2c, 0xf8, 0x12, 0x09, 0x11, 0xcb, 0xc1,
-  0x04, 0xc9, 0x28, 0x17, 0xe9, 0x08, 0xff, 0xcc, 0x1f, 0xed, 0x36, 0xf1,
-  0xf1, 0xf7, 0xf2, 0x09, 0xfe, 0xe6, 0x29, 0x97, 0xe4, 0x14, 0xe8, 0x81,
-  0x04, 0xc2, 0x18, 0xe9, 0x0d, 0x02, 0xf5, 0x0d, 0x37, 0x01, 0xeb, 0x08,
-  0x2c, 0xc8, 0xd2, 0xce, 0x4b, 0xfa, 0x07, 0xe1, 0x21, 0xe8, 0x08, 0xcc,
-  0xb8, 0xfc, 0xd8, 0xd7, 0xdd, 0x11, 0x1d, 0x36, 0x1a, 0x18, 0xb4, 0x0f,
-  0x1f, 0x30, 0xdb, 0x0e, 0xf6, 0xd4, 0x34, 0xe0, 0xc7, 0x1a, 0x01, 0xea,
-  0x3e, 0xf5, 0x3b, 0x27, 0x05, 0xd7, 0xd0, 0xd5, 0x0a, 0x29, 0x07, 0xc7,
-  0xe0, 0x1b, 0x20, 0xe2, 0xf9, 0x05, 0x2d, 0xfd, 0x3c, 0xa9, 0xcc, 0xf2,
-  0x05, 0x12, 0x35, 0x15, 0x1f, 0x16, 0xcd, 0xee, 0x37, 0x12, 0x21, 0x1d,
-  0x2f, 0xe7, 0xef, 0xd1, 0x54, 0x20, 0x20, 0xd9, 0xe3, 0x2b, 0x35, 0xa4,
-  0xfb, 0x03, 0x0f, 0x23, 0x00, 0x0c, 0xf3, 0xaf, 0x1e, 0xdb, 0x46, 0xea,
-  0x10, 0x1a, 0xe9, 0xf0, 0x39, 0xce, 0xfd, 0x3c, 0xef, 0x00, 0x27, 0xc7,
-  0xec, 0xea, 0x36, 0x03, 0xd5, 0x07, 0xa9, 0xd6, 0x35, 0xe8, 0x03, 0x23,
-  0x9c, 0x12, 0x43, 0xda, 0x5b, 0xc3, 0xfd, 0xff, 0xb5, 0xfe, 0xda, 0xe9,
-  0x3f, 0x13, 0xe7, 0xdf, 0x6f, 0x26, 0x6e, 0x67, 0x74, 0x18, 0xf2, 0x15,
-  0xf4, 0x2c, 0x14, 0xcd, 0x09, 0xfc, 0xe0, 0xd9, 0xf1, 0x57, 0xf3, 0xc7,
-  0x2c, 0xfc, 0x3a, 0xfc, 0xfd, 0x08, 0x15, 0x1c, 0x43, 0x09, 0x21, 0xfd,
-  0xf6, 0xe0, 0x21, 0xc1, 0x01, 0xc6, 0x2f, 0xd2, 0x02, 0xd0, 0xd8, 0xd1,
-  0x14, 0xf8, 0xff, 0xc2, 0xd3, 0x11, 0x05, 0xf3, 0x31, 0xde, 0xfd, 0xb5,
-  0xa4, 0xf4, 0x1b, 0xc4, 0x4c, 0x0b, 0x05, 0xf2, 0x63, 0x62, 0x36, 0x0e,
-  0xf3, 0xf1, 0xf7, 0xdc, 0xdd, 0xbc, 0x3e, 0x3a, 0xf6, 0xd7, 0xb2, 0xee,
-  0x8c, 0x0b, 0xd4, 0xeb, 0x50, 0x11, 0x43, 0x2f, 0xc7, 0x2a, 0x15, 0xff,
-  0x6c, 0x0f, 0xe6, 0xef, 0xef, 0xeb, 0x2f, 0x95, 0x2a, 0x04, 0x19, 0xcf,
-  0x37, 0xaa, 0xf2, 0x35, 0x12, 0x2a, 0x14, 0xc9, 0x12, 0xda, 0xc1, 0xd5,
-  0xfc, 0x17, 0x3d, 0xcd, 0xd6, 0x39, 0xd7, 0xde, 0x2c, 0x2a, 0xf1, 0x13,
-  0x45, 0x46, 0xff, 0x14, 0x35, 0xca, 0x0a, 0x05, 0x5f, 0x08, 0x2e, 0x2d,
-  0x12, 0xea, 0x33, 0xf1, 0xdc, 0x31, 0xf4, 0xee, 0x0e, 0xe4, 0xed, 0x1c,
-  0xe9, 0x06, 0xd4, 0x1e, 0xda, 0xdb, 0x32, 0x03, 0x05, 0x15, 0xf0, 0xf9,
-  0x29, 0x34, 0x04, 0x02, 0x00, 0x29, 0xd5, 0xf0, 0xf3, 0xd7, 0xfc, 0xe1,
-  0xea, 0x14, 0x11, 0xa8, 0xbb, 0x2c, 0x22, 0x03, 0xf1, 0xc3, 0x55, 0x33,
-  0xf0, 0x04, 0x20, 0x17, 0x22, 0x56, 0x20, 0x2e, 0x07, 0x19, 0xc8, 0x04,
-  0x29, 0xe5, 0x1a, 0xf7, 0xff, 0xf4, 0x01, 0xbe, 0x19, 0xeb, 0xc7, 0xd4,
-  0x19, 0xb3, 0xf1, 0x09, 0x0d, 0x04, 0x92, 0x03, 0xe7, 0x1b, 0xdf, 0x01,
-  0x62, 0xc5, 0xcb, 0xff, 0x2b, 0x07, 0xbd, 0xf2, 0xf6, 0x5b, 0x0d, 0xdc,
-  0xee, 0xbc, 0xf0, 0x46, 0xfb, 0xe2, 0x02, 0x18, 0xf7, 0x21, 0xd3, 0x27,
-  0xeb, 0x18, 0x4f, 0x17, 0x14, 0xf0, 0x12, 0xe1, 0xeb, 0x35, 0x11, 0xf5,
-  0xe6, 0xfd, 0xe9, 0xf7, 0xe7, 0xdc, 0xc9, 0xe4, 0xdf, 0xeb, 0x1a, 0x3d,
-  0xc0, 0xf5, 0xc2, 0x9a, 0x17, 0xcc, 0x17, 0xf1, 0x0e, 0xd4, 0xea, 0xf8,
-  0x02, 0x62, 0x0c, 0x07, 0x16, 0xf3, 0xf7, 0x23, 0x08, 0x14, 0xba, 0xf5,
-  0x16, 0x14, 0xe8, 0xe0, 0x01, 0xa9, 0x00, 0x20, 0xb3, 0x05, 0x04, 0x19,
-  0xed, 0xcd, 0xb3, 0x20, 0xce, 0x5e, 0x1c, 0x32, 0x19, 0x07, 0x2c, 0xef,
-  0xf2, 0x5c, 0xc2, 0x26, 0xf0, 0xf0, 0x04, 0x00, 0x45, 0xcd, 0xe4, 0xe1,
-  0xe2, 0xaf, 0x08, 0xf0, 0x18, 0x0a, 0x29, 0x12, 0x0b, 0x0e, 0x23, 0x03,
-  0xe2, 0xdd, 0x0d, 0xff, 0x23, 0xf4, 0xe2, 0x2a, 0xd2, 0xca, 0xf0, 0xea,
-  0xca, 0xcb, 0xed, 0x24, 0xfb, 0xc2, 0x24, 0x00, 0x04, 0xc7, 0x1a, 0xda,
-  0xe8, 0xeb, 0xe4, 0xea, 0xce, 0x1a, 0xbc, 0xee, 0xd8, 0xd2, 0x12, 0x16,
-  0xeb, 0x18, 0x06, 0x4d, 0xec, 0xee, 0x22, 0xfb, 0xed, 0x1d, 0xe6, 0x2b,
-  0x1c, 0x0b, 0xf0, 0xe2, 0xb9, 0xde, 0xf1, 0xd3, 0xfd, 0xe5, 0x0f, 0x16,
-  0x2d, 0xc4, 0xfb, 0x05, 0x2b, 0xea, 0xce, 0x1e, 0xf3, 0xec, 0xb7, 0x2d,
-  0x3f, 0xc0, 0xe6, 0x1f, 0xd8, 0xc9, 0x14, 0xfc, 0x0b, 0xf9, 0x2f, 0xf3,
-  0x0c, 0x0f, 0x1a, 0xe5, 0x07, 0xc8, 0x01, 0x0c, 0xc8, 0xd3, 0x10, 0x03,
-  0xe9, 0x17, 0x2a, 0x38, 0xf2, 0xb7, 0xd0, 0x58, 0x16, 0xf6, 0x39, 0x0e,
-  0xef, 0xe1, 0x24, 0x24, 0xf8, 0xf9, 0xbe, 0xc1, 0xfa, 0x38, 0xff, 0x43,
-  0xf3, 0x12, 0xea, 0x08, 0x0a, 0xcb, 0x49, 0x1c, 0xf1, 0xeb, 0x09, 0xf6,
-  0xe6, 0x0c, 0xf7, 0xfc, 0x1e, 0x04, 0x1f, 0x37, 0xe1, 0x08, 0xed, 0xe4,
-  0x45, 0xde, 0xd0, 0xc4, 0xf2, 0xd3, 0xe6, 0xb8, 0xe2, 0xfc, 0xf3, 0xea,
-  0xe3, 0xed, 0xf3, 0x0a, 0xdf, 0xfd, 0xfd, 0xfa, 0x07, 0xfc, 0x12, 0x2d,
-  0xe0, 0xf9, 0x12, 0x06, 0xfd, 0xba, 0xee, 0xd7, 0x3f, 0x05, 0xd1, 0xf8,
-  0xfe, 0xd3, 0x01, 0x22, 0x15, 0x05, 0xed, 0x27, 0xf0, 0x13, 0x2a, 0xe8,
-  0x14, 0xd0, 0x54, 0xc1, 0xf9, 0x39, 0xcd, 0x21, 0x96, 0xd1, 0x65, 0x1d,
-  0x07, 0xbc, 0xfb, 0x28, 0x60, 0xf7, 0x27, 0xe6, 0xeb, 0x1d, 0x37, 0xc6,
-  0x17, 0x00, 0x19, 0xd2, 0x00, 0xe2, 0xea, 0x24, 0xaa, 0x03, 0x16, 0x07,
-  0xe4, 0x2e, 0x03, 0x40, 0x12, 0xf5, 0x10, 0xdb, 0x18, 0xd1, 0xdb, 0xd8,
-  0xec, 0x17, 0xb9, 0x19, 0x9a, 0xee, 0xe2, 0xfc, 0xce, 0xe9, 0xfb, 0x2e,
-  0x14, 0xe4, 0x19, 0xf3, 0x03, 0xe8, 0x65, 0xf3, 0x1f, 0x0a, 0xf3, 0x16,
-  0x29, 0xf8, 0x4a, 0x25, 0x08, 0xe5, 0x4f, 0x12, 0x52, 0xd6, 0x25, 0x3a,
-  0x23, 0x36, 0x12, 0xca, 0xf6, 0x33, 0x17, 0x00, 0x11, 0xb8, 0x13, 0x1e,
-  0xfe, 0x04, 0x57, 0x11, 0xe4, 0x27, 0xe9, 0x58, 0x4d, 0xe0, 0x01, 0xd5,
-  0x1b, 0xf2, 0xc9, 0xfb, 0xfd, 0x0e, 0xc3, 0xf6, 0x0c, 0x13, 0xdf, 0x2e,
-  0xeb, 0x18, 0xf6, 0x2f, 0x09, 0xc8, 0x31, 0x15, 0x02, 0x24, 0x3f, 0x25,
-  0x2c, 0xf4, 0x16, 0x0d, 0x3d, 0x34, 0x20, 0xe4, 0xfc, 0x1f, 0x43, 0x22,
-  0x7f, 0xde, 0x21, 0xd7, 0xe4, 0x01, 0xf5, 0xb3, 0xcb, 0x29, 0x00, 0xb6,
-  0xfb, 0xb4, 0xfb, 0x1f, 0x11, 0xc9, 0x1b, 0xef, 0x29, 0x22, 0xff, 0x47,
-  0x54, 0xc4, 0x57, 0xf7, 0xd3, 0xe7, 0x05, 0x10, 0xde, 0x49, 0xd9, 0x13,
-  0xd1, 0x2d, 0x09, 0xde, 0xe6, 0xec, 0xf0, 0xf4, 0x0b, 0xfd, 0xeb, 0x27,
-  0xdc, 0xec, 0xe0, 0x00, 0xb4, 0xc2, 0x07, 0xfe, 0x19, 0x64, 0x2a, 0xcb,
-  0x13, 0xf9, 0xe1, 0xfa, 0xbc, 0x01, 0x1c, 0xd7, 0x3e, 0x55, 0xd8, 0xeb,
-  0xe4, 0x2b, 0xef, 0xf6, 0xd8, 0x04, 0x27, 0x1d, 0x2e, 0xc7, 0x36, 0x0d,
-  0x05, 0xf3, 0xf9, 0xfd, 0xeb, 0xf8, 0xb1, 0x1d, 0xb3, 0x24, 0xdf, 0x02,
-  0x04, 0x42, 0xcf, 0x1a, 0xd6, 0x4d, 0xea, 0x2b, 0xf1, 0x2c, 0xd5, 0xed,
-  0xfb, 0xe5, 0xbe, 0x29, 0x00, 0xd3, 0x3d, 0x2d, 0xea, 0xcd, 0x51, 0xfb,
-  0x10, 0x41, 0xfe, 0xfc, 0x31, 0xe8, 0xdb, 0x32, 0xce, 0x6f, 0xec, 0xec,
-  0x60, 0x5e, 0x2f, 0xc4, 0xf3, 0x23, 0x36, 0xd9, 0xc2, 0x34, 0x31, 0x2c,
-  0xee, 0xe0, 0x2a, 0xd7, 0x1c, 0xef, 0x1c, 0x38, 0xe5, 0x0c, 0xaf, 0x11,
-  0xbe, 0xf3, 0xbc, 0xd8, 0xe5, 0x1c, 0x1f, 0x15, 0xda, 0x01, 0xf2, 0x07,
-  0x2a, 0xd1, 0xc3, 0x17, 0xea, 0x13, 0x95, 0x0b, 0xf3, 0x8e, 0x15, 0x0a,
-  0x9e, 0xf5, 0x19, 0xe9, 0x1f, 0x69, 0xf4, 0xdd, 0x07, 0x38, 0x10, 0xf2,
-  0xd5, 0x34, 0x1b, 0xf6, 0x26, 0x0c, 0xfd, 0xe3, 0x12, 0xf6, 0xed, 0xb4,
-  0xf3, 0x18, 0x20, 0xfe, 0xf2, 0xe6, 0x25, 0xde, 0x01, 0xfe, 0x0d, 0xf6,
-  0x11, 0xf0, 0xd3, 0x1e, 0xea, 0xfd, 0xe2, 0xef, 0xc7, 0x06, 0x02, 0xc1,
-  0x2b, 0x19, 0xc5, 0x14, 0x1c, 0x1b, 0xee, 0xf1, 0x61, 0xd6, 0x1c, 0xef,
-  0xfb, 0xf7, 0x00, 0xc7, 0xee, 0xdb, 0x29, 0x21, 0x0b, 0x0c, 0x33, 0xd0,
-  0xbe, 0x10, 0x12, 0xec, 0x16, 0xd3, 0xf0, 0xf9, 0x3b, 0x20, 0xeb, 0x34,
-  0xd2, 0xdc, 0xf7, 0x38, 0xfb, 0x10, 0x1f, 0x1f, 0x1f, 0x12, 0x3d, 0x01,
-  0xcf, 0xfd, 0x06, 0x1a, 0x0a, 0x0d, 0x18, 0x11, 0xee, 0x1e, 0xec, 0xe6,
-  0xe3, 0xd8, 0x0b, 0xbb, 0x1d, 0x43, 0xb7, 0xfd, 0x37, 0x6a, 0xe8, 0xc5,
-  0x54, 0xd5, 0x19, 0x1e, 0x00, 0xed, 0x4b, 0xab, 0x29, 0xdd, 0x30, 0x00,
-  0x07, 0xbd, 0xf9, 0x02, 0xdf, 0xdd, 0xcb, 0xcf, 0x25, 0x0a, 0xf2, 0xef,
-  0x39, 0x06, 0xd8, 0x19, 0xc8, 0x13, 0x26, 0x19, 0x01, 0x38, 0x40, 0x4e,
-  0xdd, 0x0a, 0x63, 0xfc, 0xff, 0xf2, 0x04, 0x7f, 0x15, 0x28, 0xe7, 0x0e,
-  0xf5, 0xd6, 0xbd, 0xdd, 0xe6, 0x11, 0x41, 0xd2, 0x0c, 0xe6, 0xd4, 0xea,
-  0x50, 0x02, 0x0b, 0xe6, 0x2a, 0xbc, 0x16, 0xdf, 0x4a, 0xfb, 0xfe, 0xd6,
-  0xe2, 0x10, 0x4b, 0xdb, 0xf6, 0xd4, 0x0a, 0xea, 0xd7, 0x46, 0xef, 0xce,
-  0xf0, 0xda, 0x02, 0x04, 0xeb, 0x15, 0xef, 0xfd, 0xf8, 0x01, 0xd1, 0xd4,
-  0xfb, 0x36, 0x24, 0x0e, 0xf9, 0x03, 0x28, 0x0a, 0x02, 0xee, 0x08, 0x4e,
-  0x07, 0x1f, 0xc9, 0xe1, 0x42, 0xd9, 0xd8, 0x4c, 0x94, 0x03, 0xe8, 0xdd,
-  0x21, 0xf4, 0x08, 0x26, 0xf1, 0x20, 0x24, 0xca, 0x2c, 0xde, 0x0b, 0x08,
-  0x0b, 0xc3, 0x4a, 0x1c, 0x27, 0xeb, 0x0f, 0x48, 0x18, 0xee, 0x38, 0xbd,
-  0xcf, 0x10, 0x2d, 0x05, 0x26, 0xf2, 0xc7, 0xfd, 0x00, 0xf6, 0xc7, 0xd3,
-  0x0a, 0x05, 0xe7, 0x32, 0x0b, 0xf5, 0xb3, 0xec, 0x1c, 0x20, 0xea, 0x36,
-  0xd8, 0x39, 0x66, 0xf6, 0x1d, 0x1c, 0x1c, 0xfd, 0x2b, 0xf4, 0x0c, 0x13,
-  0xc3, 0xd1, 0x02, 0xb5, 0x15, 0x3c, 0xab, 0x27, 0xfa, 0x59, 0x13, 0xbe,
-  0xf0, 0xe4, 0x23, 0x2a, 0xf7, 0xdb, 0x34, 0xf8, 0x30, 0xec, 0x07, 0x0d,
-  0xf6, 0x8b, 0xe9, 0x04, 0xc7, 0xc3, 0xcc, 0xd3, 0x2c, 0xf6, 0xf8, 0xd8,
-  0x9a, 0xe0, 0xc1, 0xe2, 0xe9, 0x08, 0x11, 0x37, 0x48, 0x03, 0xdd, 0x24,
-  0xdf, 0x42, 0xfa, 0x62, 0x0f, 0x1e, 0x1a, 0x4a, 0x15, 0x01, 0x30, 0xe5,
-  0x30, 0xb1, 0xc7, 0x03, 0xa0, 0xdb, 0x0c, 0x15, 0xfe, 0xcf, 0xed, 0x0d,
-  0xf7, 0x55, 0x0b, 0xd9, 0xed, 0xe4, 0x24, 0x31, 0xfe, 0x17, 0x19, 0x0f,
-  0xf2, 0x1b, 0x1f, 0xda, 0x05, 0xc4, 0xf9, 0xc4, 0xe2, 0x14, 0xee, 0xe4,
-  0x11, 0xd3, 0x00, 0x07, 0xcc, 0xf1, 0xce, 0xcb, 0x20, 0x23, 0xd9, 0xef,
-  0xf0, 0xff, 0xe8, 0xec, 0xfc, 0x3d, 0xf0, 0x3f, 0x06, 0x4b, 0x18, 0x41,
-  0x50, 0xc5, 0x12, 0xe6, 0xe3, 0x39, 0x22, 0x01, 0xe7, 0x00, 0x11, 0xfa,
-  0x1e, 0xff, 0x1c, 0x14, 0x0e, 0xd5, 0xe4, 0xef, 0xe5, 0x55, 0xd9, 0x10,
-  0xf9, 0xf9, 0xfa, 0x16, 0xb0, 0x1d, 0x08, 0x00, 0x1f, 0x1b, 0xe9, 0xe9,
-  0x05, 0x19, 0x00, 0x28, 0x35, 0xbe, 0xf4, 0xed, 0x19, 0x07, 0x11, 0xf0,
-  0xe0, 0xed, 0x00, 0x13, 0x08, 0xf5, 0x46, 0xf7, 0x0d, 0x02, 0x0a, 0xf3,
-  0xdc, 0xf7, 0x07, 0xf6, 0x51, 0xd5, 0xee, 0x04, 0x16, 0xe8, 0x1e, 0x0c,
-  0xfd, 0x03, 0x35, 0xd2, 0x18, 0xfa, 0x00, 0x18, 0x34, 0xd5, 0x3a, 0xeb,
-  0x1e, 0x33, 0x12, 0xe8, 0x23, 0x2e, 0x10, 0x09, 0xd9, 0x4e, 0xbe, 0x19,
-  0x00, 0xd2, 0x2a, 0xf9, 0xc7, 0xff, 0x30, 0x0c, 0x0e, 0xc9, 0xe8, 0x00,
-  0x27, 0x17, 0x21, 0x34, 0x1a, 0x37, 0xf2, 0xde, 0x03, 0xf4, 0x2c, 0xec,
-  0xfd, 0x8d, 0xbf, 0x0c, 0xe5, 0xea, 0xef, 0x1b, 0x18, 0xf2, 0xf0, 0xc4,
-  0x16, 0xfd, 0x0d, 0xfd, 0xb7, 0xd9, 0xcf, 0xe4, 0x08, 0xf2, 0x04, 0xbb,
-  0x0c, 0xf7, 0xe4, 0xd0, 0x0c, 0x5d, 0xda, 0x27, 0xc8, 0xfa, 0x19, 0x43,
-  0xd8, 0x1b, 0xec, 0x07, 0xfa, 0xc1, 0x14, 0x11, 0xf9, 0xe3, 0xdb, 0x9c,
-  0x46, 0xe5, 0xe5, 0x17, 0x25, 0xe8, 0x0d, 0x3e, 0xf5, 0x1a, 0x25, 0x22,
-  0x0a, 0xda, 0x1b, 0x2e, 0xf0, 0xd3, 0x36, 0xe1, 0xed, 0xfe, 0x19, 0xec,
-  0xf4, 0xe5, 0xe2, 0xd9, 0x9b, 0xc4, 0xef, 0x0d, 0x1d, 0xf1, 0x18, 0x04,
-  0x02, 0xe8, 0xeb, 0xbb, 0xee, 0xfa, 0x10, 0x0f, 0x1c, 0x07, 0xfa, 0xf3,
-  0xf0, 0xe1, 0xc0, 0x04, 0xd2, 0xbd, 0x13, 0x23, 0xfc, 0x0a, 0xf2, 0xf8,
-  0x3e, 0x28, 0x15, 0xd7, 0xd4, 0x16, 0xf8, 0x38, 0xfe, 0xc6, 0xf0, 0xfd,
-  0x07, 0xd7, 0xdd, 0x3b, 0x40, 0x51, 0x1e, 0xdf, 0x42, 0xf0, 0xf9, 0xf6,
-  0xfc, 0x0a, 0x25, 0x09, 0xf0, 0xe7, 0x03, 0xd9, 0xfe, 0xd1, 0x24, 0x02,
-  0x22, 0xc9, 0x39, 0x28, 0xec, 0xe9, 0xd3, 0x08, 0xea, 0xed, 0x12, 0xfa,
-  0x10, 0x46, 0x19, 0x0a, 0xf0, 0x0c, 0x1f, 0x27, 0xe6, 0x03, 0x18, 0xcc,
-  0xcf, 0xa3, 0x54, 0xf3, 0xff, 0x08, 0x18, 0x1f, 0x85, 0x10, 0xe3, 0x0a,
-  0x1c, 0xec, 0xfd, 0x27, 0x03, 0x0f, 0x1a, 0xfd, 0x2a, 0x2f, 0xe0, 0xb5,
-  0x1b, 0x0e, 0xd6, 0x2d, 0x01, 0xdf, 0xeb, 0xf9, 0x13, 0xee, 0x01, 0xc6,
-  0xf5, 0x2b, 0xe7, 0x38, 0x19, 0xed, 0xde, 0xbe, 0x18, 0xff, 0xec, 0xd5,
-  0xff, 0x21, 0xf1, 0xe4, 0x15, 0xdb, 0xf3, 0x04, 0x22, 0x1e, 0xf7, 0x0c,
-  0xe8, 0xef, 0x32, 0xbc, 0xf1, 0xcb, 0x3b, 0x17, 0x24, 0x04, 0x06, 0xec,
-  0xf4, 0x15, 0xc8, 0x13, 0xf0, 0xf6, 0xf0, 0x22, 0xf3, 0xf3, 0x26, 0x53,
-  0x1b, 0x27, 0x16, 0x06, 0x17, 0x54, 0xf1, 0x15, 0xd9, 0x1d, 0x06, 0xf7,
-  0x26, 0xdb, 0xd5, 0xf2, 0xd9, 0xdd, 0xa9, 0xe9, 0xf0, 0xdd, 0x29, 0x15,
-  0xd3, 0xe2, 0xc0, 0xd0, 0xf3, 0xf6, 0x41, 0x32, 0xfb, 0xf4, 0x11, 0xf5,
-  0xfb, 0x19, 0x38, 0x00, 0xfb, 0xc2, 0xe0, 0x1b, 0xed, 0x28, 0x05, 0x11,
-  0x25, 0x22, 0x0e, 0x08, 0xd7, 0xed, 0xe6, 0xeb, 0xeb, 0xe6, 0xf5, 0x0c,
-  0xaa, 0x10, 0xe2, 0xf8, 0x1c, 0x30, 0xa8, 0xf0, 0x29, 0x1b, 0x11, 0x21,
-  0xe8, 0xfd, 0x2e, 0xfb, 0xbc, 0xdf, 0x01, 0xfb, 0xfe, 0x2b, 0xec, 0x06,
-  0xff, 0x0c, 0x18, 0x1f, 0xce, 0xaf, 0xce, 0xf3, 0x23, 0xf8, 0x0a, 0x1f,
-  0xeb, 0xf3, 0x06, 0x02, 0xcf, 0x0d, 0x7f, 0x2c, 0x38, 0xdb, 0x12, 0xc4,
-  0xf4, 0x1a, 0x0e, 0xc1, 0x43, 0x11, 0xe6, 0x45, 0xd2, 0xdd, 0xf2, 0xef,
-  0x09, 0xf1, 0x0c, 0x1f, 0xac, 0xf9, 0x03, 0x09, 0x16, 0x06, 0xa7, 0xd3,
-  0xfe, 0x2f, 0x01, 0x4c, 0xf0, 0x02, 0x0b, 0xfd, 0xc0, 0xe9, 0xf4, 0xff,
-  0xe8, 0x25, 0xc0, 0x32, 0x47, 0xf9, 0x27, 0xdd, 0xdf, 0xc4, 0xc6, 0xfa,
-  0xf4, 0x2a, 0xf0, 0xd8, 0xe6, 0xf2, 0x1d, 0xca, 0x12, 0x16, 0x0a, 0xdb,
-  0x0b, 0xd6, 0x10, 0xb4, 0x17, 0xff, 0x26, 0xf6, 0xfa, 0x04, 0x00, 0x44,
-  0xf0, 0xe0, 0xf6, 0xf2, 0xc8, 0xfd, 0x06, 0xfa, 0xeb, 0xdd, 0x12, 0x17,
-  0x15, 0x12, 0xe8, 0x04, 0x0c, 0x64, 0x12, 0x06, 0xb2, 0x29, 0x18, 0x11,
-  0xcb, 0x42, 0xd4, 0x4d, 0xd0, 0xfa, 0xd6, 0xe7, 0xee, 0xe6, 0xef, 0xee,
-  0x0a, 0x31, 0xf4, 0xdc, 0x2d, 0x1a, 0xbd, 0xfc, 0xf0, 0xe0, 0x03, 0xff,
-  0x24, 0xf2, 0xcc, 0x0a, 0xfe, 0xe4, 0x36, 0x2c, 0xdd, 0x13, 0x11, 0xe9,
-  0x20, 0xe7, 0x01, 0xd6, 0xb8, 0xdc, 0x10, 0xf5, 0x17, 0xea, 0x33, 0x17,
-  0x05, 0x24, 0x06, 0x09, 0xe9, 0x32, 0x19, 0xfd, 0xce, 0x03, 0x03, 0xdb,
-  0xfa, 0x28, 0xc7, 0x02, 0xef, 0x16, 0xe1, 0xf2, 0xf6, 0xe1, 0xfc, 0xea,
-  0xe4, 0x16, 0xf3, 0xe8, 0xc5, 0x0b, 0xc0, 0xe4, 0xf2, 0xe8, 0x0e, 0xf5,
-  0xce, 0x0c, 0xf7, 0x01, 0x04, 0xed, 0x0d, 0x20, 0x1b, 0x22, 0x2c, 0x0e,
-  0xe6, 0x55, 0xe5, 0x1b, 0xe6, 0xb8, 0x00, 0x22, 0x99, 0x16, 0x29, 0xb1,
-  0xf2, 0x04, 0x1d, 0x34, 0xf4, 0x40, 0xfe, 0x17, 0x2c, 0x2d, 0xcc, 0x02,
-  0x39, 0x15, 0x41, 0xff, 0x3d, 0xf9, 0x51, 0xea, 0x1c, 0xf1, 0xf6, 0xfe,
-  0x17, 0xfa, 0xfe, 0xe7, 0xd1, 0x3f, 0x1c, 0x2f, 0x1c, 0xe1, 0xca, 0x2e,
-  0x02, 0xe5, 0xf3, 0xfa, 0xcb, 0x12, 0xed, 0xe8, 0xe6, 0xda, 0xfe, 0xc8,
-  0xf4, 0x67, 0xff, 0xfc, 0xf1, 0xf4, 0x09, 0x0c, 0x23, 0x02, 0xfc, 0xfa,
-  0xce, 0xea, 0xd6, 0xbc, 0xf5, 0x16, 0x13, 0x1d, 0xf1, 0xc9, 0xfd, 0xff,
-  0x36, 0x28, 0xe7, 0x0b, 0xfe, 0xf7, 0xfc, 0xb3, 0x15, 0x06, 0x19, 0xfe,
-  0xcf, 0xef, 0x17, 0x24, 0x0f, 0xf8, 0xd1, 0xf2, 0xfc, 0xff, 0x1a, 0x20,
-  0x2f, 0xc5, 0xb4, 0x10, 0x09, 0xf2, 0xf8, 0x2b, 0x30, 0xeb, 0xfa, 0x15,
-  0x17, 0xe0, 0xf4, 0xea, 0x06, 0xde, 0xee, 0x0d, 0xd4, 0x0e, 0x30, 0x18,
-  0xf0, 0x01, 0x00, 0xf2, 0xf6, 0x01, 0x00, 0xe8, 0x06, 0xe0, 0x2a, 0x31,
-  0xfe, 0x0d, 0x64, 0x1d, 0xd2, 0xef, 0x23, 0x05, 0xfa, 0xf1, 0xdd, 0xfa,
-  0xe7, 0x22, 0xf4, 0xf3, 0x05, 0xc7, 0xfb, 0xeb, 0xfe, 0x16, 0xba, 0xcc,
-  0x34, 0x0f, 0x25, 0x2b, 0xdf, 0xff, 0xcb, 0xf9, 0x20, 0x0e, 0x02, 0x26,
-  0x4b, 0x05, 0x29, 0x2a, 0xf8, 0xff, 0x3b, 0x26, 0x03, 0xc3, 0xe8, 0xe3,
-  0xff, 0x22, 0x0a, 0x2e, 0xdc, 0xde, 0x09, 0xfe, 0x08, 0x23, 0x17, 0xd1,
-  0xd7, 0x07, 0x47, 0x0c, 0xda, 0x36, 0x43, 0xf8, 0x16, 0xc6, 0xa5, 0x11,
-  0x0a, 0xfc, 0xbd, 0x29, 0xeb, 0x17, 0x5e, 0x11, 0xe1, 0x01, 0x0e, 0x0f,
-  0xe0, 0x05, 0xbb, 0x0e, 0x0d, 0x19, 0xf4, 0x0d, 0x48, 0xe9, 0xb2, 0xf1,
-  0x0c, 0x12, 0x1a, 0x17, 0x10, 0xe8, 0x08, 0xe8, 0x01, 0xfe, 0x2b, 0xf9,
-  0x03, 0xd1, 0xd8, 0xe9, 0xde, 0x1e, 0xf4, 0x21, 0xee, 0x0b, 0x17, 0xfd,
-  0xcc, 0xfb, 0xcd, 0xf1, 0xe8, 0xe8, 0xf5, 0xff, 0x13, 0xf6, 0x39, 0x17,
-  0x0f, 0xe1, 0xfa, 0xf7, 0x1c, 0x07, 0xce, 0xce, 0x13, 0x0e, 0x1c, 0x03,
-  0xf2, 0xf5, 0xd6, 0x52, 0x27, 0xf7, 0x04, 0x23, 0x40, 0xd7, 0x0a, 0xec,
-  0x1e, 0xbd, 0xe6, 0x24, 0x00, 0xfc, 0x31, 0x44, 0xf7, 0x06, 0xd0, 0xfc,
-  0xed, 0x07, 0xe6, 0xef, 0xf5, 0x09, 0xd9, 0xe2, 0xca, 0xdf, 0x70, 0xf9,
-  0xdc, 0x59, 0xc4, 0x1c, 0xf8, 0xf1, 0xe7, 0x0d, 0xbc, 0xdb, 0x2d, 0xcb,
-  0xf8, 0xe1, 0x53, 0x2e, 0xd3, 0xd2, 0x29, 0xfb, 0x15, 0xf4, 0x05, 0x14,
-  0x0a, 0xca, 0xe4, 0xcd, 0xff, 0xa7, 0x07, 0x0d, 0x3f, 0x3b, 0x0e, 0x02,
-  0x60, 0xbb, 0x1f, 0x39, 0xaa, 0xba, 0xfb, 0xe8, 0x11, 0x3b, 0x3f, 0x11,
-  0x04, 0x13, 0xf1, 0xd0, 0xd6, 0x19, 0xe6, 0xec, 0x11, 0xc7, 0x16, 0x01,
-  0x1b, 0xf4, 0x7f, 0xd0, 0xdb, 0x45, 0xfd, 0xeb, 0x08, 0xe4, 0x05, 0x38,
-  0xe5, 0xfe, 0xfa, 0xac, 0xf4, 0xe4, 0x2c, 0xe9, 0xfa, 0xde, 0x14, 0xe5,
-  0xd8, 0xe2, 0xd5, 0x15, 0xe8, 0xca, 0xcd, 0x36, 0x17, 0x02, 0x01, 0xe6,
-  0x02, 0xfb, 0x00, 0x17, 0x10, 0xf5, 0x0f, 0xe8, 0xd0, 0xeb, 0xeb, 0xd5,
-  0xee, 0x14, 0xf8, 0x30, 0x0a, 0x0d, 0x25, 0xf8, 0xeb, 0xe9, 0xd9, 0x00,
-  0xf7, 0xc3, 0x0f, 0x15, 0xe2, 0xe2, 0x09, 0x28, 0xfd, 0x03, 0x1e, 0xdf,
-  0xff, 0xe4, 0x0e, 0xf6, 0xb9, 0xf6, 0x0a, 0xd7, 0x03, 0x0f, 0x2e, 0xd3,
-  0xde, 0xda, 0x54, 0xe5, 0x27, 0x2e, 0xfd, 0x2f, 0xd2, 0xeb, 0xea, 0xf8,
-  0x09, 0xf4, 0x3f, 0x13, 0xc4, 0xe0, 0x23, 0xe8, 0x32, 0xf1, 0x01, 0x01,
-  0xf8, 0x23, 0xd9, 0xc9, 0x0f, 0xb0, 0x35, 0xe5, 0xef, 0x63, 0x12, 0xeb,
-  0xb6, 0xd4, 0xfb, 0xd3, 0xe5, 0x05, 0xff, 0x5e, 0x56, 0xde, 0x36, 0xb7,
-  0x3a, 0xe9, 0x61, 0xca, 0xd0, 0xe4, 0xc6, 0xeb, 0x2b, 0x15, 0xe9, 0x04,
-  0xa7, 0x3e, 0x23, 0x32, 0x3d, 0xf9, 0x09, 0x3d, 0xe9, 0xf9, 0x10, 0x74,
-  0xd2, 0xec, 0x20, 0xb8, 0x0f, 0x08, 0xb0, 0x19, 0xa1, 0xde, 0x52, 0x04,
-  0x40, 0xe0, 0xfd, 0xd2, 0xe0, 0x27, 0x9a, 0xf2, 0x1c, 0xc6, 0xf8, 0xf8,
-  0x39, 0x0e, 0x53, 0xd4, 0x87, 0x19, 0xf7, 0x2e, 0xe8, 0xf8, 0xfe, 0x16,
-  0xd6, 0x2c, 0x0a, 0xd4, 0x2f, 0xcb, 0xce, 0xb8, 0xa6, 0xf8, 0xd7, 0x08,
-  0x02, 0x1c, 0xcc, 0xf5, 0xa0, 0x2b, 0xfe, 0x24, 0x29, 0xfe, 0x67, 0xe8,
-  0xc8, 0x10, 0x08, 0xbf, 0xda, 0xc2, 0xf6, 0xf4, 0x16, 0x59, 0xfc, 0xfe,
-  0x90, 0x32, 0x51, 0xec, 0x1d, 0xe0, 0xfe, 0x00, 0xd9, 0xd8, 0xdf, 0x2a,
-  0x2b, 0xf7, 0x03, 0xde, 0xeb, 0x5a, 0x45, 0x08, 0x53, 0xe9, 0x40, 0x25,
-  0xd6, 0x3a, 0xe1, 0xd5, 0xd9, 0x5d, 0xef, 0xbf, 0x1c, 0xe2, 0xe3, 0xbb,
-  0xdb, 0x02, 0xdf, 0xb6, 0x17, 0x06, 0x14, 0x2e, 0xb8, 0xff, 0x57, 0xf8,
-  0x18, 0x4a, 0xf8, 0xf6, 0xf3, 0x58, 0x0a, 0x9a, 0xf1, 0xeb, 0xb9, 0xce,
-  0xe9, 0x02, 0x73, 0x4f, 0xee, 0xda, 0xcb, 0x37, 0x0f, 0x02, 0xc3, 0x33,
-  0xe5, 0x15, 0xd6, 0xdd, 0x14, 0x9a, 0x1d, 0xf8, 0xe7, 0x14, 0xbf, 0xf6,
-  0x1a, 0xc4, 0xf4, 0x23, 0xdd, 0xd5, 0xe1, 0x01, 0x6f, 0xa4, 0x27, 0x02,
-  0x02, 0xf3, 0x46, 0x13, 0x13, 0xed, 0xe6, 0x0b, 0xf4, 0x1f, 0xd1, 0xe4,
-  0xe7, 0x72, 0xe5, 0xea, 0xf3, 0xd7, 0xaa, 0x4c, 0x39, 0xf0, 0xff, 0x21,
-  0xe4, 0x1f, 0x15, 0xd1, 0xf2, 0xca, 0xd2, 0x21, 0xe1, 0xac, 0x11, 0x1d,
-  0x17, 0x18, 0xdb, 0xc4, 0xa5, 0x05, 0xe4, 0xf9, 0xc2, 0x0c, 0x1c, 0xf7,
-  0xfa, 0x5d, 0xf4, 0xb5, 0x4d, 0x08, 0x09, 0x5a, 0x02, 0x1d, 0x0b, 0xf7,
-  0x40, 0xf6, 0x0d, 0xa0, 0xea, 0xf6, 0xe8, 0x04, 0xed, 0xdb, 0x20, 0x40,
-  0xee, 0x2e, 0xb9, 0xf0, 0xb5, 0x0e, 0x02, 0xf3, 0x0b, 0xef, 0xf3, 0x0e,
-  0xe4, 0xda, 0xf4, 0xf0, 0xef, 0x1a, 0x02, 0xb9, 0xf5, 0xdf, 0xdd, 0x28,
-  0x0e, 0xff, 0x08, 0xdc, 0x27, 0x17, 0xf4, 0x10, 0xb3, 0xd6, 0xee, 0x14,
-  0xd2, 0xfd, 0x4a, 0x05, 0xd7, 0x1b, 0x18, 0xb6, 0x39, 0xfb, 0x33, 0x00,
-  0x15, 0x0f, 0x0c, 0xe4, 0x4e, 0x0f, 0x10, 0xdc, 0x34, 0xcb, 0xe6, 0xfd,
-  0x15, 0xeb, 0xb6, 0x9b, 0xef, 0x1b, 0xa5, 0xe9, 0xe2, 0xe3, 0x38, 0x13,
-  0xff, 0xf5, 0xfc, 0x24, 0xeb, 0xfa, 0xcc, 0xcc, 0xcc, 0x13, 0x2e, 0xe0,
-  0xec, 0xbe, 0x1f, 0x32, 0x25, 0x9f, 0x19, 0x2b, 0x01, 0xe7, 0x27, 0xdc,
-  0xf3, 0xe1, 0x31, 0xce, 0x4f, 0xfc, 0xd8, 0x1c, 0x00, 0xfd, 0xa9, 0xca,
-  0xe3, 0xff, 0x0c, 0x1d, 0xd8, 0x11, 0xfc, 0xca, 0x3b, 0xde, 0xfc, 0x53,
-  0xe4, 0x0d, 0xc8, 0xfc, 0x44, 0xca, 0x9b, 0x00, 0x3a, 0xf2, 0xfd, 0x0f,
-  0xe9, 0xeb, 0x04, 0xce, 0x1d, 0x01, 0xee, 0x19, 0xf6, 0xb8, 0x0b, 0xcc,
-  0xec, 0xf8, 0xa1, 0x16, 0x2f, 0xf9, 0x13, 0x21, 0x1c, 0xe2, 0x21, 0xfe,
-  0x2c, 0xfe, 0x22, 0xc6, 0x0b, 0xf8, 0xe7, 0xae, 0x22, 0x56, 0xd4, 0x3b,
-  0x37, 0x29, 0xd1, 0xdc, 0xfe, 0x11, 0x25, 0x31, 0xf7, 0x22, 0x06, 0xf2,
-  0x0d, 0xd0, 0xb4, 0xe0, 0x81, 0x08, 0xe8, 0x06, 0x44, 0xec, 0xd8, 0xf0,
-  0xe4, 0x4b, 0x27, 0x15, 0xde, 0xa2, 0xf6, 0xf3, 0x0e, 0x18, 0x4a, 0xde,
-  0x1a, 0xb8, 0xec, 0xb8, 0xf4, 0x5a, 0xcd, 0x1a, 0x1f, 0x2f, 0xe8, 0x46,
-  0x3c, 0xfc, 0x1f, 0xfb, 0x14, 0x25, 0x12, 0xea, 0x19, 0xeb, 0xef, 0xd6,
-  0xed, 0x02, 0x44, 0x4a, 0x15, 0xe6, 0xdb, 0xb5, 0xd0, 0xe5, 0xf9, 0x2f,
-  0x27, 0xf0, 0x29, 0xc8, 0xec, 0x13, 0xe8, 0xdf, 0xb6, 0x04, 0xef, 0x03,
-  0xfa, 0xbd, 0xd5, 0xc6, 0x1b, 0x2b, 0x04, 0x9d, 0xd7, 0xa3, 0xf9, 0x2b,
-  0x03, 0xf0, 0xed, 0xf7, 0x08, 0x0d, 0xec, 0xbf, 0x04, 0x36, 0xc5, 0x66,
-  0x38, 0x13, 0xe4, 0x4e, 0x18, 0x9d, 0x00, 0x04, 0xf0, 0xfe, 0x27, 0x0a,
-  0xd9, 0xee, 0x09, 0xee, 0xf9, 0x23, 0xe2, 0x32, 0x0b, 0xff, 0xd3, 0x34,
-  0x01, 0xb6, 0xd4, 0x3e, 0xf3, 0x0f, 0x34, 0xf6, 0x03, 0x1a, 0x08, 0xda,
-  0xfa, 0x03, 0xfa, 0xf2, 0xc9, 0x09, 0xf0, 0xd1, 0xe1, 0x2c, 0xf2, 0xc1,
-  0xf8, 0xcf, 0xea, 0xcb, 0x21, 0x4a, 0x21, 0xf1, 0xe9, 0xe7, 0xe4, 0xf8,
-  0xe1, 0xe6, 0xd2, 0x11, 0xee, 0x04, 0x63, 0xcf, 0xff, 0xb6, 0x1c, 0xd9,
-  0xce, 0xef, 0xff, 0xd8, 0xe9, 0x1a, 0xe3, 0xd4, 0xd9, 0x21, 0xcb, 0x5e,
-  0xf3, 0x0d, 0xef, 0xc7, 0xdc, 0xd1, 0xe6, 0x33, 0xe1, 0x35, 0x3d, 0x2e,
-  0x27, 0xd9, 0x01, 0xe8, 0xf2, 0xea, 0xfb, 0xb0, 0xfa, 0x20, 0x06, 0xe0,
-  0xea, 0xd8, 0x06, 0x12, 0x10, 0xde, 0xae, 0xd2, 0x5b, 0x6d, 0xe2, 0xfe,
-  0x33, 0xee, 0xd2, 0x0f, 0xee, 0xf7, 0xff, 0x26, 0x06, 0xfe, 0x24, 0xca,
-  0x0d, 0x81, 0xf7, 0xe3, 0x00, 0x33, 0x2c, 0x1d, 0x0d, 0x07, 0x21, 0xc7,
-  0xe1, 0x0c, 0x0c, 0x16, 0x01, 0x12, 0xd3, 0xa8, 0x20, 0xe3, 0xd6, 0x36,
-  0xe1, 0x08, 0x11, 0x05, 0xe0, 0xcb, 0x15, 0x12, 0x14, 0x0b, 0xec, 0xb3,
-  0xd8, 0xfe, 0x01, 0xce, 0xd5, 0xf7, 0xfc, 0x29, 0x0a, 0xdf, 0xe5, 0xd8,
-  0x07, 0x36, 0xfc, 0x02, 0x50, 0xfa, 0xc2, 0x0e, 0xeb, 0xf6, 0xcd, 0x05,
-  0xcc, 0xd8, 0x08, 0x1e, 0x30, 0xf3, 0x36, 0x37, 0xe6, 0xf5, 0x0a, 0xe1,
-  0x28, 0xef, 0xde, 0x23, 0xdd, 0xe2, 0xff, 0x1b, 0xf3, 0xfa, 0x0f, 0x1d,
-  0xf9, 0x29, 0xc2, 0x11, 0xcc, 0xf4, 0x27, 0xe6, 0x00, 0xf9, 0x1a, 0x27,
-  0xdd, 0xf4, 0x2a, 0xd3, 0x2a, 0x18, 0x06, 0xdb, 0xbf, 0x0a, 0x61, 0x16,
-  0x0c, 0xfb, 0x00, 0xd4, 0x57, 0xfa, 0x17, 0x51, 0x1c, 0x04, 0xf0, 0x0b,
-  0xf2, 0xc8, 0xc2, 0x0f, 0x0f, 0x08, 0x08, 0xfe, 0x17, 0xf2, 0x28, 0xfe,
-  0xfb, 0xd5, 0x0f, 0xae, 0x2d, 0xfd, 0xcd, 0x2d, 0xd5, 0x0b, 0xfa, 0x07,
-  0x3e, 0x35, 0xfa, 0xfc, 0xf0, 0x24, 0xf8, 0x06, 0xbb, 0xf2, 0x1f, 0xea,
-  0xfa, 0xd0, 0x21, 0x09, 0xdc, 0x0e, 0x15, 0xa9, 0x11, 0xf7, 0x13, 0xd7,
-  0xf8, 0xca, 0x36, 0x12, 0x17, 0x0e, 0xd0, 0xfa, 0x28, 0x28, 0xe8, 0x2a,
-  0x5b, 0xe8, 0xa3, 0x07, 0x25, 0x01, 0xde, 0x03, 0xfe, 0x19, 0x40, 0x04,
-  0x26, 0xf0, 0xef, 0x17, 0xf5, 0x06, 0xef, 0xfc, 0xfb, 0xe4, 0xd2, 0x01,
-  0xb3, 0xf5, 0x1b, 0x03, 0x01, 0x20, 0xff, 0xc9, 0xff, 0x4c, 0xdd, 0x19,
-  0xed, 0xf0, 0xe4, 0x13, 0xd5, 0xfd, 0xe1, 0x19, 0x01, 0x03, 0x1a, 0xd5,
-  0x03, 0x32, 0x0c, 0xba, 0xe8, 0xce, 0x3e, 0xef, 0x01, 0x25, 0x07, 0xf8,
-  0xfd, 0x0a, 0xbc, 0x11, 0x39, 0xe2, 0xfb, 0x0c, 0xfa, 0x0a, 0xbe, 0xfb,
-  0x20, 0x01, 0x4b, 0x0c, 0x2d, 0xf6, 0x40, 0x13, 0x3b, 0x16, 0x00, 0xf5,
-  0xfb, 0xe7, 0xeb, 0xed, 0x07, 0xca, 0x1e, 0x04, 0xef, 0xe1, 0xec, 0x03,
-  0xb4, 0x0f, 0xbd, 0xf1, 0x11, 0xe3, 0x37, 0x06, 0xfd, 0x1b, 0xeb, 0x19,
-  0x13, 0x24, 0x46, 0xf1, 0x0c, 0xfa, 0x1e, 0xf7, 0xcd, 0x1a, 0x0f, 0xc4,
-  0x1e, 0x01, 0x03, 0xf1, 0xf1, 0xde, 0xf3, 0xfa, 0x23, 0x06, 0x17, 0xfe,
-  0x02, 0xd6, 0x18, 0xe1, 0xf3, 0x08, 0xf5, 0xe3, 0x09, 0x36, 0x27, 0x2f,
-  0x3e, 0x0a, 0x0f, 0xf2, 0xd1, 0x0b, 0x09, 0xe8, 0x10, 0xef, 0x1e, 0xea,
-  0x06, 0x06, 0xf6, 0x0d, 0x04, 0x28, 0xf7, 0xd2, 0x31, 0xfa, 0x03, 0xfd,
-  0x07, 0xcf, 0xf3, 0xe1, 0xf0, 0x05, 0x1b, 0xe7, 0x48, 0xcd, 0x15, 0xdd,
-  0xf1, 0x1c, 0x04, 0xc6, 0x21, 0xc1, 0x23, 0x1f, 0x28, 0xc6, 0xa8, 0x2a,
-  0xe1, 0xe7, 0x14, 0x31, 0x25, 0xf0, 0x01, 0x01, 0x09, 0xdd, 0xe3, 0x08,
-  0x2e, 0x3a, 0xe0, 0x2f, 0x39, 0x1d, 0xf3, 0x12, 0xfe, 0xf3, 0xd0, 0xfa,
-  0xf1, 0xf5, 0x2c, 0xff, 0x23, 0x04, 0xfd, 0x2f, 0x19, 0x20, 0xd2, 0x1c,
-  0x21, 0x0e, 0xdc, 0xf4, 0xe3, 0x26, 0xf4, 0xfa, 0x13, 0x0c, 0x29, 0x20,
-  0x15, 0x15, 0xf6, 0xe1, 0xd3, 0x2f, 0xe3, 0x16, 0xe1, 0x1a, 0x19, 0x0c,
-  0xfd, 0x0e, 0xd5, 0x03, 0xa6, 0x27, 0xe6, 0x2f, 0xe4, 0x09, 0xef, 0xea,
-  0x1f, 0xf0, 0x2b, 0x02, 0xde, 0x0d, 0xb0, 0xe5, 0xd7, 0xc6, 0xff, 0x1f,
-  0x02, 0xc8, 0x9e, 0xc2, 0xbc, 0x08, 0xeb, 0x3a, 0xf6, 0xe0, 0x20, 0xfe,
-  0x0a, 0x1d, 0xe4, 0x17, 0x18, 0x0a, 0xea, 0x1f, 0xef, 0xd7, 0xe4, 0xdb,
-  0x02, 0x2d, 0xf8, 0xd0, 0x10, 0xd9, 0xf6, 0xd7, 0xf6, 0xfd, 0x52, 0xdd,
-  0x03, 0xeb, 0xd9, 0xd7, 0x45, 0x30, 0xfa, 0xf8, 0x59, 0x2c, 0xc5, 0xf9,
-  0xee, 0xf8, 0x0c, 0x06, 0xfb, 0xfa, 0x92, 0xde, 0xc3, 0x20, 0xd1, 0x06,
-  0xfa, 0xfb, 0x25, 0xe9, 0x19, 0xf0, 0xc2, 0xf1, 0x5e, 0x31, 0xef, 0x0f,
-  0x0b, 0x47, 0xd4, 0xd4, 0x26, 0xfd, 0xcb, 0xce, 0xd0, 0x2f, 0xd8, 0x0f,
-  0xfb, 0x92, 0x00, 0xbc, 0x0d, 0x03, 0x05, 0xf5, 0x33, 0xa2, 0x05, 0xa3,
-  0x2f, 0xf6, 0x6d, 0x01, 0x56, 0xe0, 0xcb, 0xcb, 0x28, 0x43, 0x0e, 0x40,
-  0x06, 0xe4, 0xdb, 0x29, 0xfb, 0xb8, 0xfc, 0x02, 0xf0, 0xe9, 0xba, 0xe7,
-  0xba, 0x00, 0x01, 0xe4, 0xe3, 0xe5, 0x0a, 0x12, 0xf0, 0xd7, 0xf2, 0x4a,
-  0xbc, 0xda, 0x0e, 0xef, 0x41, 0xf8, 0xbd, 0xcd, 0x15, 0x26, 0x07, 0xe9,
-  0x22, 0x31, 0xed, 0x1b, 0xda, 0x0f, 0xfd, 0xec, 0x06, 0xf7, 0x37, 0x1f,
-  0xf9, 0x24, 0x21, 0xed, 0x03, 0xfa, 0x0c, 0x16, 0x02, 0x3f, 0xf2, 0xf8,
-  0xfd, 0xf7, 0xeb, 0xeb, 0x1f, 0xe2, 0xd4, 0x1a, 0xdf, 0x1a, 0xc5, 0x09,
-  0xf4, 0xe7, 0xce, 0x3f, 0x1d, 0xd4, 0xfa, 0x1f, 0x05, 0xe9, 0x36, 0x1c,
-  0xf2, 0x17, 0xde, 0xc2, 0xdc, 0xf7, 0x17, 0x30, 0xd8, 0x12, 0x23, 0xd5,
-  0x0f, 0xd0, 0xe5, 0x0a, 0x3b, 0xf9, 0xed, 0x0e, 0xf1, 0x1c, 0x10, 0x3f,
-  0x5d, 0xc1, 0x1a, 0xeb, 0x08, 0xdf, 0x0a, 0x9e, 0xf9, 0x0f, 0x01, 0x2b,
-  0x02, 0xe9, 0xba, 0xe4, 0xf7, 0xfa, 0xf9, 0x3b, 0xfa, 0xcf, 0xe4, 0xbd,
-  0x15, 0x1b, 0xf5, 0xdf, 0x06, 0xf8, 0x00, 0xd2, 0x08, 0x34, 0xe6, 0x26,
-  0x20, 0xf2, 0x36, 0xfd, 0x16, 0xd2, 0xf1, 0xf9, 0x1f, 0x13, 0x07, 0xf3,
-  0x18, 0x3d, 0xbb, 0x03, 0x4d, 0xd8, 0xc7, 0x08, 0xfa, 0x04, 0xec, 0x1d,
-  0xfb, 0xc5, 0xfb, 0xe3, 0x27, 0xa3, 0xeb, 0x11, 0xeb, 0xd0, 0x00, 0x81,
-  0xf6, 0x0b, 0x2e, 0x0f, 0x25, 0x03, 0xda, 0xee, 0xbf, 0xee, 0x2a, 0x23,
-  0xda, 0xf7, 0x08, 0xee, 0x35, 0xc3, 0x26, 0xe7, 0xaf, 0x17, 0xfb, 0xae,
-  0x06, 0x31, 0xe9, 0xef, 0xbd, 0xfd, 0x26, 0x1c, 0xd7, 0x02, 0xbc, 0x01,
-  0xb9, 0x0c, 0x00, 0x03, 0x10, 0x00, 0xcb, 0x0b, 0x2e, 0x1a, 0xf3, 0xf5,
-  0x1c, 0x20, 0x08, 0xfd, 0x05, 0x17, 0x17, 0x03, 0x3e, 0xd4, 0xa8, 0x0c,
-  0xe7, 0xf0, 0x1d, 0xfb, 0xba, 0xe6, 0xe3, 0xc6, 0xe1, 0x16, 0x09, 0x46,
-  0xf5, 0xf1, 0xd5, 0x0e, 0xd6, 0x12, 0xd4, 0x1f, 0xe1, 0x38, 0xd2, 0x16,
-  0x73, 0x04, 0xee, 0x00, 0x41, 0x38, 0xf0, 0xf1, 0xf8, 0xed, 0x2a, 0x30,
-  0xdc, 0xd8, 0xe2, 0x09, 0xed, 0xdd, 0x01, 0xcd, 0xc2, 0x3a, 0x06, 0xdb,
-  0xc9, 0xea, 0x05, 0x07, 0x1b, 0xe0, 0xe1, 0x6f, 0x16, 0x19, 0xae, 0x04,
-  0x0e, 0x20, 0x30, 0xf7, 0xfa, 0xda, 0xd1, 0xc7, 0xfe, 0x14, 0xd4, 0x1b,
-  0x3d, 0xd3, 0xd1, 0xea, 0xe9, 0xef, 0x05, 0x1b, 0x14, 0xe9, 0xe5, 0xf0,
-  0x30, 0x2e, 0x4e, 0xfb, 0x11, 0xf6, 0xf4, 0xdb, 0x0e, 0x51, 0xfc, 0x12,
-  0xf3, 0x30, 0xf8, 0x28, 0x26, 0xbf, 0xdb, 0x19, 0xf5, 0x1b, 0x08, 0x16,
-  0xe1, 0x4f, 0xbf, 0xef, 0x21, 0x03, 0xd2, 0xf3, 0xe7, 0x10, 0xcb, 0x2a,
-  0xff, 0xd3, 0x87, 0x2a, 0xcf, 0x12, 0x12, 0xf6, 0xe7, 0xf6, 0xe1, 0xb8,
-  0xf3, 0xea, 0xeb, 0xfb, 0x25, 0xd8, 0xde, 0x0e, 0x10, 0xd6, 0x13, 0xd1,
-  0xd0, 0xed, 0x19, 0x05, 0x06, 0x17, 0x4d, 0xfe, 0xbc, 0xff, 0xe3, 0xa5,
-  0xfe, 0x39, 0xd3, 0xf9, 0xd6, 0xe0, 0x2c, 0x7b, 0xfd, 0xd4, 0x09, 0x0c,
-  0xf8, 0x11, 0x11, 0xf6, 0xfa, 0xfb, 0x09, 0x13, 0xe4, 0x17, 0xf5, 0xc0,
-  0x0a, 0x1f, 0xd8, 0xeb, 0xf8, 0x07, 0xf0, 0x0e, 0xfa, 0x04, 0xa2, 0xe0,
-  0xd4, 0xde, 0x12, 0xe4, 0xf4, 0xca, 0xdb, 0xed, 0x08, 0x05, 0x19, 0x2a,
-  0x5b, 0xe7, 0x1c, 0xed, 0xea, 0xf7, 0x29, 0x02, 0x32, 0x35, 0x08, 0x07,
-  0x2c, 0xc1, 0xff, 0x04, 0xf5, 0xfe, 0x14, 0x7f, 0xe5, 0x25, 0xeb, 0xf9,
-  0x08, 0x06, 0xd4, 0x07, 0xc1, 0x11, 0xda, 0xbe, 0x24, 0xe9, 0xea, 0x1e,
-  0x0a, 0x3a, 0x10, 0xa9, 0xdf, 0xce, 0xf7, 0xc6, 0x02, 0x07, 0xe3, 0xb6,
-  0x0b, 0x0c, 0xd5, 0xb0, 0x0a, 0xd2, 0xec, 0xdb, 0x10, 0xfd, 0x03, 0x26,
-  0x03, 0x13, 0xf2, 0x02, 0xe3, 0x1c, 0xcb, 0x1c, 0xc3, 0x3e, 0xe2, 0xe7,
-  0x06, 0x57, 0x03, 0xef, 0xb0, 0xe4, 0x37, 0xd2, 0x10, 0xa1, 0x19, 0x35,
-  0xf2, 0xe0, 0x3b, 0x17, 0x15, 0xf8, 0xcc, 0xc5, 0xad, 0xd8, 0xf0, 0xc2,
-  0xfd, 0x0d, 0x22, 0xfe, 0xb3, 0xd9, 0xf1, 0x26, 0x02, 0x18, 0x56, 0xfb,
-  0xdb, 0xf5, 0xee, 0xdf, 0x16, 0x12, 0x07, 0xc7, 0x06, 0xee, 0x13, 0xc9,
-  0x28, 0x25, 0x55, 0xfa, 0xe6, 0x0c, 0xdb, 0xd7, 0xb7, 0x1c, 0xd3, 0xd7,
-  0xe0, 0x16, 0xe4, 0xe9, 0x05, 0x63, 0xe1, 0x1c, 0xda, 0x19, 0xdc, 0xc1,
-  0xdd, 0x8d, 0x2c, 0x30, 0xf7, 0x30, 0x0c, 0x01, 0xff, 0xf9, 0xb3, 0xf3,
-  0x85, 0x19, 0x05, 0xda, 0x4e, 0xee, 0xfe, 0x09, 0xc8, 0x01, 0x15, 0x46,
-  0x04, 0x17, 0xf6, 0x14, 0x02, 0x3c, 0x27, 0x0f, 0x4b, 0x2b, 0xeb, 0xc8,
-  0xb8, 0xf2, 0x27, 0xf5, 0xe9, 0x01, 0xee, 0x09, 0xfc, 0xe5, 0xe9, 0x0c,
-  0x05, 0x17, 0x21, 0x00, 0xe7, 0x0d, 0xfa, 0x16, 0xf0, 0x51, 0x20, 0xec,
-  0xbd, 0xeb, 0xc8, 0x26, 0x38, 0x16, 0x0a, 0x01, 0xe1, 0x19, 0xd3, 0x23,
-  0xe5, 0xef, 0xb9, 0x08, 0xfd, 0x20, 0xc7, 0xd0, 0xfb, 0xde, 0xc7, 0x2b,
-  0x03, 0x23, 0x2d, 0xf0, 0xe0, 0x1c, 0xd8, 0xf3, 0x05, 0xdd, 0xbd, 0xea,
-  0xf1, 0xee, 0xaa, 0xf6, 0xdf, 0x10, 0xe0, 0xd9, 0x09, 0x12, 0x4c, 0x03,
-  0x00, 0x1b, 0xdd, 0xed, 0x0d, 0x0d, 0x08, 0x12, 0x1b, 0x11, 0xdd, 0xad,
-  0x21, 0x1d, 0x1e, 0x10, 0x0a, 0xd8, 0x36, 0xcb, 0x3d, 0xfa, 0x27, 0xc0,
-  0xdd, 0x03, 0x1e, 0x28, 0xf1, 0x03, 0xcd, 0x04, 0x18, 0xf3, 0xd7, 0xe1,
-  0xf9, 0xa8, 0xca, 0x08, 0xe9, 0x24, 0x0a, 0xe4, 0xf3, 0x03, 0x18, 0x05,
-  0xd6, 0xc4, 0x09, 0x06, 0x22, 0xf2, 0x19, 0xd7, 0x1a, 0x30, 0x04, 0xa6,
-  0xf7, 0xf5, 0x18, 0xf5, 0xff, 0xff, 0xee, 0x4b, 0xb2, 0xf1, 0x0c, 0xe1,
-  0xd4, 0xeb, 0x21, 0x04, 0xf8, 0x4b, 0xf4, 0xf5, 0x0e, 0xef, 0xe6, 0xb0,
-  0x14, 0x14, 0x0c, 0xe0, 0x17, 0x13, 0xe5, 0x10, 0x0b, 0xd6, 0xca, 0xe5,
-  0x17, 0x30, 0xdf, 0x05, 0xf8, 0xc1, 0xdf, 0xc8, 0xfd, 0xfd, 0x02, 0x1d,
-  0xd4, 0xd1, 0xf3, 0x16, 0xfd, 0xfc, 0x0e, 0xd8, 0xdc, 0xf8, 0x33, 0xe5,
-  0xdd, 0x11, 0x3b, 0x1a, 0xef, 0xf7, 0x34, 0xdc, 0x28, 0xe2, 0x39, 0x45,
-  0xc1, 0x21, 0x24, 0x0c, 0xf3, 0x2f, 0x13, 0x54, 0xe3, 0x35, 0xe8, 0x0b,
-  0xf9, 0xb7, 0xdc, 0xf2, 0x37, 0x0d, 0xff, 0xf8, 0xf1, 0x27, 0xe6, 0xe0,
-  0xfe, 0x1d, 0xe8, 0x49, 0x15, 0x33, 0x16, 0x1d, 0x00, 0xdd, 0xd9, 0x50,
-  0x18, 0x0e, 0x0e, 0x31, 0xed, 0x06, 0xf8, 0xf2, 0x15, 0xeb, 0xf2, 0xdf,
-  0xdc, 0xf5, 0x0d, 0x1f, 0x0f, 0xf6, 0xb7, 0x10, 0xe3, 0x05, 0x6d, 0xcb,
-  0xfb, 0xb2, 0xe7, 0xef, 0xe5, 0xf4, 0x55, 0x2f, 0xeb, 0x03, 0xf2, 0x0c,
-  0x0f, 0xba, 0x16, 0xf0, 0xfc, 0x18, 0x2c, 0xfb, 0xf8, 0xac, 0x41, 0xc9,
-  0xb6, 0xe8, 0x1b, 0xc2, 0xc0, 0xe6, 0xcd, 0x6a, 0xb8, 0x68, 0x26, 0xf1,
-  0xc5, 0xcc, 0x87, 0xda, 0xf6, 0x2d, 0xe6, 0xda, 0x47, 0xdb, 0x1d, 0xb1,
-  0x14, 0xef, 0x42, 0xd4, 0xea, 0xd3, 0x07, 0x3f, 0xf4, 0x11, 0xcc, 0xf1,
-  0xd3, 0xb4, 0x27, 0xed, 0x06, 0xf7, 0xfb, 0xff, 0xcd, 0xec, 0x14, 0xff,
-  0xcd, 0x26, 0x18, 0x62, 0xfc, 0xf7, 0x4d, 0xe8, 0xf5, 0x29, 0x2b, 0xdb,
-  0x27, 0xf8, 0x04, 0xfc, 0x5a, 0x0c, 0xf9, 0xf5, 0xe6, 0xb6, 0xb9, 0xf1,
-  0xd3, 0x18, 0xf6, 0x1d, 0xbc, 0xf6, 0xc7, 0xcf, 0x03, 0x11, 0x1c, 0x05,
-  0xe2, 0x95, 0xf6, 0xf7, 0x20, 0x03, 0xfe, 0x23, 0xe5, 0x07, 0xe8, 0x3c,
-  0x0f, 0xf6, 0x06, 0x30, 0xf0, 0xda, 0x2c, 0x08, 0x22, 0x1d, 0x1e, 0xfe,
-  0xde, 0xed, 0x0d, 0xd9, 0xce, 0xf9, 0xf8, 0x70, 0xe9, 0x12, 0x39, 0x48,
-  0xe1, 0x11, 0xfa, 0xfa, 0x05, 0x08, 0xfd, 0xfa, 0xf2, 0xd7, 0x19, 0xe4,
-  0x2b, 0xe9, 0xfe, 0x56, 0x08, 0x24, 0x3c, 0xd7, 0xa8, 0x3a, 0x0d, 0x38,
-  0xb8, 0x1e, 0x09, 0x0c, 0x07, 0x08, 0xd1, 0xe7, 0x34, 0xef, 0xbf, 0x17,
-  0x06, 0x15, 0x1c, 0xd8, 0x2b, 0x24, 0xd1, 0x19, 0xef, 0x21, 0xf0, 0x04,
-  0x1a, 0xfc, 0x27, 0xf6, 0x06, 0x21, 0xe4, 0x39, 0x16, 0x11, 0xde, 0xd9,
-  0xd9, 0xe9, 0xe0, 0xd9, 0x22, 0xf8, 0x24, 0xc2, 0x2b, 0x20, 0x0b, 0x1f,
-  0xd0, 0xc5, 0x01, 0x03, 0x18, 0x1c, 0xcf, 0x0f, 0xf1, 0x05, 0x1a, 0x0b,
-  0xfa, 0x59, 0xf9, 0xdf, 0xd0, 0x0c, 0xfc, 0x3d, 0xe7, 0xfd, 0x14, 0xfc,
-  0x3d, 0x15, 0xff, 0x38, 0xe0, 0x38, 0x0a, 0xe4, 0x07, 0x0e, 0x0b, 0xe7,
-  0x11, 0x19, 0xf7, 0xc6, 0x1a, 0xc1, 0x1d, 0xe8, 0xf1, 0x2f, 0xf1, 0x27,
-  0xe7, 0x00, 0xd8, 0x07, 0xf0, 0x07, 0xfc, 0xe1, 0x14, 0x10, 0xdd, 0xfd,
-  0xdb, 0x4e, 0x2d, 0x22, 0x14, 0x9c, 0xf5, 0xed, 0x32, 0x18, 0xdf, 0x12,
-  0x0f, 0xd4, 0xe8, 0xf3, 0x03, 0x2e, 0x0e, 0xf4, 0xda, 0x19, 0xf6, 0xfb,
-  0xf5, 0x01, 0x06, 0x13, 0x4b, 0xfa, 0xcd, 0x7f, 0x13, 0x2d, 0x1e, 0xd0,
-  0x1a, 0xca, 0x05, 0x2d, 0xca, 0x01, 0xf2, 0xe4, 0xf8, 0xc4, 0x27, 0xe9,
-  0xec, 0x3d, 0xf2, 0xff, 0xc3, 0xed, 0xc3, 0x5e, 0xd9, 0xe2, 0x05, 0xef,
-  0xec, 0x15, 0xf3, 0xd8, 0xcc, 0x33, 0x47, 0xd9, 0x10, 0x15, 0x03, 0xf1,
-  0xef, 0x32, 0x07, 0x53, 0x33, 0x0d, 0xdf, 0xd7, 0xed, 0x31, 0xdb, 0x21,
-  0xf0, 0xec, 0x0f, 0x20, 0x47, 0x44, 0xad, 0xf1, 0x53, 0xeb, 0xb9, 0x07,
-  0x44, 0xf3, 0xc0, 0x00, 0x29, 0x20, 0xe8, 0xf2, 0xe7, 0x08, 0xee, 0xcc,
-  0xfb, 0x18, 0x32, 0x10, 0x11, 0xfb, 0xfa, 0xf5, 0xfd, 0xda, 0x09, 0xc7,
-  0xf9, 0xda, 0xde, 0xf4, 0xfc, 0xd4, 0xf6, 0x09, 0xbb, 0x36, 0xf7, 0x02,
-  0x21, 0xe2, 0x21, 0x12, 0xfa, 0x2b, 0xd0, 0xcb, 0xe4, 0xdc, 0xe0, 0xe9,
-  0x3c, 0x1f, 0xd6, 0xdf, 0xfc, 0xd2, 0x0d, 0x31, 0xd2, 0x11, 0x29, 0x23,
-  0x26, 0xf4, 0x10, 0xf2, 0x43, 0x03, 0xcb, 0x64, 0x29, 0xda, 0x10, 0x07,
-  0xeb, 0xf5, 0x0b, 0xfe, 0xd3, 0x2b, 0x2b, 0x02, 0x0c, 0xd0, 0x2f, 0xf9,
-  0xc5, 0xc5, 0x22, 0xf1, 0x15, 0xcd, 0xeb, 0xe5, 0xde, 0xff, 0xe8, 0xd5,
-  0xab, 0x3e, 0x15, 0x1c, 0xf4, 0xec, 0x14, 0xcf, 0x1e, 0x21, 0xe1, 0xda,
-  0xf3, 0xc7, 0x1b, 0xd6, 0x20, 0x18, 0xdc, 0x11, 0xef, 0x01, 0xfa, 0x35,
-  0x25, 0x00, 0x3a, 0x19, 0x07, 0x33, 0xe6, 0xed, 0x0a, 0xeb, 0x0c, 0x5c,
-  0x23, 0xef, 0xfd, 0x36, 0xe0, 0x27, 0xe9, 0x36, 0xf3, 0x28, 0x16, 0xfe,
-  0xf8, 0xcb, 0x00, 0xfc, 0xd2, 0xea, 0x2c, 0x51, 0x35, 0x00, 0xeb, 0xf0,
-  0xce, 0x0c, 0xfc, 0xf9, 0x38, 0x2e, 0x37, 0xe6, 0x14, 0x0d, 0x11, 0xd0,
-  0x03, 0x16, 0x3b, 0x14, 0x11, 0x1b, 0xca, 0x46, 0xe7, 0x02, 0xc7, 0xfd,
-  0xdf, 0xfc, 0x09, 0x12, 0x4a, 0x40, 0xf8, 0xec, 0x21, 0x2c, 0x8c, 0xdc,
-  0x0d, 0xd6, 0x35, 0xd7, 0xf7, 0xee, 0xd5, 0xea, 0xab, 0x45, 0xc3, 0xd4,
-  0xdc, 0x2c, 0xf4, 0xea, 0x0c, 0xfa, 0xb4, 0x09, 0xd7, 0x07, 0xf8, 0xc9,
-  0x17, 0xd0, 0x20, 0x07, 0xf9, 0xe6, 0xe7, 0xe2, 0xf2, 0x3f, 0x42, 0xfa,
-  0x04, 0x1b, 0x28, 0xd2, 0xdc, 0x04, 0x19, 0x61, 0xd4, 0xcc, 0xde, 0x26,
-  0xd3, 0x01, 0xff, 0xfc, 0x02, 0xd6, 0xe8, 0xf1, 0x17, 0x26, 0xe4, 0x0b,
-  0x42, 0x0b, 0xc6, 0xc4, 0xf2, 0xf6, 0x5e, 0xe1, 0x3a, 0xbd, 0x0d, 0xca,
-  0xd8, 0xe5, 0xdc, 0xbc, 0x03, 0x41, 0xe7, 0x08, 0x0c, 0xe6, 0xa3, 0x25,
-  0x01, 0xf0, 0x0b, 0xee, 0xff, 0xb3, 0x11, 0x02, 0xf8, 0x06, 0xec, 0xb9,
-  0xe4, 0x41, 0x3b, 0xfd, 0xe3, 0x0c, 0x26, 0xb3, 0xe5, 0x28, 0x01, 0xeb,
-  0xdc, 0xd6, 0x20, 0x10, 0xf9, 0xe1, 0x0b, 0xfa, 0x18, 0x0d, 0xd9, 0x31,
-  0x01, 0x15, 0xf5, 0xef, 0xf5, 0x1f, 0xaf, 0xea, 0xb3, 0xfc, 0xf8, 0x17,
-  0x01, 0xbb, 0x0d, 0xf5, 0xce, 0xfb, 0xd1, 0x28, 0xf0, 0x1f, 0xb4, 0xb5,
-  0xec, 0xe8, 0xb9, 0x34, 0x46, 0xea, 0x23, 0x2c, 0x2d, 0xd6, 0x05, 0xfb,
-  0x00, 0x00, 0xf1, 0x20, 0xef, 0x11, 0xff, 0xf6, 0xff, 0xbf, 0x04, 0xf1,
-  0xf1, 0xeb, 0xec, 0xf0, 0xf5, 0xfc, 0x0e, 0xd1, 0x04, 0xd7, 0xd1, 0xea,
-  0x18, 0xf5, 0x0f, 0xe8, 0xda, 0x1b, 0xee, 0x21, 0x13, 0x0e, 0x11, 0xf6,
-  0x81, 0x08, 0x1f, 0x16, 0xf0, 0x1d, 0xc8, 0xfb, 0xdf, 0xd6, 0x06, 0xf3,
-  0xec, 0x05, 0x1c, 0xfb, 0x19, 0xdc, 0x18, 0xf6, 0x20, 0x0a, 0x02, 0x24,
-  0x0f, 0x09, 0x16, 0xeb, 0x40, 0x04, 0xd7, 0xf2, 0x2b, 0x1a, 0xfc, 0x1d,
-  0x1f, 0xc5, 0xed, 0x0e, 0xfa, 0xde, 0xdd, 0xe4, 0xf4, 0x09, 0xfe, 0x31,
-  0x17, 0x02, 0xd9, 0xde, 0x59, 0xf0, 0x1a, 0xfd, 0xf3, 0xf6, 0xeb, 0x11,
-  0x01, 0xcb, 0xef, 0xf5, 0xad, 0xf3, 0x2b, 0x16, 0xfe, 0xff, 0x1e, 0xf7,
-  0x00, 0xf7, 0x3e, 0xb4, 0x12, 0xf5, 0x11, 0x0d, 0x52, 0xfa, 0x21, 0xed,
-  0x04, 0xce, 0x0b, 0xe1, 0xfa, 0xe3, 0xeb, 0xfe, 0x1b, 0xee, 0xc9, 0xa8,
-  0xf1, 0x06, 0xe3, 0x0d, 0xea, 0xe0, 0x05, 0xe6, 0x11, 0xef, 0xe5, 0xe7,
-  0xe5, 0x0d, 0xeb, 0x03, 0x1a, 0x10, 0xd3, 0x07, 0x34, 0xe5, 0x23, 0xed,
-  0xf8, 0xea, 0xde, 0x1f, 0x1b, 0xa0, 0x26, 0xec, 0xc4, 0x1a, 0xf2, 0x1c,
-  0xf8, 0xfe, 0x01, 0x0f, 0xe8, 0xc4, 0xf5, 0xdf, 0xf9, 0x14, 0x09, 0x09,
-  0x29, 0x14, 0x03, 0xda, 0xe1, 0x01, 0xfc, 0xf8, 0xea, 0x10, 0x1f, 0xd4,
-  0xf3, 0xe6, 0x0c, 0xe4, 0x0f, 0xdf, 0xde, 0x24, 0xf5, 0xfa, 0xe2, 0xfa,
-  0xf0, 0xfc, 0xdb, 0xf0, 0x02, 0x19, 0xed, 0xe0, 0x16, 0xf0, 0x0f, 0x03,
-  0xf6, 0x08, 0xe0, 0x02, 0xee, 0x07, 0xf0, 0x3e, 0x3a, 0x08, 0x32, 0xcc,
-  0xc4, 0xe6, 0x1b, 0x04, 0x00, 0x2c, 0xf4, 0x16, 0x00, 0xde, 0xe3, 0x10,
-  0x0d, 0xed, 0x0e, 0x04, 0xff, 0x23, 0x08, 0xeb, 0x3c, 0x1f, 0xca, 0x13,
-  0x1b, 0xe8, 0xf9, 0xec, 0x1c, 0xfa, 0x18, 0x14, 0x13, 0x25, 0x13, 0x2a,
-  0x1e, 0xf8, 0xf9, 0x01, 0x0d, 0x22, 0xdc, 0x1d, 0x0b, 0x0a, 0xf8, 0x1b,
-  0xf7, 0x05, 0xf4, 0xe1, 0x24, 0xcd, 0xf2, 0xda, 0xd3, 0xe7, 0x2a, 0x12,
-  0x11, 0xd6, 0xf7, 0xe9, 0xd9, 0xca, 0x03, 0xf9, 0xe9, 0x17, 0xe8, 0xe4,
-  0xf9, 0xc5, 0xeb, 0x1e, 0x23, 0xde, 0x1b, 0x19, 0x0d, 0x08, 0x13, 0xff,
-  0x00, 0xf8, 0xe7, 0x12, 0x09, 0xe0, 0x0c, 0xeb, 0xd2, 0xec, 0x1a, 0x2e,
-  0x11, 0x4e, 0xf7, 0x21, 0x19, 0xff, 0xf9, 0x1d, 0x0d, 0x33, 0xef, 0xc1,
-  0x31, 0x14, 0xef, 0xe5, 0xee, 0xf1, 0xec, 0xe7, 0xfa, 0x10, 0xf8, 0xe7,
-  0xe2, 0xec, 0x1b, 0x17, 0x2d, 0xf0, 0xea, 0xef, 0xd2, 0x1f, 0xd6, 0xee,
-  0x0d, 0xb0, 0x0f, 0xee, 0xed, 0xc1, 0x05, 0xfa, 0xef, 0xed, 0xff, 0x2d,
-  0x14, 0x28, 0x1a, 0x24, 0xf8, 0x13, 0xf5, 0x0b, 0xfc, 0xf6, 0x30, 0x22,
-  0x1c, 0x1b, 0xff, 0x48, 0xfc, 0x03, 0xf2, 0xc7, 0xeb, 0xfa, 0xdc, 0xc0,
-  0x0b, 0x00, 0xe2, 0xe4, 0x04, 0x12, 0xe0, 0xe6, 0x0e, 0xe4, 0x1b, 0xff,
-  0xda, 0xff, 0xd3, 0xe1, 0x02, 0x0a, 0xf4, 0x11, 0x03, 0x33, 0x20, 0xe0,
-  0xf3, 0xd7, 0xed, 0xd3, 0x34, 0xef, 0x07, 0x17, 0x15, 0x29, 0x20, 0x1e,
-  0xe0, 0xec, 0xe4, 0x15, 0xef, 0xf7, 0xd9, 0xf0, 0xfe, 0x2b, 0x2f, 0xd0,
-  0x03, 0x10, 0xd7, 0xdf, 0xf4, 0x18, 0xec, 0xf2, 0x01, 0x21, 0x08, 0xe1,
-  0x01, 0xdf, 0x0b, 0xf2, 0x1b, 0x0f, 0xae, 0x12, 0xf1, 0xdd, 0xd3, 0xfb,
-  0xeb, 0x1e, 0xf4, 0x0c, 0xf5, 0xf0, 0xe0, 0xef, 0xe6, 0xf9, 0x08, 0xfa,
-  0xdc, 0x18, 0x15, 0x00, 0x12, 0xe5, 0x09, 0xf8, 0x41, 0xeb, 0x09, 0xfc,
-  0x16, 0x19, 0x49, 0x14, 0x2a, 0x06, 0x1d, 0x0f, 0xe4, 0xdd, 0x05, 0xcf,
-  0x29, 0x11, 0x32, 0xe2, 0xf7, 0xfe, 0xe0, 0xe1, 0xd5, 0x0a, 0x15, 0xeb,
-  0x1f, 0x59, 0x07, 0xf7, 0x22, 0xde, 0x20, 0x21, 0xff, 0x02, 0x03, 0x00,
-  0x01, 0x08, 0xda, 0xf7, 0x01, 0xe5, 0x07, 0x04, 0xeb, 0x0d, 0xf5, 0xf4,
-  0x01, 0x09, 0x1c, 0x0d, 0xd8, 0xec, 0x10, 0xe3, 0xdf, 0xe9, 0x13, 0xcd,
-  0x4b, 0xd8, 0x0e, 0xd0, 0x1c, 0x34, 0x1b, 0xf5, 0x2a, 0xde, 0xff, 0x1b,
-  0xcf, 0x4d, 0x24, 0xe6, 0xff, 0x01, 0xd7, 0x02, 0x04, 0xf0, 0x05, 0x0d,
-  0x08, 0x04, 0x18, 0xe1, 0xd9, 0x03, 0xca, 0x0c, 0xfa, 0xcd, 0xc5, 0xe8,
-  0xe0, 0x29, 0xec, 0xda, 0x0f, 0xc4, 0xf0, 0xec, 0x15, 0x0f, 0x19, 0x07,
-  0xb9, 0x1b, 0xe0, 0xe5, 0xf1, 0xe5, 0xd3, 0x0d, 0xea, 0xd0, 0xda, 0xc1,
-  0xf0, 0x2c, 0x1d, 0xfd, 0x1a, 0xf9, 0x2f, 0xda, 0xc3, 0x16, 0x38, 0xfb,
-  0x0f, 0x03, 0xb5, 0x0f, 0x43, 0x3e, 0xfc, 0x52, 0x17, 0xdb, 0x60, 0xe3,
-  0xf8, 0xe3, 0xc9, 0xee, 0xfa, 0xad, 0xf5, 0xec, 0xbd, 0xff, 0xf6, 0x0f,
-  0x0c, 0xa8, 0x07, 0xd5, 0xda, 0xe9, 0xce, 0x85, 0xee, 0xee, 0xf9, 0x2a,
-  0xf2, 0xfd, 0x16, 0xbb, 0xd6, 0x06, 0x01, 0x45, 0xd0, 0xfd, 0x1c, 0xb6,
-  0x1e, 0x14, 0xfd, 0xc9, 0xb2, 0x0c, 0x0e, 0xf4, 0x14, 0xfe, 0x28, 0xea,
-  0xe3, 0xdf, 0x18, 0xda, 0x15, 0x0a, 0xd7, 0xe5, 0x45, 0x42, 0xda, 0x34,
-  0x36, 0xd0, 0x54, 0xff, 0x4d, 0xfc, 0xae, 0x0d, 0x0e, 0xda, 0x06, 0xe5,
-  0xdc, 0x05, 0xba, 0x06, 0x11, 0x07, 0xf0, 0xd7, 0xe5, 0xdb, 0xf0, 0x37,
-  0x0a, 0x0a, 0xfb, 0xe8, 0xef, 0xe1, 0xfe, 0xc8, 0x57, 0x10, 0xf6, 0x02,
-  0xe1, 0x39, 0xcc, 0xae, 0xc4, 0xf8, 0x0a, 0x9f, 0xf5, 0xf2, 0x29, 0x27,
-  0x1f, 0x18, 0x20, 0xe5, 0x11, 0x25, 0x09, 0xf0, 0x07, 0x17, 0xae, 0x26,
-  0x19, 0x38, 0xf8, 0xf3, 0xf7, 0x19, 0x14, 0x02, 0xbc, 0x01, 0x24, 0x0e,
-  0xe9, 0xc2, 0x15, 0x25, 0x0e, 0x0d, 0x05, 0x08, 0x2c, 0x1a, 0xd4, 0x19,
-  0xfb, 0xf4, 0xdd, 0xcc, 0xaa, 0x1b, 0x1c, 0x30, 0x1e, 0xd7, 0x09, 0x0f,
-  0x04, 0x03, 0x10, 0x01, 0xe3, 0xf3, 0x05, 0x5f, 0x38, 0xb1, 0x3e, 0xff,
-  0xf4, 0x06, 0x41, 0x40, 0x0f, 0xa7, 0x14, 0x07, 0xff, 0xe6, 0x0f, 0xfe,
-  0xee, 0xfa, 0x26, 0xe8, 0x03, 0xba, 0xbd, 0x16, 0xfe, 0xe9, 0x26, 0x1c,
-  0x1d, 0xd3, 0xfd, 0xbb, 0x06, 0xc4, 0xe9, 0xfd, 0x8d, 0xf4, 0x30, 0x2b,
-  0x0d, 0xe8, 0x02, 0xf2, 0x1a, 0x27, 0xe9, 0xae, 0xa7, 0x11, 0x31, 0x1a,
-  0x20, 0xd4, 0x10, 0x15, 0xdf, 0xfb, 0x15, 0x3e, 0xea, 0xe3, 0x59, 0x09,
-  0xf7, 0x0c, 0x16, 0x13, 0xe4, 0x1d, 0x07, 0x4e, 0xee, 0xc7, 0x31, 0xed,
-  0xed, 0xf1, 0xfc, 0xf3, 0xcc, 0xf8, 0x51, 0x40, 0xb1, 0xc3, 0xe1, 0xde,
-  0xf6, 0xf4, 0x35, 0xec, 0x22, 0xef, 0x2f, 0x0b, 0x2a, 0xb4, 0xb7, 0xdc,
-  0xb3, 0x18, 0xb6, 0xb8, 0x3d, 0xf0, 0x04, 0x05, 0x06, 0x13, 0xf1, 0x35,
-  0xf0, 0x5e, 0xef, 0xd6, 0x07, 0xd5, 0x09, 0xf6, 0x02, 0x14, 0xe7, 0x3e,
-  0x02, 0xf8, 0xa7, 0x81, 0xf7, 0x07, 0x09, 0x00, 0x04, 0xf6, 0x0f, 0x38,
-  0x36, 0xd8, 0x2d, 0xc7, 0xf2, 0xd3, 0x39, 0x20, 0xd6, 0x06, 0x40, 0xf4,
-  0x03, 0xfa, 0x0e, 0xf9, 0xc6, 0x29, 0x3a, 0x12, 0xc5, 0x15, 0x1d, 0xe1,
-  0x00, 0xc9, 0xad, 0x33, 0x29, 0xdd, 0xf1, 0x12, 0x07, 0xe1, 0x0a, 0x26,
-  0xe4, 0xf9, 0x8f, 0xf2, 0xf6, 0x5c, 0x2e, 0xf3, 0x03, 0x2b, 0x11, 0x53,
-  0x15, 0xad, 0x5e, 0x20, 0x25, 0x07, 0x59, 0xec, 0xf9, 0xe6, 0x6a, 0xf7,
-  0xdb, 0xef, 0xcd, 0xa0, 0xf5, 0xb2, 0x0c, 0x2c, 0xcc, 0xd3, 0xcf, 0xb2,
-  0xf4, 0xb2, 0x13, 0x17, 0xed, 0xf9, 0xdb, 0x29, 0x22, 0x03, 0xf9, 0x26,
-  0x3e, 0x18, 0xed, 0xe4, 0xd1, 0x24, 0xcf, 0x2e, 0x4c, 0xd5, 0xfd, 0xd3,
-  0x17, 0xd2, 0x03, 0x00, 0xf3, 0x33, 0xa1, 0x0a, 0xe7, 0x50, 0x4c, 0x09,
-  0x25, 0xf0, 0xf9, 0x17, 0x17, 0xaa, 0x45, 0x45, 0x23, 0xf8, 0x1b, 0xd1,
-  0x12, 0xf1, 0x2b, 0x0a, 0x0a, 0xfe, 0xf3, 0x3e, 0xb1, 0xfe, 0x10, 0x2f,
-  0xcf, 0x20, 0x10, 0x14, 0x9e, 0xfd, 0x21, 0xcd, 0x1c, 0x0a, 0x2d, 0xe9,
-  0x04, 0xf4, 0x3d, 0x44, 0xce, 0x29, 0x3b, 0x45, 0xf0, 0x2b, 0xf7, 0xff,
-  0xe1, 0xca, 0x18, 0xe9, 0xfb, 0xde, 0x16, 0xc3, 0x0b, 0x00, 0xbf, 0x0b,
-  0xd8, 0x12, 0xa8, 0x10, 0xe6, 0xed, 0xeb, 0xb5, 0x23, 0xc6, 0x3c, 0x17,
-  0x3e, 0xcd, 0x06, 0xc2, 0xf4, 0x04, 0x2f, 0xf4, 0xca, 0xeb, 0xbb, 0x3b,
-  0x2f, 0x2d, 0x30, 0x13, 0x26, 0xe7, 0xdc, 0x76, 0xf4, 0xf5, 0xfd, 0xd7,
-  0xf6, 0x2a, 0xcb, 0xdc, 0xfc, 0xf5, 0x4a, 0x43, 0xb0, 0x06, 0x05, 0x37,
-  0xbe, 0x35, 0xc4, 0xf9, 0xbf, 0x48, 0xe9, 0x05, 0x10, 0xe5, 0x02, 0xbf,
-  0x19, 0x56, 0xe8, 0x78, 0x2b, 0xce, 0x0b, 0xe3, 0x13, 0x31, 0x01, 0xe5,
-  0xde, 0x20, 0xfd, 0xfd, 0xb8, 0xca, 0xff, 0xfd, 0xe8, 0xea, 0x07, 0x46,
-  0x2b, 0x36, 0x05, 0x0e, 0xd6, 0xa6, 0x34, 0x07, 0x17, 0xfa, 0x00, 0xdc,
-  0xee, 0x24, 0xdd, 0xcd, 0xaf, 0x32, 0x24, 0xf0, 0x14, 0xf6, 0xee, 0x1f,
-  0xd9, 0xfa, 0xe9, 0x05, 0x10, 0x3e, 0xf7, 0xd7, 0xe3, 0x12, 0xe3, 0x69,
-  0xc0, 0x0d, 0x02, 0xcc, 0x1a, 0x35, 0xf6, 0xef, 0x15, 0x3a, 0xdf, 0xf5,
-  0xbe, 0x45, 0x1a, 0x01, 0xff, 0x1c, 0xf6, 0x2c, 0xc7, 0x28, 0xee, 0x14,
-  0xcb, 0xf4, 0xe7, 0xf4, 0x0d, 0x0f, 0x31, 0x2c, 0xf7, 0xe4, 0x09, 0x0e,
-  0x0a, 0xfc, 0xd9, 0x81, 0xe7, 0x21, 0xc7, 0xb4, 0xcf, 0x0d, 0xec, 0xff,
-  0xad, 0xe6, 0x5b, 0xe9, 0x0e, 0xda, 0xe5, 0x08, 0xe5, 0x3c, 0x1b, 0x08,
-  0x12, 0x26, 0xf1, 0xab, 0xe0, 0xe7, 0x0b, 0xe2, 0xe3, 0x32, 0x10, 0x01,
-  0x6f, 0xee, 0xda, 0xe0, 0xe3, 0x3e, 0xbf, 0x23, 0xea, 0x32, 0xed, 0xde,
-  0xae, 0xeb, 0x1a, 0xf2, 0xfa, 0xb7, 0xfe, 0xfa, 0xf7, 0x5a, 0x03, 0xec,
-  0xfd, 0x16, 0xdf, 0xfe, 0x04, 0x00, 0x1b, 0xfe, 0x22, 0x3d, 0xe8, 0xb7,
-  0x29, 0x06, 0x24, 0xcd, 0xc9, 0xf1, 0x0e, 0xdd, 0xfd, 0xff, 0xde, 0xe5,
-  0xe9, 0x39, 0x1f, 0x15, 0xa5, 0x1c, 0x15, 0x2e, 0x11, 0x10, 0x12, 0xe6,
-  0x0d, 0xe6, 0xc4, 0x45, 0x3a, 0x9d, 0x21, 0xb8, 0xee, 0xf9, 0xd4, 0x00,
-  0xf6, 0x0c, 0x23, 0xf2, 0x23, 0xdd, 0x03, 0xc2, 0x02, 0xa3, 0x32, 0x14,
-  0x05, 0x14, 0xe1, 0xf2, 0xe8, 0xe0, 0x01, 0xd6, 0x21, 0x29, 0xfa, 0x2c,
-  0x02, 0xe7, 0xf8, 0xeb, 0xc9, 0x3b, 0x3a, 0xe2, 0xcd, 0x06, 0xe7, 0x2f,
-  0x17, 0x04, 0x06, 0xdb, 0xfa, 0xfb, 0xf8, 0x05, 0xec, 0xe0, 0xfc, 0x65,
-  0xe6, 0x04, 0xf4, 0xd6, 0xf2, 0xec, 0xda, 0x1b, 0xd8, 0x2e, 0x0e, 0xec,
-  0xff, 0x31, 0xe9, 0xd6, 0x29, 0x0b, 0x57, 0x26, 0x34, 0x3d, 0x34, 0x29,
-  0x05, 0xe0, 0x20, 0xee, 0x2d, 0x1e, 0x2c, 0xd3, 0xf5, 0x18, 0x19, 0x05,
-  0xfa, 0x09, 0x0c, 0xef, 0xdd, 0xfe, 0x13, 0x48, 0xcf, 0xe9, 0x1f, 0xd3,
-  0xc1, 0xff, 0x16, 0x0b, 0xd5, 0x07, 0x0d, 0xf8, 0xe7, 0xf4, 0x09, 0x14,
-  0xd3, 0x01, 0xdb, 0xf6, 0xf8, 0x07, 0x12, 0xb8, 0xd5, 0xee, 0xe2, 0xcd,
-  0xd4, 0x3e, 0x13, 0xcc, 0xbd, 0xe7, 0xf3, 0x15, 0x15, 0x28, 0x25, 0x03,
-  0xfe, 0xf7, 0x13, 0x03, 0xf7, 0xc5, 0x1c, 0xf2, 0xe0, 0x02, 0xfb, 0xc2,
-  0xe7, 0xd0, 0xeb, 0x27, 0xde, 0x31, 0x09, 0xfa, 0x4d, 0x21, 0xf4, 0x08,
-  0x05, 0x06, 0x29, 0xf6, 0xec, 0x16, 0x01, 0x05, 0xdb, 0x26, 0x04, 0x0f,
-  0x0b, 0xe9, 0x39, 0xf3, 0x0d, 0x15, 0x07, 0x62, 0xd8, 0xf7, 0xeb, 0x00,
-  0xf6, 0xe2, 0xde, 0xc9, 0x0e, 0x16, 0xfb, 0xef, 0x00, 0xcc, 0x31, 0x07,
-  0xfa, 0xfd, 0x48, 0xf4, 0x29, 0xd0, 0xf9, 0x1b, 0xdb, 0xf3, 0x18, 0xb4,
-  0xc6, 0x15, 0xf1, 0x06, 0xca, 0xe8, 0xe3, 0x08, 0xf0, 0xf4, 0xf2, 0x4c,
-  0x01, 0xf7, 0x10, 0xe7, 0x2d, 0x1e, 0x04, 0xf4, 0x0d, 0xff, 0xfa, 0x1e,
-  0x1f, 0x0d, 0xf6, 0x1e, 0x10, 0xa3, 0xfd, 0x73, 0xde, 0x04, 0xde, 0x2c,
-  0xe4, 0xed, 0xe8, 0xf1, 0x06, 0xe0, 0xea, 0x23, 0xc8, 0x2d, 0x0d, 0x07,
-  0xfa, 0xc2, 0x32, 0xd4, 0xe0, 0x1d, 0x44, 0xfd, 0x4c, 0xeb, 0x23, 0xd2,
-  0x26, 0xf0, 0xd5, 0xcc, 0xf0, 0xef, 0xfa, 0x39, 0xe8, 0xe3, 0xe7, 0x08,
-  0xfc, 0xd7, 0xfb, 0x0f, 0xe1, 0x43, 0xf4, 0x70, 0x4d, 0x0c, 0x1b, 0xe8,
-  0x1c, 0x27, 0x02, 0xeb, 0xf7, 0xf1, 0xf3, 0xfa, 0x36, 0xd3, 0xe1, 0x4a,
-  0xf8, 0x36, 0xb2, 0x25, 0xf4, 0xe2, 0xe9, 0xeb, 0xe0, 0xd8, 0xeb, 0xfd,
-  0x00, 0x38, 0x2a, 0xc9, 0xf2, 0xbf, 0xe5, 0xa4, 0x1d, 0x01, 0x32, 0xc9,
-  0x24, 0x08, 0x3a, 0xe7, 0x1c, 0xf2, 0x0d, 0xd1, 0xb6, 0xc3, 0xed, 0xf7,
-  0xb6, 0xd0, 0x0c, 0xdb, 0xc3, 0x01, 0x3b, 0xc3, 0x32, 0x4d, 0xf7, 0x61,
-  0x26, 0xfc, 0xe4, 0x0a, 0x0a, 0x69, 0xda, 0xd4, 0xf2, 0xf7, 0xfe, 0x36,
-  0x01, 0xdd, 0xd0, 0x25, 0xdd, 0x34, 0x39, 0xff, 0x11, 0xe8, 0xed, 0x17,
-  0x31, 0x62, 0x42, 0xc8, 0xe8, 0x0a, 0x0e, 0xdd, 0xe1, 0x2c, 0x3b, 0xf7,
-  0x29, 0xdf, 0xf4, 0xef, 0x62, 0xf2, 0x28, 0xdc, 0xf8, 0xed, 0xeb, 0xf4,
-  0x9b, 0xf0, 0x05, 0xd7, 0x02, 0x0a, 0x02, 0xd6, 0xef, 0xde, 0x03, 0x0c,
-  0x3c, 0xf5, 0xf7, 0xfe, 0xa0, 0x5f, 0xaf, 0x10, 0x05, 0xdc, 0xe8, 0x56,
-  0xe0, 0x2e, 0x11, 0x19, 0xca, 0x0f, 0xd0, 0xf5, 0xe6, 0xf7, 0x2d, 0xf9,
-  0x23, 0x13, 0xfd, 0xfa, 0x47, 0x36, 0x25, 0x1b, 0xce, 0xe5, 0xea, 0x1c,
-  0xe0, 0x2d, 0x11, 0xf4, 0xed, 0x0d, 0xf7, 0x0f, 0x3c, 0xf2, 0x1d, 0xf0,
-  0xf8, 0x1d, 0xba, 0x12, 0x0c, 0xec, 0x1f, 0xe6, 0x37, 0x2c, 0x13, 0xbf,
-  0xed, 0x04, 0x28, 0xf1, 0x2f, 0xdd, 0xdf, 0xe8, 0x0e, 0x47, 0xe6, 0xfa,
-  0x26, 0xe8, 0xe8, 0x0c, 0x0d, 0x2c, 0xe7, 0x2f, 0xed, 0xda, 0xc8, 0xf3,
-  0xda, 0xb0, 0x3d, 0x0d, 0xf9, 0xe9, 0x11, 0xd0, 0xf1, 0xfb, 0xe2, 0xfe,
-  0x03, 0xf8, 0x07, 0x02, 0x0e, 0xea, 0xdd, 0xe5, 0xbd, 0xe1, 0x1f, 0xc7,
-  0x20, 0xdd, 0xce, 0xd8, 0xd6, 0x0e, 0xc4, 0xfa, 0x7a, 0x19, 0xff, 0x06,
-  0xf9, 0xfc, 0x19, 0x04, 0xda, 0x08, 0x14, 0xeb, 0xff, 0xd0, 0xf8, 0xe7,
-  0xea, 0x09, 0xef, 0xfd, 0x08, 0x22, 0xd5, 0x14, 0x30, 0xfa, 0x16, 0x25,
-  0xe9, 0xd0, 0xf8, 0xd1, 0x0c, 0x09, 0xf5, 0x02, 0x11, 0xfb, 0xec, 0xfc,
-  0x08, 0x43, 0xf6, 0x17, 0xe8, 0xe9, 0xdf, 0xc0, 0xb9, 0x26, 0x03, 0xff,
-  0x09, 0xaa, 0xde, 0x84, 0x35, 0x07, 0x0d, 0x0f, 0x0e, 0x39, 0xcd, 0x4b,
-  0x07, 0xaf, 0x27, 0x0f, 0x29, 0xb9, 0xfd, 0xc6, 0x39, 0xe8, 0xe0, 0x01,
-  0x3b, 0xeb, 0x5a, 0x04, 0xd4, 0xf5, 0xb0, 0x20, 0x15, 0x04, 0xff, 0x17,
-  0xd9, 0x23, 0xfd, 0x22, 0xc1, 0x13, 0xea, 0x4f, 0x13, 0x34, 0xe6, 0x2d,
-  0x12, 0x2c, 0xd8, 0xc6, 0xe6, 0x1b, 0xdd, 0x2e, 0xba, 0xbc, 0xf0, 0xa0,
-  0xd1, 0x13, 0x24, 0x37, 0xef, 0xe5, 0xc2, 0x91, 0x10, 0x10, 0x43, 0x09,
-  0x28, 0xeb, 0xc9, 0x78, 0x2d, 0x36, 0x32, 0xe7, 0x5d, 0x03, 0xff, 0xd8,
-  0x1e, 0xe6, 0xf0, 0xdf, 0x3a, 0xb5, 0x12, 0xd1, 0x5a, 0xee, 0x03, 0x1f,
-  0x20, 0x00, 0x0d, 0x28, 0x09, 0x00, 0xe1, 0x1c, 0x0c, 0x19, 0x05, 0x3d,
-  0x1a, 0xf3, 0x16, 0x3e, 0x1e, 0x1b, 0x1b, 0xae, 0xd8, 0x3e, 0xf0, 0x19,
-  0xef, 0x11, 0x46, 0xbc, 0xdd, 0xbf, 0xe8, 0xf7, 0xcc, 0x00, 0x35, 0x8a,
-  0x32, 0xdd, 0xf8, 0xe5, 0xcd, 0xe1, 0xbd, 0xea, 0x41, 0x45, 0x25, 0x4e,
-  0xe1, 0x95, 0x1b, 0xe4, 0xfb, 0xfa, 0x37, 0xe6, 0x27, 0xd8, 0x1c, 0xf9,
-  0x1a, 0x0f, 0x34, 0xe0, 0xda, 0x27, 0x02, 0x6c, 0x27, 0x23, 0xf2, 0xfc,
-  0xbc, 0x2f, 0x15, 0xfb, 0x13, 0xca, 0xb4, 0xea, 0xce, 0x21, 0x11, 0xd5,
-  0x3f, 0xf1, 0x0c, 0xf2, 0x49, 0x2b, 0x0f, 0xfa, 0x1e, 0xe8, 0xd4, 0x07,
-  0x37, 0xff, 0x4f, 0xa3, 0x1e, 0xf3, 0x2e, 0x54, 0x1f, 0x49, 0xc5, 0x3b,
-  0x55, 0x81, 0x21, 0xf6, 0xce, 0xbd, 0x0f, 0x13, 0x52, 0xb4, 0xbc, 0x03,
-  0xca, 0xe4, 0x40, 0x11, 0x62, 0xd3, 0x20, 0x0d, 0xf7, 0x52, 0xdf, 0xf1,
-  0xf0, 0xde, 0xf8, 0xde, 0x2a, 0xda, 0x25, 0x08, 0x23, 0x06, 0xf9, 0x19,
-  0x00, 0x3f, 0x0f, 0xfb, 0x06, 0x0a, 0xf5, 0x2d, 0xcc, 0xfe, 0xc2, 0xfe,
-  0x2f, 0x16, 0x1d, 0x3b, 0x05, 0xe9, 0xf4, 0xb3, 0x0f, 0xfa, 0xe8, 0x3c,
-  0x61, 0xe4, 0xd1, 0x0a, 0xd0, 0xfb, 0x36, 0xcb, 0x9b, 0x15, 0x27, 0x15,
-  0x5d, 0xd5, 0xf9, 0x0f, 0xd7, 0xd5, 0x53, 0x10, 0xf8, 0xe4, 0x1d, 0x1d,
-  0x2e, 0x28, 0xd2, 0x17, 0xc0, 0xe9, 0xf8, 0xd3, 0x28, 0xd1, 0x03, 0x00,
-  0x50, 0x44, 0xfc, 0x0f, 0xcd, 0x56, 0x2b, 0xfd, 0x35, 0x01, 0xdb, 0xe8,
-  0x09, 0x05, 0xeb, 0x0b, 0xec, 0x01, 0xba, 0x1a, 0xcb, 0x19, 0xf3, 0xf2,
-  0x0e, 0xef, 0xa9, 0xec, 0xfb, 0xe6, 0xf4, 0xee, 0x32, 0x30, 0x2c, 0x1a,
-  0xb2, 0xf3, 0xcd, 0x29, 0x2e, 0x21, 0x3c, 0x01, 0xfe, 0xd7, 0x62, 0x10,
-  0x10, 0xd5, 0x58, 0x13, 0xdc, 0xfa, 0x00, 0x49, 0xe4, 0x22, 0xf6, 0xd2,
-  0x14, 0xcb, 0x1d, 0x0d, 0xff, 0xbf, 0xfd, 0xa4, 0xcd, 0x66, 0x29, 0x14,
-  0xe0, 0xc7, 0x2a, 0xba, 0x1e, 0xf9, 0xf2, 0x10, 0xdf, 0xb5, 0x01, 0xe6,
-  0xe8, 0x2e, 0x28, 0x05, 0x9d, 0x4a, 0xcd, 0xa2, 0xed, 0xf3, 0x13, 0x2b,
-  0x06, 0xdd, 0x4b, 0x04, 0x48, 0xcc, 0xfc, 0x23, 0x38, 0x21, 0xfb, 0xd8,
-  0x56, 0xd0, 0xff, 0x41, 0x1c, 0xe3, 0xd9, 0xe5, 0xe3, 0xbd, 0x09, 0xe2,
-  0x0c, 0xe6, 0xf2, 0xeb, 0x03, 0xdd, 0xe9, 0x35, 0x22, 0xd9, 0xf3, 0x02,
-  0x24, 0x25, 0x08, 0xd2, 0xe2, 0xc4, 0x19, 0xf8, 0x2a, 0x12, 0x0a, 0x1f,
-  0xe9, 0xc8, 0xd2, 0x11, 0x06, 0x21, 0x25, 0xd5, 0xd9, 0x01, 0xf4, 0x15,
-  0xf4, 0xf1, 0xb3, 0xf2, 0x15, 0xb7, 0x10, 0xdf, 0x31, 0xd9, 0xe8, 0x73,
-  0x28, 0x11, 0xca, 0xff, 0x10, 0x89, 0xd9, 0x14, 0xeb, 0x0b, 0xf6, 0xe8,
-  0xe8, 0xd5, 0x2e, 0x14, 0xf8, 0x02, 0xd0, 0x2f, 0xc4, 0xea, 0xcd, 0x18,
-  0xb2, 0xb5, 0xea, 0xcf, 0x37, 0x13, 0x36, 0xd0, 0xe9, 0x11, 0xe6, 0x18,
-  0xd4, 0x24, 0x00, 0x42, 0x10, 0xf4, 0xc4, 0xfe, 0xfc, 0x04, 0xdb, 0x2d,
-  0xa0, 0x1f, 0xd7, 0x39, 0xfb, 0x16, 0x11, 0xea, 0x04, 0xe9, 0x1b, 0xc9,
-  0xfd, 0xf2, 0xf8, 0x1b, 0x2d, 0xf0, 0xdf, 0xce, 0x5c, 0x9b, 0xd9, 0xfc,
-  0x44, 0xf7, 0xf6, 0x26, 0x27, 0x0a, 0xc5, 0xec, 0xbd, 0x40, 0xde, 0x2d,
-  0xf3, 0xca, 0xf1, 0xd7, 0x0d, 0xe4, 0xfd, 0xd3, 0xc4, 0x21, 0x13, 0x4b,
-  0xfe, 0xe4, 0x5a, 0x32, 0x0f, 0xdb, 0xce, 0x00, 0xfa, 0xd6, 0x08, 0xa4,
-  0xca, 0x15, 0x16, 0x17, 0x0c, 0x2f, 0xec, 0xdc, 0xf2, 0x40, 0xf2, 0xd7,
-  0xbb, 0xb2, 0x13, 0x08, 0xe6, 0x33, 0x02, 0xe3, 0x10, 0xf3, 0x49, 0xf5,
-  0x33, 0xdc, 0x07, 0x40, 0x02, 0xdf, 0xe9, 0xe6, 0xe7, 0xe6, 0x39, 0xb7,
-  0x05, 0x42, 0x0e, 0xe6, 0xc7, 0xe1, 0xd4, 0x1d, 0xc5, 0x51, 0xe5, 0xfe,
-  0xc7, 0xdf, 0x2c, 0x43, 0xac, 0x0b, 0x15, 0x2f, 0x23, 0x29, 0xf5, 0xd6,
-  0xfd, 0xc7, 0xf2, 0x0e, 0x11, 0x3c, 0x08, 0x11, 0x4b, 0x14, 0xe5, 0xea,
-  0xcf, 0x30, 0xb0, 0xa9, 0xd5, 0xba, 0xd4, 0x25, 0xf1, 0xeb, 0x36, 0x41,
-  0xc7, 0xf1, 0x41, 0x4c, 0x30, 0xd2, 0x3d, 0x0b, 0x0a, 0xbc, 0xf2, 0xc8,
-  0x03, 0xfe, 0x28, 0xae, 0x34, 0xfe, 0x1f, 0x43, 0xfb, 0x22, 0x0a, 0x12,
-  0xdf, 0x30, 0xe1, 0xde, 0xc6, 0xe2, 0xeb, 0x36, 0xf8, 0x25, 0x17, 0x33,
-  0x19, 0x1a, 0x0f, 0x3d, 0x56, 0x1f, 0xeb, 0x07, 0x2a, 0xeb, 0xfb, 0x3a,
-  0x32, 0x04, 0xd4, 0x40, 0xd6, 0x5d, 0xfa, 0xbf, 0xe6, 0xe7, 0xfe, 0x36,
-  0xcc, 0x04, 0x08, 0xe7, 0x40, 0xf7, 0x37, 0x21, 0x04, 0xdf, 0x4b, 0x15,
-  0xeb, 0xdb, 0xf3, 0x23, 0x08, 0xe9, 0xfd, 0xb5, 0x2a, 0x12, 0x06, 0x15,
-  0xf8, 0xf1, 0x34, 0xc7, 0x21, 0xb2, 0x24, 0x22, 0xb3, 0x03, 0x40, 0x6b,
-  0x19, 0x30, 0x0d, 0xee, 0xf8, 0xd9, 0xce, 0xd8, 0xd2, 0x3f, 0x21, 0xc1,
-  0x27, 0x19, 0x12, 0x11, 0xf7, 0x00, 0xce, 0xce, 0xcc, 0x08, 0x13, 0x45,
-  0xf4, 0xab, 0x22, 0xd3, 0xde, 0xde, 0xfd, 0x55, 0xe2, 0xdd, 0xe9, 0xec,
-  0x47, 0x4d, 0x0a, 0x00, 0xc9, 0x08, 0x7f, 0xc7, 0x55, 0xb4, 0x2d, 0xf5,
-  0xfe, 0x4f, 0x16, 0xb3, 0xa8, 0xee, 0xc5, 0xfa, 0xf0, 0xd3, 0x28, 0xc6,
-  0xb0, 0xd5, 0x11, 0x34, 0xfc, 0xff, 0xfa, 0x12, 0x1d, 0xe1, 0xff, 0xd0,
-  0xb6, 0x24, 0x24, 0x2b, 0xf1, 0x18, 0xe3, 0xeb, 0xe0, 0xf4, 0xd8, 0x0a,
-  0xc7, 0x02, 0xd7, 0x12, 0xe0, 0xd2, 0x07, 0x0e, 0x41, 0xda, 0x19, 0x51,
-  0xb1, 0xf1, 0x04, 0xe2, 0x26, 0x2a, 0x51, 0xdf, 0xdc, 0xe8, 0x61, 0xf5,
-  0xef, 0xe9, 0x31, 0xed, 0x04, 0x0c, 0xd8, 0xf1, 0xe7, 0x3f, 0xdc, 0xf7,
-  0xdc, 0xd5, 0x15, 0x0c, 0xc5, 0xda, 0xf2, 0xfe, 0x1e, 0x1d, 0xfe, 0x26,
-  0xf5, 0xde, 0xf6, 0xf1, 0xe6, 0x43, 0xea, 0x21, 0xfc, 0xd3, 0x15, 0xf6,
-  0x1e, 0x1d, 0xe8, 0x2c, 0xcf, 0x1a, 0xf3, 0x08, 0xe5, 0x0b, 0x41, 0x01,
-  0x06, 0x12, 0x1e, 0xff, 0x23, 0xcb, 0xe9, 0x09, 0x0c, 0x37, 0x27, 0xe4,
-  0xf9, 0x09, 0x62, 0x22, 0xa1, 0x1a, 0x38, 0xfa, 0xe9, 0xff, 0xb3, 0xe0,
-  0xcb, 0x13, 0xf9, 0xe6, 0xfc, 0x2a, 0x1c, 0x4a, 0xf9, 0x1e, 0xdd, 0xc8,
-  0x09, 0x18, 0xb5, 0x01, 0x59, 0x37, 0xf9, 0x01, 0x1b, 0x18, 0xf5, 0xcd,
-  0x1a, 0x14, 0x4f, 0xc6, 0x4e, 0x3f, 0xc1, 0x00, 0x16, 0x36, 0xef, 0x16,
-  0xf9, 0xf0, 0x2c, 0x3f, 0xde, 0xd1, 0xc6, 0xe2, 0xf6, 0xe7, 0xd3, 0x2f,
-  0x09, 0xe6, 0x10, 0xf1, 0xf8, 0x00, 0xc8, 0x49, 0xb7, 0xdf, 0x42, 0xe9,
-  0xfd, 0x3d, 0x0a, 0x05, 0xb9, 0x17, 0xc3, 0x22, 0x00, 0x19, 0x1a, 0x1a,
-  0x0e, 0xfd, 0x04, 0xd9, 0xfd, 0x16, 0xc8, 0xf3, 0xfe, 0x4f, 0x0f, 0xf9,
-  0xcf, 0xee, 0x09, 0xfc, 0xa8, 0xf1, 0x11, 0x27, 0x57, 0xf9, 0x9c, 0xe6,
-  0xcb, 0x27, 0x19, 0xe8, 0xc7, 0x1a, 0x0e, 0x3d, 0xdb, 0xe0, 0x18, 0x0a,
-  0x11, 0x20, 0x06, 0xc5, 0xe7, 0x1c, 0xd3, 0x08, 0x00, 0xe7, 0xa2, 0xeb,
-  0x24, 0x03, 0x2a, 0xe4, 0x0b, 0x3b, 0xe1, 0x16, 0x87, 0x0e, 0xdb, 0x13,
-  0x04, 0xe6, 0x37, 0x07, 0x24, 0x06, 0xd1, 0xd2, 0x1f, 0x1d, 0x9c, 0xf4,
-  0x39, 0x3f, 0x08, 0xd5, 0xdf, 0xf4, 0x24, 0xbf, 0xb9, 0xea, 0x08, 0xfe,
-  0x52, 0xe9, 0xe8, 0x51, 0x21, 0x05, 0xd1, 0xdf, 0xf3, 0xfe, 0xe3, 0xdc,
-  0xe2, 0xd9, 0x11, 0xd1, 0x12, 0xf1, 0x0a, 0xcb, 0xe4, 0xf8, 0xc2, 0x01,
-  0xe7, 0xef, 0xc6, 0xf1, 0x2a, 0xf8, 0x7f, 0x1c, 0x09, 0x19, 0x04, 0x27,
-  0xb2, 0xd5, 0xbf, 0x12, 0x0e, 0x39, 0x11, 0x25, 0x1b, 0x42, 0x19, 0xf9,
-  0x09, 0x09, 0xc7, 0xd5, 0x2d, 0xe7, 0xde, 0xe4, 0xce, 0x36, 0xeb, 0xef,
-  0xea, 0xf4, 0x1b, 0xe1, 0xef, 0x19, 0xef, 0x03, 0x1a, 0x0d, 0x16, 0x1c,
-  0xdd, 0xe7, 0x06, 0x1a, 0xf4, 0xda, 0xf9, 0xec, 0xfe, 0x09, 0xc4, 0xf9,
-  0xf2, 0x16, 0xeb, 0x16, 0xbf, 0xff, 0xeb, 0xf8, 0xc3, 0x10, 0x60, 0x16,
-  0x16, 0x26, 0x1b, 0x2a, 0xc7, 0xf8, 0x10, 0x01, 0x1d, 0xe7, 0x09, 0x15,
-  0xfa, 0x07, 0x60, 0xfd, 0xfe, 0x50, 0xe3, 0xfe, 0x0c, 0x21, 0x27, 0xfc,
-  0xdd, 0x2f, 0xbf, 0x26, 0xef, 0xfd, 0xfc, 0x13, 0x26, 0x10, 0xf0, 0x2f,
-  0xf7, 0x6b, 0x3f, 0xf6, 0x14, 0xbe, 0xd7, 0x51, 0xe9, 0x06, 0xef, 0x25,
-  0xed, 0x20, 0xd7, 0xd4, 0xff, 0x0a, 0x94, 0x13, 0xed, 0xb6, 0xc2, 0xfd,
-  0xcb, 0xd5, 0x6b, 0xe8, 0x17, 0x59, 0x06, 0x0a, 0xbf, 0x00, 0xc7, 0x1b,
-  0x01, 0xe5, 0xf9, 0xdd, 0x00, 0x18, 0xf5, 0x08, 0xce, 0x15, 0xd4, 0xfb,
-  0x15, 0x13, 0x0e, 0x26, 0xa7, 0x20, 0x09, 0x39, 0xdb, 0xf2, 0x37, 0x14,
-  0x3a, 0xee, 0x22, 0xe3, 0x22, 0x14, 0xe0, 0xca, 0xe0, 0x18, 0x08, 0xf6,
-  0xeb, 0xe9, 0x37, 0xc8, 0x0e, 0x01, 0xce, 0xf5, 0x12, 0xfd, 0xeb, 0x16,
-  0xff, 0x10, 0xf3, 0xf6, 0xe5, 0xf0, 0x70, 0x0e, 0xf1, 0x3b, 0x3d, 0x20,
-  0xe5, 0x05, 0x1e, 0x11, 0x13, 0xf5, 0x19, 0x0f, 0xf6, 0x26, 0xec, 0x06,
-  0x12, 0xf7, 0xba, 0x00, 0x1f, 0xec, 0xf3, 0xf9, 0xf2, 0xf6, 0xde, 0x07,
-  0xea, 0x12, 0xe7, 0xdc, 0xd0, 0x00, 0xf7, 0x1a, 0xdd, 0xd7, 0xec, 0x23,
-  0x10, 0x50, 0x09, 0xc2, 0x1e, 0x03, 0x11, 0x03, 0x2d, 0xe6, 0xd8, 0xed,
-  0x1d, 0x5b, 0x1a, 0x02, 0x10, 0x00, 0x43, 0xa7, 0xf7, 0xf9, 0xf4, 0x31,
-  0x24, 0xe5, 0x20, 0xeb, 0x1b, 0xfb, 0x45, 0xdb, 0x0b, 0xfc, 0xd9, 0x0d,
-  0x06, 0xfa, 0x36, 0x4b, 0x31, 0x0d, 0x0f, 0x00, 0xf7, 0x1f, 0xf8, 0x05,
-  0x5a, 0x1b, 0xde, 0xef, 0xfb, 0x25, 0xbe, 0xef, 0xc4, 0x23, 0xdc, 0x2d,
-  0xfb, 0xf3, 0x14, 0xfa, 0xcc, 0x01, 0xc7, 0x08, 0x1c, 0x15, 0xf0, 0x28,
-  0x10, 0x02, 0xdc, 0xe0, 0xef, 0xd7, 0xe6, 0x0e, 0xe0, 0x14, 0x00, 0xe2,
-  0xc9, 0xee, 0xbc, 0x20, 0x0d, 0x00, 0xff, 0xca, 0x55, 0x15, 0xef, 0xfa,
-  0x15, 0xb7, 0xe7, 0xf7, 0x1e, 0x10, 0x04, 0x31, 0x23, 0xeb, 0xee, 0xff,
-  0x1b, 0xe1, 0x20, 0xff, 0x16, 0xf3, 0x08, 0x08, 0xef, 0x40, 0x33, 0x17,
-  0x02, 0x20, 0xf6, 0xe6, 0xec, 0x20, 0xf9, 0x10, 0xce, 0x42, 0x46, 0xcb,
-  0x07, 0x1b, 0xf6, 0x1e, 0xf7, 0xf3, 0xf3, 0xcd, 0x02, 0xc6, 0x09, 0xd0,
-  0xfc, 0x06, 0x4e, 0x0a, 0xed, 0x54, 0xe2, 0x0c, 0xf6, 0xf1, 0x33, 0xd2,
-  0x59, 0xf4, 0x23, 0x04, 0x1c, 0x09, 0xeb, 0x2a, 0x3d, 0xee, 0x09, 0x03,
-  0x0a, 0x02, 0xca, 0x18, 0x02, 0xf1, 0xeb, 0xf1, 0xf5, 0xe0, 0x1c, 0xe2,
-  0x25, 0x4f, 0x1f, 0xfc, 0xf9, 0x15, 0xfe, 0xd0, 0x1d, 0x04, 0xf2, 0x09,
-  0x1e, 0x13, 0xe5, 0x21, 0xfd, 0xff, 0x1e, 0xe9, 0xfd, 0xee, 0x2f, 0x04,
-  0x16, 0xfd, 0x03, 0xf1, 0x12, 0xf4, 0x49, 0xf4, 0xf0, 0xd2, 0x05, 0xd6,
-  0x13, 0xfc, 0x04, 0xf2, 0x0b, 0xcf, 0x33, 0xd8, 0xed, 0xfe, 0xf3, 0x1c,
-  0x3d, 0xff, 0x2f, 0x01, 0x16, 0xfa, 0xe6, 0xe2, 0xe0, 0xe7, 0xeb, 0x09,
-  0xdd, 0xe5, 0x16, 0x0c, 0xfc, 0x3c, 0x1a, 0x10, 0x02, 0xd6, 0xf6, 0xda,
-  0x0f, 0x16, 0x0d, 0x12, 0x05, 0xfc, 0x27, 0x12, 0xef, 0xe7, 0x11, 0xf1,
-  0xd3, 0xed, 0x02, 0x28, 0xf6, 0xd7, 0x00, 0x13, 0x27, 0xef, 0x2f, 0xf4,
-  0x02, 0x10, 0x07, 0xfb, 0x07, 0xf4, 0x0c, 0x03, 0xfb, 0xc7, 0x14, 0xe8,
-  0x18, 0x25, 0x0c, 0x0e, 0x1c, 0x06, 0x20, 0x1f, 0x0c, 0xec, 0xca, 0xd9,
-  0xed, 0xdf, 0x19, 0x18, 0x0b, 0xf0, 0x2d, 0x21, 0x02, 0xe0, 0xe9, 0x16,
-  0xeb, 0xd4, 0x2a, 0x36, 0x08, 0xd6, 0x06, 0x1f, 0x11, 0xf2, 0x17, 0xd5,
-  0x06, 0x05, 0xfc, 0x0c, 0xe8, 0x07, 0x0a, 0x19, 0x0a, 0xf6, 0xd6, 0x0d,
-  0x0c, 0xf6, 0xf8, 0x0f, 0x33, 0x04, 0xfe, 0x1b, 0xe3, 0xce, 0x0f, 0xee,
-  0xfd, 0xfb, 0xe1, 0xd8, 0xfb, 0xaf, 0xfc, 0xe2, 0x05, 0x2a, 0x2b, 0x81,
-  0x27, 0xfe, 0xd8, 0xf4, 0xef, 0xfd, 0x0f, 0x0b, 0x06, 0x0f, 0x01, 0xb5,
-  0x00, 0x0d, 0x01, 0x13, 0xd9, 0xfd, 0xec, 0xd1, 0xf1, 0xf0, 0xda, 0xf1,
-  0x10, 0xd9, 0xf8, 0xfd, 0x21, 0x4c, 0x12, 0xe6, 0xed, 0xdf, 0x11, 0xb9,
-  0x08, 0x14, 0x10, 0xff, 0x0a, 0xea, 0x07, 0xef, 0xf2, 0x10, 0xd5, 0xee,
-  0x13, 0x29, 0x0a, 0xd6, 0x21, 0xf2, 0x1d, 0xe0, 0xea, 0x9f, 0xe5, 0xda,
-  0xf5, 0xfc, 0x2e, 0x9e, 0x13, 0xf4, 0xed, 0x05, 0xf4, 0xff, 0xfe, 0x05,
-  0x15, 0x07, 0xf0, 0xda, 0xf0, 0x1c, 0xf3, 0x06, 0xfc, 0xef, 0xf6, 0xd6,
-  0xe4, 0xf3, 0xe8, 0xe3, 0x08, 0xf2, 0xff, 0x27, 0x23, 0x31, 0x15, 0xf8,
-  0xd0, 0xf1, 0x05, 0xeb, 0x11, 0xe3, 0xf5, 0xe6, 0x21, 0xf9, 0x3d, 0xea,
-  0xf8, 0xf0, 0xda, 0xcf, 0xea, 0x3f, 0xff, 0xdc, 0xf8, 0xf6, 0x0b, 0xea,
-  0x0d, 0xda, 0x11, 0xef, 0xf2, 0xfe, 0x1e, 0xa4, 0x0c, 0x03, 0xec, 0xf7,
-  0xe0, 0xfb, 0x0c, 0x1a, 0x18, 0xfd, 0xf7, 0x04, 0xee, 0xd9, 0x07, 0x1d,
-  0xfe, 0xf1, 0x0f, 0xfb, 0xf4, 0xef, 0xe1, 0x26, 0x12, 0xe2, 0x25, 0xf2,
-  0x0d, 0x20, 0xee, 0x18, 0xe9, 0x01, 0xd8, 0x2e, 0x1b, 0xe4, 0xde, 0xe0,
-  0xff, 0x11, 0x11, 0x18, 0x18, 0x0a, 0xdb, 0xfe, 0xd5, 0x1f, 0x0f, 0xd7,
-  0xfd, 0x0a, 0xe8, 0xff, 0x02, 0xd7, 0x2a, 0xc6, 0x16, 0x26, 0x10, 0xd8,
-  0x00, 0x15, 0xd0, 0xd9, 0xfa, 0x01, 0xd8, 0x1d, 0x07, 0x1c, 0x27, 0xe7,
-  0x01, 0xf8, 0xf5, 0xf2, 0xe2, 0xd1, 0xf0, 0xe0, 0x0a, 0xf8, 0xe3, 0xbf,
-  0x17, 0x10, 0xfa, 0xe6, 0xf6, 0x01, 0x00, 0xe0, 0xed, 0x18, 0x22, 0xfe,
-  0xd5, 0x23, 0xd5, 0x05, 0x16, 0x07, 0xc4, 0x0d, 0xe8, 0xf8, 0xe8, 0xf3,
-  0x1b, 0x44, 0x1a, 0xee, 0x3b, 0xfc, 0xe2, 0xde, 0xf1, 0xd1, 0xe5, 0x01,
-  0x0a, 0x3b, 0xfc, 0x12, 0xde, 0x1f, 0xea, 0xd7, 0xe1, 0xed, 0xd8, 0x0b,
-  0x0d, 0x16, 0xf5, 0x1c, 0xf5, 0xcd, 0xfd, 0xfe, 0xcf, 0xd1, 0xd9, 0xbf,
-  0x18, 0x18, 0xd6, 0xf5, 0x20, 0x10, 0x0e, 0x2c, 0x01, 0x17, 0x0f, 0xf1,
-  0xe7, 0x4f, 0x17, 0xe5, 0xd5, 0xe5, 0xeb, 0xd8, 0xfc, 0x41, 0x0e, 0xf8,
-  0xdd, 0x19, 0xf2, 0xf7, 0x1d, 0x1c, 0x11, 0xf3, 0x17, 0x1b, 0x02, 0x0e,
-  0x26, 0xd0, 0x14, 0x0a, 0x08, 0x15, 0xfa, 0x08, 0x14, 0x01, 0xea, 0xff,
-  0x0c, 0xe5, 0xeb, 0xe4, 0xde, 0x24, 0xee, 0xff, 0x1d, 0xe3, 0x05, 0x14,
-  0x0b, 0x00, 0x1b, 0xd8, 0x04, 0x16, 0xeb, 0xd5, 0xfe, 0xfb, 0x17, 0xf2,
-  0x10, 0xf0, 0xd2, 0x15, 0xe6, 0x38, 0x1d, 0x0e, 0x31, 0xcc, 0xe4, 0xd7,
-  0x19, 0x09, 0xda, 0x14, 0x24, 0xd0, 0x0d, 0x26, 0xff, 0x16, 0x25, 0x13,
-  0xe4, 0x18, 0xe7, 0x06, 0x42, 0x66, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x33, 0x0a, 0x00, 0x00, 0xf4, 0xe3, 0xff, 0xff, 0xe2, 0xcd, 0xfe, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+  0x03, 0x04, 0xf5, 0x2c, 0xfb, 0x35, 0xb7, 0xfc, 0xc4, 0x15, 0x14, 0x0d,
+  0xcb, 0xd6, 0x39, 0xd8, 0x0b, 0x31, 0xc1, 0x17, 0xe8, 0x25, 0x10, 0x1d,
+  0xf3, 0x81, 0xe7, 0x10, 0xac, 0x24, 0x1a, 0xcb, 0xe6, 0x07, 0x30, 0x08,
+  0x9e, 0xf7, 0xaf, 0xac, 0x8c, 0xe6, 0x0d, 0xee, 0xc2, 0xee, 0x36, 0x59,
+  0xc6, 0x0d, 0x7f, 0x07, 0x40, 0x1e, 0xc0, 0xd5, 0xad, 0x7a, 0x2e, 0x3a,
+  0x84, 0x17, 0x1b, 0x54, 0x49, 0x2a, 0xda, 0x81, 0xa8, 0xd6, 0x4f, 0x19,
+  0xb4, 0xeb, 0x03, 0xf0, 0xf3, 0x41, 0x07, 0x28, 0x00, 0xd7, 0x82, 0xbd,
+  0x0d, 0xdc, 0x42, 0x05, 0xe4, 0x37, 0x1e, 0x00, 0xa3, 0xcc, 0xd0, 0xc9,
+  0x27, 0xf6, 0xf6, 0xf5, 0x7f, 0xfd, 0x00, 0x39, 0x48, 0x9b, 0x06, 0xf8,
+  0x5a, 0xfa, 0xef, 0xcb, 0xfe, 0xf4, 0xff, 0x29, 0xc4, 0xdf, 0xe8, 0xed,
+  0xce, 0xc6, 0xf5, 0x1d, 0x5f, 0xfd, 0xe0, 0xd4, 0x3f, 0x02, 0x0a, 0x37,
+  0x72, 0x12, 0x81, 0xba, 0x2c, 0x1d, 0x3e, 0xdd, 0x19, 0xf9, 0x01, 0x8b,
+  0xb3, 0xf0, 0x14, 0x06, 0xdf, 0xf6, 0x20, 0xe2, 0x38, 0xa8, 0x1c, 0x20,
+  0xf5, 0xe2, 0xd4, 0xe7, 0xab, 0xfb, 0xa5, 0x20, 0xf5, 0xeb, 0x83, 0xd8,
+  0xfd, 0xfc, 0x2a, 0x11, 0xee, 0xf3, 0xfe, 0x81, 0x0a, 0x0c, 0xea, 0x24,
+  0xf1, 0x03, 0xf5, 0xe8, 0x05, 0xa8, 0xf9, 0xe2, 0xb6, 0x08, 0xdd, 0xd4,
+  0xa6, 0xf7, 0x07, 0x12, 0xe6, 0xff, 0x81, 0xd9, 0xff, 0xd0, 0x14, 0xd9,
+  0xde, 0xd1, 0xd8, 0xa6, 0xe8, 0x04, 0x2b, 0x22, 0x10, 0xeb, 0xfd, 0xe7,
+  0x57, 0xbf, 0x03, 0xf6, 0xbf, 0xf4, 0xff, 0xf9, 0xb4, 0x1f, 0x83, 0xd0,
+  0xf0, 0xd3, 0x8c, 0x0a, 0x4a, 0x2f, 0x0e, 0x0d, 0x7f, 0xea, 0x1f, 0x3b,
+  0xe0, 0x0d, 0x02, 0xbe, 0xd0, 0x15, 0xd8, 0x0e, 0x36, 0xb1, 0xf5, 0xf5,
+  0xb1, 0xf7, 0xfa, 0xa9, 0xff, 0xde, 0xb9, 0xf0, 0x52, 0x04, 0xe5, 0xff,
+  0xe4, 0x2b, 0x02, 0x24, 0x2c, 0xfc, 0xed, 0xa4, 0x13, 0xfc, 0xbe, 0x1f,
+  0x18, 0x2c, 0x03, 0xec, 0x10, 0x81, 0xec, 0xaf, 0x10, 0x2d, 0x1d, 0xf8,
+  0x31, 0xf5, 0xeb, 0xdd, 0x4b, 0xe2, 0xfd, 0x04, 0xe9, 0xd1, 0xc5, 0xc9,
+  0xf7, 0x12, 0x2f, 0x9c, 0x3d, 0x22, 0x0d, 0xd3, 0x0e, 0xa6, 0x7f, 0xdd,
+  0xbc, 0x07, 0x07, 0xaf, 0x06, 0x03, 0xe7, 0x8c, 0x15, 0xe0, 0x00, 0xda,
+  0x81, 0xfa, 0xf2, 0x26, 0x21, 0x4a, 0x42, 0x1d, 0xd1, 0x3c, 0x10, 0x0f,
+  0x4c, 0xea, 0x0c, 0xf1, 0x03, 0x31, 0x14, 0xb4, 0xc4, 0x04, 0xfa, 0x23,
+  0x82, 0x2b, 0xe9, 0x02, 0x9a, 0x0d, 0x08, 0x5e, 0x12, 0x04, 0x81, 0xd1,
+  0xcd, 0x2b, 0x4f, 0x00, 0xb4, 0xc7, 0x1a, 0xb5, 0xff, 0x45, 0xd7, 0x0e,
+  0x2a, 0x16, 0xcc, 0xfc, 0x7d, 0xbb, 0xf7, 0x3b, 0xa0, 0x2b, 0xf8, 0xe3,
+  0xc5, 0xff, 0xda, 0x43, 0x29, 0x24, 0xf3, 0xb3, 0xeb, 0x0c, 0x1a, 0xe1,
+  0xe3, 0xc5, 0x0d, 0xd6, 0x14, 0x0d, 0xcb, 0xf5, 0x37, 0x32, 0xe0, 0x31,
+  0x4d, 0x81, 0xf5, 0xd9, 0xf7, 0xea, 0x07, 0xbc, 0x02, 0xab, 0xd5, 0xab,
+  0xd8, 0xef, 0xdf, 0x11, 0xbd, 0xfc, 0x13, 0x27, 0x9b, 0xc2, 0xfb, 0xbe,
+  0xc2, 0x2d, 0xe8, 0x00, 0xf4, 0xec, 0x02, 0xe5, 0xce, 0x22, 0x61, 0xd4,
+  0x7f, 0xdc, 0xde, 0xb8, 0xe0, 0xfd, 0x2d, 0x26, 0x29, 0x2b, 0x81, 0x37,
+  0x6b, 0x01, 0x16, 0x26, 0x4e, 0x36, 0xf4, 0x9d, 0xc3, 0x37, 0x36, 0x02,
+  0x0b, 0x05, 0xbf, 0xe9, 0x55, 0x9f, 0x1b, 0x1c, 0xd3, 0x2b, 0xf3, 0xeb,
+  0x81, 0x3a, 0x22, 0xe2, 0xd7, 0xc5, 0xb6, 0x03, 0xbd, 0xe0, 0x26, 0x34,
+  0x04, 0x1c, 0xda, 0x39, 0xdd, 0xc2, 0x30, 0x0a, 0xe5, 0x0e, 0xf1, 0x0c,
+  0xdd, 0x33, 0x2c, 0x1b, 0x0e, 0xcc, 0xce, 0xdd, 0xe6, 0x1b, 0x33, 0x27,
+  0xf8, 0x18, 0xd4, 0xcd, 0x05, 0xfa, 0x0c, 0xd8, 0x01, 0xe5, 0xf9, 0x51,
+  0xdf, 0x2a, 0x7f, 0x18, 0xf0, 0xf4, 0x02, 0x2a, 0xc9, 0x22, 0x04, 0xef,
+  0xa6, 0xf9, 0x0f, 0xe7, 0xae, 0xe3, 0xdd, 0xe4, 0xf6, 0xff, 0x81, 0x44,
+  0xe4, 0xf0, 0x1b, 0x0f, 0xec, 0x17, 0xea, 0x9d, 0xf7, 0xf2, 0xe5, 0x1a,
+  0xf0, 0x19, 0x0d, 0x02, 0x1c, 0xaa, 0x39, 0xfa, 0x9e, 0xf2, 0xeb, 0xf4,
+  0xa1, 0x1c, 0x08, 0x34, 0xcf, 0xf4, 0x81, 0xd5, 0x27, 0x1c, 0xf2, 0x02,
+  0xc4, 0xf9, 0x1c, 0xd3, 0x2c, 0xe4, 0x46, 0xe3, 0x4b, 0x0c, 0xf0, 0x05,
+  0xf9, 0xbe, 0x26, 0xdc, 0xc1, 0x3f, 0x4e, 0x24, 0xce, 0xf9, 0x00, 0x4a,
+  0x10, 0x2a, 0xa8, 0xf5, 0x21, 0x02, 0x29, 0x05, 0x20, 0x1d, 0x1a, 0x81,
+  0xfe, 0xff, 0x11, 0x43, 0x10, 0xe2, 0x13, 0xf7, 0x3a, 0xfc, 0x0c, 0x07,
+  0xce, 0x0d, 0xe0, 0x15, 0x91, 0xfa, 0x1b, 0x39, 0x33, 0x0c, 0xbb, 0xe9,
+  0xf0, 0xb6, 0x21, 0x08, 0xf6, 0xfa, 0xff, 0x81, 0xd9, 0xe9, 0x04, 0x0b,
+  0xea, 0xd0, 0x07, 0xfd, 0x29, 0x02, 0x17, 0x28, 0x0e, 0xd3, 0x2c, 0xfc,
+  0x14, 0xe4, 0x28, 0x3b, 0xc0, 0x4d, 0x88, 0xca, 0x0e, 0xfb, 0x37, 0x59,
+  0xf4, 0x0d, 0xc3, 0xff, 0x81, 0xb2, 0xd9, 0xe3, 0xf4, 0x16, 0xe4, 0x15,
+  0xbd, 0xcf, 0x19, 0xf9, 0x4d, 0xfd, 0x93, 0xe6, 0xa7, 0xf7, 0x17, 0x3a,
+  0xd6, 0x04, 0x81, 0xdb, 0x16, 0xef, 0xfe, 0xc5, 0x25, 0x02, 0xe3, 0xb7,
+  0xc9, 0x09, 0x51, 0xe9, 0x32, 0x10, 0xd2, 0x29, 0xe0, 0xf9, 0x31, 0xbe,
+  0xcd, 0xfc, 0xfc, 0xf2, 0xc9, 0xd6, 0xf5, 0xc3, 0x0f, 0xf2, 0xe2, 0x41,
+  0x91, 0xb8, 0x30, 0xd6, 0xe1, 0x24, 0xfc, 0x81, 0x07, 0x08, 0x04, 0xeb,
+  0xf6, 0xc8, 0x31, 0x06, 0x65, 0x75, 0x45, 0x31, 0x0f, 0x21, 0xe4, 0x04,
+  0xaa, 0x29, 0xe4, 0x3c, 0x07, 0xfb, 0x81, 0xbd, 0xc3, 0xe7, 0x24, 0xf5,
+  0xb1, 0xfe, 0x13, 0xd2, 0x01, 0x27, 0x14, 0xf8, 0x05, 0x16, 0x21, 0xf2,
+  0x08, 0xe9, 0x05, 0x1c, 0x97, 0x05, 0xcc, 0xd2, 0xcf, 0xd9, 0xc8, 0xe7,
+  0xb3, 0x32, 0x7a, 0xff, 0xdd, 0x14, 0x2c, 0x2a, 0xcb, 0x00, 0xf9, 0x81,
+  0xe7, 0xea, 0xd7, 0x10, 0x1a, 0xe5, 0xe6, 0xeb, 0xee, 0x2d, 0xf8, 0x06,
+  0xc9, 0x0d, 0x24, 0x1c, 0xe0, 0xf6, 0xfd, 0x05, 0x0d, 0x0d, 0xbf, 0xe2,
+  0x06, 0xe0, 0x1a, 0xf1, 0xe8, 0x0f, 0xdf, 0x81, 0x06, 0xfb, 0x05, 0x21,
+  0xff, 0xe9, 0x29, 0x00, 0x6b, 0xd2, 0xf6, 0xfd, 0xcd, 0x08, 0x04, 0xf9,
+  0xab, 0xb4, 0x81, 0x28, 0xe4, 0xf1, 0xc9, 0xf9, 0xd3, 0xf4, 0x68, 0x0d,
+  0xcd, 0xf9, 0xfc, 0x8e, 0xff, 0x30, 0xb3, 0x17, 0x37, 0x0e, 0xd1, 0x05,
+  0xdf, 0xb5, 0xe7, 0xd9, 0xbd, 0x06, 0xaa, 0x81, 0xc1, 0x0a, 0xdb, 0x08,
+  0xf2, 0xfe, 0xce, 0xd8, 0xbf, 0xff, 0xfc, 0x3a, 0xec, 0x08, 0xed, 0x81,
+  0x1b, 0x07, 0xa8, 0x30, 0xfc, 0x4b, 0xc2, 0x25, 0xe2, 0xb8, 0x05, 0xd8,
+  0x94, 0x2b, 0xf1, 0xf4, 0xe4, 0xd9, 0xf6, 0xbd, 0xd2, 0x96, 0x36, 0xe0,
+  0x79, 0x55, 0xfd, 0x8e, 0x32, 0x22, 0xd0, 0x06, 0xdf, 0xbb, 0xc3, 0xcd,
+  0xf6, 0xe3, 0x36, 0xbb, 0x14, 0x68, 0x45, 0xeb, 0x05, 0xc0, 0xd1, 0x81,
+  0x81, 0x08, 0xff, 0xfb, 0xf9, 0xfb, 0xb9, 0xed, 0x06, 0xc8, 0x0b, 0xe4,
+  0xbf, 0xce, 0xc5, 0x91, 0xef, 0xe8, 0x37, 0xf0, 0x29, 0x05, 0xe6, 0xfd,
+  0xcc, 0xe7, 0x2b, 0x15, 0xe9, 0xd9, 0x2a, 0xfb, 0x98, 0x1b, 0xdc, 0x33,
+  0xce, 0x01, 0x81, 0xd7, 0x1d, 0x2d, 0xe4, 0xfb, 0xf8, 0xfa, 0xd2, 0x8b,
+  0xc2, 0xd6, 0xe0, 0x17, 0x08, 0x35, 0x1d, 0x16, 0x16, 0xc5, 0xfe, 0xda,
+  0xea, 0x30, 0x41, 0xe7, 0xd5, 0xe2, 0xdd, 0x25, 0xcc, 0x32, 0xdd, 0xe6,
+  0x06, 0xe1, 0x0e, 0x7f, 0xcf, 0xfa, 0xd7, 0xbc, 0xd0, 0xc7, 0xdc, 0x2a,
+  0x0a, 0x1b, 0xef, 0x01, 0x2a, 0x9c, 0x1a, 0xfe, 0xd3, 0xd9, 0xe5, 0x34,
+  0xf4, 0xe0, 0xf3, 0xaf, 0xd0, 0x29, 0x81, 0xd9, 0x10, 0x00, 0x0a, 0x39,
+  0xc3, 0xda, 0xe9, 0x26, 0xed, 0x11, 0xc1, 0xf2, 0xec, 0xf5, 0x06, 0xfe,
+  0xe2, 0x9f, 0x2a, 0x02, 0xcf, 0x10, 0x26, 0x54, 0x57, 0x3c, 0xb5, 0xf0,
+  0x01, 0xa2, 0x7f, 0x82, 0xef, 0xb4, 0xf2, 0xd2, 0xcd, 0x8a, 0xf5, 0x4d,
+  0xb4, 0xb8, 0x82, 0xaa, 0xf9, 0x9c, 0x59, 0x24, 0xae, 0x34, 0xd9, 0xb6,
+  0x5a, 0xcd, 0xe3, 0x50, 0xd6, 0xea, 0x12, 0xd9, 0xe5, 0xf1, 0xae, 0xf1,
+  0xde, 0xea, 0x00, 0x07, 0xf5, 0x23, 0xf4, 0xe8, 0x08, 0x0d, 0xb4, 0x14,
+  0xf3, 0xfb, 0xf7, 0x01, 0x36, 0x81, 0x07, 0xd3, 0xcd, 0xe2, 0xff, 0x04,
+  0xf7, 0xf2, 0xcb, 0x54, 0x12, 0x25, 0xc8, 0xa6, 0xef, 0x37, 0x06, 0xff,
+  0xc5, 0xdd, 0x0b, 0xbd, 0xa6, 0x44, 0xe5, 0xe5, 0x40, 0xe9, 0x23, 0x22,
+  0x7f, 0xb5, 0xf0, 0xf4, 0xa5, 0xf1, 0x1c, 0xe7, 0xa4, 0x04, 0x9d, 0x18,
+  0xc4, 0xfd, 0x9d, 0xf8, 0x38, 0x4b, 0xe7, 0x40, 0xe5, 0xf8, 0x03, 0xf9,
+  0x13, 0x13, 0x9b, 0xff, 0xfe, 0x26, 0xfb, 0xee, 0xfa, 0x81, 0x45, 0xe6,
+  0xd4, 0x29, 0xf4, 0xdd, 0xfb, 0xa0, 0xfb, 0xc2, 0xa6, 0xd6, 0xe9, 0x2f,
+  0x29, 0x81, 0x12, 0xcc, 0xeb, 0x0d, 0xce, 0xc2, 0x00, 0x36, 0xe8, 0xf3,
+  0xff, 0x02, 0xf2, 0xb2, 0xba, 0xe4, 0x4e, 0xf9, 0x3c, 0x13, 0xe6, 0x1f,
+  0xe0, 0xf7, 0xe4, 0x0a, 0xb9, 0x1e, 0x81, 0x16, 0x31, 0x31, 0xf1, 0x3d,
+  0xd7, 0x0d, 0xfe, 0x26, 0x07, 0xe9, 0x24, 0x2f, 0x00, 0x26, 0xeb, 0x0e,
+  0x08, 0x93, 0x1c, 0xd8, 0x95, 0x1f, 0x20, 0x0f, 0x14, 0x20, 0x47, 0x38,
+  0x4b, 0x17, 0xe7, 0xfe, 0x48, 0x19, 0xff, 0xf7, 0x54, 0xfa, 0xf5, 0xb1,
+  0xe0, 0x20, 0xf4, 0x08, 0xf9, 0xe1, 0x11, 0x1a, 0x5b, 0x81, 0x01, 0xd8,
+  0x1c, 0x18, 0x02, 0xd3, 0xc0, 0xb3, 0xde, 0x7f, 0xad, 0x1d, 0xc8, 0x1f,
+  0x0c, 0x10, 0x05, 0x04, 0xbe, 0xcf, 0x0a, 0x95, 0x15, 0x21, 0xca, 0x2d,
+  0x08, 0x1b, 0xda, 0xf0, 0xd2, 0xe2, 0xff, 0xc7, 0xc3, 0x5f, 0xe4, 0xc5,
+  0xc1, 0xf7, 0xf8, 0xff, 0xea, 0xdb, 0x81, 0xc1, 0xcd, 0xed, 0x09, 0xcf,
+  0xdf, 0xdf, 0xf2, 0x0e, 0x25, 0xc9, 0x35, 0x19, 0x4f, 0x2b, 0x49, 0xf4,
+  0x3f, 0xbc, 0x22, 0xd7, 0xb3, 0xdf, 0x12, 0x05, 0x92, 0x02, 0x93, 0xe3,
+  0xba, 0xf3, 0xee, 0x18, 0x38, 0xdd, 0x1c, 0x20, 0xbe, 0x2a, 0xab, 0x97,
+  0x0d, 0x44, 0xb1, 0x3f, 0xce, 0x68, 0x9e, 0x1a, 0xcb, 0x81, 0xf7, 0xce,
+  0x95, 0x14, 0xf3, 0xd0, 0xe0, 0x04, 0xf6, 0x38, 0x13, 0x2d, 0x81, 0xb4,
+  0x12, 0x1c, 0x22, 0x08, 0xc9, 0x05, 0xf6, 0x85, 0xb6, 0x4e, 0xfa, 0xea,
+  0x0f, 0xfe, 0x02, 0x0c, 0x50, 0xf6, 0xf4, 0xfd, 0xe3, 0x07, 0x13, 0x11,
+  0x3c, 0x14, 0xfa, 0xb6, 0xf0, 0x0d, 0x26, 0x03, 0xc5, 0x09, 0xf4, 0x06,
+  0x0c, 0x1e, 0x35, 0x2a, 0x2a, 0xfb, 0x81, 0x0b, 0xe2, 0xe5, 0x12, 0x1c,
+  0x2f, 0xf9, 0xcd, 0x08, 0xd8, 0xe3, 0x01, 0x0f, 0x81, 0xfe, 0xef, 0xc4,
+  0xf2, 0xed, 0xa8, 0xc7, 0x26, 0x01, 0xb6, 0xfe, 0xe7, 0xe6, 0xe5, 0xa0,
+  0x9f, 0xfe, 0x20, 0xce, 0x03, 0xe7, 0xf7, 0x2b, 0x66, 0xad, 0xf4, 0xd9,
+  0xc9, 0xdf, 0x54, 0x15, 0xc4, 0xd8, 0x66, 0x35, 0xb9, 0x30, 0xa4, 0x18,
+  0xe4, 0xde, 0xee, 0xde, 0xf4, 0xd7, 0xde, 0xb2, 0xf3, 0xf7, 0x19, 0xd5,
+  0x08, 0x39, 0xdb, 0x14, 0xb9, 0xa8, 0x1c, 0x9c, 0xdd, 0x1b, 0x7f, 0x06,
+  0xdf, 0xfb, 0x26, 0xd9, 0xb5, 0x0d, 0x4b, 0xf7, 0x19, 0xec, 0xf3, 0x3b,
+  0xe6, 0x30, 0xf9, 0x81, 0xfb, 0x2d, 0x0e, 0x15, 0x39, 0x11, 0xbe, 0xe6,
+  0xa4, 0x7d, 0x09, 0x34, 0xe3, 0x71, 0x00, 0x58, 0x02, 0x2a, 0x30, 0xbb,
+  0x32, 0xa5, 0x27, 0x25, 0xfe, 0xa8, 0xf3, 0xc9, 0x25, 0xec, 0xe6, 0x0a,
+  0xd9, 0x07, 0x20, 0x1f, 0xb6, 0xba, 0x32, 0xf1, 0x93, 0x7f, 0xd7, 0x05,
+  0x19, 0xde, 0xa8, 0xea, 0x8a, 0xba, 0xfe, 0x66, 0xc1, 0x17, 0x8d, 0xce,
+  0xba, 0x1c, 0x13, 0x2a, 0x09, 0xb8, 0x33, 0xc0, 0x16, 0x1c, 0xe5, 0x5d,
+  0xee, 0x46, 0x9c, 0x00, 0x42, 0x9a, 0x09, 0xf8, 0x81, 0x07, 0xb5, 0xe2,
+  0xdc, 0xe6, 0x02, 0x07, 0x4b, 0x04, 0xb8, 0xe4, 0x9c, 0x0c, 0x31, 0x28,
+  0xd2, 0x0f, 0xfe, 0x99, 0x92, 0x17, 0xdc, 0x27, 0x1a, 0x0d, 0x1a, 0xbc,
+  0x68, 0xb6, 0x14, 0xb8, 0x81, 0x10, 0x13, 0x3e, 0x8b, 0x31, 0xb8, 0x2d,
+  0xce, 0xde, 0x81, 0xf8, 0xff, 0x32, 0x39, 0x03, 0xa1, 0xc0, 0xd1, 0xff,
+  0x22, 0x03, 0x29, 0x19, 0xf6, 0x28, 0x17, 0xfd, 0x50, 0xa8, 0x28, 0x00,
+  0xb0, 0x10, 0xcc, 0xbd, 0xc8, 0xee, 0x10, 0xee, 0x0b, 0xfa, 0x20, 0xdd,
+  0xbb, 0xe0, 0x20, 0x04, 0xd0, 0x25, 0xde, 0x81, 0xcc, 0xfe, 0xb4, 0xd4,
+  0x15, 0xe5, 0x28, 0x00, 0xe6, 0xf8, 0x0e, 0xae, 0xc2, 0x21, 0xc9, 0xd3,
+  0x92, 0xd4, 0x9a, 0xe9, 0xfd, 0xd2, 0x81, 0xb1, 0x21, 0xe4, 0xf8, 0xc5,
+  0xbd, 0x8c, 0xa9, 0x87, 0x9f, 0xf1, 0x14, 0xf4, 0xfb, 0x03, 0xeb, 0xfd,
+  0xcb, 0x97, 0xfc, 0xe4, 0x1e, 0xe7, 0x4b, 0x02, 0xbe, 0xef, 0xee, 0xec,
+  0xe2, 0x02, 0xec, 0xe2, 0xe3, 0xf1, 0x1a, 0xf8, 0xc1, 0xe8, 0xd6, 0x81,
+  0xe2, 0xf3, 0xf6, 0xf4, 0x27, 0x0c, 0x27, 0xea, 0x1f, 0xd4, 0x17, 0xd4,
+  0xdb, 0xf1, 0x21, 0xde, 0xe4, 0xe8, 0xf1, 0x08, 0xfb, 0x0e, 0xdf, 0xfa,
+  0x3c, 0x20, 0x18, 0x3f, 0xe4, 0x16, 0x05, 0xf2, 0x2a, 0xfd, 0xff, 0x11,
+  0x0b, 0x2e, 0xff, 0x01, 0x2f, 0x81, 0x12, 0xd2, 0xd6, 0xfa, 0x2a, 0x07,
+  0xdc, 0x04, 0xbc, 0xb2, 0x8f, 0x51, 0xb0, 0xe0, 0x49, 0x41, 0xf3, 0x7f,
+  0xe3, 0x1f, 0xdc, 0xc2, 0xa1, 0x76, 0x2f, 0x05, 0x04, 0x24, 0xef, 0x2f,
+  0xff, 0x8e, 0xdc, 0xc7, 0x05, 0x63, 0x49, 0xec, 0xbe, 0xdd, 0xb8, 0x73,
+  0x13, 0x0d, 0xbd, 0xbd, 0xd1, 0x36, 0x51, 0x44, 0xb1, 0xda, 0x0d, 0x94,
+  0x1f, 0x3d, 0xe4, 0xf9, 0x44, 0x55, 0xb8, 0x03, 0x3e, 0x81, 0xf9, 0x04,
+  0x9c, 0x48, 0x01, 0xfd, 0xbf, 0xc4, 0x25, 0x5a, 0xe2, 0x1d, 0x81, 0xf2,
+  0xd6, 0xfc, 0x34, 0xec, 0xf5, 0xd9, 0x23, 0xf8, 0x1b, 0x00, 0x19, 0x30,
+  0x23, 0x0a, 0xf5, 0x10, 0x3e, 0x86, 0xfb, 0xce, 0x97, 0x08, 0xf1, 0xe1,
+  0x69, 0xf3, 0xed, 0xb7, 0x52, 0xcb, 0x61, 0xca, 0xe8, 0xa0, 0x04, 0xe3,
+  0xcd, 0x1d, 0xdb, 0x81, 0x07, 0x08, 0xc7, 0xcc, 0x07, 0xb1, 0x3e, 0xec,
+  0xbd, 0x12, 0xf2, 0xe8, 0x7d, 0xde, 0x03, 0xc1, 0x98, 0x90, 0x29, 0xea,
+  0x98, 0x22, 0xf4, 0xe9, 0x93, 0xd1, 0x1a, 0xd2, 0xad, 0x03, 0x00, 0x0e,
+  0x22, 0x81, 0x5d, 0xfb, 0x0e, 0x03, 0x0b, 0xcc, 0xa9, 0x76, 0x3c, 0x22,
+  0xce, 0x01, 0xbf, 0x20, 0xe6, 0xc2, 0xf5, 0xfe, 0xdf, 0x16, 0x93, 0xe0,
+  0x56, 0xc6, 0x0c, 0xeb, 0xf9, 0x10, 0xcf, 0x94, 0x07, 0xf9, 0xcc, 0x3b,
+  0xf7, 0xc3, 0x08, 0xef, 0xe7, 0x81, 0x07, 0x1f, 0xbb, 0x01, 0x43, 0x0a,
+  0xe2, 0xef, 0x4a, 0xe7, 0xe7, 0xe7, 0x97, 0x07, 0xcc, 0xe1, 0x0c, 0xdc,
+  0xdd, 0x1d, 0x1c, 0x81, 0x28, 0xca, 0x18, 0xe3, 0x0f, 0x16, 0x5f, 0x02,
+  0x59, 0xd5, 0x3f, 0xe1, 0x97, 0xf4, 0x24, 0xcf, 0xf2, 0xd5, 0xfe, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00,
+  0xc3, 0xf1, 0xee, 0xf6, 0xc2, 0x4b, 0x2b, 0x17, 0xff, 0x27, 0xb9, 0x1c,
+  0x0f, 0xe9, 0x2f, 0xd8, 0xfa, 0x17, 0xf0, 0x1f, 0x00, 0xd3, 0x4c, 0x10,
+  0xd7, 0xde, 0xed, 0xff, 0xc2, 0xc2, 0xc8, 0xba, 0x0b, 0x2c, 0xdd, 0x3d,
+  0xe2, 0xcc, 0xc9, 0xf4, 0x0e, 0xe4, 0x04, 0xf5, 0xec, 0x23, 0x21, 0xfd,
+  0x3d, 0x0f, 0x63, 0xf3, 0x12, 0x1e, 0x3f, 0x1a, 0xc7, 0xd7, 0x13, 0x21,
+  0xf4, 0xb8, 0xed, 0x14, 0x1a, 0xfa, 0x14, 0xd1, 0xfe, 0x17, 0x1c, 0x00,
+  0xfc, 0x03, 0xe5, 0x12, 0x51, 0xdd, 0xde, 0xb1, 0xe5, 0x0e, 0xf1, 0x0e,
+  0x2d, 0xf7, 0x7f, 0x10, 0x16, 0xdd, 0xfd, 0xfc, 0xe6, 0xa4, 0x29, 0xf7,
+  0x09, 0xff, 0xc3, 0x35, 0xe0, 0x1a, 0xe4, 0x1b, 0x04, 0x07, 0x06, 0x07,
+  0xeb, 0x1d, 0x14, 0x20, 0x2c, 0xde, 0x57, 0x02, 0xe7, 0x4f, 0x3c, 0x0f,
+  0x09, 0xef, 0xec, 0xfe, 0xf2, 0xa5, 0xfc, 0xef, 0x1d, 0xfe, 0x17, 0xfb,
+  0xd2, 0xe1, 0x35, 0x07, 0x06, 0xec, 0x10, 0xe3, 0x72, 0xe3, 0xd9, 0xc7,
+  0xdf, 0xef, 0xe1, 0xb9, 0x2d, 0x39, 0x30, 0x0d, 0x32, 0xfd, 0xf5, 0xe0,
+  0xe6, 0xd7, 0xfb, 0x0d, 0x31, 0xe2, 0x1c, 0x4f, 0xfb, 0xd2, 0xcc, 0xe7,
+  0xd3, 0xe1, 0x1e, 0xfc, 0x19, 0x25, 0x2d, 0xf9, 0x13, 0xe3, 0x1e, 0xec,
+  0x1d, 0x1f, 0xc7, 0xfc, 0x0d, 0x08, 0xf8, 0xdd, 0xca, 0xcd, 0x2c, 0x15,
+  0xcf, 0xfb, 0x2f, 0xc6, 0xcb, 0x37, 0x45, 0x34, 0xcc, 0x29, 0xf6, 0x24,
+  0xf7, 0xe5, 0x1f, 0xe6, 0x03, 0x0f, 0xd4, 0x17, 0x0f, 0x08, 0xf0, 0x3e,
+  0xb6, 0xfc, 0xb2, 0x01, 0xf5, 0xf7, 0xdb, 0xca, 0xee, 0x0e, 0x0f, 0xfc,
+  0xeb, 0xec, 0xdb, 0x18, 0x07, 0xfe, 0xe0, 0xf9, 0x21, 0x09, 0x26, 0x2e,
+  0x4f, 0xfc, 0xc3, 0x13, 0x09, 0x1d, 0x60, 0x16, 0xda, 0xff, 0xd3, 0x13,
+  0xfd, 0x0c, 0x00, 0xfc, 0xed, 0xcf, 0x02, 0xbc, 0xe7, 0x2e, 0x2e, 0xfb,
+  0xcf, 0xf1, 0xf8, 0x1a, 0x07, 0xe5, 0x0c, 0x07, 0xeb, 0x24, 0xeb, 0xfb,
+  0x21, 0xf2, 0x13, 0x05, 0x09, 0xea, 0xfe, 0xfd, 0xec, 0xef, 0x07, 0x06,
+  0x0d, 0xf3, 0xc3, 0x25, 0xd8, 0x1d, 0xe2, 0x07, 0xfb, 0x1d, 0xec, 0x19,
+  0xeb, 0xf9, 0xef, 0x16, 0x1b, 0xf9, 0xe0, 0x01, 0x18, 0x01, 0x32, 0xf8,
+  0xd6, 0x03, 0xe5, 0x24, 0x05, 0x05, 0xdf, 0x05, 0xc4, 0xd6, 0x11, 0xe0,
+  0xf8, 0x2c, 0x02, 0xef, 0x02, 0x08, 0x05, 0x1a, 0x6f, 0xec, 0xfb, 0xd0,
+  0xf2, 0xbf, 0xd4, 0xf5, 0xbc, 0x19, 0x2b, 0xe4, 0x06, 0xd1, 0x06, 0x2e,
+  0x0a, 0x37, 0xe0, 0x13, 0xfa, 0xea, 0xfd, 0x2f, 0xf9, 0x1e, 0x16, 0xe4,
+  0xe8, 0x32, 0x28, 0x17, 0xf5, 0xf8, 0xed, 0xfa, 0x17, 0xf1, 0x02, 0x03,
+  0x2d, 0xba, 0x04, 0xed, 0xdd, 0x2b, 0x07, 0x2a, 0xf4, 0xde, 0x0d, 0xde,
+  0xeb, 0x01, 0xf4, 0x37, 0xfe, 0xf4, 0x47, 0x1c, 0xed, 0xef, 0xf5, 0xdc,
+  0xc5, 0x0d, 0xea, 0x07, 0xff, 0x37, 0xec, 0xf8, 0x3a, 0x54, 0xa7, 0x2d,
+  0x0f, 0x23, 0xeb, 0x69, 0xd0, 0xf1, 0xfd, 0xf8, 0xe7, 0x0b, 0x1e, 0xf5,
+  0x01, 0x1b, 0xa6, 0x1d, 0xe4, 0xec, 0x10, 0x34, 0x40, 0x03, 0xe5, 0x28,
+  0xef, 0x0d, 0xf2, 0x3c, 0x0d, 0xf6, 0x2b, 0x03, 0xf3, 0x2a, 0xde, 0xef,
+  0x07, 0xfb, 0xb2, 0xe7, 0x09, 0xd4, 0x03, 0x03, 0xd1, 0xde, 0x12, 0xd1,
+  0xed, 0xcc, 0x08, 0xd9, 0xf7, 0x30, 0x0f, 0x3f, 0xfd, 0x1d, 0xf6, 0xc9,
+  0xfd, 0x16, 0xe2, 0x09, 0xf2, 0x08, 0x06, 0x2e, 0xb8, 0xf8, 0x07, 0x21,
+  0x01, 0xd0, 0xec, 0xe6, 0x22, 0xf9, 0xe4, 0x3c, 0xcf, 0xf5, 0x1e, 0xdb,
+  0x29, 0x03, 0xf9, 0x1e, 0xea, 0x01, 0xf0, 0x05, 0xd7, 0xbd, 0x29, 0x00,
+  0xc8, 0x13, 0xf3, 0xfa, 0x00, 0x06, 0x02, 0xc5, 0xed, 0xe4, 0xf2, 0xf0,
+  0xbb, 0x22, 0xc8, 0xdc, 0xff, 0x31, 0x0c, 0x02, 0x0f, 0x7c, 0x25, 0x6a,
+  0xfb, 0x04, 0xf1, 0x14, 0xce, 0xce, 0x22, 0x0e, 0xe9, 0x0a, 0xf1, 0x1f,
+  0xd8, 0x07, 0x06, 0x35, 0xfd, 0x14, 0xca, 0xdf, 0x7a, 0x25, 0x1f, 0x27,
+  0x3f, 0x29, 0xff, 0xbe, 0xda, 0xe4, 0xda, 0xdb, 0xfb, 0xee, 0xe6, 0xef,
+  0xcf, 0xa7, 0x35, 0xe6, 0xea, 0x17, 0xe7, 0xef, 0x42, 0x12, 0x56, 0xc3,
+  0xa6, 0x06, 0x15, 0x12, 0x13, 0xd8, 0xe7, 0x15, 0x3a, 0xc8, 0x20, 0xf0,
+  0xce, 0x19, 0xc5, 0x09, 0xf1, 0x05, 0x52, 0xf1, 0xd4, 0x36, 0x19, 0x05,
+  0xee, 0xf9, 0x66, 0xee, 0xf2, 0x23, 0x43, 0x1b, 0xdc, 0xdb, 0xf9, 0xe5,
+  0xfb, 0xec, 0xc4, 0x3d, 0x29, 0x14, 0xd1, 0xd7, 0xc8, 0x02, 0xe5, 0xff,
+  0xe7, 0xd3, 0xab, 0xde, 0xcf, 0xec, 0x21, 0xc7, 0x07, 0xed, 0xe6, 0x0c,
+  0x30, 0x1e, 0x08, 0xfa, 0x08, 0x4c, 0x3e, 0x0b, 0xf3, 0xcc, 0xe5, 0xf2,
+  0x28, 0x03, 0xb4, 0xeb, 0xdc, 0xf7, 0xea, 0xfe, 0x33, 0x22, 0x1c, 0x1a,
+  0x1e, 0xff, 0x18, 0x24, 0x0d, 0x24, 0xde, 0xc3, 0x1a, 0x2d, 0x07, 0x13,
+  0xfe, 0x27, 0xb8, 0xdd, 0x11, 0x24, 0xd9, 0x1d, 0x4e, 0xf8, 0xf1, 0x0e,
+  0xff, 0xfe, 0xf8, 0xd6, 0x03, 0xee, 0xc2, 0x41, 0x1f, 0xe6, 0xca, 0xe2,
+  0xe6, 0x07, 0xfb, 0xf0, 0xd9, 0x21, 0xeb, 0xf8, 0x22, 0x08, 0x41, 0xd0,
+  0xc2, 0x9c, 0x01, 0xd9, 0x01, 0xee, 0xd9, 0x25, 0x02, 0x08, 0xdf, 0xf4,
+  0x39, 0x32, 0x18, 0xd5, 0x2b, 0x15, 0x23, 0x06, 0x24, 0x42, 0xa4, 0xf3,
+  0x31, 0xdf, 0x36, 0xb5, 0xfb, 0x18, 0xf3, 0xdd, 0x03, 0xf4, 0xd4, 0x29,
+  0x05, 0xf9, 0x1a, 0x0a, 0xdf, 0xce, 0x1d, 0xf2, 0xfc, 0x03, 0xc8, 0x2d,
+  0x2e, 0xf8, 0xc4, 0x0e, 0xee, 0x05, 0x04, 0x0b, 0x01, 0xd4, 0xdc, 0xfb,
+  0xd4, 0x17, 0xe5, 0xee, 0x37, 0x32, 0x34, 0x22, 0x0f, 0x01, 0xfc, 0xf1,
+  0x24, 0x06, 0xe7, 0x2b, 0xee, 0xc9, 0x4a, 0x1e, 0xd5, 0xe9, 0x0d, 0x13,
+  0xf6, 0xd5, 0x55, 0x36, 0xd3, 0x45, 0x52, 0xdc, 0x24, 0x05, 0xdc, 0x23,
+  0x21, 0xfd, 0x07, 0x0f, 0xe7, 0xc6, 0xd0, 0xe0, 0xf1, 0xea, 0xea, 0xc5,
+  0x0f, 0x0d, 0xde, 0x23, 0xe1, 0x28, 0x36, 0xdf, 0xeb, 0x06, 0xfe, 0xe8,
+  0xe8, 0xf0, 0x0b, 0xff, 0xfa, 0x26, 0xc3, 0xef, 0x2f, 0xf1, 0x0c, 0x13,
+  0xfb, 0x25, 0xef, 0xc6, 0xff, 0x1d, 0x35, 0xef, 0x31, 0x05, 0x3a, 0x3f,
+  0xf7, 0xe9, 0x02, 0x30, 0xe1, 0xf0, 0xea, 0x22, 0xfa, 0x61, 0x1e, 0xe5,
+  0x1e, 0x19, 0xd9, 0x02, 0x1b, 0x00, 0xe0, 0x0a, 0x02, 0xe6, 0xb1, 0x0d,
+  0x0b, 0xfe, 0xba, 0xad, 0xf1, 0xf8, 0x3c, 0x2f, 0x27, 0xe7, 0xf4, 0xf5,
+  0xb7, 0xe8, 0x0f, 0xe8, 0x00, 0xec, 0xe9, 0x14, 0xee, 0x0a, 0x20, 0xe7,
+  0x16, 0xdb, 0x01, 0xfc, 0xc5, 0xba, 0x1c, 0x23, 0x13, 0x2e, 0x15, 0x14,
+  0x58, 0xf7, 0x0e, 0x38, 0xd4, 0x25, 0x18, 0x1a, 0x10, 0xf1, 0xbd, 0x0a,
+  0x0e, 0x1e, 0x68, 0x64, 0xf4, 0xdb, 0xfe, 0xcb, 0xe9, 0x02, 0xd5, 0x14,
+  0xb3, 0x11, 0xc1, 0x01, 0x07, 0xad, 0xe5, 0x16, 0x1d, 0x31, 0xe0, 0xf3,
+  0x1b, 0xf0, 0xca, 0x17, 0xbb, 0x30, 0xf9, 0xed, 0xdb, 0x0c, 0xe7, 0x32,
+  0xbf, 0xb7, 0xb6, 0xe6, 0x2e, 0xfb, 0x5a, 0x1a, 0x00, 0x18, 0xf7, 0xc1,
+  0x22, 0xc8, 0xeb, 0x03, 0xda, 0xcc, 0x7f, 0x1d, 0x03, 0xee, 0x0f, 0xe7,
+  0x35, 0xe8, 0x28, 0x5c, 0xd3, 0x29, 0xe0, 0xe8, 0x11, 0xec, 0xe3, 0xea,
+  0x26, 0x0f, 0x70, 0x1e, 0x02, 0xa7, 0xfd, 0xf2, 0xc1, 0x27, 0x13, 0x1d,
+  0xf8, 0xfe, 0x15, 0x43, 0xeb, 0xff, 0x00, 0x20, 0x0f, 0xa0, 0xf4, 0xee,
+  0x99, 0xa3, 0xc5, 0xee, 0xfc, 0x09, 0xdd, 0x13, 0x38, 0xed, 0x39, 0x30,
+  0xef, 0x1c, 0xf9, 0xd3, 0x11, 0xc9, 0xf0, 0xfb, 0x3d, 0xd7, 0x59, 0x47,
+  0xfd, 0x0f, 0x13, 0xed, 0x19, 0x10, 0x08, 0x1f, 0x11, 0xf6, 0xcf, 0xf8,
+  0xff, 0x13, 0x0a, 0xd5, 0x22, 0x2b, 0xd8, 0x04, 0x0e, 0xc9, 0xbf, 0xb5,
+  0x11, 0x10, 0xd8, 0xfc, 0x3c, 0xf3, 0x0d, 0x30, 0x63, 0xe9, 0xde, 0x2d,
+  0xde, 0x99, 0x23, 0xac, 0x1b, 0xf5, 0xf5, 0x22, 0x1c, 0x10, 0x3e, 0xff,
+  0xe1, 0xf3, 0x33, 0x14, 0x20, 0xcc, 0xe9, 0xff, 0xec, 0x1b, 0x17, 0x23,
+  0x0e, 0xdc, 0x22, 0x12, 0x06, 0x27, 0x04, 0x41, 0x3e, 0x1d, 0xec, 0xe8,
+  0x13, 0xc1, 0x2c, 0x3c, 0xf0, 0xf1, 0xe0, 0xe0, 0x2d, 0xbc, 0xbf, 0x25,
+  0xb9, 0x3a, 0xea, 0xbc, 0x0a, 0xcf, 0xe6, 0x15, 0x07, 0x00, 0xce, 0xda,
+  0xff, 0xef, 0x38, 0x4a, 0xee, 0xda, 0xfb, 0xf9, 0xd0, 0x00, 0x14, 0x2f,
+  0xfd, 0x01, 0xc8, 0x48, 0x03, 0xed, 0xfa, 0xed, 0xe7, 0x0a, 0x1b, 0xe3,
+  0x18, 0x01, 0x26, 0x19, 0x21, 0x23, 0xe4, 0xfd, 0x0b, 0xb4, 0x38, 0xe0,
+  0x19, 0xfe, 0xd2, 0xfa, 0xe6, 0x03, 0xcd, 0xd3, 0x11, 0x23, 0xfe, 0xe4,
+  0xe9, 0xda, 0xda, 0xbf, 0xf2, 0x4c, 0x3a, 0xd0, 0x0d, 0x2a, 0x0d, 0x3f,
+  0x41, 0x06, 0x0c, 0xfa, 0x08, 0x2f, 0xf6, 0xff, 0x25, 0xc9, 0xf0, 0xe6,
+  0xcb, 0xfe, 0xfe, 0x7f, 0xeb, 0x01, 0xee, 0x23, 0x19, 0xe9, 0xff, 0xd8,
+  0x0d, 0x0b, 0xec, 0xed, 0xfd, 0x2c, 0x3a, 0x09, 0x3e, 0x2b, 0xe2, 0xfa,
+  0x05, 0x0f, 0x2c, 0x07, 0x15, 0x26, 0xed, 0x01, 0xe6, 0xdd, 0xcf, 0x10,
+  0x05, 0x2e, 0xe2, 0xdf, 0xf3, 0xef, 0xe4, 0x14, 0x1a, 0x29, 0x24, 0x01,
+  0xf8, 0x4b, 0xf5, 0x00, 0x08, 0x3a, 0x00, 0x1f, 0x08, 0xea, 0x0e, 0x19,
+  0x1c, 0x0a, 0xe6, 0x08, 0x10, 0xfb, 0xd5, 0x6d, 0xd1, 0xfd, 0xec, 0x34,
+  0xb5, 0x10, 0xc1, 0xda, 0x17, 0xf4, 0x13, 0xf8, 0x2c, 0x27, 0x38, 0x65,
+  0x5e, 0x2c, 0xe1, 0xe2, 0xf6, 0xf9, 0xf5, 0x00, 0xf2, 0x42, 0xea, 0x14,
+  0xf4, 0xc6, 0xd1, 0x10, 0x1d, 0x17, 0xe4, 0x03, 0x08, 0xd0, 0xff, 0xd6,
+  0x11, 0x14, 0x2c, 0xd9, 0xde, 0xff, 0xc4, 0x25, 0x18, 0x19, 0xdb, 0xef,
+  0x2a, 0xec, 0x04, 0xdf, 0x0d, 0xf7, 0x0b, 0xdf, 0xee, 0xf1, 0x37, 0x5b,
+  0xdf, 0x21, 0x14, 0x12, 0xbf, 0x21, 0xc3, 0xf8, 0x14, 0xd3, 0xd8, 0xcd,
+  0x33, 0x09, 0x3a, 0xef, 0x48, 0x30, 0xf5, 0xf5, 0x14, 0xba, 0x1c, 0xe5,
+  0x02, 0x1c, 0xdf, 0xf2, 0xfb, 0xbd, 0xe5, 0x0e, 0xed, 0x3a, 0x25, 0x19,
+  0xb2, 0xec, 0xe5, 0xe8, 0xef, 0xfe, 0xfb, 0xdc, 0x04, 0xee, 0x38, 0x2a,
+  0x2e, 0xfa, 0xd0, 0x17, 0xd3, 0xfe, 0x2c, 0xf9, 0x1e, 0x01, 0xf9, 0x2c,
+  0xfa, 0x01, 0x1b, 0x10, 0xe3, 0x0a, 0x08, 0xc7, 0xd5, 0x2c, 0xde, 0xf7,
+  0x17, 0xc2, 0xd6, 0xf0, 0xde, 0x26, 0x2d, 0xc5, 0x5c, 0x0c, 0x0c, 0xd4,
+  0x01, 0x06, 0x51, 0xf3, 0x0a, 0x36, 0xea, 0xe4, 0xd1, 0xcc, 0x08, 0xc4,
+  0x04, 0x01, 0xd5, 0x55, 0xdc, 0xfe, 0xe3, 0x27, 0xf3, 0xf8, 0x02, 0xe7,
+  0x0b, 0x0e, 0x13, 0xfc, 0x0b, 0x30, 0xe9, 0x33, 0xea, 0x10, 0x2f, 0x0f,
+  0xd9, 0x06, 0xf4, 0x01, 0xff, 0xec, 0x02, 0xfe, 0x11, 0x06, 0xe3, 0xef,
+  0xd6, 0x3b, 0xe5, 0xca, 0x0e, 0xfb, 0xf6, 0xfe, 0xf3, 0x12, 0x2b, 0x1f,
+  0x5d, 0x04, 0xfb, 0xe1, 0xea, 0xd5, 0x29, 0xf9, 0xe3, 0x39, 0x01, 0x2c,
+  0xe4, 0xb3, 0xdf, 0x07, 0xd9, 0x31, 0x0e, 0x13, 0xe5, 0x03, 0x0f, 0x14,
+  0x13, 0x22, 0x02, 0xac, 0xeb, 0xe1, 0xfa, 0x0d, 0xf1, 0x16, 0xf2, 0x06,
+  0xfa, 0x1c, 0x0b, 0x02, 0x01, 0xe4, 0x1e, 0xf0, 0xfd, 0xd0, 0x08, 0x0b,
+  0xd0, 0x27, 0xfd, 0xf0, 0xe9, 0x07, 0x05, 0xf5, 0x20, 0xe8, 0xf3, 0xe4,
+  0xff, 0x34, 0xf7, 0xf4, 0xfb, 0x21, 0x13, 0x03, 0x12, 0xdf, 0x00, 0xf7,
+  0x16, 0x23, 0xe0, 0x0c, 0xc6, 0xa6, 0xf1, 0x31, 0xe9, 0x0e, 0xc6, 0x0d,
+  0x12, 0xe5, 0xf3, 0xef, 0x12, 0x0b, 0x12, 0x09, 0x5d, 0xe1, 0xf5, 0x0f,
+  0xfb, 0xed, 0xf6, 0x14, 0x34, 0xf2, 0xf5, 0xd7, 0x30, 0x0b, 0xfe, 0xf4,
+  0x05, 0xe9, 0x19, 0xfa, 0xda, 0x03, 0xf6, 0xeb, 0xd8, 0x1e, 0xfe, 0xf4,
+  0x1b, 0xd7, 0xc3, 0x12, 0xe8, 0x27, 0x3f, 0xd1, 0xfa, 0x1e, 0x1e, 0xff,
+  0xef, 0x02, 0x20, 0xf7, 0x16, 0xe1, 0xe1, 0xd9, 0xbb, 0xc4, 0xd7, 0xd6,
+  0xf6, 0xe3, 0xdf, 0x39, 0x01, 0x16, 0xef, 0x19, 0xf2, 0xeb, 0x1a, 0x1f,
+  0x2c, 0x04, 0xf5, 0x0c, 0x30, 0x13, 0x23, 0xf5, 0x2d, 0x05, 0x0a, 0xf5,
+  0x09, 0x00, 0xfa, 0xf0, 0x09, 0x0a, 0x14, 0x23, 0x1b, 0xfc, 0xf9, 0x05,
+  0x08, 0x02, 0xd3, 0xe0, 0x02, 0xf6, 0xe2, 0x09, 0x08, 0x18, 0xe1, 0xef,
+  0x27, 0x27, 0x09, 0xac, 0xfa, 0xf2, 0x08, 0xe2, 0xef, 0xf3, 0x22, 0x0f,
+  0xb9, 0xcb, 0xe1, 0xee, 0xe5, 0x23, 0xd4, 0xe8, 0x2b, 0xd3, 0x1f, 0xf0,
+  0xd9, 0x08, 0x0d, 0x4c, 0xfe, 0x03, 0xf9, 0x13, 0xf1, 0x0e, 0x39, 0xf0,
+  0xfd, 0x16, 0x3c, 0x0a, 0x1f, 0xe6, 0x27, 0xf3, 0xf3, 0xf7, 0x49, 0xd7,
+  0x77, 0x22, 0x21, 0x1f, 0x79, 0x02, 0xdf, 0x56, 0xe4, 0x0a, 0x00, 0x27,
+  0xff, 0x11, 0xd3, 0x26, 0x09, 0xf6, 0x19, 0xf4, 0xe6, 0x1b, 0xbb, 0x1c,
+  0xb2, 0x19, 0x4f, 0x15, 0x01, 0xed, 0x17, 0xda, 0xd4, 0xc0, 0x55, 0xf4,
+  0xaa, 0x48, 0x16, 0xae, 0x24, 0xf8, 0xd1, 0x95, 0xac, 0xfe, 0xd2, 0xff,
+  0xdb, 0xf2, 0xef, 0x49, 0xec, 0xca, 0x63, 0x03, 0xe9, 0x11, 0x28, 0xe3,
+  0x23, 0xc6, 0x2f, 0x10, 0x61, 0xe8, 0x24, 0x2f, 0x47, 0xc5, 0xec, 0x0f,
+  0xf6, 0xe7, 0x09, 0xf6, 0x07, 0xe9, 0xc9, 0x2c, 0xd5, 0x21, 0x3d, 0x46,
+  0xeb, 0x39, 0xf4, 0x2a, 0xf3, 0x2e, 0xe9, 0xfa, 0xe8, 0x06, 0x45, 0x3b,
+  0xd3, 0xfa, 0x13, 0x24, 0x8f, 0x1e, 0x36, 0xd7, 0x00, 0xf9, 0x0f, 0xcc,
+  0xcf, 0xf2, 0xf6, 0xbd, 0xee, 0xe5, 0x2d, 0xdf, 0x81, 0x09, 0x3b, 0x0a,
+  0xb0, 0xe9, 0x0c, 0xe0, 0x0f, 0x1b, 0xf3, 0xf9, 0x5b, 0xab, 0xef, 0xda,
+  0x4e, 0xf6, 0x17, 0x07, 0xe9, 0xc5, 0x02, 0xd2, 0x0b, 0xfb, 0xc7, 0x27,
+  0xe0, 0x1f, 0x14, 0x2a, 0xa0, 0x40, 0xff, 0x10, 0x57, 0x0e, 0xed, 0x01,
+  0xe2, 0x19, 0x22, 0x2c, 0x0a, 0xfd, 0xe3, 0xdf, 0x38, 0xc7, 0x2e, 0x1d,
+  0xc2, 0x30, 0xf8, 0x29, 0xe8, 0xc1, 0x01, 0xc7, 0xb6, 0x21, 0x40, 0xfb,
+  0xe5, 0x21, 0x13, 0x2a, 0xee, 0x3d, 0xdd, 0xff, 0xfa, 0xee, 0x01, 0x05,
+  0x3b, 0x0a, 0xf6, 0xe8, 0x2f, 0x27, 0xe2, 0x1e, 0x41, 0x0d, 0x15, 0x56,
+  0xf1, 0x02, 0x09, 0xc8, 0x42, 0x89, 0xb0, 0xfd, 0xde, 0xd5, 0x20, 0x1e,
+  0xee, 0xe6, 0xbd, 0xa7, 0xe9, 0xc1, 0xde, 0xa2, 0xdc, 0x83, 0x39, 0x0b,
+  0x03, 0xa3, 0xc0, 0xff, 0xd6, 0xca, 0xd3, 0x61, 0x8f, 0x32, 0x0a, 0xa6,
+  0x0c, 0xed, 0xd7, 0x2c, 0x46, 0xfa, 0xc1, 0x45, 0x13, 0xc5, 0x2c, 0x03,
+  0xc5, 0xdc, 0x1e, 0x1e, 0x03, 0x05, 0x00, 0xef, 0x0c, 0x20, 0x69, 0xcc,
+  0x52, 0x0f, 0x0a, 0x5e, 0x01, 0xd1, 0x25, 0xeb, 0x57, 0xeb, 0xe5, 0x19,
+  0x23, 0x1f, 0xe4, 0xee, 0xe9, 0x29, 0xcd, 0xf5, 0xfc, 0xfd, 0x0e, 0x43,
+  0xe8, 0x0f, 0xf7, 0x15, 0xc9, 0xc7, 0xd0, 0x12, 0x9a, 0xa8, 0xa9, 0x40,
+  0xe0, 0xf8, 0x0d, 0xee, 0x3d, 0x35, 0xda, 0x0c, 0x4e, 0xb9, 0xc2, 0x21,
+  0xad, 0xbe, 0xe1, 0xf9, 0xf4, 0xea, 0x9e, 0x0e, 0x9d, 0x9b, 0x19, 0x94,
+  0x19, 0x0f, 0x27, 0xb5, 0xe5, 0xde, 0x49, 0x3f, 0xfb, 0xf5, 0x24, 0x31,
+  0x52, 0x34, 0x48, 0xc4, 0xef, 0xf9, 0x1b, 0x02, 0xd1, 0xe8, 0xa1, 0x0c,
+  0xdb, 0xe8, 0x1b, 0x41, 0xc0, 0x04, 0x94, 0x10, 0xf2, 0xee, 0x2d, 0x5b,
+  0xb6, 0xe8, 0xc9, 0x22, 0xce, 0xb3, 0xf6, 0x30, 0xd9, 0x3c, 0xae, 0x0d,
+  0x11, 0x15, 0x9f, 0xfc, 0xe8, 0xe6, 0xda, 0xe1, 0x42, 0x30, 0xf5, 0x0f,
+  0x31, 0x30, 0x29, 0xfa, 0x9b, 0x36, 0x2a, 0x21, 0x37, 0x26, 0xd7, 0x71,
+  0x3a, 0x14, 0x2b, 0xcc, 0xdd, 0xc0, 0xf2, 0x51, 0xe6, 0xd4, 0x3e, 0x2f,
+  0xc4, 0xf6, 0x9f, 0xcd, 0xda, 0xe0, 0xed, 0xcc, 0x5a, 0x05, 0x43, 0xcf,
+  0x19, 0xdb, 0xd3, 0x24, 0x34, 0xbf, 0xfd, 0x41, 0xd9, 0x4a, 0xb8, 0xbf,
+  0x2a, 0x1c, 0xc9, 0x10, 0x2c, 0x1b, 0xf9, 0x58, 0x2e, 0xd1, 0xc4, 0x47,
+  0xad, 0x3e, 0x1b, 0x06, 0x00, 0x62, 0xed, 0xde, 0xb1, 0xdd, 0x2c, 0xd7,
+  0x31, 0x35, 0xc0, 0x50, 0x1b, 0x2e, 0x1e, 0xf3, 0xf5, 0xe4, 0xb5, 0x3d,
+  0x1f, 0xbf, 0x2a, 0xfb, 0xc1, 0x34, 0xfd, 0x0e, 0xd6, 0xf9, 0xf3, 0x0d,
+  0x26, 0x0c, 0x0b, 0xf0, 0x20, 0x2f, 0xce, 0x4e, 0x0b, 0xcb, 0x4d, 0x1e,
+  0xf2, 0x39, 0xe9, 0x11, 0xf1, 0xfe, 0xf8, 0x0f, 0x49, 0x16, 0xf9, 0x1f,
+  0x0c, 0x16, 0xdc, 0x3c, 0xca, 0x3e, 0x0c, 0xec, 0x86, 0xfb, 0xe5, 0xe5,
+  0x0e, 0xd1, 0x21, 0xed, 0x0a, 0xdd, 0xfd, 0xd7, 0xf3, 0x3c, 0x0f, 0x23,
+  0xf5, 0x00, 0x55, 0x15, 0xfe, 0xe6, 0xfd, 0x0e, 0xd0, 0x39, 0xd2, 0xeb,
+  0xf1, 0xe8, 0x1e, 0x06, 0xc0, 0x0e, 0xe8, 0x0d, 0xfd, 0xf9, 0xb4, 0x7c,
+  0x05, 0x01, 0x5f, 0xa1, 0x10, 0x28, 0x08, 0xe4, 0xf2, 0xd8, 0xd7, 0x4d,
+  0xea, 0x1d, 0xc0, 0x1d, 0x04, 0x1a, 0xfe, 0x36, 0xee, 0x16, 0x01, 0xeb,
+  0xfa, 0xea, 0xe9, 0xe9, 0xc9, 0x21, 0xe1, 0x02, 0x26, 0xa0, 0x0e, 0xe6,
+  0xef, 0x08, 0x4d, 0x38, 0x7c, 0x67, 0xf7, 0xdd, 0xfa, 0xdf, 0x18, 0x04,
+  0xd4, 0xe6, 0x38, 0xc3, 0x11, 0x2e, 0xd6, 0x9a, 0xdf, 0x1c, 0x79, 0x17,
+  0x2a, 0xd2, 0xc9, 0xd8, 0x1e, 0x5b, 0xf8, 0xd8, 0xdd, 0x11, 0xcd, 0x01,
+  0xee, 0xdd, 0xf7, 0x0b, 0xf2, 0x29, 0xec, 0x0a, 0x03, 0x23, 0xee, 0x4f,
+  0x37, 0x17, 0xd9, 0x1d, 0x3c, 0xd5, 0x22, 0xea, 0xc5, 0xfd, 0xde, 0xfb,
+  0x1e, 0xb2, 0xd6, 0x31, 0x05, 0xd2, 0x2d, 0x39, 0x47, 0x28, 0x0a, 0x1e,
+  0x00, 0xfc, 0x03, 0x1f, 0xa6, 0xf8, 0xc7, 0x0c, 0x27, 0x0f, 0xbb, 0x9d,
+  0x0a, 0xc6, 0xed, 0xff, 0xd4, 0xb9, 0xc8, 0xed, 0xda, 0x1b, 0xfc, 0xba,
+  0xfa, 0x11, 0x31, 0x11, 0xda, 0xd9, 0x93, 0xf0, 0xfc, 0x0e, 0x09, 0x14,
+  0xe2, 0xe6, 0x05, 0x23, 0x0f, 0xe2, 0x20, 0x0e, 0xfa, 0xcd, 0x00, 0x13,
+  0x06, 0xdc, 0xeb, 0x00, 0xf6, 0xf0, 0xf9, 0x1b, 0x01, 0x1d, 0x1b, 0x05,
+  0x0d, 0x12, 0x0d, 0x00, 0x13, 0x00, 0x31, 0x30, 0xa3, 0x02, 0xe0, 0x0c,
+  0xc9, 0xe7, 0xf2, 0xf0, 0x43, 0x07, 0xe2, 0x25, 0xf0, 0xd3, 0xe7, 0x42,
+  0x09, 0xe4, 0xf9, 0xca, 0x19, 0x3a, 0xfa, 0xba, 0xc2, 0xf2, 0xd8, 0xd4,
+  0xe3, 0xe8, 0xe5, 0xf1, 0x08, 0x03, 0x23, 0xfb, 0x51, 0x18, 0x19, 0x30,
+  0x09, 0xff, 0xea, 0xd3, 0xf6, 0xf8, 0xf9, 0xef, 0x2e, 0x00, 0xa1, 0xe1,
+  0x17, 0x05, 0x3f, 0x2b, 0x06, 0x41, 0x0c, 0xeb, 0x07, 0xea, 0x09, 0x2e,
+  0xd8, 0x22, 0xf0, 0x02, 0xfa, 0xfa, 0xd0, 0xbf, 0x04, 0xe1, 0x42, 0x23,
+  0xcd, 0xf7, 0x0b, 0xb5, 0x26, 0x67, 0xd6, 0x06, 0xdc, 0x3e, 0x88, 0x0e,
+  0x56, 0xb7, 0xfe, 0xf6, 0x01, 0x29, 0xde, 0xfb, 0xfe, 0xca, 0x27, 0xf8,
+  0xee, 0xdb, 0xf2, 0x10, 0x0b, 0x97, 0x39, 0xcc, 0x2c, 0xe0, 0x38, 0xc5,
+  0xef, 0xbe, 0xa2, 0x2a, 0xe3, 0x1c, 0x40, 0x0a, 0xb3, 0x34, 0xfa, 0xe3,
+  0xf4, 0xfb, 0xdc, 0x0b, 0xec, 0x10, 0xfe, 0xda, 0xfb, 0x0d, 0x08, 0xca,
+  0x07, 0xd5, 0x2d, 0xe1, 0xa6, 0x08, 0xdb, 0xd5, 0xed, 0x3a, 0xe6, 0xf6,
+  0x07, 0x07, 0xde, 0x30, 0x1f, 0xfe, 0xd5, 0xfb, 0x2e, 0x51, 0x05, 0x09,
+  0xe6, 0xce, 0x08, 0x0e, 0xb0, 0x81, 0x3e, 0x2e, 0x3f, 0xc4, 0xd0, 0xeb,
+  0x14, 0xbf, 0xfb, 0x25, 0xe3, 0xef, 0xc2, 0x14, 0xb7, 0x31, 0x06, 0xe6,
+  0xf8, 0x24, 0x18, 0x2a, 0xf4, 0xd4, 0xcf, 0x46, 0xd7, 0xe6, 0xdd, 0x23,
+  0xcc, 0xe5, 0xcb, 0x02, 0x06, 0x14, 0x14, 0xf3, 0xe5, 0xf6, 0xdd, 0xf8,
+  0x03, 0x3f, 0xfb, 0xb2, 0xe4, 0xf3, 0xcf, 0xe5, 0xd4, 0x1e, 0x31, 0xdb,
+  0xc7, 0x31, 0x03, 0xe2, 0xbe, 0xf6, 0x0d, 0xec, 0xd4, 0xc2, 0x11, 0x07,
+  0xda, 0x37, 0xb3, 0x64, 0x30, 0xe6, 0xbd, 0x42, 0xd1, 0x26, 0x11, 0xd5,
+  0x3d, 0xde, 0x16, 0x55, 0xff, 0x07, 0x02, 0x0b, 0x04, 0xf6, 0x1b, 0x24,
+  0x3c, 0x50, 0xe9, 0x34, 0xf0, 0xee, 0xf5, 0xe4, 0xf2, 0xe4, 0x02, 0x3b,
+  0x3d, 0x24, 0x11, 0xee, 0xdb, 0x2b, 0xdd, 0x2e, 0xd8, 0x28, 0xb3, 0x22,
+  0x28, 0x0d, 0x11, 0xcc, 0xfe, 0x89, 0xe0, 0xd6, 0x3e, 0xcd, 0xfa, 0xdc,
+  0x03, 0xe1, 0xec, 0xf5, 0xcb, 0xaa, 0xe9, 0x15, 0x45, 0xf3, 0x15, 0x24,
+  0xdf, 0x1e, 0x07, 0xee, 0x08, 0xe8, 0x08, 0x3a, 0xef, 0xe9, 0x28, 0xa4,
+  0xfa, 0xeb, 0x1c, 0xfa, 0x4f, 0xe6, 0x3c, 0x00, 0x3e, 0xf0, 0x48, 0xe0,
+  0x26, 0x37, 0x1d, 0xe3, 0x12, 0xf8, 0x03, 0x0e, 0xf1, 0x27, 0xca, 0xf5,
+  0xf1, 0xd5, 0xbb, 0xef, 0x22, 0x23, 0x19, 0xf4, 0xec, 0xdf, 0xdc, 0xe5,
+  0x4b, 0x16, 0xd9, 0xc3, 0xf0, 0xd6, 0xf7, 0xf5, 0xfc, 0x1b, 0xf7, 0xed,
+  0x43, 0xfa, 0x11, 0x44, 0xe2, 0x14, 0x1a, 0x0d, 0xfe, 0x20, 0xf3, 0x2e,
+  0x28, 0xf4, 0x2e, 0xde, 0xea, 0xfb, 0xe3, 0x2a, 0x1c, 0x08, 0xe6, 0xfa,
+  0x25, 0x1b, 0x19, 0x24, 0x08, 0x26, 0xfc, 0xf3, 0x36, 0x15, 0x14, 0x1f,
+  0xee, 0x19, 0x06, 0xc7, 0xaf, 0xcc, 0xdc, 0x04, 0xe5, 0xf9, 0x15, 0x02,
+  0xec, 0x0b, 0xdc, 0x07, 0xdf, 0x2e, 0xd1, 0x08, 0x92, 0xe5, 0xf2, 0x9a,
+  0xe6, 0x0a, 0xcf, 0x1d, 0xd8, 0x10, 0xe8, 0xb5, 0x3d, 0x10, 0xda, 0x09,
+  0xf8, 0x04, 0x20, 0x18, 0xe9, 0x30, 0x29, 0xfc, 0xc4, 0x18, 0xe5, 0x09,
+  0xe9, 0xb9, 0x12, 0x50, 0x22, 0xed, 0xdd, 0xda, 0x09, 0xbc, 0x2f, 0x26,
+  0xef, 0xf9, 0xf7, 0xf1, 0xfe, 0xee, 0xfd, 0xbb, 0xca, 0xde, 0xf3, 0xe3,
+  0x01, 0x34, 0xfc, 0x06, 0x08, 0xf3, 0x20, 0x0e, 0x0d, 0xe7, 0xc3, 0x0a,
+  0xcf, 0x20, 0xef, 0xe3, 0x26, 0xf4, 0x0a, 0xf0, 0xef, 0xf6, 0xe7, 0x05,
+  0x1f, 0x19, 0xfb, 0xed, 0xea, 0xfc, 0x23, 0x01, 0x0b, 0x27, 0xea, 0x21,
+  0x08, 0x05, 0x26, 0xf4, 0xc0, 0xf2, 0x2b, 0x0f, 0x2f, 0xf0, 0x1d, 0xf7,
+  0xc9, 0xf1, 0xe5, 0xd3, 0x0a, 0x11, 0xeb, 0x1f, 0xe8, 0x0f, 0x28, 0xdf,
+  0x0f, 0x31, 0x43, 0xe5, 0xee, 0xf2, 0x0b, 0xff, 0xc2, 0xdc, 0xee, 0xb4,
+  0xf7, 0x13, 0xeb, 0x0f, 0xf6, 0x37, 0x06, 0xe6, 0xf6, 0xe2, 0x42, 0x1e,
+  0xef, 0x04, 0x05, 0x0d, 0xe8, 0xf8, 0xdd, 0xe5, 0x03, 0x3a, 0xfe, 0xf4,
+  0xf2, 0x4e, 0xb9, 0xd7, 0x0f, 0x09, 0x30, 0x02, 0xcd, 0x29, 0x15, 0xc3,
+  0x22, 0xe4, 0x41, 0x54, 0x1d, 0xcd, 0xe0, 0xc9, 0x1c, 0xe7, 0xc5, 0x2b,
+  0xc4, 0xfa, 0xf1, 0xfe, 0xe3, 0x3c, 0x59, 0xd8, 0xda, 0x2d, 0xec, 0xf0,
+  0xd6, 0xbf, 0x19, 0xb8, 0xf1, 0xfb, 0xfb, 0xfc, 0xfb, 0x3c, 0x1e, 0x16,
+  0xf1, 0x54, 0x02, 0x1b, 0xfd, 0xe7, 0x04, 0x3b, 0x23, 0xfc, 0xea, 0x1c,
+  0xfa, 0xe7, 0x0b, 0x26, 0x1e, 0x10, 0xec, 0x28, 0xdc, 0xe4, 0xd8, 0xf8,
+  0xd7, 0xd4, 0xf6, 0x1b, 0x11, 0x00, 0xde, 0xed, 0xe4, 0xf6, 0x28, 0xd8,
+  0x00, 0x05, 0xce, 0xfa, 0xf7, 0xc6, 0xf8, 0x05, 0x08, 0xdf, 0xaa, 0x0a,
+  0x1c, 0x17, 0x5c, 0xf2, 0x1a, 0xe0, 0xf2, 0xfe, 0xf8, 0xef, 0xfb, 0xe5,
+  0xc1, 0x15, 0xf4, 0xf7, 0x06, 0xe4, 0x62, 0xf7, 0xe1, 0xff, 0xf9, 0x2e,
+  0x19, 0xd8, 0x07, 0xdc, 0xe6, 0xc6, 0x3f, 0xf8, 0x36, 0x08, 0xbc, 0xf2,
+  0x0a, 0xa0, 0x42, 0x1b, 0xe7, 0xff, 0x1f, 0x4f, 0x28, 0x03, 0x1f, 0xf1,
+  0xee, 0x19, 0xf5, 0xbe, 0x1f, 0xfa, 0x07, 0x0f, 0xfc, 0x2a, 0x25, 0x10,
+  0x03, 0xfd, 0x58, 0x1f, 0xee, 0x15, 0x06, 0xf3, 0xe2, 0xe2, 0xde, 0x21,
+  0x32, 0xee, 0x10, 0xff, 0x01, 0x38, 0xf2, 0x26, 0x19, 0xfd, 0x53, 0x12,
+  0xe5, 0xf2, 0x14, 0x14, 0xe8, 0xe8, 0xf1, 0x10, 0x07, 0xee, 0xff, 0x22,
+  0x07, 0x2d, 0xd1, 0xd9, 0x10, 0x1d, 0x26, 0xd6, 0xde, 0x38, 0x03, 0xbf,
+  0x0d, 0xf9, 0x47, 0x3c, 0xf5, 0x0d, 0xf5, 0xa0, 0xe0, 0xfd, 0xe4, 0x35,
+  0xc5, 0x0e, 0x3a, 0x26, 0x3c, 0x02, 0x27, 0x0b, 0x14, 0x0e, 0x22, 0x0b,
+  0xbe, 0x13, 0xe2, 0x20, 0x2c, 0x09, 0x0e, 0x06, 0xed, 0x07, 0x40, 0x13,
+  0x08, 0x12, 0xe3, 0x21, 0xec, 0xee, 0x09, 0xf7, 0xf3, 0xd5, 0xea, 0x3a,
+  0x2f, 0x29, 0xc0, 0x1d, 0x06, 0xfc, 0xdf, 0x1b, 0x39, 0x2d, 0xf5, 0x28,
+  0x08, 0xce, 0x07, 0x0c, 0x26, 0xfa, 0x0e, 0xe7, 0xfb, 0x05, 0x3d, 0xcb,
+  0xf3, 0xd7, 0x00, 0x1d, 0xe9, 0xbe, 0xea, 0x35, 0x12, 0xfe, 0x8f, 0xf2,
+  0x23, 0x17, 0xe1, 0xcc, 0x66, 0xef, 0xf3, 0x0e, 0xe7, 0xd2, 0x0c, 0xc5,
+  0xe8, 0xf2, 0x00, 0x12, 0xfe, 0x0e, 0x45, 0x0d, 0xad, 0x34, 0x2b, 0xd4,
+  0x0a, 0xc2, 0x07, 0xf7, 0x15, 0xe4, 0x08, 0x20, 0x13, 0x10, 0xeb, 0x23,
+  0xfb, 0x9f, 0x15, 0x00, 0x42, 0xfc, 0xf9, 0x46, 0xeb, 0xea, 0x0c, 0xd9,
+  0x11, 0x1b, 0xf7, 0xdf, 0xe1, 0xeb, 0x09, 0x7f, 0x00, 0xfa, 0xfc, 0xe9,
+  0xe6, 0xc7, 0xf6, 0x18, 0xe3, 0x16, 0x0f, 0x2a, 0x20, 0xd6, 0x06, 0x44,
+  0x18, 0xe5, 0xf7, 0x05, 0xc0, 0xf2, 0x14, 0x13, 0x16, 0x62, 0x31, 0x48,
+  0xc8, 0x43, 0x34, 0x0e, 0x1c, 0xf0, 0xee, 0x2e, 0x1a, 0x04, 0xf5, 0x06,
+  0x27, 0x18, 0x21, 0xbd, 0xd6, 0x0f, 0xec, 0x09, 0x20, 0x1f, 0xe8, 0xf4,
+  0xff, 0xf3, 0xfe, 0xe1, 0xe0, 0xea, 0xcf, 0xfa, 0xf6, 0xfe, 0x11, 0x2b,
+  0xeb, 0xea, 0x46, 0x0f, 0xe5, 0x07, 0xf1, 0x4e, 0x07, 0x0c, 0xfa, 0x2b,
+  0x13, 0x18, 0xec, 0x19, 0x30, 0xdc, 0x0c, 0xd5, 0x8d, 0xe1, 0x20, 0x08,
+  0xe0, 0x12, 0x38, 0xc7, 0xcf, 0x28, 0xbc, 0x2f, 0x1f, 0xe7, 0xb6, 0xf5,
+  0x56, 0xde, 0x52, 0x62, 0xeb, 0x48, 0xc3, 0xea, 0xc4, 0xd4, 0x10, 0x2d,
+  0xad, 0xe9, 0x4d, 0xc5, 0x36, 0x04, 0xfa, 0x39, 0xdf, 0x09, 0x03, 0xe0,
+  0x33, 0xb3, 0x1b, 0xf2, 0xd0, 0x38, 0xe0, 0xbe, 0xef, 0xad, 0x0f, 0xbf,
+  0xcf, 0x50, 0xf4, 0x5c, 0xdf, 0xbf, 0xd7, 0x37, 0xe5, 0xba, 0x18, 0x30,
+  0x19, 0x45, 0xf5, 0x12, 0x2a, 0xed, 0x06, 0x02, 0x11, 0x2e, 0xd7, 0xd2,
+  0x51, 0x23, 0xf9, 0xcc, 0x14, 0x24, 0x18, 0x00, 0xbf, 0x17, 0xd3, 0xbb,
+  0x0d, 0x1a, 0x01, 0x04, 0x97, 0xde, 0x40, 0xe3, 0x3a, 0x24, 0x1d, 0xf1,
+  0x1b, 0x03, 0x0a, 0x45, 0x41, 0xc9, 0x23, 0x20, 0x12, 0x32, 0x1f, 0x8b,
+  0xe2, 0xd2, 0xe8, 0xd8, 0xce, 0x29, 0xcd, 0x0a, 0xa9, 0xbe, 0xdc, 0xb5,
+  0x37, 0xe8, 0xfc, 0x1f, 0xab, 0x18, 0x2a, 0xe8, 0x34, 0xf9, 0x0d, 0x1e,
+  0xe8, 0xe7, 0xda, 0xdc, 0x0d, 0x28, 0xbc, 0xd5, 0xd7, 0x1f, 0x0f, 0xf4,
+  0x04, 0x37, 0xb9, 0xdf, 0x10, 0x24, 0x13, 0x0f, 0xb9, 0x49, 0xee, 0x05,
+  0xee, 0xe6, 0x19, 0x9e, 0xfe, 0x17, 0xe9, 0x0a, 0x08, 0xd7, 0x35, 0x21,
+  0xbb, 0x5b, 0x17, 0xd5, 0x07, 0x26, 0x12, 0xb7, 0x03, 0x3f, 0xf6, 0x21,
+  0xbf, 0x00, 0xbb, 0xe3, 0x2f, 0xc5, 0xcf, 0x25, 0xf6, 0xed, 0x54, 0x1e,
+  0x02, 0xf3, 0xf1, 0xcd, 0xff, 0x24, 0xcf, 0x7f, 0xf9, 0x0d, 0xd6, 0xed,
+  0x16, 0xd2, 0x04, 0xde, 0xde, 0x22, 0xed, 0x01, 0xcf, 0x01, 0xe8, 0xf9,
+  0x0d, 0xe5, 0x12, 0xe3, 0x1b, 0xd2, 0x1b, 0x10, 0x0e, 0xc1, 0x05, 0x07,
+  0xe4, 0x16, 0x30, 0xf2, 0xce, 0x1a, 0x09, 0x41, 0xdb, 0xe5, 0x17, 0xd8,
+  0x35, 0x3d, 0x42, 0x06, 0xe1, 0xef, 0xfe, 0x0d, 0xfd, 0xdd, 0x13, 0x02,
+  0xda, 0xf7, 0x07, 0x25, 0x0d, 0xed, 0xe1, 0xf0, 0x03, 0x3a, 0xf1, 0xee,
+  0x1b, 0xef, 0x1f, 0xd2, 0x1e, 0x18, 0xec, 0xbc, 0xca, 0x06, 0xe8, 0xe6,
+  0xe0, 0x40, 0xf8, 0x04, 0x0b, 0xff, 0x39, 0x1f, 0x17, 0xcf, 0x2c, 0x2a,
+  0x62, 0x14, 0xf4, 0x06, 0xb7, 0x2c, 0x1f, 0xd3, 0x05, 0x24, 0xff, 0x17,
+  0xa8, 0x19, 0x3b, 0xda, 0xde, 0x0a, 0x1f, 0xdd, 0xfb, 0x23, 0x14, 0xec,
+  0x07, 0xb6, 0x07, 0x0b, 0xc5, 0xd4, 0x31, 0xfc, 0x2d, 0xe7, 0x20, 0x23,
+  0xe2, 0x2f, 0xdf, 0x4f, 0x10, 0x35, 0xbe, 0xe8, 0xd2, 0xe8, 0xe9, 0xfb,
+  0xbb, 0x18, 0xb2, 0xdc, 0xfa, 0xef, 0xd3, 0xfd, 0xe2, 0x1c, 0xcf, 0x04,
+  0xde, 0xfd, 0x28, 0xf8, 0x23, 0x13, 0x26, 0xca, 0xa9, 0xd6, 0xf7, 0x3b,
+  0xbc, 0x3a, 0x28, 0xee, 0xdd, 0x22, 0x1d, 0x46, 0x0f, 0x2f, 0x3a, 0xd2,
+  0x02, 0x2a, 0xee, 0xd9, 0x02, 0xcd, 0xcf, 0xd6, 0xfe, 0xc5, 0x3a, 0xdd,
+  0x10, 0x18, 0x1d, 0x2f, 0x04, 0x18, 0x2f, 0x3e, 0xb8, 0x06, 0xb8, 0x30,
+  0x44, 0xf1, 0xb5, 0x05, 0x13, 0x04, 0xe5, 0x0b, 0xe9, 0x52, 0x13, 0xfc,
+  0x50, 0xef, 0x04, 0xec, 0x09, 0x18, 0xdc, 0xc9, 0xfc, 0xf0, 0x52, 0x03,
+  0xf2, 0xf9, 0x23, 0xe7, 0xc0, 0xf1, 0xeb, 0xdf, 0xe3, 0x4d, 0x08, 0x24,
+  0x1f, 0xdb, 0x69, 0xc4, 0xde, 0x06, 0x01, 0xfd, 0x3a, 0x10, 0x02, 0x32,
+  0x37, 0xd2, 0xfe, 0x46, 0xeb, 0x14, 0xd2, 0x1a, 0xe7, 0x25, 0x56, 0x10,
+  0x14, 0xd4, 0x00, 0x22, 0x58, 0x05, 0xbd, 0x2e, 0xcb, 0x02, 0x18, 0x06,
+  0xba, 0x60, 0x23, 0x14, 0x3d, 0xf0, 0x13, 0x15, 0x2b, 0x12, 0xe7, 0x2b,
+  0x1f, 0x12, 0x3f, 0xf7, 0xda, 0x01, 0x53, 0xcb, 0xd3, 0x4e, 0xda, 0x24,
+  0xe0, 0x58, 0xff, 0x1f, 0x23, 0x07, 0xd7, 0xe0, 0x5d, 0x1b, 0x06, 0x14,
+  0x08, 0xeb, 0xf8, 0x0d, 0x57, 0xdc, 0xf3, 0x2a, 0x0c, 0x3d, 0x01, 0x42,
+  0xcc, 0x27, 0xfe, 0x2f, 0xd8, 0x25, 0x82, 0x13, 0x01, 0xd8, 0xe8, 0xee,
+  0x04, 0xcf, 0xf2, 0xbc, 0xb6, 0x12, 0x06, 0xfd, 0x44, 0xfc, 0xd6, 0xd6,
+  0x0e, 0x01, 0xd9, 0x2f, 0xea, 0x4b, 0xe9, 0xe8, 0xd4, 0xfc, 0xdf, 0xd2,
+  0xc6, 0xc9, 0x20, 0xe6, 0xc7, 0x38, 0x23, 0x0a, 0xec, 0x25, 0x2d, 0xaf,
+  0x18, 0x3b, 0x23, 0x10, 0x02, 0xc3, 0xfe, 0x10, 0x16, 0xcd, 0xe8, 0xe4,
+  0x18, 0xe6, 0x08, 0x03, 0xde, 0x07, 0x0a, 0xdc, 0x1a, 0xde, 0x19, 0x2a,
+  0xce, 0xf8, 0x0c, 0xe9, 0xea, 0x30, 0x42, 0x30, 0x05, 0x28, 0xc0, 0x1e,
+  0xf7, 0xde, 0xef, 0x28, 0x01, 0x07, 0x03, 0xfa, 0xef, 0x1a, 0x37, 0xf2,
+  0xf1, 0xfa, 0x02, 0xf4, 0xdd, 0xfe, 0xfd, 0x29, 0x01, 0x1f, 0xf2, 0xfe,
+  0xe1, 0xfc, 0xc5, 0x40, 0xf8, 0x02, 0xf2, 0x1c, 0xed, 0xde, 0x27, 0xe6,
+  0x1e, 0xd9, 0xea, 0x19, 0x1b, 0xf1, 0x2d, 0xcd, 0x0b, 0xec, 0x02, 0xe5,
+  0xfb, 0x11, 0x0c, 0xfc, 0xd3, 0xd3, 0x0e, 0xfb, 0xf0, 0xec, 0xe8, 0x30,
+  0x10, 0x22, 0xeb, 0x4a, 0xef, 0x05, 0x29, 0xe8, 0xed, 0x07, 0xfa, 0xe1,
+  0xec, 0xf7, 0x0f, 0xed, 0xc9, 0x0b, 0x0a, 0xf7, 0xf3, 0x30, 0x18, 0x01,
+  0x18, 0xfc, 0x01, 0x28, 0xe0, 0xdc, 0xdf, 0x34, 0x0f, 0x45, 0xe3, 0x04,
+  0x3a, 0xf7, 0x3c, 0xe3, 0x0a, 0xad, 0xf7, 0x07, 0xd8, 0xec, 0x02, 0x1a,
+  0xfd, 0xdf, 0xfa, 0x15, 0xf2, 0x1c, 0xef, 0x26, 0xd2, 0xda, 0xe7, 0xe5,
+  0x0f, 0x09, 0xf3, 0xf9, 0x40, 0x16, 0x16, 0xf9, 0xf4, 0x0c, 0xf9, 0xdf,
+  0x15, 0xfd, 0xfa, 0xf4, 0x14, 0x1c, 0x01, 0x01, 0x18, 0xe8, 0xe3, 0xeb,
+  0xde, 0x15, 0x0c, 0xee, 0x23, 0x13, 0x0f, 0x07, 0xdf, 0x05, 0xb2, 0x08,
+  0xf0, 0x5e, 0x04, 0x1c, 0xe2, 0xdc, 0x39, 0x12, 0x2c, 0xe3, 0x0b, 0xee,
+  0xd9, 0xfc, 0xe5, 0xfe, 0x1d, 0xf8, 0x10, 0xfe, 0x11, 0xf0, 0xe2, 0x27,
+  0x16, 0x19, 0xf1, 0xfb, 0xf1, 0x27, 0x34, 0x14, 0xfa, 0xfd, 0x0a, 0xf8,
+  0xff, 0xea, 0xfc, 0x05, 0xfc, 0xf9, 0x13, 0xe0, 0xfc, 0x26, 0xf4, 0xdf,
+  0x02, 0x06, 0x0c, 0xd8, 0x0a, 0x1b, 0xd5, 0xef, 0x22, 0x19, 0x00, 0xe6,
+  0xfd, 0xfe, 0xda, 0x08, 0x0f, 0x17, 0xf6, 0xee, 0x42, 0xf5, 0x24, 0xef,
+  0xe1, 0xf4, 0x19, 0x2a, 0xe4, 0x05, 0x21, 0xfb, 0x15, 0x03, 0xfd, 0xef,
+  0xf7, 0x2d, 0x00, 0xcd, 0x0e, 0x20, 0x28, 0x08, 0xf4, 0xeb, 0xeb, 0xdf,
+  0xd5, 0x10, 0xff, 0x1b, 0x08, 0xf9, 0x06, 0xf1, 0xdf, 0x09, 0xee, 0xca,
+  0x14, 0x23, 0xf8, 0x24, 0xe2, 0x19, 0x1b, 0xf9, 0xf2, 0x0e, 0x01, 0xd2,
+  0xff, 0xe5, 0x1d, 0x02, 0xf1, 0xd4, 0xfe, 0x22, 0x09, 0xf1, 0xf4, 0x0f,
+  0x7f, 0x07, 0x24, 0x18, 0x0a, 0xdc, 0x1e, 0xfb, 0xe0, 0xe6, 0x0f, 0xf4,
+  0x16, 0xf6, 0x15, 0x0a, 0x08, 0x24, 0x09, 0xc8, 0xfc, 0x28, 0x06, 0x2e,
+  0xe2, 0x29, 0xfc, 0xe8, 0x18, 0x0f, 0x14, 0xe2, 0x17, 0xe6, 0xe7, 0xf2,
+  0xe6, 0xed, 0x2c, 0xc0, 0x12, 0x35, 0xf7, 0x25, 0x13, 0x0d, 0xde, 0xe5,
+  0x01, 0x11, 0xe5, 0xfd, 0x38, 0xfc, 0x1e, 0xe0, 0x15, 0xf4, 0x09, 0x0d,
+  0xdf, 0x36, 0xfa, 0x1c, 0x10, 0xde, 0x3d, 0x0a, 0x2d, 0xc9, 0xfb, 0x05,
+  0x95, 0xc7, 0xfc, 0x08, 0x07, 0x18, 0xdf, 0x19, 0x2b, 0xe8, 0x07, 0x4c,
+  0x34, 0x25, 0xca, 0x07, 0x06, 0x36, 0x30, 0xdb, 0x0a, 0xd0, 0x06, 0xe0,
+  0xf2, 0x0d, 0xd8, 0xfd, 0xeb, 0xdf, 0xf5, 0xfd, 0x37, 0x34, 0xf0, 0xd0,
+  0xf8, 0xdc, 0xf3, 0xe2, 0x0b, 0xf0, 0xd6, 0xff, 0x13, 0x1b, 0xf5, 0x08,
+  0xf3, 0xf7, 0x00, 0x03, 0x14, 0x0e, 0xf7, 0xb1, 0xf5, 0xf7, 0x07, 0x05,
+  0xf5, 0xe9, 0x1a, 0xff, 0xd5, 0xdf, 0x1f, 0xee, 0xe2, 0x3b, 0xf4, 0x1a,
+  0x2d, 0x06, 0x06, 0xfb, 0x3b, 0x30, 0xfc, 0x3f, 0xf4, 0x09, 0xe7, 0x0e,
+  0xe9, 0xd4, 0x30, 0xf4, 0x03, 0xf3, 0xe8, 0x02, 0xf0, 0xed, 0xf8, 0x02,
+  0x31, 0x2d, 0xf6, 0xf2, 0xd8, 0x1d, 0xe5, 0x1b, 0xe7, 0xea, 0xde, 0xd8,
+  0x02, 0xee, 0xf6, 0xf4, 0x03, 0xec, 0x2b, 0xf4, 0xdc, 0xe4, 0xf4, 0xf2,
+  0x36, 0x0b, 0x26, 0xf9, 0xf4, 0xec, 0x50, 0x03, 0xe6, 0xf1, 0x0d, 0xe3,
+  0xfd, 0x1f, 0x20, 0xf8, 0x19, 0x28, 0x07, 0xe5, 0x2f, 0x33, 0xfe, 0x21,
+  0xe0, 0x26, 0x16, 0xd5, 0x06, 0x06, 0x4d, 0x08, 0x0a, 0xea, 0xee, 0x12,
+  0xfd, 0xf1, 0x06, 0xda, 0xfb, 0x2a, 0x19, 0x19, 0xe1, 0x02, 0xe7, 0x14,
+  0xff, 0xf2, 0xea, 0xf5, 0xf2, 0xe6, 0xf3, 0xde, 0x03, 0x33, 0x0a, 0x03,
+  0xd1, 0x0d, 0xed, 0xf7, 0x05, 0xe6, 0x28, 0xfa, 0xef, 0xd4, 0x15, 0xdd,
+  0x3c, 0x37, 0xcb, 0x11, 0xcf, 0xcf, 0xea, 0x03, 0xf7, 0xf6, 0xf6, 0xbf,
+  0x33, 0xe3, 0x2f, 0xf0, 0x2e, 0xe0, 0x12, 0x03, 0xbb, 0x14, 0xc5, 0xdf,
+  0xe2, 0xdb, 0xf5, 0x19, 0xe7, 0x01, 0xb3, 0xe8, 0x22, 0xf4, 0xf2, 0xc9,
+  0xb2, 0xf7, 0xec, 0xab, 0x00, 0xe2, 0xc3, 0x18, 0xee, 0x09, 0xe0, 0xd0,
+  0x0a, 0x0d, 0x03, 0xbd, 0x34, 0xbf, 0xc2, 0x0f, 0x02, 0x2e, 0xfc, 0xfe,
+  0xc8, 0x12, 0xc4, 0xc5, 0x6d, 0x2a, 0xe2, 0x03, 0xe5, 0x10, 0x3c, 0x02,
+  0x37, 0xf6, 0xce, 0x03, 0x08, 0xeb, 0x33, 0x12, 0xdf, 0xe2, 0x15, 0x18,
+  0xea, 0x09, 0x0f, 0xfb, 0xe0, 0xf7, 0x1e, 0xb3, 0xf5, 0x18, 0xed, 0xcc,
+  0xe8, 0xe0, 0x0e, 0x04, 0xa5, 0xf0, 0xdf, 0xc9, 0xec, 0x1a, 0x11, 0x23,
+  0xcf, 0xd2, 0xff, 0xb9, 0xeb, 0x3f, 0xfe, 0xbc, 0xc5, 0xbd, 0x17, 0xe8,
+  0xfc, 0x6d, 0xff, 0x20, 0x44, 0xea, 0x15, 0xd1, 0x57, 0x28, 0xec, 0xcc,
+  0xcd, 0x1c, 0xff, 0x1a, 0x14, 0xf5, 0xe3, 0xdc, 0x4b, 0x4c, 0xdd, 0xe1,
+  0xf2, 0x1c, 0xfb, 0x21, 0x28, 0x34, 0xcc, 0xfd, 0x2b, 0x3a, 0x08, 0xb5,
+  0xc2, 0x1d, 0x9e, 0xcd, 0x3d, 0xfb, 0x17, 0x00, 0xba, 0x07, 0xdf, 0x3c,
+  0xe0, 0x12, 0xeb, 0x16, 0x13, 0xca, 0x23, 0xf8, 0x27, 0x49, 0xcf, 0xce,
+  0xe7, 0xd8, 0xdb, 0xa5, 0x21, 0x3c, 0xcc, 0xd5, 0x30, 0xc4, 0xd6, 0xfd,
+  0xe1, 0xfc, 0x2b, 0x0c, 0xf4, 0xfd, 0xba, 0x7f, 0xe4, 0x1f, 0xfa, 0xde,
+  0x2c, 0x28, 0xf6, 0x2d, 0xc0, 0xf6, 0xfe, 0x2a, 0xec, 0x2b, 0xd8, 0xdf,
+  0xcf, 0xde, 0x10, 0x3e, 0xfe, 0xe4, 0x1d, 0xd4, 0xed, 0x11, 0x12, 0xf2,
+  0xe0, 0x05, 0x2d, 0xc8, 0xfb, 0xc0, 0xe0, 0x43, 0x21, 0xdb, 0xef, 0xf6,
+  0x07, 0x42, 0xf6, 0xf2, 0x14, 0x0b, 0xf6, 0x28, 0x26, 0x64, 0x1c, 0xcd,
+  0x97, 0x57, 0xa1, 0xc5, 0xe0, 0xc5, 0x4e, 0xeb, 0x07, 0x3a, 0x16, 0x04,
+  0x05, 0x06, 0xeb, 0x1d, 0xb5, 0x0d, 0xc1, 0x0f, 0xd0, 0xaa, 0xdf, 0x00,
+  0xb3, 0x1a, 0xfa, 0xcd, 0xc8, 0xfc, 0x36, 0xee, 0x2c, 0xe0, 0x2f, 0xc0,
+  0x2c, 0xe8, 0x0c, 0xef, 0x18, 0xf3, 0x05, 0xb1, 0xd7, 0x95, 0x0a, 0x28,
+  0x40, 0xcb, 0x05, 0xde, 0xc5, 0x33, 0x18, 0x1a, 0xca, 0xfa, 0xec, 0xd0,
+  0xe8, 0x2d, 0x1b, 0x04, 0x71, 0x04, 0x28, 0xef, 0xfb, 0x9a, 0x16, 0xd0,
+  0xda, 0x05, 0xeb, 0x1d, 0x00, 0xfd, 0xd2, 0x06, 0xeb, 0x09, 0xd1, 0xf5,
+  0xe8, 0xec, 0x17, 0xe8, 0x1f, 0x0f, 0x06, 0xf2, 0xf4, 0x07, 0xf7, 0xce,
+  0x14, 0x19, 0x14, 0xb5, 0x22, 0xde, 0x3e, 0x42, 0x09, 0xeb, 0x02, 0x13,
+  0xc3, 0xbc, 0x34, 0x06, 0x3e, 0xf8, 0x17, 0x61, 0xd3, 0x53, 0xbc, 0xf8,
+  0xcf, 0x15, 0xf7, 0xac, 0x2b, 0x00, 0x22, 0xed, 0x19, 0x33, 0x2f, 0x0a,
+  0xdb, 0xf6, 0xff, 0x03, 0xf2, 0xf2, 0xed, 0x28, 0xf1, 0xf9, 0xd0, 0x36,
+  0x1f, 0xd2, 0xda, 0x3f, 0x09, 0x5c, 0xea, 0x11, 0x27, 0x0b, 0x02, 0xfd,
+  0x11, 0xeb, 0x0d, 0x1d, 0x13, 0x02, 0xf8, 0x26, 0xfb, 0xe2, 0x19, 0x05,
+  0x02, 0x14, 0x05, 0xe1, 0xc4, 0xe7, 0x0a, 0x9f, 0xf6, 0x12, 0x0b, 0xcc,
+  0xef, 0xd6, 0xec, 0x16, 0xe9, 0xf2, 0x24, 0x30, 0xee, 0x20, 0x09, 0xd9,
+  0x95, 0x27, 0xd1, 0x07, 0x9d, 0x9b, 0xd3, 0x0a, 0x73, 0xe9, 0xcf, 0x5b,
+  0x05, 0x38, 0xe8, 0x02, 0xb2, 0xd9, 0xe3, 0x1a, 0xc7, 0x4d, 0x23, 0xfc,
+  0x20, 0x69, 0xc4, 0xc8, 0xf1, 0xfe, 0x1a, 0xf9, 0x17, 0x1d, 0x1c, 0x50,
+  0xcb, 0xcd, 0xd2, 0x01, 0x41, 0xcf, 0x30, 0x01, 0xdd, 0xf4, 0xf6, 0x0c,
+  0xe9, 0x66, 0x00, 0xe1, 0xc7, 0x06, 0xe8, 0x4b, 0xeb, 0xee, 0x06, 0x00,
+  0xe0, 0xfa, 0xc7, 0xf4, 0x3f, 0x07, 0x0a, 0xf4, 0xf5, 0x8e, 0xff, 0xef,
+  0x07, 0xe9, 0xef, 0x2d, 0xde, 0x27, 0xef, 0x21, 0xea, 0xe7, 0x05, 0x32,
+  0xbc, 0x45, 0x17, 0xfa, 0xdd, 0xc8, 0x12, 0x13, 0xe7, 0x17, 0x0c, 0xf9,
+  0xf4, 0x01, 0x38, 0xcb, 0xd0, 0xd7, 0x16, 0xfa, 0x1c, 0xcd, 0x3f, 0xf7,
+  0x0b, 0xe2, 0x28, 0x15, 0xd8, 0x49, 0xdd, 0x09, 0xb9, 0x29, 0xbe, 0x02,
+  0x0b, 0x02, 0x0d, 0x0b, 0x0d, 0x31, 0xc0, 0xd8, 0xf4, 0xf4, 0x05, 0x13,
+  0xf9, 0xe4, 0x3c, 0xea, 0x3f, 0xa2, 0x1f, 0x08, 0xea, 0x28, 0x17, 0xf2,
+  0x14, 0x00, 0xf3, 0xeb, 0x37, 0x17, 0xde, 0x2a, 0xd9, 0xf6, 0x4a, 0x21,
+  0x23, 0x08, 0xd3, 0x06, 0xe5, 0x00, 0x14, 0x35, 0xc2, 0x08, 0xf7, 0x0a,
+  0xc2, 0xe7, 0x22, 0xe1, 0xf8, 0x02, 0xe7, 0x4a, 0x0b, 0x04, 0x40, 0x2d,
+  0x0c, 0x10, 0xe2, 0x16, 0xed, 0xe5, 0xfe, 0x01, 0xec, 0x0f, 0xf8, 0x19,
+  0xb0, 0x2a, 0xce, 0xe6, 0x07, 0xf8, 0xf8, 0xdf, 0x1c, 0xcc, 0x17, 0xec,
+  0xd4, 0x1d, 0xdc, 0x1e, 0x0e, 0x29, 0x0f, 0xf8, 0x24, 0xf7, 0x0c, 0x2d,
+  0xee, 0xf3, 0x20, 0xf3, 0x17, 0x0f, 0xe7, 0x06, 0xaf, 0xe0, 0x42, 0xfb,
+  0xee, 0x1c, 0x10, 0x08, 0xf2, 0xf6, 0xf6, 0xdb, 0x12, 0xdb, 0xe2, 0xfd,
+  0x32, 0x1f, 0x36, 0x16, 0xd0, 0xee, 0x15, 0xee, 0x10, 0xbd, 0x22, 0xf0,
+  0xd6, 0xfe, 0x0d, 0x23, 0xe4, 0xe7, 0xef, 0xc7, 0x02, 0x45, 0xf5, 0xd7,
+  0x0c, 0x27, 0x12, 0xc7, 0x21, 0x06, 0xd2, 0x0e, 0xdb, 0x11, 0x39, 0x23,
+  0xd4, 0xea, 0x4f, 0x09, 0x16, 0xf8, 0x06, 0xe4, 0xc5, 0x0b, 0x0b, 0x36,
+  0xcb, 0xd7, 0x16, 0xd2, 0x28, 0xdc, 0x36, 0xf5, 0xdc, 0x06, 0xd4, 0xf6,
+  0xfc, 0xff, 0xff, 0xd8, 0xf4, 0x02, 0x21, 0xcd, 0xb4, 0xeb, 0x42, 0xd8,
+  0x15, 0xe8, 0x32, 0xd7, 0xe3, 0xe7, 0x16, 0xfd, 0xff, 0xe6, 0xf5, 0x05,
+  0x1c, 0xea, 0xf3, 0xf3, 0x07, 0xc6, 0x09, 0xf1, 0xea, 0xec, 0xd3, 0x24,
+  0xeb, 0x21, 0xda, 0xef, 0xe7, 0xfb, 0xeb, 0x1e, 0xde, 0xd5, 0x50, 0xf3,
+  0x31, 0x09, 0x09, 0x0b, 0xdb, 0xe5, 0x0f, 0x16, 0xaa, 0xb1, 0xf5, 0x51,
+  0x0e, 0xda, 0x0e, 0x27, 0xf0, 0x45, 0xe5, 0xff, 0xe7, 0xe9, 0x0d, 0x06,
+  0xfb, 0xf6, 0x04, 0xf4, 0x31, 0x20, 0x13, 0xf4, 0xd7, 0x54, 0x0f, 0xf4,
+  0xe2, 0xf3, 0xee, 0xe7, 0x32, 0x03, 0xe3, 0xe5, 0x2d, 0xe4, 0x1a, 0xdb,
+  0xd0, 0x03, 0xd0, 0x02, 0x36, 0x2a, 0x0d, 0x03, 0x04, 0xdf, 0x0d, 0x05,
+  0xe5, 0xec, 0x13, 0xfc, 0xff, 0xe8, 0xf9, 0xea, 0x07, 0xac, 0xfb, 0xe7,
+  0x1e, 0x0e, 0x0d, 0x1b, 0xd7, 0xfa, 0x12, 0xdc, 0xef, 0xe0, 0xd3, 0xb7,
+  0xfc, 0x43, 0x0f, 0xe8, 0x0a, 0xf9, 0x0e, 0xfc, 0x0e, 0xf2, 0x37, 0xc4,
+  0xbb, 0x11, 0xe2, 0x2b, 0xf6, 0xd9, 0x0e, 0xd1, 0x0a, 0x0b, 0xd1, 0xef,
+  0xfd, 0x0c, 0x3e, 0xeb, 0xdf, 0xfc, 0xf4, 0x2d, 0x21, 0xfd, 0x1b, 0xfc,
+  0xc7, 0xd4, 0x26, 0xda, 0x0d, 0x2f, 0xf6, 0x08, 0xd1, 0x0f, 0xf2, 0xe9,
+  0x04, 0xd8, 0x11, 0xfb, 0x0c, 0x18, 0x2b, 0x19, 0xdb, 0xed, 0xc2, 0xef,
+  0x2f, 0xe0, 0xeb, 0xff, 0xe8, 0x52, 0x09, 0xf4, 0xfa, 0x17, 0xf8, 0x21,
+  0x00, 0x5d, 0x3f, 0x01, 0xf0, 0xd3, 0xfb, 0x27, 0x0a, 0xc1, 0x55, 0x2b,
+  0xff, 0xa4, 0xf6, 0xf5, 0xd8, 0x41, 0xdf, 0xcb, 0xca, 0xfb, 0x18, 0x08,
+  0xde, 0x3a, 0xd3, 0x37, 0xfd, 0x0b, 0xe1, 0x0c, 0xcb, 0xda, 0x15, 0xf3,
+  0x40, 0x0e, 0x22, 0x08, 0xba, 0xc6, 0xd5, 0xf8, 0x15, 0xe7, 0xc7, 0x31,
+  0x47, 0x06, 0xde, 0x17, 0x26, 0x7f, 0x01, 0xbe, 0xc4, 0xbc, 0x13, 0xed,
+  0xd7, 0x01, 0x31, 0x05, 0xcb, 0xe4, 0x48, 0xe8, 0xdc, 0x09, 0xf2, 0xf3,
+  0xf8, 0xff, 0xd0, 0x0d, 0x38, 0xd3, 0xde, 0x08, 0x15, 0x02, 0x08, 0xfb,
+  0xef, 0xe9, 0xe3, 0xe3, 0xda, 0x1b, 0xe7, 0x0a, 0x2f, 0xf4, 0x06, 0x15,
+  0x2b, 0x12, 0xdf, 0x18, 0x06, 0xf8, 0x26, 0xf5, 0xf9, 0xeb, 0xfb, 0xd7,
+  0x38, 0xff, 0xf0, 0x46, 0x16, 0xf5, 0xe2, 0x12, 0xd5, 0x1b, 0xe6, 0xb0,
+  0xfe, 0xee, 0xf5, 0xe9, 0x17, 0x0b, 0xf3, 0x1e, 0xe1, 0x01, 0x14, 0xf4,
+  0x09, 0x1d, 0xf2, 0x06, 0x27, 0x03, 0x03, 0xe2, 0x11, 0xe2, 0xf4, 0xfe,
+  0x46, 0xfc, 0x35, 0x2e, 0xed, 0xf2, 0xd6, 0xd2, 0xea, 0xc2, 0xed, 0x30,
+  0xc5, 0x01, 0x1a, 0x9c, 0x25, 0x51, 0xf3, 0x25, 0xaf, 0x17, 0x15, 0xb0,
+  0xf6, 0x33, 0x19, 0x18, 0xd9, 0xbb, 0x17, 0x1c, 0xeb, 0xf3, 0xd2, 0x23,
+  0x31, 0xa9, 0xfc, 0x2c, 0x3a, 0x6c, 0xf1, 0xe9, 0x18, 0x11, 0xa6, 0x37,
+  0x12, 0x54, 0xfb, 0x23, 0x0a, 0x20, 0x20, 0x10, 0xe0, 0x04, 0xeb, 0x08,
+  0xc5, 0x0c, 0xef, 0xe7, 0xe9, 0xf6, 0xba, 0xe8, 0xed, 0x00, 0xd3, 0xf4,
+  0x07, 0x31, 0x0e, 0xd3, 0xe3, 0x11, 0xd2, 0xfd, 0xf1, 0xdd, 0x10, 0x0c,
+  0x13, 0x31, 0xe1, 0x21, 0x15, 0x14, 0x03, 0xef, 0x16, 0xd5, 0x45, 0x22,
+  0x29, 0xfa, 0xf0, 0x04, 0x30, 0xb8, 0x14, 0xd6, 0xe5, 0x13, 0x0f, 0x2a,
+  0xdf, 0x2c, 0xb4, 0xee, 0xd7, 0xf9, 0x43, 0xd9, 0xde, 0x11, 0xe1, 0x1c,
+  0xe0, 0xf1, 0xef, 0xb6, 0xd8, 0xf1, 0xd8, 0xcd, 0x02, 0x03, 0xda, 0x16,
+  0x31, 0xed, 0x01, 0x30, 0x0f, 0xfd, 0x0a, 0xb0, 0xfa, 0xf5, 0xe4, 0x23,
+  0x1f, 0x1e, 0x1d, 0x0d, 0xff, 0x32, 0xe1, 0x0d, 0x35, 0x1e, 0x26, 0x25,
+  0x27, 0xc5, 0x26, 0x17, 0xf3, 0xec, 0xe0, 0xf5, 0x0f, 0xe0, 0xd0, 0x01,
+  0xc7, 0x09, 0x33, 0xf4, 0x05, 0x04, 0xc7, 0xfc, 0xcd, 0xda, 0x3b, 0xf4,
+  0xb7, 0xfb, 0xd5, 0xf8, 0xb8, 0x03, 0xea, 0xf6, 0xf5, 0x06, 0x1e, 0xef,
+  0x05, 0x33, 0x12, 0xf6, 0xd4, 0x10, 0xfe, 0x0f, 0xfe, 0xf8, 0xe7, 0xdf,
+  0xe2, 0xeb, 0x12, 0x21, 0xcb, 0xd2, 0xfe, 0x15, 0x2e, 0x49, 0x13, 0x24,
+  0x3c, 0xef, 0x56, 0x1b, 0x10, 0xc6, 0x06, 0xf7, 0xe2, 0xfb, 0xd5, 0xe5,
+  0x0a, 0xe9, 0xe7, 0x2e, 0xfb, 0x0a, 0x3b, 0xe1, 0xf3, 0x0b, 0xd0, 0xd4,
+  0x18, 0xb8, 0xf4, 0x15, 0x0c, 0xd4, 0xe3, 0x06, 0xef, 0xd6, 0xd4, 0xad,
+  0x1d, 0x07, 0xbf, 0xdd, 0x06, 0xe2, 0xd2, 0xde, 0x3c, 0x21, 0xe1, 0x1d,
+  0x13, 0x40, 0xf0, 0x0b, 0xf0, 0x05, 0x0c, 0x3a, 0xf5, 0xf1, 0x1d, 0xdc,
+  0xed, 0x21, 0xff, 0x09, 0x0c, 0xf8, 0xf5, 0xfb, 0x26, 0xf2, 0x33, 0x31,
+  0x7f, 0x19, 0xe2, 0xe9, 0x2f, 0xe7, 0x0c, 0x1c, 0x0a, 0x27, 0xdf, 0xf0,
+  0xec, 0x43, 0xde, 0xfe, 0xe3, 0x1a, 0x2c, 0xd9, 0x0e, 0xf9, 0xcd, 0x29,
+  0xa1, 0x16, 0xfa, 0xdc, 0x28, 0xdb, 0xb4, 0xc3, 0x1f, 0x10, 0xe7, 0x08,
+  0xf7, 0xf8, 0xc9, 0x38, 0x14, 0x02, 0x0c, 0x05, 0xf9, 0x0c, 0x03, 0x14,
+  0xf5, 0x18, 0x11, 0xcc, 0xd7, 0x1c, 0xe6, 0x00, 0xe0, 0x0b, 0x19, 0xfc,
+  0x54, 0xd3, 0x09, 0xe5, 0x08, 0x6b, 0xc0, 0x11, 0x00, 0x08, 0x06, 0x15,
+  0x00, 0xef, 0x0e, 0xde, 0x0d, 0x1d, 0xda, 0xf6, 0xfa, 0x10, 0x1d, 0x22,
+  0x1e, 0xfc, 0x01, 0xe7, 0xd3, 0x02, 0x43, 0x3c, 0x64, 0xfd, 0xdf, 0xec,
+  0x23, 0x26, 0xe8, 0xe1, 0xf1, 0x02, 0xb2, 0xef, 0x0c, 0x11, 0x16, 0x40,
+  0x15, 0x0d, 0x2b, 0x15, 0xf2, 0xbf, 0xfa, 0x06, 0xca, 0xf9, 0x11, 0x1b,
+  0xf2, 0xe7, 0x0e, 0x05, 0x16, 0xda, 0x14, 0xd9, 0x09, 0x26, 0xe9, 0xef,
+  0xfa, 0xdf, 0xf6, 0xe2, 0x22, 0xd3, 0x1e, 0x07, 0x22, 0x23, 0xd7, 0xe7,
+  0x2d, 0xe4, 0x25, 0x0a, 0x0e, 0x08, 0xef, 0x11, 0xe2, 0x46, 0x0f, 0x16,
+  0xd0, 0x34, 0x0f, 0x25, 0x20, 0x05, 0xd4, 0xfe, 0x16, 0x16, 0x1b, 0x11,
+  0x12, 0x16, 0xd1, 0x07, 0x03, 0xcb, 0x22, 0x0a, 0x36, 0x29, 0x3e, 0xe2,
+  0x12, 0xe8, 0xdd, 0x03, 0x23, 0xfb, 0xba, 0xc8, 0xc8, 0x27, 0xfd, 0xec,
+  0x16, 0x14, 0x1b, 0x1b, 0x0b, 0xf7, 0x14, 0x45, 0xd9, 0xf0, 0x05, 0x2b,
+  0xb2, 0xe5, 0xd8, 0xf1, 0xf8, 0xe2, 0x4e, 0xec, 0xd0, 0xd0, 0xc0, 0xfd,
+  0x0d, 0xde, 0xf3, 0xfc, 0xfb, 0xec, 0xef, 0x1e, 0xfa, 0x26, 0xfd, 0x0b,
+  0xf8, 0x05, 0xdd, 0x09, 0x12, 0x29, 0xf3, 0x15, 0x52, 0xe1, 0x11, 0x04,
+  0x03, 0x00, 0x02, 0xdf, 0x1c, 0xdd, 0xc4, 0x2d, 0xfe, 0xfa, 0xe2, 0xb0,
+  0xd1, 0x25, 0xdb, 0xfd, 0xcb, 0x0f, 0xe8, 0x3b, 0xb9, 0xf5, 0x09, 0x3b,
+  0x00, 0xbb, 0xe0, 0x26, 0xd4, 0xf5, 0xef, 0xe5, 0x00, 0x09, 0x2c, 0x3c,
+  0x1f, 0xe1, 0xd4, 0xfa, 0x00, 0xec, 0x56, 0x03, 0xe6, 0x01, 0x0b, 0x04,
+  0xfc, 0x1d, 0x00, 0xf5, 0xf6, 0x11, 0xf9, 0x07, 0x40, 0xf7, 0xf9, 0x3f,
+  0x53, 0xce, 0xf8, 0xdb, 0xde, 0xf9, 0xa0, 0x0f, 0x19, 0xc8, 0xed, 0x1d,
+  0x0d, 0x0c, 0xdf, 0xe3, 0xce, 0x1b, 0xf7, 0xf6, 0xcc, 0x02, 0xe4, 0x05,
+  0xee, 0xde, 0x16, 0xe6, 0x33, 0xbf, 0x0e, 0x32, 0x0c, 0xeb, 0x0b, 0xed,
+  0x0d, 0x1f, 0x25, 0x11, 0x03, 0xee, 0xe9, 0x29, 0xe1, 0x14, 0x06, 0x0b,
+  0xc2, 0x18, 0x27, 0xb4, 0xeb, 0xe5, 0xe8, 0xcd, 0xd2, 0xec, 0xf6, 0xba,
+  0x18, 0xd0, 0x40, 0xeb, 0x46, 0x22, 0xef, 0xf1, 0xc5, 0x37, 0x52, 0x06,
+  0xd9, 0xea, 0xcd, 0x4c, 0xe3, 0xfe, 0xce, 0xbf, 0xf4, 0xf9, 0xe9, 0xe5,
+  0xe4, 0x0b, 0xf0, 0xf6, 0xe9, 0xfd, 0x07, 0xfb, 0xf3, 0x18, 0x11, 0x0d,
+  0x0a, 0x06, 0xdf, 0x2f, 0xf9, 0x02, 0x04, 0x17, 0xf0, 0x05, 0xcc, 0xf8,
+  0xc3, 0xf3, 0x10, 0x16, 0xd8, 0xec, 0x0f, 0xdd, 0x09, 0xeb, 0x2c, 0xe4,
+  0xfc, 0xea, 0xe0, 0xe8, 0x0b, 0x14, 0x16, 0xc4, 0x1c, 0x18, 0x06, 0x19,
+  0xbc, 0x31, 0x1e, 0x03, 0x81, 0x24, 0xea, 0x13, 0xf3, 0x1c, 0xcc, 0xd5,
+  0x2c, 0xe9, 0xf4, 0x01, 0x10, 0xe9, 0xcb, 0x08, 0x03, 0xfa, 0x03, 0xf3,
+  0xed, 0x41, 0x22, 0x01, 0x15, 0xf2, 0x4b, 0xf7, 0x0d, 0x30, 0x07, 0xe2,
+  0x0b, 0xeb, 0xd1, 0x15, 0x0f, 0x26, 0xeb, 0xfe, 0x15, 0x06, 0x02, 0xa7,
+  0xfc, 0x24, 0xfc, 0x0d, 0xd7, 0x0f, 0xd8, 0xf5, 0x32, 0xd9, 0x0f, 0xc5,
+  0x31, 0x19, 0xfd, 0xd8, 0x5a, 0x01, 0x71, 0xc6, 0xd6, 0x39, 0xfe, 0xcf,
+  0xc8, 0x11, 0xca, 0xdd, 0x17, 0xed, 0x09, 0x1b, 0xdb, 0x07, 0xea, 0xd7,
+  0xf4, 0x1b, 0xf3, 0x2b, 0xfa, 0xec, 0x06, 0x0a, 0xd8, 0x14, 0x0d, 0x01,
+  0xf0, 0x38, 0x18, 0xd9, 0xda, 0x07, 0xfb, 0x0b, 0xd1, 0xf1, 0xfe, 0x05,
+  0xe0, 0xff, 0x0f, 0x3a, 0xea, 0xf5, 0x0f, 0xe4, 0xe5, 0xd9, 0x0c, 0xeb,
+  0x1c, 0xcb, 0xfe, 0xfa, 0x27, 0x01, 0xc7, 0x05, 0xfe, 0x16, 0x12, 0x0b,
+  0xf1, 0x27, 0xe2, 0xef, 0xf1, 0xe6, 0xff, 0xda, 0xbe, 0xef, 0xff, 0x26,
+  0x34, 0x27, 0xe2, 0xfe, 0xf3, 0x13, 0xf1, 0xe8, 0x16, 0x25, 0xed, 0x10,
+  0xeb, 0x37, 0xe0, 0x12, 0x1e, 0xfd, 0x33, 0x2f, 0x05, 0x02, 0xc5, 0xc8,
+  0x08, 0xeb, 0x00, 0x28, 0x14, 0xc7, 0x19, 0x2f, 0xc5, 0xe9, 0x35, 0xe6,
+  0xff, 0xde, 0xeb, 0xe2, 0x07, 0x21, 0x14, 0x0d, 0x36, 0x12, 0xd9, 0xe7,
+  0xe9, 0x07, 0xd4, 0xf2, 0xec, 0x06, 0xf7, 0xe1, 0xef, 0x0b, 0xe0, 0xee,
+  0x18, 0xf7, 0xd5, 0xff, 0x18, 0x36, 0xa8, 0x1e, 0xe0, 0x0e, 0xeb, 0xe0,
+  0xfc, 0x1e, 0xe3, 0x0f, 0xe9, 0x0f, 0x21, 0xe4, 0xe6, 0x0d, 0x25, 0x07,
+  0x3d, 0xd0, 0xe3, 0xfd, 0xd6, 0x21, 0xcb, 0x18, 0xea, 0xff, 0x0f, 0x1d,
+  0xeb, 0x12, 0xf9, 0x0f, 0xba, 0xec, 0xf7, 0xf3, 0xee, 0x09, 0x2b, 0x0a,
+  0xf2, 0xcf, 0xf7, 0xf2, 0x08, 0xc2, 0x1a, 0xfb, 0xf1, 0x1c, 0x05, 0xf7,
+  0x2e, 0x0d, 0xf4, 0xe2, 0xdc, 0xe6, 0xf7, 0x28, 0xde, 0x1e, 0xe2, 0xe0,
+  0xd8, 0x21, 0xe1, 0x33, 0x13, 0xf6, 0xff, 0x1e, 0xe4, 0xdb, 0x12, 0xf5,
+  0xec, 0x41, 0x1c, 0x15, 0x0e, 0x05, 0x2d, 0xf4, 0xee, 0xee, 0xbf, 0xfe,
+  0x1f, 0x21, 0xef, 0x74, 0xf0, 0xf4, 0xde, 0xfe, 0xfb, 0xc7, 0xc7, 0xad,
+  0x0f, 0x1f, 0xfc, 0xcf, 0x1a, 0xdb, 0xdc, 0x08, 0xad, 0xf0, 0x2b, 0x28,
+  0x36, 0x1d, 0xff, 0xdf, 0xc9, 0xbf, 0x1c, 0xe2, 0xc9, 0x07, 0xe9, 0x0e,
+  0x32, 0xf0, 0xdc, 0x0a, 0xf9, 0xf9, 0xf0, 0x00, 0x23, 0xe5, 0xe5, 0xde,
+  0xd7, 0x47, 0xff, 0xf9, 0x27, 0xde, 0x43, 0x27, 0xf7, 0x0f, 0xf5, 0xe6,
+  0x3a, 0x12, 0x1b, 0x66, 0x50, 0xdb, 0xcc, 0x5c, 0xc9, 0xe4, 0x1e, 0x0e,
+  0x00, 0xd0, 0xd3, 0xf4, 0xfd, 0x4c, 0x22, 0x0c, 0x24, 0xd8, 0xdb, 0xda,
+  0xe6, 0xea, 0xcc, 0x0f, 0x1e, 0x06, 0x04, 0xd0, 0x29, 0xe2, 0xe7, 0xf7,
+  0xdd, 0xe0, 0xe4, 0x02, 0xf1, 0x2c, 0xef, 0x0f, 0xeb, 0x03, 0xd7, 0xd4,
+  0x38, 0x27, 0xe8, 0x04, 0xe8, 0x22, 0x49, 0xf5, 0x05, 0xf8, 0x38, 0xe0,
+  0xf7, 0xd8, 0xef, 0x24, 0x35, 0x3b, 0xe4, 0x64, 0x0d, 0x1a, 0xe1, 0x49,
+  0xd3, 0x18, 0x06, 0x24, 0xf1, 0xcd, 0xe1, 0xf5, 0x16, 0x30, 0x46, 0x00,
+  0xf9, 0xcb, 0xcd, 0xd1, 0xd4, 0xb8, 0xee, 0x19, 0x5a, 0xc8, 0xff, 0xf8,
+  0xdf, 0xda, 0xf1, 0x0a, 0xb1, 0xe9, 0xf6, 0x08, 0xfd, 0x24, 0xe1, 0xdf,
+  0xe9, 0x1e, 0xf0, 0xf5, 0x33, 0x26, 0xd7, 0x17, 0x12, 0xf9, 0x14, 0xe7,
+  0xd9, 0x3b, 0x1a, 0xda, 0xf4, 0x08, 0x1c, 0xfa, 0x3a, 0x19, 0xdb, 0x45,
+  0xdd, 0xed, 0x2f, 0x56, 0xe3, 0x13, 0x0f, 0x04, 0x23, 0xd6, 0xde, 0x01,
+  0xb1, 0xd5, 0x5b, 0xdf, 0xef, 0x13, 0x16, 0xd6, 0x1e, 0xd5, 0xf2, 0xff,
+  0x14, 0x27, 0xa8, 0xeb, 0xe7, 0xb3, 0xe0, 0xa3, 0xe5, 0x2a, 0x12, 0xe0,
+  0x0f, 0x3a, 0xb3, 0x22, 0xf7, 0xb9, 0xe0, 0x29, 0xfe, 0xf3, 0xd8, 0xf2,
+  0xef, 0xc4, 0x1b, 0x29, 0x24, 0x09, 0x1a, 0x46, 0x39, 0xf5, 0x35, 0x42,
+  0x3a, 0x0b, 0x05, 0xcc, 0x0f, 0x38, 0xd4, 0xfb, 0xd4, 0x02, 0x24, 0xf6,
+  0x10, 0xd9, 0x07, 0x37, 0xf1, 0xd5, 0x27, 0xe1, 0x27, 0x19, 0xb3, 0xc3,
+  0x0c, 0x23, 0xc6, 0x2a, 0x23, 0x1c, 0xdf, 0x00, 0xe9, 0xa2, 0x09, 0xc2,
+  0xf0, 0x3a, 0xe0, 0x17, 0xe5, 0x2b, 0xb1, 0x3a, 0x03, 0xd1, 0xfa, 0x32,
+  0x0f, 0x4b, 0xca, 0x5c, 0xda, 0xed, 0x32, 0x1a, 0xff, 0x02, 0x1d, 0x5d,
+  0x14, 0x36, 0x20, 0x1f, 0x13, 0xd4, 0xe1, 0xb6, 0x25, 0xf6, 0xf7, 0x51,
+  0xa4, 0xf0, 0xe4, 0xb9, 0x1a, 0xc1, 0x07, 0x4d, 0x8f, 0x15, 0x3d, 0xe6,
+  0x38, 0x08, 0x12, 0xd1, 0x21, 0xd6, 0xdd, 0x27, 0xe2, 0x29, 0xbb, 0xde,
+  0xc3, 0xaa, 0xfb, 0xc2, 0x1e, 0xcc, 0xf5, 0x0f, 0x06, 0x10, 0xc7, 0x22,
+  0x0f, 0xd2, 0x0c, 0x1d, 0xe2, 0x43, 0xde, 0x1a, 0xeb, 0xde, 0x47, 0x14,
+  0x14, 0xdd, 0x21, 0x29, 0x17, 0xfd, 0xd3, 0x0b, 0xf7, 0xd5, 0x23, 0xcd,
+  0xd9, 0xe9, 0x01, 0x4f, 0xe6, 0xca, 0x0e, 0x4b, 0x31, 0x29, 0xe4, 0xff,
+  0x30, 0xe0, 0x11, 0xd4, 0xd2, 0xbb, 0xd7, 0x33, 0x68, 0xf2, 0x41, 0xdc,
+  0x04, 0xfd, 0x34, 0x31, 0xd6, 0xdf, 0x00, 0xd8, 0xef, 0x45, 0x36, 0x31,
+  0xf2, 0xf7, 0x12, 0xf7, 0xbb, 0xbb, 0x20, 0x3a, 0x35, 0xfb, 0xc3, 0x0c,
+  0x2f, 0xf5, 0xbc, 0x2e, 0x4f, 0x32, 0xfb, 0xfe, 0x05, 0xf1, 0x2f, 0xe7,
+  0xdd, 0x1c, 0x18, 0x24, 0x04, 0xd7, 0xf9, 0x24, 0xda, 0xe0, 0x0b, 0x0d,
+  0x59, 0xbd, 0xea, 0xf3, 0xfd, 0x1f, 0x28, 0xf1, 0xe6, 0x03, 0xcf, 0x00,
+  0x1f, 0x1f, 0xcd, 0x1d, 0xde, 0xfe, 0x07, 0xe8, 0xfe, 0xe2, 0x2d, 0xf0,
+  0xdf, 0x24, 0xdc, 0x1c, 0xe2, 0xf5, 0xe1, 0x09, 0xf5, 0xd1, 0x08, 0x36,
+  0x40, 0x13, 0x0e, 0x38, 0x0a, 0xf6, 0x81, 0x1a, 0x39, 0x48, 0x1f, 0x26,
+  0xee, 0xdc, 0x23, 0xdc, 0xf5, 0xe4, 0xdc, 0x1e, 0x5e, 0x06, 0x10, 0x33,
+  0xe9, 0xfc, 0xfd, 0xe7, 0x25, 0xc6, 0x00, 0xdd, 0x23, 0x31, 0xfc, 0x10,
+  0x40, 0xd9, 0xf3, 0xc8, 0x24, 0xdf, 0x2a, 0x24, 0xdb, 0xe4, 0x24, 0xf0,
+  0xd1, 0xe3, 0x39, 0x24, 0x3d, 0xee, 0xda, 0xec, 0xe2, 0xf6, 0xa9, 0xea,
+  0x0f, 0xec, 0x3f, 0x04, 0x12, 0x05, 0xec, 0x25, 0x20, 0xde, 0x02, 0xe2,
+  0x1e, 0x00, 0x1e, 0x2d, 0xef, 0xd8, 0xf6, 0xbb, 0xe8, 0x01, 0x10, 0x01,
+  0x0e, 0x41, 0xc1, 0xf2, 0x03, 0x15, 0x25, 0x4f, 0x1e, 0x2b, 0xce, 0xac,
+  0x66, 0x13, 0xf8, 0xc5, 0x0c, 0xf4, 0xe6, 0xf9, 0xde, 0xde, 0x53, 0x11,
+  0x3d, 0x2d, 0xc5, 0x16, 0x39, 0xcf, 0xfa, 0xc1, 0x21, 0x0e, 0x3f, 0x0b,
+  0x44, 0x0c, 0x3f, 0xc6, 0xdc, 0xf3, 0x4e, 0x14, 0xe3, 0xd3, 0x02, 0x4f,
+  0x2a, 0x1c, 0xf4, 0x28, 0x0c, 0x1d, 0x27, 0xda, 0xe9, 0xfc, 0xca, 0xf1,
+  0xd1, 0xd6, 0xe3, 0x2b, 0x1b, 0x10, 0xfb, 0x21, 0xe3, 0x03, 0x09, 0x45,
+  0x17, 0x00, 0xf8, 0xd7, 0x60, 0x3e, 0x0d, 0x97, 0xec, 0xe2, 0xdb, 0xdd,
+  0xd7, 0xcb, 0x43, 0x07, 0x25, 0x10, 0xd5, 0x09, 0x26, 0xea, 0xfc, 0x0e,
+  0xfc, 0xee, 0x09, 0xbc, 0x31, 0xfb, 0x2f, 0xcf, 0x18, 0xed, 0x26, 0x19,
+  0x18, 0xea, 0x11, 0x2e, 0x21, 0xf7, 0xf1, 0x13, 0xf5, 0x0e, 0xe6, 0xe6,
+  0x18, 0xc8, 0xfe, 0xf2, 0xe0, 0x10, 0xa1, 0xf7, 0x52, 0x03, 0xc3, 0xe6,
+  0x05, 0x2c, 0xe8, 0x27, 0x08, 0x12, 0xd8, 0x06, 0x2b, 0xe0, 0xe4, 0xe1,
+  0x31, 0xc6, 0xd0, 0xc0, 0xb2, 0xbe, 0x22, 0xf6, 0x38, 0xee, 0x08, 0xf6,
+  0x3c, 0xf2, 0xe2, 0x1b, 0x18, 0x0b, 0xcd, 0xc8, 0xf7, 0x03, 0x2b, 0xef,
+  0x15, 0xfe, 0x10, 0xff, 0xed, 0x04, 0x1b, 0x4b, 0x34, 0xdf, 0xfd, 0xc8,
+  0xf4, 0xbb, 0x06, 0x12, 0xf2, 0xb2, 0x0c, 0xff, 0xd7, 0xf9, 0x8b, 0x26,
+  0xfd, 0xf1, 0x00, 0xc3, 0xe7, 0xec, 0xf8, 0xfe, 0xf2, 0x04, 0x3a, 0xf6,
+  0x15, 0x26, 0x08, 0xe2, 0x1e, 0x30, 0x01, 0x0e, 0x07, 0x21, 0xd6, 0x1f,
+  0xa8, 0x1c, 0x19, 0x0f, 0x2a, 0xe2, 0xf9, 0xef, 0x0d, 0x04, 0xf6, 0xf8,
+  0xdc, 0x2a, 0xf6, 0xd3, 0x09, 0xe5, 0xd8, 0xef, 0xfb, 0xe0, 0x1c, 0x10,
+  0x17, 0xe4, 0xc1, 0x01, 0x16, 0xc5, 0x05, 0x8c, 0xe7, 0xf6, 0xf1, 0xb2,
+  0x0c, 0x0e, 0xfc, 0xfd, 0x0d, 0x5e, 0xed, 0xd0, 0xf4, 0x27, 0xbc, 0xfc,
+  0xfd, 0xfd, 0x59, 0x81, 0x34, 0xd6, 0xde, 0x19, 0xf1, 0x2c, 0x0d, 0x26,
+  0xce, 0xfd, 0xd3, 0xcc, 0xed, 0x39, 0x12, 0x0c, 0x2e, 0xdf, 0xf4, 0xc2,
+  0x1d, 0xda, 0xe3, 0xba, 0x10, 0xe7, 0xdc, 0xa7, 0x01, 0xea, 0x20, 0xde,
+  0x23, 0xb8, 0x06, 0xf8, 0x0d, 0x12, 0xc9, 0xf1, 0x1d, 0x8c, 0x40, 0xa1,
+  0x1b, 0x53, 0xe6, 0xc6, 0xae, 0xe6, 0xc0, 0x1a, 0x15, 0x38, 0x05, 0xd3,
+  0xf0, 0xf7, 0xe7, 0xff, 0x04, 0xd9, 0x1c, 0xb8, 0x1b, 0x0d, 0xe1, 0x14,
+  0xef, 0x10, 0x02, 0x03, 0xfb, 0x11, 0x0a, 0xf5, 0x40, 0x1a, 0x25, 0xac,
+  0x1e, 0x05, 0xfd, 0xce, 0x19, 0x0b, 0x01, 0xf2, 0x45, 0xd3, 0x1c, 0xe9,
+  0x0b, 0x18, 0x72, 0xfe, 0xe3, 0x1a, 0xda, 0xe0, 0x36, 0x19, 0x11, 0x47,
+  0x34, 0xab, 0x13, 0xf0, 0xfa, 0x3f, 0xfd, 0xe5, 0x1b, 0x04, 0xe6, 0xfe,
+  0xe0, 0xf1, 0xe6, 0xfc, 0xf0, 0xcb, 0xde, 0xea, 0xfa, 0xff, 0x0d, 0xea,
+  0xfd, 0xfe, 0x2e, 0xd3, 0x05, 0xf7, 0xca, 0xf0, 0x49, 0x1f, 0xd4, 0x30,
+  0xc8, 0xea, 0xec, 0x76, 0x15, 0xf1, 0xd4, 0xf2, 0xee, 0xca, 0x1d, 0x21,
+  0xdd, 0xfc, 0xef, 0x36, 0x18, 0x13, 0x33, 0xf1, 0x02, 0x1b, 0x03, 0xe4,
+  0x08, 0xdf, 0x05, 0x27, 0x0f, 0x18, 0xdb, 0x9b, 0xdc, 0xfe, 0x26, 0x2d,
+  0x15, 0xf2, 0x2a, 0xd3, 0xee, 0x08, 0xe1, 0xf7, 0x32, 0x10, 0xc2, 0x0f,
+  0xf0, 0xe5, 0xc9, 0x08, 0x3d, 0xf1, 0xfd, 0xde, 0xe5, 0x35, 0xc9, 0x00,
+  0x2a, 0x03, 0xcc, 0xf5, 0xd7, 0x1f, 0x11, 0x17, 0xed, 0xcb, 0xa6, 0xb7,
+  0x0a, 0xaf, 0xb9, 0xb1, 0xc1, 0xf4, 0xcb, 0xf3, 0x0b, 0xbc, 0x19, 0x04,
+  0x4c, 0x0b, 0xed, 0x00, 0xe5, 0x2d, 0x19, 0xcf, 0x74, 0x02, 0xdc, 0xa7,
+  0x13, 0x15, 0x06, 0x40, 0xb3, 0x00, 0xd9, 0xcf, 0x2b, 0x03, 0xec, 0xfb,
+  0xff, 0xe0, 0xfd, 0x2f, 0xf9, 0xfa, 0x19, 0x2e, 0x7e, 0xee, 0x17, 0xec,
+  0xd4, 0x07, 0xd2, 0xda, 0x1b, 0x36, 0xf9, 0x0f, 0x29, 0xef, 0x18, 0xb6,
+  0xd7, 0x1d, 0xe4, 0xd8, 0x15, 0x89, 0xbd, 0x07, 0xdd, 0x1d, 0x1d, 0x05,
+  0x31, 0x22, 0x59, 0xe1, 0x35, 0x3e, 0x98, 0xff, 0x28, 0x14, 0x2f, 0xe4,
+  0x24, 0xdb, 0xb4, 0x08, 0xf4, 0x05, 0x4f, 0x69, 0x2c, 0xf6, 0xe0, 0xeb,
+  0x08, 0x1d, 0xcc, 0x39, 0xf9, 0xfa, 0xfa, 0x22, 0x3a, 0x32, 0x21, 0xcf,
+  0x04, 0xd6, 0x04, 0x43, 0x25, 0x17, 0xf6, 0xb1, 0xf3, 0xe7, 0x14, 0xf5,
+  0xf4, 0xc6, 0xba, 0x1c, 0xd8, 0x0d, 0x16, 0x2b, 0xdd, 0x1d, 0x03, 0x3d,
+  0x09, 0xa2, 0xe1, 0x0f, 0x29, 0x19, 0xd9, 0xed, 0xda, 0xfe, 0xc8, 0x0c,
+  0xed, 0xe3, 0xf9, 0x35, 0xcc, 0x0e, 0xeb, 0x0b, 0xd1, 0xfb, 0xff, 0xd9,
+  0x05, 0xb4, 0x32, 0x01, 0x00, 0xe2, 0xd8, 0xef, 0xfa, 0xc5, 0xdd, 0x20,
+  0xec, 0x35, 0xe3, 0x15, 0xfb, 0x11, 0x19, 0xee, 0xee, 0x45, 0x0f, 0x1c,
+  0xff, 0xfa, 0x24, 0x23, 0x15, 0xdd, 0xc5, 0xeb, 0xcd, 0xff, 0xcb, 0xf7,
+  0xe5, 0xf7, 0xec, 0xf4, 0x01, 0xef, 0x05, 0xf1, 0x05, 0xa9, 0xc0, 0x01,
+  0x17, 0x20, 0xd7, 0x10, 0xd5, 0xee, 0xea, 0x0c, 0xfa, 0x53, 0xf3, 0x03,
+  0x0b, 0xdb, 0xdb, 0xe4, 0xc7, 0x12, 0x3c, 0xd0, 0x3a, 0x07, 0xd8, 0x1f,
+  0xf5, 0xf4, 0x0d, 0x00, 0xff, 0x0d, 0x03, 0x3a, 0x02, 0x3a, 0x05, 0xf0,
+  0xce, 0xe7, 0xee, 0xe8, 0x06, 0x08, 0xf4, 0x04, 0x2b, 0xe5, 0xed, 0xbc,
+  0xf6, 0x18, 0x10, 0xe5, 0x21, 0x16, 0xb3, 0x10, 0xdd, 0x34, 0x15, 0x01,
+  0x0b, 0x2f, 0x13, 0xf3, 0x0b, 0x1a, 0xd0, 0xf8, 0xce, 0x04, 0xfc, 0xf8,
+  0xe8, 0x60, 0xe8, 0x11, 0xf1, 0x00, 0x21, 0x19, 0x3d, 0xfd, 0x4c, 0xdf,
+  0x08, 0xdf, 0xe1, 0x19, 0x1d, 0xce, 0x18, 0xfc, 0x0d, 0x02, 0xf6, 0x02,
+  0xd3, 0x47, 0xe3, 0x05, 0x3d, 0x1a, 0xaa, 0xdb, 0x1f, 0xe9, 0x12, 0xaf,
+  0x13, 0xd0, 0x00, 0x0b, 0xd4, 0xe6, 0xd4, 0xd5, 0xfd, 0x19, 0x0b, 0xfd,
+  0x29, 0xe5, 0xe9, 0xfb, 0x15, 0x0f, 0xf5, 0x34, 0x03, 0xc2, 0x06, 0x15,
+  0xdf, 0x1e, 0xb6, 0xd8, 0xf3, 0x2d, 0x54, 0xf4, 0xda, 0x20, 0x0f, 0xb6,
+  0xe4, 0xde, 0xca, 0x14, 0xf1, 0x02, 0xb0, 0x2c, 0xf9, 0xe0, 0x0a, 0x17,
+  0x19, 0x1d, 0xd2, 0xfc, 0xd2, 0x46, 0xf7, 0x7f, 0xfe, 0x06, 0xf0, 0xfb,
+  0x38, 0x0c, 0xda, 0xe5, 0xc8, 0xfc, 0xcf, 0x35, 0xfd, 0x03, 0xf4, 0xe9,
+  0x04, 0xfe, 0xee, 0xcd, 0xf9, 0x21, 0x29, 0xde, 0x10, 0x34, 0x1f, 0x23,
+  0x05, 0xec, 0xe4, 0x17, 0xfe, 0xe5, 0xdc, 0xbb, 0xf4, 0x23, 0x37, 0x26,
+  0xda, 0x0a, 0x0f, 0xc0, 0xf5, 0xff, 0xf5, 0x0e, 0xe8, 0x24, 0xd7, 0xe1,
+  0xf8, 0xfc, 0xfa, 0xdc, 0x0a, 0x04, 0xf0, 0xc9, 0xe2, 0x14, 0x31, 0x05,
+  0x14, 0xf2, 0xdb, 0xdf, 0xbe, 0x17, 0x53, 0xc8, 0x0d, 0x13, 0xee, 0xfb,
+  0xf6, 0xeb, 0xfb, 0xc6, 0x0b, 0x37, 0xd6, 0xcb, 0x11, 0xcc, 0x3e, 0xc1,
+  0xc0, 0xf4, 0xf6, 0xf7, 0x01, 0xcf, 0xf5, 0x47, 0xe3, 0x11, 0xaf, 0xed,
+  0x30, 0xc2, 0x19, 0x1c, 0x04, 0x15, 0xf7, 0xbb, 0xf5, 0xd5, 0xf7, 0x2f,
+  0x03, 0x05, 0xfb, 0x0f, 0x0a, 0x1d, 0x25, 0xdd, 0x34, 0x04, 0xc5, 0xe9,
+  0x26, 0xc8, 0xcf, 0xf2, 0x1b, 0xfc, 0x0d, 0xed, 0xc6, 0xe9, 0x32, 0xf2,
+  0xfe, 0xe3, 0x44, 0xd2, 0x0f, 0x23, 0xeb, 0xc2, 0x07, 0x20, 0xcb, 0xf4,
+  0xfd, 0xc8, 0x19, 0x1b, 0xff, 0x25, 0xde, 0x50, 0xf1, 0xfe, 0x21, 0x27,
+  0xc9, 0x10, 0xf2, 0xfd, 0xc0, 0xe8, 0x24, 0x39, 0x42, 0x18, 0xed, 0x1f,
+  0x06, 0xff, 0x23, 0x1d, 0xd4, 0xa1, 0xdb, 0xf9, 0x02, 0x27, 0x0e, 0xf5,
+  0x4b, 0xf6, 0xdb, 0x0c, 0xde, 0xf2, 0x08, 0x30, 0x16, 0xd2, 0x42, 0xf6,
+  0xc0, 0x14, 0xce, 0x29, 0xaa, 0xf7, 0x1a, 0xc0, 0x26, 0xc6, 0xb6, 0xf5,
+  0x18, 0x25, 0xef, 0xe8, 0x47, 0xd1, 0x50, 0x03, 0x00, 0xd9, 0x22, 0x12,
+  0xe3, 0xee, 0x2f, 0x1c, 0xfe, 0xfa, 0xe4, 0xd8, 0xdf, 0x1d, 0x06, 0xf5,
+  0x40, 0xf7, 0x16, 0x01, 0xf0, 0xd9, 0x1d, 0x13, 0xe7, 0xe2, 0xf2, 0xe0,
+  0xea, 0xf8, 0x0f, 0xd9, 0x37, 0x23, 0xec, 0xee, 0xd7, 0xfc, 0x1a, 0x21,
+  0x1f, 0xdc, 0x1a, 0xc0, 0xd6, 0x1a, 0x34, 0xe3, 0x10, 0x22, 0x44, 0xbb,
+  0xfe, 0xc4, 0xf0, 0xf1, 0x47, 0xe8, 0xca, 0xc7, 0xfc, 0xc1, 0x14, 0xec,
+  0xb3, 0xf8, 0xe0, 0x14, 0xf9, 0xe6, 0x53, 0x20, 0x2a, 0x29, 0xec, 0xdf,
+  0x0d, 0x15, 0x08, 0xfa, 0x19, 0x2c, 0xed, 0x2b, 0x08, 0xfd, 0xef, 0x0d,
+  0xe8, 0x0d, 0xc1, 0x51, 0x29, 0x15, 0x18, 0xf7, 0x4b, 0xe7, 0xfa, 0xea,
+  0x47, 0x00, 0x14, 0xf4, 0x16, 0xc3, 0x18, 0xe5, 0xca, 0x11, 0x30, 0x1e,
+  0x0c, 0xf1, 0x08, 0xd9, 0xe4, 0x29, 0x39, 0xe7, 0x22, 0x15, 0xd6, 0x36,
+  0x12, 0xe4, 0x13, 0x3a, 0xf6, 0x10, 0xf8, 0xe4, 0xd9, 0xbd, 0x14, 0xee,
+  0xdd, 0x05, 0xff, 0xd0, 0xe0, 0x1d, 0xfa, 0xee, 0x3f, 0xdd, 0xf6, 0x3f,
+  0xd4, 0x33, 0x3b, 0xf7, 0xdc, 0xf5, 0xd9, 0x1c, 0xc1, 0x1d, 0x39, 0x07,
+  0x2b, 0x1c, 0xec, 0xd3, 0x2b, 0x13, 0x10, 0x19, 0x34, 0xaa, 0x29, 0xe5,
+  0xda, 0x04, 0xf8, 0x20, 0xea, 0xf0, 0xeb, 0xe6, 0xdf, 0xdf, 0xe9, 0x01,
+  0x3d, 0x0a, 0x10, 0xee, 0x2a, 0x05, 0x16, 0x34, 0x07, 0xd4, 0x17, 0xe7,
+  0xef, 0xd2, 0xf4, 0xdb, 0xee, 0xeb, 0x14, 0xf5, 0xc7, 0xd6, 0x11, 0x02,
+  0x67, 0xbc, 0xeb, 0x6f, 0xef, 0x03, 0x23, 0xe3, 0x05, 0x24, 0xbf, 0xee,
+  0x0f, 0xbd, 0x0d, 0x03, 0x08, 0xb8, 0xff, 0xac, 0xe1, 0xf3, 0x22, 0x22,
+  0x4d, 0xcb, 0x1a, 0x08, 0x09, 0xe4, 0x3c, 0xe7, 0xe6, 0x2c, 0x1c, 0x0f,
+  0x04, 0x32, 0x23, 0x14, 0x3b, 0xe1, 0xe8, 0xff, 0xfa, 0xe3, 0x14, 0x1b,
+  0x36, 0xf2, 0xe1, 0x09, 0xd5, 0xaf, 0x0b, 0xdf, 0xf3, 0xf7, 0x02, 0xb2,
+  0xd0, 0x96, 0x3c, 0xd9, 0x2f, 0xf3, 0xf1, 0xed, 0x10, 0x38, 0xfa, 0x13,
+  0xc4, 0x29, 0x17, 0x39, 0x08, 0xe4, 0x09, 0x18, 0x0a, 0xee, 0x0b, 0x06,
+  0x69, 0xfd, 0xc6, 0xf0, 0xe0, 0xe3, 0x2e, 0xb0, 0x25, 0x07, 0x3b, 0x25,
+  0xe1, 0x2f, 0x14, 0x05, 0x3c, 0x39, 0xf5, 0x03, 0x1b, 0xf4, 0xf2, 0xc7,
+  0xf3, 0xca, 0xd6, 0x1e, 0x18, 0x5a, 0xa9, 0x5c, 0x23, 0x1d, 0xcd, 0xdb,
+  0xea, 0xe4, 0x2b, 0xf2, 0xc9, 0xcc, 0x1b, 0x0e, 0xf0, 0xdb, 0x46, 0x67,
+  0xc4, 0x06, 0x15, 0x64, 0x81, 0xfb, 0x01, 0x1e, 0x04, 0x38, 0x35, 0xb6,
+  0xd3, 0xdb, 0x4c, 0x05, 0x1d, 0x16, 0xe2, 0xc5, 0x04, 0xce, 0x08, 0xaf,
+  0x27, 0x34, 0x45, 0x4a, 0x1d, 0x18, 0x47, 0xf7, 0xfb, 0x2d, 0x2d, 0xed,
+  0xf7, 0xb9, 0x20, 0xcb, 0xf4, 0x3f, 0x09, 0xec, 0xe2, 0x05, 0xda, 0x1d,
+  0xe7, 0x14, 0x2e, 0xf6, 0xe4, 0xe2, 0xa6, 0xfe, 0xea, 0x5f, 0x32, 0x06,
+  0x33, 0x05, 0x40, 0x0b, 0x39, 0xad, 0x0b, 0x5c, 0xb1, 0x1a, 0x14, 0x21,
+  0x00, 0x4b, 0xee, 0xec, 0x0e, 0x03, 0xe6, 0xd2, 0x2f, 0xc2, 0xf2, 0xd3,
+  0xc4, 0xa9, 0xfe, 0x36, 0x14, 0x10, 0x36, 0xf8, 0xf9, 0xcc, 0x35, 0x17,
+  0x12, 0x3a, 0x39, 0x31, 0x2e, 0xfc, 0x02, 0xd1, 0xa4, 0xaf, 0x06, 0x00,
+  0xfd, 0x07, 0xaf, 0xc4, 0xd7, 0xb8, 0x1d, 0xf4, 0xc8, 0xe3, 0xd7, 0xe9,
+  0xe1, 0x50, 0x3f, 0xdb, 0x3c, 0xdd, 0xe7, 0x42, 0xd5, 0xe5, 0xe2, 0x70,
+  0xb6, 0x07, 0xf5, 0x29, 0xf2, 0xc8, 0xe0, 0x0d, 0x08, 0x00, 0xec, 0xc5,
+  0x4f, 0xc8, 0xfd, 0x11, 0xcb, 0x27, 0x2c, 0xaa, 0x35, 0xd6, 0x58, 0xea,
+  0xea, 0x04, 0x0e, 0xf3, 0x15, 0xfe, 0x29, 0xd5, 0x03, 0xea, 0xfa, 0xe4,
+  0x1b, 0x1d, 0xd0, 0x07, 0xed, 0x41, 0xdd, 0x36, 0x65, 0xde, 0x02, 0x14,
+  0x25, 0xf1, 0x27, 0xe9, 0xd5, 0x0e, 0x1d, 0x46, 0xe3, 0xea, 0x42, 0x0c,
+  0xe7, 0x2b, 0x25, 0x2b, 0xa9, 0xde, 0xe8, 0x10, 0xd6, 0x06, 0xd3, 0xa9,
+  0xf9, 0x07, 0xc9, 0xfe, 0x34, 0x06, 0x08, 0xfc, 0x27, 0x15, 0xd5, 0xbe,
+  0xb0, 0x31, 0x18, 0x51, 0x04, 0xe9, 0x1b, 0x07, 0xfd, 0xf5, 0x0a, 0xc3,
+  0xfc, 0x0d, 0x00, 0x11, 0x35, 0x3d, 0xdf, 0xdc, 0xc0, 0xf9, 0x08, 0xf8,
+  0x1d, 0xec, 0x24, 0xf5, 0x19, 0xe6, 0xed, 0xed, 0x01, 0x22, 0x2a, 0xf5,
+  0x02, 0x0b, 0x20, 0xee, 0x4a, 0x1e, 0x09, 0xe7, 0xc5, 0x02, 0xcf, 0x23,
+  0xe2, 0x63, 0xfd, 0xe1, 0x29, 0x04, 0xdc, 0x09, 0x43, 0xf9, 0xff, 0x1b,
+  0x07, 0x02, 0xf2, 0xf4, 0xd0, 0xf1, 0x4d, 0x0e, 0xdb, 0xf4, 0x20, 0x34,
+  0x17, 0x08, 0x2c, 0xdb, 0x0c, 0x29, 0xc8, 0x0e, 0x0b, 0xb7, 0xe2, 0x17,
+  0xfb, 0x2b, 0x05, 0xe4, 0x23, 0xf2, 0xfd, 0x24, 0xeb, 0xc4, 0x09, 0xff,
+  0x16, 0x12, 0x3b, 0xd2, 0x4c, 0xf4, 0xc7, 0x08, 0x04, 0xf0, 0x02, 0x1d,
+  0xe1, 0xc9, 0x0f, 0x19, 0xdc, 0xcf, 0x03, 0xce, 0x0e, 0xfa, 0xf3, 0x9c,
+  0xd1, 0x1d, 0xe0, 0xf8, 0x1a, 0xfd, 0xfc, 0xd5, 0x45, 0x08, 0x16, 0xd1,
+  0x1a, 0x05, 0xd9, 0xdb, 0xf7, 0x09, 0x1c, 0x34, 0x45, 0xe9, 0x1f, 0x39,
+  0xe4, 0xd1, 0xd4, 0x1f, 0x27, 0xf7, 0xcc, 0xa2, 0x0e, 0x35, 0x17, 0xe5,
+  0xf6, 0xee, 0xe2, 0xf6, 0xf1, 0x2b, 0x37, 0x1d, 0xc7, 0x23, 0x42, 0x1b,
+  0x24, 0xcc, 0xd3, 0xf4, 0xfc, 0xbb, 0x04, 0xf8, 0xdf, 0x04, 0x06, 0xda,
+  0x15, 0xcf, 0x09, 0xfa, 0xcd, 0x42, 0x03, 0x0e, 0x7b, 0xea, 0xdd, 0xea,
+  0xef, 0x71, 0x16, 0x25, 0xfc, 0xed, 0xf4, 0x23, 0xfe, 0x12, 0xe8, 0xef,
+  0x73, 0x30, 0x19, 0x58, 0xfa, 0xfc, 0x13, 0x15, 0x08, 0xec, 0xd4, 0xb9,
+  0xe6, 0x1c, 0xe4, 0xdf, 0xfb, 0x1f, 0xfd, 0x2a, 0x27, 0xc3, 0x45, 0xc8,
+  0xef, 0x01, 0x21, 0x1e, 0x73, 0xcf, 0xe7, 0xe4, 0xdd, 0xe9, 0x08, 0xf7,
+  0xfa, 0x0d, 0x43, 0xcd, 0x0f, 0xd1, 0xf4, 0xfd, 0xe4, 0x08, 0xe6, 0x0c,
+  0x44, 0xcc, 0xdd, 0xfb, 0xe2, 0x07, 0x5c, 0xea, 0xda, 0x02, 0xf1, 0x2a,
+  0xee, 0x05, 0x53, 0xac, 0x33, 0x32, 0xfc, 0x50, 0xf3, 0xde, 0x13, 0x1f,
+  0x0d, 0x19, 0xc9, 0xc0, 0xf5, 0x04, 0xf2, 0x02, 0x3d, 0x11, 0xce, 0x3c,
+  0x03, 0xfb, 0x38, 0xd4, 0x04, 0xf2, 0xdd, 0x14, 0x37, 0xbe, 0x0e, 0x04,
+  0x1c, 0xec, 0x0f, 0x02, 0xe8, 0x07, 0xee, 0x0c, 0x53, 0xd3, 0xc4, 0x37,
+  0xc7, 0x31, 0xc3, 0xd7, 0x0d, 0x3f, 0x08, 0xf5, 0x21, 0x0d, 0x52, 0xf4,
+  0xf9, 0x25, 0xdd, 0xe1, 0xff, 0x1a, 0xf5, 0xfb, 0xb4, 0x45, 0xd7, 0x08,
+  0x47, 0xe2, 0xd9, 0xcc, 0x0c, 0xe9, 0xfb, 0x2a, 0x17, 0x3a, 0x03, 0x2a,
+  0xf9, 0xc6, 0xde, 0x0c, 0xe2, 0xdc, 0x2f, 0x47, 0x1f, 0x04, 0x2e, 0x13,
+  0x09, 0xde, 0x40, 0x1c, 0xf2, 0xf3, 0xd7, 0x2b, 0xfb, 0xbc, 0xf6, 0x0b,
+  0x6d, 0xde, 0x13, 0x02, 0xe8, 0x12, 0xdc, 0xc2, 0xcd, 0x2f, 0x4d, 0x09,
+  0xe5, 0xd3, 0x4b, 0x1d, 0xad, 0xec, 0xfd, 0xec, 0xb1, 0xdf, 0xec, 0x0d,
+  0xd1, 0x16, 0x0e, 0x03, 0x3b, 0x37, 0xf1, 0xeb, 0x2d, 0xcd, 0x43, 0xf4,
+  0x09, 0x30, 0xda, 0x3a, 0xf5, 0x03, 0xdc, 0x3b, 0xff, 0x2f, 0x11, 0xf7,
+  0xfc, 0x03, 0x14, 0x00, 0x02, 0x11, 0x00, 0xdf, 0xfc, 0xef, 0x0a, 0xe1,
+  0xf6, 0xd6, 0xf2, 0x2e, 0x5a, 0x16, 0x0c, 0xfa, 0xcb, 0xe3, 0x08, 0xda,
+  0x0f, 0x09, 0x05, 0xe0, 0xea, 0xff, 0x0f, 0x2b, 0xe2, 0xfb, 0xf5, 0x19,
+  0xf7, 0xeb, 0x07, 0x2e, 0xda, 0x04, 0x25, 0xfd, 0x34, 0xfe, 0xfa, 0x39,
+  0xfd, 0xd4, 0x57, 0xe4, 0x17, 0x47, 0xe1, 0x02, 0xec, 0x07, 0xe0, 0x05,
+  0xfa, 0x4c, 0xee, 0xdc, 0x17, 0x33, 0x29, 0xec, 0xf6, 0xee, 0x9d, 0xf2,
+  0x33, 0xf6, 0x33, 0x11, 0x2a, 0xcd, 0x1e, 0xc4, 0x04, 0xf0, 0xf6, 0x16,
+  0x01, 0x14, 0xf2, 0x0a, 0x28, 0x3b, 0x20, 0x02, 0x34, 0xea, 0x09, 0xd8,
+  0xfb, 0xef, 0x1c, 0x04, 0xd1, 0x19, 0xee, 0xf0, 0xeb, 0x20, 0xc8, 0x14,
+  0x24, 0xec, 0xc7, 0x14, 0x23, 0x0b, 0x10, 0xfb, 0x15, 0x06, 0xcf, 0xff,
+  0xe9, 0xd9, 0xe2, 0x03, 0xf4, 0xe9, 0x1f, 0xef, 0x11, 0xfa, 0x17, 0xf0,
+  0xca, 0x1b, 0xe8, 0xf5, 0xe3, 0xf2, 0x19, 0xef, 0x0d, 0xaf, 0x25, 0xc3,
+  0x26, 0x31, 0x28, 0xfd, 0x4c, 0x38, 0xed, 0xe3, 0xdc, 0x35, 0xea, 0xdd,
+  0xf5, 0xc3, 0xf5, 0x05, 0xf2, 0xf9, 0x10, 0x0c, 0x81, 0xd8, 0xe6, 0xb0,
+  0xc8, 0xcd, 0xef, 0xe5, 0x07, 0x3a, 0x06, 0xfa, 0x16, 0x08, 0x19, 0xb9,
+  0x1c, 0xe0, 0xdf, 0x2c, 0x00, 0xd6, 0x04, 0x23, 0x00, 0xef, 0x07, 0xfd,
+  0x15, 0xde, 0xfc, 0xed, 0xf5, 0x0a, 0xdb, 0xab, 0xee, 0x09, 0x23, 0xda,
+  0x25, 0xdc, 0x1d, 0xfc, 0xed, 0x0a, 0x15, 0xf3, 0x16, 0x23, 0x03, 0xfb,
+  0x04, 0x03, 0x00, 0xd9, 0x29, 0x37, 0x0b, 0xdd, 0x0d, 0x04, 0xe7, 0x18,
+  0xd2, 0xdb, 0xfa, 0xbf, 0xe2, 0xf3, 0x07, 0xfa, 0x18, 0x13, 0xe9, 0x14,
+  0x1c, 0x0c, 0xfc, 0x16, 0x00, 0x01, 0xe9, 0x1e, 0x14, 0xd3, 0x2e, 0xfb,
+  0xec, 0x51, 0x2a, 0xf8, 0xf0, 0x06, 0x11, 0x06, 0xfa, 0x03, 0xa1, 0xc2,
+  0xe5, 0xe0, 0x16, 0x31, 0x0b, 0xf8, 0x46, 0xfc, 0xdb, 0x12, 0xff, 0x34,
+  0x08, 0x19, 0xf1, 0x0c, 0x49, 0x2f, 0x09, 0x09, 0xd7, 0x17, 0x06, 0x1f,
+  0x1c, 0x29, 0x22, 0xf2, 0x09, 0x16, 0x00, 0xcf, 0x15, 0x03, 0xd6, 0x32,
+  0x18, 0xe9, 0xe7, 0x14, 0xe6, 0x26, 0xea, 0x19, 0x03, 0xf5, 0xea, 0xcf,
+  0xeb, 0xc3, 0xf4, 0x04, 0x16, 0xeb, 0x17, 0x11, 0x15, 0xd9, 0xf7, 0xdf,
+  0x14, 0x44, 0xda, 0xe3, 0xbd, 0xcb, 0xfe, 0xeb, 0xff, 0xcb, 0x0a, 0x09,
+  0xfa, 0x1e, 0x42, 0xe3, 0x42, 0x04, 0x9e, 0xfa, 0x2b, 0xed, 0xd5, 0xf1,
+  0xd7, 0xf8, 0xfc, 0x1f, 0x1d, 0xfe, 0xfe, 0x15, 0xe0, 0x09, 0xe5, 0xd7,
+  0xf7, 0xd3, 0xda, 0x15, 0x0d, 0x3e, 0xc8, 0x11, 0xf6, 0x07, 0x0a, 0xc5,
+  0xdf, 0x10, 0xed, 0xfa, 0x15, 0xd3, 0x0d, 0x11, 0x13, 0xf8, 0x17, 0x15,
+  0x3b, 0xd2, 0xe1, 0xe5, 0x35, 0x48, 0xf0, 0x0a, 0x97, 0xe5, 0x1d, 0x0e,
+  0x14, 0xd6, 0x0f, 0x15, 0xea, 0x06, 0xf3, 0xf5, 0x1a, 0x0c, 0xe2, 0xd9,
+  0xf0, 0x2a, 0xdb, 0x09, 0xf0, 0x31, 0xe2, 0xfe, 0x0e, 0x12, 0x28, 0x19,
+  0x07, 0xeb, 0xdb, 0xb2, 0xf7, 0xf8, 0xfc, 0xe7, 0x20, 0xf1, 0x11, 0x12,
+  0x25, 0x0b, 0xe9, 0x3c, 0xde, 0x1f, 0xf9, 0x0c, 0xef, 0xd8, 0x09, 0xd7,
+  0xe7, 0xfa, 0x25, 0xff, 0x06, 0xe2, 0xf1, 0xe6, 0x47, 0x38, 0x03, 0xf4,
+  0x3a, 0x08, 0xf9, 0xf8, 0xe2, 0x11, 0xe3, 0xd0, 0x23, 0x21, 0xfc, 0x3d,
+  0xef, 0x05, 0x10, 0xe2, 0xf7, 0x21, 0xe4, 0x07, 0xca, 0x13, 0xfd, 0x24,
+  0xea, 0xf3, 0xf5, 0xf2, 0x04, 0xe6, 0xf0, 0xf4, 0xfb, 0xd9, 0xfd, 0xf5,
+  0x03, 0xf1, 0xe4, 0x02, 0x0c, 0xdf, 0x07, 0xf4, 0x0d, 0xf1, 0x18, 0xf4,
+  0xe3, 0x08, 0x2d, 0x03, 0x0b, 0x06, 0x0d, 0x3b, 0xf0, 0x0c, 0xfc, 0x0a,
+  0xca, 0x03, 0x16, 0x09, 0x2e, 0xf6, 0x0f, 0xee, 0xe4, 0x06, 0x10, 0xec,
+  0xf4, 0xf6, 0xf9, 0x1c, 0xde, 0xed, 0xfc, 0x02, 0x0a, 0xe5, 0xed, 0xea,
+  0xcf, 0x03, 0xf5, 0x7f, 0xdd, 0x08, 0x00, 0xe5, 0xdb, 0x02, 0xf9, 0x0e,
+  0xe4, 0xd9, 0x18, 0xec, 0xe4, 0xdb, 0xfb, 0x0d, 0x11, 0x07, 0x51, 0xfc,
+  0xdf, 0x18, 0x16, 0xda, 0xf7, 0x05, 0x0a, 0xfa, 0xe6, 0xfd, 0xe3, 0x78,
+  0x0b, 0x34, 0x10, 0x10, 0x04, 0xfe, 0xe4, 0x18, 0x2d, 0xf3, 0x16, 0xfa,
+  0xcf, 0x04, 0x1e, 0xc3, 0x0b, 0x10, 0xf0, 0x15, 0xf6, 0x1d, 0x00, 0x13,
+  0xe4, 0xf6, 0xf9, 0xed, 0xcd, 0x06, 0xf9, 0xd2, 0xd5, 0x0f, 0xfd, 0xe1,
+  0xef, 0xf2, 0xf8, 0xe9, 0xd5, 0xf3, 0xe8, 0x0a, 0xf6, 0xff, 0xfa, 0x11,
+  0x03, 0xf7, 0x25, 0xf4, 0xdc, 0xde, 0xf7, 0xe0, 0xfe, 0xfe, 0x3e, 0xda,
+  0xf7, 0x17, 0x06, 0x4a, 0x02, 0x06, 0x0c, 0x04, 0xe5, 0x14, 0xf2, 0xf5,
+  0x0c, 0x23, 0x03, 0xdc, 0xf6, 0xee, 0x02, 0xf6, 0x47, 0xec, 0x0a, 0x33,
+  0x09, 0xf0, 0x15, 0xe7, 0xf1, 0x17, 0xe5, 0xe2, 0xc7, 0x00, 0x03, 0x0c,
+  0xec, 0xce, 0xf5, 0x03, 0x0e, 0xe9, 0x27, 0x21, 0xf8, 0x02, 0xe2, 0x13,
+  0x11, 0xfa, 0x0b, 0xee, 0x23, 0xc2, 0xdf, 0xeb, 0x07, 0xf6, 0x0f, 0x1b,
+  0x0f, 0xe7, 0xfa, 0xfd, 0x20, 0xf8, 0x20, 0x1a, 0x2e, 0xf7, 0xd1, 0x07,
+  0xea, 0x0e, 0x21, 0x05, 0xfa, 0x1f, 0xff, 0xe8, 0x57, 0xd0, 0x16, 0x33,
+  0x1d, 0xd3, 0xff, 0xe7, 0x39, 0x0f, 0xfd, 0x20, 0x01, 0xd8, 0xbf, 0xcd,
+  0xfa, 0xf3, 0x2e, 0x37, 0xe9, 0xda, 0x0c, 0x05, 0xf1, 0x13, 0x38, 0xf7,
+  0xdb, 0x17, 0x09, 0xff, 0xcb, 0xf0, 0x1f, 0xfb, 0x13, 0xf4, 0xee, 0xea,
+  0xee, 0x19, 0x1d, 0x1e, 0x11, 0xe4, 0xec, 0xbd, 0xf6, 0xe8, 0x0a, 0x16,
+  0x15, 0xda, 0xed, 0x1e, 0x05, 0xd9, 0x0a, 0x06, 0x19, 0x2f, 0x01, 0x01,
+  0x11, 0xc8, 0x07, 0x08, 0x2a, 0xd7, 0xf5, 0x19, 0x3f, 0x1a, 0x15, 0xed,
+  0xf3, 0xf6, 0xf9, 0x08, 0x07, 0xf4, 0x2a, 0x0f, 0xba, 0x29, 0xfe, 0xc9,
+  0xca, 0xf4, 0xf7, 0xf7, 0xd9, 0x0d, 0x06, 0x18, 0xf2, 0xe7, 0x34, 0xe9,
+  0xd5, 0xd8, 0xf1, 0x36, 0x17, 0xe9, 0x07, 0x0c, 0x05, 0x10, 0x1d, 0xd8,
+  0xdc, 0xf4, 0x0c, 0x23, 0xf0, 0xe9, 0x21, 0x06, 0x0a, 0x04, 0x28, 0x15,
+  0x08, 0x39, 0xf7, 0x2a, 0x09, 0xb8, 0xf8, 0x05, 0x1e, 0x00, 0xb0, 0x03,
+  0x06, 0x24, 0x40, 0x06, 0xe9, 0xfd, 0x28, 0xf1, 0xdf, 0xfb, 0xdf, 0x04,
+  0x0e, 0x00, 0xcd, 0x1a, 0xef, 0xcb, 0xfd, 0x0b, 0xef, 0xe7, 0xf8, 0x10,
+  0xdf, 0xfd, 0xfd, 0x14, 0x07, 0xea, 0xe8, 0xf0, 0xf5, 0x36, 0xea, 0x0d,
+  0x2d, 0xc9, 0x08, 0xf2, 0x19, 0x23, 0x2d, 0xdc, 0xfd, 0xe5, 0xd1, 0xe8,
+  0xec, 0x0b, 0x25, 0x3b, 0xdb, 0x2c, 0xeb, 0x03, 0x45, 0xe5, 0xf6, 0x21,
+  0x1e, 0xdc, 0xb6, 0xdb, 0x48, 0x26, 0x36, 0x4e, 0xea, 0xf0, 0x31, 0xdc,
+  0x1a, 0xf1, 0x02, 0xea, 0x03, 0xe0, 0x1e, 0x1e, 0xc1, 0xfb, 0x05, 0xf3,
+  0xea, 0xfa, 0xff, 0x3b, 0xc2, 0xfa, 0xf3, 0x12, 0x39, 0xfb, 0xc6, 0x06,
+  0xe7, 0x23, 0x28, 0x22, 0x1b, 0xef, 0xc3, 0xe3, 0x2b, 0xde, 0x27, 0x15,
+  0xce, 0xc1, 0xe1, 0x03, 0x20, 0xda, 0x12, 0x1e, 0x0c, 0x3a, 0xf2, 0x18,
+  0x3c, 0xbf, 0x01, 0x1a, 0x09, 0xf7, 0xc5, 0xd5, 0x36, 0x0a, 0x25, 0x20,
+  0xf1, 0xf9, 0x4c, 0xd1, 0x1e, 0x16, 0x0d, 0xec, 0xd4, 0x08, 0xd3, 0xe8,
+  0xe4, 0xe4, 0x07, 0xf1, 0x04, 0xd0, 0x0c, 0x01, 0xd8, 0xdc, 0x18, 0xef,
+  0xe4, 0xf3, 0xf8, 0x32, 0x0c, 0x2e, 0x0c, 0x24, 0x18, 0x06, 0x05, 0x11,
+  0xf5, 0x49, 0xf7, 0xe7, 0xdb, 0xe4, 0xe6, 0xec, 0xf4, 0xd9, 0xf2, 0x3d,
+  0x00, 0xe6, 0xf1, 0xfe, 0xf5, 0xe5, 0x26, 0x5e, 0xde, 0xdb, 0xdb, 0xf4,
+  0x16, 0xe8, 0x34, 0x0e, 0xce, 0xf7, 0xdc, 0xd9, 0x0e, 0xce, 0x47, 0xed,
+  0xc2, 0x2e, 0xdc, 0xcf, 0xf6, 0xd9, 0x53, 0xe3, 0xfe, 0xd9, 0x57, 0x07,
+  0xaa, 0xe1, 0xf4, 0x04, 0xc3, 0xa3, 0xb8, 0xf9, 0xcc, 0x26, 0x47, 0xe0,
+  0xa5, 0x1b, 0x26, 0x04, 0x07, 0x2a, 0x23, 0x26, 0xfe, 0x25, 0x1d, 0xfb,
+  0xf2, 0xd3, 0xd1, 0x24, 0x36, 0xe9, 0xfd, 0x30, 0xcb, 0x06, 0x20, 0xde,
+  0x28, 0xca, 0xed, 0x02, 0xfb, 0x0f, 0x4b, 0xf9, 0xfb, 0xfb, 0xe1, 0x1e,
+  0xd9, 0xd6, 0x66, 0x02, 0xea, 0xf9, 0x0d, 0x0e, 0xee, 0xdb, 0x2f, 0x02,
+  0x14, 0x81, 0x08, 0x18, 0x17, 0xdc, 0xfa, 0x50, 0xe0, 0xa3, 0x12, 0xd4,
+  0x06, 0xe6, 0x01, 0x5d, 0xbc, 0x0d, 0x53, 0xef, 0xf5, 0xdc, 0xe8, 0x53,
+  0xef, 0x03, 0xfa, 0x42, 0xf4, 0x28, 0xbd, 0xcc, 0x2a, 0xf1, 0xe5, 0x5f,
+  0xc7, 0xe3, 0x00, 0xed, 0x50, 0xfc, 0xdd, 0xe0, 0x43, 0xd8, 0xeb, 0x00,
+  0xf2, 0xf0, 0xd0, 0xea, 0xf0, 0xc1, 0xda, 0xf5, 0xf8, 0x03, 0x36, 0xef,
+  0xcb, 0xf1, 0x46, 0xdc, 0x02, 0x90, 0xc1, 0xec, 0xee, 0xda, 0xf3, 0x02,
+  0x01, 0xbb, 0x1c, 0xe4, 0x07, 0x05, 0x19, 0x22, 0x2d, 0xf7, 0x3f, 0xe9,
+  0x24, 0xdb, 0xa8, 0x32, 0x44, 0x36, 0xd0, 0x28, 0x39, 0xf3, 0xf5, 0x08,
+  0xd4, 0x22, 0xd8, 0x06, 0xf5, 0x17, 0xf9, 0x2c, 0xe9, 0xe4, 0x3a, 0x26,
+  0xf1, 0x07, 0xb9, 0x0a, 0xa0, 0x28, 0x13, 0xe6, 0xf0, 0xaf, 0xf8, 0xe0,
+  0x0b, 0x01, 0xec, 0xea, 0xee, 0x07, 0x0e, 0xeb, 0xee, 0xfe, 0x20, 0xe4,
+  0xd5, 0xfa, 0x3e, 0x12, 0xec, 0xdd, 0xa6, 0x7a, 0x1c, 0x2a, 0x1d, 0xed,
+  0xf9, 0xeb, 0xe5, 0x21, 0x1c, 0xf8, 0xdc, 0x34, 0xc6, 0x33, 0xf7, 0x16,
+  0xce, 0xf1, 0xe6, 0x1e, 0xdf, 0x31, 0xed, 0xfb, 0xf2, 0x32, 0xf1, 0xee,
+  0xc8, 0xd3, 0x4a, 0x5b, 0x1e, 0x13, 0xd1, 0xeb, 0xe5, 0xdb, 0x0b, 0x0a,
+  0xcf, 0x89, 0x66, 0xf9, 0x1c, 0x0e, 0x0b, 0x2e, 0xe7, 0xdc, 0xfd, 0xf5,
+  0x20, 0xda, 0x26, 0xfb, 0xec, 0xeb, 0x23, 0x1e, 0xf9, 0xd3, 0xc5, 0x5b,
+  0xfc, 0x2a, 0xfa, 0xc0, 0xe6, 0x00, 0xe7, 0xb5, 0x08, 0x07, 0x2c, 0x05,
+  0xfb, 0x18, 0xf3, 0x20, 0xff, 0x29, 0x0f, 0xf6, 0x0e, 0x57, 0xeb, 0x30,
+  0xe3, 0x0c, 0xed, 0xf0, 0x0f, 0x22, 0x13, 0x17, 0x51, 0xe6, 0xc8, 0x1a,
+  0xf9, 0x15, 0xf6, 0x1e, 0xe8, 0xc9, 0xee, 0x12, 0xdb, 0x01, 0x33, 0xf4,
+  0xb8, 0xf0, 0x18, 0x08, 0xea, 0xef, 0x17, 0xf7, 0xf1, 0xdd, 0xec, 0x00,
+  0xfc, 0x0d, 0x05, 0x12, 0xf4, 0x0f, 0xd7, 0xbe, 0x1d, 0xf3, 0x1c, 0xb2,
+  0x12, 0xed, 0x01, 0x16, 0x4d, 0x07, 0x23, 0x17, 0x38, 0x02, 0x1a, 0xf2,
+  0x01, 0xec, 0xf0, 0xd3, 0x02, 0x3a, 0xee, 0x76, 0xe5, 0x33, 0xf2, 0x2d,
+  0xc2, 0x17, 0xcb, 0x0c, 0xaf, 0x1f, 0xd0, 0xf7, 0x19, 0x17, 0xee, 0x08,
+  0xda, 0x0e, 0xe3, 0xe6, 0xa7, 0x4b, 0xcb, 0xfc, 0xce, 0x13, 0x46, 0xea,
+  0xf5, 0x09, 0x22, 0xcd, 0xf6, 0x26, 0xc7, 0x02, 0x21, 0xd3, 0xd7, 0xca,
+  0x44, 0x33, 0xfe, 0xe8, 0x1a, 0x6e, 0xf0, 0xe5, 0xe3, 0x1a, 0xc3, 0x47,
+  0x0b, 0xb3, 0x38, 0x1c, 0xdb, 0x21, 0x1d, 0xc3, 0xc3, 0x4b, 0xe1, 0x0f,
+  0xb7, 0x38, 0x03, 0x68, 0xdb, 0xce, 0xbc, 0xf4, 0xe7, 0xee, 0xdd, 0xdb,
+  0x03, 0xd8, 0x43, 0x18, 0xfa, 0x2d, 0x16, 0x2e, 0xc1, 0x2b, 0xec, 0x10,
+  0xd9, 0xfe, 0x3d, 0xed, 0xf1, 0x0b, 0x1a, 0xe6, 0x26, 0xe2, 0xc8, 0xe7,
+  0x0a, 0xf4, 0xd5, 0xd7, 0x2f, 0x16, 0xed, 0x05, 0x16, 0x20, 0x29, 0xc4,
+  0x05, 0x02, 0xdd, 0x43, 0x31, 0xfe, 0x28, 0x20, 0x30, 0x3f, 0x3a, 0xb6,
+  0x1f, 0x07, 0x3a, 0x03, 0xd7, 0xe8, 0xc3, 0xe9, 0xe8, 0xd0, 0xbd, 0x4f,
+  0xfd, 0x06, 0x06, 0xde, 0xf2, 0x0a, 0xc8, 0xe9, 0xee, 0x0c, 0x2f, 0x00,
+  0xb5, 0x25, 0xe2, 0xc0, 0x8e, 0xed, 0x0e, 0xf4, 0x05, 0xbe, 0x01, 0x0a,
+  0x11, 0xcb, 0x05, 0xdc, 0x05, 0x0a, 0xdb, 0x0c, 0x11, 0xf7, 0x04, 0xcd,
+  0x1e, 0x20, 0xe3, 0xc8, 0xfd, 0xe4, 0xe2, 0x0a, 0x1a, 0xd5, 0x19, 0x12,
+  0x46, 0xd8, 0xf5, 0xf9, 0xdb, 0x03, 0x00, 0xf0, 0x74, 0xe2, 0xe6, 0xe6,
+  0xee, 0xb4, 0xe6, 0x25, 0xd7, 0x10, 0x3a, 0xff, 0x19, 0xf7, 0x1d, 0xbe,
+  0xa7, 0x29, 0xe4, 0xd7, 0x0d, 0x2f, 0xd6, 0x01, 0x37, 0x04, 0xed, 0xe2,
+  0x29, 0x21, 0x0b, 0x2a, 0x05, 0x04, 0xcd, 0xeb, 0x11, 0x0a, 0xfb, 0xd1,
+  0xfa, 0xf9, 0x0f, 0x5c, 0x00, 0x04, 0x28, 0xfa, 0xf0, 0xe3, 0x3b, 0xe7,
+  0xfb, 0xe2, 0xc3, 0x1f, 0x10, 0xe5, 0xea, 0xf2, 0xdb, 0x25, 0x48, 0xfa,
+  0x66, 0xd7, 0x0b, 0xbf, 0xda, 0xb9, 0xc6, 0x3d, 0x1f, 0x08, 0xfa, 0xbd,
+  0xd2, 0x19, 0x04, 0x99, 0xac, 0xdd, 0x2b, 0xd3, 0x47, 0xf7, 0x0c, 0x11,
+  0x34, 0x1c, 0x06, 0xdc, 0x22, 0x25, 0x0b, 0x58, 0x15, 0x1a, 0xc2, 0xe0,
+  0xdd, 0xea, 0x1f, 0xc6, 0xbd, 0x0b, 0xd8, 0x33, 0xcc, 0x15, 0x14, 0xea,
+  0x0f, 0x0b, 0xd7, 0xf6, 0xd0, 0x01, 0xf1, 0xfd, 0x34, 0xf5, 0x29, 0x0e,
+  0x16, 0x0a, 0x1b, 0x0b, 0x37, 0xf8, 0xd0, 0xb0, 0xeb, 0x06, 0xb8, 0x4a,
+  0xe8, 0x1c, 0x50, 0xd7, 0xfd, 0x3d, 0xfd, 0xd3, 0xd5, 0xf4, 0xcf, 0xb7,
+  0xf3, 0x04, 0xca, 0xdc, 0x71, 0x1f, 0x22, 0x3a, 0xfb, 0x0d, 0xf1, 0x49,
+  0xd5, 0x18, 0xf6, 0xfd, 0xeb, 0x00, 0xfd, 0xd6, 0xc7, 0x1e, 0x06, 0x24,
+  0x00, 0x1d, 0x01, 0x1e, 0x29, 0x09, 0xef, 0x03, 0xc2, 0xf8, 0xff, 0xd5,
+  0x14, 0x1a, 0xec, 0xfa, 0xd2, 0x47, 0x25, 0x1d, 0x2f, 0x03, 0x00, 0xf3,
+  0x00, 0x01, 0xbb, 0x10, 0xfd, 0xd7, 0xe7, 0x1f, 0xe8, 0xf9, 0xf4, 0x4e,
+  0x14, 0x23, 0x15, 0x0a, 0x0b, 0xeb, 0x10, 0xd7, 0xdc, 0x0a, 0xe7, 0xee,
+  0xf1, 0x2f, 0xfa, 0x02, 0x3b, 0xf4, 0xe2, 0x13, 0xba, 0xd3, 0xec, 0x0b,
+  0xfd, 0xf3, 0x18, 0x30, 0x25, 0xe5, 0x55, 0xfd, 0xce, 0xd0, 0xed, 0xf3,
+  0xbe, 0x10, 0xb5, 0x33, 0xe3, 0xd1, 0x03, 0x1a, 0x01, 0x39, 0x2a, 0x3a,
+  0x46, 0x0e, 0xff, 0x1d, 0xbb, 0x39, 0xef, 0x26, 0xe2, 0xef, 0xdf, 0xc5,
+  0x9a, 0x1d, 0x31, 0x36, 0x11, 0xf7, 0x54, 0xc2, 0xf4, 0xd4, 0x04, 0x28,
+  0xc4, 0x03, 0xe3, 0xfa, 0xf5, 0x26, 0x14, 0x1d, 0x36, 0xff, 0x11, 0xe0,
+  0xc6, 0xcb, 0x22, 0x04, 0x01, 0xe8, 0x07, 0xe4, 0x02, 0xd8, 0x02, 0x39,
+  0xef, 0xdf, 0xa1, 0x09, 0xdb, 0x23, 0xfd, 0x49, 0x0d, 0x22, 0xee, 0xee,
+  0x01, 0x07, 0x0d, 0x38, 0xf2, 0x40, 0x11, 0xf9, 0xfb, 0x23, 0xdf, 0x40,
+  0xc7, 0x39, 0x07, 0x01, 0xdb, 0xfa, 0x2b, 0xfa, 0x12, 0x12, 0xf6, 0xee,
+  0xfa, 0xc9, 0xf6, 0xb4, 0x10, 0xfe, 0xf8, 0x0e, 0xd9, 0x1e, 0x20, 0xfa,
+  0x20, 0x11, 0x0f, 0xb6, 0xe8, 0xcc, 0x03, 0x2b, 0xfd, 0xce, 0xff, 0xfe,
+  0x05, 0xe2, 0x33, 0x40, 0x3b, 0xdc, 0xe6, 0x0f, 0xee, 0x32, 0xec, 0x36,
+  0x16, 0x69, 0x06, 0x30, 0xf2, 0xf2, 0x46, 0x16, 0x04, 0x15, 0xda, 0xf1,
+  0x7f, 0x37, 0x1c, 0x19, 0x16, 0xcd, 0x1f, 0x09, 0xee, 0xe9, 0x19, 0x2f,
+  0x0b, 0x02, 0x6d, 0xb9, 0x13, 0x22, 0x27, 0xb3, 0x00, 0x0d, 0xc8, 0xd0,
+  0x14, 0x20, 0x1a, 0xbd, 0xbe, 0xcf, 0xc0, 0x31, 0x08, 0xf8, 0x06, 0xfe,
+  0x0e, 0x4d, 0xec, 0xf9, 0x16, 0x20, 0x17, 0x34, 0xc9, 0xc2, 0xf1, 0xf2,
+  0xdb, 0x06, 0xc9, 0x03, 0x21, 0xef, 0x3d, 0x41, 0xf8, 0x15, 0x0e, 0x15,
+  0x2d, 0x2f, 0xda, 0x05, 0x43, 0xfe, 0x31, 0xd3, 0x38, 0xf2, 0x6a, 0x10,
+  0xd9, 0x59, 0x1c, 0x33, 0xd7, 0xfc, 0x54, 0x0e, 0x06, 0x3d, 0x0d, 0xcf,
+  0x22, 0xfb, 0xc3, 0x05, 0x03, 0x06, 0xfc, 0xaa, 0xbd, 0xb8, 0xc1, 0x0d,
+  0x1e, 0xd8, 0x26, 0x37, 0x3f, 0x34, 0xe6, 0xdb, 0x38, 0xd6, 0xc8, 0x12,
+  0x3c, 0xcd, 0x02, 0xed, 0x09, 0x24, 0xd9, 0x3d, 0x2e, 0x24, 0x05, 0xf8,
+  0xf7, 0xda, 0xf2, 0x02, 0xf4, 0x20, 0xe1, 0xd0, 0x28, 0x98, 0x28, 0x10,
+  0x1d, 0xcb, 0xf9, 0xef, 0xf5, 0x3d, 0x15, 0xe9, 0x10, 0x94, 0x35, 0x1e,
+  0x17, 0xf7, 0x5b, 0xcb, 0x10, 0xed, 0xfb, 0x04, 0xc6, 0x06, 0xe1, 0xcf,
+  0xe2, 0xf9, 0x9b, 0x43, 0x22, 0xfb, 0xe2, 0x3d, 0xfe, 0x0b, 0x8d, 0x0f,
+  0x17, 0xd0, 0xf3, 0x23, 0x64, 0xbb, 0x05, 0x3c, 0xef, 0xfe, 0xcb, 0x27,
+  0x41, 0x08, 0xf4, 0xe1, 0xe6, 0xed, 0x14, 0xc9, 0x02, 0x13, 0xd2, 0x2f,
+  0xbc, 0xb6, 0x38, 0x19, 0xe5, 0x18, 0x01, 0x11, 0xfb, 0x00, 0xd0, 0xb2,
+  0xf2, 0xbf, 0x38, 0xf0, 0x07, 0xa4, 0x00, 0x1d, 0x23, 0xff, 0xba, 0xf7,
+  0x10, 0xea, 0xf3, 0xfe, 0x42, 0x9d, 0x17, 0xdb, 0x00, 0xf4, 0x1b, 0xde,
+  0xe9, 0x07, 0x09, 0x0d, 0xe7, 0x08, 0x29, 0x1b, 0xdc, 0x39, 0x09, 0x07,
+  0xfa, 0x0a, 0xf2, 0xd9, 0x06, 0xfd, 0x03, 0xe4, 0xda, 0xde, 0x52, 0x09,
+  0x2d, 0x09, 0x21, 0x00, 0x09, 0xeb, 0xea, 0xf1, 0xdf, 0x3c, 0xda, 0xf5,
+  0x40, 0x23, 0xdd, 0x06, 0xfa, 0xea, 0x39, 0xf8, 0x51, 0x11, 0x3f, 0xe6,
+  0xfe, 0x05, 0xac, 0xd1, 0x35, 0xe4, 0xb6, 0xfa, 0x3b, 0xf6, 0xf5, 0xda,
+  0x20, 0x37, 0x11, 0xd1, 0xf0, 0xdc, 0xe9, 0x12, 0xfd, 0x2c, 0xe7, 0x12,
+  0x03, 0xe5, 0x27, 0xf5, 0xd0, 0xf9, 0x10, 0xf5, 0x0e, 0x01, 0xd0, 0xd7,
+  0xf6, 0x0b, 0x3c, 0x1c, 0x43, 0xf6, 0x28, 0x0f, 0x17, 0xe2, 0xcc, 0xe3,
+  0xab, 0x28, 0xc6, 0xd6, 0x1e, 0xff, 0xca, 0xed, 0x38, 0x2a, 0x18, 0x2a,
+  0x33, 0x4d, 0xf7, 0xe4, 0x4a, 0x05, 0x01, 0x0b, 0x29, 0xd3, 0xdd, 0xcf,
+  0x66, 0xf1, 0x21, 0xe8, 0x16, 0x37, 0xce, 0xe6, 0x11, 0xf8, 0x0b, 0x24,
+  0x1a, 0x1a, 0xf3, 0x00, 0xdd, 0xde, 0xf8, 0xf2, 0xba, 0x0a, 0x2f, 0xe7,
+  0x15, 0x2d, 0x15, 0xe4, 0xf1, 0xf0, 0x46, 0xda, 0xf0, 0x02, 0xd7, 0x00,
+  0xea, 0xb4, 0x5f, 0xe6, 0x25, 0x00, 0x1e, 0x29, 0x18, 0xe2, 0xe9, 0xea,
+  0xf6, 0x14, 0xf2, 0xc2, 0xd8, 0xa0, 0x13, 0x44, 0xfe, 0xea, 0xca, 0xf8,
+  0xe4, 0xd6, 0x0b, 0x2e, 0x3e, 0x05, 0x42, 0x17, 0x1b, 0xf9, 0x09, 0x10,
+  0x33, 0x04, 0x57, 0xdc, 0xf6, 0x93, 0x22, 0x31, 0x01, 0x18, 0x32, 0xcf,
+  0xeb, 0xf1, 0xd7, 0x39, 0xaa, 0xd2, 0x2a, 0x15, 0xf5, 0xfc, 0x0a, 0x12,
+  0x14, 0xdb, 0xd9, 0xfc, 0x27, 0x19, 0x24, 0xd5, 0x31, 0xe5, 0xfb, 0xdc,
+  0xfc, 0x13, 0x17, 0x10, 0x04, 0xef, 0x37, 0x00, 0x51, 0x2e, 0x28, 0xe9,
+  0x5a, 0xf2, 0xf0, 0xcf, 0xe1, 0xe0, 0x17, 0x28, 0x19, 0x0b, 0xe3, 0x12,
+  0x03, 0xf2, 0x17, 0xe7, 0x1e, 0xe9, 0x1e, 0x19, 0x31, 0xf7, 0xc2, 0xf7,
+  0x3a, 0x0c, 0x15, 0xd7, 0xfa, 0xff, 0xd3, 0x03, 0xeb, 0xbb, 0xd9, 0x07,
+  0xeb, 0x02, 0x1d, 0xfd, 0xe2, 0xe8, 0xd6, 0x1f, 0xfa, 0xfb, 0xdf, 0xef,
+  0x43, 0x1c, 0xee, 0xfc, 0x12, 0x18, 0xf2, 0x06, 0xe8, 0x30, 0x0f, 0xf7,
+  0x2e, 0x0f, 0x11, 0xd6, 0x1f, 0x1b, 0x0d, 0xbb, 0x32, 0xe9, 0x21, 0xe3,
+  0x23, 0xcf, 0xf7, 0x09, 0x32, 0x36, 0xdb, 0xed, 0x40, 0x1c, 0x01, 0xe5,
+  0x1a, 0x06, 0xd6, 0xc9, 0x13, 0x07, 0xd2, 0x99, 0xed, 0xfe, 0x2c, 0x0b,
+  0x32, 0x49, 0xf0, 0xfe, 0x01, 0xeb, 0x22, 0xf0, 0x01, 0xb0, 0xc2, 0xc2,
+  0x01, 0xf6, 0x1e, 0x00, 0x43, 0xca, 0x2f, 0x1e, 0x12, 0xe1, 0xe9, 0x0d,
+  0x25, 0x1a, 0xbd, 0xb4, 0xff, 0xcc, 0x0f, 0x13, 0xcf, 0xfe, 0xe2, 0x26,
+  0xd7, 0x25, 0xf4, 0x3b, 0xf1, 0xeb, 0x12, 0xc2, 0xfe, 0xc3, 0x24, 0x02,
+  0xeb, 0x04, 0x53, 0xe1, 0xed, 0xde, 0xeb, 0x30, 0x1f, 0x25, 0x2a, 0x16,
+  0xe0, 0xc1, 0xe9, 0x07, 0x07, 0xd4, 0xf7, 0xcd, 0xd0, 0x01, 0xdd, 0xf7,
+  0x1b, 0xcd, 0xb7, 0x15, 0x0c, 0x2a, 0x44, 0xda, 0x56, 0x9a, 0x4a, 0xe2,
+  0x17, 0x28, 0x3f, 0x08, 0x10, 0x07, 0x04, 0xe1, 0xfe, 0xed, 0xe0, 0xbf,
+  0x2b, 0xf4, 0x1b, 0x2b, 0xf1, 0x02, 0x1a, 0xea, 0xc5, 0xda, 0x11, 0xba,
+  0x07, 0xc9, 0xff, 0xe1, 0x19, 0x2c, 0x1b, 0x1f, 0x03, 0x0a, 0xd2, 0x20,
+  0x5c, 0x08, 0x10, 0xf8, 0x3c, 0xc4, 0x01, 0xdf, 0xfb, 0xee, 0xd5, 0xff,
+  0xcb, 0x10, 0xb6, 0xcd, 0xef, 0xe7, 0xcd, 0x17, 0x0e, 0x16, 0x21, 0xd7,
+  0x62, 0x01, 0x3e, 0xce, 0xc2, 0x48, 0x23, 0x40, 0x1c, 0x55, 0xf9, 0xda,
+  0x41, 0x19, 0xd9, 0xfa, 0xe8, 0x17, 0x0e, 0x06, 0x34, 0xd9, 0x20, 0xe7,
+  0x9d, 0xd3, 0x16, 0xde, 0x05, 0x22, 0x9b, 0x2c, 0x16, 0x38, 0xf9, 0xf3,
+  0x2f, 0x08, 0xd0, 0xf7, 0x17, 0xff, 0x08, 0xdc, 0x38, 0xa1, 0x7f, 0xd7,
+  0xbf, 0xfe, 0x08, 0x33, 0xf9, 0xcd, 0xf5, 0x10, 0x0b, 0xe9, 0xa0, 0xec,
+  0x18, 0xe9, 0xe0, 0x0a, 0xfc, 0x07, 0xdc, 0x46, 0xb9, 0xe1, 0xfe, 0x73,
+  0xc5, 0x20, 0x1e, 0xcf, 0x51, 0xdc, 0xe9, 0xf3, 0x18, 0x02, 0xd0, 0xe6,
+  0xf5, 0xee, 0xf8, 0xd3, 0x08, 0xe3, 0x1a, 0x11, 0x11, 0x04, 0xef, 0x27,
+  0x39, 0x22, 0x04, 0x0e, 0x6a, 0x2a, 0xeb, 0xfe, 0x1e, 0x0f, 0xae, 0x1b,
+  0xb3, 0x13, 0xff, 0x3f, 0xff, 0x0b, 0x12, 0x05, 0xfe, 0xf0, 0xf1, 0x11,
+  0x0a, 0xfa, 0xcf, 0x17, 0xe2, 0x21, 0xec, 0xfd, 0x0c, 0xd7, 0xf2, 0x0d,
+  0xf9, 0xf2, 0xfb, 0x1d, 0xf2, 0x47, 0xeb, 0xd1, 0x14, 0xb6, 0xea, 0xb7,
+  0x1f, 0xfa, 0xf4, 0x60, 0x52, 0xba, 0x0d, 0x16, 0x19, 0xe9, 0x37, 0xf7,
+  0xfa, 0x03, 0x09, 0x15, 0x11, 0xe2, 0x07, 0xe5, 0xf5, 0x17, 0xde, 0xc1,
+  0x00, 0xec, 0xda, 0x00, 0xd5, 0xfe, 0xee, 0x25, 0x1c, 0x09, 0x3d, 0x0e,
+  0xf8, 0x29, 0x3f, 0x3e, 0xda, 0xf5, 0x2a, 0xf8, 0x12, 0x09, 0x05, 0x1c,
+  0xe6, 0xfe, 0xf3, 0x34, 0x23, 0x2c, 0x08, 0xe6, 0x24, 0x13, 0xe2, 0xf3,
+  0xe3, 0x10, 0xfa, 0xe4, 0x00, 0xfd, 0xe1, 0x38, 0xde, 0xf3, 0xcf, 0x12,
+  0xe6, 0x11, 0x3c, 0x1a, 0x0e, 0x19, 0xfc, 0xcd, 0x32, 0x05, 0x3b, 0xf5,
+  0x0c, 0x1c, 0xef, 0x35, 0xd8, 0xe0, 0xbd, 0xfb, 0x91, 0xee, 0xdb, 0x19,
+  0xe9, 0x15, 0x17, 0x2f, 0x19, 0x04, 0xe5, 0xff, 0x3f, 0xc5, 0xd9, 0xea,
+  0xe7, 0xeb, 0x10, 0xf8, 0xf7, 0xda, 0xf2, 0xd5, 0xb8, 0x3b, 0x2e, 0x0e,
+  0xf9, 0x22, 0xf4, 0x29, 0xfc, 0xf0, 0x0b, 0xd3, 0xd2, 0xc4, 0xf0, 0xf1,
+  0x1a, 0xda, 0xdc, 0xe6, 0x24, 0x05, 0x15, 0x0b, 0x26, 0xd9, 0x38, 0x1a,
+  0xe9, 0xc9, 0x01, 0xe2, 0x0a, 0x0b, 0xda, 0x06, 0xef, 0x24, 0xfc, 0x2d,
+  0xcf, 0x2e, 0x59, 0xdc, 0x12, 0x0f, 0x4f, 0x15, 0xe9, 0x09, 0xc7, 0xfc,
+  0x19, 0xd7, 0xd8, 0x11, 0xe1, 0x47, 0xf2, 0x28, 0x01, 0xd0, 0x06, 0xfe,
+  0x2a, 0x43, 0xf0, 0xf4, 0x24, 0x15, 0xfd, 0xed, 0x07, 0xdd, 0xcc, 0x41,
+  0xdd, 0xb0, 0x0d, 0xfc, 0xeb, 0xf6, 0xd7, 0xfb, 0xf3, 0xe7, 0x08, 0xe9,
+  0x05, 0xda, 0x21, 0x50, 0xe6, 0xeb, 0x1c, 0xe8, 0xe5, 0xf9, 0xe0, 0x0c,
+  0xd7, 0x1d, 0xdc, 0xd8, 0xcc, 0x00, 0x25, 0xe9, 0x48, 0x1d, 0x15, 0x21,
+  0x07, 0x0f, 0xf0, 0x2a, 0x05, 0x1e, 0xcb, 0xef, 0xc7, 0x23, 0x04, 0x42,
+  0xfa, 0x17, 0x14, 0x33, 0xea, 0x35, 0xd6, 0x16, 0x06, 0xc9, 0xe4, 0x2e,
+  0x04, 0xe8, 0xf5, 0x1e, 0xb2, 0xe4, 0x27, 0x1f, 0x95, 0xcf, 0xf0, 0xe2,
+  0xf4, 0xea, 0x1b, 0x19, 0xdf, 0x14, 0xe9, 0x6e, 0x44, 0x17, 0xfd, 0xea,
+  0x2c, 0xcc, 0x10, 0x0d, 0xd2, 0xe8, 0xec, 0xbe, 0xaa, 0xf2, 0xf1, 0x21,
+  0xd1, 0xfd, 0x06, 0xe6, 0x03, 0xfb, 0xfd, 0xe2, 0x18, 0xd6, 0x08, 0x19,
+  0x90, 0x08, 0xfa, 0x46, 0xeb, 0x43, 0x1c, 0x01, 0xe8, 0x55, 0xf0, 0xf0,
+  0x2a, 0xb9, 0x17, 0x01, 0x22, 0xec, 0xc9, 0xfd, 0xf3, 0xf8, 0x17, 0xfb,
+  0xe6, 0x09, 0xd2, 0x1c, 0x18, 0xce, 0xf3, 0x0c, 0x3d, 0xd9, 0xd7, 0xec,
+  0x58, 0xfb, 0x19, 0xdb, 0x18, 0xf9, 0x1e, 0x30, 0xf8, 0xeb, 0x28, 0xea,
+  0x81, 0xda, 0xfd, 0xf3, 0xf5, 0x07, 0x19, 0xf0, 0xd2, 0x03, 0xe9, 0xfa,
+  0x26, 0xc4, 0xf2, 0x07, 0xef, 0x1c, 0xf3, 0x58, 0xe6, 0x00, 0x14, 0x3b,
+  0x11, 0xf3, 0xef, 0x01, 0x08, 0x10, 0xf7, 0x08, 0x04, 0xe1, 0xec, 0x11,
+  0x46, 0xda, 0x0e, 0xbb, 0x03, 0x1e, 0x08, 0xe6, 0xec, 0xda, 0x0f, 0x56,
+  0xea, 0xbb, 0xc7, 0x2d, 0x4b, 0x2e, 0x12, 0xf7, 0x38, 0x12, 0xd9, 0x2e,
+  0x2d, 0x0f, 0xfb, 0xc6, 0xc6, 0xf0, 0xd0, 0xe7, 0xfa, 0xec, 0x15, 0xee,
+  0x1a, 0xf5, 0x07, 0xf2, 0x04, 0x12, 0x0a, 0x32, 0x01, 0x1a, 0xfd, 0x25,
+  0x11, 0xe3, 0x12, 0xe5, 0x16, 0xfc, 0x32, 0xca, 0xdd, 0x06, 0x2d, 0x19,
+  0x23, 0x21, 0x03, 0xeb, 0x0b, 0xbf, 0x00, 0xf6, 0x48, 0xde, 0xe5, 0xea,
+  0x04, 0x99, 0x15, 0x15, 0xbc, 0x19, 0xef, 0x21, 0x2e, 0x25, 0xb9, 0x23,
+  0x15, 0x0a, 0xdc, 0x12, 0x17, 0x25, 0xea, 0x0f, 0xf1, 0xe7, 0x04, 0xd6,
+  0x35, 0x1e, 0xc2, 0x05, 0x01, 0x2a, 0x21, 0xf1, 0xcc, 0xcc, 0xe0, 0xf5,
+  0xa8, 0x35, 0xeb, 0x59, 0xc1, 0x1f, 0x12, 0xf1, 0x06, 0xf2, 0xda, 0xbc,
+  0xf9, 0x1c, 0xae, 0xe2, 0x29, 0xf8, 0x09, 0x14, 0xd0, 0xdf, 0xe4, 0x19,
+  0xdf, 0xe4, 0x15, 0xfd, 0xd4, 0xe4, 0x20, 0xdc, 0xfc, 0xe6, 0xd6, 0x1e,
+  0xf2, 0xf4, 0x3b, 0xe9, 0xf6, 0x00, 0x23, 0xe3, 0xfa, 0x2d, 0x32, 0x42,
+  0x05, 0xc5, 0x6b, 0xd1, 0xf3, 0xe6, 0xcf, 0xc6, 0x31, 0x00, 0x0c, 0xe6,
+  0xd2, 0xde, 0x09, 0x0d, 0xdf, 0x43, 0x2b, 0x10, 0xbc, 0xea, 0xfd, 0xc3,
+  0xff, 0x04, 0x00, 0xfc, 0x1b, 0x0d, 0xc3, 0xe7, 0xd3, 0x1c, 0x01, 0xf9,
+  0xd6, 0xb2, 0x0b, 0x15, 0xfd, 0x00, 0x0f, 0x3f, 0x23, 0xbe, 0x5b, 0xdd,
+  0xce, 0x03, 0xe8, 0x21, 0xd4, 0xe1, 0x14, 0x0c, 0xe4, 0xf5, 0xfd, 0xf3,
+  0xf8, 0x43, 0xf4, 0x3a, 0xab, 0x1c, 0xf8, 0x04, 0xff, 0xfd, 0xd5, 0xc9,
+  0xcf, 0xfe, 0xf4, 0x0f, 0xbc, 0xd9, 0xe3, 0xef, 0x48, 0x20, 0x46, 0x30,
+  0x01, 0xcd, 0xb0, 0xb8, 0x0e, 0x2a, 0xeb, 0x21, 0x1c, 0xfb, 0x2b, 0x0c,
+  0xfe, 0x09, 0xf0, 0xe4, 0xec, 0xdf, 0x2e, 0xe6, 0x0f, 0xde, 0x1e, 0x78,
+  0xbd, 0xda, 0x17, 0x02, 0x29, 0x50, 0x15, 0x00, 0xda, 0xcd, 0x3e, 0x38,
+  0x1a, 0xd1, 0x07, 0xfd, 0x01, 0x28, 0x12, 0x3d, 0xb0, 0xd4, 0xcc, 0x1b,
+  0x7c, 0xf9, 0xe7, 0x45, 0xef, 0x28, 0x29, 0xe7, 0xfc, 0x19, 0xe9, 0xf1,
+  0xcf, 0x27, 0xf9, 0x66, 0xcb, 0x15, 0xff, 0xe0, 0xe0, 0x0d, 0x0a, 0x02,
+  0xec, 0x0b, 0x0c, 0xa8, 0x07, 0x0d, 0x2f, 0x29, 0x02, 0xe2, 0xe7, 0x1f,
+  0xf6, 0xf1, 0xe2, 0x09, 0xe9, 0xfc, 0x21, 0xf9, 0xe5, 0xfd, 0xe9, 0xeb,
+  0xd7, 0x04, 0xfd, 0xc5, 0x2b, 0xc3, 0x19, 0x0b, 0xde, 0x0c, 0xe0, 0x03,
+  0x7f, 0x0a, 0x38, 0xdd, 0x34, 0xfd, 0xe5, 0x26, 0x24, 0xf2, 0x16, 0xde,
+  0xec, 0xff, 0xd6, 0x36, 0x02, 0x23, 0x40, 0x39, 0xbe, 0x05, 0xe5, 0xf5,
+  0xc3, 0x0e, 0x27, 0xf7, 0x0a, 0xe1, 0x0c, 0xe5, 0x10, 0x08, 0x06, 0x08,
+  0xc8, 0xcb, 0x1d, 0x0c, 0xf8, 0x0b, 0x23, 0x26, 0x42, 0xef, 0x45, 0xcd,
+  0xce, 0x0e, 0xfc, 0xc6, 0xfc, 0xe5, 0xca, 0xd1, 0x43, 0xd3, 0x01, 0x2a,
+  0xe9, 0x26, 0xeb, 0x1f, 0x46, 0x37, 0xe5, 0xd9, 0x0e, 0xeb, 0xa3, 0x2a,
+  0xe0, 0xfc, 0x07, 0x04, 0xf5, 0x0b, 0xf6, 0x21, 0x36, 0x34, 0x23, 0xf5,
+  0xb0, 0xf0, 0x9b, 0xda, 0xde, 0x11, 0xf9, 0xf5, 0x3f, 0xd4, 0xf6, 0xe9,
+  0xd9, 0x30, 0x2a, 0x27, 0xe9, 0xd2, 0x2e, 0x1b, 0xf8, 0x00, 0x54, 0x1c,
+  0x20, 0x0a, 0x19, 0xc9, 0xf0, 0x07, 0xe6, 0x13, 0x1e, 0xf8, 0xdc, 0xb3,
+  0x0c, 0xc2, 0x28, 0x0f, 0xed, 0x03, 0x0d, 0x33, 0x00, 0xf4, 0xbc, 0xdc,
+  0xff, 0xf3, 0x0b, 0x20, 0xdb, 0x16, 0x1e, 0xf5, 0x1d, 0x3f, 0xee, 0xed,
+  0xf0, 0x0c, 0x22, 0xf4, 0x29, 0x10, 0x0f, 0xea, 0x15, 0xf7, 0x1c, 0xf4,
+  0xf5, 0xed, 0xfc, 0xb3, 0x23, 0xf3, 0x31, 0x14, 0x46, 0xb5, 0xf7, 0xdc,
+  0xaf, 0xf3, 0xfd, 0x1c, 0x00, 0xce, 0xeb, 0x4e, 0xf6, 0x1c, 0x0f, 0x00,
+  0x10, 0xe3, 0xe3, 0xe9, 0x29, 0xb6, 0xf1, 0xf0, 0x0a, 0xc9, 0xe0, 0xb3,
+  0x1a, 0x18, 0xd6, 0xc1, 0x25, 0x05, 0xf6, 0x0b, 0xee, 0xd5, 0x0c, 0xe6,
+  0x3c, 0x27, 0xe7, 0x0d, 0x20, 0xdf, 0x2d, 0x0d, 0x40, 0x0c, 0x07, 0xee,
+  0x0f, 0xd7, 0x27, 0x02, 0x12, 0x01, 0x10, 0xe0, 0x09, 0x05, 0x12, 0xb3,
+  0x2f, 0xfc, 0x0e, 0x10, 0xed, 0xf0, 0xfd, 0x24, 0xf9, 0xda, 0xf8, 0x36,
+  0xf7, 0xc6, 0x3c, 0xc6, 0xc0, 0xf2, 0xc5, 0xeb, 0xf2, 0xb2, 0xfd, 0x14,
+  0xfd, 0xf5, 0xf7, 0xa9, 0x21, 0x1c, 0xe1, 0xec, 0xf6, 0xd3, 0xf1, 0x01,
+  0xe3, 0xd9, 0x19, 0xf5, 0x0d, 0x51, 0x2c, 0xfd, 0x39, 0xde, 0x12, 0xf5,
+  0xc9, 0xe1, 0xdb, 0xf3, 0xb8, 0xf6, 0x05, 0x0b, 0x3d, 0xfe, 0xff, 0xe4,
+  0x1a, 0x3c, 0x2c, 0x1a, 0x3e, 0xfc, 0xf0, 0xf1, 0x0b, 0x27, 0x00, 0x00,
+  0x25, 0xde, 0x03, 0xf4, 0xd4, 0xb6, 0x39, 0x06, 0xec, 0x07, 0xf2, 0xb8,
+  0x33, 0xd4, 0xfd, 0x12, 0xff, 0x03, 0x09, 0xab, 0xf0, 0xfd, 0xb3, 0xfe,
+  0x13, 0x02, 0xa8, 0xb7, 0x1c, 0x13, 0x1b, 0x13, 0xdf, 0x32, 0x24, 0x3a,
+  0xdf, 0x1d, 0xe0, 0xed, 0xf6, 0x11, 0x01, 0x06, 0x08, 0xd4, 0xfc, 0x04,
+  0x46, 0xe3, 0xf1, 0x51, 0x20, 0x10, 0x02, 0x2b, 0xe0, 0x18, 0xf7, 0xfe,
+  0xb4, 0x23, 0x5f, 0xe3, 0xf7, 0x1b, 0x21, 0xd1, 0xb0, 0xe9, 0x0e, 0x10,
+  0x20, 0x01, 0xba, 0xfa, 0xcd, 0xe1, 0xc8, 0x2a, 0xe7, 0x3b, 0xde, 0x32,
+  0x20, 0xef, 0x94, 0x31, 0xe1, 0xf7, 0xd8, 0xde, 0x28, 0x01, 0x13, 0xf1,
+  0xf2, 0x3c, 0xe3, 0x03, 0xa6, 0xfe, 0xec, 0xfd, 0xde, 0x16, 0xf6, 0xd3,
+  0xde, 0xd8, 0x26, 0x17, 0x3a, 0xe8, 0xcd, 0xef, 0xec, 0x11, 0xe1, 0x09,
+  0xad, 0xf3, 0xf3, 0x38, 0xb1, 0x45, 0x23, 0xdf, 0x09, 0xd3, 0xed, 0xda,
+  0xe2, 0xd7, 0x2c, 0xf8, 0xd3, 0xdf, 0xc3, 0x08, 0xf1, 0xfb, 0xb7, 0xe2,
+  0xd8, 0x73, 0xc1, 0x24, 0x1d, 0xc0, 0xf8, 0x14, 0x3d, 0x0c, 0xc4, 0x15,
+  0xe9, 0xf6, 0x2c, 0xe8, 0xe0, 0x48, 0xe4, 0x0c, 0xf4, 0x06, 0xf5, 0x32,
+  0xcc, 0x54, 0x56, 0xed, 0xe9, 0xa9, 0x16, 0xfe, 0x5b, 0xc1, 0xfa, 0x1b,
+  0xfb, 0x00, 0xdc, 0x04, 0xec, 0x37, 0x29, 0x40, 0xf7, 0x12, 0x09, 0xfb,
+  0x31, 0xee, 0xfe, 0xfe, 0xfc, 0x1b, 0x17, 0xb5, 0x9a, 0xf6, 0xa3, 0x16,
+  0xf6, 0x30, 0xc7, 0xe0, 0x8d, 0x42, 0xde, 0x1b, 0x00, 0xbc, 0xdb, 0x35,
+  0xe5, 0xc7, 0xfa, 0x1c, 0xd8, 0xf6, 0xf5, 0xe1, 0x08, 0x48, 0x13, 0x1b,
+  0x2a, 0x03, 0xe4, 0x2a, 0xe2, 0x5c, 0xe7, 0x37, 0xea, 0x30, 0xfa, 0x97,
+  0xf1, 0xf4, 0xf2, 0x11, 0xf3, 0x06, 0xda, 0x44, 0x0a, 0xd8, 0xf4, 0xfd,
+  0xf6, 0xe5, 0x10, 0xfb, 0xf9, 0x30, 0xec, 0xd7, 0xbc, 0x0b, 0x00, 0xdf,
+  0xe3, 0x07, 0x1c, 0x03, 0xf3, 0xfc, 0x2b, 0x31, 0xe4, 0x1b, 0x11, 0x23,
+  0xbf, 0x07, 0xde, 0x12, 0xef, 0xc0, 0xf1, 0x0d, 0xf2, 0x3a, 0x0a, 0xfb,
+  0x09, 0x3d, 0xfa, 0x03, 0x3e, 0xf0, 0x07, 0x1d, 0xf0, 0x3a, 0xf5, 0xfd,
+  0xd5, 0x6f, 0xd6, 0xe2, 0x1a, 0x27, 0xc8, 0xcc, 0xb5, 0x15, 0xd2, 0x2e,
+  0x20, 0xd2, 0xf2, 0xd2, 0xbf, 0x1a, 0x15, 0xeb, 0xe1, 0xf4, 0xe9, 0xc5,
+  0x0c, 0xe6, 0xf7, 0xcf, 0x07, 0xfa, 0x2f, 0xe4, 0x16, 0xef, 0x05, 0xfb,
+  0x65, 0xdf, 0x34, 0xe7, 0xeb, 0xee, 0x31, 0xdf, 0x10, 0xac, 0xf9, 0x0a,
+  0xda, 0x27, 0x12, 0xeb, 0xf0, 0x58, 0x13, 0x0e, 0x0c, 0x08, 0x21, 0x27,
+  0x9f, 0x53, 0x0f, 0xcd, 0xeb, 0xdd, 0x0b, 0xc5, 0x0a, 0xed, 0xea, 0xf3,
+  0xf5, 0x05, 0x0f, 0x0e, 0x0a, 0x06, 0x09, 0xfd, 0xdd, 0xe0, 0xe7, 0xff,
+  0x2e, 0x16, 0xec, 0xef, 0xe4, 0x04, 0x11, 0xda, 0xe4, 0xfb, 0x08, 0x3f,
+  0xda, 0x2d, 0x38, 0x0d, 0x00, 0x1f, 0x3d, 0xe6, 0xe8, 0xd4, 0x4c, 0xf8,
+  0xec, 0xd3, 0x07, 0x2c, 0xca, 0xd5, 0xff, 0xeb, 0xef, 0xd1, 0x09, 0xf2,
+  0x0e, 0x4e, 0xf6, 0x0a, 0xf2, 0x2e, 0xb9, 0x29, 0xf4, 0x21, 0x13, 0xb6,
+  0xe8, 0xc0, 0x14, 0x34, 0x1c, 0x11, 0x01, 0xc9, 0x52, 0x24, 0x2d, 0x45,
+  0x28, 0xca, 0xf3, 0x4f, 0xf5, 0x1e, 0xff, 0xd8, 0xc4, 0xcd, 0x18, 0xf7,
+  0xe0, 0x02, 0xd9, 0x06, 0x03, 0x00, 0x00, 0x13, 0x9f, 0x1e, 0x0a, 0x30,
+  0x1c, 0x0b, 0xf8, 0x06, 0xbe, 0x01, 0x0b, 0x14, 0xf6, 0x2b, 0x0a, 0x22,
+  0x44, 0x0c, 0xfc, 0x0f, 0x04, 0x3b, 0xf7, 0x18, 0xf8, 0x33, 0xd8, 0x46,
+  0xde, 0x2d, 0xf9, 0xe5, 0xff, 0x07, 0x03, 0xe5, 0xf3, 0xf6, 0xee, 0x00,
+  0x7f, 0xe9, 0xef, 0xf5, 0xe9, 0xd9, 0x02, 0x2b, 0x1b, 0xea, 0x06, 0xdb,
+  0xd4, 0xf2, 0x1c, 0xda, 0x02, 0x31, 0xd6, 0xda, 0xe2, 0x07, 0x3f, 0xfa,
+  0x4f, 0x33, 0x11, 0x0d, 0x29, 0x09, 0x14, 0x1b, 0x10, 0xe3, 0xf9, 0x16,
+  0xff, 0xe9, 0xff, 0xee, 0x40, 0x11, 0xdb, 0xfe, 0x18, 0x10, 0x0f, 0x0a,
+  0xc6, 0x30, 0xe3, 0x04, 0x06, 0xe6, 0xe0, 0xea, 0x0b, 0x06, 0xeb, 0xd8,
+  0xee, 0x27, 0x18, 0xd5, 0x5a, 0x0a, 0xf6, 0xdc, 0x30, 0xf2, 0xfd, 0x01,
+  0x31, 0xc6, 0xd8, 0x19, 0xfb, 0xfa, 0xe3, 0xcd, 0x0b, 0xf5, 0xdd, 0x15,
+  0xcd, 0x2a, 0x0a, 0x0f, 0x3b, 0x22, 0x1d, 0x03, 0x3d, 0xfd, 0x32, 0xf0,
+  0x8e, 0xd4, 0x00, 0xd3, 0x0d, 0x29, 0xd6, 0x2c, 0x12, 0xf6, 0xf1, 0xa5,
+  0xfa, 0xee, 0x1b, 0xbc, 0xdf, 0x0e, 0xe2, 0x09, 0xae, 0x13, 0x16, 0x1c,
+  0xb9, 0xec, 0x08, 0x2d, 0xe8, 0x3c, 0xec, 0xfd, 0xf2, 0xcd, 0x4f, 0xdc,
+  0xe5, 0xe4, 0xcb, 0xfd, 0xd3, 0x31, 0xbf, 0xed, 0x07, 0x29, 0x07, 0x29,
+  0x1a, 0x32, 0xb3, 0x02, 0x14, 0x2d, 0xee, 0x26, 0xfc, 0xe1, 0x14, 0x38,
+  0x01, 0xf3, 0x2c, 0x1c, 0x24, 0xbf, 0x27, 0xf9, 0xda, 0x2c, 0xdf, 0x1e,
+  0x08, 0xf8, 0xd9, 0x21, 0xc5, 0x09, 0x26, 0x1a, 0xfb, 0x02, 0x07, 0xfc,
+  0x1a, 0xf7, 0x0a, 0xda, 0xcd, 0xf3, 0xf6, 0x00, 0x0b, 0xf5, 0xd5, 0xf7,
+  0xea, 0xf1, 0x56, 0x17, 0xd5, 0xf8, 0xf4, 0xe5, 0xf7, 0x56, 0xfc, 0xd2,
+  0x33, 0x2a, 0x29, 0xee, 0x04, 0x3e, 0xf2, 0xfd, 0x1c, 0x19, 0x0c, 0x38,
+  0x0d, 0xf5, 0xfc, 0x0e, 0xbf, 0x05, 0xf3, 0x2c, 0x14, 0xcc, 0x17, 0xdd,
+  0x1d, 0x21, 0xe4, 0x1d, 0x35, 0x1e, 0xfe, 0x19, 0xcc, 0xe2, 0x0e, 0xf7,
+  0x20, 0x07, 0xf8, 0x07, 0x1d, 0x04, 0xca, 0xb0, 0xc9, 0x06, 0x5d, 0xdb,
+  0xf9, 0x18, 0xd2, 0xa9, 0xf6, 0x20, 0x01, 0x1b, 0xef, 0x08, 0x12, 0xe2,
+  0xdf, 0x32, 0x01, 0x1c, 0x34, 0x17, 0xff, 0xed, 0xea, 0x1b, 0xe6, 0x40,
+  0xf2, 0xf8, 0x19, 0xfe, 0xfd, 0x40, 0xd7, 0xe7, 0x23, 0x31, 0x00, 0x09,
+  0xe5, 0xcd, 0xc8, 0xd7, 0xe1, 0xe0, 0x09, 0x2a, 0xf9, 0x03, 0xfd, 0xe3,
+  0xe4, 0xed, 0x22, 0x0c, 0xd4, 0x10, 0x1c, 0x2a, 0xb7, 0xe3, 0x25, 0x17,
+  0xe5, 0xed, 0xf9, 0x57, 0x1c, 0xfc, 0xe3, 0xea, 0x2a, 0xff, 0x41, 0x13,
+  0x2e, 0xf6, 0xf7, 0x05, 0x0f, 0x0c, 0xdc, 0xff, 0xfe, 0xed, 0xfc, 0x1e,
+  0xf3, 0x11, 0x06, 0x03, 0x31, 0x30, 0xff, 0x49, 0xf7, 0xf0, 0xff, 0x08,
+  0x15, 0xd8, 0x27, 0xd2, 0x27, 0x81, 0xf7, 0xf2, 0xe2, 0x24, 0xe2, 0x0e,
+  0x30, 0xda, 0x1e, 0xe5, 0xeb, 0xe2, 0xfe, 0xe4, 0x18, 0xd2, 0x2a, 0xfa,
+  0xed, 0xfe, 0x00, 0xd8, 0xf0, 0xd1, 0xeb, 0x10, 0x23, 0xf3, 0xf1, 0x0c,
+  0x20, 0x02, 0x01, 0x04, 0xe2, 0xfb, 0x39, 0x1d, 0x11, 0x3a, 0xe9, 0xdd,
+  0x41, 0xfa, 0x27, 0x06, 0x4e, 0x2a, 0x09, 0xe5, 0x39, 0x42, 0x2b, 0x1d,
+  0x2a, 0xd4, 0x10, 0xec, 0xed, 0xc5, 0x29, 0x10, 0x14, 0xda, 0x23, 0xe2,
+  0x29, 0x1e, 0x18, 0xfd, 0x13, 0xe1, 0xe9, 0x15, 0xff, 0x08, 0xda, 0xf7,
+  0x11, 0x13, 0xf6, 0xfa, 0xf5, 0xfe, 0xf4, 0xcc, 0xe0, 0xe6, 0x4b, 0x03,
+  0x1f, 0xf0, 0xf7, 0xd2, 0x2f, 0x11, 0xdd, 0x15, 0xea, 0x09, 0x3f, 0x41,
+  0x02, 0x29, 0xfd, 0x0e, 0x16, 0x0d, 0x0d, 0xe0, 0x2b, 0xeb, 0xea, 0x0a,
+  0x0f, 0x52, 0x14, 0x05, 0x0e, 0xf1, 0x14, 0x14, 0xcf, 0xde, 0x46, 0xfa,
+  0x0a, 0x0a, 0x30, 0x15, 0xe9, 0xb3, 0x2e, 0xf4, 0xff, 0xf8, 0xfc, 0x32,
+  0xe9, 0x09, 0xbe, 0x3e, 0xb8, 0x2f, 0x11, 0x04, 0xde, 0xf5, 0xdb, 0xe3,
+  0x34, 0xfb, 0x1c, 0x50, 0x16, 0xcc, 0xec, 0xe7, 0xed, 0x22, 0x1f, 0x4e,
+  0xfd, 0x57, 0xd1, 0x34, 0x04, 0xd7, 0xf7, 0x0b, 0x0b, 0xee, 0xdf, 0x18,
+  0xd7, 0x0f, 0x1b, 0x4b, 0x17, 0xda, 0x12, 0x44, 0x01, 0x01, 0x12, 0xea,
+  0xe6, 0x27, 0xcc, 0xc9, 0x01, 0xaf, 0xef, 0xed, 0x83, 0x03, 0x06, 0x32,
+  0x3a, 0xfd, 0xd2, 0xf9, 0x0b, 0x0a, 0xda, 0xf3, 0xde, 0xf2, 0xda, 0xce,
+  0xfd, 0x55, 0xc6, 0xe0, 0x05, 0xf9, 0x0c, 0x2b, 0xf5, 0x16, 0xfa, 0x38,
+  0x0c, 0x36, 0xfe, 0x08, 0x2c, 0x04, 0x0c, 0xfb, 0xe7, 0x02, 0x0f, 0xb0,
+  0x3a, 0xcf, 0x29, 0x11, 0xf0, 0xe3, 0x03, 0x0e, 0x02, 0xd1, 0x2a, 0x0e,
+  0xea, 0xc2, 0x21, 0x02, 0x88, 0x0e, 0xdb, 0x15, 0xe7, 0xdb, 0x14, 0x05,
+  0x11, 0x07, 0x0f, 0x4a, 0xfa, 0xf9, 0x0e, 0xf5, 0x1d, 0x67, 0xff, 0xd0,
+  0xfd, 0x0f, 0xd2, 0xc3, 0x02, 0x36, 0xe6, 0xe8, 0x2a, 0xfd, 0x2a, 0xfc,
+  0x03, 0xdf, 0x00, 0x15, 0x2b, 0x2c, 0xf1, 0xd7, 0x3a, 0xf6, 0x22, 0x0e,
+  0xc9, 0x03, 0xf8, 0x15, 0x12, 0xde, 0xfc, 0xe5, 0x11, 0xbb, 0xea, 0xfe,
+  0x48, 0xb6, 0x20, 0xf9, 0xf0, 0x03, 0x2d, 0x55, 0x96, 0x25, 0x5f, 0x36,
+  0x41, 0x00, 0x2f, 0xdc, 0x0e, 0x08, 0x09, 0xde, 0xda, 0x10, 0x04, 0x09,
+  0x00, 0x35, 0x07, 0xec, 0x0b, 0x09, 0xf7, 0xff, 0x01, 0x0b, 0xf4, 0xda,
+  0xd2, 0xfd, 0x07, 0xe4, 0x01, 0xcd, 0x14, 0xf6, 0xeb, 0x12, 0xb9, 0x18,
+  0x4c, 0x05, 0x0b, 0xd7, 0xf2, 0xfe, 0x28, 0xf0, 0xea, 0xd7, 0xe5, 0x02,
+  0xf4, 0x32, 0x22, 0xcb, 0xe9, 0xbd, 0x20, 0xff, 0xfa, 0x0a, 0x15, 0xcf,
+  0xe8, 0xfc, 0xc8, 0xef, 0x39, 0xed, 0xf7, 0xfa, 0x29, 0xf7, 0x0f, 0xfc,
+  0x19, 0x15, 0xff, 0xdd, 0x10, 0x11, 0x01, 0xf9, 0xe7, 0x36, 0xeb, 0xf0,
+  0xdf, 0xfe, 0xc6, 0xc2, 0x07, 0xfd, 0x33, 0xf3, 0xfe, 0xcb, 0x12, 0xe7,
+  0xea, 0xde, 0xeb, 0x27, 0x42, 0x04, 0xf6, 0xde, 0xf4, 0x10, 0x3c, 0xfc,
+  0xd4, 0xf2, 0xf7, 0xeb, 0xdb, 0x35, 0x57, 0xe9, 0xaf, 0xce, 0x04, 0x2d,
+  0xf1, 0x0b, 0x0d, 0xec, 0xe1, 0xd7, 0xdb, 0xe4, 0x2b, 0xd9, 0x0a, 0xfd,
+  0x16, 0x07, 0x10, 0xe8, 0xfd, 0x1d, 0xe5, 0xdc, 0xec, 0xee, 0x0c, 0x13,
+  0x04, 0x06, 0x04, 0xf9, 0x04, 0x01, 0xde, 0xe0, 0xe8, 0xf9, 0xe4, 0xc0,
+  0xe6, 0xff, 0xfb, 0x14, 0xf7, 0x15, 0x1e, 0x0f, 0x20, 0x23, 0xe3, 0xe5,
+  0xfc, 0x0f, 0x27, 0x03, 0xf8, 0x0b, 0x20, 0xed, 0x02, 0x08, 0x51, 0x0e,
+  0xd9, 0xee, 0x1b, 0x29, 0x07, 0xf4, 0xf7, 0xfc, 0x12, 0xfc, 0xe6, 0xeb,
+  0xe8, 0x32, 0x29, 0xfe, 0xf5, 0x0d, 0xf9, 0xc7, 0x06, 0xf4, 0xf9, 0xfa,
+  0xf6, 0x1f, 0xfe, 0xec, 0xf2, 0xe7, 0x10, 0xfc, 0xe6, 0xe0, 0xf5, 0xe0,
+  0xeb, 0xec, 0x37, 0x01, 0xfe, 0x12, 0xe5, 0x1c, 0xd2, 0xe7, 0x44, 0xe4,
+  0xf2, 0x22, 0xf7, 0xf1, 0x07, 0xe0, 0x15, 0x11, 0x09, 0xe4, 0xec, 0xd6,
+  0x13, 0x33, 0xd4, 0x29, 0x0a, 0x17, 0xe5, 0x03, 0xbf, 0x34, 0x2a, 0xcd,
+  0xe4, 0x35, 0xf1, 0x05, 0xeb, 0x1d, 0x27, 0xed, 0x11, 0x03, 0xe6, 0x10,
+  0x08, 0xf5, 0xf6, 0x2b, 0xb6, 0x23, 0xfc, 0x04, 0x0d, 0xea, 0x07, 0xf4,
+  0xdc, 0xdb, 0xc2, 0xf9, 0xff, 0x06, 0x34, 0x05, 0xe2, 0xf2, 0x08, 0x03,
+  0xd9, 0xb7, 0x2a, 0x12, 0xdd, 0x0c, 0xe3, 0xe2, 0x00, 0xf6, 0x28, 0x32,
+  0x04, 0xf9, 0xdf, 0x0a, 0x02, 0x42, 0x14, 0x14, 0xf7, 0x10, 0xf5, 0x31,
+  0x04, 0x31, 0x34, 0x0b, 0xd5, 0x17, 0x0f, 0xcc, 0xe3, 0x0e, 0x1b, 0x05,
+  0xdf, 0x23, 0xf8, 0x12, 0xf9, 0xf8, 0xdc, 0x18, 0x00, 0xef, 0xf4, 0xe7,
+  0x10, 0xf6, 0x0a, 0x1c, 0xf7, 0xd0, 0xd5, 0x02, 0xf0, 0xe8, 0x1a, 0x35,
+  0xf0, 0xee, 0x11, 0xf5, 0x08, 0xfa, 0xea, 0xf9, 0xee, 0x04, 0xfd, 0xea,
+  0x10, 0xf6, 0x07, 0x20, 0x18, 0x18, 0x1d, 0x10, 0x03, 0xf2, 0xd0, 0x2a,
+  0x19, 0x41, 0x0f, 0xfb, 0x05, 0x0c, 0xe1, 0x01, 0x0e, 0x00, 0x1b, 0x00,
+  0x39, 0x21, 0xee, 0x1a, 0x17, 0xe1, 0x32, 0x0a, 0xd8, 0x13, 0x01, 0xf0,
+  0xe0, 0x06, 0x0f, 0x1f, 0xfc, 0x02, 0x0b, 0x0b, 0x2e, 0x0d, 0x2a, 0x15,
+  0x14, 0xde, 0xf5, 0xfa, 0x18, 0xf4, 0xef, 0x10, 0x1a, 0xbe, 0x4a, 0x43,
+  0xeb, 0x22, 0x0d, 0x19, 0xe4, 0x09, 0xfd, 0x0c, 0x2e, 0xf2, 0xe8, 0x0b,
+  0xef, 0xee, 0x0d, 0x1a, 0xfd, 0xf6, 0x0b, 0x19, 0xf7, 0x12, 0xff, 0xf2,
+  0xf8, 0x0b, 0x0f, 0x08, 0x55, 0x54, 0xea, 0x2a, 0x18, 0x0e, 0xfb, 0xea,
+  0xa7, 0xab, 0x03, 0x7f, 0xd8, 0x26, 0xff, 0x20, 0x14, 0xdf, 0xfc, 0xf7,
+  0x13, 0xd7, 0x1b, 0x40, 0x1c, 0x17, 0xfc, 0x01, 0xf7, 0xc7, 0xf2, 0x03,
+  0x16, 0xe9, 0x23, 0x35, 0xf2, 0x28, 0xf2, 0xe6, 0xff, 0xe7, 0xe6, 0xd9,
+  0x0c, 0x03, 0xcb, 0x02, 0x09, 0xd6, 0x24, 0xfe, 0x16, 0xda, 0x01, 0xf1,
+  0xf0, 0x2b, 0x0f, 0xdb, 0x06, 0x05, 0x03, 0xf0, 0x25, 0x4a, 0xe4, 0x15,
+  0x07, 0xfd, 0xf4, 0xb6, 0xe5, 0x26, 0x05, 0xec, 0x08, 0x15, 0x07, 0x2b,
+  0xf1, 0xef, 0xed, 0x11, 0xe4, 0xf8, 0xea, 0xfa, 0x00, 0xc1, 0x07, 0x0e,
+  0xf5, 0xdd, 0xef, 0xe0, 0xc2, 0xf3, 0xd4, 0xe3, 0xe9, 0x0c, 0xdf, 0x0a,
+  0x13, 0xd1, 0xca, 0xd8, 0x0d, 0x01, 0x02, 0x0e, 0x28, 0x02, 0xda, 0xd3,
+  0xfd, 0x10, 0x12, 0xce, 0xfa, 0x14, 0xe0, 0xfb, 0x04, 0x2c, 0x08, 0x1a,
+  0xda, 0x05, 0x0a, 0xb8, 0x2c, 0x05, 0xd7, 0xec, 0x21, 0x27, 0xc7, 0x2e,
+  0xd8, 0xe4, 0x15, 0x36, 0x0e, 0x49, 0x0a, 0xe5, 0xf0, 0x2a, 0x1e, 0x12,
+  0x04, 0xcb, 0xe6, 0xdf, 0x14, 0x51, 0xa9, 0x38, 0xfe, 0x23, 0x1c, 0x0c,
+  0x11, 0xe4, 0x19, 0xdf, 0x19, 0x21, 0xef, 0xc8, 0xef, 0xda, 0xf1, 0xe0,
+  0xf7, 0x08, 0xf8, 0xeb, 0xe9, 0xc4, 0x1a, 0xe0, 0xfa, 0x07, 0x0c, 0x06,
+  0xac, 0x0e, 0xf8, 0xfc, 0x08, 0x0b, 0x2c, 0xf3, 0x1e, 0x2a, 0xf7, 0xea,
+  0x1e, 0x27, 0xc6, 0xeb, 0x1f, 0x12, 0xef, 0x0b, 0x0f, 0x46, 0x22, 0xbe,
+  0xe6, 0x1c, 0xfd, 0x16, 0xf3, 0xd6, 0xd1, 0xe5, 0x1c, 0x13, 0x17, 0x34,
+  0x3c, 0x25, 0xf6, 0x01, 0xea, 0x24, 0x20, 0xfa, 0x20, 0xfa, 0x08, 0xcd,
+  0xd6, 0x35, 0x14, 0xbe, 0xe4, 0xfb, 0xd5, 0xe3, 0xff, 0xac, 0xe7, 0xe6,
+  0xe0, 0x2d, 0x19, 0xf2, 0xba, 0xf7, 0x22, 0x01, 0xbf, 0x07, 0x2e, 0xf4,
+  0x30, 0x14, 0x0a, 0xeb, 0xe1, 0x26, 0xdf, 0xb2, 0x58, 0xf2, 0xe3, 0xe7,
+  0x0b, 0x38, 0xed, 0xf1, 0x05, 0x1e, 0x43, 0x06, 0xc9, 0xff, 0xb9, 0xd0,
+  0x10, 0x46, 0xba, 0x17, 0x04, 0x2c, 0xcc, 0xf2, 0xd4, 0x18, 0x25, 0xf7,
+  0xdd, 0x0b, 0x03, 0xfa, 0x0b, 0xf6, 0x0b, 0x9c, 0xe5, 0x04, 0xf1, 0xe8,
+  0xed, 0xd6, 0xeb, 0xe6, 0xfb, 0x17, 0xdb, 0xf0, 0x0c, 0xd1, 0x34, 0x12,
+  0x10, 0x02, 0xbd, 0xdb, 0x06, 0xe3, 0xef, 0xe3, 0x51, 0xea, 0xc6, 0x21,
+  0xc3, 0x02, 0x14, 0x24, 0xbd, 0x30, 0xfb, 0x3d, 0x25, 0xcd, 0xea, 0xcf,
+  0xf3, 0xe1, 0xf1, 0xfa, 0x1c, 0xd7, 0xc9, 0x00, 0x00, 0xf6, 0x18, 0x09,
+  0x0f, 0xe9, 0xed, 0xaa, 0xf8, 0x32, 0xe0, 0x23, 0xe0, 0xc2, 0xfe, 0x0f,
+  0x30, 0x15, 0x1b, 0xea, 0xec, 0x03, 0x20, 0x1c, 0x0d, 0x0c, 0x0c, 0xdc,
+  0xbb, 0x28, 0xf6, 0x22, 0x13, 0xed, 0x91, 0x01, 0xe9, 0xd6, 0xe6, 0xe4,
+  0x56, 0xcd, 0xf5, 0x09, 0x2b, 0x10, 0x0e, 0xf4, 0x17, 0xfd, 0xcd, 0xf9,
+  0x15, 0x16, 0xd7, 0x06, 0x15, 0xd5, 0x00, 0x18, 0x14, 0xd0, 0x18, 0x04,
+  0x4f, 0x01, 0x10, 0xeb, 0xe0, 0x21, 0x1c, 0xf3, 0xff, 0x15, 0xe9, 0xef,
+  0xe8, 0x14, 0xdb, 0xea, 0xeb, 0xfe, 0x1f, 0x0f, 0xd9, 0x3d, 0xef, 0xf9,
+  0x25, 0x05, 0x15, 0xd0, 0xe4, 0x32, 0xff, 0x19, 0xcf, 0xf1, 0xca, 0x0a,
+  0xf6, 0xf1, 0xed, 0xf0, 0x1a, 0x17, 0xec, 0xef, 0x1f, 0x20, 0xd3, 0x07,
+  0xc0, 0x36, 0xb2, 0x1c, 0x0f, 0xf9, 0x18, 0xe7, 0xf5, 0xf4, 0xbc, 0xd8,
+  0x18, 0x0f, 0x03, 0xf2, 0x10, 0xf2, 0xfe, 0x0d, 0x09, 0xfd, 0x2c, 0x34,
+  0xea, 0x3f, 0xfe, 0xfd, 0xf1, 0xd9, 0xf1, 0xed, 0x0b, 0x35, 0xcd, 0xf3,
+  0xc4, 0x42, 0xf7, 0x0d, 0xf0, 0x1c, 0x22, 0xef, 0x33, 0xc2, 0x7f, 0x31,
+  0x38, 0xed, 0xf8, 0x07, 0xfc, 0xef, 0x2c, 0xf0, 0x09, 0xb5, 0xe1, 0xeb,
+  0xe2, 0x25, 0xd7, 0xfc, 0xf5, 0x33, 0xe2, 0x26, 0x3f, 0x06, 0xd7, 0xc0,
+  0x12, 0xf6, 0x11, 0x37, 0x08, 0xcd, 0x0e, 0xf5, 0xce, 0xfb, 0xfb, 0x00,
+  0xe5, 0xeb, 0x20, 0x00, 0xf4, 0xf5, 0xf3, 0x19, 0x1e, 0xfa, 0x0d, 0x2d,
+  0x21, 0xed, 0x1c, 0x0f, 0xe4, 0x0a, 0xe2, 0x19, 0xe1, 0x03, 0xf6, 0xfc,
+  0x01, 0x0e, 0xd7, 0x22, 0x15, 0xd2, 0xab, 0xfa, 0x06, 0xe6, 0x32, 0xda,
+  0x34, 0xcb, 0xef, 0xbe, 0x23, 0x0e, 0xd2, 0xe8, 0x2e, 0x08, 0xe5, 0xfc,
+  0x24, 0x05, 0x11, 0x1a, 0x30, 0xfb, 0x22, 0x2b, 0x15, 0xc1, 0x0d, 0x12,
+  0x28, 0xe0, 0xea, 0xf6, 0x22, 0x12, 0x12, 0xe0, 0xce, 0x19, 0xf3, 0xc7,
+  0x25, 0x04, 0xf3, 0xea, 0xd1, 0xda, 0x05, 0x01, 0x27, 0x58, 0xe3, 0x17,
+  0xf0, 0xda, 0xd5, 0xf6, 0x1d, 0x13, 0xcd, 0x1c, 0xe2, 0x22, 0xe8, 0xe9,
+  0x14, 0xf6, 0xfe, 0x1d, 0x01, 0x21, 0xf2, 0x07, 0x25, 0x27, 0xde, 0x44,
+  0xc9, 0xf5, 0xe9, 0xc2, 0xf4, 0xe9, 0xeb, 0xdd, 0x31, 0xf7, 0xfa, 0x20,
+  0x25, 0xeb, 0xf8, 0xfd, 0xb1, 0x05, 0x15, 0xdf, 0x05, 0x06, 0x0d, 0x22,
+  0xd2, 0x14, 0xef, 0xca, 0x03, 0xe0, 0xe2, 0x0d, 0xf9, 0xf5, 0xdb, 0xfc,
+  0x1a, 0x47, 0xdc, 0x10, 0xcf, 0xde, 0x1a, 0xf8, 0x27, 0xe3, 0x22, 0x00,
+  0xc2, 0x04, 0xf8, 0x0e, 0x01, 0xe1, 0xd0, 0x10, 0x07, 0xf5, 0xdb, 0xfc,
+  0x0f, 0x11, 0x33, 0xd2, 0xf8, 0x17, 0xd7, 0x41, 0xdc, 0x65, 0xf8, 0x0a,
+  0xdd, 0xe4, 0x1a, 0x43, 0x09, 0x36, 0xe6, 0xe7, 0xbb, 0xea, 0x15, 0x1b,
+  0x15, 0xcc, 0x01, 0xd7, 0xf4, 0x40, 0xec, 0xed, 0x0b, 0xde, 0xe5, 0xdb,
+  0xd5, 0xd1, 0xeb, 0x03, 0x37, 0xbd, 0x34, 0xde, 0x0f, 0xd5, 0x2d, 0xd9,
+  0x05, 0xee, 0xe5, 0x53, 0x39, 0x04, 0x53, 0x28, 0x0a, 0xc6, 0xc5, 0xed,
+  0x49, 0x04, 0xe7, 0xd3, 0x00, 0x15, 0x2f, 0xdf, 0x22, 0xff, 0x0d, 0x2c,
+  0x29, 0x22, 0xcf, 0xee, 0xc8, 0x24, 0x3b, 0x5e, 0x0e, 0x49, 0x2f, 0x3a,
+  0xe9, 0x17, 0xed, 0x44, 0x2f, 0xf6, 0xdb, 0x10, 0x01, 0x10, 0x14, 0x09,
+  0x1d, 0x0a, 0x4c, 0xdf, 0xd1, 0x08, 0xe4, 0x00, 0xb3, 0xb5, 0x30, 0x95,
+  0x2a, 0xde, 0x2e, 0x17, 0x2d, 0xee, 0x23, 0x06, 0x03, 0xf4, 0x1e, 0x04,
+  0xfe, 0xb7, 0xc6, 0xfb, 0x04, 0x14, 0x1d, 0xe6, 0x44, 0xfd, 0xe2, 0xf3,
+  0xf2, 0x1a, 0xcc, 0xea, 0x07, 0x3a, 0xf4, 0xbc, 0xf9, 0xf2, 0x45, 0xe9,
+  0x00, 0x58, 0x04, 0x06, 0xb1, 0xe5, 0x01, 0xf5, 0x05, 0xe8, 0xed, 0xad,
+  0x04, 0x34, 0xe7, 0x1e, 0xeb, 0x10, 0x6c, 0xfc, 0xeb, 0xeb, 0xc0, 0xef,
+  0x07, 0xe8, 0x3c, 0xad, 0x41, 0xe8, 0x23, 0x24, 0x03, 0xd9, 0x13, 0x43,
+  0xcd, 0xb6, 0x16, 0xde, 0x2d, 0xd0, 0xd3, 0xe4, 0xc6, 0x00, 0xed, 0x3b,
+  0xfc, 0xf3, 0x37, 0xd2, 0xfc, 0xb9, 0xd6, 0x2b, 0xfe, 0x7f, 0x10, 0xf2,
+  0xf5, 0xfc, 0x1c, 0x2e, 0x33, 0x06, 0x19, 0xef, 0xd3, 0xf6, 0x03, 0x15,
+  0xfd, 0xe9, 0xf1, 0x21, 0x0b, 0x05, 0xd7, 0xc3, 0xe9, 0xc8, 0xf9, 0xf3,
+  0xf1, 0xf4, 0x12, 0xf4, 0x32, 0xe6, 0xf8, 0x08, 0xfa, 0xef, 0x23, 0xe0,
+  0xcf, 0x04, 0xfb, 0xec, 0x2a, 0xeb, 0x28, 0xf3, 0x0d, 0x37, 0xfd, 0x00,
+  0x09, 0xb3, 0xf1, 0x13, 0x28, 0xb5, 0x47, 0xf0, 0x0c, 0xb6, 0x0c, 0x03,
+  0xf5, 0xde, 0xae, 0x31, 0x39, 0xed, 0x28, 0x01, 0xe1, 0xee, 0x27, 0x1c,
+  0xe9, 0xf0, 0xdc, 0xd7, 0xc0, 0xf6, 0x9a, 0x0a, 0xf3, 0x16, 0xcc, 0xbf,
+  0xf2, 0xeb, 0x48, 0xd6, 0xbf, 0xf3, 0xd3, 0xe8, 0x0d, 0x0d, 0x30, 0x1e,
+  0x6d, 0xdb, 0x21, 0x25, 0x00, 0xf0, 0x23, 0xad, 0xd1, 0x08, 0x3f, 0xde,
+  0x21, 0xdd, 0xfd, 0x03, 0x16, 0xff, 0xfb, 0xe8, 0x18, 0x06, 0x12, 0xf4,
+  0x38, 0xe4, 0x48, 0xd6, 0xf7, 0xfb, 0x9d, 0xf3, 0x1b, 0xe7, 0x18, 0xf7,
+  0x2f, 0xef, 0x0c, 0xd2, 0xd6, 0xf5, 0xdb, 0xdd, 0xdc, 0xfb, 0xf0, 0xb0,
+  0xe6, 0xff, 0xde, 0x0d, 0xfe, 0x22, 0x60, 0xd8, 0x0c, 0x0c, 0xe9, 0xf6,
+  0x14, 0x26, 0x1f, 0x2f, 0xd3, 0xd8, 0x41, 0x16, 0xeb, 0xfe, 0x23, 0xb8,
+  0x5e, 0xcf, 0xec, 0xda, 0x08, 0xdc, 0xf1, 0x07, 0xe5, 0xda, 0xf1, 0x09,
+  0xe4, 0x02, 0xe7, 0xd7, 0x00, 0xd0, 0xce, 0x35, 0xf9, 0x3a, 0x25, 0xda,
+  0xbe, 0x21, 0xf1, 0x0a, 0x08, 0x17, 0x02, 0x08, 0xf7, 0xd8, 0xf6, 0x16,
+  0xe5, 0xed, 0x3f, 0xd8, 0xc1, 0x30, 0xfc, 0xcd, 0xe4, 0xd3, 0xc9, 0x23,
+  0xe8, 0x28, 0x10, 0x2a, 0x0e, 0x31, 0x1f, 0xf7, 0xdc, 0xf6, 0xf5, 0xbd,
+  0xcb, 0x04, 0x0c, 0xf4, 0x59, 0xed, 0x34, 0xc9, 0x16, 0x1d, 0x2a, 0x11,
+  0x0b, 0xcd, 0xd5, 0x0f, 0x0b, 0xb8, 0xed, 0x2c, 0x19, 0xfa, 0x02, 0xf0,
+  0x1e, 0x16, 0xc2, 0xde, 0x13, 0x3b, 0x0e, 0x04, 0xf6, 0xc5, 0xe8, 0xfc,
+  0xe6, 0x1b, 0xd2, 0x1b, 0xce, 0x98, 0x49, 0x03, 0xe6, 0xbe, 0x1d, 0x18,
+  0xf7, 0x40, 0x9e, 0x3f, 0xd8, 0x30, 0xe1, 0x67, 0x12, 0xe5, 0x21, 0x56,
+  0x37, 0xcd, 0xd9, 0xfc, 0xf5, 0xea, 0xdf, 0xd8, 0x54, 0x1f, 0x1f, 0xc2,
+  0xf3, 0xfd, 0x20, 0x1d, 0xf4, 0xe9, 0x02, 0x0e, 0xdc, 0xf6, 0xfe, 0x16,
+  0x4a, 0xde, 0x2f, 0xf2, 0x01, 0xea, 0xc1, 0xe3, 0x1d, 0xf0, 0xf3, 0x1b,
+  0x1b, 0xd6, 0xe7, 0xde, 0x07, 0xf3, 0x00, 0x1f, 0xf5, 0xf1, 0x01, 0xa3,
+  0xe3, 0x13, 0x12, 0x22, 0xc2, 0x46, 0xd1, 0x02, 0x02, 0x31, 0xff, 0x10,
+  0xd2, 0x05, 0x3c, 0x20, 0x08, 0xe8, 0xd0, 0xe0, 0xd6, 0xcf, 0xf6, 0xf8,
+  0x39, 0x10, 0x09, 0x0b, 0x03, 0x39, 0x05, 0xfc, 0x02, 0x0f, 0xe4, 0xed,
+  0x36, 0x00, 0x44, 0xe6, 0x3d, 0xce, 0xc7, 0xe8, 0xe0, 0xff, 0xf1, 0x17,
+  0xd4, 0xd3, 0x04, 0xf2, 0xcf, 0x10, 0xde, 0xdd, 0x4f, 0xfe, 0xfb, 0xe4,
+  0x27, 0xed, 0x22, 0xf2, 0xd3, 0xe6, 0x09, 0x0c, 0x1a, 0xf8, 0x1b, 0x07,
+  0x0d, 0x40, 0x30, 0xd1, 0x44, 0xe5, 0x20, 0x3c, 0x3e, 0x16, 0xfa, 0x15,
+  0x1f, 0x14, 0xe7, 0x03, 0x21, 0xf9, 0x04, 0x07, 0x14, 0xff, 0x27, 0xf0,
+  0x08, 0x0c, 0xe7, 0xf1, 0x4e, 0x1e, 0x1d, 0xf7, 0x0c, 0xd0, 0xcd, 0xd3,
+  0xa4, 0x01, 0x3a, 0x20, 0xec, 0x1f, 0xfe, 0xcb, 0xdb, 0xf3, 0xe6, 0xca,
+  0x1c, 0xf4, 0x05, 0xd5, 0x48, 0xe8, 0x27, 0x09, 0x10, 0xfa, 0x2c, 0x1a,
+  0xff, 0xf2, 0x19, 0xf8, 0xfd, 0x51, 0xf4, 0xf9, 0x06, 0xc4, 0xe5, 0x2c,
+  0x0d, 0x1f, 0xc8, 0x05, 0xf0, 0x0e, 0xea, 0x16, 0xeb, 0x1e, 0xc9, 0x00,
+  0xf0, 0xf7, 0x10, 0xee, 0x02, 0x19, 0xb5, 0x09, 0x7f, 0x28, 0x01, 0xce,
+  0x1a, 0xcc, 0xc6, 0x05, 0xf7, 0x2b, 0xe6, 0xfb, 0xd4, 0x21, 0xca, 0xdb,
+  0xe8, 0xfb, 0xc4, 0x23, 0x2c, 0x09, 0xcc, 0xf7, 0xe4, 0x05, 0x0e, 0x14,
+  0xd4, 0xea, 0x23, 0x1a, 0x15, 0x10, 0x1b, 0xc8, 0xfb, 0x33, 0xfb, 0x19,
+  0xe5, 0xe8, 0xda, 0xed, 0xea, 0x18, 0xfc, 0x14, 0xe0, 0x21, 0x24, 0x27,
+  0xe3, 0x14, 0xd5, 0x15, 0x21, 0x1d, 0xde, 0xde, 0xd8, 0xe5, 0xee, 0x14,
+  0xfb, 0xea, 0x2c, 0x23, 0xfb, 0xf5, 0xe5, 0xf6, 0xee, 0xff, 0xd9, 0x2f,
+  0xfd, 0xd5, 0xd6, 0xec, 0xdd, 0xea, 0x16, 0xec, 0xc8, 0x1a, 0x39, 0xf2,
+  0x0b, 0xf3, 0x12, 0xe7, 0xdd, 0xe4, 0xfc, 0xed, 0x0a, 0xda, 0xe4, 0x16,
+  0x33, 0x09, 0x29, 0xd9, 0x21, 0xe7, 0xfb, 0x17, 0x2a, 0x0f, 0x09, 0x07,
+  0xcc, 0x0c, 0x0f, 0x17, 0xe4, 0xe0, 0xee, 0x0b, 0x3e, 0xf4, 0xd7, 0xed,
+  0xeb, 0xfd, 0xfc, 0x06, 0x1c, 0xdc, 0x2a, 0x27, 0x1a, 0xd0, 0xd3, 0xf8,
+  0xed, 0xfe, 0xfa, 0x1d, 0xe4, 0x0f, 0xe3, 0xce, 0xe3, 0xc6, 0x2a, 0xd8,
+  0xb2, 0xf9, 0x27, 0x17, 0x4a, 0xd2, 0x2b, 0x07, 0xee, 0x01, 0x12, 0xf4,
+  0xe9, 0xd9, 0x0c, 0x06, 0xf9, 0x18, 0xe1, 0xd2, 0xea, 0xeb, 0xf6, 0x11,
+  0x11, 0x1e, 0x07, 0x03, 0xdc, 0x0c, 0x0e, 0xf7, 0x0a, 0x19, 0xe8, 0x02,
+  0x1c, 0xf6, 0x05, 0x05, 0xf0, 0xee, 0xdb, 0x05, 0x39, 0x32, 0xf8, 0x02,
+  0xd8, 0xee, 0xd9, 0xd7, 0x14, 0x1b, 0xda, 0xe4, 0xc5, 0x2f, 0x0b, 0xd2,
+  0xea, 0x1e, 0x0a, 0x03, 0xc1, 0xfd, 0xd8, 0xfc, 0x00, 0x03, 0x28, 0x17,
+  0xdb, 0x18, 0xfd, 0x20, 0xf0, 0xdc, 0x03, 0xff, 0xfe, 0x25, 0x1b, 0x0f,
+  0xd3, 0x1f, 0x00, 0x1d, 0xf8, 0x23, 0x17, 0x17, 0xd6, 0xf7, 0x33, 0x2a,
+  0xf6, 0x07, 0xc9, 0xe8, 0x03, 0xf6, 0xfa, 0xca, 0xf7, 0xdf, 0xfc, 0x1b,
+  0xd6, 0xf8, 0x08, 0x1d, 0xb9, 0x3c, 0xe6, 0x24, 0x19, 0xfa, 0xd1, 0xf6,
+  0x1f, 0xcd, 0xcf, 0x14, 0xe2, 0x0d, 0x11, 0x1a, 0xde, 0x1b, 0x41, 0x31,
+  0xc2, 0x33, 0x03, 0xf2, 0xd5, 0xc2, 0x28, 0xbf, 0xc7, 0xdc, 0xdb, 0x0e,
+  0x3a, 0xfe, 0x51, 0xe8, 0xf5, 0x12, 0x2e, 0xf7, 0x10, 0x3c, 0x10, 0xf3,
+  0xc7, 0x23, 0xf8, 0xe8, 0xe8, 0xf7, 0xc4, 0xf5, 0x17, 0xf1, 0xf0, 0xe5,
+  0xd9, 0xff, 0xf0, 0x10, 0x1a, 0xf2, 0x05, 0x17, 0xb6, 0x04, 0x91, 0x1a,
+  0x05, 0x10, 0xdc, 0xf5, 0x0b, 0xd3, 0xe7, 0xfb, 0xf7, 0xef, 0xfe, 0x17,
+  0xe9, 0x16, 0x05, 0x3a, 0xd4, 0x20, 0x02, 0x0f, 0xd8, 0xd8, 0x19, 0xf0,
+  0xd2, 0x13, 0x2d, 0xf0, 0x20, 0x15, 0x35, 0x12, 0xcc, 0xdd, 0x35, 0x0d,
+  0xc4, 0x27, 0xff, 0xff, 0x1c, 0xe5, 0x00, 0xf7, 0x21, 0x31, 0xfe, 0xe6,
+  0xf1, 0xfd, 0xfe, 0x25, 0xd4, 0x14, 0xff, 0x33, 0x28, 0x0c, 0xd2, 0x03,
+  0xba, 0x02, 0xda, 0xe0, 0xf6, 0xfc, 0x17, 0x00, 0xeb, 0xfe, 0xfe, 0xe4,
+  0x07, 0xf9, 0xfd, 0xd9, 0xf2, 0x1e, 0xe9, 0x04, 0xc3, 0x0a, 0xf0, 0x39,
+  0x10, 0xdf, 0x0b, 0xfc, 0x37, 0xe0, 0x1c, 0x25, 0xfc, 0x14, 0x3e, 0x07,
+  0x27, 0xf4, 0x21, 0x0a, 0xe8, 0x17, 0x0a, 0xfa, 0xfb, 0x1d, 0xd2, 0x07,
+  0x0e, 0x25, 0x1c, 0x03, 0x12, 0x05, 0x1d, 0xfc, 0x18, 0x17, 0x18, 0xd3,
+  0x05, 0xf3, 0x7b, 0x06, 0x03, 0xf8, 0xda, 0xfa, 0x3e, 0x43, 0xd3, 0x41,
+  0xfb, 0x16, 0x02, 0x3f, 0x2a, 0x03, 0xef, 0x12, 0xfe, 0x25, 0xf9, 0x02,
+  0x08, 0xf9, 0xb9, 0x55, 0x08, 0x09, 0x16, 0x2f, 0x1c, 0x45, 0x0a, 0xeb,
+  0xfe, 0xfb, 0xb0, 0xde, 0x26, 0xf7, 0xd6, 0x11, 0x00, 0xdc, 0xe9, 0x30,
+  0xd5, 0x0c, 0x2a, 0x2a, 0xf1, 0xdf, 0xe6, 0x01, 0xd2, 0xf5, 0xd1, 0xee,
+  0x44, 0x14, 0xe2, 0x16, 0xe9, 0xee, 0x07, 0xf7, 0xeb, 0xdb, 0x27, 0xe8,
+  0x28, 0x19, 0xf8, 0x3d, 0xea, 0xf9, 0x16, 0x26, 0x0f, 0x08, 0xcc, 0xf3,
+  0x18, 0x0e, 0xbe, 0xf9, 0x48, 0xed, 0x08, 0x1e, 0xe8, 0xf2, 0xe5, 0xe8,
+  0xf8, 0x15, 0x19, 0x15, 0x22, 0x14, 0xbb, 0x07, 0x1c, 0x16, 0x1f, 0x1e,
+  0xf6, 0xdf, 0xca, 0x29, 0xe2, 0xf9, 0x63, 0x19, 0x27, 0xf3, 0xfc, 0xe1,
+  0xe6, 0x1d, 0x33, 0x10, 0x03, 0x1c, 0x17, 0x27, 0xf3, 0xd7, 0xeb, 0xee,
+  0x13, 0x12, 0xeb, 0xff, 0x5c, 0x07, 0xeb, 0x32, 0xd9, 0x23, 0x30, 0x45,
+  0x23, 0xf1, 0xfd, 0xf6, 0x2d, 0x42, 0x81, 0xc1, 0x47, 0x15, 0x16, 0x30,
+  0xf4, 0x23, 0xf8, 0xf3, 0xc0, 0x0b, 0x2a, 0x18, 0xfe, 0x0f, 0xdd, 0xe7,
+  0xf5, 0x22, 0xdc, 0xe1, 0x00, 0x13, 0xe3, 0x09, 0x02, 0xd3, 0x0b, 0x1a,
+  0xdb, 0x28, 0xf2, 0x1b, 0xe4, 0x1b, 0x36, 0xe9, 0x2f, 0xf6, 0xa2, 0xe0,
+  0x07, 0xe5, 0x1b, 0xe8, 0x5e, 0x2b, 0x01, 0x31, 0xab, 0x0b, 0x16, 0xfa,
+  0x11, 0xd4, 0xee, 0xbf, 0x34, 0x20, 0x3e, 0x18, 0x16, 0x17, 0x09, 0x26,
+  0x02, 0xee, 0xf9, 0x1a, 0x2d, 0xee, 0xfc, 0x27, 0x1e, 0xf1, 0xf2, 0xc5,
+  0x19, 0x31, 0x21, 0x16, 0xfe, 0xea, 0xf6, 0xf8, 0xeb, 0xd8, 0xc7, 0x3d,
+  0xc5, 0x05, 0xd4, 0x1e, 0xeb, 0x14, 0xf2, 0x17, 0xdb, 0xf5, 0x48, 0xef,
+  0x05, 0xd8, 0x9c, 0x0d, 0xdb, 0xf8, 0xd1, 0x09, 0x12, 0x29, 0x48, 0xe6,
+  0xdc, 0xf6, 0x29, 0x0b, 0x1e, 0x33, 0x4d, 0xe5, 0x10, 0x0d, 0x00, 0xd7,
+  0xc8, 0x1e, 0xf7, 0xf7, 0x28, 0xda, 0x2f, 0xd9, 0x43, 0xf7, 0xf7, 0x0c,
+  0xe8, 0xf6, 0xf0, 0x15, 0x0b, 0xec, 0xdf, 0x29, 0x01, 0xd8, 0x29, 0xe1,
+  0xfb, 0xfd, 0xa3, 0x17, 0xa6, 0x33, 0x18, 0xf4, 0xe2, 0x08, 0xe6, 0x04,
+  0xe7, 0xfb, 0x4f, 0x01, 0x1a, 0x0a, 0xdc, 0x02, 0x0f, 0xc0, 0xcc, 0xfb,
+  0x44, 0x43, 0xe9, 0xf7, 0x04, 0xf2, 0xde, 0xa2, 0xd6, 0x54, 0x51, 0x21,
+  0x2d, 0xd5, 0x29, 0xf2, 0xf3, 0x1c, 0xec, 0x0b, 0x43, 0xe0, 0xee, 0x0b,
+  0x38, 0x02, 0xf3, 0x07, 0xbb, 0x01, 0xeb, 0x61, 0x18, 0x05, 0xd7, 0x13,
+  0xe3, 0xdd, 0xe4, 0xf5, 0x13, 0xf9, 0xce, 0xee, 0xf8, 0xf6, 0x42, 0xf5,
+  0xcf, 0xda, 0xc2, 0xc8, 0xc8, 0x0f, 0x33, 0xec, 0xf3, 0x12, 0xfe, 0x2d,
+  0x08, 0xd0, 0xe3, 0xc9, 0x20, 0x15, 0xe6, 0xdb, 0xdd, 0x1d, 0xc5, 0xd8,
+  0x02, 0x14, 0x35, 0x0d, 0xdb, 0x05, 0xd9, 0xf5, 0x3c, 0xed, 0xe6, 0xef,
+  0xf3, 0x01, 0xe0, 0xf4, 0x2d, 0x29, 0x0a, 0x01, 0xf7, 0xd2, 0xfe, 0xc7,
+  0x2e, 0x22, 0x2a, 0xbb, 0x14, 0xec, 0xf8, 0xea, 0xdf, 0x57, 0xdf, 0x36,
+  0xea, 0xda, 0xc4, 0xeb, 0xde, 0x09, 0xbb, 0xec, 0xf7, 0x1b, 0x59, 0x1e,
+  0xd0, 0xcc, 0xe0, 0x1c, 0xe4, 0xe8, 0x9c, 0x01, 0x3b, 0x25, 0x10, 0xed,
+  0xf1, 0x29, 0xc1, 0xfb, 0x1a, 0x16, 0x38, 0x04, 0xe8, 0x06, 0xe5, 0xfe,
+  0xe5, 0x1a, 0xf4, 0xed, 0xc4, 0xd9, 0xe1, 0x09, 0x19, 0xe9, 0xe6, 0xfa,
+  0xec, 0xcf, 0xbf, 0x07, 0xee, 0x03, 0x3a, 0xaa, 0x1b, 0xf0, 0x13, 0xfd,
+  0x14, 0x5b, 0xf4, 0x3a, 0xe5, 0x23, 0xe6, 0xf7, 0xe3, 0xf9, 0xe0, 0x14,
+  0x03, 0xdf, 0x1d, 0x4f, 0xce, 0xf5, 0x9b, 0xff, 0xf9, 0x0c, 0xc4, 0x00,
+  0x0d, 0x03, 0x32, 0xed, 0xf1, 0x3c, 0xca, 0xd0, 0xf7, 0x0d, 0x18, 0x3a,
+  0x0b, 0xfe, 0x25, 0x09, 0xcd, 0xea, 0xf9, 0xec, 0xf9, 0x01, 0xee, 0x0b,
+  0xcf, 0x06, 0x21, 0xed, 0xa0, 0xfe, 0xe8, 0x29, 0x21, 0xe4, 0xe8, 0xd2,
+  0x0b, 0xc4, 0xf8, 0xda, 0x17, 0x41, 0xf1, 0x22, 0x0a, 0x55, 0x16, 0xf9,
+  0xd5, 0xd1, 0x1f, 0x22, 0xf7, 0x57, 0xc2, 0x30, 0x48, 0xf6, 0xd8, 0xe5,
+  0x1b, 0xf9, 0x07, 0xe8, 0x14, 0xe9, 0xf6, 0xe6, 0xe2, 0x22, 0x00, 0x0b,
+  0xf4, 0xd2, 0xf2, 0x11, 0x04, 0x0d, 0x1f, 0x21, 0x04, 0x1a, 0x01, 0xf4,
+  0x06, 0xef, 0xea, 0xf0, 0x01, 0x0f, 0xd9, 0xc5, 0x17, 0xf0, 0x01, 0xd6,
+  0x2d, 0x3d, 0x37, 0xe7, 0x0e, 0xf7, 0x0f, 0xf9, 0xf1, 0x26, 0x0e, 0x08,
+  0xf2, 0xff, 0x17, 0xfc, 0xf3, 0xb2, 0x45, 0x13, 0xfd, 0x4c, 0xe8, 0x15,
+  0xfc, 0xee, 0xc5, 0xb0, 0x7f, 0xc8, 0xdb, 0xf6, 0x34, 0xb3, 0xed, 0x01,
+  0xb5, 0x1e, 0x0a, 0x47, 0xdc, 0xdd, 0xec, 0xd2, 0xfc, 0xe8, 0x04, 0xff,
+  0x69, 0x1c, 0xe5, 0xf6, 0xf5, 0xf5, 0x26, 0xdc, 0xdf, 0x27, 0xe6, 0xc3,
+  0xfe, 0xd2, 0xd8, 0xae, 0x38, 0x32, 0x10, 0x00, 0x14, 0x2b, 0xcc, 0xf2,
+  0x37, 0x2f, 0x1f, 0x11, 0xcb, 0xf1, 0x33, 0x35, 0xc7, 0xc0, 0x04, 0x10,
+  0x14, 0x20, 0x09, 0x27, 0x1c, 0xdb, 0x0b, 0xf0, 0x36, 0xf8, 0xf9, 0xf4,
+  0x1b, 0xe6, 0xce, 0xea, 0xd3, 0x53, 0x1f, 0xd9, 0xda, 0x2d, 0x07, 0xf4,
+  0xe7, 0xf9, 0x1c, 0xd8, 0x21, 0x21, 0x29, 0x4e, 0xd7, 0x21, 0xda, 0xe7,
+  0xe0, 0x14, 0xe8, 0xea, 0xf6, 0x16, 0x20, 0xaa, 0x47, 0x19, 0x28, 0xf7,
+  0xfc, 0x20, 0x29, 0xb5, 0x1f, 0x0a, 0x0a, 0x0d, 0x15, 0x0c, 0x2c, 0x0d,
+  0xfa, 0xc2, 0xf2, 0xe6, 0xda, 0x32, 0xcf, 0x1e, 0xd9, 0xfa, 0xd0, 0x11,
+  0x20, 0xf9, 0x14, 0x01, 0xdf, 0xc0, 0xd5, 0x25, 0xf7, 0xe4, 0xe0, 0x19,
+  0x2e, 0xff, 0x07, 0x16, 0x28, 0xdb, 0x10, 0x1a, 0x12, 0x05, 0xbd, 0xd6,
+  0x09, 0xe6, 0xfd, 0xde, 0xcc, 0xef, 0xd3, 0xda, 0x31, 0x06, 0x2a, 0x03,
+  0x09, 0x1b, 0x35, 0x02, 0x00, 0x05, 0x05, 0xdc, 0x05, 0x23, 0x13, 0x31,
+  0xfd, 0xdd, 0xd9, 0xee, 0x0c, 0xcf, 0x0c, 0x16, 0x13, 0xfe, 0xe8, 0x13,
+  0xdf, 0xf7, 0xd5, 0xa8, 0x56, 0xf3, 0xbd, 0x08, 0xce, 0xbb, 0xcb, 0xc6,
+  0xca, 0xce, 0x08, 0xff, 0x29, 0x0d, 0x15, 0x0d, 0x3d, 0xfb, 0x0e, 0xb9,
+  0xef, 0x00, 0x24, 0x05, 0x39, 0xd0, 0x3b, 0xff, 0xfd, 0x0c, 0x54, 0xa3,
+  0x57, 0xc4, 0xdd, 0x0f, 0x04, 0x37, 0xdb, 0x03, 0xf1, 0xcb, 0xe2, 0xf8,
+  0x20, 0x30, 0x04, 0x1b, 0xb9, 0xe4, 0xbd, 0xea, 0xec, 0xb9, 0x06, 0x00,
+  0x18, 0xec, 0xee, 0x02, 0xff, 0x12, 0xe3, 0x11, 0x50, 0xf7, 0xd8, 0xeb,
+  0xd0, 0xd9, 0xdd, 0xe0, 0x17, 0x17, 0x20, 0xe2, 0x0b, 0xf8, 0xed, 0xcb,
+  0x2e, 0xd9, 0x09, 0xfc, 0xfd, 0xdc, 0x37, 0x2e, 0x0e, 0xeb, 0x10, 0x0d,
+  0xcd, 0x0c, 0xe4, 0x07, 0x15, 0x14, 0x19, 0x06, 0xfc, 0xfd, 0x31, 0xff,
+  0xf6, 0x1b, 0x3c, 0x2c, 0xf3, 0xdf, 0x35, 0x01, 0xf8, 0xe0, 0xe8, 0xe4,
+  0x00, 0xbb, 0xfc, 0xc3, 0x4b, 0xfd, 0xf5, 0x0d, 0xe4, 0xfe, 0x98, 0x42,
+  0x15, 0xf2, 0x19, 0xc4, 0xde, 0x0b, 0x0f, 0xee, 0x18, 0xd5, 0xfe, 0x38,
+  0x37, 0xfe, 0xed, 0x22, 0x14, 0xd9, 0xff, 0x00, 0xb0, 0x1b, 0x61, 0x0a,
+  0x0f, 0xd4, 0xda, 0x1b, 0xd2, 0x08, 0xf8, 0xd3, 0xf7, 0x22, 0x24, 0xf3,
+  0xeb, 0xd0, 0xf3, 0x1c, 0xf3, 0x0d, 0xdd, 0xfb, 0x06, 0xf5, 0xea, 0xd3,
+  0x13, 0x35, 0xdf, 0xfe, 0xed, 0xa9, 0x1c, 0xeb, 0x19, 0xe6, 0xf3, 0x16,
+  0x04, 0xf6, 0xd6, 0x2d, 0x09, 0x16, 0x08, 0x01, 0xf3, 0x21, 0xe1, 0xe4,
+  0xef, 0xdd, 0x02, 0xff, 0x24, 0xf9, 0xe8, 0x28, 0xfc, 0xd0, 0xf8, 0xe0,
+  0xcb, 0xfb, 0x2f, 0x39, 0xd6, 0xce, 0xcc, 0x00, 0x0d, 0x34, 0xfb, 0xe6,
+  0xff, 0x0f, 0xf0, 0xee, 0xda, 0x0e, 0xe8, 0x26, 0xc3, 0xd3, 0x09, 0x38,
+  0x2f, 0x0d, 0x06, 0xc7, 0xa7, 0x3c, 0xc2, 0xe0, 0xea, 0xda, 0x00, 0x02,
+  0x47, 0x19, 0x0c, 0xea, 0xe8, 0x18, 0xd0, 0x20, 0x1b, 0xf2, 0x0c, 0xde,
+  0x12, 0x1e, 0xf7, 0xf3, 0x19, 0x03, 0x1a, 0x2b, 0x12, 0x17, 0xea, 0x04,
+  0xf5, 0xd4, 0xe8, 0xd0, 0xb4, 0x11, 0xf5, 0x30, 0x16, 0xf6, 0x2a, 0x32,
+  0xde, 0x1a, 0x18, 0x08, 0x46, 0x43, 0x10, 0xfe, 0xb6, 0xf5, 0x0c, 0x22,
+  0xed, 0xfc, 0xf5, 0x2b, 0xff, 0xea, 0xf8, 0xf5, 0x0d, 0x1c, 0x06, 0xdb,
+  0xe2, 0x1f, 0xe1, 0x0c, 0xd8, 0xf5, 0x55, 0xde, 0xe4, 0x35, 0xc5, 0x10,
+  0xda, 0xe2, 0xf1, 0x39, 0x03, 0xe5, 0x1f, 0x48, 0xee, 0x1b, 0x3e, 0xb4,
+  0xd9, 0xea, 0x26, 0xe8, 0x16, 0xbd, 0x01, 0xa2, 0xd2, 0xe4, 0x2b, 0xb7,
+  0x1e, 0xdd, 0xf9, 0xf4, 0x07, 0xec, 0x2a, 0xd3, 0xe7, 0xbb, 0xf4, 0xee,
+  0x2b, 0x31, 0x44, 0xee, 0xe5, 0xd8, 0xdb, 0xdf, 0x17, 0x20, 0xe1, 0x2a,
+  0x0f, 0xdc, 0xf6, 0x15, 0x00, 0xfc, 0x00, 0xfe, 0xd4, 0xc6, 0x15, 0xf6,
+  0xe6, 0x2f, 0xc0, 0xd9, 0x44, 0xdc, 0xbb, 0xeb, 0x22, 0xff, 0x08, 0xb3,
+  0xb5, 0xfc, 0x40, 0xdd, 0xac, 0xfc, 0x12, 0xe3, 0x01, 0xe2, 0x00, 0xe8,
+  0x30, 0x22, 0x13, 0x9e, 0x36, 0x02, 0x04, 0xe2, 0xda, 0xe4, 0x39, 0xd2,
+  0xe8, 0xdc, 0xc6, 0xd5, 0x1f, 0x57, 0x2e, 0x06, 0x13, 0xd9, 0xcf, 0xd6,
+  0x0f, 0x31, 0xef, 0x13, 0x03, 0x07, 0x28, 0x2a, 0x49, 0x30, 0x10, 0xf3,
+  0x19, 0xf0, 0x54, 0xce, 0xde, 0x24, 0xd2, 0xfb, 0xec, 0xdf, 0x00, 0x21,
+  0x1e, 0x1f, 0xe1, 0xb1, 0xcd, 0x61, 0x26, 0xd8, 0xe9, 0xe6, 0x11, 0x0c,
+  0x07, 0xca, 0xda, 0xe6, 0xbc, 0x20, 0x18, 0xa2, 0x0a, 0xec, 0x06, 0x31,
+  0xff, 0xe2, 0x31, 0xe6, 0xff, 0x1b, 0xfb, 0x0b, 0xd6, 0x25, 0x08, 0xe1,
+  0x23, 0x03, 0xfd, 0x04, 0xe8, 0x5b, 0xba, 0x00, 0xc1, 0xf2, 0x31, 0x11,
+  0xed, 0x15, 0xef, 0x03, 0x39, 0xdb, 0x3b, 0xe7, 0xf0, 0xac, 0x99, 0x42,
+  0xe4, 0xfc, 0xf0, 0xe3, 0xde, 0x2d, 0x1a, 0x16, 0x0b, 0x0b, 0x02, 0x25,
+  0xbf, 0xff, 0xd8, 0xb7, 0x09, 0xc5, 0x13, 0x0e, 0xec, 0x1e, 0x16, 0x0a,
+  0xf9, 0x00, 0xf2, 0xd5, 0xff, 0xe6, 0x3b, 0xbf, 0xdf, 0x07, 0xee, 0xf2,
+  0x3b, 0xfc, 0x2c, 0xcf, 0x3a, 0x0d, 0x19, 0xc7, 0xf8, 0xef, 0xca, 0x4c,
+  0x1f, 0xd9, 0xf8, 0x01, 0xbb, 0xfa, 0xb2, 0xd9, 0xec, 0xcf, 0x03, 0xef,
+  0xdb, 0xe6, 0xb6, 0x1a, 0x1b, 0xd7, 0xeb, 0xdf, 0xa9, 0x00, 0x08, 0xb6,
+  0xbe, 0x02, 0xd9, 0xf3, 0xa2, 0x07, 0xfe, 0xe4, 0xd9, 0xc7, 0x05, 0xf0,
+  0x19, 0xf2, 0xe7, 0x1c, 0xf9, 0xfd, 0xea, 0xa3, 0xe9, 0xd7, 0x68, 0xf6,
+  0xdf, 0x0d, 0xc3, 0x01, 0x09, 0x10, 0xfb, 0xf8, 0x31, 0x18, 0x22, 0x08,
+  0x02, 0x10, 0xeb, 0x43, 0xfe, 0xde, 0x33, 0x13, 0x0a, 0x34, 0x03, 0x19,
+  0x2e, 0xe1, 0x4d, 0xf5, 0xa0, 0x09, 0xe1, 0x10, 0xd0, 0x04, 0x2c, 0x20,
+  0x12, 0x3f, 0xc5, 0x98, 0xdd, 0x35, 0x00, 0xf3, 0xba, 0xe4, 0x03, 0x19,
+  0x0b, 0xa9, 0x08, 0xb9, 0x03, 0xe9, 0x05, 0xf7, 0xe5, 0xef, 0xf8, 0x13,
+  0x0a, 0xde, 0x07, 0xf3, 0xcf, 0x34, 0xde, 0x1b, 0x18, 0x0d, 0xeb, 0xc4,
+  0x33, 0x23, 0x11, 0x21, 0x09, 0xd2, 0xcb, 0xf7, 0xf1, 0xd5, 0x57, 0x11,
+  0x17, 0x24, 0xf7, 0xc7, 0x31, 0x04, 0x53, 0xaf, 0x20, 0x14, 0xc2, 0x3b,
+  0x12, 0x27, 0xe1, 0xe2, 0xb1, 0x0f, 0xfa, 0xfb, 0x16, 0x36, 0x2d, 0x49,
+  0xef, 0x00, 0xd7, 0xf9, 0xe5, 0xe3, 0x2c, 0x0c, 0xef, 0xc0, 0x28, 0xf6,
+  0x50, 0xa6, 0x0a, 0x1c, 0xc5, 0xdc, 0x0a, 0xf2, 0x05, 0x4b, 0x1c, 0x11,
+  0x12, 0xd5, 0x28, 0xd0, 0x01, 0xff, 0x14, 0x12, 0x09, 0xa8, 0xdc, 0xf9,
+  0x13, 0x14, 0xd3, 0x0b, 0xd7, 0xf8, 0xcc, 0xe4, 0xd9, 0xfc, 0x67, 0x0c,
+  0x14, 0xfa, 0xc5, 0x12, 0xf0, 0xf7, 0xea, 0x2c, 0xa7, 0xbc, 0xe8, 0xf3,
+  0xe0, 0x42, 0x03, 0x51, 0xd2, 0xdf, 0xf7, 0xf5, 0x1b, 0xf3, 0x55, 0xfa,
+  0xe3, 0xea, 0x17, 0x0b, 0x0e, 0x01, 0xf3, 0xfd, 0xc1, 0xd8, 0xfd, 0x2a,
+  0xfc, 0xdf, 0x13, 0xf1, 0xed, 0xf4, 0x09, 0xd5, 0xe2, 0xf3, 0x0b, 0x62,
+  0xbb, 0xd5, 0xf7, 0xeb, 0x27, 0xda, 0xeb, 0xff, 0xe6, 0xea, 0x16, 0xc8,
+  0x34, 0x1a, 0x4f, 0x05, 0xe3, 0x15, 0xcc, 0x1d, 0x37, 0x0c, 0xf0, 0x19,
+  0xf0, 0xf9, 0xfa, 0xe1, 0x0e, 0x10, 0xec, 0x29, 0x19, 0xd5, 0xe3, 0x49,
+  0xfd, 0xe5, 0x1b, 0xe9, 0x0c, 0xa4, 0xe6, 0x36, 0x32, 0xfa, 0x0e, 0xe9,
+  0xc2, 0xef, 0xe8, 0x1e, 0xc4, 0x26, 0x26, 0xe3, 0x29, 0x22, 0xff, 0xc7,
+  0x28, 0xc9, 0xfb, 0x7f, 0x0e, 0xb8, 0x47, 0xef, 0x3b, 0xd3, 0x01, 0xda,
+  0x06, 0x09, 0x2f, 0xfe, 0xfc, 0x02, 0x10, 0xd2, 0xe6, 0xc4, 0xd3, 0xe7,
+  0xf7, 0xc8, 0x21, 0x21, 0xfd, 0x0a, 0x17, 0xe8, 0x15, 0xbf, 0x0e, 0x0a,
+  0xfa, 0xdf, 0xd8, 0x43, 0x0a, 0xc9, 0xed, 0xfb, 0xe5, 0xf5, 0x0b, 0x21,
+  0xed, 0xe9, 0xd9, 0x08, 0x25, 0xfe, 0x0d, 0xac, 0x0f, 0xac, 0x40, 0xcf,
+  0xf7, 0x31, 0xf1, 0x2b, 0x1c, 0xf3, 0x46, 0xed, 0x1d, 0x10, 0xee, 0x26,
+  0x07, 0xdf, 0xde, 0xec, 0x0e, 0x40, 0x01, 0xf2, 0x12, 0xc5, 0x20, 0xcb,
+  0xf3, 0xd6, 0xbc, 0xdb, 0x11, 0xbf, 0xe5, 0x0a, 0x2e, 0xfa, 0x2d, 0x9c,
+  0x1c, 0x03, 0x49, 0x19, 0xc1, 0x26, 0xff, 0xc3, 0x16, 0xcb, 0xe5, 0x1d,
+  0x02, 0xf0, 0xef, 0xeb, 0x0b, 0xdc, 0xd5, 0xf2, 0xfe, 0x08, 0xd6, 0xe0,
+  0xec, 0x02, 0x2a, 0xdc, 0xe8, 0xf4, 0x1a, 0x04, 0xf6, 0xe6, 0x24, 0xe1,
+  0x12, 0x3f, 0xf4, 0x04, 0x04, 0xc7, 0x03, 0x35, 0xfa, 0x2d, 0xdb, 0xe9,
+  0x00, 0x29, 0x0c, 0xc2, 0x13, 0xde, 0xe1, 0xd6, 0xfe, 0x0b, 0xe6, 0xf9,
+  0xcf, 0xf4, 0x32, 0xd0, 0x1d, 0xfa, 0x52, 0x0e, 0x09, 0x27, 0x25, 0xcc,
+  0x37, 0xe8, 0x10, 0x03, 0xe3, 0xa2, 0xfc, 0x30, 0x32, 0xf5, 0x15, 0xfe,
+  0xde, 0xff, 0xf2, 0xb7, 0xe1, 0x1c, 0x20, 0xfd, 0xdd, 0x14, 0xe6, 0xe9,
+  0xd6, 0xcd, 0x2b, 0xec, 0x25, 0xe9, 0xe5, 0xd7, 0xb8, 0xc6, 0xe4, 0x24,
+  0xef, 0xfa, 0x1b, 0xff, 0xf1, 0xdf, 0xe0, 0x01, 0xd6, 0x34, 0xd9, 0xdd,
+  0xd5, 0xfa, 0x25, 0xf9, 0x21, 0x2a, 0xcd, 0x03, 0x1c, 0xd9, 0x11, 0xf4,
+  0x18, 0xf7, 0x05, 0x45, 0xed, 0x11, 0x06, 0xe2, 0xfb, 0xfe, 0x02, 0xe5,
+  0xdc, 0xc4, 0xe9, 0x16, 0x1d, 0xf7, 0x15, 0xe1, 0x06, 0x0a, 0x52, 0x00,
+  0xf9, 0x10, 0xf1, 0xd3, 0xd0, 0xce, 0x24, 0xfe, 0x1b, 0x07, 0x26, 0x08,
+  0xd4, 0x26, 0xb5, 0xea, 0xe8, 0xff, 0x0a, 0xff, 0x11, 0xe1, 0xf8, 0x22,
+  0xf4, 0x14, 0xdc, 0x16, 0xea, 0xbd, 0x15, 0x18, 0x18, 0xfe, 0xea, 0xdd,
+  0x22, 0x24, 0x1d, 0x20, 0xe5, 0x16, 0xf1, 0xc6, 0xf2, 0x01, 0x20, 0xc3,
+  0xea, 0x31, 0x0d, 0xc8, 0xe7, 0xe8, 0xe5, 0xf4, 0x0c, 0xf6, 0x04, 0x1c,
+  0x14, 0x03, 0x2c, 0xd5, 0x0f, 0x09, 0xe6, 0xc0, 0xf1, 0xf4, 0xec, 0xda,
+  0xd1, 0x28, 0x39, 0xd1, 0xb3, 0x0f, 0x14, 0xe7, 0x0c, 0x1b, 0xb3, 0xf4,
+  0xfc, 0xae, 0xe6, 0x0e, 0x37, 0x0d, 0xd1, 0x16, 0x05, 0xcd, 0xdf, 0xe4,
+  0xf5, 0x26, 0xe9, 0x17, 0xe0, 0x35, 0x25, 0x05, 0x01, 0x28, 0x26, 0xea,
+  0x19, 0xe7, 0xfb, 0x00, 0xf8, 0x2f, 0x23, 0xf8, 0xf0, 0xd7, 0x23, 0xd5,
+  0xcb, 0xf0, 0xe4, 0xf1, 0xfc, 0x0c, 0xea, 0x07, 0xf3, 0x15, 0xf7, 0xe2,
+  0xf6, 0xdd, 0xe1, 0xf2, 0xf0, 0x0d, 0xfa, 0xd7, 0xce, 0xe7, 0x60, 0x01,
+  0x1a, 0x1d, 0x15, 0xc4, 0xd0, 0xf7, 0xf9, 0x15, 0x01, 0x23, 0xc0, 0xe8,
+  0x1c, 0xcc, 0x02, 0xde, 0x28, 0x24, 0xf2, 0xe8, 0xc0, 0xe8, 0xf4, 0xf2,
+  0x26, 0x28, 0xd7, 0xf9, 0xdb, 0xd8, 0xe5, 0xcf, 0xfa, 0xfe, 0xc8, 0xd1,
+  0xd1, 0xf9, 0xe5, 0x57, 0xff, 0x21, 0x10, 0x06, 0xf0, 0xf7, 0x37, 0x16,
+  0xf6, 0x26, 0x03, 0xd7, 0x0b, 0xfe, 0x11, 0x15, 0x27, 0xe8, 0x00, 0xee,
+  0x81, 0x2b, 0xfc, 0xf1, 0xe4, 0x3c, 0xf5, 0xdd, 0xe3, 0x07, 0x07, 0x3c,
+  0x05, 0x0c, 0xd5, 0xe3, 0x0b, 0xb4, 0xee, 0x1d, 0x17, 0x13, 0xd7, 0x0a,
+  0xdc, 0x15, 0xff, 0x18, 0xf7, 0xfa, 0xdd, 0xf3, 0xe9, 0xdb, 0x27, 0xd0,
+  0x1d, 0xea, 0x14, 0xf1, 0xdc, 0x1a, 0x02, 0x13, 0x09, 0x0c, 0x3d, 0x00,
+  0xc5, 0xdc, 0x1c, 0xf4, 0x08, 0x13, 0xe7, 0xd0, 0xef, 0x08, 0x04, 0x10,
+  0x10, 0xd8, 0x16, 0xd5, 0xa3, 0x01, 0xfc, 0xf6, 0xef, 0x24, 0xdb, 0xe8,
+  0xd0, 0xba, 0xd5, 0x1b, 0x0b, 0x21, 0xc7, 0x2f, 0x10, 0xf0, 0xc1, 0xca,
+  0x59, 0x02, 0xcd, 0x0b, 0xf5, 0x66, 0xd4, 0x1d, 0xd1, 0x01, 0xe1, 0x03,
+  0xea, 0x2f, 0xee, 0xf2, 0x1c, 0x0a, 0xff, 0xe7, 0xd4, 0xb4, 0xf2, 0xe9,
+  0xed, 0x1a, 0xed, 0xe6, 0xfe, 0xe5, 0xec, 0x02, 0x1b, 0x00, 0xf8, 0xe6,
+  0xea, 0x0a, 0x0e, 0x1e, 0xfd, 0xb3, 0xf5, 0xf8, 0x04, 0x0e, 0x26, 0x0c,
+  0x34, 0x14, 0x03, 0xd0, 0x17, 0x03, 0xec, 0xe9, 0xe4, 0x2a, 0x1c, 0x0a,
+  0x47, 0x13, 0xff, 0xe9, 0xec, 0xf6, 0x04, 0xef, 0x03, 0x10, 0x13, 0x04,
+  0x0a, 0xf4, 0xd9, 0x2a, 0x0b, 0x0a, 0xf2, 0xe7, 0x33, 0xde, 0xf2, 0x3c,
+  0xda, 0x00, 0xeb, 0xb6, 0xf9, 0xec, 0x24, 0x04, 0x0f, 0x1a, 0x07, 0xf2,
+  0xf7, 0xed, 0xb5, 0x30, 0x20, 0x30, 0xf8, 0x1e, 0xce, 0x1b, 0xf2, 0x28,
+  0x9f, 0xf6, 0xf2, 0xfa, 0x40, 0x1d, 0x10, 0xda, 0x06, 0xf3, 0xfc, 0xc5,
+  0xe7, 0x24, 0xfb, 0x0c, 0x06, 0xdb, 0x10, 0x01, 0xc0, 0x10, 0xf2, 0x32,
+  0x0c, 0x11, 0x0c, 0x44, 0x3e, 0x11, 0xf3, 0x48, 0xc1, 0xe0, 0xfd, 0x1b,
+  0x11, 0xf7, 0xee, 0x20, 0xd3, 0xee, 0xee, 0xe5, 0x0c, 0xe4, 0x1f, 0xf3,
+  0xfa, 0xf2, 0xf4, 0xd8, 0xb7, 0xf9, 0xdf, 0x0e, 0xde, 0x2c, 0x12, 0x18,
+  0xe5, 0x10, 0x01, 0x21, 0xe8, 0xec, 0xf2, 0x0f, 0x02, 0xf9, 0x20, 0x9f,
+  0xf4, 0x3d, 0xdd, 0xe3, 0xda, 0xdd, 0x0e, 0xf7, 0x03, 0xf6, 0xee, 0xcb,
+  0xe8, 0x02, 0x0d, 0x14, 0xdb, 0x10, 0x37, 0x1d, 0x0a, 0x0e, 0xea, 0xe1,
+  0xcd, 0x39, 0x25, 0xe9, 0x69, 0xdb, 0xf8, 0xc1, 0xf6, 0xf9, 0x08, 0x0c,
+  0x15, 0xc6, 0xe8, 0x34, 0x14, 0xee, 0xe2, 0xfa, 0xec, 0x00, 0x2d, 0x26,
+  0xfb, 0x35, 0x15, 0xfd, 0x1c, 0x20, 0xe8, 0xe2, 0x04, 0x0f, 0x0e, 0x18,
+  0xfd, 0x35, 0x17, 0xfc, 0xf5, 0x13, 0xf8, 0xc0, 0xd2, 0x04, 0x2c, 0x2b,
+  0xed, 0xff, 0x04, 0x1a, 0x03, 0xf3, 0xe5, 0x26, 0xf0, 0xe6, 0xdf, 0x0b,
+  0xe7, 0x05, 0xc4, 0xe4, 0xe4, 0x32, 0x12, 0xb2, 0xe3, 0xc7, 0x12, 0x14,
+  0xf9, 0x1a, 0x00, 0xf2, 0xd8, 0xfe, 0x0a, 0x16, 0x0d, 0x0e, 0xe5, 0x0e,
+  0xee, 0xf4, 0xa0, 0xe9, 0x04, 0xd9, 0x34, 0x19, 0xfb, 0x21, 0xe4, 0xf4,
+  0xfb, 0x22, 0x08, 0xf5, 0x27, 0x31, 0x08, 0x2d, 0xff, 0xe9, 0xf0, 0xf9,
+  0xd0, 0x1f, 0xfe, 0x1b, 0x09, 0xea, 0x07, 0x2e, 0xf4, 0x0c, 0xde, 0x38,
+  0xf6, 0x09, 0xdc, 0x03, 0xe9, 0x02, 0xce, 0x38, 0xc5, 0xfc, 0xe6, 0x00,
+  0xda, 0xca, 0x0d, 0xe1, 0xdf, 0xe0, 0x15, 0xef, 0x0d, 0xf7, 0x05, 0xe3,
+  0x01, 0x1d, 0xfc, 0x0b, 0xea, 0xff, 0xd6, 0x05, 0xf5, 0xf5, 0x34, 0x02,
+  0xd8, 0xfe, 0x08, 0x16, 0xe7, 0xff, 0x05, 0xe9, 0x22, 0x17, 0xf1, 0xe6,
+  0x16, 0x11, 0xdc, 0x09, 0xb3, 0x08, 0xfa, 0x4b, 0x24, 0x05, 0x57, 0x45,
+  0x04, 0xc2, 0x05, 0xdb, 0xda, 0x35, 0xc7, 0x09, 0xe9, 0xf7, 0xeb, 0x18,
+  0xe2, 0x01, 0xf9, 0xb6, 0x09, 0xd9, 0xf2, 0xe9, 0x01, 0x24, 0x01, 0xe8,
+  0x02, 0xe8, 0xff, 0xed, 0xf6, 0x1f, 0xf7, 0x20, 0xcd, 0x18, 0xf4, 0x0c,
+  0x18, 0xf2, 0x27, 0xfa, 0x0a, 0x37, 0x1b, 0xfc, 0x0b, 0x2c, 0xd9, 0xde,
+  0xf4, 0x19, 0xf1, 0x4b, 0x21, 0xf8, 0xdf, 0x00, 0x23, 0x18, 0x06, 0x0e,
+  0xdb, 0x39, 0xed, 0xf5, 0xf1, 0x01, 0x29, 0x34, 0xee, 0xf2, 0xd1, 0x0d,
+  0x2c, 0xe4, 0xf8, 0xc7, 0xc6, 0xe8, 0x2f, 0xb2, 0xef, 0xc0, 0xf4, 0xef,
+  0x74, 0xe7, 0xf9, 0x23, 0xe6, 0x01, 0x2c, 0xfd, 0xfd, 0x2d, 0xd6, 0xfa,
+  0xf0, 0x03, 0x81, 0xe3, 0xff, 0xf5, 0x38, 0x05, 0x10, 0x15, 0xfd, 0xff,
+  0x2a, 0xfa, 0xf3, 0x0a, 0x2b, 0xfb, 0xef, 0x62, 0x0c, 0xd8, 0xd8, 0xf1,
+  0x03, 0x12, 0xf5, 0xfc, 0xfb, 0x17, 0xf5, 0x05, 0xf2, 0xf6, 0xff, 0x15,
+  0xd7, 0x1f, 0xc7, 0x06, 0xeb, 0x0f, 0xdb, 0xec, 0xc4, 0x16, 0xd2, 0xd8,
+  0xcc, 0xcd, 0x2b, 0xd2, 0x45, 0xc5, 0xf2, 0xeb, 0x1c, 0x06, 0x23, 0xf3,
+  0x30, 0x03, 0xec, 0xe3, 0xfe, 0x0a, 0xd6, 0xff, 0xea, 0x07, 0x16, 0x15,
+  0xec, 0x25, 0x27, 0xd8, 0x1b, 0xd1, 0x05, 0x0c, 0xde, 0x1f, 0xc9, 0x49,
+  0xfa, 0xc9, 0xda, 0xf2, 0xff, 0x02, 0xf4, 0x07, 0xf9, 0x49, 0xf0, 0x39,
+  0x0e, 0xdd, 0x20, 0xf0, 0xc9, 0x1b, 0xe1, 0x2a, 0x29, 0x05, 0xe9, 0x21,
+  0x26, 0xe9, 0x04, 0xc0, 0xc9, 0xd6, 0xf6, 0x1e, 0x59, 0x1b, 0xf6, 0xd0,
+  0x01, 0xff, 0x18, 0xd8, 0xf7, 0xfb, 0xe4, 0x0f, 0xf0, 0x12, 0xd3, 0xeb,
+  0xdf, 0x11, 0x43, 0xed, 0x04, 0x0a, 0x38, 0xfb, 0xfa, 0x03, 0xfb, 0x29,
+  0xf3, 0x37, 0x2d, 0x17, 0x35, 0x38, 0x3e, 0xde, 0xd7, 0x1f, 0x13, 0xeb,
+  0x46, 0xe9, 0xeb, 0xfb, 0x12, 0x07, 0xeb, 0xfb, 0x04, 0xf4, 0xe0, 0x14,
+  0x41, 0x08, 0x01, 0x4f, 0xd5, 0xc2, 0x1e, 0x06, 0xcb, 0xc6, 0x30, 0xdb,
+  0xcf, 0xe6, 0x19, 0x3e, 0xe2, 0x07, 0xe8, 0xcf, 0xfa, 0xf3, 0xbf, 0x11,
+  0xf7, 0x50, 0xea, 0xea, 0x35, 0x03, 0xdd, 0x39, 0x25, 0x4f, 0x0b, 0xf5,
+  0x44, 0xc2, 0x7f, 0xf6, 0xae, 0x29, 0x17, 0xfa, 0x40, 0x4b, 0x60, 0xdc,
+  0xb0, 0x2a, 0xe5, 0x78, 0x2d, 0x4a, 0xd7, 0xfd, 0xb3, 0xdd, 0x06, 0x1d,
+  0x30, 0xd1, 0xd7, 0xe7, 0xcf, 0xe1, 0x76, 0x07, 0xe3, 0xd8, 0xe9, 0xd6,
+  0xe5, 0xe8, 0x46, 0x28, 0xe7, 0xe1, 0xe9, 0x2f, 0x13, 0xf0, 0x20, 0xed,
+  0x01, 0x45, 0xe0, 0x0b, 0x01, 0x32, 0x10, 0x0a, 0xd9, 0x5c, 0xd9, 0xc4,
+  0xe0, 0xdf, 0x43, 0x6b, 0x35, 0x2e, 0x08, 0xf5, 0xcd, 0x1f, 0x07, 0x00,
+  0x18, 0x65, 0x37, 0x1f, 0xec, 0x20, 0x0a, 0x1c, 0x1b, 0x09, 0x21, 0x24,
+  0x01, 0xe3, 0xd0, 0xe0, 0x3a, 0x38, 0xc1, 0x02, 0x2d, 0xee, 0x01, 0xb9,
+  0xfc, 0xef, 0x31, 0xf7, 0xe6, 0xe3, 0x35, 0x67, 0xf6, 0xda, 0xf2, 0x34,
+  0xe6, 0xb5, 0x26, 0x3b, 0xe3, 0x0e, 0xc8, 0xee, 0x10, 0x35, 0x15, 0xde,
+  0x14, 0x39, 0xe1, 0x2c, 0xd0, 0x09, 0x3b, 0xbb, 0x19, 0x16, 0xe2, 0xca,
+  0x4d, 0x23, 0x47, 0x1d, 0x28, 0xe4, 0xf4, 0x9e, 0xea, 0xef, 0x2b, 0xca,
+  0x40, 0xd6, 0x2b, 0x4e, 0x39, 0xb4, 0xd0, 0xc6, 0xe6, 0x5c, 0xd6, 0x0a,
+  0x16, 0x01, 0x38, 0x00, 0xde, 0xad, 0x42, 0x0d, 0x0d, 0xe3, 0x05, 0xb5,
+  0x32, 0x06, 0xd2, 0xf9, 0x34, 0x2e, 0xd7, 0xbc, 0x21, 0x18, 0xcc, 0xe0,
+  0x57, 0x4c, 0xf3, 0x10, 0xd0, 0xe8, 0xfa, 0xf3, 0xf6, 0x48, 0xfe, 0xe2,
+  0x13, 0xf5, 0x63, 0xfa, 0x12, 0xfe, 0x0b, 0xee, 0x3c, 0xe2, 0x0d, 0xf2,
+  0x0f, 0x1f, 0xf7, 0x0c, 0x14, 0x42, 0xe8, 0x47, 0xbd, 0xd8, 0xe6, 0xed,
+  0x1f, 0x0b, 0x2f, 0xd7, 0xea, 0x1f, 0x71, 0xef, 0xc7, 0xed, 0x4f, 0xac,
+  0x44, 0xe4, 0x3f, 0xdf, 0x04, 0x0a, 0xc7, 0xf4, 0xf9, 0x28, 0x21, 0xa9,
+  0x27, 0x2b, 0xd8, 0xf1, 0x36, 0x3a, 0xda, 0x0d, 0xc0, 0x2c, 0x09, 0xd4,
+  0xd3, 0xfb, 0xd5, 0xfd, 0x1d, 0x30, 0x53, 0x09, 0xfd, 0x11, 0xee, 0xdf,
+  0x63, 0xbe, 0x13, 0xfa, 0xd1, 0x10, 0x39, 0xde, 0xe2, 0x56, 0x05, 0x14,
+  0x1f, 0xbf, 0xa7, 0xf0, 0x0b, 0x3f, 0x14, 0xd5, 0x3c, 0x12, 0x2c, 0xbc,
+  0xd5, 0xb9, 0x21, 0x17, 0x1a, 0xec, 0x14, 0x17, 0x24, 0xf2, 0x1d, 0xda,
+  0x18, 0xbe, 0x26, 0x14, 0x35, 0xd7, 0xe8, 0xf3, 0x27, 0x38, 0xd4, 0xf8,
+  0xc0, 0x16, 0xff, 0xe0, 0xd3, 0x3d, 0x22, 0xe4, 0xea, 0xe5, 0xf6, 0xff,
+  0x08, 0x49, 0xef, 0x03, 0x10, 0xdd, 0xb0, 0xa5, 0x1e, 0xee, 0x16, 0xeb,
+  0x2d, 0xe3, 0xfe, 0xf2, 0x10, 0x12, 0x02, 0xd9, 0xf6, 0x35, 0xcb, 0xca,
+  0xa8, 0xe2, 0x22, 0x29, 0x38, 0x9b, 0xe3, 0xe3, 0x53, 0xbf, 0xee, 0xdc,
+  0xe5, 0x05, 0xda, 0xb1, 0x00, 0x04, 0xda, 0x95, 0x39, 0xe0, 0x18, 0xb1,
+  0x2a, 0xe5, 0x33, 0x19, 0xd7, 0x1c, 0xb9, 0xd4, 0xbf, 0xf3, 0x05, 0x2a,
+  0x2a, 0xb7, 0x10, 0x23, 0x01, 0x53, 0xe9, 0x09, 0xe9, 0xdd, 0xde, 0xe8,
+  0x41, 0xd6, 0xeb, 0xe6, 0x4c, 0x20, 0x2a, 0xfb, 0xa1, 0xf2, 0xf2, 0xde,
+  0x1a, 0x0b, 0xaf, 0xa8, 0x11, 0x0e, 0x27, 0x42, 0xc4, 0xf6, 0x13, 0xe8,
+  0xe5, 0xcc, 0x48, 0x38, 0xeb, 0xf2, 0xe1, 0xdd, 0x02, 0x19, 0xf1, 0xe9,
+  0x40, 0xfd, 0x33, 0x00, 0xce, 0x05, 0x4e, 0xe6, 0xfd, 0x34, 0xf5, 0xc3,
+  0xe6, 0xde, 0xf6, 0xe5, 0x1c, 0xee, 0x24, 0x54, 0x04, 0x25, 0xb3, 0x00,
+  0x20, 0xbc, 0xe0, 0xc0, 0x05, 0xb5, 0x30, 0xa1, 0xee, 0x1e, 0xf4, 0xf1,
+  0xfb, 0x12, 0x14, 0xc0, 0xf9, 0x47, 0x42, 0xe5, 0x06, 0x0b, 0xcc, 0x0e,
+  0x24, 0xca, 0xed, 0x13, 0x2b, 0xd9, 0x03, 0x32, 0xe3, 0xd4, 0x4e, 0xc5,
+  0x0e, 0xd7, 0xeb, 0x01, 0x40, 0xbb, 0x3a, 0x9c, 0xe0, 0x27, 0x50, 0xee,
+  0xf6, 0x28, 0xe3, 0xc7, 0xf2, 0x01, 0x1f, 0x0e, 0x00, 0xaa, 0x1d, 0xe4,
+  0xc2, 0x2c, 0xea, 0xea, 0x09, 0xea, 0xeb, 0xf6, 0x07, 0x24, 0xf0, 0xf1,
+  0x0f, 0x27, 0xd5, 0xf3, 0xd1, 0xf6, 0x05, 0x1b, 0xeb, 0xf9, 0x0e, 0x36,
+  0x00, 0xc1, 0x31, 0x00, 0x0d, 0x11, 0xe2, 0xcd, 0xfd, 0xfc, 0xe2, 0x16,
+  0x19, 0xf4, 0x03, 0xf7, 0x05, 0x19, 0x27, 0x29, 0x0d, 0xfa, 0xfe, 0xd8,
+  0x02, 0xfb, 0x02, 0x10, 0x0e, 0x3e, 0x1e, 0xed, 0xf6, 0xf1, 0xfb, 0x08,
+  0x23, 0xde, 0x13, 0x28, 0xc8, 0x19, 0xee, 0xf4, 0x00, 0xfd, 0x20, 0xe7,
+  0x0d, 0x12, 0x16, 0xe0, 0x33, 0x27, 0xd9, 0x16, 0x09, 0xf9, 0x05, 0x14,
+  0x02, 0x4c, 0x47, 0x19, 0xdb, 0xe6, 0x2e, 0xe3, 0x14, 0x1c, 0x02, 0x12,
+  0x13, 0x10, 0xdd, 0xee, 0xf9, 0x03, 0xff, 0xc2, 0x1e, 0x0e, 0x01, 0x10,
+  0xf8, 0x05, 0x07, 0xc9, 0x0a, 0x01, 0xdc, 0xfa, 0x11, 0x32, 0x0a, 0x46,
+  0x1e, 0x2c, 0x1a, 0x24, 0x30, 0x06, 0xe0, 0x02, 0xce, 0x21, 0x18, 0x09,
+  0x0d, 0xee, 0x1d, 0xeb, 0x05, 0xe6, 0xcb, 0xe2, 0x40, 0xf6, 0x09, 0x29,
+  0xee, 0x02, 0xeb, 0x0f, 0xfd, 0x12, 0xee, 0x0f, 0xd7, 0xee, 0x1a, 0xff,
+  0x09, 0xfd, 0xeb, 0x13, 0x07, 0x04, 0xda, 0x05, 0xff, 0xf8, 0xdb, 0xed,
+  0xe2, 0x0e, 0x17, 0xe3, 0xda, 0xf5, 0xf5, 0x04, 0x07, 0xfd, 0xda, 0xfd,
+  0xfc, 0x40, 0x2a, 0x27, 0xf7, 0x19, 0x03, 0xfd, 0x01, 0x04, 0xff, 0x12,
+  0xd9, 0x24, 0xfa, 0x2e, 0xfa, 0x07, 0x08, 0x05, 0xfe, 0x29, 0xee, 0x0b,
+  0x03, 0x05, 0xe5, 0xdc, 0xde, 0xfd, 0x08, 0x00, 0x0f, 0x1e, 0xcd, 0x20,
+  0x10, 0x0f, 0x07, 0xda, 0x01, 0xf9, 0xf7, 0xfe, 0x09, 0xdf, 0x15, 0xe7,
+  0x08, 0xf8, 0x07, 0xd2, 0xd3, 0x29, 0xf4, 0x2f, 0x63, 0x15, 0x23, 0x04,
+  0xf2, 0x0e, 0x34, 0xde, 0x22, 0x12, 0x04, 0xf9, 0x03, 0xd4, 0xfa, 0xf5,
+  0xd1, 0xdc, 0x11, 0x06, 0xbf, 0xf8, 0xfd, 0x1c, 0x05, 0x19, 0x1e, 0x03,
+  0x3d, 0x06, 0x0e, 0x2c, 0x32, 0x12, 0x06, 0x04, 0xf5, 0xf3, 0xd1, 0xf8,
+  0xfb, 0x23, 0xee, 0x1b, 0xdf, 0x03, 0x4a, 0xf1, 0x27, 0x0c, 0xf6, 0x38,
+  0x02, 0x09, 0x15, 0xd8, 0xcc, 0x08, 0xe4, 0xda, 0xeb, 0xe5, 0xf1, 0x63,
+  0x1d, 0x12, 0x09, 0x3e, 0x04, 0x08, 0x17, 0xdb, 0xfe, 0xf4, 0x0c, 0x02,
+  0x1d, 0xf5, 0x1f, 0xe0, 0xce, 0x13, 0x20, 0xfa, 0xfe, 0x1d, 0xfc, 0x14,
+  0x28, 0xf0, 0x0b, 0xeb, 0x30, 0xd6, 0xe2, 0x1a, 0xfc, 0xdc, 0x15, 0x06,
+  0x00, 0x0f, 0x04, 0xea, 0x00, 0x0b, 0xcb, 0x37, 0xd7, 0xd9, 0xff, 0x07,
+  0xfc, 0xd7, 0xe4, 0x1f, 0x09, 0xff, 0x08, 0xb0, 0xdc, 0x05, 0xda, 0x04,
+  0xd1, 0xe7, 0xe7, 0x17, 0xfa, 0xfc, 0x0e, 0x3f, 0x14, 0xf1, 0x01, 0xeb,
+  0xfa, 0x08, 0xe9, 0xfe, 0x25, 0xec, 0x29, 0x0a, 0xe6, 0x03, 0xee, 0xe9,
+  0x02, 0x1e, 0x19, 0xec, 0x32, 0x00, 0x15, 0xe8, 0xe9, 0xe7, 0xea, 0x38,
+  0xe8, 0x2b, 0x04, 0x08, 0xf0, 0xe8, 0x2b, 0xee, 0xe3, 0x1b, 0xf4, 0xf3,
+  0xea, 0x21, 0x07, 0xd4, 0xfb, 0x0f, 0x33, 0x9b, 0xe5, 0xc1, 0x18, 0xf5,
+  0x19, 0xf6, 0x22, 0xdc, 0xda, 0x0d, 0x05, 0xe2, 0x2e, 0xf2, 0xf6, 0x2e,
+  0xf4, 0x02, 0x3d, 0x04, 0x03, 0xdc, 0xf3, 0xf8, 0xea, 0xeb, 0xfb, 0xfa,
+  0x04, 0xe0, 0x19, 0xf4, 0xe7, 0x19, 0x0d, 0xbf, 0x04, 0xf5, 0x37, 0x11,
+  0x26, 0xee, 0x03, 0x0f, 0xfb, 0x00, 0xf8, 0x0d, 0xf7, 0xf6, 0x21, 0x08,
+  0xa9, 0xea, 0xec, 0xf9, 0xf7, 0xf2, 0x0f, 0xe1, 0xf5, 0xe2, 0x1e, 0xad,
+  0xe3, 0xd8, 0x23, 0xf4, 0x22, 0x04, 0x2a, 0xd1, 0xea, 0xed, 0x09, 0xf8,
+  0x16, 0xed, 0x11, 0x04, 0xe0, 0xec, 0x7f, 0xf2, 0xce, 0x0f, 0xe5, 0xe2,
+  0xe4, 0xe2, 0x18, 0xd8, 0x05, 0xea, 0x23, 0x1e, 0xd1, 0x21, 0x13, 0xf1,
+  0x1e, 0xfa, 0x38, 0x07, 0x2d, 0xf1, 0xd5, 0x0f, 0xeb, 0xf0, 0x2a, 0x34,
+  0xee, 0x03, 0x33, 0xf4, 0xd9, 0xfe, 0xde, 0x04, 0xf4, 0x07, 0x08, 0xf2,
+  0x0d, 0x0d, 0xcd, 0xd9, 0xb9, 0xd8, 0x41, 0x14, 0x1f, 0xf1, 0x0e, 0xda,
+  0xcd, 0xe0, 0x1f, 0xe8, 0x18, 0xff, 0x03, 0x16, 0xea, 0xd0, 0x26, 0xf9,
+  0xff, 0x12, 0xc2, 0x10, 0x3a, 0xf7, 0x25, 0x05, 0x15, 0x03, 0x08, 0x10,
+  0xf0, 0x15, 0x2b, 0xf4, 0xee, 0x11, 0x25, 0xfe, 0x02, 0xf1, 0xe6, 0xde,
+  0xf0, 0xec, 0x17, 0x28, 0xf6, 0xf4, 0xdb, 0x22, 0x22, 0x07, 0xcb, 0x0c,
+  0x0c, 0xf6, 0xc6, 0xe9, 0xe8, 0xda, 0xd6, 0xb6, 0xde, 0x1f, 0x19, 0xe4,
+  0xc5, 0xf8, 0xc4, 0x3a, 0x00, 0xfd, 0x20, 0x33, 0x0d, 0xd0, 0x04, 0xea,
+  0x24, 0x3e, 0x09, 0x2a, 0x22, 0x30, 0xec, 0xf9, 0xe7, 0x16, 0x18, 0x31,
+  0xf5, 0x1d, 0xf4, 0xfd, 0x3a, 0x0c, 0x10, 0x17, 0x0a, 0x34, 0xfa, 0xe4,
+  0xec, 0x06, 0xd3, 0x03, 0xd9, 0xf7, 0x01, 0x02, 0xef, 0x01, 0xf8, 0xf2,
+  0x08, 0x0e, 0xc9, 0xec, 0xd9, 0xff, 0xec, 0xfd, 0xea, 0xfa, 0xf6, 0xf4,
+  0x05, 0x11, 0xb6, 0xfe, 0x81, 0x25, 0xfd, 0x2c, 0xe6, 0xd2, 0xf6, 0xfd,
+  0x1b, 0x07, 0x20, 0x1e, 0x10, 0x2a, 0x0f, 0x10, 0x55, 0x38, 0xef, 0xce,
+  0xf1, 0x2d, 0x31, 0x20, 0x15, 0x0c, 0x2b, 0x15, 0x3f, 0x00, 0x2a, 0x31,
+  0x23, 0xfd, 0xdd, 0xbd, 0xe6, 0x1e, 0xf8, 0x08, 0xe5, 0xd5, 0xfe, 0x02,
+  0x35, 0x07, 0xf0, 0xf2, 0xfc, 0x1b, 0xdc, 0xef, 0x03, 0xd0, 0xef, 0x20,
+  0xf5, 0x36, 0xf2, 0xe0, 0xea, 0x39, 0xf0, 0xde, 0xca, 0x05, 0x06, 0x14,
+  0x09, 0xf8, 0x25, 0x16, 0xfa, 0x21, 0x1d, 0xff, 0x13, 0xf9, 0x27, 0x0b,
+  0x08, 0x31, 0xfc, 0xe0, 0xec, 0x3b, 0x46, 0x19, 0x2d, 0xeb, 0x39, 0x13,
+  0xda, 0x05, 0x14, 0xee, 0x20, 0x14, 0x0c, 0x0b, 0x08, 0xcd, 0x06, 0x15,
+  0xf6, 0x06, 0xf6, 0x02, 0xfb, 0x0a, 0xd6, 0xde, 0x19, 0x13, 0xf9, 0xf2,
+  0xe3, 0x18, 0xcd, 0xe8, 0xff, 0xf2, 0x09, 0xd2, 0xf0, 0x34, 0xfa, 0xf9,
+  0xc7, 0x0a, 0xec, 0xf2, 0xe3, 0xe6, 0x19, 0x1b, 0x13, 0xc9, 0x04, 0x23,
+  0x12, 0x11, 0xef, 0x3f, 0xf1, 0xfa, 0x00, 0xd9, 0x0c, 0xf7, 0x5d, 0xe9,
+  0xe4, 0xf9, 0x18, 0x02, 0xe2, 0x00, 0xe8, 0x11, 0xf2, 0x07, 0x1c, 0xf4,
+  0xec, 0xed, 0xe6, 0xdc, 0x13, 0x00, 0xe1, 0xe4, 0xfb, 0xf9, 0xf2, 0xd8,
+  0x16, 0x0d, 0xee, 0xf2, 0xce, 0x02, 0xe3, 0x0d, 0xf1, 0xfa, 0x04, 0xdf,
+  0x12, 0x16, 0xf4, 0xe7, 0xd9, 0x01, 0x14, 0xea, 0xef, 0x03, 0x21, 0xe5,
+  0xee, 0xf6, 0x08, 0x0c, 0xe5, 0xdf, 0xed, 0xdc, 0xdf, 0x04, 0xf5, 0x1d,
+  0x0b, 0xde, 0x0a, 0xf5, 0xc1, 0xfa, 0x0b, 0x26, 0xf5, 0x18, 0xd0, 0xfc,
+  0x12, 0x01, 0xef, 0x08, 0x0a, 0x08, 0xef, 0xdc, 0xf5, 0xf6, 0x05, 0x01,
+  0x14, 0xd5, 0xea, 0xa1, 0x07, 0x19, 0xe3, 0xfe, 0xf1, 0xf8, 0xdf, 0x20,
+  0x12, 0x37, 0x19, 0xf8, 0x01, 0x31, 0x14, 0xef, 0x08, 0x02, 0xde, 0xea,
+  0x13, 0x0a, 0x10, 0xfa, 0xe6, 0x2d, 0xf2, 0x00, 0xe3, 0xf3, 0x24, 0x1f,
+  0xff, 0x02, 0x04, 0x1d, 0xe0, 0x00, 0x19, 0x02, 0x14, 0xe0, 0xff, 0xd9,
+  0x05, 0x34, 0xed, 0x05, 0x25, 0xe9, 0xf1, 0x2b, 0x0e, 0xd3, 0xeb, 0x00,
+  0x00, 0x19, 0xf5, 0xe1, 0xf1, 0xee, 0xe3, 0xfa, 0xd6, 0x0d, 0x0e, 0xfc,
+  0x16, 0x3f, 0xe7, 0x40, 0x18, 0x06, 0x1c, 0xe9, 0x0c, 0x2b, 0xff, 0xfb,
+  0x1f, 0xc8, 0x11, 0x0f, 0x02, 0xf1, 0x0c, 0x16, 0xf9, 0xd3, 0x16, 0xff,
+  0xd3, 0xd5, 0xf3, 0x20, 0xf3, 0x00, 0xf5, 0xea, 0x19, 0xf3, 0x3f, 0xb9,
+  0x11, 0xfe, 0x00, 0x09, 0xe5, 0x04, 0xd5, 0x21, 0xf5, 0xd1, 0x24, 0xd3,
+  0x23, 0xee, 0xfb, 0xeb, 0xee, 0x35, 0xf5, 0xff, 0xe7, 0xda, 0x23, 0xfa,
+  0x1d, 0x05, 0x06, 0xd7, 0x0a, 0x16, 0xf4, 0x20, 0x1b, 0xee, 0x2c, 0xf7,
+  0x0e, 0xf8, 0x22, 0xf8, 0x4f, 0xf1, 0x52, 0xfa, 0x0b, 0x4f, 0xf6, 0x0a,
+  0xf3, 0xd7, 0x22, 0xf9, 0x03, 0xe5, 0xc5, 0xda, 0xef, 0x13, 0x07, 0x36,
+  0x11, 0xf2, 0x13, 0x02, 0xf5, 0x14, 0xde, 0x10, 0xca, 0xf4, 0xf3, 0x1a,
+  0xfd, 0xe5, 0x0f, 0x03, 0x29, 0xfc, 0xfa, 0xf7, 0xed, 0x31, 0xf4, 0x13,
+  0xc5, 0xd9, 0x3f, 0xd2, 0xee, 0xeb, 0x31, 0xf0, 0x04, 0x05, 0xe4, 0xea,
+  0x40, 0x02, 0x05, 0x13, 0xf4, 0x09, 0xfc, 0xe0, 0x3f, 0xd3, 0x23, 0xea,
+  0x20, 0x0f, 0x0b, 0xdd, 0xe8, 0x0d, 0xf5, 0xf6, 0xe0, 0x35, 0xf2, 0xfc,
+  0xd9, 0xd6, 0x17, 0x37, 0xd3, 0x05, 0xe6, 0x0f, 0x10, 0x09, 0xcc, 0xe8,
+  0xe9, 0x23, 0x13, 0xe3, 0xe2, 0xc4, 0xec, 0x0a, 0xe9, 0xe9, 0xc5, 0x01,
+  0x16, 0x0d, 0x08, 0xf3, 0x08, 0x0c, 0x04, 0x29, 0xe3, 0x12, 0x21, 0xd0,
+  0x1d, 0xaf, 0x2c, 0x30, 0xfa, 0x05, 0x0c, 0xcd, 0x03, 0xd0, 0x13, 0xe9,
+  0x23, 0xde, 0xef, 0x35, 0xe2, 0xe0, 0x27, 0xf4, 0xe4, 0xf0, 0x0b, 0xf0,
+  0xf9, 0xc4, 0xe4, 0xf4, 0x56, 0x0e, 0x25, 0x2d, 0xe0, 0xf2, 0x19, 0xff,
+  0xfe, 0xe1, 0xb7, 0x22, 0xdf, 0x2d, 0x15, 0x0e, 0xda, 0xf0, 0x46, 0xcc,
+  0x1e, 0xe9, 0xdf, 0x0e, 0x13, 0x0a, 0x65, 0x0d, 0x41, 0xfe, 0xdc, 0xf6,
+  0x2d, 0x5d, 0x02, 0x0d, 0xb6, 0xd3, 0x25, 0x12, 0x08, 0xa1, 0xe5, 0xcd,
+  0x20, 0x2e, 0x59, 0x01, 0x1c, 0xe8, 0xe6, 0xe1, 0x28, 0x2b, 0x24, 0xe4,
+  0xfc, 0x09, 0x09, 0x0a, 0xca, 0xfb, 0xbd, 0x07, 0x0c, 0xf5, 0xf9, 0x23,
+  0x27, 0x07, 0xd8, 0x23, 0x2e, 0x18, 0x20, 0xe7, 0xe2, 0x59, 0x07, 0x32,
+  0xdf, 0xf0, 0xf5, 0x34, 0xc9, 0xc9, 0xdd, 0xea, 0xe4, 0xf4, 0xe5, 0xc0,
+  0x31, 0x04, 0xe1, 0xb6, 0x24, 0x51, 0xe7, 0xe0, 0xe8, 0x2d, 0xc4, 0x8b,
+  0xf5, 0xc1, 0xea, 0xc1, 0xdd, 0xd7, 0xee, 0x27, 0xfe, 0xcf, 0xe1, 0x4e,
+  0x09, 0x32, 0xe0, 0x1f, 0x12, 0x0f, 0xf3, 0xeb, 0x2b, 0xef, 0xa9, 0xe4,
+  0xe2, 0x00, 0x1e, 0x03, 0x44, 0x0e, 0xc8, 0x06, 0x51, 0x07, 0x57, 0xde,
+  0x01, 0xc0, 0xe3, 0x20, 0x28, 0xf1, 0x06, 0xd5, 0x02, 0x16, 0xf9, 0x02,
+  0xe4, 0x0d, 0x14, 0x12, 0xf5, 0x08, 0xf6, 0xe7, 0x0b, 0x06, 0x22, 0xcd,
+  0x0c, 0xee, 0x17, 0x16, 0x03, 0x19, 0x3f, 0x56, 0x2a, 0x00, 0xfe, 0xd0,
+  0x5e, 0x02, 0x15, 0x2c, 0xfc, 0xd4, 0xf5, 0x09, 0x04, 0x05, 0xf5, 0x3b,
+  0x15, 0xf6, 0x18, 0xfa, 0x2f, 0xed, 0x12, 0xcb, 0x15, 0x10, 0x17, 0xe5,
+  0xbc, 0x01, 0xde, 0xce, 0x34, 0x34, 0xfd, 0x02, 0x0d, 0xfd, 0x15, 0xd5,
+  0xed, 0x0e, 0xec, 0xd8, 0x39, 0xf0, 0xf8, 0x49, 0xfb, 0x0b, 0xce, 0xdd,
+  0x21, 0xf1, 0xa1, 0x05, 0xc1, 0xec, 0xef, 0xff, 0x0d, 0xb5, 0x53, 0x3f,
+  0x0a, 0xe5, 0x12, 0xd6, 0xc1, 0xd1, 0x26, 0x18, 0x1b, 0x1f, 0xf6, 0xf1,
+  0xff, 0x1d, 0xfa, 0x0b, 0xfc, 0x2c, 0xef, 0xf1, 0xe6, 0xe1, 0xd7, 0xe5,
+  0x27, 0xf7, 0xdd, 0x0e, 0xec, 0xdb, 0xed, 0xdc, 0x08, 0x4d, 0xe1, 0x0b,
+  0x17, 0x01, 0xca, 0x11, 0xc0, 0xf9, 0xf6, 0x06, 0xf7, 0x39, 0xc8, 0x0f,
+  0xd5, 0x0b, 0xd6, 0xf4, 0x3c, 0x13, 0xde, 0xd0, 0xf5, 0xf0, 0x10, 0xb0,
+  0xfa, 0xd7, 0x2a, 0x4f, 0xd2, 0xb2, 0xed, 0x32, 0xeb, 0x1d, 0x06, 0xf4,
+  0xfa, 0x51, 0xe5, 0x4b, 0x35, 0xd0, 0xff, 0xed, 0xff, 0xf8, 0x1e, 0xbc,
+  0xd7, 0x0f, 0xda, 0x21, 0xf5, 0xfe, 0x1d, 0xe7, 0x00, 0x03, 0x3c, 0xcf,
+  0xf2, 0x0d, 0xe2, 0x0b, 0x04, 0xfc, 0x31, 0x31, 0x0d, 0xe8, 0xe5, 0x3c,
+  0xc9, 0xfe, 0x03, 0xfb, 0xf9, 0x1a, 0x1c, 0xe3, 0xb4, 0x0d, 0x15, 0xe6,
+  0x08, 0xe8, 0xe4, 0xc5, 0xe6, 0x04, 0x1e, 0xde, 0xf5, 0x32, 0x0f, 0xd2,
+  0x06, 0x03, 0xf9, 0x43, 0xca, 0x00, 0xe6, 0x0c, 0x1d, 0x31, 0xe1, 0x38,
+  0xf6, 0xd8, 0x37, 0x2b, 0x14, 0x12, 0x19, 0xc7, 0xc1, 0x7f, 0x27, 0xa7,
+  0xdc, 0xf6, 0x15, 0xde, 0x29, 0x13, 0x08, 0xfc, 0xc1, 0x02, 0x0c, 0x4e,
+  0xf3, 0xd0, 0xd9, 0xf4, 0x27, 0xca, 0xc6, 0xf8, 0xf6, 0xe7, 0x0f, 0xfb,
+  0x0f, 0x08, 0xe3, 0x19, 0xfb, 0xf5, 0xe0, 0x08, 0x26, 0x25, 0x3c, 0xfb,
+  0xc1, 0xd8, 0xfc, 0xdc, 0xd4, 0x3a, 0x2e, 0x1d, 0xdf, 0xb8, 0x3b, 0x53,
+  0x20, 0x32, 0x15, 0x2e, 0xc2, 0xc9, 0x21, 0x3b, 0xec, 0x2d, 0xde, 0xd2,
+  0xbb, 0x1c, 0x06, 0xcc, 0xc2, 0xdb, 0xe5, 0xfe, 0xea, 0x0b, 0xd6, 0x1d,
+  0x0c, 0xcd, 0x10, 0x7b, 0xe8, 0xdb, 0xc0, 0x1c, 0x07, 0x31, 0xd2, 0xf0,
+  0xc0, 0x11, 0x0b, 0xe7, 0x4a, 0xf8, 0xc0, 0xdd, 0xef, 0x13, 0xd7, 0x0e,
+  0x0c, 0x18, 0x20, 0xf7, 0x02, 0xad, 0x13, 0xf6, 0xe7, 0x71, 0xfb, 0x0e,
+  0x08, 0xb9, 0x09, 0x61, 0x10, 0x11, 0xf6, 0x34, 0xe8, 0xd2, 0x52, 0x15,
+  0xda, 0x08, 0xfc, 0x01, 0xe5, 0x02, 0x33, 0xf3, 0xdb, 0xb1, 0xcf, 0x27,
+  0xf1, 0x33, 0xe0, 0xfb, 0x01, 0xd6, 0xcf, 0x17, 0x2e, 0xbf, 0x01, 0xcb,
+  0x3d, 0x1c, 0xcc, 0xf7, 0x2d, 0xfe, 0xa6, 0xed, 0xec, 0x0d, 0xef, 0x3e,
+  0xe7, 0x2a, 0x4a, 0x3e, 0x3b, 0x2c, 0xf9, 0x50, 0xc8, 0xc3, 0x0d, 0xf5,
+  0x1a, 0xf3, 0x1c, 0x0a, 0xc4, 0xf0, 0x21, 0x30, 0xfa, 0xd3, 0x26, 0x10,
+  0xfa, 0xee, 0xe5, 0xb8, 0xdd, 0xd6, 0xf9, 0xd4, 0xfd, 0xf3, 0xff, 0x2b,
+  0x1d, 0x49, 0xc8, 0x25, 0xb5, 0x57, 0xdd, 0xfd, 0xff, 0x99, 0xde, 0x1c,
+  0x39, 0x05, 0x07, 0x00, 0x1d, 0x06, 0x3b, 0x28, 0x43, 0x22, 0xd8, 0xca,
+  0x69, 0x2d, 0xd9, 0xe6, 0xbb, 0x2d, 0xfb, 0x07, 0x12, 0xf8, 0xd0, 0x45,
+  0x29, 0x8f, 0x16, 0xe9, 0xf9, 0xc6, 0x43, 0x56, 0xe7, 0xdd, 0xe0, 0xc8,
+  0xf3, 0xe2, 0x36, 0x0f, 0x1b, 0x06, 0xc7, 0xf4, 0xbf, 0xe4, 0xeb, 0xf7,
+  0x07, 0xd5, 0xf7, 0x56, 0x22, 0xcd, 0xff, 0x12, 0x81, 0xd5, 0xd6, 0x23,
+  0x05, 0xd9, 0xd5, 0xfd, 0x2d, 0x06, 0x01, 0x77, 0xca, 0x11, 0x1d, 0xc3,
+  0x0e, 0x37, 0xda, 0xfb, 0x23, 0xe3, 0xfd, 0xe0, 0xda, 0x30, 0xf9, 0xe4,
+  0x00, 0xd4, 0x2a, 0xd4, 0xdc, 0xb7, 0xc2, 0x2e, 0x00, 0xe6, 0x32, 0xe8,
+  0xbb, 0xf5, 0x27, 0x0b, 0xf1, 0x49, 0x3e, 0x2d, 0x18, 0xfe, 0xb1, 0x07,
+  0xd8, 0x0b, 0x03, 0x12, 0x12, 0xbe, 0x05, 0x11, 0x40, 0xe4, 0xf0, 0xe1,
+  0x3b, 0x13, 0xeb, 0x19, 0xee, 0xe1, 0xeb, 0x27, 0x01, 0xdb, 0xd1, 0x39,
+  0x20, 0x40, 0x04, 0xe4, 0x62, 0xde, 0x16, 0x09, 0xf2, 0x08, 0x0a, 0xfe,
+  0xc1, 0xf9, 0x66, 0x3e, 0xfb, 0xdc, 0xd8, 0x44, 0xb9, 0x34, 0x18, 0x4c,
+  0x04, 0xd9, 0x24, 0x06, 0x0f, 0x7c, 0xe2, 0xc0, 0xe4, 0x2f, 0x01, 0xf6,
+  0x23, 0x0e, 0x18, 0xca, 0xf9, 0x24, 0x07, 0xeb, 0xde, 0x1d, 0x08, 0x40,
+  0x09, 0x1e, 0x10, 0xf3, 0xfe, 0x2d, 0xf4, 0x01, 0x00, 0xd4, 0x21, 0x01,
+  0x2e, 0xf7, 0xd3, 0x25, 0xd3, 0x15, 0x33, 0xfb, 0x3b, 0x13, 0x27, 0xea,
+  0x08, 0x39, 0xe8, 0xf5, 0x10, 0x02, 0xd5, 0x2c, 0x10, 0xe0, 0xa1, 0x0c,
+  0xe8, 0x2b, 0x07, 0x32, 0x0d, 0xe3, 0xdd, 0x23, 0xfc, 0x3e, 0xd3, 0xe1,
+  0x24, 0x3b, 0x23, 0x11, 0x27, 0xe3, 0xd5, 0xb0, 0x00, 0x05, 0xec, 0xe3,
+  0xe4, 0xe6, 0x36, 0x18, 0xfc, 0xd4, 0xf1, 0x23, 0x3d, 0xc9, 0xe8, 0x21,
+  0xf5, 0xc2, 0xff, 0xf1, 0x35, 0x30, 0xd2, 0x32, 0xa5, 0x58, 0x22, 0xfc,
+  0x7f, 0xd4, 0x12, 0xd9, 0xd1, 0xdf, 0x36, 0xfd, 0xd3, 0x22, 0x0d, 0x03,
+  0xff, 0xfa, 0xd8, 0x07, 0xd7, 0x02, 0x15, 0x06, 0x26, 0xff, 0x2c, 0xb9,
+  0xf8, 0x17, 0x1d, 0xd3, 0xee, 0x6a, 0x1d, 0x25, 0x14, 0xfc, 0xb2, 0xe2,
+  0xf4, 0xd0, 0xdd, 0x46, 0xff, 0x03, 0xfe, 0x17, 0xc1, 0xd5, 0xfe, 0xde,
+  0x1c, 0x43, 0x04, 0xff, 0x11, 0xf4, 0xea, 0x29, 0xf3, 0xfc, 0x22, 0x3b,
+  0x64, 0xd7, 0x19, 0xeb, 0x1f, 0xcf, 0x75, 0xf9, 0x1f, 0xcc, 0x0f, 0x46,
+  0xa1, 0x28, 0x39, 0x0b, 0xd5, 0x05, 0x25, 0xe2, 0xde, 0xf7, 0xf7, 0x39,
+  0xfd, 0xd8, 0xd2, 0xfa, 0x2b, 0x1d, 0x0f, 0x97, 0xca, 0x11, 0x0c, 0x17,
+  0x0f, 0xdf, 0xd0, 0xce, 0xad, 0x41, 0x47, 0x09, 0x03, 0x0e, 0xfc, 0x08,
+  0xd9, 0x97, 0x06, 0x0b, 0xd9, 0x2b, 0xdf, 0xfb, 0xec, 0x0c, 0x04, 0x34,
+  0x08, 0x25, 0xf8, 0xfd, 0xe7, 0x0c, 0x18, 0xfd, 0xb0, 0x04, 0x68, 0x02,
+  0xfc, 0x18, 0x09, 0x12, 0xa5, 0xe4, 0x0f, 0xec, 0x1e, 0xd4, 0x1a, 0x2e,
+  0xd0, 0x0a, 0x42, 0xfb, 0xe6, 0x15, 0xbc, 0xf2, 0x3a, 0x20, 0x24, 0xfc,
+  0xc2, 0x41, 0x33, 0xf7, 0x1b, 0x16, 0xd0, 0xcb, 0xf5, 0x10, 0xe6, 0x13,
+  0xf7, 0x36, 0x07, 0xe7, 0xeb, 0xb0, 0x0f, 0xc6, 0x06, 0x12, 0x13, 0xdb,
+  0x0e, 0xf4, 0xd5, 0x10, 0x3c, 0xfc, 0xfd, 0xdb, 0xdb, 0x2d, 0x1a, 0x10,
+  0x21, 0xe0, 0x19, 0xc0, 0xf4, 0xe1, 0xfe, 0xe9, 0xc2, 0xf7, 0x16, 0xf0,
+  0xd6, 0xd5, 0x19, 0x2c, 0x10, 0x11, 0xfb, 0xf5, 0x27, 0xf3, 0x06, 0xea,
+  0xff, 0xfa, 0x03, 0x5c, 0xe4, 0x1f, 0x0a, 0x0c, 0xcc, 0x26, 0xd8, 0x9a,
+  0x0b, 0xee, 0xfb, 0x4b, 0x2c, 0x0b, 0xcc, 0xe4, 0xa0, 0xdd, 0x36, 0xcc,
+  0x30, 0x46, 0x17, 0x9a, 0xf9, 0xd5, 0x27, 0x2d, 0x03, 0xd5, 0xfa, 0x35,
+  0x1a, 0x0a, 0x35, 0xf9, 0x22, 0xca, 0xdd, 0x44, 0xe6, 0xf8, 0xe3, 0x43,
+  0xc4, 0xcf, 0x41, 0xb7, 0xda, 0xe0, 0xe5, 0x00, 0xa5, 0xf7, 0x33, 0x9a,
+  0xe7, 0xd0, 0x31, 0xc4, 0xea, 0xd2, 0x17, 0x42, 0x36, 0x2d, 0x10, 0xfd,
+  0x01, 0xe9, 0x07, 0xcd, 0x53, 0x0e, 0xee, 0xdf, 0xc9, 0x0a, 0xe9, 0x08,
+  0x2d, 0xda, 0x1b, 0xe0, 0x1b, 0x38, 0xf4, 0xd1, 0xf8, 0xdb, 0xea, 0xde,
+  0xd4, 0xde, 0xd9, 0xe9, 0x4e, 0xdf, 0x21, 0xc0, 0xe6, 0xe9, 0x09, 0xf3,
+  0xd3, 0x15, 0x6c, 0x22, 0xdf, 0x1b, 0x2e, 0x0d, 0xcb, 0xf6, 0xe7, 0x15,
+  0x8f, 0xe3, 0x42, 0x24, 0xe1, 0xe8, 0x37, 0xd9, 0xf2, 0x0a, 0xfc, 0xf9,
+  0x0a, 0x23, 0xe3, 0x14, 0x1e, 0x04, 0x06, 0x62, 0x0c, 0x03, 0x00, 0x0d,
+  0xc8, 0xd2, 0x09, 0xdc, 0x16, 0x03, 0x18, 0xcb, 0x06, 0x3c, 0x18, 0xe6,
+  0xfe, 0xd9, 0x38, 0xf0, 0x24, 0x08, 0xea, 0x3f, 0x42, 0xda, 0x00, 0xba,
+  0xec, 0xfb, 0x9c, 0x32, 0x02, 0xf0, 0xe3, 0xfa, 0xcc, 0x10, 0x29, 0xe7,
+  0xdc, 0xff, 0x00, 0x0b, 0xae, 0x27, 0x1f, 0x0c, 0xd2, 0xc1, 0x37, 0xfb,
+  0xb0, 0xf4, 0x46, 0xee, 0x3d, 0xea, 0x0b, 0x15, 0x05, 0x21, 0xb7, 0x11,
+  0x1a, 0x03, 0x1b, 0xe6, 0xce, 0xd1, 0xfd, 0x28, 0x26, 0xfd, 0x16, 0x28,
+  0xf2, 0x5d, 0xf3, 0xaa, 0x1e, 0xec, 0x23, 0xfe, 0xd4, 0x22, 0xf1, 0x4d,
+  0xba, 0x24, 0x2f, 0xd6, 0x25, 0x09, 0x14, 0xe8, 0xd5, 0xf1, 0xce, 0x17,
+  0xb0, 0x0d, 0x09, 0x09, 0xe9, 0xfa, 0x05, 0xa2, 0xdc, 0x06, 0x1e, 0xe7,
+  0xe0, 0x0f, 0x07, 0xc0, 0xf3, 0xf7, 0x01, 0x11, 0x2e, 0x02, 0x47, 0xf9,
+  0x01, 0xe2, 0x1e, 0x85, 0xeb, 0xf6, 0xf8, 0xef, 0x0f, 0xe4, 0xf0, 0x05,
+  0xd5, 0x18, 0x1b, 0xe5, 0xff, 0x2b, 0xe9, 0x9e, 0x23, 0xce, 0xe9, 0xd7,
+  0xc8, 0xf5, 0xf3, 0x26, 0x31, 0xd6, 0x1c, 0xcb, 0xf1, 0x30, 0x2e, 0xe8,
+  0xf8, 0xc8, 0x17, 0xdd, 0xe3, 0x2c, 0xed, 0xee, 0xe2, 0xd6, 0x3b, 0x10,
+  0xc9, 0x08, 0x57, 0x2e, 0xc7, 0xf2, 0x1c, 0xf4, 0x13, 0xe4, 0x0f, 0xc6,
+  0x16, 0x1c, 0x28, 0xff, 0xe0, 0xfd, 0x28, 0x18, 0xd0, 0xd8, 0x22, 0xf3,
+  0x43, 0xd6, 0xfb, 0xef, 0x07, 0xe3, 0x24, 0x0f, 0xea, 0x49, 0xe1, 0xbd,
+  0x1e, 0xe7, 0x1f, 0xd1, 0xf3, 0x25, 0x09, 0x25, 0x14, 0x1b, 0x0b, 0xa3,
+  0xd5, 0x28, 0x2f, 0x10, 0xf6, 0xe1, 0xd2, 0xe8, 0xe4, 0xee, 0x10, 0x05,
+  0xb0, 0xd7, 0x08, 0x01, 0x1c, 0xf3, 0x28, 0x01, 0x03, 0xb4, 0x16, 0xe2,
+  0xed, 0xd4, 0x12, 0xd6, 0x1f, 0xfd, 0x56, 0x26, 0xd2, 0xe3, 0xfb, 0xc3,
+  0xe7, 0xcc, 0x11, 0x30, 0x47, 0x0a, 0xf9, 0x02, 0x14, 0x02, 0xea, 0x43,
+  0x07, 0x05, 0xfa, 0xc1, 0x66, 0xe9, 0x32, 0x0f, 0xc9, 0x4a, 0xd7, 0x1f,
+  0xcb, 0x19, 0x12, 0x12, 0x3b, 0x56, 0x02, 0xd0, 0xf9, 0xdb, 0xf3, 0xe3,
+  0xe2, 0x17, 0xeb, 0x26, 0xe5, 0x04, 0xf2, 0xee, 0xef, 0xdd, 0xeb, 0x16,
+  0xae, 0xe3, 0x00, 0x0a, 0x0e, 0x49, 0xfa, 0xb5, 0xb4, 0xe5, 0xe3, 0x03,
+  0xd9, 0xe4, 0xec, 0x90, 0xec, 0x06, 0x12, 0xc5, 0xd3, 0x26, 0x0b, 0x2b,
+  0xe8, 0xdf, 0x00, 0xcb, 0x15, 0x15, 0xf9, 0xbd, 0x53, 0xf8, 0xf1, 0x25,
+  0xc1, 0x29, 0x94, 0xfa, 0xea, 0xce, 0x03, 0x1b, 0x16, 0x79, 0x20, 0xf2,
+  0xfc, 0x10, 0x2d, 0xce, 0xe2, 0xe7, 0x0b, 0x06, 0xfb, 0xef, 0x2c, 0x40,
+  0x0c, 0xe8, 0xf8, 0x3f, 0xef, 0x18, 0x09, 0x24, 0x53, 0x35, 0x20, 0xcd,
+  0xb8, 0x11, 0xe1, 0xef, 0x07, 0x17, 0xe6, 0x0b, 0xd3, 0xc1, 0x14, 0xe9,
+  0xed, 0x10, 0x26, 0x05, 0x12, 0x9b, 0x26, 0xde, 0x07, 0xf8, 0xde, 0xbc,
+  0x43, 0xe9, 0x16, 0x2a, 0xf0, 0x36, 0xd6, 0xf4, 0xe2, 0x0f, 0xde, 0xbe,
+  0x02, 0x7f, 0x2e, 0x2a, 0x10, 0xee, 0xe5, 0xd0, 0xed, 0xe8, 0xdd, 0xe8,
+  0xbb, 0xfa, 0x39, 0xc6, 0x44, 0xae, 0x11, 0x23, 0xff, 0xee, 0xf1, 0x15,
+  0x22, 0x47, 0x08, 0x1d, 0xe2, 0x29, 0xfd, 0xdc, 0x2d, 0xf8, 0xe8, 0xa9,
+  0xe0, 0xbd, 0xff, 0x06, 0xf6, 0x34, 0xfd, 0xe5, 0xf4, 0x04, 0xf7, 0xe1,
+  0xe9, 0x30, 0xf4, 0xe5, 0xd8, 0xd1, 0x17, 0xcf, 0xba, 0xed, 0xe8, 0xea,
+  0xeb, 0xf0, 0x11, 0xec, 0x0d, 0xdf, 0x15, 0x43, 0xf9, 0xfb, 0x4e, 0xac,
+  0xe8, 0xeb, 0xf1, 0xfd, 0x12, 0x16, 0xf8, 0x98, 0xfc, 0xdc, 0xf0, 0x2c,
+  0xc9, 0xe2, 0x1a, 0x36, 0x5a, 0xdc, 0xfa, 0xa2, 0x90, 0x10, 0xbf, 0x30,
+  0x1d, 0xf5, 0xc8, 0x16, 0xde, 0x3b, 0xfd, 0xd9, 0xe9, 0xc0, 0xeb, 0x12,
+  0xcf, 0xd8, 0x2c, 0xe3, 0xcc, 0xf7, 0xf1, 0x05, 0xb9, 0x04, 0x1b, 0xf6,
+  0x3f, 0xc0, 0xa2, 0xc3, 0x06, 0x4b, 0xe0, 0xe6, 0x47, 0x21, 0xe2, 0xf7,
+  0x09, 0x13, 0x17, 0xd7, 0x33, 0xe3, 0xf6, 0xb9, 0x0b, 0x09, 0x2f, 0xc5,
+  0xf9, 0x1e, 0xd2, 0xd1, 0xd6, 0xd3, 0x1c, 0x04, 0x44, 0xf1, 0x08, 0xa5,
+  0xeb, 0xfb, 0xec, 0xf6, 0x4b, 0x22, 0xb8, 0xd6, 0xda, 0x37, 0xef, 0xa3,
+  0x5c, 0xbc, 0x3a, 0x08, 0xd9, 0x13, 0x57, 0xd1, 0xd6, 0xf8, 0x09, 0x12,
+  0xf5, 0xef, 0x19, 0xdf, 0xe4, 0xc3, 0xda, 0x08, 0xfb, 0xf7, 0xc0, 0x0d,
+  0x17, 0x2b, 0x0c, 0x1c, 0x04, 0x00, 0x15, 0xec, 0x2b, 0x43, 0xea, 0x31,
+  0xbc, 0x1b, 0x07, 0xfb, 0x40, 0x28, 0x0b, 0xfe, 0xed, 0xb2, 0xe8, 0x0e,
+  0x54, 0xdb, 0x1c, 0xfe, 0xfc, 0xce, 0x04, 0xf2, 0xe9, 0xef, 0x0e, 0xe6,
+  0xa4, 0x2c, 0xc5, 0xd6, 0x25, 0xbb, 0x52, 0x07, 0xc9, 0xef, 0x02, 0xbe,
+  0x41, 0x13, 0xc2, 0xf7, 0xf6, 0x08, 0x11, 0xf0, 0xf2, 0x14, 0xfb, 0xf2,
+  0xd8, 0xfa, 0xde, 0xcb, 0xc2, 0xe8, 0x05, 0x53, 0x04, 0xd9, 0x07, 0xcb,
+  0xdb, 0x2f, 0xd3, 0xde, 0x04, 0xb4, 0x1c, 0xf2, 0xc7, 0xe7, 0xdd, 0x25,
+  0xf5, 0xf8, 0xd8, 0x15, 0xdf, 0x2d, 0xf6, 0x0e, 0xf1, 0x36, 0x06, 0xfa,
+  0x1f, 0xf9, 0xf5, 0x1e, 0x27, 0xf8, 0x42, 0x23, 0x27, 0x08, 0xe0, 0xe3,
+  0xe2, 0x05, 0x09, 0x53, 0x11, 0xde, 0xbc, 0xe1, 0xcd, 0x0a, 0x04, 0x0a,
+  0x2a, 0x23, 0xab, 0x1a, 0x2c, 0x45, 0xca, 0xd2, 0x2a, 0x36, 0xcd, 0x12,
+  0x22, 0xe7, 0x22, 0xf7, 0xd5, 0xa3, 0x18, 0xcc, 0xf1, 0x9d, 0x32, 0x33,
+  0x35, 0x20, 0x03, 0x31, 0xfb, 0xf1, 0x33, 0x02, 0xdb, 0xdf, 0x1b, 0x0f,
+  0x0e, 0x3e, 0x03, 0xfb, 0x21, 0xfd, 0x19, 0xce, 0x3f, 0x0d, 0x31, 0x05,
+  0x58, 0x17, 0xf9, 0x1c, 0xca, 0x3d, 0x4b, 0x47, 0xf4, 0xeb, 0xeb, 0x34,
+  0xdb, 0x1b, 0x35, 0x1a, 0x03, 0xff, 0xe3, 0x6c, 0xfa, 0xf0, 0xed, 0x04,
+  0xd0, 0x30, 0x13, 0xd2, 0xe9, 0x0b, 0x01, 0xae, 0xf3, 0x0b, 0x27, 0x11,
+  0xda, 0xf2, 0xe6, 0x0a, 0xf3, 0x0f, 0x21, 0x4a, 0x08, 0x00, 0xec, 0x42,
+  0x07, 0xbb, 0x03, 0x28, 0x52, 0xfd, 0x02, 0x01, 0x0b, 0xf7, 0x0e, 0xc2,
+  0x07, 0x08, 0x35, 0x0d, 0x16, 0x05, 0x34, 0xed, 0x0a, 0xdc, 0x37, 0x32,
+  0x45, 0x53, 0x37, 0x21, 0x21, 0x0b, 0xd0, 0xf8, 0xcf, 0xe7, 0x16, 0xeb,
+  0xd1, 0x41, 0xd2, 0xfc, 0xcf, 0xfc, 0xf5, 0x15, 0xf4, 0x1d, 0x20, 0x1e,
+  0xec, 0x3a, 0xea, 0x45, 0x12, 0xfa, 0xd1, 0xf0, 0x09, 0xfc, 0x37, 0x09,
+  0x5d, 0xab, 0xca, 0xe0, 0xd1, 0x1b, 0x2a, 0x3d, 0xe1, 0x19, 0xf1, 0x00,
+  0xf6, 0x1f, 0xf5, 0x2a, 0x1d, 0xd5, 0x1f, 0x1d, 0x29, 0xd9, 0xd2, 0xe1,
+  0xf4, 0x04, 0xd3, 0xf1, 0xfa, 0x00, 0x26, 0xd4, 0xed, 0x2c, 0xef, 0x0d,
+  0x19, 0xe9, 0x06, 0xf5, 0xe6, 0x1f, 0x05, 0xf5, 0x0f, 0x20, 0xf1, 0x20,
+  0x0b, 0xfb, 0x7f, 0x08, 0x04, 0xf6, 0x3d, 0x09, 0xf5, 0xf2, 0xf9, 0x5c,
+  0x0c, 0x19, 0xe5, 0x01, 0x61, 0xf4, 0xed, 0x15, 0xd7, 0x00, 0x1f, 0x33,
+  0xc7, 0x17, 0xf8, 0xd5, 0xb7, 0x00, 0x1e, 0xdd, 0x1f, 0xff, 0xf7, 0xfb,
+  0x35, 0xf1, 0xc4, 0x0e, 0xe0, 0x03, 0xba, 0xf8, 0x04, 0x15, 0x06, 0xeb,
+  0xfe, 0x68, 0xde, 0x31, 0xc3, 0x0b, 0xfa, 0x27, 0x0b, 0x1b, 0xf2, 0xea,
+  0xeb, 0x03, 0x31, 0x00, 0xe0, 0x19, 0x1d, 0xd9, 0x04, 0x16, 0x1f, 0x35,
+  0x05, 0xda, 0xce, 0x2c, 0x04, 0xd4, 0xef, 0x02, 0x0c, 0xe7, 0xd5, 0x02,
+  0xcc, 0xfa, 0x3a, 0x29, 0xf9, 0xee, 0xf5, 0xed, 0x07, 0x01, 0x2b, 0xd5,
+  0x33, 0x82, 0x1f, 0x1c, 0x4b, 0x07, 0x2c, 0xf9, 0x07, 0xf2, 0xc8, 0x05,
+  0x41, 0xc8, 0x10, 0x44, 0xdc, 0x40, 0xd8, 0x32, 0xb7, 0x19, 0xf7, 0x13,
+  0x3b, 0xf2, 0x2f, 0xe4, 0xee, 0xcc, 0xf3, 0xfa, 0xf9, 0x32, 0xf0, 0xce,
+  0xeb, 0xfa, 0xe1, 0xc1, 0x02, 0x9c, 0x0f, 0xc7, 0xda, 0x07, 0xba, 0xc9,
+  0xef, 0x0b, 0x02, 0xce, 0xce, 0xeb, 0x11, 0x16, 0x19, 0xc7, 0x21, 0xe7,
+  0xf1, 0x53, 0x1a, 0xdd, 0x19, 0xa7, 0x27, 0x5a, 0x0f, 0x05, 0x15, 0xd4,
+  0x9f, 0x02, 0xb4, 0x3d, 0x63, 0x2e, 0x02, 0x42, 0xd0, 0x0e, 0xfc, 0x46,
+  0x43, 0xd5, 0xb1, 0xef, 0x2b, 0xd1, 0x39, 0xff, 0xf1, 0xbe, 0xec, 0x93,
+  0xf5, 0x64, 0x25, 0xe3, 0xc1, 0x11, 0xbf, 0xee, 0x45, 0x02, 0xd5, 0xd6,
+  0xcc, 0x3f, 0xd2, 0xe4, 0xc8, 0x04, 0xe8, 0x34, 0xdf, 0xe9, 0x10, 0xcd,
+  0x35, 0xfb, 0x09, 0xf7, 0xd7, 0x54, 0xdf, 0x1a, 0x16, 0xc7, 0x54, 0xe8,
+  0xfd, 0xcf, 0xe3, 0x0a, 0x0d, 0xf9, 0x11, 0xea, 0x2c, 0xff, 0xe6, 0x24,
+  0xec, 0x0c, 0xd7, 0x02, 0xe7, 0xf3, 0xf7, 0xdd, 0x03, 0x00, 0xf5, 0xf8,
+  0xfd, 0xf6, 0x24, 0xa0, 0xfd, 0x28, 0xef, 0x00, 0x12, 0xb8, 0xc1, 0x03,
+  0x2c, 0x01, 0xe4, 0xf5, 0xc7, 0xf7, 0x23, 0x55, 0xe0, 0x0c, 0xdb, 0x44,
+  0xa2, 0xf7, 0x15, 0xdd, 0xc2, 0x05, 0xde, 0xf3, 0xda, 0x0c, 0x11, 0xdc,
+  0xff, 0x11, 0x04, 0xb8, 0x2b, 0x1d, 0x36, 0xd3, 0xe1, 0x16, 0x0b, 0x0a,
+  0x0e, 0xf1, 0x0a, 0xe8, 0xff, 0x03, 0xed, 0x1b, 0xbd, 0xf3, 0xcb, 0x6d,
+  0x07, 0x05, 0x41, 0x07, 0xf8, 0x1c, 0x07, 0x1c, 0x01, 0xd7, 0xd2, 0xda,
+  0x1a, 0xe2, 0x08, 0x19, 0xd0, 0x92, 0x2a, 0xf0, 0x07, 0xf9, 0x0b, 0x0b,
+  0x11, 0x07, 0x28, 0xf7, 0xef, 0xf4, 0xf1, 0xf4, 0x21, 0xf0, 0x11, 0x3f,
+  0x2f, 0xf2, 0x08, 0x0f, 0xfe, 0xff, 0x47, 0x36, 0x12, 0x07, 0xf3, 0xd7,
+  0xed, 0x4b, 0xec, 0x01, 0x27, 0x18, 0xfb, 0xce, 0xd9, 0x08, 0x06, 0x1f,
+  0x1e, 0xc0, 0xca, 0x14, 0x20, 0xc2, 0x10, 0x0f, 0x06, 0xbc, 0xfb, 0xe3,
+  0xd3, 0x23, 0xe3, 0xf4, 0xf1, 0x06, 0x17, 0xc5, 0xc7, 0xbc, 0x13, 0xd8,
+  0x02, 0x30, 0xe6, 0xcd, 0xdb, 0xef, 0x13, 0x12, 0x07, 0xdb, 0xdc, 0xd1,
+  0x1b, 0x05, 0x5b, 0xfb, 0xec, 0x0e, 0xd8, 0x5b, 0x04, 0xed, 0x77, 0x20,
+  0xd3, 0xc6, 0xda, 0xee, 0x33, 0xfb, 0x5c, 0xf1, 0xd5, 0xf4, 0xf3, 0xe7,
+  0xf4, 0x20, 0xf3, 0x17, 0xc9, 0x31, 0xe2, 0xd4, 0x1a, 0x24, 0x0d, 0xfa,
+  0xc0, 0x1d, 0x1d, 0x05, 0xf0, 0xf3, 0xc6, 0x02, 0xfe, 0xf0, 0x21, 0x03,
+  0xd2, 0x9e, 0xdc, 0xf3, 0xf2, 0xf8, 0x01, 0x2e, 0x1f, 0xe7, 0xe1, 0x1d,
+  0xec, 0xdd, 0x2f, 0xf9, 0x02, 0x26, 0x10, 0xfb, 0x22, 0xcd, 0x18, 0x05,
+  0x0b, 0xed, 0x0d, 0x0f, 0xf6, 0xe1, 0x36, 0xfa, 0x2c, 0x31, 0x47, 0x35,
+  0xe8, 0x06, 0xf0, 0x10, 0xfa, 0xe2, 0x31, 0xcb, 0xea, 0xda, 0xda, 0xf5,
+  0x2d, 0xef, 0x23, 0x12, 0x2b, 0xeb, 0xef, 0x24, 0x2e, 0x1b, 0xf1, 0xf1,
+  0xde, 0x48, 0x0c, 0x11, 0xfb, 0xea, 0x48, 0xed, 0xf3, 0xd2, 0xfc, 0x0b,
+  0x03, 0x03, 0x07, 0xdf, 0xdf, 0x46, 0xed, 0x2a, 0xfb, 0x04, 0xe4, 0x01,
+  0xe8, 0xcb, 0xe7, 0x0b, 0xf2, 0x65, 0xcc, 0xf9, 0x19, 0x16, 0xed, 0xbe,
+  0xe9, 0x13, 0x89, 0x05, 0xf3, 0x13, 0x22, 0xd6, 0xed, 0x01, 0x2e, 0xaa,
+  0x02, 0xe6, 0xbc, 0xc8, 0x57, 0xee, 0x01, 0xd8, 0xc8, 0x81, 0xe1, 0xf0,
+  0x18, 0x4b, 0x14, 0x13, 0xf4, 0x5f, 0x29, 0x32, 0x0b, 0x0f, 0x6e, 0x3d,
+  0xfc, 0xf6, 0xf4, 0xdc, 0xd8, 0xbd, 0xec, 0xc1, 0xf3, 0xdc, 0xe9, 0x40,
+  0xf9, 0x60, 0x13, 0xf9, 0xff, 0xf2, 0xda, 0x12, 0x17, 0x43, 0xd0, 0x26,
+  0xfe, 0xf0, 0x0a, 0xe3, 0xbe, 0xd4, 0x08, 0xff, 0xeb, 0xd2, 0xbf, 0xbc,
+  0xf3, 0x19, 0x09, 0x1d, 0x09, 0x2f, 0xdf, 0xe1, 0x09, 0x16, 0xd0, 0x06,
+  0xfb, 0x0f, 0xeb, 0xf7, 0x27, 0xe1, 0x17, 0x0b, 0xd3, 0x10, 0xf6, 0x09,
+  0xe3, 0xe8, 0x0a, 0x14, 0x13, 0xb4, 0x3a, 0xb9, 0x25, 0xf7, 0xdc, 0xd5,
+  0xef, 0x50, 0x02, 0x1b, 0x5b, 0x24, 0xe5, 0xfe, 0x0b, 0xe0, 0x03, 0xe5,
+  0xe9, 0x0f, 0xb2, 0x14, 0xdc, 0xf5, 0xee, 0x01, 0xb4, 0xf4, 0xfa, 0x20,
+  0xad, 0x94, 0x2a, 0x1b, 0xe5, 0xe1, 0x10, 0xb6, 0x11, 0xdb, 0xe6, 0xf0,
+  0xcf, 0x06, 0xd4, 0xfe, 0xff, 0x10, 0x14, 0xe5, 0xf4, 0x04, 0xfb, 0xe1,
+  0xef, 0xfe, 0xf9, 0xb0, 0xd6, 0x1b, 0xd8, 0x0c, 0x33, 0xd8, 0x34, 0x06,
+  0xb8, 0x03, 0xfd, 0xeb, 0xf6, 0x15, 0x48, 0xda, 0x0a, 0x04, 0x0e, 0x0a,
+  0x12, 0xe6, 0x11, 0x0b, 0xe4, 0xfe, 0xd7, 0x14, 0xf7, 0x2e, 0xf9, 0xe5,
+  0xe0, 0xc3, 0xe4, 0xe9, 0x0e, 0xbd, 0x24, 0x16, 0xdc, 0xeb, 0x31, 0xd2,
+  0x1c, 0x01, 0xed, 0xb6, 0xf2, 0xe3, 0xd5, 0xb6, 0xf2, 0x4c, 0x04, 0x10,
+  0xe9, 0x1f, 0xea, 0xfe, 0x32, 0x26, 0x22, 0xe6, 0xf7, 0xe2, 0xa1, 0x0c,
+  0x1e, 0xf7, 0x32, 0x25, 0x1d, 0xe0, 0x09, 0x05, 0xff, 0x0e, 0x34, 0x16,
+  0x05, 0xc3, 0x0e, 0xc7, 0xf0, 0x02, 0x22, 0xd7, 0xdd, 0xe5, 0xca, 0xf8,
+  0x07, 0x13, 0xe3, 0x46, 0xe5, 0xf7, 0xf3, 0xdc, 0x30, 0xc6, 0x17, 0x07,
+  0xec, 0xf0, 0x01, 0x03, 0xf8, 0xeb, 0xcc, 0xc2, 0x1b, 0x15, 0xfa, 0xb4,
+  0x15, 0x24, 0x02, 0x60, 0xfa, 0x2d, 0xec, 0x0e, 0xda, 0xe6, 0xb7, 0x0f,
+  0x05, 0x1b, 0xd9, 0x42, 0x1f, 0xee, 0x18, 0xf5, 0xc0, 0x19, 0x0b, 0x20,
+  0x38, 0xf4, 0x17, 0x2f, 0xfb, 0xc6, 0x16, 0xf4, 0xee, 0xf2, 0xfc, 0x0e,
+  0x0b, 0xe3, 0xea, 0x08, 0xf0, 0x14, 0xd3, 0x0d, 0xd8, 0x07, 0x0c, 0xf7,
+  0x09, 0xdc, 0xdd, 0xe8, 0xe5, 0xf6, 0xfa, 0xe7, 0x31, 0xc9, 0xec, 0x1d,
+  0x0a, 0x0f, 0xf7, 0x13, 0xe0, 0x0a, 0xe3, 0xda, 0x0b, 0xe1, 0x0b, 0xf5,
+  0xf3, 0xfd, 0xf2, 0x23, 0x1b, 0x04, 0xf1, 0xfa, 0x43, 0xd3, 0x18, 0xeb,
+  0xb7, 0x11, 0xfb, 0xcc, 0xfa, 0xf8, 0x1a, 0xe9, 0xde, 0xea, 0x15, 0xde,
+  0x16, 0xfd, 0x07, 0x1e, 0xe1, 0x16, 0x1a, 0x7f, 0xfc, 0xfa, 0xf7, 0x1c,
+  0xd1, 0xdb, 0xbf, 0x0a, 0x05, 0xe3, 0xe2, 0xfe, 0xce, 0xf5, 0xdf, 0xe1,
+  0xea, 0xe3, 0xf4, 0xeb, 0xb5, 0xfd, 0xbe, 0xe7, 0xdb, 0x20, 0xcb, 0xe9,
+  0x1a, 0xea, 0x08, 0x02, 0xec, 0x46, 0x28, 0x04, 0xdf, 0xd5, 0xd1, 0xf2,
+  0x42, 0xff, 0xff, 0x12, 0x25, 0xde, 0x3e, 0xec, 0xcd, 0xe3, 0x2f, 0x0a,
+  0xfe, 0x0d, 0x0b, 0xe7, 0xeb, 0x33, 0x2e, 0x01, 0xfb, 0x1e, 0xec, 0x4f,
+  0xf0, 0x1f, 0x16, 0x04, 0xd9, 0xef, 0xf8, 0xf5, 0x02, 0xd3, 0x19, 0xff,
+  0xeb, 0x12, 0xff, 0x05, 0x00, 0xdd, 0xd4, 0xf5, 0xd6, 0x2f, 0xfc, 0xb5,
+  0xca, 0x21, 0xee, 0xf2, 0xd4, 0xe3, 0xe9, 0xc0, 0xea, 0x31, 0xc8, 0xeb,
+  0x20, 0xd9, 0xe7, 0x1a, 0x1e, 0xe2, 0x17, 0xeb, 0xe8, 0x2b, 0x07, 0x39,
+  0x1f, 0x0d, 0x0d, 0xf2, 0x1b, 0xc9, 0xf4, 0xeb, 0x22, 0x0e, 0x10, 0xe2,
+  0xfd, 0x39, 0xf0, 0x18, 0xfd, 0x0e, 0x3c, 0x11, 0x10, 0xc6, 0xfa, 0xee,
+  0x1b, 0xf5, 0xd3, 0xe0, 0xdb, 0x12, 0xd9, 0x05, 0x23, 0xf5, 0x01, 0x0e,
+  0x0b, 0x32, 0xff, 0x17, 0xdf, 0xe9, 0xfe, 0xe7, 0x08, 0x22, 0x16, 0x32,
+  0xd8, 0xd4, 0xec, 0x1e, 0x17, 0xec, 0xf5, 0x09, 0xf0, 0x33, 0x5f, 0x0a,
+  0xe9, 0x0f, 0x2e, 0xb0, 0x07, 0xff, 0xca, 0x2e, 0xdb, 0xdf, 0x25, 0xcb,
+  0x23, 0xea, 0xdf, 0x08, 0x03, 0x18, 0x13, 0x2d, 0x0a, 0xd6, 0x0a, 0x14,
+  0xce, 0x43, 0x0d, 0x34, 0x04, 0xe9, 0xe4, 0x0a, 0xdb, 0xea, 0xee, 0xd2,
+  0xee, 0xde, 0x16, 0x04, 0x22, 0x18, 0x04, 0x00, 0x14, 0xfc, 0xfe, 0xd6,
+  0x05, 0x29, 0x1b, 0x28, 0x01, 0x08, 0x1b, 0xd7, 0x28, 0x19, 0xc5, 0xe0,
+  0x0a, 0x29, 0xde, 0x0c, 0x03, 0x13, 0x2a, 0xf9, 0x0b, 0xfd, 0xba, 0x1a,
+  0xdf, 0xf2, 0xf3, 0x1a, 0xd5, 0x27, 0x0b, 0x10, 0xee, 0xff, 0x02, 0x15,
+  0xdf, 0xda, 0x08, 0xfe, 0xd3, 0x44, 0x03, 0x11, 0xe8, 0xc3, 0xf1, 0x2f,
+  0xd9, 0x0a, 0x13, 0x00, 0xd6, 0x1a, 0xd8, 0x46, 0xfd, 0x4e, 0x06, 0x12,
+  0xf8, 0x1a, 0x09, 0xf1, 0x3c, 0x1e, 0xd1, 0x16, 0x08, 0x4e, 0x0c, 0x1a,
+  0x00, 0xef, 0xf5, 0xca, 0xec, 0x15, 0xd6, 0x24, 0xd8, 0x13, 0x03, 0x26,
+  0x18, 0x2e, 0xe8, 0xc6, 0xbe, 0x23, 0x05, 0xeb, 0xed, 0x17, 0xc9, 0xe0,
+  0x16, 0x4e, 0x24, 0x1d, 0xec, 0xd9, 0x20, 0xe6, 0xf1, 0xcc, 0x32, 0x47,
+  0xfe, 0xc7, 0x2c, 0x07, 0xfd, 0xf5, 0x16, 0xe7, 0x45, 0x15, 0xe2, 0x19,
+  0x00, 0xdc, 0x0f, 0x39, 0xf3, 0x34, 0x18, 0xd6, 0x13, 0xf3, 0xec, 0x34,
+  0xdb, 0xdc, 0x27, 0x13, 0xf3, 0xfa, 0x1b, 0x15, 0xdf, 0xf2, 0xf5, 0xf9,
+  0x30, 0x12, 0xfa, 0x10, 0xe2, 0x14, 0xc5, 0xcc, 0x03, 0xd9, 0xf0, 0xbe,
+  0xb8, 0x52, 0xb5, 0x3b, 0x14, 0xe2, 0x25, 0xdb, 0x27, 0x0f, 0x1c, 0x38,
+  0xc6, 0x29, 0xf6, 0xe2, 0x25, 0x1a, 0xdf, 0xde, 0x20, 0xfa, 0x0f, 0xd4,
+  0x09, 0x1f, 0xc7, 0xc6, 0x01, 0xe4, 0xd1, 0x01, 0x1f, 0x06, 0x11, 0x97,
+  0x34, 0x1b, 0xff, 0xf8, 0xd6, 0x32, 0x1f, 0x05, 0x16, 0x00, 0xff, 0x10,
+  0x0a, 0x0f, 0x15, 0xfc, 0x3d, 0xcb, 0x2d, 0x03, 0xf6, 0xcd, 0x0a, 0xea,
+  0xe6, 0xfc, 0xa8, 0xe4, 0x08, 0x32, 0x03, 0x4c, 0x00, 0xef, 0x41, 0xa8,
+  0x54, 0x18, 0xdb, 0x20, 0xe3, 0xf4, 0x54, 0x10, 0xf8, 0xcd, 0xfe, 0xd3,
+  0x06, 0x18, 0xf0, 0x42, 0xe2, 0xe6, 0x3a, 0xe6, 0xdd, 0x04, 0xe7, 0x35,
+  0xb1, 0x1b, 0x1c, 0xb0, 0x2c, 0x01, 0xf4, 0xe5, 0xe2, 0x4e, 0x11, 0x20,
+  0xf7, 0x3d, 0x33, 0xd7, 0xa7, 0xdc, 0xea, 0x03, 0xea, 0xd1, 0x07, 0xdf,
+  0x04, 0x21, 0xb8, 0x05, 0xe4, 0x4f, 0xd4, 0xd1, 0xfc, 0xf8, 0xcf, 0x2e,
+  0xf0, 0x1b, 0x2c, 0xcf, 0x46, 0xea, 0xf0, 0xe7, 0x0d, 0x3e, 0x14, 0x32,
+  0x8a, 0xe0, 0x0e, 0x23, 0xd2, 0xf6, 0x08, 0x06, 0x18, 0x1d, 0x2a, 0x56,
+  0x22, 0xed, 0xeb, 0xfc, 0xd4, 0x3e, 0x0c, 0x39, 0x26, 0xca, 0x22, 0xfa,
+  0x0c, 0xc4, 0x36, 0x2f, 0xe2, 0xd8, 0x0d, 0xdd, 0xdf, 0xfe, 0xcc, 0xd6,
+  0x0b, 0x0d, 0xf8, 0xe9, 0x24, 0xf4, 0x10, 0x11, 0x7d, 0x0a, 0x0b, 0xc8,
+  0x50, 0x2d, 0xe9, 0x30, 0x3b, 0xec, 0x0f, 0x3b, 0x0f, 0x1f, 0xc5, 0xec,
+  0xe2, 0x0b, 0xd5, 0xda, 0x13, 0x7f, 0x0e, 0xee, 0xec, 0x01, 0x0e, 0xec,
+  0x1d, 0x12, 0x3d, 0xe0, 0x57, 0xd7, 0xca, 0xed, 0x27, 0x19, 0xc9, 0x06,
+  0x21, 0xfd, 0xc2, 0x02, 0xee, 0x21, 0xf9, 0xd7, 0x23, 0xf8, 0xcc, 0xf0,
+  0xe0, 0x14, 0x21, 0xc1, 0x00, 0xe4, 0x15, 0xbd, 0xfe, 0xfb, 0x2c, 0x30,
+  0x1f, 0x21, 0xbf, 0xdd, 0x0a, 0x2f, 0x01, 0xfa, 0x03, 0x2d, 0xf3, 0x1b,
+  0x15, 0xff, 0xf9, 0xfc, 0xdc, 0x30, 0xf1, 0x19, 0xd7, 0xd8, 0x2f, 0x11,
+  0xd3, 0x11, 0xfe, 0x37, 0xfa, 0x0a, 0x00, 0x0a, 0xdf, 0xdd, 0x0a, 0xd3,
+  0xdc, 0x0c, 0x24, 0xdc, 0x36, 0x15, 0x3a, 0xf5, 0x02, 0x13, 0xee, 0xee,
+  0x2a, 0x29, 0xf6, 0xf8, 0x03, 0xef, 0x3b, 0xf9, 0x27, 0xe1, 0x02, 0xf8,
+  0xe2, 0x15, 0xd1, 0xe9, 0xf0, 0x30, 0xe7, 0x19, 0x18, 0xd7, 0xe1, 0x2b,
+  0xf4, 0x02, 0xfa, 0xf9, 0xf8, 0xec, 0xfd, 0xea, 0xd9, 0x1c, 0xe7, 0x11,
+  0xab, 0x33, 0x36, 0xed, 0xc7, 0xf9, 0x2f, 0xe8, 0x05, 0xfb, 0xc9, 0x37,
+  0x10, 0x1b, 0x1b, 0xfd, 0xdc, 0x0e, 0xef, 0x20, 0xe4, 0xc4, 0xc6, 0x1b,
+  0x46, 0xd4, 0xff, 0x36, 0x16, 0xfa, 0x1f, 0x0a, 0xe1, 0x00, 0xe9, 0xef,
+  0xf3, 0xf9, 0x3f, 0xb6, 0x25, 0x03, 0x1c, 0x4e, 0x3c, 0xe9, 0x00, 0x0a,
+  0x1f, 0x3e, 0xe3, 0x62, 0x36, 0xd5, 0xfa, 0x08, 0xde, 0xc0, 0x15, 0xbb,
+  0x3c, 0x05, 0xee, 0xd4, 0xfb, 0x57, 0x51, 0xfe, 0x05, 0xe2, 0x14, 0xb8,
+  0x48, 0xfe, 0xde, 0xe6, 0x41, 0xf3, 0x1b, 0x02, 0xfe, 0x06, 0xe5, 0x00,
+  0x41, 0xd5, 0xed, 0x15, 0x20, 0xd2, 0x0d, 0xd8, 0xfe, 0xec, 0x06, 0xe0,
+  0xee, 0x08, 0x08, 0xc2, 0xd1, 0xea, 0x50, 0xac, 0x55, 0xde, 0x36, 0x4b,
+  0x25, 0xfd, 0xe7, 0x31, 0x30, 0x2c, 0xeb, 0xd9, 0x15, 0x43, 0xd5, 0x24,
+  0xe1, 0xf1, 0x50, 0xe8, 0xf9, 0x22, 0xde, 0x00, 0xdd, 0xe3, 0xe1, 0x19,
+  0xcb, 0x32, 0x19, 0xc5, 0x07, 0xfe, 0xd3, 0xd4, 0xf8, 0xf2, 0x2a, 0xe8,
+  0x34, 0xd6, 0xea, 0xd2, 0x21, 0x3e, 0x46, 0xfa, 0x0e, 0xf7, 0x0c, 0x11,
+  0x0b, 0x1c, 0x04, 0xce, 0x0e, 0x23, 0xee, 0xe4, 0xdf, 0xd1, 0xc2, 0x08,
+  0xea, 0x2e, 0x16, 0xb5, 0xea, 0x2d, 0xf3, 0x40, 0xfd, 0xee, 0xdd, 0x03,
+  0xd6, 0xe4, 0xf7, 0x25, 0xf7, 0xda, 0x59, 0x93, 0x59, 0xfa, 0xc2, 0x09,
+  0xd7, 0x05, 0xf2, 0xc1, 0xf4, 0xea, 0xd1, 0x29, 0xfa, 0x0b, 0xef, 0x06,
+  0xb9, 0xe5, 0x17, 0x4c, 0xfd, 0xd7, 0xfe, 0xff, 0x19, 0xfd, 0xd8, 0xc4,
+  0x1c, 0xf5, 0xc7, 0xcf, 0xd9, 0x10, 0x00, 0x2f, 0x2a, 0xea, 0x2b, 0x31,
+  0xf0, 0x02, 0xf8, 0x37, 0x09, 0x24, 0x15, 0x2f, 0x00, 0x18, 0xfc, 0xed,
+  0xe2, 0xc2, 0xe0, 0xf9, 0xeb, 0xe8, 0xfe, 0xf6, 0x1b, 0x1f, 0x04, 0x15,
+  0x19, 0x14, 0x20, 0xe1, 0xff, 0x11, 0x0c, 0xcb, 0xe5, 0xf6, 0xfb, 0x24,
+  0xf4, 0x12, 0xec, 0xd4, 0xca, 0x19, 0xc9, 0x25, 0xd3, 0xe4, 0xde, 0x1b,
+  0x26, 0xcd, 0xf1, 0xcd, 0xef, 0x76, 0xde, 0x1b, 0x0e, 0xf4, 0xc4, 0xeb,
+  0xcd, 0xf6, 0xff, 0xd6, 0x12, 0xd5, 0xdf, 0x46, 0x0e, 0xfc, 0x12, 0x0c,
+  0xe8, 0xe8, 0x27, 0xf3, 0xe5, 0xe4, 0xee, 0x3f, 0x00, 0xdd, 0xe7, 0x2a,
+  0x36, 0x08, 0xdf, 0x17, 0xe0, 0x02, 0x13, 0xfe, 0xf5, 0x1c, 0xfd, 0xc9,
+  0x28, 0x1f, 0xd5, 0x34, 0x29, 0x0a, 0x16, 0xe7, 0x03, 0x03, 0xbd, 0x0f,
+  0xf5, 0x08, 0xe1, 0x15, 0xf2, 0xdc, 0x06, 0xeb, 0xec, 0x37, 0x0b, 0x01,
+  0x07, 0x05, 0x18, 0x04, 0x37, 0xd8, 0xc1, 0x02, 0x16, 0xf1, 0xfe, 0x31,
+  0xff, 0xf6, 0xf5, 0xda, 0xfe, 0xd7, 0x13, 0xf1, 0x1b, 0xf0, 0xf9, 0x13,
+  0xf7, 0xe9, 0x44, 0xf4, 0x0e, 0x18, 0xf0, 0x09, 0x19, 0x05, 0x0e, 0xe6,
+  0xf9, 0xf4, 0xeb, 0xfd, 0xf6, 0xe8, 0xe6, 0xfd, 0x04, 0xf2, 0xec, 0x24,
+  0xb4, 0xf2, 0xc8, 0x07, 0xbe, 0xd3, 0x07, 0xe7, 0x24, 0xcf, 0xdc, 0x07,
+  0xe0, 0xe2, 0xe2, 0x11, 0x27, 0xfc, 0x1e, 0x98, 0xfc, 0x1b, 0x27, 0x1b,
+  0xc9, 0xfa, 0xde, 0xf1, 0xff, 0x1d, 0x00, 0x69, 0x3d, 0x46, 0x1a, 0x26,
+  0x17, 0xff, 0x0a, 0xe9, 0xf4, 0x13, 0xf8, 0xe6, 0xf0, 0x07, 0x0f, 0x05,
+  0xd1, 0x03, 0x09, 0xeb, 0x0c, 0xc7, 0x15, 0x28, 0x16, 0x07, 0x22, 0x0b,
+  0xf8, 0xf5, 0xef, 0xea, 0xb7, 0x03, 0xc7, 0xfb, 0xc7, 0xfd, 0xef, 0x16,
+  0x17, 0xd1, 0x03, 0x0e, 0xdf, 0x6c, 0xd8, 0x10, 0x39, 0x00, 0x17, 0xc2,
+  0xf7, 0xea, 0xfa, 0xce, 0x10, 0xf8, 0xe3, 0xdf, 0x1e, 0xfa, 0x01, 0x33,
+  0xfa, 0x08, 0x0f, 0x31, 0x4e, 0xf0, 0xfb, 0xf6, 0x16, 0x15, 0xf4, 0x22,
+  0xf5, 0xb8, 0xf9, 0x16, 0x03, 0xdb, 0xc4, 0x48, 0x18, 0x15, 0x1c, 0x0e,
+  0x17, 0x0d, 0xf2, 0x1a, 0x06, 0x25, 0xf9, 0xf0, 0x12, 0xfe, 0xfb, 0xf9,
+  0x0f, 0xe6, 0xf6, 0x02, 0xf4, 0xe2, 0x0e, 0xeb, 0xd9, 0x5b, 0xe2, 0xe0,
+  0xfd, 0xf5, 0x15, 0x0a, 0x38, 0xd1, 0xfd, 0xdc, 0x0f, 0xfe, 0x21, 0xdf,
+  0x1e, 0xef, 0xdc, 0xea, 0xcc, 0xf4, 0xf2, 0x37, 0x31, 0x06, 0x02, 0xfb,
+  0x13, 0x32, 0x3a, 0xdd, 0x07, 0xfc, 0x17, 0x09, 0x01, 0x25, 0xa6, 0x04,
+  0xff, 0xe7, 0x0f, 0x1f, 0x04, 0xeb, 0x08, 0xd7, 0xde, 0x3f, 0xc5, 0xf1,
+  0xd1, 0x15, 0x2a, 0x00, 0xd0, 0x19, 0x32, 0xc3, 0xe3, 0xc3, 0xf0, 0x1a,
+  0x29, 0xe7, 0x1b, 0xe6, 0x0b, 0xf5, 0xf7, 0x83, 0xdb, 0x16, 0xbe, 0xfb,
+  0xff, 0x13, 0xee, 0xe2, 0x06, 0x06, 0x08, 0xf8, 0x2f, 0x19, 0x0d, 0x2d,
+  0xde, 0x2c, 0xf7, 0x1a, 0xe8, 0x0e, 0xed, 0x06, 0xf6, 0x1b, 0xf8, 0xea,
+  0x22, 0x06, 0xf2, 0xf1, 0xff, 0xf4, 0xf4, 0x35, 0xf5, 0x06, 0x28, 0xbc,
+  0x20, 0x28, 0xc5, 0x1c, 0xb2, 0x05, 0xea, 0x1a, 0x05, 0x15, 0x11, 0x1d,
+  0x08, 0x1a, 0x18, 0x13, 0x1f, 0x04, 0x02, 0xe1, 0x11, 0xe7, 0xd1, 0xd0,
+  0xf3, 0xff, 0xd6, 0x1b, 0xe5, 0xeb, 0x46, 0xdb, 0xfe, 0x20, 0xfb, 0xf3,
+  0xda, 0xfd, 0x13, 0x4a, 0x03, 0x2b, 0xec, 0xe6, 0x12, 0x2c, 0x14, 0x01,
+  0xf2, 0xe0, 0xf5, 0xda, 0x7f, 0xdd, 0xac, 0x0f, 0x01, 0xe7, 0xf2, 0x0d,
+  0xab, 0xff, 0x10, 0x0f, 0x20, 0x0c, 0xd2, 0x2d, 0xdc, 0x14, 0x28, 0xf7,
+  0x20, 0xf6, 0x03, 0x1d, 0xf4, 0xf8, 0x3b, 0xd9, 0x37, 0xda, 0x13, 0xe5,
+  0xf8, 0xf6, 0xee, 0xf8, 0xfc, 0xc8, 0xc3, 0xef, 0x0d, 0xee, 0x14, 0xf6,
+  0xe5, 0xf0, 0x0e, 0x07, 0xec, 0x01, 0x32, 0x20, 0x02, 0xee, 0x02, 0x00,
+  0x0d, 0x39, 0x12, 0xdf, 0xc3, 0x29, 0x31, 0xef, 0x15, 0x25, 0xa5, 0x05,
+  0x10, 0x97, 0xce, 0x08, 0x10, 0xc4, 0xe4, 0x30, 0xf3, 0xf5, 0xc6, 0xfc,
+  0xf6, 0xcb, 0x03, 0xc9, 0x00, 0xf3, 0xcd, 0x1d, 0xf2, 0xea, 0x2a, 0x05,
+  0x10, 0xf8, 0xd2, 0xff, 0xd8, 0x06, 0x1e, 0x30, 0x3d, 0xc4, 0xef, 0x16,
+  0x08, 0x3d, 0xc9, 0xf3, 0x2a, 0xe0, 0x05, 0x08, 0xc9, 0x14, 0x31, 0xe0,
+  0x3c, 0x17, 0x35, 0xe2, 0x18, 0x02, 0x1f, 0xe6, 0x19, 0xe3, 0x3c, 0x33,
+  0x0a, 0xc3, 0xf7, 0xc3, 0x1e, 0xa3, 0xe9, 0x20, 0x3e, 0xca, 0xdc, 0x43,
+  0x26, 0x11, 0xdd, 0xff, 0xc9, 0xea, 0xda, 0x3c, 0xef, 0xdf, 0xfd, 0x29,
+  0xf2, 0x22, 0x38, 0xf5, 0x32, 0x0a, 0x4e, 0x14, 0xfd, 0xff, 0x02, 0x23,
+  0xf6, 0xfb, 0x17, 0x31, 0xd5, 0xf9, 0xfa, 0x18, 0xd3, 0xd1, 0xe6, 0x02,
+  0xed, 0x25, 0x09, 0xe1, 0x2b, 0x58, 0x30, 0xaf, 0x1e, 0xe9, 0x1c, 0xb8,
+  0x36, 0x1d, 0x25, 0x48, 0xe7, 0x18, 0xef, 0xc6, 0x0d, 0xe3, 0x05, 0x1a,
+  0x06, 0xaf, 0x0e, 0x7f, 0xab, 0xcf, 0xc0, 0xe9, 0x10, 0x22, 0xe0, 0xff,
+  0xe2, 0xfa, 0xce, 0xdb, 0x08, 0x2a, 0x2d, 0x12, 0x02, 0xd7, 0xd1, 0xe1,
+  0xea, 0x23, 0x25, 0xda, 0xed, 0xef, 0xd8, 0x29, 0xea, 0x07, 0xe1, 0x1a,
+  0xce, 0x19, 0xf3, 0xfd, 0xcd, 0x11, 0xf7, 0x09, 0x27, 0xd4, 0x08, 0xdf,
+  0x27, 0x20, 0x10, 0xe9, 0xf7, 0x1e, 0x62, 0xf2, 0x13, 0xb1, 0x1e, 0xdc,
+  0xe9, 0x13, 0x1f, 0xf2, 0xf7, 0x28, 0xe1, 0xe5, 0xf4, 0x43, 0xe2, 0x20,
+  0x27, 0xde, 0xcf, 0xe0, 0x06, 0xcf, 0xeb, 0x1e, 0xd2, 0x10, 0xf4, 0x0f,
+  0x12, 0x1b, 0xd7, 0x01, 0x05, 0xe6, 0xe6, 0xbe, 0xdc, 0x13, 0xf8, 0xf1,
+  0x02, 0x18, 0xbf, 0xad, 0x1d, 0xf8, 0x00, 0x18, 0xfb, 0x20, 0x0b, 0x22,
+  0x3c, 0xfa, 0x08, 0xf4, 0x2f, 0x3d, 0x26, 0x1f, 0xeb, 0xdb, 0xd6, 0xe8,
+  0xfd, 0xf3, 0xdc, 0x1e, 0xfe, 0x03, 0x1e, 0xf2, 0xf8, 0x0b, 0xd2, 0x33,
+  0xec, 0x37, 0xf8, 0x28, 0xfd, 0xf3, 0xc5, 0x30, 0xcb, 0xd0, 0x18, 0x0b,
+  0xe5, 0x12, 0x0e, 0xf8, 0xde, 0xde, 0x2a, 0xe7, 0x0a, 0x03, 0xdd, 0x12,
+  0xc2, 0xf6, 0x12, 0x0a, 0xfe, 0x20, 0x12, 0xe9, 0x02, 0xf9, 0xf5, 0xed,
+  0xdf, 0x3b, 0x07, 0x2e, 0x14, 0xfb, 0xf5, 0xb8, 0x46, 0x2b, 0x21, 0xe9,
+  0xfe, 0xe3, 0xc9, 0x2b, 0x3b, 0x2d, 0xe1, 0x67, 0x06, 0x18, 0x29, 0x11,
+  0x3d, 0x3a, 0xff, 0x3a, 0xda, 0xfe, 0x1e, 0x39, 0x03, 0x19, 0xd2, 0x2c,
+  0xd1, 0xe3, 0x02, 0xc1, 0xe7, 0xef, 0x24, 0xda, 0xea, 0xe3, 0x1d, 0xe4,
+  0x05, 0x47, 0xdd, 0xc1, 0xe6, 0xe0, 0xf9, 0x1a, 0x1a, 0x1c, 0xfb, 0xe3,
+  0x02, 0xee, 0xdf, 0x07, 0x93, 0xf6, 0xfa, 0x1a, 0xea, 0xec, 0xfb, 0x0a,
+  0x2c, 0x07, 0x16, 0xe9, 0xc4, 0xe7, 0x05, 0xf1, 0xf6, 0xee, 0xf7, 0x3f,
+  0x0d, 0x41, 0x12, 0xd9, 0xea, 0x04, 0x0f, 0xc1, 0xf1, 0x5e, 0xd7, 0x05,
+  0x26, 0x01, 0xcb, 0x07, 0xfc, 0xdd, 0xe1, 0x08, 0xe3, 0x1d, 0xd6, 0xf5,
+  0x29, 0x42, 0x21, 0x2d, 0xf8, 0xcd, 0x29, 0xc6, 0xed, 0xec, 0xe6, 0x18,
+  0x35, 0xe9, 0xeb, 0xd3, 0x14, 0x11, 0x07, 0xbe, 0x1a, 0xc0, 0xf8, 0x0d,
+  0x2d, 0x17, 0xee, 0x01, 0x16, 0xf4, 0x12, 0xd0, 0xb9, 0x07, 0x0d, 0xd8,
+  0x0b, 0xf1, 0xbb, 0x06, 0xfe, 0x02, 0xea, 0xf8, 0xff, 0xe0, 0xdf, 0xe7,
+  0xef, 0x5c, 0xae, 0x02, 0x42, 0xfe, 0xd5, 0x13, 0xcb, 0x03, 0xd6, 0x23,
+  0x0d, 0x1a, 0xf6, 0xd4, 0x27, 0x1c, 0x5f, 0x03, 0x05, 0xeb, 0x17, 0xef,
+  0xec, 0x21, 0x17, 0xfa, 0x24, 0xdb, 0xd6, 0x05, 0xf9, 0x01, 0x25, 0xc1,
+  0x14, 0x23, 0xf7, 0x1a, 0x19, 0x02, 0xe3, 0xef, 0xe2, 0x05, 0x31, 0xe2,
+  0xe2, 0x18, 0x20, 0x27, 0x11, 0xfe, 0xdc, 0x1f, 0x16, 0xe8, 0x07, 0xfb,
+  0x14, 0x0c, 0x00, 0x0b, 0x12, 0x2b, 0x13, 0xdd, 0x45, 0x16, 0xd3, 0x36,
+  0xf7, 0x13, 0x0d, 0x04, 0x2b, 0x0c, 0x30, 0xda, 0x06, 0xf8, 0x0c, 0xf4,
+  0x07, 0x0f, 0x22, 0xa4, 0x23, 0xfd, 0x0a, 0x21, 0x0f, 0x11, 0x03, 0x1a,
+  0x03, 0x30, 0xf0, 0x21, 0x00, 0x34, 0xe1, 0x13, 0xd4, 0x29, 0xec, 0x05,
+  0x06, 0xe4, 0x16, 0x17, 0xb2, 0x04, 0x2f, 0x21, 0xb4, 0x22, 0xff, 0x3a,
+  0xd7, 0xe4, 0xda, 0x0b, 0xe2, 0xa0, 0xdb, 0xef, 0x68, 0x35, 0xf0, 0xd9,
+  0xf5, 0x34, 0x19, 0x02, 0xd6, 0xfb, 0x00, 0x2c, 0xfe, 0x31, 0xf7, 0x39,
+  0x20, 0x16, 0x22, 0x02, 0x15, 0xf2, 0xf1, 0x27, 0x62, 0xe5, 0x02, 0x26,
+  0xec, 0xc0, 0x15, 0x0f, 0xc9, 0xd0, 0xf9, 0x5e, 0x4b, 0xf8, 0x14, 0xf4,
+  0xfc, 0xbb, 0xb4, 0xde, 0xe0, 0xf9, 0xf0, 0xc7, 0xe2, 0x68, 0x01, 0x34,
+  0x11, 0xd4, 0x02, 0xf4, 0xda, 0xd6, 0xf8, 0x29, 0xee, 0xcd, 0xef, 0x0a,
+  0xed, 0x17, 0x28, 0xb2, 0xcd, 0x0c, 0x2b, 0x17, 0xc4, 0x39, 0xf5, 0x4c,
+  0xd3, 0x51, 0x1b, 0xfc, 0x21, 0x20, 0xec, 0xd2, 0xfd, 0x07, 0x0a, 0x17,
+  0x08, 0xeb, 0xcb, 0xb3, 0x29, 0xcf, 0x27, 0x0b, 0x1e, 0x37, 0x55, 0x2a,
+  0x21, 0x00, 0xcf, 0xe5, 0xdd, 0xd8, 0xc7, 0xe6, 0xcb, 0xc0, 0xef, 0x0b,
+  0xd0, 0x24, 0x06, 0x10, 0xeb, 0xa9, 0x0a, 0xe1, 0xbc, 0x32, 0xdb, 0x29,
+  0xb1, 0xdb, 0xcf, 0x49, 0xe5, 0x01, 0xe3, 0xe4, 0xf4, 0x33, 0xea, 0xeb,
+  0xf2, 0x12, 0x22, 0xbd, 0x0f, 0xfc, 0x4a, 0xe5, 0x22, 0x14, 0xe8, 0xe9,
+  0x42, 0xfe, 0x5b, 0x42, 0x04, 0xe9, 0xf5, 0x02, 0x13, 0xec, 0xe6, 0x32,
+  0x3a, 0xef, 0x27, 0xcd, 0x0c, 0xf7, 0xed, 0x2c, 0xe0, 0xc8, 0x95, 0x1c,
+  0xc4, 0x2a, 0xff, 0x61, 0x09, 0x6c, 0xa5, 0x0c, 0xfd, 0x13, 0xcf, 0xfa,
+  0x0a, 0x0f, 0x01, 0xbf, 0x08, 0x95, 0x2d, 0x47, 0x23, 0x18, 0xc1, 0x51,
+  0x04, 0x3a, 0x29, 0xec, 0x20, 0xed, 0xe4, 0xdb, 0xd9, 0xf0, 0x25, 0xfb,
+  0xda, 0x27, 0xe4, 0xd1, 0xf0, 0x10, 0xbf, 0x82, 0x02, 0x07, 0x14, 0x03,
+  0xe8, 0x1f, 0x02, 0x19, 0xeb, 0x1f, 0x62, 0x3f, 0x49, 0xf2, 0xff, 0x42,
+  0x38, 0xe6, 0x08, 0x1d, 0x32, 0xdf, 0x00, 0xad, 0xe7, 0x13, 0x44, 0x58,
+  0xe9, 0xda, 0xe3, 0x03, 0xec, 0xd4, 0x21, 0xe5, 0xd9, 0xc5, 0x0b, 0x07,
+  0x01, 0xdc, 0xf9, 0x2e, 0x9d, 0x0a, 0x19, 0x1e, 0x25, 0xf7, 0xeb, 0xdf,
+  0xe4, 0xca, 0x16, 0xa2, 0xd9, 0x43, 0xc0, 0xdd, 0xd2, 0x05, 0xe3, 0x0e,
+  0xd7, 0xc8, 0x2e, 0x02, 0xd8, 0x24, 0x28, 0xfd, 0xd5, 0x4b, 0x2d, 0xb5,
+  0xe6, 0x24, 0x0f, 0xf8, 0xe0, 0x16, 0x23, 0xeb, 0x30, 0xcf, 0x30, 0xfd,
+  0xea, 0xe7, 0x49, 0xd6, 0x14, 0xab, 0xec, 0x00, 0xd1, 0xf1, 0xfa, 0xda,
+  0xd8, 0xe5, 0xde, 0x0b, 0xfa, 0x52, 0xfe, 0xfd, 0xe1, 0x19, 0x29, 0xe4,
+  0x7f, 0xf2, 0xdc, 0x16, 0xe4, 0xde, 0x11, 0xb3, 0x06, 0xf6, 0xd3, 0x32,
+  0xd2, 0xbc, 0xd1, 0xfa, 0x28, 0x03, 0x2d, 0xe7, 0xc4, 0xf5, 0x2e, 0xe9,
+  0xd6, 0x1a, 0x2b, 0x13, 0x0d, 0xf4, 0x20, 0x15, 0xf9, 0x53, 0xda, 0xe2,
+  0x07, 0x02, 0xdf, 0x60, 0x18, 0xf6, 0x1c, 0xf8, 0xde, 0x57, 0xa1, 0x04,
+  0x3a, 0x0f, 0xbb, 0x04, 0xf9, 0xda, 0x44, 0x5f, 0xf1, 0x57, 0xee, 0x2a,
+  0x43, 0xf9, 0x4d, 0xf6, 0x5d, 0x8a, 0xe3, 0xf6, 0xc9, 0x55, 0xf1, 0xfc,
+  0xf6, 0x0b, 0xe1, 0x98, 0xf6, 0x0d, 0xc3, 0x92, 0xda, 0x35, 0xf4, 0xe7,
+  0x00, 0x1c, 0x16, 0xd3, 0xeb, 0xc3, 0x19, 0x3b, 0x01, 0xc3, 0x48, 0x47,
+  0x17, 0xbd, 0xeb, 0xfb, 0x31, 0x38, 0xad, 0x0d, 0xfb, 0xf4, 0xda, 0x30,
+  0xe0, 0xcb, 0xf9, 0xef, 0x36, 0x30, 0xe4, 0xe3, 0xdc, 0x11, 0x16, 0x00,
+  0x2f, 0x30, 0xf4, 0xf9, 0x64, 0x0f, 0x4b, 0x2f, 0x12, 0xcc, 0xe5, 0xd9,
+  0x36, 0x50, 0x2f, 0xd7, 0xff, 0xdf, 0xfb, 0x09, 0xb9, 0xec, 0xb3, 0xec,
+  0x22, 0xee, 0x0e, 0x08, 0xd3, 0xfc, 0x3b, 0xcc, 0xe4, 0xe1, 0x06, 0x19,
+  0xa7, 0xf4, 0xff, 0x2a, 0xf9, 0xec, 0x12, 0x33, 0x54, 0x36, 0x0f, 0x39,
+  0x0a, 0xf7, 0x12, 0x01, 0x19, 0xc2, 0xe6, 0xb3, 0x4d, 0x1e, 0x3d, 0xe9,
+  0x0d, 0xef, 0x15, 0xf6, 0x2c, 0x3d, 0x1d, 0xd8, 0x2e, 0xe3, 0x0f, 0xe5,
+  0x2d, 0xd9, 0xca, 0xf6, 0x10, 0x19, 0x12, 0xf1, 0xf8, 0xee, 0xec, 0x03,
+  0xb1, 0xf1, 0xae, 0xb8, 0x2f, 0x20, 0xd4, 0xe5, 0xbb, 0xf9, 0x73, 0xd5,
+  0xcb, 0x0e, 0x04, 0x50, 0x0b, 0xc2, 0x2e, 0x4f, 0xe1, 0x1d, 0x07, 0x36,
+  0x48, 0xff, 0xc0, 0x28, 0x07, 0xa8, 0x4c, 0x30, 0xd8, 0xec, 0xcb, 0xe9,
+  0x2b, 0x0e, 0x1e, 0x25, 0x00, 0xb7, 0x97, 0xea, 0xe9, 0x37, 0xd2, 0x49,
+  0x0d, 0x0f, 0xcd, 0x16, 0xdd, 0x1e, 0x03, 0x1d, 0x22, 0xd8, 0xca, 0xff,
+  0xc6, 0x0f, 0x2d, 0x13, 0x37, 0xec, 0xf3, 0x54, 0xec, 0xcf, 0x2d, 0xfe,
+  0x2f, 0xb1, 0xeb, 0xfe, 0xe0, 0xe5, 0xed, 0x4a, 0x1b, 0xdf, 0x3a, 0x09,
+  0xfa, 0x10, 0xf8, 0xa4, 0x03, 0xfe, 0x2a, 0x3a, 0xdc, 0xe3, 0xe1, 0x1c,
+  0x04, 0xe3, 0xfd, 0x00, 0x06, 0xf5, 0xf5, 0xe9, 0xfa, 0xf8, 0xf9, 0x0f,
+  0xd2, 0x18, 0x00, 0x2d, 0x68, 0x08, 0xde, 0xb7, 0xe0, 0xec, 0xf6, 0xf7,
+  0xf5, 0x00, 0x0e, 0xf6, 0xdc, 0x0f, 0x63, 0xf1, 0x19, 0x07, 0xd4, 0xec,
+  0xde, 0x39, 0x14, 0xca, 0x08, 0x31, 0x52, 0x8d, 0xea, 0xd5, 0x11, 0x7d,
+  0x42, 0xeb, 0x33, 0x02, 0xed, 0x18, 0xff, 0xca, 0x24, 0x10, 0x3c, 0x0b,
+  0x14, 0x00, 0x02, 0xdf, 0x1a, 0xe7, 0xde, 0xf4, 0xc0, 0x22, 0xf5, 0x16,
+  0x14, 0xec, 0x11, 0x08, 0xd8, 0x40, 0xef, 0x0f, 0x52, 0xec, 0xef, 0xf9,
+  0xe1, 0xe2, 0x00, 0xcb, 0xb5, 0x03, 0x22, 0xbc, 0x13, 0x10, 0x35, 0xfd,
+  0x08, 0xdf, 0xf5, 0x21, 0xa5, 0x2a, 0xee, 0xff, 0xc9, 0x28, 0x35, 0xda,
+  0x00, 0xf3, 0x17, 0xbb, 0xb5, 0xe8, 0xff, 0xe0, 0xf5, 0xfd, 0xca, 0x0d,
+  0x0b, 0x0a, 0x06, 0x5e, 0x33, 0x28, 0x07, 0xf5, 0x33, 0xe8, 0xd5, 0xfb,
+  0x25, 0x08, 0x23, 0xfa, 0x06, 0x17, 0x22, 0xb4, 0xee, 0xe3, 0xc8, 0x49,
+  0x41, 0xdb, 0xed, 0xa3, 0x10, 0x11, 0xff, 0x28, 0xfb, 0xad, 0xaa, 0xd4,
+  0xf7, 0xf9, 0x01, 0x30, 0xee, 0x02, 0x02, 0x1f, 0xe8, 0xc4, 0x21, 0xc9,
+  0xfb, 0xfa, 0xe0, 0xb6, 0x06, 0xe8, 0xe6, 0xcb, 0x0a, 0x1a, 0x28, 0x11,
+  0xeb, 0xe5, 0x11, 0xc3, 0xfc, 0xe9, 0x07, 0xf8, 0x17, 0xec, 0xf6, 0x56,
+  0x36, 0xf6, 0x22, 0xfc, 0xeb, 0xe0, 0xe7, 0x00, 0xf2, 0x46, 0x38, 0xdc,
+  0x0a, 0x2c, 0xf8, 0x12, 0x09, 0x11, 0xcb, 0xc1, 0x04, 0xc9, 0x28, 0x17,
+  0xe9, 0x08, 0xff, 0xcc, 0x1f, 0xed, 0x36, 0xf1, 0xf1, 0xf7, 0xf2, 0x09,
+  0xfe, 0xe6, 0x29, 0x97, 0xe4, 0x14, 0xe8, 0x81, 0x04, 0xc2, 0x18, 0xe9,
+  0x0d, 0x02, 0xf5, 0x0d, 0x37, 0x01, 0xeb, 0x08, 0x2c, 0xc8, 0xd2, 0xce,
+  0x4b, 0xfa, 0x07, 0xe1, 0x21, 0xe8, 0x08, 0xcc, 0xb8, 0xfc, 0xd8, 0xd7,
+  0xdd, 0x11, 0x1d, 0x36, 0x1a, 0x18, 0xb4, 0x0f, 0x1f, 0x30, 0xdb, 0x0e,
+  0xf6, 0xd4, 0x34, 0xe0, 0xc7, 0x1a, 0x01, 0xea, 0x3e, 0xf5, 0x3b, 0x27,
+  0x05, 0xd7, 0xd0, 0xd5, 0x0a, 0x29, 0x07, 0xc7, 0xe0, 0x1b, 0x20, 0xe2,
+  0xf9, 0x05, 0x2d, 0xfd, 0x3c, 0xa9, 0xcc, 0xf2, 0x05, 0x12, 0x35, 0x15,
+  0x1f, 0x16, 0xcd, 0xee, 0x37, 0x12, 0x21, 0x1d, 0x2f, 0xe7, 0xef, 0xd1,
+  0x54, 0x20, 0x20, 0xd9, 0xe3, 0x2b, 0x35, 0xa4, 0xfb, 0x03, 0x0f, 0x23,
+  0x00, 0x0c, 0xf3, 0xaf, 0x1e, 0xdb, 0x46, 0xea, 0x10, 0x1a, 0xe9, 0xf0,
+  0x39, 0xce, 0xfd, 0x3c, 0xef, 0x00, 0x27, 0xc7, 0xec, 0xea, 0x36, 0x03,
+  0xd5, 0x07, 0xa9, 0xd6, 0x35, 0xe8, 0x03, 0x23, 0x9c, 0x12, 0x43, 0xda,
+  0x5b, 0xc3, 0xfd, 0xff, 0xb5, 0xfe, 0xda, 0xe9, 0x3f, 0x13, 0xe7, 0xdf,
+  0x6f, 0x26, 0x6e, 0x67, 0x74, 0x18, 0xf2, 0x15, 0xf4, 0x2c, 0x14, 0xcd,
+  0x09, 0xfc, 0xe0, 0xd9, 0xf1, 0x57, 0xf3, 0xc7, 0x2c, 0xfc, 0x3a, 0xfc,
+  0xfd, 0x08, 0x15, 0x1c, 0x43, 0x09, 0x21, 0xfd, 0xf6, 0xe0, 0x21, 0xc1,
+  0x01, 0xc6, 0x2f, 0xd2, 0x02, 0xd0, 0xd8, 0xd1, 0x14, 0xf8, 0xff, 0xc2,
+  0xd3, 0x11, 0x05, 0xf3, 0x31, 0xde, 0xfd, 0xb5, 0xa4, 0xf4, 0x1b, 0xc4,
+  0x4c, 0x0b, 0x05, 0xf2, 0x63, 0x62, 0x36, 0x0e, 0xf3, 0xf1, 0xf7, 0xdc,
+  0xdd, 0xbc, 0x3e, 0x3a, 0xf6, 0xd7, 0xb2, 0xee, 0x8c, 0x0b, 0xd4, 0xeb,
+  0x50, 0x11, 0x43, 0x2f, 0xc7, 0x2a, 0x15, 0xff, 0x6c, 0x0f, 0xe6, 0xef,
+  0xef, 0xeb, 0x2f, 0x95, 0x2a, 0x04, 0x19, 0xcf, 0x37, 0xaa, 0xf2, 0x35,
+  0x12, 0x2a, 0x14, 0xc9, 0x12, 0xda, 0xc1, 0xd5, 0xfc, 0x17, 0x3d, 0xcd,
+  0xd6, 0x39, 0xd7, 0xde, 0x2c, 0x2a, 0xf1, 0x13, 0x45, 0x46, 0xff, 0x14,
+  0x35, 0xca, 0x0a, 0x05, 0x5f, 0x08, 0x2e, 0x2d, 0x12, 0xea, 0x33, 0xf1,
+  0xdc, 0x31, 0xf4, 0xee, 0x0e, 0xe4, 0xed, 0x1c, 0xe9, 0x06, 0xd4, 0x1e,
+  0xda, 0xdb, 0x32, 0x03, 0x05, 0x15, 0xf0, 0xf9, 0x29, 0x34, 0x04, 0x02,
+  0x00, 0x29, 0xd5, 0xf0, 0xf3, 0xd7, 0xfc, 0xe1, 0xea, 0x14, 0x11, 0xa8,
+  0xbb, 0x2c, 0x22, 0x03, 0xf1, 0xc3, 0x55, 0x33, 0xf0, 0x04, 0x20, 0x17,
+  0x22, 0x56, 0x20, 0x2e, 0x07, 0x19, 0xc8, 0x04, 0x29, 0xe5, 0x1a, 0xf7,
+  0xff, 0xf4, 0x01, 0xbe, 0x19, 0xeb, 0xc7, 0xd4, 0x19, 0xb3, 0xf1, 0x09,
+  0x0d, 0x04, 0x92, 0x03, 0xe7, 0x1b, 0xdf, 0x01, 0x62, 0xc5, 0xcb, 0xff,
+  0x2b, 0x07, 0xbd, 0xf2, 0xf6, 0x5b, 0x0d, 0xdc, 0xee, 0xbc, 0xf0, 0x46,
+  0xfb, 0xe2, 0x02, 0x18, 0xf7, 0x21, 0xd3, 0x27, 0xeb, 0x18, 0x4f, 0x17,
+  0x14, 0xf0, 0x12, 0xe1, 0xeb, 0x35, 0x11, 0xf5, 0xe6, 0xfd, 0xe9, 0xf7,
+  0xe7, 0xdc, 0xc9, 0xe4, 0xdf, 0xeb, 0x1a, 0x3d, 0xc0, 0xf5, 0xc2, 0x9a,
+  0x17, 0xcc, 0x17, 0xf1, 0x0e, 0xd4, 0xea, 0xf8, 0x02, 0x62, 0x0c, 0x07,
+  0x16, 0xf3, 0xf7, 0x23, 0x08, 0x14, 0xba, 0xf5, 0x16, 0x14, 0xe8, 0xe0,
+  0x01, 0xa9, 0x00, 0x20, 0xb3, 0x05, 0x04, 0x19, 0xed, 0xcd, 0xb3, 0x20,
+  0xce, 0x5e, 0x1c, 0x32, 0x19, 0x07, 0x2c, 0xef, 0xf2, 0x5c, 0xc2, 0x26,
+  0xf0, 0xf0, 0x04, 0x00, 0x45, 0xcd, 0xe4, 0xe1, 0xe2, 0xaf, 0x08, 0xf0,
+  0x18, 0x0a, 0x29, 0x12, 0x0b, 0x0e, 0x23, 0x03, 0xe2, 0xdd, 0x0d, 0xff,
+  0x23, 0xf4, 0xe2, 0x2a, 0xd2, 0xca, 0xf0, 0xea, 0xca, 0xcb, 0xed, 0x24,
+  0xfb, 0xc2, 0x24, 0x00, 0x04, 0xc7, 0x1a, 0xda, 0xe8, 0xeb, 0xe4, 0xea,
+  0xce, 0x1a, 0xbc, 0xee, 0xd8, 0xd2, 0x12, 0x16, 0xeb, 0x18, 0x06, 0x4d,
+  0xec, 0xee, 0x22, 0xfb, 0xed, 0x1d, 0xe6, 0x2b, 0x1c, 0x0b, 0xf0, 0xe2,
+  0xb9, 0xde, 0xf1, 0xd3, 0xfd, 0xe5, 0x0f, 0x16, 0x2d, 0xc4, 0xfb, 0x05,
+  0x2b, 0xea, 0xce, 0x1e, 0xf3, 0xec, 0xb7, 0x2d, 0x3f, 0xc0, 0xe6, 0x1f,
+  0xd8, 0xc9, 0x14, 0xfc, 0x0b, 0xf9, 0x2f, 0xf3, 0x0c, 0x0f, 0x1a, 0xe5,
+  0x07, 0xc8, 0x01, 0x0c, 0xc8, 0xd3, 0x10, 0x03, 0xe9, 0x17, 0x2a, 0x38,
+  0xf2, 0xb7, 0xd0, 0x58, 0x16, 0xf6, 0x39, 0x0e, 0xef, 0xe1, 0x24, 0x24,
+  0xf8, 0xf9, 0xbe, 0xc1, 0xfa, 0x38, 0xff, 0x43, 0xf3, 0x12, 0xea, 0x08,
+  0x0a, 0xcb, 0x49, 0x1c, 0xf1, 0xeb, 0x09, 0xf6, 0xe6, 0x0c, 0xf7, 0xfc,
+  0x1e, 0x04, 0x1f, 0x37, 0xe1, 0x08, 0xed, 0xe4, 0x45, 0xde, 0xd0, 0xc4,
+  0xf2, 0xd3, 0xe6, 0xb8, 0xe2, 0xfc, 0xf3, 0xea, 0xe3, 0xed, 0xf3, 0x0a,
+  0xdf, 0xfd, 0xfd, 0xfa, 0x07, 0xfc, 0x12, 0x2d, 0xe0, 0xf9, 0x12, 0x06,
+  0xfd, 0xba, 0xee, 0xd7, 0x3f, 0x05, 0xd1, 0xf8, 0xfe, 0xd3, 0x01, 0x22,
+  0x15, 0x05, 0xed, 0x27, 0xf0, 0x13, 0x2a, 0xe8, 0x14, 0xd0, 0x54, 0xc1,
+  0xf9, 0x39, 0xcd, 0x21, 0x96, 0xd1, 0x65, 0x1d, 0x07, 0xbc, 0xfb, 0x28,
+  0x60, 0xf7, 0x27, 0xe6, 0xeb, 0x1d, 0x37, 0xc6, 0x17, 0x00, 0x19, 0xd2,
+  0x00, 0xe2, 0xea, 0x24, 0xaa, 0x03, 0x16, 0x07, 0xe4, 0x2e, 0x03, 0x40,
+  0x12, 0xf5, 0x10, 0xdb, 0x18, 0xd1, 0xdb, 0xd8, 0xec, 0x17, 0xb9, 0x19,
+  0x9a, 0xee, 0xe2, 0xfc, 0xce, 0xe9, 0xfb, 0x2e, 0x14, 0xe4, 0x19, 0xf3,
+  0x03, 0xe8, 0x65, 0xf3, 0x1f, 0x0a, 0xf3, 0x16, 0x29, 0xf8, 0x4a, 0x25,
+  0x08, 0xe5, 0x4f, 0x12, 0x52, 0xd6, 0x25, 0x3a, 0x23, 0x36, 0x12, 0xca,
+  0xf6, 0x33, 0x17, 0x00, 0x11, 0xb8, 0x13, 0x1e, 0xfe, 0x04, 0x57, 0x11,
+  0xe4, 0x27, 0xe9, 0x58, 0x4d, 0xe0, 0x01, 0xd5, 0x1b, 0xf2, 0xc9, 0xfb,
+  0xfd, 0x0e, 0xc3, 0xf6, 0x0c, 0x13, 0xdf, 0x2e, 0xeb, 0x18, 0xf6, 0x2f,
+  0x09, 0xc8, 0x31, 0x15, 0x02, 0x24, 0x3f, 0x25, 0x2c, 0xf4, 0x16, 0x0d,
+  0x3d, 0x34, 0x20, 0xe4, 0xfc, 0x1f, 0x43, 0x22, 0x7f, 0xde, 0x21, 0xd7,
+  0xe4, 0x01, 0xf5, 0xb3, 0xcb, 0x29, 0x00, 0xb6, 0xfb, 0xb4, 0xfb, 0x1f,
+  0x11, 0xc9, 0x1b, 0xef, 0x29, 0x22, 0xff, 0x47, 0x54, 0xc4, 0x57, 0xf7,
+  0xd3, 0xe7, 0x05, 0x10, 0xde, 0x49, 0xd9, 0x13, 0xd1, 0x2d, 0x09, 0xde,
+  0xe6, 0xec, 0xf0, 0xf4, 0x0b, 0xfd, 0xeb, 0x27, 0xdc, 0xec, 0xe0, 0x00,
+  0xb4, 0xc2, 0x07, 0xfe, 0x19, 0x64, 0x2a, 0xcb, 0x13, 0xf9, 0xe1, 0xfa,
+  0xbc, 0x01, 0x1c, 0xd7, 0x3e, 0x55, 0xd8, 0xeb, 0xe4, 0x2b, 0xef, 0xf6,
+  0xd8, 0x04, 0x27, 0x1d, 0x2e, 0xc7, 0x36, 0x0d, 0x05, 0xf3, 0xf9, 0xfd,
+  0xeb, 0xf8, 0xb1, 0x1d, 0xb3, 0x24, 0xdf, 0x02, 0x04, 0x42, 0xcf, 0x1a,
+  0xd6, 0x4d, 0xea, 0x2b, 0xf1, 0x2c, 0xd5, 0xed, 0xfb, 0xe5, 0xbe, 0x29,
+  0x00, 0xd3, 0x3d, 0x2d, 0xea, 0xcd, 0x51, 0xfb, 0x10, 0x41, 0xfe, 0xfc,
+  0x31, 0xe8, 0xdb, 0x32, 0xce, 0x6f, 0xec, 0xec, 0x60, 0x5e, 0x2f, 0xc4,
+  0xf3, 0x23, 0x36, 0xd9, 0xc2, 0x34, 0x31, 0x2c, 0xee, 0xe0, 0x2a, 0xd7,
+  0x1c, 0xef, 0x1c, 0x38, 0xe5, 0x0c, 0xaf, 0x11, 0xbe, 0xf3, 0xbc, 0xd8,
+  0xe5, 0x1c, 0x1f, 0x15, 0xda, 0x01, 0xf2, 0x07, 0x2a, 0xd1, 0xc3, 0x17,
+  0xea, 0x13, 0x95, 0x0b, 0xf3, 0x8e, 0x15, 0x0a, 0x9e, 0xf5, 0x19, 0xe9,
+  0x1f, 0x69, 0xf4, 0xdd, 0x07, 0x38, 0x10, 0xf2, 0xd5, 0x34, 0x1b, 0xf6,
+  0x26, 0x0c, 0xfd, 0xe3, 0x12, 0xf6, 0xed, 0xb4, 0xf3, 0x18, 0x20, 0xfe,
+  0xf2, 0xe6, 0x25, 0xde, 0x01, 0xfe, 0x0d, 0xf6, 0x11, 0xf0, 0xd3, 0x1e,
+  0xea, 0xfd, 0xe2, 0xef, 0xc7, 0x06, 0x02, 0xc1, 0x2b, 0x19, 0xc5, 0x14,
+  0x1c, 0x1b, 0xee, 0xf1, 0x61, 0xd6, 0x1c, 0xef, 0xfb, 0xf7, 0x00, 0xc7,
+  0xee, 0xdb, 0x29, 0x21, 0x0b, 0x0c, 0x33, 0xd0, 0xbe, 0x10, 0x12, 0xec,
+  0x16, 0xd3, 0xf0, 0xf9, 0x3b, 0x20, 0xeb, 0x34, 0xd2, 0xdc, 0xf7, 0x38,
+  0xfb, 0x10, 0x1f, 0x1f, 0x1f, 0x12, 0x3d, 0x01, 0xcf, 0xfd, 0x06, 0x1a,
+  0x0a, 0x0d, 0x18, 0x11, 0xee, 0x1e, 0xec, 0xe6, 0xe3, 0xd8, 0x0b, 0xbb,
+  0x1d, 0x43, 0xb7, 0xfd, 0x37, 0x6a, 0xe8, 0xc5, 0x54, 0xd5, 0x19, 0x1e,
+  0x00, 0xed, 0x4b, 0xab, 0x29, 0xdd, 0x30, 0x00, 0x07, 0xbd, 0xf9, 0x02,
+  0xdf, 0xdd, 0xcb, 0xcf, 0x25, 0x0a, 0xf2, 0xef, 0x39, 0x06, 0xd8, 0x19,
+  0xc8, 0x13, 0x26, 0x19, 0x01, 0x38, 0x40, 0x4e, 0xdd, 0x0a, 0x63, 0xfc,
+  0xff, 0xf2, 0x04, 0x7f, 0x15, 0x28, 0xe7, 0x0e, 0xf5, 0xd6, 0xbd, 0xdd,
+  0xe6, 0x11, 0x41, 0xd2, 0x0c, 0xe6, 0xd4, 0xea, 0x50, 0x02, 0x0b, 0xe6,
+  0x2a, 0xbc, 0x16, 0xdf, 0x4a, 0xfb, 0xfe, 0xd6, 0xe2, 0x10, 0x4b, 0xdb,
+  0xf6, 0xd4, 0x0a, 0xea, 0xd7, 0x46, 0xef, 0xce, 0xf0, 0xda, 0x02, 0x04,
+  0xeb, 0x15, 0xef, 0xfd, 0xf8, 0x01, 0xd1, 0xd4, 0xfb, 0x36, 0x24, 0x0e,
+  0xf9, 0x03, 0x28, 0x0a, 0x02, 0xee, 0x08, 0x4e, 0x07, 0x1f, 0xc9, 0xe1,
+  0x42, 0xd9, 0xd8, 0x4c, 0x94, 0x03, 0xe8, 0xdd, 0x21, 0xf4, 0x08, 0x26,
+  0xf1, 0x20, 0x24, 0xca, 0x2c, 0xde, 0x0b, 0x08, 0x0b, 0xc3, 0x4a, 0x1c,
+  0x27, 0xeb, 0x0f, 0x48, 0x18, 0xee, 0x38, 0xbd, 0xcf, 0x10, 0x2d, 0x05,
+  0x26, 0xf2, 0xc7, 0xfd, 0x00, 0xf6, 0xc7, 0xd3, 0x0a, 0x05, 0xe7, 0x32,
+  0x0b, 0xf5, 0xb3, 0xec, 0x1c, 0x20, 0xea, 0x36, 0xd8, 0x39, 0x66, 0xf6,
+  0x1d, 0x1c, 0x1c, 0xfd, 0x2b, 0xf4, 0x0c, 0x13, 0xc3, 0xd1, 0x02, 0xb5,
+  0x15, 0x3c, 0xab, 0x27, 0xfa, 0x59, 0x13, 0xbe, 0xf0, 0xe4, 0x23, 0x2a,
+  0xf7, 0xdb, 0x34, 0xf8, 0x30, 0xec, 0x07, 0x0d, 0xf6, 0x8b, 0xe9, 0x04,
+  0xc7, 0xc3, 0xcc, 0xd3, 0x2c, 0xf6, 0xf8, 0xd8, 0x9a, 0xe0, 0xc1, 0xe2,
+  0xe9, 0x08, 0x11, 0x37, 0x48, 0x03, 0xdd, 0x24, 0xdf, 0x42, 0xfa, 0x62,
+  0x0f, 0x1e, 0x1a, 0x4a, 0x15, 0x01, 0x30, 0xe5, 0x30, 0xb1, 0xc7, 0x03,
+  0xa0, 0xdb, 0x0c, 0x15, 0xfe, 0xcf, 0xed, 0x0d, 0xf7, 0x55, 0x0b, 0xd9,
+  0xed, 0xe4, 0x24, 0x31, 0xfe, 0x17, 0x19, 0x0f, 0xf2, 0x1b, 0x1f, 0xda,
+  0x05, 0xc4, 0xf9, 0xc4, 0xe2, 0x14, 0xee, 0xe4, 0x11, 0xd3, 0x00, 0x07,
+  0xcc, 0xf1, 0xce, 0xcb, 0x20, 0x23, 0xd9, 0xef, 0xf0, 0xff, 0xe8, 0xec,
+  0xfc, 0x3d, 0xf0, 0x3f, 0x06, 0x4b, 0x18, 0x41, 0x50, 0xc5, 0x12, 0xe6,
+  0xe3, 0x39, 0x22, 0x01, 0xe7, 0x00, 0x11, 0xfa, 0x1e, 0xff, 0x1c, 0x14,
+  0x0e, 0xd5, 0xe4, 0xef, 0xe5, 0x55, 0xd9, 0x10, 0xf9, 0xf9, 0xfa, 0x16,
+  0xb0, 0x1d, 0x08, 0x00, 0x1f, 0x1b, 0xe9, 0xe9, 0x05, 0x19, 0x00, 0x28,
+  0x35, 0xbe, 0xf4, 0xed, 0x19, 0x07, 0x11, 0xf0, 0xe0, 0xed, 0x00, 0x13,
+  0x08, 0xf5, 0x46, 0xf7, 0x0d, 0x02, 0x0a, 0xf3, 0xdc, 0xf7, 0x07, 0xf6,
+  0x51, 0xd5, 0xee, 0x04, 0x16, 0xe8, 0x1e, 0x0c, 0xfd, 0x03, 0x35, 0xd2,
+  0x18, 0xfa, 0x00, 0x18, 0x34, 0xd5, 0x3a, 0xeb, 0x1e, 0x33, 0x12, 0xe8,
+  0x23, 0x2e, 0x10, 0x09, 0xd9, 0x4e, 0xbe, 0x19, 0x00, 0xd2, 0x2a, 0xf9,
+  0xc7, 0xff, 0x30, 0x0c, 0x0e, 0xc9, 0xe8, 0x00, 0x27, 0x17, 0x21, 0x34,
+  0x1a, 0x37, 0xf2, 0xde, 0x03, 0xf4, 0x2c, 0xec, 0xfd, 0x8d, 0xbf, 0x0c,
+  0xe5, 0xea, 0xef, 0x1b, 0x18, 0xf2, 0xf0, 0xc4, 0x16, 0xfd, 0x0d, 0xfd,
+  0xb7, 0xd9, 0xcf, 0xe4, 0x08, 0xf2, 0x04, 0xbb, 0x0c, 0xf7, 0xe4, 0xd0,
+  0x0c, 0x5d, 0xda, 0x27, 0xc8, 0xfa, 0x19, 0x43, 0xd8, 0x1b, 0xec, 0x07,
+  0xfa, 0xc1, 0x14, 0x11, 0xf9, 0xe3, 0xdb, 0x9c, 0x46, 0xe5, 0xe5, 0x17,
+  0x25, 0xe8, 0x0d, 0x3e, 0xf5, 0x1a, 0x25, 0x22, 0x0a, 0xda, 0x1b, 0x2e,
+  0xf0, 0xd3, 0x36, 0xe1, 0xed, 0xfe, 0x19, 0xec, 0xf4, 0xe5, 0xe2, 0xd9,
+  0x9b, 0xc4, 0xef, 0x0d, 0x1d, 0xf1, 0x18, 0x04, 0x02, 0xe8, 0xeb, 0xbb,
+  0xee, 0xfa, 0x10, 0x0f, 0x1c, 0x07, 0xfa, 0xf3, 0xf0, 0xe1, 0xc0, 0x04,
+  0xd2, 0xbd, 0x13, 0x23, 0xfc, 0x0a, 0xf2, 0xf8, 0x3e, 0x28, 0x15, 0xd7,
+  0xd4, 0x16, 0xf8, 0x38, 0xfe, 0xc6, 0xf0, 0xfd, 0x07, 0xd7, 0xdd, 0x3b,
+  0x40, 0x51, 0x1e, 0xdf, 0x42, 0xf0, 0xf9, 0xf6, 0xfc, 0x0a, 0x25, 0x09,
+  0xf0, 0xe7, 0x03, 0xd9, 0xfe, 0xd1, 0x24, 0x02, 0x22, 0xc9, 0x39, 0x28,
+  0xec, 0xe9, 0xd3, 0x08, 0xea, 0xed, 0x12, 0xfa, 0x10, 0x46, 0x19, 0x0a,
+  0xf0, 0x0c, 0x1f, 0x27, 0xe6, 0x03, 0x18, 0xcc, 0xcf, 0xa3, 0x54, 0xf3,
+  0xff, 0x08, 0x18, 0x1f, 0x85, 0x10, 0xe3, 0x0a, 0x1c, 0xec, 0xfd, 0x27,
+  0x03, 0x0f, 0x1a, 0xfd, 0x2a, 0x2f, 0xe0, 0xb5, 0x1b, 0x0e, 0xd6, 0x2d,
+  0x01, 0xdf, 0xeb, 0xf9, 0x13, 0xee, 0x01, 0xc6, 0xf5, 0x2b, 0xe7, 0x38,
+  0x19, 0xed, 0xde, 0xbe, 0x18, 0xff, 0xec, 0xd5, 0xff, 0x21, 0xf1, 0xe4,
+  0x15, 0xdb, 0xf3, 0x04, 0x22, 0x1e, 0xf7, 0x0c, 0xe8, 0xef, 0x32, 0xbc,
+  0xf1, 0xcb, 0x3b, 0x17, 0x24, 0x04, 0x06, 0xec, 0xf4, 0x15, 0xc8, 0x13,
+  0xf0, 0xf6, 0xf0, 0x22, 0xf3, 0xf3, 0x26, 0x53, 0x1b, 0x27, 0x16, 0x06,
+  0x17, 0x54, 0xf1, 0x15, 0xd9, 0x1d, 0x06, 0xf7, 0x26, 0xdb, 0xd5, 0xf2,
+  0xd9, 0xdd, 0xa9, 0xe9, 0xf0, 0xdd, 0x29, 0x15, 0xd3, 0xe2, 0xc0, 0xd0,
+  0xf3, 0xf6, 0x41, 0x32, 0xfb, 0xf4, 0x11, 0xf5, 0xfb, 0x19, 0x38, 0x00,
+  0xfb, 0xc2, 0xe0, 0x1b, 0xed, 0x28, 0x05, 0x11, 0x25, 0x22, 0x0e, 0x08,
+  0xd7, 0xed, 0xe6, 0xeb, 0xeb, 0xe6, 0xf5, 0x0c, 0xaa, 0x10, 0xe2, 0xf8,
+  0x1c, 0x30, 0xa8, 0xf0, 0x29, 0x1b, 0x11, 0x21, 0xe8, 0xfd, 0x2e, 0xfb,
+  0xbc, 0xdf, 0x01, 0xfb, 0xfe, 0x2b, 0xec, 0x06, 0xff, 0x0c, 0x18, 0x1f,
+  0xce, 0xaf, 0xce, 0xf3, 0x23, 0xf8, 0x0a, 0x1f, 0xeb, 0xf3, 0x06, 0x02,
+  0xcf, 0x0d, 0x7f, 0x2c, 0x38, 0xdb, 0x12, 0xc4, 0xf4, 0x1a, 0x0e, 0xc1,
+  0x43, 0x11, 0xe6, 0x45, 0xd2, 0xdd, 0xf2, 0xef, 0x09, 0xf1, 0x0c, 0x1f,
+  0xac, 0xf9, 0x03, 0x09, 0x16, 0x06, 0xa7, 0xd3, 0xfe, 0x2f, 0x01, 0x4c,
+  0xf0, 0x02, 0x0b, 0xfd, 0xc0, 0xe9, 0xf4, 0xff, 0xe8, 0x25, 0xc0, 0x32,
+  0x47, 0xf9, 0x27, 0xdd, 0xdf, 0xc4, 0xc6, 0xfa, 0xf4, 0x2a, 0xf0, 0xd8,
+  0xe6, 0xf2, 0x1d, 0xca, 0x12, 0x16, 0x0a, 0xdb, 0x0b, 0xd6, 0x10, 0xb4,
+  0x17, 0xff, 0x26, 0xf6, 0xfa, 0x04, 0x00, 0x44, 0xf0, 0xe0, 0xf6, 0xf2,
+  0xc8, 0xfd, 0x06, 0xfa, 0xeb, 0xdd, 0x12, 0x17, 0x15, 0x12, 0xe8, 0x04,
+  0x0c, 0x64, 0x12, 0x06, 0xb2, 0x29, 0x18, 0x11, 0xcb, 0x42, 0xd4, 0x4d,
+  0xd0, 0xfa, 0xd6, 0xe7, 0xee, 0xe6, 0xef, 0xee, 0x0a, 0x31, 0xf4, 0xdc,
+  0x2d, 0x1a, 0xbd, 0xfc, 0xf0, 0xe0, 0x03, 0xff, 0x24, 0xf2, 0xcc, 0x0a,
+  0xfe, 0xe4, 0x36, 0x2c, 0xdd, 0x13, 0x11, 0xe9, 0x20, 0xe7, 0x01, 0xd6,
+  0xb8, 0xdc, 0x10, 0xf5, 0x17, 0xea, 0x33, 0x17, 0x05, 0x24, 0x06, 0x09,
+  0xe9, 0x32, 0x19, 0xfd, 0xce, 0x03, 0x03, 0xdb, 0xfa, 0x28, 0xc7, 0x02,
+  0xef, 0x16, 0xe1, 0xf2, 0xf6, 0xe1, 0xfc, 0xea, 0xe4, 0x16, 0xf3, 0xe8,
+  0xc5, 0x0b, 0xc0, 0xe4, 0xf2, 0xe8, 0x0e, 0xf5, 0xce, 0x0c, 0xf7, 0x01,
+  0x04, 0xed, 0x0d, 0x20, 0x1b, 0x22, 0x2c, 0x0e, 0xe6, 0x55, 0xe5, 0x1b,
+  0xe6, 0xb8, 0x00, 0x22, 0x99, 0x16, 0x29, 0xb1, 0xf2, 0x04, 0x1d, 0x34,
+  0xf4, 0x40, 0xfe, 0x17, 0x2c, 0x2d, 0xcc, 0x02, 0x39, 0x15, 0x41, 0xff,
+  0x3d, 0xf9, 0x51, 0xea, 0x1c, 0xf1, 0xf6, 0xfe, 0x17, 0xfa, 0xfe, 0xe7,
+  0xd1, 0x3f, 0x1c, 0x2f, 0x1c, 0xe1, 0xca, 0x2e, 0x02, 0xe5, 0xf3, 0xfa,
+  0xcb, 0x12, 0xed, 0xe8, 0xe6, 0xda, 0xfe, 0xc8, 0xf4, 0x67, 0xff, 0xfc,
+  0xf1, 0xf4, 0x09, 0x0c, 0x23, 0x02, 0xfc, 0xfa, 0xce, 0xea, 0xd6, 0xbc,
+  0xf5, 0x16, 0x13, 0x1d, 0xf1, 0xc9, 0xfd, 0xff, 0x36, 0x28, 0xe7, 0x0b,
+  0xfe, 0xf7, 0xfc, 0xb3, 0x15, 0x06, 0x19, 0xfe, 0xcf, 0xef, 0x17, 0x24,
+  0x0f, 0xf8, 0xd1, 0xf2, 0xfc, 0xff, 0x1a, 0x20, 0x2f, 0xc5, 0xb4, 0x10,
+  0x09, 0xf2, 0xf8, 0x2b, 0x30, 0xeb, 0xfa, 0x15, 0x17, 0xe0, 0xf4, 0xea,
+  0x06, 0xde, 0xee, 0x0d, 0xd4, 0x0e, 0x30, 0x18, 0xf0, 0x01, 0x00, 0xf2,
+  0xf6, 0x01, 0x00, 0xe8, 0x06, 0xe0, 0x2a, 0x31, 0xfe, 0x0d, 0x64, 0x1d,
+  0xd2, 0xef, 0x23, 0x05, 0xfa, 0xf1, 0xdd, 0xfa, 0xe7, 0x22, 0xf4, 0xf3,
+  0x05, 0xc7, 0xfb, 0xeb, 0xfe, 0x16, 0xba, 0xcc, 0x34, 0x0f, 0x25, 0x2b,
+  0xdf, 0xff, 0xcb, 0xf9, 0x20, 0x0e, 0x02, 0x26, 0x4b, 0x05, 0x29, 0x2a,
+  0xf8, 0xff, 0x3b, 0x26, 0x03, 0xc3, 0xe8, 0xe3, 0xff, 0x22, 0x0a, 0x2e,
+  0xdc, 0xde, 0x09, 0xfe, 0x08, 0x23, 0x17, 0xd1, 0xd7, 0x07, 0x47, 0x0c,
+  0xda, 0x36, 0x43, 0xf8, 0x16, 0xc6, 0xa5, 0x11, 0x0a, 0xfc, 0xbd, 0x29,
+  0xeb, 0x17, 0x5e, 0x11, 0xe1, 0x01, 0x0e, 0x0f, 0xe0, 0x05, 0xbb, 0x0e,
+  0x0d, 0x19, 0xf4, 0x0d, 0x48, 0xe9, 0xb2, 0xf1, 0x0c, 0x12, 0x1a, 0x17,
+  0x10, 0xe8, 0x08, 0xe8, 0x01, 0xfe, 0x2b, 0xf9, 0x03, 0xd1, 0xd8, 0xe9,
+  0xde, 0x1e, 0xf4, 0x21, 0xee, 0x0b, 0x17, 0xfd, 0xcc, 0xfb, 0xcd, 0xf1,
+  0xe8, 0xe8, 0xf5, 0xff, 0x13, 0xf6, 0x39, 0x17, 0x0f, 0xe1, 0xfa, 0xf7,
+  0x1c, 0x07, 0xce, 0xce, 0x13, 0x0e, 0x1c, 0x03, 0xf2, 0xf5, 0xd6, 0x52,
+  0x27, 0xf7, 0x04, 0x23, 0x40, 0xd7, 0x0a, 0xec, 0x1e, 0xbd, 0xe6, 0x24,
+  0x00, 0xfc, 0x31, 0x44, 0xf7, 0x06, 0xd0, 0xfc, 0xed, 0x07, 0xe6, 0xef,
+  0xf5, 0x09, 0xd9, 0xe2, 0xca, 0xdf, 0x70, 0xf9, 0xdc, 0x59, 0xc4, 0x1c,
+  0xf8, 0xf1, 0xe7, 0x0d, 0xbc, 0xdb, 0x2d, 0xcb, 0xf8, 0xe1, 0x53, 0x2e,
+  0xd3, 0xd2, 0x29, 0xfb, 0x15, 0xf4, 0x05, 0x14, 0x0a, 0xca, 0xe4, 0xcd,
+  0xff, 0xa7, 0x07, 0x0d, 0x3f, 0x3b, 0x0e, 0x02, 0x60, 0xbb, 0x1f, 0x39,
+  0xaa, 0xba, 0xfb, 0xe8, 0x11, 0x3b, 0x3f, 0x11, 0x04, 0x13, 0xf1, 0xd0,
+  0xd6, 0x19, 0xe6, 0xec, 0x11, 0xc7, 0x16, 0x01, 0x1b, 0xf4, 0x7f, 0xd0,
+  0xdb, 0x45, 0xfd, 0xeb, 0x08, 0xe4, 0x05, 0x38, 0xe5, 0xfe, 0xfa, 0xac,
+  0xf4, 0xe4, 0x2c, 0xe9, 0xfa, 0xde, 0x14, 0xe5, 0xd8, 0xe2, 0xd5, 0x15,
+  0xe8, 0xca, 0xcd, 0x36, 0x17, 0x02, 0x01, 0xe6, 0x02, 0xfb, 0x00, 0x17,
+  0x10, 0xf5, 0x0f, 0xe8, 0xd0, 0xeb, 0xeb, 0xd5, 0xee, 0x14, 0xf8, 0x30,
+  0x0a, 0x0d, 0x25, 0xf8, 0xeb, 0xe9, 0xd9, 0x00, 0xf7, 0xc3, 0x0f, 0x15,
+  0xe2, 0xe2, 0x09, 0x28, 0xfd, 0x03, 0x1e, 0xdf, 0xff, 0xe4, 0x0e, 0xf6,
+  0xb9, 0xf6, 0x0a, 0xd7, 0x03, 0x0f, 0x2e, 0xd3, 0xde, 0xda, 0x54, 0xe5,
+  0x27, 0x2e, 0xfd, 0x2f, 0xd2, 0xeb, 0xea, 0xf8, 0x09, 0xf4, 0x3f, 0x13,
+  0xc4, 0xe0, 0x23, 0xe8, 0x32, 0xf1, 0x01, 0x01, 0xf8, 0x23, 0xd9, 0xc9,
+  0x0f, 0xb0, 0x35, 0xe5, 0xef, 0x63, 0x12, 0xeb, 0xb6, 0xd4, 0xfb, 0xd3,
+  0xe5, 0x05, 0xff, 0x5e, 0x56, 0xde, 0x36, 0xb7, 0x3a, 0xe9, 0x61, 0xca,
+  0xd0, 0xe4, 0xc6, 0xeb, 0x2b, 0x15, 0xe9, 0x04, 0xa7, 0x3e, 0x23, 0x32,
+  0x3d, 0xf9, 0x09, 0x3d, 0xe9, 0xf9, 0x10, 0x74, 0xd2, 0xec, 0x20, 0xb8,
+  0x0f, 0x08, 0xb0, 0x19, 0xa1, 0xde, 0x52, 0x04, 0x40, 0xe0, 0xfd, 0xd2,
+  0xe0, 0x27, 0x9a, 0xf2, 0x1c, 0xc6, 0xf8, 0xf8, 0x39, 0x0e, 0x53, 0xd4,
+  0x87, 0x19, 0xf7, 0x2e, 0xe8, 0xf8, 0xfe, 0x16, 0xd6, 0x2c, 0x0a, 0xd4,
+  0x2f, 0xcb, 0xce, 0xb8, 0xa6, 0xf8, 0xd7, 0x08, 0x02, 0x1c, 0xcc, 0xf5,
+  0xa0, 0x2b, 0xfe, 0x24, 0x29, 0xfe, 0x67, 0xe8, 0xc8, 0x10, 0x08, 0xbf,
+  0xda, 0xc2, 0xf6, 0xf4, 0x16, 0x59, 0xfc, 0xfe, 0x90, 0x32, 0x51, 0xec,
+  0x1d, 0xe0, 0xfe, 0x00, 0xd9, 0xd8, 0xdf, 0x2a, 0x2b, 0xf7, 0x03, 0xde,
+  0xeb, 0x5a, 0x45, 0x08, 0x53, 0xe9, 0x40, 0x25, 0xd6, 0x3a, 0xe1, 0xd5,
+  0xd9, 0x5d, 0xef, 0xbf, 0x1c, 0xe2, 0xe3, 0xbb, 0xdb, 0x02, 0xdf, 0xb6,
+  0x17, 0x06, 0x14, 0x2e, 0xb8, 0xff, 0x57, 0xf8, 0x18, 0x4a, 0xf8, 0xf6,
+  0xf3, 0x58, 0x0a, 0x9a, 0xf1, 0xeb, 0xb9, 0xce, 0xe9, 0x02, 0x73, 0x4f,
+  0xee, 0xda, 0xcb, 0x37, 0x0f, 0x02, 0xc3, 0x33, 0xe5, 0x15, 0xd6, 0xdd,
+  0x14, 0x9a, 0x1d, 0xf8, 0xe7, 0x14, 0xbf, 0xf6, 0x1a, 0xc4, 0xf4, 0x23,
+  0xdd, 0xd5, 0xe1, 0x01, 0x6f, 0xa4, 0x27, 0x02, 0x02, 0xf3, 0x46, 0x13,
+  0x13, 0xed, 0xe6, 0x0b, 0xf4, 0x1f, 0xd1, 0xe4, 0xe7, 0x72, 0xe5, 0xea,
+  0xf3, 0xd7, 0xaa, 0x4c, 0x39, 0xf0, 0xff, 0x21, 0xe4, 0x1f, 0x15, 0xd1,
+  0xf2, 0xca, 0xd2, 0x21, 0xe1, 0xac, 0x11, 0x1d, 0x17, 0x18, 0xdb, 0xc4,
+  0xa5, 0x05, 0xe4, 0xf9, 0xc2, 0x0c, 0x1c, 0xf7, 0xfa, 0x5d, 0xf4, 0xb5,
+  0x4d, 0x08, 0x09, 0x5a, 0x02, 0x1d, 0x0b, 0xf7, 0x40, 0xf6, 0x0d, 0xa0,
+  0xea, 0xf6, 0xe8, 0x04, 0xed, 0xdb, 0x20, 0x40, 0xee, 0x2e, 0xb9, 0xf0,
+  0xb5, 0x0e, 0x02, 0xf3, 0x0b, 0xef, 0xf3, 0x0e, 0xe4, 0xda, 0xf4, 0xf0,
+  0xef, 0x1a, 0x02, 0xb9, 0xf5, 0xdf, 0xdd, 0x28, 0x0e, 0xff, 0x08, 0xdc,
+  0x27, 0x17, 0xf4, 0x10, 0xb3, 0xd6, 0xee, 0x14, 0xd2, 0xfd, 0x4a, 0x05,
+  0xd7, 0x1b, 0x18, 0xb6, 0x39, 0xfb, 0x33, 0x00, 0x15, 0x0f, 0x0c, 0xe4,
+  0x4e, 0x0f, 0x10, 0xdc, 0x34, 0xcb, 0xe6, 0xfd, 0x15, 0xeb, 0xb6, 0x9b,
+  0xef, 0x1b, 0xa5, 0xe9, 0xe2, 0xe3, 0x38, 0x13, 0xff, 0xf5, 0xfc, 0x24,
+  0xeb, 0xfa, 0xcc, 0xcc, 0xcc, 0x13, 0x2e, 0xe0, 0xec, 0xbe, 0x1f, 0x32,
+  0x25, 0x9f, 0x19, 0x2b, 0x01, 0xe7, 0x27, 0xdc, 0xf3, 0xe1, 0x31, 0xce,
+  0x4f, 0xfc, 0xd8, 0x1c, 0x00, 0xfd, 0xa9, 0xca, 0xe3, 0xff, 0x0c, 0x1d,
+  0xd8, 0x11, 0xfc, 0xca, 0x3b, 0xde, 0xfc, 0x53, 0xe4, 0x0d, 0xc8, 0xfc,
+  0x44, 0xca, 0x9b, 0x00, 0x3a, 0xf2, 0xfd, 0x0f, 0xe9, 0xeb, 0x04, 0xce,
+  0x1d, 0x01, 0xee, 0x19, 0xf6, 0xb8, 0x0b, 0xcc, 0xec, 0xf8, 0xa1, 0x16,
+  0x2f, 0xf9, 0x13, 0x21, 0x1c, 0xe2, 0x21, 0xfe, 0x2c, 0xfe, 0x22, 0xc6,
+  0x0b, 0xf8, 0xe7, 0xae, 0x22, 0x56, 0xd4, 0x3b, 0x37, 0x29, 0xd1, 0xdc,
+  0xfe, 0x11, 0x25, 0x31, 0xf7, 0x22, 0x06, 0xf2, 0x0d, 0xd0, 0xb4, 0xe0,
+  0x81, 0x08, 0xe8, 0x06, 0x44, 0xec, 0xd8, 0xf0, 0xe4, 0x4b, 0x27, 0x15,
+  0xde, 0xa2, 0xf6, 0xf3, 0x0e, 0x18, 0x4a, 0xde, 0x1a, 0xb8, 0xec, 0xb8,
+  0xf4, 0x5a, 0xcd, 0x1a, 0x1f, 0x2f, 0xe8, 0x46, 0x3c, 0xfc, 0x1f, 0xfb,
+  0x14, 0x25, 0x12, 0xea, 0x19, 0xeb, 0xef, 0xd6, 0xed, 0x02, 0x44, 0x4a,
+  0x15, 0xe6, 0xdb, 0xb5, 0xd0, 0xe5, 0xf9, 0x2f, 0x27, 0xf0, 0x29, 0xc8,
+  0xec, 0x13, 0xe8, 0xdf, 0xb6, 0x04, 0xef, 0x03, 0xfa, 0xbd, 0xd5, 0xc6,
+  0x1b, 0x2b, 0x04, 0x9d, 0xd7, 0xa3, 0xf9, 0x2b, 0x03, 0xf0, 0xed, 0xf7,
+  0x08, 0x0d, 0xec, 0xbf, 0x04, 0x36, 0xc5, 0x66, 0x38, 0x13, 0xe4, 0x4e,
+  0x18, 0x9d, 0x00, 0x04, 0xf0, 0xfe, 0x27, 0x0a, 0xd9, 0xee, 0x09, 0xee,
+  0xf9, 0x23, 0xe2, 0x32, 0x0b, 0xff, 0xd3, 0x34, 0x01, 0xb6, 0xd4, 0x3e,
+  0xf3, 0x0f, 0x34, 0xf6, 0x03, 0x1a, 0x08, 0xda, 0xfa, 0x03, 0xfa, 0xf2,
+  0xc9, 0x09, 0xf0, 0xd1, 0xe1, 0x2c, 0xf2, 0xc1, 0xf8, 0xcf, 0xea, 0xcb,
+  0x21, 0x4a, 0x21, 0xf1, 0xe9, 0xe7, 0xe4, 0xf8, 0xe1, 0xe6, 0xd2, 0x11,
+  0xee, 0x04, 0x63, 0xcf, 0xff, 0xb6, 0x1c, 0xd9, 0xce, 0xef, 0xff, 0xd8,
+  0xe9, 0x1a, 0xe3, 0xd4, 0xd9, 0x21, 0xcb, 0x5e, 0xf3, 0x0d, 0xef, 0xc7,
+  0xdc, 0xd1, 0xe6, 0x33, 0xe1, 0x35, 0x3d, 0x2e, 0x27, 0xd9, 0x01, 0xe8,
+  0xf2, 0xea, 0xfb, 0xb0, 0xfa, 0x20, 0x06, 0xe0, 0xea, 0xd8, 0x06, 0x12,
+  0x10, 0xde, 0xae, 0xd2, 0x5b, 0x6d, 0xe2, 0xfe, 0x33, 0xee, 0xd2, 0x0f,
+  0xee, 0xf7, 0xff, 0x26, 0x06, 0xfe, 0x24, 0xca, 0x0d, 0x81, 0xf7, 0xe3,
+  0x00, 0x33, 0x2c, 0x1d, 0x0d, 0x07, 0x21, 0xc7, 0xe1, 0x0c, 0x0c, 0x16,
+  0x01, 0x12, 0xd3, 0xa8, 0x20, 0xe3, 0xd6, 0x36, 0xe1, 0x08, 0x11, 0x05,
+  0xe0, 0xcb, 0x15, 0x12, 0x14, 0x0b, 0xec, 0xb3, 0xd8, 0xfe, 0x01, 0xce,
+  0xd5, 0xf7, 0xfc, 0x29, 0x0a, 0xdf, 0xe5, 0xd8, 0x07, 0x36, 0xfc, 0x02,
+  0x50, 0xfa, 0xc2, 0x0e, 0xeb, 0xf6, 0xcd, 0x05, 0xcc, 0xd8, 0x08, 0x1e,
+  0x30, 0xf3, 0x36, 0x37, 0xe6, 0xf5, 0x0a, 0xe1, 0x28, 0xef, 0xde, 0x23,
+  0xdd, 0xe2, 0xff, 0x1b, 0xf3, 0xfa, 0x0f, 0x1d, 0xf9, 0x29, 0xc2, 0x11,
+  0xcc, 0xf4, 0x27, 0xe6, 0x00, 0xf9, 0x1a, 0x27, 0xdd, 0xf4, 0x2a, 0xd3,
+  0x2a, 0x18, 0x06, 0xdb, 0xbf, 0x0a, 0x61, 0x16, 0x0c, 0xfb, 0x00, 0xd4,
+  0x57, 0xfa, 0x17, 0x51, 0x1c, 0x04, 0xf0, 0x0b, 0xf2, 0xc8, 0xc2, 0x0f,
+  0x0f, 0x08, 0x08, 0xfe, 0x17, 0xf2, 0x28, 0xfe, 0xfb, 0xd5, 0x0f, 0xae,
+  0x2d, 0xfd, 0xcd, 0x2d, 0xd5, 0x0b, 0xfa, 0x07, 0x3e, 0x35, 0xfa, 0xfc,
+  0xf0, 0x24, 0xf8, 0x06, 0xbb, 0xf2, 0x1f, 0xea, 0xfa, 0xd0, 0x21, 0x09,
+  0xdc, 0x0e, 0x15, 0xa9, 0x11, 0xf7, 0x13, 0xd7, 0xf8, 0xca, 0x36, 0x12,
+  0x17, 0x0e, 0xd0, 0xfa, 0x28, 0x28, 0xe8, 0x2a, 0x5b, 0xe8, 0xa3, 0x07,
+  0x25, 0x01, 0xde, 0x03, 0xfe, 0x19, 0x40, 0x04, 0x26, 0xf0, 0xef, 0x17,
+  0xf5, 0x06, 0xef, 0xfc, 0xfb, 0xe4, 0xd2, 0x01, 0xb3, 0xf5, 0x1b, 0x03,
+  0x01, 0x20, 0xff, 0xc9, 0xff, 0x4c, 0xdd, 0x19, 0xed, 0xf0, 0xe4, 0x13,
+  0xd5, 0xfd, 0xe1, 0x19, 0x01, 0x03, 0x1a, 0xd5, 0x03, 0x32, 0x0c, 0xba,
+  0xe8, 0xce, 0x3e, 0xef, 0x01, 0x25, 0x07, 0xf8, 0xfd, 0x0a, 0xbc, 0x11,
+  0x39, 0xe2, 0xfb, 0x0c, 0xfa, 0x0a, 0xbe, 0xfb, 0x20, 0x01, 0x4b, 0x0c,
+  0x2d, 0xf6, 0x40, 0x13, 0x3b, 0x16, 0x00, 0xf5, 0xfb, 0xe7, 0xeb, 0xed,
+  0x07, 0xca, 0x1e, 0x04, 0xef, 0xe1, 0xec, 0x03, 0xb4, 0x0f, 0xbd, 0xf1,
+  0x11, 0xe3, 0x37, 0x06, 0xfd, 0x1b, 0xeb, 0x19, 0x13, 0x24, 0x46, 0xf1,
+  0x0c, 0xfa, 0x1e, 0xf7, 0xcd, 0x1a, 0x0f, 0xc4, 0x1e, 0x01, 0x03, 0xf1,
+  0xf1, 0xde, 0xf3, 0xfa, 0x23, 0x06, 0x17, 0xfe, 0x02, 0xd6, 0x18, 0xe1,
+  0xf3, 0x08, 0xf5, 0xe3, 0x09, 0x36, 0x27, 0x2f, 0x3e, 0x0a, 0x0f, 0xf2,
+  0xd1, 0x0b, 0x09, 0xe8, 0x10, 0xef, 0x1e, 0xea, 0x06, 0x06, 0xf6, 0x0d,
+  0x04, 0x28, 0xf7, 0xd2, 0x31, 0xfa, 0x03, 0xfd, 0x07, 0xcf, 0xf3, 0xe1,
+  0xf0, 0x05, 0x1b, 0xe7, 0x48, 0xcd, 0x15, 0xdd, 0xf1, 0x1c, 0x04, 0xc6,
+  0x21, 0xc1, 0x23, 0x1f, 0x28, 0xc6, 0xa8, 0x2a, 0xe1, 0xe7, 0x14, 0x31,
+  0x25, 0xf0, 0x01, 0x01, 0x09, 0xdd, 0xe3, 0x08, 0x2e, 0x3a, 0xe0, 0x2f,
+  0x39, 0x1d, 0xf3, 0x12, 0xfe, 0xf3, 0xd0, 0xfa, 0xf1, 0xf5, 0x2c, 0xff,
+  0x23, 0x04, 0xfd, 0x2f, 0x19, 0x20, 0xd2, 0x1c, 0x21, 0x0e, 0xdc, 0xf4,
+  0xe3, 0x26, 0xf4, 0xfa, 0x13, 0x0c, 0x29, 0x20, 0x15, 0x15, 0xf6, 0xe1,
+  0xd3, 0x2f, 0xe3, 0x16, 0xe1, 0x1a, 0x19, 0x0c, 0xfd, 0x0e, 0xd5, 0x03,
+  0xa6, 0x27, 0xe6, 0x2f, 0xe4, 0x09, 0xef, 0xea, 0x1f, 0xf0, 0x2b, 0x02,
+  0xde, 0x0d, 0xb0, 0xe5, 0xd7, 0xc6, 0xff, 0x1f, 0x02, 0xc8, 0x9e, 0xc2,
+  0xbc, 0x08, 0xeb, 0x3a, 0xf6, 0xe0, 0x20, 0xfe, 0x0a, 0x1d, 0xe4, 0x17,
+  0x18, 0x0a, 0xea, 0x1f, 0xef, 0xd7, 0xe4, 0xdb, 0x02, 0x2d, 0xf8, 0xd0,
+  0x10, 0xd9, 0xf6, 0xd7, 0xf6, 0xfd, 0x52, 0xdd, 0x03, 0xeb, 0xd9, 0xd7,
+  0x45, 0x30, 0xfa, 0xf8, 0x59, 0x2c, 0xc5, 0xf9, 0xee, 0xf8, 0x0c, 0x06,
+  0xfb, 0xfa, 0x92, 0xde, 0xc3, 0x20, 0xd1, 0x06, 0xfa, 0xfb, 0x25, 0xe9,
+  0x19, 0xf0, 0xc2, 0xf1, 0x5e, 0x31, 0xef, 0x0f, 0x0b, 0x47, 0xd4, 0xd4,
+  0x26, 0xfd, 0xcb, 0xce, 0xd0, 0x2f, 0xd8, 0x0f, 0xfb, 0x92, 0x00, 0xbc,
+  0x0d, 0x03, 0x05, 0xf5, 0x33, 0xa2, 0x05, 0xa3, 0x2f, 0xf6, 0x6d, 0x01,
+  0x56, 0xe0, 0xcb, 0xcb, 0x28, 0x43, 0x0e, 0x40, 0x06, 0xe4, 0xdb, 0x29,
+  0xfb, 0xb8, 0xfc, 0x02, 0xf0, 0xe9, 0xba, 0xe7, 0xba, 0x00, 0x01, 0xe4,
+  0xe3, 0xe5, 0x0a, 0x12, 0xf0, 0xd7, 0xf2, 0x4a, 0xbc, 0xda, 0x0e, 0xef,
+  0x41, 0xf8, 0xbd, 0xcd, 0x15, 0x26, 0x07, 0xe9, 0x22, 0x31, 0xed, 0x1b,
+  0xda, 0x0f, 0xfd, 0xec, 0x06, 0xf7, 0x37, 0x1f, 0xf9, 0x24, 0x21, 0xed,
+  0x03, 0xfa, 0x0c, 0x16, 0x02, 0x3f, 0xf2, 0xf8, 0xfd, 0xf7, 0xeb, 0xeb,
+  0x1f, 0xe2, 0xd4, 0x1a, 0xdf, 0x1a, 0xc5, 0x09, 0xf4, 0xe7, 0xce, 0x3f,
+  0x1d, 0xd4, 0xfa, 0x1f, 0x05, 0xe9, 0x36, 0x1c, 0xf2, 0x17, 0xde, 0xc2,
+  0xdc, 0xf7, 0x17, 0x30, 0xd8, 0x12, 0x23, 0xd5, 0x0f, 0xd0, 0xe5, 0x0a,
+  0x3b, 0xf9, 0xed, 0x0e, 0xf1, 0x1c, 0x10, 0x3f, 0x5d, 0xc1, 0x1a, 0xeb,
+  0x08, 0xdf, 0x0a, 0x9e, 0xf9, 0x0f, 0x01, 0x2b, 0x02, 0xe9, 0xba, 0xe4,
+  0xf7, 0xfa, 0xf9, 0x3b, 0xfa, 0xcf, 0xe4, 0xbd, 0x15, 0x1b, 0xf5, 0xdf,
+  0x06, 0xf8, 0x00, 0xd2, 0x08, 0x34, 0xe6, 0x26, 0x20, 0xf2, 0x36, 0xfd,
+  0x16, 0xd2, 0xf1, 0xf9, 0x1f, 0x13, 0x07, 0xf3, 0x18, 0x3d, 0xbb, 0x03,
+  0x4d, 0xd8, 0xc7, 0x08, 0xfa, 0x04, 0xec, 0x1d, 0xfb, 0xc5, 0xfb, 0xe3,
+  0x27, 0xa3, 0xeb, 0x11, 0xeb, 0xd0, 0x00, 0x81, 0xf6, 0x0b, 0x2e, 0x0f,
+  0x25, 0x03, 0xda, 0xee, 0xbf, 0xee, 0x2a, 0x23, 0xda, 0xf7, 0x08, 0xee,
+  0x35, 0xc3, 0x26, 0xe7, 0xaf, 0x17, 0xfb, 0xae, 0x06, 0x31, 0xe9, 0xef,
+  0xbd, 0xfd, 0x26, 0x1c, 0xd7, 0x02, 0xbc, 0x01, 0xb9, 0x0c, 0x00, 0x03,
+  0x10, 0x00, 0xcb, 0x0b, 0x2e, 0x1a, 0xf3, 0xf5, 0x1c, 0x20, 0x08, 0xfd,
+  0x05, 0x17, 0x17, 0x03, 0x3e, 0xd4, 0xa8, 0x0c, 0xe7, 0xf0, 0x1d, 0xfb,
+  0xba, 0xe6, 0xe3, 0xc6, 0xe1, 0x16, 0x09, 0x46, 0xf5, 0xf1, 0xd5, 0x0e,
+  0xd6, 0x12, 0xd4, 0x1f, 0xe1, 0x38, 0xd2, 0x16, 0x73, 0x04, 0xee, 0x00,
+  0x41, 0x38, 0xf0, 0xf1, 0xf8, 0xed, 0x2a, 0x30, 0xdc, 0xd8, 0xe2, 0x09,
+  0xed, 0xdd, 0x01, 0xcd, 0xc2, 0x3a, 0x06, 0xdb, 0xc9, 0xea, 0x05, 0x07,
+  0x1b, 0xe0, 0xe1, 0x6f, 0x16, 0x19, 0xae, 0x04, 0x0e, 0x20, 0x30, 0xf7,
+  0xfa, 0xda, 0xd1, 0xc7, 0xfe, 0x14, 0xd4, 0x1b, 0x3d, 0xd3, 0xd1, 0xea,
+  0xe9, 0xef, 0x05, 0x1b, 0x14, 0xe9, 0xe5, 0xf0, 0x30, 0x2e, 0x4e, 0xfb,
+  0x11, 0xf6, 0xf4, 0xdb, 0x0e, 0x51, 0xfc, 0x12, 0xf3, 0x30, 0xf8, 0x28,
+  0x26, 0xbf, 0xdb, 0x19, 0xf5, 0x1b, 0x08, 0x16, 0xe1, 0x4f, 0xbf, 0xef,
+  0x21, 0x03, 0xd2, 0xf3, 0xe7, 0x10, 0xcb, 0x2a, 0xff, 0xd3, 0x87, 0x2a,
+  0xcf, 0x12, 0x12, 0xf6, 0xe7, 0xf6, 0xe1, 0xb8, 0xf3, 0xea, 0xeb, 0xfb,
+  0x25, 0xd8, 0xde, 0x0e, 0x10, 0xd6, 0x13, 0xd1, 0xd0, 0xed, 0x19, 0x05,
+  0x06, 0x17, 0x4d, 0xfe, 0xbc, 0xff, 0xe3, 0xa5, 0xfe, 0x39, 0xd3, 0xf9,
+  0xd6, 0xe0, 0x2c, 0x7b, 0xfd, 0xd4, 0x09, 0x0c, 0xf8, 0x11, 0x11, 0xf6,
+  0xfa, 0xfb, 0x09, 0x13, 0xe4, 0x17, 0xf5, 0xc0, 0x0a, 0x1f, 0xd8, 0xeb,
+  0xf8, 0x07, 0xf0, 0x0e, 0xfa, 0x04, 0xa2, 0xe0, 0xd4, 0xde, 0x12, 0xe4,
+  0xf4, 0xca, 0xdb, 0xed, 0x08, 0x05, 0x19, 0x2a, 0x5b, 0xe7, 0x1c, 0xed,
+  0xea, 0xf7, 0x29, 0x02, 0x32, 0x35, 0x08, 0x07, 0x2c, 0xc1, 0xff, 0x04,
+  0xf5, 0xfe, 0x14, 0x7f, 0xe5, 0x25, 0xeb, 0xf9, 0x08, 0x06, 0xd4, 0x07,
+  0xc1, 0x11, 0xda, 0xbe, 0x24, 0xe9, 0xea, 0x1e, 0x0a, 0x3a, 0x10, 0xa9,
+  0xdf, 0xce, 0xf7, 0xc6, 0x02, 0x07, 0xe3, 0xb6, 0x0b, 0x0c, 0xd5, 0xb0,
+  0x0a, 0xd2, 0xec, 0xdb, 0x10, 0xfd, 0x03, 0x26, 0x03, 0x13, 0xf2, 0x02,
+  0xe3, 0x1c, 0xcb, 0x1c, 0xc3, 0x3e, 0xe2, 0xe7, 0x06, 0x57, 0x03, 0xef,
+  0xb0, 0xe4, 0x37, 0xd2, 0x10, 0xa1, 0x19, 0x35, 0xf2, 0xe0, 0x3b, 0x17,
+  0x15, 0xf8, 0xcc, 0xc5, 0xad, 0xd8, 0xf0, 0xc2, 0xfd, 0x0d, 0x22, 0xfe,
+  0xb3, 0xd9, 0xf1, 0x26, 0x02, 0x18, 0x56, 0xfb, 0xdb, 0xf5, 0xee, 0xdf,
+  0x16, 0x12, 0x07, 0xc7, 0x06, 0xee, 0x13, 0xc9, 0x28, 0x25, 0x55, 0xfa,
+  0xe6, 0x0c, 0xdb, 0xd7, 0xb7, 0x1c, 0xd3, 0xd7, 0xe0, 0x16, 0xe4, 0xe9,
+  0x05, 0x63, 0xe1, 0x1c, 0xda, 0x19, 0xdc, 0xc1, 0xdd, 0x8d, 0x2c, 0x30,
+  0xf7, 0x30, 0x0c, 0x01, 0xff, 0xf9, 0xb3, 0xf3, 0x85, 0x19, 0x05, 0xda,
+  0x4e, 0xee, 0xfe, 0x09, 0xc8, 0x01, 0x15, 0x46, 0x04, 0x17, 0xf6, 0x14,
+  0x02, 0x3c, 0x27, 0x0f, 0x4b, 0x2b, 0xeb, 0xc8, 0xb8, 0xf2, 0x27, 0xf5,
+  0xe9, 0x01, 0xee, 0x09, 0xfc, 0xe5, 0xe9, 0x0c, 0x05, 0x17, 0x21, 0x00,
+  0xe7, 0x0d, 0xfa, 0x16, 0xf0, 0x51, 0x20, 0xec, 0xbd, 0xeb, 0xc8, 0x26,
+  0x38, 0x16, 0x0a, 0x01, 0xe1, 0x19, 0xd3, 0x23, 0xe5, 0xef, 0xb9, 0x08,
+  0xfd, 0x20, 0xc7, 0xd0, 0xfb, 0xde, 0xc7, 0x2b, 0x03, 0x23, 0x2d, 0xf0,
+  0xe0, 0x1c, 0xd8, 0xf3, 0x05, 0xdd, 0xbd, 0xea, 0xf1, 0xee, 0xaa, 0xf6,
+  0xdf, 0x10, 0xe0, 0xd9, 0x09, 0x12, 0x4c, 0x03, 0x00, 0x1b, 0xdd, 0xed,
+  0x0d, 0x0d, 0x08, 0x12, 0x1b, 0x11, 0xdd, 0xad, 0x21, 0x1d, 0x1e, 0x10,
+  0x0a, 0xd8, 0x36, 0xcb, 0x3d, 0xfa, 0x27, 0xc0, 0xdd, 0x03, 0x1e, 0x28,
+  0xf1, 0x03, 0xcd, 0x04, 0x18, 0xf3, 0xd7, 0xe1, 0xf9, 0xa8, 0xca, 0x08,
+  0xe9, 0x24, 0x0a, 0xe4, 0xf3, 0x03, 0x18, 0x05, 0xd6, 0xc4, 0x09, 0x06,
+  0x22, 0xf2, 0x19, 0xd7, 0x1a, 0x30, 0x04, 0xa6, 0xf7, 0xf5, 0x18, 0xf5,
+  0xff, 0xff, 0xee, 0x4b, 0xb2, 0xf1, 0x0c, 0xe1, 0xd4, 0xeb, 0x21, 0x04,
+  0xf8, 0x4b, 0xf4, 0xf5, 0x0e, 0xef, 0xe6, 0xb0, 0x14, 0x14, 0x0c, 0xe0,
+  0x17, 0x13, 0xe5, 0x10, 0x0b, 0xd6, 0xca, 0xe5, 0x17, 0x30, 0xdf, 0x05,
+  0xf8, 0xc1, 0xdf, 0xc8, 0xfd, 0xfd, 0x02, 0x1d, 0xd4, 0xd1, 0xf3, 0x16,
+  0xfd, 0xfc, 0x0e, 0xd8, 0xdc, 0xf8, 0x33, 0xe5, 0xdd, 0x11, 0x3b, 0x1a,
+  0xef, 0xf7, 0x34, 0xdc, 0x28, 0xe2, 0x39, 0x45, 0xc1, 0x21, 0x24, 0x0c,
+  0xf3, 0x2f, 0x13, 0x54, 0xe3, 0x35, 0xe8, 0x0b, 0xf9, 0xb7, 0xdc, 0xf2,
+  0x37, 0x0d, 0xff, 0xf8, 0xf1, 0x27, 0xe6, 0xe0, 0xfe, 0x1d, 0xe8, 0x49,
+  0x15, 0x33, 0x16, 0x1d, 0x00, 0xdd, 0xd9, 0x50, 0x18, 0x0e, 0x0e, 0x31,
+  0xed, 0x06, 0xf8, 0xf2, 0x15, 0xeb, 0xf2, 0xdf, 0xdc, 0xf5, 0x0d, 0x1f,
+  0x0f, 0xf6, 0xb7, 0x10, 0xe3, 0x05, 0x6d, 0xcb, 0xfb, 0xb2, 0xe7, 0xef,
+  0xe5, 0xf4, 0x55, 0x2f, 0xeb, 0x03, 0xf2, 0x0c, 0x0f, 0xba, 0x16, 0xf0,
+  0xfc, 0x18, 0x2c, 0xfb, 0xf8, 0xac, 0x41, 0xc9, 0xb6, 0xe8, 0x1b, 0xc2,
+  0xc0, 0xe6, 0xcd, 0x6a, 0xb8, 0x68, 0x26, 0xf1, 0xc5, 0xcc, 0x87, 0xda,
+  0xf6, 0x2d, 0xe6, 0xda, 0x47, 0xdb, 0x1d, 0xb1, 0x14, 0xef, 0x42, 0xd4,
+  0xea, 0xd3, 0x07, 0x3f, 0xf4, 0x11, 0xcc, 0xf1, 0xd3, 0xb4, 0x27, 0xed,
+  0x06, 0xf7, 0xfb, 0xff, 0xcd, 0xec, 0x14, 0xff, 0xcd, 0x26, 0x18, 0x62,
+  0xfc, 0xf7, 0x4d, 0xe8, 0xf5, 0x29, 0x2b, 0xdb, 0x27, 0xf8, 0x04, 0xfc,
+  0x5a, 0x0c, 0xf9, 0xf5, 0xe6, 0xb6, 0xb9, 0xf1, 0xd3, 0x18, 0xf6, 0x1d,
+  0xbc, 0xf6, 0xc7, 0xcf, 0x03, 0x11, 0x1c, 0x05, 0xe2, 0x95, 0xf6, 0xf7,
+  0x20, 0x03, 0xfe, 0x23, 0xe5, 0x07, 0xe8, 0x3c, 0x0f, 0xf6, 0x06, 0x30,
+  0xf0, 0xda, 0x2c, 0x08, 0x22, 0x1d, 0x1e, 0xfe, 0xde, 0xed, 0x0d, 0xd9,
+  0xce, 0xf9, 0xf8, 0x70, 0xe9, 0x12, 0x39, 0x48, 0xe1, 0x11, 0xfa, 0xfa,
+  0x05, 0x08, 0xfd, 0xfa, 0xf2, 0xd7, 0x19, 0xe4, 0x2b, 0xe9, 0xfe, 0x56,
+  0x08, 0x24, 0x3c, 0xd7, 0xa8, 0x3a, 0x0d, 0x38, 0xb8, 0x1e, 0x09, 0x0c,
+  0x07, 0x08, 0xd1, 0xe7, 0x34, 0xef, 0xbf, 0x17, 0x06, 0x15, 0x1c, 0xd8,
+  0x2b, 0x24, 0xd1, 0x19, 0xef, 0x21, 0xf0, 0x04, 0x1a, 0xfc, 0x27, 0xf6,
+  0x06, 0x21, 0xe4, 0x39, 0x16, 0x11, 0xde, 0xd9, 0xd9, 0xe9, 0xe0, 0xd9,
+  0x22, 0xf8, 0x24, 0xc2, 0x2b, 0x20, 0x0b, 0x1f, 0xd0, 0xc5, 0x01, 0x03,
+  0x18, 0x1c, 0xcf, 0x0f, 0xf1, 0x05, 0x1a, 0x0b, 0xfa, 0x59, 0xf9, 0xdf,
+  0xd0, 0x0c, 0xfc, 0x3d, 0xe7, 0xfd, 0x14, 0xfc, 0x3d, 0x15, 0xff, 0x38,
+  0xe0, 0x38, 0x0a, 0xe4, 0x07, 0x0e, 0x0b, 0xe7, 0x11, 0x19, 0xf7, 0xc6,
+  0x1a, 0xc1, 0x1d, 0xe8, 0xf1, 0x2f, 0xf1, 0x27, 0xe7, 0x00, 0xd8, 0x07,
+  0xf0, 0x07, 0xfc, 0xe1, 0x14, 0x10, 0xdd, 0xfd, 0xdb, 0x4e, 0x2d, 0x22,
+  0x14, 0x9c, 0xf5, 0xed, 0x32, 0x18, 0xdf, 0x12, 0x0f, 0xd4, 0xe8, 0xf3,
+  0x03, 0x2e, 0x0e, 0xf4, 0xda, 0x19, 0xf6, 0xfb, 0xf5, 0x01, 0x06, 0x13,
+  0x4b, 0xfa, 0xcd, 0x7f, 0x13, 0x2d, 0x1e, 0xd0, 0x1a, 0xca, 0x05, 0x2d,
+  0xca, 0x01, 0xf2, 0xe4, 0xf8, 0xc4, 0x27, 0xe9, 0xec, 0x3d, 0xf2, 0xff,
+  0xc3, 0xed, 0xc3, 0x5e, 0xd9, 0xe2, 0x05, 0xef, 0xec, 0x15, 0xf3, 0xd8,
+  0xcc, 0x33, 0x47, 0xd9, 0x10, 0x15, 0x03, 0xf1, 0xef, 0x32, 0x07, 0x53,
+  0x33, 0x0d, 0xdf, 0xd7, 0xed, 0x31, 0xdb, 0x21, 0xf0, 0xec, 0x0f, 0x20,
+  0x47, 0x44, 0xad, 0xf1, 0x53, 0xeb, 0xb9, 0x07, 0x44, 0xf3, 0xc0, 0x00,
+  0x29, 0x20, 0xe8, 0xf2, 0xe7, 0x08, 0xee, 0xcc, 0xfb, 0x18, 0x32, 0x10,
+  0x11, 0xfb, 0xfa, 0xf5, 0xfd, 0xda, 0x09, 0xc7, 0xf9, 0xda, 0xde, 0xf4,
+  0xfc, 0xd4, 0xf6, 0x09, 0xbb, 0x36, 0xf7, 0x02, 0x21, 0xe2, 0x21, 0x12,
+  0xfa, 0x2b, 0xd0, 0xcb, 0xe4, 0xdc, 0xe0, 0xe9, 0x3c, 0x1f, 0xd6, 0xdf,
+  0xfc, 0xd2, 0x0d, 0x31, 0xd2, 0x11, 0x29, 0x23, 0x26, 0xf4, 0x10, 0xf2,
+  0x43, 0x03, 0xcb, 0x64, 0x29, 0xda, 0x10, 0x07, 0xeb, 0xf5, 0x0b, 0xfe,
+  0xd3, 0x2b, 0x2b, 0x02, 0x0c, 0xd0, 0x2f, 0xf9, 0xc5, 0xc5, 0x22, 0xf1,
+  0x15, 0xcd, 0xeb, 0xe5, 0xde, 0xff, 0xe8, 0xd5, 0xab, 0x3e, 0x15, 0x1c,
+  0xf4, 0xec, 0x14, 0xcf, 0x1e, 0x21, 0xe1, 0xda, 0xf3, 0xc7, 0x1b, 0xd6,
+  0x20, 0x18, 0xdc, 0x11, 0xef, 0x01, 0xfa, 0x35, 0x25, 0x00, 0x3a, 0x19,
+  0x07, 0x33, 0xe6, 0xed, 0x0a, 0xeb, 0x0c, 0x5c, 0x23, 0xef, 0xfd, 0x36,
+  0xe0, 0x27, 0xe9, 0x36, 0xf3, 0x28, 0x16, 0xfe, 0xf8, 0xcb, 0x00, 0xfc,
+  0xd2, 0xea, 0x2c, 0x51, 0x35, 0x00, 0xeb, 0xf0, 0xce, 0x0c, 0xfc, 0xf9,
+  0x38, 0x2e, 0x37, 0xe6, 0x14, 0x0d, 0x11, 0xd0, 0x03, 0x16, 0x3b, 0x14,
+  0x11, 0x1b, 0xca, 0x46, 0xe7, 0x02, 0xc7, 0xfd, 0xdf, 0xfc, 0x09, 0x12,
+  0x4a, 0x40, 0xf8, 0xec, 0x21, 0x2c, 0x8c, 0xdc, 0x0d, 0xd6, 0x35, 0xd7,
+  0xf7, 0xee, 0xd5, 0xea, 0xab, 0x45, 0xc3, 0xd4, 0xdc, 0x2c, 0xf4, 0xea,
+  0x0c, 0xfa, 0xb4, 0x09, 0xd7, 0x07, 0xf8, 0xc9, 0x17, 0xd0, 0x20, 0x07,
+  0xf9, 0xe6, 0xe7, 0xe2, 0xf2, 0x3f, 0x42, 0xfa, 0x04, 0x1b, 0x28, 0xd2,
+  0xdc, 0x04, 0x19, 0x61, 0xd4, 0xcc, 0xde, 0x26, 0xd3, 0x01, 0xff, 0xfc,
+  0x02, 0xd6, 0xe8, 0xf1, 0x17, 0x26, 0xe4, 0x0b, 0x42, 0x0b, 0xc6, 0xc4,
+  0xf2, 0xf6, 0x5e, 0xe1, 0x3a, 0xbd, 0x0d, 0xca, 0xd8, 0xe5, 0xdc, 0xbc,
+  0x03, 0x41, 0xe7, 0x08, 0x0c, 0xe6, 0xa3, 0x25, 0x01, 0xf0, 0x0b, 0xee,
+  0xff, 0xb3, 0x11, 0x02, 0xf8, 0x06, 0xec, 0xb9, 0xe4, 0x41, 0x3b, 0xfd,
+  0xe3, 0x0c, 0x26, 0xb3, 0xe5, 0x28, 0x01, 0xeb, 0xdc, 0xd6, 0x20, 0x10,
+  0xf9, 0xe1, 0x0b, 0xfa, 0x18, 0x0d, 0xd9, 0x31, 0x01, 0x15, 0xf5, 0xef,
+  0xf5, 0x1f, 0xaf, 0xea, 0xb3, 0xfc, 0xf8, 0x17, 0x01, 0xbb, 0x0d, 0xf5,
+  0xce, 0xfb, 0xd1, 0x28, 0xf0, 0x1f, 0xb4, 0xb5, 0xec, 0xe8, 0xb9, 0x34,
+  0x46, 0xea, 0x23, 0x2c, 0x2d, 0xd6, 0x05, 0xfb, 0x00, 0x00, 0xf1, 0x20,
+  0xef, 0x11, 0xff, 0xf6, 0xff, 0xbf, 0x04, 0xf1, 0xf1, 0xeb, 0xec, 0xf0,
+  0xf5, 0xfc, 0x0e, 0xd1, 0x04, 0xd7, 0xd1, 0xea, 0x18, 0xf5, 0x0f, 0xe8,
+  0xda, 0x1b, 0xee, 0x21, 0x13, 0x0e, 0x11, 0xf6, 0x81, 0x08, 0x1f, 0x16,
+  0xf0, 0x1d, 0xc8, 0xfb, 0xdf, 0xd6, 0x06, 0xf3, 0xec, 0x05, 0x1c, 0xfb,
+  0x19, 0xdc, 0x18, 0xf6, 0x20, 0x0a, 0x02, 0x24, 0x0f, 0x09, 0x16, 0xeb,
+  0x40, 0x04, 0xd7, 0xf2, 0x2b, 0x1a, 0xfc, 0x1d, 0x1f, 0xc5, 0xed, 0x0e,
+  0xfa, 0xde, 0xdd, 0xe4, 0xf4, 0x09, 0xfe, 0x31, 0x17, 0x02, 0xd9, 0xde,
+  0x59, 0xf0, 0x1a, 0xfd, 0xf3, 0xf6, 0xeb, 0x11, 0x01, 0xcb, 0xef, 0xf5,
+  0xad, 0xf3, 0x2b, 0x16, 0xfe, 0xff, 0x1e, 0xf7, 0x00, 0xf7, 0x3e, 0xb4,
+  0x12, 0xf5, 0x11, 0x0d, 0x52, 0xfa, 0x21, 0xed, 0x04, 0xce, 0x0b, 0xe1,
+  0xfa, 0xe3, 0xeb, 0xfe, 0x1b, 0xee, 0xc9, 0xa8, 0xf1, 0x06, 0xe3, 0x0d,
+  0xea, 0xe0, 0x05, 0xe6, 0x11, 0xef, 0xe5, 0xe7, 0xe5, 0x0d, 0xeb, 0x03,
+  0x1a, 0x10, 0xd3, 0x07, 0x34, 0xe5, 0x23, 0xed, 0xf8, 0xea, 0xde, 0x1f,
+  0x1b, 0xa0, 0x26, 0xec, 0xc4, 0x1a, 0xf2, 0x1c, 0xf8, 0xfe, 0x01, 0x0f,
+  0xe8, 0xc4, 0xf5, 0xdf, 0xf9, 0x14, 0x09, 0x09, 0x29, 0x14, 0x03, 0xda,
+  0xe1, 0x01, 0xfc, 0xf8, 0xea, 0x10, 0x1f, 0xd4, 0xf3, 0xe6, 0x0c, 0xe4,
+  0x0f, 0xdf, 0xde, 0x24, 0xf5, 0xfa, 0xe2, 0xfa, 0xf0, 0xfc, 0xdb, 0xf0,
+  0x02, 0x19, 0xed, 0xe0, 0x16, 0xf0, 0x0f, 0x03, 0xf6, 0x08, 0xe0, 0x02,
+  0xee, 0x07, 0xf0, 0x3e, 0x3a, 0x08, 0x32, 0xcc, 0xc4, 0xe6, 0x1b, 0x04,
+  0x00, 0x2c, 0xf4, 0x16, 0x00, 0xde, 0xe3, 0x10, 0x0d, 0xed, 0x0e, 0x04,
+  0xff, 0x23, 0x08, 0xeb, 0x3c, 0x1f, 0xca, 0x13, 0x1b, 0xe8, 0xf9, 0xec,
+  0x1c, 0xfa, 0x18, 0x14, 0x13, 0x25, 0x13, 0x2a, 0x1e, 0xf8, 0xf9, 0x01,
+  0x0d, 0x22, 0xdc, 0x1d, 0x0b, 0x0a, 0xf8, 0x1b, 0xf7, 0x05, 0xf4, 0xe1,
+  0x24, 0xcd, 0xf2, 0xda, 0xd3, 0xe7, 0x2a, 0x12, 0x11, 0xd6, 0xf7, 0xe9,
+  0xd9, 0xca, 0x03, 0xf9, 0xe9, 0x17, 0xe8, 0xe4, 0xf9, 0xc5, 0xeb, 0x1e,
+  0x23, 0xde, 0x1b, 0x19, 0x0d, 0x08, 0x13, 0xff, 0x00, 0xf8, 0xe7, 0x12,
+  0x09, 0xe0, 0x0c, 0xeb, 0xd2, 0xec, 0x1a, 0x2e, 0x11, 0x4e, 0xf7, 0x21,
+  0x19, 0xff, 0xf9, 0x1d, 0x0d, 0x33, 0xef, 0xc1, 0x31, 0x14, 0xef, 0xe5,
+  0xee, 0xf1, 0xec, 0xe7, 0xfa, 0x10, 0xf8, 0xe7, 0xe2, 0xec, 0x1b, 0x17,
+  0x2d, 0xf0, 0xea, 0xef, 0xd2, 0x1f, 0xd6, 0xee, 0x0d, 0xb0, 0x0f, 0xee,
+  0xed, 0xc1, 0x05, 0xfa, 0xef, 0xed, 0xff, 0x2d, 0x14, 0x28, 0x1a, 0x24,
+  0xf8, 0x13, 0xf5, 0x0b, 0xfc, 0xf6, 0x30, 0x22, 0x1c, 0x1b, 0xff, 0x48,
+  0xfc, 0x03, 0xf2, 0xc7, 0xeb, 0xfa, 0xdc, 0xc0, 0x0b, 0x00, 0xe2, 0xe4,
+  0x04, 0x12, 0xe0, 0xe6, 0x0e, 0xe4, 0x1b, 0xff, 0xda, 0xff, 0xd3, 0xe1,
+  0x02, 0x0a, 0xf4, 0x11, 0x03, 0x33, 0x20, 0xe0, 0xf3, 0xd7, 0xed, 0xd3,
+  0x34, 0xef, 0x07, 0x17, 0x15, 0x29, 0x20, 0x1e, 0xe0, 0xec, 0xe4, 0x15,
+  0xef, 0xf7, 0xd9, 0xf0, 0xfe, 0x2b, 0x2f, 0xd0, 0x03, 0x10, 0xd7, 0xdf,
+  0xf4, 0x18, 0xec, 0xf2, 0x01, 0x21, 0x08, 0xe1, 0x01, 0xdf, 0x0b, 0xf2,
+  0x1b, 0x0f, 0xae, 0x12, 0xf1, 0xdd, 0xd3, 0xfb, 0xeb, 0x1e, 0xf4, 0x0c,
+  0xf5, 0xf0, 0xe0, 0xef, 0xe6, 0xf9, 0x08, 0xfa, 0xdc, 0x18, 0x15, 0x00,
+  0x12, 0xe5, 0x09, 0xf8, 0x41, 0xeb, 0x09, 0xfc, 0x16, 0x19, 0x49, 0x14,
+  0x2a, 0x06, 0x1d, 0x0f, 0xe4, 0xdd, 0x05, 0xcf, 0x29, 0x11, 0x32, 0xe2,
+  0xf7, 0xfe, 0xe0, 0xe1, 0xd5, 0x0a, 0x15, 0xeb, 0x1f, 0x59, 0x07, 0xf7,
+  0x22, 0xde, 0x20, 0x21, 0xff, 0x02, 0x03, 0x00, 0x01, 0x08, 0xda, 0xf7,
+  0x01, 0xe5, 0x07, 0x04, 0xeb, 0x0d, 0xf5, 0xf4, 0x01, 0x09, 0x1c, 0x0d,
+  0xd8, 0xec, 0x10, 0xe3, 0xdf, 0xe9, 0x13, 0xcd, 0x4b, 0xd8, 0x0e, 0xd0,
+  0x1c, 0x34, 0x1b, 0xf5, 0x2a, 0xde, 0xff, 0x1b, 0xcf, 0x4d, 0x24, 0xe6,
+  0xff, 0x01, 0xd7, 0x02, 0x04, 0xf0, 0x05, 0x0d, 0x08, 0x04, 0x18, 0xe1,
+  0xd9, 0x03, 0xca, 0x0c, 0xfa, 0xcd, 0xc5, 0xe8, 0xe0, 0x29, 0xec, 0xda,
+  0x0f, 0xc4, 0xf0, 0xec, 0x15, 0x0f, 0x19, 0x07, 0xb9, 0x1b, 0xe0, 0xe5,
+  0xf1, 0xe5, 0xd3, 0x0d, 0xea, 0xd0, 0xda, 0xc1, 0xf0, 0x2c, 0x1d, 0xfd,
+  0x1a, 0xf9, 0x2f, 0xda, 0xc3, 0x16, 0x38, 0xfb, 0x0f, 0x03, 0xb5, 0x0f,
+  0x43, 0x3e, 0xfc, 0x52, 0x17, 0xdb, 0x60, 0xe3, 0xf8, 0xe3, 0xc9, 0xee,
+  0xfa, 0xad, 0xf5, 0xec, 0xbd, 0xff, 0xf6, 0x0f, 0x0c, 0xa8, 0x07, 0xd5,
+  0xda, 0xe9, 0xce, 0x85, 0xee, 0xee, 0xf9, 0x2a, 0xf2, 0xfd, 0x16, 0xbb,
+  0xd6, 0x06, 0x01, 0x45, 0xd0, 0xfd, 0x1c, 0xb6, 0x1e, 0x14, 0xfd, 0xc9,
+  0xb2, 0x0c, 0x0e, 0xf4, 0x14, 0xfe, 0x28, 0xea, 0xe3, 0xdf, 0x18, 0xda,
+  0x15, 0x0a, 0xd7, 0xe5, 0x45, 0x42, 0xda, 0x34, 0x36, 0xd0, 0x54, 0xff,
+  0x4d, 0xfc, 0xae, 0x0d, 0x0e, 0xda, 0x06, 0xe5, 0xdc, 0x05, 0xba, 0x06,
+  0x11, 0x07, 0xf0, 0xd7, 0xe5, 0xdb, 0xf0, 0x37, 0x0a, 0x0a, 0xfb, 0xe8,
+  0xef, 0xe1, 0xfe, 0xc8, 0x57, 0x10, 0xf6, 0x02, 0xe1, 0x39, 0xcc, 0xae,
+  0xc4, 0xf8, 0x0a, 0x9f, 0xf5, 0xf2, 0x29, 0x27, 0x1f, 0x18, 0x20, 0xe5,
+  0x11, 0x25, 0x09, 0xf0, 0x07, 0x17, 0xae, 0x26, 0x19, 0x38, 0xf8, 0xf3,
+  0xf7, 0x19, 0x14, 0x02, 0xbc, 0x01, 0x24, 0x0e, 0xe9, 0xc2, 0x15, 0x25,
+  0x0e, 0x0d, 0x05, 0x08, 0x2c, 0x1a, 0xd4, 0x19, 0xfb, 0xf4, 0xdd, 0xcc,
+  0xaa, 0x1b, 0x1c, 0x30, 0x1e, 0xd7, 0x09, 0x0f, 0x04, 0x03, 0x10, 0x01,
+  0xe3, 0xf3, 0x05, 0x5f, 0x38, 0xb1, 0x3e, 0xff, 0xf4, 0x06, 0x41, 0x40,
+  0x0f, 0xa7, 0x14, 0x07, 0xff, 0xe6, 0x0f, 0xfe, 0xee, 0xfa, 0x26, 0xe8,
+  0x03, 0xba, 0xbd, 0x16, 0xfe, 0xe9, 0x26, 0x1c, 0x1d, 0xd3, 0xfd, 0xbb,
+  0x06, 0xc4, 0xe9, 0xfd, 0x8d, 0xf4, 0x30, 0x2b, 0x0d, 0xe8, 0x02, 0xf2,
+  0x1a, 0x27, 0xe9, 0xae, 0xa7, 0x11, 0x31, 0x1a, 0x20, 0xd4, 0x10, 0x15,
+  0xdf, 0xfb, 0x15, 0x3e, 0xea, 0xe3, 0x59, 0x09, 0xf7, 0x0c, 0x16, 0x13,
+  0xe4, 0x1d, 0x07, 0x4e, 0xee, 0xc7, 0x31, 0xed, 0xed, 0xf1, 0xfc, 0xf3,
+  0xcc, 0xf8, 0x51, 0x40, 0xb1, 0xc3, 0xe1, 0xde, 0xf6, 0xf4, 0x35, 0xec,
+  0x22, 0xef, 0x2f, 0x0b, 0x2a, 0xb4, 0xb7, 0xdc, 0xb3, 0x18, 0xb6, 0xb8,
+  0x3d, 0xf0, 0x04, 0x05, 0x06, 0x13, 0xf1, 0x35, 0xf0, 0x5e, 0xef, 0xd6,
+  0x07, 0xd5, 0x09, 0xf6, 0x02, 0x14, 0xe7, 0x3e, 0x02, 0xf8, 0xa7, 0x81,
+  0xf7, 0x07, 0x09, 0x00, 0x04, 0xf6, 0x0f, 0x38, 0x36, 0xd8, 0x2d, 0xc7,
+  0xf2, 0xd3, 0x39, 0x20, 0xd6, 0x06, 0x40, 0xf4, 0x03, 0xfa, 0x0e, 0xf9,
+  0xc6, 0x29, 0x3a, 0x12, 0xc5, 0x15, 0x1d, 0xe1, 0x00, 0xc9, 0xad, 0x33,
+  0x29, 0xdd, 0xf1, 0x12, 0x07, 0xe1, 0x0a, 0x26, 0xe4, 0xf9, 0x8f, 0xf2,
+  0xf6, 0x5c, 0x2e, 0xf3, 0x03, 0x2b, 0x11, 0x53, 0x15, 0xad, 0x5e, 0x20,
+  0x25, 0x07, 0x59, 0xec, 0xf9, 0xe6, 0x6a, 0xf7, 0xdb, 0xef, 0xcd, 0xa0,
+  0xf5, 0xb2, 0x0c, 0x2c, 0xcc, 0xd3, 0xcf, 0xb2, 0xf4, 0xb2, 0x13, 0x17,
+  0xed, 0xf9, 0xdb, 0x29, 0x22, 0x03, 0xf9, 0x26, 0x3e, 0x18, 0xed, 0xe4,
+  0xd1, 0x24, 0xcf, 0x2e, 0x4c, 0xd5, 0xfd, 0xd3, 0x17, 0xd2, 0x03, 0x00,
+  0xf3, 0x33, 0xa1, 0x0a, 0xe7, 0x50, 0x4c, 0x09, 0x25, 0xf0, 0xf9, 0x17,
+  0x17, 0xaa, 0x45, 0x45, 0x23, 0xf8, 0x1b, 0xd1, 0x12, 0xf1, 0x2b, 0x0a,
+  0x0a, 0xfe, 0xf3, 0x3e, 0xb1, 0xfe, 0x10, 0x2f, 0xcf, 0x20, 0x10, 0x14,
+  0x9e, 0xfd, 0x21, 0xcd, 0x1c, 0x0a, 0x2d, 0xe9, 0x04, 0xf4, 0x3d, 0x44,
+  0xce, 0x29, 0x3b, 0x45, 0xf0, 0x2b, 0xf7, 0xff, 0xe1, 0xca, 0x18, 0xe9,
+  0xfb, 0xde, 0x16, 0xc3, 0x0b, 0x00, 0xbf, 0x0b, 0xd8, 0x12, 0xa8, 0x10,
+  0xe6, 0xed, 0xeb, 0xb5, 0x23, 0xc6, 0x3c, 0x17, 0x3e, 0xcd, 0x06, 0xc2,
+  0xf4, 0x04, 0x2f, 0xf4, 0xca, 0xeb, 0xbb, 0x3b, 0x2f, 0x2d, 0x30, 0x13,
+  0x26, 0xe7, 0xdc, 0x76, 0xf4, 0xf5, 0xfd, 0xd7, 0xf6, 0x2a, 0xcb, 0xdc,
+  0xfc, 0xf5, 0x4a, 0x43, 0xb0, 0x06, 0x05, 0x37, 0xbe, 0x35, 0xc4, 0xf9,
+  0xbf, 0x48, 0xe9, 0x05, 0x10, 0xe5, 0x02, 0xbf, 0x19, 0x56, 0xe8, 0x78,
+  0x2b, 0xce, 0x0b, 0xe3, 0x13, 0x31, 0x01, 0xe5, 0xde, 0x20, 0xfd, 0xfd,
+  0xb8, 0xca, 0xff, 0xfd, 0xe8, 0xea, 0x07, 0x46, 0x2b, 0x36, 0x05, 0x0e,
+  0xd6, 0xa6, 0x34, 0x07, 0x17, 0xfa, 0x00, 0xdc, 0xee, 0x24, 0xdd, 0xcd,
+  0xaf, 0x32, 0x24, 0xf0, 0x14, 0xf6, 0xee, 0x1f, 0xd9, 0xfa, 0xe9, 0x05,
+  0x10, 0x3e, 0xf7, 0xd7, 0xe3, 0x12, 0xe3, 0x69, 0xc0, 0x0d, 0x02, 0xcc,
+  0x1a, 0x35, 0xf6, 0xef, 0x15, 0x3a, 0xdf, 0xf5, 0xbe, 0x45, 0x1a, 0x01,
+  0xff, 0x1c, 0xf6, 0x2c, 0xc7, 0x28, 0xee, 0x14, 0xcb, 0xf4, 0xe7, 0xf4,
+  0x0d, 0x0f, 0x31, 0x2c, 0xf7, 0xe4, 0x09, 0x0e, 0x0a, 0xfc, 0xd9, 0x81,
+  0xe7, 0x21, 0xc7, 0xb4, 0xcf, 0x0d, 0xec, 0xff, 0xad, 0xe6, 0x5b, 0xe9,
+  0x0e, 0xda, 0xe5, 0x08, 0xe5, 0x3c, 0x1b, 0x08, 0x12, 0x26, 0xf1, 0xab,
+  0xe0, 0xe7, 0x0b, 0xe2, 0xe3, 0x32, 0x10, 0x01, 0x6f, 0xee, 0xda, 0xe0,
+  0xe3, 0x3e, 0xbf, 0x23, 0xea, 0x32, 0xed, 0xde, 0xae, 0xeb, 0x1a, 0xf2,
+  0xfa, 0xb7, 0xfe, 0xfa, 0xf7, 0x5a, 0x03, 0xec, 0xfd, 0x16, 0xdf, 0xfe,
+  0x04, 0x00, 0x1b, 0xfe, 0x22, 0x3d, 0xe8, 0xb7, 0x29, 0x06, 0x24, 0xcd,
+  0xc9, 0xf1, 0x0e, 0xdd, 0xfd, 0xff, 0xde, 0xe5, 0xe9, 0x39, 0x1f, 0x15,
+  0xa5, 0x1c, 0x15, 0x2e, 0x11, 0x10, 0x12, 0xe6, 0x0d, 0xe6, 0xc4, 0x45,
+  0x3a, 0x9d, 0x21, 0xb8, 0xee, 0xf9, 0xd4, 0x00, 0xf6, 0x0c, 0x23, 0xf2,
+  0x23, 0xdd, 0x03, 0xc2, 0x02, 0xa3, 0x32, 0x14, 0x05, 0x14, 0xe1, 0xf2,
+  0xe8, 0xe0, 0x01, 0xd6, 0x21, 0x29, 0xfa, 0x2c, 0x02, 0xe7, 0xf8, 0xeb,
+  0xc9, 0x3b, 0x3a, 0xe2, 0xcd, 0x06, 0xe7, 0x2f, 0x17, 0x04, 0x06, 0xdb,
+  0xfa, 0xfb, 0xf8, 0x05, 0xec, 0xe0, 0xfc, 0x65, 0xe6, 0x04, 0xf4, 0xd6,
+  0xf2, 0xec, 0xda, 0x1b, 0xd8, 0x2e, 0x0e, 0xec, 0xff, 0x31, 0xe9, 0xd6,
+  0x29, 0x0b, 0x57, 0x26, 0x34, 0x3d, 0x34, 0x29, 0x05, 0xe0, 0x20, 0xee,
+  0x2d, 0x1e, 0x2c, 0xd3, 0xf5, 0x18, 0x19, 0x05, 0xfa, 0x09, 0x0c, 0xef,
+  0xdd, 0xfe, 0x13, 0x48, 0xcf, 0xe9, 0x1f, 0xd3, 0xc1, 0xff, 0x16, 0x0b,
+  0xd5, 0x07, 0x0d, 0xf8, 0xe7, 0xf4, 0x09, 0x14, 0xd3, 0x01, 0xdb, 0xf6,
+  0xf8, 0x07, 0x12, 0xb8, 0xd5, 0xee, 0xe2, 0xcd, 0xd4, 0x3e, 0x13, 0xcc,
+  0xbd, 0xe7, 0xf3, 0x15, 0x15, 0x28, 0x25, 0x03, 0xfe, 0xf7, 0x13, 0x03,
+  0xf7, 0xc5, 0x1c, 0xf2, 0xe0, 0x02, 0xfb, 0xc2, 0xe7, 0xd0, 0xeb, 0x27,
+  0xde, 0x31, 0x09, 0xfa, 0x4d, 0x21, 0xf4, 0x08, 0x05, 0x06, 0x29, 0xf6,
+  0xec, 0x16, 0x01, 0x05, 0xdb, 0x26, 0x04, 0x0f, 0x0b, 0xe9, 0x39, 0xf3,
+  0x0d, 0x15, 0x07, 0x62, 0xd8, 0xf7, 0xeb, 0x00, 0xf6, 0xe2, 0xde, 0xc9,
+  0x0e, 0x16, 0xfb, 0xef, 0x00, 0xcc, 0x31, 0x07, 0xfa, 0xfd, 0x48, 0xf4,
+  0x29, 0xd0, 0xf9, 0x1b, 0xdb, 0xf3, 0x18, 0xb4, 0xc6, 0x15, 0xf1, 0x06,
+  0xca, 0xe8, 0xe3, 0x08, 0xf0, 0xf4, 0xf2, 0x4c, 0x01, 0xf7, 0x10, 0xe7,
+  0x2d, 0x1e, 0x04, 0xf4, 0x0d, 0xff, 0xfa, 0x1e, 0x1f, 0x0d, 0xf6, 0x1e,
+  0x10, 0xa3, 0xfd, 0x73, 0xde, 0x04, 0xde, 0x2c, 0xe4, 0xed, 0xe8, 0xf1,
+  0x06, 0xe0, 0xea, 0x23, 0xc8, 0x2d, 0x0d, 0x07, 0xfa, 0xc2, 0x32, 0xd4,
+  0xe0, 0x1d, 0x44, 0xfd, 0x4c, 0xeb, 0x23, 0xd2, 0x26, 0xf0, 0xd5, 0xcc,
+  0xf0, 0xef, 0xfa, 0x39, 0xe8, 0xe3, 0xe7, 0x08, 0xfc, 0xd7, 0xfb, 0x0f,
+  0xe1, 0x43, 0xf4, 0x70, 0x4d, 0x0c, 0x1b, 0xe8, 0x1c, 0x27, 0x02, 0xeb,
+  0xf7, 0xf1, 0xf3, 0xfa, 0x36, 0xd3, 0xe1, 0x4a, 0xf8, 0x36, 0xb2, 0x25,
+  0xf4, 0xe2, 0xe9, 0xeb, 0xe0, 0xd8, 0xeb, 0xfd, 0x00, 0x38, 0x2a, 0xc9,
+  0xf2, 0xbf, 0xe5, 0xa4, 0x1d, 0x01, 0x32, 0xc9, 0x24, 0x08, 0x3a, 0xe7,
+  0x1c, 0xf2, 0x0d, 0xd1, 0xb6, 0xc3, 0xed, 0xf7, 0xb6, 0xd0, 0x0c, 0xdb,
+  0xc3, 0x01, 0x3b, 0xc3, 0x32, 0x4d, 0xf7, 0x61, 0x26, 0xfc, 0xe4, 0x0a,
+  0x0a, 0x69, 0xda, 0xd4, 0xf2, 0xf7, 0xfe, 0x36, 0x01, 0xdd, 0xd0, 0x25,
+  0xdd, 0x34, 0x39, 0xff, 0x11, 0xe8, 0xed, 0x17, 0x31, 0x62, 0x42, 0xc8,
+  0xe8, 0x0a, 0x0e, 0xdd, 0xe1, 0x2c, 0x3b, 0xf7, 0x29, 0xdf, 0xf4, 0xef,
+  0x62, 0xf2, 0x28, 0xdc, 0xf8, 0xed, 0xeb, 0xf4, 0x9b, 0xf0, 0x05, 0xd7,
+  0x02, 0x0a, 0x02, 0xd6, 0xef, 0xde, 0x03, 0x0c, 0x3c, 0xf5, 0xf7, 0xfe,
+  0xa0, 0x5f, 0xaf, 0x10, 0x05, 0xdc, 0xe8, 0x56, 0xe0, 0x2e, 0x11, 0x19,
+  0xca, 0x0f, 0xd0, 0xf5, 0xe6, 0xf7, 0x2d, 0xf9, 0x23, 0x13, 0xfd, 0xfa,
+  0x47, 0x36, 0x25, 0x1b, 0xce, 0xe5, 0xea, 0x1c, 0xe0, 0x2d, 0x11, 0xf4,
+  0xed, 0x0d, 0xf7, 0x0f, 0x3c, 0xf2, 0x1d, 0xf0, 0xf8, 0x1d, 0xba, 0x12,
+  0x0c, 0xec, 0x1f, 0xe6, 0x37, 0x2c, 0x13, 0xbf, 0xed, 0x04, 0x28, 0xf1,
+  0x2f, 0xdd, 0xdf, 0xe8, 0x0e, 0x47, 0xe6, 0xfa, 0x26, 0xe8, 0xe8, 0x0c,
+  0x0d, 0x2c, 0xe7, 0x2f, 0xed, 0xda, 0xc8, 0xf3, 0xda, 0xb0, 0x3d, 0x0d,
+  0xf9, 0xe9, 0x11, 0xd0, 0xf1, 0xfb, 0xe2, 0xfe, 0x03, 0xf8, 0x07, 0x02,
+  0x0e, 0xea, 0xdd, 0xe5, 0xbd, 0xe1, 0x1f, 0xc7, 0x20, 0xdd, 0xce, 0xd8,
+  0xd6, 0x0e, 0xc4, 0xfa, 0x7a, 0x19, 0xff, 0x06, 0xf9, 0xfc, 0x19, 0x04,
+  0xda, 0x08, 0x14, 0xeb, 0xff, 0xd0, 0xf8, 0xe7, 0xea, 0x09, 0xef, 0xfd,
+  0x08, 0x22, 0xd5, 0x14, 0x30, 0xfa, 0x16, 0x25, 0xe9, 0xd0, 0xf8, 0xd1,
+  0x0c, 0x09, 0xf5, 0x02, 0x11, 0xfb, 0xec, 0xfc, 0x08, 0x43, 0xf6, 0x17,
+  0xe8, 0xe9, 0xdf, 0xc0, 0xb9, 0x26, 0x03, 0xff, 0x09, 0xaa, 0xde, 0x84,
+  0x35, 0x07, 0x0d, 0x0f, 0x0e, 0x39, 0xcd, 0x4b, 0x07, 0xaf, 0x27, 0x0f,
+  0x29, 0xb9, 0xfd, 0xc6, 0x39, 0xe8, 0xe0, 0x01, 0x3b, 0xeb, 0x5a, 0x04,
+  0xd4, 0xf5, 0xb0, 0x20, 0x15, 0x04, 0xff, 0x17, 0xd9, 0x23, 0xfd, 0x22,
+  0xc1, 0x13, 0xea, 0x4f, 0x13, 0x34, 0xe6, 0x2d, 0x12, 0x2c, 0xd8, 0xc6,
+  0xe6, 0x1b, 0xdd, 0x2e, 0xba, 0xbc, 0xf0, 0xa0, 0xd1, 0x13, 0x24, 0x37,
+  0xef, 0xe5, 0xc2, 0x91, 0x10, 0x10, 0x43, 0x09, 0x28, 0xeb, 0xc9, 0x78,
+  0x2d, 0x36, 0x32, 0xe7, 0x5d, 0x03, 0xff, 0xd8, 0x1e, 0xe6, 0xf0, 0xdf,
+  0x3a, 0xb5, 0x12, 0xd1, 0x5a, 0xee, 0x03, 0x1f, 0x20, 0x00, 0x0d, 0x28,
+  0x09, 0x00, 0xe1, 0x1c, 0x0c, 0x19, 0x05, 0x3d, 0x1a, 0xf3, 0x16, 0x3e,
+  0x1e, 0x1b, 0x1b, 0xae, 0xd8, 0x3e, 0xf0, 0x19, 0xef, 0x11, 0x46, 0xbc,
+  0xdd, 0xbf, 0xe8, 0xf7, 0xcc, 0x00, 0x35, 0x8a, 0x32, 0xdd, 0xf8, 0xe5,
+  0xcd, 0xe1, 0xbd, 0xea, 0x41, 0x45, 0x25, 0x4e, 0xe1, 0x95, 0x1b, 0xe4,
+  0xfb, 0xfa, 0x37, 0xe6, 0x27, 0xd8, 0x1c, 0xf9, 0x1a, 0x0f, 0x34, 0xe0,
+  0xda, 0x27, 0x02, 0x6c, 0x27, 0x23, 0xf2, 0xfc, 0xbc, 0x2f, 0x15, 0xfb,
+  0x13, 0xca, 0xb4, 0xea, 0xce, 0x21, 0x11, 0xd5, 0x3f, 0xf1, 0x0c, 0xf2,
+  0x49, 0x2b, 0x0f, 0xfa, 0x1e, 0xe8, 0xd4, 0x07, 0x37, 0xff, 0x4f, 0xa3,
+  0x1e, 0xf3, 0x2e, 0x54, 0x1f, 0x49, 0xc5, 0x3b, 0x55, 0x81, 0x21, 0xf6,
+  0xce, 0xbd, 0x0f, 0x13, 0x52, 0xb4, 0xbc, 0x03, 0xca, 0xe4, 0x40, 0x11,
+  0x62, 0xd3, 0x20, 0x0d, 0xf7, 0x52, 0xdf, 0xf1, 0xf0, 0xde, 0xf8, 0xde,
+  0x2a, 0xda, 0x25, 0x08, 0x23, 0x06, 0xf9, 0x19, 0x00, 0x3f, 0x0f, 0xfb,
+  0x06, 0x0a, 0xf5, 0x2d, 0xcc, 0xfe, 0xc2, 0xfe, 0x2f, 0x16, 0x1d, 0x3b,
+  0x05, 0xe9, 0xf4, 0xb3, 0x0f, 0xfa, 0xe8, 0x3c, 0x61, 0xe4, 0xd1, 0x0a,
+  0xd0, 0xfb, 0x36, 0xcb, 0x9b, 0x15, 0x27, 0x15, 0x5d, 0xd5, 0xf9, 0x0f,
+  0xd7, 0xd5, 0x53, 0x10, 0xf8, 0xe4, 0x1d, 0x1d, 0x2e, 0x28, 0xd2, 0x17,
+  0xc0, 0xe9, 0xf8, 0xd3, 0x28, 0xd1, 0x03, 0x00, 0x50, 0x44, 0xfc, 0x0f,
+  0xcd, 0x56, 0x2b, 0xfd, 0x35, 0x01, 0xdb, 0xe8, 0x09, 0x05, 0xeb, 0x0b,
+  0xec, 0x01, 0xba, 0x1a, 0xcb, 0x19, 0xf3, 0xf2, 0x0e, 0xef, 0xa9, 0xec,
+  0xfb, 0xe6, 0xf4, 0xee, 0x32, 0x30, 0x2c, 0x1a, 0xb2, 0xf3, 0xcd, 0x29,
+  0x2e, 0x21, 0x3c, 0x01, 0xfe, 0xd7, 0x62, 0x10, 0x10, 0xd5, 0x58, 0x13,
+  0xdc, 0xfa, 0x00, 0x49, 0xe4, 0x22, 0xf6, 0xd2, 0x14, 0xcb, 0x1d, 0x0d,
+  0xff, 0xbf, 0xfd, 0xa4, 0xcd, 0x66, 0x29, 0x14, 0xe0, 0xc7, 0x2a, 0xba,
+  0x1e, 0xf9, 0xf2, 0x10, 0xdf, 0xb5, 0x01, 0xe6, 0xe8, 0x2e, 0x28, 0x05,
+  0x9d, 0x4a, 0xcd, 0xa2, 0xed, 0xf3, 0x13, 0x2b, 0x06, 0xdd, 0x4b, 0x04,
+  0x48, 0xcc, 0xfc, 0x23, 0x38, 0x21, 0xfb, 0xd8, 0x56, 0xd0, 0xff, 0x41,
+  0x1c, 0xe3, 0xd9, 0xe5, 0xe3, 0xbd, 0x09, 0xe2, 0x0c, 0xe6, 0xf2, 0xeb,
+  0x03, 0xdd, 0xe9, 0x35, 0x22, 0xd9, 0xf3, 0x02, 0x24, 0x25, 0x08, 0xd2,
+  0xe2, 0xc4, 0x19, 0xf8, 0x2a, 0x12, 0x0a, 0x1f, 0xe9, 0xc8, 0xd2, 0x11,
+  0x06, 0x21, 0x25, 0xd5, 0xd9, 0x01, 0xf4, 0x15, 0xf4, 0xf1, 0xb3, 0xf2,
+  0x15, 0xb7, 0x10, 0xdf, 0x31, 0xd9, 0xe8, 0x73, 0x28, 0x11, 0xca, 0xff,
+  0x10, 0x89, 0xd9, 0x14, 0xeb, 0x0b, 0xf6, 0xe8, 0xe8, 0xd5, 0x2e, 0x14,
+  0xf8, 0x02, 0xd0, 0x2f, 0xc4, 0xea, 0xcd, 0x18, 0xb2, 0xb5, 0xea, 0xcf,
+  0x37, 0x13, 0x36, 0xd0, 0xe9, 0x11, 0xe6, 0x18, 0xd4, 0x24, 0x00, 0x42,
+  0x10, 0xf4, 0xc4, 0xfe, 0xfc, 0x04, 0xdb, 0x2d, 0xa0, 0x1f, 0xd7, 0x39,
+  0xfb, 0x16, 0x11, 0xea, 0x04, 0xe9, 0x1b, 0xc9, 0xfd, 0xf2, 0xf8, 0x1b,
+  0x2d, 0xf0, 0xdf, 0xce, 0x5c, 0x9b, 0xd9, 0xfc, 0x44, 0xf7, 0xf6, 0x26,
+  0x27, 0x0a, 0xc5, 0xec, 0xbd, 0x40, 0xde, 0x2d, 0xf3, 0xca, 0xf1, 0xd7,
+  0x0d, 0xe4, 0xfd, 0xd3, 0xc4, 0x21, 0x13, 0x4b, 0xfe, 0xe4, 0x5a, 0x32,
+  0x0f, 0xdb, 0xce, 0x00, 0xfa, 0xd6, 0x08, 0xa4, 0xca, 0x15, 0x16, 0x17,
+  0x0c, 0x2f, 0xec, 0xdc, 0xf2, 0x40, 0xf2, 0xd7, 0xbb, 0xb2, 0x13, 0x08,
+  0xe6, 0x33, 0x02, 0xe3, 0x10, 0xf3, 0x49, 0xf5, 0x33, 0xdc, 0x07, 0x40,
+  0x02, 0xdf, 0xe9, 0xe6, 0xe7, 0xe6, 0x39, 0xb7, 0x05, 0x42, 0x0e, 0xe6,
+  0xc7, 0xe1, 0xd4, 0x1d, 0xc5, 0x51, 0xe5, 0xfe, 0xc7, 0xdf, 0x2c, 0x43,
+  0xac, 0x0b, 0x15, 0x2f, 0x23, 0x29, 0xf5, 0xd6, 0xfd, 0xc7, 0xf2, 0x0e,
+  0x11, 0x3c, 0x08, 0x11, 0x4b, 0x14, 0xe5, 0xea, 0xcf, 0x30, 0xb0, 0xa9,
+  0xd5, 0xba, 0xd4, 0x25, 0xf1, 0xeb, 0x36, 0x41, 0xc7, 0xf1, 0x41, 0x4c,
+  0x30, 0xd2, 0x3d, 0x0b, 0x0a, 0xbc, 0xf2, 0xc8, 0x03, 0xfe, 0x28, 0xae,
+  0x34, 0xfe, 0x1f, 0x43, 0xfb, 0x22, 0x0a, 0x12, 0xdf, 0x30, 0xe1, 0xde,
+  0xc6, 0xe2, 0xeb, 0x36, 0xf8, 0x25, 0x17, 0x33, 0x19, 0x1a, 0x0f, 0x3d,
+  0x56, 0x1f, 0xeb, 0x07, 0x2a, 0xeb, 0xfb, 0x3a, 0x32, 0x04, 0xd4, 0x40,
+  0xd6, 0x5d, 0xfa, 0xbf, 0xe6, 0xe7, 0xfe, 0x36, 0xcc, 0x04, 0x08, 0xe7,
+  0x40, 0xf7, 0x37, 0x21, 0x04, 0xdf, 0x4b, 0x15, 0xeb, 0xdb, 0xf3, 0x23,
+  0x08, 0xe9, 0xfd, 0xb5, 0x2a, 0x12, 0x06, 0x15, 0xf8, 0xf1, 0x34, 0xc7,
+  0x21, 0xb2, 0x24, 0x22, 0xb3, 0x03, 0x40, 0x6b, 0x19, 0x30, 0x0d, 0xee,
+  0xf8, 0xd9, 0xce, 0xd8, 0xd2, 0x3f, 0x21, 0xc1, 0x27, 0x19, 0x12, 0x11,
+  0xf7, 0x00, 0xce, 0xce, 0xcc, 0x08, 0x13, 0x45, 0xf4, 0xab, 0x22, 0xd3,
+  0xde, 0xde, 0xfd, 0x55, 0xe2, 0xdd, 0xe9, 0xec, 0x47, 0x4d, 0x0a, 0x00,
+  0xc9, 0x08, 0x7f, 0xc7, 0x55, 0xb4, 0x2d, 0xf5, 0xfe, 0x4f, 0x16, 0xb3,
+  0xa8, 0xee, 0xc5, 0xfa, 0xf0, 0xd3, 0x28, 0xc6, 0xb0, 0xd5, 0x11, 0x34,
+  0xfc, 0xff, 0xfa, 0x12, 0x1d, 0xe1, 0xff, 0xd0, 0xb6, 0x24, 0x24, 0x2b,
+  0xf1, 0x18, 0xe3, 0xeb, 0xe0, 0xf4, 0xd8, 0x0a, 0xc7, 0x02, 0xd7, 0x12,
+  0xe0, 0xd2, 0x07, 0x0e, 0x41, 0xda, 0x19, 0x51, 0xb1, 0xf1, 0x04, 0xe2,
+  0x26, 0x2a, 0x51, 0xdf, 0xdc, 0xe8, 0x61, 0xf5, 0xef, 0xe9, 0x31, 0xed,
+  0x04, 0x0c, 0xd8, 0xf1, 0xe7, 0x3f, 0xdc, 0xf7, 0xdc, 0xd5, 0x15, 0x0c,
+  0xc5, 0xda, 0xf2, 0xfe, 0x1e, 0x1d, 0xfe, 0x26, 0xf5, 0xde, 0xf6, 0xf1,
+  0xe6, 0x43, 0xea, 0x21, 0xfc, 0xd3, 0x15, 0xf6, 0x1e, 0x1d, 0xe8, 0x2c,
+  0xcf, 0x1a, 0xf3, 0x08, 0xe5, 0x0b, 0x41, 0x01, 0x06, 0x12, 0x1e, 0xff,
+  0x23, 0xcb, 0xe9, 0x09, 0x0c, 0x37, 0x27, 0xe4, 0xf9, 0x09, 0x62, 0x22,
+  0xa1, 0x1a, 0x38, 0xfa, 0xe9, 0xff, 0xb3, 0xe0, 0xcb, 0x13, 0xf9, 0xe6,
+  0xfc, 0x2a, 0x1c, 0x4a, 0xf9, 0x1e, 0xdd, 0xc8, 0x09, 0x18, 0xb5, 0x01,
+  0x59, 0x37, 0xf9, 0x01, 0x1b, 0x18, 0xf5, 0xcd, 0x1a, 0x14, 0x4f, 0xc6,
+  0x4e, 0x3f, 0xc1, 0x00, 0x16, 0x36, 0xef, 0x16, 0xf9, 0xf0, 0x2c, 0x3f,
+  0xde, 0xd1, 0xc6, 0xe2, 0xf6, 0xe7, 0xd3, 0x2f, 0x09, 0xe6, 0x10, 0xf1,
+  0xf8, 0x00, 0xc8, 0x49, 0xb7, 0xdf, 0x42, 0xe9, 0xfd, 0x3d, 0x0a, 0x05,
+  0xb9, 0x17, 0xc3, 0x22, 0x00, 0x19, 0x1a, 0x1a, 0x0e, 0xfd, 0x04, 0xd9,
+  0xfd, 0x16, 0xc8, 0xf3, 0xfe, 0x4f, 0x0f, 0xf9, 0xcf, 0xee, 0x09, 0xfc,
+  0xa8, 0xf1, 0x11, 0x27, 0x57, 0xf9, 0x9c, 0xe6, 0xcb, 0x27, 0x19, 0xe8,
+  0xc7, 0x1a, 0x0e, 0x3d, 0xdb, 0xe0, 0x18, 0x0a, 0x11, 0x20, 0x06, 0xc5,
+  0xe7, 0x1c, 0xd3, 0x08, 0x00, 0xe7, 0xa2, 0xeb, 0x24, 0x03, 0x2a, 0xe4,
+  0x0b, 0x3b, 0xe1, 0x16, 0x87, 0x0e, 0xdb, 0x13, 0x04, 0xe6, 0x37, 0x07,
+  0x24, 0x06, 0xd1, 0xd2, 0x1f, 0x1d, 0x9c, 0xf4, 0x39, 0x3f, 0x08, 0xd5,
+  0xdf, 0xf4, 0x24, 0xbf, 0xb9, 0xea, 0x08, 0xfe, 0x52, 0xe9, 0xe8, 0x51,
+  0x21, 0x05, 0xd1, 0xdf, 0xf3, 0xfe, 0xe3, 0xdc, 0xe2, 0xd9, 0x11, 0xd1,
+  0x12, 0xf1, 0x0a, 0xcb, 0xe4, 0xf8, 0xc2, 0x01, 0xe7, 0xef, 0xc6, 0xf1,
+  0x2a, 0xf8, 0x7f, 0x1c, 0x09, 0x19, 0x04, 0x27, 0xb2, 0xd5, 0xbf, 0x12,
+  0x0e, 0x39, 0x11, 0x25, 0x1b, 0x42, 0x19, 0xf9, 0x09, 0x09, 0xc7, 0xd5,
+  0x2d, 0xe7, 0xde, 0xe4, 0xce, 0x36, 0xeb, 0xef, 0xea, 0xf4, 0x1b, 0xe1,
+  0xef, 0x19, 0xef, 0x03, 0x1a, 0x0d, 0x16, 0x1c, 0xdd, 0xe7, 0x06, 0x1a,
+  0xf4, 0xda, 0xf9, 0xec, 0xfe, 0x09, 0xc4, 0xf9, 0xf2, 0x16, 0xeb, 0x16,
+  0xbf, 0xff, 0xeb, 0xf8, 0xc3, 0x10, 0x60, 0x16, 0x16, 0x26, 0x1b, 0x2a,
+  0xc7, 0xf8, 0x10, 0x01, 0x1d, 0xe7, 0x09, 0x15, 0xfa, 0x07, 0x60, 0xfd,
+  0xfe, 0x50, 0xe3, 0xfe, 0x0c, 0x21, 0x27, 0xfc, 0xdd, 0x2f, 0xbf, 0x26,
+  0xef, 0xfd, 0xfc, 0x13, 0x26, 0x10, 0xf0, 0x2f, 0xf7, 0x6b, 0x3f, 0xf6,
+  0x14, 0xbe, 0xd7, 0x51, 0xe9, 0x06, 0xef, 0x25, 0xed, 0x20, 0xd7, 0xd4,
+  0xff, 0x0a, 0x94, 0x13, 0xed, 0xb6, 0xc2, 0xfd, 0xcb, 0xd5, 0x6b, 0xe8,
+  0x17, 0x59, 0x06, 0x0a, 0xbf, 0x00, 0xc7, 0x1b, 0x01, 0xe5, 0xf9, 0xdd,
+  0x00, 0x18, 0xf5, 0x08, 0xce, 0x15, 0xd4, 0xfb, 0x15, 0x13, 0x0e, 0x26,
+  0xa7, 0x20, 0x09, 0x39, 0xdb, 0xf2, 0x37, 0x14, 0x3a, 0xee, 0x22, 0xe3,
+  0x22, 0x14, 0xe0, 0xca, 0xe0, 0x18, 0x08, 0xf6, 0xeb, 0xe9, 0x37, 0xc8,
+  0x0e, 0x01, 0xce, 0xf5, 0x12, 0xfd, 0xeb, 0x16, 0xff, 0x10, 0xf3, 0xf6,
+  0xe5, 0xf0, 0x70, 0x0e, 0xf1, 0x3b, 0x3d, 0x20, 0xe5, 0x05, 0x1e, 0x11,
+  0x13, 0xf5, 0x19, 0x0f, 0xf6, 0x26, 0xec, 0x06, 0x12, 0xf7, 0xba, 0x00,
+  0x1f, 0xec, 0xf3, 0xf9, 0xf2, 0xf6, 0xde, 0x07, 0xea, 0x12, 0xe7, 0xdc,
+  0xd0, 0x00, 0xf7, 0x1a, 0xdd, 0xd7, 0xec, 0x23, 0x10, 0x50, 0x09, 0xc2,
+  0x1e, 0x03, 0x11, 0x03, 0x2d, 0xe6, 0xd8, 0xed, 0x1d, 0x5b, 0x1a, 0x02,
+  0x10, 0x00, 0x43, 0xa7, 0xf7, 0xf9, 0xf4, 0x31, 0x24, 0xe5, 0x20, 0xeb,
+  0x1b, 0xfb, 0x45, 0xdb, 0x0b, 0xfc, 0xd9, 0x0d, 0x06, 0xfa, 0x36, 0x4b,
+  0x31, 0x0d, 0x0f, 0x00, 0xf7, 0x1f, 0xf8, 0x05, 0x5a, 0x1b, 0xde, 0xef,
+  0xfb, 0x25, 0xbe, 0xef, 0xc4, 0x23, 0xdc, 0x2d, 0xfb, 0xf3, 0x14, 0xfa,
+  0xcc, 0x01, 0xc7, 0x08, 0x1c, 0x15, 0xf0, 0x28, 0x10, 0x02, 0xdc, 0xe0,
+  0xef, 0xd7, 0xe6, 0x0e, 0xe0, 0x14, 0x00, 0xe2, 0xc9, 0xee, 0xbc, 0x20,
+  0x0d, 0x00, 0xff, 0xca, 0x55, 0x15, 0xef, 0xfa, 0x15, 0xb7, 0xe7, 0xf7,
+  0x1e, 0x10, 0x04, 0x31, 0x23, 0xeb, 0xee, 0xff, 0x1b, 0xe1, 0x20, 0xff,
+  0x16, 0xf3, 0x08, 0x08, 0xef, 0x40, 0x33, 0x17, 0x02, 0x20, 0xf6, 0xe6,
+  0xec, 0x20, 0xf9, 0x10, 0xce, 0x42, 0x46, 0xcb, 0x07, 0x1b, 0xf6, 0x1e,
+  0xf7, 0xf3, 0xf3, 0xcd, 0x02, 0xc6, 0x09, 0xd0, 0xfc, 0x06, 0x4e, 0x0a,
+  0xed, 0x54, 0xe2, 0x0c, 0xf6, 0xf1, 0x33, 0xd2, 0x59, 0xf4, 0x23, 0x04,
+  0x1c, 0x09, 0xeb, 0x2a, 0x3d, 0xee, 0x09, 0x03, 0x0a, 0x02, 0xca, 0x18,
+  0x02, 0xf1, 0xeb, 0xf1, 0xf5, 0xe0, 0x1c, 0xe2, 0x25, 0x4f, 0x1f, 0xfc,
+  0xf9, 0x15, 0xfe, 0xd0, 0x1d, 0x04, 0xf2, 0x09, 0x1e, 0x13, 0xe5, 0x21,
+  0xfd, 0xff, 0x1e, 0xe9, 0xfd, 0xee, 0x2f, 0x04, 0x16, 0xfd, 0x03, 0xf1,
+  0x12, 0xf4, 0x49, 0xf4, 0xf0, 0xd2, 0x05, 0xd6, 0x13, 0xfc, 0x04, 0xf2,
+  0x0b, 0xcf, 0x33, 0xd8, 0xed, 0xfe, 0xf3, 0x1c, 0x3d, 0xff, 0x2f, 0x01,
+  0x16, 0xfa, 0xe6, 0xe2, 0xe0, 0xe7, 0xeb, 0x09, 0xdd, 0xe5, 0x16, 0x0c,
+  0xfc, 0x3c, 0x1a, 0x10, 0x02, 0xd6, 0xf6, 0xda, 0x0f, 0x16, 0x0d, 0x12,
+  0x05, 0xfc, 0x27, 0x12, 0xef, 0xe7, 0x11, 0xf1, 0xd3, 0xed, 0x02, 0x28,
+  0xf6, 0xd7, 0x00, 0x13, 0x27, 0xef, 0x2f, 0xf4, 0x02, 0x10, 0x07, 0xfb,
+  0x07, 0xf4, 0x0c, 0x03, 0xfb, 0xc7, 0x14, 0xe8, 0x18, 0x25, 0x0c, 0x0e,
+  0x1c, 0x06, 0x20, 0x1f, 0x0c, 0xec, 0xca, 0xd9, 0xed, 0xdf, 0x19, 0x18,
+  0x0b, 0xf0, 0x2d, 0x21, 0x02, 0xe0, 0xe9, 0x16, 0xeb, 0xd4, 0x2a, 0x36,
+  0x08, 0xd6, 0x06, 0x1f, 0x11, 0xf2, 0x17, 0xd5, 0x06, 0x05, 0xfc, 0x0c,
+  0xe8, 0x07, 0x0a, 0x19, 0x0a, 0xf6, 0xd6, 0x0d, 0x0c, 0xf6, 0xf8, 0x0f,
+  0x33, 0x04, 0xfe, 0x1b, 0xe3, 0xce, 0x0f, 0xee, 0xfd, 0xfb, 0xe1, 0xd8,
+  0xfb, 0xaf, 0xfc, 0xe2, 0x05, 0x2a, 0x2b, 0x81, 0x27, 0xfe, 0xd8, 0xf4,
+  0xef, 0xfd, 0x0f, 0x0b, 0x06, 0x0f, 0x01, 0xb5, 0x00, 0x0d, 0x01, 0x13,
+  0xd9, 0xfd, 0xec, 0xd1, 0xf1, 0xf0, 0xda, 0xf1, 0x10, 0xd9, 0xf8, 0xfd,
+  0x21, 0x4c, 0x12, 0xe6, 0xed, 0xdf, 0x11, 0xb9, 0x08, 0x14, 0x10, 0xff,
+  0x0a, 0xea, 0x07, 0xef, 0xf2, 0x10, 0xd5, 0xee, 0x13, 0x29, 0x0a, 0xd6,
+  0x21, 0xf2, 0x1d, 0xe0, 0xea, 0x9f, 0xe5, 0xda, 0xf5, 0xfc, 0x2e, 0x9e,
+  0x13, 0xf4, 0xed, 0x05, 0xf4, 0xff, 0xfe, 0x05, 0x15, 0x07, 0xf0, 0xda,
+  0xf0, 0x1c, 0xf3, 0x06, 0xfc, 0xef, 0xf6, 0xd6, 0xe4, 0xf3, 0xe8, 0xe3,
+  0x08, 0xf2, 0xff, 0x27, 0x23, 0x31, 0x15, 0xf8, 0xd0, 0xf1, 0x05, 0xeb,
+  0x11, 0xe3, 0xf5, 0xe6, 0x21, 0xf9, 0x3d, 0xea, 0xf8, 0xf0, 0xda, 0xcf,
+  0xea, 0x3f, 0xff, 0xdc, 0xf8, 0xf6, 0x0b, 0xea, 0x0d, 0xda, 0x11, 0xef,
+  0xf2, 0xfe, 0x1e, 0xa4, 0x0c, 0x03, 0xec, 0xf7, 0xe0, 0xfb, 0x0c, 0x1a,
+  0x18, 0xfd, 0xf7, 0x04, 0xee, 0xd9, 0x07, 0x1d, 0xfe, 0xf1, 0x0f, 0xfb,
+  0xf4, 0xef, 0xe1, 0x26, 0x12, 0xe2, 0x25, 0xf2, 0x0d, 0x20, 0xee, 0x18,
+  0xe9, 0x01, 0xd8, 0x2e, 0x1b, 0xe4, 0xde, 0xe0, 0xff, 0x11, 0x11, 0x18,
+  0x18, 0x0a, 0xdb, 0xfe, 0xd5, 0x1f, 0x0f, 0xd7, 0xfd, 0x0a, 0xe8, 0xff,
+  0x02, 0xd7, 0x2a, 0xc6, 0x16, 0x26, 0x10, 0xd8, 0x00, 0x15, 0xd0, 0xd9,
+  0xfa, 0x01, 0xd8, 0x1d, 0x07, 0x1c, 0x27, 0xe7, 0x01, 0xf8, 0xf5, 0xf2,
+  0xe2, 0xd1, 0xf0, 0xe0, 0x0a, 0xf8, 0xe3, 0xbf, 0x17, 0x10, 0xfa, 0xe6,
+  0xf6, 0x01, 0x00, 0xe0, 0xed, 0x18, 0x22, 0xfe, 0xd5, 0x23, 0xd5, 0x05,
+  0x16, 0x07, 0xc4, 0x0d, 0xe8, 0xf8, 0xe8, 0xf3, 0x1b, 0x44, 0x1a, 0xee,
+  0x3b, 0xfc, 0xe2, 0xde, 0xf1, 0xd1, 0xe5, 0x01, 0x0a, 0x3b, 0xfc, 0x12,
+  0xde, 0x1f, 0xea, 0xd7, 0xe1, 0xed, 0xd8, 0x0b, 0x0d, 0x16, 0xf5, 0x1c,
+  0xf5, 0xcd, 0xfd, 0xfe, 0xcf, 0xd1, 0xd9, 0xbf, 0x18, 0x18, 0xd6, 0xf5,
+  0x20, 0x10, 0x0e, 0x2c, 0x01, 0x17, 0x0f, 0xf1, 0xe7, 0x4f, 0x17, 0xe5,
+  0xd5, 0xe5, 0xeb, 0xd8, 0xfc, 0x41, 0x0e, 0xf8, 0xdd, 0x19, 0xf2, 0xf7,
+  0x1d, 0x1c, 0x11, 0xf3, 0x17, 0x1b, 0x02, 0x0e, 0x26, 0xd0, 0x14, 0x0a,
+  0x08, 0x15, 0xfa, 0x08, 0x14, 0x01, 0xea, 0xff, 0x0c, 0xe5, 0xeb, 0xe4,
+  0xde, 0x24, 0xee, 0xff, 0x1d, 0xe3, 0x05, 0x14, 0x0b, 0x00, 0x1b, 0xd8,
+  0x04, 0x16, 0xeb, 0xd5, 0xfe, 0xfb, 0x17, 0xf2, 0x10, 0xf0, 0xd2, 0x15,
+  0xe6, 0x38, 0x1d, 0x0e, 0x31, 0xcc, 0xe4, 0xd7, 0x19, 0x09, 0xda, 0x14,
+  0x24, 0xd0, 0x0d, 0x26, 0xff, 0x16, 0x25, 0x13, 0xe4, 0x18, 0xe7, 0x06,
+  0x02, 0x66, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x48, 0x00, 0x00, 0x03, 0xc2, 0x2e, 0x2b, 0xe1, 0x06, 0xd3, 0x02,
   0x27, 0xef, 0xe1, 0x25, 0xcf, 0xe1, 0x00, 0xf0, 0xde, 0x13, 0xef, 0xe5,
   0xb2, 0x11, 0xd2, 0x3f, 0x2d, 0x9f, 0x2a, 0x07, 0xd4, 0xcd, 0x43, 0xc4,
@@ -4885,820 +4888,821 @@ unsigned char pretrainedResnet_quant_tflite[] = {
   0x19, 0x22, 0xdc, 0xfc, 0xe1, 0x02, 0x9a, 0xd7, 0x34, 0x1f, 0x02, 0x00,
   0x01, 0x1c, 0xe4, 0x06, 0x22, 0xb6, 0x12, 0xb9, 0x02, 0x08, 0xfa, 0xe7,
   0x10, 0x0d, 0x34, 0x1c, 0xe9, 0xad, 0x2d, 0xf6, 0x20, 0xef, 0xe9, 0xf8,
-  0x10, 0x17, 0xb8, 0xe2, 0x4e, 0xae, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x00, 0x4b, 0xf9, 0xd5, 0xe5, 0x2d, 0x53, 0x7f, 0x3c,
-  0x1e, 0x04, 0x28, 0x94, 0x0f, 0xab, 0xc5, 0x06, 0xd5, 0x50, 0x52, 0x81,
-  0xfb, 0x08, 0xb4, 0x48, 0x0e, 0xf7, 0x2b, 0xd9, 0x2e, 0x1e, 0xd9, 0x72,
-  0x7f, 0xf0, 0x17, 0xec, 0x09, 0x05, 0x19, 0xd1, 0x1b, 0xde, 0xed, 0x0c,
-  0x05, 0x1b, 0xf0, 0x12, 0x7f, 0x59, 0x09, 0xd5, 0xcd, 0x19, 0xeb, 0x36,
-  0x70, 0xd7, 0x06, 0x2e, 0x37, 0x2e, 0x17, 0x20, 0x0e, 0xd8, 0xde, 0xe5,
-  0xf0, 0x7f, 0x11, 0x2b, 0x2c, 0xda, 0x02, 0xc5, 0xe4, 0x02, 0xe9, 0xc5,
-  0x03, 0x08, 0x3e, 0xd1, 0x72, 0x59, 0x07, 0xe5, 0xe8, 0xdd, 0x2a, 0x17,
-  0x0e, 0x0b, 0x46, 0x81, 0x08, 0x2a, 0x47, 0xd5, 0x21, 0x49, 0xe2, 0xbe,
-  0x04, 0xff, 0x53, 0x81, 0x7a, 0xe2, 0x21, 0xcf, 0xe5, 0xdc, 0x20, 0xc3,
-  0x23, 0x57, 0xb9, 0xf0, 0xd5, 0x13, 0x7f, 0x5d, 0x18, 0x00, 0x41, 0xdd,
-  0xea, 0x63, 0x3e, 0xca, 0x91, 0x45, 0xe7, 0x15, 0xf6, 0x4a, 0xb4, 0xfc,
-  0x86, 0x3a, 0x7f, 0xb5, 0x3c, 0xeb, 0x11, 0xde, 0x08, 0xa1, 0x2d, 0xa1,
-  0x81, 0x64, 0x41, 0x5b, 0x25, 0x10, 0x4c, 0x1e, 0xac, 0x88, 0xb0, 0xd6,
-  0xd4, 0xb8, 0x19, 0xe3, 0x4e, 0x86, 0xe7, 0xb2, 0x36, 0xa2, 0x81, 0xb0,
-  0x81, 0x12, 0x1f, 0xcc, 0xdc, 0xe8, 0x4f, 0xfe, 0xf5, 0x35, 0xe7, 0x3d,
-  0xb7, 0xfe, 0x45, 0xad, 0x18, 0x20, 0x0d, 0xe3, 0xe5, 0x31, 0xbc, 0x0f,
-  0xfc, 0x81, 0xf7, 0x14, 0x1e, 0x1b, 0xf2, 0x06, 0xd3, 0x1b, 0x0b, 0x18,
-  0x37, 0xcb, 0x7f, 0x04, 0xc3, 0x41, 0xdb, 0x12, 0xce, 0xce, 0x1d, 0xad,
-  0xd6, 0xf9, 0x07, 0x6d, 0xde, 0xf1, 0x95, 0xc4, 0x81, 0x56, 0x70, 0xe8,
-  0x16, 0xe5, 0x24, 0x2b, 0x17, 0x1b, 0x29, 0x3b, 0x1b, 0xd7, 0x3d, 0xed,
-  0x1e, 0x15, 0x24, 0x00, 0x7f, 0xfc, 0x13, 0x00, 0x0d, 0x19, 0x11, 0x1a,
-  0x07, 0xc1, 0x3a, 0xf4, 0x56, 0x7f, 0x5f, 0xd0, 0xee, 0x0d, 0xf4, 0x57,
-  0x7f, 0xf6, 0x0a, 0x42, 0xda, 0xae, 0xcc, 0x20, 0x23, 0x33, 0xf3, 0x79,
-  0x04, 0xf2, 0x9c, 0x38, 0x27, 0x05, 0x10, 0x7f, 0x1c, 0x22, 0x11, 0x1d,
-  0x1b, 0x02, 0xd2, 0x09, 0xed, 0x0e, 0x03, 0x0f, 0x82, 0x21, 0xae, 0xc1,
-  0xf9, 0x0c, 0x76, 0x7f, 0x42, 0xb8, 0x32, 0xcc, 0x15, 0xf1, 0xca, 0xf9,
-  0xbd, 0x11, 0x1e, 0x7f, 0x0d, 0xc6, 0xd6, 0x05, 0x5a, 0xdb, 0xf9, 0xba,
-  0x12, 0x23, 0xef, 0x45, 0xe0, 0x2d, 0xe0, 0x34, 0x6e, 0x2d, 0x7f, 0xfe,
-  0x66, 0x62, 0x90, 0x3c, 0xda, 0xf0, 0x2b, 0x22, 0xd1, 0xd7, 0xb8, 0x16,
-  0xe8, 0x36, 0x7f, 0x0c, 0x0d, 0x6d, 0x09, 0xc3, 0xf5, 0xe8, 0xbc, 0xc4,
-  0x4a, 0x12, 0x16, 0x51, 0xd1, 0x3c, 0xcc, 0x39, 0x0c, 0x94, 0xb6, 0x7f,
-  0x25, 0x10, 0xf3, 0xf8, 0x19, 0x2b, 0xdd, 0xbd, 0x3a, 0xf8, 0x7f, 0x45,
-  0x0c, 0x1e, 0x3b, 0xe4, 0x5f, 0x09, 0x3f, 0x43, 0x6c, 0x4a, 0x5f, 0x21,
-  0xf3, 0x1b, 0xbb, 0xc5, 0xe2, 0xd0, 0x24, 0xeb, 0x7f, 0xf5, 0x05, 0x0b,
-  0xa8, 0xcc, 0x30, 0x42, 0x51, 0x05, 0x0d, 0xbf, 0x81, 0x4f, 0xfa, 0xb5,
-  0xf3, 0x3d, 0x11, 0xd8, 0x35, 0xf2, 0xf1, 0x9d, 0x29, 0xe4, 0x1d, 0x7f,
-  0xad, 0xae, 0x08, 0x35, 0x75, 0xf0, 0x66, 0xe7, 0x03, 0xe5, 0x10, 0x17,
-  0x21, 0x7f, 0xb0, 0x04, 0x23, 0xef, 0x13, 0xd6, 0xd9, 0xff, 0x04, 0x3d,
-  0x3a, 0xfc, 0xce, 0xe4, 0xa7, 0xda, 0xe5, 0xe3, 0xb0, 0x4a, 0xf4, 0x0a,
-  0x81, 0xf8, 0x04, 0x7a, 0x15, 0x36, 0xda, 0xdd, 0xcc, 0x8f, 0x8d, 0x34,
-  0x71, 0x96, 0xa4, 0x4d, 0x81, 0x70, 0x5b, 0x2d, 0xef, 0x27, 0x3a, 0xec,
-  0xb1, 0x31, 0xe1, 0xef, 0x81, 0x06, 0xff, 0xc7, 0x1a, 0x1a, 0x2c, 0x08,
-  0x5a, 0xb0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
-  0xb8, 0xe0, 0x2c, 0xfe, 0xea, 0xd6, 0x0f, 0x36, 0x05, 0x05, 0xf7, 0x05,
-  0x04, 0xb9, 0x25, 0x1a, 0xe0, 0xe7, 0xee, 0xe2, 0xdf, 0xcb, 0xbe, 0xe1,
-  0xc3, 0x30, 0x37, 0xdf, 0xf4, 0xea, 0xe7, 0xbb, 0x19, 0xed, 0x55, 0x13,
-  0xc9, 0xd5, 0x27, 0xd7, 0xde, 0x04, 0xe3, 0x01, 0x05, 0x03, 0xd9, 0xe2,
-  0x17, 0xd0, 0xe1, 0xe3, 0xf4, 0xcd, 0xda, 0x0d, 0xde, 0xf4, 0x35, 0x06,
-  0xf1, 0xef, 0xe1, 0x02, 0x15, 0x13, 0x24, 0x49, 0x02, 0xef, 0xe9, 0xab,
-  0xae, 0x0d, 0xea, 0xda, 0x13, 0x19, 0xc7, 0xc0, 0xfc, 0x2f, 0xfc, 0xe8,
-  0xd9, 0x05, 0x1b, 0x14, 0xf2, 0xea, 0xdf, 0x0f, 0x1d, 0x00, 0xeb, 0x45,
-  0xc9, 0xc8, 0x1e, 0xa2, 0xf8, 0xd7, 0xed, 0x7f, 0x10, 0xd8, 0xfb, 0xf3,
-  0xf4, 0xde, 0x46, 0x28, 0xed, 0xe1, 0xf5, 0x06, 0x09, 0x09, 0xbf, 0x01,
-  0xbf, 0x2e, 0x1b, 0xca, 0xfd, 0x41, 0xf7, 0xb5, 0x3c, 0xcf, 0x3a, 0xdc,
-  0xbe, 0x1a, 0x1f, 0xfc, 0x0b, 0x0a, 0x01, 0xe9, 0x02, 0x0f, 0xeb, 0xe5,
-  0x11, 0xb4, 0xfb, 0x04, 0xd7, 0x0a, 0xe5, 0x01, 0x09, 0xe3, 0x2a, 0xf2,
-  0xeb, 0x4c, 0xf5, 0x10, 0x33, 0x1b, 0x0a, 0x27, 0xa5, 0x13, 0x05, 0xbe,
-  0xfb, 0x4c, 0xff, 0x10, 0x11, 0x39, 0xa2, 0xe4, 0xff, 0x13, 0x0f, 0x0f,
-  0x01, 0x1b, 0x06, 0x0b, 0x5e, 0xd2, 0x01, 0x08, 0x1f, 0x33, 0xf4, 0x27,
-  0xdf, 0xd8, 0xee, 0xdc, 0x40, 0xcf, 0xf6, 0x34, 0xdb, 0xc3, 0x0d, 0xec,
-  0xdb, 0xe0, 0x3a, 0xfb, 0xdd, 0xe5, 0xff, 0xff, 0x02, 0x0d, 0xc5, 0xfb,
-  0xfe, 0x0b, 0x31, 0xc4, 0xe0, 0x21, 0xd1, 0xdf, 0x42, 0xca, 0x21, 0x06,
-  0x34, 0xce, 0x08, 0xdc, 0xd5, 0xe1, 0x16, 0x16, 0x03, 0x1f, 0xf4, 0xda,
-  0x01, 0xbe, 0xf7, 0x2b, 0xcc, 0x18, 0xb1, 0xef, 0x0a, 0x04, 0xf1, 0xd8,
-  0xe8, 0x02, 0xfd, 0x0f, 0x34, 0xe6, 0x04, 0x2f, 0xd6, 0xed, 0x1c, 0xc5,
-  0xf3, 0x36, 0x13, 0x25, 0x28, 0x3c, 0x8c, 0x04, 0x1b, 0x17, 0xf0, 0x1f,
-  0xfa, 0x2d, 0x0f, 0x06, 0x2a, 0xf1, 0xfc, 0xf7, 0x19, 0x1e, 0x30, 0xfb,
-  0x21, 0x3c, 0x20, 0x05, 0x0d, 0xcf, 0xfd, 0xb4, 0xfd, 0xd1, 0xd6, 0x13,
-  0x44, 0x30, 0xd5, 0xf3, 0x19, 0xf0, 0xee, 0xf9, 0xe1, 0xfb, 0x11, 0xe7,
-  0xe2, 0xf2, 0xe1, 0x52, 0xf4, 0xfe, 0xde, 0xe9, 0xef, 0x2f, 0x0f, 0x24,
-  0x0e, 0xa2, 0xe4, 0x11, 0x1b, 0xfb, 0x0d, 0xfd, 0x1d, 0xfb, 0x23, 0x1e,
-  0xc4, 0x0a, 0xe7, 0x30, 0xd8, 0xf8, 0x2c, 0xcd, 0xf5, 0x21, 0x1a, 0xef,
-  0x14, 0x1a, 0x29, 0x05, 0xeb, 0xd4, 0xf9, 0x0d, 0x08, 0xc2, 0xde, 0x20,
-  0x1e, 0x21, 0xee, 0x17, 0xe2, 0x05, 0x51, 0x06, 0xd6, 0xf8, 0x05, 0xce,
-  0xf1, 0xf6, 0x17, 0x11, 0xef, 0x2a, 0x19, 0xe7, 0xc8, 0xf7, 0xfd, 0x4c,
-  0xee, 0x3f, 0x0c, 0x08, 0x34, 0x16, 0x19, 0xba, 0x00, 0xf1, 0xed, 0xf9,
-  0x4a, 0x23, 0xb8, 0xf8, 0x2b, 0xf9, 0xe5, 0xfe, 0x10, 0x11, 0x02, 0x03,
-  0xcc, 0x00, 0xaf, 0x56, 0x08, 0xed, 0x21, 0xc9, 0x03, 0x1d, 0x1f, 0x23,
-  0x2c, 0xf0, 0x24, 0x24, 0xfe, 0xf7, 0x18, 0xca, 0x21, 0x04, 0x18, 0x29,
-  0xdd, 0xf4, 0xfc, 0x01, 0xeb, 0xf3, 0xf3, 0x10, 0x22, 0x26, 0x47, 0xd4,
-  0x0d, 0x30, 0xfd, 0x1f, 0xac, 0x85, 0xf5, 0x00, 0xd1, 0xf4, 0x00, 0x3b,
-  0x14, 0xfb, 0xed, 0x13, 0xae, 0xeb, 0x7f, 0xec, 0x9e, 0x12, 0xfa, 0xd9,
-  0xcc, 0xeb, 0xf6, 0x05, 0x29, 0x11, 0x61, 0xaa, 0xd4, 0x0d, 0xc9, 0x39,
-  0x33, 0x1d, 0x16, 0x0d, 0x10, 0x01, 0x14, 0xe5, 0x03, 0x04, 0x0c, 0xfe,
-  0x1b, 0x1b, 0xd3, 0xe8, 0x26, 0xd9, 0x0c, 0xfe, 0x1d, 0x07, 0xfd, 0x03,
-  0xfb, 0x08, 0xbe, 0x30, 0x14, 0xf0, 0x27, 0xd3, 0x26, 0x1e, 0x3e, 0x17,
-  0xfe, 0x31, 0x32, 0x17, 0xdc, 0xfd, 0x03, 0xdc, 0x29, 0x17, 0x20, 0x03,
-  0x29, 0xc8, 0x14, 0x03, 0x27, 0xf3, 0xd6, 0x24, 0x16, 0x23, 0xfe, 0xf4,
-  0x00, 0xfb, 0x0e, 0xe9, 0xc6, 0xb4, 0x21, 0xfc, 0xf4, 0x16, 0x25, 0xf0,
-  0x0e, 0x19, 0xe2, 0xe9, 0xd1, 0xe0, 0x37, 0xe9, 0xcb, 0xf5, 0x02, 0xf3,
-  0xf1, 0xcf, 0xf8, 0xf4, 0xff, 0xf6, 0x73, 0xbf, 0xea, 0x0d, 0xbc, 0xf2,
-  0x4a, 0xd2, 0x35, 0xae, 0x9a, 0x65, 0x2b, 0x0c, 0x90, 0xf5, 0xef, 0x1d,
-  0xe7, 0xd6, 0xaa, 0xdc, 0x22, 0xd4, 0x2b, 0xb1, 0x28, 0xd6, 0xd4, 0xe3,
-  0xe1, 0xaa, 0x2b, 0xce, 0xa1, 0xdd, 0x10, 0x90, 0x54, 0xcd, 0x32, 0xcb,
-  0xe7, 0x53, 0xf2, 0x00, 0x0c, 0xee, 0xf9, 0x27, 0x27, 0xfa, 0x05, 0x0d,
-  0x1e, 0xf7, 0x3a, 0xfc, 0x2b, 0xd9, 0xd9, 0xe8, 0x18, 0xb4, 0x4a, 0xfb,
-  0x8b, 0x2a, 0xea, 0xec, 0x3f, 0x27, 0x09, 0xfa, 0x03, 0x21, 0xe3, 0xbc,
-  0x0a, 0xe3, 0xff, 0x18, 0x26, 0xfc, 0xeb, 0xec, 0xf4, 0xdf, 0x13, 0x0e,
-  0x15, 0xd7, 0x05, 0x2c, 0xdc, 0xe0, 0xf6, 0x24, 0xd3, 0x26, 0xfb, 0x04,
-  0x2a, 0x01, 0x3e, 0xea, 0xb9, 0x4c, 0x48, 0x2c, 0xc8, 0x05, 0xe0, 0x45,
-  0xd8, 0xf1, 0xf9, 0x18, 0x38, 0xda, 0x35, 0xd2, 0x1e, 0xf4, 0xbd, 0x34,
-  0xeb, 0xfe, 0x47, 0xe5, 0xc4, 0x14, 0xf4, 0x92, 0x33, 0xde, 0x3e, 0xc8,
-  0xbb, 0x71, 0x2d, 0x1b, 0xdf, 0xf1, 0xfb, 0x6f, 0x11, 0xd8, 0x04, 0x1c,
-  0x3b, 0xf2, 0x40, 0xac, 0x76, 0xd1, 0xa8, 0x18, 0x14, 0xdb, 0x76, 0xde,
-  0x81, 0x25, 0x06, 0xd1, 0x0a, 0xe6, 0x17, 0xcd, 0xb9, 0x61, 0x0f, 0xfa,
-  0xcd, 0x00, 0xee, 0x45, 0x09, 0xd4, 0x04, 0xd8, 0x2c, 0xb5, 0x34, 0xd9,
-  0x53, 0x18, 0xd5, 0x16, 0x04, 0xde, 0x6c, 0xfa, 0x9f, 0x2d, 0x28, 0xda,
-  0x24, 0xf9, 0x2f, 0xcc, 0xe1, 0x4e, 0xf1, 0xf1, 0x05, 0xfa, 0x0e, 0xf4,
-  0xe8, 0x07, 0xc2, 0x0f, 0xf2, 0xb5, 0xf7, 0xdd, 0xdd, 0xfd, 0xdd, 0x06,
-  0xeb, 0xeb, 0x09, 0x14, 0xff, 0x08, 0xdf, 0xc9, 0x16, 0x02, 0x0e, 0xd8,
-  0xb1, 0x41, 0xf8, 0xfa, 0x1d, 0x1d, 0xf5, 0xf0, 0x09, 0xf4, 0xcc, 0x26,
-  0x0e, 0x20, 0xea, 0xe3, 0x21, 0xcc, 0xc6, 0x0b, 0x1d, 0xe7, 0x2e, 0x06,
-  0xbf, 0x1d, 0x03, 0xe3, 0x02, 0xee, 0xe2, 0xd2, 0x91, 0x2d, 0x01, 0xd7,
-  0x45, 0x13, 0xf2, 0x04, 0x18, 0xf0, 0xd6, 0xdf, 0x23, 0xb0, 0x1d, 0x0a,
-  0xfb, 0xe8, 0xef, 0x22, 0x0c, 0xd9, 0x56, 0xec, 0xf7, 0xee, 0x1b, 0xb1,
-  0xbb, 0x16, 0x4a, 0xdd, 0xd7, 0x3e, 0x01, 0x0a, 0xee, 0x05, 0x3a, 0xcd,
-  0xe9, 0x53, 0x18, 0x05, 0x2c, 0x29, 0xef, 0x7f, 0x40, 0x06, 0x17, 0x19,
-  0x85, 0x25, 0xe6, 0x0d, 0x26, 0x16, 0x12, 0xad, 0xc2, 0x15, 0x09, 0xd5,
-  0x02, 0xfc, 0xfe, 0x13, 0xdc, 0xe0, 0x06, 0xbd, 0x02, 0x42, 0x17, 0xef,
-  0x2b, 0xd9, 0xe4, 0x33, 0x2a, 0xeb, 0xc9, 0xf2, 0xdb, 0x14, 0xf4, 0xfd,
-  0x43, 0xfb, 0x09, 0x93, 0xe2, 0xe9, 0x13, 0xdd, 0xff, 0x23, 0xdb, 0x34,
-  0xfe, 0xff, 0x00, 0x03, 0x07, 0x1f, 0xfd, 0xed, 0x20, 0xe1, 0xc5, 0x0b,
-  0xff, 0x19, 0x49, 0x13, 0x2d, 0xfa, 0x03, 0xe9, 0x25, 0xcc, 0x13, 0xca,
-  0xca, 0x1f, 0x16, 0x2b, 0xf2, 0x27, 0xcc, 0xf4, 0xfb, 0x01, 0x31, 0x0e,
-  0x40, 0x26, 0x0d, 0x02, 0x23, 0x37, 0x0b, 0x3e, 0x06, 0x10, 0xf0, 0x25,
-  0x98, 0x21, 0xec, 0x25, 0x02, 0xf7, 0x22, 0xf8, 0xea, 0x08, 0xe4, 0xfe,
-  0x13, 0x08, 0xeb, 0x2d, 0xe6, 0xd6, 0x1d, 0x1c, 0x58, 0x05, 0x22, 0xec,
-  0x24, 0x0a, 0xff, 0x1a, 0xf5, 0xdc, 0xcb, 0x03, 0xf0, 0x01, 0x13, 0x02,
-  0x0d, 0xd5, 0xfb, 0x15, 0xf4, 0x0c, 0x02, 0xdf, 0x14, 0xf6, 0xe6, 0x2a,
-  0xd2, 0xe3, 0xf1, 0x40, 0x2f, 0x20, 0xe0, 0xa7, 0x2f, 0xc2, 0xe8, 0xbd,
-  0x05, 0xd4, 0x15, 0x32, 0x31, 0xed, 0x2a, 0x14, 0x06, 0xde, 0xec, 0x08,
-  0x31, 0x24, 0xb5, 0x5b, 0x0a, 0x1a, 0xf8, 0x04, 0xf1, 0x05, 0x13, 0xd9,
-  0x71, 0x14, 0xd6, 0xdc, 0x04, 0xce, 0xfa, 0xf5, 0xfd, 0x28, 0x14, 0x1b,
-  0xba, 0xda, 0x1d, 0x36, 0xdc, 0x2c, 0x0c, 0x1a, 0x20, 0x20, 0xb7, 0x35,
-  0x27, 0x09, 0xd9, 0x0b, 0xe3, 0xc4, 0x28, 0xe3, 0x59, 0xf8, 0x01, 0xde,
-  0xf0, 0xc2, 0xfc, 0xdc, 0xf8, 0x0d, 0xdd, 0x21, 0x0a, 0xe7, 0x02, 0x0a,
-  0xfa, 0xea, 0xf7, 0x35, 0x2a, 0x23, 0x11, 0x25, 0x2c, 0xeb, 0xbd, 0xff,
-  0xe2, 0x14, 0xed, 0xf8, 0x3e, 0x24, 0xda, 0xb4, 0x06, 0xae, 0xfc, 0xc1,
-  0x09, 0xfd, 0xc0, 0x11, 0x27, 0xe5, 0x18, 0x26, 0x1c, 0xeb, 0xfc, 0x2a,
-  0xf7, 0x09, 0x1a, 0xc2, 0xf5, 0x37, 0x33, 0xda, 0xb3, 0xdb, 0xdb, 0x4e,
-  0x11, 0x10, 0x01, 0xdb, 0x4e, 0xf1, 0xf4, 0x05, 0x50, 0xf2, 0xd2, 0x64,
-  0xf1, 0x28, 0x42, 0xfe, 0xb7, 0xff, 0xfb, 0xe6, 0x09, 0xd8, 0x05, 0xe8,
-  0x28, 0xd2, 0x58, 0x1f, 0xf2, 0x3a, 0xd3, 0xcf, 0xd1, 0xf2, 0x4d, 0x36,
-  0xcf, 0xfc, 0x4b, 0x2c, 0x0b, 0xeb, 0x21, 0x06, 0x12, 0x2e, 0x1d, 0xdc,
-  0xe0, 0x55, 0xd8, 0x16, 0xd5, 0x01, 0xce, 0x01, 0x11, 0xe3, 0xf6, 0x2a,
-  0x54, 0xcb, 0x13, 0xc6, 0xfb, 0x10, 0x03, 0x12, 0xfd, 0x07, 0x99, 0x16,
-  0xc8, 0xfd, 0x4f, 0xe1, 0xbe, 0x13, 0xe0, 0xff, 0x1d, 0xe1, 0xc5, 0xe5,
-  0x19, 0x28, 0x50, 0x06, 0xf2, 0x29, 0xff, 0xef, 0xb9, 0xda, 0xe7, 0x49,
-  0x02, 0x2a, 0x04, 0x08, 0x5b, 0x2d, 0x25, 0xd8, 0x61, 0x88, 0xe6, 0x0e,
-  0xba, 0x27, 0x3c, 0xff, 0xd1, 0x69, 0xd8, 0xa4, 0x96, 0xb6, 0xdb, 0xf1,
-  0x06, 0x03, 0xe1, 0x73, 0xf5, 0xf7, 0x1e, 0xb8, 0xd2, 0xf7, 0x6a, 0x7f,
-  0xdd, 0xb5, 0x22, 0x33, 0x0b, 0xd9, 0xd9, 0xd7, 0xc7, 0x31, 0x1a, 0xd6,
-  0xd5, 0x69, 0xd9, 0xa5, 0x17, 0x04, 0x0f, 0x4b, 0x60, 0xc4, 0xfd, 0x28,
-  0x25, 0xe5, 0x01, 0xbb, 0x09, 0x25, 0xf7, 0xf3, 0xf2, 0x12, 0xe4, 0x17,
-  0xa8, 0x3c, 0x29, 0xcc, 0xd4, 0x0c, 0xbb, 0x00, 0x41, 0x01, 0xe3, 0x18,
-  0x14, 0x1b, 0xc3, 0x2a, 0xe9, 0xdf, 0xe7, 0x02, 0xeb, 0x02, 0xee, 0x1f,
-  0xf1, 0x30, 0xff, 0x15, 0xf2, 0xd5, 0xf3, 0xd8, 0x32, 0xe3, 0xee, 0xe5,
-  0x11, 0xfb, 0x2e, 0x19, 0xe1, 0x0d, 0xcd, 0xf4, 0xe7, 0xfc, 0xef, 0x1a,
-  0x24, 0xd2, 0xd3, 0x17, 0xfe, 0xf3, 0xc9, 0xe0, 0xfc, 0x35, 0x15, 0x17,
-  0xdd, 0xbd, 0xf1, 0x03, 0x08, 0x2a, 0xee, 0xe4, 0x11, 0xee, 0xee, 0xfa,
-  0xed, 0x14, 0xb1, 0x0b, 0x24, 0xfd, 0xe0, 0x0a, 0x05, 0xc0, 0xfb, 0xd3,
-  0xd4, 0xf7, 0xcd, 0x18, 0xe5, 0x21, 0xe3, 0xd1, 0xf5, 0xee, 0xfc, 0xc3,
-  0xd6, 0x26, 0xd2, 0xea, 0x38, 0xf5, 0xd1, 0x00, 0x00, 0xd1, 0xda, 0x43,
-  0x0e, 0xde, 0x57, 0xe1, 0xbd, 0xf5, 0x0c, 0x11, 0xcc, 0xcb, 0x5c, 0x4b,
-  0xfb, 0x18, 0x3e, 0xf6, 0xe2, 0xec, 0x02, 0x18, 0x0c, 0xe0, 0x81, 0x13,
-  0xfa, 0x34, 0xf6, 0xd9, 0xf0, 0xf9, 0x6f, 0xce, 0xff, 0xff, 0x29, 0xe6,
-  0xb1, 0x19, 0xe8, 0x06, 0xe7, 0x08, 0x18, 0x2c, 0x24, 0x0b, 0x0e, 0x0c,
-  0x42, 0xc1, 0xef, 0x2e, 0x0f, 0xed, 0xed, 0x12, 0xec, 0x0b, 0xba, 0x11,
-  0x15, 0xcc, 0x3b, 0xdd, 0x34, 0x28, 0x0b, 0x06, 0xce, 0x21, 0xd8, 0xa5,
-  0xd9, 0xfa, 0x0b, 0x4e, 0x09, 0x37, 0xc8, 0xc1, 0x60, 0xd7, 0xdd, 0xcb,
-  0x08, 0x5f, 0x15, 0x05, 0xc0, 0xf8, 0xca, 0x26, 0x04, 0xc6, 0xe9, 0xd1,
-  0xd1, 0xdb, 0x07, 0xd3, 0xa2, 0x2d, 0x3b, 0x48, 0xf0, 0xdd, 0x57, 0xec,
-  0x05, 0xda, 0x56, 0xf1, 0xce, 0xfd, 0x2c, 0xde, 0xf3, 0xf4, 0xc6, 0x60,
-  0x44, 0x38, 0x26, 0xdb, 0xee, 0xf1, 0x02, 0xf1, 0x15, 0x06, 0xe5, 0x07,
-  0xf9, 0xf1, 0x1d, 0x42, 0x23, 0x0c, 0x3b, 0xeb, 0x33, 0xf0, 0x29, 0x2b,
-  0x45, 0xd5, 0x05, 0xef, 0xef, 0x10, 0xdc, 0x5e, 0xfb, 0x1d, 0xf1, 0x08,
-  0x27, 0xe1, 0xfa, 0x18, 0x52, 0x2d, 0x09, 0x1b, 0x00, 0xcc, 0xf5, 0x91,
-  0x26, 0xee, 0xfa, 0xe7, 0x0c, 0x3e, 0x97, 0xc8, 0x3a, 0x05, 0xc1, 0xda,
-  0x07, 0x33, 0x0a, 0xf5, 0xb8, 0x0d, 0xc5, 0x3b, 0x38, 0xed, 0xe0, 0x50,
-  0xb3, 0xce, 0xda, 0xad, 0xe1, 0x49, 0x2e, 0x46, 0xf9, 0xd0, 0x53, 0xec,
-  0xb0, 0xfb, 0x50, 0xf7, 0xe6, 0xdc, 0x21, 0xf5, 0x0b, 0x00, 0x15, 0x37,
-  0x31, 0x12, 0xf1, 0xcd, 0xde, 0x0a, 0x05, 0x0f, 0x2d, 0xf1, 0x13, 0xdb,
-  0x70, 0xf8, 0xf8, 0x05, 0xee, 0xfc, 0x15, 0xc7, 0xd7, 0x0a, 0x20, 0xd3,
-  0x05, 0x19, 0xf2, 0x01, 0xd9, 0xfa, 0x4b, 0x29, 0xe4, 0x14, 0xe5, 0xf7,
-  0x27, 0x2a, 0xfb, 0x22, 0x17, 0xf5, 0xf4, 0xec, 0x70, 0xba, 0x05, 0xe4,
-  0x37, 0xf8, 0x44, 0xb2, 0xdc, 0x06, 0xf2, 0xc6, 0xd1, 0x33, 0xc1, 0x1f,
-  0xdd, 0xf7, 0x3a, 0xe3, 0xdd, 0x09, 0xeb, 0xf1, 0x21, 0x40, 0x20, 0x4f,
-  0xe6, 0x00, 0xf3, 0xde, 0xe6, 0xe7, 0x1e, 0xb1, 0xd2, 0x9f, 0xe7, 0xdf,
-  0xdb, 0xd9, 0xac, 0x15, 0xbd, 0xf8, 0x09, 0xbf, 0x99, 0xe0, 0xf1, 0x1e,
-  0xba, 0xcc, 0xff, 0x02, 0xad, 0xde, 0xa9, 0xe2, 0x20, 0xe2, 0xf7, 0xf4,
-  0xb4, 0xea, 0x1c, 0xb1, 0xe1, 0xe0, 0xec, 0xc8, 0xee, 0xa7, 0xe7, 0xe0,
-  0xa8, 0xa0, 0xea, 0xd8, 0xbb, 0xdb, 0xe8, 0x37, 0xd9, 0xcd, 0x28, 0xe7,
-  0x81, 0xf3, 0xbb, 0x3e, 0x1e, 0xdc, 0xe9, 0xf9, 0x9f, 0xcf, 0x08, 0x8d,
-  0xe4, 0xfd, 0xe5, 0x0c, 0xfc, 0xc0, 0xe4, 0xfd, 0x95, 0xd9, 0xec, 0x1f,
-  0xab, 0xfd, 0xef, 0x01, 0xe6, 0xbb, 0x07, 0xec, 0xaa, 0xfb, 0xef, 0x0b,
-  0xf5, 0x23, 0xf0, 0x2e, 0xf8, 0x34, 0x10, 0xe5, 0x01, 0xd3, 0x29, 0x3a,
-  0x26, 0x37, 0xc1, 0x17, 0x24, 0x06, 0x00, 0xfc, 0xf5, 0xf3, 0x0c, 0xff,
-  0xf2, 0xf0, 0x1c, 0x20, 0xe9, 0x13, 0x0f, 0xac, 0x00, 0x1a, 0x1c, 0x33,
-  0xfb, 0x22, 0xf0, 0xef, 0x18, 0xfc, 0x3e, 0x1d, 0x0a, 0x0e, 0xfd, 0xd9,
-  0xf3, 0xff, 0xf7, 0xcc, 0xf9, 0xf0, 0xe4, 0x10, 0x01, 0xfe, 0x20, 0x11,
-  0xdd, 0x49, 0x02, 0x1a, 0x11, 0xee, 0xf1, 0x0e, 0x10, 0xee, 0x02, 0xee,
-  0x24, 0xd6, 0x26, 0x44, 0xfc, 0xe1, 0xf0, 0xc0, 0xab, 0x06, 0xee, 0x1e,
-  0xb3, 0x0e, 0x08, 0xd9, 0xf8, 0xff, 0x09, 0xf5, 0xdb, 0x40, 0xef, 0x0f,
-  0x1c, 0x05, 0xf8, 0x29, 0xe5, 0x11, 0xec, 0xe3, 0xe7, 0xf0, 0x0c, 0x20,
-  0x28, 0x0d, 0xb8, 0xd4, 0x19, 0xed, 0x0a, 0x07, 0x14, 0x12, 0xfa, 0x0b,
-  0xe9, 0xe7, 0xf7, 0x05, 0xef, 0xe5, 0x17, 0xd7, 0x1a, 0x09, 0x13, 0x3d,
-  0xed, 0x1f, 0xf7, 0xf1, 0x1f, 0x3c, 0x11, 0x19, 0x33, 0x2d, 0xde, 0xea,
-  0xff, 0xee, 0x0a, 0x05, 0x3a, 0x12, 0xf9, 0x21, 0xe8, 0xcc, 0x02, 0x00,
-  0xe8, 0x0b, 0x2a, 0x15, 0xf6, 0xed, 0x0d, 0x29, 0x14, 0xcc, 0xee, 0xe0,
-  0x13, 0xe5, 0x42, 0xe0, 0x08, 0xff, 0xe8, 0x02, 0xdf, 0xff, 0x02, 0x12,
-  0xcc, 0x3b, 0x51, 0xf9, 0xf5, 0xd4, 0xf9, 0xe7, 0xf9, 0xf1, 0xe1, 0x42,
-  0xf7, 0xea, 0x1e, 0xe1, 0xe8, 0xfc, 0x1c, 0xe0, 0x10, 0xfa, 0x21, 0x0e,
-  0x03, 0xdc, 0x15, 0x0f, 0x11, 0x07, 0xfd, 0x1f, 0xf0, 0x33, 0x21, 0x22,
-  0xf7, 0x36, 0x2c, 0xcd, 0x1c, 0x25, 0x17, 0x21, 0xba, 0xbb, 0x16, 0xf9,
-  0x0b, 0xfb, 0xff, 0x03, 0xf8, 0x11, 0x3a, 0xfd, 0xfd, 0xeb, 0x16, 0x14,
-  0x06, 0xfd, 0xee, 0x32, 0xe5, 0x35, 0x2e, 0xf1, 0xfd, 0x34, 0xf9, 0xa5,
-  0x0e, 0xee, 0x0d, 0x0c, 0xcf, 0xb7, 0x2f, 0xdf, 0x0c, 0x25, 0x03, 0xfc,
-  0xd5, 0x2c, 0x22, 0xee, 0xef, 0xe2, 0x14, 0xe0, 0x02, 0x0d, 0x15, 0x16,
-  0x00, 0x1e, 0x15, 0xd6, 0x0c, 0x0e, 0x13, 0xd4, 0x12, 0xe9, 0x1f, 0xf6,
-  0x0b, 0xce, 0x31, 0xf9, 0xb9, 0x2b, 0x00, 0x22, 0x20, 0xf7, 0x05, 0x45,
-  0xd2, 0xf0, 0x28, 0x17, 0x13, 0x34, 0xfd, 0xf3, 0x21, 0x08, 0x07, 0x10,
-  0x2c, 0x1d, 0xfc, 0xa8, 0x17, 0x12, 0x0f, 0xe0, 0xf8, 0x97, 0x32, 0xf8,
-  0xf3, 0xf0, 0x03, 0x03, 0x11, 0x05, 0x02, 0x12, 0xbc, 0xfa, 0x0a, 0x03,
-  0x1a, 0x25, 0xd8, 0x29, 0x0b, 0x30, 0x18, 0x01, 0x14, 0x1a, 0xf3, 0x8b,
-  0xf9, 0xfd, 0xed, 0x01, 0xd0, 0x81, 0x18, 0xc5, 0x09, 0xfc, 0x03, 0x16,
-  0xf7, 0x37, 0xf3, 0xfc, 0xdd, 0xdc, 0x11, 0x0c, 0xde, 0x11, 0x00, 0x17,
-  0xf7, 0x26, 0x11, 0xe0, 0x06, 0x0e, 0x13, 0xba, 0xff, 0xf8, 0xe1, 0x1e,
-  0x1d, 0xcf, 0x1f, 0x02, 0x08, 0x27, 0x09, 0x2d, 0x10, 0x19, 0xf1, 0x29,
-  0xd0, 0xf9, 0x1a, 0xf7, 0x00, 0x0b, 0x21, 0xec, 0x19, 0x11, 0x0a, 0xfa,
-  0x12, 0x05, 0x06, 0xb4, 0x08, 0x07, 0x03, 0xee, 0x23, 0xbc, 0x29, 0xf1,
-  0x04, 0x17, 0x0e, 0xed, 0x0f, 0x08, 0x0c, 0xf4, 0xcb, 0x20, 0x13, 0x09,
-  0x30, 0x1c, 0x00, 0xfc, 0xfa, 0x20, 0x13, 0x02, 0xfa, 0x0e, 0xe9, 0xbc,
-  0x00, 0xe0, 0xf8, 0xfe, 0xf9, 0xa8, 0x1c, 0xc0, 0xf4, 0x1c, 0xfd, 0xdb,
-  0x22, 0x3b, 0x0e, 0xda, 0xc1, 0xfc, 0x0a, 0x09, 0xf0, 0x28, 0xfb, 0xf1,
-  0x0b, 0x13, 0x01, 0x05, 0xed, 0xf1, 0x19, 0xc3, 0xf9, 0x02, 0xdb, 0x12,
-  0x27, 0x1f, 0x2c, 0x3c, 0x20, 0x10, 0xbe, 0xcc, 0xef, 0x59, 0xe7, 0xc5,
-  0x1d, 0x41, 0xd5, 0xd6, 0x18, 0xbe, 0xd1, 0xb9, 0x23, 0x47, 0x39, 0xe3,
-  0x4a, 0xd5, 0xf9, 0x12, 0x31, 0x1f, 0x3a, 0x8a, 0x1e, 0x23, 0x2a, 0xfd,
-  0x09, 0x06, 0xc3, 0xcc, 0xea, 0xe4, 0xef, 0xda, 0x15, 0x1f, 0xee, 0xf8,
-  0x35, 0xc2, 0xe3, 0x1a, 0xfc, 0x57, 0x41, 0xe6, 0xfd, 0xe2, 0xc6, 0x26,
-  0x1b, 0x22, 0x2d, 0xa6, 0x2a, 0x16, 0x31, 0xcd, 0x1e, 0xf7, 0xbc, 0xee,
-  0xe1, 0x06, 0x16, 0xf6, 0x23, 0x2f, 0xd7, 0xd4, 0x0d, 0xe5, 0xd9, 0x2c,
-  0xd8, 0x5d, 0x06, 0x12, 0xc5, 0xe2, 0xbd, 0x07, 0x20, 0xef, 0x39, 0xa9,
-  0x23, 0x01, 0x49, 0x0c, 0xfa, 0x24, 0xd2, 0xea, 0xd5, 0xfe, 0xc9, 0xfa,
-  0xfc, 0x0a, 0xc5, 0xe2, 0x17, 0xe4, 0xd0, 0xed, 0xdf, 0xad, 0xbc, 0x18,
-  0x21, 0xc9, 0x7f, 0xfd, 0x09, 0x20, 0xf5, 0xab, 0xc9, 0x06, 0x26, 0xeb,
-  0xe8, 0x0b, 0xbf, 0xd9, 0xca, 0xcc, 0xbf, 0xda, 0xd3, 0xfa, 0xd7, 0x2d,
-  0x27, 0xb8, 0xb5, 0x0c, 0xdc, 0xef, 0xeb, 0xdb, 0xed, 0xeb, 0x2d, 0x05,
-  0xfe, 0x21, 0xd5, 0xa8, 0xbf, 0xe6, 0xe4, 0xe6, 0x0c, 0xa8, 0xe7, 0x07,
-  0x16, 0xeb, 0x13, 0xc9, 0xf3, 0x0a, 0xdc, 0xd2, 0xb5, 0x2d, 0xdc, 0x2b,
-  0xcd, 0x50, 0x07, 0xce, 0xb8, 0xe5, 0xc9, 0xe7, 0x20, 0xed, 0xfa, 0xda,
-  0xf8, 0xf3, 0xaf, 0xf7, 0xe1, 0x5a, 0xe0, 0x0d, 0xd3, 0x0a, 0xe7, 0x02,
-  0xda, 0xcc, 0xfe, 0xc8, 0x1e, 0x04, 0xdd, 0x18, 0xff, 0xb7, 0xaf, 0xf3,
-  0x12, 0x08, 0x53, 0xdd, 0xd6, 0x3e, 0xf9, 0xb7, 0xc7, 0xcd, 0xc3, 0xe3,
-  0xcf, 0x1c, 0xcd, 0x0d, 0xdb, 0xf9, 0xeb, 0xfa, 0xab, 0xe2, 0xe6, 0x19,
-  0x0a, 0xde, 0xd4, 0x0e, 0x11, 0xd8, 0xdb, 0x0b, 0x1b, 0xe6, 0x3f, 0xdd,
-  0xf5, 0x25, 0xcf, 0xd3, 0x8a, 0xcd, 0xb1, 0xde, 0xcd, 0xbc, 0xe5, 0x1b,
-  0x16, 0x1c, 0x16, 0xaa, 0xf8, 0xff, 0xf8, 0xb1, 0xc2, 0x18, 0xfd, 0xde,
-  0xd3, 0x21, 0x04, 0xb5, 0xe7, 0x04, 0xc6, 0xe9, 0x10, 0x10, 0x15, 0x02,
-  0x52, 0x27, 0x03, 0x3c, 0xda, 0xfc, 0x01, 0xbd, 0x03, 0x67, 0x19, 0x11,
-  0xc4, 0x39, 0xbe, 0xc2, 0x11, 0x30, 0x29, 0x19, 0xa4, 0x43, 0x47, 0xd5,
-  0x28, 0xdb, 0xce, 0x40, 0x3d, 0x48, 0xe5, 0x68, 0x54, 0x58, 0x13, 0x30,
-  0x42, 0xec, 0x97, 0x91, 0xc8, 0x26, 0x4a, 0xf4, 0xf9, 0x02, 0xfc, 0x98,
-  0x13, 0x20, 0xfc, 0x54, 0xb6, 0x36, 0x29, 0xcc, 0x21, 0xfd, 0xb9, 0x31,
-  0x23, 0x0d, 0xde, 0x1a, 0xdc, 0x04, 0x1e, 0x1e, 0xe9, 0x02, 0xf1, 0xdc,
-  0xca, 0x1a, 0x3e, 0xc6, 0x10, 0x10, 0x46, 0x08, 0xef, 0x03, 0xdd, 0x6c,
-  0xf6, 0xfe, 0xb9, 0xfd, 0x0f, 0x2e, 0xe1, 0xfe, 0xf4, 0xeb, 0x40, 0xa1,
-  0x3e, 0x23, 0xf8, 0x40, 0xd7, 0x1b, 0x30, 0xfb, 0x22, 0x27, 0xd0, 0x7f,
-  0xdc, 0xfb, 0xc9, 0x2d, 0x22, 0x15, 0x25, 0xda, 0x0f, 0xe9, 0xfb, 0xe0,
-  0x1d, 0xd9, 0x35, 0x44, 0x15, 0x70, 0x11, 0x66, 0x45, 0x5c, 0x15, 0x47,
-  0x36, 0xe0, 0xbc, 0x8a, 0x13, 0x29, 0xee, 0x5b, 0x0e, 0x24, 0xc9, 0xfa,
-  0x0c, 0x5b, 0xb5, 0xfd, 0x01, 0xf5, 0x20, 0xed, 0x22, 0xd4, 0xfc, 0x42,
-  0x23, 0x14, 0xd1, 0x60, 0xd5, 0x12, 0x05, 0x00, 0x28, 0x25, 0xf1, 0xef,
-  0x27, 0x00, 0xfb, 0x0e, 0x0c, 0xe4, 0x3d, 0x31, 0xff, 0x3b, 0xe1, 0x48,
-  0x34, 0xd9, 0x01, 0x40, 0x06, 0x3a, 0xf4, 0x02, 0xf9, 0x0d, 0x1f, 0x19,
-  0x44, 0xf7, 0xdb, 0x2f, 0xeb, 0x1b, 0xf6, 0x0b, 0xfd, 0x8e, 0xdc, 0x60,
-  0xe9, 0xc1, 0xd2, 0xf8, 0xee, 0xc1, 0xee, 0xf7, 0x07, 0xef, 0xd2, 0xd9,
-  0x05, 0x04, 0x21, 0x0c, 0xdf, 0x31, 0xe4, 0x47, 0x7b, 0x23, 0x02, 0x2d,
-  0xf2, 0xe6, 0xef, 0xc4, 0xed, 0xf4, 0x05, 0xdc, 0x23, 0x14, 0xbc, 0x44,
-  0x23, 0xd7, 0xe9, 0xe0, 0x26, 0x2f, 0xf4, 0x30, 0x01, 0x00, 0xce, 0x1b,
-  0xf2, 0x03, 0xe0, 0x16, 0x17, 0xf2, 0x03, 0xd3, 0xea, 0x05, 0xf1, 0xf2,
-  0xfd, 0xed, 0xef, 0xa9, 0x14, 0xd8, 0x33, 0x22, 0xfb, 0xc9, 0xca, 0x00,
-  0x33, 0xe6, 0xdd, 0x24, 0x05, 0x0a, 0xcc, 0xee, 0xda, 0xd4, 0x08, 0x02,
-  0xe2, 0xf4, 0xf4, 0xd9, 0x0e, 0x04, 0x00, 0xf0, 0xf4, 0xf3, 0x00, 0xf2,
-  0x08, 0xd8, 0x06, 0x08, 0xd7, 0xe7, 0xe7, 0xe6, 0xd9, 0xde, 0xff, 0x06,
-  0x25, 0x0f, 0xe7, 0xf9, 0xd5, 0x30, 0x08, 0x26, 0xe0, 0xce, 0xd1, 0xd8,
-  0x1d, 0xdf, 0xfc, 0x1f, 0xcf, 0xe6, 0xfe, 0xf5, 0xfc, 0xe7, 0x2d, 0x37,
-  0xbb, 0xfe, 0xf5, 0xf3, 0xdb, 0xf6, 0xf2, 0xef, 0x3c, 0x11, 0x14, 0xcf,
-  0xce, 0x41, 0x22, 0xea, 0x05, 0xe5, 0xff, 0xf2, 0xd4, 0x02, 0xfe, 0x10,
-  0xef, 0xbd, 0xf1, 0xef, 0xdb, 0xf1, 0x0e, 0xe7, 0xe0, 0x02, 0xc9, 0xe7,
-  0xe3, 0xe7, 0xed, 0xf1, 0x1f, 0xfc, 0xd3, 0xfd, 0xcf, 0xf8, 0x28, 0x07,
-  0x8e, 0xb2, 0xd1, 0x39, 0x18, 0xfc, 0xfa, 0x1c, 0x32, 0xd9, 0x16, 0xd6,
-  0xd4, 0xbd, 0x16, 0xd0, 0xce, 0x45, 0xda, 0x55, 0xfd, 0x16, 0x3e, 0xec,
-  0xe2, 0x01, 0x15, 0x85, 0x31, 0xdf, 0xfc, 0xf9, 0xd7, 0x83, 0xed, 0x1b,
-  0xe3, 0x02, 0x2d, 0x1d, 0x1c, 0x24, 0x2f, 0x33, 0xdd, 0xc6, 0x4f, 0x2d,
-  0xe2, 0x39, 0x0a, 0x04, 0x48, 0x17, 0x13, 0x0d, 0xbd, 0x19, 0x55, 0x81,
-  0xf5, 0x12, 0xf0, 0xa8, 0x28, 0xbd, 0xff, 0xf2, 0xaa, 0x45, 0x49, 0xe9,
-  0xf7, 0x0a, 0xe1, 0x28, 0xe3, 0xd3, 0xf3, 0xdf, 0x2d, 0x0c, 0xf9, 0xae,
-  0x2e, 0xde, 0xee, 0x11, 0xc8, 0xf9, 0x55, 0xe5, 0xe9, 0xf4, 0xe8, 0xef,
-  0x15, 0x28, 0xf0, 0x1b, 0xdf, 0x08, 0xf9, 0xd5, 0x20, 0x44, 0x0e, 0xcc,
-  0x3b, 0x09, 0xee, 0xd7, 0x25, 0x21, 0xe0, 0x25, 0x14, 0x15, 0xe3, 0x24,
-  0x21, 0x04, 0xb7, 0x2d, 0x2b, 0x31, 0xe6, 0xfe, 0x40, 0x3a, 0x36, 0x21,
-  0x11, 0x0f, 0x16, 0xf9, 0xef, 0xdd, 0x42, 0xd7, 0x21, 0x17, 0x1a, 0xe1,
-  0x36, 0xa4, 0xf0, 0x34, 0x1f, 0x08, 0xcd, 0x35, 0x2f, 0x15, 0xe1, 0x38,
-  0x29, 0x1e, 0xc7, 0xe4, 0x4f, 0x31, 0x1e, 0x08, 0x2f, 0x12, 0x0d, 0xea,
-  0xf8, 0x06, 0x1a, 0xea, 0x35, 0x0e, 0xc9, 0xc2, 0x3a, 0xea, 0xf1, 0x1a,
-  0x1a, 0xf7, 0x3a, 0xfd, 0x41, 0xf3, 0xed, 0x19, 0x28, 0xd5, 0xf4, 0xe1,
-  0xe0, 0xe9, 0x01, 0xdf, 0x2a, 0xb6, 0xbe, 0xfb, 0x46, 0x47, 0x05, 0xd5,
-  0xdf, 0xff, 0xd6, 0x0e, 0x04, 0xf2, 0xbe, 0x64, 0xf3, 0xe6, 0xc2, 0xde,
-  0x94, 0xa7, 0xd6, 0xc5, 0x0b, 0x62, 0x04, 0x04, 0xdf, 0xed, 0xb2, 0xcd,
-  0xb1, 0x1e, 0xb1, 0x02, 0xf2, 0xf4, 0xc6, 0xea, 0x1e, 0x0c, 0xe6, 0x2b,
-  0xfb, 0xf2, 0xa4, 0xf3, 0xc1, 0x12, 0x01, 0xc2, 0xaf, 0x86, 0xb9, 0xd2,
-  0xef, 0x72, 0xd8, 0x43, 0xba, 0xd2, 0xf0, 0xd2, 0xdb, 0x43, 0x12, 0x26,
-  0xc8, 0x26, 0xfa, 0x4c, 0x17, 0xf0, 0x0e, 0xe9, 0x44, 0x24, 0xf2, 0xca,
-  0x15, 0xd7, 0x01, 0x0f, 0x82, 0xe7, 0xfa, 0x02, 0x2a, 0x0f, 0xfd, 0xea,
-  0x09, 0x07, 0x57, 0xf8, 0x5e, 0xbf, 0xcc, 0xc5, 0x3e, 0xd4, 0xba, 0x0e,
-  0x08, 0x36, 0xa6, 0x9e, 0x05, 0x1a, 0xe6, 0x3e, 0xd7, 0xd4, 0xdd, 0x3e,
-  0xa1, 0xc7, 0x08, 0xf5, 0x0e, 0x43, 0x0f, 0x4d, 0x0f, 0x0b, 0xfd, 0x19,
-  0x57, 0x19, 0xcb, 0xc2, 0xfb, 0x0c, 0xb7, 0x55, 0x19, 0x2f, 0x81, 0x09,
-  0x57, 0xd5, 0xb2, 0xda, 0xa8, 0xd3, 0xe1, 0x3f, 0xdc, 0xc7, 0xf6, 0x01,
-  0x4a, 0x57, 0xc5, 0x49, 0xe8, 0x0f, 0x0c, 0xf6, 0xf5, 0x2a, 0xff, 0xcf,
-  0x19, 0x1a, 0x2b, 0x1f, 0x30, 0x2a, 0xd3, 0xda, 0x55, 0xeb, 0xce, 0xe2,
-  0x35, 0xcb, 0xfc, 0x41, 0xb6, 0x01, 0x26, 0x10, 0x19, 0xb2, 0xc9, 0xe7,
-  0xdb, 0xf1, 0x35, 0xf2, 0x1f, 0x2a, 0xef, 0xfe, 0xf6, 0xe4, 0xd5, 0x00,
-  0xf6, 0xe5, 0xf6, 0xbf, 0x19, 0x07, 0x15, 0xdb, 0x07, 0xae, 0xb4, 0x32,
-  0xd9, 0x02, 0x32, 0xdc, 0x01, 0x54, 0x12, 0x37, 0x0f, 0xd4, 0x19, 0xf1,
-  0x43, 0x1f, 0xf4, 0xe5, 0xe9, 0xea, 0x1e, 0xfd, 0x30, 0xe9, 0x03, 0x05,
-  0x2f, 0xc6, 0xed, 0xd7, 0xec, 0x17, 0xf1, 0x40, 0x89, 0x07, 0xd5, 0xd4,
-  0x33, 0x2f, 0xf6, 0x4a, 0x1f, 0xc7, 0xf2, 0xe4, 0xf5, 0x07, 0xfe, 0x03,
-  0x30, 0x06, 0x36, 0x06, 0x31, 0x1d, 0x0a, 0xf5, 0xfd, 0xd2, 0xc7, 0x27,
-  0x39, 0xfb, 0x1d, 0x31, 0xa9, 0x07, 0xcd, 0xe9, 0x14, 0xd3, 0xb0, 0x21,
-  0x15, 0xf8, 0xea, 0x06, 0xee, 0xe3, 0x08, 0xf9, 0x09, 0x09, 0x01, 0x18,
-  0xed, 0x09, 0xf8, 0xdf, 0x00, 0x13, 0xf3, 0xfe, 0xfc, 0x18, 0x09, 0x0e,
-  0x12, 0x08, 0xfd, 0xff, 0x17, 0xe0, 0xd2, 0x29, 0x12, 0x2b, 0xf0, 0x0c,
-  0xeb, 0x0d, 0x0a, 0xf7, 0xd8, 0x01, 0xff, 0x08, 0x23, 0x1d, 0xe1, 0xfa,
-  0x1f, 0x05, 0x07, 0x13, 0x23, 0xf7, 0x13, 0xfd, 0x0a, 0x18, 0xd2, 0x2c,
-  0x3b, 0xf4, 0x03, 0xd1, 0x22, 0x0f, 0x0f, 0x07, 0xfc, 0x04, 0x19, 0x1e,
-  0xf7, 0x13, 0xfd, 0xc9, 0x09, 0x07, 0xf6, 0x1d, 0x01, 0x0f, 0x1c, 0x12,
-  0x05, 0x07, 0x14, 0x09, 0xdf, 0x01, 0xed, 0xfc, 0x1f, 0x15, 0x03, 0xfd,
-  0xfc, 0x0b, 0x09, 0xf7, 0xeb, 0xf7, 0xfb, 0x00, 0xd6, 0x12, 0xf2, 0x3a,
-  0x12, 0xf9, 0x08, 0xfe, 0x2a, 0x13, 0x0c, 0xe1, 0xf4, 0xfe, 0x03, 0x08,
-  0xf0, 0x07, 0xf2, 0x00, 0xee, 0xf9, 0xfa, 0xf4, 0xc5, 0xe3, 0xf0, 0x0a,
-  0xfb, 0x1b, 0xdf, 0x0c, 0xeb, 0x18, 0x36, 0x16, 0xff, 0x04, 0x07, 0x20,
-  0x16, 0x06, 0xf7, 0xf9, 0x10, 0x24, 0xfa, 0x17, 0x18, 0x09, 0xe3, 0xe6,
-  0xfe, 0x10, 0x13, 0xe4, 0xec, 0xee, 0xf2, 0x0c, 0x0d, 0xf6, 0x0d, 0x00,
-  0xf9, 0x09, 0x2c, 0xf0, 0xf9, 0x08, 0x02, 0x0e, 0xfd, 0x23, 0x14, 0x02,
-  0xe9, 0x07, 0x16, 0x1f, 0xfe, 0xfc, 0xcc, 0x01, 0xe6, 0xf6, 0xde, 0x06,
-  0xd3, 0xdf, 0x0e, 0xd9, 0x12, 0xcd, 0x0c, 0x03, 0xfc, 0xf9, 0x0c, 0xee,
-  0xd0, 0xe1, 0x11, 0xf7, 0xbc, 0x04, 0x01, 0xe5, 0xe6, 0x25, 0x1b, 0xe4,
-  0xe7, 0x02, 0xf0, 0xd1, 0xd2, 0x17, 0x08, 0xe9, 0xe8, 0x9a, 0xea, 0xe7,
-  0x1e, 0xf4, 0xf5, 0x2b, 0x23, 0xf6, 0xf0, 0x19, 0xae, 0xb3, 0x2c, 0x0b,
-  0xb3, 0xf4, 0x23, 0xe3, 0x02, 0x42, 0xf8, 0xe9, 0x10, 0xfa, 0x76, 0x81,
-  0xa4, 0x3b, 0xdb, 0x47, 0xdd, 0xb1, 0xf7, 0xe4, 0xe3, 0xf1, 0xd7, 0xef,
-  0x32, 0xf8, 0xe6, 0x40, 0xb2, 0xd3, 0x02, 0x1c, 0xd6, 0xef, 0xf8, 0xda,
-  0xfe, 0xf9, 0xf5, 0x05, 0x1e, 0xe4, 0x08, 0xe2, 0xb8, 0xd5, 0xe0, 0x0d,
-  0x47, 0xf9, 0xe6, 0x23, 0x01, 0x0b, 0x16, 0x15, 0x0c, 0x33, 0xda, 0xd8,
-  0xeb, 0xe2, 0xf0, 0xf8, 0xeb, 0xd2, 0x1f, 0xf1, 0xf1, 0xed, 0x0e, 0x04,
-  0x0b, 0xe3, 0x3b, 0xf9, 0xfd, 0x23, 0x06, 0x2b, 0x38, 0xea, 0x23, 0x11,
-  0xfa, 0xf1, 0xe0, 0xd4, 0xf5, 0x40, 0xf4, 0xc9, 0xf1, 0xea, 0xe7, 0xf9,
-  0xd6, 0xf6, 0xeb, 0xd1, 0xe4, 0x0a, 0x1e, 0x0e, 0xfe, 0xd1, 0x2d, 0xe2,
-  0xf9, 0x26, 0xe8, 0x14, 0xfc, 0xe1, 0x42, 0x03, 0xf7, 0xd8, 0xe1, 0xcc,
-  0xf5, 0x4f, 0xf3, 0xda, 0xf9, 0xf1, 0xab, 0xc7, 0xb6, 0x20, 0x16, 0xca,
-  0xd0, 0x19, 0x24, 0xdd, 0x0d, 0xb4, 0xec, 0xee, 0x00, 0x1c, 0xe1, 0x1c,
-  0x47, 0xd4, 0x0c, 0x08, 0x08, 0xee, 0x1b, 0x01, 0xc0, 0x33, 0x3c, 0xd4,
-  0xcd, 0xe2, 0xe9, 0x20, 0xc2, 0xd8, 0x09, 0xee, 0x04, 0x21, 0x23, 0x18,
-  0x13, 0xfb, 0x2f, 0xcd, 0x17, 0x14, 0xe7, 0x34, 0xd5, 0xba, 0xda, 0x12,
-  0x06, 0x06, 0xe5, 0xf9, 0x0a, 0x47, 0x4a, 0xaf, 0xdd, 0xd3, 0xf6, 0x15,
-  0xaa, 0x05, 0xd0, 0x1a, 0xc6, 0x29, 0x35, 0x08, 0xf8, 0xd7, 0xfe, 0xb9,
-  0x26, 0x1f, 0xd9, 0x25, 0xa8, 0xc5, 0xea, 0x01, 0x12, 0x0a, 0x0a, 0x29,
-  0x36, 0x3d, 0x3f, 0xbe, 0xe2, 0xe0, 0xe8, 0x0f, 0xa3, 0x2b, 0xfe, 0x0a,
-  0xd9, 0x52, 0x39, 0xd5, 0xf4, 0x04, 0xdb, 0xd5, 0x20, 0x22, 0x1e, 0xdf,
-  0xa2, 0xd8, 0x28, 0xee, 0x07, 0x39, 0x1f, 0x49, 0xed, 0xf8, 0x34, 0xfd,
-  0xe8, 0xe2, 0x1d, 0x7f, 0xed, 0xb7, 0x03, 0x12, 0xfb, 0xd9, 0xf9, 0x18,
-  0xbd, 0xfa, 0x18, 0xc7, 0x18, 0xd4, 0xe7, 0xe5, 0xab, 0xdb, 0xcb, 0xe2,
-  0xbb, 0x37, 0x23, 0x27, 0x1c, 0xf6, 0x25, 0xf5, 0xec, 0xe8, 0x27, 0x63,
-  0xfc, 0xec, 0xee, 0x06, 0x16, 0x02, 0x27, 0xf8, 0xaa, 0x14, 0xf4, 0xea,
-  0x16, 0xec, 0x03, 0xc2, 0xc5, 0xf9, 0xc2, 0xeb, 0x06, 0x2c, 0x1a, 0x0a,
-  0x09, 0xee, 0xff, 0xf3, 0x02, 0xf0, 0x1d, 0x1a, 0xf9, 0xea, 0x05, 0x35,
-  0x0b, 0xfc, 0x21, 0xf5, 0xde, 0x1d, 0xe7, 0xfe, 0xf2, 0xf4, 0x00, 0xdd,
-  0xe5, 0xe3, 0xc6, 0x02, 0x46, 0xce, 0xcd, 0x34, 0x26, 0xfb, 0xe2, 0x40,
-  0xfb, 0xd5, 0x17, 0xbf, 0xd1, 0xd4, 0xe5, 0x07, 0x33, 0x1c, 0xf6, 0xa4,
-  0x20, 0x20, 0x00, 0xd9, 0x04, 0x4c, 0x0e, 0x18, 0xab, 0xfe, 0x0c, 0x06,
-  0xff, 0xcd, 0x0a, 0x34, 0x21, 0xf8, 0xfd, 0xe7, 0x3d, 0xf2, 0x18, 0xf6,
-  0x05, 0x1f, 0xd3, 0x3a, 0x3e, 0x2a, 0xf5, 0xb5, 0x1c, 0x29, 0xe0, 0x11,
-  0x19, 0xd1, 0x19, 0xdf, 0x10, 0x2a, 0x22, 0x43, 0xd4, 0x5b, 0x04, 0xd2,
-  0xe2, 0xe1, 0x01, 0x00, 0x66, 0x00, 0xc5, 0x5e, 0x3f, 0xe8, 0xef, 0xf4,
-  0x3c, 0x15, 0xfc, 0x0c, 0x10, 0xfb, 0x02, 0x21, 0xfc, 0xf8, 0x51, 0xeb,
-  0x37, 0xd6, 0xed, 0xf1, 0x6e, 0xdc, 0x2a, 0x29, 0x03, 0xfa, 0x0a, 0xfb,
-  0xda, 0xbb, 0x4d, 0xcf, 0xb5, 0x0e, 0x1d, 0xe0, 0xe6, 0xc2, 0x0d, 0xe2,
-  0x0c, 0x2b, 0x56, 0xc8, 0xe9, 0x7f, 0xf8, 0x2e, 0xfb, 0xed, 0xd3, 0x45,
-  0x2b, 0x01, 0x09, 0x02, 0x2d, 0x13, 0x10, 0x05, 0x23, 0x06, 0x32, 0xe0,
-  0xe4, 0x00, 0x0e, 0x04, 0x2f, 0x06, 0x22, 0xd6, 0x26, 0x1e, 0xfd, 0xf0,
-  0x1d, 0x09, 0xf1, 0x3e, 0x13, 0x0e, 0x12, 0x40, 0xde, 0x3e, 0xe6, 0xba,
-  0xd6, 0xfd, 0x21, 0x10, 0x1d, 0x1e, 0xba, 0x24, 0x4e, 0xc3, 0x0d, 0xe8,
-  0x53, 0x03, 0x1c, 0x35, 0xed, 0xf4, 0x00, 0x0d, 0xe9, 0xba, 0xed, 0xfc,
-  0xdb, 0xf1, 0xc5, 0xea, 0x14, 0x0e, 0x26, 0x25, 0x16, 0xe1, 0x07, 0xf4,
-  0xcb, 0xff, 0x2c, 0xf5, 0x01, 0xc3, 0x0f, 0x0c, 0xe8, 0x1b, 0x25, 0x16,
-  0x22, 0x05, 0xf7, 0xe6, 0x03, 0x0c, 0xf0, 0xfc, 0x07, 0xf1, 0xcb, 0x41,
-  0xed, 0x05, 0x18, 0x04, 0x17, 0x06, 0x1b, 0xcd, 0xec, 0x0e, 0xf7, 0xe1,
-  0xfe, 0xd2, 0x23, 0x17, 0xf0, 0x29, 0x3d, 0x14, 0x01, 0xea, 0xfd, 0xee,
-  0x1f, 0x2f, 0xe2, 0x28, 0x1a, 0xf9, 0xfb, 0x24, 0xbf, 0x16, 0xf6, 0xd1,
-  0xea, 0x4c, 0x3a, 0x10, 0x06, 0x18, 0xd6, 0x3b, 0xf2, 0xc5, 0x32, 0x0b,
-  0x21, 0x03, 0x3b, 0x1c, 0x2c, 0xd1, 0xfc, 0xff, 0xfd, 0xf9, 0xe6, 0x08,
-  0x16, 0x0e, 0xf1, 0xcf, 0xfa, 0x1f, 0xcc, 0xe7, 0xfa, 0x06, 0xc8, 0xde,
-  0x21, 0x1c, 0xea, 0xca, 0x0c, 0xd5, 0x07, 0x24, 0xff, 0xeb, 0xbd, 0xe5,
-  0xf9, 0x16, 0xe1, 0x00, 0xfa, 0x28, 0x33, 0xe4, 0x22, 0x17, 0xfd, 0x1b,
-  0x09, 0xfe, 0xfe, 0x29, 0x06, 0x04, 0xd9, 0xc5, 0x46, 0x24, 0xf6, 0xd1,
-  0x08, 0x20, 0x20, 0x03, 0x1b, 0xf1, 0xc7, 0xe0, 0x0f, 0x17, 0x1f, 0x0c,
-  0x12, 0x2c, 0x51, 0x00, 0x33, 0x0f, 0x00, 0xf4, 0xfc, 0xfe, 0x16, 0x13,
-  0x05, 0xff, 0xd8, 0xf5, 0x21, 0x20, 0xe3, 0x09, 0x17, 0xfc, 0xfa, 0xc1,
-  0xfc, 0xe4, 0x17, 0xef, 0xfc, 0x01, 0xfb, 0x0c, 0xed, 0x2d, 0x1e, 0xed,
-  0x0b, 0x10, 0xf8, 0x0b, 0xcf, 0x00, 0xd9, 0xe2, 0x02, 0x19, 0xdd, 0x06,
-  0x30, 0x2c, 0xcd, 0xda, 0xfc, 0xec, 0xde, 0x1d, 0x02, 0x2c, 0x07, 0xb8,
-  0x04, 0xd7, 0xb9, 0x08, 0x28, 0x35, 0xf5, 0x05, 0xfb, 0x0f, 0x07, 0x2d,
-  0xfd, 0xfd, 0xf9, 0x17, 0x0e, 0x0c, 0x0b, 0x0d, 0x38, 0x21, 0xfa, 0xcd,
-  0xfe, 0x44, 0x26, 0xff, 0xff, 0xdb, 0xe3, 0xd6, 0x04, 0xef, 0x0d, 0x04,
-  0x22, 0x33, 0xea, 0x1b, 0x16, 0x01, 0x02, 0x14, 0xf6, 0xe7, 0x26, 0x01,
-  0x1d, 0xf4, 0xf0, 0x1e, 0x0b, 0x0e, 0x12, 0xf8, 0x0d, 0xdb, 0xfc, 0xae,
-  0xec, 0x05, 0xf9, 0xb4, 0xf7, 0xfc, 0xdf, 0x14, 0x0c, 0x3d, 0xfb, 0x1f,
-  0xd9, 0x09, 0xdd, 0x09, 0xb9, 0xd8, 0xe7, 0xe3, 0x07, 0xf3, 0xed, 0x4a,
-  0x4d, 0x2c, 0xf3, 0x27, 0x00, 0x1f, 0xd1, 0x32, 0xe7, 0xfa, 0xf2, 0xab,
-  0x0c, 0x02, 0xee, 0x0a, 0x23, 0xf2, 0x08, 0x3c, 0xbf, 0x0d, 0xed, 0x23,
-  0xfb, 0xe2, 0xdb, 0x0a, 0x29, 0xf9, 0xfb, 0x65, 0x35, 0x2d, 0x1b, 0xe4,
-  0xea, 0x57, 0x17, 0xf6, 0xf9, 0xda, 0xb9, 0xa9, 0x35, 0x17, 0x57, 0x02,
-  0xf7, 0x21, 0xee, 0x56, 0xe8, 0x0a, 0xf1, 0x26, 0xef, 0xe5, 0x07, 0xf6,
-  0x1b, 0xe3, 0xd9, 0x65, 0x01, 0x10, 0x18, 0xdd, 0xf8, 0x03, 0x23, 0xc5,
-  0x05, 0xd6, 0xcf, 0x9c, 0x1f, 0x2e, 0x2e, 0x0f, 0xe8, 0x28, 0xea, 0x7f,
-  0xba, 0x0d, 0xe1, 0x1a, 0x79, 0xde, 0xde, 0xe7, 0x1c, 0x15, 0x2a, 0xf5,
-  0x04, 0xe7, 0x36, 0xf0, 0xd1, 0x1a, 0x1d, 0xfc, 0xb7, 0x13, 0x09, 0xca,
-  0x01, 0x08, 0xc2, 0x0c, 0xfa, 0xed, 0xec, 0xf9, 0xc6, 0xf2, 0xca, 0x3d,
-  0x39, 0xb9, 0xfd, 0x01, 0x02, 0x0c, 0x14, 0xd4, 0xf1, 0xc9, 0x18, 0x07,
-  0x81, 0x20, 0xf9, 0x06, 0x89, 0x28, 0x0f, 0xbb, 0x04, 0x04, 0x0c, 0xc4,
-  0x05, 0xfc, 0xe9, 0x06, 0xc0, 0xc0, 0xa9, 0x15, 0x35, 0x9c, 0xe0, 0x06,
-  0x13, 0x00, 0x07, 0xcd, 0xe8, 0xdd, 0x1a, 0xd8, 0x8e, 0x22, 0xd5, 0x48,
-  0xbb, 0x0d, 0x20, 0xcd, 0xe3, 0xe3, 0xdd, 0xd1, 0x0e, 0xcf, 0x04, 0x0f,
-  0xc3, 0xe1, 0xd8, 0x17, 0x64, 0xc5, 0xc9, 0xf3, 0x1e, 0x07, 0x20, 0xe5,
-  0xe4, 0xaf, 0x24, 0xb2, 0x94, 0x32, 0xf4, 0x16, 0xb4, 0x1c, 0x61, 0x9c,
-  0xeb, 0xca, 0xb3, 0xe4, 0xfd, 0xf8, 0x00, 0x08, 0xb8, 0xe6, 0xb4, 0x10,
-  0x2c, 0xc2, 0xda, 0xe8, 0x25, 0x1c, 0x12, 0xfc, 0xe7, 0x9f, 0x1e, 0x05,
-  0xae, 0x4a, 0xd9, 0x1f, 0xa5, 0x2b, 0x46, 0xaa, 0xf6, 0xe2, 0xd8, 0xda,
-  0x36, 0xfe, 0xf4, 0x04, 0xc7, 0xf2, 0xcf, 0x0b, 0x0c, 0xbc, 0xed, 0x24,
-  0x1b, 0xf2, 0x2b, 0xfd, 0xf8, 0xf0, 0xf3, 0x0f, 0xd4, 0x6d, 0xd8, 0x28,
-  0xd1, 0x29, 0x5f, 0xdb, 0xf0, 0xe8, 0xd0, 0xf2, 0x32, 0x00, 0xf2, 0xfd,
-  0xe0, 0xe9, 0xdf, 0x19, 0x0d, 0xcb, 0xd2, 0xe9, 0x20, 0xed, 0x18, 0x06,
-  0xe5, 0xca, 0x1c, 0xc2, 0xd0, 0x2c, 0xdd, 0x18, 0xb3, 0x02, 0x40, 0xaa,
-  0xdb, 0xe3, 0xdb, 0xea, 0x08, 0x0b, 0xfb, 0x16, 0x08, 0xde, 0xca, 0xfc,
-  0xee, 0xf9, 0xd9, 0xcf, 0x1f, 0x1e, 0x0a, 0xfb, 0x01, 0xd7, 0xe4, 0x03,
-  0xbc, 0x25, 0xdc, 0x00, 0xbe, 0x16, 0x1e, 0xe3, 0xdd, 0xe6, 0xd5, 0xfa,
-  0x2a, 0x1a, 0xdb, 0x24, 0xf1, 0x09, 0xdb, 0xec, 0xd7, 0x08, 0xef, 0xff,
-  0x24, 0x0e, 0x2b, 0xf4, 0x06, 0xee, 0xb6, 0xf5, 0xf3, 0x07, 0xdd, 0x02,
-  0xfe, 0x0f, 0x29, 0x20, 0xea, 0xd8, 0xb2, 0xf9, 0x23, 0x0c, 0xdc, 0xca,
-  0x2f, 0x10, 0xd0, 0x12, 0xa5, 0x00, 0xf7, 0xf1, 0x1d, 0xee, 0xea, 0x14,
-  0x28, 0x21, 0xde, 0xcc, 0x3b, 0xf3, 0xe4, 0xef, 0x03, 0xbb, 0x59, 0xd9,
-  0x4a, 0xe9, 0xc8, 0x0f, 0x19, 0xfd, 0xb7, 0x5e, 0xe9, 0x07, 0xf1, 0xf1,
-  0xfa, 0xf5, 0x1c, 0x13, 0x06, 0xe9, 0x0d, 0x2b, 0x12, 0x1a, 0x08, 0x19,
-  0x2e, 0x36, 0x3c, 0xea, 0x40, 0x0e, 0x19, 0xe2, 0x08, 0x16, 0xe6, 0xed,
-  0x07, 0x13, 0xcb, 0xe7, 0xe3, 0xcb, 0xfd, 0xbe, 0x0d, 0xff, 0x1e, 0x2c,
-  0x08, 0x9b, 0xf6, 0x1b, 0xeb, 0xe7, 0x40, 0xfc, 0xf7, 0xeb, 0x24, 0xb1,
-  0x3d, 0xef, 0x13, 0xfd, 0xe8, 0x40, 0xeb, 0xe2, 0xd2, 0x00, 0xda, 0xec,
-  0x11, 0x23, 0xee, 0x02, 0xc7, 0xfc, 0x00, 0xea, 0x06, 0x3d, 0x04, 0x08,
-  0x27, 0x13, 0xb9, 0xd5, 0x54, 0x1a, 0xc9, 0x20, 0x30, 0xde, 0x6d, 0xe6,
-  0x04, 0x16, 0xdb, 0x08, 0x31, 0x3c, 0x28, 0xee, 0xe6, 0xe9, 0xff, 0x00,
-  0xac, 0xe0, 0xd2, 0xf7, 0xfa, 0xe2, 0x30, 0xf4, 0x09, 0x21, 0x1e, 0x10,
-  0xe6, 0x18, 0x1b, 0x15, 0x22, 0x10, 0x42, 0x13, 0xdc, 0x04, 0xfd, 0xcd,
-  0xfe, 0x3b, 0xa1, 0xbc, 0xea, 0xd8, 0x1e, 0xd1, 0xc6, 0x10, 0x0a, 0x20,
-  0xd7, 0x81, 0x2a, 0xf9, 0x0f, 0xd1, 0x4a, 0xf3, 0x0f, 0xd1, 0x33, 0xe6,
-  0xfd, 0x19, 0x4e, 0x1e, 0xf2, 0x0d, 0x12, 0xe9, 0x00, 0x0d, 0xc3, 0xf2,
-  0xff, 0x11, 0xe3, 0x21, 0xea, 0x1a, 0x02, 0x08, 0x13, 0x11, 0xc4, 0x3e,
-  0xd6, 0xda, 0xe6, 0xed, 0x2f, 0xe8, 0xe4, 0x0b, 0x42, 0xc6, 0x6e, 0x02,
-  0xf6, 0x2e, 0xec, 0x17, 0xf0, 0x31, 0xf8, 0xff, 0xed, 0xf0, 0x08, 0x05,
-  0xea, 0x03, 0xd3, 0xfa, 0xee, 0x3c, 0x00, 0xe0, 0xbc, 0xf6, 0xff, 0x0f,
-  0x0e, 0xe5, 0xf7, 0xe8, 0xf1, 0xfb, 0x2b, 0xf1, 0xc4, 0xf4, 0x21, 0xf7,
-  0xde, 0x4c, 0xbc, 0xf7, 0x25, 0xfb, 0x34, 0xd4, 0x12, 0x24, 0xdd, 0x1c,
-  0xba, 0xe9, 0xf6, 0xb2, 0xfe, 0xdb, 0x19, 0xcb, 0x09, 0xa9, 0xed, 0x06,
-  0xd0, 0x0f, 0x24, 0xf8, 0xf1, 0x03, 0x00, 0x06, 0xc1, 0xd8, 0xe8, 0x02,
-  0xd8, 0x23, 0xea, 0x27, 0x11, 0x11, 0x1c, 0x00, 0x1a, 0xd6, 0x2a, 0xf5,
-  0x47, 0x0c, 0x08, 0xcc, 0x34, 0x02, 0xeb, 0xdd, 0x51, 0x0b, 0xf1, 0x16,
-  0xf5, 0x1e, 0xeb, 0x21, 0x47, 0x02, 0x02, 0xcb, 0xfa, 0x13, 0x3d, 0x0c,
-  0xfd, 0xfd, 0xf6, 0x3e, 0x54, 0xd6, 0x0a, 0x04, 0x39, 0x05, 0xfb, 0xf9,
-  0x13, 0xf8, 0xfa, 0xda, 0x52, 0x0f, 0xd2, 0x0b, 0x11, 0xfa, 0xf4, 0x19,
-  0x11, 0x1e, 0x0b, 0xc1, 0x4d, 0x15, 0x21, 0x03, 0xe3, 0x2c, 0x14, 0x0a,
-  0x1d, 0x0b, 0xfe, 0xd4, 0x2b, 0x0c, 0xe3, 0xe8, 0x18, 0xec, 0xfb, 0x0d,
-  0x0d, 0x02, 0xdd, 0x2c, 0xef, 0xf8, 0xe3, 0x12, 0xf6, 0x31, 0x10, 0xfa,
-  0xd8, 0x18, 0x0c, 0x27, 0x34, 0x09, 0x27, 0x0c, 0xf6, 0xd6, 0x13, 0xcb,
-  0x2b, 0xfc, 0x3a, 0xdc, 0x23, 0xaf, 0x05, 0xe5, 0x38, 0xd9, 0xb9, 0xfa,
-  0x0f, 0x29, 0x15, 0x25, 0x0a, 0x07, 0xc0, 0x01, 0xe6, 0x15, 0x32, 0xe0,
-  0x0e, 0x01, 0x03, 0x32, 0x2d, 0x81, 0xe6, 0xee, 0xe8, 0xe0, 0x14, 0xfa,
-  0x03, 0xfd, 0xe8, 0x03, 0x07, 0xf5, 0x93, 0xf5, 0x3f, 0x0b, 0x00, 0x26,
-  0x15, 0x1f, 0xb8, 0x08, 0x14, 0x0c, 0x16, 0x11, 0xe8, 0xf9, 0x15, 0x13,
-  0xff, 0x95, 0xe5, 0xe9, 0xfd, 0xea, 0xfe, 0xd2, 0xef, 0xd5, 0xf8, 0x13,
-  0xcf, 0x0c, 0xf2, 0xfb, 0x0f, 0x11, 0xe9, 0x0d, 0x00, 0x29, 0xf6, 0xed,
-  0xae, 0xfb, 0x1e, 0xc5, 0x14, 0xf4, 0xf3, 0x14, 0xce, 0x97, 0x14, 0xea,
-  0xb6, 0xda, 0x52, 0xf5, 0x04, 0xcf, 0x10, 0x4d, 0x1b, 0xe1, 0xbb, 0xdb,
-  0xdc, 0x26, 0x3b, 0x01, 0xcf, 0x0b, 0xd0, 0xc6, 0xe1, 0x0d, 0x29, 0xfd,
-  0x0d, 0x07, 0x13, 0x1a, 0xea, 0x9c, 0xeb, 0xf5, 0xb8, 0xe8, 0x30, 0x1b,
-  0xfe, 0x11, 0x06, 0x3c, 0xf4, 0xfc, 0xbb, 0xb8, 0x08, 0x15, 0x2e, 0x13,
-  0x11, 0x09, 0xb6, 0xdf, 0xae, 0x18, 0x25, 0x15, 0xdc, 0xfa, 0x16, 0xf7,
-  0xf6, 0xad, 0xe2, 0xfb, 0xeb, 0xd7, 0x3a, 0x03, 0xe1, 0xdb, 0x04, 0x2f,
-  0xd5, 0xed, 0xc7, 0xc1, 0x17, 0x29, 0x20, 0x0d, 0xef, 0x24, 0xcb, 0xc8,
-  0xb9, 0xeb, 0xb0, 0xf8, 0x4b, 0xd3, 0xf3, 0x3d, 0x5f, 0xe9, 0x18, 0xe9,
-  0xf1, 0x00, 0x44, 0x1d, 0xd1, 0x17, 0xfb, 0x7c, 0x19, 0xe5, 0x40, 0xf5,
-  0xe9, 0x40, 0xda, 0xe2, 0x3d, 0xf3, 0x29, 0xff, 0xd2, 0xdf, 0xeb, 0x8e,
-  0x07, 0x3c, 0x1e, 0x42, 0x27, 0xcc, 0x09, 0x36, 0xd4, 0xec, 0x5a, 0x7f,
-  0x08, 0x0c, 0x07, 0x0c, 0x75, 0xf1, 0x23, 0x02, 0xf9, 0x4c, 0xca, 0xcb,
-  0xc7, 0xf9, 0x06, 0xc6, 0x5b, 0xeb, 0xff, 0xd2, 0xad, 0x69, 0x06, 0x2b,
-  0xd1, 0xf0, 0xe3, 0x71, 0x06, 0x23, 0xfa, 0x0f, 0x4c, 0xb3, 0x02, 0xdd,
-  0x5c, 0xc3, 0xb8, 0x06, 0xe4, 0x13, 0x24, 0x05, 0xc1, 0xe7, 0x04, 0xbd,
-  0x01, 0x0b, 0xe8, 0x28, 0x30, 0xaf, 0xe8, 0x0b, 0x3b, 0xf8, 0x03, 0xbf,
-  0x4e, 0x32, 0xef, 0x1d, 0xd3, 0xf9, 0x25, 0x06, 0xb0, 0xf2, 0x29, 0xde,
-  0xc4, 0xea, 0x0f, 0xfb, 0x0b, 0xed, 0x36, 0x05, 0xf9, 0xd1, 0xee, 0x99,
-  0x15, 0xac, 0xd0, 0x28, 0xee, 0xf3, 0xb6, 0xf9, 0xc7, 0x11, 0x15, 0x68,
-  0xda, 0xd5, 0x35, 0xf1, 0xea, 0x01, 0x17, 0xbf, 0xef, 0xfa, 0x06, 0xd5,
-  0xec, 0xda, 0xfa, 0x08, 0x20, 0x09, 0xf5, 0xea, 0xdd, 0x14, 0xd4, 0xe9,
-  0x02, 0xfe, 0xdc, 0x1c, 0xce, 0x1c, 0xc9, 0xfc, 0x55, 0x94, 0x17, 0xc0,
-  0x0c, 0xda, 0xc6, 0xf6, 0xb2, 0xf1, 0xbf, 0x18, 0xe4, 0xc5, 0x36, 0x00,
-  0x17, 0x01, 0xfa, 0x0c, 0x1c, 0xec, 0xf6, 0x0e, 0xe1, 0xf4, 0xb6, 0xeb,
-  0xfe, 0x28, 0xc1, 0xe5, 0xf3, 0xc1, 0x0a, 0x8e, 0xd1, 0xcc, 0xf4, 0x23,
-  0xee, 0xe2, 0x1e, 0x07, 0xce, 0x27, 0xf1, 0xf0, 0x0b, 0xe2, 0x1b, 0xfc,
-  0x0c, 0xc6, 0xbc, 0xe7, 0xe9, 0x2f, 0xc9, 0xf8, 0xd8, 0x00, 0xd5, 0x26,
-  0xbd, 0xf5, 0xdc, 0xb8, 0xca, 0xe7, 0xe9, 0x10, 0xca, 0xc1, 0x36, 0xdb,
-  0xeb, 0x00, 0xc3, 0xf8, 0xfb, 0xf3, 0xe7, 0x46, 0x2f, 0xb8, 0xe7, 0x03,
-  0x36, 0x24, 0xfa, 0xe9, 0xd3, 0x2c, 0xe0, 0x19, 0xe8, 0x0f, 0x02, 0x1f,
-  0xe7, 0x02, 0xfc, 0x16, 0xc8, 0xe7, 0xbe, 0x07, 0xef, 0x04, 0x1b, 0xf8,
-  0x13, 0x0b, 0x32, 0x26, 0x04, 0x08, 0xf4, 0xef, 0x12, 0xe8, 0x00, 0xd0,
-  0x2c, 0x1f, 0x02, 0xc6, 0xee, 0xdc, 0xe9, 0xf2, 0xf7, 0xff, 0xdf, 0xfe,
-  0xfb, 0xf2, 0x13, 0x02, 0x08, 0xe2, 0xf0, 0xea, 0xef, 0x05, 0xbf, 0x30,
-  0xef, 0xe4, 0xec, 0x07, 0x46, 0x01, 0x12, 0xe6, 0x1a, 0x3e, 0x15, 0xf7,
-  0x2c, 0xfe, 0x1b, 0x26, 0x19, 0x3a, 0xd1, 0xfb, 0x2b, 0x05, 0xcf, 0xf1,
-  0x2c, 0xfa, 0xce, 0x15, 0x05, 0xef, 0xdd, 0xf0, 0xef, 0xf6, 0xfa, 0x10,
-  0x1c, 0xac, 0x06, 0x02, 0x0a, 0xf7, 0x09, 0xfa, 0x04, 0xf9, 0xfb, 0x11,
-  0xe8, 0xee, 0xd4, 0x1e, 0xe5, 0x16, 0x34, 0xfe, 0xd7, 0xfa, 0xd9, 0xf5,
-  0x37, 0x18, 0x22, 0x28, 0xe4, 0x21, 0x26, 0xf6, 0xdc, 0x01, 0x15, 0x14,
-  0x1a, 0x3b, 0x23, 0x04, 0x3d, 0x0c, 0xf2, 0xc1, 0x42, 0xd7, 0xc6, 0x34,
-  0x21, 0x0f, 0x11, 0x1b, 0x39, 0xde, 0x05, 0x1a, 0xfc, 0x2e, 0xf0, 0x22,
-  0x07, 0xe1, 0x28, 0x1f, 0x55, 0x14, 0xed, 0xdd, 0x28, 0x22, 0xea, 0xf7,
-  0x25, 0x13, 0x12, 0xe0, 0x11, 0x2d, 0xf4, 0xcc, 0x0b, 0x19, 0xc3, 0x27,
-  0x52, 0x0a, 0xde, 0x38, 0x14, 0x17, 0xe3, 0xe1, 0x38, 0x17, 0xe7, 0x02,
-  0x2e, 0xb9, 0x09, 0x11, 0x1c, 0x3c, 0x21, 0xf5, 0x34, 0xd0, 0x07, 0x1f,
-  0xfa, 0x3b, 0x08, 0x09, 0xbe, 0x01, 0xd2, 0x13, 0x3a, 0x09, 0xe9, 0x12,
-  0x12, 0xf7, 0x1d, 0xec, 0xb3, 0x0b, 0x32, 0xeb, 0xcc, 0xf1, 0x2b, 0x58,
-  0xfa, 0x06, 0xe4, 0x03, 0x49, 0xf7, 0x1a, 0xf3, 0x2d, 0xd4, 0xda, 0x44,
-  0xd0, 0x12, 0x0c, 0xf0, 0x08, 0xfb, 0xf3, 0x22, 0x07, 0xed, 0x2a, 0x0e,
-  0x12, 0xee, 0x33, 0x0d, 0x05, 0xdc, 0x19, 0xf2, 0x01, 0x01, 0x07, 0xf2,
-  0x25, 0x02, 0x10, 0xe3, 0x1a, 0xea, 0x1d, 0x15, 0xe4, 0x15, 0xff, 0x09,
-  0x4b, 0xdf, 0x32, 0x21, 0xee, 0x07, 0x1f, 0xf3, 0x7f, 0xed, 0xfd, 0xed,
-  0x0c, 0xf2, 0x39, 0xd7, 0x25, 0xf0, 0xf4, 0xd7, 0xe1, 0x06, 0xff, 0x35,
-  0xf4, 0x0f, 0x12, 0xef, 0x1c, 0x00, 0xd3, 0xfc, 0x3c, 0xf3, 0x12, 0xe3,
-  0xcc, 0xf8, 0xa0, 0x26, 0x20, 0xf5, 0xdb, 0x57, 0x25, 0x01, 0x5b, 0x0a,
-  0x00, 0xf8, 0x08, 0x23, 0xfc, 0x33, 0x02, 0x08, 0x58, 0x31, 0xef, 0xdc,
-  0xbe, 0xee, 0x1a, 0xec, 0x26, 0x08, 0xd4, 0xe5, 0x06, 0xd5, 0xf2, 0xdd,
-  0xe0, 0xea, 0xfc, 0x28, 0x07, 0xda, 0x26, 0x45, 0xd2, 0xe2, 0x22, 0x49,
-  0x26, 0x53, 0x34, 0xfa, 0x40, 0x26, 0xe8, 0x20, 0xd6, 0xf3, 0x2d, 0xfc,
-  0x03, 0xe2, 0x00, 0xf3, 0x1b, 0x00, 0x2b, 0xca, 0xfc, 0xe0, 0x0d, 0x11,
-  0xf4, 0xd8, 0x1e, 0x1e, 0xc5, 0xe7, 0xe9, 0x8d, 0xf0, 0x2a, 0x2a, 0xe9,
-  0x17, 0x1a, 0x36, 0x04, 0x00, 0xfa, 0xf0, 0xfe, 0xf5, 0x1b, 0x1c, 0xdd,
-  0xb1, 0xfd, 0xe1, 0x24, 0x79, 0xb0, 0xed, 0xd9, 0x15, 0x33, 0x1e, 0xca,
-  0xf8, 0xe9, 0x04, 0xf1, 0xd8, 0x30, 0xd6, 0x19, 0xe8, 0x2f, 0x3d, 0x91,
-  0xed, 0xa4, 0xca, 0x0e, 0x55, 0xea, 0xfb, 0x3b, 0x1e, 0x07, 0x12, 0xb3,
-  0x2a, 0x04, 0xd6, 0xa2, 0xf8, 0x22, 0xe5, 0x32, 0xca, 0xf6, 0xbe, 0x06,
-  0x64, 0xfe, 0xdb, 0xe7, 0x26, 0x40, 0xdb, 0x27, 0x0e, 0xa0, 0x15, 0x14,
-  0xcc, 0xce, 0x05, 0x17, 0x21, 0xf7, 0x20, 0xbc, 0x0d, 0x0b, 0xf5, 0xcb,
-  0xed, 0x3a, 0x00, 0x0f, 0xe0, 0xda, 0xf0, 0xc9, 0xf7, 0xea, 0x0d, 0x05,
-  0x1c, 0x06, 0xfc, 0x13, 0x3a, 0xe9, 0x14, 0xfb, 0xd0, 0xf8, 0x26, 0xaf,
-  0x21, 0x18, 0x33, 0xe4, 0x53, 0xcf, 0xe4, 0xa6, 0x0f, 0xd4, 0xb0, 0xc4,
-  0xf8, 0xfc, 0xbf, 0xf5, 0x13, 0x3d, 0xbd, 0x11, 0x99, 0x10, 0x29, 0xfb,
-  0xfe, 0xd2, 0xd9, 0x21, 0x1a, 0xa9, 0xca, 0x21, 0x40, 0x36, 0x5a, 0xdf,
-  0x00, 0xe1, 0xf9, 0x81, 0x18, 0x3e, 0xa8, 0x0c, 0x11, 0x02, 0x89, 0x06,
-  0x2e, 0xff, 0xe4, 0x0a, 0xf7, 0xd1, 0xe9, 0x1a, 0x25, 0xde, 0x13, 0x21,
-  0xd9, 0xec, 0xd5, 0x04, 0xf5, 0xf5, 0x1f, 0xbc, 0xee, 0x06, 0xd7, 0xb0,
-  0x37, 0x0d, 0xf2, 0xdd, 0xdb, 0xeb, 0xec, 0x03, 0x03, 0xbc, 0xee, 0xe3,
-  0x05, 0xcb, 0xc8, 0x07, 0x24, 0xd5, 0x35, 0xfd, 0xcc, 0x04, 0xd7, 0xe3,
-  0x45, 0xc8, 0x12, 0xe7, 0xb7, 0xd2, 0xef, 0x4d, 0x14, 0xd8, 0xee, 0x42,
-  0xda, 0xd9, 0x2b, 0x1e, 0xe6, 0xb7, 0x1d, 0xe2, 0xcf, 0xbe, 0x16, 0xec,
-  0xff, 0xf5, 0x5d, 0xda, 0xc0, 0x2f, 0x04, 0xef, 0x65, 0xf7, 0x50, 0x1c,
-  0xe1, 0x1a, 0xdf, 0xee, 0x03, 0xdf, 0xdd, 0x22, 0xf2, 0xfb, 0x0d, 0xe8,
-  0xd6, 0xcb, 0x1b, 0xbb, 0xe5, 0xae, 0xd4, 0x18, 0x48, 0xe4, 0x40, 0x28,
-  0xce, 0x1a, 0xff, 0x4f, 0xea, 0x54, 0x62, 0x29, 0xe2, 0x19, 0xf3, 0xe9,
-  0xd8, 0xf1, 0xcd, 0xfd, 0xe0, 0x2e, 0xf7, 0xf6, 0x2e, 0x23, 0xc1, 0xdd,
-  0x01, 0xae, 0xcf, 0x1e, 0x22, 0xfc, 0xd5, 0x42, 0x05, 0x03, 0xee, 0xaa,
-  0x09, 0xd0, 0x05, 0xd9, 0xe1, 0xc8, 0xf7, 0x26, 0x34, 0xd6, 0xbe, 0x2a,
-  0xd0, 0xb2, 0x52, 0xf3, 0xe3, 0x96, 0xfb, 0xc6, 0xee, 0xd7, 0xe2, 0xc7,
-  0x1b, 0xfa, 0x67, 0xa5, 0xe3, 0xf7, 0x0b, 0xca, 0xcd, 0xcd, 0x24, 0xf5,
-  0xd7, 0xf4, 0x00, 0x22, 0xf7, 0xc5, 0xb7, 0x21, 0xd9, 0xc1, 0x19, 0xea,
-  0xf1, 0xe2, 0x09, 0xf5, 0xcb, 0xe8, 0xe7, 0xce, 0x79, 0x01, 0x10, 0x08,
-  0xdc, 0xf6, 0xfd, 0x02, 0xed, 0x59, 0x62, 0x24, 0x19, 0x02, 0xc2, 0xea,
-  0x11, 0xd7, 0xbe, 0xfb, 0x1f, 0x13, 0xca, 0xc9, 0x49, 0x2a, 0xb4, 0x23,
-  0x11, 0xf1, 0xea, 0xe9, 0x0f, 0xee, 0x81, 0x4b, 0x3b, 0xbd, 0x0f, 0xaa,
-  0xd6, 0x00, 0x44, 0x1d, 0xfc, 0x09, 0x10, 0x13, 0xfd, 0xe2, 0xbc, 0x27,
-  0x0c, 0xe8, 0x2c, 0x0b, 0x1b, 0x11, 0xfc, 0xdd, 0xb7, 0xda, 0xdb, 0xcd,
-  0x33, 0xf4, 0xe6, 0x13, 0x0c, 0xd4, 0x35, 0xd2, 0x9f, 0x19, 0x0e, 0x2a,
-  0x09, 0xdb, 0x1f, 0x17, 0x0d, 0x2e, 0xd2, 0xbe, 0x10, 0xfe, 0xf5, 0x09,
-  0xf8, 0x2a, 0xfc, 0x1e, 0xad, 0x2c, 0x5b, 0xe9, 0xd6, 0x04, 0xbf, 0x28,
-  0x16, 0xfb, 0x1d, 0xc9, 0x18, 0x1b, 0x2c, 0x19, 0x38, 0xdb, 0x14, 0x22,
-  0x09, 0x06, 0x02, 0xda, 0x4b, 0xfe, 0xda, 0xd5, 0x07, 0x4e, 0x20, 0x4c,
-  0xfd, 0xdd, 0x24, 0xef, 0xec, 0xf3, 0x8d, 0x08, 0x22, 0xde, 0x2a, 0xc5,
-  0xf0, 0x03, 0xf3, 0xf9, 0x00, 0x0a, 0x3c, 0x1f, 0xcc, 0x2d, 0x25, 0xe0,
-  0x2a, 0x08, 0x10, 0x4c, 0xff, 0x32, 0x20, 0x7f, 0x2c, 0xce, 0x33, 0x23,
-  0xa1, 0x2a, 0xcc, 0xf8, 0x20, 0x1b, 0x6d, 0xc9, 0x22, 0xf0, 0x3e, 0xf6,
-  0xd3, 0x3d, 0x0c, 0xff, 0x1f, 0x06, 0xfc, 0x03, 0xe3, 0xe7, 0xfa, 0x07,
-  0x13, 0xda, 0xfd, 0xc8, 0x17, 0xee, 0xf8, 0x22, 0xee, 0x09, 0x2a, 0x03,
-  0xf4, 0x26, 0xee, 0x0b, 0x24, 0xff, 0x07, 0xed, 0x0e, 0xea, 0xc1, 0xc8,
-  0x36, 0x0b, 0xb4, 0x0b, 0xd9, 0xdf, 0xce, 0xab, 0x06, 0xb9, 0xaa, 0xa5,
-  0xe1, 0x0d, 0xbe, 0x04, 0x54, 0xe7, 0x05, 0x07, 0xee, 0x2f, 0xbb, 0x53,
-  0x8c, 0x06, 0xf4, 0xd6, 0xc2, 0x13, 0xfb, 0x17, 0xc7, 0x17, 0x58, 0x02,
-  0x2d, 0xf9, 0x1e, 0x49, 0x0b, 0x21, 0x2c, 0x39, 0x27, 0xeb, 0x0b, 0x4e,
-  0xe5, 0x31, 0xc7, 0xf3, 0x17, 0xcf, 0x49, 0x91, 0xfa, 0x01, 0x5d, 0x06,
-  0x05, 0x18, 0x04, 0xe5, 0x19, 0x47, 0x1d, 0x27, 0x2f, 0x1e, 0x06, 0xd1,
-  0xff, 0x07, 0xeb, 0xa4, 0x16, 0xe7, 0x19, 0x0c, 0xdf, 0x18, 0xe1, 0xf4,
-  0x0d, 0x00, 0xec, 0x0a, 0x0e, 0x04, 0x10, 0x10, 0x1f, 0x0b, 0xfa, 0xd6,
-  0x29, 0xfe, 0x87, 0x1b, 0xdd, 0xe4, 0xdb, 0xd2, 0xf6, 0xfb, 0xd1, 0xb3,
-  0xaa, 0xe4, 0x06, 0xc5, 0x44, 0xe7, 0x42, 0x08, 0xfd, 0x06, 0x8f, 0x46,
-  0xb4, 0xee, 0x03, 0xf2, 0xcb, 0x15, 0xe1, 0x0e, 0xf6, 0xe9, 0x4c, 0xcd,
-  0x20, 0xe8, 0x15, 0xdb, 0xfa, 0x16, 0x39, 0xc7, 0x1c, 0x38, 0x15, 0x20,
-  0x1a, 0xce, 0x29, 0xf4, 0x09, 0x22, 0x3c, 0xd5, 0xd8, 0x09, 0xee, 0x04,
-  0x1c, 0xd8, 0xc9, 0x24, 0x25, 0x20, 0x0a, 0x06, 0x23, 0xf0, 0x07, 0xd9,
-  0xd5, 0x31, 0x01, 0xda, 0xf3, 0x2c, 0x58, 0xee, 0x3f, 0xed, 0xab, 0x0a,
-  0x1f, 0xe6, 0x39, 0x21, 0x35, 0x10, 0xfb, 0x05, 0x2d, 0x1e, 0xe5, 0xf2,
-  0x3c, 0xfe, 0x92, 0x2f, 0xf8, 0xc7, 0x00, 0xe2, 0x0a, 0xfe, 0xdb, 0xab,
-  0xea, 0x06, 0xfb, 0xd6, 0xc1, 0xfe, 0xe9, 0x09, 0xfd, 0xf0, 0xc3, 0x28,
-  0x3e, 0x1a, 0xcd, 0x09, 0x2e, 0x36, 0x01, 0x28, 0xfd, 0x3f, 0xe1, 0xce,
-  0x43, 0x18, 0x33, 0xf6, 0x09, 0x47, 0x4a, 0x0f, 0x2a, 0xe3, 0x04, 0xe9,
-  0x1d, 0x30, 0x25, 0x2d, 0x0c, 0x23, 0x5c, 0xed, 0x60, 0x41, 0xbb, 0x08,
-  0x43, 0xf3, 0xe8, 0xf6, 0xca, 0x19, 0xb3, 0x00, 0xff, 0x3c, 0xe6, 0x21,
-  0xeb, 0x28, 0xd9, 0x09, 0x21, 0x04, 0xf9, 0xcc, 0x2d, 0x02, 0xfc, 0x36,
-  0x17, 0x32, 0x7f, 0x04, 0x29, 0x28, 0xd8, 0x03, 0x28, 0xeb, 0xed, 0x11,
-  0xe8, 0x38, 0xb0, 0xf7, 0x12, 0x14, 0xd8, 0xe4, 0xeb, 0x1e, 0x0c, 0x03,
-  0xde, 0xf3, 0x16, 0xeb, 0x1a, 0xe8, 0x11, 0x13, 0x1b, 0x0b, 0x63, 0x0a,
-  0x04, 0xfc, 0xf7, 0x0e, 0xe9, 0xf3, 0x3b, 0x1e, 0xd1, 0x3a, 0xbc, 0xe0,
-  0xee, 0x0c, 0xfe, 0xe4, 0x06, 0x00, 0x59, 0x3b, 0x48, 0xef, 0x02, 0xdf,
-  0xeb, 0x3f, 0x3b, 0x28, 0xe8, 0x16, 0x2c, 0xdf, 0xff, 0x0e, 0xbc, 0x05,
-  0xde, 0xff, 0x5f, 0x03, 0x8e, 0x13, 0x9b, 0x13, 0xd3, 0xeb, 0xf4, 0x2b,
-  0xec, 0x2d, 0x1f, 0x35, 0x15, 0xe2, 0x0c, 0x9b, 0x06, 0x41, 0x33, 0x1f,
-  0x1c, 0x26, 0x44, 0xe3, 0x16, 0x1e, 0xe6, 0x0b, 0xe8, 0xdc, 0x36, 0x1f,
-  0xc1, 0xfd, 0xb6, 0xe1, 0xf1, 0xfd, 0xe2, 0x02, 0xef, 0x2c, 0xf4, 0x03,
-  0xbb, 0xbe, 0x1b, 0xbb, 0xf0, 0x34, 0xd7, 0x15, 0x12, 0x09, 0x46, 0x9d,
-  0xfa, 0x16, 0xec, 0x07, 0xf5, 0xbd, 0x42, 0x0e, 0x97, 0x26, 0xcc, 0xd3,
-  0xf2, 0xf7, 0x01, 0xea, 0x06, 0xb6, 0x5e, 0x3f, 0x2a, 0x13, 0xfd, 0x04,
-  0xc6, 0x2a, 0x3f, 0x11, 0xe2, 0x38, 0xf9, 0x05, 0xe7, 0xf6, 0xca, 0xd9,
-  0xfe, 0xdf, 0x43, 0x0c, 0xbf, 0x2f, 0xd6, 0xeb, 0xba, 0xbb, 0x10, 0xf0,
-  0xeb, 0xd6, 0x2a, 0x1b, 0x14, 0xe2, 0x0c, 0xc2, 0xa2, 0x13, 0x22, 0xfb,
-  0x28, 0x31, 0x22, 0xe5, 0x03, 0x09, 0x0a, 0xf2, 0x24, 0xf4, 0x43, 0x0e,
-  0xd1, 0xe4, 0xce, 0xb0, 0xcb, 0xd2, 0xda, 0xc9, 0x11, 0xe0, 0xed, 0xfa,
-  0xe2, 0xc4, 0x43, 0xc8, 0xc3, 0x1d, 0xac, 0x18, 0x26, 0xf2, 0x12, 0xa9,
-  0xd2, 0xfa, 0xf4, 0xe3, 0xeb, 0xf6, 0xfc, 0xc2, 0xec, 0xa3, 0xce, 0xf8,
-  0xce, 0xe0, 0xca, 0xf2, 0xdc, 0xc6, 0xed, 0xe5, 0xc3, 0xd9, 0xb2, 0xae,
-  0xc8, 0xdf, 0xf4, 0xf8, 0xe7, 0x06, 0xdf, 0x1e, 0xd8, 0x01, 0x25, 0xf7,
-  0x1f, 0xca, 0x08, 0xf9, 0x0b, 0xc2, 0xc7, 0xca, 0xe0, 0xde, 0xf8, 0x0e,
-  0xf3, 0x9d, 0x20, 0xc6, 0x05, 0xc2, 0x90, 0xcd, 0xda, 0xfe, 0x3b, 0x1a,
-  0xb3, 0x23, 0xa3, 0x21, 0x04, 0x0e, 0x11, 0x00, 0xec, 0xd8, 0x0d, 0xbb,
-  0x2c, 0xba, 0xc5, 0x08, 0x0f, 0xfc, 0x1b, 0x7f, 0xf9, 0xdb, 0xe1, 0xc9,
-  0xc8, 0x0a, 0xd3, 0xdd, 0x14, 0x1d, 0x1a, 0x06, 0xc8, 0x3c, 0xa5, 0x4b,
-  0xf5, 0x06, 0xf9, 0x07, 0xff, 0xd6, 0xf2, 0x03, 0xd9, 0x10, 0xe9, 0xea,
-  0xfd, 0x2f, 0x07, 0x23, 0x03, 0xfa, 0x0f, 0x05, 0x08, 0x18, 0xf9, 0xd6,
-  0x30, 0x10, 0xe4, 0xed, 0x1c, 0xf2, 0x21, 0xf4, 0x2a, 0xf6, 0x3e, 0x18,
-  0x28, 0xce, 0xe8, 0x1c, 0xed, 0x0d, 0xe2, 0xe2, 0xf9, 0x25, 0x0d, 0x4b,
-  0x02, 0xf4, 0x3e, 0xae, 0x22, 0xea, 0xb9, 0x02, 0x25, 0x1f, 0x27, 0xef,
-  0x08, 0x07, 0xd4, 0xe2, 0x6b, 0xfc, 0x32, 0x04, 0x17, 0xbd, 0xf1, 0xcf,
-  0xff, 0xe7, 0xd4, 0x28, 0x23, 0x27, 0x45, 0x63, 0x12, 0x17, 0x06, 0xcf,
-  0xf1, 0x18, 0xef, 0xfe, 0x46, 0x36, 0xff, 0x0a, 0x00, 0x29, 0xda, 0x0a,
-  0x04, 0xff, 0xef, 0x26, 0xe5, 0xd3, 0x02, 0x1a, 0x06, 0xfe, 0xf5, 0xe0,
-  0x59, 0x0f, 0xfb, 0xf0, 0x08, 0x03, 0xf6, 0x2f, 0x33, 0x04, 0x20, 0xf7,
-  0xf8, 0x0a, 0xca, 0xfb, 0x14, 0xc9, 0x27, 0xbe, 0x28, 0xe7, 0xf5, 0x48,
-  0xe1, 0xce, 0xe1, 0x3a, 0x1b, 0xef, 0xc8, 0xd8, 0x2d, 0x0c, 0x19, 0x2e,
-  0x05, 0x0f, 0x12, 0xf4, 0x32, 0x00, 0xe8, 0xd5, 0xf1, 0xfa, 0x19, 0xdd,
-  0xe9, 0xe1, 0x06, 0xb6, 0x46, 0xed, 0xf0, 0x16, 0xde, 0x02, 0xe2, 0x00,
-  0x0b, 0xf4, 0xd2, 0x1d, 0x3e, 0x12, 0x40, 0x72, 0x22, 0xee, 0x11, 0x14,
-  0x13, 0xdd, 0xff, 0xe7, 0x02, 0x1e, 0xe7, 0x04, 0xfd, 0x08, 0x07, 0xb2,
-  0x2b, 0x1d, 0xe3, 0x0b, 0x4f, 0x18, 0xc9, 0xe8, 0x2b, 0xfb, 0xf7, 0xe0,
-  0x36, 0x03, 0xeb, 0x12, 0x00, 0xda, 0xe9, 0x43, 0xfa, 0xfe, 0x00, 0xee,
-  0x02, 0xc5, 0x04, 0x14, 0xca, 0x1e, 0x3f, 0x06, 0x3f, 0x04, 0xf2, 0x0b,
-  0x11, 0x0e, 0x00, 0x0e, 0x40, 0xf4, 0xf1, 0x0d, 0x0e, 0xcd, 0xf9, 0xf1,
-  0x00, 0xe9, 0x18, 0xc6, 0xee, 0x18, 0x04, 0xd2, 0x28, 0xf1, 0xfa, 0x0a,
-  0xf5, 0xf1, 0x01, 0x2a, 0x21, 0x13, 0xd5, 0xfd, 0xc9, 0xfc, 0xe8, 0x2b,
-  0xe5, 0xd7, 0xd6, 0x29, 0xf1, 0x02, 0x01, 0x0c, 0xfc, 0x14, 0x09, 0xdd,
-  0xe9, 0x1e, 0xe6, 0xcd, 0x2c, 0xef, 0x00, 0x0d, 0xfd, 0x02, 0x0e, 0x6c,
-  0xb4, 0x1a, 0x2f, 0xea, 0xdb, 0x69, 0x0b, 0xfd, 0x0e, 0xe8, 0xf4, 0x02,
-  0x2c, 0x12, 0xf3, 0x31, 0x08, 0xf7, 0xd9, 0xff, 0x5b, 0x0d, 0x08, 0x13,
-  0x14, 0xfd, 0x05, 0x20, 0xe7, 0x2e, 0x3d, 0x0d, 0xc4, 0x05, 0x53, 0xb2,
-  0xd2, 0x09, 0x08, 0x63, 0x26, 0xe3, 0x10, 0x02, 0xfa, 0xf3, 0xd9, 0x49,
-  0x26, 0x07, 0x2c, 0xea, 0x65, 0x48, 0x0a, 0x0d, 0x35, 0xfd, 0x33, 0x19,
-  0xdf, 0x50, 0xed, 0xe4, 0xcc, 0x17, 0x08, 0xcd, 0x55, 0xc1, 0xe3, 0x33,
-  0x21, 0xae, 0xf4, 0x01, 0xb7, 0xf1, 0xd1, 0x32, 0xdf, 0x17, 0x15, 0x23,
-  0xf4, 0x56, 0xf5, 0xfa, 0x2d, 0xe6, 0x0f, 0x13, 0x36, 0x49, 0xf3, 0x1a,
-  0x13, 0x05, 0x56, 0xfe, 0xfb, 0x1a, 0xde, 0xa8, 0xec, 0x04, 0x3d, 0x22,
-  0xd1, 0x16, 0x1c, 0x13, 0xdd, 0xf2, 0xe7, 0x3b, 0x3e, 0x01, 0x17, 0xe2,
-  0x10, 0x13, 0x06, 0x02, 0xfc, 0x13, 0x11, 0xee, 0xf6, 0x05, 0x7f, 0xa4,
-  0x36, 0x44, 0xd0, 0xd9, 0xc3, 0xc9, 0x0f, 0xef, 0xa0, 0xc5, 0xf7, 0x17,
-  0x0b, 0xdd, 0xac, 0x0d, 0x38, 0xf6, 0xca, 0xdc, 0xe4, 0x11, 0x02, 0x08,
-  0x03, 0x38, 0x9b, 0x97, 0x1b, 0x0c, 0x06, 0xb6, 0xff, 0x0c, 0xe2, 0xf0,
-  0xfd, 0x06, 0x02, 0x1b, 0xb9, 0xd0, 0xfd, 0xec, 0x01, 0xec, 0xd9, 0x37,
-  0x37, 0xdf, 0x10, 0x0c, 0xdd, 0xfe, 0xbe, 0xfb, 0x09, 0x24, 0xd5, 0x9f,
-  0x9d, 0x24, 0x01, 0xf9, 0x00, 0xe8, 0x2a, 0x09, 0xec, 0x2f, 0xdd, 0xcd,
-  0x08, 0xf4, 0x3c, 0x54, 0xce, 0x01, 0x0e, 0x0a, 0x1f, 0xc7, 0xec, 0x0c,
-  0xcd, 0x78, 0x1e, 0x3c, 0xbd, 0x43, 0x13, 0xea, 0xf9, 0x32, 0xf9, 0xb3,
-  0xeb, 0xe3, 0x31, 0x18, 0xd6, 0x24, 0xf4, 0xcb, 0xdb, 0xde, 0x1b, 0x01,
-  0xe4, 0xfa, 0x14, 0x03, 0xde, 0xcd, 0x07, 0xf2, 0xec, 0x4b, 0xfa, 0x51,
-  0xd4, 0x4f, 0xfc, 0x07, 0x10, 0x4e, 0xf6, 0xe2, 0xb8, 0xd0, 0x0d, 0xe2,
-  0xb5, 0x30, 0x0c, 0xd8, 0x14, 0xea, 0x16, 0x16, 0xdc, 0xb5, 0xef, 0xe4,
-  0xed, 0xe2, 0x3a, 0x01, 0xa9, 0x4d, 0xff, 0x36, 0xd6, 0x32, 0x10, 0xcb,
-  0x1f, 0xf3, 0xed, 0x15, 0xea, 0x22, 0xe5, 0x39, 0x12, 0x4b, 0x15, 0x12,
-  0xc7, 0xac, 0x2d, 0x67, 0xb7, 0x5d, 0xbc, 0xb3, 0x1f, 0x20, 0xf9, 0xe4,
-  0xf5, 0x5d, 0xda, 0x0e, 0xf7, 0x3c, 0xae, 0x05, 0x2b, 0x08, 0xa6, 0x11,
-  0x01, 0xef, 0xc4, 0x2f, 0xd5, 0x41, 0xbf, 0x25, 0x92, 0xe7, 0x37, 0x0d,
-  0xdc, 0x24, 0x96, 0xb2, 0x11, 0x0d, 0xf1, 0xca, 0x22, 0x3f, 0xfa, 0x35,
-  0xc7, 0x4e, 0xe1, 0x18, 0xe1, 0x5f, 0xee, 0xfc, 0xd6, 0xcd, 0x02, 0x07,
-  0xe9, 0x60, 0xdd, 0x24, 0xfa, 0xd6, 0x55, 0xe3, 0x09, 0xb9, 0xca, 0xe6,
-  0xe3, 0x34, 0xe9, 0xf1, 0xf0, 0x7f, 0x2a, 0x39, 0xee, 0x1c, 0x15, 0xe8,
-  0x29, 0x02, 0x46, 0x17, 0xfc, 0x30, 0x36, 0x23, 0xf6, 0x2d, 0x05, 0x2a,
-  0x4d, 0xf2, 0x1a, 0x41, 0xd9, 0x2f, 0x15, 0x95, 0xe7, 0x25, 0xb1, 0x17,
-  0x12, 0x2a, 0xbc, 0x1e, 0xec, 0x28, 0xc4, 0x1f, 0x12, 0x3d, 0x01, 0xeb,
-  0xd7, 0x13, 0x18, 0x2e, 0xc0, 0x0c, 0x34, 0x01, 0x50, 0xe8, 0x32, 0x64,
-  0xb2, 0x30, 0x3c, 0xe2, 0xbc, 0x0b, 0x15, 0x05, 0x36, 0x16, 0xc9, 0x3b,
-  0xde, 0x31, 0xf3, 0x54, 0xf7, 0x3e, 0xfb, 0xe6, 0x1a, 0xf8, 0xe6, 0xe0,
-  0xd0, 0x08, 0x2b, 0x0e, 0x34, 0xde, 0x54, 0xe5, 0xde, 0x23, 0x0d, 0x2d,
-  0xf1, 0x06, 0x2d, 0xe7, 0x1d, 0x10, 0xca, 0x22, 0x19, 0x1e, 0xd9, 0x49,
-  0xe9, 0xe7, 0x0c, 0x12, 0xb7, 0xdc, 0x25, 0xe6, 0x13, 0x28, 0x02, 0x1d,
-  0x00, 0xa0, 0xdc, 0xfb, 0xb9, 0x0f, 0xe3, 0xcd, 0xcc, 0xf7, 0x00, 0xea,
-  0x81, 0x1b, 0xe7, 0xef, 0xe6, 0xe3, 0xde, 0x55, 0xff, 0xf2, 0x0e, 0xfe,
-  0xe1, 0x00, 0x29, 0xd4, 0xed, 0x17, 0xd1, 0x15, 0x05, 0xa6, 0xf3, 0xf8,
-  0xf2, 0xe0, 0xdb, 0xba, 0xf6, 0x0e, 0xf8, 0xdf, 0x96, 0x20, 0x0c, 0x09,
-  0xd2, 0x0f, 0xd2, 0x37, 0xdb, 0x12, 0x35, 0xf4, 0xa8, 0x1e, 0x44, 0xe3,
-  0xfb, 0xfa, 0xf0, 0x00, 0x2a, 0xbe, 0xec, 0x10, 0x3b, 0x3b, 0x21, 0xf3,
-  0xea, 0x0c, 0xc0, 0x0d, 0xe8, 0x02, 0xe0, 0x0f, 0x10, 0xdb, 0xee, 0xdb,
-  0x02, 0xee, 0x04, 0x07, 0x30, 0x02, 0x09, 0x0c, 0xfd, 0xfa, 0xff, 0x29,
-  0xe2, 0xc6, 0x13, 0x16, 0xdd, 0xa0, 0xfc, 0xd7, 0xcb, 0x15, 0x24, 0xcc,
-  0xb8, 0x0e, 0xf0, 0x02, 0xe0, 0x29, 0x2a, 0x19, 0x3b, 0x0a, 0x17, 0x03,
-  0x69, 0x1a, 0xdf, 0xee, 0x15, 0x2a, 0xf5, 0xee, 0xd9, 0xd0, 0x0e, 0x2b,
-  0xf2, 0x81, 0xaa, 0xc2, 0xf9, 0x0b, 0x09, 0xf7, 0x0d, 0x17, 0xf6, 0x15,
-  0xc6, 0x46, 0x40, 0xd1, 0x27, 0x16, 0xfb, 0xe9, 0x1e, 0x22, 0xf1, 0xf3,
-  0xfd, 0x07, 0xf2, 0xf7, 0x0f, 0xed, 0xf4, 0xf3, 0x37, 0xe1, 0xc0, 0xb9,
-  0x0b, 0xe6, 0xdd, 0x03, 0xff, 0x27, 0xff, 0x11, 0xcc, 0x0d, 0xf6, 0xd8,
-  0xe0, 0xff, 0x4a, 0xf4, 0x0e, 0xfa, 0xf9, 0x00, 0x0c, 0xd3, 0xeb, 0x3a,
-  0x1a, 0xcb, 0x16, 0x10, 0xea, 0xce, 0xd6, 0xf8, 0x00, 0x06, 0x19, 0xe5,
-  0x03, 0xfd, 0xfd, 0x08, 0xab, 0xda, 0x26, 0xc3, 0xdc, 0x0d, 0x38, 0xed,
-  0x5c, 0x12, 0x02, 0xe0, 0x00, 0xed, 0xdb, 0x29, 0xeb, 0xd2, 0x21, 0x04,
-  0xf0, 0xb8, 0xda, 0xea, 0x13, 0x0a, 0x3c, 0xde, 0x30, 0xf3, 0x10, 0x00,
-  0xb6, 0xe0, 0x1e, 0xc1, 0xf3, 0x02, 0x0a, 0x12, 0x28, 0xfa, 0xf5, 0xd0,
-  0xf3, 0xc3, 0xe9, 0x3d, 0xd5, 0xee, 0x0b, 0xf6, 0x02, 0x17, 0xe4, 0xb6,
-  0x02, 0xe0, 0x48, 0xe1, 0x06, 0x0f, 0xe0, 0x05, 0xe2, 0xd5, 0xfb, 0xff,
-  0x67, 0x04, 0x1f, 0x1d, 0x0c, 0xfe, 0x2a, 0xd9, 0x0b, 0x30, 0xd7, 0xa8,
-  0xcf, 0xfd, 0x29, 0x63, 0x18, 0xff, 0x22, 0xb8, 0x0a, 0xe1, 0x29, 0x17,
-  0xe1, 0x30, 0x54, 0xe8, 0xf1, 0xf9, 0xc6, 0x08, 0x20, 0xb3, 0xf4, 0xee,
-  0x73, 0xea, 0x0b, 0x15, 0xeb, 0xc4, 0xfb, 0xdf, 0xb4, 0xe8, 0x22, 0x13,
-  0xd6, 0x05, 0x05, 0xfa, 0xea, 0x8e, 0xd4, 0x23, 0x31, 0x0b, 0xf5, 0xbc,
-  0xda, 0xf4, 0xc6, 0x39, 0xd9, 0xec, 0xbf, 0xea, 0x3d, 0xe0, 0xfe, 0xed,
-  0xfe, 0xda, 0x2f, 0xf6, 0xe4, 0xf3, 0x11, 0x41, 0xe4, 0xfa, 0xd5, 0x11,
-  0xd5, 0xda, 0xf6, 0x25, 0x26, 0x08, 0xed, 0xf9, 0x00, 0xea, 0xfc, 0xff,
-  0xf6, 0xeb, 0x22, 0xde, 0x24, 0x0a, 0xe8, 0xf9, 0x33, 0xed, 0x12, 0x11,
-  0xb3, 0xf6, 0x2f, 0x6c, 0x2e, 0xc7, 0x2e, 0x10, 0x23, 0x42, 0xef, 0xf6,
-  0x11, 0x1e, 0x0c, 0xf4, 0xe6, 0xee, 0x00, 0xd0, 0xdf, 0x0f, 0xe1, 0xea,
-  0x23, 0xd3, 0xef, 0x1a, 0x1e, 0xee, 0x19, 0xd2, 0xdf, 0x12, 0x3e, 0x55,
-  0x6f, 0x34, 0xff, 0x13, 0x19, 0x2f, 0xcb, 0xff, 0xf3, 0x03, 0xe7, 0x01,
-  0x60, 0x2e, 0x11, 0x9b, 0x08, 0xff, 0xfd, 0x07, 0xe7, 0x0c, 0x12, 0xff,
-  0x4c, 0x50, 0x16, 0xf5, 0xdb, 0xff, 0xd9, 0x00, 0x70, 0xe3, 0xe0, 0xc3,
-  0x15, 0x3e, 0xa4, 0x15, 0xe4, 0xfb, 0xe7, 0x13, 0x12, 0x08, 0xf0, 0xbf,
-  0xf4, 0x23, 0x18, 0x1f, 0xab, 0xb7, 0xcc, 0xf3, 0x35, 0xa8, 0x09, 0x1d,
-  0xf2, 0xf1, 0xed, 0x3b, 0xfc, 0xf4, 0x11, 0xf3, 0x01, 0x75, 0xef, 0xfe,
-  0x1d, 0xe9, 0xb4, 0x33, 0x33, 0xde, 0xff, 0x22, 0xe9, 0x40, 0x0e, 0x41,
-  0x81, 0xfc, 0xd8, 0x01, 0x24, 0x0a, 0x1a, 0x32, 0x1f, 0x06, 0xb6, 0xeb,
-  0x23, 0x58, 0x14, 0xc7, 0x0a, 0x53, 0xf6, 0xbf, 0xe5, 0xf7, 0xae, 0x3a,
-  0x4a, 0x17, 0xdd, 0xe1, 0x24, 0x10, 0x0e, 0x26, 0xd4, 0x30, 0xf4, 0x1e,
-  0x13, 0x43, 0x0a, 0xf6, 0x0f, 0xf4, 0xe7, 0xb6, 0x37, 0xde, 0xfc, 0xae,
-  0xf2, 0x21, 0xb1, 0xe4, 0x0d, 0xf8, 0xf6, 0x08, 0x1a, 0xda, 0xdd, 0x3c,
-  0x2f, 0x04, 0xee, 0x0c, 0xf2, 0x5a, 0xfd, 0xb0, 0xc7, 0x18, 0xd2, 0xd0,
-  0x0b, 0x0e, 0xe2, 0x9a, 0x37, 0xd6, 0x01, 0xb9, 0x66, 0x41, 0x1e, 0x15,
-  0xfc, 0xef, 0x17, 0xed, 0xf6, 0xdb, 0x34, 0xe0, 0x09, 0xdf, 0xff, 0xfc,
-  0x1f, 0x29, 0xee, 0xc6, 0x00, 0xfe, 0xbb, 0x07, 0x0d, 0x28, 0xea, 0x91,
-  0x04, 0xed, 0xc6, 0xf5, 0x10, 0x22, 0x23, 0xea, 0xdb, 0xf8, 0x1c, 0xdc,
-  0xf9, 0xd9, 0x14, 0xdf, 0x07, 0xe7, 0x09, 0x09, 0x1e, 0xe7, 0x0d, 0xf0,
-  0x33, 0xe4, 0xe7, 0xef, 0x07, 0x27, 0xf2, 0xbb, 0xc3, 0x30, 0xda, 0x0a,
-  0xcd, 0xf7, 0x7f, 0xe3, 0xcb, 0xfd, 0xe1, 0xef, 0x15, 0xf4, 0x02, 0xfe,
-  0x0b, 0xf9, 0xfd, 0xe1, 0x0e, 0x1a, 0x2c, 0xda, 0xe1, 0x28, 0xc4, 0xe9,
-  0xd7, 0xe0, 0xd9, 0xd4, 0x26, 0x0b, 0xce, 0xec, 0x17, 0x35, 0x23, 0xf4,
-  0xf2, 0x0d, 0x29, 0xde, 0x24, 0x03, 0xf3, 0xce, 0x16, 0xca, 0xe9, 0xdb,
-  0x1d, 0x21, 0xfd, 0xb7, 0x15, 0x10, 0xa1, 0x06, 0xc5, 0xb5, 0x01, 0xa2,
-  0x33, 0xe0, 0xc0, 0xed, 0xf0, 0x40, 0x27, 0xfa, 0xf0, 0x3a, 0x1b, 0xe5,
-  0x13, 0xe7, 0xb4, 0xb9, 0x0b, 0xf1, 0x1f, 0xfb, 0xe1, 0x12, 0x00, 0xd4,
-  0x1e, 0x0c, 0xd2, 0x16, 0xed, 0xf6, 0xed, 0xb8, 0x23, 0xee, 0xcf, 0x32,
-  0xfe, 0x2e, 0xe9, 0xdf, 0x0e, 0x17, 0xef, 0xfb, 0x13, 0xe2, 0xe4, 0xe1,
-  0x05, 0xfe, 0x19, 0xf6, 0xff, 0x2d, 0x05, 0xf5, 0x11, 0x14, 0xd5, 0xd0,
-  0xf7, 0xef, 0x02, 0x1b, 0x16, 0x35, 0x98, 0x2f, 0xf9, 0x25, 0x2c, 0xd9,
-  0x09, 0xfe, 0xfb, 0xfc, 0x50, 0x04, 0x01, 0x01, 0x28, 0x01, 0x0b, 0xca,
-  0x19, 0x18, 0x02, 0xf5, 0x25, 0x06, 0xb3, 0x05, 0xd9, 0xdd, 0x1d, 0xfc,
-  0x34, 0x1c, 0x94, 0x12, 0xf6, 0x0d, 0x31, 0xeb, 0x0f, 0x13, 0xf6, 0xfa,
-  0x11, 0xfb, 0xe1, 0xcc, 0x32, 0xf2, 0x18, 0x04, 0xf4, 0x3f, 0x16, 0xeb,
-  0x37, 0x0f, 0xc0, 0xee, 0xf7, 0xfb, 0xd8, 0xbd, 0x4b, 0xc6, 0xe0, 0x41,
-  0x0a, 0x01, 0xfc, 0x02, 0xe8, 0x1c, 0xb8, 0x10, 0xce, 0xf5, 0x3b, 0xca,
-  0xe1, 0xf3, 0x02, 0xe8, 0x38, 0x0f, 0x03, 0xfd, 0x1a, 0xd9, 0xf2, 0xe2,
-  0xd8, 0xd4, 0x2d, 0xb5, 0xfb, 0xe0, 0xf3, 0xfb, 0xe8, 0x1e, 0xc8, 0xe9,
-  0xe8, 0x17, 0x1f, 0xff, 0xd1, 0x28, 0xd0, 0xb5, 0xff, 0x04, 0x42, 0xcb,
-  0x44, 0x0b, 0xe8, 0xfb, 0xfc, 0xd2, 0x18, 0xca, 0xf9, 0xe1, 0x1a, 0xeb,
-  0x05, 0xd8, 0xda, 0xbd, 0xf9, 0x32, 0xf1, 0xd9, 0x09, 0x14, 0x19, 0x15,
-  0xdf, 0x09, 0xd2, 0xc6, 0x13, 0x1c, 0x7f, 0xd0, 0x18, 0x18, 0x30, 0xe7,
-  0xef, 0x18, 0x23, 0x07, 0xf2, 0xfc, 0xef, 0xd7, 0x27, 0xe4, 0xca, 0xe3,
-  0x15, 0x08, 0x1c, 0xe9, 0x12, 0xfe, 0x16, 0x0f, 0x05, 0xd2, 0x12, 0xed,
-  0x08, 0x18, 0x25, 0xf2, 0x30, 0x23, 0x0f, 0xea, 0xd2, 0x1e, 0xfe, 0xfa,
-  0xec, 0x04, 0x17, 0x8e, 0xe5, 0xb3, 0x28, 0xc0, 0xef, 0x0b, 0xfc, 0x2f,
-  0xef, 0x0c, 0x0f, 0x04, 0xe8, 0x29, 0xd5, 0xe0, 0xe6, 0x1d, 0x22, 0xe2,
-  0x4d, 0x01, 0xe3, 0xec, 0xd6, 0x09, 0x25, 0xcd, 0xd4, 0xe9, 0xec, 0xf6,
-  0xde, 0x01, 0x22, 0xb5, 0xf5, 0x23, 0xfb, 0x1e, 0x11, 0x02, 0x02, 0x1f,
-  0xec, 0x3a, 0xdf, 0x08, 0xea, 0x2e, 0x2d, 0xfa, 0x09, 0x05, 0x0f, 0xe8,
-  0xff, 0x4e, 0x27, 0xf5, 0xee, 0x1f, 0xc0, 0xca, 0xf9, 0x1d, 0x10, 0xe0,
-  0x00, 0x10, 0x29, 0x0b, 0x25, 0xef, 0xe1, 0x1e, 0x1d, 0x16, 0xf8, 0x2f,
-  0x00, 0x18, 0x44, 0xf0, 0x1d, 0x1f, 0x29, 0x05, 0xc3, 0x28, 0xda, 0xc8,
-  0xe8, 0x11, 0xf2, 0xcd, 0xef, 0xfc, 0x37, 0x01, 0xf1, 0xd7, 0x29, 0x29,
-  0x9f, 0xf8, 0xe4, 0x24, 0xf4, 0xea, 0x1c, 0xf5, 0xed, 0x10, 0x24, 0xf1,
-  0x1d, 0x05, 0x34, 0x00, 0xe6, 0x2d, 0xef, 0xcc, 0xe2, 0xfa, 0x01, 0x19,
-  0xdf, 0x18, 0x30, 0xea, 0x15, 0x04, 0x37, 0x24, 0xad, 0xff, 0xe0, 0x0d,
-  0xfc, 0x03, 0x06, 0x05, 0xe7, 0x14, 0x2d, 0x03, 0xc8, 0x0a, 0x3b, 0xde,
-  0x04, 0x4a, 0x26, 0xd6, 0x17, 0x0d, 0x04, 0xfa, 0xfd, 0x44, 0x1b, 0x01,
-  0x05, 0x0d, 0x37, 0x05, 0xb5, 0xf3, 0xb7, 0x01, 0x08, 0xf5, 0x16, 0x05,
-  0x66, 0xd4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+  0x10, 0x17, 0xb8, 0xe2, 0x12, 0xae, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x4b, 0xf9, 0xd5, 0xe5,
+  0x2d, 0x53, 0x7f, 0x3c, 0x1e, 0x04, 0x28, 0x94, 0x0f, 0xab, 0xc5, 0x06,
+  0xd5, 0x50, 0x52, 0x81, 0xfb, 0x08, 0xb4, 0x48, 0x0e, 0xf7, 0x2b, 0xd9,
+  0x2e, 0x1e, 0xd9, 0x72, 0x7f, 0xf0, 0x17, 0xec, 0x09, 0x05, 0x19, 0xd1,
+  0x1b, 0xde, 0xed, 0x0c, 0x05, 0x1b, 0xf0, 0x12, 0x7f, 0x59, 0x09, 0xd5,
+  0xcd, 0x19, 0xeb, 0x36, 0x70, 0xd7, 0x06, 0x2e, 0x37, 0x2e, 0x17, 0x20,
+  0x0e, 0xd8, 0xde, 0xe5, 0xf0, 0x7f, 0x11, 0x2b, 0x2c, 0xda, 0x02, 0xc5,
+  0xe4, 0x02, 0xe9, 0xc5, 0x03, 0x08, 0x3e, 0xd1, 0x72, 0x59, 0x07, 0xe5,
+  0xe8, 0xdd, 0x2a, 0x17, 0x0e, 0x0b, 0x46, 0x81, 0x08, 0x2a, 0x47, 0xd5,
+  0x21, 0x49, 0xe2, 0xbe, 0x04, 0xff, 0x53, 0x81, 0x7a, 0xe2, 0x21, 0xcf,
+  0xe5, 0xdc, 0x20, 0xc3, 0x23, 0x57, 0xb9, 0xf0, 0xd5, 0x13, 0x7f, 0x5d,
+  0x18, 0x00, 0x41, 0xdd, 0xea, 0x63, 0x3e, 0xca, 0x91, 0x45, 0xe7, 0x15,
+  0xf6, 0x4a, 0xb4, 0xfc, 0x86, 0x3a, 0x7f, 0xb5, 0x3c, 0xeb, 0x11, 0xde,
+  0x08, 0xa1, 0x2d, 0xa1, 0x81, 0x64, 0x41, 0x5b, 0x25, 0x10, 0x4c, 0x1e,
+  0xac, 0x88, 0xb0, 0xd6, 0xd4, 0xb8, 0x19, 0xe3, 0x4e, 0x86, 0xe7, 0xb2,
+  0x36, 0xa2, 0x81, 0xb0, 0x81, 0x12, 0x1f, 0xcc, 0xdc, 0xe8, 0x4f, 0xfe,
+  0xf5, 0x35, 0xe7, 0x3d, 0xb7, 0xfe, 0x45, 0xad, 0x18, 0x20, 0x0d, 0xe3,
+  0xe5, 0x31, 0xbc, 0x0f, 0xfc, 0x81, 0xf7, 0x14, 0x1e, 0x1b, 0xf2, 0x06,
+  0xd3, 0x1b, 0x0b, 0x18, 0x37, 0xcb, 0x7f, 0x04, 0xc3, 0x41, 0xdb, 0x12,
+  0xce, 0xce, 0x1d, 0xad, 0xd6, 0xf9, 0x07, 0x6d, 0xde, 0xf1, 0x95, 0xc4,
+  0x81, 0x56, 0x70, 0xe8, 0x16, 0xe5, 0x24, 0x2b, 0x17, 0x1b, 0x29, 0x3b,
+  0x1b, 0xd7, 0x3d, 0xed, 0x1e, 0x15, 0x24, 0x00, 0x7f, 0xfc, 0x13, 0x00,
+  0x0d, 0x19, 0x11, 0x1a, 0x07, 0xc1, 0x3a, 0xf4, 0x56, 0x7f, 0x5f, 0xd0,
+  0xee, 0x0d, 0xf4, 0x57, 0x7f, 0xf6, 0x0a, 0x42, 0xda, 0xae, 0xcc, 0x20,
+  0x23, 0x33, 0xf3, 0x79, 0x04, 0xf2, 0x9c, 0x38, 0x27, 0x05, 0x10, 0x7f,
+  0x1c, 0x22, 0x11, 0x1d, 0x1b, 0x02, 0xd2, 0x09, 0xed, 0x0e, 0x03, 0x0f,
+  0x82, 0x21, 0xae, 0xc1, 0xf9, 0x0c, 0x76, 0x7f, 0x42, 0xb8, 0x32, 0xcc,
+  0x15, 0xf1, 0xca, 0xf9, 0xbd, 0x11, 0x1e, 0x7f, 0x0d, 0xc6, 0xd6, 0x05,
+  0x5a, 0xdb, 0xf9, 0xba, 0x12, 0x23, 0xef, 0x45, 0xe0, 0x2d, 0xe0, 0x34,
+  0x6e, 0x2d, 0x7f, 0xfe, 0x66, 0x62, 0x90, 0x3c, 0xda, 0xf0, 0x2b, 0x22,
+  0xd1, 0xd7, 0xb8, 0x16, 0xe8, 0x36, 0x7f, 0x0c, 0x0d, 0x6d, 0x09, 0xc3,
+  0xf5, 0xe8, 0xbc, 0xc4, 0x4a, 0x12, 0x16, 0x51, 0xd1, 0x3c, 0xcc, 0x39,
+  0x0c, 0x94, 0xb6, 0x7f, 0x25, 0x10, 0xf3, 0xf8, 0x19, 0x2b, 0xdd, 0xbd,
+  0x3a, 0xf8, 0x7f, 0x45, 0x0c, 0x1e, 0x3b, 0xe4, 0x5f, 0x09, 0x3f, 0x43,
+  0x6c, 0x4a, 0x5f, 0x21, 0xf3, 0x1b, 0xbb, 0xc5, 0xe2, 0xd0, 0x24, 0xeb,
+  0x7f, 0xf5, 0x05, 0x0b, 0xa8, 0xcc, 0x30, 0x42, 0x51, 0x05, 0x0d, 0xbf,
+  0x81, 0x4f, 0xfa, 0xb5, 0xf3, 0x3d, 0x11, 0xd8, 0x35, 0xf2, 0xf1, 0x9d,
+  0x29, 0xe4, 0x1d, 0x7f, 0xad, 0xae, 0x08, 0x35, 0x75, 0xf0, 0x66, 0xe7,
+  0x03, 0xe5, 0x10, 0x17, 0x21, 0x7f, 0xb0, 0x04, 0x23, 0xef, 0x13, 0xd6,
+  0xd9, 0xff, 0x04, 0x3d, 0x3a, 0xfc, 0xce, 0xe4, 0xa7, 0xda, 0xe5, 0xe3,
+  0xb0, 0x4a, 0xf4, 0x0a, 0x81, 0xf8, 0x04, 0x7a, 0x15, 0x36, 0xda, 0xdd,
+  0xcc, 0x8f, 0x8d, 0x34, 0x71, 0x96, 0xa4, 0x4d, 0x81, 0x70, 0x5b, 0x2d,
+  0xef, 0x27, 0x3a, 0xec, 0xb1, 0x31, 0xe1, 0xef, 0x81, 0x06, 0xff, 0xc7,
+  0x1a, 0x1a, 0x2c, 0x08, 0x22, 0xb0, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xb8, 0xe0, 0x2c, 0xfe,
+  0xea, 0xd6, 0x0f, 0x36, 0x05, 0x05, 0xf7, 0x05, 0x04, 0xb9, 0x25, 0x1a,
+  0xe0, 0xe7, 0xee, 0xe2, 0xdf, 0xcb, 0xbe, 0xe1, 0xc3, 0x30, 0x37, 0xdf,
+  0xf4, 0xea, 0xe7, 0xbb, 0x19, 0xed, 0x55, 0x13, 0xc9, 0xd5, 0x27, 0xd7,
+  0xde, 0x04, 0xe3, 0x01, 0x05, 0x03, 0xd9, 0xe2, 0x17, 0xd0, 0xe1, 0xe3,
+  0xf4, 0xcd, 0xda, 0x0d, 0xde, 0xf4, 0x35, 0x06, 0xf1, 0xef, 0xe1, 0x02,
+  0x15, 0x13, 0x24, 0x49, 0x02, 0xef, 0xe9, 0xab, 0xae, 0x0d, 0xea, 0xda,
+  0x13, 0x19, 0xc7, 0xc0, 0xfc, 0x2f, 0xfc, 0xe8, 0xd9, 0x05, 0x1b, 0x14,
+  0xf2, 0xea, 0xdf, 0x0f, 0x1d, 0x00, 0xeb, 0x45, 0xc9, 0xc8, 0x1e, 0xa2,
+  0xf8, 0xd7, 0xed, 0x7f, 0x10, 0xd8, 0xfb, 0xf3, 0xf4, 0xde, 0x46, 0x28,
+  0xed, 0xe1, 0xf5, 0x06, 0x09, 0x09, 0xbf, 0x01, 0xbf, 0x2e, 0x1b, 0xca,
+  0xfd, 0x41, 0xf7, 0xb5, 0x3c, 0xcf, 0x3a, 0xdc, 0xbe, 0x1a, 0x1f, 0xfc,
+  0x0b, 0x0a, 0x01, 0xe9, 0x02, 0x0f, 0xeb, 0xe5, 0x11, 0xb4, 0xfb, 0x04,
+  0xd7, 0x0a, 0xe5, 0x01, 0x09, 0xe3, 0x2a, 0xf2, 0xeb, 0x4c, 0xf5, 0x10,
+  0x33, 0x1b, 0x0a, 0x27, 0xa5, 0x13, 0x05, 0xbe, 0xfb, 0x4c, 0xff, 0x10,
+  0x11, 0x39, 0xa2, 0xe4, 0xff, 0x13, 0x0f, 0x0f, 0x01, 0x1b, 0x06, 0x0b,
+  0x5e, 0xd2, 0x01, 0x08, 0x1f, 0x33, 0xf4, 0x27, 0xdf, 0xd8, 0xee, 0xdc,
+  0x40, 0xcf, 0xf6, 0x34, 0xdb, 0xc3, 0x0d, 0xec, 0xdb, 0xe0, 0x3a, 0xfb,
+  0xdd, 0xe5, 0xff, 0xff, 0x02, 0x0d, 0xc5, 0xfb, 0xfe, 0x0b, 0x31, 0xc4,
+  0xe0, 0x21, 0xd1, 0xdf, 0x42, 0xca, 0x21, 0x06, 0x34, 0xce, 0x08, 0xdc,
+  0xd5, 0xe1, 0x16, 0x16, 0x03, 0x1f, 0xf4, 0xda, 0x01, 0xbe, 0xf7, 0x2b,
+  0xcc, 0x18, 0xb1, 0xef, 0x0a, 0x04, 0xf1, 0xd8, 0xe8, 0x02, 0xfd, 0x0f,
+  0x34, 0xe6, 0x04, 0x2f, 0xd6, 0xed, 0x1c, 0xc5, 0xf3, 0x36, 0x13, 0x25,
+  0x28, 0x3c, 0x8c, 0x04, 0x1b, 0x17, 0xf0, 0x1f, 0xfa, 0x2d, 0x0f, 0x06,
+  0x2a, 0xf1, 0xfc, 0xf7, 0x19, 0x1e, 0x30, 0xfb, 0x21, 0x3c, 0x20, 0x05,
+  0x0d, 0xcf, 0xfd, 0xb4, 0xfd, 0xd1, 0xd6, 0x13, 0x44, 0x30, 0xd5, 0xf3,
+  0x19, 0xf0, 0xee, 0xf9, 0xe1, 0xfb, 0x11, 0xe7, 0xe2, 0xf2, 0xe1, 0x52,
+  0xf4, 0xfe, 0xde, 0xe9, 0xef, 0x2f, 0x0f, 0x24, 0x0e, 0xa2, 0xe4, 0x11,
+  0x1b, 0xfb, 0x0d, 0xfd, 0x1d, 0xfb, 0x23, 0x1e, 0xc4, 0x0a, 0xe7, 0x30,
+  0xd8, 0xf8, 0x2c, 0xcd, 0xf5, 0x21, 0x1a, 0xef, 0x14, 0x1a, 0x29, 0x05,
+  0xeb, 0xd4, 0xf9, 0x0d, 0x08, 0xc2, 0xde, 0x20, 0x1e, 0x21, 0xee, 0x17,
+  0xe2, 0x05, 0x51, 0x06, 0xd6, 0xf8, 0x05, 0xce, 0xf1, 0xf6, 0x17, 0x11,
+  0xef, 0x2a, 0x19, 0xe7, 0xc8, 0xf7, 0xfd, 0x4c, 0xee, 0x3f, 0x0c, 0x08,
+  0x34, 0x16, 0x19, 0xba, 0x00, 0xf1, 0xed, 0xf9, 0x4a, 0x23, 0xb8, 0xf8,
+  0x2b, 0xf9, 0xe5, 0xfe, 0x10, 0x11, 0x02, 0x03, 0xcc, 0x00, 0xaf, 0x56,
+  0x08, 0xed, 0x21, 0xc9, 0x03, 0x1d, 0x1f, 0x23, 0x2c, 0xf0, 0x24, 0x24,
+  0xfe, 0xf7, 0x18, 0xca, 0x21, 0x04, 0x18, 0x29, 0xdd, 0xf4, 0xfc, 0x01,
+  0xeb, 0xf3, 0xf3, 0x10, 0x22, 0x26, 0x47, 0xd4, 0x0d, 0x30, 0xfd, 0x1f,
+  0xac, 0x85, 0xf5, 0x00, 0xd1, 0xf4, 0x00, 0x3b, 0x14, 0xfb, 0xed, 0x13,
+  0xae, 0xeb, 0x7f, 0xec, 0x9e, 0x12, 0xfa, 0xd9, 0xcc, 0xeb, 0xf6, 0x05,
+  0x29, 0x11, 0x61, 0xaa, 0xd4, 0x0d, 0xc9, 0x39, 0x33, 0x1d, 0x16, 0x0d,
+  0x10, 0x01, 0x14, 0xe5, 0x03, 0x04, 0x0c, 0xfe, 0x1b, 0x1b, 0xd3, 0xe8,
+  0x26, 0xd9, 0x0c, 0xfe, 0x1d, 0x07, 0xfd, 0x03, 0xfb, 0x08, 0xbe, 0x30,
+  0x14, 0xf0, 0x27, 0xd3, 0x26, 0x1e, 0x3e, 0x17, 0xfe, 0x31, 0x32, 0x17,
+  0xdc, 0xfd, 0x03, 0xdc, 0x29, 0x17, 0x20, 0x03, 0x29, 0xc8, 0x14, 0x03,
+  0x27, 0xf3, 0xd6, 0x24, 0x16, 0x23, 0xfe, 0xf4, 0x00, 0xfb, 0x0e, 0xe9,
+  0xc6, 0xb4, 0x21, 0xfc, 0xf4, 0x16, 0x25, 0xf0, 0x0e, 0x19, 0xe2, 0xe9,
+  0xd1, 0xe0, 0x37, 0xe9, 0xcb, 0xf5, 0x02, 0xf3, 0xf1, 0xcf, 0xf8, 0xf4,
+  0xff, 0xf6, 0x73, 0xbf, 0xea, 0x0d, 0xbc, 0xf2, 0x4a, 0xd2, 0x35, 0xae,
+  0x9a, 0x65, 0x2b, 0x0c, 0x90, 0xf5, 0xef, 0x1d, 0xe7, 0xd6, 0xaa, 0xdc,
+  0x22, 0xd4, 0x2b, 0xb1, 0x28, 0xd6, 0xd4, 0xe3, 0xe1, 0xaa, 0x2b, 0xce,
+  0xa1, 0xdd, 0x10, 0x90, 0x54, 0xcd, 0x32, 0xcb, 0xe7, 0x53, 0xf2, 0x00,
+  0x0c, 0xee, 0xf9, 0x27, 0x27, 0xfa, 0x05, 0x0d, 0x1e, 0xf7, 0x3a, 0xfc,
+  0x2b, 0xd9, 0xd9, 0xe8, 0x18, 0xb4, 0x4a, 0xfb, 0x8b, 0x2a, 0xea, 0xec,
+  0x3f, 0x27, 0x09, 0xfa, 0x03, 0x21, 0xe3, 0xbc, 0x0a, 0xe3, 0xff, 0x18,
+  0x26, 0xfc, 0xeb, 0xec, 0xf4, 0xdf, 0x13, 0x0e, 0x15, 0xd7, 0x05, 0x2c,
+  0xdc, 0xe0, 0xf6, 0x24, 0xd3, 0x26, 0xfb, 0x04, 0x2a, 0x01, 0x3e, 0xea,
+  0xb9, 0x4c, 0x48, 0x2c, 0xc8, 0x05, 0xe0, 0x45, 0xd8, 0xf1, 0xf9, 0x18,
+  0x38, 0xda, 0x35, 0xd2, 0x1e, 0xf4, 0xbd, 0x34, 0xeb, 0xfe, 0x47, 0xe5,
+  0xc4, 0x14, 0xf4, 0x92, 0x33, 0xde, 0x3e, 0xc8, 0xbb, 0x71, 0x2d, 0x1b,
+  0xdf, 0xf1, 0xfb, 0x6f, 0x11, 0xd8, 0x04, 0x1c, 0x3b, 0xf2, 0x40, 0xac,
+  0x76, 0xd1, 0xa8, 0x18, 0x14, 0xdb, 0x76, 0xde, 0x81, 0x25, 0x06, 0xd1,
+  0x0a, 0xe6, 0x17, 0xcd, 0xb9, 0x61, 0x0f, 0xfa, 0xcd, 0x00, 0xee, 0x45,
+  0x09, 0xd4, 0x04, 0xd8, 0x2c, 0xb5, 0x34, 0xd9, 0x53, 0x18, 0xd5, 0x16,
+  0x04, 0xde, 0x6c, 0xfa, 0x9f, 0x2d, 0x28, 0xda, 0x24, 0xf9, 0x2f, 0xcc,
+  0xe1, 0x4e, 0xf1, 0xf1, 0x05, 0xfa, 0x0e, 0xf4, 0xe8, 0x07, 0xc2, 0x0f,
+  0xf2, 0xb5, 0xf7, 0xdd, 0xdd, 0xfd, 0xdd, 0x06, 0xeb, 0xeb, 0x09, 0x14,
+  0xff, 0x08, 0xdf, 0xc9, 0x16, 0x02, 0x0e, 0xd8, 0xb1, 0x41, 0xf8, 0xfa,
+  0x1d, 0x1d, 0xf5, 0xf0, 0x09, 0xf4, 0xcc, 0x26, 0x0e, 0x20, 0xea, 0xe3,
+  0x21, 0xcc, 0xc6, 0x0b, 0x1d, 0xe7, 0x2e, 0x06, 0xbf, 0x1d, 0x03, 0xe3,
+  0x02, 0xee, 0xe2, 0xd2, 0x91, 0x2d, 0x01, 0xd7, 0x45, 0x13, 0xf2, 0x04,
+  0x18, 0xf0, 0xd6, 0xdf, 0x23, 0xb0, 0x1d, 0x0a, 0xfb, 0xe8, 0xef, 0x22,
+  0x0c, 0xd9, 0x56, 0xec, 0xf7, 0xee, 0x1b, 0xb1, 0xbb, 0x16, 0x4a, 0xdd,
+  0xd7, 0x3e, 0x01, 0x0a, 0xee, 0x05, 0x3a, 0xcd, 0xe9, 0x53, 0x18, 0x05,
+  0x2c, 0x29, 0xef, 0x7f, 0x40, 0x06, 0x17, 0x19, 0x85, 0x25, 0xe6, 0x0d,
+  0x26, 0x16, 0x12, 0xad, 0xc2, 0x15, 0x09, 0xd5, 0x02, 0xfc, 0xfe, 0x13,
+  0xdc, 0xe0, 0x06, 0xbd, 0x02, 0x42, 0x17, 0xef, 0x2b, 0xd9, 0xe4, 0x33,
+  0x2a, 0xeb, 0xc9, 0xf2, 0xdb, 0x14, 0xf4, 0xfd, 0x43, 0xfb, 0x09, 0x93,
+  0xe2, 0xe9, 0x13, 0xdd, 0xff, 0x23, 0xdb, 0x34, 0xfe, 0xff, 0x00, 0x03,
+  0x07, 0x1f, 0xfd, 0xed, 0x20, 0xe1, 0xc5, 0x0b, 0xff, 0x19, 0x49, 0x13,
+  0x2d, 0xfa, 0x03, 0xe9, 0x25, 0xcc, 0x13, 0xca, 0xca, 0x1f, 0x16, 0x2b,
+  0xf2, 0x27, 0xcc, 0xf4, 0xfb, 0x01, 0x31, 0x0e, 0x40, 0x26, 0x0d, 0x02,
+  0x23, 0x37, 0x0b, 0x3e, 0x06, 0x10, 0xf0, 0x25, 0x98, 0x21, 0xec, 0x25,
+  0x02, 0xf7, 0x22, 0xf8, 0xea, 0x08, 0xe4, 0xfe, 0x13, 0x08, 0xeb, 0x2d,
+  0xe6, 0xd6, 0x1d, 0x1c, 0x58, 0x05, 0x22, 0xec, 0x24, 0x0a, 0xff, 0x1a,
+  0xf5, 0xdc, 0xcb, 0x03, 0xf0, 0x01, 0x13, 0x02, 0x0d, 0xd5, 0xfb, 0x15,
+  0xf4, 0x0c, 0x02, 0xdf, 0x14, 0xf6, 0xe6, 0x2a, 0xd2, 0xe3, 0xf1, 0x40,
+  0x2f, 0x20, 0xe0, 0xa7, 0x2f, 0xc2, 0xe8, 0xbd, 0x05, 0xd4, 0x15, 0x32,
+  0x31, 0xed, 0x2a, 0x14, 0x06, 0xde, 0xec, 0x08, 0x31, 0x24, 0xb5, 0x5b,
+  0x0a, 0x1a, 0xf8, 0x04, 0xf1, 0x05, 0x13, 0xd9, 0x71, 0x14, 0xd6, 0xdc,
+  0x04, 0xce, 0xfa, 0xf5, 0xfd, 0x28, 0x14, 0x1b, 0xba, 0xda, 0x1d, 0x36,
+  0xdc, 0x2c, 0x0c, 0x1a, 0x20, 0x20, 0xb7, 0x35, 0x27, 0x09, 0xd9, 0x0b,
+  0xe3, 0xc4, 0x28, 0xe3, 0x59, 0xf8, 0x01, 0xde, 0xf0, 0xc2, 0xfc, 0xdc,
+  0xf8, 0x0d, 0xdd, 0x21, 0x0a, 0xe7, 0x02, 0x0a, 0xfa, 0xea, 0xf7, 0x35,
+  0x2a, 0x23, 0x11, 0x25, 0x2c, 0xeb, 0xbd, 0xff, 0xe2, 0x14, 0xed, 0xf8,
+  0x3e, 0x24, 0xda, 0xb4, 0x06, 0xae, 0xfc, 0xc1, 0x09, 0xfd, 0xc0, 0x11,
+  0x27, 0xe5, 0x18, 0x26, 0x1c, 0xeb, 0xfc, 0x2a, 0xf7, 0x09, 0x1a, 0xc2,
+  0xf5, 0x37, 0x33, 0xda, 0xb3, 0xdb, 0xdb, 0x4e, 0x11, 0x10, 0x01, 0xdb,
+  0x4e, 0xf1, 0xf4, 0x05, 0x50, 0xf2, 0xd2, 0x64, 0xf1, 0x28, 0x42, 0xfe,
+  0xb7, 0xff, 0xfb, 0xe6, 0x09, 0xd8, 0x05, 0xe8, 0x28, 0xd2, 0x58, 0x1f,
+  0xf2, 0x3a, 0xd3, 0xcf, 0xd1, 0xf2, 0x4d, 0x36, 0xcf, 0xfc, 0x4b, 0x2c,
+  0x0b, 0xeb, 0x21, 0x06, 0x12, 0x2e, 0x1d, 0xdc, 0xe0, 0x55, 0xd8, 0x16,
+  0xd5, 0x01, 0xce, 0x01, 0x11, 0xe3, 0xf6, 0x2a, 0x54, 0xcb, 0x13, 0xc6,
+  0xfb, 0x10, 0x03, 0x12, 0xfd, 0x07, 0x99, 0x16, 0xc8, 0xfd, 0x4f, 0xe1,
+  0xbe, 0x13, 0xe0, 0xff, 0x1d, 0xe1, 0xc5, 0xe5, 0x19, 0x28, 0x50, 0x06,
+  0xf2, 0x29, 0xff, 0xef, 0xb9, 0xda, 0xe7, 0x49, 0x02, 0x2a, 0x04, 0x08,
+  0x5b, 0x2d, 0x25, 0xd8, 0x61, 0x88, 0xe6, 0x0e, 0xba, 0x27, 0x3c, 0xff,
+  0xd1, 0x69, 0xd8, 0xa4, 0x96, 0xb6, 0xdb, 0xf1, 0x06, 0x03, 0xe1, 0x73,
+  0xf5, 0xf7, 0x1e, 0xb8, 0xd2, 0xf7, 0x6a, 0x7f, 0xdd, 0xb5, 0x22, 0x33,
+  0x0b, 0xd9, 0xd9, 0xd7, 0xc7, 0x31, 0x1a, 0xd6, 0xd5, 0x69, 0xd9, 0xa5,
+  0x17, 0x04, 0x0f, 0x4b, 0x60, 0xc4, 0xfd, 0x28, 0x25, 0xe5, 0x01, 0xbb,
+  0x09, 0x25, 0xf7, 0xf3, 0xf2, 0x12, 0xe4, 0x17, 0xa8, 0x3c, 0x29, 0xcc,
+  0xd4, 0x0c, 0xbb, 0x00, 0x41, 0x01, 0xe3, 0x18, 0x14, 0x1b, 0xc3, 0x2a,
+  0xe9, 0xdf, 0xe7, 0x02, 0xeb, 0x02, 0xee, 0x1f, 0xf1, 0x30, 0xff, 0x15,
+  0xf2, 0xd5, 0xf3, 0xd8, 0x32, 0xe3, 0xee, 0xe5, 0x11, 0xfb, 0x2e, 0x19,
+  0xe1, 0x0d, 0xcd, 0xf4, 0xe7, 0xfc, 0xef, 0x1a, 0x24, 0xd2, 0xd3, 0x17,
+  0xfe, 0xf3, 0xc9, 0xe0, 0xfc, 0x35, 0x15, 0x17, 0xdd, 0xbd, 0xf1, 0x03,
+  0x08, 0x2a, 0xee, 0xe4, 0x11, 0xee, 0xee, 0xfa, 0xed, 0x14, 0xb1, 0x0b,
+  0x24, 0xfd, 0xe0, 0x0a, 0x05, 0xc0, 0xfb, 0xd3, 0xd4, 0xf7, 0xcd, 0x18,
+  0xe5, 0x21, 0xe3, 0xd1, 0xf5, 0xee, 0xfc, 0xc3, 0xd6, 0x26, 0xd2, 0xea,
+  0x38, 0xf5, 0xd1, 0x00, 0x00, 0xd1, 0xda, 0x43, 0x0e, 0xde, 0x57, 0xe1,
+  0xbd, 0xf5, 0x0c, 0x11, 0xcc, 0xcb, 0x5c, 0x4b, 0xfb, 0x18, 0x3e, 0xf6,
+  0xe2, 0xec, 0x02, 0x18, 0x0c, 0xe0, 0x81, 0x13, 0xfa, 0x34, 0xf6, 0xd9,
+  0xf0, 0xf9, 0x6f, 0xce, 0xff, 0xff, 0x29, 0xe6, 0xb1, 0x19, 0xe8, 0x06,
+  0xe7, 0x08, 0x18, 0x2c, 0x24, 0x0b, 0x0e, 0x0c, 0x42, 0xc1, 0xef, 0x2e,
+  0x0f, 0xed, 0xed, 0x12, 0xec, 0x0b, 0xba, 0x11, 0x15, 0xcc, 0x3b, 0xdd,
+  0x34, 0x28, 0x0b, 0x06, 0xce, 0x21, 0xd8, 0xa5, 0xd9, 0xfa, 0x0b, 0x4e,
+  0x09, 0x37, 0xc8, 0xc1, 0x60, 0xd7, 0xdd, 0xcb, 0x08, 0x5f, 0x15, 0x05,
+  0xc0, 0xf8, 0xca, 0x26, 0x04, 0xc6, 0xe9, 0xd1, 0xd1, 0xdb, 0x07, 0xd3,
+  0xa2, 0x2d, 0x3b, 0x48, 0xf0, 0xdd, 0x57, 0xec, 0x05, 0xda, 0x56, 0xf1,
+  0xce, 0xfd, 0x2c, 0xde, 0xf3, 0xf4, 0xc6, 0x60, 0x44, 0x38, 0x26, 0xdb,
+  0xee, 0xf1, 0x02, 0xf1, 0x15, 0x06, 0xe5, 0x07, 0xf9, 0xf1, 0x1d, 0x42,
+  0x23, 0x0c, 0x3b, 0xeb, 0x33, 0xf0, 0x29, 0x2b, 0x45, 0xd5, 0x05, 0xef,
+  0xef, 0x10, 0xdc, 0x5e, 0xfb, 0x1d, 0xf1, 0x08, 0x27, 0xe1, 0xfa, 0x18,
+  0x52, 0x2d, 0x09, 0x1b, 0x00, 0xcc, 0xf5, 0x91, 0x26, 0xee, 0xfa, 0xe7,
+  0x0c, 0x3e, 0x97, 0xc8, 0x3a, 0x05, 0xc1, 0xda, 0x07, 0x33, 0x0a, 0xf5,
+  0xb8, 0x0d, 0xc5, 0x3b, 0x38, 0xed, 0xe0, 0x50, 0xb3, 0xce, 0xda, 0xad,
+  0xe1, 0x49, 0x2e, 0x46, 0xf9, 0xd0, 0x53, 0xec, 0xb0, 0xfb, 0x50, 0xf7,
+  0xe6, 0xdc, 0x21, 0xf5, 0x0b, 0x00, 0x15, 0x37, 0x31, 0x12, 0xf1, 0xcd,
+  0xde, 0x0a, 0x05, 0x0f, 0x2d, 0xf1, 0x13, 0xdb, 0x70, 0xf8, 0xf8, 0x05,
+  0xee, 0xfc, 0x15, 0xc7, 0xd7, 0x0a, 0x20, 0xd3, 0x05, 0x19, 0xf2, 0x01,
+  0xd9, 0xfa, 0x4b, 0x29, 0xe4, 0x14, 0xe5, 0xf7, 0x27, 0x2a, 0xfb, 0x22,
+  0x17, 0xf5, 0xf4, 0xec, 0x70, 0xba, 0x05, 0xe4, 0x37, 0xf8, 0x44, 0xb2,
+  0xdc, 0x06, 0xf2, 0xc6, 0xd1, 0x33, 0xc1, 0x1f, 0xdd, 0xf7, 0x3a, 0xe3,
+  0xdd, 0x09, 0xeb, 0xf1, 0x21, 0x40, 0x20, 0x4f, 0xe6, 0x00, 0xf3, 0xde,
+  0xe6, 0xe7, 0x1e, 0xb1, 0xd2, 0x9f, 0xe7, 0xdf, 0xdb, 0xd9, 0xac, 0x15,
+  0xbd, 0xf8, 0x09, 0xbf, 0x99, 0xe0, 0xf1, 0x1e, 0xba, 0xcc, 0xff, 0x02,
+  0xad, 0xde, 0xa9, 0xe2, 0x20, 0xe2, 0xf7, 0xf4, 0xb4, 0xea, 0x1c, 0xb1,
+  0xe1, 0xe0, 0xec, 0xc8, 0xee, 0xa7, 0xe7, 0xe0, 0xa8, 0xa0, 0xea, 0xd8,
+  0xbb, 0xdb, 0xe8, 0x37, 0xd9, 0xcd, 0x28, 0xe7, 0x81, 0xf3, 0xbb, 0x3e,
+  0x1e, 0xdc, 0xe9, 0xf9, 0x9f, 0xcf, 0x08, 0x8d, 0xe4, 0xfd, 0xe5, 0x0c,
+  0xfc, 0xc0, 0xe4, 0xfd, 0x95, 0xd9, 0xec, 0x1f, 0xab, 0xfd, 0xef, 0x01,
+  0xe6, 0xbb, 0x07, 0xec, 0xaa, 0xfb, 0xef, 0x0b, 0xf5, 0x23, 0xf0, 0x2e,
+  0xf8, 0x34, 0x10, 0xe5, 0x01, 0xd3, 0x29, 0x3a, 0x26, 0x37, 0xc1, 0x17,
+  0x24, 0x06, 0x00, 0xfc, 0xf5, 0xf3, 0x0c, 0xff, 0xf2, 0xf0, 0x1c, 0x20,
+  0xe9, 0x13, 0x0f, 0xac, 0x00, 0x1a, 0x1c, 0x33, 0xfb, 0x22, 0xf0, 0xef,
+  0x18, 0xfc, 0x3e, 0x1d, 0x0a, 0x0e, 0xfd, 0xd9, 0xf3, 0xff, 0xf7, 0xcc,
+  0xf9, 0xf0, 0xe4, 0x10, 0x01, 0xfe, 0x20, 0x11, 0xdd, 0x49, 0x02, 0x1a,
+  0x11, 0xee, 0xf1, 0x0e, 0x10, 0xee, 0x02, 0xee, 0x24, 0xd6, 0x26, 0x44,
+  0xfc, 0xe1, 0xf0, 0xc0, 0xab, 0x06, 0xee, 0x1e, 0xb3, 0x0e, 0x08, 0xd9,
+  0xf8, 0xff, 0x09, 0xf5, 0xdb, 0x40, 0xef, 0x0f, 0x1c, 0x05, 0xf8, 0x29,
+  0xe5, 0x11, 0xec, 0xe3, 0xe7, 0xf0, 0x0c, 0x20, 0x28, 0x0d, 0xb8, 0xd4,
+  0x19, 0xed, 0x0a, 0x07, 0x14, 0x12, 0xfa, 0x0b, 0xe9, 0xe7, 0xf7, 0x05,
+  0xef, 0xe5, 0x17, 0xd7, 0x1a, 0x09, 0x13, 0x3d, 0xed, 0x1f, 0xf7, 0xf1,
+  0x1f, 0x3c, 0x11, 0x19, 0x33, 0x2d, 0xde, 0xea, 0xff, 0xee, 0x0a, 0x05,
+  0x3a, 0x12, 0xf9, 0x21, 0xe8, 0xcc, 0x02, 0x00, 0xe8, 0x0b, 0x2a, 0x15,
+  0xf6, 0xed, 0x0d, 0x29, 0x14, 0xcc, 0xee, 0xe0, 0x13, 0xe5, 0x42, 0xe0,
+  0x08, 0xff, 0xe8, 0x02, 0xdf, 0xff, 0x02, 0x12, 0xcc, 0x3b, 0x51, 0xf9,
+  0xf5, 0xd4, 0xf9, 0xe7, 0xf9, 0xf1, 0xe1, 0x42, 0xf7, 0xea, 0x1e, 0xe1,
+  0xe8, 0xfc, 0x1c, 0xe0, 0x10, 0xfa, 0x21, 0x0e, 0x03, 0xdc, 0x15, 0x0f,
+  0x11, 0x07, 0xfd, 0x1f, 0xf0, 0x33, 0x21, 0x22, 0xf7, 0x36, 0x2c, 0xcd,
+  0x1c, 0x25, 0x17, 0x21, 0xba, 0xbb, 0x16, 0xf9, 0x0b, 0xfb, 0xff, 0x03,
+  0xf8, 0x11, 0x3a, 0xfd, 0xfd, 0xeb, 0x16, 0x14, 0x06, 0xfd, 0xee, 0x32,
+  0xe5, 0x35, 0x2e, 0xf1, 0xfd, 0x34, 0xf9, 0xa5, 0x0e, 0xee, 0x0d, 0x0c,
+  0xcf, 0xb7, 0x2f, 0xdf, 0x0c, 0x25, 0x03, 0xfc, 0xd5, 0x2c, 0x22, 0xee,
+  0xef, 0xe2, 0x14, 0xe0, 0x02, 0x0d, 0x15, 0x16, 0x00, 0x1e, 0x15, 0xd6,
+  0x0c, 0x0e, 0x13, 0xd4, 0x12, 0xe9, 0x1f, 0xf6, 0x0b, 0xce, 0x31, 0xf9,
+  0xb9, 0x2b, 0x00, 0x22, 0x20, 0xf7, 0x05, 0x45, 0xd2, 0xf0, 0x28, 0x17,
+  0x13, 0x34, 0xfd, 0xf3, 0x21, 0x08, 0x07, 0x10, 0x2c, 0x1d, 0xfc, 0xa8,
+  0x17, 0x12, 0x0f, 0xe0, 0xf8, 0x97, 0x32, 0xf8, 0xf3, 0xf0, 0x03, 0x03,
+  0x11, 0x05, 0x02, 0x12, 0xbc, 0xfa, 0x0a, 0x03, 0x1a, 0x25, 0xd8, 0x29,
+  0x0b, 0x30, 0x18, 0x01, 0x14, 0x1a, 0xf3, 0x8b, 0xf9, 0xfd, 0xed, 0x01,
+  0xd0, 0x81, 0x18, 0xc5, 0x09, 0xfc, 0x03, 0x16, 0xf7, 0x37, 0xf3, 0xfc,
+  0xdd, 0xdc, 0x11, 0x0c, 0xde, 0x11, 0x00, 0x17, 0xf7, 0x26, 0x11, 0xe0,
+  0x06, 0x0e, 0x13, 0xba, 0xff, 0xf8, 0xe1, 0x1e, 0x1d, 0xcf, 0x1f, 0x02,
+  0x08, 0x27, 0x09, 0x2d, 0x10, 0x19, 0xf1, 0x29, 0xd0, 0xf9, 0x1a, 0xf7,
+  0x00, 0x0b, 0x21, 0xec, 0x19, 0x11, 0x0a, 0xfa, 0x12, 0x05, 0x06, 0xb4,
+  0x08, 0x07, 0x03, 0xee, 0x23, 0xbc, 0x29, 0xf1, 0x04, 0x17, 0x0e, 0xed,
+  0x0f, 0x08, 0x0c, 0xf4, 0xcb, 0x20, 0x13, 0x09, 0x30, 0x1c, 0x00, 0xfc,
+  0xfa, 0x20, 0x13, 0x02, 0xfa, 0x0e, 0xe9, 0xbc, 0x00, 0xe0, 0xf8, 0xfe,
+  0xf9, 0xa8, 0x1c, 0xc0, 0xf4, 0x1c, 0xfd, 0xdb, 0x22, 0x3b, 0x0e, 0xda,
+  0xc1, 0xfc, 0x0a, 0x09, 0xf0, 0x28, 0xfb, 0xf1, 0x0b, 0x13, 0x01, 0x05,
+  0xed, 0xf1, 0x19, 0xc3, 0xf9, 0x02, 0xdb, 0x12, 0x27, 0x1f, 0x2c, 0x3c,
+  0x20, 0x10, 0xbe, 0xcc, 0xef, 0x59, 0xe7, 0xc5, 0x1d, 0x41, 0xd5, 0xd6,
+  0x18, 0xbe, 0xd1, 0xb9, 0x23, 0x47, 0x39, 0xe3, 0x4a, 0xd5, 0xf9, 0x12,
+  0x31, 0x1f, 0x3a, 0x8a, 0x1e, 0x23, 0x2a, 0xfd, 0x09, 0x06, 0xc3, 0xcc,
+  0xea, 0xe4, 0xef, 0xda, 0x15, 0x1f, 0xee, 0xf8, 0x35, 0xc2, 0xe3, 0x1a,
+  0xfc, 0x57, 0x41, 0xe6, 0xfd, 0xe2, 0xc6, 0x26, 0x1b, 0x22, 0x2d, 0xa6,
+  0x2a, 0x16, 0x31, 0xcd, 0x1e, 0xf7, 0xbc, 0xee, 0xe1, 0x06, 0x16, 0xf6,
+  0x23, 0x2f, 0xd7, 0xd4, 0x0d, 0xe5, 0xd9, 0x2c, 0xd8, 0x5d, 0x06, 0x12,
+  0xc5, 0xe2, 0xbd, 0x07, 0x20, 0xef, 0x39, 0xa9, 0x23, 0x01, 0x49, 0x0c,
+  0xfa, 0x24, 0xd2, 0xea, 0xd5, 0xfe, 0xc9, 0xfa, 0xfc, 0x0a, 0xc5, 0xe2,
+  0x17, 0xe4, 0xd0, 0xed, 0xdf, 0xad, 0xbc, 0x18, 0x21, 0xc9, 0x7f, 0xfd,
+  0x09, 0x20, 0xf5, 0xab, 0xc9, 0x06, 0x26, 0xeb, 0xe8, 0x0b, 0xbf, 0xd9,
+  0xca, 0xcc, 0xbf, 0xda, 0xd3, 0xfa, 0xd7, 0x2d, 0x27, 0xb8, 0xb5, 0x0c,
+  0xdc, 0xef, 0xeb, 0xdb, 0xed, 0xeb, 0x2d, 0x05, 0xfe, 0x21, 0xd5, 0xa8,
+  0xbf, 0xe6, 0xe4, 0xe6, 0x0c, 0xa8, 0xe7, 0x07, 0x16, 0xeb, 0x13, 0xc9,
+  0xf3, 0x0a, 0xdc, 0xd2, 0xb5, 0x2d, 0xdc, 0x2b, 0xcd, 0x50, 0x07, 0xce,
+  0xb8, 0xe5, 0xc9, 0xe7, 0x20, 0xed, 0xfa, 0xda, 0xf8, 0xf3, 0xaf, 0xf7,
+  0xe1, 0x5a, 0xe0, 0x0d, 0xd3, 0x0a, 0xe7, 0x02, 0xda, 0xcc, 0xfe, 0xc8,
+  0x1e, 0x04, 0xdd, 0x18, 0xff, 0xb7, 0xaf, 0xf3, 0x12, 0x08, 0x53, 0xdd,
+  0xd6, 0x3e, 0xf9, 0xb7, 0xc7, 0xcd, 0xc3, 0xe3, 0xcf, 0x1c, 0xcd, 0x0d,
+  0xdb, 0xf9, 0xeb, 0xfa, 0xab, 0xe2, 0xe6, 0x19, 0x0a, 0xde, 0xd4, 0x0e,
+  0x11, 0xd8, 0xdb, 0x0b, 0x1b, 0xe6, 0x3f, 0xdd, 0xf5, 0x25, 0xcf, 0xd3,
+  0x8a, 0xcd, 0xb1, 0xde, 0xcd, 0xbc, 0xe5, 0x1b, 0x16, 0x1c, 0x16, 0xaa,
+  0xf8, 0xff, 0xf8, 0xb1, 0xc2, 0x18, 0xfd, 0xde, 0xd3, 0x21, 0x04, 0xb5,
+  0xe7, 0x04, 0xc6, 0xe9, 0x10, 0x10, 0x15, 0x02, 0x52, 0x27, 0x03, 0x3c,
+  0xda, 0xfc, 0x01, 0xbd, 0x03, 0x67, 0x19, 0x11, 0xc4, 0x39, 0xbe, 0xc2,
+  0x11, 0x30, 0x29, 0x19, 0xa4, 0x43, 0x47, 0xd5, 0x28, 0xdb, 0xce, 0x40,
+  0x3d, 0x48, 0xe5, 0x68, 0x54, 0x58, 0x13, 0x30, 0x42, 0xec, 0x97, 0x91,
+  0xc8, 0x26, 0x4a, 0xf4, 0xf9, 0x02, 0xfc, 0x98, 0x13, 0x20, 0xfc, 0x54,
+  0xb6, 0x36, 0x29, 0xcc, 0x21, 0xfd, 0xb9, 0x31, 0x23, 0x0d, 0xde, 0x1a,
+  0xdc, 0x04, 0x1e, 0x1e, 0xe9, 0x02, 0xf1, 0xdc, 0xca, 0x1a, 0x3e, 0xc6,
+  0x10, 0x10, 0x46, 0x08, 0xef, 0x03, 0xdd, 0x6c, 0xf6, 0xfe, 0xb9, 0xfd,
+  0x0f, 0x2e, 0xe1, 0xfe, 0xf4, 0xeb, 0x40, 0xa1, 0x3e, 0x23, 0xf8, 0x40,
+  0xd7, 0x1b, 0x30, 0xfb, 0x22, 0x27, 0xd0, 0x7f, 0xdc, 0xfb, 0xc9, 0x2d,
+  0x22, 0x15, 0x25, 0xda, 0x0f, 0xe9, 0xfb, 0xe0, 0x1d, 0xd9, 0x35, 0x44,
+  0x15, 0x70, 0x11, 0x66, 0x45, 0x5c, 0x15, 0x47, 0x36, 0xe0, 0xbc, 0x8a,
+  0x13, 0x29, 0xee, 0x5b, 0x0e, 0x24, 0xc9, 0xfa, 0x0c, 0x5b, 0xb5, 0xfd,
+  0x01, 0xf5, 0x20, 0xed, 0x22, 0xd4, 0xfc, 0x42, 0x23, 0x14, 0xd1, 0x60,
+  0xd5, 0x12, 0x05, 0x00, 0x28, 0x25, 0xf1, 0xef, 0x27, 0x00, 0xfb, 0x0e,
+  0x0c, 0xe4, 0x3d, 0x31, 0xff, 0x3b, 0xe1, 0x48, 0x34, 0xd9, 0x01, 0x40,
+  0x06, 0x3a, 0xf4, 0x02, 0xf9, 0x0d, 0x1f, 0x19, 0x44, 0xf7, 0xdb, 0x2f,
+  0xeb, 0x1b, 0xf6, 0x0b, 0xfd, 0x8e, 0xdc, 0x60, 0xe9, 0xc1, 0xd2, 0xf8,
+  0xee, 0xc1, 0xee, 0xf7, 0x07, 0xef, 0xd2, 0xd9, 0x05, 0x04, 0x21, 0x0c,
+  0xdf, 0x31, 0xe4, 0x47, 0x7b, 0x23, 0x02, 0x2d, 0xf2, 0xe6, 0xef, 0xc4,
+  0xed, 0xf4, 0x05, 0xdc, 0x23, 0x14, 0xbc, 0x44, 0x23, 0xd7, 0xe9, 0xe0,
+  0x26, 0x2f, 0xf4, 0x30, 0x01, 0x00, 0xce, 0x1b, 0xf2, 0x03, 0xe0, 0x16,
+  0x17, 0xf2, 0x03, 0xd3, 0xea, 0x05, 0xf1, 0xf2, 0xfd, 0xed, 0xef, 0xa9,
+  0x14, 0xd8, 0x33, 0x22, 0xfb, 0xc9, 0xca, 0x00, 0x33, 0xe6, 0xdd, 0x24,
+  0x05, 0x0a, 0xcc, 0xee, 0xda, 0xd4, 0x08, 0x02, 0xe2, 0xf4, 0xf4, 0xd9,
+  0x0e, 0x04, 0x00, 0xf0, 0xf4, 0xf3, 0x00, 0xf2, 0x08, 0xd8, 0x06, 0x08,
+  0xd7, 0xe7, 0xe7, 0xe6, 0xd9, 0xde, 0xff, 0x06, 0x25, 0x0f, 0xe7, 0xf9,
+  0xd5, 0x30, 0x08, 0x26, 0xe0, 0xce, 0xd1, 0xd8, 0x1d, 0xdf, 0xfc, 0x1f,
+  0xcf, 0xe6, 0xfe, 0xf5, 0xfc, 0xe7, 0x2d, 0x37, 0xbb, 0xfe, 0xf5, 0xf3,
+  0xdb, 0xf6, 0xf2, 0xef, 0x3c, 0x11, 0x14, 0xcf, 0xce, 0x41, 0x22, 0xea,
+  0x05, 0xe5, 0xff, 0xf2, 0xd4, 0x02, 0xfe, 0x10, 0xef, 0xbd, 0xf1, 0xef,
+  0xdb, 0xf1, 0x0e, 0xe7, 0xe0, 0x02, 0xc9, 0xe7, 0xe3, 0xe7, 0xed, 0xf1,
+  0x1f, 0xfc, 0xd3, 0xfd, 0xcf, 0xf8, 0x28, 0x07, 0x8e, 0xb2, 0xd1, 0x39,
+  0x18, 0xfc, 0xfa, 0x1c, 0x32, 0xd9, 0x16, 0xd6, 0xd4, 0xbd, 0x16, 0xd0,
+  0xce, 0x45, 0xda, 0x55, 0xfd, 0x16, 0x3e, 0xec, 0xe2, 0x01, 0x15, 0x85,
+  0x31, 0xdf, 0xfc, 0xf9, 0xd7, 0x83, 0xed, 0x1b, 0xe3, 0x02, 0x2d, 0x1d,
+  0x1c, 0x24, 0x2f, 0x33, 0xdd, 0xc6, 0x4f, 0x2d, 0xe2, 0x39, 0x0a, 0x04,
+  0x48, 0x17, 0x13, 0x0d, 0xbd, 0x19, 0x55, 0x81, 0xf5, 0x12, 0xf0, 0xa8,
+  0x28, 0xbd, 0xff, 0xf2, 0xaa, 0x45, 0x49, 0xe9, 0xf7, 0x0a, 0xe1, 0x28,
+  0xe3, 0xd3, 0xf3, 0xdf, 0x2d, 0x0c, 0xf9, 0xae, 0x2e, 0xde, 0xee, 0x11,
+  0xc8, 0xf9, 0x55, 0xe5, 0xe9, 0xf4, 0xe8, 0xef, 0x15, 0x28, 0xf0, 0x1b,
+  0xdf, 0x08, 0xf9, 0xd5, 0x20, 0x44, 0x0e, 0xcc, 0x3b, 0x09, 0xee, 0xd7,
+  0x25, 0x21, 0xe0, 0x25, 0x14, 0x15, 0xe3, 0x24, 0x21, 0x04, 0xb7, 0x2d,
+  0x2b, 0x31, 0xe6, 0xfe, 0x40, 0x3a, 0x36, 0x21, 0x11, 0x0f, 0x16, 0xf9,
+  0xef, 0xdd, 0x42, 0xd7, 0x21, 0x17, 0x1a, 0xe1, 0x36, 0xa4, 0xf0, 0x34,
+  0x1f, 0x08, 0xcd, 0x35, 0x2f, 0x15, 0xe1, 0x38, 0x29, 0x1e, 0xc7, 0xe4,
+  0x4f, 0x31, 0x1e, 0x08, 0x2f, 0x12, 0x0d, 0xea, 0xf8, 0x06, 0x1a, 0xea,
+  0x35, 0x0e, 0xc9, 0xc2, 0x3a, 0xea, 0xf1, 0x1a, 0x1a, 0xf7, 0x3a, 0xfd,
+  0x41, 0xf3, 0xed, 0x19, 0x28, 0xd5, 0xf4, 0xe1, 0xe0, 0xe9, 0x01, 0xdf,
+  0x2a, 0xb6, 0xbe, 0xfb, 0x46, 0x47, 0x05, 0xd5, 0xdf, 0xff, 0xd6, 0x0e,
+  0x04, 0xf2, 0xbe, 0x64, 0xf3, 0xe6, 0xc2, 0xde, 0x94, 0xa7, 0xd6, 0xc5,
+  0x0b, 0x62, 0x04, 0x04, 0xdf, 0xed, 0xb2, 0xcd, 0xb1, 0x1e, 0xb1, 0x02,
+  0xf2, 0xf4, 0xc6, 0xea, 0x1e, 0x0c, 0xe6, 0x2b, 0xfb, 0xf2, 0xa4, 0xf3,
+  0xc1, 0x12, 0x01, 0xc2, 0xaf, 0x86, 0xb9, 0xd2, 0xef, 0x72, 0xd8, 0x43,
+  0xba, 0xd2, 0xf0, 0xd2, 0xdb, 0x43, 0x12, 0x26, 0xc8, 0x26, 0xfa, 0x4c,
+  0x17, 0xf0, 0x0e, 0xe9, 0x44, 0x24, 0xf2, 0xca, 0x15, 0xd7, 0x01, 0x0f,
+  0x82, 0xe7, 0xfa, 0x02, 0x2a, 0x0f, 0xfd, 0xea, 0x09, 0x07, 0x57, 0xf8,
+  0x5e, 0xbf, 0xcc, 0xc5, 0x3e, 0xd4, 0xba, 0x0e, 0x08, 0x36, 0xa6, 0x9e,
+  0x05, 0x1a, 0xe6, 0x3e, 0xd7, 0xd4, 0xdd, 0x3e, 0xa1, 0xc7, 0x08, 0xf5,
+  0x0e, 0x43, 0x0f, 0x4d, 0x0f, 0x0b, 0xfd, 0x19, 0x57, 0x19, 0xcb, 0xc2,
+  0xfb, 0x0c, 0xb7, 0x55, 0x19, 0x2f, 0x81, 0x09, 0x57, 0xd5, 0xb2, 0xda,
+  0xa8, 0xd3, 0xe1, 0x3f, 0xdc, 0xc7, 0xf6, 0x01, 0x4a, 0x57, 0xc5, 0x49,
+  0xe8, 0x0f, 0x0c, 0xf6, 0xf5, 0x2a, 0xff, 0xcf, 0x19, 0x1a, 0x2b, 0x1f,
+  0x30, 0x2a, 0xd3, 0xda, 0x55, 0xeb, 0xce, 0xe2, 0x35, 0xcb, 0xfc, 0x41,
+  0xb6, 0x01, 0x26, 0x10, 0x19, 0xb2, 0xc9, 0xe7, 0xdb, 0xf1, 0x35, 0xf2,
+  0x1f, 0x2a, 0xef, 0xfe, 0xf6, 0xe4, 0xd5, 0x00, 0xf6, 0xe5, 0xf6, 0xbf,
+  0x19, 0x07, 0x15, 0xdb, 0x07, 0xae, 0xb4, 0x32, 0xd9, 0x02, 0x32, 0xdc,
+  0x01, 0x54, 0x12, 0x37, 0x0f, 0xd4, 0x19, 0xf1, 0x43, 0x1f, 0xf4, 0xe5,
+  0xe9, 0xea, 0x1e, 0xfd, 0x30, 0xe9, 0x03, 0x05, 0x2f, 0xc6, 0xed, 0xd7,
+  0xec, 0x17, 0xf1, 0x40, 0x89, 0x07, 0xd5, 0xd4, 0x33, 0x2f, 0xf6, 0x4a,
+  0x1f, 0xc7, 0xf2, 0xe4, 0xf5, 0x07, 0xfe, 0x03, 0x30, 0x06, 0x36, 0x06,
+  0x31, 0x1d, 0x0a, 0xf5, 0xfd, 0xd2, 0xc7, 0x27, 0x39, 0xfb, 0x1d, 0x31,
+  0xa9, 0x07, 0xcd, 0xe9, 0x14, 0xd3, 0xb0, 0x21, 0x15, 0xf8, 0xea, 0x06,
+  0xee, 0xe3, 0x08, 0xf9, 0x09, 0x09, 0x01, 0x18, 0xed, 0x09, 0xf8, 0xdf,
+  0x00, 0x13, 0xf3, 0xfe, 0xfc, 0x18, 0x09, 0x0e, 0x12, 0x08, 0xfd, 0xff,
+  0x17, 0xe0, 0xd2, 0x29, 0x12, 0x2b, 0xf0, 0x0c, 0xeb, 0x0d, 0x0a, 0xf7,
+  0xd8, 0x01, 0xff, 0x08, 0x23, 0x1d, 0xe1, 0xfa, 0x1f, 0x05, 0x07, 0x13,
+  0x23, 0xf7, 0x13, 0xfd, 0x0a, 0x18, 0xd2, 0x2c, 0x3b, 0xf4, 0x03, 0xd1,
+  0x22, 0x0f, 0x0f, 0x07, 0xfc, 0x04, 0x19, 0x1e, 0xf7, 0x13, 0xfd, 0xc9,
+  0x09, 0x07, 0xf6, 0x1d, 0x01, 0x0f, 0x1c, 0x12, 0x05, 0x07, 0x14, 0x09,
+  0xdf, 0x01, 0xed, 0xfc, 0x1f, 0x15, 0x03, 0xfd, 0xfc, 0x0b, 0x09, 0xf7,
+  0xeb, 0xf7, 0xfb, 0x00, 0xd6, 0x12, 0xf2, 0x3a, 0x12, 0xf9, 0x08, 0xfe,
+  0x2a, 0x13, 0x0c, 0xe1, 0xf4, 0xfe, 0x03, 0x08, 0xf0, 0x07, 0xf2, 0x00,
+  0xee, 0xf9, 0xfa, 0xf4, 0xc5, 0xe3, 0xf0, 0x0a, 0xfb, 0x1b, 0xdf, 0x0c,
+  0xeb, 0x18, 0x36, 0x16, 0xff, 0x04, 0x07, 0x20, 0x16, 0x06, 0xf7, 0xf9,
+  0x10, 0x24, 0xfa, 0x17, 0x18, 0x09, 0xe3, 0xe6, 0xfe, 0x10, 0x13, 0xe4,
+  0xec, 0xee, 0xf2, 0x0c, 0x0d, 0xf6, 0x0d, 0x00, 0xf9, 0x09, 0x2c, 0xf0,
+  0xf9, 0x08, 0x02, 0x0e, 0xfd, 0x23, 0x14, 0x02, 0xe9, 0x07, 0x16, 0x1f,
+  0xfe, 0xfc, 0xcc, 0x01, 0xe6, 0xf6, 0xde, 0x06, 0xd3, 0xdf, 0x0e, 0xd9,
+  0x12, 0xcd, 0x0c, 0x03, 0xfc, 0xf9, 0x0c, 0xee, 0xd0, 0xe1, 0x11, 0xf7,
+  0xbc, 0x04, 0x01, 0xe5, 0xe6, 0x25, 0x1b, 0xe4, 0xe7, 0x02, 0xf0, 0xd1,
+  0xd2, 0x17, 0x08, 0xe9, 0xe8, 0x9a, 0xea, 0xe7, 0x1e, 0xf4, 0xf5, 0x2b,
+  0x23, 0xf6, 0xf0, 0x19, 0xae, 0xb3, 0x2c, 0x0b, 0xb3, 0xf4, 0x23, 0xe3,
+  0x02, 0x42, 0xf8, 0xe9, 0x10, 0xfa, 0x76, 0x81, 0xa4, 0x3b, 0xdb, 0x47,
+  0xdd, 0xb1, 0xf7, 0xe4, 0xe3, 0xf1, 0xd7, 0xef, 0x32, 0xf8, 0xe6, 0x40,
+  0xb2, 0xd3, 0x02, 0x1c, 0xd6, 0xef, 0xf8, 0xda, 0xfe, 0xf9, 0xf5, 0x05,
+  0x1e, 0xe4, 0x08, 0xe2, 0xb8, 0xd5, 0xe0, 0x0d, 0x47, 0xf9, 0xe6, 0x23,
+  0x01, 0x0b, 0x16, 0x15, 0x0c, 0x33, 0xda, 0xd8, 0xeb, 0xe2, 0xf0, 0xf8,
+  0xeb, 0xd2, 0x1f, 0xf1, 0xf1, 0xed, 0x0e, 0x04, 0x0b, 0xe3, 0x3b, 0xf9,
+  0xfd, 0x23, 0x06, 0x2b, 0x38, 0xea, 0x23, 0x11, 0xfa, 0xf1, 0xe0, 0xd4,
+  0xf5, 0x40, 0xf4, 0xc9, 0xf1, 0xea, 0xe7, 0xf9, 0xd6, 0xf6, 0xeb, 0xd1,
+  0xe4, 0x0a, 0x1e, 0x0e, 0xfe, 0xd1, 0x2d, 0xe2, 0xf9, 0x26, 0xe8, 0x14,
+  0xfc, 0xe1, 0x42, 0x03, 0xf7, 0xd8, 0xe1, 0xcc, 0xf5, 0x4f, 0xf3, 0xda,
+  0xf9, 0xf1, 0xab, 0xc7, 0xb6, 0x20, 0x16, 0xca, 0xd0, 0x19, 0x24, 0xdd,
+  0x0d, 0xb4, 0xec, 0xee, 0x00, 0x1c, 0xe1, 0x1c, 0x47, 0xd4, 0x0c, 0x08,
+  0x08, 0xee, 0x1b, 0x01, 0xc0, 0x33, 0x3c, 0xd4, 0xcd, 0xe2, 0xe9, 0x20,
+  0xc2, 0xd8, 0x09, 0xee, 0x04, 0x21, 0x23, 0x18, 0x13, 0xfb, 0x2f, 0xcd,
+  0x17, 0x14, 0xe7, 0x34, 0xd5, 0xba, 0xda, 0x12, 0x06, 0x06, 0xe5, 0xf9,
+  0x0a, 0x47, 0x4a, 0xaf, 0xdd, 0xd3, 0xf6, 0x15, 0xaa, 0x05, 0xd0, 0x1a,
+  0xc6, 0x29, 0x35, 0x08, 0xf8, 0xd7, 0xfe, 0xb9, 0x26, 0x1f, 0xd9, 0x25,
+  0xa8, 0xc5, 0xea, 0x01, 0x12, 0x0a, 0x0a, 0x29, 0x36, 0x3d, 0x3f, 0xbe,
+  0xe2, 0xe0, 0xe8, 0x0f, 0xa3, 0x2b, 0xfe, 0x0a, 0xd9, 0x52, 0x39, 0xd5,
+  0xf4, 0x04, 0xdb, 0xd5, 0x20, 0x22, 0x1e, 0xdf, 0xa2, 0xd8, 0x28, 0xee,
+  0x07, 0x39, 0x1f, 0x49, 0xed, 0xf8, 0x34, 0xfd, 0xe8, 0xe2, 0x1d, 0x7f,
+  0xed, 0xb7, 0x03, 0x12, 0xfb, 0xd9, 0xf9, 0x18, 0xbd, 0xfa, 0x18, 0xc7,
+  0x18, 0xd4, 0xe7, 0xe5, 0xab, 0xdb, 0xcb, 0xe2, 0xbb, 0x37, 0x23, 0x27,
+  0x1c, 0xf6, 0x25, 0xf5, 0xec, 0xe8, 0x27, 0x63, 0xfc, 0xec, 0xee, 0x06,
+  0x16, 0x02, 0x27, 0xf8, 0xaa, 0x14, 0xf4, 0xea, 0x16, 0xec, 0x03, 0xc2,
+  0xc5, 0xf9, 0xc2, 0xeb, 0x06, 0x2c, 0x1a, 0x0a, 0x09, 0xee, 0xff, 0xf3,
+  0x02, 0xf0, 0x1d, 0x1a, 0xf9, 0xea, 0x05, 0x35, 0x0b, 0xfc, 0x21, 0xf5,
+  0xde, 0x1d, 0xe7, 0xfe, 0xf2, 0xf4, 0x00, 0xdd, 0xe5, 0xe3, 0xc6, 0x02,
+  0x46, 0xce, 0xcd, 0x34, 0x26, 0xfb, 0xe2, 0x40, 0xfb, 0xd5, 0x17, 0xbf,
+  0xd1, 0xd4, 0xe5, 0x07, 0x33, 0x1c, 0xf6, 0xa4, 0x20, 0x20, 0x00, 0xd9,
+  0x04, 0x4c, 0x0e, 0x18, 0xab, 0xfe, 0x0c, 0x06, 0xff, 0xcd, 0x0a, 0x34,
+  0x21, 0xf8, 0xfd, 0xe7, 0x3d, 0xf2, 0x18, 0xf6, 0x05, 0x1f, 0xd3, 0x3a,
+  0x3e, 0x2a, 0xf5, 0xb5, 0x1c, 0x29, 0xe0, 0x11, 0x19, 0xd1, 0x19, 0xdf,
+  0x10, 0x2a, 0x22, 0x43, 0xd4, 0x5b, 0x04, 0xd2, 0xe2, 0xe1, 0x01, 0x00,
+  0x66, 0x00, 0xc5, 0x5e, 0x3f, 0xe8, 0xef, 0xf4, 0x3c, 0x15, 0xfc, 0x0c,
+  0x10, 0xfb, 0x02, 0x21, 0xfc, 0xf8, 0x51, 0xeb, 0x37, 0xd6, 0xed, 0xf1,
+  0x6e, 0xdc, 0x2a, 0x29, 0x03, 0xfa, 0x0a, 0xfb, 0xda, 0xbb, 0x4d, 0xcf,
+  0xb5, 0x0e, 0x1d, 0xe0, 0xe6, 0xc2, 0x0d, 0xe2, 0x0c, 0x2b, 0x56, 0xc8,
+  0xe9, 0x7f, 0xf8, 0x2e, 0xfb, 0xed, 0xd3, 0x45, 0x2b, 0x01, 0x09, 0x02,
+  0x2d, 0x13, 0x10, 0x05, 0x23, 0x06, 0x32, 0xe0, 0xe4, 0x00, 0x0e, 0x04,
+  0x2f, 0x06, 0x22, 0xd6, 0x26, 0x1e, 0xfd, 0xf0, 0x1d, 0x09, 0xf1, 0x3e,
+  0x13, 0x0e, 0x12, 0x40, 0xde, 0x3e, 0xe6, 0xba, 0xd6, 0xfd, 0x21, 0x10,
+  0x1d, 0x1e, 0xba, 0x24, 0x4e, 0xc3, 0x0d, 0xe8, 0x53, 0x03, 0x1c, 0x35,
+  0xed, 0xf4, 0x00, 0x0d, 0xe9, 0xba, 0xed, 0xfc, 0xdb, 0xf1, 0xc5, 0xea,
+  0x14, 0x0e, 0x26, 0x25, 0x16, 0xe1, 0x07, 0xf4, 0xcb, 0xff, 0x2c, 0xf5,
+  0x01, 0xc3, 0x0f, 0x0c, 0xe8, 0x1b, 0x25, 0x16, 0x22, 0x05, 0xf7, 0xe6,
+  0x03, 0x0c, 0xf0, 0xfc, 0x07, 0xf1, 0xcb, 0x41, 0xed, 0x05, 0x18, 0x04,
+  0x17, 0x06, 0x1b, 0xcd, 0xec, 0x0e, 0xf7, 0xe1, 0xfe, 0xd2, 0x23, 0x17,
+  0xf0, 0x29, 0x3d, 0x14, 0x01, 0xea, 0xfd, 0xee, 0x1f, 0x2f, 0xe2, 0x28,
+  0x1a, 0xf9, 0xfb, 0x24, 0xbf, 0x16, 0xf6, 0xd1, 0xea, 0x4c, 0x3a, 0x10,
+  0x06, 0x18, 0xd6, 0x3b, 0xf2, 0xc5, 0x32, 0x0b, 0x21, 0x03, 0x3b, 0x1c,
+  0x2c, 0xd1, 0xfc, 0xff, 0xfd, 0xf9, 0xe6, 0x08, 0x16, 0x0e, 0xf1, 0xcf,
+  0xfa, 0x1f, 0xcc, 0xe7, 0xfa, 0x06, 0xc8, 0xde, 0x21, 0x1c, 0xea, 0xca,
+  0x0c, 0xd5, 0x07, 0x24, 0xff, 0xeb, 0xbd, 0xe5, 0xf9, 0x16, 0xe1, 0x00,
+  0xfa, 0x28, 0x33, 0xe4, 0x22, 0x17, 0xfd, 0x1b, 0x09, 0xfe, 0xfe, 0x29,
+  0x06, 0x04, 0xd9, 0xc5, 0x46, 0x24, 0xf6, 0xd1, 0x08, 0x20, 0x20, 0x03,
+  0x1b, 0xf1, 0xc7, 0xe0, 0x0f, 0x17, 0x1f, 0x0c, 0x12, 0x2c, 0x51, 0x00,
+  0x33, 0x0f, 0x00, 0xf4, 0xfc, 0xfe, 0x16, 0x13, 0x05, 0xff, 0xd8, 0xf5,
+  0x21, 0x20, 0xe3, 0x09, 0x17, 0xfc, 0xfa, 0xc1, 0xfc, 0xe4, 0x17, 0xef,
+  0xfc, 0x01, 0xfb, 0x0c, 0xed, 0x2d, 0x1e, 0xed, 0x0b, 0x10, 0xf8, 0x0b,
+  0xcf, 0x00, 0xd9, 0xe2, 0x02, 0x19, 0xdd, 0x06, 0x30, 0x2c, 0xcd, 0xda,
+  0xfc, 0xec, 0xde, 0x1d, 0x02, 0x2c, 0x07, 0xb8, 0x04, 0xd7, 0xb9, 0x08,
+  0x28, 0x35, 0xf5, 0x05, 0xfb, 0x0f, 0x07, 0x2d, 0xfd, 0xfd, 0xf9, 0x17,
+  0x0e, 0x0c, 0x0b, 0x0d, 0x38, 0x21, 0xfa, 0xcd, 0xfe, 0x44, 0x26, 0xff,
+  0xff, 0xdb, 0xe3, 0xd6, 0x04, 0xef, 0x0d, 0x04, 0x22, 0x33, 0xea, 0x1b,
+  0x16, 0x01, 0x02, 0x14, 0xf6, 0xe7, 0x26, 0x01, 0x1d, 0xf4, 0xf0, 0x1e,
+  0x0b, 0x0e, 0x12, 0xf8, 0x0d, 0xdb, 0xfc, 0xae, 0xec, 0x05, 0xf9, 0xb4,
+  0xf7, 0xfc, 0xdf, 0x14, 0x0c, 0x3d, 0xfb, 0x1f, 0xd9, 0x09, 0xdd, 0x09,
+  0xb9, 0xd8, 0xe7, 0xe3, 0x07, 0xf3, 0xed, 0x4a, 0x4d, 0x2c, 0xf3, 0x27,
+  0x00, 0x1f, 0xd1, 0x32, 0xe7, 0xfa, 0xf2, 0xab, 0x0c, 0x02, 0xee, 0x0a,
+  0x23, 0xf2, 0x08, 0x3c, 0xbf, 0x0d, 0xed, 0x23, 0xfb, 0xe2, 0xdb, 0x0a,
+  0x29, 0xf9, 0xfb, 0x65, 0x35, 0x2d, 0x1b, 0xe4, 0xea, 0x57, 0x17, 0xf6,
+  0xf9, 0xda, 0xb9, 0xa9, 0x35, 0x17, 0x57, 0x02, 0xf7, 0x21, 0xee, 0x56,
+  0xe8, 0x0a, 0xf1, 0x26, 0xef, 0xe5, 0x07, 0xf6, 0x1b, 0xe3, 0xd9, 0x65,
+  0x01, 0x10, 0x18, 0xdd, 0xf8, 0x03, 0x23, 0xc5, 0x05, 0xd6, 0xcf, 0x9c,
+  0x1f, 0x2e, 0x2e, 0x0f, 0xe8, 0x28, 0xea, 0x7f, 0xba, 0x0d, 0xe1, 0x1a,
+  0x79, 0xde, 0xde, 0xe7, 0x1c, 0x15, 0x2a, 0xf5, 0x04, 0xe7, 0x36, 0xf0,
+  0xd1, 0x1a, 0x1d, 0xfc, 0xb7, 0x13, 0x09, 0xca, 0x01, 0x08, 0xc2, 0x0c,
+  0xfa, 0xed, 0xec, 0xf9, 0xc6, 0xf2, 0xca, 0x3d, 0x39, 0xb9, 0xfd, 0x01,
+  0x02, 0x0c, 0x14, 0xd4, 0xf1, 0xc9, 0x18, 0x07, 0x81, 0x20, 0xf9, 0x06,
+  0x89, 0x28, 0x0f, 0xbb, 0x04, 0x04, 0x0c, 0xc4, 0x05, 0xfc, 0xe9, 0x06,
+  0xc0, 0xc0, 0xa9, 0x15, 0x35, 0x9c, 0xe0, 0x06, 0x13, 0x00, 0x07, 0xcd,
+  0xe8, 0xdd, 0x1a, 0xd8, 0x8e, 0x22, 0xd5, 0x48, 0xbb, 0x0d, 0x20, 0xcd,
+  0xe3, 0xe3, 0xdd, 0xd1, 0x0e, 0xcf, 0x04, 0x0f, 0xc3, 0xe1, 0xd8, 0x17,
+  0x64, 0xc5, 0xc9, 0xf3, 0x1e, 0x07, 0x20, 0xe5, 0xe4, 0xaf, 0x24, 0xb2,
+  0x94, 0x32, 0xf4, 0x16, 0xb4, 0x1c, 0x61, 0x9c, 0xeb, 0xca, 0xb3, 0xe4,
+  0xfd, 0xf8, 0x00, 0x08, 0xb8, 0xe6, 0xb4, 0x10, 0x2c, 0xc2, 0xda, 0xe8,
+  0x25, 0x1c, 0x12, 0xfc, 0xe7, 0x9f, 0x1e, 0x05, 0xae, 0x4a, 0xd9, 0x1f,
+  0xa5, 0x2b, 0x46, 0xaa, 0xf6, 0xe2, 0xd8, 0xda, 0x36, 0xfe, 0xf4, 0x04,
+  0xc7, 0xf2, 0xcf, 0x0b, 0x0c, 0xbc, 0xed, 0x24, 0x1b, 0xf2, 0x2b, 0xfd,
+  0xf8, 0xf0, 0xf3, 0x0f, 0xd4, 0x6d, 0xd8, 0x28, 0xd1, 0x29, 0x5f, 0xdb,
+  0xf0, 0xe8, 0xd0, 0xf2, 0x32, 0x00, 0xf2, 0xfd, 0xe0, 0xe9, 0xdf, 0x19,
+  0x0d, 0xcb, 0xd2, 0xe9, 0x20, 0xed, 0x18, 0x06, 0xe5, 0xca, 0x1c, 0xc2,
+  0xd0, 0x2c, 0xdd, 0x18, 0xb3, 0x02, 0x40, 0xaa, 0xdb, 0xe3, 0xdb, 0xea,
+  0x08, 0x0b, 0xfb, 0x16, 0x08, 0xde, 0xca, 0xfc, 0xee, 0xf9, 0xd9, 0xcf,
+  0x1f, 0x1e, 0x0a, 0xfb, 0x01, 0xd7, 0xe4, 0x03, 0xbc, 0x25, 0xdc, 0x00,
+  0xbe, 0x16, 0x1e, 0xe3, 0xdd, 0xe6, 0xd5, 0xfa, 0x2a, 0x1a, 0xdb, 0x24,
+  0xf1, 0x09, 0xdb, 0xec, 0xd7, 0x08, 0xef, 0xff, 0x24, 0x0e, 0x2b, 0xf4,
+  0x06, 0xee, 0xb6, 0xf5, 0xf3, 0x07, 0xdd, 0x02, 0xfe, 0x0f, 0x29, 0x20,
+  0xea, 0xd8, 0xb2, 0xf9, 0x23, 0x0c, 0xdc, 0xca, 0x2f, 0x10, 0xd0, 0x12,
+  0xa5, 0x00, 0xf7, 0xf1, 0x1d, 0xee, 0xea, 0x14, 0x28, 0x21, 0xde, 0xcc,
+  0x3b, 0xf3, 0xe4, 0xef, 0x03, 0xbb, 0x59, 0xd9, 0x4a, 0xe9, 0xc8, 0x0f,
+  0x19, 0xfd, 0xb7, 0x5e, 0xe9, 0x07, 0xf1, 0xf1, 0xfa, 0xf5, 0x1c, 0x13,
+  0x06, 0xe9, 0x0d, 0x2b, 0x12, 0x1a, 0x08, 0x19, 0x2e, 0x36, 0x3c, 0xea,
+  0x40, 0x0e, 0x19, 0xe2, 0x08, 0x16, 0xe6, 0xed, 0x07, 0x13, 0xcb, 0xe7,
+  0xe3, 0xcb, 0xfd, 0xbe, 0x0d, 0xff, 0x1e, 0x2c, 0x08, 0x9b, 0xf6, 0x1b,
+  0xeb, 0xe7, 0x40, 0xfc, 0xf7, 0xeb, 0x24, 0xb1, 0x3d, 0xef, 0x13, 0xfd,
+  0xe8, 0x40, 0xeb, 0xe2, 0xd2, 0x00, 0xda, 0xec, 0x11, 0x23, 0xee, 0x02,
+  0xc7, 0xfc, 0x00, 0xea, 0x06, 0x3d, 0x04, 0x08, 0x27, 0x13, 0xb9, 0xd5,
+  0x54, 0x1a, 0xc9, 0x20, 0x30, 0xde, 0x6d, 0xe6, 0x04, 0x16, 0xdb, 0x08,
+  0x31, 0x3c, 0x28, 0xee, 0xe6, 0xe9, 0xff, 0x00, 0xac, 0xe0, 0xd2, 0xf7,
+  0xfa, 0xe2, 0x30, 0xf4, 0x09, 0x21, 0x1e, 0x10, 0xe6, 0x18, 0x1b, 0x15,
+  0x22, 0x10, 0x42, 0x13, 0xdc, 0x04, 0xfd, 0xcd, 0xfe, 0x3b, 0xa1, 0xbc,
+  0xea, 0xd8, 0x1e, 0xd1, 0xc6, 0x10, 0x0a, 0x20, 0xd7, 0x81, 0x2a, 0xf9,
+  0x0f, 0xd1, 0x4a, 0xf3, 0x0f, 0xd1, 0x33, 0xe6, 0xfd, 0x19, 0x4e, 0x1e,
+  0xf2, 0x0d, 0x12, 0xe9, 0x00, 0x0d, 0xc3, 0xf2, 0xff, 0x11, 0xe3, 0x21,
+  0xea, 0x1a, 0x02, 0x08, 0x13, 0x11, 0xc4, 0x3e, 0xd6, 0xda, 0xe6, 0xed,
+  0x2f, 0xe8, 0xe4, 0x0b, 0x42, 0xc6, 0x6e, 0x02, 0xf6, 0x2e, 0xec, 0x17,
+  0xf0, 0x31, 0xf8, 0xff, 0xed, 0xf0, 0x08, 0x05, 0xea, 0x03, 0xd3, 0xfa,
+  0xee, 0x3c, 0x00, 0xe0, 0xbc, 0xf6, 0xff, 0x0f, 0x0e, 0xe5, 0xf7, 0xe8,
+  0xf1, 0xfb, 0x2b, 0xf1, 0xc4, 0xf4, 0x21, 0xf7, 0xde, 0x4c, 0xbc, 0xf7,
+  0x25, 0xfb, 0x34, 0xd4, 0x12, 0x24, 0xdd, 0x1c, 0xba, 0xe9, 0xf6, 0xb2,
+  0xfe, 0xdb, 0x19, 0xcb, 0x09, 0xa9, 0xed, 0x06, 0xd0, 0x0f, 0x24, 0xf8,
+  0xf1, 0x03, 0x00, 0x06, 0xc1, 0xd8, 0xe8, 0x02, 0xd8, 0x23, 0xea, 0x27,
+  0x11, 0x11, 0x1c, 0x00, 0x1a, 0xd6, 0x2a, 0xf5, 0x47, 0x0c, 0x08, 0xcc,
+  0x34, 0x02, 0xeb, 0xdd, 0x51, 0x0b, 0xf1, 0x16, 0xf5, 0x1e, 0xeb, 0x21,
+  0x47, 0x02, 0x02, 0xcb, 0xfa, 0x13, 0x3d, 0x0c, 0xfd, 0xfd, 0xf6, 0x3e,
+  0x54, 0xd6, 0x0a, 0x04, 0x39, 0x05, 0xfb, 0xf9, 0x13, 0xf8, 0xfa, 0xda,
+  0x52, 0x0f, 0xd2, 0x0b, 0x11, 0xfa, 0xf4, 0x19, 0x11, 0x1e, 0x0b, 0xc1,
+  0x4d, 0x15, 0x21, 0x03, 0xe3, 0x2c, 0x14, 0x0a, 0x1d, 0x0b, 0xfe, 0xd4,
+  0x2b, 0x0c, 0xe3, 0xe8, 0x18, 0xec, 0xfb, 0x0d, 0x0d, 0x02, 0xdd, 0x2c,
+  0xef, 0xf8, 0xe3, 0x12, 0xf6, 0x31, 0x10, 0xfa, 0xd8, 0x18, 0x0c, 0x27,
+  0x34, 0x09, 0x27, 0x0c, 0xf6, 0xd6, 0x13, 0xcb, 0x2b, 0xfc, 0x3a, 0xdc,
+  0x23, 0xaf, 0x05, 0xe5, 0x38, 0xd9, 0xb9, 0xfa, 0x0f, 0x29, 0x15, 0x25,
+  0x0a, 0x07, 0xc0, 0x01, 0xe6, 0x15, 0x32, 0xe0, 0x0e, 0x01, 0x03, 0x32,
+  0x2d, 0x81, 0xe6, 0xee, 0xe8, 0xe0, 0x14, 0xfa, 0x03, 0xfd, 0xe8, 0x03,
+  0x07, 0xf5, 0x93, 0xf5, 0x3f, 0x0b, 0x00, 0x26, 0x15, 0x1f, 0xb8, 0x08,
+  0x14, 0x0c, 0x16, 0x11, 0xe8, 0xf9, 0x15, 0x13, 0xff, 0x95, 0xe5, 0xe9,
+  0xfd, 0xea, 0xfe, 0xd2, 0xef, 0xd5, 0xf8, 0x13, 0xcf, 0x0c, 0xf2, 0xfb,
+  0x0f, 0x11, 0xe9, 0x0d, 0x00, 0x29, 0xf6, 0xed, 0xae, 0xfb, 0x1e, 0xc5,
+  0x14, 0xf4, 0xf3, 0x14, 0xce, 0x97, 0x14, 0xea, 0xb6, 0xda, 0x52, 0xf5,
+  0x04, 0xcf, 0x10, 0x4d, 0x1b, 0xe1, 0xbb, 0xdb, 0xdc, 0x26, 0x3b, 0x01,
+  0xcf, 0x0b, 0xd0, 0xc6, 0xe1, 0x0d, 0x29, 0xfd, 0x0d, 0x07, 0x13, 0x1a,
+  0xea, 0x9c, 0xeb, 0xf5, 0xb8, 0xe8, 0x30, 0x1b, 0xfe, 0x11, 0x06, 0x3c,
+  0xf4, 0xfc, 0xbb, 0xb8, 0x08, 0x15, 0x2e, 0x13, 0x11, 0x09, 0xb6, 0xdf,
+  0xae, 0x18, 0x25, 0x15, 0xdc, 0xfa, 0x16, 0xf7, 0xf6, 0xad, 0xe2, 0xfb,
+  0xeb, 0xd7, 0x3a, 0x03, 0xe1, 0xdb, 0x04, 0x2f, 0xd5, 0xed, 0xc7, 0xc1,
+  0x17, 0x29, 0x20, 0x0d, 0xef, 0x24, 0xcb, 0xc8, 0xb9, 0xeb, 0xb0, 0xf8,
+  0x4b, 0xd3, 0xf3, 0x3d, 0x5f, 0xe9, 0x18, 0xe9, 0xf1, 0x00, 0x44, 0x1d,
+  0xd1, 0x17, 0xfb, 0x7c, 0x19, 0xe5, 0x40, 0xf5, 0xe9, 0x40, 0xda, 0xe2,
+  0x3d, 0xf3, 0x29, 0xff, 0xd2, 0xdf, 0xeb, 0x8e, 0x07, 0x3c, 0x1e, 0x42,
+  0x27, 0xcc, 0x09, 0x36, 0xd4, 0xec, 0x5a, 0x7f, 0x08, 0x0c, 0x07, 0x0c,
+  0x75, 0xf1, 0x23, 0x02, 0xf9, 0x4c, 0xca, 0xcb, 0xc7, 0xf9, 0x06, 0xc6,
+  0x5b, 0xeb, 0xff, 0xd2, 0xad, 0x69, 0x06, 0x2b, 0xd1, 0xf0, 0xe3, 0x71,
+  0x06, 0x23, 0xfa, 0x0f, 0x4c, 0xb3, 0x02, 0xdd, 0x5c, 0xc3, 0xb8, 0x06,
+  0xe4, 0x13, 0x24, 0x05, 0xc1, 0xe7, 0x04, 0xbd, 0x01, 0x0b, 0xe8, 0x28,
+  0x30, 0xaf, 0xe8, 0x0b, 0x3b, 0xf8, 0x03, 0xbf, 0x4e, 0x32, 0xef, 0x1d,
+  0xd3, 0xf9, 0x25, 0x06, 0xb0, 0xf2, 0x29, 0xde, 0xc4, 0xea, 0x0f, 0xfb,
+  0x0b, 0xed, 0x36, 0x05, 0xf9, 0xd1, 0xee, 0x99, 0x15, 0xac, 0xd0, 0x28,
+  0xee, 0xf3, 0xb6, 0xf9, 0xc7, 0x11, 0x15, 0x68, 0xda, 0xd5, 0x35, 0xf1,
+  0xea, 0x01, 0x17, 0xbf, 0xef, 0xfa, 0x06, 0xd5, 0xec, 0xda, 0xfa, 0x08,
+  0x20, 0x09, 0xf5, 0xea, 0xdd, 0x14, 0xd4, 0xe9, 0x02, 0xfe, 0xdc, 0x1c,
+  0xce, 0x1c, 0xc9, 0xfc, 0x55, 0x94, 0x17, 0xc0, 0x0c, 0xda, 0xc6, 0xf6,
+  0xb2, 0xf1, 0xbf, 0x18, 0xe4, 0xc5, 0x36, 0x00, 0x17, 0x01, 0xfa, 0x0c,
+  0x1c, 0xec, 0xf6, 0x0e, 0xe1, 0xf4, 0xb6, 0xeb, 0xfe, 0x28, 0xc1, 0xe5,
+  0xf3, 0xc1, 0x0a, 0x8e, 0xd1, 0xcc, 0xf4, 0x23, 0xee, 0xe2, 0x1e, 0x07,
+  0xce, 0x27, 0xf1, 0xf0, 0x0b, 0xe2, 0x1b, 0xfc, 0x0c, 0xc6, 0xbc, 0xe7,
+  0xe9, 0x2f, 0xc9, 0xf8, 0xd8, 0x00, 0xd5, 0x26, 0xbd, 0xf5, 0xdc, 0xb8,
+  0xca, 0xe7, 0xe9, 0x10, 0xca, 0xc1, 0x36, 0xdb, 0xeb, 0x00, 0xc3, 0xf8,
+  0xfb, 0xf3, 0xe7, 0x46, 0x2f, 0xb8, 0xe7, 0x03, 0x36, 0x24, 0xfa, 0xe9,
+  0xd3, 0x2c, 0xe0, 0x19, 0xe8, 0x0f, 0x02, 0x1f, 0xe7, 0x02, 0xfc, 0x16,
+  0xc8, 0xe7, 0xbe, 0x07, 0xef, 0x04, 0x1b, 0xf8, 0x13, 0x0b, 0x32, 0x26,
+  0x04, 0x08, 0xf4, 0xef, 0x12, 0xe8, 0x00, 0xd0, 0x2c, 0x1f, 0x02, 0xc6,
+  0xee, 0xdc, 0xe9, 0xf2, 0xf7, 0xff, 0xdf, 0xfe, 0xfb, 0xf2, 0x13, 0x02,
+  0x08, 0xe2, 0xf0, 0xea, 0xef, 0x05, 0xbf, 0x30, 0xef, 0xe4, 0xec, 0x07,
+  0x46, 0x01, 0x12, 0xe6, 0x1a, 0x3e, 0x15, 0xf7, 0x2c, 0xfe, 0x1b, 0x26,
+  0x19, 0x3a, 0xd1, 0xfb, 0x2b, 0x05, 0xcf, 0xf1, 0x2c, 0xfa, 0xce, 0x15,
+  0x05, 0xef, 0xdd, 0xf0, 0xef, 0xf6, 0xfa, 0x10, 0x1c, 0xac, 0x06, 0x02,
+  0x0a, 0xf7, 0x09, 0xfa, 0x04, 0xf9, 0xfb, 0x11, 0xe8, 0xee, 0xd4, 0x1e,
+  0xe5, 0x16, 0x34, 0xfe, 0xd7, 0xfa, 0xd9, 0xf5, 0x37, 0x18, 0x22, 0x28,
+  0xe4, 0x21, 0x26, 0xf6, 0xdc, 0x01, 0x15, 0x14, 0x1a, 0x3b, 0x23, 0x04,
+  0x3d, 0x0c, 0xf2, 0xc1, 0x42, 0xd7, 0xc6, 0x34, 0x21, 0x0f, 0x11, 0x1b,
+  0x39, 0xde, 0x05, 0x1a, 0xfc, 0x2e, 0xf0, 0x22, 0x07, 0xe1, 0x28, 0x1f,
+  0x55, 0x14, 0xed, 0xdd, 0x28, 0x22, 0xea, 0xf7, 0x25, 0x13, 0x12, 0xe0,
+  0x11, 0x2d, 0xf4, 0xcc, 0x0b, 0x19, 0xc3, 0x27, 0x52, 0x0a, 0xde, 0x38,
+  0x14, 0x17, 0xe3, 0xe1, 0x38, 0x17, 0xe7, 0x02, 0x2e, 0xb9, 0x09, 0x11,
+  0x1c, 0x3c, 0x21, 0xf5, 0x34, 0xd0, 0x07, 0x1f, 0xfa, 0x3b, 0x08, 0x09,
+  0xbe, 0x01, 0xd2, 0x13, 0x3a, 0x09, 0xe9, 0x12, 0x12, 0xf7, 0x1d, 0xec,
+  0xb3, 0x0b, 0x32, 0xeb, 0xcc, 0xf1, 0x2b, 0x58, 0xfa, 0x06, 0xe4, 0x03,
+  0x49, 0xf7, 0x1a, 0xf3, 0x2d, 0xd4, 0xda, 0x44, 0xd0, 0x12, 0x0c, 0xf0,
+  0x08, 0xfb, 0xf3, 0x22, 0x07, 0xed, 0x2a, 0x0e, 0x12, 0xee, 0x33, 0x0d,
+  0x05, 0xdc, 0x19, 0xf2, 0x01, 0x01, 0x07, 0xf2, 0x25, 0x02, 0x10, 0xe3,
+  0x1a, 0xea, 0x1d, 0x15, 0xe4, 0x15, 0xff, 0x09, 0x4b, 0xdf, 0x32, 0x21,
+  0xee, 0x07, 0x1f, 0xf3, 0x7f, 0xed, 0xfd, 0xed, 0x0c, 0xf2, 0x39, 0xd7,
+  0x25, 0xf0, 0xf4, 0xd7, 0xe1, 0x06, 0xff, 0x35, 0xf4, 0x0f, 0x12, 0xef,
+  0x1c, 0x00, 0xd3, 0xfc, 0x3c, 0xf3, 0x12, 0xe3, 0xcc, 0xf8, 0xa0, 0x26,
+  0x20, 0xf5, 0xdb, 0x57, 0x25, 0x01, 0x5b, 0x0a, 0x00, 0xf8, 0x08, 0x23,
+  0xfc, 0x33, 0x02, 0x08, 0x58, 0x31, 0xef, 0xdc, 0xbe, 0xee, 0x1a, 0xec,
+  0x26, 0x08, 0xd4, 0xe5, 0x06, 0xd5, 0xf2, 0xdd, 0xe0, 0xea, 0xfc, 0x28,
+  0x07, 0xda, 0x26, 0x45, 0xd2, 0xe2, 0x22, 0x49, 0x26, 0x53, 0x34, 0xfa,
+  0x40, 0x26, 0xe8, 0x20, 0xd6, 0xf3, 0x2d, 0xfc, 0x03, 0xe2, 0x00, 0xf3,
+  0x1b, 0x00, 0x2b, 0xca, 0xfc, 0xe0, 0x0d, 0x11, 0xf4, 0xd8, 0x1e, 0x1e,
+  0xc5, 0xe7, 0xe9, 0x8d, 0xf0, 0x2a, 0x2a, 0xe9, 0x17, 0x1a, 0x36, 0x04,
+  0x00, 0xfa, 0xf0, 0xfe, 0xf5, 0x1b, 0x1c, 0xdd, 0xb1, 0xfd, 0xe1, 0x24,
+  0x79, 0xb0, 0xed, 0xd9, 0x15, 0x33, 0x1e, 0xca, 0xf8, 0xe9, 0x04, 0xf1,
+  0xd8, 0x30, 0xd6, 0x19, 0xe8, 0x2f, 0x3d, 0x91, 0xed, 0xa4, 0xca, 0x0e,
+  0x55, 0xea, 0xfb, 0x3b, 0x1e, 0x07, 0x12, 0xb3, 0x2a, 0x04, 0xd6, 0xa2,
+  0xf8, 0x22, 0xe5, 0x32, 0xca, 0xf6, 0xbe, 0x06, 0x64, 0xfe, 0xdb, 0xe7,
+  0x26, 0x40, 0xdb, 0x27, 0x0e, 0xa0, 0x15, 0x14, 0xcc, 0xce, 0x05, 0x17,
+  0x21, 0xf7, 0x20, 0xbc, 0x0d, 0x0b, 0xf5, 0xcb, 0xed, 0x3a, 0x00, 0x0f,
+  0xe0, 0xda, 0xf0, 0xc9, 0xf7, 0xea, 0x0d, 0x05, 0x1c, 0x06, 0xfc, 0x13,
+  0x3a, 0xe9, 0x14, 0xfb, 0xd0, 0xf8, 0x26, 0xaf, 0x21, 0x18, 0x33, 0xe4,
+  0x53, 0xcf, 0xe4, 0xa6, 0x0f, 0xd4, 0xb0, 0xc4, 0xf8, 0xfc, 0xbf, 0xf5,
+  0x13, 0x3d, 0xbd, 0x11, 0x99, 0x10, 0x29, 0xfb, 0xfe, 0xd2, 0xd9, 0x21,
+  0x1a, 0xa9, 0xca, 0x21, 0x40, 0x36, 0x5a, 0xdf, 0x00, 0xe1, 0xf9, 0x81,
+  0x18, 0x3e, 0xa8, 0x0c, 0x11, 0x02, 0x89, 0x06, 0x2e, 0xff, 0xe4, 0x0a,
+  0xf7, 0xd1, 0xe9, 0x1a, 0x25, 0xde, 0x13, 0x21, 0xd9, 0xec, 0xd5, 0x04,
+  0xf5, 0xf5, 0x1f, 0xbc, 0xee, 0x06, 0xd7, 0xb0, 0x37, 0x0d, 0xf2, 0xdd,
+  0xdb, 0xeb, 0xec, 0x03, 0x03, 0xbc, 0xee, 0xe3, 0x05, 0xcb, 0xc8, 0x07,
+  0x24, 0xd5, 0x35, 0xfd, 0xcc, 0x04, 0xd7, 0xe3, 0x45, 0xc8, 0x12, 0xe7,
+  0xb7, 0xd2, 0xef, 0x4d, 0x14, 0xd8, 0xee, 0x42, 0xda, 0xd9, 0x2b, 0x1e,
+  0xe6, 0xb7, 0x1d, 0xe2, 0xcf, 0xbe, 0x16, 0xec, 0xff, 0xf5, 0x5d, 0xda,
+  0xc0, 0x2f, 0x04, 0xef, 0x65, 0xf7, 0x50, 0x1c, 0xe1, 0x1a, 0xdf, 0xee,
+  0x03, 0xdf, 0xdd, 0x22, 0xf2, 0xfb, 0x0d, 0xe8, 0xd6, 0xcb, 0x1b, 0xbb,
+  0xe5, 0xae, 0xd4, 0x18, 0x48, 0xe4, 0x40, 0x28, 0xce, 0x1a, 0xff, 0x4f,
+  0xea, 0x54, 0x62, 0x29, 0xe2, 0x19, 0xf3, 0xe9, 0xd8, 0xf1, 0xcd, 0xfd,
+  0xe0, 0x2e, 0xf7, 0xf6, 0x2e, 0x23, 0xc1, 0xdd, 0x01, 0xae, 0xcf, 0x1e,
+  0x22, 0xfc, 0xd5, 0x42, 0x05, 0x03, 0xee, 0xaa, 0x09, 0xd0, 0x05, 0xd9,
+  0xe1, 0xc8, 0xf7, 0x26, 0x34, 0xd6, 0xbe, 0x2a, 0xd0, 0xb2, 0x52, 0xf3,
+  0xe3, 0x96, 0xfb, 0xc6, 0xee, 0xd7, 0xe2, 0xc7, 0x1b, 0xfa, 0x67, 0xa5,
+  0xe3, 0xf7, 0x0b, 0xca, 0xcd, 0xcd, 0x24, 0xf5, 0xd7, 0xf4, 0x00, 0x22,
+  0xf7, 0xc5, 0xb7, 0x21, 0xd9, 0xc1, 0x19, 0xea, 0xf1, 0xe2, 0x09, 0xf5,
+  0xcb, 0xe8, 0xe7, 0xce, 0x79, 0x01, 0x10, 0x08, 0xdc, 0xf6, 0xfd, 0x02,
+  0xed, 0x59, 0x62, 0x24, 0x19, 0x02, 0xc2, 0xea, 0x11, 0xd7, 0xbe, 0xfb,
+  0x1f, 0x13, 0xca, 0xc9, 0x49, 0x2a, 0xb4, 0x23, 0x11, 0xf1, 0xea, 0xe9,
+  0x0f, 0xee, 0x81, 0x4b, 0x3b, 0xbd, 0x0f, 0xaa, 0xd6, 0x00, 0x44, 0x1d,
+  0xfc, 0x09, 0x10, 0x13, 0xfd, 0xe2, 0xbc, 0x27, 0x0c, 0xe8, 0x2c, 0x0b,
+  0x1b, 0x11, 0xfc, 0xdd, 0xb7, 0xda, 0xdb, 0xcd, 0x33, 0xf4, 0xe6, 0x13,
+  0x0c, 0xd4, 0x35, 0xd2, 0x9f, 0x19, 0x0e, 0x2a, 0x09, 0xdb, 0x1f, 0x17,
+  0x0d, 0x2e, 0xd2, 0xbe, 0x10, 0xfe, 0xf5, 0x09, 0xf8, 0x2a, 0xfc, 0x1e,
+  0xad, 0x2c, 0x5b, 0xe9, 0xd6, 0x04, 0xbf, 0x28, 0x16, 0xfb, 0x1d, 0xc9,
+  0x18, 0x1b, 0x2c, 0x19, 0x38, 0xdb, 0x14, 0x22, 0x09, 0x06, 0x02, 0xda,
+  0x4b, 0xfe, 0xda, 0xd5, 0x07, 0x4e, 0x20, 0x4c, 0xfd, 0xdd, 0x24, 0xef,
+  0xec, 0xf3, 0x8d, 0x08, 0x22, 0xde, 0x2a, 0xc5, 0xf0, 0x03, 0xf3, 0xf9,
+  0x00, 0x0a, 0x3c, 0x1f, 0xcc, 0x2d, 0x25, 0xe0, 0x2a, 0x08, 0x10, 0x4c,
+  0xff, 0x32, 0x20, 0x7f, 0x2c, 0xce, 0x33, 0x23, 0xa1, 0x2a, 0xcc, 0xf8,
+  0x20, 0x1b, 0x6d, 0xc9, 0x22, 0xf0, 0x3e, 0xf6, 0xd3, 0x3d, 0x0c, 0xff,
+  0x1f, 0x06, 0xfc, 0x03, 0xe3, 0xe7, 0xfa, 0x07, 0x13, 0xda, 0xfd, 0xc8,
+  0x17, 0xee, 0xf8, 0x22, 0xee, 0x09, 0x2a, 0x03, 0xf4, 0x26, 0xee, 0x0b,
+  0x24, 0xff, 0x07, 0xed, 0x0e, 0xea, 0xc1, 0xc8, 0x36, 0x0b, 0xb4, 0x0b,
+  0xd9, 0xdf, 0xce, 0xab, 0x06, 0xb9, 0xaa, 0xa5, 0xe1, 0x0d, 0xbe, 0x04,
+  0x54, 0xe7, 0x05, 0x07, 0xee, 0x2f, 0xbb, 0x53, 0x8c, 0x06, 0xf4, 0xd6,
+  0xc2, 0x13, 0xfb, 0x17, 0xc7, 0x17, 0x58, 0x02, 0x2d, 0xf9, 0x1e, 0x49,
+  0x0b, 0x21, 0x2c, 0x39, 0x27, 0xeb, 0x0b, 0x4e, 0xe5, 0x31, 0xc7, 0xf3,
+  0x17, 0xcf, 0x49, 0x91, 0xfa, 0x01, 0x5d, 0x06, 0x05, 0x18, 0x04, 0xe5,
+  0x19, 0x47, 0x1d, 0x27, 0x2f, 0x1e, 0x06, 0xd1, 0xff, 0x07, 0xeb, 0xa4,
+  0x16, 0xe7, 0x19, 0x0c, 0xdf, 0x18, 0xe1, 0xf4, 0x0d, 0x00, 0xec, 0x0a,
+  0x0e, 0x04, 0x10, 0x10, 0x1f, 0x0b, 0xfa, 0xd6, 0x29, 0xfe, 0x87, 0x1b,
+  0xdd, 0xe4, 0xdb, 0xd2, 0xf6, 0xfb, 0xd1, 0xb3, 0xaa, 0xe4, 0x06, 0xc5,
+  0x44, 0xe7, 0x42, 0x08, 0xfd, 0x06, 0x8f, 0x46, 0xb4, 0xee, 0x03, 0xf2,
+  0xcb, 0x15, 0xe1, 0x0e, 0xf6, 0xe9, 0x4c, 0xcd, 0x20, 0xe8, 0x15, 0xdb,
+  0xfa, 0x16, 0x39, 0xc7, 0x1c, 0x38, 0x15, 0x20, 0x1a, 0xce, 0x29, 0xf4,
+  0x09, 0x22, 0x3c, 0xd5, 0xd8, 0x09, 0xee, 0x04, 0x1c, 0xd8, 0xc9, 0x24,
+  0x25, 0x20, 0x0a, 0x06, 0x23, 0xf0, 0x07, 0xd9, 0xd5, 0x31, 0x01, 0xda,
+  0xf3, 0x2c, 0x58, 0xee, 0x3f, 0xed, 0xab, 0x0a, 0x1f, 0xe6, 0x39, 0x21,
+  0x35, 0x10, 0xfb, 0x05, 0x2d, 0x1e, 0xe5, 0xf2, 0x3c, 0xfe, 0x92, 0x2f,
+  0xf8, 0xc7, 0x00, 0xe2, 0x0a, 0xfe, 0xdb, 0xab, 0xea, 0x06, 0xfb, 0xd6,
+  0xc1, 0xfe, 0xe9, 0x09, 0xfd, 0xf0, 0xc3, 0x28, 0x3e, 0x1a, 0xcd, 0x09,
+  0x2e, 0x36, 0x01, 0x28, 0xfd, 0x3f, 0xe1, 0xce, 0x43, 0x18, 0x33, 0xf6,
+  0x09, 0x47, 0x4a, 0x0f, 0x2a, 0xe3, 0x04, 0xe9, 0x1d, 0x30, 0x25, 0x2d,
+  0x0c, 0x23, 0x5c, 0xed, 0x60, 0x41, 0xbb, 0x08, 0x43, 0xf3, 0xe8, 0xf6,
+  0xca, 0x19, 0xb3, 0x00, 0xff, 0x3c, 0xe6, 0x21, 0xeb, 0x28, 0xd9, 0x09,
+  0x21, 0x04, 0xf9, 0xcc, 0x2d, 0x02, 0xfc, 0x36, 0x17, 0x32, 0x7f, 0x04,
+  0x29, 0x28, 0xd8, 0x03, 0x28, 0xeb, 0xed, 0x11, 0xe8, 0x38, 0xb0, 0xf7,
+  0x12, 0x14, 0xd8, 0xe4, 0xeb, 0x1e, 0x0c, 0x03, 0xde, 0xf3, 0x16, 0xeb,
+  0x1a, 0xe8, 0x11, 0x13, 0x1b, 0x0b, 0x63, 0x0a, 0x04, 0xfc, 0xf7, 0x0e,
+  0xe9, 0xf3, 0x3b, 0x1e, 0xd1, 0x3a, 0xbc, 0xe0, 0xee, 0x0c, 0xfe, 0xe4,
+  0x06, 0x00, 0x59, 0x3b, 0x48, 0xef, 0x02, 0xdf, 0xeb, 0x3f, 0x3b, 0x28,
+  0xe8, 0x16, 0x2c, 0xdf, 0xff, 0x0e, 0xbc, 0x05, 0xde, 0xff, 0x5f, 0x03,
+  0x8e, 0x13, 0x9b, 0x13, 0xd3, 0xeb, 0xf4, 0x2b, 0xec, 0x2d, 0x1f, 0x35,
+  0x15, 0xe2, 0x0c, 0x9b, 0x06, 0x41, 0x33, 0x1f, 0x1c, 0x26, 0x44, 0xe3,
+  0x16, 0x1e, 0xe6, 0x0b, 0xe8, 0xdc, 0x36, 0x1f, 0xc1, 0xfd, 0xb6, 0xe1,
+  0xf1, 0xfd, 0xe2, 0x02, 0xef, 0x2c, 0xf4, 0x03, 0xbb, 0xbe, 0x1b, 0xbb,
+  0xf0, 0x34, 0xd7, 0x15, 0x12, 0x09, 0x46, 0x9d, 0xfa, 0x16, 0xec, 0x07,
+  0xf5, 0xbd, 0x42, 0x0e, 0x97, 0x26, 0xcc, 0xd3, 0xf2, 0xf7, 0x01, 0xea,
+  0x06, 0xb6, 0x5e, 0x3f, 0x2a, 0x13, 0xfd, 0x04, 0xc6, 0x2a, 0x3f, 0x11,
+  0xe2, 0x38, 0xf9, 0x05, 0xe7, 0xf6, 0xca, 0xd9, 0xfe, 0xdf, 0x43, 0x0c,
+  0xbf, 0x2f, 0xd6, 0xeb, 0xba, 0xbb, 0x10, 0xf0, 0xeb, 0xd6, 0x2a, 0x1b,
+  0x14, 0xe2, 0x0c, 0xc2, 0xa2, 0x13, 0x22, 0xfb, 0x28, 0x31, 0x22, 0xe5,
+  0x03, 0x09, 0x0a, 0xf2, 0x24, 0xf4, 0x43, 0x0e, 0xd1, 0xe4, 0xce, 0xb0,
+  0xcb, 0xd2, 0xda, 0xc9, 0x11, 0xe0, 0xed, 0xfa, 0xe2, 0xc4, 0x43, 0xc8,
+  0xc3, 0x1d, 0xac, 0x18, 0x26, 0xf2, 0x12, 0xa9, 0xd2, 0xfa, 0xf4, 0xe3,
+  0xeb, 0xf6, 0xfc, 0xc2, 0xec, 0xa3, 0xce, 0xf8, 0xce, 0xe0, 0xca, 0xf2,
+  0xdc, 0xc6, 0xed, 0xe5, 0xc3, 0xd9, 0xb2, 0xae, 0xc8, 0xdf, 0xf4, 0xf8,
+  0xe7, 0x06, 0xdf, 0x1e, 0xd8, 0x01, 0x25, 0xf7, 0x1f, 0xca, 0x08, 0xf9,
+  0x0b, 0xc2, 0xc7, 0xca, 0xe0, 0xde, 0xf8, 0x0e, 0xf3, 0x9d, 0x20, 0xc6,
+  0x05, 0xc2, 0x90, 0xcd, 0xda, 0xfe, 0x3b, 0x1a, 0xb3, 0x23, 0xa3, 0x21,
+  0x04, 0x0e, 0x11, 0x00, 0xec, 0xd8, 0x0d, 0xbb, 0x2c, 0xba, 0xc5, 0x08,
+  0x0f, 0xfc, 0x1b, 0x7f, 0xf9, 0xdb, 0xe1, 0xc9, 0xc8, 0x0a, 0xd3, 0xdd,
+  0x14, 0x1d, 0x1a, 0x06, 0xc8, 0x3c, 0xa5, 0x4b, 0xf5, 0x06, 0xf9, 0x07,
+  0xff, 0xd6, 0xf2, 0x03, 0xd9, 0x10, 0xe9, 0xea, 0xfd, 0x2f, 0x07, 0x23,
+  0x03, 0xfa, 0x0f, 0x05, 0x08, 0x18, 0xf9, 0xd6, 0x30, 0x10, 0xe4, 0xed,
+  0x1c, 0xf2, 0x21, 0xf4, 0x2a, 0xf6, 0x3e, 0x18, 0x28, 0xce, 0xe8, 0x1c,
+  0xed, 0x0d, 0xe2, 0xe2, 0xf9, 0x25, 0x0d, 0x4b, 0x02, 0xf4, 0x3e, 0xae,
+  0x22, 0xea, 0xb9, 0x02, 0x25, 0x1f, 0x27, 0xef, 0x08, 0x07, 0xd4, 0xe2,
+  0x6b, 0xfc, 0x32, 0x04, 0x17, 0xbd, 0xf1, 0xcf, 0xff, 0xe7, 0xd4, 0x28,
+  0x23, 0x27, 0x45, 0x63, 0x12, 0x17, 0x06, 0xcf, 0xf1, 0x18, 0xef, 0xfe,
+  0x46, 0x36, 0xff, 0x0a, 0x00, 0x29, 0xda, 0x0a, 0x04, 0xff, 0xef, 0x26,
+  0xe5, 0xd3, 0x02, 0x1a, 0x06, 0xfe, 0xf5, 0xe0, 0x59, 0x0f, 0xfb, 0xf0,
+  0x08, 0x03, 0xf6, 0x2f, 0x33, 0x04, 0x20, 0xf7, 0xf8, 0x0a, 0xca, 0xfb,
+  0x14, 0xc9, 0x27, 0xbe, 0x28, 0xe7, 0xf5, 0x48, 0xe1, 0xce, 0xe1, 0x3a,
+  0x1b, 0xef, 0xc8, 0xd8, 0x2d, 0x0c, 0x19, 0x2e, 0x05, 0x0f, 0x12, 0xf4,
+  0x32, 0x00, 0xe8, 0xd5, 0xf1, 0xfa, 0x19, 0xdd, 0xe9, 0xe1, 0x06, 0xb6,
+  0x46, 0xed, 0xf0, 0x16, 0xde, 0x02, 0xe2, 0x00, 0x0b, 0xf4, 0xd2, 0x1d,
+  0x3e, 0x12, 0x40, 0x72, 0x22, 0xee, 0x11, 0x14, 0x13, 0xdd, 0xff, 0xe7,
+  0x02, 0x1e, 0xe7, 0x04, 0xfd, 0x08, 0x07, 0xb2, 0x2b, 0x1d, 0xe3, 0x0b,
+  0x4f, 0x18, 0xc9, 0xe8, 0x2b, 0xfb, 0xf7, 0xe0, 0x36, 0x03, 0xeb, 0x12,
+  0x00, 0xda, 0xe9, 0x43, 0xfa, 0xfe, 0x00, 0xee, 0x02, 0xc5, 0x04, 0x14,
+  0xca, 0x1e, 0x3f, 0x06, 0x3f, 0x04, 0xf2, 0x0b, 0x11, 0x0e, 0x00, 0x0e,
+  0x40, 0xf4, 0xf1, 0x0d, 0x0e, 0xcd, 0xf9, 0xf1, 0x00, 0xe9, 0x18, 0xc6,
+  0xee, 0x18, 0x04, 0xd2, 0x28, 0xf1, 0xfa, 0x0a, 0xf5, 0xf1, 0x01, 0x2a,
+  0x21, 0x13, 0xd5, 0xfd, 0xc9, 0xfc, 0xe8, 0x2b, 0xe5, 0xd7, 0xd6, 0x29,
+  0xf1, 0x02, 0x01, 0x0c, 0xfc, 0x14, 0x09, 0xdd, 0xe9, 0x1e, 0xe6, 0xcd,
+  0x2c, 0xef, 0x00, 0x0d, 0xfd, 0x02, 0x0e, 0x6c, 0xb4, 0x1a, 0x2f, 0xea,
+  0xdb, 0x69, 0x0b, 0xfd, 0x0e, 0xe8, 0xf4, 0x02, 0x2c, 0x12, 0xf3, 0x31,
+  0x08, 0xf7, 0xd9, 0xff, 0x5b, 0x0d, 0x08, 0x13, 0x14, 0xfd, 0x05, 0x20,
+  0xe7, 0x2e, 0x3d, 0x0d, 0xc4, 0x05, 0x53, 0xb2, 0xd2, 0x09, 0x08, 0x63,
+  0x26, 0xe3, 0x10, 0x02, 0xfa, 0xf3, 0xd9, 0x49, 0x26, 0x07, 0x2c, 0xea,
+  0x65, 0x48, 0x0a, 0x0d, 0x35, 0xfd, 0x33, 0x19, 0xdf, 0x50, 0xed, 0xe4,
+  0xcc, 0x17, 0x08, 0xcd, 0x55, 0xc1, 0xe3, 0x33, 0x21, 0xae, 0xf4, 0x01,
+  0xb7, 0xf1, 0xd1, 0x32, 0xdf, 0x17, 0x15, 0x23, 0xf4, 0x56, 0xf5, 0xfa,
+  0x2d, 0xe6, 0x0f, 0x13, 0x36, 0x49, 0xf3, 0x1a, 0x13, 0x05, 0x56, 0xfe,
+  0xfb, 0x1a, 0xde, 0xa8, 0xec, 0x04, 0x3d, 0x22, 0xd1, 0x16, 0x1c, 0x13,
+  0xdd, 0xf2, 0xe7, 0x3b, 0x3e, 0x01, 0x17, 0xe2, 0x10, 0x13, 0x06, 0x02,
+  0xfc, 0x13, 0x11, 0xee, 0xf6, 0x05, 0x7f, 0xa4, 0x36, 0x44, 0xd0, 0xd9,
+  0xc3, 0xc9, 0x0f, 0xef, 0xa0, 0xc5, 0xf7, 0x17, 0x0b, 0xdd, 0xac, 0x0d,
+  0x38, 0xf6, 0xca, 0xdc, 0xe4, 0x11, 0x02, 0x08, 0x03, 0x38, 0x9b, 0x97,
+  0x1b, 0x0c, 0x06, 0xb6, 0xff, 0x0c, 0xe2, 0xf0, 0xfd, 0x06, 0x02, 0x1b,
+  0xb9, 0xd0, 0xfd, 0xec, 0x01, 0xec, 0xd9, 0x37, 0x37, 0xdf, 0x10, 0x0c,
+  0xdd, 0xfe, 0xbe, 0xfb, 0x09, 0x24, 0xd5, 0x9f, 0x9d, 0x24, 0x01, 0xf9,
+  0x00, 0xe8, 0x2a, 0x09, 0xec, 0x2f, 0xdd, 0xcd, 0x08, 0xf4, 0x3c, 0x54,
+  0xce, 0x01, 0x0e, 0x0a, 0x1f, 0xc7, 0xec, 0x0c, 0xcd, 0x78, 0x1e, 0x3c,
+  0xbd, 0x43, 0x13, 0xea, 0xf9, 0x32, 0xf9, 0xb3, 0xeb, 0xe3, 0x31, 0x18,
+  0xd6, 0x24, 0xf4, 0xcb, 0xdb, 0xde, 0x1b, 0x01, 0xe4, 0xfa, 0x14, 0x03,
+  0xde, 0xcd, 0x07, 0xf2, 0xec, 0x4b, 0xfa, 0x51, 0xd4, 0x4f, 0xfc, 0x07,
+  0x10, 0x4e, 0xf6, 0xe2, 0xb8, 0xd0, 0x0d, 0xe2, 0xb5, 0x30, 0x0c, 0xd8,
+  0x14, 0xea, 0x16, 0x16, 0xdc, 0xb5, 0xef, 0xe4, 0xed, 0xe2, 0x3a, 0x01,
+  0xa9, 0x4d, 0xff, 0x36, 0xd6, 0x32, 0x10, 0xcb, 0x1f, 0xf3, 0xed, 0x15,
+  0xea, 0x22, 0xe5, 0x39, 0x12, 0x4b, 0x15, 0x12, 0xc7, 0xac, 0x2d, 0x67,
+  0xb7, 0x5d, 0xbc, 0xb3, 0x1f, 0x20, 0xf9, 0xe4, 0xf5, 0x5d, 0xda, 0x0e,
+  0xf7, 0x3c, 0xae, 0x05, 0x2b, 0x08, 0xa6, 0x11, 0x01, 0xef, 0xc4, 0x2f,
+  0xd5, 0x41, 0xbf, 0x25, 0x92, 0xe7, 0x37, 0x0d, 0xdc, 0x24, 0x96, 0xb2,
+  0x11, 0x0d, 0xf1, 0xca, 0x22, 0x3f, 0xfa, 0x35, 0xc7, 0x4e, 0xe1, 0x18,
+  0xe1, 0x5f, 0xee, 0xfc, 0xd6, 0xcd, 0x02, 0x07, 0xe9, 0x60, 0xdd, 0x24,
+  0xfa, 0xd6, 0x55, 0xe3, 0x09, 0xb9, 0xca, 0xe6, 0xe3, 0x34, 0xe9, 0xf1,
+  0xf0, 0x7f, 0x2a, 0x39, 0xee, 0x1c, 0x15, 0xe8, 0x29, 0x02, 0x46, 0x17,
+  0xfc, 0x30, 0x36, 0x23, 0xf6, 0x2d, 0x05, 0x2a, 0x4d, 0xf2, 0x1a, 0x41,
+  0xd9, 0x2f, 0x15, 0x95, 0xe7, 0x25, 0xb1, 0x17, 0x12, 0x2a, 0xbc, 0x1e,
+  0xec, 0x28, 0xc4, 0x1f, 0x12, 0x3d, 0x01, 0xeb, 0xd7, 0x13, 0x18, 0x2e,
+  0xc0, 0x0c, 0x34, 0x01, 0x50, 0xe8, 0x32, 0x64, 0xb2, 0x30, 0x3c, 0xe2,
+  0xbc, 0x0b, 0x15, 0x05, 0x36, 0x16, 0xc9, 0x3b, 0xde, 0x31, 0xf3, 0x54,
+  0xf7, 0x3e, 0xfb, 0xe6, 0x1a, 0xf8, 0xe6, 0xe0, 0xd0, 0x08, 0x2b, 0x0e,
+  0x34, 0xde, 0x54, 0xe5, 0xde, 0x23, 0x0d, 0x2d, 0xf1, 0x06, 0x2d, 0xe7,
+  0x1d, 0x10, 0xca, 0x22, 0x19, 0x1e, 0xd9, 0x49, 0xe9, 0xe7, 0x0c, 0x12,
+  0xb7, 0xdc, 0x25, 0xe6, 0x13, 0x28, 0x02, 0x1d, 0x00, 0xa0, 0xdc, 0xfb,
+  0xb9, 0x0f, 0xe3, 0xcd, 0xcc, 0xf7, 0x00, 0xea, 0x81, 0x1b, 0xe7, 0xef,
+  0xe6, 0xe3, 0xde, 0x55, 0xff, 0xf2, 0x0e, 0xfe, 0xe1, 0x00, 0x29, 0xd4,
+  0xed, 0x17, 0xd1, 0x15, 0x05, 0xa6, 0xf3, 0xf8, 0xf2, 0xe0, 0xdb, 0xba,
+  0xf6, 0x0e, 0xf8, 0xdf, 0x96, 0x20, 0x0c, 0x09, 0xd2, 0x0f, 0xd2, 0x37,
+  0xdb, 0x12, 0x35, 0xf4, 0xa8, 0x1e, 0x44, 0xe3, 0xfb, 0xfa, 0xf0, 0x00,
+  0x2a, 0xbe, 0xec, 0x10, 0x3b, 0x3b, 0x21, 0xf3, 0xea, 0x0c, 0xc0, 0x0d,
+  0xe8, 0x02, 0xe0, 0x0f, 0x10, 0xdb, 0xee, 0xdb, 0x02, 0xee, 0x04, 0x07,
+  0x30, 0x02, 0x09, 0x0c, 0xfd, 0xfa, 0xff, 0x29, 0xe2, 0xc6, 0x13, 0x16,
+  0xdd, 0xa0, 0xfc, 0xd7, 0xcb, 0x15, 0x24, 0xcc, 0xb8, 0x0e, 0xf0, 0x02,
+  0xe0, 0x29, 0x2a, 0x19, 0x3b, 0x0a, 0x17, 0x03, 0x69, 0x1a, 0xdf, 0xee,
+  0x15, 0x2a, 0xf5, 0xee, 0xd9, 0xd0, 0x0e, 0x2b, 0xf2, 0x81, 0xaa, 0xc2,
+  0xf9, 0x0b, 0x09, 0xf7, 0x0d, 0x17, 0xf6, 0x15, 0xc6, 0x46, 0x40, 0xd1,
+  0x27, 0x16, 0xfb, 0xe9, 0x1e, 0x22, 0xf1, 0xf3, 0xfd, 0x07, 0xf2, 0xf7,
+  0x0f, 0xed, 0xf4, 0xf3, 0x37, 0xe1, 0xc0, 0xb9, 0x0b, 0xe6, 0xdd, 0x03,
+  0xff, 0x27, 0xff, 0x11, 0xcc, 0x0d, 0xf6, 0xd8, 0xe0, 0xff, 0x4a, 0xf4,
+  0x0e, 0xfa, 0xf9, 0x00, 0x0c, 0xd3, 0xeb, 0x3a, 0x1a, 0xcb, 0x16, 0x10,
+  0xea, 0xce, 0xd6, 0xf8, 0x00, 0x06, 0x19, 0xe5, 0x03, 0xfd, 0xfd, 0x08,
+  0xab, 0xda, 0x26, 0xc3, 0xdc, 0x0d, 0x38, 0xed, 0x5c, 0x12, 0x02, 0xe0,
+  0x00, 0xed, 0xdb, 0x29, 0xeb, 0xd2, 0x21, 0x04, 0xf0, 0xb8, 0xda, 0xea,
+  0x13, 0x0a, 0x3c, 0xde, 0x30, 0xf3, 0x10, 0x00, 0xb6, 0xe0, 0x1e, 0xc1,
+  0xf3, 0x02, 0x0a, 0x12, 0x28, 0xfa, 0xf5, 0xd0, 0xf3, 0xc3, 0xe9, 0x3d,
+  0xd5, 0xee, 0x0b, 0xf6, 0x02, 0x17, 0xe4, 0xb6, 0x02, 0xe0, 0x48, 0xe1,
+  0x06, 0x0f, 0xe0, 0x05, 0xe2, 0xd5, 0xfb, 0xff, 0x67, 0x04, 0x1f, 0x1d,
+  0x0c, 0xfe, 0x2a, 0xd9, 0x0b, 0x30, 0xd7, 0xa8, 0xcf, 0xfd, 0x29, 0x63,
+  0x18, 0xff, 0x22, 0xb8, 0x0a, 0xe1, 0x29, 0x17, 0xe1, 0x30, 0x54, 0xe8,
+  0xf1, 0xf9, 0xc6, 0x08, 0x20, 0xb3, 0xf4, 0xee, 0x73, 0xea, 0x0b, 0x15,
+  0xeb, 0xc4, 0xfb, 0xdf, 0xb4, 0xe8, 0x22, 0x13, 0xd6, 0x05, 0x05, 0xfa,
+  0xea, 0x8e, 0xd4, 0x23, 0x31, 0x0b, 0xf5, 0xbc, 0xda, 0xf4, 0xc6, 0x39,
+  0xd9, 0xec, 0xbf, 0xea, 0x3d, 0xe0, 0xfe, 0xed, 0xfe, 0xda, 0x2f, 0xf6,
+  0xe4, 0xf3, 0x11, 0x41, 0xe4, 0xfa, 0xd5, 0x11, 0xd5, 0xda, 0xf6, 0x25,
+  0x26, 0x08, 0xed, 0xf9, 0x00, 0xea, 0xfc, 0xff, 0xf6, 0xeb, 0x22, 0xde,
+  0x24, 0x0a, 0xe8, 0xf9, 0x33, 0xed, 0x12, 0x11, 0xb3, 0xf6, 0x2f, 0x6c,
+  0x2e, 0xc7, 0x2e, 0x10, 0x23, 0x42, 0xef, 0xf6, 0x11, 0x1e, 0x0c, 0xf4,
+  0xe6, 0xee, 0x00, 0xd0, 0xdf, 0x0f, 0xe1, 0xea, 0x23, 0xd3, 0xef, 0x1a,
+  0x1e, 0xee, 0x19, 0xd2, 0xdf, 0x12, 0x3e, 0x55, 0x6f, 0x34, 0xff, 0x13,
+  0x19, 0x2f, 0xcb, 0xff, 0xf3, 0x03, 0xe7, 0x01, 0x60, 0x2e, 0x11, 0x9b,
+  0x08, 0xff, 0xfd, 0x07, 0xe7, 0x0c, 0x12, 0xff, 0x4c, 0x50, 0x16, 0xf5,
+  0xdb, 0xff, 0xd9, 0x00, 0x70, 0xe3, 0xe0, 0xc3, 0x15, 0x3e, 0xa4, 0x15,
+  0xe4, 0xfb, 0xe7, 0x13, 0x12, 0x08, 0xf0, 0xbf, 0xf4, 0x23, 0x18, 0x1f,
+  0xab, 0xb7, 0xcc, 0xf3, 0x35, 0xa8, 0x09, 0x1d, 0xf2, 0xf1, 0xed, 0x3b,
+  0xfc, 0xf4, 0x11, 0xf3, 0x01, 0x75, 0xef, 0xfe, 0x1d, 0xe9, 0xb4, 0x33,
+  0x33, 0xde, 0xff, 0x22, 0xe9, 0x40, 0x0e, 0x41, 0x81, 0xfc, 0xd8, 0x01,
+  0x24, 0x0a, 0x1a, 0x32, 0x1f, 0x06, 0xb6, 0xeb, 0x23, 0x58, 0x14, 0xc7,
+  0x0a, 0x53, 0xf6, 0xbf, 0xe5, 0xf7, 0xae, 0x3a, 0x4a, 0x17, 0xdd, 0xe1,
+  0x24, 0x10, 0x0e, 0x26, 0xd4, 0x30, 0xf4, 0x1e, 0x13, 0x43, 0x0a, 0xf6,
+  0x0f, 0xf4, 0xe7, 0xb6, 0x37, 0xde, 0xfc, 0xae, 0xf2, 0x21, 0xb1, 0xe4,
+  0x0d, 0xf8, 0xf6, 0x08, 0x1a, 0xda, 0xdd, 0x3c, 0x2f, 0x04, 0xee, 0x0c,
+  0xf2, 0x5a, 0xfd, 0xb0, 0xc7, 0x18, 0xd2, 0xd0, 0x0b, 0x0e, 0xe2, 0x9a,
+  0x37, 0xd6, 0x01, 0xb9, 0x66, 0x41, 0x1e, 0x15, 0xfc, 0xef, 0x17, 0xed,
+  0xf6, 0xdb, 0x34, 0xe0, 0x09, 0xdf, 0xff, 0xfc, 0x1f, 0x29, 0xee, 0xc6,
+  0x00, 0xfe, 0xbb, 0x07, 0x0d, 0x28, 0xea, 0x91, 0x04, 0xed, 0xc6, 0xf5,
+  0x10, 0x22, 0x23, 0xea, 0xdb, 0xf8, 0x1c, 0xdc, 0xf9, 0xd9, 0x14, 0xdf,
+  0x07, 0xe7, 0x09, 0x09, 0x1e, 0xe7, 0x0d, 0xf0, 0x33, 0xe4, 0xe7, 0xef,
+  0x07, 0x27, 0xf2, 0xbb, 0xc3, 0x30, 0xda, 0x0a, 0xcd, 0xf7, 0x7f, 0xe3,
+  0xcb, 0xfd, 0xe1, 0xef, 0x15, 0xf4, 0x02, 0xfe, 0x0b, 0xf9, 0xfd, 0xe1,
+  0x0e, 0x1a, 0x2c, 0xda, 0xe1, 0x28, 0xc4, 0xe9, 0xd7, 0xe0, 0xd9, 0xd4,
+  0x26, 0x0b, 0xce, 0xec, 0x17, 0x35, 0x23, 0xf4, 0xf2, 0x0d, 0x29, 0xde,
+  0x24, 0x03, 0xf3, 0xce, 0x16, 0xca, 0xe9, 0xdb, 0x1d, 0x21, 0xfd, 0xb7,
+  0x15, 0x10, 0xa1, 0x06, 0xc5, 0xb5, 0x01, 0xa2, 0x33, 0xe0, 0xc0, 0xed,
+  0xf0, 0x40, 0x27, 0xfa, 0xf0, 0x3a, 0x1b, 0xe5, 0x13, 0xe7, 0xb4, 0xb9,
+  0x0b, 0xf1, 0x1f, 0xfb, 0xe1, 0x12, 0x00, 0xd4, 0x1e, 0x0c, 0xd2, 0x16,
+  0xed, 0xf6, 0xed, 0xb8, 0x23, 0xee, 0xcf, 0x32, 0xfe, 0x2e, 0xe9, 0xdf,
+  0x0e, 0x17, 0xef, 0xfb, 0x13, 0xe2, 0xe4, 0xe1, 0x05, 0xfe, 0x19, 0xf6,
+  0xff, 0x2d, 0x05, 0xf5, 0x11, 0x14, 0xd5, 0xd0, 0xf7, 0xef, 0x02, 0x1b,
+  0x16, 0x35, 0x98, 0x2f, 0xf9, 0x25, 0x2c, 0xd9, 0x09, 0xfe, 0xfb, 0xfc,
+  0x50, 0x04, 0x01, 0x01, 0x28, 0x01, 0x0b, 0xca, 0x19, 0x18, 0x02, 0xf5,
+  0x25, 0x06, 0xb3, 0x05, 0xd9, 0xdd, 0x1d, 0xfc, 0x34, 0x1c, 0x94, 0x12,
+  0xf6, 0x0d, 0x31, 0xeb, 0x0f, 0x13, 0xf6, 0xfa, 0x11, 0xfb, 0xe1, 0xcc,
+  0x32, 0xf2, 0x18, 0x04, 0xf4, 0x3f, 0x16, 0xeb, 0x37, 0x0f, 0xc0, 0xee,
+  0xf7, 0xfb, 0xd8, 0xbd, 0x4b, 0xc6, 0xe0, 0x41, 0x0a, 0x01, 0xfc, 0x02,
+  0xe8, 0x1c, 0xb8, 0x10, 0xce, 0xf5, 0x3b, 0xca, 0xe1, 0xf3, 0x02, 0xe8,
+  0x38, 0x0f, 0x03, 0xfd, 0x1a, 0xd9, 0xf2, 0xe2, 0xd8, 0xd4, 0x2d, 0xb5,
+  0xfb, 0xe0, 0xf3, 0xfb, 0xe8, 0x1e, 0xc8, 0xe9, 0xe8, 0x17, 0x1f, 0xff,
+  0xd1, 0x28, 0xd0, 0xb5, 0xff, 0x04, 0x42, 0xcb, 0x44, 0x0b, 0xe8, 0xfb,
+  0xfc, 0xd2, 0x18, 0xca, 0xf9, 0xe1, 0x1a, 0xeb, 0x05, 0xd8, 0xda, 0xbd,
+  0xf9, 0x32, 0xf1, 0xd9, 0x09, 0x14, 0x19, 0x15, 0xdf, 0x09, 0xd2, 0xc6,
+  0x13, 0x1c, 0x7f, 0xd0, 0x18, 0x18, 0x30, 0xe7, 0xef, 0x18, 0x23, 0x07,
+  0xf2, 0xfc, 0xef, 0xd7, 0x27, 0xe4, 0xca, 0xe3, 0x15, 0x08, 0x1c, 0xe9,
+  0x12, 0xfe, 0x16, 0x0f, 0x05, 0xd2, 0x12, 0xed, 0x08, 0x18, 0x25, 0xf2,
+  0x30, 0x23, 0x0f, 0xea, 0xd2, 0x1e, 0xfe, 0xfa, 0xec, 0x04, 0x17, 0x8e,
+  0xe5, 0xb3, 0x28, 0xc0, 0xef, 0x0b, 0xfc, 0x2f, 0xef, 0x0c, 0x0f, 0x04,
+  0xe8, 0x29, 0xd5, 0xe0, 0xe6, 0x1d, 0x22, 0xe2, 0x4d, 0x01, 0xe3, 0xec,
+  0xd6, 0x09, 0x25, 0xcd, 0xd4, 0xe9, 0xec, 0xf6, 0xde, 0x01, 0x22, 0xb5,
+  0xf5, 0x23, 0xfb, 0x1e, 0x11, 0x02, 0x02, 0x1f, 0xec, 0x3a, 0xdf, 0x08,
+  0xea, 0x2e, 0x2d, 0xfa, 0x09, 0x05, 0x0f, 0xe8, 0xff, 0x4e, 0x27, 0xf5,
+  0xee, 0x1f, 0xc0, 0xca, 0xf9, 0x1d, 0x10, 0xe0, 0x00, 0x10, 0x29, 0x0b,
+  0x25, 0xef, 0xe1, 0x1e, 0x1d, 0x16, 0xf8, 0x2f, 0x00, 0x18, 0x44, 0xf0,
+  0x1d, 0x1f, 0x29, 0x05, 0xc3, 0x28, 0xda, 0xc8, 0xe8, 0x11, 0xf2, 0xcd,
+  0xef, 0xfc, 0x37, 0x01, 0xf1, 0xd7, 0x29, 0x29, 0x9f, 0xf8, 0xe4, 0x24,
+  0xf4, 0xea, 0x1c, 0xf5, 0xed, 0x10, 0x24, 0xf1, 0x1d, 0x05, 0x34, 0x00,
+  0xe6, 0x2d, 0xef, 0xcc, 0xe2, 0xfa, 0x01, 0x19, 0xdf, 0x18, 0x30, 0xea,
+  0x15, 0x04, 0x37, 0x24, 0xad, 0xff, 0xe0, 0x0d, 0xfc, 0x03, 0x06, 0x05,
+  0xe7, 0x14, 0x2d, 0x03, 0xc8, 0x0a, 0x3b, 0xde, 0x04, 0x4a, 0x26, 0xd6,
+  0x17, 0x0d, 0x04, 0xfa, 0xfd, 0x44, 0x1b, 0x01, 0x05, 0x0d, 0x37, 0x05,
+  0xb5, 0xf3, 0xb7, 0x01, 0x08, 0xf5, 0x16, 0x05, 0x32, 0xd4, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
   0xe7, 0x05, 0xf4, 0xd2, 0xf2, 0xba, 0x0e, 0xce, 0xb3, 0x17, 0x0b, 0x1d,
   0x04, 0x25, 0x15, 0x25, 0xd2, 0x03, 0xfc, 0xce, 0xed, 0xbf, 0x0f, 0xba,
   0xc9, 0x28, 0x04, 0x0f, 0x0e, 0x3c, 0x26, 0x25, 0xe6, 0x0c, 0x0d, 0x27,
@@ -6083,393 +6087,394 @@ unsigned char pretrainedResnet_quant_tflite[] = {
   0xfc, 0xf7, 0x14, 0x00, 0xe4, 0x30, 0x0e, 0x00, 0xfd, 0xb0, 0xe6, 0xef,
   0xe3, 0x1f, 0x12, 0xf0, 0x1b, 0xec, 0x10, 0xe3, 0xf8, 0x18, 0x13, 0xe1,
   0xfd, 0x01, 0xf5, 0x13, 0x10, 0x04, 0x1c, 0x02, 0x38, 0xef, 0x16, 0x02,
-  0x72, 0xe6, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-  0xaa, 0x42, 0xd5, 0x0a, 0x99, 0x18, 0x58, 0x17, 0xc0, 0x2e, 0x1e, 0xd3,
-  0x1b, 0x14, 0xec, 0xb9, 0xd0, 0x5e, 0x5e, 0xe1, 0x22, 0xf4, 0x3d, 0x64,
-  0xb4, 0xf8, 0x2d, 0x47, 0x35, 0x1c, 0x1f, 0xe6, 0xa0, 0x7f, 0x5a, 0x0b,
-  0x5f, 0xf2, 0x08, 0x2b, 0xf1, 0xe0, 0x30, 0x4b, 0xdd, 0x3e, 0xef, 0x35,
-  0x08, 0x11, 0xf3, 0x0a, 0xec, 0xe3, 0xf5, 0x33, 0x18, 0x13, 0x00, 0xe9,
-  0x0d, 0xaf, 0xc5, 0x09, 0x20, 0x2b, 0x17, 0x17, 0x16, 0xd7, 0x23, 0x7f,
-  0x0b, 0xe9, 0x07, 0x49, 0x14, 0xca, 0xec, 0xb3, 0xe1, 0x06, 0x07, 0xec,
-  0x0e, 0xfa, 0xf8, 0x25, 0x0f, 0xf1, 0x20, 0x31, 0xcd, 0x0b, 0xd2, 0xb9,
-  0x40, 0x1e, 0xba, 0xa2, 0xe8, 0x1f, 0xd9, 0xfc, 0xf7, 0xc7, 0xae, 0xa6,
-  0x1a, 0x82, 0xbe, 0x1e, 0x2f, 0xc9, 0xc2, 0xc6, 0x19, 0xc8, 0xdc, 0x13,
-  0x3e, 0xbc, 0xb6, 0xfb, 0x00, 0x9a, 0xff, 0xdd, 0x39, 0xa1, 0x1e, 0xd7,
-  0xef, 0xd4, 0xbc, 0x08, 0x24, 0xf4, 0xfc, 0x1a, 0xd0, 0xa9, 0xb0, 0x02,
-  0x0c, 0x34, 0xe8, 0xe9, 0xd2, 0xe4, 0xb3, 0x12, 0xf6, 0x41, 0x00, 0x08,
-  0xcb, 0x1d, 0x3d, 0xc5, 0x36, 0xec, 0xe8, 0x33, 0x3e, 0x1f, 0xc9, 0xd6,
-  0x00, 0x07, 0xfe, 0x02, 0xe2, 0xee, 0x07, 0x9e, 0xdc, 0xf0, 0x23, 0xd6,
-  0xad, 0x1d, 0x57, 0xd2, 0x14, 0x08, 0xf7, 0xf5, 0x08, 0xd6, 0xf2, 0x43,
-  0x7f, 0x33, 0xda, 0x4a, 0x2b, 0xda, 0xe0, 0x21, 0x44, 0xfb, 0x34, 0x06,
-  0xb0, 0x5a, 0x36, 0xa1, 0x05, 0xed, 0xcf, 0xe7, 0x73, 0xff, 0xe6, 0xef,
-  0x07, 0xd3, 0x0a, 0x19, 0xca, 0xc9, 0xfe, 0x91, 0xa0, 0xc9, 0x6f, 0xb1,
-  0x89, 0x3d, 0x23, 0xe7, 0x4f, 0x06, 0x0e, 0xf8, 0x26, 0xfe, 0xfb, 0x73,
-  0x3e, 0xd7, 0xc7, 0x49, 0xe8, 0xc7, 0xf3, 0xd4, 0xf5, 0xf2, 0x0c, 0x05,
-  0xb8, 0x2c, 0x11, 0xec, 0xdd, 0xc1, 0xf6, 0xb8, 0x3a, 0xee, 0x25, 0x1b,
-  0xe9, 0xd6, 0xd7, 0x31, 0xf9, 0xe0, 0x00, 0x3f, 0xb0, 0x02, 0x2c, 0xd9,
-  0xb3, 0xfc, 0x14, 0x14, 0xf4, 0x37, 0xd8, 0x08, 0x2f, 0x05, 0x19, 0x32,
-  0xb1, 0xee, 0xcb, 0x1e, 0xdb, 0xed, 0x0a, 0x23, 0x00, 0xff, 0x11, 0x16,
-  0xef, 0x14, 0xed, 0xf4, 0xd0, 0x15, 0x29, 0x07, 0x14, 0x08, 0xe9, 0xae,
-  0xf9, 0x03, 0x25, 0x1b, 0x0a, 0xf5, 0xee, 0x21, 0xfc, 0x0e, 0x2c, 0xef,
-  0x01, 0xce, 0x03, 0x0c, 0xc7, 0x10, 0xfb, 0xfa, 0x0a, 0x11, 0xf3, 0x08,
-  0xa6, 0xdb, 0xfd, 0xb7, 0x18, 0xec, 0x06, 0xf4, 0x09, 0xe8, 0xef, 0x00,
-  0xef, 0xf0, 0x0f, 0x12, 0x57, 0xf7, 0x6a, 0x52, 0x24, 0x5b, 0xe5, 0x81,
-  0x12, 0x18, 0x16, 0x06, 0x0f, 0xf5, 0x18, 0x74, 0x30, 0x09, 0x01, 0x08,
-  0x22, 0xbe, 0x29, 0xf1, 0xf8, 0xf9, 0xee, 0xef, 0xf5, 0xff, 0x34, 0xe8,
-  0xe7, 0xf0, 0xe9, 0xb1, 0x14, 0x18, 0x13, 0xf7, 0x31, 0x0e, 0xe5, 0x00,
-  0xe0, 0xf9, 0xf9, 0xde, 0x2a, 0xe9, 0x00, 0x39, 0xfa, 0xeb, 0xef, 0xd8,
-  0x1b, 0x10, 0xec, 0x2d, 0xf6, 0xee, 0xf0, 0xea, 0x0a, 0xf8, 0xdc, 0x0f,
-  0x01, 0xfd, 0x17, 0x02, 0x0a, 0xd0, 0xe2, 0x05, 0x02, 0xfe, 0xe1, 0xc4,
-  0xdf, 0x0d, 0xd5, 0x16, 0xed, 0x22, 0xe6, 0xe9, 0xdc, 0x28, 0xdf, 0xfb,
-  0x01, 0xfd, 0x01, 0xe6, 0x0f, 0x0f, 0xf0, 0x18, 0xf1, 0x23, 0x0f, 0x11,
-  0x09, 0x1b, 0xeb, 0x25, 0xfb, 0x29, 0x02, 0x05, 0x00, 0xfb, 0x39, 0xd7,
-  0x00, 0x22, 0x22, 0x16, 0xf9, 0x11, 0xf1, 0x20, 0x05, 0xf2, 0xef, 0x22,
-  0xfd, 0xfc, 0xc1, 0x29, 0xec, 0x08, 0xd0, 0xe4, 0x0d, 0x1a, 0x00, 0x12,
-  0x07, 0x03, 0xee, 0x07, 0x60, 0x09, 0x28, 0x01, 0xdf, 0x11, 0x07, 0xe7,
-  0x1f, 0x06, 0xfe, 0xf9, 0xf6, 0x31, 0xd3, 0xe4, 0x1b, 0xf3, 0x7f, 0xea,
-  0xf1, 0x08, 0x0c, 0xf2, 0xfb, 0x0b, 0xed, 0x1b, 0x1b, 0x0a, 0xc4, 0x0d,
-  0xfd, 0xe3, 0xb9, 0xf9, 0x12, 0x02, 0xe0, 0xd6, 0x0d, 0x1a, 0x0e, 0xda,
-  0x19, 0xfe, 0xdf, 0x17, 0x3d, 0x1e, 0xf3, 0xc4, 0x12, 0x02, 0xf5, 0xf8,
-  0x1b, 0x0f, 0x03, 0xbf, 0x08, 0x16, 0xd6, 0xef, 0x1d, 0x0e, 0x07, 0xde,
-  0x12, 0xee, 0xdb, 0x09, 0xd1, 0x09, 0xee, 0xf1, 0x11, 0xe6, 0xd2, 0x0a,
-  0x0d, 0x1d, 0x31, 0xf8, 0xce, 0xe6, 0x45, 0xf0, 0xe3, 0xfc, 0xe6, 0xff,
-  0xf0, 0x04, 0x19, 0xd6, 0x00, 0xe9, 0xc2, 0x19, 0xfa, 0xf8, 0xfb, 0x0d,
-  0x47, 0xfa, 0xb5, 0x13, 0x00, 0x19, 0x1b, 0xc3, 0x1a, 0x02, 0x24, 0xfc,
-  0xec, 0x10, 0xd7, 0xf7, 0x1e, 0xe1, 0xff, 0x09, 0x09, 0xf4, 0x3f, 0xf6,
-  0x0a, 0x26, 0x7f, 0xf6, 0xcb, 0x01, 0x0b, 0xea, 0xf0, 0xe8, 0x02, 0x14,
-  0x3a, 0x23, 0x28, 0xe7, 0xd7, 0xf9, 0xc4, 0x0e, 0x12, 0x9e, 0xc3, 0x06,
-  0x29, 0xc6, 0x9b, 0xd1, 0x10, 0xdc, 0x30, 0xa6, 0xf1, 0xef, 0x59, 0x01,
-  0xf9, 0x29, 0xbf, 0xea, 0xe2, 0xe9, 0xf5, 0xf2, 0x18, 0x0d, 0x0f, 0xd9,
-  0xf5, 0x32, 0x36, 0x2e, 0xe1, 0x35, 0x19, 0x1b, 0xc7, 0xdd, 0x25, 0x06,
-  0x2d, 0x2a, 0xee, 0xf8, 0xdc, 0xf8, 0xc6, 0x00, 0x1e, 0xdc, 0xdd, 0x31,
-  0xf4, 0xfa, 0xc8, 0x97, 0x1c, 0xdd, 0x12, 0xe6, 0x08, 0x05, 0x2a, 0xfa,
-  0x00, 0x42, 0xcb, 0x13, 0xda, 0x17, 0xed, 0xe3, 0x18, 0x2e, 0xff, 0xdb,
-  0x27, 0x30, 0xd4, 0x2d, 0xe5, 0x20, 0xbd, 0x0f, 0x0a, 0x17, 0x1f, 0x1e,
-  0x1c, 0xee, 0x04, 0x02, 0x2a, 0x1a, 0xfd, 0x62, 0xae, 0x50, 0xc2, 0xfd,
-  0xfc, 0x18, 0x03, 0x21, 0x42, 0x1b, 0x5f, 0x14, 0x22, 0xe8, 0x0b, 0x45,
-  0xc8, 0xdc, 0xff, 0xf7, 0xff, 0x02, 0xc6, 0x22, 0x28, 0x33, 0x7f, 0x44,
-  0x23, 0x12, 0xf9, 0x11, 0xfa, 0xd7, 0xd1, 0xf0, 0x0d, 0x1f, 0xfb, 0x12,
-  0x56, 0xf2, 0xe1, 0x14, 0xd2, 0x2b, 0xfb, 0x12, 0x1a, 0xfc, 0xfb, 0x0a,
-  0x13, 0x32, 0xf2, 0x25, 0x70, 0xad, 0xf8, 0x05, 0xe3, 0x12, 0xc8, 0xe9,
-  0xfb, 0x0f, 0x04, 0x04, 0xff, 0x2f, 0xc6, 0x2a, 0x29, 0xc7, 0x13, 0x26,
-  0xde, 0xec, 0x04, 0xbf, 0x10, 0xeb, 0xec, 0xfe, 0xfb, 0xf7, 0xf9, 0xed,
-  0xf6, 0xe1, 0xe6, 0x05, 0xe5, 0x02, 0x10, 0xa4, 0x2f, 0x03, 0x06, 0xea,
-  0xfc, 0x0d, 0xf3, 0xe5, 0x37, 0xeb, 0x06, 0xf4, 0x14, 0xdf, 0xe0, 0xdb,
-  0x2c, 0xe3, 0x1e, 0xfb, 0x15, 0x04, 0xd8, 0x01, 0xee, 0xd0, 0x26, 0xeb,
-  0xcd, 0x1f, 0xea, 0xf8, 0x2d, 0x13, 0xc0, 0xe9, 0x26, 0xb1, 0xe8, 0xfe,
-  0xb6, 0x1d, 0xe8, 0x37, 0xcd, 0x7a, 0x09, 0x11, 0x01, 0xf4, 0xf1, 0xe5,
-  0x25, 0xca, 0x1c, 0x1d, 0xec, 0xe2, 0x10, 0x5b, 0xf7, 0x46, 0x10, 0x03,
-  0x27, 0x09, 0x3c, 0x28, 0x45, 0xd3, 0x14, 0x3b, 0xff, 0x20, 0xfc, 0x12,
-  0xf7, 0x25, 0x04, 0xdc, 0x06, 0xf3, 0xe5, 0x2d, 0xde, 0x84, 0xce, 0xd9,
-  0x9a, 0x24, 0xf5, 0x11, 0xf3, 0x63, 0x5b, 0x26, 0x00, 0x28, 0xdc, 0x26,
-  0xc7, 0x81, 0x04, 0xe7, 0xb8, 0x1b, 0x0f, 0x38, 0xe0, 0x1c, 0x38, 0x2d,
-  0x30, 0x07, 0xee, 0x43, 0x0a, 0xa5, 0xd5, 0xf3, 0xcc, 0xf5, 0x42, 0x02,
-  0x1b, 0x1b, 0xf2, 0xde, 0xea, 0xb4, 0x22, 0x14, 0x12, 0xc2, 0xe1, 0xfd,
-  0x02, 0x1a, 0x17, 0x1f, 0x20, 0x1a, 0x01, 0x0c, 0xfc, 0xde, 0xec, 0xe4,
-  0xd3, 0xa8, 0xff, 0x20, 0xe3, 0x32, 0xf1, 0x06, 0xf4, 0xb1, 0xf3, 0x28,
-  0x41, 0xfe, 0xc9, 0x0f, 0xf4, 0xb0, 0xd0, 0x16, 0xcc, 0x54, 0x20, 0xd1,
-  0xf8, 0xe4, 0xd3, 0xe7, 0xfa, 0xdf, 0x05, 0xef, 0x12, 0x18, 0x18, 0x31,
-  0xf1, 0x26, 0x08, 0x18, 0x00, 0x19, 0x22, 0xf7, 0x0c, 0xf1, 0xe7, 0xcb,
-  0x1a, 0xfe, 0xf4, 0x0b, 0x10, 0x54, 0x3d, 0xfb, 0xff, 0x0b, 0xff, 0xf5,
-  0xee, 0xf9, 0x01, 0xf7, 0x2e, 0x0c, 0xe0, 0x25, 0x13, 0x24, 0x13, 0xe5,
-  0x01, 0xde, 0xdd, 0x0b, 0x07, 0x31, 0xf9, 0x9c, 0xf1, 0x19, 0x1b, 0x07,
-  0xfe, 0x4e, 0x0d, 0xf1, 0x12, 0x1d, 0xf8, 0x0e, 0xf1, 0x2f, 0xe2, 0x81,
-  0x1d, 0x5a, 0x09, 0xdf, 0x3c, 0x5b, 0x3b, 0x03, 0x1e, 0x00, 0xcc, 0x37,
-  0xf9, 0xf0, 0xff, 0x00, 0x1b, 0xf1, 0xf3, 0x17, 0x0e, 0x36, 0x0e, 0x0c,
-  0x35, 0xfb, 0x0a, 0x4a, 0x0c, 0xf2, 0xe7, 0x1a, 0xd6, 0x2e, 0xe1, 0x3d,
-  0xfc, 0x19, 0xd3, 0xfa, 0x29, 0x23, 0x49, 0x47, 0x0f, 0xe5, 0x03, 0xf7,
-  0xde, 0x19, 0xcf, 0x02, 0xe7, 0x38, 0xd2, 0xeb, 0xe7, 0xe7, 0x0a, 0x04,
-  0xea, 0xfc, 0xeb, 0x3e, 0xfc, 0xcc, 0xcf, 0x03, 0x00, 0x06, 0xd2, 0x02,
-  0xf0, 0x17, 0x5a, 0xeb, 0x0f, 0x0b, 0x52, 0x1a, 0xff, 0xe8, 0xf1, 0x43,
-  0x3a, 0xb8, 0xee, 0x0e, 0x1a, 0xf0, 0x37, 0xb5, 0xb9, 0x06, 0x62, 0x00,
-  0x15, 0x0d, 0xfd, 0x66, 0xfd, 0xe2, 0x16, 0x01, 0x34, 0xe8, 0xf2, 0xc1,
-  0x31, 0x3b, 0x05, 0x08, 0xe8, 0x0d, 0xf7, 0x0f, 0x04, 0x16, 0x36, 0xd3,
-  0xa8, 0x24, 0x5e, 0xcc, 0xae, 0x3b, 0x2e, 0xab, 0xde, 0x0d, 0xe5, 0x32,
-  0x0b, 0xa1, 0x08, 0x24, 0xca, 0x38, 0x30, 0xbc, 0x81, 0xce, 0x56, 0xb5,
-  0xc6, 0x02, 0xcf, 0x15, 0x1d, 0x9a, 0x66, 0x4f, 0x50, 0xff, 0x0a, 0xba,
-  0x3b, 0xda, 0xeb, 0x4c, 0xe8, 0x35, 0xb5, 0xd3, 0x42, 0xd6, 0x43, 0xee,
-  0xfc, 0xac, 0x12, 0x14, 0xd8, 0x02, 0x25, 0xfe, 0xf7, 0x19, 0x49, 0xcf,
-  0xef, 0xef, 0x2c, 0xfa, 0xd4, 0x35, 0xfe, 0x22, 0xee, 0x10, 0x5c, 0x04,
-  0xd6, 0x25, 0x19, 0xa2, 0xf2, 0xe2, 0x71, 0x0b, 0x4a, 0x2f, 0x4c, 0xfd,
-  0x0b, 0x23, 0x48, 0x1e, 0xee, 0x23, 0x24, 0x94, 0x4a, 0xdd, 0x14, 0x12,
-  0x2b, 0x07, 0x0e, 0xfe, 0x17, 0xec, 0x0e, 0xdb, 0x2b, 0xe8, 0x08, 0x0e,
-  0xc9, 0xd4, 0x0d, 0x05, 0x2d, 0xf7, 0x2b, 0xd5, 0x24, 0x03, 0x07, 0xbf,
-  0x39, 0xfb, 0x01, 0x09, 0xc4, 0xc6, 0xb3, 0x19, 0x19, 0xf4, 0xf0, 0xf7,
-  0xe6, 0x08, 0x31, 0xdd, 0x28, 0xf4, 0xe8, 0x0d, 0xbb, 0x81, 0xdb, 0x19,
-  0xf9, 0x06, 0x37, 0x1b, 0xce, 0xfc, 0x31, 0x2d, 0xfb, 0xdc, 0x03, 0x14,
-  0xa3, 0xe3, 0xf2, 0x2d, 0xf2, 0xef, 0x47, 0x14, 0xc2, 0xf5, 0xf0, 0xfa,
-  0xfc, 0xe3, 0x05, 0xcc, 0x84, 0xc1, 0xb1, 0xff, 0x0f, 0x33, 0xee, 0x25,
-  0x88, 0xf9, 0xec, 0xd7, 0x23, 0xd6, 0xed, 0xc9, 0xaf, 0xd7, 0xe5, 0xf9,
-  0xeb, 0xf7, 0xb4, 0x14, 0xe8, 0x2b, 0xfe, 0x2a, 0x02, 0xff, 0x1a, 0x3b,
-  0xd4, 0x25, 0xf5, 0x36, 0xd6, 0xb1, 0xc8, 0x3d, 0xe1, 0x2c, 0xbd, 0xe1,
-  0x04, 0x05, 0x2b, 0xe3, 0xe9, 0x0d, 0xee, 0x2e, 0xfb, 0xe5, 0xe3, 0x4d,
-  0xdb, 0x0e, 0xc3, 0xf0, 0x3a, 0x15, 0x10, 0xf1, 0xdb, 0x42, 0xe6, 0x08,
-  0xef, 0xb4, 0x24, 0x32, 0x15, 0xc9, 0xe8, 0x3f, 0xd1, 0xe9, 0x20, 0xa1,
-  0xf1, 0xb5, 0xd6, 0xd4, 0xe0, 0xfb, 0x37, 0x4d, 0x4b, 0xe7, 0x3d, 0xf9,
-  0xee, 0x03, 0x00, 0xb9, 0xf1, 0xc0, 0x10, 0xea, 0xe1, 0xfa, 0xb1, 0x21,
-  0x59, 0xe2, 0xfb, 0x08, 0xf0, 0xf9, 0x13, 0xe4, 0xf6, 0xbb, 0x54, 0x81,
-  0xfb, 0x8d, 0xd9, 0xf5, 0xfd, 0xf8, 0xce, 0x14, 0xee, 0x02, 0xe5, 0xd3,
-  0xd9, 0xee, 0x19, 0xec, 0x15, 0xd9, 0x1c, 0x2a, 0x11, 0x21, 0x00, 0xc8,
-  0xf4, 0x07, 0xe5, 0x28, 0xd4, 0x11, 0x1f, 0x0e, 0x19, 0xdd, 0xc4, 0x04,
-  0x79, 0xdf, 0x0e, 0xf9, 0x16, 0x15, 0x07, 0x13, 0xe5, 0xe3, 0x39, 0x01,
-  0x28, 0xb6, 0x04, 0x18, 0x0d, 0x11, 0x01, 0xf9, 0xf3, 0xf6, 0xd1, 0xe3,
-  0x01, 0xec, 0x27, 0xdc, 0xb6, 0xfc, 0x30, 0x41, 0xc9, 0xce, 0x0d, 0xdd,
-  0xfb, 0x07, 0xf0, 0x64, 0xc4, 0x15, 0xe9, 0xd8, 0xe1, 0x02, 0xe9, 0x13,
-  0xf5, 0x11, 0x10, 0xf4, 0x10, 0x30, 0x18, 0x03, 0xd5, 0x11, 0x2a, 0x21,
-  0x28, 0x10, 0xfd, 0x02, 0xfa, 0xe3, 0xf3, 0x01, 0x12, 0x07, 0x12, 0x23,
-  0x09, 0xcc, 0xe6, 0xec, 0x29, 0x09, 0x05, 0xfc, 0x2e, 0xf1, 0xf1, 0xfe,
-  0x0a, 0x09, 0xfb, 0x05, 0xe5, 0x09, 0xf9, 0xfb, 0x01, 0xfb, 0xf5, 0x06,
-  0x10, 0xfb, 0xe8, 0x0d, 0xe6, 0x0c, 0xd4, 0x06, 0xf1, 0x15, 0x28, 0xe3,
-  0xfa, 0x14, 0x1f, 0x31, 0xc4, 0xd9, 0xed, 0xe1, 0x43, 0x0d, 0x19, 0xf9,
-  0x0a, 0xde, 0x0d, 0xd1, 0x39, 0x14, 0x0f, 0x02, 0x19, 0xd2, 0x02, 0x1e,
-  0x22, 0x03, 0x26, 0xf2, 0xe6, 0xf3, 0xff, 0xdb, 0x1e, 0x2d, 0xd1, 0xfe,
-  0x1c, 0x00, 0x0e, 0x12, 0xf9, 0xf1, 0x02, 0xf4, 0xf8, 0xe4, 0xf0, 0x81,
-  0x04, 0x08, 0x0a, 0x10, 0xe8, 0xce, 0x0a, 0xef, 0x19, 0x09, 0x0e, 0xed,
-  0xec, 0x02, 0x21, 0xf9, 0x07, 0x09, 0x16, 0x19, 0xeb, 0xda, 0x14, 0xf8,
-  0x0d, 0x1a, 0x19, 0xf7, 0xf1, 0x1e, 0x10, 0xf6, 0x2c, 0x18, 0xeb, 0x10,
-  0x07, 0x0b, 0x14, 0x0a, 0xfe, 0xff, 0xeb, 0x13, 0xff, 0x03, 0xde, 0xd0,
-  0x6d, 0x4d, 0x16, 0xf7, 0xc7, 0x0f, 0x3d, 0x11, 0x68, 0xe6, 0xc6, 0xfe,
-  0xf6, 0xc0, 0x96, 0x40, 0x41, 0x1e, 0xf5, 0x0d, 0xb7, 0xe5, 0x6e, 0x35,
-  0x74, 0xf1, 0xc4, 0xe1, 0xc4, 0x17, 0xd0, 0x45, 0x41, 0x0a, 0xcd, 0x1d,
-  0xdf, 0xc6, 0x78, 0x28, 0x7c, 0xec, 0xe0, 0xf4, 0xb4, 0xfe, 0xf7, 0x0e,
-  0x43, 0x1e, 0xfc, 0xe5, 0x4e, 0x49, 0xf1, 0xf2, 0x5f, 0xa2, 0xa6, 0xc9,
-  0xef, 0x0c, 0xf7, 0x25, 0x07, 0xfd, 0x94, 0x37, 0x50, 0x1a, 0x49, 0xc6,
-  0x53, 0xe5, 0xcf, 0xef, 0xde, 0x2b, 0x1b, 0x19, 0xf1, 0xe2, 0xd4, 0x59,
-  0xf1, 0xb9, 0x62, 0xfc, 0x3d, 0x14, 0xe1, 0x2c, 0xc2, 0xf3, 0x17, 0x02,
-  0xdd, 0x22, 0x07, 0xe0, 0x7f, 0x6f, 0x25, 0x27, 0x12, 0x92, 0x21, 0xf2,
-  0x23, 0xeb, 0x08, 0xc5, 0xb2, 0x06, 0x0e, 0x25, 0x75, 0xfe, 0x50, 0xf7,
-  0xd7, 0x03, 0x1b, 0x33, 0xf4, 0xf8, 0x02, 0xed, 0xca, 0x0f, 0xcc, 0x6b,
-  0x91, 0xc7, 0x4f, 0xb5, 0x0c, 0x38, 0xed, 0x03, 0xf7, 0xda, 0xf7, 0xd9,
-  0xe8, 0x10, 0x0d, 0xbe, 0x03, 0xe5, 0xe4, 0xd2, 0x10, 0xf6, 0x09, 0x04,
-  0x25, 0x2f, 0xe7, 0x33, 0x43, 0x01, 0x0b, 0x10, 0x38, 0x07, 0xf1, 0xe8,
-  0x14, 0xea, 0x00, 0x10, 0xfd, 0x13, 0xe3, 0x2e, 0xea, 0xed, 0xd2, 0x09,
-  0xea, 0xf1, 0x01, 0x06, 0xd8, 0xe8, 0x04, 0x05, 0x0a, 0xdb, 0x07, 0xd8,
-  0x81, 0x17, 0xe8, 0xfd, 0x09, 0xea, 0x00, 0x79, 0x1f, 0xfb, 0x10, 0xfa,
-  0xd9, 0xef, 0x02, 0xcc, 0x22, 0x08, 0xeb, 0xec, 0xaf, 0x4e, 0xf8, 0xa9,
-  0xed, 0xe5, 0xed, 0x0b, 0x30, 0x34, 0xf3, 0x46, 0x24, 0xfc, 0x20, 0x27,
-  0x45, 0xfe, 0xf4, 0xfa, 0x09, 0xf5, 0x0e, 0x0f, 0xee, 0x05, 0x0b, 0xf8,
-  0x37, 0x06, 0xf7, 0x0f, 0xff, 0x23, 0xf3, 0xf7, 0x11, 0x03, 0xf4, 0xf6,
-  0x28, 0x1c, 0xf7, 0xca, 0xe7, 0xfd, 0xf7, 0xfd, 0xee, 0xd3, 0xe4, 0x34,
-  0xfe, 0x0c, 0xdd, 0x03, 0xda, 0xd2, 0xd8, 0x04, 0x05, 0x0c, 0xfc, 0xf5,
-  0xf4, 0x15, 0xdc, 0xe1, 0x25, 0x20, 0x02, 0xfa, 0x08, 0x04, 0x08, 0x12,
-  0x21, 0xfc, 0x21, 0x02, 0xee, 0xd1, 0x07, 0x45, 0x4b, 0x09, 0xdb, 0xfa,
-  0xd4, 0x1c, 0x1f, 0xec, 0x23, 0x09, 0xdf, 0x10, 0x2c, 0x03, 0xc6, 0xe8,
-  0x3a, 0x48, 0x06, 0xe7, 0xe6, 0x0f, 0x07, 0x2c, 0xbf, 0x28, 0xf5, 0xf6,
-  0x42, 0x0a, 0xeb, 0xc5, 0xfa, 0x17, 0x1a, 0xfc, 0xe6, 0xd7, 0xe7, 0x25,
-  0x21, 0xee, 0x28, 0x81, 0xdc, 0x00, 0xf4, 0x05, 0x2d, 0x51, 0xe2, 0xde,
-  0xee, 0x1a, 0x21, 0x0f, 0xe8, 0xdb, 0xd6, 0xf1, 0x15, 0xdc, 0xd6, 0xd0,
-  0x1c, 0x4b, 0xed, 0xef, 0xea, 0xd8, 0xed, 0x19, 0xd6, 0xe8, 0x1e, 0x2c,
-  0xed, 0x20, 0x14, 0xd4, 0xd3, 0x13, 0x21, 0x02, 0xf6, 0xd3, 0xe4, 0x25,
-  0xf5, 0xe0, 0xfd, 0x19, 0xde, 0xff, 0xe3, 0xf7, 0x12, 0x35, 0xf1, 0xed,
-  0xf1, 0xdb, 0xf2, 0x01, 0xfe, 0xd4, 0x09, 0x10, 0xee, 0xdb, 0xf4, 0x15,
-  0x1e, 0xff, 0xce, 0x0d, 0xfd, 0xd5, 0xeb, 0x43, 0xd9, 0x07, 0x06, 0x16,
-  0xe4, 0x0a, 0x0b, 0x0f, 0x12, 0x1a, 0x26, 0xf5, 0xf5, 0x09, 0x0a, 0x08,
-  0xfa, 0x11, 0x48, 0x14, 0xff, 0x18, 0xd2, 0x37, 0x3a, 0x2a, 0xe1, 0x10,
-  0xec, 0xcd, 0xee, 0xe8, 0x0b, 0x07, 0x08, 0x3f, 0x00, 0xef, 0x02, 0x10,
-  0x33, 0x47, 0xa3, 0x00, 0x03, 0x0d, 0xe0, 0xfa, 0x00, 0xdc, 0xca, 0x12,
-  0xb8, 0xa2, 0x1b, 0x2d, 0x24, 0x0c, 0xcb, 0x03, 0x19, 0x0f, 0xe7, 0x14,
-  0xf3, 0x1a, 0x5c, 0x27, 0x1f, 0xf6, 0xcd, 0xee, 0xe0, 0x2c, 0xb6, 0x7f,
-  0xd8, 0x1e, 0xbc, 0xf5, 0xc7, 0x33, 0xf2, 0xff, 0x3e, 0x0f, 0xef, 0x26,
-  0x27, 0x29, 0x96, 0x32, 0xeb, 0xf6, 0xc8, 0xf8, 0x0e, 0x2a, 0xca, 0xf0,
-  0xdb, 0x16, 0xf4, 0x14, 0x18, 0x21, 0xd8, 0xd4, 0x10, 0xcb, 0x11, 0x1a,
-  0x1e, 0x17, 0xc9, 0x00, 0xfe, 0x28, 0x08, 0x19, 0x09, 0x1f, 0xc4, 0x4b,
-  0xfa, 0x09, 0xc2, 0x11, 0x14, 0x29, 0xb4, 0x0b, 0x3f, 0x5a, 0x08, 0x36,
-  0x11, 0x03, 0xb1, 0xe1, 0xde, 0x16, 0xcb, 0x0c, 0xfe, 0x2d, 0xd4, 0x1f,
-  0x09, 0x43, 0xea, 0x00, 0xd3, 0x13, 0x04, 0x83, 0x06, 0xc6, 0x1b, 0x00,
-  0x7e, 0xef, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-  0x0f, 0x08, 0x03, 0xfc, 0xf0, 0x1a, 0x09, 0x3f, 0xf1, 0xfe, 0x02, 0x07,
-  0x03, 0x16, 0xd3, 0xfe, 0x06, 0xec, 0x9e, 0x2b, 0xbe, 0x07, 0x13, 0xab,
-  0xed, 0xee, 0xd6, 0xa9, 0x16, 0xe7, 0xeb, 0x0b, 0xca, 0x17, 0xfb, 0xda,
-  0x14, 0x07, 0x31, 0x29, 0x1f, 0xf4, 0x02, 0xee, 0xc2, 0x01, 0x16, 0xe4,
-  0xe7, 0xf5, 0x27, 0x43, 0x10, 0xf0, 0x1a, 0xee, 0xba, 0x12, 0x00, 0x0f,
-  0xef, 0x2e, 0xc6, 0xe0, 0xe1, 0xb5, 0xf1, 0x38, 0xdf, 0x13, 0x9c, 0x0a,
-  0xf3, 0x24, 0xae, 0xd2, 0xaf, 0xf9, 0xec, 0x40, 0xe6, 0x32, 0x04, 0x85,
-  0x1a, 0x1c, 0xef, 0xdd, 0xda, 0x1f, 0xdf, 0xe7, 0xf9, 0xe8, 0x10, 0x0b,
-  0x0e, 0x16, 0xf2, 0xec, 0x04, 0xa1, 0xf8, 0xd9, 0x17, 0xf4, 0xfa, 0x0e,
-  0x17, 0xfc, 0xec, 0x03, 0x25, 0x02, 0x22, 0xfa, 0xf9, 0xde, 0xde, 0xde,
-  0xe1, 0x06, 0xf7, 0xfe, 0xa7, 0xf5, 0x09, 0x81, 0x55, 0x2f, 0x0b, 0xb1,
-  0x0d, 0xfa, 0xf6, 0xfc, 0xf6, 0xd3, 0x22, 0x07, 0x04, 0xdd, 0x1c, 0xeb,
-  0x09, 0xec, 0xf3, 0x0b, 0x12, 0x40, 0x18, 0x18, 0xbc, 0x12, 0x05, 0xf0,
-  0x47, 0x00, 0x24, 0x3a, 0x16, 0xc9, 0x52, 0x23, 0x48, 0x39, 0xf6, 0x8e,
-  0xf1, 0x6c, 0x10, 0x4c, 0x17, 0x14, 0x12, 0x7c, 0x25, 0x01, 0x3b, 0x41,
-  0x34, 0x54, 0x12, 0xbb, 0x21, 0x4e, 0xf1, 0x6e, 0x01, 0xe4, 0xf3, 0x70,
-  0x25, 0xdc, 0xf0, 0xc3, 0xdd, 0xb0, 0xed, 0x1c, 0xe0, 0xf2, 0x2b, 0xdc,
-  0xd9, 0xe8, 0x4e, 0xea, 0xf3, 0xbc, 0x6a, 0xec, 0x23, 0x81, 0xc8, 0xa3,
-  0xc1, 0x55, 0x42, 0xe6, 0x03, 0x0a, 0x25, 0xd4, 0xe3, 0xce, 0x55, 0x11,
-  0x1b, 0x03, 0x00, 0x83, 0xcd, 0x48, 0x1f, 0xf2, 0x0c, 0xf0, 0xe8, 0x0e,
-  0x14, 0x13, 0xe2, 0x23, 0xc7, 0x0a, 0x03, 0x28, 0x26, 0xcf, 0x1b, 0xe4,
-  0xe0, 0xc6, 0x27, 0xfa, 0x0b, 0x11, 0xe4, 0xfc, 0x13, 0xd6, 0xc1, 0x2c,
-  0xfb, 0x45, 0x2c, 0xf9, 0xe0, 0xe6, 0x06, 0x09, 0xbf, 0xe4, 0xe6, 0xd7,
-  0x00, 0x06, 0x1b, 0xda, 0xca, 0xf6, 0x1c, 0xdd, 0x50, 0xd9, 0xdb, 0x49,
-  0xdd, 0x45, 0xf2, 0x6a, 0xfa, 0x27, 0x56, 0x24, 0x1e, 0xcf, 0xe2, 0x12,
-  0xef, 0x21, 0x53, 0x1e, 0xfd, 0x4f, 0xd8, 0x0c, 0x1a, 0xee, 0x9e, 0xb3,
-  0x15, 0xe0, 0x15, 0x05, 0x25, 0x3f, 0x40, 0x0b, 0xee, 0xde, 0xe4, 0xe0,
-  0x0a, 0x1d, 0xa3, 0x0d, 0x02, 0xf8, 0xc2, 0x26, 0xf6, 0x04, 0x5b, 0xef,
-  0xf6, 0x23, 0xfa, 0x4e, 0xe9, 0x39, 0x0c, 0x09, 0xb7, 0xcc, 0x14, 0x1a,
-  0xcd, 0x3e, 0x0b, 0x03, 0xf4, 0x35, 0xde, 0xef, 0x04, 0x13, 0x81, 0xe4,
-  0xf3, 0x90, 0x44, 0x0d, 0xd3, 0x69, 0x16, 0x7e, 0x09, 0xd0, 0xf7, 0x8a,
-  0xed, 0x0e, 0xfd, 0x50, 0xed, 0x49, 0x38, 0xed, 0xe9, 0x22, 0x43, 0xde,
-  0x13, 0xf4, 0xf1, 0x08, 0xf4, 0x0a, 0xd6, 0xc0, 0xae, 0x15, 0xf4, 0x5e,
-  0xc4, 0xfa, 0xd2, 0xe4, 0xd1, 0x2c, 0xdd, 0xec, 0x09, 0xdc, 0xd3, 0x3d,
-  0xf8, 0xbf, 0x1d, 0x13, 0x0a, 0x1f, 0xef, 0xce, 0xfc, 0xdf, 0xcf, 0xbb,
-  0xe7, 0x12, 0x0c, 0xf5, 0x09, 0x14, 0x39, 0xf1, 0x0f, 0xf5, 0x0e, 0x11,
-  0x2d, 0x02, 0x88, 0xae, 0x17, 0x8b, 0xaa, 0xd7, 0xb8, 0xf5, 0x0f, 0xf7,
-  0x10, 0x1a, 0x2e, 0xfb, 0xad, 0xdb, 0x81, 0x0d, 0x0a, 0xac, 0xc6, 0xa6,
-  0x32, 0x10, 0x02, 0x2a, 0x03, 0x17, 0x2e, 0xb1, 0xd7, 0xe3, 0xe8, 0x58,
-  0x15, 0xc4, 0xfd, 0x59, 0x49, 0x10, 0x08, 0x23, 0x17, 0x37, 0x0b, 0x12,
-  0x24, 0x04, 0x0e, 0xea, 0x0e, 0xb6, 0xcf, 0x31, 0x03, 0x06, 0x02, 0x02,
-  0x24, 0x1f, 0xfe, 0x13, 0xd0, 0xd8, 0x36, 0xe1, 0xea, 0xc7, 0xe0, 0xea,
-  0x54, 0x46, 0x12, 0x21, 0xd3, 0x11, 0x02, 0x17, 0xe2, 0x12, 0x2d, 0x06,
-  0x34, 0x49, 0x57, 0xcf, 0x04, 0x2b, 0x30, 0x35, 0xaf, 0x20, 0xe3, 0x15,
-  0x23, 0x23, 0x1f, 0xdf, 0xe3, 0xe5, 0x1e, 0xf0, 0xfc, 0xf6, 0x10, 0xe6,
-  0xd7, 0xe1, 0xfc, 0xf3, 0xfa, 0x06, 0xe7, 0xf6, 0xe3, 0x0d, 0x0c, 0x00,
-  0xd5, 0xe6, 0x07, 0x13, 0xaf, 0xed, 0xfc, 0x27, 0x01, 0x20, 0xd6, 0x5b,
-  0x25, 0x36, 0x04, 0x18, 0xe7, 0x10, 0x00, 0xf7, 0x12, 0xfc, 0xe4, 0x1f,
-  0xc9, 0x17, 0xa2, 0x8c, 0x2d, 0xe3, 0x8d, 0x11, 0xdc, 0xd4, 0xdf, 0xca,
-  0xfe, 0xba, 0x30, 0xdd, 0x01, 0x03, 0x2f, 0xb6, 0x0a, 0x1e, 0xc9, 0x8f,
-  0x0f, 0x02, 0x00, 0x07, 0x0e, 0xa5, 0x16, 0xa7, 0x2f, 0xa3, 0x2c, 0x62,
-  0x00, 0x19, 0xdb, 0xaa, 0x4f, 0x81, 0x07, 0xcf, 0x0f, 0xcb, 0x21, 0xea,
-  0xf1, 0x21, 0xc2, 0xff, 0x52, 0xd6, 0xfc, 0x17, 0x10, 0xac, 0xea, 0x0f,
-  0xac, 0xed, 0x19, 0xe5, 0xd9, 0x0e, 0xf5, 0x97, 0xea, 0x2e, 0xd7, 0x26,
-  0xd9, 0x7b, 0x01, 0x23, 0x21, 0xb3, 0x05, 0xd1, 0x06, 0xd9, 0x54, 0xee,
-  0x0a, 0x25, 0x0f, 0xda, 0x16, 0xe1, 0x06, 0xe7, 0x50, 0xdd, 0x03, 0xce,
-  0xf1, 0x3a, 0x08, 0x66, 0x33, 0xcf, 0xde, 0xc3, 0x32, 0xaa, 0xdb, 0xdb,
-  0xbe, 0x11, 0xde, 0xf7, 0x0c, 0x3a, 0x0b, 0xde, 0x89, 0x0d, 0xfb, 0x25,
-  0xec, 0x2b, 0x19, 0x39, 0x93, 0xe7, 0xeb, 0x57, 0xe8, 0x01, 0xd9, 0xca,
-  0xc0, 0xf2, 0x45, 0xf8, 0xc9, 0x10, 0x20, 0xec, 0xe5, 0xe4, 0xf5, 0x1e,
-  0xad, 0xf0, 0x20, 0xe4, 0x04, 0x1a, 0x3a, 0x13, 0xea, 0xe7, 0xe4, 0x2d,
-  0x1a, 0xf4, 0x20, 0x12, 0x2f, 0x1a, 0xf6, 0x23, 0xc6, 0xd5, 0xb9, 0xaa,
-  0xf7, 0x1b, 0x11, 0xf9, 0xf1, 0xfa, 0xe6, 0x33, 0x37, 0xdf, 0x07, 0x21,
-  0xff, 0x10, 0xf7, 0x16, 0xe9, 0xd2, 0xf5, 0xcb, 0xe3, 0xfa, 0xff, 0xe9,
-  0xe7, 0xd3, 0xf0, 0x93, 0x08, 0xeb, 0x7f, 0x16, 0xa8, 0xf3, 0xf9, 0x01,
-  0xf9, 0xe7, 0x23, 0xe2, 0xe2, 0xea, 0xe4, 0x00, 0x03, 0xf2, 0x39, 0xdc,
-  0x09, 0xcf, 0xfb, 0x0e, 0xd8, 0xde, 0xd4, 0x38, 0xfa, 0xb4, 0x12, 0x35,
-  0x0d, 0xe3, 0x01, 0x02, 0x10, 0xe5, 0x0b, 0x08, 0x2d, 0xfa, 0xf1, 0x14,
-  0xdb, 0xf5, 0xf6, 0xca, 0xea, 0xf1, 0xee, 0x00, 0xcb, 0x20, 0x09, 0x22,
-  0xf9, 0xfb, 0x3c, 0x41, 0xe1, 0x0b, 0x12, 0xd4, 0x18, 0x1d, 0xe5, 0xdc,
-  0x0c, 0xff, 0xfb, 0x29, 0xcf, 0xee, 0xff, 0xb2, 0xf1, 0xe5, 0xfb, 0xf6,
-  0x0c, 0x24, 0x1e, 0xe3, 0x13, 0xc2, 0x11, 0x4a, 0x3f, 0x02, 0x13, 0x20,
-  0x7f, 0x4e, 0x17, 0x24, 0xdb, 0x3c, 0x62, 0xd0, 0xce, 0x42, 0xf0, 0xee,
-  0x0a, 0xfd, 0x44, 0x58, 0x58, 0x1f, 0xf3, 0x33, 0xff, 0x08, 0x67, 0xe2,
-  0x07, 0x2f, 0xf0, 0x08, 0xfb, 0x27, 0x35, 0xfe, 0x5f, 0x1c, 0xa6, 0xd0,
-  0xf7, 0x35, 0x0c, 0x05, 0xf6, 0x0e, 0xf8, 0xe7, 0x00, 0x06, 0x2d, 0x12,
-  0xe4, 0x0e, 0x41, 0x26, 0xcf, 0xf8, 0x13, 0x3e, 0x42, 0x23, 0xd5, 0xe8,
-  0xeb, 0x00, 0xd1, 0x0f, 0xb6, 0xa8, 0xf5, 0x31, 0xf6, 0xd7, 0x08, 0x53,
-  0x21, 0xdf, 0xab, 0xec, 0xa2, 0x0c, 0xd3, 0xf0, 0x3c, 0xbd, 0xa0, 0xc9,
-  0xf3, 0xf5, 0x05, 0x2e, 0xd8, 0xe9, 0xa3, 0xde, 0xc6, 0x09, 0xed, 0xe5,
-  0xe0, 0xf8, 0x3d, 0xf2, 0xf8, 0x0a, 0xeb, 0x0e, 0x1a, 0x02, 0xcb, 0x26,
-  0x3a, 0xf1, 0x8e, 0x34, 0xae, 0xaf, 0x03, 0xf6, 0x5c, 0x1d, 0x0c, 0xf8,
-  0x27, 0x97, 0xc2, 0x3b, 0xc9, 0xea, 0xac, 0x10, 0xec, 0xbe, 0xc5, 0xbc,
-  0x50, 0xed, 0xf7, 0xd5, 0x16, 0xcf, 0xa5, 0x29, 0xe1, 0xe5, 0xdc, 0xee,
-  0xf9, 0xfb, 0xd6, 0xf2, 0x08, 0xce, 0xfa, 0xd4, 0x10, 0xf0, 0x09, 0xf9,
-  0xfe, 0x12, 0xfd, 0xdb, 0xf1, 0x0f, 0xdd, 0xe0, 0x04, 0xfa, 0x21, 0x5c,
-  0x08, 0x0f, 0x12, 0x40, 0xe2, 0x12, 0x1d, 0xb2, 0xfa, 0xf7, 0xf6, 0x0f,
-  0xfd, 0x25, 0xdf, 0x04, 0xf8, 0xf8, 0x0b, 0x42, 0x24, 0x11, 0x27, 0x01,
-  0x0f, 0xe9, 0x1f, 0xfe, 0xfc, 0x26, 0x81, 0x1a, 0x0e, 0x0f, 0x03, 0xf1,
-  0xf5, 0x2e, 0xea, 0x5c, 0x0c, 0x25, 0x39, 0xd8, 0x0d, 0xd1, 0x0e, 0x40,
-  0x05, 0x25, 0xfa, 0xe5, 0x2f, 0xf4, 0xf4, 0xe2, 0x0c, 0x16, 0x58, 0xce,
-  0xd4, 0xed, 0x16, 0xec, 0x31, 0xd3, 0xe6, 0x17, 0xe6, 0xf6, 0xfe, 0xae,
-  0x11, 0xe2, 0xe8, 0x48, 0x10, 0x37, 0x19, 0xda, 0xf0, 0x05, 0x2f, 0x17,
-  0xda, 0x21, 0xf3, 0xcf, 0xd3, 0x07, 0xdf, 0x3a, 0x1d, 0xfc, 0xf8, 0x13,
-  0xc6, 0x21, 0x0b, 0xe3, 0xed, 0xfc, 0x00, 0x51, 0xef, 0xf7, 0xf7, 0x0e,
-  0xe2, 0xed, 0x05, 0x20, 0x02, 0x09, 0xe8, 0xe0, 0x15, 0xfc, 0xfc, 0x27,
-  0x39, 0x22, 0x4b, 0xf8, 0xea, 0xe2, 0xc8, 0xf4, 0x22, 0x14, 0x0e, 0x07,
-  0x16, 0x2a, 0xbe, 0x46, 0x34, 0xe2, 0xf9, 0x15, 0xd5, 0x2a, 0xe8, 0x0a,
-  0x0d, 0x27, 0xe1, 0xfb, 0xd9, 0xed, 0xbf, 0xd6, 0x1e, 0xbc, 0xa9, 0x92,
-  0x06, 0x0e, 0x51, 0x25, 0xf2, 0xdb, 0xd4, 0xbe, 0xdf, 0xe0, 0xfc, 0x81,
-  0xfb, 0x34, 0x34, 0x19, 0xfd, 0xae, 0xfc, 0x10, 0x0a, 0xfd, 0x14, 0xfa,
-  0xf3, 0x0d, 0xc8, 0x5a, 0x1a, 0xf4, 0xc5, 0x30, 0xf8, 0x02, 0x1d, 0xbe,
-  0xdf, 0x1a, 0xe6, 0x25, 0x16, 0xe4, 0xe9, 0xf2, 0xfb, 0xad, 0xb3, 0xc1,
-  0x33, 0x0a, 0x25, 0xe0, 0xc2, 0xea, 0xd6, 0xf1, 0x09, 0xd7, 0x29, 0x98,
-  0x00, 0x31, 0x23, 0x0d, 0x07, 0x17, 0xe6, 0x3f, 0x37, 0xd9, 0x00, 0xe9,
-  0xad, 0xff, 0xd1, 0x1d, 0xe9, 0xeb, 0xe7, 0x41, 0xf8, 0x33, 0x33, 0xe4,
-  0x32, 0xe5, 0xec, 0x43, 0x23, 0xee, 0x0e, 0xaa, 0xed, 0x8f, 0xdf, 0xd7,
-  0xf2, 0x32, 0xe0, 0xdd, 0xb8, 0xe5, 0xf4, 0x36, 0x04, 0xf4, 0x45, 0xae,
-  0xe9, 0xf8, 0x2e, 0xde, 0xf5, 0x05, 0xd4, 0x40, 0xfd, 0x0b, 0xed, 0x18,
-  0xfb, 0xfd, 0xfc, 0xdd, 0x18, 0x0b, 0xd0, 0xee, 0x2e, 0xf5, 0x16, 0x81,
-  0xcb, 0xeb, 0xfa, 0x14, 0x0e, 0xfd, 0xe4, 0x28, 0xfe, 0xf8, 0x05, 0x0b,
-  0x0a, 0x07, 0x12, 0x26, 0x04, 0xd6, 0xf9, 0xe9, 0xe8, 0x18, 0xe8, 0x06,
-  0x1e, 0x0a, 0xc4, 0xea, 0x10, 0x45, 0x0d, 0xa2, 0xbd, 0xfc, 0x11, 0xf7,
-  0xe1, 0xef, 0x07, 0x11, 0xfa, 0xf6, 0x08, 0x4f, 0x06, 0xf5, 0x05, 0x6d,
-  0x0d, 0xe2, 0xe4, 0xe9, 0x41, 0xf7, 0xfa, 0x2d, 0x01, 0x0a, 0x0e, 0xdf,
-  0xed, 0xc5, 0xe0, 0x0b, 0x18, 0x3b, 0x0d, 0x24, 0xff, 0x0a, 0x11, 0xaa,
-  0xe7, 0xf3, 0x10, 0x20, 0xfe, 0xdc, 0x05, 0x2c, 0x24, 0xef, 0x07, 0xf1,
-  0x26, 0x12, 0xff, 0xff, 0x0b, 0x06, 0x38, 0xf6, 0xf4, 0xf7, 0x02, 0xf0,
-  0x2f, 0x2d, 0x0d, 0xed, 0xd3, 0xf6, 0xed, 0xbd, 0xf7, 0xf7, 0xc4, 0xe9,
-  0x03, 0x29, 0x23, 0xd0, 0xd6, 0x14, 0x07, 0x13, 0xf9, 0xf5, 0x08, 0x5d,
-  0x0f, 0x30, 0xe7, 0x0a, 0x1e, 0x03, 0xd9, 0x08, 0x1a, 0xfd, 0x09, 0x08,
-  0x07, 0xe7, 0x0c, 0x2d, 0x7f, 0x3a, 0x19, 0x18, 0x32, 0x25, 0x04, 0x1c,
-  0x45, 0x7e, 0xf0, 0x21, 0x0f, 0xe6, 0x2b, 0x44, 0x28, 0x2e, 0xe9, 0x01,
-  0x17, 0x02, 0xfb, 0x17, 0x28, 0x48, 0xe5, 0x29, 0xf4, 0xa4, 0x2f, 0x19,
-  0xe2, 0x27, 0xdc, 0xfa, 0x33, 0x11, 0xff, 0x04, 0x01, 0xfa, 0xfb, 0x28,
-  0x28, 0xf4, 0x28, 0x58, 0x1d, 0x1d, 0x0f, 0xfb, 0x75, 0x36, 0x37, 0x08,
-  0x2b, 0x3f, 0xfd, 0x25, 0x43, 0x06, 0x34, 0x35, 0x04, 0x0f, 0xfc, 0x13,
-  0x31, 0x13, 0x2c, 0xf0, 0xff, 0x18, 0xe4, 0xf8, 0x2d, 0xc9, 0x1a, 0x01,
-  0xbb, 0xdd, 0xea, 0x00, 0x14, 0xe0, 0x17, 0x29, 0xe5, 0xff, 0x08, 0xf4,
-  0x0f, 0x13, 0x20, 0x06, 0xe8, 0xd8, 0x23, 0x0d, 0x2f, 0xf8, 0x14, 0x32,
-  0x23, 0x17, 0x0c, 0xf3, 0x20, 0x21, 0x1b, 0x3a, 0xc6, 0xf0, 0x16, 0x1f,
-  0xe7, 0x0f, 0x08, 0xd8, 0xce, 0xb2, 0xd9, 0xc3, 0xc7, 0xf3, 0xf4, 0xe8,
-  0xfd, 0x1d, 0xaa, 0xff, 0xef, 0x1d, 0xea, 0xed, 0x04, 0x00, 0xf6, 0xeb,
-  0x02, 0xf2, 0xf5, 0xbc, 0xe4, 0x1f, 0xeb, 0x96, 0xe3, 0xdf, 0xee, 0x1e,
-  0xfd, 0x10, 0x19, 0x42, 0x53, 0xdf, 0x46, 0x00, 0xf7, 0xec, 0x1d, 0xb8,
-  0xfd, 0x32, 0xf8, 0x15, 0x1b, 0xe1, 0x12, 0x3b, 0xe1, 0xf3, 0x12, 0x19,
-  0x10, 0x12, 0x07, 0x34, 0xef, 0x26, 0xb8, 0x1a, 0xf4, 0x0f, 0x9d, 0xf0,
-  0xf3, 0x05, 0xf4, 0x26, 0xea, 0x17, 0xd9, 0xbd, 0xdf, 0xfa, 0xc4, 0x5b,
-  0xb9, 0x16, 0xb6, 0x31, 0x2b, 0xe5, 0x23, 0x79, 0xff, 0x15, 0xcd, 0xcd,
-  0xe3, 0x21, 0x35, 0x3c, 0xf6, 0x26, 0xd2, 0x0a, 0xbc, 0xed, 0xf3, 0x2b,
-  0xe1, 0xd5, 0x15, 0x73, 0xf7, 0x28, 0x14, 0x08, 0x07, 0x16, 0xe9, 0xff,
-  0x0a, 0x0b, 0xdb, 0x21, 0xf1, 0xed, 0x10, 0x26, 0x00, 0xfb, 0x31, 0x09,
-  0xeb, 0xf9, 0x07, 0x23, 0xfd, 0xe3, 0xe7, 0xf5, 0x0b, 0xe8, 0x25, 0x24,
-  0x09, 0xe5, 0x17, 0xf9, 0x0e, 0xd4, 0x0e, 0xe2, 0x81, 0xcb, 0xcf, 0x01,
-  0xea, 0x13, 0x41, 0x1d, 0x05, 0x06, 0xf7, 0x08, 0x0a, 0xf3, 0xfa, 0xd2,
-  0xf7, 0x10, 0xe1, 0x15, 0x24, 0x24, 0x4a, 0xf8, 0x00, 0x1c, 0xcb, 0x0f,
-  0x00, 0xf9, 0xf4, 0xcb, 0xe4, 0xfa, 0xe9, 0x3d, 0xfd, 0x38, 0x3d, 0xf5,
-  0x15, 0xe6, 0x18, 0xc0, 0xfe, 0xea, 0xfe, 0xde, 0xe9, 0xf4, 0xf2, 0xf7,
-  0x36, 0x1f, 0xc2, 0x05, 0xf2, 0xec, 0x1b, 0xc2, 0xe6, 0x01, 0xfc, 0x0d,
-  0xe4, 0xd7, 0x0f, 0xaf, 0xf4, 0xf5, 0x81, 0x26, 0x23, 0x01, 0x0f, 0xf8,
-  0xc4, 0xe6, 0xe4, 0x21, 0xd7, 0xe3, 0x24, 0xa3, 0x43, 0xf5, 0x99, 0x71,
-  0xea, 0x03, 0xa2, 0x60, 0xaf, 0xfe, 0xd7, 0x11, 0x45, 0xd7, 0x22, 0x1b,
-  0xdb, 0x1b, 0x1b, 0xcc, 0xee, 0xda, 0xfd, 0x1d, 0xf6, 0x0a, 0x04, 0x11,
-  0x25, 0x0e, 0x18, 0x41, 0xe5, 0x06, 0x30, 0xcd, 0x07, 0xa2, 0xf8, 0x14,
-  0x4c, 0x25, 0x09, 0xe6, 0x52, 0x09, 0xf9, 0x07, 0xed, 0x17, 0x18, 0xc6,
-  0xf6, 0xf8, 0x38, 0xe6, 0x1e, 0x0a, 0x31, 0x0a, 0xcb, 0x35, 0x02, 0xe8,
-  0xf0, 0x2d, 0xe2, 0x13, 0xf2, 0xe3, 0x22, 0x09, 0xdb, 0xde, 0xf8, 0xfc,
-  0x06, 0x15, 0x08, 0x2e, 0xf2, 0xfb, 0xe4, 0x38, 0xf8, 0xeb, 0xdb, 0xf0,
-  0x08, 0xfc, 0xf6, 0xf1, 0xf3, 0x10, 0xfd, 0x16, 0x17, 0xf7, 0xf3, 0x1c,
-  0xdc, 0xf9, 0x20, 0xf0, 0xfb, 0x1d, 0x06, 0xde, 0x02, 0x05, 0xe4, 0xee,
-  0xfb, 0x08, 0xee, 0x09, 0x02, 0xe3, 0x50, 0xef, 0x0b, 0x07, 0x07, 0xf6,
-  0x07, 0xf3, 0x05, 0xe6, 0xf8, 0xe5, 0xcb, 0x1d, 0x0c, 0xf9, 0xfc, 0x11,
-  0x1a, 0xec, 0x01, 0x1e, 0xc0, 0xed, 0x00, 0xfd, 0x0c, 0xe9, 0xe0, 0xfc,
-  0xee, 0xfa, 0xda, 0x06, 0xd0, 0xf7, 0x0d, 0x10, 0x04, 0xfc, 0xee, 0x18,
-  0xfe, 0x07, 0xfd, 0xd5, 0x09, 0x08, 0xea, 0xff, 0x7f, 0x35, 0x06, 0x0c,
-  0x2e, 0xca, 0x15, 0x15, 0x11, 0x05, 0x1a, 0xe4, 0x34, 0xff, 0xfc, 0xe5,
-  0x4c, 0xff, 0x02, 0x13, 0x12, 0xd4, 0x0f, 0xdc, 0x15, 0x11, 0x0e, 0xc4,
-  0x14, 0xcc, 0x28, 0xff, 0xe8, 0xe9, 0x17, 0x25, 0x0e, 0xf2, 0x03, 0x05,
-  0xfd, 0xf5, 0x56, 0xe4, 0xe2, 0x20, 0xaa, 0x1c, 0x2b, 0x1e, 0xce, 0x2f,
-  0x01, 0x22, 0xe3, 0x12, 0x0c, 0xdc, 0x01, 0xc1, 0xeb, 0x2f, 0xe3, 0x37,
-  0xf9, 0xea, 0xde, 0x53, 0xd9, 0x24, 0xed, 0xfe, 0x43, 0xd4, 0xfd, 0xe3,
-  0xf5, 0xea, 0xee, 0x20, 0x1d, 0xf4, 0xf6, 0x57, 0x04, 0xe1, 0xda, 0xd7,
-  0x07, 0xd2, 0xec, 0x0d, 0xef, 0x17, 0x13, 0xf6, 0x14, 0x13, 0xec, 0x01,
-  0x34, 0x3c, 0x45, 0x06, 0xdf, 0xbe, 0xe1, 0x0f, 0x39, 0xde, 0x41, 0xc4,
-  0x2a, 0x02, 0x08, 0x0b, 0x2d, 0x48, 0x34, 0xcf, 0x0c, 0xdb, 0x1b, 0xe5,
-  0x18, 0x07, 0x18, 0xef, 0x26, 0xff, 0x26, 0x07, 0x08, 0x18, 0x09, 0xf0,
-  0xc8, 0xcb, 0xbd, 0x66, 0xd6, 0xab, 0x52, 0xf7, 0xfc, 0xc0, 0x16, 0xf8,
-  0xd0, 0x15, 0x11, 0xe5, 0xc2, 0xe8, 0x10, 0x21, 0x37, 0xd3, 0x59, 0x81,
-  0xf6, 0xf0, 0x22, 0xc9, 0x0a, 0x16, 0xec, 0xea, 0xe1, 0xff, 0x55, 0xe1,
-  0x11, 0x07, 0x20, 0xb2, 0xb4, 0xe2, 0x0d, 0xda, 0x07, 0x01, 0xde, 0x53,
-  0xb3, 0xf2, 0xdb, 0xfa, 0x25, 0xfd, 0xb9, 0x37, 0x5a, 0xe5, 0x1d, 0x63,
-  0x15, 0xf4, 0x22, 0xf4, 0x18, 0xfc, 0xdd, 0xd0, 0xff, 0xfb, 0xa9, 0xd0,
-  0x26, 0xda, 0x01, 0x02, 0xe2, 0x17, 0xf9, 0x09, 0xe8, 0xc4, 0x3b, 0x17,
-  0x15, 0x18, 0x2a, 0x18, 0x04, 0xd9, 0xdd, 0xf3, 0xe0, 0x30, 0xf4, 0xdf,
-  0xd2, 0x2a, 0x81, 0xc6, 0xf4, 0x01, 0x28, 0x10, 0xa5, 0xc2, 0xfd, 0x24,
-  0x76, 0xca, 0x10, 0x15, 0x22, 0x25, 0xcb, 0xe6, 0xc7, 0x19, 0xcf, 0xe5,
-  0xf6, 0x9b, 0xf1, 0xea, 0xed, 0x03, 0xf9, 0x2c, 0x0a, 0xf6, 0x1b, 0x55,
-  0x07, 0x04, 0xf5, 0x28, 0xcf, 0xfc, 0xff, 0xd8, 0x2a, 0x4f, 0xea, 0xff,
-  0x06, 0x09, 0xe6, 0xc5, 0xe5, 0x09, 0x05, 0x25, 0x9d, 0xac, 0x0e, 0xf5,
-  0x72, 0xcb, 0x01, 0x2e, 0x07, 0x16, 0x34, 0xf8, 0xf6, 0xc1, 0x15, 0x25,
-  0x18, 0xc2, 0x1c, 0xf6, 0xf4, 0xec, 0xc9, 0xbe, 0x29, 0x0a, 0x0a, 0x3a,
-  0x15, 0xf8, 0x01, 0xeb, 0x18, 0xd0, 0x2f, 0xdb, 0xbd, 0x32, 0xc8, 0xf1,
-  0x8a, 0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00,
+  0x42, 0xe6, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x00, 0x00, 0xaa, 0x42, 0xd5, 0x0a, 0x99, 0x18, 0x58, 0x17,
+  0xc0, 0x2e, 0x1e, 0xd3, 0x1b, 0x14, 0xec, 0xb9, 0xd0, 0x5e, 0x5e, 0xe1,
+  0x22, 0xf4, 0x3d, 0x64, 0xb4, 0xf8, 0x2d, 0x47, 0x35, 0x1c, 0x1f, 0xe6,
+  0xa0, 0x7f, 0x5a, 0x0b, 0x5f, 0xf2, 0x08, 0x2b, 0xf1, 0xe0, 0x30, 0x4b,
+  0xdd, 0x3e, 0xef, 0x35, 0x08, 0x11, 0xf3, 0x0a, 0xec, 0xe3, 0xf5, 0x33,
+  0x18, 0x13, 0x00, 0xe9, 0x0d, 0xaf, 0xc5, 0x09, 0x20, 0x2b, 0x17, 0x17,
+  0x16, 0xd7, 0x23, 0x7f, 0x0b, 0xe9, 0x07, 0x49, 0x14, 0xca, 0xec, 0xb3,
+  0xe1, 0x06, 0x07, 0xec, 0x0e, 0xfa, 0xf8, 0x25, 0x0f, 0xf1, 0x20, 0x31,
+  0xcd, 0x0b, 0xd2, 0xb9, 0x40, 0x1e, 0xba, 0xa2, 0xe8, 0x1f, 0xd9, 0xfc,
+  0xf7, 0xc7, 0xae, 0xa6, 0x1a, 0x82, 0xbe, 0x1e, 0x2f, 0xc9, 0xc2, 0xc6,
+  0x19, 0xc8, 0xdc, 0x13, 0x3e, 0xbc, 0xb6, 0xfb, 0x00, 0x9a, 0xff, 0xdd,
+  0x39, 0xa1, 0x1e, 0xd7, 0xef, 0xd4, 0xbc, 0x08, 0x24, 0xf4, 0xfc, 0x1a,
+  0xd0, 0xa9, 0xb0, 0x02, 0x0c, 0x34, 0xe8, 0xe9, 0xd2, 0xe4, 0xb3, 0x12,
+  0xf6, 0x41, 0x00, 0x08, 0xcb, 0x1d, 0x3d, 0xc5, 0x36, 0xec, 0xe8, 0x33,
+  0x3e, 0x1f, 0xc9, 0xd6, 0x00, 0x07, 0xfe, 0x02, 0xe2, 0xee, 0x07, 0x9e,
+  0xdc, 0xf0, 0x23, 0xd6, 0xad, 0x1d, 0x57, 0xd2, 0x14, 0x08, 0xf7, 0xf5,
+  0x08, 0xd6, 0xf2, 0x43, 0x7f, 0x33, 0xda, 0x4a, 0x2b, 0xda, 0xe0, 0x21,
+  0x44, 0xfb, 0x34, 0x06, 0xb0, 0x5a, 0x36, 0xa1, 0x05, 0xed, 0xcf, 0xe7,
+  0x73, 0xff, 0xe6, 0xef, 0x07, 0xd3, 0x0a, 0x19, 0xca, 0xc9, 0xfe, 0x91,
+  0xa0, 0xc9, 0x6f, 0xb1, 0x89, 0x3d, 0x23, 0xe7, 0x4f, 0x06, 0x0e, 0xf8,
+  0x26, 0xfe, 0xfb, 0x73, 0x3e, 0xd7, 0xc7, 0x49, 0xe8, 0xc7, 0xf3, 0xd4,
+  0xf5, 0xf2, 0x0c, 0x05, 0xb8, 0x2c, 0x11, 0xec, 0xdd, 0xc1, 0xf6, 0xb8,
+  0x3a, 0xee, 0x25, 0x1b, 0xe9, 0xd6, 0xd7, 0x31, 0xf9, 0xe0, 0x00, 0x3f,
+  0xb0, 0x02, 0x2c, 0xd9, 0xb3, 0xfc, 0x14, 0x14, 0xf4, 0x37, 0xd8, 0x08,
+  0x2f, 0x05, 0x19, 0x32, 0xb1, 0xee, 0xcb, 0x1e, 0xdb, 0xed, 0x0a, 0x23,
+  0x00, 0xff, 0x11, 0x16, 0xef, 0x14, 0xed, 0xf4, 0xd0, 0x15, 0x29, 0x07,
+  0x14, 0x08, 0xe9, 0xae, 0xf9, 0x03, 0x25, 0x1b, 0x0a, 0xf5, 0xee, 0x21,
+  0xfc, 0x0e, 0x2c, 0xef, 0x01, 0xce, 0x03, 0x0c, 0xc7, 0x10, 0xfb, 0xfa,
+  0x0a, 0x11, 0xf3, 0x08, 0xa6, 0xdb, 0xfd, 0xb7, 0x18, 0xec, 0x06, 0xf4,
+  0x09, 0xe8, 0xef, 0x00, 0xef, 0xf0, 0x0f, 0x12, 0x57, 0xf7, 0x6a, 0x52,
+  0x24, 0x5b, 0xe5, 0x81, 0x12, 0x18, 0x16, 0x06, 0x0f, 0xf5, 0x18, 0x74,
+  0x30, 0x09, 0x01, 0x08, 0x22, 0xbe, 0x29, 0xf1, 0xf8, 0xf9, 0xee, 0xef,
+  0xf5, 0xff, 0x34, 0xe8, 0xe7, 0xf0, 0xe9, 0xb1, 0x14, 0x18, 0x13, 0xf7,
+  0x31, 0x0e, 0xe5, 0x00, 0xe0, 0xf9, 0xf9, 0xde, 0x2a, 0xe9, 0x00, 0x39,
+  0xfa, 0xeb, 0xef, 0xd8, 0x1b, 0x10, 0xec, 0x2d, 0xf6, 0xee, 0xf0, 0xea,
+  0x0a, 0xf8, 0xdc, 0x0f, 0x01, 0xfd, 0x17, 0x02, 0x0a, 0xd0, 0xe2, 0x05,
+  0x02, 0xfe, 0xe1, 0xc4, 0xdf, 0x0d, 0xd5, 0x16, 0xed, 0x22, 0xe6, 0xe9,
+  0xdc, 0x28, 0xdf, 0xfb, 0x01, 0xfd, 0x01, 0xe6, 0x0f, 0x0f, 0xf0, 0x18,
+  0xf1, 0x23, 0x0f, 0x11, 0x09, 0x1b, 0xeb, 0x25, 0xfb, 0x29, 0x02, 0x05,
+  0x00, 0xfb, 0x39, 0xd7, 0x00, 0x22, 0x22, 0x16, 0xf9, 0x11, 0xf1, 0x20,
+  0x05, 0xf2, 0xef, 0x22, 0xfd, 0xfc, 0xc1, 0x29, 0xec, 0x08, 0xd0, 0xe4,
+  0x0d, 0x1a, 0x00, 0x12, 0x07, 0x03, 0xee, 0x07, 0x60, 0x09, 0x28, 0x01,
+  0xdf, 0x11, 0x07, 0xe7, 0x1f, 0x06, 0xfe, 0xf9, 0xf6, 0x31, 0xd3, 0xe4,
+  0x1b, 0xf3, 0x7f, 0xea, 0xf1, 0x08, 0x0c, 0xf2, 0xfb, 0x0b, 0xed, 0x1b,
+  0x1b, 0x0a, 0xc4, 0x0d, 0xfd, 0xe3, 0xb9, 0xf9, 0x12, 0x02, 0xe0, 0xd6,
+  0x0d, 0x1a, 0x0e, 0xda, 0x19, 0xfe, 0xdf, 0x17, 0x3d, 0x1e, 0xf3, 0xc4,
+  0x12, 0x02, 0xf5, 0xf8, 0x1b, 0x0f, 0x03, 0xbf, 0x08, 0x16, 0xd6, 0xef,
+  0x1d, 0x0e, 0x07, 0xde, 0x12, 0xee, 0xdb, 0x09, 0xd1, 0x09, 0xee, 0xf1,
+  0x11, 0xe6, 0xd2, 0x0a, 0x0d, 0x1d, 0x31, 0xf8, 0xce, 0xe6, 0x45, 0xf0,
+  0xe3, 0xfc, 0xe6, 0xff, 0xf0, 0x04, 0x19, 0xd6, 0x00, 0xe9, 0xc2, 0x19,
+  0xfa, 0xf8, 0xfb, 0x0d, 0x47, 0xfa, 0xb5, 0x13, 0x00, 0x19, 0x1b, 0xc3,
+  0x1a, 0x02, 0x24, 0xfc, 0xec, 0x10, 0xd7, 0xf7, 0x1e, 0xe1, 0xff, 0x09,
+  0x09, 0xf4, 0x3f, 0xf6, 0x0a, 0x26, 0x7f, 0xf6, 0xcb, 0x01, 0x0b, 0xea,
+  0xf0, 0xe8, 0x02, 0x14, 0x3a, 0x23, 0x28, 0xe7, 0xd7, 0xf9, 0xc4, 0x0e,
+  0x12, 0x9e, 0xc3, 0x06, 0x29, 0xc6, 0x9b, 0xd1, 0x10, 0xdc, 0x30, 0xa6,
+  0xf1, 0xef, 0x59, 0x01, 0xf9, 0x29, 0xbf, 0xea, 0xe2, 0xe9, 0xf5, 0xf2,
+  0x18, 0x0d, 0x0f, 0xd9, 0xf5, 0x32, 0x36, 0x2e, 0xe1, 0x35, 0x19, 0x1b,
+  0xc7, 0xdd, 0x25, 0x06, 0x2d, 0x2a, 0xee, 0xf8, 0xdc, 0xf8, 0xc6, 0x00,
+  0x1e, 0xdc, 0xdd, 0x31, 0xf4, 0xfa, 0xc8, 0x97, 0x1c, 0xdd, 0x12, 0xe6,
+  0x08, 0x05, 0x2a, 0xfa, 0x00, 0x42, 0xcb, 0x13, 0xda, 0x17, 0xed, 0xe3,
+  0x18, 0x2e, 0xff, 0xdb, 0x27, 0x30, 0xd4, 0x2d, 0xe5, 0x20, 0xbd, 0x0f,
+  0x0a, 0x17, 0x1f, 0x1e, 0x1c, 0xee, 0x04, 0x02, 0x2a, 0x1a, 0xfd, 0x62,
+  0xae, 0x50, 0xc2, 0xfd, 0xfc, 0x18, 0x03, 0x21, 0x42, 0x1b, 0x5f, 0x14,
+  0x22, 0xe8, 0x0b, 0x45, 0xc8, 0xdc, 0xff, 0xf7, 0xff, 0x02, 0xc6, 0x22,
+  0x28, 0x33, 0x7f, 0x44, 0x23, 0x12, 0xf9, 0x11, 0xfa, 0xd7, 0xd1, 0xf0,
+  0x0d, 0x1f, 0xfb, 0x12, 0x56, 0xf2, 0xe1, 0x14, 0xd2, 0x2b, 0xfb, 0x12,
+  0x1a, 0xfc, 0xfb, 0x0a, 0x13, 0x32, 0xf2, 0x25, 0x70, 0xad, 0xf8, 0x05,
+  0xe3, 0x12, 0xc8, 0xe9, 0xfb, 0x0f, 0x04, 0x04, 0xff, 0x2f, 0xc6, 0x2a,
+  0x29, 0xc7, 0x13, 0x26, 0xde, 0xec, 0x04, 0xbf, 0x10, 0xeb, 0xec, 0xfe,
+  0xfb, 0xf7, 0xf9, 0xed, 0xf6, 0xe1, 0xe6, 0x05, 0xe5, 0x02, 0x10, 0xa4,
+  0x2f, 0x03, 0x06, 0xea, 0xfc, 0x0d, 0xf3, 0xe5, 0x37, 0xeb, 0x06, 0xf4,
+  0x14, 0xdf, 0xe0, 0xdb, 0x2c, 0xe3, 0x1e, 0xfb, 0x15, 0x04, 0xd8, 0x01,
+  0xee, 0xd0, 0x26, 0xeb, 0xcd, 0x1f, 0xea, 0xf8, 0x2d, 0x13, 0xc0, 0xe9,
+  0x26, 0xb1, 0xe8, 0xfe, 0xb6, 0x1d, 0xe8, 0x37, 0xcd, 0x7a, 0x09, 0x11,
+  0x01, 0xf4, 0xf1, 0xe5, 0x25, 0xca, 0x1c, 0x1d, 0xec, 0xe2, 0x10, 0x5b,
+  0xf7, 0x46, 0x10, 0x03, 0x27, 0x09, 0x3c, 0x28, 0x45, 0xd3, 0x14, 0x3b,
+  0xff, 0x20, 0xfc, 0x12, 0xf7, 0x25, 0x04, 0xdc, 0x06, 0xf3, 0xe5, 0x2d,
+  0xde, 0x84, 0xce, 0xd9, 0x9a, 0x24, 0xf5, 0x11, 0xf3, 0x63, 0x5b, 0x26,
+  0x00, 0x28, 0xdc, 0x26, 0xc7, 0x81, 0x04, 0xe7, 0xb8, 0x1b, 0x0f, 0x38,
+  0xe0, 0x1c, 0x38, 0x2d, 0x30, 0x07, 0xee, 0x43, 0x0a, 0xa5, 0xd5, 0xf3,
+  0xcc, 0xf5, 0x42, 0x02, 0x1b, 0x1b, 0xf2, 0xde, 0xea, 0xb4, 0x22, 0x14,
+  0x12, 0xc2, 0xe1, 0xfd, 0x02, 0x1a, 0x17, 0x1f, 0x20, 0x1a, 0x01, 0x0c,
+  0xfc, 0xde, 0xec, 0xe4, 0xd3, 0xa8, 0xff, 0x20, 0xe3, 0x32, 0xf1, 0x06,
+  0xf4, 0xb1, 0xf3, 0x28, 0x41, 0xfe, 0xc9, 0x0f, 0xf4, 0xb0, 0xd0, 0x16,
+  0xcc, 0x54, 0x20, 0xd1, 0xf8, 0xe4, 0xd3, 0xe7, 0xfa, 0xdf, 0x05, 0xef,
+  0x12, 0x18, 0x18, 0x31, 0xf1, 0x26, 0x08, 0x18, 0x00, 0x19, 0x22, 0xf7,
+  0x0c, 0xf1, 0xe7, 0xcb, 0x1a, 0xfe, 0xf4, 0x0b, 0x10, 0x54, 0x3d, 0xfb,
+  0xff, 0x0b, 0xff, 0xf5, 0xee, 0xf9, 0x01, 0xf7, 0x2e, 0x0c, 0xe0, 0x25,
+  0x13, 0x24, 0x13, 0xe5, 0x01, 0xde, 0xdd, 0x0b, 0x07, 0x31, 0xf9, 0x9c,
+  0xf1, 0x19, 0x1b, 0x07, 0xfe, 0x4e, 0x0d, 0xf1, 0x12, 0x1d, 0xf8, 0x0e,
+  0xf1, 0x2f, 0xe2, 0x81, 0x1d, 0x5a, 0x09, 0xdf, 0x3c, 0x5b, 0x3b, 0x03,
+  0x1e, 0x00, 0xcc, 0x37, 0xf9, 0xf0, 0xff, 0x00, 0x1b, 0xf1, 0xf3, 0x17,
+  0x0e, 0x36, 0x0e, 0x0c, 0x35, 0xfb, 0x0a, 0x4a, 0x0c, 0xf2, 0xe7, 0x1a,
+  0xd6, 0x2e, 0xe1, 0x3d, 0xfc, 0x19, 0xd3, 0xfa, 0x29, 0x23, 0x49, 0x47,
+  0x0f, 0xe5, 0x03, 0xf7, 0xde, 0x19, 0xcf, 0x02, 0xe7, 0x38, 0xd2, 0xeb,
+  0xe7, 0xe7, 0x0a, 0x04, 0xea, 0xfc, 0xeb, 0x3e, 0xfc, 0xcc, 0xcf, 0x03,
+  0x00, 0x06, 0xd2, 0x02, 0xf0, 0x17, 0x5a, 0xeb, 0x0f, 0x0b, 0x52, 0x1a,
+  0xff, 0xe8, 0xf1, 0x43, 0x3a, 0xb8, 0xee, 0x0e, 0x1a, 0xf0, 0x37, 0xb5,
+  0xb9, 0x06, 0x62, 0x00, 0x15, 0x0d, 0xfd, 0x66, 0xfd, 0xe2, 0x16, 0x01,
+  0x34, 0xe8, 0xf2, 0xc1, 0x31, 0x3b, 0x05, 0x08, 0xe8, 0x0d, 0xf7, 0x0f,
+  0x04, 0x16, 0x36, 0xd3, 0xa8, 0x24, 0x5e, 0xcc, 0xae, 0x3b, 0x2e, 0xab,
+  0xde, 0x0d, 0xe5, 0x32, 0x0b, 0xa1, 0x08, 0x24, 0xca, 0x38, 0x30, 0xbc,
+  0x81, 0xce, 0x56, 0xb5, 0xc6, 0x02, 0xcf, 0x15, 0x1d, 0x9a, 0x66, 0x4f,
+  0x50, 0xff, 0x0a, 0xba, 0x3b, 0xda, 0xeb, 0x4c, 0xe8, 0x35, 0xb5, 0xd3,
+  0x42, 0xd6, 0x43, 0xee, 0xfc, 0xac, 0x12, 0x14, 0xd8, 0x02, 0x25, 0xfe,
+  0xf7, 0x19, 0x49, 0xcf, 0xef, 0xef, 0x2c, 0xfa, 0xd4, 0x35, 0xfe, 0x22,
+  0xee, 0x10, 0x5c, 0x04, 0xd6, 0x25, 0x19, 0xa2, 0xf2, 0xe2, 0x71, 0x0b,
+  0x4a, 0x2f, 0x4c, 0xfd, 0x0b, 0x23, 0x48, 0x1e, 0xee, 0x23, 0x24, 0x94,
+  0x4a, 0xdd, 0x14, 0x12, 0x2b, 0x07, 0x0e, 0xfe, 0x17, 0xec, 0x0e, 0xdb,
+  0x2b, 0xe8, 0x08, 0x0e, 0xc9, 0xd4, 0x0d, 0x05, 0x2d, 0xf7, 0x2b, 0xd5,
+  0x24, 0x03, 0x07, 0xbf, 0x39, 0xfb, 0x01, 0x09, 0xc4, 0xc6, 0xb3, 0x19,
+  0x19, 0xf4, 0xf0, 0xf7, 0xe6, 0x08, 0x31, 0xdd, 0x28, 0xf4, 0xe8, 0x0d,
+  0xbb, 0x81, 0xdb, 0x19, 0xf9, 0x06, 0x37, 0x1b, 0xce, 0xfc, 0x31, 0x2d,
+  0xfb, 0xdc, 0x03, 0x14, 0xa3, 0xe3, 0xf2, 0x2d, 0xf2, 0xef, 0x47, 0x14,
+  0xc2, 0xf5, 0xf0, 0xfa, 0xfc, 0xe3, 0x05, 0xcc, 0x84, 0xc1, 0xb1, 0xff,
+  0x0f, 0x33, 0xee, 0x25, 0x88, 0xf9, 0xec, 0xd7, 0x23, 0xd6, 0xed, 0xc9,
+  0xaf, 0xd7, 0xe5, 0xf9, 0xeb, 0xf7, 0xb4, 0x14, 0xe8, 0x2b, 0xfe, 0x2a,
+  0x02, 0xff, 0x1a, 0x3b, 0xd4, 0x25, 0xf5, 0x36, 0xd6, 0xb1, 0xc8, 0x3d,
+  0xe1, 0x2c, 0xbd, 0xe1, 0x04, 0x05, 0x2b, 0xe3, 0xe9, 0x0d, 0xee, 0x2e,
+  0xfb, 0xe5, 0xe3, 0x4d, 0xdb, 0x0e, 0xc3, 0xf0, 0x3a, 0x15, 0x10, 0xf1,
+  0xdb, 0x42, 0xe6, 0x08, 0xef, 0xb4, 0x24, 0x32, 0x15, 0xc9, 0xe8, 0x3f,
+  0xd1, 0xe9, 0x20, 0xa1, 0xf1, 0xb5, 0xd6, 0xd4, 0xe0, 0xfb, 0x37, 0x4d,
+  0x4b, 0xe7, 0x3d, 0xf9, 0xee, 0x03, 0x00, 0xb9, 0xf1, 0xc0, 0x10, 0xea,
+  0xe1, 0xfa, 0xb1, 0x21, 0x59, 0xe2, 0xfb, 0x08, 0xf0, 0xf9, 0x13, 0xe4,
+  0xf6, 0xbb, 0x54, 0x81, 0xfb, 0x8d, 0xd9, 0xf5, 0xfd, 0xf8, 0xce, 0x14,
+  0xee, 0x02, 0xe5, 0xd3, 0xd9, 0xee, 0x19, 0xec, 0x15, 0xd9, 0x1c, 0x2a,
+  0x11, 0x21, 0x00, 0xc8, 0xf4, 0x07, 0xe5, 0x28, 0xd4, 0x11, 0x1f, 0x0e,
+  0x19, 0xdd, 0xc4, 0x04, 0x79, 0xdf, 0x0e, 0xf9, 0x16, 0x15, 0x07, 0x13,
+  0xe5, 0xe3, 0x39, 0x01, 0x28, 0xb6, 0x04, 0x18, 0x0d, 0x11, 0x01, 0xf9,
+  0xf3, 0xf6, 0xd1, 0xe3, 0x01, 0xec, 0x27, 0xdc, 0xb6, 0xfc, 0x30, 0x41,
+  0xc9, 0xce, 0x0d, 0xdd, 0xfb, 0x07, 0xf0, 0x64, 0xc4, 0x15, 0xe9, 0xd8,
+  0xe1, 0x02, 0xe9, 0x13, 0xf5, 0x11, 0x10, 0xf4, 0x10, 0x30, 0x18, 0x03,
+  0xd5, 0x11, 0x2a, 0x21, 0x28, 0x10, 0xfd, 0x02, 0xfa, 0xe3, 0xf3, 0x01,
+  0x12, 0x07, 0x12, 0x23, 0x09, 0xcc, 0xe6, 0xec, 0x29, 0x09, 0x05, 0xfc,
+  0x2e, 0xf1, 0xf1, 0xfe, 0x0a, 0x09, 0xfb, 0x05, 0xe5, 0x09, 0xf9, 0xfb,
+  0x01, 0xfb, 0xf5, 0x06, 0x10, 0xfb, 0xe8, 0x0d, 0xe6, 0x0c, 0xd4, 0x06,
+  0xf1, 0x15, 0x28, 0xe3, 0xfa, 0x14, 0x1f, 0x31, 0xc4, 0xd9, 0xed, 0xe1,
+  0x43, 0x0d, 0x19, 0xf9, 0x0a, 0xde, 0x0d, 0xd1, 0x39, 0x14, 0x0f, 0x02,
+  0x19, 0xd2, 0x02, 0x1e, 0x22, 0x03, 0x26, 0xf2, 0xe6, 0xf3, 0xff, 0xdb,
+  0x1e, 0x2d, 0xd1, 0xfe, 0x1c, 0x00, 0x0e, 0x12, 0xf9, 0xf1, 0x02, 0xf4,
+  0xf8, 0xe4, 0xf0, 0x81, 0x04, 0x08, 0x0a, 0x10, 0xe8, 0xce, 0x0a, 0xef,
+  0x19, 0x09, 0x0e, 0xed, 0xec, 0x02, 0x21, 0xf9, 0x07, 0x09, 0x16, 0x19,
+  0xeb, 0xda, 0x14, 0xf8, 0x0d, 0x1a, 0x19, 0xf7, 0xf1, 0x1e, 0x10, 0xf6,
+  0x2c, 0x18, 0xeb, 0x10, 0x07, 0x0b, 0x14, 0x0a, 0xfe, 0xff, 0xeb, 0x13,
+  0xff, 0x03, 0xde, 0xd0, 0x6d, 0x4d, 0x16, 0xf7, 0xc7, 0x0f, 0x3d, 0x11,
+  0x68, 0xe6, 0xc6, 0xfe, 0xf6, 0xc0, 0x96, 0x40, 0x41, 0x1e, 0xf5, 0x0d,
+  0xb7, 0xe5, 0x6e, 0x35, 0x74, 0xf1, 0xc4, 0xe1, 0xc4, 0x17, 0xd0, 0x45,
+  0x41, 0x0a, 0xcd, 0x1d, 0xdf, 0xc6, 0x78, 0x28, 0x7c, 0xec, 0xe0, 0xf4,
+  0xb4, 0xfe, 0xf7, 0x0e, 0x43, 0x1e, 0xfc, 0xe5, 0x4e, 0x49, 0xf1, 0xf2,
+  0x5f, 0xa2, 0xa6, 0xc9, 0xef, 0x0c, 0xf7, 0x25, 0x07, 0xfd, 0x94, 0x37,
+  0x50, 0x1a, 0x49, 0xc6, 0x53, 0xe5, 0xcf, 0xef, 0xde, 0x2b, 0x1b, 0x19,
+  0xf1, 0xe2, 0xd4, 0x59, 0xf1, 0xb9, 0x62, 0xfc, 0x3d, 0x14, 0xe1, 0x2c,
+  0xc2, 0xf3, 0x17, 0x02, 0xdd, 0x22, 0x07, 0xe0, 0x7f, 0x6f, 0x25, 0x27,
+  0x12, 0x92, 0x21, 0xf2, 0x23, 0xeb, 0x08, 0xc5, 0xb2, 0x06, 0x0e, 0x25,
+  0x75, 0xfe, 0x50, 0xf7, 0xd7, 0x03, 0x1b, 0x33, 0xf4, 0xf8, 0x02, 0xed,
+  0xca, 0x0f, 0xcc, 0x6b, 0x91, 0xc7, 0x4f, 0xb5, 0x0c, 0x38, 0xed, 0x03,
+  0xf7, 0xda, 0xf7, 0xd9, 0xe8, 0x10, 0x0d, 0xbe, 0x03, 0xe5, 0xe4, 0xd2,
+  0x10, 0xf6, 0x09, 0x04, 0x25, 0x2f, 0xe7, 0x33, 0x43, 0x01, 0x0b, 0x10,
+  0x38, 0x07, 0xf1, 0xe8, 0x14, 0xea, 0x00, 0x10, 0xfd, 0x13, 0xe3, 0x2e,
+  0xea, 0xed, 0xd2, 0x09, 0xea, 0xf1, 0x01, 0x06, 0xd8, 0xe8, 0x04, 0x05,
+  0x0a, 0xdb, 0x07, 0xd8, 0x81, 0x17, 0xe8, 0xfd, 0x09, 0xea, 0x00, 0x79,
+  0x1f, 0xfb, 0x10, 0xfa, 0xd9, 0xef, 0x02, 0xcc, 0x22, 0x08, 0xeb, 0xec,
+  0xaf, 0x4e, 0xf8, 0xa9, 0xed, 0xe5, 0xed, 0x0b, 0x30, 0x34, 0xf3, 0x46,
+  0x24, 0xfc, 0x20, 0x27, 0x45, 0xfe, 0xf4, 0xfa, 0x09, 0xf5, 0x0e, 0x0f,
+  0xee, 0x05, 0x0b, 0xf8, 0x37, 0x06, 0xf7, 0x0f, 0xff, 0x23, 0xf3, 0xf7,
+  0x11, 0x03, 0xf4, 0xf6, 0x28, 0x1c, 0xf7, 0xca, 0xe7, 0xfd, 0xf7, 0xfd,
+  0xee, 0xd3, 0xe4, 0x34, 0xfe, 0x0c, 0xdd, 0x03, 0xda, 0xd2, 0xd8, 0x04,
+  0x05, 0x0c, 0xfc, 0xf5, 0xf4, 0x15, 0xdc, 0xe1, 0x25, 0x20, 0x02, 0xfa,
+  0x08, 0x04, 0x08, 0x12, 0x21, 0xfc, 0x21, 0x02, 0xee, 0xd1, 0x07, 0x45,
+  0x4b, 0x09, 0xdb, 0xfa, 0xd4, 0x1c, 0x1f, 0xec, 0x23, 0x09, 0xdf, 0x10,
+  0x2c, 0x03, 0xc6, 0xe8, 0x3a, 0x48, 0x06, 0xe7, 0xe6, 0x0f, 0x07, 0x2c,
+  0xbf, 0x28, 0xf5, 0xf6, 0x42, 0x0a, 0xeb, 0xc5, 0xfa, 0x17, 0x1a, 0xfc,
+  0xe6, 0xd7, 0xe7, 0x25, 0x21, 0xee, 0x28, 0x81, 0xdc, 0x00, 0xf4, 0x05,
+  0x2d, 0x51, 0xe2, 0xde, 0xee, 0x1a, 0x21, 0x0f, 0xe8, 0xdb, 0xd6, 0xf1,
+  0x15, 0xdc, 0xd6, 0xd0, 0x1c, 0x4b, 0xed, 0xef, 0xea, 0xd8, 0xed, 0x19,
+  0xd6, 0xe8, 0x1e, 0x2c, 0xed, 0x20, 0x14, 0xd4, 0xd3, 0x13, 0x21, 0x02,
+  0xf6, 0xd3, 0xe4, 0x25, 0xf5, 0xe0, 0xfd, 0x19, 0xde, 0xff, 0xe3, 0xf7,
+  0x12, 0x35, 0xf1, 0xed, 0xf1, 0xdb, 0xf2, 0x01, 0xfe, 0xd4, 0x09, 0x10,
+  0xee, 0xdb, 0xf4, 0x15, 0x1e, 0xff, 0xce, 0x0d, 0xfd, 0xd5, 0xeb, 0x43,
+  0xd9, 0x07, 0x06, 0x16, 0xe4, 0x0a, 0x0b, 0x0f, 0x12, 0x1a, 0x26, 0xf5,
+  0xf5, 0x09, 0x0a, 0x08, 0xfa, 0x11, 0x48, 0x14, 0xff, 0x18, 0xd2, 0x37,
+  0x3a, 0x2a, 0xe1, 0x10, 0xec, 0xcd, 0xee, 0xe8, 0x0b, 0x07, 0x08, 0x3f,
+  0x00, 0xef, 0x02, 0x10, 0x33, 0x47, 0xa3, 0x00, 0x03, 0x0d, 0xe0, 0xfa,
+  0x00, 0xdc, 0xca, 0x12, 0xb8, 0xa2, 0x1b, 0x2d, 0x24, 0x0c, 0xcb, 0x03,
+  0x19, 0x0f, 0xe7, 0x14, 0xf3, 0x1a, 0x5c, 0x27, 0x1f, 0xf6, 0xcd, 0xee,
+  0xe0, 0x2c, 0xb6, 0x7f, 0xd8, 0x1e, 0xbc, 0xf5, 0xc7, 0x33, 0xf2, 0xff,
+  0x3e, 0x0f, 0xef, 0x26, 0x27, 0x29, 0x96, 0x32, 0xeb, 0xf6, 0xc8, 0xf8,
+  0x0e, 0x2a, 0xca, 0xf0, 0xdb, 0x16, 0xf4, 0x14, 0x18, 0x21, 0xd8, 0xd4,
+  0x10, 0xcb, 0x11, 0x1a, 0x1e, 0x17, 0xc9, 0x00, 0xfe, 0x28, 0x08, 0x19,
+  0x09, 0x1f, 0xc4, 0x4b, 0xfa, 0x09, 0xc2, 0x11, 0x14, 0x29, 0xb4, 0x0b,
+  0x3f, 0x5a, 0x08, 0x36, 0x11, 0x03, 0xb1, 0xe1, 0xde, 0x16, 0xcb, 0x0c,
+  0xfe, 0x2d, 0xd4, 0x1f, 0x09, 0x43, 0xea, 0x00, 0xd3, 0x13, 0x04, 0x83,
+  0x06, 0xc6, 0x1b, 0x00, 0x52, 0xef, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x0f, 0x08, 0x03, 0xfc,
+  0xf0, 0x1a, 0x09, 0x3f, 0xf1, 0xfe, 0x02, 0x07, 0x03, 0x16, 0xd3, 0xfe,
+  0x06, 0xec, 0x9e, 0x2b, 0xbe, 0x07, 0x13, 0xab, 0xed, 0xee, 0xd6, 0xa9,
+  0x16, 0xe7, 0xeb, 0x0b, 0xca, 0x17, 0xfb, 0xda, 0x14, 0x07, 0x31, 0x29,
+  0x1f, 0xf4, 0x02, 0xee, 0xc2, 0x01, 0x16, 0xe4, 0xe7, 0xf5, 0x27, 0x43,
+  0x10, 0xf0, 0x1a, 0xee, 0xba, 0x12, 0x00, 0x0f, 0xef, 0x2e, 0xc6, 0xe0,
+  0xe1, 0xb5, 0xf1, 0x38, 0xdf, 0x13, 0x9c, 0x0a, 0xf3, 0x24, 0xae, 0xd2,
+  0xaf, 0xf9, 0xec, 0x40, 0xe6, 0x32, 0x04, 0x85, 0x1a, 0x1c, 0xef, 0xdd,
+  0xda, 0x1f, 0xdf, 0xe7, 0xf9, 0xe8, 0x10, 0x0b, 0x0e, 0x16, 0xf2, 0xec,
+  0x04, 0xa1, 0xf8, 0xd9, 0x17, 0xf4, 0xfa, 0x0e, 0x17, 0xfc, 0xec, 0x03,
+  0x25, 0x02, 0x22, 0xfa, 0xf9, 0xde, 0xde, 0xde, 0xe1, 0x06, 0xf7, 0xfe,
+  0xa7, 0xf5, 0x09, 0x81, 0x55, 0x2f, 0x0b, 0xb1, 0x0d, 0xfa, 0xf6, 0xfc,
+  0xf6, 0xd3, 0x22, 0x07, 0x04, 0xdd, 0x1c, 0xeb, 0x09, 0xec, 0xf3, 0x0b,
+  0x12, 0x40, 0x18, 0x18, 0xbc, 0x12, 0x05, 0xf0, 0x47, 0x00, 0x24, 0x3a,
+  0x16, 0xc9, 0x52, 0x23, 0x48, 0x39, 0xf6, 0x8e, 0xf1, 0x6c, 0x10, 0x4c,
+  0x17, 0x14, 0x12, 0x7c, 0x25, 0x01, 0x3b, 0x41, 0x34, 0x54, 0x12, 0xbb,
+  0x21, 0x4e, 0xf1, 0x6e, 0x01, 0xe4, 0xf3, 0x70, 0x25, 0xdc, 0xf0, 0xc3,
+  0xdd, 0xb0, 0xed, 0x1c, 0xe0, 0xf2, 0x2b, 0xdc, 0xd9, 0xe8, 0x4e, 0xea,
+  0xf3, 0xbc, 0x6a, 0xec, 0x23, 0x81, 0xc8, 0xa3, 0xc1, 0x55, 0x42, 0xe6,
+  0x03, 0x0a, 0x25, 0xd4, 0xe3, 0xce, 0x55, 0x11, 0x1b, 0x03, 0x00, 0x83,
+  0xcd, 0x48, 0x1f, 0xf2, 0x0c, 0xf0, 0xe8, 0x0e, 0x14, 0x13, 0xe2, 0x23,
+  0xc7, 0x0a, 0x03, 0x28, 0x26, 0xcf, 0x1b, 0xe4, 0xe0, 0xc6, 0x27, 0xfa,
+  0x0b, 0x11, 0xe4, 0xfc, 0x13, 0xd6, 0xc1, 0x2c, 0xfb, 0x45, 0x2c, 0xf9,
+  0xe0, 0xe6, 0x06, 0x09, 0xbf, 0xe4, 0xe6, 0xd7, 0x00, 0x06, 0x1b, 0xda,
+  0xca, 0xf6, 0x1c, 0xdd, 0x50, 0xd9, 0xdb, 0x49, 0xdd, 0x45, 0xf2, 0x6a,
+  0xfa, 0x27, 0x56, 0x24, 0x1e, 0xcf, 0xe2, 0x12, 0xef, 0x21, 0x53, 0x1e,
+  0xfd, 0x4f, 0xd8, 0x0c, 0x1a, 0xee, 0x9e, 0xb3, 0x15, 0xe0, 0x15, 0x05,
+  0x25, 0x3f, 0x40, 0x0b, 0xee, 0xde, 0xe4, 0xe0, 0x0a, 0x1d, 0xa3, 0x0d,
+  0x02, 0xf8, 0xc2, 0x26, 0xf6, 0x04, 0x5b, 0xef, 0xf6, 0x23, 0xfa, 0x4e,
+  0xe9, 0x39, 0x0c, 0x09, 0xb7, 0xcc, 0x14, 0x1a, 0xcd, 0x3e, 0x0b, 0x03,
+  0xf4, 0x35, 0xde, 0xef, 0x04, 0x13, 0x81, 0xe4, 0xf3, 0x90, 0x44, 0x0d,
+  0xd3, 0x69, 0x16, 0x7e, 0x09, 0xd0, 0xf7, 0x8a, 0xed, 0x0e, 0xfd, 0x50,
+  0xed, 0x49, 0x38, 0xed, 0xe9, 0x22, 0x43, 0xde, 0x13, 0xf4, 0xf1, 0x08,
+  0xf4, 0x0a, 0xd6, 0xc0, 0xae, 0x15, 0xf4, 0x5e, 0xc4, 0xfa, 0xd2, 0xe4,
+  0xd1, 0x2c, 0xdd, 0xec, 0x09, 0xdc, 0xd3, 0x3d, 0xf8, 0xbf, 0x1d, 0x13,
+  0x0a, 0x1f, 0xef, 0xce, 0xfc, 0xdf, 0xcf, 0xbb, 0xe7, 0x12, 0x0c, 0xf5,
+  0x09, 0x14, 0x39, 0xf1, 0x0f, 0xf5, 0x0e, 0x11, 0x2d, 0x02, 0x88, 0xae,
+  0x17, 0x8b, 0xaa, 0xd7, 0xb8, 0xf5, 0x0f, 0xf7, 0x10, 0x1a, 0x2e, 0xfb,
+  0xad, 0xdb, 0x81, 0x0d, 0x0a, 0xac, 0xc6, 0xa6, 0x32, 0x10, 0x02, 0x2a,
+  0x03, 0x17, 0x2e, 0xb1, 0xd7, 0xe3, 0xe8, 0x58, 0x15, 0xc4, 0xfd, 0x59,
+  0x49, 0x10, 0x08, 0x23, 0x17, 0x37, 0x0b, 0x12, 0x24, 0x04, 0x0e, 0xea,
+  0x0e, 0xb6, 0xcf, 0x31, 0x03, 0x06, 0x02, 0x02, 0x24, 0x1f, 0xfe, 0x13,
+  0xd0, 0xd8, 0x36, 0xe1, 0xea, 0xc7, 0xe0, 0xea, 0x54, 0x46, 0x12, 0x21,
+  0xd3, 0x11, 0x02, 0x17, 0xe2, 0x12, 0x2d, 0x06, 0x34, 0x49, 0x57, 0xcf,
+  0x04, 0x2b, 0x30, 0x35, 0xaf, 0x20, 0xe3, 0x15, 0x23, 0x23, 0x1f, 0xdf,
+  0xe3, 0xe5, 0x1e, 0xf0, 0xfc, 0xf6, 0x10, 0xe6, 0xd7, 0xe1, 0xfc, 0xf3,
+  0xfa, 0x06, 0xe7, 0xf6, 0xe3, 0x0d, 0x0c, 0x00, 0xd5, 0xe6, 0x07, 0x13,
+  0xaf, 0xed, 0xfc, 0x27, 0x01, 0x20, 0xd6, 0x5b, 0x25, 0x36, 0x04, 0x18,
+  0xe7, 0x10, 0x00, 0xf7, 0x12, 0xfc, 0xe4, 0x1f, 0xc9, 0x17, 0xa2, 0x8c,
+  0x2d, 0xe3, 0x8d, 0x11, 0xdc, 0xd4, 0xdf, 0xca, 0xfe, 0xba, 0x30, 0xdd,
+  0x01, 0x03, 0x2f, 0xb6, 0x0a, 0x1e, 0xc9, 0x8f, 0x0f, 0x02, 0x00, 0x07,
+  0x0e, 0xa5, 0x16, 0xa7, 0x2f, 0xa3, 0x2c, 0x62, 0x00, 0x19, 0xdb, 0xaa,
+  0x4f, 0x81, 0x07, 0xcf, 0x0f, 0xcb, 0x21, 0xea, 0xf1, 0x21, 0xc2, 0xff,
+  0x52, 0xd6, 0xfc, 0x17, 0x10, 0xac, 0xea, 0x0f, 0xac, 0xed, 0x19, 0xe5,
+  0xd9, 0x0e, 0xf5, 0x97, 0xea, 0x2e, 0xd7, 0x26, 0xd9, 0x7b, 0x01, 0x23,
+  0x21, 0xb3, 0x05, 0xd1, 0x06, 0xd9, 0x54, 0xee, 0x0a, 0x25, 0x0f, 0xda,
+  0x16, 0xe1, 0x06, 0xe7, 0x50, 0xdd, 0x03, 0xce, 0xf1, 0x3a, 0x08, 0x66,
+  0x33, 0xcf, 0xde, 0xc3, 0x32, 0xaa, 0xdb, 0xdb, 0xbe, 0x11, 0xde, 0xf7,
+  0x0c, 0x3a, 0x0b, 0xde, 0x89, 0x0d, 0xfb, 0x25, 0xec, 0x2b, 0x19, 0x39,
+  0x93, 0xe7, 0xeb, 0x57, 0xe8, 0x01, 0xd9, 0xca, 0xc0, 0xf2, 0x45, 0xf8,
+  0xc9, 0x10, 0x20, 0xec, 0xe5, 0xe4, 0xf5, 0x1e, 0xad, 0xf0, 0x20, 0xe4,
+  0x04, 0x1a, 0x3a, 0x13, 0xea, 0xe7, 0xe4, 0x2d, 0x1a, 0xf4, 0x20, 0x12,
+  0x2f, 0x1a, 0xf6, 0x23, 0xc6, 0xd5, 0xb9, 0xaa, 0xf7, 0x1b, 0x11, 0xf9,
+  0xf1, 0xfa, 0xe6, 0x33, 0x37, 0xdf, 0x07, 0x21, 0xff, 0x10, 0xf7, 0x16,
+  0xe9, 0xd2, 0xf5, 0xcb, 0xe3, 0xfa, 0xff, 0xe9, 0xe7, 0xd3, 0xf0, 0x93,
+  0x08, 0xeb, 0x7f, 0x16, 0xa8, 0xf3, 0xf9, 0x01, 0xf9, 0xe7, 0x23, 0xe2,
+  0xe2, 0xea, 0xe4, 0x00, 0x03, 0xf2, 0x39, 0xdc, 0x09, 0xcf, 0xfb, 0x0e,
+  0xd8, 0xde, 0xd4, 0x38, 0xfa, 0xb4, 0x12, 0x35, 0x0d, 0xe3, 0x01, 0x02,
+  0x10, 0xe5, 0x0b, 0x08, 0x2d, 0xfa, 0xf1, 0x14, 0xdb, 0xf5, 0xf6, 0xca,
+  0xea, 0xf1, 0xee, 0x00, 0xcb, 0x20, 0x09, 0x22, 0xf9, 0xfb, 0x3c, 0x41,
+  0xe1, 0x0b, 0x12, 0xd4, 0x18, 0x1d, 0xe5, 0xdc, 0x0c, 0xff, 0xfb, 0x29,
+  0xcf, 0xee, 0xff, 0xb2, 0xf1, 0xe5, 0xfb, 0xf6, 0x0c, 0x24, 0x1e, 0xe3,
+  0x13, 0xc2, 0x11, 0x4a, 0x3f, 0x02, 0x13, 0x20, 0x7f, 0x4e, 0x17, 0x24,
+  0xdb, 0x3c, 0x62, 0xd0, 0xce, 0x42, 0xf0, 0xee, 0x0a, 0xfd, 0x44, 0x58,
+  0x58, 0x1f, 0xf3, 0x33, 0xff, 0x08, 0x67, 0xe2, 0x07, 0x2f, 0xf0, 0x08,
+  0xfb, 0x27, 0x35, 0xfe, 0x5f, 0x1c, 0xa6, 0xd0, 0xf7, 0x35, 0x0c, 0x05,
+  0xf6, 0x0e, 0xf8, 0xe7, 0x00, 0x06, 0x2d, 0x12, 0xe4, 0x0e, 0x41, 0x26,
+  0xcf, 0xf8, 0x13, 0x3e, 0x42, 0x23, 0xd5, 0xe8, 0xeb, 0x00, 0xd1, 0x0f,
+  0xb6, 0xa8, 0xf5, 0x31, 0xf6, 0xd7, 0x08, 0x53, 0x21, 0xdf, 0xab, 0xec,
+  0xa2, 0x0c, 0xd3, 0xf0, 0x3c, 0xbd, 0xa0, 0xc9, 0xf3, 0xf5, 0x05, 0x2e,
+  0xd8, 0xe9, 0xa3, 0xde, 0xc6, 0x09, 0xed, 0xe5, 0xe0, 0xf8, 0x3d, 0xf2,
+  0xf8, 0x0a, 0xeb, 0x0e, 0x1a, 0x02, 0xcb, 0x26, 0x3a, 0xf1, 0x8e, 0x34,
+  0xae, 0xaf, 0x03, 0xf6, 0x5c, 0x1d, 0x0c, 0xf8, 0x27, 0x97, 0xc2, 0x3b,
+  0xc9, 0xea, 0xac, 0x10, 0xec, 0xbe, 0xc5, 0xbc, 0x50, 0xed, 0xf7, 0xd5,
+  0x16, 0xcf, 0xa5, 0x29, 0xe1, 0xe5, 0xdc, 0xee, 0xf9, 0xfb, 0xd6, 0xf2,
+  0x08, 0xce, 0xfa, 0xd4, 0x10, 0xf0, 0x09, 0xf9, 0xfe, 0x12, 0xfd, 0xdb,
+  0xf1, 0x0f, 0xdd, 0xe0, 0x04, 0xfa, 0x21, 0x5c, 0x08, 0x0f, 0x12, 0x40,
+  0xe2, 0x12, 0x1d, 0xb2, 0xfa, 0xf7, 0xf6, 0x0f, 0xfd, 0x25, 0xdf, 0x04,
+  0xf8, 0xf8, 0x0b, 0x42, 0x24, 0x11, 0x27, 0x01, 0x0f, 0xe9, 0x1f, 0xfe,
+  0xfc, 0x26, 0x81, 0x1a, 0x0e, 0x0f, 0x03, 0xf1, 0xf5, 0x2e, 0xea, 0x5c,
+  0x0c, 0x25, 0x39, 0xd8, 0x0d, 0xd1, 0x0e, 0x40, 0x05, 0x25, 0xfa, 0xe5,
+  0x2f, 0xf4, 0xf4, 0xe2, 0x0c, 0x16, 0x58, 0xce, 0xd4, 0xed, 0x16, 0xec,
+  0x31, 0xd3, 0xe6, 0x17, 0xe6, 0xf6, 0xfe, 0xae, 0x11, 0xe2, 0xe8, 0x48,
+  0x10, 0x37, 0x19, 0xda, 0xf0, 0x05, 0x2f, 0x17, 0xda, 0x21, 0xf3, 0xcf,
+  0xd3, 0x07, 0xdf, 0x3a, 0x1d, 0xfc, 0xf8, 0x13, 0xc6, 0x21, 0x0b, 0xe3,
+  0xed, 0xfc, 0x00, 0x51, 0xef, 0xf7, 0xf7, 0x0e, 0xe2, 0xed, 0x05, 0x20,
+  0x02, 0x09, 0xe8, 0xe0, 0x15, 0xfc, 0xfc, 0x27, 0x39, 0x22, 0x4b, 0xf8,
+  0xea, 0xe2, 0xc8, 0xf4, 0x22, 0x14, 0x0e, 0x07, 0x16, 0x2a, 0xbe, 0x46,
+  0x34, 0xe2, 0xf9, 0x15, 0xd5, 0x2a, 0xe8, 0x0a, 0x0d, 0x27, 0xe1, 0xfb,
+  0xd9, 0xed, 0xbf, 0xd6, 0x1e, 0xbc, 0xa9, 0x92, 0x06, 0x0e, 0x51, 0x25,
+  0xf2, 0xdb, 0xd4, 0xbe, 0xdf, 0xe0, 0xfc, 0x81, 0xfb, 0x34, 0x34, 0x19,
+  0xfd, 0xae, 0xfc, 0x10, 0x0a, 0xfd, 0x14, 0xfa, 0xf3, 0x0d, 0xc8, 0x5a,
+  0x1a, 0xf4, 0xc5, 0x30, 0xf8, 0x02, 0x1d, 0xbe, 0xdf, 0x1a, 0xe6, 0x25,
+  0x16, 0xe4, 0xe9, 0xf2, 0xfb, 0xad, 0xb3, 0xc1, 0x33, 0x0a, 0x25, 0xe0,
+  0xc2, 0xea, 0xd6, 0xf1, 0x09, 0xd7, 0x29, 0x98, 0x00, 0x31, 0x23, 0x0d,
+  0x07, 0x17, 0xe6, 0x3f, 0x37, 0xd9, 0x00, 0xe9, 0xad, 0xff, 0xd1, 0x1d,
+  0xe9, 0xeb, 0xe7, 0x41, 0xf8, 0x33, 0x33, 0xe4, 0x32, 0xe5, 0xec, 0x43,
+  0x23, 0xee, 0x0e, 0xaa, 0xed, 0x8f, 0xdf, 0xd7, 0xf2, 0x32, 0xe0, 0xdd,
+  0xb8, 0xe5, 0xf4, 0x36, 0x04, 0xf4, 0x45, 0xae, 0xe9, 0xf8, 0x2e, 0xde,
+  0xf5, 0x05, 0xd4, 0x40, 0xfd, 0x0b, 0xed, 0x18, 0xfb, 0xfd, 0xfc, 0xdd,
+  0x18, 0x0b, 0xd0, 0xee, 0x2e, 0xf5, 0x16, 0x81, 0xcb, 0xeb, 0xfa, 0x14,
+  0x0e, 0xfd, 0xe4, 0x28, 0xfe, 0xf8, 0x05, 0x0b, 0x0a, 0x07, 0x12, 0x26,
+  0x04, 0xd6, 0xf9, 0xe9, 0xe8, 0x18, 0xe8, 0x06, 0x1e, 0x0a, 0xc4, 0xea,
+  0x10, 0x45, 0x0d, 0xa2, 0xbd, 0xfc, 0x11, 0xf7, 0xe1, 0xef, 0x07, 0x11,
+  0xfa, 0xf6, 0x08, 0x4f, 0x06, 0xf5, 0x05, 0x6d, 0x0d, 0xe2, 0xe4, 0xe9,
+  0x41, 0xf7, 0xfa, 0x2d, 0x01, 0x0a, 0x0e, 0xdf, 0xed, 0xc5, 0xe0, 0x0b,
+  0x18, 0x3b, 0x0d, 0x24, 0xff, 0x0a, 0x11, 0xaa, 0xe7, 0xf3, 0x10, 0x20,
+  0xfe, 0xdc, 0x05, 0x2c, 0x24, 0xef, 0x07, 0xf1, 0x26, 0x12, 0xff, 0xff,
+  0x0b, 0x06, 0x38, 0xf6, 0xf4, 0xf7, 0x02, 0xf0, 0x2f, 0x2d, 0x0d, 0xed,
+  0xd3, 0xf6, 0xed, 0xbd, 0xf7, 0xf7, 0xc4, 0xe9, 0x03, 0x29, 0x23, 0xd0,
+  0xd6, 0x14, 0x07, 0x13, 0xf9, 0xf5, 0x08, 0x5d, 0x0f, 0x30, 0xe7, 0x0a,
+  0x1e, 0x03, 0xd9, 0x08, 0x1a, 0xfd, 0x09, 0x08, 0x07, 0xe7, 0x0c, 0x2d,
+  0x7f, 0x3a, 0x19, 0x18, 0x32, 0x25, 0x04, 0x1c, 0x45, 0x7e, 0xf0, 0x21,
+  0x0f, 0xe6, 0x2b, 0x44, 0x28, 0x2e, 0xe9, 0x01, 0x17, 0x02, 0xfb, 0x17,
+  0x28, 0x48, 0xe5, 0x29, 0xf4, 0xa4, 0x2f, 0x19, 0xe2, 0x27, 0xdc, 0xfa,
+  0x33, 0x11, 0xff, 0x04, 0x01, 0xfa, 0xfb, 0x28, 0x28, 0xf4, 0x28, 0x58,
+  0x1d, 0x1d, 0x0f, 0xfb, 0x75, 0x36, 0x37, 0x08, 0x2b, 0x3f, 0xfd, 0x25,
+  0x43, 0x06, 0x34, 0x35, 0x04, 0x0f, 0xfc, 0x13, 0x31, 0x13, 0x2c, 0xf0,
+  0xff, 0x18, 0xe4, 0xf8, 0x2d, 0xc9, 0x1a, 0x01, 0xbb, 0xdd, 0xea, 0x00,
+  0x14, 0xe0, 0x17, 0x29, 0xe5, 0xff, 0x08, 0xf4, 0x0f, 0x13, 0x20, 0x06,
+  0xe8, 0xd8, 0x23, 0x0d, 0x2f, 0xf8, 0x14, 0x32, 0x23, 0x17, 0x0c, 0xf3,
+  0x20, 0x21, 0x1b, 0x3a, 0xc6, 0xf0, 0x16, 0x1f, 0xe7, 0x0f, 0x08, 0xd8,
+  0xce, 0xb2, 0xd9, 0xc3, 0xc7, 0xf3, 0xf4, 0xe8, 0xfd, 0x1d, 0xaa, 0xff,
+  0xef, 0x1d, 0xea, 0xed, 0x04, 0x00, 0xf6, 0xeb, 0x02, 0xf2, 0xf5, 0xbc,
+  0xe4, 0x1f, 0xeb, 0x96, 0xe3, 0xdf, 0xee, 0x1e, 0xfd, 0x10, 0x19, 0x42,
+  0x53, 0xdf, 0x46, 0x00, 0xf7, 0xec, 0x1d, 0xb8, 0xfd, 0x32, 0xf8, 0x15,
+  0x1b, 0xe1, 0x12, 0x3b, 0xe1, 0xf3, 0x12, 0x19, 0x10, 0x12, 0x07, 0x34,
+  0xef, 0x26, 0xb8, 0x1a, 0xf4, 0x0f, 0x9d, 0xf0, 0xf3, 0x05, 0xf4, 0x26,
+  0xea, 0x17, 0xd9, 0xbd, 0xdf, 0xfa, 0xc4, 0x5b, 0xb9, 0x16, 0xb6, 0x31,
+  0x2b, 0xe5, 0x23, 0x79, 0xff, 0x15, 0xcd, 0xcd, 0xe3, 0x21, 0x35, 0x3c,
+  0xf6, 0x26, 0xd2, 0x0a, 0xbc, 0xed, 0xf3, 0x2b, 0xe1, 0xd5, 0x15, 0x73,
+  0xf7, 0x28, 0x14, 0x08, 0x07, 0x16, 0xe9, 0xff, 0x0a, 0x0b, 0xdb, 0x21,
+  0xf1, 0xed, 0x10, 0x26, 0x00, 0xfb, 0x31, 0x09, 0xeb, 0xf9, 0x07, 0x23,
+  0xfd, 0xe3, 0xe7, 0xf5, 0x0b, 0xe8, 0x25, 0x24, 0x09, 0xe5, 0x17, 0xf9,
+  0x0e, 0xd4, 0x0e, 0xe2, 0x81, 0xcb, 0xcf, 0x01, 0xea, 0x13, 0x41, 0x1d,
+  0x05, 0x06, 0xf7, 0x08, 0x0a, 0xf3, 0xfa, 0xd2, 0xf7, 0x10, 0xe1, 0x15,
+  0x24, 0x24, 0x4a, 0xf8, 0x00, 0x1c, 0xcb, 0x0f, 0x00, 0xf9, 0xf4, 0xcb,
+  0xe4, 0xfa, 0xe9, 0x3d, 0xfd, 0x38, 0x3d, 0xf5, 0x15, 0xe6, 0x18, 0xc0,
+  0xfe, 0xea, 0xfe, 0xde, 0xe9, 0xf4, 0xf2, 0xf7, 0x36, 0x1f, 0xc2, 0x05,
+  0xf2, 0xec, 0x1b, 0xc2, 0xe6, 0x01, 0xfc, 0x0d, 0xe4, 0xd7, 0x0f, 0xaf,
+  0xf4, 0xf5, 0x81, 0x26, 0x23, 0x01, 0x0f, 0xf8, 0xc4, 0xe6, 0xe4, 0x21,
+  0xd7, 0xe3, 0x24, 0xa3, 0x43, 0xf5, 0x99, 0x71, 0xea, 0x03, 0xa2, 0x60,
+  0xaf, 0xfe, 0xd7, 0x11, 0x45, 0xd7, 0x22, 0x1b, 0xdb, 0x1b, 0x1b, 0xcc,
+  0xee, 0xda, 0xfd, 0x1d, 0xf6, 0x0a, 0x04, 0x11, 0x25, 0x0e, 0x18, 0x41,
+  0xe5, 0x06, 0x30, 0xcd, 0x07, 0xa2, 0xf8, 0x14, 0x4c, 0x25, 0x09, 0xe6,
+  0x52, 0x09, 0xf9, 0x07, 0xed, 0x17, 0x18, 0xc6, 0xf6, 0xf8, 0x38, 0xe6,
+  0x1e, 0x0a, 0x31, 0x0a, 0xcb, 0x35, 0x02, 0xe8, 0xf0, 0x2d, 0xe2, 0x13,
+  0xf2, 0xe3, 0x22, 0x09, 0xdb, 0xde, 0xf8, 0xfc, 0x06, 0x15, 0x08, 0x2e,
+  0xf2, 0xfb, 0xe4, 0x38, 0xf8, 0xeb, 0xdb, 0xf0, 0x08, 0xfc, 0xf6, 0xf1,
+  0xf3, 0x10, 0xfd, 0x16, 0x17, 0xf7, 0xf3, 0x1c, 0xdc, 0xf9, 0x20, 0xf0,
+  0xfb, 0x1d, 0x06, 0xde, 0x02, 0x05, 0xe4, 0xee, 0xfb, 0x08, 0xee, 0x09,
+  0x02, 0xe3, 0x50, 0xef, 0x0b, 0x07, 0x07, 0xf6, 0x07, 0xf3, 0x05, 0xe6,
+  0xf8, 0xe5, 0xcb, 0x1d, 0x0c, 0xf9, 0xfc, 0x11, 0x1a, 0xec, 0x01, 0x1e,
+  0xc0, 0xed, 0x00, 0xfd, 0x0c, 0xe9, 0xe0, 0xfc, 0xee, 0xfa, 0xda, 0x06,
+  0xd0, 0xf7, 0x0d, 0x10, 0x04, 0xfc, 0xee, 0x18, 0xfe, 0x07, 0xfd, 0xd5,
+  0x09, 0x08, 0xea, 0xff, 0x7f, 0x35, 0x06, 0x0c, 0x2e, 0xca, 0x15, 0x15,
+  0x11, 0x05, 0x1a, 0xe4, 0x34, 0xff, 0xfc, 0xe5, 0x4c, 0xff, 0x02, 0x13,
+  0x12, 0xd4, 0x0f, 0xdc, 0x15, 0x11, 0x0e, 0xc4, 0x14, 0xcc, 0x28, 0xff,
+  0xe8, 0xe9, 0x17, 0x25, 0x0e, 0xf2, 0x03, 0x05, 0xfd, 0xf5, 0x56, 0xe4,
+  0xe2, 0x20, 0xaa, 0x1c, 0x2b, 0x1e, 0xce, 0x2f, 0x01, 0x22, 0xe3, 0x12,
+  0x0c, 0xdc, 0x01, 0xc1, 0xeb, 0x2f, 0xe3, 0x37, 0xf9, 0xea, 0xde, 0x53,
+  0xd9, 0x24, 0xed, 0xfe, 0x43, 0xd4, 0xfd, 0xe3, 0xf5, 0xea, 0xee, 0x20,
+  0x1d, 0xf4, 0xf6, 0x57, 0x04, 0xe1, 0xda, 0xd7, 0x07, 0xd2, 0xec, 0x0d,
+  0xef, 0x17, 0x13, 0xf6, 0x14, 0x13, 0xec, 0x01, 0x34, 0x3c, 0x45, 0x06,
+  0xdf, 0xbe, 0xe1, 0x0f, 0x39, 0xde, 0x41, 0xc4, 0x2a, 0x02, 0x08, 0x0b,
+  0x2d, 0x48, 0x34, 0xcf, 0x0c, 0xdb, 0x1b, 0xe5, 0x18, 0x07, 0x18, 0xef,
+  0x26, 0xff, 0x26, 0x07, 0x08, 0x18, 0x09, 0xf0, 0xc8, 0xcb, 0xbd, 0x66,
+  0xd6, 0xab, 0x52, 0xf7, 0xfc, 0xc0, 0x16, 0xf8, 0xd0, 0x15, 0x11, 0xe5,
+  0xc2, 0xe8, 0x10, 0x21, 0x37, 0xd3, 0x59, 0x81, 0xf6, 0xf0, 0x22, 0xc9,
+  0x0a, 0x16, 0xec, 0xea, 0xe1, 0xff, 0x55, 0xe1, 0x11, 0x07, 0x20, 0xb2,
+  0xb4, 0xe2, 0x0d, 0xda, 0x07, 0x01, 0xde, 0x53, 0xb3, 0xf2, 0xdb, 0xfa,
+  0x25, 0xfd, 0xb9, 0x37, 0x5a, 0xe5, 0x1d, 0x63, 0x15, 0xf4, 0x22, 0xf4,
+  0x18, 0xfc, 0xdd, 0xd0, 0xff, 0xfb, 0xa9, 0xd0, 0x26, 0xda, 0x01, 0x02,
+  0xe2, 0x17, 0xf9, 0x09, 0xe8, 0xc4, 0x3b, 0x17, 0x15, 0x18, 0x2a, 0x18,
+  0x04, 0xd9, 0xdd, 0xf3, 0xe0, 0x30, 0xf4, 0xdf, 0xd2, 0x2a, 0x81, 0xc6,
+  0xf4, 0x01, 0x28, 0x10, 0xa5, 0xc2, 0xfd, 0x24, 0x76, 0xca, 0x10, 0x15,
+  0x22, 0x25, 0xcb, 0xe6, 0xc7, 0x19, 0xcf, 0xe5, 0xf6, 0x9b, 0xf1, 0xea,
+  0xed, 0x03, 0xf9, 0x2c, 0x0a, 0xf6, 0x1b, 0x55, 0x07, 0x04, 0xf5, 0x28,
+  0xcf, 0xfc, 0xff, 0xd8, 0x2a, 0x4f, 0xea, 0xff, 0x06, 0x09, 0xe6, 0xc5,
+  0xe5, 0x09, 0x05, 0x25, 0x9d, 0xac, 0x0e, 0xf5, 0x72, 0xcb, 0x01, 0x2e,
+  0x07, 0x16, 0x34, 0xf8, 0xf6, 0xc1, 0x15, 0x25, 0x18, 0xc2, 0x1c, 0xf6,
+  0xf4, 0xec, 0xc9, 0xbe, 0x29, 0x0a, 0x0a, 0x3a, 0x15, 0xf8, 0x01, 0xeb,
+  0x18, 0xd0, 0x2f, 0xdb, 0xbd, 0x32, 0xc8, 0xf1, 0x62, 0xf8, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00,
   0x19, 0x21, 0xd1, 0x15, 0xf0, 0xc4, 0x4b, 0x11, 0x9a, 0xa7, 0xf6, 0x4b,
   0xf9, 0x28, 0xf4, 0xec, 0xd7, 0xed, 0xae, 0xff, 0x08, 0x26, 0x3a, 0x7f,
   0xa8, 0xe8, 0x2c, 0xf3, 0x18, 0xa3, 0x4a, 0xc0, 0xf5, 0x28, 0xa5, 0xec,
@@ -6506,84 +6511,85 @@ unsigned char pretrainedResnet_quant_tflite[] = {
   0xd7, 0x21, 0xe6, 0x1c, 0x2e, 0xf7, 0x64, 0x0e, 0x81, 0x60, 0xdc, 0x1e,
   0xfc, 0x86, 0xcc, 0x0a, 0xe4, 0x7f, 0xff, 0x1d, 0xb9, 0x0e, 0x56, 0xf0,
   0x99, 0x09, 0x0a, 0x11, 0xf9, 0xc7, 0x06, 0x5f, 0xde, 0xbc, 0x04, 0x3b,
-  0x46, 0xfa, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00,
-  0x1f, 0xe6, 0x28, 0x23, 0x10, 0xb8, 0xf8, 0xf5, 0xd3, 0x0d, 0x17, 0xe0,
-  0xef, 0xf9, 0xff, 0xe7, 0x12, 0xc0, 0xe8, 0x18, 0xfc, 0xed, 0x14, 0xe7,
-  0x0e, 0x07, 0x0f, 0xda, 0xd2, 0x14, 0x0a, 0x44, 0xc4, 0xb9, 0x20, 0x14,
-  0x34, 0xc5, 0xc8, 0xe4, 0x20, 0x26, 0xe5, 0xab, 0xe9, 0x0b, 0xcf, 0x15,
-  0xaf, 0x04, 0xdf, 0x33, 0xd0, 0xfb, 0xd6, 0x28, 0x3a, 0xe1, 0x18, 0xc9,
-  0x05, 0x05, 0x03, 0x1a, 0xb7, 0xda, 0xdd, 0xe0, 0x05, 0x14, 0x15, 0xfc,
-  0xdf, 0xf6, 0xef, 0x24, 0x36, 0xe8, 0x1b, 0xe0, 0x0a, 0x29, 0xcf, 0x0a,
-  0x27, 0xe4, 0xe0, 0x13, 0xfd, 0x13, 0x35, 0xed, 0xc9, 0xd6, 0xd8, 0x0c,
-  0xf8, 0xc6, 0xfe, 0x09, 0xed, 0xd9, 0xfa, 0xa9, 0x24, 0xdd, 0x0e, 0x06,
-  0x26, 0x00, 0x12, 0xde, 0x00, 0xe2, 0x57, 0xf8, 0x13, 0xd5, 0xe2, 0xce,
-  0xbe, 0x10, 0x14, 0x4e, 0xf0, 0x13, 0x40, 0xe3, 0x2e, 0x1d, 0x39, 0xff,
-  0xcc, 0xda, 0x1d, 0xb0, 0x14, 0x45, 0xfb, 0xdf, 0x23, 0x12, 0xc7, 0xec,
-  0x0c, 0xdf, 0x14, 0xfc, 0xbc, 0xea, 0x1e, 0x1f, 0xea, 0xd6, 0xea, 0x6d,
-  0xdf, 0xe1, 0xcc, 0xdf, 0xe7, 0xf4, 0xfd, 0x7d, 0x0f, 0x1c, 0x3b, 0x03,
-  0x0c, 0x46, 0x08, 0x24, 0xe4, 0xe6, 0xba, 0x1b, 0x0c, 0x0f, 0xd0, 0xba,
-  0xf7, 0xb1, 0xf3, 0x00, 0xf9, 0xe2, 0xb6, 0xed, 0xe7, 0x0a, 0x00, 0x3a,
-  0xfa, 0xfb, 0x0d, 0x0c, 0xcc, 0xe5, 0xc9, 0x10, 0xc6, 0xe8, 0x08, 0xfb,
-  0xf5, 0x25, 0x0d, 0x1b, 0xeb, 0xf4, 0x04, 0xf9, 0xe2, 0x14, 0xf0, 0x04,
-  0xf3, 0x1c, 0xc3, 0xda, 0xe4, 0xf9, 0x22, 0xd8, 0x16, 0x04, 0xe0, 0xee,
-  0x17, 0x0a, 0xf7, 0x0b, 0xf8, 0xd2, 0xfb, 0x3c, 0xe6, 0x1b, 0x03, 0x14,
-  0x04, 0xe6, 0xf9, 0xe3, 0xe8, 0x4f, 0x7f, 0xd9, 0x03, 0x22, 0xf1, 0xe5,
-  0xd9, 0x1c, 0x2f, 0xf0, 0xe8, 0x17, 0xf3, 0xd1, 0x01, 0xbb, 0xd9, 0x04,
-  0x30, 0x00, 0xed, 0xbf, 0x2a, 0x15, 0xcf, 0x02, 0x0a, 0x5e, 0x08, 0xfb,
-  0xd7, 0xe3, 0x03, 0xd6, 0xba, 0x2b, 0xcb, 0xc1, 0xf7, 0x41, 0x28, 0x21,
-  0xcc, 0x05, 0xf8, 0xed, 0xe6, 0xbb, 0x00, 0x16, 0xdc, 0xfc, 0x31, 0xf1,
-  0xd4, 0xf2, 0x2c, 0xce, 0x0a, 0x11, 0xe9, 0x43, 0x35, 0xc1, 0xcf, 0x72,
-  0x07, 0xf9, 0xe7, 0xeb, 0x06, 0x02, 0x15, 0xdb, 0xd1, 0xe8, 0xe6, 0xe1,
-  0xe7, 0x5c, 0xca, 0x25, 0xec, 0xd2, 0x1c, 0x03, 0xef, 0xdc, 0x08, 0x19,
-  0x06, 0x11, 0x1c, 0xd0, 0x16, 0x35, 0xe3, 0x21, 0xdf, 0xfd, 0xbc, 0x49,
-  0xf9, 0xdc, 0xe3, 0xd2, 0x4e, 0x14, 0xf7, 0xe1, 0xf1, 0x18, 0xee, 0x11,
-  0xf3, 0x0d, 0xd5, 0x05, 0xd5, 0x09, 0x05, 0xe0, 0x07, 0x15, 0xfd, 0xfc,
-  0xff, 0x1f, 0xc2, 0xfd, 0x10, 0x0a, 0x2c, 0xf7, 0xd6, 0x02, 0xdb, 0x13,
-  0xff, 0x1a, 0x0d, 0xec, 0xfe, 0x2a, 0x59, 0xfa, 0xdd, 0xf1, 0x12, 0xf8,
-  0xb8, 0xcb, 0x25, 0xd7, 0x1d, 0xdd, 0x26, 0xa9, 0xdd, 0x13, 0x13, 0xc6,
-  0x3e, 0x0d, 0x35, 0xdc, 0x36, 0x10, 0x3f, 0xce, 0xdf, 0x10, 0x12, 0xe3,
-  0xb7, 0xd6, 0x19, 0x09, 0xbf, 0xe8, 0x17, 0xe9, 0x1a, 0xe7, 0x12, 0x37,
-  0x05, 0xe8, 0x07, 0xbb, 0xce, 0xd5, 0xf8, 0xd4, 0xfc, 0xfa, 0xd1, 0x38,
-  0xf8, 0x09, 0xd2, 0xe4, 0x01, 0x22, 0xef, 0xfc, 0x2a, 0xb8, 0xb6, 0x0e,
-  0x3f, 0xd7, 0x0b, 0xcd, 0xcf, 0xf6, 0xcf, 0x20, 0x12, 0x13, 0xd2, 0x06,
-  0x38, 0xb5, 0x08, 0x02, 0x02, 0xf0, 0xc1, 0xb9, 0x6b, 0xf3, 0xe7, 0x23,
-  0xf0, 0x01, 0xe6, 0xca, 0x1a, 0x2e, 0xee, 0x0e, 0xef, 0x37, 0xb8, 0xc5,
-  0x21, 0xf2, 0xfd, 0xdf, 0x0c, 0xf9, 0x4d, 0xe2, 0xe9, 0x3c, 0xc9, 0xc9,
-  0xde, 0x19, 0x07, 0x07, 0x31, 0xd4, 0xf6, 0xc7, 0x22, 0xe2, 0xf1, 0x29,
-  0x21, 0x36, 0x42, 0xe2, 0xfd, 0x24, 0xb1, 0xdd, 0x0e, 0x05, 0x13, 0xbb,
-  0xc0, 0xaf, 0xe5, 0x17, 0x28, 0xf0, 0xaf, 0xe8, 0x18, 0xdb, 0x17, 0xdd,
-  0xcd, 0x0e, 0xc1, 0xf1, 0x36, 0x19, 0x30, 0xd3, 0xd3, 0x2d, 0xcd, 0xef,
-  0x08, 0xbc, 0x0a, 0xea, 0x15, 0x3f, 0x2c, 0xde, 0x05, 0x25, 0xfa, 0xfa,
-  0xf7, 0x12, 0x12, 0xf5, 0xcc, 0xb4, 0xc7, 0xb5, 0x23, 0xf4, 0x1d, 0x1b,
-  0x3c, 0xec, 0xd1, 0x05, 0x1f, 0xf4, 0xe5, 0x0d, 0x05, 0x01, 0xe0, 0x49,
-  0x0d, 0x03, 0x1c, 0xee, 0xdb, 0xe8, 0xc7, 0x0b, 0x02, 0x2c, 0x32, 0x09,
-  0x1f, 0xb8, 0x0e, 0xec, 0xdc, 0x0c, 0xe5, 0xe2, 0xe0, 0x2b, 0xe9, 0xf0,
-  0x1c, 0xf5, 0x0c, 0xc1, 0x14, 0xd2, 0x13, 0xe5, 0x20, 0xe6, 0xf5, 0xe9,
-  0xe0, 0xd6, 0xaa, 0x0b, 0x36, 0xdf, 0xf4, 0xfa, 0xf8, 0x11, 0x27, 0x09,
-  0x21, 0xcb, 0xa5, 0xe4, 0xd2, 0xfc, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x51, 0x47, 0x00, 0x00, 0xc1, 0x85, 0x00, 0x00,
-  0x98, 0x5e, 0x00, 0x00, 0xba, 0xc9, 0xff, 0xff, 0x28, 0xf6, 0xff, 0xff,
-  0x48, 0x22, 0x00, 0x00, 0xe3, 0x4e, 0x00, 0x00, 0x68, 0x53, 0xff, 0xff,
-  0xa2, 0x16, 0x00, 0x00, 0x4d, 0x1c, 0x00, 0x00, 0x23, 0x7a, 0x00, 0x00,
-  0x9a, 0xef, 0xff, 0xff, 0x4d, 0x2c, 0x00, 0x00, 0x4a, 0x12, 0x00, 0x00,
-  0x69, 0x1d, 0x00, 0x00, 0x6f, 0x91, 0x00, 0x00, 0xb7, 0xfe, 0xff, 0xff,
-  0xaf, 0xd2, 0xff, 0xff, 0x3a, 0x11, 0x00, 0x00, 0x1e, 0x56, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x91, 0x54, 0x00, 0x00, 0x9a, 0xb8, 0xff, 0xff,
-  0xe1, 0xae, 0xff, 0xff, 0xb1, 0x61, 0x00, 0x00, 0xbf, 0x45, 0x00, 0x00,
-  0xbd, 0x1a, 0x00, 0x00, 0xc6, 0x56, 0x00, 0x00, 0x0f, 0xcd, 0xff, 0xff,
-  0xff, 0xac, 0xff, 0xff, 0x30, 0xd8, 0xff, 0xff, 0x35, 0x4c, 0xff, 0xff,
-  0xcd, 0x89, 0xff, 0xff, 0x02, 0xfe, 0xff, 0xff, 0x09, 0x41, 0x00, 0x00,
-  0x80, 0x9c, 0xff, 0xff, 0x4d, 0x64, 0x00, 0x00, 0x11, 0x51, 0xff, 0xff,
-  0xd1, 0xeb, 0xff, 0xff, 0xdf, 0xaa, 0x00, 0x00, 0x75, 0x1f, 0x00, 0x00,
-  0x97, 0x89, 0x00, 0x00, 0xcb, 0x5f, 0x00, 0x00, 0x92, 0xe3, 0xff, 0xff,
-  0x0b, 0xf2, 0xff, 0xff, 0x99, 0xe5, 0xff, 0xff, 0x78, 0x76, 0x00, 0x00,
-  0xfa, 0x06, 0x00, 0x00, 0x7e, 0xa6, 0xff, 0xff, 0x80, 0xf8, 0xff, 0xff,
-  0x04, 0x2c, 0x00, 0x00, 0xa6, 0x3e, 0x00, 0x00, 0x03, 0xb8, 0xff, 0xff,
-  0xff, 0xdc, 0xff, 0xff, 0xd7, 0xc8, 0xff, 0xff, 0x0a, 0x5b, 0x00, 0x00,
-  0xad, 0x9c, 0xff, 0xff, 0xf8, 0x45, 0x00, 0x00, 0xd4, 0xb8, 0xff, 0xff,
-  0xc7, 0x42, 0x00, 0x00, 0x7a, 0xdf, 0xff, 0xff, 0xe3, 0x3f, 0xff, 0xff,
-  0x62, 0x2f, 0x00, 0x00, 0xd5, 0x6f, 0x00, 0x00, 0xde, 0xfd, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xc4, 0x29, 0x00, 0x00,
+  0x22, 0xfa, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x02, 0x00, 0x00, 0x1f, 0xe6, 0x28, 0x23, 0x10, 0xb8, 0xf8, 0xf5,
+  0xd3, 0x0d, 0x17, 0xe0, 0xef, 0xf9, 0xff, 0xe7, 0x12, 0xc0, 0xe8, 0x18,
+  0xfc, 0xed, 0x14, 0xe7, 0x0e, 0x07, 0x0f, 0xda, 0xd2, 0x14, 0x0a, 0x44,
+  0xc4, 0xb9, 0x20, 0x14, 0x34, 0xc5, 0xc8, 0xe4, 0x20, 0x26, 0xe5, 0xab,
+  0xe9, 0x0b, 0xcf, 0x15, 0xaf, 0x04, 0xdf, 0x33, 0xd0, 0xfb, 0xd6, 0x28,
+  0x3a, 0xe1, 0x18, 0xc9, 0x05, 0x05, 0x03, 0x1a, 0xb7, 0xda, 0xdd, 0xe0,
+  0x05, 0x14, 0x15, 0xfc, 0xdf, 0xf6, 0xef, 0x24, 0x36, 0xe8, 0x1b, 0xe0,
+  0x0a, 0x29, 0xcf, 0x0a, 0x27, 0xe4, 0xe0, 0x13, 0xfd, 0x13, 0x35, 0xed,
+  0xc9, 0xd6, 0xd8, 0x0c, 0xf8, 0xc6, 0xfe, 0x09, 0xed, 0xd9, 0xfa, 0xa9,
+  0x24, 0xdd, 0x0e, 0x06, 0x26, 0x00, 0x12, 0xde, 0x00, 0xe2, 0x57, 0xf8,
+  0x13, 0xd5, 0xe2, 0xce, 0xbe, 0x10, 0x14, 0x4e, 0xf0, 0x13, 0x40, 0xe3,
+  0x2e, 0x1d, 0x39, 0xff, 0xcc, 0xda, 0x1d, 0xb0, 0x14, 0x45, 0xfb, 0xdf,
+  0x23, 0x12, 0xc7, 0xec, 0x0c, 0xdf, 0x14, 0xfc, 0xbc, 0xea, 0x1e, 0x1f,
+  0xea, 0xd6, 0xea, 0x6d, 0xdf, 0xe1, 0xcc, 0xdf, 0xe7, 0xf4, 0xfd, 0x7d,
+  0x0f, 0x1c, 0x3b, 0x03, 0x0c, 0x46, 0x08, 0x24, 0xe4, 0xe6, 0xba, 0x1b,
+  0x0c, 0x0f, 0xd0, 0xba, 0xf7, 0xb1, 0xf3, 0x00, 0xf9, 0xe2, 0xb6, 0xed,
+  0xe7, 0x0a, 0x00, 0x3a, 0xfa, 0xfb, 0x0d, 0x0c, 0xcc, 0xe5, 0xc9, 0x10,
+  0xc6, 0xe8, 0x08, 0xfb, 0xf5, 0x25, 0x0d, 0x1b, 0xeb, 0xf4, 0x04, 0xf9,
+  0xe2, 0x14, 0xf0, 0x04, 0xf3, 0x1c, 0xc3, 0xda, 0xe4, 0xf9, 0x22, 0xd8,
+  0x16, 0x04, 0xe0, 0xee, 0x17, 0x0a, 0xf7, 0x0b, 0xf8, 0xd2, 0xfb, 0x3c,
+  0xe6, 0x1b, 0x03, 0x14, 0x04, 0xe6, 0xf9, 0xe3, 0xe8, 0x4f, 0x7f, 0xd9,
+  0x03, 0x22, 0xf1, 0xe5, 0xd9, 0x1c, 0x2f, 0xf0, 0xe8, 0x17, 0xf3, 0xd1,
+  0x01, 0xbb, 0xd9, 0x04, 0x30, 0x00, 0xed, 0xbf, 0x2a, 0x15, 0xcf, 0x02,
+  0x0a, 0x5e, 0x08, 0xfb, 0xd7, 0xe3, 0x03, 0xd6, 0xba, 0x2b, 0xcb, 0xc1,
+  0xf7, 0x41, 0x28, 0x21, 0xcc, 0x05, 0xf8, 0xed, 0xe6, 0xbb, 0x00, 0x16,
+  0xdc, 0xfc, 0x31, 0xf1, 0xd4, 0xf2, 0x2c, 0xce, 0x0a, 0x11, 0xe9, 0x43,
+  0x35, 0xc1, 0xcf, 0x72, 0x07, 0xf9, 0xe7, 0xeb, 0x06, 0x02, 0x15, 0xdb,
+  0xd1, 0xe8, 0xe6, 0xe1, 0xe7, 0x5c, 0xca, 0x25, 0xec, 0xd2, 0x1c, 0x03,
+  0xef, 0xdc, 0x08, 0x19, 0x06, 0x11, 0x1c, 0xd0, 0x16, 0x35, 0xe3, 0x21,
+  0xdf, 0xfd, 0xbc, 0x49, 0xf9, 0xdc, 0xe3, 0xd2, 0x4e, 0x14, 0xf7, 0xe1,
+  0xf1, 0x18, 0xee, 0x11, 0xf3, 0x0d, 0xd5, 0x05, 0xd5, 0x09, 0x05, 0xe0,
+  0x07, 0x15, 0xfd, 0xfc, 0xff, 0x1f, 0xc2, 0xfd, 0x10, 0x0a, 0x2c, 0xf7,
+  0xd6, 0x02, 0xdb, 0x13, 0xff, 0x1a, 0x0d, 0xec, 0xfe, 0x2a, 0x59, 0xfa,
+  0xdd, 0xf1, 0x12, 0xf8, 0xb8, 0xcb, 0x25, 0xd7, 0x1d, 0xdd, 0x26, 0xa9,
+  0xdd, 0x13, 0x13, 0xc6, 0x3e, 0x0d, 0x35, 0xdc, 0x36, 0x10, 0x3f, 0xce,
+  0xdf, 0x10, 0x12, 0xe3, 0xb7, 0xd6, 0x19, 0x09, 0xbf, 0xe8, 0x17, 0xe9,
+  0x1a, 0xe7, 0x12, 0x37, 0x05, 0xe8, 0x07, 0xbb, 0xce, 0xd5, 0xf8, 0xd4,
+  0xfc, 0xfa, 0xd1, 0x38, 0xf8, 0x09, 0xd2, 0xe4, 0x01, 0x22, 0xef, 0xfc,
+  0x2a, 0xb8, 0xb6, 0x0e, 0x3f, 0xd7, 0x0b, 0xcd, 0xcf, 0xf6, 0xcf, 0x20,
+  0x12, 0x13, 0xd2, 0x06, 0x38, 0xb5, 0x08, 0x02, 0x02, 0xf0, 0xc1, 0xb9,
+  0x6b, 0xf3, 0xe7, 0x23, 0xf0, 0x01, 0xe6, 0xca, 0x1a, 0x2e, 0xee, 0x0e,
+  0xef, 0x37, 0xb8, 0xc5, 0x21, 0xf2, 0xfd, 0xdf, 0x0c, 0xf9, 0x4d, 0xe2,
+  0xe9, 0x3c, 0xc9, 0xc9, 0xde, 0x19, 0x07, 0x07, 0x31, 0xd4, 0xf6, 0xc7,
+  0x22, 0xe2, 0xf1, 0x29, 0x21, 0x36, 0x42, 0xe2, 0xfd, 0x24, 0xb1, 0xdd,
+  0x0e, 0x05, 0x13, 0xbb, 0xc0, 0xaf, 0xe5, 0x17, 0x28, 0xf0, 0xaf, 0xe8,
+  0x18, 0xdb, 0x17, 0xdd, 0xcd, 0x0e, 0xc1, 0xf1, 0x36, 0x19, 0x30, 0xd3,
+  0xd3, 0x2d, 0xcd, 0xef, 0x08, 0xbc, 0x0a, 0xea, 0x15, 0x3f, 0x2c, 0xde,
+  0x05, 0x25, 0xfa, 0xfa, 0xf7, 0x12, 0x12, 0xf5, 0xcc, 0xb4, 0xc7, 0xb5,
+  0x23, 0xf4, 0x1d, 0x1b, 0x3c, 0xec, 0xd1, 0x05, 0x1f, 0xf4, 0xe5, 0x0d,
+  0x05, 0x01, 0xe0, 0x49, 0x0d, 0x03, 0x1c, 0xee, 0xdb, 0xe8, 0xc7, 0x0b,
+  0x02, 0x2c, 0x32, 0x09, 0x1f, 0xb8, 0x0e, 0xec, 0xdc, 0x0c, 0xe5, 0xe2,
+  0xe0, 0x2b, 0xe9, 0xf0, 0x1c, 0xf5, 0x0c, 0xc1, 0x14, 0xd2, 0x13, 0xe5,
+  0x20, 0xe6, 0xf5, 0xe9, 0xe0, 0xd6, 0xaa, 0x0b, 0x36, 0xdf, 0xf4, 0xfa,
+  0xf8, 0x11, 0x27, 0x09, 0x21, 0xcb, 0xa5, 0xe4, 0xb2, 0xfc, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x51, 0x47, 0x00, 0x00, 0xc1, 0x85, 0x00, 0x00, 0x98, 0x5e, 0x00, 0x00,
+  0xba, 0xc9, 0xff, 0xff, 0x28, 0xf6, 0xff, 0xff, 0x48, 0x22, 0x00, 0x00,
+  0xe3, 0x4e, 0x00, 0x00, 0x68, 0x53, 0xff, 0xff, 0xa2, 0x16, 0x00, 0x00,
+  0x4d, 0x1c, 0x00, 0x00, 0x23, 0x7a, 0x00, 0x00, 0x9a, 0xef, 0xff, 0xff,
+  0x4d, 0x2c, 0x00, 0x00, 0x4a, 0x12, 0x00, 0x00, 0x69, 0x1d, 0x00, 0x00,
+  0x6f, 0x91, 0x00, 0x00, 0xb7, 0xfe, 0xff, 0xff, 0xaf, 0xd2, 0xff, 0xff,
+  0x3a, 0x11, 0x00, 0x00, 0x1e, 0x56, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x91, 0x54, 0x00, 0x00, 0x9a, 0xb8, 0xff, 0xff, 0xe1, 0xae, 0xff, 0xff,
+  0xb1, 0x61, 0x00, 0x00, 0xbf, 0x45, 0x00, 0x00, 0xbd, 0x1a, 0x00, 0x00,
+  0xc6, 0x56, 0x00, 0x00, 0x0f, 0xcd, 0xff, 0xff, 0xff, 0xac, 0xff, 0xff,
+  0x30, 0xd8, 0xff, 0xff, 0x35, 0x4c, 0xff, 0xff, 0xcd, 0x89, 0xff, 0xff,
+  0x02, 0xfe, 0xff, 0xff, 0x09, 0x41, 0x00, 0x00, 0x80, 0x9c, 0xff, 0xff,
+  0x4d, 0x64, 0x00, 0x00, 0x11, 0x51, 0xff, 0xff, 0xd1, 0xeb, 0xff, 0xff,
+  0xdf, 0xaa, 0x00, 0x00, 0x75, 0x1f, 0x00, 0x00, 0x97, 0x89, 0x00, 0x00,
+  0xcb, 0x5f, 0x00, 0x00, 0x92, 0xe3, 0xff, 0xff, 0x0b, 0xf2, 0xff, 0xff,
+  0x99, 0xe5, 0xff, 0xff, 0x78, 0x76, 0x00, 0x00, 0xfa, 0x06, 0x00, 0x00,
+  0x7e, 0xa6, 0xff, 0xff, 0x80, 0xf8, 0xff, 0xff, 0x04, 0x2c, 0x00, 0x00,
+  0xa6, 0x3e, 0x00, 0x00, 0x03, 0xb8, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff,
+  0xd7, 0xc8, 0xff, 0xff, 0x0a, 0x5b, 0x00, 0x00, 0xad, 0x9c, 0xff, 0xff,
+  0xf8, 0x45, 0x00, 0x00, 0xd4, 0xb8, 0xff, 0xff, 0xc7, 0x42, 0x00, 0x00,
+  0x7a, 0xdf, 0xff, 0xff, 0xe3, 0x3f, 0xff, 0xff, 0x62, 0x2f, 0x00, 0x00,
+  0xd5, 0x6f, 0x00, 0x00, 0xc2, 0xfd, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xc4, 0x29, 0x00, 0x00,
   0x49, 0x06, 0x00, 0x00, 0xdc, 0x3a, 0x00, 0x00, 0x9e, 0xc4, 0xff, 0xff,
   0xae, 0x51, 0x00, 0x00, 0x7a, 0x2c, 0x00, 0x00, 0xc0, 0xe0, 0xff, 0xff,
   0xc4, 0x57, 0x00, 0x00, 0x31, 0x24, 0x00, 0x00, 0x18, 0x1f, 0x00, 0x00,
@@ -6594,22 +6600,24 @@ unsigned char pretrainedResnet_quant_tflite[] = {
   0xfd, 0x0f, 0x00, 0x00, 0x14, 0x1f, 0x00, 0x00, 0xa0, 0x0c, 0x00, 0x00,
   0xfc, 0x02, 0x00, 0x00, 0x75, 0x67, 0x00, 0x00, 0xc8, 0x05, 0x00, 0x00,
   0xb8, 0x15, 0x00, 0x00, 0x21, 0x2f, 0x00, 0x00, 0x8a, 0xf9, 0xff, 0xff,
-  0xe1, 0x1a, 0x00, 0x00, 0x6a, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xc9, 0x47, 0x00, 0x00, 0xee, 0xcc, 0xff, 0xff,
-  0xd2, 0x48, 0x00, 0x00, 0xe3, 0x22, 0x00, 0x00, 0x40, 0x58, 0x00, 0x00,
-  0xb5, 0x08, 0x00, 0x00, 0xc1, 0xed, 0xff, 0xff, 0x43, 0x07, 0x00, 0x00,
-  0x1c, 0x36, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0d, 0x90, 0xff, 0xff,
-  0x8a, 0xeb, 0xff, 0xff, 0xc1, 0x07, 0x00, 0x00, 0x89, 0x02, 0x00, 0x00,
-  0x45, 0x04, 0x00, 0x00, 0x12, 0x1c, 0x00, 0x00, 0xb6, 0xfe, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xb4, 0x1a, 0x00, 0x00,
-  0xac, 0x2c, 0x00, 0x00, 0xb4, 0x26, 0x00, 0x00, 0x25, 0x0d, 0x00, 0x00,
-  0x02, 0x1a, 0x00, 0x00, 0xed, 0x0c, 0x00, 0x00, 0xdd, 0x1a, 0x00, 0x00,
-  0xd1, 0x13, 0x00, 0x00, 0xb7, 0x0d, 0x00, 0x00, 0xa8, 0x16, 0x00, 0x00,
-  0x9d, 0x16, 0x00, 0x00, 0x43, 0x39, 0x00, 0x00, 0xc7, 0x24, 0x00, 0x00,
-  0x51, 0xd1, 0xff, 0xff, 0xdc, 0x76, 0xff, 0xff, 0xd3, 0x21, 0x00, 0x00,
-  0x02, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xe9, 0xff, 0xff, 0xff,
+  0xe1, 0x1a, 0x00, 0x00, 0x52, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xc9, 0x47, 0x00, 0x00,
+  0xee, 0xcc, 0xff, 0xff, 0xd2, 0x48, 0x00, 0x00, 0xe3, 0x22, 0x00, 0x00,
+  0x40, 0x58, 0x00, 0x00, 0xb5, 0x08, 0x00, 0x00, 0xc1, 0xed, 0xff, 0xff,
+  0x43, 0x07, 0x00, 0x00, 0x1c, 0x36, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x0d, 0x90, 0xff, 0xff, 0x8a, 0xeb, 0xff, 0xff, 0xc1, 0x07, 0x00, 0x00,
+  0x89, 0x02, 0x00, 0x00, 0x45, 0x04, 0x00, 0x00, 0x12, 0x1c, 0x00, 0x00,
+  0xa2, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0xb4, 0x1a, 0x00, 0x00, 0xac, 0x2c, 0x00, 0x00,
+  0xb4, 0x26, 0x00, 0x00, 0x25, 0x0d, 0x00, 0x00, 0x02, 0x1a, 0x00, 0x00,
+  0xed, 0x0c, 0x00, 0x00, 0xdd, 0x1a, 0x00, 0x00, 0xd1, 0x13, 0x00, 0x00,
+  0xb7, 0x0d, 0x00, 0x00, 0xa8, 0x16, 0x00, 0x00, 0x9d, 0x16, 0x00, 0x00,
+  0x43, 0x39, 0x00, 0x00, 0xc7, 0x24, 0x00, 0x00, 0x51, 0xd1, 0xff, 0xff,
+  0xdc, 0x76, 0xff, 0xff, 0xd3, 0x21, 0x00, 0x00, 0xf2, 0xfe, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xe9, 0xff, 0xff, 0xff,
   0xd8, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
   0x0c, 0x00, 0x00, 0x00, 0xde, 0xff, 0xff, 0xff, 0x2c, 0x00, 0x00, 0x00,
   0xe4, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00,
@@ -8208,4 +8216,4 @@ unsigned char pretrainedResnet_quant_tflite[] = {
   0x0f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
   0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03
 };
-unsigned int pretrainedResnet_quant_tflite_len = 98496;
+unsigned int pretrainedResnet_quant_tflite_len = 98592;
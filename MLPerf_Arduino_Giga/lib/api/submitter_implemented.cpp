@@ -16,23 +16,42 @@
  *
  * Adapated for Arduino GIGA R1 WiFi (Cortex-M7) by Gemini.
  * UPDATED: Hybrid Allocation (Try Internal RAM -> Fallback to SDRAM)
+ * Serial I/O, timestamps and allocation tiers live in th_hal_giga.cpp, loading,
+ * inference, results and the measurement commands in MLPerf_Common/lib/th_tflm.
  */
 
+// Im Dual-Core-Build des M4 ersetzt lib/dualcore/dualcore_m4.cpp diese Datei
+#ifndef TH_GIGA_M4
+
 // 1. API-Header
 #include "submitter_implemented.h"
 #include "internally_implemented.h" 
+#include "th_hal.h"
 
 // 2. Arduino & C Standard-Bibliotheken
 #include <Arduino.h>  
-#include <stdarg.h>   
-#include <stdio.h>    
+#include <stdlib.h>   
 #include <string.h>   
-#include <SDRAM.h> // Für den Fallback nötig
 
-// 3. TFLM-Header
-#include "tensorflow/lite/micro/micro_interpreter.h"
-#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
-#include "tensorflow/lite/schema/schema_generated.h"
+// 3. TFLM-Teil aller Boards (Resolver, th_load_tensor, th_infer, ...)
+#include "th_tflm.h"
+
+// Gekachelte Faltungen bei Arena im SDRAM (-D TH_SDRAM_TILING=1)
+#include "sdram_tiling.h"
+#include "tiled_ops.h"
+// Cache-/MPU-Richtlinie für Arena und Modell (Befehl "cache")
+#include "m7_cache.h"
+// Komprimierte Modellablage (-D TH_MODEL_LZ=1)
+#include "model_lz.h"
+// Dual-Core: M4 für I/O, M7 nur Invoke() (-D TH_GIGA_DUALCORE=1)
+#include "dualcore.h"
+#if TH_GIGA_DUALCORE
+  #include <RPC.h>
+  #include <mbed.h>
+  #if TH_STREAMING || TH_AD_BATCH
+    #error "TH_GIGA_DUALCORE unterstuetzt nur normales Invoke()"
+  #endif
+#endif
 
 // ===================================================================
 // MODELL-KONFIGURATION
@@ -40,52 +59,64 @@
 
 #if TH_MODEL_VERSION == EE_MODEL_VERSION_IC01
   #include "ic01_model_data.h"
-  const unsigned char* g_model = pretrainedResnet_quant_tflite;
+  const unsigned char* g_model = TH_MODEL_FLASH(pretrainedResnet_quant_tflite);
+  constexpr size_t kModelSize = sizeof(pretrainedResnet_quant_tflite);
   // ResNet ist groß, wird wahrscheinlich im SDRAM landen
   constexpr size_t kTensorArenaSize = 1024 * 1024; 
 
 #elif TH_MODEL_VERSION == EE_MODEL_VERSION_KWS01
   #include "kws01_model_data.h"
-  const unsigned char* g_model = kws_ref_model_tflite;
+  const unsigned char* g_model = TH_MODEL_FLASH(kws_ref_model_tflite);
+  constexpr size_t kModelSize = sizeof(kws_ref_model_tflite);
   // Könnte in den internen RAM passen
   constexpr size_t kTensorArenaSize = 100 * 1024;
 
 #elif TH_MODEL_VERSION == EE_MODEL_VERSION_VWW01
   #include "vww01_model_data.h"
-  const unsigned char* g_model = vww_96_int8_tflite;
+  const unsigned char* g_model = TH_MODEL_FLASH(vww_96_int8_tflite);
+  constexpr size_t kModelSize = sizeof(vww_96_int8_tflite);
   // Wir fordern genug Platz an. Wenn intern voll -> SDRAM.
   constexpr size_t kTensorArenaSize = 350 * 1024; 
 
 #elif TH_MODEL_VERSION == EE_MODEL_VERSION_AD01
   #include "ad01_model_data.h"
-  const unsigned char* g_model = ad01_int8_tflite;
+  const unsigned char* g_model = TH_MODEL_FLASH(ad01_int8_tflite);
+  constexpr size_t kModelSize = sizeof(ad01_int8_tflite);
   constexpr size_t kTensorArenaSize = 100 * 1024;
 
 #elif TH_MODEL_VERSION == EE_MODEL_VERSION_STRWW01
   #include "strww01_model_data.h"
-  const unsigned char* g_model = str_ww_ref_model_tflite;
+  const unsigned char* g_model = TH_MODEL_FLASH(str_ww_ref_model_tflite);
+  constexpr size_t kModelSize = sizeof(str_ww_ref_model_tflite);
   constexpr size_t kTensorArenaSize = 100 * 1024;
 
 #else
   #error "TH_MODEL_VERSION wurde nicht auf ein gültiges Modell gesetzt!"
 #endif
 
+#if TH_MODEL_LZ
+  // Komprimiertes Abbild im Flash, g_model wird in th_final_initialize() gesetzt
+  #include "model_lz_data.h"
+#endif
+
 // ===================================================================
 // GLOBALE VARIABLEN
 // ===================================================================
 
 namespace {
-const tflite::Model* model = nullptr;
-tflite::MicroInterpreter* interpreter = nullptr;
-TfLiteTensor* model_input = nullptr;
-TfLiteTensor* model_output = nullptr;
-tflite::MicroOpResolver* op_resolver = nullptr;
-
 // Pointer statt statisches Array. Wir entscheiden zur Laufzeit wohin.
 uint8_t* tensor_arena = nullptr;
 
-#if EE_CFG_ENERGY_MODE
-  constexpr int TH_GPIO_TIMESTAMP_PIN = 5;
+#if TH_SDRAM_TILING
+  bool tiling_active = false; // true -> CONV_2D/DEPTHWISE_CONV_2D bandweise
+#endif
+
+#if TH_GIGA_DUALCORE
+  // Statisch im AXI-SRAM, damit der M4 ihn erreicht (DTCM sieht er nicht)
+  DualcoreShared dc_shared;
+  rtos::Semaphore dc_wakeup(0);
+  uint32_t dc_input_seq = 0; // zuletzt übernommener Tensor
+  uint32_t dc_stats_seq = 0;
 #endif
 } // namespace
 
@@ -93,254 +124,234 @@ uint8_t* tensor_arena = nullptr;
 // HILFSFUNKTIONEN
 // ===================================================================
 
-void AddOpsToResolver() {
-  #if TH_MODEL_VERSION == EE_MODEL_VERSION_IC01
-    static tflite::MicroMutableOpResolver<6> micro_op_resolver;
-    micro_op_resolver.AddFullyConnected();
-    micro_op_resolver.AddConv2D();
-    micro_op_resolver.AddAdd();
-    micro_op_resolver.AddAveragePool2D();
-    micro_op_resolver.AddReshape();
-    micro_op_resolver.AddSoftmax();
-    op_resolver = &micro_op_resolver;
-
-  #elif TH_MODEL_VERSION == EE_MODEL_VERSION_KWS01
-    static tflite::MicroMutableOpResolver<6> micro_op_resolver;
-    micro_op_resolver.AddDepthwiseConv2D();
-    micro_op_resolver.AddConv2D();
-    micro_op_resolver.AddAveragePool2D();
-    micro_op_resolver.AddReshape();
-    micro_op_resolver.AddFullyConnected();
-    micro_op_resolver.AddSoftmax();
-    op_resolver = &micro_op_resolver;
-
-  #elif TH_MODEL_VERSION == EE_MODEL_VERSION_VWW01
-    static tflite::MicroMutableOpResolver<7> micro_op_resolver;
-    micro_op_resolver.AddConv2D();
-    micro_op_resolver.AddDepthwiseConv2D();
-    micro_op_resolver.AddAveragePool2D();
-    micro_op_resolver.AddReshape();
-    micro_op_resolver.AddSoftmax();
-    micro_op_resolver.AddFullyConnected();
-    micro_op_resolver.AddMean();
-    op_resolver = &micro_op_resolver;
-
-  #elif TH_MODEL_VERSION == EE_MODEL_VERSION_AD01
-    static tflite::MicroMutableOpResolver<2> micro_op_resolver;
-    micro_op_resolver.AddFullyConnected();
-    micro_op_resolver.AddRelu();
-    op_resolver = &micro_op_resolver;
-
-  #elif TH_MODEL_VERSION == EE_MODEL_VERSION_STRWW01
-    static tflite::MicroMutableOpResolver<4> micro_op_resolver;
-    micro_op_resolver.AddUnidirectionalSequenceLSTM();
-    micro_op_resolver.AddFullyConnected();
-    micro_op_resolver.AddSoftmax();
-    micro_op_resolver.AddReshape();
-    op_resolver = &micro_op_resolver;
-
-  #else
-    #error "TH_MODEL_VERSION nicht erkannt in AddOpsToResolver()"
-  #endif
-}
-
-// ===================================================================
-// MLPERF API IMPLEMENTIERUNG
-// ===================================================================
-
-void th_load_tensor() {
-  size_t input_size_bytes = model_input->bytes;
-  static uint8_t temp_host_buffer[MAX_DB_INPUT_SIZE];
-  
-  size_t host_buffer_size = ee_get_buffer(temp_host_buffer, input_size_bytes);
-
-  if (host_buffer_size != input_size_bytes) {
-    th_printf("FEHLER: Host-Puffer Groesse (%d) != Tensor Groesse (%d)!\r\n", 
-              (int)host_buffer_size, (int)input_size_bytes);
+// Faltungen: gekachelt, wenn die Arena im SDRAM liegt, sonst TFLM-Standard
+struct GigaKernels : ThTflmKernels {
+  template <typename Resolver>
+  static void AddConv2D(Resolver& resolver) {
+#if TH_SDRAM_TILING
+    if (tiling_active) {
+      resolver.AddConv2D(tiling_conv2d_registration());
+      return;
+    }
+#endif
+    resolver.AddConv2D();
   }
 
-  if (model_input->type == kTfLiteInt8) {
-    int8_t* tensor_data = model_input->data.int8;
-
-    #if (TH_MODEL_VERSION == EE_MODEL_VERSION_IC01) || (TH_MODEL_VERSION == EE_MODEL_VERSION_VWW01)
-      for (size_t i = 0; i < input_size_bytes; i++) {
-        int16_t temp = (int16_t)temp_host_buffer[i] - 128;
-        tensor_data[i] = (int8_t)temp;
-      }
-    #else
-      memcpy(tensor_data, temp_host_buffer, input_size_bytes);
-    #endif
-  } 
-  else if (model_input->type == kTfLiteUInt8) {
-    uint8_t* tensor_data = model_input->data.uint8;
-    memcpy(tensor_data, temp_host_buffer, input_size_bytes);
-  } else {
-    th_printf("FEHLER: Unbekannter Input-Tensor-Typ!");
+  template <typename Resolver>
+  static void AddDepthwiseConv2D(Resolver& resolver) {
+#if TH_SDRAM_TILING
+    if (tiling_active) {
+      resolver.AddDepthwiseConv2D(tiling_depthwise_conv2d_registration());
+      return;
+    }
+#endif
+    resolver.AddDepthwiseConv2D();
   }
-}
+};
 
-void th_results() {
-  th_printf("m-results-[");
+// Liegt vor th_timestamp(), zählt also nicht zur gemessenen Zeit
+void th_board_load_done(void) { m7_cache_prewarm(); }
 
-  TfLiteTensor* output = model_output;
-  size_t output_size = output->dims->data[output->dims->size - 1];
-  float scale = output->params.scale;
-  int32_t zero_point = output->params.zero_point;
+#if TH_SDRAM_TILING
+// m-tiling zählt nur das letzte Invoke()
+void th_board_run_begin(void) { tiling_reset_stats(); }
 
-  int8_t* output_data = output->data.int8;
-
-  for (size_t i = 0; i < output_size; i++) {
-    float float_val = ((float)output_data[i] - (float)zero_point) * scale;
-    th_printf("%f", float_val);
-    if (i < output_size - 1) th_printf(",");
+void th_board_results(void) {
+  if (tiling_active) {
+    uint32_t layers = 0, bands = 0, untiled = 0;
+    tiling_get_stats(&layers, &bands, &untiled);
+    th_printf("m-tiling-[layers=%lu,bands=%lu,untiled=%lu]\r\n",
+              (unsigned long)layers, (unsigned long)bands, (unsigned long)untiled);
   }
-  th_printf("]\r\n");
 }
+#endif
 
-void th_infer() {
-  if (interpreter->Invoke() != kTfLiteOk) {
-    th_printf("FEHLER: interpreter->Invoke() fehlgeschlagen!\r\n");
-  }
+#if TH_SUMMARY
+void th_board_summary(void) {
+  th_printf("\"cache\":\"%s\",", m7_cache_policy_name(m7_cache_policy()));
 }
-
-void th_timestamp(void) {
-#if EE_CFG_ENERGY_MODE
-  digitalWrite(TH_GPIO_TIMESTAMP_PIN, HIGH);
-  delayMicroseconds(500);
-  digitalWrite(TH_GPIO_TIMESTAMP_PIN, LOW);
-#else 
-  th_printf(EE_MSG_TIMESTAMP, micros());
 #endif
+
+#if TH_GIGA_DUALCORE
+// RPC-Handler laufen im RPC-Thread: nur aufwecken, gerechnet wird in loop()
+static void DualcoreNotify() {
+  dc_wakeup.release();
 }
 
-void th_printf(const char *fmt, ...) {
-  char buffer[256];
-  va_list args;
-  va_start(args, fmt);
-  vsnprintf(buffer, sizeof(buffer), fmt, args);
-  va_end(args);
-
-#if EE_CFG_ENERGY_MODE
-  Serial2.print(buffer);
-  Serial2.flush(); // Sicherstellen, dass alles rausgeht
-  Serial.print(buffer);
-  Serial.flush(); // <--- FIX: Warten bis Daten gesendet sind, bevor CPU belastet wird
-#else
-  Serial.print(buffer);
-  Serial.flush(); // <--- FIX: Warten bis Daten gesendet sind, bevor CPU belastet wird
-#endif
+static uint32_t DualcoreAddress() {
+  return (uint32_t)(uintptr_t)&dc_shared;
 }
 
-char th_getchar() {
-#if EE_CFG_ENERGY_MODE
-  HardwareSerial& active_serial = Serial2;
-#else
-  Stream& active_serial = Serial;
-#endif
+// Modellinfos für den M4 ablegen und ihn über RPC starten
+static void DualcoreStart(tflite::MicroInterpreter* interpreter, const char* arena_location) {
+  uintptr_t addr = (uintptr_t)&dc_shared;
+  if (addr >= 0x20000000 && addr < 0x20020000) {
+    th_printf("FEHLER: Dual-Core-Speicher liegt im DTCM (0x%X), M4 hat keinen Zugriff!\r\n",
+              (unsigned)addr);
+    return;
+  }
 
-  while (!active_serial.available()) {
-    yield(); 
+  const TfLiteTensor* model_input = th_tflm_input();
+  const TfLiteTensor* model_output = th_tflm_output();
+  DualcoreInfo& info = dc_shared.info;
+  info.input_bytes = model_input->bytes;
+  info.input_int8 = model_input->type == kTfLiteInt8;
+  info.output_bytes = model_output->bytes;
+  info.output_count = model_output->dims->data[model_output->dims->size - 1];
+  info.output_zero_point = model_output->params.zero_point;
+  info.output_scale = model_output->params.scale;
+  info.cpu_mhz = th_hal_cpu_mhz();
+  info.arena_size = kTensorArenaSize;
+  info.arena_used = interpreter->arena_used_bytes();
+  strncpy(info.arena_location, arena_location, sizeof(info.arena_location) - 1);
+  strncpy(info.kernel_backend, th_kernel_backend(), sizeof(info.kernel_backend) - 1);
+  if (info.input_bytes > sizeof(dc_shared.input) || info.output_bytes > TH_DC_MAX_OUTPUT) {
+    th_printf("FEHLER: Tensoren passen nicht in den Dual-Core-Speicher!\r\n");
+    return;
   }
-  char message = active_serial.read();
-  //th_printf("%c", message); 
-  return message;
-}
+  info.magic = TH_DC_MAGIC;
+  SCB_CleanDCache_by_Addr((uint32_t*)&dc_shared, sizeof(dc_shared));
 
-void th_serialport_initialize(void) {
-#if EE_CFG_ENERGY_MODE
-  Serial2.begin(9600); 
-  Serial.begin(115200); 
-#else 
-  Serial.begin(115200); 
-#endif
-  
-  long start = micros();
-  while (!Serial && (micros() - start < 2000000)) { 
-    yield();
+  RPC.bind("dc_shared", DualcoreAddress);
+  RPC.bind("dc_notify", DualcoreNotify);
+  if (!RPC.begin()) {
+    th_printf("FEHLER: RPC.begin() fehlgeschlagen, M4 startet nicht!\r\n");
+    return;
   }
+  th_printf("DEBUG: Dual-Core aktiv, gemeinsamer Speicher 0x%X (%u Bytes).\r\n",
+            (unsigned)addr, (unsigned)sizeof(dc_shared));
 }
 
-void th_timestamp_initialize(void) {
+// Arbeitet alle gestellten Aufträge ab. Der M4 schreibt nur input[] und req,
+// der M7 nur resp und done; nur deshalb ist Invalidieren hier gefahrlos.
+void th_dualcore_service(void) {
+  dc_wakeup.acquire();
+  for (;;) {
+    SCB_InvalidateDCache_by_Addr((uint32_t*)&dc_shared.req, sizeof(dc_shared.req));
+    uint32_t done = dc_shared.done.seq;
+    if (dc_shared.req.seq == done) return;
+
+    uint32_t t0 = micros();
+    if (dc_shared.req.input_seq != dc_input_seq) {
+      dc_input_seq = dc_shared.req.input_seq;
+      SCB_InvalidateDCache_by_Addr((uint32_t*)dc_shared.input, sizeof(dc_shared.input));
+      memcpy(th_tflm_input()->data.raw, dc_shared.input, th_tflm_input()->bytes);
+    }
+    th_tflm_run();
+    memcpy(dc_shared.resp.output, th_tflm_output()->data.raw, th_tflm_output()->bytes);
+    uint32_t dt = (uint32_t)(micros() - t0);
+
+    DualcoreResponse& r = dc_shared.resp;
+    if (dc_shared.req.stats_seq != dc_stats_seq) {
+      dc_stats_seq = dc_shared.req.stats_seq;
+      r.count = 0;
+      r.busy_sum_us = 0;
+    }
+    if (r.count == 0 || dt < r.busy_min_us) r.busy_min_us = dt;
+    if (r.count == 0 || dt > r.busy_max_us) r.busy_max_us = dt;
+    r.busy_sum_us += dt;
+    r.count++;
+
+    // Erst die Antwort sichtbar machen, dann den Zähler, auf den der M4 wartet
+    SCB_CleanDCache_by_Addr((uint32_t*)&r, sizeof(r));
+    __DSB();
+    dc_shared.done.seq = done + 1;
+    SCB_CleanDCache_by_Addr((uint32_t*)&dc_shared.done, sizeof(dc_shared.done));
+  }
 }
+#endif
 
 void th_final_initialize(void) {
-  model = tflite::GetModel(g_model);
-  
-  AddOpsToResolver();
+#if TH_MODEL_LZ
+  // Modell einmalig in den RAM entpacken (lib/model_lz)
+  if (g_model == nullptr) g_model = model_lz_load(&model_lz_blob);
+  if (g_model == nullptr) return;
+#endif
+  const tflite::Model* model = th_tflm_model(g_model);
  
   // --- INTELLIGENTE SPEICHERZUWEISUNG ---
-  
-  // Größe + Alignment Puffer
-  size_t alloc_size = kTensorArenaSize + 16;
-  void* raw_mem = nullptr;
-  bool using_sdram = false;
-
-  // 1. Versuch: Interner RAM (malloc)
-  // Mbed OS malloc nutzt den verfügbaren Heap im AXI SRAM
-  raw_mem = malloc(alloc_size);
-
-  if (raw_mem != nullptr) {
-    th_printf("DEBUG: Interner RAM erfolgreich zugewiesen!\r\n");
-  } else {
-    // 2. Fallback: SDRAM
-    th_printf("DEBUG: Interner RAM voll. Versuche SDRAM...\r\n");
-    SDRAM.begin();
-    raw_mem = SDRAM.malloc(alloc_size);
-    using_sdram = true;
-  }
-
-  if (raw_mem == nullptr) {
+  // Erst interner RAM (AXI-SRAM), dann SDRAM; auf 16 Byte ausgerichtet
+  th_mem_tier_t tier = TH_MEM_INTERNAL;
+  tensor_arena = (uint8_t*)th_alloc_aligned(kTensorArenaSize, 16, &tier);
+  if (tensor_arena == nullptr) {
     th_printf("FEHLER: Speicher voll! Weder RAM noch SDRAM verfuegbar.\r\n");
     return;
   }
-
-  // Manuelles Alignment auf 16 Byte
-  tensor_arena = (uint8_t*)((uintptr_t)((uint8_t*)raw_mem + 15) & ~15);
+  bool using_sdram = (tier == TH_MEM_EXTERNAL);
+  const char* arena_location = th_hal_tier_name(tier);
 
   th_printf("Arena Adresse: 0x%X (%s)\r\n", (uintptr_t)tensor_arena, using_sdram ? "SDRAM" : "INTERNAL");
 
+#if TH_SDRAM_TILING
+  // Arena im SDRAM: Faltungen rechnen bandweise in einem SRAM-Puffer
+  if (using_sdram) {
+    tiling_active = tiling_init(malloc(TH_SDRAM_TILING_SRAM), TH_SDRAM_TILING_SRAM);
+    if (tiling_active) {
+      bool mdma = TH_SDRAM_TILING_MDMA && tile_mdma_init();
+      th_printf("DEBUG: SDRAM-Tiling aktiv (%u Bytes SRAM, Kopien per %s).\r\n",
+                (unsigned)TH_SDRAM_TILING_SRAM, mdma ? "MDMA" : "memcpy");
+    } else {
+      th_printf("WARN: Kein SRAM fuer SDRAM-Tiling, Faltungen laufen im SDRAM.\r\n");
+    }
+  }
+#endif
+
+  // Erst jetzt: die Faltungs-Kernel hängen davon ab, wo die Arena liegt
   static tflite::MicroInterpreter static_interpreter(
-      model, *op_resolver, tensor_arena, kTensorArenaSize);
-      
-  interpreter = &static_interpreter;
+      model, *th_tflm_resolver<GigaKernels>(), tensor_arena, kTensorArenaSize);
+  tflite::MicroInterpreter* interpreter = &static_interpreter;
 
-  if (interpreter->AllocateTensors() != kTfLiteOk) {
-    th_printf("FEHLER: AllocateTensors() fehlgeschlagen.\r\n");
-    th_printf("Benötigt: %d\r\n", interpreter->arena_used_bytes());
-    return;
-  }
+  // Tensoren zuweisen, Streaming/Batch starten
+  if (!th_tflm_start(interpreter, kTensorArenaSize, arena_location)) return;
 
-  model_input = interpreter->input(0);
-  model_output = interpreter->output(0);
+  // Cache-Richtlinie erst jetzt: AllocateTensors() hat die Arena beschrieben
+  m7_cache_init(tensor_arena, kTensorArenaSize, g_model, kModelSize);
+  m7_cache_set_prewarm(TH_CACHE_PREWARM);
+  if (!m7_cache_apply(TH_CACHE_POLICY)) {
+    th_printf("WARN: Cache-Richtlinie %d nicht anwendbar.\r\n", (int)TH_CACHE_POLICY);
+  }
 
   th_printf("DEBUG: Initialisierung abgeschlossen.\r\n");
   th_printf("Arena Used Bytes: %d\r\n", interpreter->arena_used_bytes());
   
-  #if EE_CFG_ENERGY_MODE
-    pinMode(TH_GPIO_TIMESTAMP_PIN, OUTPUT);
-    digitalWrite(TH_GPIO_TIMESTAMP_PIN, LOW);
-  #endif
+#if TH_GIGA_DUALCORE
+  DualcoreStart(interpreter, arena_location);
+#endif
+}
+
+// Welche Kernel TFLM nutzt, entscheidet der Build der Bibliothek (CMSIS_NN).
+// Sind CMSIS-NN-Funktionen im Binary gelinkt, rufen die Kernel sie auf; die
+// schwachen Referenzen bleiben sonst 0. So meldet profile, was wirklich läuft.
+extern "C" {
+void arm_convolve_s8(void) __attribute__((weak));
+void arm_depthwise_conv_s8(void) __attribute__((weak));
+void arm_fully_connected_s8(void) __attribute__((weak));
+}
+
+const char* th_kernel_backend(void) {
+  if (arm_convolve_s8 != nullptr || arm_depthwise_conv_s8 != nullptr ||
+      arm_fully_connected_s8 != nullptr) {
+    return "cmsis-nn";
+  }
+  return "tflm-reference";
+}
+
+// Meldet die aktive Cache-Einstellung, z.B. für profile und Logs
+void th_cache_report(void) {
+  char buf[128];
+  m7_cache_describe(buf, sizeof(buf));
+  th_printf("m-cache-[%s]\r\n", buf);
+}
+
+// 0 = übernommen, -1 = unbekannter Name
+int th_cache_set_policy(const char *name) {
+  int policy = m7_cache_policy_from_name(name);
+  if (policy < 0 || !m7_cache_apply(policy)) return -1;
+  return 0;
 }
 
-void th_pre() {}
-void th_post() {}
-void th_command_ready(char volatile *msg) {
-  ee_serial_command_parser_callback((char*) msg);
+void th_cache_set_prewarm(int on) {
+  m7_cache_set_prewarm(on != 0);
 }
 
-// Linker Hooks
-int th_strncmp(const char *str1, const char *str2, size_t n) { return strncmp(str1, str2, n); }
-char *th_strncpy(char *dest, const char *src, size_t n) { return strncpy(dest, src, n); }
-size_t th_strnlen(const char *str, size_t maxlen) { return strnlen(str, maxlen); }
-char *th_strcat(char *dest, const char *src) { return strcat(dest, src); }
-char *th_strtok(char *str1, const char *sep) { return strtok(str1, sep); }
-int th_atoi(const char *str) { return atoi(str); }
-void *th_memset(void *b, int c, size_t len) { return memset(b, c, len); }
-void *th_memcpy(void *dst, const void *src, size_t n) { return memcpy(dst, src, n); }
-
-int th_vprintf(const char *format, va_list ap) {
-  char buffer[256];
-  vsnprintf(buffer, sizeof(buffer), format, ap);
-  Serial.print(buffer);
-  return strlen(buffer);
-}
\ No newline at end of file
+#endif // TH_GIGA_M4
@@ -0,0 +1,168 @@
+/*
+ * th_hal_giga.cpp
+ *
+ * Board-Schicht (th_hal.h) für den Arduino GIGA R1 WiFi, beide Kerne.
+ * M7:
+ * - PERFORMANCE MODE: USB (Serial), Zeit über micros()
+ * - ENERGY MODE: Serial2 zum IO Manager (Kopie auf USB), Timestamp auf Pin 5
+ * - Speicher: interner Heap (AXI-SRAM), danach SDRAM
+ * M4 (Dual-Core, TH_GIGA_M4):
+ * - Host über TH_M4_SERIAL (kein USB auf dem M4), kein SDRAM
+ */
+
+#include "submitter_implemented.h"
+#include "internally_implemented.h"
+#include "th_hal.h"
+
+#include <Arduino.h>
+#include <stdlib.h>
+#ifndef TH_GIGA_M4
+  #include <SDRAM.h> // Für den Fallback nötig
+#endif
+
+#ifdef TH_GIGA_M4
+#ifndef TH_M4_SERIAL
+#define TH_M4_SERIAL Serial2
+#endif
+
+#ifndef TH_M4_BAUD
+#if EE_CFG_ENERGY_MODE
+#define TH_M4_BAUD 9600
+#else
+#define TH_M4_BAUD 115200
+#endif
+#endif
+#endif
+
+namespace {
+#if EE_CFG_ENERGY_MODE
+  constexpr int TH_GPIO_TIMESTAMP_PIN = 5;
+#endif
+
+#ifndef TH_GIGA_M4
+  bool sdram_started = false; // SDRAM.begin() nur einmal
+#endif
+} // namespace
+
+// ===================================================================
+// SERIELLE SCHNITTSTELLE
+// ===================================================================
+
+void th_hal_serial_init(void) {
+#ifdef TH_GIGA_M4
+  TH_M4_SERIAL.begin(TH_M4_BAUD);
+#else
+#if EE_CFG_ENERGY_MODE
+  Serial2.begin(9600);
+  Serial.begin(115200);
+#else
+  Serial.begin(115200);
+#endif
+
+  long start = micros();
+  while (!Serial && (micros() - start < 2000000)) {
+    yield();
+  }
+#endif
+}
+
+void th_hal_serial_write(const char *buf, size_t len) {
+#ifdef TH_GIGA_M4
+  TH_M4_SERIAL.write((const uint8_t*)buf, len);
+  TH_M4_SERIAL.flush();
+#else
+#if EE_CFG_ENERGY_MODE
+  Serial2.write((const uint8_t*)buf, len);
+  Serial2.flush(); // Sicherstellen, dass alles rausgeht
+#endif
+  Serial.write((const uint8_t*)buf, len);
+  Serial.flush(); // Warten bis Daten gesendet sind, bevor CPU belastet wird
+#endif
+}
+
+char th_hal_serial_getchar(void) {
+#ifdef TH_GIGA_M4
+  auto& active_serial = TH_M4_SERIAL;
+#elif EE_CFG_ENERGY_MODE
+  HardwareSerial& active_serial = Serial2;
+#else
+  Stream& active_serial = Serial;
+#endif
+
+  while (!active_serial.available()) {
+    yield();
+#if TH_LOW_POWER
+    // Schlafen bis zum nächsten Interrupt (UART/USB-Empfang). Prüfung und WFI
+    // laufen maskiert: ein Empfang dazwischen bleibt anhängig und weckt
+    // sofort, statt bis zu einem fremden Interrupt zu schlafen (mit
+    // tickless idle kommt evtl. keiner). Der Handler läuft nach enable.
+    __disable_irq();
+    if (!active_serial.available()) __WFI();
+    __enable_irq();
+#endif
+  }
+  return active_serial.read();
+}
+
+// ===================================================================
+// ZEIT & TIMESTAMP-PIN
+// ===================================================================
+
+unsigned long th_hal_micros(void) { return micros(); }
+
+unsigned long th_hal_cpu_mhz(void) { return SystemCoreClock / 1000000; }
+
+void th_hal_timestamp_init(void) {
+#if EE_CFG_ENERGY_MODE
+  pinMode(TH_GPIO_TIMESTAMP_PIN, OUTPUT);
+  digitalWrite(TH_GPIO_TIMESTAMP_PIN, LOW);
+#endif
+}
+
+void th_hal_timestamp_pulse(void) {
+#if EE_CFG_ENERGY_MODE
+  digitalWrite(TH_GPIO_TIMESTAMP_PIN, HIGH);
+  delayMicroseconds(500);
+  digitalWrite(TH_GPIO_TIMESTAMP_PIN, LOW);
+#endif
+}
+
+// ===================================================================
+// SPEICHER (AXI-SRAM -> SDRAM Fallback)
+// ===================================================================
+
+void* th_hal_alloc(th_mem_tier_t tier, size_t bytes) {
+  if (tier == TH_MEM_INTERNAL) {
+    // Mbed OS malloc nutzt den verfügbaren Heap im AXI SRAM
+    return malloc(bytes);
+  }
+#ifdef TH_GIGA_M4
+  return nullptr;
+#else
+  if (!sdram_started) {
+    SDRAM.begin();
+    sdram_started = true;
+  }
+  return SDRAM.malloc(bytes);
+#endif
+}
+
+const char* th_hal_tier_name(th_mem_tier_t tier) {
+  return tier == TH_MEM_INTERNAL ? "internal" : "sdram";
+}
+
+// ===================================================================
+// LOW POWER
+// ===================================================================
+
+#if TH_LOW_POWER
+// WFI-Idle braucht keine Sperre, der Takt bleibt fest
+void th_hal_power_init(void) {
+}
+
+void th_busy_begin(void) {
+}
+
+void th_busy_end(void) {
+}
+#endif
@@ -0,0 +1,101 @@
+/*
+ * dualcore.h
+ *
+ * Aufteilung des Benchmarks auf beide Kerne des STM32H747 (GIGA R1):
+ *   - M4: serielle Schnittstelle, EEMBC-Parser, "db"-Hex-Dekodierung und
+ *         Vorverarbeitung (-128 für ic01/vww01), schreibt den fertigen
+ *         Tensor in den gemeinsamen Speicher (dualcore_m4.cpp)
+ *   - M7: wartet in loop() auf Aufträge und führt nur Invoke() aus
+ *         (th_dualcore_service() in submitter_implemented.cpp)
+ *
+ * Gemeinsamer Speicher ist ein statischer Block im AXI-SRAM des M7, dessen
+ * Adresse der M4 beim Start per RPC abfragt. Signalisiert wird M4 -> M7 per
+ * RPC ("dc_notify"), M7 -> M4 über den Zähler done.seq, den der M4 pollt.
+ *
+ * Der M7 hat einen D-Cache, der M4 nicht. Jeder Teilblock gehört daher genau
+ * einem Schreiber und liegt auf eigenen 32-Byte-Cachezeilen; der M7
+ * invalidiert vor dem Lesen und schreibt nach dem Schreiben zurück.
+ *
+ * Der M4 darf bis zu TH_DC_QUEUE_DEPTH Inferenzen vorausschicken, dadurch
+ * rechnet der M7 während der M4 den nächsten Auftrag vorbereitet oder
+ * seriell kommuniziert. th_results() auf dem M4 meldet danach den
+ * anhaltenden Durchsatz und die Auslastung des M7:
+ *   m-dualcore-[inferences=N,wall_us=..,m7_busy_us=..,m7_util_pct=..,inf_per_s=..]
+ *
+ * Aktivierung über Build-Flags (platformio.ini, Umgebungen giga_dualcore_m7
+ * und giga_dualcore_m4):
+ *   -D TH_GIGA_DUALCORE=1  beide Kerne
+ *   -D TH_GIGA_M4          nur im Build für den M4
+ * Nur mit normalem Invoke(), nicht mit TH_STREAMING oder TH_AD_BATCH.
+ */
+
+#ifndef TH_DUALCORE_H_
+#define TH_DUALCORE_H_
+
+#include <stdint.h>
+
+#include "submitter_implemented.h"
+
+#ifndef TH_GIGA_DUALCORE
+#define TH_GIGA_DUALCORE 0
+#endif
+
+// Maximal ausstehende Aufträge des M4 (1 = kein Vorausschicken)
+#ifndef TH_DC_QUEUE_DEPTH
+#define TH_DC_QUEUE_DEPTH 2
+#endif
+
+#define TH_DC_MAGIC 0x44435231u  // "DCR1"
+#define TH_DC_MAX_OUTPUT 1024    // größter Ausgang: ad01 mit 640 Bytes
+#define TH_DC_LINE 32            // Cachezeile des M7
+
+// M7 -> M4, einmal nach AllocateTensors()
+struct alignas(TH_DC_LINE) DualcoreInfo {
+  uint32_t magic;
+  uint32_t input_bytes;
+  uint32_t input_int8;  // 1: int8-Eingang, 0: uint8
+  uint32_t output_bytes;
+  uint32_t output_count;
+  int32_t output_zero_point;
+  float output_scale;
+  uint32_t cpu_mhz;
+  uint32_t arena_size;
+  uint32_t arena_used;
+  char arena_location[12];
+  char kernel_backend[20];
+};
+
+// M4 -> M7
+struct alignas(TH_DC_LINE) DualcoreRequest {
+  volatile uint32_t seq;        // Aufträge bis einschließlich seq sind gestellt
+  volatile uint32_t input_seq;  // erhöht nach jedem neuen Tensor in input[]
+  volatile uint32_t stats_seq;  // erhöht in th_pre(): M7-Statistik zurücksetzen
+};
+
+// M7 -> M4, gültig sobald done.seq den Auftrag erreicht hat
+struct alignas(TH_DC_LINE) DualcoreResponse {
+  uint32_t count;        // Aufträge seit dem letzten stats_seq
+  uint32_t busy_min_us;
+  uint32_t busy_max_us;
+  uint32_t busy_sum_us;  // Kopieren + Invoke() auf dem M7
+  int8_t output[TH_DC_MAX_OUTPUT];
+};
+
+// M7 -> M4, eigene Cachezeile: erst wenn die Antwort zurückgeschrieben ist
+struct alignas(TH_DC_LINE) DualcoreDone {
+  volatile uint32_t seq;
+};
+
+struct DualcoreShared {
+  DualcoreInfo info;
+  DualcoreRequest req;
+  DualcoreResponse resp;
+  DualcoreDone done;
+  alignas(TH_DC_LINE) int8_t input[(MAX_DB_INPUT_SIZE + TH_DC_LINE - 1) & ~(TH_DC_LINE - 1)];
+};
+
+/// \brief M7: Aufträge des M4 abarbeiten, ersetzt in loop() das Lesen der
+/// seriellen Schnittstelle. Blockiert bis zum nächsten RPC-Signal.
+void th_dualcore_service(void);
+
+#endif  // TH_DUALCORE_H_
@@ -0,0 +1,173 @@
+/*
+ * dualcore_m4.cpp
+ *
+ * th_*-Implementierung für den M4 im Dual-Core-Betrieb (siehe dualcore.h).
+ * Ersetzt dort submitter_implemented.cpp, das nur für den M7 gebaut wird.
+ *
+ * Der M4 hat keinen USB-Zugang (Serial ist auf dem M4 eine RPC-Umleitung
+ * zum M7), daher spricht er den Host über einen Hardware-UART an
+ * (TH_M4_SERIAL, Standard Serial2 wie im Energy-Modus des M7). Serielle
+ * Schnittstelle und Timestamp kommen wie beim M7 aus lib/api/th_hal_giga.cpp.
+ */
+
+#include "dualcore.h"
+
+#if TH_GIGA_DUALCORE && defined(TH_GIGA_M4)
+
+#include <Arduino.h>
+#include <RPC.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "internally_implemented.h"
+#include "submitter_implemented.h"
+#include "th_stats.h"
+
+namespace {
+DualcoreShared* dc = nullptr;  // liegt im AXI-SRAM des M7
+
+uint32_t posted_seq = 0;  // letzter gestellter Auftrag
+uint32_t input_seq = 0;
+uint32_t stats_seq = 0;
+
+// Messfenster th_pre() .. th_post()
+uint32_t wall_start = 0;
+uint32_t wall_us = 0;
+}  // namespace
+
+// Wartet, bis der M7 höchstens `pending` Aufträge offen hat
+static void WaitPending(uint32_t pending) {
+  while ((uint32_t)(posted_seq - dc->done.seq) > pending) {
+  }
+}
+
+void th_load_tensor() {
+  if (dc == nullptr) return;
+  static uint8_t temp_host_buffer[MAX_DB_INPUT_SIZE];
+  size_t bytes = ee_get_buffer(temp_host_buffer, dc->info.input_bytes);
+  if (bytes != dc->info.input_bytes) {
+    th_printf("FEHLER: Host-Puffer Groesse (%d) != Tensor Groesse (%d)!\r\n",
+              (int)bytes, (int)dc->info.input_bytes);
+  }
+
+  // Der M7 liest input[] bei ausstehenden Aufträgen evtl. noch
+  WaitPending(0);
+#if (TH_MODEL_VERSION == EE_MODEL_VERSION_IC01) || (TH_MODEL_VERSION == EE_MODEL_VERSION_VWW01)
+  if (dc->info.input_int8) {
+    for (size_t i = 0; i < bytes; i++) {
+      dc->input[i] = (int8_t)((int16_t)temp_host_buffer[i] - 128);
+    }
+  } else {
+    memcpy(dc->input, temp_host_buffer, bytes);
+  }
+#else
+  memcpy(dc->input, temp_host_buffer, bytes);
+#endif
+  __DMB();
+  dc->req.input_seq = ++input_seq;
+}
+
+void th_infer() {
+  if (dc == nullptr) return;
+  WaitPending(TH_DC_QUEUE_DEPTH - 1);
+  __DMB();
+  dc->req.seq = ++posted_seq;
+  RPC.send("dc_notify");
+}
+
+void th_results() {
+  if (dc == nullptr) {
+    th_printf("m-results-[]\r\n");
+    return;
+  }
+  WaitPending(0);
+  const DualcoreInfo& info = dc->info;
+  th_printf("m-results-[");
+  for (size_t i = 0; i < info.output_count; i++) {
+    float float_val = ((float)dc->resp.output[i] - (float)info.output_zero_point) * info.output_scale;
+    th_printf("%f", float_val);
+    if (i < info.output_count - 1) th_printf(",");
+  }
+  th_printf("]\r\n");
+
+  // Anhaltender Durchsatz der Messschleife und Anteil, den der M7 gerechnet hat
+  uint32_t count = dc->resp.count;
+  uint32_t busy = dc->resp.busy_sum_us;
+  uint32_t wall = wall_us ? wall_us : 1;
+  uint32_t util_permille = (uint32_t)(1000ULL * busy / wall);
+  uint32_t inf_milli = (uint32_t)(1000000000ULL * count / wall);
+  th_printf("m-dualcore-[inferences=%lu,wall_us=%lu,m7_busy_us=%lu,m7_util_pct=%lu.%lu,"
+            "inf_per_s=%lu.%03lu]\r\n",
+            (unsigned long)count, (unsigned long)wall_us, (unsigned long)busy,
+            (unsigned long)(util_permille / 10), (unsigned long)(util_permille % 10),
+            (unsigned long)(inf_milli / 1000), (unsigned long)(inf_milli % 1000));
+}
+
+#if TH_SUMMARY
+void th_summary(size_t n, size_t n_warmup) {
+  if (dc == nullptr) return;
+  const DualcoreInfo& info = dc->info;
+  const DualcoreResponse& r = dc->resp;
+  // Latenz ist die Rechenzeit des M7 je Auftrag, nicht die Wandzeit am M4
+  th_latency_t lat = {r.count, r.busy_min_us, r.busy_max_us, r.busy_sum_us};
+  th_summary_info_t s;
+  s.cpu_mhz = info.cpu_mhz;
+  s.arena_size = info.arena_size;
+  s.arena_location = info.arena_location;
+  s.arena_used = info.arena_used;
+  s.exec = "dualcore";
+  s.kernels = info.kernel_backend;
+  th_summary_print(n, n_warmup, &s, &lat);
+}
+#endif
+
+void th_final_initialize(void) {
+  // Der M7 hat RPC gestartet und damit diesen Kern gebootet; die Adresse
+  // liefert er erst, wenn info[] vollständig ist.
+  RPC.begin();
+  for (int tries = 0; tries < 50 && dc == nullptr; tries++) {
+    uint32_t addr = RPC.call("dc_shared").as<uint32_t>();
+    DualcoreShared* p = (DualcoreShared*)(uintptr_t)addr;
+    if (p != nullptr && p->info.magic == TH_DC_MAGIC) {
+      dc = p;
+    } else {
+      delay(100);
+    }
+  }
+  if (dc == nullptr) {
+    th_printf("FEHLER: M7 antwortet nicht (dc_shared)!\r\n");
+    return;
+  }
+  posted_seq = dc->done.seq;
+  dc->req.seq = posted_seq;
+  th_printf("DEBUG: Dual-Core aktiv, gemeinsamer Speicher 0x%X, Tiefe %d.\r\n",
+            (unsigned)(uintptr_t)dc, TH_DC_QUEUE_DEPTH);
+}
+
+const char* th_kernel_backend(void) {
+  return dc ? dc->info.kernel_backend : "unknown";
+}
+
+// Noch offene Warmups abarbeiten lassen, bevor ee_infer() den ersten
+// Timestamp setzt: sonst lägen bis zu TH_DC_QUEUE_DEPTH Warmups im
+// Messfenster, gezählt würden aber nur die n gemessenen
+void th_warmup_done(void) {
+  if (dc == nullptr) return;
+  WaitPending(0);
+}
+
+void th_pre() {
+  if (dc == nullptr) return;
+  // Der M7 zählt ab dem nächsten Auftrag neu
+  dc->req.stats_seq = ++stats_seq;
+  wall_start = micros();
+}
+void th_post() {
+  if (dc == nullptr) return;
+  WaitPending(0);
+  wall_us = (uint32_t)(micros() - wall_start);
+}
+
+#endif  // TH_GIGA_DUALCORE && TH_GIGA_M4
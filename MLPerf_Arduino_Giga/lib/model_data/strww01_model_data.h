@@ -2,16 +2,16 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00,
   0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00,
   0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xf4, 0xbf, 0x00, 0x00,
-  0x04, 0xc0, 0x00, 0x00, 0x68, 0x22, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x36, 0x3f, 0xff, 0xff,
+  0x80, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x64, 0xc0, 0x00, 0x00,
+  0x74, 0xc0, 0x00, 0x00, 0xd8, 0x22, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xc6, 0x3e, 0xff, 0xff,
   0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
   0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f,
   0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x04, 0x00, 0x00, 0x00, 0x9c, 0xff, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x00,
   0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x64, 0x65, 0x6e, 0x73,
   0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xd6, 0x3f, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x66, 0x3f, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
   0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x31, 0x00, 0x02, 0x00, 0x00, 0x00,
   0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xff,
   0x21, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
@@ -20,486 +20,490 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
   0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f,
   0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73,
-  0x69, 0x6f, 0x6e, 0x00, 0x22, 0x00, 0x00, 0x00, 0x18, 0xbf, 0x00, 0x00,
-  0x10, 0xbf, 0x00, 0x00, 0xf8, 0xbe, 0x00, 0x00, 0xdc, 0xbe, 0x00, 0x00,
-  0x6c, 0xbe, 0x00, 0x00, 0xdc, 0xbd, 0x00, 0x00, 0xcc, 0xad, 0x00, 0x00,
-  0x3c, 0xa6, 0x00, 0x00, 0x2c, 0xa4, 0x00, 0x00, 0x1c, 0x64, 0x00, 0x00,
-  0x0c, 0x5f, 0x00, 0x00, 0xfc, 0x5c, 0x00, 0x00, 0xec, 0x1c, 0x00, 0x00,
-  0xdc, 0x1a, 0x00, 0x00, 0xd4, 0x1a, 0x00, 0x00, 0xcc, 0x1a, 0x00, 0x00,
-  0x3c, 0x18, 0x00, 0x00, 0x2c, 0x16, 0x00, 0x00, 0x1c, 0x02, 0x00, 0x00,
-  0x6c, 0x01, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00,
-  0xd4, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00,
-  0xbc, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00,
-  0xa4, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
-  0x8c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xd2, 0x40, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x32, 0x2e, 0x31, 0x34,
-  0x2e, 0x30, 0x00, 0x00, 0x36, 0x41, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x34, 0x2e, 0x30, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xe0, 0xfe, 0xff,
-  0x48, 0xe0, 0xfe, 0xff, 0x4c, 0xe0, 0xfe, 0xff, 0x50, 0xe0, 0xfe, 0xff,
-  0x54, 0xe0, 0xfe, 0xff, 0x58, 0xe0, 0xfe, 0xff, 0x5c, 0xe0, 0xfe, 0xff,
-  0x60, 0xe0, 0xfe, 0xff, 0x64, 0xe0, 0xfe, 0xff, 0x68, 0xe0, 0xfe, 0xff,
-  0x6c, 0xe0, 0xfe, 0xff, 0x7e, 0x41, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x78, 0x00, 0x00, 0x00, 0x7f, 0x99, 0x7f, 0x14, 0xcd, 0x2f, 0x0a, 0x7f,
-  0x1c, 0xab, 0xbe, 0xff, 0xb2, 0x81, 0x62, 0x8c, 0x6d, 0xca, 0x13, 0x14,
-  0x81, 0x44, 0xb4, 0x64, 0x16, 0x02, 0xa6, 0x22, 0xe6, 0x7f, 0xae, 0x7f,
-  0x29, 0x7f, 0x92, 0xb1, 0x7f, 0xc5, 0x94, 0xf2, 0x5b, 0xe4, 0xd6, 0x81,
-  0x7f, 0x7f, 0x7f, 0x46, 0x81, 0x81, 0x81, 0x2b, 0x81, 0x3a, 0x7f, 0x81,
-  0xd6, 0x93, 0x7f, 0x26, 0x2a, 0xce, 0x81, 0xa0, 0x81, 0x7f, 0x21, 0xe4,
-  0xa1, 0xea, 0x41, 0xca, 0x7f, 0xc9, 0x26, 0xe4, 0xeb, 0x07, 0x81, 0x32,
-  0x8b, 0x81, 0xc8, 0xf9, 0x27, 0x05, 0xe9, 0x88, 0xf3, 0x22, 0x52, 0x81,
-  0x3d, 0xea, 0x86, 0xae, 0x81, 0x7f, 0x0b, 0x81, 0x60, 0x81, 0x63, 0x81,
-  0xff, 0xe3, 0x7f, 0x81, 0x7f, 0x4a, 0x7f, 0x89, 0xd9, 0xa2, 0x7f, 0x81,
-  0x94, 0x7f, 0x75, 0x7f, 0x02, 0x42, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x42, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x7e, 0x76, 0x6f, 0x10,
-  0x18, 0xfa, 0xb3, 0xd7, 0xc6, 0x2c, 0x13, 0xe5, 0xc3, 0xf9, 0x01, 0x21,
-  0x3a, 0x43, 0x05, 0xf1, 0x95, 0xbb, 0x2c, 0x91, 0xc9, 0x5a, 0xb9, 0x3e,
-  0x10, 0xbe, 0x81, 0x2a, 0x00, 0x33, 0xcd, 0x02, 0x34, 0xa9, 0xd9, 0x7a,
-  0x7f, 0x33, 0x52, 0x3b, 0xa9, 0x2d, 0x12, 0xdf, 0xba, 0xa1, 0xc6, 0x03,
-  0x40, 0xd4, 0xd8, 0x28, 0xf1, 0xe7, 0xba, 0x0a, 0x27, 0x18, 0xca, 0xf8,
-  0x2d, 0xdd, 0xd7, 0xc2, 0x07, 0x30, 0xf6, 0x2a, 0x62, 0x51, 0xc5, 0x0e,
-  0xfb, 0xd4, 0x14, 0x0d, 0x26, 0x00, 0x29, 0x24, 0xd3, 0x19, 0xe8, 0x13,
-  0x32, 0x12, 0x5f, 0x30, 0xc4, 0x81, 0x1f, 0xed, 0xff, 0x3b, 0xf9, 0xad,
-  0x36, 0x87, 0x0a, 0x29, 0x56, 0xe3, 0xf7, 0x39, 0x08, 0x28, 0x41, 0xb7,
-  0xf3, 0x13, 0xc7, 0x0b, 0x30, 0x06, 0xe4, 0xc9, 0x36, 0xfe, 0x0e, 0x44,
-  0xd1, 0x48, 0xe2, 0xe2, 0x10, 0x20, 0xf9, 0xee, 0x0c, 0xf9, 0xc3, 0xbd,
-  0x1c, 0xf6, 0x20, 0x08, 0xa1, 0x0c, 0xca, 0xb3, 0x12, 0xf8, 0xc5, 0x27,
-  0x19, 0xcc, 0xf7, 0xdb, 0xbd, 0xab, 0x33, 0xeb, 0x81, 0x2b, 0xa5, 0xb2,
-  0xe1, 0x15, 0xf8, 0xa4, 0x39, 0xe6, 0xa2, 0xda, 0x40, 0x2f, 0x31, 0xeb,
-  0xdd, 0xce, 0x2e, 0xdc, 0xea, 0xd4, 0xd0, 0xff, 0x53, 0xb5, 0x0d, 0xc8,
-  0x2f, 0xd0, 0x81, 0x26, 0xe4, 0x2c, 0x08, 0xd8, 0x20, 0xb7, 0x37, 0x4b,
-  0xe1, 0x16, 0x00, 0xe6, 0xdd, 0xd2, 0x78, 0x42, 0x81, 0x0a, 0x29, 0x22,
-  0xbe, 0xd2, 0x86, 0x11, 0x10, 0x64, 0x68, 0x48, 0xed, 0xe4, 0xf9, 0x08,
-  0xe6, 0xbb, 0x62, 0xc8, 0x2a, 0x7f, 0xf6, 0xc6, 0x4d, 0xd8, 0x05, 0x84,
-  0x19, 0xd9, 0xf5, 0x31, 0x23, 0xcd, 0xdf, 0x15, 0xcf, 0x0b, 0xd7, 0xbc,
-  0x45, 0xed, 0xcd, 0xcd, 0xe0, 0x2a, 0xe0, 0xf4, 0x38, 0x2f, 0x0d, 0x03,
-  0xf0, 0x9e, 0xea, 0x00, 0xbc, 0x11, 0x27, 0xc9, 0xb5, 0x00, 0x15, 0x08,
-  0x1a, 0x03, 0x76, 0x9b, 0x3c, 0x27, 0x44, 0xf2, 0x7f, 0xa3, 0x1d, 0xe6,
-  0x3c, 0xf1, 0xdd, 0x1b, 0x74, 0xdb, 0x20, 0xaf, 0x47, 0xfc, 0xcd, 0x16,
-  0x34, 0x35, 0x81, 0x1e, 0xb1, 0xef, 0x3a, 0xd4, 0x04, 0xf7, 0x99, 0xd4,
-  0xf9, 0x19, 0x1f, 0xd5, 0xef, 0xc4, 0x05, 0x31, 0xfc, 0xf9, 0x0e, 0x21,
-  0xc4, 0xc4, 0x64, 0x35, 0xf0, 0xcc, 0x08, 0x46, 0xed, 0x1b, 0x1f, 0xc9,
-  0x12, 0xdf, 0xab, 0x34, 0xbf, 0xfb, 0x11, 0x0a, 0x94, 0x7f, 0xb3, 0xcb,
-  0xda, 0xe0, 0xca, 0x51, 0x4d, 0x0b, 0x55, 0xda, 0x23, 0xed, 0xce, 0x15,
-  0x1c, 0xd9, 0xbe, 0xed, 0xc9, 0x3c, 0xd9, 0xf1, 0x21, 0xbd, 0x3c, 0x50,
-  0x81, 0xd3, 0xb1, 0xd4, 0x1c, 0x04, 0xc8, 0x17, 0xc2, 0x84, 0xb4, 0x0f,
-  0xcd, 0xf5, 0xe8, 0xd3, 0xf2, 0xfd, 0x2d, 0x05, 0x20, 0xf6, 0xf4, 0xe5,
-  0x07, 0x26, 0x0e, 0xe5, 0xee, 0x14, 0x2d, 0x0c, 0xd3, 0x45, 0x4c, 0x0e,
-  0x43, 0x07, 0x7f, 0x1b, 0xd5, 0x0e, 0xe4, 0xef, 0x51, 0x16, 0x16, 0x08,
-  0xe6, 0xf6, 0xf2, 0x03, 0xda, 0x05, 0x19, 0x1a, 0xc1, 0xf3, 0x0c, 0x00,
-  0x0d, 0xe0, 0xe5, 0x1c, 0xd6, 0xeb, 0x0a, 0xee, 0x30, 0x33, 0xf4, 0xf5,
-  0x27, 0xff, 0x04, 0x1f, 0xf8, 0xe2, 0xaf, 0xe1, 0x3f, 0xf5, 0xe8, 0x07,
-  0x7f, 0x1d, 0xf6, 0xf3, 0x02, 0x9b, 0xea, 0x22, 0x1c, 0xd6, 0x1d, 0x19,
-  0xf8, 0x17, 0x43, 0xf4, 0xfe, 0x32, 0xcd, 0x06, 0x35, 0x36, 0xea, 0xf7,
-  0xe6, 0x0e, 0xca, 0xa9, 0x04, 0x20, 0xf3, 0xd2, 0xf2, 0x07, 0xc2, 0x1b,
-  0xd4, 0x3b, 0x04, 0x10, 0x3c, 0x57, 0xd8, 0xfa, 0x81, 0xdf, 0x01, 0x11,
-  0xed, 0x48, 0x18, 0x91, 0x46, 0x91, 0x08, 0x77, 0x27, 0xe7, 0x06, 0xec,
-  0xbf, 0xcd, 0xa3, 0xc1, 0x60, 0xc6, 0x37, 0xab, 0xd1, 0x52, 0xf8, 0xba,
-  0xfd, 0x1e, 0x2e, 0xdf, 0x19, 0xfd, 0xeb, 0xff, 0x1b, 0xf9, 0x42, 0x01,
-  0x26, 0xed, 0x18, 0xd1, 0x31, 0x26, 0x0c, 0xfe, 0xe1, 0xf9, 0x03, 0xe0,
-  0x10, 0xf9, 0xdd, 0xf3, 0x39, 0x0c, 0xcf, 0xd0, 0xd1, 0x81, 0xfb, 0x21,
-  0xc1, 0x0a, 0x35, 0xef, 0x41, 0x3d, 0xda, 0x4a, 0x0e, 0x20, 0xe5, 0xfd,
-  0x3e, 0xc9, 0xec, 0xc1, 0xb1, 0xf1, 0x0d, 0x66, 0x21, 0x85, 0x27, 0x73,
-  0xdb, 0xf7, 0xca, 0xa0, 0x93, 0x7f, 0x22, 0xf1, 0x61, 0x9b, 0x91, 0x0d,
-  0x93, 0xe3, 0x02, 0xb7, 0xa2, 0xa5, 0xdf, 0x2b, 0xd7, 0x07, 0x3b, 0x1a,
-  0x02, 0x35, 0xdd, 0xeb, 0x1c, 0xef, 0x1f, 0xfc, 0x1b, 0xf2, 0xbb, 0x03,
-  0xd9, 0xee, 0x2b, 0xd9, 0xde, 0x10, 0xf8, 0x1a, 0xf5, 0x10, 0x08, 0x2e,
-  0xf3, 0xb5, 0x29, 0xe0, 0x1d, 0xf7, 0x32, 0xd0, 0xfd, 0x14, 0x81, 0xe6,
-  0x15, 0xf4, 0x0c, 0xfe, 0xd7, 0xc0, 0x4e, 0x7e, 0xff, 0xd9, 0xf2, 0x00,
-  0x17, 0x59, 0xdf, 0xd3, 0x19, 0x15, 0x2a, 0xff, 0x08, 0x1f, 0xf0, 0x04,
-  0xe7, 0x9c, 0xdb, 0xd7, 0xfd, 0x53, 0xbf, 0x65, 0x2a, 0xf4, 0x7f, 0xf6,
-  0x91, 0x38, 0xe0, 0xc9, 0x11, 0xc4, 0xf1, 0xd8, 0x49, 0xfc, 0x81, 0xe6,
-  0xcb, 0xaf, 0xeb, 0x39, 0x00, 0xe5, 0x05, 0x4a, 0x0a, 0xfc, 0x70, 0x4b,
-  0x0f, 0x21, 0xe0, 0xea, 0x76, 0xf2, 0x15, 0xfc, 0x23, 0x49, 0xdb, 0xf8,
-  0x72, 0xd8, 0xed, 0x03, 0x09, 0xe8, 0x46, 0xdf, 0xa8, 0xef, 0x35, 0x56,
-  0xbb, 0xe1, 0xed, 0xcf, 0x7d, 0xd3, 0xca, 0xca, 0xc7, 0x81, 0x53, 0xfb,
-  0x6a, 0xfc, 0xc9, 0x4a, 0xbe, 0x45, 0xe4, 0xd6, 0x91, 0x3c, 0xca, 0xf8,
-  0x07, 0x15, 0xd2, 0xc2, 0x3c, 0xe9, 0x44, 0xfa, 0x18, 0x33, 0xd1, 0x2c,
-  0x25, 0x1a, 0xe3, 0x55, 0xff, 0x44, 0x17, 0x08, 0xcf, 0xec, 0xf8, 0xd9,
-  0x29, 0x63, 0xbd, 0x81, 0x20, 0xdc, 0xe7, 0x0a, 0x36, 0x12, 0xf5, 0xec,
-  0xc8, 0x07, 0xec, 0xb9, 0xc4, 0xb1, 0xda, 0x19, 0xd9, 0xc4, 0x42, 0x1d,
-  0xfe, 0xd1, 0x46, 0x17, 0xbf, 0xc9, 0x0d, 0x36, 0x3f, 0x4a, 0x2e, 0x1a,
-  0xc2, 0x0d, 0xf6, 0x14, 0x4e, 0x7f, 0x87, 0xc9, 0xc7, 0x4a, 0xea, 0x18,
-  0xd4, 0x5b, 0xd1, 0xd7, 0xda, 0xeb, 0x06, 0xde, 0xb0, 0x1f, 0x05, 0x47,
-  0x0f, 0x37, 0x0a, 0xb6, 0x5b, 0x18, 0x01, 0x5e, 0xed, 0xbd, 0xe9, 0xdf,
-  0xe2, 0xe3, 0x11, 0xcf, 0x31, 0xe8, 0xcb, 0x0f, 0xcf, 0x81, 0x17, 0x29,
-  0x2f, 0x1d, 0xbf, 0xe4, 0x52, 0xea, 0xd2, 0x1e, 0xe7, 0x1b, 0xdc, 0x34,
-  0xfb, 0x0e, 0x07, 0xe7, 0x1e, 0x06, 0xf1, 0x16, 0xfa, 0xd0, 0x13, 0xed,
-  0xd0, 0xe4, 0x44, 0x45, 0xf9, 0xef, 0xca, 0x38, 0x59, 0x25, 0xcd, 0xbd,
-  0xe1, 0xf7, 0x81, 0x3e, 0xe4, 0xae, 0x2d, 0xc0, 0xc5, 0x12, 0x20, 0x0a,
-  0xfb, 0x02, 0xf2, 0xaf, 0xfb, 0x0b, 0x03, 0xcf, 0xca, 0xae, 0xde, 0x1b,
-  0xa8, 0xec, 0x3e, 0xff, 0xfc, 0xe6, 0x0a, 0x2c, 0xd7, 0x88, 0x8d, 0xac,
-  0xd3, 0xa5, 0xd8, 0xcf, 0xd8, 0x01, 0x03, 0x15, 0xe0, 0xe9, 0x25, 0xca,
-  0x1e, 0x34, 0xfc, 0x4a, 0x7f, 0xcd, 0xd6, 0x0d, 0x06, 0xee, 0xf3, 0xe7,
-  0x0f, 0x12, 0xed, 0x9a, 0xed, 0xee, 0x18, 0x57, 0x32, 0x30, 0x23, 0x3d,
-  0x51, 0xc0, 0x74, 0x08, 0xbd, 0xd4, 0xef, 0x2e, 0x28, 0xc9, 0x13, 0x50,
-  0x83, 0x4c, 0xc8, 0xc8, 0x37, 0x0c, 0xe6, 0xd6, 0xcc, 0x22, 0xdf, 0x3e,
-  0xbb, 0x81, 0xaa, 0xcd, 0x42, 0xe5, 0x1c, 0xc5, 0x22, 0x48, 0xc4, 0x20,
-  0x0d, 0xed, 0xfe, 0xfa, 0x0e, 0x01, 0xf8, 0xed, 0x01, 0x12, 0xe4, 0xed,
-  0xef, 0xef, 0xec, 0x14, 0x41, 0xda, 0xfd, 0xea, 0x2f, 0xfa, 0x26, 0x34,
-  0xf0, 0x2b, 0x15, 0xec, 0xe6, 0xd1, 0x7f, 0xac, 0xeb, 0x40, 0xae, 0x19,
-  0x47, 0x2b, 0x0a, 0xdd, 0x31, 0x0b, 0xa8, 0x31, 0xd7, 0xbe, 0xff, 0xf7,
-  0x0a, 0xd1, 0x18, 0xc0, 0xd4, 0xcb, 0x2a, 0xba, 0x08, 0xe9, 0x0d, 0x32,
-  0x92, 0x7f, 0x3c, 0x28, 0x19, 0xae, 0x3b, 0xe1, 0x47, 0x37, 0x0f, 0x3f,
-  0xe0, 0xbe, 0xe7, 0x1a, 0xed, 0x2a, 0x0a, 0x0c, 0x95, 0x1f, 0x3d, 0xe3,
-  0xdf, 0xea, 0x1c, 0xdd, 0x48, 0xd7, 0xe6, 0xe6, 0xfd, 0xff, 0x7f, 0xd0,
-  0xc6, 0x23, 0xed, 0xe7, 0x32, 0x50, 0xef, 0xde, 0x17, 0x05, 0xb5, 0x9c,
-  0xef, 0xed, 0x08, 0x53, 0xe5, 0x2e, 0xf6, 0x52, 0x19, 0x41, 0xed, 0x79,
-  0xca, 0x61, 0xcf, 0x12, 0x74, 0x7e, 0x5d, 0x51, 0xf6, 0xc8, 0x4e, 0xff,
-  0x0e, 0xf0, 0x10, 0x04, 0xe0, 0x36, 0x87, 0x41, 0x86, 0x3d, 0xfe, 0x02,
-  0x30, 0x01, 0x0a, 0xf0, 0x10, 0xd2, 0xd8, 0x40, 0xeb, 0xea, 0x81, 0x8b,
-  0x63, 0xdb, 0xcd, 0xc7, 0x0c, 0xb7, 0xe1, 0xdc, 0xd2, 0x41, 0xf4, 0x44,
-  0xee, 0x20, 0x0b, 0xf7, 0xa2, 0x98, 0x34, 0x24, 0x7f, 0xde, 0x57, 0x3a,
-  0xda, 0x56, 0x1e, 0x44, 0x47, 0xb6, 0x58, 0x29, 0xb4, 0x4a, 0xc9, 0x55,
-  0x28, 0x03, 0x28, 0xf6, 0x19, 0xb7, 0x22, 0xc9, 0xf3, 0xee, 0xe3, 0xf1,
-  0x05, 0xc1, 0xcf, 0x81, 0xd8, 0xf0, 0xd8, 0x17, 0xe1, 0x93, 0x1a, 0x0d,
-  0xf5, 0x92, 0x23, 0xdc, 0x07, 0x14, 0xe2, 0x08, 0x06, 0xe4, 0x36, 0x31,
-  0x0a, 0x2a, 0xf0, 0x33, 0x39, 0xf3, 0xf9, 0x3b, 0xfd, 0x02, 0x04, 0xe2,
-  0x7f, 0xdb, 0x69, 0xd4, 0x1f, 0xc6, 0x6d, 0x5b, 0xfc, 0xc8, 0xa9, 0x51,
-  0x2b, 0xf1, 0x82, 0x0b, 0x18, 0x28, 0xa7, 0xdf, 0x37, 0x19, 0xb1, 0xed,
-  0x36, 0x05, 0x13, 0x54, 0x1e, 0x0c, 0xbc, 0x62, 0xf1, 0x39, 0xa5, 0x63,
-  0x39, 0x29, 0xc9, 0x57, 0x8f, 0x3a, 0x5b, 0x0a, 0x99, 0x4f, 0xb6, 0xd9,
-  0xf1, 0x33, 0x15, 0x7f, 0x22, 0x18, 0x16, 0xa9, 0xaf, 0xfc, 0xd0, 0x15,
-  0xf7, 0x31, 0xf7, 0xf5, 0x02, 0x45, 0x41, 0xfa, 0xbf, 0xf9, 0x54, 0x29,
-  0x7c, 0xfa, 0x1c, 0xda, 0xd3, 0x22, 0x53, 0xbf, 0x08, 0xfd, 0xa2, 0xe9,
-  0xe3, 0x0b, 0xe6, 0x7f, 0xbd, 0xd5, 0x30, 0x0c, 0x1e, 0x48, 0xad, 0x10,
-  0xee, 0x30, 0x50, 0x9b, 0x47, 0xda, 0x50, 0x63, 0x36, 0x18, 0x04, 0xda,
-  0xf8, 0x13, 0xfe, 0x09, 0x14, 0x2b, 0xd8, 0x04, 0xfd, 0xce, 0xa5, 0xf0,
-  0x4a, 0x44, 0x12, 0x94, 0x2b, 0x17, 0xe3, 0xcd, 0x7f, 0x2e, 0x1a, 0xbd,
-  0x38, 0xbb, 0x01, 0xda, 0xe6, 0x04, 0xf8, 0xe0, 0xe8, 0x0f, 0xd1, 0x19,
-  0xdb, 0xe1, 0x0d, 0xd2, 0x33, 0xed, 0xd5, 0x1f, 0xcf, 0xf8, 0x2e, 0xd8,
-  0x25, 0x27, 0x28, 0x27, 0x3b, 0xff, 0xee, 0xf9, 0xd2, 0xec, 0x00, 0x16,
-  0x2a, 0xe3, 0xea, 0xdd, 0x26, 0x18, 0x81, 0x43, 0xae, 0xdd, 0x66, 0xd7,
-  0xd9, 0x1e, 0xe8, 0xee, 0x1d, 0x29, 0x26, 0x42, 0xf2, 0x28, 0x09, 0x0e,
-  0x0c, 0x0c, 0x3d, 0x19, 0x22, 0x0b, 0x0b, 0xe6, 0x01, 0x00, 0xaf, 0x33,
-  0x11, 0xd9, 0x63, 0xe2, 0x89, 0xaf, 0x15, 0x1f, 0xf8, 0x5b, 0xf0, 0x97,
-  0x0a, 0xe6, 0xda, 0x4b, 0x09, 0x4e, 0x7f, 0xf0, 0x3a, 0xf1, 0xee, 0xdb,
-  0x0b, 0x1d, 0xfd, 0x18, 0xe0, 0xf1, 0xca, 0xe5, 0x43, 0x27, 0xc8, 0x25,
-  0x0c, 0xd5, 0x25, 0x19, 0xd2, 0xf7, 0x0b, 0xdb, 0xce, 0xfe, 0x53, 0xc1,
-  0x3d, 0xfa, 0x24, 0xdc, 0x7f, 0x09, 0x0e, 0xc4, 0xe6, 0xcc, 0x0f, 0x26,
-  0xfd, 0x8b, 0x38, 0x29, 0x24, 0x1d, 0x16, 0xc5, 0xf1, 0x18, 0x28, 0xeb,
-  0xeb, 0xf0, 0x88, 0xdd, 0xeb, 0x07, 0x32, 0x00, 0x31, 0xc0, 0xda, 0x12,
-  0xd6, 0x55, 0xc6, 0x18, 0x1c, 0xce, 0xfc, 0xe8, 0xd9, 0x05, 0xdd, 0x8c,
-  0x57, 0x29, 0x81, 0x3e, 0xe8, 0x28, 0xb3, 0x72, 0xe6, 0x2d, 0xea, 0x2c,
-  0x22, 0xe1, 0xef, 0x30, 0xce, 0xf8, 0x04, 0x5c, 0x07, 0x18, 0x0c, 0x1c,
-  0xe8, 0xd6, 0x27, 0xfd, 0xcf, 0xcc, 0xec, 0xe3, 0xf4, 0x02, 0xc9, 0x17,
-  0x38, 0xe7, 0xf2, 0xef, 0x3b, 0x1c, 0x12, 0xf5, 0x49, 0x0b, 0x5e, 0x35,
-  0xc0, 0x72, 0x7f, 0xb7, 0xc9, 0x41, 0x04, 0xe2, 0x1e, 0x38, 0xa9, 0xbb,
-  0x05, 0x15, 0x4e, 0x3a, 0x19, 0xc2, 0xf7, 0xe7, 0x76, 0xe8, 0x4c, 0xde,
-  0xd1, 0xc9, 0x17, 0xde, 0xdd, 0xb3, 0x05, 0x81, 0x65, 0x84, 0x9d, 0x48,
-  0xe8, 0xc7, 0xb4, 0x42, 0xeb, 0xd3, 0x2e, 0xe8, 0xf4, 0xfd, 0xb6, 0x3f,
-  0x15, 0x43, 0x2f, 0x26, 0x18, 0xeb, 0x44, 0x1e, 0xf1, 0xab, 0xc0, 0xe7,
-  0xe3, 0x83, 0x9d, 0x01, 0x7d, 0xfc, 0xbc, 0xfc, 0xc9, 0x81, 0x5e, 0x35,
-  0xd1, 0x35, 0x41, 0x12, 0x47, 0xdc, 0x46, 0x0e, 0x13, 0x42, 0xe6, 0xf3,
-  0x3b, 0x02, 0xfb, 0x13, 0x03, 0xe1, 0xd6, 0xed, 0x1f, 0xae, 0xec, 0x97,
-  0xff, 0xf9, 0xed, 0xe9, 0xd7, 0x4c, 0x7f, 0x03, 0x40, 0xc5, 0x11, 0x21,
-  0x49, 0xe8, 0xf2, 0x18, 0xeb, 0xbf, 0xc0, 0xdd, 0xe4, 0xa6, 0x01, 0x01,
-  0xf9, 0xd5, 0x5b, 0x43, 0xe5, 0x03, 0x93, 0xcf, 0xf7, 0xf0, 0x1b, 0x27,
-  0x17, 0x0c, 0x81, 0xc8, 0xe2, 0xdc, 0xd7, 0xb0, 0x5c, 0x21, 0xb0, 0x20,
-  0xd9, 0xbe, 0xfb, 0x30, 0xf7, 0xba, 0xf9, 0x57, 0x88, 0x27, 0xf3, 0xc3,
-  0xf7, 0x3c, 0xbe, 0x4c, 0xee, 0x05, 0x3e, 0x8e, 0x42, 0x15, 0xff, 0x9f,
-  0x1f, 0x39, 0x20, 0xeb, 0x11, 0x1f, 0x23, 0xc7, 0xe6, 0x07, 0x1e, 0x08,
-  0x07, 0x08, 0xc9, 0x7f, 0x04, 0x13, 0x31, 0x32, 0xc8, 0xec, 0x3e, 0xfa,
-  0xdb, 0x0a, 0x0a, 0xf1, 0x0f, 0x0c, 0x06, 0xba, 0x39, 0xff, 0xb9, 0x0e,
-  0xb7, 0xee, 0x01, 0xd2, 0x01, 0xfc, 0x50, 0x3e, 0x9f, 0xe1, 0xe6, 0xe6,
-  0x0d, 0x92, 0x34, 0xaf, 0x8f, 0xf6, 0x24, 0x7f, 0x06, 0xbb, 0x00, 0xe4,
-  0xe3, 0x0e, 0x67, 0x4e, 0xcf, 0x58, 0xca, 0x0c, 0x60, 0xc8, 0x3e, 0xc2,
-  0x66, 0x6e, 0x03, 0x63, 0xf8, 0x43, 0xeb, 0x17, 0x10, 0x12, 0x23, 0x03,
-  0xec, 0x27, 0x36, 0xdd, 0x08, 0xb2, 0x63, 0xad, 0xd6, 0x78, 0xcb, 0x6b,
-  0x35, 0x7f, 0x5f, 0xca, 0xfa, 0xf0, 0x26, 0x4d, 0x1a, 0xde, 0xad, 0x2e,
-  0x0b, 0x17, 0x06, 0x06, 0x36, 0xe0, 0xe2, 0x12, 0xec, 0x36, 0x3b, 0x0c,
-  0x51, 0x30, 0xaf, 0x27, 0xf3, 0xd8, 0x07, 0x81, 0x03, 0xce, 0xab, 0x2a,
-  0x22, 0xae, 0xe4, 0xce, 0xd8, 0x0f, 0x15, 0x19, 0xb6, 0x35, 0xa0, 0x3f,
-  0xff, 0xdc, 0xbe, 0x14, 0x25, 0xc3, 0xe5, 0x0e, 0x01, 0x41, 0xf8, 0x02,
-  0x44, 0x12, 0x43, 0xec, 0xf9, 0xc1, 0x7a, 0xdb, 0x09, 0x3a, 0x0d, 0xb3,
-  0x01, 0xb7, 0xc8, 0x29, 0xe8, 0xd6, 0xcd, 0x7f, 0xf2, 0xd2, 0x37, 0xe1,
-  0x29, 0xdd, 0x39, 0x6d, 0xd6, 0xf3, 0x0b, 0x3f, 0x42, 0xa0, 0x17, 0x0e,
-  0xc3, 0x1d, 0xfb, 0x02, 0x45, 0x39, 0xfc, 0xcb, 0x0c, 0x29, 0x01, 0xee,
-  0x0b, 0xcf, 0x1f, 0xc8, 0x05, 0x3f, 0xd9, 0xf8, 0xd6, 0x3d, 0xeb, 0x32,
-  0x5e, 0xdb, 0x0a, 0x04, 0xcb, 0xe5, 0xe7, 0x17, 0xfc, 0xd3, 0xe0, 0xdc,
-  0x3f, 0xc7, 0xa3, 0x26, 0x07, 0x28, 0x46, 0xf0, 0xe3, 0xf1, 0x2d, 0x56,
-  0x7f, 0xca, 0x0f, 0x1d, 0x15, 0xf9, 0x3e, 0xe6, 0xe3, 0x17, 0x1d, 0x0d,
-  0xeb, 0xcc, 0x07, 0x53, 0x47, 0xe0, 0x2e, 0xf7, 0xad, 0x23, 0x38, 0xc3,
-  0x25, 0xed, 0xc9, 0x7f, 0x3c, 0xd1, 0xdc, 0x30, 0x19, 0xcb, 0x23, 0x05,
-  0xfd, 0x4b, 0x47, 0x1f, 0xd2, 0xf4, 0x01, 0x00, 0x2b, 0xe7, 0x0b, 0x7f,
-  0x92, 0x9d, 0xe2, 0x03, 0xee, 0xe7, 0x0d, 0xf5, 0xd9, 0xbc, 0xcd, 0x09,
-  0xe4, 0xee, 0xf5, 0x11, 0x1a, 0xd0, 0xfd, 0xfd, 0x23, 0x28, 0x05, 0x22,
-  0xd5, 0x33, 0x38, 0x29, 0xde, 0x1d, 0xea, 0xe6, 0x0d, 0x22, 0xbe, 0xe3,
-  0x20, 0xed, 0xd1, 0x93, 0x39, 0xc3, 0xdf, 0x28, 0x7f, 0x02, 0xf4, 0x04,
-  0x3d, 0xec, 0xeb, 0xe4, 0xeb, 0x16, 0xf6, 0x00, 0xdb, 0xc5, 0xf2, 0x0b,
-  0x22, 0x21, 0xb8, 0x1f, 0x0c, 0xf0, 0x1f, 0xfa, 0x1b, 0xf1, 0xfb, 0xc7,
-  0x16, 0xd6, 0x2f, 0x05, 0xbf, 0x5e, 0x3b, 0x09, 0x15, 0x27, 0x23, 0xf7,
-  0x1d, 0xe7, 0xa7, 0xbe, 0xd6, 0x7f, 0xe5, 0x2a, 0xf9, 0xc4, 0x2c, 0x20,
-  0xbe, 0x4a, 0xe8, 0x64, 0xa3, 0x1c, 0x17, 0x16, 0xfc, 0x99, 0x30, 0xac,
-  0x31, 0xa4, 0x7d, 0x08, 0x8f, 0x31, 0x20, 0xf0, 0xee, 0x3d, 0xd0, 0x58,
-  0x66, 0x05, 0xfe, 0x8c, 0x2f, 0x06, 0x0c, 0x07, 0x39, 0xc7, 0x3a, 0x11,
-  0xaa, 0xe8, 0x37, 0xc4, 0x37, 0xcb, 0xce, 0xf0, 0x11, 0x22, 0xe6, 0x1a,
-  0x8a, 0x7f, 0xfb, 0x20, 0xf6, 0x15, 0xf0, 0x30, 0xbd, 0xd0, 0xcc, 0xf0,
-  0xd2, 0x30, 0x3b, 0xd9, 0x0a, 0x1a, 0xe1, 0x02, 0x1c, 0xec, 0xca, 0xcd,
-  0x25, 0xe3, 0xeb, 0xf8, 0x1a, 0x07, 0xcc, 0x23, 0x05, 0x0f, 0x17, 0xdd,
-  0x12, 0x61, 0x22, 0xd9, 0xf7, 0xf7, 0xaa, 0xff, 0x40, 0x50, 0xe7, 0x11,
-  0x25, 0xd2, 0x7f, 0x91, 0xf5, 0x0f, 0xec, 0x1a, 0xe7, 0xf6, 0x15, 0xcb,
-  0x15, 0x34, 0xfa, 0xd2, 0xe3, 0x0a, 0x04, 0xc2, 0x03, 0x18, 0xf3, 0x43,
-  0xd9, 0x01, 0xee, 0xe6, 0xea, 0xfd, 0xde, 0xed, 0x2b, 0x27, 0xfa, 0x5f,
-  0xfa, 0x4a, 0xdc, 0xff, 0x7f, 0xd3, 0xaa, 0xf5, 0x0f, 0xef, 0x7f, 0xb3,
-  0x08, 0xdf, 0xcd, 0xf2, 0x35, 0xfa, 0x3f, 0xcb, 0xf1, 0xe4, 0xb0, 0xe7,
-  0xbf, 0x2a, 0xf4, 0x5d, 0xd4, 0xf7, 0xd8, 0x11, 0x15, 0x54, 0xf7, 0xc1,
-  0x16, 0xf6, 0xd5, 0xec, 0xf7, 0xd4, 0xc4, 0x0b, 0xdc, 0x72, 0x3f, 0x22,
-  0x73, 0x18, 0xc7, 0xe2, 0x06, 0x2a, 0xe2, 0x43, 0x30, 0x30, 0xf5, 0x0d,
-  0xca, 0x18, 0xdd, 0x30, 0xcb, 0x38, 0xd8, 0xe3, 0x34, 0x07, 0x11, 0x25,
-  0xeb, 0x39, 0xdf, 0xdd, 0x3a, 0xd5, 0x8a, 0x72, 0xce, 0x30, 0x85, 0x1d,
-  0x5e, 0x81, 0x38, 0x87, 0x35, 0xe5, 0x23, 0x18, 0xeb, 0xde, 0xe3, 0x7f,
-  0x2b, 0xfd, 0x33, 0xee, 0xa9, 0xd9, 0x54, 0x18, 0x34, 0xb1, 0x2b, 0x12,
-  0xeb, 0xc5, 0x30, 0x0d, 0x21, 0x3c, 0xca, 0x33, 0xb2, 0x37, 0xdc, 0x36,
-  0x0b, 0x59, 0xfc, 0x01, 0x03, 0x1e, 0x00, 0xf4, 0x69, 0x00, 0x7f, 0x36,
-  0xe6, 0x0c, 0x11, 0x1b, 0xe1, 0xd1, 0x30, 0xe8, 0x3b, 0x02, 0xaa, 0xec,
-  0xd7, 0xee, 0xfc, 0x0b, 0x29, 0xdf, 0xcd, 0xd4, 0x4f, 0x0d, 0xf8, 0x1f,
-  0xe9, 0x04, 0x09, 0x21, 0xe8, 0x04, 0xd1, 0xda, 0x3f, 0xd6, 0x02, 0xf7,
-  0x7f, 0x48, 0x51, 0x08, 0x27, 0x41, 0x55, 0x55, 0xb3, 0x39, 0x44, 0x4b,
-  0xfa, 0x14, 0xca, 0x63, 0x96, 0x06, 0x35, 0xe9, 0x5e, 0x17, 0x11, 0xf6,
-  0x3a, 0x1a, 0xed, 0xce, 0x0c, 0xa7, 0xc7, 0x10, 0xf5, 0x18, 0x1a, 0x01,
-  0xe6, 0xc2, 0x29, 0x63, 0x64, 0x42, 0xd9, 0x21, 0x14, 0x03, 0x67, 0xc4,
-  0xcc, 0xe9, 0xdb, 0x3a, 0x17, 0xf6, 0x0b, 0x0e, 0xe9, 0x2c, 0xd1, 0xe4,
-  0x05, 0x26, 0xe2, 0xfe, 0xe7, 0xf7, 0xf1, 0x81, 0x1a, 0xec, 0x9f, 0x74,
-  0xb4, 0x0b, 0xa4, 0x13, 0x54, 0xb2, 0x3d, 0x31, 0x47, 0xdc, 0x7f, 0x1c,
-  0xe0, 0xa2, 0xa0, 0x97, 0xb0, 0xe1, 0xfe, 0x4a, 0x05, 0xe0, 0xea, 0xc8,
-  0x07, 0xd1, 0x43, 0x01, 0x02, 0x32, 0x64, 0x40, 0x54, 0xf2, 0xfa, 0xaf,
-  0x50, 0x16, 0xff, 0x20, 0xdf, 0x44, 0xea, 0x2b, 0xf6, 0xaa, 0xca, 0x26,
-  0x01, 0x52, 0xc8, 0xf6, 0xf4, 0xb9, 0x06, 0x24, 0x6a, 0x92, 0xa0, 0xba,
-  0xdf, 0xfc, 0xbf, 0x3b, 0xe3, 0x28, 0xa2, 0x61, 0xa4, 0xd7, 0xd5, 0xc2,
-  0x17, 0x1a, 0x12, 0x29, 0x30, 0x51, 0x5f, 0xbe, 0x12, 0x0c, 0x1a, 0x60,
-  0x0c, 0xd0, 0x81, 0xb7, 0xe0, 0x92, 0xf5, 0xf1, 0xdb, 0x45, 0x7f, 0xf5,
-  0xc5, 0x09, 0x7d, 0x34, 0xf4, 0x16, 0x02, 0x3c, 0xf2, 0xb8, 0x27, 0xd6,
-  0xdc, 0x16, 0x3e, 0xf6, 0x43, 0x3a, 0x0c, 0x52, 0x18, 0xd2, 0x3a, 0x65,
-  0xbe, 0x23, 0xc9, 0x38, 0xec, 0xd0, 0x8d, 0x3e, 0xe4, 0xe5, 0xed, 0xfd,
-  0x02, 0xf7, 0xb0, 0xe7, 0x06, 0xd3, 0xd9, 0x13, 0x17, 0x1a, 0x40, 0xff,
-  0x22, 0xbe, 0xea, 0x1a, 0xf1, 0x3b, 0xff, 0xe0, 0xd2, 0xfb, 0xc5, 0x11,
-  0x0a, 0xce, 0xee, 0xca, 0xfc, 0xf9, 0x45, 0xc0, 0x81, 0x41, 0xe7, 0x1f,
-  0x2d, 0xdb, 0x88, 0x36, 0xae, 0x2b, 0x3d, 0x7a, 0x87, 0x81, 0x5d, 0x18,
-  0x68, 0x6e, 0xf8, 0x9f, 0xcb, 0xb4, 0x20, 0x7c, 0x00, 0xe9, 0x30, 0xe0,
-  0x16, 0xed, 0xf5, 0x20, 0x06, 0x19, 0xe6, 0x07, 0xbe, 0x28, 0x05, 0x18,
-  0x2b, 0x21, 0xdd, 0x05, 0x38, 0x06, 0xee, 0x04, 0x2e, 0xe7, 0xeb, 0xcb,
-  0xa9, 0x08, 0x1a, 0xf5, 0x09, 0x24, 0x7f, 0xd3, 0xf9, 0x3c, 0xd5, 0xca,
-  0x01, 0x2f, 0xdb, 0x0a, 0x4b, 0x19, 0x1e, 0x37, 0x3c, 0x1e, 0x40, 0xb8,
-  0xc9, 0xe1, 0x36, 0x02, 0x2d, 0x97, 0xd3, 0xe5, 0x13, 0x25, 0x4c, 0x26,
-  0xe0, 0xae, 0xd0, 0xf6, 0xd8, 0x0b, 0xcf, 0x1a, 0xfc, 0x11, 0x10, 0xe9,
-  0xc8, 0xfe, 0x56, 0x9d, 0x55, 0x23, 0x1d, 0x1a, 0x3d, 0xdd, 0x81, 0x5b,
-  0xc0, 0x41, 0x12, 0xd8, 0xf1, 0x08, 0xfc, 0x13, 0xd8, 0xfb, 0x07, 0x43,
-  0x01, 0xc7, 0x60, 0xce, 0x18, 0xbd, 0x04, 0x0f, 0x3c, 0x46, 0x04, 0xfe,
-  0xdb, 0x2d, 0xcf, 0x0b, 0x81, 0x4c, 0x1b, 0x27, 0xc5, 0xe5, 0xfc, 0xc6,
-  0xf3, 0x15, 0xb6, 0xf6, 0x10, 0x23, 0x28, 0x37, 0x17, 0x32, 0x14, 0xec,
-  0xe1, 0x1f, 0x2d, 0xcb, 0x12, 0xc7, 0x3c, 0x0d, 0x99, 0xe0, 0x40, 0xf1,
-  0xd4, 0x84, 0x24, 0x17, 0xcf, 0x62, 0xee, 0xc8, 0xad, 0x0e, 0xe1, 0x28,
-  0xf0, 0x3a, 0xab, 0x40, 0x4c, 0xc2, 0xf9, 0x97, 0x07, 0x06, 0x21, 0xf4,
-  0x1e, 0x7f, 0xa7, 0x03, 0xc3, 0xf2, 0xeb, 0xfd, 0x7f, 0xb9, 0xca, 0x18,
-  0xe7, 0x05, 0x01, 0x00, 0x55, 0x09, 0x13, 0xfb, 0xb4, 0xfd, 0x1b, 0x2f,
-  0x08, 0xf8, 0x30, 0xfe, 0x69, 0xef, 0x22, 0xd8, 0xf0, 0x0a, 0xf8, 0xfb,
-  0x9d, 0xc7, 0x9e, 0xd7, 0xe0, 0x00, 0xf4, 0x12, 0x2b, 0x06, 0x4c, 0xbb,
-  0x5d, 0x5c, 0xc7, 0xea, 0x11, 0xe7, 0xeb, 0x33, 0xeb, 0x20, 0xd2, 0x58,
-  0x1e, 0xb7, 0x14, 0xd5, 0xda, 0x09, 0x41, 0x81, 0x58, 0xba, 0x0e, 0x2c,
-  0x08, 0x1d, 0x91, 0x70, 0x94, 0xbd, 0xc3, 0xf1, 0x29, 0xfa, 0xf9, 0xf8,
-  0xb6, 0x08, 0x29, 0x22, 0x10, 0x9b, 0x7e, 0x39, 0xf7, 0xfe, 0xd1, 0x13,
-  0x81, 0x90, 0x07, 0xe8, 0xa9, 0xee, 0x46, 0x16, 0x16, 0x54, 0xbe, 0xda,
-  0x40, 0x25, 0x51, 0xc3, 0x36, 0xf1, 0x01, 0xf2, 0xf5, 0x3f, 0xd3, 0x1c,
-  0x91, 0xb5, 0xdb, 0x4b, 0x15, 0x23, 0xcb, 0x4a, 0x48, 0xd6, 0xe4, 0xe2,
-  0xff, 0xfd, 0xd9, 0x19, 0x27, 0xd7, 0xbd, 0xff, 0x4d, 0xf4, 0x86, 0x35,
-  0x07, 0xc1, 0xf1, 0x0d, 0xda, 0xe4, 0x18, 0xf5, 0x45, 0x04, 0xfd, 0xe1,
-  0x19, 0x4e, 0xf2, 0x7f, 0xed, 0x18, 0xd7, 0x0c, 0xfd, 0x54, 0x0c, 0xd1,
-  0xf1, 0xf2, 0xcd, 0xf6, 0x2c, 0xdf, 0x1d, 0x16, 0x22, 0x76, 0xff, 0x95,
-  0xb3, 0xd2, 0x12, 0xf0, 0x14, 0xd1, 0xee, 0x5b, 0xff, 0xae, 0x0b, 0x1d,
-  0xcd, 0x7f, 0xf1, 0xc7, 0xd5, 0x1c, 0x44, 0x20, 0xd6, 0xf2, 0xe6, 0xdb,
-  0xeb, 0x0e, 0xc9, 0x99, 0x5f, 0x0b, 0xeb, 0xee, 0xc6, 0x1d, 0xd9, 0x10,
-  0x54, 0x40, 0xf1, 0x9f, 0x05, 0xe2, 0xe9, 0x34, 0x19, 0x78, 0x27, 0xa9,
-  0xf7, 0xe7, 0xc7, 0xf2, 0xfc, 0x16, 0xf7, 0x33, 0xdd, 0x81, 0x33, 0xce,
-  0x24, 0x40, 0x6a, 0x0e, 0xe8, 0x06, 0xb7, 0xfb, 0xd6, 0xfc, 0xf0, 0xb4,
-  0xd7, 0xbf, 0xd8, 0x0e, 0x0d, 0xc5, 0xe6, 0xdd, 0x37, 0x08, 0xbf, 0xf6,
-  0x3d, 0x0d, 0x1a, 0xea, 0xef, 0xeb, 0xf0, 0x2d, 0xd6, 0xed, 0xf4, 0xcd,
-  0xff, 0xf6, 0xc7, 0xf6, 0x4b, 0x56, 0xf3, 0xa3, 0x81, 0x33, 0xfb, 0xa7,
-  0xe4, 0xa8, 0xc1, 0x2b, 0xb1, 0xdf, 0x4f, 0x74, 0x23, 0xcb, 0xdd, 0x61,
-  0x41, 0x28, 0x74, 0x93, 0x6f, 0x4c, 0x1e, 0x20, 0xdf, 0xe3, 0x7f, 0xe8,
-  0x01, 0xed, 0x49, 0xf9, 0xd6, 0x20, 0xfd, 0x56, 0xe3, 0x4c, 0x1c, 0x14,
-  0x28, 0x3a, 0xdd, 0x1b, 0x7f, 0x23, 0xfa, 0xf8, 0x3e, 0x2b, 0x2a, 0x33,
-  0xf4, 0x1b, 0x66, 0x32, 0x06, 0xd1, 0xf7, 0x11, 0xdf, 0x29, 0xca, 0xe0,
-  0x45, 0xb4, 0x2d, 0x46, 0xf5, 0xe5, 0xe5, 0x17, 0x47, 0xc4, 0x38, 0x15,
-  0x14, 0xed, 0xf4, 0xdd, 0xf3, 0x3f, 0x27, 0x08, 0xe0, 0x02, 0xf7, 0x2e,
-  0xe5, 0x1d, 0xe6, 0xfb, 0xf8, 0xc3, 0xd2, 0xdb, 0x3d, 0x2d, 0x08, 0xf5,
-  0x7f, 0xa5, 0xc9, 0x2b, 0xec, 0x50, 0x87, 0xac, 0xc1, 0xf1, 0xe6, 0x1f,
-  0x05, 0xc1, 0x76, 0x88, 0x2a, 0x2b, 0xca, 0x11, 0x15, 0x08, 0xd3, 0xd0,
-  0x19, 0x95, 0xe6, 0xaf, 0xf3, 0xca, 0x06, 0x7f, 0xea, 0xf6, 0x0e, 0x1b,
-  0x21, 0xe6, 0xc8, 0x4b, 0xde, 0xf9, 0xe6, 0xfa, 0x13, 0xe7, 0x3f, 0xfb,
-  0xca, 0xe4, 0xf1, 0x1a, 0xd3, 0x12, 0x04, 0x27, 0x2c, 0xfa, 0xee, 0x1f,
-  0xef, 0x0e, 0x53, 0x14, 0x5f, 0xfc, 0x91, 0xbe, 0x54, 0xe8, 0x58, 0x8a,
-  0x54, 0x71, 0x3e, 0x6c, 0x17, 0xc9, 0x2d, 0x49, 0xe2, 0x37, 0xbb, 0xd8,
-  0xaf, 0xa5, 0xda, 0xf4, 0xde, 0x08, 0x12, 0xd5, 0xd8, 0x0b, 0x0a, 0x1d,
-  0x7f, 0x36, 0xd4, 0x07, 0x09, 0xb9, 0xf4, 0xdf, 0x40, 0x2d, 0xbc, 0xc6,
-  0xee, 0xd7, 0x6c, 0x5d, 0xba, 0xf1, 0x2f, 0x81, 0x4c, 0x02, 0x18, 0x15,
-  0xf3, 0xbf, 0xe4, 0x1d, 0x86, 0x7e, 0x29, 0x87, 0x87, 0x8c, 0x1e, 0x0c,
-  0x69, 0xf3, 0x55, 0x03, 0xca, 0x8c, 0x30, 0x13, 0xa1, 0xab, 0x06, 0xde,
-  0x02, 0xbf, 0xea, 0xf5, 0xd4, 0x1d, 0x12, 0xf3, 0x7f, 0x51, 0x59, 0x9e,
-  0x9d, 0xf1, 0x40, 0xdb, 0x65, 0xeb, 0x1d, 0xf6, 0x41, 0xa7, 0xdd, 0xe6,
-  0xad, 0x94, 0x0e, 0x4a, 0xd9, 0xf6, 0xf2, 0xe1, 0xf5, 0xe3, 0x39, 0x31,
-  0xe9, 0x26, 0xe5, 0xae, 0xb9, 0xb5, 0x81, 0x54, 0xa7, 0xcd, 0x08, 0xba,
-  0x2d, 0xca, 0xfa, 0x30, 0x09, 0xe5, 0xe1, 0xcf, 0x96, 0xe6, 0x2f, 0xa8,
-  0x58, 0x82, 0x94, 0xc3, 0x5d, 0xdb, 0x19, 0x0a, 0x28, 0x43, 0x1e, 0x8e,
-  0x96, 0xb9, 0xd7, 0x4a, 0x26, 0xa1, 0x0e, 0x75, 0xc8, 0xba, 0x6b, 0x06,
-  0xde, 0xba, 0x9e, 0xe8, 0xca, 0xbf, 0xa4, 0xbe, 0xd7, 0x34, 0xc1, 0x5f,
-  0xe0, 0x0e, 0xd9, 0xfa, 0xd2, 0xba, 0xd3, 0xed, 0xcf, 0xe7, 0xeb, 0x1b,
-  0x4a, 0xdc, 0xc4, 0x2c, 0x42, 0xe0, 0x45, 0x81, 0x1b, 0x32, 0x50, 0xc9,
-  0x21, 0x2b, 0xf0, 0x15, 0xf1, 0xdf, 0xce, 0x21, 0xe1, 0x61, 0xd6, 0xda,
-  0x08, 0xfe, 0x12, 0x14, 0x40, 0x19, 0x1b, 0x3f, 0xe2, 0xfa, 0xeb, 0x17,
-  0x1c, 0xcc, 0x90, 0x1f, 0xf1, 0x33, 0x16, 0xb6, 0x40, 0x4c, 0x71, 0xcc,
-  0x81, 0xec, 0xe1, 0x32, 0xe6, 0x26, 0xc4, 0x19, 0x7f, 0x01, 0x1d, 0xc3,
-  0x25, 0x32, 0xcd, 0xef, 0xe3, 0x9c, 0xe9, 0x03, 0xc1, 0xef, 0xc6, 0xeb,
-  0xd3, 0x0d, 0xb8, 0x06, 0x4b, 0xdf, 0xd6, 0x18, 0xf8, 0x9e, 0xd1, 0xf9,
-  0x3e, 0xff, 0x83, 0xe0, 0x3f, 0x09, 0x28, 0xee, 0xea, 0xf9, 0x34, 0x81,
-  0x3f, 0xf4, 0xd9, 0x11, 0xb9, 0x13, 0xdf, 0xb4, 0x27, 0xfe, 0xed, 0x40,
-  0x5e, 0x16, 0x25, 0x82, 0xe9, 0xe1, 0xcf, 0x30, 0xf4, 0x9f, 0xa4, 0x16,
-  0x36, 0x14, 0xd9, 0xc6, 0xcf, 0xfb, 0xdb, 0xdc, 0x09, 0x35, 0xf7, 0xf8,
-  0xf0, 0xdd, 0x4b, 0x48, 0x06, 0x09, 0x79, 0x0c, 0xec, 0x3f, 0x1e, 0x16,
-  0x8d, 0xea, 0x22, 0x2e, 0x81, 0x4d, 0xb4, 0x24, 0x24, 0x2c, 0xe1, 0x4c,
-  0x27, 0xd4, 0x4b, 0xdf, 0x3b, 0x17, 0x7b, 0x11, 0xe8, 0xf8, 0xca, 0x0f,
-  0xe0, 0x0d, 0x24, 0xd2, 0x1e, 0x3f, 0x1d, 0xf9, 0x13, 0xcd, 0x2e, 0xf8,
-  0x14, 0x1b, 0x28, 0xfe, 0xf2, 0x16, 0x17, 0xf5, 0x46, 0xf3, 0x3d, 0xe6,
-  0x38, 0xad, 0xe0, 0x15, 0x2e, 0xa5, 0x81, 0x19, 0x49, 0x42, 0x00, 0xd3,
-  0x2f, 0xf3, 0xce, 0xf6, 0x12, 0xd2, 0x0c, 0x23, 0xe9, 0xfa, 0x7f, 0xe5,
-  0x06, 0x67, 0x73, 0x4e, 0x08, 0x11, 0xe9, 0x4a, 0x58, 0xe7, 0x95, 0xec,
-  0x28, 0xa5, 0xa0, 0x17, 0xce, 0x2a, 0x41, 0x2a, 0x0d, 0xf0, 0x3c, 0xea,
-  0x28, 0x39, 0x12, 0xe0, 0x14, 0xcd, 0x12, 0xde, 0xb5, 0x53, 0xfa, 0x3f,
-  0x1e, 0xee, 0xa4, 0x0c, 0xd5, 0xa3, 0xf3, 0x81, 0x0d, 0x0e, 0xd4, 0xb1,
-  0xe7, 0xf3, 0xf9, 0xce, 0x03, 0xe4, 0xff, 0x17, 0xdd, 0x10, 0xed, 0xfc,
-  0xdd, 0x3c, 0x10, 0xca, 0xf4, 0xf2, 0xef, 0x14, 0xd7, 0x25, 0xcd, 0x31,
-  0xee, 0xb5, 0x11, 0x42, 0x13, 0xf4, 0x0f, 0x0b, 0xc6, 0x81, 0xf5, 0x7e,
-  0xa7, 0xe2, 0xd5, 0x53, 0xbd, 0xd8, 0x20, 0x0f, 0x2a, 0x28, 0x15, 0x6d,
-  0xf7, 0x0f, 0xfa, 0xb5, 0x37, 0x23, 0x21, 0xfb, 0xcf, 0xee, 0xf4, 0x01,
-  0xf7, 0x2b, 0x27, 0x1d, 0xe4, 0xd2, 0x1e, 0x41, 0x25, 0x31, 0x17, 0xf6,
-  0xe2, 0x09, 0xfd, 0x13, 0x42, 0x81, 0xa9, 0xac, 0x4d, 0x1e, 0xd2, 0x71,
-  0xeb, 0x0e, 0x33, 0x07, 0x2e, 0x8a, 0xd5, 0x20, 0x67, 0x40, 0x13, 0x35,
-  0x24, 0xff, 0x4a, 0xeb, 0xc5, 0x32, 0x10, 0xd0, 0x00, 0x12, 0x91, 0xc1,
-  0x23, 0x09, 0x2f, 0xb0, 0xff, 0xc3, 0x22, 0x10, 0xcb, 0x18, 0x7e, 0x79,
-  0x0c, 0x3f, 0x20, 0xfe, 0xc9, 0x53, 0x2b, 0x8c, 0xe8, 0xee, 0x2b, 0xf9,
-  0x0f, 0x5c, 0x44, 0x4c, 0x07, 0x18, 0x28, 0xa9, 0xb0, 0x96, 0xb2, 0x5d,
-  0xe1, 0xde, 0x7f, 0xa1, 0xde, 0xdc, 0x2e, 0x11, 0x00, 0x1c, 0xf9, 0xe3,
-  0x10, 0xee, 0xe1, 0x26, 0x02, 0xd2, 0x34, 0xf5, 0x0c, 0x55, 0xef, 0xea,
-  0x14, 0x0f, 0xfc, 0x1b, 0xff, 0x11, 0xc5, 0xda, 0x46, 0xd9, 0xfd, 0xcc,
-  0xe2, 0x8e, 0x07, 0xf3, 0x81, 0x16, 0x41, 0x0b, 0xd5, 0xa8, 0x46, 0x2c,
-  0x90, 0xda, 0xe4, 0xcf, 0x32, 0xdc, 0x27, 0xe6, 0xc2, 0xb8, 0xd2, 0xb8,
-  0xe6, 0x81, 0xf0, 0x08, 0xfd, 0x5a, 0x5c, 0x66, 0x35, 0xd9, 0xd0, 0xb3,
-  0x79, 0x21, 0x53, 0x23, 0x3c, 0x3e, 0x2e, 0x18, 0xf0, 0xe4, 0xf5, 0xfa,
-  0x7f, 0x2c, 0xa8, 0x01, 0x24, 0x02, 0x2a, 0xd0, 0xf5, 0xd0, 0xcc, 0xff,
-  0x17, 0x1e, 0x4f, 0x12, 0x3b, 0x67, 0xe1, 0x0e, 0x11, 0xfd, 0xe7, 0xa8,
-  0xf7, 0x1e, 0x28, 0x32, 0xed, 0x2c, 0xd6, 0x47, 0xee, 0xd2, 0xf9, 0x1f,
-  0x52, 0x34, 0x5e, 0x3a, 0x56, 0xe5, 0xc4, 0xf4, 0xde, 0xf6, 0x2f, 0xfb,
-  0x81, 0xc6, 0x31, 0x49, 0x54, 0x3b, 0xef, 0x31, 0x25, 0xea, 0x15, 0x11,
-  0x37, 0x40, 0x04, 0xea, 0xf4, 0x11, 0x27, 0x26, 0x5f, 0xec, 0x7d, 0xa6,
-  0x22, 0xdb, 0xf8, 0xdf, 0x28, 0xe7, 0x0f, 0xd5, 0x29, 0x1f, 0x4a, 0x1c,
-  0xed, 0x0d, 0x17, 0x03, 0xe1, 0xf3, 0x21, 0xac, 0xce, 0xd0, 0x9b, 0x02,
-  0x28, 0x4c, 0xb7, 0x17, 0x3e, 0xcb, 0x2a, 0x9b, 0xa8, 0x70, 0xf7, 0x00,
-  0xca, 0x5f, 0xac, 0x7f, 0x4e, 0x74, 0xf8, 0x34, 0x68, 0xcb, 0xcb, 0xde,
-  0xca, 0x28, 0xcd, 0xe5, 0xd8, 0x25, 0x01, 0x21, 0xeb, 0xc7, 0xcd, 0xc0,
-  0x20, 0x4a, 0xf7, 0x32, 0x35, 0x15, 0xeb, 0x18, 0x1e, 0xd1, 0x04, 0xf0,
-  0x47, 0x12, 0x2e, 0x03, 0x11, 0xff, 0x24, 0xb8, 0x1b, 0xfd, 0xbf, 0xd0,
-  0x7f, 0x18, 0xdc, 0xf2, 0x03, 0xe8, 0x81, 0x52, 0x0a, 0x3e, 0x14, 0x14,
-  0x9f, 0xc0, 0xbe, 0xf0, 0x74, 0xfd, 0xf8, 0x90, 0x0a, 0x15, 0xad, 0xff,
-  0xc3, 0x79, 0x57, 0x49, 0xa1, 0xc2, 0x2a, 0xc8, 0x44, 0xf0, 0x10, 0xd1,
-  0x97, 0xf3, 0xfc, 0xd7, 0x10, 0xc2, 0x9f, 0x33, 0xd9, 0xcf, 0x43, 0x97,
-  0x63, 0xc9, 0xcc, 0xc6, 0x3d, 0x59, 0x2e, 0xa4, 0x82, 0x11, 0xdb, 0xff,
-  0x57, 0x9d, 0xdf, 0x1a, 0x3f, 0xb2, 0xed, 0x37, 0xf6, 0x04, 0x01, 0xe5,
-  0x04, 0xfe, 0x9e, 0x2a, 0x1e, 0xec, 0x03, 0xd7, 0x3a, 0x58, 0x7f, 0xff,
-  0x49, 0xc5, 0x3f, 0x39, 0xe8, 0xeb, 0x2b, 0x05, 0x19, 0xfb, 0x2d, 0x39,
-  0x42, 0xda, 0x62, 0xda, 0x7f, 0xed, 0xbd, 0xb2, 0xf4, 0xf4, 0x44, 0xd2,
-  0x1c, 0xf1, 0x0d, 0x05, 0x1f, 0xd2, 0x0a, 0x9a, 0xc3, 0xa8, 0x11, 0xd1,
-  0xc4, 0xef, 0xb8, 0x2f, 0xe9, 0xbf, 0xd2, 0xfe, 0xee, 0x13, 0xc0, 0x08,
-  0xe9, 0xa3, 0x19, 0xc7, 0x3e, 0x01, 0xde, 0x5d, 0x66, 0x9b, 0x43, 0x2a,
-  0x53, 0xfe, 0xfd, 0x01, 0x3f, 0x0f, 0x15, 0x10, 0xca, 0x02, 0x7f, 0xd8,
-  0xcf, 0x4c, 0xaa, 0x0d, 0xf9, 0xba, 0x2f, 0xfa, 0xf7, 0xc5, 0xcd, 0xca,
-  0xe3, 0x1a, 0x51, 0x22, 0x7f, 0x66, 0x05, 0xec, 0x19, 0x9b, 0x6a, 0x08,
-  0xc1, 0xce, 0xe9, 0xa4, 0x4e, 0xd9, 0x09, 0x25, 0xd5, 0xd7, 0x03, 0x32,
-  0xd4, 0xd2, 0xcd, 0xfb, 0x5c, 0xd1, 0x49, 0xb6, 0x02, 0x3a, 0x15, 0x9b,
-  0x37, 0x2b, 0xc6, 0xc9, 0xe6, 0x50, 0x06, 0xc5, 0xff, 0xde, 0xcc, 0x5b,
-  0xaa, 0xf1, 0xed, 0x7f, 0x1a, 0x4c, 0xd5, 0x4c, 0xde, 0x78, 0x0e, 0xe9,
-  0xbf, 0xe9, 0x2b, 0xe1, 0x16, 0x37, 0xfd, 0xcc, 0x16, 0xdb, 0x16, 0xe4,
-  0xa4, 0x1f, 0x22, 0xf6, 0x4d, 0xef, 0x81, 0x66, 0xff, 0xe7, 0x02, 0xf3,
-  0x14, 0x98, 0xc2, 0xc0, 0x49, 0xe4, 0xfd, 0xe2, 0xba, 0x64, 0xd0, 0x9a,
-  0x08, 0x68, 0xe0, 0x2c, 0x37, 0x26, 0xdd, 0xf7, 0xf3, 0xcb, 0x04, 0xe4,
-  0x2c, 0x09, 0x29, 0xcf, 0xd3, 0x2a, 0x23, 0xf5, 0x1c, 0x2a, 0xc6, 0x47,
-  0x83, 0xf6, 0xbb, 0x40, 0xf2, 0xe4, 0x1f, 0x81, 0x17, 0xe3, 0x05, 0x57,
-  0xc9, 0x4d, 0x62, 0xd2, 0x0f, 0xfd, 0x30, 0x19, 0x45, 0xe0, 0xef, 0xe0,
-  0xa5, 0x28, 0x1f, 0xdf, 0x51, 0xb5, 0xfd, 0x10, 0xd5, 0xc2, 0xce, 0xdc,
-  0xe3, 0x51, 0x12, 0xe1, 0x40, 0x0d, 0x1e, 0x10, 0x34, 0x38, 0x32, 0x4d,
-  0xe7, 0xeb, 0xf4, 0xc4, 0xd5, 0xe6, 0x1d, 0x20, 0xe1, 0x0a, 0x4b, 0xb2,
-  0x11, 0xd0, 0xfb, 0xf8, 0xc5, 0x68, 0x22, 0x2e, 0x3e, 0xc3, 0xa9, 0x7f,
-  0xcf, 0xe4, 0xfc, 0x21, 0x0b, 0xf0, 0x27, 0xde, 0x1c, 0x2d, 0x22, 0x1c,
-  0x42, 0x19, 0xec, 0x5a, 0x17, 0x12, 0x0c, 0xbc, 0x17, 0xfc, 0xde, 0x18,
-  0xe9, 0xfb, 0x49, 0x0f, 0x37, 0xe5, 0xb1, 0x05, 0x7f, 0xb6, 0x18, 0xb7,
-  0xfe, 0xc0, 0x1d, 0xb2, 0x31, 0x6e, 0xfb, 0xf6, 0x14, 0x4d, 0x3e, 0xd0,
-  0x21, 0x15, 0x79, 0x0d, 0xda, 0x7c, 0x2d, 0x18, 0xd4, 0xef, 0xe4, 0xb9,
-  0x8d, 0x19, 0x81, 0x42, 0xb0, 0x1a, 0xca, 0x32, 0x2f, 0xca, 0x27, 0xce,
-  0xf2, 0x08, 0xf7, 0x0e, 0x3a, 0xe0, 0x2f, 0x0d, 0x1c, 0xc9, 0xfa, 0x2c,
-  0x2d, 0xfe, 0xae, 0xda, 0x1e, 0xd1, 0xf3, 0xbf, 0xd6, 0x37, 0x25, 0xdc,
-  0x1c, 0xee, 0x63, 0x2f, 0xca, 0x0b, 0xbb, 0xe2, 0x12, 0x3d, 0x48, 0x1c,
-  0x5e, 0x0b, 0x06, 0x16, 0xc9, 0x28, 0x1e, 0xf8, 0x3a, 0x48, 0x24, 0xe0,
-  0x7f, 0xb9, 0x8c, 0x53, 0x61, 0x2b, 0xfd, 0xc8, 0xd0, 0xea, 0xa1, 0x30,
-  0x0e, 0xe3, 0xf4, 0x7f, 0xef, 0x3d, 0x29, 0x16, 0x10, 0x23, 0xc4, 0xf2,
-  0xda, 0x3b, 0xdc, 0x37, 0xef, 0xbe, 0xba, 0xf1, 0x23, 0xd6, 0x59, 0x8d,
-  0x2f, 0xf9, 0x3c, 0xc0, 0xb9, 0x43, 0x3c, 0x3e, 0xcf, 0xd6, 0xd7, 0xcb,
-  0xd0, 0xe1, 0xf6, 0x79, 0x16, 0x40, 0xf6, 0x32, 0xfd, 0xb4, 0xa2, 0x4b,
-  0xdf, 0x1e, 0x6a, 0xa0, 0x29, 0xd9, 0x18, 0x68, 0x17, 0xa8, 0xf8, 0x96,
-  0xe9, 0xe4, 0x04, 0x22, 0xd9, 0x0c, 0xd1, 0x01, 0x30, 0xcf, 0xfc, 0x7f,
-  0xd0, 0xc6, 0xc0, 0x59, 0xb6, 0xda, 0xb9, 0x4e, 0x01, 0x24, 0xaa, 0x33,
-  0xc1, 0x0e, 0xef, 0xb4, 0x7e, 0xbf, 0x1d, 0x59, 0xdf, 0x06, 0xd4, 0xc7,
-  0xd5, 0x7f, 0x3d, 0x07, 0xa3, 0xec, 0x17, 0x44, 0xa1, 0x05, 0x70, 0x35,
-  0x02, 0x56, 0x47, 0x1e, 0x22, 0x13, 0x0e, 0xba, 0x51, 0xdc, 0x2b, 0x10,
-  0xdc, 0xde, 0x75, 0xa6, 0x3b, 0x2f, 0xcf, 0x15, 0x0e, 0xef, 0xc9, 0x23,
-  0x34, 0xfd, 0xcd, 0x2d, 0x48, 0xb1, 0x6c, 0x3a, 0x5b, 0x1e, 0x7d, 0x69,
-  0x2d, 0x73, 0x2d, 0xb5, 0x26, 0x63, 0x81, 0xeb, 0x1b, 0xf4, 0x08, 0xe1,
-  0xf5, 0x24, 0xff, 0x32, 0xd0, 0x2f, 0x6f, 0xb0, 0x35, 0x13, 0xb0, 0x4e,
-  0x8e, 0x23, 0x58, 0x15, 0xef, 0x00, 0xf1, 0x05, 0xc1, 0xd7, 0x81, 0x49,
-  0x00, 0xe6, 0xef, 0xcd, 0x00, 0x0f, 0x0f, 0xca, 0xda, 0x57, 0xde, 0x06,
-  0xf2, 0x81, 0xfb, 0xbf, 0x13, 0x01, 0xb0, 0xcb, 0x2a, 0x12, 0xec, 0xce,
-  0xff, 0xe9, 0xe3, 0x41, 0x57, 0xbb, 0x14, 0x3b, 0x10, 0xeb, 0xe5, 0x08,
-  0xfb, 0xfd, 0x15, 0xef, 0x0b, 0x10, 0xfb, 0x16, 0xf0, 0x00, 0x0b, 0xf0,
-  0x04, 0x09, 0x44, 0x02, 0xe6, 0xfb, 0x14, 0xdb, 0x0e, 0xca, 0x44, 0x00,
-  0xc1, 0x37, 0xf3, 0x9e, 0xbc, 0xc0, 0xc1, 0x02, 0xf2, 0x32, 0xd6, 0x60,
-  0xc8, 0x7f, 0xcd, 0x58, 0x11, 0x0d, 0x1c, 0x0d, 0x1f, 0x1e, 0x5f, 0x2f,
-  0xf1, 0x9d, 0xc9, 0x35, 0xfd, 0x0a, 0x18, 0x28, 0x34, 0xd5, 0x7f, 0x54,
-  0xab, 0x19, 0xf2, 0x12, 0x22, 0x37, 0xe9, 0xf1, 0x05, 0xb6, 0xb0, 0xf7,
-  0xd5, 0x02, 0x03, 0xf4, 0xb7, 0xfa, 0x15, 0x2f, 0x26, 0x05, 0x24, 0xac,
-  0x19, 0x1b, 0xfa, 0x16, 0x06, 0xb0, 0xfc, 0x20, 0xd3, 0x04, 0x25, 0xf6,
-  0x3a, 0xed, 0x08, 0x27, 0xaf, 0x1d, 0x37, 0x48, 0x12, 0xed, 0xf2, 0x56,
-  0x44, 0x00, 0x2a, 0xa5, 0x1d, 0x06, 0x2b, 0x1a, 0x01, 0x9d, 0x7f, 0xc5,
-  0x38, 0x0d, 0xd5, 0xcd, 0xc9, 0xe0, 0xc3, 0x22, 0xd1, 0xcd, 0x0f, 0xd1,
-  0xdd, 0x2c, 0xf9, 0x32, 0xfd, 0xbe, 0x9f, 0x34, 0xfc, 0xe0, 0x7f, 0x2e,
-  0x19, 0x00, 0x02, 0xf6, 0xe7, 0x97, 0x40, 0x2d, 0xd6, 0xfc, 0x0a, 0xe0,
-  0x3b, 0xeb, 0x2b, 0x0e, 0xf4, 0xc7, 0x2d, 0x36, 0xe9, 0x22, 0x18, 0xf6,
-  0xc6, 0x0c, 0x0e, 0x02, 0x1d, 0xf6, 0x1a, 0xde, 0x10, 0x2e, 0xba, 0x06,
-  0x5a, 0x22, 0x22, 0xd0, 0xf8, 0x26, 0x2f, 0x0c, 0xee, 0xd1, 0x25, 0x12,
-  0x1c, 0xfd, 0x14, 0x53, 0xf0, 0x7f, 0xf5, 0x21, 0x36, 0x14, 0x27, 0xc6,
-  0xf0, 0x27, 0xfe, 0xe4, 0x2b, 0xd4, 0xef, 0x13, 0xec, 0x27, 0x1f, 0x26,
-  0xf4, 0xf8, 0x2b, 0xd2, 0xe2, 0xf0, 0xd1, 0xb2, 0xdb, 0xb1, 0x08, 0x2f,
-  0x81, 0x13, 0xa9, 0x11, 0x2d, 0x17, 0xfc, 0x9a, 0x0a, 0xaa, 0x29, 0xa6,
-  0xe5, 0x1b, 0xf3, 0x1b, 0xd4, 0xd9, 0xcb, 0xf8, 0xfb, 0xff, 0x18, 0x08,
-  0x02, 0x27, 0x11, 0x13, 0xba, 0x56, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x69, 0x6f, 0x6e, 0x00, 0x22, 0x00, 0x00, 0x00, 0x88, 0xbf, 0x00, 0x00,
+  0x80, 0xbf, 0x00, 0x00, 0x60, 0xbf, 0x00, 0x00, 0x40, 0xbf, 0x00, 0x00,
+  0xcc, 0xbe, 0x00, 0x00, 0x38, 0xbe, 0x00, 0x00, 0x24, 0xae, 0x00, 0x00,
+  0x90, 0xa6, 0x00, 0x00, 0x7c, 0xa4, 0x00, 0x00, 0x68, 0x64, 0x00, 0x00,
+  0x54, 0x5f, 0x00, 0x00, 0x40, 0x5d, 0x00, 0x00, 0x2c, 0x1d, 0x00, 0x00,
+  0x10, 0x1b, 0x00, 0x00, 0x08, 0x1b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00,
+  0x6c, 0x18, 0x00, 0x00, 0x58, 0x16, 0x00, 0x00, 0x44, 0x02, 0x00, 0x00,
+  0x88, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0xe8, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00,
+  0xd0, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x62, 0x40, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xeb, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x32, 0x2e, 0x31, 0x34, 0x2e, 0x30, 0x00, 0x00,
+  0xce, 0x40, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x31, 0x2e, 0x31, 0x34, 0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe8, 0xdf, 0xfe, 0xff, 0xec, 0xdf, 0xfe, 0xff,
+  0xf0, 0xdf, 0xfe, 0xff, 0xf4, 0xdf, 0xfe, 0xff, 0xf8, 0xdf, 0xfe, 0xff,
+  0xfc, 0xdf, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0xff, 0x04, 0xe0, 0xfe, 0xff,
+  0x08, 0xe0, 0xfe, 0xff, 0x0c, 0xe0, 0xfe, 0xff, 0x10, 0xe0, 0xfe, 0xff,
+  0x22, 0x41, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x7f, 0x99, 0x7f, 0x14,
+  0xcd, 0x2f, 0x0a, 0x7f, 0x1c, 0xab, 0xbe, 0xff, 0xb2, 0x81, 0x62, 0x8c,
+  0x6d, 0xca, 0x13, 0x14, 0x81, 0x44, 0xb4, 0x64, 0x16, 0x02, 0xa6, 0x22,
+  0xe6, 0x7f, 0xae, 0x7f, 0x29, 0x7f, 0x92, 0xb1, 0x7f, 0xc5, 0x94, 0xf2,
+  0x5b, 0xe4, 0xd6, 0x81, 0x7f, 0x7f, 0x7f, 0x46, 0x81, 0x81, 0x81, 0x2b,
+  0x81, 0x3a, 0x7f, 0x81, 0xd6, 0x93, 0x7f, 0x26, 0x2a, 0xce, 0x81, 0xa0,
+  0x81, 0x7f, 0x21, 0xe4, 0xa1, 0xea, 0x41, 0xca, 0x7f, 0xc9, 0x26, 0xe4,
+  0xeb, 0x07, 0x81, 0x32, 0x8b, 0x81, 0xc8, 0xf9, 0x27, 0x05, 0xe9, 0x88,
+  0xf3, 0x22, 0x52, 0x81, 0x3d, 0xea, 0x86, 0xae, 0x81, 0x7f, 0x0b, 0x81,
+  0x60, 0x81, 0x63, 0x81, 0xff, 0xe3, 0x7f, 0x81, 0x7f, 0x4a, 0x7f, 0x89,
+  0xd9, 0xa2, 0x7f, 0x81, 0x94, 0x7f, 0x75, 0x7f, 0xae, 0x41, 0xff, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x66, 0x42, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x14, 0x00, 0x00, 0x7e, 0x76, 0x6f, 0x10, 0x18, 0xfa, 0xb3, 0xd7,
+  0xc6, 0x2c, 0x13, 0xe5, 0xc3, 0xf9, 0x01, 0x21, 0x3a, 0x43, 0x05, 0xf1,
+  0x95, 0xbb, 0x2c, 0x91, 0xc9, 0x5a, 0xb9, 0x3e, 0x10, 0xbe, 0x81, 0x2a,
+  0x00, 0x33, 0xcd, 0x02, 0x34, 0xa9, 0xd9, 0x7a, 0x7f, 0x33, 0x52, 0x3b,
+  0xa9, 0x2d, 0x12, 0xdf, 0xba, 0xa1, 0xc6, 0x03, 0x40, 0xd4, 0xd8, 0x28,
+  0xf1, 0xe7, 0xba, 0x0a, 0x27, 0x18, 0xca, 0xf8, 0x2d, 0xdd, 0xd7, 0xc2,
+  0x07, 0x30, 0xf6, 0x2a, 0x62, 0x51, 0xc5, 0x0e, 0xfb, 0xd4, 0x14, 0x0d,
+  0x26, 0x00, 0x29, 0x24, 0xd3, 0x19, 0xe8, 0x13, 0x32, 0x12, 0x5f, 0x30,
+  0xc4, 0x81, 0x1f, 0xed, 0xff, 0x3b, 0xf9, 0xad, 0x36, 0x87, 0x0a, 0x29,
+  0x56, 0xe3, 0xf7, 0x39, 0x08, 0x28, 0x41, 0xb7, 0xf3, 0x13, 0xc7, 0x0b,
+  0x30, 0x06, 0xe4, 0xc9, 0x36, 0xfe, 0x0e, 0x44, 0xd1, 0x48, 0xe2, 0xe2,
+  0x10, 0x20, 0xf9, 0xee, 0x0c, 0xf9, 0xc3, 0xbd, 0x1c, 0xf6, 0x20, 0x08,
+  0xa1, 0x0c, 0xca, 0xb3, 0x12, 0xf8, 0xc5, 0x27, 0x19, 0xcc, 0xf7, 0xdb,
+  0xbd, 0xab, 0x33, 0xeb, 0x81, 0x2b, 0xa5, 0xb2, 0xe1, 0x15, 0xf8, 0xa4,
+  0x39, 0xe6, 0xa2, 0xda, 0x40, 0x2f, 0x31, 0xeb, 0xdd, 0xce, 0x2e, 0xdc,
+  0xea, 0xd4, 0xd0, 0xff, 0x53, 0xb5, 0x0d, 0xc8, 0x2f, 0xd0, 0x81, 0x26,
+  0xe4, 0x2c, 0x08, 0xd8, 0x20, 0xb7, 0x37, 0x4b, 0xe1, 0x16, 0x00, 0xe6,
+  0xdd, 0xd2, 0x78, 0x42, 0x81, 0x0a, 0x29, 0x22, 0xbe, 0xd2, 0x86, 0x11,
+  0x10, 0x64, 0x68, 0x48, 0xed, 0xe4, 0xf9, 0x08, 0xe6, 0xbb, 0x62, 0xc8,
+  0x2a, 0x7f, 0xf6, 0xc6, 0x4d, 0xd8, 0x05, 0x84, 0x19, 0xd9, 0xf5, 0x31,
+  0x23, 0xcd, 0xdf, 0x15, 0xcf, 0x0b, 0xd7, 0xbc, 0x45, 0xed, 0xcd, 0xcd,
+  0xe0, 0x2a, 0xe0, 0xf4, 0x38, 0x2f, 0x0d, 0x03, 0xf0, 0x9e, 0xea, 0x00,
+  0xbc, 0x11, 0x27, 0xc9, 0xb5, 0x00, 0x15, 0x08, 0x1a, 0x03, 0x76, 0x9b,
+  0x3c, 0x27, 0x44, 0xf2, 0x7f, 0xa3, 0x1d, 0xe6, 0x3c, 0xf1, 0xdd, 0x1b,
+  0x74, 0xdb, 0x20, 0xaf, 0x47, 0xfc, 0xcd, 0x16, 0x34, 0x35, 0x81, 0x1e,
+  0xb1, 0xef, 0x3a, 0xd4, 0x04, 0xf7, 0x99, 0xd4, 0xf9, 0x19, 0x1f, 0xd5,
+  0xef, 0xc4, 0x05, 0x31, 0xfc, 0xf9, 0x0e, 0x21, 0xc4, 0xc4, 0x64, 0x35,
+  0xf0, 0xcc, 0x08, 0x46, 0xed, 0x1b, 0x1f, 0xc9, 0x12, 0xdf, 0xab, 0x34,
+  0xbf, 0xfb, 0x11, 0x0a, 0x94, 0x7f, 0xb3, 0xcb, 0xda, 0xe0, 0xca, 0x51,
+  0x4d, 0x0b, 0x55, 0xda, 0x23, 0xed, 0xce, 0x15, 0x1c, 0xd9, 0xbe, 0xed,
+  0xc9, 0x3c, 0xd9, 0xf1, 0x21, 0xbd, 0x3c, 0x50, 0x81, 0xd3, 0xb1, 0xd4,
+  0x1c, 0x04, 0xc8, 0x17, 0xc2, 0x84, 0xb4, 0x0f, 0xcd, 0xf5, 0xe8, 0xd3,
+  0xf2, 0xfd, 0x2d, 0x05, 0x20, 0xf6, 0xf4, 0xe5, 0x07, 0x26, 0x0e, 0xe5,
+  0xee, 0x14, 0x2d, 0x0c, 0xd3, 0x45, 0x4c, 0x0e, 0x43, 0x07, 0x7f, 0x1b,
+  0xd5, 0x0e, 0xe4, 0xef, 0x51, 0x16, 0x16, 0x08, 0xe6, 0xf6, 0xf2, 0x03,
+  0xda, 0x05, 0x19, 0x1a, 0xc1, 0xf3, 0x0c, 0x00, 0x0d, 0xe0, 0xe5, 0x1c,
+  0xd6, 0xeb, 0x0a, 0xee, 0x30, 0x33, 0xf4, 0xf5, 0x27, 0xff, 0x04, 0x1f,
+  0xf8, 0xe2, 0xaf, 0xe1, 0x3f, 0xf5, 0xe8, 0x07, 0x7f, 0x1d, 0xf6, 0xf3,
+  0x02, 0x9b, 0xea, 0x22, 0x1c, 0xd6, 0x1d, 0x19, 0xf8, 0x17, 0x43, 0xf4,
+  0xfe, 0x32, 0xcd, 0x06, 0x35, 0x36, 0xea, 0xf7, 0xe6, 0x0e, 0xca, 0xa9,
+  0x04, 0x20, 0xf3, 0xd2, 0xf2, 0x07, 0xc2, 0x1b, 0xd4, 0x3b, 0x04, 0x10,
+  0x3c, 0x57, 0xd8, 0xfa, 0x81, 0xdf, 0x01, 0x11, 0xed, 0x48, 0x18, 0x91,
+  0x46, 0x91, 0x08, 0x77, 0x27, 0xe7, 0x06, 0xec, 0xbf, 0xcd, 0xa3, 0xc1,
+  0x60, 0xc6, 0x37, 0xab, 0xd1, 0x52, 0xf8, 0xba, 0xfd, 0x1e, 0x2e, 0xdf,
+  0x19, 0xfd, 0xeb, 0xff, 0x1b, 0xf9, 0x42, 0x01, 0x26, 0xed, 0x18, 0xd1,
+  0x31, 0x26, 0x0c, 0xfe, 0xe1, 0xf9, 0x03, 0xe0, 0x10, 0xf9, 0xdd, 0xf3,
+  0x39, 0x0c, 0xcf, 0xd0, 0xd1, 0x81, 0xfb, 0x21, 0xc1, 0x0a, 0x35, 0xef,
+  0x41, 0x3d, 0xda, 0x4a, 0x0e, 0x20, 0xe5, 0xfd, 0x3e, 0xc9, 0xec, 0xc1,
+  0xb1, 0xf1, 0x0d, 0x66, 0x21, 0x85, 0x27, 0x73, 0xdb, 0xf7, 0xca, 0xa0,
+  0x93, 0x7f, 0x22, 0xf1, 0x61, 0x9b, 0x91, 0x0d, 0x93, 0xe3, 0x02, 0xb7,
+  0xa2, 0xa5, 0xdf, 0x2b, 0xd7, 0x07, 0x3b, 0x1a, 0x02, 0x35, 0xdd, 0xeb,
+  0x1c, 0xef, 0x1f, 0xfc, 0x1b, 0xf2, 0xbb, 0x03, 0xd9, 0xee, 0x2b, 0xd9,
+  0xde, 0x10, 0xf8, 0x1a, 0xf5, 0x10, 0x08, 0x2e, 0xf3, 0xb5, 0x29, 0xe0,
+  0x1d, 0xf7, 0x32, 0xd0, 0xfd, 0x14, 0x81, 0xe6, 0x15, 0xf4, 0x0c, 0xfe,
+  0xd7, 0xc0, 0x4e, 0x7e, 0xff, 0xd9, 0xf2, 0x00, 0x17, 0x59, 0xdf, 0xd3,
+  0x19, 0x15, 0x2a, 0xff, 0x08, 0x1f, 0xf0, 0x04, 0xe7, 0x9c, 0xdb, 0xd7,
+  0xfd, 0x53, 0xbf, 0x65, 0x2a, 0xf4, 0x7f, 0xf6, 0x91, 0x38, 0xe0, 0xc9,
+  0x11, 0xc4, 0xf1, 0xd8, 0x49, 0xfc, 0x81, 0xe6, 0xcb, 0xaf, 0xeb, 0x39,
+  0x00, 0xe5, 0x05, 0x4a, 0x0a, 0xfc, 0x70, 0x4b, 0x0f, 0x21, 0xe0, 0xea,
+  0x76, 0xf2, 0x15, 0xfc, 0x23, 0x49, 0xdb, 0xf8, 0x72, 0xd8, 0xed, 0x03,
+  0x09, 0xe8, 0x46, 0xdf, 0xa8, 0xef, 0x35, 0x56, 0xbb, 0xe1, 0xed, 0xcf,
+  0x7d, 0xd3, 0xca, 0xca, 0xc7, 0x81, 0x53, 0xfb, 0x6a, 0xfc, 0xc9, 0x4a,
+  0xbe, 0x45, 0xe4, 0xd6, 0x91, 0x3c, 0xca, 0xf8, 0x07, 0x15, 0xd2, 0xc2,
+  0x3c, 0xe9, 0x44, 0xfa, 0x18, 0x33, 0xd1, 0x2c, 0x25, 0x1a, 0xe3, 0x55,
+  0xff, 0x44, 0x17, 0x08, 0xcf, 0xec, 0xf8, 0xd9, 0x29, 0x63, 0xbd, 0x81,
+  0x20, 0xdc, 0xe7, 0x0a, 0x36, 0x12, 0xf5, 0xec, 0xc8, 0x07, 0xec, 0xb9,
+  0xc4, 0xb1, 0xda, 0x19, 0xd9, 0xc4, 0x42, 0x1d, 0xfe, 0xd1, 0x46, 0x17,
+  0xbf, 0xc9, 0x0d, 0x36, 0x3f, 0x4a, 0x2e, 0x1a, 0xc2, 0x0d, 0xf6, 0x14,
+  0x4e, 0x7f, 0x87, 0xc9, 0xc7, 0x4a, 0xea, 0x18, 0xd4, 0x5b, 0xd1, 0xd7,
+  0xda, 0xeb, 0x06, 0xde, 0xb0, 0x1f, 0x05, 0x47, 0x0f, 0x37, 0x0a, 0xb6,
+  0x5b, 0x18, 0x01, 0x5e, 0xed, 0xbd, 0xe9, 0xdf, 0xe2, 0xe3, 0x11, 0xcf,
+  0x31, 0xe8, 0xcb, 0x0f, 0xcf, 0x81, 0x17, 0x29, 0x2f, 0x1d, 0xbf, 0xe4,
+  0x52, 0xea, 0xd2, 0x1e, 0xe7, 0x1b, 0xdc, 0x34, 0xfb, 0x0e, 0x07, 0xe7,
+  0x1e, 0x06, 0xf1, 0x16, 0xfa, 0xd0, 0x13, 0xed, 0xd0, 0xe4, 0x44, 0x45,
+  0xf9, 0xef, 0xca, 0x38, 0x59, 0x25, 0xcd, 0xbd, 0xe1, 0xf7, 0x81, 0x3e,
+  0xe4, 0xae, 0x2d, 0xc0, 0xc5, 0x12, 0x20, 0x0a, 0xfb, 0x02, 0xf2, 0xaf,
+  0xfb, 0x0b, 0x03, 0xcf, 0xca, 0xae, 0xde, 0x1b, 0xa8, 0xec, 0x3e, 0xff,
+  0xfc, 0xe6, 0x0a, 0x2c, 0xd7, 0x88, 0x8d, 0xac, 0xd3, 0xa5, 0xd8, 0xcf,
+  0xd8, 0x01, 0x03, 0x15, 0xe0, 0xe9, 0x25, 0xca, 0x1e, 0x34, 0xfc, 0x4a,
+  0x7f, 0xcd, 0xd6, 0x0d, 0x06, 0xee, 0xf3, 0xe7, 0x0f, 0x12, 0xed, 0x9a,
+  0xed, 0xee, 0x18, 0x57, 0x32, 0x30, 0x23, 0x3d, 0x51, 0xc0, 0x74, 0x08,
+  0xbd, 0xd4, 0xef, 0x2e, 0x28, 0xc9, 0x13, 0x50, 0x83, 0x4c, 0xc8, 0xc8,
+  0x37, 0x0c, 0xe6, 0xd6, 0xcc, 0x22, 0xdf, 0x3e, 0xbb, 0x81, 0xaa, 0xcd,
+  0x42, 0xe5, 0x1c, 0xc5, 0x22, 0x48, 0xc4, 0x20, 0x0d, 0xed, 0xfe, 0xfa,
+  0x0e, 0x01, 0xf8, 0xed, 0x01, 0x12, 0xe4, 0xed, 0xef, 0xef, 0xec, 0x14,
+  0x41, 0xda, 0xfd, 0xea, 0x2f, 0xfa, 0x26, 0x34, 0xf0, 0x2b, 0x15, 0xec,
+  0xe6, 0xd1, 0x7f, 0xac, 0xeb, 0x40, 0xae, 0x19, 0x47, 0x2b, 0x0a, 0xdd,
+  0x31, 0x0b, 0xa8, 0x31, 0xd7, 0xbe, 0xff, 0xf7, 0x0a, 0xd1, 0x18, 0xc0,
+  0xd4, 0xcb, 0x2a, 0xba, 0x08, 0xe9, 0x0d, 0x32, 0x92, 0x7f, 0x3c, 0x28,
+  0x19, 0xae, 0x3b, 0xe1, 0x47, 0x37, 0x0f, 0x3f, 0xe0, 0xbe, 0xe7, 0x1a,
+  0xed, 0x2a, 0x0a, 0x0c, 0x95, 0x1f, 0x3d, 0xe3, 0xdf, 0xea, 0x1c, 0xdd,
+  0x48, 0xd7, 0xe6, 0xe6, 0xfd, 0xff, 0x7f, 0xd0, 0xc6, 0x23, 0xed, 0xe7,
+  0x32, 0x50, 0xef, 0xde, 0x17, 0x05, 0xb5, 0x9c, 0xef, 0xed, 0x08, 0x53,
+  0xe5, 0x2e, 0xf6, 0x52, 0x19, 0x41, 0xed, 0x79, 0xca, 0x61, 0xcf, 0x12,
+  0x74, 0x7e, 0x5d, 0x51, 0xf6, 0xc8, 0x4e, 0xff, 0x0e, 0xf0, 0x10, 0x04,
+  0xe0, 0x36, 0x87, 0x41, 0x86, 0x3d, 0xfe, 0x02, 0x30, 0x01, 0x0a, 0xf0,
+  0x10, 0xd2, 0xd8, 0x40, 0xeb, 0xea, 0x81, 0x8b, 0x63, 0xdb, 0xcd, 0xc7,
+  0x0c, 0xb7, 0xe1, 0xdc, 0xd2, 0x41, 0xf4, 0x44, 0xee, 0x20, 0x0b, 0xf7,
+  0xa2, 0x98, 0x34, 0x24, 0x7f, 0xde, 0x57, 0x3a, 0xda, 0x56, 0x1e, 0x44,
+  0x47, 0xb6, 0x58, 0x29, 0xb4, 0x4a, 0xc9, 0x55, 0x28, 0x03, 0x28, 0xf6,
+  0x19, 0xb7, 0x22, 0xc9, 0xf3, 0xee, 0xe3, 0xf1, 0x05, 0xc1, 0xcf, 0x81,
+  0xd8, 0xf0, 0xd8, 0x17, 0xe1, 0x93, 0x1a, 0x0d, 0xf5, 0x92, 0x23, 0xdc,
+  0x07, 0x14, 0xe2, 0x08, 0x06, 0xe4, 0x36, 0x31, 0x0a, 0x2a, 0xf0, 0x33,
+  0x39, 0xf3, 0xf9, 0x3b, 0xfd, 0x02, 0x04, 0xe2, 0x7f, 0xdb, 0x69, 0xd4,
+  0x1f, 0xc6, 0x6d, 0x5b, 0xfc, 0xc8, 0xa9, 0x51, 0x2b, 0xf1, 0x82, 0x0b,
+  0x18, 0x28, 0xa7, 0xdf, 0x37, 0x19, 0xb1, 0xed, 0x36, 0x05, 0x13, 0x54,
+  0x1e, 0x0c, 0xbc, 0x62, 0xf1, 0x39, 0xa5, 0x63, 0x39, 0x29, 0xc9, 0x57,
+  0x8f, 0x3a, 0x5b, 0x0a, 0x99, 0x4f, 0xb6, 0xd9, 0xf1, 0x33, 0x15, 0x7f,
+  0x22, 0x18, 0x16, 0xa9, 0xaf, 0xfc, 0xd0, 0x15, 0xf7, 0x31, 0xf7, 0xf5,
+  0x02, 0x45, 0x41, 0xfa, 0xbf, 0xf9, 0x54, 0x29, 0x7c, 0xfa, 0x1c, 0xda,
+  0xd3, 0x22, 0x53, 0xbf, 0x08, 0xfd, 0xa2, 0xe9, 0xe3, 0x0b, 0xe6, 0x7f,
+  0xbd, 0xd5, 0x30, 0x0c, 0x1e, 0x48, 0xad, 0x10, 0xee, 0x30, 0x50, 0x9b,
+  0x47, 0xda, 0x50, 0x63, 0x36, 0x18, 0x04, 0xda, 0xf8, 0x13, 0xfe, 0x09,
+  0x14, 0x2b, 0xd8, 0x04, 0xfd, 0xce, 0xa5, 0xf0, 0x4a, 0x44, 0x12, 0x94,
+  0x2b, 0x17, 0xe3, 0xcd, 0x7f, 0x2e, 0x1a, 0xbd, 0x38, 0xbb, 0x01, 0xda,
+  0xe6, 0x04, 0xf8, 0xe0, 0xe8, 0x0f, 0xd1, 0x19, 0xdb, 0xe1, 0x0d, 0xd2,
+  0x33, 0xed, 0xd5, 0x1f, 0xcf, 0xf8, 0x2e, 0xd8, 0x25, 0x27, 0x28, 0x27,
+  0x3b, 0xff, 0xee, 0xf9, 0xd2, 0xec, 0x00, 0x16, 0x2a, 0xe3, 0xea, 0xdd,
+  0x26, 0x18, 0x81, 0x43, 0xae, 0xdd, 0x66, 0xd7, 0xd9, 0x1e, 0xe8, 0xee,
+  0x1d, 0x29, 0x26, 0x42, 0xf2, 0x28, 0x09, 0x0e, 0x0c, 0x0c, 0x3d, 0x19,
+  0x22, 0x0b, 0x0b, 0xe6, 0x01, 0x00, 0xaf, 0x33, 0x11, 0xd9, 0x63, 0xe2,
+  0x89, 0xaf, 0x15, 0x1f, 0xf8, 0x5b, 0xf0, 0x97, 0x0a, 0xe6, 0xda, 0x4b,
+  0x09, 0x4e, 0x7f, 0xf0, 0x3a, 0xf1, 0xee, 0xdb, 0x0b, 0x1d, 0xfd, 0x18,
+  0xe0, 0xf1, 0xca, 0xe5, 0x43, 0x27, 0xc8, 0x25, 0x0c, 0xd5, 0x25, 0x19,
+  0xd2, 0xf7, 0x0b, 0xdb, 0xce, 0xfe, 0x53, 0xc1, 0x3d, 0xfa, 0x24, 0xdc,
+  0x7f, 0x09, 0x0e, 0xc4, 0xe6, 0xcc, 0x0f, 0x26, 0xfd, 0x8b, 0x38, 0x29,
+  0x24, 0x1d, 0x16, 0xc5, 0xf1, 0x18, 0x28, 0xeb, 0xeb, 0xf0, 0x88, 0xdd,
+  0xeb, 0x07, 0x32, 0x00, 0x31, 0xc0, 0xda, 0x12, 0xd6, 0x55, 0xc6, 0x18,
+  0x1c, 0xce, 0xfc, 0xe8, 0xd9, 0x05, 0xdd, 0x8c, 0x57, 0x29, 0x81, 0x3e,
+  0xe8, 0x28, 0xb3, 0x72, 0xe6, 0x2d, 0xea, 0x2c, 0x22, 0xe1, 0xef, 0x30,
+  0xce, 0xf8, 0x04, 0x5c, 0x07, 0x18, 0x0c, 0x1c, 0xe8, 0xd6, 0x27, 0xfd,
+  0xcf, 0xcc, 0xec, 0xe3, 0xf4, 0x02, 0xc9, 0x17, 0x38, 0xe7, 0xf2, 0xef,
+  0x3b, 0x1c, 0x12, 0xf5, 0x49, 0x0b, 0x5e, 0x35, 0xc0, 0x72, 0x7f, 0xb7,
+  0xc9, 0x41, 0x04, 0xe2, 0x1e, 0x38, 0xa9, 0xbb, 0x05, 0x15, 0x4e, 0x3a,
+  0x19, 0xc2, 0xf7, 0xe7, 0x76, 0xe8, 0x4c, 0xde, 0xd1, 0xc9, 0x17, 0xde,
+  0xdd, 0xb3, 0x05, 0x81, 0x65, 0x84, 0x9d, 0x48, 0xe8, 0xc7, 0xb4, 0x42,
+  0xeb, 0xd3, 0x2e, 0xe8, 0xf4, 0xfd, 0xb6, 0x3f, 0x15, 0x43, 0x2f, 0x26,
+  0x18, 0xeb, 0x44, 0x1e, 0xf1, 0xab, 0xc0, 0xe7, 0xe3, 0x83, 0x9d, 0x01,
+  0x7d, 0xfc, 0xbc, 0xfc, 0xc9, 0x81, 0x5e, 0x35, 0xd1, 0x35, 0x41, 0x12,
+  0x47, 0xdc, 0x46, 0x0e, 0x13, 0x42, 0xe6, 0xf3, 0x3b, 0x02, 0xfb, 0x13,
+  0x03, 0xe1, 0xd6, 0xed, 0x1f, 0xae, 0xec, 0x97, 0xff, 0xf9, 0xed, 0xe9,
+  0xd7, 0x4c, 0x7f, 0x03, 0x40, 0xc5, 0x11, 0x21, 0x49, 0xe8, 0xf2, 0x18,
+  0xeb, 0xbf, 0xc0, 0xdd, 0xe4, 0xa6, 0x01, 0x01, 0xf9, 0xd5, 0x5b, 0x43,
+  0xe5, 0x03, 0x93, 0xcf, 0xf7, 0xf0, 0x1b, 0x27, 0x17, 0x0c, 0x81, 0xc8,
+  0xe2, 0xdc, 0xd7, 0xb0, 0x5c, 0x21, 0xb0, 0x20, 0xd9, 0xbe, 0xfb, 0x30,
+  0xf7, 0xba, 0xf9, 0x57, 0x88, 0x27, 0xf3, 0xc3, 0xf7, 0x3c, 0xbe, 0x4c,
+  0xee, 0x05, 0x3e, 0x8e, 0x42, 0x15, 0xff, 0x9f, 0x1f, 0x39, 0x20, 0xeb,
+  0x11, 0x1f, 0x23, 0xc7, 0xe6, 0x07, 0x1e, 0x08, 0x07, 0x08, 0xc9, 0x7f,
+  0x04, 0x13, 0x31, 0x32, 0xc8, 0xec, 0x3e, 0xfa, 0xdb, 0x0a, 0x0a, 0xf1,
+  0x0f, 0x0c, 0x06, 0xba, 0x39, 0xff, 0xb9, 0x0e, 0xb7, 0xee, 0x01, 0xd2,
+  0x01, 0xfc, 0x50, 0x3e, 0x9f, 0xe1, 0xe6, 0xe6, 0x0d, 0x92, 0x34, 0xaf,
+  0x8f, 0xf6, 0x24, 0x7f, 0x06, 0xbb, 0x00, 0xe4, 0xe3, 0x0e, 0x67, 0x4e,
+  0xcf, 0x58, 0xca, 0x0c, 0x60, 0xc8, 0x3e, 0xc2, 0x66, 0x6e, 0x03, 0x63,
+  0xf8, 0x43, 0xeb, 0x17, 0x10, 0x12, 0x23, 0x03, 0xec, 0x27, 0x36, 0xdd,
+  0x08, 0xb2, 0x63, 0xad, 0xd6, 0x78, 0xcb, 0x6b, 0x35, 0x7f, 0x5f, 0xca,
+  0xfa, 0xf0, 0x26, 0x4d, 0x1a, 0xde, 0xad, 0x2e, 0x0b, 0x17, 0x06, 0x06,
+  0x36, 0xe0, 0xe2, 0x12, 0xec, 0x36, 0x3b, 0x0c, 0x51, 0x30, 0xaf, 0x27,
+  0xf3, 0xd8, 0x07, 0x81, 0x03, 0xce, 0xab, 0x2a, 0x22, 0xae, 0xe4, 0xce,
+  0xd8, 0x0f, 0x15, 0x19, 0xb6, 0x35, 0xa0, 0x3f, 0xff, 0xdc, 0xbe, 0x14,
+  0x25, 0xc3, 0xe5, 0x0e, 0x01, 0x41, 0xf8, 0x02, 0x44, 0x12, 0x43, 0xec,
+  0xf9, 0xc1, 0x7a, 0xdb, 0x09, 0x3a, 0x0d, 0xb3, 0x01, 0xb7, 0xc8, 0x29,
+  0xe8, 0xd6, 0xcd, 0x7f, 0xf2, 0xd2, 0x37, 0xe1, 0x29, 0xdd, 0x39, 0x6d,
+  0xd6, 0xf3, 0x0b, 0x3f, 0x42, 0xa0, 0x17, 0x0e, 0xc3, 0x1d, 0xfb, 0x02,
+  0x45, 0x39, 0xfc, 0xcb, 0x0c, 0x29, 0x01, 0xee, 0x0b, 0xcf, 0x1f, 0xc8,
+  0x05, 0x3f, 0xd9, 0xf8, 0xd6, 0x3d, 0xeb, 0x32, 0x5e, 0xdb, 0x0a, 0x04,
+  0xcb, 0xe5, 0xe7, 0x17, 0xfc, 0xd3, 0xe0, 0xdc, 0x3f, 0xc7, 0xa3, 0x26,
+  0x07, 0x28, 0x46, 0xf0, 0xe3, 0xf1, 0x2d, 0x56, 0x7f, 0xca, 0x0f, 0x1d,
+  0x15, 0xf9, 0x3e, 0xe6, 0xe3, 0x17, 0x1d, 0x0d, 0xeb, 0xcc, 0x07, 0x53,
+  0x47, 0xe0, 0x2e, 0xf7, 0xad, 0x23, 0x38, 0xc3, 0x25, 0xed, 0xc9, 0x7f,
+  0x3c, 0xd1, 0xdc, 0x30, 0x19, 0xcb, 0x23, 0x05, 0xfd, 0x4b, 0x47, 0x1f,
+  0xd2, 0xf4, 0x01, 0x00, 0x2b, 0xe7, 0x0b, 0x7f, 0x92, 0x9d, 0xe2, 0x03,
+  0xee, 0xe7, 0x0d, 0xf5, 0xd9, 0xbc, 0xcd, 0x09, 0xe4, 0xee, 0xf5, 0x11,
+  0x1a, 0xd0, 0xfd, 0xfd, 0x23, 0x28, 0x05, 0x22, 0xd5, 0x33, 0x38, 0x29,
+  0xde, 0x1d, 0xea, 0xe6, 0x0d, 0x22, 0xbe, 0xe3, 0x20, 0xed, 0xd1, 0x93,
+  0x39, 0xc3, 0xdf, 0x28, 0x7f, 0x02, 0xf4, 0x04, 0x3d, 0xec, 0xeb, 0xe4,
+  0xeb, 0x16, 0xf6, 0x00, 0xdb, 0xc5, 0xf2, 0x0b, 0x22, 0x21, 0xb8, 0x1f,
+  0x0c, 0xf0, 0x1f, 0xfa, 0x1b, 0xf1, 0xfb, 0xc7, 0x16, 0xd6, 0x2f, 0x05,
+  0xbf, 0x5e, 0x3b, 0x09, 0x15, 0x27, 0x23, 0xf7, 0x1d, 0xe7, 0xa7, 0xbe,
+  0xd6, 0x7f, 0xe5, 0x2a, 0xf9, 0xc4, 0x2c, 0x20, 0xbe, 0x4a, 0xe8, 0x64,
+  0xa3, 0x1c, 0x17, 0x16, 0xfc, 0x99, 0x30, 0xac, 0x31, 0xa4, 0x7d, 0x08,
+  0x8f, 0x31, 0x20, 0xf0, 0xee, 0x3d, 0xd0, 0x58, 0x66, 0x05, 0xfe, 0x8c,
+  0x2f, 0x06, 0x0c, 0x07, 0x39, 0xc7, 0x3a, 0x11, 0xaa, 0xe8, 0x37, 0xc4,
+  0x37, 0xcb, 0xce, 0xf0, 0x11, 0x22, 0xe6, 0x1a, 0x8a, 0x7f, 0xfb, 0x20,
+  0xf6, 0x15, 0xf0, 0x30, 0xbd, 0xd0, 0xcc, 0xf0, 0xd2, 0x30, 0x3b, 0xd9,
+  0x0a, 0x1a, 0xe1, 0x02, 0x1c, 0xec, 0xca, 0xcd, 0x25, 0xe3, 0xeb, 0xf8,
+  0x1a, 0x07, 0xcc, 0x23, 0x05, 0x0f, 0x17, 0xdd, 0x12, 0x61, 0x22, 0xd9,
+  0xf7, 0xf7, 0xaa, 0xff, 0x40, 0x50, 0xe7, 0x11, 0x25, 0xd2, 0x7f, 0x91,
+  0xf5, 0x0f, 0xec, 0x1a, 0xe7, 0xf6, 0x15, 0xcb, 0x15, 0x34, 0xfa, 0xd2,
+  0xe3, 0x0a, 0x04, 0xc2, 0x03, 0x18, 0xf3, 0x43, 0xd9, 0x01, 0xee, 0xe6,
+  0xea, 0xfd, 0xde, 0xed, 0x2b, 0x27, 0xfa, 0x5f, 0xfa, 0x4a, 0xdc, 0xff,
+  0x7f, 0xd3, 0xaa, 0xf5, 0x0f, 0xef, 0x7f, 0xb3, 0x08, 0xdf, 0xcd, 0xf2,
+  0x35, 0xfa, 0x3f, 0xcb, 0xf1, 0xe4, 0xb0, 0xe7, 0xbf, 0x2a, 0xf4, 0x5d,
+  0xd4, 0xf7, 0xd8, 0x11, 0x15, 0x54, 0xf7, 0xc1, 0x16, 0xf6, 0xd5, 0xec,
+  0xf7, 0xd4, 0xc4, 0x0b, 0xdc, 0x72, 0x3f, 0x22, 0x73, 0x18, 0xc7, 0xe2,
+  0x06, 0x2a, 0xe2, 0x43, 0x30, 0x30, 0xf5, 0x0d, 0xca, 0x18, 0xdd, 0x30,
+  0xcb, 0x38, 0xd8, 0xe3, 0x34, 0x07, 0x11, 0x25, 0xeb, 0x39, 0xdf, 0xdd,
+  0x3a, 0xd5, 0x8a, 0x72, 0xce, 0x30, 0x85, 0x1d, 0x5e, 0x81, 0x38, 0x87,
+  0x35, 0xe5, 0x23, 0x18, 0xeb, 0xde, 0xe3, 0x7f, 0x2b, 0xfd, 0x33, 0xee,
+  0xa9, 0xd9, 0x54, 0x18, 0x34, 0xb1, 0x2b, 0x12, 0xeb, 0xc5, 0x30, 0x0d,
+  0x21, 0x3c, 0xca, 0x33, 0xb2, 0x37, 0xdc, 0x36, 0x0b, 0x59, 0xfc, 0x01,
+  0x03, 0x1e, 0x00, 0xf4, 0x69, 0x00, 0x7f, 0x36, 0xe6, 0x0c, 0x11, 0x1b,
+  0xe1, 0xd1, 0x30, 0xe8, 0x3b, 0x02, 0xaa, 0xec, 0xd7, 0xee, 0xfc, 0x0b,
+  0x29, 0xdf, 0xcd, 0xd4, 0x4f, 0x0d, 0xf8, 0x1f, 0xe9, 0x04, 0x09, 0x21,
+  0xe8, 0x04, 0xd1, 0xda, 0x3f, 0xd6, 0x02, 0xf7, 0x7f, 0x48, 0x51, 0x08,
+  0x27, 0x41, 0x55, 0x55, 0xb3, 0x39, 0x44, 0x4b, 0xfa, 0x14, 0xca, 0x63,
+  0x96, 0x06, 0x35, 0xe9, 0x5e, 0x17, 0x11, 0xf6, 0x3a, 0x1a, 0xed, 0xce,
+  0x0c, 0xa7, 0xc7, 0x10, 0xf5, 0x18, 0x1a, 0x01, 0xe6, 0xc2, 0x29, 0x63,
+  0x64, 0x42, 0xd9, 0x21, 0x14, 0x03, 0x67, 0xc4, 0xcc, 0xe9, 0xdb, 0x3a,
+  0x17, 0xf6, 0x0b, 0x0e, 0xe9, 0x2c, 0xd1, 0xe4, 0x05, 0x26, 0xe2, 0xfe,
+  0xe7, 0xf7, 0xf1, 0x81, 0x1a, 0xec, 0x9f, 0x74, 0xb4, 0x0b, 0xa4, 0x13,
+  0x54, 0xb2, 0x3d, 0x31, 0x47, 0xdc, 0x7f, 0x1c, 0xe0, 0xa2, 0xa0, 0x97,
+  0xb0, 0xe1, 0xfe, 0x4a, 0x05, 0xe0, 0xea, 0xc8, 0x07, 0xd1, 0x43, 0x01,
+  0x02, 0x32, 0x64, 0x40, 0x54, 0xf2, 0xfa, 0xaf, 0x50, 0x16, 0xff, 0x20,
+  0xdf, 0x44, 0xea, 0x2b, 0xf6, 0xaa, 0xca, 0x26, 0x01, 0x52, 0xc8, 0xf6,
+  0xf4, 0xb9, 0x06, 0x24, 0x6a, 0x92, 0xa0, 0xba, 0xdf, 0xfc, 0xbf, 0x3b,
+  0xe3, 0x28, 0xa2, 0x61, 0xa4, 0xd7, 0xd5, 0xc2, 0x17, 0x1a, 0x12, 0x29,
+  0x30, 0x51, 0x5f, 0xbe, 0x12, 0x0c, 0x1a, 0x60, 0x0c, 0xd0, 0x81, 0xb7,
+  0xe0, 0x92, 0xf5, 0xf1, 0xdb, 0x45, 0x7f, 0xf5, 0xc5, 0x09, 0x7d, 0x34,
+  0xf4, 0x16, 0x02, 0x3c, 0xf2, 0xb8, 0x27, 0xd6, 0xdc, 0x16, 0x3e, 0xf6,
+  0x43, 0x3a, 0x0c, 0x52, 0x18, 0xd2, 0x3a, 0x65, 0xbe, 0x23, 0xc9, 0x38,
+  0xec, 0xd0, 0x8d, 0x3e, 0xe4, 0xe5, 0xed, 0xfd, 0x02, 0xf7, 0xb0, 0xe7,
+  0x06, 0xd3, 0xd9, 0x13, 0x17, 0x1a, 0x40, 0xff, 0x22, 0xbe, 0xea, 0x1a,
+  0xf1, 0x3b, 0xff, 0xe0, 0xd2, 0xfb, 0xc5, 0x11, 0x0a, 0xce, 0xee, 0xca,
+  0xfc, 0xf9, 0x45, 0xc0, 0x81, 0x41, 0xe7, 0x1f, 0x2d, 0xdb, 0x88, 0x36,
+  0xae, 0x2b, 0x3d, 0x7a, 0x87, 0x81, 0x5d, 0x18, 0x68, 0x6e, 0xf8, 0x9f,
+  0xcb, 0xb4, 0x20, 0x7c, 0x00, 0xe9, 0x30, 0xe0, 0x16, 0xed, 0xf5, 0x20,
+  0x06, 0x19, 0xe6, 0x07, 0xbe, 0x28, 0x05, 0x18, 0x2b, 0x21, 0xdd, 0x05,
+  0x38, 0x06, 0xee, 0x04, 0x2e, 0xe7, 0xeb, 0xcb, 0xa9, 0x08, 0x1a, 0xf5,
+  0x09, 0x24, 0x7f, 0xd3, 0xf9, 0x3c, 0xd5, 0xca, 0x01, 0x2f, 0xdb, 0x0a,
+  0x4b, 0x19, 0x1e, 0x37, 0x3c, 0x1e, 0x40, 0xb8, 0xc9, 0xe1, 0x36, 0x02,
+  0x2d, 0x97, 0xd3, 0xe5, 0x13, 0x25, 0x4c, 0x26, 0xe0, 0xae, 0xd0, 0xf6,
+  0xd8, 0x0b, 0xcf, 0x1a, 0xfc, 0x11, 0x10, 0xe9, 0xc8, 0xfe, 0x56, 0x9d,
+  0x55, 0x23, 0x1d, 0x1a, 0x3d, 0xdd, 0x81, 0x5b, 0xc0, 0x41, 0x12, 0xd8,
+  0xf1, 0x08, 0xfc, 0x13, 0xd8, 0xfb, 0x07, 0x43, 0x01, 0xc7, 0x60, 0xce,
+  0x18, 0xbd, 0x04, 0x0f, 0x3c, 0x46, 0x04, 0xfe, 0xdb, 0x2d, 0xcf, 0x0b,
+  0x81, 0x4c, 0x1b, 0x27, 0xc5, 0xe5, 0xfc, 0xc6, 0xf3, 0x15, 0xb6, 0xf6,
+  0x10, 0x23, 0x28, 0x37, 0x17, 0x32, 0x14, 0xec, 0xe1, 0x1f, 0x2d, 0xcb,
+  0x12, 0xc7, 0x3c, 0x0d, 0x99, 0xe0, 0x40, 0xf1, 0xd4, 0x84, 0x24, 0x17,
+  0xcf, 0x62, 0xee, 0xc8, 0xad, 0x0e, 0xe1, 0x28, 0xf0, 0x3a, 0xab, 0x40,
+  0x4c, 0xc2, 0xf9, 0x97, 0x07, 0x06, 0x21, 0xf4, 0x1e, 0x7f, 0xa7, 0x03,
+  0xc3, 0xf2, 0xeb, 0xfd, 0x7f, 0xb9, 0xca, 0x18, 0xe7, 0x05, 0x01, 0x00,
+  0x55, 0x09, 0x13, 0xfb, 0xb4, 0xfd, 0x1b, 0x2f, 0x08, 0xf8, 0x30, 0xfe,
+  0x69, 0xef, 0x22, 0xd8, 0xf0, 0x0a, 0xf8, 0xfb, 0x9d, 0xc7, 0x9e, 0xd7,
+  0xe0, 0x00, 0xf4, 0x12, 0x2b, 0x06, 0x4c, 0xbb, 0x5d, 0x5c, 0xc7, 0xea,
+  0x11, 0xe7, 0xeb, 0x33, 0xeb, 0x20, 0xd2, 0x58, 0x1e, 0xb7, 0x14, 0xd5,
+  0xda, 0x09, 0x41, 0x81, 0x58, 0xba, 0x0e, 0x2c, 0x08, 0x1d, 0x91, 0x70,
+  0x94, 0xbd, 0xc3, 0xf1, 0x29, 0xfa, 0xf9, 0xf8, 0xb6, 0x08, 0x29, 0x22,
+  0x10, 0x9b, 0x7e, 0x39, 0xf7, 0xfe, 0xd1, 0x13, 0x81, 0x90, 0x07, 0xe8,
+  0xa9, 0xee, 0x46, 0x16, 0x16, 0x54, 0xbe, 0xda, 0x40, 0x25, 0x51, 0xc3,
+  0x36, 0xf1, 0x01, 0xf2, 0xf5, 0x3f, 0xd3, 0x1c, 0x91, 0xb5, 0xdb, 0x4b,
+  0x15, 0x23, 0xcb, 0x4a, 0x48, 0xd6, 0xe4, 0xe2, 0xff, 0xfd, 0xd9, 0x19,
+  0x27, 0xd7, 0xbd, 0xff, 0x4d, 0xf4, 0x86, 0x35, 0x07, 0xc1, 0xf1, 0x0d,
+  0xda, 0xe4, 0x18, 0xf5, 0x45, 0x04, 0xfd, 0xe1, 0x19, 0x4e, 0xf2, 0x7f,
+  0xed, 0x18, 0xd7, 0x0c, 0xfd, 0x54, 0x0c, 0xd1, 0xf1, 0xf2, 0xcd, 0xf6,
+  0x2c, 0xdf, 0x1d, 0x16, 0x22, 0x76, 0xff, 0x95, 0xb3, 0xd2, 0x12, 0xf0,
+  0x14, 0xd1, 0xee, 0x5b, 0xff, 0xae, 0x0b, 0x1d, 0xcd, 0x7f, 0xf1, 0xc7,
+  0xd5, 0x1c, 0x44, 0x20, 0xd6, 0xf2, 0xe6, 0xdb, 0xeb, 0x0e, 0xc9, 0x99,
+  0x5f, 0x0b, 0xeb, 0xee, 0xc6, 0x1d, 0xd9, 0x10, 0x54, 0x40, 0xf1, 0x9f,
+  0x05, 0xe2, 0xe9, 0x34, 0x19, 0x78, 0x27, 0xa9, 0xf7, 0xe7, 0xc7, 0xf2,
+  0xfc, 0x16, 0xf7, 0x33, 0xdd, 0x81, 0x33, 0xce, 0x24, 0x40, 0x6a, 0x0e,
+  0xe8, 0x06, 0xb7, 0xfb, 0xd6, 0xfc, 0xf0, 0xb4, 0xd7, 0xbf, 0xd8, 0x0e,
+  0x0d, 0xc5, 0xe6, 0xdd, 0x37, 0x08, 0xbf, 0xf6, 0x3d, 0x0d, 0x1a, 0xea,
+  0xef, 0xeb, 0xf0, 0x2d, 0xd6, 0xed, 0xf4, 0xcd, 0xff, 0xf6, 0xc7, 0xf6,
+  0x4b, 0x56, 0xf3, 0xa3, 0x81, 0x33, 0xfb, 0xa7, 0xe4, 0xa8, 0xc1, 0x2b,
+  0xb1, 0xdf, 0x4f, 0x74, 0x23, 0xcb, 0xdd, 0x61, 0x41, 0x28, 0x74, 0x93,
+  0x6f, 0x4c, 0x1e, 0x20, 0xdf, 0xe3, 0x7f, 0xe8, 0x01, 0xed, 0x49, 0xf9,
+  0xd6, 0x20, 0xfd, 0x56, 0xe3, 0x4c, 0x1c, 0x14, 0x28, 0x3a, 0xdd, 0x1b,
+  0x7f, 0x23, 0xfa, 0xf8, 0x3e, 0x2b, 0x2a, 0x33, 0xf4, 0x1b, 0x66, 0x32,
+  0x06, 0xd1, 0xf7, 0x11, 0xdf, 0x29, 0xca, 0xe0, 0x45, 0xb4, 0x2d, 0x46,
+  0xf5, 0xe5, 0xe5, 0x17, 0x47, 0xc4, 0x38, 0x15, 0x14, 0xed, 0xf4, 0xdd,
+  0xf3, 0x3f, 0x27, 0x08, 0xe0, 0x02, 0xf7, 0x2e, 0xe5, 0x1d, 0xe6, 0xfb,
+  0xf8, 0xc3, 0xd2, 0xdb, 0x3d, 0x2d, 0x08, 0xf5, 0x7f, 0xa5, 0xc9, 0x2b,
+  0xec, 0x50, 0x87, 0xac, 0xc1, 0xf1, 0xe6, 0x1f, 0x05, 0xc1, 0x76, 0x88,
+  0x2a, 0x2b, 0xca, 0x11, 0x15, 0x08, 0xd3, 0xd0, 0x19, 0x95, 0xe6, 0xaf,
+  0xf3, 0xca, 0x06, 0x7f, 0xea, 0xf6, 0x0e, 0x1b, 0x21, 0xe6, 0xc8, 0x4b,
+  0xde, 0xf9, 0xe6, 0xfa, 0x13, 0xe7, 0x3f, 0xfb, 0xca, 0xe4, 0xf1, 0x1a,
+  0xd3, 0x12, 0x04, 0x27, 0x2c, 0xfa, 0xee, 0x1f, 0xef, 0x0e, 0x53, 0x14,
+  0x5f, 0xfc, 0x91, 0xbe, 0x54, 0xe8, 0x58, 0x8a, 0x54, 0x71, 0x3e, 0x6c,
+  0x17, 0xc9, 0x2d, 0x49, 0xe2, 0x37, 0xbb, 0xd8, 0xaf, 0xa5, 0xda, 0xf4,
+  0xde, 0x08, 0x12, 0xd5, 0xd8, 0x0b, 0x0a, 0x1d, 0x7f, 0x36, 0xd4, 0x07,
+  0x09, 0xb9, 0xf4, 0xdf, 0x40, 0x2d, 0xbc, 0xc6, 0xee, 0xd7, 0x6c, 0x5d,
+  0xba, 0xf1, 0x2f, 0x81, 0x4c, 0x02, 0x18, 0x15, 0xf3, 0xbf, 0xe4, 0x1d,
+  0x86, 0x7e, 0x29, 0x87, 0x87, 0x8c, 0x1e, 0x0c, 0x69, 0xf3, 0x55, 0x03,
+  0xca, 0x8c, 0x30, 0x13, 0xa1, 0xab, 0x06, 0xde, 0x02, 0xbf, 0xea, 0xf5,
+  0xd4, 0x1d, 0x12, 0xf3, 0x7f, 0x51, 0x59, 0x9e, 0x9d, 0xf1, 0x40, 0xdb,
+  0x65, 0xeb, 0x1d, 0xf6, 0x41, 0xa7, 0xdd, 0xe6, 0xad, 0x94, 0x0e, 0x4a,
+  0xd9, 0xf6, 0xf2, 0xe1, 0xf5, 0xe3, 0x39, 0x31, 0xe9, 0x26, 0xe5, 0xae,
+  0xb9, 0xb5, 0x81, 0x54, 0xa7, 0xcd, 0x08, 0xba, 0x2d, 0xca, 0xfa, 0x30,
+  0x09, 0xe5, 0xe1, 0xcf, 0x96, 0xe6, 0x2f, 0xa8, 0x58, 0x82, 0x94, 0xc3,
+  0x5d, 0xdb, 0x19, 0x0a, 0x28, 0x43, 0x1e, 0x8e, 0x96, 0xb9, 0xd7, 0x4a,
+  0x26, 0xa1, 0x0e, 0x75, 0xc8, 0xba, 0x6b, 0x06, 0xde, 0xba, 0x9e, 0xe8,
+  0xca, 0xbf, 0xa4, 0xbe, 0xd7, 0x34, 0xc1, 0x5f, 0xe0, 0x0e, 0xd9, 0xfa,
+  0xd2, 0xba, 0xd3, 0xed, 0xcf, 0xe7, 0xeb, 0x1b, 0x4a, 0xdc, 0xc4, 0x2c,
+  0x42, 0xe0, 0x45, 0x81, 0x1b, 0x32, 0x50, 0xc9, 0x21, 0x2b, 0xf0, 0x15,
+  0xf1, 0xdf, 0xce, 0x21, 0xe1, 0x61, 0xd6, 0xda, 0x08, 0xfe, 0x12, 0x14,
+  0x40, 0x19, 0x1b, 0x3f, 0xe2, 0xfa, 0xeb, 0x17, 0x1c, 0xcc, 0x90, 0x1f,
+  0xf1, 0x33, 0x16, 0xb6, 0x40, 0x4c, 0x71, 0xcc, 0x81, 0xec, 0xe1, 0x32,
+  0xe6, 0x26, 0xc4, 0x19, 0x7f, 0x01, 0x1d, 0xc3, 0x25, 0x32, 0xcd, 0xef,
+  0xe3, 0x9c, 0xe9, 0x03, 0xc1, 0xef, 0xc6, 0xeb, 0xd3, 0x0d, 0xb8, 0x06,
+  0x4b, 0xdf, 0xd6, 0x18, 0xf8, 0x9e, 0xd1, 0xf9, 0x3e, 0xff, 0x83, 0xe0,
+  0x3f, 0x09, 0x28, 0xee, 0xea, 0xf9, 0x34, 0x81, 0x3f, 0xf4, 0xd9, 0x11,
+  0xb9, 0x13, 0xdf, 0xb4, 0x27, 0xfe, 0xed, 0x40, 0x5e, 0x16, 0x25, 0x82,
+  0xe9, 0xe1, 0xcf, 0x30, 0xf4, 0x9f, 0xa4, 0x16, 0x36, 0x14, 0xd9, 0xc6,
+  0xcf, 0xfb, 0xdb, 0xdc, 0x09, 0x35, 0xf7, 0xf8, 0xf0, 0xdd, 0x4b, 0x48,
+  0x06, 0x09, 0x79, 0x0c, 0xec, 0x3f, 0x1e, 0x16, 0x8d, 0xea, 0x22, 0x2e,
+  0x81, 0x4d, 0xb4, 0x24, 0x24, 0x2c, 0xe1, 0x4c, 0x27, 0xd4, 0x4b, 0xdf,
+  0x3b, 0x17, 0x7b, 0x11, 0xe8, 0xf8, 0xca, 0x0f, 0xe0, 0x0d, 0x24, 0xd2,
+  0x1e, 0x3f, 0x1d, 0xf9, 0x13, 0xcd, 0x2e, 0xf8, 0x14, 0x1b, 0x28, 0xfe,
+  0xf2, 0x16, 0x17, 0xf5, 0x46, 0xf3, 0x3d, 0xe6, 0x38, 0xad, 0xe0, 0x15,
+  0x2e, 0xa5, 0x81, 0x19, 0x49, 0x42, 0x00, 0xd3, 0x2f, 0xf3, 0xce, 0xf6,
+  0x12, 0xd2, 0x0c, 0x23, 0xe9, 0xfa, 0x7f, 0xe5, 0x06, 0x67, 0x73, 0x4e,
+  0x08, 0x11, 0xe9, 0x4a, 0x58, 0xe7, 0x95, 0xec, 0x28, 0xa5, 0xa0, 0x17,
+  0xce, 0x2a, 0x41, 0x2a, 0x0d, 0xf0, 0x3c, 0xea, 0x28, 0x39, 0x12, 0xe0,
+  0x14, 0xcd, 0x12, 0xde, 0xb5, 0x53, 0xfa, 0x3f, 0x1e, 0xee, 0xa4, 0x0c,
+  0xd5, 0xa3, 0xf3, 0x81, 0x0d, 0x0e, 0xd4, 0xb1, 0xe7, 0xf3, 0xf9, 0xce,
+  0x03, 0xe4, 0xff, 0x17, 0xdd, 0x10, 0xed, 0xfc, 0xdd, 0x3c, 0x10, 0xca,
+  0xf4, 0xf2, 0xef, 0x14, 0xd7, 0x25, 0xcd, 0x31, 0xee, 0xb5, 0x11, 0x42,
+  0x13, 0xf4, 0x0f, 0x0b, 0xc6, 0x81, 0xf5, 0x7e, 0xa7, 0xe2, 0xd5, 0x53,
+  0xbd, 0xd8, 0x20, 0x0f, 0x2a, 0x28, 0x15, 0x6d, 0xf7, 0x0f, 0xfa, 0xb5,
+  0x37, 0x23, 0x21, 0xfb, 0xcf, 0xee, 0xf4, 0x01, 0xf7, 0x2b, 0x27, 0x1d,
+  0xe4, 0xd2, 0x1e, 0x41, 0x25, 0x31, 0x17, 0xf6, 0xe2, 0x09, 0xfd, 0x13,
+  0x42, 0x81, 0xa9, 0xac, 0x4d, 0x1e, 0xd2, 0x71, 0xeb, 0x0e, 0x33, 0x07,
+  0x2e, 0x8a, 0xd5, 0x20, 0x67, 0x40, 0x13, 0x35, 0x24, 0xff, 0x4a, 0xeb,
+  0xc5, 0x32, 0x10, 0xd0, 0x00, 0x12, 0x91, 0xc1, 0x23, 0x09, 0x2f, 0xb0,
+  0xff, 0xc3, 0x22, 0x10, 0xcb, 0x18, 0x7e, 0x79, 0x0c, 0x3f, 0x20, 0xfe,
+  0xc9, 0x53, 0x2b, 0x8c, 0xe8, 0xee, 0x2b, 0xf9, 0x0f, 0x5c, 0x44, 0x4c,
+  0x07, 0x18, 0x28, 0xa9, 0xb0, 0x96, 0xb2, 0x5d, 0xe1, 0xde, 0x7f, 0xa1,
+  0xde, 0xdc, 0x2e, 0x11, 0x00, 0x1c, 0xf9, 0xe3, 0x10, 0xee, 0xe1, 0x26,
+  0x02, 0xd2, 0x34, 0xf5, 0x0c, 0x55, 0xef, 0xea, 0x14, 0x0f, 0xfc, 0x1b,
+  0xff, 0x11, 0xc5, 0xda, 0x46, 0xd9, 0xfd, 0xcc, 0xe2, 0x8e, 0x07, 0xf3,
+  0x81, 0x16, 0x41, 0x0b, 0xd5, 0xa8, 0x46, 0x2c, 0x90, 0xda, 0xe4, 0xcf,
+  0x32, 0xdc, 0x27, 0xe6, 0xc2, 0xb8, 0xd2, 0xb8, 0xe6, 0x81, 0xf0, 0x08,
+  0xfd, 0x5a, 0x5c, 0x66, 0x35, 0xd9, 0xd0, 0xb3, 0x79, 0x21, 0x53, 0x23,
+  0x3c, 0x3e, 0x2e, 0x18, 0xf0, 0xe4, 0xf5, 0xfa, 0x7f, 0x2c, 0xa8, 0x01,
+  0x24, 0x02, 0x2a, 0xd0, 0xf5, 0xd0, 0xcc, 0xff, 0x17, 0x1e, 0x4f, 0x12,
+  0x3b, 0x67, 0xe1, 0x0e, 0x11, 0xfd, 0xe7, 0xa8, 0xf7, 0x1e, 0x28, 0x32,
+  0xed, 0x2c, 0xd6, 0x47, 0xee, 0xd2, 0xf9, 0x1f, 0x52, 0x34, 0x5e, 0x3a,
+  0x56, 0xe5, 0xc4, 0xf4, 0xde, 0xf6, 0x2f, 0xfb, 0x81, 0xc6, 0x31, 0x49,
+  0x54, 0x3b, 0xef, 0x31, 0x25, 0xea, 0x15, 0x11, 0x37, 0x40, 0x04, 0xea,
+  0xf4, 0x11, 0x27, 0x26, 0x5f, 0xec, 0x7d, 0xa6, 0x22, 0xdb, 0xf8, 0xdf,
+  0x28, 0xe7, 0x0f, 0xd5, 0x29, 0x1f, 0x4a, 0x1c, 0xed, 0x0d, 0x17, 0x03,
+  0xe1, 0xf3, 0x21, 0xac, 0xce, 0xd0, 0x9b, 0x02, 0x28, 0x4c, 0xb7, 0x17,
+  0x3e, 0xcb, 0x2a, 0x9b, 0xa8, 0x70, 0xf7, 0x00, 0xca, 0x5f, 0xac, 0x7f,
+  0x4e, 0x74, 0xf8, 0x34, 0x68, 0xcb, 0xcb, 0xde, 0xca, 0x28, 0xcd, 0xe5,
+  0xd8, 0x25, 0x01, 0x21, 0xeb, 0xc7, 0xcd, 0xc0, 0x20, 0x4a, 0xf7, 0x32,
+  0x35, 0x15, 0xeb, 0x18, 0x1e, 0xd1, 0x04, 0xf0, 0x47, 0x12, 0x2e, 0x03,
+  0x11, 0xff, 0x24, 0xb8, 0x1b, 0xfd, 0xbf, 0xd0, 0x7f, 0x18, 0xdc, 0xf2,
+  0x03, 0xe8, 0x81, 0x52, 0x0a, 0x3e, 0x14, 0x14, 0x9f, 0xc0, 0xbe, 0xf0,
+  0x74, 0xfd, 0xf8, 0x90, 0x0a, 0x15, 0xad, 0xff, 0xc3, 0x79, 0x57, 0x49,
+  0xa1, 0xc2, 0x2a, 0xc8, 0x44, 0xf0, 0x10, 0xd1, 0x97, 0xf3, 0xfc, 0xd7,
+  0x10, 0xc2, 0x9f, 0x33, 0xd9, 0xcf, 0x43, 0x97, 0x63, 0xc9, 0xcc, 0xc6,
+  0x3d, 0x59, 0x2e, 0xa4, 0x82, 0x11, 0xdb, 0xff, 0x57, 0x9d, 0xdf, 0x1a,
+  0x3f, 0xb2, 0xed, 0x37, 0xf6, 0x04, 0x01, 0xe5, 0x04, 0xfe, 0x9e, 0x2a,
+  0x1e, 0xec, 0x03, 0xd7, 0x3a, 0x58, 0x7f, 0xff, 0x49, 0xc5, 0x3f, 0x39,
+  0xe8, 0xeb, 0x2b, 0x05, 0x19, 0xfb, 0x2d, 0x39, 0x42, 0xda, 0x62, 0xda,
+  0x7f, 0xed, 0xbd, 0xb2, 0xf4, 0xf4, 0x44, 0xd2, 0x1c, 0xf1, 0x0d, 0x05,
+  0x1f, 0xd2, 0x0a, 0x9a, 0xc3, 0xa8, 0x11, 0xd1, 0xc4, 0xef, 0xb8, 0x2f,
+  0xe9, 0xbf, 0xd2, 0xfe, 0xee, 0x13, 0xc0, 0x08, 0xe9, 0xa3, 0x19, 0xc7,
+  0x3e, 0x01, 0xde, 0x5d, 0x66, 0x9b, 0x43, 0x2a, 0x53, 0xfe, 0xfd, 0x01,
+  0x3f, 0x0f, 0x15, 0x10, 0xca, 0x02, 0x7f, 0xd8, 0xcf, 0x4c, 0xaa, 0x0d,
+  0xf9, 0xba, 0x2f, 0xfa, 0xf7, 0xc5, 0xcd, 0xca, 0xe3, 0x1a, 0x51, 0x22,
+  0x7f, 0x66, 0x05, 0xec, 0x19, 0x9b, 0x6a, 0x08, 0xc1, 0xce, 0xe9, 0xa4,
+  0x4e, 0xd9, 0x09, 0x25, 0xd5, 0xd7, 0x03, 0x32, 0xd4, 0xd2, 0xcd, 0xfb,
+  0x5c, 0xd1, 0x49, 0xb6, 0x02, 0x3a, 0x15, 0x9b, 0x37, 0x2b, 0xc6, 0xc9,
+  0xe6, 0x50, 0x06, 0xc5, 0xff, 0xde, 0xcc, 0x5b, 0xaa, 0xf1, 0xed, 0x7f,
+  0x1a, 0x4c, 0xd5, 0x4c, 0xde, 0x78, 0x0e, 0xe9, 0xbf, 0xe9, 0x2b, 0xe1,
+  0x16, 0x37, 0xfd, 0xcc, 0x16, 0xdb, 0x16, 0xe4, 0xa4, 0x1f, 0x22, 0xf6,
+  0x4d, 0xef, 0x81, 0x66, 0xff, 0xe7, 0x02, 0xf3, 0x14, 0x98, 0xc2, 0xc0,
+  0x49, 0xe4, 0xfd, 0xe2, 0xba, 0x64, 0xd0, 0x9a, 0x08, 0x68, 0xe0, 0x2c,
+  0x37, 0x26, 0xdd, 0xf7, 0xf3, 0xcb, 0x04, 0xe4, 0x2c, 0x09, 0x29, 0xcf,
+  0xd3, 0x2a, 0x23, 0xf5, 0x1c, 0x2a, 0xc6, 0x47, 0x83, 0xf6, 0xbb, 0x40,
+  0xf2, 0xe4, 0x1f, 0x81, 0x17, 0xe3, 0x05, 0x57, 0xc9, 0x4d, 0x62, 0xd2,
+  0x0f, 0xfd, 0x30, 0x19, 0x45, 0xe0, 0xef, 0xe0, 0xa5, 0x28, 0x1f, 0xdf,
+  0x51, 0xb5, 0xfd, 0x10, 0xd5, 0xc2, 0xce, 0xdc, 0xe3, 0x51, 0x12, 0xe1,
+  0x40, 0x0d, 0x1e, 0x10, 0x34, 0x38, 0x32, 0x4d, 0xe7, 0xeb, 0xf4, 0xc4,
+  0xd5, 0xe6, 0x1d, 0x20, 0xe1, 0x0a, 0x4b, 0xb2, 0x11, 0xd0, 0xfb, 0xf8,
+  0xc5, 0x68, 0x22, 0x2e, 0x3e, 0xc3, 0xa9, 0x7f, 0xcf, 0xe4, 0xfc, 0x21,
+  0x0b, 0xf0, 0x27, 0xde, 0x1c, 0x2d, 0x22, 0x1c, 0x42, 0x19, 0xec, 0x5a,
+  0x17, 0x12, 0x0c, 0xbc, 0x17, 0xfc, 0xde, 0x18, 0xe9, 0xfb, 0x49, 0x0f,
+  0x37, 0xe5, 0xb1, 0x05, 0x7f, 0xb6, 0x18, 0xb7, 0xfe, 0xc0, 0x1d, 0xb2,
+  0x31, 0x6e, 0xfb, 0xf6, 0x14, 0x4d, 0x3e, 0xd0, 0x21, 0x15, 0x79, 0x0d,
+  0xda, 0x7c, 0x2d, 0x18, 0xd4, 0xef, 0xe4, 0xb9, 0x8d, 0x19, 0x81, 0x42,
+  0xb0, 0x1a, 0xca, 0x32, 0x2f, 0xca, 0x27, 0xce, 0xf2, 0x08, 0xf7, 0x0e,
+  0x3a, 0xe0, 0x2f, 0x0d, 0x1c, 0xc9, 0xfa, 0x2c, 0x2d, 0xfe, 0xae, 0xda,
+  0x1e, 0xd1, 0xf3, 0xbf, 0xd6, 0x37, 0x25, 0xdc, 0x1c, 0xee, 0x63, 0x2f,
+  0xca, 0x0b, 0xbb, 0xe2, 0x12, 0x3d, 0x48, 0x1c, 0x5e, 0x0b, 0x06, 0x16,
+  0xc9, 0x28, 0x1e, 0xf8, 0x3a, 0x48, 0x24, 0xe0, 0x7f, 0xb9, 0x8c, 0x53,
+  0x61, 0x2b, 0xfd, 0xc8, 0xd0, 0xea, 0xa1, 0x30, 0x0e, 0xe3, 0xf4, 0x7f,
+  0xef, 0x3d, 0x29, 0x16, 0x10, 0x23, 0xc4, 0xf2, 0xda, 0x3b, 0xdc, 0x37,
+  0xef, 0xbe, 0xba, 0xf1, 0x23, 0xd6, 0x59, 0x8d, 0x2f, 0xf9, 0x3c, 0xc0,
+  0xb9, 0x43, 0x3c, 0x3e, 0xcf, 0xd6, 0xd7, 0xcb, 0xd0, 0xe1, 0xf6, 0x79,
+  0x16, 0x40, 0xf6, 0x32, 0xfd, 0xb4, 0xa2, 0x4b, 0xdf, 0x1e, 0x6a, 0xa0,
+  0x29, 0xd9, 0x18, 0x68, 0x17, 0xa8, 0xf8, 0x96, 0xe9, 0xe4, 0x04, 0x22,
+  0xd9, 0x0c, 0xd1, 0x01, 0x30, 0xcf, 0xfc, 0x7f, 0xd0, 0xc6, 0xc0, 0x59,
+  0xb6, 0xda, 0xb9, 0x4e, 0x01, 0x24, 0xaa, 0x33, 0xc1, 0x0e, 0xef, 0xb4,
+  0x7e, 0xbf, 0x1d, 0x59, 0xdf, 0x06, 0xd4, 0xc7, 0xd5, 0x7f, 0x3d, 0x07,
+  0xa3, 0xec, 0x17, 0x44, 0xa1, 0x05, 0x70, 0x35, 0x02, 0x56, 0x47, 0x1e,
+  0x22, 0x13, 0x0e, 0xba, 0x51, 0xdc, 0x2b, 0x10, 0xdc, 0xde, 0x75, 0xa6,
+  0x3b, 0x2f, 0xcf, 0x15, 0x0e, 0xef, 0xc9, 0x23, 0x34, 0xfd, 0xcd, 0x2d,
+  0x48, 0xb1, 0x6c, 0x3a, 0x5b, 0x1e, 0x7d, 0x69, 0x2d, 0x73, 0x2d, 0xb5,
+  0x26, 0x63, 0x81, 0xeb, 0x1b, 0xf4, 0x08, 0xe1, 0xf5, 0x24, 0xff, 0x32,
+  0xd0, 0x2f, 0x6f, 0xb0, 0x35, 0x13, 0xb0, 0x4e, 0x8e, 0x23, 0x58, 0x15,
+  0xef, 0x00, 0xf1, 0x05, 0xc1, 0xd7, 0x81, 0x49, 0x00, 0xe6, 0xef, 0xcd,
+  0x00, 0x0f, 0x0f, 0xca, 0xda, 0x57, 0xde, 0x06, 0xf2, 0x81, 0xfb, 0xbf,
+  0x13, 0x01, 0xb0, 0xcb, 0x2a, 0x12, 0xec, 0xce, 0xff, 0xe9, 0xe3, 0x41,
+  0x57, 0xbb, 0x14, 0x3b, 0x10, 0xeb, 0xe5, 0x08, 0xfb, 0xfd, 0x15, 0xef,
+  0x0b, 0x10, 0xfb, 0x16, 0xf0, 0x00, 0x0b, 0xf0, 0x04, 0x09, 0x44, 0x02,
+  0xe6, 0xfb, 0x14, 0xdb, 0x0e, 0xca, 0x44, 0x00, 0xc1, 0x37, 0xf3, 0x9e,
+  0xbc, 0xc0, 0xc1, 0x02, 0xf2, 0x32, 0xd6, 0x60, 0xc8, 0x7f, 0xcd, 0x58,
+  0x11, 0x0d, 0x1c, 0x0d, 0x1f, 0x1e, 0x5f, 0x2f, 0xf1, 0x9d, 0xc9, 0x35,
+  0xfd, 0x0a, 0x18, 0x28, 0x34, 0xd5, 0x7f, 0x54, 0xab, 0x19, 0xf2, 0x12,
+  0x22, 0x37, 0xe9, 0xf1, 0x05, 0xb6, 0xb0, 0xf7, 0xd5, 0x02, 0x03, 0xf4,
+  0xb7, 0xfa, 0x15, 0x2f, 0x26, 0x05, 0x24, 0xac, 0x19, 0x1b, 0xfa, 0x16,
+  0x06, 0xb0, 0xfc, 0x20, 0xd3, 0x04, 0x25, 0xf6, 0x3a, 0xed, 0x08, 0x27,
+  0xaf, 0x1d, 0x37, 0x48, 0x12, 0xed, 0xf2, 0x56, 0x44, 0x00, 0x2a, 0xa5,
+  0x1d, 0x06, 0x2b, 0x1a, 0x01, 0x9d, 0x7f, 0xc5, 0x38, 0x0d, 0xd5, 0xcd,
+  0xc9, 0xe0, 0xc3, 0x22, 0xd1, 0xcd, 0x0f, 0xd1, 0xdd, 0x2c, 0xf9, 0x32,
+  0xfd, 0xbe, 0x9f, 0x34, 0xfc, 0xe0, 0x7f, 0x2e, 0x19, 0x00, 0x02, 0xf6,
+  0xe7, 0x97, 0x40, 0x2d, 0xd6, 0xfc, 0x0a, 0xe0, 0x3b, 0xeb, 0x2b, 0x0e,
+  0xf4, 0xc7, 0x2d, 0x36, 0xe9, 0x22, 0x18, 0xf6, 0xc6, 0x0c, 0x0e, 0x02,
+  0x1d, 0xf6, 0x1a, 0xde, 0x10, 0x2e, 0xba, 0x06, 0x5a, 0x22, 0x22, 0xd0,
+  0xf8, 0x26, 0x2f, 0x0c, 0xee, 0xd1, 0x25, 0x12, 0x1c, 0xfd, 0x14, 0x53,
+  0xf0, 0x7f, 0xf5, 0x21, 0x36, 0x14, 0x27, 0xc6, 0xf0, 0x27, 0xfe, 0xe4,
+  0x2b, 0xd4, 0xef, 0x13, 0xec, 0x27, 0x1f, 0x26, 0xf4, 0xf8, 0x2b, 0xd2,
+  0xe2, 0xf0, 0xd1, 0xb2, 0xdb, 0xb1, 0x08, 0x2f, 0x81, 0x13, 0xa9, 0x11,
+  0x2d, 0x17, 0xfc, 0x9a, 0x0a, 0xaa, 0x29, 0xa6, 0xe5, 0x1b, 0xf3, 0x1b,
+  0xd4, 0xd9, 0xcb, 0xf8, 0xfb, 0xff, 0x18, 0x08, 0x02, 0x27, 0x11, 0x13,
+  0x76, 0x56, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x02, 0x00, 0x00, 0xef, 0x07, 0x00, 0x00, 0xb3, 0x01, 0x00, 0x00,
   0x17, 0x02, 0x00, 0x00, 0xce, 0x0a, 0x00, 0x00, 0xe7, 0x03, 0x00, 0x00,
   0x3f, 0xe4, 0xff, 0xff, 0xd3, 0xe9, 0xff, 0xff, 0xd3, 0xef, 0xff, 0xff,
@@ -543,63 +547,64 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0xc8, 0xfa, 0xff, 0xff, 0xf9, 0x07, 0x00, 0x00, 0x84, 0xff, 0xff, 0xff,
   0x8a, 0xed, 0xff, 0xff, 0x19, 0x07, 0x00, 0x00, 0x7a, 0xed, 0xff, 0xff,
   0xd7, 0xe6, 0xff, 0xff, 0xa1, 0xf8, 0xff, 0xff, 0x3f, 0xe0, 0xff, 0xff,
-  0xc6, 0x58, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00,
-  0x06, 0xc9, 0x6e, 0xca, 0x53, 0x6c, 0xb7, 0x17, 0xf1, 0xed, 0x0d, 0x4f,
-  0xd0, 0x5e, 0x0c, 0x7f, 0x12, 0x7f, 0xd7, 0x7f, 0x7f, 0x7f, 0x21, 0xb0,
-  0xf4, 0x1c, 0x81, 0x81, 0x07, 0x81, 0x4b, 0x16, 0x06, 0x81, 0xde, 0x7f,
-  0x81, 0xe8, 0x7f, 0x81, 0x7f, 0xd8, 0xa3, 0xfc, 0xb0, 0xd5, 0x47, 0x7f,
-  0xd6, 0x90, 0x25, 0x7f, 0x10, 0x00, 0xe1, 0x0c, 0x60, 0x7f, 0x7f, 0x0b,
-  0x18, 0xf5, 0x81, 0x2d, 0x41, 0x38, 0x81, 0x48, 0x7f, 0xbf, 0x81, 0x0e,
-  0x53, 0xd6, 0x67, 0x01, 0xc5, 0x93, 0x0f, 0x81, 0xed, 0xe6, 0x32, 0x28,
-  0x28, 0x07, 0xc3, 0x7f, 0x46, 0xbc, 0x8a, 0x7f, 0x81, 0xbe, 0x81, 0x59,
-  0x5c, 0x7f, 0x8d, 0x2b, 0xc4, 0x0e, 0xbe, 0x81, 0x7f, 0x81, 0x81, 0x7f,
-  0x7f, 0x81, 0x7f, 0x71, 0x81, 0x7f, 0x7f, 0x16, 0xd7, 0x26, 0x9d, 0x71,
-  0x32, 0x8b, 0x81, 0xe9, 0x7f, 0x1d, 0xe9, 0x5f, 0xe9, 0x3c, 0xb7, 0x81,
-  0x33, 0x2b, 0x41, 0x01, 0x41, 0x81, 0x0b, 0x19, 0x2b, 0x76, 0xff, 0x2c,
-  0xd4, 0x44, 0x66, 0x22, 0x60, 0xe8, 0xc8, 0xc5, 0x17, 0x49, 0xcb, 0xaa,
-  0x03, 0xa5, 0x7f, 0xc9, 0x1b, 0x8f, 0x2d, 0x7c, 0xbe, 0x38, 0x6a, 0x87,
-  0xe3, 0x67, 0x94, 0x7f, 0xca, 0x81, 0x52, 0x72, 0x28, 0x0d, 0x17, 0x31,
-  0xb8, 0xf3, 0xba, 0x32, 0x4f, 0x72, 0x69, 0xed, 0x7f, 0xaa, 0xc4, 0x44,
-  0x7f, 0xd7, 0xd2, 0xdf, 0xdf, 0x55, 0x95, 0x7f, 0x7e, 0x7c, 0x30, 0x3b,
-  0xa5, 0xaa, 0xc8, 0xb5, 0x62, 0xd0, 0x43, 0x03, 0xf8, 0x81, 0xb2, 0x71,
-  0xe3, 0x02, 0x81, 0x47, 0xc0, 0x48, 0xc8, 0xe1, 0x09, 0x57, 0x84, 0x4b,
-  0x44, 0x1f, 0xbf, 0xd6, 0x72, 0xfc, 0xbb, 0x5f, 0x1c, 0xab, 0x08, 0xff,
-  0x9e, 0x09, 0x5d, 0xff, 0x86, 0xd2, 0xb8, 0x7c, 0x00, 0x95, 0xff, 0x7f,
-  0x37, 0xd1, 0xd0, 0x25, 0xd5, 0x0b, 0xbc, 0xa8, 0xe7, 0xc0, 0x7f, 0x7f,
-  0x7f, 0x36, 0xd9, 0x7f, 0x7f, 0x7f, 0x53, 0xe3, 0xa1, 0xd7, 0x7f, 0xd8,
-  0x41, 0xb1, 0xdd, 0xfc, 0x01, 0x0a, 0xf6, 0xc0, 0x23, 0xf5, 0x2d, 0x04,
-  0x0c, 0x96, 0xe2, 0x45, 0x0a, 0x4d, 0xfd, 0xee, 0xa8, 0x7f, 0xa4, 0x42,
-  0xef, 0xbe, 0x39, 0x0d, 0x34, 0x73, 0x42, 0xdf, 0x81, 0xbd, 0x28, 0xfc,
-  0x7f, 0x1c, 0xf1, 0xcd, 0x54, 0x81, 0xdc, 0x14, 0x2c, 0x38, 0x08, 0x81,
-  0x9b, 0x58, 0xe6, 0x18, 0x2d, 0x7f, 0xc7, 0xdf, 0xa9, 0x0b, 0x9e, 0x40,
-  0x7f, 0xa0, 0x46, 0xad, 0xc6, 0x97, 0x2e, 0x57, 0x1e, 0x0f, 0xe4, 0x0c,
-  0xd0, 0xf5, 0xad, 0x81, 0xf4, 0x17, 0x98, 0xe1, 0x52, 0x31, 0x3a, 0xa0,
-  0x63, 0x50, 0xcc, 0xe8, 0xf2, 0x34, 0xe1, 0x81, 0xa0, 0xc4, 0x60, 0x33,
-  0xd7, 0xb0, 0xf0, 0x2d, 0x8a, 0x01, 0x17, 0x65, 0xa7, 0xc5, 0x44, 0x37,
-  0xb2, 0x81, 0x12, 0x58, 0xf1, 0x52, 0x17, 0x77, 0x55, 0x78, 0x11, 0x49,
-  0x35, 0x07, 0x7f, 0xc7, 0x81, 0xae, 0x28, 0xdb, 0x1b, 0xc9, 0x1e, 0x71,
-  0xc7, 0xed, 0x30, 0xe7, 0x47, 0x07, 0xf7, 0x47, 0xb3, 0x88, 0x9c, 0x4d,
-  0x2b, 0xff, 0x3b, 0x54, 0xde, 0x0c, 0x2a, 0x48, 0x48, 0x36, 0xaf, 0xe8,
-  0xcc, 0x72, 0x7f, 0xaa, 0xb4, 0x91, 0x39, 0xe0, 0x68, 0xdf, 0xaa, 0x27,
-  0x4e, 0xb3, 0xf7, 0x8d, 0x64, 0x58, 0xf2, 0x86, 0xbe, 0x7f, 0x09, 0xb5,
-  0xd8, 0x50, 0x9b, 0x81, 0x81, 0x4c, 0x81, 0x35, 0x7c, 0x9c, 0xd7, 0xb5,
-  0xab, 0x15, 0x72, 0x05, 0x5f, 0x33, 0xe0, 0x9c, 0xf7, 0x81, 0xe4, 0x12,
-  0xb9, 0xc0, 0xa0, 0x81, 0x7f, 0x5d, 0x7f, 0xd6, 0xaf, 0x3c, 0xd7, 0x96,
-  0xf9, 0x54, 0xc7, 0xb7, 0xd4, 0xd4, 0x5a, 0xf5, 0x29, 0xb8, 0x7f, 0x1c,
-  0x81, 0x4e, 0x28, 0x2a, 0xa1, 0xb2, 0x61, 0x67, 0x81, 0x84, 0x7f, 0x4a,
-  0x7f, 0x7f, 0x15, 0x15, 0xe9, 0x41, 0x7f, 0xfc, 0xbb, 0xe8, 0x67, 0xba,
-  0xe3, 0xad, 0xe5, 0x15, 0x22, 0xe3, 0x7f, 0x7f, 0x81, 0x81, 0xe9, 0x9d,
-  0x7f, 0x2b, 0xf7, 0x7f, 0x81, 0x90, 0x81, 0xc3, 0x3b, 0x81, 0x2e, 0x7a,
-  0x48, 0xce, 0x7f, 0x34, 0x7f, 0x1a, 0x81, 0xbe, 0x81, 0x7f, 0x56, 0xc0,
-  0x05, 0x81, 0x7f, 0x81, 0x1d, 0xe4, 0x8d, 0x7f, 0x45, 0xdd, 0x33, 0x81,
-  0x62, 0x7f, 0xe1, 0xf2, 0x2b, 0x37, 0x35, 0xa1, 0x81, 0x78, 0x81, 0xa6,
-  0xcd, 0x7f, 0xc4, 0x19, 0x1b, 0x81, 0x81, 0x81, 0x81, 0x47, 0x7f, 0x99,
-  0x7f, 0x7f, 0x07, 0x9b, 0x2f, 0xa4, 0x0e, 0x0c, 0x81, 0xea, 0x81, 0x8b,
-  0xab, 0x7f, 0x5c, 0xae, 0xb8, 0x14, 0x19, 0xab, 0xf4, 0x5b, 0x30, 0x8c,
-  0x17, 0xb2, 0xf3, 0x81, 0x7f, 0x81, 0x48, 0x81, 0xda, 0x7f, 0x64, 0x18,
-  0x29, 0x81, 0x7f, 0x7f, 0x44, 0xfa, 0xfe, 0xff, 0x48, 0xfa, 0xfe, 0xff,
-  0x5a, 0x5b, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x86, 0x58, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x02, 0x00, 0x00, 0x06, 0xc9, 0x6e, 0xca, 0x53, 0x6c, 0xb7, 0x17,
+  0xf1, 0xed, 0x0d, 0x4f, 0xd0, 0x5e, 0x0c, 0x7f, 0x12, 0x7f, 0xd7, 0x7f,
+  0x7f, 0x7f, 0x21, 0xb0, 0xf4, 0x1c, 0x81, 0x81, 0x07, 0x81, 0x4b, 0x16,
+  0x06, 0x81, 0xde, 0x7f, 0x81, 0xe8, 0x7f, 0x81, 0x7f, 0xd8, 0xa3, 0xfc,
+  0xb0, 0xd5, 0x47, 0x7f, 0xd6, 0x90, 0x25, 0x7f, 0x10, 0x00, 0xe1, 0x0c,
+  0x60, 0x7f, 0x7f, 0x0b, 0x18, 0xf5, 0x81, 0x2d, 0x41, 0x38, 0x81, 0x48,
+  0x7f, 0xbf, 0x81, 0x0e, 0x53, 0xd6, 0x67, 0x01, 0xc5, 0x93, 0x0f, 0x81,
+  0xed, 0xe6, 0x32, 0x28, 0x28, 0x07, 0xc3, 0x7f, 0x46, 0xbc, 0x8a, 0x7f,
+  0x81, 0xbe, 0x81, 0x59, 0x5c, 0x7f, 0x8d, 0x2b, 0xc4, 0x0e, 0xbe, 0x81,
+  0x7f, 0x81, 0x81, 0x7f, 0x7f, 0x81, 0x7f, 0x71, 0x81, 0x7f, 0x7f, 0x16,
+  0xd7, 0x26, 0x9d, 0x71, 0x32, 0x8b, 0x81, 0xe9, 0x7f, 0x1d, 0xe9, 0x5f,
+  0xe9, 0x3c, 0xb7, 0x81, 0x33, 0x2b, 0x41, 0x01, 0x41, 0x81, 0x0b, 0x19,
+  0x2b, 0x76, 0xff, 0x2c, 0xd4, 0x44, 0x66, 0x22, 0x60, 0xe8, 0xc8, 0xc5,
+  0x17, 0x49, 0xcb, 0xaa, 0x03, 0xa5, 0x7f, 0xc9, 0x1b, 0x8f, 0x2d, 0x7c,
+  0xbe, 0x38, 0x6a, 0x87, 0xe3, 0x67, 0x94, 0x7f, 0xca, 0x81, 0x52, 0x72,
+  0x28, 0x0d, 0x17, 0x31, 0xb8, 0xf3, 0xba, 0x32, 0x4f, 0x72, 0x69, 0xed,
+  0x7f, 0xaa, 0xc4, 0x44, 0x7f, 0xd7, 0xd2, 0xdf, 0xdf, 0x55, 0x95, 0x7f,
+  0x7e, 0x7c, 0x30, 0x3b, 0xa5, 0xaa, 0xc8, 0xb5, 0x62, 0xd0, 0x43, 0x03,
+  0xf8, 0x81, 0xb2, 0x71, 0xe3, 0x02, 0x81, 0x47, 0xc0, 0x48, 0xc8, 0xe1,
+  0x09, 0x57, 0x84, 0x4b, 0x44, 0x1f, 0xbf, 0xd6, 0x72, 0xfc, 0xbb, 0x5f,
+  0x1c, 0xab, 0x08, 0xff, 0x9e, 0x09, 0x5d, 0xff, 0x86, 0xd2, 0xb8, 0x7c,
+  0x00, 0x95, 0xff, 0x7f, 0x37, 0xd1, 0xd0, 0x25, 0xd5, 0x0b, 0xbc, 0xa8,
+  0xe7, 0xc0, 0x7f, 0x7f, 0x7f, 0x36, 0xd9, 0x7f, 0x7f, 0x7f, 0x53, 0xe3,
+  0xa1, 0xd7, 0x7f, 0xd8, 0x41, 0xb1, 0xdd, 0xfc, 0x01, 0x0a, 0xf6, 0xc0,
+  0x23, 0xf5, 0x2d, 0x04, 0x0c, 0x96, 0xe2, 0x45, 0x0a, 0x4d, 0xfd, 0xee,
+  0xa8, 0x7f, 0xa4, 0x42, 0xef, 0xbe, 0x39, 0x0d, 0x34, 0x73, 0x42, 0xdf,
+  0x81, 0xbd, 0x28, 0xfc, 0x7f, 0x1c, 0xf1, 0xcd, 0x54, 0x81, 0xdc, 0x14,
+  0x2c, 0x38, 0x08, 0x81, 0x9b, 0x58, 0xe6, 0x18, 0x2d, 0x7f, 0xc7, 0xdf,
+  0xa9, 0x0b, 0x9e, 0x40, 0x7f, 0xa0, 0x46, 0xad, 0xc6, 0x97, 0x2e, 0x57,
+  0x1e, 0x0f, 0xe4, 0x0c, 0xd0, 0xf5, 0xad, 0x81, 0xf4, 0x17, 0x98, 0xe1,
+  0x52, 0x31, 0x3a, 0xa0, 0x63, 0x50, 0xcc, 0xe8, 0xf2, 0x34, 0xe1, 0x81,
+  0xa0, 0xc4, 0x60, 0x33, 0xd7, 0xb0, 0xf0, 0x2d, 0x8a, 0x01, 0x17, 0x65,
+  0xa7, 0xc5, 0x44, 0x37, 0xb2, 0x81, 0x12, 0x58, 0xf1, 0x52, 0x17, 0x77,
+  0x55, 0x78, 0x11, 0x49, 0x35, 0x07, 0x7f, 0xc7, 0x81, 0xae, 0x28, 0xdb,
+  0x1b, 0xc9, 0x1e, 0x71, 0xc7, 0xed, 0x30, 0xe7, 0x47, 0x07, 0xf7, 0x47,
+  0xb3, 0x88, 0x9c, 0x4d, 0x2b, 0xff, 0x3b, 0x54, 0xde, 0x0c, 0x2a, 0x48,
+  0x48, 0x36, 0xaf, 0xe8, 0xcc, 0x72, 0x7f, 0xaa, 0xb4, 0x91, 0x39, 0xe0,
+  0x68, 0xdf, 0xaa, 0x27, 0x4e, 0xb3, 0xf7, 0x8d, 0x64, 0x58, 0xf2, 0x86,
+  0xbe, 0x7f, 0x09, 0xb5, 0xd8, 0x50, 0x9b, 0x81, 0x81, 0x4c, 0x81, 0x35,
+  0x7c, 0x9c, 0xd7, 0xb5, 0xab, 0x15, 0x72, 0x05, 0x5f, 0x33, 0xe0, 0x9c,
+  0xf7, 0x81, 0xe4, 0x12, 0xb9, 0xc0, 0xa0, 0x81, 0x7f, 0x5d, 0x7f, 0xd6,
+  0xaf, 0x3c, 0xd7, 0x96, 0xf9, 0x54, 0xc7, 0xb7, 0xd4, 0xd4, 0x5a, 0xf5,
+  0x29, 0xb8, 0x7f, 0x1c, 0x81, 0x4e, 0x28, 0x2a, 0xa1, 0xb2, 0x61, 0x67,
+  0x81, 0x84, 0x7f, 0x4a, 0x7f, 0x7f, 0x15, 0x15, 0xe9, 0x41, 0x7f, 0xfc,
+  0xbb, 0xe8, 0x67, 0xba, 0xe3, 0xad, 0xe5, 0x15, 0x22, 0xe3, 0x7f, 0x7f,
+  0x81, 0x81, 0xe9, 0x9d, 0x7f, 0x2b, 0xf7, 0x7f, 0x81, 0x90, 0x81, 0xc3,
+  0x3b, 0x81, 0x2e, 0x7a, 0x48, 0xce, 0x7f, 0x34, 0x7f, 0x1a, 0x81, 0xbe,
+  0x81, 0x7f, 0x56, 0xc0, 0x05, 0x81, 0x7f, 0x81, 0x1d, 0xe4, 0x8d, 0x7f,
+  0x45, 0xdd, 0x33, 0x81, 0x62, 0x7f, 0xe1, 0xf2, 0x2b, 0x37, 0x35, 0xa1,
+  0x81, 0x78, 0x81, 0xa6, 0xcd, 0x7f, 0xc4, 0x19, 0x1b, 0x81, 0x81, 0x81,
+  0x81, 0x47, 0x7f, 0x99, 0x7f, 0x7f, 0x07, 0x9b, 0x2f, 0xa4, 0x0e, 0x0c,
+  0x81, 0xea, 0x81, 0x8b, 0xab, 0x7f, 0x5c, 0xae, 0xb8, 0x14, 0x19, 0xab,
+  0xf4, 0x5b, 0x30, 0x8c, 0x17, 0xb2, 0xf3, 0x81, 0x7f, 0x81, 0x48, 0x81,
+  0xda, 0x7f, 0x64, 0x18, 0x29, 0x81, 0x7f, 0x7f, 0x08, 0xfa, 0xfe, 0xff,
+  0x0c, 0xfa, 0xfe, 0xff, 0x1e, 0x5b, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -614,1401 +619,1402 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x5d, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xd5, 0x10, 0xd4, 0xf0,
-  0x2e, 0x0e, 0xb1, 0xcb, 0xf4, 0x13, 0x34, 0x2e, 0x03, 0x0b, 0x27, 0xff,
-  0x27, 0x37, 0x03, 0x0e, 0xeb, 0xef, 0xe5, 0x23, 0xf5, 0x28, 0x03, 0x2c,
-  0xe3, 0xe0, 0xfe, 0x42, 0x11, 0x4c, 0x10, 0x01, 0xe5, 0x2a, 0xff, 0xf4,
-  0xc4, 0x05, 0xf2, 0xac, 0x2e, 0x1b, 0x21, 0x0e, 0x24, 0xb7, 0x15, 0x8c,
-  0x47, 0x52, 0x50, 0xeb, 0xa8, 0x37, 0xe5, 0x28, 0x2a, 0xf8, 0x49, 0x1c,
-  0x43, 0xc9, 0xbe, 0x47, 0xfd, 0x59, 0x00, 0x28, 0x1b, 0x04, 0x13, 0x03,
-  0x07, 0xee, 0x32, 0xcc, 0xe5, 0x0e, 0xeb, 0x7f, 0x01, 0x39, 0x0b, 0x23,
-  0x23, 0xf9, 0x1e, 0x4c, 0x09, 0xe1, 0x0b, 0xfe, 0xf2, 0x2f, 0x19, 0x08,
-  0x29, 0xdb, 0x35, 0x1d, 0x0a, 0x8e, 0xfc, 0x3c, 0x02, 0x33, 0xd1, 0xfe,
-  0xb8, 0x08, 0x50, 0xea, 0xd9, 0x2f, 0xd6, 0x12, 0x71, 0xcb, 0xd2, 0x29,
-  0xd4, 0xf2, 0x9a, 0x14, 0x4b, 0x71, 0x42, 0x15, 0x32, 0xfe, 0xdb, 0xfc,
-  0x12, 0xd7, 0xfc, 0xca, 0x00, 0xe2, 0x0b, 0xd3, 0x11, 0x43, 0xf3, 0xdc,
-  0x19, 0x2b, 0xf9, 0x08, 0x0b, 0x98, 0x04, 0x0a, 0xe8, 0x20, 0x0a, 0xec,
-  0x1d, 0xf5, 0x21, 0x38, 0x0c, 0xc6, 0x7f, 0x20, 0x53, 0x41, 0xf8, 0xf2,
-  0xe3, 0xc6, 0x0b, 0x3d, 0x56, 0xf7, 0x16, 0xe8, 0xe4, 0xcd, 0xf1, 0x1d,
-  0x1c, 0xe3, 0xd9, 0xbb, 0x09, 0xd8, 0x3a, 0xda, 0x08, 0xf7, 0x43, 0xf9,
-  0x48, 0xbc, 0x21, 0x41, 0x0c, 0xb7, 0x05, 0x22, 0x09, 0x11, 0x00, 0x56,
-  0x02, 0x34, 0x14, 0x30, 0xd9, 0x33, 0xe1, 0xea, 0xf6, 0xe4, 0xf6, 0xe8,
-  0xf6, 0x02, 0x34, 0xe2, 0xe4, 0x2a, 0x1d, 0xeb, 0x1a, 0x06, 0xcc, 0xca,
-  0x00, 0xad, 0xf9, 0x06, 0x2f, 0x2f, 0x04, 0x1a, 0x2b, 0xe5, 0xd9, 0x05,
-  0xde, 0xfa, 0xf9, 0x00, 0xc9, 0xb5, 0x25, 0xda, 0xa7, 0x04, 0xf2, 0xe2,
-  0xec, 0xcb, 0xd7, 0x16, 0x40, 0xb6, 0x2a, 0x03, 0xff, 0xd8, 0xcb, 0x3a,
-  0x17, 0x1b, 0xcc, 0x14, 0x1a, 0x05, 0xfd, 0xf2, 0xfe, 0x13, 0xc4, 0x3b,
-  0x3c, 0x25, 0xf9, 0xcd, 0xd4, 0xd2, 0xb5, 0xd4, 0x33, 0x5d, 0x9a, 0x93,
-  0x31, 0x03, 0xf2, 0xc5, 0xf1, 0xf1, 0x25, 0x27, 0x26, 0x22, 0x1d, 0xdc,
-  0xe1, 0x18, 0x09, 0x12, 0xfe, 0xeb, 0x32, 0xe8, 0x34, 0x1e, 0x28, 0x10,
-  0xbb, 0x0f, 0x15, 0xf1, 0xcd, 0xcd, 0x06, 0x63, 0x01, 0x15, 0xf0, 0xe5,
-  0x13, 0xca, 0xc7, 0xdf, 0xdf, 0x32, 0x54, 0x10, 0x04, 0x64, 0x0d, 0x03,
-  0x1a, 0x03, 0xfb, 0xad, 0xf9, 0xe9, 0xc0, 0xed, 0x05, 0x14, 0x20, 0x3b,
-  0xff, 0x17, 0xe1, 0x1c, 0xb9, 0x81, 0xd8, 0x43, 0x22, 0x07, 0xfa, 0x42,
-  0xe5, 0xeb, 0x04, 0x15, 0xf1, 0x15, 0x23, 0xf3, 0xdf, 0x2f, 0xfe, 0xeb,
-  0x05, 0xf2, 0x11, 0xd0, 0x3e, 0x42, 0xd5, 0xd8, 0x1b, 0xd1, 0x16, 0x16,
-  0x39, 0xd7, 0xef, 0xfe, 0x15, 0x2b, 0x55, 0x0c, 0x0f, 0x32, 0xe6, 0x02,
-  0x39, 0x11, 0xe5, 0xe1, 0x0f, 0x30, 0xe5, 0x00, 0x00, 0x2e, 0x13, 0x2f,
-  0xe9, 0xed, 0xce, 0x00, 0xc3, 0x3c, 0xfd, 0xd9, 0x02, 0xd7, 0x13, 0x77,
-  0xf3, 0xd5, 0xf1, 0xf8, 0xa5, 0x21, 0xac, 0x18, 0xf7, 0xc4, 0xfb, 0xc9,
-  0xde, 0x00, 0x01, 0x10, 0xd9, 0x2c, 0x0e, 0x1c, 0x21, 0x1d, 0x06, 0xf1,
-  0xfb, 0xb1, 0xf1, 0x7f, 0x0e, 0x40, 0xfa, 0x39, 0xc4, 0xfe, 0x21, 0x01,
-  0x33, 0x00, 0x1b, 0xe1, 0x18, 0x4d, 0x40, 0x40, 0x18, 0x25, 0x34, 0xc8,
-  0x35, 0xcd, 0x0a, 0x05, 0x42, 0x04, 0x45, 0x4b, 0xfe, 0x0d, 0xd7, 0x06,
-  0xc2, 0x0e, 0x31, 0x0f, 0x06, 0xb6, 0xc3, 0x48, 0x13, 0x05, 0x03, 0xea,
-  0x01, 0xfa, 0x0f, 0x1a, 0x11, 0x34, 0xcd, 0x3d, 0x22, 0x1d, 0x11, 0x00,
-  0x05, 0x1b, 0x0f, 0x09, 0x0e, 0x21, 0xe3, 0xfd, 0x1f, 0x1c, 0xc5, 0xb6,
-  0x13, 0xf6, 0x23, 0xfd, 0x29, 0x14, 0xc2, 0xe7, 0xe6, 0xde, 0x9a, 0x1a,
-  0x98, 0xf3, 0xe5, 0xc0, 0xd3, 0x0d, 0x50, 0x0e, 0xc8, 0x02, 0xfc, 0x01,
-  0x1e, 0x51, 0x20, 0xcf, 0x15, 0xae, 0x34, 0x2b, 0xfb, 0x13, 0xeb, 0x99,
-  0xf8, 0xfb, 0x0a, 0x1c, 0x12, 0x16, 0x04, 0xfa, 0x7f, 0x27, 0x28, 0xcf,
-  0xf0, 0x46, 0x31, 0x0c, 0x02, 0x26, 0x5a, 0xda, 0xce, 0x26, 0x64, 0x09,
-  0xe2, 0xf5, 0xc5, 0x1b, 0x36, 0x04, 0x0a, 0xfc, 0x1f, 0x08, 0xe3, 0xfc,
-  0xb8, 0x1e, 0xdf, 0x77, 0xf6, 0xde, 0xe6, 0x12, 0xde, 0xe4, 0xc5, 0x56,
-  0x9f, 0xbf, 0x53, 0xec, 0xed, 0x4b, 0xf7, 0xde, 0x36, 0xb9, 0x06, 0x02,
-  0x29, 0xea, 0x59, 0x1e, 0x5c, 0x56, 0xc9, 0x94, 0xd2, 0x09, 0x1e, 0x40,
-  0x4c, 0xf3, 0xf8, 0xf6, 0x78, 0xfa, 0xda, 0x51, 0x08, 0xe2, 0xfa, 0x2d,
-  0x31, 0xf1, 0xf3, 0x22, 0xeb, 0xe7, 0x1b, 0x17, 0x40, 0xea, 0x07, 0xe9,
-  0x42, 0xe8, 0xdf, 0xf6, 0xcb, 0x27, 0x75, 0x0f, 0xb9, 0xd7, 0xd0, 0xe9,
-  0xdd, 0xc4, 0xcb, 0x07, 0x32, 0x0d, 0x34, 0xf0, 0xa6, 0x10, 0x22, 0x27,
-  0xf5, 0x16, 0xde, 0xe4, 0xe7, 0x26, 0xe1, 0x61, 0xee, 0x05, 0x7b, 0x57,
-  0xc8, 0xa6, 0xb2, 0xf6, 0x20, 0x48, 0xea, 0xed, 0xb5, 0xf0, 0xbd, 0x17,
-  0xc8, 0xdb, 0x54, 0xb7, 0x30, 0xfb, 0xfe, 0xd8, 0x0b, 0x28, 0xea, 0xe4,
-  0x81, 0xdd, 0x08, 0x59, 0x9d, 0x98, 0xb9, 0x45, 0x06, 0xb3, 0xa0, 0x19,
-  0x04, 0xe9, 0x11, 0x0a, 0xdf, 0xb6, 0xcb, 0xff, 0xe6, 0x10, 0xca, 0xd0,
-  0xd4, 0x11, 0x4d, 0xd7, 0x43, 0xe5, 0x1e, 0xe4, 0x0c, 0x3f, 0x23, 0xf3,
-  0x00, 0xc9, 0x37, 0x30, 0xe0, 0x2f, 0x04, 0x58, 0x46, 0xbf, 0xf1, 0x21,
-  0x39, 0x4e, 0xa5, 0xe7, 0xb6, 0xd3, 0x66, 0x0e, 0x02, 0x18, 0xdf, 0xbb,
-  0xea, 0xaf, 0x0e, 0x44, 0xfc, 0xf4, 0x18, 0xe6, 0xed, 0xed, 0xe6, 0x17,
-  0x5f, 0x07, 0x94, 0x18, 0x19, 0x30, 0xec, 0x3c, 0xef, 0x24, 0xec, 0x41,
-  0xe3, 0x0c, 0xda, 0xd8, 0xe6, 0x20, 0xf7, 0xe9, 0xe8, 0x37, 0xfb, 0x19,
-  0xd6, 0xe3, 0xea, 0x14, 0xcd, 0x43, 0xf1, 0x11, 0xe4, 0xfb, 0x2e, 0xb6,
-  0xfa, 0x35, 0x3c, 0xf9, 0xfe, 0xfc, 0xe6, 0xfd, 0xd5, 0x05, 0xbf, 0xe6,
-  0xda, 0xd6, 0x20, 0x7f, 0xf8, 0x30, 0xbf, 0x1f, 0xcf, 0x0f, 0xd7, 0x10,
-  0x3b, 0x00, 0x1e, 0x00, 0xeb, 0x63, 0x3c, 0xe2, 0xe8, 0x0c, 0xed, 0xdc,
-  0x01, 0x06, 0xf2, 0xf0, 0x3a, 0x0c, 0x30, 0x7a, 0x14, 0xb3, 0x38, 0xd6,
-  0xba, 0xb7, 0xec, 0x3b, 0x2f, 0x0e, 0xea, 0x61, 0x15, 0xf9, 0xe8, 0xfe,
-  0xdb, 0xf0, 0x10, 0xd3, 0xa6, 0x1f, 0xc0, 0x02, 0x1f, 0xfe, 0xdc, 0x1c,
-  0x13, 0x0b, 0xff, 0x2f, 0x08, 0xfa, 0x19, 0xe0, 0x37, 0x4a, 0x20, 0xcc,
-  0x07, 0x10, 0xdc, 0xbb, 0xed, 0xfd, 0xac, 0x1a, 0xd0, 0x13, 0xdd, 0xfb,
-  0xda, 0xf5, 0xd4, 0x02, 0xf4, 0x06, 0x3a, 0xeb, 0xb8, 0xf0, 0x08, 0x07,
-  0x42, 0x16, 0x1e, 0xf1, 0x1a, 0xdf, 0x41, 0xcb, 0xeb, 0xfc, 0xf3, 0xb2,
-  0x10, 0xf7, 0xd5, 0xfc, 0x02, 0xf6, 0x19, 0xc1, 0x51, 0x05, 0x1b, 0x40,
-  0xf5, 0xfa, 0xf1, 0x16, 0xde, 0x7e, 0x56, 0xc8, 0xfe, 0xff, 0x11, 0xde,
-  0x0a, 0x10, 0xf4, 0xe8, 0x22, 0xe6, 0xe6, 0x00, 0xbe, 0x32, 0x2f, 0x0b,
-  0xa2, 0x1a, 0x14, 0x49, 0xe2, 0xde, 0x19, 0x27, 0xa5, 0xd4, 0xd8, 0xfa,
-  0xc8, 0xef, 0x76, 0x01, 0xe3, 0x0c, 0x14, 0xd2, 0xf7, 0xf2, 0x09, 0x18,
-  0xbc, 0xde, 0x7f, 0x4d, 0x36, 0x1c, 0xf5, 0x01, 0xc3, 0x0d, 0x10, 0x2d,
-  0x3a, 0xdc, 0x3f, 0xe1, 0x25, 0x0c, 0xe6, 0xf2, 0x1e, 0xcb, 0xf5, 0x11,
-  0xb3, 0xec, 0x55, 0x1b, 0x1a, 0xed, 0xae, 0x29, 0x4e, 0x3b, 0xff, 0x01,
-  0xd6, 0x28, 0xea, 0x3a, 0x59, 0x5b, 0x8c, 0x17, 0xd5, 0x2e, 0x2b, 0x07,
-  0x01, 0x36, 0xde, 0x47, 0xb4, 0xbf, 0xca, 0xdf, 0xe6, 0xd3, 0x45, 0x21,
-  0xe9, 0x65, 0xdc, 0x3d, 0x0d, 0xd2, 0x9d, 0x2f, 0x16, 0xec, 0xaa, 0x1e,
-  0x6c, 0xef, 0x02, 0xda, 0xe2, 0x44, 0x14, 0xbf, 0xc2, 0xf1, 0xfd, 0xcf,
-  0xea, 0x17, 0xef, 0x1a, 0xe4, 0xad, 0x4f, 0x46, 0x1d, 0x35, 0x03, 0xe2,
-  0xdd, 0xe6, 0x1e, 0x2f, 0xfc, 0xec, 0x2b, 0x21, 0x24, 0x67, 0x3b, 0xda,
-  0x35, 0xbe, 0x0e, 0xaa, 0x6e, 0x10, 0xe8, 0xde, 0xfd, 0x0c, 0x05, 0x4e,
-  0x23, 0x0c, 0x21, 0x0d, 0x97, 0xc3, 0x43, 0x35, 0xf6, 0x32, 0x44, 0xc6,
-  0x69, 0x1d, 0xde, 0xc2, 0x1b, 0x7f, 0xfc, 0x36, 0xfb, 0x69, 0xbb, 0x15,
-  0x52, 0xc1, 0x09, 0xcd, 0xb7, 0x01, 0xeb, 0x0c, 0x0a, 0x0a, 0x05, 0x0d,
-  0xf7, 0x09, 0x1f, 0x17, 0xa9, 0xda, 0xe0, 0x04, 0xdc, 0xcb, 0xa2, 0x4d,
-  0x2c, 0xe9, 0xb9, 0x03, 0x06, 0xc3, 0x3e, 0x06, 0x49, 0xdc, 0x29, 0x6c,
-  0x05, 0x41, 0xcb, 0x35, 0x06, 0xd7, 0x13, 0x29, 0xcf, 0x3e, 0xb9, 0xdd,
-  0xdf, 0x1c, 0xfa, 0x1c, 0x1e, 0xd6, 0xf5, 0xed, 0x30, 0x70, 0x0c, 0xca,
-  0xd4, 0x52, 0xe1, 0x07, 0x08, 0xd3, 0xda, 0x19, 0x10, 0x3e, 0x34, 0xf5,
-  0x31, 0x70, 0xe0, 0xd4, 0x19, 0x21, 0xd9, 0x40, 0x81, 0xee, 0x06, 0xe7,
-  0x48, 0xe2, 0x30, 0x4e, 0x1b, 0xad, 0x0f, 0x1c, 0xef, 0x03, 0x11, 0xf7,
-  0x82, 0xd4, 0xe4, 0x29, 0xbc, 0x18, 0x0c, 0x0b, 0xce, 0xfe, 0x2a, 0xfd,
-  0xe7, 0x1d, 0xdd, 0xef, 0x47, 0x1e, 0x36, 0xdf, 0xf3, 0xd9, 0xe8, 0x0f,
-  0xe7, 0xf8, 0x09, 0x2e, 0xe2, 0xe1, 0x08, 0x22, 0x41, 0x1b, 0xfb, 0x88,
-  0xd8, 0xd3, 0x06, 0x02, 0x3c, 0xdd, 0xd5, 0xf1, 0x2a, 0xe9, 0x09, 0xd7,
-  0xbf, 0xf9, 0x05, 0xf9, 0x04, 0x0e, 0xe8, 0x9b, 0xf0, 0xfd, 0xd7, 0x46,
-  0x08, 0xf2, 0xef, 0x03, 0x17, 0xa5, 0xf0, 0x41, 0xd9, 0xf0, 0x24, 0x15,
-  0x03, 0xdc, 0x19, 0xdd, 0x1a, 0x38, 0xf8, 0x7f, 0xac, 0x94, 0x04, 0xdd,
-  0xe2, 0xf1, 0x46, 0xaf, 0x01, 0xe4, 0xf1, 0xe7, 0x3f, 0xf7, 0xc6, 0xf4,
-  0x11, 0xee, 0x19, 0xf5, 0xe4, 0x3e, 0xf5, 0xea, 0x0f, 0xf9, 0xf4, 0x2b,
-  0xe0, 0xe8, 0x1e, 0xda, 0x19, 0x2c, 0x39, 0xda, 0x0b, 0x17, 0xd6, 0xf1,
-  0x14, 0x16, 0xe6, 0x0c, 0x0d, 0xad, 0xf4, 0x8c, 0xe8, 0xc5, 0xec, 0xec,
-  0xfb, 0xca, 0xfc, 0x1b, 0xaa, 0x1b, 0xee, 0xc6, 0xeb, 0x25, 0xf9, 0xda,
-  0xd6, 0xda, 0xce, 0xa3, 0x05, 0x3c, 0x03, 0xc2, 0xc5, 0x3e, 0xa9, 0x0d,
-  0xe7, 0x2c, 0xc4, 0xfb, 0xe9, 0xf4, 0x04, 0x09, 0x07, 0xff, 0x1a, 0xcf,
-  0xfe, 0x7f, 0x10, 0xfc, 0xfe, 0x02, 0x1e, 0xc9, 0xe0, 0x27, 0xe9, 0xf9,
-  0xd5, 0x2c, 0x28, 0x03, 0xfd, 0x2c, 0x0a, 0xc7, 0x0d, 0x1f, 0x04, 0xeb,
-  0x19, 0xbd, 0x09, 0x01, 0xf6, 0xe0, 0x18, 0xb4, 0xf0, 0x31, 0x06, 0xfb,
-  0x37, 0xf6, 0x3a, 0x00, 0x26, 0x07, 0x01, 0x2c, 0xda, 0xe0, 0x0d, 0xfa,
-  0x40, 0xce, 0x05, 0xe2, 0xea, 0xec, 0x22, 0x47, 0xfa, 0xf0, 0x29, 0xc9,
-  0xf9, 0x01, 0xe1, 0x51, 0xfd, 0x20, 0xea, 0xbe, 0x19, 0xf7, 0x35, 0x2f,
-  0xff, 0x03, 0xfa, 0x1b, 0xf0, 0x2c, 0x37, 0x14, 0xf8, 0x30, 0x0c, 0xf9,
-  0xf4, 0x3e, 0x17, 0xf7, 0xfc, 0xb6, 0x27, 0xed, 0xf5, 0xe7, 0xe2, 0xe8,
-  0xe8, 0xe8, 0x27, 0xdb, 0x01, 0xf3, 0x01, 0xd3, 0xdf, 0xfd, 0xf9, 0xc4,
-  0xfc, 0x2b, 0x39, 0xec, 0x00, 0x14, 0xed, 0xd0, 0xef, 0x16, 0xfa, 0x1c,
-  0x23, 0xfe, 0x1e, 0xe0, 0xce, 0xfa, 0xfd, 0x14, 0x19, 0x1b, 0xef, 0x0d,
-  0x81, 0xda, 0x32, 0x5c, 0x44, 0xff, 0xfb, 0xe7, 0x48, 0xe4, 0x3e, 0x33,
-  0xb8, 0x24, 0xd6, 0x03, 0xf1, 0xee, 0xe1, 0xfb, 0xe3, 0xb9, 0xdc, 0xfe,
-  0x21, 0xc7, 0x07, 0x04, 0x6a, 0xd0, 0x13, 0x15, 0xb1, 0x16, 0x34, 0x26,
-  0xbc, 0xeb, 0x10, 0xd4, 0xf9, 0xd2, 0x2c, 0x28, 0xb0, 0xf4, 0xd6, 0xf8,
-  0x6e, 0xa2, 0xea, 0x9d, 0x02, 0xcc, 0xf6, 0x44, 0x1e, 0xd7, 0xe2, 0x1b,
-  0x5a, 0xef, 0xc5, 0xea, 0xfe, 0xc9, 0x3d, 0x74, 0x0f, 0x0e, 0x30, 0xb5,
-  0xad, 0xc1, 0xfd, 0x3a, 0xec, 0xc0, 0xd3, 0x21, 0xe6, 0x2a, 0x04, 0x35,
-  0x58, 0x6d, 0xd7, 0x3a, 0x36, 0xd9, 0x07, 0x20, 0xe0, 0xd7, 0xb9, 0x53,
-  0xd7, 0xe4, 0xb5, 0x0b, 0xef, 0x2c, 0x00, 0xb3, 0x8d, 0x06, 0xe6, 0x0f,
-  0x67, 0x47, 0x0e, 0x18, 0xd4, 0xde, 0xf5, 0x19, 0x04, 0x41, 0xe6, 0xf0,
-  0x37, 0xfa, 0x03, 0x90, 0x30, 0x00, 0xc0, 0xfa, 0x06, 0xe9, 0xf5, 0x17,
-  0x02, 0x14, 0xd6, 0x3a, 0x1d, 0xbc, 0xe3, 0x27, 0x0e, 0x4b, 0x1b, 0x1b,
-  0x06, 0xe3, 0x2c, 0xf3, 0x47, 0x1c, 0xcd, 0x46, 0x01, 0x24, 0x13, 0xe5,
-  0xf8, 0xcb, 0xe7, 0x7f, 0xc9, 0x02, 0xdb, 0xbd, 0xaa, 0x0f, 0x02, 0xba,
-  0xd2, 0xf9, 0xef, 0xfb, 0xe7, 0xdc, 0x5f, 0x06, 0x0e, 0x5b, 0x2c, 0x0a,
-  0x13, 0x19, 0xe4, 0x06, 0xf8, 0x60, 0xff, 0x24, 0xeb, 0x14, 0x2b, 0x03,
-  0x05, 0x44, 0x30, 0x19, 0x34, 0x13, 0xf6, 0xd3, 0xec, 0x19, 0xe7, 0xcc,
-  0xa5, 0x62, 0xf7, 0x29, 0x23, 0x0d, 0x3a, 0x18, 0xc2, 0x35, 0x4b, 0xfe,
-  0x1b, 0xfe, 0xee, 0x29, 0xf1, 0xf5, 0x4f, 0x08, 0x4e, 0xa8, 0xa8, 0xe3,
-  0x23, 0x1e, 0xd1, 0x34, 0x21, 0xe9, 0xd9, 0x3d, 0x41, 0x3b, 0xef, 0x51,
-  0x28, 0xca, 0xca, 0x08, 0x3e, 0xd0, 0xe6, 0xf2, 0x0e, 0xc4, 0xf4, 0xe5,
-  0xcd, 0x26, 0x1f, 0x2e, 0xcc, 0xdc, 0x95, 0xe5, 0x2e, 0x16, 0x04, 0xd2,
-  0x2c, 0x00, 0x3b, 0xcd, 0x40, 0xfd, 0xd0, 0xd3, 0xbc, 0x07, 0x4a, 0x36,
-  0x13, 0x0e, 0x29, 0x3e, 0x1d, 0x32, 0xf6, 0xef, 0x29, 0xdf, 0xee, 0x2d,
-  0xff, 0x15, 0xf4, 0xe2, 0x98, 0x16, 0x4e, 0xfd, 0x01, 0x20, 0x0a, 0x71,
-  0xf8, 0xf6, 0x2a, 0x40, 0x00, 0x15, 0x40, 0xa9, 0xc6, 0xf6, 0x03, 0xe4,
-  0xee, 0x29, 0xd6, 0xc2, 0xe4, 0xf4, 0x43, 0xf2, 0xcb, 0x0e, 0xde, 0xff,
-  0x48, 0x31, 0x18, 0xc9, 0x7f, 0x47, 0x08, 0xe7, 0xeb, 0xe9, 0x21, 0x1b,
-  0x11, 0xda, 0x30, 0x76, 0xcb, 0xfe, 0x55, 0xe5, 0x28, 0x8e, 0x3c, 0x43,
-  0x19, 0xf6, 0xdf, 0xee, 0x31, 0xe5, 0x08, 0xe6, 0x22, 0xe7, 0x3c, 0xf7,
-  0x18, 0x66, 0x00, 0xcb, 0x42, 0xe1, 0xc4, 0x09, 0x1a, 0xfd, 0xca, 0x2a,
-  0x0b, 0x18, 0xe9, 0x1f, 0xd1, 0xf7, 0xc9, 0x06, 0xf4, 0xd7, 0xd5, 0x33,
-  0xf7, 0x2a, 0xdf, 0xe0, 0x33, 0x10, 0xe2, 0x12, 0x23, 0x16, 0x01, 0xfc,
-  0x3c, 0xbf, 0xe0, 0x19, 0x1a, 0xe3, 0xbb, 0x2f, 0xcd, 0x14, 0x35, 0xdc,
-  0x2a, 0x3b, 0xd8, 0x3c, 0xcf, 0x46, 0xdd, 0xcb, 0x2c, 0xf6, 0x32, 0xbf,
-  0xd9, 0xdb, 0xdc, 0xec, 0x3c, 0x2e, 0xc5, 0x18, 0x0e, 0x18, 0x35, 0xe8,
-  0x5a, 0x1f, 0x2a, 0x11, 0x10, 0x23, 0xd2, 0xcb, 0xf5, 0x1e, 0x23, 0xcf,
-  0xd8, 0xd2, 0xef, 0x1f, 0x09, 0x43, 0xed, 0xdc, 0x2c, 0x24, 0xff, 0x0e,
-  0xdd, 0x3c, 0x0a, 0x20, 0xaf, 0x42, 0xce, 0x19, 0x08, 0xef, 0x0b, 0x30,
-  0xf3, 0x1d, 0x03, 0x30, 0xfa, 0x39, 0x1a, 0xe0, 0x01, 0x1f, 0xf8, 0xf2,
-  0xe7, 0xcd, 0x12, 0x05, 0xba, 0xb0, 0x1b, 0x46, 0xe1, 0xd2, 0x98, 0xdc,
-  0xe1, 0xe3, 0x31, 0xd8, 0x36, 0xe5, 0xd8, 0x2f, 0x7f, 0x83, 0xe0, 0x3f,
-  0xf5, 0x15, 0x10, 0x16, 0x17, 0x5a, 0x1b, 0x3a, 0x36, 0x11, 0x3a, 0xc3,
-  0xeb, 0x3b, 0xdf, 0xad, 0x92, 0xdb, 0x3a, 0xf2, 0xba, 0x01, 0x04, 0xad,
-  0x0e, 0x1b, 0x1d, 0xd9, 0xdf, 0xc9, 0x1e, 0x06, 0xd1, 0xd8, 0x02, 0x9e,
-  0xd8, 0x4c, 0x57, 0xf5, 0x66, 0xd4, 0x35, 0x0d, 0x24, 0x2a, 0x16, 0xf3,
-  0x1f, 0xcb, 0xe1, 0x0a, 0x04, 0xd7, 0x0b, 0xed, 0x3a, 0xd4, 0xd9, 0x3f,
-  0x0e, 0x22, 0x0a, 0xc8, 0x09, 0x25, 0x15, 0x1e, 0xbc, 0xd6, 0xc8, 0xd7,
-  0x43, 0xef, 0x01, 0x3c, 0xfd, 0xbb, 0xf7, 0x48, 0x00, 0x1c, 0xfd, 0x40,
-  0xef, 0x09, 0x38, 0xde, 0x1c, 0x55, 0xa0, 0x1b, 0x7f, 0xff, 0xe7, 0x0a,
-  0xee, 0xb7, 0xfe, 0xd1, 0x3b, 0x25, 0xc2, 0xff, 0x26, 0x0b, 0x15, 0xfa,
-  0x21, 0xcb, 0xf9, 0x2b, 0x30, 0x1e, 0x48, 0x0e, 0x11, 0x3e, 0xac, 0xb1,
-  0x68, 0x01, 0x6f, 0xb8, 0x05, 0xc1, 0xfd, 0x19, 0x87, 0x29, 0x2d, 0xd5,
-  0x23, 0x03, 0x01, 0x19, 0xc3, 0xdd, 0xff, 0xe4, 0xc2, 0xc7, 0xed, 0x17,
-  0x0c, 0xe8, 0xe5, 0x26, 0xd1, 0xeb, 0xfe, 0xfb, 0xbc, 0xfe, 0x21, 0x17,
-  0x2f, 0xe0, 0xfa, 0x12, 0xe2, 0xfe, 0x4d, 0x4d, 0x23, 0x22, 0x60, 0xca,
-  0xe3, 0xb4, 0x22, 0xd8, 0xdc, 0x25, 0xdd, 0xf9, 0x2e, 0x09, 0xf3, 0x16,
-  0x04, 0xe8, 0xe6, 0xda, 0x46, 0x2a, 0xf6, 0x0c, 0x03, 0x83, 0xc7, 0x39,
-  0xd8, 0x74, 0x6d, 0xcb, 0x30, 0x57, 0x0d, 0xda, 0x28, 0xe2, 0xf4, 0xc9,
-  0xd9, 0x30, 0xe0, 0xcc, 0xb6, 0x56, 0xee, 0x24, 0xd9, 0x2f, 0x05, 0x72,
-  0xc9, 0xc7, 0x15, 0x24, 0xc5, 0x03, 0xfe, 0x01, 0xab, 0x2a, 0x0f, 0xf0,
-  0x0e, 0xad, 0x40, 0xcf, 0x44, 0xae, 0xfa, 0x63, 0xd4, 0xfc, 0x7f, 0x11,
-  0x57, 0x01, 0xf8, 0x1d, 0xcb, 0x33, 0xe6, 0x2b, 0xf2, 0xa4, 0xec, 0xa4,
-  0x3f, 0x22, 0xdf, 0xfc, 0x1b, 0xdc, 0x21, 0x0e, 0x3a, 0xeb, 0xd5, 0xa1,
-  0xec, 0x03, 0x40, 0xdb, 0xa6, 0x9f, 0xf2, 0xa1, 0xda, 0x0f, 0xf0, 0x0f,
-  0xfe, 0x19, 0x01, 0xee, 0x4b, 0x1a, 0xec, 0xba, 0x3a, 0xe1, 0xed, 0xd5,
-  0x21, 0x23, 0xe0, 0x12, 0x11, 0x1c, 0x0c, 0xee, 0xf6, 0xfd, 0x03, 0xf0,
-  0xd3, 0xdc, 0xac, 0xcf, 0xdf, 0xdc, 0xd1, 0xdb, 0x3e, 0x57, 0x0e, 0x08,
-  0x2e, 0x12, 0x10, 0xd9, 0x02, 0xf6, 0x81, 0xe5, 0x4e, 0x26, 0x4c, 0xf7,
-  0x39, 0x25, 0x01, 0xe4, 0xb7, 0xf6, 0x15, 0xcd, 0x99, 0x97, 0xdb, 0xe7,
-  0x2a, 0xc3, 0xbb, 0x2b, 0xaa, 0xd1, 0xbf, 0x0f, 0xeb, 0x4e, 0x33, 0xf3,
-  0x21, 0x3e, 0xda, 0x31, 0xff, 0x12, 0x22, 0xf3, 0xec, 0x0b, 0x0b, 0x30,
-  0x05, 0xb0, 0x28, 0xf1, 0x26, 0xe6, 0xdf, 0x1b, 0xfe, 0x9b, 0xe3, 0xfc,
-  0xbd, 0x1c, 0xe9, 0x0c, 0xb4, 0xb2, 0xfa, 0x1a, 0x12, 0xf9, 0x3c, 0xb7,
-  0x33, 0x07, 0xe4, 0xd2, 0x1a, 0xcc, 0x89, 0xc0, 0x84, 0x0b, 0xda, 0xb8,
-  0x12, 0xce, 0x9d, 0xa7, 0xf8, 0x43, 0xfd, 0x5b, 0xfb, 0xfe, 0x05, 0x46,
-  0xf0, 0x1c, 0x2c, 0x17, 0x5c, 0xd8, 0xfc, 0xf6, 0xf4, 0xf5, 0xd7, 0x06,
-  0x16, 0xfb, 0x3d, 0x2e, 0x0f, 0x43, 0xf9, 0x49, 0x9e, 0xac, 0x02, 0x0a,
-  0xd4, 0xec, 0x37, 0xe0, 0xe6, 0x2c, 0xf4, 0xea, 0x22, 0xd5, 0xd4, 0xe3,
-  0x08, 0x38, 0x00, 0x1b, 0xf9, 0x22, 0x08, 0x17, 0xf2, 0x3b, 0xca, 0x2a,
-  0x9f, 0xdb, 0xec, 0xfd, 0xee, 0xf9, 0x57, 0xd3, 0xd0, 0x81, 0xd1, 0xb3,
-  0x0c, 0xfc, 0x9b, 0xee, 0x11, 0xd9, 0xfa, 0xb7, 0x10, 0xdf, 0xff, 0xf4,
-  0xf2, 0x16, 0xfe, 0x6e, 0xee, 0x0a, 0x08, 0x5f, 0xd1, 0xf7, 0xbf, 0xfe,
-  0xd8, 0xff, 0xd4, 0xca, 0xc4, 0xd3, 0x06, 0xf4, 0x25, 0x3e, 0xd0, 0x7f,
-  0x00, 0xff, 0xe1, 0xf8, 0x0e, 0xe6, 0xef, 0x12, 0x47, 0x18, 0xb4, 0xd5,
-  0x2d, 0x1c, 0x01, 0x52, 0x00, 0x18, 0xd1, 0xf3, 0xa0, 0x49, 0xee, 0xf7,
-  0xd3, 0x03, 0x53, 0xb7, 0xe4, 0x14, 0xe0, 0xee, 0xc4, 0x27, 0xeb, 0x29,
-  0xe3, 0x1d, 0x57, 0xeb, 0x9c, 0x15, 0x20, 0xc3, 0x17, 0xf4, 0xf3, 0x30,
-  0x28, 0xfe, 0xb1, 0xdb, 0x0c, 0xeb, 0x56, 0x1d, 0xf5, 0x04, 0xc7, 0x2e,
-  0xf0, 0x05, 0x14, 0x1d, 0x08, 0xe1, 0x0c, 0x00, 0xf9, 0x92, 0xee, 0xe0,
-  0xec, 0xdd, 0x2e, 0x1c, 0xba, 0xe0, 0x18, 0xf4, 0x18, 0xfb, 0xf9, 0x01,
-  0x09, 0xda, 0x4e, 0x34, 0x0b, 0x12, 0x20, 0x15, 0xf9, 0xf7, 0xfe, 0x1c,
-  0x0d, 0xf7, 0x17, 0x09, 0x1a, 0x17, 0x05, 0x0b, 0x81, 0x11, 0xfa, 0xe4,
-  0x5e, 0xb5, 0x09, 0xc7, 0x19, 0xd7, 0xd7, 0x23, 0xc8, 0xe6, 0x1a, 0x1d,
-  0x3d, 0x04, 0x3d, 0x08, 0x1a, 0xfe, 0xb1, 0xef, 0xf8, 0xe8, 0x2e, 0xd3,
-  0x1b, 0xe2, 0xed, 0x10, 0xf1, 0x15, 0x22, 0x2b, 0x21, 0xf1, 0x0c, 0xe0,
-  0x9f, 0x1f, 0xda, 0xea, 0x06, 0xb3, 0xe3, 0xf2, 0x0f, 0xfd, 0xd0, 0x0e,
-  0xe4, 0xcc, 0xbe, 0x08, 0x15, 0x27, 0x1b, 0x1d, 0xf1, 0xdf, 0xf5, 0xe4,
-  0x25, 0x08, 0xce, 0x04, 0xea, 0xc6, 0xf4, 0xf5, 0xd4, 0xec, 0x1f, 0x06,
-  0xf7, 0xfd, 0x1a, 0xf7, 0x02, 0xbe, 0x44, 0x8f, 0x11, 0xa6, 0x42, 0x48,
-  0x55, 0x0f, 0xe8, 0x3d, 0xc8, 0x0b, 0xf3, 0x09, 0xfc, 0xe5, 0xe7, 0xd7,
-  0xde, 0x2f, 0x03, 0xbe, 0xbe, 0xf2, 0x53, 0xe3, 0xcb, 0xfb, 0x81, 0xec,
-  0x2c, 0x38, 0x49, 0x35, 0x22, 0x19, 0xda, 0x21, 0xf4, 0x26, 0x15, 0x99,
-  0x30, 0xeb, 0x19, 0xe1, 0xc5, 0x22, 0xc8, 0x3f, 0x3b, 0xf1, 0x23, 0x17,
-  0x3a, 0xd8, 0xb7, 0xce, 0xf1, 0x09, 0x19, 0xcb, 0x05, 0xed, 0x92, 0xb5,
-  0xe0, 0x12, 0x52, 0x01, 0xbf, 0x9c, 0x33, 0x09, 0xed, 0x13, 0xdf, 0x21,
-  0xcd, 0xdd, 0x2a, 0xcc, 0x0f, 0x08, 0x22, 0x1f, 0xfd, 0x0b, 0xd6, 0x11,
-  0x92, 0xae, 0xec, 0xe6, 0xdf, 0xbb, 0x0c, 0xb7, 0x07, 0xf9, 0xc5, 0xc8,
-  0xf4, 0xef, 0x0a, 0xad, 0x11, 0x35, 0xef, 0x19, 0x0b, 0x15, 0x06, 0xd9,
-  0x11, 0x23, 0x09, 0x81, 0x36, 0xcb, 0x11, 0x06, 0x05, 0x26, 0x3e, 0xb1,
-  0xf0, 0xee, 0xbd, 0xf4, 0xf3, 0x2e, 0x17, 0x2c, 0x22, 0x1c, 0xcc, 0xf7,
-  0xc7, 0xe7, 0x22, 0x0a, 0xd6, 0x2f, 0x16, 0x0a, 0xf8, 0xf3, 0x4d, 0xd4,
-  0xde, 0xaf, 0x2c, 0xee, 0x15, 0x3f, 0xd6, 0x36, 0x18, 0x15, 0x35, 0x2c,
-  0xc4, 0xe4, 0x04, 0xfa, 0x15, 0xc3, 0xb1, 0x2b, 0x15, 0x17, 0xce, 0x15,
-  0xb6, 0xf7, 0x22, 0x03, 0x06, 0xb7, 0x15, 0xfc, 0xfe, 0xc9, 0x09, 0x18,
-  0x2a, 0x23, 0x52, 0xdb, 0x4e, 0x1d, 0x15, 0xfe, 0xc7, 0x0c, 0xd1, 0xff,
-  0x0a, 0xfc, 0x11, 0xc0, 0x29, 0xe5, 0xc9, 0x13, 0xf6, 0x01, 0x10, 0x3a,
-  0x06, 0x1d, 0x2d, 0xe7, 0x17, 0xed, 0xd1, 0x04, 0x12, 0x36, 0x2b, 0xf7,
-  0xfa, 0xc8, 0xe4, 0x04, 0x65, 0x05, 0x02, 0xce, 0xf3, 0x03, 0xff, 0xdd,
-  0x0e, 0xf5, 0x02, 0xfa, 0xed, 0xe8, 0xee, 0x0e, 0xd0, 0x46, 0xd9, 0xf1,
-  0x19, 0x0a, 0xde, 0x09, 0x21, 0x02, 0x0a, 0xe8, 0xf7, 0x07, 0x0b, 0x2f,
-  0x08, 0x29, 0xab, 0xf6, 0xdf, 0x2a, 0x12, 0xff, 0xdd, 0xe7, 0x0f, 0xdc,
-  0xfc, 0xf9, 0x21, 0x0a, 0x0c, 0x0e, 0x37, 0x7f, 0x18, 0x06, 0xf3, 0xfb,
-  0x0a, 0xa6, 0x43, 0xde, 0xe4, 0xc8, 0xe9, 0xd2, 0xcf, 0x2f, 0xdb, 0xd5,
-  0x3f, 0xcc, 0xfa, 0x22, 0x03, 0x10, 0x0e, 0xea, 0x35, 0xf8, 0xf8, 0x1a,
-  0x26, 0xdb, 0x2a, 0xd4, 0xb0, 0xdd, 0xf8, 0xec, 0xd3, 0x08, 0x14, 0xe1,
-  0x14, 0x14, 0x36, 0x27, 0xd4, 0x11, 0xc4, 0x27, 0x15, 0x14, 0x04, 0xed,
-  0x22, 0x4e, 0x12, 0x20, 0x16, 0xff, 0xe7, 0xfe, 0xf4, 0x2f, 0x0a, 0x3f,
-  0xd6, 0xeb, 0xc1, 0xe5, 0xd4, 0xdb, 0xed, 0xc0, 0xda, 0xd0, 0xe0, 0xec,
-  0x06, 0xfa, 0x04, 0xda, 0xd7, 0xef, 0xc7, 0x13, 0x4e, 0xc5, 0xe6, 0x1b,
-  0xf6, 0xf2, 0x01, 0xd3, 0x40, 0xff, 0xf8, 0x38, 0xfa, 0x06, 0x27, 0xef,
-  0x2f, 0x02, 0x20, 0xc2, 0xdd, 0xe4, 0xce, 0x38, 0x4f, 0xfd, 0xd0, 0xef,
-  0x09, 0x15, 0xf1, 0x2e, 0x48, 0xbb, 0xeb, 0x81, 0x3c, 0xff, 0xfd, 0x00,
-  0xfb, 0xd8, 0x2d, 0x07, 0x48, 0xe2, 0x12, 0x1d, 0xda, 0xe6, 0x1f, 0x54,
-  0xf5, 0xf5, 0x1f, 0xf6, 0xe0, 0x1f, 0x36, 0x2f, 0xe6, 0xf6, 0x04, 0x0d,
-  0xe6, 0x03, 0x3d, 0xe3, 0x16, 0x20, 0xf7, 0x9f, 0x00, 0xd3, 0xe8, 0x10,
-  0x5a, 0x09, 0x1e, 0xf7, 0xd5, 0xe9, 0xe5, 0x0c, 0xe2, 0xf1, 0xbf, 0xd6,
-  0xcf, 0xc8, 0xdd, 0x17, 0xd3, 0xfb, 0xce, 0xd4, 0xd2, 0xd7, 0x01, 0xf1,
-  0x21, 0xfc, 0xe0, 0xb5, 0x0a, 0x21, 0x41, 0x31, 0x14, 0xde, 0xf7, 0xdf,
-  0xa6, 0x26, 0xf1, 0x21, 0xda, 0xfb, 0x96, 0xb7, 0x06, 0x34, 0x62, 0xcd,
-  0xd3, 0x02, 0xdc, 0xe9, 0x10, 0x23, 0xff, 0x0b, 0xec, 0xee, 0x4d, 0xca,
-  0x2d, 0xfa, 0xee, 0xa0, 0xdd, 0xb7, 0x1f, 0x14, 0x1a, 0x1c, 0xd4, 0xea,
-  0xe8, 0xe8, 0xfc, 0x28, 0x6e, 0xc0, 0x0c, 0xe5, 0xbc, 0x17, 0x34, 0x07,
-  0x0d, 0x16, 0xc3, 0x8f, 0xe8, 0xc2, 0x69, 0xdf, 0x8a, 0x08, 0x23, 0x30,
-  0x32, 0xdc, 0x2a, 0x0d, 0xd0, 0xdc, 0x47, 0x5d, 0x03, 0x08, 0x33, 0xfa,
-  0xff, 0x7f, 0x24, 0x4e, 0x29, 0xde, 0x10, 0x11, 0xc9, 0x3a, 0xfe, 0xe0,
-  0xeb, 0xfc, 0x32, 0xba, 0xde, 0xfe, 0xce, 0xf7, 0x33, 0x02, 0x64, 0xd1,
-  0xb0, 0xe4, 0xf8, 0x14, 0x0c, 0xe4, 0xf8, 0x37, 0xf8, 0xe6, 0xfd, 0xd3,
-  0x18, 0xcf, 0x1e, 0x18, 0x08, 0x0e, 0xf1, 0xe7, 0x01, 0x4d, 0xb2, 0xe5,
-  0x13, 0xdf, 0xec, 0xbd, 0xc9, 0x51, 0xfd, 0xf3, 0x05, 0x24, 0x3c, 0xfd,
-  0x0c, 0x0a, 0xca, 0x0a, 0x05, 0x03, 0x5c, 0x2f, 0x7f, 0xd4, 0xc7, 0x30,
-  0xea, 0xf2, 0xdb, 0x82, 0x48, 0x30, 0xbe, 0x37, 0x0d, 0x34, 0xfe, 0xa5,
-  0x43, 0x1b, 0x45, 0xfc, 0xf8, 0xe3, 0xf8, 0x14, 0xf8, 0x40, 0xd8, 0xf3,
-  0x16, 0x2c, 0xf5, 0xf9, 0x1c, 0xf5, 0x50, 0xe3, 0xa8, 0x26, 0x0f, 0xf1,
-  0x2a, 0x10, 0x98, 0xcd, 0x32, 0xef, 0xa7, 0xad, 0xee, 0x35, 0x39, 0xea,
-  0x6d, 0x00, 0xe2, 0x03, 0x3a, 0xfe, 0xc6, 0x40, 0xd0, 0x0f, 0xe0, 0xdf,
-  0x1c, 0xea, 0x63, 0xfe, 0x29, 0x42, 0xeb, 0xe1, 0xd2, 0xcf, 0xa5, 0xd4,
-  0xd9, 0xe3, 0x69, 0xcc, 0xf4, 0x28, 0xb7, 0xd0, 0xf2, 0x18, 0x83, 0x18,
-  0x20, 0xde, 0x14, 0xf3, 0xe5, 0x53, 0x38, 0xcc, 0x19, 0xaa, 0x28, 0xfc,
-  0x1a, 0x14, 0x50, 0x34, 0x1d, 0x0c, 0x19, 0x3a, 0x1e, 0xb5, 0x44, 0xbc,
-  0xdc, 0xf9, 0xf2, 0x2e, 0xec, 0x3f, 0x0d, 0x2d, 0xe2, 0x20, 0x10, 0xf5,
-  0xa9, 0x16, 0x23, 0xea, 0xfe, 0x1e, 0xeb, 0x1f, 0x1f, 0x26, 0x04, 0x2d,
-  0xdf, 0xd4, 0xef, 0xe6, 0xc8, 0x03, 0x1f, 0x66, 0x38, 0xc9, 0xab, 0xe6,
-  0x63, 0x3e, 0xf4, 0x31, 0xb9, 0x31, 0xcf, 0x53, 0xf7, 0xde, 0xfa, 0xc9,
-  0xd7, 0x46, 0xd2, 0xe9, 0xdb, 0x1a, 0x3d, 0x19, 0xdd, 0xfb, 0x34, 0x43,
-  0xfd, 0xc2, 0x10, 0x38, 0x0b, 0x2d, 0xdf, 0xf3, 0x1f, 0x29, 0xfb, 0x33,
-  0x0e, 0xe8, 0x07, 0xbe, 0x1d, 0xfb, 0x2d, 0xc9, 0x2f, 0xca, 0xe8, 0xc7,
-  0x03, 0x28, 0x00, 0x91, 0x47, 0xdf, 0x13, 0xd4, 0x36, 0x0c, 0x4a, 0xec,
-  0xc5, 0xf6, 0xfb, 0xd5, 0xd4, 0x48, 0x43, 0x7f, 0x51, 0xca, 0xb7, 0xec,
-  0xcd, 0x4f, 0xfb, 0x18, 0x11, 0x6f, 0xa8, 0x1e, 0x09, 0x03, 0xe9, 0xd9,
-  0xc6, 0xd9, 0x02, 0x31, 0x3d, 0x33, 0x0a, 0x02, 0xf3, 0xf1, 0x50, 0x0a,
-  0xcb, 0xd2, 0xd2, 0xc7, 0xfa, 0xbc, 0x02, 0xff, 0x2e, 0xd2, 0x07, 0xfd,
-  0x34, 0x19, 0xe9, 0x99, 0x4b, 0x05, 0xe6, 0xf4, 0xef, 0x01, 0x36, 0xbc,
-  0xee, 0xf1, 0xdf, 0xdd, 0x1d, 0xfc, 0x1b, 0xc8, 0x41, 0x39, 0x1f, 0x38,
-  0x08, 0xed, 0xec, 0xba, 0xf8, 0x31, 0xed, 0x49, 0xd0, 0xfa, 0xa2, 0xfe,
-  0xf4, 0xc0, 0x20, 0xfe, 0xa6, 0xf9, 0x10, 0x38, 0x12, 0x19, 0xc8, 0xeb,
-  0xe9, 0xf1, 0x28, 0xc7, 0x25, 0xd6, 0xe8, 0x02, 0xf4, 0x26, 0xc7, 0x08,
-  0x2c, 0xd1, 0xff, 0xee, 0x09, 0x1a, 0xd9, 0xac, 0xf7, 0xf0, 0xe1, 0xe9,
-  0xaa, 0x35, 0x0e, 0xfd, 0x1f, 0x2a, 0x3d, 0xe1, 0x0c, 0x1b, 0xe8, 0x29,
-  0xf1, 0x27, 0x04, 0xf5, 0x15, 0xc2, 0x1f, 0xe7, 0x17, 0xd6, 0x07, 0xe5,
-  0xd1, 0x11, 0x01, 0xc6, 0xc4, 0x7f, 0x4e, 0xf5, 0x05, 0x70, 0x14, 0x01,
-  0xd5, 0xc9, 0xde, 0x28, 0xb3, 0xee, 0xd6, 0x48, 0x9c, 0x43, 0x0d, 0xfb,
-  0xee, 0xf0, 0x48, 0xd8, 0x1c, 0x69, 0x18, 0xa9, 0x15, 0x5a, 0x2e, 0x13,
-  0x04, 0x21, 0xf1, 0x08, 0xfc, 0xaa, 0x28, 0x0d, 0xb0, 0x25, 0xc1, 0x00,
-  0x53, 0xef, 0xdc, 0xf3, 0xef, 0x23, 0xd8, 0x0a, 0x01, 0xe3, 0xa1, 0x3a,
-  0xe5, 0xf3, 0x05, 0xac, 0x08, 0x23, 0x37, 0xfd, 0x16, 0x3a, 0x29, 0xe7,
-  0x24, 0xb7, 0x32, 0xc9, 0xfc, 0xf4, 0xd9, 0xbc, 0x7f, 0x1d, 0x9f, 0xca,
-  0xd4, 0x06, 0x39, 0xcc, 0x47, 0x0f, 0x60, 0x94, 0x03, 0xb8, 0x7e, 0xec,
-  0x06, 0x48, 0xe2, 0x14, 0xef, 0x1c, 0x03, 0xd1, 0x03, 0xd7, 0x3f, 0xe4,
-  0x5d, 0xf5, 0x2f, 0xd3, 0xd3, 0xdd, 0xe5, 0x75, 0x9d, 0x00, 0x46, 0x44,
-  0x2a, 0xf0, 0xe4, 0x28, 0x14, 0xf0, 0x20, 0x17, 0x46, 0x1b, 0x01, 0x0e,
-  0xe9, 0xcd, 0x0a, 0x40, 0x19, 0x63, 0xf7, 0x11, 0x17, 0x0f, 0xcc, 0xe4,
-  0xf1, 0xf3, 0x3b, 0x06, 0x0f, 0xe1, 0x1d, 0x0a, 0xfd, 0x09, 0x1e, 0x09,
-  0xf1, 0xdb, 0xd8, 0x38, 0xf6, 0x1c, 0xd4, 0xd6, 0xfe, 0xf9, 0x01, 0xf8,
-  0x25, 0xbd, 0x04, 0xe7, 0x18, 0xf2, 0xbb, 0x22, 0x05, 0xd7, 0xd3, 0x00,
-  0xc5, 0xe3, 0x42, 0x0e, 0x43, 0xfa, 0x1b, 0x19, 0xd5, 0xd8, 0x21, 0x7f,
-  0xdf, 0x1b, 0xfc, 0x02, 0xf9, 0xeb, 0x38, 0x23, 0x18, 0xc8, 0xc9, 0x03,
-  0xd5, 0xc9, 0xe3, 0xf1, 0x06, 0xf6, 0x0d, 0x09, 0x14, 0x22, 0xde, 0x35,
-  0x29, 0x12, 0xed, 0x20, 0xfd, 0xba, 0x06, 0xe2, 0xca, 0xf7, 0xf1, 0xd5,
-  0x41, 0xfb, 0x22, 0x06, 0x20, 0x05, 0xaf, 0xf6, 0xee, 0xed, 0x31, 0x28,
-  0x28, 0x21, 0xd5, 0x1c, 0x08, 0xf2, 0x27, 0xf8, 0xd7, 0xe4, 0x1d, 0x48,
-  0x14, 0xe7, 0x2f, 0xf6, 0xca, 0x08, 0x12, 0xa7, 0xec, 0x32, 0x11, 0x02,
-  0xdf, 0x17, 0x1e, 0x2d, 0x1d, 0x10, 0xd0, 0xe2, 0xc1, 0x23, 0x15, 0xcc,
-  0x1a, 0xe9, 0xcd, 0xf6, 0x4c, 0xd3, 0xf8, 0xd7, 0xd1, 0xd6, 0xe9, 0xf8,
-  0x33, 0xbf, 0xf3, 0xba, 0xea, 0x1d, 0xf8, 0xda, 0xfa, 0xb2, 0xe7, 0xf6,
-  0x19, 0x0e, 0xd1, 0xa1, 0x5f, 0xd3, 0xf5, 0xe5, 0x24, 0xf8, 0x19, 0x39,
-  0x29, 0x01, 0xde, 0x4d, 0xc6, 0x23, 0x55, 0x15, 0x3b, 0xf7, 0xad, 0xfa,
-  0x25, 0xed, 0xfb, 0x00, 0x2f, 0x1d, 0x13, 0xbe, 0xdb, 0xe8, 0x1a, 0x10,
-  0xef, 0xc6, 0xc6, 0x17, 0xfc, 0x32, 0x13, 0x07, 0x05, 0x6c, 0xc5, 0x52,
-  0x81, 0x38, 0xcd, 0x06, 0xec, 0xfe, 0x0c, 0x24, 0x25, 0x0c, 0xdb, 0x3a,
-  0xfb, 0xd2, 0x5b, 0x14, 0x2f, 0xd4, 0xb6, 0x29, 0xba, 0xc2, 0x26, 0x24,
-  0xcd, 0xe5, 0x23, 0x5b, 0x56, 0x2e, 0xe1, 0xf9, 0x1e, 0xd9, 0xc5, 0xd3,
-  0xf4, 0x1c, 0x17, 0xfd, 0x18, 0x03, 0x00, 0x1b, 0xf1, 0x0a, 0xef, 0x0f,
-  0x47, 0x55, 0x0a, 0x07, 0xf1, 0x1f, 0xdd, 0xcf, 0xdf, 0x08, 0x81, 0xb2,
-  0xe8, 0x13, 0xf3, 0x09, 0x0f, 0x1d, 0x0e, 0xf7, 0xfa, 0x1f, 0x9d, 0xf9,
-  0x20, 0xd3, 0xbb, 0xf3, 0xca, 0xe8, 0xf4, 0xb2, 0x08, 0xdd, 0x17, 0x0e,
-  0xe2, 0xf7, 0xf4, 0x30, 0x27, 0x0b, 0x4a, 0xe4, 0xf6, 0xf1, 0x34, 0xda,
-  0x28, 0xef, 0x06, 0xfd, 0xe4, 0x00, 0xe6, 0x2c, 0xf0, 0xec, 0x17, 0x97,
-  0x02, 0xfc, 0xf1, 0x35, 0x03, 0x2b, 0xf3, 0xfb, 0x35, 0xbb, 0x13, 0x00,
-  0x18, 0xfa, 0xf7, 0x47, 0xf8, 0xef, 0x16, 0xed, 0x05, 0x08, 0xfd, 0xf6,
-  0xe7, 0x07, 0xeb, 0xee, 0xb9, 0xec, 0x11, 0x07, 0xf5, 0x46, 0x21, 0x0f,
-  0xe3, 0x12, 0x09, 0x3a, 0xee, 0x07, 0xbb, 0x0b, 0x1a, 0x02, 0xf7, 0xec,
-  0xe1, 0xce, 0xf6, 0x23, 0xed, 0x04, 0xfd, 0x03, 0xc7, 0xf7, 0x01, 0xd2,
-  0x24, 0x0b, 0xf1, 0x3b, 0xd4, 0xff, 0xe1, 0xcc, 0xf0, 0xde, 0x0f, 0xe7,
-  0xb7, 0x2b, 0xc5, 0x0f, 0x89, 0xbd, 0x05, 0xc5, 0xd4, 0xf6, 0xf9, 0xf5,
-  0xec, 0x64, 0x12, 0x96, 0x06, 0x5b, 0x92, 0x28, 0xfa, 0x68, 0x51, 0x6f,
-  0x1e, 0x06, 0xc4, 0x3b, 0x00, 0x18, 0x18, 0x3c, 0x2c, 0xeb, 0x25, 0xcc,
-  0xdb, 0x31, 0x3e, 0x07, 0xf4, 0xe3, 0xa3, 0xd4, 0xda, 0x23, 0xe8, 0x29,
-  0x10, 0xd2, 0xbd, 0xde, 0xf5, 0x5b, 0xe1, 0xde, 0x3e, 0xdc, 0x67, 0x31,
-  0xfb, 0x21, 0x43, 0xf1, 0xe5, 0xf8, 0x82, 0x01, 0xc4, 0xa3, 0xf9, 0xff,
-  0x57, 0xdd, 0xac, 0xf5, 0xac, 0xde, 0x2f, 0xf9, 0x1a, 0x1e, 0x26, 0x09,
-  0xea, 0x0c, 0xc5, 0x36, 0x0e, 0x1d, 0x20, 0x0e, 0x62, 0x25, 0x45, 0xf8,
-  0xff, 0xd1, 0xf0, 0x37, 0xa4, 0xee, 0xf8, 0x0d, 0xbe, 0x1e, 0xb0, 0x2c,
-  0xfb, 0x20, 0x2c, 0xf6, 0x32, 0xd3, 0x22, 0xee, 0xdf, 0xea, 0xf9, 0x04,
-  0x16, 0x7f, 0xea, 0x00, 0x57, 0x7f, 0xab, 0x3d, 0x05, 0x2a, 0x1a, 0x10,
-  0xce, 0x1a, 0xff, 0x02, 0xa6, 0x10, 0x11, 0xef, 0xfd, 0xdc, 0x0f, 0xe4,
-  0x0b, 0xdd, 0x0d, 0x29, 0x1b, 0x71, 0xe4, 0x05, 0xf9, 0x16, 0xe3, 0x19,
-  0xe7, 0x1e, 0xff, 0xb2, 0x5a, 0x0f, 0xff, 0x13, 0x15, 0xc0, 0xe2, 0x18,
-  0xbe, 0xd8, 0xd8, 0x1c, 0x13, 0xf6, 0xc8, 0xf7, 0x15, 0xc3, 0x05, 0x13,
-  0xff, 0x11, 0x25, 0x03, 0xfd, 0x0d, 0x56, 0x14, 0xd8, 0xcb, 0xcb, 0xe7,
-  0x47, 0xf3, 0xd4, 0x08, 0x3f, 0xe7, 0x1a, 0xf2, 0x01, 0xe1, 0xe5, 0x26,
-  0x5c, 0xd8, 0xbd, 0xe5, 0x36, 0x49, 0xf4, 0xee, 0xfc, 0xb9, 0x1c, 0x41,
-  0xea, 0xe5, 0xe2, 0xf4, 0x44, 0x29, 0xfd, 0x07, 0xfe, 0x32, 0xf8, 0xc4,
-  0xee, 0x1d, 0xe9, 0x7f, 0xf2, 0x35, 0xfc, 0x3f, 0xf5, 0x14, 0xbc, 0x23,
-  0x21, 0x2b, 0x28, 0x20, 0xbd, 0xdf, 0xd4, 0x14, 0xfd, 0x59, 0xe7, 0xec,
-  0xf1, 0xf7, 0x90, 0x38, 0x2b, 0x15, 0xd6, 0x5b, 0xfb, 0x34, 0xe5, 0x2f,
-  0x25, 0x85, 0xd9, 0x3c, 0xbe, 0xcd, 0x71, 0x46, 0xf0, 0xaf, 0x44, 0xcc,
-  0xe6, 0x54, 0x53, 0x46, 0x3f, 0x3a, 0xff, 0x35, 0xbe, 0xdf, 0x02, 0xe6,
-  0xc1, 0x36, 0xea, 0xe4, 0x3e, 0xe6, 0xee, 0x6b, 0x4b, 0xe5, 0x36, 0xb5,
-  0x36, 0x2d, 0x81, 0xdd, 0xd6, 0x0f, 0xb2, 0xe6, 0x1b, 0xf2, 0xdf, 0x9b,
-  0xa7, 0xcd, 0x34, 0xfc, 0x0c, 0x38, 0x15, 0x3e, 0x39, 0x13, 0xac, 0x4a,
-  0x9d, 0xc0, 0x78, 0xb7, 0xc7, 0xf7, 0x07, 0xf9, 0xc7, 0xdb, 0x14, 0x2c,
-  0xda, 0x41, 0xd9, 0x16, 0xfd, 0xb2, 0x2e, 0x30, 0x56, 0x0f, 0x5c, 0x92,
-  0x37, 0x49, 0xc5, 0xea, 0xc8, 0x4f, 0x21, 0xd4, 0x19, 0x24, 0xb3, 0x07,
-  0xba, 0x2b, 0x19, 0x3d, 0x3b, 0xdd, 0x99, 0x1d, 0xf2, 0xd1, 0x14, 0xde,
-  0xd8, 0x54, 0x28, 0x16, 0xd9, 0xf7, 0x4a, 0x23, 0x4e, 0xf5, 0x31, 0x0d,
-  0x09, 0xf3, 0xf5, 0x25, 0xc2, 0xdd, 0x27, 0xf3, 0xa0, 0xa8, 0xb2, 0xe6,
-  0xf6, 0x1d, 0xe2, 0x07, 0x13, 0xce, 0xfe, 0x98, 0xb7, 0x42, 0xe2, 0xf6,
-  0x06, 0xd4, 0xf2, 0x08, 0x1a, 0x23, 0xdf, 0x18, 0xf1, 0xf1, 0x23, 0xd0,
-  0x1b, 0x3a, 0x3b, 0xfa, 0x1d, 0x24, 0x35, 0x2a, 0xf8, 0x4b, 0x15, 0x5e,
-  0x09, 0x42, 0xd2, 0xf8, 0x2f, 0x9a, 0xfe, 0x07, 0x42, 0xf6, 0xc6, 0x76,
-  0xdb, 0x9b, 0xfa, 0xfc, 0x2c, 0xb0, 0x47, 0x5b, 0x02, 0xd4, 0x04, 0xc2,
-  0x02, 0x4d, 0xb5, 0x43, 0xba, 0x27, 0xe4, 0x1d, 0xe2, 0x30, 0xd8, 0x28,
-  0xe9, 0x29, 0x0a, 0x48, 0xda, 0x22, 0xc4, 0x06, 0x09, 0xfd, 0x28, 0xfd,
-  0xec, 0xc5, 0x15, 0x51, 0x5f, 0xdf, 0xdb, 0x3b, 0x4d, 0x2c, 0x16, 0x2b,
-  0x03, 0xcf, 0xe5, 0xce, 0x41, 0x05, 0x32, 0x94, 0xe1, 0xca, 0xe7, 0x2b,
-  0xc9, 0x7f, 0xac, 0xc3, 0x27, 0xd8, 0xea, 0xd9, 0xe8, 0x33, 0xf8, 0xca,
-  0xe4, 0xa0, 0x5a, 0xf6, 0x42, 0xdc, 0xfd, 0x10, 0xf1, 0xf2, 0xe0, 0x23,
-  0x29, 0xb9, 0x42, 0xf2, 0xe6, 0x54, 0x4d, 0xe6, 0x1c, 0x51, 0x03, 0xf9,
-  0x41, 0xe0, 0x5e, 0x24, 0xb1, 0x05, 0x2a, 0x09, 0x95, 0x23, 0x23, 0xff,
-  0x3d, 0xea, 0x1e, 0x9d, 0xf4, 0xbd, 0xe6, 0x4d, 0x62, 0x2e, 0x03, 0x17,
-  0x65, 0xd4, 0xe4, 0x21, 0xe3, 0x29, 0x01, 0xea, 0xbe, 0xd2, 0x19, 0x17,
-  0xd0, 0xe4, 0x6d, 0xeb, 0xd4, 0xd6, 0xb1, 0x37, 0x09, 0xf8, 0x13, 0x66,
-  0x38, 0xef, 0xc4, 0xf5, 0xf5, 0x01, 0x07, 0xa8, 0x35, 0xf0, 0x0e, 0xe4,
-  0xcd, 0x5c, 0xf0, 0x24, 0xb8, 0xf1, 0x13, 0x34, 0x55, 0x35, 0x22, 0x81,
-  0x45, 0xf7, 0xc2, 0xcd, 0xbd, 0xc7, 0x3b, 0x0f, 0x32, 0x3e, 0xda, 0x43,
-  0xd0, 0x0b, 0x12, 0x46, 0xff, 0xfe, 0x58, 0xfb, 0xdb, 0xa7, 0xc9, 0xdf,
-  0x5e, 0x2e, 0xb1, 0xfa, 0xc5, 0xc7, 0xea, 0x11, 0x40, 0xff, 0xf3, 0x09,
-  0xe3, 0x42, 0xa5, 0x01, 0xd8, 0xf9, 0x15, 0x39, 0x55, 0xbc, 0xf9, 0x31,
-  0xab, 0xe2, 0x1e, 0xdb, 0x26, 0x0f, 0x22, 0xef, 0xff, 0xb7, 0x18, 0x1c,
-  0xdd, 0x4e, 0x2e, 0xc1, 0xa9, 0x30, 0x0e, 0x11, 0xc9, 0xf5, 0x34, 0x48,
-  0xe4, 0xd2, 0xf7, 0x14, 0x04, 0xf0, 0xdc, 0xcb, 0xdd, 0x19, 0x02, 0xed,
-  0xe8, 0x56, 0xec, 0xbe, 0xb8, 0xd2, 0x8d, 0x0e, 0xca, 0x59, 0xe0, 0xf7,
-  0x0b, 0x13, 0xd7, 0x0e, 0x4d, 0xe3, 0xb1, 0x7f, 0x0a, 0x50, 0x07, 0xfa,
-  0x48, 0xc7, 0xd4, 0x56, 0x19, 0xca, 0xfc, 0x28, 0xce, 0x0b, 0xda, 0xff,
-  0xf0, 0xf9, 0x2a, 0xfb, 0x04, 0x2d, 0x1a, 0xad, 0x40, 0x29, 0x19, 0xbb,
-  0xc0, 0x29, 0x1b, 0xb3, 0x31, 0x20, 0x0b, 0xf7, 0xbb, 0xa2, 0xf0, 0x32,
-  0x11, 0xe8, 0x83, 0x1f, 0x0a, 0x4b, 0x24, 0xf5, 0x21, 0xd7, 0xea, 0xe3,
-  0x29, 0xdd, 0xd4, 0x27, 0x50, 0xfa, 0x05, 0x12, 0x29, 0x18, 0x0b, 0xe0,
-  0xd8, 0xfe, 0xc8, 0x67, 0xa1, 0xe7, 0xee, 0x1a, 0xe7, 0x27, 0x14, 0x30,
-  0xd7, 0xba, 0x19, 0x13, 0x1b, 0x2c, 0x18, 0xb1, 0x2c, 0xfb, 0xfc, 0xe7,
-  0x1f, 0xec, 0xd3, 0xa1, 0x51, 0xfb, 0xdf, 0xed, 0x09, 0x2b, 0xf6, 0x01,
-  0x7f, 0x31, 0xff, 0xe3, 0x58, 0xfa, 0xf1, 0xe9, 0xcb, 0x41, 0x1a, 0xcf,
-  0x2b, 0x13, 0x45, 0xe4, 0x4f, 0x9b, 0xfd, 0xf7, 0xf2, 0xf7, 0xcf, 0xe3,
-  0xd2, 0x04, 0x1a, 0xfa, 0xe0, 0xbf, 0xfb, 0xe5, 0xe3, 0xb8, 0xdd, 0x26,
-  0xf9, 0xcf, 0xbf, 0x2c, 0xfc, 0xed, 0x2b, 0xd9, 0xb9, 0x0a, 0xf6, 0x0c,
-  0xff, 0xbf, 0x42, 0x0c, 0xb5, 0xfb, 0x2c, 0x3f, 0x15, 0x24, 0xc7, 0x1f,
-  0xef, 0xd2, 0xf1, 0x31, 0x2f, 0x09, 0x33, 0xbe, 0x4e, 0xb8, 0xdc, 0x38,
-  0x2d, 0xf1, 0xe4, 0x7c, 0x04, 0xae, 0xf8, 0x4a, 0xfc, 0x0b, 0x41, 0x3f,
-  0xfb, 0x29, 0x19, 0x35, 0x2c, 0x97, 0x9c, 0x06, 0xb3, 0x2a, 0x28, 0xfb,
-  0xf6, 0xe0, 0x2a, 0x0e, 0x14, 0xd5, 0x99, 0x20, 0x9d, 0xb1, 0x39, 0x31,
-  0xff, 0xd3, 0xf4, 0x56, 0x0e, 0xc9, 0xe9, 0xd7, 0x0e, 0x5d, 0xea, 0x07,
-  0xe6, 0x15, 0x2f, 0x33, 0xf4, 0x04, 0xf5, 0xaf, 0xe0, 0xee, 0xd4, 0x07,
-  0xc0, 0x1f, 0xc3, 0x14, 0x35, 0xfa, 0x62, 0x09, 0x49, 0xf0, 0x34, 0xfe,
-  0x03, 0x12, 0xe9, 0x34, 0xc4, 0xf1, 0xe1, 0x48, 0x05, 0x19, 0xb4, 0x24,
-  0xfc, 0xd2, 0x7f, 0x38, 0x38, 0x16, 0x19, 0x25, 0xdd, 0xa3, 0xfd, 0x3e,
-  0xae, 0xe7, 0x20, 0xfd, 0x0f, 0x01, 0x07, 0xfd, 0x2a, 0xc7, 0x47, 0x29,
-  0xf2, 0x25, 0x50, 0x17, 0x21, 0x2c, 0x25, 0x09, 0xe6, 0xce, 0x5c, 0x3f,
-  0x3d, 0xbd, 0x1d, 0x0b, 0x06, 0x3f, 0xa4, 0xcf, 0xdd, 0x07, 0x07, 0xca,
-  0xb2, 0x2e, 0xd7, 0x1e, 0x09, 0xdf, 0xd5, 0xf8, 0x0b, 0xf7, 0x21, 0x31,
-  0x3f, 0x28, 0x01, 0x33, 0x3c, 0xcc, 0x0e, 0x21, 0x1d, 0xed, 0x24, 0x4e,
-  0xd9, 0xf7, 0x36, 0x0f, 0x1b, 0x37, 0x81, 0x2d, 0xf2, 0x47, 0xdb, 0xb2,
-  0x4a, 0xec, 0x11, 0x03, 0xc4, 0x93, 0xc2, 0xd7, 0xf8, 0x67, 0xec, 0xdd,
-  0x08, 0x17, 0x0e, 0xdc, 0x08, 0x65, 0x32, 0x14, 0xec, 0x28, 0x12, 0xbe,
-  0xec, 0x14, 0xf5, 0xcf, 0xcd, 0xfe, 0x02, 0x59, 0x08, 0x38, 0xdc, 0x2b,
-  0xed, 0x24, 0xeb, 0x04, 0x07, 0x19, 0x21, 0xac, 0x07, 0x25, 0xf7, 0x2a,
-  0xe0, 0xd0, 0x3d, 0x34, 0x10, 0x0d, 0x17, 0x06, 0xe7, 0x24, 0x1b, 0x22,
-  0xe9, 0xfa, 0xff, 0xde, 0x30, 0xbf, 0xf0, 0x71, 0xa5, 0xf5, 0x03, 0x26,
-  0xdc, 0x0f, 0xc5, 0xef, 0xe3, 0x28, 0x25, 0x50, 0x39, 0x00, 0xe9, 0x3f,
-  0x52, 0xb3, 0xde, 0xf6, 0x17, 0x11, 0xd4, 0xfb, 0x1b, 0x20, 0xdd, 0x3b,
-  0xcb, 0xe5, 0xfa, 0x22, 0xe2, 0x59, 0x2c, 0xf2, 0x0f, 0xee, 0x3c, 0x81,
-  0x0c, 0xe3, 0x20, 0xd9, 0x1b, 0xcf, 0xfb, 0x1e, 0xde, 0xd9, 0xcf, 0xe6,
-  0xd3, 0xe8, 0xe3, 0x9e, 0xfa, 0x04, 0x1f, 0x2a, 0xe3, 0xeb, 0xd1, 0xbe,
-  0xb4, 0xb2, 0xe1, 0x6b, 0xb6, 0xfe, 0xec, 0xc9, 0x1a, 0xd2, 0x9f, 0xb7,
-  0xd0, 0xf2, 0x6d, 0x07, 0xbc, 0xc6, 0x0c, 0xd3, 0x04, 0x11, 0x1e, 0x0c,
-  0xda, 0x06, 0x50, 0xe4, 0xbe, 0x06, 0x2b, 0x2a, 0x0d, 0xcd, 0xe8, 0x0c,
-  0x10, 0x29, 0xfa, 0xc9, 0xea, 0x42, 0x18, 0xc3, 0xff, 0xcd, 0x18, 0xbc,
-  0xf0, 0x16, 0xee, 0xb6, 0x18, 0xba, 0x4a, 0xfa, 0xdb, 0xb3, 0xc1, 0xea,
-  0x37, 0xfb, 0xff, 0xf5, 0x35, 0xda, 0xf9, 0x17, 0x27, 0x3c, 0xc9, 0x96,
-  0xe0, 0x05, 0xfb, 0xc8, 0x19, 0x1c, 0x24, 0xae, 0x06, 0xec, 0xe2, 0xd8,
-  0xb8, 0xff, 0xec, 0xe5, 0xef, 0x25, 0x1b, 0x23, 0x2c, 0xe9, 0x08, 0xf1,
-  0xba, 0xf6, 0x3b, 0xf8, 0x0b, 0x0b, 0x1f, 0xb3, 0x21, 0x34, 0xf6, 0xf2,
-  0xe0, 0x2c, 0x0e, 0x6d, 0x1a, 0xe9, 0x39, 0x67, 0xc9, 0xd7, 0xd8, 0xf3,
-  0xed, 0xeb, 0xf4, 0xdd, 0x7a, 0xab, 0xed, 0xd3, 0x10, 0xff, 0xee, 0xf0,
-  0xfe, 0x17, 0xd1, 0xce, 0xf0, 0xc9, 0xe5, 0xb2, 0xf5, 0xdf, 0x0c, 0x32,
-  0x00, 0xf8, 0x0c, 0xdd, 0x05, 0xef, 0x28, 0xf2, 0x09, 0xcc, 0x1c, 0x23,
-  0x0a, 0xd7, 0xfa, 0xeb, 0x27, 0x29, 0x42, 0x14, 0x16, 0x3f, 0xf6, 0xec,
-  0xea, 0x36, 0x7f, 0xca, 0x23, 0x13, 0xe4, 0x3a, 0xe6, 0xe7, 0x05, 0x5a,
-  0x31, 0xca, 0x51, 0x21, 0x32, 0x24, 0xea, 0xcc, 0xd9, 0x1b, 0xfd, 0x23,
-  0xbb, 0xde, 0xe2, 0x2a, 0x21, 0x04, 0x09, 0xdc, 0xfe, 0x49, 0xcf, 0xd9,
-  0x2d, 0xde, 0xf3, 0xc4, 0xe9, 0xe1, 0x99, 0x30, 0x07, 0x37, 0xfe, 0x58,
-  0x15, 0x2c, 0x35, 0x09, 0xe3, 0xf7, 0x31, 0x22, 0xd0, 0x11, 0x3b, 0xc0,
-  0x96, 0x08, 0xfa, 0xdc, 0xb6, 0x7a, 0xdc, 0xcc, 0x25, 0x28, 0xf5, 0xd2,
-  0x13, 0xdd, 0xd7, 0xf4, 0xf7, 0xbe, 0x20, 0xb9, 0x14, 0x18, 0x0a, 0x0e,
-  0xc7, 0xfd, 0x32, 0x0a, 0x57, 0x40, 0x60, 0xfd, 0xb3, 0xb5, 0xea, 0x4c,
-  0x7c, 0xc0, 0xfd, 0x0d, 0xd7, 0xe9, 0x10, 0xfc, 0xe7, 0xe1, 0xcc, 0xe8,
-  0x05, 0xd0, 0x07, 0x7f, 0xbf, 0x00, 0x0f, 0x07, 0x08, 0xb1, 0x4e, 0xf8,
-  0xc4, 0xe0, 0xf7, 0xda, 0x2a, 0xdf, 0xe5, 0x1b, 0xf1, 0x06, 0x0f, 0xae,
-  0xe4, 0xfd, 0x02, 0xcc, 0x3d, 0xfe, 0x07, 0xc2, 0x18, 0xfe, 0xea, 0xe0,
-  0xff, 0xc9, 0x3f, 0x02, 0x2a, 0xe0, 0xdc, 0x00, 0x2b, 0xdc, 0xcf, 0x33,
-  0xec, 0xeb, 0x08, 0xfb, 0x02, 0x02, 0x1d, 0xcb, 0xd5, 0x16, 0x6b, 0x06,
-  0xb6, 0x22, 0xf9, 0x31, 0xbb, 0x05, 0x13, 0xf5, 0xf9, 0xe9, 0xac, 0x0f,
-  0xff, 0xf8, 0x02, 0xa0, 0x5a, 0x23, 0xc6, 0x40, 0x1d, 0x4a, 0xf9, 0x0d,
-  0x16, 0xe2, 0xb6, 0xfe, 0xde, 0xf9, 0xe6, 0x43, 0x89, 0x0f, 0x32, 0x09,
-  0xf2, 0x14, 0xb2, 0x18, 0xe6, 0x5c, 0x5a, 0xe8, 0x1d, 0x48, 0xe3, 0xf4,
-  0x8c, 0xd5, 0x94, 0xfb, 0x3a, 0x6d, 0xf6, 0xdf, 0x05, 0xf9, 0x26, 0xcc,
-  0x40, 0x1b, 0x09, 0xcc, 0xc1, 0x20, 0xe3, 0xaa, 0x88, 0x4a, 0x50, 0xed,
-  0x12, 0xe7, 0x05, 0x40, 0x0f, 0x09, 0xc5, 0xdf, 0x25, 0xf3, 0x20, 0x04,
-  0x27, 0xb7, 0xf4, 0xf9, 0xd1, 0x0b, 0x19, 0xe5, 0xea, 0xaf, 0x21, 0x09,
-  0x47, 0x2c, 0x09, 0x03, 0xb7, 0x28, 0x2e, 0x60, 0xb0, 0x39, 0x1e, 0xbd,
-  0xad, 0xe4, 0xaa, 0xcc, 0x9c, 0x11, 0x5c, 0x2d, 0xd5, 0x29, 0xcf, 0x1a,
-  0xca, 0xd0, 0x00, 0x08, 0xed, 0x36, 0xac, 0x01, 0x7f, 0x8b, 0x1a, 0xde,
-  0x0a, 0xf2, 0xe7, 0x18, 0xdf, 0x13, 0xa1, 0xe1, 0xf3, 0xc6, 0xc3, 0xf9,
-  0x23, 0x06, 0x19, 0x28, 0x31, 0x32, 0xea, 0x2b, 0x02, 0x93, 0xda, 0x34,
-  0x23, 0xe6, 0x19, 0xd1, 0xc4, 0xde, 0xd6, 0xdb, 0x25, 0xef, 0x1f, 0x0f,
-  0xf5, 0x2a, 0x03, 0xf4, 0x19, 0x1f, 0xb8, 0xec, 0xca, 0x0b, 0xf5, 0x09,
-  0xec, 0x01, 0xda, 0xdc, 0xe7, 0x09, 0xe8, 0x25, 0x47, 0xf7, 0x35, 0xf4,
-  0x3f, 0x10, 0x1e, 0x18, 0x1e, 0xfc, 0xe8, 0x2a, 0xf3, 0x1e, 0xeb, 0xc9,
-  0xdf, 0xf0, 0x2f, 0xbf, 0x0a, 0x0b, 0xb6, 0xc6, 0x46, 0x26, 0x0b, 0x35,
-  0xef, 0xad, 0x02, 0xfa, 0x9b, 0xd5, 0xe0, 0xad, 0x9d, 0x23, 0x46, 0xfd,
-  0x7f, 0x0a, 0xe4, 0xec, 0xe5, 0xf6, 0x05, 0x32, 0x40, 0xf0, 0xfc, 0xf3,
-  0xb6, 0xe5, 0xe8, 0xdb, 0xdd, 0x2c, 0xe3, 0xc0, 0xee, 0xe7, 0x4c, 0x00,
-  0xf2, 0x01, 0xde, 0x0f, 0xd5, 0x10, 0x5b, 0x2a, 0xeb, 0xea, 0x5c, 0xa5,
-  0x4e, 0x22, 0x0b, 0x32, 0xe7, 0xf2, 0xfb, 0xe5, 0xec, 0xca, 0xef, 0x06,
-  0x01, 0xab, 0xe6, 0x2b, 0xca, 0x09, 0xbe, 0x09, 0x12, 0x25, 0xd5, 0xac,
-  0xfa, 0xf0, 0xdd, 0xe1, 0xdf, 0xd7, 0x16, 0x05, 0xf3, 0x05, 0x19, 0x03,
-  0x08, 0xe3, 0x27, 0xc4, 0xf3, 0xf6, 0xd0, 0xd2, 0xe3, 0xe2, 0x15, 0x0c,
-  0x10, 0x33, 0xf1, 0x20, 0x38, 0x04, 0x18, 0xf7, 0x09, 0x00, 0xcc, 0x06,
-  0x15, 0x77, 0x3b, 0x21, 0x13, 0x28, 0x0f, 0xe7, 0x29, 0xf5, 0x08, 0x0b,
-  0x18, 0xf2, 0xe3, 0x24, 0xf4, 0x14, 0xb8, 0x27, 0xe5, 0x04, 0x26, 0x2c,
-  0xe7, 0x16, 0x22, 0x00, 0xe8, 0xd4, 0xbb, 0x17, 0x81, 0x10, 0x30, 0x18,
-  0xfa, 0xc0, 0xf1, 0xfd, 0x26, 0xc9, 0x12, 0x09, 0xeb, 0xe7, 0x2e, 0x2d,
-  0x01, 0xbe, 0xe6, 0xe8, 0xc2, 0x0e, 0xc1, 0xef, 0xf8, 0x05, 0x07, 0xed,
-  0x35, 0xff, 0xb8, 0xf1, 0xe4, 0xc4, 0x18, 0x22, 0x40, 0x48, 0x17, 0xbf,
-  0xe2, 0xdf, 0x32, 0xf0, 0x16, 0xfc, 0x0e, 0x55, 0xd6, 0xd3, 0xc9, 0xf8,
-  0x1e, 0x01, 0xd8, 0x1e, 0x3a, 0xef, 0x5c, 0xf6, 0xe7, 0xe6, 0xd1, 0x1e,
-  0x8f, 0xe9, 0x2a, 0x03, 0x1c, 0xd9, 0xc4, 0xfa, 0x41, 0x78, 0x17, 0x1a,
-  0x31, 0x2e, 0xbf, 0x47, 0x17, 0xff, 0x92, 0x1f, 0x42, 0xf3, 0x01, 0xdc,
-  0x2e, 0xfe, 0xd5, 0xb0, 0xf4, 0xb4, 0x07, 0x1e, 0x3a, 0xf9, 0x19, 0x34,
-  0x40, 0xde, 0xc9, 0xda, 0x08, 0x31, 0x10, 0x2f, 0xdb, 0xf6, 0xea, 0xfa,
-  0x36, 0x1a, 0x21, 0x1e, 0x54, 0xf3, 0x0d, 0x45, 0xeb, 0x58, 0x4a, 0x72,
-  0xe6, 0x50, 0xc2, 0xd1, 0xec, 0xa4, 0xfb, 0x3b, 0xdb, 0xf1, 0x87, 0x1a,
-  0x81, 0x27, 0x56, 0xea, 0xe8, 0xd9, 0xfc, 0x1b, 0x1d, 0x42, 0xbd, 0xc7,
-  0x6f, 0xac, 0xd3, 0xde, 0x04, 0xee, 0xf4, 0x2d, 0x9b, 0xd5, 0xfe, 0x14,
-  0xcd, 0x2c, 0x14, 0xc5, 0x22, 0x23, 0x9d, 0xc3, 0x1b, 0x3d, 0x17, 0x0d,
-  0x19, 0x2d, 0xd8, 0x11, 0x2b, 0x17, 0xa5, 0x24, 0x0d, 0xdb, 0xe2, 0x0d,
-  0x11, 0xc5, 0xd4, 0x29, 0x54, 0x20, 0x50, 0xd4, 0xbf, 0x36, 0x17, 0x4b,
-  0x13, 0x4a, 0x0c, 0xf3, 0xeb, 0xfc, 0xef, 0xd8, 0xc4, 0xbc, 0x5c, 0xfe,
-  0x35, 0x7f, 0xe4, 0x04, 0xdd, 0x3d, 0xfa, 0x14, 0x14, 0xf2, 0x9c, 0x3d,
-  0xf6, 0xf5, 0x1d, 0xde, 0xf8, 0x3d, 0xee, 0xe3, 0xbd, 0x41, 0x2e, 0x0f,
-  0xbd, 0x35, 0xcb, 0xa3, 0x35, 0x10, 0xea, 0xc4, 0x00, 0x09, 0x0d, 0x07,
-  0x23, 0x4a, 0xe1, 0xc6, 0x2b, 0xcd, 0xd1, 0x36, 0x2c, 0xe0, 0xf0, 0xff,
-  0xfe, 0xe0, 0x19, 0xfd, 0xef, 0xfe, 0x20, 0xf9, 0xf7, 0xf5, 0xd8, 0x23,
-  0xbd, 0x37, 0xef, 0x0c, 0xf6, 0xf6, 0xba, 0x22, 0xb6, 0x15, 0x15, 0x14,
-  0x1c, 0xce, 0x0d, 0xd1, 0x3b, 0x44, 0xe1, 0x46, 0x6c, 0xfa, 0x07, 0x04,
-  0xbf, 0xff, 0x0b, 0x03, 0xf3, 0xf4, 0x98, 0xb4, 0xc7, 0xdf, 0xdb, 0xe6,
-  0xdb, 0xad, 0x1f, 0xa4, 0xcf, 0xf8, 0xd6, 0xe7, 0xc9, 0x0e, 0xf7, 0xb4,
-  0xbd, 0x7e, 0xd8, 0x28, 0xf0, 0x3f, 0x1e, 0xeb, 0x0b, 0xf2, 0x1f, 0xc9,
-  0xfb, 0xff, 0x4b, 0xd3, 0xd5, 0x38, 0x10, 0x13, 0x45, 0x1a, 0x18, 0xd9,
-  0xc3, 0x05, 0x1b, 0x45, 0xe6, 0x08, 0x33, 0xd0, 0x03, 0x81, 0xd6, 0xfc,
-  0xbf, 0x2e, 0xf3, 0x1e, 0x0e, 0x1e, 0x28, 0x01, 0x2a, 0x01, 0x24, 0x31,
-  0x27, 0xd4, 0x21, 0xee, 0x35, 0x79, 0x00, 0x09, 0xeb, 0x19, 0xe5, 0xee,
-  0x26, 0xde, 0xc5, 0x1e, 0x18, 0xf2, 0x09, 0x38, 0x03, 0x1e, 0x23, 0x19,
-  0xdc, 0xdb, 0xfa, 0xf3, 0x34, 0xb3, 0xe9, 0x48, 0xf4, 0x34, 0xe8, 0x1e,
-  0x59, 0x75, 0x09, 0xe5, 0x14, 0xe0, 0xe7, 0x18, 0x5e, 0x10, 0x04, 0xe7,
-  0xff, 0x22, 0xac, 0x14, 0xc3, 0x15, 0x11, 0xc0, 0x29, 0x53, 0x3f, 0xa8,
-  0x25, 0x69, 0x33, 0xff, 0x16, 0xca, 0xdd, 0xcb, 0x00, 0xb8, 0xf1, 0x3d,
-  0xb6, 0xf7, 0xc5, 0xcd, 0x3c, 0xc2, 0xb4, 0x18, 0x15, 0xcb, 0xfd, 0xf3,
-  0x81, 0xf5, 0xfe, 0xe0, 0x4f, 0xe5, 0x1f, 0x41, 0x1b, 0x45, 0xfd, 0x0c,
-  0xcb, 0x45, 0x27, 0x0f, 0xd1, 0x24, 0x45, 0x09, 0xd2, 0x58, 0xb5, 0x09,
-  0x3d, 0xcf, 0xc2, 0x33, 0x05, 0x0c, 0xf0, 0x2b, 0x5d, 0x46, 0xf6, 0x1f,
-  0x16, 0x0b, 0x2a, 0x07, 0xc1, 0x01, 0x1b, 0x11, 0xbd, 0xf5, 0xe6, 0x31,
-  0xbf, 0xde, 0x35, 0x0c, 0xdd, 0x02, 0xdf, 0xd7, 0x2b, 0xfe, 0xff, 0x37,
-  0x05, 0xf9, 0xbb, 0xcc, 0xb6, 0x02, 0x10, 0xd8, 0x02, 0x87, 0xf1, 0x21,
-  0x19, 0x12, 0xcb, 0xb9, 0x58, 0x22, 0xce, 0x49, 0xfb, 0xdb, 0xf2, 0x03,
-  0x0b, 0x01, 0x17, 0x2d, 0x00, 0xb3, 0xe0, 0x08, 0x15, 0xbf, 0x14, 0x44,
-  0x46, 0xea, 0x3b, 0xe7, 0x46, 0xfc, 0xda, 0xd7, 0x45, 0xce, 0x3f, 0xfc,
-  0x32, 0xeb, 0xc8, 0xfe, 0xe8, 0x0b, 0xcf, 0x33, 0xfb, 0x05, 0xb9, 0xfd,
-  0xe5, 0xef, 0xbc, 0x25, 0x37, 0xcf, 0xff, 0xdf, 0xa9, 0xf5, 0x01, 0xf4,
-  0x44, 0xf5, 0xcb, 0x38, 0xd0, 0xeb, 0x11, 0x36, 0xfc, 0xe1, 0x10, 0xec,
-  0xe2, 0xf8, 0x1d, 0xfb, 0xfe, 0x3f, 0xe2, 0x22, 0xfc, 0xc6, 0xc9, 0x48,
-  0xb1, 0xf5, 0x3c, 0xee, 0xf1, 0x25, 0x0d, 0x62, 0xf2, 0xef, 0x1b, 0x03,
-  0xfb, 0xbf, 0x10, 0xec, 0x23, 0xd4, 0x0c, 0x16, 0xee, 0xe0, 0x14, 0xeb,
-  0xfa, 0xe7, 0x05, 0x02, 0xd9, 0xff, 0x01, 0x1a, 0xc6, 0xd8, 0xf1, 0xcb,
-  0x2d, 0x1a, 0x28, 0xf9, 0xe4, 0xed, 0xfd, 0x56, 0x0b, 0x05, 0x81, 0xea,
-  0x1c, 0x19, 0x1c, 0xef, 0x03, 0xcc, 0xf1, 0xf2, 0x2d, 0x44, 0x11, 0x47,
-  0xd8, 0x38, 0xbb, 0x20, 0xea, 0x09, 0x5e, 0xe4, 0x1c, 0x02, 0xcd, 0x1c,
-  0xfc, 0xc3, 0xca, 0xe0, 0xe3, 0xb8, 0x22, 0xe0, 0x2e, 0xec, 0xe7, 0xf2,
-  0x0c, 0xfd, 0xec, 0x35, 0xe5, 0xd5, 0xca, 0x18, 0x2b, 0xba, 0x1f, 0xaf,
-  0xf8, 0xd5, 0xee, 0x58, 0xe0, 0x23, 0xb4, 0x38, 0x64, 0xc7, 0x0b, 0xf3,
-  0xc8, 0x27, 0xdf, 0xd7, 0xf9, 0x35, 0xe2, 0x03, 0x36, 0x21, 0x12, 0xb1,
-  0xc9, 0x31, 0xf1, 0x24, 0x00, 0xf8, 0xea, 0xc3, 0xeb, 0xf6, 0xb8, 0x1a,
-  0x19, 0x1a, 0x5a, 0x31, 0x0c, 0x28, 0xdc, 0x15, 0xcc, 0xf8, 0x19, 0xf6,
-  0xc0, 0xea, 0x06, 0xe4, 0x00, 0xc0, 0xc1, 0xe3, 0xf1, 0xd7, 0xdd, 0xdf,
-  0x5a, 0x1e, 0xce, 0xf3, 0x71, 0x22, 0xde, 0xf6, 0x72, 0xb1, 0x34, 0xdf,
-  0xe2, 0xec, 0x0f, 0x40, 0xce, 0xba, 0x1c, 0xb2, 0x0c, 0x08, 0xdc, 0xe3,
-  0xcf, 0x20, 0x14, 0x17, 0x7f, 0xed, 0xdb, 0x01, 0x44, 0xcc, 0xd5, 0x59,
-  0xff, 0x1c, 0xef, 0xd6, 0x54, 0x43, 0xf7, 0xc3, 0xfd, 0xf6, 0xc9, 0xf4,
-  0xfa, 0xf9, 0xe0, 0x2c, 0xc9, 0x11, 0x0f, 0xd6, 0xf1, 0x15, 0xf0, 0xe3,
-  0xe3, 0xde, 0x0b, 0x40, 0x14, 0xe5, 0xee, 0xcf, 0x3f, 0xdf, 0x37, 0x58,
-  0xfb, 0x7f, 0xa2, 0x32, 0x01, 0xb7, 0x1f, 0x0f, 0xf3, 0xff, 0x02, 0xd7,
-  0xf6, 0x37, 0xf0, 0xf5, 0x1d, 0x25, 0x36, 0xc3, 0xe5, 0x07, 0xe0, 0x3b,
-  0x1d, 0x2e, 0x05, 0xf3, 0xcc, 0xdc, 0xda, 0xfd, 0xf9, 0x34, 0x43, 0x3e,
-  0xec, 0xe4, 0x29, 0xfa, 0xdc, 0xc0, 0xed, 0x1f, 0x0d, 0xb3, 0xde, 0xcd,
-  0x0e, 0x2f, 0xfd, 0x3f, 0xfa, 0xde, 0xf6, 0xea, 0x1a, 0x3f, 0x16, 0xed,
-  0x07, 0xe2, 0xfc, 0x05, 0x26, 0xf9, 0x40, 0x09, 0xfe, 0x30, 0x04, 0x26,
-  0x12, 0x19, 0x20, 0xfd, 0x11, 0x0c, 0x00, 0xcc, 0xf6, 0xf9, 0xfc, 0x28,
-  0x50, 0x27, 0xd6, 0xcf, 0xf9, 0xf5, 0x11, 0xc1, 0x09, 0x2b, 0xe5, 0xd3,
-  0x0c, 0x1c, 0xfe, 0xfc, 0xef, 0xc4, 0xf2, 0x3f, 0xf8, 0x35, 0xd5, 0xb2,
-  0xdb, 0x3f, 0x13, 0xbb, 0xf2, 0xe0, 0x12, 0xfb, 0x15, 0xbd, 0x34, 0xca,
-  0x0b, 0x16, 0x25, 0xd4, 0x06, 0x0e, 0xda, 0x25, 0xe2, 0x34, 0xdf, 0x18,
-  0x23, 0x13, 0x52, 0xb5, 0x2b, 0x0f, 0x18, 0x16, 0xe5, 0xc5, 0x14, 0x10,
-  0x40, 0x57, 0x34, 0xca, 0x97, 0x0f, 0x16, 0x19, 0xea, 0xf5, 0x25, 0xed,
-  0xe9, 0xf3, 0xbc, 0x44, 0xeb, 0x17, 0xc5, 0xb7, 0x30, 0xdb, 0xbf, 0x10,
-  0x1d, 0x05, 0x08, 0xf1, 0xcd, 0xf1, 0xf9, 0xf6, 0xf2, 0xbf, 0x4d, 0xdc,
-  0xc0, 0x14, 0x1b, 0xc6, 0x24, 0xff, 0x16, 0xff, 0x38, 0xfe, 0x13, 0x04,
-  0x03, 0xaa, 0xdf, 0x45, 0x35, 0xe8, 0x7f, 0xe5, 0x01, 0xff, 0xdb, 0xfe,
-  0xe8, 0xda, 0xcb, 0xe4, 0x08, 0xd5, 0x1a, 0x02, 0xf3, 0x1a, 0x04, 0x1c,
-  0xf9, 0xbf, 0xdd, 0xe8, 0x1a, 0xec, 0xc7, 0x14, 0x36, 0x15, 0xc7, 0xde,
-  0xd4, 0x27, 0x5c, 0x03, 0x4d, 0xf3, 0xd0, 0xac, 0xce, 0xf4, 0xa7, 0xf2,
-  0x0d, 0x01, 0xfb, 0x11, 0xe8, 0x29, 0x01, 0xfa, 0x16, 0x28, 0xf2, 0xdf,
-  0x28, 0xb7, 0xd5, 0x0b, 0x10, 0x2d, 0x09, 0xf8, 0x42, 0xbf, 0x24, 0xb8,
-  0xc8, 0x8a, 0x1c, 0x4c, 0x29, 0xf0, 0x29, 0xef, 0xe9, 0xe7, 0x20, 0xf2,
-  0x6a, 0x28, 0x01, 0xf7, 0x2f, 0x14, 0xf7, 0x07, 0x57, 0x09, 0xfb, 0x9c,
-  0x18, 0xfb, 0x1e, 0xef, 0x81, 0x07, 0x25, 0xed, 0x53, 0xea, 0x24, 0xd3,
-  0x09, 0xf1, 0xe8, 0x41, 0x1a, 0x0b, 0x30, 0x3d, 0x40, 0xf3, 0xe8, 0xfb,
-  0xfd, 0x47, 0xda, 0xd7, 0xff, 0xb4, 0x04, 0x06, 0xfb, 0x18, 0x0f, 0xf2,
-  0xd0, 0x2f, 0xd4, 0x23, 0xf2, 0x32, 0x0b, 0xe9, 0xdb, 0x0e, 0x0e, 0xbd,
-  0xeb, 0x02, 0xfb, 0xf1, 0xf2, 0x01, 0x0e, 0x08, 0xf0, 0x27, 0xe2, 0xfa,
-  0x22, 0xe1, 0xe2, 0x09, 0xbe, 0x0c, 0xf2, 0xdc, 0x3e, 0xdb, 0x0e, 0xad,
-  0x11, 0xfa, 0x3b, 0xd8, 0xc9, 0xc0, 0xef, 0xcb, 0xd6, 0xe5, 0xf3, 0x04,
-  0xcc, 0xee, 0xd8, 0x39, 0x25, 0x20, 0xf6, 0xa5, 0xc9, 0x73, 0x10, 0x0d,
-  0xeb, 0xf3, 0xf1, 0x53, 0x38, 0xe9, 0x5f, 0xa2, 0x46, 0x14, 0x51, 0xfc,
-  0xef, 0x10, 0x0f, 0xd8, 0xcd, 0x17, 0x02, 0x9e, 0xfa, 0x0f, 0x15, 0x46,
-  0x3d, 0x00, 0x20, 0x41, 0x0f, 0x1b, 0x2f, 0x28, 0x41, 0x14, 0x2e, 0x1c,
-  0x37, 0x0b, 0xfb, 0xc8, 0xee, 0xd0, 0x6d, 0x0a, 0xf4, 0x0c, 0xd5, 0xe8,
-  0xfa, 0x50, 0x05, 0x2e, 0x3c, 0xdc, 0xb1, 0x35, 0x81, 0x2b, 0xe1, 0x9a,
-  0xcd, 0xaf, 0x17, 0xf9, 0xc0, 0x04, 0x4e, 0xfd, 0x07, 0xc1, 0xc6, 0x5e,
-  0xfd, 0x10, 0xc4, 0x0e, 0xc9, 0xbd, 0xb8, 0xfe, 0xde, 0x1b, 0x03, 0x1c,
-  0xfb, 0x28, 0x0a, 0x0c, 0x0f, 0x0d, 0x06, 0x0c, 0x35, 0xf6, 0x3e, 0x6d,
-  0x3e, 0x11, 0xef, 0x2e, 0xdb, 0xdd, 0xde, 0x51, 0x04, 0x0d, 0xdc, 0xf4,
-  0xb6, 0xfe, 0x34, 0x22, 0xd1, 0xfe, 0x24, 0xe5, 0x1a, 0xbc, 0x06, 0x09,
-  0x04, 0x19, 0xc8, 0xe7, 0x09, 0xe2, 0x0a, 0xea, 0x15, 0x18, 0xf2, 0x15,
-  0xe2, 0x28, 0xe5, 0xc6, 0x5d, 0xde, 0xd0, 0xe3, 0x2b, 0x17, 0x94, 0x31,
-  0xf1, 0x2f, 0xe0, 0xde, 0xc8, 0xcd, 0x32, 0xf5, 0x0e, 0xde, 0xfb, 0x18,
-  0x24, 0x27, 0x0d, 0xf9, 0x0f, 0xd6, 0xdf, 0xe8, 0xb4, 0xde, 0x19, 0xb9,
-  0x00, 0x00, 0x39, 0xfd, 0x14, 0xe8, 0xd3, 0xfd, 0xd2, 0xc2, 0xff, 0x60,
-  0xe1, 0xf6, 0x39, 0xd7, 0x05, 0x14, 0x81, 0x1f, 0x01, 0x1d, 0xb6, 0x4c,
-  0xe5, 0xd7, 0xcf, 0xf3, 0x0d, 0xfe, 0xdf, 0xf7, 0xf9, 0xda, 0xdc, 0xea,
-  0xde, 0xf5, 0xbf, 0x24, 0x26, 0xb3, 0xfe, 0x1f, 0x5c, 0x0f, 0x0d, 0xcd,
-  0x23, 0xd5, 0x03, 0xed, 0x26, 0xfc, 0x26, 0xe3, 0xe7, 0x28, 0xec, 0xdc,
-  0x3a, 0xd8, 0xbd, 0xd0, 0x14, 0xfc, 0x95, 0xb5, 0x25, 0x0f, 0xef, 0x4a,
-  0x71, 0x2a, 0x0f, 0x34, 0x0e, 0x29, 0x04, 0xdf, 0xa3, 0xfa, 0x58, 0xf0,
-  0x01, 0x0b, 0x64, 0x5b, 0x1c, 0xa6, 0xa0, 0xdd, 0xd8, 0x00, 0xef, 0x70,
-  0x07, 0x09, 0xb7, 0xe8, 0x86, 0x16, 0xe6, 0xef, 0x25, 0x58, 0xbf, 0x39,
-  0x29, 0x1d, 0x32, 0xe1, 0xce, 0x69, 0x0e, 0xa6, 0xf4, 0x0c, 0x02, 0xe1,
-  0x3c, 0xff, 0xf6, 0xe9, 0xe4, 0x01, 0xf4, 0x10, 0x1b, 0x26, 0x01, 0x43,
-  0x5a, 0x07, 0xda, 0xcc, 0xdd, 0xf3, 0x23, 0x55, 0x9a, 0x04, 0x07, 0x13,
-  0xd8, 0xf6, 0x50, 0x64, 0x10, 0x31, 0x20, 0xb9, 0x1c, 0xd2, 0x3d, 0xbd,
-  0xf5, 0x21, 0x49, 0x00, 0xdd, 0x15, 0xfd, 0x3f, 0x81, 0x35, 0x2d, 0xd3,
-  0x2e, 0xe1, 0xab, 0xf4, 0xc3, 0x0d, 0xfa, 0xe5, 0x3c, 0xd7, 0xd2, 0x36,
-  0x40, 0xb3, 0xd6, 0xbc, 0x27, 0x0f, 0xc0, 0xd9, 0x40, 0x03, 0x85, 0xb3,
-  0xde, 0x27, 0x47, 0xcf, 0xed, 0x81, 0xdd, 0x95, 0xec, 0x25, 0xbd, 0x1a,
-  0xd5, 0x20, 0xff, 0x11, 0x28, 0x19, 0xe1, 0xb4, 0x04, 0xc6, 0xf5, 0xfc,
-  0xfa, 0xf7, 0xeb, 0x31, 0x5c, 0x27, 0x7b, 0xd6, 0x16, 0x4d, 0x09, 0x57,
-  0xae, 0xdd, 0xf1, 0xd2, 0xc7, 0xf6, 0x5b, 0xf7, 0xf7, 0x13, 0x08, 0xf5,
-  0x5e, 0x27, 0xee, 0xee, 0x34, 0x2c, 0xe2, 0x0b, 0x05, 0x1f, 0xfd, 0x30,
-  0xe7, 0x20, 0xd3, 0xe5, 0xbd, 0xdc, 0x3d, 0xf4, 0xe8, 0xc3, 0x3e, 0xaa,
-  0xfd, 0xec, 0xe5, 0x01, 0xd9, 0xee, 0xc0, 0x4e, 0xe8, 0x07, 0x1c, 0x93,
-  0xe7, 0xd6, 0x07, 0xf7, 0x24, 0xd6, 0xfa, 0x42, 0xb8, 0xde, 0x10, 0x7d,
-  0xc3, 0x06, 0xe0, 0x0e, 0xed, 0xbb, 0xaa, 0xa2, 0xf1, 0xa6, 0xc5, 0x0b,
-  0xdf, 0x33, 0xf7, 0x4f, 0xf7, 0x20, 0xd6, 0x0b, 0x0a, 0xfa, 0xf5, 0x31,
-  0x52, 0xda, 0x00, 0xb7, 0x41, 0x06, 0x06, 0x59, 0x07, 0xe9, 0xe4, 0xf9,
-  0x43, 0x45, 0x0f, 0xe6, 0x37, 0x0b, 0x05, 0x81, 0xad, 0x18, 0xf1, 0xf8,
-  0x1f, 0xfa, 0x41, 0x45, 0xf1, 0xcd, 0x2b, 0xcc, 0xd7, 0x0a, 0xc1, 0x09,
-  0xce, 0x09, 0x4d, 0x13, 0x38, 0xf2, 0x26, 0xb6, 0x08, 0xcb, 0xd2, 0x15,
-  0x17, 0xe2, 0x40, 0x1f, 0x13, 0xc6, 0x23, 0xcf, 0x34, 0x0f, 0xdc, 0xdf,
-  0x13, 0xeb, 0x14, 0x0c, 0x11, 0xe2, 0xf6, 0xc9, 0x3c, 0xf5, 0xc7, 0xdf,
-  0xf9, 0xf8, 0x07, 0x36, 0x2d, 0x1b, 0x4d, 0xf2, 0xd7, 0x21, 0xfd, 0x18,
-  0x01, 0xda, 0x52, 0x20, 0xf2, 0x03, 0xc5, 0x61, 0x49, 0xb7, 0xee, 0x19,
-  0xff, 0x17, 0x55, 0xeb, 0x13, 0x2b, 0xc8, 0xfa, 0x38, 0x1f, 0xfd, 0xea,
-  0xec, 0xf7, 0x0a, 0xde, 0xee, 0x4b, 0xf2, 0xe4, 0x01, 0xfa, 0x08, 0x0d,
-  0x4b, 0xe1, 0x0b, 0x0f, 0xbc, 0xda, 0xa0, 0x05, 0xec, 0x0a, 0x5b, 0xf1,
-  0x13, 0x12, 0xdd, 0xbe, 0xf4, 0x35, 0x15, 0x81, 0x12, 0xfe, 0x14, 0x07,
-  0xdc, 0xeb, 0xf4, 0xd5, 0xe6, 0x25, 0xfe, 0x0a, 0x4e, 0xff, 0x32, 0x18,
-  0xd3, 0x19, 0x00, 0xed, 0xf1, 0x1e, 0xcb, 0xdd, 0xcf, 0x07, 0x0b, 0x13,
-  0x10, 0x0c, 0xf6, 0x07, 0xe1, 0xef, 0xb0, 0xc5, 0xec, 0x04, 0xeb, 0xfb,
-  0x0f, 0xe6, 0x17, 0xb9, 0x50, 0xeb, 0x33, 0x0b, 0x2c, 0x24, 0x09, 0xfa,
-  0x15, 0x60, 0x2c, 0xdf, 0xf3, 0xfb, 0xa1, 0x24, 0xea, 0x40, 0xc4, 0x35,
-  0xf7, 0x0f, 0xf1, 0x10, 0xef, 0xea, 0x10, 0x1f, 0xd1, 0x0f, 0x19, 0x0c,
-  0x1b, 0x72, 0x16, 0x31, 0xfd, 0xca, 0xe8, 0x2c, 0x27, 0xd8, 0xe9, 0x04,
-  0x1a, 0x19, 0xe9, 0xd5, 0x10, 0x0b, 0x12, 0xd9, 0xe9, 0xff, 0x0e, 0x41,
-  0xd1, 0x09, 0x08, 0xea, 0x0a, 0xf8, 0x0d, 0xf1, 0xe3, 0xfa, 0xf7, 0x53,
-  0x34, 0xbf, 0x09, 0x0e, 0xf6, 0x02, 0x2a, 0x11, 0x2b, 0xcf, 0x10, 0xbf,
-  0x09, 0xef, 0xec, 0xe2, 0xc8, 0xcf, 0xee, 0xea, 0xce, 0x93, 0xe6, 0x0e,
-  0x16, 0x05, 0x22, 0xe1, 0x08, 0xc5, 0xd0, 0xd6, 0x0c, 0x17, 0xf2, 0xe6,
-  0xf7, 0x2a, 0x1a, 0xe8, 0xe0, 0xd7, 0x0c, 0xff, 0x1a, 0x05, 0xd6, 0xdf,
-  0xf4, 0x15, 0xe2, 0xe0, 0x02, 0xd6, 0x0b, 0x23, 0x19, 0xf6, 0x08, 0x05,
-  0x2b, 0x7f, 0x22, 0xe3, 0xc2, 0xaa, 0x05, 0x04, 0x85, 0x05, 0x40, 0x0f,
-  0x01, 0x23, 0x15, 0xee, 0xf0, 0xee, 0x01, 0xfb, 0xcc, 0xea, 0xeb, 0x2a,
-  0xf3, 0xe0, 0xda, 0x2c, 0xca, 0xfb, 0xcc, 0xeb, 0x15, 0xc7, 0xf5, 0x11,
-  0xcf, 0x03, 0x00, 0x01, 0x03, 0x2f, 0x27, 0xe2, 0xfb, 0xb0, 0x49, 0x1f,
-  0x16, 0xec, 0xef, 0xe4, 0xdc, 0x10, 0x52, 0xc6, 0x0f, 0x15, 0xfb, 0x2a,
-  0xb3, 0x40, 0xeb, 0x3d, 0x15, 0xff, 0x02, 0x11, 0x05, 0x00, 0xec, 0xcd,
-  0xeb, 0xdc, 0x1d, 0xd3, 0x0c, 0xf7, 0x08, 0xed, 0x05, 0x13, 0x13, 0x17,
-  0xff, 0xf0, 0xff, 0x0a, 0xf6, 0xe0, 0xf8, 0xfa, 0x1d, 0x05, 0x08, 0x00,
-  0x1a, 0x02, 0xc2, 0x01, 0xc7, 0x23, 0x08, 0xfd, 0xcf, 0xe2, 0x1a, 0xfd,
-  0x39, 0xf3, 0xeb, 0x14, 0x1c, 0xfd, 0xcc, 0xfc, 0x0d, 0x3e, 0x08, 0x17,
-  0xf0, 0xe9, 0x42, 0xf1, 0xf2, 0x07, 0x10, 0x18, 0x0b, 0x37, 0x0b, 0x13,
-  0xce, 0x04, 0xf3, 0xfb, 0x03, 0xf2, 0x0d, 0xe1, 0xfa, 0xff, 0x0a, 0x0f,
-  0x13, 0xd9, 0x10, 0xde, 0xfa, 0xfc, 0x06, 0xf6, 0x1f, 0x07, 0x00, 0xe0,
-  0x25, 0x0a, 0x14, 0x03, 0x0c, 0xef, 0xdc, 0xed, 0x0e, 0x1c, 0xf0, 0xf6,
-  0xf3, 0xef, 0x17, 0x14, 0x3f, 0xd8, 0x7f, 0x24, 0xcd, 0xcd, 0x0f, 0xf0,
-  0xde, 0x2a, 0x00, 0x28, 0x05, 0xfc, 0xfc, 0x57, 0x0d, 0x0a, 0xf8, 0x03,
-  0xe7, 0x16, 0xfa, 0xee, 0xf4, 0xd4, 0x13, 0xf6, 0x1f, 0x29, 0x12, 0x0c,
-  0x00, 0x18, 0xeb, 0xe1, 0x44, 0xd9, 0x02, 0x2b, 0xed, 0x8f, 0x52, 0xbc,
-  0xc4, 0xf5, 0xe1, 0xdd, 0x2a, 0xd1, 0x05, 0xf6, 0xa3, 0x4a, 0x41, 0x23,
-  0x29, 0x16, 0xc0, 0xec, 0x0c, 0x04, 0x87, 0x38, 0x18, 0x93, 0xdf, 0x0b,
-  0xff, 0x65, 0x2f, 0xca, 0xe8, 0xc9, 0xe2, 0x5f, 0x1f, 0x08, 0x57, 0xbe,
-  0xc5, 0x08, 0x16, 0xd3, 0xe8, 0x13, 0xfa, 0xaf, 0x33, 0xea, 0x92, 0x2c,
-  0x32, 0x06, 0x38, 0xe2, 0xeb, 0xc6, 0xfd, 0xe0, 0xaa, 0xe4, 0x1e, 0xb7,
-  0xde, 0xbe, 0x32, 0xac, 0x2b, 0x81, 0xcb, 0xdc, 0x10, 0x1a, 0xa1, 0x11,
-  0x15, 0xe7, 0xc5, 0xe2, 0x2d, 0xe1, 0xf2, 0x76, 0x2e, 0xe3, 0x18, 0x4a,
-  0x18, 0x38, 0x31, 0x38, 0xb5, 0xfd, 0x25, 0x0b, 0x1a, 0x33, 0xda, 0xea,
-  0x09, 0x15, 0xaa, 0x0d, 0x23, 0x1d, 0x98, 0xdb, 0x1f, 0xf9, 0xb9, 0xee,
-  0x05, 0x27, 0xd9, 0xcd, 0x12, 0x06, 0xc1, 0xe1, 0x63, 0x40, 0x1f, 0x10,
-  0x31, 0xe1, 0xfe, 0xc9, 0xf3, 0xe6, 0xca, 0x40, 0xd2, 0x3a, 0xf6, 0x04,
-  0x32, 0x85, 0xe6, 0x23, 0x00, 0x1c, 0xff, 0xfc, 0xf4, 0xbe, 0x17, 0x33,
-  0xaa, 0x53, 0xc1, 0xe6, 0xe2, 0x00, 0x0d, 0x0b, 0x01, 0x11, 0x9e, 0x7f,
-  0x34, 0xf6, 0xf0, 0xfe, 0xff, 0x66, 0x46, 0xf5, 0x54, 0xa0, 0xea, 0x17,
-  0x0c, 0x20, 0xe5, 0x39, 0x8b, 0x20, 0x45, 0xe3, 0xdf, 0xe8, 0xe9, 0x1d,
-  0xc2, 0xbf, 0x02, 0x3f, 0x17, 0xdb, 0xff, 0xac, 0x21, 0xc0, 0xb4, 0xf9,
-  0x01, 0xda, 0x1c, 0x5a, 0x0e, 0x66, 0xe2, 0x1a, 0xf9, 0x01, 0x36, 0xe8,
-  0x2a, 0xc8, 0x01, 0xd4, 0x70, 0x29, 0xd8, 0xf7, 0xfe, 0x49, 0xc8, 0xbb,
-  0xfb, 0x0a, 0xfe, 0x13, 0xfe, 0xe1, 0x16, 0xdf, 0xd9, 0xda, 0x49, 0xc8,
-  0xfb, 0x49, 0x0a, 0xfa, 0xae, 0x1a, 0x02, 0x0b, 0xee, 0x00, 0xf8, 0xc4,
-  0xe5, 0xe8, 0x17, 0x23, 0xdf, 0x7f, 0xe4, 0x49, 0x15, 0xe9, 0x9a, 0x44,
-  0x3c, 0x0e, 0x1e, 0x31, 0x3c, 0xee, 0x1a, 0x06, 0xfc, 0x13, 0x14, 0x49,
-  0xdb, 0xe2, 0xd5, 0x0b, 0x11, 0xe3, 0x3a, 0xb3, 0xee, 0xff, 0x27, 0xe3,
-  0x1b, 0xea, 0xfd, 0x21, 0xde, 0xd3, 0x1d, 0x8c, 0x2c, 0x17, 0x14, 0xfa,
-  0x36, 0x12, 0x4a, 0x69, 0x21, 0x4d, 0xb7, 0xce, 0xd2, 0xff, 0x12, 0xf5,
-  0x49, 0xea, 0x00, 0x09, 0x12, 0xf4, 0xdb, 0x35, 0x29, 0xe1, 0xdc, 0xf9,
-  0x4c, 0x0d, 0x51, 0x1c, 0x10, 0x21, 0x23, 0xe4, 0xcd, 0xb5, 0xf8, 0x3f,
-  0x36, 0xcc, 0xea, 0xec, 0x52, 0x0e, 0xb7, 0x4a, 0x18, 0x03, 0xb3, 0xe6,
-  0x0d, 0x21, 0xe7, 0xb8, 0x5e, 0x1c, 0x9e, 0xcd, 0xe7, 0x95, 0xff, 0xe1,
-  0x02, 0xfa, 0xe7, 0x31, 0xf6, 0xdd, 0xe1, 0x3d, 0xf6, 0xed, 0xf9, 0xcd,
-  0x0c, 0xf8, 0x30, 0xe1, 0xac, 0x14, 0xf9, 0x8e, 0x9a, 0xef, 0x43, 0xd6,
-  0xf2, 0x1d, 0x13, 0x1a, 0xa2, 0x0b, 0xee, 0x02, 0xee, 0xd0, 0x0a, 0x2b,
-  0x1c, 0x81, 0xef, 0x0a, 0xeb, 0xe5, 0x15, 0xf0, 0x30, 0x16, 0xfe, 0xcc,
-  0xcc, 0x0c, 0x20, 0x41, 0x0f, 0xe7, 0xfe, 0xfd, 0x1e, 0xf9, 0xf4, 0x0c,
-  0xdd, 0x06, 0x8b, 0xde, 0xf6, 0x07, 0xe6, 0x29, 0x2e, 0xef, 0xe0, 0x1e,
-  0xdc, 0xf0, 0xff, 0x2f, 0xf8, 0x43, 0xd3, 0xdc, 0xe6, 0xe0, 0xc7, 0x06,
-  0xee, 0xfa, 0x23, 0x13, 0xe8, 0xe8, 0x1d, 0xf9, 0x21, 0xe0, 0x1e, 0x2a,
-  0x04, 0xe1, 0x27, 0x05, 0xd8, 0x34, 0xc5, 0xd5, 0xcb, 0xdf, 0xf4, 0x02,
-  0x48, 0xf1, 0xfe, 0x1b, 0xfa, 0x4d, 0xf0, 0xec, 0x47, 0x03, 0x23, 0xfd,
-  0x2f, 0xe3, 0x6a, 0x2b, 0xbb, 0xb3, 0x1a, 0xf9, 0xfd, 0x16, 0x38, 0xe3,
-  0x1b, 0xe4, 0xe4, 0x21, 0x48, 0xf1, 0x1c, 0xfe, 0x0d, 0x00, 0xe5, 0x1b,
-  0xd2, 0x08, 0xf6, 0xbe, 0xf1, 0x3b, 0xf4, 0xdd, 0xb7, 0x06, 0x15, 0xe6,
-  0x15, 0xe9, 0x36, 0x01, 0xf7, 0xd9, 0x3b, 0x00, 0x9c, 0x39, 0xe9, 0x25,
-  0x20, 0x08, 0xff, 0xfd, 0xc9, 0x70, 0xf2, 0xdb, 0x1d, 0xdf, 0x04, 0xee,
-  0x37, 0x23, 0x22, 0x2c, 0xe9, 0x4e, 0x10, 0xd8, 0x23, 0xf2, 0x52, 0x01,
-  0x0b, 0x17, 0x56, 0x18, 0xd6, 0xd1, 0xee, 0x27, 0x44, 0xf5, 0xdf, 0xbb,
-  0xfb, 0xcc, 0x06, 0xc8, 0x19, 0x25, 0x0d, 0x28, 0x19, 0x06, 0xc6, 0xf7,
-  0xc9, 0xf7, 0x0c, 0xbe, 0xf4, 0x05, 0x06, 0xff, 0xc1, 0x10, 0xf7, 0xf1,
-  0xf1, 0xdb, 0x0a, 0x47, 0x22, 0x2c, 0xe3, 0xdc, 0xf2, 0x7f, 0xd6, 0xc9,
-  0x19, 0xcf, 0xc1, 0xec, 0xdb, 0x24, 0x1e, 0xfd, 0x22, 0x05, 0xbc, 0x1f,
-  0x4b, 0xf0, 0x07, 0x3e, 0x3b, 0xf6, 0xcf, 0x0a, 0xac, 0x0e, 0x3c, 0xf6,
-  0xd5, 0xe9, 0xa9, 0xcd, 0xc1, 0x22, 0x21, 0xc1, 0x2d, 0x3e, 0xe3, 0x5a,
-  0x88, 0x35, 0x03, 0x26, 0xd5, 0x25, 0x21, 0x3a, 0xf2, 0xfc, 0x07, 0xeb,
-  0x2d, 0x1c, 0xdf, 0xcf, 0xda, 0xf8, 0xf7, 0xc6, 0xda, 0x24, 0x5a, 0xdc,
-  0xed, 0x09, 0xfb, 0x23, 0x49, 0x0c, 0x03, 0xd6, 0x38, 0xc5, 0x01, 0x30,
-  0x9e, 0xf7, 0x4e, 0xd8, 0xee, 0x30, 0x07, 0x0f, 0x12, 0xc6, 0x19, 0xee,
-  0x20, 0xd0, 0xa7, 0x7f, 0xa3, 0x05, 0x16, 0x24, 0x32, 0xd3, 0x14, 0xfa,
-  0x41, 0x5f, 0xbb, 0x40, 0x3c, 0x19, 0x2e, 0x2a, 0xda, 0xc2, 0x01, 0x0f,
-  0xe7, 0xde, 0xe4, 0xf1, 0xbe, 0xf3, 0xe0, 0xe9, 0x1e, 0x47, 0x2d, 0x2d,
-  0xdc, 0x24, 0x55, 0xe7, 0x21, 0xb6, 0xd2, 0x0e, 0xfb, 0xe2, 0xd5, 0xfa,
-  0xf4, 0xd3, 0xc9, 0x06, 0xfb, 0xe0, 0x9c, 0x61, 0x0a, 0x04, 0xf3, 0x3a,
-  0xee, 0xa8, 0x02, 0xae, 0x21, 0x15, 0xd5, 0xe5, 0xfb, 0x2e, 0x09, 0x33,
-  0x51, 0xea, 0x0d, 0xd1, 0xd0, 0xe6, 0xaa, 0x28, 0xf3, 0x0f, 0xf6, 0xf4,
-  0xcd, 0x97, 0x46, 0xe3, 0x38, 0xef, 0x1f, 0xe2, 0xb7, 0xe8, 0x6f, 0xf1,
-  0x12, 0x21, 0xa5, 0x2e, 0x43, 0xea, 0x02, 0x0d, 0x55, 0xc1, 0x0f, 0xdd,
-  0x01, 0x20, 0xaa, 0xbd, 0x1d, 0x65, 0xf2, 0x2c, 0x08, 0x40, 0xbf, 0xfe,
-  0x2b, 0xb1, 0xd6, 0xfd, 0x0f, 0xf2, 0x07, 0x51, 0x36, 0x4f, 0xda, 0xde,
-  0xe6, 0x44, 0x69, 0xdd, 0xab, 0xcc, 0xa3, 0xcc, 0x0c, 0xf1, 0xe7, 0x21,
-  0x51, 0xf6, 0x47, 0xcd, 0xf1, 0xf9, 0xdb, 0x17, 0xb2, 0xea, 0xe9, 0xaf,
-  0xe2, 0xda, 0xd9, 0xed, 0x68, 0xbb, 0x21, 0x7a, 0x04, 0x02, 0x45, 0xf5,
-  0xa2, 0xdf, 0xe7, 0xf3, 0xf0, 0xf7, 0x1f, 0xd3, 0x0c, 0xcd, 0xa1, 0x81,
-  0xe4, 0x15, 0x39, 0x3c, 0xe2, 0xe0, 0x0a, 0x2c, 0x0e, 0xe5, 0x09, 0xb3,
-  0xc3, 0xe0, 0xfd, 0x30, 0x1e, 0x15, 0x15, 0x31, 0xe6, 0x03, 0xeb, 0x60,
-  0xd9, 0xf5, 0x2d, 0xc4, 0x06, 0x18, 0xf8, 0xa3, 0xbd, 0xf1, 0xde, 0xf0,
-  0xce, 0x16, 0x13, 0x3c, 0x06, 0x39, 0x21, 0x0b, 0xe1, 0x33, 0xdf, 0x07,
-  0x18, 0x4c, 0x40, 0x00, 0x1c, 0x05, 0x1e, 0x11, 0x0b, 0x26, 0xda, 0xe4,
-  0x28, 0xd6, 0x26, 0xfe, 0x0a, 0x51, 0xde, 0x0a, 0x30, 0xe9, 0xfb, 0x2f,
-  0x05, 0x34, 0xfd, 0x2e, 0xfe, 0x0c, 0xe4, 0x15, 0x28, 0x0a, 0xb2, 0xe6,
-  0x25, 0xea, 0x30, 0xdc, 0x1a, 0x57, 0xd6, 0xc9, 0x33, 0xba, 0x2a, 0xdb,
-  0x18, 0x25, 0xe1, 0x04, 0x26, 0xd4, 0x81, 0xfe, 0xff, 0xbb, 0x25, 0xc0,
-  0x54, 0xf0, 0x4b, 0xc1, 0xd3, 0xe5, 0x15, 0xe1, 0x05, 0x06, 0xc9, 0x5b,
-  0x06, 0x1a, 0xfd, 0xcf, 0x16, 0xd7, 0x01, 0xe6, 0x4f, 0x33, 0x0f, 0x2a,
-  0xe2, 0xde, 0x0e, 0x2d, 0xa0, 0x36, 0x34, 0x3b, 0xfb, 0x25, 0x0e, 0x6a,
-  0xf7, 0xfd, 0xec, 0xf4, 0x3f, 0x39, 0xb8, 0xe4, 0x15, 0xfc, 0x21, 0x4a,
-  0x24, 0x10, 0xeb, 0x42, 0x0a, 0x30, 0xd0, 0xe8, 0x48, 0x41, 0x2c, 0xcb,
-  0xcb, 0xe1, 0x06, 0x15, 0xcf, 0x55, 0x27, 0xa2, 0xc2, 0xfd, 0xe5, 0xc2,
-  0xf2, 0x46, 0x1b, 0xa0, 0x12, 0x1a, 0xee, 0x04, 0xdd, 0xd5, 0x18, 0xf9,
-  0x23, 0x09, 0xff, 0x2a, 0x01, 0x14, 0xeb, 0x27, 0x19, 0x6a, 0x18, 0x4c,
-  0xe7, 0xf0, 0xba, 0xfd, 0x1c, 0xea, 0x03, 0x37, 0xcd, 0xb8, 0xe7, 0x3a,
-  0xa1, 0x41, 0x16, 0x26, 0xdd, 0xb4, 0x00, 0x26, 0xad, 0xd3, 0xb0, 0x0e,
-  0xf5, 0x3b, 0xe4, 0x8a, 0x0d, 0xe0, 0xe0, 0x36, 0x04, 0x08, 0x28, 0xce,
-  0x2c, 0xeb, 0x33, 0xde, 0x28, 0xd5, 0x9f, 0xcb, 0x52, 0x07, 0xe7, 0x90,
-  0xda, 0x0e, 0x1e, 0x16, 0x0f, 0x0c, 0xf9, 0xf3, 0xdb, 0xc5, 0x14, 0x49,
-  0xce, 0x7f, 0x05, 0x0e, 0x2e, 0xa7, 0x34, 0x31, 0x0e, 0xab, 0x1b, 0xb1,
-  0xc1, 0x05, 0xe2, 0xda, 0xcf, 0x12, 0x49, 0xb1, 0x3b, 0x0a, 0x71, 0x27,
-  0x04, 0xdc, 0x1b, 0xe4, 0xf8, 0x32, 0x3f, 0xf3, 0xef, 0x0e, 0x26, 0xd8,
-  0xe9, 0x4c, 0x0d, 0x1a, 0xfb, 0x31, 0x43, 0x60, 0x7f, 0x1d, 0xdb, 0x2e,
-  0x25, 0x1d, 0xc9, 0x10, 0x36, 0x32, 0xea, 0xd0, 0xc0, 0x17, 0x2a, 0x00,
-  0x32, 0x01, 0x1d, 0xfe, 0xe8, 0x1f, 0xe8, 0x29, 0xd4, 0xd9, 0xd0, 0xd8,
-  0xe7, 0xf1, 0xd7, 0xd6, 0xf2, 0xfb, 0xf3, 0xd5, 0xef, 0x2c, 0x13, 0xdb,
-  0x10, 0x02, 0xc0, 0x10, 0x31, 0x07, 0x8f, 0xcd, 0xce, 0x38, 0xb8, 0x1b,
-  0xbb, 0xbc, 0xcd, 0x27, 0x45, 0xd9, 0xd1, 0x2c, 0xcf, 0xb5, 0xfe, 0xce,
-  0xfe, 0x1d, 0xf4, 0x1e, 0x29, 0x10, 0xf3, 0x27, 0xbb, 0xa6, 0xe9, 0x13,
-  0x42, 0x49, 0xf7, 0xf2, 0x18, 0x39, 0xe6, 0x0d, 0x38, 0x09, 0xef, 0x34,
-  0xf3, 0xcb, 0xfd, 0x20, 0x9b, 0x1c, 0x0f, 0xb2, 0xc0, 0xcf, 0x27, 0x3c,
-  0xdb, 0x08, 0xc1, 0x13, 0x26, 0x47, 0x2c, 0x29, 0xa0, 0xec, 0x0a, 0xb6,
-  0x23, 0xa3, 0xd1, 0x50, 0xb2, 0x37, 0xea, 0x1e, 0xc6, 0x36, 0xf3, 0x5a,
-  0xbe, 0xb9, 0x16, 0x00, 0xe2, 0xf4, 0x13, 0xd4, 0xc9, 0xfc, 0x3f, 0x2a,
-  0xb4, 0x44, 0x9c, 0xb6, 0x35, 0x13, 0xc3, 0x15, 0x31, 0xa9, 0x5d, 0xc5,
-  0x65, 0xfb, 0xf1, 0x7f, 0x63, 0x17, 0x15, 0x07, 0x1e, 0x0e, 0x9f, 0x2a,
-  0xcb, 0x06, 0xe1, 0x49, 0x33, 0x00, 0x05, 0x16, 0xbe, 0xed, 0x37, 0xf0,
-  0x30, 0xba, 0x05, 0x37, 0x21, 0xb1, 0x05, 0xdb, 0xe1, 0xe2, 0xf2, 0xc6,
-  0xf2, 0xfc, 0xc6, 0x16, 0x16, 0x23, 0x11, 0x24, 0x1c, 0x19, 0xea, 0x26,
-  0xf0, 0x55, 0x09, 0xff, 0x43, 0x36, 0x52, 0xa6, 0x47, 0x11, 0x55, 0xc0,
-  0xb3, 0xfe, 0xf0, 0xd8, 0xe2, 0xed, 0x34, 0x30, 0x18, 0x32, 0xc1, 0x1c,
-  0x3b, 0x2b, 0xaf, 0xd3, 0xfc, 0x1c, 0xd3, 0x24, 0x18, 0x09, 0x3d, 0xb1,
-  0xaa, 0x7b, 0x29, 0xf2, 0x3a, 0x4b, 0xd2, 0x0e, 0x06, 0x05, 0xf5, 0x15,
-  0x04, 0x14, 0x16, 0x40, 0xf7, 0x7f, 0xd3, 0xcb, 0x3e, 0x14, 0x1d, 0xf1,
-  0x23, 0xdf, 0x08, 0x48, 0xec, 0xa4, 0xc5, 0xff, 0xec, 0xd4, 0x1e, 0xd0,
-  0x0c, 0xf3, 0x66, 0xb5, 0xb5, 0x41, 0xcc, 0x5b, 0xf8, 0xc2, 0xc0, 0xe1,
-  0xd1, 0xeb, 0xe4, 0x33, 0x5d, 0x2a, 0xff, 0xef, 0xcb, 0x6f, 0x01, 0x23,
-  0x4d, 0x2b, 0x1a, 0xf5, 0x13, 0xcb, 0xc1, 0xe1, 0xaf, 0x51, 0x06, 0xf1,
-  0x39, 0xf5, 0x11, 0x0d, 0xf6, 0x28, 0x40, 0x1b, 0x47, 0x0c, 0x30, 0xaf,
-  0x0e, 0xdd, 0xd1, 0xd5, 0xf9, 0x5d, 0x48, 0xbb, 0x1d, 0x9b, 0x21, 0xcf,
-  0x19, 0x97, 0xf3, 0xf2, 0xe8, 0x12, 0x2a, 0x0e, 0x17, 0xf4, 0xfb, 0xfc,
-  0xcd, 0xc3, 0xd4, 0xe0, 0xb9, 0xb3, 0xa7, 0x09, 0x25, 0xbf, 0xea, 0x07,
-  0xfb, 0xf7, 0xa8, 0xe9, 0xf5, 0xd8, 0x03, 0x35, 0x13, 0x14, 0x12, 0x01,
-  0xfd, 0x40, 0xfc, 0x0c, 0xf4, 0xfa, 0xfd, 0x1e, 0xea, 0x07, 0x10, 0x00,
-  0xfe, 0x04, 0xbb, 0xd3, 0x03, 0xf0, 0xad, 0xe9, 0x1a, 0x7f, 0x22, 0x3a,
-  0xf0, 0x36, 0x1e, 0x31, 0xd7, 0x08, 0x06, 0x3f, 0x02, 0x16, 0x04, 0xe2,
-  0x26, 0xec, 0x29, 0xe2, 0xf0, 0xfd, 0xbd, 0xc0, 0x4d, 0xdc, 0x2b, 0xc2,
-  0xf9, 0xfd, 0x30, 0x23, 0x1d, 0x17, 0x32, 0x1b, 0xce, 0xf3, 0xe2, 0xe6,
-  0xef, 0x0c, 0x03, 0xfa, 0xfa, 0x1a, 0xeb, 0xcc, 0x2e, 0x0a, 0xe7, 0x26,
-  0xf8, 0x11, 0x39, 0xf3, 0x69, 0x4f, 0x0a, 0xd3, 0x06, 0x16, 0xf0, 0xef,
-  0x20, 0x31, 0x18, 0x0a, 0xbb, 0xf7, 0xa7, 0x35, 0x04, 0x1b, 0x0e, 0x2a,
-  0xc3, 0x1a, 0xfc, 0xf5, 0xd6, 0xe5, 0x3a, 0xdd, 0xc2, 0xf5, 0xef, 0xf1,
-  0xf1, 0xc5, 0xfb, 0xc3, 0xec, 0x31, 0x19, 0xee, 0x0c, 0xaf, 0xfc, 0xff,
-  0x0d, 0xc1, 0xdb, 0x0c, 0x38, 0x31, 0xde, 0x20, 0xe9, 0xc9, 0xa3, 0xfb,
-  0xf3, 0xee, 0x1e, 0x6a, 0x95, 0xb8, 0x5e, 0xeb, 0x3d, 0xe4, 0xd3, 0x1b,
-  0x03, 0x32, 0xe5, 0xd3, 0x32, 0x44, 0x24, 0xcb, 0xff, 0x58, 0x1d, 0xf7,
-  0x3b, 0xf9, 0xee, 0x00, 0xff, 0xd0, 0x08, 0xf3, 0x59, 0x0e, 0x07, 0xde,
-  0xcc, 0xaf, 0xc1, 0x59, 0x4d, 0x3a, 0xcc, 0xe8, 0xb4, 0x32, 0x17, 0xef,
-  0x54, 0xcb, 0xff, 0x0f, 0x00, 0xda, 0xe2, 0x40, 0xfb, 0xcd, 0x24, 0xbf,
-  0xee, 0xf6, 0xbc, 0xe0, 0xe5, 0x64, 0x09, 0xdd, 0x37, 0xdf, 0x3f, 0x8b,
-  0x08, 0xd2, 0xae, 0x3d, 0x41, 0x26, 0x54, 0xf4, 0x26, 0xb5, 0xae, 0xaf,
-  0x76, 0x65, 0x15, 0x78, 0xdc, 0x81, 0xb6, 0xe0, 0xee, 0x37, 0xf6, 0xd9,
-  0xfe, 0x0f, 0x02, 0xb4, 0xe8, 0xef, 0x20, 0xcb, 0x0b, 0x12, 0xb9, 0xde,
-  0xe0, 0x0e, 0x25, 0xea, 0x32, 0xa3, 0x2f, 0x29, 0xc6, 0x23, 0x1f, 0xed,
-  0xbe, 0xfd, 0x3a, 0xef, 0xf4, 0xe6, 0x14, 0x06, 0x81, 0xc6, 0x99, 0x05,
-  0xab, 0x40, 0xf5, 0x12, 0x03, 0xd6, 0xd9, 0x1d, 0x04, 0x6b, 0x0a, 0xf9,
-  0xe4, 0x2a, 0x66, 0x6c, 0xea, 0xed, 0x1d, 0x23, 0xec, 0xe8, 0x02, 0x18,
-  0xd3, 0xeb, 0xbb, 0x00, 0xf1, 0xd9, 0xaa, 0xd6, 0x09, 0x10, 0xfb, 0xc4,
-  0x16, 0xeb, 0xde, 0xde, 0xe1, 0x22, 0x34, 0xd0, 0xc0, 0x31, 0x3e, 0xd3,
-  0xd5, 0xe6, 0xb0, 0x30, 0x07, 0xef, 0x3e, 0xc4, 0x26, 0x3d, 0xce, 0xfc,
-  0x4d, 0x39, 0xc8, 0x10, 0x01, 0xc8, 0x1a, 0x26, 0x0f, 0xb8, 0x00, 0xea,
-  0x42, 0x3a, 0x1b, 0x2a, 0x07, 0x43, 0x90, 0xf4, 0xd7, 0xf6, 0xe4, 0xbc,
-  0xed, 0xce, 0x01, 0x07, 0x78, 0xdf, 0x73, 0xb1, 0xd0, 0xac, 0xbb, 0x30,
-  0x07, 0x30, 0x46, 0xf6, 0x14, 0xfb, 0x0b, 0xd4, 0x3c, 0x02, 0x3f, 0xfe,
-  0x20, 0xcb, 0xf1, 0x0a, 0x09, 0xeb, 0x2d, 0xf2, 0x31, 0x11, 0xcb, 0xbc,
-  0xf8, 0xc7, 0xe4, 0xaa, 0xfd, 0xc4, 0x02, 0x28, 0xa6, 0x02, 0x23, 0x37,
-  0xf7, 0xe4, 0x01, 0x51, 0xb4, 0x05, 0xd8, 0x13, 0xff, 0x0b, 0x38, 0xc9,
-  0x27, 0x1d, 0xfd, 0xbe, 0xf6, 0xee, 0xd7, 0x04, 0x53, 0xb2, 0xe1, 0xe1,
-  0xb5, 0xdb, 0xce, 0xff, 0xab, 0x44, 0xe1, 0xdd, 0x0a, 0xd0, 0x00, 0xeb,
-  0xe8, 0xc6, 0x0c, 0xe0, 0xc0, 0xde, 0x21, 0x0c, 0xfd, 0xe5, 0xae, 0xff,
-  0xd2, 0xe4, 0x16, 0xac, 0x23, 0x04, 0x1f, 0xfa, 0xbe, 0x13, 0x23, 0x18,
-  0xcd, 0x2d, 0xe7, 0x37, 0xff, 0xf1, 0x26, 0x0e, 0x04, 0x26, 0xf2, 0xd8,
-  0xe0, 0xd3, 0x4c, 0xa2, 0x06, 0xfc, 0x31, 0x4d, 0xb5, 0xfa, 0x07, 0xe1,
-  0x29, 0x20, 0x67, 0xe9, 0x03, 0xcf, 0xe3, 0xe5, 0x1c, 0x05, 0xf6, 0x01,
-  0x05, 0xb9, 0x21, 0xd3, 0x07, 0xed, 0x3d, 0x2a, 0x81, 0xe4, 0xfb, 0x5b,
-  0x09, 0x1c, 0xe1, 0xed, 0x10, 0xfa, 0xa6, 0x2d, 0x6c, 0xe3, 0x94, 0xd8,
-  0xb5, 0x2b, 0x3a, 0xbd, 0xe4, 0xe0, 0xc0, 0xdd, 0x18, 0x3f, 0xb6, 0x57,
-  0xf8, 0xdf, 0xea, 0x1d, 0x1a, 0xef, 0xc0, 0xec, 0x2a, 0x81, 0xd9, 0x20,
-  0x8a, 0xe3, 0x0e, 0x24, 0x4d, 0x2f, 0x38, 0x07, 0xdf, 0x27, 0xe0, 0x4f,
-  0xdf, 0x21, 0xf3, 0x03, 0xb0, 0x02, 0x3d, 0xbc, 0x00, 0x35, 0xd4, 0xf8,
-  0x59, 0x07, 0x0a, 0xf9, 0x09, 0x30, 0x40, 0x19, 0x01, 0xff, 0x19, 0x39,
-  0x2d, 0x54, 0x1f, 0x0d, 0xbe, 0xb4, 0x3c, 0xcc, 0x0e, 0xb1, 0xfd, 0x2f,
-  0xf8, 0xf6, 0xe7, 0x13, 0xec, 0xa8, 0xb9, 0x38, 0xd9, 0xe2, 0xfb, 0xdc,
-  0xdd, 0xaf, 0x2a, 0x09, 0x3c, 0xee, 0x18, 0x4e, 0x03, 0xf9, 0xe4, 0x4c,
-  0x12, 0x1f, 0x9d, 0xe4, 0x00, 0xbc, 0xb7, 0xb3, 0xf5, 0xd8, 0xb6, 0x01,
-  0xf1, 0x57, 0xb3, 0x6c, 0xd0, 0xfb, 0x30, 0xf3, 0xde, 0x06, 0x02, 0xf7,
-  0x0a, 0xe6, 0xbf, 0x00, 0x0e, 0xf8, 0x31, 0xe5, 0xe9, 0xc9, 0x9c, 0x2f,
-  0xfa, 0x29, 0xea, 0x06, 0xb9, 0xfc, 0xf8, 0x31, 0x46, 0xe9, 0x1b, 0x0c,
-  0xd2, 0x05, 0x4a, 0xf0, 0x34, 0x06, 0x4c, 0xf5, 0x3c, 0xf5, 0xd6, 0xf6,
-  0x23, 0x07, 0x9d, 0x50, 0xea, 0xba, 0x98, 0x35, 0x27, 0xdf, 0x3f, 0xfe,
-  0x2d, 0xea, 0x1e, 0xe8, 0xdb, 0x1e, 0xeb, 0xef, 0xfc, 0x51, 0x3e, 0x90,
-  0x47, 0x10, 0xe5, 0x1b, 0x01, 0x3d, 0x26, 0x2f, 0x14, 0x26, 0x1b, 0xd3,
-  0xe1, 0xe9, 0x20, 0xfc, 0xb4, 0xff, 0xc9, 0x1e, 0xe0, 0x08, 0x21, 0x2b,
-  0xe3, 0xf1, 0x18, 0xf9, 0x3a, 0xfe, 0xd7, 0x96, 0x93, 0x1d, 0x30, 0xdf,
-  0x3e, 0x23, 0xe6, 0x0d, 0x4f, 0xe8, 0x7f, 0xbf, 0xd7, 0xc2, 0x1c, 0xe1,
-  0x1c, 0x62, 0xf6, 0xcc, 0x07, 0xda, 0xb9, 0xec, 0xfa, 0xc3, 0x11, 0xc0,
-  0x1f, 0x17, 0x03, 0xda, 0x3e, 0x2a, 0x5f, 0xff, 0xfb, 0xcc, 0xc9, 0xa4,
-  0x18, 0xf3, 0x0c, 0xe5, 0x08, 0xa6, 0x12, 0xda, 0xe2, 0xcf, 0x29, 0xf9,
-  0xba, 0x16, 0x14, 0x14, 0xaa, 0x0f, 0xc6, 0x9b, 0xfd, 0x7f, 0xce, 0x89,
-  0x47, 0xeb, 0x19, 0xe7, 0x17, 0x24, 0xfb, 0xdc, 0x09, 0x07, 0xf4, 0xa3,
-  0x29, 0x22, 0x2e, 0xee, 0x63, 0x0c, 0x0c, 0x38, 0xaf, 0xd2, 0xe2, 0x1d,
-  0xfc, 0xec, 0x02, 0x2d, 0xde, 0xd1, 0xb8, 0x05, 0xfb, 0xaa, 0xf2, 0x00,
-  0xdb, 0x42, 0xf1, 0x55, 0xf1, 0x08, 0x01, 0xf7, 0x06, 0x90, 0xcb, 0x4c,
-  0xe7, 0xbf, 0x36, 0x3f, 0x43, 0x0c, 0x00, 0xfc, 0x13, 0x03, 0xf9, 0x05,
-  0xfa, 0x09, 0x99, 0xc2, 0x36, 0xe8, 0xbb, 0x52, 0x06, 0x11, 0x31, 0x0d,
-  0x19, 0xd4, 0xdf, 0xdd, 0x05, 0x2d, 0x37, 0xde, 0x23, 0x19, 0xc9, 0xe1,
-  0x16, 0xf9, 0x43, 0xbd, 0x19, 0xb4, 0x11, 0x01, 0xb6, 0x1f, 0x37, 0xe5,
-  0xe5, 0x34, 0xf1, 0x02, 0xe0, 0x25, 0xcf, 0xf7, 0x2e, 0x2f, 0x06, 0xd3,
-  0x14, 0xf1, 0x33, 0xfb, 0x37, 0x2b, 0x25, 0xfb, 0x65, 0x1e, 0xda, 0xa6,
-  0xde, 0xcf, 0x1c, 0x2f, 0x2c, 0xae, 0xbf, 0x7f, 0xf9, 0xf2, 0x26, 0x22,
-  0xb4, 0x29, 0x0b, 0xdb, 0xfa, 0xf2, 0x07, 0x2d, 0x28, 0x46, 0x1f, 0x15,
-  0xe3, 0x43, 0x01, 0x09, 0xd6, 0x22, 0x05, 0xfb, 0xfc, 0xf7, 0xd9, 0x22,
-  0x2e, 0xdd, 0xf5, 0x2a, 0x05, 0x01, 0x37, 0xea, 0x0e, 0x23, 0xd1, 0x29,
-  0x06, 0xc3, 0x21, 0xd9, 0x25, 0x31, 0xdc, 0xed, 0x06, 0xfd, 0x1e, 0x1b,
-  0x11, 0x6f, 0xc5, 0xfa, 0x13, 0x41, 0x39, 0x15, 0x2f, 0xf8, 0x15, 0x47,
-  0x12, 0xc7, 0x6a, 0x0a, 0x27, 0xd9, 0x19, 0x08, 0x10, 0xef, 0xce, 0xfb,
-  0xfd, 0x0d, 0x03, 0xc6, 0x2c, 0x06, 0xb1, 0xda, 0xa5, 0x5c, 0xdd, 0xe6,
-  0x15, 0xfa, 0xdd, 0xdf, 0x3d, 0x05, 0xcb, 0xdb, 0xe7, 0x9c, 0x11, 0x35,
-  0xe0, 0x37, 0x42, 0xe3, 0x2e, 0x1d, 0x07, 0xdd, 0x0d, 0x01, 0x01, 0xee,
-  0xfe, 0xf1, 0x81, 0xcc, 0x17, 0x20, 0xe4, 0xde, 0xf4, 0xec, 0x2a, 0xf1,
-  0x11, 0xe5, 0xdc, 0x1a, 0x6c, 0xb8, 0xc4, 0x10, 0xca, 0xf8, 0xed, 0xed,
-  0x27, 0x06, 0xee, 0x10, 0xb8, 0xc6, 0xd6, 0xfb, 0x0c, 0xca, 0x4b, 0xf3,
-  0xcb, 0x1e, 0xd4, 0x08, 0xf5, 0x09, 0xc7, 0xed, 0x27, 0xd3, 0xfc, 0x2f,
-  0xdf, 0xe1, 0xf0, 0xe9, 0x12, 0x2b, 0xf0, 0x3d, 0xfe, 0x30, 0xf0, 0x0d,
-  0x00, 0xed, 0x38, 0x0e, 0xed, 0x0c, 0x0f, 0x23, 0xe4, 0xd8, 0x37, 0x09,
-  0x14, 0x0a, 0x2b, 0x2a, 0x0a, 0x05, 0x10, 0xff, 0xc9, 0xf8, 0x07, 0xc0,
-  0x20, 0x32, 0xe2, 0xc4, 0x01, 0xac, 0x16, 0x5d, 0x09, 0x0f, 0xf1, 0x18,
-  0xf5, 0xed, 0x02, 0xd2, 0xcf, 0xae, 0x22, 0x21, 0x05, 0xe6, 0xaa, 0x28,
-  0xde, 0x2c, 0x11, 0xcf, 0xe4, 0xfe, 0x2d, 0xd7, 0x27, 0xe2, 0xce, 0xce,
-  0x12, 0x1b, 0xec, 0xda, 0x03, 0xc4, 0xf8, 0x25, 0x3b, 0x02, 0xd8, 0x5d,
-  0x0f, 0x2f, 0xcd, 0xe0, 0xfd, 0x36, 0x03, 0xdc, 0xef, 0x1d, 0xf5, 0x19,
-  0xf2, 0x4b, 0xfa, 0xdc, 0x07, 0xfd, 0x22, 0xf4, 0xbf, 0x48, 0xc6, 0xc7,
-  0x3a, 0xfa, 0xe7, 0xed, 0xfd, 0xdd, 0xdf, 0x19, 0x20, 0xd0, 0xd5, 0xff,
-  0xcf, 0xbe, 0xe2, 0x0a, 0x0c, 0xd0, 0xee, 0xc4, 0x16, 0x3d, 0x2d, 0xed,
-  0x9d, 0x14, 0x13, 0xfe, 0xae, 0xc0, 0xe7, 0x2e, 0xe6, 0x34, 0x0f, 0x05,
-  0xff, 0x12, 0xbd, 0x4e, 0x1f, 0xec, 0x43, 0xce, 0xde, 0x05, 0x08, 0x1b,
-  0xe5, 0x0c, 0x00, 0x22, 0x07, 0x15, 0xfc, 0xef, 0x16, 0xd5, 0x12, 0x47,
-  0x1a, 0xff, 0x02, 0x12, 0xf1, 0xd9, 0x0d, 0x1c, 0xc2, 0xea, 0xdd, 0x20,
-  0xca, 0x31, 0xbc, 0x28, 0xec, 0x1a, 0xd9, 0xef, 0x02, 0x58, 0x81, 0x25,
-  0x19, 0xe9, 0x07, 0x08, 0xfd, 0x1e, 0x4c, 0x31, 0xe0, 0x11, 0x40, 0x26,
-  0x18, 0xc0, 0x2d, 0xa0, 0x96, 0x1a, 0xd3, 0xb3, 0xb1, 0xf0, 0x13, 0xe0,
-  0xe0, 0x1a, 0xf6, 0xde, 0xf3, 0x42, 0xd2, 0x9e, 0x08, 0xdf, 0xf7, 0xfc,
-  0x13, 0xeb, 0x14, 0xf3, 0x0d, 0x10, 0x35, 0xec, 0x28, 0x00, 0x49, 0x10,
-  0x7d, 0x50, 0x2c, 0x3d, 0x0c, 0xdc, 0x94, 0x1c, 0x0b, 0x1f, 0xf9, 0x16,
-  0x41, 0xe8, 0xc7, 0x07, 0xd0, 0xe3, 0xfc, 0x33, 0x21, 0xfb, 0xe6, 0x00,
-  0xfe, 0xd5, 0xe1, 0x1f, 0x26, 0xba, 0x40, 0x38, 0xef, 0xe0, 0xe3, 0x13,
-  0x1d, 0x1b, 0x38, 0xff, 0xe1, 0xc6, 0xec, 0x06, 0x0a, 0x2e, 0xcb, 0x1b,
-  0x3b, 0x03, 0xe0, 0x32, 0xc0, 0xa6, 0xc9, 0xfc, 0x1a, 0xf5, 0xdc, 0x2f,
-  0x3b, 0x3e, 0x22, 0x11, 0x1d, 0xfa, 0xdf, 0x1c, 0x34, 0x24, 0x18, 0xd9,
-  0x0c, 0xbc, 0xc9, 0xa5, 0x07, 0x22, 0x36, 0x81, 0xd1, 0xe5, 0xf6, 0x41,
-  0xe6, 0x06, 0x4f, 0x06, 0x27, 0x20, 0x12, 0xf2, 0xe9, 0xfe, 0x02, 0x15,
-  0x0b, 0xcf, 0x48, 0x14, 0xf9, 0xe5, 0xdc, 0x03, 0xe5, 0x21, 0xef, 0x36,
-  0xce, 0x01, 0xee, 0xce, 0x22, 0xd6, 0x01, 0x05, 0xb0, 0xad, 0x33, 0x9b,
-  0x24, 0x06, 0xd0, 0x08, 0xd0, 0xe3, 0x27, 0x23, 0x2e, 0x1a, 0x3a, 0x01,
-  0xab, 0xe8, 0x39, 0x01, 0x7f, 0x2c, 0xeb, 0x25, 0xe9, 0xfa, 0xdb, 0x27,
-  0xe8, 0xba, 0xe1, 0x93, 0x03, 0x22, 0xee, 0x1b, 0xf4, 0xeb, 0x03, 0xf7,
-  0x0b, 0xda, 0x27, 0xe3, 0xfc, 0xd1, 0xec, 0xe9, 0x01, 0xfe, 0xe1, 0x28,
-  0x26, 0xe8, 0x34, 0xf1, 0xe4, 0x2b, 0xf7, 0xe9, 0x3a, 0xeb, 0xcc, 0xee,
-  0xe2, 0x70, 0xf9, 0xaa, 0x2d, 0xc9, 0x0a, 0xdf, 0xf8, 0x0b, 0xdf, 0x25,
-  0x38, 0xec, 0x0e, 0x08, 0x02, 0xc4, 0xf0, 0x44, 0x18, 0xed, 0xd9, 0x11,
-  0xd6, 0x62, 0xec, 0xda, 0xfd, 0x2a, 0x09, 0x14, 0xfe, 0x16, 0xc8, 0xf2,
-  0x18, 0x3e, 0x48, 0x33, 0x12, 0xd7, 0xc3, 0xc1, 0x18, 0x0e, 0xff, 0x0f,
-  0xc2, 0x2a, 0xf8, 0xbd, 0x07, 0x21, 0x1c, 0xf9, 0xe5, 0xe8, 0xd6, 0xe7,
-  0x31, 0xd2, 0xff, 0x03, 0xb5, 0x06, 0x2d, 0xa2, 0x23, 0x22, 0x33, 0xb9,
-  0x03, 0xbc, 0xff, 0x4a, 0x61, 0xf4, 0x28, 0x26, 0xc9, 0x10, 0xf4, 0x2d,
-  0x56, 0xdd, 0xff, 0xee, 0xdf, 0xfc, 0xed, 0x39, 0xf5, 0xf8, 0x10, 0x81,
-  0xe0, 0x1e, 0xf9, 0x16, 0xaf, 0xfd, 0x13, 0x07, 0x7f, 0xfd, 0x43, 0x41,
-  0x30, 0x02, 0x0d, 0x5e, 0x34, 0x05, 0x31, 0x53, 0x1a, 0x4d, 0xeb, 0x08,
-  0xd3, 0x45, 0xcf, 0xe7, 0xe2, 0x12, 0xe5, 0xcf, 0xda, 0x3e, 0xfb, 0xba,
-  0xf5, 0xc3, 0xe7, 0xf8, 0x3e, 0x00, 0x21, 0x11, 0xaf, 0xc8, 0x11, 0x0a,
-  0x00, 0x52, 0x41, 0x28, 0xfc, 0xd8, 0xc1, 0xb7, 0xc5, 0x17, 0x37, 0xb2,
-  0xf0, 0xd8, 0x07, 0xd5, 0xbd, 0x23, 0xe3, 0xf0, 0xc7, 0x0a, 0xfe, 0x01,
-  0xc4, 0x16, 0xb2, 0xf0, 0x3b, 0xbf, 0x02, 0x0e, 0x07, 0xaa, 0x0c, 0xf4,
-  0xf7, 0x10, 0xd8, 0xbb, 0x28, 0x03, 0x4f, 0xe5, 0xb7, 0xcc, 0x19, 0x4c,
-  0x46, 0xe3, 0x0f, 0x1b, 0x50, 0xaf, 0xe0, 0x20, 0x41, 0xb9, 0x18, 0xd0,
-  0x0a, 0x81, 0xc6, 0xe7, 0x4e, 0xd4, 0xd4, 0x56, 0xbd, 0xb1, 0x28, 0x1e,
-  0x0c, 0xf9, 0x1f, 0xf9, 0x4f, 0x00, 0xf9, 0xfe, 0x3c, 0xe4, 0xca, 0xec,
-  0x34, 0xd9, 0x31, 0xa0, 0xf4, 0x2b, 0x97, 0x3a, 0x0f, 0x3a, 0xc6, 0x03,
-  0x1c, 0x3b, 0xa7, 0x36, 0x39, 0xd9, 0x56, 0x0b, 0xd5, 0xe0, 0xef, 0x5e,
-  0xcd, 0x5c, 0x27, 0x1e, 0x35, 0x1d, 0x57, 0xc2, 0xe1, 0x24, 0x13, 0x25,
-  0xcb, 0x32, 0x52, 0xf8, 0x18, 0x99, 0x60, 0xa3, 0xf2, 0x89, 0xa2, 0xbc,
-  0x2a, 0xdc, 0x3f, 0x8d, 0xf2, 0x84, 0x42, 0xcb, 0xbc, 0x0c, 0x06, 0xf6,
-  0xe4, 0xdb, 0x07, 0xf6, 0xe1, 0x20, 0xc6, 0xc9, 0xcd, 0x1d, 0x28, 0xad,
-  0x38, 0x5f, 0x04, 0xfa, 0xd2, 0xfc, 0x2a, 0x33, 0xfa, 0x46, 0x1f, 0x5d,
-  0xff, 0xcf, 0x26, 0x2b, 0x33, 0xee, 0x1b, 0xd3, 0xca, 0xe0, 0xc0, 0xe7,
-  0x1e, 0x26, 0x17, 0x12, 0xbd, 0x06, 0x16, 0x26, 0x26, 0x11, 0xae, 0xce,
-  0xe0, 0xd5, 0xe3, 0x06, 0xf4, 0xc7, 0x38, 0x81, 0x02, 0xf7, 0x38, 0x11,
-  0xf5, 0x2d, 0xd6, 0x07, 0xda, 0xf6, 0xf9, 0xe5, 0x24, 0xfc, 0x07, 0xff,
-  0xdb, 0x53, 0xdf, 0x36, 0x8d, 0x16, 0x0b, 0x1b, 0xd3, 0xd5, 0xe8, 0xfb,
-  0xdf, 0xde, 0xaa, 0x5f, 0x14, 0x7c, 0xf3, 0x02, 0xcb, 0xf5, 0x38, 0x0e,
-  0xc6, 0x5b, 0x03, 0x1d, 0x31, 0x5c, 0x19, 0xc7, 0x0b, 0xe0, 0x08, 0x33,
-  0x13, 0xee, 0x0e, 0xec, 0xd0, 0x15, 0xba, 0xf5, 0x07, 0x11, 0xf7, 0x35,
-  0x26, 0xcf, 0xca, 0xf5, 0x41, 0x19, 0xe7, 0x0f, 0xdd, 0xf4, 0xc8, 0xee,
-  0xda, 0x2d, 0x02, 0xc2, 0x0c, 0xe1, 0x04, 0x31, 0x2a, 0xa3, 0x0f, 0xea,
-  0x42, 0x28, 0xe6, 0xc3, 0x99, 0x01, 0xe1, 0x31, 0x37, 0x06, 0xe4, 0x35,
-  0xe3, 0xee, 0xc5, 0xed, 0x07, 0xf8, 0x29, 0x2a, 0xe6, 0xf7, 0xca, 0xfd,
-  0x38, 0x02, 0x1a, 0xe6, 0xf3, 0x28, 0xf8, 0x0c, 0xf3, 0x08, 0xf2, 0xb2,
-  0xd6, 0xc3, 0x40, 0x62, 0x22, 0xb8, 0xf7, 0x3c, 0x26, 0x41, 0x26, 0x11,
-  0x33, 0xe3, 0xee, 0x15, 0x0c, 0xfb, 0xc6, 0xea, 0xa8, 0x30, 0x1d, 0x0a,
-  0x04, 0x35, 0xbe, 0x36, 0x45, 0x0c, 0x4e, 0x06, 0x34, 0xe1, 0xf2, 0xc9,
-  0xc2, 0x02, 0xf3, 0xd3, 0x34, 0x32, 0x01, 0xde, 0x40, 0xea, 0xbc, 0x25,
-  0xf6, 0x17, 0xe1, 0x24, 0x60, 0x0e, 0xfd, 0xfb, 0x15, 0xfc, 0xfa, 0xf6,
-  0xd8, 0x17, 0xe6, 0xbb, 0x56, 0x05, 0x3f, 0xc2, 0x0d, 0xbb, 0xb2, 0x11,
-  0xea, 0x02, 0x54, 0x43, 0x16, 0xe6, 0x7f, 0x0b, 0x1d, 0x0d, 0x05, 0xe2,
-  0xfd, 0xed, 0xdb, 0xe4, 0x36, 0x9d, 0xe8, 0x0b, 0x43, 0x4f, 0x14, 0xdc,
-  0xf1, 0xd5, 0x37, 0x6a, 0xfa, 0xc1, 0xe6, 0xb9, 0xaa, 0x26, 0xf3, 0x5b,
-  0xa4, 0x36, 0xc9, 0x95, 0xac, 0xe9, 0xe8, 0x09, 0xd8, 0xb6, 0xe0, 0x28,
-  0x05, 0xe6, 0x25, 0x3f, 0xe8, 0x48, 0x2b, 0x16, 0x08, 0xd1, 0x8e, 0x0d,
-  0xbe, 0xd2, 0xd4, 0x26, 0x38, 0xd0, 0x16, 0xf3, 0xdd, 0xd3, 0xde, 0x1f,
-  0x02, 0x89, 0xcc, 0xd5, 0x1d, 0x21, 0x0a, 0xff, 0x14, 0x3d, 0xf7, 0xff,
-  0x30, 0x0a, 0x0a, 0xf3, 0x49, 0x12, 0x05, 0xd3, 0x08, 0x00, 0xb6, 0xcf,
-  0x54, 0xa6, 0xe7, 0x4c, 0x3e, 0x10, 0x42, 0x33, 0x2b, 0xff, 0x81, 0x49,
-  0x0d, 0x19, 0x92, 0x30, 0x50, 0x10, 0xcd, 0xe2, 0xfb, 0xef, 0x62, 0x65,
-  0x0c, 0x14, 0xde, 0xb0, 0xe6, 0x4c, 0xd6, 0x96, 0x19, 0x44, 0x2c, 0xe2,
-  0xce, 0x51, 0x23, 0xbd, 0x2c, 0xd2, 0xdd, 0x08, 0xfa, 0xf5, 0xfd, 0xb3,
-  0x1a, 0x2f, 0xac, 0xf6, 0xb5, 0x16, 0xee, 0x2b, 0x2d, 0xf4, 0xd9, 0xe7,
-  0xf1, 0x58, 0x08, 0x00, 0x29, 0xd9, 0xc2, 0x3a, 0x0d, 0x0e, 0x17, 0xda,
-  0x11, 0x01, 0x46, 0xf2, 0x22, 0xef, 0xb5, 0x60, 0xfe, 0xb5, 0xf5, 0xb4,
-  0xa7, 0xf0, 0xec, 0xde, 0x00, 0x04, 0xcf, 0x9b, 0x50, 0x07, 0xe2, 0x01,
-  0xf4, 0xfd, 0xaa, 0x67, 0xee, 0xe2, 0x34, 0x32, 0xea, 0xd8, 0xee, 0x21,
-  0x02, 0xdb, 0x02, 0xf4, 0xe2, 0xb5, 0x2e, 0xe9, 0x18, 0x8c, 0x00, 0xa8,
-  0xda, 0xeb, 0xea, 0x33, 0xc7, 0x08, 0xef, 0xcc, 0x0c, 0xef, 0x3b, 0xdb,
-  0x10, 0xe6, 0x1e, 0x7f, 0x14, 0xe5, 0x0b, 0x2f, 0xe6, 0x20, 0xbb, 0x0a,
-  0x1f, 0xe6, 0xdf, 0xad, 0xea, 0xb9, 0x0a, 0xf2, 0x25, 0x52, 0xfd, 0x3c,
-  0x4f, 0x34, 0xa7, 0x2b, 0x35, 0xf0, 0x4a, 0x03, 0x66, 0xe7, 0xf4, 0x8e,
-  0x0b, 0x15, 0xde, 0x0b, 0x16, 0x0f, 0x17, 0x08, 0x28, 0xfb, 0x0f, 0xea,
-  0xfc, 0x03, 0xd8, 0xf8, 0x00, 0xd3, 0x19, 0x14, 0x2e, 0x39, 0x1a, 0xf1,
-  0xf3, 0x30, 0x7a, 0xaf, 0xfb, 0xf9, 0x19, 0xfd, 0xf4, 0x53, 0xd3, 0xaa,
-  0x46, 0xc3, 0x46, 0xf2, 0xe2, 0x22, 0xd6, 0x1e, 0x3f, 0x2a, 0xc2, 0x08,
-  0x43, 0xe5, 0x0d, 0x26, 0x24, 0xf6, 0x16, 0xf3, 0xc3, 0xf6, 0xfa, 0xec,
-  0x13, 0x5a, 0x1e, 0xfb, 0xbd, 0x2c, 0xf2, 0xe8, 0xc1, 0x21, 0x23, 0x2b,
-  0x15, 0x03, 0xc0, 0xb1, 0x24, 0x32, 0xdf, 0x47, 0x88, 0x48, 0x0e, 0xeb,
-  0xca, 0x00, 0x18, 0x62, 0x48, 0xc4, 0xec, 0x1f, 0xbb, 0xc9, 0xc2, 0x17,
-  0x25, 0x10, 0x2d, 0xf5, 0x10, 0xee, 0x0f, 0xcd, 0xef, 0x81, 0x07, 0x02,
-  0x78, 0x01, 0xa9, 0x04, 0xd0, 0xc1, 0xdf, 0xfc, 0xe1, 0xb9, 0x55, 0x13,
-  0x31, 0xfd, 0xe5, 0x1d, 0x00, 0x17, 0x10, 0x13, 0xa4, 0x00, 0xdd, 0xff,
-  0x0d, 0xdc, 0xf5, 0x20, 0xd0, 0xc3, 0x47, 0x17, 0x57, 0xeb, 0x4c, 0xef,
-  0x81, 0x00, 0xc5, 0x10, 0x36, 0x2f, 0x0a, 0x16, 0xc0, 0x2a, 0xfa, 0x4f,
-  0xab, 0xe8, 0xd9, 0x2d, 0xda, 0xdd, 0xa5, 0x0f, 0x08, 0xcd, 0x21, 0x11,
-  0xd7, 0xac, 0x13, 0x1a, 0x4c, 0x2c, 0xda, 0x1a, 0xb7, 0xfb, 0x07, 0x23,
-  0xe2, 0xde, 0x17, 0xeb, 0x1b, 0xfd, 0x22, 0x26, 0x27, 0x08, 0x01, 0xd4,
-  0xb8, 0x19, 0xcb, 0x15, 0xc4, 0x13, 0xd8, 0x21, 0x22, 0x20, 0x3d, 0x3c,
-  0x5c, 0x22, 0x30, 0x37, 0x3d, 0x1d, 0x45, 0xea, 0xf4, 0x53, 0x01, 0xf2,
-  0x66, 0x1b, 0xaa, 0x4e, 0xe0, 0x17, 0x6f, 0x4e, 0xcc, 0xee, 0x12, 0x12,
-  0xdc, 0x30, 0xf1, 0x02, 0x18, 0xd8, 0xce, 0xb0, 0x26, 0xfc, 0xa3, 0xb6,
-  0x60, 0xb3, 0x1d, 0xec, 0xf2, 0xec, 0x38, 0xfc, 0xc3, 0xb6, 0xa0, 0x3c,
-  0xf5, 0x1b, 0x2c, 0x37, 0xed, 0x14, 0x2a, 0x04, 0xe4, 0xfa, 0xda, 0x08,
-  0x10, 0xe5, 0x04, 0x43, 0xda, 0xd1, 0x17, 0x06, 0xf2, 0x0b, 0xe2, 0xc8,
-  0x07, 0x11, 0x22, 0xe4, 0x0e, 0x0f, 0xf8, 0x22, 0xf0, 0xfa, 0x0f, 0x09,
-  0xd6, 0xfd, 0xe0, 0xd7, 0xe0, 0x1d, 0x32, 0xfb, 0x0f, 0x12, 0x3a, 0x05,
-  0x23, 0xc9, 0x26, 0xef, 0xf1, 0x19, 0x0e, 0xee, 0xd2, 0xfb, 0x10, 0xf0,
-  0xfd, 0x25, 0x2c, 0x00, 0x34, 0xfa, 0xf1, 0xfa, 0x81, 0x08, 0x16, 0xc3,
-  0xe4, 0x04, 0xd3, 0xee, 0xd9, 0xe6, 0x41, 0xc7, 0x0a, 0x24, 0xc4, 0xee,
-  0xb2, 0x29, 0xce, 0xfd, 0x44, 0xe9, 0xcd, 0xd5, 0x1a, 0x0c, 0x00, 0x22,
-  0xd5, 0xe4, 0x15, 0x2e, 0x0a, 0x16, 0x34, 0x0a, 0x17, 0xdd, 0x1c, 0x48,
-  0x15, 0x2b, 0xd4, 0xf2, 0x16, 0xfc, 0x9d, 0x0d, 0xd9, 0xec, 0xf4, 0x01,
-  0x47, 0xfc, 0x23, 0xeb, 0x0d, 0x3f, 0xbf, 0x24, 0x46, 0x02, 0x11, 0x03,
-  0x32, 0xf6, 0xeb, 0xd0, 0xf6, 0xc8, 0x06, 0x14, 0x9e, 0xc2, 0xdd, 0x04,
-  0xf8, 0xbb, 0xdc, 0x3b, 0x71, 0xd8, 0x0b, 0xc6, 0x26, 0xed, 0x81, 0xb0,
-  0xef, 0x21, 0x1c, 0x29, 0x25, 0x39, 0x2a, 0x07, 0xfc, 0xf3, 0xb5, 0x0a,
-  0x1b, 0xce, 0xfd, 0xe3, 0x0d, 0x93, 0x07, 0x6e, 0xe5, 0x0a, 0x42, 0xb0,
-  0x07, 0x1d, 0xc9, 0x40, 0x1f, 0x6f, 0x12, 0x46, 0x0f, 0xc2, 0x35, 0x00,
-  0x51, 0xf6, 0x03, 0xed, 0x19, 0xfd, 0x33, 0xf2, 0xc0, 0x9e, 0xfb, 0xcf,
-  0xda, 0xa1, 0xcf, 0x43, 0xce, 0xe5, 0x1e, 0x0e, 0x02, 0xfa, 0xf2, 0xc2,
-  0xe8, 0x25, 0x1e, 0xb9, 0x97, 0xd3, 0x28, 0xbb, 0xec, 0x4c, 0x18, 0x1c,
-  0xfc, 0xd9, 0x26, 0x1e, 0xe4, 0xed, 0x0e, 0xd8, 0xf1, 0xfb, 0x1b, 0x32,
-  0x21, 0xcf, 0xea, 0x53, 0xb3, 0xff, 0xdd, 0x03, 0xaf, 0x50, 0xfe, 0x0f,
-  0x1a, 0x2b, 0x22, 0xc4, 0xf4, 0x0f, 0x9c, 0xdc, 0xea, 0x11, 0x17, 0xdc,
-  0xd6, 0xb6, 0x91, 0x08, 0xe0, 0xf9, 0x21, 0x04, 0x36, 0x09, 0x1c, 0xd6,
-  0x12, 0x0a, 0x81, 0x0a, 0x0b, 0x0d, 0x8f, 0x0b, 0xfa, 0x5c, 0xed, 0x45,
-  0xe6, 0x0d, 0x9e, 0xb8, 0xde, 0x3c, 0xd0, 0x07, 0x2a, 0xe9, 0xd8, 0x36,
-  0xc3, 0x9f, 0xdc, 0x98, 0x0e, 0x5f, 0xe5, 0x1c, 0x05, 0x03, 0x11, 0xce,
-  0x1c, 0x1c, 0xf3, 0xfd, 0x09, 0x35, 0x1b, 0xee, 0xfc, 0xcb, 0x05, 0x25,
-  0xf9, 0x09, 0xe5, 0x48, 0xf9, 0x30, 0xd7, 0x06, 0x1a, 0xdf, 0xb0, 0xec,
-  0x15, 0x0d, 0x48, 0xb0, 0xe7, 0x1c, 0x5a, 0x0c, 0x1e, 0x2c, 0x26, 0x05,
-  0x35, 0x28, 0xe1, 0x29, 0x41, 0x0b, 0x00, 0x70, 0x1e, 0x3f, 0xcf, 0xdb,
-  0xcb, 0xca, 0x5f, 0x79, 0xf8, 0x9e, 0x22, 0x29, 0x07, 0x50, 0xec, 0xf8,
-  0x1d, 0xec, 0x0a, 0xd9, 0xca, 0x03, 0xe0, 0xc2, 0x36, 0xc6, 0xfd, 0x21,
-  0xba, 0x2f, 0x34, 0xf0, 0xec, 0x15, 0xd6, 0xe5, 0xe8, 0xf0, 0x41, 0x16,
-  0x30, 0x38, 0x37, 0x23, 0x25, 0xf9, 0x45, 0xef, 0x18, 0x13, 0x4b, 0x19,
-  0x1c, 0x00, 0x1b, 0xe4, 0xcc, 0x1a, 0xc3, 0x03, 0xfd, 0xe7, 0x4c, 0xee,
-  0x9f, 0x41, 0x3e, 0x9f, 0xef, 0x34, 0xb1, 0x0d, 0x14, 0x40, 0xca, 0x36,
-  0xcc, 0xad, 0xe9, 0xe2, 0xda, 0xd9, 0xd8, 0xc6, 0x06, 0x29, 0x2c, 0xea,
-  0xf2, 0x1b, 0xe3, 0xe9, 0xf7, 0xea, 0xf9, 0xff, 0x32, 0x08, 0x1b, 0xbf,
-  0xfd, 0xbf, 0x16, 0x37, 0x0c, 0xe6, 0xd3, 0xf3, 0xf6, 0xfd, 0x30, 0x92,
-  0xc0, 0xe1, 0x00, 0xc2, 0xd3, 0xc2, 0xb0, 0x48, 0x2a, 0xea, 0x38, 0x90,
-  0x02, 0xae, 0x81, 0xc4, 0x79, 0xf5, 0x1a, 0xc2, 0xe1, 0x2f, 0x3a, 0xed,
-  0xf5, 0xf2, 0xda, 0x72, 0x2c, 0x1c, 0x11, 0x37, 0xd5, 0x17, 0x10, 0x17,
-  0xf2, 0x67, 0xf9, 0xec, 0x70, 0xf5, 0x7f, 0x09, 0x4e, 0x2b, 0x2c, 0x4e,
-  0xd7, 0xc3, 0x15, 0x06, 0x3f, 0x13, 0x22, 0x0d, 0xd9, 0x11, 0x1c, 0x14,
-  0xda, 0x46, 0x00, 0xec, 0xc3, 0xd6, 0xf7, 0x16, 0x3a, 0x25, 0xfe, 0xfb,
-  0x43, 0x0c, 0x2c, 0x2f, 0x2b, 0x64, 0xcb, 0x0b, 0xb9, 0x11, 0x49, 0xfb,
-  0x40, 0xf0, 0x93, 0x1a, 0xfe, 0xb3, 0xd0, 0xdf, 0x19, 0x29, 0xfc, 0x1a,
-  0x13, 0xa1, 0xe1, 0x59, 0xed, 0xdc, 0x28, 0x1c, 0x11, 0xfb, 0x07, 0x39,
-  0x25, 0x1e, 0xfb, 0x21, 0xcc, 0xef, 0x09, 0x08, 0x9c, 0xb0, 0x26, 0xa5,
-  0x45, 0xee, 0xb3, 0xe1, 0x1d, 0x2e, 0x15, 0x7f, 0xf0, 0x2e, 0xfe, 0x0e,
-  0xa3, 0x33, 0xfc, 0x22, 0xf5, 0xbb, 0xd1, 0x17, 0x08, 0x0a, 0xcc, 0x8a,
-  0x06, 0x29, 0xe8, 0xe5, 0x0e, 0x5d, 0x44, 0xd1, 0xec, 0xf9, 0xee, 0x28,
-  0xa6, 0xff, 0xfd, 0xef, 0x2d, 0xf8, 0xd7, 0x3c, 0xeb, 0xc7, 0x11, 0xe1,
-  0xe2, 0xc2, 0xf7, 0x25, 0xf3, 0xf8, 0x39, 0x51, 0x00, 0x2a, 0x11, 0x36,
-  0x15, 0x25, 0x36, 0x21, 0x1a, 0x38, 0x1d, 0x23, 0x38, 0xc2, 0x20, 0x01,
-  0x47, 0xd5, 0x0c, 0x42, 0xdd, 0xf7, 0x5a, 0xf4, 0xd9, 0xbb, 0xd1, 0xe4,
-  0x08, 0x0d, 0xf7, 0xfb, 0xe8, 0xe0, 0xf2, 0x0a, 0xe3, 0x00, 0x36, 0x10,
-  0x1f, 0x23, 0x0f, 0x03, 0x1c, 0x15, 0xd4, 0x16, 0x15, 0x1c, 0xb8, 0xfa,
-  0xd2, 0xf5, 0x1c, 0x1e, 0xe9, 0xce, 0x09, 0xf9, 0xe7, 0x02, 0xea, 0xc9,
-  0xc3, 0xd6, 0xb2, 0x46, 0xed, 0x04, 0x57, 0x51, 0xf0, 0x0f, 0x63, 0xfc,
-  0x13, 0x07, 0xf4, 0x07, 0xf6, 0x31, 0x06, 0xff, 0x74, 0xdd, 0x3b, 0x09,
-  0x1a, 0xfd, 0xb9, 0x1a, 0xe9, 0xf1, 0x3a, 0x0d, 0xac, 0x13, 0x13, 0xf0,
-  0x08, 0x06, 0x02, 0xb2, 0x29, 0x04, 0xec, 0xf5, 0x03, 0xdd, 0x62, 0x19,
-  0x7f, 0xfa, 0xd3, 0xf4, 0xb6, 0x1c, 0x28, 0x1d, 0xe7, 0x48, 0xb6, 0xb4,
-  0x2f, 0x0f, 0xc3, 0x41, 0x12, 0xf2, 0xa8, 0x13, 0xf9, 0x27, 0xfe, 0xb9,
-  0x19, 0x17, 0xbb, 0xea, 0x33, 0x0b, 0xf9, 0x03, 0x0e, 0x00, 0xf3, 0x3c,
-  0xe1, 0xee, 0x28, 0x41, 0x25, 0xc8, 0x14, 0x10, 0xf6, 0xf2, 0xd1, 0xdb,
-  0xde, 0xf7, 0x2f, 0xff, 0x21, 0x2a, 0xd6, 0x35, 0x9b, 0x81, 0xd2, 0xe9,
-  0x15, 0x62, 0x2f, 0xcb, 0xd0, 0x36, 0x38, 0xe4, 0x1d, 0x06, 0xc2, 0x20,
-  0x05, 0x12, 0xfe, 0xf6, 0xdc, 0xf6, 0xe3, 0xc5, 0x14, 0xe5, 0xc1, 0x3b,
-  0x09, 0xf1, 0xf1, 0xbe, 0x15, 0x18, 0x06, 0xe9, 0x0c, 0xdf, 0xe2, 0xa2,
-  0xf5, 0xf0, 0xdd, 0x06, 0xfd, 0xbf, 0xf5, 0xee, 0x33, 0x0e, 0x18, 0xb9,
-  0xf4, 0x10, 0x0d, 0x2b, 0xe4, 0x3e, 0x0b, 0x07, 0xb4, 0xfc, 0xb7, 0xde,
-  0x98, 0x49, 0xfc, 0xd7, 0xf3, 0xe2, 0x0c, 0x37, 0xde, 0x34, 0xdb, 0x36,
-  0xef, 0xe5, 0xdc, 0xf2, 0xff, 0xd2, 0xe6, 0xfc, 0x7b, 0x26, 0xf6, 0x1c,
-  0xf4, 0x06, 0xee, 0x23, 0xce, 0xf6, 0x51, 0xef, 0xc8, 0xe0, 0x51, 0xe9,
-  0xb1, 0xdf, 0xd6, 0x7f, 0xea, 0x20, 0xd8, 0xe9, 0x1e, 0x45, 0xf5, 0xfe,
-  0xf4, 0x14, 0x11, 0xfe, 0x05, 0x39, 0x1e, 0xd5, 0xfb, 0x02, 0x1b, 0x1a,
-  0xe3, 0x14, 0xfd, 0xfb, 0x1b, 0xfb, 0xcd, 0xea, 0x19, 0x13, 0x04, 0xbd,
-  0xff, 0x28, 0xca, 0x12, 0x38, 0x1b, 0x97, 0xad, 0x1b, 0x5c, 0x92, 0xe7,
-  0x60, 0x00, 0x54, 0xe9, 0xd5, 0x0c, 0xdd, 0xd8, 0xd6, 0xb6, 0xbd, 0xfc,
-  0xbb, 0xf3, 0xd2, 0xff, 0x09, 0xfd, 0x93, 0x29, 0xf9, 0x1e, 0x16, 0xe0,
-  0x26, 0xf9, 0x10, 0xd8, 0x15, 0x07, 0xee, 0x4c, 0xc5, 0xd7, 0xfa, 0x02,
-  0x05, 0x2f, 0x1a, 0xd5, 0x18, 0xdf, 0x12, 0x0a, 0x37, 0x28, 0xa5, 0xe3,
-  0x27, 0xf9, 0x11, 0x58, 0xf8, 0x35, 0xda, 0xec, 0x00, 0xc9, 0xde, 0x11,
-  0x1e, 0xfd, 0xce, 0x31, 0x1b, 0x3d, 0xee, 0xdd, 0x16, 0x2f, 0x15, 0xbc,
-  0xc6, 0x05, 0x23, 0x1c, 0xc8, 0xdb, 0xfc, 0xe3, 0xf9, 0x1f, 0x04, 0x12,
-  0xe6, 0xe6, 0xcf, 0xeb, 0x2e, 0x27, 0xc9, 0xeb, 0x7f, 0x1e, 0xc5, 0x10,
-  0x12, 0x12, 0x9d, 0xf2, 0x33, 0x2a, 0x3b, 0x17, 0x14, 0x03, 0xe2, 0x0a,
-  0xd9, 0x21, 0xf1, 0x19, 0x09, 0x08, 0x10, 0xd1, 0xf2, 0x01, 0x0d, 0x19,
-  0x13, 0x24, 0x9c, 0xfb, 0x17, 0x33, 0x17, 0x02, 0x1e, 0xee, 0x06, 0x26,
-  0xc1, 0x28, 0xc8, 0xd1, 0x06, 0xf2, 0xc0, 0xfb, 0xec, 0xdf, 0x04, 0xe4,
-  0x22, 0xb3, 0xf4, 0x2b, 0xd0, 0x08, 0x0f, 0xe6, 0x2b, 0xfe, 0xfe, 0x19,
-  0x01, 0xe6, 0x1e, 0x1c, 0xc5, 0xb7, 0x31, 0x04, 0x21, 0x0b, 0x16, 0x07,
-  0xf7, 0xed, 0xf2, 0xd9, 0x11, 0x22, 0xd7, 0xdc, 0x10, 0xff, 0xee, 0x4e,
-  0x0d, 0x22, 0xf1, 0x2f, 0x00, 0x23, 0xe5, 0x0b, 0x29, 0x19, 0xdc, 0x38,
-  0xe9, 0x2c, 0xff, 0xd9, 0x45, 0x33, 0xe5, 0xfc, 0x00, 0xfa, 0x26, 0xfe,
-  0x02, 0xfc, 0x0d, 0x1e, 0x2c, 0x34, 0x07, 0x1d, 0x00, 0xd4, 0x0d, 0x36,
-  0x32, 0x1a, 0x01, 0x23, 0xd1, 0xc3, 0x9c, 0xde, 0x09, 0x14, 0xfd, 0xc0,
-  0xf7, 0x16, 0xd8, 0xd7, 0xe5, 0xf2, 0xd7, 0x26, 0xef, 0xde, 0x00, 0x1f,
-  0xf1, 0x33, 0xea, 0x34, 0x0f, 0xb0, 0xf7, 0x3b, 0xc2, 0x17, 0xd0, 0x38,
-  0xd6, 0xee, 0x7f, 0xac, 0xd7, 0xd6, 0xeb, 0x53, 0xda, 0xb7, 0xdf, 0xd6,
-  0x0b, 0x31, 0xe7, 0xcf, 0x5c, 0x2c, 0x01, 0xcc, 0xfe, 0x28, 0x03, 0xfb,
-  0xd1, 0x63, 0xd8, 0x0c, 0xea, 0xf4, 0xd7, 0xb3, 0x10, 0x99, 0x1e, 0xf5,
-  0xf2, 0xf8, 0xcb, 0x51, 0xe6, 0x07, 0xea, 0xd1, 0x08, 0xfd, 0xd1, 0x2b,
-  0x20, 0x0b, 0xcb, 0xce, 0x51, 0x2f, 0x05, 0x09, 0xe3, 0xfb, 0x0e, 0x0d,
-  0x1c, 0xd9, 0xe4, 0xf1, 0xf4, 0x21, 0x1b, 0x1b, 0xdf, 0x3f, 0x20, 0xdb,
-  0xd6, 0xe9, 0x25, 0x8e, 0x18, 0x29, 0x25, 0xf9, 0x0d, 0x34, 0x08, 0xf7,
-  0xfe, 0xe6, 0x08, 0x70, 0x40, 0x08, 0x24, 0x20, 0xeb, 0xd4, 0x11, 0xdb,
-  0x21, 0x08, 0xda, 0xd1, 0xee, 0x00, 0x0b, 0x32, 0xe1, 0x0f, 0xe7, 0x20,
-  0xf8, 0x2c, 0xf5, 0xf9, 0xee, 0x17, 0x1a, 0x20, 0xe3, 0xdb, 0xe9, 0x06,
-  0x08, 0x0b, 0x99, 0x12, 0x19, 0xe8, 0xfa, 0xd4, 0x1c, 0x15, 0xcc, 0xe3,
-  0x0f, 0xdc, 0x17, 0x08, 0x05, 0x04, 0x26, 0x3c, 0x0c, 0xce, 0xc3, 0xf8,
-  0x03, 0xca, 0xcd, 0xe9, 0xed, 0x8b, 0x4e, 0xe2, 0xd0, 0xe0, 0x97, 0xa7,
-  0xdb, 0xde, 0xd0, 0x0f, 0xe0, 0x25, 0x6d, 0xda, 0x05, 0xbc, 0xf4, 0x04,
-  0x7f, 0x04, 0x2f, 0xfc, 0xe2, 0x09, 0xff, 0xf1, 0xc0, 0x02, 0xd8, 0x37,
-  0xea, 0x0c, 0x09, 0x50, 0xe9, 0x10, 0xd9, 0x04, 0x00, 0x43, 0x1e, 0xe6,
-  0x46, 0x2d, 0x63, 0xf9, 0x2a, 0x07, 0x16, 0x07, 0xec, 0xe3, 0x1b, 0xa8,
-  0x16, 0xff, 0x04, 0x1b, 0xcc, 0xd5, 0xae, 0x42, 0x10, 0xa0, 0xe0, 0x53,
-  0x23, 0x2b, 0xcc, 0x20, 0x24, 0x07, 0x13, 0x37, 0x27, 0x12, 0xeb, 0x24,
-  0x08, 0xf9, 0x20, 0xf5, 0xe2, 0xdf, 0x23, 0x24, 0xe6, 0xad, 0xc1, 0xbc,
-  0xe9, 0x0a, 0x14, 0xc0, 0x12, 0xe0, 0x03, 0x2e, 0x06, 0xf5, 0x29, 0xde,
-  0xe3, 0x3c, 0xdc, 0xe1, 0x22, 0x83, 0x9c, 0x1d, 0x09, 0x63, 0x7f, 0xa7,
-  0xea, 0x39, 0x3e, 0x09, 0xfd, 0x39, 0x0f, 0xf2, 0xa0, 0x00, 0x0a, 0x03,
-  0xc8, 0x13, 0xfb, 0x2e, 0xbc, 0xfd, 0x0a, 0x0f, 0x73, 0xe7, 0xe5, 0x27,
-  0xe1, 0xd7, 0x10, 0x02, 0xb7, 0x20, 0x4b, 0x36, 0xe4, 0xfc, 0x5f, 0xd0,
-  0xf5, 0xa5, 0x18, 0x26, 0xfb, 0x09, 0x67, 0xcd, 0x18, 0xf6, 0x0d, 0x3d,
-  0xb0, 0x2b, 0xef, 0x62, 0x2f, 0xd5, 0x2b, 0xf5, 0x23, 0x23, 0xed, 0xef,
-  0xe6, 0x1e, 0x32, 0x05, 0x07, 0x61, 0x0f, 0x70, 0xe5, 0x22, 0xc7, 0x60,
-  0x5b, 0x15, 0xf6, 0xd8, 0xff, 0x26, 0x33, 0x30, 0xe9, 0xee, 0x12, 0x3a,
-  0x3c, 0xe1, 0x3a, 0xc5, 0xe8, 0xdf, 0x0f, 0xe0, 0xec, 0x2b, 0x5a, 0xd0,
-  0xba, 0x41, 0xda, 0xe8, 0xa6, 0xfc, 0xfb, 0xec, 0xf5, 0x1e, 0x36, 0x3f,
-  0xac, 0xf1, 0x5a, 0xcd, 0x74, 0xed, 0x4a, 0x37, 0xcf, 0xcb, 0x0c, 0x6b,
-  0x20, 0x81, 0x47, 0x92, 0x04, 0x04, 0xb4, 0x55, 0xc2, 0x01, 0x32, 0xd2,
-  0x0e, 0xf0, 0x43, 0xde, 0x76, 0x15, 0xfc, 0x1e, 0xfb, 0x02, 0xd8, 0x27,
-  0x15, 0xe5, 0x4b, 0xc0, 0x40, 0xde, 0xc9, 0xa1, 0xf8, 0xd8, 0xff, 0xdc,
-  0x9b, 0x11, 0xce, 0x9b, 0x2e, 0xac, 0xa9, 0x26, 0xc4, 0xe2, 0x0a, 0x69,
-  0x06, 0xf1, 0x04, 0x8e, 0xd5, 0xa7, 0x24, 0x4f, 0x0e, 0xf7, 0x1e, 0xac,
-  0x09, 0xfd, 0x23, 0x9c, 0xdf, 0xdf, 0x36, 0xdb, 0xd4, 0xd6, 0xb9, 0xe1,
-  0x00, 0x63, 0x1f, 0x10, 0x1b, 0xf1, 0x25, 0xf3, 0x04, 0x06, 0x1b, 0xc0,
-  0xa8, 0xfe, 0x13, 0xfd, 0xe4, 0x17, 0xfe, 0x95, 0x3c, 0x5e, 0xe6, 0xcb,
-  0x16, 0xff, 0x0d, 0xef, 0x1a, 0xde, 0x02, 0xcf, 0xf6, 0xf6, 0xbc, 0xc8,
-  0x22, 0xdd, 0x46, 0xf9, 0x7f, 0x33, 0x32, 0xfa, 0xf9, 0xd2, 0x13, 0x1b,
-  0x40, 0x27, 0xda, 0x00, 0xf4, 0x0d, 0xdf, 0xdc, 0xf5, 0xb8, 0x0c, 0xfa,
-  0xfe, 0x03, 0xf3, 0x59, 0xb2, 0xde, 0x1b, 0xb0, 0x10, 0xd4, 0x30, 0x37,
-  0x0d, 0xb1, 0x08, 0x00, 0x13, 0x0d, 0x02, 0x66, 0x15, 0x06, 0xfd, 0xea,
-  0xfb, 0x3e, 0x03, 0x02, 0x1c, 0xea, 0xf1, 0x14, 0x0e, 0x06, 0x2d, 0x14,
-  0x1a, 0xf5, 0x0d, 0x09, 0x33, 0xf0, 0x4b, 0x0d, 0x2d, 0xec, 0x06, 0x06,
-  0x1f, 0xe0, 0x34, 0x26, 0x2e, 0xe8, 0xa4, 0xf1, 0xc5, 0x21, 0x44, 0xd7,
-  0xfa, 0x0d, 0x06, 0x0a, 0xc0, 0xf4, 0x12, 0x14, 0xe7, 0xf0, 0x0c, 0x39,
-  0xd4, 0x0a, 0x10, 0xf9, 0x0f, 0xde, 0x37, 0x05, 0xf8, 0xcc, 0xf9, 0xbd,
-  0xbe, 0x07, 0x29, 0xde, 0x31, 0x2e, 0x0c, 0x0e, 0xea, 0x19, 0xfe, 0xe2,
-  0x36, 0x3a, 0xf5, 0x2e, 0xc5, 0x19, 0x0f, 0xe8, 0x29, 0xf2, 0xce, 0xfa,
-  0x23, 0xdc, 0xdf, 0x0f, 0x07, 0x0c, 0xef, 0x1f, 0xd2, 0xe6, 0x1d, 0x15,
-  0xcf, 0xdc, 0x10, 0x20, 0x17, 0xdf, 0x1c, 0x09, 0x21, 0x20, 0xee, 0x15,
-  0x15, 0xe4, 0xdb, 0xc4, 0xd5, 0xc5, 0x40, 0x81, 0xf3, 0xd7, 0xb4, 0xe5,
-  0xe8, 0x2d, 0x41, 0x15, 0x3b, 0xf1, 0xff, 0xb5, 0x0f, 0x2d, 0xe7, 0xfd,
-  0x0e, 0xaa, 0x0f, 0xb2, 0x54, 0xc6, 0xc6, 0x14, 0x2e, 0xed, 0x17, 0xc5,
-  0xf2, 0x2a, 0xe9, 0x02, 0xfe, 0xf9, 0xfb, 0x21, 0xf8, 0xe1, 0xde, 0xc8,
-  0xfc, 0xea, 0x17, 0xd9, 0xd1, 0x08, 0xa2, 0xf1, 0xe1, 0xed, 0x4a, 0x22,
-  0xf8, 0x02, 0x1c, 0x38, 0x6a, 0x1e, 0xdb, 0xd1, 0x13, 0xb8, 0xf9, 0xe6,
-  0xdd, 0xcb, 0xe9, 0x1f, 0xdc, 0xec, 0x81, 0x34, 0xc1, 0xf8, 0xee, 0x2a,
-  0x35, 0xe9, 0xd7, 0xd4, 0x22, 0xe6, 0x14, 0xfc, 0xc4, 0x47, 0xed, 0x0f,
-  0x31, 0xe5, 0xd7, 0x10, 0xe8, 0x17, 0xf9, 0x4e, 0xe3, 0x06, 0xf9, 0x0a,
-  0xe3, 0x06, 0x2e, 0xc4, 0xf3, 0x06, 0x34, 0x02, 0xf8, 0x57, 0x12, 0x15,
-  0x0a, 0xe2, 0x23, 0x1c, 0xd6, 0x2c, 0x2e, 0xff, 0x2a, 0x3f, 0xf6, 0x11,
-  0xe6, 0x27, 0xcb, 0xd0, 0xfd, 0xfc, 0xe3, 0x12, 0xf7, 0xb8, 0x13, 0x45,
-  0x0d, 0xf6, 0x0b, 0x16, 0x16, 0x24, 0xdc, 0xac, 0xc5, 0xcb, 0xd5, 0x06,
-  0xfc, 0x46, 0x01, 0xc6, 0xca, 0x1a, 0x46, 0x02, 0xcc, 0xeb, 0xce, 0xfe,
-  0x0d, 0x0f, 0x06, 0xcd, 0xcc, 0xc0, 0x12, 0xde, 0x2d, 0x35, 0x28, 0x1d,
-  0xd3, 0x03, 0x10, 0xf9, 0xe1, 0x38, 0x19, 0xc9, 0xe4, 0xf7, 0xf1, 0xff,
-  0xf2, 0xd8, 0xc5, 0xde, 0x02, 0x35, 0xe4, 0xc7, 0x20, 0x29, 0x10, 0x4c,
-  0x0c, 0x29, 0xdd, 0x22, 0x0d, 0xcd, 0xfe, 0xd0, 0xd2, 0x06, 0x05, 0x2c,
-  0xba, 0x4d, 0x10, 0xed, 0xce, 0x15, 0xef, 0x29, 0xfa, 0x61, 0x22, 0xc0,
-  0x37, 0x01, 0x15, 0x48, 0xc1, 0x8d, 0xe2, 0xbf, 0xf9, 0x71, 0xd9, 0x0c,
-  0xde, 0xf1, 0xd5, 0xd4, 0x3f, 0xe3, 0x38, 0x33, 0xfa, 0x19, 0x1a, 0x16,
-  0xc1, 0x47, 0x2b, 0x24, 0xcc, 0xb9, 0x32, 0x62, 0xf3, 0x45, 0xf4, 0x0b,
-  0x52, 0xeb, 0xe5, 0xff, 0xff, 0xe3, 0x7f, 0xf8, 0xc0, 0x43, 0x34, 0x3e,
-  0x0f, 0xd5, 0x28, 0xf0, 0x1f, 0xe8, 0xd1, 0x16, 0x27, 0x68, 0x68, 0x18,
-  0xe0, 0x08, 0xce, 0x1f, 0xeb, 0x09, 0x24, 0x56, 0xb7, 0xf5, 0x04, 0x00,
-  0xf2, 0x22, 0x48, 0xf3, 0xe1, 0x4b, 0x16, 0x30, 0x06, 0xf9, 0xde, 0x3a,
-  0x29, 0xc5, 0x06, 0x2b, 0x09, 0xfc, 0x24, 0x0f, 0xef, 0x34, 0x06, 0x17,
-  0xd9, 0xd3, 0xc2, 0xec, 0xf1, 0xc3, 0x18, 0xfe, 0x06, 0xec, 0xf5, 0x0f,
-  0xdd, 0xe4, 0xef, 0xbf, 0x23, 0xf9, 0x16, 0xff, 0xd0, 0x1a, 0xf4, 0x29,
-  0x2a, 0x0f, 0xe9, 0x17, 0x22, 0xc5, 0xd9, 0x16, 0xfb, 0xfa, 0xce, 0xe8,
-  0xec, 0x01, 0xfd, 0x2d, 0x2d, 0xf7, 0xff, 0x0b, 0xf9, 0xf9, 0xf1, 0x31,
-  0x2a, 0x3c, 0x01, 0xe5, 0xef, 0xed, 0xca, 0x00, 0x0d, 0xf0, 0x2a, 0x10,
-  0x1d, 0x0a, 0x36, 0xe2, 0xf6, 0xe1, 0x1f, 0x15, 0xd7, 0x02, 0x2c, 0xf5,
-  0xe7, 0x15, 0xe5, 0x0a, 0xfb, 0x04, 0xf7, 0x32, 0x12, 0x13, 0x04, 0x03,
-  0xe0, 0x2b, 0xf2, 0x14, 0x19, 0xf4, 0x0c, 0xf6, 0xfd, 0x07, 0x7f, 0x15,
-  0xde, 0xde, 0x1c, 0xfb, 0xdb, 0x13, 0x25, 0xf0, 0x1c, 0x29, 0xd5, 0x18,
-  0xed, 0xdb, 0x2b, 0xe4, 0x0f, 0xee, 0x02, 0xf6, 0x00, 0x09, 0xf8, 0xc2,
-  0xec, 0xf7, 0xee, 0xc9, 0xf9, 0xea, 0xf9, 0x23, 0x14, 0x26, 0x0f, 0x29,
-  0xda, 0x13, 0xd6, 0xc9, 0x2b, 0x81, 0xce, 0x53, 0x02, 0xff, 0x0f, 0xe5,
-  0x1c, 0x07, 0xf3, 0x0a, 0xea, 0x51, 0x27, 0x18, 0xf3, 0xf8, 0x16, 0xea,
-  0xfe, 0x00, 0xf7, 0xdb, 0xeb, 0xfd, 0xb7, 0xe5, 0x1f, 0xf1, 0xef, 0x11,
-  0x01, 0x29, 0x04, 0xfd, 0xd8, 0x25, 0xec, 0xf0, 0xd9, 0xdc, 0x21, 0xe5,
-  0xdf, 0xdf, 0xb5, 0x01, 0xfd, 0x1d, 0x55, 0x1b, 0xef, 0xfb, 0x12, 0x36,
-  0x18, 0x87, 0xde, 0xf4, 0x9b, 0xd9, 0x13, 0x26, 0xd3, 0xf8, 0xc4, 0xc5,
-  0xbe, 0xed, 0x11, 0xcd, 0xfb, 0xf3, 0x14, 0x45, 0xf3, 0xfa, 0xd4, 0xed,
-  0x47, 0xe6, 0xdc, 0xe0, 0xe3, 0x05, 0x06, 0x2b, 0xfd, 0xfd, 0x2e, 0xf2,
-  0x16, 0xc5, 0x28, 0xf9, 0x06, 0xf4, 0xe6, 0xfd, 0xcf, 0x39, 0x28, 0x07,
-  0x34, 0xeb, 0x07, 0x1d, 0x24, 0xfa, 0x27, 0xce, 0x29, 0x3e, 0xf8, 0x18,
-  0xe8, 0x1f, 0xf3, 0x0f, 0xc7, 0xf1, 0xb9, 0xcd, 0x11, 0xc0, 0xfa, 0x05,
-  0x38, 0xf2, 0xf6, 0xd5, 0x04, 0x03, 0xdc, 0x11, 0x00, 0x16, 0xf3, 0xfd,
-  0xdb, 0x32, 0x24, 0x08, 0x1e, 0x1c, 0xe2, 0x05, 0xc7, 0x3b, 0x08, 0xb3,
-  0x09, 0xda, 0x07, 0x06, 0xdf, 0xf4, 0x0b, 0xf8, 0x18, 0x1a, 0xd5, 0xf9,
-  0x02, 0x16, 0x07, 0x3b, 0x04, 0x5b, 0xdd, 0xd8, 0xfa, 0x1d, 0xd4, 0x03,
-  0xc4, 0x4b, 0x3e, 0xf6, 0x27, 0xfc, 0x11, 0x3c, 0x03, 0xd1, 0x11, 0x0f,
-  0x03, 0xfd, 0xff, 0x0a, 0x0d, 0x31, 0xf3, 0xde, 0xc0, 0x14, 0xe8, 0x45,
-  0x03, 0xe3, 0xfb, 0x0b, 0xd6, 0x20, 0xe8, 0x14, 0x8b, 0xdd, 0x16, 0x19,
-  0xb3, 0x06, 0x1b, 0xe9, 0x00, 0x81, 0xd8, 0x2e, 0xf2, 0x2f, 0x51, 0x2b,
-  0x29, 0x33, 0xf0, 0x09, 0x06, 0xca, 0x28, 0x08, 0x23, 0xed, 0xd5, 0xfe,
-  0x4f, 0x39, 0xf3, 0x03, 0x1d, 0x3c, 0xf4, 0xe8, 0x1a, 0x03, 0x81, 0xf0,
-  0xfb, 0xd1, 0xe0, 0x02, 0xe2, 0x0b, 0xe3, 0xf4, 0x1b, 0x1e, 0x1c, 0xa8,
-  0xd8, 0xea, 0x28, 0x35, 0xf0, 0xe1, 0x0a, 0x2d, 0xde, 0x0d, 0x4d, 0xd8,
-  0x19, 0x0b, 0xfd, 0x06, 0x31, 0x07, 0x3d, 0x02, 0x06, 0x4d, 0x3a, 0xcf,
-  0xbf, 0xd8, 0xeb, 0xfe, 0xe7, 0x07, 0xeb, 0x0a, 0x20, 0xd7, 0xfd, 0x1a,
-  0x26, 0xed, 0x08, 0x27, 0x05, 0xae, 0x1c, 0xc3, 0x04, 0x24, 0xf0, 0x0d,
-  0xb1, 0x1d, 0xc7, 0xed, 0x0f, 0x26, 0x2f, 0xbf, 0x1f, 0xee, 0x09, 0xe9,
-  0x62, 0x1c, 0xe6, 0x54, 0x19, 0x18, 0x05, 0x12, 0x09, 0xd7, 0xc8, 0xc8,
-  0xda, 0xad, 0xe7, 0x36, 0x1e, 0xd7, 0x2d, 0xf8, 0xbc, 0x08, 0xef, 0x19,
-  0x25, 0xe1, 0x10, 0xfb, 0x12, 0xe7, 0xdd, 0xd8, 0xd9, 0xf9, 0x1f, 0xc4,
-  0x11, 0xff, 0xc9, 0x27, 0xc6, 0xf6, 0x07, 0x17, 0xcf, 0xfa, 0xd7, 0x22,
-  0xc7, 0x3a, 0x0c, 0xc3, 0xc9, 0x81, 0x36, 0x17, 0xe1, 0xd7, 0x39, 0x3f,
-  0xa9, 0xf2, 0x5e, 0x6f, 0xdc, 0xc1, 0x0b, 0x44, 0xec, 0x1b, 0x14, 0xf3,
-  0xf1, 0xf8, 0x2d, 0x14, 0x48, 0x16, 0xd2, 0x62, 0x33, 0xe4, 0x01, 0x00,
-  0xe5, 0xf6, 0xe1, 0xaa, 0xca, 0xb9, 0x1c, 0xcd, 0x15, 0xbd, 0xc1, 0xfd,
-  0xae, 0xc8, 0x07, 0xd7, 0xeb, 0xf9, 0xe3, 0xb6, 0xe0, 0x00, 0xf2, 0x16,
-  0x7e, 0x0f, 0xb9, 0x1d, 0x42, 0xfc, 0xc9, 0x8b, 0xd9, 0xee, 0x16, 0x33,
-  0xe2, 0x40, 0xee, 0xee, 0xb4, 0x47, 0xd3, 0xc7, 0x4a, 0xf0, 0x0e, 0xfa,
-  0x21, 0xe8, 0xd3, 0xa8, 0xfb, 0x26, 0x09, 0xe3, 0x1a, 0xbe, 0xbf, 0x0d,
-  0xb9, 0x14, 0x16, 0x30, 0x30, 0x10, 0x43, 0xc0, 0xee, 0x00, 0x3d, 0xe2,
-  0x03, 0xe8, 0x08, 0x2e, 0xcb, 0x0b, 0x21, 0xf3, 0x06, 0xfe, 0x0e, 0xcb,
-  0xc5, 0xb0, 0xe8, 0x57, 0xf3, 0x4d, 0xfc, 0x37, 0x2e, 0xf3, 0x55, 0x2b,
-  0xbe, 0xc7, 0xf9, 0xfc, 0xe0, 0xaa, 0x18, 0x00, 0x3c, 0x73, 0x1c, 0xeb,
-  0x03, 0x03, 0x1d, 0x65, 0x0e, 0xec, 0x25, 0x4f, 0xf8, 0xbe, 0x77, 0xa2,
-  0xdf, 0xd0, 0x24, 0xcb, 0x71, 0x0a, 0x45, 0xe7, 0xfb, 0xd8, 0x1a, 0x28,
-  0x81, 0xfb, 0xdf, 0x10, 0x2e, 0x43, 0x3e, 0x3c, 0x21, 0x90, 0x30, 0xec,
-  0x32, 0xde, 0xe3, 0xb0, 0x14, 0xee, 0xc3, 0xb9, 0x06, 0x30, 0xb8, 0xba,
-  0xe9, 0xd0, 0xec, 0xb7, 0x0c, 0x4a, 0xf4, 0x15, 0xe8, 0x0f, 0xcf, 0x22,
-  0x27, 0x04, 0x9e, 0xda, 0xe7, 0xd5, 0x27, 0xe4, 0xb3, 0x24, 0x0e, 0xea,
-  0xbb, 0x9f, 0xac, 0x2b, 0x03, 0x1f, 0x48, 0xd4, 0x4e, 0x98, 0xf3, 0xa5,
-  0x02, 0x20, 0x17, 0xea, 0xdf, 0x10, 0xf4, 0x03, 0x00, 0x2b, 0xef, 0x05,
-  0x11, 0x2f, 0x33, 0x49, 0xf1, 0xfd, 0xd1, 0x1b, 0xb3, 0x23, 0x26, 0x1b,
-  0x54, 0x0f, 0x25, 0x00, 0xfc, 0xfa, 0x3d, 0x16, 0xf2, 0xe5, 0x1b, 0xb3,
-  0x35, 0xe1, 0x14, 0x44, 0xfa, 0x53, 0x2f, 0xb0, 0x20, 0xf0, 0xe8, 0xf7,
-  0x41, 0x38, 0x2b, 0xea, 0xec, 0x1b, 0xaa, 0xd6, 0xbf, 0x2e, 0xf8, 0xf5,
-  0x9a, 0xdf, 0x13, 0xc5, 0xd3, 0x27, 0xa7, 0xe9, 0xeb, 0x5a, 0xf4, 0x1c,
-  0x2d, 0x46, 0x0c, 0x43, 0xd9, 0xd9, 0x1a, 0x34, 0xf0, 0x42, 0x0b, 0xf3,
-  0x2f, 0x18, 0x37, 0xf5, 0x40, 0x44, 0xdd, 0xd9, 0xd2, 0x05, 0x1a, 0x14,
-  0x24, 0xed, 0xed, 0x73, 0xdf, 0x02, 0xe2, 0xfc, 0xe0, 0x25, 0x0b, 0xe7,
-  0x17, 0xe6, 0x08, 0xd7, 0x33, 0x07, 0x08, 0x06, 0x52, 0xb6, 0xa8, 0x23,
-  0x0d, 0x1b, 0x66, 0xcd, 0x17, 0xd3, 0x23, 0x22, 0x2d, 0x00, 0xcc, 0xd7,
-  0x81, 0xcf, 0xce, 0x4e, 0x19, 0x20, 0xd8, 0x4b, 0x56, 0x36, 0x3e, 0xff,
-  0xf9, 0x0b, 0xe5, 0x30, 0xd8, 0x75, 0xcb, 0xb8, 0x0a, 0x27, 0x09, 0x2f,
-  0x43, 0x31, 0x1e, 0x30, 0x08, 0xb8, 0x27, 0xf6, 0x31, 0xe5, 0xf4, 0xd5,
-  0xe6, 0x0b, 0xdf, 0xcf, 0x26, 0xce, 0xe7, 0xed, 0xe6, 0xe4, 0xe3, 0x00,
-  0xfd, 0xc5, 0xeb, 0xd6, 0x24, 0x0e, 0xae, 0x07, 0xaf, 0xcf, 0x1d, 0xe9,
-  0x0b, 0xef, 0x17, 0x0e, 0x15, 0xfe, 0x28, 0x09, 0xfc, 0x2b, 0xd8, 0xc1,
-  0xd6, 0xe7, 0xe5, 0xf8, 0x10, 0x1b, 0x0d, 0xde, 0xf1, 0x1e, 0x20, 0x0c,
-  0xd4, 0xe2, 0xf4, 0x03, 0xf1, 0x3b, 0x36, 0xe3, 0xf9, 0x40, 0x49, 0x09,
-  0x32, 0x1f, 0xee, 0xd2, 0x0f, 0x1b, 0xd5, 0x20, 0x0b, 0xeb, 0xf5, 0x10,
-  0xf1, 0xfe, 0x23, 0xf7, 0x07, 0xf4, 0xf9, 0x34, 0xbf, 0xd5, 0x15, 0x34,
-  0xe5, 0xef, 0x48, 0x26, 0x11, 0x15, 0x09, 0xfe, 0xfe, 0xc9, 0x03, 0x38,
-  0xda, 0x02, 0x12, 0xef, 0x7f, 0x26, 0x3f, 0xe1, 0xe3, 0x36, 0x2e, 0x21,
-  0x2e, 0xf7, 0x36, 0x03, 0xf2, 0x06, 0xcd, 0x31, 0xfa, 0xf2, 0x19, 0xf8,
-  0xf6, 0xb1, 0xe8, 0xe8, 0x27, 0xfe, 0x18, 0xdf, 0x28, 0x0e, 0x10, 0x09,
-  0x1c, 0x45, 0xa0, 0xe8, 0x09, 0xa0, 0x81, 0xf5, 0x06, 0x14, 0xf4, 0xff,
-  0x8c, 0xf5, 0x0d, 0x20, 0xa4, 0x38, 0x0b, 0xfb, 0xf6, 0xdc, 0xcf, 0x0b,
-  0xf5, 0x2a, 0xd7, 0x10, 0x04, 0x18, 0xf3, 0xc6, 0x3c, 0x1b, 0x3a, 0xda,
-  0x10, 0xd1, 0xdf, 0x00, 0x45, 0xf1, 0x0d, 0x04, 0xa6, 0x0a, 0x1d, 0xf3,
-  0x14, 0x28, 0x0f, 0xcd, 0xf1, 0xe2, 0x29, 0x11, 0xfa, 0x0b, 0x04, 0x4f,
-  0xed, 0xef, 0x20, 0xbb, 0x10, 0x16, 0x22, 0x1b, 0xb5, 0x14, 0x07, 0x45,
-  0xde, 0xdb, 0x2d, 0xbf, 0xac, 0xdd, 0x1f, 0x2e, 0xf3, 0x28, 0x04, 0xeb,
-  0xc7, 0x5a, 0xc4, 0x49, 0x2d, 0x03, 0xfb, 0x1f, 0xf4, 0xd4, 0xc7, 0xfe,
-  0xe3, 0x37, 0xdd, 0xb2, 0xc9, 0x04, 0xb7, 0xe3, 0x15, 0xb0, 0xbb, 0xec,
-  0xe8, 0x04, 0xf5, 0x00, 0xe2, 0xff, 0x21, 0xfd, 0xfe, 0x06, 0xdc, 0xbf,
-  0xbb, 0x19, 0x22, 0xed, 0xab, 0x01, 0x06, 0x17, 0xb1, 0xf0, 0xa9, 0x29,
-  0xd5, 0x08, 0x2f, 0xf6, 0x3f, 0xf2, 0xbb, 0xfb, 0x3e, 0xd7, 0xd6, 0xc9,
-  0xc5, 0xd6, 0xfc, 0xa3, 0xd3, 0xf7, 0xe2, 0x5a, 0xa5, 0xfc, 0x0b, 0x05,
-  0x13, 0x2e, 0x09, 0x25, 0xcf, 0xdf, 0x25, 0xca, 0x2e, 0x2b, 0xce, 0xfd,
-  0xf0, 0xe8, 0xeb, 0x16, 0x81, 0xea, 0x18, 0xbe, 0xe7, 0x01, 0xdd, 0x18,
-  0x2e, 0x18, 0xfb, 0xfa, 0x15, 0x11, 0x04, 0x02, 0x1c, 0xaa, 0xf9, 0xee,
-  0x29, 0xe9, 0x16, 0xe1, 0x30, 0xf5, 0x12, 0xbc, 0x0e, 0xe8, 0x13, 0xe7,
-  0xf6, 0xf8, 0xed, 0xc6, 0xf3, 0xe8, 0xbe, 0xcd, 0x27, 0x12, 0x4f, 0xfe,
-  0xfd, 0x42, 0xb2, 0xc9, 0x1b, 0x3f, 0xe0, 0x0e, 0x83, 0xd8, 0x22, 0xf1,
-  0x0b, 0xee, 0xfa, 0xf1, 0xbc, 0xf3, 0xe7, 0xf0, 0xcd, 0xf3, 0x05, 0xd6,
-  0xee, 0x43, 0x25, 0xbd, 0x0e, 0x21, 0x15, 0x1d, 0x26, 0x0f, 0x2a, 0xeb,
-  0xf5, 0x1a, 0xc3, 0x05, 0xc5, 0x08, 0xe4, 0xe9, 0xee, 0xd5, 0x01, 0x53,
-  0xf6, 0xd3, 0x06, 0x0a, 0x1a, 0xfd, 0x00, 0x0a, 0xd5, 0x2c, 0xe4, 0xe6,
-  0x1c, 0x0e, 0xc7, 0xf9, 0xf6, 0x26, 0xd5, 0x33, 0x4c, 0x0f, 0xe7, 0x04,
-  0xed, 0x15, 0xea, 0xdf, 0x7f, 0xde, 0xc2, 0xf7, 0xdc, 0xd1, 0xe9, 0x12,
-  0xd3, 0xea, 0xf0, 0xf1, 0xec, 0xef, 0xdf, 0x2d, 0x00, 0xd9, 0xe4, 0xe6,
-  0x01, 0xdb, 0xd5, 0xbb, 0x32, 0x0c, 0xea, 0x05, 0xf4, 0xfd, 0x21, 0x1c,
-  0x2e, 0x1a, 0x0e, 0xde, 0xe5, 0xf6, 0x0a, 0xc7, 0xe5, 0xe8, 0xce, 0xeb,
-  0x53, 0x2c, 0xfc, 0xd3, 0xef, 0x24, 0xfc, 0xe1, 0x06, 0xf3, 0x0b, 0x51,
-  0x28, 0x53, 0x28, 0xf7, 0x22, 0x9d, 0xfb, 0x3a, 0x24, 0x44, 0x21, 0xf5,
-  0x0e, 0x02, 0xa3, 0x16, 0xf6, 0x07, 0x4b, 0x06, 0xf9, 0xfc, 0xe8, 0x55,
-  0x18, 0xf7, 0x1a, 0x57, 0x0c, 0xf2, 0xf7, 0xdc, 0xf5, 0xd8, 0xd6, 0xd2,
-  0xeb, 0xcf, 0x04, 0xeb, 0x09, 0x2b, 0xeb, 0x0e, 0xd2, 0xef, 0x12, 0xe1,
-  0x1f, 0x46, 0xec, 0xf6, 0xdc, 0xe1, 0xf3, 0x20, 0x34, 0x40, 0x39, 0xc5,
-  0x41, 0xd0, 0x13, 0xdf, 0xbe, 0x1c, 0x2a, 0xfb, 0x1a, 0x19, 0xb5, 0x20,
-  0xe4, 0x08, 0x21, 0x20, 0x2f, 0x2e, 0xef, 0x27, 0xf3, 0x07, 0xfe, 0xf0,
-  0xd5, 0x70, 0x16, 0xe0, 0xcd, 0x3b, 0x0a, 0x1c, 0x0f, 0xde, 0x32, 0xea,
-  0x77, 0x08, 0x0e, 0xfc, 0x0b, 0x2b, 0x0d, 0xe3, 0x81, 0x36, 0xee, 0x13,
-  0x26, 0xfb, 0xc2, 0x02, 0x02, 0xf7, 0xe4, 0x1f, 0xe2, 0x10, 0x36, 0x0c,
-  0xc2, 0xdd, 0x1e, 0xea, 0x29, 0xac, 0x19, 0x4b, 0xf1, 0xdc, 0x05, 0xe1,
-  0x1d, 0x29, 0xea, 0x08, 0xa4, 0xdf, 0x12, 0xfa, 0x56, 0xce, 0x29, 0xd9,
-  0x2c, 0xbf, 0xb9, 0xea, 0x05, 0x1e, 0xd9, 0xfe, 0x07, 0xfd, 0x9a, 0xb1,
-  0x81, 0x9d, 0xf0, 0xdf, 0x2b, 0xe2, 0x2f, 0x88, 0xf7, 0x00, 0xe4, 0x9d,
-  0xff, 0x09, 0xf6, 0x39, 0xc4, 0x18, 0xed, 0x2c, 0xd1, 0xa0, 0x49, 0xf3,
-  0xfe, 0x11, 0x02, 0x03, 0x1e, 0x53, 0x19, 0x0b, 0xf3, 0xb1, 0x1a, 0x6c,
-  0x84, 0xca, 0xb4, 0xca, 0xd6, 0x1b, 0x30, 0x39, 0xc2, 0xda, 0xa6, 0x17,
-  0xef, 0x09, 0x2d, 0x24, 0xb8, 0xe3, 0x57, 0x26, 0xac, 0x1f, 0xe4, 0x1a,
-  0xfb, 0x3a, 0x1b, 0x0a, 0xf9, 0xff, 0x3f, 0x0f, 0x3e, 0xbd, 0x71, 0xe7,
-  0x14, 0xf0, 0xfc, 0xa5, 0x33, 0xde, 0xe1, 0x4b, 0x27, 0xc7, 0x14, 0xd6,
-  0x44, 0xc7, 0x4f, 0x1c, 0xd4, 0xdb, 0x11, 0x6b, 0x3c, 0xf0, 0xe7, 0x13,
-  0xcf, 0x69, 0xc1, 0x52, 0xff, 0xec, 0x0c, 0xea, 0xf9, 0xe5, 0x25, 0x1e,
-  0xf3, 0x1b, 0xbc, 0x04, 0x0e, 0x0a, 0xf7, 0xdc, 0xd2, 0xb7, 0xfe, 0x34,
-  0x0e, 0x10, 0x4c, 0xd3, 0x1f, 0x29, 0x33, 0x33, 0xd1, 0xd3, 0x19, 0xeb,
-  0xc9, 0xea, 0x23, 0x02, 0xc1, 0x46, 0x13, 0x34, 0x04, 0x25, 0x1c, 0xee,
-  0x1c, 0x05, 0xf3, 0xfe, 0x36, 0xd3, 0x12, 0xf4, 0xb5, 0x81, 0x28, 0xd3,
-  0x0f, 0xea, 0xf1, 0x0b, 0xca, 0x0c, 0x01, 0x21, 0x40, 0x0b, 0x27, 0x01,
-  0xf9, 0xbe, 0xcd, 0xef, 0x79, 0xb7, 0xf3, 0xf5, 0xf6, 0xc7, 0xe6, 0xe4,
-  0x92, 0x0f, 0xec, 0xbd, 0x2a, 0x1b, 0x07, 0xf3, 0x02, 0xe8, 0x08, 0x26,
-  0x23, 0x11, 0xfa, 0x10, 0xcb, 0x86, 0x0f, 0xdb, 0x68, 0xc4, 0xc6, 0xcf,
-  0xf2, 0xe5, 0x6b, 0x2d, 0xdc, 0xd5, 0x35, 0xc5, 0xfe, 0xe8, 0xf7, 0xa0,
-  0xd9, 0xfc, 0xe5, 0x0c, 0xe4, 0x06, 0x33, 0x08, 0x2a, 0xfd, 0x9f, 0xee,
-  0x0e, 0x5c, 0x1c, 0x0e, 0xf4, 0xbe, 0x2e, 0x1c, 0xe1, 0x36, 0x44, 0x04,
-  0xc5, 0x15, 0x29, 0xde, 0xcf, 0x1b, 0x07, 0x1e, 0xdc, 0x23, 0x2b, 0x1d,
-  0x72, 0x9d, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x36, 0x5d, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x40, 0x00, 0x00, 0xd5, 0x10, 0xd4, 0xf0, 0x2e, 0x0e, 0xb1, 0xcb,
+  0xf4, 0x13, 0x34, 0x2e, 0x03, 0x0b, 0x27, 0xff, 0x27, 0x37, 0x03, 0x0e,
+  0xeb, 0xef, 0xe5, 0x23, 0xf5, 0x28, 0x03, 0x2c, 0xe3, 0xe0, 0xfe, 0x42,
+  0x11, 0x4c, 0x10, 0x01, 0xe5, 0x2a, 0xff, 0xf4, 0xc4, 0x05, 0xf2, 0xac,
+  0x2e, 0x1b, 0x21, 0x0e, 0x24, 0xb7, 0x15, 0x8c, 0x47, 0x52, 0x50, 0xeb,
+  0xa8, 0x37, 0xe5, 0x28, 0x2a, 0xf8, 0x49, 0x1c, 0x43, 0xc9, 0xbe, 0x47,
+  0xfd, 0x59, 0x00, 0x28, 0x1b, 0x04, 0x13, 0x03, 0x07, 0xee, 0x32, 0xcc,
+  0xe5, 0x0e, 0xeb, 0x7f, 0x01, 0x39, 0x0b, 0x23, 0x23, 0xf9, 0x1e, 0x4c,
+  0x09, 0xe1, 0x0b, 0xfe, 0xf2, 0x2f, 0x19, 0x08, 0x29, 0xdb, 0x35, 0x1d,
+  0x0a, 0x8e, 0xfc, 0x3c, 0x02, 0x33, 0xd1, 0xfe, 0xb8, 0x08, 0x50, 0xea,
+  0xd9, 0x2f, 0xd6, 0x12, 0x71, 0xcb, 0xd2, 0x29, 0xd4, 0xf2, 0x9a, 0x14,
+  0x4b, 0x71, 0x42, 0x15, 0x32, 0xfe, 0xdb, 0xfc, 0x12, 0xd7, 0xfc, 0xca,
+  0x00, 0xe2, 0x0b, 0xd3, 0x11, 0x43, 0xf3, 0xdc, 0x19, 0x2b, 0xf9, 0x08,
+  0x0b, 0x98, 0x04, 0x0a, 0xe8, 0x20, 0x0a, 0xec, 0x1d, 0xf5, 0x21, 0x38,
+  0x0c, 0xc6, 0x7f, 0x20, 0x53, 0x41, 0xf8, 0xf2, 0xe3, 0xc6, 0x0b, 0x3d,
+  0x56, 0xf7, 0x16, 0xe8, 0xe4, 0xcd, 0xf1, 0x1d, 0x1c, 0xe3, 0xd9, 0xbb,
+  0x09, 0xd8, 0x3a, 0xda, 0x08, 0xf7, 0x43, 0xf9, 0x48, 0xbc, 0x21, 0x41,
+  0x0c, 0xb7, 0x05, 0x22, 0x09, 0x11, 0x00, 0x56, 0x02, 0x34, 0x14, 0x30,
+  0xd9, 0x33, 0xe1, 0xea, 0xf6, 0xe4, 0xf6, 0xe8, 0xf6, 0x02, 0x34, 0xe2,
+  0xe4, 0x2a, 0x1d, 0xeb, 0x1a, 0x06, 0xcc, 0xca, 0x00, 0xad, 0xf9, 0x06,
+  0x2f, 0x2f, 0x04, 0x1a, 0x2b, 0xe5, 0xd9, 0x05, 0xde, 0xfa, 0xf9, 0x00,
+  0xc9, 0xb5, 0x25, 0xda, 0xa7, 0x04, 0xf2, 0xe2, 0xec, 0xcb, 0xd7, 0x16,
+  0x40, 0xb6, 0x2a, 0x03, 0xff, 0xd8, 0xcb, 0x3a, 0x17, 0x1b, 0xcc, 0x14,
+  0x1a, 0x05, 0xfd, 0xf2, 0xfe, 0x13, 0xc4, 0x3b, 0x3c, 0x25, 0xf9, 0xcd,
+  0xd4, 0xd2, 0xb5, 0xd4, 0x33, 0x5d, 0x9a, 0x93, 0x31, 0x03, 0xf2, 0xc5,
+  0xf1, 0xf1, 0x25, 0x27, 0x26, 0x22, 0x1d, 0xdc, 0xe1, 0x18, 0x09, 0x12,
+  0xfe, 0xeb, 0x32, 0xe8, 0x34, 0x1e, 0x28, 0x10, 0xbb, 0x0f, 0x15, 0xf1,
+  0xcd, 0xcd, 0x06, 0x63, 0x01, 0x15, 0xf0, 0xe5, 0x13, 0xca, 0xc7, 0xdf,
+  0xdf, 0x32, 0x54, 0x10, 0x04, 0x64, 0x0d, 0x03, 0x1a, 0x03, 0xfb, 0xad,
+  0xf9, 0xe9, 0xc0, 0xed, 0x05, 0x14, 0x20, 0x3b, 0xff, 0x17, 0xe1, 0x1c,
+  0xb9, 0x81, 0xd8, 0x43, 0x22, 0x07, 0xfa, 0x42, 0xe5, 0xeb, 0x04, 0x15,
+  0xf1, 0x15, 0x23, 0xf3, 0xdf, 0x2f, 0xfe, 0xeb, 0x05, 0xf2, 0x11, 0xd0,
+  0x3e, 0x42, 0xd5, 0xd8, 0x1b, 0xd1, 0x16, 0x16, 0x39, 0xd7, 0xef, 0xfe,
+  0x15, 0x2b, 0x55, 0x0c, 0x0f, 0x32, 0xe6, 0x02, 0x39, 0x11, 0xe5, 0xe1,
+  0x0f, 0x30, 0xe5, 0x00, 0x00, 0x2e, 0x13, 0x2f, 0xe9, 0xed, 0xce, 0x00,
+  0xc3, 0x3c, 0xfd, 0xd9, 0x02, 0xd7, 0x13, 0x77, 0xf3, 0xd5, 0xf1, 0xf8,
+  0xa5, 0x21, 0xac, 0x18, 0xf7, 0xc4, 0xfb, 0xc9, 0xde, 0x00, 0x01, 0x10,
+  0xd9, 0x2c, 0x0e, 0x1c, 0x21, 0x1d, 0x06, 0xf1, 0xfb, 0xb1, 0xf1, 0x7f,
+  0x0e, 0x40, 0xfa, 0x39, 0xc4, 0xfe, 0x21, 0x01, 0x33, 0x00, 0x1b, 0xe1,
+  0x18, 0x4d, 0x40, 0x40, 0x18, 0x25, 0x34, 0xc8, 0x35, 0xcd, 0x0a, 0x05,
+  0x42, 0x04, 0x45, 0x4b, 0xfe, 0x0d, 0xd7, 0x06, 0xc2, 0x0e, 0x31, 0x0f,
+  0x06, 0xb6, 0xc3, 0x48, 0x13, 0x05, 0x03, 0xea, 0x01, 0xfa, 0x0f, 0x1a,
+  0x11, 0x34, 0xcd, 0x3d, 0x22, 0x1d, 0x11, 0x00, 0x05, 0x1b, 0x0f, 0x09,
+  0x0e, 0x21, 0xe3, 0xfd, 0x1f, 0x1c, 0xc5, 0xb6, 0x13, 0xf6, 0x23, 0xfd,
+  0x29, 0x14, 0xc2, 0xe7, 0xe6, 0xde, 0x9a, 0x1a, 0x98, 0xf3, 0xe5, 0xc0,
+  0xd3, 0x0d, 0x50, 0x0e, 0xc8, 0x02, 0xfc, 0x01, 0x1e, 0x51, 0x20, 0xcf,
+  0x15, 0xae, 0x34, 0x2b, 0xfb, 0x13, 0xeb, 0x99, 0xf8, 0xfb, 0x0a, 0x1c,
+  0x12, 0x16, 0x04, 0xfa, 0x7f, 0x27, 0x28, 0xcf, 0xf0, 0x46, 0x31, 0x0c,
+  0x02, 0x26, 0x5a, 0xda, 0xce, 0x26, 0x64, 0x09, 0xe2, 0xf5, 0xc5, 0x1b,
+  0x36, 0x04, 0x0a, 0xfc, 0x1f, 0x08, 0xe3, 0xfc, 0xb8, 0x1e, 0xdf, 0x77,
+  0xf6, 0xde, 0xe6, 0x12, 0xde, 0xe4, 0xc5, 0x56, 0x9f, 0xbf, 0x53, 0xec,
+  0xed, 0x4b, 0xf7, 0xde, 0x36, 0xb9, 0x06, 0x02, 0x29, 0xea, 0x59, 0x1e,
+  0x5c, 0x56, 0xc9, 0x94, 0xd2, 0x09, 0x1e, 0x40, 0x4c, 0xf3, 0xf8, 0xf6,
+  0x78, 0xfa, 0xda, 0x51, 0x08, 0xe2, 0xfa, 0x2d, 0x31, 0xf1, 0xf3, 0x22,
+  0xeb, 0xe7, 0x1b, 0x17, 0x40, 0xea, 0x07, 0xe9, 0x42, 0xe8, 0xdf, 0xf6,
+  0xcb, 0x27, 0x75, 0x0f, 0xb9, 0xd7, 0xd0, 0xe9, 0xdd, 0xc4, 0xcb, 0x07,
+  0x32, 0x0d, 0x34, 0xf0, 0xa6, 0x10, 0x22, 0x27, 0xf5, 0x16, 0xde, 0xe4,
+  0xe7, 0x26, 0xe1, 0x61, 0xee, 0x05, 0x7b, 0x57, 0xc8, 0xa6, 0xb2, 0xf6,
+  0x20, 0x48, 0xea, 0xed, 0xb5, 0xf0, 0xbd, 0x17, 0xc8, 0xdb, 0x54, 0xb7,
+  0x30, 0xfb, 0xfe, 0xd8, 0x0b, 0x28, 0xea, 0xe4, 0x81, 0xdd, 0x08, 0x59,
+  0x9d, 0x98, 0xb9, 0x45, 0x06, 0xb3, 0xa0, 0x19, 0x04, 0xe9, 0x11, 0x0a,
+  0xdf, 0xb6, 0xcb, 0xff, 0xe6, 0x10, 0xca, 0xd0, 0xd4, 0x11, 0x4d, 0xd7,
+  0x43, 0xe5, 0x1e, 0xe4, 0x0c, 0x3f, 0x23, 0xf3, 0x00, 0xc9, 0x37, 0x30,
+  0xe0, 0x2f, 0x04, 0x58, 0x46, 0xbf, 0xf1, 0x21, 0x39, 0x4e, 0xa5, 0xe7,
+  0xb6, 0xd3, 0x66, 0x0e, 0x02, 0x18, 0xdf, 0xbb, 0xea, 0xaf, 0x0e, 0x44,
+  0xfc, 0xf4, 0x18, 0xe6, 0xed, 0xed, 0xe6, 0x17, 0x5f, 0x07, 0x94, 0x18,
+  0x19, 0x30, 0xec, 0x3c, 0xef, 0x24, 0xec, 0x41, 0xe3, 0x0c, 0xda, 0xd8,
+  0xe6, 0x20, 0xf7, 0xe9, 0xe8, 0x37, 0xfb, 0x19, 0xd6, 0xe3, 0xea, 0x14,
+  0xcd, 0x43, 0xf1, 0x11, 0xe4, 0xfb, 0x2e, 0xb6, 0xfa, 0x35, 0x3c, 0xf9,
+  0xfe, 0xfc, 0xe6, 0xfd, 0xd5, 0x05, 0xbf, 0xe6, 0xda, 0xd6, 0x20, 0x7f,
+  0xf8, 0x30, 0xbf, 0x1f, 0xcf, 0x0f, 0xd7, 0x10, 0x3b, 0x00, 0x1e, 0x00,
+  0xeb, 0x63, 0x3c, 0xe2, 0xe8, 0x0c, 0xed, 0xdc, 0x01, 0x06, 0xf2, 0xf0,
+  0x3a, 0x0c, 0x30, 0x7a, 0x14, 0xb3, 0x38, 0xd6, 0xba, 0xb7, 0xec, 0x3b,
+  0x2f, 0x0e, 0xea, 0x61, 0x15, 0xf9, 0xe8, 0xfe, 0xdb, 0xf0, 0x10, 0xd3,
+  0xa6, 0x1f, 0xc0, 0x02, 0x1f, 0xfe, 0xdc, 0x1c, 0x13, 0x0b, 0xff, 0x2f,
+  0x08, 0xfa, 0x19, 0xe0, 0x37, 0x4a, 0x20, 0xcc, 0x07, 0x10, 0xdc, 0xbb,
+  0xed, 0xfd, 0xac, 0x1a, 0xd0, 0x13, 0xdd, 0xfb, 0xda, 0xf5, 0xd4, 0x02,
+  0xf4, 0x06, 0x3a, 0xeb, 0xb8, 0xf0, 0x08, 0x07, 0x42, 0x16, 0x1e, 0xf1,
+  0x1a, 0xdf, 0x41, 0xcb, 0xeb, 0xfc, 0xf3, 0xb2, 0x10, 0xf7, 0xd5, 0xfc,
+  0x02, 0xf6, 0x19, 0xc1, 0x51, 0x05, 0x1b, 0x40, 0xf5, 0xfa, 0xf1, 0x16,
+  0xde, 0x7e, 0x56, 0xc8, 0xfe, 0xff, 0x11, 0xde, 0x0a, 0x10, 0xf4, 0xe8,
+  0x22, 0xe6, 0xe6, 0x00, 0xbe, 0x32, 0x2f, 0x0b, 0xa2, 0x1a, 0x14, 0x49,
+  0xe2, 0xde, 0x19, 0x27, 0xa5, 0xd4, 0xd8, 0xfa, 0xc8, 0xef, 0x76, 0x01,
+  0xe3, 0x0c, 0x14, 0xd2, 0xf7, 0xf2, 0x09, 0x18, 0xbc, 0xde, 0x7f, 0x4d,
+  0x36, 0x1c, 0xf5, 0x01, 0xc3, 0x0d, 0x10, 0x2d, 0x3a, 0xdc, 0x3f, 0xe1,
+  0x25, 0x0c, 0xe6, 0xf2, 0x1e, 0xcb, 0xf5, 0x11, 0xb3, 0xec, 0x55, 0x1b,
+  0x1a, 0xed, 0xae, 0x29, 0x4e, 0x3b, 0xff, 0x01, 0xd6, 0x28, 0xea, 0x3a,
+  0x59, 0x5b, 0x8c, 0x17, 0xd5, 0x2e, 0x2b, 0x07, 0x01, 0x36, 0xde, 0x47,
+  0xb4, 0xbf, 0xca, 0xdf, 0xe6, 0xd3, 0x45, 0x21, 0xe9, 0x65, 0xdc, 0x3d,
+  0x0d, 0xd2, 0x9d, 0x2f, 0x16, 0xec, 0xaa, 0x1e, 0x6c, 0xef, 0x02, 0xda,
+  0xe2, 0x44, 0x14, 0xbf, 0xc2, 0xf1, 0xfd, 0xcf, 0xea, 0x17, 0xef, 0x1a,
+  0xe4, 0xad, 0x4f, 0x46, 0x1d, 0x35, 0x03, 0xe2, 0xdd, 0xe6, 0x1e, 0x2f,
+  0xfc, 0xec, 0x2b, 0x21, 0x24, 0x67, 0x3b, 0xda, 0x35, 0xbe, 0x0e, 0xaa,
+  0x6e, 0x10, 0xe8, 0xde, 0xfd, 0x0c, 0x05, 0x4e, 0x23, 0x0c, 0x21, 0x0d,
+  0x97, 0xc3, 0x43, 0x35, 0xf6, 0x32, 0x44, 0xc6, 0x69, 0x1d, 0xde, 0xc2,
+  0x1b, 0x7f, 0xfc, 0x36, 0xfb, 0x69, 0xbb, 0x15, 0x52, 0xc1, 0x09, 0xcd,
+  0xb7, 0x01, 0xeb, 0x0c, 0x0a, 0x0a, 0x05, 0x0d, 0xf7, 0x09, 0x1f, 0x17,
+  0xa9, 0xda, 0xe0, 0x04, 0xdc, 0xcb, 0xa2, 0x4d, 0x2c, 0xe9, 0xb9, 0x03,
+  0x06, 0xc3, 0x3e, 0x06, 0x49, 0xdc, 0x29, 0x6c, 0x05, 0x41, 0xcb, 0x35,
+  0x06, 0xd7, 0x13, 0x29, 0xcf, 0x3e, 0xb9, 0xdd, 0xdf, 0x1c, 0xfa, 0x1c,
+  0x1e, 0xd6, 0xf5, 0xed, 0x30, 0x70, 0x0c, 0xca, 0xd4, 0x52, 0xe1, 0x07,
+  0x08, 0xd3, 0xda, 0x19, 0x10, 0x3e, 0x34, 0xf5, 0x31, 0x70, 0xe0, 0xd4,
+  0x19, 0x21, 0xd9, 0x40, 0x81, 0xee, 0x06, 0xe7, 0x48, 0xe2, 0x30, 0x4e,
+  0x1b, 0xad, 0x0f, 0x1c, 0xef, 0x03, 0x11, 0xf7, 0x82, 0xd4, 0xe4, 0x29,
+  0xbc, 0x18, 0x0c, 0x0b, 0xce, 0xfe, 0x2a, 0xfd, 0xe7, 0x1d, 0xdd, 0xef,
+  0x47, 0x1e, 0x36, 0xdf, 0xf3, 0xd9, 0xe8, 0x0f, 0xe7, 0xf8, 0x09, 0x2e,
+  0xe2, 0xe1, 0x08, 0x22, 0x41, 0x1b, 0xfb, 0x88, 0xd8, 0xd3, 0x06, 0x02,
+  0x3c, 0xdd, 0xd5, 0xf1, 0x2a, 0xe9, 0x09, 0xd7, 0xbf, 0xf9, 0x05, 0xf9,
+  0x04, 0x0e, 0xe8, 0x9b, 0xf0, 0xfd, 0xd7, 0x46, 0x08, 0xf2, 0xef, 0x03,
+  0x17, 0xa5, 0xf0, 0x41, 0xd9, 0xf0, 0x24, 0x15, 0x03, 0xdc, 0x19, 0xdd,
+  0x1a, 0x38, 0xf8, 0x7f, 0xac, 0x94, 0x04, 0xdd, 0xe2, 0xf1, 0x46, 0xaf,
+  0x01, 0xe4, 0xf1, 0xe7, 0x3f, 0xf7, 0xc6, 0xf4, 0x11, 0xee, 0x19, 0xf5,
+  0xe4, 0x3e, 0xf5, 0xea, 0x0f, 0xf9, 0xf4, 0x2b, 0xe0, 0xe8, 0x1e, 0xda,
+  0x19, 0x2c, 0x39, 0xda, 0x0b, 0x17, 0xd6, 0xf1, 0x14, 0x16, 0xe6, 0x0c,
+  0x0d, 0xad, 0xf4, 0x8c, 0xe8, 0xc5, 0xec, 0xec, 0xfb, 0xca, 0xfc, 0x1b,
+  0xaa, 0x1b, 0xee, 0xc6, 0xeb, 0x25, 0xf9, 0xda, 0xd6, 0xda, 0xce, 0xa3,
+  0x05, 0x3c, 0x03, 0xc2, 0xc5, 0x3e, 0xa9, 0x0d, 0xe7, 0x2c, 0xc4, 0xfb,
+  0xe9, 0xf4, 0x04, 0x09, 0x07, 0xff, 0x1a, 0xcf, 0xfe, 0x7f, 0x10, 0xfc,
+  0xfe, 0x02, 0x1e, 0xc9, 0xe0, 0x27, 0xe9, 0xf9, 0xd5, 0x2c, 0x28, 0x03,
+  0xfd, 0x2c, 0x0a, 0xc7, 0x0d, 0x1f, 0x04, 0xeb, 0x19, 0xbd, 0x09, 0x01,
+  0xf6, 0xe0, 0x18, 0xb4, 0xf0, 0x31, 0x06, 0xfb, 0x37, 0xf6, 0x3a, 0x00,
+  0x26, 0x07, 0x01, 0x2c, 0xda, 0xe0, 0x0d, 0xfa, 0x40, 0xce, 0x05, 0xe2,
+  0xea, 0xec, 0x22, 0x47, 0xfa, 0xf0, 0x29, 0xc9, 0xf9, 0x01, 0xe1, 0x51,
+  0xfd, 0x20, 0xea, 0xbe, 0x19, 0xf7, 0x35, 0x2f, 0xff, 0x03, 0xfa, 0x1b,
+  0xf0, 0x2c, 0x37, 0x14, 0xf8, 0x30, 0x0c, 0xf9, 0xf4, 0x3e, 0x17, 0xf7,
+  0xfc, 0xb6, 0x27, 0xed, 0xf5, 0xe7, 0xe2, 0xe8, 0xe8, 0xe8, 0x27, 0xdb,
+  0x01, 0xf3, 0x01, 0xd3, 0xdf, 0xfd, 0xf9, 0xc4, 0xfc, 0x2b, 0x39, 0xec,
+  0x00, 0x14, 0xed, 0xd0, 0xef, 0x16, 0xfa, 0x1c, 0x23, 0xfe, 0x1e, 0xe0,
+  0xce, 0xfa, 0xfd, 0x14, 0x19, 0x1b, 0xef, 0x0d, 0x81, 0xda, 0x32, 0x5c,
+  0x44, 0xff, 0xfb, 0xe7, 0x48, 0xe4, 0x3e, 0x33, 0xb8, 0x24, 0xd6, 0x03,
+  0xf1, 0xee, 0xe1, 0xfb, 0xe3, 0xb9, 0xdc, 0xfe, 0x21, 0xc7, 0x07, 0x04,
+  0x6a, 0xd0, 0x13, 0x15, 0xb1, 0x16, 0x34, 0x26, 0xbc, 0xeb, 0x10, 0xd4,
+  0xf9, 0xd2, 0x2c, 0x28, 0xb0, 0xf4, 0xd6, 0xf8, 0x6e, 0xa2, 0xea, 0x9d,
+  0x02, 0xcc, 0xf6, 0x44, 0x1e, 0xd7, 0xe2, 0x1b, 0x5a, 0xef, 0xc5, 0xea,
+  0xfe, 0xc9, 0x3d, 0x74, 0x0f, 0x0e, 0x30, 0xb5, 0xad, 0xc1, 0xfd, 0x3a,
+  0xec, 0xc0, 0xd3, 0x21, 0xe6, 0x2a, 0x04, 0x35, 0x58, 0x6d, 0xd7, 0x3a,
+  0x36, 0xd9, 0x07, 0x20, 0xe0, 0xd7, 0xb9, 0x53, 0xd7, 0xe4, 0xb5, 0x0b,
+  0xef, 0x2c, 0x00, 0xb3, 0x8d, 0x06, 0xe6, 0x0f, 0x67, 0x47, 0x0e, 0x18,
+  0xd4, 0xde, 0xf5, 0x19, 0x04, 0x41, 0xe6, 0xf0, 0x37, 0xfa, 0x03, 0x90,
+  0x30, 0x00, 0xc0, 0xfa, 0x06, 0xe9, 0xf5, 0x17, 0x02, 0x14, 0xd6, 0x3a,
+  0x1d, 0xbc, 0xe3, 0x27, 0x0e, 0x4b, 0x1b, 0x1b, 0x06, 0xe3, 0x2c, 0xf3,
+  0x47, 0x1c, 0xcd, 0x46, 0x01, 0x24, 0x13, 0xe5, 0xf8, 0xcb, 0xe7, 0x7f,
+  0xc9, 0x02, 0xdb, 0xbd, 0xaa, 0x0f, 0x02, 0xba, 0xd2, 0xf9, 0xef, 0xfb,
+  0xe7, 0xdc, 0x5f, 0x06, 0x0e, 0x5b, 0x2c, 0x0a, 0x13, 0x19, 0xe4, 0x06,
+  0xf8, 0x60, 0xff, 0x24, 0xeb, 0x14, 0x2b, 0x03, 0x05, 0x44, 0x30, 0x19,
+  0x34, 0x13, 0xf6, 0xd3, 0xec, 0x19, 0xe7, 0xcc, 0xa5, 0x62, 0xf7, 0x29,
+  0x23, 0x0d, 0x3a, 0x18, 0xc2, 0x35, 0x4b, 0xfe, 0x1b, 0xfe, 0xee, 0x29,
+  0xf1, 0xf5, 0x4f, 0x08, 0x4e, 0xa8, 0xa8, 0xe3, 0x23, 0x1e, 0xd1, 0x34,
+  0x21, 0xe9, 0xd9, 0x3d, 0x41, 0x3b, 0xef, 0x51, 0x28, 0xca, 0xca, 0x08,
+  0x3e, 0xd0, 0xe6, 0xf2, 0x0e, 0xc4, 0xf4, 0xe5, 0xcd, 0x26, 0x1f, 0x2e,
+  0xcc, 0xdc, 0x95, 0xe5, 0x2e, 0x16, 0x04, 0xd2, 0x2c, 0x00, 0x3b, 0xcd,
+  0x40, 0xfd, 0xd0, 0xd3, 0xbc, 0x07, 0x4a, 0x36, 0x13, 0x0e, 0x29, 0x3e,
+  0x1d, 0x32, 0xf6, 0xef, 0x29, 0xdf, 0xee, 0x2d, 0xff, 0x15, 0xf4, 0xe2,
+  0x98, 0x16, 0x4e, 0xfd, 0x01, 0x20, 0x0a, 0x71, 0xf8, 0xf6, 0x2a, 0x40,
+  0x00, 0x15, 0x40, 0xa9, 0xc6, 0xf6, 0x03, 0xe4, 0xee, 0x29, 0xd6, 0xc2,
+  0xe4, 0xf4, 0x43, 0xf2, 0xcb, 0x0e, 0xde, 0xff, 0x48, 0x31, 0x18, 0xc9,
+  0x7f, 0x47, 0x08, 0xe7, 0xeb, 0xe9, 0x21, 0x1b, 0x11, 0xda, 0x30, 0x76,
+  0xcb, 0xfe, 0x55, 0xe5, 0x28, 0x8e, 0x3c, 0x43, 0x19, 0xf6, 0xdf, 0xee,
+  0x31, 0xe5, 0x08, 0xe6, 0x22, 0xe7, 0x3c, 0xf7, 0x18, 0x66, 0x00, 0xcb,
+  0x42, 0xe1, 0xc4, 0x09, 0x1a, 0xfd, 0xca, 0x2a, 0x0b, 0x18, 0xe9, 0x1f,
+  0xd1, 0xf7, 0xc9, 0x06, 0xf4, 0xd7, 0xd5, 0x33, 0xf7, 0x2a, 0xdf, 0xe0,
+  0x33, 0x10, 0xe2, 0x12, 0x23, 0x16, 0x01, 0xfc, 0x3c, 0xbf, 0xe0, 0x19,
+  0x1a, 0xe3, 0xbb, 0x2f, 0xcd, 0x14, 0x35, 0xdc, 0x2a, 0x3b, 0xd8, 0x3c,
+  0xcf, 0x46, 0xdd, 0xcb, 0x2c, 0xf6, 0x32, 0xbf, 0xd9, 0xdb, 0xdc, 0xec,
+  0x3c, 0x2e, 0xc5, 0x18, 0x0e, 0x18, 0x35, 0xe8, 0x5a, 0x1f, 0x2a, 0x11,
+  0x10, 0x23, 0xd2, 0xcb, 0xf5, 0x1e, 0x23, 0xcf, 0xd8, 0xd2, 0xef, 0x1f,
+  0x09, 0x43, 0xed, 0xdc, 0x2c, 0x24, 0xff, 0x0e, 0xdd, 0x3c, 0x0a, 0x20,
+  0xaf, 0x42, 0xce, 0x19, 0x08, 0xef, 0x0b, 0x30, 0xf3, 0x1d, 0x03, 0x30,
+  0xfa, 0x39, 0x1a, 0xe0, 0x01, 0x1f, 0xf8, 0xf2, 0xe7, 0xcd, 0x12, 0x05,
+  0xba, 0xb0, 0x1b, 0x46, 0xe1, 0xd2, 0x98, 0xdc, 0xe1, 0xe3, 0x31, 0xd8,
+  0x36, 0xe5, 0xd8, 0x2f, 0x7f, 0x83, 0xe0, 0x3f, 0xf5, 0x15, 0x10, 0x16,
+  0x17, 0x5a, 0x1b, 0x3a, 0x36, 0x11, 0x3a, 0xc3, 0xeb, 0x3b, 0xdf, 0xad,
+  0x92, 0xdb, 0x3a, 0xf2, 0xba, 0x01, 0x04, 0xad, 0x0e, 0x1b, 0x1d, 0xd9,
+  0xdf, 0xc9, 0x1e, 0x06, 0xd1, 0xd8, 0x02, 0x9e, 0xd8, 0x4c, 0x57, 0xf5,
+  0x66, 0xd4, 0x35, 0x0d, 0x24, 0x2a, 0x16, 0xf3, 0x1f, 0xcb, 0xe1, 0x0a,
+  0x04, 0xd7, 0x0b, 0xed, 0x3a, 0xd4, 0xd9, 0x3f, 0x0e, 0x22, 0x0a, 0xc8,
+  0x09, 0x25, 0x15, 0x1e, 0xbc, 0xd6, 0xc8, 0xd7, 0x43, 0xef, 0x01, 0x3c,
+  0xfd, 0xbb, 0xf7, 0x48, 0x00, 0x1c, 0xfd, 0x40, 0xef, 0x09, 0x38, 0xde,
+  0x1c, 0x55, 0xa0, 0x1b, 0x7f, 0xff, 0xe7, 0x0a, 0xee, 0xb7, 0xfe, 0xd1,
+  0x3b, 0x25, 0xc2, 0xff, 0x26, 0x0b, 0x15, 0xfa, 0x21, 0xcb, 0xf9, 0x2b,
+  0x30, 0x1e, 0x48, 0x0e, 0x11, 0x3e, 0xac, 0xb1, 0x68, 0x01, 0x6f, 0xb8,
+  0x05, 0xc1, 0xfd, 0x19, 0x87, 0x29, 0x2d, 0xd5, 0x23, 0x03, 0x01, 0x19,
+  0xc3, 0xdd, 0xff, 0xe4, 0xc2, 0xc7, 0xed, 0x17, 0x0c, 0xe8, 0xe5, 0x26,
+  0xd1, 0xeb, 0xfe, 0xfb, 0xbc, 0xfe, 0x21, 0x17, 0x2f, 0xe0, 0xfa, 0x12,
+  0xe2, 0xfe, 0x4d, 0x4d, 0x23, 0x22, 0x60, 0xca, 0xe3, 0xb4, 0x22, 0xd8,
+  0xdc, 0x25, 0xdd, 0xf9, 0x2e, 0x09, 0xf3, 0x16, 0x04, 0xe8, 0xe6, 0xda,
+  0x46, 0x2a, 0xf6, 0x0c, 0x03, 0x83, 0xc7, 0x39, 0xd8, 0x74, 0x6d, 0xcb,
+  0x30, 0x57, 0x0d, 0xda, 0x28, 0xe2, 0xf4, 0xc9, 0xd9, 0x30, 0xe0, 0xcc,
+  0xb6, 0x56, 0xee, 0x24, 0xd9, 0x2f, 0x05, 0x72, 0xc9, 0xc7, 0x15, 0x24,
+  0xc5, 0x03, 0xfe, 0x01, 0xab, 0x2a, 0x0f, 0xf0, 0x0e, 0xad, 0x40, 0xcf,
+  0x44, 0xae, 0xfa, 0x63, 0xd4, 0xfc, 0x7f, 0x11, 0x57, 0x01, 0xf8, 0x1d,
+  0xcb, 0x33, 0xe6, 0x2b, 0xf2, 0xa4, 0xec, 0xa4, 0x3f, 0x22, 0xdf, 0xfc,
+  0x1b, 0xdc, 0x21, 0x0e, 0x3a, 0xeb, 0xd5, 0xa1, 0xec, 0x03, 0x40, 0xdb,
+  0xa6, 0x9f, 0xf2, 0xa1, 0xda, 0x0f, 0xf0, 0x0f, 0xfe, 0x19, 0x01, 0xee,
+  0x4b, 0x1a, 0xec, 0xba, 0x3a, 0xe1, 0xed, 0xd5, 0x21, 0x23, 0xe0, 0x12,
+  0x11, 0x1c, 0x0c, 0xee, 0xf6, 0xfd, 0x03, 0xf0, 0xd3, 0xdc, 0xac, 0xcf,
+  0xdf, 0xdc, 0xd1, 0xdb, 0x3e, 0x57, 0x0e, 0x08, 0x2e, 0x12, 0x10, 0xd9,
+  0x02, 0xf6, 0x81, 0xe5, 0x4e, 0x26, 0x4c, 0xf7, 0x39, 0x25, 0x01, 0xe4,
+  0xb7, 0xf6, 0x15, 0xcd, 0x99, 0x97, 0xdb, 0xe7, 0x2a, 0xc3, 0xbb, 0x2b,
+  0xaa, 0xd1, 0xbf, 0x0f, 0xeb, 0x4e, 0x33, 0xf3, 0x21, 0x3e, 0xda, 0x31,
+  0xff, 0x12, 0x22, 0xf3, 0xec, 0x0b, 0x0b, 0x30, 0x05, 0xb0, 0x28, 0xf1,
+  0x26, 0xe6, 0xdf, 0x1b, 0xfe, 0x9b, 0xe3, 0xfc, 0xbd, 0x1c, 0xe9, 0x0c,
+  0xb4, 0xb2, 0xfa, 0x1a, 0x12, 0xf9, 0x3c, 0xb7, 0x33, 0x07, 0xe4, 0xd2,
+  0x1a, 0xcc, 0x89, 0xc0, 0x84, 0x0b, 0xda, 0xb8, 0x12, 0xce, 0x9d, 0xa7,
+  0xf8, 0x43, 0xfd, 0x5b, 0xfb, 0xfe, 0x05, 0x46, 0xf0, 0x1c, 0x2c, 0x17,
+  0x5c, 0xd8, 0xfc, 0xf6, 0xf4, 0xf5, 0xd7, 0x06, 0x16, 0xfb, 0x3d, 0x2e,
+  0x0f, 0x43, 0xf9, 0x49, 0x9e, 0xac, 0x02, 0x0a, 0xd4, 0xec, 0x37, 0xe0,
+  0xe6, 0x2c, 0xf4, 0xea, 0x22, 0xd5, 0xd4, 0xe3, 0x08, 0x38, 0x00, 0x1b,
+  0xf9, 0x22, 0x08, 0x17, 0xf2, 0x3b, 0xca, 0x2a, 0x9f, 0xdb, 0xec, 0xfd,
+  0xee, 0xf9, 0x57, 0xd3, 0xd0, 0x81, 0xd1, 0xb3, 0x0c, 0xfc, 0x9b, 0xee,
+  0x11, 0xd9, 0xfa, 0xb7, 0x10, 0xdf, 0xff, 0xf4, 0xf2, 0x16, 0xfe, 0x6e,
+  0xee, 0x0a, 0x08, 0x5f, 0xd1, 0xf7, 0xbf, 0xfe, 0xd8, 0xff, 0xd4, 0xca,
+  0xc4, 0xd3, 0x06, 0xf4, 0x25, 0x3e, 0xd0, 0x7f, 0x00, 0xff, 0xe1, 0xf8,
+  0x0e, 0xe6, 0xef, 0x12, 0x47, 0x18, 0xb4, 0xd5, 0x2d, 0x1c, 0x01, 0x52,
+  0x00, 0x18, 0xd1, 0xf3, 0xa0, 0x49, 0xee, 0xf7, 0xd3, 0x03, 0x53, 0xb7,
+  0xe4, 0x14, 0xe0, 0xee, 0xc4, 0x27, 0xeb, 0x29, 0xe3, 0x1d, 0x57, 0xeb,
+  0x9c, 0x15, 0x20, 0xc3, 0x17, 0xf4, 0xf3, 0x30, 0x28, 0xfe, 0xb1, 0xdb,
+  0x0c, 0xeb, 0x56, 0x1d, 0xf5, 0x04, 0xc7, 0x2e, 0xf0, 0x05, 0x14, 0x1d,
+  0x08, 0xe1, 0x0c, 0x00, 0xf9, 0x92, 0xee, 0xe0, 0xec, 0xdd, 0x2e, 0x1c,
+  0xba, 0xe0, 0x18, 0xf4, 0x18, 0xfb, 0xf9, 0x01, 0x09, 0xda, 0x4e, 0x34,
+  0x0b, 0x12, 0x20, 0x15, 0xf9, 0xf7, 0xfe, 0x1c, 0x0d, 0xf7, 0x17, 0x09,
+  0x1a, 0x17, 0x05, 0x0b, 0x81, 0x11, 0xfa, 0xe4, 0x5e, 0xb5, 0x09, 0xc7,
+  0x19, 0xd7, 0xd7, 0x23, 0xc8, 0xe6, 0x1a, 0x1d, 0x3d, 0x04, 0x3d, 0x08,
+  0x1a, 0xfe, 0xb1, 0xef, 0xf8, 0xe8, 0x2e, 0xd3, 0x1b, 0xe2, 0xed, 0x10,
+  0xf1, 0x15, 0x22, 0x2b, 0x21, 0xf1, 0x0c, 0xe0, 0x9f, 0x1f, 0xda, 0xea,
+  0x06, 0xb3, 0xe3, 0xf2, 0x0f, 0xfd, 0xd0, 0x0e, 0xe4, 0xcc, 0xbe, 0x08,
+  0x15, 0x27, 0x1b, 0x1d, 0xf1, 0xdf, 0xf5, 0xe4, 0x25, 0x08, 0xce, 0x04,
+  0xea, 0xc6, 0xf4, 0xf5, 0xd4, 0xec, 0x1f, 0x06, 0xf7, 0xfd, 0x1a, 0xf7,
+  0x02, 0xbe, 0x44, 0x8f, 0x11, 0xa6, 0x42, 0x48, 0x55, 0x0f, 0xe8, 0x3d,
+  0xc8, 0x0b, 0xf3, 0x09, 0xfc, 0xe5, 0xe7, 0xd7, 0xde, 0x2f, 0x03, 0xbe,
+  0xbe, 0xf2, 0x53, 0xe3, 0xcb, 0xfb, 0x81, 0xec, 0x2c, 0x38, 0x49, 0x35,
+  0x22, 0x19, 0xda, 0x21, 0xf4, 0x26, 0x15, 0x99, 0x30, 0xeb, 0x19, 0xe1,
+  0xc5, 0x22, 0xc8, 0x3f, 0x3b, 0xf1, 0x23, 0x17, 0x3a, 0xd8, 0xb7, 0xce,
+  0xf1, 0x09, 0x19, 0xcb, 0x05, 0xed, 0x92, 0xb5, 0xe0, 0x12, 0x52, 0x01,
+  0xbf, 0x9c, 0x33, 0x09, 0xed, 0x13, 0xdf, 0x21, 0xcd, 0xdd, 0x2a, 0xcc,
+  0x0f, 0x08, 0x22, 0x1f, 0xfd, 0x0b, 0xd6, 0x11, 0x92, 0xae, 0xec, 0xe6,
+  0xdf, 0xbb, 0x0c, 0xb7, 0x07, 0xf9, 0xc5, 0xc8, 0xf4, 0xef, 0x0a, 0xad,
+  0x11, 0x35, 0xef, 0x19, 0x0b, 0x15, 0x06, 0xd9, 0x11, 0x23, 0x09, 0x81,
+  0x36, 0xcb, 0x11, 0x06, 0x05, 0x26, 0x3e, 0xb1, 0xf0, 0xee, 0xbd, 0xf4,
+  0xf3, 0x2e, 0x17, 0x2c, 0x22, 0x1c, 0xcc, 0xf7, 0xc7, 0xe7, 0x22, 0x0a,
+  0xd6, 0x2f, 0x16, 0x0a, 0xf8, 0xf3, 0x4d, 0xd4, 0xde, 0xaf, 0x2c, 0xee,
+  0x15, 0x3f, 0xd6, 0x36, 0x18, 0x15, 0x35, 0x2c, 0xc4, 0xe4, 0x04, 0xfa,
+  0x15, 0xc3, 0xb1, 0x2b, 0x15, 0x17, 0xce, 0x15, 0xb6, 0xf7, 0x22, 0x03,
+  0x06, 0xb7, 0x15, 0xfc, 0xfe, 0xc9, 0x09, 0x18, 0x2a, 0x23, 0x52, 0xdb,
+  0x4e, 0x1d, 0x15, 0xfe, 0xc7, 0x0c, 0xd1, 0xff, 0x0a, 0xfc, 0x11, 0xc0,
+  0x29, 0xe5, 0xc9, 0x13, 0xf6, 0x01, 0x10, 0x3a, 0x06, 0x1d, 0x2d, 0xe7,
+  0x17, 0xed, 0xd1, 0x04, 0x12, 0x36, 0x2b, 0xf7, 0xfa, 0xc8, 0xe4, 0x04,
+  0x65, 0x05, 0x02, 0xce, 0xf3, 0x03, 0xff, 0xdd, 0x0e, 0xf5, 0x02, 0xfa,
+  0xed, 0xe8, 0xee, 0x0e, 0xd0, 0x46, 0xd9, 0xf1, 0x19, 0x0a, 0xde, 0x09,
+  0x21, 0x02, 0x0a, 0xe8, 0xf7, 0x07, 0x0b, 0x2f, 0x08, 0x29, 0xab, 0xf6,
+  0xdf, 0x2a, 0x12, 0xff, 0xdd, 0xe7, 0x0f, 0xdc, 0xfc, 0xf9, 0x21, 0x0a,
+  0x0c, 0x0e, 0x37, 0x7f, 0x18, 0x06, 0xf3, 0xfb, 0x0a, 0xa6, 0x43, 0xde,
+  0xe4, 0xc8, 0xe9, 0xd2, 0xcf, 0x2f, 0xdb, 0xd5, 0x3f, 0xcc, 0xfa, 0x22,
+  0x03, 0x10, 0x0e, 0xea, 0x35, 0xf8, 0xf8, 0x1a, 0x26, 0xdb, 0x2a, 0xd4,
+  0xb0, 0xdd, 0xf8, 0xec, 0xd3, 0x08, 0x14, 0xe1, 0x14, 0x14, 0x36, 0x27,
+  0xd4, 0x11, 0xc4, 0x27, 0x15, 0x14, 0x04, 0xed, 0x22, 0x4e, 0x12, 0x20,
+  0x16, 0xff, 0xe7, 0xfe, 0xf4, 0x2f, 0x0a, 0x3f, 0xd6, 0xeb, 0xc1, 0xe5,
+  0xd4, 0xdb, 0xed, 0xc0, 0xda, 0xd0, 0xe0, 0xec, 0x06, 0xfa, 0x04, 0xda,
+  0xd7, 0xef, 0xc7, 0x13, 0x4e, 0xc5, 0xe6, 0x1b, 0xf6, 0xf2, 0x01, 0xd3,
+  0x40, 0xff, 0xf8, 0x38, 0xfa, 0x06, 0x27, 0xef, 0x2f, 0x02, 0x20, 0xc2,
+  0xdd, 0xe4, 0xce, 0x38, 0x4f, 0xfd, 0xd0, 0xef, 0x09, 0x15, 0xf1, 0x2e,
+  0x48, 0xbb, 0xeb, 0x81, 0x3c, 0xff, 0xfd, 0x00, 0xfb, 0xd8, 0x2d, 0x07,
+  0x48, 0xe2, 0x12, 0x1d, 0xda, 0xe6, 0x1f, 0x54, 0xf5, 0xf5, 0x1f, 0xf6,
+  0xe0, 0x1f, 0x36, 0x2f, 0xe6, 0xf6, 0x04, 0x0d, 0xe6, 0x03, 0x3d, 0xe3,
+  0x16, 0x20, 0xf7, 0x9f, 0x00, 0xd3, 0xe8, 0x10, 0x5a, 0x09, 0x1e, 0xf7,
+  0xd5, 0xe9, 0xe5, 0x0c, 0xe2, 0xf1, 0xbf, 0xd6, 0xcf, 0xc8, 0xdd, 0x17,
+  0xd3, 0xfb, 0xce, 0xd4, 0xd2, 0xd7, 0x01, 0xf1, 0x21, 0xfc, 0xe0, 0xb5,
+  0x0a, 0x21, 0x41, 0x31, 0x14, 0xde, 0xf7, 0xdf, 0xa6, 0x26, 0xf1, 0x21,
+  0xda, 0xfb, 0x96, 0xb7, 0x06, 0x34, 0x62, 0xcd, 0xd3, 0x02, 0xdc, 0xe9,
+  0x10, 0x23, 0xff, 0x0b, 0xec, 0xee, 0x4d, 0xca, 0x2d, 0xfa, 0xee, 0xa0,
+  0xdd, 0xb7, 0x1f, 0x14, 0x1a, 0x1c, 0xd4, 0xea, 0xe8, 0xe8, 0xfc, 0x28,
+  0x6e, 0xc0, 0x0c, 0xe5, 0xbc, 0x17, 0x34, 0x07, 0x0d, 0x16, 0xc3, 0x8f,
+  0xe8, 0xc2, 0x69, 0xdf, 0x8a, 0x08, 0x23, 0x30, 0x32, 0xdc, 0x2a, 0x0d,
+  0xd0, 0xdc, 0x47, 0x5d, 0x03, 0x08, 0x33, 0xfa, 0xff, 0x7f, 0x24, 0x4e,
+  0x29, 0xde, 0x10, 0x11, 0xc9, 0x3a, 0xfe, 0xe0, 0xeb, 0xfc, 0x32, 0xba,
+  0xde, 0xfe, 0xce, 0xf7, 0x33, 0x02, 0x64, 0xd1, 0xb0, 0xe4, 0xf8, 0x14,
+  0x0c, 0xe4, 0xf8, 0x37, 0xf8, 0xe6, 0xfd, 0xd3, 0x18, 0xcf, 0x1e, 0x18,
+  0x08, 0x0e, 0xf1, 0xe7, 0x01, 0x4d, 0xb2, 0xe5, 0x13, 0xdf, 0xec, 0xbd,
+  0xc9, 0x51, 0xfd, 0xf3, 0x05, 0x24, 0x3c, 0xfd, 0x0c, 0x0a, 0xca, 0x0a,
+  0x05, 0x03, 0x5c, 0x2f, 0x7f, 0xd4, 0xc7, 0x30, 0xea, 0xf2, 0xdb, 0x82,
+  0x48, 0x30, 0xbe, 0x37, 0x0d, 0x34, 0xfe, 0xa5, 0x43, 0x1b, 0x45, 0xfc,
+  0xf8, 0xe3, 0xf8, 0x14, 0xf8, 0x40, 0xd8, 0xf3, 0x16, 0x2c, 0xf5, 0xf9,
+  0x1c, 0xf5, 0x50, 0xe3, 0xa8, 0x26, 0x0f, 0xf1, 0x2a, 0x10, 0x98, 0xcd,
+  0x32, 0xef, 0xa7, 0xad, 0xee, 0x35, 0x39, 0xea, 0x6d, 0x00, 0xe2, 0x03,
+  0x3a, 0xfe, 0xc6, 0x40, 0xd0, 0x0f, 0xe0, 0xdf, 0x1c, 0xea, 0x63, 0xfe,
+  0x29, 0x42, 0xeb, 0xe1, 0xd2, 0xcf, 0xa5, 0xd4, 0xd9, 0xe3, 0x69, 0xcc,
+  0xf4, 0x28, 0xb7, 0xd0, 0xf2, 0x18, 0x83, 0x18, 0x20, 0xde, 0x14, 0xf3,
+  0xe5, 0x53, 0x38, 0xcc, 0x19, 0xaa, 0x28, 0xfc, 0x1a, 0x14, 0x50, 0x34,
+  0x1d, 0x0c, 0x19, 0x3a, 0x1e, 0xb5, 0x44, 0xbc, 0xdc, 0xf9, 0xf2, 0x2e,
+  0xec, 0x3f, 0x0d, 0x2d, 0xe2, 0x20, 0x10, 0xf5, 0xa9, 0x16, 0x23, 0xea,
+  0xfe, 0x1e, 0xeb, 0x1f, 0x1f, 0x26, 0x04, 0x2d, 0xdf, 0xd4, 0xef, 0xe6,
+  0xc8, 0x03, 0x1f, 0x66, 0x38, 0xc9, 0xab, 0xe6, 0x63, 0x3e, 0xf4, 0x31,
+  0xb9, 0x31, 0xcf, 0x53, 0xf7, 0xde, 0xfa, 0xc9, 0xd7, 0x46, 0xd2, 0xe9,
+  0xdb, 0x1a, 0x3d, 0x19, 0xdd, 0xfb, 0x34, 0x43, 0xfd, 0xc2, 0x10, 0x38,
+  0x0b, 0x2d, 0xdf, 0xf3, 0x1f, 0x29, 0xfb, 0x33, 0x0e, 0xe8, 0x07, 0xbe,
+  0x1d, 0xfb, 0x2d, 0xc9, 0x2f, 0xca, 0xe8, 0xc7, 0x03, 0x28, 0x00, 0x91,
+  0x47, 0xdf, 0x13, 0xd4, 0x36, 0x0c, 0x4a, 0xec, 0xc5, 0xf6, 0xfb, 0xd5,
+  0xd4, 0x48, 0x43, 0x7f, 0x51, 0xca, 0xb7, 0xec, 0xcd, 0x4f, 0xfb, 0x18,
+  0x11, 0x6f, 0xa8, 0x1e, 0x09, 0x03, 0xe9, 0xd9, 0xc6, 0xd9, 0x02, 0x31,
+  0x3d, 0x33, 0x0a, 0x02, 0xf3, 0xf1, 0x50, 0x0a, 0xcb, 0xd2, 0xd2, 0xc7,
+  0xfa, 0xbc, 0x02, 0xff, 0x2e, 0xd2, 0x07, 0xfd, 0x34, 0x19, 0xe9, 0x99,
+  0x4b, 0x05, 0xe6, 0xf4, 0xef, 0x01, 0x36, 0xbc, 0xee, 0xf1, 0xdf, 0xdd,
+  0x1d, 0xfc, 0x1b, 0xc8, 0x41, 0x39, 0x1f, 0x38, 0x08, 0xed, 0xec, 0xba,
+  0xf8, 0x31, 0xed, 0x49, 0xd0, 0xfa, 0xa2, 0xfe, 0xf4, 0xc0, 0x20, 0xfe,
+  0xa6, 0xf9, 0x10, 0x38, 0x12, 0x19, 0xc8, 0xeb, 0xe9, 0xf1, 0x28, 0xc7,
+  0x25, 0xd6, 0xe8, 0x02, 0xf4, 0x26, 0xc7, 0x08, 0x2c, 0xd1, 0xff, 0xee,
+  0x09, 0x1a, 0xd9, 0xac, 0xf7, 0xf0, 0xe1, 0xe9, 0xaa, 0x35, 0x0e, 0xfd,
+  0x1f, 0x2a, 0x3d, 0xe1, 0x0c, 0x1b, 0xe8, 0x29, 0xf1, 0x27, 0x04, 0xf5,
+  0x15, 0xc2, 0x1f, 0xe7, 0x17, 0xd6, 0x07, 0xe5, 0xd1, 0x11, 0x01, 0xc6,
+  0xc4, 0x7f, 0x4e, 0xf5, 0x05, 0x70, 0x14, 0x01, 0xd5, 0xc9, 0xde, 0x28,
+  0xb3, 0xee, 0xd6, 0x48, 0x9c, 0x43, 0x0d, 0xfb, 0xee, 0xf0, 0x48, 0xd8,
+  0x1c, 0x69, 0x18, 0xa9, 0x15, 0x5a, 0x2e, 0x13, 0x04, 0x21, 0xf1, 0x08,
+  0xfc, 0xaa, 0x28, 0x0d, 0xb0, 0x25, 0xc1, 0x00, 0x53, 0xef, 0xdc, 0xf3,
+  0xef, 0x23, 0xd8, 0x0a, 0x01, 0xe3, 0xa1, 0x3a, 0xe5, 0xf3, 0x05, 0xac,
+  0x08, 0x23, 0x37, 0xfd, 0x16, 0x3a, 0x29, 0xe7, 0x24, 0xb7, 0x32, 0xc9,
+  0xfc, 0xf4, 0xd9, 0xbc, 0x7f, 0x1d, 0x9f, 0xca, 0xd4, 0x06, 0x39, 0xcc,
+  0x47, 0x0f, 0x60, 0x94, 0x03, 0xb8, 0x7e, 0xec, 0x06, 0x48, 0xe2, 0x14,
+  0xef, 0x1c, 0x03, 0xd1, 0x03, 0xd7, 0x3f, 0xe4, 0x5d, 0xf5, 0x2f, 0xd3,
+  0xd3, 0xdd, 0xe5, 0x75, 0x9d, 0x00, 0x46, 0x44, 0x2a, 0xf0, 0xe4, 0x28,
+  0x14, 0xf0, 0x20, 0x17, 0x46, 0x1b, 0x01, 0x0e, 0xe9, 0xcd, 0x0a, 0x40,
+  0x19, 0x63, 0xf7, 0x11, 0x17, 0x0f, 0xcc, 0xe4, 0xf1, 0xf3, 0x3b, 0x06,
+  0x0f, 0xe1, 0x1d, 0x0a, 0xfd, 0x09, 0x1e, 0x09, 0xf1, 0xdb, 0xd8, 0x38,
+  0xf6, 0x1c, 0xd4, 0xd6, 0xfe, 0xf9, 0x01, 0xf8, 0x25, 0xbd, 0x04, 0xe7,
+  0x18, 0xf2, 0xbb, 0x22, 0x05, 0xd7, 0xd3, 0x00, 0xc5, 0xe3, 0x42, 0x0e,
+  0x43, 0xfa, 0x1b, 0x19, 0xd5, 0xd8, 0x21, 0x7f, 0xdf, 0x1b, 0xfc, 0x02,
+  0xf9, 0xeb, 0x38, 0x23, 0x18, 0xc8, 0xc9, 0x03, 0xd5, 0xc9, 0xe3, 0xf1,
+  0x06, 0xf6, 0x0d, 0x09, 0x14, 0x22, 0xde, 0x35, 0x29, 0x12, 0xed, 0x20,
+  0xfd, 0xba, 0x06, 0xe2, 0xca, 0xf7, 0xf1, 0xd5, 0x41, 0xfb, 0x22, 0x06,
+  0x20, 0x05, 0xaf, 0xf6, 0xee, 0xed, 0x31, 0x28, 0x28, 0x21, 0xd5, 0x1c,
+  0x08, 0xf2, 0x27, 0xf8, 0xd7, 0xe4, 0x1d, 0x48, 0x14, 0xe7, 0x2f, 0xf6,
+  0xca, 0x08, 0x12, 0xa7, 0xec, 0x32, 0x11, 0x02, 0xdf, 0x17, 0x1e, 0x2d,
+  0x1d, 0x10, 0xd0, 0xe2, 0xc1, 0x23, 0x15, 0xcc, 0x1a, 0xe9, 0xcd, 0xf6,
+  0x4c, 0xd3, 0xf8, 0xd7, 0xd1, 0xd6, 0xe9, 0xf8, 0x33, 0xbf, 0xf3, 0xba,
+  0xea, 0x1d, 0xf8, 0xda, 0xfa, 0xb2, 0xe7, 0xf6, 0x19, 0x0e, 0xd1, 0xa1,
+  0x5f, 0xd3, 0xf5, 0xe5, 0x24, 0xf8, 0x19, 0x39, 0x29, 0x01, 0xde, 0x4d,
+  0xc6, 0x23, 0x55, 0x15, 0x3b, 0xf7, 0xad, 0xfa, 0x25, 0xed, 0xfb, 0x00,
+  0x2f, 0x1d, 0x13, 0xbe, 0xdb, 0xe8, 0x1a, 0x10, 0xef, 0xc6, 0xc6, 0x17,
+  0xfc, 0x32, 0x13, 0x07, 0x05, 0x6c, 0xc5, 0x52, 0x81, 0x38, 0xcd, 0x06,
+  0xec, 0xfe, 0x0c, 0x24, 0x25, 0x0c, 0xdb, 0x3a, 0xfb, 0xd2, 0x5b, 0x14,
+  0x2f, 0xd4, 0xb6, 0x29, 0xba, 0xc2, 0x26, 0x24, 0xcd, 0xe5, 0x23, 0x5b,
+  0x56, 0x2e, 0xe1, 0xf9, 0x1e, 0xd9, 0xc5, 0xd3, 0xf4, 0x1c, 0x17, 0xfd,
+  0x18, 0x03, 0x00, 0x1b, 0xf1, 0x0a, 0xef, 0x0f, 0x47, 0x55, 0x0a, 0x07,
+  0xf1, 0x1f, 0xdd, 0xcf, 0xdf, 0x08, 0x81, 0xb2, 0xe8, 0x13, 0xf3, 0x09,
+  0x0f, 0x1d, 0x0e, 0xf7, 0xfa, 0x1f, 0x9d, 0xf9, 0x20, 0xd3, 0xbb, 0xf3,
+  0xca, 0xe8, 0xf4, 0xb2, 0x08, 0xdd, 0x17, 0x0e, 0xe2, 0xf7, 0xf4, 0x30,
+  0x27, 0x0b, 0x4a, 0xe4, 0xf6, 0xf1, 0x34, 0xda, 0x28, 0xef, 0x06, 0xfd,
+  0xe4, 0x00, 0xe6, 0x2c, 0xf0, 0xec, 0x17, 0x97, 0x02, 0xfc, 0xf1, 0x35,
+  0x03, 0x2b, 0xf3, 0xfb, 0x35, 0xbb, 0x13, 0x00, 0x18, 0xfa, 0xf7, 0x47,
+  0xf8, 0xef, 0x16, 0xed, 0x05, 0x08, 0xfd, 0xf6, 0xe7, 0x07, 0xeb, 0xee,
+  0xb9, 0xec, 0x11, 0x07, 0xf5, 0x46, 0x21, 0x0f, 0xe3, 0x12, 0x09, 0x3a,
+  0xee, 0x07, 0xbb, 0x0b, 0x1a, 0x02, 0xf7, 0xec, 0xe1, 0xce, 0xf6, 0x23,
+  0xed, 0x04, 0xfd, 0x03, 0xc7, 0xf7, 0x01, 0xd2, 0x24, 0x0b, 0xf1, 0x3b,
+  0xd4, 0xff, 0xe1, 0xcc, 0xf0, 0xde, 0x0f, 0xe7, 0xb7, 0x2b, 0xc5, 0x0f,
+  0x89, 0xbd, 0x05, 0xc5, 0xd4, 0xf6, 0xf9, 0xf5, 0xec, 0x64, 0x12, 0x96,
+  0x06, 0x5b, 0x92, 0x28, 0xfa, 0x68, 0x51, 0x6f, 0x1e, 0x06, 0xc4, 0x3b,
+  0x00, 0x18, 0x18, 0x3c, 0x2c, 0xeb, 0x25, 0xcc, 0xdb, 0x31, 0x3e, 0x07,
+  0xf4, 0xe3, 0xa3, 0xd4, 0xda, 0x23, 0xe8, 0x29, 0x10, 0xd2, 0xbd, 0xde,
+  0xf5, 0x5b, 0xe1, 0xde, 0x3e, 0xdc, 0x67, 0x31, 0xfb, 0x21, 0x43, 0xf1,
+  0xe5, 0xf8, 0x82, 0x01, 0xc4, 0xa3, 0xf9, 0xff, 0x57, 0xdd, 0xac, 0xf5,
+  0xac, 0xde, 0x2f, 0xf9, 0x1a, 0x1e, 0x26, 0x09, 0xea, 0x0c, 0xc5, 0x36,
+  0x0e, 0x1d, 0x20, 0x0e, 0x62, 0x25, 0x45, 0xf8, 0xff, 0xd1, 0xf0, 0x37,
+  0xa4, 0xee, 0xf8, 0x0d, 0xbe, 0x1e, 0xb0, 0x2c, 0xfb, 0x20, 0x2c, 0xf6,
+  0x32, 0xd3, 0x22, 0xee, 0xdf, 0xea, 0xf9, 0x04, 0x16, 0x7f, 0xea, 0x00,
+  0x57, 0x7f, 0xab, 0x3d, 0x05, 0x2a, 0x1a, 0x10, 0xce, 0x1a, 0xff, 0x02,
+  0xa6, 0x10, 0x11, 0xef, 0xfd, 0xdc, 0x0f, 0xe4, 0x0b, 0xdd, 0x0d, 0x29,
+  0x1b, 0x71, 0xe4, 0x05, 0xf9, 0x16, 0xe3, 0x19, 0xe7, 0x1e, 0xff, 0xb2,
+  0x5a, 0x0f, 0xff, 0x13, 0x15, 0xc0, 0xe2, 0x18, 0xbe, 0xd8, 0xd8, 0x1c,
+  0x13, 0xf6, 0xc8, 0xf7, 0x15, 0xc3, 0x05, 0x13, 0xff, 0x11, 0x25, 0x03,
+  0xfd, 0x0d, 0x56, 0x14, 0xd8, 0xcb, 0xcb, 0xe7, 0x47, 0xf3, 0xd4, 0x08,
+  0x3f, 0xe7, 0x1a, 0xf2, 0x01, 0xe1, 0xe5, 0x26, 0x5c, 0xd8, 0xbd, 0xe5,
+  0x36, 0x49, 0xf4, 0xee, 0xfc, 0xb9, 0x1c, 0x41, 0xea, 0xe5, 0xe2, 0xf4,
+  0x44, 0x29, 0xfd, 0x07, 0xfe, 0x32, 0xf8, 0xc4, 0xee, 0x1d, 0xe9, 0x7f,
+  0xf2, 0x35, 0xfc, 0x3f, 0xf5, 0x14, 0xbc, 0x23, 0x21, 0x2b, 0x28, 0x20,
+  0xbd, 0xdf, 0xd4, 0x14, 0xfd, 0x59, 0xe7, 0xec, 0xf1, 0xf7, 0x90, 0x38,
+  0x2b, 0x15, 0xd6, 0x5b, 0xfb, 0x34, 0xe5, 0x2f, 0x25, 0x85, 0xd9, 0x3c,
+  0xbe, 0xcd, 0x71, 0x46, 0xf0, 0xaf, 0x44, 0xcc, 0xe6, 0x54, 0x53, 0x46,
+  0x3f, 0x3a, 0xff, 0x35, 0xbe, 0xdf, 0x02, 0xe6, 0xc1, 0x36, 0xea, 0xe4,
+  0x3e, 0xe6, 0xee, 0x6b, 0x4b, 0xe5, 0x36, 0xb5, 0x36, 0x2d, 0x81, 0xdd,
+  0xd6, 0x0f, 0xb2, 0xe6, 0x1b, 0xf2, 0xdf, 0x9b, 0xa7, 0xcd, 0x34, 0xfc,
+  0x0c, 0x38, 0x15, 0x3e, 0x39, 0x13, 0xac, 0x4a, 0x9d, 0xc0, 0x78, 0xb7,
+  0xc7, 0xf7, 0x07, 0xf9, 0xc7, 0xdb, 0x14, 0x2c, 0xda, 0x41, 0xd9, 0x16,
+  0xfd, 0xb2, 0x2e, 0x30, 0x56, 0x0f, 0x5c, 0x92, 0x37, 0x49, 0xc5, 0xea,
+  0xc8, 0x4f, 0x21, 0xd4, 0x19, 0x24, 0xb3, 0x07, 0xba, 0x2b, 0x19, 0x3d,
+  0x3b, 0xdd, 0x99, 0x1d, 0xf2, 0xd1, 0x14, 0xde, 0xd8, 0x54, 0x28, 0x16,
+  0xd9, 0xf7, 0x4a, 0x23, 0x4e, 0xf5, 0x31, 0x0d, 0x09, 0xf3, 0xf5, 0x25,
+  0xc2, 0xdd, 0x27, 0xf3, 0xa0, 0xa8, 0xb2, 0xe6, 0xf6, 0x1d, 0xe2, 0x07,
+  0x13, 0xce, 0xfe, 0x98, 0xb7, 0x42, 0xe2, 0xf6, 0x06, 0xd4, 0xf2, 0x08,
+  0x1a, 0x23, 0xdf, 0x18, 0xf1, 0xf1, 0x23, 0xd0, 0x1b, 0x3a, 0x3b, 0xfa,
+  0x1d, 0x24, 0x35, 0x2a, 0xf8, 0x4b, 0x15, 0x5e, 0x09, 0x42, 0xd2, 0xf8,
+  0x2f, 0x9a, 0xfe, 0x07, 0x42, 0xf6, 0xc6, 0x76, 0xdb, 0x9b, 0xfa, 0xfc,
+  0x2c, 0xb0, 0x47, 0x5b, 0x02, 0xd4, 0x04, 0xc2, 0x02, 0x4d, 0xb5, 0x43,
+  0xba, 0x27, 0xe4, 0x1d, 0xe2, 0x30, 0xd8, 0x28, 0xe9, 0x29, 0x0a, 0x48,
+  0xda, 0x22, 0xc4, 0x06, 0x09, 0xfd, 0x28, 0xfd, 0xec, 0xc5, 0x15, 0x51,
+  0x5f, 0xdf, 0xdb, 0x3b, 0x4d, 0x2c, 0x16, 0x2b, 0x03, 0xcf, 0xe5, 0xce,
+  0x41, 0x05, 0x32, 0x94, 0xe1, 0xca, 0xe7, 0x2b, 0xc9, 0x7f, 0xac, 0xc3,
+  0x27, 0xd8, 0xea, 0xd9, 0xe8, 0x33, 0xf8, 0xca, 0xe4, 0xa0, 0x5a, 0xf6,
+  0x42, 0xdc, 0xfd, 0x10, 0xf1, 0xf2, 0xe0, 0x23, 0x29, 0xb9, 0x42, 0xf2,
+  0xe6, 0x54, 0x4d, 0xe6, 0x1c, 0x51, 0x03, 0xf9, 0x41, 0xe0, 0x5e, 0x24,
+  0xb1, 0x05, 0x2a, 0x09, 0x95, 0x23, 0x23, 0xff, 0x3d, 0xea, 0x1e, 0x9d,
+  0xf4, 0xbd, 0xe6, 0x4d, 0x62, 0x2e, 0x03, 0x17, 0x65, 0xd4, 0xe4, 0x21,
+  0xe3, 0x29, 0x01, 0xea, 0xbe, 0xd2, 0x19, 0x17, 0xd0, 0xe4, 0x6d, 0xeb,
+  0xd4, 0xd6, 0xb1, 0x37, 0x09, 0xf8, 0x13, 0x66, 0x38, 0xef, 0xc4, 0xf5,
+  0xf5, 0x01, 0x07, 0xa8, 0x35, 0xf0, 0x0e, 0xe4, 0xcd, 0x5c, 0xf0, 0x24,
+  0xb8, 0xf1, 0x13, 0x34, 0x55, 0x35, 0x22, 0x81, 0x45, 0xf7, 0xc2, 0xcd,
+  0xbd, 0xc7, 0x3b, 0x0f, 0x32, 0x3e, 0xda, 0x43, 0xd0, 0x0b, 0x12, 0x46,
+  0xff, 0xfe, 0x58, 0xfb, 0xdb, 0xa7, 0xc9, 0xdf, 0x5e, 0x2e, 0xb1, 0xfa,
+  0xc5, 0xc7, 0xea, 0x11, 0x40, 0xff, 0xf3, 0x09, 0xe3, 0x42, 0xa5, 0x01,
+  0xd8, 0xf9, 0x15, 0x39, 0x55, 0xbc, 0xf9, 0x31, 0xab, 0xe2, 0x1e, 0xdb,
+  0x26, 0x0f, 0x22, 0xef, 0xff, 0xb7, 0x18, 0x1c, 0xdd, 0x4e, 0x2e, 0xc1,
+  0xa9, 0x30, 0x0e, 0x11, 0xc9, 0xf5, 0x34, 0x48, 0xe4, 0xd2, 0xf7, 0x14,
+  0x04, 0xf0, 0xdc, 0xcb, 0xdd, 0x19, 0x02, 0xed, 0xe8, 0x56, 0xec, 0xbe,
+  0xb8, 0xd2, 0x8d, 0x0e, 0xca, 0x59, 0xe0, 0xf7, 0x0b, 0x13, 0xd7, 0x0e,
+  0x4d, 0xe3, 0xb1, 0x7f, 0x0a, 0x50, 0x07, 0xfa, 0x48, 0xc7, 0xd4, 0x56,
+  0x19, 0xca, 0xfc, 0x28, 0xce, 0x0b, 0xda, 0xff, 0xf0, 0xf9, 0x2a, 0xfb,
+  0x04, 0x2d, 0x1a, 0xad, 0x40, 0x29, 0x19, 0xbb, 0xc0, 0x29, 0x1b, 0xb3,
+  0x31, 0x20, 0x0b, 0xf7, 0xbb, 0xa2, 0xf0, 0x32, 0x11, 0xe8, 0x83, 0x1f,
+  0x0a, 0x4b, 0x24, 0xf5, 0x21, 0xd7, 0xea, 0xe3, 0x29, 0xdd, 0xd4, 0x27,
+  0x50, 0xfa, 0x05, 0x12, 0x29, 0x18, 0x0b, 0xe0, 0xd8, 0xfe, 0xc8, 0x67,
+  0xa1, 0xe7, 0xee, 0x1a, 0xe7, 0x27, 0x14, 0x30, 0xd7, 0xba, 0x19, 0x13,
+  0x1b, 0x2c, 0x18, 0xb1, 0x2c, 0xfb, 0xfc, 0xe7, 0x1f, 0xec, 0xd3, 0xa1,
+  0x51, 0xfb, 0xdf, 0xed, 0x09, 0x2b, 0xf6, 0x01, 0x7f, 0x31, 0xff, 0xe3,
+  0x58, 0xfa, 0xf1, 0xe9, 0xcb, 0x41, 0x1a, 0xcf, 0x2b, 0x13, 0x45, 0xe4,
+  0x4f, 0x9b, 0xfd, 0xf7, 0xf2, 0xf7, 0xcf, 0xe3, 0xd2, 0x04, 0x1a, 0xfa,
+  0xe0, 0xbf, 0xfb, 0xe5, 0xe3, 0xb8, 0xdd, 0x26, 0xf9, 0xcf, 0xbf, 0x2c,
+  0xfc, 0xed, 0x2b, 0xd9, 0xb9, 0x0a, 0xf6, 0x0c, 0xff, 0xbf, 0x42, 0x0c,
+  0xb5, 0xfb, 0x2c, 0x3f, 0x15, 0x24, 0xc7, 0x1f, 0xef, 0xd2, 0xf1, 0x31,
+  0x2f, 0x09, 0x33, 0xbe, 0x4e, 0xb8, 0xdc, 0x38, 0x2d, 0xf1, 0xe4, 0x7c,
+  0x04, 0xae, 0xf8, 0x4a, 0xfc, 0x0b, 0x41, 0x3f, 0xfb, 0x29, 0x19, 0x35,
+  0x2c, 0x97, 0x9c, 0x06, 0xb3, 0x2a, 0x28, 0xfb, 0xf6, 0xe0, 0x2a, 0x0e,
+  0x14, 0xd5, 0x99, 0x20, 0x9d, 0xb1, 0x39, 0x31, 0xff, 0xd3, 0xf4, 0x56,
+  0x0e, 0xc9, 0xe9, 0xd7, 0x0e, 0x5d, 0xea, 0x07, 0xe6, 0x15, 0x2f, 0x33,
+  0xf4, 0x04, 0xf5, 0xaf, 0xe0, 0xee, 0xd4, 0x07, 0xc0, 0x1f, 0xc3, 0x14,
+  0x35, 0xfa, 0x62, 0x09, 0x49, 0xf0, 0x34, 0xfe, 0x03, 0x12, 0xe9, 0x34,
+  0xc4, 0xf1, 0xe1, 0x48, 0x05, 0x19, 0xb4, 0x24, 0xfc, 0xd2, 0x7f, 0x38,
+  0x38, 0x16, 0x19, 0x25, 0xdd, 0xa3, 0xfd, 0x3e, 0xae, 0xe7, 0x20, 0xfd,
+  0x0f, 0x01, 0x07, 0xfd, 0x2a, 0xc7, 0x47, 0x29, 0xf2, 0x25, 0x50, 0x17,
+  0x21, 0x2c, 0x25, 0x09, 0xe6, 0xce, 0x5c, 0x3f, 0x3d, 0xbd, 0x1d, 0x0b,
+  0x06, 0x3f, 0xa4, 0xcf, 0xdd, 0x07, 0x07, 0xca, 0xb2, 0x2e, 0xd7, 0x1e,
+  0x09, 0xdf, 0xd5, 0xf8, 0x0b, 0xf7, 0x21, 0x31, 0x3f, 0x28, 0x01, 0x33,
+  0x3c, 0xcc, 0x0e, 0x21, 0x1d, 0xed, 0x24, 0x4e, 0xd9, 0xf7, 0x36, 0x0f,
+  0x1b, 0x37, 0x81, 0x2d, 0xf2, 0x47, 0xdb, 0xb2, 0x4a, 0xec, 0x11, 0x03,
+  0xc4, 0x93, 0xc2, 0xd7, 0xf8, 0x67, 0xec, 0xdd, 0x08, 0x17, 0x0e, 0xdc,
+  0x08, 0x65, 0x32, 0x14, 0xec, 0x28, 0x12, 0xbe, 0xec, 0x14, 0xf5, 0xcf,
+  0xcd, 0xfe, 0x02, 0x59, 0x08, 0x38, 0xdc, 0x2b, 0xed, 0x24, 0xeb, 0x04,
+  0x07, 0x19, 0x21, 0xac, 0x07, 0x25, 0xf7, 0x2a, 0xe0, 0xd0, 0x3d, 0x34,
+  0x10, 0x0d, 0x17, 0x06, 0xe7, 0x24, 0x1b, 0x22, 0xe9, 0xfa, 0xff, 0xde,
+  0x30, 0xbf, 0xf0, 0x71, 0xa5, 0xf5, 0x03, 0x26, 0xdc, 0x0f, 0xc5, 0xef,
+  0xe3, 0x28, 0x25, 0x50, 0x39, 0x00, 0xe9, 0x3f, 0x52, 0xb3, 0xde, 0xf6,
+  0x17, 0x11, 0xd4, 0xfb, 0x1b, 0x20, 0xdd, 0x3b, 0xcb, 0xe5, 0xfa, 0x22,
+  0xe2, 0x59, 0x2c, 0xf2, 0x0f, 0xee, 0x3c, 0x81, 0x0c, 0xe3, 0x20, 0xd9,
+  0x1b, 0xcf, 0xfb, 0x1e, 0xde, 0xd9, 0xcf, 0xe6, 0xd3, 0xe8, 0xe3, 0x9e,
+  0xfa, 0x04, 0x1f, 0x2a, 0xe3, 0xeb, 0xd1, 0xbe, 0xb4, 0xb2, 0xe1, 0x6b,
+  0xb6, 0xfe, 0xec, 0xc9, 0x1a, 0xd2, 0x9f, 0xb7, 0xd0, 0xf2, 0x6d, 0x07,
+  0xbc, 0xc6, 0x0c, 0xd3, 0x04, 0x11, 0x1e, 0x0c, 0xda, 0x06, 0x50, 0xe4,
+  0xbe, 0x06, 0x2b, 0x2a, 0x0d, 0xcd, 0xe8, 0x0c, 0x10, 0x29, 0xfa, 0xc9,
+  0xea, 0x42, 0x18, 0xc3, 0xff, 0xcd, 0x18, 0xbc, 0xf0, 0x16, 0xee, 0xb6,
+  0x18, 0xba, 0x4a, 0xfa, 0xdb, 0xb3, 0xc1, 0xea, 0x37, 0xfb, 0xff, 0xf5,
+  0x35, 0xda, 0xf9, 0x17, 0x27, 0x3c, 0xc9, 0x96, 0xe0, 0x05, 0xfb, 0xc8,
+  0x19, 0x1c, 0x24, 0xae, 0x06, 0xec, 0xe2, 0xd8, 0xb8, 0xff, 0xec, 0xe5,
+  0xef, 0x25, 0x1b, 0x23, 0x2c, 0xe9, 0x08, 0xf1, 0xba, 0xf6, 0x3b, 0xf8,
+  0x0b, 0x0b, 0x1f, 0xb3, 0x21, 0x34, 0xf6, 0xf2, 0xe0, 0x2c, 0x0e, 0x6d,
+  0x1a, 0xe9, 0x39, 0x67, 0xc9, 0xd7, 0xd8, 0xf3, 0xed, 0xeb, 0xf4, 0xdd,
+  0x7a, 0xab, 0xed, 0xd3, 0x10, 0xff, 0xee, 0xf0, 0xfe, 0x17, 0xd1, 0xce,
+  0xf0, 0xc9, 0xe5, 0xb2, 0xf5, 0xdf, 0x0c, 0x32, 0x00, 0xf8, 0x0c, 0xdd,
+  0x05, 0xef, 0x28, 0xf2, 0x09, 0xcc, 0x1c, 0x23, 0x0a, 0xd7, 0xfa, 0xeb,
+  0x27, 0x29, 0x42, 0x14, 0x16, 0x3f, 0xf6, 0xec, 0xea, 0x36, 0x7f, 0xca,
+  0x23, 0x13, 0xe4, 0x3a, 0xe6, 0xe7, 0x05, 0x5a, 0x31, 0xca, 0x51, 0x21,
+  0x32, 0x24, 0xea, 0xcc, 0xd9, 0x1b, 0xfd, 0x23, 0xbb, 0xde, 0xe2, 0x2a,
+  0x21, 0x04, 0x09, 0xdc, 0xfe, 0x49, 0xcf, 0xd9, 0x2d, 0xde, 0xf3, 0xc4,
+  0xe9, 0xe1, 0x99, 0x30, 0x07, 0x37, 0xfe, 0x58, 0x15, 0x2c, 0x35, 0x09,
+  0xe3, 0xf7, 0x31, 0x22, 0xd0, 0x11, 0x3b, 0xc0, 0x96, 0x08, 0xfa, 0xdc,
+  0xb6, 0x7a, 0xdc, 0xcc, 0x25, 0x28, 0xf5, 0xd2, 0x13, 0xdd, 0xd7, 0xf4,
+  0xf7, 0xbe, 0x20, 0xb9, 0x14, 0x18, 0x0a, 0x0e, 0xc7, 0xfd, 0x32, 0x0a,
+  0x57, 0x40, 0x60, 0xfd, 0xb3, 0xb5, 0xea, 0x4c, 0x7c, 0xc0, 0xfd, 0x0d,
+  0xd7, 0xe9, 0x10, 0xfc, 0xe7, 0xe1, 0xcc, 0xe8, 0x05, 0xd0, 0x07, 0x7f,
+  0xbf, 0x00, 0x0f, 0x07, 0x08, 0xb1, 0x4e, 0xf8, 0xc4, 0xe0, 0xf7, 0xda,
+  0x2a, 0xdf, 0xe5, 0x1b, 0xf1, 0x06, 0x0f, 0xae, 0xe4, 0xfd, 0x02, 0xcc,
+  0x3d, 0xfe, 0x07, 0xc2, 0x18, 0xfe, 0xea, 0xe0, 0xff, 0xc9, 0x3f, 0x02,
+  0x2a, 0xe0, 0xdc, 0x00, 0x2b, 0xdc, 0xcf, 0x33, 0xec, 0xeb, 0x08, 0xfb,
+  0x02, 0x02, 0x1d, 0xcb, 0xd5, 0x16, 0x6b, 0x06, 0xb6, 0x22, 0xf9, 0x31,
+  0xbb, 0x05, 0x13, 0xf5, 0xf9, 0xe9, 0xac, 0x0f, 0xff, 0xf8, 0x02, 0xa0,
+  0x5a, 0x23, 0xc6, 0x40, 0x1d, 0x4a, 0xf9, 0x0d, 0x16, 0xe2, 0xb6, 0xfe,
+  0xde, 0xf9, 0xe6, 0x43, 0x89, 0x0f, 0x32, 0x09, 0xf2, 0x14, 0xb2, 0x18,
+  0xe6, 0x5c, 0x5a, 0xe8, 0x1d, 0x48, 0xe3, 0xf4, 0x8c, 0xd5, 0x94, 0xfb,
+  0x3a, 0x6d, 0xf6, 0xdf, 0x05, 0xf9, 0x26, 0xcc, 0x40, 0x1b, 0x09, 0xcc,
+  0xc1, 0x20, 0xe3, 0xaa, 0x88, 0x4a, 0x50, 0xed, 0x12, 0xe7, 0x05, 0x40,
+  0x0f, 0x09, 0xc5, 0xdf, 0x25, 0xf3, 0x20, 0x04, 0x27, 0xb7, 0xf4, 0xf9,
+  0xd1, 0x0b, 0x19, 0xe5, 0xea, 0xaf, 0x21, 0x09, 0x47, 0x2c, 0x09, 0x03,
+  0xb7, 0x28, 0x2e, 0x60, 0xb0, 0x39, 0x1e, 0xbd, 0xad, 0xe4, 0xaa, 0xcc,
+  0x9c, 0x11, 0x5c, 0x2d, 0xd5, 0x29, 0xcf, 0x1a, 0xca, 0xd0, 0x00, 0x08,
+  0xed, 0x36, 0xac, 0x01, 0x7f, 0x8b, 0x1a, 0xde, 0x0a, 0xf2, 0xe7, 0x18,
+  0xdf, 0x13, 0xa1, 0xe1, 0xf3, 0xc6, 0xc3, 0xf9, 0x23, 0x06, 0x19, 0x28,
+  0x31, 0x32, 0xea, 0x2b, 0x02, 0x93, 0xda, 0x34, 0x23, 0xe6, 0x19, 0xd1,
+  0xc4, 0xde, 0xd6, 0xdb, 0x25, 0xef, 0x1f, 0x0f, 0xf5, 0x2a, 0x03, 0xf4,
+  0x19, 0x1f, 0xb8, 0xec, 0xca, 0x0b, 0xf5, 0x09, 0xec, 0x01, 0xda, 0xdc,
+  0xe7, 0x09, 0xe8, 0x25, 0x47, 0xf7, 0x35, 0xf4, 0x3f, 0x10, 0x1e, 0x18,
+  0x1e, 0xfc, 0xe8, 0x2a, 0xf3, 0x1e, 0xeb, 0xc9, 0xdf, 0xf0, 0x2f, 0xbf,
+  0x0a, 0x0b, 0xb6, 0xc6, 0x46, 0x26, 0x0b, 0x35, 0xef, 0xad, 0x02, 0xfa,
+  0x9b, 0xd5, 0xe0, 0xad, 0x9d, 0x23, 0x46, 0xfd, 0x7f, 0x0a, 0xe4, 0xec,
+  0xe5, 0xf6, 0x05, 0x32, 0x40, 0xf0, 0xfc, 0xf3, 0xb6, 0xe5, 0xe8, 0xdb,
+  0xdd, 0x2c, 0xe3, 0xc0, 0xee, 0xe7, 0x4c, 0x00, 0xf2, 0x01, 0xde, 0x0f,
+  0xd5, 0x10, 0x5b, 0x2a, 0xeb, 0xea, 0x5c, 0xa5, 0x4e, 0x22, 0x0b, 0x32,
+  0xe7, 0xf2, 0xfb, 0xe5, 0xec, 0xca, 0xef, 0x06, 0x01, 0xab, 0xe6, 0x2b,
+  0xca, 0x09, 0xbe, 0x09, 0x12, 0x25, 0xd5, 0xac, 0xfa, 0xf0, 0xdd, 0xe1,
+  0xdf, 0xd7, 0x16, 0x05, 0xf3, 0x05, 0x19, 0x03, 0x08, 0xe3, 0x27, 0xc4,
+  0xf3, 0xf6, 0xd0, 0xd2, 0xe3, 0xe2, 0x15, 0x0c, 0x10, 0x33, 0xf1, 0x20,
+  0x38, 0x04, 0x18, 0xf7, 0x09, 0x00, 0xcc, 0x06, 0x15, 0x77, 0x3b, 0x21,
+  0x13, 0x28, 0x0f, 0xe7, 0x29, 0xf5, 0x08, 0x0b, 0x18, 0xf2, 0xe3, 0x24,
+  0xf4, 0x14, 0xb8, 0x27, 0xe5, 0x04, 0x26, 0x2c, 0xe7, 0x16, 0x22, 0x00,
+  0xe8, 0xd4, 0xbb, 0x17, 0x81, 0x10, 0x30, 0x18, 0xfa, 0xc0, 0xf1, 0xfd,
+  0x26, 0xc9, 0x12, 0x09, 0xeb, 0xe7, 0x2e, 0x2d, 0x01, 0xbe, 0xe6, 0xe8,
+  0xc2, 0x0e, 0xc1, 0xef, 0xf8, 0x05, 0x07, 0xed, 0x35, 0xff, 0xb8, 0xf1,
+  0xe4, 0xc4, 0x18, 0x22, 0x40, 0x48, 0x17, 0xbf, 0xe2, 0xdf, 0x32, 0xf0,
+  0x16, 0xfc, 0x0e, 0x55, 0xd6, 0xd3, 0xc9, 0xf8, 0x1e, 0x01, 0xd8, 0x1e,
+  0x3a, 0xef, 0x5c, 0xf6, 0xe7, 0xe6, 0xd1, 0x1e, 0x8f, 0xe9, 0x2a, 0x03,
+  0x1c, 0xd9, 0xc4, 0xfa, 0x41, 0x78, 0x17, 0x1a, 0x31, 0x2e, 0xbf, 0x47,
+  0x17, 0xff, 0x92, 0x1f, 0x42, 0xf3, 0x01, 0xdc, 0x2e, 0xfe, 0xd5, 0xb0,
+  0xf4, 0xb4, 0x07, 0x1e, 0x3a, 0xf9, 0x19, 0x34, 0x40, 0xde, 0xc9, 0xda,
+  0x08, 0x31, 0x10, 0x2f, 0xdb, 0xf6, 0xea, 0xfa, 0x36, 0x1a, 0x21, 0x1e,
+  0x54, 0xf3, 0x0d, 0x45, 0xeb, 0x58, 0x4a, 0x72, 0xe6, 0x50, 0xc2, 0xd1,
+  0xec, 0xa4, 0xfb, 0x3b, 0xdb, 0xf1, 0x87, 0x1a, 0x81, 0x27, 0x56, 0xea,
+  0xe8, 0xd9, 0xfc, 0x1b, 0x1d, 0x42, 0xbd, 0xc7, 0x6f, 0xac, 0xd3, 0xde,
+  0x04, 0xee, 0xf4, 0x2d, 0x9b, 0xd5, 0xfe, 0x14, 0xcd, 0x2c, 0x14, 0xc5,
+  0x22, 0x23, 0x9d, 0xc3, 0x1b, 0x3d, 0x17, 0x0d, 0x19, 0x2d, 0xd8, 0x11,
+  0x2b, 0x17, 0xa5, 0x24, 0x0d, 0xdb, 0xe2, 0x0d, 0x11, 0xc5, 0xd4, 0x29,
+  0x54, 0x20, 0x50, 0xd4, 0xbf, 0x36, 0x17, 0x4b, 0x13, 0x4a, 0x0c, 0xf3,
+  0xeb, 0xfc, 0xef, 0xd8, 0xc4, 0xbc, 0x5c, 0xfe, 0x35, 0x7f, 0xe4, 0x04,
+  0xdd, 0x3d, 0xfa, 0x14, 0x14, 0xf2, 0x9c, 0x3d, 0xf6, 0xf5, 0x1d, 0xde,
+  0xf8, 0x3d, 0xee, 0xe3, 0xbd, 0x41, 0x2e, 0x0f, 0xbd, 0x35, 0xcb, 0xa3,
+  0x35, 0x10, 0xea, 0xc4, 0x00, 0x09, 0x0d, 0x07, 0x23, 0x4a, 0xe1, 0xc6,
+  0x2b, 0xcd, 0xd1, 0x36, 0x2c, 0xe0, 0xf0, 0xff, 0xfe, 0xe0, 0x19, 0xfd,
+  0xef, 0xfe, 0x20, 0xf9, 0xf7, 0xf5, 0xd8, 0x23, 0xbd, 0x37, 0xef, 0x0c,
+  0xf6, 0xf6, 0xba, 0x22, 0xb6, 0x15, 0x15, 0x14, 0x1c, 0xce, 0x0d, 0xd1,
+  0x3b, 0x44, 0xe1, 0x46, 0x6c, 0xfa, 0x07, 0x04, 0xbf, 0xff, 0x0b, 0x03,
+  0xf3, 0xf4, 0x98, 0xb4, 0xc7, 0xdf, 0xdb, 0xe6, 0xdb, 0xad, 0x1f, 0xa4,
+  0xcf, 0xf8, 0xd6, 0xe7, 0xc9, 0x0e, 0xf7, 0xb4, 0xbd, 0x7e, 0xd8, 0x28,
+  0xf0, 0x3f, 0x1e, 0xeb, 0x0b, 0xf2, 0x1f, 0xc9, 0xfb, 0xff, 0x4b, 0xd3,
+  0xd5, 0x38, 0x10, 0x13, 0x45, 0x1a, 0x18, 0xd9, 0xc3, 0x05, 0x1b, 0x45,
+  0xe6, 0x08, 0x33, 0xd0, 0x03, 0x81, 0xd6, 0xfc, 0xbf, 0x2e, 0xf3, 0x1e,
+  0x0e, 0x1e, 0x28, 0x01, 0x2a, 0x01, 0x24, 0x31, 0x27, 0xd4, 0x21, 0xee,
+  0x35, 0x79, 0x00, 0x09, 0xeb, 0x19, 0xe5, 0xee, 0x26, 0xde, 0xc5, 0x1e,
+  0x18, 0xf2, 0x09, 0x38, 0x03, 0x1e, 0x23, 0x19, 0xdc, 0xdb, 0xfa, 0xf3,
+  0x34, 0xb3, 0xe9, 0x48, 0xf4, 0x34, 0xe8, 0x1e, 0x59, 0x75, 0x09, 0xe5,
+  0x14, 0xe0, 0xe7, 0x18, 0x5e, 0x10, 0x04, 0xe7, 0xff, 0x22, 0xac, 0x14,
+  0xc3, 0x15, 0x11, 0xc0, 0x29, 0x53, 0x3f, 0xa8, 0x25, 0x69, 0x33, 0xff,
+  0x16, 0xca, 0xdd, 0xcb, 0x00, 0xb8, 0xf1, 0x3d, 0xb6, 0xf7, 0xc5, 0xcd,
+  0x3c, 0xc2, 0xb4, 0x18, 0x15, 0xcb, 0xfd, 0xf3, 0x81, 0xf5, 0xfe, 0xe0,
+  0x4f, 0xe5, 0x1f, 0x41, 0x1b, 0x45, 0xfd, 0x0c, 0xcb, 0x45, 0x27, 0x0f,
+  0xd1, 0x24, 0x45, 0x09, 0xd2, 0x58, 0xb5, 0x09, 0x3d, 0xcf, 0xc2, 0x33,
+  0x05, 0x0c, 0xf0, 0x2b, 0x5d, 0x46, 0xf6, 0x1f, 0x16, 0x0b, 0x2a, 0x07,
+  0xc1, 0x01, 0x1b, 0x11, 0xbd, 0xf5, 0xe6, 0x31, 0xbf, 0xde, 0x35, 0x0c,
+  0xdd, 0x02, 0xdf, 0xd7, 0x2b, 0xfe, 0xff, 0x37, 0x05, 0xf9, 0xbb, 0xcc,
+  0xb6, 0x02, 0x10, 0xd8, 0x02, 0x87, 0xf1, 0x21, 0x19, 0x12, 0xcb, 0xb9,
+  0x58, 0x22, 0xce, 0x49, 0xfb, 0xdb, 0xf2, 0x03, 0x0b, 0x01, 0x17, 0x2d,
+  0x00, 0xb3, 0xe0, 0x08, 0x15, 0xbf, 0x14, 0x44, 0x46, 0xea, 0x3b, 0xe7,
+  0x46, 0xfc, 0xda, 0xd7, 0x45, 0xce, 0x3f, 0xfc, 0x32, 0xeb, 0xc8, 0xfe,
+  0xe8, 0x0b, 0xcf, 0x33, 0xfb, 0x05, 0xb9, 0xfd, 0xe5, 0xef, 0xbc, 0x25,
+  0x37, 0xcf, 0xff, 0xdf, 0xa9, 0xf5, 0x01, 0xf4, 0x44, 0xf5, 0xcb, 0x38,
+  0xd0, 0xeb, 0x11, 0x36, 0xfc, 0xe1, 0x10, 0xec, 0xe2, 0xf8, 0x1d, 0xfb,
+  0xfe, 0x3f, 0xe2, 0x22, 0xfc, 0xc6, 0xc9, 0x48, 0xb1, 0xf5, 0x3c, 0xee,
+  0xf1, 0x25, 0x0d, 0x62, 0xf2, 0xef, 0x1b, 0x03, 0xfb, 0xbf, 0x10, 0xec,
+  0x23, 0xd4, 0x0c, 0x16, 0xee, 0xe0, 0x14, 0xeb, 0xfa, 0xe7, 0x05, 0x02,
+  0xd9, 0xff, 0x01, 0x1a, 0xc6, 0xd8, 0xf1, 0xcb, 0x2d, 0x1a, 0x28, 0xf9,
+  0xe4, 0xed, 0xfd, 0x56, 0x0b, 0x05, 0x81, 0xea, 0x1c, 0x19, 0x1c, 0xef,
+  0x03, 0xcc, 0xf1, 0xf2, 0x2d, 0x44, 0x11, 0x47, 0xd8, 0x38, 0xbb, 0x20,
+  0xea, 0x09, 0x5e, 0xe4, 0x1c, 0x02, 0xcd, 0x1c, 0xfc, 0xc3, 0xca, 0xe0,
+  0xe3, 0xb8, 0x22, 0xe0, 0x2e, 0xec, 0xe7, 0xf2, 0x0c, 0xfd, 0xec, 0x35,
+  0xe5, 0xd5, 0xca, 0x18, 0x2b, 0xba, 0x1f, 0xaf, 0xf8, 0xd5, 0xee, 0x58,
+  0xe0, 0x23, 0xb4, 0x38, 0x64, 0xc7, 0x0b, 0xf3, 0xc8, 0x27, 0xdf, 0xd7,
+  0xf9, 0x35, 0xe2, 0x03, 0x36, 0x21, 0x12, 0xb1, 0xc9, 0x31, 0xf1, 0x24,
+  0x00, 0xf8, 0xea, 0xc3, 0xeb, 0xf6, 0xb8, 0x1a, 0x19, 0x1a, 0x5a, 0x31,
+  0x0c, 0x28, 0xdc, 0x15, 0xcc, 0xf8, 0x19, 0xf6, 0xc0, 0xea, 0x06, 0xe4,
+  0x00, 0xc0, 0xc1, 0xe3, 0xf1, 0xd7, 0xdd, 0xdf, 0x5a, 0x1e, 0xce, 0xf3,
+  0x71, 0x22, 0xde, 0xf6, 0x72, 0xb1, 0x34, 0xdf, 0xe2, 0xec, 0x0f, 0x40,
+  0xce, 0xba, 0x1c, 0xb2, 0x0c, 0x08, 0xdc, 0xe3, 0xcf, 0x20, 0x14, 0x17,
+  0x7f, 0xed, 0xdb, 0x01, 0x44, 0xcc, 0xd5, 0x59, 0xff, 0x1c, 0xef, 0xd6,
+  0x54, 0x43, 0xf7, 0xc3, 0xfd, 0xf6, 0xc9, 0xf4, 0xfa, 0xf9, 0xe0, 0x2c,
+  0xc9, 0x11, 0x0f, 0xd6, 0xf1, 0x15, 0xf0, 0xe3, 0xe3, 0xde, 0x0b, 0x40,
+  0x14, 0xe5, 0xee, 0xcf, 0x3f, 0xdf, 0x37, 0x58, 0xfb, 0x7f, 0xa2, 0x32,
+  0x01, 0xb7, 0x1f, 0x0f, 0xf3, 0xff, 0x02, 0xd7, 0xf6, 0x37, 0xf0, 0xf5,
+  0x1d, 0x25, 0x36, 0xc3, 0xe5, 0x07, 0xe0, 0x3b, 0x1d, 0x2e, 0x05, 0xf3,
+  0xcc, 0xdc, 0xda, 0xfd, 0xf9, 0x34, 0x43, 0x3e, 0xec, 0xe4, 0x29, 0xfa,
+  0xdc, 0xc0, 0xed, 0x1f, 0x0d, 0xb3, 0xde, 0xcd, 0x0e, 0x2f, 0xfd, 0x3f,
+  0xfa, 0xde, 0xf6, 0xea, 0x1a, 0x3f, 0x16, 0xed, 0x07, 0xe2, 0xfc, 0x05,
+  0x26, 0xf9, 0x40, 0x09, 0xfe, 0x30, 0x04, 0x26, 0x12, 0x19, 0x20, 0xfd,
+  0x11, 0x0c, 0x00, 0xcc, 0xf6, 0xf9, 0xfc, 0x28, 0x50, 0x27, 0xd6, 0xcf,
+  0xf9, 0xf5, 0x11, 0xc1, 0x09, 0x2b, 0xe5, 0xd3, 0x0c, 0x1c, 0xfe, 0xfc,
+  0xef, 0xc4, 0xf2, 0x3f, 0xf8, 0x35, 0xd5, 0xb2, 0xdb, 0x3f, 0x13, 0xbb,
+  0xf2, 0xe0, 0x12, 0xfb, 0x15, 0xbd, 0x34, 0xca, 0x0b, 0x16, 0x25, 0xd4,
+  0x06, 0x0e, 0xda, 0x25, 0xe2, 0x34, 0xdf, 0x18, 0x23, 0x13, 0x52, 0xb5,
+  0x2b, 0x0f, 0x18, 0x16, 0xe5, 0xc5, 0x14, 0x10, 0x40, 0x57, 0x34, 0xca,
+  0x97, 0x0f, 0x16, 0x19, 0xea, 0xf5, 0x25, 0xed, 0xe9, 0xf3, 0xbc, 0x44,
+  0xeb, 0x17, 0xc5, 0xb7, 0x30, 0xdb, 0xbf, 0x10, 0x1d, 0x05, 0x08, 0xf1,
+  0xcd, 0xf1, 0xf9, 0xf6, 0xf2, 0xbf, 0x4d, 0xdc, 0xc0, 0x14, 0x1b, 0xc6,
+  0x24, 0xff, 0x16, 0xff, 0x38, 0xfe, 0x13, 0x04, 0x03, 0xaa, 0xdf, 0x45,
+  0x35, 0xe8, 0x7f, 0xe5, 0x01, 0xff, 0xdb, 0xfe, 0xe8, 0xda, 0xcb, 0xe4,
+  0x08, 0xd5, 0x1a, 0x02, 0xf3, 0x1a, 0x04, 0x1c, 0xf9, 0xbf, 0xdd, 0xe8,
+  0x1a, 0xec, 0xc7, 0x14, 0x36, 0x15, 0xc7, 0xde, 0xd4, 0x27, 0x5c, 0x03,
+  0x4d, 0xf3, 0xd0, 0xac, 0xce, 0xf4, 0xa7, 0xf2, 0x0d, 0x01, 0xfb, 0x11,
+  0xe8, 0x29, 0x01, 0xfa, 0x16, 0x28, 0xf2, 0xdf, 0x28, 0xb7, 0xd5, 0x0b,
+  0x10, 0x2d, 0x09, 0xf8, 0x42, 0xbf, 0x24, 0xb8, 0xc8, 0x8a, 0x1c, 0x4c,
+  0x29, 0xf0, 0x29, 0xef, 0xe9, 0xe7, 0x20, 0xf2, 0x6a, 0x28, 0x01, 0xf7,
+  0x2f, 0x14, 0xf7, 0x07, 0x57, 0x09, 0xfb, 0x9c, 0x18, 0xfb, 0x1e, 0xef,
+  0x81, 0x07, 0x25, 0xed, 0x53, 0xea, 0x24, 0xd3, 0x09, 0xf1, 0xe8, 0x41,
+  0x1a, 0x0b, 0x30, 0x3d, 0x40, 0xf3, 0xe8, 0xfb, 0xfd, 0x47, 0xda, 0xd7,
+  0xff, 0xb4, 0x04, 0x06, 0xfb, 0x18, 0x0f, 0xf2, 0xd0, 0x2f, 0xd4, 0x23,
+  0xf2, 0x32, 0x0b, 0xe9, 0xdb, 0x0e, 0x0e, 0xbd, 0xeb, 0x02, 0xfb, 0xf1,
+  0xf2, 0x01, 0x0e, 0x08, 0xf0, 0x27, 0xe2, 0xfa, 0x22, 0xe1, 0xe2, 0x09,
+  0xbe, 0x0c, 0xf2, 0xdc, 0x3e, 0xdb, 0x0e, 0xad, 0x11, 0xfa, 0x3b, 0xd8,
+  0xc9, 0xc0, 0xef, 0xcb, 0xd6, 0xe5, 0xf3, 0x04, 0xcc, 0xee, 0xd8, 0x39,
+  0x25, 0x20, 0xf6, 0xa5, 0xc9, 0x73, 0x10, 0x0d, 0xeb, 0xf3, 0xf1, 0x53,
+  0x38, 0xe9, 0x5f, 0xa2, 0x46, 0x14, 0x51, 0xfc, 0xef, 0x10, 0x0f, 0xd8,
+  0xcd, 0x17, 0x02, 0x9e, 0xfa, 0x0f, 0x15, 0x46, 0x3d, 0x00, 0x20, 0x41,
+  0x0f, 0x1b, 0x2f, 0x28, 0x41, 0x14, 0x2e, 0x1c, 0x37, 0x0b, 0xfb, 0xc8,
+  0xee, 0xd0, 0x6d, 0x0a, 0xf4, 0x0c, 0xd5, 0xe8, 0xfa, 0x50, 0x05, 0x2e,
+  0x3c, 0xdc, 0xb1, 0x35, 0x81, 0x2b, 0xe1, 0x9a, 0xcd, 0xaf, 0x17, 0xf9,
+  0xc0, 0x04, 0x4e, 0xfd, 0x07, 0xc1, 0xc6, 0x5e, 0xfd, 0x10, 0xc4, 0x0e,
+  0xc9, 0xbd, 0xb8, 0xfe, 0xde, 0x1b, 0x03, 0x1c, 0xfb, 0x28, 0x0a, 0x0c,
+  0x0f, 0x0d, 0x06, 0x0c, 0x35, 0xf6, 0x3e, 0x6d, 0x3e, 0x11, 0xef, 0x2e,
+  0xdb, 0xdd, 0xde, 0x51, 0x04, 0x0d, 0xdc, 0xf4, 0xb6, 0xfe, 0x34, 0x22,
+  0xd1, 0xfe, 0x24, 0xe5, 0x1a, 0xbc, 0x06, 0x09, 0x04, 0x19, 0xc8, 0xe7,
+  0x09, 0xe2, 0x0a, 0xea, 0x15, 0x18, 0xf2, 0x15, 0xe2, 0x28, 0xe5, 0xc6,
+  0x5d, 0xde, 0xd0, 0xe3, 0x2b, 0x17, 0x94, 0x31, 0xf1, 0x2f, 0xe0, 0xde,
+  0xc8, 0xcd, 0x32, 0xf5, 0x0e, 0xde, 0xfb, 0x18, 0x24, 0x27, 0x0d, 0xf9,
+  0x0f, 0xd6, 0xdf, 0xe8, 0xb4, 0xde, 0x19, 0xb9, 0x00, 0x00, 0x39, 0xfd,
+  0x14, 0xe8, 0xd3, 0xfd, 0xd2, 0xc2, 0xff, 0x60, 0xe1, 0xf6, 0x39, 0xd7,
+  0x05, 0x14, 0x81, 0x1f, 0x01, 0x1d, 0xb6, 0x4c, 0xe5, 0xd7, 0xcf, 0xf3,
+  0x0d, 0xfe, 0xdf, 0xf7, 0xf9, 0xda, 0xdc, 0xea, 0xde, 0xf5, 0xbf, 0x24,
+  0x26, 0xb3, 0xfe, 0x1f, 0x5c, 0x0f, 0x0d, 0xcd, 0x23, 0xd5, 0x03, 0xed,
+  0x26, 0xfc, 0x26, 0xe3, 0xe7, 0x28, 0xec, 0xdc, 0x3a, 0xd8, 0xbd, 0xd0,
+  0x14, 0xfc, 0x95, 0xb5, 0x25, 0x0f, 0xef, 0x4a, 0x71, 0x2a, 0x0f, 0x34,
+  0x0e, 0x29, 0x04, 0xdf, 0xa3, 0xfa, 0x58, 0xf0, 0x01, 0x0b, 0x64, 0x5b,
+  0x1c, 0xa6, 0xa0, 0xdd, 0xd8, 0x00, 0xef, 0x70, 0x07, 0x09, 0xb7, 0xe8,
+  0x86, 0x16, 0xe6, 0xef, 0x25, 0x58, 0xbf, 0x39, 0x29, 0x1d, 0x32, 0xe1,
+  0xce, 0x69, 0x0e, 0xa6, 0xf4, 0x0c, 0x02, 0xe1, 0x3c, 0xff, 0xf6, 0xe9,
+  0xe4, 0x01, 0xf4, 0x10, 0x1b, 0x26, 0x01, 0x43, 0x5a, 0x07, 0xda, 0xcc,
+  0xdd, 0xf3, 0x23, 0x55, 0x9a, 0x04, 0x07, 0x13, 0xd8, 0xf6, 0x50, 0x64,
+  0x10, 0x31, 0x20, 0xb9, 0x1c, 0xd2, 0x3d, 0xbd, 0xf5, 0x21, 0x49, 0x00,
+  0xdd, 0x15, 0xfd, 0x3f, 0x81, 0x35, 0x2d, 0xd3, 0x2e, 0xe1, 0xab, 0xf4,
+  0xc3, 0x0d, 0xfa, 0xe5, 0x3c, 0xd7, 0xd2, 0x36, 0x40, 0xb3, 0xd6, 0xbc,
+  0x27, 0x0f, 0xc0, 0xd9, 0x40, 0x03, 0x85, 0xb3, 0xde, 0x27, 0x47, 0xcf,
+  0xed, 0x81, 0xdd, 0x95, 0xec, 0x25, 0xbd, 0x1a, 0xd5, 0x20, 0xff, 0x11,
+  0x28, 0x19, 0xe1, 0xb4, 0x04, 0xc6, 0xf5, 0xfc, 0xfa, 0xf7, 0xeb, 0x31,
+  0x5c, 0x27, 0x7b, 0xd6, 0x16, 0x4d, 0x09, 0x57, 0xae, 0xdd, 0xf1, 0xd2,
+  0xc7, 0xf6, 0x5b, 0xf7, 0xf7, 0x13, 0x08, 0xf5, 0x5e, 0x27, 0xee, 0xee,
+  0x34, 0x2c, 0xe2, 0x0b, 0x05, 0x1f, 0xfd, 0x30, 0xe7, 0x20, 0xd3, 0xe5,
+  0xbd, 0xdc, 0x3d, 0xf4, 0xe8, 0xc3, 0x3e, 0xaa, 0xfd, 0xec, 0xe5, 0x01,
+  0xd9, 0xee, 0xc0, 0x4e, 0xe8, 0x07, 0x1c, 0x93, 0xe7, 0xd6, 0x07, 0xf7,
+  0x24, 0xd6, 0xfa, 0x42, 0xb8, 0xde, 0x10, 0x7d, 0xc3, 0x06, 0xe0, 0x0e,
+  0xed, 0xbb, 0xaa, 0xa2, 0xf1, 0xa6, 0xc5, 0x0b, 0xdf, 0x33, 0xf7, 0x4f,
+  0xf7, 0x20, 0xd6, 0x0b, 0x0a, 0xfa, 0xf5, 0x31, 0x52, 0xda, 0x00, 0xb7,
+  0x41, 0x06, 0x06, 0x59, 0x07, 0xe9, 0xe4, 0xf9, 0x43, 0x45, 0x0f, 0xe6,
+  0x37, 0x0b, 0x05, 0x81, 0xad, 0x18, 0xf1, 0xf8, 0x1f, 0xfa, 0x41, 0x45,
+  0xf1, 0xcd, 0x2b, 0xcc, 0xd7, 0x0a, 0xc1, 0x09, 0xce, 0x09, 0x4d, 0x13,
+  0x38, 0xf2, 0x26, 0xb6, 0x08, 0xcb, 0xd2, 0x15, 0x17, 0xe2, 0x40, 0x1f,
+  0x13, 0xc6, 0x23, 0xcf, 0x34, 0x0f, 0xdc, 0xdf, 0x13, 0xeb, 0x14, 0x0c,
+  0x11, 0xe2, 0xf6, 0xc9, 0x3c, 0xf5, 0xc7, 0xdf, 0xf9, 0xf8, 0x07, 0x36,
+  0x2d, 0x1b, 0x4d, 0xf2, 0xd7, 0x21, 0xfd, 0x18, 0x01, 0xda, 0x52, 0x20,
+  0xf2, 0x03, 0xc5, 0x61, 0x49, 0xb7, 0xee, 0x19, 0xff, 0x17, 0x55, 0xeb,
+  0x13, 0x2b, 0xc8, 0xfa, 0x38, 0x1f, 0xfd, 0xea, 0xec, 0xf7, 0x0a, 0xde,
+  0xee, 0x4b, 0xf2, 0xe4, 0x01, 0xfa, 0x08, 0x0d, 0x4b, 0xe1, 0x0b, 0x0f,
+  0xbc, 0xda, 0xa0, 0x05, 0xec, 0x0a, 0x5b, 0xf1, 0x13, 0x12, 0xdd, 0xbe,
+  0xf4, 0x35, 0x15, 0x81, 0x12, 0xfe, 0x14, 0x07, 0xdc, 0xeb, 0xf4, 0xd5,
+  0xe6, 0x25, 0xfe, 0x0a, 0x4e, 0xff, 0x32, 0x18, 0xd3, 0x19, 0x00, 0xed,
+  0xf1, 0x1e, 0xcb, 0xdd, 0xcf, 0x07, 0x0b, 0x13, 0x10, 0x0c, 0xf6, 0x07,
+  0xe1, 0xef, 0xb0, 0xc5, 0xec, 0x04, 0xeb, 0xfb, 0x0f, 0xe6, 0x17, 0xb9,
+  0x50, 0xeb, 0x33, 0x0b, 0x2c, 0x24, 0x09, 0xfa, 0x15, 0x60, 0x2c, 0xdf,
+  0xf3, 0xfb, 0xa1, 0x24, 0xea, 0x40, 0xc4, 0x35, 0xf7, 0x0f, 0xf1, 0x10,
+  0xef, 0xea, 0x10, 0x1f, 0xd1, 0x0f, 0x19, 0x0c, 0x1b, 0x72, 0x16, 0x31,
+  0xfd, 0xca, 0xe8, 0x2c, 0x27, 0xd8, 0xe9, 0x04, 0x1a, 0x19, 0xe9, 0xd5,
+  0x10, 0x0b, 0x12, 0xd9, 0xe9, 0xff, 0x0e, 0x41, 0xd1, 0x09, 0x08, 0xea,
+  0x0a, 0xf8, 0x0d, 0xf1, 0xe3, 0xfa, 0xf7, 0x53, 0x34, 0xbf, 0x09, 0x0e,
+  0xf6, 0x02, 0x2a, 0x11, 0x2b, 0xcf, 0x10, 0xbf, 0x09, 0xef, 0xec, 0xe2,
+  0xc8, 0xcf, 0xee, 0xea, 0xce, 0x93, 0xe6, 0x0e, 0x16, 0x05, 0x22, 0xe1,
+  0x08, 0xc5, 0xd0, 0xd6, 0x0c, 0x17, 0xf2, 0xe6, 0xf7, 0x2a, 0x1a, 0xe8,
+  0xe0, 0xd7, 0x0c, 0xff, 0x1a, 0x05, 0xd6, 0xdf, 0xf4, 0x15, 0xe2, 0xe0,
+  0x02, 0xd6, 0x0b, 0x23, 0x19, 0xf6, 0x08, 0x05, 0x2b, 0x7f, 0x22, 0xe3,
+  0xc2, 0xaa, 0x05, 0x04, 0x85, 0x05, 0x40, 0x0f, 0x01, 0x23, 0x15, 0xee,
+  0xf0, 0xee, 0x01, 0xfb, 0xcc, 0xea, 0xeb, 0x2a, 0xf3, 0xe0, 0xda, 0x2c,
+  0xca, 0xfb, 0xcc, 0xeb, 0x15, 0xc7, 0xf5, 0x11, 0xcf, 0x03, 0x00, 0x01,
+  0x03, 0x2f, 0x27, 0xe2, 0xfb, 0xb0, 0x49, 0x1f, 0x16, 0xec, 0xef, 0xe4,
+  0xdc, 0x10, 0x52, 0xc6, 0x0f, 0x15, 0xfb, 0x2a, 0xb3, 0x40, 0xeb, 0x3d,
+  0x15, 0xff, 0x02, 0x11, 0x05, 0x00, 0xec, 0xcd, 0xeb, 0xdc, 0x1d, 0xd3,
+  0x0c, 0xf7, 0x08, 0xed, 0x05, 0x13, 0x13, 0x17, 0xff, 0xf0, 0xff, 0x0a,
+  0xf6, 0xe0, 0xf8, 0xfa, 0x1d, 0x05, 0x08, 0x00, 0x1a, 0x02, 0xc2, 0x01,
+  0xc7, 0x23, 0x08, 0xfd, 0xcf, 0xe2, 0x1a, 0xfd, 0x39, 0xf3, 0xeb, 0x14,
+  0x1c, 0xfd, 0xcc, 0xfc, 0x0d, 0x3e, 0x08, 0x17, 0xf0, 0xe9, 0x42, 0xf1,
+  0xf2, 0x07, 0x10, 0x18, 0x0b, 0x37, 0x0b, 0x13, 0xce, 0x04, 0xf3, 0xfb,
+  0x03, 0xf2, 0x0d, 0xe1, 0xfa, 0xff, 0x0a, 0x0f, 0x13, 0xd9, 0x10, 0xde,
+  0xfa, 0xfc, 0x06, 0xf6, 0x1f, 0x07, 0x00, 0xe0, 0x25, 0x0a, 0x14, 0x03,
+  0x0c, 0xef, 0xdc, 0xed, 0x0e, 0x1c, 0xf0, 0xf6, 0xf3, 0xef, 0x17, 0x14,
+  0x3f, 0xd8, 0x7f, 0x24, 0xcd, 0xcd, 0x0f, 0xf0, 0xde, 0x2a, 0x00, 0x28,
+  0x05, 0xfc, 0xfc, 0x57, 0x0d, 0x0a, 0xf8, 0x03, 0xe7, 0x16, 0xfa, 0xee,
+  0xf4, 0xd4, 0x13, 0xf6, 0x1f, 0x29, 0x12, 0x0c, 0x00, 0x18, 0xeb, 0xe1,
+  0x44, 0xd9, 0x02, 0x2b, 0xed, 0x8f, 0x52, 0xbc, 0xc4, 0xf5, 0xe1, 0xdd,
+  0x2a, 0xd1, 0x05, 0xf6, 0xa3, 0x4a, 0x41, 0x23, 0x29, 0x16, 0xc0, 0xec,
+  0x0c, 0x04, 0x87, 0x38, 0x18, 0x93, 0xdf, 0x0b, 0xff, 0x65, 0x2f, 0xca,
+  0xe8, 0xc9, 0xe2, 0x5f, 0x1f, 0x08, 0x57, 0xbe, 0xc5, 0x08, 0x16, 0xd3,
+  0xe8, 0x13, 0xfa, 0xaf, 0x33, 0xea, 0x92, 0x2c, 0x32, 0x06, 0x38, 0xe2,
+  0xeb, 0xc6, 0xfd, 0xe0, 0xaa, 0xe4, 0x1e, 0xb7, 0xde, 0xbe, 0x32, 0xac,
+  0x2b, 0x81, 0xcb, 0xdc, 0x10, 0x1a, 0xa1, 0x11, 0x15, 0xe7, 0xc5, 0xe2,
+  0x2d, 0xe1, 0xf2, 0x76, 0x2e, 0xe3, 0x18, 0x4a, 0x18, 0x38, 0x31, 0x38,
+  0xb5, 0xfd, 0x25, 0x0b, 0x1a, 0x33, 0xda, 0xea, 0x09, 0x15, 0xaa, 0x0d,
+  0x23, 0x1d, 0x98, 0xdb, 0x1f, 0xf9, 0xb9, 0xee, 0x05, 0x27, 0xd9, 0xcd,
+  0x12, 0x06, 0xc1, 0xe1, 0x63, 0x40, 0x1f, 0x10, 0x31, 0xe1, 0xfe, 0xc9,
+  0xf3, 0xe6, 0xca, 0x40, 0xd2, 0x3a, 0xf6, 0x04, 0x32, 0x85, 0xe6, 0x23,
+  0x00, 0x1c, 0xff, 0xfc, 0xf4, 0xbe, 0x17, 0x33, 0xaa, 0x53, 0xc1, 0xe6,
+  0xe2, 0x00, 0x0d, 0x0b, 0x01, 0x11, 0x9e, 0x7f, 0x34, 0xf6, 0xf0, 0xfe,
+  0xff, 0x66, 0x46, 0xf5, 0x54, 0xa0, 0xea, 0x17, 0x0c, 0x20, 0xe5, 0x39,
+  0x8b, 0x20, 0x45, 0xe3, 0xdf, 0xe8, 0xe9, 0x1d, 0xc2, 0xbf, 0x02, 0x3f,
+  0x17, 0xdb, 0xff, 0xac, 0x21, 0xc0, 0xb4, 0xf9, 0x01, 0xda, 0x1c, 0x5a,
+  0x0e, 0x66, 0xe2, 0x1a, 0xf9, 0x01, 0x36, 0xe8, 0x2a, 0xc8, 0x01, 0xd4,
+  0x70, 0x29, 0xd8, 0xf7, 0xfe, 0x49, 0xc8, 0xbb, 0xfb, 0x0a, 0xfe, 0x13,
+  0xfe, 0xe1, 0x16, 0xdf, 0xd9, 0xda, 0x49, 0xc8, 0xfb, 0x49, 0x0a, 0xfa,
+  0xae, 0x1a, 0x02, 0x0b, 0xee, 0x00, 0xf8, 0xc4, 0xe5, 0xe8, 0x17, 0x23,
+  0xdf, 0x7f, 0xe4, 0x49, 0x15, 0xe9, 0x9a, 0x44, 0x3c, 0x0e, 0x1e, 0x31,
+  0x3c, 0xee, 0x1a, 0x06, 0xfc, 0x13, 0x14, 0x49, 0xdb, 0xe2, 0xd5, 0x0b,
+  0x11, 0xe3, 0x3a, 0xb3, 0xee, 0xff, 0x27, 0xe3, 0x1b, 0xea, 0xfd, 0x21,
+  0xde, 0xd3, 0x1d, 0x8c, 0x2c, 0x17, 0x14, 0xfa, 0x36, 0x12, 0x4a, 0x69,
+  0x21, 0x4d, 0xb7, 0xce, 0xd2, 0xff, 0x12, 0xf5, 0x49, 0xea, 0x00, 0x09,
+  0x12, 0xf4, 0xdb, 0x35, 0x29, 0xe1, 0xdc, 0xf9, 0x4c, 0x0d, 0x51, 0x1c,
+  0x10, 0x21, 0x23, 0xe4, 0xcd, 0xb5, 0xf8, 0x3f, 0x36, 0xcc, 0xea, 0xec,
+  0x52, 0x0e, 0xb7, 0x4a, 0x18, 0x03, 0xb3, 0xe6, 0x0d, 0x21, 0xe7, 0xb8,
+  0x5e, 0x1c, 0x9e, 0xcd, 0xe7, 0x95, 0xff, 0xe1, 0x02, 0xfa, 0xe7, 0x31,
+  0xf6, 0xdd, 0xe1, 0x3d, 0xf6, 0xed, 0xf9, 0xcd, 0x0c, 0xf8, 0x30, 0xe1,
+  0xac, 0x14, 0xf9, 0x8e, 0x9a, 0xef, 0x43, 0xd6, 0xf2, 0x1d, 0x13, 0x1a,
+  0xa2, 0x0b, 0xee, 0x02, 0xee, 0xd0, 0x0a, 0x2b, 0x1c, 0x81, 0xef, 0x0a,
+  0xeb, 0xe5, 0x15, 0xf0, 0x30, 0x16, 0xfe, 0xcc, 0xcc, 0x0c, 0x20, 0x41,
+  0x0f, 0xe7, 0xfe, 0xfd, 0x1e, 0xf9, 0xf4, 0x0c, 0xdd, 0x06, 0x8b, 0xde,
+  0xf6, 0x07, 0xe6, 0x29, 0x2e, 0xef, 0xe0, 0x1e, 0xdc, 0xf0, 0xff, 0x2f,
+  0xf8, 0x43, 0xd3, 0xdc, 0xe6, 0xe0, 0xc7, 0x06, 0xee, 0xfa, 0x23, 0x13,
+  0xe8, 0xe8, 0x1d, 0xf9, 0x21, 0xe0, 0x1e, 0x2a, 0x04, 0xe1, 0x27, 0x05,
+  0xd8, 0x34, 0xc5, 0xd5, 0xcb, 0xdf, 0xf4, 0x02, 0x48, 0xf1, 0xfe, 0x1b,
+  0xfa, 0x4d, 0xf0, 0xec, 0x47, 0x03, 0x23, 0xfd, 0x2f, 0xe3, 0x6a, 0x2b,
+  0xbb, 0xb3, 0x1a, 0xf9, 0xfd, 0x16, 0x38, 0xe3, 0x1b, 0xe4, 0xe4, 0x21,
+  0x48, 0xf1, 0x1c, 0xfe, 0x0d, 0x00, 0xe5, 0x1b, 0xd2, 0x08, 0xf6, 0xbe,
+  0xf1, 0x3b, 0xf4, 0xdd, 0xb7, 0x06, 0x15, 0xe6, 0x15, 0xe9, 0x36, 0x01,
+  0xf7, 0xd9, 0x3b, 0x00, 0x9c, 0x39, 0xe9, 0x25, 0x20, 0x08, 0xff, 0xfd,
+  0xc9, 0x70, 0xf2, 0xdb, 0x1d, 0xdf, 0x04, 0xee, 0x37, 0x23, 0x22, 0x2c,
+  0xe9, 0x4e, 0x10, 0xd8, 0x23, 0xf2, 0x52, 0x01, 0x0b, 0x17, 0x56, 0x18,
+  0xd6, 0xd1, 0xee, 0x27, 0x44, 0xf5, 0xdf, 0xbb, 0xfb, 0xcc, 0x06, 0xc8,
+  0x19, 0x25, 0x0d, 0x28, 0x19, 0x06, 0xc6, 0xf7, 0xc9, 0xf7, 0x0c, 0xbe,
+  0xf4, 0x05, 0x06, 0xff, 0xc1, 0x10, 0xf7, 0xf1, 0xf1, 0xdb, 0x0a, 0x47,
+  0x22, 0x2c, 0xe3, 0xdc, 0xf2, 0x7f, 0xd6, 0xc9, 0x19, 0xcf, 0xc1, 0xec,
+  0xdb, 0x24, 0x1e, 0xfd, 0x22, 0x05, 0xbc, 0x1f, 0x4b, 0xf0, 0x07, 0x3e,
+  0x3b, 0xf6, 0xcf, 0x0a, 0xac, 0x0e, 0x3c, 0xf6, 0xd5, 0xe9, 0xa9, 0xcd,
+  0xc1, 0x22, 0x21, 0xc1, 0x2d, 0x3e, 0xe3, 0x5a, 0x88, 0x35, 0x03, 0x26,
+  0xd5, 0x25, 0x21, 0x3a, 0xf2, 0xfc, 0x07, 0xeb, 0x2d, 0x1c, 0xdf, 0xcf,
+  0xda, 0xf8, 0xf7, 0xc6, 0xda, 0x24, 0x5a, 0xdc, 0xed, 0x09, 0xfb, 0x23,
+  0x49, 0x0c, 0x03, 0xd6, 0x38, 0xc5, 0x01, 0x30, 0x9e, 0xf7, 0x4e, 0xd8,
+  0xee, 0x30, 0x07, 0x0f, 0x12, 0xc6, 0x19, 0xee, 0x20, 0xd0, 0xa7, 0x7f,
+  0xa3, 0x05, 0x16, 0x24, 0x32, 0xd3, 0x14, 0xfa, 0x41, 0x5f, 0xbb, 0x40,
+  0x3c, 0x19, 0x2e, 0x2a, 0xda, 0xc2, 0x01, 0x0f, 0xe7, 0xde, 0xe4, 0xf1,
+  0xbe, 0xf3, 0xe0, 0xe9, 0x1e, 0x47, 0x2d, 0x2d, 0xdc, 0x24, 0x55, 0xe7,
+  0x21, 0xb6, 0xd2, 0x0e, 0xfb, 0xe2, 0xd5, 0xfa, 0xf4, 0xd3, 0xc9, 0x06,
+  0xfb, 0xe0, 0x9c, 0x61, 0x0a, 0x04, 0xf3, 0x3a, 0xee, 0xa8, 0x02, 0xae,
+  0x21, 0x15, 0xd5, 0xe5, 0xfb, 0x2e, 0x09, 0x33, 0x51, 0xea, 0x0d, 0xd1,
+  0xd0, 0xe6, 0xaa, 0x28, 0xf3, 0x0f, 0xf6, 0xf4, 0xcd, 0x97, 0x46, 0xe3,
+  0x38, 0xef, 0x1f, 0xe2, 0xb7, 0xe8, 0x6f, 0xf1, 0x12, 0x21, 0xa5, 0x2e,
+  0x43, 0xea, 0x02, 0x0d, 0x55, 0xc1, 0x0f, 0xdd, 0x01, 0x20, 0xaa, 0xbd,
+  0x1d, 0x65, 0xf2, 0x2c, 0x08, 0x40, 0xbf, 0xfe, 0x2b, 0xb1, 0xd6, 0xfd,
+  0x0f, 0xf2, 0x07, 0x51, 0x36, 0x4f, 0xda, 0xde, 0xe6, 0x44, 0x69, 0xdd,
+  0xab, 0xcc, 0xa3, 0xcc, 0x0c, 0xf1, 0xe7, 0x21, 0x51, 0xf6, 0x47, 0xcd,
+  0xf1, 0xf9, 0xdb, 0x17, 0xb2, 0xea, 0xe9, 0xaf, 0xe2, 0xda, 0xd9, 0xed,
+  0x68, 0xbb, 0x21, 0x7a, 0x04, 0x02, 0x45, 0xf5, 0xa2, 0xdf, 0xe7, 0xf3,
+  0xf0, 0xf7, 0x1f, 0xd3, 0x0c, 0xcd, 0xa1, 0x81, 0xe4, 0x15, 0x39, 0x3c,
+  0xe2, 0xe0, 0x0a, 0x2c, 0x0e, 0xe5, 0x09, 0xb3, 0xc3, 0xe0, 0xfd, 0x30,
+  0x1e, 0x15, 0x15, 0x31, 0xe6, 0x03, 0xeb, 0x60, 0xd9, 0xf5, 0x2d, 0xc4,
+  0x06, 0x18, 0xf8, 0xa3, 0xbd, 0xf1, 0xde, 0xf0, 0xce, 0x16, 0x13, 0x3c,
+  0x06, 0x39, 0x21, 0x0b, 0xe1, 0x33, 0xdf, 0x07, 0x18, 0x4c, 0x40, 0x00,
+  0x1c, 0x05, 0x1e, 0x11, 0x0b, 0x26, 0xda, 0xe4, 0x28, 0xd6, 0x26, 0xfe,
+  0x0a, 0x51, 0xde, 0x0a, 0x30, 0xe9, 0xfb, 0x2f, 0x05, 0x34, 0xfd, 0x2e,
+  0xfe, 0x0c, 0xe4, 0x15, 0x28, 0x0a, 0xb2, 0xe6, 0x25, 0xea, 0x30, 0xdc,
+  0x1a, 0x57, 0xd6, 0xc9, 0x33, 0xba, 0x2a, 0xdb, 0x18, 0x25, 0xe1, 0x04,
+  0x26, 0xd4, 0x81, 0xfe, 0xff, 0xbb, 0x25, 0xc0, 0x54, 0xf0, 0x4b, 0xc1,
+  0xd3, 0xe5, 0x15, 0xe1, 0x05, 0x06, 0xc9, 0x5b, 0x06, 0x1a, 0xfd, 0xcf,
+  0x16, 0xd7, 0x01, 0xe6, 0x4f, 0x33, 0x0f, 0x2a, 0xe2, 0xde, 0x0e, 0x2d,
+  0xa0, 0x36, 0x34, 0x3b, 0xfb, 0x25, 0x0e, 0x6a, 0xf7, 0xfd, 0xec, 0xf4,
+  0x3f, 0x39, 0xb8, 0xe4, 0x15, 0xfc, 0x21, 0x4a, 0x24, 0x10, 0xeb, 0x42,
+  0x0a, 0x30, 0xd0, 0xe8, 0x48, 0x41, 0x2c, 0xcb, 0xcb, 0xe1, 0x06, 0x15,
+  0xcf, 0x55, 0x27, 0xa2, 0xc2, 0xfd, 0xe5, 0xc2, 0xf2, 0x46, 0x1b, 0xa0,
+  0x12, 0x1a, 0xee, 0x04, 0xdd, 0xd5, 0x18, 0xf9, 0x23, 0x09, 0xff, 0x2a,
+  0x01, 0x14, 0xeb, 0x27, 0x19, 0x6a, 0x18, 0x4c, 0xe7, 0xf0, 0xba, 0xfd,
+  0x1c, 0xea, 0x03, 0x37, 0xcd, 0xb8, 0xe7, 0x3a, 0xa1, 0x41, 0x16, 0x26,
+  0xdd, 0xb4, 0x00, 0x26, 0xad, 0xd3, 0xb0, 0x0e, 0xf5, 0x3b, 0xe4, 0x8a,
+  0x0d, 0xe0, 0xe0, 0x36, 0x04, 0x08, 0x28, 0xce, 0x2c, 0xeb, 0x33, 0xde,
+  0x28, 0xd5, 0x9f, 0xcb, 0x52, 0x07, 0xe7, 0x90, 0xda, 0x0e, 0x1e, 0x16,
+  0x0f, 0x0c, 0xf9, 0xf3, 0xdb, 0xc5, 0x14, 0x49, 0xce, 0x7f, 0x05, 0x0e,
+  0x2e, 0xa7, 0x34, 0x31, 0x0e, 0xab, 0x1b, 0xb1, 0xc1, 0x05, 0xe2, 0xda,
+  0xcf, 0x12, 0x49, 0xb1, 0x3b, 0x0a, 0x71, 0x27, 0x04, 0xdc, 0x1b, 0xe4,
+  0xf8, 0x32, 0x3f, 0xf3, 0xef, 0x0e, 0x26, 0xd8, 0xe9, 0x4c, 0x0d, 0x1a,
+  0xfb, 0x31, 0x43, 0x60, 0x7f, 0x1d, 0xdb, 0x2e, 0x25, 0x1d, 0xc9, 0x10,
+  0x36, 0x32, 0xea, 0xd0, 0xc0, 0x17, 0x2a, 0x00, 0x32, 0x01, 0x1d, 0xfe,
+  0xe8, 0x1f, 0xe8, 0x29, 0xd4, 0xd9, 0xd0, 0xd8, 0xe7, 0xf1, 0xd7, 0xd6,
+  0xf2, 0xfb, 0xf3, 0xd5, 0xef, 0x2c, 0x13, 0xdb, 0x10, 0x02, 0xc0, 0x10,
+  0x31, 0x07, 0x8f, 0xcd, 0xce, 0x38, 0xb8, 0x1b, 0xbb, 0xbc, 0xcd, 0x27,
+  0x45, 0xd9, 0xd1, 0x2c, 0xcf, 0xb5, 0xfe, 0xce, 0xfe, 0x1d, 0xf4, 0x1e,
+  0x29, 0x10, 0xf3, 0x27, 0xbb, 0xa6, 0xe9, 0x13, 0x42, 0x49, 0xf7, 0xf2,
+  0x18, 0x39, 0xe6, 0x0d, 0x38, 0x09, 0xef, 0x34, 0xf3, 0xcb, 0xfd, 0x20,
+  0x9b, 0x1c, 0x0f, 0xb2, 0xc0, 0xcf, 0x27, 0x3c, 0xdb, 0x08, 0xc1, 0x13,
+  0x26, 0x47, 0x2c, 0x29, 0xa0, 0xec, 0x0a, 0xb6, 0x23, 0xa3, 0xd1, 0x50,
+  0xb2, 0x37, 0xea, 0x1e, 0xc6, 0x36, 0xf3, 0x5a, 0xbe, 0xb9, 0x16, 0x00,
+  0xe2, 0xf4, 0x13, 0xd4, 0xc9, 0xfc, 0x3f, 0x2a, 0xb4, 0x44, 0x9c, 0xb6,
+  0x35, 0x13, 0xc3, 0x15, 0x31, 0xa9, 0x5d, 0xc5, 0x65, 0xfb, 0xf1, 0x7f,
+  0x63, 0x17, 0x15, 0x07, 0x1e, 0x0e, 0x9f, 0x2a, 0xcb, 0x06, 0xe1, 0x49,
+  0x33, 0x00, 0x05, 0x16, 0xbe, 0xed, 0x37, 0xf0, 0x30, 0xba, 0x05, 0x37,
+  0x21, 0xb1, 0x05, 0xdb, 0xe1, 0xe2, 0xf2, 0xc6, 0xf2, 0xfc, 0xc6, 0x16,
+  0x16, 0x23, 0x11, 0x24, 0x1c, 0x19, 0xea, 0x26, 0xf0, 0x55, 0x09, 0xff,
+  0x43, 0x36, 0x52, 0xa6, 0x47, 0x11, 0x55, 0xc0, 0xb3, 0xfe, 0xf0, 0xd8,
+  0xe2, 0xed, 0x34, 0x30, 0x18, 0x32, 0xc1, 0x1c, 0x3b, 0x2b, 0xaf, 0xd3,
+  0xfc, 0x1c, 0xd3, 0x24, 0x18, 0x09, 0x3d, 0xb1, 0xaa, 0x7b, 0x29, 0xf2,
+  0x3a, 0x4b, 0xd2, 0x0e, 0x06, 0x05, 0xf5, 0x15, 0x04, 0x14, 0x16, 0x40,
+  0xf7, 0x7f, 0xd3, 0xcb, 0x3e, 0x14, 0x1d, 0xf1, 0x23, 0xdf, 0x08, 0x48,
+  0xec, 0xa4, 0xc5, 0xff, 0xec, 0xd4, 0x1e, 0xd0, 0x0c, 0xf3, 0x66, 0xb5,
+  0xb5, 0x41, 0xcc, 0x5b, 0xf8, 0xc2, 0xc0, 0xe1, 0xd1, 0xeb, 0xe4, 0x33,
+  0x5d, 0x2a, 0xff, 0xef, 0xcb, 0x6f, 0x01, 0x23, 0x4d, 0x2b, 0x1a, 0xf5,
+  0x13, 0xcb, 0xc1, 0xe1, 0xaf, 0x51, 0x06, 0xf1, 0x39, 0xf5, 0x11, 0x0d,
+  0xf6, 0x28, 0x40, 0x1b, 0x47, 0x0c, 0x30, 0xaf, 0x0e, 0xdd, 0xd1, 0xd5,
+  0xf9, 0x5d, 0x48, 0xbb, 0x1d, 0x9b, 0x21, 0xcf, 0x19, 0x97, 0xf3, 0xf2,
+  0xe8, 0x12, 0x2a, 0x0e, 0x17, 0xf4, 0xfb, 0xfc, 0xcd, 0xc3, 0xd4, 0xe0,
+  0xb9, 0xb3, 0xa7, 0x09, 0x25, 0xbf, 0xea, 0x07, 0xfb, 0xf7, 0xa8, 0xe9,
+  0xf5, 0xd8, 0x03, 0x35, 0x13, 0x14, 0x12, 0x01, 0xfd, 0x40, 0xfc, 0x0c,
+  0xf4, 0xfa, 0xfd, 0x1e, 0xea, 0x07, 0x10, 0x00, 0xfe, 0x04, 0xbb, 0xd3,
+  0x03, 0xf0, 0xad, 0xe9, 0x1a, 0x7f, 0x22, 0x3a, 0xf0, 0x36, 0x1e, 0x31,
+  0xd7, 0x08, 0x06, 0x3f, 0x02, 0x16, 0x04, 0xe2, 0x26, 0xec, 0x29, 0xe2,
+  0xf0, 0xfd, 0xbd, 0xc0, 0x4d, 0xdc, 0x2b, 0xc2, 0xf9, 0xfd, 0x30, 0x23,
+  0x1d, 0x17, 0x32, 0x1b, 0xce, 0xf3, 0xe2, 0xe6, 0xef, 0x0c, 0x03, 0xfa,
+  0xfa, 0x1a, 0xeb, 0xcc, 0x2e, 0x0a, 0xe7, 0x26, 0xf8, 0x11, 0x39, 0xf3,
+  0x69, 0x4f, 0x0a, 0xd3, 0x06, 0x16, 0xf0, 0xef, 0x20, 0x31, 0x18, 0x0a,
+  0xbb, 0xf7, 0xa7, 0x35, 0x04, 0x1b, 0x0e, 0x2a, 0xc3, 0x1a, 0xfc, 0xf5,
+  0xd6, 0xe5, 0x3a, 0xdd, 0xc2, 0xf5, 0xef, 0xf1, 0xf1, 0xc5, 0xfb, 0xc3,
+  0xec, 0x31, 0x19, 0xee, 0x0c, 0xaf, 0xfc, 0xff, 0x0d, 0xc1, 0xdb, 0x0c,
+  0x38, 0x31, 0xde, 0x20, 0xe9, 0xc9, 0xa3, 0xfb, 0xf3, 0xee, 0x1e, 0x6a,
+  0x95, 0xb8, 0x5e, 0xeb, 0x3d, 0xe4, 0xd3, 0x1b, 0x03, 0x32, 0xe5, 0xd3,
+  0x32, 0x44, 0x24, 0xcb, 0xff, 0x58, 0x1d, 0xf7, 0x3b, 0xf9, 0xee, 0x00,
+  0xff, 0xd0, 0x08, 0xf3, 0x59, 0x0e, 0x07, 0xde, 0xcc, 0xaf, 0xc1, 0x59,
+  0x4d, 0x3a, 0xcc, 0xe8, 0xb4, 0x32, 0x17, 0xef, 0x54, 0xcb, 0xff, 0x0f,
+  0x00, 0xda, 0xe2, 0x40, 0xfb, 0xcd, 0x24, 0xbf, 0xee, 0xf6, 0xbc, 0xe0,
+  0xe5, 0x64, 0x09, 0xdd, 0x37, 0xdf, 0x3f, 0x8b, 0x08, 0xd2, 0xae, 0x3d,
+  0x41, 0x26, 0x54, 0xf4, 0x26, 0xb5, 0xae, 0xaf, 0x76, 0x65, 0x15, 0x78,
+  0xdc, 0x81, 0xb6, 0xe0, 0xee, 0x37, 0xf6, 0xd9, 0xfe, 0x0f, 0x02, 0xb4,
+  0xe8, 0xef, 0x20, 0xcb, 0x0b, 0x12, 0xb9, 0xde, 0xe0, 0x0e, 0x25, 0xea,
+  0x32, 0xa3, 0x2f, 0x29, 0xc6, 0x23, 0x1f, 0xed, 0xbe, 0xfd, 0x3a, 0xef,
+  0xf4, 0xe6, 0x14, 0x06, 0x81, 0xc6, 0x99, 0x05, 0xab, 0x40, 0xf5, 0x12,
+  0x03, 0xd6, 0xd9, 0x1d, 0x04, 0x6b, 0x0a, 0xf9, 0xe4, 0x2a, 0x66, 0x6c,
+  0xea, 0xed, 0x1d, 0x23, 0xec, 0xe8, 0x02, 0x18, 0xd3, 0xeb, 0xbb, 0x00,
+  0xf1, 0xd9, 0xaa, 0xd6, 0x09, 0x10, 0xfb, 0xc4, 0x16, 0xeb, 0xde, 0xde,
+  0xe1, 0x22, 0x34, 0xd0, 0xc0, 0x31, 0x3e, 0xd3, 0xd5, 0xe6, 0xb0, 0x30,
+  0x07, 0xef, 0x3e, 0xc4, 0x26, 0x3d, 0xce, 0xfc, 0x4d, 0x39, 0xc8, 0x10,
+  0x01, 0xc8, 0x1a, 0x26, 0x0f, 0xb8, 0x00, 0xea, 0x42, 0x3a, 0x1b, 0x2a,
+  0x07, 0x43, 0x90, 0xf4, 0xd7, 0xf6, 0xe4, 0xbc, 0xed, 0xce, 0x01, 0x07,
+  0x78, 0xdf, 0x73, 0xb1, 0xd0, 0xac, 0xbb, 0x30, 0x07, 0x30, 0x46, 0xf6,
+  0x14, 0xfb, 0x0b, 0xd4, 0x3c, 0x02, 0x3f, 0xfe, 0x20, 0xcb, 0xf1, 0x0a,
+  0x09, 0xeb, 0x2d, 0xf2, 0x31, 0x11, 0xcb, 0xbc, 0xf8, 0xc7, 0xe4, 0xaa,
+  0xfd, 0xc4, 0x02, 0x28, 0xa6, 0x02, 0x23, 0x37, 0xf7, 0xe4, 0x01, 0x51,
+  0xb4, 0x05, 0xd8, 0x13, 0xff, 0x0b, 0x38, 0xc9, 0x27, 0x1d, 0xfd, 0xbe,
+  0xf6, 0xee, 0xd7, 0x04, 0x53, 0xb2, 0xe1, 0xe1, 0xb5, 0xdb, 0xce, 0xff,
+  0xab, 0x44, 0xe1, 0xdd, 0x0a, 0xd0, 0x00, 0xeb, 0xe8, 0xc6, 0x0c, 0xe0,
+  0xc0, 0xde, 0x21, 0x0c, 0xfd, 0xe5, 0xae, 0xff, 0xd2, 0xe4, 0x16, 0xac,
+  0x23, 0x04, 0x1f, 0xfa, 0xbe, 0x13, 0x23, 0x18, 0xcd, 0x2d, 0xe7, 0x37,
+  0xff, 0xf1, 0x26, 0x0e, 0x04, 0x26, 0xf2, 0xd8, 0xe0, 0xd3, 0x4c, 0xa2,
+  0x06, 0xfc, 0x31, 0x4d, 0xb5, 0xfa, 0x07, 0xe1, 0x29, 0x20, 0x67, 0xe9,
+  0x03, 0xcf, 0xe3, 0xe5, 0x1c, 0x05, 0xf6, 0x01, 0x05, 0xb9, 0x21, 0xd3,
+  0x07, 0xed, 0x3d, 0x2a, 0x81, 0xe4, 0xfb, 0x5b, 0x09, 0x1c, 0xe1, 0xed,
+  0x10, 0xfa, 0xa6, 0x2d, 0x6c, 0xe3, 0x94, 0xd8, 0xb5, 0x2b, 0x3a, 0xbd,
+  0xe4, 0xe0, 0xc0, 0xdd, 0x18, 0x3f, 0xb6, 0x57, 0xf8, 0xdf, 0xea, 0x1d,
+  0x1a, 0xef, 0xc0, 0xec, 0x2a, 0x81, 0xd9, 0x20, 0x8a, 0xe3, 0x0e, 0x24,
+  0x4d, 0x2f, 0x38, 0x07, 0xdf, 0x27, 0xe0, 0x4f, 0xdf, 0x21, 0xf3, 0x03,
+  0xb0, 0x02, 0x3d, 0xbc, 0x00, 0x35, 0xd4, 0xf8, 0x59, 0x07, 0x0a, 0xf9,
+  0x09, 0x30, 0x40, 0x19, 0x01, 0xff, 0x19, 0x39, 0x2d, 0x54, 0x1f, 0x0d,
+  0xbe, 0xb4, 0x3c, 0xcc, 0x0e, 0xb1, 0xfd, 0x2f, 0xf8, 0xf6, 0xe7, 0x13,
+  0xec, 0xa8, 0xb9, 0x38, 0xd9, 0xe2, 0xfb, 0xdc, 0xdd, 0xaf, 0x2a, 0x09,
+  0x3c, 0xee, 0x18, 0x4e, 0x03, 0xf9, 0xe4, 0x4c, 0x12, 0x1f, 0x9d, 0xe4,
+  0x00, 0xbc, 0xb7, 0xb3, 0xf5, 0xd8, 0xb6, 0x01, 0xf1, 0x57, 0xb3, 0x6c,
+  0xd0, 0xfb, 0x30, 0xf3, 0xde, 0x06, 0x02, 0xf7, 0x0a, 0xe6, 0xbf, 0x00,
+  0x0e, 0xf8, 0x31, 0xe5, 0xe9, 0xc9, 0x9c, 0x2f, 0xfa, 0x29, 0xea, 0x06,
+  0xb9, 0xfc, 0xf8, 0x31, 0x46, 0xe9, 0x1b, 0x0c, 0xd2, 0x05, 0x4a, 0xf0,
+  0x34, 0x06, 0x4c, 0xf5, 0x3c, 0xf5, 0xd6, 0xf6, 0x23, 0x07, 0x9d, 0x50,
+  0xea, 0xba, 0x98, 0x35, 0x27, 0xdf, 0x3f, 0xfe, 0x2d, 0xea, 0x1e, 0xe8,
+  0xdb, 0x1e, 0xeb, 0xef, 0xfc, 0x51, 0x3e, 0x90, 0x47, 0x10, 0xe5, 0x1b,
+  0x01, 0x3d, 0x26, 0x2f, 0x14, 0x26, 0x1b, 0xd3, 0xe1, 0xe9, 0x20, 0xfc,
+  0xb4, 0xff, 0xc9, 0x1e, 0xe0, 0x08, 0x21, 0x2b, 0xe3, 0xf1, 0x18, 0xf9,
+  0x3a, 0xfe, 0xd7, 0x96, 0x93, 0x1d, 0x30, 0xdf, 0x3e, 0x23, 0xe6, 0x0d,
+  0x4f, 0xe8, 0x7f, 0xbf, 0xd7, 0xc2, 0x1c, 0xe1, 0x1c, 0x62, 0xf6, 0xcc,
+  0x07, 0xda, 0xb9, 0xec, 0xfa, 0xc3, 0x11, 0xc0, 0x1f, 0x17, 0x03, 0xda,
+  0x3e, 0x2a, 0x5f, 0xff, 0xfb, 0xcc, 0xc9, 0xa4, 0x18, 0xf3, 0x0c, 0xe5,
+  0x08, 0xa6, 0x12, 0xda, 0xe2, 0xcf, 0x29, 0xf9, 0xba, 0x16, 0x14, 0x14,
+  0xaa, 0x0f, 0xc6, 0x9b, 0xfd, 0x7f, 0xce, 0x89, 0x47, 0xeb, 0x19, 0xe7,
+  0x17, 0x24, 0xfb, 0xdc, 0x09, 0x07, 0xf4, 0xa3, 0x29, 0x22, 0x2e, 0xee,
+  0x63, 0x0c, 0x0c, 0x38, 0xaf, 0xd2, 0xe2, 0x1d, 0xfc, 0xec, 0x02, 0x2d,
+  0xde, 0xd1, 0xb8, 0x05, 0xfb, 0xaa, 0xf2, 0x00, 0xdb, 0x42, 0xf1, 0x55,
+  0xf1, 0x08, 0x01, 0xf7, 0x06, 0x90, 0xcb, 0x4c, 0xe7, 0xbf, 0x36, 0x3f,
+  0x43, 0x0c, 0x00, 0xfc, 0x13, 0x03, 0xf9, 0x05, 0xfa, 0x09, 0x99, 0xc2,
+  0x36, 0xe8, 0xbb, 0x52, 0x06, 0x11, 0x31, 0x0d, 0x19, 0xd4, 0xdf, 0xdd,
+  0x05, 0x2d, 0x37, 0xde, 0x23, 0x19, 0xc9, 0xe1, 0x16, 0xf9, 0x43, 0xbd,
+  0x19, 0xb4, 0x11, 0x01, 0xb6, 0x1f, 0x37, 0xe5, 0xe5, 0x34, 0xf1, 0x02,
+  0xe0, 0x25, 0xcf, 0xf7, 0x2e, 0x2f, 0x06, 0xd3, 0x14, 0xf1, 0x33, 0xfb,
+  0x37, 0x2b, 0x25, 0xfb, 0x65, 0x1e, 0xda, 0xa6, 0xde, 0xcf, 0x1c, 0x2f,
+  0x2c, 0xae, 0xbf, 0x7f, 0xf9, 0xf2, 0x26, 0x22, 0xb4, 0x29, 0x0b, 0xdb,
+  0xfa, 0xf2, 0x07, 0x2d, 0x28, 0x46, 0x1f, 0x15, 0xe3, 0x43, 0x01, 0x09,
+  0xd6, 0x22, 0x05, 0xfb, 0xfc, 0xf7, 0xd9, 0x22, 0x2e, 0xdd, 0xf5, 0x2a,
+  0x05, 0x01, 0x37, 0xea, 0x0e, 0x23, 0xd1, 0x29, 0x06, 0xc3, 0x21, 0xd9,
+  0x25, 0x31, 0xdc, 0xed, 0x06, 0xfd, 0x1e, 0x1b, 0x11, 0x6f, 0xc5, 0xfa,
+  0x13, 0x41, 0x39, 0x15, 0x2f, 0xf8, 0x15, 0x47, 0x12, 0xc7, 0x6a, 0x0a,
+  0x27, 0xd9, 0x19, 0x08, 0x10, 0xef, 0xce, 0xfb, 0xfd, 0x0d, 0x03, 0xc6,
+  0x2c, 0x06, 0xb1, 0xda, 0xa5, 0x5c, 0xdd, 0xe6, 0x15, 0xfa, 0xdd, 0xdf,
+  0x3d, 0x05, 0xcb, 0xdb, 0xe7, 0x9c, 0x11, 0x35, 0xe0, 0x37, 0x42, 0xe3,
+  0x2e, 0x1d, 0x07, 0xdd, 0x0d, 0x01, 0x01, 0xee, 0xfe, 0xf1, 0x81, 0xcc,
+  0x17, 0x20, 0xe4, 0xde, 0xf4, 0xec, 0x2a, 0xf1, 0x11, 0xe5, 0xdc, 0x1a,
+  0x6c, 0xb8, 0xc4, 0x10, 0xca, 0xf8, 0xed, 0xed, 0x27, 0x06, 0xee, 0x10,
+  0xb8, 0xc6, 0xd6, 0xfb, 0x0c, 0xca, 0x4b, 0xf3, 0xcb, 0x1e, 0xd4, 0x08,
+  0xf5, 0x09, 0xc7, 0xed, 0x27, 0xd3, 0xfc, 0x2f, 0xdf, 0xe1, 0xf0, 0xe9,
+  0x12, 0x2b, 0xf0, 0x3d, 0xfe, 0x30, 0xf0, 0x0d, 0x00, 0xed, 0x38, 0x0e,
+  0xed, 0x0c, 0x0f, 0x23, 0xe4, 0xd8, 0x37, 0x09, 0x14, 0x0a, 0x2b, 0x2a,
+  0x0a, 0x05, 0x10, 0xff, 0xc9, 0xf8, 0x07, 0xc0, 0x20, 0x32, 0xe2, 0xc4,
+  0x01, 0xac, 0x16, 0x5d, 0x09, 0x0f, 0xf1, 0x18, 0xf5, 0xed, 0x02, 0xd2,
+  0xcf, 0xae, 0x22, 0x21, 0x05, 0xe6, 0xaa, 0x28, 0xde, 0x2c, 0x11, 0xcf,
+  0xe4, 0xfe, 0x2d, 0xd7, 0x27, 0xe2, 0xce, 0xce, 0x12, 0x1b, 0xec, 0xda,
+  0x03, 0xc4, 0xf8, 0x25, 0x3b, 0x02, 0xd8, 0x5d, 0x0f, 0x2f, 0xcd, 0xe0,
+  0xfd, 0x36, 0x03, 0xdc, 0xef, 0x1d, 0xf5, 0x19, 0xf2, 0x4b, 0xfa, 0xdc,
+  0x07, 0xfd, 0x22, 0xf4, 0xbf, 0x48, 0xc6, 0xc7, 0x3a, 0xfa, 0xe7, 0xed,
+  0xfd, 0xdd, 0xdf, 0x19, 0x20, 0xd0, 0xd5, 0xff, 0xcf, 0xbe, 0xe2, 0x0a,
+  0x0c, 0xd0, 0xee, 0xc4, 0x16, 0x3d, 0x2d, 0xed, 0x9d, 0x14, 0x13, 0xfe,
+  0xae, 0xc0, 0xe7, 0x2e, 0xe6, 0x34, 0x0f, 0x05, 0xff, 0x12, 0xbd, 0x4e,
+  0x1f, 0xec, 0x43, 0xce, 0xde, 0x05, 0x08, 0x1b, 0xe5, 0x0c, 0x00, 0x22,
+  0x07, 0x15, 0xfc, 0xef, 0x16, 0xd5, 0x12, 0x47, 0x1a, 0xff, 0x02, 0x12,
+  0xf1, 0xd9, 0x0d, 0x1c, 0xc2, 0xea, 0xdd, 0x20, 0xca, 0x31, 0xbc, 0x28,
+  0xec, 0x1a, 0xd9, 0xef, 0x02, 0x58, 0x81, 0x25, 0x19, 0xe9, 0x07, 0x08,
+  0xfd, 0x1e, 0x4c, 0x31, 0xe0, 0x11, 0x40, 0x26, 0x18, 0xc0, 0x2d, 0xa0,
+  0x96, 0x1a, 0xd3, 0xb3, 0xb1, 0xf0, 0x13, 0xe0, 0xe0, 0x1a, 0xf6, 0xde,
+  0xf3, 0x42, 0xd2, 0x9e, 0x08, 0xdf, 0xf7, 0xfc, 0x13, 0xeb, 0x14, 0xf3,
+  0x0d, 0x10, 0x35, 0xec, 0x28, 0x00, 0x49, 0x10, 0x7d, 0x50, 0x2c, 0x3d,
+  0x0c, 0xdc, 0x94, 0x1c, 0x0b, 0x1f, 0xf9, 0x16, 0x41, 0xe8, 0xc7, 0x07,
+  0xd0, 0xe3, 0xfc, 0x33, 0x21, 0xfb, 0xe6, 0x00, 0xfe, 0xd5, 0xe1, 0x1f,
+  0x26, 0xba, 0x40, 0x38, 0xef, 0xe0, 0xe3, 0x13, 0x1d, 0x1b, 0x38, 0xff,
+  0xe1, 0xc6, 0xec, 0x06, 0x0a, 0x2e, 0xcb, 0x1b, 0x3b, 0x03, 0xe0, 0x32,
+  0xc0, 0xa6, 0xc9, 0xfc, 0x1a, 0xf5, 0xdc, 0x2f, 0x3b, 0x3e, 0x22, 0x11,
+  0x1d, 0xfa, 0xdf, 0x1c, 0x34, 0x24, 0x18, 0xd9, 0x0c, 0xbc, 0xc9, 0xa5,
+  0x07, 0x22, 0x36, 0x81, 0xd1, 0xe5, 0xf6, 0x41, 0xe6, 0x06, 0x4f, 0x06,
+  0x27, 0x20, 0x12, 0xf2, 0xe9, 0xfe, 0x02, 0x15, 0x0b, 0xcf, 0x48, 0x14,
+  0xf9, 0xe5, 0xdc, 0x03, 0xe5, 0x21, 0xef, 0x36, 0xce, 0x01, 0xee, 0xce,
+  0x22, 0xd6, 0x01, 0x05, 0xb0, 0xad, 0x33, 0x9b, 0x24, 0x06, 0xd0, 0x08,
+  0xd0, 0xe3, 0x27, 0x23, 0x2e, 0x1a, 0x3a, 0x01, 0xab, 0xe8, 0x39, 0x01,
+  0x7f, 0x2c, 0xeb, 0x25, 0xe9, 0xfa, 0xdb, 0x27, 0xe8, 0xba, 0xe1, 0x93,
+  0x03, 0x22, 0xee, 0x1b, 0xf4, 0xeb, 0x03, 0xf7, 0x0b, 0xda, 0x27, 0xe3,
+  0xfc, 0xd1, 0xec, 0xe9, 0x01, 0xfe, 0xe1, 0x28, 0x26, 0xe8, 0x34, 0xf1,
+  0xe4, 0x2b, 0xf7, 0xe9, 0x3a, 0xeb, 0xcc, 0xee, 0xe2, 0x70, 0xf9, 0xaa,
+  0x2d, 0xc9, 0x0a, 0xdf, 0xf8, 0x0b, 0xdf, 0x25, 0x38, 0xec, 0x0e, 0x08,
+  0x02, 0xc4, 0xf0, 0x44, 0x18, 0xed, 0xd9, 0x11, 0xd6, 0x62, 0xec, 0xda,
+  0xfd, 0x2a, 0x09, 0x14, 0xfe, 0x16, 0xc8, 0xf2, 0x18, 0x3e, 0x48, 0x33,
+  0x12, 0xd7, 0xc3, 0xc1, 0x18, 0x0e, 0xff, 0x0f, 0xc2, 0x2a, 0xf8, 0xbd,
+  0x07, 0x21, 0x1c, 0xf9, 0xe5, 0xe8, 0xd6, 0xe7, 0x31, 0xd2, 0xff, 0x03,
+  0xb5, 0x06, 0x2d, 0xa2, 0x23, 0x22, 0x33, 0xb9, 0x03, 0xbc, 0xff, 0x4a,
+  0x61, 0xf4, 0x28, 0x26, 0xc9, 0x10, 0xf4, 0x2d, 0x56, 0xdd, 0xff, 0xee,
+  0xdf, 0xfc, 0xed, 0x39, 0xf5, 0xf8, 0x10, 0x81, 0xe0, 0x1e, 0xf9, 0x16,
+  0xaf, 0xfd, 0x13, 0x07, 0x7f, 0xfd, 0x43, 0x41, 0x30, 0x02, 0x0d, 0x5e,
+  0x34, 0x05, 0x31, 0x53, 0x1a, 0x4d, 0xeb, 0x08, 0xd3, 0x45, 0xcf, 0xe7,
+  0xe2, 0x12, 0xe5, 0xcf, 0xda, 0x3e, 0xfb, 0xba, 0xf5, 0xc3, 0xe7, 0xf8,
+  0x3e, 0x00, 0x21, 0x11, 0xaf, 0xc8, 0x11, 0x0a, 0x00, 0x52, 0x41, 0x28,
+  0xfc, 0xd8, 0xc1, 0xb7, 0xc5, 0x17, 0x37, 0xb2, 0xf0, 0xd8, 0x07, 0xd5,
+  0xbd, 0x23, 0xe3, 0xf0, 0xc7, 0x0a, 0xfe, 0x01, 0xc4, 0x16, 0xb2, 0xf0,
+  0x3b, 0xbf, 0x02, 0x0e, 0x07, 0xaa, 0x0c, 0xf4, 0xf7, 0x10, 0xd8, 0xbb,
+  0x28, 0x03, 0x4f, 0xe5, 0xb7, 0xcc, 0x19, 0x4c, 0x46, 0xe3, 0x0f, 0x1b,
+  0x50, 0xaf, 0xe0, 0x20, 0x41, 0xb9, 0x18, 0xd0, 0x0a, 0x81, 0xc6, 0xe7,
+  0x4e, 0xd4, 0xd4, 0x56, 0xbd, 0xb1, 0x28, 0x1e, 0x0c, 0xf9, 0x1f, 0xf9,
+  0x4f, 0x00, 0xf9, 0xfe, 0x3c, 0xe4, 0xca, 0xec, 0x34, 0xd9, 0x31, 0xa0,
+  0xf4, 0x2b, 0x97, 0x3a, 0x0f, 0x3a, 0xc6, 0x03, 0x1c, 0x3b, 0xa7, 0x36,
+  0x39, 0xd9, 0x56, 0x0b, 0xd5, 0xe0, 0xef, 0x5e, 0xcd, 0x5c, 0x27, 0x1e,
+  0x35, 0x1d, 0x57, 0xc2, 0xe1, 0x24, 0x13, 0x25, 0xcb, 0x32, 0x52, 0xf8,
+  0x18, 0x99, 0x60, 0xa3, 0xf2, 0x89, 0xa2, 0xbc, 0x2a, 0xdc, 0x3f, 0x8d,
+  0xf2, 0x84, 0x42, 0xcb, 0xbc, 0x0c, 0x06, 0xf6, 0xe4, 0xdb, 0x07, 0xf6,
+  0xe1, 0x20, 0xc6, 0xc9, 0xcd, 0x1d, 0x28, 0xad, 0x38, 0x5f, 0x04, 0xfa,
+  0xd2, 0xfc, 0x2a, 0x33, 0xfa, 0x46, 0x1f, 0x5d, 0xff, 0xcf, 0x26, 0x2b,
+  0x33, 0xee, 0x1b, 0xd3, 0xca, 0xe0, 0xc0, 0xe7, 0x1e, 0x26, 0x17, 0x12,
+  0xbd, 0x06, 0x16, 0x26, 0x26, 0x11, 0xae, 0xce, 0xe0, 0xd5, 0xe3, 0x06,
+  0xf4, 0xc7, 0x38, 0x81, 0x02, 0xf7, 0x38, 0x11, 0xf5, 0x2d, 0xd6, 0x07,
+  0xda, 0xf6, 0xf9, 0xe5, 0x24, 0xfc, 0x07, 0xff, 0xdb, 0x53, 0xdf, 0x36,
+  0x8d, 0x16, 0x0b, 0x1b, 0xd3, 0xd5, 0xe8, 0xfb, 0xdf, 0xde, 0xaa, 0x5f,
+  0x14, 0x7c, 0xf3, 0x02, 0xcb, 0xf5, 0x38, 0x0e, 0xc6, 0x5b, 0x03, 0x1d,
+  0x31, 0x5c, 0x19, 0xc7, 0x0b, 0xe0, 0x08, 0x33, 0x13, 0xee, 0x0e, 0xec,
+  0xd0, 0x15, 0xba, 0xf5, 0x07, 0x11, 0xf7, 0x35, 0x26, 0xcf, 0xca, 0xf5,
+  0x41, 0x19, 0xe7, 0x0f, 0xdd, 0xf4, 0xc8, 0xee, 0xda, 0x2d, 0x02, 0xc2,
+  0x0c, 0xe1, 0x04, 0x31, 0x2a, 0xa3, 0x0f, 0xea, 0x42, 0x28, 0xe6, 0xc3,
+  0x99, 0x01, 0xe1, 0x31, 0x37, 0x06, 0xe4, 0x35, 0xe3, 0xee, 0xc5, 0xed,
+  0x07, 0xf8, 0x29, 0x2a, 0xe6, 0xf7, 0xca, 0xfd, 0x38, 0x02, 0x1a, 0xe6,
+  0xf3, 0x28, 0xf8, 0x0c, 0xf3, 0x08, 0xf2, 0xb2, 0xd6, 0xc3, 0x40, 0x62,
+  0x22, 0xb8, 0xf7, 0x3c, 0x26, 0x41, 0x26, 0x11, 0x33, 0xe3, 0xee, 0x15,
+  0x0c, 0xfb, 0xc6, 0xea, 0xa8, 0x30, 0x1d, 0x0a, 0x04, 0x35, 0xbe, 0x36,
+  0x45, 0x0c, 0x4e, 0x06, 0x34, 0xe1, 0xf2, 0xc9, 0xc2, 0x02, 0xf3, 0xd3,
+  0x34, 0x32, 0x01, 0xde, 0x40, 0xea, 0xbc, 0x25, 0xf6, 0x17, 0xe1, 0x24,
+  0x60, 0x0e, 0xfd, 0xfb, 0x15, 0xfc, 0xfa, 0xf6, 0xd8, 0x17, 0xe6, 0xbb,
+  0x56, 0x05, 0x3f, 0xc2, 0x0d, 0xbb, 0xb2, 0x11, 0xea, 0x02, 0x54, 0x43,
+  0x16, 0xe6, 0x7f, 0x0b, 0x1d, 0x0d, 0x05, 0xe2, 0xfd, 0xed, 0xdb, 0xe4,
+  0x36, 0x9d, 0xe8, 0x0b, 0x43, 0x4f, 0x14, 0xdc, 0xf1, 0xd5, 0x37, 0x6a,
+  0xfa, 0xc1, 0xe6, 0xb9, 0xaa, 0x26, 0xf3, 0x5b, 0xa4, 0x36, 0xc9, 0x95,
+  0xac, 0xe9, 0xe8, 0x09, 0xd8, 0xb6, 0xe0, 0x28, 0x05, 0xe6, 0x25, 0x3f,
+  0xe8, 0x48, 0x2b, 0x16, 0x08, 0xd1, 0x8e, 0x0d, 0xbe, 0xd2, 0xd4, 0x26,
+  0x38, 0xd0, 0x16, 0xf3, 0xdd, 0xd3, 0xde, 0x1f, 0x02, 0x89, 0xcc, 0xd5,
+  0x1d, 0x21, 0x0a, 0xff, 0x14, 0x3d, 0xf7, 0xff, 0x30, 0x0a, 0x0a, 0xf3,
+  0x49, 0x12, 0x05, 0xd3, 0x08, 0x00, 0xb6, 0xcf, 0x54, 0xa6, 0xe7, 0x4c,
+  0x3e, 0x10, 0x42, 0x33, 0x2b, 0xff, 0x81, 0x49, 0x0d, 0x19, 0x92, 0x30,
+  0x50, 0x10, 0xcd, 0xe2, 0xfb, 0xef, 0x62, 0x65, 0x0c, 0x14, 0xde, 0xb0,
+  0xe6, 0x4c, 0xd6, 0x96, 0x19, 0x44, 0x2c, 0xe2, 0xce, 0x51, 0x23, 0xbd,
+  0x2c, 0xd2, 0xdd, 0x08, 0xfa, 0xf5, 0xfd, 0xb3, 0x1a, 0x2f, 0xac, 0xf6,
+  0xb5, 0x16, 0xee, 0x2b, 0x2d, 0xf4, 0xd9, 0xe7, 0xf1, 0x58, 0x08, 0x00,
+  0x29, 0xd9, 0xc2, 0x3a, 0x0d, 0x0e, 0x17, 0xda, 0x11, 0x01, 0x46, 0xf2,
+  0x22, 0xef, 0xb5, 0x60, 0xfe, 0xb5, 0xf5, 0xb4, 0xa7, 0xf0, 0xec, 0xde,
+  0x00, 0x04, 0xcf, 0x9b, 0x50, 0x07, 0xe2, 0x01, 0xf4, 0xfd, 0xaa, 0x67,
+  0xee, 0xe2, 0x34, 0x32, 0xea, 0xd8, 0xee, 0x21, 0x02, 0xdb, 0x02, 0xf4,
+  0xe2, 0xb5, 0x2e, 0xe9, 0x18, 0x8c, 0x00, 0xa8, 0xda, 0xeb, 0xea, 0x33,
+  0xc7, 0x08, 0xef, 0xcc, 0x0c, 0xef, 0x3b, 0xdb, 0x10, 0xe6, 0x1e, 0x7f,
+  0x14, 0xe5, 0x0b, 0x2f, 0xe6, 0x20, 0xbb, 0x0a, 0x1f, 0xe6, 0xdf, 0xad,
+  0xea, 0xb9, 0x0a, 0xf2, 0x25, 0x52, 0xfd, 0x3c, 0x4f, 0x34, 0xa7, 0x2b,
+  0x35, 0xf0, 0x4a, 0x03, 0x66, 0xe7, 0xf4, 0x8e, 0x0b, 0x15, 0xde, 0x0b,
+  0x16, 0x0f, 0x17, 0x08, 0x28, 0xfb, 0x0f, 0xea, 0xfc, 0x03, 0xd8, 0xf8,
+  0x00, 0xd3, 0x19, 0x14, 0x2e, 0x39, 0x1a, 0xf1, 0xf3, 0x30, 0x7a, 0xaf,
+  0xfb, 0xf9, 0x19, 0xfd, 0xf4, 0x53, 0xd3, 0xaa, 0x46, 0xc3, 0x46, 0xf2,
+  0xe2, 0x22, 0xd6, 0x1e, 0x3f, 0x2a, 0xc2, 0x08, 0x43, 0xe5, 0x0d, 0x26,
+  0x24, 0xf6, 0x16, 0xf3, 0xc3, 0xf6, 0xfa, 0xec, 0x13, 0x5a, 0x1e, 0xfb,
+  0xbd, 0x2c, 0xf2, 0xe8, 0xc1, 0x21, 0x23, 0x2b, 0x15, 0x03, 0xc0, 0xb1,
+  0x24, 0x32, 0xdf, 0x47, 0x88, 0x48, 0x0e, 0xeb, 0xca, 0x00, 0x18, 0x62,
+  0x48, 0xc4, 0xec, 0x1f, 0xbb, 0xc9, 0xc2, 0x17, 0x25, 0x10, 0x2d, 0xf5,
+  0x10, 0xee, 0x0f, 0xcd, 0xef, 0x81, 0x07, 0x02, 0x78, 0x01, 0xa9, 0x04,
+  0xd0, 0xc1, 0xdf, 0xfc, 0xe1, 0xb9, 0x55, 0x13, 0x31, 0xfd, 0xe5, 0x1d,
+  0x00, 0x17, 0x10, 0x13, 0xa4, 0x00, 0xdd, 0xff, 0x0d, 0xdc, 0xf5, 0x20,
+  0xd0, 0xc3, 0x47, 0x17, 0x57, 0xeb, 0x4c, 0xef, 0x81, 0x00, 0xc5, 0x10,
+  0x36, 0x2f, 0x0a, 0x16, 0xc0, 0x2a, 0xfa, 0x4f, 0xab, 0xe8, 0xd9, 0x2d,
+  0xda, 0xdd, 0xa5, 0x0f, 0x08, 0xcd, 0x21, 0x11, 0xd7, 0xac, 0x13, 0x1a,
+  0x4c, 0x2c, 0xda, 0x1a, 0xb7, 0xfb, 0x07, 0x23, 0xe2, 0xde, 0x17, 0xeb,
+  0x1b, 0xfd, 0x22, 0x26, 0x27, 0x08, 0x01, 0xd4, 0xb8, 0x19, 0xcb, 0x15,
+  0xc4, 0x13, 0xd8, 0x21, 0x22, 0x20, 0x3d, 0x3c, 0x5c, 0x22, 0x30, 0x37,
+  0x3d, 0x1d, 0x45, 0xea, 0xf4, 0x53, 0x01, 0xf2, 0x66, 0x1b, 0xaa, 0x4e,
+  0xe0, 0x17, 0x6f, 0x4e, 0xcc, 0xee, 0x12, 0x12, 0xdc, 0x30, 0xf1, 0x02,
+  0x18, 0xd8, 0xce, 0xb0, 0x26, 0xfc, 0xa3, 0xb6, 0x60, 0xb3, 0x1d, 0xec,
+  0xf2, 0xec, 0x38, 0xfc, 0xc3, 0xb6, 0xa0, 0x3c, 0xf5, 0x1b, 0x2c, 0x37,
+  0xed, 0x14, 0x2a, 0x04, 0xe4, 0xfa, 0xda, 0x08, 0x10, 0xe5, 0x04, 0x43,
+  0xda, 0xd1, 0x17, 0x06, 0xf2, 0x0b, 0xe2, 0xc8, 0x07, 0x11, 0x22, 0xe4,
+  0x0e, 0x0f, 0xf8, 0x22, 0xf0, 0xfa, 0x0f, 0x09, 0xd6, 0xfd, 0xe0, 0xd7,
+  0xe0, 0x1d, 0x32, 0xfb, 0x0f, 0x12, 0x3a, 0x05, 0x23, 0xc9, 0x26, 0xef,
+  0xf1, 0x19, 0x0e, 0xee, 0xd2, 0xfb, 0x10, 0xf0, 0xfd, 0x25, 0x2c, 0x00,
+  0x34, 0xfa, 0xf1, 0xfa, 0x81, 0x08, 0x16, 0xc3, 0xe4, 0x04, 0xd3, 0xee,
+  0xd9, 0xe6, 0x41, 0xc7, 0x0a, 0x24, 0xc4, 0xee, 0xb2, 0x29, 0xce, 0xfd,
+  0x44, 0xe9, 0xcd, 0xd5, 0x1a, 0x0c, 0x00, 0x22, 0xd5, 0xe4, 0x15, 0x2e,
+  0x0a, 0x16, 0x34, 0x0a, 0x17, 0xdd, 0x1c, 0x48, 0x15, 0x2b, 0xd4, 0xf2,
+  0x16, 0xfc, 0x9d, 0x0d, 0xd9, 0xec, 0xf4, 0x01, 0x47, 0xfc, 0x23, 0xeb,
+  0x0d, 0x3f, 0xbf, 0x24, 0x46, 0x02, 0x11, 0x03, 0x32, 0xf6, 0xeb, 0xd0,
+  0xf6, 0xc8, 0x06, 0x14, 0x9e, 0xc2, 0xdd, 0x04, 0xf8, 0xbb, 0xdc, 0x3b,
+  0x71, 0xd8, 0x0b, 0xc6, 0x26, 0xed, 0x81, 0xb0, 0xef, 0x21, 0x1c, 0x29,
+  0x25, 0x39, 0x2a, 0x07, 0xfc, 0xf3, 0xb5, 0x0a, 0x1b, 0xce, 0xfd, 0xe3,
+  0x0d, 0x93, 0x07, 0x6e, 0xe5, 0x0a, 0x42, 0xb0, 0x07, 0x1d, 0xc9, 0x40,
+  0x1f, 0x6f, 0x12, 0x46, 0x0f, 0xc2, 0x35, 0x00, 0x51, 0xf6, 0x03, 0xed,
+  0x19, 0xfd, 0x33, 0xf2, 0xc0, 0x9e, 0xfb, 0xcf, 0xda, 0xa1, 0xcf, 0x43,
+  0xce, 0xe5, 0x1e, 0x0e, 0x02, 0xfa, 0xf2, 0xc2, 0xe8, 0x25, 0x1e, 0xb9,
+  0x97, 0xd3, 0x28, 0xbb, 0xec, 0x4c, 0x18, 0x1c, 0xfc, 0xd9, 0x26, 0x1e,
+  0xe4, 0xed, 0x0e, 0xd8, 0xf1, 0xfb, 0x1b, 0x32, 0x21, 0xcf, 0xea, 0x53,
+  0xb3, 0xff, 0xdd, 0x03, 0xaf, 0x50, 0xfe, 0x0f, 0x1a, 0x2b, 0x22, 0xc4,
+  0xf4, 0x0f, 0x9c, 0xdc, 0xea, 0x11, 0x17, 0xdc, 0xd6, 0xb6, 0x91, 0x08,
+  0xe0, 0xf9, 0x21, 0x04, 0x36, 0x09, 0x1c, 0xd6, 0x12, 0x0a, 0x81, 0x0a,
+  0x0b, 0x0d, 0x8f, 0x0b, 0xfa, 0x5c, 0xed, 0x45, 0xe6, 0x0d, 0x9e, 0xb8,
+  0xde, 0x3c, 0xd0, 0x07, 0x2a, 0xe9, 0xd8, 0x36, 0xc3, 0x9f, 0xdc, 0x98,
+  0x0e, 0x5f, 0xe5, 0x1c, 0x05, 0x03, 0x11, 0xce, 0x1c, 0x1c, 0xf3, 0xfd,
+  0x09, 0x35, 0x1b, 0xee, 0xfc, 0xcb, 0x05, 0x25, 0xf9, 0x09, 0xe5, 0x48,
+  0xf9, 0x30, 0xd7, 0x06, 0x1a, 0xdf, 0xb0, 0xec, 0x15, 0x0d, 0x48, 0xb0,
+  0xe7, 0x1c, 0x5a, 0x0c, 0x1e, 0x2c, 0x26, 0x05, 0x35, 0x28, 0xe1, 0x29,
+  0x41, 0x0b, 0x00, 0x70, 0x1e, 0x3f, 0xcf, 0xdb, 0xcb, 0xca, 0x5f, 0x79,
+  0xf8, 0x9e, 0x22, 0x29, 0x07, 0x50, 0xec, 0xf8, 0x1d, 0xec, 0x0a, 0xd9,
+  0xca, 0x03, 0xe0, 0xc2, 0x36, 0xc6, 0xfd, 0x21, 0xba, 0x2f, 0x34, 0xf0,
+  0xec, 0x15, 0xd6, 0xe5, 0xe8, 0xf0, 0x41, 0x16, 0x30, 0x38, 0x37, 0x23,
+  0x25, 0xf9, 0x45, 0xef, 0x18, 0x13, 0x4b, 0x19, 0x1c, 0x00, 0x1b, 0xe4,
+  0xcc, 0x1a, 0xc3, 0x03, 0xfd, 0xe7, 0x4c, 0xee, 0x9f, 0x41, 0x3e, 0x9f,
+  0xef, 0x34, 0xb1, 0x0d, 0x14, 0x40, 0xca, 0x36, 0xcc, 0xad, 0xe9, 0xe2,
+  0xda, 0xd9, 0xd8, 0xc6, 0x06, 0x29, 0x2c, 0xea, 0xf2, 0x1b, 0xe3, 0xe9,
+  0xf7, 0xea, 0xf9, 0xff, 0x32, 0x08, 0x1b, 0xbf, 0xfd, 0xbf, 0x16, 0x37,
+  0x0c, 0xe6, 0xd3, 0xf3, 0xf6, 0xfd, 0x30, 0x92, 0xc0, 0xe1, 0x00, 0xc2,
+  0xd3, 0xc2, 0xb0, 0x48, 0x2a, 0xea, 0x38, 0x90, 0x02, 0xae, 0x81, 0xc4,
+  0x79, 0xf5, 0x1a, 0xc2, 0xe1, 0x2f, 0x3a, 0xed, 0xf5, 0xf2, 0xda, 0x72,
+  0x2c, 0x1c, 0x11, 0x37, 0xd5, 0x17, 0x10, 0x17, 0xf2, 0x67, 0xf9, 0xec,
+  0x70, 0xf5, 0x7f, 0x09, 0x4e, 0x2b, 0x2c, 0x4e, 0xd7, 0xc3, 0x15, 0x06,
+  0x3f, 0x13, 0x22, 0x0d, 0xd9, 0x11, 0x1c, 0x14, 0xda, 0x46, 0x00, 0xec,
+  0xc3, 0xd6, 0xf7, 0x16, 0x3a, 0x25, 0xfe, 0xfb, 0x43, 0x0c, 0x2c, 0x2f,
+  0x2b, 0x64, 0xcb, 0x0b, 0xb9, 0x11, 0x49, 0xfb, 0x40, 0xf0, 0x93, 0x1a,
+  0xfe, 0xb3, 0xd0, 0xdf, 0x19, 0x29, 0xfc, 0x1a, 0x13, 0xa1, 0xe1, 0x59,
+  0xed, 0xdc, 0x28, 0x1c, 0x11, 0xfb, 0x07, 0x39, 0x25, 0x1e, 0xfb, 0x21,
+  0xcc, 0xef, 0x09, 0x08, 0x9c, 0xb0, 0x26, 0xa5, 0x45, 0xee, 0xb3, 0xe1,
+  0x1d, 0x2e, 0x15, 0x7f, 0xf0, 0x2e, 0xfe, 0x0e, 0xa3, 0x33, 0xfc, 0x22,
+  0xf5, 0xbb, 0xd1, 0x17, 0x08, 0x0a, 0xcc, 0x8a, 0x06, 0x29, 0xe8, 0xe5,
+  0x0e, 0x5d, 0x44, 0xd1, 0xec, 0xf9, 0xee, 0x28, 0xa6, 0xff, 0xfd, 0xef,
+  0x2d, 0xf8, 0xd7, 0x3c, 0xeb, 0xc7, 0x11, 0xe1, 0xe2, 0xc2, 0xf7, 0x25,
+  0xf3, 0xf8, 0x39, 0x51, 0x00, 0x2a, 0x11, 0x36, 0x15, 0x25, 0x36, 0x21,
+  0x1a, 0x38, 0x1d, 0x23, 0x38, 0xc2, 0x20, 0x01, 0x47, 0xd5, 0x0c, 0x42,
+  0xdd, 0xf7, 0x5a, 0xf4, 0xd9, 0xbb, 0xd1, 0xe4, 0x08, 0x0d, 0xf7, 0xfb,
+  0xe8, 0xe0, 0xf2, 0x0a, 0xe3, 0x00, 0x36, 0x10, 0x1f, 0x23, 0x0f, 0x03,
+  0x1c, 0x15, 0xd4, 0x16, 0x15, 0x1c, 0xb8, 0xfa, 0xd2, 0xf5, 0x1c, 0x1e,
+  0xe9, 0xce, 0x09, 0xf9, 0xe7, 0x02, 0xea, 0xc9, 0xc3, 0xd6, 0xb2, 0x46,
+  0xed, 0x04, 0x57, 0x51, 0xf0, 0x0f, 0x63, 0xfc, 0x13, 0x07, 0xf4, 0x07,
+  0xf6, 0x31, 0x06, 0xff, 0x74, 0xdd, 0x3b, 0x09, 0x1a, 0xfd, 0xb9, 0x1a,
+  0xe9, 0xf1, 0x3a, 0x0d, 0xac, 0x13, 0x13, 0xf0, 0x08, 0x06, 0x02, 0xb2,
+  0x29, 0x04, 0xec, 0xf5, 0x03, 0xdd, 0x62, 0x19, 0x7f, 0xfa, 0xd3, 0xf4,
+  0xb6, 0x1c, 0x28, 0x1d, 0xe7, 0x48, 0xb6, 0xb4, 0x2f, 0x0f, 0xc3, 0x41,
+  0x12, 0xf2, 0xa8, 0x13, 0xf9, 0x27, 0xfe, 0xb9, 0x19, 0x17, 0xbb, 0xea,
+  0x33, 0x0b, 0xf9, 0x03, 0x0e, 0x00, 0xf3, 0x3c, 0xe1, 0xee, 0x28, 0x41,
+  0x25, 0xc8, 0x14, 0x10, 0xf6, 0xf2, 0xd1, 0xdb, 0xde, 0xf7, 0x2f, 0xff,
+  0x21, 0x2a, 0xd6, 0x35, 0x9b, 0x81, 0xd2, 0xe9, 0x15, 0x62, 0x2f, 0xcb,
+  0xd0, 0x36, 0x38, 0xe4, 0x1d, 0x06, 0xc2, 0x20, 0x05, 0x12, 0xfe, 0xf6,
+  0xdc, 0xf6, 0xe3, 0xc5, 0x14, 0xe5, 0xc1, 0x3b, 0x09, 0xf1, 0xf1, 0xbe,
+  0x15, 0x18, 0x06, 0xe9, 0x0c, 0xdf, 0xe2, 0xa2, 0xf5, 0xf0, 0xdd, 0x06,
+  0xfd, 0xbf, 0xf5, 0xee, 0x33, 0x0e, 0x18, 0xb9, 0xf4, 0x10, 0x0d, 0x2b,
+  0xe4, 0x3e, 0x0b, 0x07, 0xb4, 0xfc, 0xb7, 0xde, 0x98, 0x49, 0xfc, 0xd7,
+  0xf3, 0xe2, 0x0c, 0x37, 0xde, 0x34, 0xdb, 0x36, 0xef, 0xe5, 0xdc, 0xf2,
+  0xff, 0xd2, 0xe6, 0xfc, 0x7b, 0x26, 0xf6, 0x1c, 0xf4, 0x06, 0xee, 0x23,
+  0xce, 0xf6, 0x51, 0xef, 0xc8, 0xe0, 0x51, 0xe9, 0xb1, 0xdf, 0xd6, 0x7f,
+  0xea, 0x20, 0xd8, 0xe9, 0x1e, 0x45, 0xf5, 0xfe, 0xf4, 0x14, 0x11, 0xfe,
+  0x05, 0x39, 0x1e, 0xd5, 0xfb, 0x02, 0x1b, 0x1a, 0xe3, 0x14, 0xfd, 0xfb,
+  0x1b, 0xfb, 0xcd, 0xea, 0x19, 0x13, 0x04, 0xbd, 0xff, 0x28, 0xca, 0x12,
+  0x38, 0x1b, 0x97, 0xad, 0x1b, 0x5c, 0x92, 0xe7, 0x60, 0x00, 0x54, 0xe9,
+  0xd5, 0x0c, 0xdd, 0xd8, 0xd6, 0xb6, 0xbd, 0xfc, 0xbb, 0xf3, 0xd2, 0xff,
+  0x09, 0xfd, 0x93, 0x29, 0xf9, 0x1e, 0x16, 0xe0, 0x26, 0xf9, 0x10, 0xd8,
+  0x15, 0x07, 0xee, 0x4c, 0xc5, 0xd7, 0xfa, 0x02, 0x05, 0x2f, 0x1a, 0xd5,
+  0x18, 0xdf, 0x12, 0x0a, 0x37, 0x28, 0xa5, 0xe3, 0x27, 0xf9, 0x11, 0x58,
+  0xf8, 0x35, 0xda, 0xec, 0x00, 0xc9, 0xde, 0x11, 0x1e, 0xfd, 0xce, 0x31,
+  0x1b, 0x3d, 0xee, 0xdd, 0x16, 0x2f, 0x15, 0xbc, 0xc6, 0x05, 0x23, 0x1c,
+  0xc8, 0xdb, 0xfc, 0xe3, 0xf9, 0x1f, 0x04, 0x12, 0xe6, 0xe6, 0xcf, 0xeb,
+  0x2e, 0x27, 0xc9, 0xeb, 0x7f, 0x1e, 0xc5, 0x10, 0x12, 0x12, 0x9d, 0xf2,
+  0x33, 0x2a, 0x3b, 0x17, 0x14, 0x03, 0xe2, 0x0a, 0xd9, 0x21, 0xf1, 0x19,
+  0x09, 0x08, 0x10, 0xd1, 0xf2, 0x01, 0x0d, 0x19, 0x13, 0x24, 0x9c, 0xfb,
+  0x17, 0x33, 0x17, 0x02, 0x1e, 0xee, 0x06, 0x26, 0xc1, 0x28, 0xc8, 0xd1,
+  0x06, 0xf2, 0xc0, 0xfb, 0xec, 0xdf, 0x04, 0xe4, 0x22, 0xb3, 0xf4, 0x2b,
+  0xd0, 0x08, 0x0f, 0xe6, 0x2b, 0xfe, 0xfe, 0x19, 0x01, 0xe6, 0x1e, 0x1c,
+  0xc5, 0xb7, 0x31, 0x04, 0x21, 0x0b, 0x16, 0x07, 0xf7, 0xed, 0xf2, 0xd9,
+  0x11, 0x22, 0xd7, 0xdc, 0x10, 0xff, 0xee, 0x4e, 0x0d, 0x22, 0xf1, 0x2f,
+  0x00, 0x23, 0xe5, 0x0b, 0x29, 0x19, 0xdc, 0x38, 0xe9, 0x2c, 0xff, 0xd9,
+  0x45, 0x33, 0xe5, 0xfc, 0x00, 0xfa, 0x26, 0xfe, 0x02, 0xfc, 0x0d, 0x1e,
+  0x2c, 0x34, 0x07, 0x1d, 0x00, 0xd4, 0x0d, 0x36, 0x32, 0x1a, 0x01, 0x23,
+  0xd1, 0xc3, 0x9c, 0xde, 0x09, 0x14, 0xfd, 0xc0, 0xf7, 0x16, 0xd8, 0xd7,
+  0xe5, 0xf2, 0xd7, 0x26, 0xef, 0xde, 0x00, 0x1f, 0xf1, 0x33, 0xea, 0x34,
+  0x0f, 0xb0, 0xf7, 0x3b, 0xc2, 0x17, 0xd0, 0x38, 0xd6, 0xee, 0x7f, 0xac,
+  0xd7, 0xd6, 0xeb, 0x53, 0xda, 0xb7, 0xdf, 0xd6, 0x0b, 0x31, 0xe7, 0xcf,
+  0x5c, 0x2c, 0x01, 0xcc, 0xfe, 0x28, 0x03, 0xfb, 0xd1, 0x63, 0xd8, 0x0c,
+  0xea, 0xf4, 0xd7, 0xb3, 0x10, 0x99, 0x1e, 0xf5, 0xf2, 0xf8, 0xcb, 0x51,
+  0xe6, 0x07, 0xea, 0xd1, 0x08, 0xfd, 0xd1, 0x2b, 0x20, 0x0b, 0xcb, 0xce,
+  0x51, 0x2f, 0x05, 0x09, 0xe3, 0xfb, 0x0e, 0x0d, 0x1c, 0xd9, 0xe4, 0xf1,
+  0xf4, 0x21, 0x1b, 0x1b, 0xdf, 0x3f, 0x20, 0xdb, 0xd6, 0xe9, 0x25, 0x8e,
+  0x18, 0x29, 0x25, 0xf9, 0x0d, 0x34, 0x08, 0xf7, 0xfe, 0xe6, 0x08, 0x70,
+  0x40, 0x08, 0x24, 0x20, 0xeb, 0xd4, 0x11, 0xdb, 0x21, 0x08, 0xda, 0xd1,
+  0xee, 0x00, 0x0b, 0x32, 0xe1, 0x0f, 0xe7, 0x20, 0xf8, 0x2c, 0xf5, 0xf9,
+  0xee, 0x17, 0x1a, 0x20, 0xe3, 0xdb, 0xe9, 0x06, 0x08, 0x0b, 0x99, 0x12,
+  0x19, 0xe8, 0xfa, 0xd4, 0x1c, 0x15, 0xcc, 0xe3, 0x0f, 0xdc, 0x17, 0x08,
+  0x05, 0x04, 0x26, 0x3c, 0x0c, 0xce, 0xc3, 0xf8, 0x03, 0xca, 0xcd, 0xe9,
+  0xed, 0x8b, 0x4e, 0xe2, 0xd0, 0xe0, 0x97, 0xa7, 0xdb, 0xde, 0xd0, 0x0f,
+  0xe0, 0x25, 0x6d, 0xda, 0x05, 0xbc, 0xf4, 0x04, 0x7f, 0x04, 0x2f, 0xfc,
+  0xe2, 0x09, 0xff, 0xf1, 0xc0, 0x02, 0xd8, 0x37, 0xea, 0x0c, 0x09, 0x50,
+  0xe9, 0x10, 0xd9, 0x04, 0x00, 0x43, 0x1e, 0xe6, 0x46, 0x2d, 0x63, 0xf9,
+  0x2a, 0x07, 0x16, 0x07, 0xec, 0xe3, 0x1b, 0xa8, 0x16, 0xff, 0x04, 0x1b,
+  0xcc, 0xd5, 0xae, 0x42, 0x10, 0xa0, 0xe0, 0x53, 0x23, 0x2b, 0xcc, 0x20,
+  0x24, 0x07, 0x13, 0x37, 0x27, 0x12, 0xeb, 0x24, 0x08, 0xf9, 0x20, 0xf5,
+  0xe2, 0xdf, 0x23, 0x24, 0xe6, 0xad, 0xc1, 0xbc, 0xe9, 0x0a, 0x14, 0xc0,
+  0x12, 0xe0, 0x03, 0x2e, 0x06, 0xf5, 0x29, 0xde, 0xe3, 0x3c, 0xdc, 0xe1,
+  0x22, 0x83, 0x9c, 0x1d, 0x09, 0x63, 0x7f, 0xa7, 0xea, 0x39, 0x3e, 0x09,
+  0xfd, 0x39, 0x0f, 0xf2, 0xa0, 0x00, 0x0a, 0x03, 0xc8, 0x13, 0xfb, 0x2e,
+  0xbc, 0xfd, 0x0a, 0x0f, 0x73, 0xe7, 0xe5, 0x27, 0xe1, 0xd7, 0x10, 0x02,
+  0xb7, 0x20, 0x4b, 0x36, 0xe4, 0xfc, 0x5f, 0xd0, 0xf5, 0xa5, 0x18, 0x26,
+  0xfb, 0x09, 0x67, 0xcd, 0x18, 0xf6, 0x0d, 0x3d, 0xb0, 0x2b, 0xef, 0x62,
+  0x2f, 0xd5, 0x2b, 0xf5, 0x23, 0x23, 0xed, 0xef, 0xe6, 0x1e, 0x32, 0x05,
+  0x07, 0x61, 0x0f, 0x70, 0xe5, 0x22, 0xc7, 0x60, 0x5b, 0x15, 0xf6, 0xd8,
+  0xff, 0x26, 0x33, 0x30, 0xe9, 0xee, 0x12, 0x3a, 0x3c, 0xe1, 0x3a, 0xc5,
+  0xe8, 0xdf, 0x0f, 0xe0, 0xec, 0x2b, 0x5a, 0xd0, 0xba, 0x41, 0xda, 0xe8,
+  0xa6, 0xfc, 0xfb, 0xec, 0xf5, 0x1e, 0x36, 0x3f, 0xac, 0xf1, 0x5a, 0xcd,
+  0x74, 0xed, 0x4a, 0x37, 0xcf, 0xcb, 0x0c, 0x6b, 0x20, 0x81, 0x47, 0x92,
+  0x04, 0x04, 0xb4, 0x55, 0xc2, 0x01, 0x32, 0xd2, 0x0e, 0xf0, 0x43, 0xde,
+  0x76, 0x15, 0xfc, 0x1e, 0xfb, 0x02, 0xd8, 0x27, 0x15, 0xe5, 0x4b, 0xc0,
+  0x40, 0xde, 0xc9, 0xa1, 0xf8, 0xd8, 0xff, 0xdc, 0x9b, 0x11, 0xce, 0x9b,
+  0x2e, 0xac, 0xa9, 0x26, 0xc4, 0xe2, 0x0a, 0x69, 0x06, 0xf1, 0x04, 0x8e,
+  0xd5, 0xa7, 0x24, 0x4f, 0x0e, 0xf7, 0x1e, 0xac, 0x09, 0xfd, 0x23, 0x9c,
+  0xdf, 0xdf, 0x36, 0xdb, 0xd4, 0xd6, 0xb9, 0xe1, 0x00, 0x63, 0x1f, 0x10,
+  0x1b, 0xf1, 0x25, 0xf3, 0x04, 0x06, 0x1b, 0xc0, 0xa8, 0xfe, 0x13, 0xfd,
+  0xe4, 0x17, 0xfe, 0x95, 0x3c, 0x5e, 0xe6, 0xcb, 0x16, 0xff, 0x0d, 0xef,
+  0x1a, 0xde, 0x02, 0xcf, 0xf6, 0xf6, 0xbc, 0xc8, 0x22, 0xdd, 0x46, 0xf9,
+  0x7f, 0x33, 0x32, 0xfa, 0xf9, 0xd2, 0x13, 0x1b, 0x40, 0x27, 0xda, 0x00,
+  0xf4, 0x0d, 0xdf, 0xdc, 0xf5, 0xb8, 0x0c, 0xfa, 0xfe, 0x03, 0xf3, 0x59,
+  0xb2, 0xde, 0x1b, 0xb0, 0x10, 0xd4, 0x30, 0x37, 0x0d, 0xb1, 0x08, 0x00,
+  0x13, 0x0d, 0x02, 0x66, 0x15, 0x06, 0xfd, 0xea, 0xfb, 0x3e, 0x03, 0x02,
+  0x1c, 0xea, 0xf1, 0x14, 0x0e, 0x06, 0x2d, 0x14, 0x1a, 0xf5, 0x0d, 0x09,
+  0x33, 0xf0, 0x4b, 0x0d, 0x2d, 0xec, 0x06, 0x06, 0x1f, 0xe0, 0x34, 0x26,
+  0x2e, 0xe8, 0xa4, 0xf1, 0xc5, 0x21, 0x44, 0xd7, 0xfa, 0x0d, 0x06, 0x0a,
+  0xc0, 0xf4, 0x12, 0x14, 0xe7, 0xf0, 0x0c, 0x39, 0xd4, 0x0a, 0x10, 0xf9,
+  0x0f, 0xde, 0x37, 0x05, 0xf8, 0xcc, 0xf9, 0xbd, 0xbe, 0x07, 0x29, 0xde,
+  0x31, 0x2e, 0x0c, 0x0e, 0xea, 0x19, 0xfe, 0xe2, 0x36, 0x3a, 0xf5, 0x2e,
+  0xc5, 0x19, 0x0f, 0xe8, 0x29, 0xf2, 0xce, 0xfa, 0x23, 0xdc, 0xdf, 0x0f,
+  0x07, 0x0c, 0xef, 0x1f, 0xd2, 0xe6, 0x1d, 0x15, 0xcf, 0xdc, 0x10, 0x20,
+  0x17, 0xdf, 0x1c, 0x09, 0x21, 0x20, 0xee, 0x15, 0x15, 0xe4, 0xdb, 0xc4,
+  0xd5, 0xc5, 0x40, 0x81, 0xf3, 0xd7, 0xb4, 0xe5, 0xe8, 0x2d, 0x41, 0x15,
+  0x3b, 0xf1, 0xff, 0xb5, 0x0f, 0x2d, 0xe7, 0xfd, 0x0e, 0xaa, 0x0f, 0xb2,
+  0x54, 0xc6, 0xc6, 0x14, 0x2e, 0xed, 0x17, 0xc5, 0xf2, 0x2a, 0xe9, 0x02,
+  0xfe, 0xf9, 0xfb, 0x21, 0xf8, 0xe1, 0xde, 0xc8, 0xfc, 0xea, 0x17, 0xd9,
+  0xd1, 0x08, 0xa2, 0xf1, 0xe1, 0xed, 0x4a, 0x22, 0xf8, 0x02, 0x1c, 0x38,
+  0x6a, 0x1e, 0xdb, 0xd1, 0x13, 0xb8, 0xf9, 0xe6, 0xdd, 0xcb, 0xe9, 0x1f,
+  0xdc, 0xec, 0x81, 0x34, 0xc1, 0xf8, 0xee, 0x2a, 0x35, 0xe9, 0xd7, 0xd4,
+  0x22, 0xe6, 0x14, 0xfc, 0xc4, 0x47, 0xed, 0x0f, 0x31, 0xe5, 0xd7, 0x10,
+  0xe8, 0x17, 0xf9, 0x4e, 0xe3, 0x06, 0xf9, 0x0a, 0xe3, 0x06, 0x2e, 0xc4,
+  0xf3, 0x06, 0x34, 0x02, 0xf8, 0x57, 0x12, 0x15, 0x0a, 0xe2, 0x23, 0x1c,
+  0xd6, 0x2c, 0x2e, 0xff, 0x2a, 0x3f, 0xf6, 0x11, 0xe6, 0x27, 0xcb, 0xd0,
+  0xfd, 0xfc, 0xe3, 0x12, 0xf7, 0xb8, 0x13, 0x45, 0x0d, 0xf6, 0x0b, 0x16,
+  0x16, 0x24, 0xdc, 0xac, 0xc5, 0xcb, 0xd5, 0x06, 0xfc, 0x46, 0x01, 0xc6,
+  0xca, 0x1a, 0x46, 0x02, 0xcc, 0xeb, 0xce, 0xfe, 0x0d, 0x0f, 0x06, 0xcd,
+  0xcc, 0xc0, 0x12, 0xde, 0x2d, 0x35, 0x28, 0x1d, 0xd3, 0x03, 0x10, 0xf9,
+  0xe1, 0x38, 0x19, 0xc9, 0xe4, 0xf7, 0xf1, 0xff, 0xf2, 0xd8, 0xc5, 0xde,
+  0x02, 0x35, 0xe4, 0xc7, 0x20, 0x29, 0x10, 0x4c, 0x0c, 0x29, 0xdd, 0x22,
+  0x0d, 0xcd, 0xfe, 0xd0, 0xd2, 0x06, 0x05, 0x2c, 0xba, 0x4d, 0x10, 0xed,
+  0xce, 0x15, 0xef, 0x29, 0xfa, 0x61, 0x22, 0xc0, 0x37, 0x01, 0x15, 0x48,
+  0xc1, 0x8d, 0xe2, 0xbf, 0xf9, 0x71, 0xd9, 0x0c, 0xde, 0xf1, 0xd5, 0xd4,
+  0x3f, 0xe3, 0x38, 0x33, 0xfa, 0x19, 0x1a, 0x16, 0xc1, 0x47, 0x2b, 0x24,
+  0xcc, 0xb9, 0x32, 0x62, 0xf3, 0x45, 0xf4, 0x0b, 0x52, 0xeb, 0xe5, 0xff,
+  0xff, 0xe3, 0x7f, 0xf8, 0xc0, 0x43, 0x34, 0x3e, 0x0f, 0xd5, 0x28, 0xf0,
+  0x1f, 0xe8, 0xd1, 0x16, 0x27, 0x68, 0x68, 0x18, 0xe0, 0x08, 0xce, 0x1f,
+  0xeb, 0x09, 0x24, 0x56, 0xb7, 0xf5, 0x04, 0x00, 0xf2, 0x22, 0x48, 0xf3,
+  0xe1, 0x4b, 0x16, 0x30, 0x06, 0xf9, 0xde, 0x3a, 0x29, 0xc5, 0x06, 0x2b,
+  0x09, 0xfc, 0x24, 0x0f, 0xef, 0x34, 0x06, 0x17, 0xd9, 0xd3, 0xc2, 0xec,
+  0xf1, 0xc3, 0x18, 0xfe, 0x06, 0xec, 0xf5, 0x0f, 0xdd, 0xe4, 0xef, 0xbf,
+  0x23, 0xf9, 0x16, 0xff, 0xd0, 0x1a, 0xf4, 0x29, 0x2a, 0x0f, 0xe9, 0x17,
+  0x22, 0xc5, 0xd9, 0x16, 0xfb, 0xfa, 0xce, 0xe8, 0xec, 0x01, 0xfd, 0x2d,
+  0x2d, 0xf7, 0xff, 0x0b, 0xf9, 0xf9, 0xf1, 0x31, 0x2a, 0x3c, 0x01, 0xe5,
+  0xef, 0xed, 0xca, 0x00, 0x0d, 0xf0, 0x2a, 0x10, 0x1d, 0x0a, 0x36, 0xe2,
+  0xf6, 0xe1, 0x1f, 0x15, 0xd7, 0x02, 0x2c, 0xf5, 0xe7, 0x15, 0xe5, 0x0a,
+  0xfb, 0x04, 0xf7, 0x32, 0x12, 0x13, 0x04, 0x03, 0xe0, 0x2b, 0xf2, 0x14,
+  0x19, 0xf4, 0x0c, 0xf6, 0xfd, 0x07, 0x7f, 0x15, 0xde, 0xde, 0x1c, 0xfb,
+  0xdb, 0x13, 0x25, 0xf0, 0x1c, 0x29, 0xd5, 0x18, 0xed, 0xdb, 0x2b, 0xe4,
+  0x0f, 0xee, 0x02, 0xf6, 0x00, 0x09, 0xf8, 0xc2, 0xec, 0xf7, 0xee, 0xc9,
+  0xf9, 0xea, 0xf9, 0x23, 0x14, 0x26, 0x0f, 0x29, 0xda, 0x13, 0xd6, 0xc9,
+  0x2b, 0x81, 0xce, 0x53, 0x02, 0xff, 0x0f, 0xe5, 0x1c, 0x07, 0xf3, 0x0a,
+  0xea, 0x51, 0x27, 0x18, 0xf3, 0xf8, 0x16, 0xea, 0xfe, 0x00, 0xf7, 0xdb,
+  0xeb, 0xfd, 0xb7, 0xe5, 0x1f, 0xf1, 0xef, 0x11, 0x01, 0x29, 0x04, 0xfd,
+  0xd8, 0x25, 0xec, 0xf0, 0xd9, 0xdc, 0x21, 0xe5, 0xdf, 0xdf, 0xb5, 0x01,
+  0xfd, 0x1d, 0x55, 0x1b, 0xef, 0xfb, 0x12, 0x36, 0x18, 0x87, 0xde, 0xf4,
+  0x9b, 0xd9, 0x13, 0x26, 0xd3, 0xf8, 0xc4, 0xc5, 0xbe, 0xed, 0x11, 0xcd,
+  0xfb, 0xf3, 0x14, 0x45, 0xf3, 0xfa, 0xd4, 0xed, 0x47, 0xe6, 0xdc, 0xe0,
+  0xe3, 0x05, 0x06, 0x2b, 0xfd, 0xfd, 0x2e, 0xf2, 0x16, 0xc5, 0x28, 0xf9,
+  0x06, 0xf4, 0xe6, 0xfd, 0xcf, 0x39, 0x28, 0x07, 0x34, 0xeb, 0x07, 0x1d,
+  0x24, 0xfa, 0x27, 0xce, 0x29, 0x3e, 0xf8, 0x18, 0xe8, 0x1f, 0xf3, 0x0f,
+  0xc7, 0xf1, 0xb9, 0xcd, 0x11, 0xc0, 0xfa, 0x05, 0x38, 0xf2, 0xf6, 0xd5,
+  0x04, 0x03, 0xdc, 0x11, 0x00, 0x16, 0xf3, 0xfd, 0xdb, 0x32, 0x24, 0x08,
+  0x1e, 0x1c, 0xe2, 0x05, 0xc7, 0x3b, 0x08, 0xb3, 0x09, 0xda, 0x07, 0x06,
+  0xdf, 0xf4, 0x0b, 0xf8, 0x18, 0x1a, 0xd5, 0xf9, 0x02, 0x16, 0x07, 0x3b,
+  0x04, 0x5b, 0xdd, 0xd8, 0xfa, 0x1d, 0xd4, 0x03, 0xc4, 0x4b, 0x3e, 0xf6,
+  0x27, 0xfc, 0x11, 0x3c, 0x03, 0xd1, 0x11, 0x0f, 0x03, 0xfd, 0xff, 0x0a,
+  0x0d, 0x31, 0xf3, 0xde, 0xc0, 0x14, 0xe8, 0x45, 0x03, 0xe3, 0xfb, 0x0b,
+  0xd6, 0x20, 0xe8, 0x14, 0x8b, 0xdd, 0x16, 0x19, 0xb3, 0x06, 0x1b, 0xe9,
+  0x00, 0x81, 0xd8, 0x2e, 0xf2, 0x2f, 0x51, 0x2b, 0x29, 0x33, 0xf0, 0x09,
+  0x06, 0xca, 0x28, 0x08, 0x23, 0xed, 0xd5, 0xfe, 0x4f, 0x39, 0xf3, 0x03,
+  0x1d, 0x3c, 0xf4, 0xe8, 0x1a, 0x03, 0x81, 0xf0, 0xfb, 0xd1, 0xe0, 0x02,
+  0xe2, 0x0b, 0xe3, 0xf4, 0x1b, 0x1e, 0x1c, 0xa8, 0xd8, 0xea, 0x28, 0x35,
+  0xf0, 0xe1, 0x0a, 0x2d, 0xde, 0x0d, 0x4d, 0xd8, 0x19, 0x0b, 0xfd, 0x06,
+  0x31, 0x07, 0x3d, 0x02, 0x06, 0x4d, 0x3a, 0xcf, 0xbf, 0xd8, 0xeb, 0xfe,
+  0xe7, 0x07, 0xeb, 0x0a, 0x20, 0xd7, 0xfd, 0x1a, 0x26, 0xed, 0x08, 0x27,
+  0x05, 0xae, 0x1c, 0xc3, 0x04, 0x24, 0xf0, 0x0d, 0xb1, 0x1d, 0xc7, 0xed,
+  0x0f, 0x26, 0x2f, 0xbf, 0x1f, 0xee, 0x09, 0xe9, 0x62, 0x1c, 0xe6, 0x54,
+  0x19, 0x18, 0x05, 0x12, 0x09, 0xd7, 0xc8, 0xc8, 0xda, 0xad, 0xe7, 0x36,
+  0x1e, 0xd7, 0x2d, 0xf8, 0xbc, 0x08, 0xef, 0x19, 0x25, 0xe1, 0x10, 0xfb,
+  0x12, 0xe7, 0xdd, 0xd8, 0xd9, 0xf9, 0x1f, 0xc4, 0x11, 0xff, 0xc9, 0x27,
+  0xc6, 0xf6, 0x07, 0x17, 0xcf, 0xfa, 0xd7, 0x22, 0xc7, 0x3a, 0x0c, 0xc3,
+  0xc9, 0x81, 0x36, 0x17, 0xe1, 0xd7, 0x39, 0x3f, 0xa9, 0xf2, 0x5e, 0x6f,
+  0xdc, 0xc1, 0x0b, 0x44, 0xec, 0x1b, 0x14, 0xf3, 0xf1, 0xf8, 0x2d, 0x14,
+  0x48, 0x16, 0xd2, 0x62, 0x33, 0xe4, 0x01, 0x00, 0xe5, 0xf6, 0xe1, 0xaa,
+  0xca, 0xb9, 0x1c, 0xcd, 0x15, 0xbd, 0xc1, 0xfd, 0xae, 0xc8, 0x07, 0xd7,
+  0xeb, 0xf9, 0xe3, 0xb6, 0xe0, 0x00, 0xf2, 0x16, 0x7e, 0x0f, 0xb9, 0x1d,
+  0x42, 0xfc, 0xc9, 0x8b, 0xd9, 0xee, 0x16, 0x33, 0xe2, 0x40, 0xee, 0xee,
+  0xb4, 0x47, 0xd3, 0xc7, 0x4a, 0xf0, 0x0e, 0xfa, 0x21, 0xe8, 0xd3, 0xa8,
+  0xfb, 0x26, 0x09, 0xe3, 0x1a, 0xbe, 0xbf, 0x0d, 0xb9, 0x14, 0x16, 0x30,
+  0x30, 0x10, 0x43, 0xc0, 0xee, 0x00, 0x3d, 0xe2, 0x03, 0xe8, 0x08, 0x2e,
+  0xcb, 0x0b, 0x21, 0xf3, 0x06, 0xfe, 0x0e, 0xcb, 0xc5, 0xb0, 0xe8, 0x57,
+  0xf3, 0x4d, 0xfc, 0x37, 0x2e, 0xf3, 0x55, 0x2b, 0xbe, 0xc7, 0xf9, 0xfc,
+  0xe0, 0xaa, 0x18, 0x00, 0x3c, 0x73, 0x1c, 0xeb, 0x03, 0x03, 0x1d, 0x65,
+  0x0e, 0xec, 0x25, 0x4f, 0xf8, 0xbe, 0x77, 0xa2, 0xdf, 0xd0, 0x24, 0xcb,
+  0x71, 0x0a, 0x45, 0xe7, 0xfb, 0xd8, 0x1a, 0x28, 0x81, 0xfb, 0xdf, 0x10,
+  0x2e, 0x43, 0x3e, 0x3c, 0x21, 0x90, 0x30, 0xec, 0x32, 0xde, 0xe3, 0xb0,
+  0x14, 0xee, 0xc3, 0xb9, 0x06, 0x30, 0xb8, 0xba, 0xe9, 0xd0, 0xec, 0xb7,
+  0x0c, 0x4a, 0xf4, 0x15, 0xe8, 0x0f, 0xcf, 0x22, 0x27, 0x04, 0x9e, 0xda,
+  0xe7, 0xd5, 0x27, 0xe4, 0xb3, 0x24, 0x0e, 0xea, 0xbb, 0x9f, 0xac, 0x2b,
+  0x03, 0x1f, 0x48, 0xd4, 0x4e, 0x98, 0xf3, 0xa5, 0x02, 0x20, 0x17, 0xea,
+  0xdf, 0x10, 0xf4, 0x03, 0x00, 0x2b, 0xef, 0x05, 0x11, 0x2f, 0x33, 0x49,
+  0xf1, 0xfd, 0xd1, 0x1b, 0xb3, 0x23, 0x26, 0x1b, 0x54, 0x0f, 0x25, 0x00,
+  0xfc, 0xfa, 0x3d, 0x16, 0xf2, 0xe5, 0x1b, 0xb3, 0x35, 0xe1, 0x14, 0x44,
+  0xfa, 0x53, 0x2f, 0xb0, 0x20, 0xf0, 0xe8, 0xf7, 0x41, 0x38, 0x2b, 0xea,
+  0xec, 0x1b, 0xaa, 0xd6, 0xbf, 0x2e, 0xf8, 0xf5, 0x9a, 0xdf, 0x13, 0xc5,
+  0xd3, 0x27, 0xa7, 0xe9, 0xeb, 0x5a, 0xf4, 0x1c, 0x2d, 0x46, 0x0c, 0x43,
+  0xd9, 0xd9, 0x1a, 0x34, 0xf0, 0x42, 0x0b, 0xf3, 0x2f, 0x18, 0x37, 0xf5,
+  0x40, 0x44, 0xdd, 0xd9, 0xd2, 0x05, 0x1a, 0x14, 0x24, 0xed, 0xed, 0x73,
+  0xdf, 0x02, 0xe2, 0xfc, 0xe0, 0x25, 0x0b, 0xe7, 0x17, 0xe6, 0x08, 0xd7,
+  0x33, 0x07, 0x08, 0x06, 0x52, 0xb6, 0xa8, 0x23, 0x0d, 0x1b, 0x66, 0xcd,
+  0x17, 0xd3, 0x23, 0x22, 0x2d, 0x00, 0xcc, 0xd7, 0x81, 0xcf, 0xce, 0x4e,
+  0x19, 0x20, 0xd8, 0x4b, 0x56, 0x36, 0x3e, 0xff, 0xf9, 0x0b, 0xe5, 0x30,
+  0xd8, 0x75, 0xcb, 0xb8, 0x0a, 0x27, 0x09, 0x2f, 0x43, 0x31, 0x1e, 0x30,
+  0x08, 0xb8, 0x27, 0xf6, 0x31, 0xe5, 0xf4, 0xd5, 0xe6, 0x0b, 0xdf, 0xcf,
+  0x26, 0xce, 0xe7, 0xed, 0xe6, 0xe4, 0xe3, 0x00, 0xfd, 0xc5, 0xeb, 0xd6,
+  0x24, 0x0e, 0xae, 0x07, 0xaf, 0xcf, 0x1d, 0xe9, 0x0b, 0xef, 0x17, 0x0e,
+  0x15, 0xfe, 0x28, 0x09, 0xfc, 0x2b, 0xd8, 0xc1, 0xd6, 0xe7, 0xe5, 0xf8,
+  0x10, 0x1b, 0x0d, 0xde, 0xf1, 0x1e, 0x20, 0x0c, 0xd4, 0xe2, 0xf4, 0x03,
+  0xf1, 0x3b, 0x36, 0xe3, 0xf9, 0x40, 0x49, 0x09, 0x32, 0x1f, 0xee, 0xd2,
+  0x0f, 0x1b, 0xd5, 0x20, 0x0b, 0xeb, 0xf5, 0x10, 0xf1, 0xfe, 0x23, 0xf7,
+  0x07, 0xf4, 0xf9, 0x34, 0xbf, 0xd5, 0x15, 0x34, 0xe5, 0xef, 0x48, 0x26,
+  0x11, 0x15, 0x09, 0xfe, 0xfe, 0xc9, 0x03, 0x38, 0xda, 0x02, 0x12, 0xef,
+  0x7f, 0x26, 0x3f, 0xe1, 0xe3, 0x36, 0x2e, 0x21, 0x2e, 0xf7, 0x36, 0x03,
+  0xf2, 0x06, 0xcd, 0x31, 0xfa, 0xf2, 0x19, 0xf8, 0xf6, 0xb1, 0xe8, 0xe8,
+  0x27, 0xfe, 0x18, 0xdf, 0x28, 0x0e, 0x10, 0x09, 0x1c, 0x45, 0xa0, 0xe8,
+  0x09, 0xa0, 0x81, 0xf5, 0x06, 0x14, 0xf4, 0xff, 0x8c, 0xf5, 0x0d, 0x20,
+  0xa4, 0x38, 0x0b, 0xfb, 0xf6, 0xdc, 0xcf, 0x0b, 0xf5, 0x2a, 0xd7, 0x10,
+  0x04, 0x18, 0xf3, 0xc6, 0x3c, 0x1b, 0x3a, 0xda, 0x10, 0xd1, 0xdf, 0x00,
+  0x45, 0xf1, 0x0d, 0x04, 0xa6, 0x0a, 0x1d, 0xf3, 0x14, 0x28, 0x0f, 0xcd,
+  0xf1, 0xe2, 0x29, 0x11, 0xfa, 0x0b, 0x04, 0x4f, 0xed, 0xef, 0x20, 0xbb,
+  0x10, 0x16, 0x22, 0x1b, 0xb5, 0x14, 0x07, 0x45, 0xde, 0xdb, 0x2d, 0xbf,
+  0xac, 0xdd, 0x1f, 0x2e, 0xf3, 0x28, 0x04, 0xeb, 0xc7, 0x5a, 0xc4, 0x49,
+  0x2d, 0x03, 0xfb, 0x1f, 0xf4, 0xd4, 0xc7, 0xfe, 0xe3, 0x37, 0xdd, 0xb2,
+  0xc9, 0x04, 0xb7, 0xe3, 0x15, 0xb0, 0xbb, 0xec, 0xe8, 0x04, 0xf5, 0x00,
+  0xe2, 0xff, 0x21, 0xfd, 0xfe, 0x06, 0xdc, 0xbf, 0xbb, 0x19, 0x22, 0xed,
+  0xab, 0x01, 0x06, 0x17, 0xb1, 0xf0, 0xa9, 0x29, 0xd5, 0x08, 0x2f, 0xf6,
+  0x3f, 0xf2, 0xbb, 0xfb, 0x3e, 0xd7, 0xd6, 0xc9, 0xc5, 0xd6, 0xfc, 0xa3,
+  0xd3, 0xf7, 0xe2, 0x5a, 0xa5, 0xfc, 0x0b, 0x05, 0x13, 0x2e, 0x09, 0x25,
+  0xcf, 0xdf, 0x25, 0xca, 0x2e, 0x2b, 0xce, 0xfd, 0xf0, 0xe8, 0xeb, 0x16,
+  0x81, 0xea, 0x18, 0xbe, 0xe7, 0x01, 0xdd, 0x18, 0x2e, 0x18, 0xfb, 0xfa,
+  0x15, 0x11, 0x04, 0x02, 0x1c, 0xaa, 0xf9, 0xee, 0x29, 0xe9, 0x16, 0xe1,
+  0x30, 0xf5, 0x12, 0xbc, 0x0e, 0xe8, 0x13, 0xe7, 0xf6, 0xf8, 0xed, 0xc6,
+  0xf3, 0xe8, 0xbe, 0xcd, 0x27, 0x12, 0x4f, 0xfe, 0xfd, 0x42, 0xb2, 0xc9,
+  0x1b, 0x3f, 0xe0, 0x0e, 0x83, 0xd8, 0x22, 0xf1, 0x0b, 0xee, 0xfa, 0xf1,
+  0xbc, 0xf3, 0xe7, 0xf0, 0xcd, 0xf3, 0x05, 0xd6, 0xee, 0x43, 0x25, 0xbd,
+  0x0e, 0x21, 0x15, 0x1d, 0x26, 0x0f, 0x2a, 0xeb, 0xf5, 0x1a, 0xc3, 0x05,
+  0xc5, 0x08, 0xe4, 0xe9, 0xee, 0xd5, 0x01, 0x53, 0xf6, 0xd3, 0x06, 0x0a,
+  0x1a, 0xfd, 0x00, 0x0a, 0xd5, 0x2c, 0xe4, 0xe6, 0x1c, 0x0e, 0xc7, 0xf9,
+  0xf6, 0x26, 0xd5, 0x33, 0x4c, 0x0f, 0xe7, 0x04, 0xed, 0x15, 0xea, 0xdf,
+  0x7f, 0xde, 0xc2, 0xf7, 0xdc, 0xd1, 0xe9, 0x12, 0xd3, 0xea, 0xf0, 0xf1,
+  0xec, 0xef, 0xdf, 0x2d, 0x00, 0xd9, 0xe4, 0xe6, 0x01, 0xdb, 0xd5, 0xbb,
+  0x32, 0x0c, 0xea, 0x05, 0xf4, 0xfd, 0x21, 0x1c, 0x2e, 0x1a, 0x0e, 0xde,
+  0xe5, 0xf6, 0x0a, 0xc7, 0xe5, 0xe8, 0xce, 0xeb, 0x53, 0x2c, 0xfc, 0xd3,
+  0xef, 0x24, 0xfc, 0xe1, 0x06, 0xf3, 0x0b, 0x51, 0x28, 0x53, 0x28, 0xf7,
+  0x22, 0x9d, 0xfb, 0x3a, 0x24, 0x44, 0x21, 0xf5, 0x0e, 0x02, 0xa3, 0x16,
+  0xf6, 0x07, 0x4b, 0x06, 0xf9, 0xfc, 0xe8, 0x55, 0x18, 0xf7, 0x1a, 0x57,
+  0x0c, 0xf2, 0xf7, 0xdc, 0xf5, 0xd8, 0xd6, 0xd2, 0xeb, 0xcf, 0x04, 0xeb,
+  0x09, 0x2b, 0xeb, 0x0e, 0xd2, 0xef, 0x12, 0xe1, 0x1f, 0x46, 0xec, 0xf6,
+  0xdc, 0xe1, 0xf3, 0x20, 0x34, 0x40, 0x39, 0xc5, 0x41, 0xd0, 0x13, 0xdf,
+  0xbe, 0x1c, 0x2a, 0xfb, 0x1a, 0x19, 0xb5, 0x20, 0xe4, 0x08, 0x21, 0x20,
+  0x2f, 0x2e, 0xef, 0x27, 0xf3, 0x07, 0xfe, 0xf0, 0xd5, 0x70, 0x16, 0xe0,
+  0xcd, 0x3b, 0x0a, 0x1c, 0x0f, 0xde, 0x32, 0xea, 0x77, 0x08, 0x0e, 0xfc,
+  0x0b, 0x2b, 0x0d, 0xe3, 0x81, 0x36, 0xee, 0x13, 0x26, 0xfb, 0xc2, 0x02,
+  0x02, 0xf7, 0xe4, 0x1f, 0xe2, 0x10, 0x36, 0x0c, 0xc2, 0xdd, 0x1e, 0xea,
+  0x29, 0xac, 0x19, 0x4b, 0xf1, 0xdc, 0x05, 0xe1, 0x1d, 0x29, 0xea, 0x08,
+  0xa4, 0xdf, 0x12, 0xfa, 0x56, 0xce, 0x29, 0xd9, 0x2c, 0xbf, 0xb9, 0xea,
+  0x05, 0x1e, 0xd9, 0xfe, 0x07, 0xfd, 0x9a, 0xb1, 0x81, 0x9d, 0xf0, 0xdf,
+  0x2b, 0xe2, 0x2f, 0x88, 0xf7, 0x00, 0xe4, 0x9d, 0xff, 0x09, 0xf6, 0x39,
+  0xc4, 0x18, 0xed, 0x2c, 0xd1, 0xa0, 0x49, 0xf3, 0xfe, 0x11, 0x02, 0x03,
+  0x1e, 0x53, 0x19, 0x0b, 0xf3, 0xb1, 0x1a, 0x6c, 0x84, 0xca, 0xb4, 0xca,
+  0xd6, 0x1b, 0x30, 0x39, 0xc2, 0xda, 0xa6, 0x17, 0xef, 0x09, 0x2d, 0x24,
+  0xb8, 0xe3, 0x57, 0x26, 0xac, 0x1f, 0xe4, 0x1a, 0xfb, 0x3a, 0x1b, 0x0a,
+  0xf9, 0xff, 0x3f, 0x0f, 0x3e, 0xbd, 0x71, 0xe7, 0x14, 0xf0, 0xfc, 0xa5,
+  0x33, 0xde, 0xe1, 0x4b, 0x27, 0xc7, 0x14, 0xd6, 0x44, 0xc7, 0x4f, 0x1c,
+  0xd4, 0xdb, 0x11, 0x6b, 0x3c, 0xf0, 0xe7, 0x13, 0xcf, 0x69, 0xc1, 0x52,
+  0xff, 0xec, 0x0c, 0xea, 0xf9, 0xe5, 0x25, 0x1e, 0xf3, 0x1b, 0xbc, 0x04,
+  0x0e, 0x0a, 0xf7, 0xdc, 0xd2, 0xb7, 0xfe, 0x34, 0x0e, 0x10, 0x4c, 0xd3,
+  0x1f, 0x29, 0x33, 0x33, 0xd1, 0xd3, 0x19, 0xeb, 0xc9, 0xea, 0x23, 0x02,
+  0xc1, 0x46, 0x13, 0x34, 0x04, 0x25, 0x1c, 0xee, 0x1c, 0x05, 0xf3, 0xfe,
+  0x36, 0xd3, 0x12, 0xf4, 0xb5, 0x81, 0x28, 0xd3, 0x0f, 0xea, 0xf1, 0x0b,
+  0xca, 0x0c, 0x01, 0x21, 0x40, 0x0b, 0x27, 0x01, 0xf9, 0xbe, 0xcd, 0xef,
+  0x79, 0xb7, 0xf3, 0xf5, 0xf6, 0xc7, 0xe6, 0xe4, 0x92, 0x0f, 0xec, 0xbd,
+  0x2a, 0x1b, 0x07, 0xf3, 0x02, 0xe8, 0x08, 0x26, 0x23, 0x11, 0xfa, 0x10,
+  0xcb, 0x86, 0x0f, 0xdb, 0x68, 0xc4, 0xc6, 0xcf, 0xf2, 0xe5, 0x6b, 0x2d,
+  0xdc, 0xd5, 0x35, 0xc5, 0xfe, 0xe8, 0xf7, 0xa0, 0xd9, 0xfc, 0xe5, 0x0c,
+  0xe4, 0x06, 0x33, 0x08, 0x2a, 0xfd, 0x9f, 0xee, 0x0e, 0x5c, 0x1c, 0x0e,
+  0xf4, 0xbe, 0x2e, 0x1c, 0xe1, 0x36, 0x44, 0x04, 0xc5, 0x15, 0x29, 0xde,
+  0xcf, 0x1b, 0x07, 0x1e, 0xdc, 0x23, 0x2b, 0x1d, 0x46, 0x9d, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
   0x6d, 0x03, 0x00, 0x00, 0xe8, 0xff, 0xff, 0xff, 0x47, 0x12, 0x00, 0x00,
   0x24, 0x08, 0x00, 0x00, 0xd2, 0x0f, 0x00, 0x00, 0xb5, 0xf2, 0xff, 0xff,
   0x53, 0x1a, 0x00, 0x00, 0x8d, 0x16, 0x00, 0x00, 0x44, 0x1c, 0x00, 0x00,
@@ -2051,1482 +2057,1483 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0xd8, 0x09, 0x00, 0x00, 0xbe, 0xc7, 0xff, 0xff, 0x8f, 0xd3, 0xff, 0xff,
   0xac, 0xf5, 0xff, 0xff, 0x54, 0x04, 0x00, 0x00, 0xcb, 0x0d, 0x00, 0x00,
   0xa6, 0xf1, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x36, 0x25, 0x00, 0x00,
-  0x0f, 0x14, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0x7e, 0x9f, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x66, 0x6e, 0x1f, 0xb8,
-  0x7f, 0x31, 0x17, 0x7f, 0x81, 0x7f, 0x70, 0xfa, 0x4b, 0x7f, 0x36, 0xa1,
-  0x4e, 0x7f, 0x7f, 0x10, 0x35, 0x7f, 0x81, 0x85, 0x7f, 0x7f, 0x8c, 0xe0,
-  0x8d, 0x81, 0xa8, 0x81, 0xa5, 0x81, 0x0c, 0x81, 0x00, 0x81, 0x81, 0x7f,
-  0x81, 0x8a, 0xb1, 0xbd, 0x81, 0x5b, 0x81, 0x7f, 0x5e, 0x4c, 0xd2, 0x7b,
-  0x0c, 0x81, 0x81, 0x81, 0xda, 0xc5, 0x7f, 0xc3, 0x3a, 0x13, 0x4a, 0xc8,
-  0x41, 0xdb, 0x7f, 0x3c, 0xbc, 0x12, 0xc8, 0x86, 0xf4, 0x4f, 0x7f, 0xa3,
-  0xe6, 0x44, 0x7f, 0xf2, 0xd5, 0x01, 0x7f, 0x81, 0x77, 0x2c, 0xca, 0x7f,
-  0x7f, 0xbe, 0x15, 0x3e, 0xc4, 0x81, 0xf7, 0x81, 0xb0, 0x40, 0x69, 0x81,
-  0xd2, 0x37, 0x50, 0xbe, 0x82, 0x5e, 0xaf, 0x81, 0x7f, 0x55, 0x7f, 0x68,
-  0x99, 0x43, 0x13, 0x6e, 0x81, 0x49, 0x21, 0xe3, 0x27, 0x7f, 0xcd, 0x3d,
-  0xd3, 0x49, 0x62, 0x8b, 0x7f, 0x3b, 0xec, 0xdb, 0x1c, 0x3a, 0xf3, 0x19,
-  0xd9, 0x69, 0x6d, 0x18, 0x00, 0x14, 0x2c, 0xef, 0x21, 0x38, 0x68, 0x1e,
-  0xda, 0x48, 0xb3, 0xa8, 0x23, 0x60, 0xc4, 0x87, 0xa4, 0xa7, 0x9f, 0xde,
-  0xd8, 0x94, 0x38, 0x03, 0x71, 0xd2, 0xfa, 0x63, 0xa6, 0xc2, 0xbc, 0x04,
-  0xa2, 0x30, 0xc8, 0x2a, 0x7f, 0x41, 0xae, 0x40, 0xf5, 0xcf, 0xc8, 0xe9,
-  0xfe, 0xf9, 0x6b, 0x77, 0x1f, 0x07, 0x32, 0x0c, 0x07, 0xdf, 0x20, 0x50,
-  0x0a, 0xea, 0x2e, 0xe0, 0xdc, 0x1e, 0x48, 0xdd, 0xa5, 0x4b, 0x07, 0x00,
-  0x17, 0xfa, 0x06, 0xb3, 0x2a, 0x06, 0xdb, 0x48, 0x7b, 0xd6, 0xc6, 0x2a,
-  0xd5, 0xa3, 0xdc, 0xdb, 0xdf, 0x09, 0x6c, 0xc0, 0x09, 0xf8, 0x2f, 0x93,
-  0xb9, 0x2c, 0x90, 0xb5, 0x61, 0xe4, 0x63, 0x6a, 0xe1, 0x1b, 0x20, 0x5e,
-  0xcd, 0x5a, 0x06, 0x9b, 0xc3, 0xf0, 0xe6, 0x11, 0xa9, 0x12, 0x13, 0xba,
-  0x7a, 0x45, 0x04, 0xef, 0x1f, 0x0d, 0xfd, 0x1d, 0xdd, 0x5a, 0x73, 0x1c,
-  0x09, 0xc7, 0x3c, 0xe1, 0x17, 0x23, 0x56, 0x12, 0x81, 0x29, 0xb7, 0x81,
-  0x11, 0x25, 0xd8, 0x81, 0xc6, 0xd1, 0xd2, 0x19, 0x0c, 0x90, 0x38, 0xe8,
-  0x2e, 0xf8, 0xe9, 0x31, 0xb6, 0xba, 0xea, 0xed, 0x8d, 0x62, 0xb1, 0x11,
-  0x47, 0x75, 0xb2, 0x28, 0xf2, 0xf5, 0xbb, 0xca, 0x15, 0xf1, 0x75, 0x55,
-  0x39, 0x10, 0x32, 0xfc, 0xdf, 0xe3, 0xf4, 0x42, 0xe1, 0x24, 0x71, 0x02,
-  0x41, 0x0e, 0x29, 0xec, 0xb9, 0x54, 0xca, 0xe5, 0x07, 0x01, 0xf8, 0xc2,
-  0x19, 0xcc, 0xa5, 0x4c, 0x69, 0xb0, 0xbf, 0xaa, 0xb5, 0xd7, 0x9f, 0xcf,
-  0x9e, 0x06, 0x7f, 0x24, 0xfa, 0xf6, 0x5d, 0x81, 0xa0, 0x13, 0x81, 0xc4,
-  0x2e, 0x81, 0x51, 0x2c, 0xef, 0x17, 0x02, 0x7f, 0xe6, 0x4c, 0xf5, 0x81,
-  0xc5, 0x01, 0x0f, 0x7a, 0x81, 0xf4, 0x15, 0x91, 0x78, 0x45, 0x00, 0xfc,
-  0x1e, 0x31, 0xf5, 0x0c, 0xf2, 0x55, 0x66, 0x2e, 0x3b, 0xca, 0x0c, 0xf1,
-  0x22, 0x0b, 0x09, 0x0b, 0xad, 0x41, 0xaf, 0x93, 0x08, 0x03, 0xc2, 0xe2,
-  0x0c, 0xac, 0xc5, 0x18, 0xfb, 0xbf, 0x05, 0xfe, 0x6c, 0xf3, 0xe0, 0x3f,
-  0xf9, 0x98, 0x1e, 0xfe, 0x9f, 0x3a, 0xa2, 0x05, 0xc9, 0x16, 0xa0, 0xd7,
-  0xfa, 0x20, 0xd4, 0xf6, 0x09, 0x0d, 0x04, 0x7b, 0x36, 0x01, 0x37, 0xee,
-  0xb1, 0xb1, 0xdd, 0x2b, 0xd7, 0xeb, 0x40, 0x7a, 0x50, 0x22, 0x31, 0x41,
-  0x0b, 0x73, 0x84, 0xdc, 0xd9, 0xe2, 0xf0, 0xf1, 0x17, 0xc5, 0xb0, 0x02,
-  0x60, 0x81, 0x10, 0x89, 0x83, 0xb2, 0x81, 0xd7, 0xa0, 0x3c, 0x66, 0x4b,
-  0x58, 0x34, 0x7f, 0xae, 0x97, 0x0c, 0xaf, 0xa4, 0x0b, 0x93, 0x25, 0x4b,
-  0xc8, 0x1b, 0x00, 0x5d, 0x0f, 0x7f, 0xfe, 0xc3, 0x05, 0xdf, 0x20, 0x33,
-  0x9f, 0xb7, 0xe8, 0x81, 0x67, 0x49, 0xfb, 0x02, 0x12, 0x01, 0xc9, 0x00,
-  0xf8, 0x42, 0x22, 0x3b, 0xd6, 0xe6, 0xc7, 0xf4, 0xed, 0xe2, 0x34, 0xcd,
-  0xbd, 0x6f, 0xc9, 0xd1, 0xea, 0xfb, 0x07, 0x4e, 0xec, 0xb3, 0xbb, 0x1b,
-  0x1c, 0xc1, 0xfb, 0xf5, 0x5e, 0xf0, 0xca, 0x1a, 0xcc, 0xaf, 0x2c, 0xbf,
-  0xaf, 0x48, 0xc0, 0x1a, 0x4e, 0x00, 0x81, 0xc6, 0xfd, 0x28, 0x1f, 0xed,
-  0x09, 0x0e, 0xe4, 0x2b, 0x34, 0xeb, 0xff, 0xdd, 0x90, 0x9b, 0xcf, 0xad,
-  0xd2, 0x99, 0x7f, 0x7f, 0x6b, 0x1f, 0x29, 0x79, 0xfb, 0x7f, 0xab, 0x22,
-  0xff, 0x07, 0xaa, 0x00, 0x2a, 0xd9, 0xe0, 0xf2, 0x3e, 0xaa, 0x33, 0x81,
-  0x9a, 0xd8, 0xe1, 0xb2, 0x81, 0x7f, 0x64, 0x28, 0x76, 0x1b, 0x37, 0xa9,
-  0xf0, 0xfe, 0xc3, 0xb9, 0x19, 0x85, 0x2c, 0x48, 0xec, 0xec, 0xca, 0x18,
-  0x2d, 0x3e, 0xb5, 0xac, 0x05, 0xe9, 0x57, 0x3c, 0x96, 0x83, 0x2b, 0xc3,
-  0x2e, 0x4c, 0xec, 0xec, 0x00, 0x03, 0x95, 0xf9, 0x10, 0xff, 0x44, 0x65,
-  0xc9, 0xee, 0xae, 0xe6, 0xca, 0xe3, 0x32, 0x81, 0xdf, 0x4d, 0x19, 0xa5,
-  0xd2, 0xff, 0x2c, 0x02, 0x15, 0x8f, 0x81, 0x09, 0x27, 0x05, 0x86, 0x14,
-  0x7f, 0xed, 0xe1, 0xef, 0xfb, 0xa7, 0x0a, 0xe1, 0x92, 0x3a, 0xa7, 0x1f,
-  0x53, 0x07, 0x9d, 0xe6, 0x0f, 0x2e, 0x35, 0xe8, 0xfc, 0x13, 0x18, 0x76,
-  0x26, 0x47, 0xeb, 0xee, 0xaa, 0xc5, 0xb1, 0x93, 0xe9, 0x81, 0x40, 0x1a,
-  0x7f, 0xf9, 0x42, 0x56, 0x3e, 0x09, 0xc3, 0x37, 0xd2, 0x40, 0xe7, 0xc8,
-  0x21, 0xf7, 0x2d, 0xcc, 0x26, 0xa5, 0x73, 0xd2, 0xaa, 0x02, 0x2c, 0xc0,
-  0xb4, 0x49, 0x2e, 0x4f, 0x72, 0xfe, 0x3b, 0xc7, 0xed, 0xec, 0x0a, 0xd9,
-  0x2e, 0xb6, 0x21, 0xf9, 0x2b, 0xe8, 0x81, 0xf9, 0x1c, 0x06, 0x99, 0xb1,
-  0xdf, 0x93, 0x1e, 0x27, 0xc7, 0x81, 0x3a, 0xbb, 0xd2, 0xd6, 0xf9, 0x40,
-  0xe6, 0x02, 0x99, 0x01, 0xf0, 0xf3, 0x56, 0x7f, 0xba, 0x0d, 0xa9, 0xdd,
-  0x9d, 0xf5, 0x6c, 0x8a, 0x4f, 0x42, 0x6c, 0xb9, 0xd7, 0x0e, 0x12, 0x3d,
-  0x17, 0x88, 0xbd, 0xf5, 0xf9, 0xfe, 0x06, 0x31, 0x4f, 0xe6, 0xc4, 0x15,
-  0x00, 0xcd, 0x0e, 0xc4, 0xb9, 0x33, 0xf6, 0x24, 0x4f, 0xc2, 0xd1, 0xb0,
-  0x0b, 0x2d, 0x2e, 0xea, 0xe2, 0xfe, 0xf3, 0x7f, 0x21, 0x25, 0xd0, 0x1e,
-  0x81, 0xeb, 0x82, 0x81, 0x1c, 0xb8, 0x1b, 0xf0, 0x46, 0x03, 0x5c, 0x51,
-  0x67, 0x1e, 0x1c, 0x40, 0xbc, 0x38, 0xbc, 0xe4, 0x1f, 0xf6, 0xfb, 0xe1,
-  0x31, 0x4f, 0x7f, 0x27, 0x81, 0x20, 0x49, 0xcc, 0x0a, 0x23, 0x59, 0x68,
-  0x49, 0x04, 0x37, 0x83, 0x43, 0xa6, 0x27, 0xf4, 0x2e, 0xd0, 0x32, 0xc1,
-  0x40, 0xc9, 0x87, 0xdc, 0x0e, 0xda, 0x9f, 0xda, 0xb3, 0xa5, 0xe5, 0x1f,
-  0xd2, 0xbd, 0x17, 0xca, 0xf6, 0xa6, 0xfe, 0x13, 0xee, 0xde, 0x81, 0xf3,
-  0x00, 0x07, 0x7f, 0x05, 0x81, 0x25, 0x81, 0xd7, 0x81, 0xf7, 0x29, 0xa0,
-  0x65, 0x17, 0x4d, 0xf3, 0xf1, 0xff, 0xea, 0x13, 0x20, 0xd2, 0xd9, 0xfe,
-  0xd0, 0xea, 0xb8, 0x49, 0x42, 0xf6, 0x03, 0xe6, 0x0b, 0xfc, 0x47, 0x9b,
-  0xee, 0x45, 0x02, 0x0b, 0x43, 0xbf, 0x9d, 0xe9, 0x0a, 0x2f, 0x4f, 0x1d,
-  0xf9, 0xf9, 0xd0, 0xce, 0xd0, 0x32, 0xda, 0x1c, 0x9b, 0x1b, 0x8c, 0xc5,
-  0x3c, 0xc4, 0xfc, 0xaa, 0x38, 0xeb, 0x35, 0x18, 0x7e, 0xde, 0x00, 0x54,
-  0xd5, 0x44, 0xa3, 0xcc, 0x0d, 0xf6, 0x54, 0xcb, 0x1f, 0x50, 0x66, 0x12,
-  0xd7, 0x31, 0x53, 0xb2, 0xc5, 0x1d, 0x3d, 0x35, 0x60, 0xcb, 0x1c, 0xd3,
-  0x5c, 0x81, 0x03, 0xec, 0xe6, 0x1d, 0x35, 0x82, 0x7f, 0xd1, 0xd3, 0x99,
-  0xf3, 0xd1, 0x91, 0xeb, 0x81, 0xc6, 0xa7, 0x28, 0xd0, 0xff, 0xd7, 0xff,
-  0xca, 0x81, 0xba, 0x36, 0x01, 0xe9, 0x94, 0xd4, 0x2a, 0xfc, 0x4c, 0xe7,
-  0xd2, 0xfe, 0xd5, 0xb8, 0xa1, 0xe0, 0x38, 0xa6, 0x1c, 0xd2, 0xf3, 0xac,
-  0xee, 0xef, 0xa2, 0x30, 0x4f, 0xf3, 0xfd, 0xad, 0xc4, 0x09, 0x81, 0x1c,
-  0x68, 0xd3, 0xdc, 0xef, 0x22, 0x37, 0x2d, 0xd4, 0xc4, 0x5e, 0xf0, 0xdb,
-  0x0f, 0xbf, 0x9b, 0xb5, 0x2c, 0x00, 0x15, 0x20, 0xef, 0x37, 0x1b, 0x89,
-  0xc4, 0x42, 0xc7, 0x65, 0xb2, 0x4c, 0xaa, 0xe6, 0x50, 0xae, 0x4e, 0x96,
-  0x37, 0xb3, 0x0f, 0xcb, 0x7e, 0x07, 0x47, 0x7d, 0xf1, 0x47, 0xa8, 0xa9,
-  0x48, 0x1b, 0x49, 0xb7, 0x2c, 0x59, 0x16, 0xf5, 0xb4, 0x25, 0xcf, 0xab,
-  0xa3, 0x2d, 0x23, 0x0d, 0x7f, 0x9a, 0x0b, 0xdb, 0x5e, 0xaa, 0xaa, 0xe1,
-  0x03, 0x5c, 0x3a, 0xce, 0x5a, 0xb5, 0x24, 0xe7, 0xcb, 0xc9, 0x81, 0xad,
-  0x9d, 0xc6, 0x81, 0x28, 0xe7, 0xff, 0xac, 0xcc, 0xc9, 0x88, 0x81, 0x7f,
-  0xf3, 0x81, 0xda, 0x85, 0x49, 0x31, 0x48, 0xde, 0x3e, 0xec, 0x04, 0x81,
-  0xb8, 0xa8, 0x22, 0xad, 0x28, 0xee, 0xef, 0xa8, 0xbb, 0xe3, 0x81, 0x54,
-  0x7f, 0xda, 0xf3, 0xc6, 0x81, 0x4c, 0xaa, 0x30, 0x79, 0xbf, 0xf2, 0x04,
-  0x45, 0x7f, 0x7f, 0x81, 0xe1, 0x7f, 0xd2, 0xd2, 0xe0, 0x81, 0xda, 0x81,
-  0x7f, 0x2e, 0xec, 0xe8, 0x81, 0x7f, 0xeb, 0x90, 0x81, 0x7f, 0x81, 0x7f,
-  0xcc, 0x7f, 0x92, 0x1d, 0x7f, 0x8f, 0x3a, 0xd7, 0x21, 0x81, 0x0e, 0x81,
-  0x7f, 0xcf, 0x7b, 0x7f, 0x81, 0x7f, 0xb2, 0xef, 0x7f, 0x7f, 0x7f, 0xa8,
-  0x39, 0x53, 0x1f, 0xbf, 0xb3, 0x21, 0x8a, 0xdf, 0xd7, 0x2a, 0xdd, 0x1f,
-  0x65, 0x81, 0xc7, 0x14, 0x7f, 0x9f, 0x90, 0xea, 0xeb, 0x27, 0x15, 0x81,
-  0x2e, 0x81, 0x4b, 0x83, 0xbe, 0x8a, 0xeb, 0x9e, 0x91, 0xf1, 0xce, 0x7f,
-  0xa6, 0xe6, 0x81, 0xb9, 0x8a, 0xa4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x40, 0x00, 0x00, 0x16, 0xfb, 0x46, 0xd6, 0xe7, 0x00, 0xf9, 0xe8,
-  0xf7, 0xa8, 0x32, 0x01, 0xf9, 0x47, 0xf6, 0x43, 0xaa, 0xd7, 0x18, 0x2c,
-  0xf5, 0xe1, 0xbc, 0x0c, 0x0e, 0xe9, 0xcb, 0x13, 0x23, 0x07, 0xd0, 0x1d,
-  0x04, 0x4f, 0x3f, 0x38, 0xce, 0x0a, 0x0d, 0x11, 0x17, 0xe3, 0x3e, 0xcb,
-  0x17, 0xd2, 0xd3, 0xd0, 0xe0, 0x13, 0x10, 0xd1, 0xfa, 0xed, 0xf7, 0xad,
-  0xcd, 0x3b, 0xcb, 0xe7, 0xcf, 0xfb, 0xd6, 0xe3, 0x61, 0xeb, 0xb5, 0xf4,
-  0xbd, 0xed, 0x07, 0xf3, 0x0e, 0x0e, 0xf8, 0x21, 0x10, 0xe3, 0x1c, 0xf7,
-  0x15, 0x31, 0x22, 0xde, 0x3b, 0x11, 0xf9, 0x02, 0xc8, 0x0f, 0xfa, 0x5a,
-  0xfe, 0xf6, 0x2a, 0x30, 0xfb, 0xe1, 0x37, 0xde, 0x13, 0xdc, 0x37, 0x09,
-  0xef, 0x11, 0xc6, 0xf9, 0x07, 0x0b, 0xe3, 0x81, 0xf3, 0xf9, 0x35, 0xb1,
-  0x24, 0x0e, 0xe1, 0x00, 0xe9, 0x52, 0x22, 0xeb, 0xfa, 0xf2, 0xb0, 0xfb,
-  0xbb, 0xd8, 0x2c, 0x18, 0xe8, 0x13, 0x14, 0x38, 0x6a, 0x5e, 0xc7, 0x45,
-  0x0d, 0x48, 0xe4, 0x24, 0xe8, 0x0d, 0x4d, 0x33, 0x0f, 0xf0, 0x08, 0x25,
-  0xe1, 0x21, 0xf9, 0x81, 0x2e, 0xe2, 0xff, 0xe2, 0x3a, 0x13, 0x7b, 0x9b,
-  0x06, 0xa1, 0xac, 0xfe, 0x9d, 0x75, 0x20, 0x2d, 0x23, 0xf6, 0xd1, 0x72,
-  0x02, 0x0e, 0x23, 0x37, 0xf8, 0xf0, 0x38, 0x33, 0xd0, 0xf5, 0x02, 0x26,
-  0x3f, 0x29, 0x2a, 0x24, 0x4e, 0x70, 0x3a, 0x2b, 0xfd, 0xc5, 0x33, 0x03,
-  0xf3, 0xf6, 0xd0, 0x58, 0xd0, 0xe9, 0xfd, 0x2a, 0xac, 0x0b, 0xf5, 0x60,
-  0xf3, 0x10, 0xce, 0xc7, 0x90, 0x04, 0xfe, 0xdb, 0x04, 0xcb, 0xe2, 0x28,
-  0x19, 0xb3, 0xfe, 0xed, 0x2a, 0xf8, 0x06, 0x2d, 0xd1, 0x24, 0x1b, 0xd2,
-  0x2a, 0x24, 0xcc, 0xdb, 0x85, 0x26, 0x33, 0x37, 0xe5, 0x3d, 0xe7, 0x1b,
-  0xcc, 0x2b, 0x22, 0xc1, 0x51, 0xf0, 0xe6, 0x07, 0x37, 0xe6, 0xcb, 0xd6,
-  0x1f, 0xe1, 0xf2, 0xf4, 0x38, 0x24, 0xee, 0x38, 0xbd, 0xc1, 0xd5, 0xba,
-  0x45, 0xa2, 0x45, 0xe2, 0x8b, 0x22, 0x16, 0xea, 0xc5, 0x0a, 0xb8, 0xd6,
-  0xef, 0x0e, 0x7f, 0xe6, 0x09, 0xc7, 0x13, 0x00, 0xde, 0xc3, 0x1d, 0xb5,
-  0x01, 0xbf, 0x1e, 0x24, 0x3f, 0x08, 0x2a, 0xe2, 0x40, 0xea, 0x15, 0x24,
-  0xfc, 0xef, 0xc0, 0xbf, 0xe5, 0x11, 0x01, 0x16, 0x43, 0xf4, 0x25, 0x5f,
-  0x3b, 0x26, 0x32, 0x54, 0x1f, 0x18, 0x8b, 0x00, 0x07, 0x27, 0x46, 0x5c,
-  0xb4, 0x26, 0xfe, 0xc3, 0x03, 0x29, 0xfb, 0x08, 0xf4, 0x0f, 0x44, 0x5f,
-  0xc2, 0x0b, 0x1f, 0xcd, 0x1a, 0x38, 0xfe, 0xe7, 0x39, 0xf6, 0xd3, 0xc0,
-  0x25, 0x36, 0x50, 0x05, 0x84, 0x29, 0x4e, 0x58, 0x2d, 0x4d, 0x24, 0x06,
-  0xcf, 0xb9, 0xf2, 0x3f, 0xf3, 0xf7, 0x1f, 0xca, 0xf8, 0x19, 0x9d, 0xc9,
-  0x50, 0x1c, 0x60, 0x3b, 0xbc, 0x01, 0xb6, 0x27, 0x0e, 0x2e, 0x33, 0x13,
-  0x2b, 0x54, 0xf1, 0x22, 0xba, 0xf2, 0x0d, 0x14, 0xbe, 0xf7, 0x4b, 0xdb,
-  0x10, 0xe5, 0xdf, 0xf3, 0xa8, 0xe1, 0xaf, 0x16, 0xee, 0x1b, 0x37, 0x0c,
-  0x2a, 0x02, 0x1c, 0xdd, 0x52, 0xbe, 0x9a, 0xfe, 0xcc, 0x4b, 0xcb, 0xf2,
-  0xda, 0x50, 0xc3, 0x55, 0x0b, 0x2e, 0xe1, 0x2e, 0xa7, 0xfe, 0xe7, 0xd8,
-  0x05, 0xc5, 0xe1, 0x12, 0x25, 0x20, 0xfa, 0xef, 0xed, 0x32, 0x44, 0x1c,
-  0xe8, 0xf3, 0xca, 0xfd, 0xec, 0x0d, 0x21, 0xe7, 0xe0, 0x39, 0xd2, 0x25,
-  0x94, 0xcb, 0xd5, 0x1a, 0x06, 0xf4, 0x3f, 0xe4, 0xcb, 0x54, 0x04, 0xe8,
-  0x03, 0xd0, 0x17, 0x16, 0x21, 0xcb, 0x16, 0x0b, 0xdd, 0x0b, 0x1c, 0xf0,
-  0xbf, 0x60, 0x1a, 0xe5, 0x09, 0x59, 0xfc, 0x40, 0x81, 0xc9, 0xb9, 0x2f,
-  0xe3, 0x7b, 0xfe, 0xf1, 0xe0, 0x23, 0x46, 0xe8, 0x49, 0xcd, 0x08, 0xec,
-  0x19, 0xdb, 0xc4, 0x17, 0x1f, 0x03, 0x19, 0xae, 0xdc, 0x1d, 0xfb, 0xd6,
-  0x31, 0x22, 0x14, 0xfd, 0xed, 0xc0, 0x17, 0x35, 0x1f, 0x19, 0x18, 0x26,
-  0x09, 0x4e, 0xc9, 0xe3, 0x63, 0x03, 0xf3, 0xba, 0xe7, 0x05, 0xf7, 0xf6,
-  0xa9, 0xa3, 0x08, 0xce, 0x10, 0x59, 0xeb, 0x0e, 0x16, 0xce, 0x20, 0xb7,
-  0xfe, 0x0f, 0x10, 0xf0, 0xf5, 0xdb, 0x08, 0x22, 0x9c, 0xf6, 0xea, 0x23,
-  0x3f, 0x01, 0x90, 0x2a, 0xf0, 0xd5, 0xc9, 0x21, 0xd0, 0xfb, 0x1f, 0xbf,
-  0x11, 0xf2, 0x33, 0xd3, 0xf2, 0x4b, 0x06, 0xf7, 0xd6, 0xdc, 0xdd, 0x2c,
-  0x2f, 0x0b, 0x56, 0xf4, 0xe4, 0xb5, 0x1c, 0xd0, 0x0a, 0x04, 0xc4, 0x2e,
-  0xee, 0xd3, 0xff, 0x16, 0xdb, 0x09, 0x21, 0xfd, 0xf7, 0xdb, 0xfb, 0x01,
-  0xb2, 0x2e, 0x2e, 0x14, 0xe4, 0x81, 0x02, 0x11, 0x0e, 0x0f, 0xf8, 0xd9,
-  0x33, 0xe8, 0x08, 0x07, 0x1f, 0x3b, 0x2b, 0x2d, 0xca, 0x1b, 0xc9, 0x0d,
-  0xc2, 0xdb, 0xc8, 0x0d, 0x17, 0x27, 0x21, 0xf1, 0x18, 0x1d, 0x02, 0x77,
-  0x44, 0xed, 0x21, 0xd4, 0x00, 0xea, 0xed, 0xfd, 0x3c, 0xf2, 0x28, 0xd0,
-  0xd0, 0xd2, 0xda, 0x52, 0xfc, 0xbc, 0x3d, 0xb7, 0xc1, 0xfd, 0x10, 0xd7,
-  0xe9, 0x17, 0xcf, 0xfc, 0x2f, 0xd0, 0xf5, 0xca, 0x09, 0x1c, 0x4b, 0x2d,
-  0xf0, 0x33, 0xf9, 0xf9, 0x85, 0x05, 0xdf, 0xbb, 0xaa, 0x29, 0xd8, 0x44,
-  0x0f, 0xc4, 0xfb, 0xe8, 0x28, 0xfa, 0x0c, 0xdd, 0xfb, 0x0c, 0x18, 0xd5,
-  0x1f, 0x0c, 0xb5, 0x47, 0x06, 0x4b, 0x01, 0xd1, 0x02, 0x50, 0xf5, 0x29,
-  0xf2, 0xe3, 0x81, 0x12, 0x23, 0x22, 0xe9, 0x13, 0xfd, 0x05, 0x54, 0x26,
-  0xe1, 0xe7, 0x14, 0x23, 0x36, 0xe1, 0xed, 0xfe, 0xfa, 0x65, 0x98, 0xf4,
-  0x1e, 0xee, 0x33, 0xf6, 0x0f, 0x35, 0xe4, 0x3e, 0x19, 0xfc, 0x37, 0xf4,
-  0xec, 0x0f, 0xf8, 0x2e, 0x3d, 0xb9, 0xf1, 0xab, 0x1c, 0x0a, 0x07, 0xeb,
-  0xd2, 0x7d, 0x09, 0x13, 0x68, 0xbf, 0xbd, 0xfa, 0xc1, 0xc1, 0xef, 0xd8,
-  0x3d, 0xdf, 0xee, 0x2c, 0xcd, 0xf7, 0xf8, 0xcb, 0xe0, 0x4c, 0x1a, 0x23,
-  0xc2, 0xff, 0xcc, 0xe1, 0xf6, 0x0d, 0xc1, 0xff, 0x0e, 0xc1, 0xcc, 0x57,
-  0xdf, 0x48, 0x04, 0xe9, 0x1a, 0x98, 0x42, 0xcd, 0x09, 0xee, 0xdf, 0x54,
-  0xc1, 0x19, 0x5a, 0x0f, 0xb5, 0xe6, 0x04, 0xcb, 0x43, 0x59, 0x42, 0x51,
-  0xbd, 0xf9, 0xfc, 0xb4, 0xa8, 0x38, 0x52, 0xbe, 0x1c, 0xca, 0x55, 0x81,
-  0xf0, 0x22, 0x2f, 0xd9, 0x21, 0x2e, 0x91, 0xa0, 0x04, 0x4c, 0xd9, 0xf3,
-  0x17, 0xbe, 0xa1, 0xaf, 0x4e, 0x13, 0xcd, 0xf5, 0xe8, 0x36, 0xfa, 0x0f,
-  0x50, 0xec, 0xa3, 0x5c, 0xdf, 0x25, 0xeb, 0x27, 0xc2, 0x2d, 0x03, 0xfc,
-  0x5e, 0xe2, 0xd9, 0x06, 0x58, 0xd5, 0x6e, 0x5d, 0xec, 0xbe, 0xd2, 0xeb,
-  0x1c, 0x22, 0x3a, 0xd2, 0xd9, 0xc0, 0xc0, 0xf9, 0xf6, 0xd1, 0xbf, 0xe1,
-  0xfc, 0xab, 0xbb, 0x29, 0x4c, 0xf7, 0xf5, 0xf3, 0xeb, 0xfe, 0x3c, 0xdd,
-  0x1d, 0xe8, 0xe6, 0xc3, 0xa6, 0xcc, 0xc4, 0xd4, 0xb5, 0xe9, 0x32, 0xc6,
-  0xef, 0xbb, 0x0a, 0xb8, 0x3e, 0xca, 0xd0, 0xdf, 0xe6, 0x18, 0x3e, 0x1b,
-  0x0a, 0xe8, 0x46, 0xfc, 0xb5, 0xfb, 0xe8, 0x0a, 0xe7, 0x22, 0x03, 0xcb,
-  0xb2, 0xdf, 0x00, 0xdc, 0x11, 0x30, 0xc1, 0xc7, 0x9f, 0xdc, 0x1e, 0x5a,
-  0x03, 0xf9, 0xeb, 0x38, 0xe6, 0xb8, 0xd7, 0x1c, 0xea, 0xfc, 0x5f, 0xee,
-  0xa8, 0xe4, 0x04, 0x2c, 0x5d, 0x46, 0xfd, 0xff, 0x34, 0x33, 0xa9, 0x20,
-  0xe9, 0xa5, 0x55, 0x26, 0xee, 0xc1, 0x2d, 0x3d, 0xe2, 0x52, 0x3b, 0xc9,
-  0x2a, 0x10, 0x33, 0x06, 0xec, 0xc5, 0xd4, 0xe9, 0x3a, 0xdd, 0x0a, 0x28,
-  0xbe, 0xc4, 0x23, 0xd4, 0x7f, 0x33, 0xdb, 0x0b, 0xc5, 0xdb, 0xe8, 0x23,
-  0x11, 0x1f, 0xfc, 0x0e, 0x2a, 0x3d, 0xad, 0xe6, 0xec, 0xe8, 0xd0, 0xc3,
-  0xde, 0x13, 0x22, 0x16, 0xc2, 0x37, 0xd4, 0xee, 0xdb, 0x02, 0x05, 0xfe,
-  0xe6, 0xff, 0x66, 0xed, 0xf0, 0x0b, 0x3c, 0xfc, 0x11, 0xd8, 0xc9, 0x34,
-  0xbe, 0x18, 0xee, 0xfd, 0xef, 0xf6, 0x08, 0x32, 0xfa, 0xf5, 0xab, 0x7f,
-  0xe6, 0xf1, 0xee, 0x18, 0xcb, 0xcc, 0xd0, 0xd9, 0x08, 0xf6, 0xff, 0xc0,
-  0xd9, 0x4b, 0xc8, 0x20, 0x10, 0xfa, 0xf6, 0xda, 0xc3, 0xec, 0x00, 0xdb,
-  0xf2, 0xe3, 0x4b, 0x24, 0xdb, 0xd2, 0xe7, 0x2e, 0x02, 0xf6, 0xeb, 0xe4,
-  0xa9, 0x45, 0x52, 0x12, 0xf5, 0xde, 0x15, 0xd9, 0xe0, 0xf6, 0x2c, 0xff,
-  0x1c, 0x13, 0x16, 0x2f, 0xf0, 0x19, 0x0a, 0xe5, 0x52, 0x44, 0xe8, 0x37,
-  0xc6, 0xe6, 0xfc, 0x18, 0xc1, 0x13, 0xcf, 0x3b, 0xef, 0x10, 0x1a, 0xd0,
-  0x3f, 0xc6, 0xe9, 0x1c, 0xc2, 0xd3, 0x41, 0xc6, 0x05, 0x3e, 0x03, 0xdc,
-  0xcd, 0x3f, 0x57, 0xf7, 0xe5, 0xd5, 0xd7, 0x04, 0xf7, 0xd5, 0x36, 0xed,
-  0x1f, 0xcc, 0x32, 0x4b, 0xc6, 0xb9, 0x4a, 0x13, 0x1c, 0x29, 0x15, 0x12,
-  0x16, 0x18, 0xfe, 0x3b, 0xfb, 0x9c, 0x15, 0x04, 0x0f, 0x27, 0xc5, 0x35,
-  0xf5, 0xea, 0x2d, 0x2a, 0x2c, 0xf0, 0xfe, 0xee, 0x18, 0x59, 0x36, 0x7f,
-  0xb4, 0x32, 0xf7, 0x08, 0xdc, 0x13, 0x3d, 0x0c, 0xf4, 0x21, 0x1e, 0x43,
-  0x43, 0x1e, 0xcb, 0xbf, 0xfb, 0x41, 0x34, 0x01, 0xe1, 0xc4, 0x10, 0xf1,
-  0xfe, 0x62, 0x07, 0xb7, 0x31, 0x17, 0xa4, 0x0c, 0xdd, 0x43, 0x2c, 0xf8,
-  0x31, 0xae, 0xcc, 0xf4, 0xeb, 0x0b, 0x24, 0x19, 0x10, 0x3a, 0x3e, 0xa9,
-  0x21, 0x0f, 0xe2, 0xd8, 0x2b, 0xd4, 0x17, 0xdb, 0x9e, 0xf6, 0x61, 0xd7,
-  0xfd, 0x0c, 0x3d, 0xcb, 0x12, 0xe6, 0xed, 0x2c, 0x1b, 0x06, 0xd9, 0xe2,
-  0x1d, 0xfb, 0xfd, 0x3a, 0xe3, 0x4e, 0xff, 0x31, 0xcf, 0x52, 0x37, 0xd8,
-  0xc9, 0x07, 0xb3, 0x7f, 0xd8, 0x0a, 0x20, 0x55, 0xf9, 0xbe, 0x13, 0x0c,
-  0x0d, 0xb3, 0xc4, 0xdf, 0xe6, 0xcf, 0x12, 0x16, 0xe8, 0xfc, 0x16, 0xfc,
-  0x09, 0x32, 0xf6, 0xfa, 0xdc, 0x5c, 0x01, 0xbb, 0x14, 0xe8, 0x28, 0x20,
-  0x51, 0x0f, 0x07, 0xbf, 0xcc, 0xe5, 0x02, 0x0d, 0xb5, 0xe6, 0xda, 0x28,
-  0x1a, 0x68, 0xcf, 0xf2, 0xc9, 0xad, 0x1b, 0xe6, 0xfa, 0x4d, 0x0f, 0x18,
-  0x4b, 0xb8, 0x29, 0x2d, 0xca, 0x12, 0x47, 0xf3, 0xcc, 0xfb, 0x43, 0xb8,
-  0x1e, 0xc1, 0x0d, 0xd3, 0x09, 0x17, 0x15, 0x3c, 0x00, 0xa6, 0x16, 0x28,
-  0xa3, 0xf6, 0x2d, 0xf4, 0x44, 0xc6, 0xe5, 0x0a, 0x02, 0xd1, 0x26, 0xc4,
-  0x1d, 0x00, 0xf6, 0x07, 0xda, 0x35, 0xbd, 0x35, 0x5f, 0x28, 0x08, 0xc3,
-  0xf3, 0x34, 0xd4, 0xd6, 0xfa, 0xdb, 0xf0, 0xe6, 0x0b, 0x37, 0x01, 0x6a,
-  0x4b, 0x2b, 0xab, 0x3b, 0x4d, 0x33, 0xc6, 0xfe, 0x47, 0x1e, 0xe6, 0x0c,
-  0x11, 0x35, 0xb8, 0x43, 0xe5, 0x11, 0xe2, 0xe9, 0xe5, 0xd3, 0x2a, 0x10,
-  0x07, 0x23, 0x10, 0x10, 0x30, 0x03, 0xd0, 0x18, 0x15, 0x09, 0xbf, 0xb5,
-  0xa2, 0x1a, 0xd1, 0x28, 0x5e, 0x27, 0x3f, 0x0e, 0x1f, 0x27, 0xfa, 0x01,
-  0x8d, 0xa6, 0xc1, 0x0a, 0x2b, 0xf2, 0x34, 0xf3, 0xe8, 0x5f, 0x0b, 0xe1,
-  0xc0, 0x1b, 0xf9, 0x27, 0xe9, 0xee, 0xf7, 0xe4, 0xc9, 0x12, 0xd6, 0x07,
-  0x16, 0xe5, 0x5c, 0xdd, 0x16, 0xb4, 0x06, 0x02, 0x19, 0x67, 0x46, 0xcc,
-  0xc5, 0x7d, 0xbc, 0xa5, 0xe6, 0xc8, 0xda, 0x27, 0x8f, 0x0f, 0x57, 0xff,
-  0xec, 0x15, 0x1c, 0x32, 0x30, 0xc9, 0x2e, 0x04, 0x19, 0x49, 0xe2, 0x35,
-  0xf5, 0xc4, 0xe9, 0x25, 0xc2, 0x2d, 0xe1, 0x41, 0x81, 0x46, 0x24, 0x86,
-  0xf2, 0xf6, 0x04, 0x12, 0x0b, 0x19, 0xaf, 0x08, 0x1d, 0x19, 0xb8, 0xfa,
-  0x5a, 0x3a, 0xea, 0xeb, 0x45, 0xbc, 0xe8, 0xea, 0x34, 0xda, 0x38, 0x0d,
-  0xd0, 0xc9, 0xf2, 0x19, 0xfe, 0xe2, 0x18, 0xf3, 0xf9, 0x32, 0x2e, 0xe8,
-  0x14, 0xda, 0x33, 0xc0, 0x0f, 0xd9, 0x81, 0xd6, 0xbf, 0xf3, 0xd7, 0x26,
-  0x48, 0x48, 0xff, 0xf2, 0x4d, 0x0d, 0xd1, 0x56, 0x0a, 0xf9, 0x0b, 0x37,
-  0xce, 0xd7, 0x26, 0x0f, 0x37, 0xf8, 0x7a, 0x4a, 0x18, 0x25, 0x0d, 0x20,
-  0x56, 0x30, 0xba, 0xff, 0xdb, 0x1f, 0x3c, 0x19, 0xff, 0x17, 0xfa, 0xf8,
-  0xb3, 0x09, 0xbe, 0x19, 0x46, 0xe4, 0x31, 0x5f, 0x0a, 0x01, 0xe7, 0xf4,
-  0xef, 0xcf, 0xd5, 0xbd, 0x02, 0xe5, 0x47, 0xf2, 0x28, 0x1c, 0x45, 0xfd,
-  0xb4, 0x05, 0x2b, 0x05, 0x24, 0x47, 0xfb, 0x27, 0xfc, 0xfb, 0x35, 0x2a,
-  0x1c, 0x0a, 0x24, 0xef, 0xbc, 0xeb, 0xe4, 0xcb, 0x07, 0xd0, 0x41, 0x60,
-  0x0e, 0x05, 0xe9, 0x2a, 0xcd, 0x1d, 0x3d, 0x26, 0x5d, 0xca, 0xd5, 0x1a,
-  0xe4, 0x09, 0xe4, 0x3e, 0x13, 0x27, 0x31, 0xe7, 0xe0, 0xf9, 0xf0, 0x3a,
-  0xc5, 0xa4, 0xaa, 0x0d, 0xf8, 0xe2, 0xff, 0x46, 0x1a, 0xac, 0x4f, 0xe4,
-  0xd6, 0xba, 0xe7, 0xe1, 0x47, 0x49, 0xc3, 0x2b, 0x14, 0xe7, 0x0d, 0xe6,
-  0xb0, 0x8d, 0x0b, 0xe5, 0x03, 0xc2, 0xc9, 0xf3, 0x7f, 0xae, 0x15, 0xc6,
-  0xc6, 0xee, 0xfb, 0xe7, 0x1f, 0x3c, 0xf8, 0xd9, 0xf8, 0x54, 0xc2, 0xcb,
-  0xf2, 0xee, 0xf1, 0xf0, 0xc0, 0x44, 0x10, 0xec, 0x2d, 0xdb, 0x00, 0xe3,
-  0x11, 0x15, 0x07, 0x3a, 0xbb, 0x07, 0x0b, 0xc5, 0xe0, 0x2b, 0xbd, 0x13,
-  0xc5, 0x24, 0x23, 0x13, 0xfe, 0xef, 0xc9, 0xff, 0x02, 0x1c, 0xe9, 0xed,
-  0xf2, 0x34, 0xed, 0x06, 0xe3, 0xa5, 0xfa, 0xe5, 0xd6, 0xcb, 0x08, 0xff,
-  0x6c, 0xfe, 0x2b, 0xff, 0xb5, 0x09, 0x09, 0x17, 0x30, 0x38, 0xf3, 0x53,
-  0x35, 0xbd, 0xcd, 0x06, 0xe7, 0xb0, 0x25, 0x2d, 0xec, 0x05, 0xd1, 0x4a,
-  0x1b, 0x2d, 0xd3, 0xe4, 0x3c, 0x85, 0xdf, 0xfd, 0xf9, 0x12, 0x62, 0x2b,
-  0x2c, 0x3f, 0x42, 0x38, 0xfc, 0xd2, 0x14, 0xe8, 0xdc, 0xc7, 0x16, 0xc8,
-  0xb4, 0xeb, 0x08, 0x16, 0x02, 0x53, 0x1c, 0xef, 0x70, 0x4a, 0x27, 0xf7,
-  0xc8, 0xde, 0xf3, 0x07, 0xbb, 0x12, 0xfb, 0x0a, 0xf7, 0x1a, 0x2b, 0x19,
-  0x2a, 0x81, 0x00, 0xe8, 0x09, 0xc2, 0x1f, 0xa3, 0xc7, 0x54, 0xf0, 0xc0,
-  0x9f, 0x35, 0xa9, 0xc5, 0x4b, 0x08, 0x3e, 0xde, 0x08, 0x38, 0x91, 0x14,
-  0x1e, 0xc4, 0x14, 0x27, 0x3b, 0x1f, 0x1c, 0x06, 0xc3, 0xfd, 0xe3, 0x3c,
-  0x3e, 0x63, 0xb4, 0xfe, 0x01, 0x32, 0x19, 0x0c, 0x68, 0x49, 0xd8, 0x4c,
-  0x1e, 0x1a, 0x31, 0x35, 0xbd, 0x55, 0x24, 0x1f, 0x34, 0x4a, 0xf0, 0xb8,
-  0x41, 0xdf, 0x04, 0x15, 0x2e, 0xca, 0xce, 0xc9, 0x1b, 0x29, 0xd8, 0xa9,
-  0xcd, 0xfb, 0x04, 0x1d, 0x43, 0x13, 0xd9, 0xc8, 0xc4, 0xc3, 0xc6, 0xcf,
-  0x23, 0x02, 0x4d, 0xfb, 0xc4, 0xff, 0x00, 0xcb, 0x4c, 0x41, 0xe2, 0x09,
-  0xcc, 0x1a, 0xc0, 0x32, 0x03, 0x26, 0x0d, 0xdf, 0x27, 0x3c, 0xbd, 0x25,
-  0x1f, 0x1f, 0x0e, 0xda, 0xe4, 0xac, 0xf2, 0xe1, 0x2d, 0xff, 0x17, 0x15,
-  0xeb, 0x15, 0x2e, 0x0f, 0xb2, 0xe8, 0xeb, 0xf3, 0xe0, 0x31, 0x2a, 0xfa,
-  0xf4, 0xe6, 0xf1, 0xa4, 0x1f, 0x1c, 0x4f, 0xce, 0x13, 0xd5, 0x03, 0x81,
-  0xdf, 0x17, 0x54, 0xe3, 0x14, 0x16, 0x05, 0xec, 0x4a, 0x46, 0xd1, 0xf3,
-  0xe0, 0xb7, 0xc1, 0xf4, 0xfa, 0xeb, 0x34, 0x23, 0xff, 0x38, 0xf9, 0x1b,
-  0xfd, 0x30, 0xc4, 0xe7, 0x23, 0xf0, 0xe1, 0x50, 0x01, 0xdc, 0x0c, 0x21,
-  0x2d, 0x03, 0xb2, 0x1c, 0x08, 0xfe, 0x56, 0x28, 0xe5, 0xd8, 0xfc, 0x2d,
-  0xec, 0xf6, 0x3c, 0xe2, 0x08, 0x46, 0xca, 0x69, 0x29, 0x20, 0x4e, 0x63,
-  0x29, 0xfd, 0x02, 0xd6, 0xe1, 0x18, 0xe4, 0xf2, 0x32, 0xa0, 0xb0, 0x1d,
-  0x3b, 0xc8, 0x1d, 0x29, 0x67, 0x37, 0x47, 0xbc, 0xe7, 0x41, 0x2b, 0x1b,
-  0xe9, 0xae, 0x10, 0x44, 0xf4, 0x07, 0xc2, 0x81, 0x06, 0x25, 0xaa, 0x2b,
-  0x1c, 0x40, 0xfd, 0xeb, 0xaa, 0x2c, 0x2b, 0x9f, 0x90, 0xf4, 0x36, 0x09,
-  0xfc, 0x68, 0xc3, 0x85, 0x13, 0xfd, 0x01, 0x30, 0xd6, 0x9f, 0x2a, 0xe8,
-  0x20, 0xc7, 0x5b, 0xe9, 0xda, 0x0b, 0xd6, 0xc8, 0xed, 0x27, 0x10, 0xdf,
-  0x13, 0xf9, 0xfe, 0x24, 0x3f, 0xf6, 0x07, 0x79, 0xd6, 0xa1, 0x1b, 0xbe,
-  0x0d, 0xaa, 0x14, 0xc3, 0x00, 0xb0, 0xd0, 0xd4, 0x0c, 0x46, 0x0b, 0xc7,
-  0x04, 0xff, 0x01, 0x8f, 0x4e, 0x3c, 0x57, 0xf9, 0xfa, 0xd2, 0xe2, 0xe8,
-  0xc2, 0x1b, 0x64, 0x47, 0x3f, 0xd6, 0x12, 0x20, 0xd1, 0x78, 0x2a, 0x64,
-  0x7c, 0x0d, 0xe2, 0xe3, 0x2a, 0xef, 0x17, 0xc7, 0xfa, 0x29, 0x4d, 0x0f,
-  0x9b, 0x03, 0xb5, 0xe7, 0x18, 0x51, 0x31, 0x09, 0x1c, 0x2d, 0x1d, 0xf2,
-  0x0e, 0xff, 0xf2, 0x1f, 0xc9, 0x33, 0xc4, 0xce, 0x12, 0xda, 0xdf, 0x1d,
-  0xd2, 0xe1, 0x03, 0xb8, 0xdd, 0xe1, 0xf6, 0xa1, 0xc1, 0x64, 0x90, 0x2c,
-  0x34, 0x13, 0x44, 0x02, 0xd1, 0x33, 0xd2, 0xa6, 0x35, 0x6b, 0xd5, 0xd7,
-  0xb9, 0xdc, 0x43, 0x64, 0x5b, 0x5d, 0x01, 0xc9, 0xef, 0x29, 0xcf, 0x35,
-  0xc1, 0x06, 0x0b, 0x43, 0x81, 0xb6, 0x42, 0x13, 0xf9, 0x47, 0xbc, 0x8f,
-  0x0e, 0xde, 0xb9, 0x71, 0xa9, 0x82, 0x41, 0xf6, 0xda, 0x24, 0xd2, 0x0d,
-  0x33, 0xe8, 0x79, 0x2b, 0x4b, 0x0e, 0x85, 0xd8, 0xf9, 0x5c, 0x20, 0x08,
-  0x5c, 0xed, 0xc6, 0xb0, 0x0d, 0x36, 0x28, 0x41, 0xd0, 0xc4, 0x58, 0xcd,
-  0x89, 0x99, 0xf3, 0x04, 0xd8, 0xef, 0x00, 0x1a, 0xcf, 0x81, 0x14, 0xd1,
-  0x16, 0x14, 0x2a, 0x14, 0xfe, 0xde, 0x1c, 0x03, 0xd8, 0xf1, 0xf8, 0xcc,
-  0xff, 0x10, 0x27, 0xf1, 0xbe, 0x02, 0xd7, 0xf7, 0xda, 0xe2, 0xd9, 0xb4,
-  0x56, 0xfb, 0xda, 0xc4, 0xce, 0xfe, 0x2a, 0x27, 0x25, 0x25, 0xfa, 0xe7,
-  0x0f, 0x1f, 0x0a, 0xd2, 0xde, 0x25, 0xfe, 0xf9, 0xcf, 0x1c, 0xf4, 0xe8,
-  0x31, 0x1b, 0x1b, 0xe4, 0x2f, 0xde, 0x37, 0x3c, 0xdc, 0xc6, 0x46, 0x37,
-  0x12, 0x54, 0x04, 0x18, 0x05, 0x5f, 0x11, 0x0d, 0xdb, 0x28, 0x22, 0x10,
-  0x96, 0x05, 0xe1, 0xe7, 0xe2, 0x14, 0x06, 0xe3, 0xca, 0xf0, 0xe6, 0xb7,
-  0xd8, 0xe0, 0xd4, 0x0e, 0xe6, 0x16, 0xfb, 0xf1, 0x02, 0x0d, 0x3d, 0x27,
-  0xe8, 0xd3, 0x16, 0xce, 0x2c, 0xc7, 0x09, 0x57, 0x4c, 0xf0, 0xc0, 0x18,
-  0x54, 0x0e, 0x21, 0xcc, 0xef, 0xdc, 0x19, 0x25, 0x04, 0x11, 0x28, 0x1c,
-  0xfa, 0x5c, 0xd2, 0x3b, 0x35, 0x7b, 0x4b, 0x4a, 0x3b, 0x3c, 0xdd, 0xd6,
-  0xe1, 0xbb, 0xb6, 0xde, 0xf6, 0x0b, 0x1d, 0xe3, 0xfb, 0x19, 0xd7, 0x7f,
-  0xd8, 0xdb, 0xe8, 0x0e, 0x3f, 0x41, 0xe0, 0x56, 0xfb, 0x0b, 0x2d, 0x2d,
-  0x1f, 0x04, 0xf0, 0x26, 0xf4, 0x73, 0x30, 0x64, 0x19, 0xe9, 0x17, 0x57,
-  0x47, 0xb3, 0x4a, 0x79, 0x4a, 0x4d, 0x4a, 0x30, 0xce, 0xf6, 0x1b, 0xfb,
-  0x15, 0x1c, 0xf6, 0xb6, 0xb1, 0x29, 0xb4, 0xfd, 0xec, 0x3b, 0x03, 0x1b,
-  0x08, 0x16, 0xc7, 0xce, 0xf6, 0xfa, 0xe6, 0x13, 0x38, 0xe9, 0x16, 0x21,
-  0x1b, 0xe5, 0x41, 0x2b, 0xe3, 0x23, 0x26, 0xe4, 0x4b, 0xe8, 0x44, 0xd0,
-  0xff, 0xc9, 0xf6, 0xad, 0xba, 0xc6, 0xdf, 0x4a, 0x6d, 0x1e, 0x16, 0xb9,
-  0x39, 0x35, 0x28, 0xa6, 0xe0, 0x10, 0xb9, 0x89, 0x0b, 0xfb, 0xe6, 0x9f,
-  0xdb, 0xdd, 0x71, 0x3e, 0x7f, 0x19, 0x0d, 0xf0, 0x88, 0xd1, 0xbe, 0xde,
-  0x81, 0xe1, 0x58, 0xb5, 0x06, 0xe9, 0x2d, 0x8e, 0xf1, 0xad, 0x12, 0xb0,
-  0x5b, 0x00, 0xec, 0xe9, 0x07, 0x1c, 0x33, 0x06, 0x2a, 0x01, 0x22, 0x37,
-  0xea, 0x7a, 0x1e, 0xdd, 0x00, 0x36, 0x08, 0xb7, 0xd1, 0xd4, 0xea, 0xf5,
-  0x08, 0x5c, 0xcd, 0xe9, 0x48, 0x49, 0x0c, 0x42, 0x26, 0x02, 0x00, 0x2b,
-  0x04, 0x3d, 0xcd, 0xfb, 0x1d, 0xf8, 0x17, 0xd1, 0xfa, 0xd7, 0x2d, 0x1c,
-  0xdc, 0x17, 0xfe, 0x48, 0xfd, 0x23, 0x1f, 0x0a, 0xb1, 0x37, 0x17, 0xc0,
-  0xf6, 0xc5, 0xef, 0x05, 0xf0, 0xfc, 0xf7, 0x5a, 0x21, 0xb6, 0xc8, 0x2c,
-  0xe3, 0xe7, 0x0f, 0x15, 0xcf, 0x24, 0x37, 0xf1, 0x0b, 0x2c, 0xd3, 0xbe,
-  0xca, 0xde, 0x33, 0x0a, 0xfc, 0x1a, 0xec, 0xf5, 0x17, 0xb5, 0xf0, 0x54,
-  0x40, 0xc3, 0x24, 0xe1, 0xb5, 0x3f, 0x2f, 0xd6, 0x00, 0xdd, 0x24, 0xbd,
-  0x2f, 0x13, 0xfe, 0xf8, 0xe0, 0x48, 0xae, 0xc4, 0xee, 0xdf, 0x28, 0xb8,
-  0xb2, 0xfa, 0xcb, 0xdb, 0xec, 0xc9, 0x41, 0xe7, 0xe6, 0xba, 0x93, 0xf1,
-  0xdc, 0xf9, 0x22, 0x2d, 0xef, 0xf6, 0xc3, 0x2d, 0x66, 0xf8, 0xed, 0x2d,
-  0xef, 0x2c, 0x58, 0x1b, 0x29, 0xe2, 0xed, 0xfd, 0xe4, 0x73, 0x9b, 0x24,
-  0xdc, 0x59, 0x54, 0xea, 0x12, 0x81, 0xe3, 0xec, 0x5c, 0xf8, 0x1a, 0x0c,
-  0xf0, 0x0e, 0x0f, 0x0d, 0x48, 0x2e, 0xc7, 0xd6, 0x01, 0xf8, 0xf7, 0x20,
-  0x1c, 0xc7, 0xdb, 0xde, 0xd2, 0xa7, 0x1c, 0xeb, 0xc6, 0x0d, 0xfb, 0xb8,
-  0xdf, 0xe6, 0x02, 0xd7, 0xdf, 0xe9, 0xe5, 0xfc, 0xf8, 0x0b, 0xf1, 0x20,
-  0x2b, 0xe9, 0x58, 0xf2, 0x3b, 0x07, 0xf9, 0x02, 0xfc, 0x41, 0xec, 0x02,
-  0xde, 0x27, 0xf5, 0x09, 0xd7, 0x21, 0x25, 0x1d, 0x25, 0x9d, 0x27, 0x1f,
-  0x21, 0xd2, 0x15, 0x3f, 0xe9, 0xf1, 0xd6, 0x05, 0xd4, 0xd3, 0x1b, 0xf9,
-  0x38, 0xd6, 0xf9, 0x04, 0x4b, 0xda, 0x3e, 0x26, 0x25, 0x16, 0xcb, 0xd0,
-  0xc8, 0x04, 0xfd, 0xe1, 0xd4, 0xd2, 0x32, 0x7f, 0xff, 0x23, 0x27, 0xf7,
-  0xcb, 0xa9, 0xf4, 0xf1, 0x44, 0xff, 0x3f, 0xfc, 0x0e, 0x1d, 0x05, 0xef,
-  0x52, 0xc0, 0xe8, 0x06, 0xda, 0xfa, 0x31, 0xcc, 0x25, 0x14, 0x15, 0x00,
-  0x33, 0x12, 0xef, 0x2a, 0xd1, 0xf5, 0xe5, 0xce, 0xe6, 0xce, 0x27, 0xd4,
-  0x52, 0x41, 0x22, 0x43, 0xbd, 0x35, 0x09, 0x0f, 0xe9, 0xec, 0x1b, 0xe5,
-  0xb9, 0xd2, 0x40, 0x0b, 0xef, 0xdf, 0x09, 0xf5, 0x16, 0xc1, 0xf5, 0xf3,
-  0xd2, 0xe6, 0x57, 0x1e, 0xac, 0x2a, 0x12, 0xea, 0xe3, 0xee, 0x32, 0xe2,
-  0x24, 0xea, 0xe5, 0xfc, 0x1c, 0x04, 0x1e, 0x4e, 0xeb, 0x3e, 0x20, 0x2a,
-  0x0e, 0x3f, 0xe2, 0x3b, 0xe0, 0xd9, 0x9f, 0x38, 0x28, 0xf1, 0xdf, 0x1e,
-  0xd1, 0xee, 0xd6, 0xd4, 0x33, 0xba, 0xea, 0x20, 0xf9, 0x23, 0x2e, 0xf7,
-  0x44, 0xee, 0x9a, 0x0f, 0xf1, 0xfc, 0xb5, 0xb3, 0xe4, 0x18, 0xba, 0x91,
-  0xa6, 0x0d, 0xb3, 0xf3, 0x30, 0x0c, 0xcd, 0x23, 0x9a, 0xad, 0x1d, 0xfd,
-  0x07, 0x22, 0xe7, 0x2b, 0xff, 0x56, 0x37, 0xa9, 0x0b, 0x7d, 0x0e, 0xc9,
-  0xde, 0xe3, 0x2f, 0x19, 0xf7, 0xfc, 0x37, 0x5f, 0x1e, 0x6c, 0xa4, 0x4d,
-  0x88, 0xe0, 0xcf, 0x1c, 0x3e, 0x1e, 0xe9, 0x35, 0x8a, 0x56, 0x08, 0xc6,
-  0xac, 0xf3, 0x52, 0xf7, 0x81, 0x24, 0x29, 0xe1, 0xb8, 0x12, 0x5f, 0xbb,
-  0x3e, 0x03, 0xf8, 0xf4, 0x3b, 0x31, 0xfa, 0xfa, 0xb4, 0xff, 0xc6, 0xfc,
-  0xed, 0xef, 0x48, 0xe7, 0xd5, 0x1e, 0x91, 0xd6, 0x43, 0xd0, 0xc6, 0x3b,
-  0x08, 0x3a, 0xce, 0x10, 0x01, 0x22, 0x18, 0x15, 0x21, 0x2d, 0x52, 0x1b,
-  0xd1, 0xfa, 0x02, 0x01, 0xbd, 0x96, 0x38, 0x07, 0x25, 0xde, 0x1d, 0xc6,
-  0x1f, 0xe3, 0xd7, 0x38, 0xf9, 0xfe, 0x0e, 0xcf, 0x09, 0x35, 0x51, 0x3e,
-  0x71, 0xeb, 0x8e, 0xec, 0xcb, 0x2a, 0xcb, 0xcd, 0xdc, 0xf8, 0x06, 0x7f,
-  0xda, 0xeb, 0x21, 0xf0, 0x97, 0xf8, 0xb3, 0x9c, 0xd7, 0xfb, 0x74, 0x1d,
-  0xec, 0xf5, 0xf3, 0x23, 0xe0, 0xd1, 0xee, 0x0d, 0xdb, 0xef, 0xe5, 0x14,
-  0xfb, 0x0f, 0x5a, 0x3a, 0x0d, 0xeb, 0x18, 0x49, 0x9f, 0x02, 0xd3, 0x24,
-  0x47, 0xe9, 0x34, 0xef, 0xfb, 0xfb, 0x28, 0x41, 0xbc, 0x65, 0xf2, 0x00,
-  0xe9, 0x00, 0xf2, 0xa3, 0xb2, 0xdc, 0x13, 0x04, 0xc3, 0x29, 0xd3, 0x37,
-  0xe4, 0xac, 0xc6, 0x5a, 0x0b, 0x27, 0x35, 0x06, 0x86, 0x5b, 0xee, 0xb1,
-  0x50, 0x03, 0x13, 0xda, 0xe2, 0x32, 0x02, 0x1b, 0xbd, 0xda, 0x21, 0x15,
-  0xc8, 0xf5, 0x4f, 0xea, 0x4a, 0x4b, 0xc0, 0x0a, 0x24, 0xe9, 0xee, 0x3f,
-  0xb8, 0x11, 0x15, 0xc3, 0x40, 0xfb, 0x06, 0x04, 0x35, 0x1b, 0xe1, 0x15,
-  0xcf, 0x4d, 0xf7, 0xfb, 0x4a, 0xd0, 0x7f, 0x1a, 0xc6, 0x12, 0x48, 0x28,
-  0xc5, 0xf1, 0x23, 0x0a, 0x3e, 0x11, 0xf3, 0xbb, 0xc9, 0xbd, 0xe2, 0x77,
-  0xa0, 0xff, 0xd9, 0xe8, 0xc7, 0x5a, 0x34, 0xc3, 0x6b, 0x55, 0x49, 0x2b,
-  0x5e, 0x33, 0xea, 0xf8, 0x0b, 0xf6, 0x09, 0x17, 0xbd, 0x13, 0xfd, 0x0b,
-  0x05, 0x3a, 0xd9, 0x14, 0xd9, 0x3f, 0x28, 0x1c, 0x1e, 0x34, 0x11, 0xda,
-  0xd5, 0x17, 0x22, 0xff, 0x36, 0xf0, 0x29, 0xd6, 0x5b, 0x3c, 0xd8, 0x18,
-  0xcb, 0x01, 0x14, 0x48, 0xf2, 0xf2, 0xcf, 0xdb, 0x23, 0xfa, 0xdd, 0xa9,
-  0x2e, 0xc9, 0xfd, 0x6b, 0xdd, 0xbf, 0xf7, 0x28, 0xc8, 0xf5, 0x02, 0xed,
-  0xf1, 0xca, 0xb9, 0xbb, 0xcd, 0x1c, 0xbe, 0xad, 0x18, 0xcc, 0x05, 0x32,
-  0xea, 0xef, 0x20, 0x11, 0x36, 0x42, 0x37, 0xa1, 0xd1, 0x2b, 0xf6, 0x32,
-  0xf1, 0x2e, 0xef, 0x18, 0x19, 0x22, 0x5c, 0x2c, 0xd3, 0xa4, 0xe0, 0xff,
-  0xb1, 0x00, 0xe2, 0xcd, 0x4f, 0x1f, 0xdd, 0x9f, 0x35, 0x4e, 0x1b, 0x0e,
-  0x26, 0xe2, 0x05, 0x29, 0x12, 0xfa, 0x4a, 0xb1, 0xb0, 0x28, 0xe9, 0x04,
-  0x03, 0x0c, 0xc8, 0x1b, 0x1d, 0x07, 0xfe, 0xe9, 0xf3, 0xe5, 0x4b, 0xe9,
-  0x2b, 0x77, 0xff, 0x03, 0x46, 0xb8, 0xe0, 0x82, 0xe2, 0xc0, 0xfa, 0xef,
-  0xfb, 0x81, 0x85, 0xb1, 0xfa, 0xf5, 0x4d, 0xca, 0xfe, 0xc1, 0x27, 0x36,
-  0x2d, 0x07, 0x16, 0x28, 0x9f, 0xd2, 0x2a, 0x01, 0xfa, 0x2d, 0x39, 0x2f,
-  0x0d, 0xc0, 0x0c, 0x19, 0xcf, 0xa3, 0xe5, 0x12, 0xda, 0xcc, 0xed, 0x09,
-  0xf6, 0x03, 0xec, 0xf5, 0xfa, 0xc8, 0xfd, 0x10, 0x19, 0x04, 0x50, 0xf6,
-  0x5f, 0x3b, 0x14, 0x29, 0x03, 0xef, 0x18, 0xcd, 0x33, 0x03, 0xd9, 0x2d,
-  0xda, 0x01, 0x0b, 0x2b, 0xfa, 0x07, 0xb7, 0xd0, 0xba, 0xcd, 0x22, 0xd1,
-  0xd6, 0xdd, 0x3a, 0xe6, 0x1a, 0xee, 0x1d, 0xff, 0xa8, 0x10, 0xc4, 0xd4,
-  0x01, 0xd1, 0xf6, 0x13, 0x18, 0x39, 0xf3, 0x0a, 0xe7, 0xdf, 0xc3, 0x2b,
-  0x05, 0x46, 0xe7, 0xff, 0x12, 0x0a, 0x15, 0x1f, 0x3a, 0xec, 0xd3, 0x1d,
-  0x1f, 0xed, 0x0b, 0xe2, 0xde, 0xd8, 0xe8, 0x81, 0x20, 0x02, 0x3b, 0x10,
-  0x02, 0xf7, 0x0b, 0xc2, 0xee, 0xc5, 0xf4, 0x1c, 0xf7, 0xbd, 0xfb, 0xc3,
-  0x01, 0x01, 0x1e, 0x16, 0x35, 0xe4, 0xe7, 0xf2, 0x0d, 0xfc, 0xed, 0x43,
-  0xc3, 0xe9, 0xff, 0x30, 0x03, 0xf6, 0x11, 0xf8, 0x00, 0x0f, 0x1b, 0xe7,
-  0xdb, 0xf0, 0x21, 0x30, 0x14, 0x26, 0x25, 0xed, 0xbe, 0x1f, 0xcd, 0x2d,
-  0xce, 0x1c, 0x2c, 0x2b, 0xfb, 0xe7, 0x0e, 0xe8, 0x0b, 0x0d, 0x0f, 0x17,
-  0x18, 0xea, 0x1e, 0x06, 0xd6, 0x0d, 0xd9, 0xee, 0xf6, 0x0d, 0x07, 0x20,
-  0x54, 0x2f, 0x27, 0x1f, 0xd4, 0x13, 0x25, 0x18, 0x4e, 0x09, 0x09, 0xf0,
-  0xf5, 0x27, 0xfc, 0x00, 0x6b, 0x47, 0x04, 0x63, 0x22, 0xa7, 0xf7, 0x41,
-  0x9e, 0x16, 0x08, 0x81, 0x25, 0x1d, 0x46, 0xcb, 0x00, 0xd3, 0xac, 0x11,
-  0x07, 0x1c, 0x01, 0x56, 0xfb, 0x35, 0x4f, 0xb4, 0x41, 0x50, 0xeb, 0x20,
-  0xf3, 0x24, 0xe0, 0x15, 0x1a, 0x0c, 0x1e, 0x30, 0x28, 0xf0, 0x7c, 0x67,
-  0x17, 0x05, 0x0b, 0x28, 0xda, 0x4a, 0x47, 0xfc, 0xfb, 0x00, 0x0d, 0xdc,
-  0xe2, 0x04, 0x4e, 0xdb, 0xc9, 0xea, 0x07, 0x97, 0x10, 0x22, 0x28, 0x46,
-  0x3c, 0x2c, 0xaf, 0x26, 0x2e, 0xef, 0xbd, 0x20, 0x39, 0xe4, 0x9d, 0xc5,
-  0xd2, 0xc2, 0xbf, 0x1b, 0xfa, 0xc2, 0x23, 0x33, 0x73, 0x63, 0x1a, 0xb1,
-  0x53, 0xe1, 0x81, 0x8a, 0x15, 0x25, 0xb1, 0xf4, 0x31, 0xe9, 0x0b, 0x2a,
-  0x10, 0xe6, 0x43, 0xdb, 0x0c, 0x37, 0xef, 0x26, 0xc9, 0xd6, 0xf8, 0xee,
-  0x1f, 0x50, 0xe7, 0xef, 0x2f, 0xe5, 0xcb, 0xd1, 0xee, 0xaf, 0xd5, 0x09,
-  0x9a, 0xd6, 0xbd, 0x8b, 0xc6, 0xd8, 0xf9, 0x93, 0x56, 0x1b, 0xf4, 0xff,
-  0xb1, 0xe6, 0xb1, 0xf8, 0xf0, 0xfe, 0x1c, 0xff, 0x04, 0xf7, 0xe2, 0x14,
-  0x4a, 0xc7, 0xfc, 0xc0, 0xdf, 0xe4, 0xb5, 0xd9, 0x14, 0xc6, 0xfe, 0x8c,
-  0xf5, 0x22, 0x04, 0x01, 0x20, 0xf3, 0x0d, 0x99, 0x11, 0x95, 0xee, 0x01,
-  0x0d, 0x81, 0xd2, 0xaa, 0x13, 0xb0, 0x07, 0x37, 0x2b, 0xfc, 0xb8, 0x3e,
-  0xcc, 0x29, 0x2a, 0x2d, 0xa5, 0xc5, 0x0c, 0xa1, 0xe2, 0xd3, 0x2c, 0xdb,
-  0xd1, 0xe7, 0x45, 0xfa, 0xd6, 0xe7, 0x14, 0x1b, 0xcf, 0x63, 0x3c, 0xa2,
-  0x1b, 0xe1, 0x02, 0xf1, 0x28, 0xe3, 0x0e, 0xe4, 0x05, 0xc6, 0x28, 0x08,
-  0x26, 0x17, 0x0f, 0x2b, 0x03, 0x2c, 0x9e, 0x23, 0xc6, 0x25, 0xdf, 0xee,
-  0x47, 0xc7, 0x23, 0xeb, 0x46, 0x0c, 0x10, 0xf6, 0xc6, 0xf9, 0x00, 0x23,
-  0xd2, 0x1a, 0x1c, 0x15, 0xcd, 0xc9, 0xf1, 0x5a, 0xbe, 0x41, 0x00, 0x07,
-  0x34, 0x10, 0xf1, 0xa7, 0x21, 0x11, 0x04, 0x3d, 0xf3, 0xf5, 0x58, 0x3e,
-  0xe7, 0xf3, 0x16, 0x24, 0x13, 0xdd, 0xf1, 0x0e, 0x0a, 0xc4, 0x3c, 0x14,
-  0xf8, 0x03, 0xca, 0xa0, 0x2b, 0xb0, 0x35, 0xe7, 0xc3, 0xe7, 0x11, 0xdb,
-  0x0b, 0xe4, 0x2a, 0xfb, 0xd1, 0xe9, 0xfe, 0x52, 0xbc, 0xf9, 0xb8, 0x9f,
-  0x4f, 0x08, 0x3d, 0x0b, 0x67, 0x46, 0x1c, 0x1f, 0xeb, 0x1f, 0x7e, 0xab,
-  0x1a, 0x27, 0x34, 0xc2, 0x1f, 0x29, 0xe8, 0x96, 0xb9, 0x20, 0x4a, 0xef,
-  0xde, 0xd4, 0xcd, 0x24, 0x37, 0xe1, 0x2f, 0x00, 0xef, 0xf1, 0x19, 0xae,
-  0x14, 0x17, 0xf0, 0x16, 0x12, 0x9c, 0x6b, 0xe3, 0x47, 0x72, 0xf1, 0x30,
-  0x09, 0x0a, 0x29, 0xeb, 0xb9, 0xef, 0x81, 0x10, 0xc9, 0x2f, 0x0b, 0x34,
-  0x45, 0xf2, 0x07, 0x20, 0x43, 0x37, 0xc1, 0x8f, 0x4d, 0xda, 0xf5, 0x4f,
-  0xff, 0x1e, 0xb7, 0xe0, 0x40, 0x03, 0xe7, 0xbb, 0x1c, 0x0a, 0xf8, 0x27,
-  0x4f, 0xd7, 0x7b, 0x82, 0x72, 0x02, 0xdd, 0x58, 0xae, 0x30, 0x0a, 0xdf,
-  0x36, 0x28, 0x1e, 0x20, 0x13, 0x07, 0x4b, 0xbb, 0xe4, 0x91, 0xc6, 0xf7,
-  0x81, 0x93, 0xb1, 0x84, 0x87, 0x84, 0xdd, 0xcc, 0xe0, 0x46, 0xc8, 0xb1,
-  0x6a, 0x2d, 0xf2, 0xb0, 0x4c, 0x08, 0xdc, 0x17, 0xa0, 0x91, 0x16, 0x7a,
-  0x68, 0x33, 0x6d, 0x46, 0xd6, 0x08, 0x2e, 0x23, 0x86, 0xe1, 0x5d, 0xc2,
-  0x66, 0x52, 0xf9, 0x62, 0x36, 0x09, 0x10, 0x89, 0xed, 0x42, 0xb0, 0xc5,
-  0x2a, 0xec, 0xd0, 0x6b, 0xae, 0x82, 0xa8, 0xa4, 0x9e, 0xba, 0x01, 0x0f,
-  0x02, 0x4d, 0xeb, 0xcc, 0xdf, 0x00, 0x36, 0xce, 0xcc, 0xf9, 0x25, 0x0b,
-  0xf6, 0xfa, 0x59, 0x4d, 0x3d, 0x47, 0x3b, 0x00, 0x42, 0x35, 0x16, 0x14,
-  0x04, 0x2d, 0xbd, 0xed, 0x16, 0x0b, 0x57, 0x19, 0x27, 0x11, 0xf7, 0xea,
-  0xf0, 0xf0, 0xf9, 0xef, 0x1d, 0x07, 0x3c, 0xd6, 0x0c, 0xf3, 0xc0, 0x20,
-  0x4b, 0xb9, 0x33, 0x0e, 0xf9, 0xe0, 0x44, 0x0d, 0x39, 0xe9, 0xdc, 0x04,
-  0xe8, 0xf3, 0x0f, 0xf2, 0x42, 0xdb, 0xb8, 0xf7, 0xff, 0xec, 0x8e, 0x81,
-  0xeb, 0x23, 0xc7, 0x09, 0x4d, 0x18, 0xf0, 0x0e, 0x0f, 0x17, 0xd3, 0xfe,
-  0xca, 0x25, 0x07, 0xdc, 0x27, 0xde, 0x07, 0xfb, 0x29, 0xff, 0x52, 0x26,
-  0xfc, 0x95, 0x64, 0x04, 0x76, 0x2a, 0xc8, 0x42, 0xe5, 0x17, 0x0f, 0xf9,
-  0xe1, 0xe1, 0xea, 0x14, 0xec, 0x10, 0xa5, 0x12, 0x3a, 0xe4, 0x21, 0xef,
-  0xcb, 0xd9, 0xb4, 0xe4, 0x16, 0xf3, 0xe8, 0xe0, 0xf7, 0x18, 0x0a, 0xe9,
-  0x1f, 0x4e, 0x5c, 0xed, 0xde, 0x18, 0xfd, 0x1a, 0x06, 0x33, 0xd6, 0xf7,
-  0xeb, 0x20, 0x1b, 0xfe, 0xf6, 0x41, 0x15, 0x16, 0xf8, 0xce, 0xfa, 0x28,
-  0xf1, 0xd6, 0x1e, 0x25, 0xef, 0x16, 0x01, 0xd0, 0x02, 0x19, 0x41, 0xf6,
-  0x14, 0x0b, 0x10, 0x1d, 0xe6, 0x01, 0x36, 0xd3, 0x1a, 0x1b, 0x26, 0xe4,
-  0xd5, 0xdd, 0xc1, 0x08, 0xbd, 0xbf, 0xd5, 0x38, 0xe0, 0x24, 0xf6, 0xf4,
-  0x7f, 0x37, 0x13, 0xff, 0xfa, 0x22, 0x01, 0x1e, 0xf9, 0xf6, 0xfe, 0x23,
-  0xef, 0x2c, 0x0f, 0xf5, 0xfc, 0x3d, 0xe4, 0xf0, 0x07, 0x30, 0x2a, 0xf3,
-  0x26, 0xfd, 0xe6, 0xd7, 0xf0, 0xc9, 0x0d, 0x16, 0xca, 0xf3, 0x1c, 0xd5,
-  0x3b, 0x17, 0xf8, 0x3b, 0xc3, 0xe2, 0xf2, 0x09, 0xd9, 0xce, 0xd0, 0xe0,
-  0xfd, 0x39, 0x26, 0xf0, 0x2e, 0xdb, 0x40, 0x28, 0xdb, 0xf2, 0xd0, 0x2b,
-  0x22, 0xe9, 0x65, 0xef, 0x17, 0xe9, 0xed, 0xb3, 0xd1, 0x23, 0xf3, 0xe6,
-  0xf4, 0x25, 0xe2, 0x06, 0x0a, 0xd5, 0x0a, 0x17, 0x37, 0xe2, 0x54, 0xd1,
-  0xa8, 0x03, 0x16, 0x46, 0x19, 0x23, 0xad, 0x08, 0x1a, 0x26, 0x0f, 0xfe,
-  0x29, 0xf8, 0xb5, 0x3e, 0xac, 0x2e, 0xb5, 0xd4, 0x12, 0x31, 0xda, 0xf5,
-  0xd2, 0x11, 0x11, 0x3c, 0xdb, 0xff, 0x09, 0x3c, 0x21, 0xf9, 0x33, 0xcb,
-  0x1e, 0x07, 0x15, 0xf7, 0xb3, 0x0c, 0x0b, 0x7c, 0xf4, 0x06, 0x28, 0x1b,
-  0x0d, 0xef, 0xe6, 0x1e, 0x3f, 0x51, 0xea, 0xf3, 0x50, 0xf7, 0xd8, 0x0d,
-  0x5f, 0xc5, 0xd0, 0x64, 0xb6, 0x63, 0xaa, 0x10, 0x52, 0xe8, 0x92, 0xbe,
-  0x50, 0x14, 0x2a, 0x03, 0x08, 0xdd, 0x4d, 0xfa, 0x7f, 0xe9, 0x01, 0x98,
-  0x18, 0x08, 0xdc, 0xb6, 0xcc, 0xf3, 0x63, 0x1a, 0xfc, 0xe9, 0xe8, 0xc6,
-  0xfd, 0x1c, 0xf3, 0xdd, 0x1d, 0xa1, 0xe0, 0x0a, 0x17, 0x9a, 0xd3, 0xfd,
-  0x1c, 0x00, 0xe1, 0xc9, 0xf5, 0x39, 0x07, 0xd9, 0x02, 0x58, 0xa3, 0x32,
-  0xd1, 0x62, 0xe7, 0xe2, 0xb5, 0x22, 0xf1, 0xff, 0xbb, 0xff, 0x41, 0xbe,
-  0xe3, 0x56, 0xfd, 0x1a, 0x30, 0xf7, 0x06, 0x37, 0x4a, 0x0a, 0x30, 0xd2,
-  0xfd, 0x20, 0xdb, 0xd7, 0xa8, 0x72, 0x59, 0x0c, 0xfa, 0xba, 0xdf, 0x5b,
-  0xfa, 0x4e, 0x10, 0xd8, 0x5b, 0xca, 0x14, 0xc1, 0x12, 0x50, 0xe5, 0x31,
-  0x4f, 0xf4, 0xf8, 0xd2, 0x30, 0x29, 0xef, 0x95, 0x07, 0xeb, 0xb7, 0xe3,
-  0xd7, 0xe6, 0x12, 0x16, 0xa7, 0xdc, 0x51, 0x50, 0x27, 0x12, 0x1a, 0xab,
-  0x2e, 0xf9, 0x81, 0xd1, 0x88, 0x49, 0xee, 0xcb, 0xc0, 0xa6, 0x05, 0x10,
-  0x36, 0xdc, 0xe3, 0xab, 0xdb, 0x31, 0x79, 0x0f, 0xc6, 0x15, 0xfa, 0xc6,
-  0xf1, 0x2b, 0xd1, 0xf4, 0x1c, 0x12, 0x1b, 0xfe, 0xee, 0x39, 0x0b, 0x97,
-  0x34, 0x14, 0x26, 0x07, 0x35, 0x2b, 0x0c, 0x16, 0x2b, 0xfd, 0x0e, 0xe1,
-  0xb0, 0xcd, 0x73, 0xbd, 0xa2, 0xbc, 0xd4, 0x39, 0xba, 0xed, 0xc2, 0x85,
-  0x90, 0xd8, 0xe2, 0x6e, 0xd6, 0xf3, 0x37, 0x0c, 0x19, 0x3e, 0x25, 0x46,
-  0xc6, 0xdc, 0xf0, 0xc9, 0x2f, 0xfb, 0xf6, 0xd9, 0x18, 0xf1, 0xe6, 0x04,
-  0xc4, 0xf9, 0x17, 0x27, 0x26, 0xe2, 0x05, 0x18, 0xf0, 0x29, 0x54, 0x99,
-  0xc2, 0xbf, 0xf0, 0x2a, 0xb6, 0x02, 0x5f, 0x6c, 0x15, 0xcb, 0x04, 0x03,
-  0xc3, 0xc2, 0xee, 0x04, 0x01, 0x4e, 0xcf, 0xf7, 0xcd, 0xb9, 0xa0, 0x1b,
-  0xef, 0x10, 0xb6, 0x13, 0x24, 0xe6, 0xdd, 0x0f, 0x0a, 0x78, 0xf6, 0xe2,
-  0xc6, 0x20, 0xbc, 0x49, 0x32, 0xa2, 0x36, 0xf0, 0x00, 0x2f, 0x50, 0xc4,
-  0xf0, 0xcc, 0xf6, 0xf0, 0xe5, 0x30, 0x5e, 0x1d, 0x01, 0x13, 0xb5, 0xfb,
-  0xad, 0x30, 0xc2, 0xce, 0x28, 0x1c, 0xf2, 0x08, 0xe8, 0x51, 0x01, 0xf6,
-  0x45, 0x0b, 0xfe, 0xc4, 0xdc, 0xb6, 0x52, 0xd3, 0x32, 0xdc, 0x0f, 0x81,
-  0x2f, 0xe2, 0xdc, 0xea, 0x2c, 0x03, 0x0a, 0xc8, 0x17, 0xfd, 0xd4, 0x09,
-  0x2d, 0x71, 0xbf, 0xf2, 0x18, 0x3a, 0x0f, 0xeb, 0xc1, 0x69, 0x2d, 0xb4,
-  0xd4, 0xd1, 0x3c, 0xc3, 0xd7, 0x09, 0x3e, 0xe1, 0x1d, 0x30, 0x2e, 0x39,
-  0x0e, 0xdf, 0x0d, 0x4f, 0x15, 0xeb, 0x55, 0xce, 0xf4, 0x0e, 0x4b, 0x25,
-  0x1e, 0xf8, 0x17, 0x52, 0x50, 0x4b, 0x00, 0xf2, 0xc9, 0x50, 0xf6, 0x34,
-  0xcb, 0x83, 0x04, 0xf0, 0xed, 0xeb, 0xec, 0x1f, 0x01, 0x91, 0x2d, 0x05,
-  0xe6, 0x01, 0x7d, 0xf1, 0xee, 0x29, 0x37, 0x37, 0xbe, 0xff, 0x01, 0xf3,
-  0xe8, 0xf5, 0x0f, 0xfd, 0x5e, 0x1a, 0x37, 0xee, 0x50, 0x1c, 0xa5, 0x21,
-  0x09, 0xf6, 0xed, 0x26, 0xbf, 0x09, 0xfa, 0x14, 0x7f, 0x33, 0xe7, 0x2c,
-  0x4c, 0x06, 0xc9, 0xfa, 0xce, 0xe1, 0xf1, 0x19, 0x03, 0xa4, 0xf8, 0xe9,
-  0x7c, 0xf4, 0x1b, 0xab, 0xe5, 0x05, 0x30, 0x9d, 0xef, 0x38, 0xfc, 0x3d,
-  0xbd, 0xc1, 0x07, 0xb4, 0xde, 0xe0, 0xdb, 0xfb, 0xee, 0x38, 0x23, 0x1e,
-  0x0f, 0x16, 0xfd, 0x0e, 0x29, 0x18, 0x13, 0xe6, 0x03, 0x12, 0x40, 0x16,
-  0x08, 0x2f, 0x21, 0x0c, 0xef, 0x4d, 0xde, 0x13, 0xe8, 0x2b, 0xe8, 0x3c,
-  0xa5, 0xfe, 0xfd, 0x1b, 0x1d, 0xbf, 0xed, 0xe6, 0xec, 0x33, 0x03, 0xfa,
-  0x97, 0x0d, 0xe1, 0xc9, 0xf7, 0x4e, 0xc6, 0x34, 0x0c, 0x28, 0x10, 0xd3,
-  0x22, 0x20, 0x26, 0x37, 0xdc, 0xd6, 0x02, 0x1f, 0x01, 0x19, 0xb3, 0x4d,
-  0xd5, 0xd8, 0x08, 0x22, 0x21, 0xe7, 0xcd, 0xf1, 0x29, 0x54, 0x41, 0xdd,
-  0xdf, 0xc8, 0xea, 0xe3, 0xf3, 0xfd, 0xe3, 0x7f, 0x00, 0x0f, 0xf7, 0xd3,
-  0xd7, 0x16, 0x2e, 0xfb, 0xcd, 0xab, 0x17, 0xfc, 0xd8, 0xf4, 0x06, 0xda,
-  0x43, 0xff, 0x15, 0xd2, 0xe8, 0xe6, 0xec, 0xda, 0xed, 0xd8, 0xe4, 0xfe,
-  0x2a, 0xed, 0x1f, 0xf8, 0xeb, 0xf0, 0x15, 0x05, 0x59, 0xff, 0xd1, 0xd0,
-  0x1f, 0x1c, 0xc1, 0x22, 0xea, 0xe9, 0x21, 0xe1, 0xd3, 0x14, 0x2a, 0xf2,
-  0xe9, 0xeb, 0xc1, 0x26, 0x29, 0xb6, 0x0a, 0x02, 0x38, 0xca, 0xd1, 0x34,
-  0xf0, 0x06, 0xf5, 0x14, 0xe8, 0x15, 0xe6, 0xd1, 0xe4, 0x26, 0xf6, 0x81,
-  0xec, 0x46, 0xe0, 0xed, 0x14, 0x22, 0xec, 0x16, 0x02, 0x10, 0x24, 0x09,
-  0xfc, 0xfa, 0x16, 0xea, 0x04, 0x46, 0x20, 0x2a, 0xcf, 0xe7, 0xeb, 0x39,
-  0xfd, 0x35, 0x5c, 0x0f, 0xbc, 0xb8, 0xfe, 0xff, 0xec, 0x17, 0x3f, 0xff,
-  0x24, 0xc9, 0x23, 0x2c, 0xde, 0xd4, 0xc9, 0x2b, 0x15, 0xfc, 0x0e, 0xbe,
-  0xf4, 0x22, 0xf2, 0xf7, 0xbf, 0x03, 0xf2, 0xdd, 0x0b, 0x09, 0x05, 0xcf,
-  0xf6, 0x2b, 0xf8, 0xec, 0xdb, 0xf5, 0xc1, 0xf6, 0x0d, 0x12, 0x0f, 0xf5,
-  0x19, 0x29, 0x0b, 0xcc, 0xec, 0x24, 0x1d, 0xfd, 0xd6, 0x0f, 0xe1, 0xba,
-  0x2e, 0xdf, 0x1e, 0x27, 0xd1, 0xfc, 0x27, 0xef, 0xc7, 0xf4, 0xde, 0x0f,
-  0xbe, 0x00, 0x28, 0x44, 0xe3, 0x29, 0xd2, 0xe1, 0x0a, 0xe9, 0xc0, 0xe9,
-  0xe1, 0x36, 0x09, 0xd9, 0xe1, 0xfe, 0x11, 0x08, 0xd3, 0xcd, 0xee, 0x7f,
-  0x4d, 0xea, 0x39, 0xec, 0x28, 0xff, 0x27, 0xfc, 0xc7, 0x03, 0x02, 0x1c,
-  0x37, 0x4d, 0x10, 0xe3, 0xff, 0xd2, 0xe7, 0x13, 0xe9, 0xc2, 0xd4, 0xd6,
-  0xa1, 0x06, 0x24, 0xff, 0x09, 0xf7, 0x00, 0xf7, 0xd0, 0xde, 0xea, 0xc8,
-  0xe6, 0xf0, 0x11, 0xc4, 0x2c, 0x20, 0xe9, 0xe6, 0xfc, 0x5b, 0xf0, 0x1e,
-  0xcb, 0xf3, 0x04, 0x0a, 0x4e, 0xfc, 0x07, 0x6a, 0x4a, 0xf3, 0xfc, 0xb4,
-  0xf7, 0x26, 0x0b, 0xf4, 0xe6, 0xff, 0xfd, 0x4e, 0xb8, 0x16, 0xfd, 0xee,
-  0x23, 0xf8, 0xd0, 0xfd, 0x16, 0xd6, 0xe3, 0x36, 0xf6, 0xbd, 0xee, 0xdc,
-  0x03, 0xd0, 0x02, 0xf0, 0x29, 0xdd, 0xfb, 0xdd, 0x3c, 0xd1, 0xdc, 0xfd,
-  0xab, 0xd1, 0x4f, 0xee, 0x2c, 0x4b, 0x42, 0xe9, 0x41, 0x11, 0xe3, 0x0d,
-  0xe9, 0x19, 0x0e, 0x2a, 0x1b, 0x6d, 0x32, 0xe7, 0xfd, 0xc2, 0xf5, 0xcf,
-  0x0b, 0xf2, 0xa7, 0x23, 0x11, 0x19, 0x81, 0x01, 0xf2, 0xe5, 0xa5, 0xab,
-  0xae, 0x2e, 0xb1, 0x05, 0xe7, 0x34, 0xcc, 0x1b, 0x0a, 0x4c, 0xd3, 0xe7,
-  0xf5, 0xfb, 0xd4, 0x2b, 0xf3, 0xd5, 0xea, 0xba, 0xed, 0xd1, 0xbc, 0xec,
-  0x2e, 0xaf, 0xb9, 0x6e, 0x05, 0x10, 0x39, 0x05, 0xae, 0x1e, 0xf4, 0x1a,
-  0x17, 0xc1, 0xa0, 0x1a, 0xdb, 0xff, 0x02, 0x0d, 0xab, 0x22, 0x58, 0xbb,
-  0xcc, 0xfd, 0xec, 0xf6, 0x0d, 0x15, 0xbf, 0x19, 0xc1, 0x0c, 0x1b, 0x28,
-  0xf1, 0x00, 0x9f, 0x36, 0xe0, 0x07, 0x1b, 0xe0, 0x94, 0x00, 0xe0, 0xd4,
-  0x44, 0x2d, 0x43, 0xd9, 0x22, 0x63, 0xc1, 0xda, 0x3a, 0x3b, 0xc3, 0xce,
-  0x34, 0xf1, 0xd0, 0xf3, 0x01, 0x14, 0x30, 0x0a, 0xec, 0xba, 0x4f, 0xd4,
-  0xcc, 0xef, 0xef, 0x0c, 0xd8, 0xe9, 0xdd, 0x0f, 0x01, 0x23, 0x06, 0xdb,
-  0xf9, 0xfe, 0xe3, 0xd6, 0xb3, 0xcd, 0xb2, 0x3c, 0xe5, 0x3c, 0x2e, 0xf3,
-  0x0e, 0x9d, 0xbc, 0xca, 0x07, 0x4b, 0xee, 0xe3, 0x2a, 0x38, 0x0b, 0x13,
-  0xbc, 0x2a, 0x11, 0xe0, 0xe4, 0xe6, 0xa1, 0x21, 0x74, 0xf5, 0xf1, 0xb9,
-  0x15, 0x14, 0x4b, 0x5b, 0xe6, 0x37, 0xc9, 0xfe, 0xd4, 0x67, 0xec, 0x5b,
-  0xf4, 0xe8, 0xf9, 0x32, 0x07, 0x01, 0x0f, 0x45, 0x10, 0x21, 0x68, 0xd7,
-  0x42, 0xd0, 0xd5, 0xdf, 0x76, 0xe1, 0xe7, 0x0e, 0xa5, 0x12, 0xf3, 0xe8,
-  0x0f, 0x7f, 0xf0, 0x20, 0xd5, 0xad, 0x40, 0x1c, 0xc1, 0x4f, 0x0a, 0x00,
-  0xd2, 0x0b, 0x37, 0xdd, 0xe1, 0xbf, 0x50, 0x29, 0x1b, 0xb9, 0x03, 0xed,
-  0x4a, 0x69, 0x14, 0xf8, 0x0b, 0xe8, 0x0f, 0xee, 0x06, 0xe4, 0x1c, 0xf2,
-  0xd2, 0x38, 0xdd, 0x12, 0xcf, 0x01, 0x0f, 0xf3, 0x43, 0xb9, 0xc7, 0xc4,
-  0xd3, 0x3a, 0x42, 0x23, 0xda, 0x41, 0xf8, 0x1f, 0xf0, 0x3e, 0x58, 0xc3,
-  0x01, 0x02, 0x8c, 0xe9, 0x0a, 0x35, 0x47, 0xea, 0xf7, 0x12, 0xfd, 0xf3,
-  0xec, 0x0c, 0x41, 0x06, 0xe3, 0x11, 0x08, 0x16, 0xd1, 0xd5, 0x14, 0x44,
-  0xfb, 0x81, 0xef, 0x0d, 0xf3, 0x23, 0x0a, 0xc6, 0xef, 0x11, 0xf7, 0x2d,
-  0xeb, 0x01, 0x1a, 0x19, 0x21, 0x5d, 0x04, 0xd9, 0xa1, 0xcc, 0xf2, 0xee,
-  0xf1, 0xb7, 0x04, 0xfd, 0xef, 0x50, 0xd9, 0x14, 0x08, 0x23, 0x19, 0x11,
-  0x01, 0xf9, 0xde, 0xef, 0x03, 0xf5, 0xb4, 0x10, 0xf3, 0x40, 0x35, 0xef,
-  0xe1, 0x15, 0x19, 0x24, 0xec, 0xc5, 0x07, 0x1c, 0x30, 0xc7, 0x76, 0xdc,
-  0x31, 0xf8, 0xf7, 0x15, 0x22, 0xbc, 0x20, 0x50, 0xfa, 0x01, 0x07, 0x26,
-  0xe5, 0xe3, 0x06, 0xfb, 0x3c, 0x09, 0xe3, 0x38, 0x1a, 0xeb, 0xa6, 0xe3,
-  0x21, 0xb6, 0xe5, 0xeb, 0x3c, 0xfb, 0x01, 0xe0, 0xf4, 0x04, 0xbe, 0xe6,
-  0xdd, 0xd2, 0x2f, 0x3b, 0xbc, 0x5d, 0x0e, 0xe5, 0xfd, 0x01, 0x1a, 0xaa,
-  0x85, 0xf3, 0xf3, 0xe3, 0xa5, 0xef, 0xd7, 0x17, 0xf5, 0xb9, 0x12, 0xd4,
-  0xf7, 0x06, 0x48, 0x1c, 0xff, 0x41, 0xfb, 0xe7, 0x0b, 0xf6, 0xc3, 0xec,
-  0x0c, 0x08, 0xba, 0x23, 0x19, 0x58, 0xdc, 0xf0, 0xc8, 0x0f, 0xdb, 0x55,
-  0x60, 0x06, 0x2e, 0xbf, 0xef, 0xcc, 0x1a, 0x0f, 0xce, 0xbe, 0x42, 0xce,
-  0x9d, 0x06, 0xe8, 0xc6, 0x4f, 0x28, 0x13, 0x07, 0xa9, 0x47, 0xb4, 0xe6,
-  0x65, 0x48, 0x0b, 0x13, 0xd7, 0x52, 0xd8, 0xb5, 0xfd, 0xf4, 0x09, 0x02,
-  0x1b, 0xff, 0x1f, 0xca, 0x10, 0xcd, 0x81, 0x30, 0x3a, 0x19, 0xf3, 0x32,
-  0x8a, 0x4b, 0x26, 0xfb, 0xf9, 0x17, 0xbb, 0xa3, 0x5f, 0xb2, 0xec, 0xf3,
-  0xd7, 0xc6, 0x13, 0x12, 0x5e, 0xee, 0xf5, 0x00, 0xbd, 0xf3, 0xe4, 0xf4,
-  0x37, 0x30, 0xf3, 0x22, 0x3f, 0xb1, 0x57, 0xdc, 0xdd, 0x49, 0xe3, 0x0f,
-  0x08, 0x70, 0x22, 0xf9, 0x0c, 0xfd, 0x5d, 0xc2, 0x0b, 0xc9, 0x32, 0xbb,
-  0x04, 0xf2, 0xd8, 0x07, 0x42, 0xca, 0x7f, 0x24, 0xf2, 0xb9, 0x03, 0xe6,
-  0xe4, 0xea, 0x2e, 0x0d, 0xfd, 0x07, 0xc1, 0x3d, 0xf3, 0x46, 0x16, 0x3b,
-  0x33, 0xe4, 0xfc, 0xf9, 0xe3, 0xf3, 0xe0, 0xea, 0x38, 0x0f, 0x55, 0x07,
-  0x05, 0xd9, 0x4b, 0xe7, 0xce, 0x15, 0x20, 0x26, 0x07, 0xbd, 0xf3, 0xf4,
-  0x55, 0x01, 0xe0, 0xc8, 0x39, 0xe9, 0xe7, 0x49, 0x48, 0xde, 0x5a, 0x25,
-  0x43, 0x3d, 0xec, 0xb9, 0x1a, 0x04, 0x35, 0x3d, 0xb0, 0x28, 0xd6, 0x27,
-  0x06, 0x14, 0xf3, 0x08, 0x49, 0x17, 0xdf, 0x0b, 0xda, 0xe2, 0xc0, 0xcf,
-  0xf2, 0x00, 0x19, 0xe7, 0xf1, 0xab, 0xdf, 0xf7, 0x28, 0xf3, 0x2c, 0x05,
-  0x18, 0x1f, 0xba, 0xf3, 0x0c, 0x04, 0xe6, 0x25, 0x27, 0x4b, 0x07, 0xe9,
-  0x28, 0x51, 0x33, 0x27, 0xd0, 0xa6, 0x2b, 0xfe, 0xd0, 0x25, 0x16, 0x35,
-  0xaf, 0x52, 0xf7, 0x52, 0x4b, 0x02, 0x68, 0x5a, 0x12, 0x0e, 0x3a, 0x30,
-  0xeb, 0xb7, 0x20, 0xcd, 0x24, 0x48, 0x21, 0x22, 0x2b, 0xcf, 0xd2, 0x15,
-  0x15, 0x11, 0xcb, 0x29, 0xe5, 0x6f, 0x7f, 0xc2, 0x19, 0x48, 0xdc, 0x6c,
-  0x48, 0x17, 0xe2, 0x0e, 0x06, 0x9e, 0x2c, 0xf3, 0xd1, 0x33, 0x64, 0x53,
-  0x53, 0x4b, 0xc5, 0xf3, 0xee, 0x5b, 0x3b, 0x10, 0xf6, 0x13, 0x2e, 0xe7,
-  0x4a, 0x4f, 0xe2, 0x26, 0x09, 0xb4, 0x3a, 0xfa, 0x40, 0xfe, 0x08, 0xf3,
-  0xdd, 0xd1, 0xeb, 0x42, 0xe5, 0xc4, 0xe3, 0x1b, 0x1f, 0x0e, 0xa6, 0xb2,
-  0x0b, 0xb0, 0x23, 0x32, 0x0c, 0xec, 0x11, 0x5d, 0x08, 0x61, 0xfd, 0x96,
-  0xf9, 0x0d, 0xe6, 0xad, 0xc6, 0xa8, 0xe7, 0x18, 0xe0, 0xfa, 0x35, 0x2e,
-  0xd9, 0x0f, 0x58, 0xa6, 0x15, 0x21, 0xd7, 0x0b, 0x9d, 0xec, 0x36, 0x20,
-  0x11, 0x56, 0xdc, 0xfa, 0x6d, 0x24, 0xff, 0x00, 0x41, 0xeb, 0xd8, 0x26,
-  0x6a, 0x2e, 0x3d, 0x52, 0xfc, 0xaa, 0x11, 0xec, 0xcd, 0xdc, 0xcf, 0x39,
-  0xc0, 0x56, 0xec, 0x5a, 0x09, 0xea, 0xc4, 0x47, 0xf5, 0xc2, 0xb3, 0x0b,
-  0x25, 0x03, 0xf5, 0x36, 0x15, 0x2c, 0xd9, 0xfb, 0x08, 0xd2, 0xe4, 0x53,
-  0xf9, 0xf5, 0xfd, 0xdf, 0xbd, 0x05, 0xe2, 0x22, 0xed, 0xfc, 0xe6, 0xfa,
-  0xaa, 0xd4, 0xc8, 0x0f, 0x9e, 0xfa, 0x22, 0x1e, 0xf7, 0x44, 0xf6, 0x91,
-  0xfe, 0x08, 0x10, 0xb1, 0xe6, 0xda, 0x0a, 0xd1, 0xf6, 0xb3, 0xfd, 0xf6,
-  0x1b, 0xca, 0x0a, 0x18, 0x2b, 0x81, 0xe7, 0xcd, 0x18, 0x0b, 0x23, 0xe9,
-  0x3a, 0x22, 0xa5, 0x4f, 0xd0, 0x0d, 0x0b, 0xb3, 0xe8, 0xe4, 0x0b, 0xeb,
-  0xda, 0xf8, 0xdb, 0x45, 0x00, 0x24, 0xbe, 0xc5, 0xb1, 0xae, 0x2e, 0x04,
-  0xfe, 0x57, 0x1a, 0xe9, 0x12, 0xe2, 0x53, 0x60, 0xef, 0x65, 0x2b, 0x46,
-  0x26, 0xdc, 0xe3, 0xd3, 0xf5, 0xbb, 0xa3, 0x28, 0xda, 0x0d, 0xa5, 0xe1,
-  0xf1, 0xf1, 0xb6, 0x07, 0xeb, 0x23, 0xfd, 0xe5, 0x01, 0x05, 0x0b, 0xfc,
-  0xc9, 0x69, 0xda, 0xcd, 0xe1, 0x0f, 0x95, 0x42, 0x53, 0xfd, 0xb6, 0x7d,
-  0x41, 0xf8, 0xdd, 0x1f, 0x04, 0x1c, 0x84, 0xf0, 0xea, 0xfc, 0x2b, 0xfc,
-  0xbc, 0x60, 0x52, 0x9a, 0xe0, 0x2a, 0x43, 0x17, 0x2c, 0xfa, 0x41, 0xaa,
-  0x2e, 0x1c, 0x03, 0x81, 0x20, 0x22, 0xda, 0xb2, 0x9e, 0x1c, 0x05, 0x25,
-  0x24, 0x25, 0x43, 0xf5, 0x09, 0xc0, 0x62, 0xe2, 0xbf, 0x3b, 0x46, 0xd0,
-  0xbe, 0x01, 0x4f, 0xee, 0x2e, 0xdb, 0x59, 0xd4, 0xb7, 0x11, 0xc2, 0xd3,
-  0xeb, 0x37, 0x06, 0xe8, 0x11, 0xdc, 0xdb, 0xf1, 0xe9, 0xef, 0x24, 0x17,
-  0xe3, 0xe5, 0x85, 0xfe, 0xe6, 0x0e, 0x0c, 0x0d, 0x4c, 0xa0, 0x3e, 0x0f,
-  0x55, 0x52, 0x37, 0x01, 0xb3, 0x34, 0xe8, 0x58, 0xf5, 0x3d, 0x29, 0xf8,
-  0x00, 0xfb, 0xf5, 0xd1, 0x28, 0x01, 0x63, 0xe9, 0x1b, 0x12, 0xf6, 0xcc,
-  0x1f, 0xfd, 0x04, 0x11, 0xe8, 0xfa, 0xfe, 0x2d, 0x0a, 0xf0, 0xfd, 0xe4,
-  0x1b, 0xd1, 0xc1, 0x02, 0x1d, 0x0f, 0x32, 0xef, 0x03, 0x2f, 0xee, 0x24,
-  0xe8, 0x13, 0xe5, 0xfd, 0x0c, 0x15, 0xfe, 0x3b, 0x42, 0xd0, 0xf6, 0xfa,
-  0x1c, 0x1a, 0xea, 0x0a, 0xec, 0x08, 0xbd, 0xf2, 0x04, 0x20, 0xd2, 0xbb,
-  0x4b, 0x25, 0x26, 0x19, 0xf7, 0xf2, 0x0f, 0x04, 0x4a, 0x34, 0xec, 0x20,
-  0x0e, 0xe5, 0xed, 0x1d, 0xbe, 0x17, 0xff, 0x23, 0xfb, 0xf9, 0xf9, 0x3e,
-  0x43, 0xd4, 0xf2, 0x0a, 0x81, 0x1b, 0xfc, 0xda, 0xdb, 0xfb, 0x0a, 0xd1,
-  0x30, 0xf5, 0xf7, 0xd5, 0x1c, 0xec, 0x16, 0x5a, 0xd3, 0x31, 0x13, 0xfe,
-  0x0a, 0x30, 0xc8, 0x22, 0x1e, 0x19, 0x03, 0xd6, 0x10, 0x43, 0x01, 0x1a,
-  0x09, 0xc8, 0x2b, 0xfe, 0x02, 0xc9, 0x0d, 0x45, 0x0c, 0x64, 0x29, 0xf6,
-  0x60, 0x01, 0x74, 0x1e, 0x0d, 0x06, 0x4f, 0x1e, 0xb4, 0x9d, 0x28, 0xe7,
-  0x50, 0x06, 0x1b, 0xaa, 0xf8, 0x81, 0xb6, 0x2a, 0xd5, 0x21, 0xc0, 0x01,
-  0x31, 0x58, 0x29, 0xdf, 0x34, 0x69, 0x25, 0x34, 0x34, 0x0b, 0x23, 0x2a,
-  0xde, 0xa4, 0xf1, 0x13, 0x00, 0x5e, 0x5f, 0x34, 0x49, 0x5c, 0x0c, 0xd0,
-  0x08, 0x3b, 0x0c, 0xe5, 0x0b, 0xfd, 0x18, 0x30, 0xe5, 0x0e, 0x29, 0xff,
-  0x1e, 0xb1, 0x28, 0xdc, 0x07, 0xf8, 0xf8, 0x20, 0xd7, 0xe3, 0x19, 0x20,
-  0xb9, 0xbd, 0xc4, 0x2a, 0xf8, 0x0d, 0xc0, 0xae, 0x4c, 0x9d, 0xc1, 0x27,
-  0xe1, 0xad, 0x34, 0x27, 0xf1, 0x5a, 0x19, 0xcf, 0xe6, 0xe5, 0xa3, 0xf4,
-  0x9e, 0xfb, 0xd5, 0xf8, 0x6b, 0xf5, 0x42, 0x78, 0x09, 0xc7, 0x72, 0xe0,
-  0xed, 0x77, 0x0c, 0xd9, 0xb8, 0xcc, 0x0e, 0x3f, 0x4a, 0x01, 0x19, 0x32,
-  0x7a, 0xe4, 0xda, 0xc2, 0x98, 0x35, 0x44, 0x7f, 0x00, 0xf5, 0x37, 0x41,
-  0x3f, 0xf8, 0x56, 0xca, 0x10, 0xff, 0xc6, 0x17, 0x28, 0x5d, 0x37, 0x47,
-  0xf4, 0xf5, 0xdf, 0x17, 0x47, 0x1a, 0xce, 0x3d, 0xff, 0x2b, 0x47, 0xfb,
-  0x2c, 0x1a, 0x26, 0x39, 0x14, 0x11, 0xba, 0xc5, 0x0c, 0xf9, 0xef, 0xc5,
-  0x00, 0x0f, 0x00, 0x3a, 0x59, 0x4a, 0xe6, 0x26, 0xb1, 0x38, 0xf9, 0xdb,
-  0x43, 0xb8, 0xef, 0xe9, 0x63, 0xfe, 0xe0, 0x08, 0x0a, 0xde, 0xf3, 0x1b,
-  0x50, 0x51, 0x07, 0xf0, 0xfb, 0xe9, 0x13, 0x39, 0x0a, 0xff, 0xdf, 0x21,
-  0x46, 0x13, 0xc0, 0xea, 0x31, 0xe6, 0x47, 0x30, 0xe6, 0xb7, 0xf8, 0xf0,
-  0xfe, 0x48, 0xd6, 0xe9, 0x1d, 0x0c, 0xe2, 0x29, 0x19, 0xd8, 0x02, 0xd1,
-  0xef, 0x14, 0x34, 0x17, 0x04, 0xef, 0x1b, 0x27, 0x1c, 0x18, 0xf0, 0x05,
-  0xd8, 0x01, 0x59, 0x2c, 0xfa, 0x59, 0xfa, 0xfe, 0x35, 0x3b, 0x3f, 0xfd,
-  0x0e, 0xaf, 0xb9, 0xd0, 0x0e, 0x37, 0x23, 0x68, 0xf8, 0x10, 0xb5, 0x37,
-  0xfc, 0x0a, 0xf2, 0x18, 0x81, 0x35, 0xe9, 0x14, 0xe6, 0xf2, 0xb4, 0xff,
-  0xdb, 0xc7, 0xc4, 0xb8, 0x17, 0x29, 0x14, 0xec, 0xc9, 0xcc, 0xe2, 0x03,
-  0xf3, 0xea, 0x1f, 0x03, 0xed, 0x56, 0x1a, 0xf4, 0xd2, 0xec, 0x1c, 0x54,
-  0xe2, 0xc9, 0x25, 0xe7, 0xb4, 0x01, 0x2a, 0xfe, 0xc8, 0x88, 0xe3, 0x19,
-  0x9b, 0x0e, 0xd8, 0xaa, 0x0a, 0x3a, 0x9e, 0x43, 0xba, 0xfe, 0x06, 0xf7,
-  0xf9, 0xf0, 0x3d, 0xc3, 0xed, 0xe2, 0xfa, 0xea, 0xd3, 0xcc, 0xab, 0xca,
-  0x1b, 0xfe, 0x21, 0xc1, 0x0e, 0x2e, 0x10, 0x14, 0xdb, 0x26, 0x54, 0xf6,
-  0x09, 0xf3, 0xef, 0x25, 0x05, 0x30, 0xad, 0x46, 0x18, 0x0b, 0x2e, 0x0b,
-  0x33, 0x32, 0x21, 0xdf, 0xf9, 0xf1, 0xdc, 0x1a, 0xce, 0xc1, 0xf1, 0xe1,
-  0xb7, 0x32, 0xce, 0x31, 0x37, 0xeb, 0x0c, 0xf2, 0x17, 0xba, 0x0c, 0xc2,
-  0x12, 0xb7, 0x2e, 0x2a, 0xd4, 0xd6, 0x48, 0x64, 0x05, 0x2e, 0x71, 0xf4,
-  0xd8, 0xb4, 0x24, 0x10, 0xc6, 0x6b, 0x5c, 0x1f, 0xf7, 0x1a, 0xcc, 0xee,
-  0x54, 0x04, 0x2a, 0x42, 0xe2, 0xe2, 0x2c, 0x7f, 0x24, 0xf6, 0xff, 0x22,
-  0xe3, 0xce, 0x9e, 0x2c, 0xf9, 0x4d, 0xf7, 0x1c, 0x11, 0x43, 0x3b, 0xc0,
-  0xf9, 0x08, 0xca, 0xd8, 0xee, 0xbd, 0xc1, 0x16, 0xa5, 0xb4, 0x05, 0xe6,
-  0x59, 0x00, 0x47, 0xc3, 0x02, 0x47, 0x2e, 0xdf, 0xc1, 0x68, 0x21, 0x17,
-  0xcc, 0xd4, 0xbd, 0xff, 0xea, 0x65, 0xce, 0x35, 0x6c, 0x0a, 0xe0, 0x36,
-  0x9f, 0x19, 0x03, 0x5f, 0xe3, 0xc1, 0x60, 0xc6, 0x23, 0xa5, 0xf4, 0xbe,
-  0x99, 0xcb, 0xf1, 0xd6, 0x16, 0x42, 0xfc, 0xec, 0xb2, 0x25, 0xf2, 0x3d,
-  0xea, 0x3e, 0x37, 0xd7, 0xb7, 0x5a, 0xd7, 0x20, 0x3d, 0x05, 0xdc, 0x5e,
-  0xe1, 0x67, 0x37, 0xcc, 0xd4, 0x04, 0x2b, 0x12, 0x3f, 0x16, 0xff, 0x73,
-  0x29, 0x2b, 0xf2, 0x21, 0x2c, 0x3c, 0xf5, 0x2b, 0xef, 0x13, 0xb7, 0xda,
-  0x29, 0x1d, 0x90, 0x39, 0xb1, 0x23, 0x34, 0x00, 0xf9, 0xc4, 0x50, 0x10,
-  0x18, 0xe3, 0xef, 0xb2, 0x59, 0xd3, 0xe2, 0xf0, 0xb2, 0x52, 0xbb, 0xfb,
-  0x6b, 0xd0, 0x2a, 0x56, 0xe9, 0x45, 0x15, 0x57, 0x95, 0xfc, 0xd0, 0x00,
-  0xf1, 0xb4, 0xc3, 0x07, 0x95, 0x3e, 0xe8, 0xd7, 0xe5, 0x5a, 0x07, 0xf8,
-  0xac, 0xd8, 0x31, 0xf4, 0xcc, 0x03, 0x24, 0xd7, 0xe3, 0x40, 0xf0, 0x0f,
-  0xc8, 0xe6, 0xc8, 0x0f, 0xfe, 0x0a, 0xf9, 0xb1, 0xee, 0x23, 0x1c, 0xb4,
-  0x55, 0xcb, 0x00, 0xbf, 0xe1, 0x14, 0x4b, 0x16, 0x20, 0x13, 0x14, 0x4e,
-  0xc4, 0xf8, 0x0f, 0xf3, 0x6f, 0x3a, 0x81, 0x3c, 0xc4, 0xeb, 0x05, 0x40,
-  0xc8, 0xdc, 0x2b, 0x2e, 0xd8, 0x39, 0xfb, 0xf2, 0x6e, 0xdd, 0xf3, 0x68,
-  0x92, 0x3e, 0x5d, 0x12, 0xd6, 0x27, 0xc7, 0x1a, 0x68, 0x17, 0x3e, 0x17,
-  0x2a, 0xe6, 0x35, 0x06, 0x34, 0xea, 0x48, 0xbd, 0x3d, 0x30, 0x19, 0x10,
-  0x03, 0x68, 0xe8, 0x54, 0xc4, 0xe1, 0x38, 0x7f, 0xf2, 0xd0, 0xcb, 0xc4,
-  0xfa, 0x91, 0x32, 0xc5, 0xc1, 0x1e, 0x03, 0xc7, 0xfc, 0x9f, 0xd9, 0xda,
-  0xd8, 0x12, 0xc1, 0xdb, 0x27, 0x01, 0xea, 0xd8, 0xc0, 0xbf, 0xfc, 0xe1,
-  0x25, 0xfe, 0xd5, 0x67, 0xc9, 0xb5, 0xf9, 0x14, 0xda, 0x02, 0x00, 0xd4,
-  0x20, 0xec, 0x21, 0xf5, 0xd3, 0x26, 0xbc, 0x05, 0x93, 0x3c, 0x37, 0xaf,
-  0xc5, 0x33, 0xca, 0x25, 0x5d, 0x00, 0xc3, 0x3b, 0xef, 0xd1, 0xf9, 0xde,
-  0xc5, 0x96, 0x12, 0xad, 0xff, 0xcc, 0x1b, 0x04, 0xc5, 0xea, 0x46, 0x0c,
-  0x08, 0x5c, 0x0f, 0x4a, 0x12, 0xc4, 0x92, 0x49, 0x31, 0xfd, 0x13, 0x33,
-  0xa8, 0x9d, 0x3e, 0x77, 0x5f, 0xe5, 0xc1, 0xfd, 0xb9, 0xeb, 0x13, 0x0e,
-  0x0d, 0xfc, 0xf6, 0x25, 0xfe, 0xdd, 0x27, 0x48, 0xae, 0xbe, 0x49, 0xda,
-  0xe4, 0xa7, 0x49, 0x13, 0x32, 0x33, 0x2a, 0x6d, 0x2a, 0x30, 0xe7, 0x35,
-  0x46, 0xdc, 0xd7, 0x11, 0x98, 0xf9, 0xf3, 0xd7, 0xa1, 0x0e, 0xc5, 0x0f,
-  0xed, 0x0f, 0x20, 0x2b, 0xe8, 0xaf, 0x82, 0x98, 0xe8, 0xbb, 0xf0, 0x03,
-  0xf8, 0xf1, 0xaa, 0xde, 0xf0, 0x03, 0xf9, 0x1c, 0x4d, 0xb2, 0x20, 0xd1,
-  0x3a, 0xe0, 0x6e, 0xfc, 0x4a, 0xfc, 0x1c, 0xe8, 0x15, 0xad, 0xe0, 0xd3,
-  0x1d, 0xc8, 0x1a, 0xb6, 0x1e, 0x1f, 0x4b, 0x19, 0xfd, 0x11, 0xfb, 0x16,
-  0xed, 0xd4, 0x56, 0x21, 0x86, 0xd7, 0xf6, 0xc4, 0x4a, 0x81, 0xed, 0xbe,
-  0x5a, 0xf2, 0xcb, 0x95, 0x20, 0xf7, 0xe3, 0xcb, 0xc3, 0xab, 0x2b, 0xa7,
-  0xda, 0x3b, 0x15, 0xb8, 0x0e, 0x23, 0x40, 0x11, 0x56, 0xed, 0x0d, 0x20,
-  0x03, 0x45, 0x40, 0xb0, 0x43, 0x06, 0xe0, 0x0f, 0x2f, 0x11, 0x06, 0x1a,
-  0x35, 0x23, 0xf7, 0x0c, 0xf5, 0x04, 0xe6, 0xbf, 0xf7, 0x37, 0xc3, 0x7f,
-  0x3e, 0x3f, 0x05, 0xe9, 0xe1, 0xd1, 0xc3, 0x18, 0x06, 0x28, 0x06, 0x1d,
-  0x24, 0x48, 0xda, 0xef, 0x4c, 0x51, 0xc1, 0xfb, 0xd4, 0xf9, 0xec, 0xe8,
-  0x4b, 0x38, 0x03, 0x0b, 0x0b, 0x24, 0xd5, 0x1d, 0x94, 0xea, 0xb6, 0x14,
-  0x2a, 0xd0, 0x0d, 0xc6, 0x19, 0x4e, 0x26, 0x32, 0xce, 0xde, 0x2b, 0xe6,
-  0x27, 0x47, 0x15, 0xe8, 0xf2, 0xd4, 0xfe, 0x0a, 0xd2, 0x26, 0x0f, 0xe4,
-  0xee, 0xb5, 0x04, 0xf9, 0x30, 0xdc, 0x30, 0xe2, 0xc7, 0x1d, 0xdc, 0xc1,
-  0xef, 0xed, 0x0d, 0xc8, 0xcb, 0x24, 0xcf, 0xe2, 0xed, 0xef, 0x04, 0x02,
-  0x01, 0x37, 0xf4, 0xf3, 0xf6, 0x6c, 0xd7, 0x32, 0xd6, 0x11, 0xf6, 0xd2,
-  0xf9, 0x34, 0x58, 0x38, 0xc9, 0xdc, 0x3b, 0xe8, 0xe8, 0xc0, 0xd9, 0xfc,
-  0x02, 0xd8, 0x09, 0xcb, 0x4e, 0x99, 0x31, 0xb8, 0xdd, 0xfe, 0xd8, 0x2c,
-  0xc5, 0xea, 0x28, 0xfe, 0x6d, 0xa9, 0x1b, 0x14, 0x15, 0x5c, 0x3d, 0xd1,
-  0xf0, 0xbf, 0xfb, 0xcb, 0xe1, 0x61, 0xdb, 0xdb, 0x08, 0x05, 0xe2, 0x34,
-  0x17, 0x02, 0x2a, 0x79, 0xb1, 0x1e, 0xe0, 0x72, 0x4c, 0x1c, 0xfd, 0x11,
-  0x28, 0xa0, 0xaa, 0xc6, 0xbf, 0x27, 0xc8, 0xd6, 0xe7, 0x08, 0x10, 0x48,
-  0xd9, 0xcc, 0x0a, 0x7f, 0x21, 0x0a, 0xd5, 0xc2, 0xe6, 0x30, 0x28, 0xf7,
-  0xe0, 0xe6, 0xc2, 0x08, 0x1c, 0xcb, 0x78, 0xd1, 0x2d, 0x17, 0xb2, 0x01,
-  0xed, 0xa1, 0xfa, 0xd4, 0xc4, 0x98, 0x44, 0x25, 0xc4, 0xf2, 0x3f, 0xf6,
-  0xe9, 0x61, 0x22, 0x2f, 0xe1, 0x4d, 0xe3, 0xec, 0x2b, 0xdf, 0xe3, 0xa6,
-  0x40, 0xe7, 0x42, 0x44, 0xf0, 0xa2, 0x2d, 0xe0, 0xb7, 0x1f, 0x26, 0x40,
-  0x28, 0x08, 0xb0, 0xe0, 0xd0, 0xba, 0xbe, 0xbc, 0xbd, 0x1b, 0xe5, 0x38,
-  0xc7, 0x01, 0x0c, 0xed, 0xf1, 0x0d, 0xf5, 0xc1, 0xdd, 0x03, 0x22, 0x53,
-  0x44, 0xdf, 0x2b, 0x38, 0x0f, 0xcc, 0x19, 0x13, 0x29, 0x32, 0xf4, 0x10,
-  0x24, 0xd4, 0x1d, 0x12, 0x39, 0xee, 0x4c, 0xfe, 0x10, 0xbe, 0xd2, 0xda,
-  0xce, 0x7f, 0xbe, 0xde, 0x04, 0xdf, 0x1c, 0x12, 0xe5, 0x18, 0x17, 0x0f,
-  0xff, 0xcc, 0x2d, 0xe9, 0x5a, 0xd6, 0x1e, 0xba, 0x47, 0x14, 0x00, 0x0c,
-  0xdb, 0xc6, 0xf9, 0x00, 0xeb, 0x41, 0x3d, 0xe7, 0x19, 0xd1, 0x37, 0x28,
-  0xc8, 0x1f, 0x1d, 0x19, 0x03, 0xd8, 0xec, 0xe6, 0xf4, 0xf8, 0x3c, 0xd5,
-  0xb1, 0xfb, 0x12, 0xd2, 0xd3, 0xe7, 0xbd, 0x26, 0xb9, 0x1a, 0x1d, 0x13,
-  0x2f, 0xe0, 0x30, 0x0f, 0xc1, 0x13, 0x49, 0xda, 0x09, 0xc7, 0xd0, 0x2a,
-  0x4b, 0x0e, 0xda, 0x10, 0x1e, 0x28, 0x47, 0xe5, 0xe9, 0x0c, 0xdc, 0x1b,
-  0x30, 0xf0, 0xff, 0x38, 0xd7, 0xeb, 0x3a, 0x2b, 0xe0, 0xdc, 0x16, 0x03,
-  0xeb, 0xf0, 0x12, 0xdf, 0x0f, 0xe1, 0xbe, 0x5a, 0x62, 0x26, 0x00, 0xfe,
-  0x39, 0xee, 0x30, 0xca, 0xae, 0xaf, 0x12, 0xe7, 0xb9, 0x2f, 0xbf, 0x1f,
-  0xfb, 0x22, 0x2c, 0x8f, 0x3e, 0x35, 0x36, 0x0b, 0xb8, 0xf2, 0xf0, 0x1c,
-  0x0e, 0xd8, 0x14, 0xf8, 0xb4, 0xef, 0xdf, 0xee, 0xd2, 0xf3, 0x0f, 0xf0,
-  0xec, 0xfe, 0x46, 0xd2, 0xb0, 0x3a, 0x08, 0xfd, 0x41, 0xf8, 0xb3, 0x07,
-  0x12, 0xcf, 0x26, 0xf0, 0xd6, 0xde, 0x34, 0xef, 0x38, 0x13, 0x0d, 0x26,
-  0x0b, 0xdb, 0x14, 0xea, 0x1d, 0xcc, 0xc8, 0x3a, 0xfd, 0xe1, 0x13, 0x4d,
-  0x34, 0xb3, 0xb4, 0x51, 0xf4, 0xbc, 0x40, 0x14, 0xe3, 0x3c, 0x45, 0xcf,
-  0xea, 0x11, 0x4f, 0x08, 0xfa, 0x3e, 0x09, 0x1f, 0x50, 0x6a, 0x0a, 0x56,
-  0x59, 0x39, 0x2b, 0xc9, 0xe3, 0x7f, 0x08, 0xd2, 0x38, 0x20, 0x28, 0x3b,
-  0x1a, 0xb1, 0x07, 0xd4, 0xfb, 0xf6, 0x0e, 0x0a, 0xcc, 0x0e, 0x00, 0x34,
-  0x0b, 0xe1, 0x1f, 0x9c, 0xc5, 0x01, 0xe4, 0xb8, 0x00, 0xba, 0x11, 0x5c,
-  0xcf, 0xd1, 0xda, 0xd2, 0xdb, 0x32, 0x0a, 0xe7, 0x0d, 0x1c, 0x31, 0x08,
-  0x2f, 0x27, 0x03, 0x17, 0x18, 0xa1, 0x4e, 0x2f, 0xe0, 0x66, 0x72, 0xf3,
-  0xcd, 0xee, 0xfe, 0x12, 0x22, 0x34, 0xc2, 0xdf, 0xde, 0x14, 0xed, 0x37,
-  0xbd, 0xd7, 0xe8, 0xf8, 0x24, 0x2d, 0x43, 0x26, 0x14, 0xe3, 0x37, 0xfa,
-  0x89, 0x36, 0xd8, 0x00, 0xd9, 0xbb, 0x0a, 0xca, 0x2d, 0x1a, 0x21, 0xdd,
-  0xf3, 0x46, 0xf1, 0xee, 0x39, 0x12, 0xb0, 0x08, 0x65, 0xdd, 0x33, 0x93,
-  0x3f, 0xc3, 0xf5, 0x13, 0x83, 0x66, 0xc8, 0xac, 0x09, 0x0e, 0xf2, 0x7f,
-  0xf7, 0xdb, 0x50, 0xcf, 0xc8, 0x01, 0x23, 0xf1, 0x2b, 0xff, 0xef, 0x73,
-  0x3d, 0xdc, 0xdb, 0x5f, 0xdb, 0xf1, 0xdb, 0xf8, 0xdb, 0x0d, 0xe4, 0x2e,
-  0xc6, 0xe7, 0x33, 0xd7, 0x26, 0x39, 0xd7, 0x07, 0xd2, 0x34, 0x1e, 0x05,
-  0xc3, 0x53, 0x3e, 0xf3, 0x03, 0x15, 0x3f, 0xf1, 0x0e, 0x13, 0xd4, 0xfe,
-  0x3b, 0x0a, 0x3c, 0xba, 0x27, 0xad, 0xea, 0x04, 0x1c, 0x1c, 0x76, 0x16,
-  0x4e, 0x42, 0x6a, 0xb6, 0x12, 0x2e, 0x2e, 0xe2, 0xeb, 0xe8, 0xe9, 0xd5,
-  0xea, 0xca, 0x2d, 0xe7, 0xc9, 0xe8, 0xd3, 0x38, 0xb6, 0x19, 0x81, 0xd3,
-  0xd8, 0x64, 0x12, 0x23, 0xdc, 0x08, 0x7a, 0x9e, 0xbd, 0xcd, 0x19, 0x1b,
-  0xe4, 0xe4, 0x5c, 0x09, 0x42, 0xf9, 0x25, 0xde, 0xea, 0xf8, 0x1c, 0xd9,
-  0xc7, 0x17, 0x04, 0x58, 0x1e, 0x1c, 0xf2, 0xd6, 0x08, 0xe7, 0xd1, 0xd5,
-  0x7d, 0x18, 0xf8, 0xc7, 0x24, 0xff, 0x55, 0xb7, 0xe4, 0x55, 0x2e, 0xcd,
-  0xc8, 0xef, 0x5f, 0x13, 0xf7, 0xd2, 0xf5, 0xeb, 0x25, 0xb4, 0xa1, 0x42,
-  0x09, 0x61, 0x0a, 0xb4, 0xec, 0x51, 0xfc, 0x2b, 0x15, 0x05, 0x04, 0x3c,
-  0x68, 0xf7, 0x29, 0xf7, 0xe1, 0x04, 0xbf, 0xef, 0x05, 0x14, 0x3a, 0x0e,
-  0xe2, 0xc8, 0xaa, 0x1c, 0x0f, 0x28, 0xad, 0x2e, 0xf5, 0xf5, 0x4b, 0xed,
-  0x54, 0x18, 0x57, 0xf8, 0x0e, 0x2e, 0xcb, 0x29, 0xe0, 0xf7, 0x02, 0xd6,
-  0xde, 0x0e, 0x54, 0x34, 0xf8, 0x6f, 0xd4, 0xf8, 0xf5, 0x5c, 0x27, 0xef,
-  0x28, 0xf5, 0xe2, 0xea, 0x18, 0xf0, 0x2c, 0xdc, 0x11, 0xe4, 0x0b, 0x0a,
-  0x30, 0x44, 0xf9, 0x4b, 0xc1, 0xd0, 0xe5, 0x1b, 0xee, 0xf8, 0xc2, 0x32,
-  0x48, 0x35, 0xd7, 0xc1, 0x04, 0xe1, 0x41, 0x39, 0x03, 0xd0, 0xf5, 0x4f,
-  0x55, 0x30, 0x1d, 0xe8, 0x3d, 0xd9, 0x81, 0xc7, 0xcc, 0xe8, 0xd5, 0xd7,
-  0x09, 0x14, 0x07, 0x4b, 0x16, 0xe8, 0x07, 0xdf, 0x0f, 0x49, 0x01, 0xec,
-  0xc7, 0xef, 0x3b, 0x48, 0x12, 0x1d, 0xfe, 0x18, 0x6c, 0xec, 0xe8, 0xc5,
-  0x3f, 0xd4, 0x14, 0x49, 0x1d, 0xcd, 0x25, 0xfd, 0xfe, 0xfd, 0xd4, 0x12,
-  0xbd, 0xee, 0x23, 0x2e, 0x1d, 0xf3, 0x0e, 0x36, 0x4b, 0x22, 0xe9, 0x00,
-  0x34, 0xfd, 0x11, 0x8e, 0xd8, 0xce, 0xc7, 0x1d, 0x40, 0x1d, 0xff, 0x9e,
-  0x3e, 0xd0, 0x9e, 0x35, 0xaf, 0x47, 0xfa, 0x3b, 0xf7, 0xfc, 0xf1, 0x29,
-  0x1a, 0xb3, 0xab, 0x0c, 0x24, 0x13, 0x1f, 0x4c, 0x00, 0xf6, 0xcd, 0xd2,
-  0xf6, 0x30, 0xaf, 0x9e, 0x0a, 0x7f, 0xf1, 0x18, 0x22, 0x37, 0x55, 0x45,
-  0xd5, 0xc5, 0x21, 0xb3, 0x0e, 0xcb, 0x18, 0xd7, 0xe4, 0xe0, 0x02, 0x36,
-  0xd3, 0xfb, 0x24, 0xcf, 0xef, 0x20, 0x1e, 0x14, 0x11, 0xe4, 0xa9, 0x5f,
-  0xda, 0x08, 0x08, 0x35, 0xdf, 0xc2, 0xcc, 0xd5, 0x6b, 0xbf, 0x19, 0x06,
-  0x69, 0xe9, 0xbd, 0x97, 0x01, 0xd5, 0xe2, 0x0a, 0x05, 0xb4, 0x2c, 0x05,
-  0x1f, 0x22, 0x0f, 0xea, 0x52, 0x01, 0x15, 0x13, 0x10, 0xdd, 0x09, 0xef,
-  0x11, 0xf8, 0xbe, 0x03, 0xdb, 0xbd, 0xc9, 0x26, 0xf2, 0x25, 0xfd, 0x18,
-  0xee, 0xc1, 0x9b, 0xff, 0x38, 0x24, 0x20, 0xf0, 0x0d, 0xd4, 0x15, 0x0c,
-  0x3e, 0x2d, 0xc7, 0x68, 0xba, 0x55, 0xba, 0xc1, 0x2b, 0x4c, 0x0a, 0x18,
-  0x5a, 0xaf, 0xc1, 0xe9, 0x0c, 0x35, 0x23, 0xea, 0xbf, 0x06, 0x12, 0xe5,
-  0x48, 0xca, 0xc0, 0xae, 0xbc, 0x7f, 0x05, 0x3e, 0x99, 0xf3, 0x34, 0x2b,
-  0xe9, 0x00, 0x04, 0x4a, 0x9c, 0xc6, 0xf4, 0xea, 0xf2, 0xee, 0xba, 0x0d,
-  0x39, 0x0a, 0xea, 0x8a, 0x51, 0x00, 0x53, 0xfa, 0xdc, 0x29, 0x25, 0x0a,
-  0x3e, 0x53, 0xf7, 0xf8, 0x2b, 0x2d, 0x1d, 0xf7, 0x14, 0x0f, 0x1f, 0x44,
-  0xe2, 0xf3, 0xe6, 0xfb, 0x2f, 0xca, 0xda, 0x5f, 0xbc, 0x37, 0xd8, 0x12,
-  0xeb, 0x3f, 0xfe, 0xef, 0x4d, 0xf3, 0x0a, 0x20, 0xfa, 0x0b, 0x4b, 0x1c,
-  0x01, 0xfc, 0xb0, 0xfb, 0x5d, 0x1d, 0x22, 0xde, 0x6c, 0x00, 0xdb, 0xf9,
-  0x09, 0xaf, 0x92, 0x4c, 0xef, 0xdf, 0x29, 0xb6, 0x5d, 0xbe, 0xb0, 0x22,
-  0xde, 0xe3, 0xd1, 0x31, 0x1f, 0xe0, 0xd3, 0x66, 0xb4, 0xbd, 0xec, 0xce,
-  0x0f, 0x39, 0x0d, 0x5a, 0x0d, 0x26, 0xdf, 0x25, 0x33, 0x98, 0xe7, 0x48,
-  0xe5, 0xe3, 0xed, 0x23, 0xe1, 0xba, 0x29, 0xc3, 0xeb, 0xe3, 0x21, 0xe9,
-  0x12, 0x0c, 0xd9, 0x0b, 0x16, 0xc6, 0x2b, 0x23, 0xf8, 0x1d, 0x27, 0x0d,
-  0x0c, 0x46, 0x0c, 0x36, 0xdb, 0x3c, 0x81, 0xf8, 0xf1, 0x19, 0xab, 0xf8,
-  0xef, 0x03, 0x02, 0x8e, 0xb2, 0x18, 0x4c, 0x4c, 0x0f, 0xdc, 0xbf, 0x13,
-  0x02, 0x75, 0xee, 0xc8, 0x09, 0xfe, 0x0c, 0xc2, 0x07, 0xec, 0xad, 0xdc,
-  0x48, 0xf5, 0x30, 0x0b, 0x9b, 0x37, 0x74, 0xec, 0x1e, 0x5b, 0xcf, 0x4e,
-  0x27, 0xb9, 0xa8, 0x65, 0xef, 0x62, 0x27, 0xc7, 0xfc, 0xf7, 0x05, 0xa9,
-  0xe2, 0x1b, 0x01, 0x12, 0xf4, 0xc7, 0x12, 0x61, 0x0c, 0xba, 0xe4, 0x35,
-  0x23, 0x5a, 0xe4, 0x78, 0x40, 0x55, 0x43, 0x02, 0x1f, 0xe0, 0x05, 0x2f,
-  0xfa, 0xc1, 0xe6, 0x2a, 0x3b, 0xb0, 0x23, 0x25, 0x05, 0xab, 0x30, 0xf3,
-  0x0c, 0xf5, 0xdf, 0x00, 0xea, 0x48, 0x02, 0xf8, 0x25, 0x03, 0xf0, 0x16,
-  0x0a, 0xff, 0x21, 0xe9, 0x12, 0x01, 0x3a, 0xee, 0xef, 0x30, 0x25, 0x1a,
-  0xb0, 0x2f, 0xcf, 0x1d, 0x30, 0x03, 0x4a, 0xe8, 0xea, 0xaf, 0xef, 0xe8,
-  0x1a, 0x2d, 0x34, 0xb8, 0x12, 0x30, 0xd5, 0xe6, 0xa2, 0x2e, 0xa1, 0x0e,
-  0xd4, 0x2c, 0xe4, 0xd4, 0xe6, 0xe8, 0xb0, 0xd8, 0xf6, 0x2b, 0x24, 0x34,
-  0x0b, 0xcc, 0x1f, 0x29, 0x72, 0xf7, 0x1a, 0x1c, 0x13, 0xbd, 0x51, 0x06,
-  0x7f, 0xea, 0xa4, 0xb7, 0x2d, 0xd4, 0x2a, 0x55, 0x2b, 0xcf, 0xf7, 0xdd,
-  0x0d, 0x68, 0x7c, 0x23, 0x1c, 0xe8, 0xc8, 0xeb, 0xdf, 0xf9, 0xfa, 0x2a,
-  0xcc, 0xf1, 0x05, 0x04, 0x1a, 0xf6, 0xe7, 0xf1, 0x04, 0x0e, 0xf3, 0x1f,
-  0xf6, 0x0e, 0x1a, 0x54, 0x15, 0x23, 0xf1, 0xf0, 0x28, 0x35, 0xc8, 0x0b,
-  0x0e, 0x17, 0x19, 0xf2, 0x21, 0x1a, 0x05, 0xec, 0x04, 0xc7, 0xe5, 0x0d,
-  0xfb, 0x7f, 0xf4, 0xe5, 0x37, 0xf6, 0x0c, 0x01, 0x1b, 0xe0, 0x04, 0x38,
-  0xc8, 0xf5, 0xe2, 0xfd, 0x0a, 0xeb, 0x02, 0x1b, 0x4f, 0x2c, 0xc5, 0xfc,
-  0xed, 0xe6, 0xe5, 0x09, 0x14, 0x0f, 0x1e, 0x0e, 0xee, 0xde, 0x1a, 0x10,
-  0xf4, 0x1e, 0x34, 0x3a, 0xea, 0xa8, 0xd3, 0x1a, 0x06, 0xc7, 0x34, 0xed,
-  0xe0, 0xf3, 0x01, 0xf9, 0xe3, 0xfb, 0xdc, 0x0f, 0xf8, 0x0e, 0x32, 0xff,
-  0x0a, 0x06, 0x0f, 0x28, 0xeb, 0x34, 0x28, 0xf2, 0xef, 0x12, 0xc8, 0xf5,
-  0x0d, 0xc9, 0xb4, 0x0c, 0x2a, 0x34, 0x26, 0x00, 0x02, 0x06, 0x20, 0x01,
-  0x26, 0xe1, 0xfb, 0x3e, 0xab, 0x0a, 0x0c, 0xa7, 0x9d, 0xd6, 0x4b, 0xba,
-  0xce, 0xff, 0x15, 0xda, 0x27, 0x09, 0x14, 0xec, 0x02, 0xf4, 0x37, 0xbf,
-  0x26, 0xed, 0x55, 0xf5, 0xf2, 0xe2, 0xe7, 0x05, 0x22, 0x4f, 0xfe, 0x4e,
-  0x46, 0x1b, 0xd0, 0xc3, 0xff, 0xd3, 0xf3, 0xd9, 0xf4, 0xeb, 0x00, 0x05,
-  0x13, 0xf1, 0xd5, 0xb8, 0x34, 0x03, 0x38, 0xcc, 0x42, 0xd8, 0xb3, 0xa6,
-  0x3b, 0x1a, 0x2f, 0xcf, 0x02, 0xea, 0xf9, 0x07, 0x2d, 0x2c, 0x05, 0x0b,
-  0xbb, 0xc6, 0x9b, 0x25, 0x00, 0x12, 0x30, 0x10, 0x14, 0x3e, 0xea, 0x04,
-  0x2d, 0xe9, 0xd9, 0x7f, 0x0a, 0xff, 0xd2, 0x55, 0xaf, 0xf6, 0xc1, 0xf7,
-  0x36, 0x2f, 0x03, 0x10, 0xfa, 0xb9, 0x0f, 0xd9, 0xa3, 0x0f, 0x26, 0x1f,
-  0xf7, 0x04, 0xf1, 0x21, 0xb5, 0xe6, 0xcf, 0x34, 0x4e, 0x36, 0x2f, 0x03,
-  0xf2, 0x4c, 0x0c, 0x14, 0x46, 0xd8, 0xf6, 0xe8, 0x3c, 0x2b, 0x2d, 0xc7,
-  0x57, 0xf5, 0x3e, 0xdb, 0x63, 0xe9, 0x16, 0x17, 0x00, 0xdf, 0xeb, 0xf5,
-  0xe7, 0x0a, 0x34, 0xff, 0xe5, 0xeb, 0xe8, 0xd0, 0x24, 0xc8, 0xe3, 0x71,
-  0xea, 0xce, 0x16, 0xd0, 0x97, 0x57, 0xf2, 0xb8, 0x0d, 0x1d, 0xd9, 0xf6,
-  0x0a, 0x3f, 0xfc, 0x02, 0xd3, 0xd3, 0x04, 0x69, 0xdf, 0x6e, 0x6a, 0xd7,
-  0xf3, 0x28, 0xf6, 0x0d, 0xf4, 0x11, 0xdf, 0x06, 0xe5, 0x26, 0x16, 0x05,
-  0xd3, 0xe3, 0x0a, 0x09, 0x23, 0x3a, 0x70, 0x02, 0xed, 0xf8, 0xe3, 0x2f,
-  0xc9, 0x2a, 0xcd, 0xfc, 0xf7, 0x81, 0x24, 0x02, 0xc2, 0xc2, 0x19, 0xe0,
-  0xaa, 0xfa, 0xfb, 0x28, 0x48, 0x3f, 0x04, 0xdf, 0x52, 0x1b, 0x12, 0xb8,
-  0x3e, 0xcd, 0xe7, 0x16, 0xd3, 0x0b, 0xb0, 0xf6, 0x59, 0xac, 0xe7, 0x74,
-  0xc4, 0x7c, 0x0a, 0xff, 0xd5, 0x54, 0x15, 0xe7, 0xfd, 0xf1, 0x19, 0x14,
-  0x27, 0xd1, 0x18, 0x18, 0xfb, 0xd9, 0xcd, 0xe6, 0xed, 0xe6, 0x1a, 0x15,
-  0x11, 0xa8, 0x19, 0xfe, 0x31, 0xaa, 0x54, 0xf7, 0x1d, 0x96, 0xfd, 0x44,
-  0xf7, 0x01, 0xbf, 0x2f, 0x46, 0x17, 0x55, 0xd2, 0x12, 0xb2, 0x28, 0xc7,
-  0x1e, 0x08, 0xdc, 0x47, 0x52, 0x53, 0xf4, 0xe0, 0xfa, 0x08, 0xa5, 0x0e,
-  0xff, 0x38, 0x1d, 0xb4, 0xe1, 0xb4, 0x1b, 0x1b, 0xd1, 0xdf, 0x20, 0x27,
-  0x8c, 0xca, 0xd1, 0xe4, 0x5c, 0x1c, 0xec, 0xc3, 0x45, 0xda, 0x2c, 0x10,
-  0x68, 0x1a, 0xd5, 0xda, 0xa4, 0xe0, 0xa7, 0xed, 0xcc, 0xa3, 0xe2, 0xef,
-  0xe4, 0xbe, 0x47, 0x27, 0xe8, 0xfd, 0x3a, 0xe2, 0x58, 0xd2, 0xe4, 0xe1,
-  0xfc, 0xcd, 0x3f, 0x6d, 0xb3, 0x03, 0x09, 0x7f, 0xf6, 0xf8, 0x30, 0x2d,
-  0xd5, 0x26, 0x40, 0x02, 0xc0, 0x26, 0xc1, 0x1b, 0xee, 0xbe, 0xce, 0x1e,
-  0x3e, 0x1a, 0x16, 0x0e, 0x2c, 0x2a, 0x02, 0xe0, 0xd7, 0xb7, 0x58, 0xf2,
-  0xd2, 0x2f, 0x0c, 0xf1, 0x0f, 0xf7, 0x2e, 0xe4, 0x2f, 0x13, 0xea, 0x29,
-  0xd2, 0x13, 0xbb, 0x24, 0xf8, 0x25, 0x39, 0x24, 0x4b, 0xb5, 0x8c, 0xd9,
-  0x3a, 0xd6, 0xf8, 0x9c, 0x18, 0xf8, 0xdd, 0xe9, 0xd9, 0x0c, 0xf3, 0x59,
-  0xf1, 0x44, 0x17, 0x53, 0xe8, 0xf8, 0x55, 0xad, 0x3a, 0xbf, 0xb5, 0x27,
-  0xf5, 0x34, 0x4e, 0x01, 0x43, 0x5d, 0xfe, 0xfd, 0x47, 0xf7, 0xf7, 0xc6,
-  0x8d, 0xf9, 0x7f, 0x0a, 0x1b, 0xdf, 0x1e, 0x1f, 0xb3, 0xb8, 0x1f, 0xcd,
-  0x07, 0xff, 0xf7, 0xda, 0x56, 0xda, 0xa9, 0x06, 0xfc, 0x21, 0xee, 0xfb,
-  0x15, 0x88, 0xf2, 0x44, 0xef, 0x00, 0x3a, 0x1f, 0x0b, 0x1a, 0x38, 0xc1,
-  0x4a, 0x0e, 0xe1, 0xef, 0xe4, 0x3d, 0xd9, 0x04, 0x26, 0xe3, 0xe1, 0x2c,
-  0x69, 0xe7, 0x47, 0x13, 0x2b, 0x3c, 0xfe, 0x30, 0xb6, 0x4d, 0xd2, 0xce,
-  0xfe, 0xec, 0xf4, 0xe0, 0xf2, 0xcd, 0x3b, 0xfa, 0xc0, 0xf2, 0xf1, 0xff,
-  0xd4, 0xe1, 0xb5, 0xe9, 0x13, 0xdf, 0xd3, 0x1e, 0xfa, 0xa8, 0x30, 0xde,
-  0xb6, 0xfb, 0xf9, 0x2b, 0x56, 0x2a, 0x01, 0x15, 0xd3, 0xc3, 0x08, 0xc8,
-  0x30, 0x0a, 0xcf, 0x26, 0x1b, 0x20, 0x3e, 0xdc, 0x68, 0x66, 0x14, 0x16,
-  0x3e, 0x08, 0xdc, 0xd0, 0x1d, 0x54, 0xdf, 0x40, 0x25, 0xcb, 0x70, 0x34,
-  0xef, 0xfd, 0x9b, 0x35, 0xea, 0xeb, 0x1f, 0x92, 0x50, 0xe2, 0x6e, 0xb5,
-  0x6b, 0xc1, 0xc7, 0xff, 0x1f, 0xe0, 0xe3, 0x0a, 0x4d, 0x0b, 0x4a, 0x1c,
-  0x10, 0xd0, 0x1e, 0x7f, 0xeb, 0x2c, 0xe3, 0x20, 0xf8, 0xf6, 0x0b, 0xeb,
-  0x35, 0xd6, 0x79, 0x63, 0xeb, 0xd4, 0xec, 0xdc, 0x0e, 0x36, 0x1f, 0xee,
-  0xe2, 0xd9, 0xf6, 0x0f, 0xd2, 0x31, 0x2f, 0xfa, 0xe8, 0x5b, 0xfd, 0x0e,
-  0x1f, 0xd7, 0x0f, 0x19, 0x3a, 0xa9, 0xcf, 0xa1, 0xce, 0x3d, 0x46, 0xfb,
-  0x0e, 0x48, 0xd6, 0x0f, 0x0f, 0x44, 0x51, 0x2d, 0x3c, 0xe3, 0xf2, 0x11,
-  0x38, 0x65, 0x0d, 0x13, 0x54, 0x55, 0xb7, 0x87, 0x28, 0x10, 0xed, 0x01,
-  0xc0, 0xe0, 0x1c, 0x49, 0x10, 0x00, 0xd5, 0xdb, 0xc6, 0xbb, 0xef, 0x06,
-  0xf5, 0xfc, 0x64, 0xbb, 0x11, 0x34, 0x15, 0x19, 0x2b, 0xfc, 0x2c, 0x2c,
-  0xdf, 0x30, 0x00, 0xc2, 0x6f, 0x17, 0x50, 0x2d, 0xbb, 0x27, 0x37, 0x00,
-  0xf7, 0xf1, 0xeb, 0x29, 0x38, 0xef, 0xcd, 0x17, 0x44, 0x56, 0x86, 0xcc,
-  0xf3, 0x25, 0x3c, 0x33, 0x31, 0xf4, 0xfb, 0xc7, 0x18, 0xe9, 0x5e, 0xdd,
-  0xaf, 0x34, 0xc4, 0xc9, 0x3a, 0xe9, 0xfc, 0x44, 0x33, 0xd7, 0x10, 0xbf,
-  0x9f, 0x76, 0x18, 0x36, 0x13, 0x81, 0x68, 0xd4, 0xf9, 0xbb, 0xf9, 0xe7,
-  0x0b, 0xc0, 0xc3, 0x45, 0x67, 0x21, 0x0f, 0x05, 0x3f, 0x3d, 0x9c, 0xd3,
-  0xd8, 0x2b, 0xae, 0xdb, 0x57, 0xe9, 0x1d, 0x20, 0x04, 0xd1, 0x3d, 0xc2,
-  0x1b, 0x07, 0xb0, 0x4c, 0x75, 0x0a, 0x48, 0xd6, 0x30, 0x16, 0xe0, 0x4a,
-  0xbb, 0xb5, 0xc9, 0x04, 0x08, 0xf9, 0xf9, 0x30, 0x37, 0x13, 0xc2, 0xc2,
-  0xed, 0x2b, 0xe8, 0xee, 0x16, 0xd8, 0xdb, 0xcf, 0x01, 0x02, 0xcd, 0x2c,
-  0xdf, 0x2e, 0x19, 0x25, 0x21, 0x12, 0xff, 0x1c, 0xee, 0x47, 0x08, 0xea,
-  0xfd, 0xdd, 0x3c, 0x00, 0xcf, 0xfc, 0xde, 0x12, 0x0b, 0x54, 0x22, 0xfc,
-  0x38, 0xc7, 0xb0, 0xe7, 0xe6, 0xed, 0x6e, 0x81, 0xef, 0x31, 0xf4, 0x0f,
-  0xec, 0x44, 0xd8, 0x0c, 0xf9, 0xee, 0xeb, 0xe2, 0x29, 0x4f, 0xeb, 0xff,
-  0xdb, 0x02, 0x35, 0xe3, 0x82, 0x37, 0xe3, 0x2e, 0xd4, 0x21, 0xd2, 0x8d,
-  0x46, 0x0a, 0xfa, 0xd8, 0xdc, 0x55, 0x20, 0xb3, 0x0f, 0x08, 0x15, 0xec,
-  0x14, 0xf4, 0x4b, 0x17, 0xfe, 0xcd, 0x26, 0x26, 0xcb, 0x42, 0xed, 0x0d,
-  0xc6, 0xfa, 0xfb, 0xdd, 0xf0, 0x5e, 0x5b, 0x17, 0x35, 0xd7, 0xf5, 0x12,
-  0x95, 0xd4, 0x2a, 0x49, 0xee, 0xf3, 0x13, 0x29, 0x34, 0x28, 0x2b, 0x05,
-  0x3b, 0x19, 0x09, 0x14, 0x28, 0x4b, 0x1d, 0x23, 0x23, 0x18, 0xee, 0xe4,
-  0xf5, 0xb9, 0x29, 0x05, 0x3a, 0xf9, 0x16, 0x3a, 0xcb, 0x0e, 0xe9, 0xf5,
-  0xf7, 0xbe, 0x57, 0xe3, 0xc2, 0x1d, 0xec, 0xe2, 0xf8, 0xaa, 0xbd, 0x07,
-  0x23, 0xde, 0x51, 0x0a, 0xe0, 0x05, 0xee, 0xf3, 0x09, 0xff, 0xe2, 0xeb,
-  0xf6, 0xd0, 0xc7, 0xcb, 0x2b, 0x1b, 0xfb, 0x32, 0xf9, 0x17, 0x10, 0xf5,
-  0x18, 0xcc, 0xc9, 0xf9, 0xef, 0x13, 0xcb, 0xeb, 0x32, 0xcc, 0x12, 0x03,
-  0xc3, 0x01, 0xc7, 0x40, 0xc3, 0x18, 0x31, 0x10, 0xf5, 0xd4, 0x04, 0x41,
-  0x21, 0xef, 0xec, 0x19, 0x27, 0xcf, 0xf6, 0x45, 0xf2, 0x81, 0x5d, 0xfe,
-  0x11, 0x1e, 0xed, 0xf7, 0xd5, 0x15, 0x1b, 0x46, 0xe3, 0xd2, 0x1b, 0x27,
-  0x41, 0xfc, 0x41, 0xd6, 0xe0, 0x11, 0xe6, 0x0a, 0x20, 0xe8, 0x11, 0xeb,
-  0x2e, 0xec, 0x08, 0xf8, 0xd0, 0x54, 0x27, 0x1a, 0x06, 0x07, 0xc7, 0xef,
-  0xea, 0x0b, 0x06, 0xcd, 0x31, 0x13, 0xd9, 0x30, 0xf7, 0x39, 0xe3, 0x1c,
-  0xd9, 0x09, 0xf4, 0xed, 0xbc, 0x24, 0x24, 0x26, 0xd5, 0xe8, 0xda, 0x1c,
-  0xfd, 0xcd, 0x00, 0x1d, 0xd3, 0x06, 0x02, 0xfe, 0x3f, 0xd2, 0x08, 0xcf,
-  0x01, 0xf4, 0xcd, 0x22, 0xc5, 0x1f, 0x3e, 0x02, 0xb5, 0x0d, 0x33, 0x1f,
-  0x37, 0x1d, 0x06, 0x06, 0xd6, 0xc0, 0x2e, 0xe8, 0xb2, 0x21, 0x16, 0xf6,
-  0x3f, 0xe1, 0xff, 0x02, 0x0a, 0x1d, 0xca, 0xee, 0xd0, 0x46, 0x81, 0xe4,
-  0x08, 0x05, 0xe1, 0xf2, 0x18, 0xd8, 0xbc, 0xf2, 0xf6, 0x1f, 0xe4, 0x07,
-  0xf6, 0x39, 0xc2, 0xb8, 0xc3, 0xe3, 0x02, 0x0e, 0x11, 0xf8, 0x31, 0x04,
-  0xb3, 0x08, 0x1a, 0xf2, 0x23, 0xcc, 0xcc, 0xe2, 0x1d, 0xe8, 0x2a, 0x0c,
-  0x00, 0x03, 0xec, 0xda, 0x1b, 0xf7, 0x0e, 0xf9, 0x2f, 0x33, 0xbf, 0x02,
-  0xea, 0x4d, 0x1d, 0x7b, 0x07, 0x10, 0xe6, 0xe5, 0x2e, 0x25, 0x16, 0x22,
-  0xdb, 0x4e, 0x9a, 0x4e, 0xf3, 0xe9, 0xc7, 0xf0, 0xe6, 0x35, 0xc9, 0x0d,
-  0xaa, 0x13, 0x14, 0x09, 0x05, 0xff, 0x4c, 0x2b, 0xd2, 0x4c, 0x2e, 0x7f,
-  0xbd, 0xe8, 0xba, 0xcf, 0x2e, 0xaf, 0xcd, 0x15, 0xeb, 0x14, 0x0e, 0x3e,
-  0xf0, 0x4f, 0x00, 0x1c, 0xbb, 0xfd, 0xae, 0x1c, 0x1c, 0x3e, 0x01, 0x25,
-  0xbb, 0xd2, 0xeb, 0xe7, 0xd7, 0x2d, 0x36, 0xcd, 0x20, 0x37, 0xf7, 0x2f,
-  0x0d, 0x06, 0x60, 0xcf, 0x44, 0x2e, 0xf8, 0x32, 0xa2, 0xf3, 0xd2, 0x08,
-  0xc4, 0x20, 0x21, 0xea, 0x35, 0xb2, 0xee, 0x06, 0x16, 0x17, 0xf5, 0xe5,
-  0x05, 0x8f, 0x03, 0x17, 0xf5, 0xe1, 0x45, 0x12, 0x27, 0xc2, 0xf0, 0xc8,
-  0xdc, 0x06, 0xd7, 0xdc, 0xec, 0xdd, 0x2d, 0xfc, 0xf0, 0x18, 0x25, 0x5b,
-  0xa0, 0xfc, 0x1f, 0xf7, 0xd2, 0x19, 0x16, 0xa4, 0xfc, 0x1f, 0x43, 0xe0,
-  0x17, 0xcf, 0xf9, 0x0b, 0xcf, 0x81, 0x3e, 0xd3, 0x0e, 0x22, 0xf3, 0x3a,
-  0xf8, 0x20, 0xd6, 0x06, 0x09, 0x26, 0xf6, 0x24, 0x0a, 0x11, 0xeb, 0x04,
-  0x48, 0x19, 0xda, 0x9c, 0x60, 0x43, 0xde, 0xee, 0x42, 0xb5, 0x18, 0x25,
-  0x1e, 0x21, 0x27, 0x56, 0xcb, 0x67, 0xec, 0xf6, 0x40, 0xfa, 0xfb, 0x06,
-  0x73, 0xb3, 0x06, 0xf2, 0x0e, 0xed, 0x77, 0xcb, 0x55, 0x1d, 0xaf, 0xea,
-  0xe0, 0x1a, 0x16, 0xc8, 0xd3, 0x2c, 0xf7, 0x4f, 0x0f, 0x45, 0xb5, 0x0f,
-  0x2d, 0xe7, 0x0f, 0xba, 0x90, 0xa8, 0x34, 0x33, 0x1c, 0xd4, 0xc9, 0xea,
-  0xf6, 0xa7, 0xe0, 0xe8, 0xf1, 0x28, 0x3a, 0x17, 0xff, 0xe3, 0xde, 0x04,
-  0xf4, 0x1f, 0xf9, 0x14, 0xf4, 0x0a, 0xb2, 0x16, 0xe9, 0xf8, 0xeb, 0x11,
-  0x38, 0x05, 0x31, 0xf9, 0x38, 0xe7, 0xdc, 0x69, 0x40, 0xf3, 0x13, 0x39,
-  0xcf, 0xc7, 0xe8, 0x29, 0x06, 0x3c, 0x1a, 0xe5, 0xf5, 0x10, 0xc7, 0xf2,
-  0xb2, 0xfd, 0xd9, 0x34, 0xec, 0x26, 0x81, 0xdc, 0xb2, 0x09, 0x68, 0x1a,
-  0x34, 0xd6, 0x17, 0x0e, 0x1b, 0xfb, 0xd3, 0x2c, 0xdf, 0x3b, 0x28, 0x18,
-  0x00, 0x28, 0x16, 0xdb, 0x3d, 0xf3, 0x47, 0xe4, 0xba, 0xe3, 0xf9, 0x01,
-  0xbb, 0x24, 0xeb, 0x56, 0x0e, 0xd6, 0xf1, 0x15, 0xfa, 0x5f, 0xe6, 0xfe,
-  0x23, 0x2b, 0x26, 0x0d, 0x0b, 0x2b, 0xe8, 0x2f, 0xe4, 0xdd, 0xb3, 0x17,
-  0x30, 0x3f, 0xd6, 0x02, 0x03, 0xfa, 0x36, 0xe4, 0x01, 0xb6, 0xf5, 0x34,
-  0xe5, 0x0f, 0xe5, 0xfb, 0x1c, 0xed, 0xfc, 0x60, 0x94, 0xe3, 0xff, 0x3e,
-  0xe5, 0xda, 0xf8, 0x1e, 0x09, 0xfd, 0x3f, 0xf9, 0x1f, 0xea, 0x0d, 0x22,
-  0x35, 0xee, 0xb6, 0xe3, 0xeb, 0xfd, 0xf6, 0x46, 0x32, 0x39, 0x16, 0xef,
-  0x32, 0x00, 0x07, 0xf8, 0xff, 0xda, 0x9e, 0x43, 0xd1, 0x00, 0xe7, 0x83,
-  0x0c, 0xc7, 0xd2, 0xdd, 0xfc, 0xef, 0x34, 0xa9, 0x07, 0x94, 0xde, 0xe7,
-  0x95, 0x36, 0x0e, 0x24, 0xae, 0xf7, 0xc2, 0xeb, 0xe9, 0x2c, 0xf0, 0xe2,
-  0xc8, 0x2f, 0xf7, 0x04, 0x2e, 0xe7, 0x3a, 0xef, 0x03, 0x12, 0xc3, 0x76,
-  0xe1, 0x3b, 0x1f, 0xb1, 0xce, 0xd1, 0x37, 0x17, 0x5c, 0xbd, 0xfe, 0xc2,
-  0xcf, 0xd8, 0x11, 0xe1, 0x0b, 0xb3, 0xc1, 0x45, 0xe4, 0xe8, 0xfb, 0xfe,
-  0xdc, 0xe6, 0x3e, 0xe8, 0xeb, 0xef, 0xe7, 0x2d, 0xf3, 0xea, 0x15, 0xbc,
-  0x2c, 0xc2, 0xfe, 0x40, 0xfc, 0xd9, 0x0a, 0x23, 0x0b, 0x1d, 0xb2, 0xed,
-  0xe5, 0xe7, 0xf5, 0xc9, 0xe4, 0xaf, 0x22, 0xdf, 0xf1, 0xf5, 0x15, 0x21,
-  0xc6, 0x7f, 0x00, 0x1b, 0xc6, 0xc4, 0x37, 0x30, 0x06, 0xc9, 0x20, 0xd7,
-  0x2f, 0xfe, 0xd4, 0x0c, 0xe9, 0xf4, 0xdb, 0x0e, 0xce, 0x08, 0x15, 0xd0,
-  0x21, 0xe6, 0x45, 0xab, 0x24, 0x15, 0x31, 0xf7, 0xe0, 0x3b, 0x1f, 0x20,
-  0x17, 0xdf, 0xfb, 0xd5, 0xc9, 0x10, 0x14, 0xde, 0xdd, 0xc8, 0xfb, 0x68,
-  0xbb, 0x9e, 0xcd, 0xf1, 0xb7, 0x53, 0x16, 0x2a, 0x1d, 0x2b, 0x0b, 0xbe,
-  0xf7, 0x36, 0xed, 0x25, 0xe8, 0xd6, 0x17, 0x47, 0xc9, 0x38, 0x0d, 0xe3,
-  0xff, 0xf0, 0xee, 0xcf, 0x2e, 0x26, 0x09, 0x06, 0x00, 0x0b, 0x11, 0x42,
-  0xc3, 0xfc, 0x12, 0xef, 0x17, 0x3b, 0x6e, 0xdf, 0x04, 0x0f, 0xe8, 0xe3,
-  0x81, 0x4f, 0x14, 0xb0, 0x32, 0xa8, 0x32, 0xa5, 0x42, 0x41, 0x17, 0xe2,
-  0xfb, 0x38, 0xdb, 0xfb, 0xe0, 0x36, 0xb6, 0x1f, 0x4e, 0xfa, 0x19, 0xba,
-  0x4f, 0xde, 0xa1, 0xc6, 0xd1, 0x67, 0xca, 0xcb, 0x39, 0xbf, 0xe7, 0x29,
-  0x07, 0x19, 0x32, 0x05, 0xd7, 0x2d, 0x5f, 0xe3, 0xf5, 0xeb, 0x2e, 0x48,
-  0x42, 0x01, 0xee, 0x1d, 0x29, 0xe7, 0xbd, 0xd1, 0x38, 0x1f, 0x28, 0x12,
-  0x35, 0x12, 0x57, 0x09, 0x0f, 0xaf, 0xdd, 0x4b, 0xc5, 0x3b, 0x29, 0xe8,
-  0x52, 0x22, 0x53, 0xdc, 0xe3, 0xe6, 0xb1, 0x29, 0xba, 0xb4, 0xf9, 0x14,
-  0xb5, 0x42, 0x31, 0xc7, 0x70, 0x65, 0x01, 0x13, 0x14, 0x2f, 0xf1, 0x03,
-  0x03, 0x26, 0xe1, 0x26, 0x17, 0xfa, 0x30, 0x10, 0x3a, 0x2e, 0x1a, 0xeb,
-  0xf1, 0x19, 0x52, 0xbc, 0x0c, 0x08, 0x3b, 0xed, 0x9d, 0xe3, 0x50, 0xc8,
-  0x11, 0xf3, 0x0c, 0xd6, 0x3d, 0x16, 0x42, 0x7f, 0x0f, 0x32, 0x12, 0x18,
-  0xf6, 0xf1, 0xa5, 0x15, 0x0f, 0x2e, 0x29, 0xdd, 0x38, 0xda, 0x0c, 0x42,
-  0xa9, 0xd8, 0xee, 0x3a, 0xee, 0xee, 0x76, 0x07, 0x09, 0x24, 0xc8, 0xac,
-  0x19, 0x0d, 0x28, 0x09, 0x0a, 0xed, 0x0f, 0x07, 0x1f, 0xf7, 0x1c, 0x56,
-  0xe4, 0x30, 0x26, 0x0a, 0x94, 0xf8, 0xe7, 0x05, 0x45, 0x1e, 0xd3, 0xf2,
-  0x4c, 0xe3, 0xd4, 0xf4, 0xf7, 0x10, 0xea, 0x20, 0x17, 0x14, 0xf3, 0x24,
-  0x0c, 0xa6, 0xc5, 0xf1, 0xcd, 0x39, 0xc2, 0x29, 0x1d, 0x33, 0x33, 0x50,
-  0xea, 0x43, 0xeb, 0xdb, 0x1e, 0x43, 0xb5, 0x2d, 0xd3, 0xfc, 0x19, 0x27,
-  0x31, 0xeb, 0x07, 0x30, 0x31, 0x01, 0x91, 0xd2, 0xfc, 0x10, 0x29, 0xe5,
-  0xbe, 0x21, 0x0c, 0x36, 0xf0, 0xf4, 0xfe, 0xfd, 0xc9, 0xfb, 0x3b, 0xf3,
-  0x4b, 0xd1, 0xfa, 0xf8, 0x37, 0x22, 0x1f, 0xbd, 0x1f, 0xb6, 0xd6, 0x04,
-  0x23, 0xfc, 0xdd, 0xd1, 0x0c, 0xfd, 0x32, 0x2e, 0xe8, 0x1e, 0xf4, 0x24,
-  0x39, 0x08, 0xab, 0x26, 0xfb, 0x94, 0x33, 0xdb, 0x17, 0x00, 0xc4, 0xfd,
-  0x1b, 0x32, 0xe5, 0x94, 0x7f, 0x0f, 0x11, 0xf5, 0xd4, 0xfd, 0xfc, 0xe6,
-  0x08, 0x12, 0xd9, 0xfd, 0x0d, 0x03, 0x39, 0xfe, 0x0f, 0x02, 0xff, 0xcf,
-  0xf2, 0x04, 0x09, 0xe0, 0x2f, 0x2d, 0xf1, 0x03, 0x26, 0x37, 0xef, 0x95,
-  0xc3, 0x00, 0x46, 0x15, 0x16, 0x9f, 0xe4, 0xf5, 0xf5, 0xe8, 0x37, 0xfe,
-  0x35, 0x51, 0xbd, 0x64, 0x0b, 0xe0, 0x21, 0xca, 0x2c, 0x09, 0xe0, 0xde,
-  0x02, 0xfb, 0x3d, 0xe3, 0xc0, 0x0c, 0xda, 0x68, 0xf7, 0x26, 0x00, 0x12,
-  0xce, 0x0d, 0xc3, 0xd4, 0x18, 0xfa, 0xe1, 0xc1, 0xfd, 0xfc, 0xc2, 0xc5,
-  0x21, 0x36, 0xd8, 0xc2, 0x02, 0x09, 0x16, 0x24, 0xe1, 0x51, 0xe8, 0x3f,
-  0xaa, 0xbd, 0x35, 0x40, 0x20, 0xcc, 0xc2, 0xf3, 0xec, 0x15, 0xb1, 0x39,
-  0xe1, 0x42, 0xe3, 0xc4, 0x08, 0x37, 0xbb, 0xef, 0xeb, 0x37, 0xec, 0xb9,
-  0x4b, 0xe1, 0xf8, 0x29, 0xe0, 0x0d, 0xd7, 0x7f, 0x14, 0xf3, 0xf8, 0x0f,
-  0xcb, 0xb0, 0x2d, 0x24, 0xd4, 0xef, 0x52, 0x1e, 0x25, 0xf7, 0xb7, 0x06,
-  0xc4, 0xda, 0xa2, 0x36, 0xf9, 0x10, 0xde, 0xd8, 0x3d, 0x3b, 0x3a, 0xf6,
-  0xea, 0x16, 0xed, 0x01, 0x13, 0x29, 0xe1, 0xfc, 0xbb, 0xdd, 0x05, 0x36,
-  0x37, 0x46, 0x2f, 0xf4, 0xca, 0x1a, 0x42, 0xcd, 0x0b, 0x02, 0x20, 0xc8,
-  0x05, 0xe2, 0x1d, 0x7f, 0x2c, 0x0e, 0xfc, 0x2f, 0xfb, 0xfa, 0x33, 0xf3,
-  0x44, 0x1d, 0xf0, 0xf6, 0x39, 0xb8, 0xb0, 0x19, 0xfc, 0x50, 0x0b, 0x4f,
-  0x17, 0x04, 0xf0, 0xcf, 0xd1, 0x3c, 0xc0, 0xd3, 0x2b, 0xdd, 0x33, 0xa0,
-  0x41, 0x0c, 0xed, 0x23, 0x31, 0xed, 0xf6, 0x46, 0x5c, 0xd4, 0x4a, 0x19,
-  0xc8, 0x1d, 0xc6, 0x32, 0xef, 0x67, 0x2d, 0xf5, 0xce, 0x12, 0x2a, 0x49,
-  0x0b, 0x1b, 0x34, 0x56, 0xe8, 0x10, 0x02, 0xc6, 0x49, 0xed, 0xf6, 0x35,
-  0xb6, 0xd8, 0xcb, 0xe2, 0x18, 0xd0, 0xec, 0x43, 0xe0, 0x0d, 0xce, 0x2a,
-  0x32, 0x9f, 0xc7, 0x22, 0xee, 0xd5, 0xf6, 0xf3, 0x42, 0x2e, 0xa3, 0xe0,
-  0x23, 0x02, 0xcd, 0x0b, 0x05, 0x19, 0xf1, 0xfc, 0x04, 0x33, 0xfd, 0x25,
-  0x07, 0x05, 0xca, 0xbb, 0x11, 0xca, 0x64, 0xfb, 0xe5, 0xe4, 0x4f, 0xe7,
-  0x0e, 0x0a, 0x42, 0x26, 0xc7, 0x29, 0x50, 0xfe, 0xbb, 0x2b, 0xf1, 0xd1,
-  0x0e, 0x4c, 0xfc, 0x28, 0x01, 0xb8, 0xf7, 0xef, 0x43, 0x23, 0xb6, 0x3d,
-  0xfd, 0x61, 0xab, 0x38, 0x25, 0xb3, 0x25, 0xe6, 0x0c, 0x54, 0xdd, 0x38,
-  0x12, 0xd6, 0xeb, 0x23, 0x1d, 0xe7, 0xfb, 0x21, 0x0f, 0xe1, 0x60, 0xce,
-  0x9e, 0x7f, 0x1d, 0x4c, 0x69, 0xad, 0x10, 0xfc, 0x04, 0x0f, 0x75, 0x40,
-  0x1b, 0x2b, 0xa7, 0xa4, 0xdd, 0xf8, 0x17, 0xb1, 0xd9, 0xc7, 0x4c, 0xa5,
-  0x18, 0x25, 0x1b, 0xef, 0x11, 0x36, 0xd9, 0xf7, 0xf3, 0x18, 0xc3, 0x22,
-  0xfd, 0xc6, 0x40, 0x0b, 0x39, 0xc5, 0xf2, 0xff, 0xe1, 0x10, 0xf3, 0x38,
-  0x03, 0x39, 0x0e, 0x1a, 0x22, 0xf6, 0xc0, 0x3b, 0x2d, 0x41, 0x15, 0xc8,
-  0x17, 0x24, 0xe3, 0x1f, 0x2e, 0x10, 0x21, 0x1a, 0x02, 0x22, 0xd2, 0xf0,
-  0xec, 0x89, 0x8c, 0xd6, 0xba, 0x26, 0xf6, 0x88, 0xbc, 0xff, 0xd0, 0xbd,
-  0x47, 0xe9, 0x5c, 0xef, 0xe7, 0xd1, 0xe4, 0xed, 0xde, 0xf7, 0x2a, 0xf0,
-  0xd5, 0x0c, 0x28, 0xe6, 0x47, 0x0e, 0xe8, 0x3a, 0xaf, 0x0d, 0x06, 0xff,
-  0x34, 0x06, 0xfa, 0xfa, 0x49, 0x0d, 0x89, 0x70, 0x22, 0x46, 0x33, 0xf5,
-  0x4a, 0x9c, 0xee, 0xce, 0x7b, 0xf7, 0xd1, 0xfa, 0xd9, 0xc2, 0x03, 0x16,
-  0x30, 0xee, 0xae, 0x06, 0xd5, 0xde, 0xcc, 0x32, 0xef, 0xe9, 0x0a, 0xd8,
-  0x9f, 0xb8, 0x1b, 0x03, 0xa0, 0xc1, 0xd7, 0x9f, 0x09, 0xd3, 0x5c, 0x1a,
-  0x1b, 0x43, 0xcb, 0xda, 0x56, 0x13, 0xef, 0xd7, 0x3a, 0xbb, 0x14, 0x9f,
-  0xc3, 0xd7, 0x3d, 0x0e, 0xf5, 0x5e, 0x02, 0x1d, 0xb1, 0x7f, 0xd9, 0xf5,
-  0xca, 0xdc, 0x3a, 0x39, 0x0b, 0x8c, 0x39, 0xaa, 0x61, 0xee, 0xff, 0x25,
-  0xeb, 0xdb, 0xed, 0x25, 0xa0, 0xd5, 0x70, 0xc1, 0xc9, 0xff, 0xf3, 0x0c,
-  0x39, 0xd8, 0x26, 0x09, 0x48, 0xc4, 0xd8, 0x07, 0x05, 0xdc, 0xfb, 0x0c,
-  0x3f, 0x17, 0xf3, 0x2c, 0xed, 0x14, 0xe0, 0x24, 0x03, 0xff, 0xd4, 0x11,
-  0xdc, 0xf4, 0x4d, 0x86, 0x0e, 0x28, 0xe2, 0x02, 0xff, 0x15, 0xf5, 0x26,
-  0xfa, 0xc2, 0xf0, 0xf8, 0xc4, 0xf6, 0x07, 0x38, 0xf9, 0x06, 0x10, 0xfd,
-  0xc2, 0xff, 0x23, 0xcf, 0x35, 0xfd, 0x01, 0xcb, 0x59, 0xdc, 0xdf, 0x37,
-  0xc4, 0x0d, 0xe4, 0x10, 0x16, 0x30, 0x03, 0x1f, 0x04, 0x2b, 0x21, 0x45,
-  0xbe, 0x0f, 0x0f, 0x36, 0x22, 0xeb, 0xfd, 0xae, 0xbb, 0xa2, 0x57, 0x1c,
-  0x08, 0xce, 0xdf, 0xf7, 0x14, 0x26, 0x04, 0xab, 0x7f, 0x04, 0xf9, 0x1d,
-  0x00, 0xcc, 0xda, 0xd3, 0xe7, 0x21, 0xd3, 0x12, 0xcc, 0xee, 0x32, 0xfc,
-  0x0c, 0x09, 0xde, 0xe4, 0x0b, 0x27, 0x1a, 0x0f, 0x2b, 0x1d, 0xd1, 0x26,
-  0x22, 0x77, 0x1e, 0x9a, 0xd5, 0x04, 0x3a, 0xf1, 0x16, 0xf2, 0x12, 0x04,
-  0x00, 0xaa, 0x27, 0x04, 0x3c, 0x65, 0x2e, 0x5c, 0x81, 0xe7, 0xf7, 0xe8,
-  0x06, 0xdd, 0xdf, 0xdf, 0x35, 0x1e, 0x1a, 0xe2, 0x1d, 0x28, 0xf9, 0x10,
-  0x1c, 0xfe, 0xd6, 0x19, 0x11, 0x0c, 0x60, 0xe9, 0x1e, 0x19, 0x19, 0xcb,
-  0xec, 0xd2, 0xe7, 0xfa, 0xb0, 0xea, 0xd0, 0xb7, 0x0b, 0x19, 0xe7, 0xfa,
-  0x39, 0x09, 0x10, 0xfe, 0xc1, 0x2c, 0xd1, 0x18, 0x46, 0x01, 0xfd, 0xf0,
-  0xc3, 0x2e, 0x1a, 0x20, 0x25, 0x07, 0xcf, 0x67, 0xcb, 0xcc, 0xdd, 0xf6,
-  0xf3, 0x13, 0x04, 0x08, 0x46, 0xe6, 0xfb, 0xc7, 0xf0, 0xb6, 0xc6, 0x45,
-  0xb8, 0x10, 0x1c, 0x3d, 0x03, 0xf9, 0x24, 0xe1, 0x19, 0xca, 0xeb, 0xf6,
-  0x2b, 0xe1, 0xa2, 0xf1, 0x1f, 0xc7, 0xb0, 0x0f, 0x48, 0x38, 0x22, 0xf8,
-  0x3a, 0xe7, 0x17, 0xe1, 0xd7, 0xde, 0x55, 0x0d, 0x3d, 0x3c, 0xf0, 0x2b,
-  0x07, 0xc0, 0xc6, 0x5a, 0x39, 0x31, 0x1e, 0x01, 0x2b, 0xd7, 0xcd, 0xdc,
-  0x0a, 0xee, 0xd4, 0xca, 0xe4, 0x01, 0x23, 0x47, 0x3f, 0x56, 0xd6, 0xdf,
-  0xeb, 0x81, 0x9f, 0x03, 0xfc, 0x4a, 0x56, 0x11, 0x13, 0x3a, 0x33, 0x46,
-  0x11, 0x41, 0x0f, 0x17, 0x08, 0x37, 0xe3, 0xe9, 0xe3, 0x12, 0x18, 0x0d,
-  0x2b, 0x36, 0xf5, 0x18, 0xb9, 0x14, 0xf3, 0x00, 0xfa, 0xd8, 0xb6, 0xd3,
-  0x3c, 0x6e, 0xcc, 0xc3, 0xcb, 0x46, 0xf3, 0xa3, 0x4e, 0x20, 0x08, 0xf3,
-  0xd5, 0x0e, 0x20, 0xb8, 0x01, 0xc9, 0x44, 0x1c, 0x45, 0xc1, 0x1c, 0x07,
-  0x1f, 0xe3, 0xee, 0xac, 0x8f, 0x3a, 0x2d, 0xec, 0x0b, 0x19, 0x27, 0xc6,
-  0x31, 0x30, 0x4b, 0xd9, 0xdf, 0x13, 0xbe, 0x56, 0x07, 0x4e, 0xfc, 0x19,
-  0x2c, 0x11, 0xaa, 0x16, 0xf5, 0x06, 0xd8, 0xa4, 0x1c, 0xee, 0xf6, 0x4d,
-  0x1d, 0xc7, 0x39, 0x40, 0xff, 0xe7, 0xe5, 0x1e, 0x32, 0x5c, 0xce, 0xc6,
-  0xa7, 0x57, 0xf0, 0x49, 0xe0, 0x73, 0x58, 0xd0, 0x54, 0x17, 0xbe, 0x0b,
-  0xf9, 0xe0, 0x01, 0xd0, 0x14, 0xf3, 0xf0, 0xfe, 0x00, 0x31, 0xef, 0x0a,
-  0xd1, 0x17, 0xd6, 0xe5, 0x34, 0xd1, 0xd4, 0x4f, 0xd0, 0xba, 0x8f, 0xd8,
-  0x09, 0xa4, 0xdf, 0xe4, 0x43, 0x09, 0xff, 0x2f, 0x55, 0x3b, 0x01, 0xd9,
-  0x5d, 0xdd, 0x64, 0x00, 0xca, 0x10, 0x35, 0x21, 0xb4, 0xdd, 0x51, 0xa4,
-  0xfa, 0xd9, 0xee, 0xd2, 0x2d, 0xf5, 0xf7, 0xed, 0x35, 0x15, 0x7f, 0x76,
-  0x20, 0x03, 0xf0, 0x34, 0xb8, 0xf0, 0xb3, 0x92, 0x3e, 0x04, 0x3d, 0xd1,
-  0x21, 0x2d, 0x27, 0x26, 0xe4, 0xb4, 0x5d, 0xe3, 0x31, 0x60, 0x18, 0x1e,
-  0x0e, 0xe8, 0x22, 0x22, 0xca, 0xb0, 0x05, 0xb3, 0x4f, 0x2a, 0xea, 0x20,
-  0x30, 0x65, 0xf2, 0xeb, 0x3c, 0x0c, 0xef, 0xf9, 0x11, 0x01, 0x26, 0x20,
-  0xf4, 0xea, 0x23, 0x9c, 0xf1, 0x0a, 0xce, 0x29, 0x1b, 0x55, 0xdc, 0x26,
-  0x22, 0xfd, 0xd8, 0x0d, 0x1e, 0x1a, 0xf6, 0xf5, 0xeb, 0x5e, 0xfe, 0x14,
-  0xf3, 0xf4, 0x08, 0x02, 0x1a, 0x08, 0xf6, 0xf5, 0x19, 0xf0, 0x0d, 0x0e,
-  0x03, 0x37, 0xfe, 0xc1, 0x46, 0x04, 0xd6, 0x5a, 0xb0, 0x1c, 0xdb, 0x2e,
-  0xfe, 0xe6, 0xf2, 0x0a, 0xf2, 0x0b, 0xf3, 0x2d, 0xac, 0xda, 0x0b, 0x0a,
-  0xf9, 0x99, 0xca, 0x06, 0xde, 0x16, 0xde, 0xc5, 0x0a, 0x4e, 0x21, 0x04,
-  0xf8, 0xef, 0x3d, 0xc7, 0x17, 0xf3, 0x3a, 0xa5, 0xd0, 0x06, 0xdc, 0xf4,
-  0xd8, 0x81, 0x16, 0x13, 0xc9, 0x15, 0xec, 0xe4, 0xd4, 0x0e, 0x18, 0x08,
-  0x09, 0xfb, 0x00, 0xc9, 0xf9, 0xfb, 0x02, 0x1d, 0xfb, 0x20, 0x1a, 0x4b,
-  0x53, 0xca, 0xcf, 0xe4, 0x3d, 0xf7, 0xf1, 0x3a, 0xfa, 0x22, 0x21, 0xf4,
-  0x12, 0x33, 0xfd, 0x3a, 0xfd, 0x08, 0x35, 0x16, 0x32, 0xe5, 0xc8, 0xe5,
-  0x31, 0xd7, 0x13, 0x31, 0x82, 0xca, 0xa2, 0xe1, 0x12, 0xf2, 0xed, 0xd4,
-  0x43, 0x28, 0xe0, 0x13, 0xb5, 0xf1, 0xe5, 0x0c, 0x2b, 0x26, 0x35, 0x24,
-  0xf3, 0x04, 0xb5, 0xd2, 0xf1, 0x37, 0x1e, 0xfe, 0xe8, 0xa3, 0xf9, 0xe5,
-  0x0d, 0xef, 0xfd, 0xbf, 0x31, 0x31, 0xf4, 0x0a, 0xf3, 0xe5, 0x03, 0xe1,
-  0xba, 0xe7, 0xd8, 0x30, 0x81, 0xbb, 0xa6, 0xbc, 0xe2, 0xdf, 0x1c, 0x2b,
-  0xfa, 0x12, 0xec, 0x39, 0xf7, 0x2a, 0xfc, 0x57, 0xbd, 0xb9, 0x12, 0xd9,
-  0xd0, 0x4c, 0x09, 0x01, 0x18, 0x3a, 0x57, 0x02, 0x11, 0xc6, 0x47, 0x3c,
-  0xdc, 0xfe, 0xe7, 0xa4, 0x07, 0xfd, 0x2c, 0xc1, 0xe5, 0xd5, 0x09, 0xec,
-  0x4d, 0xec, 0x1d, 0x61, 0x21, 0xeb, 0x19, 0x21, 0xfc, 0xd9, 0xf5, 0x02,
-  0x01, 0x1f, 0xee, 0xfe, 0xc0, 0xf0, 0xb5, 0x33, 0xec, 0x02, 0xf9, 0xfd,
-  0x05, 0x07, 0xf7, 0x0e, 0x0b, 0xf7, 0x3c, 0xff, 0xec, 0x3b, 0x4c, 0xad,
-  0xde, 0x9f, 0xde, 0x17, 0xfc, 0x9a, 0x39, 0x64, 0xb0, 0x00, 0xff, 0xf6,
-  0xc7, 0xf8, 0xf4, 0xb0, 0x5b, 0x69, 0xde, 0xb9, 0x00, 0x51, 0xa8, 0x36,
-  0x02, 0xfd, 0x0b, 0xd2, 0xf3, 0xd6, 0xf4, 0x20, 0xcd, 0xdf, 0xfc, 0xb6,
-  0x7b, 0xbd, 0x3c, 0xf5, 0xd9, 0xf3, 0xeb, 0xd7, 0xce, 0x31, 0x35, 0x97,
-  0x05, 0xd8, 0xf7, 0xf9, 0x4d, 0x65, 0xd9, 0xf8, 0xad, 0x30, 0xd8, 0xff,
-  0x27, 0xc8, 0x18, 0xbc, 0x2d, 0x31, 0xd9, 0x07, 0x02, 0xca, 0x51, 0xe3,
-  0xf1, 0xdd, 0xdb, 0x41, 0x07, 0x45, 0x30, 0x0a, 0xf3, 0xbf, 0x04, 0x01,
-  0x1c, 0xc1, 0x2a, 0xfd, 0x09, 0x42, 0xc8, 0xd2, 0x68, 0xdd, 0xe0, 0xc6,
-  0xe0, 0x16, 0xc7, 0xd6, 0x18, 0xf7, 0x95, 0x2b, 0xb3, 0xd1, 0xe7, 0xd6,
-  0xd6, 0x15, 0xed, 0xc5, 0xd4, 0xf0, 0x34, 0xec, 0x1b, 0x25, 0x02, 0x26,
-  0xcf, 0x7f, 0x32, 0xb7, 0x2c, 0x03, 0xf7, 0xfd, 0xdd, 0xac, 0x1a, 0xee,
-  0xb6, 0x38, 0x47, 0xd8, 0xf1, 0xd2, 0x0d, 0x62, 0xe7, 0xf8, 0x3f, 0xd4,
-  0xc9, 0xe5, 0x08, 0x3a, 0x08, 0x0a, 0x39, 0xd5, 0xc4, 0x0a, 0x30, 0x4f,
-  0x43, 0xff, 0x06, 0xc3, 0x08, 0xf9, 0x31, 0x37, 0x16, 0x14, 0x1a, 0xc9,
-  0xfa, 0x22, 0xe3, 0xe1, 0x0f, 0xcf, 0x00, 0xf3, 0x18, 0x23, 0xc3, 0xf1,
-  0xd5, 0x1c, 0x0f, 0x11, 0xe4, 0xf0, 0xbc, 0xc5, 0xfa, 0xf9, 0xef, 0xe0,
-  0x1b, 0x23, 0xd2, 0x3e, 0xf2, 0xf3, 0xa3, 0x3e, 0xfd, 0x2c, 0xe9, 0x09,
-  0xbc, 0xf0, 0x06, 0x2a, 0xe9, 0xa6, 0x20, 0x0b, 0xea, 0xee, 0xeb, 0x34,
-  0xd4, 0x13, 0x07, 0x7f, 0xdd, 0xe2, 0xf3, 0x36, 0x2c, 0x05, 0x1f, 0x48,
-  0xdf, 0x2c, 0x29, 0x43, 0xef, 0xf7, 0xc9, 0xaa, 0x05, 0xd1, 0x95, 0x0e,
-  0xfb, 0x09, 0x0f, 0xb6, 0x0c, 0x0f, 0x05, 0xb5, 0x26, 0x2c, 0x18, 0x3a,
-  0x2d, 0x1e, 0x11, 0xd3, 0x51, 0xf0, 0x62, 0x2c, 0xa1, 0xef, 0x16, 0x2d,
-  0xe4, 0xb1, 0xeb, 0xb6, 0x0b, 0x0e, 0x19, 0xc7, 0x01, 0xb5, 0xd0, 0x51,
-  0xd1, 0xf8, 0xfd, 0x09, 0x97, 0x65, 0x47, 0xde, 0xf5, 0x4c, 0x07, 0x33,
-  0x11, 0x16, 0x30, 0x28, 0xde, 0xd6, 0x1d, 0x34, 0xda, 0x35, 0x27, 0x42,
-  0x27, 0x05, 0xcb, 0xbe, 0xfb, 0x36, 0x0f, 0x02, 0xec, 0x1d, 0x34, 0xeb,
-  0xcf, 0x06, 0x44, 0x00, 0x59, 0x1d, 0x4a, 0xea, 0x3f, 0x14, 0xf4, 0xef,
-  0xbb, 0x2a, 0xdd, 0xe5, 0x13, 0x9b, 0x12, 0xce, 0x0d, 0x03, 0xe1, 0xe1,
-  0xf0, 0xda, 0xe9, 0x16, 0x1b, 0x12, 0x04, 0xe4, 0x6a, 0x08, 0xff, 0xad,
-  0x7f, 0x02, 0x9e, 0xb6, 0xad, 0x28, 0xc8, 0xcf, 0x55, 0xcb, 0x34, 0x49,
-  0x44, 0x01, 0x42, 0x1b, 0xb0, 0x39, 0x0b, 0xef, 0xe4, 0xdc, 0x25, 0x21,
-  0x62, 0xf4, 0x03, 0x2e, 0x1a, 0xc1, 0xcd, 0x04, 0x0e, 0x33, 0x08, 0xbe,
-  0x5f, 0x0e, 0x4d, 0xf5, 0x0b, 0x27, 0xfa, 0x6d, 0xfb, 0x2e, 0xfe, 0x19,
-  0x34, 0x04, 0x30, 0xfb, 0x00, 0xf3, 0xcb, 0x17, 0x13, 0x48, 0xde, 0xf6,
-  0x07, 0x2a, 0xe0, 0xb7, 0xdd, 0xdc, 0x2b, 0x76, 0x08, 0x8b, 0xec, 0x30,
-  0x06, 0xb9, 0x05, 0x57, 0xb7, 0x0f, 0x08, 0x09, 0x1a, 0x2b, 0xec, 0xa2,
-  0xd1, 0x0e, 0x7f, 0x2d, 0x36, 0x31, 0x3e, 0xe7, 0x02, 0xd9, 0xde, 0x18,
-  0xfc, 0x0f, 0x34, 0x22, 0xf9, 0x2c, 0xf7, 0xcc, 0x24, 0x20, 0x0c, 0x4c,
-  0xd9, 0xd1, 0x02, 0x0a, 0xe2, 0x4d, 0xfc, 0xda, 0x24, 0x1e, 0xe6, 0x41,
-  0x4a, 0xda, 0x02, 0x12, 0xce, 0xf0, 0x09, 0x2d, 0x19, 0x0b, 0xfa, 0xf5,
-  0xe1, 0x1d, 0x27, 0xe1, 0xfa, 0x23, 0xd8, 0x03, 0xd8, 0x10, 0x52, 0x97,
-  0x25, 0x03, 0xe7, 0x8e, 0xd3, 0xff, 0x28, 0xc1, 0x2a, 0x35, 0xed, 0xe9,
-  0x26, 0x13, 0xf3, 0x04, 0x1c, 0x50, 0x54, 0xd9, 0x42, 0x0f, 0x0b, 0x6c,
-  0xc6, 0x10, 0xb0, 0x49, 0x34, 0x0c, 0x9a, 0xde, 0x4a, 0xfc, 0xfb, 0xc6,
-  0x14, 0x63, 0xce, 0x01, 0x11, 0xed, 0xe9, 0x7f, 0xb2, 0x6a, 0x0d, 0xe2,
-  0xd0, 0xdc, 0xf7, 0x16, 0x27, 0x60, 0xcb, 0xec, 0xc7, 0xa1, 0x07, 0xf4,
-  0xb5, 0x65, 0x16, 0x31, 0x98, 0x62, 0xbb, 0x57, 0xdf, 0x3d, 0xa1, 0xce,
-  0xe0, 0xe7, 0x6b, 0xbd, 0xe7, 0x20, 0x04, 0xaf, 0xfd, 0xda, 0x15, 0x07,
-  0xfd, 0xde, 0x91, 0x28, 0xb9, 0x4b, 0x3f, 0xe2, 0xc7, 0x49, 0x56, 0xfa,
-  0xdf, 0xd0, 0x3e, 0xac, 0xe4, 0xf7, 0xf4, 0xf1, 0x78, 0x21, 0xca, 0xe0,
-  0x26, 0x35, 0xff, 0x13, 0xb2, 0x35, 0x44, 0x17, 0xd0, 0xdf, 0x28, 0x3b,
-  0xcc, 0xfa, 0xe1, 0x5b, 0xbc, 0x44, 0x61, 0x5f, 0xd5, 0x2f, 0xc2, 0x29,
-  0xea, 0x3c, 0x2b, 0x1d, 0xfe, 0x2f, 0xb8, 0xee, 0xd4, 0xf4, 0xe1, 0xf0,
-  0xa7, 0x23, 0xf8, 0xbc, 0xee, 0xc2, 0x13, 0xbb, 0xe9, 0x06, 0x10, 0x30,
-  0x48, 0xa1, 0x22, 0x3d, 0x22, 0xb5, 0x5d, 0xfd, 0x03, 0x07, 0x68, 0x26,
-  0x03, 0x24, 0xc5, 0x1a, 0xc5, 0xeb, 0x10, 0xd3, 0xcd, 0xe6, 0xdf, 0xbb,
-  0xb3, 0x2a, 0x0f, 0xd6, 0x47, 0x17, 0x36, 0xe1, 0x45, 0xb5, 0xfe, 0xd0,
-  0xf9, 0x0b, 0xe5, 0x03, 0x01, 0x47, 0x02, 0x00, 0xe8, 0x3d, 0xb3, 0x02,
-  0x09, 0x16, 0xfc, 0x1e, 0x31, 0xec, 0x67, 0x21, 0x6f, 0x33, 0x9a, 0xd3,
-  0x17, 0x2f, 0x39, 0xd2, 0x81, 0xf2, 0xff, 0x36, 0xd4, 0x4f, 0xdb, 0xe4,
-  0x4f, 0xe8, 0xdf, 0x36, 0xdb, 0xde, 0xcc, 0x30, 0x16, 0xc6, 0xce, 0xf4,
-  0xe6, 0xc0, 0x4a, 0xeb, 0xe9, 0x00, 0xf8, 0x25, 0x43, 0x00, 0xb0, 0x00,
-  0xe1, 0xe2, 0xf9, 0xd1, 0x62, 0x42, 0xfb, 0xa1, 0x14, 0x22, 0x9f, 0xf6,
-  0xff, 0xb5, 0xf5, 0xe0, 0x3a, 0x16, 0x5b, 0x5b, 0x4d, 0xec, 0x2f, 0x55,
-  0xdd, 0x39, 0xe4, 0x4b, 0x2f, 0xdf, 0xf1, 0xda, 0x0b, 0x2d, 0x3d, 0xbb,
-  0xf7, 0xc6, 0xea, 0x35, 0xcd, 0xdd, 0xd3, 0x47, 0x93, 0xf6, 0xd8, 0x38,
-  0x1e, 0xe6, 0x31, 0x49, 0x08, 0x17, 0xcc, 0xef, 0xe8, 0x08, 0xf0, 0xf4,
-  0x38, 0xf3, 0x4d, 0x05, 0xd9, 0xef, 0x77, 0xb8, 0xd8, 0x35, 0x46, 0xdc,
-  0x50, 0x1f, 0xd1, 0x00, 0xe4, 0x0d, 0x00, 0xa0, 0x9e, 0x2f, 0x0e, 0x94,
-  0xe3, 0xd0, 0xff, 0x01, 0x08, 0x26, 0xf8, 0x78, 0xe9, 0x15, 0x3f, 0xbf,
-  0x04, 0xd4, 0xc2, 0xfb, 0xda, 0x36, 0xbb, 0x3c, 0x1e, 0x4c, 0xdb, 0x23,
-  0x81, 0x1a, 0xfa, 0x12, 0x03, 0x2e, 0x3b, 0xd6, 0x5a, 0x03, 0x8e, 0xc0,
-  0x4e, 0x1b, 0xde, 0x20, 0x1f, 0x4a, 0xff, 0x2c, 0x2c, 0x28, 0xa4, 0xe4,
-  0x27, 0x59, 0x32, 0xf0, 0x96, 0x02, 0xf2, 0x0e, 0x14, 0x33, 0x4f, 0x25,
-  0x05, 0xdb, 0xbd, 0x2f, 0x51, 0x55, 0xb6, 0xf9, 0x21, 0x21, 0xcf, 0xef,
-  0x4a, 0xed, 0xe3, 0xdc, 0x15, 0x08, 0x4c, 0xf6, 0xca, 0x3d, 0xba, 0x21,
-  0xfc, 0x0e, 0xf2, 0xfd, 0xb3, 0x00, 0x0b, 0xfd, 0xcc, 0xee, 0xfc, 0xcf,
-  0xfd, 0xc4, 0xf3, 0xc4, 0xc8, 0x38, 0x3c, 0x29, 0xda, 0xc8, 0xe4, 0xf3,
-  0x02, 0xab, 0xe0, 0x3e, 0x67, 0x7d, 0x17, 0x4a, 0xc5, 0x45, 0xd8, 0x54,
-  0xc7, 0x01, 0xbd, 0x1b, 0x30, 0x7f, 0x52, 0xa5, 0x4e, 0x51, 0x05, 0x43,
-  0xb1, 0x15, 0x55, 0xea, 0xca, 0x62, 0x0a, 0x09, 0xfd, 0x11, 0xd1, 0x2b,
-  0xd3, 0xf5, 0xbe, 0x2c, 0xfb, 0x2e, 0x08, 0x41, 0xe5, 0xba, 0x99, 0x45,
-  0x01, 0xf6, 0xd1, 0xc9, 0xd3, 0xfe, 0xf0, 0x1d, 0x0e, 0x22, 0xe8, 0x19,
-  0xc5, 0x07, 0x1b, 0xbe, 0xd7, 0x20, 0x05, 0x68, 0xb8, 0xd6, 0xd6, 0x10,
-  0x0d, 0x0b, 0xcd, 0x13, 0x1c, 0x70, 0x33, 0x18, 0xb1, 0x2d, 0xf4, 0x2e,
-  0x2b, 0x34, 0x56, 0xdf, 0x1b, 0xd4, 0xcd, 0xd0, 0xef, 0xdc, 0x26, 0x2e,
-  0xdb, 0x0a, 0x23, 0x16, 0x14, 0x9f, 0xd2, 0x32, 0x2b, 0xe2, 0x22, 0xf6,
-  0x41, 0xb5, 0xcd, 0x4f, 0xb4, 0x07, 0x11, 0xf5, 0x2b, 0x29, 0xd4, 0xd8,
-  0xa6, 0x15, 0xb7, 0x35, 0x27, 0xef, 0x14, 0xe6, 0x26, 0xef, 0xb3, 0xe0,
-  0xee, 0x0b, 0x2b, 0xf8, 0xe3, 0xc2, 0x04, 0xfb, 0x6b, 0x1c, 0xea, 0xdd,
-  0x4d, 0x01, 0xd0, 0x09, 0x15, 0xcd, 0x04, 0x0b, 0xf2, 0x7f, 0xdf, 0xe5,
-  0xf0, 0x0f, 0x0a, 0xd9, 0xcc, 0x0c, 0xcd, 0xfa, 0xec, 0x1a, 0x1a, 0x11,
-  0x1c, 0x05, 0xd5, 0xff, 0x0b, 0xf3, 0xc0, 0xd3, 0x0a, 0xf2, 0xa4, 0xe8,
-  0x36, 0xf1, 0xec, 0xf4, 0xe1, 0x05, 0x01, 0xee, 0xfc, 0xd5, 0xee, 0xa0,
-  0xd5, 0xfa, 0xda, 0x0b, 0x4c, 0x14, 0x1c, 0xcc, 0x01, 0x0a, 0x22, 0xe6,
-  0xf4, 0xe1, 0xdc, 0x07, 0xe5, 0x02, 0x1d, 0x29, 0xc0, 0x3b, 0x36, 0x00,
-  0xfe, 0xca, 0x25, 0xee, 0xda, 0xf8, 0x28, 0x7f, 0x2b, 0xdd, 0x1c, 0x0f,
-  0xe2, 0xb3, 0x5c, 0xab, 0x5e, 0x25, 0x27, 0x15, 0xa4, 0x3a, 0x14, 0x40,
-  0xff, 0xcf, 0x18, 0xdf, 0xef, 0x07, 0xed, 0x49, 0xaf, 0x03, 0xe7, 0xd9,
-  0x7e, 0xea, 0xe9, 0xc9, 0xea, 0x25, 0x06, 0xd3, 0xff, 0x09, 0x68, 0xbb,
-  0x31, 0x03, 0x35, 0x0e, 0x1e, 0x50, 0xed, 0xbc, 0x17, 0x03, 0xc3, 0xcf,
-  0x61, 0xe9, 0x14, 0xe3, 0x11, 0x2f, 0xd0, 0xca, 0x24, 0x42, 0x11, 0x0c,
-  0xbc, 0xf5, 0xf5, 0xe6, 0xf0, 0x39, 0x21, 0x16, 0x31, 0xe2, 0x07, 0xde,
-  0x03, 0xe9, 0xc5, 0x2b, 0x36, 0x10, 0xd9, 0xff, 0xf8, 0x9b, 0xe3, 0xff,
-  0x4f, 0xef, 0xe4, 0xd2, 0x02, 0xe3, 0xf8, 0xed, 0xe0, 0xed, 0x30, 0xb0,
-  0xdf, 0x14, 0x16, 0xe7, 0x08, 0x0d, 0xcc, 0xf1, 0xd3, 0xf6, 0x0c, 0x18,
-  0xef, 0x46, 0x10, 0xd0, 0xb7, 0xf4, 0x20, 0xec, 0xd2, 0x03, 0x18, 0xc5,
-  0x04, 0x04, 0x4f, 0x1c, 0x21, 0xd4, 0xff, 0xdc, 0x33, 0xcb, 0xcc, 0xf7,
-  0xde, 0x22, 0xf2, 0xe0, 0x12, 0x42, 0x0d, 0xee, 0x4f, 0xfc, 0x0d, 0xf5,
-  0x1c, 0x44, 0x2c, 0xca, 0xe9, 0x88, 0x18, 0x31, 0x50, 0x24, 0x1d, 0xf6,
-  0xe1, 0xb9, 0x26, 0xd6, 0xd7, 0x06, 0x49, 0x0a, 0xfa, 0x13, 0xc5, 0xf1,
-  0xcd, 0x27, 0x16, 0xb6, 0x95, 0xe3, 0xe2, 0x0e, 0x2d, 0xd5, 0x11, 0x37,
-  0xf1, 0xef, 0x1a, 0xa8, 0xb9, 0x0b, 0xe1, 0x07, 0xaf, 0xed, 0xcf, 0x03,
-  0xe5, 0x1c, 0xea, 0xb3, 0x6d, 0x67, 0x09, 0x2d, 0xe3, 0xdb, 0xe2, 0x01,
-  0x0f, 0x01, 0x3f, 0xef, 0xbd, 0x06, 0x36, 0x55, 0xa0, 0xd9, 0x0c, 0x40,
-  0x21, 0x81, 0xe4, 0x06, 0xb5, 0x20, 0xf1, 0xd7, 0x76, 0xed, 0xff, 0xac,
-  0xed, 0x19, 0xf7, 0xd2, 0x2f, 0x05, 0x31, 0x2b, 0xc3, 0x02, 0x6e, 0x5e,
-  0xea, 0x19, 0xf8, 0xf8, 0xf1, 0x02, 0xf2, 0x8a, 0xf3, 0xc3, 0x4a, 0x2d,
-  0xd3, 0xdc, 0xd2, 0xf3, 0x26, 0xdd, 0xf9, 0xc2, 0xda, 0x07, 0x19, 0xd6,
-  0x32, 0xde, 0xfd, 0x1c, 0x59, 0x1e, 0xda, 0xb1, 0xca, 0x16, 0xff, 0x0e,
-  0xb5, 0xa1, 0xe8, 0x19, 0x6e, 0xdf, 0x51, 0x09, 0xea, 0xad, 0x1d, 0xf7,
-  0x3c, 0x10, 0x00, 0x87, 0x66, 0x72, 0x22, 0x73, 0xe2, 0x40, 0xe9, 0x01,
-  0xcd, 0xe3, 0x2e, 0xd1, 0x4f, 0x1d, 0x15, 0x30, 0x3f, 0x14, 0x33, 0x92,
-  0xdf, 0x15, 0xdc, 0xdd, 0xc2, 0xbb, 0xf4, 0xf6, 0xf0, 0x30, 0x11, 0x8d,
-  0xee, 0x0d, 0xc6, 0x22, 0x6e, 0x97, 0xb7, 0x24, 0x26, 0xf2, 0xca, 0x40,
-  0xd0, 0x81, 0xec, 0xd6, 0x04, 0x2f, 0x25, 0x02, 0xda, 0xe4, 0xc8, 0xdf,
-  0x8c, 0xf0, 0x78, 0xd2, 0xf4, 0x0c, 0x33, 0xde, 0xdb, 0x00, 0xb1, 0x1a,
-  0x25, 0x0c, 0x16, 0x2e, 0x14, 0x36, 0xf2, 0xdf, 0x25, 0x23, 0xd4, 0xc4,
-  0x06, 0x0f, 0xb1, 0xed, 0x39, 0xcc, 0xe3, 0x33, 0x2e, 0x09, 0xdd, 0x0d,
-  0x30, 0x03, 0x05, 0xe0, 0x24, 0x62, 0x0d, 0x17, 0xef, 0x26, 0x06, 0x0e,
-  0xf0, 0xc9, 0xee, 0x13, 0x24, 0xea, 0x2e, 0x04, 0x16, 0xb1, 0x02, 0xcc,
-  0xe3, 0xdb, 0xa0, 0xfd, 0x03, 0xd9, 0xbb, 0xef, 0xc7, 0x05, 0x25, 0xe3,
-  0x26, 0xe1, 0x35, 0x81, 0x08, 0xb0, 0x34, 0xcf, 0xc9, 0xf5, 0xbc, 0xdd,
-  0xe0, 0x20, 0xeb, 0x0c, 0xd7, 0xed, 0xfb, 0x94, 0x0a, 0xa8, 0x36, 0xfa,
-  0xbc, 0x4b, 0x35, 0xf7, 0xa1, 0xeb, 0xca, 0x1c, 0x11, 0x04, 0x2f, 0x0b,
-  0x03, 0xe2, 0xb1, 0x41, 0xbe, 0x0c, 0xd0, 0x20, 0xa8, 0x95, 0x13, 0xa9,
-  0x25, 0x3b, 0x38, 0x41, 0xa8, 0x26, 0xeb, 0x3b, 0xc5, 0xc1, 0xad, 0x3c,
-  0x24, 0xef, 0xe9, 0xe4, 0x2e, 0x1e, 0x49, 0xf2, 0xc6, 0x38, 0x05, 0x10,
-  0x15, 0x51, 0x01, 0xd4, 0x19, 0xf3, 0x9e, 0xb2, 0xf4, 0xce, 0xd3, 0xe5,
-  0xb6, 0x37, 0x11, 0xfa, 0xfd, 0x24, 0xf0, 0xdd, 0x12, 0xe6, 0xe5, 0x3a,
-  0xdd, 0x32, 0xf3, 0x17, 0xce, 0x45, 0x09, 0x35, 0x30, 0x3f, 0xf7, 0x38,
-  0xd8, 0xe8, 0xe4, 0xcf, 0xf8, 0x2b, 0xc0, 0xfa, 0x08, 0x43, 0x81, 0x1b,
-  0xf9, 0x55, 0x0f, 0xfe, 0xd0, 0x24, 0xd6, 0x33, 0x42, 0xf7, 0xff, 0x20,
-  0xb8, 0x0f, 0xdf, 0x14, 0x19, 0x00, 0xd1, 0xda, 0xd6, 0xb4, 0xdb, 0xf9,
-  0xcc, 0xd3, 0x12, 0xe6, 0xe2, 0xbb, 0x04, 0xe9, 0x21, 0xfc, 0xa1, 0xd1,
-  0x34, 0xce, 0xe1, 0x16, 0x1e, 0x20, 0x07, 0x1e, 0xfe, 0xe0, 0xf9, 0x00,
-  0xf7, 0xe5, 0x2b, 0x0b, 0x29, 0x3e, 0x22, 0x2a, 0xf8, 0x45, 0x0e, 0x3f,
-  0xb5, 0x2a, 0x11, 0xf5, 0xee, 0xf9, 0x1b, 0x36, 0x47, 0x9b, 0x14, 0xfa,
-  0x35, 0x0b, 0xb3, 0x15, 0xf4, 0xcf, 0xd2, 0xf9, 0x9e, 0xd4, 0x51, 0xaa,
-  0x2b, 0xf5, 0x43, 0x25, 0xd7, 0x1b, 0x04, 0x22, 0xf1, 0x2d, 0xfa, 0xff,
-  0x2f, 0xc5, 0xe4, 0x12, 0xcc, 0xce, 0xff, 0x08, 0x51, 0xe4, 0x66, 0xe8,
-  0x40, 0xf8, 0xfa, 0xf6, 0x10, 0xe1, 0x09, 0x3e, 0xa9, 0xd1, 0xfd, 0xc0,
-  0xe2, 0xef, 0xee, 0x06, 0xea, 0x1c, 0x0c, 0xfe, 0xee, 0xfa, 0x0b, 0xe5,
-  0x2f, 0xbc, 0x04, 0xeb, 0xdc, 0xce, 0xdd, 0xee, 0x0a, 0x0e, 0xf5, 0x2d,
-  0xcd, 0xf4, 0x0e, 0xc9, 0x2e, 0x58, 0x12, 0x0e, 0xe8, 0xdb, 0xd7, 0xf9,
-  0xd2, 0xfd, 0x00, 0xbf, 0x14, 0xf4, 0x37, 0xfb, 0xff, 0xe5, 0x00, 0x0d,
-  0xf9, 0x38, 0xb6, 0xcf, 0xe8, 0x61, 0x29, 0xc6, 0x1a, 0xd9, 0xcd, 0xe9,
-  0xd6, 0xfd, 0x08, 0x05, 0x13, 0x38, 0xc5, 0x04, 0x1f, 0xd2, 0x02, 0xdd,
-  0xf1, 0x5c, 0xad, 0x0a, 0xf3, 0x42, 0xb4, 0x30, 0x7f, 0xf3, 0xf9, 0x30,
-  0xc7, 0x02, 0x4f, 0x0a, 0x1f, 0xd8, 0xdc, 0x05, 0x01, 0x7f, 0x23, 0x08,
-  0x68, 0xd1, 0x02, 0x0b, 0x3b, 0xe1, 0x7b, 0xe7, 0x54, 0x19, 0x24, 0xd2,
-  0x01, 0x30, 0xfe, 0xde, 0xdc, 0x77, 0x07, 0x53, 0x4f, 0xf0, 0xaf, 0xba,
-  0x36, 0x14, 0x2a, 0xe9, 0x29, 0x27, 0x07, 0xf1, 0x02, 0xa2, 0xac, 0x35,
-  0x10, 0x18, 0x02, 0x1c, 0xcf, 0xa3, 0x27, 0xf9, 0xfb, 0xe5, 0xbe, 0xc9,
-  0x30, 0xd3, 0xc5, 0xed, 0x12, 0xef, 0xb6, 0xff, 0x05, 0xaa, 0xd3, 0xea,
-  0x24, 0x47, 0x21, 0x48, 0x68, 0x24, 0x1e, 0xb4, 0x29, 0xec, 0x4e, 0x21,
-  0xfb, 0x36, 0xf0, 0xc0, 0xc5, 0x54, 0x2f, 0xab, 0x14, 0xd1, 0xfb, 0xe3,
-  0xe4, 0x37, 0xee, 0x99, 0xa1, 0xaf, 0xf7, 0x25, 0xaf, 0x4b, 0xfd, 0xf5,
-  0x55, 0xf8, 0x12, 0x09, 0x50, 0xd7, 0x14, 0xac, 0xf4, 0xa9, 0xc4, 0xc7,
-  0xb9, 0xd8, 0xec, 0xee, 0xd5, 0xfb, 0xcf, 0xdf, 0x2d, 0x14, 0xe6, 0x34,
-  0x10, 0x2e, 0x40, 0x09, 0xf8, 0x16, 0x37, 0x01, 0x30, 0xff, 0xf3, 0xf5,
-  0xe3, 0xe0, 0x30, 0xfa, 0xdd, 0xcd, 0x3f, 0x1d, 0xfb, 0xcc, 0x28, 0xbc,
-  0xed, 0x05, 0x0b, 0xea, 0xc6, 0x2e, 0x03, 0xcb, 0x18, 0x02, 0xf7, 0xf6,
-  0xfe, 0x00, 0x00, 0x21, 0x24, 0x03, 0xb5, 0x0d, 0x47, 0xe4, 0x0e, 0xcc,
-  0xf0, 0xfd, 0x19, 0xc0, 0x1c, 0xf3, 0xed, 0xcd, 0xef, 0x6d, 0x25, 0xf6,
-  0xde, 0x7f, 0xd3, 0x09, 0xf7, 0xf8, 0x08, 0x0b, 0x21, 0xde, 0x23, 0x10,
-  0x1b, 0x2b, 0xf5, 0xfb, 0x17, 0x28, 0xfc, 0xd7, 0xdb, 0x0f, 0xe5, 0xf0,
-  0xca, 0xfa, 0x03, 0xd3, 0x44, 0xc4, 0x13, 0x05, 0x06, 0xc8, 0x11, 0x21,
-  0xe4, 0xf7, 0xf5, 0x1c, 0xc1, 0xcd, 0x3a, 0x06, 0x04, 0xfb, 0x55, 0x0b,
-  0xf9, 0xde, 0x0d, 0x06, 0xfc, 0x27, 0x06, 0xef, 0x0e, 0xf9, 0xd1, 0xe5,
-  0xf9, 0x40, 0xf2, 0xe5, 0xed, 0x24, 0xd0, 0x2d, 0x27, 0x07, 0xcd, 0xd9,
-  0xf4, 0xb7, 0xf9, 0x50, 0xea, 0x31, 0x37, 0x32, 0x22, 0xc1, 0x57, 0x33,
-  0x1b, 0xdb, 0xa8, 0x12, 0x15, 0xdd, 0x33, 0x59, 0xd1, 0xc4, 0x02, 0x57,
-  0x4c, 0x38, 0xe4, 0xdf, 0xe5, 0x40, 0xdc, 0x58, 0x40, 0xeb, 0x44, 0xf2,
-  0x16, 0xee, 0xfb, 0x01, 0x51, 0x7f, 0xf5, 0xbe, 0x3d, 0x0a, 0x16, 0xce,
-  0x73, 0x29, 0x07, 0xc9, 0xee, 0x13, 0x0b, 0x2d, 0x3d, 0xa8, 0x3b, 0xc6,
-  0x2e, 0x19, 0xb4, 0xad, 0x06, 0x35, 0xe0, 0x12, 0x05, 0xfb, 0xaf, 0x15,
-  0xdb, 0x0c, 0x07, 0x6c, 0xb8, 0xd7, 0x38, 0x20, 0x20, 0x1e, 0x32, 0xcf,
-  0xf6, 0x0e, 0x18, 0x77, 0xaf, 0x24, 0xe6, 0xf4, 0xc5, 0x5d, 0xd6, 0x1f,
-  0x13, 0x1e, 0xa5, 0xe2, 0xd5, 0x29, 0x0c, 0x0a, 0x36, 0xc0, 0xbd, 0xf8,
-  0xcb, 0xdb, 0xe7, 0x9c, 0x30, 0xf1, 0x4b, 0xd1, 0x18, 0x41, 0x70, 0x32,
-  0x27, 0x30, 0xaa, 0xe1, 0xe2, 0x68, 0x28, 0xd7, 0x40, 0xee, 0xe2, 0x0a,
-  0x0c, 0x14, 0x73, 0x67, 0x22, 0x32, 0xda, 0x14, 0xdb, 0x1c, 0xfe, 0x0c,
-  0xfe, 0x12, 0x4b, 0xc9, 0x41, 0x0e, 0x38, 0x50, 0xbb, 0x1f, 0xf5, 0x33,
-  0x37, 0xda, 0x06, 0xbc, 0xd9, 0xf5, 0xf0, 0x2f, 0x00, 0xcc, 0xda, 0xe3,
-  0x0e, 0xd7, 0x47, 0x2c, 0xd9, 0x05, 0xd8, 0x22, 0xae, 0x03, 0x3f, 0x2a,
-  0x35, 0x3c, 0x1f, 0x2e, 0x36, 0xdd, 0xdd, 0xce, 0xd0, 0xf9, 0xe3, 0xc2,
-  0x08, 0x3b, 0x08, 0xee, 0x1c, 0xea, 0x3c, 0xf9, 0xed, 0xd9, 0xfa, 0x43,
-  0xd3, 0x00, 0x0a, 0x7f, 0x33, 0x34, 0x1d, 0xd4, 0xbc, 0x45, 0xfa, 0xfb,
-  0xe3, 0x1e, 0xb2, 0x00, 0xad, 0x33, 0x36, 0x1c, 0xf1, 0x06, 0x21, 0x04,
-  0x1d, 0xc8, 0x4d, 0x79, 0xfd, 0x1b, 0x4d, 0xa9, 0xcd, 0xe9, 0xd9, 0xb0,
-  0x05, 0xd5, 0x02, 0xef, 0xca, 0x29, 0xec, 0x08, 0x45, 0x17, 0x49, 0xf7,
-  0x0d, 0x02, 0xc9, 0xd8, 0xf9, 0xf5, 0xda, 0xcb, 0x1b, 0x7c, 0xee, 0x27,
-  0x15, 0x65, 0xe6, 0x5c, 0x0d, 0x14, 0x26, 0x34, 0xaf, 0x4b, 0x21, 0x16,
-  0xcb, 0x1a, 0x03, 0x7f, 0x1c, 0xf2, 0xe8, 0x26, 0xeb, 0x18, 0x03, 0x03,
-  0xcf, 0x2d, 0x34, 0xd0, 0x0c, 0xfa, 0x0a, 0x0a, 0x24, 0xe5, 0x26, 0xd9,
-  0x9c, 0xcd, 0xfa, 0x4a, 0x37, 0x0f, 0xed, 0x18, 0xca, 0xa2, 0x0b, 0x09,
-  0x24, 0xcd, 0x05, 0xe2, 0xd2, 0xf9, 0xc8, 0xd0, 0x43, 0x24, 0x2b, 0xf3,
-  0xae, 0x1b, 0x2d, 0xf1, 0x45, 0xf7, 0x43, 0xee, 0x9e, 0xf8, 0x07, 0xe1,
-  0xb7, 0xe4, 0x2c, 0xd8, 0xec, 0x12, 0xf1, 0xca, 0xf5, 0xaf, 0xdc, 0xd2,
-  0x2d, 0x47, 0x45, 0x0e, 0xf9, 0xcf, 0x32, 0xef, 0x40, 0x20, 0x9f, 0x16,
-  0xe3, 0xfe, 0x0b, 0x0a, 0xf2, 0xfe, 0x4d, 0xf2, 0x07, 0x0e, 0x19, 0xcd,
-  0xf0, 0xa8, 0xf4, 0x0d, 0x1e, 0xe2, 0xfb, 0x1f, 0xbc, 0x1f, 0x1e, 0xbe,
-  0x0c, 0xda, 0x05, 0x07, 0xdd, 0x07, 0xfb, 0xf9, 0x56, 0x26, 0x10, 0x0e,
-  0xca, 0xc5, 0xda, 0x1a, 0xe3, 0xf2, 0x47, 0x15, 0xe5, 0x0b, 0xf3, 0x30,
-  0xef, 0x11, 0xce, 0xb6, 0xcb, 0xc2, 0xe4, 0x09, 0x2a, 0xec, 0xef, 0xf8,
-  0x1b, 0xf3, 0xb4, 0x3e, 0x03, 0xfd, 0xfb, 0x0e, 0xe7, 0x1c, 0xf4, 0x0f,
-  0xc0, 0xf7, 0x66, 0x35, 0xe8, 0xe9, 0xb4, 0xbc, 0x0f, 0xdd, 0xeb, 0xd4,
-  0x0e, 0xd6, 0x1e, 0xc9, 0xab, 0x0d, 0x28, 0x58, 0x00, 0x16, 0xfd, 0xb9,
-  0xd0, 0x1f, 0x6b, 0xbb, 0x10, 0x04, 0xfb, 0x03, 0xa0, 0xdd, 0xce, 0x17,
-  0x2f, 0x0f, 0xef, 0x10, 0x0b, 0x1e, 0xf7, 0xd6, 0x1f, 0x5f, 0x07, 0xcd,
-  0x7f, 0x9f, 0xe6, 0xc8, 0xe2, 0xcb, 0x08, 0xe2, 0xb4, 0x65, 0xb6, 0xde,
-  0xf9, 0xf8, 0xee, 0xee, 0xd9, 0x25, 0x13, 0x58, 0x2e, 0x2c, 0x48, 0xdf,
-  0x14, 0x61, 0xcb, 0x44, 0x18, 0x3d, 0x0b, 0xdd, 0x1a, 0xd2, 0xce, 0xc7,
-  0xba, 0x52, 0x08, 0x0f, 0x3d, 0x06, 0x0c, 0x0a, 0xf4, 0xfe, 0xa6, 0xdb,
-  0x1e, 0xfc, 0x0a, 0x27, 0x37, 0xe8, 0xf2, 0x2a, 0x8f, 0x36, 0xab, 0xce,
-  0xca, 0xba, 0xb4, 0x2c, 0xcf, 0xeb, 0x26, 0xb0, 0xf0, 0x40, 0xd3, 0x3f,
-  0x0d, 0xcc, 0xef, 0x69, 0x15, 0x35, 0x18, 0x2c, 0xc9, 0x44, 0x22, 0xb5,
-  0x5a, 0x00, 0xca, 0x0d, 0x42, 0xd7, 0xec, 0xd8, 0xb4, 0x23, 0x4b, 0xa6,
-  0x1a, 0x05, 0xb2, 0xb7, 0xc4, 0x3a, 0x54, 0xd3, 0x25, 0x53, 0x3a, 0xd5,
-  0xfb, 0x62, 0x0e, 0x06, 0x26, 0xd0, 0x10, 0xcf, 0xb0, 0xb8, 0x9f, 0x44,
-  0x60, 0xf0, 0x09, 0x22, 0xd2, 0x01, 0x0b, 0xab, 0xc0, 0xed, 0xfc, 0x35,
-  0xc4, 0xe1, 0xec, 0xbe, 0x81, 0xaf, 0xa1, 0xc2, 0xe6, 0xef, 0x06, 0xbb,
-  0xce, 0x5d, 0xca, 0xfc, 0x24, 0xe7, 0x3d, 0xb3, 0x00, 0xe6, 0x19, 0x33,
-  0xa5, 0x02, 0x1f, 0x3d, 0xf8, 0x0d, 0xde, 0xe0, 0x08, 0xec, 0xed, 0xb4,
-  0xcf, 0x30, 0x00, 0xd6, 0xd0, 0xcf, 0xfd, 0x20, 0x04, 0xfb, 0xe8, 0x24,
-  0xf5, 0x46, 0xbf, 0xf4, 0x09, 0x10, 0xfe, 0xe1, 0x42, 0x0c, 0xf1, 0xc9,
-  0xcd, 0xeb, 0x37, 0x3f, 0x35, 0xec, 0xc5, 0xee, 0x20, 0x0a, 0xef, 0xfb,
-  0xb6, 0xd9, 0x01, 0x10, 0x17, 0xc7, 0x3f, 0xe7, 0x7f, 0xd8, 0x16, 0x1c,
-  0xbe, 0xe4, 0x09, 0x2e, 0x15, 0x25, 0xad, 0xf0, 0x0b, 0x04, 0xf8, 0xca,
-  0xf3, 0x2f, 0x40, 0xc4, 0xc9, 0xe2, 0xf9, 0x2c, 0xcd, 0x0a, 0x24, 0xbb,
-  0x2f, 0x26, 0x00, 0x03, 0x27, 0x4c, 0x32, 0xf8, 0xfa, 0x13, 0xc9, 0x3c,
-  0x0a, 0x24, 0x00, 0xfb, 0xd0, 0x1a, 0xe4, 0x31, 0x11, 0x18, 0x16, 0x06,
-  0x1e, 0xfa, 0x00, 0xfc, 0xc8, 0xf2, 0x15, 0x07, 0x0e, 0xb4, 0xf6, 0xeb,
-  0x01, 0x0d, 0xff, 0xb9, 0x1a, 0xe5, 0x26, 0x07, 0xe2, 0x06, 0x07, 0x08,
-  0xfb, 0xfd, 0x51, 0xc6, 0x23, 0xbf, 0xd2, 0xc8, 0xd2, 0xd6, 0xf3, 0x33,
-  0x1c, 0x1f, 0x6b, 0xf2, 0x13, 0xc4, 0x63, 0xf9, 0xf7, 0x2c, 0x31, 0xe1,
-  0x23, 0x62, 0x25, 0xd9, 0x0d, 0x3b, 0x1c, 0x12, 0xfc, 0xf7, 0xd5, 0xf8,
-  0x81, 0x28, 0xc2, 0xcd, 0x64, 0xe6, 0x10, 0xd0, 0xec, 0xcc, 0xe1, 0x9b,
-  0xfa, 0x1f, 0x1b, 0x8c, 0x1d, 0x1c, 0x12, 0xb7, 0xeb, 0x71, 0x09, 0xf8,
-  0xc1, 0xe0, 0xc4, 0x4e, 0x2a, 0xcc, 0xdd, 0x20, 0x04, 0x42, 0x00, 0xc7,
-  0xeb, 0x33, 0xf5, 0x46, 0xee, 0xe7, 0x0e, 0x28, 0x1a, 0x70, 0x0a, 0xf5,
-  0x51, 0x2b, 0x09, 0x21, 0xfc, 0xc1, 0x26, 0x40, 0x1d, 0xb2, 0xe6, 0xcf,
-  0x3a, 0xec, 0xcb, 0xef, 0xe7, 0xeb, 0x5b, 0xa0, 0x35, 0x02, 0xc2, 0xfb,
-  0x9f, 0x16, 0x0d, 0xa0, 0x24, 0x53, 0x08, 0xa3, 0x39, 0xc7, 0x8e, 0x28,
-  0xf6, 0x03, 0xe8, 0x3c, 0x3b, 0x7d, 0x1d, 0xca, 0xde, 0xfe, 0x00, 0xd6,
-  0x06, 0x50, 0x69, 0xe0, 0x60, 0x4e, 0x92, 0xf0, 0xca, 0xf2, 0x2a, 0x2d,
-  0xfb, 0xcc, 0x46, 0x0e, 0x13, 0xe5, 0xad, 0x31, 0xec, 0xe4, 0xda, 0xae,
-  0xe0, 0xe7, 0x21, 0xd0, 0xa3, 0x3e, 0x38, 0xbf, 0xb9, 0xc2, 0xa4, 0xd0,
-  0x0c, 0x32, 0xe2, 0x71, 0xb7, 0xde, 0x10, 0xba, 0xf5, 0xf0, 0xba, 0x5d,
-  0xf9, 0xb2, 0x0a, 0xb0, 0xe9, 0x3d, 0x50, 0xbf, 0x48, 0xce, 0xee, 0x06,
-  0x01, 0xd2, 0xc5, 0x29, 0xd3, 0x1b, 0xc9, 0xf6, 0xc5, 0x27, 0x4f, 0x17,
-  0x9e, 0x09, 0xe1, 0x01, 0x39, 0x47, 0x28, 0xf5, 0x95, 0x18, 0xc6, 0x1d,
-  0x40, 0x1b, 0x30, 0x12, 0x2a, 0xdd, 0xbe, 0x67, 0x44, 0x50, 0x30, 0xb0,
-  0xcc, 0xc1, 0x5b, 0xdb, 0xfb, 0x04, 0xe7, 0xed, 0xfe, 0x76, 0x86, 0xf4,
-  0xab, 0x3b, 0xfd, 0xed, 0xbd, 0xac, 0x32, 0xdc, 0x25, 0xec, 0x1d, 0xe1,
-  0x7f, 0xf5, 0xc3, 0x04, 0x22, 0xc8, 0x3a, 0x81, 0x42, 0xb9, 0x0b, 0x3d,
-  0xe2, 0x09, 0x52, 0x0d, 0x19, 0xaf, 0x24, 0xcd, 0xfc, 0x00, 0x0f, 0xb1,
-  0x13, 0xc1, 0x14, 0x59, 0xe4, 0xc7, 0x2a, 0xb1, 0x86, 0x54, 0xe2, 0xf7,
-  0xfc, 0x53, 0xef, 0xcb, 0xeb, 0x26, 0xdf, 0x24, 0xe1, 0xf0, 0x2f, 0x2b,
-  0x18, 0x31, 0x34, 0xef, 0xe6, 0x30, 0xa7, 0xe0, 0xfb, 0x3d, 0xd1, 0x59,
-  0x01, 0x19, 0xf1, 0x26, 0xcc, 0x0d, 0x4d, 0x10, 0x60, 0x25, 0x76, 0x0d,
-  0x14, 0xb8, 0xad, 0xe3, 0xb7, 0x64, 0xfd, 0x8f, 0xe3, 0x81, 0x38, 0xb1,
-  0xf5, 0x1e, 0xe8, 0xc9, 0xec, 0x58, 0xc1, 0x26, 0x2f, 0x49, 0xb5, 0xb3,
-  0x45, 0xb2, 0x1f, 0x98, 0xfd, 0x38, 0x0f, 0xc8, 0xe6, 0x6c, 0x90, 0xac,
-  0x26, 0xc5, 0x0f, 0x55, 0x1e, 0x31, 0x04, 0x58, 0xd3, 0x5c, 0x4a, 0xfd,
-  0x1e, 0xab, 0x15, 0x62, 0x22, 0xe7, 0x14, 0x2c, 0x08, 0xb0, 0xce, 0xe6,
-  0x20, 0x5b, 0x57, 0xcb, 0x09, 0x9b, 0x15, 0xba, 0xc1, 0xe7, 0xf4, 0x0f,
-  0xfd, 0xba, 0x44, 0xfe, 0x2d, 0xde, 0x44, 0x26, 0x15, 0x14, 0x26, 0xba,
-  0x62, 0x24, 0x1a, 0xee, 0xe8, 0x27, 0xf5, 0x0b, 0x3d, 0x16, 0x16, 0xd5,
-  0xbf, 0x57, 0x0a, 0x17, 0x10, 0xea, 0x08, 0xd7, 0xe2, 0x24, 0x31, 0xd5,
-  0x16, 0x1d, 0x4e, 0x38, 0xca, 0x17, 0xfc, 0xc3, 0x2f, 0x03, 0xfd, 0xf2,
-  0x3a, 0xe8, 0x1b, 0x61, 0x16, 0xe8, 0x2d, 0x12, 0x53, 0x7e, 0xe7, 0xe3,
-  0xc1, 0x24, 0x4b, 0xa3, 0xe3, 0x56, 0xb7, 0x26, 0xba, 0x3e, 0xed, 0x0a,
-  0x1f, 0xd6, 0xca, 0x33, 0xfa, 0xc1, 0xdf, 0xef, 0xf3, 0xb6, 0xd3, 0xc6,
-  0xfe, 0x82, 0xdf, 0xb1, 0xcf, 0x56, 0x2c, 0x17, 0xd6, 0xee, 0x07, 0xd6,
-  0x81, 0xd4, 0xba, 0x55, 0x1b, 0x35, 0x30, 0x01, 0x0d, 0x31, 0x21, 0xe3,
-  0xf0, 0xb0, 0x1a, 0xf0, 0xa9, 0x22, 0x2a, 0x05, 0x2c, 0x43, 0xdf, 0xc2,
-  0x37, 0x29, 0x4a, 0x33, 0xfe, 0xc8, 0xfb, 0x44, 0xd9, 0x3b, 0x31, 0xa7,
-  0x12, 0x19, 0x1b, 0xbb, 0xae, 0x03, 0xbe, 0x14, 0xc9, 0xca, 0xc8, 0x53,
-  0xd3, 0x2c, 0x2e, 0x3c, 0x73, 0x56, 0xdb, 0x26, 0x42, 0x53, 0xe8, 0x0f,
-  0x0c, 0xc5, 0x5e, 0x24, 0xab, 0x65, 0x4c, 0x00, 0x1d, 0x55, 0xff, 0xdc,
-  0x25, 0x3f, 0x3a, 0xe8, 0x1d, 0x05, 0xe4, 0x20, 0xc5, 0xd6, 0x09, 0xfc,
-  0x2a, 0x05, 0x31, 0xbe, 0x37, 0x1b, 0xe4, 0x3f, 0xb7, 0x01, 0x5b, 0xbb,
-  0x0d, 0xfc, 0xc4, 0xde, 0xd7, 0x31, 0xeb, 0xfa, 0x4b, 0xd1, 0x16, 0x24,
-  0xe5, 0x13, 0x2b, 0x33, 0x4c, 0x0b, 0x58, 0xd8, 0x2c, 0x28, 0xeb, 0xa0,
-  0xc2, 0x22, 0xe8, 0xd0, 0xee, 0x0a, 0xe3, 0x37, 0x0b, 0xf8, 0x15, 0x0a,
-  0x23, 0x19, 0x58, 0xe0, 0xc2, 0xe1, 0x29, 0x38, 0x04, 0x23, 0xf1, 0x57,
-  0x7f, 0x1b, 0xc1, 0x05, 0x08, 0x53, 0x28, 0xd5, 0x2f, 0xdc, 0x38, 0x19,
-  0xd2, 0xf1, 0x08, 0x13, 0xf1, 0x4b, 0x21, 0x2b, 0x81, 0x23, 0x20, 0x01,
-  0xef, 0xf5, 0xbb, 0x05, 0xea, 0x0a, 0xd5, 0xf3, 0x17, 0x16, 0xd5, 0x04,
-  0xc0, 0x17, 0xe4, 0x11, 0x04, 0x2c, 0x0e, 0x14, 0x1b, 0x01, 0x15, 0xfd,
-  0xeb, 0xd5, 0xfa, 0x01, 0x24, 0x27, 0xce, 0xcb, 0x06, 0x2a, 0xd9, 0xfb,
-  0x01, 0x35, 0x0e, 0x1d, 0xde, 0x4d, 0xb3, 0xa6, 0x43, 0xf7, 0xcd, 0xe2,
-  0xaa, 0xdd, 0x08, 0x42, 0xfa, 0xd1, 0x2b, 0xf6, 0xd4, 0xcf, 0x06, 0xf3,
-  0xd9, 0xde, 0x02, 0x3f, 0x11, 0xe5, 0x1b, 0xc0, 0x0e, 0x08, 0xfc, 0x22,
-  0xdc, 0x23, 0x36, 0xde, 0x2d, 0xca, 0x2a, 0x14, 0x24, 0x1c, 0xbd, 0xda,
-  0x07, 0x01, 0x06, 0xea, 0x35, 0x08, 0xfd, 0xd9, 0xfa, 0x3b, 0xe2, 0x1c,
-  0x10, 0xd1, 0x38, 0xf7, 0xf8, 0x25, 0xdc, 0x44, 0xe1, 0x10, 0xd1, 0x01,
-  0x3c, 0xff, 0x1c, 0x2a, 0xb8, 0x06, 0x31, 0xae, 0x00, 0xd6, 0x07, 0x9d,
-  0xb8, 0xeb, 0x09, 0x11, 0x48, 0xdb, 0x03, 0x5f, 0x29, 0xfd, 0x50, 0xc7,
-  0x1c, 0x21, 0xe7, 0x1d, 0x42, 0xf9, 0x31, 0x72, 0x11, 0xb4, 0x19, 0xe8,
-  0xd4, 0x04, 0xf4, 0xe9, 0xfe, 0x10, 0xd0, 0xcc, 0x43, 0xf2, 0x1b, 0xca,
-  0x25, 0x4b, 0x0c, 0x41, 0xd5, 0xc7, 0xf2, 0x41, 0xe4, 0xfb, 0x06, 0xf8,
-  0x5f, 0x50, 0x73, 0x71, 0x42, 0x6e, 0x1f, 0x05, 0x19, 0x52, 0xad, 0x15,
-  0x10, 0xeb, 0x0a, 0x08, 0x81, 0x33, 0xcb, 0x24, 0xa6, 0x21, 0x9e, 0x71,
-  0x06, 0xe9, 0xfc, 0x44, 0x91, 0xcf, 0xde, 0xac, 0xd7, 0x0c, 0xb4, 0x12,
-  0xd7, 0xc1, 0x24, 0xd3, 0x10, 0xcd, 0x16, 0x06, 0x35, 0x28, 0xd9, 0x14,
-  0x36, 0xeb, 0x9d, 0x1d, 0x2b, 0x21, 0x2a, 0xf2, 0x01, 0x46, 0xcc, 0x0d,
-  0x3d, 0xc3, 0xd9, 0x8b, 0x38, 0x37, 0x24, 0x77, 0x2a, 0xab, 0xec, 0xfa,
-  0x20, 0x45, 0x26, 0x0f, 0x69, 0xd9, 0x34, 0xef, 0xfa, 0x14, 0x08, 0x98,
-  0x03, 0xd9, 0x24, 0x40, 0x28, 0x15, 0xeb, 0x2c, 0x17, 0x18, 0x13, 0xea,
-  0x18, 0xfa, 0x0e, 0xa2, 0x19, 0xf2, 0xe1, 0xf9, 0xa1, 0xea, 0xba, 0xf2,
-  0xf4, 0xf7, 0xf3, 0xf9, 0x00, 0x1a, 0x0a, 0xdc, 0x3e, 0x50, 0x3a, 0x3a,
-  0xe2, 0x1e, 0xad, 0x21, 0xef, 0xbc, 0x0a, 0x2f, 0x0a, 0x0e, 0x17, 0xdf,
-  0xd9, 0xfd, 0xb7, 0x0c, 0xdf, 0x6f, 0x31, 0x18, 0xfc, 0xcc, 0x44, 0xe5,
-  0x0f, 0x0d, 0x1a, 0xf8, 0xe8, 0xcf, 0x02, 0xfb, 0x79, 0xfa, 0xd0, 0x7f,
-  0xbe, 0x1e, 0x33, 0xf5, 0xf0, 0xaa, 0x0b, 0xfe, 0xef, 0x01, 0x16, 0xcf,
-  0x12, 0xca, 0x22, 0xe1, 0x0c, 0x38, 0x03, 0x11, 0xc5, 0x26, 0xc8, 0x08,
-  0x27, 0xd7, 0xfa, 0xd4, 0xd7, 0x58, 0x27, 0xb8, 0xf5, 0xf0, 0x16, 0x0b,
-  0x19, 0xb0, 0x2d, 0xc7, 0x29, 0xd0, 0xe7, 0xbc, 0x08, 0xb7, 0xc2, 0x16,
-  0x2e, 0xd8, 0x1c, 0x2a, 0x4d, 0x2c, 0xd0, 0x1f, 0xf4, 0x09, 0x25, 0xe2,
-  0xeb, 0x2f, 0xe6, 0xe6, 0xc7, 0x02, 0x1b, 0x35, 0xe8, 0x02, 0x16, 0x28,
-  0xfd, 0x0e, 0x01, 0x24, 0x4b, 0x27, 0xcf, 0x4b, 0x0f, 0xd4, 0xeb, 0xcf,
-  0xf3, 0x31, 0x0e, 0xde, 0x10, 0x29, 0xd9, 0x2e, 0xe7, 0xd4, 0xe6, 0xf9,
-  0x1d, 0xb7, 0x29, 0xf2, 0x7f, 0x00, 0x56, 0x1e, 0x13, 0x1b, 0xeb, 0x02,
-  0xfa, 0xf1, 0x15, 0x0d, 0xd6, 0xe0, 0x37, 0x02, 0x09, 0x3a, 0xd9, 0x06,
-  0xe6, 0xc2, 0xa7, 0x0b, 0x03, 0x13, 0xb2, 0xf1, 0x0b, 0x2e, 0xb2, 0xff,
-  0x2b, 0x33, 0x22, 0xc4, 0x4c, 0xdb, 0xf0, 0xcf, 0xc6, 0xd7, 0xde, 0x49,
-  0x05, 0xe0, 0x1d, 0x0f, 0x2f, 0x07, 0x25, 0x0c, 0xf5, 0x68, 0x42, 0x0e,
-  0x25, 0xe4, 0xfa, 0x01, 0x1b, 0x1f, 0x15, 0x32, 0x28, 0x39, 0xf9, 0xd4,
-  0xdd, 0xb7, 0x66, 0xe8, 0xa9, 0x2b, 0xd4, 0xea, 0xe2, 0xc2, 0xef, 0xec,
-  0xf8, 0xf8, 0xd4, 0x3e, 0x0f, 0x0d, 0x46, 0x00, 0x2a, 0x22, 0x6a, 0x6e,
-  0xc2, 0x30, 0xeb, 0x58, 0x3d, 0x64, 0xe5, 0xdc, 0xdc, 0xe4, 0xd8, 0x51,
-  0x33, 0xb1, 0x8e, 0x81, 0x46, 0x4c, 0xe9, 0xec, 0xb7, 0xfc, 0xfa, 0x1b,
-  0xd3, 0xdf, 0x27, 0x22, 0x3d, 0xf1, 0x2b, 0xfb, 0xf0, 0xf7, 0x05, 0x38,
-  0x08, 0xda, 0x41, 0xf8, 0xec, 0x92, 0x18, 0xd2, 0xcf, 0xe7, 0x99, 0xa3,
-  0xb5, 0xf5, 0x06, 0x2a, 0xc4, 0x02, 0xcf, 0xde, 0xdd, 0x35, 0x14, 0x08,
-  0x47, 0xe6, 0xef, 0x35, 0xcb, 0xf6, 0x58, 0x15, 0x5a, 0x17, 0x4e, 0x06,
-  0xe5, 0x11, 0xed, 0x9c, 0xe6, 0x2f, 0xd8, 0x32, 0xd1, 0x33, 0xe4, 0x23,
-  0xec, 0x03, 0xd4, 0x61, 0x1c, 0x0d, 0x0b, 0xdb, 0xea, 0xf2, 0xb1, 0x0a,
-  0x00, 0xfc, 0x9a, 0xda, 0x68, 0x2c, 0xd5, 0xf2, 0x96, 0xe4, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x8f, 0x03, 0x00, 0x00,
+  0x0f, 0x14, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0x56, 0x9f, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+  0x66, 0x6e, 0x1f, 0xb8, 0x7f, 0x31, 0x17, 0x7f, 0x81, 0x7f, 0x70, 0xfa,
+  0x4b, 0x7f, 0x36, 0xa1, 0x4e, 0x7f, 0x7f, 0x10, 0x35, 0x7f, 0x81, 0x85,
+  0x7f, 0x7f, 0x8c, 0xe0, 0x8d, 0x81, 0xa8, 0x81, 0xa5, 0x81, 0x0c, 0x81,
+  0x00, 0x81, 0x81, 0x7f, 0x81, 0x8a, 0xb1, 0xbd, 0x81, 0x5b, 0x81, 0x7f,
+  0x5e, 0x4c, 0xd2, 0x7b, 0x0c, 0x81, 0x81, 0x81, 0xda, 0xc5, 0x7f, 0xc3,
+  0x3a, 0x13, 0x4a, 0xc8, 0x41, 0xdb, 0x7f, 0x3c, 0xbc, 0x12, 0xc8, 0x86,
+  0xf4, 0x4f, 0x7f, 0xa3, 0xe6, 0x44, 0x7f, 0xf2, 0xd5, 0x01, 0x7f, 0x81,
+  0x77, 0x2c, 0xca, 0x7f, 0x7f, 0xbe, 0x15, 0x3e, 0xc4, 0x81, 0xf7, 0x81,
+  0xb0, 0x40, 0x69, 0x81, 0xd2, 0x37, 0x50, 0xbe, 0x82, 0x5e, 0xaf, 0x81,
+  0x7f, 0x55, 0x7f, 0x68, 0x99, 0x43, 0x13, 0x6e, 0x81, 0x49, 0x21, 0xe3,
+  0x27, 0x7f, 0xcd, 0x3d, 0xd3, 0x49, 0x62, 0x8b, 0x7f, 0x3b, 0xec, 0xdb,
+  0x1c, 0x3a, 0xf3, 0x19, 0xd9, 0x69, 0x6d, 0x18, 0x00, 0x14, 0x2c, 0xef,
+  0x21, 0x38, 0x68, 0x1e, 0xda, 0x48, 0xb3, 0xa8, 0x23, 0x60, 0xc4, 0x87,
+  0xa4, 0xa7, 0x9f, 0xde, 0xd8, 0x94, 0x38, 0x03, 0x71, 0xd2, 0xfa, 0x63,
+  0xa6, 0xc2, 0xbc, 0x04, 0xa2, 0x30, 0xc8, 0x2a, 0x7f, 0x41, 0xae, 0x40,
+  0xf5, 0xcf, 0xc8, 0xe9, 0xfe, 0xf9, 0x6b, 0x77, 0x1f, 0x07, 0x32, 0x0c,
+  0x07, 0xdf, 0x20, 0x50, 0x0a, 0xea, 0x2e, 0xe0, 0xdc, 0x1e, 0x48, 0xdd,
+  0xa5, 0x4b, 0x07, 0x00, 0x17, 0xfa, 0x06, 0xb3, 0x2a, 0x06, 0xdb, 0x48,
+  0x7b, 0xd6, 0xc6, 0x2a, 0xd5, 0xa3, 0xdc, 0xdb, 0xdf, 0x09, 0x6c, 0xc0,
+  0x09, 0xf8, 0x2f, 0x93, 0xb9, 0x2c, 0x90, 0xb5, 0x61, 0xe4, 0x63, 0x6a,
+  0xe1, 0x1b, 0x20, 0x5e, 0xcd, 0x5a, 0x06, 0x9b, 0xc3, 0xf0, 0xe6, 0x11,
+  0xa9, 0x12, 0x13, 0xba, 0x7a, 0x45, 0x04, 0xef, 0x1f, 0x0d, 0xfd, 0x1d,
+  0xdd, 0x5a, 0x73, 0x1c, 0x09, 0xc7, 0x3c, 0xe1, 0x17, 0x23, 0x56, 0x12,
+  0x81, 0x29, 0xb7, 0x81, 0x11, 0x25, 0xd8, 0x81, 0xc6, 0xd1, 0xd2, 0x19,
+  0x0c, 0x90, 0x38, 0xe8, 0x2e, 0xf8, 0xe9, 0x31, 0xb6, 0xba, 0xea, 0xed,
+  0x8d, 0x62, 0xb1, 0x11, 0x47, 0x75, 0xb2, 0x28, 0xf2, 0xf5, 0xbb, 0xca,
+  0x15, 0xf1, 0x75, 0x55, 0x39, 0x10, 0x32, 0xfc, 0xdf, 0xe3, 0xf4, 0x42,
+  0xe1, 0x24, 0x71, 0x02, 0x41, 0x0e, 0x29, 0xec, 0xb9, 0x54, 0xca, 0xe5,
+  0x07, 0x01, 0xf8, 0xc2, 0x19, 0xcc, 0xa5, 0x4c, 0x69, 0xb0, 0xbf, 0xaa,
+  0xb5, 0xd7, 0x9f, 0xcf, 0x9e, 0x06, 0x7f, 0x24, 0xfa, 0xf6, 0x5d, 0x81,
+  0xa0, 0x13, 0x81, 0xc4, 0x2e, 0x81, 0x51, 0x2c, 0xef, 0x17, 0x02, 0x7f,
+  0xe6, 0x4c, 0xf5, 0x81, 0xc5, 0x01, 0x0f, 0x7a, 0x81, 0xf4, 0x15, 0x91,
+  0x78, 0x45, 0x00, 0xfc, 0x1e, 0x31, 0xf5, 0x0c, 0xf2, 0x55, 0x66, 0x2e,
+  0x3b, 0xca, 0x0c, 0xf1, 0x22, 0x0b, 0x09, 0x0b, 0xad, 0x41, 0xaf, 0x93,
+  0x08, 0x03, 0xc2, 0xe2, 0x0c, 0xac, 0xc5, 0x18, 0xfb, 0xbf, 0x05, 0xfe,
+  0x6c, 0xf3, 0xe0, 0x3f, 0xf9, 0x98, 0x1e, 0xfe, 0x9f, 0x3a, 0xa2, 0x05,
+  0xc9, 0x16, 0xa0, 0xd7, 0xfa, 0x20, 0xd4, 0xf6, 0x09, 0x0d, 0x04, 0x7b,
+  0x36, 0x01, 0x37, 0xee, 0xb1, 0xb1, 0xdd, 0x2b, 0xd7, 0xeb, 0x40, 0x7a,
+  0x50, 0x22, 0x31, 0x41, 0x0b, 0x73, 0x84, 0xdc, 0xd9, 0xe2, 0xf0, 0xf1,
+  0x17, 0xc5, 0xb0, 0x02, 0x60, 0x81, 0x10, 0x89, 0x83, 0xb2, 0x81, 0xd7,
+  0xa0, 0x3c, 0x66, 0x4b, 0x58, 0x34, 0x7f, 0xae, 0x97, 0x0c, 0xaf, 0xa4,
+  0x0b, 0x93, 0x25, 0x4b, 0xc8, 0x1b, 0x00, 0x5d, 0x0f, 0x7f, 0xfe, 0xc3,
+  0x05, 0xdf, 0x20, 0x33, 0x9f, 0xb7, 0xe8, 0x81, 0x67, 0x49, 0xfb, 0x02,
+  0x12, 0x01, 0xc9, 0x00, 0xf8, 0x42, 0x22, 0x3b, 0xd6, 0xe6, 0xc7, 0xf4,
+  0xed, 0xe2, 0x34, 0xcd, 0xbd, 0x6f, 0xc9, 0xd1, 0xea, 0xfb, 0x07, 0x4e,
+  0xec, 0xb3, 0xbb, 0x1b, 0x1c, 0xc1, 0xfb, 0xf5, 0x5e, 0xf0, 0xca, 0x1a,
+  0xcc, 0xaf, 0x2c, 0xbf, 0xaf, 0x48, 0xc0, 0x1a, 0x4e, 0x00, 0x81, 0xc6,
+  0xfd, 0x28, 0x1f, 0xed, 0x09, 0x0e, 0xe4, 0x2b, 0x34, 0xeb, 0xff, 0xdd,
+  0x90, 0x9b, 0xcf, 0xad, 0xd2, 0x99, 0x7f, 0x7f, 0x6b, 0x1f, 0x29, 0x79,
+  0xfb, 0x7f, 0xab, 0x22, 0xff, 0x07, 0xaa, 0x00, 0x2a, 0xd9, 0xe0, 0xf2,
+  0x3e, 0xaa, 0x33, 0x81, 0x9a, 0xd8, 0xe1, 0xb2, 0x81, 0x7f, 0x64, 0x28,
+  0x76, 0x1b, 0x37, 0xa9, 0xf0, 0xfe, 0xc3, 0xb9, 0x19, 0x85, 0x2c, 0x48,
+  0xec, 0xec, 0xca, 0x18, 0x2d, 0x3e, 0xb5, 0xac, 0x05, 0xe9, 0x57, 0x3c,
+  0x96, 0x83, 0x2b, 0xc3, 0x2e, 0x4c, 0xec, 0xec, 0x00, 0x03, 0x95, 0xf9,
+  0x10, 0xff, 0x44, 0x65, 0xc9, 0xee, 0xae, 0xe6, 0xca, 0xe3, 0x32, 0x81,
+  0xdf, 0x4d, 0x19, 0xa5, 0xd2, 0xff, 0x2c, 0x02, 0x15, 0x8f, 0x81, 0x09,
+  0x27, 0x05, 0x86, 0x14, 0x7f, 0xed, 0xe1, 0xef, 0xfb, 0xa7, 0x0a, 0xe1,
+  0x92, 0x3a, 0xa7, 0x1f, 0x53, 0x07, 0x9d, 0xe6, 0x0f, 0x2e, 0x35, 0xe8,
+  0xfc, 0x13, 0x18, 0x76, 0x26, 0x47, 0xeb, 0xee, 0xaa, 0xc5, 0xb1, 0x93,
+  0xe9, 0x81, 0x40, 0x1a, 0x7f, 0xf9, 0x42, 0x56, 0x3e, 0x09, 0xc3, 0x37,
+  0xd2, 0x40, 0xe7, 0xc8, 0x21, 0xf7, 0x2d, 0xcc, 0x26, 0xa5, 0x73, 0xd2,
+  0xaa, 0x02, 0x2c, 0xc0, 0xb4, 0x49, 0x2e, 0x4f, 0x72, 0xfe, 0x3b, 0xc7,
+  0xed, 0xec, 0x0a, 0xd9, 0x2e, 0xb6, 0x21, 0xf9, 0x2b, 0xe8, 0x81, 0xf9,
+  0x1c, 0x06, 0x99, 0xb1, 0xdf, 0x93, 0x1e, 0x27, 0xc7, 0x81, 0x3a, 0xbb,
+  0xd2, 0xd6, 0xf9, 0x40, 0xe6, 0x02, 0x99, 0x01, 0xf0, 0xf3, 0x56, 0x7f,
+  0xba, 0x0d, 0xa9, 0xdd, 0x9d, 0xf5, 0x6c, 0x8a, 0x4f, 0x42, 0x6c, 0xb9,
+  0xd7, 0x0e, 0x12, 0x3d, 0x17, 0x88, 0xbd, 0xf5, 0xf9, 0xfe, 0x06, 0x31,
+  0x4f, 0xe6, 0xc4, 0x15, 0x00, 0xcd, 0x0e, 0xc4, 0xb9, 0x33, 0xf6, 0x24,
+  0x4f, 0xc2, 0xd1, 0xb0, 0x0b, 0x2d, 0x2e, 0xea, 0xe2, 0xfe, 0xf3, 0x7f,
+  0x21, 0x25, 0xd0, 0x1e, 0x81, 0xeb, 0x82, 0x81, 0x1c, 0xb8, 0x1b, 0xf0,
+  0x46, 0x03, 0x5c, 0x51, 0x67, 0x1e, 0x1c, 0x40, 0xbc, 0x38, 0xbc, 0xe4,
+  0x1f, 0xf6, 0xfb, 0xe1, 0x31, 0x4f, 0x7f, 0x27, 0x81, 0x20, 0x49, 0xcc,
+  0x0a, 0x23, 0x59, 0x68, 0x49, 0x04, 0x37, 0x83, 0x43, 0xa6, 0x27, 0xf4,
+  0x2e, 0xd0, 0x32, 0xc1, 0x40, 0xc9, 0x87, 0xdc, 0x0e, 0xda, 0x9f, 0xda,
+  0xb3, 0xa5, 0xe5, 0x1f, 0xd2, 0xbd, 0x17, 0xca, 0xf6, 0xa6, 0xfe, 0x13,
+  0xee, 0xde, 0x81, 0xf3, 0x00, 0x07, 0x7f, 0x05, 0x81, 0x25, 0x81, 0xd7,
+  0x81, 0xf7, 0x29, 0xa0, 0x65, 0x17, 0x4d, 0xf3, 0xf1, 0xff, 0xea, 0x13,
+  0x20, 0xd2, 0xd9, 0xfe, 0xd0, 0xea, 0xb8, 0x49, 0x42, 0xf6, 0x03, 0xe6,
+  0x0b, 0xfc, 0x47, 0x9b, 0xee, 0x45, 0x02, 0x0b, 0x43, 0xbf, 0x9d, 0xe9,
+  0x0a, 0x2f, 0x4f, 0x1d, 0xf9, 0xf9, 0xd0, 0xce, 0xd0, 0x32, 0xda, 0x1c,
+  0x9b, 0x1b, 0x8c, 0xc5, 0x3c, 0xc4, 0xfc, 0xaa, 0x38, 0xeb, 0x35, 0x18,
+  0x7e, 0xde, 0x00, 0x54, 0xd5, 0x44, 0xa3, 0xcc, 0x0d, 0xf6, 0x54, 0xcb,
+  0x1f, 0x50, 0x66, 0x12, 0xd7, 0x31, 0x53, 0xb2, 0xc5, 0x1d, 0x3d, 0x35,
+  0x60, 0xcb, 0x1c, 0xd3, 0x5c, 0x81, 0x03, 0xec, 0xe6, 0x1d, 0x35, 0x82,
+  0x7f, 0xd1, 0xd3, 0x99, 0xf3, 0xd1, 0x91, 0xeb, 0x81, 0xc6, 0xa7, 0x28,
+  0xd0, 0xff, 0xd7, 0xff, 0xca, 0x81, 0xba, 0x36, 0x01, 0xe9, 0x94, 0xd4,
+  0x2a, 0xfc, 0x4c, 0xe7, 0xd2, 0xfe, 0xd5, 0xb8, 0xa1, 0xe0, 0x38, 0xa6,
+  0x1c, 0xd2, 0xf3, 0xac, 0xee, 0xef, 0xa2, 0x30, 0x4f, 0xf3, 0xfd, 0xad,
+  0xc4, 0x09, 0x81, 0x1c, 0x68, 0xd3, 0xdc, 0xef, 0x22, 0x37, 0x2d, 0xd4,
+  0xc4, 0x5e, 0xf0, 0xdb, 0x0f, 0xbf, 0x9b, 0xb5, 0x2c, 0x00, 0x15, 0x20,
+  0xef, 0x37, 0x1b, 0x89, 0xc4, 0x42, 0xc7, 0x65, 0xb2, 0x4c, 0xaa, 0xe6,
+  0x50, 0xae, 0x4e, 0x96, 0x37, 0xb3, 0x0f, 0xcb, 0x7e, 0x07, 0x47, 0x7d,
+  0xf1, 0x47, 0xa8, 0xa9, 0x48, 0x1b, 0x49, 0xb7, 0x2c, 0x59, 0x16, 0xf5,
+  0xb4, 0x25, 0xcf, 0xab, 0xa3, 0x2d, 0x23, 0x0d, 0x7f, 0x9a, 0x0b, 0xdb,
+  0x5e, 0xaa, 0xaa, 0xe1, 0x03, 0x5c, 0x3a, 0xce, 0x5a, 0xb5, 0x24, 0xe7,
+  0xcb, 0xc9, 0x81, 0xad, 0x9d, 0xc6, 0x81, 0x28, 0xe7, 0xff, 0xac, 0xcc,
+  0xc9, 0x88, 0x81, 0x7f, 0xf3, 0x81, 0xda, 0x85, 0x49, 0x31, 0x48, 0xde,
+  0x3e, 0xec, 0x04, 0x81, 0xb8, 0xa8, 0x22, 0xad, 0x28, 0xee, 0xef, 0xa8,
+  0xbb, 0xe3, 0x81, 0x54, 0x7f, 0xda, 0xf3, 0xc6, 0x81, 0x4c, 0xaa, 0x30,
+  0x79, 0xbf, 0xf2, 0x04, 0x45, 0x7f, 0x7f, 0x81, 0xe1, 0x7f, 0xd2, 0xd2,
+  0xe0, 0x81, 0xda, 0x81, 0x7f, 0x2e, 0xec, 0xe8, 0x81, 0x7f, 0xeb, 0x90,
+  0x81, 0x7f, 0x81, 0x7f, 0xcc, 0x7f, 0x92, 0x1d, 0x7f, 0x8f, 0x3a, 0xd7,
+  0x21, 0x81, 0x0e, 0x81, 0x7f, 0xcf, 0x7b, 0x7f, 0x81, 0x7f, 0xb2, 0xef,
+  0x7f, 0x7f, 0x7f, 0xa8, 0x39, 0x53, 0x1f, 0xbf, 0xb3, 0x21, 0x8a, 0xdf,
+  0xd7, 0x2a, 0xdd, 0x1f, 0x65, 0x81, 0xc7, 0x14, 0x7f, 0x9f, 0x90, 0xea,
+  0xeb, 0x27, 0x15, 0x81, 0x2e, 0x81, 0x4b, 0x83, 0xbe, 0x8a, 0xeb, 0x9e,
+  0x91, 0xf1, 0xce, 0x7f, 0xa6, 0xe6, 0x81, 0xb9, 0x66, 0xa4, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+  0x16, 0xfb, 0x46, 0xd6, 0xe7, 0x00, 0xf9, 0xe8, 0xf7, 0xa8, 0x32, 0x01,
+  0xf9, 0x47, 0xf6, 0x43, 0xaa, 0xd7, 0x18, 0x2c, 0xf5, 0xe1, 0xbc, 0x0c,
+  0x0e, 0xe9, 0xcb, 0x13, 0x23, 0x07, 0xd0, 0x1d, 0x04, 0x4f, 0x3f, 0x38,
+  0xce, 0x0a, 0x0d, 0x11, 0x17, 0xe3, 0x3e, 0xcb, 0x17, 0xd2, 0xd3, 0xd0,
+  0xe0, 0x13, 0x10, 0xd1, 0xfa, 0xed, 0xf7, 0xad, 0xcd, 0x3b, 0xcb, 0xe7,
+  0xcf, 0xfb, 0xd6, 0xe3, 0x61, 0xeb, 0xb5, 0xf4, 0xbd, 0xed, 0x07, 0xf3,
+  0x0e, 0x0e, 0xf8, 0x21, 0x10, 0xe3, 0x1c, 0xf7, 0x15, 0x31, 0x22, 0xde,
+  0x3b, 0x11, 0xf9, 0x02, 0xc8, 0x0f, 0xfa, 0x5a, 0xfe, 0xf6, 0x2a, 0x30,
+  0xfb, 0xe1, 0x37, 0xde, 0x13, 0xdc, 0x37, 0x09, 0xef, 0x11, 0xc6, 0xf9,
+  0x07, 0x0b, 0xe3, 0x81, 0xf3, 0xf9, 0x35, 0xb1, 0x24, 0x0e, 0xe1, 0x00,
+  0xe9, 0x52, 0x22, 0xeb, 0xfa, 0xf2, 0xb0, 0xfb, 0xbb, 0xd8, 0x2c, 0x18,
+  0xe8, 0x13, 0x14, 0x38, 0x6a, 0x5e, 0xc7, 0x45, 0x0d, 0x48, 0xe4, 0x24,
+  0xe8, 0x0d, 0x4d, 0x33, 0x0f, 0xf0, 0x08, 0x25, 0xe1, 0x21, 0xf9, 0x81,
+  0x2e, 0xe2, 0xff, 0xe2, 0x3a, 0x13, 0x7b, 0x9b, 0x06, 0xa1, 0xac, 0xfe,
+  0x9d, 0x75, 0x20, 0x2d, 0x23, 0xf6, 0xd1, 0x72, 0x02, 0x0e, 0x23, 0x37,
+  0xf8, 0xf0, 0x38, 0x33, 0xd0, 0xf5, 0x02, 0x26, 0x3f, 0x29, 0x2a, 0x24,
+  0x4e, 0x70, 0x3a, 0x2b, 0xfd, 0xc5, 0x33, 0x03, 0xf3, 0xf6, 0xd0, 0x58,
+  0xd0, 0xe9, 0xfd, 0x2a, 0xac, 0x0b, 0xf5, 0x60, 0xf3, 0x10, 0xce, 0xc7,
+  0x90, 0x04, 0xfe, 0xdb, 0x04, 0xcb, 0xe2, 0x28, 0x19, 0xb3, 0xfe, 0xed,
+  0x2a, 0xf8, 0x06, 0x2d, 0xd1, 0x24, 0x1b, 0xd2, 0x2a, 0x24, 0xcc, 0xdb,
+  0x85, 0x26, 0x33, 0x37, 0xe5, 0x3d, 0xe7, 0x1b, 0xcc, 0x2b, 0x22, 0xc1,
+  0x51, 0xf0, 0xe6, 0x07, 0x37, 0xe6, 0xcb, 0xd6, 0x1f, 0xe1, 0xf2, 0xf4,
+  0x38, 0x24, 0xee, 0x38, 0xbd, 0xc1, 0xd5, 0xba, 0x45, 0xa2, 0x45, 0xe2,
+  0x8b, 0x22, 0x16, 0xea, 0xc5, 0x0a, 0xb8, 0xd6, 0xef, 0x0e, 0x7f, 0xe6,
+  0x09, 0xc7, 0x13, 0x00, 0xde, 0xc3, 0x1d, 0xb5, 0x01, 0xbf, 0x1e, 0x24,
+  0x3f, 0x08, 0x2a, 0xe2, 0x40, 0xea, 0x15, 0x24, 0xfc, 0xef, 0xc0, 0xbf,
+  0xe5, 0x11, 0x01, 0x16, 0x43, 0xf4, 0x25, 0x5f, 0x3b, 0x26, 0x32, 0x54,
+  0x1f, 0x18, 0x8b, 0x00, 0x07, 0x27, 0x46, 0x5c, 0xb4, 0x26, 0xfe, 0xc3,
+  0x03, 0x29, 0xfb, 0x08, 0xf4, 0x0f, 0x44, 0x5f, 0xc2, 0x0b, 0x1f, 0xcd,
+  0x1a, 0x38, 0xfe, 0xe7, 0x39, 0xf6, 0xd3, 0xc0, 0x25, 0x36, 0x50, 0x05,
+  0x84, 0x29, 0x4e, 0x58, 0x2d, 0x4d, 0x24, 0x06, 0xcf, 0xb9, 0xf2, 0x3f,
+  0xf3, 0xf7, 0x1f, 0xca, 0xf8, 0x19, 0x9d, 0xc9, 0x50, 0x1c, 0x60, 0x3b,
+  0xbc, 0x01, 0xb6, 0x27, 0x0e, 0x2e, 0x33, 0x13, 0x2b, 0x54, 0xf1, 0x22,
+  0xba, 0xf2, 0x0d, 0x14, 0xbe, 0xf7, 0x4b, 0xdb, 0x10, 0xe5, 0xdf, 0xf3,
+  0xa8, 0xe1, 0xaf, 0x16, 0xee, 0x1b, 0x37, 0x0c, 0x2a, 0x02, 0x1c, 0xdd,
+  0x52, 0xbe, 0x9a, 0xfe, 0xcc, 0x4b, 0xcb, 0xf2, 0xda, 0x50, 0xc3, 0x55,
+  0x0b, 0x2e, 0xe1, 0x2e, 0xa7, 0xfe, 0xe7, 0xd8, 0x05, 0xc5, 0xe1, 0x12,
+  0x25, 0x20, 0xfa, 0xef, 0xed, 0x32, 0x44, 0x1c, 0xe8, 0xf3, 0xca, 0xfd,
+  0xec, 0x0d, 0x21, 0xe7, 0xe0, 0x39, 0xd2, 0x25, 0x94, 0xcb, 0xd5, 0x1a,
+  0x06, 0xf4, 0x3f, 0xe4, 0xcb, 0x54, 0x04, 0xe8, 0x03, 0xd0, 0x17, 0x16,
+  0x21, 0xcb, 0x16, 0x0b, 0xdd, 0x0b, 0x1c, 0xf0, 0xbf, 0x60, 0x1a, 0xe5,
+  0x09, 0x59, 0xfc, 0x40, 0x81, 0xc9, 0xb9, 0x2f, 0xe3, 0x7b, 0xfe, 0xf1,
+  0xe0, 0x23, 0x46, 0xe8, 0x49, 0xcd, 0x08, 0xec, 0x19, 0xdb, 0xc4, 0x17,
+  0x1f, 0x03, 0x19, 0xae, 0xdc, 0x1d, 0xfb, 0xd6, 0x31, 0x22, 0x14, 0xfd,
+  0xed, 0xc0, 0x17, 0x35, 0x1f, 0x19, 0x18, 0x26, 0x09, 0x4e, 0xc9, 0xe3,
+  0x63, 0x03, 0xf3, 0xba, 0xe7, 0x05, 0xf7, 0xf6, 0xa9, 0xa3, 0x08, 0xce,
+  0x10, 0x59, 0xeb, 0x0e, 0x16, 0xce, 0x20, 0xb7, 0xfe, 0x0f, 0x10, 0xf0,
+  0xf5, 0xdb, 0x08, 0x22, 0x9c, 0xf6, 0xea, 0x23, 0x3f, 0x01, 0x90, 0x2a,
+  0xf0, 0xd5, 0xc9, 0x21, 0xd0, 0xfb, 0x1f, 0xbf, 0x11, 0xf2, 0x33, 0xd3,
+  0xf2, 0x4b, 0x06, 0xf7, 0xd6, 0xdc, 0xdd, 0x2c, 0x2f, 0x0b, 0x56, 0xf4,
+  0xe4, 0xb5, 0x1c, 0xd0, 0x0a, 0x04, 0xc4, 0x2e, 0xee, 0xd3, 0xff, 0x16,
+  0xdb, 0x09, 0x21, 0xfd, 0xf7, 0xdb, 0xfb, 0x01, 0xb2, 0x2e, 0x2e, 0x14,
+  0xe4, 0x81, 0x02, 0x11, 0x0e, 0x0f, 0xf8, 0xd9, 0x33, 0xe8, 0x08, 0x07,
+  0x1f, 0x3b, 0x2b, 0x2d, 0xca, 0x1b, 0xc9, 0x0d, 0xc2, 0xdb, 0xc8, 0x0d,
+  0x17, 0x27, 0x21, 0xf1, 0x18, 0x1d, 0x02, 0x77, 0x44, 0xed, 0x21, 0xd4,
+  0x00, 0xea, 0xed, 0xfd, 0x3c, 0xf2, 0x28, 0xd0, 0xd0, 0xd2, 0xda, 0x52,
+  0xfc, 0xbc, 0x3d, 0xb7, 0xc1, 0xfd, 0x10, 0xd7, 0xe9, 0x17, 0xcf, 0xfc,
+  0x2f, 0xd0, 0xf5, 0xca, 0x09, 0x1c, 0x4b, 0x2d, 0xf0, 0x33, 0xf9, 0xf9,
+  0x85, 0x05, 0xdf, 0xbb, 0xaa, 0x29, 0xd8, 0x44, 0x0f, 0xc4, 0xfb, 0xe8,
+  0x28, 0xfa, 0x0c, 0xdd, 0xfb, 0x0c, 0x18, 0xd5, 0x1f, 0x0c, 0xb5, 0x47,
+  0x06, 0x4b, 0x01, 0xd1, 0x02, 0x50, 0xf5, 0x29, 0xf2, 0xe3, 0x81, 0x12,
+  0x23, 0x22, 0xe9, 0x13, 0xfd, 0x05, 0x54, 0x26, 0xe1, 0xe7, 0x14, 0x23,
+  0x36, 0xe1, 0xed, 0xfe, 0xfa, 0x65, 0x98, 0xf4, 0x1e, 0xee, 0x33, 0xf6,
+  0x0f, 0x35, 0xe4, 0x3e, 0x19, 0xfc, 0x37, 0xf4, 0xec, 0x0f, 0xf8, 0x2e,
+  0x3d, 0xb9, 0xf1, 0xab, 0x1c, 0x0a, 0x07, 0xeb, 0xd2, 0x7d, 0x09, 0x13,
+  0x68, 0xbf, 0xbd, 0xfa, 0xc1, 0xc1, 0xef, 0xd8, 0x3d, 0xdf, 0xee, 0x2c,
+  0xcd, 0xf7, 0xf8, 0xcb, 0xe0, 0x4c, 0x1a, 0x23, 0xc2, 0xff, 0xcc, 0xe1,
+  0xf6, 0x0d, 0xc1, 0xff, 0x0e, 0xc1, 0xcc, 0x57, 0xdf, 0x48, 0x04, 0xe9,
+  0x1a, 0x98, 0x42, 0xcd, 0x09, 0xee, 0xdf, 0x54, 0xc1, 0x19, 0x5a, 0x0f,
+  0xb5, 0xe6, 0x04, 0xcb, 0x43, 0x59, 0x42, 0x51, 0xbd, 0xf9, 0xfc, 0xb4,
+  0xa8, 0x38, 0x52, 0xbe, 0x1c, 0xca, 0x55, 0x81, 0xf0, 0x22, 0x2f, 0xd9,
+  0x21, 0x2e, 0x91, 0xa0, 0x04, 0x4c, 0xd9, 0xf3, 0x17, 0xbe, 0xa1, 0xaf,
+  0x4e, 0x13, 0xcd, 0xf5, 0xe8, 0x36, 0xfa, 0x0f, 0x50, 0xec, 0xa3, 0x5c,
+  0xdf, 0x25, 0xeb, 0x27, 0xc2, 0x2d, 0x03, 0xfc, 0x5e, 0xe2, 0xd9, 0x06,
+  0x58, 0xd5, 0x6e, 0x5d, 0xec, 0xbe, 0xd2, 0xeb, 0x1c, 0x22, 0x3a, 0xd2,
+  0xd9, 0xc0, 0xc0, 0xf9, 0xf6, 0xd1, 0xbf, 0xe1, 0xfc, 0xab, 0xbb, 0x29,
+  0x4c, 0xf7, 0xf5, 0xf3, 0xeb, 0xfe, 0x3c, 0xdd, 0x1d, 0xe8, 0xe6, 0xc3,
+  0xa6, 0xcc, 0xc4, 0xd4, 0xb5, 0xe9, 0x32, 0xc6, 0xef, 0xbb, 0x0a, 0xb8,
+  0x3e, 0xca, 0xd0, 0xdf, 0xe6, 0x18, 0x3e, 0x1b, 0x0a, 0xe8, 0x46, 0xfc,
+  0xb5, 0xfb, 0xe8, 0x0a, 0xe7, 0x22, 0x03, 0xcb, 0xb2, 0xdf, 0x00, 0xdc,
+  0x11, 0x30, 0xc1, 0xc7, 0x9f, 0xdc, 0x1e, 0x5a, 0x03, 0xf9, 0xeb, 0x38,
+  0xe6, 0xb8, 0xd7, 0x1c, 0xea, 0xfc, 0x5f, 0xee, 0xa8, 0xe4, 0x04, 0x2c,
+  0x5d, 0x46, 0xfd, 0xff, 0x34, 0x33, 0xa9, 0x20, 0xe9, 0xa5, 0x55, 0x26,
+  0xee, 0xc1, 0x2d, 0x3d, 0xe2, 0x52, 0x3b, 0xc9, 0x2a, 0x10, 0x33, 0x06,
+  0xec, 0xc5, 0xd4, 0xe9, 0x3a, 0xdd, 0x0a, 0x28, 0xbe, 0xc4, 0x23, 0xd4,
+  0x7f, 0x33, 0xdb, 0x0b, 0xc5, 0xdb, 0xe8, 0x23, 0x11, 0x1f, 0xfc, 0x0e,
+  0x2a, 0x3d, 0xad, 0xe6, 0xec, 0xe8, 0xd0, 0xc3, 0xde, 0x13, 0x22, 0x16,
+  0xc2, 0x37, 0xd4, 0xee, 0xdb, 0x02, 0x05, 0xfe, 0xe6, 0xff, 0x66, 0xed,
+  0xf0, 0x0b, 0x3c, 0xfc, 0x11, 0xd8, 0xc9, 0x34, 0xbe, 0x18, 0xee, 0xfd,
+  0xef, 0xf6, 0x08, 0x32, 0xfa, 0xf5, 0xab, 0x7f, 0xe6, 0xf1, 0xee, 0x18,
+  0xcb, 0xcc, 0xd0, 0xd9, 0x08, 0xf6, 0xff, 0xc0, 0xd9, 0x4b, 0xc8, 0x20,
+  0x10, 0xfa, 0xf6, 0xda, 0xc3, 0xec, 0x00, 0xdb, 0xf2, 0xe3, 0x4b, 0x24,
+  0xdb, 0xd2, 0xe7, 0x2e, 0x02, 0xf6, 0xeb, 0xe4, 0xa9, 0x45, 0x52, 0x12,
+  0xf5, 0xde, 0x15, 0xd9, 0xe0, 0xf6, 0x2c, 0xff, 0x1c, 0x13, 0x16, 0x2f,
+  0xf0, 0x19, 0x0a, 0xe5, 0x52, 0x44, 0xe8, 0x37, 0xc6, 0xe6, 0xfc, 0x18,
+  0xc1, 0x13, 0xcf, 0x3b, 0xef, 0x10, 0x1a, 0xd0, 0x3f, 0xc6, 0xe9, 0x1c,
+  0xc2, 0xd3, 0x41, 0xc6, 0x05, 0x3e, 0x03, 0xdc, 0xcd, 0x3f, 0x57, 0xf7,
+  0xe5, 0xd5, 0xd7, 0x04, 0xf7, 0xd5, 0x36, 0xed, 0x1f, 0xcc, 0x32, 0x4b,
+  0xc6, 0xb9, 0x4a, 0x13, 0x1c, 0x29, 0x15, 0x12, 0x16, 0x18, 0xfe, 0x3b,
+  0xfb, 0x9c, 0x15, 0x04, 0x0f, 0x27, 0xc5, 0x35, 0xf5, 0xea, 0x2d, 0x2a,
+  0x2c, 0xf0, 0xfe, 0xee, 0x18, 0x59, 0x36, 0x7f, 0xb4, 0x32, 0xf7, 0x08,
+  0xdc, 0x13, 0x3d, 0x0c, 0xf4, 0x21, 0x1e, 0x43, 0x43, 0x1e, 0xcb, 0xbf,
+  0xfb, 0x41, 0x34, 0x01, 0xe1, 0xc4, 0x10, 0xf1, 0xfe, 0x62, 0x07, 0xb7,
+  0x31, 0x17, 0xa4, 0x0c, 0xdd, 0x43, 0x2c, 0xf8, 0x31, 0xae, 0xcc, 0xf4,
+  0xeb, 0x0b, 0x24, 0x19, 0x10, 0x3a, 0x3e, 0xa9, 0x21, 0x0f, 0xe2, 0xd8,
+  0x2b, 0xd4, 0x17, 0xdb, 0x9e, 0xf6, 0x61, 0xd7, 0xfd, 0x0c, 0x3d, 0xcb,
+  0x12, 0xe6, 0xed, 0x2c, 0x1b, 0x06, 0xd9, 0xe2, 0x1d, 0xfb, 0xfd, 0x3a,
+  0xe3, 0x4e, 0xff, 0x31, 0xcf, 0x52, 0x37, 0xd8, 0xc9, 0x07, 0xb3, 0x7f,
+  0xd8, 0x0a, 0x20, 0x55, 0xf9, 0xbe, 0x13, 0x0c, 0x0d, 0xb3, 0xc4, 0xdf,
+  0xe6, 0xcf, 0x12, 0x16, 0xe8, 0xfc, 0x16, 0xfc, 0x09, 0x32, 0xf6, 0xfa,
+  0xdc, 0x5c, 0x01, 0xbb, 0x14, 0xe8, 0x28, 0x20, 0x51, 0x0f, 0x07, 0xbf,
+  0xcc, 0xe5, 0x02, 0x0d, 0xb5, 0xe6, 0xda, 0x28, 0x1a, 0x68, 0xcf, 0xf2,
+  0xc9, 0xad, 0x1b, 0xe6, 0xfa, 0x4d, 0x0f, 0x18, 0x4b, 0xb8, 0x29, 0x2d,
+  0xca, 0x12, 0x47, 0xf3, 0xcc, 0xfb, 0x43, 0xb8, 0x1e, 0xc1, 0x0d, 0xd3,
+  0x09, 0x17, 0x15, 0x3c, 0x00, 0xa6, 0x16, 0x28, 0xa3, 0xf6, 0x2d, 0xf4,
+  0x44, 0xc6, 0xe5, 0x0a, 0x02, 0xd1, 0x26, 0xc4, 0x1d, 0x00, 0xf6, 0x07,
+  0xda, 0x35, 0xbd, 0x35, 0x5f, 0x28, 0x08, 0xc3, 0xf3, 0x34, 0xd4, 0xd6,
+  0xfa, 0xdb, 0xf0, 0xe6, 0x0b, 0x37, 0x01, 0x6a, 0x4b, 0x2b, 0xab, 0x3b,
+  0x4d, 0x33, 0xc6, 0xfe, 0x47, 0x1e, 0xe6, 0x0c, 0x11, 0x35, 0xb8, 0x43,
+  0xe5, 0x11, 0xe2, 0xe9, 0xe5, 0xd3, 0x2a, 0x10, 0x07, 0x23, 0x10, 0x10,
+  0x30, 0x03, 0xd0, 0x18, 0x15, 0x09, 0xbf, 0xb5, 0xa2, 0x1a, 0xd1, 0x28,
+  0x5e, 0x27, 0x3f, 0x0e, 0x1f, 0x27, 0xfa, 0x01, 0x8d, 0xa6, 0xc1, 0x0a,
+  0x2b, 0xf2, 0x34, 0xf3, 0xe8, 0x5f, 0x0b, 0xe1, 0xc0, 0x1b, 0xf9, 0x27,
+  0xe9, 0xee, 0xf7, 0xe4, 0xc9, 0x12, 0xd6, 0x07, 0x16, 0xe5, 0x5c, 0xdd,
+  0x16, 0xb4, 0x06, 0x02, 0x19, 0x67, 0x46, 0xcc, 0xc5, 0x7d, 0xbc, 0xa5,
+  0xe6, 0xc8, 0xda, 0x27, 0x8f, 0x0f, 0x57, 0xff, 0xec, 0x15, 0x1c, 0x32,
+  0x30, 0xc9, 0x2e, 0x04, 0x19, 0x49, 0xe2, 0x35, 0xf5, 0xc4, 0xe9, 0x25,
+  0xc2, 0x2d, 0xe1, 0x41, 0x81, 0x46, 0x24, 0x86, 0xf2, 0xf6, 0x04, 0x12,
+  0x0b, 0x19, 0xaf, 0x08, 0x1d, 0x19, 0xb8, 0xfa, 0x5a, 0x3a, 0xea, 0xeb,
+  0x45, 0xbc, 0xe8, 0xea, 0x34, 0xda, 0x38, 0x0d, 0xd0, 0xc9, 0xf2, 0x19,
+  0xfe, 0xe2, 0x18, 0xf3, 0xf9, 0x32, 0x2e, 0xe8, 0x14, 0xda, 0x33, 0xc0,
+  0x0f, 0xd9, 0x81, 0xd6, 0xbf, 0xf3, 0xd7, 0x26, 0x48, 0x48, 0xff, 0xf2,
+  0x4d, 0x0d, 0xd1, 0x56, 0x0a, 0xf9, 0x0b, 0x37, 0xce, 0xd7, 0x26, 0x0f,
+  0x37, 0xf8, 0x7a, 0x4a, 0x18, 0x25, 0x0d, 0x20, 0x56, 0x30, 0xba, 0xff,
+  0xdb, 0x1f, 0x3c, 0x19, 0xff, 0x17, 0xfa, 0xf8, 0xb3, 0x09, 0xbe, 0x19,
+  0x46, 0xe4, 0x31, 0x5f, 0x0a, 0x01, 0xe7, 0xf4, 0xef, 0xcf, 0xd5, 0xbd,
+  0x02, 0xe5, 0x47, 0xf2, 0x28, 0x1c, 0x45, 0xfd, 0xb4, 0x05, 0x2b, 0x05,
+  0x24, 0x47, 0xfb, 0x27, 0xfc, 0xfb, 0x35, 0x2a, 0x1c, 0x0a, 0x24, 0xef,
+  0xbc, 0xeb, 0xe4, 0xcb, 0x07, 0xd0, 0x41, 0x60, 0x0e, 0x05, 0xe9, 0x2a,
+  0xcd, 0x1d, 0x3d, 0x26, 0x5d, 0xca, 0xd5, 0x1a, 0xe4, 0x09, 0xe4, 0x3e,
+  0x13, 0x27, 0x31, 0xe7, 0xe0, 0xf9, 0xf0, 0x3a, 0xc5, 0xa4, 0xaa, 0x0d,
+  0xf8, 0xe2, 0xff, 0x46, 0x1a, 0xac, 0x4f, 0xe4, 0xd6, 0xba, 0xe7, 0xe1,
+  0x47, 0x49, 0xc3, 0x2b, 0x14, 0xe7, 0x0d, 0xe6, 0xb0, 0x8d, 0x0b, 0xe5,
+  0x03, 0xc2, 0xc9, 0xf3, 0x7f, 0xae, 0x15, 0xc6, 0xc6, 0xee, 0xfb, 0xe7,
+  0x1f, 0x3c, 0xf8, 0xd9, 0xf8, 0x54, 0xc2, 0xcb, 0xf2, 0xee, 0xf1, 0xf0,
+  0xc0, 0x44, 0x10, 0xec, 0x2d, 0xdb, 0x00, 0xe3, 0x11, 0x15, 0x07, 0x3a,
+  0xbb, 0x07, 0x0b, 0xc5, 0xe0, 0x2b, 0xbd, 0x13, 0xc5, 0x24, 0x23, 0x13,
+  0xfe, 0xef, 0xc9, 0xff, 0x02, 0x1c, 0xe9, 0xed, 0xf2, 0x34, 0xed, 0x06,
+  0xe3, 0xa5, 0xfa, 0xe5, 0xd6, 0xcb, 0x08, 0xff, 0x6c, 0xfe, 0x2b, 0xff,
+  0xb5, 0x09, 0x09, 0x17, 0x30, 0x38, 0xf3, 0x53, 0x35, 0xbd, 0xcd, 0x06,
+  0xe7, 0xb0, 0x25, 0x2d, 0xec, 0x05, 0xd1, 0x4a, 0x1b, 0x2d, 0xd3, 0xe4,
+  0x3c, 0x85, 0xdf, 0xfd, 0xf9, 0x12, 0x62, 0x2b, 0x2c, 0x3f, 0x42, 0x38,
+  0xfc, 0xd2, 0x14, 0xe8, 0xdc, 0xc7, 0x16, 0xc8, 0xb4, 0xeb, 0x08, 0x16,
+  0x02, 0x53, 0x1c, 0xef, 0x70, 0x4a, 0x27, 0xf7, 0xc8, 0xde, 0xf3, 0x07,
+  0xbb, 0x12, 0xfb, 0x0a, 0xf7, 0x1a, 0x2b, 0x19, 0x2a, 0x81, 0x00, 0xe8,
+  0x09, 0xc2, 0x1f, 0xa3, 0xc7, 0x54, 0xf0, 0xc0, 0x9f, 0x35, 0xa9, 0xc5,
+  0x4b, 0x08, 0x3e, 0xde, 0x08, 0x38, 0x91, 0x14, 0x1e, 0xc4, 0x14, 0x27,
+  0x3b, 0x1f, 0x1c, 0x06, 0xc3, 0xfd, 0xe3, 0x3c, 0x3e, 0x63, 0xb4, 0xfe,
+  0x01, 0x32, 0x19, 0x0c, 0x68, 0x49, 0xd8, 0x4c, 0x1e, 0x1a, 0x31, 0x35,
+  0xbd, 0x55, 0x24, 0x1f, 0x34, 0x4a, 0xf0, 0xb8, 0x41, 0xdf, 0x04, 0x15,
+  0x2e, 0xca, 0xce, 0xc9, 0x1b, 0x29, 0xd8, 0xa9, 0xcd, 0xfb, 0x04, 0x1d,
+  0x43, 0x13, 0xd9, 0xc8, 0xc4, 0xc3, 0xc6, 0xcf, 0x23, 0x02, 0x4d, 0xfb,
+  0xc4, 0xff, 0x00, 0xcb, 0x4c, 0x41, 0xe2, 0x09, 0xcc, 0x1a, 0xc0, 0x32,
+  0x03, 0x26, 0x0d, 0xdf, 0x27, 0x3c, 0xbd, 0x25, 0x1f, 0x1f, 0x0e, 0xda,
+  0xe4, 0xac, 0xf2, 0xe1, 0x2d, 0xff, 0x17, 0x15, 0xeb, 0x15, 0x2e, 0x0f,
+  0xb2, 0xe8, 0xeb, 0xf3, 0xe0, 0x31, 0x2a, 0xfa, 0xf4, 0xe6, 0xf1, 0xa4,
+  0x1f, 0x1c, 0x4f, 0xce, 0x13, 0xd5, 0x03, 0x81, 0xdf, 0x17, 0x54, 0xe3,
+  0x14, 0x16, 0x05, 0xec, 0x4a, 0x46, 0xd1, 0xf3, 0xe0, 0xb7, 0xc1, 0xf4,
+  0xfa, 0xeb, 0x34, 0x23, 0xff, 0x38, 0xf9, 0x1b, 0xfd, 0x30, 0xc4, 0xe7,
+  0x23, 0xf0, 0xe1, 0x50, 0x01, 0xdc, 0x0c, 0x21, 0x2d, 0x03, 0xb2, 0x1c,
+  0x08, 0xfe, 0x56, 0x28, 0xe5, 0xd8, 0xfc, 0x2d, 0xec, 0xf6, 0x3c, 0xe2,
+  0x08, 0x46, 0xca, 0x69, 0x29, 0x20, 0x4e, 0x63, 0x29, 0xfd, 0x02, 0xd6,
+  0xe1, 0x18, 0xe4, 0xf2, 0x32, 0xa0, 0xb0, 0x1d, 0x3b, 0xc8, 0x1d, 0x29,
+  0x67, 0x37, 0x47, 0xbc, 0xe7, 0x41, 0x2b, 0x1b, 0xe9, 0xae, 0x10, 0x44,
+  0xf4, 0x07, 0xc2, 0x81, 0x06, 0x25, 0xaa, 0x2b, 0x1c, 0x40, 0xfd, 0xeb,
+  0xaa, 0x2c, 0x2b, 0x9f, 0x90, 0xf4, 0x36, 0x09, 0xfc, 0x68, 0xc3, 0x85,
+  0x13, 0xfd, 0x01, 0x30, 0xd6, 0x9f, 0x2a, 0xe8, 0x20, 0xc7, 0x5b, 0xe9,
+  0xda, 0x0b, 0xd6, 0xc8, 0xed, 0x27, 0x10, 0xdf, 0x13, 0xf9, 0xfe, 0x24,
+  0x3f, 0xf6, 0x07, 0x79, 0xd6, 0xa1, 0x1b, 0xbe, 0x0d, 0xaa, 0x14, 0xc3,
+  0x00, 0xb0, 0xd0, 0xd4, 0x0c, 0x46, 0x0b, 0xc7, 0x04, 0xff, 0x01, 0x8f,
+  0x4e, 0x3c, 0x57, 0xf9, 0xfa, 0xd2, 0xe2, 0xe8, 0xc2, 0x1b, 0x64, 0x47,
+  0x3f, 0xd6, 0x12, 0x20, 0xd1, 0x78, 0x2a, 0x64, 0x7c, 0x0d, 0xe2, 0xe3,
+  0x2a, 0xef, 0x17, 0xc7, 0xfa, 0x29, 0x4d, 0x0f, 0x9b, 0x03, 0xb5, 0xe7,
+  0x18, 0x51, 0x31, 0x09, 0x1c, 0x2d, 0x1d, 0xf2, 0x0e, 0xff, 0xf2, 0x1f,
+  0xc9, 0x33, 0xc4, 0xce, 0x12, 0xda, 0xdf, 0x1d, 0xd2, 0xe1, 0x03, 0xb8,
+  0xdd, 0xe1, 0xf6, 0xa1, 0xc1, 0x64, 0x90, 0x2c, 0x34, 0x13, 0x44, 0x02,
+  0xd1, 0x33, 0xd2, 0xa6, 0x35, 0x6b, 0xd5, 0xd7, 0xb9, 0xdc, 0x43, 0x64,
+  0x5b, 0x5d, 0x01, 0xc9, 0xef, 0x29, 0xcf, 0x35, 0xc1, 0x06, 0x0b, 0x43,
+  0x81, 0xb6, 0x42, 0x13, 0xf9, 0x47, 0xbc, 0x8f, 0x0e, 0xde, 0xb9, 0x71,
+  0xa9, 0x82, 0x41, 0xf6, 0xda, 0x24, 0xd2, 0x0d, 0x33, 0xe8, 0x79, 0x2b,
+  0x4b, 0x0e, 0x85, 0xd8, 0xf9, 0x5c, 0x20, 0x08, 0x5c, 0xed, 0xc6, 0xb0,
+  0x0d, 0x36, 0x28, 0x41, 0xd0, 0xc4, 0x58, 0xcd, 0x89, 0x99, 0xf3, 0x04,
+  0xd8, 0xef, 0x00, 0x1a, 0xcf, 0x81, 0x14, 0xd1, 0x16, 0x14, 0x2a, 0x14,
+  0xfe, 0xde, 0x1c, 0x03, 0xd8, 0xf1, 0xf8, 0xcc, 0xff, 0x10, 0x27, 0xf1,
+  0xbe, 0x02, 0xd7, 0xf7, 0xda, 0xe2, 0xd9, 0xb4, 0x56, 0xfb, 0xda, 0xc4,
+  0xce, 0xfe, 0x2a, 0x27, 0x25, 0x25, 0xfa, 0xe7, 0x0f, 0x1f, 0x0a, 0xd2,
+  0xde, 0x25, 0xfe, 0xf9, 0xcf, 0x1c, 0xf4, 0xe8, 0x31, 0x1b, 0x1b, 0xe4,
+  0x2f, 0xde, 0x37, 0x3c, 0xdc, 0xc6, 0x46, 0x37, 0x12, 0x54, 0x04, 0x18,
+  0x05, 0x5f, 0x11, 0x0d, 0xdb, 0x28, 0x22, 0x10, 0x96, 0x05, 0xe1, 0xe7,
+  0xe2, 0x14, 0x06, 0xe3, 0xca, 0xf0, 0xe6, 0xb7, 0xd8, 0xe0, 0xd4, 0x0e,
+  0xe6, 0x16, 0xfb, 0xf1, 0x02, 0x0d, 0x3d, 0x27, 0xe8, 0xd3, 0x16, 0xce,
+  0x2c, 0xc7, 0x09, 0x57, 0x4c, 0xf0, 0xc0, 0x18, 0x54, 0x0e, 0x21, 0xcc,
+  0xef, 0xdc, 0x19, 0x25, 0x04, 0x11, 0x28, 0x1c, 0xfa, 0x5c, 0xd2, 0x3b,
+  0x35, 0x7b, 0x4b, 0x4a, 0x3b, 0x3c, 0xdd, 0xd6, 0xe1, 0xbb, 0xb6, 0xde,
+  0xf6, 0x0b, 0x1d, 0xe3, 0xfb, 0x19, 0xd7, 0x7f, 0xd8, 0xdb, 0xe8, 0x0e,
+  0x3f, 0x41, 0xe0, 0x56, 0xfb, 0x0b, 0x2d, 0x2d, 0x1f, 0x04, 0xf0, 0x26,
+  0xf4, 0x73, 0x30, 0x64, 0x19, 0xe9, 0x17, 0x57, 0x47, 0xb3, 0x4a, 0x79,
+  0x4a, 0x4d, 0x4a, 0x30, 0xce, 0xf6, 0x1b, 0xfb, 0x15, 0x1c, 0xf6, 0xb6,
+  0xb1, 0x29, 0xb4, 0xfd, 0xec, 0x3b, 0x03, 0x1b, 0x08, 0x16, 0xc7, 0xce,
+  0xf6, 0xfa, 0xe6, 0x13, 0x38, 0xe9, 0x16, 0x21, 0x1b, 0xe5, 0x41, 0x2b,
+  0xe3, 0x23, 0x26, 0xe4, 0x4b, 0xe8, 0x44, 0xd0, 0xff, 0xc9, 0xf6, 0xad,
+  0xba, 0xc6, 0xdf, 0x4a, 0x6d, 0x1e, 0x16, 0xb9, 0x39, 0x35, 0x28, 0xa6,
+  0xe0, 0x10, 0xb9, 0x89, 0x0b, 0xfb, 0xe6, 0x9f, 0xdb, 0xdd, 0x71, 0x3e,
+  0x7f, 0x19, 0x0d, 0xf0, 0x88, 0xd1, 0xbe, 0xde, 0x81, 0xe1, 0x58, 0xb5,
+  0x06, 0xe9, 0x2d, 0x8e, 0xf1, 0xad, 0x12, 0xb0, 0x5b, 0x00, 0xec, 0xe9,
+  0x07, 0x1c, 0x33, 0x06, 0x2a, 0x01, 0x22, 0x37, 0xea, 0x7a, 0x1e, 0xdd,
+  0x00, 0x36, 0x08, 0xb7, 0xd1, 0xd4, 0xea, 0xf5, 0x08, 0x5c, 0xcd, 0xe9,
+  0x48, 0x49, 0x0c, 0x42, 0x26, 0x02, 0x00, 0x2b, 0x04, 0x3d, 0xcd, 0xfb,
+  0x1d, 0xf8, 0x17, 0xd1, 0xfa, 0xd7, 0x2d, 0x1c, 0xdc, 0x17, 0xfe, 0x48,
+  0xfd, 0x23, 0x1f, 0x0a, 0xb1, 0x37, 0x17, 0xc0, 0xf6, 0xc5, 0xef, 0x05,
+  0xf0, 0xfc, 0xf7, 0x5a, 0x21, 0xb6, 0xc8, 0x2c, 0xe3, 0xe7, 0x0f, 0x15,
+  0xcf, 0x24, 0x37, 0xf1, 0x0b, 0x2c, 0xd3, 0xbe, 0xca, 0xde, 0x33, 0x0a,
+  0xfc, 0x1a, 0xec, 0xf5, 0x17, 0xb5, 0xf0, 0x54, 0x40, 0xc3, 0x24, 0xe1,
+  0xb5, 0x3f, 0x2f, 0xd6, 0x00, 0xdd, 0x24, 0xbd, 0x2f, 0x13, 0xfe, 0xf8,
+  0xe0, 0x48, 0xae, 0xc4, 0xee, 0xdf, 0x28, 0xb8, 0xb2, 0xfa, 0xcb, 0xdb,
+  0xec, 0xc9, 0x41, 0xe7, 0xe6, 0xba, 0x93, 0xf1, 0xdc, 0xf9, 0x22, 0x2d,
+  0xef, 0xf6, 0xc3, 0x2d, 0x66, 0xf8, 0xed, 0x2d, 0xef, 0x2c, 0x58, 0x1b,
+  0x29, 0xe2, 0xed, 0xfd, 0xe4, 0x73, 0x9b, 0x24, 0xdc, 0x59, 0x54, 0xea,
+  0x12, 0x81, 0xe3, 0xec, 0x5c, 0xf8, 0x1a, 0x0c, 0xf0, 0x0e, 0x0f, 0x0d,
+  0x48, 0x2e, 0xc7, 0xd6, 0x01, 0xf8, 0xf7, 0x20, 0x1c, 0xc7, 0xdb, 0xde,
+  0xd2, 0xa7, 0x1c, 0xeb, 0xc6, 0x0d, 0xfb, 0xb8, 0xdf, 0xe6, 0x02, 0xd7,
+  0xdf, 0xe9, 0xe5, 0xfc, 0xf8, 0x0b, 0xf1, 0x20, 0x2b, 0xe9, 0x58, 0xf2,
+  0x3b, 0x07, 0xf9, 0x02, 0xfc, 0x41, 0xec, 0x02, 0xde, 0x27, 0xf5, 0x09,
+  0xd7, 0x21, 0x25, 0x1d, 0x25, 0x9d, 0x27, 0x1f, 0x21, 0xd2, 0x15, 0x3f,
+  0xe9, 0xf1, 0xd6, 0x05, 0xd4, 0xd3, 0x1b, 0xf9, 0x38, 0xd6, 0xf9, 0x04,
+  0x4b, 0xda, 0x3e, 0x26, 0x25, 0x16, 0xcb, 0xd0, 0xc8, 0x04, 0xfd, 0xe1,
+  0xd4, 0xd2, 0x32, 0x7f, 0xff, 0x23, 0x27, 0xf7, 0xcb, 0xa9, 0xf4, 0xf1,
+  0x44, 0xff, 0x3f, 0xfc, 0x0e, 0x1d, 0x05, 0xef, 0x52, 0xc0, 0xe8, 0x06,
+  0xda, 0xfa, 0x31, 0xcc, 0x25, 0x14, 0x15, 0x00, 0x33, 0x12, 0xef, 0x2a,
+  0xd1, 0xf5, 0xe5, 0xce, 0xe6, 0xce, 0x27, 0xd4, 0x52, 0x41, 0x22, 0x43,
+  0xbd, 0x35, 0x09, 0x0f, 0xe9, 0xec, 0x1b, 0xe5, 0xb9, 0xd2, 0x40, 0x0b,
+  0xef, 0xdf, 0x09, 0xf5, 0x16, 0xc1, 0xf5, 0xf3, 0xd2, 0xe6, 0x57, 0x1e,
+  0xac, 0x2a, 0x12, 0xea, 0xe3, 0xee, 0x32, 0xe2, 0x24, 0xea, 0xe5, 0xfc,
+  0x1c, 0x04, 0x1e, 0x4e, 0xeb, 0x3e, 0x20, 0x2a, 0x0e, 0x3f, 0xe2, 0x3b,
+  0xe0, 0xd9, 0x9f, 0x38, 0x28, 0xf1, 0xdf, 0x1e, 0xd1, 0xee, 0xd6, 0xd4,
+  0x33, 0xba, 0xea, 0x20, 0xf9, 0x23, 0x2e, 0xf7, 0x44, 0xee, 0x9a, 0x0f,
+  0xf1, 0xfc, 0xb5, 0xb3, 0xe4, 0x18, 0xba, 0x91, 0xa6, 0x0d, 0xb3, 0xf3,
+  0x30, 0x0c, 0xcd, 0x23, 0x9a, 0xad, 0x1d, 0xfd, 0x07, 0x22, 0xe7, 0x2b,
+  0xff, 0x56, 0x37, 0xa9, 0x0b, 0x7d, 0x0e, 0xc9, 0xde, 0xe3, 0x2f, 0x19,
+  0xf7, 0xfc, 0x37, 0x5f, 0x1e, 0x6c, 0xa4, 0x4d, 0x88, 0xe0, 0xcf, 0x1c,
+  0x3e, 0x1e, 0xe9, 0x35, 0x8a, 0x56, 0x08, 0xc6, 0xac, 0xf3, 0x52, 0xf7,
+  0x81, 0x24, 0x29, 0xe1, 0xb8, 0x12, 0x5f, 0xbb, 0x3e, 0x03, 0xf8, 0xf4,
+  0x3b, 0x31, 0xfa, 0xfa, 0xb4, 0xff, 0xc6, 0xfc, 0xed, 0xef, 0x48, 0xe7,
+  0xd5, 0x1e, 0x91, 0xd6, 0x43, 0xd0, 0xc6, 0x3b, 0x08, 0x3a, 0xce, 0x10,
+  0x01, 0x22, 0x18, 0x15, 0x21, 0x2d, 0x52, 0x1b, 0xd1, 0xfa, 0x02, 0x01,
+  0xbd, 0x96, 0x38, 0x07, 0x25, 0xde, 0x1d, 0xc6, 0x1f, 0xe3, 0xd7, 0x38,
+  0xf9, 0xfe, 0x0e, 0xcf, 0x09, 0x35, 0x51, 0x3e, 0x71, 0xeb, 0x8e, 0xec,
+  0xcb, 0x2a, 0xcb, 0xcd, 0xdc, 0xf8, 0x06, 0x7f, 0xda, 0xeb, 0x21, 0xf0,
+  0x97, 0xf8, 0xb3, 0x9c, 0xd7, 0xfb, 0x74, 0x1d, 0xec, 0xf5, 0xf3, 0x23,
+  0xe0, 0xd1, 0xee, 0x0d, 0xdb, 0xef, 0xe5, 0x14, 0xfb, 0x0f, 0x5a, 0x3a,
+  0x0d, 0xeb, 0x18, 0x49, 0x9f, 0x02, 0xd3, 0x24, 0x47, 0xe9, 0x34, 0xef,
+  0xfb, 0xfb, 0x28, 0x41, 0xbc, 0x65, 0xf2, 0x00, 0xe9, 0x00, 0xf2, 0xa3,
+  0xb2, 0xdc, 0x13, 0x04, 0xc3, 0x29, 0xd3, 0x37, 0xe4, 0xac, 0xc6, 0x5a,
+  0x0b, 0x27, 0x35, 0x06, 0x86, 0x5b, 0xee, 0xb1, 0x50, 0x03, 0x13, 0xda,
+  0xe2, 0x32, 0x02, 0x1b, 0xbd, 0xda, 0x21, 0x15, 0xc8, 0xf5, 0x4f, 0xea,
+  0x4a, 0x4b, 0xc0, 0x0a, 0x24, 0xe9, 0xee, 0x3f, 0xb8, 0x11, 0x15, 0xc3,
+  0x40, 0xfb, 0x06, 0x04, 0x35, 0x1b, 0xe1, 0x15, 0xcf, 0x4d, 0xf7, 0xfb,
+  0x4a, 0xd0, 0x7f, 0x1a, 0xc6, 0x12, 0x48, 0x28, 0xc5, 0xf1, 0x23, 0x0a,
+  0x3e, 0x11, 0xf3, 0xbb, 0xc9, 0xbd, 0xe2, 0x77, 0xa0, 0xff, 0xd9, 0xe8,
+  0xc7, 0x5a, 0x34, 0xc3, 0x6b, 0x55, 0x49, 0x2b, 0x5e, 0x33, 0xea, 0xf8,
+  0x0b, 0xf6, 0x09, 0x17, 0xbd, 0x13, 0xfd, 0x0b, 0x05, 0x3a, 0xd9, 0x14,
+  0xd9, 0x3f, 0x28, 0x1c, 0x1e, 0x34, 0x11, 0xda, 0xd5, 0x17, 0x22, 0xff,
+  0x36, 0xf0, 0x29, 0xd6, 0x5b, 0x3c, 0xd8, 0x18, 0xcb, 0x01, 0x14, 0x48,
+  0xf2, 0xf2, 0xcf, 0xdb, 0x23, 0xfa, 0xdd, 0xa9, 0x2e, 0xc9, 0xfd, 0x6b,
+  0xdd, 0xbf, 0xf7, 0x28, 0xc8, 0xf5, 0x02, 0xed, 0xf1, 0xca, 0xb9, 0xbb,
+  0xcd, 0x1c, 0xbe, 0xad, 0x18, 0xcc, 0x05, 0x32, 0xea, 0xef, 0x20, 0x11,
+  0x36, 0x42, 0x37, 0xa1, 0xd1, 0x2b, 0xf6, 0x32, 0xf1, 0x2e, 0xef, 0x18,
+  0x19, 0x22, 0x5c, 0x2c, 0xd3, 0xa4, 0xe0, 0xff, 0xb1, 0x00, 0xe2, 0xcd,
+  0x4f, 0x1f, 0xdd, 0x9f, 0x35, 0x4e, 0x1b, 0x0e, 0x26, 0xe2, 0x05, 0x29,
+  0x12, 0xfa, 0x4a, 0xb1, 0xb0, 0x28, 0xe9, 0x04, 0x03, 0x0c, 0xc8, 0x1b,
+  0x1d, 0x07, 0xfe, 0xe9, 0xf3, 0xe5, 0x4b, 0xe9, 0x2b, 0x77, 0xff, 0x03,
+  0x46, 0xb8, 0xe0, 0x82, 0xe2, 0xc0, 0xfa, 0xef, 0xfb, 0x81, 0x85, 0xb1,
+  0xfa, 0xf5, 0x4d, 0xca, 0xfe, 0xc1, 0x27, 0x36, 0x2d, 0x07, 0x16, 0x28,
+  0x9f, 0xd2, 0x2a, 0x01, 0xfa, 0x2d, 0x39, 0x2f, 0x0d, 0xc0, 0x0c, 0x19,
+  0xcf, 0xa3, 0xe5, 0x12, 0xda, 0xcc, 0xed, 0x09, 0xf6, 0x03, 0xec, 0xf5,
+  0xfa, 0xc8, 0xfd, 0x10, 0x19, 0x04, 0x50, 0xf6, 0x5f, 0x3b, 0x14, 0x29,
+  0x03, 0xef, 0x18, 0xcd, 0x33, 0x03, 0xd9, 0x2d, 0xda, 0x01, 0x0b, 0x2b,
+  0xfa, 0x07, 0xb7, 0xd0, 0xba, 0xcd, 0x22, 0xd1, 0xd6, 0xdd, 0x3a, 0xe6,
+  0x1a, 0xee, 0x1d, 0xff, 0xa8, 0x10, 0xc4, 0xd4, 0x01, 0xd1, 0xf6, 0x13,
+  0x18, 0x39, 0xf3, 0x0a, 0xe7, 0xdf, 0xc3, 0x2b, 0x05, 0x46, 0xe7, 0xff,
+  0x12, 0x0a, 0x15, 0x1f, 0x3a, 0xec, 0xd3, 0x1d, 0x1f, 0xed, 0x0b, 0xe2,
+  0xde, 0xd8, 0xe8, 0x81, 0x20, 0x02, 0x3b, 0x10, 0x02, 0xf7, 0x0b, 0xc2,
+  0xee, 0xc5, 0xf4, 0x1c, 0xf7, 0xbd, 0xfb, 0xc3, 0x01, 0x01, 0x1e, 0x16,
+  0x35, 0xe4, 0xe7, 0xf2, 0x0d, 0xfc, 0xed, 0x43, 0xc3, 0xe9, 0xff, 0x30,
+  0x03, 0xf6, 0x11, 0xf8, 0x00, 0x0f, 0x1b, 0xe7, 0xdb, 0xf0, 0x21, 0x30,
+  0x14, 0x26, 0x25, 0xed, 0xbe, 0x1f, 0xcd, 0x2d, 0xce, 0x1c, 0x2c, 0x2b,
+  0xfb, 0xe7, 0x0e, 0xe8, 0x0b, 0x0d, 0x0f, 0x17, 0x18, 0xea, 0x1e, 0x06,
+  0xd6, 0x0d, 0xd9, 0xee, 0xf6, 0x0d, 0x07, 0x20, 0x54, 0x2f, 0x27, 0x1f,
+  0xd4, 0x13, 0x25, 0x18, 0x4e, 0x09, 0x09, 0xf0, 0xf5, 0x27, 0xfc, 0x00,
+  0x6b, 0x47, 0x04, 0x63, 0x22, 0xa7, 0xf7, 0x41, 0x9e, 0x16, 0x08, 0x81,
+  0x25, 0x1d, 0x46, 0xcb, 0x00, 0xd3, 0xac, 0x11, 0x07, 0x1c, 0x01, 0x56,
+  0xfb, 0x35, 0x4f, 0xb4, 0x41, 0x50, 0xeb, 0x20, 0xf3, 0x24, 0xe0, 0x15,
+  0x1a, 0x0c, 0x1e, 0x30, 0x28, 0xf0, 0x7c, 0x67, 0x17, 0x05, 0x0b, 0x28,
+  0xda, 0x4a, 0x47, 0xfc, 0xfb, 0x00, 0x0d, 0xdc, 0xe2, 0x04, 0x4e, 0xdb,
+  0xc9, 0xea, 0x07, 0x97, 0x10, 0x22, 0x28, 0x46, 0x3c, 0x2c, 0xaf, 0x26,
+  0x2e, 0xef, 0xbd, 0x20, 0x39, 0xe4, 0x9d, 0xc5, 0xd2, 0xc2, 0xbf, 0x1b,
+  0xfa, 0xc2, 0x23, 0x33, 0x73, 0x63, 0x1a, 0xb1, 0x53, 0xe1, 0x81, 0x8a,
+  0x15, 0x25, 0xb1, 0xf4, 0x31, 0xe9, 0x0b, 0x2a, 0x10, 0xe6, 0x43, 0xdb,
+  0x0c, 0x37, 0xef, 0x26, 0xc9, 0xd6, 0xf8, 0xee, 0x1f, 0x50, 0xe7, 0xef,
+  0x2f, 0xe5, 0xcb, 0xd1, 0xee, 0xaf, 0xd5, 0x09, 0x9a, 0xd6, 0xbd, 0x8b,
+  0xc6, 0xd8, 0xf9, 0x93, 0x56, 0x1b, 0xf4, 0xff, 0xb1, 0xe6, 0xb1, 0xf8,
+  0xf0, 0xfe, 0x1c, 0xff, 0x04, 0xf7, 0xe2, 0x14, 0x4a, 0xc7, 0xfc, 0xc0,
+  0xdf, 0xe4, 0xb5, 0xd9, 0x14, 0xc6, 0xfe, 0x8c, 0xf5, 0x22, 0x04, 0x01,
+  0x20, 0xf3, 0x0d, 0x99, 0x11, 0x95, 0xee, 0x01, 0x0d, 0x81, 0xd2, 0xaa,
+  0x13, 0xb0, 0x07, 0x37, 0x2b, 0xfc, 0xb8, 0x3e, 0xcc, 0x29, 0x2a, 0x2d,
+  0xa5, 0xc5, 0x0c, 0xa1, 0xe2, 0xd3, 0x2c, 0xdb, 0xd1, 0xe7, 0x45, 0xfa,
+  0xd6, 0xe7, 0x14, 0x1b, 0xcf, 0x63, 0x3c, 0xa2, 0x1b, 0xe1, 0x02, 0xf1,
+  0x28, 0xe3, 0x0e, 0xe4, 0x05, 0xc6, 0x28, 0x08, 0x26, 0x17, 0x0f, 0x2b,
+  0x03, 0x2c, 0x9e, 0x23, 0xc6, 0x25, 0xdf, 0xee, 0x47, 0xc7, 0x23, 0xeb,
+  0x46, 0x0c, 0x10, 0xf6, 0xc6, 0xf9, 0x00, 0x23, 0xd2, 0x1a, 0x1c, 0x15,
+  0xcd, 0xc9, 0xf1, 0x5a, 0xbe, 0x41, 0x00, 0x07, 0x34, 0x10, 0xf1, 0xa7,
+  0x21, 0x11, 0x04, 0x3d, 0xf3, 0xf5, 0x58, 0x3e, 0xe7, 0xf3, 0x16, 0x24,
+  0x13, 0xdd, 0xf1, 0x0e, 0x0a, 0xc4, 0x3c, 0x14, 0xf8, 0x03, 0xca, 0xa0,
+  0x2b, 0xb0, 0x35, 0xe7, 0xc3, 0xe7, 0x11, 0xdb, 0x0b, 0xe4, 0x2a, 0xfb,
+  0xd1, 0xe9, 0xfe, 0x52, 0xbc, 0xf9, 0xb8, 0x9f, 0x4f, 0x08, 0x3d, 0x0b,
+  0x67, 0x46, 0x1c, 0x1f, 0xeb, 0x1f, 0x7e, 0xab, 0x1a, 0x27, 0x34, 0xc2,
+  0x1f, 0x29, 0xe8, 0x96, 0xb9, 0x20, 0x4a, 0xef, 0xde, 0xd4, 0xcd, 0x24,
+  0x37, 0xe1, 0x2f, 0x00, 0xef, 0xf1, 0x19, 0xae, 0x14, 0x17, 0xf0, 0x16,
+  0x12, 0x9c, 0x6b, 0xe3, 0x47, 0x72, 0xf1, 0x30, 0x09, 0x0a, 0x29, 0xeb,
+  0xb9, 0xef, 0x81, 0x10, 0xc9, 0x2f, 0x0b, 0x34, 0x45, 0xf2, 0x07, 0x20,
+  0x43, 0x37, 0xc1, 0x8f, 0x4d, 0xda, 0xf5, 0x4f, 0xff, 0x1e, 0xb7, 0xe0,
+  0x40, 0x03, 0xe7, 0xbb, 0x1c, 0x0a, 0xf8, 0x27, 0x4f, 0xd7, 0x7b, 0x82,
+  0x72, 0x02, 0xdd, 0x58, 0xae, 0x30, 0x0a, 0xdf, 0x36, 0x28, 0x1e, 0x20,
+  0x13, 0x07, 0x4b, 0xbb, 0xe4, 0x91, 0xc6, 0xf7, 0x81, 0x93, 0xb1, 0x84,
+  0x87, 0x84, 0xdd, 0xcc, 0xe0, 0x46, 0xc8, 0xb1, 0x6a, 0x2d, 0xf2, 0xb0,
+  0x4c, 0x08, 0xdc, 0x17, 0xa0, 0x91, 0x16, 0x7a, 0x68, 0x33, 0x6d, 0x46,
+  0xd6, 0x08, 0x2e, 0x23, 0x86, 0xe1, 0x5d, 0xc2, 0x66, 0x52, 0xf9, 0x62,
+  0x36, 0x09, 0x10, 0x89, 0xed, 0x42, 0xb0, 0xc5, 0x2a, 0xec, 0xd0, 0x6b,
+  0xae, 0x82, 0xa8, 0xa4, 0x9e, 0xba, 0x01, 0x0f, 0x02, 0x4d, 0xeb, 0xcc,
+  0xdf, 0x00, 0x36, 0xce, 0xcc, 0xf9, 0x25, 0x0b, 0xf6, 0xfa, 0x59, 0x4d,
+  0x3d, 0x47, 0x3b, 0x00, 0x42, 0x35, 0x16, 0x14, 0x04, 0x2d, 0xbd, 0xed,
+  0x16, 0x0b, 0x57, 0x19, 0x27, 0x11, 0xf7, 0xea, 0xf0, 0xf0, 0xf9, 0xef,
+  0x1d, 0x07, 0x3c, 0xd6, 0x0c, 0xf3, 0xc0, 0x20, 0x4b, 0xb9, 0x33, 0x0e,
+  0xf9, 0xe0, 0x44, 0x0d, 0x39, 0xe9, 0xdc, 0x04, 0xe8, 0xf3, 0x0f, 0xf2,
+  0x42, 0xdb, 0xb8, 0xf7, 0xff, 0xec, 0x8e, 0x81, 0xeb, 0x23, 0xc7, 0x09,
+  0x4d, 0x18, 0xf0, 0x0e, 0x0f, 0x17, 0xd3, 0xfe, 0xca, 0x25, 0x07, 0xdc,
+  0x27, 0xde, 0x07, 0xfb, 0x29, 0xff, 0x52, 0x26, 0xfc, 0x95, 0x64, 0x04,
+  0x76, 0x2a, 0xc8, 0x42, 0xe5, 0x17, 0x0f, 0xf9, 0xe1, 0xe1, 0xea, 0x14,
+  0xec, 0x10, 0xa5, 0x12, 0x3a, 0xe4, 0x21, 0xef, 0xcb, 0xd9, 0xb4, 0xe4,
+  0x16, 0xf3, 0xe8, 0xe0, 0xf7, 0x18, 0x0a, 0xe9, 0x1f, 0x4e, 0x5c, 0xed,
+  0xde, 0x18, 0xfd, 0x1a, 0x06, 0x33, 0xd6, 0xf7, 0xeb, 0x20, 0x1b, 0xfe,
+  0xf6, 0x41, 0x15, 0x16, 0xf8, 0xce, 0xfa, 0x28, 0xf1, 0xd6, 0x1e, 0x25,
+  0xef, 0x16, 0x01, 0xd0, 0x02, 0x19, 0x41, 0xf6, 0x14, 0x0b, 0x10, 0x1d,
+  0xe6, 0x01, 0x36, 0xd3, 0x1a, 0x1b, 0x26, 0xe4, 0xd5, 0xdd, 0xc1, 0x08,
+  0xbd, 0xbf, 0xd5, 0x38, 0xe0, 0x24, 0xf6, 0xf4, 0x7f, 0x37, 0x13, 0xff,
+  0xfa, 0x22, 0x01, 0x1e, 0xf9, 0xf6, 0xfe, 0x23, 0xef, 0x2c, 0x0f, 0xf5,
+  0xfc, 0x3d, 0xe4, 0xf0, 0x07, 0x30, 0x2a, 0xf3, 0x26, 0xfd, 0xe6, 0xd7,
+  0xf0, 0xc9, 0x0d, 0x16, 0xca, 0xf3, 0x1c, 0xd5, 0x3b, 0x17, 0xf8, 0x3b,
+  0xc3, 0xe2, 0xf2, 0x09, 0xd9, 0xce, 0xd0, 0xe0, 0xfd, 0x39, 0x26, 0xf0,
+  0x2e, 0xdb, 0x40, 0x28, 0xdb, 0xf2, 0xd0, 0x2b, 0x22, 0xe9, 0x65, 0xef,
+  0x17, 0xe9, 0xed, 0xb3, 0xd1, 0x23, 0xf3, 0xe6, 0xf4, 0x25, 0xe2, 0x06,
+  0x0a, 0xd5, 0x0a, 0x17, 0x37, 0xe2, 0x54, 0xd1, 0xa8, 0x03, 0x16, 0x46,
+  0x19, 0x23, 0xad, 0x08, 0x1a, 0x26, 0x0f, 0xfe, 0x29, 0xf8, 0xb5, 0x3e,
+  0xac, 0x2e, 0xb5, 0xd4, 0x12, 0x31, 0xda, 0xf5, 0xd2, 0x11, 0x11, 0x3c,
+  0xdb, 0xff, 0x09, 0x3c, 0x21, 0xf9, 0x33, 0xcb, 0x1e, 0x07, 0x15, 0xf7,
+  0xb3, 0x0c, 0x0b, 0x7c, 0xf4, 0x06, 0x28, 0x1b, 0x0d, 0xef, 0xe6, 0x1e,
+  0x3f, 0x51, 0xea, 0xf3, 0x50, 0xf7, 0xd8, 0x0d, 0x5f, 0xc5, 0xd0, 0x64,
+  0xb6, 0x63, 0xaa, 0x10, 0x52, 0xe8, 0x92, 0xbe, 0x50, 0x14, 0x2a, 0x03,
+  0x08, 0xdd, 0x4d, 0xfa, 0x7f, 0xe9, 0x01, 0x98, 0x18, 0x08, 0xdc, 0xb6,
+  0xcc, 0xf3, 0x63, 0x1a, 0xfc, 0xe9, 0xe8, 0xc6, 0xfd, 0x1c, 0xf3, 0xdd,
+  0x1d, 0xa1, 0xe0, 0x0a, 0x17, 0x9a, 0xd3, 0xfd, 0x1c, 0x00, 0xe1, 0xc9,
+  0xf5, 0x39, 0x07, 0xd9, 0x02, 0x58, 0xa3, 0x32, 0xd1, 0x62, 0xe7, 0xe2,
+  0xb5, 0x22, 0xf1, 0xff, 0xbb, 0xff, 0x41, 0xbe, 0xe3, 0x56, 0xfd, 0x1a,
+  0x30, 0xf7, 0x06, 0x37, 0x4a, 0x0a, 0x30, 0xd2, 0xfd, 0x20, 0xdb, 0xd7,
+  0xa8, 0x72, 0x59, 0x0c, 0xfa, 0xba, 0xdf, 0x5b, 0xfa, 0x4e, 0x10, 0xd8,
+  0x5b, 0xca, 0x14, 0xc1, 0x12, 0x50, 0xe5, 0x31, 0x4f, 0xf4, 0xf8, 0xd2,
+  0x30, 0x29, 0xef, 0x95, 0x07, 0xeb, 0xb7, 0xe3, 0xd7, 0xe6, 0x12, 0x16,
+  0xa7, 0xdc, 0x51, 0x50, 0x27, 0x12, 0x1a, 0xab, 0x2e, 0xf9, 0x81, 0xd1,
+  0x88, 0x49, 0xee, 0xcb, 0xc0, 0xa6, 0x05, 0x10, 0x36, 0xdc, 0xe3, 0xab,
+  0xdb, 0x31, 0x79, 0x0f, 0xc6, 0x15, 0xfa, 0xc6, 0xf1, 0x2b, 0xd1, 0xf4,
+  0x1c, 0x12, 0x1b, 0xfe, 0xee, 0x39, 0x0b, 0x97, 0x34, 0x14, 0x26, 0x07,
+  0x35, 0x2b, 0x0c, 0x16, 0x2b, 0xfd, 0x0e, 0xe1, 0xb0, 0xcd, 0x73, 0xbd,
+  0xa2, 0xbc, 0xd4, 0x39, 0xba, 0xed, 0xc2, 0x85, 0x90, 0xd8, 0xe2, 0x6e,
+  0xd6, 0xf3, 0x37, 0x0c, 0x19, 0x3e, 0x25, 0x46, 0xc6, 0xdc, 0xf0, 0xc9,
+  0x2f, 0xfb, 0xf6, 0xd9, 0x18, 0xf1, 0xe6, 0x04, 0xc4, 0xf9, 0x17, 0x27,
+  0x26, 0xe2, 0x05, 0x18, 0xf0, 0x29, 0x54, 0x99, 0xc2, 0xbf, 0xf0, 0x2a,
+  0xb6, 0x02, 0x5f, 0x6c, 0x15, 0xcb, 0x04, 0x03, 0xc3, 0xc2, 0xee, 0x04,
+  0x01, 0x4e, 0xcf, 0xf7, 0xcd, 0xb9, 0xa0, 0x1b, 0xef, 0x10, 0xb6, 0x13,
+  0x24, 0xe6, 0xdd, 0x0f, 0x0a, 0x78, 0xf6, 0xe2, 0xc6, 0x20, 0xbc, 0x49,
+  0x32, 0xa2, 0x36, 0xf0, 0x00, 0x2f, 0x50, 0xc4, 0xf0, 0xcc, 0xf6, 0xf0,
+  0xe5, 0x30, 0x5e, 0x1d, 0x01, 0x13, 0xb5, 0xfb, 0xad, 0x30, 0xc2, 0xce,
+  0x28, 0x1c, 0xf2, 0x08, 0xe8, 0x51, 0x01, 0xf6, 0x45, 0x0b, 0xfe, 0xc4,
+  0xdc, 0xb6, 0x52, 0xd3, 0x32, 0xdc, 0x0f, 0x81, 0x2f, 0xe2, 0xdc, 0xea,
+  0x2c, 0x03, 0x0a, 0xc8, 0x17, 0xfd, 0xd4, 0x09, 0x2d, 0x71, 0xbf, 0xf2,
+  0x18, 0x3a, 0x0f, 0xeb, 0xc1, 0x69, 0x2d, 0xb4, 0xd4, 0xd1, 0x3c, 0xc3,
+  0xd7, 0x09, 0x3e, 0xe1, 0x1d, 0x30, 0x2e, 0x39, 0x0e, 0xdf, 0x0d, 0x4f,
+  0x15, 0xeb, 0x55, 0xce, 0xf4, 0x0e, 0x4b, 0x25, 0x1e, 0xf8, 0x17, 0x52,
+  0x50, 0x4b, 0x00, 0xf2, 0xc9, 0x50, 0xf6, 0x34, 0xcb, 0x83, 0x04, 0xf0,
+  0xed, 0xeb, 0xec, 0x1f, 0x01, 0x91, 0x2d, 0x05, 0xe6, 0x01, 0x7d, 0xf1,
+  0xee, 0x29, 0x37, 0x37, 0xbe, 0xff, 0x01, 0xf3, 0xe8, 0xf5, 0x0f, 0xfd,
+  0x5e, 0x1a, 0x37, 0xee, 0x50, 0x1c, 0xa5, 0x21, 0x09, 0xf6, 0xed, 0x26,
+  0xbf, 0x09, 0xfa, 0x14, 0x7f, 0x33, 0xe7, 0x2c, 0x4c, 0x06, 0xc9, 0xfa,
+  0xce, 0xe1, 0xf1, 0x19, 0x03, 0xa4, 0xf8, 0xe9, 0x7c, 0xf4, 0x1b, 0xab,
+  0xe5, 0x05, 0x30, 0x9d, 0xef, 0x38, 0xfc, 0x3d, 0xbd, 0xc1, 0x07, 0xb4,
+  0xde, 0xe0, 0xdb, 0xfb, 0xee, 0x38, 0x23, 0x1e, 0x0f, 0x16, 0xfd, 0x0e,
+  0x29, 0x18, 0x13, 0xe6, 0x03, 0x12, 0x40, 0x16, 0x08, 0x2f, 0x21, 0x0c,
+  0xef, 0x4d, 0xde, 0x13, 0xe8, 0x2b, 0xe8, 0x3c, 0xa5, 0xfe, 0xfd, 0x1b,
+  0x1d, 0xbf, 0xed, 0xe6, 0xec, 0x33, 0x03, 0xfa, 0x97, 0x0d, 0xe1, 0xc9,
+  0xf7, 0x4e, 0xc6, 0x34, 0x0c, 0x28, 0x10, 0xd3, 0x22, 0x20, 0x26, 0x37,
+  0xdc, 0xd6, 0x02, 0x1f, 0x01, 0x19, 0xb3, 0x4d, 0xd5, 0xd8, 0x08, 0x22,
+  0x21, 0xe7, 0xcd, 0xf1, 0x29, 0x54, 0x41, 0xdd, 0xdf, 0xc8, 0xea, 0xe3,
+  0xf3, 0xfd, 0xe3, 0x7f, 0x00, 0x0f, 0xf7, 0xd3, 0xd7, 0x16, 0x2e, 0xfb,
+  0xcd, 0xab, 0x17, 0xfc, 0xd8, 0xf4, 0x06, 0xda, 0x43, 0xff, 0x15, 0xd2,
+  0xe8, 0xe6, 0xec, 0xda, 0xed, 0xd8, 0xe4, 0xfe, 0x2a, 0xed, 0x1f, 0xf8,
+  0xeb, 0xf0, 0x15, 0x05, 0x59, 0xff, 0xd1, 0xd0, 0x1f, 0x1c, 0xc1, 0x22,
+  0xea, 0xe9, 0x21, 0xe1, 0xd3, 0x14, 0x2a, 0xf2, 0xe9, 0xeb, 0xc1, 0x26,
+  0x29, 0xb6, 0x0a, 0x02, 0x38, 0xca, 0xd1, 0x34, 0xf0, 0x06, 0xf5, 0x14,
+  0xe8, 0x15, 0xe6, 0xd1, 0xe4, 0x26, 0xf6, 0x81, 0xec, 0x46, 0xe0, 0xed,
+  0x14, 0x22, 0xec, 0x16, 0x02, 0x10, 0x24, 0x09, 0xfc, 0xfa, 0x16, 0xea,
+  0x04, 0x46, 0x20, 0x2a, 0xcf, 0xe7, 0xeb, 0x39, 0xfd, 0x35, 0x5c, 0x0f,
+  0xbc, 0xb8, 0xfe, 0xff, 0xec, 0x17, 0x3f, 0xff, 0x24, 0xc9, 0x23, 0x2c,
+  0xde, 0xd4, 0xc9, 0x2b, 0x15, 0xfc, 0x0e, 0xbe, 0xf4, 0x22, 0xf2, 0xf7,
+  0xbf, 0x03, 0xf2, 0xdd, 0x0b, 0x09, 0x05, 0xcf, 0xf6, 0x2b, 0xf8, 0xec,
+  0xdb, 0xf5, 0xc1, 0xf6, 0x0d, 0x12, 0x0f, 0xf5, 0x19, 0x29, 0x0b, 0xcc,
+  0xec, 0x24, 0x1d, 0xfd, 0xd6, 0x0f, 0xe1, 0xba, 0x2e, 0xdf, 0x1e, 0x27,
+  0xd1, 0xfc, 0x27, 0xef, 0xc7, 0xf4, 0xde, 0x0f, 0xbe, 0x00, 0x28, 0x44,
+  0xe3, 0x29, 0xd2, 0xe1, 0x0a, 0xe9, 0xc0, 0xe9, 0xe1, 0x36, 0x09, 0xd9,
+  0xe1, 0xfe, 0x11, 0x08, 0xd3, 0xcd, 0xee, 0x7f, 0x4d, 0xea, 0x39, 0xec,
+  0x28, 0xff, 0x27, 0xfc, 0xc7, 0x03, 0x02, 0x1c, 0x37, 0x4d, 0x10, 0xe3,
+  0xff, 0xd2, 0xe7, 0x13, 0xe9, 0xc2, 0xd4, 0xd6, 0xa1, 0x06, 0x24, 0xff,
+  0x09, 0xf7, 0x00, 0xf7, 0xd0, 0xde, 0xea, 0xc8, 0xe6, 0xf0, 0x11, 0xc4,
+  0x2c, 0x20, 0xe9, 0xe6, 0xfc, 0x5b, 0xf0, 0x1e, 0xcb, 0xf3, 0x04, 0x0a,
+  0x4e, 0xfc, 0x07, 0x6a, 0x4a, 0xf3, 0xfc, 0xb4, 0xf7, 0x26, 0x0b, 0xf4,
+  0xe6, 0xff, 0xfd, 0x4e, 0xb8, 0x16, 0xfd, 0xee, 0x23, 0xf8, 0xd0, 0xfd,
+  0x16, 0xd6, 0xe3, 0x36, 0xf6, 0xbd, 0xee, 0xdc, 0x03, 0xd0, 0x02, 0xf0,
+  0x29, 0xdd, 0xfb, 0xdd, 0x3c, 0xd1, 0xdc, 0xfd, 0xab, 0xd1, 0x4f, 0xee,
+  0x2c, 0x4b, 0x42, 0xe9, 0x41, 0x11, 0xe3, 0x0d, 0xe9, 0x19, 0x0e, 0x2a,
+  0x1b, 0x6d, 0x32, 0xe7, 0xfd, 0xc2, 0xf5, 0xcf, 0x0b, 0xf2, 0xa7, 0x23,
+  0x11, 0x19, 0x81, 0x01, 0xf2, 0xe5, 0xa5, 0xab, 0xae, 0x2e, 0xb1, 0x05,
+  0xe7, 0x34, 0xcc, 0x1b, 0x0a, 0x4c, 0xd3, 0xe7, 0xf5, 0xfb, 0xd4, 0x2b,
+  0xf3, 0xd5, 0xea, 0xba, 0xed, 0xd1, 0xbc, 0xec, 0x2e, 0xaf, 0xb9, 0x6e,
+  0x05, 0x10, 0x39, 0x05, 0xae, 0x1e, 0xf4, 0x1a, 0x17, 0xc1, 0xa0, 0x1a,
+  0xdb, 0xff, 0x02, 0x0d, 0xab, 0x22, 0x58, 0xbb, 0xcc, 0xfd, 0xec, 0xf6,
+  0x0d, 0x15, 0xbf, 0x19, 0xc1, 0x0c, 0x1b, 0x28, 0xf1, 0x00, 0x9f, 0x36,
+  0xe0, 0x07, 0x1b, 0xe0, 0x94, 0x00, 0xe0, 0xd4, 0x44, 0x2d, 0x43, 0xd9,
+  0x22, 0x63, 0xc1, 0xda, 0x3a, 0x3b, 0xc3, 0xce, 0x34, 0xf1, 0xd0, 0xf3,
+  0x01, 0x14, 0x30, 0x0a, 0xec, 0xba, 0x4f, 0xd4, 0xcc, 0xef, 0xef, 0x0c,
+  0xd8, 0xe9, 0xdd, 0x0f, 0x01, 0x23, 0x06, 0xdb, 0xf9, 0xfe, 0xe3, 0xd6,
+  0xb3, 0xcd, 0xb2, 0x3c, 0xe5, 0x3c, 0x2e, 0xf3, 0x0e, 0x9d, 0xbc, 0xca,
+  0x07, 0x4b, 0xee, 0xe3, 0x2a, 0x38, 0x0b, 0x13, 0xbc, 0x2a, 0x11, 0xe0,
+  0xe4, 0xe6, 0xa1, 0x21, 0x74, 0xf5, 0xf1, 0xb9, 0x15, 0x14, 0x4b, 0x5b,
+  0xe6, 0x37, 0xc9, 0xfe, 0xd4, 0x67, 0xec, 0x5b, 0xf4, 0xe8, 0xf9, 0x32,
+  0x07, 0x01, 0x0f, 0x45, 0x10, 0x21, 0x68, 0xd7, 0x42, 0xd0, 0xd5, 0xdf,
+  0x76, 0xe1, 0xe7, 0x0e, 0xa5, 0x12, 0xf3, 0xe8, 0x0f, 0x7f, 0xf0, 0x20,
+  0xd5, 0xad, 0x40, 0x1c, 0xc1, 0x4f, 0x0a, 0x00, 0xd2, 0x0b, 0x37, 0xdd,
+  0xe1, 0xbf, 0x50, 0x29, 0x1b, 0xb9, 0x03, 0xed, 0x4a, 0x69, 0x14, 0xf8,
+  0x0b, 0xe8, 0x0f, 0xee, 0x06, 0xe4, 0x1c, 0xf2, 0xd2, 0x38, 0xdd, 0x12,
+  0xcf, 0x01, 0x0f, 0xf3, 0x43, 0xb9, 0xc7, 0xc4, 0xd3, 0x3a, 0x42, 0x23,
+  0xda, 0x41, 0xf8, 0x1f, 0xf0, 0x3e, 0x58, 0xc3, 0x01, 0x02, 0x8c, 0xe9,
+  0x0a, 0x35, 0x47, 0xea, 0xf7, 0x12, 0xfd, 0xf3, 0xec, 0x0c, 0x41, 0x06,
+  0xe3, 0x11, 0x08, 0x16, 0xd1, 0xd5, 0x14, 0x44, 0xfb, 0x81, 0xef, 0x0d,
+  0xf3, 0x23, 0x0a, 0xc6, 0xef, 0x11, 0xf7, 0x2d, 0xeb, 0x01, 0x1a, 0x19,
+  0x21, 0x5d, 0x04, 0xd9, 0xa1, 0xcc, 0xf2, 0xee, 0xf1, 0xb7, 0x04, 0xfd,
+  0xef, 0x50, 0xd9, 0x14, 0x08, 0x23, 0x19, 0x11, 0x01, 0xf9, 0xde, 0xef,
+  0x03, 0xf5, 0xb4, 0x10, 0xf3, 0x40, 0x35, 0xef, 0xe1, 0x15, 0x19, 0x24,
+  0xec, 0xc5, 0x07, 0x1c, 0x30, 0xc7, 0x76, 0xdc, 0x31, 0xf8, 0xf7, 0x15,
+  0x22, 0xbc, 0x20, 0x50, 0xfa, 0x01, 0x07, 0x26, 0xe5, 0xe3, 0x06, 0xfb,
+  0x3c, 0x09, 0xe3, 0x38, 0x1a, 0xeb, 0xa6, 0xe3, 0x21, 0xb6, 0xe5, 0xeb,
+  0x3c, 0xfb, 0x01, 0xe0, 0xf4, 0x04, 0xbe, 0xe6, 0xdd, 0xd2, 0x2f, 0x3b,
+  0xbc, 0x5d, 0x0e, 0xe5, 0xfd, 0x01, 0x1a, 0xaa, 0x85, 0xf3, 0xf3, 0xe3,
+  0xa5, 0xef, 0xd7, 0x17, 0xf5, 0xb9, 0x12, 0xd4, 0xf7, 0x06, 0x48, 0x1c,
+  0xff, 0x41, 0xfb, 0xe7, 0x0b, 0xf6, 0xc3, 0xec, 0x0c, 0x08, 0xba, 0x23,
+  0x19, 0x58, 0xdc, 0xf0, 0xc8, 0x0f, 0xdb, 0x55, 0x60, 0x06, 0x2e, 0xbf,
+  0xef, 0xcc, 0x1a, 0x0f, 0xce, 0xbe, 0x42, 0xce, 0x9d, 0x06, 0xe8, 0xc6,
+  0x4f, 0x28, 0x13, 0x07, 0xa9, 0x47, 0xb4, 0xe6, 0x65, 0x48, 0x0b, 0x13,
+  0xd7, 0x52, 0xd8, 0xb5, 0xfd, 0xf4, 0x09, 0x02, 0x1b, 0xff, 0x1f, 0xca,
+  0x10, 0xcd, 0x81, 0x30, 0x3a, 0x19, 0xf3, 0x32, 0x8a, 0x4b, 0x26, 0xfb,
+  0xf9, 0x17, 0xbb, 0xa3, 0x5f, 0xb2, 0xec, 0xf3, 0xd7, 0xc6, 0x13, 0x12,
+  0x5e, 0xee, 0xf5, 0x00, 0xbd, 0xf3, 0xe4, 0xf4, 0x37, 0x30, 0xf3, 0x22,
+  0x3f, 0xb1, 0x57, 0xdc, 0xdd, 0x49, 0xe3, 0x0f, 0x08, 0x70, 0x22, 0xf9,
+  0x0c, 0xfd, 0x5d, 0xc2, 0x0b, 0xc9, 0x32, 0xbb, 0x04, 0xf2, 0xd8, 0x07,
+  0x42, 0xca, 0x7f, 0x24, 0xf2, 0xb9, 0x03, 0xe6, 0xe4, 0xea, 0x2e, 0x0d,
+  0xfd, 0x07, 0xc1, 0x3d, 0xf3, 0x46, 0x16, 0x3b, 0x33, 0xe4, 0xfc, 0xf9,
+  0xe3, 0xf3, 0xe0, 0xea, 0x38, 0x0f, 0x55, 0x07, 0x05, 0xd9, 0x4b, 0xe7,
+  0xce, 0x15, 0x20, 0x26, 0x07, 0xbd, 0xf3, 0xf4, 0x55, 0x01, 0xe0, 0xc8,
+  0x39, 0xe9, 0xe7, 0x49, 0x48, 0xde, 0x5a, 0x25, 0x43, 0x3d, 0xec, 0xb9,
+  0x1a, 0x04, 0x35, 0x3d, 0xb0, 0x28, 0xd6, 0x27, 0x06, 0x14, 0xf3, 0x08,
+  0x49, 0x17, 0xdf, 0x0b, 0xda, 0xe2, 0xc0, 0xcf, 0xf2, 0x00, 0x19, 0xe7,
+  0xf1, 0xab, 0xdf, 0xf7, 0x28, 0xf3, 0x2c, 0x05, 0x18, 0x1f, 0xba, 0xf3,
+  0x0c, 0x04, 0xe6, 0x25, 0x27, 0x4b, 0x07, 0xe9, 0x28, 0x51, 0x33, 0x27,
+  0xd0, 0xa6, 0x2b, 0xfe, 0xd0, 0x25, 0x16, 0x35, 0xaf, 0x52, 0xf7, 0x52,
+  0x4b, 0x02, 0x68, 0x5a, 0x12, 0x0e, 0x3a, 0x30, 0xeb, 0xb7, 0x20, 0xcd,
+  0x24, 0x48, 0x21, 0x22, 0x2b, 0xcf, 0xd2, 0x15, 0x15, 0x11, 0xcb, 0x29,
+  0xe5, 0x6f, 0x7f, 0xc2, 0x19, 0x48, 0xdc, 0x6c, 0x48, 0x17, 0xe2, 0x0e,
+  0x06, 0x9e, 0x2c, 0xf3, 0xd1, 0x33, 0x64, 0x53, 0x53, 0x4b, 0xc5, 0xf3,
+  0xee, 0x5b, 0x3b, 0x10, 0xf6, 0x13, 0x2e, 0xe7, 0x4a, 0x4f, 0xe2, 0x26,
+  0x09, 0xb4, 0x3a, 0xfa, 0x40, 0xfe, 0x08, 0xf3, 0xdd, 0xd1, 0xeb, 0x42,
+  0xe5, 0xc4, 0xe3, 0x1b, 0x1f, 0x0e, 0xa6, 0xb2, 0x0b, 0xb0, 0x23, 0x32,
+  0x0c, 0xec, 0x11, 0x5d, 0x08, 0x61, 0xfd, 0x96, 0xf9, 0x0d, 0xe6, 0xad,
+  0xc6, 0xa8, 0xe7, 0x18, 0xe0, 0xfa, 0x35, 0x2e, 0xd9, 0x0f, 0x58, 0xa6,
+  0x15, 0x21, 0xd7, 0x0b, 0x9d, 0xec, 0x36, 0x20, 0x11, 0x56, 0xdc, 0xfa,
+  0x6d, 0x24, 0xff, 0x00, 0x41, 0xeb, 0xd8, 0x26, 0x6a, 0x2e, 0x3d, 0x52,
+  0xfc, 0xaa, 0x11, 0xec, 0xcd, 0xdc, 0xcf, 0x39, 0xc0, 0x56, 0xec, 0x5a,
+  0x09, 0xea, 0xc4, 0x47, 0xf5, 0xc2, 0xb3, 0x0b, 0x25, 0x03, 0xf5, 0x36,
+  0x15, 0x2c, 0xd9, 0xfb, 0x08, 0xd2, 0xe4, 0x53, 0xf9, 0xf5, 0xfd, 0xdf,
+  0xbd, 0x05, 0xe2, 0x22, 0xed, 0xfc, 0xe6, 0xfa, 0xaa, 0xd4, 0xc8, 0x0f,
+  0x9e, 0xfa, 0x22, 0x1e, 0xf7, 0x44, 0xf6, 0x91, 0xfe, 0x08, 0x10, 0xb1,
+  0xe6, 0xda, 0x0a, 0xd1, 0xf6, 0xb3, 0xfd, 0xf6, 0x1b, 0xca, 0x0a, 0x18,
+  0x2b, 0x81, 0xe7, 0xcd, 0x18, 0x0b, 0x23, 0xe9, 0x3a, 0x22, 0xa5, 0x4f,
+  0xd0, 0x0d, 0x0b, 0xb3, 0xe8, 0xe4, 0x0b, 0xeb, 0xda, 0xf8, 0xdb, 0x45,
+  0x00, 0x24, 0xbe, 0xc5, 0xb1, 0xae, 0x2e, 0x04, 0xfe, 0x57, 0x1a, 0xe9,
+  0x12, 0xe2, 0x53, 0x60, 0xef, 0x65, 0x2b, 0x46, 0x26, 0xdc, 0xe3, 0xd3,
+  0xf5, 0xbb, 0xa3, 0x28, 0xda, 0x0d, 0xa5, 0xe1, 0xf1, 0xf1, 0xb6, 0x07,
+  0xeb, 0x23, 0xfd, 0xe5, 0x01, 0x05, 0x0b, 0xfc, 0xc9, 0x69, 0xda, 0xcd,
+  0xe1, 0x0f, 0x95, 0x42, 0x53, 0xfd, 0xb6, 0x7d, 0x41, 0xf8, 0xdd, 0x1f,
+  0x04, 0x1c, 0x84, 0xf0, 0xea, 0xfc, 0x2b, 0xfc, 0xbc, 0x60, 0x52, 0x9a,
+  0xe0, 0x2a, 0x43, 0x17, 0x2c, 0xfa, 0x41, 0xaa, 0x2e, 0x1c, 0x03, 0x81,
+  0x20, 0x22, 0xda, 0xb2, 0x9e, 0x1c, 0x05, 0x25, 0x24, 0x25, 0x43, 0xf5,
+  0x09, 0xc0, 0x62, 0xe2, 0xbf, 0x3b, 0x46, 0xd0, 0xbe, 0x01, 0x4f, 0xee,
+  0x2e, 0xdb, 0x59, 0xd4, 0xb7, 0x11, 0xc2, 0xd3, 0xeb, 0x37, 0x06, 0xe8,
+  0x11, 0xdc, 0xdb, 0xf1, 0xe9, 0xef, 0x24, 0x17, 0xe3, 0xe5, 0x85, 0xfe,
+  0xe6, 0x0e, 0x0c, 0x0d, 0x4c, 0xa0, 0x3e, 0x0f, 0x55, 0x52, 0x37, 0x01,
+  0xb3, 0x34, 0xe8, 0x58, 0xf5, 0x3d, 0x29, 0xf8, 0x00, 0xfb, 0xf5, 0xd1,
+  0x28, 0x01, 0x63, 0xe9, 0x1b, 0x12, 0xf6, 0xcc, 0x1f, 0xfd, 0x04, 0x11,
+  0xe8, 0xfa, 0xfe, 0x2d, 0x0a, 0xf0, 0xfd, 0xe4, 0x1b, 0xd1, 0xc1, 0x02,
+  0x1d, 0x0f, 0x32, 0xef, 0x03, 0x2f, 0xee, 0x24, 0xe8, 0x13, 0xe5, 0xfd,
+  0x0c, 0x15, 0xfe, 0x3b, 0x42, 0xd0, 0xf6, 0xfa, 0x1c, 0x1a, 0xea, 0x0a,
+  0xec, 0x08, 0xbd, 0xf2, 0x04, 0x20, 0xd2, 0xbb, 0x4b, 0x25, 0x26, 0x19,
+  0xf7, 0xf2, 0x0f, 0x04, 0x4a, 0x34, 0xec, 0x20, 0x0e, 0xe5, 0xed, 0x1d,
+  0xbe, 0x17, 0xff, 0x23, 0xfb, 0xf9, 0xf9, 0x3e, 0x43, 0xd4, 0xf2, 0x0a,
+  0x81, 0x1b, 0xfc, 0xda, 0xdb, 0xfb, 0x0a, 0xd1, 0x30, 0xf5, 0xf7, 0xd5,
+  0x1c, 0xec, 0x16, 0x5a, 0xd3, 0x31, 0x13, 0xfe, 0x0a, 0x30, 0xc8, 0x22,
+  0x1e, 0x19, 0x03, 0xd6, 0x10, 0x43, 0x01, 0x1a, 0x09, 0xc8, 0x2b, 0xfe,
+  0x02, 0xc9, 0x0d, 0x45, 0x0c, 0x64, 0x29, 0xf6, 0x60, 0x01, 0x74, 0x1e,
+  0x0d, 0x06, 0x4f, 0x1e, 0xb4, 0x9d, 0x28, 0xe7, 0x50, 0x06, 0x1b, 0xaa,
+  0xf8, 0x81, 0xb6, 0x2a, 0xd5, 0x21, 0xc0, 0x01, 0x31, 0x58, 0x29, 0xdf,
+  0x34, 0x69, 0x25, 0x34, 0x34, 0x0b, 0x23, 0x2a, 0xde, 0xa4, 0xf1, 0x13,
+  0x00, 0x5e, 0x5f, 0x34, 0x49, 0x5c, 0x0c, 0xd0, 0x08, 0x3b, 0x0c, 0xe5,
+  0x0b, 0xfd, 0x18, 0x30, 0xe5, 0x0e, 0x29, 0xff, 0x1e, 0xb1, 0x28, 0xdc,
+  0x07, 0xf8, 0xf8, 0x20, 0xd7, 0xe3, 0x19, 0x20, 0xb9, 0xbd, 0xc4, 0x2a,
+  0xf8, 0x0d, 0xc0, 0xae, 0x4c, 0x9d, 0xc1, 0x27, 0xe1, 0xad, 0x34, 0x27,
+  0xf1, 0x5a, 0x19, 0xcf, 0xe6, 0xe5, 0xa3, 0xf4, 0x9e, 0xfb, 0xd5, 0xf8,
+  0x6b, 0xf5, 0x42, 0x78, 0x09, 0xc7, 0x72, 0xe0, 0xed, 0x77, 0x0c, 0xd9,
+  0xb8, 0xcc, 0x0e, 0x3f, 0x4a, 0x01, 0x19, 0x32, 0x7a, 0xe4, 0xda, 0xc2,
+  0x98, 0x35, 0x44, 0x7f, 0x00, 0xf5, 0x37, 0x41, 0x3f, 0xf8, 0x56, 0xca,
+  0x10, 0xff, 0xc6, 0x17, 0x28, 0x5d, 0x37, 0x47, 0xf4, 0xf5, 0xdf, 0x17,
+  0x47, 0x1a, 0xce, 0x3d, 0xff, 0x2b, 0x47, 0xfb, 0x2c, 0x1a, 0x26, 0x39,
+  0x14, 0x11, 0xba, 0xc5, 0x0c, 0xf9, 0xef, 0xc5, 0x00, 0x0f, 0x00, 0x3a,
+  0x59, 0x4a, 0xe6, 0x26, 0xb1, 0x38, 0xf9, 0xdb, 0x43, 0xb8, 0xef, 0xe9,
+  0x63, 0xfe, 0xe0, 0x08, 0x0a, 0xde, 0xf3, 0x1b, 0x50, 0x51, 0x07, 0xf0,
+  0xfb, 0xe9, 0x13, 0x39, 0x0a, 0xff, 0xdf, 0x21, 0x46, 0x13, 0xc0, 0xea,
+  0x31, 0xe6, 0x47, 0x30, 0xe6, 0xb7, 0xf8, 0xf0, 0xfe, 0x48, 0xd6, 0xe9,
+  0x1d, 0x0c, 0xe2, 0x29, 0x19, 0xd8, 0x02, 0xd1, 0xef, 0x14, 0x34, 0x17,
+  0x04, 0xef, 0x1b, 0x27, 0x1c, 0x18, 0xf0, 0x05, 0xd8, 0x01, 0x59, 0x2c,
+  0xfa, 0x59, 0xfa, 0xfe, 0x35, 0x3b, 0x3f, 0xfd, 0x0e, 0xaf, 0xb9, 0xd0,
+  0x0e, 0x37, 0x23, 0x68, 0xf8, 0x10, 0xb5, 0x37, 0xfc, 0x0a, 0xf2, 0x18,
+  0x81, 0x35, 0xe9, 0x14, 0xe6, 0xf2, 0xb4, 0xff, 0xdb, 0xc7, 0xc4, 0xb8,
+  0x17, 0x29, 0x14, 0xec, 0xc9, 0xcc, 0xe2, 0x03, 0xf3, 0xea, 0x1f, 0x03,
+  0xed, 0x56, 0x1a, 0xf4, 0xd2, 0xec, 0x1c, 0x54, 0xe2, 0xc9, 0x25, 0xe7,
+  0xb4, 0x01, 0x2a, 0xfe, 0xc8, 0x88, 0xe3, 0x19, 0x9b, 0x0e, 0xd8, 0xaa,
+  0x0a, 0x3a, 0x9e, 0x43, 0xba, 0xfe, 0x06, 0xf7, 0xf9, 0xf0, 0x3d, 0xc3,
+  0xed, 0xe2, 0xfa, 0xea, 0xd3, 0xcc, 0xab, 0xca, 0x1b, 0xfe, 0x21, 0xc1,
+  0x0e, 0x2e, 0x10, 0x14, 0xdb, 0x26, 0x54, 0xf6, 0x09, 0xf3, 0xef, 0x25,
+  0x05, 0x30, 0xad, 0x46, 0x18, 0x0b, 0x2e, 0x0b, 0x33, 0x32, 0x21, 0xdf,
+  0xf9, 0xf1, 0xdc, 0x1a, 0xce, 0xc1, 0xf1, 0xe1, 0xb7, 0x32, 0xce, 0x31,
+  0x37, 0xeb, 0x0c, 0xf2, 0x17, 0xba, 0x0c, 0xc2, 0x12, 0xb7, 0x2e, 0x2a,
+  0xd4, 0xd6, 0x48, 0x64, 0x05, 0x2e, 0x71, 0xf4, 0xd8, 0xb4, 0x24, 0x10,
+  0xc6, 0x6b, 0x5c, 0x1f, 0xf7, 0x1a, 0xcc, 0xee, 0x54, 0x04, 0x2a, 0x42,
+  0xe2, 0xe2, 0x2c, 0x7f, 0x24, 0xf6, 0xff, 0x22, 0xe3, 0xce, 0x9e, 0x2c,
+  0xf9, 0x4d, 0xf7, 0x1c, 0x11, 0x43, 0x3b, 0xc0, 0xf9, 0x08, 0xca, 0xd8,
+  0xee, 0xbd, 0xc1, 0x16, 0xa5, 0xb4, 0x05, 0xe6, 0x59, 0x00, 0x47, 0xc3,
+  0x02, 0x47, 0x2e, 0xdf, 0xc1, 0x68, 0x21, 0x17, 0xcc, 0xd4, 0xbd, 0xff,
+  0xea, 0x65, 0xce, 0x35, 0x6c, 0x0a, 0xe0, 0x36, 0x9f, 0x19, 0x03, 0x5f,
+  0xe3, 0xc1, 0x60, 0xc6, 0x23, 0xa5, 0xf4, 0xbe, 0x99, 0xcb, 0xf1, 0xd6,
+  0x16, 0x42, 0xfc, 0xec, 0xb2, 0x25, 0xf2, 0x3d, 0xea, 0x3e, 0x37, 0xd7,
+  0xb7, 0x5a, 0xd7, 0x20, 0x3d, 0x05, 0xdc, 0x5e, 0xe1, 0x67, 0x37, 0xcc,
+  0xd4, 0x04, 0x2b, 0x12, 0x3f, 0x16, 0xff, 0x73, 0x29, 0x2b, 0xf2, 0x21,
+  0x2c, 0x3c, 0xf5, 0x2b, 0xef, 0x13, 0xb7, 0xda, 0x29, 0x1d, 0x90, 0x39,
+  0xb1, 0x23, 0x34, 0x00, 0xf9, 0xc4, 0x50, 0x10, 0x18, 0xe3, 0xef, 0xb2,
+  0x59, 0xd3, 0xe2, 0xf0, 0xb2, 0x52, 0xbb, 0xfb, 0x6b, 0xd0, 0x2a, 0x56,
+  0xe9, 0x45, 0x15, 0x57, 0x95, 0xfc, 0xd0, 0x00, 0xf1, 0xb4, 0xc3, 0x07,
+  0x95, 0x3e, 0xe8, 0xd7, 0xe5, 0x5a, 0x07, 0xf8, 0xac, 0xd8, 0x31, 0xf4,
+  0xcc, 0x03, 0x24, 0xd7, 0xe3, 0x40, 0xf0, 0x0f, 0xc8, 0xe6, 0xc8, 0x0f,
+  0xfe, 0x0a, 0xf9, 0xb1, 0xee, 0x23, 0x1c, 0xb4, 0x55, 0xcb, 0x00, 0xbf,
+  0xe1, 0x14, 0x4b, 0x16, 0x20, 0x13, 0x14, 0x4e, 0xc4, 0xf8, 0x0f, 0xf3,
+  0x6f, 0x3a, 0x81, 0x3c, 0xc4, 0xeb, 0x05, 0x40, 0xc8, 0xdc, 0x2b, 0x2e,
+  0xd8, 0x39, 0xfb, 0xf2, 0x6e, 0xdd, 0xf3, 0x68, 0x92, 0x3e, 0x5d, 0x12,
+  0xd6, 0x27, 0xc7, 0x1a, 0x68, 0x17, 0x3e, 0x17, 0x2a, 0xe6, 0x35, 0x06,
+  0x34, 0xea, 0x48, 0xbd, 0x3d, 0x30, 0x19, 0x10, 0x03, 0x68, 0xe8, 0x54,
+  0xc4, 0xe1, 0x38, 0x7f, 0xf2, 0xd0, 0xcb, 0xc4, 0xfa, 0x91, 0x32, 0xc5,
+  0xc1, 0x1e, 0x03, 0xc7, 0xfc, 0x9f, 0xd9, 0xda, 0xd8, 0x12, 0xc1, 0xdb,
+  0x27, 0x01, 0xea, 0xd8, 0xc0, 0xbf, 0xfc, 0xe1, 0x25, 0xfe, 0xd5, 0x67,
+  0xc9, 0xb5, 0xf9, 0x14, 0xda, 0x02, 0x00, 0xd4, 0x20, 0xec, 0x21, 0xf5,
+  0xd3, 0x26, 0xbc, 0x05, 0x93, 0x3c, 0x37, 0xaf, 0xc5, 0x33, 0xca, 0x25,
+  0x5d, 0x00, 0xc3, 0x3b, 0xef, 0xd1, 0xf9, 0xde, 0xc5, 0x96, 0x12, 0xad,
+  0xff, 0xcc, 0x1b, 0x04, 0xc5, 0xea, 0x46, 0x0c, 0x08, 0x5c, 0x0f, 0x4a,
+  0x12, 0xc4, 0x92, 0x49, 0x31, 0xfd, 0x13, 0x33, 0xa8, 0x9d, 0x3e, 0x77,
+  0x5f, 0xe5, 0xc1, 0xfd, 0xb9, 0xeb, 0x13, 0x0e, 0x0d, 0xfc, 0xf6, 0x25,
+  0xfe, 0xdd, 0x27, 0x48, 0xae, 0xbe, 0x49, 0xda, 0xe4, 0xa7, 0x49, 0x13,
+  0x32, 0x33, 0x2a, 0x6d, 0x2a, 0x30, 0xe7, 0x35, 0x46, 0xdc, 0xd7, 0x11,
+  0x98, 0xf9, 0xf3, 0xd7, 0xa1, 0x0e, 0xc5, 0x0f, 0xed, 0x0f, 0x20, 0x2b,
+  0xe8, 0xaf, 0x82, 0x98, 0xe8, 0xbb, 0xf0, 0x03, 0xf8, 0xf1, 0xaa, 0xde,
+  0xf0, 0x03, 0xf9, 0x1c, 0x4d, 0xb2, 0x20, 0xd1, 0x3a, 0xe0, 0x6e, 0xfc,
+  0x4a, 0xfc, 0x1c, 0xe8, 0x15, 0xad, 0xe0, 0xd3, 0x1d, 0xc8, 0x1a, 0xb6,
+  0x1e, 0x1f, 0x4b, 0x19, 0xfd, 0x11, 0xfb, 0x16, 0xed, 0xd4, 0x56, 0x21,
+  0x86, 0xd7, 0xf6, 0xc4, 0x4a, 0x81, 0xed, 0xbe, 0x5a, 0xf2, 0xcb, 0x95,
+  0x20, 0xf7, 0xe3, 0xcb, 0xc3, 0xab, 0x2b, 0xa7, 0xda, 0x3b, 0x15, 0xb8,
+  0x0e, 0x23, 0x40, 0x11, 0x56, 0xed, 0x0d, 0x20, 0x03, 0x45, 0x40, 0xb0,
+  0x43, 0x06, 0xe0, 0x0f, 0x2f, 0x11, 0x06, 0x1a, 0x35, 0x23, 0xf7, 0x0c,
+  0xf5, 0x04, 0xe6, 0xbf, 0xf7, 0x37, 0xc3, 0x7f, 0x3e, 0x3f, 0x05, 0xe9,
+  0xe1, 0xd1, 0xc3, 0x18, 0x06, 0x28, 0x06, 0x1d, 0x24, 0x48, 0xda, 0xef,
+  0x4c, 0x51, 0xc1, 0xfb, 0xd4, 0xf9, 0xec, 0xe8, 0x4b, 0x38, 0x03, 0x0b,
+  0x0b, 0x24, 0xd5, 0x1d, 0x94, 0xea, 0xb6, 0x14, 0x2a, 0xd0, 0x0d, 0xc6,
+  0x19, 0x4e, 0x26, 0x32, 0xce, 0xde, 0x2b, 0xe6, 0x27, 0x47, 0x15, 0xe8,
+  0xf2, 0xd4, 0xfe, 0x0a, 0xd2, 0x26, 0x0f, 0xe4, 0xee, 0xb5, 0x04, 0xf9,
+  0x30, 0xdc, 0x30, 0xe2, 0xc7, 0x1d, 0xdc, 0xc1, 0xef, 0xed, 0x0d, 0xc8,
+  0xcb, 0x24, 0xcf, 0xe2, 0xed, 0xef, 0x04, 0x02, 0x01, 0x37, 0xf4, 0xf3,
+  0xf6, 0x6c, 0xd7, 0x32, 0xd6, 0x11, 0xf6, 0xd2, 0xf9, 0x34, 0x58, 0x38,
+  0xc9, 0xdc, 0x3b, 0xe8, 0xe8, 0xc0, 0xd9, 0xfc, 0x02, 0xd8, 0x09, 0xcb,
+  0x4e, 0x99, 0x31, 0xb8, 0xdd, 0xfe, 0xd8, 0x2c, 0xc5, 0xea, 0x28, 0xfe,
+  0x6d, 0xa9, 0x1b, 0x14, 0x15, 0x5c, 0x3d, 0xd1, 0xf0, 0xbf, 0xfb, 0xcb,
+  0xe1, 0x61, 0xdb, 0xdb, 0x08, 0x05, 0xe2, 0x34, 0x17, 0x02, 0x2a, 0x79,
+  0xb1, 0x1e, 0xe0, 0x72, 0x4c, 0x1c, 0xfd, 0x11, 0x28, 0xa0, 0xaa, 0xc6,
+  0xbf, 0x27, 0xc8, 0xd6, 0xe7, 0x08, 0x10, 0x48, 0xd9, 0xcc, 0x0a, 0x7f,
+  0x21, 0x0a, 0xd5, 0xc2, 0xe6, 0x30, 0x28, 0xf7, 0xe0, 0xe6, 0xc2, 0x08,
+  0x1c, 0xcb, 0x78, 0xd1, 0x2d, 0x17, 0xb2, 0x01, 0xed, 0xa1, 0xfa, 0xd4,
+  0xc4, 0x98, 0x44, 0x25, 0xc4, 0xf2, 0x3f, 0xf6, 0xe9, 0x61, 0x22, 0x2f,
+  0xe1, 0x4d, 0xe3, 0xec, 0x2b, 0xdf, 0xe3, 0xa6, 0x40, 0xe7, 0x42, 0x44,
+  0xf0, 0xa2, 0x2d, 0xe0, 0xb7, 0x1f, 0x26, 0x40, 0x28, 0x08, 0xb0, 0xe0,
+  0xd0, 0xba, 0xbe, 0xbc, 0xbd, 0x1b, 0xe5, 0x38, 0xc7, 0x01, 0x0c, 0xed,
+  0xf1, 0x0d, 0xf5, 0xc1, 0xdd, 0x03, 0x22, 0x53, 0x44, 0xdf, 0x2b, 0x38,
+  0x0f, 0xcc, 0x19, 0x13, 0x29, 0x32, 0xf4, 0x10, 0x24, 0xd4, 0x1d, 0x12,
+  0x39, 0xee, 0x4c, 0xfe, 0x10, 0xbe, 0xd2, 0xda, 0xce, 0x7f, 0xbe, 0xde,
+  0x04, 0xdf, 0x1c, 0x12, 0xe5, 0x18, 0x17, 0x0f, 0xff, 0xcc, 0x2d, 0xe9,
+  0x5a, 0xd6, 0x1e, 0xba, 0x47, 0x14, 0x00, 0x0c, 0xdb, 0xc6, 0xf9, 0x00,
+  0xeb, 0x41, 0x3d, 0xe7, 0x19, 0xd1, 0x37, 0x28, 0xc8, 0x1f, 0x1d, 0x19,
+  0x03, 0xd8, 0xec, 0xe6, 0xf4, 0xf8, 0x3c, 0xd5, 0xb1, 0xfb, 0x12, 0xd2,
+  0xd3, 0xe7, 0xbd, 0x26, 0xb9, 0x1a, 0x1d, 0x13, 0x2f, 0xe0, 0x30, 0x0f,
+  0xc1, 0x13, 0x49, 0xda, 0x09, 0xc7, 0xd0, 0x2a, 0x4b, 0x0e, 0xda, 0x10,
+  0x1e, 0x28, 0x47, 0xe5, 0xe9, 0x0c, 0xdc, 0x1b, 0x30, 0xf0, 0xff, 0x38,
+  0xd7, 0xeb, 0x3a, 0x2b, 0xe0, 0xdc, 0x16, 0x03, 0xeb, 0xf0, 0x12, 0xdf,
+  0x0f, 0xe1, 0xbe, 0x5a, 0x62, 0x26, 0x00, 0xfe, 0x39, 0xee, 0x30, 0xca,
+  0xae, 0xaf, 0x12, 0xe7, 0xb9, 0x2f, 0xbf, 0x1f, 0xfb, 0x22, 0x2c, 0x8f,
+  0x3e, 0x35, 0x36, 0x0b, 0xb8, 0xf2, 0xf0, 0x1c, 0x0e, 0xd8, 0x14, 0xf8,
+  0xb4, 0xef, 0xdf, 0xee, 0xd2, 0xf3, 0x0f, 0xf0, 0xec, 0xfe, 0x46, 0xd2,
+  0xb0, 0x3a, 0x08, 0xfd, 0x41, 0xf8, 0xb3, 0x07, 0x12, 0xcf, 0x26, 0xf0,
+  0xd6, 0xde, 0x34, 0xef, 0x38, 0x13, 0x0d, 0x26, 0x0b, 0xdb, 0x14, 0xea,
+  0x1d, 0xcc, 0xc8, 0x3a, 0xfd, 0xe1, 0x13, 0x4d, 0x34, 0xb3, 0xb4, 0x51,
+  0xf4, 0xbc, 0x40, 0x14, 0xe3, 0x3c, 0x45, 0xcf, 0xea, 0x11, 0x4f, 0x08,
+  0xfa, 0x3e, 0x09, 0x1f, 0x50, 0x6a, 0x0a, 0x56, 0x59, 0x39, 0x2b, 0xc9,
+  0xe3, 0x7f, 0x08, 0xd2, 0x38, 0x20, 0x28, 0x3b, 0x1a, 0xb1, 0x07, 0xd4,
+  0xfb, 0xf6, 0x0e, 0x0a, 0xcc, 0x0e, 0x00, 0x34, 0x0b, 0xe1, 0x1f, 0x9c,
+  0xc5, 0x01, 0xe4, 0xb8, 0x00, 0xba, 0x11, 0x5c, 0xcf, 0xd1, 0xda, 0xd2,
+  0xdb, 0x32, 0x0a, 0xe7, 0x0d, 0x1c, 0x31, 0x08, 0x2f, 0x27, 0x03, 0x17,
+  0x18, 0xa1, 0x4e, 0x2f, 0xe0, 0x66, 0x72, 0xf3, 0xcd, 0xee, 0xfe, 0x12,
+  0x22, 0x34, 0xc2, 0xdf, 0xde, 0x14, 0xed, 0x37, 0xbd, 0xd7, 0xe8, 0xf8,
+  0x24, 0x2d, 0x43, 0x26, 0x14, 0xe3, 0x37, 0xfa, 0x89, 0x36, 0xd8, 0x00,
+  0xd9, 0xbb, 0x0a, 0xca, 0x2d, 0x1a, 0x21, 0xdd, 0xf3, 0x46, 0xf1, 0xee,
+  0x39, 0x12, 0xb0, 0x08, 0x65, 0xdd, 0x33, 0x93, 0x3f, 0xc3, 0xf5, 0x13,
+  0x83, 0x66, 0xc8, 0xac, 0x09, 0x0e, 0xf2, 0x7f, 0xf7, 0xdb, 0x50, 0xcf,
+  0xc8, 0x01, 0x23, 0xf1, 0x2b, 0xff, 0xef, 0x73, 0x3d, 0xdc, 0xdb, 0x5f,
+  0xdb, 0xf1, 0xdb, 0xf8, 0xdb, 0x0d, 0xe4, 0x2e, 0xc6, 0xe7, 0x33, 0xd7,
+  0x26, 0x39, 0xd7, 0x07, 0xd2, 0x34, 0x1e, 0x05, 0xc3, 0x53, 0x3e, 0xf3,
+  0x03, 0x15, 0x3f, 0xf1, 0x0e, 0x13, 0xd4, 0xfe, 0x3b, 0x0a, 0x3c, 0xba,
+  0x27, 0xad, 0xea, 0x04, 0x1c, 0x1c, 0x76, 0x16, 0x4e, 0x42, 0x6a, 0xb6,
+  0x12, 0x2e, 0x2e, 0xe2, 0xeb, 0xe8, 0xe9, 0xd5, 0xea, 0xca, 0x2d, 0xe7,
+  0xc9, 0xe8, 0xd3, 0x38, 0xb6, 0x19, 0x81, 0xd3, 0xd8, 0x64, 0x12, 0x23,
+  0xdc, 0x08, 0x7a, 0x9e, 0xbd, 0xcd, 0x19, 0x1b, 0xe4, 0xe4, 0x5c, 0x09,
+  0x42, 0xf9, 0x25, 0xde, 0xea, 0xf8, 0x1c, 0xd9, 0xc7, 0x17, 0x04, 0x58,
+  0x1e, 0x1c, 0xf2, 0xd6, 0x08, 0xe7, 0xd1, 0xd5, 0x7d, 0x18, 0xf8, 0xc7,
+  0x24, 0xff, 0x55, 0xb7, 0xe4, 0x55, 0x2e, 0xcd, 0xc8, 0xef, 0x5f, 0x13,
+  0xf7, 0xd2, 0xf5, 0xeb, 0x25, 0xb4, 0xa1, 0x42, 0x09, 0x61, 0x0a, 0xb4,
+  0xec, 0x51, 0xfc, 0x2b, 0x15, 0x05, 0x04, 0x3c, 0x68, 0xf7, 0x29, 0xf7,
+  0xe1, 0x04, 0xbf, 0xef, 0x05, 0x14, 0x3a, 0x0e, 0xe2, 0xc8, 0xaa, 0x1c,
+  0x0f, 0x28, 0xad, 0x2e, 0xf5, 0xf5, 0x4b, 0xed, 0x54, 0x18, 0x57, 0xf8,
+  0x0e, 0x2e, 0xcb, 0x29, 0xe0, 0xf7, 0x02, 0xd6, 0xde, 0x0e, 0x54, 0x34,
+  0xf8, 0x6f, 0xd4, 0xf8, 0xf5, 0x5c, 0x27, 0xef, 0x28, 0xf5, 0xe2, 0xea,
+  0x18, 0xf0, 0x2c, 0xdc, 0x11, 0xe4, 0x0b, 0x0a, 0x30, 0x44, 0xf9, 0x4b,
+  0xc1, 0xd0, 0xe5, 0x1b, 0xee, 0xf8, 0xc2, 0x32, 0x48, 0x35, 0xd7, 0xc1,
+  0x04, 0xe1, 0x41, 0x39, 0x03, 0xd0, 0xf5, 0x4f, 0x55, 0x30, 0x1d, 0xe8,
+  0x3d, 0xd9, 0x81, 0xc7, 0xcc, 0xe8, 0xd5, 0xd7, 0x09, 0x14, 0x07, 0x4b,
+  0x16, 0xe8, 0x07, 0xdf, 0x0f, 0x49, 0x01, 0xec, 0xc7, 0xef, 0x3b, 0x48,
+  0x12, 0x1d, 0xfe, 0x18, 0x6c, 0xec, 0xe8, 0xc5, 0x3f, 0xd4, 0x14, 0x49,
+  0x1d, 0xcd, 0x25, 0xfd, 0xfe, 0xfd, 0xd4, 0x12, 0xbd, 0xee, 0x23, 0x2e,
+  0x1d, 0xf3, 0x0e, 0x36, 0x4b, 0x22, 0xe9, 0x00, 0x34, 0xfd, 0x11, 0x8e,
+  0xd8, 0xce, 0xc7, 0x1d, 0x40, 0x1d, 0xff, 0x9e, 0x3e, 0xd0, 0x9e, 0x35,
+  0xaf, 0x47, 0xfa, 0x3b, 0xf7, 0xfc, 0xf1, 0x29, 0x1a, 0xb3, 0xab, 0x0c,
+  0x24, 0x13, 0x1f, 0x4c, 0x00, 0xf6, 0xcd, 0xd2, 0xf6, 0x30, 0xaf, 0x9e,
+  0x0a, 0x7f, 0xf1, 0x18, 0x22, 0x37, 0x55, 0x45, 0xd5, 0xc5, 0x21, 0xb3,
+  0x0e, 0xcb, 0x18, 0xd7, 0xe4, 0xe0, 0x02, 0x36, 0xd3, 0xfb, 0x24, 0xcf,
+  0xef, 0x20, 0x1e, 0x14, 0x11, 0xe4, 0xa9, 0x5f, 0xda, 0x08, 0x08, 0x35,
+  0xdf, 0xc2, 0xcc, 0xd5, 0x6b, 0xbf, 0x19, 0x06, 0x69, 0xe9, 0xbd, 0x97,
+  0x01, 0xd5, 0xe2, 0x0a, 0x05, 0xb4, 0x2c, 0x05, 0x1f, 0x22, 0x0f, 0xea,
+  0x52, 0x01, 0x15, 0x13, 0x10, 0xdd, 0x09, 0xef, 0x11, 0xf8, 0xbe, 0x03,
+  0xdb, 0xbd, 0xc9, 0x26, 0xf2, 0x25, 0xfd, 0x18, 0xee, 0xc1, 0x9b, 0xff,
+  0x38, 0x24, 0x20, 0xf0, 0x0d, 0xd4, 0x15, 0x0c, 0x3e, 0x2d, 0xc7, 0x68,
+  0xba, 0x55, 0xba, 0xc1, 0x2b, 0x4c, 0x0a, 0x18, 0x5a, 0xaf, 0xc1, 0xe9,
+  0x0c, 0x35, 0x23, 0xea, 0xbf, 0x06, 0x12, 0xe5, 0x48, 0xca, 0xc0, 0xae,
+  0xbc, 0x7f, 0x05, 0x3e, 0x99, 0xf3, 0x34, 0x2b, 0xe9, 0x00, 0x04, 0x4a,
+  0x9c, 0xc6, 0xf4, 0xea, 0xf2, 0xee, 0xba, 0x0d, 0x39, 0x0a, 0xea, 0x8a,
+  0x51, 0x00, 0x53, 0xfa, 0xdc, 0x29, 0x25, 0x0a, 0x3e, 0x53, 0xf7, 0xf8,
+  0x2b, 0x2d, 0x1d, 0xf7, 0x14, 0x0f, 0x1f, 0x44, 0xe2, 0xf3, 0xe6, 0xfb,
+  0x2f, 0xca, 0xda, 0x5f, 0xbc, 0x37, 0xd8, 0x12, 0xeb, 0x3f, 0xfe, 0xef,
+  0x4d, 0xf3, 0x0a, 0x20, 0xfa, 0x0b, 0x4b, 0x1c, 0x01, 0xfc, 0xb0, 0xfb,
+  0x5d, 0x1d, 0x22, 0xde, 0x6c, 0x00, 0xdb, 0xf9, 0x09, 0xaf, 0x92, 0x4c,
+  0xef, 0xdf, 0x29, 0xb6, 0x5d, 0xbe, 0xb0, 0x22, 0xde, 0xe3, 0xd1, 0x31,
+  0x1f, 0xe0, 0xd3, 0x66, 0xb4, 0xbd, 0xec, 0xce, 0x0f, 0x39, 0x0d, 0x5a,
+  0x0d, 0x26, 0xdf, 0x25, 0x33, 0x98, 0xe7, 0x48, 0xe5, 0xe3, 0xed, 0x23,
+  0xe1, 0xba, 0x29, 0xc3, 0xeb, 0xe3, 0x21, 0xe9, 0x12, 0x0c, 0xd9, 0x0b,
+  0x16, 0xc6, 0x2b, 0x23, 0xf8, 0x1d, 0x27, 0x0d, 0x0c, 0x46, 0x0c, 0x36,
+  0xdb, 0x3c, 0x81, 0xf8, 0xf1, 0x19, 0xab, 0xf8, 0xef, 0x03, 0x02, 0x8e,
+  0xb2, 0x18, 0x4c, 0x4c, 0x0f, 0xdc, 0xbf, 0x13, 0x02, 0x75, 0xee, 0xc8,
+  0x09, 0xfe, 0x0c, 0xc2, 0x07, 0xec, 0xad, 0xdc, 0x48, 0xf5, 0x30, 0x0b,
+  0x9b, 0x37, 0x74, 0xec, 0x1e, 0x5b, 0xcf, 0x4e, 0x27, 0xb9, 0xa8, 0x65,
+  0xef, 0x62, 0x27, 0xc7, 0xfc, 0xf7, 0x05, 0xa9, 0xe2, 0x1b, 0x01, 0x12,
+  0xf4, 0xc7, 0x12, 0x61, 0x0c, 0xba, 0xe4, 0x35, 0x23, 0x5a, 0xe4, 0x78,
+  0x40, 0x55, 0x43, 0x02, 0x1f, 0xe0, 0x05, 0x2f, 0xfa, 0xc1, 0xe6, 0x2a,
+  0x3b, 0xb0, 0x23, 0x25, 0x05, 0xab, 0x30, 0xf3, 0x0c, 0xf5, 0xdf, 0x00,
+  0xea, 0x48, 0x02, 0xf8, 0x25, 0x03, 0xf0, 0x16, 0x0a, 0xff, 0x21, 0xe9,
+  0x12, 0x01, 0x3a, 0xee, 0xef, 0x30, 0x25, 0x1a, 0xb0, 0x2f, 0xcf, 0x1d,
+  0x30, 0x03, 0x4a, 0xe8, 0xea, 0xaf, 0xef, 0xe8, 0x1a, 0x2d, 0x34, 0xb8,
+  0x12, 0x30, 0xd5, 0xe6, 0xa2, 0x2e, 0xa1, 0x0e, 0xd4, 0x2c, 0xe4, 0xd4,
+  0xe6, 0xe8, 0xb0, 0xd8, 0xf6, 0x2b, 0x24, 0x34, 0x0b, 0xcc, 0x1f, 0x29,
+  0x72, 0xf7, 0x1a, 0x1c, 0x13, 0xbd, 0x51, 0x06, 0x7f, 0xea, 0xa4, 0xb7,
+  0x2d, 0xd4, 0x2a, 0x55, 0x2b, 0xcf, 0xf7, 0xdd, 0x0d, 0x68, 0x7c, 0x23,
+  0x1c, 0xe8, 0xc8, 0xeb, 0xdf, 0xf9, 0xfa, 0x2a, 0xcc, 0xf1, 0x05, 0x04,
+  0x1a, 0xf6, 0xe7, 0xf1, 0x04, 0x0e, 0xf3, 0x1f, 0xf6, 0x0e, 0x1a, 0x54,
+  0x15, 0x23, 0xf1, 0xf0, 0x28, 0x35, 0xc8, 0x0b, 0x0e, 0x17, 0x19, 0xf2,
+  0x21, 0x1a, 0x05, 0xec, 0x04, 0xc7, 0xe5, 0x0d, 0xfb, 0x7f, 0xf4, 0xe5,
+  0x37, 0xf6, 0x0c, 0x01, 0x1b, 0xe0, 0x04, 0x38, 0xc8, 0xf5, 0xe2, 0xfd,
+  0x0a, 0xeb, 0x02, 0x1b, 0x4f, 0x2c, 0xc5, 0xfc, 0xed, 0xe6, 0xe5, 0x09,
+  0x14, 0x0f, 0x1e, 0x0e, 0xee, 0xde, 0x1a, 0x10, 0xf4, 0x1e, 0x34, 0x3a,
+  0xea, 0xa8, 0xd3, 0x1a, 0x06, 0xc7, 0x34, 0xed, 0xe0, 0xf3, 0x01, 0xf9,
+  0xe3, 0xfb, 0xdc, 0x0f, 0xf8, 0x0e, 0x32, 0xff, 0x0a, 0x06, 0x0f, 0x28,
+  0xeb, 0x34, 0x28, 0xf2, 0xef, 0x12, 0xc8, 0xf5, 0x0d, 0xc9, 0xb4, 0x0c,
+  0x2a, 0x34, 0x26, 0x00, 0x02, 0x06, 0x20, 0x01, 0x26, 0xe1, 0xfb, 0x3e,
+  0xab, 0x0a, 0x0c, 0xa7, 0x9d, 0xd6, 0x4b, 0xba, 0xce, 0xff, 0x15, 0xda,
+  0x27, 0x09, 0x14, 0xec, 0x02, 0xf4, 0x37, 0xbf, 0x26, 0xed, 0x55, 0xf5,
+  0xf2, 0xe2, 0xe7, 0x05, 0x22, 0x4f, 0xfe, 0x4e, 0x46, 0x1b, 0xd0, 0xc3,
+  0xff, 0xd3, 0xf3, 0xd9, 0xf4, 0xeb, 0x00, 0x05, 0x13, 0xf1, 0xd5, 0xb8,
+  0x34, 0x03, 0x38, 0xcc, 0x42, 0xd8, 0xb3, 0xa6, 0x3b, 0x1a, 0x2f, 0xcf,
+  0x02, 0xea, 0xf9, 0x07, 0x2d, 0x2c, 0x05, 0x0b, 0xbb, 0xc6, 0x9b, 0x25,
+  0x00, 0x12, 0x30, 0x10, 0x14, 0x3e, 0xea, 0x04, 0x2d, 0xe9, 0xd9, 0x7f,
+  0x0a, 0xff, 0xd2, 0x55, 0xaf, 0xf6, 0xc1, 0xf7, 0x36, 0x2f, 0x03, 0x10,
+  0xfa, 0xb9, 0x0f, 0xd9, 0xa3, 0x0f, 0x26, 0x1f, 0xf7, 0x04, 0xf1, 0x21,
+  0xb5, 0xe6, 0xcf, 0x34, 0x4e, 0x36, 0x2f, 0x03, 0xf2, 0x4c, 0x0c, 0x14,
+  0x46, 0xd8, 0xf6, 0xe8, 0x3c, 0x2b, 0x2d, 0xc7, 0x57, 0xf5, 0x3e, 0xdb,
+  0x63, 0xe9, 0x16, 0x17, 0x00, 0xdf, 0xeb, 0xf5, 0xe7, 0x0a, 0x34, 0xff,
+  0xe5, 0xeb, 0xe8, 0xd0, 0x24, 0xc8, 0xe3, 0x71, 0xea, 0xce, 0x16, 0xd0,
+  0x97, 0x57, 0xf2, 0xb8, 0x0d, 0x1d, 0xd9, 0xf6, 0x0a, 0x3f, 0xfc, 0x02,
+  0xd3, 0xd3, 0x04, 0x69, 0xdf, 0x6e, 0x6a, 0xd7, 0xf3, 0x28, 0xf6, 0x0d,
+  0xf4, 0x11, 0xdf, 0x06, 0xe5, 0x26, 0x16, 0x05, 0xd3, 0xe3, 0x0a, 0x09,
+  0x23, 0x3a, 0x70, 0x02, 0xed, 0xf8, 0xe3, 0x2f, 0xc9, 0x2a, 0xcd, 0xfc,
+  0xf7, 0x81, 0x24, 0x02, 0xc2, 0xc2, 0x19, 0xe0, 0xaa, 0xfa, 0xfb, 0x28,
+  0x48, 0x3f, 0x04, 0xdf, 0x52, 0x1b, 0x12, 0xb8, 0x3e, 0xcd, 0xe7, 0x16,
+  0xd3, 0x0b, 0xb0, 0xf6, 0x59, 0xac, 0xe7, 0x74, 0xc4, 0x7c, 0x0a, 0xff,
+  0xd5, 0x54, 0x15, 0xe7, 0xfd, 0xf1, 0x19, 0x14, 0x27, 0xd1, 0x18, 0x18,
+  0xfb, 0xd9, 0xcd, 0xe6, 0xed, 0xe6, 0x1a, 0x15, 0x11, 0xa8, 0x19, 0xfe,
+  0x31, 0xaa, 0x54, 0xf7, 0x1d, 0x96, 0xfd, 0x44, 0xf7, 0x01, 0xbf, 0x2f,
+  0x46, 0x17, 0x55, 0xd2, 0x12, 0xb2, 0x28, 0xc7, 0x1e, 0x08, 0xdc, 0x47,
+  0x52, 0x53, 0xf4, 0xe0, 0xfa, 0x08, 0xa5, 0x0e, 0xff, 0x38, 0x1d, 0xb4,
+  0xe1, 0xb4, 0x1b, 0x1b, 0xd1, 0xdf, 0x20, 0x27, 0x8c, 0xca, 0xd1, 0xe4,
+  0x5c, 0x1c, 0xec, 0xc3, 0x45, 0xda, 0x2c, 0x10, 0x68, 0x1a, 0xd5, 0xda,
+  0xa4, 0xe0, 0xa7, 0xed, 0xcc, 0xa3, 0xe2, 0xef, 0xe4, 0xbe, 0x47, 0x27,
+  0xe8, 0xfd, 0x3a, 0xe2, 0x58, 0xd2, 0xe4, 0xe1, 0xfc, 0xcd, 0x3f, 0x6d,
+  0xb3, 0x03, 0x09, 0x7f, 0xf6, 0xf8, 0x30, 0x2d, 0xd5, 0x26, 0x40, 0x02,
+  0xc0, 0x26, 0xc1, 0x1b, 0xee, 0xbe, 0xce, 0x1e, 0x3e, 0x1a, 0x16, 0x0e,
+  0x2c, 0x2a, 0x02, 0xe0, 0xd7, 0xb7, 0x58, 0xf2, 0xd2, 0x2f, 0x0c, 0xf1,
+  0x0f, 0xf7, 0x2e, 0xe4, 0x2f, 0x13, 0xea, 0x29, 0xd2, 0x13, 0xbb, 0x24,
+  0xf8, 0x25, 0x39, 0x24, 0x4b, 0xb5, 0x8c, 0xd9, 0x3a, 0xd6, 0xf8, 0x9c,
+  0x18, 0xf8, 0xdd, 0xe9, 0xd9, 0x0c, 0xf3, 0x59, 0xf1, 0x44, 0x17, 0x53,
+  0xe8, 0xf8, 0x55, 0xad, 0x3a, 0xbf, 0xb5, 0x27, 0xf5, 0x34, 0x4e, 0x01,
+  0x43, 0x5d, 0xfe, 0xfd, 0x47, 0xf7, 0xf7, 0xc6, 0x8d, 0xf9, 0x7f, 0x0a,
+  0x1b, 0xdf, 0x1e, 0x1f, 0xb3, 0xb8, 0x1f, 0xcd, 0x07, 0xff, 0xf7, 0xda,
+  0x56, 0xda, 0xa9, 0x06, 0xfc, 0x21, 0xee, 0xfb, 0x15, 0x88, 0xf2, 0x44,
+  0xef, 0x00, 0x3a, 0x1f, 0x0b, 0x1a, 0x38, 0xc1, 0x4a, 0x0e, 0xe1, 0xef,
+  0xe4, 0x3d, 0xd9, 0x04, 0x26, 0xe3, 0xe1, 0x2c, 0x69, 0xe7, 0x47, 0x13,
+  0x2b, 0x3c, 0xfe, 0x30, 0xb6, 0x4d, 0xd2, 0xce, 0xfe, 0xec, 0xf4, 0xe0,
+  0xf2, 0xcd, 0x3b, 0xfa, 0xc0, 0xf2, 0xf1, 0xff, 0xd4, 0xe1, 0xb5, 0xe9,
+  0x13, 0xdf, 0xd3, 0x1e, 0xfa, 0xa8, 0x30, 0xde, 0xb6, 0xfb, 0xf9, 0x2b,
+  0x56, 0x2a, 0x01, 0x15, 0xd3, 0xc3, 0x08, 0xc8, 0x30, 0x0a, 0xcf, 0x26,
+  0x1b, 0x20, 0x3e, 0xdc, 0x68, 0x66, 0x14, 0x16, 0x3e, 0x08, 0xdc, 0xd0,
+  0x1d, 0x54, 0xdf, 0x40, 0x25, 0xcb, 0x70, 0x34, 0xef, 0xfd, 0x9b, 0x35,
+  0xea, 0xeb, 0x1f, 0x92, 0x50, 0xe2, 0x6e, 0xb5, 0x6b, 0xc1, 0xc7, 0xff,
+  0x1f, 0xe0, 0xe3, 0x0a, 0x4d, 0x0b, 0x4a, 0x1c, 0x10, 0xd0, 0x1e, 0x7f,
+  0xeb, 0x2c, 0xe3, 0x20, 0xf8, 0xf6, 0x0b, 0xeb, 0x35, 0xd6, 0x79, 0x63,
+  0xeb, 0xd4, 0xec, 0xdc, 0x0e, 0x36, 0x1f, 0xee, 0xe2, 0xd9, 0xf6, 0x0f,
+  0xd2, 0x31, 0x2f, 0xfa, 0xe8, 0x5b, 0xfd, 0x0e, 0x1f, 0xd7, 0x0f, 0x19,
+  0x3a, 0xa9, 0xcf, 0xa1, 0xce, 0x3d, 0x46, 0xfb, 0x0e, 0x48, 0xd6, 0x0f,
+  0x0f, 0x44, 0x51, 0x2d, 0x3c, 0xe3, 0xf2, 0x11, 0x38, 0x65, 0x0d, 0x13,
+  0x54, 0x55, 0xb7, 0x87, 0x28, 0x10, 0xed, 0x01, 0xc0, 0xe0, 0x1c, 0x49,
+  0x10, 0x00, 0xd5, 0xdb, 0xc6, 0xbb, 0xef, 0x06, 0xf5, 0xfc, 0x64, 0xbb,
+  0x11, 0x34, 0x15, 0x19, 0x2b, 0xfc, 0x2c, 0x2c, 0xdf, 0x30, 0x00, 0xc2,
+  0x6f, 0x17, 0x50, 0x2d, 0xbb, 0x27, 0x37, 0x00, 0xf7, 0xf1, 0xeb, 0x29,
+  0x38, 0xef, 0xcd, 0x17, 0x44, 0x56, 0x86, 0xcc, 0xf3, 0x25, 0x3c, 0x33,
+  0x31, 0xf4, 0xfb, 0xc7, 0x18, 0xe9, 0x5e, 0xdd, 0xaf, 0x34, 0xc4, 0xc9,
+  0x3a, 0xe9, 0xfc, 0x44, 0x33, 0xd7, 0x10, 0xbf, 0x9f, 0x76, 0x18, 0x36,
+  0x13, 0x81, 0x68, 0xd4, 0xf9, 0xbb, 0xf9, 0xe7, 0x0b, 0xc0, 0xc3, 0x45,
+  0x67, 0x21, 0x0f, 0x05, 0x3f, 0x3d, 0x9c, 0xd3, 0xd8, 0x2b, 0xae, 0xdb,
+  0x57, 0xe9, 0x1d, 0x20, 0x04, 0xd1, 0x3d, 0xc2, 0x1b, 0x07, 0xb0, 0x4c,
+  0x75, 0x0a, 0x48, 0xd6, 0x30, 0x16, 0xe0, 0x4a, 0xbb, 0xb5, 0xc9, 0x04,
+  0x08, 0xf9, 0xf9, 0x30, 0x37, 0x13, 0xc2, 0xc2, 0xed, 0x2b, 0xe8, 0xee,
+  0x16, 0xd8, 0xdb, 0xcf, 0x01, 0x02, 0xcd, 0x2c, 0xdf, 0x2e, 0x19, 0x25,
+  0x21, 0x12, 0xff, 0x1c, 0xee, 0x47, 0x08, 0xea, 0xfd, 0xdd, 0x3c, 0x00,
+  0xcf, 0xfc, 0xde, 0x12, 0x0b, 0x54, 0x22, 0xfc, 0x38, 0xc7, 0xb0, 0xe7,
+  0xe6, 0xed, 0x6e, 0x81, 0xef, 0x31, 0xf4, 0x0f, 0xec, 0x44, 0xd8, 0x0c,
+  0xf9, 0xee, 0xeb, 0xe2, 0x29, 0x4f, 0xeb, 0xff, 0xdb, 0x02, 0x35, 0xe3,
+  0x82, 0x37, 0xe3, 0x2e, 0xd4, 0x21, 0xd2, 0x8d, 0x46, 0x0a, 0xfa, 0xd8,
+  0xdc, 0x55, 0x20, 0xb3, 0x0f, 0x08, 0x15, 0xec, 0x14, 0xf4, 0x4b, 0x17,
+  0xfe, 0xcd, 0x26, 0x26, 0xcb, 0x42, 0xed, 0x0d, 0xc6, 0xfa, 0xfb, 0xdd,
+  0xf0, 0x5e, 0x5b, 0x17, 0x35, 0xd7, 0xf5, 0x12, 0x95, 0xd4, 0x2a, 0x49,
+  0xee, 0xf3, 0x13, 0x29, 0x34, 0x28, 0x2b, 0x05, 0x3b, 0x19, 0x09, 0x14,
+  0x28, 0x4b, 0x1d, 0x23, 0x23, 0x18, 0xee, 0xe4, 0xf5, 0xb9, 0x29, 0x05,
+  0x3a, 0xf9, 0x16, 0x3a, 0xcb, 0x0e, 0xe9, 0xf5, 0xf7, 0xbe, 0x57, 0xe3,
+  0xc2, 0x1d, 0xec, 0xe2, 0xf8, 0xaa, 0xbd, 0x07, 0x23, 0xde, 0x51, 0x0a,
+  0xe0, 0x05, 0xee, 0xf3, 0x09, 0xff, 0xe2, 0xeb, 0xf6, 0xd0, 0xc7, 0xcb,
+  0x2b, 0x1b, 0xfb, 0x32, 0xf9, 0x17, 0x10, 0xf5, 0x18, 0xcc, 0xc9, 0xf9,
+  0xef, 0x13, 0xcb, 0xeb, 0x32, 0xcc, 0x12, 0x03, 0xc3, 0x01, 0xc7, 0x40,
+  0xc3, 0x18, 0x31, 0x10, 0xf5, 0xd4, 0x04, 0x41, 0x21, 0xef, 0xec, 0x19,
+  0x27, 0xcf, 0xf6, 0x45, 0xf2, 0x81, 0x5d, 0xfe, 0x11, 0x1e, 0xed, 0xf7,
+  0xd5, 0x15, 0x1b, 0x46, 0xe3, 0xd2, 0x1b, 0x27, 0x41, 0xfc, 0x41, 0xd6,
+  0xe0, 0x11, 0xe6, 0x0a, 0x20, 0xe8, 0x11, 0xeb, 0x2e, 0xec, 0x08, 0xf8,
+  0xd0, 0x54, 0x27, 0x1a, 0x06, 0x07, 0xc7, 0xef, 0xea, 0x0b, 0x06, 0xcd,
+  0x31, 0x13, 0xd9, 0x30, 0xf7, 0x39, 0xe3, 0x1c, 0xd9, 0x09, 0xf4, 0xed,
+  0xbc, 0x24, 0x24, 0x26, 0xd5, 0xe8, 0xda, 0x1c, 0xfd, 0xcd, 0x00, 0x1d,
+  0xd3, 0x06, 0x02, 0xfe, 0x3f, 0xd2, 0x08, 0xcf, 0x01, 0xf4, 0xcd, 0x22,
+  0xc5, 0x1f, 0x3e, 0x02, 0xb5, 0x0d, 0x33, 0x1f, 0x37, 0x1d, 0x06, 0x06,
+  0xd6, 0xc0, 0x2e, 0xe8, 0xb2, 0x21, 0x16, 0xf6, 0x3f, 0xe1, 0xff, 0x02,
+  0x0a, 0x1d, 0xca, 0xee, 0xd0, 0x46, 0x81, 0xe4, 0x08, 0x05, 0xe1, 0xf2,
+  0x18, 0xd8, 0xbc, 0xf2, 0xf6, 0x1f, 0xe4, 0x07, 0xf6, 0x39, 0xc2, 0xb8,
+  0xc3, 0xe3, 0x02, 0x0e, 0x11, 0xf8, 0x31, 0x04, 0xb3, 0x08, 0x1a, 0xf2,
+  0x23, 0xcc, 0xcc, 0xe2, 0x1d, 0xe8, 0x2a, 0x0c, 0x00, 0x03, 0xec, 0xda,
+  0x1b, 0xf7, 0x0e, 0xf9, 0x2f, 0x33, 0xbf, 0x02, 0xea, 0x4d, 0x1d, 0x7b,
+  0x07, 0x10, 0xe6, 0xe5, 0x2e, 0x25, 0x16, 0x22, 0xdb, 0x4e, 0x9a, 0x4e,
+  0xf3, 0xe9, 0xc7, 0xf0, 0xe6, 0x35, 0xc9, 0x0d, 0xaa, 0x13, 0x14, 0x09,
+  0x05, 0xff, 0x4c, 0x2b, 0xd2, 0x4c, 0x2e, 0x7f, 0xbd, 0xe8, 0xba, 0xcf,
+  0x2e, 0xaf, 0xcd, 0x15, 0xeb, 0x14, 0x0e, 0x3e, 0xf0, 0x4f, 0x00, 0x1c,
+  0xbb, 0xfd, 0xae, 0x1c, 0x1c, 0x3e, 0x01, 0x25, 0xbb, 0xd2, 0xeb, 0xe7,
+  0xd7, 0x2d, 0x36, 0xcd, 0x20, 0x37, 0xf7, 0x2f, 0x0d, 0x06, 0x60, 0xcf,
+  0x44, 0x2e, 0xf8, 0x32, 0xa2, 0xf3, 0xd2, 0x08, 0xc4, 0x20, 0x21, 0xea,
+  0x35, 0xb2, 0xee, 0x06, 0x16, 0x17, 0xf5, 0xe5, 0x05, 0x8f, 0x03, 0x17,
+  0xf5, 0xe1, 0x45, 0x12, 0x27, 0xc2, 0xf0, 0xc8, 0xdc, 0x06, 0xd7, 0xdc,
+  0xec, 0xdd, 0x2d, 0xfc, 0xf0, 0x18, 0x25, 0x5b, 0xa0, 0xfc, 0x1f, 0xf7,
+  0xd2, 0x19, 0x16, 0xa4, 0xfc, 0x1f, 0x43, 0xe0, 0x17, 0xcf, 0xf9, 0x0b,
+  0xcf, 0x81, 0x3e, 0xd3, 0x0e, 0x22, 0xf3, 0x3a, 0xf8, 0x20, 0xd6, 0x06,
+  0x09, 0x26, 0xf6, 0x24, 0x0a, 0x11, 0xeb, 0x04, 0x48, 0x19, 0xda, 0x9c,
+  0x60, 0x43, 0xde, 0xee, 0x42, 0xb5, 0x18, 0x25, 0x1e, 0x21, 0x27, 0x56,
+  0xcb, 0x67, 0xec, 0xf6, 0x40, 0xfa, 0xfb, 0x06, 0x73, 0xb3, 0x06, 0xf2,
+  0x0e, 0xed, 0x77, 0xcb, 0x55, 0x1d, 0xaf, 0xea, 0xe0, 0x1a, 0x16, 0xc8,
+  0xd3, 0x2c, 0xf7, 0x4f, 0x0f, 0x45, 0xb5, 0x0f, 0x2d, 0xe7, 0x0f, 0xba,
+  0x90, 0xa8, 0x34, 0x33, 0x1c, 0xd4, 0xc9, 0xea, 0xf6, 0xa7, 0xe0, 0xe8,
+  0xf1, 0x28, 0x3a, 0x17, 0xff, 0xe3, 0xde, 0x04, 0xf4, 0x1f, 0xf9, 0x14,
+  0xf4, 0x0a, 0xb2, 0x16, 0xe9, 0xf8, 0xeb, 0x11, 0x38, 0x05, 0x31, 0xf9,
+  0x38, 0xe7, 0xdc, 0x69, 0x40, 0xf3, 0x13, 0x39, 0xcf, 0xc7, 0xe8, 0x29,
+  0x06, 0x3c, 0x1a, 0xe5, 0xf5, 0x10, 0xc7, 0xf2, 0xb2, 0xfd, 0xd9, 0x34,
+  0xec, 0x26, 0x81, 0xdc, 0xb2, 0x09, 0x68, 0x1a, 0x34, 0xd6, 0x17, 0x0e,
+  0x1b, 0xfb, 0xd3, 0x2c, 0xdf, 0x3b, 0x28, 0x18, 0x00, 0x28, 0x16, 0xdb,
+  0x3d, 0xf3, 0x47, 0xe4, 0xba, 0xe3, 0xf9, 0x01, 0xbb, 0x24, 0xeb, 0x56,
+  0x0e, 0xd6, 0xf1, 0x15, 0xfa, 0x5f, 0xe6, 0xfe, 0x23, 0x2b, 0x26, 0x0d,
+  0x0b, 0x2b, 0xe8, 0x2f, 0xe4, 0xdd, 0xb3, 0x17, 0x30, 0x3f, 0xd6, 0x02,
+  0x03, 0xfa, 0x36, 0xe4, 0x01, 0xb6, 0xf5, 0x34, 0xe5, 0x0f, 0xe5, 0xfb,
+  0x1c, 0xed, 0xfc, 0x60, 0x94, 0xe3, 0xff, 0x3e, 0xe5, 0xda, 0xf8, 0x1e,
+  0x09, 0xfd, 0x3f, 0xf9, 0x1f, 0xea, 0x0d, 0x22, 0x35, 0xee, 0xb6, 0xe3,
+  0xeb, 0xfd, 0xf6, 0x46, 0x32, 0x39, 0x16, 0xef, 0x32, 0x00, 0x07, 0xf8,
+  0xff, 0xda, 0x9e, 0x43, 0xd1, 0x00, 0xe7, 0x83, 0x0c, 0xc7, 0xd2, 0xdd,
+  0xfc, 0xef, 0x34, 0xa9, 0x07, 0x94, 0xde, 0xe7, 0x95, 0x36, 0x0e, 0x24,
+  0xae, 0xf7, 0xc2, 0xeb, 0xe9, 0x2c, 0xf0, 0xe2, 0xc8, 0x2f, 0xf7, 0x04,
+  0x2e, 0xe7, 0x3a, 0xef, 0x03, 0x12, 0xc3, 0x76, 0xe1, 0x3b, 0x1f, 0xb1,
+  0xce, 0xd1, 0x37, 0x17, 0x5c, 0xbd, 0xfe, 0xc2, 0xcf, 0xd8, 0x11, 0xe1,
+  0x0b, 0xb3, 0xc1, 0x45, 0xe4, 0xe8, 0xfb, 0xfe, 0xdc, 0xe6, 0x3e, 0xe8,
+  0xeb, 0xef, 0xe7, 0x2d, 0xf3, 0xea, 0x15, 0xbc, 0x2c, 0xc2, 0xfe, 0x40,
+  0xfc, 0xd9, 0x0a, 0x23, 0x0b, 0x1d, 0xb2, 0xed, 0xe5, 0xe7, 0xf5, 0xc9,
+  0xe4, 0xaf, 0x22, 0xdf, 0xf1, 0xf5, 0x15, 0x21, 0xc6, 0x7f, 0x00, 0x1b,
+  0xc6, 0xc4, 0x37, 0x30, 0x06, 0xc9, 0x20, 0xd7, 0x2f, 0xfe, 0xd4, 0x0c,
+  0xe9, 0xf4, 0xdb, 0x0e, 0xce, 0x08, 0x15, 0xd0, 0x21, 0xe6, 0x45, 0xab,
+  0x24, 0x15, 0x31, 0xf7, 0xe0, 0x3b, 0x1f, 0x20, 0x17, 0xdf, 0xfb, 0xd5,
+  0xc9, 0x10, 0x14, 0xde, 0xdd, 0xc8, 0xfb, 0x68, 0xbb, 0x9e, 0xcd, 0xf1,
+  0xb7, 0x53, 0x16, 0x2a, 0x1d, 0x2b, 0x0b, 0xbe, 0xf7, 0x36, 0xed, 0x25,
+  0xe8, 0xd6, 0x17, 0x47, 0xc9, 0x38, 0x0d, 0xe3, 0xff, 0xf0, 0xee, 0xcf,
+  0x2e, 0x26, 0x09, 0x06, 0x00, 0x0b, 0x11, 0x42, 0xc3, 0xfc, 0x12, 0xef,
+  0x17, 0x3b, 0x6e, 0xdf, 0x04, 0x0f, 0xe8, 0xe3, 0x81, 0x4f, 0x14, 0xb0,
+  0x32, 0xa8, 0x32, 0xa5, 0x42, 0x41, 0x17, 0xe2, 0xfb, 0x38, 0xdb, 0xfb,
+  0xe0, 0x36, 0xb6, 0x1f, 0x4e, 0xfa, 0x19, 0xba, 0x4f, 0xde, 0xa1, 0xc6,
+  0xd1, 0x67, 0xca, 0xcb, 0x39, 0xbf, 0xe7, 0x29, 0x07, 0x19, 0x32, 0x05,
+  0xd7, 0x2d, 0x5f, 0xe3, 0xf5, 0xeb, 0x2e, 0x48, 0x42, 0x01, 0xee, 0x1d,
+  0x29, 0xe7, 0xbd, 0xd1, 0x38, 0x1f, 0x28, 0x12, 0x35, 0x12, 0x57, 0x09,
+  0x0f, 0xaf, 0xdd, 0x4b, 0xc5, 0x3b, 0x29, 0xe8, 0x52, 0x22, 0x53, 0xdc,
+  0xe3, 0xe6, 0xb1, 0x29, 0xba, 0xb4, 0xf9, 0x14, 0xb5, 0x42, 0x31, 0xc7,
+  0x70, 0x65, 0x01, 0x13, 0x14, 0x2f, 0xf1, 0x03, 0x03, 0x26, 0xe1, 0x26,
+  0x17, 0xfa, 0x30, 0x10, 0x3a, 0x2e, 0x1a, 0xeb, 0xf1, 0x19, 0x52, 0xbc,
+  0x0c, 0x08, 0x3b, 0xed, 0x9d, 0xe3, 0x50, 0xc8, 0x11, 0xf3, 0x0c, 0xd6,
+  0x3d, 0x16, 0x42, 0x7f, 0x0f, 0x32, 0x12, 0x18, 0xf6, 0xf1, 0xa5, 0x15,
+  0x0f, 0x2e, 0x29, 0xdd, 0x38, 0xda, 0x0c, 0x42, 0xa9, 0xd8, 0xee, 0x3a,
+  0xee, 0xee, 0x76, 0x07, 0x09, 0x24, 0xc8, 0xac, 0x19, 0x0d, 0x28, 0x09,
+  0x0a, 0xed, 0x0f, 0x07, 0x1f, 0xf7, 0x1c, 0x56, 0xe4, 0x30, 0x26, 0x0a,
+  0x94, 0xf8, 0xe7, 0x05, 0x45, 0x1e, 0xd3, 0xf2, 0x4c, 0xe3, 0xd4, 0xf4,
+  0xf7, 0x10, 0xea, 0x20, 0x17, 0x14, 0xf3, 0x24, 0x0c, 0xa6, 0xc5, 0xf1,
+  0xcd, 0x39, 0xc2, 0x29, 0x1d, 0x33, 0x33, 0x50, 0xea, 0x43, 0xeb, 0xdb,
+  0x1e, 0x43, 0xb5, 0x2d, 0xd3, 0xfc, 0x19, 0x27, 0x31, 0xeb, 0x07, 0x30,
+  0x31, 0x01, 0x91, 0xd2, 0xfc, 0x10, 0x29, 0xe5, 0xbe, 0x21, 0x0c, 0x36,
+  0xf0, 0xf4, 0xfe, 0xfd, 0xc9, 0xfb, 0x3b, 0xf3, 0x4b, 0xd1, 0xfa, 0xf8,
+  0x37, 0x22, 0x1f, 0xbd, 0x1f, 0xb6, 0xd6, 0x04, 0x23, 0xfc, 0xdd, 0xd1,
+  0x0c, 0xfd, 0x32, 0x2e, 0xe8, 0x1e, 0xf4, 0x24, 0x39, 0x08, 0xab, 0x26,
+  0xfb, 0x94, 0x33, 0xdb, 0x17, 0x00, 0xc4, 0xfd, 0x1b, 0x32, 0xe5, 0x94,
+  0x7f, 0x0f, 0x11, 0xf5, 0xd4, 0xfd, 0xfc, 0xe6, 0x08, 0x12, 0xd9, 0xfd,
+  0x0d, 0x03, 0x39, 0xfe, 0x0f, 0x02, 0xff, 0xcf, 0xf2, 0x04, 0x09, 0xe0,
+  0x2f, 0x2d, 0xf1, 0x03, 0x26, 0x37, 0xef, 0x95, 0xc3, 0x00, 0x46, 0x15,
+  0x16, 0x9f, 0xe4, 0xf5, 0xf5, 0xe8, 0x37, 0xfe, 0x35, 0x51, 0xbd, 0x64,
+  0x0b, 0xe0, 0x21, 0xca, 0x2c, 0x09, 0xe0, 0xde, 0x02, 0xfb, 0x3d, 0xe3,
+  0xc0, 0x0c, 0xda, 0x68, 0xf7, 0x26, 0x00, 0x12, 0xce, 0x0d, 0xc3, 0xd4,
+  0x18, 0xfa, 0xe1, 0xc1, 0xfd, 0xfc, 0xc2, 0xc5, 0x21, 0x36, 0xd8, 0xc2,
+  0x02, 0x09, 0x16, 0x24, 0xe1, 0x51, 0xe8, 0x3f, 0xaa, 0xbd, 0x35, 0x40,
+  0x20, 0xcc, 0xc2, 0xf3, 0xec, 0x15, 0xb1, 0x39, 0xe1, 0x42, 0xe3, 0xc4,
+  0x08, 0x37, 0xbb, 0xef, 0xeb, 0x37, 0xec, 0xb9, 0x4b, 0xe1, 0xf8, 0x29,
+  0xe0, 0x0d, 0xd7, 0x7f, 0x14, 0xf3, 0xf8, 0x0f, 0xcb, 0xb0, 0x2d, 0x24,
+  0xd4, 0xef, 0x52, 0x1e, 0x25, 0xf7, 0xb7, 0x06, 0xc4, 0xda, 0xa2, 0x36,
+  0xf9, 0x10, 0xde, 0xd8, 0x3d, 0x3b, 0x3a, 0xf6, 0xea, 0x16, 0xed, 0x01,
+  0x13, 0x29, 0xe1, 0xfc, 0xbb, 0xdd, 0x05, 0x36, 0x37, 0x46, 0x2f, 0xf4,
+  0xca, 0x1a, 0x42, 0xcd, 0x0b, 0x02, 0x20, 0xc8, 0x05, 0xe2, 0x1d, 0x7f,
+  0x2c, 0x0e, 0xfc, 0x2f, 0xfb, 0xfa, 0x33, 0xf3, 0x44, 0x1d, 0xf0, 0xf6,
+  0x39, 0xb8, 0xb0, 0x19, 0xfc, 0x50, 0x0b, 0x4f, 0x17, 0x04, 0xf0, 0xcf,
+  0xd1, 0x3c, 0xc0, 0xd3, 0x2b, 0xdd, 0x33, 0xa0, 0x41, 0x0c, 0xed, 0x23,
+  0x31, 0xed, 0xf6, 0x46, 0x5c, 0xd4, 0x4a, 0x19, 0xc8, 0x1d, 0xc6, 0x32,
+  0xef, 0x67, 0x2d, 0xf5, 0xce, 0x12, 0x2a, 0x49, 0x0b, 0x1b, 0x34, 0x56,
+  0xe8, 0x10, 0x02, 0xc6, 0x49, 0xed, 0xf6, 0x35, 0xb6, 0xd8, 0xcb, 0xe2,
+  0x18, 0xd0, 0xec, 0x43, 0xe0, 0x0d, 0xce, 0x2a, 0x32, 0x9f, 0xc7, 0x22,
+  0xee, 0xd5, 0xf6, 0xf3, 0x42, 0x2e, 0xa3, 0xe0, 0x23, 0x02, 0xcd, 0x0b,
+  0x05, 0x19, 0xf1, 0xfc, 0x04, 0x33, 0xfd, 0x25, 0x07, 0x05, 0xca, 0xbb,
+  0x11, 0xca, 0x64, 0xfb, 0xe5, 0xe4, 0x4f, 0xe7, 0x0e, 0x0a, 0x42, 0x26,
+  0xc7, 0x29, 0x50, 0xfe, 0xbb, 0x2b, 0xf1, 0xd1, 0x0e, 0x4c, 0xfc, 0x28,
+  0x01, 0xb8, 0xf7, 0xef, 0x43, 0x23, 0xb6, 0x3d, 0xfd, 0x61, 0xab, 0x38,
+  0x25, 0xb3, 0x25, 0xe6, 0x0c, 0x54, 0xdd, 0x38, 0x12, 0xd6, 0xeb, 0x23,
+  0x1d, 0xe7, 0xfb, 0x21, 0x0f, 0xe1, 0x60, 0xce, 0x9e, 0x7f, 0x1d, 0x4c,
+  0x69, 0xad, 0x10, 0xfc, 0x04, 0x0f, 0x75, 0x40, 0x1b, 0x2b, 0xa7, 0xa4,
+  0xdd, 0xf8, 0x17, 0xb1, 0xd9, 0xc7, 0x4c, 0xa5, 0x18, 0x25, 0x1b, 0xef,
+  0x11, 0x36, 0xd9, 0xf7, 0xf3, 0x18, 0xc3, 0x22, 0xfd, 0xc6, 0x40, 0x0b,
+  0x39, 0xc5, 0xf2, 0xff, 0xe1, 0x10, 0xf3, 0x38, 0x03, 0x39, 0x0e, 0x1a,
+  0x22, 0xf6, 0xc0, 0x3b, 0x2d, 0x41, 0x15, 0xc8, 0x17, 0x24, 0xe3, 0x1f,
+  0x2e, 0x10, 0x21, 0x1a, 0x02, 0x22, 0xd2, 0xf0, 0xec, 0x89, 0x8c, 0xd6,
+  0xba, 0x26, 0xf6, 0x88, 0xbc, 0xff, 0xd0, 0xbd, 0x47, 0xe9, 0x5c, 0xef,
+  0xe7, 0xd1, 0xe4, 0xed, 0xde, 0xf7, 0x2a, 0xf0, 0xd5, 0x0c, 0x28, 0xe6,
+  0x47, 0x0e, 0xe8, 0x3a, 0xaf, 0x0d, 0x06, 0xff, 0x34, 0x06, 0xfa, 0xfa,
+  0x49, 0x0d, 0x89, 0x70, 0x22, 0x46, 0x33, 0xf5, 0x4a, 0x9c, 0xee, 0xce,
+  0x7b, 0xf7, 0xd1, 0xfa, 0xd9, 0xc2, 0x03, 0x16, 0x30, 0xee, 0xae, 0x06,
+  0xd5, 0xde, 0xcc, 0x32, 0xef, 0xe9, 0x0a, 0xd8, 0x9f, 0xb8, 0x1b, 0x03,
+  0xa0, 0xc1, 0xd7, 0x9f, 0x09, 0xd3, 0x5c, 0x1a, 0x1b, 0x43, 0xcb, 0xda,
+  0x56, 0x13, 0xef, 0xd7, 0x3a, 0xbb, 0x14, 0x9f, 0xc3, 0xd7, 0x3d, 0x0e,
+  0xf5, 0x5e, 0x02, 0x1d, 0xb1, 0x7f, 0xd9, 0xf5, 0xca, 0xdc, 0x3a, 0x39,
+  0x0b, 0x8c, 0x39, 0xaa, 0x61, 0xee, 0xff, 0x25, 0xeb, 0xdb, 0xed, 0x25,
+  0xa0, 0xd5, 0x70, 0xc1, 0xc9, 0xff, 0xf3, 0x0c, 0x39, 0xd8, 0x26, 0x09,
+  0x48, 0xc4, 0xd8, 0x07, 0x05, 0xdc, 0xfb, 0x0c, 0x3f, 0x17, 0xf3, 0x2c,
+  0xed, 0x14, 0xe0, 0x24, 0x03, 0xff, 0xd4, 0x11, 0xdc, 0xf4, 0x4d, 0x86,
+  0x0e, 0x28, 0xe2, 0x02, 0xff, 0x15, 0xf5, 0x26, 0xfa, 0xc2, 0xf0, 0xf8,
+  0xc4, 0xf6, 0x07, 0x38, 0xf9, 0x06, 0x10, 0xfd, 0xc2, 0xff, 0x23, 0xcf,
+  0x35, 0xfd, 0x01, 0xcb, 0x59, 0xdc, 0xdf, 0x37, 0xc4, 0x0d, 0xe4, 0x10,
+  0x16, 0x30, 0x03, 0x1f, 0x04, 0x2b, 0x21, 0x45, 0xbe, 0x0f, 0x0f, 0x36,
+  0x22, 0xeb, 0xfd, 0xae, 0xbb, 0xa2, 0x57, 0x1c, 0x08, 0xce, 0xdf, 0xf7,
+  0x14, 0x26, 0x04, 0xab, 0x7f, 0x04, 0xf9, 0x1d, 0x00, 0xcc, 0xda, 0xd3,
+  0xe7, 0x21, 0xd3, 0x12, 0xcc, 0xee, 0x32, 0xfc, 0x0c, 0x09, 0xde, 0xe4,
+  0x0b, 0x27, 0x1a, 0x0f, 0x2b, 0x1d, 0xd1, 0x26, 0x22, 0x77, 0x1e, 0x9a,
+  0xd5, 0x04, 0x3a, 0xf1, 0x16, 0xf2, 0x12, 0x04, 0x00, 0xaa, 0x27, 0x04,
+  0x3c, 0x65, 0x2e, 0x5c, 0x81, 0xe7, 0xf7, 0xe8, 0x06, 0xdd, 0xdf, 0xdf,
+  0x35, 0x1e, 0x1a, 0xe2, 0x1d, 0x28, 0xf9, 0x10, 0x1c, 0xfe, 0xd6, 0x19,
+  0x11, 0x0c, 0x60, 0xe9, 0x1e, 0x19, 0x19, 0xcb, 0xec, 0xd2, 0xe7, 0xfa,
+  0xb0, 0xea, 0xd0, 0xb7, 0x0b, 0x19, 0xe7, 0xfa, 0x39, 0x09, 0x10, 0xfe,
+  0xc1, 0x2c, 0xd1, 0x18, 0x46, 0x01, 0xfd, 0xf0, 0xc3, 0x2e, 0x1a, 0x20,
+  0x25, 0x07, 0xcf, 0x67, 0xcb, 0xcc, 0xdd, 0xf6, 0xf3, 0x13, 0x04, 0x08,
+  0x46, 0xe6, 0xfb, 0xc7, 0xf0, 0xb6, 0xc6, 0x45, 0xb8, 0x10, 0x1c, 0x3d,
+  0x03, 0xf9, 0x24, 0xe1, 0x19, 0xca, 0xeb, 0xf6, 0x2b, 0xe1, 0xa2, 0xf1,
+  0x1f, 0xc7, 0xb0, 0x0f, 0x48, 0x38, 0x22, 0xf8, 0x3a, 0xe7, 0x17, 0xe1,
+  0xd7, 0xde, 0x55, 0x0d, 0x3d, 0x3c, 0xf0, 0x2b, 0x07, 0xc0, 0xc6, 0x5a,
+  0x39, 0x31, 0x1e, 0x01, 0x2b, 0xd7, 0xcd, 0xdc, 0x0a, 0xee, 0xd4, 0xca,
+  0xe4, 0x01, 0x23, 0x47, 0x3f, 0x56, 0xd6, 0xdf, 0xeb, 0x81, 0x9f, 0x03,
+  0xfc, 0x4a, 0x56, 0x11, 0x13, 0x3a, 0x33, 0x46, 0x11, 0x41, 0x0f, 0x17,
+  0x08, 0x37, 0xe3, 0xe9, 0xe3, 0x12, 0x18, 0x0d, 0x2b, 0x36, 0xf5, 0x18,
+  0xb9, 0x14, 0xf3, 0x00, 0xfa, 0xd8, 0xb6, 0xd3, 0x3c, 0x6e, 0xcc, 0xc3,
+  0xcb, 0x46, 0xf3, 0xa3, 0x4e, 0x20, 0x08, 0xf3, 0xd5, 0x0e, 0x20, 0xb8,
+  0x01, 0xc9, 0x44, 0x1c, 0x45, 0xc1, 0x1c, 0x07, 0x1f, 0xe3, 0xee, 0xac,
+  0x8f, 0x3a, 0x2d, 0xec, 0x0b, 0x19, 0x27, 0xc6, 0x31, 0x30, 0x4b, 0xd9,
+  0xdf, 0x13, 0xbe, 0x56, 0x07, 0x4e, 0xfc, 0x19, 0x2c, 0x11, 0xaa, 0x16,
+  0xf5, 0x06, 0xd8, 0xa4, 0x1c, 0xee, 0xf6, 0x4d, 0x1d, 0xc7, 0x39, 0x40,
+  0xff, 0xe7, 0xe5, 0x1e, 0x32, 0x5c, 0xce, 0xc6, 0xa7, 0x57, 0xf0, 0x49,
+  0xe0, 0x73, 0x58, 0xd0, 0x54, 0x17, 0xbe, 0x0b, 0xf9, 0xe0, 0x01, 0xd0,
+  0x14, 0xf3, 0xf0, 0xfe, 0x00, 0x31, 0xef, 0x0a, 0xd1, 0x17, 0xd6, 0xe5,
+  0x34, 0xd1, 0xd4, 0x4f, 0xd0, 0xba, 0x8f, 0xd8, 0x09, 0xa4, 0xdf, 0xe4,
+  0x43, 0x09, 0xff, 0x2f, 0x55, 0x3b, 0x01, 0xd9, 0x5d, 0xdd, 0x64, 0x00,
+  0xca, 0x10, 0x35, 0x21, 0xb4, 0xdd, 0x51, 0xa4, 0xfa, 0xd9, 0xee, 0xd2,
+  0x2d, 0xf5, 0xf7, 0xed, 0x35, 0x15, 0x7f, 0x76, 0x20, 0x03, 0xf0, 0x34,
+  0xb8, 0xf0, 0xb3, 0x92, 0x3e, 0x04, 0x3d, 0xd1, 0x21, 0x2d, 0x27, 0x26,
+  0xe4, 0xb4, 0x5d, 0xe3, 0x31, 0x60, 0x18, 0x1e, 0x0e, 0xe8, 0x22, 0x22,
+  0xca, 0xb0, 0x05, 0xb3, 0x4f, 0x2a, 0xea, 0x20, 0x30, 0x65, 0xf2, 0xeb,
+  0x3c, 0x0c, 0xef, 0xf9, 0x11, 0x01, 0x26, 0x20, 0xf4, 0xea, 0x23, 0x9c,
+  0xf1, 0x0a, 0xce, 0x29, 0x1b, 0x55, 0xdc, 0x26, 0x22, 0xfd, 0xd8, 0x0d,
+  0x1e, 0x1a, 0xf6, 0xf5, 0xeb, 0x5e, 0xfe, 0x14, 0xf3, 0xf4, 0x08, 0x02,
+  0x1a, 0x08, 0xf6, 0xf5, 0x19, 0xf0, 0x0d, 0x0e, 0x03, 0x37, 0xfe, 0xc1,
+  0x46, 0x04, 0xd6, 0x5a, 0xb0, 0x1c, 0xdb, 0x2e, 0xfe, 0xe6, 0xf2, 0x0a,
+  0xf2, 0x0b, 0xf3, 0x2d, 0xac, 0xda, 0x0b, 0x0a, 0xf9, 0x99, 0xca, 0x06,
+  0xde, 0x16, 0xde, 0xc5, 0x0a, 0x4e, 0x21, 0x04, 0xf8, 0xef, 0x3d, 0xc7,
+  0x17, 0xf3, 0x3a, 0xa5, 0xd0, 0x06, 0xdc, 0xf4, 0xd8, 0x81, 0x16, 0x13,
+  0xc9, 0x15, 0xec, 0xe4, 0xd4, 0x0e, 0x18, 0x08, 0x09, 0xfb, 0x00, 0xc9,
+  0xf9, 0xfb, 0x02, 0x1d, 0xfb, 0x20, 0x1a, 0x4b, 0x53, 0xca, 0xcf, 0xe4,
+  0x3d, 0xf7, 0xf1, 0x3a, 0xfa, 0x22, 0x21, 0xf4, 0x12, 0x33, 0xfd, 0x3a,
+  0xfd, 0x08, 0x35, 0x16, 0x32, 0xe5, 0xc8, 0xe5, 0x31, 0xd7, 0x13, 0x31,
+  0x82, 0xca, 0xa2, 0xe1, 0x12, 0xf2, 0xed, 0xd4, 0x43, 0x28, 0xe0, 0x13,
+  0xb5, 0xf1, 0xe5, 0x0c, 0x2b, 0x26, 0x35, 0x24, 0xf3, 0x04, 0xb5, 0xd2,
+  0xf1, 0x37, 0x1e, 0xfe, 0xe8, 0xa3, 0xf9, 0xe5, 0x0d, 0xef, 0xfd, 0xbf,
+  0x31, 0x31, 0xf4, 0x0a, 0xf3, 0xe5, 0x03, 0xe1, 0xba, 0xe7, 0xd8, 0x30,
+  0x81, 0xbb, 0xa6, 0xbc, 0xe2, 0xdf, 0x1c, 0x2b, 0xfa, 0x12, 0xec, 0x39,
+  0xf7, 0x2a, 0xfc, 0x57, 0xbd, 0xb9, 0x12, 0xd9, 0xd0, 0x4c, 0x09, 0x01,
+  0x18, 0x3a, 0x57, 0x02, 0x11, 0xc6, 0x47, 0x3c, 0xdc, 0xfe, 0xe7, 0xa4,
+  0x07, 0xfd, 0x2c, 0xc1, 0xe5, 0xd5, 0x09, 0xec, 0x4d, 0xec, 0x1d, 0x61,
+  0x21, 0xeb, 0x19, 0x21, 0xfc, 0xd9, 0xf5, 0x02, 0x01, 0x1f, 0xee, 0xfe,
+  0xc0, 0xf0, 0xb5, 0x33, 0xec, 0x02, 0xf9, 0xfd, 0x05, 0x07, 0xf7, 0x0e,
+  0x0b, 0xf7, 0x3c, 0xff, 0xec, 0x3b, 0x4c, 0xad, 0xde, 0x9f, 0xde, 0x17,
+  0xfc, 0x9a, 0x39, 0x64, 0xb0, 0x00, 0xff, 0xf6, 0xc7, 0xf8, 0xf4, 0xb0,
+  0x5b, 0x69, 0xde, 0xb9, 0x00, 0x51, 0xa8, 0x36, 0x02, 0xfd, 0x0b, 0xd2,
+  0xf3, 0xd6, 0xf4, 0x20, 0xcd, 0xdf, 0xfc, 0xb6, 0x7b, 0xbd, 0x3c, 0xf5,
+  0xd9, 0xf3, 0xeb, 0xd7, 0xce, 0x31, 0x35, 0x97, 0x05, 0xd8, 0xf7, 0xf9,
+  0x4d, 0x65, 0xd9, 0xf8, 0xad, 0x30, 0xd8, 0xff, 0x27, 0xc8, 0x18, 0xbc,
+  0x2d, 0x31, 0xd9, 0x07, 0x02, 0xca, 0x51, 0xe3, 0xf1, 0xdd, 0xdb, 0x41,
+  0x07, 0x45, 0x30, 0x0a, 0xf3, 0xbf, 0x04, 0x01, 0x1c, 0xc1, 0x2a, 0xfd,
+  0x09, 0x42, 0xc8, 0xd2, 0x68, 0xdd, 0xe0, 0xc6, 0xe0, 0x16, 0xc7, 0xd6,
+  0x18, 0xf7, 0x95, 0x2b, 0xb3, 0xd1, 0xe7, 0xd6, 0xd6, 0x15, 0xed, 0xc5,
+  0xd4, 0xf0, 0x34, 0xec, 0x1b, 0x25, 0x02, 0x26, 0xcf, 0x7f, 0x32, 0xb7,
+  0x2c, 0x03, 0xf7, 0xfd, 0xdd, 0xac, 0x1a, 0xee, 0xb6, 0x38, 0x47, 0xd8,
+  0xf1, 0xd2, 0x0d, 0x62, 0xe7, 0xf8, 0x3f, 0xd4, 0xc9, 0xe5, 0x08, 0x3a,
+  0x08, 0x0a, 0x39, 0xd5, 0xc4, 0x0a, 0x30, 0x4f, 0x43, 0xff, 0x06, 0xc3,
+  0x08, 0xf9, 0x31, 0x37, 0x16, 0x14, 0x1a, 0xc9, 0xfa, 0x22, 0xe3, 0xe1,
+  0x0f, 0xcf, 0x00, 0xf3, 0x18, 0x23, 0xc3, 0xf1, 0xd5, 0x1c, 0x0f, 0x11,
+  0xe4, 0xf0, 0xbc, 0xc5, 0xfa, 0xf9, 0xef, 0xe0, 0x1b, 0x23, 0xd2, 0x3e,
+  0xf2, 0xf3, 0xa3, 0x3e, 0xfd, 0x2c, 0xe9, 0x09, 0xbc, 0xf0, 0x06, 0x2a,
+  0xe9, 0xa6, 0x20, 0x0b, 0xea, 0xee, 0xeb, 0x34, 0xd4, 0x13, 0x07, 0x7f,
+  0xdd, 0xe2, 0xf3, 0x36, 0x2c, 0x05, 0x1f, 0x48, 0xdf, 0x2c, 0x29, 0x43,
+  0xef, 0xf7, 0xc9, 0xaa, 0x05, 0xd1, 0x95, 0x0e, 0xfb, 0x09, 0x0f, 0xb6,
+  0x0c, 0x0f, 0x05, 0xb5, 0x26, 0x2c, 0x18, 0x3a, 0x2d, 0x1e, 0x11, 0xd3,
+  0x51, 0xf0, 0x62, 0x2c, 0xa1, 0xef, 0x16, 0x2d, 0xe4, 0xb1, 0xeb, 0xb6,
+  0x0b, 0x0e, 0x19, 0xc7, 0x01, 0xb5, 0xd0, 0x51, 0xd1, 0xf8, 0xfd, 0x09,
+  0x97, 0x65, 0x47, 0xde, 0xf5, 0x4c, 0x07, 0x33, 0x11, 0x16, 0x30, 0x28,
+  0xde, 0xd6, 0x1d, 0x34, 0xda, 0x35, 0x27, 0x42, 0x27, 0x05, 0xcb, 0xbe,
+  0xfb, 0x36, 0x0f, 0x02, 0xec, 0x1d, 0x34, 0xeb, 0xcf, 0x06, 0x44, 0x00,
+  0x59, 0x1d, 0x4a, 0xea, 0x3f, 0x14, 0xf4, 0xef, 0xbb, 0x2a, 0xdd, 0xe5,
+  0x13, 0x9b, 0x12, 0xce, 0x0d, 0x03, 0xe1, 0xe1, 0xf0, 0xda, 0xe9, 0x16,
+  0x1b, 0x12, 0x04, 0xe4, 0x6a, 0x08, 0xff, 0xad, 0x7f, 0x02, 0x9e, 0xb6,
+  0xad, 0x28, 0xc8, 0xcf, 0x55, 0xcb, 0x34, 0x49, 0x44, 0x01, 0x42, 0x1b,
+  0xb0, 0x39, 0x0b, 0xef, 0xe4, 0xdc, 0x25, 0x21, 0x62, 0xf4, 0x03, 0x2e,
+  0x1a, 0xc1, 0xcd, 0x04, 0x0e, 0x33, 0x08, 0xbe, 0x5f, 0x0e, 0x4d, 0xf5,
+  0x0b, 0x27, 0xfa, 0x6d, 0xfb, 0x2e, 0xfe, 0x19, 0x34, 0x04, 0x30, 0xfb,
+  0x00, 0xf3, 0xcb, 0x17, 0x13, 0x48, 0xde, 0xf6, 0x07, 0x2a, 0xe0, 0xb7,
+  0xdd, 0xdc, 0x2b, 0x76, 0x08, 0x8b, 0xec, 0x30, 0x06, 0xb9, 0x05, 0x57,
+  0xb7, 0x0f, 0x08, 0x09, 0x1a, 0x2b, 0xec, 0xa2, 0xd1, 0x0e, 0x7f, 0x2d,
+  0x36, 0x31, 0x3e, 0xe7, 0x02, 0xd9, 0xde, 0x18, 0xfc, 0x0f, 0x34, 0x22,
+  0xf9, 0x2c, 0xf7, 0xcc, 0x24, 0x20, 0x0c, 0x4c, 0xd9, 0xd1, 0x02, 0x0a,
+  0xe2, 0x4d, 0xfc, 0xda, 0x24, 0x1e, 0xe6, 0x41, 0x4a, 0xda, 0x02, 0x12,
+  0xce, 0xf0, 0x09, 0x2d, 0x19, 0x0b, 0xfa, 0xf5, 0xe1, 0x1d, 0x27, 0xe1,
+  0xfa, 0x23, 0xd8, 0x03, 0xd8, 0x10, 0x52, 0x97, 0x25, 0x03, 0xe7, 0x8e,
+  0xd3, 0xff, 0x28, 0xc1, 0x2a, 0x35, 0xed, 0xe9, 0x26, 0x13, 0xf3, 0x04,
+  0x1c, 0x50, 0x54, 0xd9, 0x42, 0x0f, 0x0b, 0x6c, 0xc6, 0x10, 0xb0, 0x49,
+  0x34, 0x0c, 0x9a, 0xde, 0x4a, 0xfc, 0xfb, 0xc6, 0x14, 0x63, 0xce, 0x01,
+  0x11, 0xed, 0xe9, 0x7f, 0xb2, 0x6a, 0x0d, 0xe2, 0xd0, 0xdc, 0xf7, 0x16,
+  0x27, 0x60, 0xcb, 0xec, 0xc7, 0xa1, 0x07, 0xf4, 0xb5, 0x65, 0x16, 0x31,
+  0x98, 0x62, 0xbb, 0x57, 0xdf, 0x3d, 0xa1, 0xce, 0xe0, 0xe7, 0x6b, 0xbd,
+  0xe7, 0x20, 0x04, 0xaf, 0xfd, 0xda, 0x15, 0x07, 0xfd, 0xde, 0x91, 0x28,
+  0xb9, 0x4b, 0x3f, 0xe2, 0xc7, 0x49, 0x56, 0xfa, 0xdf, 0xd0, 0x3e, 0xac,
+  0xe4, 0xf7, 0xf4, 0xf1, 0x78, 0x21, 0xca, 0xe0, 0x26, 0x35, 0xff, 0x13,
+  0xb2, 0x35, 0x44, 0x17, 0xd0, 0xdf, 0x28, 0x3b, 0xcc, 0xfa, 0xe1, 0x5b,
+  0xbc, 0x44, 0x61, 0x5f, 0xd5, 0x2f, 0xc2, 0x29, 0xea, 0x3c, 0x2b, 0x1d,
+  0xfe, 0x2f, 0xb8, 0xee, 0xd4, 0xf4, 0xe1, 0xf0, 0xa7, 0x23, 0xf8, 0xbc,
+  0xee, 0xc2, 0x13, 0xbb, 0xe9, 0x06, 0x10, 0x30, 0x48, 0xa1, 0x22, 0x3d,
+  0x22, 0xb5, 0x5d, 0xfd, 0x03, 0x07, 0x68, 0x26, 0x03, 0x24, 0xc5, 0x1a,
+  0xc5, 0xeb, 0x10, 0xd3, 0xcd, 0xe6, 0xdf, 0xbb, 0xb3, 0x2a, 0x0f, 0xd6,
+  0x47, 0x17, 0x36, 0xe1, 0x45, 0xb5, 0xfe, 0xd0, 0xf9, 0x0b, 0xe5, 0x03,
+  0x01, 0x47, 0x02, 0x00, 0xe8, 0x3d, 0xb3, 0x02, 0x09, 0x16, 0xfc, 0x1e,
+  0x31, 0xec, 0x67, 0x21, 0x6f, 0x33, 0x9a, 0xd3, 0x17, 0x2f, 0x39, 0xd2,
+  0x81, 0xf2, 0xff, 0x36, 0xd4, 0x4f, 0xdb, 0xe4, 0x4f, 0xe8, 0xdf, 0x36,
+  0xdb, 0xde, 0xcc, 0x30, 0x16, 0xc6, 0xce, 0xf4, 0xe6, 0xc0, 0x4a, 0xeb,
+  0xe9, 0x00, 0xf8, 0x25, 0x43, 0x00, 0xb0, 0x00, 0xe1, 0xe2, 0xf9, 0xd1,
+  0x62, 0x42, 0xfb, 0xa1, 0x14, 0x22, 0x9f, 0xf6, 0xff, 0xb5, 0xf5, 0xe0,
+  0x3a, 0x16, 0x5b, 0x5b, 0x4d, 0xec, 0x2f, 0x55, 0xdd, 0x39, 0xe4, 0x4b,
+  0x2f, 0xdf, 0xf1, 0xda, 0x0b, 0x2d, 0x3d, 0xbb, 0xf7, 0xc6, 0xea, 0x35,
+  0xcd, 0xdd, 0xd3, 0x47, 0x93, 0xf6, 0xd8, 0x38, 0x1e, 0xe6, 0x31, 0x49,
+  0x08, 0x17, 0xcc, 0xef, 0xe8, 0x08, 0xf0, 0xf4, 0x38, 0xf3, 0x4d, 0x05,
+  0xd9, 0xef, 0x77, 0xb8, 0xd8, 0x35, 0x46, 0xdc, 0x50, 0x1f, 0xd1, 0x00,
+  0xe4, 0x0d, 0x00, 0xa0, 0x9e, 0x2f, 0x0e, 0x94, 0xe3, 0xd0, 0xff, 0x01,
+  0x08, 0x26, 0xf8, 0x78, 0xe9, 0x15, 0x3f, 0xbf, 0x04, 0xd4, 0xc2, 0xfb,
+  0xda, 0x36, 0xbb, 0x3c, 0x1e, 0x4c, 0xdb, 0x23, 0x81, 0x1a, 0xfa, 0x12,
+  0x03, 0x2e, 0x3b, 0xd6, 0x5a, 0x03, 0x8e, 0xc0, 0x4e, 0x1b, 0xde, 0x20,
+  0x1f, 0x4a, 0xff, 0x2c, 0x2c, 0x28, 0xa4, 0xe4, 0x27, 0x59, 0x32, 0xf0,
+  0x96, 0x02, 0xf2, 0x0e, 0x14, 0x33, 0x4f, 0x25, 0x05, 0xdb, 0xbd, 0x2f,
+  0x51, 0x55, 0xb6, 0xf9, 0x21, 0x21, 0xcf, 0xef, 0x4a, 0xed, 0xe3, 0xdc,
+  0x15, 0x08, 0x4c, 0xf6, 0xca, 0x3d, 0xba, 0x21, 0xfc, 0x0e, 0xf2, 0xfd,
+  0xb3, 0x00, 0x0b, 0xfd, 0xcc, 0xee, 0xfc, 0xcf, 0xfd, 0xc4, 0xf3, 0xc4,
+  0xc8, 0x38, 0x3c, 0x29, 0xda, 0xc8, 0xe4, 0xf3, 0x02, 0xab, 0xe0, 0x3e,
+  0x67, 0x7d, 0x17, 0x4a, 0xc5, 0x45, 0xd8, 0x54, 0xc7, 0x01, 0xbd, 0x1b,
+  0x30, 0x7f, 0x52, 0xa5, 0x4e, 0x51, 0x05, 0x43, 0xb1, 0x15, 0x55, 0xea,
+  0xca, 0x62, 0x0a, 0x09, 0xfd, 0x11, 0xd1, 0x2b, 0xd3, 0xf5, 0xbe, 0x2c,
+  0xfb, 0x2e, 0x08, 0x41, 0xe5, 0xba, 0x99, 0x45, 0x01, 0xf6, 0xd1, 0xc9,
+  0xd3, 0xfe, 0xf0, 0x1d, 0x0e, 0x22, 0xe8, 0x19, 0xc5, 0x07, 0x1b, 0xbe,
+  0xd7, 0x20, 0x05, 0x68, 0xb8, 0xd6, 0xd6, 0x10, 0x0d, 0x0b, 0xcd, 0x13,
+  0x1c, 0x70, 0x33, 0x18, 0xb1, 0x2d, 0xf4, 0x2e, 0x2b, 0x34, 0x56, 0xdf,
+  0x1b, 0xd4, 0xcd, 0xd0, 0xef, 0xdc, 0x26, 0x2e, 0xdb, 0x0a, 0x23, 0x16,
+  0x14, 0x9f, 0xd2, 0x32, 0x2b, 0xe2, 0x22, 0xf6, 0x41, 0xb5, 0xcd, 0x4f,
+  0xb4, 0x07, 0x11, 0xf5, 0x2b, 0x29, 0xd4, 0xd8, 0xa6, 0x15, 0xb7, 0x35,
+  0x27, 0xef, 0x14, 0xe6, 0x26, 0xef, 0xb3, 0xe0, 0xee, 0x0b, 0x2b, 0xf8,
+  0xe3, 0xc2, 0x04, 0xfb, 0x6b, 0x1c, 0xea, 0xdd, 0x4d, 0x01, 0xd0, 0x09,
+  0x15, 0xcd, 0x04, 0x0b, 0xf2, 0x7f, 0xdf, 0xe5, 0xf0, 0x0f, 0x0a, 0xd9,
+  0xcc, 0x0c, 0xcd, 0xfa, 0xec, 0x1a, 0x1a, 0x11, 0x1c, 0x05, 0xd5, 0xff,
+  0x0b, 0xf3, 0xc0, 0xd3, 0x0a, 0xf2, 0xa4, 0xe8, 0x36, 0xf1, 0xec, 0xf4,
+  0xe1, 0x05, 0x01, 0xee, 0xfc, 0xd5, 0xee, 0xa0, 0xd5, 0xfa, 0xda, 0x0b,
+  0x4c, 0x14, 0x1c, 0xcc, 0x01, 0x0a, 0x22, 0xe6, 0xf4, 0xe1, 0xdc, 0x07,
+  0xe5, 0x02, 0x1d, 0x29, 0xc0, 0x3b, 0x36, 0x00, 0xfe, 0xca, 0x25, 0xee,
+  0xda, 0xf8, 0x28, 0x7f, 0x2b, 0xdd, 0x1c, 0x0f, 0xe2, 0xb3, 0x5c, 0xab,
+  0x5e, 0x25, 0x27, 0x15, 0xa4, 0x3a, 0x14, 0x40, 0xff, 0xcf, 0x18, 0xdf,
+  0xef, 0x07, 0xed, 0x49, 0xaf, 0x03, 0xe7, 0xd9, 0x7e, 0xea, 0xe9, 0xc9,
+  0xea, 0x25, 0x06, 0xd3, 0xff, 0x09, 0x68, 0xbb, 0x31, 0x03, 0x35, 0x0e,
+  0x1e, 0x50, 0xed, 0xbc, 0x17, 0x03, 0xc3, 0xcf, 0x61, 0xe9, 0x14, 0xe3,
+  0x11, 0x2f, 0xd0, 0xca, 0x24, 0x42, 0x11, 0x0c, 0xbc, 0xf5, 0xf5, 0xe6,
+  0xf0, 0x39, 0x21, 0x16, 0x31, 0xe2, 0x07, 0xde, 0x03, 0xe9, 0xc5, 0x2b,
+  0x36, 0x10, 0xd9, 0xff, 0xf8, 0x9b, 0xe3, 0xff, 0x4f, 0xef, 0xe4, 0xd2,
+  0x02, 0xe3, 0xf8, 0xed, 0xe0, 0xed, 0x30, 0xb0, 0xdf, 0x14, 0x16, 0xe7,
+  0x08, 0x0d, 0xcc, 0xf1, 0xd3, 0xf6, 0x0c, 0x18, 0xef, 0x46, 0x10, 0xd0,
+  0xb7, 0xf4, 0x20, 0xec, 0xd2, 0x03, 0x18, 0xc5, 0x04, 0x04, 0x4f, 0x1c,
+  0x21, 0xd4, 0xff, 0xdc, 0x33, 0xcb, 0xcc, 0xf7, 0xde, 0x22, 0xf2, 0xe0,
+  0x12, 0x42, 0x0d, 0xee, 0x4f, 0xfc, 0x0d, 0xf5, 0x1c, 0x44, 0x2c, 0xca,
+  0xe9, 0x88, 0x18, 0x31, 0x50, 0x24, 0x1d, 0xf6, 0xe1, 0xb9, 0x26, 0xd6,
+  0xd7, 0x06, 0x49, 0x0a, 0xfa, 0x13, 0xc5, 0xf1, 0xcd, 0x27, 0x16, 0xb6,
+  0x95, 0xe3, 0xe2, 0x0e, 0x2d, 0xd5, 0x11, 0x37, 0xf1, 0xef, 0x1a, 0xa8,
+  0xb9, 0x0b, 0xe1, 0x07, 0xaf, 0xed, 0xcf, 0x03, 0xe5, 0x1c, 0xea, 0xb3,
+  0x6d, 0x67, 0x09, 0x2d, 0xe3, 0xdb, 0xe2, 0x01, 0x0f, 0x01, 0x3f, 0xef,
+  0xbd, 0x06, 0x36, 0x55, 0xa0, 0xd9, 0x0c, 0x40, 0x21, 0x81, 0xe4, 0x06,
+  0xb5, 0x20, 0xf1, 0xd7, 0x76, 0xed, 0xff, 0xac, 0xed, 0x19, 0xf7, 0xd2,
+  0x2f, 0x05, 0x31, 0x2b, 0xc3, 0x02, 0x6e, 0x5e, 0xea, 0x19, 0xf8, 0xf8,
+  0xf1, 0x02, 0xf2, 0x8a, 0xf3, 0xc3, 0x4a, 0x2d, 0xd3, 0xdc, 0xd2, 0xf3,
+  0x26, 0xdd, 0xf9, 0xc2, 0xda, 0x07, 0x19, 0xd6, 0x32, 0xde, 0xfd, 0x1c,
+  0x59, 0x1e, 0xda, 0xb1, 0xca, 0x16, 0xff, 0x0e, 0xb5, 0xa1, 0xe8, 0x19,
+  0x6e, 0xdf, 0x51, 0x09, 0xea, 0xad, 0x1d, 0xf7, 0x3c, 0x10, 0x00, 0x87,
+  0x66, 0x72, 0x22, 0x73, 0xe2, 0x40, 0xe9, 0x01, 0xcd, 0xe3, 0x2e, 0xd1,
+  0x4f, 0x1d, 0x15, 0x30, 0x3f, 0x14, 0x33, 0x92, 0xdf, 0x15, 0xdc, 0xdd,
+  0xc2, 0xbb, 0xf4, 0xf6, 0xf0, 0x30, 0x11, 0x8d, 0xee, 0x0d, 0xc6, 0x22,
+  0x6e, 0x97, 0xb7, 0x24, 0x26, 0xf2, 0xca, 0x40, 0xd0, 0x81, 0xec, 0xd6,
+  0x04, 0x2f, 0x25, 0x02, 0xda, 0xe4, 0xc8, 0xdf, 0x8c, 0xf0, 0x78, 0xd2,
+  0xf4, 0x0c, 0x33, 0xde, 0xdb, 0x00, 0xb1, 0x1a, 0x25, 0x0c, 0x16, 0x2e,
+  0x14, 0x36, 0xf2, 0xdf, 0x25, 0x23, 0xd4, 0xc4, 0x06, 0x0f, 0xb1, 0xed,
+  0x39, 0xcc, 0xe3, 0x33, 0x2e, 0x09, 0xdd, 0x0d, 0x30, 0x03, 0x05, 0xe0,
+  0x24, 0x62, 0x0d, 0x17, 0xef, 0x26, 0x06, 0x0e, 0xf0, 0xc9, 0xee, 0x13,
+  0x24, 0xea, 0x2e, 0x04, 0x16, 0xb1, 0x02, 0xcc, 0xe3, 0xdb, 0xa0, 0xfd,
+  0x03, 0xd9, 0xbb, 0xef, 0xc7, 0x05, 0x25, 0xe3, 0x26, 0xe1, 0x35, 0x81,
+  0x08, 0xb0, 0x34, 0xcf, 0xc9, 0xf5, 0xbc, 0xdd, 0xe0, 0x20, 0xeb, 0x0c,
+  0xd7, 0xed, 0xfb, 0x94, 0x0a, 0xa8, 0x36, 0xfa, 0xbc, 0x4b, 0x35, 0xf7,
+  0xa1, 0xeb, 0xca, 0x1c, 0x11, 0x04, 0x2f, 0x0b, 0x03, 0xe2, 0xb1, 0x41,
+  0xbe, 0x0c, 0xd0, 0x20, 0xa8, 0x95, 0x13, 0xa9, 0x25, 0x3b, 0x38, 0x41,
+  0xa8, 0x26, 0xeb, 0x3b, 0xc5, 0xc1, 0xad, 0x3c, 0x24, 0xef, 0xe9, 0xe4,
+  0x2e, 0x1e, 0x49, 0xf2, 0xc6, 0x38, 0x05, 0x10, 0x15, 0x51, 0x01, 0xd4,
+  0x19, 0xf3, 0x9e, 0xb2, 0xf4, 0xce, 0xd3, 0xe5, 0xb6, 0x37, 0x11, 0xfa,
+  0xfd, 0x24, 0xf0, 0xdd, 0x12, 0xe6, 0xe5, 0x3a, 0xdd, 0x32, 0xf3, 0x17,
+  0xce, 0x45, 0x09, 0x35, 0x30, 0x3f, 0xf7, 0x38, 0xd8, 0xe8, 0xe4, 0xcf,
+  0xf8, 0x2b, 0xc0, 0xfa, 0x08, 0x43, 0x81, 0x1b, 0xf9, 0x55, 0x0f, 0xfe,
+  0xd0, 0x24, 0xd6, 0x33, 0x42, 0xf7, 0xff, 0x20, 0xb8, 0x0f, 0xdf, 0x14,
+  0x19, 0x00, 0xd1, 0xda, 0xd6, 0xb4, 0xdb, 0xf9, 0xcc, 0xd3, 0x12, 0xe6,
+  0xe2, 0xbb, 0x04, 0xe9, 0x21, 0xfc, 0xa1, 0xd1, 0x34, 0xce, 0xe1, 0x16,
+  0x1e, 0x20, 0x07, 0x1e, 0xfe, 0xe0, 0xf9, 0x00, 0xf7, 0xe5, 0x2b, 0x0b,
+  0x29, 0x3e, 0x22, 0x2a, 0xf8, 0x45, 0x0e, 0x3f, 0xb5, 0x2a, 0x11, 0xf5,
+  0xee, 0xf9, 0x1b, 0x36, 0x47, 0x9b, 0x14, 0xfa, 0x35, 0x0b, 0xb3, 0x15,
+  0xf4, 0xcf, 0xd2, 0xf9, 0x9e, 0xd4, 0x51, 0xaa, 0x2b, 0xf5, 0x43, 0x25,
+  0xd7, 0x1b, 0x04, 0x22, 0xf1, 0x2d, 0xfa, 0xff, 0x2f, 0xc5, 0xe4, 0x12,
+  0xcc, 0xce, 0xff, 0x08, 0x51, 0xe4, 0x66, 0xe8, 0x40, 0xf8, 0xfa, 0xf6,
+  0x10, 0xe1, 0x09, 0x3e, 0xa9, 0xd1, 0xfd, 0xc0, 0xe2, 0xef, 0xee, 0x06,
+  0xea, 0x1c, 0x0c, 0xfe, 0xee, 0xfa, 0x0b, 0xe5, 0x2f, 0xbc, 0x04, 0xeb,
+  0xdc, 0xce, 0xdd, 0xee, 0x0a, 0x0e, 0xf5, 0x2d, 0xcd, 0xf4, 0x0e, 0xc9,
+  0x2e, 0x58, 0x12, 0x0e, 0xe8, 0xdb, 0xd7, 0xf9, 0xd2, 0xfd, 0x00, 0xbf,
+  0x14, 0xf4, 0x37, 0xfb, 0xff, 0xe5, 0x00, 0x0d, 0xf9, 0x38, 0xb6, 0xcf,
+  0xe8, 0x61, 0x29, 0xc6, 0x1a, 0xd9, 0xcd, 0xe9, 0xd6, 0xfd, 0x08, 0x05,
+  0x13, 0x38, 0xc5, 0x04, 0x1f, 0xd2, 0x02, 0xdd, 0xf1, 0x5c, 0xad, 0x0a,
+  0xf3, 0x42, 0xb4, 0x30, 0x7f, 0xf3, 0xf9, 0x30, 0xc7, 0x02, 0x4f, 0x0a,
+  0x1f, 0xd8, 0xdc, 0x05, 0x01, 0x7f, 0x23, 0x08, 0x68, 0xd1, 0x02, 0x0b,
+  0x3b, 0xe1, 0x7b, 0xe7, 0x54, 0x19, 0x24, 0xd2, 0x01, 0x30, 0xfe, 0xde,
+  0xdc, 0x77, 0x07, 0x53, 0x4f, 0xf0, 0xaf, 0xba, 0x36, 0x14, 0x2a, 0xe9,
+  0x29, 0x27, 0x07, 0xf1, 0x02, 0xa2, 0xac, 0x35, 0x10, 0x18, 0x02, 0x1c,
+  0xcf, 0xa3, 0x27, 0xf9, 0xfb, 0xe5, 0xbe, 0xc9, 0x30, 0xd3, 0xc5, 0xed,
+  0x12, 0xef, 0xb6, 0xff, 0x05, 0xaa, 0xd3, 0xea, 0x24, 0x47, 0x21, 0x48,
+  0x68, 0x24, 0x1e, 0xb4, 0x29, 0xec, 0x4e, 0x21, 0xfb, 0x36, 0xf0, 0xc0,
+  0xc5, 0x54, 0x2f, 0xab, 0x14, 0xd1, 0xfb, 0xe3, 0xe4, 0x37, 0xee, 0x99,
+  0xa1, 0xaf, 0xf7, 0x25, 0xaf, 0x4b, 0xfd, 0xf5, 0x55, 0xf8, 0x12, 0x09,
+  0x50, 0xd7, 0x14, 0xac, 0xf4, 0xa9, 0xc4, 0xc7, 0xb9, 0xd8, 0xec, 0xee,
+  0xd5, 0xfb, 0xcf, 0xdf, 0x2d, 0x14, 0xe6, 0x34, 0x10, 0x2e, 0x40, 0x09,
+  0xf8, 0x16, 0x37, 0x01, 0x30, 0xff, 0xf3, 0xf5, 0xe3, 0xe0, 0x30, 0xfa,
+  0xdd, 0xcd, 0x3f, 0x1d, 0xfb, 0xcc, 0x28, 0xbc, 0xed, 0x05, 0x0b, 0xea,
+  0xc6, 0x2e, 0x03, 0xcb, 0x18, 0x02, 0xf7, 0xf6, 0xfe, 0x00, 0x00, 0x21,
+  0x24, 0x03, 0xb5, 0x0d, 0x47, 0xe4, 0x0e, 0xcc, 0xf0, 0xfd, 0x19, 0xc0,
+  0x1c, 0xf3, 0xed, 0xcd, 0xef, 0x6d, 0x25, 0xf6, 0xde, 0x7f, 0xd3, 0x09,
+  0xf7, 0xf8, 0x08, 0x0b, 0x21, 0xde, 0x23, 0x10, 0x1b, 0x2b, 0xf5, 0xfb,
+  0x17, 0x28, 0xfc, 0xd7, 0xdb, 0x0f, 0xe5, 0xf0, 0xca, 0xfa, 0x03, 0xd3,
+  0x44, 0xc4, 0x13, 0x05, 0x06, 0xc8, 0x11, 0x21, 0xe4, 0xf7, 0xf5, 0x1c,
+  0xc1, 0xcd, 0x3a, 0x06, 0x04, 0xfb, 0x55, 0x0b, 0xf9, 0xde, 0x0d, 0x06,
+  0xfc, 0x27, 0x06, 0xef, 0x0e, 0xf9, 0xd1, 0xe5, 0xf9, 0x40, 0xf2, 0xe5,
+  0xed, 0x24, 0xd0, 0x2d, 0x27, 0x07, 0xcd, 0xd9, 0xf4, 0xb7, 0xf9, 0x50,
+  0xea, 0x31, 0x37, 0x32, 0x22, 0xc1, 0x57, 0x33, 0x1b, 0xdb, 0xa8, 0x12,
+  0x15, 0xdd, 0x33, 0x59, 0xd1, 0xc4, 0x02, 0x57, 0x4c, 0x38, 0xe4, 0xdf,
+  0xe5, 0x40, 0xdc, 0x58, 0x40, 0xeb, 0x44, 0xf2, 0x16, 0xee, 0xfb, 0x01,
+  0x51, 0x7f, 0xf5, 0xbe, 0x3d, 0x0a, 0x16, 0xce, 0x73, 0x29, 0x07, 0xc9,
+  0xee, 0x13, 0x0b, 0x2d, 0x3d, 0xa8, 0x3b, 0xc6, 0x2e, 0x19, 0xb4, 0xad,
+  0x06, 0x35, 0xe0, 0x12, 0x05, 0xfb, 0xaf, 0x15, 0xdb, 0x0c, 0x07, 0x6c,
+  0xb8, 0xd7, 0x38, 0x20, 0x20, 0x1e, 0x32, 0xcf, 0xf6, 0x0e, 0x18, 0x77,
+  0xaf, 0x24, 0xe6, 0xf4, 0xc5, 0x5d, 0xd6, 0x1f, 0x13, 0x1e, 0xa5, 0xe2,
+  0xd5, 0x29, 0x0c, 0x0a, 0x36, 0xc0, 0xbd, 0xf8, 0xcb, 0xdb, 0xe7, 0x9c,
+  0x30, 0xf1, 0x4b, 0xd1, 0x18, 0x41, 0x70, 0x32, 0x27, 0x30, 0xaa, 0xe1,
+  0xe2, 0x68, 0x28, 0xd7, 0x40, 0xee, 0xe2, 0x0a, 0x0c, 0x14, 0x73, 0x67,
+  0x22, 0x32, 0xda, 0x14, 0xdb, 0x1c, 0xfe, 0x0c, 0xfe, 0x12, 0x4b, 0xc9,
+  0x41, 0x0e, 0x38, 0x50, 0xbb, 0x1f, 0xf5, 0x33, 0x37, 0xda, 0x06, 0xbc,
+  0xd9, 0xf5, 0xf0, 0x2f, 0x00, 0xcc, 0xda, 0xe3, 0x0e, 0xd7, 0x47, 0x2c,
+  0xd9, 0x05, 0xd8, 0x22, 0xae, 0x03, 0x3f, 0x2a, 0x35, 0x3c, 0x1f, 0x2e,
+  0x36, 0xdd, 0xdd, 0xce, 0xd0, 0xf9, 0xe3, 0xc2, 0x08, 0x3b, 0x08, 0xee,
+  0x1c, 0xea, 0x3c, 0xf9, 0xed, 0xd9, 0xfa, 0x43, 0xd3, 0x00, 0x0a, 0x7f,
+  0x33, 0x34, 0x1d, 0xd4, 0xbc, 0x45, 0xfa, 0xfb, 0xe3, 0x1e, 0xb2, 0x00,
+  0xad, 0x33, 0x36, 0x1c, 0xf1, 0x06, 0x21, 0x04, 0x1d, 0xc8, 0x4d, 0x79,
+  0xfd, 0x1b, 0x4d, 0xa9, 0xcd, 0xe9, 0xd9, 0xb0, 0x05, 0xd5, 0x02, 0xef,
+  0xca, 0x29, 0xec, 0x08, 0x45, 0x17, 0x49, 0xf7, 0x0d, 0x02, 0xc9, 0xd8,
+  0xf9, 0xf5, 0xda, 0xcb, 0x1b, 0x7c, 0xee, 0x27, 0x15, 0x65, 0xe6, 0x5c,
+  0x0d, 0x14, 0x26, 0x34, 0xaf, 0x4b, 0x21, 0x16, 0xcb, 0x1a, 0x03, 0x7f,
+  0x1c, 0xf2, 0xe8, 0x26, 0xeb, 0x18, 0x03, 0x03, 0xcf, 0x2d, 0x34, 0xd0,
+  0x0c, 0xfa, 0x0a, 0x0a, 0x24, 0xe5, 0x26, 0xd9, 0x9c, 0xcd, 0xfa, 0x4a,
+  0x37, 0x0f, 0xed, 0x18, 0xca, 0xa2, 0x0b, 0x09, 0x24, 0xcd, 0x05, 0xe2,
+  0xd2, 0xf9, 0xc8, 0xd0, 0x43, 0x24, 0x2b, 0xf3, 0xae, 0x1b, 0x2d, 0xf1,
+  0x45, 0xf7, 0x43, 0xee, 0x9e, 0xf8, 0x07, 0xe1, 0xb7, 0xe4, 0x2c, 0xd8,
+  0xec, 0x12, 0xf1, 0xca, 0xf5, 0xaf, 0xdc, 0xd2, 0x2d, 0x47, 0x45, 0x0e,
+  0xf9, 0xcf, 0x32, 0xef, 0x40, 0x20, 0x9f, 0x16, 0xe3, 0xfe, 0x0b, 0x0a,
+  0xf2, 0xfe, 0x4d, 0xf2, 0x07, 0x0e, 0x19, 0xcd, 0xf0, 0xa8, 0xf4, 0x0d,
+  0x1e, 0xe2, 0xfb, 0x1f, 0xbc, 0x1f, 0x1e, 0xbe, 0x0c, 0xda, 0x05, 0x07,
+  0xdd, 0x07, 0xfb, 0xf9, 0x56, 0x26, 0x10, 0x0e, 0xca, 0xc5, 0xda, 0x1a,
+  0xe3, 0xf2, 0x47, 0x15, 0xe5, 0x0b, 0xf3, 0x30, 0xef, 0x11, 0xce, 0xb6,
+  0xcb, 0xc2, 0xe4, 0x09, 0x2a, 0xec, 0xef, 0xf8, 0x1b, 0xf3, 0xb4, 0x3e,
+  0x03, 0xfd, 0xfb, 0x0e, 0xe7, 0x1c, 0xf4, 0x0f, 0xc0, 0xf7, 0x66, 0x35,
+  0xe8, 0xe9, 0xb4, 0xbc, 0x0f, 0xdd, 0xeb, 0xd4, 0x0e, 0xd6, 0x1e, 0xc9,
+  0xab, 0x0d, 0x28, 0x58, 0x00, 0x16, 0xfd, 0xb9, 0xd0, 0x1f, 0x6b, 0xbb,
+  0x10, 0x04, 0xfb, 0x03, 0xa0, 0xdd, 0xce, 0x17, 0x2f, 0x0f, 0xef, 0x10,
+  0x0b, 0x1e, 0xf7, 0xd6, 0x1f, 0x5f, 0x07, 0xcd, 0x7f, 0x9f, 0xe6, 0xc8,
+  0xe2, 0xcb, 0x08, 0xe2, 0xb4, 0x65, 0xb6, 0xde, 0xf9, 0xf8, 0xee, 0xee,
+  0xd9, 0x25, 0x13, 0x58, 0x2e, 0x2c, 0x48, 0xdf, 0x14, 0x61, 0xcb, 0x44,
+  0x18, 0x3d, 0x0b, 0xdd, 0x1a, 0xd2, 0xce, 0xc7, 0xba, 0x52, 0x08, 0x0f,
+  0x3d, 0x06, 0x0c, 0x0a, 0xf4, 0xfe, 0xa6, 0xdb, 0x1e, 0xfc, 0x0a, 0x27,
+  0x37, 0xe8, 0xf2, 0x2a, 0x8f, 0x36, 0xab, 0xce, 0xca, 0xba, 0xb4, 0x2c,
+  0xcf, 0xeb, 0x26, 0xb0, 0xf0, 0x40, 0xd3, 0x3f, 0x0d, 0xcc, 0xef, 0x69,
+  0x15, 0x35, 0x18, 0x2c, 0xc9, 0x44, 0x22, 0xb5, 0x5a, 0x00, 0xca, 0x0d,
+  0x42, 0xd7, 0xec, 0xd8, 0xb4, 0x23, 0x4b, 0xa6, 0x1a, 0x05, 0xb2, 0xb7,
+  0xc4, 0x3a, 0x54, 0xd3, 0x25, 0x53, 0x3a, 0xd5, 0xfb, 0x62, 0x0e, 0x06,
+  0x26, 0xd0, 0x10, 0xcf, 0xb0, 0xb8, 0x9f, 0x44, 0x60, 0xf0, 0x09, 0x22,
+  0xd2, 0x01, 0x0b, 0xab, 0xc0, 0xed, 0xfc, 0x35, 0xc4, 0xe1, 0xec, 0xbe,
+  0x81, 0xaf, 0xa1, 0xc2, 0xe6, 0xef, 0x06, 0xbb, 0xce, 0x5d, 0xca, 0xfc,
+  0x24, 0xe7, 0x3d, 0xb3, 0x00, 0xe6, 0x19, 0x33, 0xa5, 0x02, 0x1f, 0x3d,
+  0xf8, 0x0d, 0xde, 0xe0, 0x08, 0xec, 0xed, 0xb4, 0xcf, 0x30, 0x00, 0xd6,
+  0xd0, 0xcf, 0xfd, 0x20, 0x04, 0xfb, 0xe8, 0x24, 0xf5, 0x46, 0xbf, 0xf4,
+  0x09, 0x10, 0xfe, 0xe1, 0x42, 0x0c, 0xf1, 0xc9, 0xcd, 0xeb, 0x37, 0x3f,
+  0x35, 0xec, 0xc5, 0xee, 0x20, 0x0a, 0xef, 0xfb, 0xb6, 0xd9, 0x01, 0x10,
+  0x17, 0xc7, 0x3f, 0xe7, 0x7f, 0xd8, 0x16, 0x1c, 0xbe, 0xe4, 0x09, 0x2e,
+  0x15, 0x25, 0xad, 0xf0, 0x0b, 0x04, 0xf8, 0xca, 0xf3, 0x2f, 0x40, 0xc4,
+  0xc9, 0xe2, 0xf9, 0x2c, 0xcd, 0x0a, 0x24, 0xbb, 0x2f, 0x26, 0x00, 0x03,
+  0x27, 0x4c, 0x32, 0xf8, 0xfa, 0x13, 0xc9, 0x3c, 0x0a, 0x24, 0x00, 0xfb,
+  0xd0, 0x1a, 0xe4, 0x31, 0x11, 0x18, 0x16, 0x06, 0x1e, 0xfa, 0x00, 0xfc,
+  0xc8, 0xf2, 0x15, 0x07, 0x0e, 0xb4, 0xf6, 0xeb, 0x01, 0x0d, 0xff, 0xb9,
+  0x1a, 0xe5, 0x26, 0x07, 0xe2, 0x06, 0x07, 0x08, 0xfb, 0xfd, 0x51, 0xc6,
+  0x23, 0xbf, 0xd2, 0xc8, 0xd2, 0xd6, 0xf3, 0x33, 0x1c, 0x1f, 0x6b, 0xf2,
+  0x13, 0xc4, 0x63, 0xf9, 0xf7, 0x2c, 0x31, 0xe1, 0x23, 0x62, 0x25, 0xd9,
+  0x0d, 0x3b, 0x1c, 0x12, 0xfc, 0xf7, 0xd5, 0xf8, 0x81, 0x28, 0xc2, 0xcd,
+  0x64, 0xe6, 0x10, 0xd0, 0xec, 0xcc, 0xe1, 0x9b, 0xfa, 0x1f, 0x1b, 0x8c,
+  0x1d, 0x1c, 0x12, 0xb7, 0xeb, 0x71, 0x09, 0xf8, 0xc1, 0xe0, 0xc4, 0x4e,
+  0x2a, 0xcc, 0xdd, 0x20, 0x04, 0x42, 0x00, 0xc7, 0xeb, 0x33, 0xf5, 0x46,
+  0xee, 0xe7, 0x0e, 0x28, 0x1a, 0x70, 0x0a, 0xf5, 0x51, 0x2b, 0x09, 0x21,
+  0xfc, 0xc1, 0x26, 0x40, 0x1d, 0xb2, 0xe6, 0xcf, 0x3a, 0xec, 0xcb, 0xef,
+  0xe7, 0xeb, 0x5b, 0xa0, 0x35, 0x02, 0xc2, 0xfb, 0x9f, 0x16, 0x0d, 0xa0,
+  0x24, 0x53, 0x08, 0xa3, 0x39, 0xc7, 0x8e, 0x28, 0xf6, 0x03, 0xe8, 0x3c,
+  0x3b, 0x7d, 0x1d, 0xca, 0xde, 0xfe, 0x00, 0xd6, 0x06, 0x50, 0x69, 0xe0,
+  0x60, 0x4e, 0x92, 0xf0, 0xca, 0xf2, 0x2a, 0x2d, 0xfb, 0xcc, 0x46, 0x0e,
+  0x13, 0xe5, 0xad, 0x31, 0xec, 0xe4, 0xda, 0xae, 0xe0, 0xe7, 0x21, 0xd0,
+  0xa3, 0x3e, 0x38, 0xbf, 0xb9, 0xc2, 0xa4, 0xd0, 0x0c, 0x32, 0xe2, 0x71,
+  0xb7, 0xde, 0x10, 0xba, 0xf5, 0xf0, 0xba, 0x5d, 0xf9, 0xb2, 0x0a, 0xb0,
+  0xe9, 0x3d, 0x50, 0xbf, 0x48, 0xce, 0xee, 0x06, 0x01, 0xd2, 0xc5, 0x29,
+  0xd3, 0x1b, 0xc9, 0xf6, 0xc5, 0x27, 0x4f, 0x17, 0x9e, 0x09, 0xe1, 0x01,
+  0x39, 0x47, 0x28, 0xf5, 0x95, 0x18, 0xc6, 0x1d, 0x40, 0x1b, 0x30, 0x12,
+  0x2a, 0xdd, 0xbe, 0x67, 0x44, 0x50, 0x30, 0xb0, 0xcc, 0xc1, 0x5b, 0xdb,
+  0xfb, 0x04, 0xe7, 0xed, 0xfe, 0x76, 0x86, 0xf4, 0xab, 0x3b, 0xfd, 0xed,
+  0xbd, 0xac, 0x32, 0xdc, 0x25, 0xec, 0x1d, 0xe1, 0x7f, 0xf5, 0xc3, 0x04,
+  0x22, 0xc8, 0x3a, 0x81, 0x42, 0xb9, 0x0b, 0x3d, 0xe2, 0x09, 0x52, 0x0d,
+  0x19, 0xaf, 0x24, 0xcd, 0xfc, 0x00, 0x0f, 0xb1, 0x13, 0xc1, 0x14, 0x59,
+  0xe4, 0xc7, 0x2a, 0xb1, 0x86, 0x54, 0xe2, 0xf7, 0xfc, 0x53, 0xef, 0xcb,
+  0xeb, 0x26, 0xdf, 0x24, 0xe1, 0xf0, 0x2f, 0x2b, 0x18, 0x31, 0x34, 0xef,
+  0xe6, 0x30, 0xa7, 0xe0, 0xfb, 0x3d, 0xd1, 0x59, 0x01, 0x19, 0xf1, 0x26,
+  0xcc, 0x0d, 0x4d, 0x10, 0x60, 0x25, 0x76, 0x0d, 0x14, 0xb8, 0xad, 0xe3,
+  0xb7, 0x64, 0xfd, 0x8f, 0xe3, 0x81, 0x38, 0xb1, 0xf5, 0x1e, 0xe8, 0xc9,
+  0xec, 0x58, 0xc1, 0x26, 0x2f, 0x49, 0xb5, 0xb3, 0x45, 0xb2, 0x1f, 0x98,
+  0xfd, 0x38, 0x0f, 0xc8, 0xe6, 0x6c, 0x90, 0xac, 0x26, 0xc5, 0x0f, 0x55,
+  0x1e, 0x31, 0x04, 0x58, 0xd3, 0x5c, 0x4a, 0xfd, 0x1e, 0xab, 0x15, 0x62,
+  0x22, 0xe7, 0x14, 0x2c, 0x08, 0xb0, 0xce, 0xe6, 0x20, 0x5b, 0x57, 0xcb,
+  0x09, 0x9b, 0x15, 0xba, 0xc1, 0xe7, 0xf4, 0x0f, 0xfd, 0xba, 0x44, 0xfe,
+  0x2d, 0xde, 0x44, 0x26, 0x15, 0x14, 0x26, 0xba, 0x62, 0x24, 0x1a, 0xee,
+  0xe8, 0x27, 0xf5, 0x0b, 0x3d, 0x16, 0x16, 0xd5, 0xbf, 0x57, 0x0a, 0x17,
+  0x10, 0xea, 0x08, 0xd7, 0xe2, 0x24, 0x31, 0xd5, 0x16, 0x1d, 0x4e, 0x38,
+  0xca, 0x17, 0xfc, 0xc3, 0x2f, 0x03, 0xfd, 0xf2, 0x3a, 0xe8, 0x1b, 0x61,
+  0x16, 0xe8, 0x2d, 0x12, 0x53, 0x7e, 0xe7, 0xe3, 0xc1, 0x24, 0x4b, 0xa3,
+  0xe3, 0x56, 0xb7, 0x26, 0xba, 0x3e, 0xed, 0x0a, 0x1f, 0xd6, 0xca, 0x33,
+  0xfa, 0xc1, 0xdf, 0xef, 0xf3, 0xb6, 0xd3, 0xc6, 0xfe, 0x82, 0xdf, 0xb1,
+  0xcf, 0x56, 0x2c, 0x17, 0xd6, 0xee, 0x07, 0xd6, 0x81, 0xd4, 0xba, 0x55,
+  0x1b, 0x35, 0x30, 0x01, 0x0d, 0x31, 0x21, 0xe3, 0xf0, 0xb0, 0x1a, 0xf0,
+  0xa9, 0x22, 0x2a, 0x05, 0x2c, 0x43, 0xdf, 0xc2, 0x37, 0x29, 0x4a, 0x33,
+  0xfe, 0xc8, 0xfb, 0x44, 0xd9, 0x3b, 0x31, 0xa7, 0x12, 0x19, 0x1b, 0xbb,
+  0xae, 0x03, 0xbe, 0x14, 0xc9, 0xca, 0xc8, 0x53, 0xd3, 0x2c, 0x2e, 0x3c,
+  0x73, 0x56, 0xdb, 0x26, 0x42, 0x53, 0xe8, 0x0f, 0x0c, 0xc5, 0x5e, 0x24,
+  0xab, 0x65, 0x4c, 0x00, 0x1d, 0x55, 0xff, 0xdc, 0x25, 0x3f, 0x3a, 0xe8,
+  0x1d, 0x05, 0xe4, 0x20, 0xc5, 0xd6, 0x09, 0xfc, 0x2a, 0x05, 0x31, 0xbe,
+  0x37, 0x1b, 0xe4, 0x3f, 0xb7, 0x01, 0x5b, 0xbb, 0x0d, 0xfc, 0xc4, 0xde,
+  0xd7, 0x31, 0xeb, 0xfa, 0x4b, 0xd1, 0x16, 0x24, 0xe5, 0x13, 0x2b, 0x33,
+  0x4c, 0x0b, 0x58, 0xd8, 0x2c, 0x28, 0xeb, 0xa0, 0xc2, 0x22, 0xe8, 0xd0,
+  0xee, 0x0a, 0xe3, 0x37, 0x0b, 0xf8, 0x15, 0x0a, 0x23, 0x19, 0x58, 0xe0,
+  0xc2, 0xe1, 0x29, 0x38, 0x04, 0x23, 0xf1, 0x57, 0x7f, 0x1b, 0xc1, 0x05,
+  0x08, 0x53, 0x28, 0xd5, 0x2f, 0xdc, 0x38, 0x19, 0xd2, 0xf1, 0x08, 0x13,
+  0xf1, 0x4b, 0x21, 0x2b, 0x81, 0x23, 0x20, 0x01, 0xef, 0xf5, 0xbb, 0x05,
+  0xea, 0x0a, 0xd5, 0xf3, 0x17, 0x16, 0xd5, 0x04, 0xc0, 0x17, 0xe4, 0x11,
+  0x04, 0x2c, 0x0e, 0x14, 0x1b, 0x01, 0x15, 0xfd, 0xeb, 0xd5, 0xfa, 0x01,
+  0x24, 0x27, 0xce, 0xcb, 0x06, 0x2a, 0xd9, 0xfb, 0x01, 0x35, 0x0e, 0x1d,
+  0xde, 0x4d, 0xb3, 0xa6, 0x43, 0xf7, 0xcd, 0xe2, 0xaa, 0xdd, 0x08, 0x42,
+  0xfa, 0xd1, 0x2b, 0xf6, 0xd4, 0xcf, 0x06, 0xf3, 0xd9, 0xde, 0x02, 0x3f,
+  0x11, 0xe5, 0x1b, 0xc0, 0x0e, 0x08, 0xfc, 0x22, 0xdc, 0x23, 0x36, 0xde,
+  0x2d, 0xca, 0x2a, 0x14, 0x24, 0x1c, 0xbd, 0xda, 0x07, 0x01, 0x06, 0xea,
+  0x35, 0x08, 0xfd, 0xd9, 0xfa, 0x3b, 0xe2, 0x1c, 0x10, 0xd1, 0x38, 0xf7,
+  0xf8, 0x25, 0xdc, 0x44, 0xe1, 0x10, 0xd1, 0x01, 0x3c, 0xff, 0x1c, 0x2a,
+  0xb8, 0x06, 0x31, 0xae, 0x00, 0xd6, 0x07, 0x9d, 0xb8, 0xeb, 0x09, 0x11,
+  0x48, 0xdb, 0x03, 0x5f, 0x29, 0xfd, 0x50, 0xc7, 0x1c, 0x21, 0xe7, 0x1d,
+  0x42, 0xf9, 0x31, 0x72, 0x11, 0xb4, 0x19, 0xe8, 0xd4, 0x04, 0xf4, 0xe9,
+  0xfe, 0x10, 0xd0, 0xcc, 0x43, 0xf2, 0x1b, 0xca, 0x25, 0x4b, 0x0c, 0x41,
+  0xd5, 0xc7, 0xf2, 0x41, 0xe4, 0xfb, 0x06, 0xf8, 0x5f, 0x50, 0x73, 0x71,
+  0x42, 0x6e, 0x1f, 0x05, 0x19, 0x52, 0xad, 0x15, 0x10, 0xeb, 0x0a, 0x08,
+  0x81, 0x33, 0xcb, 0x24, 0xa6, 0x21, 0x9e, 0x71, 0x06, 0xe9, 0xfc, 0x44,
+  0x91, 0xcf, 0xde, 0xac, 0xd7, 0x0c, 0xb4, 0x12, 0xd7, 0xc1, 0x24, 0xd3,
+  0x10, 0xcd, 0x16, 0x06, 0x35, 0x28, 0xd9, 0x14, 0x36, 0xeb, 0x9d, 0x1d,
+  0x2b, 0x21, 0x2a, 0xf2, 0x01, 0x46, 0xcc, 0x0d, 0x3d, 0xc3, 0xd9, 0x8b,
+  0x38, 0x37, 0x24, 0x77, 0x2a, 0xab, 0xec, 0xfa, 0x20, 0x45, 0x26, 0x0f,
+  0x69, 0xd9, 0x34, 0xef, 0xfa, 0x14, 0x08, 0x98, 0x03, 0xd9, 0x24, 0x40,
+  0x28, 0x15, 0xeb, 0x2c, 0x17, 0x18, 0x13, 0xea, 0x18, 0xfa, 0x0e, 0xa2,
+  0x19, 0xf2, 0xe1, 0xf9, 0xa1, 0xea, 0xba, 0xf2, 0xf4, 0xf7, 0xf3, 0xf9,
+  0x00, 0x1a, 0x0a, 0xdc, 0x3e, 0x50, 0x3a, 0x3a, 0xe2, 0x1e, 0xad, 0x21,
+  0xef, 0xbc, 0x0a, 0x2f, 0x0a, 0x0e, 0x17, 0xdf, 0xd9, 0xfd, 0xb7, 0x0c,
+  0xdf, 0x6f, 0x31, 0x18, 0xfc, 0xcc, 0x44, 0xe5, 0x0f, 0x0d, 0x1a, 0xf8,
+  0xe8, 0xcf, 0x02, 0xfb, 0x79, 0xfa, 0xd0, 0x7f, 0xbe, 0x1e, 0x33, 0xf5,
+  0xf0, 0xaa, 0x0b, 0xfe, 0xef, 0x01, 0x16, 0xcf, 0x12, 0xca, 0x22, 0xe1,
+  0x0c, 0x38, 0x03, 0x11, 0xc5, 0x26, 0xc8, 0x08, 0x27, 0xd7, 0xfa, 0xd4,
+  0xd7, 0x58, 0x27, 0xb8, 0xf5, 0xf0, 0x16, 0x0b, 0x19, 0xb0, 0x2d, 0xc7,
+  0x29, 0xd0, 0xe7, 0xbc, 0x08, 0xb7, 0xc2, 0x16, 0x2e, 0xd8, 0x1c, 0x2a,
+  0x4d, 0x2c, 0xd0, 0x1f, 0xf4, 0x09, 0x25, 0xe2, 0xeb, 0x2f, 0xe6, 0xe6,
+  0xc7, 0x02, 0x1b, 0x35, 0xe8, 0x02, 0x16, 0x28, 0xfd, 0x0e, 0x01, 0x24,
+  0x4b, 0x27, 0xcf, 0x4b, 0x0f, 0xd4, 0xeb, 0xcf, 0xf3, 0x31, 0x0e, 0xde,
+  0x10, 0x29, 0xd9, 0x2e, 0xe7, 0xd4, 0xe6, 0xf9, 0x1d, 0xb7, 0x29, 0xf2,
+  0x7f, 0x00, 0x56, 0x1e, 0x13, 0x1b, 0xeb, 0x02, 0xfa, 0xf1, 0x15, 0x0d,
+  0xd6, 0xe0, 0x37, 0x02, 0x09, 0x3a, 0xd9, 0x06, 0xe6, 0xc2, 0xa7, 0x0b,
+  0x03, 0x13, 0xb2, 0xf1, 0x0b, 0x2e, 0xb2, 0xff, 0x2b, 0x33, 0x22, 0xc4,
+  0x4c, 0xdb, 0xf0, 0xcf, 0xc6, 0xd7, 0xde, 0x49, 0x05, 0xe0, 0x1d, 0x0f,
+  0x2f, 0x07, 0x25, 0x0c, 0xf5, 0x68, 0x42, 0x0e, 0x25, 0xe4, 0xfa, 0x01,
+  0x1b, 0x1f, 0x15, 0x32, 0x28, 0x39, 0xf9, 0xd4, 0xdd, 0xb7, 0x66, 0xe8,
+  0xa9, 0x2b, 0xd4, 0xea, 0xe2, 0xc2, 0xef, 0xec, 0xf8, 0xf8, 0xd4, 0x3e,
+  0x0f, 0x0d, 0x46, 0x00, 0x2a, 0x22, 0x6a, 0x6e, 0xc2, 0x30, 0xeb, 0x58,
+  0x3d, 0x64, 0xe5, 0xdc, 0xdc, 0xe4, 0xd8, 0x51, 0x33, 0xb1, 0x8e, 0x81,
+  0x46, 0x4c, 0xe9, 0xec, 0xb7, 0xfc, 0xfa, 0x1b, 0xd3, 0xdf, 0x27, 0x22,
+  0x3d, 0xf1, 0x2b, 0xfb, 0xf0, 0xf7, 0x05, 0x38, 0x08, 0xda, 0x41, 0xf8,
+  0xec, 0x92, 0x18, 0xd2, 0xcf, 0xe7, 0x99, 0xa3, 0xb5, 0xf5, 0x06, 0x2a,
+  0xc4, 0x02, 0xcf, 0xde, 0xdd, 0x35, 0x14, 0x08, 0x47, 0xe6, 0xef, 0x35,
+  0xcb, 0xf6, 0x58, 0x15, 0x5a, 0x17, 0x4e, 0x06, 0xe5, 0x11, 0xed, 0x9c,
+  0xe6, 0x2f, 0xd8, 0x32, 0xd1, 0x33, 0xe4, 0x23, 0xec, 0x03, 0xd4, 0x61,
+  0x1c, 0x0d, 0x0b, 0xdb, 0xea, 0xf2, 0xb1, 0x0a, 0x00, 0xfc, 0x9a, 0xda,
+  0x68, 0x2c, 0xd5, 0xf2, 0x76, 0xe4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x8f, 0x03, 0x00, 0x00,
   0x8d, 0x0e, 0x00, 0x00, 0xd4, 0xfe, 0xff, 0xff, 0xa0, 0xe8, 0xff, 0xff,
   0x07, 0xef, 0xff, 0xff, 0x36, 0xfc, 0xff, 0xff, 0xe6, 0xe6, 0xff, 0xff,
   0x00, 0x11, 0x00, 0x00, 0x64, 0xf0, 0xff, 0xff, 0x98, 0xe9, 0xff, 0xff,
@@ -3569,511 +3576,512 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x47, 0xee, 0xff, 0xff, 0xbc, 0x15, 0x00, 0x00, 0x4c, 0xf8, 0xff, 0xff,
   0xeb, 0xfb, 0xff, 0xff, 0x0f, 0xf7, 0xff, 0xff, 0x3e, 0xed, 0xff, 0xff,
   0x3e, 0x18, 0x00, 0x00, 0x5f, 0xe6, 0xff, 0xff, 0x88, 0xf1, 0xff, 0xff,
-  0xa4, 0x0d, 0x00, 0x00, 0xa2, 0xe6, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x80, 0x07, 0x00, 0x00, 0x04, 0x81, 0x48, 0x81, 0xc1, 0xdc, 0xd4, 0xcc,
-  0x81, 0xbb, 0x48, 0x7f, 0x97, 0xd1, 0x57, 0x19, 0x53, 0x16, 0xe0, 0xcc,
-  0xe3, 0x0c, 0x45, 0x7f, 0x53, 0x81, 0x7f, 0x54, 0x7f, 0x4d, 0x4c, 0x5d,
-  0x7f, 0x64, 0x0d, 0x5c, 0x2d, 0x81, 0xd7, 0x7f, 0x28, 0x81, 0x6a, 0x55,
-  0xac, 0xe8, 0x81, 0x1d, 0xd1, 0x52, 0x81, 0x7f, 0x7f, 0xa9, 0x81, 0xad,
-  0x7f, 0xe8, 0xe4, 0xa6, 0xab, 0x3f, 0xdd, 0x81, 0x7f, 0x58, 0x7f, 0x7f,
-  0x10, 0x81, 0x7f, 0xd2, 0x81, 0x9b, 0x58, 0x81, 0xb4, 0xed, 0x2f, 0x81,
-  0x9a, 0x1e, 0x3b, 0x4e, 0x81, 0xfc, 0x73, 0xd2, 0x08, 0x7f, 0xf8, 0x4a,
-  0xef, 0x81, 0x7f, 0xd3, 0xe4, 0x7f, 0x7f, 0x98, 0xaf, 0x5c, 0x4c, 0x30,
-  0x81, 0xd6, 0x8d, 0x7f, 0xe8, 0x41, 0x06, 0x1e, 0xe9, 0x3c, 0x3b, 0x7f,
-  0x45, 0xc4, 0x43, 0x47, 0x7a, 0x22, 0x7f, 0xe4, 0x01, 0x7f, 0xd8, 0xf5,
-  0xf5, 0xe3, 0x56, 0xd2, 0xf3, 0xef, 0xf6, 0xe7, 0xca, 0xd9, 0x52, 0x58,
-  0xcf, 0x81, 0x4f, 0x1b, 0x06, 0x30, 0xe1, 0xeb, 0xcc, 0x11, 0x14, 0x14,
-  0x47, 0xbb, 0x45, 0x47, 0x41, 0x36, 0x4d, 0x5d, 0x3e, 0x4d, 0x09, 0xed,
-  0xe2, 0xa5, 0x55, 0x6b, 0x2b, 0xc5, 0x09, 0x06, 0xb0, 0x06, 0xcf, 0xf8,
-  0xc6, 0x44, 0xcb, 0x46, 0x47, 0xfe, 0x84, 0x81, 0x30, 0xc9, 0xf0, 0xa7,
-  0xaa, 0x18, 0x04, 0xc0, 0x18, 0x31, 0x2a, 0x3e, 0xf4, 0xf1, 0x4f, 0xf0,
-  0xd3, 0xe5, 0x2a, 0x08, 0xa3, 0xe8, 0xf0, 0xbd, 0xc0, 0x16, 0x1b, 0x24,
-  0xa1, 0xff, 0x07, 0xa2, 0x01, 0x41, 0xee, 0x25, 0x3a, 0xbd, 0x18, 0xd7,
-  0x81, 0x37, 0x39, 0xff, 0xb4, 0x40, 0x81, 0xcd, 0xa1, 0xa7, 0x0b, 0xed,
-  0xe5, 0x46, 0x03, 0x4b, 0x00, 0x5a, 0x4b, 0x3e, 0x12, 0x19, 0x20, 0x8f,
-  0x3c, 0xec, 0x31, 0xf6, 0xfc, 0x77, 0x84, 0xfb, 0x12, 0xfe, 0x37, 0xd2,
-  0x1b, 0x6d, 0xec, 0xee, 0xd6, 0xe8, 0x64, 0x2a, 0xcd, 0xbd, 0x32, 0x25,
-  0x00, 0x27, 0xfa, 0x3b, 0xe0, 0xf8, 0x32, 0xd4, 0x49, 0xc4, 0x50, 0x51,
-  0x3b, 0x0d, 0x70, 0x2e, 0x41, 0x3f, 0xe4, 0x11, 0x81, 0xe6, 0x7f, 0x41,
-  0x0c, 0xcb, 0x0b, 0x50, 0x11, 0x02, 0xea, 0xfe, 0xbf, 0x43, 0xcd, 0x1b,
-  0x37, 0x81, 0xce, 0xbe, 0x2b, 0xac, 0xdd, 0x81, 0xbe, 0x11, 0x1a, 0xdf,
-  0xf3, 0x25, 0x0f, 0x10, 0xea, 0x04, 0x30, 0xaf, 0x05, 0xff, 0x35, 0x0a,
-  0xa4, 0x0b, 0x3e, 0xd4, 0xa9, 0x0e, 0x1b, 0x40, 0x9b, 0xed, 0x33, 0xff,
-  0xf8, 0x10, 0xf6, 0x20, 0xf0, 0xc3, 0x0e, 0xe7, 0xb5, 0x39, 0x38, 0x29,
-  0xc3, 0x40, 0xd8, 0xe0, 0xc9, 0x13, 0xd0, 0x10, 0xea, 0x62, 0xd0, 0x1b,
-  0xe9, 0x7f, 0x47, 0x46, 0xf7, 0x08, 0x20, 0x89, 0x57, 0x13, 0x4a, 0x06,
-  0x26, 0x61, 0xf8, 0x07, 0x07, 0x03, 0x61, 0xed, 0x24, 0x2d, 0xdd, 0x3c,
-  0xd7, 0xbd, 0x7f, 0x2a, 0xcb, 0x55, 0x0e, 0x2b, 0x1a, 0xe9, 0xc6, 0x09,
-  0xf5, 0x0a, 0x23, 0xe5, 0x2f, 0xde, 0x31, 0x56, 0x3c, 0x2f, 0x2f, 0x22,
-  0x32, 0x50, 0x10, 0xfa, 0xdd, 0xc5, 0x33, 0x22, 0x13, 0xe7, 0x14, 0x4b,
-  0xfa, 0xe5, 0xf0, 0x01, 0xc3, 0x19, 0xf0, 0x0e, 0x26, 0xb9, 0xe4, 0xed,
-  0x59, 0xc2, 0xfd, 0x95, 0xf7, 0x11, 0x0b, 0xf5, 0xf0, 0x1f, 0x18, 0x52,
-  0xd5, 0x05, 0x1f, 0xd2, 0x37, 0xd0, 0x27, 0x06, 0x81, 0x05, 0x06, 0xd7,
-  0xb8, 0x06, 0x16, 0x5a, 0xa9, 0xea, 0xff, 0xb7, 0x01, 0x25, 0xc4, 0x2e,
-  0x11, 0xd3, 0x37, 0xdb, 0xa9, 0x38, 0x1b, 0xec, 0xd8, 0x3f, 0x92, 0x17,
-  0xa5, 0x69, 0xc6, 0x1b, 0xfc, 0x4a, 0xb4, 0x1b, 0xf5, 0xde, 0x23, 0x4d,
-  0xaf, 0x22, 0x22, 0x1f, 0x67, 0x0d, 0x2f, 0xed, 0x0f, 0x59, 0xf9, 0xc2,
-  0x04, 0xe8, 0x37, 0xf6, 0x71, 0xe3, 0xe1, 0x0a, 0xf5, 0xcb, 0x5f, 0x05,
-  0xc1, 0x10, 0x36, 0x1e, 0x38, 0x1b, 0xd7, 0x0a, 0x0c, 0xf8, 0x00, 0x01,
-  0x2a, 0xe6, 0x50, 0x5d, 0x14, 0x30, 0xff, 0x49, 0x1d, 0x53, 0x4d, 0xd8,
-  0xaa, 0xdc, 0x44, 0x06, 0x33, 0x07, 0x1c, 0xf9, 0xcb, 0xd7, 0xe6, 0xd5,
-  0xcd, 0x38, 0xe0, 0x1b, 0x39, 0xef, 0xf6, 0xfe, 0x52, 0xce, 0x50, 0x8e,
-  0x0a, 0x12, 0xcd, 0xe5, 0x04, 0x65, 0x03, 0x39, 0xa6, 0xb6, 0x2f, 0xdb,
-  0xfd, 0xbb, 0xf2, 0x24, 0x1c, 0x13, 0x81, 0xbf, 0xf2, 0x05, 0x1e, 0x60,
-  0xc6, 0xe8, 0xf6, 0x81, 0x03, 0x2e, 0xcb, 0x3b, 0xf6, 0xcc, 0x5a, 0xc7,
-  0x1c, 0x34, 0x1c, 0x19, 0xcc, 0x6c, 0xa7, 0x02, 0x9a, 0xf3, 0x91, 0x00,
-  0x18, 0x77, 0x34, 0xe6, 0x35, 0x1c, 0x41, 0x38, 0x81, 0x3c, 0x2f, 0xd3,
-  0x38, 0xf1, 0x1b, 0xd9, 0x0a, 0x52, 0x33, 0xd0, 0x04, 0xe5, 0x47, 0xdd,
-  0x3b, 0xfe, 0xde, 0xe8, 0xe1, 0xf1, 0x58, 0xba, 0x81, 0x29, 0x0d, 0x15,
-  0x06, 0x10, 0xe3, 0x11, 0xc9, 0xfe, 0xfd, 0xb4, 0x6b, 0xd5, 0x60, 0x7f,
-  0x26, 0x2c, 0xce, 0x37, 0x31, 0x4a, 0x7f, 0xe7, 0xe7, 0x05, 0xcf, 0xef,
-  0x16, 0xfc, 0xf5, 0xf9, 0x53, 0x19, 0xea, 0xce, 0xbe, 0x69, 0xf0, 0x2b,
-  0x30, 0x01, 0xe5, 0xbe, 0x1b, 0xc1, 0x20, 0xda, 0xfa, 0x14, 0x98, 0xe0,
-  0xfb, 0x7f, 0x09, 0x00, 0xd0, 0xbe, 0x36, 0x1c, 0xe6, 0xc7, 0x18, 0x55,
-  0x12, 0x03, 0xd2, 0xdf, 0x23, 0x1a, 0x25, 0x68, 0xec, 0xd8, 0x33, 0x20,
-  0x02, 0x1e, 0xf6, 0x7c, 0x1c, 0xca, 0x29, 0xd9, 0xcf, 0x25, 0x07, 0x0d,
-  0xdb, 0x7f, 0x88, 0xe5, 0xa9, 0x87, 0x83, 0x39, 0x12, 0x60, 0x1c, 0xb0,
-  0xf9, 0x0b, 0x10, 0x2f, 0xe5, 0x3f, 0x29, 0xf2, 0x50, 0x37, 0x2c, 0xda,
-  0x7f, 0x60, 0x0f, 0x54, 0x04, 0xe0, 0x4d, 0xd4, 0xea, 0xb3, 0xe1, 0xb3,
-  0xde, 0xf5, 0x5e, 0xb6, 0xb3, 0xe9, 0x4a, 0x34, 0xd9, 0xef, 0xd7, 0x4b,
-  0xd2, 0x0a, 0xdf, 0xc5, 0x3d, 0xce, 0x51, 0x5d, 0x1a, 0x49, 0xd2, 0x40,
-  0x1b, 0x50, 0x5c, 0xf4, 0x05, 0xf1, 0x01, 0x21, 0x1d, 0x15, 0x09, 0xe2,
-  0x0e, 0x0f, 0xea, 0xed, 0xf2, 0x4d, 0xeb, 0x30, 0x28, 0x45, 0xdc, 0xd8,
-  0xee, 0xd0, 0xaa, 0xa3, 0x20, 0x19, 0xbc, 0xdf, 0x06, 0x5e, 0x0b, 0xf5,
-  0x81, 0xe7, 0x3e, 0x31, 0xd4, 0xd4, 0xc0, 0x2b, 0x1a, 0x0d, 0xeb, 0xeb,
-  0x2c, 0x24, 0x2e, 0x7f, 0xff, 0x03, 0x3b, 0x33, 0x07, 0x01, 0xd9, 0x58,
-  0x34, 0xd9, 0x2d, 0xf6, 0xf3, 0x18, 0xe8, 0x35, 0xc4, 0x74, 0xa1, 0xcc,
-  0xf6, 0x07, 0x92, 0xf9, 0xe0, 0x4c, 0xfc, 0x14, 0x59, 0xf7, 0x7f, 0x1b,
-  0xb6, 0x1c, 0x23, 0x0e, 0x2b, 0x22, 0x39, 0xe3, 0x7e, 0x01, 0x08, 0x33,
-  0xf6, 0x03, 0x5b, 0xfa, 0xf8, 0xbe, 0xdd, 0xf0, 0xfd, 0xf4, 0xe7, 0xdd,
-  0xa1, 0xc5, 0x36, 0x32, 0xd8, 0xda, 0x2f, 0x15, 0xee, 0xfd, 0x11, 0xc4,
-  0x3d, 0xe9, 0x47, 0x27, 0x15, 0x52, 0xcb, 0x20, 0x3f, 0x4f, 0x1f, 0xc8,
-  0xff, 0x15, 0x22, 0x1a, 0x33, 0xfb, 0x19, 0xf9, 0x26, 0xd7, 0xf7, 0xec,
-  0xe0, 0x1e, 0xed, 0x08, 0x42, 0xe6, 0xdb, 0x2b, 0xb9, 0xc0, 0x86, 0xd8,
-  0xef, 0x13, 0x81, 0xe1, 0xe4, 0x27, 0x0a, 0xc4, 0xae, 0xfc, 0x2e, 0x31,
-  0xc8, 0xe4, 0xd1, 0x6b, 0x4f, 0x34, 0x3a, 0xdf, 0x37, 0x13, 0x2d, 0x77,
-  0xef, 0xf4, 0x13, 0xd9, 0x11, 0xf5, 0xb9, 0x50, 0xf4, 0xd8, 0xf6, 0xe0,
-  0xdf, 0x22, 0x1b, 0x30, 0xc4, 0x01, 0xb1, 0xd6, 0x99, 0xb6, 0x0c, 0x02,
-  0xf4, 0x7f, 0xa8, 0xe9, 0xcb, 0x17, 0x31, 0x28, 0xed, 0x55, 0x3e, 0x2e,
-  0x5c, 0x03, 0x40, 0xec, 0x30, 0x0f, 0xea, 0x7f, 0xe0, 0x00, 0x7f, 0xf7,
-  0x1e, 0x09, 0xdf, 0x15, 0xdf, 0x26, 0x13, 0xbe, 0xd4, 0xa3, 0x17, 0x32,
-  0xe7, 0x81, 0x5c, 0x22, 0xfc, 0xf7, 0xe5, 0xc9, 0x22, 0xd7, 0x5c, 0x2b,
-  0x0e, 0x3e, 0xe3, 0xf6, 0x14, 0x60, 0x20, 0x1c, 0xd9, 0x06, 0x36, 0x1c,
-  0x3c, 0x09, 0x4b, 0x0d, 0xd2, 0xce, 0xf5, 0xe3, 0xd8, 0x47, 0xe8, 0x10,
-  0x2e, 0xee, 0xe6, 0x07, 0x49, 0xae, 0x88, 0xad, 0xe0, 0x09, 0xe8, 0xef,
-  0x00, 0x23, 0x15, 0xf1, 0x91, 0x0c, 0x21, 0x4f, 0x1f, 0xdd, 0xfb, 0x4e,
-  0x52, 0x38, 0xc3, 0xc8, 0xfb, 0x23, 0x35, 0x5c, 0xaf, 0xef, 0xd0, 0x1a,
-  0x0a, 0xfc, 0xc8, 0x26, 0xf7, 0xd0, 0x2c, 0xcc, 0x1d, 0x11, 0x15, 0x0f,
-  0xcc, 0xfd, 0xd3, 0xec, 0xaf, 0xff, 0xe0, 0xfb, 0x1b, 0x40, 0x22, 0x23,
-  0x81, 0x02, 0x11, 0x37, 0xb7, 0x01, 0x3b, 0x2f, 0x49, 0x3d, 0x35, 0xc6,
-  0x45, 0x03, 0xf5, 0x16, 0xed, 0xee, 0x4e, 0xf5, 0x2e, 0x0d, 0xdd, 0xe8,
-  0xd7, 0x08, 0x1f, 0xfa, 0xc7, 0x9c, 0x2b, 0x1b, 0xd0, 0xbb, 0x7f, 0xe6,
-  0x27, 0x02, 0xc7, 0xbb, 0x36, 0xcb, 0x46, 0x43, 0x0e, 0x44, 0xe6, 0x18,
-  0x14, 0x5d, 0x1d, 0xbe, 0x1d, 0x0c, 0x71, 0x11, 0x23, 0x32, 0x4b, 0x07,
-  0x07, 0xcf, 0xfc, 0xde, 0xc8, 0x67, 0xe0, 0x25, 0x15, 0xec, 0xf1, 0xfe,
-  0xdf, 0x97, 0x81, 0xb5, 0xfb, 0x07, 0x13, 0xe7, 0xed, 0x0d, 0x08, 0x18,
-  0xa6, 0x16, 0x1b, 0xd9, 0xfb, 0xba, 0xc7, 0x61, 0xec, 0x3f, 0xdc, 0xc6,
-  0xe7, 0x00, 0x2e, 0x59, 0xed, 0xe8, 0x4a, 0xe6, 0x00, 0x0d, 0x22, 0x4c,
-  0xe1, 0xe2, 0x24, 0xcb, 0xcc, 0x1b, 0x04, 0x12, 0xbc, 0xbd, 0xfb, 0x8e,
-  0xa3, 0x50, 0x81, 0x3b, 0xff, 0x6b, 0x81, 0x15, 0x16, 0x6c, 0x18, 0x20,
-  0xae, 0x16, 0x34, 0xb9, 0x57, 0x1c, 0x22, 0xc3, 0x57, 0xff, 0x4e, 0x65,
-  0xf1, 0xf3, 0x38, 0xd6, 0x4a, 0xf5, 0xcd, 0x02, 0xe5, 0x21, 0x07, 0xdf,
-  0xd7, 0x03, 0x4f, 0x47, 0xec, 0x9e, 0x74, 0x15, 0x24, 0xfa, 0xcd, 0xad,
-  0x54, 0xe5, 0x6d, 0x21, 0x1b, 0x7f, 0xd4, 0x14, 0x0a, 0x64, 0x0b, 0xc2,
-  0xe7, 0x2b, 0xf5, 0xc3, 0x0c, 0x17, 0x3c, 0x81, 0xba, 0xd0, 0xf4, 0xc6,
-  0xd6, 0x38, 0xeb, 0x1e, 0x04, 0xfd, 0x04, 0x26, 0xe0, 0xa0, 0xd6, 0xc1,
-  0x81, 0x10, 0x06, 0xdb, 0x05, 0xe8, 0x06, 0xf1, 0x8e, 0x50, 0x01, 0xb1,
-  0x38, 0xbb, 0xc3, 0x3e, 0x34, 0x24, 0x12, 0xd8, 0x04, 0x22, 0x49, 0x5e,
-  0xfb, 0xf3, 0xbe, 0x17, 0x13, 0x10, 0x1e, 0x2c, 0x06, 0xe9, 0x06, 0xcc,
-  0x1d, 0x21, 0x14, 0x43, 0xb7, 0x16, 0xda, 0x81, 0xb9, 0x7f, 0xd4, 0x2a,
-  0xf4, 0x4b, 0xd1, 0x22, 0x00, 0xf0, 0x47, 0x25, 0x91, 0x51, 0x0d, 0x06,
-  0x6a, 0x4e, 0x2e, 0xa3, 0x52, 0x9d, 0xd9, 0x1b, 0xd9, 0x1e, 0x44, 0xda,
-  0x36, 0x9b, 0xcf, 0x0f, 0xf2, 0x5b, 0xde, 0xa8, 0xd0, 0xed, 0xc4, 0x42,
-  0xe4, 0xe3, 0x40, 0x29, 0x12, 0x0d, 0xc9, 0xab, 0x7f, 0xec, 0x25, 0xf7,
-  0x0c, 0x5d, 0xbc, 0x1b, 0x10, 0x5c, 0x20, 0x81, 0x31, 0x0e, 0xde, 0x0a,
-  0x26, 0x4f, 0x30, 0xd7, 0xd5, 0xc6, 0xfb, 0xa1, 0xd2, 0x71, 0xed, 0x0a,
-  0x28, 0x31, 0xf9, 0x09, 0xf3, 0xb0, 0xbc, 0xae, 0x94, 0x17, 0xd8, 0xed,
-  0x25, 0xe7, 0xf4, 0xf5, 0xa5, 0x1a, 0xfe, 0x81, 0x08, 0xdf, 0xd2, 0x76,
-  0xbb, 0x34, 0xe2, 0xf0, 0xd0, 0x30, 0x35, 0x67, 0x0e, 0xed, 0x81, 0x44,
-  0x10, 0x1f, 0xeb, 0x36, 0xbb, 0xec, 0x6e, 0xcb, 0xfc, 0x19, 0xf3, 0x34,
-  0xa8, 0x16, 0x0f, 0x89, 0xb4, 0xff, 0xb5, 0x06, 0x23, 0x2c, 0xc6, 0x03,
-  0x08, 0x2a, 0x33, 0x0d, 0x19, 0x3a, 0x3c, 0x4d, 0x52, 0x3f, 0x14, 0xaf,
-  0x66, 0xed, 0x31, 0x39, 0xd2, 0x0b, 0x4c, 0xec, 0x51, 0xb0, 0xd2, 0x0f,
-  0xee, 0x54, 0x16, 0xc5, 0xca, 0x53, 0xbc, 0x42, 0x99, 0xc7, 0x37, 0x7f,
-  0x55, 0x03, 0xbb, 0xfd, 0xde, 0xdb, 0x37, 0xe2, 0x14, 0x2a, 0xd5, 0x7f,
-  0x2f, 0x58, 0x27, 0x8d, 0xa1, 0x18, 0x2b, 0x29, 0x2b, 0xee, 0x2e, 0x1a,
-  0x90, 0xc8, 0xf4, 0x81, 0xb8, 0x45, 0xf6, 0x13, 0x17, 0x24, 0x25, 0x5b,
-  0x6e, 0x88, 0xa5, 0xe9, 0xd3, 0x18, 0x15, 0xee, 0xea, 0xea, 0x0e, 0xd4,
-  0xb7, 0x43, 0xed, 0xdc, 0x48, 0xd8, 0xb7, 0x75, 0xea, 0x16, 0xc6, 0xdf,
-  0xdd, 0x38, 0x38, 0x42, 0xf6, 0xd1, 0xfd, 0x1b, 0x20, 0x0c, 0xf0, 0x2a,
-  0x81, 0xe9, 0x3b, 0xd6, 0xec, 0x27, 0xcf, 0x41, 0x97, 0x11, 0x21, 0xab,
-  0x03, 0x58, 0x6e, 0xf3, 0xfa, 0x60, 0xda, 0xf4, 0x08, 0xfd, 0x17, 0x13,
-  0x73, 0x19, 0x4c, 0x7f, 0x23, 0x53, 0x2e, 0x81, 0x3f, 0x02, 0xb1, 0x4e,
-  0xcc, 0xf8, 0x35, 0xe3, 0x7f, 0xa5, 0xc8, 0xfc, 0xf7, 0x4e, 0x00, 0xe6,
-  0xd2, 0x63, 0x7f, 0x45, 0x8e, 0xd3, 0xd8, 0x1f, 0x1d, 0xd4, 0xc0, 0xf9,
-  0xe3, 0xbe, 0x28, 0xee, 0x07, 0x32, 0xce, 0x62, 0x34, 0x3c, 0x09, 0xe6,
-  0xfe, 0x06, 0x25, 0xe2, 0x4a, 0x60, 0x43, 0xe5, 0xba, 0xb4, 0x03, 0x87,
-  0x9d, 0x72, 0x03, 0x11, 0x34, 0x65, 0x21, 0x4d, 0x05, 0xa3, 0xdb, 0xe7,
-  0x29, 0x4c, 0x61, 0xf2, 0xe2, 0xe4, 0xf6, 0xbb, 0xc5, 0x32, 0xf7, 0xd8,
-  0x29, 0xc4, 0xe1, 0x54, 0xd6, 0x30, 0x69, 0x0a, 0xe9, 0x59, 0x54, 0x38,
-  0xea, 0xbf, 0x30, 0xdd, 0x36, 0x0e, 0xdb, 0x1f, 0xac, 0xed, 0x4e, 0xbe,
-  0xc9, 0x22, 0xea, 0x2b, 0x9f, 0xeb, 0x3f, 0xa8, 0xbf, 0x91, 0x61, 0x0c,
-  0x39, 0x68, 0xa8, 0x05, 0x0c, 0xf4, 0x05, 0x15, 0x77, 0x3c, 0x59, 0x3a,
-  0x43, 0x6c, 0x29, 0x9e, 0x13, 0x36, 0x81, 0x46, 0x81, 0xfa, 0x51, 0xba,
-  0x4b, 0x81, 0x81, 0x7f, 0xe8, 0x7f, 0xde, 0xb0, 0xc1, 0x44, 0x32, 0x7f,
-  0x81, 0xda, 0x09, 0x07, 0x7f, 0x81, 0x81, 0x6b, 0xcb, 0xbc, 0x40, 0xf7,
-  0x10, 0x7e, 0x81, 0x20, 0x50, 0x7f, 0x34, 0x50, 0x19, 0x46, 0x19, 0xbe,
-  0x7f, 0x30, 0x7f, 0xb0, 0x81, 0x81, 0xf1, 0x82, 0x81, 0x7f, 0xd9, 0x26,
-  0x30, 0x46, 0x2a, 0x29, 0x79, 0x81, 0xf4, 0x99, 0xab, 0x7f, 0xd3, 0xf0,
-  0x0f, 0xc2, 0xfa, 0xf3, 0x9f, 0x7f, 0x34, 0xc9, 0xfc, 0x81, 0x81, 0xfe,
-  0xbd, 0x7f, 0x24, 0xdf, 0x81, 0x7f, 0x7f, 0x27, 0x9c, 0x81, 0x09, 0xe6,
-  0x7f, 0x09, 0x81, 0x7f, 0xd1, 0xe2, 0x64, 0x81, 0xbe, 0x39, 0xb1, 0x7f,
-  0x81, 0xf8, 0x4c, 0xa7, 0xb4, 0x04, 0x39, 0x39, 0x7f, 0x4f, 0xc9, 0x7f,
-  0xe7, 0xf8, 0x21, 0x34, 0x43, 0x7f, 0x7f, 0x41, 0x7f, 0x7f, 0x53, 0x9c,
-  0xce, 0x2b, 0x28, 0x05, 0x2e, 0xee, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x00, 0x00, 0x64, 0x11, 0x32, 0xed, 0xfb, 0x20, 0x4d, 0x2a,
-  0xe3, 0xe9, 0x48, 0xa0, 0xae, 0x30, 0xd0, 0x9f, 0x26, 0x1d, 0x7a, 0x4c,
-  0xe0, 0x0f, 0xf4, 0xc3, 0x06, 0xc0, 0x47, 0xd1, 0x88, 0xf0, 0x13, 0xed,
-  0x33, 0x88, 0x41, 0x52, 0xe4, 0x96, 0x44, 0xa9, 0x60, 0x6d, 0x08, 0x17,
-  0xdb, 0x0f, 0x01, 0xf8, 0x10, 0x07, 0x25, 0xcf, 0x3f, 0x24, 0xe2, 0x13,
-  0x11, 0xc8, 0xf5, 0xd2, 0xd3, 0xc6, 0xbd, 0x3c, 0xee, 0x81, 0xeb, 0xf2,
-  0x08, 0xe5, 0xcf, 0x0f, 0x32, 0x43, 0x07, 0x33, 0x1a, 0x24, 0xd8, 0xa6,
-  0xd4, 0x0d, 0xa4, 0xcf, 0x56, 0x25, 0x16, 0xc8, 0xd5, 0xf9, 0xed, 0x55,
-  0x29, 0x17, 0x13, 0x1f, 0x42, 0xe4, 0x24, 0x6c, 0xc1, 0x15, 0xd2, 0x33,
-  0xca, 0xde, 0xab, 0xec, 0x35, 0xb6, 0xe1, 0xd7, 0x12, 0xd1, 0xf8, 0x45,
-  0x10, 0xa7, 0x04, 0xc6, 0x4e, 0x3a, 0xca, 0x32, 0x54, 0x00, 0xd4, 0xe6,
-  0xea, 0xdd, 0x33, 0xad, 0x2a, 0xf2, 0x35, 0xe5, 0xdf, 0xf2, 0x39, 0xd8,
-  0xc9, 0xf9, 0x31, 0xe9, 0xda, 0xe5, 0x1a, 0xe1, 0xe9, 0x47, 0x28, 0xe1,
-  0x2b, 0xc8, 0xe7, 0xcc, 0xc0, 0xf8, 0x2a, 0x04, 0xf6, 0xff, 0xf9, 0xf3,
-  0xb4, 0x02, 0x1f, 0xef, 0x48, 0xf0, 0xf1, 0x1e, 0x0b, 0xc7, 0x36, 0xbc,
-  0x20, 0xff, 0x60, 0xcc, 0x33, 0x27, 0x07, 0x37, 0x4f, 0xf3, 0x01, 0xdf,
-  0x01, 0xc4, 0x1c, 0x4f, 0x3a, 0xfa, 0xff, 0xda, 0xef, 0xfc, 0xee, 0xb5,
-  0xc9, 0xd9, 0xdd, 0xf6, 0xdd, 0xf7, 0xf9, 0xc9, 0x04, 0xb1, 0x81, 0xc1,
-  0x3c, 0xf8, 0x0b, 0x1d, 0xd7, 0x97, 0xa7, 0xf5, 0xe9, 0xeb, 0x0c, 0xcc,
-  0x24, 0xa4, 0x38, 0x2e, 0xd9, 0xef, 0xfe, 0xdc, 0x0d, 0xdb, 0xcf, 0x19,
-  0xee, 0x28, 0xfc, 0x48, 0x0f, 0xdd, 0x15, 0x00, 0xdf, 0xe7, 0x2c, 0xc4,
-  0x91, 0x19, 0xbc, 0xc2, 0xed, 0x2f, 0x07, 0xc5, 0x09, 0xc8, 0xea, 0xd0,
-  0xc0, 0xf4, 0x6d, 0x2d, 0xfc, 0x28, 0x52, 0xdc, 0xcd, 0xe2, 0x1d, 0xbd,
-  0xcb, 0xbe, 0x14, 0xdd, 0x22, 0x20, 0xca, 0x29, 0xe3, 0x19, 0x02, 0xe3,
-  0x85, 0xca, 0xd3, 0x02, 0xf4, 0xe3, 0x16, 0x2f, 0x00, 0x22, 0x19, 0xf2,
-  0x35, 0xfd, 0xe3, 0xef, 0x01, 0xcc, 0x5b, 0xfb, 0x11, 0x36, 0xf5, 0xf3,
-  0xfc, 0x1a, 0x03, 0xd6, 0xdd, 0xde, 0x27, 0x0c, 0xa6, 0xe2, 0xe0, 0xea,
-  0x04, 0x22, 0xb9, 0xe6, 0xf7, 0xdb, 0xa2, 0x17, 0xf3, 0xbb, 0x22, 0xe0,
-  0x40, 0xf5, 0xf9, 0xca, 0x1b, 0x95, 0xe8, 0x8c, 0x11, 0xe8, 0x21, 0xde,
-  0x81, 0xc5, 0x06, 0x04, 0x11, 0xc7, 0x3e, 0xe1, 0xd3, 0xaf, 0x10, 0x29,
-  0xe3, 0xe9, 0xd2, 0x10, 0xc4, 0x24, 0x0f, 0xd0, 0xb2, 0x1b, 0xd3, 0x4b,
-  0x14, 0x1b, 0x3c, 0x25, 0xe9, 0xf2, 0x25, 0x1c, 0xbb, 0x3c, 0xe2, 0x01,
-  0xda, 0xf0, 0x1b, 0xe8, 0x5d, 0x87, 0x35, 0x9f, 0xb4, 0xf0, 0x16, 0x35,
-  0xd3, 0x27, 0xeb, 0xd7, 0x93, 0x50, 0x02, 0x91, 0xf2, 0xf8, 0xe6, 0xe1,
-  0xeb, 0x2f, 0x30, 0xf1, 0x18, 0x58, 0x13, 0xa3, 0xc2, 0xf4, 0x39, 0x49,
-  0x6a, 0x81, 0xd4, 0x3c, 0x36, 0xce, 0x06, 0xbc, 0xfe, 0x3a, 0x34, 0x35,
-  0x23, 0x4b, 0x23, 0xef, 0x1a, 0xda, 0x5a, 0xe4, 0x30, 0x31, 0xd7, 0x1d,
-  0x47, 0xe4, 0x53, 0x3e, 0xa9, 0xa9, 0xb7, 0x37, 0xe8, 0x88, 0xbd, 0x57,
-  0x46, 0xc4, 0xae, 0x21, 0x37, 0xff, 0x71, 0x39, 0xdd, 0x4c, 0x11, 0xac,
-  0xe2, 0xf4, 0xcf, 0xea, 0xbd, 0xc0, 0x3a, 0xee, 0xaf, 0xe8, 0xe2, 0x5f,
-  0xe1, 0xd2, 0xda, 0x3a, 0xca, 0xfc, 0xf6, 0x5f, 0xf3, 0x0a, 0xb6, 0x2f,
-  0x42, 0xbe, 0xcf, 0xd9, 0x45, 0xea, 0x00, 0x26, 0xf5, 0xf7, 0x29, 0x60,
-  0x0a, 0x9e, 0xc3, 0xee, 0x1e, 0xcd, 0x1c, 0xff, 0x55, 0x23, 0x21, 0x26,
-  0x0e, 0x0d, 0x53, 0x1a, 0xda, 0xf6, 0x42, 0xe3, 0xef, 0x0f, 0x44, 0x1d,
-  0xbd, 0x30, 0xfa, 0x09, 0x2d, 0xf6, 0x1a, 0xdf, 0x3d, 0xfe, 0xf9, 0x37,
-  0xf5, 0xdc, 0xc6, 0xa6, 0xec, 0xe1, 0xdf, 0x1d, 0xf0, 0x22, 0x1b, 0xf5,
-  0xd5, 0xec, 0xd9, 0x58, 0xf2, 0x1d, 0xcf, 0x1e, 0x01, 0xf9, 0x6c, 0x19,
-  0x4f, 0x28, 0x36, 0xc9, 0x37, 0xda, 0xd7, 0x36, 0x19, 0x09, 0xf3, 0xf4,
-  0x07, 0xe7, 0x01, 0x41, 0x2a, 0x20, 0x22, 0x30, 0xde, 0x1c, 0x9e, 0xb8,
-  0xeb, 0xfe, 0x03, 0xb9, 0xee, 0xec, 0xf5, 0xe2, 0xd4, 0xba, 0xa4, 0xce,
-  0x17, 0xa5, 0x03, 0x15, 0xb5, 0x0f, 0x14, 0x35, 0xe9, 0x0c, 0xbd, 0xa7,
-  0x0b, 0x81, 0x24, 0x1f, 0xe0, 0x14, 0xc4, 0xbe, 0xb0, 0x1f, 0xd5, 0x0d,
-  0x29, 0x1c, 0x2a, 0xe7, 0xea, 0x19, 0x44, 0xff, 0xcd, 0xf1, 0x0c, 0x39,
-  0xc1, 0x09, 0xe0, 0xef, 0xde, 0xe8, 0x08, 0xe7, 0xe3, 0x18, 0x1c, 0xd9,
-  0x03, 0xca, 0x4f, 0xdf, 0x90, 0x16, 0xd5, 0xe8, 0xb9, 0x38, 0x25, 0xf6,
-  0x08, 0x10, 0x4e, 0x43, 0x01, 0xf4, 0x81, 0x1f, 0x00, 0x16, 0xdb, 0xd6,
-  0x0e, 0xa3, 0x06, 0x4f, 0x21, 0xe2, 0xde, 0xf1, 0x2f, 0x2c, 0x62, 0xee,
-  0x17, 0xe4, 0xd2, 0x2c, 0x3f, 0x17, 0x0f, 0x0f, 0x45, 0x4d, 0x67, 0x9b,
-  0x35, 0x18, 0xcb, 0x24, 0xf4, 0x81, 0xeb, 0x30, 0xd5, 0xd0, 0xeb, 0x51,
-  0x3e, 0xc5, 0x16, 0xda, 0x4a, 0x5d, 0xd1, 0xae, 0x2b, 0x58, 0x30, 0xf9,
-  0xb8, 0xd9, 0x04, 0x1c, 0x11, 0x08, 0xea, 0xb0, 0xca, 0xa5, 0x3e, 0xda,
-  0xe7, 0x13, 0xf2, 0x11, 0x4a, 0xd4, 0xd8, 0xf6, 0xd1, 0xec, 0xcf, 0x36,
-  0xf6, 0x21, 0xf6, 0xcf, 0xaf, 0x3a, 0x24, 0xe5, 0xf8, 0xb6, 0x03, 0x08,
-  0x0a, 0x22, 0x1b, 0xb3, 0xc7, 0xcc, 0x4a, 0xdd, 0xc8, 0x1b, 0xa8, 0x25,
-  0x2b, 0xc7, 0xbc, 0xe6, 0x0a, 0x2d, 0x13, 0xaa, 0xe0, 0x34, 0x20, 0x3b,
-  0xff, 0xff, 0xcf, 0xb4, 0x37, 0x3c, 0xdf, 0x89, 0x04, 0xff, 0xec, 0xe0,
-  0xc1, 0xe7, 0xb1, 0x08, 0x0e, 0x48, 0x3d, 0x28, 0xe0, 0xdf, 0xc2, 0xd5,
-  0x13, 0xc8, 0x32, 0x32, 0x3b, 0xe2, 0x93, 0xc3, 0x1b, 0x18, 0xf1, 0x2a,
-  0xee, 0xa5, 0xf2, 0xbb, 0xb3, 0x0a, 0x52, 0xb0, 0xfe, 0xfe, 0x4b, 0xcb,
-  0x01, 0xd0, 0xc7, 0x55, 0x1c, 0xf3, 0x07, 0x1d, 0x06, 0x06, 0xd2, 0x03,
-  0x18, 0xd5, 0xde, 0xdf, 0x1e, 0x70, 0xbd, 0xea, 0xc9, 0x81, 0xc3, 0xf0,
-  0x01, 0x1a, 0x0b, 0xfa, 0xe0, 0x16, 0x2c, 0xea, 0x06, 0x40, 0xb3, 0x29,
-  0x13, 0xfd, 0x42, 0xe6, 0xe9, 0x0a, 0xfd, 0x09, 0x4d, 0x2e, 0x30, 0x94,
-  0xff, 0xe2, 0xc9, 0xe2, 0xc6, 0xae, 0x2c, 0xe8, 0x06, 0xed, 0x09, 0x12,
-  0xb9, 0xb4, 0x0d, 0x10, 0x07, 0x1b, 0x19, 0x1a, 0x5b, 0xe7, 0xb8, 0x1c,
-  0xd0, 0x1e, 0x32, 0x0f, 0xdc, 0x3d, 0x19, 0x41, 0xcb, 0xc1, 0x51, 0xd3,
-  0xa3, 0xf6, 0x52, 0xe2, 0x0f, 0xca, 0x51, 0x34, 0x99, 0x06, 0x46, 0x98,
-  0x64, 0x23, 0x46, 0xb7, 0x3a, 0x09, 0x31, 0x45, 0x6d, 0x81, 0x07, 0x6c,
-  0xe4, 0xe3, 0x26, 0xfd, 0xe9, 0x2c, 0xb3, 0xee, 0xbb, 0xce, 0x6a, 0xce,
-  0xe7, 0x16, 0x65, 0xe9, 0x58, 0x3b, 0x9a, 0x4c, 0xc8, 0x8f, 0x14, 0xcb,
-  0xa5, 0x85, 0x97, 0x32, 0x2b, 0xc5, 0xfc, 0x39, 0x21, 0xc0, 0x0a, 0xf5,
-  0x0b, 0x1c, 0x43, 0xd3, 0x9e, 0x2c, 0x53, 0x16, 0x11, 0xb7, 0xad, 0xbb,
-  0x66, 0x84, 0x45, 0xf1, 0x96, 0xa3, 0xe6, 0x06, 0xed, 0xce, 0xe6, 0x3c,
-  0xec, 0xd5, 0xc9, 0x4e, 0xb6, 0xca, 0xb7, 0xb7, 0x1b, 0xd6, 0x39, 0xe5,
-  0x0d, 0x19, 0xac, 0xd8, 0xa5, 0xdd, 0x2d, 0xf8, 0xea, 0x10, 0x29, 0x47,
-  0x08, 0x23, 0xab, 0xc1, 0x35, 0x19, 0xd5, 0x21, 0xfe, 0xde, 0x0d, 0x12,
-  0xdf, 0x33, 0x0f, 0x39, 0x0c, 0xe5, 0x17, 0xe9, 0x09, 0x03, 0x42, 0xb4,
-  0x4b, 0x3a, 0x1b, 0x2c, 0xb3, 0x21, 0xd2, 0xe5, 0x3c, 0x7f, 0xea, 0x2e,
-  0x0c, 0xd0, 0xee, 0xbd, 0xdf, 0xfd, 0xe6, 0xfe, 0x08, 0xc3, 0xe8, 0x87,
-  0xf4, 0x28, 0x36, 0xcf, 0x91, 0xb6, 0xce, 0x0b, 0xec, 0x04, 0x23, 0x9a,
-  0x10, 0xe6, 0x11, 0xe6, 0x41, 0xfc, 0xfb, 0x47, 0x06, 0x15, 0xec, 0xf9,
-  0xd7, 0xe8, 0x29, 0x2a, 0x21, 0xf1, 0xe1, 0x17, 0x5d, 0x35, 0xf4, 0x24,
-  0xd8, 0x05, 0xfc, 0xbd, 0x07, 0x0a, 0x5b, 0x15, 0xba, 0x0d, 0x0c, 0x3b,
-  0x07, 0x34, 0xf1, 0x2e, 0x1c, 0xf9, 0x39, 0xbf, 0xb9, 0x3b, 0xda, 0x15,
-  0x2e, 0x2c, 0x0f, 0xf5, 0x00, 0xf2, 0x0e, 0x18, 0x16, 0x81, 0x0f, 0xf3,
-  0xf8, 0xfc, 0xe9, 0x52, 0xf4, 0x97, 0xf7, 0x2a, 0x04, 0xdb, 0x4a, 0xe1,
-  0x06, 0x5c, 0xc8, 0x25, 0x3b, 0x33, 0xa8, 0x1f, 0xfa, 0x28, 0xe6, 0x0d,
-  0x3b, 0xf9, 0x14, 0xfa, 0x41, 0x34, 0x0f, 0x0c, 0x63, 0xfa, 0x40, 0xdd,
-  0x31, 0xc8, 0x31, 0x34, 0xcc, 0x9c, 0x2a, 0xf5, 0x10, 0x28, 0x3a, 0xb2,
-  0xc9, 0x4b, 0x22, 0x3e, 0xd5, 0x49, 0x08, 0x09, 0xba, 0xe8, 0x1e, 0x2f,
-  0x18, 0x10, 0xea, 0x0e, 0x9f, 0x9e, 0xdb, 0x30, 0x9f, 0xf5, 0x37, 0xea,
-  0xc5, 0x4f, 0x1b, 0xa1, 0xd3, 0x57, 0x2c, 0x91, 0x12, 0x4b, 0xfe, 0xae,
-  0x95, 0xfd, 0x19, 0x13, 0x41, 0xc0, 0xf0, 0x3b, 0x10, 0x4d, 0xc7, 0xfd,
-  0xea, 0x55, 0x21, 0x30, 0xb7, 0x39, 0xb7, 0x17, 0x1a, 0x4a, 0xfa, 0xe1,
-  0xe4, 0x42, 0x51, 0xe0, 0xf3, 0x28, 0xcf, 0x09, 0x44, 0xf9, 0x15, 0x4d,
-  0x7f, 0xcf, 0x26, 0xff, 0xf6, 0x10, 0x09, 0x30, 0x0c, 0xaf, 0xf0, 0x24,
-  0x02, 0xe4, 0xcf, 0xf6, 0x38, 0xc7, 0x4a, 0xf0, 0x04, 0xc7, 0xdc, 0x28,
-  0xc9, 0xc5, 0x33, 0xea, 0xc2, 0x17, 0xfb, 0x1c, 0x9c, 0xdf, 0xc5, 0x5b,
-  0x1d, 0x16, 0xfe, 0xb7, 0x4b, 0x18, 0xb4, 0xfa, 0xdd, 0x1e, 0x64, 0x2f,
-  0xdc, 0x2d, 0x52, 0xbf, 0x1d, 0x3b, 0xf1, 0x38, 0x5c, 0xb2, 0x46, 0xc0,
-  0xfa, 0x6f, 0xa7, 0x37, 0xdd, 0xfd, 0x05, 0xe5, 0xc9, 0xcf, 0x54, 0xc5,
-  0xe8, 0xd1, 0x57, 0xc3, 0x22, 0xee, 0xda, 0xdd, 0x1e, 0x2f, 0x63, 0x0f,
-  0xf1, 0xdb, 0xf9, 0x1a, 0x31, 0x2c, 0xba, 0x3d, 0x24, 0xe3, 0xb3, 0xdb,
-  0xa1, 0x02, 0x6c, 0x29, 0x10, 0xb0, 0xe0, 0x1c, 0xf7, 0xa0, 0xc6, 0xc6,
-  0xae, 0xe7, 0xea, 0x24, 0xbe, 0x08, 0xaf, 0x62, 0x20, 0xae, 0x28, 0xc2,
-  0x48, 0xd8, 0xba, 0x0f, 0x49, 0x1a, 0x2f, 0xbf, 0xbe, 0xff, 0xfd, 0xe1,
-  0x9f, 0xde, 0x1e, 0xdf, 0x37, 0xf0, 0x26, 0x79, 0x33, 0x81, 0xff, 0x3c,
-  0xae, 0x14, 0x1c, 0x10, 0xf3, 0x35, 0xd3, 0x0b, 0xbc, 0x43, 0x22, 0x17,
-  0xf1, 0xe5, 0x13, 0xc6, 0xee, 0xc0, 0x2b, 0xbc, 0x11, 0x1c, 0xe9, 0xf8,
-  0xf6, 0xb9, 0x27, 0xc9, 0x02, 0x2b, 0xc6, 0x3b, 0xce, 0xab, 0xf8, 0x00,
-  0x81, 0xff, 0xdb, 0x1b, 0x18, 0x15, 0x31, 0x06, 0x1c, 0xbe, 0x01, 0x6c,
-  0x4d, 0x90, 0xec, 0xec, 0xf6, 0xb4, 0x03, 0xdc, 0x2c, 0x2e, 0xd9, 0xbc,
-  0xf3, 0x08, 0x7b, 0xfe, 0x1b, 0xc4, 0xf9, 0x17, 0xd2, 0xca, 0xb1, 0x67,
-  0xcd, 0x38, 0x1a, 0xb0, 0xee, 0x3b, 0xd3, 0x0f, 0xfe, 0xfe, 0xc4, 0xae,
-  0xed, 0x99, 0x08, 0xcb, 0xae, 0xc3, 0xc7, 0xa4, 0x5a, 0xf8, 0x4e, 0x17,
-  0x01, 0x24, 0xc9, 0x2a, 0x3e, 0xfa, 0xba, 0xec, 0x11, 0xda, 0x59, 0x08,
-  0xa5, 0x91, 0x1c, 0xd3, 0xc9, 0xff, 0xd7, 0xee, 0xd9, 0xd9, 0x26, 0x34,
-  0xcd, 0xd4, 0x13, 0xd9, 0xe9, 0xfe, 0x00, 0xe1, 0xd2, 0x73, 0xe4, 0xb5,
-  0x1e, 0x30, 0x10, 0x49, 0xbe, 0x26, 0x05, 0xc9, 0xd1, 0x13, 0x31, 0xfb,
-  0x0a, 0xef, 0x0b, 0x04, 0xfd, 0x19, 0x22, 0x0a, 0xf7, 0x08, 0xfc, 0x0c,
-  0xf0, 0x61, 0xdb, 0xf5, 0xf0, 0xf2, 0xf6, 0x12, 0xa2, 0x1d, 0xb1, 0xd7,
-  0x35, 0x08, 0x4b, 0x07, 0xd5, 0x0c, 0x24, 0xe8, 0x19, 0x2e, 0xa6, 0xe4,
-  0xe7, 0xc9, 0x58, 0xb3, 0x31, 0x02, 0x4a, 0x1d, 0x2e, 0xef, 0xf4, 0xfb,
-  0xff, 0xe0, 0x2a, 0xf1, 0xe8, 0x18, 0x14, 0x1e, 0xdc, 0x1e, 0xd7, 0xc0,
-  0xf2, 0x16, 0xec, 0xf5, 0xde, 0xfa, 0x02, 0xd4, 0x09, 0xb5, 0x1c, 0xb4,
-  0xe1, 0x92, 0xa9, 0x96, 0xda, 0xd4, 0xe0, 0x01, 0xad, 0xd1, 0xe7, 0x1f,
-  0xcb, 0xf0, 0x1d, 0xac, 0xc4, 0x81, 0x03, 0xd0, 0xba, 0xd6, 0xd3, 0x30,
-  0xf1, 0xca, 0x03, 0xf6, 0xdf, 0xee, 0xcc, 0x05, 0xd2, 0xfb, 0xb3, 0x0c,
-  0xdb, 0x02, 0xe5, 0x33, 0xf6, 0x01, 0xe8, 0xcf, 0xe4, 0xf4, 0xd4, 0x31,
-  0xd9, 0x05, 0x11, 0xc7, 0xc2, 0xf3, 0x54, 0x2f, 0xf9, 0xfd, 0x3e, 0x9c,
-  0xd7, 0x28, 0x00, 0xf9, 0x0b, 0xbc, 0x4f, 0xf7, 0xb4, 0x3c, 0xc8, 0xcd,
-  0x1b, 0x43, 0x04, 0x28, 0x92, 0x1a, 0xed, 0xbf, 0x58, 0xbd, 0x3a, 0x3b,
-  0x4c, 0x04, 0x0d, 0x01, 0xf2, 0xdf, 0xd8, 0x0d, 0xe2, 0x09, 0x3c, 0xc5,
-  0x4b, 0x53, 0x49, 0xe7, 0x1d, 0xf9, 0x1d, 0xeb, 0xfc, 0xb3, 0xf8, 0xdb,
-  0xca, 0xde, 0x28, 0x31, 0xd0, 0x24, 0xe7, 0x1a, 0xf1, 0xe9, 0xa5, 0xf0,
-  0xe9, 0x26, 0xc7, 0x12, 0x38, 0xa7, 0x2a, 0x04, 0xf8, 0xd0, 0xe3, 0x81,
-  0xe2, 0x06, 0xfb, 0x3b, 0xdf, 0xc1, 0xdb, 0x43, 0x47, 0xe3, 0x10, 0xd7,
-  0xc5, 0xf8, 0xbe, 0x21, 0xd2, 0xcb, 0xf2, 0xc5, 0xce, 0x06, 0xf9, 0xb5,
-  0xd4, 0xf5, 0x3a, 0xf3, 0x12, 0xd2, 0xf9, 0x05, 0xf8, 0xc7, 0x06, 0xfc,
-  0xf8, 0x1a, 0x05, 0xcb, 0x2b, 0xc6, 0x34, 0xe0, 0x07, 0x44, 0x25, 0x14,
-  0x09, 0xec, 0x04, 0xd6, 0xc9, 0xb2, 0xe4, 0x39, 0x3d, 0x2d, 0xcc, 0xff,
-  0xe1, 0xc5, 0xfe, 0x0c, 0x1f, 0xfd, 0xeb, 0x5b, 0xd2, 0xf9, 0xbb, 0x01,
-  0xb7, 0xaf, 0xd4, 0xbf, 0xbc, 0x3f, 0x09, 0x00, 0x17, 0x03, 0xe6, 0x17,
-  0x37, 0xf2, 0x0e, 0xd7, 0xb6, 0xe8, 0xf2, 0x12, 0xd3, 0x32, 0x13, 0xf4,
-  0xd5, 0xd1, 0x46, 0x24, 0x3e, 0x07, 0xf1, 0x3f, 0xfb, 0x39, 0x04, 0x69,
-  0x52, 0x19, 0x3b, 0xb0, 0xef, 0x05, 0xd4, 0x0c, 0xca, 0x34, 0xab, 0xaa,
-  0x1f, 0x8f, 0x36, 0xea, 0xd8, 0xe5, 0xcc, 0xe7, 0xe4, 0x3c, 0x3a, 0x20,
-  0xb8, 0x18, 0xc2, 0x27, 0x2b, 0x15, 0x17, 0xe6, 0xdb, 0xac, 0x08, 0xe2,
-  0xf4, 0x1b, 0x27, 0xfe, 0xe5, 0xd0, 0xc6, 0xc0, 0xd6, 0xe3, 0xdd, 0xe1,
-  0x23, 0xc1, 0x18, 0x2c, 0xcd, 0x0b, 0x44, 0xe8, 0x81, 0x0c, 0x33, 0xc1,
-  0x13, 0x13, 0xd1, 0xf7, 0x3b, 0xd3, 0xf8, 0x94, 0x08, 0xec, 0xfa, 0x00,
-  0xfb, 0xf9, 0xde, 0xb8, 0xf2, 0xff, 0xff, 0x8a, 0x3a, 0x02, 0xeb, 0xb7,
-  0x04, 0xd8, 0xc9, 0x24, 0x2f, 0x11, 0x22, 0xf4, 0xb0, 0xe0, 0x09, 0xd9,
-  0xfe, 0x13, 0x44, 0xe6, 0x38, 0x00, 0x8d, 0xa5, 0x29, 0x37, 0x0f, 0xf3,
-  0xfc, 0xac, 0x03, 0xf5, 0xca, 0xeb, 0x0d, 0xcc, 0xeb, 0xd4, 0x41, 0x0b,
-  0x35, 0xe5, 0x9f, 0x2a, 0x0f, 0x10, 0xf0, 0x0c, 0xe0, 0x3a, 0x56, 0xf1,
-  0x2d, 0xde, 0x17, 0x01, 0x21, 0x33, 0xcb, 0x14, 0xda, 0xdd, 0xa7, 0xa7,
-  0x0d, 0x25, 0x27, 0x90, 0xbd, 0xf1, 0x07, 0x32, 0x25, 0x66, 0x2c, 0x2c,
-  0xd8, 0xe8, 0x45, 0x81, 0xfd, 0xfa, 0xd6, 0x13, 0x51, 0x11, 0x37, 0xf2,
-  0x51, 0xe7, 0x1f, 0xcf, 0xcb, 0xfc, 0xf5, 0xc7, 0xf1, 0xb3, 0xf9, 0x12,
-  0xf0, 0xd6, 0x18, 0xec, 0x2b, 0x71, 0x67, 0xf0, 0x35, 0x20, 0x0d, 0xde,
-  0x0f, 0x2d, 0x00, 0xfe, 0x05, 0xa4, 0x33, 0xce, 0x16, 0xd5, 0x06, 0x43,
-  0x33, 0xf6, 0x2b, 0xf8, 0xfa, 0xf6, 0x1a, 0xe8, 0x2d, 0x2a, 0xb6, 0x1f,
-  0xd4, 0x1a, 0xdb, 0x02, 0x16, 0x12, 0x89, 0xbc, 0x1b, 0xf8, 0xec, 0xf3,
-  0x38, 0xf8, 0xe3, 0x27, 0x13, 0xce, 0xf6, 0xe1, 0xe3, 0xd0, 0x58, 0xac,
-  0xf3, 0x1c, 0x27, 0xf1, 0xe5, 0x26, 0x54, 0x24, 0xcb, 0xdd, 0x39, 0x32,
-  0xf2, 0xf2, 0xee, 0x2b, 0x02, 0x1f, 0xec, 0x33, 0x3d, 0x5b, 0xc4, 0xd3,
-  0x12, 0x02, 0xbd, 0x9e, 0x19, 0xd5, 0x2a, 0x43, 0xc5, 0xbf, 0xfe, 0xe2,
-  0xc3, 0xdc, 0x08, 0xc6, 0xd5, 0x28, 0xb4, 0x4b, 0x5a, 0xc7, 0xd8, 0xa8,
-  0xee, 0xe0, 0xe5, 0x9a, 0xea, 0x17, 0x3b, 0xc7, 0xe0, 0x28, 0x01, 0xe0,
-  0xbc, 0xe6, 0x0c, 0xc8, 0xfd, 0xf4, 0x21, 0x37, 0xf8, 0x10, 0x1b, 0x0a,
-  0x81, 0x28, 0x10, 0xb7, 0xa3, 0xbd, 0xf0, 0x07, 0xf2, 0xf5, 0xf3, 0x2d,
-  0x09, 0x43, 0xc1, 0x13, 0x19, 0x61, 0x27, 0xd9, 0x40, 0x03, 0xf8, 0x36,
-  0x23, 0x23, 0x18, 0xd0, 0xd5, 0x67, 0x1d, 0x3c, 0xbc, 0xd3, 0x39, 0xf7,
-  0xfd, 0x12, 0xbf, 0xbc, 0xec, 0x48, 0x05, 0x19, 0x2e, 0x2a, 0x1e, 0x03,
-  0xf6, 0x1a, 0xff, 0x3e, 0xde, 0x21, 0xdf, 0x42, 0x18, 0xb0, 0xc6, 0x50,
-  0xa9, 0x28, 0x1c, 0x0a, 0x07, 0x11, 0xc9, 0xee, 0x05, 0x7f, 0x21, 0xbf,
-  0xcd, 0x0f, 0x12, 0xf0, 0xcc, 0xdc, 0x41, 0xe1, 0xe0, 0xf7, 0x27, 0xde,
-  0x12, 0xeb, 0xfe, 0x01, 0x31, 0xdb, 0x5c, 0x02, 0xbd, 0xf1, 0xd0, 0xed,
-  0xed, 0x0d, 0xd5, 0xcd, 0x13, 0x04, 0x4a, 0xe4, 0x1f, 0x38, 0x11, 0xe0,
-  0x39, 0x26, 0x30, 0x15, 0x78, 0x16, 0x10, 0xc2, 0xc3, 0x3f, 0xe6, 0xee,
-  0x24, 0x10, 0xf5, 0x05, 0xbf, 0xed, 0x9e, 0xfc, 0xf9, 0x32, 0x43, 0x2e,
-  0xd3, 0xcf, 0x20, 0xc4, 0xe9, 0xef, 0x45, 0xc0, 0x8a, 0xda, 0xfd, 0x3d,
-  0xf2, 0xdf, 0x1c, 0xb5, 0x44, 0xd9, 0x0a, 0x85, 0xad, 0x28, 0xda, 0x05,
-  0xb0, 0xfc, 0x31, 0xf1, 0x16, 0x41, 0x17, 0x2a, 0x92, 0xed, 0xde, 0xf4,
-  0x12, 0xbb, 0x58, 0x38, 0xe2, 0xa7, 0xa9, 0xf2, 0xe8, 0x01, 0xe4, 0x1d,
-  0xa0, 0x1d, 0x4f, 0xfc, 0xe6, 0xfb, 0x24, 0xc0, 0xb2, 0x0a, 0x1f, 0x34,
-  0x48, 0xd7, 0x7f, 0x5f, 0x09, 0x22, 0xfc, 0x02, 0x67, 0xa7, 0xef, 0xda,
-  0x31, 0x08, 0x04, 0xd9, 0x0b, 0x0e, 0xbb, 0x17, 0x3f, 0x38, 0xe8, 0xbe,
-  0x0d, 0x0f, 0xd6, 0x88, 0xa7, 0x2f, 0x1f, 0x1f, 0xd9, 0xd4, 0xf8, 0x62,
-  0x3c, 0xa2, 0xea, 0xfa, 0xbc, 0xbb, 0xd7, 0x09, 0x0b, 0xd8, 0x06, 0x5c,
-  0xf9, 0xad, 0xfc, 0xf9, 0x89, 0x30, 0xcc, 0xda, 0xe8, 0xcd, 0xef, 0x74,
-  0xfb, 0xaf, 0x12, 0x0c, 0xee, 0x18, 0x35, 0x12, 0xe8, 0xc8, 0x19, 0x2c,
-  0x3c, 0x21, 0xe3, 0x1e, 0xee, 0x38, 0xc1, 0xda, 0x0c, 0x18, 0xf0, 0x02,
-  0x13, 0x2f, 0xfd, 0x22, 0xdb, 0x33, 0xde, 0xea, 0xd5, 0xe7, 0x11, 0xe5,
-  0xbe, 0xb1, 0x52, 0x1f, 0xe3, 0x64, 0x18, 0xda, 0xe4, 0x66, 0xed, 0x14,
-  0xfa, 0x29, 0xe8, 0xed, 0xb1, 0xe9, 0x36, 0x34, 0x3a, 0x3b, 0x16, 0x45,
-  0x00, 0xea, 0xd2, 0x4a, 0xba, 0xfa, 0xfa, 0x95, 0xbd, 0x5a, 0xf1, 0x89,
-  0x12, 0x7f, 0x11, 0xb0, 0xf8, 0x17, 0x0e, 0x29, 0x82, 0xbc, 0x35, 0xf2,
-  0xed, 0xab, 0x26, 0x32, 0x0a, 0x13, 0x0e, 0x15, 0xeb, 0x14, 0x58, 0x09,
-  0x02, 0x0f, 0xe8, 0x0b, 0x13, 0xcf, 0x20, 0xe4, 0xdc, 0x28, 0x42, 0x5d,
-  0xbc, 0x28, 0x29, 0xd8, 0x4a, 0xf9, 0xdf, 0x34, 0xeb, 0x18, 0x24, 0xeb,
-  0x14, 0x79, 0x1c, 0xe3, 0x04, 0x1e, 0xde, 0xf2, 0x1d, 0x0f, 0xf6, 0x4c,
-  0x0c, 0xfb, 0x33, 0x26, 0xe6, 0x06, 0x02, 0x19, 0x08, 0xd7, 0x25, 0xcf,
-  0x24, 0xb3, 0x19, 0x15, 0xbd, 0xed, 0xd3, 0x2f, 0x05, 0xf9, 0xdc, 0x0f,
-  0xc0, 0xbf, 0x16, 0x1f, 0x02, 0x2a, 0xe3, 0xbb, 0xf1, 0x16, 0x2b, 0x0e,
-  0x17, 0xa5, 0xee, 0x0e, 0x4c, 0xa6, 0x0f, 0xd8, 0x02, 0xe8, 0x1e, 0xe2,
-  0xfa, 0xfd, 0xde, 0x02, 0xf0, 0xef, 0x2c, 0xf2, 0x3e, 0x37, 0x1a, 0xde,
-  0x35, 0x10, 0xee, 0x16, 0x0c, 0xe1, 0xf1, 0x0a, 0xed, 0xc5, 0xd9, 0xf9,
-  0xfb, 0xfc, 0x0e, 0x21, 0x7f, 0x1c, 0x16, 0xe3, 0xee, 0x1b, 0xcb, 0x2b,
-  0xe5, 0xcf, 0x1b, 0x2f, 0xc5, 0x0a, 0xcf, 0xee, 0xec, 0xfb, 0xd9, 0x25,
-  0xf3, 0xe7, 0xbe, 0x0f, 0x15, 0xcb, 0xc5, 0x02, 0x0c, 0x06, 0x30, 0xed,
-  0x03, 0xf8, 0x10, 0xcc, 0xc6, 0xfa, 0xfc, 0xea, 0xde, 0xb4, 0x04, 0x11,
-  0xfd, 0xee, 0x0e, 0xc6, 0xd6, 0x28, 0x0c, 0x14, 0xc0, 0x0e, 0xae, 0xbb,
-  0xfe, 0x0c, 0x22, 0xfa, 0xf4, 0x00, 0xdf, 0xf2, 0x3d, 0xcb, 0xcb, 0x26,
-  0x0a, 0x4e, 0xf5, 0x2b, 0xf6, 0xeb, 0x0b, 0x32, 0x12, 0xeb, 0xff, 0x3a,
-  0xcc, 0xe1, 0x22, 0x06, 0xde, 0xa5, 0x58, 0x18, 0xd3, 0x62, 0xc8, 0xcc,
-  0xca, 0x16, 0x24, 0xd2, 0xd9, 0x09, 0xd9, 0xee, 0xc6, 0xf1, 0x1b, 0xb5,
-  0x1f, 0x3b, 0xef, 0x27, 0x53, 0x9e, 0xb4, 0x5f, 0x96, 0xbc, 0x1a, 0xa1,
-  0x07, 0x40, 0x35, 0xfd, 0x3b, 0x4e, 0xfc, 0x98, 0xd0, 0xeb, 0x25, 0xbd,
-  0x81, 0xc7, 0x11, 0xfa, 0x0c, 0xac, 0xb3, 0x02, 0x64, 0x71, 0xe1, 0x05,
-  0x08, 0x16, 0x29, 0x1c, 0x40, 0x06, 0x14, 0xdc, 0x20, 0xf2, 0x40, 0xce,
-  0xff, 0x16, 0xf7, 0x3b, 0x22, 0x05, 0xc4, 0xf6, 0x50, 0xe2, 0x0c, 0x53,
-  0x1c, 0xb5, 0xc1, 0xcf, 0x08, 0x3f, 0x43, 0xd4, 0x29, 0x36, 0xcd, 0xc2,
-  0x02, 0x23, 0xdb, 0xf5, 0x3f, 0xae, 0x1f, 0x32, 0x1d, 0xcc, 0x0c, 0xea,
-  0x5f, 0x27, 0xc2, 0x59, 0x22, 0x33, 0x8d, 0xf0, 0x5e, 0x4f, 0x4c, 0x04,
-  0x1e, 0xf1, 0x0b, 0x46, 0x31, 0x47, 0x1f, 0xef, 0xf5, 0x2c, 0x33, 0x10,
-  0xe2, 0xcb, 0x4b, 0x2d, 0xfc, 0x2d, 0xd0, 0x05, 0xf6, 0x74, 0x3b, 0xf7,
-  0xd9, 0x35, 0xd3, 0xd7, 0xa5, 0x23, 0x11, 0x15, 0xf4, 0x41, 0x82, 0x4f,
-  0x04, 0x8e, 0x1a, 0x14, 0x01, 0xf4, 0x28, 0xb7, 0xa9, 0x3c, 0x0f, 0xcb,
-  0x03, 0x7e, 0xcc, 0xad, 0xc0, 0x16, 0x34, 0xfa, 0xc1, 0xe2, 0x39, 0x38,
-  0x1e, 0xb6, 0x2e, 0xc5, 0x04, 0xd7, 0x08, 0x25, 0xf4, 0xe4, 0x7f, 0x12,
-  0xf7, 0x13, 0xd0, 0x3a, 0x0e, 0x66, 0xe6, 0xbb, 0xaa, 0x41, 0x11, 0x36,
-  0x2b, 0x15, 0xe3, 0x06, 0x33, 0x05, 0x10, 0x33, 0x59, 0xf0, 0xc5, 0x08,
-  0xdd, 0x35, 0xe0, 0xf4, 0x3e, 0xb8, 0xe8, 0x2c, 0x38, 0xe3, 0x91, 0xda,
-  0x2b, 0xa0, 0x7a, 0x1a, 0x13, 0x98, 0xe8, 0xcf, 0xaf, 0xfe, 0x2b, 0xc4,
-  0x15, 0xc5, 0x1a, 0x09, 0xc7, 0xd0, 0x63, 0x1f, 0xb3, 0xd0, 0x2b, 0x0e,
-  0x6c, 0xed, 0xea, 0xa6, 0x08, 0x7f, 0xed, 0xe3, 0x36, 0xf1, 0x09, 0x05,
-  0xaa, 0xe8, 0xf8, 0x04, 0x07, 0x97, 0xe8, 0xf6, 0xc0, 0xbb, 0x5e, 0x16,
-  0x1f, 0x4a, 0xcd, 0x5d, 0xc8, 0xeb, 0x5f, 0x02, 0x3c, 0xeb, 0x20, 0x06,
-  0xf7, 0x3b, 0xc9, 0xe8, 0xd7, 0x26, 0x32, 0x20, 0xb5, 0xaf, 0x12, 0x08,
-  0x32, 0xdf, 0xc0, 0x2c, 0x14, 0x4d, 0xcb, 0xbf, 0xdb, 0x0d, 0x4b, 0x1a,
-  0x1d, 0x3f, 0xef, 0xb5, 0xd8, 0xca, 0x8a, 0x13, 0x39, 0xa1, 0x02, 0x0a,
-  0xab, 0x9d, 0xe9, 0xf1, 0xdd, 0x8b, 0x2c, 0xd2, 0xbc, 0xce, 0xcd, 0x0f,
-  0x95, 0xf9, 0xcc, 0x1b, 0xf9, 0x42, 0x2b, 0xd5, 0xe5, 0xd1, 0x00, 0x4a,
-  0x18, 0x03, 0x5a, 0x03, 0xd0, 0xcb, 0x18, 0x38, 0x86, 0x01, 0xde, 0xbe,
-  0xe4, 0x22, 0x10, 0x09, 0xc0, 0xbe, 0x46, 0xb5, 0xb6, 0xeb, 0x06, 0x49,
-  0xdb, 0xbe, 0x19, 0x19, 0x21, 0x1c, 0x2a, 0xf0, 0xd8, 0x2f, 0xdc, 0xf3,
-  0x0e, 0x32, 0x5d, 0x07, 0x3c, 0x5b, 0xc2, 0xea, 0xed, 0xc7, 0xf2, 0xed,
-  0xf0, 0xf2, 0x1a, 0x05, 0x12, 0xd1, 0xbe, 0x1b, 0xdf, 0x09, 0x14, 0xe6,
-  0xb4, 0xdb, 0x5f, 0xf6, 0xe9, 0x03, 0x14, 0xe3, 0x16, 0xfe, 0xc8, 0x03,
-  0xfa, 0xd3, 0x52, 0x29, 0x0c, 0xcc, 0xe6, 0x1f, 0x25, 0xea, 0xce, 0xf4,
-  0x4c, 0x02, 0xc6, 0xee, 0xed, 0x3d, 0x05, 0xe3, 0x38, 0x1e, 0x05, 0x25,
-  0x1f, 0xd8, 0xe8, 0x0c, 0x03, 0xc1, 0xf5, 0x0b, 0xdb, 0x1a, 0xe7, 0xf2,
-  0x12, 0xb5, 0xe0, 0xb4, 0x15, 0xbb, 0x98, 0xc4, 0x40, 0x55, 0x13, 0x2f,
-  0xd8, 0xc8, 0x38, 0xd4, 0xe5, 0xf1, 0xba, 0x1f, 0xf4, 0xf0, 0x0e, 0x1d,
-  0xcd, 0xe9, 0x3f, 0xfa, 0x81, 0xe4, 0xf9, 0xc9, 0xcc, 0xf0, 0xd6, 0xf6,
-  0xd2, 0xfe, 0x09, 0x18, 0x34, 0xd9, 0x0e, 0xdb, 0xee, 0x58, 0x8d, 0x41,
-  0x3c, 0xc4, 0xe3, 0xd6, 0xc6, 0x08, 0xfc, 0xfb, 0x08, 0xd4, 0x04, 0x0e,
-  0x17, 0x44, 0x10, 0xb7, 0x63, 0xf3, 0x11, 0x2c, 0xab, 0xb5, 0xcd, 0x21,
-  0x3d, 0xf9, 0xf1, 0x09, 0xec, 0xe5, 0x18, 0xaa, 0x40, 0x2a, 0xf2, 0xdd,
-  0x7f, 0x29, 0x39, 0xc9, 0x3d, 0x26, 0xe1, 0xff, 0x1e, 0x08, 0xd1, 0x57,
-  0x20, 0xea, 0x0e, 0xdd, 0xde, 0xe5, 0xea, 0xd7, 0x50, 0x34, 0xe7, 0x25,
-  0x1f, 0x5a, 0xf4, 0xdc, 0xf7, 0x34, 0xcb, 0x0a, 0xd4, 0x55, 0xf2, 0x60,
-  0x0b, 0xd7, 0xdc, 0xd8, 0x23, 0xc7, 0xf3, 0xe7, 0x31, 0xf8, 0xeb, 0x27,
-  0xda, 0x2c, 0x32, 0xc0, 0xce, 0xd7, 0x11, 0x32, 0x1a, 0xd7, 0xef, 0xe8,
-  0xf2, 0x04, 0xf2, 0xb2, 0xf5, 0x08, 0xbd, 0x93, 0x17, 0x3f, 0x18, 0xd3,
-  0x0e, 0xae, 0xfa, 0x0b, 0xd1, 0xdf, 0x17, 0xd1, 0xdb, 0xc4, 0xf7, 0xfb,
-  0x13, 0x24, 0xf0, 0x06, 0x10, 0xb5, 0xfa, 0xd9, 0x34, 0x1d, 0x11, 0xe4,
-  0x38, 0x20, 0x31, 0x02, 0xfd, 0xcc, 0xd3, 0x13, 0xe2, 0x4e, 0xfc, 0xff,
-  0xaf, 0x20, 0xcb, 0x07, 0x27, 0x18, 0x4d, 0xf9, 0xd9, 0xf5, 0xf8, 0xf1,
-  0xe6, 0xf8, 0x4e, 0xe6, 0xb1, 0xaa, 0xef, 0x01, 0xa5, 0xd8, 0xe9, 0xd3,
-  0x04, 0xcc, 0xed, 0x21, 0x24, 0xd9, 0xec, 0x11, 0x1e, 0x14, 0xdc, 0xf0,
-  0x45, 0x18, 0x1a, 0x28, 0xed, 0xd0, 0x28, 0x09, 0x1d, 0x0f, 0x3b, 0xd8,
-  0x35, 0x15, 0x03, 0xfe, 0x18, 0xd6, 0x2e, 0xf0, 0x91, 0x1a, 0x0a, 0xfe,
-  0xe1, 0x28, 0x06, 0x29, 0x23, 0xe2, 0x17, 0x81, 0xea, 0x23, 0xec, 0x08,
-  0x2a, 0xd5, 0x04, 0xca, 0x2d, 0x08, 0x03, 0x2b, 0x27, 0xe2, 0xd2, 0x2e,
-  0x3e, 0xf6, 0xd3, 0x4f, 0xfa, 0xcc, 0x3e, 0xcf, 0xed, 0x17, 0x53, 0x34,
-  0x37, 0x16, 0x2e, 0xf7, 0x24, 0xf1, 0xd8, 0xcd, 0x22, 0x43, 0xdf, 0x11,
-  0x6b, 0x0a, 0x31, 0xce, 0x40, 0xda, 0x49, 0x44, 0x1e, 0xe9, 0xe9, 0xb8,
-  0xff, 0xfa, 0x12, 0xe3, 0x03, 0xb9, 0xe2, 0x24, 0x2e, 0x37, 0xd8, 0x92,
-  0xc3, 0x59, 0x34, 0x3e, 0x64, 0x39, 0xf9, 0x0c, 0xca, 0xc4, 0x37, 0xd4,
-  0xef, 0x31, 0xe8, 0x4f, 0xf3, 0x89, 0xc6, 0x40, 0xb7, 0x25, 0x05, 0xdf,
-  0xc2, 0x39, 0x2b, 0xc6, 0xf0, 0x7f, 0x38, 0xce, 0xfb, 0xe1, 0xfa, 0x0e,
-  0xb3, 0x2e, 0x26, 0x18, 0xcb, 0xd8, 0x07, 0x23, 0xf3, 0xe3, 0xed, 0x3a,
-  0xfe, 0x26, 0x7e, 0x05, 0xe5, 0x30, 0x19, 0x4e, 0x5f, 0x09, 0x35, 0xd7,
-  0x11, 0x40, 0x48, 0xf5, 0xdf, 0x05, 0x15, 0x25, 0x37, 0x1d, 0xf7, 0x0a,
-  0x43, 0x14, 0xed, 0x42, 0x00, 0x54, 0x06, 0x23, 0x47, 0xab, 0xe3, 0xf8,
-  0xed, 0xf9, 0xab, 0x23, 0x40, 0xb3, 0x46, 0x34, 0x47, 0x20, 0x18, 0x1e,
-  0x37, 0x5b, 0xc3, 0xf1, 0xd0, 0x0c, 0x9e, 0x23, 0x71, 0x2a, 0x43, 0xd5,
-  0x2a, 0x4c, 0xf0, 0x0c, 0x3b, 0x0b, 0x03, 0xb5, 0x09, 0x00, 0xd6, 0xd8,
-  0xc5, 0xf8, 0x46, 0x09, 0x45, 0x0a, 0xd7, 0x9e, 0xd6, 0x7e, 0x1e, 0xf7,
-  0x44, 0x21, 0x34, 0xe9, 0xb9, 0x1d, 0x03, 0xee, 0xbf, 0x63, 0x9a, 0xfc,
-  0xd2, 0x9f, 0xae, 0x65, 0xb1, 0xf8, 0x1a, 0xb1, 0x02, 0x2b, 0x12, 0xe0,
-  0xc5, 0x20, 0xfb, 0xf1, 0xf5, 0x25, 0x0f, 0x2f, 0xa8, 0xce, 0x35, 0x18,
-  0xb8, 0xbd, 0x30, 0xfd, 0xb9, 0x11, 0xe8, 0x46, 0xfe, 0x0b, 0x6d, 0x2e,
-  0xec, 0x2d, 0xdd, 0x1f, 0x79, 0x6a, 0xc4, 0xba, 0x25, 0x65, 0x20, 0x0e,
-  0xe6, 0x05, 0xad, 0xc6, 0xe5, 0x23, 0xec, 0x34, 0x16, 0x0c, 0x6e, 0xe1,
-  0xef, 0x3c, 0x29, 0x0b, 0x28, 0xa8, 0xc6, 0xd2, 0x23, 0xca, 0xa0, 0x29,
-  0x42, 0xb6, 0x7f, 0x47, 0x0e, 0xb2, 0xff, 0xb5, 0x17, 0x96, 0x26, 0x19,
-  0x10, 0xe6, 0x70, 0xf6, 0xca, 0xb3, 0xe5, 0xd6, 0xd0, 0x3e, 0xe0, 0xf1,
-  0xff, 0xec, 0x1e, 0xf6, 0x8d, 0xfc, 0xcd, 0xf8, 0x04, 0x4d, 0x25, 0xd2,
-  0xd8, 0xba, 0x25, 0x2e, 0x4d, 0xde, 0x2b, 0xfc, 0xe8, 0xc8, 0xf9, 0x20,
-  0x27, 0x54, 0xce, 0x4a, 0x68, 0x44, 0x42, 0x02, 0x2c, 0x13, 0x1a, 0xfd,
-  0xf1, 0x0e, 0x17, 0x35, 0x58, 0x81, 0xef, 0x21, 0x15, 0xac, 0x46, 0x43,
-  0x22, 0xf9, 0xd1, 0xe5, 0x2b, 0xaf, 0x01, 0x09, 0x00, 0x15, 0xd6, 0xf1,
-  0xf2, 0xb7, 0xc0, 0xb8, 0xe3, 0xca, 0xd2, 0xcb, 0x32, 0xfc, 0x05, 0x3a,
-  0x95, 0x18, 0xbd, 0x0d, 0x09, 0xac, 0xf0, 0xe5, 0xc8, 0xbd, 0x38, 0x1b,
-  0xe3, 0x09, 0xfc, 0xe8, 0xe2, 0xb0, 0xb3, 0xf8, 0x50, 0xd6, 0xf8, 0x57,
-  0x15, 0xfd, 0xce, 0xeb, 0x15, 0x3e, 0x1e, 0xcf, 0xd1, 0x52, 0xb8, 0x90,
-  0x54, 0x14, 0xe9, 0x70, 0x28, 0x3a, 0xab, 0x4a, 0xfe, 0x12, 0xd9, 0x21,
-  0x03, 0xf3, 0x69, 0x1c, 0xed, 0x25, 0x48, 0x71, 0xc8, 0xc8, 0xbc, 0xae,
-  0x54, 0xff, 0x26, 0x3a, 0xb6, 0xbf, 0x01, 0x34, 0xe1, 0x4c, 0xe7, 0x04,
-  0xe7, 0x43, 0x10, 0x27, 0x49, 0x0e, 0xd6, 0x2d, 0xcb, 0x54, 0x06, 0xfd,
-  0xfb, 0x14, 0xa8, 0xf8, 0xbb, 0xbd, 0xbb, 0x78, 0xda, 0x1e, 0xf5, 0xf5,
-  0x12, 0x0f, 0x1e, 0xaa, 0xae, 0x01, 0xe7, 0xe5, 0x01, 0x31, 0xcc, 0xfc,
-  0xe9, 0xed, 0x1b, 0x1c, 0xc1, 0x89, 0xf0, 0x28, 0x00, 0xfd, 0xe1, 0x24,
-  0x0d, 0xee, 0x23, 0x48, 0x32, 0x0f, 0xde, 0xe5, 0x3f, 0xea, 0xed, 0x81,
-  0xb7, 0x4e, 0x1a, 0x3d, 0xe7, 0x6d, 0x2e, 0x0c, 0x52, 0x0d, 0x26, 0x37,
-  0x06, 0x2a, 0x1d, 0x31, 0xf8, 0x72, 0xc0, 0x2c, 0x2f, 0x20, 0xf1, 0xfa,
-  0x44, 0xe4, 0xbb, 0xd9, 0x51, 0x05, 0xe8, 0xd4, 0xec, 0xbb, 0x2b, 0x14,
-  0xd8, 0xef, 0x35, 0xd7, 0x0e, 0x03, 0x57, 0x49, 0xf7, 0x57, 0xec, 0xf5,
-  0xf2, 0xe2, 0x46, 0xce, 0x36, 0x04, 0x49, 0xde, 0x01, 0xe9, 0x0f, 0x0d,
-  0x1d, 0x08, 0x0d, 0xe8, 0x02, 0x21, 0xd4, 0xff, 0x33, 0x81, 0xde, 0xf6,
-  0x00, 0x57, 0x25, 0xc7, 0x00, 0xe8, 0xb0, 0x32, 0x0a, 0xb7, 0x25, 0xd2,
-  0xf9, 0x3d, 0x50, 0xc2, 0x1d, 0x00, 0xe2, 0x18, 0xef, 0xd3, 0x2f, 0xf2,
-  0xfb, 0xa2, 0xd8, 0xf5, 0x1f, 0xdc, 0xe0, 0xf6, 0x2d, 0x1f, 0x00, 0xca,
-  0x05, 0xef, 0x0e, 0x2a, 0xb1, 0xfb, 0x25, 0xd4, 0x0f, 0xe7, 0xbe, 0xf6,
-  0xfd, 0xd7, 0xe4, 0x47, 0xaa, 0xc6, 0xd6, 0x29, 0x25, 0x9f, 0x10, 0x0e,
-  0xfc, 0xcb, 0xcf, 0x26, 0xb3, 0xc7, 0xb7, 0x12, 0x24, 0x43, 0xeb, 0x23,
-  0xd2, 0xd9, 0xf9, 0xca, 0x05, 0x1c, 0x06, 0xc6, 0x02, 0xd0, 0x22, 0x32,
-  0xf9, 0x02, 0x19, 0x0c, 0x50, 0x3a, 0xe4, 0x70, 0x3a, 0xfe, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xe4, 0xff, 0xff, 0xff,
+  0xa4, 0x0d, 0x00, 0x00, 0x86, 0xe6, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x04, 0x81, 0x48, 0x81,
+  0xc1, 0xdc, 0xd4, 0xcc, 0x81, 0xbb, 0x48, 0x7f, 0x97, 0xd1, 0x57, 0x19,
+  0x53, 0x16, 0xe0, 0xcc, 0xe3, 0x0c, 0x45, 0x7f, 0x53, 0x81, 0x7f, 0x54,
+  0x7f, 0x4d, 0x4c, 0x5d, 0x7f, 0x64, 0x0d, 0x5c, 0x2d, 0x81, 0xd7, 0x7f,
+  0x28, 0x81, 0x6a, 0x55, 0xac, 0xe8, 0x81, 0x1d, 0xd1, 0x52, 0x81, 0x7f,
+  0x7f, 0xa9, 0x81, 0xad, 0x7f, 0xe8, 0xe4, 0xa6, 0xab, 0x3f, 0xdd, 0x81,
+  0x7f, 0x58, 0x7f, 0x7f, 0x10, 0x81, 0x7f, 0xd2, 0x81, 0x9b, 0x58, 0x81,
+  0xb4, 0xed, 0x2f, 0x81, 0x9a, 0x1e, 0x3b, 0x4e, 0x81, 0xfc, 0x73, 0xd2,
+  0x08, 0x7f, 0xf8, 0x4a, 0xef, 0x81, 0x7f, 0xd3, 0xe4, 0x7f, 0x7f, 0x98,
+  0xaf, 0x5c, 0x4c, 0x30, 0x81, 0xd6, 0x8d, 0x7f, 0xe8, 0x41, 0x06, 0x1e,
+  0xe9, 0x3c, 0x3b, 0x7f, 0x45, 0xc4, 0x43, 0x47, 0x7a, 0x22, 0x7f, 0xe4,
+  0x01, 0x7f, 0xd8, 0xf5, 0xf5, 0xe3, 0x56, 0xd2, 0xf3, 0xef, 0xf6, 0xe7,
+  0xca, 0xd9, 0x52, 0x58, 0xcf, 0x81, 0x4f, 0x1b, 0x06, 0x30, 0xe1, 0xeb,
+  0xcc, 0x11, 0x14, 0x14, 0x47, 0xbb, 0x45, 0x47, 0x41, 0x36, 0x4d, 0x5d,
+  0x3e, 0x4d, 0x09, 0xed, 0xe2, 0xa5, 0x55, 0x6b, 0x2b, 0xc5, 0x09, 0x06,
+  0xb0, 0x06, 0xcf, 0xf8, 0xc6, 0x44, 0xcb, 0x46, 0x47, 0xfe, 0x84, 0x81,
+  0x30, 0xc9, 0xf0, 0xa7, 0xaa, 0x18, 0x04, 0xc0, 0x18, 0x31, 0x2a, 0x3e,
+  0xf4, 0xf1, 0x4f, 0xf0, 0xd3, 0xe5, 0x2a, 0x08, 0xa3, 0xe8, 0xf0, 0xbd,
+  0xc0, 0x16, 0x1b, 0x24, 0xa1, 0xff, 0x07, 0xa2, 0x01, 0x41, 0xee, 0x25,
+  0x3a, 0xbd, 0x18, 0xd7, 0x81, 0x37, 0x39, 0xff, 0xb4, 0x40, 0x81, 0xcd,
+  0xa1, 0xa7, 0x0b, 0xed, 0xe5, 0x46, 0x03, 0x4b, 0x00, 0x5a, 0x4b, 0x3e,
+  0x12, 0x19, 0x20, 0x8f, 0x3c, 0xec, 0x31, 0xf6, 0xfc, 0x77, 0x84, 0xfb,
+  0x12, 0xfe, 0x37, 0xd2, 0x1b, 0x6d, 0xec, 0xee, 0xd6, 0xe8, 0x64, 0x2a,
+  0xcd, 0xbd, 0x32, 0x25, 0x00, 0x27, 0xfa, 0x3b, 0xe0, 0xf8, 0x32, 0xd4,
+  0x49, 0xc4, 0x50, 0x51, 0x3b, 0x0d, 0x70, 0x2e, 0x41, 0x3f, 0xe4, 0x11,
+  0x81, 0xe6, 0x7f, 0x41, 0x0c, 0xcb, 0x0b, 0x50, 0x11, 0x02, 0xea, 0xfe,
+  0xbf, 0x43, 0xcd, 0x1b, 0x37, 0x81, 0xce, 0xbe, 0x2b, 0xac, 0xdd, 0x81,
+  0xbe, 0x11, 0x1a, 0xdf, 0xf3, 0x25, 0x0f, 0x10, 0xea, 0x04, 0x30, 0xaf,
+  0x05, 0xff, 0x35, 0x0a, 0xa4, 0x0b, 0x3e, 0xd4, 0xa9, 0x0e, 0x1b, 0x40,
+  0x9b, 0xed, 0x33, 0xff, 0xf8, 0x10, 0xf6, 0x20, 0xf0, 0xc3, 0x0e, 0xe7,
+  0xb5, 0x39, 0x38, 0x29, 0xc3, 0x40, 0xd8, 0xe0, 0xc9, 0x13, 0xd0, 0x10,
+  0xea, 0x62, 0xd0, 0x1b, 0xe9, 0x7f, 0x47, 0x46, 0xf7, 0x08, 0x20, 0x89,
+  0x57, 0x13, 0x4a, 0x06, 0x26, 0x61, 0xf8, 0x07, 0x07, 0x03, 0x61, 0xed,
+  0x24, 0x2d, 0xdd, 0x3c, 0xd7, 0xbd, 0x7f, 0x2a, 0xcb, 0x55, 0x0e, 0x2b,
+  0x1a, 0xe9, 0xc6, 0x09, 0xf5, 0x0a, 0x23, 0xe5, 0x2f, 0xde, 0x31, 0x56,
+  0x3c, 0x2f, 0x2f, 0x22, 0x32, 0x50, 0x10, 0xfa, 0xdd, 0xc5, 0x33, 0x22,
+  0x13, 0xe7, 0x14, 0x4b, 0xfa, 0xe5, 0xf0, 0x01, 0xc3, 0x19, 0xf0, 0x0e,
+  0x26, 0xb9, 0xe4, 0xed, 0x59, 0xc2, 0xfd, 0x95, 0xf7, 0x11, 0x0b, 0xf5,
+  0xf0, 0x1f, 0x18, 0x52, 0xd5, 0x05, 0x1f, 0xd2, 0x37, 0xd0, 0x27, 0x06,
+  0x81, 0x05, 0x06, 0xd7, 0xb8, 0x06, 0x16, 0x5a, 0xa9, 0xea, 0xff, 0xb7,
+  0x01, 0x25, 0xc4, 0x2e, 0x11, 0xd3, 0x37, 0xdb, 0xa9, 0x38, 0x1b, 0xec,
+  0xd8, 0x3f, 0x92, 0x17, 0xa5, 0x69, 0xc6, 0x1b, 0xfc, 0x4a, 0xb4, 0x1b,
+  0xf5, 0xde, 0x23, 0x4d, 0xaf, 0x22, 0x22, 0x1f, 0x67, 0x0d, 0x2f, 0xed,
+  0x0f, 0x59, 0xf9, 0xc2, 0x04, 0xe8, 0x37, 0xf6, 0x71, 0xe3, 0xe1, 0x0a,
+  0xf5, 0xcb, 0x5f, 0x05, 0xc1, 0x10, 0x36, 0x1e, 0x38, 0x1b, 0xd7, 0x0a,
+  0x0c, 0xf8, 0x00, 0x01, 0x2a, 0xe6, 0x50, 0x5d, 0x14, 0x30, 0xff, 0x49,
+  0x1d, 0x53, 0x4d, 0xd8, 0xaa, 0xdc, 0x44, 0x06, 0x33, 0x07, 0x1c, 0xf9,
+  0xcb, 0xd7, 0xe6, 0xd5, 0xcd, 0x38, 0xe0, 0x1b, 0x39, 0xef, 0xf6, 0xfe,
+  0x52, 0xce, 0x50, 0x8e, 0x0a, 0x12, 0xcd, 0xe5, 0x04, 0x65, 0x03, 0x39,
+  0xa6, 0xb6, 0x2f, 0xdb, 0xfd, 0xbb, 0xf2, 0x24, 0x1c, 0x13, 0x81, 0xbf,
+  0xf2, 0x05, 0x1e, 0x60, 0xc6, 0xe8, 0xf6, 0x81, 0x03, 0x2e, 0xcb, 0x3b,
+  0xf6, 0xcc, 0x5a, 0xc7, 0x1c, 0x34, 0x1c, 0x19, 0xcc, 0x6c, 0xa7, 0x02,
+  0x9a, 0xf3, 0x91, 0x00, 0x18, 0x77, 0x34, 0xe6, 0x35, 0x1c, 0x41, 0x38,
+  0x81, 0x3c, 0x2f, 0xd3, 0x38, 0xf1, 0x1b, 0xd9, 0x0a, 0x52, 0x33, 0xd0,
+  0x04, 0xe5, 0x47, 0xdd, 0x3b, 0xfe, 0xde, 0xe8, 0xe1, 0xf1, 0x58, 0xba,
+  0x81, 0x29, 0x0d, 0x15, 0x06, 0x10, 0xe3, 0x11, 0xc9, 0xfe, 0xfd, 0xb4,
+  0x6b, 0xd5, 0x60, 0x7f, 0x26, 0x2c, 0xce, 0x37, 0x31, 0x4a, 0x7f, 0xe7,
+  0xe7, 0x05, 0xcf, 0xef, 0x16, 0xfc, 0xf5, 0xf9, 0x53, 0x19, 0xea, 0xce,
+  0xbe, 0x69, 0xf0, 0x2b, 0x30, 0x01, 0xe5, 0xbe, 0x1b, 0xc1, 0x20, 0xda,
+  0xfa, 0x14, 0x98, 0xe0, 0xfb, 0x7f, 0x09, 0x00, 0xd0, 0xbe, 0x36, 0x1c,
+  0xe6, 0xc7, 0x18, 0x55, 0x12, 0x03, 0xd2, 0xdf, 0x23, 0x1a, 0x25, 0x68,
+  0xec, 0xd8, 0x33, 0x20, 0x02, 0x1e, 0xf6, 0x7c, 0x1c, 0xca, 0x29, 0xd9,
+  0xcf, 0x25, 0x07, 0x0d, 0xdb, 0x7f, 0x88, 0xe5, 0xa9, 0x87, 0x83, 0x39,
+  0x12, 0x60, 0x1c, 0xb0, 0xf9, 0x0b, 0x10, 0x2f, 0xe5, 0x3f, 0x29, 0xf2,
+  0x50, 0x37, 0x2c, 0xda, 0x7f, 0x60, 0x0f, 0x54, 0x04, 0xe0, 0x4d, 0xd4,
+  0xea, 0xb3, 0xe1, 0xb3, 0xde, 0xf5, 0x5e, 0xb6, 0xb3, 0xe9, 0x4a, 0x34,
+  0xd9, 0xef, 0xd7, 0x4b, 0xd2, 0x0a, 0xdf, 0xc5, 0x3d, 0xce, 0x51, 0x5d,
+  0x1a, 0x49, 0xd2, 0x40, 0x1b, 0x50, 0x5c, 0xf4, 0x05, 0xf1, 0x01, 0x21,
+  0x1d, 0x15, 0x09, 0xe2, 0x0e, 0x0f, 0xea, 0xed, 0xf2, 0x4d, 0xeb, 0x30,
+  0x28, 0x45, 0xdc, 0xd8, 0xee, 0xd0, 0xaa, 0xa3, 0x20, 0x19, 0xbc, 0xdf,
+  0x06, 0x5e, 0x0b, 0xf5, 0x81, 0xe7, 0x3e, 0x31, 0xd4, 0xd4, 0xc0, 0x2b,
+  0x1a, 0x0d, 0xeb, 0xeb, 0x2c, 0x24, 0x2e, 0x7f, 0xff, 0x03, 0x3b, 0x33,
+  0x07, 0x01, 0xd9, 0x58, 0x34, 0xd9, 0x2d, 0xf6, 0xf3, 0x18, 0xe8, 0x35,
+  0xc4, 0x74, 0xa1, 0xcc, 0xf6, 0x07, 0x92, 0xf9, 0xe0, 0x4c, 0xfc, 0x14,
+  0x59, 0xf7, 0x7f, 0x1b, 0xb6, 0x1c, 0x23, 0x0e, 0x2b, 0x22, 0x39, 0xe3,
+  0x7e, 0x01, 0x08, 0x33, 0xf6, 0x03, 0x5b, 0xfa, 0xf8, 0xbe, 0xdd, 0xf0,
+  0xfd, 0xf4, 0xe7, 0xdd, 0xa1, 0xc5, 0x36, 0x32, 0xd8, 0xda, 0x2f, 0x15,
+  0xee, 0xfd, 0x11, 0xc4, 0x3d, 0xe9, 0x47, 0x27, 0x15, 0x52, 0xcb, 0x20,
+  0x3f, 0x4f, 0x1f, 0xc8, 0xff, 0x15, 0x22, 0x1a, 0x33, 0xfb, 0x19, 0xf9,
+  0x26, 0xd7, 0xf7, 0xec, 0xe0, 0x1e, 0xed, 0x08, 0x42, 0xe6, 0xdb, 0x2b,
+  0xb9, 0xc0, 0x86, 0xd8, 0xef, 0x13, 0x81, 0xe1, 0xe4, 0x27, 0x0a, 0xc4,
+  0xae, 0xfc, 0x2e, 0x31, 0xc8, 0xe4, 0xd1, 0x6b, 0x4f, 0x34, 0x3a, 0xdf,
+  0x37, 0x13, 0x2d, 0x77, 0xef, 0xf4, 0x13, 0xd9, 0x11, 0xf5, 0xb9, 0x50,
+  0xf4, 0xd8, 0xf6, 0xe0, 0xdf, 0x22, 0x1b, 0x30, 0xc4, 0x01, 0xb1, 0xd6,
+  0x99, 0xb6, 0x0c, 0x02, 0xf4, 0x7f, 0xa8, 0xe9, 0xcb, 0x17, 0x31, 0x28,
+  0xed, 0x55, 0x3e, 0x2e, 0x5c, 0x03, 0x40, 0xec, 0x30, 0x0f, 0xea, 0x7f,
+  0xe0, 0x00, 0x7f, 0xf7, 0x1e, 0x09, 0xdf, 0x15, 0xdf, 0x26, 0x13, 0xbe,
+  0xd4, 0xa3, 0x17, 0x32, 0xe7, 0x81, 0x5c, 0x22, 0xfc, 0xf7, 0xe5, 0xc9,
+  0x22, 0xd7, 0x5c, 0x2b, 0x0e, 0x3e, 0xe3, 0xf6, 0x14, 0x60, 0x20, 0x1c,
+  0xd9, 0x06, 0x36, 0x1c, 0x3c, 0x09, 0x4b, 0x0d, 0xd2, 0xce, 0xf5, 0xe3,
+  0xd8, 0x47, 0xe8, 0x10, 0x2e, 0xee, 0xe6, 0x07, 0x49, 0xae, 0x88, 0xad,
+  0xe0, 0x09, 0xe8, 0xef, 0x00, 0x23, 0x15, 0xf1, 0x91, 0x0c, 0x21, 0x4f,
+  0x1f, 0xdd, 0xfb, 0x4e, 0x52, 0x38, 0xc3, 0xc8, 0xfb, 0x23, 0x35, 0x5c,
+  0xaf, 0xef, 0xd0, 0x1a, 0x0a, 0xfc, 0xc8, 0x26, 0xf7, 0xd0, 0x2c, 0xcc,
+  0x1d, 0x11, 0x15, 0x0f, 0xcc, 0xfd, 0xd3, 0xec, 0xaf, 0xff, 0xe0, 0xfb,
+  0x1b, 0x40, 0x22, 0x23, 0x81, 0x02, 0x11, 0x37, 0xb7, 0x01, 0x3b, 0x2f,
+  0x49, 0x3d, 0x35, 0xc6, 0x45, 0x03, 0xf5, 0x16, 0xed, 0xee, 0x4e, 0xf5,
+  0x2e, 0x0d, 0xdd, 0xe8, 0xd7, 0x08, 0x1f, 0xfa, 0xc7, 0x9c, 0x2b, 0x1b,
+  0xd0, 0xbb, 0x7f, 0xe6, 0x27, 0x02, 0xc7, 0xbb, 0x36, 0xcb, 0x46, 0x43,
+  0x0e, 0x44, 0xe6, 0x18, 0x14, 0x5d, 0x1d, 0xbe, 0x1d, 0x0c, 0x71, 0x11,
+  0x23, 0x32, 0x4b, 0x07, 0x07, 0xcf, 0xfc, 0xde, 0xc8, 0x67, 0xe0, 0x25,
+  0x15, 0xec, 0xf1, 0xfe, 0xdf, 0x97, 0x81, 0xb5, 0xfb, 0x07, 0x13, 0xe7,
+  0xed, 0x0d, 0x08, 0x18, 0xa6, 0x16, 0x1b, 0xd9, 0xfb, 0xba, 0xc7, 0x61,
+  0xec, 0x3f, 0xdc, 0xc6, 0xe7, 0x00, 0x2e, 0x59, 0xed, 0xe8, 0x4a, 0xe6,
+  0x00, 0x0d, 0x22, 0x4c, 0xe1, 0xe2, 0x24, 0xcb, 0xcc, 0x1b, 0x04, 0x12,
+  0xbc, 0xbd, 0xfb, 0x8e, 0xa3, 0x50, 0x81, 0x3b, 0xff, 0x6b, 0x81, 0x15,
+  0x16, 0x6c, 0x18, 0x20, 0xae, 0x16, 0x34, 0xb9, 0x57, 0x1c, 0x22, 0xc3,
+  0x57, 0xff, 0x4e, 0x65, 0xf1, 0xf3, 0x38, 0xd6, 0x4a, 0xf5, 0xcd, 0x02,
+  0xe5, 0x21, 0x07, 0xdf, 0xd7, 0x03, 0x4f, 0x47, 0xec, 0x9e, 0x74, 0x15,
+  0x24, 0xfa, 0xcd, 0xad, 0x54, 0xe5, 0x6d, 0x21, 0x1b, 0x7f, 0xd4, 0x14,
+  0x0a, 0x64, 0x0b, 0xc2, 0xe7, 0x2b, 0xf5, 0xc3, 0x0c, 0x17, 0x3c, 0x81,
+  0xba, 0xd0, 0xf4, 0xc6, 0xd6, 0x38, 0xeb, 0x1e, 0x04, 0xfd, 0x04, 0x26,
+  0xe0, 0xa0, 0xd6, 0xc1, 0x81, 0x10, 0x06, 0xdb, 0x05, 0xe8, 0x06, 0xf1,
+  0x8e, 0x50, 0x01, 0xb1, 0x38, 0xbb, 0xc3, 0x3e, 0x34, 0x24, 0x12, 0xd8,
+  0x04, 0x22, 0x49, 0x5e, 0xfb, 0xf3, 0xbe, 0x17, 0x13, 0x10, 0x1e, 0x2c,
+  0x06, 0xe9, 0x06, 0xcc, 0x1d, 0x21, 0x14, 0x43, 0xb7, 0x16, 0xda, 0x81,
+  0xb9, 0x7f, 0xd4, 0x2a, 0xf4, 0x4b, 0xd1, 0x22, 0x00, 0xf0, 0x47, 0x25,
+  0x91, 0x51, 0x0d, 0x06, 0x6a, 0x4e, 0x2e, 0xa3, 0x52, 0x9d, 0xd9, 0x1b,
+  0xd9, 0x1e, 0x44, 0xda, 0x36, 0x9b, 0xcf, 0x0f, 0xf2, 0x5b, 0xde, 0xa8,
+  0xd0, 0xed, 0xc4, 0x42, 0xe4, 0xe3, 0x40, 0x29, 0x12, 0x0d, 0xc9, 0xab,
+  0x7f, 0xec, 0x25, 0xf7, 0x0c, 0x5d, 0xbc, 0x1b, 0x10, 0x5c, 0x20, 0x81,
+  0x31, 0x0e, 0xde, 0x0a, 0x26, 0x4f, 0x30, 0xd7, 0xd5, 0xc6, 0xfb, 0xa1,
+  0xd2, 0x71, 0xed, 0x0a, 0x28, 0x31, 0xf9, 0x09, 0xf3, 0xb0, 0xbc, 0xae,
+  0x94, 0x17, 0xd8, 0xed, 0x25, 0xe7, 0xf4, 0xf5, 0xa5, 0x1a, 0xfe, 0x81,
+  0x08, 0xdf, 0xd2, 0x76, 0xbb, 0x34, 0xe2, 0xf0, 0xd0, 0x30, 0x35, 0x67,
+  0x0e, 0xed, 0x81, 0x44, 0x10, 0x1f, 0xeb, 0x36, 0xbb, 0xec, 0x6e, 0xcb,
+  0xfc, 0x19, 0xf3, 0x34, 0xa8, 0x16, 0x0f, 0x89, 0xb4, 0xff, 0xb5, 0x06,
+  0x23, 0x2c, 0xc6, 0x03, 0x08, 0x2a, 0x33, 0x0d, 0x19, 0x3a, 0x3c, 0x4d,
+  0x52, 0x3f, 0x14, 0xaf, 0x66, 0xed, 0x31, 0x39, 0xd2, 0x0b, 0x4c, 0xec,
+  0x51, 0xb0, 0xd2, 0x0f, 0xee, 0x54, 0x16, 0xc5, 0xca, 0x53, 0xbc, 0x42,
+  0x99, 0xc7, 0x37, 0x7f, 0x55, 0x03, 0xbb, 0xfd, 0xde, 0xdb, 0x37, 0xe2,
+  0x14, 0x2a, 0xd5, 0x7f, 0x2f, 0x58, 0x27, 0x8d, 0xa1, 0x18, 0x2b, 0x29,
+  0x2b, 0xee, 0x2e, 0x1a, 0x90, 0xc8, 0xf4, 0x81, 0xb8, 0x45, 0xf6, 0x13,
+  0x17, 0x24, 0x25, 0x5b, 0x6e, 0x88, 0xa5, 0xe9, 0xd3, 0x18, 0x15, 0xee,
+  0xea, 0xea, 0x0e, 0xd4, 0xb7, 0x43, 0xed, 0xdc, 0x48, 0xd8, 0xb7, 0x75,
+  0xea, 0x16, 0xc6, 0xdf, 0xdd, 0x38, 0x38, 0x42, 0xf6, 0xd1, 0xfd, 0x1b,
+  0x20, 0x0c, 0xf0, 0x2a, 0x81, 0xe9, 0x3b, 0xd6, 0xec, 0x27, 0xcf, 0x41,
+  0x97, 0x11, 0x21, 0xab, 0x03, 0x58, 0x6e, 0xf3, 0xfa, 0x60, 0xda, 0xf4,
+  0x08, 0xfd, 0x17, 0x13, 0x73, 0x19, 0x4c, 0x7f, 0x23, 0x53, 0x2e, 0x81,
+  0x3f, 0x02, 0xb1, 0x4e, 0xcc, 0xf8, 0x35, 0xe3, 0x7f, 0xa5, 0xc8, 0xfc,
+  0xf7, 0x4e, 0x00, 0xe6, 0xd2, 0x63, 0x7f, 0x45, 0x8e, 0xd3, 0xd8, 0x1f,
+  0x1d, 0xd4, 0xc0, 0xf9, 0xe3, 0xbe, 0x28, 0xee, 0x07, 0x32, 0xce, 0x62,
+  0x34, 0x3c, 0x09, 0xe6, 0xfe, 0x06, 0x25, 0xe2, 0x4a, 0x60, 0x43, 0xe5,
+  0xba, 0xb4, 0x03, 0x87, 0x9d, 0x72, 0x03, 0x11, 0x34, 0x65, 0x21, 0x4d,
+  0x05, 0xa3, 0xdb, 0xe7, 0x29, 0x4c, 0x61, 0xf2, 0xe2, 0xe4, 0xf6, 0xbb,
+  0xc5, 0x32, 0xf7, 0xd8, 0x29, 0xc4, 0xe1, 0x54, 0xd6, 0x30, 0x69, 0x0a,
+  0xe9, 0x59, 0x54, 0x38, 0xea, 0xbf, 0x30, 0xdd, 0x36, 0x0e, 0xdb, 0x1f,
+  0xac, 0xed, 0x4e, 0xbe, 0xc9, 0x22, 0xea, 0x2b, 0x9f, 0xeb, 0x3f, 0xa8,
+  0xbf, 0x91, 0x61, 0x0c, 0x39, 0x68, 0xa8, 0x05, 0x0c, 0xf4, 0x05, 0x15,
+  0x77, 0x3c, 0x59, 0x3a, 0x43, 0x6c, 0x29, 0x9e, 0x13, 0x36, 0x81, 0x46,
+  0x81, 0xfa, 0x51, 0xba, 0x4b, 0x81, 0x81, 0x7f, 0xe8, 0x7f, 0xde, 0xb0,
+  0xc1, 0x44, 0x32, 0x7f, 0x81, 0xda, 0x09, 0x07, 0x7f, 0x81, 0x81, 0x6b,
+  0xcb, 0xbc, 0x40, 0xf7, 0x10, 0x7e, 0x81, 0x20, 0x50, 0x7f, 0x34, 0x50,
+  0x19, 0x46, 0x19, 0xbe, 0x7f, 0x30, 0x7f, 0xb0, 0x81, 0x81, 0xf1, 0x82,
+  0x81, 0x7f, 0xd9, 0x26, 0x30, 0x46, 0x2a, 0x29, 0x79, 0x81, 0xf4, 0x99,
+  0xab, 0x7f, 0xd3, 0xf0, 0x0f, 0xc2, 0xfa, 0xf3, 0x9f, 0x7f, 0x34, 0xc9,
+  0xfc, 0x81, 0x81, 0xfe, 0xbd, 0x7f, 0x24, 0xdf, 0x81, 0x7f, 0x7f, 0x27,
+  0x9c, 0x81, 0x09, 0xe6, 0x7f, 0x09, 0x81, 0x7f, 0xd1, 0xe2, 0x64, 0x81,
+  0xbe, 0x39, 0xb1, 0x7f, 0x81, 0xf8, 0x4c, 0xa7, 0xb4, 0x04, 0x39, 0x39,
+  0x7f, 0x4f, 0xc9, 0x7f, 0xe7, 0xf8, 0x21, 0x34, 0x43, 0x7f, 0x7f, 0x41,
+  0x7f, 0x7f, 0x53, 0x9c, 0xce, 0x2b, 0x28, 0x05, 0x16, 0xee, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x64, 0x11, 0x32, 0xed, 0xfb, 0x20, 0x4d, 0x2a, 0xe3, 0xe9, 0x48, 0xa0,
+  0xae, 0x30, 0xd0, 0x9f, 0x26, 0x1d, 0x7a, 0x4c, 0xe0, 0x0f, 0xf4, 0xc3,
+  0x06, 0xc0, 0x47, 0xd1, 0x88, 0xf0, 0x13, 0xed, 0x33, 0x88, 0x41, 0x52,
+  0xe4, 0x96, 0x44, 0xa9, 0x60, 0x6d, 0x08, 0x17, 0xdb, 0x0f, 0x01, 0xf8,
+  0x10, 0x07, 0x25, 0xcf, 0x3f, 0x24, 0xe2, 0x13, 0x11, 0xc8, 0xf5, 0xd2,
+  0xd3, 0xc6, 0xbd, 0x3c, 0xee, 0x81, 0xeb, 0xf2, 0x08, 0xe5, 0xcf, 0x0f,
+  0x32, 0x43, 0x07, 0x33, 0x1a, 0x24, 0xd8, 0xa6, 0xd4, 0x0d, 0xa4, 0xcf,
+  0x56, 0x25, 0x16, 0xc8, 0xd5, 0xf9, 0xed, 0x55, 0x29, 0x17, 0x13, 0x1f,
+  0x42, 0xe4, 0x24, 0x6c, 0xc1, 0x15, 0xd2, 0x33, 0xca, 0xde, 0xab, 0xec,
+  0x35, 0xb6, 0xe1, 0xd7, 0x12, 0xd1, 0xf8, 0x45, 0x10, 0xa7, 0x04, 0xc6,
+  0x4e, 0x3a, 0xca, 0x32, 0x54, 0x00, 0xd4, 0xe6, 0xea, 0xdd, 0x33, 0xad,
+  0x2a, 0xf2, 0x35, 0xe5, 0xdf, 0xf2, 0x39, 0xd8, 0xc9, 0xf9, 0x31, 0xe9,
+  0xda, 0xe5, 0x1a, 0xe1, 0xe9, 0x47, 0x28, 0xe1, 0x2b, 0xc8, 0xe7, 0xcc,
+  0xc0, 0xf8, 0x2a, 0x04, 0xf6, 0xff, 0xf9, 0xf3, 0xb4, 0x02, 0x1f, 0xef,
+  0x48, 0xf0, 0xf1, 0x1e, 0x0b, 0xc7, 0x36, 0xbc, 0x20, 0xff, 0x60, 0xcc,
+  0x33, 0x27, 0x07, 0x37, 0x4f, 0xf3, 0x01, 0xdf, 0x01, 0xc4, 0x1c, 0x4f,
+  0x3a, 0xfa, 0xff, 0xda, 0xef, 0xfc, 0xee, 0xb5, 0xc9, 0xd9, 0xdd, 0xf6,
+  0xdd, 0xf7, 0xf9, 0xc9, 0x04, 0xb1, 0x81, 0xc1, 0x3c, 0xf8, 0x0b, 0x1d,
+  0xd7, 0x97, 0xa7, 0xf5, 0xe9, 0xeb, 0x0c, 0xcc, 0x24, 0xa4, 0x38, 0x2e,
+  0xd9, 0xef, 0xfe, 0xdc, 0x0d, 0xdb, 0xcf, 0x19, 0xee, 0x28, 0xfc, 0x48,
+  0x0f, 0xdd, 0x15, 0x00, 0xdf, 0xe7, 0x2c, 0xc4, 0x91, 0x19, 0xbc, 0xc2,
+  0xed, 0x2f, 0x07, 0xc5, 0x09, 0xc8, 0xea, 0xd0, 0xc0, 0xf4, 0x6d, 0x2d,
+  0xfc, 0x28, 0x52, 0xdc, 0xcd, 0xe2, 0x1d, 0xbd, 0xcb, 0xbe, 0x14, 0xdd,
+  0x22, 0x20, 0xca, 0x29, 0xe3, 0x19, 0x02, 0xe3, 0x85, 0xca, 0xd3, 0x02,
+  0xf4, 0xe3, 0x16, 0x2f, 0x00, 0x22, 0x19, 0xf2, 0x35, 0xfd, 0xe3, 0xef,
+  0x01, 0xcc, 0x5b, 0xfb, 0x11, 0x36, 0xf5, 0xf3, 0xfc, 0x1a, 0x03, 0xd6,
+  0xdd, 0xde, 0x27, 0x0c, 0xa6, 0xe2, 0xe0, 0xea, 0x04, 0x22, 0xb9, 0xe6,
+  0xf7, 0xdb, 0xa2, 0x17, 0xf3, 0xbb, 0x22, 0xe0, 0x40, 0xf5, 0xf9, 0xca,
+  0x1b, 0x95, 0xe8, 0x8c, 0x11, 0xe8, 0x21, 0xde, 0x81, 0xc5, 0x06, 0x04,
+  0x11, 0xc7, 0x3e, 0xe1, 0xd3, 0xaf, 0x10, 0x29, 0xe3, 0xe9, 0xd2, 0x10,
+  0xc4, 0x24, 0x0f, 0xd0, 0xb2, 0x1b, 0xd3, 0x4b, 0x14, 0x1b, 0x3c, 0x25,
+  0xe9, 0xf2, 0x25, 0x1c, 0xbb, 0x3c, 0xe2, 0x01, 0xda, 0xf0, 0x1b, 0xe8,
+  0x5d, 0x87, 0x35, 0x9f, 0xb4, 0xf0, 0x16, 0x35, 0xd3, 0x27, 0xeb, 0xd7,
+  0x93, 0x50, 0x02, 0x91, 0xf2, 0xf8, 0xe6, 0xe1, 0xeb, 0x2f, 0x30, 0xf1,
+  0x18, 0x58, 0x13, 0xa3, 0xc2, 0xf4, 0x39, 0x49, 0x6a, 0x81, 0xd4, 0x3c,
+  0x36, 0xce, 0x06, 0xbc, 0xfe, 0x3a, 0x34, 0x35, 0x23, 0x4b, 0x23, 0xef,
+  0x1a, 0xda, 0x5a, 0xe4, 0x30, 0x31, 0xd7, 0x1d, 0x47, 0xe4, 0x53, 0x3e,
+  0xa9, 0xa9, 0xb7, 0x37, 0xe8, 0x88, 0xbd, 0x57, 0x46, 0xc4, 0xae, 0x21,
+  0x37, 0xff, 0x71, 0x39, 0xdd, 0x4c, 0x11, 0xac, 0xe2, 0xf4, 0xcf, 0xea,
+  0xbd, 0xc0, 0x3a, 0xee, 0xaf, 0xe8, 0xe2, 0x5f, 0xe1, 0xd2, 0xda, 0x3a,
+  0xca, 0xfc, 0xf6, 0x5f, 0xf3, 0x0a, 0xb6, 0x2f, 0x42, 0xbe, 0xcf, 0xd9,
+  0x45, 0xea, 0x00, 0x26, 0xf5, 0xf7, 0x29, 0x60, 0x0a, 0x9e, 0xc3, 0xee,
+  0x1e, 0xcd, 0x1c, 0xff, 0x55, 0x23, 0x21, 0x26, 0x0e, 0x0d, 0x53, 0x1a,
+  0xda, 0xf6, 0x42, 0xe3, 0xef, 0x0f, 0x44, 0x1d, 0xbd, 0x30, 0xfa, 0x09,
+  0x2d, 0xf6, 0x1a, 0xdf, 0x3d, 0xfe, 0xf9, 0x37, 0xf5, 0xdc, 0xc6, 0xa6,
+  0xec, 0xe1, 0xdf, 0x1d, 0xf0, 0x22, 0x1b, 0xf5, 0xd5, 0xec, 0xd9, 0x58,
+  0xf2, 0x1d, 0xcf, 0x1e, 0x01, 0xf9, 0x6c, 0x19, 0x4f, 0x28, 0x36, 0xc9,
+  0x37, 0xda, 0xd7, 0x36, 0x19, 0x09, 0xf3, 0xf4, 0x07, 0xe7, 0x01, 0x41,
+  0x2a, 0x20, 0x22, 0x30, 0xde, 0x1c, 0x9e, 0xb8, 0xeb, 0xfe, 0x03, 0xb9,
+  0xee, 0xec, 0xf5, 0xe2, 0xd4, 0xba, 0xa4, 0xce, 0x17, 0xa5, 0x03, 0x15,
+  0xb5, 0x0f, 0x14, 0x35, 0xe9, 0x0c, 0xbd, 0xa7, 0x0b, 0x81, 0x24, 0x1f,
+  0xe0, 0x14, 0xc4, 0xbe, 0xb0, 0x1f, 0xd5, 0x0d, 0x29, 0x1c, 0x2a, 0xe7,
+  0xea, 0x19, 0x44, 0xff, 0xcd, 0xf1, 0x0c, 0x39, 0xc1, 0x09, 0xe0, 0xef,
+  0xde, 0xe8, 0x08, 0xe7, 0xe3, 0x18, 0x1c, 0xd9, 0x03, 0xca, 0x4f, 0xdf,
+  0x90, 0x16, 0xd5, 0xe8, 0xb9, 0x38, 0x25, 0xf6, 0x08, 0x10, 0x4e, 0x43,
+  0x01, 0xf4, 0x81, 0x1f, 0x00, 0x16, 0xdb, 0xd6, 0x0e, 0xa3, 0x06, 0x4f,
+  0x21, 0xe2, 0xde, 0xf1, 0x2f, 0x2c, 0x62, 0xee, 0x17, 0xe4, 0xd2, 0x2c,
+  0x3f, 0x17, 0x0f, 0x0f, 0x45, 0x4d, 0x67, 0x9b, 0x35, 0x18, 0xcb, 0x24,
+  0xf4, 0x81, 0xeb, 0x30, 0xd5, 0xd0, 0xeb, 0x51, 0x3e, 0xc5, 0x16, 0xda,
+  0x4a, 0x5d, 0xd1, 0xae, 0x2b, 0x58, 0x30, 0xf9, 0xb8, 0xd9, 0x04, 0x1c,
+  0x11, 0x08, 0xea, 0xb0, 0xca, 0xa5, 0x3e, 0xda, 0xe7, 0x13, 0xf2, 0x11,
+  0x4a, 0xd4, 0xd8, 0xf6, 0xd1, 0xec, 0xcf, 0x36, 0xf6, 0x21, 0xf6, 0xcf,
+  0xaf, 0x3a, 0x24, 0xe5, 0xf8, 0xb6, 0x03, 0x08, 0x0a, 0x22, 0x1b, 0xb3,
+  0xc7, 0xcc, 0x4a, 0xdd, 0xc8, 0x1b, 0xa8, 0x25, 0x2b, 0xc7, 0xbc, 0xe6,
+  0x0a, 0x2d, 0x13, 0xaa, 0xe0, 0x34, 0x20, 0x3b, 0xff, 0xff, 0xcf, 0xb4,
+  0x37, 0x3c, 0xdf, 0x89, 0x04, 0xff, 0xec, 0xe0, 0xc1, 0xe7, 0xb1, 0x08,
+  0x0e, 0x48, 0x3d, 0x28, 0xe0, 0xdf, 0xc2, 0xd5, 0x13, 0xc8, 0x32, 0x32,
+  0x3b, 0xe2, 0x93, 0xc3, 0x1b, 0x18, 0xf1, 0x2a, 0xee, 0xa5, 0xf2, 0xbb,
+  0xb3, 0x0a, 0x52, 0xb0, 0xfe, 0xfe, 0x4b, 0xcb, 0x01, 0xd0, 0xc7, 0x55,
+  0x1c, 0xf3, 0x07, 0x1d, 0x06, 0x06, 0xd2, 0x03, 0x18, 0xd5, 0xde, 0xdf,
+  0x1e, 0x70, 0xbd, 0xea, 0xc9, 0x81, 0xc3, 0xf0, 0x01, 0x1a, 0x0b, 0xfa,
+  0xe0, 0x16, 0x2c, 0xea, 0x06, 0x40, 0xb3, 0x29, 0x13, 0xfd, 0x42, 0xe6,
+  0xe9, 0x0a, 0xfd, 0x09, 0x4d, 0x2e, 0x30, 0x94, 0xff, 0xe2, 0xc9, 0xe2,
+  0xc6, 0xae, 0x2c, 0xe8, 0x06, 0xed, 0x09, 0x12, 0xb9, 0xb4, 0x0d, 0x10,
+  0x07, 0x1b, 0x19, 0x1a, 0x5b, 0xe7, 0xb8, 0x1c, 0xd0, 0x1e, 0x32, 0x0f,
+  0xdc, 0x3d, 0x19, 0x41, 0xcb, 0xc1, 0x51, 0xd3, 0xa3, 0xf6, 0x52, 0xe2,
+  0x0f, 0xca, 0x51, 0x34, 0x99, 0x06, 0x46, 0x98, 0x64, 0x23, 0x46, 0xb7,
+  0x3a, 0x09, 0x31, 0x45, 0x6d, 0x81, 0x07, 0x6c, 0xe4, 0xe3, 0x26, 0xfd,
+  0xe9, 0x2c, 0xb3, 0xee, 0xbb, 0xce, 0x6a, 0xce, 0xe7, 0x16, 0x65, 0xe9,
+  0x58, 0x3b, 0x9a, 0x4c, 0xc8, 0x8f, 0x14, 0xcb, 0xa5, 0x85, 0x97, 0x32,
+  0x2b, 0xc5, 0xfc, 0x39, 0x21, 0xc0, 0x0a, 0xf5, 0x0b, 0x1c, 0x43, 0xd3,
+  0x9e, 0x2c, 0x53, 0x16, 0x11, 0xb7, 0xad, 0xbb, 0x66, 0x84, 0x45, 0xf1,
+  0x96, 0xa3, 0xe6, 0x06, 0xed, 0xce, 0xe6, 0x3c, 0xec, 0xd5, 0xc9, 0x4e,
+  0xb6, 0xca, 0xb7, 0xb7, 0x1b, 0xd6, 0x39, 0xe5, 0x0d, 0x19, 0xac, 0xd8,
+  0xa5, 0xdd, 0x2d, 0xf8, 0xea, 0x10, 0x29, 0x47, 0x08, 0x23, 0xab, 0xc1,
+  0x35, 0x19, 0xd5, 0x21, 0xfe, 0xde, 0x0d, 0x12, 0xdf, 0x33, 0x0f, 0x39,
+  0x0c, 0xe5, 0x17, 0xe9, 0x09, 0x03, 0x42, 0xb4, 0x4b, 0x3a, 0x1b, 0x2c,
+  0xb3, 0x21, 0xd2, 0xe5, 0x3c, 0x7f, 0xea, 0x2e, 0x0c, 0xd0, 0xee, 0xbd,
+  0xdf, 0xfd, 0xe6, 0xfe, 0x08, 0xc3, 0xe8, 0x87, 0xf4, 0x28, 0x36, 0xcf,
+  0x91, 0xb6, 0xce, 0x0b, 0xec, 0x04, 0x23, 0x9a, 0x10, 0xe6, 0x11, 0xe6,
+  0x41, 0xfc, 0xfb, 0x47, 0x06, 0x15, 0xec, 0xf9, 0xd7, 0xe8, 0x29, 0x2a,
+  0x21, 0xf1, 0xe1, 0x17, 0x5d, 0x35, 0xf4, 0x24, 0xd8, 0x05, 0xfc, 0xbd,
+  0x07, 0x0a, 0x5b, 0x15, 0xba, 0x0d, 0x0c, 0x3b, 0x07, 0x34, 0xf1, 0x2e,
+  0x1c, 0xf9, 0x39, 0xbf, 0xb9, 0x3b, 0xda, 0x15, 0x2e, 0x2c, 0x0f, 0xf5,
+  0x00, 0xf2, 0x0e, 0x18, 0x16, 0x81, 0x0f, 0xf3, 0xf8, 0xfc, 0xe9, 0x52,
+  0xf4, 0x97, 0xf7, 0x2a, 0x04, 0xdb, 0x4a, 0xe1, 0x06, 0x5c, 0xc8, 0x25,
+  0x3b, 0x33, 0xa8, 0x1f, 0xfa, 0x28, 0xe6, 0x0d, 0x3b, 0xf9, 0x14, 0xfa,
+  0x41, 0x34, 0x0f, 0x0c, 0x63, 0xfa, 0x40, 0xdd, 0x31, 0xc8, 0x31, 0x34,
+  0xcc, 0x9c, 0x2a, 0xf5, 0x10, 0x28, 0x3a, 0xb2, 0xc9, 0x4b, 0x22, 0x3e,
+  0xd5, 0x49, 0x08, 0x09, 0xba, 0xe8, 0x1e, 0x2f, 0x18, 0x10, 0xea, 0x0e,
+  0x9f, 0x9e, 0xdb, 0x30, 0x9f, 0xf5, 0x37, 0xea, 0xc5, 0x4f, 0x1b, 0xa1,
+  0xd3, 0x57, 0x2c, 0x91, 0x12, 0x4b, 0xfe, 0xae, 0x95, 0xfd, 0x19, 0x13,
+  0x41, 0xc0, 0xf0, 0x3b, 0x10, 0x4d, 0xc7, 0xfd, 0xea, 0x55, 0x21, 0x30,
+  0xb7, 0x39, 0xb7, 0x17, 0x1a, 0x4a, 0xfa, 0xe1, 0xe4, 0x42, 0x51, 0xe0,
+  0xf3, 0x28, 0xcf, 0x09, 0x44, 0xf9, 0x15, 0x4d, 0x7f, 0xcf, 0x26, 0xff,
+  0xf6, 0x10, 0x09, 0x30, 0x0c, 0xaf, 0xf0, 0x24, 0x02, 0xe4, 0xcf, 0xf6,
+  0x38, 0xc7, 0x4a, 0xf0, 0x04, 0xc7, 0xdc, 0x28, 0xc9, 0xc5, 0x33, 0xea,
+  0xc2, 0x17, 0xfb, 0x1c, 0x9c, 0xdf, 0xc5, 0x5b, 0x1d, 0x16, 0xfe, 0xb7,
+  0x4b, 0x18, 0xb4, 0xfa, 0xdd, 0x1e, 0x64, 0x2f, 0xdc, 0x2d, 0x52, 0xbf,
+  0x1d, 0x3b, 0xf1, 0x38, 0x5c, 0xb2, 0x46, 0xc0, 0xfa, 0x6f, 0xa7, 0x37,
+  0xdd, 0xfd, 0x05, 0xe5, 0xc9, 0xcf, 0x54, 0xc5, 0xe8, 0xd1, 0x57, 0xc3,
+  0x22, 0xee, 0xda, 0xdd, 0x1e, 0x2f, 0x63, 0x0f, 0xf1, 0xdb, 0xf9, 0x1a,
+  0x31, 0x2c, 0xba, 0x3d, 0x24, 0xe3, 0xb3, 0xdb, 0xa1, 0x02, 0x6c, 0x29,
+  0x10, 0xb0, 0xe0, 0x1c, 0xf7, 0xa0, 0xc6, 0xc6, 0xae, 0xe7, 0xea, 0x24,
+  0xbe, 0x08, 0xaf, 0x62, 0x20, 0xae, 0x28, 0xc2, 0x48, 0xd8, 0xba, 0x0f,
+  0x49, 0x1a, 0x2f, 0xbf, 0xbe, 0xff, 0xfd, 0xe1, 0x9f, 0xde, 0x1e, 0xdf,
+  0x37, 0xf0, 0x26, 0x79, 0x33, 0x81, 0xff, 0x3c, 0xae, 0x14, 0x1c, 0x10,
+  0xf3, 0x35, 0xd3, 0x0b, 0xbc, 0x43, 0x22, 0x17, 0xf1, 0xe5, 0x13, 0xc6,
+  0xee, 0xc0, 0x2b, 0xbc, 0x11, 0x1c, 0xe9, 0xf8, 0xf6, 0xb9, 0x27, 0xc9,
+  0x02, 0x2b, 0xc6, 0x3b, 0xce, 0xab, 0xf8, 0x00, 0x81, 0xff, 0xdb, 0x1b,
+  0x18, 0x15, 0x31, 0x06, 0x1c, 0xbe, 0x01, 0x6c, 0x4d, 0x90, 0xec, 0xec,
+  0xf6, 0xb4, 0x03, 0xdc, 0x2c, 0x2e, 0xd9, 0xbc, 0xf3, 0x08, 0x7b, 0xfe,
+  0x1b, 0xc4, 0xf9, 0x17, 0xd2, 0xca, 0xb1, 0x67, 0xcd, 0x38, 0x1a, 0xb0,
+  0xee, 0x3b, 0xd3, 0x0f, 0xfe, 0xfe, 0xc4, 0xae, 0xed, 0x99, 0x08, 0xcb,
+  0xae, 0xc3, 0xc7, 0xa4, 0x5a, 0xf8, 0x4e, 0x17, 0x01, 0x24, 0xc9, 0x2a,
+  0x3e, 0xfa, 0xba, 0xec, 0x11, 0xda, 0x59, 0x08, 0xa5, 0x91, 0x1c, 0xd3,
+  0xc9, 0xff, 0xd7, 0xee, 0xd9, 0xd9, 0x26, 0x34, 0xcd, 0xd4, 0x13, 0xd9,
+  0xe9, 0xfe, 0x00, 0xe1, 0xd2, 0x73, 0xe4, 0xb5, 0x1e, 0x30, 0x10, 0x49,
+  0xbe, 0x26, 0x05, 0xc9, 0xd1, 0x13, 0x31, 0xfb, 0x0a, 0xef, 0x0b, 0x04,
+  0xfd, 0x19, 0x22, 0x0a, 0xf7, 0x08, 0xfc, 0x0c, 0xf0, 0x61, 0xdb, 0xf5,
+  0xf0, 0xf2, 0xf6, 0x12, 0xa2, 0x1d, 0xb1, 0xd7, 0x35, 0x08, 0x4b, 0x07,
+  0xd5, 0x0c, 0x24, 0xe8, 0x19, 0x2e, 0xa6, 0xe4, 0xe7, 0xc9, 0x58, 0xb3,
+  0x31, 0x02, 0x4a, 0x1d, 0x2e, 0xef, 0xf4, 0xfb, 0xff, 0xe0, 0x2a, 0xf1,
+  0xe8, 0x18, 0x14, 0x1e, 0xdc, 0x1e, 0xd7, 0xc0, 0xf2, 0x16, 0xec, 0xf5,
+  0xde, 0xfa, 0x02, 0xd4, 0x09, 0xb5, 0x1c, 0xb4, 0xe1, 0x92, 0xa9, 0x96,
+  0xda, 0xd4, 0xe0, 0x01, 0xad, 0xd1, 0xe7, 0x1f, 0xcb, 0xf0, 0x1d, 0xac,
+  0xc4, 0x81, 0x03, 0xd0, 0xba, 0xd6, 0xd3, 0x30, 0xf1, 0xca, 0x03, 0xf6,
+  0xdf, 0xee, 0xcc, 0x05, 0xd2, 0xfb, 0xb3, 0x0c, 0xdb, 0x02, 0xe5, 0x33,
+  0xf6, 0x01, 0xe8, 0xcf, 0xe4, 0xf4, 0xd4, 0x31, 0xd9, 0x05, 0x11, 0xc7,
+  0xc2, 0xf3, 0x54, 0x2f, 0xf9, 0xfd, 0x3e, 0x9c, 0xd7, 0x28, 0x00, 0xf9,
+  0x0b, 0xbc, 0x4f, 0xf7, 0xb4, 0x3c, 0xc8, 0xcd, 0x1b, 0x43, 0x04, 0x28,
+  0x92, 0x1a, 0xed, 0xbf, 0x58, 0xbd, 0x3a, 0x3b, 0x4c, 0x04, 0x0d, 0x01,
+  0xf2, 0xdf, 0xd8, 0x0d, 0xe2, 0x09, 0x3c, 0xc5, 0x4b, 0x53, 0x49, 0xe7,
+  0x1d, 0xf9, 0x1d, 0xeb, 0xfc, 0xb3, 0xf8, 0xdb, 0xca, 0xde, 0x28, 0x31,
+  0xd0, 0x24, 0xe7, 0x1a, 0xf1, 0xe9, 0xa5, 0xf0, 0xe9, 0x26, 0xc7, 0x12,
+  0x38, 0xa7, 0x2a, 0x04, 0xf8, 0xd0, 0xe3, 0x81, 0xe2, 0x06, 0xfb, 0x3b,
+  0xdf, 0xc1, 0xdb, 0x43, 0x47, 0xe3, 0x10, 0xd7, 0xc5, 0xf8, 0xbe, 0x21,
+  0xd2, 0xcb, 0xf2, 0xc5, 0xce, 0x06, 0xf9, 0xb5, 0xd4, 0xf5, 0x3a, 0xf3,
+  0x12, 0xd2, 0xf9, 0x05, 0xf8, 0xc7, 0x06, 0xfc, 0xf8, 0x1a, 0x05, 0xcb,
+  0x2b, 0xc6, 0x34, 0xe0, 0x07, 0x44, 0x25, 0x14, 0x09, 0xec, 0x04, 0xd6,
+  0xc9, 0xb2, 0xe4, 0x39, 0x3d, 0x2d, 0xcc, 0xff, 0xe1, 0xc5, 0xfe, 0x0c,
+  0x1f, 0xfd, 0xeb, 0x5b, 0xd2, 0xf9, 0xbb, 0x01, 0xb7, 0xaf, 0xd4, 0xbf,
+  0xbc, 0x3f, 0x09, 0x00, 0x17, 0x03, 0xe6, 0x17, 0x37, 0xf2, 0x0e, 0xd7,
+  0xb6, 0xe8, 0xf2, 0x12, 0xd3, 0x32, 0x13, 0xf4, 0xd5, 0xd1, 0x46, 0x24,
+  0x3e, 0x07, 0xf1, 0x3f, 0xfb, 0x39, 0x04, 0x69, 0x52, 0x19, 0x3b, 0xb0,
+  0xef, 0x05, 0xd4, 0x0c, 0xca, 0x34, 0xab, 0xaa, 0x1f, 0x8f, 0x36, 0xea,
+  0xd8, 0xe5, 0xcc, 0xe7, 0xe4, 0x3c, 0x3a, 0x20, 0xb8, 0x18, 0xc2, 0x27,
+  0x2b, 0x15, 0x17, 0xe6, 0xdb, 0xac, 0x08, 0xe2, 0xf4, 0x1b, 0x27, 0xfe,
+  0xe5, 0xd0, 0xc6, 0xc0, 0xd6, 0xe3, 0xdd, 0xe1, 0x23, 0xc1, 0x18, 0x2c,
+  0xcd, 0x0b, 0x44, 0xe8, 0x81, 0x0c, 0x33, 0xc1, 0x13, 0x13, 0xd1, 0xf7,
+  0x3b, 0xd3, 0xf8, 0x94, 0x08, 0xec, 0xfa, 0x00, 0xfb, 0xf9, 0xde, 0xb8,
+  0xf2, 0xff, 0xff, 0x8a, 0x3a, 0x02, 0xeb, 0xb7, 0x04, 0xd8, 0xc9, 0x24,
+  0x2f, 0x11, 0x22, 0xf4, 0xb0, 0xe0, 0x09, 0xd9, 0xfe, 0x13, 0x44, 0xe6,
+  0x38, 0x00, 0x8d, 0xa5, 0x29, 0x37, 0x0f, 0xf3, 0xfc, 0xac, 0x03, 0xf5,
+  0xca, 0xeb, 0x0d, 0xcc, 0xeb, 0xd4, 0x41, 0x0b, 0x35, 0xe5, 0x9f, 0x2a,
+  0x0f, 0x10, 0xf0, 0x0c, 0xe0, 0x3a, 0x56, 0xf1, 0x2d, 0xde, 0x17, 0x01,
+  0x21, 0x33, 0xcb, 0x14, 0xda, 0xdd, 0xa7, 0xa7, 0x0d, 0x25, 0x27, 0x90,
+  0xbd, 0xf1, 0x07, 0x32, 0x25, 0x66, 0x2c, 0x2c, 0xd8, 0xe8, 0x45, 0x81,
+  0xfd, 0xfa, 0xd6, 0x13, 0x51, 0x11, 0x37, 0xf2, 0x51, 0xe7, 0x1f, 0xcf,
+  0xcb, 0xfc, 0xf5, 0xc7, 0xf1, 0xb3, 0xf9, 0x12, 0xf0, 0xd6, 0x18, 0xec,
+  0x2b, 0x71, 0x67, 0xf0, 0x35, 0x20, 0x0d, 0xde, 0x0f, 0x2d, 0x00, 0xfe,
+  0x05, 0xa4, 0x33, 0xce, 0x16, 0xd5, 0x06, 0x43, 0x33, 0xf6, 0x2b, 0xf8,
+  0xfa, 0xf6, 0x1a, 0xe8, 0x2d, 0x2a, 0xb6, 0x1f, 0xd4, 0x1a, 0xdb, 0x02,
+  0x16, 0x12, 0x89, 0xbc, 0x1b, 0xf8, 0xec, 0xf3, 0x38, 0xf8, 0xe3, 0x27,
+  0x13, 0xce, 0xf6, 0xe1, 0xe3, 0xd0, 0x58, 0xac, 0xf3, 0x1c, 0x27, 0xf1,
+  0xe5, 0x26, 0x54, 0x24, 0xcb, 0xdd, 0x39, 0x32, 0xf2, 0xf2, 0xee, 0x2b,
+  0x02, 0x1f, 0xec, 0x33, 0x3d, 0x5b, 0xc4, 0xd3, 0x12, 0x02, 0xbd, 0x9e,
+  0x19, 0xd5, 0x2a, 0x43, 0xc5, 0xbf, 0xfe, 0xe2, 0xc3, 0xdc, 0x08, 0xc6,
+  0xd5, 0x28, 0xb4, 0x4b, 0x5a, 0xc7, 0xd8, 0xa8, 0xee, 0xe0, 0xe5, 0x9a,
+  0xea, 0x17, 0x3b, 0xc7, 0xe0, 0x28, 0x01, 0xe0, 0xbc, 0xe6, 0x0c, 0xc8,
+  0xfd, 0xf4, 0x21, 0x37, 0xf8, 0x10, 0x1b, 0x0a, 0x81, 0x28, 0x10, 0xb7,
+  0xa3, 0xbd, 0xf0, 0x07, 0xf2, 0xf5, 0xf3, 0x2d, 0x09, 0x43, 0xc1, 0x13,
+  0x19, 0x61, 0x27, 0xd9, 0x40, 0x03, 0xf8, 0x36, 0x23, 0x23, 0x18, 0xd0,
+  0xd5, 0x67, 0x1d, 0x3c, 0xbc, 0xd3, 0x39, 0xf7, 0xfd, 0x12, 0xbf, 0xbc,
+  0xec, 0x48, 0x05, 0x19, 0x2e, 0x2a, 0x1e, 0x03, 0xf6, 0x1a, 0xff, 0x3e,
+  0xde, 0x21, 0xdf, 0x42, 0x18, 0xb0, 0xc6, 0x50, 0xa9, 0x28, 0x1c, 0x0a,
+  0x07, 0x11, 0xc9, 0xee, 0x05, 0x7f, 0x21, 0xbf, 0xcd, 0x0f, 0x12, 0xf0,
+  0xcc, 0xdc, 0x41, 0xe1, 0xe0, 0xf7, 0x27, 0xde, 0x12, 0xeb, 0xfe, 0x01,
+  0x31, 0xdb, 0x5c, 0x02, 0xbd, 0xf1, 0xd0, 0xed, 0xed, 0x0d, 0xd5, 0xcd,
+  0x13, 0x04, 0x4a, 0xe4, 0x1f, 0x38, 0x11, 0xe0, 0x39, 0x26, 0x30, 0x15,
+  0x78, 0x16, 0x10, 0xc2, 0xc3, 0x3f, 0xe6, 0xee, 0x24, 0x10, 0xf5, 0x05,
+  0xbf, 0xed, 0x9e, 0xfc, 0xf9, 0x32, 0x43, 0x2e, 0xd3, 0xcf, 0x20, 0xc4,
+  0xe9, 0xef, 0x45, 0xc0, 0x8a, 0xda, 0xfd, 0x3d, 0xf2, 0xdf, 0x1c, 0xb5,
+  0x44, 0xd9, 0x0a, 0x85, 0xad, 0x28, 0xda, 0x05, 0xb0, 0xfc, 0x31, 0xf1,
+  0x16, 0x41, 0x17, 0x2a, 0x92, 0xed, 0xde, 0xf4, 0x12, 0xbb, 0x58, 0x38,
+  0xe2, 0xa7, 0xa9, 0xf2, 0xe8, 0x01, 0xe4, 0x1d, 0xa0, 0x1d, 0x4f, 0xfc,
+  0xe6, 0xfb, 0x24, 0xc0, 0xb2, 0x0a, 0x1f, 0x34, 0x48, 0xd7, 0x7f, 0x5f,
+  0x09, 0x22, 0xfc, 0x02, 0x67, 0xa7, 0xef, 0xda, 0x31, 0x08, 0x04, 0xd9,
+  0x0b, 0x0e, 0xbb, 0x17, 0x3f, 0x38, 0xe8, 0xbe, 0x0d, 0x0f, 0xd6, 0x88,
+  0xa7, 0x2f, 0x1f, 0x1f, 0xd9, 0xd4, 0xf8, 0x62, 0x3c, 0xa2, 0xea, 0xfa,
+  0xbc, 0xbb, 0xd7, 0x09, 0x0b, 0xd8, 0x06, 0x5c, 0xf9, 0xad, 0xfc, 0xf9,
+  0x89, 0x30, 0xcc, 0xda, 0xe8, 0xcd, 0xef, 0x74, 0xfb, 0xaf, 0x12, 0x0c,
+  0xee, 0x18, 0x35, 0x12, 0xe8, 0xc8, 0x19, 0x2c, 0x3c, 0x21, 0xe3, 0x1e,
+  0xee, 0x38, 0xc1, 0xda, 0x0c, 0x18, 0xf0, 0x02, 0x13, 0x2f, 0xfd, 0x22,
+  0xdb, 0x33, 0xde, 0xea, 0xd5, 0xe7, 0x11, 0xe5, 0xbe, 0xb1, 0x52, 0x1f,
+  0xe3, 0x64, 0x18, 0xda, 0xe4, 0x66, 0xed, 0x14, 0xfa, 0x29, 0xe8, 0xed,
+  0xb1, 0xe9, 0x36, 0x34, 0x3a, 0x3b, 0x16, 0x45, 0x00, 0xea, 0xd2, 0x4a,
+  0xba, 0xfa, 0xfa, 0x95, 0xbd, 0x5a, 0xf1, 0x89, 0x12, 0x7f, 0x11, 0xb0,
+  0xf8, 0x17, 0x0e, 0x29, 0x82, 0xbc, 0x35, 0xf2, 0xed, 0xab, 0x26, 0x32,
+  0x0a, 0x13, 0x0e, 0x15, 0xeb, 0x14, 0x58, 0x09, 0x02, 0x0f, 0xe8, 0x0b,
+  0x13, 0xcf, 0x20, 0xe4, 0xdc, 0x28, 0x42, 0x5d, 0xbc, 0x28, 0x29, 0xd8,
+  0x4a, 0xf9, 0xdf, 0x34, 0xeb, 0x18, 0x24, 0xeb, 0x14, 0x79, 0x1c, 0xe3,
+  0x04, 0x1e, 0xde, 0xf2, 0x1d, 0x0f, 0xf6, 0x4c, 0x0c, 0xfb, 0x33, 0x26,
+  0xe6, 0x06, 0x02, 0x19, 0x08, 0xd7, 0x25, 0xcf, 0x24, 0xb3, 0x19, 0x15,
+  0xbd, 0xed, 0xd3, 0x2f, 0x05, 0xf9, 0xdc, 0x0f, 0xc0, 0xbf, 0x16, 0x1f,
+  0x02, 0x2a, 0xe3, 0xbb, 0xf1, 0x16, 0x2b, 0x0e, 0x17, 0xa5, 0xee, 0x0e,
+  0x4c, 0xa6, 0x0f, 0xd8, 0x02, 0xe8, 0x1e, 0xe2, 0xfa, 0xfd, 0xde, 0x02,
+  0xf0, 0xef, 0x2c, 0xf2, 0x3e, 0x37, 0x1a, 0xde, 0x35, 0x10, 0xee, 0x16,
+  0x0c, 0xe1, 0xf1, 0x0a, 0xed, 0xc5, 0xd9, 0xf9, 0xfb, 0xfc, 0x0e, 0x21,
+  0x7f, 0x1c, 0x16, 0xe3, 0xee, 0x1b, 0xcb, 0x2b, 0xe5, 0xcf, 0x1b, 0x2f,
+  0xc5, 0x0a, 0xcf, 0xee, 0xec, 0xfb, 0xd9, 0x25, 0xf3, 0xe7, 0xbe, 0x0f,
+  0x15, 0xcb, 0xc5, 0x02, 0x0c, 0x06, 0x30, 0xed, 0x03, 0xf8, 0x10, 0xcc,
+  0xc6, 0xfa, 0xfc, 0xea, 0xde, 0xb4, 0x04, 0x11, 0xfd, 0xee, 0x0e, 0xc6,
+  0xd6, 0x28, 0x0c, 0x14, 0xc0, 0x0e, 0xae, 0xbb, 0xfe, 0x0c, 0x22, 0xfa,
+  0xf4, 0x00, 0xdf, 0xf2, 0x3d, 0xcb, 0xcb, 0x26, 0x0a, 0x4e, 0xf5, 0x2b,
+  0xf6, 0xeb, 0x0b, 0x32, 0x12, 0xeb, 0xff, 0x3a, 0xcc, 0xe1, 0x22, 0x06,
+  0xde, 0xa5, 0x58, 0x18, 0xd3, 0x62, 0xc8, 0xcc, 0xca, 0x16, 0x24, 0xd2,
+  0xd9, 0x09, 0xd9, 0xee, 0xc6, 0xf1, 0x1b, 0xb5, 0x1f, 0x3b, 0xef, 0x27,
+  0x53, 0x9e, 0xb4, 0x5f, 0x96, 0xbc, 0x1a, 0xa1, 0x07, 0x40, 0x35, 0xfd,
+  0x3b, 0x4e, 0xfc, 0x98, 0xd0, 0xeb, 0x25, 0xbd, 0x81, 0xc7, 0x11, 0xfa,
+  0x0c, 0xac, 0xb3, 0x02, 0x64, 0x71, 0xe1, 0x05, 0x08, 0x16, 0x29, 0x1c,
+  0x40, 0x06, 0x14, 0xdc, 0x20, 0xf2, 0x40, 0xce, 0xff, 0x16, 0xf7, 0x3b,
+  0x22, 0x05, 0xc4, 0xf6, 0x50, 0xe2, 0x0c, 0x53, 0x1c, 0xb5, 0xc1, 0xcf,
+  0x08, 0x3f, 0x43, 0xd4, 0x29, 0x36, 0xcd, 0xc2, 0x02, 0x23, 0xdb, 0xf5,
+  0x3f, 0xae, 0x1f, 0x32, 0x1d, 0xcc, 0x0c, 0xea, 0x5f, 0x27, 0xc2, 0x59,
+  0x22, 0x33, 0x8d, 0xf0, 0x5e, 0x4f, 0x4c, 0x04, 0x1e, 0xf1, 0x0b, 0x46,
+  0x31, 0x47, 0x1f, 0xef, 0xf5, 0x2c, 0x33, 0x10, 0xe2, 0xcb, 0x4b, 0x2d,
+  0xfc, 0x2d, 0xd0, 0x05, 0xf6, 0x74, 0x3b, 0xf7, 0xd9, 0x35, 0xd3, 0xd7,
+  0xa5, 0x23, 0x11, 0x15, 0xf4, 0x41, 0x82, 0x4f, 0x04, 0x8e, 0x1a, 0x14,
+  0x01, 0xf4, 0x28, 0xb7, 0xa9, 0x3c, 0x0f, 0xcb, 0x03, 0x7e, 0xcc, 0xad,
+  0xc0, 0x16, 0x34, 0xfa, 0xc1, 0xe2, 0x39, 0x38, 0x1e, 0xb6, 0x2e, 0xc5,
+  0x04, 0xd7, 0x08, 0x25, 0xf4, 0xe4, 0x7f, 0x12, 0xf7, 0x13, 0xd0, 0x3a,
+  0x0e, 0x66, 0xe6, 0xbb, 0xaa, 0x41, 0x11, 0x36, 0x2b, 0x15, 0xe3, 0x06,
+  0x33, 0x05, 0x10, 0x33, 0x59, 0xf0, 0xc5, 0x08, 0xdd, 0x35, 0xe0, 0xf4,
+  0x3e, 0xb8, 0xe8, 0x2c, 0x38, 0xe3, 0x91, 0xda, 0x2b, 0xa0, 0x7a, 0x1a,
+  0x13, 0x98, 0xe8, 0xcf, 0xaf, 0xfe, 0x2b, 0xc4, 0x15, 0xc5, 0x1a, 0x09,
+  0xc7, 0xd0, 0x63, 0x1f, 0xb3, 0xd0, 0x2b, 0x0e, 0x6c, 0xed, 0xea, 0xa6,
+  0x08, 0x7f, 0xed, 0xe3, 0x36, 0xf1, 0x09, 0x05, 0xaa, 0xe8, 0xf8, 0x04,
+  0x07, 0x97, 0xe8, 0xf6, 0xc0, 0xbb, 0x5e, 0x16, 0x1f, 0x4a, 0xcd, 0x5d,
+  0xc8, 0xeb, 0x5f, 0x02, 0x3c, 0xeb, 0x20, 0x06, 0xf7, 0x3b, 0xc9, 0xe8,
+  0xd7, 0x26, 0x32, 0x20, 0xb5, 0xaf, 0x12, 0x08, 0x32, 0xdf, 0xc0, 0x2c,
+  0x14, 0x4d, 0xcb, 0xbf, 0xdb, 0x0d, 0x4b, 0x1a, 0x1d, 0x3f, 0xef, 0xb5,
+  0xd8, 0xca, 0x8a, 0x13, 0x39, 0xa1, 0x02, 0x0a, 0xab, 0x9d, 0xe9, 0xf1,
+  0xdd, 0x8b, 0x2c, 0xd2, 0xbc, 0xce, 0xcd, 0x0f, 0x95, 0xf9, 0xcc, 0x1b,
+  0xf9, 0x42, 0x2b, 0xd5, 0xe5, 0xd1, 0x00, 0x4a, 0x18, 0x03, 0x5a, 0x03,
+  0xd0, 0xcb, 0x18, 0x38, 0x86, 0x01, 0xde, 0xbe, 0xe4, 0x22, 0x10, 0x09,
+  0xc0, 0xbe, 0x46, 0xb5, 0xb6, 0xeb, 0x06, 0x49, 0xdb, 0xbe, 0x19, 0x19,
+  0x21, 0x1c, 0x2a, 0xf0, 0xd8, 0x2f, 0xdc, 0xf3, 0x0e, 0x32, 0x5d, 0x07,
+  0x3c, 0x5b, 0xc2, 0xea, 0xed, 0xc7, 0xf2, 0xed, 0xf0, 0xf2, 0x1a, 0x05,
+  0x12, 0xd1, 0xbe, 0x1b, 0xdf, 0x09, 0x14, 0xe6, 0xb4, 0xdb, 0x5f, 0xf6,
+  0xe9, 0x03, 0x14, 0xe3, 0x16, 0xfe, 0xc8, 0x03, 0xfa, 0xd3, 0x52, 0x29,
+  0x0c, 0xcc, 0xe6, 0x1f, 0x25, 0xea, 0xce, 0xf4, 0x4c, 0x02, 0xc6, 0xee,
+  0xed, 0x3d, 0x05, 0xe3, 0x38, 0x1e, 0x05, 0x25, 0x1f, 0xd8, 0xe8, 0x0c,
+  0x03, 0xc1, 0xf5, 0x0b, 0xdb, 0x1a, 0xe7, 0xf2, 0x12, 0xb5, 0xe0, 0xb4,
+  0x15, 0xbb, 0x98, 0xc4, 0x40, 0x55, 0x13, 0x2f, 0xd8, 0xc8, 0x38, 0xd4,
+  0xe5, 0xf1, 0xba, 0x1f, 0xf4, 0xf0, 0x0e, 0x1d, 0xcd, 0xe9, 0x3f, 0xfa,
+  0x81, 0xe4, 0xf9, 0xc9, 0xcc, 0xf0, 0xd6, 0xf6, 0xd2, 0xfe, 0x09, 0x18,
+  0x34, 0xd9, 0x0e, 0xdb, 0xee, 0x58, 0x8d, 0x41, 0x3c, 0xc4, 0xe3, 0xd6,
+  0xc6, 0x08, 0xfc, 0xfb, 0x08, 0xd4, 0x04, 0x0e, 0x17, 0x44, 0x10, 0xb7,
+  0x63, 0xf3, 0x11, 0x2c, 0xab, 0xb5, 0xcd, 0x21, 0x3d, 0xf9, 0xf1, 0x09,
+  0xec, 0xe5, 0x18, 0xaa, 0x40, 0x2a, 0xf2, 0xdd, 0x7f, 0x29, 0x39, 0xc9,
+  0x3d, 0x26, 0xe1, 0xff, 0x1e, 0x08, 0xd1, 0x57, 0x20, 0xea, 0x0e, 0xdd,
+  0xde, 0xe5, 0xea, 0xd7, 0x50, 0x34, 0xe7, 0x25, 0x1f, 0x5a, 0xf4, 0xdc,
+  0xf7, 0x34, 0xcb, 0x0a, 0xd4, 0x55, 0xf2, 0x60, 0x0b, 0xd7, 0xdc, 0xd8,
+  0x23, 0xc7, 0xf3, 0xe7, 0x31, 0xf8, 0xeb, 0x27, 0xda, 0x2c, 0x32, 0xc0,
+  0xce, 0xd7, 0x11, 0x32, 0x1a, 0xd7, 0xef, 0xe8, 0xf2, 0x04, 0xf2, 0xb2,
+  0xf5, 0x08, 0xbd, 0x93, 0x17, 0x3f, 0x18, 0xd3, 0x0e, 0xae, 0xfa, 0x0b,
+  0xd1, 0xdf, 0x17, 0xd1, 0xdb, 0xc4, 0xf7, 0xfb, 0x13, 0x24, 0xf0, 0x06,
+  0x10, 0xb5, 0xfa, 0xd9, 0x34, 0x1d, 0x11, 0xe4, 0x38, 0x20, 0x31, 0x02,
+  0xfd, 0xcc, 0xd3, 0x13, 0xe2, 0x4e, 0xfc, 0xff, 0xaf, 0x20, 0xcb, 0x07,
+  0x27, 0x18, 0x4d, 0xf9, 0xd9, 0xf5, 0xf8, 0xf1, 0xe6, 0xf8, 0x4e, 0xe6,
+  0xb1, 0xaa, 0xef, 0x01, 0xa5, 0xd8, 0xe9, 0xd3, 0x04, 0xcc, 0xed, 0x21,
+  0x24, 0xd9, 0xec, 0x11, 0x1e, 0x14, 0xdc, 0xf0, 0x45, 0x18, 0x1a, 0x28,
+  0xed, 0xd0, 0x28, 0x09, 0x1d, 0x0f, 0x3b, 0xd8, 0x35, 0x15, 0x03, 0xfe,
+  0x18, 0xd6, 0x2e, 0xf0, 0x91, 0x1a, 0x0a, 0xfe, 0xe1, 0x28, 0x06, 0x29,
+  0x23, 0xe2, 0x17, 0x81, 0xea, 0x23, 0xec, 0x08, 0x2a, 0xd5, 0x04, 0xca,
+  0x2d, 0x08, 0x03, 0x2b, 0x27, 0xe2, 0xd2, 0x2e, 0x3e, 0xf6, 0xd3, 0x4f,
+  0xfa, 0xcc, 0x3e, 0xcf, 0xed, 0x17, 0x53, 0x34, 0x37, 0x16, 0x2e, 0xf7,
+  0x24, 0xf1, 0xd8, 0xcd, 0x22, 0x43, 0xdf, 0x11, 0x6b, 0x0a, 0x31, 0xce,
+  0x40, 0xda, 0x49, 0x44, 0x1e, 0xe9, 0xe9, 0xb8, 0xff, 0xfa, 0x12, 0xe3,
+  0x03, 0xb9, 0xe2, 0x24, 0x2e, 0x37, 0xd8, 0x92, 0xc3, 0x59, 0x34, 0x3e,
+  0x64, 0x39, 0xf9, 0x0c, 0xca, 0xc4, 0x37, 0xd4, 0xef, 0x31, 0xe8, 0x4f,
+  0xf3, 0x89, 0xc6, 0x40, 0xb7, 0x25, 0x05, 0xdf, 0xc2, 0x39, 0x2b, 0xc6,
+  0xf0, 0x7f, 0x38, 0xce, 0xfb, 0xe1, 0xfa, 0x0e, 0xb3, 0x2e, 0x26, 0x18,
+  0xcb, 0xd8, 0x07, 0x23, 0xf3, 0xe3, 0xed, 0x3a, 0xfe, 0x26, 0x7e, 0x05,
+  0xe5, 0x30, 0x19, 0x4e, 0x5f, 0x09, 0x35, 0xd7, 0x11, 0x40, 0x48, 0xf5,
+  0xdf, 0x05, 0x15, 0x25, 0x37, 0x1d, 0xf7, 0x0a, 0x43, 0x14, 0xed, 0x42,
+  0x00, 0x54, 0x06, 0x23, 0x47, 0xab, 0xe3, 0xf8, 0xed, 0xf9, 0xab, 0x23,
+  0x40, 0xb3, 0x46, 0x34, 0x47, 0x20, 0x18, 0x1e, 0x37, 0x5b, 0xc3, 0xf1,
+  0xd0, 0x0c, 0x9e, 0x23, 0x71, 0x2a, 0x43, 0xd5, 0x2a, 0x4c, 0xf0, 0x0c,
+  0x3b, 0x0b, 0x03, 0xb5, 0x09, 0x00, 0xd6, 0xd8, 0xc5, 0xf8, 0x46, 0x09,
+  0x45, 0x0a, 0xd7, 0x9e, 0xd6, 0x7e, 0x1e, 0xf7, 0x44, 0x21, 0x34, 0xe9,
+  0xb9, 0x1d, 0x03, 0xee, 0xbf, 0x63, 0x9a, 0xfc, 0xd2, 0x9f, 0xae, 0x65,
+  0xb1, 0xf8, 0x1a, 0xb1, 0x02, 0x2b, 0x12, 0xe0, 0xc5, 0x20, 0xfb, 0xf1,
+  0xf5, 0x25, 0x0f, 0x2f, 0xa8, 0xce, 0x35, 0x18, 0xb8, 0xbd, 0x30, 0xfd,
+  0xb9, 0x11, 0xe8, 0x46, 0xfe, 0x0b, 0x6d, 0x2e, 0xec, 0x2d, 0xdd, 0x1f,
+  0x79, 0x6a, 0xc4, 0xba, 0x25, 0x65, 0x20, 0x0e, 0xe6, 0x05, 0xad, 0xc6,
+  0xe5, 0x23, 0xec, 0x34, 0x16, 0x0c, 0x6e, 0xe1, 0xef, 0x3c, 0x29, 0x0b,
+  0x28, 0xa8, 0xc6, 0xd2, 0x23, 0xca, 0xa0, 0x29, 0x42, 0xb6, 0x7f, 0x47,
+  0x0e, 0xb2, 0xff, 0xb5, 0x17, 0x96, 0x26, 0x19, 0x10, 0xe6, 0x70, 0xf6,
+  0xca, 0xb3, 0xe5, 0xd6, 0xd0, 0x3e, 0xe0, 0xf1, 0xff, 0xec, 0x1e, 0xf6,
+  0x8d, 0xfc, 0xcd, 0xf8, 0x04, 0x4d, 0x25, 0xd2, 0xd8, 0xba, 0x25, 0x2e,
+  0x4d, 0xde, 0x2b, 0xfc, 0xe8, 0xc8, 0xf9, 0x20, 0x27, 0x54, 0xce, 0x4a,
+  0x68, 0x44, 0x42, 0x02, 0x2c, 0x13, 0x1a, 0xfd, 0xf1, 0x0e, 0x17, 0x35,
+  0x58, 0x81, 0xef, 0x21, 0x15, 0xac, 0x46, 0x43, 0x22, 0xf9, 0xd1, 0xe5,
+  0x2b, 0xaf, 0x01, 0x09, 0x00, 0x15, 0xd6, 0xf1, 0xf2, 0xb7, 0xc0, 0xb8,
+  0xe3, 0xca, 0xd2, 0xcb, 0x32, 0xfc, 0x05, 0x3a, 0x95, 0x18, 0xbd, 0x0d,
+  0x09, 0xac, 0xf0, 0xe5, 0xc8, 0xbd, 0x38, 0x1b, 0xe3, 0x09, 0xfc, 0xe8,
+  0xe2, 0xb0, 0xb3, 0xf8, 0x50, 0xd6, 0xf8, 0x57, 0x15, 0xfd, 0xce, 0xeb,
+  0x15, 0x3e, 0x1e, 0xcf, 0xd1, 0x52, 0xb8, 0x90, 0x54, 0x14, 0xe9, 0x70,
+  0x28, 0x3a, 0xab, 0x4a, 0xfe, 0x12, 0xd9, 0x21, 0x03, 0xf3, 0x69, 0x1c,
+  0xed, 0x25, 0x48, 0x71, 0xc8, 0xc8, 0xbc, 0xae, 0x54, 0xff, 0x26, 0x3a,
+  0xb6, 0xbf, 0x01, 0x34, 0xe1, 0x4c, 0xe7, 0x04, 0xe7, 0x43, 0x10, 0x27,
+  0x49, 0x0e, 0xd6, 0x2d, 0xcb, 0x54, 0x06, 0xfd, 0xfb, 0x14, 0xa8, 0xf8,
+  0xbb, 0xbd, 0xbb, 0x78, 0xda, 0x1e, 0xf5, 0xf5, 0x12, 0x0f, 0x1e, 0xaa,
+  0xae, 0x01, 0xe7, 0xe5, 0x01, 0x31, 0xcc, 0xfc, 0xe9, 0xed, 0x1b, 0x1c,
+  0xc1, 0x89, 0xf0, 0x28, 0x00, 0xfd, 0xe1, 0x24, 0x0d, 0xee, 0x23, 0x48,
+  0x32, 0x0f, 0xde, 0xe5, 0x3f, 0xea, 0xed, 0x81, 0xb7, 0x4e, 0x1a, 0x3d,
+  0xe7, 0x6d, 0x2e, 0x0c, 0x52, 0x0d, 0x26, 0x37, 0x06, 0x2a, 0x1d, 0x31,
+  0xf8, 0x72, 0xc0, 0x2c, 0x2f, 0x20, 0xf1, 0xfa, 0x44, 0xe4, 0xbb, 0xd9,
+  0x51, 0x05, 0xe8, 0xd4, 0xec, 0xbb, 0x2b, 0x14, 0xd8, 0xef, 0x35, 0xd7,
+  0x0e, 0x03, 0x57, 0x49, 0xf7, 0x57, 0xec, 0xf5, 0xf2, 0xe2, 0x46, 0xce,
+  0x36, 0x04, 0x49, 0xde, 0x01, 0xe9, 0x0f, 0x0d, 0x1d, 0x08, 0x0d, 0xe8,
+  0x02, 0x21, 0xd4, 0xff, 0x33, 0x81, 0xde, 0xf6, 0x00, 0x57, 0x25, 0xc7,
+  0x00, 0xe8, 0xb0, 0x32, 0x0a, 0xb7, 0x25, 0xd2, 0xf9, 0x3d, 0x50, 0xc2,
+  0x1d, 0x00, 0xe2, 0x18, 0xef, 0xd3, 0x2f, 0xf2, 0xfb, 0xa2, 0xd8, 0xf5,
+  0x1f, 0xdc, 0xe0, 0xf6, 0x2d, 0x1f, 0x00, 0xca, 0x05, 0xef, 0x0e, 0x2a,
+  0xb1, 0xfb, 0x25, 0xd4, 0x0f, 0xe7, 0xbe, 0xf6, 0xfd, 0xd7, 0xe4, 0x47,
+  0xaa, 0xc6, 0xd6, 0x29, 0x25, 0x9f, 0x10, 0x0e, 0xfc, 0xcb, 0xcf, 0x26,
+  0xb3, 0xc7, 0xb7, 0x12, 0x24, 0x43, 0xeb, 0x23, 0xd2, 0xd9, 0xf9, 0xca,
+  0x05, 0x1c, 0x06, 0xc6, 0x02, 0xd0, 0x22, 0x32, 0xf9, 0x02, 0x19, 0x0c,
+  0x50, 0x3a, 0xe4, 0x70, 0x26, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xe4, 0xff, 0xff, 0xff,
   0xa8, 0x08, 0x00, 0x00, 0x8d, 0x0b, 0x00, 0x00, 0xb3, 0x08, 0x00, 0x00,
   0x75, 0x0c, 0x00, 0x00, 0x8b, 0x1c, 0x00, 0x00, 0xc2, 0x04, 0x00, 0x00,
   0x71, 0xff, 0xff, 0xff, 0xdb, 0xed, 0xff, 0xff, 0x54, 0xfa, 0xff, 0xff,
@@ -4084,265 +4092,266 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x0e, 0x06, 0x00, 0x00, 0x88, 0x07, 0x00, 0x00, 0x06, 0x18, 0x00, 0x00,
   0xde, 0x59, 0x00, 0x00, 0xf3, 0xcb, 0xff, 0xff, 0x19, 0xfa, 0xff, 0xff,
   0x73, 0xff, 0xff, 0xff, 0x26, 0x0e, 0x00, 0x00, 0xdd, 0xfc, 0xff, 0xff,
-  0x9d, 0x03, 0x00, 0x00, 0xc6, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0xe7, 0xe6, 0xd3, 0xd5, 0xf8, 0x22, 0xac, 0xf6,
-  0xde, 0x15, 0xbc, 0xe3, 0xbd, 0xc9, 0xba, 0xbd, 0xdb, 0x3b, 0xad, 0x2b,
-  0x2c, 0x2f, 0x30, 0xf0, 0xbf, 0x14, 0xcb, 0x0e, 0x30, 0x1a, 0x21, 0xd4,
-  0xe8, 0xb1, 0xe7, 0x0f, 0xc7, 0x86, 0x07, 0x9d, 0x43, 0x1b, 0x23, 0xbf,
-  0xee, 0xe5, 0x2b, 0x32, 0x35, 0x21, 0x1c, 0xd5, 0xb0, 0x93, 0xe4, 0xd4,
-  0x0d, 0x81, 0x37, 0xdc, 0xe0, 0xc1, 0xa0, 0xe0, 0x3d, 0x3d, 0x36, 0x37,
-  0x37, 0x35, 0xd9, 0x30, 0x08, 0xc2, 0xfa, 0x21, 0x27, 0x1f, 0x07, 0xdd,
-  0x1e, 0xe2, 0xed, 0x02, 0x36, 0x27, 0xeb, 0x3f, 0xf6, 0x11, 0xe7, 0xce,
-  0xdf, 0x3d, 0x0c, 0x1e, 0x32, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xc0, 0xf5, 0xff, 0xff,
-  0xc5, 0x02, 0x00, 0x00, 0x4a, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00,
-  0x50, 0x9e, 0xff, 0xff, 0x54, 0x9e, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
-  0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
-  0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x2c, 0x03, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00,
-  0x34, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
-  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00,
-  0x60, 0x02, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0xc4, 0x01, 0x00, 0x00,
-  0x80, 0x01, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00,
-  0xac, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xd6, 0xfd, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x0e, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-  0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x28, 0x9f, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x72, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x64, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x1a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x56, 0xfe, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x48, 0xfe, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0xf6, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xe8, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0xda, 0xfe, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xcc, 0xfe, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x6c, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x5e, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00,
-  0x13, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x28, 0x00, 0x00, 0x00,
-  0x2c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x13, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x9d, 0x03, 0x00, 0x00, 0xb6, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xe7, 0xe6, 0xd3, 0xd5,
+  0xf8, 0x22, 0xac, 0xf6, 0xde, 0x15, 0xbc, 0xe3, 0xbd, 0xc9, 0xba, 0xbd,
+  0xdb, 0x3b, 0xad, 0x2b, 0x2c, 0x2f, 0x30, 0xf0, 0xbf, 0x14, 0xcb, 0x0e,
+  0x30, 0x1a, 0x21, 0xd4, 0xe8, 0xb1, 0xe7, 0x0f, 0xc7, 0x86, 0x07, 0x9d,
+  0x43, 0x1b, 0x23, 0xbf, 0xee, 0xe5, 0x2b, 0x32, 0x35, 0x21, 0x1c, 0xd5,
+  0xb0, 0x93, 0xe4, 0xd4, 0x0d, 0x81, 0x37, 0xdc, 0xe0, 0xc1, 0xa0, 0xe0,
+  0x3d, 0x3d, 0x36, 0x37, 0x37, 0x35, 0xd9, 0x30, 0x08, 0xc2, 0xfa, 0x21,
+  0x27, 0x1f, 0x07, 0xdd, 0x1e, 0xe2, 0xed, 0x02, 0x36, 0x27, 0xeb, 0x3f,
+  0xf6, 0x11, 0xe7, 0xce, 0xdf, 0x3d, 0x0c, 0x1e, 0x26, 0xff, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0xd2, 0x00, 0x00, 0x00, 0xc0, 0xf5, 0xff, 0xff, 0xc5, 0x02, 0x00, 0x00,
+  0x42, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x20, 0x00, 0x00, 0x00, 0x50, 0x9e, 0xff, 0xff, 0x54, 0x9e, 0xff, 0xff,
+  0x0f, 0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00,
+  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x2c, 0x03, 0x00, 0x00,
+  0x30, 0x03, 0x00, 0x00, 0x34, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0xc4, 0x02, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00,
+  0xc4, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00,
+  0xf4, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xd6, 0xfd, 0xff, 0xff,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f,
   0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x70, 0x5e, 0x00, 0x00,
-  0x10, 0x5e, 0x00, 0x00, 0x84, 0x5d, 0x00, 0x00, 0x20, 0x5d, 0x00, 0x00,
-  0x2c, 0x5b, 0x00, 0x00, 0x48, 0x59, 0x00, 0x00, 0xbc, 0x52, 0x00, 0x00,
-  0x48, 0x4c, 0x00, 0x00, 0xe4, 0x45, 0x00, 0x00, 0x6c, 0x3f, 0x00, 0x00,
-  0xfc, 0x38, 0x00, 0x00, 0x98, 0x32, 0x00, 0x00, 0x34, 0x2c, 0x00, 0x00,
-  0xd0, 0x25, 0x00, 0x00, 0x6c, 0x1f, 0x00, 0x00, 0xf4, 0x18, 0x00, 0x00,
-  0x84, 0x12, 0x00, 0x00, 0x20, 0x0c, 0x00, 0x00, 0xdc, 0x09, 0x00, 0x00,
-  0x84, 0x07, 0x00, 0x00, 0xec, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-  0x6c, 0x05, 0x00, 0x00, 0x78, 0x04, 0x00, 0x00, 0xe4, 0x03, 0x00, 0x00,
-  0xf0, 0x02, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00,
-  0x0c, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x22, 0xa2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x04, 0xa2, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x80, 0x3b, 0x19, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f,
-  0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x3a, 0x30, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x9a, 0xa2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x7c, 0xa2, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x72, 0x5c, 0x24, 0x3e, 0x26, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f,
-  0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
-  0x64, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x22, 0xa3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x1d, 0x00, 0x00, 0x00, 0x0e, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x28, 0x9f, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x72, 0xfe, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x64, 0xfe, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x56, 0xfe, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x48, 0xfe, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xf6, 0xfe, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe8, 0xfe, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0xda, 0xfe, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xcc, 0xfe, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6c, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x50, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x2c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x14, 0x00, 0x13, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x28, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00,
+  0x13, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+  0x70, 0x5e, 0x00, 0x00, 0x10, 0x5e, 0x00, 0x00, 0x84, 0x5d, 0x00, 0x00,
+  0x20, 0x5d, 0x00, 0x00, 0x2c, 0x5b, 0x00, 0x00, 0x48, 0x59, 0x00, 0x00,
+  0xbc, 0x52, 0x00, 0x00, 0x48, 0x4c, 0x00, 0x00, 0xe4, 0x45, 0x00, 0x00,
+  0x6c, 0x3f, 0x00, 0x00, 0xfc, 0x38, 0x00, 0x00, 0x98, 0x32, 0x00, 0x00,
+  0x34, 0x2c, 0x00, 0x00, 0xd0, 0x25, 0x00, 0x00, 0x6c, 0x1f, 0x00, 0x00,
+  0xf4, 0x18, 0x00, 0x00, 0x84, 0x12, 0x00, 0x00, 0x20, 0x0c, 0x00, 0x00,
+  0xdc, 0x09, 0x00, 0x00, 0x84, 0x07, 0x00, 0x00, 0xec, 0x06, 0x00, 0x00,
+  0x00, 0x06, 0x00, 0x00, 0x6c, 0x05, 0x00, 0x00, 0x78, 0x04, 0x00, 0x00,
+  0xe4, 0x03, 0x00, 0x00, 0xf0, 0x02, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00,
+  0x88, 0x01, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x22, 0xa2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
+  0x04, 0xa2, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3b, 0x19, 0x00, 0x00, 0x00,
+  0x53, 0x74, 0x61, 0x74, 0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74,
+  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x3a,
+  0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x9a, 0xa2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
   0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00,
-  0x04, 0xa3, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
+  0x7c, 0xa2, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x72, 0x5c, 0x24, 0x3e,
+  0x26, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
+  0x6e, 0x73, 0x65, 0x2f, 0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x6d,
+  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x42,
+  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x22, 0xa3, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x50, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0xa3, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x31, 0xe2, 0xd9, 0x3c, 0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x2f, 0x52, 0x65,
+  0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x9a, 0xa3, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x98, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x84, 0xa3, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0xe2, 0xd9, 0x3c,
-  0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x66, 0x6c,
-  0x61, 0x74, 0x74, 0x65, 0x6e, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70,
-  0x65, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x9a, 0xa3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x98, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x31, 0xe2, 0xd9, 0x3c, 0x5a, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x33, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f,
+  0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x5f, 0x33, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74,
+  0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64,
+  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f,
+  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x62, 0xa4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x68, 0x00, 0x00, 0x00,
   0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x84, 0xa3, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x31, 0xe2, 0xd9, 0x3c, 0x5a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x4c, 0xa4, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x38, 0x6f, 0xbc, 0x3c, 0x24, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
+  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33,
+  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x32, 0x31,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0xfa, 0xa4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xc0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0xe4, 0xa4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x6b, 0x92, 0xab, 0x3c, 0x7d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
   0x6c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x33, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
+  0x5f, 0x32, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
   0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d,
-  0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x33, 0x2f,
+  0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x32, 0x2f,
   0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f,
-  0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x62, 0xa4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x68, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0x4c, 0xa4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x38, 0x6f, 0xbc, 0x3c, 0x24, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x32, 0x31, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xfa, 0xa4, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xc0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64,
+  0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e,
+  0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
+  0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
+  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
+  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0xe4, 0xa4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6b, 0x92, 0xab, 0x3c,
-  0x7d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x61, 0x63,
-  0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x32, 0x2f, 0x52,
-  0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61,
-  0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x32, 0x2f, 0x46, 0x75, 0x73, 0x65,
-  0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x33, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x32, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xea, 0xa5, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x60, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xea, 0xa5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0xd4, 0xa5, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x33, 0x09, 0x69, 0x3c,
+  0x23, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
+  0x32, 0x64, 0x5f, 0x32, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
+  0x73, 0x65, 0x31, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0xd4, 0xa5, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x33, 0x09, 0x69, 0x3c, 0x23, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x31, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x7a, 0xa6, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xc0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x7a, 0xa6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xc0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x64, 0xa6, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x4d, 0xcf, 0xad, 0x3c, 0x7d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d,
+  0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f,
+  0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f,
+  0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64,
+  0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e,
+  0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
+  0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
+  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
+  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x64, 0xa6, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x4d, 0xcf, 0xad, 0x3c,
-  0x7d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x61, 0x63,
-  0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f, 0x52,
-  0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61,
-  0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f, 0x46, 0x75, 0x73, 0x65,
+  0x6a, 0xa7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x54, 0xa7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x67, 0xd8, 0x3b,
+  0x23, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
+  0x32, 0x64, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
+  0x73, 0x65, 0x31, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0xfa, 0xa7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xb8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0xe4, 0xa7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x4b, 0x43, 0x80, 0x3c, 0x77, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f,
+  0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c,
+  0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x46, 0x75, 0x73, 0x65,
   0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33,
   0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
   0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
   0x33, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b,
   0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x6a, 0xa7, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x60, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x54, 0xa7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x0f, 0x67, 0xd8, 0x3b, 0x23, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x31, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xfa, 0xa7, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xb8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0xe4, 0xa7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x4b, 0x43, 0x80, 0x3c,
-  0x77, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x61, 0x63,
-  0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x52, 0x65, 0x6c,
-  0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63,
-  0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74,
-  0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
-  0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x43, 0x6f, 0x6e,
-  0x76, 0x32, 0x44, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0xe2, 0xa8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x64, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0xcc, 0xa8, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x7a, 0xcb, 0x03, 0x3b, 0x21, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x77, 0x69, 0x73, 0x65, 0x32, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x04, 0x00, 0x00, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0xd2, 0xa9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x28, 0x02, 0x00, 0x00, 0xfa, 0xb4, 0xff, 0xff,
-  0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x4c, 0x01, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0xe2, 0xa8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x64, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xcc, 0xa8, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x7a, 0xcb, 0x03, 0x3b, 0x21, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
+  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x64,
+  0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x32, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xd2, 0xa9, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x28, 0x02, 0x00, 0x00,
+  0xfa, 0xb4, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x4c, 0x01, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4369,29 +4378,29 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x58, 0x65, 0xa4, 0x3a,
-  0xe0, 0x7a, 0x81, 0x3a, 0x13, 0xec, 0x1a, 0x3b, 0x67, 0x0e, 0x13, 0x3b,
-  0x33, 0x13, 0xea, 0x3a, 0x85, 0x9f, 0x95, 0x3a, 0xa2, 0xe1, 0xe5, 0x3a,
-  0xd7, 0x9d, 0x04, 0x3b, 0x42, 0xbc, 0x09, 0x3b, 0xed, 0x87, 0xb0, 0x3a,
-  0x06, 0x55, 0x03, 0x3b, 0xeb, 0x53, 0x17, 0x3b, 0x75, 0x18, 0xe4, 0x3a,
-  0x57, 0x05, 0x17, 0x3b, 0xb2, 0x32, 0xcb, 0x3a, 0x2e, 0xce, 0x71, 0x3a,
-  0xb9, 0x51, 0xf6, 0x3a, 0x8a, 0x97, 0xe0, 0x3a, 0x87, 0x15, 0x07, 0x3b,
-  0x99, 0xf2, 0xfe, 0x3a, 0x2d, 0x3a, 0xdf, 0x3a, 0xf7, 0x5a, 0xb9, 0x3a,
-  0xd7, 0x62, 0xd4, 0x3a, 0x17, 0x51, 0xc8, 0x3a, 0x02, 0xf5, 0xb2, 0x3a,
-  0x98, 0xa6, 0xbc, 0x3a, 0x1d, 0x4e, 0xaf, 0x3a, 0x48, 0x92, 0xb0, 0x3a,
-  0x2d, 0xe5, 0xab, 0x3a, 0x09, 0x90, 0x92, 0x3a, 0x53, 0x94, 0x09, 0x3b,
-  0xa5, 0x17, 0xc0, 0x3a, 0xe0, 0x1d, 0xa5, 0x3a, 0xc2, 0xe6, 0xc9, 0x3a,
-  0x55, 0x10, 0x80, 0x3a, 0x2a, 0xa6, 0x25, 0x3a, 0x22, 0xb8, 0xfa, 0x3a,
-  0x96, 0xfd, 0x98, 0x3a, 0xb0, 0xf3, 0x58, 0x3a, 0x73, 0x1b, 0xcb, 0x3a,
-  0x21, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
-  0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x26, 0xac, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x04, 0x02, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x20, 0x02, 0x00, 0x00, 0x9c, 0xab, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x48, 0x01, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x58, 0x65, 0xa4, 0x3a, 0xe0, 0x7a, 0x81, 0x3a, 0x13, 0xec, 0x1a, 0x3b,
+  0x67, 0x0e, 0x13, 0x3b, 0x33, 0x13, 0xea, 0x3a, 0x85, 0x9f, 0x95, 0x3a,
+  0xa2, 0xe1, 0xe5, 0x3a, 0xd7, 0x9d, 0x04, 0x3b, 0x42, 0xbc, 0x09, 0x3b,
+  0xed, 0x87, 0xb0, 0x3a, 0x06, 0x55, 0x03, 0x3b, 0xeb, 0x53, 0x17, 0x3b,
+  0x75, 0x18, 0xe4, 0x3a, 0x57, 0x05, 0x17, 0x3b, 0xb2, 0x32, 0xcb, 0x3a,
+  0x2e, 0xce, 0x71, 0x3a, 0xb9, 0x51, 0xf6, 0x3a, 0x8a, 0x97, 0xe0, 0x3a,
+  0x87, 0x15, 0x07, 0x3b, 0x99, 0xf2, 0xfe, 0x3a, 0x2d, 0x3a, 0xdf, 0x3a,
+  0xf7, 0x5a, 0xb9, 0x3a, 0xd7, 0x62, 0xd4, 0x3a, 0x17, 0x51, 0xc8, 0x3a,
+  0x02, 0xf5, 0xb2, 0x3a, 0x98, 0xa6, 0xbc, 0x3a, 0x1d, 0x4e, 0xaf, 0x3a,
+  0x48, 0x92, 0xb0, 0x3a, 0x2d, 0xe5, 0xab, 0x3a, 0x09, 0x90, 0x92, 0x3a,
+  0x53, 0x94, 0x09, 0x3b, 0xa5, 0x17, 0xc0, 0x3a, 0xe0, 0x1d, 0xa5, 0x3a,
+  0xc2, 0xe6, 0xc9, 0x3a, 0x55, 0x10, 0x80, 0x3a, 0x2a, 0xa6, 0x25, 0x3a,
+  0x22, 0xb8, 0xfa, 0x3a, 0x96, 0xfd, 0x98, 0x3a, 0xb0, 0xf3, 0x58, 0x3a,
+  0x73, 0x1b, 0xcb, 0x3a, 0x21, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
+  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
+  0x77, 0x69, 0x73, 0x65, 0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x26, 0xac, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x20, 0x02, 0x00, 0x00, 0x9c, 0xab, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4418,28 +4427,28 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x78, 0xc2, 0x9b, 0x36,
-  0x22, 0x5b, 0x75, 0x36, 0x9c, 0xc8, 0x12, 0x37, 0xb8, 0x54, 0x0b, 0x37,
-  0x40, 0xc7, 0xdd, 0x36, 0x51, 0xc3, 0x8d, 0x36, 0x14, 0xce, 0xd9, 0x36,
-  0xb3, 0x4c, 0xfb, 0x36, 0xed, 0x7f, 0x02, 0x37, 0xdb, 0x41, 0xa7, 0x36,
-  0x9d, 0xdd, 0xf8, 0x36, 0xca, 0x60, 0x0f, 0x37, 0xec, 0x1c, 0xd8, 0x36,
-  0x57, 0x16, 0x0f, 0x37, 0xfe, 0x85, 0xc0, 0x36, 0x44, 0x1a, 0x65, 0x36,
-  0x1b, 0x61, 0xe9, 0x36, 0x1f, 0xcb, 0xd4, 0x36, 0xb5, 0xf9, 0xff, 0x36,
-  0xf1, 0x8d, 0xf1, 0x36, 0x1c, 0x80, 0xd3, 0x36, 0x38, 0x9e, 0xaf, 0x36,
-  0x92, 0x3a, 0xc9, 0x36, 0x23, 0xcb, 0xbd, 0x36, 0x4f, 0x8e, 0xa9, 0x36,
-  0x88, 0xbd, 0xb2, 0x36, 0x87, 0x18, 0xa6, 0x36, 0xaa, 0x4b, 0xa7, 0x36,
-  0x73, 0xdd, 0xa2, 0x36, 0xfe, 0xdc, 0x8a, 0x36, 0x17, 0x5a, 0x02, 0x37,
-  0x4c, 0x00, 0xb6, 0x36, 0x4f, 0x71, 0x9c, 0x36, 0x7e, 0x4b, 0xbf, 0x36,
-  0x24, 0xac, 0x72, 0x36, 0x70, 0xf2, 0x1c, 0x36, 0x58, 0x8c, 0xed, 0x36,
-  0x19, 0xf4, 0x90, 0x36, 0x04, 0x8e, 0x4d, 0x36, 0xf8, 0x6f, 0xc0, 0x36,
-  0x20, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x66, 0xae, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x28, 0x06, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x34, 0x06, 0x00, 0x00, 0xdc, 0xad, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x0c, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x78, 0xc2, 0x9b, 0x36, 0x22, 0x5b, 0x75, 0x36, 0x9c, 0xc8, 0x12, 0x37,
+  0xb8, 0x54, 0x0b, 0x37, 0x40, 0xc7, 0xdd, 0x36, 0x51, 0xc3, 0x8d, 0x36,
+  0x14, 0xce, 0xd9, 0x36, 0xb3, 0x4c, 0xfb, 0x36, 0xed, 0x7f, 0x02, 0x37,
+  0xdb, 0x41, 0xa7, 0x36, 0x9d, 0xdd, 0xf8, 0x36, 0xca, 0x60, 0x0f, 0x37,
+  0xec, 0x1c, 0xd8, 0x36, 0x57, 0x16, 0x0f, 0x37, 0xfe, 0x85, 0xc0, 0x36,
+  0x44, 0x1a, 0x65, 0x36, 0x1b, 0x61, 0xe9, 0x36, 0x1f, 0xcb, 0xd4, 0x36,
+  0xb5, 0xf9, 0xff, 0x36, 0xf1, 0x8d, 0xf1, 0x36, 0x1c, 0x80, 0xd3, 0x36,
+  0x38, 0x9e, 0xaf, 0x36, 0x92, 0x3a, 0xc9, 0x36, 0x23, 0xcb, 0xbd, 0x36,
+  0x4f, 0x8e, 0xa9, 0x36, 0x88, 0xbd, 0xb2, 0x36, 0x87, 0x18, 0xa6, 0x36,
+  0xaa, 0x4b, 0xa7, 0x36, 0x73, 0xdd, 0xa2, 0x36, 0xfe, 0xdc, 0x8a, 0x36,
+  0x17, 0x5a, 0x02, 0x37, 0x4c, 0x00, 0xb6, 0x36, 0x4f, 0x71, 0x9c, 0x36,
+  0x7e, 0x4b, 0xbf, 0x36, 0x24, 0xac, 0x72, 0x36, 0x70, 0xf2, 0x1c, 0x36,
+  0x58, 0x8c, 0xed, 0x36, 0x19, 0xf4, 0x90, 0x36, 0x04, 0x8e, 0x4d, 0x36,
+  0xf8, 0x6f, 0xc0, 0x36, 0x20, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
+  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
+  0x77, 0x69, 0x73, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x66, 0xae, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x28, 0x06, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x34, 0x06, 0x00, 0x00, 0xdc, 0xad, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4525,57 +4534,57 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xf2, 0x4b, 0x64, 0x3d,
-  0xe3, 0x8b, 0x8f, 0x3d, 0x6a, 0xc4, 0x95, 0x3d, 0x5f, 0xfe, 0x99, 0x3d,
-  0x29, 0x26, 0x8b, 0x3d, 0x35, 0x43, 0x2c, 0x3d, 0xe5, 0x58, 0x66, 0x3d,
-  0xb3, 0xb2, 0x54, 0x3d, 0x5f, 0x20, 0x8c, 0x3d, 0xcc, 0x1d, 0x7e, 0x3d,
-  0x02, 0xb2, 0xa5, 0x3d, 0xa1, 0xef, 0xab, 0x3d, 0x7e, 0x0a, 0x61, 0x3d,
-  0x0e, 0xf5, 0xac, 0x3d, 0x75, 0xe1, 0x3e, 0x3d, 0xd2, 0x41, 0xca, 0x3d,
-  0x88, 0x57, 0x87, 0x3d, 0xbf, 0x20, 0x7f, 0x3d, 0xdd, 0x01, 0x24, 0x3d,
-  0x7e, 0xc9, 0x9c, 0x3d, 0xf6, 0x6f, 0x4b, 0x3d, 0xac, 0xe8, 0xae, 0x3d,
-  0x57, 0xd0, 0x88, 0x3d, 0x6b, 0x04, 0x79, 0x3d, 0x7b, 0x3a, 0x77, 0x3d,
-  0x2f, 0x14, 0xcb, 0x3d, 0x7a, 0x2b, 0x78, 0x3d, 0x02, 0x36, 0x5a, 0x3d,
-  0x0b, 0x8f, 0x1b, 0x3d, 0x2b, 0x56, 0x14, 0x3d, 0x79, 0x79, 0x89, 0x3d,
-  0xa6, 0x2f, 0x35, 0x3d, 0xb0, 0x83, 0x5c, 0x3d, 0x1e, 0x0f, 0x80, 0x3d,
-  0xbe, 0xb6, 0x9a, 0x3d, 0x82, 0x7b, 0xab, 0x3d, 0xd9, 0x4e, 0x93, 0x3d,
-  0xcb, 0x68, 0xa2, 0x3d, 0x8d, 0x5b, 0x81, 0x3d, 0x7a, 0x2c, 0x92, 0x3d,
-  0x7e, 0x54, 0x8b, 0x3d, 0x2f, 0x13, 0x91, 0x3d, 0x15, 0x27, 0x79, 0x3d,
-  0xb0, 0xe6, 0x46, 0x3d, 0xb9, 0xcd, 0x94, 0x3d, 0xce, 0x6d, 0x67, 0x3d,
-  0x5b, 0x06, 0x7a, 0x3d, 0x9f, 0xf9, 0x86, 0x3d, 0x47, 0xc0, 0x54, 0x3d,
-  0xf4, 0xd7, 0x96, 0x3d, 0x75, 0x55, 0x8e, 0x3d, 0xd2, 0x67, 0x98, 0x3d,
-  0x9d, 0x6e, 0xa9, 0x3d, 0xff, 0x54, 0x5c, 0x3d, 0x92, 0xb8, 0x53, 0x3d,
-  0x49, 0x0e, 0x39, 0x3d, 0x55, 0x48, 0x8b, 0x3d, 0xb3, 0xe8, 0x93, 0x3d,
-  0x6d, 0x77, 0xf2, 0x3c, 0x8f, 0x8c, 0x36, 0x3d, 0xc1, 0x65, 0xaa, 0x3d,
-  0xff, 0x9b, 0x6a, 0x3d, 0x05, 0x97, 0x5b, 0x3d, 0x28, 0x48, 0x5f, 0x3d,
-  0x49, 0xa3, 0x61, 0x3d, 0x49, 0x2f, 0x77, 0x3d, 0x7f, 0x84, 0x9b, 0x3d,
-  0x33, 0x20, 0x5a, 0x3d, 0x04, 0x00, 0x9d, 0x3d, 0x03, 0xb6, 0x84, 0x3d,
-  0xc9, 0x2d, 0xa3, 0x3d, 0x82, 0x76, 0x86, 0x3d, 0x54, 0x79, 0x6b, 0x3d,
-  0x89, 0x7e, 0x64, 0x3d, 0x69, 0xe7, 0x46, 0x3d, 0x75, 0x47, 0x7d, 0x3d,
-  0xae, 0x22, 0x66, 0x3d, 0xf1, 0xfc, 0x8b, 0x3d, 0x4a, 0x7b, 0xa3, 0x3d,
-  0xb4, 0x09, 0x52, 0x3d, 0xd0, 0x1a, 0x88, 0x3d, 0xbf, 0x17, 0x72, 0x3d,
-  0xa9, 0x99, 0x9b, 0x3d, 0xf8, 0x0e, 0x36, 0x3d, 0x5b, 0xf3, 0x43, 0x3d,
-  0x32, 0xa7, 0x73, 0x3d, 0x2a, 0x0c, 0x08, 0x3d, 0xab, 0x51, 0x8d, 0x3d,
-  0xfe, 0xdc, 0x69, 0x3d, 0xa6, 0x61, 0x6e, 0x3d, 0x6a, 0x6e, 0x6e, 0x3d,
-  0x24, 0xde, 0x74, 0x3d, 0x8e, 0x1c, 0xa0, 0x3d, 0x77, 0x23, 0x4d, 0x3d,
-  0x70, 0xe0, 0x90, 0x3d, 0x6f, 0xed, 0x5b, 0x3d, 0xb2, 0x1c, 0x7b, 0x3d,
-  0x94, 0xfb, 0x26, 0x3d, 0x85, 0xbf, 0xaa, 0x3d, 0x2c, 0x91, 0x5b, 0x3d,
-  0x39, 0xff, 0x8f, 0x3d, 0xd8, 0x7c, 0x7b, 0x3d, 0xd1, 0xbb, 0x38, 0x3d,
-  0xf3, 0x62, 0x92, 0x3d, 0x21, 0xb9, 0x6b, 0x3d, 0x2e, 0x5f, 0x73, 0x3d,
-  0x77, 0xdd, 0x6e, 0x3d, 0x0e, 0xa6, 0x9a, 0x3d, 0x6a, 0xaf, 0x81, 0x3d,
-  0x68, 0x53, 0x84, 0x3d, 0xad, 0x25, 0x7b, 0x3d, 0x23, 0x69, 0x64, 0x3d,
-  0x3d, 0x05, 0xa1, 0x3d, 0xe4, 0x2a, 0x85, 0x3d, 0xd7, 0xf8, 0x85, 0x3d,
-  0x61, 0xea, 0x56, 0x3d, 0x39, 0x4c, 0x51, 0x3d, 0x10, 0xd3, 0x82, 0x3d,
-  0xda, 0x74, 0x2e, 0x3d, 0x90, 0xcc, 0x47, 0x3d, 0x5a, 0xc3, 0x6e, 0x3d,
-  0x43, 0x81, 0xae, 0x3d, 0xb8, 0x7e, 0x74, 0x3d, 0xd7, 0x0a, 0x93, 0x3d,
-  0xa9, 0x48, 0x90, 0x3d, 0xfb, 0x74, 0x8d, 0x3d, 0xe1, 0x0b, 0xa6, 0x3d,
-  0x83, 0x8e, 0x66, 0x3d, 0x13, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x43, 0x6f, 0x6e,
-  0x76, 0x32, 0x44, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0xc6, 0xb4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x28, 0x06, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x4c, 0x06, 0x00, 0x00, 0x3c, 0xb4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x0c, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0xf2, 0x4b, 0x64, 0x3d, 0xe3, 0x8b, 0x8f, 0x3d, 0x6a, 0xc4, 0x95, 0x3d,
+  0x5f, 0xfe, 0x99, 0x3d, 0x29, 0x26, 0x8b, 0x3d, 0x35, 0x43, 0x2c, 0x3d,
+  0xe5, 0x58, 0x66, 0x3d, 0xb3, 0xb2, 0x54, 0x3d, 0x5f, 0x20, 0x8c, 0x3d,
+  0xcc, 0x1d, 0x7e, 0x3d, 0x02, 0xb2, 0xa5, 0x3d, 0xa1, 0xef, 0xab, 0x3d,
+  0x7e, 0x0a, 0x61, 0x3d, 0x0e, 0xf5, 0xac, 0x3d, 0x75, 0xe1, 0x3e, 0x3d,
+  0xd2, 0x41, 0xca, 0x3d, 0x88, 0x57, 0x87, 0x3d, 0xbf, 0x20, 0x7f, 0x3d,
+  0xdd, 0x01, 0x24, 0x3d, 0x7e, 0xc9, 0x9c, 0x3d, 0xf6, 0x6f, 0x4b, 0x3d,
+  0xac, 0xe8, 0xae, 0x3d, 0x57, 0xd0, 0x88, 0x3d, 0x6b, 0x04, 0x79, 0x3d,
+  0x7b, 0x3a, 0x77, 0x3d, 0x2f, 0x14, 0xcb, 0x3d, 0x7a, 0x2b, 0x78, 0x3d,
+  0x02, 0x36, 0x5a, 0x3d, 0x0b, 0x8f, 0x1b, 0x3d, 0x2b, 0x56, 0x14, 0x3d,
+  0x79, 0x79, 0x89, 0x3d, 0xa6, 0x2f, 0x35, 0x3d, 0xb0, 0x83, 0x5c, 0x3d,
+  0x1e, 0x0f, 0x80, 0x3d, 0xbe, 0xb6, 0x9a, 0x3d, 0x82, 0x7b, 0xab, 0x3d,
+  0xd9, 0x4e, 0x93, 0x3d, 0xcb, 0x68, 0xa2, 0x3d, 0x8d, 0x5b, 0x81, 0x3d,
+  0x7a, 0x2c, 0x92, 0x3d, 0x7e, 0x54, 0x8b, 0x3d, 0x2f, 0x13, 0x91, 0x3d,
+  0x15, 0x27, 0x79, 0x3d, 0xb0, 0xe6, 0x46, 0x3d, 0xb9, 0xcd, 0x94, 0x3d,
+  0xce, 0x6d, 0x67, 0x3d, 0x5b, 0x06, 0x7a, 0x3d, 0x9f, 0xf9, 0x86, 0x3d,
+  0x47, 0xc0, 0x54, 0x3d, 0xf4, 0xd7, 0x96, 0x3d, 0x75, 0x55, 0x8e, 0x3d,
+  0xd2, 0x67, 0x98, 0x3d, 0x9d, 0x6e, 0xa9, 0x3d, 0xff, 0x54, 0x5c, 0x3d,
+  0x92, 0xb8, 0x53, 0x3d, 0x49, 0x0e, 0x39, 0x3d, 0x55, 0x48, 0x8b, 0x3d,
+  0xb3, 0xe8, 0x93, 0x3d, 0x6d, 0x77, 0xf2, 0x3c, 0x8f, 0x8c, 0x36, 0x3d,
+  0xc1, 0x65, 0xaa, 0x3d, 0xff, 0x9b, 0x6a, 0x3d, 0x05, 0x97, 0x5b, 0x3d,
+  0x28, 0x48, 0x5f, 0x3d, 0x49, 0xa3, 0x61, 0x3d, 0x49, 0x2f, 0x77, 0x3d,
+  0x7f, 0x84, 0x9b, 0x3d, 0x33, 0x20, 0x5a, 0x3d, 0x04, 0x00, 0x9d, 0x3d,
+  0x03, 0xb6, 0x84, 0x3d, 0xc9, 0x2d, 0xa3, 0x3d, 0x82, 0x76, 0x86, 0x3d,
+  0x54, 0x79, 0x6b, 0x3d, 0x89, 0x7e, 0x64, 0x3d, 0x69, 0xe7, 0x46, 0x3d,
+  0x75, 0x47, 0x7d, 0x3d, 0xae, 0x22, 0x66, 0x3d, 0xf1, 0xfc, 0x8b, 0x3d,
+  0x4a, 0x7b, 0xa3, 0x3d, 0xb4, 0x09, 0x52, 0x3d, 0xd0, 0x1a, 0x88, 0x3d,
+  0xbf, 0x17, 0x72, 0x3d, 0xa9, 0x99, 0x9b, 0x3d, 0xf8, 0x0e, 0x36, 0x3d,
+  0x5b, 0xf3, 0x43, 0x3d, 0x32, 0xa7, 0x73, 0x3d, 0x2a, 0x0c, 0x08, 0x3d,
+  0xab, 0x51, 0x8d, 0x3d, 0xfe, 0xdc, 0x69, 0x3d, 0xa6, 0x61, 0x6e, 0x3d,
+  0x6a, 0x6e, 0x6e, 0x3d, 0x24, 0xde, 0x74, 0x3d, 0x8e, 0x1c, 0xa0, 0x3d,
+  0x77, 0x23, 0x4d, 0x3d, 0x70, 0xe0, 0x90, 0x3d, 0x6f, 0xed, 0x5b, 0x3d,
+  0xb2, 0x1c, 0x7b, 0x3d, 0x94, 0xfb, 0x26, 0x3d, 0x85, 0xbf, 0xaa, 0x3d,
+  0x2c, 0x91, 0x5b, 0x3d, 0x39, 0xff, 0x8f, 0x3d, 0xd8, 0x7c, 0x7b, 0x3d,
+  0xd1, 0xbb, 0x38, 0x3d, 0xf3, 0x62, 0x92, 0x3d, 0x21, 0xb9, 0x6b, 0x3d,
+  0x2e, 0x5f, 0x73, 0x3d, 0x77, 0xdd, 0x6e, 0x3d, 0x0e, 0xa6, 0x9a, 0x3d,
+  0x6a, 0xaf, 0x81, 0x3d, 0x68, 0x53, 0x84, 0x3d, 0xad, 0x25, 0x7b, 0x3d,
+  0x23, 0x69, 0x64, 0x3d, 0x3d, 0x05, 0xa1, 0x3d, 0xe4, 0x2a, 0x85, 0x3d,
+  0xd7, 0xf8, 0x85, 0x3d, 0x61, 0xea, 0x56, 0x3d, 0x39, 0x4c, 0x51, 0x3d,
+  0x10, 0xd3, 0x82, 0x3d, 0xda, 0x74, 0x2e, 0x3d, 0x90, 0xcc, 0x47, 0x3d,
+  0x5a, 0xc3, 0x6e, 0x3d, 0x43, 0x81, 0xae, 0x3d, 0xb8, 0x7e, 0x74, 0x3d,
+  0xd7, 0x0a, 0x93, 0x3d, 0xa9, 0x48, 0x90, 0x3d, 0xfb, 0x74, 0x8d, 0x3d,
+  0xe1, 0x0b, 0xa6, 0x3d, 0x83, 0x8e, 0x66, 0x3d, 0x13, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
+  0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0xc6, 0xb4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x28, 0x06, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x4c, 0x06, 0x00, 0x00, 0x3c, 0xb4, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4661,58 +4670,59 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xa4, 0x10, 0xeb, 0x38,
-  0x5b, 0xcd, 0x13, 0x39, 0x19, 0x35, 0x1a, 0x39, 0x21, 0x8f, 0x1e, 0x39,
-  0x41, 0x46, 0x0f, 0x39, 0x9f, 0x5e, 0xb1, 0x38, 0x27, 0x2d, 0xed, 0x38,
-  0x01, 0x01, 0xdb, 0x38, 0xe2, 0x47, 0x10, 0x39, 0x3a, 0xd3, 0x02, 0x39,
-  0x94, 0x9b, 0x2a, 0x39, 0x91, 0x08, 0x31, 0x39, 0x7a, 0xb6, 0xe7, 0x38,
-  0xbe, 0x15, 0x32, 0x39, 0x2d, 0x8a, 0xc4, 0x38, 0xe2, 0x40, 0x50, 0x39,
-  0xbb, 0x5a, 0x0b, 0x39, 0x8a, 0x58, 0x03, 0x39, 0x9f, 0xde, 0xa8, 0x38,
-  0x74, 0x6f, 0x21, 0x39, 0xfb, 0x77, 0xd1, 0x38, 0x2c, 0x18, 0x34, 0x39,
-  0xb6, 0xde, 0x0c, 0x39, 0x30, 0x33, 0x00, 0x39, 0xdc, 0x8e, 0xfe, 0x38,
-  0x7c, 0x19, 0x51, 0x39, 0x00, 0x87, 0xff, 0x38, 0x28, 0xae, 0xe0, 0x38,
-  0xae, 0x2b, 0xa0, 0x38, 0xfe, 0xbb, 0x98, 0x38, 0xdc, 0x8c, 0x0d, 0x39,
-  0xca, 0x8e, 0xba, 0x38, 0x51, 0x0d, 0xe3, 0x38, 0x0b, 0xdb, 0x03, 0x39,
-  0xf8, 0x4c, 0x1f, 0x39, 0x00, 0x91, 0x30, 0x39, 0xde, 0xac, 0x17, 0x39,
-  0x6d, 0x39, 0x27, 0x39, 0x55, 0x31, 0x05, 0x39, 0xe3, 0x81, 0x16, 0x39,
-  0xf6, 0x75, 0x0f, 0x39, 0x41, 0x60, 0x15, 0x39, 0x08, 0x45, 0x00, 0x39,
-  0x48, 0xcc, 0xcc, 0x38, 0x17, 0x37, 0x19, 0x39, 0x46, 0x4a, 0xee, 0x38,
-  0xfb, 0xb7, 0x00, 0x39, 0x09, 0xfa, 0x0a, 0x39, 0xfc, 0x0e, 0xdb, 0x38,
-  0xce, 0x50, 0x1b, 0x39, 0xb9, 0x8d, 0x12, 0x39, 0x87, 0xec, 0x1c, 0x39,
-  0x8c, 0x74, 0x2e, 0x39, 0x3e, 0xdd, 0xe2, 0x38, 0x76, 0xff, 0xd9, 0x38,
-  0xcc, 0x8a, 0xbe, 0x38, 0x70, 0x69, 0x0f, 0x39, 0x47, 0x4b, 0x18, 0x39,
-  0xaa, 0xa7, 0x79, 0x38, 0x0b, 0xf6, 0xbb, 0x38, 0x03, 0x73, 0x2f, 0x39,
-  0x9a, 0x90, 0xf1, 0x38, 0xa2, 0x19, 0xe2, 0x38, 0xca, 0xe6, 0xe5, 0x38,
-  0xcd, 0x53, 0xe8, 0x38, 0x55, 0x83, 0xfe, 0x38, 0xd2, 0x20, 0x20, 0x39,
-  0xb3, 0x97, 0xe0, 0x38, 0x98, 0xa7, 0x21, 0x39, 0x3e, 0xa5, 0x08, 0x39,
-  0x42, 0x04, 0x28, 0x39, 0x09, 0x73, 0x0a, 0x39, 0x7f, 0x74, 0xf2, 0x38,
-  0xbb, 0x44, 0xeb, 0x38, 0x06, 0xcd, 0xcc, 0x38, 0xe1, 0x64, 0x02, 0x39,
-  0x54, 0xf5, 0xec, 0x38, 0x67, 0x23, 0x10, 0x39, 0x0f, 0x54, 0x28, 0x39,
-  0xd2, 0x43, 0xd8, 0x38, 0xcd, 0x23, 0x0c, 0x39, 0x26, 0x45, 0xf9, 0x38,
-  0x9d, 0x36, 0x20, 0x39, 0xbb, 0x74, 0xbb, 0x38, 0x8e, 0xc2, 0xc9, 0x38,
-  0x71, 0xe0, 0xfa, 0x38, 0xb8, 0x14, 0x8c, 0x38, 0x3b, 0x82, 0x11, 0x39,
-  0xef, 0xcb, 0xf0, 0x38, 0xe2, 0x72, 0xf5, 0x38, 0x07, 0x80, 0xf5, 0x38,
-  0x9b, 0x20, 0xfc, 0x38, 0xbf, 0xdb, 0x24, 0x39, 0x66, 0x38, 0xd3, 0x38,
-  0x01, 0x2c, 0x15, 0x39, 0x9c, 0x72, 0xe2, 0x38, 0x47, 0x47, 0x01, 0x39,
-  0xec, 0xee, 0xab, 0x38, 0x71, 0xcf, 0x2f, 0x39, 0x9d, 0x13, 0xe2, 0x38,
-  0x1c, 0x44, 0x14, 0x39, 0xc6, 0x78, 0x01, 0x39, 0xe2, 0x35, 0xbe, 0x38,
-  0xf9, 0xb9, 0x16, 0x39, 0x30, 0xb6, 0xf2, 0x38, 0x4a, 0x96, 0xfa, 0x38,
-  0x5f, 0xf2, 0xf5, 0x38, 0xc9, 0x3b, 0x1f, 0x39, 0xae, 0x87, 0x05, 0x39,
-  0xb7, 0x3f, 0x08, 0x39, 0xe6, 0x4b, 0x01, 0x39, 0xb2, 0x2e, 0xeb, 0x38,
-  0x54, 0xcb, 0x25, 0x39, 0x96, 0x1d, 0x09, 0x39, 0xa4, 0xf1, 0x09, 0x39,
-  0x84, 0x49, 0xdd, 0x38, 0xb9, 0x80, 0xd7, 0x38, 0xfa, 0xb3, 0x06, 0x39,
-  0xeb, 0xa0, 0xb3, 0x38, 0xf8, 0xb8, 0xcd, 0x38, 0x7b, 0xd7, 0xf5, 0x38,
-  0xb2, 0xad, 0x33, 0x39, 0x5a, 0xbe, 0xfb, 0x38, 0xd7, 0x66, 0x17, 0x39,
-  0xba, 0x8f, 0x14, 0x39, 0x97, 0xa6, 0x11, 0x39, 0x1d, 0xf8, 0x2a, 0x39,
-  0x5c, 0x64, 0xed, 0x38, 0x2a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d,
-  0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x46, 0x75,
-  0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d,
-  0x56, 0x33, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x32, 0xbb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x2c, 0x06, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x48, 0x06, 0x00, 0x00, 0x5a, 0xc6, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0xa4, 0x10, 0xeb, 0x38, 0x5b, 0xcd, 0x13, 0x39, 0x19, 0x35, 0x1a, 0x39,
+  0x21, 0x8f, 0x1e, 0x39, 0x41, 0x46, 0x0f, 0x39, 0x9f, 0x5e, 0xb1, 0x38,
+  0x27, 0x2d, 0xed, 0x38, 0x01, 0x01, 0xdb, 0x38, 0xe2, 0x47, 0x10, 0x39,
+  0x3a, 0xd3, 0x02, 0x39, 0x94, 0x9b, 0x2a, 0x39, 0x91, 0x08, 0x31, 0x39,
+  0x7a, 0xb6, 0xe7, 0x38, 0xbe, 0x15, 0x32, 0x39, 0x2d, 0x8a, 0xc4, 0x38,
+  0xe2, 0x40, 0x50, 0x39, 0xbb, 0x5a, 0x0b, 0x39, 0x8a, 0x58, 0x03, 0x39,
+  0x9f, 0xde, 0xa8, 0x38, 0x74, 0x6f, 0x21, 0x39, 0xfb, 0x77, 0xd1, 0x38,
+  0x2c, 0x18, 0x34, 0x39, 0xb6, 0xde, 0x0c, 0x39, 0x30, 0x33, 0x00, 0x39,
+  0xdc, 0x8e, 0xfe, 0x38, 0x7c, 0x19, 0x51, 0x39, 0x00, 0x87, 0xff, 0x38,
+  0x28, 0xae, 0xe0, 0x38, 0xae, 0x2b, 0xa0, 0x38, 0xfe, 0xbb, 0x98, 0x38,
+  0xdc, 0x8c, 0x0d, 0x39, 0xca, 0x8e, 0xba, 0x38, 0x51, 0x0d, 0xe3, 0x38,
+  0x0b, 0xdb, 0x03, 0x39, 0xf8, 0x4c, 0x1f, 0x39, 0x00, 0x91, 0x30, 0x39,
+  0xde, 0xac, 0x17, 0x39, 0x6d, 0x39, 0x27, 0x39, 0x55, 0x31, 0x05, 0x39,
+  0xe3, 0x81, 0x16, 0x39, 0xf6, 0x75, 0x0f, 0x39, 0x41, 0x60, 0x15, 0x39,
+  0x08, 0x45, 0x00, 0x39, 0x48, 0xcc, 0xcc, 0x38, 0x17, 0x37, 0x19, 0x39,
+  0x46, 0x4a, 0xee, 0x38, 0xfb, 0xb7, 0x00, 0x39, 0x09, 0xfa, 0x0a, 0x39,
+  0xfc, 0x0e, 0xdb, 0x38, 0xce, 0x50, 0x1b, 0x39, 0xb9, 0x8d, 0x12, 0x39,
+  0x87, 0xec, 0x1c, 0x39, 0x8c, 0x74, 0x2e, 0x39, 0x3e, 0xdd, 0xe2, 0x38,
+  0x76, 0xff, 0xd9, 0x38, 0xcc, 0x8a, 0xbe, 0x38, 0x70, 0x69, 0x0f, 0x39,
+  0x47, 0x4b, 0x18, 0x39, 0xaa, 0xa7, 0x79, 0x38, 0x0b, 0xf6, 0xbb, 0x38,
+  0x03, 0x73, 0x2f, 0x39, 0x9a, 0x90, 0xf1, 0x38, 0xa2, 0x19, 0xe2, 0x38,
+  0xca, 0xe6, 0xe5, 0x38, 0xcd, 0x53, 0xe8, 0x38, 0x55, 0x83, 0xfe, 0x38,
+  0xd2, 0x20, 0x20, 0x39, 0xb3, 0x97, 0xe0, 0x38, 0x98, 0xa7, 0x21, 0x39,
+  0x3e, 0xa5, 0x08, 0x39, 0x42, 0x04, 0x28, 0x39, 0x09, 0x73, 0x0a, 0x39,
+  0x7f, 0x74, 0xf2, 0x38, 0xbb, 0x44, 0xeb, 0x38, 0x06, 0xcd, 0xcc, 0x38,
+  0xe1, 0x64, 0x02, 0x39, 0x54, 0xf5, 0xec, 0x38, 0x67, 0x23, 0x10, 0x39,
+  0x0f, 0x54, 0x28, 0x39, 0xd2, 0x43, 0xd8, 0x38, 0xcd, 0x23, 0x0c, 0x39,
+  0x26, 0x45, 0xf9, 0x38, 0x9d, 0x36, 0x20, 0x39, 0xbb, 0x74, 0xbb, 0x38,
+  0x8e, 0xc2, 0xc9, 0x38, 0x71, 0xe0, 0xfa, 0x38, 0xb8, 0x14, 0x8c, 0x38,
+  0x3b, 0x82, 0x11, 0x39, 0xef, 0xcb, 0xf0, 0x38, 0xe2, 0x72, 0xf5, 0x38,
+  0x07, 0x80, 0xf5, 0x38, 0x9b, 0x20, 0xfc, 0x38, 0xbf, 0xdb, 0x24, 0x39,
+  0x66, 0x38, 0xd3, 0x38, 0x01, 0x2c, 0x15, 0x39, 0x9c, 0x72, 0xe2, 0x38,
+  0x47, 0x47, 0x01, 0x39, 0xec, 0xee, 0xab, 0x38, 0x71, 0xcf, 0x2f, 0x39,
+  0x9d, 0x13, 0xe2, 0x38, 0x1c, 0x44, 0x14, 0x39, 0xc6, 0x78, 0x01, 0x39,
+  0xe2, 0x35, 0xbe, 0x38, 0xf9, 0xb9, 0x16, 0x39, 0x30, 0xb6, 0xf2, 0x38,
+  0x4a, 0x96, 0xfa, 0x38, 0x5f, 0xf2, 0xf5, 0x38, 0xc9, 0x3b, 0x1f, 0x39,
+  0xae, 0x87, 0x05, 0x39, 0xb7, 0x3f, 0x08, 0x39, 0xe6, 0x4b, 0x01, 0x39,
+  0xb2, 0x2e, 0xeb, 0x38, 0x54, 0xcb, 0x25, 0x39, 0x96, 0x1d, 0x09, 0x39,
+  0xa4, 0xf1, 0x09, 0x39, 0x84, 0x49, 0xdd, 0x38, 0xb9, 0x80, 0xd7, 0x38,
+  0xfa, 0xb3, 0x06, 0x39, 0xeb, 0xa0, 0xb3, 0x38, 0xf8, 0xb8, 0xcd, 0x38,
+  0x7b, 0xd7, 0xf5, 0x38, 0xb2, 0xad, 0x33, 0x39, 0x5a, 0xbe, 0xfb, 0x38,
+  0xd7, 0x66, 0x17, 0x39, 0xba, 0x8f, 0x14, 0x39, 0x97, 0xa6, 0x11, 0x39,
+  0x1d, 0xf8, 0x2a, 0x39, 0x5c, 0x64, 0xed, 0x38, 0x2a, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f,
+  0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68,
+  0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x32, 0xbb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x2c, 0x06, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x48, 0x06, 0x00, 0x00, 0x5a, 0xc6, 0xff, 0xff,
+  0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4798,59 +4808,58 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x53, 0xff, 0xbe, 0x3a, 0x22, 0xe8, 0x7e, 0x3a, 0x8e, 0x48, 0xb2, 0x3a,
-  0x74, 0x1f, 0x8f, 0x3a, 0x4e, 0x56, 0x93, 0x3a, 0x30, 0x24, 0x4b, 0x3a,
-  0xe5, 0x9d, 0x9c, 0x3a, 0x35, 0x82, 0xb2, 0x3a, 0x2a, 0x4a, 0xc5, 0x3a,
-  0xe6, 0xde, 0xad, 0x3a, 0x6f, 0x5e, 0xec, 0x3a, 0x5c, 0x7f, 0xbc, 0x3a,
-  0xdb, 0xfc, 0xb7, 0x3a, 0xce, 0xdb, 0x3e, 0x3a, 0xb1, 0xfd, 0x6a, 0x3a,
-  0x03, 0xbe, 0xf7, 0x3a, 0xf7, 0x8e, 0xaa, 0x3a, 0x44, 0x0b, 0x82, 0x3a,
-  0x9e, 0xdb, 0x91, 0x3a, 0x3e, 0x5a, 0xcd, 0x3a, 0xc6, 0x0a, 0xa2, 0x3a,
-  0xf7, 0x58, 0xb5, 0x3a, 0xa2, 0x65, 0xee, 0x3a, 0x75, 0x64, 0xbb, 0x3a,
-  0xf8, 0x78, 0xdd, 0x3a, 0xf4, 0x22, 0x04, 0x3b, 0x7b, 0x28, 0xbf, 0x3a,
-  0x4c, 0xb8, 0x87, 0x3a, 0x97, 0x44, 0x9e, 0x3a, 0x3d, 0xf4, 0x70, 0x3a,
-  0xcc, 0x1a, 0x8c, 0x3a, 0x0c, 0xe5, 0x9c, 0x3a, 0xd7, 0x10, 0xa2, 0x3a,
-  0xf3, 0x21, 0x3a, 0x3a, 0x58, 0x87, 0xc1, 0x3a, 0x57, 0x48, 0x9d, 0x3a,
-  0x70, 0x36, 0xc1, 0x3a, 0x54, 0x9d, 0xac, 0x3a, 0xef, 0x5f, 0xca, 0x3a,
-  0x7b, 0x12, 0x87, 0x3a, 0xb7, 0x9f, 0xc7, 0x3a, 0x20, 0x9b, 0xcb, 0x3a,
-  0xcb, 0xe0, 0x84, 0x3a, 0x69, 0xb7, 0x6a, 0x3a, 0x3b, 0x1c, 0x8f, 0x3a,
-  0x50, 0x6c, 0xbe, 0x3a, 0x51, 0xf9, 0xa5, 0x3a, 0x5e, 0x5b, 0x9d, 0x3a,
-  0x17, 0xa6, 0xa6, 0x3a, 0xc7, 0x00, 0x81, 0x3a, 0xef, 0x3a, 0x8b, 0x3a,
-  0x77, 0x75, 0xb7, 0x3a, 0xf3, 0x4f, 0xd8, 0x3a, 0x51, 0x3b, 0x95, 0x3a,
-  0xc9, 0x5a, 0xbb, 0x3a, 0x56, 0x9d, 0x97, 0x3a, 0x44, 0xa1, 0x86, 0x3a,
-  0x4b, 0x82, 0x92, 0x3a, 0x53, 0xa8, 0x7d, 0x3a, 0xdc, 0x28, 0xbe, 0x3a,
-  0x32, 0x21, 0x92, 0x3a, 0xba, 0xc5, 0xa9, 0x3a, 0x11, 0x11, 0xb2, 0x3a,
-  0xf0, 0x95, 0x92, 0x3a, 0x12, 0xa3, 0x76, 0x3a, 0xe8, 0x10, 0x8f, 0x3a,
-  0x9d, 0x62, 0xd8, 0x3a, 0xe8, 0x98, 0x91, 0x3a, 0x28, 0x89, 0x99, 0x3a,
-  0x2f, 0x51, 0x68, 0x3a, 0xb7, 0x95, 0x98, 0x3a, 0x19, 0x95, 0xa3, 0x3a,
-  0xb1, 0x51, 0x86, 0x3a, 0x72, 0x1e, 0x67, 0x3a, 0x3a, 0x6b, 0x94, 0x3a,
-  0xdb, 0x6b, 0x8f, 0x3a, 0xb2, 0xc0, 0x89, 0x3a, 0x5a, 0x6f, 0xb5, 0x3a,
-  0xe8, 0x4c, 0xc1, 0x3a, 0x62, 0xdc, 0xd0, 0x3a, 0xbb, 0xc2, 0x8e, 0x3a,
-  0xe6, 0xc4, 0xa4, 0x3a, 0x55, 0x5b, 0xa1, 0x3a, 0x08, 0x97, 0x90, 0x3a,
-  0xb5, 0xb4, 0x85, 0x3a, 0x0e, 0x14, 0x9d, 0x3a, 0x9c, 0x63, 0x85, 0x3a,
-  0x26, 0x3e, 0xa3, 0x3a, 0x4d, 0x8b, 0x9d, 0x3a, 0x7c, 0xe8, 0xab, 0x3a,
-  0x31, 0x74, 0x8d, 0x3a, 0x30, 0x88, 0x84, 0x3a, 0x5c, 0x74, 0x05, 0x3b,
-  0x59, 0xe4, 0xba, 0x3a, 0x30, 0x38, 0xc4, 0x3a, 0xd2, 0x3a, 0xa7, 0x3a,
-  0x48, 0x0b, 0xcf, 0x3a, 0x9f, 0x9a, 0x85, 0x3a, 0xda, 0xec, 0x4e, 0x3a,
-  0xb9, 0xa4, 0xb7, 0x3a, 0xcc, 0x7b, 0x99, 0x3a, 0xce, 0x89, 0xc8, 0x3a,
-  0x16, 0xaf, 0x54, 0x3a, 0xda, 0xa8, 0xd3, 0x3a, 0x9d, 0x5b, 0x89, 0x3a,
-  0x5e, 0xae, 0xc2, 0x3a, 0x52, 0x5d, 0xad, 0x3a, 0xf3, 0xa5, 0x9d, 0x3a,
-  0x14, 0xeb, 0x13, 0x3b, 0x45, 0xf7, 0xb3, 0x3a, 0x18, 0x5b, 0xe6, 0x3a,
-  0xd5, 0x70, 0x92, 0x3a, 0x52, 0xee, 0x9d, 0x3a, 0x46, 0x1c, 0x9a, 0x3a,
-  0xf1, 0xed, 0x89, 0x3a, 0xd1, 0xa5, 0xd5, 0x3a, 0xb5, 0xe2, 0xa6, 0x3a,
-  0x63, 0xfc, 0xb0, 0x3a, 0x87, 0x52, 0xaa, 0x3a, 0x0c, 0x59, 0x73, 0x3a,
-  0x37, 0xee, 0xa3, 0x3a, 0xf1, 0x29, 0xb1, 0x3a, 0x07, 0xb6, 0xa5, 0x3a,
-  0x4f, 0x46, 0xb3, 0x3a, 0xcc, 0x54, 0xb1, 0x3a, 0xab, 0xa9, 0x90, 0x3a,
-  0x41, 0x39, 0xbc, 0x3a, 0xbf, 0x6e, 0x88, 0x3a, 0x22, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xa6, 0xc1, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x00, 0x00,
-  0x1c, 0xc1, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x53, 0xff, 0xbe, 0x3a, 0x22, 0xe8, 0x7e, 0x3a,
+  0x8e, 0x48, 0xb2, 0x3a, 0x74, 0x1f, 0x8f, 0x3a, 0x4e, 0x56, 0x93, 0x3a,
+  0x30, 0x24, 0x4b, 0x3a, 0xe5, 0x9d, 0x9c, 0x3a, 0x35, 0x82, 0xb2, 0x3a,
+  0x2a, 0x4a, 0xc5, 0x3a, 0xe6, 0xde, 0xad, 0x3a, 0x6f, 0x5e, 0xec, 0x3a,
+  0x5c, 0x7f, 0xbc, 0x3a, 0xdb, 0xfc, 0xb7, 0x3a, 0xce, 0xdb, 0x3e, 0x3a,
+  0xb1, 0xfd, 0x6a, 0x3a, 0x03, 0xbe, 0xf7, 0x3a, 0xf7, 0x8e, 0xaa, 0x3a,
+  0x44, 0x0b, 0x82, 0x3a, 0x9e, 0xdb, 0x91, 0x3a, 0x3e, 0x5a, 0xcd, 0x3a,
+  0xc6, 0x0a, 0xa2, 0x3a, 0xf7, 0x58, 0xb5, 0x3a, 0xa2, 0x65, 0xee, 0x3a,
+  0x75, 0x64, 0xbb, 0x3a, 0xf8, 0x78, 0xdd, 0x3a, 0xf4, 0x22, 0x04, 0x3b,
+  0x7b, 0x28, 0xbf, 0x3a, 0x4c, 0xb8, 0x87, 0x3a, 0x97, 0x44, 0x9e, 0x3a,
+  0x3d, 0xf4, 0x70, 0x3a, 0xcc, 0x1a, 0x8c, 0x3a, 0x0c, 0xe5, 0x9c, 0x3a,
+  0xd7, 0x10, 0xa2, 0x3a, 0xf3, 0x21, 0x3a, 0x3a, 0x58, 0x87, 0xc1, 0x3a,
+  0x57, 0x48, 0x9d, 0x3a, 0x70, 0x36, 0xc1, 0x3a, 0x54, 0x9d, 0xac, 0x3a,
+  0xef, 0x5f, 0xca, 0x3a, 0x7b, 0x12, 0x87, 0x3a, 0xb7, 0x9f, 0xc7, 0x3a,
+  0x20, 0x9b, 0xcb, 0x3a, 0xcb, 0xe0, 0x84, 0x3a, 0x69, 0xb7, 0x6a, 0x3a,
+  0x3b, 0x1c, 0x8f, 0x3a, 0x50, 0x6c, 0xbe, 0x3a, 0x51, 0xf9, 0xa5, 0x3a,
+  0x5e, 0x5b, 0x9d, 0x3a, 0x17, 0xa6, 0xa6, 0x3a, 0xc7, 0x00, 0x81, 0x3a,
+  0xef, 0x3a, 0x8b, 0x3a, 0x77, 0x75, 0xb7, 0x3a, 0xf3, 0x4f, 0xd8, 0x3a,
+  0x51, 0x3b, 0x95, 0x3a, 0xc9, 0x5a, 0xbb, 0x3a, 0x56, 0x9d, 0x97, 0x3a,
+  0x44, 0xa1, 0x86, 0x3a, 0x4b, 0x82, 0x92, 0x3a, 0x53, 0xa8, 0x7d, 0x3a,
+  0xdc, 0x28, 0xbe, 0x3a, 0x32, 0x21, 0x92, 0x3a, 0xba, 0xc5, 0xa9, 0x3a,
+  0x11, 0x11, 0xb2, 0x3a, 0xf0, 0x95, 0x92, 0x3a, 0x12, 0xa3, 0x76, 0x3a,
+  0xe8, 0x10, 0x8f, 0x3a, 0x9d, 0x62, 0xd8, 0x3a, 0xe8, 0x98, 0x91, 0x3a,
+  0x28, 0x89, 0x99, 0x3a, 0x2f, 0x51, 0x68, 0x3a, 0xb7, 0x95, 0x98, 0x3a,
+  0x19, 0x95, 0xa3, 0x3a, 0xb1, 0x51, 0x86, 0x3a, 0x72, 0x1e, 0x67, 0x3a,
+  0x3a, 0x6b, 0x94, 0x3a, 0xdb, 0x6b, 0x8f, 0x3a, 0xb2, 0xc0, 0x89, 0x3a,
+  0x5a, 0x6f, 0xb5, 0x3a, 0xe8, 0x4c, 0xc1, 0x3a, 0x62, 0xdc, 0xd0, 0x3a,
+  0xbb, 0xc2, 0x8e, 0x3a, 0xe6, 0xc4, 0xa4, 0x3a, 0x55, 0x5b, 0xa1, 0x3a,
+  0x08, 0x97, 0x90, 0x3a, 0xb5, 0xb4, 0x85, 0x3a, 0x0e, 0x14, 0x9d, 0x3a,
+  0x9c, 0x63, 0x85, 0x3a, 0x26, 0x3e, 0xa3, 0x3a, 0x4d, 0x8b, 0x9d, 0x3a,
+  0x7c, 0xe8, 0xab, 0x3a, 0x31, 0x74, 0x8d, 0x3a, 0x30, 0x88, 0x84, 0x3a,
+  0x5c, 0x74, 0x05, 0x3b, 0x59, 0xe4, 0xba, 0x3a, 0x30, 0x38, 0xc4, 0x3a,
+  0xd2, 0x3a, 0xa7, 0x3a, 0x48, 0x0b, 0xcf, 0x3a, 0x9f, 0x9a, 0x85, 0x3a,
+  0xda, 0xec, 0x4e, 0x3a, 0xb9, 0xa4, 0xb7, 0x3a, 0xcc, 0x7b, 0x99, 0x3a,
+  0xce, 0x89, 0xc8, 0x3a, 0x16, 0xaf, 0x54, 0x3a, 0xda, 0xa8, 0xd3, 0x3a,
+  0x9d, 0x5b, 0x89, 0x3a, 0x5e, 0xae, 0xc2, 0x3a, 0x52, 0x5d, 0xad, 0x3a,
+  0xf3, 0xa5, 0x9d, 0x3a, 0x14, 0xeb, 0x13, 0x3b, 0x45, 0xf7, 0xb3, 0x3a,
+  0x18, 0x5b, 0xe6, 0x3a, 0xd5, 0x70, 0x92, 0x3a, 0x52, 0xee, 0x9d, 0x3a,
+  0x46, 0x1c, 0x9a, 0x3a, 0xf1, 0xed, 0x89, 0x3a, 0xd1, 0xa5, 0xd5, 0x3a,
+  0xb5, 0xe2, 0xa6, 0x3a, 0x63, 0xfc, 0xb0, 0x3a, 0x87, 0x52, 0xaa, 0x3a,
+  0x0c, 0x59, 0x73, 0x3a, 0x37, 0xee, 0xa3, 0x3a, 0xf1, 0x29, 0xb1, 0x3a,
+  0x07, 0xb6, 0xa5, 0x3a, 0x4f, 0x46, 0xb3, 0x3a, 0xcc, 0x54, 0xb1, 0x3a,
+  0xab, 0xa9, 0x90, 0x3a, 0x41, 0x39, 0xbc, 0x3a, 0xbf, 0x6e, 0x88, 0x3a,
+  0x22, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
+  0x32, 0x64, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
+  0x73, 0x65, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0xa6, 0xc1, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x24, 0x06, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x40, 0x06, 0x00, 0x00, 0x1c, 0xc1, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4935,59 +4944,58 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x9e, 0x04, 0x23, 0x38, 0xf9, 0x07, 0x2d, 0x38, 0x7a, 0x2e, 0xe1, 0x37,
-  0xea, 0xa6, 0x1b, 0x38, 0xab, 0x9d, 0x8f, 0x37, 0x3a, 0xb6, 0xa5, 0x37,
-  0x50, 0x72, 0x77, 0x38, 0x3e, 0xfd, 0xf9, 0x37, 0xc6, 0xaa, 0x40, 0x38,
-  0xa8, 0x57, 0xd2, 0x37, 0x38, 0x9c, 0xcb, 0x37, 0x19, 0x7f, 0xc9, 0x37,
-  0x47, 0x0a, 0xc2, 0x37, 0x0b, 0xd6, 0x61, 0x37, 0x49, 0xea, 0x7a, 0x37,
-  0x93, 0xf4, 0x0b, 0x38, 0x1d, 0x28, 0x82, 0x37, 0xbf, 0xe0, 0xcc, 0x37,
-  0xfa, 0x3b, 0xa4, 0x37, 0xd4, 0x95, 0xbe, 0x37, 0x77, 0x51, 0xae, 0x37,
-  0x50, 0x3e, 0x45, 0x38, 0xdc, 0x0f, 0xda, 0x37, 0xd8, 0x26, 0x73, 0x37,
-  0x6f, 0x0c, 0xa4, 0x37, 0xb3, 0xa3, 0x1f, 0x38, 0x43, 0xac, 0x87, 0x37,
-  0x8c, 0x55, 0xb2, 0x37, 0x3f, 0x91, 0x49, 0x38, 0xe9, 0x94, 0xad, 0x37,
-  0x9c, 0x6e, 0xb0, 0x37, 0xe2, 0x17, 0xc0, 0x37, 0x03, 0x4d, 0x0e, 0x38,
-  0x27, 0xb8, 0xf8, 0x37, 0x4a, 0xf4, 0xbc, 0x37, 0x45, 0x53, 0xad, 0x37,
-  0x2f, 0x12, 0xaa, 0x37, 0x8a, 0xb7, 0xfb, 0x37, 0xa0, 0x13, 0x9b, 0x37,
-  0x5f, 0x46, 0xe3, 0x37, 0xb5, 0x32, 0x07, 0x38, 0xe1, 0x74, 0xc3, 0x37,
-  0xc0, 0xdf, 0xf5, 0x37, 0x91, 0xbc, 0xae, 0x37, 0x0c, 0x74, 0x96, 0x37,
-  0x0e, 0x5d, 0x08, 0x38, 0x14, 0x92, 0x90, 0x38, 0x71, 0xb2, 0xbc, 0x37,
-  0x28, 0x1a, 0x08, 0x38, 0xfc, 0xa5, 0xc5, 0x37, 0x49, 0x1a, 0x45, 0x38,
-  0x73, 0xfc, 0x50, 0x38, 0x5d, 0xab, 0x01, 0x38, 0x69, 0x0a, 0x5e, 0x37,
-  0x03, 0x62, 0x19, 0x38, 0xe5, 0xda, 0xc5, 0x37, 0x48, 0xbb, 0x91, 0x37,
-  0x11, 0x55, 0xe7, 0x37, 0xcc, 0x47, 0x90, 0x37, 0x07, 0x2c, 0xb0, 0x37,
-  0x56, 0x13, 0x9c, 0x37, 0x52, 0x86, 0x77, 0x38, 0x8f, 0xc4, 0x8b, 0x37,
-  0x8b, 0xd2, 0x48, 0x38, 0xb9, 0xd1, 0x07, 0x38, 0x46, 0x58, 0xb9, 0x37,
-  0xa4, 0x11, 0x27, 0x38, 0x5e, 0xbd, 0xb2, 0x37, 0xb7, 0x20, 0xdf, 0x37,
-  0xc2, 0x76, 0xaf, 0x37, 0xce, 0x86, 0x18, 0x38, 0x00, 0x61, 0xa4, 0x37,
-  0x26, 0x71, 0xb1, 0x37, 0x31, 0x13, 0xd8, 0x37, 0x3d, 0x57, 0xec, 0x37,
-  0xca, 0x1a, 0x87, 0x37, 0x22, 0x39, 0x6c, 0x37, 0x44, 0x0b, 0x0c, 0x38,
-  0x9e, 0xd7, 0x65, 0x37, 0x5a, 0x82, 0x0d, 0x38, 0xff, 0xe3, 0x83, 0x37,
-  0xbf, 0x9c, 0x2a, 0x38, 0x50, 0x89, 0x44, 0x38, 0x3c, 0x1a, 0xd9, 0x37,
-  0x73, 0xdd, 0xbd, 0x37, 0xb0, 0x27, 0x23, 0x38, 0xb6, 0x9e, 0xad, 0x37,
-  0x88, 0xe1, 0x8b, 0x37, 0x4d, 0x93, 0x8a, 0x38, 0xf5, 0xa5, 0x3e, 0x38,
-  0x85, 0x9c, 0xe0, 0x37, 0xd2, 0x2b, 0xef, 0x37, 0x55, 0x30, 0x9c, 0x37,
-  0x6b, 0x59, 0x42, 0x38, 0x2f, 0x35, 0xa7, 0x37, 0x38, 0xa2, 0x32, 0x38,
-  0x8d, 0xa7, 0x97, 0x37, 0xb9, 0x63, 0x53, 0x38, 0xcb, 0xab, 0x00, 0x38,
-  0x93, 0xab, 0xc9, 0x37, 0x7b, 0x88, 0xec, 0x37, 0x37, 0x43, 0x94, 0x37,
-  0x9b, 0x09, 0x73, 0x37, 0xa7, 0x35, 0xc5, 0x37, 0x41, 0x34, 0xa6, 0x37,
-  0x77, 0x2f, 0x0b, 0x37, 0x2c, 0x5c, 0x56, 0x37, 0x46, 0x1f, 0xc7, 0x37,
-  0x43, 0xc5, 0x08, 0x38, 0x04, 0x68, 0x9f, 0x37, 0x5a, 0xac, 0x45, 0x37,
-  0x55, 0x8a, 0x98, 0x37, 0x46, 0x60, 0xb7, 0x37, 0x6c, 0xfc, 0x94, 0x37,
-  0x1d, 0x26, 0xc9, 0x37, 0xeb, 0xf9, 0x0e, 0x38, 0x33, 0xde, 0x8a, 0x37,
-  0xa7, 0x7b, 0xc0, 0x37, 0xd3, 0x0a, 0xe6, 0x37, 0x1f, 0x4f, 0x38, 0x37,
-  0x64, 0x7b, 0xe2, 0x37, 0xa4, 0xbc, 0xd4, 0x37, 0xa0, 0xce, 0x26, 0x38,
-  0xf6, 0xeb, 0xde, 0x37, 0xfa, 0xf3, 0xb4, 0x37, 0x6d, 0x5b, 0x91, 0x37,
-  0xe4, 0xf2, 0x8a, 0x37, 0x89, 0xe7, 0x99, 0x37, 0x23, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x33, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x06, 0xc8, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x00, 0x00,
-  0x7c, 0xc7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x9e, 0x04, 0x23, 0x38, 0xf9, 0x07, 0x2d, 0x38,
+  0x7a, 0x2e, 0xe1, 0x37, 0xea, 0xa6, 0x1b, 0x38, 0xab, 0x9d, 0x8f, 0x37,
+  0x3a, 0xb6, 0xa5, 0x37, 0x50, 0x72, 0x77, 0x38, 0x3e, 0xfd, 0xf9, 0x37,
+  0xc6, 0xaa, 0x40, 0x38, 0xa8, 0x57, 0xd2, 0x37, 0x38, 0x9c, 0xcb, 0x37,
+  0x19, 0x7f, 0xc9, 0x37, 0x47, 0x0a, 0xc2, 0x37, 0x0b, 0xd6, 0x61, 0x37,
+  0x49, 0xea, 0x7a, 0x37, 0x93, 0xf4, 0x0b, 0x38, 0x1d, 0x28, 0x82, 0x37,
+  0xbf, 0xe0, 0xcc, 0x37, 0xfa, 0x3b, 0xa4, 0x37, 0xd4, 0x95, 0xbe, 0x37,
+  0x77, 0x51, 0xae, 0x37, 0x50, 0x3e, 0x45, 0x38, 0xdc, 0x0f, 0xda, 0x37,
+  0xd8, 0x26, 0x73, 0x37, 0x6f, 0x0c, 0xa4, 0x37, 0xb3, 0xa3, 0x1f, 0x38,
+  0x43, 0xac, 0x87, 0x37, 0x8c, 0x55, 0xb2, 0x37, 0x3f, 0x91, 0x49, 0x38,
+  0xe9, 0x94, 0xad, 0x37, 0x9c, 0x6e, 0xb0, 0x37, 0xe2, 0x17, 0xc0, 0x37,
+  0x03, 0x4d, 0x0e, 0x38, 0x27, 0xb8, 0xf8, 0x37, 0x4a, 0xf4, 0xbc, 0x37,
+  0x45, 0x53, 0xad, 0x37, 0x2f, 0x12, 0xaa, 0x37, 0x8a, 0xb7, 0xfb, 0x37,
+  0xa0, 0x13, 0x9b, 0x37, 0x5f, 0x46, 0xe3, 0x37, 0xb5, 0x32, 0x07, 0x38,
+  0xe1, 0x74, 0xc3, 0x37, 0xc0, 0xdf, 0xf5, 0x37, 0x91, 0xbc, 0xae, 0x37,
+  0x0c, 0x74, 0x96, 0x37, 0x0e, 0x5d, 0x08, 0x38, 0x14, 0x92, 0x90, 0x38,
+  0x71, 0xb2, 0xbc, 0x37, 0x28, 0x1a, 0x08, 0x38, 0xfc, 0xa5, 0xc5, 0x37,
+  0x49, 0x1a, 0x45, 0x38, 0x73, 0xfc, 0x50, 0x38, 0x5d, 0xab, 0x01, 0x38,
+  0x69, 0x0a, 0x5e, 0x37, 0x03, 0x62, 0x19, 0x38, 0xe5, 0xda, 0xc5, 0x37,
+  0x48, 0xbb, 0x91, 0x37, 0x11, 0x55, 0xe7, 0x37, 0xcc, 0x47, 0x90, 0x37,
+  0x07, 0x2c, 0xb0, 0x37, 0x56, 0x13, 0x9c, 0x37, 0x52, 0x86, 0x77, 0x38,
+  0x8f, 0xc4, 0x8b, 0x37, 0x8b, 0xd2, 0x48, 0x38, 0xb9, 0xd1, 0x07, 0x38,
+  0x46, 0x58, 0xb9, 0x37, 0xa4, 0x11, 0x27, 0x38, 0x5e, 0xbd, 0xb2, 0x37,
+  0xb7, 0x20, 0xdf, 0x37, 0xc2, 0x76, 0xaf, 0x37, 0xce, 0x86, 0x18, 0x38,
+  0x00, 0x61, 0xa4, 0x37, 0x26, 0x71, 0xb1, 0x37, 0x31, 0x13, 0xd8, 0x37,
+  0x3d, 0x57, 0xec, 0x37, 0xca, 0x1a, 0x87, 0x37, 0x22, 0x39, 0x6c, 0x37,
+  0x44, 0x0b, 0x0c, 0x38, 0x9e, 0xd7, 0x65, 0x37, 0x5a, 0x82, 0x0d, 0x38,
+  0xff, 0xe3, 0x83, 0x37, 0xbf, 0x9c, 0x2a, 0x38, 0x50, 0x89, 0x44, 0x38,
+  0x3c, 0x1a, 0xd9, 0x37, 0x73, 0xdd, 0xbd, 0x37, 0xb0, 0x27, 0x23, 0x38,
+  0xb6, 0x9e, 0xad, 0x37, 0x88, 0xe1, 0x8b, 0x37, 0x4d, 0x93, 0x8a, 0x38,
+  0xf5, 0xa5, 0x3e, 0x38, 0x85, 0x9c, 0xe0, 0x37, 0xd2, 0x2b, 0xef, 0x37,
+  0x55, 0x30, 0x9c, 0x37, 0x6b, 0x59, 0x42, 0x38, 0x2f, 0x35, 0xa7, 0x37,
+  0x38, 0xa2, 0x32, 0x38, 0x8d, 0xa7, 0x97, 0x37, 0xb9, 0x63, 0x53, 0x38,
+  0xcb, 0xab, 0x00, 0x38, 0x93, 0xab, 0xc9, 0x37, 0x7b, 0x88, 0xec, 0x37,
+  0x37, 0x43, 0x94, 0x37, 0x9b, 0x09, 0x73, 0x37, 0xa7, 0x35, 0xc5, 0x37,
+  0x41, 0x34, 0xa6, 0x37, 0x77, 0x2f, 0x0b, 0x37, 0x2c, 0x5c, 0x56, 0x37,
+  0x46, 0x1f, 0xc7, 0x37, 0x43, 0xc5, 0x08, 0x38, 0x04, 0x68, 0x9f, 0x37,
+  0x5a, 0xac, 0x45, 0x37, 0x55, 0x8a, 0x98, 0x37, 0x46, 0x60, 0xb7, 0x37,
+  0x6c, 0xfc, 0x94, 0x37, 0x1d, 0x26, 0xc9, 0x37, 0xeb, 0xf9, 0x0e, 0x38,
+  0x33, 0xde, 0x8a, 0x37, 0xa7, 0x7b, 0xc0, 0x37, 0xd3, 0x0a, 0xe6, 0x37,
+  0x1f, 0x4f, 0x38, 0x37, 0x64, 0x7b, 0xe2, 0x37, 0xa4, 0xbc, 0xd4, 0x37,
+  0xa0, 0xce, 0x26, 0x38, 0xf6, 0xeb, 0xde, 0x37, 0xfa, 0xf3, 0xb4, 0x37,
+  0x6d, 0x5b, 0x91, 0x37, 0xe4, 0xf2, 0x8a, 0x37, 0x89, 0xe7, 0x99, 0x37,
+  0x23, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
+  0x32, 0x64, 0x5f, 0x33, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
+  0x73, 0x65, 0x33, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x06, 0xc8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x24, 0x06, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x40, 0x06, 0x00, 0x00, 0x7c, 0xc7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -5071,58 +5079,59 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x6b, 0x7d, 0xb7, 0x37, 0x8c, 0xfc, 0xab, 0x37, 0x60, 0x3b, 0x35, 0x38,
-  0xaf, 0x99, 0x21, 0x38, 0x4a, 0xeb, 0x3e, 0x38, 0xf8, 0xe9, 0xfa, 0x37,
-  0xb1, 0xd4, 0xc5, 0x37, 0x74, 0x49, 0x0d, 0x38, 0x0d, 0xb0, 0x12, 0x38,
-  0xeb, 0xe7, 0xf3, 0x37, 0xd5, 0x76, 0xab, 0x37, 0xec, 0x2a, 0x0a, 0x38,
-  0xff, 0x16, 0xac, 0x37, 0x85, 0x2d, 0x0d, 0x38, 0x07, 0x3f, 0xbf, 0x37,
-  0xba, 0xad, 0x0d, 0x38, 0x86, 0xf1, 0x06, 0x38, 0xc3, 0x50, 0x12, 0x38,
-  0xa0, 0x1d, 0xee, 0x37, 0x19, 0x32, 0xe2, 0x37, 0x41, 0xe4, 0xbe, 0x37,
-  0x34, 0xb6, 0xac, 0x37, 0xe0, 0xcb, 0xcb, 0x37, 0x4d, 0xac, 0x9c, 0x37,
-  0x8b, 0x70, 0x1a, 0x38, 0x9c, 0xaf, 0x26, 0x38, 0x76, 0x6e, 0xe1, 0x37,
-  0xc5, 0xaf, 0xbd, 0x37, 0x5d, 0x59, 0x01, 0x38, 0x02, 0x7e, 0xc6, 0x37,
-  0x6f, 0xe0, 0xb1, 0x37, 0xe9, 0x2e, 0xf5, 0x37, 0x85, 0x33, 0x11, 0x38,
-  0xf7, 0x9d, 0xdd, 0x37, 0x19, 0x1d, 0x9f, 0x37, 0x87, 0x1c, 0x10, 0x38,
-  0x26, 0x31, 0x93, 0x37, 0xf1, 0x21, 0x15, 0x38, 0x4e, 0x95, 0x0d, 0x38,
-  0x8d, 0xc3, 0xcc, 0x37, 0x20, 0x8f, 0xdf, 0x37, 0x1e, 0x59, 0xd5, 0x37,
-  0xe4, 0x31, 0xce, 0x37, 0x12, 0x0a, 0xdc, 0x37, 0x8b, 0xd7, 0x8a, 0x37,
-  0x30, 0x02, 0xd0, 0x37, 0x8a, 0xc3, 0xb7, 0x37, 0xce, 0x3b, 0x14, 0x38,
-  0x15, 0x42, 0x81, 0x37, 0x74, 0x72, 0xe7, 0x37, 0x9c, 0xef, 0x81, 0x37,
-  0x23, 0x73, 0xe9, 0x37, 0x14, 0xd1, 0x60, 0x38, 0xeb, 0xf5, 0x18, 0x38,
-  0x64, 0x77, 0xdf, 0x37, 0xbe, 0x6b, 0xfe, 0x37, 0xf6, 0xb7, 0x34, 0x38,
-  0xb3, 0x3a, 0x2f, 0x38, 0x63, 0x38, 0xb5, 0x37, 0xf8, 0x18, 0x7f, 0x37,
-  0x0f, 0xb3, 0x28, 0x38, 0xef, 0xc6, 0xfd, 0x37, 0xa0, 0xab, 0x13, 0x38,
-  0x8c, 0xf1, 0x13, 0x38, 0x01, 0xba, 0xb9, 0x37, 0xce, 0xa2, 0xd9, 0x37,
-  0x09, 0xe5, 0xca, 0x37, 0xbd, 0xa9, 0xb9, 0x37, 0x2c, 0x62, 0x0f, 0x38,
-  0x0a, 0xa3, 0xbe, 0x37, 0x96, 0xc3, 0x9f, 0x37, 0x3a, 0x1e, 0xb8, 0x37,
-  0xbf, 0x8c, 0xd4, 0x37, 0xc1, 0x80, 0xfd, 0x37, 0x31, 0x5e, 0x06, 0x38,
-  0x4c, 0x3e, 0xdb, 0x37, 0x1a, 0x59, 0xa5, 0x37, 0x3a, 0x77, 0xd0, 0x37,
-  0x34, 0xca, 0xb3, 0x37, 0x77, 0x15, 0xdd, 0x37, 0x80, 0x98, 0x07, 0x38,
-  0xc9, 0x77, 0x1c, 0x38, 0xc7, 0x74, 0xbc, 0x37, 0x7c, 0x42, 0xd9, 0x37,
-  0x41, 0x6b, 0x00, 0x38, 0x54, 0x4e, 0x15, 0x38, 0x91, 0xaf, 0xe0, 0x37,
-  0x8b, 0x46, 0xef, 0x37, 0x22, 0x02, 0x04, 0x38, 0x0c, 0x2f, 0xc1, 0x37,
-  0x84, 0xd4, 0x9f, 0x37, 0xdf, 0xd5, 0xcd, 0x37, 0x28, 0x46, 0x92, 0x37,
-  0xdd, 0xb7, 0xd1, 0x37, 0x20, 0xc9, 0xb7, 0x37, 0x3f, 0x53, 0x17, 0x38,
-  0xc5, 0x9f, 0xc2, 0x37, 0x09, 0x59, 0xce, 0x37, 0x29, 0x8d, 0xb1, 0x37,
-  0xdf, 0x9c, 0xb7, 0x37, 0x79, 0xe3, 0x85, 0x37, 0xe2, 0xb2, 0x02, 0x38,
-  0x0b, 0xf9, 0xde, 0x37, 0x3e, 0x24, 0xb4, 0x37, 0x3b, 0x7e, 0xbf, 0x37,
-  0x7a, 0x59, 0xed, 0x37, 0x7a, 0x14, 0xb3, 0x37, 0xe0, 0x45, 0xdd, 0x37,
-  0xd3, 0x6e, 0xf0, 0x37, 0x05, 0x77, 0xb2, 0x37, 0xdd, 0x29, 0x0c, 0x38,
-  0x4a, 0xd3, 0xae, 0x37, 0x88, 0x63, 0xd5, 0x37, 0xa5, 0x41, 0x16, 0x38,
-  0xf1, 0xcf, 0xea, 0x37, 0xb5, 0x9f, 0x99, 0x37, 0xed, 0x71, 0x2d, 0x38,
-  0x83, 0xb2, 0xb8, 0x37, 0x42, 0xa5, 0xe3, 0x37, 0xcb, 0xb4, 0xad, 0x37,
-  0xe0, 0xcc, 0xa6, 0x37, 0xb5, 0xac, 0xbb, 0x37, 0xdb, 0xf9, 0xe8, 0x37,
-  0x30, 0xeb, 0xd8, 0x37, 0x4a, 0x88, 0xac, 0x37, 0x0b, 0xfc, 0xdd, 0x37,
-  0x05, 0xfe, 0xf0, 0x37, 0xe9, 0x96, 0x97, 0x37, 0x23, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x32, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x66, 0xce, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x00, 0x00,
-  0xdc, 0xcd, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x6b, 0x7d, 0xb7, 0x37, 0x8c, 0xfc, 0xab, 0x37,
+  0x60, 0x3b, 0x35, 0x38, 0xaf, 0x99, 0x21, 0x38, 0x4a, 0xeb, 0x3e, 0x38,
+  0xf8, 0xe9, 0xfa, 0x37, 0xb1, 0xd4, 0xc5, 0x37, 0x74, 0x49, 0x0d, 0x38,
+  0x0d, 0xb0, 0x12, 0x38, 0xeb, 0xe7, 0xf3, 0x37, 0xd5, 0x76, 0xab, 0x37,
+  0xec, 0x2a, 0x0a, 0x38, 0xff, 0x16, 0xac, 0x37, 0x85, 0x2d, 0x0d, 0x38,
+  0x07, 0x3f, 0xbf, 0x37, 0xba, 0xad, 0x0d, 0x38, 0x86, 0xf1, 0x06, 0x38,
+  0xc3, 0x50, 0x12, 0x38, 0xa0, 0x1d, 0xee, 0x37, 0x19, 0x32, 0xe2, 0x37,
+  0x41, 0xe4, 0xbe, 0x37, 0x34, 0xb6, 0xac, 0x37, 0xe0, 0xcb, 0xcb, 0x37,
+  0x4d, 0xac, 0x9c, 0x37, 0x8b, 0x70, 0x1a, 0x38, 0x9c, 0xaf, 0x26, 0x38,
+  0x76, 0x6e, 0xe1, 0x37, 0xc5, 0xaf, 0xbd, 0x37, 0x5d, 0x59, 0x01, 0x38,
+  0x02, 0x7e, 0xc6, 0x37, 0x6f, 0xe0, 0xb1, 0x37, 0xe9, 0x2e, 0xf5, 0x37,
+  0x85, 0x33, 0x11, 0x38, 0xf7, 0x9d, 0xdd, 0x37, 0x19, 0x1d, 0x9f, 0x37,
+  0x87, 0x1c, 0x10, 0x38, 0x26, 0x31, 0x93, 0x37, 0xf1, 0x21, 0x15, 0x38,
+  0x4e, 0x95, 0x0d, 0x38, 0x8d, 0xc3, 0xcc, 0x37, 0x20, 0x8f, 0xdf, 0x37,
+  0x1e, 0x59, 0xd5, 0x37, 0xe4, 0x31, 0xce, 0x37, 0x12, 0x0a, 0xdc, 0x37,
+  0x8b, 0xd7, 0x8a, 0x37, 0x30, 0x02, 0xd0, 0x37, 0x8a, 0xc3, 0xb7, 0x37,
+  0xce, 0x3b, 0x14, 0x38, 0x15, 0x42, 0x81, 0x37, 0x74, 0x72, 0xe7, 0x37,
+  0x9c, 0xef, 0x81, 0x37, 0x23, 0x73, 0xe9, 0x37, 0x14, 0xd1, 0x60, 0x38,
+  0xeb, 0xf5, 0x18, 0x38, 0x64, 0x77, 0xdf, 0x37, 0xbe, 0x6b, 0xfe, 0x37,
+  0xf6, 0xb7, 0x34, 0x38, 0xb3, 0x3a, 0x2f, 0x38, 0x63, 0x38, 0xb5, 0x37,
+  0xf8, 0x18, 0x7f, 0x37, 0x0f, 0xb3, 0x28, 0x38, 0xef, 0xc6, 0xfd, 0x37,
+  0xa0, 0xab, 0x13, 0x38, 0x8c, 0xf1, 0x13, 0x38, 0x01, 0xba, 0xb9, 0x37,
+  0xce, 0xa2, 0xd9, 0x37, 0x09, 0xe5, 0xca, 0x37, 0xbd, 0xa9, 0xb9, 0x37,
+  0x2c, 0x62, 0x0f, 0x38, 0x0a, 0xa3, 0xbe, 0x37, 0x96, 0xc3, 0x9f, 0x37,
+  0x3a, 0x1e, 0xb8, 0x37, 0xbf, 0x8c, 0xd4, 0x37, 0xc1, 0x80, 0xfd, 0x37,
+  0x31, 0x5e, 0x06, 0x38, 0x4c, 0x3e, 0xdb, 0x37, 0x1a, 0x59, 0xa5, 0x37,
+  0x3a, 0x77, 0xd0, 0x37, 0x34, 0xca, 0xb3, 0x37, 0x77, 0x15, 0xdd, 0x37,
+  0x80, 0x98, 0x07, 0x38, 0xc9, 0x77, 0x1c, 0x38, 0xc7, 0x74, 0xbc, 0x37,
+  0x7c, 0x42, 0xd9, 0x37, 0x41, 0x6b, 0x00, 0x38, 0x54, 0x4e, 0x15, 0x38,
+  0x91, 0xaf, 0xe0, 0x37, 0x8b, 0x46, 0xef, 0x37, 0x22, 0x02, 0x04, 0x38,
+  0x0c, 0x2f, 0xc1, 0x37, 0x84, 0xd4, 0x9f, 0x37, 0xdf, 0xd5, 0xcd, 0x37,
+  0x28, 0x46, 0x92, 0x37, 0xdd, 0xb7, 0xd1, 0x37, 0x20, 0xc9, 0xb7, 0x37,
+  0x3f, 0x53, 0x17, 0x38, 0xc5, 0x9f, 0xc2, 0x37, 0x09, 0x59, 0xce, 0x37,
+  0x29, 0x8d, 0xb1, 0x37, 0xdf, 0x9c, 0xb7, 0x37, 0x79, 0xe3, 0x85, 0x37,
+  0xe2, 0xb2, 0x02, 0x38, 0x0b, 0xf9, 0xde, 0x37, 0x3e, 0x24, 0xb4, 0x37,
+  0x3b, 0x7e, 0xbf, 0x37, 0x7a, 0x59, 0xed, 0x37, 0x7a, 0x14, 0xb3, 0x37,
+  0xe0, 0x45, 0xdd, 0x37, 0xd3, 0x6e, 0xf0, 0x37, 0x05, 0x77, 0xb2, 0x37,
+  0xdd, 0x29, 0x0c, 0x38, 0x4a, 0xd3, 0xae, 0x37, 0x88, 0x63, 0xd5, 0x37,
+  0xa5, 0x41, 0x16, 0x38, 0xf1, 0xcf, 0xea, 0x37, 0xb5, 0x9f, 0x99, 0x37,
+  0xed, 0x71, 0x2d, 0x38, 0x83, 0xb2, 0xb8, 0x37, 0x42, 0xa5, 0xe3, 0x37,
+  0xcb, 0xb4, 0xad, 0x37, 0xe0, 0xcc, 0xa6, 0x37, 0xb5, 0xac, 0xbb, 0x37,
+  0xdb, 0xf9, 0xe8, 0x37, 0x30, 0xeb, 0xd8, 0x37, 0x4a, 0x88, 0xac, 0x37,
+  0x0b, 0xfc, 0xdd, 0x37, 0x05, 0xfe, 0xf0, 0x37, 0xe9, 0x96, 0x97, 0x37,
+  0x23, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
+  0x32, 0x64, 0x5f, 0x33, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
+  0x73, 0x65, 0x32, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x66, 0xce, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x24, 0x06, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x40, 0x06, 0x00, 0x00, 0xdc, 0xcd, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -5207,59 +5216,58 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0xbd, 0x63, 0xbf, 0x37, 0x25, 0x6e, 0x7f, 0x37, 0x48, 0xa6, 0xb2, 0x37,
-  0xb2, 0x6a, 0x8f, 0x37, 0xc4, 0xa3, 0x93, 0x37, 0xfc, 0x8e, 0x4b, 0x37,
-  0x3b, 0xf0, 0x9c, 0x37, 0x0e, 0xe0, 0xb2, 0x37, 0xe2, 0xb1, 0xc5, 0x37,
-  0x4f, 0x3a, 0xae, 0x37, 0xb3, 0xda, 0xec, 0x37, 0x75, 0xe2, 0xbc, 0x37,
-  0x95, 0x5d, 0xb8, 0x37, 0x25, 0x40, 0x3f, 0x37, 0x3b, 0x79, 0x6b, 0x37,
-  0x42, 0x40, 0xf8, 0x37, 0xa2, 0xe8, 0xaa, 0x37, 0xa2, 0x4f, 0x82, 0x37,
-  0x4c, 0x28, 0x92, 0x37, 0x34, 0xc6, 0xcd, 0x37, 0xf7, 0x5f, 0xa2, 0x37,
-  0x4e, 0xb8, 0xb5, 0x37, 0xf7, 0xe2, 0xee, 0x37, 0xf9, 0xc6, 0xbb, 0x37,
-  0x67, 0xed, 0xdd, 0x37, 0x6c, 0x68, 0x04, 0x38, 0xfa, 0x8c, 0xbf, 0x37,
-  0xa6, 0xff, 0x87, 0x37, 0xcc, 0x97, 0x9e, 0x37, 0xea, 0x72, 0x71, 0x37,
-  0x74, 0x64, 0x8c, 0x37, 0x88, 0x37, 0x9d, 0x37, 0x0b, 0x66, 0xa2, 0x37,
-  0xce, 0x83, 0x3a, 0x37, 0x16, 0xed, 0xc1, 0x37, 0x07, 0x9b, 0x9d, 0x37,
-  0x04, 0x9c, 0xc1, 0x37, 0x13, 0xf8, 0xac, 0x37, 0x54, 0xca, 0xca, 0x37,
-  0x7e, 0x59, 0x87, 0x37, 0xaa, 0x08, 0xc8, 0x37, 0x2a, 0x06, 0xcc, 0x37,
-  0xa7, 0x26, 0x85, 0x37, 0xcf, 0x32, 0x6b, 0x37, 0x78, 0x67, 0x8f, 0x37,
-  0x6c, 0xd0, 0xbe, 0x37, 0x93, 0x50, 0xa6, 0x37, 0x18, 0xae, 0x9d, 0x37,
-  0xb4, 0xfd, 0xa6, 0x37, 0x99, 0x44, 0x81, 0x37, 0x21, 0x84, 0x8b, 0x37,
-  0xea, 0xd5, 0xb7, 0x37, 0xac, 0xc1, 0xd8, 0x37, 0xc5, 0x89, 0x95, 0x37,
-  0x48, 0xbd, 0xbb, 0x37, 0x0b, 0xed, 0x97, 0x37, 0x0b, 0xe8, 0x86, 0x37,
-  0x51, 0xcf, 0x92, 0x37, 0xae, 0x2d, 0x7e, 0x37, 0xd5, 0x8c, 0xbe, 0x37,
-  0x05, 0x6e, 0x92, 0x37, 0xfb, 0x1e, 0xaa, 0x37, 0xae, 0x6e, 0xb2, 0x37,
-  0x00, 0xe3, 0x92, 0x37, 0xbc, 0x24, 0x77, 0x37, 0x1f, 0x5c, 0x8f, 0x37,
-  0x5f, 0xd4, 0xd8, 0x37, 0x73, 0xe5, 0x91, 0x37, 0xe0, 0xd9, 0x99, 0x37,
-  0x52, 0xcb, 0x68, 0x37, 0xef, 0xe5, 0x98, 0x37, 0x19, 0xeb, 0xa3, 0x37,
-  0x4e, 0x98, 0x86, 0x37, 0xf3, 0x97, 0x67, 0x37, 0x41, 0xb9, 0x94, 0x37,
-  0x41, 0xb7, 0x8f, 0x37, 0x1e, 0x09, 0x8a, 0x37, 0xbd, 0xce, 0xb5, 0x37,
-  0x88, 0xb2, 0xc1, 0x37, 0x30, 0x4a, 0xd1, 0x37, 0xc9, 0x0d, 0x8f, 0x37,
-  0x86, 0x1b, 0xa5, 0x37, 0x29, 0xb0, 0xa1, 0x37, 0x0c, 0xe3, 0x90, 0x37,
-  0x00, 0xfb, 0x85, 0x37, 0xa3, 0x66, 0x9d, 0x37, 0xbc, 0xa9, 0x85, 0x37,
-  0xf8, 0x93, 0xa3, 0x37, 0x20, 0xde, 0x9d, 0x37, 0xdc, 0x42, 0xac, 0x37,
-  0x8f, 0xbe, 0x8d, 0x37, 0xdd, 0xcd, 0x84, 0x37, 0x85, 0xba, 0x05, 0x38,
-  0x9a, 0x46, 0xbb, 0x37, 0x58, 0x9f, 0xc4, 0x37, 0xbd, 0x92, 0xa7, 0x37,
-  0x21, 0x78, 0xcf, 0x37, 0xdc, 0xe0, 0x85, 0x37, 0xa3, 0x59, 0x4f, 0x37,
-  0x45, 0x05, 0xb8, 0x37, 0x7d, 0xcc, 0x99, 0x37, 0x3c, 0xf3, 0xc8, 0x37,
-  0xe6, 0x1e, 0x55, 0x37, 0x20, 0x18, 0xd4, 0x37, 0xd3, 0xa3, 0x89, 0x37,
-  0xb7, 0x14, 0xc3, 0x37, 0x76, 0xb8, 0xad, 0x37, 0xd4, 0xf8, 0x9d, 0x37,
-  0xd8, 0x38, 0x14, 0x38, 0xe2, 0x55, 0xb4, 0x37, 0x33, 0xd4, 0xe6, 0x37,
-  0xd2, 0xbd, 0x92, 0x37, 0x59, 0x41, 0x9e, 0x37, 0x4b, 0x6d, 0x9a, 0x37,
-  0x74, 0x36, 0x8a, 0x37, 0x23, 0x16, 0xd6, 0x37, 0x71, 0x3a, 0xa7, 0x37,
-  0x6f, 0x59, 0xb1, 0x37, 0x12, 0xac, 0xaa, 0x37, 0xfb, 0xd8, 0x73, 0x37,
-  0x66, 0x44, 0xa4, 0x37, 0x15, 0x87, 0xb1, 0x37, 0x25, 0x0d, 0xa6, 0x37,
-  0x8f, 0xa4, 0xb3, 0x37, 0x06, 0xb2, 0xb1, 0x37, 0xb9, 0xf5, 0x90, 0x37,
-  0x35, 0x9c, 0xbc, 0x37, 0x79, 0xb6, 0x88, 0x37, 0x22, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xc6, 0xd4, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x06, 0x00, 0x00,
-  0x3c, 0xd4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0xbd, 0x63, 0xbf, 0x37, 0x25, 0x6e, 0x7f, 0x37,
+  0x48, 0xa6, 0xb2, 0x37, 0xb2, 0x6a, 0x8f, 0x37, 0xc4, 0xa3, 0x93, 0x37,
+  0xfc, 0x8e, 0x4b, 0x37, 0x3b, 0xf0, 0x9c, 0x37, 0x0e, 0xe0, 0xb2, 0x37,
+  0xe2, 0xb1, 0xc5, 0x37, 0x4f, 0x3a, 0xae, 0x37, 0xb3, 0xda, 0xec, 0x37,
+  0x75, 0xe2, 0xbc, 0x37, 0x95, 0x5d, 0xb8, 0x37, 0x25, 0x40, 0x3f, 0x37,
+  0x3b, 0x79, 0x6b, 0x37, 0x42, 0x40, 0xf8, 0x37, 0xa2, 0xe8, 0xaa, 0x37,
+  0xa2, 0x4f, 0x82, 0x37, 0x4c, 0x28, 0x92, 0x37, 0x34, 0xc6, 0xcd, 0x37,
+  0xf7, 0x5f, 0xa2, 0x37, 0x4e, 0xb8, 0xb5, 0x37, 0xf7, 0xe2, 0xee, 0x37,
+  0xf9, 0xc6, 0xbb, 0x37, 0x67, 0xed, 0xdd, 0x37, 0x6c, 0x68, 0x04, 0x38,
+  0xfa, 0x8c, 0xbf, 0x37, 0xa6, 0xff, 0x87, 0x37, 0xcc, 0x97, 0x9e, 0x37,
+  0xea, 0x72, 0x71, 0x37, 0x74, 0x64, 0x8c, 0x37, 0x88, 0x37, 0x9d, 0x37,
+  0x0b, 0x66, 0xa2, 0x37, 0xce, 0x83, 0x3a, 0x37, 0x16, 0xed, 0xc1, 0x37,
+  0x07, 0x9b, 0x9d, 0x37, 0x04, 0x9c, 0xc1, 0x37, 0x13, 0xf8, 0xac, 0x37,
+  0x54, 0xca, 0xca, 0x37, 0x7e, 0x59, 0x87, 0x37, 0xaa, 0x08, 0xc8, 0x37,
+  0x2a, 0x06, 0xcc, 0x37, 0xa7, 0x26, 0x85, 0x37, 0xcf, 0x32, 0x6b, 0x37,
+  0x78, 0x67, 0x8f, 0x37, 0x6c, 0xd0, 0xbe, 0x37, 0x93, 0x50, 0xa6, 0x37,
+  0x18, 0xae, 0x9d, 0x37, 0xb4, 0xfd, 0xa6, 0x37, 0x99, 0x44, 0x81, 0x37,
+  0x21, 0x84, 0x8b, 0x37, 0xea, 0xd5, 0xb7, 0x37, 0xac, 0xc1, 0xd8, 0x37,
+  0xc5, 0x89, 0x95, 0x37, 0x48, 0xbd, 0xbb, 0x37, 0x0b, 0xed, 0x97, 0x37,
+  0x0b, 0xe8, 0x86, 0x37, 0x51, 0xcf, 0x92, 0x37, 0xae, 0x2d, 0x7e, 0x37,
+  0xd5, 0x8c, 0xbe, 0x37, 0x05, 0x6e, 0x92, 0x37, 0xfb, 0x1e, 0xaa, 0x37,
+  0xae, 0x6e, 0xb2, 0x37, 0x00, 0xe3, 0x92, 0x37, 0xbc, 0x24, 0x77, 0x37,
+  0x1f, 0x5c, 0x8f, 0x37, 0x5f, 0xd4, 0xd8, 0x37, 0x73, 0xe5, 0x91, 0x37,
+  0xe0, 0xd9, 0x99, 0x37, 0x52, 0xcb, 0x68, 0x37, 0xef, 0xe5, 0x98, 0x37,
+  0x19, 0xeb, 0xa3, 0x37, 0x4e, 0x98, 0x86, 0x37, 0xf3, 0x97, 0x67, 0x37,
+  0x41, 0xb9, 0x94, 0x37, 0x41, 0xb7, 0x8f, 0x37, 0x1e, 0x09, 0x8a, 0x37,
+  0xbd, 0xce, 0xb5, 0x37, 0x88, 0xb2, 0xc1, 0x37, 0x30, 0x4a, 0xd1, 0x37,
+  0xc9, 0x0d, 0x8f, 0x37, 0x86, 0x1b, 0xa5, 0x37, 0x29, 0xb0, 0xa1, 0x37,
+  0x0c, 0xe3, 0x90, 0x37, 0x00, 0xfb, 0x85, 0x37, 0xa3, 0x66, 0x9d, 0x37,
+  0xbc, 0xa9, 0x85, 0x37, 0xf8, 0x93, 0xa3, 0x37, 0x20, 0xde, 0x9d, 0x37,
+  0xdc, 0x42, 0xac, 0x37, 0x8f, 0xbe, 0x8d, 0x37, 0xdd, 0xcd, 0x84, 0x37,
+  0x85, 0xba, 0x05, 0x38, 0x9a, 0x46, 0xbb, 0x37, 0x58, 0x9f, 0xc4, 0x37,
+  0xbd, 0x92, 0xa7, 0x37, 0x21, 0x78, 0xcf, 0x37, 0xdc, 0xe0, 0x85, 0x37,
+  0xa3, 0x59, 0x4f, 0x37, 0x45, 0x05, 0xb8, 0x37, 0x7d, 0xcc, 0x99, 0x37,
+  0x3c, 0xf3, 0xc8, 0x37, 0xe6, 0x1e, 0x55, 0x37, 0x20, 0x18, 0xd4, 0x37,
+  0xd3, 0xa3, 0x89, 0x37, 0xb7, 0x14, 0xc3, 0x37, 0x76, 0xb8, 0xad, 0x37,
+  0xd4, 0xf8, 0x9d, 0x37, 0xd8, 0x38, 0x14, 0x38, 0xe2, 0x55, 0xb4, 0x37,
+  0x33, 0xd4, 0xe6, 0x37, 0xd2, 0xbd, 0x92, 0x37, 0x59, 0x41, 0x9e, 0x37,
+  0x4b, 0x6d, 0x9a, 0x37, 0x74, 0x36, 0x8a, 0x37, 0x23, 0x16, 0xd6, 0x37,
+  0x71, 0x3a, 0xa7, 0x37, 0x6f, 0x59, 0xb1, 0x37, 0x12, 0xac, 0xaa, 0x37,
+  0xfb, 0xd8, 0x73, 0x37, 0x66, 0x44, 0xa4, 0x37, 0x15, 0x87, 0xb1, 0x37,
+  0x25, 0x0d, 0xa6, 0x37, 0x8f, 0xa4, 0xb3, 0x37, 0x06, 0xb2, 0xb1, 0x37,
+  0xb9, 0xf5, 0x90, 0x37, 0x35, 0x9c, 0xbc, 0x37, 0x79, 0xb6, 0x88, 0x37,
+  0x22, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
+  0x32, 0x64, 0x5f, 0x33, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
+  0x73, 0x65, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0xc6, 0xd4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x24, 0x06, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x34, 0x06, 0x00, 0x00, 0x3c, 0xd4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -5343,60 +5351,60 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x18, 0xe5, 0x7c, 0x3c, 0x02, 0xb8, 0x80, 0x3c, 0x2e, 0x58, 0x7f, 0x3c,
-  0x0a, 0xa8, 0x85, 0x3c, 0x09, 0x1f, 0x64, 0x3c, 0x62, 0x79, 0x59, 0x3c,
-  0x70, 0x86, 0x6c, 0x3c, 0xfa, 0x36, 0x84, 0x3c, 0x78, 0x74, 0x64, 0x3c,
-  0x5d, 0x3c, 0x75, 0x3c, 0xd0, 0x31, 0x84, 0x3c, 0x2e, 0xe1, 0x9a, 0x3c,
-  0x21, 0x3c, 0x74, 0x3c, 0x3c, 0xa6, 0x66, 0x3c, 0xf1, 0x09, 0x65, 0x3c,
-  0x8a, 0x80, 0x74, 0x3c, 0x58, 0x51, 0x6b, 0x3c, 0xc8, 0x53, 0x48, 0x3c,
-  0x49, 0x64, 0x64, 0x3c, 0x91, 0x22, 0x7e, 0x3c, 0xcd, 0xde, 0x83, 0x3c,
-  0x4d, 0x98, 0x85, 0x3c, 0xdc, 0x99, 0x82, 0x3c, 0x7c, 0xcd, 0x8a, 0x3c,
-  0x27, 0x93, 0x9f, 0x3c, 0x60, 0x15, 0x7b, 0x3c, 0x7f, 0xe3, 0x5b, 0x3c,
-  0xc2, 0x4d, 0x8e, 0x3c, 0x32, 0x46, 0x8c, 0x3c, 0x0a, 0xcf, 0x61, 0x3c,
-  0xa7, 0xbf, 0xa8, 0x3c, 0x35, 0xbc, 0x87, 0x3c, 0x7f, 0x27, 0x99, 0x3c,
-  0xb7, 0xc2, 0x5f, 0x3c, 0x28, 0x5a, 0x7a, 0x3c, 0xf2, 0x1c, 0x61, 0x3c,
-  0x55, 0x0b, 0x66, 0x3c, 0x8e, 0x2f, 0x5b, 0x3c, 0x2f, 0x42, 0x84, 0x3c,
-  0x82, 0x6a, 0x67, 0x3c, 0xa2, 0x0f, 0x73, 0x3c, 0xd9, 0xd9, 0x78, 0x3c,
-  0xd3, 0x02, 0x54, 0x3c, 0x5b, 0x2e, 0x67, 0x3c, 0x08, 0x54, 0x73, 0x3c,
-  0x51, 0x85, 0x55, 0x3c, 0x13, 0xc5, 0x8a, 0x3c, 0x43, 0xc4, 0x95, 0x3c,
-  0x2c, 0x3d, 0x53, 0x3c, 0x08, 0x79, 0x90, 0x3c, 0x92, 0x13, 0x62, 0x3c,
-  0x85, 0x3a, 0x87, 0x3c, 0xb3, 0x3a, 0x94, 0x3c, 0x33, 0x7a, 0x78, 0x3c,
-  0x5d, 0xc7, 0x95, 0x3c, 0x0a, 0x59, 0x79, 0x3c, 0x1d, 0x46, 0x99, 0x3c,
-  0x2d, 0x61, 0x84, 0x3c, 0xe0, 0x90, 0x93, 0x3c, 0x6c, 0x49, 0x70, 0x3c,
-  0xb3, 0xe0, 0x74, 0x3c, 0x7d, 0x84, 0x7c, 0x3c, 0x7a, 0xd9, 0xa0, 0x3c,
-  0xd4, 0xd9, 0x8a, 0x3c, 0x72, 0x71, 0xb5, 0x3c, 0xa2, 0xc5, 0x71, 0x3c,
-  0xee, 0x23, 0x57, 0x3c, 0xa0, 0x60, 0x75, 0x3c, 0x23, 0xd6, 0x8c, 0x3c,
-  0xa3, 0x1f, 0x91, 0x3c, 0x05, 0x13, 0x89, 0x3c, 0x70, 0x1c, 0x7a, 0x3c,
-  0xdb, 0x96, 0x84, 0x3c, 0x8c, 0x43, 0x85, 0x3c, 0x3f, 0x7f, 0x64, 0x3c,
-  0xaa, 0x2b, 0x7c, 0x3c, 0x49, 0xc4, 0x57, 0x3c, 0x5c, 0xc0, 0x92, 0x3c,
-  0xd5, 0xd0, 0x4c, 0x3c, 0x75, 0xf6, 0x64, 0x3c, 0x86, 0xf0, 0x8e, 0x3c,
-  0x2c, 0x3a, 0x62, 0x3c, 0x0c, 0x3b, 0x62, 0x3c, 0x6f, 0x3b, 0x7e, 0x3c,
-  0x09, 0x99, 0x7c, 0x3c, 0xbb, 0x85, 0xad, 0x3c, 0x72, 0x58, 0x9c, 0x3c,
-  0x2b, 0x7a, 0x83, 0x3c, 0x00, 0xc9, 0x70, 0x3c, 0x37, 0x52, 0x50, 0x3c,
-  0x5b, 0xf1, 0x40, 0x3c, 0x8d, 0x5b, 0x6b, 0x3c, 0xe0, 0x96, 0x6a, 0x3c,
-  0x88, 0x44, 0x5e, 0x3c, 0x9f, 0x9f, 0x8a, 0x3c, 0x6e, 0xe0, 0x88, 0x3c,
-  0x2c, 0x38, 0x5f, 0x3c, 0x86, 0xca, 0x9e, 0x3c, 0x51, 0x79, 0x4f, 0x3c,
-  0xf5, 0x7f, 0x5b, 0x3c, 0xa4, 0x00, 0x6d, 0x3c, 0xeb, 0x04, 0x77, 0x3c,
-  0xfd, 0x53, 0x90, 0x3c, 0x96, 0x15, 0x94, 0x3c, 0x32, 0x99, 0x85, 0x3c,
-  0x92, 0x30, 0xa3, 0x3c, 0xca, 0x08, 0x87, 0x3c, 0x5e, 0xc9, 0x75, 0x3c,
-  0xf4, 0x48, 0x43, 0x3c, 0x56, 0xa0, 0x52, 0x3c, 0x05, 0x3c, 0x8a, 0x3c,
-  0xf0, 0x16, 0x9e, 0x3c, 0xb4, 0xd1, 0x99, 0x3c, 0x6d, 0x46, 0x74, 0x3c,
-  0x6e, 0x2a, 0x9e, 0x3c, 0x4a, 0x19, 0x9d, 0x3c, 0x14, 0xb0, 0x84, 0x3c,
-  0xc9, 0x6b, 0xa8, 0x3c, 0x4e, 0x24, 0x5f, 0x3c, 0xb4, 0x04, 0x5c, 0x3c,
-  0xd9, 0x99, 0x62, 0x3c, 0x76, 0x45, 0xb5, 0x3c, 0x78, 0x9a, 0x9e, 0x3c,
-  0xf2, 0xbc, 0x71, 0x3c, 0xf9, 0x1b, 0xa0, 0x3c, 0x53, 0x05, 0x68, 0x3c,
-  0x6f, 0xe3, 0x5b, 0x3c, 0xfd, 0xa0, 0x8d, 0x3c, 0x15, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x26, 0xdb, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4c, 0x06, 0x00, 0x00,
-  0x9c, 0xda, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x18, 0xe5, 0x7c, 0x3c, 0x02, 0xb8, 0x80, 0x3c,
+  0x2e, 0x58, 0x7f, 0x3c, 0x0a, 0xa8, 0x85, 0x3c, 0x09, 0x1f, 0x64, 0x3c,
+  0x62, 0x79, 0x59, 0x3c, 0x70, 0x86, 0x6c, 0x3c, 0xfa, 0x36, 0x84, 0x3c,
+  0x78, 0x74, 0x64, 0x3c, 0x5d, 0x3c, 0x75, 0x3c, 0xd0, 0x31, 0x84, 0x3c,
+  0x2e, 0xe1, 0x9a, 0x3c, 0x21, 0x3c, 0x74, 0x3c, 0x3c, 0xa6, 0x66, 0x3c,
+  0xf1, 0x09, 0x65, 0x3c, 0x8a, 0x80, 0x74, 0x3c, 0x58, 0x51, 0x6b, 0x3c,
+  0xc8, 0x53, 0x48, 0x3c, 0x49, 0x64, 0x64, 0x3c, 0x91, 0x22, 0x7e, 0x3c,
+  0xcd, 0xde, 0x83, 0x3c, 0x4d, 0x98, 0x85, 0x3c, 0xdc, 0x99, 0x82, 0x3c,
+  0x7c, 0xcd, 0x8a, 0x3c, 0x27, 0x93, 0x9f, 0x3c, 0x60, 0x15, 0x7b, 0x3c,
+  0x7f, 0xe3, 0x5b, 0x3c, 0xc2, 0x4d, 0x8e, 0x3c, 0x32, 0x46, 0x8c, 0x3c,
+  0x0a, 0xcf, 0x61, 0x3c, 0xa7, 0xbf, 0xa8, 0x3c, 0x35, 0xbc, 0x87, 0x3c,
+  0x7f, 0x27, 0x99, 0x3c, 0xb7, 0xc2, 0x5f, 0x3c, 0x28, 0x5a, 0x7a, 0x3c,
+  0xf2, 0x1c, 0x61, 0x3c, 0x55, 0x0b, 0x66, 0x3c, 0x8e, 0x2f, 0x5b, 0x3c,
+  0x2f, 0x42, 0x84, 0x3c, 0x82, 0x6a, 0x67, 0x3c, 0xa2, 0x0f, 0x73, 0x3c,
+  0xd9, 0xd9, 0x78, 0x3c, 0xd3, 0x02, 0x54, 0x3c, 0x5b, 0x2e, 0x67, 0x3c,
+  0x08, 0x54, 0x73, 0x3c, 0x51, 0x85, 0x55, 0x3c, 0x13, 0xc5, 0x8a, 0x3c,
+  0x43, 0xc4, 0x95, 0x3c, 0x2c, 0x3d, 0x53, 0x3c, 0x08, 0x79, 0x90, 0x3c,
+  0x92, 0x13, 0x62, 0x3c, 0x85, 0x3a, 0x87, 0x3c, 0xb3, 0x3a, 0x94, 0x3c,
+  0x33, 0x7a, 0x78, 0x3c, 0x5d, 0xc7, 0x95, 0x3c, 0x0a, 0x59, 0x79, 0x3c,
+  0x1d, 0x46, 0x99, 0x3c, 0x2d, 0x61, 0x84, 0x3c, 0xe0, 0x90, 0x93, 0x3c,
+  0x6c, 0x49, 0x70, 0x3c, 0xb3, 0xe0, 0x74, 0x3c, 0x7d, 0x84, 0x7c, 0x3c,
+  0x7a, 0xd9, 0xa0, 0x3c, 0xd4, 0xd9, 0x8a, 0x3c, 0x72, 0x71, 0xb5, 0x3c,
+  0xa2, 0xc5, 0x71, 0x3c, 0xee, 0x23, 0x57, 0x3c, 0xa0, 0x60, 0x75, 0x3c,
+  0x23, 0xd6, 0x8c, 0x3c, 0xa3, 0x1f, 0x91, 0x3c, 0x05, 0x13, 0x89, 0x3c,
+  0x70, 0x1c, 0x7a, 0x3c, 0xdb, 0x96, 0x84, 0x3c, 0x8c, 0x43, 0x85, 0x3c,
+  0x3f, 0x7f, 0x64, 0x3c, 0xaa, 0x2b, 0x7c, 0x3c, 0x49, 0xc4, 0x57, 0x3c,
+  0x5c, 0xc0, 0x92, 0x3c, 0xd5, 0xd0, 0x4c, 0x3c, 0x75, 0xf6, 0x64, 0x3c,
+  0x86, 0xf0, 0x8e, 0x3c, 0x2c, 0x3a, 0x62, 0x3c, 0x0c, 0x3b, 0x62, 0x3c,
+  0x6f, 0x3b, 0x7e, 0x3c, 0x09, 0x99, 0x7c, 0x3c, 0xbb, 0x85, 0xad, 0x3c,
+  0x72, 0x58, 0x9c, 0x3c, 0x2b, 0x7a, 0x83, 0x3c, 0x00, 0xc9, 0x70, 0x3c,
+  0x37, 0x52, 0x50, 0x3c, 0x5b, 0xf1, 0x40, 0x3c, 0x8d, 0x5b, 0x6b, 0x3c,
+  0xe0, 0x96, 0x6a, 0x3c, 0x88, 0x44, 0x5e, 0x3c, 0x9f, 0x9f, 0x8a, 0x3c,
+  0x6e, 0xe0, 0x88, 0x3c, 0x2c, 0x38, 0x5f, 0x3c, 0x86, 0xca, 0x9e, 0x3c,
+  0x51, 0x79, 0x4f, 0x3c, 0xf5, 0x7f, 0x5b, 0x3c, 0xa4, 0x00, 0x6d, 0x3c,
+  0xeb, 0x04, 0x77, 0x3c, 0xfd, 0x53, 0x90, 0x3c, 0x96, 0x15, 0x94, 0x3c,
+  0x32, 0x99, 0x85, 0x3c, 0x92, 0x30, 0xa3, 0x3c, 0xca, 0x08, 0x87, 0x3c,
+  0x5e, 0xc9, 0x75, 0x3c, 0xf4, 0x48, 0x43, 0x3c, 0x56, 0xa0, 0x52, 0x3c,
+  0x05, 0x3c, 0x8a, 0x3c, 0xf0, 0x16, 0x9e, 0x3c, 0xb4, 0xd1, 0x99, 0x3c,
+  0x6d, 0x46, 0x74, 0x3c, 0x6e, 0x2a, 0x9e, 0x3c, 0x4a, 0x19, 0x9d, 0x3c,
+  0x14, 0xb0, 0x84, 0x3c, 0xc9, 0x6b, 0xa8, 0x3c, 0x4e, 0x24, 0x5f, 0x3c,
+  0xb4, 0x04, 0x5c, 0x3c, 0xd9, 0x99, 0x62, 0x3c, 0x76, 0x45, 0xb5, 0x3c,
+  0x78, 0x9a, 0x9e, 0x3c, 0xf2, 0xbc, 0x71, 0x3c, 0xf9, 0x1b, 0xa0, 0x3c,
+  0x53, 0x05, 0x68, 0x3c, 0x6f, 0xe3, 0x5b, 0x3c, 0xfd, 0xa0, 0x8d, 0x3c,
+  0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
+  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
+  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x26, 0xdb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x24, 0x06, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x4c, 0x06, 0x00, 0x00, 0x9c, 0xda, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -5479,61 +5487,60 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x1b, 0xc7, 0xd5, 0x38, 0x27, 0x9e, 0xd9, 0x38, 0x32, 0xd9, 0xd7, 0x38,
-  0x2e, 0xf7, 0xe1, 0x38, 0x05, 0xd6, 0xc0, 0x38, 0xf7, 0xd5, 0xb7, 0x38,
-  0xa6, 0xf0, 0xc7, 0x38, 0x3a, 0x87, 0xdf, 0x38, 0x3d, 0x1e, 0xc1, 0x38,
-  0xa8, 0x4d, 0xcf, 0x38, 0x7f, 0x7e, 0xdf, 0x38, 0x58, 0xec, 0x02, 0x39,
-  0x0e, 0x75, 0xce, 0x38, 0x1d, 0xf9, 0xc2, 0x38, 0x98, 0x9c, 0xc1, 0x38,
-  0xe2, 0xae, 0xce, 0x38, 0x5e, 0xeb, 0xc6, 0x38, 0x56, 0x57, 0xa9, 0x38,
-  0x8f, 0x10, 0xc1, 0x38, 0x79, 0xd3, 0xd6, 0x38, 0x27, 0xf2, 0xde, 0x38,
-  0x92, 0xdc, 0xe1, 0x38, 0xca, 0xcc, 0xdc, 0x38, 0x83, 0xaa, 0xea, 0x38,
-  0x66, 0xe4, 0x06, 0x39, 0x1d, 0x3f, 0xd4, 0x38, 0x79, 0xe0, 0xb9, 0x38,
-  0xcb, 0x95, 0xf0, 0x38, 0x65, 0x27, 0xed, 0x38, 0x98, 0xe1, 0xbe, 0x38,
-  0xa4, 0xa5, 0x0e, 0x39, 0xe3, 0x7a, 0xe5, 0x38, 0xfb, 0x76, 0x01, 0x39,
-  0x5f, 0x26, 0xbd, 0x38, 0xdb, 0xa0, 0xd3, 0x38, 0x0c, 0x4b, 0xbe, 0x38,
-  0x2c, 0x76, 0xc2, 0x38, 0x5d, 0x48, 0xb9, 0x38, 0x2c, 0x9a, 0xdf, 0x38,
-  0x07, 0x9f, 0xc3, 0x38, 0x0a, 0x77, 0xcd, 0x38, 0xfd, 0x5b, 0xd2, 0x38,
-  0xbc, 0x37, 0xb3, 0x38, 0x2e, 0x6c, 0xc3, 0x38, 0xdc, 0xb0, 0xcd, 0x38,
-  0x71, 0x7e, 0xb4, 0x38, 0x4b, 0x9c, 0xea, 0x38, 0xc7, 0x33, 0xfd, 0x38,
-  0xa7, 0x90, 0xb2, 0x38, 0x90, 0x40, 0xf4, 0x38, 0x86, 0x1b, 0xbf, 0x38,
-  0xa1, 0x9f, 0xe4, 0x38, 0x67, 0x9a, 0xfa, 0x38, 0x23, 0x0b, 0xd2, 0x38,
-  0x05, 0x39, 0xfd, 0x38, 0x82, 0xc7, 0xd2, 0x38, 0xdd, 0x90, 0x01, 0x39,
-  0x92, 0xce, 0xdf, 0x38, 0x4a, 0x7b, 0xf9, 0x38, 0xaf, 0x1e, 0xcb, 0x38,
-  0x2c, 0x00, 0xcf, 0x38, 0x72, 0x75, 0xd5, 0x38, 0x40, 0xf8, 0x07, 0x39,
-  0x61, 0xbf, 0xea, 0x38, 0xc3, 0x60, 0x19, 0x39, 0x15, 0x60, 0xcc, 0x38,
-  0xed, 0xdc, 0xb5, 0x38, 0x4f, 0x6c, 0xcf, 0x38, 0xc0, 0x1a, 0xee, 0x38,
-  0x3c, 0x5a, 0xf5, 0x38, 0x76, 0xbe, 0xe7, 0x38, 0xaf, 0x6c, 0xd3, 0x38,
-  0x52, 0x29, 0xe0, 0x38, 0x48, 0x4d, 0xe1, 0x38, 0x5a, 0x27, 0xc1, 0x38,
-  0x5c, 0x2a, 0xd5, 0x38, 0x7a, 0x64, 0xb6, 0x38, 0xc3, 0x1a, 0xf8, 0x38,
-  0xa8, 0x22, 0xad, 0x38, 0x1f, 0x8c, 0xc1, 0x38, 0xf8, 0xa8, 0xf1, 0x38,
-  0x28, 0x3c, 0xbf, 0x38, 0xe5, 0x3c, 0xbf, 0x38, 0x7e, 0xe8, 0xd6, 0x38,
-  0xd0, 0x86, 0xd5, 0x38, 0xb1, 0xae, 0x12, 0x39, 0x91, 0x29, 0x04, 0x39,
-  0x04, 0x48, 0xde, 0x38, 0x87, 0x8a, 0xcb, 0x38, 0x3c, 0x19, 0xb0, 0x38,
-  0x51, 0x19, 0xa3, 0x38, 0xff, 0xf3, 0xc6, 0x38, 0xbd, 0x4d, 0xc6, 0x38,
-  0x4d, 0xe3, 0xbb, 0x38, 0xf9, 0x5c, 0xea, 0x38, 0xee, 0x68, 0xe7, 0x38,
-  0x42, 0xb1, 0xbc, 0x38, 0xce, 0x3a, 0x06, 0x39, 0xe2, 0x61, 0xaf, 0x38,
-  0x54, 0x8c, 0xb9, 0x38, 0xf4, 0x57, 0xc8, 0x38, 0x98, 0xcf, 0xd0, 0x38,
-  0xef, 0x01, 0xf4, 0x38, 0xa8, 0x5b, 0xfa, 0x38, 0x15, 0xde, 0xe1, 0x38,
-  0xad, 0xf2, 0x09, 0x39, 0x8e, 0x4b, 0xe4, 0x38, 0xda, 0xc4, 0xcf, 0x38,
-  0x2c, 0x14, 0xa5, 0x38, 0x13, 0x0c, 0xb2, 0x38, 0x95, 0xb4, 0xe9, 0x38,
-  0xff, 0xa2, 0x05, 0x39, 0xdc, 0x06, 0x02, 0x39, 0xc3, 0x7d, 0xce, 0x38,
-  0x79, 0xb3, 0x05, 0x39, 0x95, 0xcc, 0x04, 0x39, 0xf7, 0x53, 0xe0, 0x38,
-  0xbf, 0x5e, 0x0e, 0x39, 0x76, 0xa0, 0xbc, 0x38, 0x8b, 0xfc, 0xb9, 0x38,
-  0x08, 0x8d, 0xbf, 0x38, 0x95, 0x3b, 0x19, 0x39, 0x2f, 0x12, 0x06, 0x39,
-  0xbd, 0x58, 0xcc, 0x38, 0x0f, 0x58, 0x07, 0x39, 0xe6, 0x21, 0xc4, 0x38,
-  0x6b, 0xe0, 0xb9, 0x38, 0xb3, 0x71, 0xef, 0x38, 0x2c, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f,
-  0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x5f, 0x31, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74,
-  0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x92, 0xe1, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x2c, 0x06, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x48, 0x06, 0x00, 0x00,
-  0xba, 0xec, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x0c, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x1b, 0xc7, 0xd5, 0x38, 0x27, 0x9e, 0xd9, 0x38,
+  0x32, 0xd9, 0xd7, 0x38, 0x2e, 0xf7, 0xe1, 0x38, 0x05, 0xd6, 0xc0, 0x38,
+  0xf7, 0xd5, 0xb7, 0x38, 0xa6, 0xf0, 0xc7, 0x38, 0x3a, 0x87, 0xdf, 0x38,
+  0x3d, 0x1e, 0xc1, 0x38, 0xa8, 0x4d, 0xcf, 0x38, 0x7f, 0x7e, 0xdf, 0x38,
+  0x58, 0xec, 0x02, 0x39, 0x0e, 0x75, 0xce, 0x38, 0x1d, 0xf9, 0xc2, 0x38,
+  0x98, 0x9c, 0xc1, 0x38, 0xe2, 0xae, 0xce, 0x38, 0x5e, 0xeb, 0xc6, 0x38,
+  0x56, 0x57, 0xa9, 0x38, 0x8f, 0x10, 0xc1, 0x38, 0x79, 0xd3, 0xd6, 0x38,
+  0x27, 0xf2, 0xde, 0x38, 0x92, 0xdc, 0xe1, 0x38, 0xca, 0xcc, 0xdc, 0x38,
+  0x83, 0xaa, 0xea, 0x38, 0x66, 0xe4, 0x06, 0x39, 0x1d, 0x3f, 0xd4, 0x38,
+  0x79, 0xe0, 0xb9, 0x38, 0xcb, 0x95, 0xf0, 0x38, 0x65, 0x27, 0xed, 0x38,
+  0x98, 0xe1, 0xbe, 0x38, 0xa4, 0xa5, 0x0e, 0x39, 0xe3, 0x7a, 0xe5, 0x38,
+  0xfb, 0x76, 0x01, 0x39, 0x5f, 0x26, 0xbd, 0x38, 0xdb, 0xa0, 0xd3, 0x38,
+  0x0c, 0x4b, 0xbe, 0x38, 0x2c, 0x76, 0xc2, 0x38, 0x5d, 0x48, 0xb9, 0x38,
+  0x2c, 0x9a, 0xdf, 0x38, 0x07, 0x9f, 0xc3, 0x38, 0x0a, 0x77, 0xcd, 0x38,
+  0xfd, 0x5b, 0xd2, 0x38, 0xbc, 0x37, 0xb3, 0x38, 0x2e, 0x6c, 0xc3, 0x38,
+  0xdc, 0xb0, 0xcd, 0x38, 0x71, 0x7e, 0xb4, 0x38, 0x4b, 0x9c, 0xea, 0x38,
+  0xc7, 0x33, 0xfd, 0x38, 0xa7, 0x90, 0xb2, 0x38, 0x90, 0x40, 0xf4, 0x38,
+  0x86, 0x1b, 0xbf, 0x38, 0xa1, 0x9f, 0xe4, 0x38, 0x67, 0x9a, 0xfa, 0x38,
+  0x23, 0x0b, 0xd2, 0x38, 0x05, 0x39, 0xfd, 0x38, 0x82, 0xc7, 0xd2, 0x38,
+  0xdd, 0x90, 0x01, 0x39, 0x92, 0xce, 0xdf, 0x38, 0x4a, 0x7b, 0xf9, 0x38,
+  0xaf, 0x1e, 0xcb, 0x38, 0x2c, 0x00, 0xcf, 0x38, 0x72, 0x75, 0xd5, 0x38,
+  0x40, 0xf8, 0x07, 0x39, 0x61, 0xbf, 0xea, 0x38, 0xc3, 0x60, 0x19, 0x39,
+  0x15, 0x60, 0xcc, 0x38, 0xed, 0xdc, 0xb5, 0x38, 0x4f, 0x6c, 0xcf, 0x38,
+  0xc0, 0x1a, 0xee, 0x38, 0x3c, 0x5a, 0xf5, 0x38, 0x76, 0xbe, 0xe7, 0x38,
+  0xaf, 0x6c, 0xd3, 0x38, 0x52, 0x29, 0xe0, 0x38, 0x48, 0x4d, 0xe1, 0x38,
+  0x5a, 0x27, 0xc1, 0x38, 0x5c, 0x2a, 0xd5, 0x38, 0x7a, 0x64, 0xb6, 0x38,
+  0xc3, 0x1a, 0xf8, 0x38, 0xa8, 0x22, 0xad, 0x38, 0x1f, 0x8c, 0xc1, 0x38,
+  0xf8, 0xa8, 0xf1, 0x38, 0x28, 0x3c, 0xbf, 0x38, 0xe5, 0x3c, 0xbf, 0x38,
+  0x7e, 0xe8, 0xd6, 0x38, 0xd0, 0x86, 0xd5, 0x38, 0xb1, 0xae, 0x12, 0x39,
+  0x91, 0x29, 0x04, 0x39, 0x04, 0x48, 0xde, 0x38, 0x87, 0x8a, 0xcb, 0x38,
+  0x3c, 0x19, 0xb0, 0x38, 0x51, 0x19, 0xa3, 0x38, 0xff, 0xf3, 0xc6, 0x38,
+  0xbd, 0x4d, 0xc6, 0x38, 0x4d, 0xe3, 0xbb, 0x38, 0xf9, 0x5c, 0xea, 0x38,
+  0xee, 0x68, 0xe7, 0x38, 0x42, 0xb1, 0xbc, 0x38, 0xce, 0x3a, 0x06, 0x39,
+  0xe2, 0x61, 0xaf, 0x38, 0x54, 0x8c, 0xb9, 0x38, 0xf4, 0x57, 0xc8, 0x38,
+  0x98, 0xcf, 0xd0, 0x38, 0xef, 0x01, 0xf4, 0x38, 0xa8, 0x5b, 0xfa, 0x38,
+  0x15, 0xde, 0xe1, 0x38, 0xad, 0xf2, 0x09, 0x39, 0x8e, 0x4b, 0xe4, 0x38,
+  0xda, 0xc4, 0xcf, 0x38, 0x2c, 0x14, 0xa5, 0x38, 0x13, 0x0c, 0xb2, 0x38,
+  0x95, 0xb4, 0xe9, 0x38, 0xff, 0xa2, 0x05, 0x39, 0xdc, 0x06, 0x02, 0x39,
+  0xc3, 0x7d, 0xce, 0x38, 0x79, 0xb3, 0x05, 0x39, 0x95, 0xcc, 0x04, 0x39,
+  0xf7, 0x53, 0xe0, 0x38, 0xbf, 0x5e, 0x0e, 0x39, 0x76, 0xa0, 0xbc, 0x38,
+  0x8b, 0xfc, 0xb9, 0x38, 0x08, 0x8d, 0xbf, 0x38, 0x95, 0x3b, 0x19, 0x39,
+  0x2f, 0x12, 0x06, 0x39, 0xbd, 0x58, 0xcc, 0x38, 0x0f, 0x58, 0x07, 0x39,
+  0xe6, 0x21, 0xc4, 0x38, 0x6b, 0xe0, 0xb9, 0x38, 0xb3, 0x71, 0xef, 0x38,
+  0x2c, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61,
+  0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f, 0x46, 0x75, 0x73, 0x65,
+  0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x92, 0xe1, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x2c, 0x06, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x48, 0x06, 0x00, 0x00, 0xba, 0xec, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -5617,60 +5624,61 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xfa, 0x20, 0x87, 0x3a,
-  0x87, 0x50, 0x7d, 0x3a, 0x49, 0x77, 0x05, 0x3b, 0x5b, 0x04, 0xee, 0x3a,
-  0x96, 0x99, 0x0c, 0x3b, 0x4b, 0xc8, 0xb8, 0x3a, 0xa4, 0xb0, 0x91, 0x3a,
-  0x12, 0x19, 0xd0, 0x3a, 0x77, 0x0d, 0xd8, 0x3a, 0x16, 0x9f, 0xb3, 0x3a,
-  0x96, 0x8b, 0x7c, 0x3a, 0xef, 0x80, 0xcb, 0x3a, 0x7d, 0x77, 0x7d, 0x3a,
-  0xed, 0xef, 0xcf, 0x3a, 0x41, 0xd7, 0x8c, 0x3a, 0xc3, 0xac, 0xd0, 0x3a,
-  0x39, 0xc1, 0xc6, 0x3a, 0x1e, 0x81, 0xd7, 0x3a, 0x78, 0x5b, 0xaf, 0x3a,
-  0x36, 0x94, 0xa6, 0x3a, 0x68, 0x94, 0x8c, 0x3a, 0xfb, 0x61, 0x7e, 0x3a,
-  0x51, 0x15, 0x96, 0x3a, 0x7f, 0xc2, 0x66, 0x3a, 0x5f, 0x78, 0xe3, 0x3a,
-  0xef, 0x81, 0xf5, 0x3a, 0x23, 0x04, 0xa6, 0x3a, 0x3a, 0xb1, 0x8b, 0x3a,
-  0xd5, 0x83, 0xbe, 0x3a, 0x55, 0x2d, 0x92, 0x3a, 0xbb, 0xfe, 0x82, 0x3a,
-  0xe5, 0x8f, 0xb4, 0x3a, 0xfd, 0xdc, 0xd5, 0x3a, 0x02, 0x35, 0xa3, 0x3a,
-  0xbf, 0x5a, 0x6a, 0x3a, 0x12, 0x42, 0xd4, 0x3a, 0x9c, 0xcb, 0x58, 0x3a,
-  0x52, 0xa7, 0xdb, 0x3a, 0xca, 0x88, 0xd0, 0x3a, 0xb7, 0xcb, 0x96, 0x3a,
-  0x23, 0xa3, 0xa4, 0x3a, 0x15, 0x1e, 0x9d, 0x3a, 0x80, 0xd9, 0x97, 0x3a,
-  0x91, 0x0b, 0xa2, 0x3a, 0x2f, 0x7f, 0x4c, 0x3a, 0x6d, 0x2f, 0x99, 0x3a,
-  0x9e, 0x54, 0x87, 0x3a, 0x5c, 0x54, 0xda, 0x3a, 0x8b, 0x61, 0x3e, 0x3a,
-  0x3f, 0x72, 0xaa, 0x3a, 0x21, 0x61, 0x3f, 0x3a, 0xce, 0xeb, 0xab, 0x3a,
-  0x3c, 0x90, 0x25, 0x3b, 0xb4, 0x4a, 0xe1, 0x3a, 0xa8, 0x91, 0xa4, 0x3a,
-  0x72, 0x5d, 0xbb, 0x3a, 0x82, 0x16, 0x05, 0x3b, 0x9f, 0x0b, 0x01, 0x3b,
-  0x16, 0x75, 0x85, 0x3a, 0x04, 0xdd, 0x3b, 0x3a, 0x20, 0x79, 0xf8, 0x3a,
-  0x13, 0xe4, 0xba, 0x3a, 0x00, 0x80, 0xd9, 0x3a, 0xfc, 0xe6, 0xd9, 0x3a,
-  0xa7, 0xc6, 0x88, 0x3a, 0x76, 0x46, 0xa0, 0x3a, 0x51, 0x6b, 0x95, 0x3a,
-  0xac, 0xba, 0x88, 0x3a, 0x97, 0x2f, 0xd3, 0x3a, 0x61, 0x64, 0x8c, 0x3a,
-  0xf7, 0x4f, 0x6b, 0x3a, 0x67, 0x97, 0x87, 0x3a, 0x94, 0x87, 0x9c, 0x3a,
-  0x64, 0xb0, 0xba, 0x3a, 0x3a, 0xe8, 0xc5, 0x3a, 0x80, 0x75, 0xa1, 0x3a,
-  0x76, 0x89, 0x73, 0x3a, 0x9e, 0x85, 0x99, 0x3a, 0x6a, 0x67, 0x84, 0x3a,
-  0x7c, 0xd0, 0xa2, 0x3a, 0x29, 0xb7, 0xc7, 0x3a, 0x27, 0x75, 0xe6, 0x3a,
-  0x41, 0xc9, 0x8a, 0x3a, 0x87, 0xff, 0x9f, 0x3a, 0x21, 0x25, 0xbd, 0x3a,
-  0xb2, 0xe8, 0xdb, 0x3a, 0x8e, 0x77, 0xa5, 0x3a, 0x22, 0x36, 0xb0, 0x3a,
-  0x86, 0x6e, 0xc2, 0x3a, 0x8b, 0x44, 0x8e, 0x3a, 0xe6, 0x68, 0x6b, 0x3a,
-  0xbc, 0x95, 0x97, 0x3a, 0x7e, 0x71, 0x57, 0x3a, 0xbf, 0x71, 0x9a, 0x3a,
-  0xbb, 0x58, 0x87, 0x3a, 0x0e, 0xe2, 0xde, 0x3a, 0x15, 0x54, 0x8f, 0x3a,
-  0x54, 0xf6, 0x97, 0x3a, 0x67, 0xc1, 0x82, 0x3a, 0x24, 0x38, 0x87, 0x3a,
-  0x7a, 0x33, 0x45, 0x3a, 0xbe, 0x80, 0xc0, 0x3a, 0x9c, 0x34, 0xa4, 0x3a,
-  0xb9, 0xa9, 0x84, 0x3a, 0xcd, 0x05, 0x8d, 0x3a, 0x05, 0xcb, 0xae, 0x3a,
-  0x95, 0xe1, 0x83, 0x3a, 0x23, 0xf4, 0xa2, 0x3a, 0x53, 0x10, 0xb1, 0x3a,
-  0xa0, 0x6d, 0x83, 0x3a, 0x7d, 0x71, 0xce, 0x3a, 0x77, 0xbf, 0x80, 0x3a,
-  0xc1, 0x25, 0x9d, 0x3a, 0x13, 0x4f, 0xdd, 0x3a, 0xad, 0xec, 0xac, 0x3a,
-  0xc8, 0x44, 0x62, 0x3a, 0x78, 0x76, 0xff, 0x3a, 0x9b, 0x04, 0x88, 0x3a,
-  0x8c, 0xa5, 0xa7, 0x3a, 0xf5, 0xd8, 0x7f, 0x3a, 0x09, 0xad, 0x75, 0x3a,
-  0xea, 0x35, 0x8a, 0x3a, 0x7d, 0x92, 0xab, 0x3a, 0x3d, 0xbf, 0x9f, 0x3a,
-  0x5a, 0x1e, 0x7e, 0x3a, 0x4b, 0x7a, 0xa3, 0x3a, 0xc7, 0x79, 0xb1, 0x3a,
-  0xb6, 0x45, 0x5f, 0x3a, 0x22, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0x06, 0xe8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x34, 0x06, 0x00, 0x00, 0x7c, 0xe7, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0xfa, 0x20, 0x87, 0x3a, 0x87, 0x50, 0x7d, 0x3a, 0x49, 0x77, 0x05, 0x3b,
+  0x5b, 0x04, 0xee, 0x3a, 0x96, 0x99, 0x0c, 0x3b, 0x4b, 0xc8, 0xb8, 0x3a,
+  0xa4, 0xb0, 0x91, 0x3a, 0x12, 0x19, 0xd0, 0x3a, 0x77, 0x0d, 0xd8, 0x3a,
+  0x16, 0x9f, 0xb3, 0x3a, 0x96, 0x8b, 0x7c, 0x3a, 0xef, 0x80, 0xcb, 0x3a,
+  0x7d, 0x77, 0x7d, 0x3a, 0xed, 0xef, 0xcf, 0x3a, 0x41, 0xd7, 0x8c, 0x3a,
+  0xc3, 0xac, 0xd0, 0x3a, 0x39, 0xc1, 0xc6, 0x3a, 0x1e, 0x81, 0xd7, 0x3a,
+  0x78, 0x5b, 0xaf, 0x3a, 0x36, 0x94, 0xa6, 0x3a, 0x68, 0x94, 0x8c, 0x3a,
+  0xfb, 0x61, 0x7e, 0x3a, 0x51, 0x15, 0x96, 0x3a, 0x7f, 0xc2, 0x66, 0x3a,
+  0x5f, 0x78, 0xe3, 0x3a, 0xef, 0x81, 0xf5, 0x3a, 0x23, 0x04, 0xa6, 0x3a,
+  0x3a, 0xb1, 0x8b, 0x3a, 0xd5, 0x83, 0xbe, 0x3a, 0x55, 0x2d, 0x92, 0x3a,
+  0xbb, 0xfe, 0x82, 0x3a, 0xe5, 0x8f, 0xb4, 0x3a, 0xfd, 0xdc, 0xd5, 0x3a,
+  0x02, 0x35, 0xa3, 0x3a, 0xbf, 0x5a, 0x6a, 0x3a, 0x12, 0x42, 0xd4, 0x3a,
+  0x9c, 0xcb, 0x58, 0x3a, 0x52, 0xa7, 0xdb, 0x3a, 0xca, 0x88, 0xd0, 0x3a,
+  0xb7, 0xcb, 0x96, 0x3a, 0x23, 0xa3, 0xa4, 0x3a, 0x15, 0x1e, 0x9d, 0x3a,
+  0x80, 0xd9, 0x97, 0x3a, 0x91, 0x0b, 0xa2, 0x3a, 0x2f, 0x7f, 0x4c, 0x3a,
+  0x6d, 0x2f, 0x99, 0x3a, 0x9e, 0x54, 0x87, 0x3a, 0x5c, 0x54, 0xda, 0x3a,
+  0x8b, 0x61, 0x3e, 0x3a, 0x3f, 0x72, 0xaa, 0x3a, 0x21, 0x61, 0x3f, 0x3a,
+  0xce, 0xeb, 0xab, 0x3a, 0x3c, 0x90, 0x25, 0x3b, 0xb4, 0x4a, 0xe1, 0x3a,
+  0xa8, 0x91, 0xa4, 0x3a, 0x72, 0x5d, 0xbb, 0x3a, 0x82, 0x16, 0x05, 0x3b,
+  0x9f, 0x0b, 0x01, 0x3b, 0x16, 0x75, 0x85, 0x3a, 0x04, 0xdd, 0x3b, 0x3a,
+  0x20, 0x79, 0xf8, 0x3a, 0x13, 0xe4, 0xba, 0x3a, 0x00, 0x80, 0xd9, 0x3a,
+  0xfc, 0xe6, 0xd9, 0x3a, 0xa7, 0xc6, 0x88, 0x3a, 0x76, 0x46, 0xa0, 0x3a,
+  0x51, 0x6b, 0x95, 0x3a, 0xac, 0xba, 0x88, 0x3a, 0x97, 0x2f, 0xd3, 0x3a,
+  0x61, 0x64, 0x8c, 0x3a, 0xf7, 0x4f, 0x6b, 0x3a, 0x67, 0x97, 0x87, 0x3a,
+  0x94, 0x87, 0x9c, 0x3a, 0x64, 0xb0, 0xba, 0x3a, 0x3a, 0xe8, 0xc5, 0x3a,
+  0x80, 0x75, 0xa1, 0x3a, 0x76, 0x89, 0x73, 0x3a, 0x9e, 0x85, 0x99, 0x3a,
+  0x6a, 0x67, 0x84, 0x3a, 0x7c, 0xd0, 0xa2, 0x3a, 0x29, 0xb7, 0xc7, 0x3a,
+  0x27, 0x75, 0xe6, 0x3a, 0x41, 0xc9, 0x8a, 0x3a, 0x87, 0xff, 0x9f, 0x3a,
+  0x21, 0x25, 0xbd, 0x3a, 0xb2, 0xe8, 0xdb, 0x3a, 0x8e, 0x77, 0xa5, 0x3a,
+  0x22, 0x36, 0xb0, 0x3a, 0x86, 0x6e, 0xc2, 0x3a, 0x8b, 0x44, 0x8e, 0x3a,
+  0xe6, 0x68, 0x6b, 0x3a, 0xbc, 0x95, 0x97, 0x3a, 0x7e, 0x71, 0x57, 0x3a,
+  0xbf, 0x71, 0x9a, 0x3a, 0xbb, 0x58, 0x87, 0x3a, 0x0e, 0xe2, 0xde, 0x3a,
+  0x15, 0x54, 0x8f, 0x3a, 0x54, 0xf6, 0x97, 0x3a, 0x67, 0xc1, 0x82, 0x3a,
+  0x24, 0x38, 0x87, 0x3a, 0x7a, 0x33, 0x45, 0x3a, 0xbe, 0x80, 0xc0, 0x3a,
+  0x9c, 0x34, 0xa4, 0x3a, 0xb9, 0xa9, 0x84, 0x3a, 0xcd, 0x05, 0x8d, 0x3a,
+  0x05, 0xcb, 0xae, 0x3a, 0x95, 0xe1, 0x83, 0x3a, 0x23, 0xf4, 0xa2, 0x3a,
+  0x53, 0x10, 0xb1, 0x3a, 0xa0, 0x6d, 0x83, 0x3a, 0x7d, 0x71, 0xce, 0x3a,
+  0x77, 0xbf, 0x80, 0x3a, 0xc1, 0x25, 0x9d, 0x3a, 0x13, 0x4f, 0xdd, 0x3a,
+  0xad, 0xec, 0xac, 0x3a, 0xc8, 0x44, 0x62, 0x3a, 0x78, 0x76, 0xff, 0x3a,
+  0x9b, 0x04, 0x88, 0x3a, 0x8c, 0xa5, 0xa7, 0x3a, 0xf5, 0xd8, 0x7f, 0x3a,
+  0x09, 0xad, 0x75, 0x3a, 0xea, 0x35, 0x8a, 0x3a, 0x7d, 0x92, 0xab, 0x3a,
+  0x3d, 0xbf, 0x9f, 0x3a, 0x5a, 0x1e, 0x7e, 0x3a, 0x4b, 0x7a, 0xa3, 0x3a,
+  0xc7, 0x79, 0xb1, 0x3a, 0xb6, 0x45, 0x5f, 0x3a, 0x22, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
+  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32,
+  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x06, 0xe8, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x06, 0x00, 0x00,
+  0x7c, 0xe7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -5754,58 +5762,59 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x64, 0x3e, 0xec, 0x3b,
-  0xb8, 0x36, 0xd2, 0x3b, 0xbf, 0x39, 0xc7, 0x3b, 0x87, 0x5f, 0xbc, 0x3b,
-  0x4f, 0x02, 0xe7, 0x3b, 0x87, 0xa4, 0xed, 0x3b, 0xdf, 0xd1, 0xb8, 0x3b,
-  0xc5, 0xcc, 0xdf, 0x3b, 0x7c, 0xc7, 0xf8, 0x3b, 0x16, 0x6e, 0xd2, 0x3b,
-  0x87, 0x64, 0xd2, 0x3b, 0xf1, 0xf4, 0xe5, 0x3b, 0xf9, 0xad, 0xd6, 0x3b,
-  0x0a, 0x33, 0xec, 0x3b, 0x2b, 0x9d, 0xd8, 0x3b, 0x8d, 0x5a, 0x06, 0x3c,
-  0x8e, 0xaf, 0xb3, 0x3b, 0xfd, 0xcc, 0xc6, 0x3b, 0x98, 0x2a, 0xf4, 0x3b,
-  0x76, 0x50, 0xd5, 0x3b, 0x8f, 0x93, 0xd7, 0x3b, 0x5c, 0x53, 0x05, 0x3c,
-  0xdd, 0xf1, 0xd8, 0x3b, 0x1d, 0x52, 0xbb, 0x3b, 0xc8, 0x6e, 0xb2, 0x3b,
-  0x8a, 0x26, 0xae, 0x3b, 0x78, 0xfc, 0xca, 0x3b, 0xd4, 0x8c, 0x28, 0x3c,
-  0x5a, 0xd9, 0xa4, 0x3b, 0xe9, 0xd2, 0xd7, 0x3b, 0x62, 0x62, 0xce, 0x3b,
-  0x9c, 0xf2, 0xb3, 0x3b, 0x2f, 0xb3, 0xd6, 0x3b, 0x22, 0x5d, 0xec, 0x3b,
-  0xd3, 0xdc, 0xe0, 0x3b, 0x06, 0xd2, 0xd4, 0x3b, 0xe7, 0x03, 0xb9, 0x3b,
-  0x1e, 0x4c, 0xda, 0x3b, 0x9a, 0x54, 0x08, 0x3c, 0x79, 0xb8, 0x12, 0x3c,
-  0x01, 0x59, 0xdd, 0x3b, 0xab, 0x53, 0xcf, 0x3b, 0x5f, 0x8c, 0xcb, 0x3b,
-  0x6a, 0x88, 0x00, 0x3c, 0x8f, 0xc2, 0xae, 0x3b, 0x17, 0x02, 0xd0, 0x3b,
-  0xa3, 0x13, 0xaa, 0x3b, 0xd5, 0x11, 0xc4, 0x3b, 0x52, 0x38, 0xb4, 0x3b,
-  0xde, 0x04, 0x0b, 0x3c, 0x27, 0x0c, 0xa5, 0x3b, 0x5d, 0x36, 0xe6, 0x3b,
-  0xe9, 0xee, 0xdd, 0x3b, 0xbe, 0x82, 0x7e, 0x3b, 0xa6, 0x9b, 0xd6, 0x3b,
-  0x66, 0x43, 0xb6, 0x3b, 0x26, 0x84, 0xc1, 0x3b, 0x97, 0x8e, 0xf1, 0x3b,
-  0xa9, 0xf3, 0xd5, 0x3b, 0xe7, 0x05, 0x00, 0x3c, 0x10, 0x53, 0xe4, 0x3b,
-  0xf0, 0x15, 0xae, 0x3b, 0x4a, 0xc7, 0xae, 0x3b, 0x13, 0xf0, 0xba, 0x3b,
-  0x67, 0xdf, 0xee, 0x3b, 0x66, 0x6b, 0xb1, 0x3b, 0x31, 0x87, 0xcb, 0x3b,
-  0xca, 0x04, 0xd9, 0x3b, 0xf4, 0xde, 0x13, 0x3c, 0xdd, 0xae, 0xd4, 0x3b,
-  0x2a, 0xc0, 0xbb, 0x3b, 0x88, 0x09, 0xc6, 0x3b, 0x5b, 0xe1, 0xbf, 0x3b,
-  0xb1, 0xc2, 0xd0, 0x3b, 0xe5, 0x8d, 0xe1, 0x3b, 0x12, 0x0b, 0xd9, 0x3b,
-  0x7e, 0xac, 0xd7, 0x3b, 0x1b, 0xd7, 0x16, 0x3c, 0x22, 0xd9, 0xd1, 0x3b,
-  0x4d, 0x48, 0xcd, 0x3b, 0x59, 0xd2, 0xac, 0x3b, 0x6b, 0x12, 0xd9, 0x3b,
-  0xd5, 0x58, 0xb5, 0x3b, 0x12, 0x55, 0xcb, 0x3b, 0x04, 0xf6, 0xbe, 0x3b,
-  0xc6, 0x77, 0xd9, 0x3b, 0xbd, 0x6b, 0x00, 0x3c, 0xae, 0x64, 0xcb, 0x3b,
-  0x67, 0x09, 0xb5, 0x3b, 0x24, 0x93, 0xd6, 0x3b, 0x59, 0x32, 0xcb, 0x3b,
-  0x4f, 0xe2, 0xc3, 0x3b, 0xfd, 0x85, 0x9a, 0x3b, 0x30, 0x91, 0xed, 0x3b,
-  0x11, 0x9e, 0xea, 0x3b, 0x81, 0xac, 0xb8, 0x3b, 0x3b, 0x92, 0xa7, 0x3b,
-  0x57, 0x1a, 0xa7, 0x3b, 0x23, 0x3f, 0xe4, 0x3b, 0x66, 0x2e, 0xe9, 0x3b,
-  0x02, 0xdc, 0xb9, 0x3b, 0x71, 0xca, 0xd8, 0x3b, 0x66, 0x2f, 0xf7, 0x3b,
-  0x87, 0xc6, 0x04, 0x3c, 0x85, 0xe7, 0xde, 0x3b, 0x8c, 0x8a, 0xb2, 0x3b,
-  0x25, 0x62, 0xac, 0x3b, 0x9e, 0x6b, 0xe3, 0x3b, 0x1a, 0x08, 0x16, 0x3c,
-  0xf6, 0x19, 0xfe, 0x3b, 0x60, 0xb9, 0x8f, 0x3b, 0x3f, 0xe3, 0xcc, 0x3b,
-  0x7f, 0x1a, 0xc6, 0x3b, 0xc1, 0x0b, 0x02, 0x3c, 0x99, 0xbd, 0xfc, 0x3b,
-  0x50, 0x4c, 0xc4, 0x3b, 0xf6, 0x46, 0xca, 0x3b, 0xaa, 0x0e, 0x26, 0x3c,
-  0xa4, 0x20, 0xa3, 0x3b, 0x46, 0xc3, 0xb8, 0x3b, 0x8b, 0xdd, 0xa8, 0x3b,
-  0x7d, 0xdc, 0x9a, 0x3b, 0xc2, 0xb2, 0xaa, 0x3b, 0xcd, 0xb2, 0xf6, 0x3b,
-  0x91, 0x6c, 0xd8, 0x3b, 0x60, 0x93, 0xea, 0x3b, 0xb8, 0x94, 0xe5, 0x3b,
-  0xfb, 0x67, 0xd2, 0x3b, 0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0x66, 0xee, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x28, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x50, 0x06, 0x00, 0x00, 0xdc, 0xed, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x64, 0x3e, 0xec, 0x3b, 0xb8, 0x36, 0xd2, 0x3b, 0xbf, 0x39, 0xc7, 0x3b,
+  0x87, 0x5f, 0xbc, 0x3b, 0x4f, 0x02, 0xe7, 0x3b, 0x87, 0xa4, 0xed, 0x3b,
+  0xdf, 0xd1, 0xb8, 0x3b, 0xc5, 0xcc, 0xdf, 0x3b, 0x7c, 0xc7, 0xf8, 0x3b,
+  0x16, 0x6e, 0xd2, 0x3b, 0x87, 0x64, 0xd2, 0x3b, 0xf1, 0xf4, 0xe5, 0x3b,
+  0xf9, 0xad, 0xd6, 0x3b, 0x0a, 0x33, 0xec, 0x3b, 0x2b, 0x9d, 0xd8, 0x3b,
+  0x8d, 0x5a, 0x06, 0x3c, 0x8e, 0xaf, 0xb3, 0x3b, 0xfd, 0xcc, 0xc6, 0x3b,
+  0x98, 0x2a, 0xf4, 0x3b, 0x76, 0x50, 0xd5, 0x3b, 0x8f, 0x93, 0xd7, 0x3b,
+  0x5c, 0x53, 0x05, 0x3c, 0xdd, 0xf1, 0xd8, 0x3b, 0x1d, 0x52, 0xbb, 0x3b,
+  0xc8, 0x6e, 0xb2, 0x3b, 0x8a, 0x26, 0xae, 0x3b, 0x78, 0xfc, 0xca, 0x3b,
+  0xd4, 0x8c, 0x28, 0x3c, 0x5a, 0xd9, 0xa4, 0x3b, 0xe9, 0xd2, 0xd7, 0x3b,
+  0x62, 0x62, 0xce, 0x3b, 0x9c, 0xf2, 0xb3, 0x3b, 0x2f, 0xb3, 0xd6, 0x3b,
+  0x22, 0x5d, 0xec, 0x3b, 0xd3, 0xdc, 0xe0, 0x3b, 0x06, 0xd2, 0xd4, 0x3b,
+  0xe7, 0x03, 0xb9, 0x3b, 0x1e, 0x4c, 0xda, 0x3b, 0x9a, 0x54, 0x08, 0x3c,
+  0x79, 0xb8, 0x12, 0x3c, 0x01, 0x59, 0xdd, 0x3b, 0xab, 0x53, 0xcf, 0x3b,
+  0x5f, 0x8c, 0xcb, 0x3b, 0x6a, 0x88, 0x00, 0x3c, 0x8f, 0xc2, 0xae, 0x3b,
+  0x17, 0x02, 0xd0, 0x3b, 0xa3, 0x13, 0xaa, 0x3b, 0xd5, 0x11, 0xc4, 0x3b,
+  0x52, 0x38, 0xb4, 0x3b, 0xde, 0x04, 0x0b, 0x3c, 0x27, 0x0c, 0xa5, 0x3b,
+  0x5d, 0x36, 0xe6, 0x3b, 0xe9, 0xee, 0xdd, 0x3b, 0xbe, 0x82, 0x7e, 0x3b,
+  0xa6, 0x9b, 0xd6, 0x3b, 0x66, 0x43, 0xb6, 0x3b, 0x26, 0x84, 0xc1, 0x3b,
+  0x97, 0x8e, 0xf1, 0x3b, 0xa9, 0xf3, 0xd5, 0x3b, 0xe7, 0x05, 0x00, 0x3c,
+  0x10, 0x53, 0xe4, 0x3b, 0xf0, 0x15, 0xae, 0x3b, 0x4a, 0xc7, 0xae, 0x3b,
+  0x13, 0xf0, 0xba, 0x3b, 0x67, 0xdf, 0xee, 0x3b, 0x66, 0x6b, 0xb1, 0x3b,
+  0x31, 0x87, 0xcb, 0x3b, 0xca, 0x04, 0xd9, 0x3b, 0xf4, 0xde, 0x13, 0x3c,
+  0xdd, 0xae, 0xd4, 0x3b, 0x2a, 0xc0, 0xbb, 0x3b, 0x88, 0x09, 0xc6, 0x3b,
+  0x5b, 0xe1, 0xbf, 0x3b, 0xb1, 0xc2, 0xd0, 0x3b, 0xe5, 0x8d, 0xe1, 0x3b,
+  0x12, 0x0b, 0xd9, 0x3b, 0x7e, 0xac, 0xd7, 0x3b, 0x1b, 0xd7, 0x16, 0x3c,
+  0x22, 0xd9, 0xd1, 0x3b, 0x4d, 0x48, 0xcd, 0x3b, 0x59, 0xd2, 0xac, 0x3b,
+  0x6b, 0x12, 0xd9, 0x3b, 0xd5, 0x58, 0xb5, 0x3b, 0x12, 0x55, 0xcb, 0x3b,
+  0x04, 0xf6, 0xbe, 0x3b, 0xc6, 0x77, 0xd9, 0x3b, 0xbd, 0x6b, 0x00, 0x3c,
+  0xae, 0x64, 0xcb, 0x3b, 0x67, 0x09, 0xb5, 0x3b, 0x24, 0x93, 0xd6, 0x3b,
+  0x59, 0x32, 0xcb, 0x3b, 0x4f, 0xe2, 0xc3, 0x3b, 0xfd, 0x85, 0x9a, 0x3b,
+  0x30, 0x91, 0xed, 0x3b, 0x11, 0x9e, 0xea, 0x3b, 0x81, 0xac, 0xb8, 0x3b,
+  0x3b, 0x92, 0xa7, 0x3b, 0x57, 0x1a, 0xa7, 0x3b, 0x23, 0x3f, 0xe4, 0x3b,
+  0x66, 0x2e, 0xe9, 0x3b, 0x02, 0xdc, 0xb9, 0x3b, 0x71, 0xca, 0xd8, 0x3b,
+  0x66, 0x2f, 0xf7, 0x3b, 0x87, 0xc6, 0x04, 0x3c, 0x85, 0xe7, 0xde, 0x3b,
+  0x8c, 0x8a, 0xb2, 0x3b, 0x25, 0x62, 0xac, 0x3b, 0x9e, 0x6b, 0xe3, 0x3b,
+  0x1a, 0x08, 0x16, 0x3c, 0xf6, 0x19, 0xfe, 0x3b, 0x60, 0xb9, 0x8f, 0x3b,
+  0x3f, 0xe3, 0xcc, 0x3b, 0x7f, 0x1a, 0xc6, 0x3b, 0xc1, 0x0b, 0x02, 0x3c,
+  0x99, 0xbd, 0xfc, 0x3b, 0x50, 0x4c, 0xc4, 0x3b, 0xf6, 0x46, 0xca, 0x3b,
+  0xaa, 0x0e, 0x26, 0x3c, 0xa4, 0x20, 0xa3, 0x3b, 0x46, 0xc3, 0xb8, 0x3b,
+  0x8b, 0xdd, 0xa8, 0x3b, 0x7d, 0xdc, 0x9a, 0x3b, 0xc2, 0xb2, 0xaa, 0x3b,
+  0xcd, 0xb2, 0xf6, 0x3b, 0x91, 0x6c, 0xd8, 0x3b, 0x60, 0x93, 0xea, 0x3b,
+  0xb8, 0x94, 0xe5, 0x3b, 0xfb, 0x67, 0xd2, 0x3b, 0x15, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
+  0x5f, 0x32, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x66, 0xee, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x28, 0x06, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x50, 0x06, 0x00, 0x00,
+  0xdc, 0xed, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -5890,62 +5899,61 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x46, 0x0d, 0xd7, 0x38, 0x5b, 0x5b, 0xbf, 0x38, 0xb8, 0x5a, 0xb5, 0x38,
-  0xb7, 0x79, 0xab, 0x38, 0x67, 0x49, 0xd2, 0x38, 0x49, 0x53, 0xd8, 0x38,
-  0xa8, 0x3d, 0xa8, 0x38, 0x6a, 0xb9, 0xcb, 0x38, 0x80, 0x76, 0xe2, 0x38,
-  0xc2, 0x8d, 0xbf, 0x38, 0x0e, 0x85, 0xbf, 0x38, 0x33, 0x54, 0xd1, 0x38,
-  0x0f, 0x6c, 0xc3, 0x38, 0xf1, 0x02, 0xd7, 0x38, 0xd5, 0x2e, 0xc5, 0x38,
-  0x7d, 0x9a, 0xf4, 0x38, 0x3d, 0x91, 0xa3, 0x38, 0xb7, 0xf7, 0xb4, 0x38,
-  0x8a, 0x43, 0xde, 0x38, 0xe6, 0x2d, 0xc2, 0x38, 0x0c, 0x3d, 0xc4, 0x38,
-  0x52, 0xbb, 0xf2, 0x38, 0xee, 0x7b, 0xc5, 0x38, 0x78, 0x84, 0xaa, 0x38,
-  0x3d, 0x6d, 0xa2, 0x38, 0x56, 0x87, 0x9e, 0x38, 0x15, 0xc7, 0xb8, 0x38,
-  0x3b, 0x6e, 0x19, 0x39, 0xbf, 0x0f, 0x96, 0x38, 0xb7, 0x76, 0xc4, 0x38,
-  0xf6, 0xde, 0xbb, 0x38, 0x47, 0xce, 0xa3, 0x38, 0xcd, 0x70, 0xc3, 0x38,
-  0x42, 0x29, 0xd7, 0x38, 0x11, 0xb1, 0xcc, 0x38, 0xcd, 0xba, 0xc1, 0x38,
-  0x33, 0x6b, 0xa8, 0x38, 0x1f, 0xb7, 0xc6, 0x38, 0xcd, 0x33, 0xf8, 0x38,
-  0x2c, 0x8f, 0x05, 0x39, 0xf6, 0x7d, 0xc9, 0x38, 0x9a, 0xba, 0xbc, 0x38,
-  0x13, 0x4a, 0xb9, 0x38, 0x8e, 0x01, 0xea, 0x38, 0x5c, 0x15, 0x9f, 0x38,
-  0x60, 0x59, 0xbd, 0x38, 0xfc, 0xd1, 0x9a, 0x38, 0x47, 0x7b, 0xb2, 0x38,
-  0xbd, 0x0d, 0xa4, 0x38, 0xda, 0x18, 0xfd, 0x38, 0xfe, 0x3d, 0x96, 0x38,
-  0xc0, 0x8f, 0xd1, 0x38, 0x6c, 0x06, 0xca, 0x38, 0x24, 0xae, 0x67, 0x38,
-  0x60, 0x5b, 0xc3, 0x38, 0xe5, 0xe9, 0xa5, 0x38, 0x3b, 0x28, 0xb0, 0x38,
-  0x76, 0xe3, 0xdb, 0x38, 0x75, 0xc2, 0xc2, 0x38, 0xf2, 0x13, 0xe9, 0x38,
-  0xce, 0xd7, 0xcf, 0x38, 0x39, 0x78, 0x9e, 0x38, 0xaa, 0x19, 0x9f, 0x38,
-  0x39, 0x2b, 0xaa, 0x38, 0xea, 0x71, 0xd9, 0x38, 0x20, 0x81, 0xa1, 0x38,
-  0x5c, 0x45, 0xb9, 0x38, 0x28, 0x8d, 0xc5, 0x38, 0x3c, 0x9b, 0x06, 0x39,
-  0xcc, 0x9a, 0xc1, 0x38, 0xa5, 0xe8, 0xaa, 0x38, 0xcb, 0x45, 0xb4, 0x38,
-  0x01, 0xab, 0xae, 0x38, 0xb4, 0x08, 0xbe, 0x38, 0x40, 0x52, 0xcd, 0x38,
-  0xe0, 0x92, 0xc5, 0x38, 0xbf, 0x53, 0xc4, 0x38, 0x33, 0x4f, 0x09, 0x39,
-  0x2a, 0x06, 0xbf, 0x38, 0x2f, 0xde, 0xba, 0x38, 0xa9, 0x51, 0x9d, 0x38,
-  0x90, 0x99, 0xc5, 0x38, 0x5e, 0x14, 0xa5, 0x38, 0xbc, 0x17, 0xb9, 0x38,
-  0xc6, 0xd4, 0xad, 0x38, 0xd4, 0xf5, 0xc5, 0x38, 0x59, 0xcd, 0xe9, 0x38,
-  0xf1, 0x25, 0xb9, 0x38, 0x10, 0xcc, 0xa4, 0x38, 0xa2, 0x53, 0xc3, 0x38,
-  0x20, 0xf8, 0xb8, 0x38, 0x04, 0x50, 0xb2, 0x38, 0x81, 0xa9, 0x8c, 0x38,
-  0xae, 0x41, 0xd8, 0x38, 0x4c, 0x92, 0xd5, 0x38, 0xa4, 0x1b, 0xa8, 0x38,
-  0x1d, 0x8a, 0x98, 0x38, 0xfa, 0x1c, 0x98, 0x38, 0xab, 0xc5, 0xcf, 0x38,
-  0x9c, 0x43, 0xd4, 0x38, 0xec, 0x2f, 0xa9, 0x38, 0x0b, 0x58, 0xc5, 0x38,
-  0x06, 0x03, 0xe1, 0x38, 0xed, 0xba, 0xf1, 0x38, 0xbb, 0xe8, 0xca, 0x38,
-  0x84, 0x86, 0xa2, 0x38, 0x85, 0xeb, 0x9c, 0x38, 0x1f, 0x05, 0xcf, 0x38,
-  0xc4, 0x92, 0x08, 0x39, 0xc2, 0x4e, 0xe7, 0x38, 0xe3, 0xd4, 0x82, 0x38,
-  0x31, 0x82, 0xba, 0x38, 0x3c, 0x55, 0xb4, 0x38, 0xbe, 0xc2, 0xec, 0x38,
-  0xa5, 0x11, 0xe6, 0x38, 0x83, 0xb0, 0xb2, 0x38, 0xdb, 0x21, 0xb8, 0x38,
-  0x50, 0x29, 0x17, 0x39, 0x92, 0x7e, 0x94, 0x38, 0x5e, 0x30, 0xa8, 0x38,
-  0xb5, 0xb7, 0x99, 0x38, 0x3e, 0xf8, 0x8c, 0x38, 0xd5, 0x62, 0x9b, 0x38,
-  0x9a, 0x91, 0xe0, 0x38, 0x97, 0x02, 0xc5, 0x38, 0x90, 0x88, 0xd5, 0x38,
-  0x9b, 0xfc, 0xd0, 0x38, 0x33, 0x88, 0xbf, 0x38, 0x2c, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f,
-  0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x5f, 0x32, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74,
-  0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xd6, 0xf4, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x5c, 0x06, 0x00, 0x00,
-  0x00, 0x00, 0x12, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x46, 0x0d, 0xd7, 0x38, 0x5b, 0x5b, 0xbf, 0x38,
+  0xb8, 0x5a, 0xb5, 0x38, 0xb7, 0x79, 0xab, 0x38, 0x67, 0x49, 0xd2, 0x38,
+  0x49, 0x53, 0xd8, 0x38, 0xa8, 0x3d, 0xa8, 0x38, 0x6a, 0xb9, 0xcb, 0x38,
+  0x80, 0x76, 0xe2, 0x38, 0xc2, 0x8d, 0xbf, 0x38, 0x0e, 0x85, 0xbf, 0x38,
+  0x33, 0x54, 0xd1, 0x38, 0x0f, 0x6c, 0xc3, 0x38, 0xf1, 0x02, 0xd7, 0x38,
+  0xd5, 0x2e, 0xc5, 0x38, 0x7d, 0x9a, 0xf4, 0x38, 0x3d, 0x91, 0xa3, 0x38,
+  0xb7, 0xf7, 0xb4, 0x38, 0x8a, 0x43, 0xde, 0x38, 0xe6, 0x2d, 0xc2, 0x38,
+  0x0c, 0x3d, 0xc4, 0x38, 0x52, 0xbb, 0xf2, 0x38, 0xee, 0x7b, 0xc5, 0x38,
+  0x78, 0x84, 0xaa, 0x38, 0x3d, 0x6d, 0xa2, 0x38, 0x56, 0x87, 0x9e, 0x38,
+  0x15, 0xc7, 0xb8, 0x38, 0x3b, 0x6e, 0x19, 0x39, 0xbf, 0x0f, 0x96, 0x38,
+  0xb7, 0x76, 0xc4, 0x38, 0xf6, 0xde, 0xbb, 0x38, 0x47, 0xce, 0xa3, 0x38,
+  0xcd, 0x70, 0xc3, 0x38, 0x42, 0x29, 0xd7, 0x38, 0x11, 0xb1, 0xcc, 0x38,
+  0xcd, 0xba, 0xc1, 0x38, 0x33, 0x6b, 0xa8, 0x38, 0x1f, 0xb7, 0xc6, 0x38,
+  0xcd, 0x33, 0xf8, 0x38, 0x2c, 0x8f, 0x05, 0x39, 0xf6, 0x7d, 0xc9, 0x38,
+  0x9a, 0xba, 0xbc, 0x38, 0x13, 0x4a, 0xb9, 0x38, 0x8e, 0x01, 0xea, 0x38,
+  0x5c, 0x15, 0x9f, 0x38, 0x60, 0x59, 0xbd, 0x38, 0xfc, 0xd1, 0x9a, 0x38,
+  0x47, 0x7b, 0xb2, 0x38, 0xbd, 0x0d, 0xa4, 0x38, 0xda, 0x18, 0xfd, 0x38,
+  0xfe, 0x3d, 0x96, 0x38, 0xc0, 0x8f, 0xd1, 0x38, 0x6c, 0x06, 0xca, 0x38,
+  0x24, 0xae, 0x67, 0x38, 0x60, 0x5b, 0xc3, 0x38, 0xe5, 0xe9, 0xa5, 0x38,
+  0x3b, 0x28, 0xb0, 0x38, 0x76, 0xe3, 0xdb, 0x38, 0x75, 0xc2, 0xc2, 0x38,
+  0xf2, 0x13, 0xe9, 0x38, 0xce, 0xd7, 0xcf, 0x38, 0x39, 0x78, 0x9e, 0x38,
+  0xaa, 0x19, 0x9f, 0x38, 0x39, 0x2b, 0xaa, 0x38, 0xea, 0x71, 0xd9, 0x38,
+  0x20, 0x81, 0xa1, 0x38, 0x5c, 0x45, 0xb9, 0x38, 0x28, 0x8d, 0xc5, 0x38,
+  0x3c, 0x9b, 0x06, 0x39, 0xcc, 0x9a, 0xc1, 0x38, 0xa5, 0xe8, 0xaa, 0x38,
+  0xcb, 0x45, 0xb4, 0x38, 0x01, 0xab, 0xae, 0x38, 0xb4, 0x08, 0xbe, 0x38,
+  0x40, 0x52, 0xcd, 0x38, 0xe0, 0x92, 0xc5, 0x38, 0xbf, 0x53, 0xc4, 0x38,
+  0x33, 0x4f, 0x09, 0x39, 0x2a, 0x06, 0xbf, 0x38, 0x2f, 0xde, 0xba, 0x38,
+  0xa9, 0x51, 0x9d, 0x38, 0x90, 0x99, 0xc5, 0x38, 0x5e, 0x14, 0xa5, 0x38,
+  0xbc, 0x17, 0xb9, 0x38, 0xc6, 0xd4, 0xad, 0x38, 0xd4, 0xf5, 0xc5, 0x38,
+  0x59, 0xcd, 0xe9, 0x38, 0xf1, 0x25, 0xb9, 0x38, 0x10, 0xcc, 0xa4, 0x38,
+  0xa2, 0x53, 0xc3, 0x38, 0x20, 0xf8, 0xb8, 0x38, 0x04, 0x50, 0xb2, 0x38,
+  0x81, 0xa9, 0x8c, 0x38, 0xae, 0x41, 0xd8, 0x38, 0x4c, 0x92, 0xd5, 0x38,
+  0xa4, 0x1b, 0xa8, 0x38, 0x1d, 0x8a, 0x98, 0x38, 0xfa, 0x1c, 0x98, 0x38,
+  0xab, 0xc5, 0xcf, 0x38, 0x9c, 0x43, 0xd4, 0x38, 0xec, 0x2f, 0xa9, 0x38,
+  0x0b, 0x58, 0xc5, 0x38, 0x06, 0x03, 0xe1, 0x38, 0xed, 0xba, 0xf1, 0x38,
+  0xbb, 0xe8, 0xca, 0x38, 0x84, 0x86, 0xa2, 0x38, 0x85, 0xeb, 0x9c, 0x38,
+  0x1f, 0x05, 0xcf, 0x38, 0xc4, 0x92, 0x08, 0x39, 0xc2, 0x4e, 0xe7, 0x38,
+  0xe3, 0xd4, 0x82, 0x38, 0x31, 0x82, 0xba, 0x38, 0x3c, 0x55, 0xb4, 0x38,
+  0xbe, 0xc2, 0xec, 0x38, 0xa5, 0x11, 0xe6, 0x38, 0x83, 0xb0, 0xb2, 0x38,
+  0xdb, 0x21, 0xb8, 0x38, 0x50, 0x29, 0x17, 0x39, 0x92, 0x7e, 0x94, 0x38,
+  0x5e, 0x30, 0xa8, 0x38, 0xb5, 0xb7, 0x99, 0x38, 0x3e, 0xf8, 0x8c, 0x38,
+  0xd5, 0x62, 0x9b, 0x38, 0x9a, 0x91, 0xe0, 0x38, 0x97, 0x02, 0xc5, 0x38,
+  0x90, 0x88, 0xd5, 0x38, 0x9b, 0xfc, 0xd0, 0x38, 0x33, 0x88, 0xbf, 0x38,
+  0x2c, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61,
+  0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x32, 0x2f, 0x46, 0x75, 0x73, 0x65,
+  0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0xd6, 0xf4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00,
+  0x40, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x5c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x0c, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -6030,59 +6038,59 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0xa1, 0x3c, 0xf3, 0x3a, 0xb0, 0x16, 0x01, 0x3b,
-  0xbc, 0xfe, 0xa7, 0x3a, 0x00, 0x3f, 0xe8, 0x3a, 0x84, 0x49, 0x56, 0x3a,
-  0x96, 0x41, 0x77, 0x3a, 0x0e, 0x9b, 0x38, 0x3b, 0xad, 0x80, 0xba, 0x3a,
-  0xe5, 0xbc, 0x0f, 0x3b, 0xa7, 0xec, 0x9c, 0x3a, 0xe5, 0xe6, 0x97, 0x3a,
-  0x32, 0x53, 0x96, 0x3a, 0x22, 0xc3, 0x90, 0x3a, 0xbf, 0x7b, 0x28, 0x3a,
-  0x85, 0x31, 0x3b, 0x3a, 0x4b, 0xd3, 0xd0, 0x3a, 0x75, 0x34, 0x42, 0x3a,
-  0x01, 0xd9, 0x98, 0x3a, 0x34, 0x0d, 0x75, 0x3a, 0x4c, 0x2f, 0x8e, 0x3a,
-  0x81, 0x0c, 0x82, 0x3a, 0xea, 0x26, 0x13, 0x3b, 0xfc, 0xae, 0xa2, 0x3a,
-  0xce, 0x66, 0x35, 0x3a, 0x45, 0xc6, 0x74, 0x3a, 0x1a, 0x32, 0xee, 0x3a,
-  0x80, 0x6f, 0x4a, 0x3a, 0x7f, 0x0b, 0x85, 0x3a, 0xbc, 0x60, 0x16, 0x3b,
-  0xd5, 0x7f, 0x81, 0x3a, 0x38, 0xa0, 0x83, 0x3a, 0x4f, 0x4f, 0x8f, 0x3a,
-  0x33, 0x53, 0xd4, 0x3a, 0x25, 0x8e, 0xb9, 0x3a, 0xcb, 0xf7, 0x8c, 0x3a,
-  0xdd, 0x4e, 0x81, 0x3a, 0xb0, 0xc2, 0x7d, 0x3a, 0xa6, 0xca, 0xbb, 0x3a,
-  0x3b, 0x63, 0x67, 0x3a, 0x89, 0x8e, 0xa9, 0x3a, 0x22, 0xba, 0xc9, 0x3a,
-  0xa6, 0xd1, 0x91, 0x3a, 0xba, 0x6e, 0xb7, 0x3a, 0x68, 0x5c, 0x82, 0x3a,
-  0x3c, 0x7d, 0x60, 0x3a, 0x4a, 0x77, 0xcb, 0x3a, 0x33, 0xb6, 0x57, 0x3b,
-  0xab, 0xc6, 0x8c, 0x3a, 0x79, 0x13, 0xcb, 0x3a, 0x42, 0x74, 0x93, 0x3a,
-  0x09, 0x0c, 0x13, 0x3b, 0x9f, 0xe9, 0x1b, 0x3b, 0x51, 0x7a, 0xc1, 0x3a,
-  0xde, 0xa6, 0x25, 0x3a, 0x3e, 0xdc, 0xe4, 0x3a, 0xbb, 0x9b, 0x93, 0x3a,
-  0xa6, 0x71, 0x59, 0x3a, 0x72, 0x95, 0xac, 0x3a, 0x5e, 0x47, 0x57, 0x3a,
-  0x8c, 0x6e, 0x83, 0x3a, 0xc7, 0xe0, 0x68, 0x3a, 0xfb, 0xa9, 0x38, 0x3b,
-  0xa7, 0x8b, 0x50, 0x3a, 0x76, 0xd2, 0x15, 0x3b, 0x66, 0xa7, 0xca, 0x3a,
-  0x70, 0x46, 0x8a, 0x3a, 0xf5, 0x47, 0xf9, 0x3a, 0xf3, 0x58, 0x85, 0x3a,
-  0x7e, 0x76, 0xa6, 0x3a, 0x50, 0xe7, 0x82, 0x3a, 0x2b, 0x95, 0xe3, 0x3a,
-  0x72, 0x44, 0x75, 0x3a, 0x1a, 0x61, 0x84, 0x3a, 0x7f, 0x33, 0xa1, 0x3a,
-  0x00, 0x52, 0xb0, 0x3a, 0x71, 0x96, 0x49, 0x3a, 0x8a, 0x3b, 0x30, 0x3a,
-  0x26, 0xf5, 0xd0, 0x3a, 0xde, 0x78, 0x2b, 0x3a, 0xd0, 0x24, 0xd3, 0x3a,
-  0xc5, 0xca, 0x44, 0x3a, 0x70, 0x91, 0xfe, 0x3a, 0xe1, 0x9f, 0x12, 0x3b,
-  0xbd, 0xf7, 0xa1, 0x3a, 0xbe, 0xa5, 0x8d, 0x3a, 0xf6, 0x70, 0xf3, 0x3a,
-  0x25, 0x87, 0x81, 0x3a, 0xe1, 0xb6, 0x50, 0x3a, 0x2e, 0xc4, 0x4e, 0x3b,
-  0x54, 0x3b, 0x0e, 0x3b, 0xd8, 0x91, 0xa7, 0x3a, 0x92, 0x6e, 0xb2, 0x3a,
-  0x0a, 0x0c, 0x69, 0x3a, 0x2d, 0xfe, 0x10, 0x3b, 0xfe, 0x7c, 0x79, 0x3a,
-  0xb2, 0x44, 0x05, 0x3b, 0x0e, 0x48, 0x62, 0x3a, 0xa4, 0xb4, 0x1d, 0x3b,
-  0xfc, 0xfc, 0xbf, 0x3a, 0x60, 0x74, 0x96, 0x3a, 0xbd, 0x76, 0xb0, 0x3a,
-  0x6d, 0x38, 0x5d, 0x3a, 0xfe, 0x50, 0x35, 0x3a, 0x74, 0x20, 0x93, 0x3a,
-  0xa1, 0xfd, 0x77, 0x3a, 0x31, 0xad, 0xcf, 0x39, 0xf8, 0xeb, 0x1f, 0x3a,
-  0xbb, 0x8d, 0x94, 0x3a, 0xc7, 0x12, 0xcc, 0x3a, 0x0b, 0xd9, 0x6d, 0x3a,
-  0x02, 0x79, 0x13, 0x3a, 0x6e, 0x9a, 0x63, 0x3a, 0x6f, 0xce, 0x88, 0x3a,
-  0xc4, 0x4c, 0x5e, 0x3a, 0xcf, 0x10, 0x96, 0x3a, 0x30, 0x55, 0xd5, 0x3a,
-  0xef, 0x33, 0x4f, 0x3a, 0xbe, 0x99, 0x8f, 0x3a, 0x12, 0x9f, 0xab, 0x3a,
-  0xa0, 0x80, 0x09, 0x3a, 0x1a, 0xf7, 0xa8, 0x3a, 0xf7, 0xb5, 0x9e, 0x3a,
-  0xf7, 0xe3, 0xf8, 0x3a, 0x23, 0x4f, 0xa6, 0x3a, 0xaa, 0xff, 0x86, 0x3a,
-  0xa1, 0xe2, 0x58, 0x3a, 0xcf, 0x52, 0x4f, 0x3a, 0x79, 0xa3, 0x65, 0x3a,
-  0x23, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x33, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x31, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x5e, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0xa4, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xb4, 0x01, 0x00, 0x00, 0xd4, 0xfa, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xa1, 0x3c, 0xf3, 0x3a,
+  0xb0, 0x16, 0x01, 0x3b, 0xbc, 0xfe, 0xa7, 0x3a, 0x00, 0x3f, 0xe8, 0x3a,
+  0x84, 0x49, 0x56, 0x3a, 0x96, 0x41, 0x77, 0x3a, 0x0e, 0x9b, 0x38, 0x3b,
+  0xad, 0x80, 0xba, 0x3a, 0xe5, 0xbc, 0x0f, 0x3b, 0xa7, 0xec, 0x9c, 0x3a,
+  0xe5, 0xe6, 0x97, 0x3a, 0x32, 0x53, 0x96, 0x3a, 0x22, 0xc3, 0x90, 0x3a,
+  0xbf, 0x7b, 0x28, 0x3a, 0x85, 0x31, 0x3b, 0x3a, 0x4b, 0xd3, 0xd0, 0x3a,
+  0x75, 0x34, 0x42, 0x3a, 0x01, 0xd9, 0x98, 0x3a, 0x34, 0x0d, 0x75, 0x3a,
+  0x4c, 0x2f, 0x8e, 0x3a, 0x81, 0x0c, 0x82, 0x3a, 0xea, 0x26, 0x13, 0x3b,
+  0xfc, 0xae, 0xa2, 0x3a, 0xce, 0x66, 0x35, 0x3a, 0x45, 0xc6, 0x74, 0x3a,
+  0x1a, 0x32, 0xee, 0x3a, 0x80, 0x6f, 0x4a, 0x3a, 0x7f, 0x0b, 0x85, 0x3a,
+  0xbc, 0x60, 0x16, 0x3b, 0xd5, 0x7f, 0x81, 0x3a, 0x38, 0xa0, 0x83, 0x3a,
+  0x4f, 0x4f, 0x8f, 0x3a, 0x33, 0x53, 0xd4, 0x3a, 0x25, 0x8e, 0xb9, 0x3a,
+  0xcb, 0xf7, 0x8c, 0x3a, 0xdd, 0x4e, 0x81, 0x3a, 0xb0, 0xc2, 0x7d, 0x3a,
+  0xa6, 0xca, 0xbb, 0x3a, 0x3b, 0x63, 0x67, 0x3a, 0x89, 0x8e, 0xa9, 0x3a,
+  0x22, 0xba, 0xc9, 0x3a, 0xa6, 0xd1, 0x91, 0x3a, 0xba, 0x6e, 0xb7, 0x3a,
+  0x68, 0x5c, 0x82, 0x3a, 0x3c, 0x7d, 0x60, 0x3a, 0x4a, 0x77, 0xcb, 0x3a,
+  0x33, 0xb6, 0x57, 0x3b, 0xab, 0xc6, 0x8c, 0x3a, 0x79, 0x13, 0xcb, 0x3a,
+  0x42, 0x74, 0x93, 0x3a, 0x09, 0x0c, 0x13, 0x3b, 0x9f, 0xe9, 0x1b, 0x3b,
+  0x51, 0x7a, 0xc1, 0x3a, 0xde, 0xa6, 0x25, 0x3a, 0x3e, 0xdc, 0xe4, 0x3a,
+  0xbb, 0x9b, 0x93, 0x3a, 0xa6, 0x71, 0x59, 0x3a, 0x72, 0x95, 0xac, 0x3a,
+  0x5e, 0x47, 0x57, 0x3a, 0x8c, 0x6e, 0x83, 0x3a, 0xc7, 0xe0, 0x68, 0x3a,
+  0xfb, 0xa9, 0x38, 0x3b, 0xa7, 0x8b, 0x50, 0x3a, 0x76, 0xd2, 0x15, 0x3b,
+  0x66, 0xa7, 0xca, 0x3a, 0x70, 0x46, 0x8a, 0x3a, 0xf5, 0x47, 0xf9, 0x3a,
+  0xf3, 0x58, 0x85, 0x3a, 0x7e, 0x76, 0xa6, 0x3a, 0x50, 0xe7, 0x82, 0x3a,
+  0x2b, 0x95, 0xe3, 0x3a, 0x72, 0x44, 0x75, 0x3a, 0x1a, 0x61, 0x84, 0x3a,
+  0x7f, 0x33, 0xa1, 0x3a, 0x00, 0x52, 0xb0, 0x3a, 0x71, 0x96, 0x49, 0x3a,
+  0x8a, 0x3b, 0x30, 0x3a, 0x26, 0xf5, 0xd0, 0x3a, 0xde, 0x78, 0x2b, 0x3a,
+  0xd0, 0x24, 0xd3, 0x3a, 0xc5, 0xca, 0x44, 0x3a, 0x70, 0x91, 0xfe, 0x3a,
+  0xe1, 0x9f, 0x12, 0x3b, 0xbd, 0xf7, 0xa1, 0x3a, 0xbe, 0xa5, 0x8d, 0x3a,
+  0xf6, 0x70, 0xf3, 0x3a, 0x25, 0x87, 0x81, 0x3a, 0xe1, 0xb6, 0x50, 0x3a,
+  0x2e, 0xc4, 0x4e, 0x3b, 0x54, 0x3b, 0x0e, 0x3b, 0xd8, 0x91, 0xa7, 0x3a,
+  0x92, 0x6e, 0xb2, 0x3a, 0x0a, 0x0c, 0x69, 0x3a, 0x2d, 0xfe, 0x10, 0x3b,
+  0xfe, 0x7c, 0x79, 0x3a, 0xb2, 0x44, 0x05, 0x3b, 0x0e, 0x48, 0x62, 0x3a,
+  0xa4, 0xb4, 0x1d, 0x3b, 0xfc, 0xfc, 0xbf, 0x3a, 0x60, 0x74, 0x96, 0x3a,
+  0xbd, 0x76, 0xb0, 0x3a, 0x6d, 0x38, 0x5d, 0x3a, 0xfe, 0x50, 0x35, 0x3a,
+  0x74, 0x20, 0x93, 0x3a, 0xa1, 0xfd, 0x77, 0x3a, 0x31, 0xad, 0xcf, 0x39,
+  0xf8, 0xeb, 0x1f, 0x3a, 0xbb, 0x8d, 0x94, 0x3a, 0xc7, 0x12, 0xcc, 0x3a,
+  0x0b, 0xd9, 0x6d, 0x3a, 0x02, 0x79, 0x13, 0x3a, 0x6e, 0x9a, 0x63, 0x3a,
+  0x6f, 0xce, 0x88, 0x3a, 0xc4, 0x4c, 0x5e, 0x3a, 0xcf, 0x10, 0x96, 0x3a,
+  0x30, 0x55, 0xd5, 0x3a, 0xef, 0x33, 0x4f, 0x3a, 0xbe, 0x99, 0x8f, 0x3a,
+  0x12, 0x9f, 0xab, 0x3a, 0xa0, 0x80, 0x09, 0x3a, 0x1a, 0xf7, 0xa8, 0x3a,
+  0xf7, 0xb5, 0x9e, 0x3a, 0xf7, 0xe3, 0xf8, 0x3a, 0x23, 0x4f, 0xa6, 0x3a,
+  0xaa, 0xff, 0x86, 0x3a, 0xa1, 0xe2, 0x58, 0x3a, 0xcf, 0x52, 0x4f, 0x3a,
+  0x79, 0xa3, 0x65, 0x3a, 0x23, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
+  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x64, 0x65, 0x70,
+  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x31, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x5e, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xb4, 0x01, 0x00, 0x00, 0xd4, 0xfa, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -6103,26 +6111,26 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x2a, 0x93, 0x6b, 0x3b, 0xa3, 0xed, 0x66, 0x3b,
-  0x2e, 0xa1, 0x84, 0x3b, 0x75, 0x92, 0x6c, 0x3b, 0xad, 0x29, 0x95, 0x3b,
-  0x84, 0x31, 0xa9, 0x3b, 0x79, 0x39, 0xb4, 0x3b, 0x92, 0x69, 0x62, 0x3b,
-  0xd9, 0x69, 0x57, 0x3b, 0x3e, 0xa0, 0x88, 0x3b, 0x33, 0x9d, 0x9f, 0x3b,
-  0x7d, 0x06, 0xa0, 0x3b, 0xea, 0x40, 0xaf, 0x3b, 0x57, 0xb3, 0xa8, 0x3b,
-  0xbc, 0xad, 0xb2, 0x3b, 0x4d, 0xe9, 0x48, 0x3b, 0xb2, 0x46, 0xa2, 0x3b,
-  0x65, 0x17, 0x96, 0x3b, 0x60, 0xc3, 0xaf, 0x3b, 0x99, 0x23, 0xc0, 0x3b,
-  0x78, 0x14, 0xf1, 0x3b, 0x14, 0x05, 0xb2, 0x3b, 0xd8, 0x22, 0x7b, 0x3b,
-  0x90, 0xdf, 0x57, 0x3b, 0x53, 0x85, 0xd3, 0x3b, 0x11, 0xee, 0x8a, 0x3b,
-  0x07, 0xe6, 0x2e, 0x3b, 0x80, 0x08, 0x9e, 0x3b, 0x43, 0xb7, 0x66, 0x3b,
-  0xa9, 0xab, 0x93, 0x3b, 0xd8, 0x55, 0xc4, 0x3b, 0x3b, 0x45, 0xa1, 0x3b,
-  0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x3e, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0xa8, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xd0, 0x01, 0x00, 0x00, 0xb4, 0xfc, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x0c, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2a, 0x93, 0x6b, 0x3b,
+  0xa3, 0xed, 0x66, 0x3b, 0x2e, 0xa1, 0x84, 0x3b, 0x75, 0x92, 0x6c, 0x3b,
+  0xad, 0x29, 0x95, 0x3b, 0x84, 0x31, 0xa9, 0x3b, 0x79, 0x39, 0xb4, 0x3b,
+  0x92, 0x69, 0x62, 0x3b, 0xd9, 0x69, 0x57, 0x3b, 0x3e, 0xa0, 0x88, 0x3b,
+  0x33, 0x9d, 0x9f, 0x3b, 0x7d, 0x06, 0xa0, 0x3b, 0xea, 0x40, 0xaf, 0x3b,
+  0x57, 0xb3, 0xa8, 0x3b, 0xbc, 0xad, 0xb2, 0x3b, 0x4d, 0xe9, 0x48, 0x3b,
+  0xb2, 0x46, 0xa2, 0x3b, 0x65, 0x17, 0x96, 0x3b, 0x60, 0xc3, 0xaf, 0x3b,
+  0x99, 0x23, 0xc0, 0x3b, 0x78, 0x14, 0xf1, 0x3b, 0x14, 0x05, 0xb2, 0x3b,
+  0xd8, 0x22, 0x7b, 0x3b, 0x90, 0xdf, 0x57, 0x3b, 0x53, 0x85, 0xd3, 0x3b,
+  0x11, 0xee, 0x8a, 0x3b, 0x07, 0xe6, 0x2e, 0x3b, 0x80, 0x08, 0x9e, 0x3b,
+  0x43, 0xb7, 0x66, 0x3b, 0xa9, 0xab, 0x93, 0x3b, 0xd8, 0x55, 0xc4, 0x3b,
+  0x3b, 0x45, 0xa1, 0x3b, 0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x43,
+  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x3e, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xd0, 0x01, 0x00, 0x00, 0xb4, 0xfc, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -6143,71 +6151,73 @@ __attribute__((aligned(16))) const unsigned char str_ww_ref_model_tflite[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x6b, 0x66, 0xad, 0x38,
-  0xd7, 0xfa, 0xa9, 0x38, 0xf9, 0x3f, 0xc3, 0x38, 0x55, 0x22, 0xae, 0x38,
-  0xd1, 0x96, 0xdb, 0x38, 0xbd, 0x13, 0xf9, 0x38, 0x81, 0xa8, 0x04, 0x39,
-  0xe5, 0xa7, 0xa6, 0x38, 0x51, 0x8f, 0x9e, 0x38, 0x12, 0x22, 0xc9, 0x38,
-  0x93, 0xf9, 0xea, 0x38, 0x93, 0x94, 0xeb, 0x38, 0xcf, 0xff, 0x00, 0x39,
-  0xfd, 0x59, 0xf8, 0x38, 0x36, 0x85, 0x03, 0x39, 0x9e, 0xe2, 0x93, 0x38,
-  0xd6, 0xe4, 0xee, 0x38, 0xc6, 0xf4, 0xdc, 0x38, 0xd7, 0x5f, 0x01, 0x39,
-  0x9e, 0x6d, 0x0d, 0x39, 0xc5, 0x73, 0x31, 0x39, 0x12, 0x09, 0x03, 0x39,
-  0xb2, 0xda, 0xb8, 0x38, 0xf7, 0xe5, 0x9e, 0x38, 0xce, 0xb1, 0x1b, 0x39,
-  0x60, 0x86, 0xcc, 0x38, 0xe9, 0xbc, 0x80, 0x38, 0xcd, 0xa5, 0xe8, 0x38,
-  0xd1, 0xd2, 0xa9, 0x38, 0x70, 0x64, 0xd9, 0x38, 0x57, 0x84, 0x10, 0x39,
-  0xcf, 0x69, 0xed, 0x38, 0x2c, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d,
-  0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x33, 0x2f,
-  0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f,
-  0x72, 0x6d, 0x56, 0x33, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x3c, 0x00, 0x00, 0x00, 0xa4, 0xfe, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x2b, 0xc1, 0x2a, 0x3c, 0x12, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x4d, 0x61, 0x74, 0x4d,
-  0x75, 0x6c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x8e, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x9d, 0x54, 0x91, 0x39, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x6b, 0x66, 0xad, 0x38, 0xd7, 0xfa, 0xa9, 0x38, 0xf9, 0x3f, 0xc3, 0x38,
+  0x55, 0x22, 0xae, 0x38, 0xd1, 0x96, 0xdb, 0x38, 0xbd, 0x13, 0xf9, 0x38,
+  0x81, 0xa8, 0x04, 0x39, 0xe5, 0xa7, 0xa6, 0x38, 0x51, 0x8f, 0x9e, 0x38,
+  0x12, 0x22, 0xc9, 0x38, 0x93, 0xf9, 0xea, 0x38, 0x93, 0x94, 0xeb, 0x38,
+  0xcf, 0xff, 0x00, 0x39, 0xfd, 0x59, 0xf8, 0x38, 0x36, 0x85, 0x03, 0x39,
+  0x9e, 0xe2, 0x93, 0x38, 0xd6, 0xe4, 0xee, 0x38, 0xc6, 0xf4, 0xdc, 0x38,
+  0xd7, 0x5f, 0x01, 0x39, 0x9e, 0x6d, 0x0d, 0x39, 0xc5, 0x73, 0x31, 0x39,
+  0x12, 0x09, 0x03, 0x39, 0xb2, 0xda, 0xb8, 0x38, 0xf7, 0xe5, 0x9e, 0x38,
+  0xce, 0xb1, 0x1b, 0x39, 0x60, 0x86, 0xcc, 0x38, 0xe9, 0xbc, 0x80, 0x38,
+  0xcd, 0xa5, 0xe8, 0x38, 0xd1, 0xd2, 0xa9, 0x38, 0x70, 0x64, 0xd9, 0x38,
+  0x57, 0x84, 0x10, 0x39, 0xcf, 0x69, 0xed, 0x38, 0x2c, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f,
+  0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x5f, 0x33, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74,
+  0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x3c, 0x00, 0x00, 0x00,
+  0xa4, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2b, 0xc1, 0x2a, 0x3c, 0x12, 0x00, 0x00, 0x00,
   0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
-  0x1c, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x24, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x66, 0x6c, 0x61, 0x74, 0x74, 0x65,
-  0x6e, 0x2f, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x20, 0x00, 0x1c, 0x00,
-  0x1b, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x64, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x31, 0x8d, 0x72, 0x3b, 0x19, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76,
-  0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x31, 0x3a, 0x30, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x68, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xb8, 0xff, 0xff, 0xff,
-  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
-  0xc8, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x0c, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x16, 0xf0, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x00, 0x10, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04
+  0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x8e, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00,
+  0x04, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9d, 0x54, 0x91, 0x39,
+  0x22, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
+  0x6e, 0x73, 0x65, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f,
+  0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
+  0x4f, 0x70, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00,
+  0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x66, 0x6c,
+  0x61, 0x74, 0x74, 0x65, 0x6e, 0x2f, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x20, 0x00, 0x1c, 0x00, 0x1b, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x64, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x31, 0x8d, 0x72, 0x3b, 0x19, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61,
+  0x75, 0x6c, 0x74, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x31, 0x3a,
+  0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xb8, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x19, 0xc8, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x00, 0x0c, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xf0, 0xff, 0xff, 0xff,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x0c, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04
 };
-unsigned int str_ww_ref_model_tflite_len = 74520;
+unsigned int str_ww_ref_model_tflite_len = 74632;
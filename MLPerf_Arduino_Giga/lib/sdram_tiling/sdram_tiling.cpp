@@ -0,0 +1,323 @@
+/*
+ * sdram_tiling.cpp
+ *
+ * Bandweise Ausführung von Faltungsschichten (siehe sdram_tiling.h).
+ *
+ * Aufteilung des Arbeitspuffers pro Schicht:
+ *   [Eingabe A][Eingabe B][Ausgabe A][Ausgabe B][Kernel-Scratch]
+ * jeweils auf 32 Byte (Cachezeile des M7) ausgerichtet, damit DMA-Kopien
+ * und Cache-Wartung keine fremden Daten berühren.
+ */
+
+#include "sdram_tiling.h"
+
+#if TH_SDRAM_TILING
+
+#include <string.h>
+#include <algorithm>
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h"
+
+// Gleiche Kernel wie TFLM mit CMSIS_NN -> bitgleich zu Invoke()
+#if defined(CMSIS_NN)
+  #if __has_include("third_party/cmsis_nn/Include/arm_nnfunctions.h")
+    #include "third_party/cmsis_nn/Include/arm_nnfunctions.h"
+    #define TILE_USE_CMSIS 1
+  #elif __has_include("Include/arm_nnfunctions.h")
+    #include "Include/arm_nnfunctions.h"
+    #define TILE_USE_CMSIS 1
+  #elif __has_include("arm_nnfunctions.h")
+    #include "arm_nnfunctions.h"
+    #define TILE_USE_CMSIS 1
+  #endif
+#endif
+#ifndef TILE_USE_CMSIS
+  #define TILE_USE_CMSIS 0
+#endif
+
+namespace {
+
+constexpr int kChannelIn = 0;
+constexpr int kChannelOut = 1;
+// Größte Einzelkopie (MDMA: 65536 Bytes pro Block)
+constexpr size_t kMaxCopyBytes = 65536;
+
+int8_t* g_sram = nullptr;
+size_t g_sram_bytes = 0;
+
+tile_copy_start_fn g_copy_start = nullptr;
+tile_copy_wait_fn g_copy_wait = nullptr;
+
+uint32_t g_layers = 0;
+uint32_t g_bands = 0;
+uint32_t g_untiled = 0;
+
+inline size_t Align32(size_t n) {
+  return (n + 31) & ~(size_t)31;
+}
+
+void CopyStart(int channel, void* dst, const void* src, size_t bytes) {
+  if (g_copy_start != nullptr) {
+    g_copy_start(channel, dst, src, bytes);
+  } else {
+    memcpy(dst, src, bytes);
+  }
+}
+
+void CopyWait(int channel) {
+  if (g_copy_wait != nullptr) g_copy_wait(channel);
+}
+
+inline int32_t BandInputRows(const TileConv& L, int32_t out_rows) {
+  return (out_rows - 1) * L.stride_h + L.kh;
+}
+
+#if TILE_USE_CMSIS
+void CmsisDims(const TileConv& L, int32_t in_rows, int32_t out_rows, cmsis_nn_dims* in_dims,
+               cmsis_nn_dims* filter_dims, cmsis_nn_dims* bias_dims, cmsis_nn_dims* out_dims) {
+  *in_dims = {1, in_rows, L.in_w, L.in_c};
+  *out_dims = {1, out_rows, L.out_w, L.out_c};
+  *bias_dims = {1, 1, 1, L.out_c};
+  if (L.depthwise) {
+    *filter_dims = {1, L.kh, L.kw, L.out_c};
+  } else {
+    *filter_dims = {L.out_c, L.kh, L.kw, L.in_c};
+  }
+}
+
+cmsis_nn_conv_params CmsisConvParams(const TileConv& L, int32_t pad_h) {
+  cmsis_nn_conv_params p;
+  p.input_offset = L.in_offset;
+  p.output_offset = L.out_offset;
+  p.stride.w = L.stride_w;
+  p.stride.h = L.stride_h;
+  p.padding.w = L.pad_w;
+  p.padding.h = pad_h;
+  p.dilation.w = 1;
+  p.dilation.h = 1;
+  p.activation.min = L.act_min;
+  p.activation.max = L.act_max;
+  return p;
+}
+
+cmsis_nn_dw_conv_params CmsisDwParams(const TileConv& L, int32_t pad_h) {
+  cmsis_nn_dw_conv_params p;
+  p.input_offset = L.in_offset;
+  p.output_offset = L.out_offset;
+  p.ch_mult = L.depth_mult;
+  p.stride.w = L.stride_w;
+  p.stride.h = L.stride_h;
+  p.padding.w = L.pad_w;
+  p.padding.h = pad_h;
+  p.dilation.w = 1;
+  p.dilation.h = 1;
+  p.activation.min = L.act_min;
+  p.activation.max = L.act_max;
+  return p;
+}
+#endif
+
+// Scratch, den der Kernel für diese Höhe braucht
+size_t ScratchBytes(const TileConv& L, int32_t in_rows, int32_t pad_h, int32_t out_rows) {
+#if TILE_USE_CMSIS
+  cmsis_nn_dims in_dims, filter_dims, bias_dims, out_dims;
+  CmsisDims(L, in_rows, out_rows, &in_dims, &filter_dims, &bias_dims, &out_dims);
+  int32_t bytes = 0;
+  if (L.depthwise) {
+    const cmsis_nn_dw_conv_params p = CmsisDwParams(L, pad_h);
+    bytes = arm_depthwise_conv_wrapper_s8_get_buffer_size(&p, &in_dims, &filter_dims, &out_dims);
+  } else {
+    const cmsis_nn_conv_params p = CmsisConvParams(L, pad_h);
+    bytes = arm_convolve_wrapper_s8_get_buffer_size(&p, &in_dims, &filter_dims, &out_dims);
+  }
+  return bytes > 0 ? (size_t)bytes : 0;
+#else
+  (void)L;
+  (void)in_rows;
+  (void)pad_h;
+  (void)out_rows;
+  return 0;
+#endif
+}
+
+// Kernel auf in_rows Eingabezeilen. Reicht der Scratch für CMSIS-NN nicht,
+// rechnet der (bitgleiche) Referenzkernel.
+void RunKernel(const TileConv& L, int32_t in_rows, int32_t pad_h, int32_t out_rows,
+               const int8_t* in, int8_t* out, void* scratch, size_t scratch_bytes) {
+#if TILE_USE_CMSIS
+  const size_t need = ScratchBytes(L, in_rows, pad_h, out_rows);
+  if (need <= scratch_bytes) {
+    cmsis_nn_context ctx;
+    ctx.buf = need ? scratch : nullptr;
+    ctx.size = (int32_t)need;
+    cmsis_nn_dims in_dims, filter_dims, bias_dims, out_dims;
+    CmsisDims(L, in_rows, out_rows, &in_dims, &filter_dims, &bias_dims, &out_dims);
+    cmsis_nn_per_channel_quant_params quant;
+    quant.multiplier = const_cast<int32_t*>(L.mult);
+    quant.shift = const_cast<int32_t*>(L.shift);
+    if (L.depthwise) {
+      const cmsis_nn_dw_conv_params p = CmsisDwParams(L, pad_h);
+      arm_depthwise_conv_wrapper_s8(&ctx, &p, &quant, &in_dims, in, &filter_dims, L.filter,
+                                    &bias_dims, L.bias, &out_dims, out);
+    } else {
+      const cmsis_nn_conv_params p = CmsisConvParams(L, pad_h);
+      arm_convolve_wrapper_s8(&ctx, &p, &quant, &in_dims, in, &filter_dims, L.filter,
+                              &bias_dims, L.bias, &out_dims, out);
+    }
+    return;
+  }
+#else
+  (void)scratch;
+  (void)scratch_bytes;
+#endif
+  const tflite::RuntimeShape in_shape({1, in_rows, L.in_w, L.in_c});
+  const tflite::RuntimeShape out_shape({1, out_rows, L.out_w, L.out_c});
+  const tflite::RuntimeShape bias_shape({L.out_c});
+  if (L.depthwise) {
+    tflite::DepthwiseParams op;
+    op.input_offset = L.in_offset;
+    op.weights_offset = 0;
+    op.output_offset = L.out_offset;
+    op.stride_width = L.stride_w;
+    op.stride_height = L.stride_h;
+    op.dilation_width_factor = 1;
+    op.dilation_height_factor = 1;
+    op.padding_type = tflite::PaddingType::kSame;
+    op.padding_values.width = L.pad_w;
+    op.padding_values.height = pad_h;
+    op.depth_multiplier = L.depth_mult;
+    op.quantized_activation_min = L.act_min;
+    op.quantized_activation_max = L.act_max;
+    tflite::reference_integer_ops::DepthwiseConvPerChannel(
+        op, L.mult, L.shift, in_shape, in,
+        tflite::RuntimeShape({1, L.kh, L.kw, L.out_c}), L.filter,
+        bias_shape, L.bias, out_shape, out);
+  } else {
+    tflite::ConvParams op;
+    op.input_offset = L.in_offset;
+    op.weights_offset = 0;
+    op.output_offset = L.out_offset;
+    op.stride_width = L.stride_w;
+    op.stride_height = L.stride_h;
+    op.dilation_width_factor = 1;
+    op.dilation_height_factor = 1;
+    op.padding_type = tflite::PaddingType::kSame;
+    op.padding_values.width = L.pad_w;
+    op.padding_values.height = pad_h;
+    op.quantized_activation_min = L.act_min;
+    op.quantized_activation_max = L.act_max;
+    tflite::reference_integer_ops::ConvPerChannel(
+        op, L.mult, L.shift, in_shape, in,
+        tflite::RuntimeShape({L.out_c, L.kh, L.kw, L.in_c}), L.filter,
+        bias_shape, L.bias, out_shape, out);
+  }
+}
+
+// Holt die Eingabezeilen für die Ausgabezeilen r0 .. r0+rows-1 nach dst.
+// Zeilen außerhalb des Bildes bekommen den Eingangs-Nullpunkt.
+void FetchBand(const TileConv& L, const int8_t* in, int32_t r0, int32_t rows, int8_t* dst) {
+  const size_t in_row = (size_t)L.in_w * L.in_c;
+  const int8_t pad_value = (int8_t)(-L.in_offset);
+  const int32_t in_rows = BandInputRows(L, rows);
+  const int32_t y0 = r0 * L.stride_h - L.pad_h;
+  const int32_t first = std::max((int32_t)0, -y0);
+  const int32_t last = std::max(first, std::min(in_rows, L.in_h - y0));
+
+  if (first > 0) memset(dst, pad_value, first * in_row);
+  if (last < in_rows) memset(dst + last * in_row, pad_value, (in_rows - last) * in_row);
+  if (last > first) {
+    CopyStart(kChannelIn, dst + first * in_row, in + (y0 + first) * in_row,
+              (last - first) * in_row);
+  }
+}
+
+}  // namespace
+
+bool tiling_init(void* sram, size_t bytes) {
+  if (sram == nullptr) return false;
+  uintptr_t p = ((uintptr_t)sram + 31) & ~(uintptr_t)31;
+  size_t lost = p - (uintptr_t)sram;
+  if (bytes <= lost) return false;
+  g_sram = (int8_t*)p;
+  g_sram_bytes = (bytes - lost) & ~(size_t)31;
+  return g_sram_bytes > 0;
+}
+
+void tiling_set_copy(tile_copy_start_fn start, tile_copy_wait_fn wait) {
+  g_copy_start = start;
+  g_copy_wait = wait;
+}
+
+int32_t tiling_band_rows(const TileConv& L) {
+  if (g_sram == nullptr) return 0;
+  const size_t in_row = (size_t)L.in_w * L.in_c;
+  const size_t out_row = (size_t)L.out_w * L.out_c;
+  for (int32_t rows = L.out_h; rows >= 1; rows--) {
+    const int32_t in_rows = BandInputRows(L, rows);
+    const size_t in_bytes = in_rows * in_row;
+    const size_t out_bytes = rows * out_row;
+    if (in_bytes > kMaxCopyBytes || out_bytes > kMaxCopyBytes) continue;
+    const size_t need = 2 * Align32(in_bytes) + 2 * Align32(out_bytes) +
+                        Align32(ScratchBytes(L, in_rows, 0, rows));
+    if (need <= g_sram_bytes) return rows;
+  }
+  return 0;
+}
+
+void tiling_run(const TileConv& L, const int8_t* in, int8_t* out) {
+  g_layers++;
+  const int32_t rows = tiling_band_rows(L);
+  if (rows == 0) {
+    // Der ganze Arbeitspuffer dient dann als Kernel-Scratch
+    g_untiled++;
+    RunKernel(L, L.in_h, L.pad_h, L.out_h, in, out, g_sram, g_sram_bytes);
+    return;
+  }
+
+  const size_t in_row = (size_t)L.in_w * L.in_c;
+  const size_t out_row = (size_t)L.out_w * L.out_c;
+  const size_t in_bytes = Align32(BandInputRows(L, rows) * in_row);
+  const size_t out_bytes = Align32(rows * out_row);
+  int8_t* in_buf[2] = {g_sram, g_sram + in_bytes};
+  int8_t* out_buf[2] = {g_sram + 2 * in_bytes, g_sram + 2 * in_bytes + out_bytes};
+  int8_t* scratch = g_sram + 2 * in_bytes + 2 * out_bytes;
+  const size_t scratch_bytes = g_sram_bytes - 2 * in_bytes - 2 * out_bytes;
+
+  const int32_t bands = (L.out_h + rows - 1) / rows;
+  FetchBand(L, in, 0, std::min(rows, L.out_h), in_buf[0]);
+  for (int32_t b = 0; b < bands; b++) {
+    const int32_t r0 = b * rows;
+    const int32_t n = std::min(rows, L.out_h - r0);
+    CopyWait(kChannelIn);
+    if (b + 1 < bands) {
+      // Puffer (b+1)%2 gehörte Band b-1, das bereits gerechnet ist
+      const int32_t next = (b + 1) * rows;
+      FetchBand(L, in, next, std::min(rows, L.out_h - next), in_buf[(b + 1) % 2]);
+    }
+    // out_buf[b%2] war Quelle von Band b-2; dessen Kopie ist abgeschlossen,
+    // bevor Band b-1 gestartet wurde.
+    RunKernel(L, BandInputRows(L, n), 0, n, in_buf[b % 2], out_buf[b % 2], scratch,
+              scratch_bytes);
+    CopyWait(kChannelOut);
+    CopyStart(kChannelOut, out + r0 * out_row, out_buf[b % 2], n * out_row);
+    g_bands++;
+  }
+  CopyWait(kChannelOut);
+}
+
+void tiling_get_stats(uint32_t* layers, uint32_t* bands, uint32_t* untiled) {
+  *layers = g_layers;
+  *bands = g_bands;
+  *untiled = g_untiled;
+}
+
+void tiling_reset_stats(void) {
+  g_layers = 0;
+  g_bands = 0;
+  g_untiled = 0;
+}
+
+#endif  // TH_SDRAM_TILING
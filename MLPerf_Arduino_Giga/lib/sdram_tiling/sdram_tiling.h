@@ -0,0 +1,88 @@
+/*
+ * sdram_tiling.h
+ *
+ * Gekachelte Ausführung von CONV_2D / DEPTHWISE_CONV_2D, wenn die Arena
+ * ins SDRAM ausweichen musste (ic01 fordert 1 MB, vww01 je nach Heap).
+ *
+ * Statt den Kernel direkt auf den Tensoren im SDRAM laufen zu lassen, wird
+ * die Ausgabe in Bänder aus R Zeilen zerlegt. Pro Band werden die dafür
+ * nötigen (R-1)*stride+kh Eingabezeilen in einen kleinen SRAM-Puffer
+ * geholt, der Kernel rechnet ohne Höhen-Padding komplett im SRAM, und das
+ * Ausgabeband wird zurückgeschrieben. Randzeilen außerhalb des Bildes werden
+ * mit dem Eingangs-Nullpunkt gefüllt und liefern damit wie das Padding der
+ * Kernel 0 im Akkumulator; das Ergebnis soll so bitgleich zum ungekachelten
+ * Lauf sein (Host-Test: MLPerf_Common/tflm_host/tiling_test, braucht die
+ * TFLM-Quellen).
+ *
+ * Eingabe- und Ausgabepuffer sind doppelt vorhanden: während Band b rechnet,
+ * holt Kanal 0 die Eingabe von Band b+1 und Kanal 1 schreibt Band b-1
+ * zurück. Die Kopien laufen über tiling_set_copy() (Giga: MDMA, siehe
+ * tile_mdma.cpp), sonst synchron per memcpy.
+ *
+ * Die Gewichte liegen im internen Flash und werden nicht kopiert. Alle
+ * anderen Operatoren (ADD, Pooling, FC, Softmax) arbeiten weiter direkt
+ * auf dem SDRAM.
+ *
+ * Aktivierung über Build-Flags (platformio.ini):
+ *   -D TH_SDRAM_TILING=1             gekachelte Kernel, sobald die Arena im SDRAM liegt
+ *   -D TH_SDRAM_TILING_SRAM=65536    SRAM-Arbeitspuffer in Bytes
+ *   -D TH_SDRAM_TILING_MDMA=0        Kopien per memcpy statt MDMA
+ */
+
+#ifndef TH_SDRAM_TILING_H_
+#define TH_SDRAM_TILING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef TH_SDRAM_TILING
+#define TH_SDRAM_TILING 0
+#endif
+
+#ifndef TH_SDRAM_TILING_SRAM
+#define TH_SDRAM_TILING_SRAM (64 * 1024)
+#endif
+
+#ifndef TH_SDRAM_TILING_MDMA
+#define TH_SDRAM_TILING_MDMA 1
+#endif
+
+// Eine Faltungsschicht in NHWC (Batch 1), Quantisierung wie die TFLM-Kernel
+struct TileConv {
+  bool depthwise;
+  int32_t in_h, in_w, in_c;
+  int32_t out_h, out_w, out_c;
+  int32_t kh, kw, stride_h, stride_w, pad_h, pad_w, depth_mult;
+  const int8_t* filter;
+  const int32_t* bias;
+  const int32_t* mult;
+  const int32_t* shift;
+  int32_t in_offset, out_offset, act_min, act_max;
+};
+
+// Kopierkanäle: 0 = SDRAM -> SRAM (Eingabe), 1 = SRAM -> SDRAM (Ausgabe)
+typedef void (*tile_copy_start_fn)(int channel, void* dst, const void* src, size_t bytes);
+typedef void (*tile_copy_wait_fn)(int channel);
+
+// sram: Arbeitspuffer im schnellen Speicher (wird auf 32 Byte ausgerichtet)
+bool tiling_init(void* sram, size_t bytes);
+
+// Asynchrone Kopien, z.B. per DMA. nullptr = synchron per memcpy.
+void tiling_set_copy(tile_copy_start_fn start, tile_copy_wait_fn wait);
+
+// Rechnet die Schicht bandweise. Passt nicht einmal eine Ausgabezeile in
+// den Arbeitspuffer, läuft der Kernel ungekachelt auf in/out.
+void tiling_run(const TileConv& L, const int8_t* in, int8_t* out);
+
+// Bandhöhe, die tiling_run() für L wählt (0 = ungekachelt)
+int32_t tiling_band_rows(const TileConv& L);
+
+// Meldet die MDMA-Kanäle des STM32H7 über tiling_set_copy() an
+// (tile_mdma.cpp). false = nicht verfügbar, Kopien bleiben bei memcpy.
+bool tile_mdma_init(void);
+
+// Statistik seit tiling_reset_stats(): Schichten, Bänder, ungekachelte Schichten
+void tiling_get_stats(uint32_t* layers, uint32_t* bands, uint32_t* untiled);
+void tiling_reset_stats(void);
+
+#endif  // TH_SDRAM_TILING_H_
@@ -0,0 +1,120 @@
+/*
+ * tile_mdma.cpp
+ *
+ * Kopien für sdram_tiling über zwei MDMA-Kanäle des STM32H7 (Software-
+ * Request, eine Übertragung pro Band). Der M7 hat einen D-Cache, die MDMA
+ * nicht:
+ *   - Quelle vor dem Start zurückschreiben (Clean),
+ *   - Ziel vor dem Start zurückschreiben und verwerfen (Clean+Invalidate),
+ *     damit keine Zeile später über die DMA-Daten geschrieben wird,
+ *   - Ziel nach dem Ende erneut verwerfen, damit die CPU frisch liest.
+ * Bereiche werden dafür auf ganze Cachezeilen erweitert. Das ist sicher,
+ * weil die CPU während einer Übertragung weder Ziel noch Randzeilen anfasst
+ * (tiling_run() arbeitet dann nur in den eigenen SRAM-Puffern).
+ */
+
+#include "sdram_tiling.h"
+
+#if TH_SDRAM_TILING
+
+#if TH_SDRAM_TILING_MDMA && (defined(STM32H7xx) || defined(STM32H747xx))
+
+#include <string.h>
+
+#include "stm32h7xx_hal.h"
+
+// Kanäle 14/15: von mbed und den Arduino-Bibliotheken nicht belegt
+#ifndef TH_TILE_MDMA_IN
+#define TH_TILE_MDMA_IN MDMA_Channel14
+#endif
+#ifndef TH_TILE_MDMA_OUT
+#define TH_TILE_MDMA_OUT MDMA_Channel15
+#endif
+
+namespace {
+
+constexpr uint32_t kTimeoutMs = 100;
+
+MDMA_HandleTypeDef g_mdma[2];
+bool g_busy[2] = {false, false};
+void* g_dst[2] = {nullptr, nullptr};
+size_t g_bytes[2] = {0, 0};
+
+// Auf ganze 32-Byte-Zeilen erweitert
+inline void LineRange(const void* p, size_t bytes, uint32_t** start, int32_t* size) {
+  const uintptr_t a = (uintptr_t)p & ~(uintptr_t)31;
+  const uintptr_t e = ((uintptr_t)p + bytes + 31) & ~(uintptr_t)31;
+  *start = (uint32_t*)a;
+  *size = (int32_t)(e - a);
+}
+
+void MdmaStart(int channel, void* dst, const void* src, size_t bytes) {
+  uint32_t* a;
+  int32_t n;
+  LineRange(src, bytes, &a, &n);
+  SCB_CleanDCache_by_Addr(a, n);
+  LineRange(dst, bytes, &a, &n);
+  SCB_CleanInvalidateDCache_by_Addr(a, n);
+
+  if (HAL_MDMA_Start(&g_mdma[channel], (uint32_t)(uintptr_t)src, (uint32_t)(uintptr_t)dst,
+                     (uint32_t)bytes, 1) != HAL_OK) {
+    // Kanal gestört: diese Kopie synchron erledigen
+    memcpy(dst, src, bytes);
+    SCB_CleanDCache_by_Addr(a, n);
+    return;
+  }
+  g_busy[channel] = true;
+  g_dst[channel] = dst;
+  g_bytes[channel] = bytes;
+}
+
+void MdmaWait(int channel) {
+  if (!g_busy[channel]) return;
+  HAL_MDMA_PollForTransfer(&g_mdma[channel], HAL_MDMA_FULL_TRANSFER, kTimeoutMs);
+  g_busy[channel] = false;
+  uint32_t* a;
+  int32_t n;
+  LineRange(g_dst[channel], g_bytes[channel], &a, &n);
+  SCB_InvalidateDCache_by_Addr(a, n);
+}
+
+bool InitChannel(MDMA_HandleTypeDef* h, MDMA_Channel_TypeDef* instance) {
+  h->Instance = instance;
+  h->Init.Request = MDMA_REQUEST_SW;
+  h->Init.TransferTriggerMode = MDMA_FULL_TRANSFER;
+  h->Init.Priority = MDMA_PRIORITY_HIGH;
+  h->Init.Endianness = MDMA_LITTLE_ENDIANNESS_PRESERVE;
+  // Zeilenanfänge sind beliebig ausgerichtet -> Byte-Zugriffe, gepackt
+  h->Init.SourceInc = MDMA_SRC_INC_BYTE;
+  h->Init.DestinationInc = MDMA_DEST_INC_BYTE;
+  h->Init.SourceDataSize = MDMA_SRC_DATASIZE_BYTE;
+  h->Init.DestDataSize = MDMA_DEST_DATASIZE_BYTE;
+  h->Init.DataAlignment = MDMA_DATAALIGN_PACKENABLE;
+  h->Init.BufferTransferLength = 128;
+  h->Init.SourceBurst = MDMA_SOURCE_BURST_SINGLE;
+  h->Init.DestBurst = MDMA_DEST_BURST_SINGLE;
+  h->Init.SourceBlockAddressOffset = 0;
+  h->Init.DestBlockAddressOffset = 0;
+  return HAL_MDMA_Init(h) == HAL_OK;
+}
+
+}  // namespace
+
+bool tile_mdma_init(void) {
+  __HAL_RCC_MDMA_CLK_ENABLE();
+  if (!InitChannel(&g_mdma[0], TH_TILE_MDMA_IN) || !InitChannel(&g_mdma[1], TH_TILE_MDMA_OUT)) {
+    return false;
+  }
+  tiling_set_copy(MdmaStart, MdmaWait);
+  return true;
+}
+
+#else
+
+bool tile_mdma_init(void) {
+  return false;
+}
+
+#endif
+
+#endif  // TH_SDRAM_TILING
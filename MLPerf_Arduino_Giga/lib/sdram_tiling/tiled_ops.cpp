@@ -0,0 +1,119 @@
+/*
+ * tiled_ops.cpp
+ */
+
+#include "tiled_ops.h"
+
+#if TH_SDRAM_TILING
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/kernels/conv.h"
+#include "tensorflow/lite/micro/kernels/depthwise_conv.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_log.h"
+
+namespace {
+
+void* TiledInit(TfLiteContext* context, const char* buffer, size_t length) {
+  (void)buffer;
+  (void)length;
+  return context->AllocatePersistentBuffer(context, sizeof(tflite::OpDataConv));
+}
+
+// Gemeinsamer Teil: Geometrie aus den Tensoren, Quantisierung aus OpDataConv
+bool FillLayer(const tflite::OpDataConv& data, const TfLiteEvalTensor* input,
+               const TfLiteEvalTensor* filter, const TfLiteEvalTensor* bias,
+               const TfLiteEvalTensor* output, TileConv* L) {
+  if (input->type != kTfLiteInt8 || filter->type != kTfLiteInt8 ||
+      (bias != nullptr && bias->type != kTfLiteInt32)) {
+    return false;
+  }
+  const tflite::RuntimeShape in_shape = tflite::micro::GetTensorShape(input);
+  const tflite::RuntimeShape filter_shape = tflite::micro::GetTensorShape(filter);
+  const tflite::RuntimeShape out_shape = tflite::micro::GetTensorShape(output);
+  if (in_shape.Dims(0) != 1) return false;
+
+  L->in_h = in_shape.Dims(1);
+  L->in_w = in_shape.Dims(2);
+  L->in_c = in_shape.Dims(3);
+  L->out_h = out_shape.Dims(1);
+  L->out_w = out_shape.Dims(2);
+  L->out_c = out_shape.Dims(3);
+  L->kh = filter_shape.Dims(1);
+  L->kw = filter_shape.Dims(2);
+  L->pad_h = data.padding.height;
+  L->pad_w = data.padding.width;
+  L->filter = tflite::micro::GetTensorData<int8_t>(filter);
+  L->bias = tflite::micro::GetOptionalTensorData<int32_t>(bias);
+  L->mult = data.per_channel_output_multiplier;
+  L->shift = data.per_channel_output_shift;
+  L->in_offset = -data.input_zero_point;
+  L->out_offset = data.output_zero_point;
+  L->act_min = data.output_activation_min;
+  L->act_max = data.output_activation_max;
+  return true;
+}
+
+TfLiteStatus TiledConvEval(TfLiteContext* context, TfLiteNode* node) {
+  const auto& params = *(reinterpret_cast<TfLiteConvParams*>(node->builtin_data));
+  const auto& data = *(static_cast<const tflite::OpDataConv*>(node->user_data));
+  const TfLiteEvalTensor* input = tflite::micro::GetEvalInput(context, node, tflite::kConvInputTensor);
+  const TfLiteEvalTensor* filter = tflite::micro::GetEvalInput(context, node, tflite::kConvWeightsTensor);
+  const TfLiteEvalTensor* bias = node->inputs->size == 3
+      ? tflite::micro::GetEvalInput(context, node, tflite::kConvBiasTensor) : nullptr;
+  TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, tflite::kConvOutputTensor);
+
+  TileConv L;
+  L.depthwise = false;
+  L.depth_mult = 1;
+  L.stride_h = params.stride_height;
+  L.stride_w = params.stride_width;
+  if (params.dilation_height_factor != 1 || params.dilation_width_factor != 1 ||
+      !FillLayer(data, input, filter, bias, output, &L)) {
+    MicroPrintf("Tiled CONV_2D: nur int8 ohne Dilation");
+    return kTfLiteError;
+  }
+  tiling_run(L, tflite::micro::GetTensorData<int8_t>(input),
+             tflite::micro::GetTensorData<int8_t>(output));
+  return kTfLiteOk;
+}
+
+TfLiteStatus TiledDepthwiseEval(TfLiteContext* context, TfLiteNode* node) {
+  const auto& params = *(reinterpret_cast<TfLiteDepthwiseConvParams*>(node->builtin_data));
+  const auto& data = *(static_cast<const tflite::OpDataConv*>(node->user_data));
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, tflite::kDepthwiseConvInputTensor);
+  const TfLiteEvalTensor* filter =
+      tflite::micro::GetEvalInput(context, node, tflite::kDepthwiseConvWeightsTensor);
+  const TfLiteEvalTensor* bias = node->inputs->size == 3
+      ? tflite::micro::GetEvalInput(context, node, tflite::kDepthwiseConvBiasTensor) : nullptr;
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, tflite::kDepthwiseConvOutputTensor);
+
+  TileConv L;
+  L.depthwise = true;
+  L.depth_mult = params.depth_multiplier;
+  L.stride_h = params.stride_height;
+  L.stride_w = params.stride_width;
+  if (params.dilation_height_factor != 1 || params.dilation_width_factor != 1 ||
+      !FillLayer(data, input, filter, bias, output, &L)) {
+    MicroPrintf("Tiled DEPTHWISE_CONV_2D: nur int8 ohne Dilation");
+    return kTfLiteError;
+  }
+  tiling_run(L, tflite::micro::GetTensorData<int8_t>(input),
+             tflite::micro::GetTensorData<int8_t>(output));
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+TFLMRegistration tiling_conv2d_registration(void) {
+  return tflite::micro::RegisterOp(TiledInit, tflite::ConvPrepare, TiledConvEval);
+}
+
+TFLMRegistration tiling_depthwise_conv2d_registration(void) {
+  return tflite::micro::RegisterOp(TiledInit, tflite::DepthwiseConvPrepare, TiledDepthwiseEval);
+}
+
+#endif  // TH_SDRAM_TILING
@@ -0,0 +1,23 @@
+/*
+ * tiled_ops.h
+ *
+ * TFLM-Registrierungen für CONV_2D / DEPTHWISE_CONV_2D, die über
+ * tiling_run() rechnen (siehe sdram_tiling.h). Init/Prepare sind die der
+ * TFLM-Referenzkernel (OpDataConv), nur Eval ist ersetzt.
+ */
+
+#ifndef TH_TILED_OPS_H_
+#define TH_TILED_OPS_H_
+
+#include "sdram_tiling.h"
+
+#if TH_SDRAM_TILING
+
+#include "tensorflow/lite/micro/micro_common.h"
+
+TFLMRegistration tiling_conv2d_registration(void);
+TFLMRegistration tiling_depthwise_conv2d_registration(void);
+
+#endif  // TH_SDRAM_TILING
+
+#endif  // TH_TILED_OPS_H_
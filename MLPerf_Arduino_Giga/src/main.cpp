@@ -8,6 +8,7 @@
 #include <Arduino.h>
 #include "internally_implemented.h" // Für Benchmark-Funktionen
 #include "submitter_implemented.h" // Für th_getchar()
+#include "dualcore.h" // th_dualcore_service() im Dual-Core-Betrieb
 
 void setup() {
   // WICHTIG: Wir nutzen die MLPerf-Initialisierung.
@@ -18,6 +19,13 @@ void setup() {
 }
 
 void loop() {
+#if TH_GIGA_DUALCORE && !defined(TH_GIGA_M4)
+  // Dual-Core: der M4 besitzt die serielle Schnittstelle und den Parser,
+  // der M7 rechnet nur die Aufträge, die er über RPC bekommt.
+  th_dualcore_service();
+  return;
+#endif
+
   // 1. Zeichen empfangen
   // Wir rufen DEINE th_getchar() Funktion auf.
   // Die enthält jetzt deine Debug-Punkte (...) und lauscht
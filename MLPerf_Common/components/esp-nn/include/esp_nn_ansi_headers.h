@@ -0,0 +1,935 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+/**
+ * @file        Header definitions to include for esp_nn reference functions
+ */
+
+#include "esp_nn_defs.h"
+/************************** Basic math functions ****************************/
+
+/**
+ * @brief       elementwise addition
+ *
+ * @note        inputs type: int8_t, output: int8_t
+ *              input offsets: although int32_t, they are contained in 8 bits [-128, 127]
+ *
+ *              shift values are expected to be <= 0
+ */
+void esp_nn_add_elementwise_s8_ansi(const int8_t *input1_data,
+                                    const int8_t *input2_data,
+                                    const int32_t input1_offset,
+                                    const int32_t input2_offset,
+                                    const int32_t input1_mult,
+                                    const int32_t input2_mult,
+                                    const int32_t input1_shift,
+                                    const int32_t input2_shift,
+                                    const int32_t left_shift,
+                                    int8_t *output,
+                                    const int32_t out_offset,
+                                    const int32_t out_mult,
+                                    const int32_t out_shift,
+                                    const int32_t activation_min,
+                                    const int32_t activation_max,
+                                    const int32_t size);
+/**
+ * @brief       elementwise multiplication
+ *
+ * @note        inputs type: int8_t, output: int8_t
+ *              input offsets: although int32_t, they are contained in 8 bits [-128, 127]
+ *
+ *              output shift is expected to be <= 0
+ */
+void esp_nn_mul_elementwise_s8_ansi(const int8_t *input1_data,
+                                    const int8_t *input2_data,
+                                    const int32_t input1_offset,
+                                    const int32_t input2_offset,
+                                    int8_t *output,
+                                    const int32_t out_offset,
+                                    const int32_t out_mult,
+                                    const int32_t out_shift,
+                                    const int32_t activation_min,
+                                    const int32_t activation_max,
+                                    const int32_t size);
+
+
+/************************** Convolution functions *****************************/
+
+/**
+ * @brief       depthwise convolution per channel
+ *
+ * @note        inputs type: int8_t, output: int8_t
+ *              Version used in tflite is per channel.
+ *              This version follows the same footsprints.
+ *              Meaning, it has per out_channel shift and multiplier for
+ *              requantization
+ *
+ *              optimization notes: Though input_offset is int32 type,
+ *              offset values are contained in 8 bits [-128, 127]
+ */
+void esp_nn_depthwise_conv_s8_ansi(const data_dims_t *input_dims,
+                                   const int8_t *input_data,
+                                   const data_dims_t *filter_dims,
+                                   const int8_t *filter_data,
+                                   const int32_t *bias,
+                                   const data_dims_t *output_dims,
+                                   int8_t *out_data,
+                                   const dw_conv_params_t *conv_params,
+                                   const quant_data_t *quant_data);
+
+/**
+ * @brief       2d-convolution channelwise
+ *
+ * @note        operation: result += (input + offset) * filter
+ *
+ *              inputs type: int8_t, output: int8_t
+ *              input offsets: although int32_t, they are contained in 8 bits [-128, 127]
+ */
+void esp_nn_conv_s8_ansi(const data_dims_t *input_dims,
+                         const int8_t *input_data,
+                         const data_dims_t *filter_dims,
+                         const int8_t *filter_data,
+                         const int32_t *bias,
+                         const data_dims_t *output_dims,
+                         int8_t *out_data,
+                         const conv_params_t *conv_params,
+                         const quant_data_t *quant_data);
+
+int esp_nn_get_conv_scratch_size_ansi(const data_dims_t *input_dims,
+                                      const data_dims_t *filter_dims,
+                                      const data_dims_t *output_dims,
+                                      const conv_params_t *conv_params);
+void esp_nn_set_conv_scratch_buf_ansi(const void *buf);
+
+/**
+ * @brief       2d-convolution channelwise followed by elementwise addition
+ *
+ * @note        out_data = add(conv(input_data), skip_data), bit exact with
+ *              esp_nn_conv_s8 followed by esp_nn_add_elementwise_s8. The
+ *              convolution result is input1 of the add. skip_data has the
+ *              output dims. Uses the scratch buffer of esp_nn_conv_s8
+ *              (esp_nn_get_conv_scratch_size / esp_nn_set_conv_scratch_buf).
+ */
+void esp_nn_conv_add_s8_ansi(const data_dims_t *input_dims,
+                             const int8_t *input_data,
+                             const data_dims_t *filter_dims,
+                             const int8_t *filter_data,
+                             const int32_t *bias,
+                             const int8_t *skip_data,
+                             const data_dims_t *output_dims,
+                             int8_t *out_data,
+                             const conv_params_t *conv_params,
+                             const quant_data_t *quant_data,
+                             const conv_add_params_t *add_params);
+
+int esp_nn_get_depthwise_conv_scratch_size_ansi(const data_dims_t *input_dims,
+                                                const data_dims_t *filter_dims,
+                                                const data_dims_t *output_dims,
+                                                const dw_conv_params_t *conv_params);
+void esp_nn_set_depthwise_conv_scratch_buf_ansi(const void *buf);
+
+/**
+ * @brief       depthwise convolution followed by a 1x1 pointwise convolution
+ *
+ * @note        bit exact with esp_nn_depthwise_conv_s8 followed by
+ *              esp_nn_conv_s8. The depthwise output is only ever held
+ *              `params->strip_ht` rows at a time in scratch
+ *              (esp_nn_get_dw_pw_conv_scratch_size / esp_nn_set_dw_pw_conv_scratch_buf),
+ *              which also holds the scratch of both stage kernels.
+ */
+void esp_nn_dw_pw_conv_s8_ansi(const data_dims_t *input_dims,
+                               const int8_t *input_data,
+                               const data_dims_t *dw_filter_dims,
+                               const int8_t *dw_filter_data,
+                               const int32_t *dw_bias,
+                               const data_dims_t *pw_filter_dims,
+                               const int8_t *pw_filter_data,
+                               const int32_t *pw_bias,
+                               const data_dims_t *output_dims,
+                               int8_t *out_data,
+                               const dw_pw_conv_params_t *params);
+
+int esp_nn_get_dw_pw_conv_scratch_size_ansi(const data_dims_t *input_dims,
+                                            const data_dims_t *dw_filter_dims,
+                                            const data_dims_t *pw_filter_dims,
+                                            const data_dims_t *output_dims,
+                                            const dw_pw_conv_params_t *params);
+void esp_nn_set_dw_pw_conv_scratch_buf_ansi(const void *buf);
+
+/**
+ * @brief       convolution plans: kernel choice once per layer
+ *
+ * @note        *_plan_create picks the kernel variant for the geometry, fills
+ *              the plan and returns the scratch size it needs (the same as
+ *              the matching get_*_scratch_size). *_execute runs the planned
+ *              variant, bit exact with the per call esp_nn_conv_s8 /
+ *              esp_nn_depthwise_conv_s8, using the buffer set with the
+ *              matching set_*_scratch_buf. A plan only stays valid for the
+ *              implementation that created it.
+ */
+int esp_nn_conv_plan_create_ansi(conv_plan_t *plan,
+                                 const data_dims_t *input_dims,
+                                 const data_dims_t *filter_dims,
+                                 const data_dims_t *output_dims,
+                                 const conv_params_t *conv_params);
+void esp_nn_conv_s8_execute_ansi(const conv_plan_t *plan,
+                                 const int8_t *input_data,
+                                 const int8_t *filter_data,
+                                 const int32_t *bias,
+                                 int8_t *out_data,
+                                 const quant_data_t *quant_data);
+
+/* no packed layout for the reference, see esp_nn_get_conv_packed_filter_size_opt */
+int esp_nn_get_conv_packed_filter_size_ansi(const conv_plan_t *plan);
+
+int esp_nn_depthwise_conv_plan_create_ansi(dw_conv_plan_t *plan,
+                                           const data_dims_t *input_dims,
+                                           const data_dims_t *filter_dims,
+                                           const data_dims_t *output_dims,
+                                           const dw_conv_params_t *conv_params);
+void esp_nn_depthwise_conv_s8_execute_ansi(const dw_conv_plan_t *plan,
+                                           const int8_t *input_data,
+                                           const int8_t *filter_data,
+                                           const int32_t *bias,
+                                           int8_t *out_data,
+                                           const quant_data_t *quant_data);
+
+/**
+ * @brief       reentrant entry points
+ *
+ * @note        Same kernels as the entry points without _ctx, bit exact with
+ *              them, but the scratch comes from `ctx` (esp_nn_ctx_t) instead of
+ *              the buffers set with set_*_scratch_buf. Calls with different
+ *              contexts share no state and may run concurrently. The entry
+ *              points without _ctx stay as wrappers on a global context.
+ */
+void esp_nn_conv_s8_execute_ctx_ansi(const esp_nn_ctx_t *ctx,
+                                     const conv_plan_t *plan,
+                                     const int8_t *input_data,
+                                     const int8_t *filter_data,
+                                     const int32_t *bias,
+                                     int8_t *out_data,
+                                     const quant_data_t *quant_data);
+void esp_nn_conv_add_s8_execute_ctx_ansi(const esp_nn_ctx_t *ctx,
+                                         const conv_plan_t *plan,
+                                         const int8_t *input_data,
+                                         const int8_t *filter_data,
+                                         const int32_t *bias,
+                                         const int8_t *skip_data,
+                                         int8_t *out_data,
+                                         const quant_data_t *quant_data,
+                                         const conv_add_params_t *add_params);
+void esp_nn_depthwise_conv_s8_execute_ctx_ansi(const esp_nn_ctx_t *ctx,
+                                               const dw_conv_plan_t *plan,
+                                               const int8_t *input_data,
+                                               const int8_t *filter_data,
+                                               const int32_t *bias,
+                                               int8_t *out_data,
+                                               const quant_data_t *quant_data);
+void esp_nn_conv_s8_ctx_ansi(const esp_nn_ctx_t *ctx,
+                             const data_dims_t *input_dims,
+                             const int8_t *input_data,
+                             const data_dims_t *filter_dims,
+                             const int8_t *filter_data,
+                             const int32_t *bias,
+                             const data_dims_t *output_dims,
+                             int8_t *out_data,
+                             const conv_params_t *conv_params,
+                             const quant_data_t *quant_data);
+void esp_nn_conv_add_s8_ctx_ansi(const esp_nn_ctx_t *ctx,
+                                 const data_dims_t *input_dims,
+                                 const int8_t *input_data,
+                                 const data_dims_t *filter_dims,
+                                 const int8_t *filter_data,
+                                 const int32_t *bias,
+                                 const int8_t *skip_data,
+                                 const data_dims_t *output_dims,
+                                 int8_t *out_data,
+                                 const conv_params_t *conv_params,
+                                 const quant_data_t *quant_data,
+                                 const conv_add_params_t *add_params);
+void esp_nn_depthwise_conv_s8_ctx_ansi(const esp_nn_ctx_t *ctx,
+                                       const data_dims_t *input_dims,
+                                       const int8_t *input_data,
+                                       const data_dims_t *filter_dims,
+                                       const int8_t *filter_data,
+                                       const int32_t *bias,
+                                       const data_dims_t *output_dims,
+                                       int8_t *out_data,
+                                       const dw_conv_params_t *conv_params,
+                                       const quant_data_t *quant_data);
+void esp_nn_dw_pw_conv_s8_ctx_ansi(const esp_nn_ctx_t *ctx,
+                                   const data_dims_t *input_dims,
+                                   const int8_t *input_data,
+                                   const data_dims_t *dw_filter_dims,
+                                   const int8_t *dw_filter_data,
+                                   const int32_t *dw_bias,
+                                   const data_dims_t *pw_filter_dims,
+                                   const int8_t *pw_filter_data,
+                                   const int32_t *pw_bias,
+                                   const data_dims_t *output_dims,
+                                   int8_t *out_data,
+                                   const dw_pw_conv_params_t *params);
+
+/**
+ * @brief       row parallel convolution over the workers of ctx->pool
+ *
+ * @note        The output rows of the plan are split into one band per
+ *              worker; each band is planned and run as a convolution of its
+ *              own on the input rows it needs, so the result is bit exact
+ *              with esp_nn_conv_s8_execute_ctx. Tiny layers stay serial, see
+ *              esp_nn_ctx_t. ctx->conv_scratch (ctx->depthwise_scratch) holds
+ *              the scratch of all bands, sized with
+ *              esp_nn_get_conv_parallel_scratch_size for the pool used.
+ */
+int esp_nn_get_conv_parallel_scratch_size_ansi(const esp_nn_pool_t *pool,
+                                               const conv_plan_t *plan);
+void esp_nn_conv_s8_parallel_ansi(const esp_nn_ctx_t *ctx,
+                                  const conv_plan_t *plan,
+                                  const int8_t *input_data,
+                                  const int8_t *filter_data,
+                                  const int32_t *bias,
+                                  int8_t *out_data,
+                                  const quant_data_t *quant_data);
+int esp_nn_get_depthwise_conv_parallel_scratch_size_ansi(const esp_nn_pool_t *pool,
+                                                         const dw_conv_plan_t *plan);
+void esp_nn_depthwise_conv_s8_parallel_ansi(const esp_nn_ctx_t *ctx,
+                                            const dw_conv_plan_t *plan,
+                                            const int8_t *input_data,
+                                            const int8_t *filter_data,
+                                            const int32_t *bias,
+                                            int8_t *out_data,
+                                            const quant_data_t *quant_data);
+
+/************************** Activation functions *****************************/
+
+/**
+ * @brief       relu6
+ *
+ * @note        inout: int8_t
+ */
+void esp_nn_relu6_s8_ansi(int8_t *data, uint16_t size);
+
+/************************** Pooling functions *****************************/
+
+
+/**
+ * @brief       max_pool
+ *
+ * @note        inputs type: int8_t, output: int8_t
+ *              input offsets: although int32_t, they are contained in 8 bits [-128, 127]
+ */
+void esp_nn_max_pool_s8_ansi(const int8_t *input,
+                             const uint16_t input_wd,
+                             const uint16_t input_ht,
+                             int8_t *output,
+                             const uint16_t output_wd,
+                             const uint16_t output_ht,
+                             const uint16_t stride_wd,
+                             const uint16_t stride_ht,
+                             const uint16_t filter_wd,
+                             const uint16_t filter_ht,
+                             const uint16_t pad_wd,
+                             const uint16_t pad_ht,
+                             const int32_t activation_min,
+                             const int32_t activation_max,
+                             const uint16_t channels);
+
+/**
+ * @brief       avg_pool
+ *
+ * @note        inputs type: int8_t, output: int8_t
+ *              input offsets: although int32_t, they are contained in 8 bits [-128, 127]
+ */
+void esp_nn_avg_pool_s8_ansi(const int8_t *input,
+                             const uint16_t input_wd,
+                             const uint16_t input_ht,
+                             int8_t *output,
+                             const uint16_t output_wd,
+                             const uint16_t output_ht,
+                             const uint16_t stride_wd,
+                             const uint16_t stride_ht,
+                             const uint16_t filter_wd,
+                             const uint16_t filter_ht,
+                             const uint16_t pad_wd,
+                             const uint16_t pad_ht,
+                             const int32_t activation_min,
+                             const int32_t activation_max,
+                             const uint16_t channels);
+
+
+/************************** Fully connected functions ***********************/
+
+/**
+ * @brief       fully connected
+ *
+ * @note        inputs type: int8_t, output: int8_t
+ *              input offsets: although int32_t, they are contained in 8 bits [-128, 127]
+ */
+void esp_nn_fully_connected_s8_ansi(const int8_t *input_data,
+                                    const int32_t input_offset,
+                                    const uint16_t row_len,
+                                    const int8_t *filter_data,
+                                    const int32_t filter_offset,
+                                    const int32_t *bias,
+                                    int8_t *out_data,
+                                    const uint16_t out_channels,
+                                    const int32_t out_offset,
+                                    const int32_t out_shift,
+                                    const int32_t out_mult,
+                                    const int32_t activation_min,
+                                    const int32_t activation_max);
+
+/**
+ * @brief       fully connected
+ *
+ * @note        inputs type: int8_t, output: int8_t
+ *              input offsets: although int32_t, they are contained in 8 bits [-128, 127]
+ *              out_mult, out_shift: int32_t* containing per-channel data
+ */
+void esp_nn_fully_connected_per_ch_s8_ansi(const int8_t *input_data,
+                                    const int32_t input_offset,
+                                    const uint16_t row_len,
+                                    const int8_t *filter_data,
+                                    const int32_t filter_offset,
+                                    const int32_t *bias,
+                                    int8_t *out_data,
+                                    const uint16_t out_channels,
+                                    const int32_t out_offset,
+                                    const int32_t* out_shift,
+                                    const int32_t* out_mult,
+                                    const int32_t activation_min,
+                                    const int32_t activation_max);
+
+/* no per channel table in the reference, see esp_nn_get_fully_connected_plan_size_opt */
+int esp_nn_get_fully_connected_plan_size_ansi(const uint16_t out_channels);
+
+/**
+ * @brief   Get scratch buffer size needed by softmax function
+ *
+ * @param   width
+ * @param   height
+ * @return  size in bytes
+ *
+ * @note    buffer must be 4 byte aligned
+ */
+int32_t esp_nn_get_softmax_scratch_size_ansi(const int32_t width, const int32_t height);
+
+/* ANSI C function to be hooked up when optimised version needed */
+int32_t esp_nn_get_softmax_scratch_size_opt(const int32_t width, const int32_t height);
+
+/**
+ * @brief   Set scratch buffer to be used by softmax function
+ *
+ * @param   buffer  this can be NULL if one needs to unset it
+ *                  must be aligned to 4 bytes
+ */
+void esp_nn_set_softmax_scratch_buf_ansi(void *buffer);
+
+/**
+ * @brief       reference softmax function
+ *
+ * @note        inputs type: int8_t, output: int8_t
+ */
+void esp_nn_softmax_s8_ansi(const int8_t *input_data,
+                            const int32_t height,
+                            const int32_t width,
+                            const int32_t mult,
+                            const int32_t shift,
+                            const int32_t diff_min,
+                            int8_t *output_data);
+
+/* reentrant softmax, scratch from ctx->softmax_scratch */
+void esp_nn_softmax_s8_ctx_ansi(const esp_nn_ctx_t *ctx,
+                                const int8_t *input_data,
+                                const int32_t height,
+                                const int32_t width,
+                                const int32_t mult,
+                                const int32_t shift,
+                                const int32_t diff_min,
+                                int8_t *output_data);
+
+
+//////////////////////////// Generic optimisations /////////////////////////////
+
+/************************** Convolution functions *****************************/
+
+/**
+ * @brief       2d-convolution channelwise optimized version
+ *
+ * @note        operation: result += (input + offset) * filter
+ *
+ *              inputs type: int8_t, output: int8_t
+ *              input offsets: although int32_t, they are contained in 8 bits [-128, 127]
+ */
+void esp_nn_conv_s8_opt(const data_dims_t *input_dims,
+                        const int8_t *input_data,
+                        const data_dims_t *filter_dims,
+                        const int8_t *filter_data,
+                        const int32_t *bias,
+                        const data_dims_t *output_dims,
+                        int8_t *out_data,
+                        const conv_params_t *conv_params,
+                        const quant_data_t *quant_data);
+
+/**
+ * @brief       depthwise convolution per channel optimized version
+ *
+ * @note        inputs type: int8_t, output: int8_t
+ *              Version used in tflite is per channel.
+ *              This version follows the same footsprints.
+ *              Meaning, it has per out_channel shift and multiplier for
+ *              requantization
+ *
+ *              optimization notes: Though input_offset is int32 type,
+ *              offset values are contained in 8 bits [-128, 127]
+ */
+void esp_nn_depthwise_conv_s8_opt(const data_dims_t *input_dims,
+                                  const int8_t *input_data,
+                                  const data_dims_t *filter_dims,
+                                  const int8_t *filter_data,
+                                  const int32_t *bias,
+                                  const data_dims_t *output_dims,
+                                  int8_t *out_data,
+                                  const dw_conv_params_t *conv_params,
+                                  const quant_data_t *quant_data);
+
+int esp_nn_get_conv_scratch_size_opt(const data_dims_t *input_dims,
+                                     const data_dims_t *filter_dims,
+                                     const data_dims_t *output_dims,
+                                     const conv_params_t *conv_params);
+void esp_nn_set_conv_scratch_buf_opt(const void *buf);
+
+/**
+ * @brief       2d-convolution followed by elementwise addition, optimized version
+ *
+ * @note        the add is applied per output pixel in the convolution epilogue,
+ *              the convolution result is never stored on its own
+ */
+void esp_nn_conv_add_s8_opt(const data_dims_t *input_dims,
+                            const int8_t *input_data,
+                            const data_dims_t *filter_dims,
+                            const int8_t *filter_data,
+                            const int32_t *bias,
+                            const int8_t *skip_data,
+                            const data_dims_t *output_dims,
+                            int8_t *out_data,
+                            const conv_params_t *conv_params,
+                            const quant_data_t *quant_data,
+                            const conv_add_params_t *add_params);
+
+int esp_nn_get_depthwise_conv_scratch_size_opt(const data_dims_t *input_dims,
+                                               const data_dims_t *filter_dims,
+                                               const data_dims_t *output_dims,
+                                               const dw_conv_params_t *conv_params);
+void esp_nn_set_depthwise_conv_scratch_buf_opt(const void *buf);
+
+/**
+ * @brief       depthwise + pointwise convolution, optimized version
+ *
+ * @note        runs the _opt stage kernels strip by strip
+ */
+void esp_nn_dw_pw_conv_s8_opt(const data_dims_t *input_dims,
+                              const int8_t *input_data,
+                              const data_dims_t *dw_filter_dims,
+                              const int8_t *dw_filter_data,
+                              const int32_t *dw_bias,
+                              const data_dims_t *pw_filter_dims,
+                              const int8_t *pw_filter_data,
+                              const int32_t *pw_bias,
+                              const data_dims_t *output_dims,
+                              int8_t *out_data,
+                              const dw_pw_conv_params_t *params);
+
+int esp_nn_get_dw_pw_conv_scratch_size_opt(const data_dims_t *input_dims,
+                                           const data_dims_t *dw_filter_dims,
+                                           const data_dims_t *pw_filter_dims,
+                                           const data_dims_t *output_dims,
+                                           const dw_pw_conv_params_t *params);
+void esp_nn_set_dw_pw_conv_scratch_buf_opt(const void *buf);
+
+/**
+ * @brief       convolution plans, see esp_nn_conv_plan_create_ansi
+ */
+int esp_nn_conv_plan_create_opt(conv_plan_t *plan,
+                                const data_dims_t *input_dims,
+                                const data_dims_t *filter_dims,
+                                const data_dims_t *output_dims,
+                                const conv_params_t *conv_params);
+void esp_nn_conv_s8_execute_opt(const conv_plan_t *plan,
+                                const int8_t *input_data,
+                                const int8_t *filter_data,
+                                const int32_t *bias,
+                                int8_t *out_data,
+                                const quant_data_t *quant_data);
+
+int esp_nn_depthwise_conv_plan_create_opt(dw_conv_plan_t *plan,
+                                          const data_dims_t *input_dims,
+                                          const data_dims_t *filter_dims,
+                                          const data_dims_t *output_dims,
+                                          const dw_conv_params_t *conv_params);
+void esp_nn_depthwise_conv_s8_execute_opt(const dw_conv_plan_t *plan,
+                                          const int8_t *input_data,
+                                          const int8_t *filter_data,
+                                          const int32_t *bias,
+                                          int8_t *out_data,
+                                          const quant_data_t *quant_data);
+
+/**
+ * @brief       pre-packed convolution filter
+ *
+ * @note        Repacks the OHWI filter of a planned layer once (at model load or
+ *              offline) into blocks of 4 output channels, interleaved per filter
+ *              tap and 16 byte aligned, preceded by the bias with
+ *              `in_offset * sum(filter)` folded in:
+ *
+ *                int32_t bias_eff[align4(out_ch)]
+ *                int8_t  block[ceil(out_ch / 4)][filter_ht * filter_wd * in_ch][4]
+ *
+ *              The packed kernel loads every input byte once for four output
+ *              channels and does no offset arithmetic in the inner loop.
+ *              Results are bit exact with esp_nn_conv_s8 / esp_nn_conv_add_s8.
+ *
+ *              Supported: 1x1 without padding, and filters up to 16 rows high
+ *              without dilation (padded row cache, scratch from
+ *              esp_nn_get_conv_packed_scratch_size_opt, set with
+ *              esp_nn_set_conv_scratch_buf_opt).
+ *
+ * @return      esp_nn_get_conv_packed_filter_size_opt: bytes of the packed
+ *              filter, 0 if the layer is not supported. The buffer passed to
+ *              esp_nn_conv_pack_filter_opt must be 4 byte aligned, 16 is better.
+ *              The packed data depends on the plan's in_offset.
+ */
+int esp_nn_get_conv_packed_filter_size_opt(const conv_plan_t *plan);
+void esp_nn_conv_pack_filter_opt(const conv_plan_t *plan,
+                                 const int8_t *filter_data,
+                                 const int32_t *bias,
+                                 void *packed);
+int esp_nn_get_conv_packed_scratch_size_opt(const conv_plan_t *plan);
+void esp_nn_conv_s8_packed_opt(const conv_plan_t *plan,
+                               const int8_t *input_data,
+                               const void *packed,
+                               int8_t *out_data,
+                               const quant_data_t *quant_data);
+void esp_nn_conv_add_s8_packed_opt(const conv_plan_t *plan,
+                                   const int8_t *input_data,
+                                   const void *packed,
+                                   const int8_t *skip_data,
+                                   int8_t *out_data,
+                                   const quant_data_t *quant_data,
+                                   const conv_add_params_t *add_params);
+
+/**
+ * @brief       reentrant entry points, see esp_nn_conv_s8_execute_ctx_ansi
+ *
+ * @note        the packed kernels take their row cache from ctx->conv_scratch
+ *              (esp_nn_get_conv_packed_scratch_size_opt bytes)
+ */
+void esp_nn_conv_s8_execute_ctx_opt(const esp_nn_ctx_t *ctx,
+                                    const conv_plan_t *plan,
+                                    const int8_t *input_data,
+                                    const int8_t *filter_data,
+                                    const int32_t *bias,
+                                    int8_t *out_data,
+                                    const quant_data_t *quant_data);
+void esp_nn_conv_add_s8_execute_ctx_opt(const esp_nn_ctx_t *ctx,
+                                        const conv_plan_t *plan,
+                                        const int8_t *input_data,
+                                        const int8_t *filter_data,
+                                        const int32_t *bias,
+                                        const int8_t *skip_data,
+                                        int8_t *out_data,
+                                        const quant_data_t *quant_data,
+                                        const conv_add_params_t *add_params);
+void esp_nn_depthwise_conv_s8_execute_ctx_opt(const esp_nn_ctx_t *ctx,
+                                              const dw_conv_plan_t *plan,
+                                              const int8_t *input_data,
+                                              const int8_t *filter_data,
+                                              const int32_t *bias,
+                                              int8_t *out_data,
+                                              const quant_data_t *quant_data);
+void esp_nn_conv_s8_ctx_opt(const esp_nn_ctx_t *ctx,
+                            const data_dims_t *input_dims,
+                            const int8_t *input_data,
+                            const data_dims_t *filter_dims,
+                            const int8_t *filter_data,
+                            const int32_t *bias,
+                            const data_dims_t *output_dims,
+                            int8_t *out_data,
+                            const conv_params_t *conv_params,
+                            const quant_data_t *quant_data);
+void esp_nn_conv_add_s8_ctx_opt(const esp_nn_ctx_t *ctx,
+                                const data_dims_t *input_dims,
+                                const int8_t *input_data,
+                                const data_dims_t *filter_dims,
+                                const int8_t *filter_data,
+                                const int32_t *bias,
+                                const int8_t *skip_data,
+                                const data_dims_t *output_dims,
+                                int8_t *out_data,
+                                const conv_params_t *conv_params,
+                                const quant_data_t *quant_data,
+                                const conv_add_params_t *add_params);
+void esp_nn_depthwise_conv_s8_ctx_opt(const esp_nn_ctx_t *ctx,
+                                      const data_dims_t *input_dims,
+                                      const int8_t *input_data,
+                                      const data_dims_t *filter_dims,
+                                      const int8_t *filter_data,
+                                      const int32_t *bias,
+                                      const data_dims_t *output_dims,
+                                      int8_t *out_data,
+                                      const dw_conv_params_t *conv_params,
+                                      const quant_data_t *quant_data);
+void esp_nn_dw_pw_conv_s8_ctx_opt(const esp_nn_ctx_t *ctx,
+                                  const data_dims_t *input_dims,
+                                  const int8_t *input_data,
+                                  const data_dims_t *dw_filter_dims,
+                                  const int8_t *dw_filter_data,
+                                  const int32_t *dw_bias,
+                                  const data_dims_t *pw_filter_dims,
+                                  const int8_t *pw_filter_data,
+                                  const int32_t *pw_bias,
+                                  const data_dims_t *output_dims,
+                                  int8_t *out_data,
+                                  const dw_pw_conv_params_t *params);
+void esp_nn_conv_s8_packed_ctx_opt(const esp_nn_ctx_t *ctx,
+                                   const conv_plan_t *plan,
+                                   const int8_t *input_data,
+                                   const void *packed,
+                                   int8_t *out_data,
+                                   const quant_data_t *quant_data);
+void esp_nn_conv_add_s8_packed_ctx_opt(const esp_nn_ctx_t *ctx,
+                                       const conv_plan_t *plan,
+                                       const int8_t *input_data,
+                                       const void *packed,
+                                       const int8_t *skip_data,
+                                       int8_t *out_data,
+                                       const quant_data_t *quant_data,
+                                       const conv_add_params_t *add_params);
+
+/**
+ * @brief       row parallel convolution, see esp_nn_conv_s8_parallel_ansi
+ */
+int esp_nn_get_conv_parallel_scratch_size_opt(const esp_nn_pool_t *pool,
+                                              const conv_plan_t *plan);
+void esp_nn_conv_s8_parallel_opt(const esp_nn_ctx_t *ctx,
+                                 const conv_plan_t *plan,
+                                 const int8_t *input_data,
+                                 const int8_t *filter_data,
+                                 const int32_t *bias,
+                                 int8_t *out_data,
+                                 const quant_data_t *quant_data);
+int esp_nn_get_depthwise_conv_parallel_scratch_size_opt(const esp_nn_pool_t *pool,
+                                                        const dw_conv_plan_t *plan);
+void esp_nn_depthwise_conv_s8_parallel_opt(const esp_nn_ctx_t *ctx,
+                                           const dw_conv_plan_t *plan,
+                                           const int8_t *input_data,
+                                           const int8_t *filter_data,
+                                           const int32_t *bias,
+                                           int8_t *out_data,
+                                           const quant_data_t *quant_data);
+
+/************************** Fully connected functions *************************/
+
+/**
+ * @brief       fully connected optimized version
+ *
+ * @note        inputs type: int8_t, output: int8_t
+ *              offsets are applied once per output channel instead of per MAC,
+ *              four output channels are computed per pass over the input.
+ *              Results are bit exact with the ANSI version.
+ */
+void esp_nn_fully_connected_s8_opt(const int8_t *input_data,
+                                   const int32_t input_offset,
+                                   const uint16_t row_len,
+                                   const int8_t *filter_data,
+                                   const int32_t filter_offset,
+                                   const int32_t *bias,
+                                   int8_t *out_data,
+                                   const uint16_t out_channels,
+                                   const int32_t out_offset,
+                                   const int32_t out_shift,
+                                   const int32_t out_mult,
+                                   const int32_t activation_min,
+                                   const int32_t activation_max);
+
+/**
+ * @brief       fully connected optimized version, per-channel quantization
+ *
+ * @note        same as `esp_nn_fully_connected_s8_opt`,
+ *              out_mult, out_shift: int32_t* containing per-channel data
+ */
+void esp_nn_fully_connected_per_ch_s8_opt(const int8_t *input_data,
+                                          const int32_t input_offset,
+                                          const uint16_t row_len,
+                                          const int8_t *filter_data,
+                                          const int32_t filter_offset,
+                                          const int32_t *bias,
+                                          int8_t *out_data,
+                                          const uint16_t out_channels,
+                                          const int32_t out_offset,
+                                          const int32_t *out_shift,
+                                          const int32_t *out_mult,
+                                          const int32_t activation_min,
+                                          const int32_t activation_max);
+
+/**
+ * @brief       per channel table of a fully connected layer
+ *
+ * @note        row_term[c] = input_offset * sum(filter row c) + bias[c] only
+ *              depends on the weights, build it once per layer. The _planned
+ *              kernels take it instead of `bias` and skip summing the filter
+ *              next to the dot product. Bit exact with the unplanned kernels.
+ *
+ * @return      esp_nn_get_fully_connected_plan_size_opt: bytes of row_term
+ *              (4 byte aligned). The dispatched esp_nn_get_fully_connected_plan_size
+ *              is 0 where the target kernel has no use for it (S3 assembly,
+ *              ANSI build); call the unplanned kernel there.
+ */
+int esp_nn_get_fully_connected_plan_size_opt(const uint16_t out_channels);
+void esp_nn_fully_connected_plan_opt(const int8_t *filter_data,
+                                     const int32_t input_offset,
+                                     const uint16_t row_len,
+                                     const int32_t *bias,
+                                     const uint16_t out_channels,
+                                     int32_t *row_term);
+void esp_nn_fully_connected_s8_planned_opt(const int8_t *input_data,
+                                           const int32_t input_offset,
+                                           const uint16_t row_len,
+                                           const int8_t *filter_data,
+                                           const int32_t filter_offset,
+                                           const int32_t *row_term,
+                                           int8_t *out_data,
+                                           const uint16_t out_channels,
+                                           const int32_t out_offset,
+                                           const int32_t out_shift,
+                                           const int32_t out_mult,
+                                           const int32_t activation_min,
+                                           const int32_t activation_max);
+void esp_nn_fully_connected_per_ch_s8_planned_opt(const int8_t *input_data,
+                                                  const int32_t input_offset,
+                                                  const uint16_t row_len,
+                                                  const int8_t *filter_data,
+                                                  const int32_t filter_offset,
+                                                  const int32_t *row_term,
+                                                  int8_t *out_data,
+                                                  const uint16_t out_channels,
+                                                  const int32_t out_offset,
+                                                  const int32_t *out_shift,
+                                                  const int32_t *out_mult,
+                                                  const int32_t activation_min,
+                                                  const int32_t activation_max);
+
+/************************** Pooling functions *********************************/
+
+/**
+ * @brief       avg_pool optimized version
+ *
+ * @note        inputs type: int8_t, output: int8_t
+ *              global pooling (filter == input) has a fast path, overlapping
+ *              windows use separable sums, non overlapping windows sum four
+ *              channels per word when channels % 4 == 0 and input is 4 byte
+ *              aligned. Results are bit exact with the ANSI version.
+ */
+void esp_nn_avg_pool_s8_opt(const int8_t *input,
+                            const uint16_t input_wd,
+                            const uint16_t input_ht,
+                            int8_t *output,
+                            const uint16_t output_wd,
+                            const uint16_t output_ht,
+                            const uint16_t stride_wd,
+                            const uint16_t stride_ht,
+                            const uint16_t filter_wd,
+                            const uint16_t filter_ht,
+                            const uint16_t pad_wd,
+                            const uint16_t pad_ht,
+                            const int32_t activation_min,
+                            const int32_t activation_max,
+                            const uint16_t channels);
+
+/**
+ * @brief       max_pool optimized version
+ *
+ * @note        inputs type: int8_t, output: int8_t
+ *              four channels per pass over the window.
+ *              Results are bit exact with the ANSI version.
+ */
+void esp_nn_max_pool_s8_opt(const int8_t *input,
+                            const uint16_t input_wd,
+                            const uint16_t input_ht,
+                            int8_t *output,
+                            const uint16_t output_wd,
+                            const uint16_t output_ht,
+                            const uint16_t stride_wd,
+                            const uint16_t stride_ht,
+                            const uint16_t filter_wd,
+                            const uint16_t filter_ht,
+                            const uint16_t pad_wd,
+                            const uint16_t pad_ht,
+                            const int32_t activation_min,
+                            const int32_t activation_max,
+                            const uint16_t channels);
+
+/* ANSI C function to be hooked up when optimised version needed */
+void esp_nn_set_softmax_scratch_buf_opt(void *buffer);
+
+/**
+ * @brief       optimised version of softmax function
+ *
+ * @note        the function uses extra buffer (4 * width bytes)
+ *              hence, scratch buffers must be set before calling this.
+ */
+void esp_nn_softmax_s8_opt(const int8_t *input_data,
+                           const int32_t height,
+                           const int32_t width,
+                           const int32_t mult,
+                           const int32_t shift,
+                           const int32_t diff_min,
+                           int8_t *output_data);
+
+/* reentrant softmax, scratch from ctx->softmax_scratch */
+void esp_nn_softmax_s8_ctx_opt(const esp_nn_ctx_t *ctx,
+                               const int8_t *input_data,
+                               const int32_t height,
+                               const int32_t width,
+                               const int32_t mult,
+                               const int32_t shift,
+                               const int32_t diff_min,
+                               int8_t *output_data);
+
+/******************************** Worker pool *********************************/
+
+/**
+ * @brief       worker pool of the _parallel entry points
+ *
+ * @note        `workers` counts the calling thread: a pool of 2 starts one
+ *              helper and runs a layer on the caller and the helper. The
+ *              helpers are FreeRTOS tasks pinned one per core on ESP-IDF and
+ *              pthreads elsewhere; they sleep between calls. Returns NULL if
+ *              `workers` is not in 1..ESP_NN_POOL_MAX_WORKERS or the threads
+ *              can't be created. A pool serves one caller at a time.
+ */
+esp_nn_pool_t *esp_nn_pool_create(int workers);
+void esp_nn_pool_destroy(esp_nn_pool_t *pool);
+int esp_nn_pool_workers(const esp_nn_pool_t *pool);
+
+/**
+ * @brief       run fn(args[i]) for i in 0..n-1 on the workers and wait for all
+ *
+ * @note        job i runs on helper i, job 0 and the jobs beyond the last
+ *              helper on the caller. A NULL pool runs all jobs on the caller.
+ */
+void esp_nn_pool_run(esp_nn_pool_t *pool, void (*fn)(void *), void *const *args, int n);
@@ -0,0 +1,193 @@
+// Copyright 2022 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief structure to club data dims
+ * this structure can be used for input, output and filter
+ */
+typedef struct data_dims {
+    int32_t width;
+    int32_t height;
+    int32_t channels;
+
+    int32_t extra; // can be used as batch or any other param
+} data_dims_t;
+
+/**
+ * @brief 2d data structure (width, height)
+ *
+ */
+typedef struct data_2d {
+    int32_t width;
+    int32_t height;
+} data_2d_t;
+
+/**
+ * @brief min/max activation
+ */
+typedef struct act_params {
+    int32_t min;
+    int32_t max;
+} act_params_t;
+
+/**
+ * @brief per channel quant data
+ *
+ * @note number of shift and mult elements are equal to output channels
+ */
+typedef struct quant_data {
+    int32_t *shift;
+    int32_t *mult;
+} quant_data_t;
+
+/**
+ * @brief params specific to convolution 2d
+ *
+ */
+typedef struct conv_params {
+    int32_t in_offset;
+    int32_t out_offset;
+    data_2d_t stride;
+    data_2d_t padding;
+    data_2d_t dilation;
+    act_params_t activation;
+} conv_params_t;
+
+/**
+ * @brief params specific to depthwise convolution 2d
+ *
+ */
+typedef struct dw_conv_params {
+    int32_t in_offset;
+    int32_t out_offset;
+    int32_t ch_mult; // channel multiplier. (in_ch * ch_mult = out_ch)
+    data_2d_t stride;
+    data_2d_t padding;
+    data_2d_t dilation;
+    act_params_t activation;
+} dw_conv_params_t;
+
+/**
+ * @brief params of the elementwise add fused into a convolution
+ *
+ * @note `conv_*` requantise the convolution result, `skip_*` the skip
+ *       connection, the rest is the output stage of the add. Same fields and
+ *       semantics as the arguments of esp_nn_add_elementwise_s8.
+ */
+typedef struct conv_add_params {
+    int32_t conv_offset;
+    int32_t skip_offset;
+    int32_t conv_mult;
+    int32_t skip_mult;
+    int32_t conv_shift;
+    int32_t skip_shift;
+    int32_t left_shift;
+    int32_t out_offset;
+    int32_t out_mult;
+    int32_t out_shift;
+    act_params_t activation;
+} conv_add_params_t;
+
+/**
+ * @brief params of a depthwise convolution fused with the following 1x1 pointwise convolution
+ *
+ * @note  `pw` must describe a 1x1 convolution with stride 1 and no padding,
+ *        `pw.in_offset` is the negated `dw.out_offset`. The depthwise output
+ *        is produced `strip_ht` rows at a time into scratch and consumed by
+ *        the pointwise stage right away; `strip_ht` <= 0 uses the whole height.
+ */
+typedef struct dw_pw_conv_params {
+    dw_conv_params_t dw;
+    quant_data_t dw_quant;
+    conv_params_t pw;
+    quant_data_t pw_quant;
+    int32_t strip_ht;
+} dw_pw_conv_params_t;
+
+/**
+ * @brief kernel plan of a convolution, built once per layer
+ *
+ * @note  Filled by esp_nn_conv_plan_create from the layer geometry: the
+ *        kernel variant the target picks, the scratch it needs and the
+ *        constants derived from the geometry. esp_nn_conv_s8_execute then
+ *        only runs that variant. `variant` and `k` belong to the
+ *        implementation that built the plan; execute it with the same one.
+ */
+typedef struct conv_plan {
+    data_dims_t input_dims;
+    data_dims_t filter_dims;
+    data_dims_t output_dims;
+    conv_params_t params;
+    int32_t variant;
+    int32_t scratch_size;
+    int32_t k[4];
+} conv_plan_t;
+
+/**
+ * @brief kernel plan of a depthwise convolution, see conv_plan_t
+ */
+typedef struct dw_conv_plan {
+    data_dims_t input_dims;
+    data_dims_t filter_dims;
+    data_dims_t output_dims;
+    dw_conv_params_t params;
+    int32_t variant;
+    int32_t scratch_size;
+    int32_t k[4];
+} dw_conv_plan_t;
+
+/**
+ * @brief worker pool of the _parallel entry points, see esp_nn_pool_create
+ */
+typedef struct esp_nn_pool esp_nn_pool_t;
+
+/* upper bound of esp_nn_pool_create(workers), caller included */
+#ifndef ESP_NN_POOL_MAX_WORKERS
+#define ESP_NN_POOL_MAX_WORKERS     4
+#endif
+
+/* least multiply-accumulates per worker before a layer is split; an estimate,
+   not yet tuned on hardware */
+#ifndef ESP_NN_PARALLEL_MIN_MACS
+#define ESP_NN_PARALLEL_MIN_MACS    32768
+#endif
+
+/**
+ * @brief scratch buffers of one caller, passed to the _ctx entry points
+ *
+ * @note  The _ctx kernels use only the buffers in here and no global state,
+ *        so calls with different contexts may run at the same time (two
+ *        cores, two interpreters). Each buffer is sized with the matching
+ *        esp_nn_get_*_scratch_size; families the caller doesn't use may stay
+ *        NULL. The entry points without _ctx run on a context per kernel
+ *        family that esp_nn_set_*_scratch_buf fills.
+ *
+ *        `pool` and `parallel_min_macs` are only read by the _parallel
+ *        entry points: a layer is split over the workers of `pool` (NULL
+ *        runs it serial) as long as every worker gets at least
+ *        `parallel_min_macs` multiply-accumulates. 0 takes
+ *        ESP_NN_PARALLEL_MIN_MACS, a negative value splits any layer.
+ */
+typedef struct esp_nn_ctx {
+    void *conv_scratch;
+    void *depthwise_scratch;
+    void *dw_pw_scratch;
+    void *softmax_scratch;
+    esp_nn_pool_t *pool;
+    int32_t parallel_min_macs;
+} esp_nn_ctx_t;
@@ -0,0 +1,237 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file        Header definitions to include for esp_nn optimized functions for
+ *              the ESP32-P4 platform
+ */
+
+#pragma once
+
+#include "esp_nn_defs.h"
+#include "esp_nn_ansi_headers.h"
+
+/**
+ * @brief       2d - convolution channelwise
+ *
+ * @note        operation: result += (input + offset) * filter
+ *
+ *              inputs type: int8_t, output: int8_t
+ *              input offsets: although int32_t, they are contained in 8 bits [-128, 127]
+ */
+void esp_nn_conv_s8_esp32p4(const data_dims_t *input_dims,
+                            const int8_t *input_data,
+                            const data_dims_t *filter_dims,
+                            const int8_t *filter_data,
+                            const int32_t *bias,
+                            const data_dims_t *output_dims,
+                            int8_t *output_data,
+                            const conv_params_t *conv_params,
+                            const quant_data_t *quant_data);
+
+int esp_nn_get_conv_scratch_size_esp32p4(const data_dims_t *input_dims,
+                                         const data_dims_t *filter_dims,
+                                         const data_dims_t *output_dims,
+                                         const conv_params_t *conv_params);
+void esp_nn_set_conv_scratch_buf_esp32p4(const void *buf);
+
+/**
+ * @brief       2d-convolution followed by elementwise addition
+ *
+ * @note        the convolution writes straight into out_data and the add runs
+ *              in place on it, no separate convolution output tensor is needed
+ */
+void esp_nn_conv_add_s8_esp32p4(const data_dims_t *input_dims,
+                                const int8_t *input_data,
+                                const data_dims_t *filter_dims,
+                                const int8_t *filter_data,
+                                const int32_t *bias,
+                                const int8_t *skip_data,
+                                const data_dims_t *output_dims,
+                                int8_t *out_data,
+                                const conv_params_t *conv_params,
+                                const quant_data_t *quant_data,
+                                const conv_add_params_t *add_params);
+
+/**
+ * @brief       depthwise + pointwise convolution
+ *
+ * @note        generic depthwise and esp32p4 1x1 stage, strip by strip
+ */
+void esp_nn_dw_pw_conv_s8_esp32p4(const data_dims_t *input_dims,
+                                  const int8_t *input_data,
+                                  const data_dims_t *dw_filter_dims,
+                                  const int8_t *dw_filter_data,
+                                  const int32_t *dw_bias,
+                                  const data_dims_t *pw_filter_dims,
+                                  const int8_t *pw_filter_data,
+                                  const int32_t *pw_bias,
+                                  const data_dims_t *output_dims,
+                                  int8_t *out_data,
+                                  const dw_pw_conv_params_t *params);
+
+int esp_nn_get_dw_pw_conv_scratch_size_esp32p4(const data_dims_t *input_dims,
+                                               const data_dims_t *dw_filter_dims,
+                                               const data_dims_t *pw_filter_dims,
+                                               const data_dims_t *output_dims,
+                                               const dw_pw_conv_params_t *params);
+void esp_nn_set_dw_pw_conv_scratch_buf_esp32p4(const void *buf);
+
+/**
+ * @brief       convolution plans, see esp_nn_conv_plan_create_ansi
+ *
+ * @note        same scratch buffers as the per call kernels.
+ *              Depthwise uses the generic plan (_opt).
+ */
+int esp_nn_conv_plan_create_esp32p4(conv_plan_t *plan,
+                                    const data_dims_t *input_dims,
+                                    const data_dims_t *filter_dims,
+                                    const data_dims_t *output_dims,
+                                    const conv_params_t *conv_params);
+void esp_nn_conv_s8_execute_esp32p4(const conv_plan_t *plan,
+                                    const int8_t *input_data,
+                                    const int8_t *filter_data,
+                                    const int32_t *bias,
+                                    int8_t *out_data,
+                                    const quant_data_t *quant_data);
+
+/**
+ * @brief       reentrant entry points, see esp_nn_conv_s8_execute_ctx_ansi
+ */
+void esp_nn_conv_s8_execute_ctx_esp32p4(const esp_nn_ctx_t *ctx,
+                                        const conv_plan_t *plan,
+                                        const int8_t *input_data,
+                                        const int8_t *filter_data,
+                                        const int32_t *bias,
+                                        int8_t *out_data,
+                                        const quant_data_t *quant_data);
+void esp_nn_conv_add_s8_execute_ctx_esp32p4(const esp_nn_ctx_t *ctx,
+                                            const conv_plan_t *plan,
+                                            const int8_t *input_data,
+                                            const int8_t *filter_data,
+                                            const int32_t *bias,
+                                            const int8_t *skip_data,
+                                            int8_t *out_data,
+                                            const quant_data_t *quant_data,
+                                            const conv_add_params_t *add_params);
+void esp_nn_conv_s8_ctx_esp32p4(const esp_nn_ctx_t *ctx,
+                                const data_dims_t *input_dims,
+                                const int8_t *input_data,
+                                const data_dims_t *filter_dims,
+                                const int8_t *filter_data,
+                                const int32_t *bias,
+                                const data_dims_t *output_dims,
+                                int8_t *out_data,
+                                const conv_params_t *conv_params,
+                                const quant_data_t *quant_data);
+void esp_nn_conv_add_s8_ctx_esp32p4(const esp_nn_ctx_t *ctx,
+                                    const data_dims_t *input_dims,
+                                    const int8_t *input_data,
+                                    const data_dims_t *filter_dims,
+                                    const int8_t *filter_data,
+                                    const int32_t *bias,
+                                    const int8_t *skip_data,
+                                    const data_dims_t *output_dims,
+                                    int8_t *out_data,
+                                    const conv_params_t *conv_params,
+                                    const quant_data_t *quant_data,
+                                    const conv_add_params_t *add_params);
+void esp_nn_dw_pw_conv_s8_ctx_esp32p4(const esp_nn_ctx_t *ctx,
+                                      const data_dims_t *input_dims,
+                                      const int8_t *input_data,
+                                      const data_dims_t *dw_filter_dims,
+                                      const int8_t *dw_filter_data,
+                                      const int32_t *dw_bias,
+                                      const data_dims_t *pw_filter_dims,
+                                      const int8_t *pw_filter_data,
+                                      const int32_t *pw_bias,
+                                      const data_dims_t *output_dims,
+                                      int8_t *out_data,
+                                      const dw_pw_conv_params_t *params);
+
+/**
+ * @brief       row parallel convolution, see esp_nn_conv_s8_parallel_ansi
+ */
+int esp_nn_get_conv_parallel_scratch_size_esp32p4(const esp_nn_pool_t *pool,
+                                                  const conv_plan_t *plan);
+void esp_nn_conv_s8_parallel_esp32p4(const esp_nn_ctx_t *ctx,
+                                     const conv_plan_t *plan,
+                                     const int8_t *input_data,
+                                     const int8_t *filter_data,
+                                     const int32_t *bias,
+                                     int8_t *out_data,
+                                     const quant_data_t *quant_data);
+
+/********************** function defines ***************************/
+
+
+
+#define esp_nn_add_elementwise_s8 esp_nn_add_elementwise_s8_ansi
+#define esp_nn_mul_elementwise_s8 esp_nn_mul_elementwise_s8_ansi
+
+#define esp_nn_depthwise_conv_s8 esp_nn_depthwise_conv_s8_opt
+
+#define esp_nn_conv_s8 esp_nn_conv_s8_esp32p4
+#define esp_nn_conv_add_s8 esp_nn_conv_add_s8_esp32p4
+/* conv + add: NOT fused, the add runs afterwards over the whole output */
+#define ESP_NN_CONV_ADD_FUSED 0
+#define esp_nn_dw_pw_conv_s8 esp_nn_dw_pw_conv_s8_esp32p4
+
+#define esp_nn_get_conv_scratch_size esp_nn_get_conv_scratch_size_esp32p4
+#define esp_nn_set_conv_scratch_buf esp_nn_set_conv_scratch_buf_esp32p4
+
+#define esp_nn_get_depthwise_conv_scratch_size esp_nn_get_depthwise_conv_scratch_size_opt
+#define esp_nn_set_depthwise_conv_scratch_buf esp_nn_set_depthwise_conv_scratch_buf_opt
+
+#define esp_nn_get_dw_pw_conv_scratch_size esp_nn_get_dw_pw_conv_scratch_size_esp32p4
+#define esp_nn_set_dw_pw_conv_scratch_buf esp_nn_set_dw_pw_conv_scratch_buf_esp32p4
+
+#define esp_nn_conv_plan_create esp_nn_conv_plan_create_esp32p4
+#define esp_nn_conv_s8_execute esp_nn_conv_s8_execute_esp32p4
+#define esp_nn_depthwise_conv_plan_create esp_nn_depthwise_conv_plan_create_opt
+#define esp_nn_depthwise_conv_s8_execute esp_nn_depthwise_conv_s8_execute_opt
+
+/* pre-packed filters: size 0, the PIE kernels stay in use (the packed kernel is C only) */
+#define esp_nn_get_conv_packed_filter_size esp_nn_get_conv_packed_filter_size_ansi
+#define esp_nn_conv_pack_filter esp_nn_conv_pack_filter_opt
+#define esp_nn_get_conv_packed_scratch_size esp_nn_get_conv_packed_scratch_size_opt
+#define esp_nn_set_conv_packed_scratch_buf esp_nn_set_conv_scratch_buf_opt
+#define esp_nn_conv_s8_packed esp_nn_conv_s8_packed_opt
+#define esp_nn_conv_add_s8_packed esp_nn_conv_add_s8_packed_opt
+
+/* reentrant entry points: scratch from an esp_nn_ctx_t instead of the set_*_scratch_buf buffers */
+#define esp_nn_conv_s8_execute_ctx esp_nn_conv_s8_execute_ctx_esp32p4
+#define esp_nn_conv_add_s8_execute_ctx esp_nn_conv_add_s8_execute_ctx_esp32p4
+#define esp_nn_depthwise_conv_s8_execute_ctx esp_nn_depthwise_conv_s8_execute_ctx_opt
+#define esp_nn_conv_s8_ctx esp_nn_conv_s8_ctx_esp32p4
+#define esp_nn_conv_add_s8_ctx esp_nn_conv_add_s8_ctx_esp32p4
+#define esp_nn_depthwise_conv_s8_ctx esp_nn_depthwise_conv_s8_ctx_opt
+#define esp_nn_dw_pw_conv_s8_ctx esp_nn_dw_pw_conv_s8_ctx_esp32p4
+#define esp_nn_conv_s8_packed_ctx esp_nn_conv_s8_packed_ctx_opt
+#define esp_nn_conv_add_s8_packed_ctx esp_nn_conv_add_s8_packed_ctx_opt
+#define esp_nn_softmax_s8_ctx esp_nn_softmax_s8_ctx_opt
+
+/* row parallel convolution over ctx->pool, see esp_nn_pool_create */
+#define esp_nn_get_conv_parallel_scratch_size esp_nn_get_conv_parallel_scratch_size_esp32p4
+#define esp_nn_conv_s8_parallel esp_nn_conv_s8_parallel_esp32p4
+#define esp_nn_get_depthwise_conv_parallel_scratch_size esp_nn_get_depthwise_conv_parallel_scratch_size_opt
+#define esp_nn_depthwise_conv_s8_parallel esp_nn_depthwise_conv_s8_parallel_opt
+
+#define esp_nn_relu6_s8 esp_nn_relu6_s8_ansi
+
+#define esp_nn_avg_pool_s8 esp_nn_avg_pool_s8_opt
+#define esp_nn_max_pool_s8 esp_nn_max_pool_s8_opt
+
+#define esp_nn_fully_connected_s8 esp_nn_fully_connected_s8_opt
+#define esp_nn_fully_connected_per_ch_s8 esp_nn_fully_connected_per_ch_s8_opt
+#define esp_nn_get_fully_connected_plan_size esp_nn_get_fully_connected_plan_size_opt
+#define esp_nn_fully_connected_plan esp_nn_fully_connected_plan_opt
+#define esp_nn_fully_connected_s8_planned esp_nn_fully_connected_s8_planned_opt
+#define esp_nn_fully_connected_per_ch_s8_planned esp_nn_fully_connected_per_ch_s8_planned_opt
+
+#define esp_nn_get_softmax_scratch_size esp_nn_get_softmax_scratch_size_opt
+#define esp_nn_set_softmax_scratch_buf esp_nn_set_softmax_scratch_buf_opt
+#define esp_nn_softmax_s8 esp_nn_softmax_s8_opt
@@ -0,0 +1,324 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <esp_nn_defs.h>
+#include <esp_nn_ansi_headers.h>
+#include <common_functions.h>
+
+/**
+ * Row parallel driver for the convolutions.
+ *
+ * The output rows are cut into one band per worker. A band is a convolution
+ * of its own over the input rows it reads, with the top padding only where
+ * the band still reaches into it (as the dw_pw strips do), planned and run
+ * with the regular _ctx kernel of the target, so the result is bit exact
+ * with the serial call. Each band gets its own slot of the caller's scratch,
+ * every slot 16 byte aligned and as large as the biggest band needs:
+ *
+ *   [band 0 scratch][band 1 scratch]...
+ *
+ * Layers with fewer than `parallel_min_macs` per worker use fewer workers,
+ * down to the plain serial call on the whole plan.
+ */
+
+typedef int (*conv_par_plan_fn_t)(conv_plan_t *, const data_dims_t *, const data_dims_t *,
+                                  const data_dims_t *, const conv_params_t *);
+typedef void (*conv_par_exec_fn_t)(const esp_nn_ctx_t *, const conv_plan_t *,
+                                   const int8_t *, const int8_t *, const int32_t *,
+                                   int8_t *, const quant_data_t *);
+typedef int (*dw_par_plan_fn_t)(dw_conv_plan_t *, const data_dims_t *, const data_dims_t *,
+                                const data_dims_t *, const dw_conv_params_t *);
+typedef void (*dw_par_exec_fn_t)(const esp_nn_ctx_t *, const dw_conv_plan_t *,
+                                 const int8_t *, const int8_t *, const int32_t *,
+                                 int8_t *, const quant_data_t *);
+
+#define CONV_PAR_ALIGN(x)   (((x) + 15) & ~15)
+
+/* rows of one band: output rows [out_y, out_y + rows), input rows [in_y, in_y + in_rows) */
+typedef struct {
+    int32_t out_y;
+    int32_t rows;
+    int32_t in_y;
+    int32_t in_rows;
+    int32_t pad_ht;
+} conv_par_band_t;
+
+__NN_FORCE_INLINE__ conv_par_band_t esp_nn_conv_par_band(const int32_t band,
+                                                        const int32_t bands,
+                                                        const int32_t out_ht,
+                                                        const int32_t input_ht,
+                                                        const int32_t stride_ht,
+                                                        const int32_t pad_ht,
+                                                        const int32_t filter_ht,
+                                                        const int32_t dilation_ht)
+{
+    const int32_t out_y = out_ht * band / bands;
+    const int32_t out_end = out_ht * (band + 1) / bands;
+    const int32_t top = out_y * stride_ht - pad_ht;
+    const int32_t in_y = max(0, top);
+    const int32_t in_end = min(input_ht, (out_end - 1) * stride_ht - pad_ht +
+                                         (filter_ht - 1) * dilation_ht + 1);
+    const conv_par_band_t b = {out_y, out_end - out_y, in_y, in_end - in_y, in_y - top};
+    return b;
+}
+
+/* cost model: workers for a layer of `macs` multiply-accumulates and `out_ht` rows */
+__NN_FORCE_INLINE__ int esp_nn_conv_par_bands(const esp_nn_ctx_t *ctx, const int64_t macs,
+                                              const int32_t out_ht)
+{
+    int bands = min(esp_nn_pool_workers(ctx->pool), out_ht);
+    const int32_t min_macs = ctx->parallel_min_macs != 0 ? ctx->parallel_min_macs
+                                                         : ESP_NN_PARALLEL_MIN_MACS;
+    if (min_macs > 0 && macs / min_macs < bands) {
+        bands = (int) (macs / min_macs);
+    }
+    return max(bands, 1);
+}
+
+/********************************* convolution ********************************/
+
+__NN_FORCE_INLINE__ int64_t esp_nn_conv_par_macs(const conv_plan_t *plan)
+{
+    return (int64_t) plan->output_dims.width * plan->output_dims.height *
+           plan->output_dims.channels * plan->filter_dims.width *
+           plan->filter_dims.height * plan->input_dims.channels;
+}
+
+/* plans of the `bands` bands, returns the largest scratch of one band */
+__NN_FORCE_INLINE__ int esp_nn_conv_par_plan_bands(conv_plan_t *band_plans, const int bands,
+                                                   const conv_plan_t *plan,
+                                                   conv_par_plan_fn_t plan_create)
+{
+    int slot = 0;
+    for (int i = 0; i < bands; i++) {
+        const conv_par_band_t b = esp_nn_conv_par_band(i, bands, plan->output_dims.height,
+                                                       plan->input_dims.height,
+                                                       plan->params.stride.height,
+                                                       plan->params.padding.height,
+                                                       plan->filter_dims.height,
+                                                       plan->params.dilation.height);
+        data_dims_t in_dims = plan->input_dims;
+        data_dims_t out_dims = plan->output_dims;
+        conv_params_t params = plan->params;
+        in_dims.height = b.in_rows;
+        out_dims.height = b.rows;
+        params.padding.height = b.pad_ht;
+        slot = max(slot, plan_create(&band_plans[i], &in_dims, &plan->filter_dims,
+                                     &out_dims, &params));
+    }
+    return slot;
+}
+
+__NN_FORCE_INLINE__ int esp_nn_conv_par_scratch_size(const esp_nn_pool_t *pool,
+                                                     const conv_plan_t *plan,
+                                                     conv_par_plan_fn_t plan_create)
+{
+    /* any band count the cost model may pick, 1 is the serial call on the plan itself */
+    conv_plan_t band_plans[ESP_NN_POOL_MAX_WORKERS];
+    const int workers = min(esp_nn_pool_workers(pool), plan->output_dims.height);
+    int size = plan->scratch_size;
+    for (int bands = 2; bands <= workers; bands++) {
+        const int slot = esp_nn_conv_par_plan_bands(band_plans, bands, plan, plan_create);
+        size = max(size, bands * CONV_PAR_ALIGN(slot) + 16);
+    }
+    return size;
+}
+
+typedef struct {
+    esp_nn_ctx_t ctx;
+    const conv_plan_t *plan;
+    conv_par_exec_fn_t conv;
+    const int8_t *input_data;
+    const int8_t *filter_data;
+    const int32_t *bias;
+    int8_t *out_data;
+    const quant_data_t *quant_data;
+} conv_par_job_t;
+
+static inline void esp_nn_conv_par_job(void *arg)
+{
+    const conv_par_job_t *job = (const conv_par_job_t *) arg;
+    job->conv(&job->ctx, job->plan, job->input_data, job->filter_data, job->bias,
+              job->out_data, job->quant_data);
+}
+
+__NN_FORCE_INLINE__ void esp_nn_conv_par_run(const esp_nn_ctx_t *ctx,
+                                             const conv_plan_t *plan,
+                                             const int8_t *input_data,
+                                             const int8_t *filter_data,
+                                             const int32_t *bias,
+                                             int8_t *out_data,
+                                             const quant_data_t *quant_data,
+                                             conv_par_plan_fn_t plan_create,
+                                             conv_par_exec_fn_t conv)
+{
+    const int bands = esp_nn_conv_par_bands(ctx, esp_nn_conv_par_macs(plan),
+                                            plan->output_dims.height);
+    if (bands < 2) {
+        conv(ctx, plan, input_data, filter_data, bias, out_data, quant_data);
+        return;
+    }
+
+    conv_plan_t band_plans[ESP_NN_POOL_MAX_WORKERS];
+    conv_par_job_t jobs[ESP_NN_POOL_MAX_WORKERS];
+    void *args[ESP_NN_POOL_MAX_WORKERS];
+    const int slot = CONV_PAR_ALIGN(esp_nn_conv_par_plan_bands(band_plans, bands, plan,
+                                                               plan_create));
+    if (slot > 0 && ctx->conv_scratch == NULL) {
+        printf("esp_nn_conv_s8_parallel error! scratch_buffer not set!\n");
+        return;
+    }
+    int8_t *scratch = (int8_t *) CONV_PAR_ALIGN((uintptr_t) ctx->conv_scratch);
+
+    const int32_t in_row = plan->input_dims.width * plan->input_dims.channels;
+    const int32_t out_row = plan->output_dims.width * plan->output_dims.channels;
+    for (int i = 0; i < bands; i++) {
+        const conv_par_band_t b = esp_nn_conv_par_band(i, bands, plan->output_dims.height,
+                                                       plan->input_dims.height,
+                                                       plan->params.stride.height,
+                                                       plan->params.padding.height,
+                                                       plan->filter_dims.height,
+                                                       plan->params.dilation.height);
+        jobs[i].ctx = *ctx;
+        jobs[i].ctx.conv_scratch = slot > 0 ? scratch + i * slot : NULL;
+        jobs[i].plan = &band_plans[i];
+        jobs[i].conv = conv;
+        jobs[i].input_data = input_data + b.in_y * in_row;
+        jobs[i].filter_data = filter_data;
+        jobs[i].bias = bias;
+        jobs[i].out_data = out_data + b.out_y * out_row;
+        jobs[i].quant_data = quant_data;
+        args[i] = &jobs[i];
+    }
+    esp_nn_pool_run(ctx->pool, esp_nn_conv_par_job, args, bands);
+}
+
+/**************************** depthwise convolution ***************************/
+
+__NN_FORCE_INLINE__ int64_t esp_nn_dw_par_macs(const dw_conv_plan_t *plan)
+{
+    return (int64_t) plan->output_dims.width * plan->output_dims.height *
+           plan->output_dims.channels * plan->filter_dims.width * plan->filter_dims.height;
+}
+
+__NN_FORCE_INLINE__ int esp_nn_dw_par_plan_bands(dw_conv_plan_t *band_plans, const int bands,
+                                                 const dw_conv_plan_t *plan,
+                                                 dw_par_plan_fn_t plan_create)
+{
+    int slot = 0;
+    for (int i = 0; i < bands; i++) {
+        const conv_par_band_t b = esp_nn_conv_par_band(i, bands, plan->output_dims.height,
+                                                       plan->input_dims.height,
+                                                       plan->params.stride.height,
+                                                       plan->params.padding.height,
+                                                       plan->filter_dims.height,
+                                                       plan->params.dilation.height);
+        data_dims_t in_dims = plan->input_dims;
+        data_dims_t out_dims = plan->output_dims;
+        dw_conv_params_t params = plan->params;
+        in_dims.height = b.in_rows;
+        out_dims.height = b.rows;
+        params.padding.height = b.pad_ht;
+        slot = max(slot, plan_create(&band_plans[i], &in_dims, &plan->filter_dims,
+                                     &out_dims, &params));
+    }
+    return slot;
+}
+
+__NN_FORCE_INLINE__ int esp_nn_dw_par_scratch_size(const esp_nn_pool_t *pool,
+                                                   const dw_conv_plan_t *plan,
+                                                   dw_par_plan_fn_t plan_create)
+{
+    dw_conv_plan_t band_plans[ESP_NN_POOL_MAX_WORKERS];
+    const int workers = min(esp_nn_pool_workers(pool), plan->output_dims.height);
+    int size = plan->scratch_size;
+    for (int bands = 2; bands <= workers; bands++) {
+        const int slot = esp_nn_dw_par_plan_bands(band_plans, bands, plan, plan_create);
+        size = max(size, bands * CONV_PAR_ALIGN(slot) + 16);
+    }
+    return size;
+}
+
+typedef struct {
+    esp_nn_ctx_t ctx;
+    const dw_conv_plan_t *plan;
+    dw_par_exec_fn_t conv;
+    const int8_t *input_data;
+    const int8_t *filter_data;
+    const int32_t *bias;
+    int8_t *out_data;
+    const quant_data_t *quant_data;
+} dw_par_job_t;
+
+static inline void esp_nn_dw_par_job(void *arg)
+{
+    const dw_par_job_t *job = (const dw_par_job_t *) arg;
+    job->conv(&job->ctx, job->plan, job->input_data, job->filter_data, job->bias,
+              job->out_data, job->quant_data);
+}
+
+__NN_FORCE_INLINE__ void esp_nn_dw_par_run(const esp_nn_ctx_t *ctx,
+                                           const dw_conv_plan_t *plan,
+                                           const int8_t *input_data,
+                                           const int8_t *filter_data,
+                                           const int32_t *bias,
+                                           int8_t *out_data,
+                                           const quant_data_t *quant_data,
+                                           dw_par_plan_fn_t plan_create,
+                                           dw_par_exec_fn_t conv)
+{
+    const int bands = esp_nn_conv_par_bands(ctx, esp_nn_dw_par_macs(plan),
+                                            plan->output_dims.height);
+    if (bands < 2) {
+        conv(ctx, plan, input_data, filter_data, bias, out_data, quant_data);
+        return;
+    }
+
+    dw_conv_plan_t band_plans[ESP_NN_POOL_MAX_WORKERS];
+    dw_par_job_t jobs[ESP_NN_POOL_MAX_WORKERS];
+    void *args[ESP_NN_POOL_MAX_WORKERS];
+    const int slot = CONV_PAR_ALIGN(esp_nn_dw_par_plan_bands(band_plans, bands, plan,
+                                                             plan_create));
+    if (slot > 0 && ctx->depthwise_scratch == NULL) {
+        printf("esp_nn_depthwise_conv_s8_parallel error! scratch_buffer not set!\n");
+        return;
+    }
+    int8_t *scratch = (int8_t *) CONV_PAR_ALIGN((uintptr_t) ctx->depthwise_scratch);
+
+    const int32_t in_row = plan->input_dims.width * plan->input_dims.channels;
+    const int32_t out_row = plan->output_dims.width * plan->output_dims.channels;
+    for (int i = 0; i < bands; i++) {
+        const conv_par_band_t b = esp_nn_conv_par_band(i, bands, plan->output_dims.height,
+                                                       plan->input_dims.height,
+                                                       plan->params.stride.height,
+                                                       plan->params.padding.height,
+                                                       plan->filter_dims.height,
+                                                       plan->params.dilation.height);
+        jobs[i].ctx = *ctx;
+        jobs[i].ctx.depthwise_scratch = slot > 0 ? scratch + i * slot : NULL;
+        jobs[i].plan = &band_plans[i];
+        jobs[i].conv = conv;
+        jobs[i].input_data = input_data + b.in_y * in_row;
+        jobs[i].filter_data = filter_data;
+        jobs[i].bias = bias;
+        jobs[i].out_data = out_data + b.out_y * out_row;
+        jobs[i].quant_data = quant_data;
+        args[i] = &jobs[i];
+    }
+    esp_nn_pool_run(ctx->pool, esp_nn_dw_par_job, args, bands);
+}
@@ -0,0 +1,51 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <esp_nn_defs.h>
+#include <common_functions.h>
+
+/**
+ * Geometry part of the convolution plans. The target implementations fill
+ * in `variant`, `k` and `scratch_size` afterwards.
+ */
+
+__NN_FORCE_INLINE__ void esp_nn_conv_plan_init(conv_plan_t *plan,
+                                               const data_dims_t *input_dims,
+                                               const data_dims_t *filter_dims,
+                                               const data_dims_t *output_dims,
+                                               const conv_params_t *conv_params)
+{
+    memset(plan, 0, sizeof(*plan));
+    plan->input_dims = *input_dims;
+    plan->filter_dims = *filter_dims;
+    plan->output_dims = *output_dims;
+    plan->params = *conv_params;
+}
+
+__NN_FORCE_INLINE__ void esp_nn_dw_conv_plan_init(dw_conv_plan_t *plan,
+                                                  const data_dims_t *input_dims,
+                                                  const data_dims_t *filter_dims,
+                                                  const data_dims_t *output_dims,
+                                                  const dw_conv_params_t *conv_params)
+{
+    memset(plan, 0, sizeof(*plan));
+    plan->input_dims = *input_dims;
+    plan->filter_dims = *filter_dims;
+    plan->output_dims = *output_dims;
+    plan->params = *conv_params;
+}
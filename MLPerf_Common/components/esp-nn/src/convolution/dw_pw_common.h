@@ -0,0 +1,162 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <esp_nn_defs.h>
+#include <common_functions.h>
+
+/**
+ * Strip driver for the fused depthwise + pointwise convolution.
+ *
+ * The depthwise stage computes `strip_ht` output rows from the input rows
+ * they need (top padding only on the first strip) into a strip buffer, the
+ * 1x1 stage turns them into output rows right away. Both stages are the
+ * regular kernels of the target, so every variant is bit exact with the
+ * unfused pair. Scratch layout, each part 16 byte aligned:
+ *
+ *   [strip buffer][depthwise scratch][pointwise scratch]
+ *
+ * The stages run on a context of their own that points into this buffer,
+ * so the global scratch pointers of the stage kernels are never touched.
+ */
+
+typedef int (*dw_pw_dw_size_fn_t)(const data_dims_t *, const data_dims_t *,
+                                  const data_dims_t *, const dw_conv_params_t *);
+typedef int (*dw_pw_pw_size_fn_t)(const data_dims_t *, const data_dims_t *,
+                                  const data_dims_t *, const conv_params_t *);
+typedef int (*dw_pw_dw_plan_fn_t)(dw_conv_plan_t *, const data_dims_t *, const data_dims_t *,
+                                  const data_dims_t *, const dw_conv_params_t *);
+typedef void (*dw_pw_dw_exec_fn_t)(const esp_nn_ctx_t *, const dw_conv_plan_t *,
+                                   const int8_t *, const int8_t *, const int32_t *,
+                                   int8_t *, const quant_data_t *);
+typedef int (*dw_pw_pw_plan_fn_t)(conv_plan_t *, const data_dims_t *, const data_dims_t *,
+                                  const data_dims_t *, const conv_params_t *);
+typedef void (*dw_pw_pw_exec_fn_t)(const esp_nn_ctx_t *, const conv_plan_t *,
+                                   const int8_t *, const int8_t *, const int32_t *,
+                                   int8_t *, const quant_data_t *);
+
+#define DW_PW_ALIGN(x)      (((x) + 15) & ~15)
+
+__NN_FORCE_INLINE__ int32_t esp_nn_dw_pw_strip_ht(const dw_pw_conv_params_t *params,
+                                                  const int32_t out_ht)
+{
+    return (params->strip_ht > 0 && params->strip_ht < out_ht) ? params->strip_ht : out_ht;
+}
+
+__NN_FORCE_INLINE__ int esp_nn_dw_pw_scratch_size(const data_dims_t *input_dims,
+                                                  const data_dims_t *dw_filter_dims,
+                                                  const data_dims_t *pw_filter_dims,
+                                                  const data_dims_t *output_dims,
+                                                  const dw_pw_conv_params_t *params,
+                                                  dw_pw_dw_size_fn_t dw_size,
+                                                  dw_pw_pw_size_fn_t pw_size)
+{
+    const int32_t strip_ht = esp_nn_dw_pw_strip_ht(params, output_dims->height);
+    const int32_t mid_ch = input_dims->channels * params->dw.ch_mult;
+    const int32_t slice_ht = min(input_dims->height,
+                                 (strip_ht - 1) * params->dw.stride.height + dw_filter_dims->height);
+
+    const data_dims_t slice_dims = {input_dims->width, slice_ht, input_dims->channels, 1};
+    const data_dims_t mid_dims = {output_dims->width, strip_ht, mid_ch, 1};
+    const data_dims_t out_dims = {output_dims->width, strip_ht, output_dims->channels, 1};
+
+    /* first strip keeps the top padding, the others have none: the kernel may pick another path */
+    dw_conv_params_t dw = params->dw;
+    int dw_bytes = dw_size(&slice_dims, dw_filter_dims, &mid_dims, &dw);
+    dw.padding.height = 0;
+    dw_bytes = max(dw_bytes, dw_size(&slice_dims, dw_filter_dims, &mid_dims, &dw));
+    const int pw_bytes = pw_size(&mid_dims, pw_filter_dims, &out_dims, &params->pw);
+
+    return DW_PW_ALIGN(output_dims->width * strip_ht * mid_ch) + DW_PW_ALIGN(dw_bytes) +
+           DW_PW_ALIGN(pw_bytes) + 16;
+}
+
+__NN_FORCE_INLINE__ void esp_nn_dw_pw_run(const esp_nn_ctx_t *ctx,
+                                          const data_dims_t *input_dims,
+                                          const int8_t *input_data,
+                                          const data_dims_t *dw_filter_dims,
+                                          const int8_t *dw_filter_data,
+                                          const int32_t *dw_bias,
+                                          const data_dims_t *pw_filter_dims,
+                                          const int8_t *pw_filter_data,
+                                          const int32_t *pw_bias,
+                                          const data_dims_t *output_dims,
+                                          int8_t *out_data,
+                                          const dw_pw_conv_params_t *params,
+                                          dw_pw_dw_plan_fn_t dw_plan_create,
+                                          dw_pw_dw_exec_fn_t dw_conv,
+                                          dw_pw_pw_plan_fn_t pw_plan_create,
+                                          dw_pw_pw_exec_fn_t pw_conv)
+{
+    const int32_t input_wd = input_dims->width;
+    const int32_t input_ht = input_dims->height;
+    const int32_t in_ch = input_dims->channels;
+    const int32_t out_wd = output_dims->width;
+    const int32_t out_ht = output_dims->height;
+    const int32_t out_ch = output_dims->channels;
+    const int32_t mid_ch = in_ch * params->dw.ch_mult;
+    const int32_t stride_ht = params->dw.stride.height;
+    const int32_t pad_ht = params->dw.padding.height;
+    const int32_t filter_ht = dw_filter_dims->height;
+    const int32_t strip_ht = esp_nn_dw_pw_strip_ht(params, out_ht);
+
+    void *scratch = ctx->dw_pw_scratch;
+    if (scratch == NULL) {
+        printf("esp_nn_dw_pw_conv error! scratch_buffer not set!\n");
+        return;
+    }
+
+    /* carve up scratch the same way esp_nn_dw_pw_scratch_size sized it */
+    const int32_t slice_max = min(input_ht, (strip_ht - 1) * stride_ht + filter_ht);
+    const data_dims_t slice_max_dims = {input_wd, slice_max, in_ch, 1};
+    const data_dims_t mid_max_dims = {out_wd, strip_ht, mid_ch, 1};
+    dw_conv_params_t dw = params->dw;
+    dw_conv_plan_t dw_plan;
+    conv_plan_t pw_plan;
+    int dw_bytes = dw_plan_create(&dw_plan, &slice_max_dims, dw_filter_dims, &mid_max_dims, &dw);
+    dw.padding.height = 0;
+    dw_bytes = max(dw_bytes, dw_plan_create(&dw_plan, &slice_max_dims, dw_filter_dims,
+                                            &mid_max_dims, &dw));
+
+    int8_t *strip = (int8_t *) DW_PW_ALIGN((uintptr_t) scratch);
+    int8_t *dw_scratch = strip + DW_PW_ALIGN(out_wd * strip_ht * mid_ch);
+    const esp_nn_ctx_t stage_ctx = {
+        .conv_scratch = dw_scratch + DW_PW_ALIGN(dw_bytes),
+        .depthwise_scratch = dw_scratch,
+    };
+
+    const int32_t in_row = input_wd * in_ch;
+    const int32_t out_row = out_wd * out_ch;
+    for (int32_t out_y = 0; out_y < out_ht; out_y += strip_ht) {
+        const int32_t rows = min(strip_ht, out_ht - out_y);
+        const int32_t top = out_y * stride_ht - pad_ht;
+        const int32_t in_start = max(0, top);
+        const int32_t in_end = min(input_ht, (out_y + rows - 1) * stride_ht - pad_ht + filter_ht);
+
+        const data_dims_t slice_dims = {input_wd, in_end - in_start, in_ch, 1};
+        const data_dims_t mid_dims = {out_wd, rows, mid_ch, 1};
+        const data_dims_t out_dims = {out_wd, rows, out_ch, 1};
+        dw.padding.height = in_start - top;
+
+        dw_plan_create(&dw_plan, &slice_dims, dw_filter_dims, &mid_dims, &dw);
+        pw_plan_create(&pw_plan, &mid_dims, pw_filter_dims, &out_dims, &params->pw);
+        dw_conv(&stage_ctx, &dw_plan, input_data + in_start * in_row, dw_filter_data, dw_bias,
+                strip, &params->dw_quant);
+        pw_conv(&stage_ctx, &pw_plan, strip, pw_filter_data, pw_bias,
+                out_data + out_y * out_row, &params->pw_quant);
+    }
+}
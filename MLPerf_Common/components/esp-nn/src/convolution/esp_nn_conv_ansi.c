@@ -13,8 +13,10 @@
 // limitations under the License.
 
 #include <esp_nn_defs.h>
+#include <esp_nn_ansi_headers.h>
 
 #include <common_functions.h>
+#include "conv_plan_common.h"
 
 int esp_nn_get_conv_scratch_size_ansi(const data_dims_t *input_dims,
                                       const data_dims_t *filter_dims,
@@ -177,3 +179,123 @@ void esp_nn_conv_s8_ansi(const data_dims_t *input_dims,
         }
     }
 }
+
+/**
+ * Reference for the fused conv + add: exactly the unfused sequence, with the
+ * add running in place on the convolution output.
+ */
+void esp_nn_conv_add_s8_ansi(const data_dims_t *input_dims,
+                             const int8_t *input_data,
+                             const data_dims_t *filter_dims,
+                             const int8_t *filter_data,
+                             const int32_t *bias,
+                             const int8_t *skip_data,
+                             const data_dims_t *output_dims,
+                             int8_t *out_data,
+                             const conv_params_t *conv_params,
+                             const quant_data_t *quant_data,
+                             const conv_add_params_t *add_params)
+{
+    esp_nn_conv_s8_ansi(input_dims, input_data, filter_dims, filter_data, bias,
+                        output_dims, out_data, conv_params, quant_data);
+    esp_nn_add_elementwise_s8_ansi(out_data, skip_data,
+                                   add_params->conv_offset, add_params->skip_offset,
+                                   add_params->conv_mult, add_params->skip_mult,
+                                   add_params->conv_shift, add_params->skip_shift,
+                                   add_params->left_shift, out_data,
+                                   add_params->out_offset, add_params->out_mult,
+                                   add_params->out_shift,
+                                   add_params->activation.min, add_params->activation.max,
+                                   output_dims->width * output_dims->height *
+                                   output_dims->channels);
+}
+
+/* the reference has a single variant, the plan only carries the geometry */
+int esp_nn_conv_plan_create_ansi(conv_plan_t *plan,
+                                 const data_dims_t *input_dims,
+                                 const data_dims_t *filter_dims,
+                                 const data_dims_t *output_dims,
+                                 const conv_params_t *conv_params)
+{
+    esp_nn_conv_plan_init(plan, input_dims, filter_dims, output_dims, conv_params);
+    plan->scratch_size = esp_nn_get_conv_scratch_size_ansi(input_dims, filter_dims,
+                                                           output_dims, conv_params);
+    return plan->scratch_size;
+}
+
+void esp_nn_conv_s8_execute_ansi(const conv_plan_t *plan,
+                                 const int8_t *input_data,
+                                 const int8_t *filter_data,
+                                 const int32_t *bias,
+                                 int8_t *out_data,
+                                 const quant_data_t *quant_data)
+{
+    esp_nn_conv_s8_ansi(&plan->input_dims, input_data, &plan->filter_dims, filter_data, bias,
+                        &plan->output_dims, out_data, &plan->params, quant_data);
+}
+
+/* the reference reads the OHWI filter, there is no packed layout to plan for */
+int esp_nn_get_conv_packed_filter_size_ansi(const conv_plan_t *plan)
+{
+    (void) plan;
+    return 0;
+}
+
+/* the reference needs no scratch, the context is only there for the common signature */
+void esp_nn_conv_s8_execute_ctx_ansi(const esp_nn_ctx_t *ctx,
+                                     const conv_plan_t *plan,
+                                     const int8_t *input_data,
+                                     const int8_t *filter_data,
+                                     const int32_t *bias,
+                                     int8_t *out_data,
+                                     const quant_data_t *quant_data)
+{
+    esp_nn_conv_s8_execute_ansi(plan, input_data, filter_data, bias, out_data, quant_data);
+}
+
+void esp_nn_conv_add_s8_execute_ctx_ansi(const esp_nn_ctx_t *ctx,
+                                         const conv_plan_t *plan,
+                                         const int8_t *input_data,
+                                         const int8_t *filter_data,
+                                         const int32_t *bias,
+                                         const int8_t *skip_data,
+                                         int8_t *out_data,
+                                         const quant_data_t *quant_data,
+                                         const conv_add_params_t *add_params)
+{
+    esp_nn_conv_add_s8_ansi(&plan->input_dims, input_data, &plan->filter_dims, filter_data,
+                            bias, skip_data, &plan->output_dims, out_data, &plan->params,
+                            quant_data, add_params);
+}
+
+void esp_nn_conv_s8_ctx_ansi(const esp_nn_ctx_t *ctx,
+                             const data_dims_t *input_dims,
+                             const int8_t *input_data,
+                             const data_dims_t *filter_dims,
+                             const int8_t *filter_data,
+                             const int32_t *bias,
+                             const data_dims_t *output_dims,
+                             int8_t *out_data,
+                             const conv_params_t *conv_params,
+                             const quant_data_t *quant_data)
+{
+    esp_nn_conv_s8_ansi(input_dims, input_data, filter_dims, filter_data, bias,
+                        output_dims, out_data, conv_params, quant_data);
+}
+
+void esp_nn_conv_add_s8_ctx_ansi(const esp_nn_ctx_t *ctx,
+                                 const data_dims_t *input_dims,
+                                 const int8_t *input_data,
+                                 const data_dims_t *filter_dims,
+                                 const int8_t *filter_data,
+                                 const int32_t *bias,
+                                 const int8_t *skip_data,
+                                 const data_dims_t *output_dims,
+                                 int8_t *out_data,
+                                 const conv_params_t *conv_params,
+                                 const quant_data_t *quant_data,
+                                 const conv_add_params_t *add_params)
+{
+    esp_nn_conv_add_s8_ansi(input_dims, input_data, filter_dims, filter_data, bias, skip_data,
+                            output_dims, out_data, conv_params, quant_data, add_params);
+}
@@ -51,8 +51,17 @@
 #include "esp_nn_generic_opt.h"
 
 #include <common_functions.h>
+#include "conv_plan_common.h"
 
-static int16_t *scratch_buffer = NULL;
+/* conv_plan_t.variant of this implementation */
+enum {
+    CONV_P4_1X1,
+    CONV_P4_PADDED,     /* no padding needed */
+    CONV_P4_OPT,        /* padded input: generic kernel */
+};
+
+/* context of the entry points without _ctx */
+static esp_nn_ctx_t global_ctx;
 
 __attribute__ ((noinline))
 static void esp_nn_conv_s8_1x1(const data_dims_t *input_dims,
@@ -413,7 +422,8 @@ int esp_nn_get_conv_scratch_size_esp32p4(const data_dims_t *input_dims,
     return align_buf_size;
 }
 
-void esp_nn_set_conv_scratch_buf_esp32p4(void *buf)
+/* the setting is per core: the _ctx path may run on a core that never saw the setter */
+static inline void esp_nn_conv_enable_vector_esp32p4(void)
 {
     // We are going to use the vector extensions
     asm volatile (
@@ -424,8 +434,102 @@ void esp_nn_set_conv_scratch_buf_esp32p4(void *buf)
         :
         : "x29"
     );
+}
+
+void esp_nn_set_conv_scratch_buf_esp32p4(void *buf)
+{
+    esp_nn_conv_enable_vector_esp32p4();
+    global_ctx.conv_scratch = buf;
+}
+
+static void esp_nn_conv_plan_select_esp32p4(conv_plan_t *plan)
+{
+    const uint16_t pad_wd = plan->params.padding.width;
+    const uint16_t pad_ht = plan->params.padding.height;
+
+    if (plan->filter_dims.width == 1 && plan->filter_dims.height == 1 &&
+            pad_wd == 0 && pad_ht == 0 &&
+            plan->params.stride.width == 1 && plan->params.stride.height == 1) {
+        plan->variant = CONV_P4_1X1;
+    } else if (pad_wd == 0 && pad_ht == 0) {
+        plan->variant = CONV_P4_PADDED;
+    } else {
+        plan->variant = CONV_P4_OPT;
+    }
+}
+
+int esp_nn_conv_plan_create_esp32p4(conv_plan_t *plan,
+                                    const data_dims_t *input_dims,
+                                    const data_dims_t *filter_dims,
+                                    const data_dims_t *output_dims,
+                                    const conv_params_t *conv_params)
+{
+    esp_nn_conv_plan_init(plan, input_dims, filter_dims, output_dims, conv_params);
+    esp_nn_conv_plan_select_esp32p4(plan);
+    plan->scratch_size = esp_nn_get_conv_scratch_size_esp32p4(input_dims, filter_dims,
+                                                              output_dims, conv_params);
+    return plan->scratch_size;
+}
+
+void esp_nn_conv_s8_execute_ctx_esp32p4(const esp_nn_ctx_t *ctx,
+                                        const conv_plan_t *plan,
+                                        const int8_t *input,
+                                        const int8_t *filter_data,
+                                        const int32_t *bias,
+                                        int8_t *out_data,
+                                        const quant_data_t *quant_data)
+{
+    void *scratch_buffer = ctx->conv_scratch;
+    if (scratch_buffer == NULL) {
+        printf("esp_nn_conv error! scratch_buffer not set!\n");
+        return;
+    }
+    esp_nn_conv_enable_vector_esp32p4();
+
+    switch (plan->variant) {
+    case CONV_P4_1X1:
+        esp_nn_conv_s8_1x1(&plan->input_dims, input, filter_data, bias,
+                           &plan->output_dims, out_data, &plan->params, quant_data,
+                           scratch_buffer);
+        break;
+    case CONV_P4_PADDED:
+        esp_nn_conv_s8_padded(&plan->input_dims, input, &plan->filter_dims, filter_data, bias,
+                              &plan->output_dims, out_data, &plan->params, quant_data,
+                              scratch_buffer);
+        break;
+    default:
+        esp_nn_conv_s8_opt(&plan->input_dims, input, &plan->filter_dims, filter_data, bias,
+                           &plan->output_dims, out_data, &plan->params, quant_data);
+        break;
+    }
+}
 
-    scratch_buffer = (int16_t *) buf;
+void esp_nn_conv_s8_execute_esp32p4(const conv_plan_t *plan,
+                                    const int8_t *input,
+                                    const int8_t *filter_data,
+                                    const int32_t *bias,
+                                    int8_t *out_data,
+                                    const quant_data_t *quant_data)
+{
+    esp_nn_conv_s8_execute_ctx_esp32p4(&global_ctx, plan, input, filter_data, bias, out_data,
+                                       quant_data);
+}
+
+void esp_nn_conv_s8_ctx_esp32p4(const esp_nn_ctx_t *ctx,
+                                const data_dims_t *input_dims,
+                                const int8_t *input,
+                                const data_dims_t *filter_dims,
+                                const int8_t *filter_data,
+                                const int32_t *bias,
+                                const data_dims_t *output_dims,
+                                int8_t *out_data,
+                                const conv_params_t *conv_params,
+                                const quant_data_t *quant_data)
+{
+    conv_plan_t plan;
+    esp_nn_conv_plan_init(&plan, input_dims, filter_dims, output_dims, conv_params);
+    esp_nn_conv_plan_select_esp32p4(&plan);
+    esp_nn_conv_s8_execute_ctx_esp32p4(ctx, &plan, input, filter_data, bias, out_data, quant_data);
 }
 
 void esp_nn_conv_s8_esp32p4(const data_dims_t *input_dims,
@@ -438,29 +542,71 @@ void esp_nn_conv_s8_esp32p4(const data_dims_t *input_dims,
                             const conv_params_t *conv_params,
                             const quant_data_t *quant_data)
 {
-    if (scratch_buffer == NULL) {
-        printf("esp_nn_conv error! scratch_buffer not set!\n");
-        return;
-    }
+    esp_nn_conv_s8_ctx_esp32p4(&global_ctx, input_dims, input, filter_dims, filter_data, bias,
+                               output_dims, out_data, conv_params, quant_data);
+}
 
-    const uint16_t filter_wd = filter_dims->width;
-    const uint16_t filter_ht = filter_dims->height;
-    const uint16_t pad_wd = conv_params->padding.width;
-    const uint16_t pad_ht = conv_params->padding.height;
-    const uint16_t stride_wd = conv_params->stride.width;
-    const uint16_t stride_ht = conv_params->stride.height;
+void esp_nn_conv_add_s8_execute_ctx_esp32p4(const esp_nn_ctx_t *ctx,
+                                            const conv_plan_t *plan,
+                                            const int8_t *input,
+                                            const int8_t *filter_data,
+                                            const int32_t *bias,
+                                            const int8_t *skip_data,
+                                            int8_t *out_data,
+                                            const quant_data_t *quant_data,
+                                            const conv_add_params_t *add_params)
+{
+    /* Not fused: the optimized conv kernels have no epilogue to hook the add
+     * into, so the add runs in place over the finished conv output. Same
+     * result and memory traffic as conv followed by add, ESP_NN_CONV_ADD_FUSED
+     * is 0 on this target. */
+    esp_nn_conv_s8_execute_ctx_esp32p4(ctx, plan, input, filter_data, bias, out_data,
+                                       quant_data);
+    esp_nn_add_elementwise_s8_ansi(out_data, skip_data,
+                                   add_params->conv_offset, add_params->skip_offset,
+                                   add_params->conv_mult, add_params->skip_mult,
+                                   add_params->conv_shift, add_params->skip_shift,
+                                   add_params->left_shift, out_data,
+                                   add_params->out_offset, add_params->out_mult,
+                                   add_params->out_shift,
+                                   add_params->activation.min, add_params->activation.max,
+                                   plan->output_dims.width * plan->output_dims.height *
+                                   plan->output_dims.channels);
+}
 
-    if (filter_wd == 1 && filter_ht == 1 && pad_wd == 0 && pad_ht == 0 &&
-            stride_wd == 1 && stride_ht == 1) {
-        esp_nn_conv_s8_1x1(input_dims, input, filter_data, bias,
-                           output_dims, out_data, conv_params, quant_data,
-                           scratch_buffer);
-    } else if (pad_wd == 0 && pad_ht == 0) {
-        esp_nn_conv_s8_padded(input_dims, input, filter_dims, filter_data, bias,
-                              output_dims, out_data, conv_params, quant_data,
-                              scratch_buffer);
-    } else {
-        esp_nn_conv_s8_opt(input_dims, input, filter_dims, filter_data, bias,
-                           output_dims, out_data, conv_params, quant_data);
-    }
+void esp_nn_conv_add_s8_ctx_esp32p4(const esp_nn_ctx_t *ctx,
+                                    const data_dims_t *input_dims,
+                                    const int8_t *input,
+                                    const data_dims_t *filter_dims,
+                                    const int8_t *filter_data,
+                                    const int32_t *bias,
+                                    const int8_t *skip_data,
+                                    const data_dims_t *output_dims,
+                                    int8_t *out_data,
+                                    const conv_params_t *conv_params,
+                                    const quant_data_t *quant_data,
+                                    const conv_add_params_t *add_params)
+{
+    conv_plan_t plan;
+    esp_nn_conv_plan_init(&plan, input_dims, filter_dims, output_dims, conv_params);
+    esp_nn_conv_plan_select_esp32p4(&plan);
+    esp_nn_conv_add_s8_execute_ctx_esp32p4(ctx, &plan, input, filter_data, bias, skip_data,
+                                           out_data, quant_data, add_params);
+}
+
+void esp_nn_conv_add_s8_esp32p4(const data_dims_t *input_dims,
+                                const int8_t *input,
+                                const data_dims_t *filter_dims,
+                                const int8_t *filter_data,
+                                const int32_t *bias,
+                                const int8_t *skip_data,
+                                const data_dims_t *output_dims,
+                                int8_t *out_data,
+                                const conv_params_t *conv_params,
+                                const quant_data_t *quant_data,
+                                const conv_add_params_t *add_params)
+{
+    esp_nn_conv_add_s8_ctx_esp32p4(&global_ctx, input_dims, input, filter_dims, filter_data,
+                                   bias, skip_data, output_dims, out_data, conv_params,
+                                   quant_data, add_params);
 }
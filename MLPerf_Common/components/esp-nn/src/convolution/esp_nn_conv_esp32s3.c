@@ -50,8 +50,34 @@
 #include <esp_nn_defs.h>
 
 #include <common_functions.h>
+#include "conv_plan_common.h"
 
-static int16_t *scratch_buffer = NULL;
+/* conv_plan_t.variant of this implementation */
+enum {
+    CONV_S3_MULT8_1X1,      /* k[0]: channels padded to a multiple of 8 */
+    CONV_S3_FILTER_ALIGNED, /* k[0]: filter row padded to 16 bytes, 0 if already aligned,
+                               k[1], k[2]: padded input width, height */
+};
+
+/* context of the entry points without _ctx */
+static esp_nn_ctx_t global_ctx;
+
+extern void esp_nn_add_elementwise_s8_esp32s3(const int8_t *input1_data,
+                                              const int8_t *input2_data,
+                                              const int32_t input1_offset,
+                                              const int32_t input2_offset,
+                                              const int32_t input1_mult,
+                                              const int32_t input2_mult,
+                                              const int32_t input1_shift,
+                                              const int32_t input2_shift,
+                                              const int32_t left_shift,
+                                              int8_t *output,
+                                              const int32_t out_offset,
+                                              const int32_t out_mult,
+                                              const int32_t out_shift,
+                                              const int32_t activation_min,
+                                              const int32_t activation_max,
+                                              const int32_t size);
 
 extern void esp_nn_conv_s8_mult8_1x1_esp32s3(
                 const int8_t *input_data,
@@ -146,52 +172,87 @@ int esp_nn_get_conv_scratch_size_esp32s3(const data_dims_t *input_dims,
 
 void esp_nn_set_conv_scratch_buf_esp32s3(void *buf)
 {
-    scratch_buffer = (int16_t *) buf;
+    global_ctx.conv_scratch = buf;
 }
 
-void esp_nn_conv_s8_esp32s3(const data_dims_t *input_dims,
-                            const int8_t *input,
-                            const data_dims_t *filter_dims,
-                            const int8_t *filter_data,
-                            const int32_t *bias,
-                            const data_dims_t *output_dims,
-                            int8_t *out_data,
-                            const conv_params_t *conv_params,
-                            const quant_data_t *quant_data)
+/* variant and derived sizes; all of it depends on the geometry only */
+static void esp_nn_conv_plan_select_esp32s3(conv_plan_t *plan)
+{
+    const uint16_t channels = plan->input_dims.channels;
+    const uint16_t pad_wd = plan->params.padding.width;
+    const uint16_t pad_ht = plan->params.padding.height;
+    const uint16_t filter_wd = plan->filter_dims.width;
+    const uint16_t filter_ht = plan->filter_dims.height;
+
+    if (filter_wd == 1 && filter_ht == 1 && pad_wd == 0 && pad_ht == 0 &&
+            plan->params.stride.width == 1 && plan->params.stride.height == 1) {
+        plan->variant = CONV_S3_MULT8_1X1;
+        plan->k[0] = (channels + 7) & ~7;
+    } else {
+        // align the `filter width * channels` to 16 bytes. Do zero padding for the same
+        const int32_t filter_row_size = filter_wd * channels;
+        const int32_t filter_alignment_padding = 16 - (filter_row_size & 15);
+        plan->variant = CONV_S3_FILTER_ALIGNED;
+        plan->k[0] = filter_alignment_padding != 16 ? filter_row_size + filter_alignment_padding : 0;
+        plan->k[1] = plan->input_dims.width + 2 * pad_wd;
+        plan->k[2] = plan->input_dims.height + 2 * pad_ht;
+    }
+}
+
+int esp_nn_conv_plan_create_esp32s3(conv_plan_t *plan,
+                                    const data_dims_t *input_dims,
+                                    const data_dims_t *filter_dims,
+                                    const data_dims_t *output_dims,
+                                    const conv_params_t *conv_params)
 {
+    esp_nn_conv_plan_init(plan, input_dims, filter_dims, output_dims, conv_params);
+    esp_nn_conv_plan_select_esp32s3(plan);
+    plan->scratch_size = esp_nn_get_conv_scratch_size_esp32s3(input_dims, filter_dims,
+                                                              output_dims, conv_params);
+    return plan->scratch_size;
+}
+
+void esp_nn_conv_s8_execute_ctx_esp32s3(const esp_nn_ctx_t *ctx,
+                                        const conv_plan_t *plan,
+                                        const int8_t *input,
+                                        const int8_t *filter_data,
+                                        const int32_t *bias,
+                                        int8_t *out_data,
+                                        const quant_data_t *quant_data)
+{
+    int16_t *scratch_buffer = (int16_t *) ctx->conv_scratch;
     if (scratch_buffer == NULL) {
         printf("esp_nn_conv error! scratch_buffer not set!\n");
         return;
     }
-    const uint16_t input_wd = input_dims->width;
-    const uint16_t input_ht = input_dims->height;
-    const uint16_t channels = input_dims->channels;
-    const int32_t input_offset = conv_params->in_offset;
-    const int32_t out_offset = conv_params->out_offset;
-    const uint16_t pad_wd = conv_params->padding.width;
-    const uint16_t pad_ht = conv_params->padding.height;
-    const uint16_t stride_wd = conv_params->stride.width;
-    const uint16_t stride_ht = conv_params->stride.height;
-    const uint16_t filter_wd = filter_dims->width;
-    const uint16_t filter_ht = filter_dims->height;
-    const uint16_t out_wd = output_dims->width;
-    const uint16_t out_ht = output_dims->height;
-    const uint16_t out_channels = output_dims->channels;
+    const uint16_t input_wd = plan->input_dims.width;
+    const uint16_t input_ht = plan->input_dims.height;
+    const uint16_t channels = plan->input_dims.channels;
+    const int32_t input_offset = plan->params.in_offset;
+    const int32_t out_offset = plan->params.out_offset;
+    const uint16_t pad_wd = plan->params.padding.width;
+    const uint16_t pad_ht = plan->params.padding.height;
+    const uint16_t stride_wd = plan->params.stride.width;
+    const uint16_t stride_ht = plan->params.stride.height;
+    const uint16_t filter_wd = plan->filter_dims.width;
+    const uint16_t filter_ht = plan->filter_dims.height;
+    const uint16_t out_wd = plan->output_dims.width;
+    const uint16_t out_ht = plan->output_dims.height;
+    const uint16_t out_channels = plan->output_dims.channels;
     const int32_t *out_shift = quant_data->shift;
     const int32_t *out_mult = quant_data->mult;
-    const int32_t activation_min = conv_params->activation.min;
-    const int32_t activation_max = conv_params->activation.max;
+    const int32_t activation_min = plan->params.activation.min;
+    const int32_t activation_max = plan->params.activation.max;
 
     int filter_size = filter_wd * filter_ht * channels * out_channels;
 
-    if (filter_wd == 1 && filter_ht == 1 && pad_wd == 0 && pad_ht == 0 &&
-            stride_wd == 1 && stride_ht == 1) {
+    if (plan->variant == CONV_S3_MULT8_1X1) {
 
         int8_t *input_aligned = (int8_t *) input;
         int8_t *scratch_buf = (int8_t *) scratch_buffer;
         int8_t *filter_aligned = (int8_t *) scratch_buffer;
-        int new_channels = channels;
-        if (channels % 8 == 0) {
+        const int new_channels = plan->k[0];
+        if (new_channels == channels) {
             if ((int) filter_data & 7) { // if the filter_data is not aligned to 8 bytes
                 int scratch_offset = (int) (filter_aligned + filter_size);
                 scratch_buf = (int8_t *) (scratch_offset + 16 - (scratch_offset & 15));
@@ -201,7 +262,6 @@ void esp_nn_conv_s8_esp32s3(const data_dims_t *input_dims,
             }
         } else {
             // pad extra channel to make it multiple of 8. Both input and filter
-            new_channels = (channels + 7) & ~7;
             for (int out_ch_idx = 0; out_ch_idx < out_channels; out_ch_idx++) {
                 memcpy(filter_aligned, filter_data, channels);
                 memset(filter_aligned + channels, 0, new_channels - channels);
@@ -225,16 +285,14 @@ void esp_nn_conv_s8_esp32s3(const data_dims_t *input_dims,
             filter_aligned, bias, out_data, out_wd, out_ht, out_channels, out_offset,
             out_shift, out_mult, activation_min, activation_max, scratch_buf);
     } else {
-        // align the `filter width * channels` to 16 bytes. Do zero padding for the same
         int32_t filter_row_size = filter_wd * channels;
-        int32_t filter_alignment_padding = 16 - (filter_row_size & 15);
         int8_t *filter_data_aligned = (int8_t *) filter_data;
         int8_t *input_padded = (int8_t *) input;
         int8_t *scratch_data = (int8_t *) scratch_buffer;
         int new_input_wd = input_wd, new_input_ht = input_ht;
-        if (filter_alignment_padding != 16) {
+        if (plan->k[0] != 0) {
             // pad filter_data
-            int32_t new_row_size = filter_wd * channels + filter_alignment_padding;
+            int32_t new_row_size = plan->k[0];
             filter_data_aligned = scratch_data;
             int8_t *row_ptr = filter_data_aligned;
             for (int32_t ch_idx = 0; ch_idx < out_channels; ch_idx++) {
@@ -256,8 +314,8 @@ void esp_nn_conv_s8_esp32s3(const data_dims_t *input_dims,
             input_padded = (int8_t *) scratch_data;
             esp_nn_aligned_s8_pad_with_value(input, input_padded, input_wd, input_ht, channels,
                                             -input_offset, pad_wd, pad_ht);
-            new_input_wd = input_wd + 2 * pad_wd;
-            new_input_ht = input_ht + 2 * pad_ht;
+            new_input_wd = plan->k[1];
+            new_input_ht = plan->k[2];
             scratch_data += new_input_wd * new_input_ht * channels;
         }
         esp_nn_conv_s8_filter_aligned_input_padded_esp32s3(
@@ -267,3 +325,110 @@ void esp_nn_conv_s8_esp32s3(const data_dims_t *input_dims,
             out_shift, out_mult, activation_min, activation_max, scratch_data);
     }
 }
+
+void esp_nn_conv_s8_execute_esp32s3(const conv_plan_t *plan,
+                                    const int8_t *input,
+                                    const int8_t *filter_data,
+                                    const int32_t *bias,
+                                    int8_t *out_data,
+                                    const quant_data_t *quant_data)
+{
+    esp_nn_conv_s8_execute_ctx_esp32s3(&global_ctx, plan, input, filter_data, bias, out_data,
+                                       quant_data);
+}
+
+void esp_nn_conv_s8_ctx_esp32s3(const esp_nn_ctx_t *ctx,
+                                const data_dims_t *input_dims,
+                                const int8_t *input,
+                                const data_dims_t *filter_dims,
+                                const int8_t *filter_data,
+                                const int32_t *bias,
+                                const data_dims_t *output_dims,
+                                int8_t *out_data,
+                                const conv_params_t *conv_params,
+                                const quant_data_t *quant_data)
+{
+    conv_plan_t plan;
+    esp_nn_conv_plan_init(&plan, input_dims, filter_dims, output_dims, conv_params);
+    esp_nn_conv_plan_select_esp32s3(&plan);
+    esp_nn_conv_s8_execute_ctx_esp32s3(ctx, &plan, input, filter_data, bias, out_data, quant_data);
+}
+
+void esp_nn_conv_s8_esp32s3(const data_dims_t *input_dims,
+                            const int8_t *input,
+                            const data_dims_t *filter_dims,
+                            const int8_t *filter_data,
+                            const int32_t *bias,
+                            const data_dims_t *output_dims,
+                            int8_t *out_data,
+                            const conv_params_t *conv_params,
+                            const quant_data_t *quant_data)
+{
+    esp_nn_conv_s8_ctx_esp32s3(&global_ctx, input_dims, input, filter_dims, filter_data, bias,
+                               output_dims, out_data, conv_params, quant_data);
+}
+
+void esp_nn_conv_add_s8_execute_ctx_esp32s3(const esp_nn_ctx_t *ctx,
+                                            const conv_plan_t *plan,
+                                            const int8_t *input,
+                                            const int8_t *filter_data,
+                                            const int32_t *bias,
+                                            const int8_t *skip_data,
+                                            int8_t *out_data,
+                                            const quant_data_t *quant_data,
+                                            const conv_add_params_t *add_params)
+{
+    /* Not fused: the optimized conv kernels have no epilogue to hook the add
+     * into, so the add runs in place over the finished conv output. Same
+     * result and memory traffic as conv followed by add, ESP_NN_CONV_ADD_FUSED
+     * is 0 on this target. */
+    esp_nn_conv_s8_execute_ctx_esp32s3(ctx, plan, input, filter_data, bias, out_data,
+                                       quant_data);
+    esp_nn_add_elementwise_s8_esp32s3(out_data, skip_data,
+                                      add_params->conv_offset, add_params->skip_offset,
+                                      add_params->conv_mult, add_params->skip_mult,
+                                      add_params->conv_shift, add_params->skip_shift,
+                                      add_params->left_shift, out_data,
+                                      add_params->out_offset, add_params->out_mult,
+                                      add_params->out_shift,
+                                      add_params->activation.min, add_params->activation.max,
+                                      plan->output_dims.width * plan->output_dims.height *
+                                      plan->output_dims.channels);
+}
+
+void esp_nn_conv_add_s8_ctx_esp32s3(const esp_nn_ctx_t *ctx,
+                                    const data_dims_t *input_dims,
+                                    const int8_t *input,
+                                    const data_dims_t *filter_dims,
+                                    const int8_t *filter_data,
+                                    const int32_t *bias,
+                                    const int8_t *skip_data,
+                                    const data_dims_t *output_dims,
+                                    int8_t *out_data,
+                                    const conv_params_t *conv_params,
+                                    const quant_data_t *quant_data,
+                                    const conv_add_params_t *add_params)
+{
+    conv_plan_t plan;
+    esp_nn_conv_plan_init(&plan, input_dims, filter_dims, output_dims, conv_params);
+    esp_nn_conv_plan_select_esp32s3(&plan);
+    esp_nn_conv_add_s8_execute_ctx_esp32s3(ctx, &plan, input, filter_data, bias, skip_data,
+                                           out_data, quant_data, add_params);
+}
+
+void esp_nn_conv_add_s8_esp32s3(const data_dims_t *input_dims,
+                                const int8_t *input,
+                                const data_dims_t *filter_dims,
+                                const int8_t *filter_data,
+                                const int32_t *bias,
+                                const int8_t *skip_data,
+                                const data_dims_t *output_dims,
+                                int8_t *out_data,
+                                const conv_params_t *conv_params,
+                                const quant_data_t *quant_data,
+                                const conv_add_params_t *add_params)
+{
+    esp_nn_conv_add_s8_ctx_esp32s3(&global_ctx, input_dims, input, filter_dims, filter_data,
+                                   bias, skip_data, output_dims, out_data, conv_params,
+                                   quant_data, add_params);
+}
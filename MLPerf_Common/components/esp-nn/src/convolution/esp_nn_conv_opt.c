@@ -0,0 +1,932 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdio.h>
+#include <esp_nn_defs.h>
+
+#include <common_functions.h>
+#include "conv_plan_common.h"
+
+/* filter heights up to this use the padded row cache of esp_nn_conv_s8_padded() */
+#define CONV_ROW_CACHE_MAX_HT   16
+
+/* conv_plan_t.variant of this implementation */
+enum {
+    CONV_OPT_1X1,
+    CONV_OPT_PADDED,    /* k[0]: width of a cached input row */
+    CONV_OPT_GENERIC,
+};
+
+/* context of the entry points without _ctx */
+static esp_nn_ctx_t global_ctx;
+
+/* width of a cached input row: left padding, input and what the last window needs on the right */
+static int32_t esp_nn_conv_padded_wd(const data_dims_t *input_dims,
+                                     const data_dims_t *filter_dims,
+                                     const data_dims_t *output_dims,
+                                     const conv_params_t *conv_params)
+{
+    const int32_t pad_wd = conv_params->padding.width;
+    const int32_t right = (output_dims->width - 1) * conv_params->stride.width +
+                          filter_dims->width - pad_wd - input_dims->width;
+    return pad_wd + input_dims->width + max(right, 0);
+}
+
+static bool esp_nn_conv_use_row_cache(const data_dims_t *filter_dims,
+                                      const conv_params_t *conv_params)
+{
+    return (filter_dims->width > 1 || filter_dims->height > 1) &&
+           filter_dims->height <= CONV_ROW_CACHE_MAX_HT &&
+           conv_params->dilation.width <= 1 && conv_params->dilation.height <= 1;
+}
+
+/**
+ * Scratch for the KxK path: per output channel bias with the input offset
+ * folded in, followed by `filter_ht` padded input rows.
+ */
+int esp_nn_get_conv_scratch_size_opt(const data_dims_t *input_dims,
+                                     const data_dims_t *filter_dims,
+                                     const data_dims_t *output_dims,
+                                     const conv_params_t *conv_params)
+{
+    if (!esp_nn_conv_use_row_cache(filter_dims, conv_params)) {
+        return 0;
+    }
+    const int32_t padded_wd = esp_nn_conv_padded_wd(input_dims, filter_dims,
+                                                    output_dims, conv_params);
+    return output_dims->channels * sizeof(int32_t) +
+           filter_dims->height * padded_wd * input_dims->channels + 4 /* alignment */;
+}
+
+void esp_nn_set_conv_scratch_buf_opt(const void *buf)
+{
+    global_ctx.conv_scratch = (void *) buf;
+}
+
+/**
+ * Epilogue of the fused conv + add: `out` holds the finished int8 conv
+ * results of one output pixel, the add is applied in place. Same arithmetic
+ * as esp_nn_add_elementwise_s8_ansi with the conv result as input1.
+ */
+static void esp_nn_conv_add_pixel(int8_t *out, const int8_t *skip, const int32_t channels,
+                                  const conv_add_params_t *add)
+{
+    /* locals: int8 stores may alias *add and would force a reload per element */
+    const int32_t conv_offset = add->conv_offset, skip_offset = add->skip_offset;
+    const int32_t conv_mult = add->conv_mult, skip_mult = add->skip_mult;
+    const int32_t conv_shift = add->conv_shift, skip_shift = add->skip_shift;
+    const int32_t left_shift = add->left_shift;
+    const int32_t out_offset = add->out_offset;
+    const int32_t out_mult = add->out_mult, out_shift = add->out_shift;
+    const int32_t activation_min = add->activation.min;
+    const int32_t activation_max = add->activation.max;
+
+    for (int32_t i = 0; i < channels; i++) {
+        int32_t tmp1 = (out[i] + conv_offset) << left_shift;
+        int32_t tmp2 = (skip[i] + skip_offset) << left_shift;
+
+        tmp1 = esp_nn_sat_round_doubling_high_mul(tmp1, conv_mult);
+        tmp2 = esp_nn_sat_round_doubling_high_mul(tmp2, skip_mult);
+
+        tmp1 = esp_nn_div_by_power_of_two(tmp1, -conv_shift);
+        tmp2 = esp_nn_div_by_power_of_two(tmp2, -skip_shift);
+
+        int32_t result = tmp1 + tmp2;
+        result = esp_nn_sat_round_doubling_high_mul(result, out_mult);
+        result = esp_nn_div_by_power_of_two(result, -out_shift);
+        result += out_offset;
+
+        result = max(activation_min, min(result, activation_max));
+        out[i] = (int8_t) result;
+    }
+}
+
+__attribute__ ((noinline))
+static void esp_nn_conv_s8_1x1(const data_dims_t *input_dims,
+                               const int8_t *input_data,
+                               const int8_t *filter_data,
+                               const int32_t *bias,
+                               const data_dims_t *output_dims,
+                               int8_t *out_data,
+                               const conv_params_t *conv_params,
+                               const quant_data_t *quant_data,
+                               const int8_t *skip_data,
+                               const conv_add_params_t *add_params)
+{
+    const uint16_t input_wd = input_dims->width;
+    const uint16_t in_channels = input_dims->channels;
+    const int32_t input_offset = conv_params->in_offset;
+    const int32_t out_offset = conv_params->out_offset;
+    const uint16_t stride_wd = conv_params->stride.width;
+    const uint16_t stride_ht = conv_params->stride.height;
+    const uint16_t out_wd = output_dims->width;
+    const uint16_t out_ht = output_dims->height;
+    const uint16_t out_channels = output_dims->channels;
+    const int32_t activation_min = conv_params->activation.min;
+    const int32_t activation_max = conv_params->activation.max;
+
+    for (int32_t in_row = 0; in_row < out_ht * stride_ht; in_row += stride_ht) {
+        for (int32_t in_col = 0; in_col < out_wd * stride_wd; in_col += stride_wd) {
+            const int32_t *out_mult = quant_data->mult;
+            const int32_t *out_shift = quant_data->shift;
+            const int8_t *filter_ptr = filter_data;
+            const int8_t *input_base_ptr = input_data + (in_row * input_wd + in_col) * in_channels;
+            int32_t out_ch_idx = 0;
+            for (; out_ch_idx < out_channels; out_ch_idx++) {
+                int32_t conv_out = 0;
+
+                const int8_t *input_ptr = input_base_ptr;
+
+                int32_t in_ch_idx = 0;
+                for (; in_ch_idx < in_channels - 3; in_ch_idx += 4) {
+                    conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
+                    conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
+                    conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
+                    conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
+                }
+                for (; in_ch_idx < in_channels; in_ch_idx ++) {
+                    conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
+                }
+                if (bias) {
+                    conv_out += bias[out_ch_idx];
+                }
+                conv_out = esp_nn_multiply_by_quantized_mult_fast(conv_out, *out_mult++, *out_shift++);
+                conv_out += out_offset;
+                conv_out = max(conv_out, activation_min);
+                conv_out = min(conv_out, activation_max);
+                *out_data++ = (int8_t) conv_out;
+            }
+            if (add_params) {
+                esp_nn_conv_add_pixel(out_data - out_channels, skip_data, out_channels, add_params);
+                skip_data += out_channels;
+            }
+        }
+    }
+}
+
+__NN_FORCE_INLINE__ int8_t esp_nn_conv_out(int32_t conv_out,
+                                            const int32_t out_mult, const int32_t out_shift,
+                                            const int32_t out_offset,
+                                            const int32_t activation_min,
+                                            const int32_t activation_max)
+{
+    conv_out = esp_nn_multiply_by_quantized_mult_fast(conv_out, out_mult, out_shift);
+    conv_out += out_offset;
+    conv_out = max(conv_out, activation_min);
+    conv_out = min(conv_out, activation_max);
+    return (int8_t) conv_out;
+}
+
+/**
+ * Brings input rows [base_y, base_y + filter_ht) into the row cache (ring
+ * slot of row y: (y + pad_ht) % filter_ht), points `row_ptr` at them and
+ * returns the new end of the cached rows. Rows outside the input and the
+ * left/right padding are filled with `pad_val`.
+ */
+__NN_FORCE_INLINE__ int32_t esp_nn_conv_cache_rows(int8_t *row_cache,
+                                                   const int8_t **row_ptr,
+                                                   const int32_t cached_end,
+                                                   const int32_t base_y,
+                                                   const int8_t *input_data,
+                                                   const int32_t input_ht,
+                                                   const int32_t in_row_len,
+                                                   const int32_t row_len,
+                                                   const int32_t pad_left,
+                                                   const int32_t pad_ht,
+                                                   const int32_t filter_ht,
+                                                   const int8_t pad_val)
+{
+    for (int32_t y = max(base_y, cached_end); y < base_y + filter_ht; y++) {
+        int8_t *dst = row_cache + ((y + pad_ht) % filter_ht) * row_len;
+        if (y < 0 || y >= input_ht) {
+            memset(dst, pad_val, row_len);
+            continue;
+        }
+        memset(dst, pad_val, pad_left);
+        memcpy(dst + pad_left, input_data + y * in_row_len, in_row_len);
+        memset(dst + pad_left + in_row_len, pad_val, row_len - pad_left - in_row_len);
+    }
+    for (int32_t filter_y_idx = 0; filter_y_idx < filter_ht; filter_y_idx++) {
+        row_ptr[filter_y_idx] = row_cache +
+                        ((base_y + filter_y_idx + pad_ht) % filter_ht) * row_len;
+    }
+    return base_y + filter_ht;
+}
+
+/**
+ * KxK convolution through a padded row cache.
+ *
+ * The scratch buffer holds `filter_ht` input rows, padded left and right with
+ * `-input_offset` and refilled as the window moves down. Rows above and below
+ * the input are all padding. Every window then lies completely inside the
+ * cache: one filter row is a contiguous run of `filter_wd * in_channels`
+ * bytes in both the cache and the filter, with no bounds checks. Padding
+ * contributes (-input_offset + input_offset) * filter = 0, so the offset can
+ * leave the inner loop as `input_offset * sum(filter)`, added to the bias once
+ * per output channel.
+ */
+__attribute__ ((noinline))
+static void esp_nn_conv_s8_padded(const data_dims_t *input_dims,
+                                  const int8_t *input_data,
+                                  const data_dims_t *filter_dims,
+                                  const int8_t *filter_data,
+                                  const int32_t *bias,
+                                  const data_dims_t *output_dims,
+                                  int8_t *out_data,
+                                  const conv_params_t *conv_params,
+                                  const quant_data_t *quant_data,
+                                  const int8_t *skip_data,
+                                  const conv_add_params_t *add_params,
+                                  const int32_t padded_wd,
+                                  void *scratch)
+{
+    const uint16_t input_wd = input_dims->width;
+    const uint16_t input_ht = input_dims->height;
+    const uint16_t in_channels = input_dims->channels;
+    const uint16_t filter_wd = filter_dims->width;
+    const uint16_t filter_ht = filter_dims->height;
+    const int32_t input_offset = conv_params->in_offset;
+    const int32_t out_offset = conv_params->out_offset;
+    const uint16_t pad_wd = conv_params->padding.width;
+    const uint16_t pad_ht = conv_params->padding.height;
+    const uint16_t stride_wd = conv_params->stride.width;
+    const uint16_t stride_ht = conv_params->stride.height;
+    const uint16_t out_wd = output_dims->width;
+    const uint16_t out_ht = output_dims->height;
+    const uint16_t out_channels = output_dims->channels;
+    const int32_t activation_min = conv_params->activation.min;
+    const int32_t activation_max = conv_params->activation.max;
+
+    const int32_t row_len = padded_wd * in_channels;
+    const int32_t in_row_len = input_wd * in_channels;
+    const int32_t pad_left = pad_wd * in_channels;
+    const int32_t win_len = filter_wd * in_channels;
+    const int32_t filter_size = filter_ht * win_len;
+    const int8_t pad_val = (int8_t) -input_offset;
+
+    int32_t *bias_eff = (int32_t *) (((uintptr_t) scratch + 3) & ~(uintptr_t) 3);
+    int8_t *row_cache = (int8_t *) (bias_eff + out_channels);
+    const int8_t *row_ptr[CONV_ROW_CACHE_MAX_HT];
+
+    const int8_t *filter_ptr = filter_data;
+    for (int32_t out_ch_idx = 0; out_ch_idx < out_channels; out_ch_idx++) {
+        int32_t filter_sum = 0;
+        for (int32_t i = 0; i < filter_size; i++) {
+            filter_sum += *filter_ptr++;
+        }
+        bias_eff[out_ch_idx] = (bias ? bias[out_ch_idx] : 0) + input_offset * filter_sum;
+    }
+
+    int32_t cached_end = -pad_ht; /* input rows below this are in the cache */
+    for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+        const int32_t base_y = out_y * stride_ht - pad_ht;
+
+        cached_end = esp_nn_conv_cache_rows(row_cache, row_ptr, cached_end, base_y, input_data,
+                                            input_ht, in_row_len, row_len, pad_left, pad_ht,
+                                            filter_ht, pad_val);
+
+        for (int32_t out_x = 0; out_x < out_wd; out_x++) {
+            const int32_t col = out_x * stride_wd * in_channels;
+            const int32_t *out_shift = quant_data->shift;
+            const int32_t *out_mult = quant_data->mult;
+            filter_ptr = filter_data;
+            int32_t out_ch_idx = 0;
+
+            /* four output channels share every load from the row cache */
+            for (; out_ch_idx < out_channels - 3; out_ch_idx += 4) {
+                int32_t acc0 = bias_eff[out_ch_idx + 0], acc1 = bias_eff[out_ch_idx + 1];
+                int32_t acc2 = bias_eff[out_ch_idx + 2], acc3 = bias_eff[out_ch_idx + 3];
+                const int8_t *filter0 = filter_ptr;
+                const int8_t *filter1 = filter0 + filter_size;
+                const int8_t *filter2 = filter1 + filter_size;
+                const int8_t *filter3 = filter2 + filter_size;
+                for (int32_t filter_y_idx = 0; filter_y_idx < filter_ht; filter_y_idx++) {
+                    const int8_t *input_ptr = row_ptr[filter_y_idx] + col;
+                    for (int32_t i = 0; i < win_len; i++) {
+                        const int32_t in = input_ptr[i];
+                        acc0 += in * filter0[i];
+                        acc1 += in * filter1[i];
+                        acc2 += in * filter2[i];
+                        acc3 += in * filter3[i];
+                    }
+                    filter0 += win_len;
+                    filter1 += win_len;
+                    filter2 += win_len;
+                    filter3 += win_len;
+                }
+                filter_ptr += 4 * filter_size;
+
+                out_data[0] = esp_nn_conv_out(acc0, out_mult[0], out_shift[0], out_offset,
+                                              activation_min, activation_max);
+                out_data[1] = esp_nn_conv_out(acc1, out_mult[1], out_shift[1], out_offset,
+                                              activation_min, activation_max);
+                out_data[2] = esp_nn_conv_out(acc2, out_mult[2], out_shift[2], out_offset,
+                                              activation_min, activation_max);
+                out_data[3] = esp_nn_conv_out(acc3, out_mult[3], out_shift[3], out_offset,
+                                              activation_min, activation_max);
+                out_data += 4;
+                out_mult += 4;
+                out_shift += 4;
+            }
+
+            for (; out_ch_idx < out_channels; out_ch_idx++) {
+                int32_t conv_out = bias_eff[out_ch_idx];
+                for (int32_t filter_y_idx = 0; filter_y_idx < filter_ht; filter_y_idx++) {
+                    const int8_t *input_ptr = row_ptr[filter_y_idx] + col;
+                    for (int32_t i = 0; i < win_len; i++) {
+                        conv_out += input_ptr[i] * filter_ptr[i];
+                    }
+                    filter_ptr += win_len;
+                }
+                *out_data++ = esp_nn_conv_out(conv_out, *out_mult++, *out_shift++, out_offset,
+                                              activation_min, activation_max);
+            }
+            if (add_params) {
+                esp_nn_conv_add_pixel(out_data - out_channels, skip_data, out_channels, add_params);
+                skip_data += out_channels;
+            }
+        }
+    }
+}
+
+__attribute__ ((noinline))
+static void esp_nn_conv_s8_generic(const data_dims_t *input_dims,
+                                   const int8_t *input_data,
+                                   const data_dims_t *filter_dims,
+                                   const int8_t *filter_data,
+                                   const int32_t *bias,
+                                   const data_dims_t *output_dims,
+                                   int8_t *out_data,
+                                   const conv_params_t *conv_params,
+                                   const quant_data_t *quant_data,
+                                   const int8_t *skip_data,
+                                   const conv_add_params_t *add_params)
+{
+    const uint16_t input_wd = input_dims->width;
+    const uint16_t input_ht = input_dims->height;
+    const uint16_t in_channels = input_dims->channels;
+    const int32_t input_offset = conv_params->in_offset;
+    const int32_t out_offset = conv_params->out_offset;
+    const uint16_t pad_wd = conv_params->padding.width;
+    const uint16_t pad_ht = conv_params->padding.height;
+    const uint16_t stride_wd = conv_params->stride.width;
+    const uint16_t stride_ht = conv_params->stride.height;
+    const uint16_t out_wd = output_dims->width;
+    const uint16_t out_ht = output_dims->height;
+    const uint16_t out_channels = output_dims->channels;
+    const int32_t activation_min = conv_params->activation.min;
+    const int32_t activation_max = conv_params->activation.max;
+    const uint16_t filter_wd = filter_dims->width;
+    const uint16_t filter_ht = filter_dims->height;
+
+    int32_t out_ch_idx, out_y, out_x, filter_y_idx, filter_x_idx;
+
+    for (out_y = 0; out_y < out_ht; out_y++) {
+        for (out_x = 0; out_x < out_wd; out_x++) {
+            const int32_t *out_shift = quant_data->shift;
+            const int32_t *out_mult = quant_data->mult;
+            for (out_ch_idx = 0; out_ch_idx < out_channels; out_ch_idx++) {
+                int32_t conv_out = 0;
+
+                const int32_t base_y = stride_ht * out_y - pad_ht;
+                const int32_t base_x = stride_wd * out_x - pad_wd;
+
+                const int32_t filter_y_start = max(0, -base_y);
+                const int32_t filter_x_start = max(0, -base_x);
+
+                const int32_t filter_y_end = min(filter_ht, input_ht - base_y);
+                const int32_t filter_x_end = min(filter_wd, input_wd - base_x);
+
+                for (filter_y_idx = filter_y_start; filter_y_idx < filter_y_end; filter_y_idx++) {
+                    for (filter_x_idx = filter_x_start; filter_x_idx < filter_x_end; filter_x_idx++) {
+                        const int32_t in_row = base_y + filter_y_idx;
+                        const int32_t in_col = base_x + filter_x_idx;
+
+                        const int8_t *input_ptr = input_data +
+                                        (in_row * input_wd + in_col) * in_channels;
+                        const int8_t *filter_ptr = filter_data +
+                                        out_ch_idx * in_channels * filter_ht * filter_wd +
+                                        (filter_y_idx * filter_wd + filter_x_idx) * in_channels;
+                        int32_t in_ch_idx = 0;
+                        for (; in_ch_idx < in_channels - 3; in_ch_idx += 4) {
+                            conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
+                            conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
+                            conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
+                            conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
+                        }
+                        for (; in_ch_idx < in_channels; in_ch_idx ++) {
+                            conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
+                        }
+                    }
+                }
+                if (bias) {
+                    conv_out += bias[out_ch_idx];
+                }
+                conv_out = esp_nn_multiply_by_quantized_mult_fast(conv_out, *out_mult++, *out_shift++);
+                conv_out += out_offset;
+                conv_out = max(conv_out, activation_min);
+                conv_out = min(conv_out, activation_max);
+                *out_data++ = (int8_t) conv_out;
+            }
+            if (add_params) {
+                esp_nn_conv_add_pixel(out_data - out_channels, skip_data, out_channels, add_params);
+                skip_data += out_channels;
+            }
+        }
+    }
+}
+
+/* picks the variant; everything but the scratch size, which the per call path doesn't need */
+static void esp_nn_conv_plan_select_opt(conv_plan_t *plan)
+{
+    if (plan->filter_dims.width == 1 && plan->filter_dims.height == 1) {
+        plan->variant = CONV_OPT_1X1;
+    } else if (esp_nn_conv_use_row_cache(&plan->filter_dims, &plan->params)) {
+        plan->variant = CONV_OPT_PADDED;
+        plan->k[0] = esp_nn_conv_padded_wd(&plan->input_dims, &plan->filter_dims,
+                                           &plan->output_dims, &plan->params);
+    } else {
+        plan->variant = CONV_OPT_GENERIC;
+    }
+}
+
+/* common path of the plan and per call entry points, add_params NULL: plain conv */
+static void esp_nn_conv_s8_opt_run(const esp_nn_ctx_t *ctx,
+                                   const conv_plan_t *plan,
+                                   const int8_t *input_data,
+                                   const int8_t *filter_data,
+                                   const int32_t *bias,
+                                   int8_t *out_data,
+                                   const quant_data_t *quant_data,
+                                   const int8_t *skip_data,
+                                   const conv_add_params_t *add_params)
+{
+    switch (plan->variant) {
+    case CONV_OPT_1X1:
+        esp_nn_conv_s8_1x1(&plan->input_dims, input_data, filter_data, bias,
+                           &plan->output_dims, out_data, &plan->params, quant_data,
+                           skip_data, add_params);
+        break;
+    case CONV_OPT_PADDED:
+        if (ctx->conv_scratch != NULL) {
+            esp_nn_conv_s8_padded(&plan->input_dims, input_data, &plan->filter_dims, filter_data,
+                                  bias, &plan->output_dims, out_data, &plan->params, quant_data,
+                                  skip_data, add_params, plan->k[0], ctx->conv_scratch);
+            break;
+        }
+        /* no scratch buffer set, take the generic path */
+        /* fall through */
+    default:
+        esp_nn_conv_s8_generic(&plan->input_dims, input_data, &plan->filter_dims, filter_data,
+                               bias, &plan->output_dims, out_data, &plan->params, quant_data,
+                               skip_data, add_params);
+        break;
+    }
+}
+
+int esp_nn_conv_plan_create_opt(conv_plan_t *plan,
+                                const data_dims_t *input_dims,
+                                const data_dims_t *filter_dims,
+                                const data_dims_t *output_dims,
+                                const conv_params_t *conv_params)
+{
+    esp_nn_conv_plan_init(plan, input_dims, filter_dims, output_dims, conv_params);
+    esp_nn_conv_plan_select_opt(plan);
+    plan->scratch_size = esp_nn_get_conv_scratch_size_opt(input_dims, filter_dims,
+                                                          output_dims, conv_params);
+    return plan->scratch_size;
+}
+
+void esp_nn_conv_s8_execute_ctx_opt(const esp_nn_ctx_t *ctx,
+                                    const conv_plan_t *plan,
+                                    const int8_t *input_data,
+                                    const int8_t *filter_data,
+                                    const int32_t *bias,
+                                    int8_t *out_data,
+                                    const quant_data_t *quant_data)
+{
+    esp_nn_conv_s8_opt_run(ctx, plan, input_data, filter_data, bias, out_data, quant_data,
+                           NULL, NULL);
+}
+
+void esp_nn_conv_add_s8_execute_ctx_opt(const esp_nn_ctx_t *ctx,
+                                        const conv_plan_t *plan,
+                                        const int8_t *input_data,
+                                        const int8_t *filter_data,
+                                        const int32_t *bias,
+                                        const int8_t *skip_data,
+                                        int8_t *out_data,
+                                        const quant_data_t *quant_data,
+                                        const conv_add_params_t *add_params)
+{
+    esp_nn_conv_s8_opt_run(ctx, plan, input_data, filter_data, bias, out_data, quant_data,
+                           skip_data, add_params);
+}
+
+void esp_nn_conv_s8_execute_opt(const conv_plan_t *plan,
+                                const int8_t *input_data,
+                                const int8_t *filter_data,
+                                const int32_t *bias,
+                                int8_t *out_data,
+                                const quant_data_t *quant_data)
+{
+    esp_nn_conv_s8_opt_run(&global_ctx, plan, input_data, filter_data, bias, out_data, quant_data,
+                           NULL, NULL);
+}
+
+/**
+ * Assumption 1: i/p channels == o/p channels
+ * Assumption 2: Pointers are valid
+ * Assumption 3: dialation width = 1
+ */
+void esp_nn_conv_s8_ctx_opt(const esp_nn_ctx_t *ctx,
+                            const data_dims_t *input_dims,
+                            const int8_t *input_data,
+                            const data_dims_t *filter_dims,
+                            const int8_t *filter_data,
+                            const int32_t *bias,
+                            const data_dims_t *output_dims,
+                            int8_t *out_data,
+                            const conv_params_t *conv_params,
+                            const quant_data_t *quant_data)
+{
+    conv_plan_t plan;
+    esp_nn_conv_plan_init(&plan, input_dims, filter_dims, output_dims, conv_params);
+    esp_nn_conv_plan_select_opt(&plan);
+    esp_nn_conv_s8_opt_run(ctx, &plan, input_data, filter_data, bias, out_data, quant_data,
+                           NULL, NULL);
+}
+
+void esp_nn_conv_s8_opt(const data_dims_t *input_dims,
+                        const int8_t *input_data,
+                        const data_dims_t *filter_dims,
+                        const int8_t *filter_data,
+                        const int32_t *bias,
+                        const data_dims_t *output_dims,
+                        int8_t *out_data,
+                        const conv_params_t *conv_params,
+                        const quant_data_t *quant_data)
+{
+    esp_nn_conv_s8_ctx_opt(&global_ctx, input_dims, input_data, filter_dims, filter_data, bias,
+                           output_dims, out_data, conv_params, quant_data);
+}
+
+void esp_nn_conv_add_s8_ctx_opt(const esp_nn_ctx_t *ctx,
+                                const data_dims_t *input_dims,
+                                const int8_t *input_data,
+                                const data_dims_t *filter_dims,
+                                const int8_t *filter_data,
+                                const int32_t *bias,
+                                const int8_t *skip_data,
+                                const data_dims_t *output_dims,
+                                int8_t *out_data,
+                                const conv_params_t *conv_params,
+                                const quant_data_t *quant_data,
+                                const conv_add_params_t *add_params)
+{
+    conv_plan_t plan;
+    esp_nn_conv_plan_init(&plan, input_dims, filter_dims, output_dims, conv_params);
+    esp_nn_conv_plan_select_opt(&plan);
+    esp_nn_conv_s8_opt_run(ctx, &plan, input_data, filter_data, bias, out_data, quant_data,
+                           skip_data, add_params);
+}
+
+void esp_nn_conv_add_s8_opt(const data_dims_t *input_dims,
+                            const int8_t *input_data,
+                            const data_dims_t *filter_dims,
+                            const int8_t *filter_data,
+                            const int32_t *bias,
+                            const int8_t *skip_data,
+                            const data_dims_t *output_dims,
+                            int8_t *out_data,
+                            const conv_params_t *conv_params,
+                            const quant_data_t *quant_data,
+                            const conv_add_params_t *add_params)
+{
+    esp_nn_conv_add_s8_ctx_opt(&global_ctx, input_dims, input_data, filter_dims, filter_data,
+                               bias, skip_data, output_dims, out_data, conv_params, quant_data,
+                               add_params);
+}
+
+/************************** pre-packed filters ******************************/
+
+/* output channels per packed block, interleaved per filter tap */
+#define CONV_PACK_BLOCK     4
+#define CONV_PACK_ALIGN(x)  (((x) + 15) & ~15)
+
+static bool esp_nn_conv_packed_1x1(const conv_plan_t *plan)
+{
+    return plan->filter_dims.width == 1 && plan->filter_dims.height == 1 &&
+           plan->params.padding.width == 0 && plan->params.padding.height == 0;
+}
+
+static bool esp_nn_conv_packed_supported(const conv_plan_t *plan)
+{
+    return esp_nn_conv_packed_1x1(plan) ||
+           (plan->filter_dims.height <= CONV_ROW_CACHE_MAX_HT &&
+            plan->params.dilation.width <= 1 && plan->params.dilation.height <= 1);
+}
+
+/* bytes of the bias header and of one block of CONV_PACK_BLOCK channels */
+static int32_t esp_nn_conv_pack_header_len(const conv_plan_t *plan)
+{
+    const int32_t blocks = (plan->output_dims.channels + CONV_PACK_BLOCK - 1) / CONV_PACK_BLOCK;
+    return CONV_PACK_ALIGN(blocks * CONV_PACK_BLOCK * (int32_t) sizeof(int32_t));
+}
+
+static int32_t esp_nn_conv_pack_block_len(const conv_plan_t *plan)
+{
+    const int32_t filter_size = plan->filter_dims.width * plan->filter_dims.height *
+                                plan->input_dims.channels;
+    return CONV_PACK_ALIGN(filter_size * CONV_PACK_BLOCK);
+}
+
+int esp_nn_get_conv_packed_filter_size_opt(const conv_plan_t *plan)
+{
+    if (!esp_nn_conv_packed_supported(plan)) {
+        return 0;
+    }
+    const int32_t blocks = (plan->output_dims.channels + CONV_PACK_BLOCK - 1) / CONV_PACK_BLOCK;
+    return esp_nn_conv_pack_header_len(plan) + blocks * esp_nn_conv_pack_block_len(plan);
+}
+
+void esp_nn_conv_pack_filter_opt(const conv_plan_t *plan,
+                                 const int8_t *filter_data,
+                                 const int32_t *bias,
+                                 void *packed)
+{
+    const int32_t out_channels = plan->output_dims.channels;
+    const int32_t filter_size = plan->filter_dims.width * plan->filter_dims.height *
+                                plan->input_dims.channels;
+    const int32_t block_len = esp_nn_conv_pack_block_len(plan);
+    int32_t *bias_eff = (int32_t *) packed;
+    int8_t *block = (int8_t *) packed + esp_nn_conv_pack_header_len(plan);
+
+    /* channels past out_channels and the alignment gaps stay zero */
+    memset(packed, 0, esp_nn_get_conv_packed_filter_size_opt(plan));
+    for (int32_t out_ch_idx = 0; out_ch_idx < out_channels; out_ch_idx++) {
+        const int8_t *filter_ptr = filter_data + out_ch_idx * filter_size;
+        int8_t *dst = block + (out_ch_idx / CONV_PACK_BLOCK) * block_len +
+                      out_ch_idx % CONV_PACK_BLOCK;
+        int32_t filter_sum = 0;
+        for (int32_t i = 0; i < filter_size; i++) {
+            filter_sum += filter_ptr[i];
+            dst[i * CONV_PACK_BLOCK] = filter_ptr[i];
+        }
+        bias_eff[out_ch_idx] = (bias ? bias[out_ch_idx] : 0) +
+                               plan->params.in_offset * filter_sum;
+    }
+}
+
+int esp_nn_get_conv_packed_scratch_size_opt(const conv_plan_t *plan)
+{
+    if (!esp_nn_conv_packed_supported(plan) || esp_nn_conv_packed_1x1(plan)) {
+        return 0;
+    }
+    const int32_t padded_wd = esp_nn_conv_padded_wd(&plan->input_dims, &plan->filter_dims,
+                                                    &plan->output_dims, &plan->params);
+    return plan->filter_dims.height * padded_wd * plan->input_dims.channels;
+}
+
+/* requantizes the accumulators of one block, `n` channels (the last block may be short) */
+__NN_FORCE_INLINE__ void esp_nn_conv_packed_store(const int32_t *acc, const int32_t n,
+                                                  const int32_t *out_mult,
+                                                  const int32_t *out_shift,
+                                                  const int32_t out_offset,
+                                                  const int32_t activation_min,
+                                                  const int32_t activation_max,
+                                                  int8_t *out_data)
+{
+    for (int32_t i = 0; i < n; i++) {
+        out_data[i] = esp_nn_conv_out(acc[i], out_mult[i], out_shift[i], out_offset,
+                                      activation_min, activation_max);
+    }
+}
+
+/**
+ * Output pixels from the packed filter, two at a time when `pixels` is 2:
+ * `rows` point at the `filter_ht` input runs of `win_len` bytes under the
+ * first window, the second window starts `next` bytes further. Every filter
+ * load then feeds 8 accumulators. The input offset is already in bias_eff.
+ */
+__NN_FORCE_INLINE__ void esp_nn_conv_packed_pixels(const int8_t *const *rows,
+                                                   const int32_t next,
+                                                   const int32_t pixels,
+                                                   const int32_t filter_ht,
+                                                   const int32_t win_len,
+                                                   const int32_t *bias_eff,
+                                                   const int8_t *block,
+                                                   const int32_t block_len,
+                                                   const int32_t out_channels,
+                                                   const quant_data_t *quant_data,
+                                                   const int32_t out_offset,
+                                                   const int32_t activation_min,
+                                                   const int32_t activation_max,
+                                                   int8_t *out_data)
+{
+    for (int32_t out_ch_idx = 0; out_ch_idx < out_channels; out_ch_idx += CONV_PACK_BLOCK) {
+        const int32_t n = min(CONV_PACK_BLOCK, out_channels - out_ch_idx);
+        const int32_t *out_mult = quant_data->mult + out_ch_idx;
+        const int32_t *out_shift = quant_data->shift + out_ch_idx;
+        int32_t acc[2 * CONV_PACK_BLOCK];
+        int32_t acc0 = bias_eff[out_ch_idx + 0], acc1 = bias_eff[out_ch_idx + 1];
+        int32_t acc2 = bias_eff[out_ch_idx + 2], acc3 = bias_eff[out_ch_idx + 3];
+        const int8_t *filter_ptr = block;
+        block += block_len;
+
+        if (pixels == 1) {
+            for (int32_t filter_y_idx = 0; filter_y_idx < filter_ht; filter_y_idx++) {
+                const int8_t *input_ptr = rows[filter_y_idx];
+                for (int32_t i = 0; i < win_len; i++) {
+                    const int32_t in = input_ptr[i];
+                    acc0 += in * filter_ptr[0];
+                    acc1 += in * filter_ptr[1];
+                    acc2 += in * filter_ptr[2];
+                    acc3 += in * filter_ptr[3];
+                    filter_ptr += CONV_PACK_BLOCK;
+                }
+            }
+            acc[0] = acc0, acc[1] = acc1, acc[2] = acc2, acc[3] = acc3;
+            esp_nn_conv_packed_store(acc, n, out_mult, out_shift, out_offset,
+                                     activation_min, activation_max, out_data + out_ch_idx);
+            continue;
+        }
+
+        int32_t acc4 = acc0, acc5 = acc1, acc6 = acc2, acc7 = acc3;
+        for (int32_t filter_y_idx = 0; filter_y_idx < filter_ht; filter_y_idx++) {
+            const int8_t *input_ptr = rows[filter_y_idx];
+            for (int32_t i = 0; i < win_len; i++) {
+                const int32_t in0 = input_ptr[i];
+                const int32_t in1 = input_ptr[i + next];
+                const int32_t f0 = filter_ptr[0], f1 = filter_ptr[1];
+                const int32_t f2 = filter_ptr[2], f3 = filter_ptr[3];
+                acc0 += in0 * f0;
+                acc1 += in0 * f1;
+                acc2 += in0 * f2;
+                acc3 += in0 * f3;
+                acc4 += in1 * f0;
+                acc5 += in1 * f1;
+                acc6 += in1 * f2;
+                acc7 += in1 * f3;
+                filter_ptr += CONV_PACK_BLOCK;
+            }
+        }
+        acc[0] = acc0, acc[1] = acc1, acc[2] = acc2, acc[3] = acc3;
+        acc[4] = acc4, acc[5] = acc5, acc[6] = acc6, acc[7] = acc7;
+        esp_nn_conv_packed_store(acc, n, out_mult, out_shift, out_offset,
+                                 activation_min, activation_max, out_data + out_ch_idx);
+        esp_nn_conv_packed_store(acc + CONV_PACK_BLOCK, n, out_mult, out_shift, out_offset,
+                                 activation_min, activation_max,
+                                 out_data + out_channels + out_ch_idx);
+    }
+}
+
+__attribute__ ((noinline))
+static void esp_nn_conv_s8_packed_run(const esp_nn_ctx_t *ctx,
+                                      const conv_plan_t *plan,
+                                      const int8_t *input_data,
+                                      const void *packed,
+                                      int8_t *out_data,
+                                      const quant_data_t *quant_data,
+                                      const int8_t *skip_data,
+                                      const conv_add_params_t *add_params)
+{
+    const int32_t input_wd = plan->input_dims.width;
+    const int32_t input_ht = plan->input_dims.height;
+    const int32_t in_channels = plan->input_dims.channels;
+    const int32_t filter_wd = plan->filter_dims.width;
+    const int32_t filter_ht = plan->filter_dims.height;
+    const int32_t pad_wd = plan->params.padding.width;
+    const int32_t pad_ht = plan->params.padding.height;
+    const int32_t stride_wd = plan->params.stride.width;
+    const int32_t stride_ht = plan->params.stride.height;
+    const int32_t out_wd = plan->output_dims.width;
+    const int32_t out_ht = plan->output_dims.height;
+    const int32_t out_channels = plan->output_dims.channels;
+    const int32_t out_offset = plan->params.out_offset;
+    const int32_t activation_min = plan->params.activation.min;
+    const int32_t activation_max = plan->params.activation.max;
+
+    const int32_t *bias_eff = (const int32_t *) packed;
+    const int8_t *block = (const int8_t *) packed + esp_nn_conv_pack_header_len(plan);
+    const int32_t block_len = esp_nn_conv_pack_block_len(plan);
+    const int32_t in_row_len = input_wd * in_channels;
+    const int32_t next = stride_wd * in_channels;   /* to the window of the next pixel */
+    const int8_t *row_ptr[CONV_ROW_CACHE_MAX_HT];
+
+    if (esp_nn_conv_packed_1x1(plan)) {
+        for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+            for (int32_t out_x = 0; out_x < out_wd; out_x += 2) {
+                const int32_t pixels = min(2, out_wd - out_x);
+                row_ptr[0] = input_data + out_y * stride_ht * in_row_len +
+                             out_x * stride_wd * in_channels;
+                esp_nn_conv_packed_pixels(row_ptr, next, pixels, 1, in_channels, bias_eff,
+                                          block, block_len, out_channels, quant_data,
+                                          out_offset, activation_min, activation_max, out_data);
+                for (int32_t p = 0; p < pixels; p++) {
+                    if (add_params) {
+                        esp_nn_conv_add_pixel(out_data, skip_data, out_channels, add_params);
+                        skip_data += out_channels;
+                    }
+                    out_data += out_channels;
+                }
+            }
+        }
+        return;
+    }
+
+    if (ctx->conv_scratch == NULL) {
+        printf("esp_nn_conv_s8_packed error! scratch_buffer not set!\n");
+        return;
+    }
+
+    /* same row cache as esp_nn_conv_s8_padded(), without the bias part */
+    const int32_t padded_wd = esp_nn_conv_padded_wd(&plan->input_dims, &plan->filter_dims,
+                                                    &plan->output_dims, &plan->params);
+    const int32_t row_len = padded_wd * in_channels;
+    const int32_t win_len = filter_wd * in_channels;
+    const int8_t pad_val = (int8_t) -plan->params.in_offset;
+    int8_t *row_cache = (int8_t *) ctx->conv_scratch;
+    const int8_t *window[CONV_ROW_CACHE_MAX_HT];
+
+    int32_t cached_end = -pad_ht;
+    for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+        const int32_t base_y = out_y * stride_ht - pad_ht;
+        cached_end = esp_nn_conv_cache_rows(row_cache, row_ptr, cached_end, base_y, input_data,
+                                            input_ht, in_row_len, row_len, pad_wd * in_channels,
+                                            pad_ht, filter_ht, pad_val);
+        for (int32_t out_x = 0; out_x < out_wd; out_x += 2) {
+            const int32_t pixels = min(2, out_wd - out_x);
+            const int32_t col = out_x * stride_wd * in_channels;
+            for (int32_t filter_y_idx = 0; filter_y_idx < filter_ht; filter_y_idx++) {
+                window[filter_y_idx] = row_ptr[filter_y_idx] + col;
+            }
+            esp_nn_conv_packed_pixels(window, next, pixels, filter_ht, win_len, bias_eff,
+                                      block, block_len, out_channels, quant_data,
+                                      out_offset, activation_min, activation_max, out_data);
+            for (int32_t p = 0; p < pixels; p++) {
+                if (add_params) {
+                    esp_nn_conv_add_pixel(out_data, skip_data, out_channels, add_params);
+                    skip_data += out_channels;
+                }
+                out_data += out_channels;
+            }
+        }
+    }
+}
+
+void esp_nn_conv_s8_packed_ctx_opt(const esp_nn_ctx_t *ctx,
+                                   const conv_plan_t *plan,
+                                   const int8_t *input_data,
+                                   const void *packed,
+                                   int8_t *out_data,
+                                   const quant_data_t *quant_data)
+{
+    esp_nn_conv_s8_packed_run(ctx, plan, input_data, packed, out_data, quant_data, NULL, NULL);
+}
+
+void esp_nn_conv_add_s8_packed_ctx_opt(const esp_nn_ctx_t *ctx,
+                                       const conv_plan_t *plan,
+                                       const int8_t *input_data,
+                                       const void *packed,
+                                       const int8_t *skip_data,
+                                       int8_t *out_data,
+                                       const quant_data_t *quant_data,
+                                       const conv_add_params_t *add_params)
+{
+    esp_nn_conv_s8_packed_run(ctx, plan, input_data, packed, out_data, quant_data,
+                              skip_data, add_params);
+}
+
+void esp_nn_conv_s8_packed_opt(const conv_plan_t *plan,
+                               const int8_t *input_data,
+                               const void *packed,
+                               int8_t *out_data,
+                               const quant_data_t *quant_data)
+{
+    esp_nn_conv_s8_packed_run(&global_ctx, plan, input_data, packed, out_data, quant_data,
+                              NULL, NULL);
+}
+
+void esp_nn_conv_add_s8_packed_opt(const conv_plan_t *plan,
+                                   const int8_t *input_data,
+                                   const void *packed,
+                                   const int8_t *skip_data,
+                                   int8_t *out_data,
+                                   const quant_data_t *quant_data,
+                                   const conv_add_params_t *add_params)
+{
+    esp_nn_conv_s8_packed_run(&global_ctx, plan, input_data, packed, out_data, quant_data,
+                              skip_data, add_params);
+}
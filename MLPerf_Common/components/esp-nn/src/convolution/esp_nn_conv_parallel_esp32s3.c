@@ -0,0 +1,55 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_nn_defs.h>
+#include "esp_nn_esp32s3.h"
+
+#include "conv_parallel_common.h"
+
+int esp_nn_get_conv_parallel_scratch_size_esp32s3(const esp_nn_pool_t *pool,
+                                                  const conv_plan_t *plan)
+{
+    return esp_nn_conv_par_scratch_size(pool, plan, esp_nn_conv_plan_create_esp32s3);
+}
+
+void esp_nn_conv_s8_parallel_esp32s3(const esp_nn_ctx_t *ctx,
+                                     const conv_plan_t *plan,
+                                     const int8_t *input_data,
+                                     const int8_t *filter_data,
+                                     const int32_t *bias,
+                                     int8_t *out_data,
+                                     const quant_data_t *quant_data)
+{
+    esp_nn_conv_par_run(ctx, plan, input_data, filter_data, bias, out_data, quant_data,
+                        esp_nn_conv_plan_create_esp32s3, esp_nn_conv_s8_execute_ctx_esp32s3);
+}
+
+int esp_nn_get_depthwise_conv_parallel_scratch_size_esp32s3(const esp_nn_pool_t *pool,
+                                                            const dw_conv_plan_t *plan)
+{
+    return esp_nn_dw_par_scratch_size(pool, plan, esp_nn_depthwise_conv_plan_create_esp32s3);
+}
+
+void esp_nn_depthwise_conv_s8_parallel_esp32s3(const esp_nn_ctx_t *ctx,
+                                               const dw_conv_plan_t *plan,
+                                               const int8_t *input_data,
+                                               const int8_t *filter_data,
+                                               const int32_t *bias,
+                                               int8_t *out_data,
+                                               const quant_data_t *quant_data)
+{
+    esp_nn_dw_par_run(ctx, plan, input_data, filter_data, bias, out_data, quant_data,
+                      esp_nn_depthwise_conv_plan_create_esp32s3,
+                      esp_nn_depthwise_conv_s8_execute_ctx_esp32s3);
+}
@@ -14,6 +14,7 @@
 
 #include <esp_nn_defs.h>
 #include <common_functions.h>
+#include "conv_plan_common.h"
 
 int esp_nn_get_depthwise_conv_scratch_size_ansi(const data_dims_t *input_dims,
                                                 const data_dims_t *filter_dims,
@@ -98,3 +99,53 @@ void esp_nn_depthwise_conv_s8_ansi(const data_dims_t *input_dims,
         }
     }
 }
+
+int esp_nn_depthwise_conv_plan_create_ansi(dw_conv_plan_t *plan,
+                                           const data_dims_t *input_dims,
+                                           const data_dims_t *filter_dims,
+                                           const data_dims_t *output_dims,
+                                           const dw_conv_params_t *conv_params)
+{
+    esp_nn_dw_conv_plan_init(plan, input_dims, filter_dims, output_dims, conv_params);
+    plan->scratch_size = esp_nn_get_depthwise_conv_scratch_size_ansi(input_dims, filter_dims,
+                                                                     output_dims, conv_params);
+    return plan->scratch_size;
+}
+
+void esp_nn_depthwise_conv_s8_execute_ansi(const dw_conv_plan_t *plan,
+                                           const int8_t *input_data,
+                                           const int8_t *filter_data,
+                                           const int32_t *bias,
+                                           int8_t *out_data,
+                                           const quant_data_t *quant_data)
+{
+    esp_nn_depthwise_conv_s8_ansi(&plan->input_dims, input_data, &plan->filter_dims, filter_data,
+                                  bias, &plan->output_dims, out_data, &plan->params, quant_data);
+}
+
+void esp_nn_depthwise_conv_s8_execute_ctx_ansi(const esp_nn_ctx_t *ctx,
+                                               const dw_conv_plan_t *plan,
+                                               const int8_t *input_data,
+                                               const int8_t *filter_data,
+                                               const int32_t *bias,
+                                               int8_t *out_data,
+                                               const quant_data_t *quant_data)
+{
+    esp_nn_depthwise_conv_s8_execute_ansi(plan, input_data, filter_data, bias, out_data,
+                                          quant_data);
+}
+
+void esp_nn_depthwise_conv_s8_ctx_ansi(const esp_nn_ctx_t *ctx,
+                                       const data_dims_t *input_dims,
+                                       const int8_t *input_data,
+                                       const data_dims_t *filter_dims,
+                                       const int8_t *filter_data,
+                                       const int32_t *bias,
+                                       const data_dims_t *output_dims,
+                                       int8_t *out_data,
+                                       const dw_conv_params_t *conv_params,
+                                       const quant_data_t *quant_data)
+{
+    esp_nn_depthwise_conv_s8_ansi(input_dims, input_data, filter_dims, filter_data, bias,
+                                  output_dims, out_data, conv_params, quant_data);
+}
@@ -14,6 +14,13 @@
 
 #include <esp_nn_defs.h>
 #include <common_functions.h>
+#include "conv_plan_common.h"
+
+/* dw_conv_plan_t.variant of this implementation */
+enum {
+    DW_CONV_OPT_CH_MULT_1,
+    DW_CONV_OPT_GENERIC,
+};
 
 int esp_nn_get_depthwise_conv_scratch_size_opt(const data_dims_t *input_dims,
                                                const data_dims_t *filter_dims,
@@ -289,3 +296,62 @@ void esp_nn_depthwise_conv_s8_opt(const data_dims_t *input_dims,
         }
     }
 }
+
+int esp_nn_depthwise_conv_plan_create_opt(dw_conv_plan_t *plan,
+                                          const data_dims_t *input_dims,
+                                          const data_dims_t *filter_dims,
+                                          const data_dims_t *output_dims,
+                                          const dw_conv_params_t *conv_params)
+{
+    esp_nn_dw_conv_plan_init(plan, input_dims, filter_dims, output_dims, conv_params);
+    plan->variant = conv_params->ch_mult == 1 ? DW_CONV_OPT_CH_MULT_1 : DW_CONV_OPT_GENERIC;
+    plan->scratch_size = esp_nn_get_depthwise_conv_scratch_size_opt(input_dims, filter_dims,
+                                                                    output_dims, conv_params);
+    return plan->scratch_size;
+}
+
+void esp_nn_depthwise_conv_s8_execute_opt(const dw_conv_plan_t *plan,
+                                          const int8_t *input_data,
+                                          const int8_t *filter_data,
+                                          const int32_t *bias,
+                                          int8_t *out_data,
+                                          const quant_data_t *quant_data)
+{
+    if (plan->variant == DW_CONV_OPT_CH_MULT_1) {
+        esp_nn_depthwise_conv_s8_ch_mult_1(&plan->input_dims, input_data, &plan->filter_dims,
+                                           filter_data, bias, &plan->output_dims, out_data,
+                                           &plan->params, quant_data);
+    } else {
+        esp_nn_depthwise_conv_s8_opt(&plan->input_dims, input_data, &plan->filter_dims,
+                                     filter_data, bias, &plan->output_dims, out_data,
+                                     &plan->params, quant_data);
+    }
+}
+
+void esp_nn_depthwise_conv_s8_execute_ctx_opt(const esp_nn_ctx_t *ctx,
+                                              const dw_conv_plan_t *plan,
+                                              const int8_t *input_data,
+                                              const int8_t *filter_data,
+                                              const int32_t *bias,
+                                              int8_t *out_data,
+                                              const quant_data_t *quant_data)
+{
+    esp_nn_depthwise_conv_s8_execute_opt(plan, input_data, filter_data, bias, out_data,
+                                         quant_data);
+}
+
+/* scratch size is 0, the context is only there for the common signature */
+void esp_nn_depthwise_conv_s8_ctx_opt(const esp_nn_ctx_t *ctx,
+                                      const data_dims_t *input_dims,
+                                      const int8_t *input_data,
+                                      const data_dims_t *filter_dims,
+                                      const int8_t *filter_data,
+                                      const int32_t *bias,
+                                      const data_dims_t *output_dims,
+                                      int8_t *out_data,
+                                      const dw_conv_params_t *conv_params,
+                                      const quant_data_t *quant_data)
+{
+    esp_nn_depthwise_conv_s8_opt(input_dims, input_data, filter_dims, filter_data, bias,
+                                 output_dims, out_data, conv_params, quant_data);
+}
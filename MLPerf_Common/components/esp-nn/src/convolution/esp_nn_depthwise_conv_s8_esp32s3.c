@@ -16,8 +16,22 @@
 #include <esp_nn_defs.h>
 
 #include <common_functions.h>
-
-static int16_t *scratch_buffer = NULL;
+#include "conv_plan_common.h"
+
+/* dw_conv_plan_t.variant of this implementation */
+enum {
+    DW_S3_MULT1_3X3_PADDED,     /* ch % 16, pad 1/1: padded copy in 8 bits */
+    DW_S3_MULT1_3X3_NO_PAD,     /* ch % 16, no pad: k[0], k[1] right/bottom padding */
+    DW_S3_S16_MULT1_3X3,
+    DW_S3_MULT1,
+    DW_S3_S16_MULT8_3X3,
+    DW_S3_S16_MULT8,
+    DW_S3_S16_MULT4,
+    DW_S3_UNROLLED,
+};
+
+/* context of the entry points without _ctx */
+static esp_nn_ctx_t global_ctx;
 
 extern void esp_nn_depthwise_conv_s16_mult8_3x3_esp32s3(const int16_t *input_data,
                                                         const uint16_t input_wd,
@@ -410,122 +424,167 @@ int esp_nn_get_depthwise_conv_scratch_size_esp32s3(const data_dims_t *input_dims
 
 void esp_nn_set_depthwise_conv_scratch_buf_esp32s3(void *buf)
 {
-    scratch_buffer = (int16_t *) buf;
+    global_ctx.depthwise_scratch = buf;
 }
 
-/**
- * Assumption 1: i/p channels == o/p channels
- * Assumption 2: Pointers are valid
- * Assumption 3: dialation width = 1
- */
+/* variant and derived sizes; all of it depends on the geometry only */
+static void esp_nn_depthwise_conv_plan_select_esp32s3(dw_conv_plan_t *plan)
+{
+    const uint16_t channels = plan->input_dims.channels;
+    const uint16_t pad_wd = plan->params.padding.width;
+    const uint16_t pad_ht = plan->params.padding.height;
+    const uint16_t filter_wd = plan->filter_dims.width;
+    const uint16_t filter_ht = plan->filter_dims.height;
+    const uint16_t ch_mult = plan->params.ch_mult;
+    const int is_3x3 = (filter_wd == 3) && (filter_ht == 3);
+
+    /* filter_size rounded up to the next 16 bytes boundary (+16 if aligned) */
+    const int filter_size = filter_wd * filter_ht * channels * ch_mult;
+    plan->k[2] = filter_size + 16 - (filter_size & 15);
 
+    if ((ch_mult == 1) && (channels % 8 == 0)) {
+        if (is_3x3 && (channels % 16 == 0) && (pad_wd == 1) && (pad_ht == 1)) {
+            plan->variant = DW_S3_MULT1_3X3_PADDED;
+        } else if (is_3x3 && (channels % 16 == 0) && (pad_wd == 0) && (pad_ht == 0)) {
+            // check if we need to pad additionally
+            plan->variant = DW_S3_MULT1_3X3_NO_PAD;
+            plan->k[0] = (plan->output_dims.width * plan->params.stride.width + filter_wd - 1) -
+                         plan->input_dims.width;
+            plan->k[1] = (plan->output_dims.height * plan->params.stride.height + filter_ht - 1) -
+                         plan->input_dims.height;
+        } else if (is_3x3) { /* (channels % 8) == 0 */
+            plan->variant = DW_S3_S16_MULT1_3X3;
+        } else { // all other ch_mult == 1, `channels % 8 == 0`
+            plan->variant = DW_S3_MULT1;
+        }
+    } else if (ch_mult % 8 == 0) {
+        plan->variant = is_3x3 ? DW_S3_S16_MULT8_3X3 : DW_S3_S16_MULT8;
+    } else if (ch_mult % 4 == 0) {
+        plan->variant = DW_S3_S16_MULT4;
+    } else {
+        plan->variant = DW_S3_UNROLLED;
+    }
+}
 
+int esp_nn_depthwise_conv_plan_create_esp32s3(dw_conv_plan_t *plan,
+                                              const data_dims_t *input_dims,
+                                              const data_dims_t *filter_dims,
+                                              const data_dims_t *output_dims,
+                                              const dw_conv_params_t *conv_params)
+{
+    esp_nn_dw_conv_plan_init(plan, input_dims, filter_dims, output_dims, conv_params);
+    esp_nn_depthwise_conv_plan_select_esp32s3(plan);
+    plan->scratch_size = esp_nn_get_depthwise_conv_scratch_size_esp32s3(input_dims, filter_dims,
+                                                                        output_dims, conv_params);
+    return plan->scratch_size;
+}
 
-void esp_nn_depthwise_conv_s8_esp32s3(const data_dims_t *input_dims,
-                                      const int8_t *input_data,
-                                      const data_dims_t *filter_dims,
-                                      const int8_t *filter_data,
-                                      const int32_t *bias,
-                                      const data_dims_t *output_dims,
-                                      int8_t *out_data,
-                                      const dw_conv_params_t *conv_params,
-                                      const quant_data_t *quant_data)
+void esp_nn_depthwise_conv_s8_execute_ctx_esp32s3(const esp_nn_ctx_t *ctx,
+                                                  const dw_conv_plan_t *plan,
+                                                  const int8_t *input_data,
+                                                  const int8_t *filter_data,
+                                                  const int32_t *bias,
+                                                  int8_t *out_data,
+                                                  const quant_data_t *quant_data)
 {
-    const uint16_t input_wd = input_dims->width;
-    const uint16_t input_ht = input_dims->height;
-    const uint16_t channels = input_dims->channels;
-    const int32_t input_offset = conv_params->in_offset;
-    const int32_t out_offset = conv_params->out_offset;
-    const uint16_t pad_wd = conv_params->padding.width;
-    const uint16_t pad_ht = conv_params->padding.height;
-    const uint16_t stride_wd = conv_params->stride.width;
-    const uint16_t stride_ht = conv_params->stride.height;
-    const uint16_t filter_wd = filter_dims->width;
-    const uint16_t filter_ht = filter_dims->height;
-    const uint16_t out_wd = output_dims->width;
-    const uint16_t out_ht = output_dims->height;
+    int16_t *scratch_buffer = (int16_t *) ctx->depthwise_scratch;
+    const uint16_t input_wd = plan->input_dims.width;
+    const uint16_t input_ht = plan->input_dims.height;
+    const uint16_t channels = plan->input_dims.channels;
+    const int32_t input_offset = plan->params.in_offset;
+    const int32_t out_offset = plan->params.out_offset;
+    const uint16_t pad_wd = plan->params.padding.width;
+    const uint16_t pad_ht = plan->params.padding.height;
+    const uint16_t stride_wd = plan->params.stride.width;
+    const uint16_t stride_ht = plan->params.stride.height;
+    const uint16_t filter_wd = plan->filter_dims.width;
+    const uint16_t filter_ht = plan->filter_dims.height;
+    const uint16_t out_wd = plan->output_dims.width;
+    const uint16_t out_ht = plan->output_dims.height;
     const int32_t *out_shift = quant_data->shift;
     const int32_t *out_mult = quant_data->mult;
-    const int32_t activation_min = conv_params->activation.min;
-    const int32_t activation_max = conv_params->activation.max;
-    const uint16_t ch_mult = conv_params->ch_mult;
+    const int32_t activation_min = plan->params.activation.min;
+    const int32_t activation_max = plan->params.activation.max;
+    const uint16_t ch_mult = plan->params.ch_mult;
 
     int filter_size = filter_wd * filter_ht * channels * ch_mult;
-    int align_len = 16 - (filter_size & 15);
     int input_size = input_wd * input_ht * channels;
     int16_t *filter_data16 = scratch_buffer;
-    int16_t *input_data16 = scratch_buffer + filter_size + align_len;
+    int16_t *input_data16 = scratch_buffer + plan->k[2];
     if (scratch_buffer == NULL) {
         printf("esp_nn_depthwise_conv error! scratch_buffer not set!\n");
         return;
     }
 
-    if ((ch_mult == 1) && (channels % 8 == 0)) {
-        if ((filter_wd == 3) && (filter_ht == 3)) {
-            if ((channels % 16 == 0) && (pad_wd == 1) && (pad_ht == 1)) {
-                /* process in 8 bits */
-                int8_t *filter_aligned = (int8_t *) scratch_buffer;
-                int8_t *input_padded = (int8_t *) scratch_buffer + filter_size + align_len;
-                memcpy(filter_aligned, filter_data, filter_size);
-                esp_nn_aligned_s8_pad_with_value(input_data, input_padded, input_wd, input_ht, channels,
-                                                 -input_offset, pad_wd, pad_ht);
-                esp_nn_depthwise_conv_s8_mult1_3x3_padded_esp32s3(input_padded, input_wd + 2 * pad_wd,
-                                                                  input_ht + 2 * pad_ht, channels, input_offset,
-                                                                  stride_wd, stride_ht, filter_aligned, bias,
-                                                                  out_data, out_wd, out_ht, out_offset, out_shift,
-                                                                  out_mult, activation_min, activation_max);
-            } else if ((channels % 16 == 0) && (pad_wd == 0) && (pad_ht == 0)) {
-                /* process in 8 bits */
-                int8_t *filter_aligned = (int8_t *) scratch_buffer;
-                int8_t *input_padded = (int8_t *) scratch_buffer + filter_size + align_len;
-
-                // check if we need to pad additionally
-                int pad_right = (out_wd * stride_wd + filter_wd - 1) - input_wd;
-                int pad_bottom = (out_ht * stride_ht + filter_ht - 1) - input_ht;
-                if (pad_right || pad_bottom) { // pad right and bottom
-                    esp_nn_aligned_s8_pad_end_with_value(input_data, input_padded, input_wd, input_ht,
-                                                         channels, -input_offset, pad_right, pad_bottom);
-                } else {
-                    input_padded = (int8_t *) input_data;
-                }
-                memcpy(filter_aligned, filter_data, filter_size);
-                esp_nn_depthwise_conv_s8_mult1_3x3_padded_esp32s3(input_padded, input_wd + pad_right,
-                                                                  input_ht + pad_bottom, channels, input_offset,
-                                                                  stride_wd, stride_ht, filter_aligned, bias,
-                                                                  out_data, out_wd, out_ht, out_offset, out_shift,
-                                                                  out_mult, activation_min, activation_max);
-            } else { /* (channels % 8) == 0 */
-                esp_nn_s8_to_s16_esp32s3(filter_data, filter_data16, filter_size);
-                esp_nn_aligned_s8_to_s16_with_offset_esp32s3(input_data, input_data16, input_size, input_offset);
-                esp_nn_depthwise_conv_s16_mult1_3x3_esp32s3(input_data16, input_wd, input_ht, channels,
-                                                            pad_wd, pad_ht, stride_wd, stride_ht, filter_data16,
-                                                            bias, out_data, out_wd, out_ht, out_offset, out_shift,
-                                                            out_mult, activation_min, activation_max);
-            }
-        } else { // all other ch_mult == 1, `channels % 8 == 0`
-            esp_nn_depthwise_conv_s8_ch_mult1(input_data, input_wd, input_ht, channels, input_offset,
-                                              pad_wd, pad_ht, stride_wd, stride_ht,
-                                              filter_data, filter_wd, filter_ht,
-                                              bias, out_data, out_wd, out_ht, out_offset, out_shift,
-                                              out_mult, activation_min, activation_max);
+    switch (plan->variant) {
+    case DW_S3_MULT1_3X3_PADDED: {
+        /* process in 8 bits */
+        int8_t *filter_aligned = (int8_t *) scratch_buffer;
+        int8_t *input_padded = (int8_t *) scratch_buffer + plan->k[2];
+        memcpy(filter_aligned, filter_data, filter_size);
+        esp_nn_aligned_s8_pad_with_value(input_data, input_padded, input_wd, input_ht, channels,
+                                         -input_offset, pad_wd, pad_ht);
+        esp_nn_depthwise_conv_s8_mult1_3x3_padded_esp32s3(input_padded, input_wd + 2 * pad_wd,
+                                                          input_ht + 2 * pad_ht, channels, input_offset,
+                                                          stride_wd, stride_ht, filter_aligned, bias,
+                                                          out_data, out_wd, out_ht, out_offset, out_shift,
+                                                          out_mult, activation_min, activation_max);
+        break;
+    }
+    case DW_S3_MULT1_3X3_NO_PAD: {
+        /* process in 8 bits */
+        int8_t *filter_aligned = (int8_t *) scratch_buffer;
+        int8_t *input_padded = (int8_t *) scratch_buffer + plan->k[2];
+        const int pad_right = plan->k[0];
+        const int pad_bottom = plan->k[1];
+        if (pad_right || pad_bottom) { // pad right and bottom
+            esp_nn_aligned_s8_pad_end_with_value(input_data, input_padded, input_wd, input_ht,
+                                                 channels, -input_offset, pad_right, pad_bottom);
+        } else {
+            input_padded = (int8_t *) input_data;
         }
-    } else if (ch_mult % 8 == 0) {
+        memcpy(filter_aligned, filter_data, filter_size);
+        esp_nn_depthwise_conv_s8_mult1_3x3_padded_esp32s3(input_padded, input_wd + pad_right,
+                                                          input_ht + pad_bottom, channels, input_offset,
+                                                          stride_wd, stride_ht, filter_aligned, bias,
+                                                          out_data, out_wd, out_ht, out_offset, out_shift,
+                                                          out_mult, activation_min, activation_max);
+        break;
+    }
+    case DW_S3_S16_MULT1_3X3:
         esp_nn_s8_to_s16_esp32s3(filter_data, filter_data16, filter_size);
         esp_nn_aligned_s8_to_s16_with_offset_esp32s3(input_data, input_data16, input_size, input_offset);
-        if (filter_wd == 3 && filter_ht == 3) {
-            esp_nn_depthwise_conv_s16_mult8_3x3_esp32s3(input_data16, input_wd, input_ht, channels,
-                                                        pad_wd, pad_ht, stride_wd, stride_ht, ch_mult,
-                                                        filter_data16, bias,
-                                                        out_data, out_wd, out_ht, out_offset, out_shift,
-                                                        out_mult, activation_min, activation_max);
-        } else {
-            esp_nn_depthwise_conv_s16_mult8_esp32s3(input_data16, input_wd, input_ht, channels,
+        esp_nn_depthwise_conv_s16_mult1_3x3_esp32s3(input_data16, input_wd, input_ht, channels,
+                                                    pad_wd, pad_ht, stride_wd, stride_ht, filter_data16,
+                                                    bias, out_data, out_wd, out_ht, out_offset, out_shift,
+                                                    out_mult, activation_min, activation_max);
+        break;
+    case DW_S3_MULT1:
+        esp_nn_depthwise_conv_s8_ch_mult1(input_data, input_wd, input_ht, channels, input_offset,
+                                          pad_wd, pad_ht, stride_wd, stride_ht,
+                                          filter_data, filter_wd, filter_ht,
+                                          bias, out_data, out_wd, out_ht, out_offset, out_shift,
+                                          out_mult, activation_min, activation_max);
+        break;
+    case DW_S3_S16_MULT8_3X3:
+        esp_nn_s8_to_s16_esp32s3(filter_data, filter_data16, filter_size);
+        esp_nn_aligned_s8_to_s16_with_offset_esp32s3(input_data, input_data16, input_size, input_offset);
+        esp_nn_depthwise_conv_s16_mult8_3x3_esp32s3(input_data16, input_wd, input_ht, channels,
                                                     pad_wd, pad_ht, stride_wd, stride_ht, ch_mult,
-                                                    filter_data16, filter_wd, filter_ht, bias,
+                                                    filter_data16, bias,
                                                     out_data, out_wd, out_ht, out_offset, out_shift,
                                                     out_mult, activation_min, activation_max);
-        }
-    } else if (ch_mult % 4 == 0) {
+        break;
+    case DW_S3_S16_MULT8:
+        esp_nn_s8_to_s16_esp32s3(filter_data, filter_data16, filter_size);
+        esp_nn_aligned_s8_to_s16_with_offset_esp32s3(input_data, input_data16, input_size, input_offset);
+        esp_nn_depthwise_conv_s16_mult8_esp32s3(input_data16, input_wd, input_ht, channels,
+                                                pad_wd, pad_ht, stride_wd, stride_ht, ch_mult,
+                                                filter_data16, filter_wd, filter_ht, bias,
+                                                out_data, out_wd, out_ht, out_offset, out_shift,
+                                                out_mult, activation_min, activation_max);
+        break;
+    case DW_S3_S16_MULT4:
         esp_nn_s8_to_s16_esp32s3(filter_data, filter_data16, filter_size);
         esp_nn_aligned_s8_to_s16_with_offset_esp32s3(input_data, input_data16, input_size, input_offset);
         esp_nn_depthwise_conv_s16_mult4_esp32s3(input_data16, input_wd, input_ht, channels,
@@ -533,11 +592,62 @@ void esp_nn_depthwise_conv_s8_esp32s3(const data_dims_t *input_dims,
                                                 filter_data16, filter_wd, filter_ht, bias,
                                                 out_data, out_wd, out_ht, out_offset, out_shift,
                                                 out_mult, activation_min, activation_max);
-    } else {
+        break;
+    default:
         esp_nn_depthwise_conv_s8_unrolled(input_data, input_wd, input_ht, channels, input_offset,
                                           pad_wd, pad_ht, stride_wd, stride_ht, ch_mult,
                                           filter_data, filter_wd, filter_ht,
                                           bias, out_data, out_wd, out_ht, out_offset, out_shift,
                                           out_mult, activation_min, activation_max);
+        break;
     }
 }
+
+void esp_nn_depthwise_conv_s8_execute_esp32s3(const dw_conv_plan_t *plan,
+                                              const int8_t *input_data,
+                                              const int8_t *filter_data,
+                                              const int32_t *bias,
+                                              int8_t *out_data,
+                                              const quant_data_t *quant_data)
+{
+    esp_nn_depthwise_conv_s8_execute_ctx_esp32s3(&global_ctx, plan, input_data, filter_data,
+                                                 bias, out_data, quant_data);
+}
+
+/**
+ * Assumption 1: i/p channels == o/p channels
+ * Assumption 2: Pointers are valid
+ * Assumption 3: dialation width = 1
+ */
+void esp_nn_depthwise_conv_s8_ctx_esp32s3(const esp_nn_ctx_t *ctx,
+                                          const data_dims_t *input_dims,
+                                          const int8_t *input_data,
+                                          const data_dims_t *filter_dims,
+                                          const int8_t *filter_data,
+                                          const int32_t *bias,
+                                          const data_dims_t *output_dims,
+                                          int8_t *out_data,
+                                          const dw_conv_params_t *conv_params,
+                                          const quant_data_t *quant_data)
+{
+    dw_conv_plan_t plan;
+    esp_nn_dw_conv_plan_init(&plan, input_dims, filter_dims, output_dims, conv_params);
+    esp_nn_depthwise_conv_plan_select_esp32s3(&plan);
+    esp_nn_depthwise_conv_s8_execute_ctx_esp32s3(ctx, &plan, input_data, filter_data, bias,
+                                                 out_data, quant_data);
+}
+
+void esp_nn_depthwise_conv_s8_esp32s3(const data_dims_t *input_dims,
+                                      const int8_t *input_data,
+                                      const data_dims_t *filter_dims,
+                                      const int8_t *filter_data,
+                                      const int32_t *bias,
+                                      const data_dims_t *output_dims,
+                                      int8_t *out_data,
+                                      const dw_conv_params_t *conv_params,
+                                      const quant_data_t *quant_data)
+{
+    esp_nn_depthwise_conv_s8_ctx_esp32s3(&global_ctx, input_dims, input_data, filter_dims,
+                                         filter_data, bias, output_dims, out_data, conv_params,
+                                         quant_data);
+}
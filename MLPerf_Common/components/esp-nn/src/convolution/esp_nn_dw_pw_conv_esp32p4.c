@@ -0,0 +1,74 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_nn_defs.h>
+#include "esp_nn_esp32p4.h"
+
+#include "dw_pw_common.h"
+
+/* context of the entry points without _ctx */
+static esp_nn_ctx_t global_ctx;
+
+int esp_nn_get_dw_pw_conv_scratch_size_esp32p4(const data_dims_t *input_dims,
+                                               const data_dims_t *dw_filter_dims,
+                                               const data_dims_t *pw_filter_dims,
+                                               const data_dims_t *output_dims,
+                                               const dw_pw_conv_params_t *params)
+{
+    return esp_nn_dw_pw_scratch_size(input_dims, dw_filter_dims, pw_filter_dims, output_dims, params,
+                                     esp_nn_get_depthwise_conv_scratch_size_opt,
+                                     esp_nn_get_conv_scratch_size_esp32p4);
+}
+
+void esp_nn_set_dw_pw_conv_scratch_buf_esp32p4(const void *buf)
+{
+    global_ctx.dw_pw_scratch = (void *) buf;
+}
+
+void esp_nn_dw_pw_conv_s8_ctx_esp32p4(const esp_nn_ctx_t *ctx,
+                                      const data_dims_t *input_dims,
+                                      const int8_t *input_data,
+                                      const data_dims_t *dw_filter_dims,
+                                      const int8_t *dw_filter_data,
+                                      const int32_t *dw_bias,
+                                      const data_dims_t *pw_filter_dims,
+                                      const int8_t *pw_filter_data,
+                                      const int32_t *pw_bias,
+                                      const data_dims_t *output_dims,
+                                      int8_t *out_data,
+                                      const dw_pw_conv_params_t *params)
+{
+    esp_nn_dw_pw_run(ctx, input_dims, input_data, dw_filter_dims, dw_filter_data, dw_bias,
+                     pw_filter_dims, pw_filter_data, pw_bias, output_dims, out_data, params,
+                     esp_nn_depthwise_conv_plan_create_opt, esp_nn_depthwise_conv_s8_execute_ctx_opt,
+                     esp_nn_conv_plan_create_esp32p4, esp_nn_conv_s8_execute_ctx_esp32p4);
+}
+
+void esp_nn_dw_pw_conv_s8_esp32p4(const data_dims_t *input_dims,
+                                  const int8_t *input_data,
+                                  const data_dims_t *dw_filter_dims,
+                                  const int8_t *dw_filter_data,
+                                  const int32_t *dw_bias,
+                                  const data_dims_t *pw_filter_dims,
+                                  const int8_t *pw_filter_data,
+                                  const int32_t *pw_bias,
+                                  const data_dims_t *output_dims,
+                                  int8_t *out_data,
+                                  const dw_pw_conv_params_t *params)
+{
+    esp_nn_dw_pw_conv_s8_ctx_esp32p4(&global_ctx, input_dims, input_data,
+                                     dw_filter_dims, dw_filter_data, dw_bias,
+                                     pw_filter_dims, pw_filter_data, pw_bias,
+                                     output_dims, out_data, params);
+}
@@ -0,0 +1,305 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <common_functions.h>
+
+/**
+ * Generic optimisation of the fully connected layer.
+ *
+ * The offsets are taken out of the inner loop:
+ *
+ *   sum((f + f_off) * (x + x_off)) = sum(f * x) + x_off * sum(f)
+ *                                    + f_off * sum(x) + len * f_off * x_off
+ *
+ * `sum(x)` and the last term are computed once per call, `sum(f)` is
+ * accumulated next to the dot product and multiplied by `x_off` once per
+ * output channel. Four output channels share every input load and the
+ * inner loop is unrolled by four. Requantisation uses the same rounding as
+ * the ANSI version, so the results are bit exact.
+ *
+ * `x_off * sum(f) + bias` only depends on the weights. The _planned entry
+ * points take it from a per channel table built once per layer
+ * (esp_nn_fully_connected_plan_opt), so the inner loop is the bare dot
+ * product.
+ */
+
+/* returns sum(x) * f_off + len * f_off * x_off, the per call part of the offsets */
+static int32_t esp_nn_fc_input_term(const int8_t *input_data, const uint16_t row_len,
+                                    const int32_t input_offset, const int32_t filter_offset)
+{
+    if (filter_offset == 0) {
+        return 0;
+    }
+    int32_t input_sum = 0;
+    for (int32_t i = 0; i < row_len; i++) {
+        input_sum += input_data[i];
+    }
+    return filter_offset * (input_sum + row_len * input_offset);
+}
+
+/* sum of one filter row, for the per channel table */
+static int32_t esp_nn_fc_filter_sum(const int8_t *filter, const uint16_t row_len)
+{
+    int32_t sum = 0;
+    for (int32_t i = 0; i < row_len; i++) {
+        sum += filter[i];
+    }
+    return sum;
+}
+
+__NN_FORCE_INLINE__ int32_t esp_nn_fc_out(int32_t result, const int32_t *bias, const int32_t out_c,
+                                          const int32_t out_mult, const int32_t out_shift,
+                                          const int32_t out_offset,
+                                          const int32_t activation_min,
+                                          const int32_t activation_max)
+{
+    if (bias) {
+        result += bias[out_c];
+    }
+    result = esp_nn_multiply_by_quantized_mult(result, out_mult, out_shift);
+    result += out_offset;
+    result = max(result, activation_min);
+    result = min(result, activation_max);
+    return result;
+}
+
+/**
+ * @brief       common body of the per tensor and per channel versions
+ *
+ * @note        `mult_step` is 0 for per tensor quantisation (single mult/shift)
+ *              and 1 for per channel quantisation. With `row_term` (planned
+ *              entry points) the filter sums and the bias come from that
+ *              table and `bias` is ignored; `planned` is a constant so each
+ *              entry point gets its own inner loop.
+ */
+__NN_FORCE_INLINE__ void esp_nn_fc_s8_opt(const int8_t *input_data,
+                                          const int32_t input_offset,
+                                          const uint16_t row_len,
+                                          const int8_t *filter_data,
+                                          const int32_t filter_offset,
+                                          const int32_t *bias,
+                                          const int32_t planned,
+                                          const int32_t *row_term,
+                                          int8_t *out_data,
+                                          const uint16_t out_channels,
+                                          const int32_t out_offset,
+                                          const int32_t *out_shift,
+                                          const int32_t *out_mult,
+                                          const int32_t mult_step,
+                                          const int32_t activation_min,
+                                          const int32_t activation_max)
+{
+    if (planned) {
+        bias = NULL;
+    }
+    const int32_t input_term = esp_nn_fc_input_term(input_data, row_len,
+                                                    input_offset, filter_offset);
+    int32_t out_c = 0;
+
+    for (; out_c < out_channels - 3; out_c += 4) {
+        const int8_t *filter0 = filter_data + out_c * row_len;
+        const int8_t *filter1 = filter0 + row_len;
+        const int8_t *filter2 = filter1 + row_len;
+        const int8_t *filter3 = filter2 + row_len;
+        int32_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+        int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+
+        int32_t i = 0;
+        for (; i < row_len - 3; i += 4) {
+            const int32_t in0 = input_data[i + 0];
+            const int32_t in1 = input_data[i + 1];
+            const int32_t in2 = input_data[i + 2];
+            const int32_t in3 = input_data[i + 3];
+
+            int32_t f0 = filter0[i + 0], f1 = filter0[i + 1];
+            int32_t f2 = filter0[i + 2], f3 = filter0[i + 3];
+            acc0 += f0 * in0 + f1 * in1 + f2 * in2 + f3 * in3;
+            if (!planned) sum0 += f0 + f1 + f2 + f3;
+
+            f0 = filter1[i + 0], f1 = filter1[i + 1];
+            f2 = filter1[i + 2], f3 = filter1[i + 3];
+            acc1 += f0 * in0 + f1 * in1 + f2 * in2 + f3 * in3;
+            if (!planned) sum1 += f0 + f1 + f2 + f3;
+
+            f0 = filter2[i + 0], f1 = filter2[i + 1];
+            f2 = filter2[i + 2], f3 = filter2[i + 3];
+            acc2 += f0 * in0 + f1 * in1 + f2 * in2 + f3 * in3;
+            if (!planned) sum2 += f0 + f1 + f2 + f3;
+
+            f0 = filter3[i + 0], f1 = filter3[i + 1];
+            f2 = filter3[i + 2], f3 = filter3[i + 3];
+            acc3 += f0 * in0 + f1 * in1 + f2 * in2 + f3 * in3;
+            if (!planned) sum3 += f0 + f1 + f2 + f3;
+        }
+        for (; i < row_len; i++) {
+            const int32_t in = input_data[i];
+            acc0 += filter0[i] * in;
+            acc1 += filter1[i] * in;
+            acc2 += filter2[i] * in;
+            acc3 += filter3[i] * in;
+            if (!planned) {
+                sum0 += filter0[i];
+                sum1 += filter1[i];
+                sum2 += filter2[i];
+                sum3 += filter3[i];
+            }
+        }
+
+        if (planned) {
+            acc0 += row_term[out_c + 0] + input_term;
+            acc1 += row_term[out_c + 1] + input_term;
+            acc2 += row_term[out_c + 2] + input_term;
+            acc3 += row_term[out_c + 3] + input_term;
+        } else {
+            acc0 += sum0 * input_offset + input_term;
+            acc1 += sum1 * input_offset + input_term;
+            acc2 += sum2 * input_offset + input_term;
+            acc3 += sum3 * input_offset + input_term;
+        }
+
+        const int32_t *mult = out_mult + out_c * mult_step;
+        const int32_t *shift = out_shift + out_c * mult_step;
+        out_data[out_c + 0] = (int8_t) esp_nn_fc_out(acc0, bias, out_c + 0, mult[0], shift[0],
+                                                     out_offset, activation_min, activation_max);
+        out_data[out_c + 1] = (int8_t) esp_nn_fc_out(acc1, bias, out_c + 1,
+                                                     mult[mult_step], shift[mult_step],
+                                                     out_offset, activation_min, activation_max);
+        out_data[out_c + 2] = (int8_t) esp_nn_fc_out(acc2, bias, out_c + 2,
+                                                     mult[2 * mult_step], shift[2 * mult_step],
+                                                     out_offset, activation_min, activation_max);
+        out_data[out_c + 3] = (int8_t) esp_nn_fc_out(acc3, bias, out_c + 3,
+                                                     mult[3 * mult_step], shift[3 * mult_step],
+                                                     out_offset, activation_min, activation_max);
+    }
+
+    /* leftover channels */
+    for (; out_c < out_channels; out_c++) {
+        const int8_t *filter = filter_data + out_c * row_len;
+        int32_t acc = 0, sum = 0;
+        int32_t i = 0;
+        for (; i < row_len - 3; i += 4) {
+            const int32_t f0 = filter[i + 0], f1 = filter[i + 1];
+            const int32_t f2 = filter[i + 2], f3 = filter[i + 3];
+            acc += f0 * input_data[i + 0] + f1 * input_data[i + 1] +
+                   f2 * input_data[i + 2] + f3 * input_data[i + 3];
+            if (!planned) sum += f0 + f1 + f2 + f3;
+        }
+        for (; i < row_len; i++) {
+            acc += filter[i] * input_data[i];
+            if (!planned) sum += filter[i];
+        }
+        acc += (planned ? row_term[out_c] : sum * input_offset) + input_term;
+        out_data[out_c] = (int8_t) esp_nn_fc_out(acc, bias, out_c,
+                                                 out_mult[out_c * mult_step],
+                                                 out_shift[out_c * mult_step],
+                                                 out_offset, activation_min, activation_max);
+    }
+}
+
+void esp_nn_fully_connected_s8_opt(const int8_t *input_data,
+                                   const int32_t input_offset,
+                                   const uint16_t row_len,
+                                   const int8_t *filter_data,
+                                   const int32_t filter_offset,
+                                   const int32_t *bias,
+                                   int8_t *out_data,
+                                   const uint16_t out_channels,
+                                   const int32_t out_offset,
+                                   const int32_t out_shift,
+                                   const int32_t out_mult,
+                                   const int32_t activation_min,
+                                   const int32_t activation_max)
+{
+    esp_nn_fc_s8_opt(input_data, input_offset, row_len, filter_data, filter_offset, bias, 0, NULL,
+                     out_data, out_channels, out_offset, &out_shift, &out_mult, 0,
+                     activation_min, activation_max);
+}
+
+void esp_nn_fully_connected_per_ch_s8_opt(const int8_t *input_data,
+                                          const int32_t input_offset,
+                                          const uint16_t row_len,
+                                          const int8_t *filter_data,
+                                          const int32_t filter_offset,
+                                          const int32_t *bias,
+                                          int8_t *out_data,
+                                          const uint16_t out_channels,
+                                          const int32_t out_offset,
+                                          const int32_t *out_shift,
+                                          const int32_t *out_mult,
+                                          const int32_t activation_min,
+                                          const int32_t activation_max)
+{
+    esp_nn_fc_s8_opt(input_data, input_offset, row_len, filter_data, filter_offset, bias, 0, NULL,
+                     out_data, out_channels, out_offset, out_shift, out_mult, 1,
+                     activation_min, activation_max);
+}
+
+int esp_nn_get_fully_connected_plan_size_opt(const uint16_t out_channels)
+{
+    return out_channels * (int) sizeof(int32_t);
+}
+
+void esp_nn_fully_connected_plan_opt(const int8_t *filter_data,
+                                     const int32_t input_offset,
+                                     const uint16_t row_len,
+                                     const int32_t *bias,
+                                     const uint16_t out_channels,
+                                     int32_t *row_term)
+{
+    for (int32_t out_c = 0; out_c < out_channels; out_c++) {
+        row_term[out_c] = esp_nn_fc_filter_sum(filter_data + out_c * row_len, row_len) *
+                          input_offset + (bias ? bias[out_c] : 0);
+    }
+}
+
+void esp_nn_fully_connected_s8_planned_opt(const int8_t *input_data,
+                                           const int32_t input_offset,
+                                           const uint16_t row_len,
+                                           const int8_t *filter_data,
+                                           const int32_t filter_offset,
+                                           const int32_t *row_term,
+                                           int8_t *out_data,
+                                           const uint16_t out_channels,
+                                           const int32_t out_offset,
+                                           const int32_t out_shift,
+                                           const int32_t out_mult,
+                                           const int32_t activation_min,
+                                           const int32_t activation_max)
+{
+    esp_nn_fc_s8_opt(input_data, input_offset, row_len, filter_data, filter_offset, NULL, 1,
+                     row_term, out_data, out_channels, out_offset, &out_shift, &out_mult, 0,
+                     activation_min, activation_max);
+}
+
+void esp_nn_fully_connected_per_ch_s8_planned_opt(const int8_t *input_data,
+                                                  const int32_t input_offset,
+                                                  const uint16_t row_len,
+                                                  const int8_t *filter_data,
+                                                  const int32_t filter_offset,
+                                                  const int32_t *row_term,
+                                                  int8_t *out_data,
+                                                  const uint16_t out_channels,
+                                                  const int32_t out_offset,
+                                                  const int32_t *out_shift,
+                                                  const int32_t *out_mult,
+                                                  const int32_t activation_min,
+                                                  const int32_t activation_max)
+{
+    esp_nn_fc_s8_opt(input_data, input_offset, row_len, filter_data, filter_offset, NULL, 1,
+                     row_term, out_data, out_channels, out_offset, out_shift, out_mult, 1,
+                     activation_min, activation_max);
+}
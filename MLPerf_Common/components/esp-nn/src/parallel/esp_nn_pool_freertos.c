@@ -0,0 +1,156 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Worker pool on FreeRTOS tasks (ESP-IDF).
+ *
+ * Helper i is pinned to core (creator's core + i) % portNUM_PROCESSORS and
+ * runs at the creator's priority, so on ESP32/ESP32-S3 a pool of 2 puts the
+ * second band of every layer on the other core. Each helper blocks on a
+ * semaphore of its own; finished jobs are counted on `done`.
+ */
+
+#include <stdlib.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#include <esp_nn_defs.h>
+#include <esp_nn_ansi_headers.h>
+#include <common_functions.h>
+
+#ifndef ESP_NN_POOL_STACK_SIZE
+#define ESP_NN_POOL_STACK_SIZE      4096
+#endif
+
+typedef struct {
+    esp_nn_pool_t *pool;
+    SemaphoreHandle_t start;
+    TaskHandle_t task;
+    void *arg;
+} esp_nn_pool_helper_t;
+
+struct esp_nn_pool {
+    int workers;
+    esp_nn_pool_helper_t helpers[ESP_NN_POOL_MAX_WORKERS - 1];
+    SemaphoreHandle_t done;
+    void (*fn)(void *);
+    int quit;
+};
+
+static void esp_nn_pool_helper(void *arg)
+{
+    esp_nn_pool_helper_t *self = (esp_nn_pool_helper_t *) arg;
+    esp_nn_pool_t *pool = self->pool;
+
+    for (;;) {
+        xSemaphoreTake(self->start, portMAX_DELAY);
+        if (pool->quit) {
+            break;
+        }
+        pool->fn(self->arg);
+        xSemaphoreGive(pool->done);
+    }
+    xSemaphoreGive(pool->done);
+    vTaskDelete(NULL);
+}
+
+esp_nn_pool_t *esp_nn_pool_create(int workers)
+{
+    if (workers < 1 || workers > ESP_NN_POOL_MAX_WORKERS) {
+        return NULL;
+    }
+    esp_nn_pool_t *pool = calloc(1, sizeof(*pool));
+    if (pool == NULL) {
+        return NULL;
+    }
+    pool->done = xSemaphoreCreateCounting(ESP_NN_POOL_MAX_WORKERS, 0);
+    pool->workers = 1;
+    if (pool->done == NULL) {
+        esp_nn_pool_destroy(pool);
+        return NULL;
+    }
+
+    const int core = xPortGetCoreID();
+    const UBaseType_t prio = uxTaskPriorityGet(NULL);
+    for (int i = 1; i < workers; i++) {
+        esp_nn_pool_helper_t *h = &pool->helpers[i - 1];
+        h->pool = pool;
+        h->start = xSemaphoreCreateBinary();
+        if (h->start == NULL ||
+            xTaskCreatePinnedToCore(esp_nn_pool_helper, "esp_nn_pool", ESP_NN_POOL_STACK_SIZE,
+                                    h, prio, &h->task, (core + i) % portNUM_PROCESSORS) != pdPASS) {
+            if (h->start != NULL) {
+                vSemaphoreDelete(h->start);
+            }
+            esp_nn_pool_destroy(pool);
+            return NULL;
+        }
+        /* `workers` counts the helpers started so far, destroy stops only those */
+        pool->workers = i + 1;
+    }
+    return pool;
+}
+
+void esp_nn_pool_destroy(esp_nn_pool_t *pool)
+{
+    if (pool == NULL) {
+        return;
+    }
+    pool->quit = 1;
+    for (int i = 1; i < pool->workers; i++) {
+        xSemaphoreGive(pool->helpers[i - 1].start);
+    }
+    for (int i = 1; i < pool->workers; i++) {
+        xSemaphoreTake(pool->done, portMAX_DELAY);
+    }
+    for (int i = 1; i < pool->workers; i++) {
+        vSemaphoreDelete(pool->helpers[i - 1].start);
+    }
+    if (pool->done != NULL) {
+        vSemaphoreDelete(pool->done);
+    }
+    free(pool);
+}
+
+int esp_nn_pool_workers(const esp_nn_pool_t *pool)
+{
+    return pool ? pool->workers : 1;
+}
+
+void esp_nn_pool_run(esp_nn_pool_t *pool, void (*fn)(void *), void *const *args, int n)
+{
+    if (n <= 0) {
+        return;
+    }
+    const int helpers = pool ? min(n, pool->workers) - 1 : 0;
+    if (helpers > 0) {
+        pool->fn = fn;
+    }
+    for (int i = 1; i <= helpers; i++) {
+        pool->helpers[i - 1].arg = args[i];
+        xSemaphoreGive(pool->helpers[i - 1].start);
+    }
+
+    /* job 0 and the jobs without a helper on the caller */
+    fn(args[0]);
+    for (int i = helpers + 1; i < n; i++) {
+        fn(args[i]);
+    }
+
+    for (int i = 0; i < helpers; i++) {
+        xSemaphoreTake(pool->done, portMAX_DELAY);
+    }
+}
@@ -0,0 +1,169 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Worker pool on pthreads, for Linux hosts (tests and benchmarks).
+ *
+ * The helpers wait on `start` for a new generation, run their job and count
+ * `pending` down; the caller runs job 0 meanwhile and then waits on `done`
+ * until all jobs of the generation are back.
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include <esp_nn_defs.h>
+#include <esp_nn_ansi_headers.h>
+#include <common_functions.h>
+
+struct esp_nn_pool {
+    int workers;
+    pthread_t threads[ESP_NN_POOL_MAX_WORKERS - 1];
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    unsigned generation;
+    int quit;
+    int n;
+    int pending;
+    void (*fn)(void *);
+    void *const *args;
+};
+
+typedef struct {
+    esp_nn_pool_t *pool;
+    int index;
+} esp_nn_pool_helper_t;
+
+static void *esp_nn_pool_helper(void *arg)
+{
+    esp_nn_pool_helper_t self = *(esp_nn_pool_helper_t *) arg;
+    esp_nn_pool_t *pool = self.pool;
+    free(arg);
+
+    unsigned seen = 0;
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (pool->generation == seen && !pool->quit) {
+            pthread_cond_wait(&pool->start, &pool->lock);
+        }
+        if (pool->quit) {
+            break;
+        }
+        seen = pool->generation;
+        if (self.index >= pool->n) {
+            continue;
+        }
+        void (*fn)(void *) = pool->fn;
+        void *arg_i = pool->args[self.index];
+        pthread_mutex_unlock(&pool->lock);
+
+        fn(arg_i);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0) {
+            pthread_cond_signal(&pool->done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+esp_nn_pool_t *esp_nn_pool_create(int workers)
+{
+    if (workers < 1 || workers > ESP_NN_POOL_MAX_WORKERS) {
+        return NULL;
+    }
+    esp_nn_pool_t *pool = calloc(1, sizeof(*pool));
+    if (pool == NULL) {
+        return NULL;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    /* `workers` counts the helpers started so far, destroy joins only those */
+    pool->workers = 1;
+    for (int i = 1; i < workers; i++) {
+        esp_nn_pool_helper_t *h = malloc(sizeof(*h));
+        if (h != NULL) {
+            h->pool = pool;
+            h->index = i;
+        }
+        if (h == NULL || pthread_create(&pool->threads[i - 1], NULL, esp_nn_pool_helper, h) != 0) {
+            free(h);
+            esp_nn_pool_destroy(pool);
+            return NULL;
+        }
+        pool->workers = i + 1;
+    }
+    return pool;
+}
+
+void esp_nn_pool_destroy(esp_nn_pool_t *pool)
+{
+    if (pool == NULL) {
+        return;
+    }
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+    for (int i = 1; i < pool->workers; i++) {
+        pthread_join(pool->threads[i - 1], NULL);
+    }
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->start);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool);
+}
+
+int esp_nn_pool_workers(const esp_nn_pool_t *pool)
+{
+    return pool ? pool->workers : 1;
+}
+
+void esp_nn_pool_run(esp_nn_pool_t *pool, void (*fn)(void *), void *const *args, int n)
+{
+    if (n <= 0) {
+        return;
+    }
+    const int helpers = pool ? min(n, pool->workers) - 1 : 0;
+    if (helpers == 0) {
+        for (int i = 0; i < n; i++) {
+            fn(args[i]);
+        }
+        return;
+    }
+    pthread_mutex_lock(&pool->lock);
+    pool->fn = fn;
+    pool->args = args;
+    pool->n = helpers + 1;
+    pool->pending = helpers;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    /* job 0 and the jobs without a helper on the caller */
+    fn(args[0]);
+    for (int i = helpers + 1; i < n; i++) {
+        fn(args[i]);
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending > 0) {
+        pthread_cond_wait(&pool->done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
@@ -0,0 +1,193 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+
+#include "pool_common.h"
+
+/* column sums kept on stack by the separable path, 1 KB */
+#define AVG_POOL_COL_BUF    256
+
+/* global average pooling: filter covers the whole input, single output pixel */
+static void esp_nn_avg_pool_global(const int8_t *input,
+                                   const int32_t pixels,
+                                   int8_t *output,
+                                   const int32_t activation_min,
+                                   const int32_t activation_max,
+                                   const uint16_t channels)
+{
+    int32_t ch_idx = 0;
+    if (esp_nn_pool_swar_ok(input, channels)) {
+        for (; ch_idx < channels; ch_idx += 4) {
+            int32_t sum[4];
+            esp_nn_pool_sum4(input + ch_idx, pixels, 1, channels, 0, sum);
+            output[ch_idx + 0] = esp_nn_pool_avg_out(sum[0], pixels, activation_min, activation_max);
+            output[ch_idx + 1] = esp_nn_pool_avg_out(sum[1], pixels, activation_min, activation_max);
+            output[ch_idx + 2] = esp_nn_pool_avg_out(sum[2], pixels, activation_min, activation_max);
+            output[ch_idx + 3] = esp_nn_pool_avg_out(sum[3], pixels, activation_min, activation_max);
+        }
+    }
+    for (; ch_idx < channels; ch_idx++) {
+        const int8_t *ptr = input + ch_idx;
+        int32_t sum = 0;
+        for (int32_t i = 0; i < pixels; i++) {
+            sum += *ptr;
+            ptr += channels;
+        }
+        output[ch_idx] = esp_nn_pool_avg_out(sum, pixels, activation_min, activation_max);
+    }
+}
+
+/**
+ * Overlapping windows (stride < filter): the window rows of every input column
+ * are summed once per output row, then each output pixel adds up `filter_wd`
+ * column sums instead of `filter_wd * filter_ht` inputs. Channels are handled
+ * in tiles so that the column sums fit into `AVG_POOL_COL_BUF` words.
+ */
+static void esp_nn_avg_pool_separable(const int8_t *input,
+                                      const uint16_t input_wd,
+                                      const uint16_t input_ht,
+                                      int8_t *output,
+                                      const uint16_t output_wd,
+                                      const uint16_t output_ht,
+                                      const uint16_t stride_wd,
+                                      const uint16_t stride_ht,
+                                      const uint16_t filter_wd,
+                                      const uint16_t filter_ht,
+                                      const uint16_t pad_wd,
+                                      const uint16_t pad_ht,
+                                      const int32_t activation_min,
+                                      const int32_t activation_max,
+                                      const uint16_t channels)
+{
+    int32_t col_sum[AVG_POOL_COL_BUF];
+    const int32_t tile = min(channels, AVG_POOL_COL_BUF / input_wd);
+    const int32_t row_stride = input_wd * channels;
+
+    for (int32_t ch_start = 0; ch_start < channels; ch_start += tile) {
+        const int32_t ch_cnt = min(tile, channels - ch_start);
+        int32_t base_y = -pad_ht;
+        for (int32_t out_y = 0; out_y < output_ht; out_y++, base_y += stride_ht) {
+            const int32_t y_start = max(0, base_y);
+            const int32_t y_end = min(base_y + filter_ht, input_ht);
+
+            /* vertical pass over all input columns */
+            for (int32_t x = 0; x < input_wd; x++) {
+                const int8_t *src = input + y_start * row_stride + x * channels + ch_start;
+                int32_t *dst = col_sum + x * ch_cnt;
+                for (int32_t ch = 0; ch < ch_cnt; ch++) {
+                    dst[ch] = 0;
+                }
+                for (int32_t y = y_start; y < y_end; y++) {
+                    for (int32_t ch = 0; ch < ch_cnt; ch++) {
+                        dst[ch] += src[ch];
+                    }
+                    src += row_stride;
+                }
+            }
+
+            /* horizontal pass per output pixel */
+            int32_t base_x = -pad_wd;
+            int8_t *out = output + out_y * output_wd * channels + ch_start;
+            for (int32_t out_x = 0; out_x < output_wd; out_x++, base_x += stride_wd) {
+                const int32_t x_start = max(0, base_x);
+                const int32_t x_end = min(base_x + filter_wd, input_wd);
+                const int32_t count = (x_end - x_start) * (y_end - y_start);
+                for (int32_t ch = 0; ch < ch_cnt; ch++) {
+                    const int32_t *src = col_sum + x_start * ch_cnt + ch;
+                    int32_t sum = 0;
+                    for (int32_t x = x_start; x < x_end; x++) {
+                        sum += *src;
+                        src += ch_cnt;
+                    }
+                    out[ch] = esp_nn_pool_avg_out(sum, count, activation_min, activation_max);
+                }
+                out += channels;
+            }
+        }
+    }
+}
+
+void esp_nn_avg_pool_s8_opt(const int8_t *input,
+                            const uint16_t input_wd,
+                            const uint16_t input_ht,
+                            int8_t *output,
+                            const uint16_t output_wd,
+                            const uint16_t output_ht,
+                            const uint16_t stride_wd,
+                            const uint16_t stride_ht,
+                            const uint16_t filter_wd,
+                            const uint16_t filter_ht,
+                            const uint16_t pad_wd,
+                            const uint16_t pad_ht,
+                            const int32_t activation_min,
+                            const int32_t activation_max,
+                            const uint16_t channels)
+{
+    if (output_wd == 1 && output_ht == 1 && pad_wd == 0 && pad_ht == 0 &&
+            filter_wd >= input_wd && filter_ht >= input_ht) {
+        esp_nn_avg_pool_global(input, input_wd * input_ht, output,
+                               activation_min, activation_max, channels);
+        return;
+    }
+
+    if ((stride_wd < filter_wd || stride_ht < filter_ht) && input_wd <= AVG_POOL_COL_BUF) {
+        esp_nn_avg_pool_separable(input, input_wd, input_ht, output, output_wd, output_ht,
+                                  stride_wd, stride_ht, filter_wd, filter_ht, pad_wd, pad_ht,
+                                  activation_min, activation_max, channels);
+        return;
+    }
+
+    /* non overlapping windows: every input is read once anyway */
+    const bool swar = esp_nn_pool_swar_ok(input, channels);
+    const int32_t row_stride = input_wd * channels;
+    int32_t base_y = -pad_ht;
+    for (int32_t out_y = 0; out_y < output_ht; out_y++, base_y += stride_ht) {
+        const int32_t y_start = max(0, base_y);
+        const int32_t y_end = min(base_y + filter_ht, input_ht);
+        int32_t base_x = -pad_wd;
+        for (int32_t out_x = 0; out_x < output_wd; out_x++, base_x += stride_wd) {
+            const int32_t x_start = max(0, base_x);
+            const int32_t x_end = min(base_x + filter_wd, input_wd);
+            const int32_t cols = x_end - x_start;
+            const int32_t rows = y_end - y_start;
+            const int32_t count = cols * rows;
+            const int8_t *src = input + y_start * row_stride + x_start * channels;
+
+            int32_t ch_idx = 0;
+            if (swar) {
+                for (; ch_idx < channels; ch_idx += 4) {
+                    int32_t sum[4];
+                    esp_nn_pool_sum4(src + ch_idx, cols, rows, channels, row_stride, sum);
+                    output[ch_idx + 0] = esp_nn_pool_avg_out(sum[0], count, activation_min, activation_max);
+                    output[ch_idx + 1] = esp_nn_pool_avg_out(sum[1], count, activation_min, activation_max);
+                    output[ch_idx + 2] = esp_nn_pool_avg_out(sum[2], count, activation_min, activation_max);
+                    output[ch_idx + 3] = esp_nn_pool_avg_out(sum[3], count, activation_min, activation_max);
+                }
+            }
+            for (; ch_idx < channels; ch_idx++) {
+                int32_t sum = 0;
+                for (int32_t y = 0; y < rows; y++) {
+                    const int8_t *ptr = src + y * row_stride + ch_idx;
+                    for (int32_t x = 0; x < cols; x++) {
+                        sum += *ptr;
+                        ptr += channels;
+                    }
+                }
+                output[ch_idx] = esp_nn_pool_avg_out(sum, count, activation_min, activation_max);
+            }
+            output += channels;
+        }
+    }
+}
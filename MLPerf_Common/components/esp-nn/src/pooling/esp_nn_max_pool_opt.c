@@ -0,0 +1,199 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+
+#include "pool_common.h"
+
+/* column maxima kept on stack by the separable path, 1 KB */
+#define MAX_POOL_COL_BUF    1024
+
+__NN_FORCE_INLINE__ int8_t esp_nn_max_pool_out(int32_t result,
+                                               const int32_t activation_min,
+                                               const int32_t activation_max)
+{
+    result = max(result, activation_min);
+    result = min(result, activation_max);
+    return (int8_t) result;
+}
+
+/* dst[i] = max over k < cnt of src[k * step + i], four outputs per pass */
+__NN_FORCE_INLINE__ void esp_nn_max_pool_reduce(const int8_t *src, const int32_t step,
+                                                const int32_t cnt, int8_t *dst,
+                                                const int32_t len)
+{
+    int32_t i = 0;
+    for (; i < len - 3; i += 4) {
+        int32_t result0 = INT8_MIN, result1 = INT8_MIN;
+        int32_t result2 = INT8_MIN, result3 = INT8_MIN;
+        const int8_t *ptr = src + i;
+        for (int32_t k = 0; k < cnt; k++) {
+            result0 = max(result0, ptr[0]);
+            result1 = max(result1, ptr[1]);
+            result2 = max(result2, ptr[2]);
+            result3 = max(result3, ptr[3]);
+            ptr += step;
+        }
+        dst[i + 0] = (int8_t) result0;
+        dst[i + 1] = (int8_t) result1;
+        dst[i + 2] = (int8_t) result2;
+        dst[i + 3] = (int8_t) result3;
+    }
+    for (; i < len; i++) {
+        int32_t result = INT8_MIN;
+        const int8_t *ptr = src + i;
+        for (int32_t k = 0; k < cnt; k++) {
+            result = max(result, *ptr);
+            ptr += step;
+        }
+        dst[i] = (int8_t) result;
+    }
+}
+
+/**
+ * Overlapping windows (stride < filter): the window rows of every input column
+ * are reduced once per output row, then each output pixel takes the maximum
+ * of `filter_wd` column maxima instead of `filter_wd * filter_ht` inputs.
+ * Channels are handled in tiles so that the column maxima fit into
+ * `MAX_POOL_COL_BUF` bytes. Same scheme as esp_nn_avg_pool_separable.
+ */
+static void esp_nn_max_pool_separable(const int8_t *input,
+                                      const uint16_t input_wd,
+                                      const uint16_t input_ht,
+                                      int8_t *output,
+                                      const uint16_t output_wd,
+                                      const uint16_t output_ht,
+                                      const uint16_t stride_wd,
+                                      const uint16_t stride_ht,
+                                      const uint16_t filter_wd,
+                                      const uint16_t filter_ht,
+                                      const uint16_t pad_wd,
+                                      const uint16_t pad_ht,
+                                      const int32_t activation_min,
+                                      const int32_t activation_max,
+                                      const uint16_t channels)
+{
+    int8_t col_max[MAX_POOL_COL_BUF];
+    const int32_t tile = min(channels, MAX_POOL_COL_BUF / input_wd);
+    const int32_t row_stride = input_wd * channels;
+
+    for (int32_t ch_start = 0; ch_start < channels; ch_start += tile) {
+        const int32_t ch_cnt = min(tile, channels - ch_start);
+        int32_t base_y = -pad_ht;
+        for (int32_t out_y = 0; out_y < output_ht; out_y++, base_y += stride_ht) {
+            const int32_t y_start = max(0, base_y);
+            const int32_t y_end = min(base_y + filter_ht, input_ht);
+
+            /* vertical pass over all input columns; one flat run when the
+               tile covers all channels */
+            const int32_t runs = (ch_cnt == channels) ? 1 : input_wd;
+            const int32_t run_len = (ch_cnt == channels) ? input_wd * channels : ch_cnt;
+            for (int32_t r = 0; r < runs; r++) {
+                const int8_t *src = input + y_start * row_stride + r * channels + ch_start;
+                int8_t *dst = col_max + r * ch_cnt;
+                esp_nn_max_pool_reduce(src, row_stride, y_end - y_start, dst, run_len);
+            }
+
+            /* horizontal pass per output pixel */
+            int32_t base_x = -pad_wd;
+            int8_t *out = output + out_y * output_wd * channels + ch_start;
+            for (int32_t out_x = 0; out_x < output_wd; out_x++, base_x += stride_wd) {
+                const int32_t x_start = max(0, base_x);
+                const int32_t x_end = min(base_x + filter_wd, input_wd);
+                esp_nn_max_pool_reduce(col_max + x_start * ch_cnt, ch_cnt, x_end - x_start,
+                                       out, ch_cnt);
+                for (int32_t ch = 0; ch < ch_cnt; ch++) {
+                    out[ch] = esp_nn_max_pool_out(out[ch], activation_min, activation_max);
+                }
+                out += channels;
+            }
+        }
+    }
+}
+
+void esp_nn_max_pool_s8_opt(const int8_t *input,
+                            const uint16_t input_wd,
+                            const uint16_t input_ht,
+                            int8_t *output,
+                            const uint16_t output_wd,
+                            const uint16_t output_ht,
+                            const uint16_t stride_wd,
+                            const uint16_t stride_ht,
+                            const uint16_t filter_wd,
+                            const uint16_t filter_ht,
+                            const uint16_t pad_wd,
+                            const uint16_t pad_ht,
+                            const int32_t activation_min,
+                            const int32_t activation_max,
+                            const uint16_t channels)
+{
+    /* separable only pays off when it compares fewer values per output row,
+       e.g. 3x3 stride 1 (6 instead of 9 per pixel) but not 3x3 stride 2 */
+    const int32_t direct_cost = output_wd * filter_wd * filter_ht;
+    const int32_t separable_cost = input_wd * filter_ht + output_wd * filter_wd;
+    if (separable_cost < direct_cost && input_wd <= MAX_POOL_COL_BUF) {
+        esp_nn_max_pool_separable(input, input_wd, input_ht, output, output_wd, output_ht,
+                                  stride_wd, stride_ht, filter_wd, filter_ht, pad_wd, pad_ht,
+                                  activation_min, activation_max, channels);
+        return;
+    }
+
+    /* non overlapping windows: every input is read once anyway */
+    const int32_t row_stride = input_wd * channels;
+    int32_t base_y = -pad_ht;
+    for (int32_t out_y = 0; out_y < output_ht; out_y++, base_y += stride_ht) {
+        const int32_t y_start = max(0, base_y);
+        const int32_t y_end = min(base_y + filter_ht, input_ht);
+        int32_t base_x = -pad_wd;
+        for (int32_t out_x = 0; out_x < output_wd; out_x++, base_x += stride_wd) {
+            const int32_t x_start = max(0, base_x);
+            const int32_t x_end = min(base_x + filter_wd, input_wd);
+            const int8_t *src = input + y_start * row_stride + x_start * channels;
+
+            /* four independent maxima per pass; byte-wise SWAR max needs more
+               ALU ops per channel than it saves in loads */
+            int32_t ch_idx = 0;
+            for (; ch_idx < channels - 3; ch_idx += 4) {
+                int32_t result0 = INT8_MIN, result1 = INT8_MIN;
+                int32_t result2 = INT8_MIN, result3 = INT8_MIN;
+                for (int32_t y = y_start; y < y_end; y++) {
+                    const int8_t *ptr = src + (y - y_start) * row_stride + ch_idx;
+                    for (int32_t x = x_start; x < x_end; x++) {
+                        result0 = max(result0, ptr[0]);
+                        result1 = max(result1, ptr[1]);
+                        result2 = max(result2, ptr[2]);
+                        result3 = max(result3, ptr[3]);
+                        ptr += channels;
+                    }
+                }
+                output[ch_idx + 0] = esp_nn_max_pool_out(result0, activation_min, activation_max);
+                output[ch_idx + 1] = esp_nn_max_pool_out(result1, activation_min, activation_max);
+                output[ch_idx + 2] = esp_nn_max_pool_out(result2, activation_min, activation_max);
+                output[ch_idx + 3] = esp_nn_max_pool_out(result3, activation_min, activation_max);
+            }
+            for (; ch_idx < channels; ch_idx++) {
+                int32_t result = INT8_MIN;
+                for (int32_t y = y_start; y < y_end; y++) {
+                    const int8_t *ptr = src + (y - y_start) * row_stride + ch_idx;
+                    for (int32_t x = x_start; x < x_end; x++) {
+                        result = max(result, *ptr);
+                        ptr += channels;
+                    }
+                }
+                output[ch_idx] = esp_nn_max_pool_out(result, activation_min, activation_max);
+            }
+            output += channels;
+        }
+    }
+}
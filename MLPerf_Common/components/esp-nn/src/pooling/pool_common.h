@@ -0,0 +1,105 @@
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+#include <common_functions.h>
+
+/**
+ * SWAR helpers for the generic average pooling kernel: four int8 channels
+ * are held in one 32 bit word (little endian, channel 0 in the lowest byte)
+ * and biased by 128 so that every byte is an unsigned value.
+ */
+
+#define POOL_SWAR_BIAS      0x80808080u
+#define POOL_SWAR_LANES     0x00ff00ffu
+
+/* a 16 bit lane holds 256 biased bytes (256 * 255 < 65536) before it needs flushing */
+#define POOL_SWAR_FLUSH     256
+
+/* SWAR path needs 4 byte aligned words for every pixel */
+__NN_FORCE_INLINE__ bool esp_nn_pool_swar_ok(const void *data, const uint16_t channels)
+{
+    return ((channels & 3) == 0) && (((uintptr_t) data & 3) == 0);
+}
+
+__NN_FORCE_INLINE__ uint32_t esp_nn_pool_load4(const int8_t *src)
+{
+    uint32_t word;
+    memcpy(&word, __builtin_assume_aligned(src, 4), sizeof(word));
+    return word ^ POOL_SWAR_BIAS;
+}
+
+/**
+ * @brief       sum of a window for four adjacent channels
+ *
+ * @param       src         first pixel of the window, 4 byte aligned
+ * @param       cols, rows  window size
+ * @param       channels    pixel stride in bytes (multiple of 4)
+ * @param       row_stride  row stride in bytes
+ * @param       sum         signed sums of the four channels
+ */
+__NN_FORCE_INLINE__ void esp_nn_pool_sum4(const int8_t *src,
+                                          const int32_t cols, const int32_t rows,
+                                          const int32_t channels, const int32_t row_stride,
+                                          int32_t *sum)
+{
+    int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+    uint32_t even = 0, odd = 0;     /* channels 0/2 and 1/3 in 16 bit lanes */
+    int32_t pending = 0;
+
+    for (int32_t y = 0; y < rows; y++) {
+        const int8_t *ptr = src + y * row_stride;
+        for (int32_t x = 0; x < cols; x++) {
+            const uint32_t word = esp_nn_pool_load4(ptr);
+            even += word & POOL_SWAR_LANES;
+            odd += (word >> 8) & POOL_SWAR_LANES;
+            ptr += channels;
+            if (++pending == POOL_SWAR_FLUSH) {
+                sum0 += even & 0xffff;
+                sum2 += even >> 16;
+                sum1 += odd & 0xffff;
+                sum3 += odd >> 16;
+                even = odd = 0;
+                pending = 0;
+            }
+        }
+    }
+    sum0 += even & 0xffff;
+    sum2 += even >> 16;
+    sum1 += odd & 0xffff;
+    sum3 += odd >> 16;
+
+    /* remove the bias */
+    const int32_t bias = 128 * cols * rows;
+    sum[0] = sum0 - bias;
+    sum[1] = sum1 - bias;
+    sum[2] = sum2 - bias;
+    sum[3] = sum3 - bias;
+}
+
+/**
+ * @brief       rounded average and activation, same rounding as the ANSI version
+ */
+__NN_FORCE_INLINE__ int8_t esp_nn_pool_avg_out(const int32_t sum, const int32_t count,
+                                               const int32_t activation_min,
+                                               const int32_t activation_max)
+{
+    int32_t result = sum > 0 ? (sum + count / 2) / count
+                             : (sum - count / 2) / count;
+    result = max(result, activation_min);
+    result = min(result, activation_max);
+    return (int8_t) result;
+}
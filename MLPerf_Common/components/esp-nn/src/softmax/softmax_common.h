@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <stdint.h>
+#include <esp_nn_defs.h>
 #include <common_functions.h>
 
 #define MASK_IF_ZERO(x)                 (x) == 0 ? ~0 : 0
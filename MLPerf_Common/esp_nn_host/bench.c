@@ -0,0 +1,612 @@
+/*
+ * bench.c
+ *
+ * Zeitmessung der ESP-NN-Kernel auf dem Host, je Schicht der MLPerf-Tiny-
+ * Modelle: _ansi-Referenz gegen den Kernel, den esp_nn_generic_opt.h für
+ * ESP32/ESP32-P4 auswählt. Ausgabe als CSV auf stdout:
+ *
+ *   esp_nn_bench [-m MODELL] [-t MS] > bench.csv
+ *
+ *   kernel,model,layer,shape,ansi_us,opt_us,speedup,opt_fn
+ *
+ * Bei conv_add_s8 steht in ansi_us die ungefusionierte Folge der
+ * Dispatch-Kernel (esp_nn_conv_s8 in einen eigenen Tensor, danach
+ * esp_nn_add_elementwise_s8), der Gewinn ist also allein die Fusion.
+ * Ebenso bei dw_pw_conv_s8: ungefusioniert esp_nn_depthwise_conv_s8 in einen
+ * vollen Zwischentensor, dann esp_nn_conv_s8 (1x1); gefusioniert mit
+ * Streifen von BENCH_STRIP_HT Zeilen.
+ *
+ * Absolute Zeiten sagen über das Board wenig; das Verhältnis zeigt, ob eine
+ * Kernel-Änderung in die richtige Richtung geht. Jeder Wert ist das Minimum
+ * aus mehreren Läufen von mindestens MS Millisekunden (Standard 20).
+ *
+ * Mit -p nur die Faltungen, Dispatch-Kernel gegen vorgepackte Gewichte
+ * (esp_nn_conv_pack_filter einmal vorab, dann esp_nn_conv_s8_packed bzw.
+ * esp_nn_conv_add_s8_packed), mit dem Speicherbedarf beider Layouts; dazu
+ * die Fully-Connected-Schichten mit Kanaltabelle (esp_nn_fully_connected_plan
+ * einmal vorab, dann esp_nn_fully_connected_per_ch_s8_planned):
+ *
+ *   kernel,model,layer,shape,filter_bytes,packed_bytes,overhead,opt_us,packed_us,speedup
+ *
+ * filter_bytes zählt Filter und Bias (int32), packed_bytes den gepackten
+ * Puffer, der beides enthält (bei FC die Tabelle, zusätzlich zum Filter);
+ * overhead ist packed_bytes / filter_bytes.
+ *
+ * Mit -j N nur Faltung und Depthwise, seriell über den Plan
+ * (esp_nn_*_execute_ctx) gegen zeilenparallel auf einem Pool mit N Workern
+ * (esp_nn_*_s8_parallel, jede Schicht aufgeteilt):
+ *
+ *   kernel,model,layer,shape,workers,serial_us,parallel_us,speedup,bands
+ *
+ * bands ist die Workerzahl, die das Kostenmodell mit
+ * ESP_NN_PARALLEL_MIN_MACS wählt; 1 heißt, die Schicht bleibt seriell.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "esp_nn_generic_opt.h"
+#include "nn_host.h"
+
+#define NN_STR_(x)  #x
+#define NN_STR(x)   NN_STR_(x)
+
+typedef enum {
+    K_CONV,
+    K_DEPTHWISE,
+    K_FC,
+    K_AVG_POOL,
+    K_MAX_POOL,
+    K_SOFTMAX,
+    K_CONV_ADD,
+    K_DW_PW,
+} nn_kernel_t;
+
+// Streifenhöhe der gefusionierten Depthwise+Pointwise-Zeilen
+#define BENCH_STRIP_HT  2
+
+// Eine Schicht: Eingang wd x ht x ch, Filter f_wd x f_ht, Stride, SAME/VALID.
+// out_ch ist bei K_DEPTHWISE der Kanalmultiplikator, bei K_FC/K_SOFTMAX die
+// Ausgangsbreite (Eingang dort nur in_ch), bei K_DW_PW die Ausgangskanäle
+// der 1x1-Faltung (Filter und Stride gehören zur Depthwise-Stufe).
+typedef struct {
+    nn_kernel_t kernel;
+    const char *model;
+    const char *layer;
+    int32_t in_wd, in_ht, in_ch;
+    int32_t out_ch;
+    int32_t f_wd, f_ht;
+    int32_t stride;
+    int same;
+} nn_layer_t;
+
+static const nn_layer_t layers[] = {
+    // KWS01 (DS-CNN), Eingang 49x10 MFCC
+    { K_CONV,      "kws01", "conv_10x4",   10, 49,   1,  64, 4, 10, 2, 1 },
+    { K_DEPTHWISE, "kws01", "dw_3x3",       5, 25,  64,   1, 3,  3, 1, 1 },
+    { K_CONV,      "kws01", "pw_1x1",       5, 25,  64,  64, 1,  1, 1, 1 },
+    { K_AVG_POOL,  "kws01", "avg_pool",     5, 25,  64,   0, 5, 25, 1, 0 },
+    { K_FC,        "kws01", "fc",           1,  1,  64,  12, 1,  1, 1, 0 },
+    { K_SOFTMAX,   "kws01", "softmax",      1,  1,  12,  12, 1,  1, 1, 0 },
+    { K_DW_PW,     "kws01", "dw_pw_64",     5, 25,  64,  64, 3,  3, 1, 1 },
+    // VWW01 (MobileNetV1 0.25), Eingang 96x96x3
+    { K_CONV,      "vww01", "conv_3x3_s2", 96, 96,   3,   8, 3,  3, 2, 1 },
+    { K_DEPTHWISE, "vww01", "dw_48x48x8",  48, 48,   8,   1, 3,  3, 1, 1 },
+    { K_CONV,      "vww01", "pw_8_16",     48, 48,   8,  16, 1,  1, 1, 1 },
+    { K_DEPTHWISE, "vww01", "dw_s2_16",    48, 48,  16,   1, 3,  3, 2, 1 },
+    { K_CONV,      "vww01", "pw_16_32",    24, 24,  16,  32, 1,  1, 1, 1 },
+    { K_DEPTHWISE, "vww01", "dw_24x24x32", 24, 24,  32,   1, 3,  3, 1, 1 },
+    { K_CONV,      "vww01", "pw_32_32",    24, 24,  32,  32, 1,  1, 1, 1 },
+    { K_DEPTHWISE, "vww01", "dw_6x6x128",   6,  6, 128,   1, 3,  3, 1, 1 },
+    { K_CONV,      "vww01", "pw_128_128",   6,  6, 128, 128, 1,  1, 1, 1 },
+    { K_DEPTHWISE, "vww01", "dw_3x3x256",   3,  3, 256,   1, 3,  3, 1, 1 },
+    { K_CONV,      "vww01", "pw_256_256",   3,  3, 256, 256, 1,  1, 1, 1 },
+    { K_AVG_POOL,  "vww01", "avg_pool",     3,  3, 256,   0, 3,  3, 1, 0 },
+    { K_FC,        "vww01", "fc",           1,  1, 256,   2, 1,  1, 1, 0 },
+    { K_SOFTMAX,   "vww01", "softmax",      1,  1,   2,   2, 1,  1, 1, 0 },
+    { K_DW_PW,     "vww01", "dw_pw_8_16",  48, 48,   8,  16, 3,  3, 1, 1 },
+    { K_DW_PW,     "vww01", "dw_pw_s2_16", 48, 48,  16,  32, 3,  3, 2, 1 },
+    { K_DW_PW,     "vww01", "dw_pw_32_32", 24, 24,  32,  32, 3,  3, 1, 1 },
+    { K_DW_PW,     "vww01", "dw_pw_128",    6,  6, 128, 128, 3,  3, 1, 1 },
+    { K_DW_PW,     "vww01", "dw_pw_256",    3,  3, 256, 256, 3,  3, 1, 1 },
+    // IC01 (ResNet-8), Eingang 32x32x3
+    { K_CONV,      "ic01",  "conv_3_16",   32, 32,   3,  16, 3,  3, 1, 1 },
+    { K_CONV,      "ic01",  "conv_16_16",  32, 32,  16,  16, 3,  3, 1, 1 },
+    { K_CONV,      "ic01",  "conv_s2_32",  32, 32,  16,  32, 3,  3, 2, 1 },
+    { K_CONV,      "ic01",  "skip_1x1_32", 32, 32,  16,  32, 1,  1, 2, 1 },
+    { K_CONV,      "ic01",  "conv_32_32",  16, 16,  32,  32, 3,  3, 1, 1 },
+    { K_CONV,      "ic01",  "conv_s2_64",  16, 16,  32,  64, 3,  3, 2, 1 },
+    { K_CONV,      "ic01",  "conv_64_64",   8,  8,  64,  64, 3,  3, 1, 1 },
+    { K_CONV_ADD,  "ic01",  "add_16_16",   32, 32,  16,  16, 3,  3, 1, 1 },
+    { K_CONV_ADD,  "ic01",  "skip_add_32", 32, 32,  16,  32, 1,  1, 2, 1 },
+    { K_CONV_ADD,  "ic01",  "skip_add_64", 16, 16,  32,  64, 1,  1, 2, 1 },
+    { K_AVG_POOL,  "ic01",  "avg_pool",     8,  8,  64,   0, 8,  8, 1, 0 },
+    { K_FC,        "ic01",  "fc",           1,  1,  64,  10, 1,  1, 1, 0 },
+    { K_SOFTMAX,   "ic01",  "softmax",      1,  1,  10,  10, 1,  1, 1, 0 },
+    // AD01 (Autoencoder), 640 Eingänge
+    { K_FC,        "ad01",  "fc_640_128",   1,  1, 640, 128, 1,  1, 1, 0 },
+    { K_FC,        "ad01",  "fc_128_128",   1,  1, 128, 128, 1,  1, 1, 0 },
+    { K_FC,        "ad01",  "fc_128_8",     1,  1, 128,   8, 1,  1, 1, 0 },
+    { K_FC,        "ad01",  "fc_8_128",     1,  1,   8, 128, 1,  1, 1, 0 },
+    { K_FC,        "ad01",  "fc_128_640",   1,  1, 128, 640, 1,  1, 1, 0 },
+    // Pooling außerhalb der Referenzmodelle (MaxPool 2x2 und überlappend
+    // 3x3 wie in CNN-Varianten)
+    { K_MAX_POOL,  "misc",  "max_pool_2x2",32, 32,  16,   0, 2,  2, 2, 0 },
+    { K_MAX_POOL,  "misc",  "max_pool_3x3",16, 16,  32,   0, 3,  3, 2, 1 },
+    { K_MAX_POOL,  "misc",  "max_pool_3x3_s1",16, 16, 32, 0, 3,  3, 1, 1 },
+    { K_AVG_POOL,  "misc",  "avg_pool_3x3",16, 16,  32,   0, 3,  3, 2, 1 },
+};
+
+// Puffer und Parameter einer Schicht, einmal angelegt und für beide
+// Varianten benutzt
+typedef struct {
+    data_dims_t in, filt, out;
+    conv_params_t conv;
+    dw_conv_params_t dw;
+    int32_t pad_wd, pad_ht;
+    int8_t *input, *filter, *output;
+    int8_t *skip, *conv_out;    // nur K_CONV_ADD
+    conv_add_params_t add;
+    data_dims_t mid, pw_filt;   // nur K_DW_PW
+    int8_t *mid_out, *pw_filter;
+    dw_pw_conv_params_t dw_pw;
+    conv_plan_t plan;           // nur K_CONV/K_CONV_ADD
+    dw_conv_plan_t dw_plan;     // nur K_DEPTHWISE
+    esp_nn_ctx_t ctx;           // nur -j: Scratch beider Läufe und Pool
+    void *packed;
+    int32_t packed_n;
+    int32_t *bias, *mult, *shift;
+    void *scratch;
+} nn_job_t;
+
+static int32_t nn_same_pad(int32_t in, int32_t out, int32_t filter, int32_t stride)
+{
+    int32_t pad = ((out - 1) * stride + filter - in) / 2;
+    return pad > 0 ? pad : 0;
+}
+
+static void nn_job_init(nn_job_t *job, const nn_layer_t *l, nn_rng_t *rng)
+{
+    memset(job, 0, sizeof(*job));
+    job->in = (data_dims_t) { l->in_wd, l->in_ht, l->in_ch, 1 };
+    job->filt = (data_dims_t) { l->f_wd, l->f_ht, l->in_ch, 1 };
+    int32_t out_ch = l->out_ch;
+    if (l->kernel == K_DEPTHWISE) {
+        out_ch = l->in_ch * l->out_ch;
+    } else if (l->kernel == K_AVG_POOL || l->kernel == K_MAX_POOL) {
+        out_ch = l->in_ch;
+    }
+    job->out.channels = out_ch;
+    if (l->same) {
+        job->out.width = (l->in_wd + l->stride - 1) / l->stride;
+        job->out.height = (l->in_ht + l->stride - 1) / l->stride;
+        job->pad_wd = nn_same_pad(l->in_wd, job->out.width, l->f_wd, l->stride);
+        job->pad_ht = nn_same_pad(l->in_ht, job->out.height, l->f_ht, l->stride);
+    } else {
+        job->out.width = nn_out_size(l->in_wd, l->f_wd, l->stride, 0);
+        job->out.height = nn_out_size(l->in_ht, l->f_ht, l->stride, 0);
+    }
+    if (l->kernel == K_FC || l->kernel == K_SOFTMAX) {
+        job->out.width = job->out.height = 1;
+    }
+    job->out.extra = 1;
+
+    job->conv.in_offset = job->dw.in_offset = 128;
+    job->conv.out_offset = job->dw.out_offset = -128;
+    job->conv.stride = job->dw.stride = (data_2d_t) { l->stride, l->stride };
+    job->conv.padding = job->dw.padding = (data_2d_t) { job->pad_wd, job->pad_ht };
+    job->conv.dilation = job->dw.dilation = (data_2d_t) { 1, 1 };
+    job->conv.activation = job->dw.activation = (act_params_t) { -128, 127 };
+    job->dw.ch_mult = l->kernel == K_DEPTHWISE ? l->out_ch : 1;
+
+    size_t in_n = (size_t) l->in_wd * l->in_ht * l->in_ch;
+    size_t f_n = (size_t) l->f_wd * l->f_ht * l->in_ch * out_ch;
+    if (l->kernel == K_DEPTHWISE) {
+        f_n = (size_t) l->f_wd * l->f_ht * out_ch;
+    } else if (l->kernel == K_FC) {
+        f_n = (size_t) l->in_ch * out_ch;
+    } else if (l->kernel == K_DW_PW) {
+        f_n = (size_t) l->f_wd * l->f_ht * l->in_ch;
+    }
+    // K_DW_PW: beide Stufen teilen sich Bias und Quantisierung
+    size_t q_n = out_ch > l->in_ch ? out_ch : l->in_ch;
+    size_t out_n = (size_t) job->out.width * job->out.height * out_ch;
+    job->input = nn_buf_alloc(in_n, 0);
+    job->filter = nn_buf_alloc(f_n, 0);
+    job->output = nn_buf_alloc(out_n, 0);
+    job->bias = nn_buf_alloc(q_n * sizeof(int32_t), 0);
+    job->mult = nn_buf_alloc(q_n * sizeof(int32_t), 0);
+    job->shift = nn_buf_alloc(q_n * sizeof(int32_t), 0);
+    nn_fill_s8(rng, job->input, in_n, -128, 127);
+    nn_fill_s8(rng, job->filter, f_n, -127, 127);
+    nn_fill_s32(rng, job->bias, q_n, -(1 << 12), 1 << 12);
+    nn_fill_quant(rng, job->mult, job->shift, q_n, -9, -7);
+
+    if (l->kernel == K_CONV_ADD) {
+        job->skip = nn_buf_alloc(out_n, 0);
+        job->conv_out = nn_buf_alloc(out_n, 0);
+        nn_fill_s8(rng, job->skip, out_n, -128, 127);
+        nn_fill_quant(rng, &job->add.conv_mult, &job->add.conv_shift, 1, -1, -1);
+        nn_fill_quant(rng, &job->add.skip_mult, &job->add.skip_shift, 1, -2, -2);
+        nn_fill_quant(rng, &job->add.out_mult, &job->add.out_shift, 1, -19, -19);
+        job->add.conv_offset = 128;
+        job->add.skip_offset = 128;
+        job->add.out_offset = -128;
+        job->add.left_shift = 20;
+        job->add.activation = (act_params_t) { -128, 127 };
+    }
+
+    if (l->kernel == K_DW_PW) {
+        job->mid = (data_dims_t) { job->out.width, job->out.height, l->in_ch, 1 };
+        job->pw_filt = (data_dims_t) { 1, 1, l->in_ch, 1 };
+        size_t mid_n = (size_t) job->out.width * job->out.height * l->in_ch;
+        job->mid_out = nn_buf_alloc(mid_n, 0);
+        job->pw_filter = nn_buf_alloc((size_t) l->in_ch * out_ch, 0);
+        nn_fill_s8(rng, job->pw_filter, (size_t) l->in_ch * out_ch, -127, 127);
+        job->dw_pw.dw = job->dw;
+        job->dw_pw.dw_quant = (quant_data_t) { job->shift, job->mult };
+        job->dw_pw.pw = job->conv;
+        job->dw_pw.pw.stride = (data_2d_t) { 1, 1 };
+        job->dw_pw.pw.padding = (data_2d_t) { 0, 0 };
+        job->dw_pw.pw.in_offset = -job->dw.out_offset;
+        job->dw_pw.pw_quant = (quant_data_t) { job->shift, job->mult };
+        job->dw_pw.strip_ht = BENCH_STRIP_HT;
+    }
+
+    int scratch_n = 0;
+    if (l->kernel == K_DW_PW) {
+        // gefusioniert oder beide Stufen hintereinander (dw-Scratch vorne)
+        int dw_n = esp_nn_get_depthwise_conv_scratch_size(&job->in, &job->filt, &job->mid,
+                                                          &job->dw);
+        int pw_n = esp_nn_get_conv_scratch_size(&job->mid, &job->pw_filt, &job->out,
+                                                &job->dw_pw.pw);
+        int fused_n = esp_nn_get_dw_pw_conv_scratch_size(&job->in, &job->filt, &job->pw_filt,
+                                                         &job->out, &job->dw_pw);
+        scratch_n = ((dw_n + 15) & ~15) + pw_n;
+        scratch_n = fused_n > scratch_n ? fused_n : scratch_n;
+    } else if (l->kernel == K_CONV || l->kernel == K_CONV_ADD) {
+        scratch_n = esp_nn_get_conv_scratch_size(&job->in, &job->filt, &job->out, &job->conv);
+        esp_nn_conv_plan_create(&job->plan, &job->in, &job->filt, &job->out, &job->conv);
+        job->packed_n = esp_nn_get_conv_packed_filter_size(&job->plan);
+        if (job->packed_n > 0) {
+            job->packed = nn_buf_alloc(job->packed_n, 0);
+            esp_nn_conv_pack_filter(&job->plan, job->filter, job->bias, job->packed);
+            int packed_scratch_n = esp_nn_get_conv_packed_scratch_size(&job->plan);
+            scratch_n = packed_scratch_n > scratch_n ? packed_scratch_n : scratch_n;
+        }
+    } else if (l->kernel == K_DEPTHWISE) {
+        scratch_n = esp_nn_get_depthwise_conv_scratch_size(&job->in, &job->filt, &job->out,
+                                                           &job->dw);
+        esp_nn_depthwise_conv_plan_create(&job->dw_plan, &job->in, &job->filt, &job->out,
+                                          &job->dw);
+    } else if (l->kernel == K_FC) {
+        job->packed_n = esp_nn_get_fully_connected_plan_size(out_ch);
+        if (job->packed_n > 0) {
+            job->packed = nn_buf_alloc(job->packed_n, 0);
+            esp_nn_fully_connected_plan(job->filter, 128, l->in_ch, job->bias, out_ch,
+                                        job->packed);
+        }
+    } else if (l->kernel == K_SOFTMAX) {
+        scratch_n = esp_nn_get_softmax_scratch_size(l->in_ch, 1);
+    }
+    job->scratch = nn_buf_alloc(scratch_n > 0 ? scratch_n : 0, 0);
+}
+
+static void nn_job_free(nn_job_t *job)
+{
+    nn_buf_free(job->input);
+    nn_buf_free(job->filter);
+    nn_buf_free(job->output);
+    nn_buf_free(job->bias);
+    nn_buf_free(job->mult);
+    nn_buf_free(job->shift);
+    nn_buf_free(job->scratch);
+    nn_buf_free(job->skip);
+    nn_buf_free(job->conv_out);
+    nn_buf_free(job->mid_out);
+    nn_buf_free(job->pw_filter);
+    nn_buf_free(job->packed);
+}
+
+// Ein Aufruf des Kernels: opt = 0 _ansi, 1 über das Dispatch-Makro,
+// NN_RUN_PACKED mit vorgepackten Gewichten (K_CONV/K_CONV_ADD) bzw. der
+// Kanaltabelle (K_FC),
+// NN_RUN_SERIAL/NN_RUN_PARALLEL über den Plan auf job->ctx (nur
+// K_CONV/K_DEPTHWISE)
+#define NN_RUN_PACKED   2
+#define NN_RUN_SERIAL   3
+#define NN_RUN_PARALLEL 4
+
+static void nn_job_run(const nn_layer_t *l, nn_job_t *job, int opt)
+{
+    quant_data_t q = { job->shift, job->mult };
+    if (opt == NN_RUN_SERIAL || opt == NN_RUN_PARALLEL) {
+        if (l->kernel == K_DEPTHWISE) {
+            (opt == NN_RUN_PARALLEL ? esp_nn_depthwise_conv_s8_parallel
+                                    : esp_nn_depthwise_conv_s8_execute_ctx)(
+                &job->ctx, &job->dw_plan, job->input, job->filter, job->bias, job->output, &q);
+        } else {
+            (opt == NN_RUN_PARALLEL ? esp_nn_conv_s8_parallel : esp_nn_conv_s8_execute_ctx)(
+                &job->ctx, &job->plan, job->input, job->filter, job->bias, job->output, &q);
+        }
+        return;
+    }
+    if (opt == NN_RUN_PACKED) {
+        esp_nn_set_conv_packed_scratch_buf(job->scratch);
+        if (l->kernel == K_FC) {
+            esp_nn_fully_connected_per_ch_s8_planned(job->input, 128, l->in_ch, job->filter, 0,
+                                                     job->packed, job->output, l->out_ch, -128,
+                                                     job->shift, job->mult, -128, 127);
+        } else if (l->kernel == K_CONV_ADD) {
+            esp_nn_conv_add_s8_packed(&job->plan, job->input, job->packed, job->skip,
+                                      job->output, &q, &job->add);
+        } else {
+            esp_nn_conv_s8_packed(&job->plan, job->input, job->packed, job->output, &q);
+        }
+        return;
+    }
+    switch (l->kernel) {
+    case K_CONV:
+        if (opt) {
+            esp_nn_set_conv_scratch_buf(job->scratch);
+            esp_nn_conv_s8(&job->in, job->input, &job->filt, job->filter, job->bias,
+                           &job->out, job->output, &job->conv, &q);
+        } else {
+            esp_nn_conv_s8_ansi(&job->in, job->input, &job->filt, job->filter, job->bias,
+                                &job->out, job->output, &job->conv, &q);
+        }
+        break;
+    case K_DEPTHWISE:
+        if (opt) {
+            esp_nn_set_depthwise_conv_scratch_buf(job->scratch);
+            esp_nn_depthwise_conv_s8(&job->in, job->input, &job->filt, job->filter, job->bias,
+                                     &job->out, job->output, &job->dw, &q);
+        } else {
+            esp_nn_depthwise_conv_s8_ansi(&job->in, job->input, &job->filt, job->filter,
+                                          job->bias, &job->out, job->output, &job->dw, &q);
+        }
+        break;
+    case K_FC:
+        if (opt) {
+            esp_nn_fully_connected_per_ch_s8(job->input, 128, l->in_ch, job->filter, 0,
+                                             job->bias, job->output, l->out_ch, -128,
+                                             job->shift, job->mult, -128, 127);
+        } else {
+            esp_nn_fully_connected_per_ch_s8_ansi(job->input, 128, l->in_ch, job->filter, 0,
+                                                  job->bias, job->output, l->out_ch, -128,
+                                                  job->shift, job->mult, -128, 127);
+        }
+        break;
+    case K_AVG_POOL:
+        (opt ? esp_nn_avg_pool_s8 : esp_nn_avg_pool_s8_ansi)(
+            job->input, l->in_wd, l->in_ht, job->output, job->out.width, job->out.height,
+            l->stride, l->stride, l->f_wd, l->f_ht, job->pad_wd, job->pad_ht,
+            -128, 127, l->in_ch);
+        break;
+    case K_MAX_POOL:
+        (opt ? esp_nn_max_pool_s8 : esp_nn_max_pool_s8_ansi)(
+            job->input, l->in_wd, l->in_ht, job->output, job->out.width, job->out.height,
+            l->stride, l->stride, l->f_wd, l->f_ht, job->pad_wd, job->pad_ht,
+            -128, 127, l->in_ch);
+        break;
+    case K_SOFTMAX:
+        if (opt) {
+            esp_nn_set_softmax_scratch_buf(job->scratch);
+            esp_nn_softmax_s8(job->input, 1, l->in_ch, 1518500250, 22, -496, job->output);
+        } else {
+            esp_nn_softmax_s8_ansi(job->input, 1, l->in_ch, 1518500250, 22, -496, job->output);
+        }
+        break;
+    case K_CONV_ADD:
+        esp_nn_set_conv_scratch_buf(job->scratch);
+        if (opt) {
+            esp_nn_conv_add_s8(&job->in, job->input, &job->filt, job->filter, job->bias,
+                               job->skip, &job->out, job->output, &job->conv, &q, &job->add);
+        } else {
+            const conv_add_params_t *a = &job->add;
+            esp_nn_conv_s8(&job->in, job->input, &job->filt, job->filter, job->bias,
+                           &job->out, job->conv_out, &job->conv, &q);
+            esp_nn_add_elementwise_s8(job->conv_out, job->skip, a->conv_offset, a->skip_offset,
+                                      a->conv_mult, a->skip_mult, a->conv_shift, a->skip_shift,
+                                      a->left_shift, job->output, a->out_offset, a->out_mult,
+                                      a->out_shift, a->activation.min, a->activation.max,
+                                      job->out.width * job->out.height * job->out.channels);
+        }
+        break;
+    case K_DW_PW:
+        if (opt) {
+            esp_nn_set_dw_pw_conv_scratch_buf(job->scratch);
+            esp_nn_dw_pw_conv_s8(&job->in, job->input, &job->filt, job->filter, job->bias,
+                                 &job->pw_filt, job->pw_filter, job->bias, &job->out,
+                                 job->output, &job->dw_pw);
+        } else {
+            int dw_n = esp_nn_get_depthwise_conv_scratch_size(&job->in, &job->filt, &job->mid,
+                                                              &job->dw);
+            esp_nn_set_depthwise_conv_scratch_buf(job->scratch);
+            esp_nn_set_conv_scratch_buf((int8_t *) job->scratch + ((dw_n + 15) & ~15));
+            esp_nn_depthwise_conv_s8(&job->in, job->input, &job->filt, job->filter, job->bias,
+                                     &job->mid, job->mid_out, &job->dw, &q);
+            esp_nn_conv_s8(&job->mid, job->mid_out, &job->pw_filt, job->pw_filter, job->bias,
+                           &job->out, job->output, &job->dw_pw.pw, &q);
+        }
+        break;
+    }
+}
+
+// Mikrosekunden pro Aufruf: Minimum aus 5 Läufen von je mindestens min_ns
+static double nn_time_us(const nn_layer_t *l, nn_job_t *job, int opt, uint64_t min_ns)
+{
+    long reps = 1;
+    for (;;) {
+        uint64_t t0 = nn_now_ns();
+        for (long i = 0; i < reps; i++) {
+            nn_job_run(l, job, opt);
+        }
+        if (nn_now_ns() - t0 >= min_ns / 4 || reps >= (1L << 24)) {
+            break;
+        }
+        reps *= 2;
+    }
+    reps *= 4;
+
+    double best = 0;
+    for (int run = 0; run < 5; run++) {
+        uint64_t t0 = nn_now_ns();
+        for (long i = 0; i < reps; i++) {
+            nn_job_run(l, job, opt);
+        }
+        double us = (double)(nn_now_ns() - t0) / 1000.0 / (double) reps;
+        if (run == 0 || us < best) {
+            best = us;
+        }
+    }
+    return best;
+}
+
+// Workerzahl des Kostenmodells wie in conv_parallel_common.h
+static int nn_cost_bands(const nn_layer_t *l, const nn_job_t *job, int workers)
+{
+    int64_t macs = (int64_t) job->out.width * job->out.height * job->out.channels *
+                   job->filt.width * job->filt.height;
+    if (l->kernel == K_CONV) {
+        macs *= job->in.channels;
+    }
+    int bands = workers < job->out.height ? workers : job->out.height;
+    if (macs / ESP_NN_PARALLEL_MIN_MACS < bands) {
+        bands = (int) (macs / ESP_NN_PARALLEL_MIN_MACS);
+    }
+    return bands > 1 ? bands : 1;
+}
+
+static const char *nn_kernel_name(nn_kernel_t k)
+{
+    static const char *names[] = {
+        "conv_s8", "depthwise_conv_s8", "fully_connected_per_ch_s8",
+        "avg_pool_s8", "max_pool_s8", "softmax_s8", "conv_add_s8", "dw_pw_conv_s8",
+    };
+    return names[k];
+}
+
+static const char *nn_dispatch_name(nn_kernel_t k)
+{
+    static const char *names[] = {
+        NN_STR(esp_nn_conv_s8), NN_STR(esp_nn_depthwise_conv_s8),
+        NN_STR(esp_nn_fully_connected_per_ch_s8), NN_STR(esp_nn_avg_pool_s8),
+        NN_STR(esp_nn_max_pool_s8), NN_STR(esp_nn_softmax_s8),
+        NN_STR(esp_nn_conv_add_s8), NN_STR(esp_nn_dw_pw_conv_s8),
+    };
+    return names[k];
+}
+
+int main(int argc, char **argv)
+{
+    const char *model = NULL;
+    long min_ms = 20;
+    int packed = 0;
+    int workers = 0;
+    int opt;
+    while ((opt = getopt(argc, argv, "j:m:pt:")) != -1) {
+        switch (opt) {
+        case 'j':
+            workers = (int) strtol(optarg, NULL, 0);
+            break;
+        case 'm':
+            model = optarg;
+            break;
+        case 'p':
+            packed = 1;
+            break;
+        case 't':
+            min_ms = strtol(optarg, NULL, 0);
+            break;
+        default:
+            fprintf(stderr, "Aufruf: %s [-m MODELL] [-p | -j N] [-t MS]\n", argv[0]);
+            return 2;
+        }
+    }
+    esp_nn_pool_t *pool = NULL;
+    if (workers != 0) {
+        pool = esp_nn_pool_create(workers);
+        if (pool == NULL) {
+            fprintf(stderr, "-j: 1..%d Worker\n", ESP_NN_POOL_MAX_WORKERS);
+            return 2;
+        }
+    }
+
+    nn_rng_t rng;
+    nn_rng_seed(&rng, 1);
+    if (packed) {
+        printf("kernel,model,layer,shape,filter_bytes,packed_bytes,overhead,"
+               "opt_us,packed_us,speedup\n");
+    } else if (pool != NULL) {
+        printf("kernel,model,layer,shape,workers,serial_us,parallel_us,speedup,bands\n");
+    } else {
+        printf("kernel,model,layer,shape,ansi_us,opt_us,speedup,opt_fn\n");
+    }
+    for (size_t i = 0; i < sizeof(layers) / sizeof(layers[0]); i++) {
+        const nn_layer_t *l = &layers[i];
+        if (model != NULL && strcmp(model, l->model) != 0) {
+            continue;
+        }
+        if (packed && l->kernel != K_CONV && l->kernel != K_CONV_ADD && l->kernel != K_FC) {
+            continue;
+        }
+        if (pool != NULL && l->kernel != K_CONV && l->kernel != K_DEPTHWISE) {
+            continue;
+        }
+        nn_job_t job;
+        nn_job_init(&job, l, &rng);
+        if (packed) {
+            if (job.packed_n > 0) {
+                long filter_n = (l->kernel == K_FC ? 1L : (long) l->f_wd * l->f_ht) *
+                                l->in_ch * l->out_ch + (long) l->out_ch * sizeof(int32_t);
+                double opt_us = nn_time_us(l, &job, 1, (uint64_t) min_ms * 1000000);
+                double packed_us = nn_time_us(l, &job, NN_RUN_PACKED, (uint64_t) min_ms * 1000000);
+                printf("%s,%s,%s,%dx%dx%d>%dx%dx%d f%dx%d s%d,%ld,%d,%.3f,%.2f,%.2f,%.2f\n",
+                       nn_kernel_name(l->kernel), l->model, l->layer,
+                       l->in_wd, l->in_ht, l->in_ch,
+                       job.out.width, job.out.height, job.out.channels,
+                       l->f_wd, l->f_ht, l->stride, filter_n, job.packed_n,
+                       (double) job.packed_n / (double) filter_n, opt_us, packed_us,
+                       packed_us > 0 ? opt_us / packed_us : 0.0);
+                fflush(stdout);
+            }
+            nn_job_free(&job);
+            continue;
+        }
+        if (pool != NULL) {
+            int par_n = l->kernel == K_DEPTHWISE
+                        ? esp_nn_get_depthwise_conv_parallel_scratch_size(pool, &job.dw_plan)
+                        : esp_nn_get_conv_parallel_scratch_size(pool, &job.plan);
+            void *par_scratch = nn_buf_alloc(par_n > 0 ? par_n : 0, 0);
+            job.ctx = (esp_nn_ctx_t) {
+                .conv_scratch = par_scratch, .depthwise_scratch = par_scratch,
+                .pool = pool, .parallel_min_macs = -1
+            };
+            double serial_us = nn_time_us(l, &job, NN_RUN_SERIAL, (uint64_t) min_ms * 1000000);
+            double par_us = nn_time_us(l, &job, NN_RUN_PARALLEL, (uint64_t) min_ms * 1000000);
+            printf("%s,%s,%s,%dx%dx%d>%dx%dx%d f%dx%d s%d,%d,%.2f,%.2f,%.2f,%d\n",
+                   nn_kernel_name(l->kernel), l->model, l->layer,
+                   l->in_wd, l->in_ht, l->in_ch, job.out.width, job.out.height, job.out.channels,
+                   l->f_wd, l->f_ht, l->stride, workers, serial_us, par_us,
+                   par_us > 0 ? serial_us / par_us : 0.0, nn_cost_bands(l, &job, workers));
+            fflush(stdout);
+            nn_buf_free(par_scratch);
+            nn_job_free(&job);
+            continue;
+        }
+        double ansi_us = nn_time_us(l, &job, 0, (uint64_t) min_ms * 1000000);
+        double opt_us = nn_time_us(l, &job, 1, (uint64_t) min_ms * 1000000);
+        printf("%s,%s,%s,%dx%dx%d>%dx%dx%d f%dx%d s%d,%.2f,%.2f,%.2f,%s\n",
+               nn_kernel_name(l->kernel), l->model, l->layer,
+               l->in_wd, l->in_ht, l->in_ch, job.out.width, job.out.height, job.out.channels,
+               l->f_wd, l->f_ht, l->stride, ansi_us, opt_us,
+               opt_us > 0 ? ansi_us / opt_us : 0.0, nn_dispatch_name(l->kernel));
+        fflush(stdout);
+        nn_job_free(&job);
+    }
+    esp_nn_pool_destroy(pool);
+    return 0;
+}
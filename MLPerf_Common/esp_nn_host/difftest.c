@@ -0,0 +1,913 @@
+/*
+ * difftest.c
+ *
+ * Differenztest der ESP-NN-Kernel auf dem Host: jeder Kernel, den
+ * esp_nn_generic_opt.h für ESP32/ESP32-P4 auswählt, läuft mit zufälligen
+ * Formen, Offsets, Strides, Padding und Aktivierungsbereichen gegen seine
+ * _ansi-Referenz und muss bitgleich sein. Ausgabepuffer haben Schutzbytes
+ * gegen Schreiben über das Ende hinaus.
+ *
+ *   esp_nn_difftest [-n ITER] [-s SEED] [-v] [KERNEL ...]
+ *
+ * Ohne KERNEL laufen alle. Rückgabe 0 wenn alles gleich ist, sonst 1; die
+ * erste Abweichung je Kernel wird mit Parametern und Seed ausgegeben, damit
+ * sie sich mit -s/-n 1 nachstellen lässt.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "esp_nn_generic_opt.h"
+#include "nn_host.h"
+
+#define NN_STR_(x)  #x
+#define NN_STR(x)   NN_STR_(x)
+
+#define DESC_LEN    256
+
+// Kernel unter Test: 0 wenn gleich, sonst Beschreibung des Falls in desc
+typedef int (*nn_case_fn)(nn_rng_t *rng, char *desc);
+
+typedef struct {
+    const char *name;
+    const char *dut;    // Funktion hinter dem Dispatch-Makro
+    nn_case_fn run;
+} nn_case_t;
+
+// Vergleicht Referenz und Prüfling inklusive Schutzbytes
+static int nn_compare(const int8_t *ref, const int8_t *dut, size_t n, char *desc)
+{
+    size_t len = strlen(desc);
+    if (!nn_buf_check(dut)) {
+        snprintf(desc + len, DESC_LEN - len, " -> Schutzbytes überschrieben");
+        return 1;
+    }
+    long idx = nn_first_diff(ref, dut, n);
+    if (idx >= 0) {
+        snprintf(desc + len, DESC_LEN - len, " -> [%ld] ansi=%d opt=%d",
+                 idx, ref[idx], dut[idx]);
+        return 1;
+    }
+    return 0;
+}
+
+// Filtergröße: 1x1 und 3x3 häufiger, sonst 1..5 je Richtung
+static void nn_random_filter(nn_rng_t *rng, int32_t *wd, int32_t *ht)
+{
+    switch (nn_rng_range(rng, 0, 3)) {
+    case 0:
+        *wd = *ht = 1;
+        break;
+    case 1:
+        *wd = *ht = 3;
+        break;
+    default:
+        *wd = nn_rng_range(rng, 1, 5);
+        *ht = nn_rng_range(rng, 1, 5);
+        break;
+    }
+}
+
+// Kanalzahl: oft Vielfache von 4/8/16 wie in den Modellen, sonst beliebig
+static int32_t nn_random_channels(nn_rng_t *rng, int32_t max_ch)
+{
+    if (nn_rng_one_in(rng, 2)) {
+        int32_t step = 4 << nn_rng_range(rng, 0, 2);
+        return step * nn_rng_range(rng, 1, max_ch / step);
+    }
+    return nn_rng_range(rng, 1, max_ch);
+}
+
+// Eingangsgröße und Padding so, dass mindestens ein Ausgabepixel entsteht
+static void nn_random_spatial(nn_rng_t *rng, int32_t filter, int32_t stride,
+                              int32_t *in, int32_t *pad, int32_t *out)
+{
+    *in = nn_rng_range(rng, 1, 20);
+    *pad = nn_rng_range(rng, 0, filter / 2);
+    if (*in + 2 * *pad < filter) {
+        *in = filter;
+    }
+    *out = nn_out_size(*in, filter, stride, *pad);
+}
+
+// ===================================================================
+// FALTUNG
+// ===================================================================
+
+enum {
+    CONV_CALL,      // esp_nn_conv_s8
+    CONV_ADD,       // esp_nn_conv_add_s8, Referenz ist die ungefusionierte Folge
+    CONV_PLAN,      // esp_nn_conv_plan_create + esp_nn_conv_s8_execute
+    CONV_PACKED,    // esp_nn_conv_pack_filter + esp_nn_conv_s8_packed
+    CONV_ADD_PACKED,    // esp_nn_conv_pack_filter + esp_nn_conv_add_s8_packed
+    CONV_PARALLEL,  // esp_nn_conv_plan_create + esp_nn_conv_s8_parallel
+};
+
+// Die seriellen Fälle laufen zufällig auch über die _ctx-Einstiege: Scratch
+// nur im Kontext, der globale Puffer bleibt NULL
+static const char *nn_ctx_desc(int use_ctx)
+{
+    return use_ctx ? " (ctx)" : "";
+}
+
+// Pools der _parallel-Fälle, einer je Workerzahl, beim ersten Bedarf angelegt
+static esp_nn_pool_t *nn_pools[ESP_NN_POOL_MAX_WORKERS + 1];
+
+static esp_nn_pool_t *nn_pool(int workers)
+{
+    if (nn_pools[workers] == NULL) {
+        nn_pools[workers] = esp_nn_pool_create(workers);
+        if (nn_pools[workers] == NULL) {
+            fprintf(stderr, "esp_nn_pool_create(%d) fehlgeschlagen\n", workers);
+            exit(2);
+        }
+    }
+    return nn_pools[workers];
+}
+
+// Die _parallel-Fälle laufen auf 2..4 Workern, meist mit jeder Schicht
+// aufgeteilt (parallel_min_macs < 0), sonst mit dem Kostenmodell; jeder
+// vierte über die _ansi-Variante statt des Dispatch-Makros
+typedef struct {
+    esp_nn_pool_t *pool;
+    int32_t min_macs;
+    int ansi;
+} nn_par_t;
+
+static nn_par_t nn_random_par(nn_rng_t *rng, char *desc)
+{
+    nn_par_t par;
+    int workers = nn_rng_range(rng, 2, ESP_NN_POOL_MAX_WORKERS);
+    par.pool = nn_pool(workers);
+    par.min_macs = nn_rng_one_in(rng, 4) ? 0 : -1;
+    par.ansi = nn_rng_one_in(rng, 4);
+    size_t len = strlen(desc);
+    snprintf(desc + len, DESC_LEN - len, " par %d%s%s", workers,
+             par.min_macs < 0 ? "" : " kostenmodell", par.ansi ? " _ansi" : "");
+    return par;
+}
+
+static int run_conv(nn_rng_t *rng, char *desc, int mode)
+{
+    data_dims_t in = {0}, filt = {0}, out = {0};
+    conv_params_t p = {0};
+
+    in.channels = nn_random_channels(rng, 40);
+    out.channels = nn_random_channels(rng, 40);
+    nn_random_filter(rng, &filt.width, &filt.height);
+    p.stride.width = nn_rng_range(rng, 1, 3);
+    p.stride.height = nn_rng_range(rng, 1, 3);
+    if (nn_rng_one_in(rng, 3)) {
+        p.stride.height = p.stride.width = 1;
+    }
+    nn_random_spatial(rng, filt.width, p.stride.width, &in.width, &p.padding.width, &out.width);
+    nn_random_spatial(rng, filt.height, p.stride.height, &in.height, &p.padding.height, &out.height);
+    if (nn_rng_one_in(rng, 4) && in.width >= filt.width && in.height >= filt.height) {
+        p.padding.width = p.padding.height = 0;  // 1x1-Sonderfall von _opt
+        out.width = nn_out_size(in.width, filt.width, p.stride.width, 0);
+        out.height = nn_out_size(in.height, filt.height, p.stride.height, 0);
+    }
+    filt.channels = in.channels;
+    p.dilation.width = p.dilation.height = 1;
+    p.in_offset = nn_rng_range(rng, -127, 128);
+    p.out_offset = nn_rng_range(rng, -128, 127);
+    p.activation = nn_random_activation(rng);
+
+    size_t in_n = (size_t) in.width * in.height * in.channels;
+    size_t f_n = (size_t) filt.width * filt.height * in.channels * out.channels;
+    size_t out_n = (size_t) out.width * out.height * out.channels;
+    int8_t *input = nn_buf_alloc(in_n, nn_rng_range(rng, 0, 3));
+    int8_t *filter = nn_buf_alloc(f_n, nn_rng_range(rng, 0, 3));
+    int32_t *bias = nn_buf_alloc(out.channels * sizeof(int32_t), 0);
+    int32_t *mult = nn_buf_alloc(out.channels * sizeof(int32_t), 0);
+    int32_t *shift = nn_buf_alloc(out.channels * sizeof(int32_t), 0);
+    int8_t *ref = nn_buf_alloc(out_n, 0);
+    int8_t *dut = nn_buf_alloc(out_n, nn_rng_range(rng, 0, 3));
+    nn_fill_s8(rng, input, in_n, -128, 127);
+    nn_fill_s8(rng, filter, f_n, -127, 127);
+    nn_fill_s32(rng, bias, out.channels, -(1 << 16), 1 << 16);
+    nn_fill_quant(rng, mult, shift, out.channels, -10, 0);
+    const int32_t *b = nn_rng_one_in(rng, 8) ? NULL : bias;
+    quant_data_t q = { shift, mult };
+
+    // Add-Quantisierung wie TFLM: left_shift 20, Eingangsfaktoren <= 0.5
+    int8_t *skip = NULL;
+    conv_add_params_t add = {0};
+    const int with_add = mode == CONV_ADD || mode == CONV_ADD_PACKED;
+    if (with_add) {
+        skip = nn_buf_alloc(out_n, nn_rng_range(rng, 0, 3));
+        nn_fill_s8(rng, skip, out_n, -128, 127);
+        nn_fill_quant(rng, &add.conv_mult, &add.conv_shift, 1, -3, -1);
+        nn_fill_quant(rng, &add.skip_mult, &add.skip_shift, 1, -3, -1);
+        nn_fill_quant(rng, &add.out_mult, &add.out_shift, 1, -21, -17);
+        add.conv_offset = nn_rng_range(rng, -127, 128);
+        add.skip_offset = nn_rng_range(rng, -127, 128);
+        add.out_offset = nn_rng_range(rng, -128, 127);
+        add.left_shift = 20;
+        add.activation = nn_random_activation(rng);
+    }
+
+    const int use_ctx = mode != CONV_PARALLEL && nn_rng_one_in(rng, 2);
+    // conv + add mit Kontext: mal über den Plan, mal pro Aufruf
+    const int add_plan = mode == CONV_ADD && use_ctx && nn_rng_one_in(rng, 2);
+    snprintf(desc, DESC_LEN, "in %dx%dx%d f %dx%d out %dx%dx%d s %d/%d pad %d/%d "
+             "off %d/%d act %d..%d%s%s",
+             in.width, in.height, in.channels, filt.width, filt.height,
+             out.width, out.height, out.channels, p.stride.width, p.stride.height,
+             p.padding.width, p.padding.height, p.in_offset, p.out_offset,
+             p.activation.min, p.activation.max, b ? "" : " ohne bias", nn_ctx_desc(use_ctx));
+
+    conv_plan_t plan;
+    nn_par_t par = {0};
+    int scratch_n;
+    if (mode == CONV_PARALLEL) {
+        par = nn_random_par(rng, desc);
+        if (par.ansi) {
+            esp_nn_conv_plan_create_ansi(&plan, &in, &filt, &out, &p);
+            scratch_n = esp_nn_get_conv_parallel_scratch_size_ansi(par.pool, &plan);
+        } else {
+            esp_nn_conv_plan_create(&plan, &in, &filt, &out, &p);
+            scratch_n = esp_nn_get_conv_parallel_scratch_size(par.pool, &plan);
+        }
+    } else if ((mode == CONV_CALL || mode == CONV_ADD) && !add_plan) {
+        scratch_n = esp_nn_get_conv_scratch_size(&in, &filt, &out, &p);
+    } else {
+        scratch_n = esp_nn_conv_plan_create(&plan, &in, &filt, &out, &p);
+    }
+    void *packed = NULL;
+    if (mode == CONV_PACKED || mode == CONV_ADD_PACKED) {
+        // Alle Formen des Tests passen ins gepackte Layout (Filter <= 5 Zeilen)
+        packed = nn_buf_alloc(esp_nn_get_conv_packed_filter_size(&plan), 0);
+        esp_nn_conv_pack_filter(&plan, filter, b, packed);
+        scratch_n = esp_nn_get_conv_packed_scratch_size(&plan);
+    }
+    void *scratch = nn_buf_alloc(scratch_n > 0 ? scratch_n : 0, 0);
+    const esp_nn_ctx_t ctx = {
+        .conv_scratch = scratch, .pool = par.pool, .parallel_min_macs = par.min_macs
+    };
+    if (packed != NULL) {
+        // Filter und Bias nach dem Packen verwerfen: der Kernel liest nur packed
+        if (with_add) {
+            esp_nn_conv_add_s8_ansi(&in, input, &filt, filter, b, skip, &out, ref, &p, &q, &add);
+        } else {
+            esp_nn_conv_s8_ansi(&in, input, &filt, filter, b, &out, ref, &p, &q);
+        }
+        memset(filter, 0x5a, f_n);
+        memset(bias, 0x5a, out.channels * sizeof(int32_t));
+        memset(&p, 0x5a, sizeof(p));
+        if (use_ctx && with_add) {
+            esp_nn_conv_add_s8_packed_ctx(&ctx, &plan, input, packed, skip, dut, &q, &add);
+        } else if (use_ctx) {
+            esp_nn_conv_s8_packed_ctx(&ctx, &plan, input, packed, dut, &q);
+        } else {
+            esp_nn_set_conv_packed_scratch_buf(scratch);
+            if (with_add) {
+                esp_nn_conv_add_s8_packed(&plan, input, packed, skip, dut, &q, &add);
+            } else {
+                esp_nn_conv_s8_packed(&plan, input, packed, dut, &q);
+            }
+            esp_nn_set_conv_packed_scratch_buf(NULL);
+        }
+    } else if (mode == CONV_ADD) {
+        esp_nn_conv_add_s8_ansi(&in, input, &filt, filter, b, skip, &out, ref, &p, &q, &add);
+        if (add_plan) {
+            esp_nn_conv_add_s8_execute_ctx(&ctx, &plan, input, filter, b, skip, dut, &q, &add);
+        } else if (use_ctx) {
+            esp_nn_conv_add_s8_ctx(&ctx, &in, input, &filt, filter, b, skip, &out, dut, &p, &q,
+                                   &add);
+        } else {
+            esp_nn_set_conv_scratch_buf(scratch);
+            esp_nn_conv_add_s8(&in, input, &filt, filter, b, skip, &out, dut, &p, &q, &add);
+        }
+    } else if (mode == CONV_PLAN) {
+        // Parameter nach dem Planen überschreiben: execute darf nur den Plan lesen
+        esp_nn_conv_s8_ansi(&in, input, &filt, filter, b, &out, ref, &p, &q);
+        memset(&p, 0x5a, sizeof(p));
+        if (use_ctx) {
+            esp_nn_conv_s8_execute_ctx(&ctx, &plan, input, filter, b, dut, &q);
+        } else {
+            esp_nn_set_conv_scratch_buf(scratch);
+            esp_nn_conv_s8_execute(&plan, input, filter, b, dut, &q);
+        }
+    } else if (mode == CONV_PARALLEL) {
+        esp_nn_conv_s8_ansi(&in, input, &filt, filter, b, &out, ref, &p, &q);
+        memset(&p, 0x5a, sizeof(p));
+        if (par.ansi) {
+            esp_nn_conv_s8_parallel_ansi(&ctx, &plan, input, filter, b, dut, &q);
+        } else {
+            esp_nn_conv_s8_parallel(&ctx, &plan, input, filter, b, dut, &q);
+        }
+    } else {
+        esp_nn_conv_s8_ansi(&in, input, &filt, filter, b, &out, ref, &p, &q);
+        if (use_ctx) {
+            esp_nn_conv_s8_ctx(&ctx, &in, input, &filt, filter, b, &out, dut, &p, &q);
+        } else {
+            esp_nn_set_conv_scratch_buf(scratch);
+            esp_nn_conv_s8(&in, input, &filt, filter, b, &out, dut, &p, &q);
+        }
+    }
+    esp_nn_set_conv_scratch_buf(NULL);
+
+    int bad = nn_compare(ref, dut, out_n, desc);
+    if (!bad && !nn_buf_check(scratch)) {
+        strncat(desc, " -> scratch überschrieben", DESC_LEN - strlen(desc) - 1);
+        bad = 1;
+    }
+    if (!bad && packed != NULL && !nn_buf_check(packed)) {
+        strncat(desc, " -> packed überschrieben", DESC_LEN - strlen(desc) - 1);
+        bad = 1;
+    }
+    nn_buf_free(packed);
+    nn_buf_free(scratch);
+    nn_buf_free(skip);
+    nn_buf_free(input);
+    nn_buf_free(filter);
+    nn_buf_free(bias);
+    nn_buf_free(mult);
+    nn_buf_free(shift);
+    nn_buf_free(ref);
+    nn_buf_free(dut);
+    return bad;
+}
+
+static int case_conv(nn_rng_t *rng, char *desc)
+{
+    return run_conv(rng, desc, CONV_CALL);
+}
+
+static int case_conv_add(nn_rng_t *rng, char *desc)
+{
+    return run_conv(rng, desc, CONV_ADD);
+}
+
+static int case_conv_plan(nn_rng_t *rng, char *desc)
+{
+    return run_conv(rng, desc, CONV_PLAN);
+}
+
+static int case_conv_packed(nn_rng_t *rng, char *desc)
+{
+    return run_conv(rng, desc, CONV_PACKED);
+}
+
+static int case_conv_add_packed(nn_rng_t *rng, char *desc)
+{
+    return run_conv(rng, desc, CONV_ADD_PACKED);
+}
+
+static int case_conv_parallel(nn_rng_t *rng, char *desc)
+{
+    return run_conv(rng, desc, CONV_PARALLEL);
+}
+
+// plan = 1: esp_nn_depthwise_conv_plan_create + esp_nn_depthwise_conv_s8_execute,
+// plan = 2: esp_nn_depthwise_conv_plan_create + esp_nn_depthwise_conv_s8_parallel
+static int run_depthwise_conv(nn_rng_t *rng, char *desc, int plan)
+{
+    data_dims_t in = {0}, filt = {0}, out = {0};
+    dw_conv_params_t p = {0};
+
+    in.channels = nn_random_channels(rng, 48);
+    p.ch_mult = nn_rng_one_in(rng, 4) ? nn_rng_range(rng, 2, 4) : 1;
+    out.channels = in.channels * p.ch_mult;
+    nn_random_filter(rng, &filt.width, &filt.height);
+    p.stride.width = nn_rng_range(rng, 1, 2);
+    p.stride.height = nn_rng_one_in(rng, 4) ? nn_rng_range(rng, 1, 3) : p.stride.width;
+    nn_random_spatial(rng, filt.width, p.stride.width, &in.width, &p.padding.width, &out.width);
+    nn_random_spatial(rng, filt.height, p.stride.height, &in.height, &p.padding.height, &out.height);
+    filt.channels = in.channels;
+    p.dilation.width = p.dilation.height = 1;
+    p.in_offset = nn_rng_range(rng, -127, 128);
+    p.out_offset = nn_rng_range(rng, -128, 127);
+    p.activation = nn_random_activation(rng);
+
+    size_t in_n = (size_t) in.width * in.height * in.channels;
+    size_t f_n = (size_t) filt.width * filt.height * out.channels;
+    size_t out_n = (size_t) out.width * out.height * out.channels;
+    int8_t *input = nn_buf_alloc(in_n, nn_rng_range(rng, 0, 3));
+    int8_t *filter = nn_buf_alloc(f_n, nn_rng_range(rng, 0, 3));
+    int32_t *bias = nn_buf_alloc(out.channels * sizeof(int32_t), 0);
+    int32_t *mult = nn_buf_alloc(out.channels * sizeof(int32_t), 0);
+    int32_t *shift = nn_buf_alloc(out.channels * sizeof(int32_t), 0);
+    int8_t *ref = nn_buf_alloc(out_n, 0);
+    int8_t *dut = nn_buf_alloc(out_n, nn_rng_range(rng, 0, 3));
+    nn_fill_s8(rng, input, in_n, -128, 127);
+    nn_fill_s8(rng, filter, f_n, -127, 127);
+    nn_fill_s32(rng, bias, out.channels, -(1 << 16), 1 << 16);
+    nn_fill_quant(rng, mult, shift, out.channels, -8, 0);
+    const int32_t *b = nn_rng_one_in(rng, 8) ? NULL : bias;
+    quant_data_t q = { shift, mult };
+
+    const int use_ctx = plan != 2 && nn_rng_one_in(rng, 2);
+    snprintf(desc, DESC_LEN, "in %dx%dx%d mult %d f %dx%d out %dx%d s %d/%d pad %d/%d "
+             "off %d/%d act %d..%d%s%s",
+             in.width, in.height, in.channels, p.ch_mult, filt.width, filt.height,
+             out.width, out.height, p.stride.width, p.stride.height,
+             p.padding.width, p.padding.height, p.in_offset, p.out_offset,
+             p.activation.min, p.activation.max, b ? "" : " ohne bias", nn_ctx_desc(use_ctx));
+
+    esp_nn_depthwise_conv_s8_ansi(&in, input, &filt, filter, b, &out, ref, &p, &q);
+
+    dw_conv_plan_t dw_plan;
+    nn_par_t par = {0};
+    int scratch_n;
+    if (plan == 2) {
+        par = nn_random_par(rng, desc);
+        if (par.ansi) {
+            esp_nn_depthwise_conv_plan_create_ansi(&dw_plan, &in, &filt, &out, &p);
+            scratch_n = esp_nn_get_depthwise_conv_parallel_scratch_size_ansi(par.pool, &dw_plan);
+        } else {
+            esp_nn_depthwise_conv_plan_create(&dw_plan, &in, &filt, &out, &p);
+            scratch_n = esp_nn_get_depthwise_conv_parallel_scratch_size(par.pool, &dw_plan);
+        }
+    } else if (plan) {
+        scratch_n = esp_nn_depthwise_conv_plan_create(&dw_plan, &in, &filt, &out, &p);
+    } else {
+        scratch_n = esp_nn_get_depthwise_conv_scratch_size(&in, &filt, &out, &p);
+    }
+    void *scratch = nn_buf_alloc(scratch_n > 0 ? scratch_n : 0, 0);
+    const esp_nn_ctx_t ctx = {
+        .depthwise_scratch = scratch, .pool = par.pool, .parallel_min_macs = par.min_macs
+    };
+    if (plan == 2) {
+        memset(&p, 0x5a, sizeof(p));
+        if (par.ansi) {
+            esp_nn_depthwise_conv_s8_parallel_ansi(&ctx, &dw_plan, input, filter, b, dut, &q);
+        } else {
+            esp_nn_depthwise_conv_s8_parallel(&ctx, &dw_plan, input, filter, b, dut, &q);
+        }
+    } else if (use_ctx && plan) {
+        memset(&p, 0x5a, sizeof(p));
+        esp_nn_depthwise_conv_s8_execute_ctx(&ctx, &dw_plan, input, filter, b, dut, &q);
+    } else if (use_ctx) {
+        esp_nn_depthwise_conv_s8_ctx(&ctx, &in, input, &filt, filter, b, &out, dut, &p, &q);
+    } else if (plan) {
+        esp_nn_set_depthwise_conv_scratch_buf(scratch);
+        memset(&p, 0x5a, sizeof(p));
+        esp_nn_depthwise_conv_s8_execute(&dw_plan, input, filter, b, dut, &q);
+    } else {
+        esp_nn_set_depthwise_conv_scratch_buf(scratch);
+        esp_nn_depthwise_conv_s8(&in, input, &filt, filter, b, &out, dut, &p, &q);
+    }
+    esp_nn_set_depthwise_conv_scratch_buf(NULL);
+
+    int bad = nn_compare(ref, dut, out_n, desc);
+    if (!bad && !nn_buf_check(scratch)) {
+        strncat(desc, " -> scratch überschrieben", DESC_LEN - strlen(desc) - 1);
+        bad = 1;
+    }
+    nn_buf_free(scratch);
+    nn_buf_free(input);
+    nn_buf_free(filter);
+    nn_buf_free(bias);
+    nn_buf_free(mult);
+    nn_buf_free(shift);
+    nn_buf_free(ref);
+    nn_buf_free(dut);
+    return bad;
+}
+
+static int case_depthwise_conv(nn_rng_t *rng, char *desc)
+{
+    return run_depthwise_conv(rng, desc, 0);
+}
+
+static int case_depthwise_conv_plan(nn_rng_t *rng, char *desc)
+{
+    return run_depthwise_conv(rng, desc, 1);
+}
+
+static int case_depthwise_conv_parallel(nn_rng_t *rng, char *desc)
+{
+    return run_depthwise_conv(rng, desc, 2);
+}
+
+// Referenz ist die ungefusionierte Folge der _ansi-Kernel über einen vollen
+// Zwischentensor; geprüft werden die Dispatch-Variante und _ansi, beide mit
+// zufälliger Streifenhöhe
+static int case_dw_pw_conv(nn_rng_t *rng, char *desc)
+{
+    data_dims_t in = {0}, dw_filt = {0}, mid = {0}, pw_filt = {0}, out = {0};
+    dw_pw_conv_params_t p = {0};
+
+    in.channels = nn_random_channels(rng, 48);
+    p.dw.ch_mult = nn_rng_one_in(rng, 4) ? nn_rng_range(rng, 2, 4) : 1;
+    mid.channels = in.channels * p.dw.ch_mult;
+    out.channels = nn_random_channels(rng, 48);
+    nn_random_filter(rng, &dw_filt.width, &dw_filt.height);
+    p.dw.stride.width = nn_rng_range(rng, 1, 2);
+    p.dw.stride.height = nn_rng_one_in(rng, 4) ? nn_rng_range(rng, 1, 3) : p.dw.stride.width;
+    nn_random_spatial(rng, dw_filt.width, p.dw.stride.width, &in.width, &p.dw.padding.width,
+                      &mid.width);
+    nn_random_spatial(rng, dw_filt.height, p.dw.stride.height, &in.height, &p.dw.padding.height,
+                      &mid.height);
+    dw_filt.channels = in.channels;
+    pw_filt.width = pw_filt.height = 1;
+    pw_filt.channels = mid.channels;
+    out.width = mid.width;
+    out.height = mid.height;
+    p.dw.dilation.width = p.dw.dilation.height = 1;
+    p.dw.in_offset = nn_rng_range(rng, -127, 128);
+    p.dw.out_offset = nn_rng_range(rng, -128, 127);
+    p.dw.activation = nn_random_activation(rng);
+    p.pw.stride.width = p.pw.stride.height = 1;
+    p.pw.dilation.width = p.pw.dilation.height = 1;
+    p.pw.in_offset = -p.dw.out_offset;
+    p.pw.out_offset = nn_rng_range(rng, -128, 127);
+    p.pw.activation = nn_random_activation(rng);
+    p.strip_ht = nn_rng_range(rng, 0, mid.height + 1);
+
+    size_t in_n = (size_t) in.width * in.height * in.channels;
+    size_t dw_f_n = (size_t) dw_filt.width * dw_filt.height * mid.channels;
+    size_t mid_n = (size_t) mid.width * mid.height * mid.channels;
+    size_t pw_f_n = (size_t) mid.channels * out.channels;
+    size_t out_n = (size_t) out.width * out.height * out.channels;
+    int8_t *input = nn_buf_alloc(in_n, nn_rng_range(rng, 0, 3));
+    int8_t *dw_filter = nn_buf_alloc(dw_f_n, nn_rng_range(rng, 0, 3));
+    int8_t *pw_filter = nn_buf_alloc(pw_f_n, nn_rng_range(rng, 0, 3));
+    int32_t *dw_bias = nn_buf_alloc(mid.channels * sizeof(int32_t), 0);
+    int32_t *pw_bias = nn_buf_alloc(out.channels * sizeof(int32_t), 0);
+    int32_t *dw_mult = nn_buf_alloc(mid.channels * sizeof(int32_t), 0);
+    int32_t *dw_shift = nn_buf_alloc(mid.channels * sizeof(int32_t), 0);
+    int32_t *pw_mult = nn_buf_alloc(out.channels * sizeof(int32_t), 0);
+    int32_t *pw_shift = nn_buf_alloc(out.channels * sizeof(int32_t), 0);
+    int8_t *ref_mid = nn_buf_alloc(mid_n, 0);
+    int8_t *ref = nn_buf_alloc(out_n, 0);
+    int8_t *dut = nn_buf_alloc(out_n, nn_rng_range(rng, 0, 3));
+    int8_t *dut_ansi = nn_buf_alloc(out_n, 0);
+    nn_fill_s8(rng, input, in_n, -128, 127);
+    nn_fill_s8(rng, dw_filter, dw_f_n, -127, 127);
+    nn_fill_s8(rng, pw_filter, pw_f_n, -127, 127);
+    nn_fill_s32(rng, dw_bias, mid.channels, -(1 << 16), 1 << 16);
+    nn_fill_s32(rng, pw_bias, out.channels, -(1 << 16), 1 << 16);
+    nn_fill_quant(rng, dw_mult, dw_shift, mid.channels, -8, 0);
+    nn_fill_quant(rng, pw_mult, pw_shift, out.channels, -10, 0);
+    const int32_t *db = nn_rng_one_in(rng, 8) ? NULL : dw_bias;
+    const int32_t *pb = nn_rng_one_in(rng, 8) ? NULL : pw_bias;
+    p.dw_quant = (quant_data_t) { dw_shift, dw_mult };
+    p.pw_quant = (quant_data_t) { pw_shift, pw_mult };
+
+    const int use_ctx = nn_rng_one_in(rng, 2);
+    snprintf(desc, DESC_LEN, "in %dx%dx%d mult %d f %dx%d mid %dx%d out_ch %d s %d/%d "
+             "pad %d/%d streifen %d off %d/%d/%d%s",
+             in.width, in.height, in.channels, p.dw.ch_mult, dw_filt.width, dw_filt.height,
+             mid.width, mid.height, out.channels, p.dw.stride.width, p.dw.stride.height,
+             p.dw.padding.width, p.dw.padding.height, p.strip_ht,
+             p.dw.in_offset, p.dw.out_offset, p.pw.out_offset, nn_ctx_desc(use_ctx));
+
+    esp_nn_depthwise_conv_s8_ansi(&in, input, &dw_filt, dw_filter, db, &mid, ref_mid,
+                                  &p.dw, &p.dw_quant);
+    esp_nn_conv_s8_ansi(&mid, ref_mid, &pw_filt, pw_filter, pb, &out, ref, &p.pw, &p.pw_quant);
+
+    int scratch_n = esp_nn_get_dw_pw_conv_scratch_size(&in, &dw_filt, &pw_filt, &out, &p);
+    void *scratch = nn_buf_alloc(scratch_n > 0 ? scratch_n : 0, 0);
+    if (use_ctx) {
+        const esp_nn_ctx_t ctx = { .dw_pw_scratch = scratch };
+        esp_nn_dw_pw_conv_s8_ctx(&ctx, &in, input, &dw_filt, dw_filter, db, &pw_filt, pw_filter,
+                                 pb, &out, dut, &p);
+    } else {
+        esp_nn_set_dw_pw_conv_scratch_buf(scratch);
+        esp_nn_dw_pw_conv_s8(&in, input, &dw_filt, dw_filter, db, &pw_filt, pw_filter, pb,
+                             &out, dut, &p);
+        esp_nn_set_dw_pw_conv_scratch_buf(NULL);
+    }
+
+    int ansi_n = esp_nn_get_dw_pw_conv_scratch_size_ansi(&in, &dw_filt, &pw_filt, &out, &p);
+    void *ansi_scratch = nn_buf_alloc(ansi_n > 0 ? ansi_n : 0, 0);
+    esp_nn_set_dw_pw_conv_scratch_buf_ansi(ansi_scratch);
+    esp_nn_dw_pw_conv_s8_ansi(&in, input, &dw_filt, dw_filter, db, &pw_filt, pw_filter, pb,
+                              &out, dut_ansi, &p);
+    esp_nn_set_dw_pw_conv_scratch_buf_ansi(NULL);
+
+    int bad = nn_compare(ref, dut, out_n, desc);
+    if (!bad && !nn_buf_check(scratch)) {
+        strncat(desc, " -> scratch überschrieben", DESC_LEN - strlen(desc) - 1);
+        bad = 1;
+    }
+    if (!bad && (nn_compare(ref, dut_ansi, out_n, desc) || !nn_buf_check(ansi_scratch))) {
+        strncat(desc, " (_ansi)", DESC_LEN - strlen(desc) - 1);
+        bad = 1;
+    }
+    nn_buf_free(ansi_scratch);
+    nn_buf_free(scratch);
+    nn_buf_free(input);
+    nn_buf_free(dw_filter);
+    nn_buf_free(pw_filter);
+    nn_buf_free(dw_bias);
+    nn_buf_free(pw_bias);
+    nn_buf_free(dw_mult);
+    nn_buf_free(dw_shift);
+    nn_buf_free(pw_mult);
+    nn_buf_free(pw_shift);
+    nn_buf_free(ref_mid);
+    nn_buf_free(ref);
+    nn_buf_free(dut);
+    nn_buf_free(dut_ansi);
+    return bad;
+}
+
+// ===================================================================
+// FULLY CONNECTED
+// ===================================================================
+
+// planned: Tabelle aus esp_nn_fully_connected_plan, Kernel *_planned
+static int case_fully_connected_common(nn_rng_t *rng, char *desc, int per_ch, int planned)
+{
+    int32_t row_len = nn_rng_one_in(rng, 2) ? 16 * nn_rng_range(rng, 1, 40)
+                                             : nn_rng_range(rng, 1, 700);
+    int32_t out_ch = nn_rng_one_in(rng, 3) ? nn_rng_range(rng, 1, 12) : nn_random_channels(rng, 160);
+    int32_t in_offset = nn_rng_range(rng, -127, 128);
+    int32_t filter_offset = nn_rng_one_in(rng, 4) ? nn_rng_range(rng, -127, 128) : 0;
+    int32_t out_offset = nn_rng_range(rng, -128, 127);
+    act_params_t act = nn_random_activation(rng);
+
+    int8_t *input = nn_buf_alloc(row_len, nn_rng_range(rng, 0, 3));
+    int8_t *filter = nn_buf_alloc((size_t) row_len * out_ch, nn_rng_range(rng, 0, 3));
+    int32_t *bias = nn_buf_alloc(out_ch * sizeof(int32_t), 0);
+    int32_t *mult = nn_buf_alloc(out_ch * sizeof(int32_t), 0);
+    int32_t *shift = nn_buf_alloc(out_ch * sizeof(int32_t), 0);
+    int8_t *ref = nn_buf_alloc(out_ch, 0);
+    int8_t *dut = nn_buf_alloc(out_ch, nn_rng_range(rng, 0, 3));
+    nn_fill_s8(rng, input, row_len, -128, 127);
+    nn_fill_s8(rng, filter, (size_t) row_len * out_ch, -127, 127);
+    nn_fill_s32(rng, bias, out_ch, -(1 << 16), 1 << 16);
+    nn_fill_quant(rng, mult, shift, out_ch, -12, 0);
+    const int32_t *b = nn_rng_one_in(rng, 8) ? NULL : bias;
+    int32_t *row_term = NULL;
+    if (planned) {
+        row_term = nn_buf_alloc(esp_nn_get_fully_connected_plan_size(out_ch), 0);
+        esp_nn_fully_connected_plan(filter, in_offset, row_len, b, out_ch, row_term);
+    }
+
+    snprintf(desc, DESC_LEN, "row %d out %d off %d/%d/%d act %d..%d%s",
+             row_len, out_ch, in_offset, filter_offset, out_offset,
+             act.min, act.max, b ? "" : " ohne bias");
+
+    if (per_ch) {
+        esp_nn_fully_connected_per_ch_s8_ansi(input, in_offset, row_len, filter, filter_offset,
+                                              b, ref, out_ch, out_offset, shift, mult,
+                                              act.min, act.max);
+    } else {
+        esp_nn_fully_connected_s8_ansi(input, in_offset, row_len, filter, filter_offset,
+                                       b, ref, out_ch, out_offset, shift[0], mult[0],
+                                       act.min, act.max);
+    }
+    if (per_ch && planned) {
+        esp_nn_fully_connected_per_ch_s8_planned(input, in_offset, row_len, filter, filter_offset,
+                                                 row_term, dut, out_ch, out_offset, shift, mult,
+                                                 act.min, act.max);
+    } else if (per_ch) {
+        esp_nn_fully_connected_per_ch_s8(input, in_offset, row_len, filter, filter_offset,
+                                         b, dut, out_ch, out_offset, shift, mult,
+                                         act.min, act.max);
+    } else if (planned) {
+        esp_nn_fully_connected_s8_planned(input, in_offset, row_len, filter, filter_offset,
+                                          row_term, dut, out_ch, out_offset, shift[0], mult[0],
+                                          act.min, act.max);
+    } else {
+        esp_nn_fully_connected_s8(input, in_offset, row_len, filter, filter_offset,
+                                  b, dut, out_ch, out_offset, shift[0], mult[0],
+                                  act.min, act.max);
+    }
+
+    int bad = nn_compare(ref, dut, out_ch, desc);
+    nn_buf_free(input);
+    nn_buf_free(filter);
+    nn_buf_free(bias);
+    nn_buf_free(mult);
+    nn_buf_free(shift);
+    nn_buf_free(ref);
+    nn_buf_free(dut);
+    if (row_term) {
+        nn_buf_free(row_term);
+    }
+    return bad;
+}
+
+static int case_fully_connected(nn_rng_t *rng, char *desc)
+{
+    return case_fully_connected_common(rng, desc, 0, 0);
+}
+
+static int case_fully_connected_per_ch(nn_rng_t *rng, char *desc)
+{
+    return case_fully_connected_common(rng, desc, 1, 0);
+}
+
+static int case_fully_connected_planned(nn_rng_t *rng, char *desc)
+{
+    return case_fully_connected_common(rng, desc, nn_rng_one_in(rng, 2), 1);
+}
+
+// ===================================================================
+// POOLING
+// ===================================================================
+
+typedef void (*nn_pool_fn)(const int8_t *, const uint16_t, const uint16_t, int8_t *,
+                           const uint16_t, const uint16_t, const uint16_t, const uint16_t,
+                           const uint16_t, const uint16_t, const uint16_t, const uint16_t,
+                           const int32_t, const int32_t, const uint16_t);
+
+static int case_pool_common(nn_rng_t *rng, char *desc, nn_pool_fn ref_fn, nn_pool_fn dut_fn)
+{
+    int32_t ch = nn_random_channels(rng, 64);
+    int32_t in_wd, in_ht, f_wd, f_ht, s_wd, s_ht, pad_wd, pad_ht, out_wd, out_ht;
+
+    if (nn_rng_one_in(rng, 4)) {
+        // globales Pooling wie am Ende von IC01/KWS01/VWW01
+        in_wd = f_wd = nn_rng_range(rng, 1, 12);
+        in_ht = f_ht = nn_rng_range(rng, 1, 25);
+        s_wd = s_ht = 1;
+        pad_wd = pad_ht = 0;
+        out_wd = out_ht = 1;
+    } else {
+        f_wd = nn_rng_range(rng, 1, 4);
+        f_ht = nn_rng_one_in(rng, 2) ? f_wd : nn_rng_range(rng, 1, 4);
+        s_wd = nn_rng_range(rng, 1, 3);
+        s_ht = nn_rng_one_in(rng, 2) ? s_wd : nn_rng_range(rng, 1, 3);
+        nn_random_spatial(rng, f_wd, s_wd, &in_wd, &pad_wd, &out_wd);
+        nn_random_spatial(rng, f_ht, s_ht, &in_ht, &pad_ht, &out_ht);
+    }
+    act_params_t act = nn_random_activation(rng);
+
+    size_t in_n = (size_t) in_wd * in_ht * ch;
+    size_t out_n = (size_t) out_wd * out_ht * ch;
+    int8_t *input = nn_buf_alloc(in_n, nn_rng_range(rng, 0, 3));
+    int8_t *ref = nn_buf_alloc(out_n, 0);
+    int8_t *dut = nn_buf_alloc(out_n, nn_rng_range(rng, 0, 3));
+    nn_fill_s8(rng, input, in_n, -128, 127);
+
+    snprintf(desc, DESC_LEN, "in %dx%dx%d f %dx%d out %dx%d s %d/%d pad %d/%d act %d..%d",
+             in_wd, in_ht, ch, f_wd, f_ht, out_wd, out_ht, s_wd, s_ht, pad_wd, pad_ht,
+             act.min, act.max);
+
+    ref_fn(input, in_wd, in_ht, ref, out_wd, out_ht, s_wd, s_ht, f_wd, f_ht,
+           pad_wd, pad_ht, act.min, act.max, ch);
+    dut_fn(input, in_wd, in_ht, dut, out_wd, out_ht, s_wd, s_ht, f_wd, f_ht,
+           pad_wd, pad_ht, act.min, act.max, ch);
+
+    int bad = nn_compare(ref, dut, out_n, desc);
+    nn_buf_free(input);
+    nn_buf_free(ref);
+    nn_buf_free(dut);
+    return bad;
+}
+
+static int case_avg_pool(nn_rng_t *rng, char *desc)
+{
+    return case_pool_common(rng, desc, esp_nn_avg_pool_s8_ansi, esp_nn_avg_pool_s8);
+}
+
+static int case_max_pool(nn_rng_t *rng, char *desc)
+{
+    return case_pool_common(rng, desc, esp_nn_max_pool_s8_ansi, esp_nn_max_pool_s8);
+}
+
+// ===================================================================
+// SOFTMAX
+// ===================================================================
+
+static int case_softmax(nn_rng_t *rng, char *desc)
+{
+    int32_t height = nn_rng_range(rng, 1, 8);
+    int32_t width = nn_rng_one_in(rng, 2) ? nn_rng_range(rng, 1, 12) : nn_rng_range(rng, 1, 300);
+    // Parameter wie tflite::PreprocessSoftmaxScaling mit 5 Integer-Bits:
+    // Multiplikator > 1, Shift >= 0, diff_min = -CalculateInputRadius()
+    int32_t mult = nn_rng_range(rng, 1 << 30, INT32_MAX);
+    int32_t shift = nn_rng_range(rng, 14, 26);
+    int64_t radius = ((int64_t) 31 << 26) >> shift;
+    int32_t diff_min = nn_rng_one_in(rng, 4) ? -128 : (int32_t) -radius;
+
+    size_t n = (size_t) width * height;
+    int8_t *input = nn_buf_alloc(n, nn_rng_range(rng, 0, 3));
+    int8_t *ref = nn_buf_alloc(n, 0);
+    int8_t *dut = nn_buf_alloc(n, nn_rng_range(rng, 0, 3));
+    nn_fill_s8(rng, input, n, -128, 127);
+
+    const int use_ctx = nn_rng_one_in(rng, 2);
+    snprintf(desc, DESC_LEN, "%dx%d mult %d shift %d diff_min %d%s",
+             height, width, mult, shift, diff_min, nn_ctx_desc(use_ctx));
+
+    int32_t ref_scratch_n = esp_nn_get_softmax_scratch_size_ansi(width, height);
+    void *ref_scratch = nn_buf_alloc(ref_scratch_n > 0 ? ref_scratch_n : 0, 0);
+    esp_nn_set_softmax_scratch_buf_ansi(ref_scratch);
+    esp_nn_softmax_s8_ansi(input, height, width, mult, shift, diff_min, ref);
+
+    int32_t scratch_n = esp_nn_get_softmax_scratch_size(width, height);
+    void *scratch = nn_buf_alloc(scratch_n > 0 ? scratch_n : 0, 0);
+    if (use_ctx) {
+        const esp_nn_ctx_t ctx = { .softmax_scratch = scratch };
+        esp_nn_softmax_s8_ctx(&ctx, input, height, width, mult, shift, diff_min, dut);
+    } else {
+        esp_nn_set_softmax_scratch_buf(scratch);
+        esp_nn_softmax_s8(input, height, width, mult, shift, diff_min, dut);
+        esp_nn_set_softmax_scratch_buf(NULL);
+    }
+
+    int bad = nn_compare(ref, dut, n, desc);
+    if (!bad && !nn_buf_check(scratch)) {
+        strncat(desc, " -> scratch überschrieben", DESC_LEN - strlen(desc) - 1);
+        bad = 1;
+    }
+    nn_buf_free(ref_scratch);
+    nn_buf_free(scratch);
+    nn_buf_free(input);
+    nn_buf_free(ref);
+    nn_buf_free(dut);
+    return bad;
+}
+
+// ===================================================================
+// ABLAUF
+// ===================================================================
+
+static const nn_case_t cases[] = {
+    { "conv_s8", NN_STR(esp_nn_conv_s8), case_conv },
+    { "conv_add_s8", NN_STR(esp_nn_conv_add_s8), case_conv_add },
+    { "conv_plan", NN_STR(esp_nn_conv_s8_execute), case_conv_plan },
+    { "conv_packed", NN_STR(esp_nn_conv_s8_packed), case_conv_packed },
+    { "conv_add_packed", NN_STR(esp_nn_conv_add_s8_packed), case_conv_add_packed },
+    { "conv_parallel", NN_STR(esp_nn_conv_s8_parallel), case_conv_parallel },
+    { "depthwise_conv_s8", NN_STR(esp_nn_depthwise_conv_s8), case_depthwise_conv },
+    { "depthwise_conv_plan", NN_STR(esp_nn_depthwise_conv_s8_execute), case_depthwise_conv_plan },
+    { "depthwise_conv_parallel", NN_STR(esp_nn_depthwise_conv_s8_parallel),
+      case_depthwise_conv_parallel },
+    { "dw_pw_conv_s8", NN_STR(esp_nn_dw_pw_conv_s8), case_dw_pw_conv },
+    { "fully_connected_s8", NN_STR(esp_nn_fully_connected_s8), case_fully_connected },
+    { "fully_connected_per_ch_s8", NN_STR(esp_nn_fully_connected_per_ch_s8),
+      case_fully_connected_per_ch },
+    { "fully_connected_planned", NN_STR(esp_nn_fully_connected_per_ch_s8_planned),
+      case_fully_connected_planned },
+    { "avg_pool_s8", NN_STR(esp_nn_avg_pool_s8), case_avg_pool },
+    { "max_pool_s8", NN_STR(esp_nn_max_pool_s8), case_max_pool },
+    { "softmax_s8", NN_STR(esp_nn_softmax_s8), case_softmax },
+};
+
+static int selected(const char *name, int argc, char **argv)
+{
+    if (argc == 0) {
+        return 1;
+    }
+    for (int i = 0; i < argc; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    long iterations = 500;
+    uint32_t seed = 1;
+    int verbose = 0;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:v")) != -1) {
+        switch (opt) {
+        case 'n':
+            iterations = strtol(optarg, NULL, 0);
+            break;
+        case 's':
+            seed = (uint32_t) strtoul(optarg, NULL, 0);
+            break;
+        case 'v':
+            verbose = 1;
+            break;
+        default:
+            fprintf(stderr, "Aufruf: %s [-n ITER] [-s SEED] [-v] [KERNEL ...]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    int failed = 0;
+    char desc[DESC_LEN];
+    for (size_t k = 0; k < sizeof(cases) / sizeof(cases[0]); k++) {
+        const nn_case_t *c = &cases[k];
+        if (!selected(c->name, argc - optind, argv + optind)) {
+            continue;
+        }
+        long bad = 0;
+        for (long i = 0; i < iterations; i++) {
+            // eigener Seed je Fall, damit -s SEED -n 1 genau ihn wiederholt
+            nn_rng_t rng;
+            uint32_t case_seed = seed + (uint32_t) i;
+            nn_rng_seed(&rng, case_seed * 0x9E3779B1u + (uint32_t) k);
+            desc[0] = '\0';
+            int res = c->run(&rng, desc);
+            if (res && bad++ == 0) {
+                printf("FEHLER %s (-s %u): %s\n", c->name, case_seed, desc);
+            } else if (verbose) {
+                printf("  %s: %s%s\n", c->name, desc, res ? "" : " ok");
+            }
+        }
+        printf("%-26s %-40s %ld/%ld %s\n", c->name, c->dut, iterations - bad, iterations,
+               bad ? "ABWEICHUNG" : "ok");
+        failed |= bad != 0;
+    }
+    for (int w = 0; w <= ESP_NN_POOL_MAX_WORKERS; w++) {
+        esp_nn_pool_destroy(nn_pools[w]);
+    }
+    return failed;
+}
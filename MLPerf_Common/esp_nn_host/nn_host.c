@@ -0,0 +1,176 @@
+/*
+ * nn_host.c
+ *
+ * Hilfen für den Host-Build von ESP-NN (siehe nn_host.h).
+ */
+
+#include "nn_host.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// ===================================================================
+// ZUFALL
+// ===================================================================
+
+void nn_rng_seed(nn_rng_t *rng, uint32_t seed)
+{
+    rng->state = seed ? seed : 0x9E3779B9u;  // 0 ist ein Fixpunkt von xorshift
+}
+
+uint32_t nn_rng_next(nn_rng_t *rng)
+{
+    uint32_t x = rng->state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    rng->state = x;
+    return x;
+}
+
+int32_t nn_rng_range(nn_rng_t *rng, int32_t lo, int32_t hi)
+{
+    uint32_t span = (uint32_t)(hi - lo) + 1;
+    if (span == 0) {
+        return (int32_t) nn_rng_next(rng);  // voller 32-Bit-Bereich
+    }
+    return lo + (int32_t)(nn_rng_next(rng) % span);
+}
+
+int nn_rng_one_in(nn_rng_t *rng, int n)
+{
+    return nn_rng_next(rng) % (uint32_t) n == 0;
+}
+
+void nn_fill_s8(nn_rng_t *rng, int8_t *dst, size_t n, int32_t lo, int32_t hi)
+{
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = (int8_t) nn_rng_range(rng, lo, hi);
+    }
+}
+
+void nn_fill_s32(nn_rng_t *rng, int32_t *dst, size_t n, int32_t lo, int32_t hi)
+{
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = nn_rng_range(rng, lo, hi);
+    }
+}
+
+// ===================================================================
+// PUFFER
+// ===================================================================
+
+#define NN_GUARD        16
+#define NN_GUARD_BYTE   0xA5
+
+typedef struct {
+    void *base;
+    size_t bytes;
+} nn_buf_hdr_t;
+
+void *nn_buf_alloc(size_t bytes, size_t misalign)
+{
+    misalign %= 16;
+    uint8_t *base = malloc(sizeof(nn_buf_hdr_t) + NN_GUARD + 15 + misalign + bytes + NN_GUARD);
+    if (base == NULL) {
+        fprintf(stderr, "nn_buf_alloc: %zu Byte nicht verfügbar\n", bytes);
+        exit(2);
+    }
+    uintptr_t aligned = ((uintptr_t)(base + sizeof(nn_buf_hdr_t) + NN_GUARD) + 15) & ~(uintptr_t) 15;
+    uint8_t *data = (uint8_t *) aligned + misalign;
+
+    nn_buf_hdr_t hdr = { base, bytes };
+    memcpy(data - NN_GUARD - sizeof(hdr), &hdr, sizeof(hdr));
+    memset(data - NN_GUARD, NN_GUARD_BYTE, NN_GUARD);
+    memset(data, 0, bytes);
+    memset(data + bytes, NN_GUARD_BYTE, NN_GUARD);
+    return data;
+}
+
+static nn_buf_hdr_t nn_buf_hdr(const void *buf)
+{
+    nn_buf_hdr_t hdr;
+    memcpy(&hdr, (const uint8_t *) buf - NN_GUARD - sizeof(hdr), sizeof(hdr));
+    return hdr;
+}
+
+int nn_buf_check(const void *buf)
+{
+    const uint8_t *data = buf;
+    size_t bytes = nn_buf_hdr(buf).bytes;
+    for (int i = 0; i < NN_GUARD; i++) {
+        if (data[-1 - i] != NN_GUARD_BYTE || data[bytes + i] != NN_GUARD_BYTE) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void nn_buf_free(void *buf)
+{
+    if (buf != NULL) {
+        free(nn_buf_hdr(buf).base);
+    }
+}
+
+long nn_first_diff(const int8_t *a, const int8_t *b, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        if (a[i] != b[i]) {
+            return (long) i;
+        }
+    }
+    return -1;
+}
+
+// ===================================================================
+// QUANTISIERUNG
+// ===================================================================
+
+void nn_fill_quant(nn_rng_t *rng, int32_t *mult, int32_t *shift, int n,
+                   int32_t shift_min, int32_t shift_max)
+{
+    for (int i = 0; i < n; i++) {
+        mult[i] = nn_rng_range(rng, 1 << 30, INT32_MAX);
+        shift[i] = nn_rng_range(rng, shift_min, shift_max);
+    }
+}
+
+act_params_t nn_random_activation(nn_rng_t *rng)
+{
+    act_params_t act = { -128, 127 };
+    switch (nn_rng_range(rng, 0, 5)) {
+    case 0:  // ReLU mit Nullpunkt im Bereich
+        act.min = nn_rng_range(rng, -128, 0);
+        break;
+    case 1:  // ReLU6-artig
+        act.min = nn_rng_range(rng, -128, 0);
+        act.max = nn_rng_range(rng, act.min, 127);
+        break;
+    case 2:  // beliebiges Fenster
+        act.min = nn_rng_range(rng, -128, 127);
+        act.max = nn_rng_range(rng, act.min, 127);
+        break;
+    default:
+        break;
+    }
+    return act;
+}
+
+int32_t nn_out_size(int32_t in, int32_t filter, int32_t stride, int32_t pad)
+{
+    return (in + 2 * pad - filter) / stride + 1;
+}
+
+// ===================================================================
+// ZEIT
+// ===================================================================
+
+uint64_t nn_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ull + (uint64_t) ts.tv_nsec;
+}
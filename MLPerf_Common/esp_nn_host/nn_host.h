@@ -0,0 +1,71 @@
+/*
+ * nn_host.h
+ *
+ * Hilfen für den Host-Build von ESP-NN (esp_nn_difftest, esp_nn_bench):
+ * reproduzierbarer Zufall, Puffer mit Schutzbytes, Zeitmessung und
+ * Quantisierungsparameter wie sie TFLM erzeugt.
+ */
+
+#ifndef NN_HOST_H_
+#define NN_HOST_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_nn_defs.h"
+
+// ===================================================================
+// ZUFALL (xorshift32, unabhängig von rand() der libc)
+// ===================================================================
+
+typedef struct {
+    uint32_t state;
+} nn_rng_t;
+
+void nn_rng_seed(nn_rng_t *rng, uint32_t seed);
+uint32_t nn_rng_next(nn_rng_t *rng);
+// Gleichverteilt in [lo, hi]
+int32_t nn_rng_range(nn_rng_t *rng, int32_t lo, int32_t hi);
+// true mit Wahrscheinlichkeit 1/n
+int nn_rng_one_in(nn_rng_t *rng, int n);
+
+void nn_fill_s8(nn_rng_t *rng, int8_t *dst, size_t n, int32_t lo, int32_t hi);
+void nn_fill_s32(nn_rng_t *rng, int32_t *dst, size_t n, int32_t lo, int32_t hi);
+
+// ===================================================================
+// PUFFER
+// ===================================================================
+
+// Liefert `bytes` nutzbare Bytes, deren Anfang um `misalign` Bytes von einer
+// 16-Byte-Grenze abweicht. Davor und dahinter liegen Schutzbytes, die
+// nn_buf_check() auf Überschreiben prüft. Freigeben mit nn_buf_free().
+void *nn_buf_alloc(size_t bytes, size_t misalign);
+int nn_buf_check(const void *buf);
+void nn_buf_free(void *buf);
+
+// Index des ersten Unterschieds, -1 wenn gleich
+long nn_first_diff(const int8_t *a, const int8_t *b, size_t n);
+
+// ===================================================================
+// QUANTISIERUNG
+// ===================================================================
+
+// Multiplikator in [2^30, 2^31) und Shift in [shift_min, shift_max] pro Kanal
+void nn_fill_quant(nn_rng_t *rng, int32_t *mult, int32_t *shift, int n,
+                   int32_t shift_min, int32_t shift_max);
+
+// Aktivierungsbereich: meist voll (-128..127), sonst ReLU/ReLU6-artig
+// oder ein zufälliges Fenster
+act_params_t nn_random_activation(nn_rng_t *rng);
+
+// Ausgabegröße einer Faltung/Pooling-Stufe mit Padding vorne
+int32_t nn_out_size(int32_t in, int32_t filter, int32_t stride, int32_t pad);
+
+// ===================================================================
+// ZEIT
+// ===================================================================
+
+// CLOCK_MONOTONIC in Nanosekunden
+uint64_t nn_now_ns(void);
+
+#endif  // NN_HOST_H_
@@ -0,0 +1,16 @@
+/*
+ * main.cpp
+ *
+ * Host-Build: gleiche Schleife wie auf den Boards, stdin statt UART/USB.
+ *   printf 'name%%profile%%' | ./mlperf_core_posix
+ */
+
+#include "internally_implemented.h"
+#include "submitter_implemented.h"
+
+int main() {
+  ee_benchmark_initialize();
+  for (;;) {
+    ee_serial_callback(th_getchar());
+  }
+}
@@ -0,0 +1,34 @@
+/*
+Copyright 2020 EEMBC and The MLPerf Authors. All Rights Reserved.
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+    http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+/// \file
+/// \brief Host (POSIX) build of the shared core.
+/// \detail Runs the command parser and th_core.cpp on a PC with a stub
+/// model (submitter_stub.cpp), so the protocol can be checked without a
+/// board: stdin/stdout replace the serial port.
+
+#ifndef MLPERF_TINY_V0_1_API_SUBMITTER_IMPLEMENTED_H_
+#define MLPERF_TINY_V0_1_API_SUBMITTER_IMPLEMENTED_H_
+
+#define EE_MSG_TIMESTAMP "m-lap-us-%lu\r\n"
+#define TH_VENDOR_NAME_STRING "posix"
+
+#define MAX_DB_INPUT_SIZE (96 * 96 * 3)
+
+#ifndef TH_MODEL_VERSION
+#define TH_MODEL_VERSION EE_MODEL_VERSION_KWS01
+#endif
+
+// Flags shared by all boards and the th_ prototypes
+#include "th_api.h"
+
+#endif  // MLPERF_TINY_V0_1_API_SUBMITTER_IMPLEMENTED_H_
@@ -0,0 +1,112 @@
+/*
+ * submitter_stub.cpp
+ *
+ * Modellseite für den Host-Build ohne TFLM: th_infer() rechnet statt eines
+ * Netzes eine Prüfsumme über den geladenen Puffer und leitet daraus
+ * deterministische "Scores" ab. Damit lassen sich Parser, db-Befehle,
+ * infer-Schleife, Timestamps und m-summary auf dem PC prüfen.
+ */
+
+#include "submitter_implemented.h"
+#include "internally_implemented.h"
+#include "th_hal.h"
+#include "th_stats.h"
+
+#include <stdint.h>
+#if TH_MODEL_LZ
+  #include "model_lz.h"
+  #include "model_lz_data.h"
+#endif
+#if TH_MODEL_STORE
+  #include "model_store.h"
+#endif
+
+namespace {
+constexpr size_t kStubOutputs = 4;
+constexpr size_t kStubArenaSize = 16 * 1024;
+
+uint8_t input[MAX_DB_INPUT_SIZE];
+size_t input_bytes = 0;
+uint32_t checksum = 0;
+uint8_t* arena = nullptr;
+const char* arena_location = "none";
+} // namespace
+
+void th_load_tensor() {
+  input_bytes = ee_get_buffer(input, sizeof(input));
+}
+
+void th_infer() {
+#if TH_SUMMARY
+  unsigned long t0 = th_hal_micros();
+#endif
+  // FNV-1a über die Eingabe, in die Arena geschrieben wie eine Aktivierung
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < input_bytes; i++) {
+    h = (h ^ input[i]) * 16777619u;
+    if (arena) arena[i % kStubArenaSize] = (uint8_t)h;
+  }
+  checksum = h;
+#if TH_SUMMARY
+  if (th_latency_measuring()) th_latency_add((uint32_t)(th_hal_micros() - t0));
+#endif
+}
+
+void th_results() {
+  th_printf("m-results-[");
+  for (size_t i = 0; i < kStubOutputs; i++) {
+    float score = (float)((checksum >> (8 * i)) & 0xFF) / 255.0f;
+    th_printf("%0.3f", score);
+    if (i < kStubOutputs - 1) th_printf(",");
+  }
+  th_printf("]\r\n");
+}
+
+#if TH_SUMMARY
+void th_summary(size_t n, size_t n_warmup) {
+  th_summary_info_t info;
+  info.cpu_mhz = th_hal_cpu_mhz();
+  info.arena_size = kStubArenaSize;
+  info.arena_location = arena_location;
+  info.arena_used = input_bytes < kStubArenaSize ? input_bytes : kStubArenaSize;
+  info.exec = "stub";
+  info.kernels = th_kernel_backend();
+  th_summary_print(n, n_warmup, &info, nullptr);
+}
+#endif
+
+void th_final_initialize(void) {
+  th_mem_tier_t tier = TH_MEM_INTERNAL;
+  arena = (uint8_t*)th_alloc_aligned(kStubArenaSize, 16, &tier);
+  if (arena == nullptr) {
+    th_printf("FEHLER: Speicher voll!\r\n");
+    return;
+  }
+  arena_location = th_hal_tier_name(tier);
+#if TH_MODEL_LZ || TH_MODEL_STORE
+#if TH_MODEL_LZ
+  // Echtes Modellabbild entpacken, prüft Decoder und CRC auf dem PC
+  const unsigned char* model = model_lz_load(&model_lz_blob);
+#else
+  // Modell aus der Ablagedatei (mmap), gleiche API wie die Partition
+  const unsigned char* model = model_store_map(ee_model_name(), nullptr);
+#endif
+  if (model == nullptr) return;
+  th_model_align_check(model);
+#endif
+  th_printf("DEBUG: Host-Stub bereit, Arena %u Bytes (%s).\r\n",
+            (unsigned)kStubArenaSize, arena_location);
+}
+
+const char* th_kernel_backend(void) { return "none"; }
+
+void th_pre() {
+#if TH_SUMMARY
+  th_latency_begin();
+#endif
+}
+void th_post() {
+#if TH_SUMMARY
+  th_latency_end();
+#endif
+}
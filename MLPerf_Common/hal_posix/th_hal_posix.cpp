@@ -0,0 +1,68 @@
+/*
+ * th_hal_posix.cpp
+ *
+ * Board-Schicht (th_hal.h) für den Host-Build.
+ * - Serielle Schnittstelle: stdin/stdout, EOF beendet das Programm
+ * - Zeit: CLOCK_MONOTONIC
+ * - ENERGY MODE: der Timestamp-Impuls wird als Zeile ausgegeben
+ * - Speicher: nur der Heap
+ */
+
+#include "submitter_implemented.h"
+#include "internally_implemented.h"
+#include "th_hal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+void th_hal_serial_init(void) {
+  // Zeilenweise Antworten sofort sichtbar, auch in einer Pipe
+  setvbuf(stdout, NULL, _IONBF, 0);
+}
+
+void th_hal_serial_write(const char *buf, size_t len) {
+  fwrite(buf, 1, len, stdout);
+}
+
+char th_hal_serial_getchar(void) {
+  int c = getchar();
+  if (c == EOF) exit(0);
+  return (char)c;
+}
+
+unsigned long th_hal_micros(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long)ts.tv_sec * 1000000UL + (unsigned long)(ts.tv_nsec / 1000);
+}
+
+unsigned long th_hal_cpu_mhz(void) { return 0; }
+
+void th_hal_timestamp_init(void) {
+}
+
+void th_hal_timestamp_pulse(void) {
+  // Kein GPIO: die Flanke als Zeile, damit der Ablauf prüfbar bleibt
+  th_hal_serial_write("m-gpio-pulse\r\n", 14);
+}
+
+void *th_hal_alloc(th_mem_tier_t tier, size_t bytes) {
+  if (tier != TH_MEM_INTERNAL) return NULL;
+  return malloc(bytes);
+}
+
+const char *th_hal_tier_name(th_mem_tier_t tier) {
+  return tier == TH_MEM_INTERNAL ? "heap" : "none";
+}
+
+#if TH_LOW_POWER
+void th_hal_power_init(void) {
+}
+
+void th_busy_begin(void) {
+}
+
+void th_busy_end(void) {
+}
+#endif
@@ -0,0 +1,322 @@
+/*
+ * ad_batch.cpp
+ *
+ * Matrix-Matrix-Ausführung der FULLY_CONNECTED-Kette (siehe ad_batch.h).
+ *
+ * Pro Ausgabeneuron o und Fenster b gilt wie in der TFLM-Referenz
+ *     acc = bias[o] + sum_d (w[o][d] + w_off) * (x[b][d] + x_off)
+ * Ausmultipliziert bleibt in der inneren Schleife nur sum_d w * x übrig,
+ * die Terme mit den Offsets werden pro Zeile (einmalig in ad_batch_init)
+ * bzw. pro Fenster vorab berechnet. Alles bleibt in int32, das Ergebnis
+ * nach MultiplyByQuantizedMultiplier ist daher identisch.
+ */
+
+#include "ad_batch.h"
+
+#if TH_AD_BATCH
+
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+
+namespace {
+
+constexpr int kMaxLayers = 16;
+constexpr int kMaxBatch = TH_AD_BATCH;
+
+struct FcLayer {
+  int32_t depth, units;
+  const int8_t* filter;
+  int32_t in_offset, filter_offset, out_offset;
+  int32_t mult, shift, act_min, act_max;
+  int32_t* row_term;  // bias + Offset-Terme pro Ausgabeneuron
+};
+
+const tflite::Model* g_model = nullptr;
+FcLayer g_layers[kMaxLayers];
+int g_num_layers = 0;
+int g_max_batch = 0;
+bool g_ready = false;
+ad_batch_alloc_fn g_alloc = nullptr;
+size_t g_mem_bytes = 0;
+
+// Ping-Pong-Aktivierungen [max_batch][max_width]
+int32_t g_max_width = 0;
+int8_t* g_act[2] = {nullptr, nullptr};
+const int8_t* g_out_act = nullptr;
+
+// Quantisierung von Ein- und Ausgabe für den MSE
+float g_in_scale = 0.0f, g_out_scale = 0.0f;
+int32_t g_in_zp = 0, g_out_zp = 0;
+
+// Frame-Quelle
+const int8_t* g_src = nullptr;
+size_t g_src_windows = 0;
+size_t g_src_hop = 0;
+size_t g_src_next = 0;
+const int8_t* g_last_windows[kMaxBatch];
+int g_last_count = 0;
+float g_scores[kMaxBatch];
+
+void* AllocAligned(size_t bytes) {
+  uint8_t* raw = (uint8_t*)g_alloc(bytes + 15);
+  if (raw == nullptr) return nullptr;
+  g_mem_bytes += bytes + 15;
+  return (void*)(((uintptr_t)raw + 15) & ~(uintptr_t)15);
+}
+
+const tflite::Tensor* GetTensor(int32_t index) {
+  return g_model->subgraphs()->Get(0)->tensors()->Get(index);
+}
+
+const void* GetTensorData(const tflite::Tensor* t) {
+  const tflite::Buffer* buf = g_model->buffers()->Get(t->buffer());
+  return (buf != nullptr && buf->data() != nullptr) ? buf->data()->data() : nullptr;
+}
+
+float Scale(const tflite::Tensor* t) {
+  const tflite::QuantizationParameters* q = t->quantization();
+  if (q == nullptr || q->scale() == nullptr || q->scale()->size() == 0) return 0.0f;
+  return q->scale()->Get(0);
+}
+
+int32_t ZeroPoint(const tflite::Tensor* t) {
+  const tflite::QuantizationParameters* q = t->quantization();
+  if (q == nullptr || q->zero_point() == nullptr || q->zero_point()->size() == 0) return 0;
+  return (int32_t)q->zero_point()->Get(0);
+}
+
+// Wie CalculateActivationRangeQuantized() in TFLM
+void ActivationRange(tflite::ActivationFunctionType act, const tflite::Tensor* out,
+                     int32_t* act_min, int32_t* act_max) {
+  const float scale = Scale(out);
+  const int32_t zp = ZeroPoint(out);
+  auto quantize = [scale, zp](float f) {
+    return zp + (int32_t)roundf(f / scale);
+  };
+  int32_t lo = -128, hi = 127;
+  if (act == tflite::ActivationFunctionType_RELU) {
+    lo = std::max(lo, quantize(0.0f));
+  } else if (act == tflite::ActivationFunctionType_RELU6) {
+    lo = std::max(lo, quantize(0.0f));
+    hi = std::min(hi, quantize(6.0f));
+  } else if (act == tflite::ActivationFunctionType_RELU_N1_TO_1) {
+    lo = std::max(lo, quantize(-1.0f));
+    hi = std::min(hi, quantize(1.0f));
+  }
+  *act_min = lo;
+  *act_max = hi;
+}
+
+bool SetupLayer(const tflite::Operator* op, FcLayer* L) {
+  const tflite::Tensor* in = GetTensor(op->inputs()->Get(0));
+  const tflite::Tensor* filter = GetTensor(op->inputs()->Get(1));
+  const tflite::Tensor* out = GetTensor(op->outputs()->Get(0));
+  const int32_t bias_index = op->inputs()->size() > 2 ? op->inputs()->Get(2) : -1;
+  const tflite::FullyConnectedOptions* o = op->builtin_options_as_FullyConnectedOptions();
+
+  if (filter->type() != tflite::TensorType_INT8 || filter->shape()->size() != 2) return false;
+  L->units = filter->shape()->Get(0);
+  L->depth = filter->shape()->Get(1);
+  L->filter = (const int8_t*)GetTensorData(filter);
+  if (L->filter == nullptr) return false;
+  const int32_t* bias = bias_index >= 0 ? (const int32_t*)GetTensorData(GetTensor(bias_index))
+                                        : nullptr;
+
+  L->in_offset = -ZeroPoint(in);
+  L->filter_offset = -ZeroPoint(filter);
+  L->out_offset = ZeroPoint(out);
+  ActivationRange(o != nullptr ? o->fused_activation_function()
+                               : tflite::ActivationFunctionType_NONE,
+                  out, &L->act_min, &L->act_max);
+  // Wie GetQuantizedConvolutionMultipler(): Produkt erst in float
+  const double real = (double)(Scale(in) * Scale(filter)) / (double)Scale(out);
+  int shift = 0;
+  tflite::QuantizeMultiplier(real, &L->mult, &shift);
+  L->shift = shift;
+
+  L->row_term = (int32_t*)AllocAligned(L->units * sizeof(int32_t));
+  if (L->row_term == nullptr) return false;
+  for (int32_t u = 0; u < L->units; u++) {
+    const int8_t* w = L->filter + u * L->depth;
+    int32_t sum_w = 0;
+    for (int32_t d = 0; d < L->depth; d++) sum_w += w[d];
+    L->row_term[u] = (bias != nullptr ? bias[u] : 0) + L->in_offset * sum_w +
+                     L->depth * L->filter_offset * L->in_offset;
+  }
+  return true;
+}
+
+inline int8_t Requantize(const FcLayer& L, int32_t acc) {
+  acc = tflite::MultiplyByQuantizedMultiplier(acc, L.mult, L.shift);
+  acc += L.out_offset;
+  acc = std::max(acc, L.act_min);
+  acc = std::min(acc, L.act_max);
+  return (int8_t)acc;
+}
+
+// Eine Schicht für alle Fenster: jede Gewichtszeile wird einmal geladen und
+// für vier Fenster gleichzeitig verwendet (vier Akkumulatoren in Registern).
+void RunLayer(const FcLayer& L, const int8_t* const* x, int batch, int8_t* out) {
+  int32_t col_term[kMaxBatch];
+  for (int b = 0; b < batch; b++) {
+    int32_t sum_x = 0;
+    if (L.filter_offset != 0) {
+      for (int32_t d = 0; d < L.depth; d++) sum_x += x[b][d];
+    }
+    col_term[b] = L.filter_offset * sum_x;
+  }
+
+  for (int32_t u = 0; u < L.units; u++) {
+    const int8_t* w = L.filter + u * L.depth;
+    const int32_t base = L.row_term[u];
+    int b = 0;
+    for (; b + 4 <= batch; b += 4) {
+      const int8_t* x0 = x[b];
+      const int8_t* x1 = x[b + 1];
+      const int8_t* x2 = x[b + 2];
+      const int8_t* x3 = x[b + 3];
+      int32_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+      for (int32_t d = 0; d < L.depth; d++) {
+        const int32_t wd = w[d];
+        acc0 += wd * x0[d];
+        acc1 += wd * x1[d];
+        acc2 += wd * x2[d];
+        acc3 += wd * x3[d];
+      }
+      out[(b + 0) * L.units + u] = Requantize(L, acc0 + base + col_term[b + 0]);
+      out[(b + 1) * L.units + u] = Requantize(L, acc1 + base + col_term[b + 1]);
+      out[(b + 2) * L.units + u] = Requantize(L, acc2 + base + col_term[b + 2]);
+      out[(b + 3) * L.units + u] = Requantize(L, acc3 + base + col_term[b + 3]);
+    }
+    for (; b < batch; b++) {
+      const int8_t* xb = x[b];
+      int32_t acc = 0;
+      for (int32_t d = 0; d < L.depth; d++) acc += w[d] * xb[d];
+      out[b * L.units + u] = Requantize(L, acc + base + col_term[b]);
+    }
+  }
+}
+
+}  // namespace
+
+bool ad_batch_init(const tflite::Model* model, int max_batch, ad_batch_alloc_fn alloc) {
+  g_ready = false;
+  g_model = model;
+  g_alloc = alloc;
+  g_num_layers = 0;
+  g_mem_bytes = 0;
+  g_max_batch = std::min(std::max(max_batch, 1), kMaxBatch);
+
+  const tflite::SubGraph* sg = model->subgraphs()->Get(0);
+  int32_t prev_out = sg->inputs()->Get(0);
+  g_max_width = 0;
+  for (uint32_t i = 0; i < sg->operators()->size(); i++) {
+    const tflite::Operator* op = sg->operators()->Get(i);
+    const int code = tflite::GetBuiltinCode(model->operator_codes()->Get(op->opcode_index()));
+    if (code != tflite::BuiltinOperator_FULLY_CONNECTED || g_num_layers >= kMaxLayers) return false;
+    if (op->inputs()->Get(0) != prev_out) return false;
+    prev_out = op->outputs()->Get(0);
+    if (!SetupLayer(op, &g_layers[g_num_layers])) return false;
+    if (g_num_layers > 0 && g_layers[g_num_layers].depth != g_layers[g_num_layers - 1].units) {
+      return false;
+    }
+    g_max_width = std::max(g_max_width, g_layers[g_num_layers].units);
+    g_num_layers++;
+  }
+  if (g_num_layers == 0 || prev_out != sg->outputs()->Get(0)) return false;
+  // Autoencoder: Rekonstruktion hat die Breite der Eingabe
+  if (g_layers[g_num_layers - 1].units != g_layers[0].depth) return false;
+
+  const tflite::Tensor* in = GetTensor(sg->inputs()->Get(0));
+  const tflite::Tensor* out = GetTensor(sg->outputs()->Get(0));
+  g_in_scale = Scale(in);
+  g_in_zp = ZeroPoint(in);
+  g_out_scale = Scale(out);
+  g_out_zp = ZeroPoint(out);
+
+  g_act[0] = (int8_t*)AllocAligned((size_t)g_max_batch * g_max_width);
+  g_act[1] = (int8_t*)AllocAligned((size_t)g_max_batch * g_max_width);
+  if (g_act[0] == nullptr || g_act[1] == nullptr) return false;
+
+  g_ready = true;
+  return true;
+}
+
+int ad_batch_max(void) { return g_max_batch; }
+
+size_t ad_batch_window_bytes(void) { return g_ready ? (size_t)g_layers[0].depth : 0; }
+
+void ad_batch_run(const int8_t* const* windows, int batch, float* scores) {
+  if (!g_ready) return;
+  batch = std::min(batch, g_max_batch);
+
+  const int8_t* x[kMaxBatch];
+  for (int b = 0; b < batch; b++) x[b] = windows[b];
+
+  int8_t* out = nullptr;
+  for (int l = 0; l < g_num_layers; l++) {
+    const FcLayer& L = g_layers[l];
+    out = g_act[l & 1];
+    RunLayer(L, x, batch, out);
+    for (int b = 0; b < batch; b++) x[b] = out + b * L.units;
+  }
+  g_out_act = out;
+
+  // MSE im dequantisierten Raum, wie die Auswertung des Hosts
+  const int32_t width = g_layers[0].depth;
+  for (int b = 0; b < batch; b++) {
+    const int8_t* in = windows[b];
+    const int8_t* rec = out + b * width;
+    float sum = 0.0f;
+    for (int32_t i = 0; i < width; i++) {
+      const float diff = (float)(rec[i] - g_out_zp) * g_out_scale -
+                         (float)(in[i] - g_in_zp) * g_in_scale;
+      sum += diff * diff;
+    }
+    scores[b] = sum / (float)width;
+  }
+}
+
+bool ad_batch_set_source(const int8_t* data, size_t bytes, size_t hop) {
+  const size_t window = ad_batch_window_bytes();
+  if (!g_ready || hop == 0 || bytes < window) return false;
+  g_src = data;
+  g_src_hop = hop;
+  g_src_windows = (bytes - window) / hop + 1;
+  g_src_next = 0;
+  g_last_count = 0;
+  return true;
+}
+
+size_t ad_batch_source_windows(void) { return g_src_windows; }
+
+void ad_batch_step(int batch) {
+  if (g_src == nullptr) return;
+  batch = std::min(batch, g_max_batch);
+  for (int b = 0; b < batch; b++) {
+    g_last_windows[b] = g_src + g_src_next * g_src_hop;
+    g_src_next = (g_src_next + 1) % g_src_windows;
+  }
+  ad_batch_run(g_last_windows, batch, g_scores);
+  g_last_count = batch;
+}
+
+int ad_batch_last_count(void) { return g_last_count; }
+
+const int8_t* ad_batch_window(int b) { return g_last_windows[b]; }
+
+const int8_t* ad_batch_output(int b) {
+  return g_out_act + (size_t)b * g_layers[g_num_layers - 1].units;
+}
+
+const float* ad_batch_scores(void) { return g_scores; }
+
+size_t ad_batch_memory_bytes(void) { return g_mem_bytes; }
+
+#endif  // TH_AD_BATCH
@@ -0,0 +1,73 @@
+/*
+ * ad_batch.h
+ *
+ * Gebatchte Ausführung des ad01-Autoencoders (nur FULLY_CONNECTED mit
+ * fusioniertem ReLU) über B überlappende Fenster eines Spektrogramm-Streams.
+ *
+ * Statt B-mal Invoke() (Matrix-Vektor) rechnet jede Schicht ein
+ * Matrix-Matrix-Produkt: jede Gewichtszeile wird einmal aus dem Flash
+ * gelesen und für alle B Fenster verwendet. Die Integer-Arithmetik
+ * entspricht reference_integer_ops::FullyConnected, die Rekonstruktion soll
+ * damit bitgleich zu Invoke() sein; geprüft mit tflm_host/ad_batch_test
+ * (braucht die TFLM-Quellen) oder TH_AD_BATCH_VERIFY. Der MSE-Anomaliescore
+ * (dequantisierte Eingabe gegen Rekonstruktion) wird direkt auf dem Gerät
+ * berechnet.
+ *
+ * Aktivierung über Build-Flags (platformio.ini):
+ *   -D TH_AD_BATCH=8           maximale Batchgröße (0 = aus)
+ *   -D TH_AD_BATCH_HOP=128     Fensterversatz in Bytes (1 Frame = 128 Mel-Bänder)
+ *   -D TH_AD_BATCH_VERIFY=1    jede Rekonstruktion gegen Invoke() prüfen
+ */
+
+#ifndef TH_AD_BATCH_H_
+#define TH_AD_BATCH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef TH_AD_BATCH
+#define TH_AD_BATCH 0
+#endif
+
+#ifndef TH_AD_BATCH_HOP
+#define TH_AD_BATCH_HOP 128
+#endif
+
+#ifndef TH_AD_BATCH_VERIFY
+#define TH_AD_BATCH_VERIFY 0
+#endif
+
+namespace tflite {
+struct Model;
+}
+
+typedef void* (*ad_batch_alloc_fn)(size_t bytes);
+
+// Analysiert den Graphen (Kette aus FULLY_CONNECTED, Ausgabe = Eingabebreite)
+// und legt Aktivierungspuffer für max_batch Fenster an.
+bool ad_batch_init(const tflite::Model* model, int max_batch, ad_batch_alloc_fn alloc);
+
+int ad_batch_max(void);
+size_t ad_batch_window_bytes(void);
+
+// Rechnet batch Fenster; Fenster b beginnt bei windows[b]. scores erhält
+// pro Fenster den MSE zwischen Eingabe und Rekonstruktion.
+void ad_batch_run(const int8_t* const* windows, int batch, float* scores);
+
+// Frame-Quelle aus "db load": überlappende Fenster mit Versatz hop Bytes.
+// Der Puffer muss gültig bleiben, solange gerechnet wird.
+bool ad_batch_set_source(const int8_t* data, size_t bytes, size_t hop);
+size_t ad_batch_source_windows(void);
+
+// Nächste batch Fenster der Quelle rechnen (zyklisch)
+void ad_batch_step(int batch);
+
+// Ergebnisse des letzten ad_batch_step()
+int ad_batch_last_count(void);
+const int8_t* ad_batch_window(int b);
+const int8_t* ad_batch_output(int b);
+const float* ad_batch_scores(void);
+
+size_t ad_batch_memory_bytes(void);
+
+#endif  // TH_AD_BATCH_H_
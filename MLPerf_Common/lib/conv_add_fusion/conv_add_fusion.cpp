@@ -0,0 +1,468 @@
+/*
+ * conv_add_fusion.cpp
+ *
+ * CONV_2D mit ADD im Epilog (siehe conv_add_fusion.h).
+ *
+ * Ablauf pro Invoke():
+ *   Faltung (fusioniert)  -> rechnet conv + add, merkt sich im Paar, wohin
+ *   ADD                   -> nichts zu tun ("direkt") bzw. memcpy aus dem
+ *                            Faltungsausgang
+ * Nicht fusionierte Faltungen laufen über den in Prepare erstellten Plan
+ * (esp_nn_conv_s8_execute) mit denselben Quantisierungsparametern wie in
+ * esp-tflite-micro. Mit TH_PACK_WEIGHTS packt Prepare Filter und Bias
+ * einmal um, beide Pfade laufen dann über esp_nn_conv_(add_)s8_packed.
+ * ESP-NN läuft über die _ctx-Einstiege mit dem Scratch des Knotens, die
+ * globalen Scratch-Zeiger von ESP-NN setzt hier niemand. Was ESP-NN nicht
+ * rechnet, läuft über den Standardkernel der Faltung.
+ */
+
+#include "conv_add_fusion.h"
+
+#if TH_CONV_ADD_FUSED
+
+#include <string.h>
+#include <algorithm>
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/add.h"
+#include "tensorflow/lite/micro/kernels/conv.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_context.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+
+#include "sdkconfig.h"
+#include "esp_nn.h"
+#include "th_stock_kernel.h"
+
+namespace {
+
+constexpr int kMaxPairs = 8;
+constexpr int kMaxPacked = 32;  // Bits von g_pack_mask
+// TFLM: left_shift in CalculateOpDataAdd() für int8
+constexpr int kAddLeftShift = 20;
+
+enum PairState : uint8_t {
+  kPending,   // Faltung in diesem Invoke() noch nicht gelaufen
+  kDirect,    // ADD-Ausgang bereits geschrieben
+  kCopy,      // Ergebnis im Faltungsausgang, ADD kopiert
+};
+
+struct FusedPair {
+  int32_t add_output;   // Tensorindex, Schlüssel für das ADD
+  int32_t conv_output;
+  PairState state;
+  bool direct_seen;     // für die Statistik
+};
+
+struct FusionConvData {
+  tflite::OpDataConv op;   // muss vorne stehen: ConvPrepare() schreibt über user_data
+  int scratch_index;
+  int32_t scratch_bytes;
+  FusedPair* pair;         // nullptr: normale Faltung
+  int32_t skip_tensor;
+  conv_add_params_t add;
+  conv_plan_t plan;        // Kernelwahl aus Prepare
+  const void* packed;      // TH_PACK_WEIGHTS: umgepackter Filter, sonst nullptr
+  int pack_id;             // Bit in g_pack_mask, -1 ohne umgepackten Filter
+  void* stock;             // Knotendaten des Standardkernels, sonst nullptr
+};
+
+const tflite::Model* g_model = nullptr;
+FusedPair g_pairs[kMaxPairs];
+int g_num_pairs = 0;
+TFLMRegistration g_conv;
+TFLMRegistration g_add;
+int g_packed_convs = 0;
+size_t g_packed_bytes = 0;
+size_t g_packed_layer_bytes[kMaxPacked];
+uint32_t g_pack_mask = 0xffffffffu;
+
+const tflite::Operator* GetOp(int index) {
+  return g_model->subgraphs()->Get(0)->operators()->Get(index);
+}
+
+int NumOps() {
+  return (int)g_model->subgraphs()->Get(0)->operators()->size();
+}
+
+tflite::BuiltinOperator OpCode(const tflite::Operator* op) {
+  return tflite::GetBuiltinCode(g_model->operator_codes()->Get(op->opcode_index()));
+}
+
+bool IsGraphOutput(int32_t tensor) {
+  const auto* outputs = g_model->subgraphs()->Get(0)->outputs();
+  for (uint32_t i = 0; i < outputs->size(); i++) {
+    if (outputs->Get(i) == tensor) return true;
+  }
+  return false;
+}
+
+bool ToTfLiteActivation(tflite::ActivationFunctionType act, TfLiteFusedActivation* out) {
+  switch (act) {
+    case tflite::ActivationFunctionType_NONE: *out = kTfLiteActNone; return true;
+    case tflite::ActivationFunctionType_RELU: *out = kTfLiteActRelu; return true;
+    case tflite::ActivationFunctionType_RELU_N1_TO_1: *out = kTfLiteActReluN1To1; return true;
+    case tflite::ActivationFunctionType_RELU6: *out = kTfLiteActRelu6; return true;
+    default: return false;
+  }
+}
+
+bool SameShape(const TfLiteTensor* a, const TfLiteTensor* b) {
+  if (a->dims->size != b->dims->size) return false;
+  for (int i = 0; i < a->dims->size; i++) {
+    if (a->dims->data[i] != b->dims->data[i]) return false;
+  }
+  return true;
+}
+
+// Sucht CONV_2D -> ADD für den Faltungsausgang conv_out. Liefert das
+// ADD-Op und ob die Faltung dessen erster Eingang ist.
+const tflite::Operator* FindAdd(int32_t conv_out, bool* conv_first) {
+  const int n = NumOps();
+  int conv_index = -1;
+  for (int i = 0; i < n; i++) {
+    const auto* outputs = GetOp(i)->outputs();
+    if (outputs != nullptr && outputs->size() == 1 && outputs->Get(0) == conv_out) {
+      conv_index = i;
+      break;
+    }
+  }
+  if (conv_index < 0 || conv_index + 1 >= n || IsGraphOutput(conv_out)) return nullptr;
+
+  const tflite::Operator* add = GetOp(conv_index + 1);
+  if (OpCode(add) != tflite::BuiltinOperator_ADD || add->inputs()->size() != 2 ||
+      add->outputs()->size() != 1) {
+    return nullptr;
+  }
+  const int32_t in0 = add->inputs()->Get(0);
+  const int32_t in1 = add->inputs()->Get(1);
+  if ((in0 == conv_out) == (in1 == conv_out)) return nullptr;
+  *conv_first = (in0 == conv_out);
+  const int32_t skip = *conv_first ? in1 : in0;
+
+  // Faltungsausgang hat genau einen Leser; Skip entsteht vor der Faltung
+  for (int i = 0; i < n; i++) {
+    const tflite::Operator* op = GetOp(i);
+    if (i != conv_index + 1) {
+      for (uint32_t k = 0; k < op->inputs()->size(); k++) {
+        if (op->inputs()->Get(k) == conv_out) return nullptr;
+      }
+    }
+    if (i >= conv_index) {
+      for (uint32_t k = 0; k < op->outputs()->size(); k++) {
+        if (op->outputs()->Get(k) == skip) return nullptr;
+      }
+    }
+  }
+  return add;
+}
+
+// Quantisierung des ADD wie CalculateOpDataAdd() in TFLM (int8)
+TfLiteStatus CalculateAddParams(TfLiteContext* context, const TfLiteTensor* conv_out,
+                                const TfLiteTensor* skip, const TfLiteTensor* add_out,
+                                TfLiteFusedActivation activation, conv_add_params_t* p) {
+  const double conv_scale = conv_out->params.scale;
+  const double skip_scale = skip->params.scale;
+  const double twice_max = 2 * std::max(conv_scale, skip_scale);
+  const double out_scale = twice_max / ((1 << kAddLeftShift) * (double)add_out->params.scale);
+
+  int conv_shift = 0, skip_shift = 0, out_shift = 0;
+  tflite::QuantizeMultiplierSmallerThanOneExp(conv_scale / twice_max, &p->conv_mult, &conv_shift);
+  tflite::QuantizeMultiplierSmallerThanOneExp(skip_scale / twice_max, &p->skip_mult, &skip_shift);
+  tflite::QuantizeMultiplierSmallerThanOneExp(out_scale, &p->out_mult, &out_shift);
+  p->conv_shift = conv_shift;
+  p->skip_shift = skip_shift;
+  p->out_shift = out_shift;
+  p->left_shift = kAddLeftShift;
+  p->conv_offset = -conv_out->params.zero_point;
+  p->skip_offset = -skip->params.zero_point;
+  p->out_offset = add_out->params.zero_point;
+
+  int32_t act_min = 0, act_max = 0;
+  TF_LITE_ENSURE_STATUS(tflite::CalculateActivationRangeQuantized(
+      context, activation, const_cast<TfLiteTensor*>(add_out), &act_min, &act_max));
+  p->activation.min = act_min;
+  p->activation.max = act_max;
+  return kTfLiteOk;
+}
+
+// Paar anlegen, falls das Muster passt (sonst bleibt data->pair leer)
+TfLiteStatus DetectPair(TfLiteContext* context, int32_t conv_out_index,
+                        const TfLiteTensor* conv_out, FusionConvData* data) {
+  if (g_model == nullptr) return kTfLiteOk;  // fusion_init() fehlt: keine Fusion
+  bool conv_first = true;
+  const tflite::Operator* add = FindAdd(conv_out_index, &conv_first);
+  if (add == nullptr || g_num_pairs >= kMaxPairs) return kTfLiteOk;
+
+  const tflite::AddOptions* options = add->builtin_options_as_AddOptions();
+  TfLiteFusedActivation activation = kTfLiteActNone;
+  if (options != nullptr && !ToTfLiteActivation(options->fused_activation_function(), &activation)) {
+    return kTfLiteOk;
+  }
+
+  const int32_t skip_index = add->inputs()->Get(conv_first ? 1 : 0);
+  const int32_t add_out_index = add->outputs()->Get(0);
+  tflite::MicroContext* micro_context = tflite::GetMicroContext(context);
+  TfLiteTensor* skip = micro_context->AllocateTempTfLiteTensor(skip_index);
+  TfLiteTensor* add_out = micro_context->AllocateTempTfLiteTensor(add_out_index);
+  TF_LITE_ENSURE(context, skip != nullptr && add_out != nullptr);
+
+  TfLiteStatus status = kTfLiteOk;
+  if (skip->type == kTfLiteInt8 && add_out->type == kTfLiteInt8 &&
+      SameShape(conv_out, skip) && SameShape(conv_out, add_out)) {
+    // Die Summe ist kommutativ: Vertauschen der Eingänge ändert kein Bit
+    status = CalculateAddParams(context, conv_out, skip, add_out, activation, &data->add);
+    if (status == kTfLiteOk) {
+      FusedPair* pair = &g_pairs[g_num_pairs++];
+      pair->add_output = add_out_index;
+      pair->conv_output = conv_out_index;
+      pair->state = kPending;
+      pair->direct_seen = false;
+      data->pair = pair;
+      data->skip_tensor = skip_index;
+    }
+  }
+  micro_context->DeallocateTempTfLiteTensor(skip);
+  micro_context->DeallocateTempTfLiteTensor(add_out);
+  return status;
+}
+
+void FillConvParams(const TfLiteConvParams& params, const tflite::OpDataConv& data,
+                    conv_params_t* conv) {
+  conv->in_offset = -data.input_zero_point;
+  conv->out_offset = data.output_zero_point;
+  conv->stride = {params.stride_width, params.stride_height};
+  conv->padding = {data.padding.width, data.padding.height};
+  conv->dilation = {1, 1};
+  conv->activation = {data.output_activation_min, data.output_activation_max};
+}
+
+#if TH_PACK_WEIGHTS
+// Filter und Bias ins Layout von esp_nn_conv_s8_packed (persistenter
+// Arena-Puffer), in Modellreihenfolge bis TH_PACK_WEIGHTS_BUDGET Bytes;
+// passt die Form oder das Budget nicht, bleibt data->packed leer
+TfLiteStatus PackWeights(TfLiteContext* context, TfLiteNode* node, const TfLiteTensor* filter,
+                         FusionConvData* data) {
+  const int packed_bytes = esp_nn_get_conv_packed_filter_size(&data->plan);
+  if (packed_bytes <= 0 || g_packed_bytes + packed_bytes > TH_PACK_WEIGHTS_BUDGET) {
+    return kTfLiteOk;
+  }
+  void* packed = context->AllocatePersistentBuffer(context, packed_bytes);
+  TF_LITE_ENSURE(context, packed != nullptr);
+
+  tflite::MicroContext* micro_context = tflite::GetMicroContext(context);
+  TfLiteTensor* bias = micro_context->AllocateTempInputTensor(node, tflite::kConvBiasTensor);
+  esp_nn_conv_pack_filter(&data->plan, filter->data.int8,
+                          bias != nullptr ? bias->data.i32 : nullptr, packed);
+  if (bias != nullptr) micro_context->DeallocateTempTfLiteTensor(bias);
+
+  data->packed = packed;
+  data->pack_id = g_packed_convs;
+  if (g_packed_convs < kMaxPacked) g_packed_layer_bytes[g_packed_convs] = packed_bytes;
+  data->scratch_bytes = std::max(data->scratch_bytes,
+                                 (int32_t)esp_nn_get_conv_packed_scratch_size(&data->plan));
+  g_packed_convs++;
+  g_packed_bytes += packed_bytes;
+  return kTfLiteOk;
+}
+#endif
+
+// Umgepackter Filter, sofern nicht per fusion_set_pack_mask abgeschaltet
+const void* ActivePacked(const FusionConvData* data) {
+  if (data->packed == nullptr || data->pack_id >= kMaxPacked) return data->packed;
+  return (g_pack_mask >> data->pack_id) & 1u ? data->packed : nullptr;
+}
+
+bool Overlaps(const void* a, size_t a_bytes, const void* b, size_t b_bytes) {
+  const uintptr_t a0 = (uintptr_t)a, b0 = (uintptr_t)b;
+  return a0 < b0 + b_bytes && b0 < a0 + a_bytes;
+}
+
+void* FusionConvInit(TfLiteContext* context, const char* buffer, size_t length) {
+  (void)buffer;
+  (void)length;
+  void* raw = context->AllocatePersistentBuffer(context, sizeof(FusionConvData));
+  if (raw == nullptr) return nullptr;
+  FusionConvData* data = static_cast<FusionConvData*>(raw);
+  data->scratch_index = -1;
+  data->scratch_bytes = 0;
+  data->pair = nullptr;
+  data->skip_tensor = -1;
+  data->packed = nullptr;
+  data->pack_id = -1;
+  data->stock = nullptr;
+  return raw;
+}
+
+TfLiteStatus FusionConvPrepare(TfLiteContext* context, TfLiteNode* node) {
+  FusionConvData* data = static_cast<FusionConvData*>(node->user_data);
+  const auto& params = *(reinterpret_cast<TfLiteConvParams*>(node->builtin_data));
+
+  tflite::MicroContext* micro_context = tflite::GetMicroContext(context);
+  TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, tflite::kConvInputTensor);
+  TfLiteTensor* filter = micro_context->AllocateTempInputTensor(node, tflite::kConvWeightsTensor);
+  TfLiteTensor* output = micro_context->AllocateTempOutputTensor(node, tflite::kConvOutputTensor);
+  TF_LITE_ENSURE(context, input != nullptr && filter != nullptr && output != nullptr);
+
+  // ESP-NN rechnet nur int8, Batch 1, ohne Dilation; sonst Standardkernel
+  if (input->type != kTfLiteInt8 || filter->type != kTfLiteInt8 ||
+      input->dims->data[0] != 1 ||
+      params.dilation_height_factor != 1 || params.dilation_width_factor != 1) {
+    micro_context->DeallocateTempTfLiteTensor(input);
+    micro_context->DeallocateTempTfLiteTensor(filter);
+    micro_context->DeallocateTempTfLiteTensor(output);
+    return th_stock_prepare(context, node, g_conv, &data->stock);
+  }
+  TF_LITE_ENSURE_STATUS(tflite::ConvPrepare(context, node));
+
+  data_dims_t in_dims = {input->dims->data[2], input->dims->data[1], input->dims->data[3], 1};
+  data_dims_t filter_dims = {filter->dims->data[2], filter->dims->data[1], filter->dims->data[3], 0};
+  data_dims_t out_dims = {output->dims->data[2], output->dims->data[1], output->dims->data[3], 1};
+  conv_params_t conv;
+  FillConvParams(params, data->op, &conv);
+  // Variante und Scratch einmal pro Knoten bestimmen, Eval führt nur noch aus
+  data->scratch_bytes = esp_nn_conv_plan_create(&data->plan, &in_dims, &filter_dims, &out_dims, &conv);
+#if TH_PACK_WEIGHTS
+  TF_LITE_ENSURE_STATUS(PackWeights(context, node, filter, data));
+#endif
+  if (data->scratch_bytes > 0) {
+    TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, data->scratch_bytes, &data->scratch_index));
+  }
+
+  TfLiteStatus status = DetectPair(context, node->outputs->data[0], output, data);
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(filter);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return status;
+}
+
+TfLiteStatus FusionConvEval(TfLiteContext* context, TfLiteNode* node) {
+  FusionConvData* data = static_cast<FusionConvData*>(node->user_data);
+  if (data->stock != nullptr) return th_stock_invoke(context, node, g_conv, data->stock);
+
+  const TfLiteEvalTensor* input = tflite::micro::GetEvalInput(context, node, tflite::kConvInputTensor);
+  const TfLiteEvalTensor* filter = tflite::micro::GetEvalInput(context, node, tflite::kConvWeightsTensor);
+  const TfLiteEvalTensor* bias = node->inputs->size == 3
+      ? tflite::micro::GetEvalInput(context, node, tflite::kConvBiasTensor) : nullptr;
+  TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, tflite::kConvOutputTensor);
+
+  const conv_plan_t& plan = data->plan;
+  quant_data_t quant = {data->op.per_channel_output_shift, data->op.per_channel_output_multiplier};
+
+  void* scratch = data->scratch_index >= 0
+      ? context->GetScratchBuffer(context, data->scratch_index) : nullptr;
+  // Scratch nur über den Kontext, die globalen ESP-NN-Puffer bleiben unberührt
+  esp_nn_ctx_t nn_ctx = {};
+  nn_ctx.conv_scratch = scratch;
+
+  const int8_t* in_data = tflite::micro::GetTensorData<int8_t>(input);
+  const int8_t* filter_data = tflite::micro::GetTensorData<int8_t>(filter);
+  const int32_t* bias_data = tflite::micro::GetOptionalTensorData<int32_t>(bias);
+  int8_t* out_data = tflite::micro::GetTensorData<int8_t>(output);
+
+  const void* packed = ActivePacked(data);
+  if (data->pair == nullptr) {
+    if (packed != nullptr) {
+      esp_nn_conv_s8_packed_ctx(&nn_ctx, &plan, in_data, packed, out_data, &quant);
+    } else {
+      esp_nn_conv_s8_execute_ctx(&nn_ctx, &plan, in_data, filter_data, bias_data, out_data,
+                                 &quant);
+    }
+    return kTfLiteOk;
+  }
+
+  const TfLiteEvalTensor* skip = context->GetEvalTensor(context, data->skip_tensor);
+  TfLiteEvalTensor* add_out = context->GetEvalTensor(context, data->pair->add_output);
+  const size_t in_bytes =
+      (size_t)plan.input_dims.width * plan.input_dims.height * plan.input_dims.channels;
+  const size_t out_bytes =
+      (size_t)plan.output_dims.width * plan.output_dims.height * plan.output_dims.channels;
+
+  // Direkt in den ADD-Ausgang nur, wenn er weder Eingang noch Scratch überdeckt
+  int8_t* dst = tflite::micro::GetTensorData<int8_t>(add_out);
+  const bool direct = !Overlaps(dst, out_bytes, in_data, in_bytes) &&
+      (scratch == nullptr || !Overlaps(dst, out_bytes, scratch, data->scratch_bytes));
+  if (!direct) dst = out_data;
+
+  const int8_t* skip_data = tflite::micro::GetTensorData<int8_t>(skip);
+  if (packed != nullptr) {
+    esp_nn_conv_add_s8_packed_ctx(&nn_ctx, &plan, in_data, packed, skip_data, dst, &quant,
+                                  &data->add);
+  } else {
+    esp_nn_conv_add_s8_execute_ctx(&nn_ctx, &plan, in_data, filter_data, bias_data, skip_data,
+                                   dst, &quant, &data->add);
+  }
+  data->pair->state = direct ? kDirect : kCopy;
+  data->pair->direct_seen = direct;
+  return kTfLiteOk;
+}
+
+TfLiteStatus FusionAddEval(TfLiteContext* context, TfLiteNode* node) {
+  const int32_t add_output = node->outputs->data[0];
+  for (int i = 0; i < g_num_pairs; i++) {
+    FusedPair& pair = g_pairs[i];
+    if (pair.add_output != add_output || pair.state == kPending) continue;
+    if (pair.state == kCopy) {
+      const TfLiteEvalTensor* src = context->GetEvalTensor(context, pair.conv_output);
+      TfLiteEvalTensor* dst = tflite::micro::GetEvalOutput(context, node, 0);
+      memcpy(tflite::micro::GetTensorData<int8_t>(dst),
+             tflite::micro::GetTensorData<int8_t>(src),
+             tflite::micro::GetTensorShape(src).FlatSize());
+    }
+    pair.state = kPending;
+    return kTfLiteOk;
+  }
+  return g_add.invoke(context, node);
+}
+
+}  // namespace
+
+void fusion_init(const tflite::Model* model) {
+  g_model = model;
+  g_num_pairs = 0;
+  g_packed_convs = 0;
+  g_packed_bytes = 0;
+}
+
+TFLMRegistration fusion_conv2d_registration(void) {
+  g_conv = tflite::Register_CONV_2D();
+  return tflite::micro::RegisterOp(FusionConvInit, FusionConvPrepare, FusionConvEval);
+}
+
+TFLMRegistration fusion_add_registration(void) {
+  g_add = tflite::Register_ADD();
+  TFLMRegistration r = g_add;
+  r.invoke = FusionAddEval;
+  return r;
+}
+
+void fusion_get_stats(int* pairs, int* direct) {
+  int n = 0;
+  for (int i = 0; i < g_num_pairs; i++) {
+    if (g_pairs[i].direct_seen) n++;
+  }
+  *pairs = g_num_pairs;
+  *direct = n;
+}
+
+void fusion_get_pack_stats(int* convs, size_t* bytes) {
+  *convs = g_packed_convs;
+  *bytes = g_packed_bytes;
+}
+
+void fusion_set_pack_mask(uint32_t mask) {
+  g_pack_mask = mask;
+}
+
+size_t fusion_get_packed_bytes(int conv) {
+  return conv >= 0 && conv < g_packed_convs && conv < kMaxPacked
+      ? g_packed_layer_bytes[conv] : 0;
+}
+
+#endif  // TH_CONV_ADD_FUSED
@@ -0,0 +1,103 @@
+/*
+ * conv_add_fusion.h
+ *
+ * Fusion von CONV_2D + ADD in den Residualblöcken von ic01 (ResNet-8).
+ *
+ * Ohne Fusion schreibt die Faltung ihren kompletten int8-Ausgang in die
+ * Arena, und das direkt folgende ADD liest ihn zusammen mit dem
+ * Skip-Tensor wieder ein. Mit Fusion rechnet die Faltung das ADD im
+ * Epilog gleich mit (esp_nn_conv_add_s8); das ADD-Op wird dann übersprungen.
+ *
+ * Das Muster wird in Prepare der Faltung am Flatbuffer erkannt:
+ *   - das nächste Op ist ein ADD, das den Faltungsausgang liest,
+ *   - sonst liest niemand diesen Tensor und er ist kein Modellausgang,
+ *   - der zweite ADD-Eingang (Skip) entsteht vor der Faltung,
+ *   - alle drei Tensoren haben dieselbe Form (kein Broadcast), int8.
+ * ic01 hat drei solche Paare: die 3x3-Faltung im ersten Block und die
+ * 1x1-Skip-Faltungen der Blöcke 2 und 3.
+ *
+ * Der ADD-Ausgang lebt laut Speicherplaner erst ab dem ADD und darf sich
+ * daher mit dem Eingang oder Scratch der Faltung überschneiden. Nur wenn
+ * das nicht der Fall ist, schreibt die Faltung direkt dorthin ("direkt");
+ * sonst in ihren eigenen Ausgang, und das ADD kopiert nur noch. Das
+ * Ergebnis ist in beiden Fällen bitgleich zur ungefusionierten Folge.
+ *
+ * Faltungen, die ESP-NN hier nicht rechnet (Dilation, Batch > 1, kein
+ * int8), laufen über den Standardkernel (lib/th_tflm/th_stock_kernel.h).
+ *
+ * Nur wo esp_nn_conv_add_s8 wirklich im Epilog addiert
+ * (ESP_NN_CONV_ADD_FUSED, generischer Pfad: ESP32). Auf S3/P4 laufen die
+ * Assemblerfaltung und danach das ADD über den ganzen Ausgang, das ist
+ * nicht fusioniert; dort bleibt TH_CONV_ADD_FUSED 0 und der Resolver nimmt
+ * die Standardkernel.
+ *
+ * Aktivierung über Build-Flag (platformio.ini):
+ *   -D TH_FUSE_CONV_ADD=1
+ *   -D TH_PACK_WEIGHTS=1   Filter in Prepare vorpacken (esp_nn_conv_pack_filter),
+ *                          kostet Arena in Größe der Gewichte; nur ESP32
+ *                          (S3/P4: Packgröße 0, die SIMD-Kernel bleiben)
+ *   -D TH_PACK_WEIGHTS_BUDGET=16384   höchstens so viele Arena-Bytes dafür
+ */
+
+#ifndef TH_CONV_ADD_FUSION_H_
+#define TH_CONV_ADD_FUSION_H_
+
+#ifndef TH_FUSE_CONV_ADD
+#define TH_FUSE_CONV_ADD 0
+#endif
+
+#ifndef TH_PACK_WEIGHTS
+#define TH_PACK_WEIGHTS 0
+#endif
+
+#ifndef TH_PACK_WEIGHTS_BUDGET
+#define TH_PACK_WEIGHTS_BUDGET 16384
+#endif
+
+#if TH_FUSE_CONV_ADD
+#include "sdkconfig.h"
+#include "esp_nn.h"
+#if ESP_NN_CONV_ADD_FUSED
+#define TH_CONV_ADD_FUSED 1
+#endif
+#endif
+
+#ifndef TH_CONV_ADD_FUSED
+#define TH_CONV_ADD_FUSED 0
+#endif
+
+#if TH_CONV_ADD_FUSED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tensorflow/lite/micro/micro_common.h"
+
+namespace tflite {
+struct Model;
+}
+
+// Modell für die Mustererkennung; vor AllocateTensors() aufrufen
+void fusion_init(const tflite::Model* model);
+
+// CONV_2D (ESP-NN, optional mit ADD im Epilog) und ADD (überspringt
+// fusionierte Paare, sonst das ADD von esp-tflite-micro)
+TFLMRegistration fusion_conv2d_registration(void);
+TFLMRegistration fusion_add_registration(void);
+
+// Erkannte Paare und davon direkt in den ADD-Ausgang geschriebene
+// (direct ist erst nach dem ersten Invoke() gültig)
+void fusion_get_stats(int* pairs, int* direct);
+
+// TH_PACK_WEIGHTS: vorgepackte Faltungen und deren Arena-Bytes
+void fusion_get_pack_stats(int* convs, size_t* bytes);
+
+// TH_PACK_WEIGHTS: vorgepackte Faltungen einzeln schalten (Bit i = i-te
+// vorgepackte Faltung in Modellreihenfolge, aus = Kernel auf dem Originalfilter)
+// und Arena-Bytes einer einzelnen; für den Befehl pack
+void fusion_set_pack_mask(uint32_t mask);
+size_t fusion_get_packed_bytes(int conv);
+
+#endif  // TH_CONV_ADD_FUSED
+
+#endif  // TH_CONV_ADD_FUSION_H_
@@ -0,0 +1,607 @@
+/*
+ * dw_pw_fusion.cpp
+ *
+ * DEPTHWISE_CONV_2D + CONV_2D 1x1 streifenweise (siehe dw_pw_fusion.h).
+ *
+ * Ablauf pro Invoke():
+ *   Depthwise (Paar aktiv, Speicher passt) -> esp_nn_dw_pw_conv_s8 schreibt
+ *                                             direkt den 1x1-Ausgang
+ *   CONV_2D                                -> nichts zu tun
+ * Sonst laufen beide Ops einzeln über ihre in Prepare erstellten ESP-NN-Pläne,
+ * mit denselben Quantisierungsparametern wie in esp-tflite-micro. Mit
+ * TH_PACK_WEIGHTS packt Prepare der CONV_2D Filter und Bias einmal um, die
+ * einzeln laufende Faltung nimmt dann esp_nn_conv_s8_packed.
+ * ESP-NN läuft über die _ctx-Einstiege mit dem Scratch des Knotens, die
+ * globalen Scratch-Zeiger von ESP-NN setzt hier niemand. Mit TH_NN_PARALLEL
+ * laufen die einzelnen, ungepackten Faltungen zeilenparallel über den Pool
+ * aus nn_parallel.h; der Scratch reicht dann für alle Bänder. Was ESP-NN
+ * nicht rechnet, läuft über den Standardkernel des jeweiligen Ops.
+ */
+
+#include "dw_pw_fusion.h"
+
+#if TH_FUSE_DW_PW
+
+#include <string.h>
+#include <algorithm>
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/kernels/conv.h"
+#include "tensorflow/lite/micro/kernels/depthwise_conv.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_context.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+
+#include "sdkconfig.h"
+#include "esp_nn.h"
+#include "nn_parallel.h"
+#include "th_stock_kernel.h"
+
+namespace {
+
+constexpr int kMaxPairs = 16;
+constexpr int kMaxPacked = 32;  // Bits von g_pack_mask
+
+struct PwData;
+
+struct DwPwPair {
+  int index;              // Bit in der Maske
+  int32_t mid_tensor;     // Depthwise-Ausgang = 1x1-Eingang
+  int32_t out_tensor;     // Ausgang der 1x1-Faltung
+  int32_t pw_filter;
+  int32_t pw_bias;        // -1: ohne Bias
+  PwData* pw;             // gesetzt in Prepare der CONV_2D
+  int fused_scratch_index;
+  int32_t fused_scratch_bytes;
+  size_t mid_bytes;
+  bool done;              // 1x1 in diesem Invoke() bereits gerechnet
+  bool fused_last;
+};
+
+// user_data beider Ops: OpDataConv muss vorne stehen, weil ConvPrepare()
+// und DepthwiseConvPrepare() darüber schreiben
+struct DwData {
+  tflite::OpDataConv op;
+  int scratch_index;
+  int32_t scratch_bytes;
+  DwPwPair* pair;
+  void* stock;             // Knotendaten des Standardkernels, sonst nullptr
+  dw_conv_plan_t plan;     // Kernelwahl aus Prepare
+};
+
+struct PwData {
+  tflite::OpDataConv op;
+  int scratch_index;
+  int32_t scratch_bytes;
+  DwPwPair* pair;
+  void* stock;
+  conv_plan_t plan;
+  const void* packed;      // TH_PACK_WEIGHTS: umgepackter Filter, sonst nullptr
+  int pack_id;             // Bit in g_pack_mask, -1 ohne umgepackten Filter
+};
+
+const tflite::Model* g_model = nullptr;
+DwPwPair g_pairs[kMaxPairs];
+int g_num_pairs = 0;
+uint32_t g_mask = TH_FUSE_DW_PW_MASK;
+TFLMRegistration g_dw;
+TFLMRegistration g_conv;
+int g_packed_convs = 0;
+size_t g_packed_bytes = 0;
+size_t g_packed_layer_bytes[kMaxPacked];
+uint32_t g_pack_mask = 0xffffffffu;
+
+const tflite::Operator* GetOp(int index) {
+  return g_model->subgraphs()->Get(0)->operators()->Get(index);
+}
+
+int NumOps() {
+  return (int)g_model->subgraphs()->Get(0)->operators()->size();
+}
+
+tflite::BuiltinOperator OpCode(const tflite::Operator* op) {
+  return tflite::GetBuiltinCode(g_model->operator_codes()->Get(op->opcode_index()));
+}
+
+bool IsGraphOutput(int32_t tensor) {
+  const auto* outputs = g_model->subgraphs()->Get(0)->outputs();
+  for (uint32_t i = 0; i < outputs->size(); i++) {
+    if (outputs->Get(i) == tensor) return true;
+  }
+  return false;
+}
+
+bool Overlaps(const void* a, size_t a_bytes, const void* b, size_t b_bytes) {
+  const uintptr_t a0 = (uintptr_t)a, b0 = (uintptr_t)b;
+  return a0 < b0 + b_bytes && b0 < a0 + a_bytes;
+}
+
+template <typename T>
+void* UserDataInit(TfLiteContext* context) {
+  void* raw = context->AllocatePersistentBuffer(context, sizeof(T));
+  if (raw == nullptr) return nullptr;
+  T* data = static_cast<T*>(raw);
+  data->scratch_index = -1;
+  data->scratch_bytes = 0;
+  data->pair = nullptr;
+  data->stock = nullptr;
+  return raw;
+}
+
+void FillDwParams(const TfLiteDepthwiseConvParams& params, const tflite::OpDataConv& data,
+                  dw_conv_params_t* dw) {
+  dw->in_offset = -data.input_zero_point;
+  dw->out_offset = data.output_zero_point;
+  dw->ch_mult = params.depth_multiplier;
+  dw->stride = {params.stride_width, params.stride_height};
+  dw->padding = {data.padding.width, data.padding.height};
+  dw->dilation = {1, 1};
+  dw->activation = {data.output_activation_min, data.output_activation_max};
+}
+
+void FillConvParams(const tflite::OpDataConv& data, int32_t stride_w, int32_t stride_h,
+                    conv_params_t* conv) {
+  conv->in_offset = -data.input_zero_point;
+  conv->out_offset = data.output_zero_point;
+  conv->stride = {stride_w, stride_h};
+  conv->padding = {data.padding.width, data.padding.height};
+  conv->dilation = {1, 1};
+  conv->activation = {data.output_activation_min, data.output_activation_max};
+}
+
+// NHWC-Form als ESP-NN-Dimensionen
+data_dims_t Dims(const TfLiteIntArray* d) {
+  return {d->data[2], d->data[1], d->data[3], d->data[0]};
+}
+
+
+// ---------------------------------------------------------------
+// Mustererkennung
+// ---------------------------------------------------------------
+
+// Liefert die 1x1-CONV_2D, die den Depthwise-Ausgang mid als einziger liest
+const tflite::Operator* FindPointwise(int32_t mid) {
+  const int n = NumOps();
+  int dw_index = -1;
+  for (int i = 0; i < n; i++) {
+    const auto* outputs = GetOp(i)->outputs();
+    if (outputs != nullptr && outputs->size() == 1 && outputs->Get(0) == mid) {
+      dw_index = i;
+      break;
+    }
+  }
+  if (dw_index < 0 || dw_index + 1 >= n || IsGraphOutput(mid)) return nullptr;
+
+  const tflite::Operator* pw = GetOp(dw_index + 1);
+  if (OpCode(pw) != tflite::BuiltinOperator_CONV_2D || pw->inputs()->size() < 2 ||
+      pw->inputs()->Get(0) != mid || pw->outputs()->size() != 1) {
+    return nullptr;
+  }
+  const tflite::Conv2DOptions* o = pw->builtin_options_as_Conv2DOptions();
+  if (o == nullptr || o->stride_w() != 1 || o->stride_h() != 1 ||
+      o->dilation_w_factor() != 1 || o->dilation_h_factor() != 1) {
+    return nullptr;
+  }
+  for (int i = 0; i < n; i++) {
+    if (i == dw_index + 1) continue;
+    const auto* inputs = GetOp(i)->inputs();
+    for (uint32_t k = 0; k < inputs->size(); k++) {
+      if (inputs->Get(k) == mid) return nullptr;
+    }
+  }
+  return pw;
+}
+
+// Paar anlegen und den Fusions-Scratch anfordern, falls das Muster passt
+TfLiteStatus DetectPair(TfLiteContext* context, TfLiteNode* node, const TfLiteTensor* input,
+                        const TfLiteTensor* filter, const TfLiteTensor* mid,
+                        const dw_conv_params_t& dw) {
+  if (g_model == nullptr || g_num_pairs >= kMaxPairs) return kTfLiteOk;
+  const int32_t mid_index = node->outputs->data[0];
+  const tflite::Operator* pw = FindPointwise(mid_index);
+  if (pw == nullptr) return kTfLiteOk;
+
+  tflite::MicroContext* micro_context = tflite::GetMicroContext(context);
+  TfLiteTensor* pw_filter = micro_context->AllocateTempTfLiteTensor(pw->inputs()->Get(1));
+  TfLiteTensor* out = micro_context->AllocateTempTfLiteTensor(pw->outputs()->Get(0));
+  TF_LITE_ENSURE(context, pw_filter != nullptr && out != nullptr);
+
+  TfLiteStatus status = kTfLiteOk;
+  if (pw_filter->type == kTfLiteInt8 && out->type == kTfLiteInt8 &&
+      pw_filter->dims->data[1] == 1 && pw_filter->dims->data[2] == 1 &&
+      out->dims->data[1] == mid->dims->data[1] && out->dims->data[2] == mid->dims->data[2]) {
+    DwPwPair* pair = &g_pairs[g_num_pairs];
+    memset(pair, 0, sizeof(*pair));
+    pair->index = g_num_pairs;
+    pair->mid_tensor = mid_index;
+    pair->out_tensor = pw->outputs()->Get(0);
+    pair->pw_filter = pw->inputs()->Get(1);
+    pair->pw_bias = pw->inputs()->size() > 2 ? pw->inputs()->Get(2) : -1;
+    pair->fused_scratch_index = -1;
+    pair->mid_bytes = mid->bytes;
+
+    // Für die Scratch-Größe zählen nur Geometrie und Streifenhöhe
+    const data_dims_t in_dims = Dims(input->dims);
+    const data_dims_t dw_filter_dims = {filter->dims->data[2], filter->dims->data[1],
+                                        input->dims->data[3], 1};
+    const data_dims_t pw_filter_dims = {1, 1, mid->dims->data[3], 1};
+    const data_dims_t out_dims = Dims(out->dims);
+    dw_pw_conv_params_t p = {};
+    p.dw = dw;
+    p.pw.stride = {1, 1};
+    p.pw.dilation = {1, 1};
+    p.strip_ht = TH_FUSE_DW_PW_ROWS;
+    pair->fused_scratch_bytes = esp_nn_get_dw_pw_conv_scratch_size(
+        &in_dims, &dw_filter_dims, &pw_filter_dims, &out_dims, &p);
+    status = context->RequestScratchBufferInArena(context, pair->fused_scratch_bytes,
+                                                  &pair->fused_scratch_index);
+    if (status == kTfLiteOk) {
+      static_cast<DwData*>(node->user_data)->pair = pair;
+      g_num_pairs++;
+    }
+  }
+  micro_context->DeallocateTempTfLiteTensor(pw_filter);
+  micro_context->DeallocateTempTfLiteTensor(out);
+  return status;
+}
+
+// Überschreibt ein Streifen Eingangszeilen, die spätere Streifen noch
+// lesen? Gleiche Streifengeometrie wie esp_nn_dw_pw_conv_s8.
+bool StripsSafe(const data_dims_t& in, const int8_t* in_data, const data_dims_t& out,
+                const int8_t* out_data, const dw_conv_params_t& dw,
+                const void* scratch, size_t scratch_bytes) {
+  const size_t in_row = (size_t)in.width * in.channels;
+  const size_t out_row = (size_t)out.width * out.channels;
+  const size_t in_bytes = in_row * in.height;
+  if (Overlaps(out_data, out_row * out.height, scratch, scratch_bytes)) return false;
+
+  const int32_t strip = (TH_FUSE_DW_PW_ROWS > 0 && TH_FUSE_DW_PW_ROWS < out.height)
+      ? TH_FUSE_DW_PW_ROWS : out.height;
+  for (int32_t y = 0; y < out.height; y += strip) {
+    const int32_t rows = std::min(strip, out.height - y);
+    if (y + rows >= out.height) break;
+    const int32_t next_start = std::max(0, (y + rows) * dw.stride.height - dw.padding.height);
+    const int8_t* live = in_data + next_start * in_row;
+    if (Overlaps(out_data + y * out_row, rows * out_row, live, in_data + in_bytes - live)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// ---------------------------------------------------------------
+// DEPTHWISE_CONV_2D
+// ---------------------------------------------------------------
+
+void* DwInit(TfLiteContext* context, const char* buffer, size_t length) {
+  (void)buffer;
+  (void)length;
+  return UserDataInit<DwData>(context);
+}
+
+TfLiteStatus DwPrepare(TfLiteContext* context, TfLiteNode* node) {
+  DwData* data = static_cast<DwData*>(node->user_data);
+  const auto& params = *(reinterpret_cast<TfLiteDepthwiseConvParams*>(node->builtin_data));
+
+  tflite::MicroContext* micro_context = tflite::GetMicroContext(context);
+  TfLiteTensor* input =
+      micro_context->AllocateTempInputTensor(node, tflite::kDepthwiseConvInputTensor);
+  TfLiteTensor* filter =
+      micro_context->AllocateTempInputTensor(node, tflite::kDepthwiseConvWeightsTensor);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, tflite::kDepthwiseConvOutputTensor);
+  TF_LITE_ENSURE(context, input != nullptr && filter != nullptr && output != nullptr);
+
+  // ESP-NN rechnet nur int8, Batch 1, ohne Dilation; sonst Standardkernel
+  // (ohne Paar, die 1x1-Faltung danach läuft dann einzeln)
+  if (input->type != kTfLiteInt8 || filter->type != kTfLiteInt8 ||
+      input->dims->data[0] != 1 ||
+      params.dilation_height_factor != 1 || params.dilation_width_factor != 1) {
+    micro_context->DeallocateTempTfLiteTensor(input);
+    micro_context->DeallocateTempTfLiteTensor(filter);
+    micro_context->DeallocateTempTfLiteTensor(output);
+    return th_stock_prepare(context, node, g_dw, &data->stock);
+  }
+  TF_LITE_ENSURE_STATUS(tflite::DepthwiseConvPrepare(context, node));
+
+  const data_dims_t in_dims = Dims(input->dims);
+  const data_dims_t filter_dims = {filter->dims->data[2], filter->dims->data[1],
+                                   input->dims->data[3], 1};
+  const data_dims_t out_dims = Dims(output->dims);
+  dw_conv_params_t dw;
+  FillDwParams(params, data->op, &dw);
+  // Variante und Scratch einmal pro Knoten bestimmen, Eval führt nur noch aus
+  data->scratch_bytes = esp_nn_depthwise_conv_plan_create(&data->plan, &in_dims, &filter_dims,
+                                                          &out_dims, &dw);
+#if TH_NN_PARALLEL
+  data->scratch_bytes = esp_nn_get_depthwise_conv_parallel_scratch_size(nn_parallel_pool(),
+                                                                        &data->plan);
+#endif
+  if (data->scratch_bytes > 0) {
+    TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, data->scratch_bytes, &data->scratch_index));
+  }
+
+  TfLiteStatus status = DetectPair(context, node, input, filter, output, dw);
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(filter);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return status;
+}
+
+// Paar fusioniert rechnen; false, wenn es in diesem Durchlauf nicht geht
+bool DwPwEval(TfLiteContext* context, DwPwPair* pair, const dw_conv_plan_t& dw,
+              const int8_t* in_data, const int8_t* filter_data, const int32_t* bias,
+              const quant_data_t& dw_quant) {
+  if (pair->pw == nullptr || ((g_mask >> pair->index) & 1u) == 0) return false;
+
+  const conv_plan_t& pw = pair->pw->plan;
+  const TfLiteEvalTensor* pw_filter = context->GetEvalTensor(context, pair->pw_filter);
+  const TfLiteEvalTensor* pw_bias =
+      pair->pw_bias >= 0 ? context->GetEvalTensor(context, pair->pw_bias) : nullptr;
+  int8_t* out_data =
+      tflite::micro::GetTensorData<int8_t>(context->GetEvalTensor(context, pair->out_tensor));
+  void* scratch = context->GetScratchBuffer(context, pair->fused_scratch_index);
+  if (!StripsSafe(dw.input_dims, in_data, pw.output_dims, out_data, dw.params, scratch,
+                  pair->fused_scratch_bytes)) {
+    return false;
+  }
+
+  dw_pw_conv_params_t p;
+  p.dw = dw.params;
+  p.dw_quant = dw_quant;
+  p.pw = pw.params;
+  p.pw_quant = {pair->pw->op.per_channel_output_shift, pair->pw->op.per_channel_output_multiplier};
+  p.strip_ht = TH_FUSE_DW_PW_ROWS;
+
+  esp_nn_ctx_t nn_ctx = {};
+  nn_ctx.dw_pw_scratch = scratch;
+  esp_nn_dw_pw_conv_s8_ctx(&nn_ctx, &dw.input_dims, in_data, &dw.filter_dims, filter_data, bias,
+                           &pw.filter_dims, tflite::micro::GetTensorData<int8_t>(pw_filter),
+                           tflite::micro::GetOptionalTensorData<int32_t>(pw_bias),
+                           &pw.output_dims, out_data, &p);
+  return true;
+}
+
+TfLiteStatus DwEval(TfLiteContext* context, TfLiteNode* node) {
+  DwData* data = static_cast<DwData*>(node->user_data);
+  if (data->stock != nullptr) return th_stock_invoke(context, node, g_dw, data->stock);
+
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, tflite::kDepthwiseConvInputTensor);
+  const TfLiteEvalTensor* filter =
+      tflite::micro::GetEvalInput(context, node, tflite::kDepthwiseConvWeightsTensor);
+  const TfLiteEvalTensor* bias = node->inputs->size == 3
+      ? tflite::micro::GetEvalInput(context, node, tflite::kDepthwiseConvBiasTensor) : nullptr;
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, tflite::kDepthwiseConvOutputTensor);
+
+  const quant_data_t quant = {data->op.per_channel_output_shift,
+                              data->op.per_channel_output_multiplier};
+  const int8_t* in_data = tflite::micro::GetTensorData<int8_t>(input);
+  const int8_t* filter_data = tflite::micro::GetTensorData<int8_t>(filter);
+  const int32_t* bias_data = tflite::micro::GetOptionalTensorData<int32_t>(bias);
+
+  if (data->pair != nullptr) {
+    const bool fused = DwPwEval(context, data->pair, data->plan, in_data, filter_data,
+                                bias_data, quant);
+    data->pair->done = fused;
+    data->pair->fused_last = fused;
+    if (fused) return kTfLiteOk;
+  }
+
+  void* scratch = data->scratch_index >= 0
+      ? context->GetScratchBuffer(context, data->scratch_index) : nullptr;
+  esp_nn_ctx_t nn_ctx = {};
+  nn_ctx.depthwise_scratch = scratch;
+#if TH_NN_PARALLEL
+  nn_ctx.pool = nn_parallel_pool();
+  esp_nn_depthwise_conv_s8_parallel(&nn_ctx, &data->plan, in_data, filter_data, bias_data,
+                                    tflite::micro::GetTensorData<int8_t>(output), &quant);
+#else
+  esp_nn_depthwise_conv_s8_execute_ctx(&nn_ctx, &data->plan, in_data, filter_data, bias_data,
+                                       tflite::micro::GetTensorData<int8_t>(output), &quant);
+#endif
+  return kTfLiteOk;
+}
+
+// ---------------------------------------------------------------
+// CONV_2D
+// ---------------------------------------------------------------
+
+void* PwInit(TfLiteContext* context, const char* buffer, size_t length) {
+  (void)buffer;
+  (void)length;
+  void* raw = UserDataInit<PwData>(context);
+  if (raw != nullptr) {
+    static_cast<PwData*>(raw)->packed = nullptr;
+    static_cast<PwData*>(raw)->pack_id = -1;
+  }
+  return raw;
+}
+
+#if TH_PACK_WEIGHTS
+// Filter und Bias ins Layout von esp_nn_conv_s8_packed (persistenter
+// Arena-Puffer), in Modellreihenfolge bis TH_PACK_WEIGHTS_BUDGET Bytes;
+// passt die Form oder das Budget nicht, bleibt data->packed leer
+TfLiteStatus PackWeights(TfLiteContext* context, TfLiteNode* node, const TfLiteTensor* filter,
+                         PwData* data) {
+  const int packed_bytes = esp_nn_get_conv_packed_filter_size(&data->plan);
+  if (packed_bytes <= 0 || g_packed_bytes + packed_bytes > TH_PACK_WEIGHTS_BUDGET) {
+    return kTfLiteOk;
+  }
+  void* packed = context->AllocatePersistentBuffer(context, packed_bytes);
+  TF_LITE_ENSURE(context, packed != nullptr);
+
+  tflite::MicroContext* micro_context = tflite::GetMicroContext(context);
+  TfLiteTensor* bias = micro_context->AllocateTempInputTensor(node, tflite::kConvBiasTensor);
+  esp_nn_conv_pack_filter(&data->plan, filter->data.int8,
+                          bias != nullptr ? bias->data.i32 : nullptr, packed);
+  if (bias != nullptr) micro_context->DeallocateTempTfLiteTensor(bias);
+
+  data->packed = packed;
+  data->pack_id = g_packed_convs;
+  if (g_packed_convs < kMaxPacked) g_packed_layer_bytes[g_packed_convs] = packed_bytes;
+  data->scratch_bytes = std::max(data->scratch_bytes,
+                                 (int32_t)esp_nn_get_conv_packed_scratch_size(&data->plan));
+  g_packed_convs++;
+  g_packed_bytes += packed_bytes;
+  return kTfLiteOk;
+}
+#endif
+
+// Umgepackter Filter, sofern nicht per dwpw_set_pack_mask abgeschaltet
+const void* ActivePacked(const PwData* data) {
+  if (data->packed == nullptr || data->pack_id >= kMaxPacked) return data->packed;
+  return (g_pack_mask >> data->pack_id) & 1u ? data->packed : nullptr;
+}
+
+TfLiteStatus PwPrepare(TfLiteContext* context, TfLiteNode* node) {
+  PwData* data = static_cast<PwData*>(node->user_data);
+  const auto& params = *(reinterpret_cast<TfLiteConvParams*>(node->builtin_data));
+
+  tflite::MicroContext* micro_context = tflite::GetMicroContext(context);
+  TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, tflite::kConvInputTensor);
+  TfLiteTensor* filter = micro_context->AllocateTempInputTensor(node, tflite::kConvWeightsTensor);
+  TfLiteTensor* output = micro_context->AllocateTempOutputTensor(node, tflite::kConvOutputTensor);
+  TF_LITE_ENSURE(context, input != nullptr && filter != nullptr && output != nullptr);
+
+  // Wie bei der Depthwise-Faltung; ein Paar bekommt diese Faltung dann nicht
+  if (input->type != kTfLiteInt8 || filter->type != kTfLiteInt8 ||
+      input->dims->data[0] != 1 ||
+      params.dilation_height_factor != 1 || params.dilation_width_factor != 1) {
+    micro_context->DeallocateTempTfLiteTensor(input);
+    micro_context->DeallocateTempTfLiteTensor(filter);
+    micro_context->DeallocateTempTfLiteTensor(output);
+    return th_stock_prepare(context, node, g_conv, &data->stock);
+  }
+  TF_LITE_ENSURE_STATUS(tflite::ConvPrepare(context, node));
+
+  const data_dims_t in_dims = Dims(input->dims);
+  const data_dims_t filter_dims = {filter->dims->data[2], filter->dims->data[1],
+                                   filter->dims->data[3], 1};
+  const data_dims_t out_dims = Dims(output->dims);
+  conv_params_t conv;
+  FillConvParams(data->op, params.stride_width, params.stride_height, &conv);
+  data->scratch_bytes = esp_nn_conv_plan_create(&data->plan, &in_dims, &filter_dims, &out_dims, &conv);
+#if TH_NN_PARALLEL
+  data->scratch_bytes = esp_nn_get_conv_parallel_scratch_size(nn_parallel_pool(), &data->plan);
+#endif
+#if TH_PACK_WEIGHTS
+  TF_LITE_ENSURE_STATUS(PackWeights(context, node, filter, data));
+#endif
+  if (data->scratch_bytes > 0) {
+    TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, data->scratch_bytes, &data->scratch_index));
+  }
+
+  // Zweite Hälfte eines Paares? Die Depthwise-Faltung davor ist schon vorbereitet.
+  for (int i = 0; i < g_num_pairs; i++) {
+    if (g_pairs[i].mid_tensor == node->inputs->data[0]) {
+      g_pairs[i].pw = data;
+      data->pair = &g_pairs[i];
+    }
+  }
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(filter);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return kTfLiteOk;
+}
+
+TfLiteStatus PwEval(TfLiteContext* context, TfLiteNode* node) {
+  PwData* data = static_cast<PwData*>(node->user_data);
+  if (data->stock != nullptr) return th_stock_invoke(context, node, g_conv, data->stock);
+  if (data->pair != nullptr && data->pair->done) {
+    data->pair->done = false;
+    return kTfLiteOk;
+  }
+
+  const TfLiteEvalTensor* input = tflite::micro::GetEvalInput(context, node, tflite::kConvInputTensor);
+  const TfLiteEvalTensor* filter = tflite::micro::GetEvalInput(context, node, tflite::kConvWeightsTensor);
+  const TfLiteEvalTensor* bias = node->inputs->size == 3
+      ? tflite::micro::GetEvalInput(context, node, tflite::kConvBiasTensor) : nullptr;
+  TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, tflite::kConvOutputTensor);
+  const quant_data_t quant = {data->op.per_channel_output_shift,
+                              data->op.per_channel_output_multiplier};
+
+  void* scratch = data->scratch_index >= 0
+      ? context->GetScratchBuffer(context, data->scratch_index) : nullptr;
+  esp_nn_ctx_t nn_ctx = {};
+  nn_ctx.conv_scratch = scratch;
+  const void* packed = ActivePacked(data);
+  if (packed != nullptr) {
+    esp_nn_conv_s8_packed_ctx(&nn_ctx, &data->plan, tflite::micro::GetTensorData<int8_t>(input),
+                              packed, tflite::micro::GetTensorData<int8_t>(output), &quant);
+    return kTfLiteOk;
+  }
+#if TH_NN_PARALLEL
+  nn_ctx.pool = nn_parallel_pool();
+  esp_nn_conv_s8_parallel(&nn_ctx, &data->plan, tflite::micro::GetTensorData<int8_t>(input),
+                          tflite::micro::GetTensorData<int8_t>(filter),
+                          tflite::micro::GetOptionalTensorData<int32_t>(bias),
+                          tflite::micro::GetTensorData<int8_t>(output), &quant);
+#else
+  esp_nn_conv_s8_execute_ctx(&nn_ctx, &data->plan, tflite::micro::GetTensorData<int8_t>(input),
+                             tflite::micro::GetTensorData<int8_t>(filter),
+                             tflite::micro::GetOptionalTensorData<int32_t>(bias),
+                             tflite::micro::GetTensorData<int8_t>(output), &quant);
+#endif
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+void dwpw_init(const tflite::Model* model) {
+  g_model = model;
+  g_num_pairs = 0;
+  g_packed_convs = 0;
+  g_packed_bytes = 0;
+}
+
+TFLMRegistration dwpw_depthwise_registration(void) {
+  g_dw = tflite::Register_DEPTHWISE_CONV_2D();
+  return tflite::micro::RegisterOp(DwInit, DwPrepare, DwEval);
+}
+
+TFLMRegistration dwpw_conv2d_registration(void) {
+  g_conv = tflite::Register_CONV_2D();
+  return tflite::micro::RegisterOp(PwInit, PwPrepare, PwEval);
+}
+
+void dwpw_set_mask(uint32_t mask) {
+  g_mask = mask;
+}
+
+uint32_t dwpw_get_mask(void) {
+  return g_mask;
+}
+
+void dwpw_set_pack_mask(uint32_t mask) {
+  g_pack_mask = mask;
+}
+
+size_t dwpw_get_packed_bytes(int conv) {
+  return conv >= 0 && conv < g_packed_convs && conv < kMaxPacked
+      ? g_packed_layer_bytes[conv] : 0;
+}
+
+void dwpw_get_stats(DwPwStats* stats) {
+  memset(stats, 0, sizeof(*stats));
+  stats->pairs = g_num_pairs;
+  stats->packed = g_packed_convs;
+  stats->packed_bytes = g_packed_bytes;
+  for (int i = 0; i < g_num_pairs; i++) {
+    const DwPwPair& pair = g_pairs[i];
+    stats->strip_bytes = std::max(stats->strip_bytes, (size_t)pair.fused_scratch_bytes);
+    if (pair.fused_last) {
+      stats->fused++;
+      stats->mid_bytes += pair.mid_bytes;
+    }
+  }
+}
+
+#endif  // TH_FUSE_DW_PW
@@ -0,0 +1,113 @@
+/*
+ * dw_pw_fusion.h
+ *
+ * Fusion von DEPTHWISE_CONV_2D + CONV_2D 1x1 in kws01 (DS-CNN) und vww01
+ * (MobileNetV1).
+ *
+ * Ohne Fusion schreibt die Depthwise-Faltung ihren ganzen Ausgang in die
+ * Arena, die 1x1-Faltung liest ihn danach vollständig wieder. Mit Fusion
+ * rechnet esp_nn_dw_pw_conv_s8 immer nur einen Streifen von
+ * TH_FUSE_DW_PW_ROWS Depthwise-Zeilen in einen kleinen Scratch und gibt ihn
+ * sofort an die 1x1-Stufe weiter; die CONV_2D wird dann übersprungen.
+ *
+ * Muster (am Flatbuffer, in Prepare der Depthwise-Faltung):
+ *   - das nächste Op ist CONV_2D 1x1, Stride 1, und liest den
+ *     Depthwise-Ausgang als einzigen Leser (kein Modellausgang),
+ *   - int8, Batch 1, ohne Dilation.
+ * Die Paare werden in Modellreihenfolge gezählt; Bit i von
+ * TH_FUSE_DW_PW_MASK (zur Laufzeit: Befehl "dwpw mask HEX") schaltet Paar i.
+ *
+ * Der Ausgang der 1x1-Faltung lebt laut Speicherplaner erst ab dem zweiten
+ * Op und darf den Depthwise-Eingang überdecken. Vor jedem Lauf wird daher
+ * geprüft, ob ein Streifen Eingangszeilen überschreibt, die spätere
+ * Streifen noch brauchen, oder den Scratch trifft; dann läuft das Paar in
+ * diesem Durchlauf ungefusioniert.
+ *
+ * Arena: Die Fusion spart Speicherverkehr, keine Arena. Der Zwischentensor
+ * bleibt im Plan von TFLM, weil ungefusionierte Läufe (Maske, Prüfung oben)
+ * ihn brauchen. Ihn nur aus dem Plan zu nehmen hilft auch nicht: Eingang und
+ * Ausgang leben dann gleichzeitig, in + out ist bei Stride 1 gleich dem
+ * heutigen max(in + mid, mid + out) und bei Stride 2 größer (vww01-Paare
+ * 1/3/5/11: +9216/+4608/+2304/+1152 Byte). Sinken würde die Spitze erst,
+ * wenn ein eigener Plan den Ausgang streifenweise über den Eingang legt
+ * (kws01 16000 -> 8490 Byte, vww01 55296 -> 46080 Byte bei ROWS=2); dann
+ * gibt es aber keinen ungefusionierten Rückfall mehr. Zahlen pro Paar:
+ * tools/dwpw_arena.py.
+ *
+ * Depthwise- oder CONV_2D-Knoten, die ESP-NN nicht rechnet (Dilation,
+ * Batch > 1, kein int8), laufen über den Standardkernel
+ * (lib/th_tflm/th_stock_kernel.h) und gehören zu keinem Paar.
+ *
+ * Aktivierung über Build-Flags (platformio.ini):
+ *   -D TH_FUSE_DW_PW=1
+ *   -D TH_FUSE_DW_PW_ROWS=2        Depthwise-Zeilen pro Streifen
+ *   -D TH_FUSE_DW_PW_MASK=0xffff   Paare, die fusioniert laufen
+ *   -D TH_PACK_WEIGHTS=1           einzeln laufende CONV_2D mit vorgepacktem
+ *                                  Filter (siehe conv_add_fusion.h)
+ *   -D TH_PACK_WEIGHTS_BUDGET=16384
+ */
+
+#ifndef TH_DW_PW_FUSION_H_
+#define TH_DW_PW_FUSION_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef TH_FUSE_DW_PW
+#define TH_FUSE_DW_PW 0
+#endif
+
+#ifndef TH_FUSE_DW_PW_ROWS
+#define TH_FUSE_DW_PW_ROWS 2
+#endif
+
+#ifndef TH_FUSE_DW_PW_MASK
+#define TH_FUSE_DW_PW_MASK 0xffffffffu
+#endif
+
+#ifndef TH_PACK_WEIGHTS
+#define TH_PACK_WEIGHTS 0
+#endif
+
+#ifndef TH_PACK_WEIGHTS_BUDGET
+#define TH_PACK_WEIGHTS_BUDGET 16384
+#endif
+
+#if TH_FUSE_DW_PW
+
+#include "tensorflow/lite/micro/micro_common.h"
+
+namespace tflite {
+struct Model;
+}
+
+// Modell für die Mustererkennung; vor AllocateTensors() aufrufen
+void dwpw_init(const tflite::Model* model);
+
+// DEPTHWISE_CONV_2D (ESP-NN, gefusioniert mit der folgenden 1x1-Faltung)
+// und CONV_2D (überspringt gefusionierte Paare, sonst ESP-NN)
+TFLMRegistration dwpw_depthwise_registration(void);
+TFLMRegistration dwpw_conv2d_registration(void);
+
+// Paare einzeln ein-/ausschalten (Bit i = Paar i in Modellreihenfolge)
+void dwpw_set_mask(uint32_t mask);
+uint32_t dwpw_get_mask(void);
+
+struct DwPwStats {
+  int pairs;            // erkannte Paare
+  int fused;            // im letzten Invoke() gefusioniert gelaufen
+  size_t mid_bytes;     // Zwischentensoren der gefusionierten Paare
+  size_t strip_bytes;   // größter Fusions-Scratch
+  int packed;           // TH_PACK_WEIGHTS: vorgepackte CONV_2D
+  size_t packed_bytes;  // deren Arena-Bytes
+};
+void dwpw_get_stats(DwPwStats* stats);
+
+// TH_PACK_WEIGHTS: vorgepackte CONV_2D einzeln schalten (Bit i = i-te
+// vorgepackte in Modellreihenfolge) und Arena-Bytes einer einzelnen
+void dwpw_set_pack_mask(uint32_t mask);
+size_t dwpw_get_packed_bytes(int conv);
+
+#endif  // TH_FUSE_DW_PW
+
+#endif  // TH_DW_PW_FUSION_H_
@@ -0,0 +1,146 @@
+/*
+ * fc_plan.cpp
+ *
+ * FULLY_CONNECTED mit Kanaltabelle (siehe fc_plan.h).
+ *
+ * Prepare rechnet die Quantisierung wie esp-tflite-micro
+ * (CalculateOpDataFullyConnected) und füllt die Tabelle aus den konstanten
+ * Gewichten; Eval ruft pro Batchzeile esp_nn_fully_connected_s8_planned.
+ * Alles andere läuft über den Standardkernel.
+ */
+
+#include "fc_plan.h"
+
+#if TH_FC_PLAN
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/kernels/fully_connected.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_context.h"
+
+#include "sdkconfig.h"
+#include "esp_nn.h"
+#include "th_stock_kernel.h"
+
+namespace {
+
+struct FcPlanData {
+  tflite::OpDataFullyConnected op;
+  int32_t* row_term;   // input_offset * sum(f) + bias pro Ausgangskanal
+  void* stock;         // Knotendaten des Standardkernels, sonst nullptr
+};
+
+TFLMRegistration g_fc;
+int g_layers = 0;
+size_t g_bytes = 0;
+
+// Eine Skala für den ganzen Filter (der Standardfall bei FULLY_CONNECTED)
+bool PerTensor(const TfLiteTensor* filter) {
+  if (filter->quantization.type != kTfLiteAffineQuantization) return false;
+  const auto* q = static_cast<const TfLiteAffineQuantization*>(filter->quantization.params);
+  return q != nullptr && q->scale != nullptr && q->scale->size == 1;
+}
+
+void* FcPlanInit(TfLiteContext* context, const char* buffer, size_t length) {
+  (void)buffer;
+  (void)length;
+  void* raw = context->AllocatePersistentBuffer(context, sizeof(FcPlanData));
+  if (raw == nullptr) return nullptr;
+  FcPlanData* data = static_cast<FcPlanData*>(raw);
+  data->row_term = nullptr;
+  data->stock = nullptr;
+  return raw;
+}
+
+TfLiteStatus FcPlanPrepare(TfLiteContext* context, TfLiteNode* node) {
+  FcPlanData* data = static_cast<FcPlanData*>(node->user_data);
+  const auto* params = static_cast<const TfLiteFullyConnectedParams*>(node->builtin_data);
+
+  tflite::MicroContext* micro_context = tflite::GetMicroContext(context);
+  TfLiteTensor* input =
+      micro_context->AllocateTempInputTensor(node, tflite::kFullyConnectedInputTensor);
+  TfLiteTensor* filter =
+      micro_context->AllocateTempInputTensor(node, tflite::kFullyConnectedWeightsTensor);
+  TfLiteTensor* bias =
+      micro_context->AllocateTempInputTensor(node, tflite::kFullyConnectedBiasTensor);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, tflite::kFullyConnectedOutputTensor);
+  TF_LITE_ENSURE(context, input != nullptr && filter != nullptr && output != nullptr);
+
+  const int out_channels = filter->dims->data[0];
+  const int row_len = filter->dims->data[1];
+  const int table_bytes = esp_nn_get_fully_connected_plan_size(out_channels);
+  TfLiteStatus status = kTfLiteOk;
+  if (table_bytes <= 0 || input->type != kTfLiteInt8 || filter->type != kTfLiteInt8 ||
+      filter->data.int8 == nullptr || !PerTensor(filter)) {
+    // S3 (Assemblerkernel), Float, per Kanal oder Gewichte nicht konstant
+    status = th_stock_prepare(context, node, g_fc, &data->stock);
+  } else {
+    status = tflite::CalculateOpDataFullyConnected(context, params->activation, input->type,
+                                                   input, filter, bias, output, &data->op);
+    if (status == kTfLiteOk) {
+      data->row_term =
+          static_cast<int32_t*>(context->AllocatePersistentBuffer(context, table_bytes));
+      TF_LITE_ENSURE(context, data->row_term != nullptr);
+      esp_nn_fully_connected_plan(filter->data.int8, -data->op.input_zero_point, row_len,
+                                  bias != nullptr ? bias->data.i32 : nullptr, out_channels,
+                                  data->row_term);
+      g_layers++;
+      g_bytes += table_bytes;
+    }
+  }
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(filter);
+  if (bias != nullptr) micro_context->DeallocateTempTfLiteTensor(bias);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return status;
+}
+
+TfLiteStatus FcPlanEval(TfLiteContext* context, TfLiteNode* node) {
+  FcPlanData* data = static_cast<FcPlanData*>(node->user_data);
+  if (data->stock != nullptr) return th_stock_invoke(context, node, g_fc, data->stock);
+
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, tflite::kFullyConnectedInputTensor);
+  const TfLiteEvalTensor* filter =
+      tflite::micro::GetEvalInput(context, node, tflite::kFullyConnectedWeightsTensor);
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, tflite::kFullyConnectedOutputTensor);
+
+  const int32_t out_channels = filter->dims->data[0];
+  const int32_t row_len = filter->dims->data[1];
+  const int32_t batches = tflite::micro::GetTensorShape(input).FlatSize() / row_len;
+  const int8_t* in_data = tflite::micro::GetTensorData<int8_t>(input);
+  const int8_t* filter_data = tflite::micro::GetTensorData<int8_t>(filter);
+  int8_t* out_data = tflite::micro::GetTensorData<int8_t>(output);
+
+  for (int32_t b = 0; b < batches; b++) {
+    esp_nn_fully_connected_s8_planned(in_data, -data->op.input_zero_point, row_len,
+                                      filter_data, -data->op.filter_zero_point, data->row_term,
+                                      out_data, out_channels, data->op.output_zero_point,
+                                      data->op.output_shift, data->op.output_multiplier,
+                                      data->op.output_activation_min,
+                                      data->op.output_activation_max);
+    in_data += row_len;
+    out_data += out_channels;
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+TFLMRegistration fc_plan_registration(void) {
+  g_fc = tflite::Register_FULLY_CONNECTED();
+  g_layers = 0;
+  g_bytes = 0;
+  return tflite::micro::RegisterOp(FcPlanInit, FcPlanPrepare, FcPlanEval);
+}
+
+void fc_plan_get_stats(int* layers, size_t* bytes) {
+  *layers = g_layers;
+  *bytes = g_bytes;
+}
+
+#endif  // TH_FC_PLAN
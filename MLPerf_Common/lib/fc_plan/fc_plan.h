@@ -0,0 +1,43 @@
+/*
+ * fc_plan.h
+ *
+ * FULLY_CONNECTED mit Kanaltabelle aus Prepare (ESP-NN, generischer Pfad).
+ *
+ * Der Standardkernel ruft esp_nn_fully_connected_s8 bei jedem Invoke() mit
+ * den rohen Gewichten auf; der C-Kernel summiert dabei jede Filterzeile neben
+ * dem Skalarprodukt mit, nur um input_offset * sum(f) + bias zu bilden. Das
+ * hängt allein von den Gewichten ab. Prepare legt es hier einmal pro Schicht
+ * als int32-Tabelle in der Arena an (esp_nn_fully_connected_plan), Eval ruft
+ * esp_nn_fully_connected_s8_planned. Das Ergebnis ist bitgleich.
+ *
+ * Kosten: 4 Bytes Arena pro Ausgangskanal (ad01: 6,5 KB für alle zehn
+ * Schichten). Auf dem S3 liefert esp_nn_get_fully_connected_plan_size 0,
+ * dort bleibt der Assemblerkernel; ebenso laufen per-Kanal-quantisierte
+ * oder nicht-int8-Schichten über den Standardkernel.
+ *
+ * Aktivierung über Build-Flag (platformio.ini):
+ *   -D TH_FC_PLAN=1
+ */
+
+#ifndef TH_FC_PLAN_H_
+#define TH_FC_PLAN_H_
+
+#ifndef TH_FC_PLAN
+#define TH_FC_PLAN 0
+#endif
+
+#if TH_FC_PLAN
+
+#include <stddef.h>
+
+#include "tensorflow/lite/micro/micro_common.h"
+
+// FULLY_CONNECTED mit Tabelle, sonst der von esp-tflite-micro
+TFLMRegistration fc_plan_registration(void);
+
+// Schichten mit Tabelle und deren Arena-Bytes (nach AllocateTensors())
+void fc_plan_get_stats(int* layers, size_t* bytes);
+
+#endif  // TH_FC_PLAN
+
+#endif  // TH_FC_PLAN_H_
@@ -0,0 +1,321 @@
+/*
+ * m7_cache.cpp
+ *
+ * Direkter Zugriff auf die Systemregister des Cortex-M7 (ARMv7-M, gleiche
+ * Adressen auf i.MX RT1062 und STM32H747), damit dieselbe Datei ohne
+ * CMSIS- oder Teensy-Header auf beiden Boards läuft. Ablauf der Cache-
+ * Wartung wie SCB_EnableDCache()/SCB_DisableDCache() in CMSIS.
+ */
+
+#include "m7_cache.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace {
+
+#define M7_REG(addr) (*(volatile uint32_t*)(addr))
+
+// System Control Block
+#define M7_CCR M7_REG(0xE000ED14)
+#define M7_CCSIDR M7_REG(0xE000ED80)
+#define M7_CSSELR M7_REG(0xE000ED84)
+#define M7_CCR_DC (1u << 16)
+#define M7_CCR_IC (1u << 17)
+
+// MPU
+#define M7_MPU_TYPE M7_REG(0xE000ED90)
+#define M7_MPU_CTRL M7_REG(0xE000ED94)
+#define M7_MPU_RNR M7_REG(0xE000ED98)
+#define M7_MPU_RBAR M7_REG(0xE000ED9C)
+#define M7_MPU_RASR M7_REG(0xE000EDA0)
+#define M7_MPU_CTRL_ENABLE (1u << 0)
+#define M7_MPU_CTRL_PRIVDEFENA (1u << 2)
+
+// Cache-Wartung
+#define M7_ICIALLU M7_REG(0xE000EF50)
+#define M7_DCISW M7_REG(0xE000EF60)
+#define M7_DCCISW M7_REG(0xE000EF74)
+
+// TCM-Konfiguration
+#define M7_ITCMCR M7_REG(0xE000EF90)
+#define M7_DTCMCR M7_REG(0xE000EF94)
+
+// RASR: voller Zugriff, TEX/C/B für normalen Speicher, nicht shareable
+// (shareable würde der M7 nicht im D-Cache halten)
+constexpr uint32_t kRasrXN = 1u << 28;
+constexpr uint32_t kRasrFullAccess = 3u << 24;
+constexpr uint32_t kRasrWBWA = (1u << 19) | (1u << 17) | (1u << 16);  // TEX=1 C B
+constexpr uint32_t kRasrWT = (1u << 17);                               // TEX=0 C
+constexpr uint32_t kRasrNC = (1u << 19);                               // TEX=1
+
+const char* const kPolicyNames[] = {"default", "wbwa", "wt", "nc", "dcoff", "off"};
+constexpr int kNumPolicies = sizeof(kPolicyNames) / sizeof(kPolicyNames[0]);
+
+struct Range {
+  uintptr_t start;
+  size_t bytes;
+  bool tcm;
+};
+
+struct SavedRegion {
+  uint32_t rbar;
+  uint32_t rasr;
+};
+
+bool g_ready = false;
+int g_policy = TH_CACHE_POLICY_DEFAULT;
+bool g_prewarm = TH_CACHE_PREWARM != 0;
+Range g_arena = {0, 0, false};
+Range g_model = {0, 0, false};
+int g_arena_region = -1;
+int g_model_region = -1;
+uint32_t g_boot_ccr = 0;
+uint32_t g_boot_mpu_ctrl = 0;
+SavedRegion g_boot_regions[2];
+const char* g_arena_attr = "default";
+const char* g_model_attr = "default";
+
+inline void Dsb() {
+  __asm__ volatile("dsb 0xF" ::: "memory");
+}
+
+inline void Isb() {
+  __asm__ volatile("isb 0xF" ::: "memory");
+}
+
+inline uint32_t IrqSave() {
+  uint32_t primask;
+  __asm__ volatile("mrs %0, primask" : "=r"(primask));
+  __asm__ volatile("cpsid i" ::: "memory");
+  return primask;
+}
+
+inline void IrqRestore(uint32_t primask) {
+  __asm__ volatile("msr primask, %0" ::"r"(primask) : "memory");
+}
+
+// TCM-Größe in Bytes aus ITCMCR/DTCMCR (SZ: 0 = keins, 3 = 4 KB, 4 = 8 KB, ...)
+size_t TcmBytes(uint32_t cr) {
+  const uint32_t sz = (cr >> 3) & 0xF;
+  return sz < 3 ? 0 : (size_t)1024 << (sz - 1);
+}
+
+bool InTcm(uintptr_t addr) {
+  const size_t itcm = TcmBytes(M7_ITCMCR);
+  const size_t dtcm = TcmBytes(M7_DTCMCR);
+  return (addr < itcm) || (addr >= 0x20000000 && addr < 0x20000000 + dtcm);
+}
+
+// Alle Zeilen des D-Cache über Set/Way, op = DCISW oder DCCISW
+void DCacheAllSetWay(volatile uint32_t* op) {
+  M7_CSSELR = 0;
+  Dsb();
+  const uint32_t ccsidr = M7_CCSIDR;
+  uint32_t sets = (ccsidr >> 13) & 0x7FFF;
+  do {
+    uint32_t ways = (ccsidr >> 3) & 0x3FF;
+    do {
+      *op = ((sets << 5) & 0x3FE0u) | ((ways << 30) & 0xC0000000u);
+    } while (ways-- != 0);
+  } while (sets-- != 0);
+  Dsb();
+}
+
+void SetDCache(bool on) {
+  const bool is_on = (M7_CCR & M7_CCR_DC) != 0;
+  if (on == is_on) return;
+  if (on) {
+    DCacheAllSetWay(&M7_DCISW);
+    M7_CCR |= M7_CCR_DC;
+  } else {
+    M7_CSSELR = 0;
+    Dsb();
+    M7_CCR &= ~M7_CCR_DC;
+    Dsb();
+    DCacheAllSetWay(&M7_DCCISW);
+  }
+  Dsb();
+  Isb();
+}
+
+void SetICache(bool on) {
+  const bool is_on = (M7_CCR & M7_CCR_IC) != 0;
+  if (on == is_on) return;
+  Dsb();
+  Isb();
+  if (on) {
+    M7_ICIALLU = 0;
+    Dsb();
+    Isb();
+    M7_CCR |= M7_CCR_IC;
+  } else {
+    M7_CCR &= ~M7_CCR_IC;
+    M7_ICIALLU = 0;
+  }
+  Dsb();
+  Isb();
+}
+
+void WriteRegion(int index, uint32_t rbar, uint32_t rasr) {
+  M7_MPU_RNR = (uint32_t)index;
+  M7_MPU_RASR = 0;  // erst abschalten, dann umkonfigurieren
+  M7_MPU_RBAR = rbar & ~0x1Fu;
+  M7_MPU_RASR = rasr;
+}
+
+// Kleinste Zweierpotenz-Region, die den Bereich überdeckt; Subregionen ohne
+// Überschneidung werden abgeschaltet.
+void SetRegion(int index, const Range& r, uint32_t attr) {
+  const uintptr_t end = r.start + r.bytes;
+  uint32_t log2 = 5;
+  uintptr_t base = r.start & ~(uintptr_t)31;
+  while (log2 < 32) {
+    base = r.start & ~(((uintptr_t)1 << log2) - 1);
+    if ((uint64_t)base + ((uint64_t)1 << log2) >= end) break;
+    log2++;
+  }
+  uint32_t srd = 0;
+  if (log2 >= 8) {
+    const uint64_t sub = ((uint64_t)1 << log2) / 8;
+    for (uint32_t i = 0; i < 8; i++) {
+      const uint64_t s = (uint64_t)base + i * sub;
+      if (s + sub <= r.start || s >= end) srd |= 1u << i;
+    }
+  }
+  WriteRegion(index, (uint32_t)base,
+              attr | kRasrFullAccess | (srd << 8) | ((log2 - 1) << 1) | 1u);
+}
+
+void Touch(const Range& r) {
+  if (r.bytes == 0 || r.tcm) return;
+  volatile uint32_t sink = 0;
+  const uintptr_t end = r.start + r.bytes;
+  for (uintptr_t p = r.start & ~(uintptr_t)31; p < end; p += 32) {
+    sink += *(volatile const uint32_t*)p;
+  }
+  (void)sink;
+}
+
+}  // namespace
+
+void m7_cache_init(const void* arena, size_t arena_bytes, const void* model, size_t model_bytes) {
+  g_arena = {(uintptr_t)arena, arena_bytes, InTcm((uintptr_t)arena)};
+  g_model = {(uintptr_t)model, model_bytes, InTcm((uintptr_t)model)};
+  if (g_ready) return;
+
+  // Die beiden höchsten Regionen; ihre Boot-Belegung wird für "default" gesichert
+  const int regions = (int)((M7_MPU_TYPE >> 8) & 0xFF);
+  if (regions < 2) return;
+  g_arena_region = regions - 1;
+  g_model_region = regions - 2;
+  g_boot_ccr = M7_CCR;
+  g_boot_mpu_ctrl = M7_MPU_CTRL;
+  const int saved[2] = {g_arena_region, g_model_region};
+  for (int i = 0; i < 2; i++) {
+    M7_MPU_RNR = (uint32_t)saved[i];
+    g_boot_regions[i].rbar = M7_MPU_RBAR;
+    g_boot_regions[i].rasr = M7_MPU_RASR;
+  }
+  g_ready = true;
+}
+
+bool m7_cache_apply(int policy) {
+  if (!g_ready || policy < 0 || policy >= kNumPolicies) return false;
+
+  const uint32_t primask = IrqSave();
+  // Nichts Schmutziges im Cache lassen, bevor sich Attribute ändern
+  if (M7_CCR & M7_CCR_DC) DCacheAllSetWay(&M7_DCCISW);
+
+  WriteRegion(g_arena_region, g_boot_regions[0].rbar, g_boot_regions[0].rasr);
+  WriteRegion(g_model_region, g_boot_regions[1].rbar, g_boot_regions[1].rasr);
+  g_arena_attr = g_arena.tcm ? "tcm" : "default";
+  g_model_attr = g_model.tcm ? "tcm" : "default";
+
+  uint32_t arena_attr = 0;
+  uint32_t model_attr = 0;
+  if (policy == TH_CACHE_POLICY_WBWA) {
+    arena_attr = kRasrWBWA;
+    model_attr = kRasrWBWA;
+  } else if (policy == TH_CACHE_POLICY_WT) {
+    arena_attr = kRasrWT;
+  } else if (policy == TH_CACHE_POLICY_NC) {
+    arena_attr = kRasrNC;
+  }
+  if (arena_attr != 0 && !g_arena.tcm && g_arena.bytes != 0) {
+    // Arena enthält nur Daten
+    SetRegion(g_arena_region, g_arena, arena_attr | kRasrXN);
+    g_arena_attr = kPolicyNames[policy];
+  }
+  if (model_attr != 0 && !g_model.tcm && g_model.bytes != 0) {
+    // Kein XN: Randsubregionen im Flash können Code enthalten
+    SetRegion(g_model_region, g_model, model_attr);
+    g_model_attr = kPolicyNames[policy];
+  }
+
+  if (policy == TH_CACHE_POLICY_DEFAULT) {
+    M7_MPU_CTRL = g_boot_mpu_ctrl;
+  } else {
+    // Außerhalb der Regionen gilt die Standard-Speicherkarte
+    M7_MPU_CTRL = g_boot_mpu_ctrl | M7_MPU_CTRL_ENABLE | M7_MPU_CTRL_PRIVDEFENA;
+  }
+  Dsb();
+  Isb();
+
+  bool dcache = true;
+  bool icache = true;
+  if (policy == TH_CACHE_POLICY_DEFAULT) {
+    dcache = (g_boot_ccr & M7_CCR_DC) != 0;
+    icache = (g_boot_ccr & M7_CCR_IC) != 0;
+  } else if (policy == TH_CACHE_POLICY_DCOFF) {
+    dcache = false;
+  } else if (policy == TH_CACHE_POLICY_OFF) {
+    dcache = false;
+    icache = false;
+  }
+  SetDCache(dcache);
+  SetICache(icache);
+  // Zeilen mit alten Attributen verwerfen
+  if (M7_CCR & M7_CCR_DC) DCacheAllSetWay(&M7_DCCISW);
+  IrqRestore(primask);
+
+  g_policy = policy;
+  return true;
+}
+
+int m7_cache_policy(void) {
+  return g_policy;
+}
+
+const char* m7_cache_policy_name(int policy) {
+  return (policy >= 0 && policy < kNumPolicies) ? kPolicyNames[policy] : "unknown";
+}
+
+int m7_cache_policy_from_name(const char* name) {
+  for (int i = 0; i < kNumPolicies; i++) {
+    if (strcmp(name, kPolicyNames[i]) == 0) return i;
+  }
+  return -1;
+}
+
+void m7_cache_set_prewarm(bool on) {
+  g_prewarm = on;
+}
+
+bool m7_cache_prewarm_enabled(void) {
+  return g_prewarm;
+}
+
+void m7_cache_prewarm(void) {
+  if (!g_prewarm || (M7_CCR & M7_CCR_DC) == 0) return;
+  // Arena zuletzt: sie wird im ersten Operator zuerst gebraucht
+  Touch(g_model);
+  Touch(g_arena);
+}
+
+void m7_cache_describe(char* buf, size_t size) {
+  snprintf(buf, size, "policy=%s,dcache=%s,icache=%s,arena=%s,model=%s,prewarm=%s",
+           m7_cache_policy_name(g_policy), (M7_CCR & M7_CCR_DC) ? "on" : "off",
+           (M7_CCR & M7_CCR_IC) ? "on" : "off", g_arena_attr, g_model_attr,
+           g_prewarm ? "on" : "off");
+}
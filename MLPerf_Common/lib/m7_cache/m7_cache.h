@@ -0,0 +1,72 @@
+/*
+ * m7_cache.h
+ *
+ * Cache-/MPU-Richtlinie für Cortex-M7-Boards (Teensy 4.0, GIGA R1 M7).
+ *
+ * Ohne Eingriff gilt, was Core und Bootcode einstellen: Teensy markiert
+ * Flash und OCRAM als write-back, DTCM ist ohnehin ungecacht; beim GIGA
+ * hängt die Cachebarkeit des SDRAM von der MPU-Konfiguration von mbed ab.
+ * Dieses Modul setzt Arena und Modell über zwei eigene MPU-Regionen (die
+ * beiden höchsten, sie haben Vorrang) und schaltet D-/I-Cache, damit jede
+ * Einstellung einzeln gemessen werden kann:
+ *
+ *   default  Zustand nach dem Booten, Regionen unverändert
+ *   wbwa     Arena + Modell write-back/write-allocate, beide Caches an
+ *   wt       Arena write-through (Modell unverändert), beide Caches an
+ *   nc       Arena nicht cachebar, beide Caches an
+ *   dcoff    D-Cache aus, I-Cache an
+ *   off      D- und I-Cache aus
+ *
+ * Regionen sind Zweierpotenzen; was über den Bereich hinausragt, wird über
+ * Subregionen (1/8 der Regionsgröße) abgeschaltet. Bereiche im TCM werden
+ * nicht angefasst, dort gibt es keinen Cache.
+ *
+ * "prewarm" liest vor der Messung Modell und Arena einmal zeilenweise, damit
+ * auch Läufe ohne Warmup mit gefülltem Cache starten.
+ *
+ * Build-Flags (platformio.ini), zur Laufzeit über den Befehl "cache":
+ *   -D TH_CACHE_POLICY=TH_CACHE_POLICY_WBWA   Richtlinie beim Start
+ *   -D TH_CACHE_PREWARM=1                     Prewarm beim Start an
+ */
+
+#ifndef TH_M7_CACHE_H_
+#define TH_M7_CACHE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define TH_CACHE_POLICY_DEFAULT 0
+#define TH_CACHE_POLICY_WBWA 1
+#define TH_CACHE_POLICY_WT 2
+#define TH_CACHE_POLICY_NC 3
+#define TH_CACHE_POLICY_DCOFF 4
+#define TH_CACHE_POLICY_OFF 5
+
+#ifndef TH_CACHE_POLICY
+#define TH_CACHE_POLICY TH_CACHE_POLICY_DEFAULT
+#endif
+
+#ifndef TH_CACHE_PREWARM
+#define TH_CACHE_PREWARM 0
+#endif
+
+// Merkt sich Bereiche und den Boot-Zustand; einmal nach AllocateTensors()
+void m7_cache_init(const void* arena, size_t arena_bytes, const void* model, size_t model_bytes);
+
+// false = unbekannte Richtlinie oder m7_cache_init() fehlt
+bool m7_cache_apply(int policy);
+int m7_cache_policy(void);
+
+// Name <-> Nummer, -1 bei unbekanntem Namen
+const char* m7_cache_policy_name(int policy);
+int m7_cache_policy_from_name(const char* name);
+
+void m7_cache_set_prewarm(bool on);
+bool m7_cache_prewarm_enabled(void);
+// Liest Modell und Arena zeilenweise, wenn prewarm an ist
+void m7_cache_prewarm(void);
+
+// "policy=..,dcache=..,icache=..,arena=..,model=..,prewarm=.."
+void m7_cache_describe(char* buf, size_t size);
+
+#endif  // TH_M7_CACHE_H_
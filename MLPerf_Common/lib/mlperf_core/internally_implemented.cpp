@@ -24,6 +24,13 @@ replaced by a fixed-size array.
 #include <string.h>
 
 #include "submitter_implemented.h"
+#include "th_hal.h"
+#if TH_MODEL_LZ
+#include "model_lz.h"
+#endif
+#if TH_MODEL_STORE
+#include "model_store.h"
+#endif
 
 // Command buffer (incoming commands from host)
 char volatile g_cmd_buf[EE_CMD_SIZE + 1];
@@ -97,6 +104,10 @@ void ee_benchmark_initialize(void) {
   th_serialport_initialize();
   th_timestamp_initialize();
   th_final_initialize();
+#if TH_LOW_POWER
+  // After the model is up, so the setup itself runs at full speed
+  th_hal_power_init();
+#endif
   th_printf(EE_MSG_INIT_DONE);
   // Enable the command parser here (the callback is connected)
   g_state_parser_enabled = true;
@@ -104,24 +115,42 @@ void ee_benchmark_initialize(void) {
   th_printf(EE_MSG_READY);
 }
 
+/**
+ * @brief short name of the compiled-in model, as reported by `profile`
+ */
+const char *ee_model_name(void) {
+#if TH_MODEL_VERSION == EE_MODEL_VERSION_IC01
+  return "ic01";
+#elif TH_MODEL_VERSION == EE_MODEL_VERSION_KWS01
+  return "kws01";
+#elif TH_MODEL_VERSION == EE_MODEL_VERSION_VWW01
+  return "vww01";
+#elif TH_MODEL_VERSION == EE_MODEL_VERSION_AD01
+  return "ad01";
+#elif TH_MODEL_VERSION == EE_MODEL_VERSION_STRWW01
+  return "strww01";
+#else
+  return "unknown";
+#endif
+}
+
 arg_claimed_t ee_profile_parse(char *command) {
   char *p_next; /* strtok already primed from ee_main.c */
 
   if (strncmp(command, "profile", EE_CMD_SIZE) == 0) {
     th_printf("m-profile-[%s]\r\n", EE_FW_VERSION);
-    #if TH_MODEL_VERSION == EE_MODEL_VERSION_IC01
-      th_printf("m-model-[%s]\r\n", "ic01");
-    #elif TH_MODEL_VERSION == EE_MODEL_VERSION_KWS01
-      th_printf("m-model-[%s]\r\n", "kws01");
-    #elif TH_MODEL_VERSION == EE_MODEL_VERSION_VWW01
-      th_printf("m-model-[%s]\r\n", "vww01");
-    #elif TH_MODEL_VERSION == EE_MODEL_VERSION_AD01
-      th_printf("m-model-[%s]\r\n", "ad01");
-    #elif TH_MODEL_VERSION == EE_MODEL_VERSION_STRWW01
-      th_printf("m-model-[%s]\r\n", "strww01");
-    #else
-      th_printf("m-model-[%s]\r\n", "unknown");
-    #endif
+    th_printf("m-model-[%s]\r\n", ee_model_name());
+    th_printf("m-kernel-backend-[%s]\r\n", th_kernel_backend());
+    th_model_align_report();
+#if TH_MODEL_LZ
+    model_lz_report();
+#endif
+#if TH_MODEL_STORE
+    model_store_report();
+#endif
+#if TH_M7_CACHE
+    th_cache_report();
+#endif
   } else if (strncmp(command, "help", EE_CMD_SIZE) == 0) {
     th_printf("%s\r\n", EE_FW_VERSION);
     th_printf("\r\n");
@@ -139,6 +168,35 @@ arg_claimed_t ee_profile_parse(char *command) {
         "infer N [W=0]: Load input, execute N inferences after W warmup "
         "loops\r\n");
     th_printf("results      : Return the result fp32 vector\r\n");
+#if TH_STREAMING
+    th_printf("stream SUBCMD: Control streaming execution\r\n");
+    th_printf("  reset      : Drop cached state, next inference refills window\r\n");
+    th_printf("  compare [N=10]\r\n");
+    th_printf("             : Mean latency of N streaming hops vs N full Invoke()\r\n");
+#endif
+#if TH_FUSE_DW_PW
+    th_printf("dwpw SUBCMD  : Control depthwise + 1x1 fusion\r\n");
+    th_printf("  mask HEX   : Fuse pair i if bit i is set\r\n");
+    th_printf("  compare [N=10]\r\n");
+    th_printf("             : Mean latency with each pair fused alone vs none\r\n");
+#endif
+#if TH_PACK_WEIGHTS
+    th_printf("pack compare [N=10]\r\n");
+    th_printf("             : Arena bytes and mean latency per pre-packed convolution\r\n");
+#endif
+#if TH_AD_BATCH
+    th_printf("batch sweep [N=10]\r\n");
+    th_printf("             : Throughput of N batched steps per batch size\r\n");
+#endif
+#if TH_NN_PARALLEL
+    th_printf("parallel [N=10]\r\n");
+    th_printf("             : Mean latency per model convolution, serial vs parallel\r\n");
+#endif
+#if TH_M7_CACHE
+    th_printf("cache [SUBCMD]: Print or change the cache policy\r\n");
+    th_printf("  policy NAME: default, wbwa, wt, nc, dcoff or off\r\n");
+    th_printf("  prewarm 0|1: Touch model and arena before each run\r\n");
+#endif
   } else if (ee_buffer_parse(command) == EE_ARG_CLAIMED) {
   } else if (strncmp(command, "infer", EE_CMD_SIZE) == 0) {
     size_t n = 1;
@@ -169,6 +227,131 @@ arg_claimed_t ee_profile_parse(char *command) {
     ee_infer(n, w);
   } else if (strncmp(command, "results", EE_CMD_SIZE) == 0) {
     th_results();
+#if TH_STREAMING
+  } else if (strncmp(command, "stream", EE_CMD_SIZE) == 0) {
+    p_next = strtok(NULL, EE_CMD_DELIMITER);
+    if (p_next && strncmp(p_next, "reset", EE_CMD_SIZE) == 0) {
+      th_stream_reset();
+      th_printf("m-stream-reset-done\r\n");
+    } else if (p_next && strncmp(p_next, "compare", EE_CMD_SIZE) == 0) {
+      size_t n = 10;
+      p_next = strtok(NULL, EE_CMD_DELIMITER);
+      if (p_next) {
+        int i = atoi(p_next);
+        if (i <= 0) {
+          th_printf("e-[Compare iterations must be >0]\r\n");
+          return EE_ARG_CLAIMED;
+        }
+        n = (size_t)i;
+      }
+      th_stream_compare(n);
+    } else {
+      th_printf("e-[stream expects reset or compare]\r\n");
+    }
+#endif
+#if TH_FUSE_DW_PW
+  } else if (strncmp(command, "dwpw", EE_CMD_SIZE) == 0) {
+    p_next = strtok(NULL, EE_CMD_DELIMITER);
+    if (p_next && strncmp(p_next, "mask", EE_CMD_SIZE) == 0) {
+      p_next = strtok(NULL, EE_CMD_DELIMITER);
+      long mask = p_next ? ee_hexdec(p_next) : -1;
+      if (mask < 0) {
+        th_printf("e-[dwpw mask expects a hex value]\r\n");
+        return EE_ARG_CLAIMED;
+      }
+      th_dwpw_set_mask((unsigned long)mask);
+    } else if (p_next && strncmp(p_next, "compare", EE_CMD_SIZE) == 0) {
+      size_t n = 10;
+      p_next = strtok(NULL, EE_CMD_DELIMITER);
+      if (p_next) {
+        int i = atoi(p_next);
+        if (i <= 0) {
+          th_printf("e-[Compare iterations must be >0]\r\n");
+          return EE_ARG_CLAIMED;
+        }
+        n = (size_t)i;
+      }
+      th_dwpw_compare(n);
+    } else {
+      th_printf("e-[dwpw expects mask or compare]\r\n");
+    }
+#endif
+#if TH_PACK_WEIGHTS
+  } else if (strncmp(command, "pack", EE_CMD_SIZE) == 0) {
+    p_next = strtok(NULL, EE_CMD_DELIMITER);
+    if (p_next && strncmp(p_next, "compare", EE_CMD_SIZE) == 0) {
+      size_t n = 10;
+      p_next = strtok(NULL, EE_CMD_DELIMITER);
+      if (p_next) {
+        int i = atoi(p_next);
+        if (i <= 0) {
+          th_printf("e-[Compare iterations must be >0]\r\n");
+          return EE_ARG_CLAIMED;
+        }
+        n = (size_t)i;
+      }
+      th_pack_compare(n);
+    } else {
+      th_printf("e-[pack expects compare]\r\n");
+    }
+#endif
+#if TH_AD_BATCH
+  } else if (strncmp(command, "batch", EE_CMD_SIZE) == 0) {
+    p_next = strtok(NULL, EE_CMD_DELIMITER);
+    if (p_next && strncmp(p_next, "sweep", EE_CMD_SIZE) == 0) {
+      size_t n = 10;
+      p_next = strtok(NULL, EE_CMD_DELIMITER);
+      if (p_next) {
+        int i = atoi(p_next);
+        if (i <= 0) {
+          th_printf("e-[Sweep iterations must be >0]\r\n");
+          return EE_ARG_CLAIMED;
+        }
+        n = (size_t)i;
+      }
+      th_ad_batch_sweep(n);
+    } else {
+      th_printf("e-[batch expects sweep]\r\n");
+    }
+#endif
+#if TH_NN_PARALLEL
+  } else if (strncmp(command, "parallel", EE_CMD_SIZE) == 0) {
+    size_t n = 10;
+    p_next = strtok(NULL, EE_CMD_DELIMITER);
+    if (p_next) {
+      int i = atoi(p_next);
+      if (i <= 0) {
+        th_printf("e-[Parallel iterations must be >0]\r\n");
+        return EE_ARG_CLAIMED;
+      }
+      n = (size_t)i;
+    }
+    th_nn_parallel_report(n);
+#endif
+#if TH_M7_CACHE
+  } else if (strncmp(command, "cache", EE_CMD_SIZE) == 0) {
+    p_next = strtok(NULL, EE_CMD_DELIMITER);
+    if (p_next == NULL) {
+      th_cache_report();
+    } else if (strncmp(p_next, "policy", EE_CMD_SIZE) == 0) {
+      p_next = strtok(NULL, EE_CMD_DELIMITER);
+      if (p_next == NULL || th_cache_set_policy(p_next) != 0) {
+        th_printf("e-[Unknown cache policy]\r\n");
+        return EE_ARG_CLAIMED;
+      }
+      th_cache_report();
+    } else if (strncmp(p_next, "prewarm", EE_CMD_SIZE) == 0) {
+      p_next = strtok(NULL, EE_CMD_DELIMITER);
+      if (p_next == NULL) {
+        th_printf("e-[cache prewarm expects 0 or 1]\r\n");
+        return EE_ARG_CLAIMED;
+      }
+      th_cache_set_prewarm(atoi(p_next));
+      th_cache_report();
+    } else {
+      th_printf("e-[cache expects policy or prewarm]\r\n");
+    }
+#endif
   } else {
     return EE_ARG_UNCLAIMED;
   }
@@ -185,11 +368,19 @@ arg_claimed_t ee_profile_parse(char *command) {
  *
  */
 void ee_infer(size_t n, size_t n_warmup) {
+#if TH_SUMMARY
+  const size_t n_measured = n;
+  const size_t n_warmed = n_warmup;
+#endif
+#if TH_LOW_POWER
+  th_busy_begin(); /* full speed, no sleep until the run is reported */
+#endif
   th_load_tensor(); /* if necessary */
   th_printf("m-warmup-start-%d\r\n", n_warmup);
   while (n_warmup-- > 0) {
     th_infer(); /* call the API inference function */
   }
+  th_warmup_done(); /* outside the timed window */
   th_printf("m-warmup-done\r\n");
   th_printf("m-infer-start-%d\r\n", n);
   th_timestamp();
@@ -201,6 +392,12 @@ void ee_infer(size_t n, size_t n_warmup) {
   th_timestamp();
   th_printf("m-infer-done\r\n");
   th_results();
+#if TH_SUMMARY
+  th_summary(n_measured, n_warmed);
+#endif
+#if TH_LOW_POWER
+  th_busy_end();
+#endif
 }
 
 arg_claimed_t ee_buffer_parse(char *p_command) {
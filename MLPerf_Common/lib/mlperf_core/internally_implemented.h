@@ -59,5 +59,6 @@ void ee_infer(size_t n, size_t n_warmup);
 size_t ee_get_buffer(uint8_t* buffer, size_t max_len);
 arg_claimed_t ee_buffer_parse(char *command);
 arg_claimed_t ee_profile_parse(char *command);
+const char *ee_model_name(void);
 
 #endif /* MLPERF_TINY_V0_1_API_INTERNALLY_IMPLEMENTED_H_ */
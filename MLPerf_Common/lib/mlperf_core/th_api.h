@@ -0,0 +1,190 @@
+/*
+Copyright 2020 EEMBC and The MLPerf Authors. All Rights Reserved.
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+    http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+This file reflects a modified version of th_lib from EEMBC. All wrapped libc
+methods from th_libc.h and all testharness methods from th_lib.h are here.
+==============================================================================*/
+/// \file
+/// \brief Submitter API shared by all boards.
+/// \detail Each board keeps its own submitter_implemented.h with the vendor
+/// name and board-only switches, and includes this file at the end. The
+/// model-side th_ methods (load, infer, results, ...) are implemented once in
+/// lib/th_tflm on top of the interpreter the board creates; serial I/O,
+/// timestamps and the libc hooks in th_core.cpp on top of the board HAL
+/// (th_hal.h).
+
+#ifndef MLPERF_TINY_V0_1_API_TH_API_H_
+#define MLPERF_TINY_V0_1_API_TH_API_H_
+
+/// \brief These defines set logging prefixes for test harness integration.
+#ifndef EE_MSG_TIMESTAMP
+#define EE_MSG_TIMESTAMP "m-lap-us-%lu\r\n"
+#endif
+
+#ifndef MAX_DB_INPUT_SIZE
+#define MAX_DB_INPUT_SIZE (96 * 96 * 3)
+#endif
+
+#ifndef TH_MODEL_VERSION
+// See "internally_implemented.h" for a list
+#error "PLease set TH_MODEL_VERSION to one of the EE_MODEL_VERSION_* defines"
+// e.g.: to inform the user of model `ic01` use this:
+// #define TH_MODEL_VERSION EE_MODEL_VERSION_IC01
+#endif
+
+// Use this to switch between DUT-direct (perf) & DUT-inderrect (energy) modes
+#ifndef EE_CFG_ENERGY_MODE
+#define EE_CFG_ENERGY_MODE 0
+#endif
+
+// Streaming execution for time-axis models (see lib/streaming/streaming_conv.h)
+#ifndef TH_STREAMING
+#define TH_STREAMING 0
+#endif
+
+// Print one m-summary-{json} line after each `infer` (-D TH_SUMMARY=0 to disable)
+#ifndef TH_SUMMARY
+#define TH_SUMMARY 1
+#endif
+
+// Batched ad01 execution over B windows (see lib/ad_batch/ad_batch.h)
+#ifndef TH_AD_BATCH
+#define TH_AD_BATCH 0
+#endif
+
+// Cortex-M7 cache policy, only on Teensy 4.0 and GIGA R1
+#ifndef TH_M7_CACHE
+#define TH_M7_CACHE 0
+#endif
+
+// Model stored LZ4-compressed in flash, unpacked to RAM at init (lib/model_lz)
+#ifndef TH_MODEL_LZ
+#define TH_MODEL_LZ 0
+#endif
+
+// Model mapped from the "models" flash partition by name (lib/model_store)
+#ifndef TH_MODEL_STORE
+#define TH_MODEL_STORE 0
+#endif
+
+// Fused depthwise + 1x1 convolution on kws01/vww01 (lib/dw_pw_fusion)
+#ifndef TH_FUSE_DW_PW
+#define TH_FUSE_DW_PW 0
+#endif
+
+// Pre-packed convolution filters in the fused kernels (lib/conv_add_fusion,
+// lib/dw_pw_fusion)
+#ifndef TH_PACK_WEIGHTS
+#define TH_PACK_WEIGHTS 0
+#endif
+
+// Row-parallel ESP-NN convolutions over N workers (lib/nn_parallel)
+#ifndef TH_NN_PARALLEL
+#define TH_NN_PARALLEL 0
+#endif
+
+#if TH_MODEL_LZ && TH_MODEL_STORE
+#error "TH_MODEL_LZ and TH_MODEL_STORE are mutually exclusive"
+#endif
+
+// Initializer for g_model: the compiled-in array stays unreferenced (and is
+// dropped by --gc-sections) when the model is loaded at init instead
+#if TH_MODEL_LZ || TH_MODEL_STORE
+#define TH_MODEL_FLASH(array) nullptr
+#else
+#define TH_MODEL_FLASH(array) (array)
+#endif
+
+// Low-power idle between commands, meaning of the levels depends on the board
+#ifndef TH_LOW_POWER
+#define TH_LOW_POWER 0
+#endif
+
+// This is a visual cue to the user when reviewing logs or plugging an
+// unknown device into the system.
+#if EE_CFG_ENERGY_MODE == 1
+#define EE_MSG_TIMESTAMP_MODE "m-timestamp-mode-energy\r\n"
+#else
+#define EE_MSG_TIMESTAMP_MODE "m-timestamp-mode-performance\r\n"
+#endif
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// \brief required core API
+void th_load_tensor();
+void th_results();
+void th_infer();
+void th_timestamp(void);
+void th_printf(const char *fmt, ...);
+char th_getchar();
+
+/// \brief optional API
+void th_serialport_initialize(void);
+void th_timestamp_initialize(void);
+void th_final_initialize(void);
+void th_pre();
+void th_post();
+/// \brief after the warmup loop, before the first timestamp (default no-op),
+/// e.g. to drain inferences that are still queued on another core
+void th_warmup_done(void);
+void th_command_ready(char volatile *msg);
+const char *th_kernel_backend(void);
+
+/// \brief startup check: weight tensors not aligned to 16 bytes, prints
+/// m-model-align-[...] (th_model_align.cpp)
+void th_model_align_check(const unsigned char *model);
+void th_model_align_report(void);
+
+/// \brief run summary, only used with TH_SUMMARY=1
+void th_summary(size_t n, size_t n_warmup);
+
+/// \brief streaming API, only used with TH_STREAMING=1
+void th_stream_reset(void);
+void th_stream_compare(size_t n);
+
+/// \brief depthwise + pointwise fusion API, only used with TH_FUSE_DW_PW=1
+void th_dwpw_set_mask(unsigned long mask);
+void th_dwpw_compare(size_t n);
+
+/// \brief pre-packed filter API, only used with TH_PACK_WEIGHTS=1
+void th_pack_compare(size_t n);
+
+/// \brief batch API, only used with TH_AD_BATCH>0
+void th_ad_batch_sweep(size_t n);
+
+/// \brief parallel convolution API, only used with TH_NN_PARALLEL>0
+void th_nn_parallel_report(size_t n);
+
+/// \brief cache API, only used with TH_M7_CACHE=1
+void th_cache_report(void);
+int th_cache_set_policy(const char *name);
+void th_cache_set_prewarm(int on);
+
+/// \brief low-power API, only used with TH_LOW_POWER>0
+void th_busy_begin(void);
+void th_busy_end(void);
+
+/// \brief libc hooks
+int th_strncmp(const char *str1, const char *str2, size_t n);
+char *th_strncpy(char *dest, const char *src, size_t n);
+size_t th_strnlen(const char *str, size_t maxlen);
+char *th_strcat(char *dest, const char *src);
+char *th_strtok(/*@null@*/ char *str1, const char *sep);
+int th_atoi(const char *str);
+void *th_memset(void *b, int c, size_t len);
+void *th_memcpy(void *dst, const void *src, size_t n);
+int th_vprintf(const char *format, va_list ap);
+
+#endif  // MLPERF_TINY_V0_1_API_TH_API_H_
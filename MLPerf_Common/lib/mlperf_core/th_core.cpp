@@ -0,0 +1,94 @@
+/*
+Copyright 2020 EEMBC and The MLPerf Authors. All Rights Reserved.
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+    http://www.apache.org/licenses/LICENSE-2.0
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+/// \file
+/// \brief Board-independent th_ methods on top of the HAL (th_hal.h).
+
+#include "submitter_implemented.h"
+#include "internally_implemented.h"
+#include "th_hal.h"
+
+#include <stdint.h>
+
+// Large enough for one m-results line chunk and the m-summary pieces
+#define TH_PRINTF_BUFFER 256
+
+void th_printf(const char *fmt, ...) {
+  char buffer[TH_PRINTF_BUFFER];
+  va_list args;
+  va_start(args, fmt);
+  int len = vsnprintf(buffer, sizeof(buffer), fmt, args);
+  va_end(args);
+  if (len <= 0) return;
+  if ((size_t)len >= sizeof(buffer)) len = sizeof(buffer) - 1;
+  th_hal_serial_write(buffer, (size_t)len);
+}
+
+int th_vprintf(const char *format, va_list ap) {
+  char buffer[TH_PRINTF_BUFFER];
+  int len = vsnprintf(buffer, sizeof(buffer), format, ap);
+  if (len <= 0) return len;
+  if ((size_t)len >= sizeof(buffer)) len = sizeof(buffer) - 1;
+  th_hal_serial_write(buffer, (size_t)len);
+  return len;
+}
+
+char th_getchar() { return th_hal_serial_getchar(); }
+
+__attribute__((weak)) void th_warmup_done(void) {}
+
+void th_timestamp(void) {
+#if EE_CFG_ENERGY_MODE
+  th_hal_timestamp_pulse();
+#else
+  th_printf(EE_MSG_TIMESTAMP, th_hal_micros());
+#endif
+}
+
+void th_serialport_initialize(void) { th_hal_serial_init(); }
+
+void th_timestamp_initialize(void) {
+#if EE_CFG_ENERGY_MODE
+  th_hal_timestamp_init();
+#endif
+}
+
+void th_command_ready(char volatile *msg) {
+  ee_serial_command_parser_callback((char *)msg);
+}
+
+void *th_alloc(size_t bytes, th_mem_tier_t *tier) {
+  for (int t = 0; t < TH_MEM_TIERS; t++) {
+    void *p = th_hal_alloc((th_mem_tier_t)t, bytes);
+    if (p != NULL) {
+      if (tier) *tier = (th_mem_tier_t)t;
+      return p;
+    }
+  }
+  return NULL;
+}
+
+void *th_alloc_aligned(size_t bytes, size_t align, th_mem_tier_t *tier) {
+  uint8_t *raw = (uint8_t *)th_alloc(bytes + align - 1, tier);
+  if (raw == NULL) return NULL;
+  return (void *)(((uintptr_t)raw + align - 1) & ~(uintptr_t)(align - 1));
+}
+
+// libc hooks
+int th_strncmp(const char *str1, const char *str2, size_t n) { return strncmp(str1, str2, n); }
+char *th_strncpy(char *dest, const char *src, size_t n) { return strncpy(dest, src, n); }
+size_t th_strnlen(const char *str, size_t maxlen) { return strnlen(str, maxlen); }
+char *th_strcat(char *dest, const char *src) { return strcat(dest, src); }
+char *th_strtok(char *str1, const char *sep) { return strtok(str1, sep); }
+int th_atoi(const char *str) { return atoi(str); }
+void *th_memset(void *b, int c, size_t len) { return memset(b, c, len); }
+void *th_memcpy(void *dst, const void *src, size_t n) { return memcpy(dst, src, n); }
@@ -0,0 +1,53 @@
+/// \file
+/// \brief Board abstraction used by the shared benchmark core.
+/// \detail Exactly one HAL is linked per firmware: lib/api/th_hal_<board>.cpp
+/// in each PlatformIO project, hal_posix/th_hal_posix.cpp for the host build.
+/// The core (th_core.cpp) implements th_printf, th_getchar, th_timestamp,
+/// the initialization hooks and the libc wrappers on top of these functions,
+/// so a change there applies to every board.
+
+#ifndef MLPERF_TINY_V0_1_API_TH_HAL_H_
+#define MLPERF_TINY_V0_1_API_TH_HAL_H_
+
+#include <stddef.h>
+
+/// \brief memory tiers, in the order the core tries them
+typedef enum {
+  TH_MEM_INTERNAL = 0,  ///< on-chip heap (SRAM, OCRAM)
+  TH_MEM_EXTERNAL,      ///< external RAM (PSRAM, SDRAM), if the board has one
+  TH_MEM_TIERS
+} th_mem_tier_t;
+
+/// \brief serial link to the runner (USB or UART, depending on the mode)
+void th_hal_serial_init(void);
+/// \brief blocks until a character arrives; may idle the core meanwhile
+char th_hal_serial_getchar(void);
+void th_hal_serial_write(const char *buf, size_t len);
+
+/// \brief free-running microsecond timer for performance mode
+unsigned long th_hal_micros(void);
+/// \brief current core clock for m-summary, 0 if unknown
+unsigned long th_hal_cpu_mhz(void);
+
+/// \brief energy mode: timestamp GPIO, idle level LOW
+void th_hal_timestamp_init(void);
+void th_hal_timestamp_pulse(void);
+
+/// \brief TH_LOW_POWER>0: enable idle between commands, called once after
+/// th_final_initialize(). The board also implements th_busy_begin/_end().
+void th_hal_power_init(void);
+
+/// \brief allocation from one tier, nullptr if the tier is missing or full
+void *th_hal_alloc(th_mem_tier_t tier, size_t bytes);
+/// \brief short name of a tier for logs and m-summary ("internal", "psram", ...)
+const char *th_hal_tier_name(th_mem_tier_t tier);
+
+/// \brief core: first tier that can hold `bytes`, internal before external.
+/// \detail `tier` (optional) receives the tier that was used.
+void *th_alloc(size_t bytes, th_mem_tier_t *tier);
+
+/// \brief core: like th_alloc(), aligned to `align` (power of two). The
+/// block is never freed, the arena lives as long as the firmware.
+void *th_alloc_aligned(size_t bytes, size_t align, th_mem_tier_t *tier);
+
+#endif  // MLPERF_TINY_V0_1_API_TH_HAL_H_
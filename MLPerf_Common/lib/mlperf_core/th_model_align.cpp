@@ -0,0 +1,108 @@
+/// \file
+/// \brief Startup check of the model flatbuffer alignment.
+/// \detail The optimized kernels (ESP-NN on the S3, CMSIS-NN) load weights
+/// with wide accesses and fall back to byte loads or the C path when a
+/// weight buffer is not 16-byte aligned. The arrays are declared alignas(16)
+/// and tools/model_align.py aligns the buffers inside the flatbuffer; this
+/// check reports what actually arrived on the board. It walks the flatbuffer
+/// directly instead of using the TFLM schema headers, so the host build
+/// runs the same code.
+
+#include "submitter_implemented.h"
+#include "internally_implemented.h"
+
+#include <stdint.h>
+#include <string.h>
+
+namespace {
+constexpr uintptr_t kAlign = 16;
+
+// tflite schema field indices
+constexpr int kModelSubgraphs = 2;
+constexpr int kModelBuffers = 4;
+constexpr int kSubgraphTensors = 0;
+constexpr int kTensorBuffer = 2;
+constexpr int kBufferData = 0;
+
+const unsigned char *checked_model = nullptr;
+uint32_t weight_tensors = 0;
+uint32_t misaligned = 0;
+
+// Flatbuffers are little endian; memcpy keeps the reads safe on any alignment
+uint32_t Read32(const uint8_t *p) {
+  uint32_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+uint16_t Read16(const uint8_t *p) {
+  uint16_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+const uint8_t *Field(const uint8_t *table, int index) {
+  const uint8_t *vtable = table - (int32_t)Read32(table);
+  if (4 + 2 * index >= Read16(vtable)) return nullptr;
+  uint16_t offset = Read16(vtable + 4 + 2 * index);
+  return offset ? table + offset : nullptr;
+}
+
+// Vector field: returns the first element, count in *n (0 if absent)
+const uint8_t *Vector(const uint8_t *table, int index, uint32_t *n) {
+  const uint8_t *f = Field(table, index);
+  if (f == nullptr) {
+    *n = 0;
+    return nullptr;
+  }
+  const uint8_t *vec = f + Read32(f);
+  *n = Read32(vec);
+  return vec + 4;
+}
+
+const uint8_t *TableAt(const uint8_t *elements, uint32_t i) {
+  const uint8_t *p = elements + 4 * i;
+  return p + Read32(p);
+}
+}  // namespace
+
+void th_model_align_check(const unsigned char *model) {
+  checked_model = model;
+  weight_tensors = 0;
+  misaligned = 0;
+  if (model == nullptr) return;
+
+  const uint8_t *root = model + Read32(model);
+  uint32_t n_buffers, n_subgraphs;
+  const uint8_t *buffers = Vector(root, kModelBuffers, &n_buffers);
+  const uint8_t *subgraphs = Vector(root, kModelSubgraphs, &n_subgraphs);
+
+  for (uint32_t s = 0; s < n_subgraphs; s++) {
+    uint32_t n_tensors;
+    const uint8_t *tensors = Vector(TableAt(subgraphs, s), kSubgraphTensors, &n_tensors);
+    for (uint32_t t = 0; t < n_tensors; t++) {
+      const uint8_t *f = Field(TableAt(tensors, t), kTensorBuffer);
+      uint32_t index = f ? Read32(f) : 0;
+      if (index == 0 || index >= n_buffers) continue;  // buffer 0 is empty
+      uint32_t bytes;
+      const uint8_t *data = Vector(TableAt(buffers, index), kBufferData, &bytes);
+      if (data == nullptr || bytes == 0) continue;    // activation
+      weight_tensors++;
+      if ((uintptr_t)data % kAlign) misaligned++;
+    }
+  }
+
+  th_model_align_report();
+  if (misaligned || (uintptr_t)model % kAlign) {
+    th_printf("WARN: %lu von %lu Gewichtstensoren nicht 16-Byte-ausgerichtet "
+              "(MLPerf_Common/tools/model_align.py).\r\n",
+              (unsigned long)misaligned, (unsigned long)weight_tensors);
+  }
+}
+
+void th_model_align_report(void) {
+  if (checked_model == nullptr) return;
+  th_printf("m-model-align-[base=%p,base_ok=%d,tensors=%lu,misaligned=%lu]\r\n",
+            (const void *)checked_model, (int)((uintptr_t)checked_model % kAlign == 0),
+            (unsigned long)weight_tensors, (unsigned long)misaligned);
+}
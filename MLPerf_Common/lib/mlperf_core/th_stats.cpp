@@ -0,0 +1,49 @@
+/// \file
+/// \brief Latency statistics and m-summary printer (see th_stats.h).
+
+#include "submitter_implemented.h"
+#include "internally_implemented.h"
+#include "th_stats.h"
+
+namespace {
+bool measuring = false;
+th_latency_t stats = {0, 0, 0, 0};
+}  // namespace
+
+__attribute__((weak)) void th_board_summary(void) {}
+
+void th_latency_begin(void) {
+  stats = th_latency_t{0, 0, 0, 0};
+  measuring = true;
+}
+
+void th_latency_end(void) { measuring = false; }
+
+bool th_latency_measuring(void) { return measuring; }
+
+void th_latency_add(uint32_t dt_us) {
+  if (stats.count == 0 || dt_us < stats.min_us) stats.min_us = dt_us;
+  if (dt_us > stats.max_us) stats.max_us = dt_us;
+  stats.sum_us += dt_us;
+  stats.count++;
+}
+
+// One JSON line per "infer", so the evaluation needs no regex.
+// The th_printf buffer is small, hence the pieces.
+void th_summary_print(size_t n, size_t n_warmup, const th_summary_info_t *info,
+                      const th_latency_t *lat) {
+  if (lat == nullptr) lat = &stats;
+  unsigned long mean = lat->count ? (unsigned long)(lat->sum_us / lat->count) : 0;
+  th_printf("m-summary-{\"model\":\"%s\",\"board\":\"%s\",\"cpu_mhz\":%lu,",
+            ee_model_name(), TH_VENDOR_NAME_STRING, info->cpu_mhz);
+  th_printf("\"arena\":{\"size\":%lu,\"location\":\"%s\",\"used\":%lu},",
+            (unsigned long)info->arena_size, info->arena_location,
+            (unsigned long)info->arena_used);
+  th_printf("\"warmup\":%lu,\"measured\":%lu,\"exec\":\"%s\",",
+            (unsigned long)n_warmup, (unsigned long)n, info->exec);
+  th_printf("\"latency_us\":{\"min\":%lu,\"max\":%lu,\"mean\":%lu,\"total\":%lu},",
+            (unsigned long)lat->min_us, (unsigned long)lat->max_us, mean,
+            (unsigned long)lat->sum_us);
+  th_board_summary();
+  th_printf("\"kernels\":\"%s\"}\r\n", info->kernels);
+}
@@ -0,0 +1,49 @@
+/// \file
+/// \brief Latency statistics of the measured loop and the m-summary line.
+/// \detail One copy for every model side: lib/th_tflm, the host stub
+/// (hal_posix/submitter_stub.cpp) and the Giga M4 in dual-core mode, which
+/// passes the statistics the M7 collected. Only used with TH_SUMMARY=1.
+
+#ifndef MLPERF_TINY_V0_1_API_TH_STATS_H_
+#define MLPERF_TINY_V0_1_API_TH_STATS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/// \brief latency of the measured th_infer() calls
+typedef struct {
+  uint32_t count;
+  uint32_t min_us;
+  uint32_t max_us;
+  uint64_t sum_us;
+} th_latency_t;
+
+/// \brief m-summary fields that come from the model side
+typedef struct {
+  unsigned long cpu_mhz;
+  size_t arena_size;
+  const char *arena_location;
+  size_t arena_used;
+  const char *exec;     ///< "invoke", "stream", "batch", "dualcore", "stub"
+  const char *kernels;  ///< th_kernel_backend() of the core that ran them
+} th_summary_info_t;
+
+/// \brief th_pre(): clear the statistics and start recording
+void th_latency_begin(void);
+/// \brief th_post(): stop recording
+void th_latency_end(void);
+/// \brief true between th_latency_begin() and th_latency_end()
+bool th_latency_measuring(void);
+/// \brief one measured inference
+void th_latency_add(uint32_t dt_us);
+
+/// \brief prints m-summary-{json}. `lat` nullptr takes the statistics of
+/// th_latency_add(). th_board_summary() adds its fields before "kernels".
+void th_summary_print(size_t n, size_t n_warmup, const th_summary_info_t *info,
+                      const th_latency_t *lat);
+
+/// \brief board hook: extra JSON fields, each followed by a comma
+/// (weak no-op default in th_stats.cpp)
+void th_board_summary(void);
+
+#endif  // MLPERF_TINY_V0_1_API_TH_STATS_H_
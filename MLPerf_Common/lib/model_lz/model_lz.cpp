@@ -0,0 +1,132 @@
+/*
+ * model_lz.cpp
+ *
+ * LZ4-Block-Decoder und Laden des Modells in den RAM (siehe model_lz.h).
+ */
+
+#include "model_lz.h"
+
+#if TH_MODEL_LZ
+
+#include <string.h>
+
+#include "internally_implemented.h"
+#include "th_hal.h"
+
+namespace {
+constexpr size_t kMinMatch = 4;
+
+// Statistik für model_lz_report()
+size_t lz_raw = 0;
+size_t lz_flash = 0;
+unsigned long lz_boot_us = 0;
+const char* lz_location = "none";
+
+// Längenerweiterung: Folge von 255ern plus Restbyte
+bool ReadLength(const uint8_t*& ip, const uint8_t* end, size_t& len) {
+  uint8_t b;
+  do {
+    if (ip >= end) return false;
+    b = *ip++;
+    len += b;
+  } while (b == 255);
+  return true;
+}
+
+uint32_t Crc32(const uint8_t* p, size_t n) {
+  static uint32_t table[256];
+  static bool ready = false;
+  if (!ready) {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; k++) c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+      table[i] = c;
+    }
+    ready = true;
+  }
+  uint32_t crc = 0xFFFFFFFFu;
+  for (size_t i = 0; i < n; i++) crc = table[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+  return crc ^ 0xFFFFFFFFu;
+}
+
+// Großer Block zuerst extern, damit die Arena den internen RAM bekommt
+uint8_t* AllocModel(size_t bytes) {
+  const th_mem_tier_t order[] = {TH_MEM_EXTERNAL, TH_MEM_INTERNAL};
+  for (th_mem_tier_t tier : order) {
+    uint8_t* raw = (uint8_t*)th_hal_alloc(tier, bytes + 15);
+    if (raw != nullptr) {
+      lz_location = th_hal_tier_name(tier);
+      return (uint8_t*)(((uintptr_t)raw + 15) & ~(uintptr_t)15);
+    }
+  }
+  return nullptr;
+}
+}  // namespace
+
+int32_t model_lz_decode(const uint8_t* src, size_t src_len, uint8_t* dst, size_t dst_cap) {
+  const uint8_t* ip = src;
+  const uint8_t* const iend = src + src_len;
+  uint8_t* op = dst;
+  uint8_t* const oend = dst + dst_cap;
+
+  while (ip < iend) {
+    const uint8_t token = *ip++;
+
+    size_t lit = token >> 4;
+    if (lit == 15 && !ReadLength(ip, iend, lit)) return -1;
+    if (lit > (size_t)(iend - ip) || lit > (size_t)(oend - op)) return -1;
+    memcpy(op, ip, lit);
+    ip += lit;
+    op += lit;
+    if (ip >= iend) break;  // letzte Sequenz hat nur Literale
+
+    if (iend - ip < 2) return -1;
+    const size_t offset = ip[0] | (ip[1] << 8);
+    ip += 2;
+    if (offset == 0 || offset > (size_t)(op - dst)) return -1;
+
+    size_t mlen = token & 15;
+    if (mlen == 15 && !ReadLength(ip, iend, mlen)) return -1;
+    mlen += kMinMatch;
+    if (mlen > (size_t)(oend - op)) return -1;
+
+    // Überlappende Kopie (offset < mlen) wiederholt das Muster, daher bytweise
+    const uint8_t* match = op - offset;
+    if (offset >= mlen) {
+      memcpy(op, match, mlen);
+      op += mlen;
+    } else {
+      for (size_t i = 0; i < mlen; i++) *op++ = *match++;
+    }
+  }
+  return (int32_t)(op - dst);
+}
+
+const unsigned char* model_lz_load(const model_lz_blob_t* blob) {
+  unsigned long t0 = th_hal_micros();
+  uint8_t* dst = AllocModel(blob->raw_size);
+  if (dst == nullptr) {
+    th_printf("FEHLER: Kein RAM fuer das entpackte Modell (%u Bytes).\r\n",
+              (unsigned)blob->raw_size);
+    return nullptr;
+  }
+  int32_t n = model_lz_decode(blob->data, blob->size, dst, blob->raw_size);
+  if (n != (int32_t)blob->raw_size || Crc32(dst, blob->raw_size) != blob->crc32) {
+    th_printf("FEHLER: Modell-Abbild defekt (%ld von %u Bytes, CRC).\r\n",
+              (long)n, (unsigned)blob->raw_size);
+    return nullptr;
+  }
+  lz_boot_us = th_hal_micros() - t0;
+  lz_raw = blob->raw_size;
+  lz_flash = blob->size;
+  model_lz_report();
+  return dst;
+}
+
+void model_lz_report(void) {
+  th_printf("m-model-lz-[raw=%lu,flash=%lu,saved=%lu,boot_us=%lu,location=%s]\r\n",
+            (unsigned long)lz_raw, (unsigned long)lz_flash,
+            (unsigned long)(lz_raw - lz_flash), lz_boot_us, lz_location);
+}
+
+#endif  // TH_MODEL_LZ
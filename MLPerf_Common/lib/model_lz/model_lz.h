@@ -0,0 +1,54 @@
+/*
+ * model_lz.h
+ *
+ * Komprimierte Modellablage (-D TH_MODEL_LZ=1).
+ *
+ * Statt des rohen Flatbuffers liegt im Flash ein LZ4-Block, erzeugt von
+ * tools/model_pack.py (<id>_model_lz.h). Die Header sind nicht eingecheckt:
+ * tools/pio_model_pack.py packt vor jedem PlatformIO-Build das gewählte
+ * Modell aus lib/model_data des Boards, wenn dessen CRC nicht passt. In
+ * th_final_initialize() entpackt model_lz_load() das Modell einmal in den
+ * RAM, bevorzugt in den externen (PSRAM/SDRAM), damit der interne RAM für
+ * die Arena frei bleibt. Die Prüfsumme (CRC-32) wird nach dem Entpacken
+ * verglichen.
+ *
+ * Damit das rohe Array nicht trotzdem im Flash landet, setzen die Boards
+ * g_model über TH_MODEL_FLASH(array) (th_api.h): mit TH_MODEL_LZ=1 wird das
+ * Array nicht referenziert und fällt per --gc-sections heraus.
+ *
+ * Meldung (Start und profile):
+ *   m-model-lz-[raw=R,flash=F,saved=S,boot_us=T,location=L]
+ */
+
+#ifndef TH_MODEL_LZ_H_
+#define TH_MODEL_LZ_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "submitter_implemented.h"
+
+// Ablage des komprimierten Abbilds, z.B. PROGMEM auf dem Teensy
+#ifndef TH_MODEL_LZ_ATTR
+#define TH_MODEL_LZ_ATTR
+#endif
+
+typedef struct {
+  const unsigned char* data;  // LZ4-Block
+  size_t size;                // Bytes im Flash
+  size_t raw_size;            // Bytes nach dem Entpacken
+  uint32_t crc32;             // über die entpackten Bytes
+} model_lz_blob_t;
+
+// Entpackt einen LZ4-Block. Rückgabe: geschriebene Bytes, -1 bei defekten Daten
+// oder wenn dst_cap nicht reicht.
+int32_t model_lz_decode(const uint8_t* src, size_t src_len, uint8_t* dst, size_t dst_cap);
+
+// Entpackt das Modell einmal in den RAM (16 Byte ausgerichtet) und prüft die
+// CRC. nullptr bei Speichermangel oder falscher Prüfsumme.
+const unsigned char* model_lz_load(const model_lz_blob_t* blob);
+
+// m-model-lz-[...] mit den Werten des letzten model_lz_load()
+void model_lz_report(void);
+
+#endif  // TH_MODEL_LZ_H_
@@ -0,0 +1,29 @@
+/*
+ * model_lz_data.h
+ *
+ * Komprimiertes Abbild des mit TH_MODEL_VERSION gewählten Modells
+ * (model_lz_blob). Nur in einer Übersetzungseinheit einbinden, wie die
+ * rohen *_model_data.h.
+ */
+
+#ifndef TH_MODEL_LZ_DATA_H_
+#define TH_MODEL_LZ_DATA_H_
+
+#include "internally_implemented.h"
+#include "model_lz.h"
+
+#if TH_MODEL_VERSION == EE_MODEL_VERSION_IC01
+  #include "ic01_model_lz.h"
+#elif TH_MODEL_VERSION == EE_MODEL_VERSION_KWS01
+  #include "kws01_model_lz.h"
+#elif TH_MODEL_VERSION == EE_MODEL_VERSION_VWW01
+  #include "vww01_model_lz.h"
+#elif TH_MODEL_VERSION == EE_MODEL_VERSION_AD01
+  #include "ad01_model_lz.h"
+#elif TH_MODEL_VERSION == EE_MODEL_VERSION_STRWW01
+  #include "strww01_model_lz.h"
+#else
+  #error "Kein komprimiertes Modell fuer TH_MODEL_VERSION"
+#endif
+
+#endif  // TH_MODEL_LZ_DATA_H_
@@ -0,0 +1,191 @@
+/*
+ * model_store.cpp
+ *
+ * Modellablage in der Flash-Partition "models" bzw. im Host-Build in einer
+ * Datei (siehe model_store.h).
+ */
+
+#include "model_store.h"
+
+#if TH_MODEL_STORE
+
+#include <string.h>
+
+#include "internally_implemented.h"
+#include "th_hal.h"
+
+#if defined(ESP_PLATFORM)
+  #include "esp_partition.h"
+#elif defined(__unix__) || defined(__APPLE__)
+  #include <fcntl.h>
+  #include <stdlib.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#else
+  #error "TH_MODEL_STORE gibt es nur auf ESP-IDF und im Host-Build"
+#endif
+
+// Name und Subtyp der Partition, wie in partitions_models.csv
+#ifndef TH_MODEL_STORE_PARTITION
+#define TH_MODEL_STORE_PARTITION "models"
+#endif
+#ifndef TH_MODEL_STORE_SUBTYPE
+#define TH_MODEL_STORE_SUBTYPE 0x40
+#endif
+
+// Obergrenze gegen ein leeres (0xFF) oder defektes Abbild
+constexpr uint32_t kMaxEntries = 64;
+
+namespace {
+// Statistik für model_store_report()
+char st_name[MODEL_STORE_NAME_LEN] = "none";
+size_t st_size = 0;
+const void* st_addr = nullptr;
+unsigned long st_map_us = 0;
+
+uint32_t Crc32(const uint8_t* p, size_t n) {
+  static uint32_t table[256];
+  static bool ready = false;
+  if (!ready) {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; k++) c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+      table[i] = c;
+    }
+    ready = true;
+  }
+  uint32_t crc = 0xFFFFFFFFu;
+  for (size_t i = 0; i < n; i++) crc = table[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+  return crc ^ 0xFFFFFFFFu;
+}
+
+// ===================================================================
+// BACKEND: Öffnen, Lesen (Kopf/Tabelle) und Einblenden eines Bereichs
+// ===================================================================
+
+#if defined(ESP_PLATFORM)
+const esp_partition_t* part = nullptr;
+
+bool StoreOpen() {
+  if (part != nullptr) return true;
+  part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                  (esp_partition_subtype_t)TH_MODEL_STORE_SUBTYPE,
+                                  TH_MODEL_STORE_PARTITION);
+  if (part == nullptr) {
+    th_printf("FEHLER: Partition '%s' fehlt (partitions_models.csv?).\r\n",
+              TH_MODEL_STORE_PARTITION);
+    return false;
+  }
+  return true;
+}
+
+size_t StoreCapacity() { return part->size; }
+
+bool StoreRead(size_t offset, void* dst, size_t bytes) {
+  return esp_partition_read(part, offset, dst, bytes) == ESP_OK;
+}
+
+// Nur der Bereich des Modells belegt MMU-Seiten. Das Handle bleibt offen,
+// das Modell wird bis zum Neustart benutzt.
+const unsigned char* StoreMap(size_t offset, size_t bytes) {
+  const void* ptr = nullptr;
+  esp_partition_mmap_handle_t handle;
+  esp_err_t err = esp_partition_mmap(part, offset, bytes, ESP_PARTITION_MMAP_DATA,
+                                     &ptr, &handle);
+  if (err != ESP_OK) {
+    th_printf("FEHLER: esp_partition_mmap() fehlgeschlagen (%d).\r\n", (int)err);
+    return nullptr;
+  }
+  return (const unsigned char*)ptr;
+}
+#else
+const uint8_t* file_data = nullptr;
+size_t file_size = 0;
+
+bool StoreOpen() {
+  if (file_data != nullptr) return true;
+  const char* path = getenv("TH_MODEL_STORE_FILE");
+  if (path == nullptr) path = "models.bin";
+  int fd = open(path, O_RDONLY);
+  struct stat st;
+  if (fd < 0 || fstat(fd, &st) != 0 || st.st_size == 0) {
+    th_printf("FEHLER: Modellablage '%s' nicht lesbar.\r\n", path);
+    if (fd >= 0) close(fd);
+    return false;
+  }
+  void* p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (p == MAP_FAILED) {
+    th_printf("FEHLER: mmap('%s') fehlgeschlagen.\r\n", path);
+    return false;
+  }
+  file_data = (const uint8_t*)p;
+  file_size = (size_t)st.st_size;
+  return true;
+}
+
+size_t StoreCapacity() { return file_size; }
+
+bool StoreRead(size_t offset, void* dst, size_t bytes) {
+  if (offset > file_size || bytes > file_size - offset) return false;
+  memcpy(dst, file_data + offset, bytes);
+  return true;
+}
+
+// Die Datei ist schon komplett eingeblendet
+const unsigned char* StoreMap(size_t offset, size_t bytes) {
+  (void)bytes;
+  return file_data + offset;
+}
+#endif
+}  // namespace
+
+const unsigned char* model_store_map(const char* name, size_t* size) {
+  unsigned long t0 = th_hal_micros();
+  if (!StoreOpen()) return nullptr;
+
+  model_store_header_t hdr;
+  if (!StoreRead(0, &hdr, sizeof(hdr)) || hdr.magic != MODEL_STORE_MAGIC ||
+      hdr.count > kMaxEntries || hdr.total > StoreCapacity()) {
+    th_printf("FEHLER: Modellablage leer oder ungueltig (tools/model_store.py).\r\n");
+    return nullptr;
+  }
+
+  for (uint32_t i = 0; i < hdr.count; i++) {
+    model_store_entry_t e;
+    if (!StoreRead(sizeof(hdr) + i * sizeof(e), &e, sizeof(e))) break;
+    e.name[MODEL_STORE_NAME_LEN - 1] = '\0';
+    if (strncmp(e.name, name, MODEL_STORE_NAME_LEN) != 0) continue;
+
+    if (e.offset % MODEL_STORE_ALIGN != 0 || e.offset > hdr.total ||
+        e.size > hdr.total - e.offset) {
+      th_printf("FEHLER: Eintrag '%s' zeigt aus dem Abbild.\r\n", e.name);
+      return nullptr;
+    }
+    const unsigned char* p = StoreMap(e.offset, e.size);
+    if (p == nullptr) return nullptr;
+    if (Crc32(p, e.size) != e.crc32) {
+      th_printf("FEHLER: Modell '%s' in der Ablage defekt (CRC).\r\n", e.name);
+      return nullptr;
+    }
+
+    st_map_us = th_hal_micros() - t0;
+    strncpy(st_name, e.name, sizeof(st_name));
+    st_size = e.size;
+    st_addr = p;
+    if (size != nullptr) *size = e.size;
+    model_store_report();
+    return p;
+  }
+
+  th_printf("FEHLER: Modell '%s' nicht in der Ablage.\r\n", name);
+  return nullptr;
+}
+
+void model_store_report(void) {
+  th_printf("m-model-store-[name=%s,size=%lu,addr=%p,map_us=%lu]\r\n",
+            st_name, (unsigned long)st_size, st_addr, st_map_us);
+}
+
+#endif  // TH_MODEL_STORE
@@ -0,0 +1,57 @@
+/*
+ * model_store.h
+ *
+ * Modelle in einer eigenen Flash-Partition (-D TH_MODEL_STORE=1).
+ *
+ * Die Partition "models" (data, Subtyp 0x40, siehe partitions_models.csv der
+ * ESP-Projekte) enthält ein Abbild aus tools/model_store.py: Kopf, Tabelle
+ * mit Namen/Offset/Größe/CRC-32 und die Flatbuffer, jeweils 16 Byte
+ * ausgerichtet. model_store_map() sucht ein Modell nach Namen und blendet
+ * nur dessen Bereich per esp_partition_mmap() in den Adressraum ein: kein
+ * Kopieren in den RAM, und neue Modelle brauchen nur ein neues Abbild,
+ * keinen neuen App-Build.
+ *
+ * Im Host-Build liest dieselbe API eine Datei per mmap() (Pfad aus der
+ * Umgebungsvariable TH_MODEL_STORE_FILE, sonst "models.bin").
+ *
+ * Meldung (Start und profile):
+ *   m-model-store-[name=N,size=S,addr=0x..,map_us=T]
+ */
+
+#ifndef TH_MODEL_STORE_H_
+#define TH_MODEL_STORE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "submitter_implemented.h"
+
+// Abbildformat, muss zu tools/model_store.py passen (little endian)
+#define MODEL_STORE_MAGIC 0x31534D54u  // "TMS1"
+#define MODEL_STORE_NAME_LEN 32
+#define MODEL_STORE_ALIGN 16
+
+typedef struct {
+  uint32_t magic;
+  uint32_t count;     // Einträge in der Tabelle
+  uint32_t total;     // Bytes des gesamten Abbilds
+  uint32_t reserved;
+} model_store_header_t;
+
+typedef struct {
+  char name[MODEL_STORE_NAME_LEN];  // nullterminiert, z.B. "kws01"
+  uint32_t offset;                  // ab Abbildanfang, MODEL_STORE_ALIGN-ausgerichtet
+  uint32_t size;                    // Bytes des Flatbuffers
+  uint32_t crc32;                   // über den Flatbuffer
+  uint32_t reserved;
+} model_store_entry_t;
+
+// Sucht das Modell `name`, blendet es ein und prüft die CRC. Liefert den
+// Zeiger auf den Flatbuffer (gültig bis zum Neustart) oder nullptr, wenn
+// Partition/Datei fehlt, das Abbild ungültig ist oder der Name fehlt.
+const unsigned char* model_store_map(const char* name, size_t* size);
+
+// m-model-store-[...] mit den Werten des letzten model_store_map()
+void model_store_report(void);
+
+#endif  // TH_MODEL_STORE_H_
@@ -0,0 +1,483 @@
+/*
+ * nn_parallel.cpp
+ *
+ * Pool der zeilenparallelen ESP-NN-Faltungen, die Kernel für CONV_2D und
+ * DEPTHWISE_CONV_2D und die Messung pro Schicht (siehe nn_parallel.h).
+ */
+
+#include "nn_parallel.h"
+
+#if TH_NN_PARALLEL
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/kernels/conv.h"
+#include "tensorflow/lite/micro/kernels/depthwise_conv.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_context.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#include "esp_nn.h"
+#include "th_stock_kernel.h"
+
+namespace {
+
+constexpr int kMaxLayers = 48;
+
+esp_nn_pool_t* g_pool = nullptr;
+bool g_pool_tried = false;
+TFLMRegistration g_conv;
+TFLMRegistration g_dw;
+
+NnParallelLayer g_layers[kMaxLayers];
+int g_num_layers = 0;
+
+// Messpuffer, einmal für die größte Schicht angelegt
+int8_t* g_input = nullptr;
+int8_t* g_filter = nullptr;
+int8_t* g_output = nullptr;
+void* g_scratch = nullptr;
+int32_t* g_bias = nullptr;
+int32_t* g_mult = nullptr;
+int32_t* g_shift = nullptr;
+
+// ---------------------------------------------------------------
+// Kernel
+// ---------------------------------------------------------------
+
+// user_data beider Ops: OpDataConv muss vorne stehen, weil ConvPrepare()
+// und DepthwiseConvPrepare() darüber schreiben
+struct ParConvData {
+  tflite::OpDataConv op;
+  int scratch_index;
+  int32_t scratch_bytes;
+  conv_plan_t plan;
+  void* stock;             // Knotendaten des Standardkernels, sonst nullptr
+};
+
+struct ParDwData {
+  tflite::OpDataConv op;
+  int scratch_index;
+  int32_t scratch_bytes;
+  dw_conv_plan_t plan;
+  void* stock;
+};
+
+template <typename T>
+void* UserDataInit(TfLiteContext* context, const char* buffer, size_t length) {
+  (void)buffer;
+  (void)length;
+  void* raw = context->AllocatePersistentBuffer(context, sizeof(T));
+  if (raw == nullptr) return nullptr;
+  T* data = static_cast<T*>(raw);
+  data->scratch_index = -1;
+  data->scratch_bytes = 0;
+  data->stock = nullptr;
+  return raw;
+}
+
+// NHWC-Form als ESP-NN-Dimensionen
+data_dims_t Dims(const TfLiteIntArray* d) {
+  return {d->data[2], d->data[1], d->data[3], d->data[0]};
+}
+
+// ESP-NN rechnet nur int8, Batch 1, ohne Dilation
+bool Supported(const TfLiteTensor* input, const TfLiteTensor* filter, int dilation_wd,
+               int dilation_ht) {
+  return input->type == kTfLiteInt8 && filter->type == kTfLiteInt8 &&
+         input->dims->data[0] == 1 && dilation_wd == 1 && dilation_ht == 1;
+}
+
+void* ConvInit(TfLiteContext* context, const char* buffer, size_t length) {
+  return UserDataInit<ParConvData>(context, buffer, length);
+}
+
+TfLiteStatus ConvPrepare(TfLiteContext* context, TfLiteNode* node) {
+  ParConvData* data = static_cast<ParConvData*>(node->user_data);
+  const auto& params = *(reinterpret_cast<TfLiteConvParams*>(node->builtin_data));
+
+  tflite::MicroContext* micro_context = tflite::GetMicroContext(context);
+  TfLiteTensor* input = micro_context->AllocateTempInputTensor(node, tflite::kConvInputTensor);
+  TfLiteTensor* filter = micro_context->AllocateTempInputTensor(node, tflite::kConvWeightsTensor);
+  TfLiteTensor* output = micro_context->AllocateTempOutputTensor(node, tflite::kConvOutputTensor);
+  TF_LITE_ENSURE(context, input != nullptr && filter != nullptr && output != nullptr);
+
+  TfLiteStatus status = kTfLiteOk;
+  if (!Supported(input, filter, params.dilation_width_factor, params.dilation_height_factor)) {
+    status = th_stock_prepare(context, node, g_conv, &data->stock);
+  } else {
+    status = tflite::ConvPrepare(context, node);
+  }
+  if (status == kTfLiteOk && data->stock == nullptr) {
+    const data_dims_t in_dims = Dims(input->dims);
+    const data_dims_t filter_dims = {filter->dims->data[2], filter->dims->data[1],
+                                     filter->dims->data[3], 1};
+    const data_dims_t out_dims = Dims(output->dims);
+    conv_params_t conv = {};
+    conv.in_offset = -data->op.input_zero_point;
+    conv.out_offset = data->op.output_zero_point;
+    conv.stride = {params.stride_width, params.stride_height};
+    conv.padding = {data->op.padding.width, data->op.padding.height};
+    conv.dilation = {1, 1};
+    conv.activation = {data->op.output_activation_min, data->op.output_activation_max};
+    esp_nn_conv_plan_create(&data->plan, &in_dims, &filter_dims, &out_dims, &conv);
+    data->scratch_bytes = esp_nn_get_conv_parallel_scratch_size(nn_parallel_pool(), &data->plan);
+    if (data->scratch_bytes > 0) {
+      status = context->RequestScratchBufferInArena(context, data->scratch_bytes,
+                                                    &data->scratch_index);
+    }
+  }
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(filter);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return status;
+}
+
+TfLiteStatus ConvEval(TfLiteContext* context, TfLiteNode* node) {
+  ParConvData* data = static_cast<ParConvData*>(node->user_data);
+  if (data->stock != nullptr) return th_stock_invoke(context, node, g_conv, data->stock);
+
+  const TfLiteEvalTensor* input = tflite::micro::GetEvalInput(context, node, tflite::kConvInputTensor);
+  const TfLiteEvalTensor* filter = tflite::micro::GetEvalInput(context, node, tflite::kConvWeightsTensor);
+  const TfLiteEvalTensor* bias = node->inputs->size == 3
+      ? tflite::micro::GetEvalInput(context, node, tflite::kConvBiasTensor) : nullptr;
+  TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, tflite::kConvOutputTensor);
+  const quant_data_t quant = {data->op.per_channel_output_shift,
+                              data->op.per_channel_output_multiplier};
+
+  esp_nn_ctx_t nn_ctx = {};
+  nn_ctx.conv_scratch = data->scratch_index >= 0
+      ? context->GetScratchBuffer(context, data->scratch_index) : nullptr;
+  nn_ctx.pool = nn_parallel_pool();
+  esp_nn_conv_s8_parallel(&nn_ctx, &data->plan, tflite::micro::GetTensorData<int8_t>(input),
+                          tflite::micro::GetTensorData<int8_t>(filter),
+                          tflite::micro::GetOptionalTensorData<int32_t>(bias),
+                          tflite::micro::GetTensorData<int8_t>(output), &quant);
+  return kTfLiteOk;
+}
+
+void* DwInit(TfLiteContext* context, const char* buffer, size_t length) {
+  return UserDataInit<ParDwData>(context, buffer, length);
+}
+
+TfLiteStatus DwPrepare(TfLiteContext* context, TfLiteNode* node) {
+  ParDwData* data = static_cast<ParDwData*>(node->user_data);
+  const auto& params = *(reinterpret_cast<TfLiteDepthwiseConvParams*>(node->builtin_data));
+
+  tflite::MicroContext* micro_context = tflite::GetMicroContext(context);
+  TfLiteTensor* input =
+      micro_context->AllocateTempInputTensor(node, tflite::kDepthwiseConvInputTensor);
+  TfLiteTensor* filter =
+      micro_context->AllocateTempInputTensor(node, tflite::kDepthwiseConvWeightsTensor);
+  TfLiteTensor* output =
+      micro_context->AllocateTempOutputTensor(node, tflite::kDepthwiseConvOutputTensor);
+  TF_LITE_ENSURE(context, input != nullptr && filter != nullptr && output != nullptr);
+
+  TfLiteStatus status = kTfLiteOk;
+  if (!Supported(input, filter, params.dilation_width_factor, params.dilation_height_factor)) {
+    status = th_stock_prepare(context, node, g_dw, &data->stock);
+  } else {
+    status = tflite::DepthwiseConvPrepare(context, node);
+  }
+  if (status == kTfLiteOk && data->stock == nullptr) {
+    const data_dims_t in_dims = Dims(input->dims);
+    const data_dims_t filter_dims = {filter->dims->data[2], filter->dims->data[1],
+                                     input->dims->data[3], 1};
+    const data_dims_t out_dims = Dims(output->dims);
+    dw_conv_params_t dw = {};
+    dw.in_offset = -data->op.input_zero_point;
+    dw.out_offset = data->op.output_zero_point;
+    dw.ch_mult = params.depth_multiplier;
+    dw.stride = {params.stride_width, params.stride_height};
+    dw.padding = {data->op.padding.width, data->op.padding.height};
+    dw.dilation = {1, 1};
+    dw.activation = {data->op.output_activation_min, data->op.output_activation_max};
+    esp_nn_depthwise_conv_plan_create(&data->plan, &in_dims, &filter_dims, &out_dims, &dw);
+    data->scratch_bytes =
+        esp_nn_get_depthwise_conv_parallel_scratch_size(nn_parallel_pool(), &data->plan);
+    if (data->scratch_bytes > 0) {
+      status = context->RequestScratchBufferInArena(context, data->scratch_bytes,
+                                                    &data->scratch_index);
+    }
+  }
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(filter);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return status;
+}
+
+TfLiteStatus DwEval(TfLiteContext* context, TfLiteNode* node) {
+  ParDwData* data = static_cast<ParDwData*>(node->user_data);
+  if (data->stock != nullptr) return th_stock_invoke(context, node, g_dw, data->stock);
+
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, node, tflite::kDepthwiseConvInputTensor);
+  const TfLiteEvalTensor* filter =
+      tflite::micro::GetEvalInput(context, node, tflite::kDepthwiseConvWeightsTensor);
+  const TfLiteEvalTensor* bias = node->inputs->size == 3
+      ? tflite::micro::GetEvalInput(context, node, tflite::kDepthwiseConvBiasTensor) : nullptr;
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, tflite::kDepthwiseConvOutputTensor);
+  const quant_data_t quant = {data->op.per_channel_output_shift,
+                              data->op.per_channel_output_multiplier};
+
+  esp_nn_ctx_t nn_ctx = {};
+  nn_ctx.depthwise_scratch = data->scratch_index >= 0
+      ? context->GetScratchBuffer(context, data->scratch_index) : nullptr;
+  nn_ctx.pool = nn_parallel_pool();
+  esp_nn_depthwise_conv_s8_parallel(&nn_ctx, &data->plan,
+                                    tflite::micro::GetTensorData<int8_t>(input),
+                                    tflite::micro::GetTensorData<int8_t>(filter),
+                                    tflite::micro::GetOptionalTensorData<int32_t>(bias),
+                                    tflite::micro::GetTensorData<int8_t>(output), &quant);
+  return kTfLiteOk;
+}
+
+// ---------------------------------------------------------------
+// Schichten aus dem Modell
+// ---------------------------------------------------------------
+
+// NHWC-Form eines Flatbuffer-Tensors; false, wenn nicht 4D
+bool Shape4(const tflite::Tensor* t, int32_t* n, int32_t* h, int32_t* w, int32_t* c) {
+  if (t == nullptr || t->shape() == nullptr || t->shape()->size() != 4) return false;
+  *n = t->shape()->Get(0);
+  *h = t->shape()->Get(1);
+  *w = t->shape()->Get(2);
+  *c = t->shape()->Get(3);
+  return true;
+}
+
+// Padding wie ComputePaddingHeightWidth() in TFLM (ohne Dilation)
+int32_t Pad(tflite::Padding padding, int32_t in, int32_t out, int32_t filter, int32_t stride) {
+  if (padding != tflite::Padding_SAME) return 0;
+  return std::max<int32_t>(0, ((out - 1) * stride + filter - in) / 2);
+}
+
+bool SameShape(const NnParallelLayer& a, const NnParallelLayer& b) {
+  return a.depthwise == b.depthwise && a.in_wd == b.in_wd && a.in_ht == b.in_ht &&
+         a.in_ch == b.in_ch && a.out_wd == b.out_wd && a.out_ht == b.out_ht &&
+         a.out_ch == b.out_ch && a.filter_wd == b.filter_wd && a.filter_ht == b.filter_ht &&
+         a.stride_wd == b.stride_wd && a.stride_ht == b.stride_ht && a.pad_wd == b.pad_wd &&
+         a.pad_ht == b.pad_ht && a.ch_mult == b.ch_mult;
+}
+
+// Eine CONV_2D/DEPTHWISE_CONV_2D als Messschicht; false, wenn ESP-NN sie
+// nicht rechnet
+bool ReadLayer(const tflite::Model* model, const tflite::Operator* op, int index,
+               NnParallelLayer* l) {
+  const auto* tensors = model->subgraphs()->Get(0)->tensors();
+  const tflite::BuiltinOperator code =
+      tflite::GetBuiltinCode(model->operator_codes()->Get(op->opcode_index()));
+  if (op->inputs() == nullptr || op->inputs()->size() < 2 || op->outputs() == nullptr ||
+      op->outputs()->size() != 1) {
+    return false;
+  }
+  const tflite::Tensor* in = tensors->Get(op->inputs()->Get(0));
+  const tflite::Tensor* filter = tensors->Get(op->inputs()->Get(1));
+  const tflite::Tensor* out = tensors->Get(op->outputs()->Get(0));
+  if (in->type() != tflite::TensorType_INT8 || filter->type() != tflite::TensorType_INT8) {
+    return false;
+  }
+  int32_t n, f_o, f_c, out_n;
+  if (!Shape4(in, &n, &l->in_ht, &l->in_wd, &l->in_ch) ||
+      !Shape4(filter, &f_o, &l->filter_ht, &l->filter_wd, &f_c) ||
+      !Shape4(out, &out_n, &l->out_ht, &l->out_wd, &l->out_ch) || n != 1) {
+    return false;
+  }
+
+  tflite::Padding padding;
+  if (code == tflite::BuiltinOperator_CONV_2D) {
+    const tflite::Conv2DOptions* o = op->builtin_options_as_Conv2DOptions();
+    if (o == nullptr || o->dilation_w_factor() != 1 || o->dilation_h_factor() != 1) return false;
+    l->depthwise = false;
+    l->stride_wd = o->stride_w();
+    l->stride_ht = o->stride_h();
+    l->ch_mult = 1;
+    padding = o->padding();
+  } else if (code == tflite::BuiltinOperator_DEPTHWISE_CONV_2D) {
+    const tflite::DepthwiseConv2DOptions* o = op->builtin_options_as_DepthwiseConv2DOptions();
+    if (o == nullptr || o->dilation_w_factor() != 1 || o->dilation_h_factor() != 1) return false;
+    l->depthwise = true;
+    l->stride_wd = o->stride_w();
+    l->stride_ht = o->stride_h();
+    l->ch_mult = std::max(1, o->depth_multiplier());
+    padding = o->padding();
+  } else {
+    return false;
+  }
+  l->pad_wd = Pad(padding, l->in_wd, l->out_wd, l->filter_wd, l->stride_wd);
+  l->pad_ht = Pad(padding, l->in_ht, l->out_ht, l->filter_ht, l->stride_ht);
+  snprintf(l->name, sizeof(l->name), "%s_%d", l->depthwise ? "dw" : "conv", index);
+  l->repeat = 1;
+  return true;
+}
+
+// ---------------------------------------------------------------
+// Messung
+// ---------------------------------------------------------------
+
+struct Plans {
+  conv_plan_t conv;
+  dw_conv_plan_t dw;
+};
+
+void CreatePlan(const NnParallelLayer& l, Plans* plans) {
+  const data_dims_t in = {l.in_wd, l.in_ht, l.in_ch, 1};
+  const data_dims_t filter = {l.filter_wd, l.filter_ht, l.in_ch, 1};
+  const data_dims_t out = {l.out_wd, l.out_ht, l.out_ch, 1};
+  const data_2d_t stride = {l.stride_wd, l.stride_ht};
+  const data_2d_t pad = {l.pad_wd, l.pad_ht};
+  if (l.depthwise) {
+    dw_conv_params_t p = {};
+    p.in_offset = 128;
+    p.out_offset = -128;
+    p.ch_mult = l.ch_mult;
+    p.stride = stride;
+    p.padding = pad;
+    p.dilation = {1, 1};
+    p.activation = {-128, 127};
+    esp_nn_depthwise_conv_plan_create(&plans->dw, &in, &filter, &out, &p);
+  } else {
+    conv_params_t p = {};
+    p.in_offset = 128;
+    p.out_offset = -128;
+    p.stride = stride;
+    p.padding = pad;
+    p.dilation = {1, 1};
+    p.activation = {-128, 127};
+    esp_nn_conv_plan_create(&plans->conv, &in, &filter, &out, &p);
+  }
+}
+
+int ScratchBytes(const NnParallelLayer& l, const Plans& plans) {
+  return l.depthwise
+      ? esp_nn_get_depthwise_conv_parallel_scratch_size(g_pool, &plans.dw)
+      : esp_nn_get_conv_parallel_scratch_size(g_pool, &plans.conv);
+}
+
+// Mittel über n Läufe nach einem Aufwärmlauf; pool nullptr = seriell
+uint32_t TimeLayer(const NnParallelLayer& l, const Plans& plans, esp_nn_pool_t* pool,
+                   int32_t min_macs, size_t n) {
+  esp_nn_ctx_t ctx = {};
+  ctx.conv_scratch = g_scratch;
+  ctx.depthwise_scratch = g_scratch;
+  ctx.pool = pool;
+  ctx.parallel_min_macs = min_macs;
+  const quant_data_t q = {g_shift, g_mult};
+  int64_t t0 = 0;
+  for (size_t i = 0; i <= n; i++) {
+    if (i == 1) t0 = esp_timer_get_time();
+    if (l.depthwise) {
+      esp_nn_depthwise_conv_s8_parallel(&ctx, &plans.dw, g_input, g_filter, g_bias, g_output, &q);
+    } else {
+      esp_nn_conv_s8_parallel(&ctx, &plans.conv, g_input, g_filter, g_bias, g_output, &q);
+    }
+  }
+  return (uint32_t)((esp_timer_get_time() - t0) / (int64_t)n);
+}
+
+}  // namespace
+
+esp_nn_pool_t* nn_parallel_pool(void) {
+  if (!g_pool_tried) {
+    g_pool_tried = true;
+    g_pool = esp_nn_pool_create(TH_NN_PARALLEL);
+  }
+  return g_pool;
+}
+
+TFLMRegistration nn_parallel_conv2d_registration(void) {
+  g_conv = tflite::Register_CONV_2D();
+  return tflite::micro::RegisterOp(ConvInit, ConvPrepare, ConvEval);
+}
+
+TFLMRegistration nn_parallel_depthwise_registration(void) {
+  g_dw = tflite::Register_DEPTHWISE_CONV_2D();
+  return tflite::micro::RegisterOp(DwInit, DwPrepare, DwEval);
+}
+
+void nn_parallel_init(const tflite::Model* model) {
+  g_num_layers = 0;
+  const auto* ops = model->subgraphs()->Get(0)->operators();
+  for (uint32_t i = 0; i < ops->size() && g_num_layers < kMaxLayers; i++) {
+    NnParallelLayer l;
+    if (!ReadLayer(model, ops->Get(i), (int)i, &l)) continue;
+    bool seen = false;
+    for (int k = 0; k < g_num_layers && !seen; k++) {
+      if (SameShape(g_layers[k], l)) {
+        g_layers[k].repeat++;
+        seen = true;
+      }
+    }
+    if (!seen) g_layers[g_num_layers++] = l;
+  }
+}
+
+int nn_parallel_layer_count(void) { return g_num_layers; }
+
+const NnParallelLayer* nn_parallel_layer(int i) {
+  return (i >= 0 && i < g_num_layers) ? &g_layers[i] : nullptr;
+}
+
+bool nn_parallel_bench_init(nn_parallel_alloc_fn alloc) {
+  if (g_scratch != nullptr) return true;
+  if (nn_parallel_pool() == nullptr || g_num_layers == 0) return false;
+
+  size_t in_max = 0, filter_max = 0, out_max = 0;
+  int32_t ch_max = 0;
+  int scratch_max = 0;
+  for (int i = 0; i < g_num_layers; i++) {
+    const NnParallelLayer& l = g_layers[i];
+    Plans plans;
+    CreatePlan(l, &plans);
+    in_max = std::max(in_max, (size_t)l.in_wd * l.in_ht * l.in_ch);
+    filter_max = std::max(filter_max, (size_t)l.filter_wd * l.filter_ht *
+                                          (l.depthwise ? l.out_ch : l.in_ch * l.out_ch));
+    out_max = std::max(out_max, (size_t)l.out_wd * l.out_ht * l.out_ch);
+    ch_max = std::max(ch_max, l.out_ch);
+    scratch_max = std::max(scratch_max, ScratchBytes(l, plans));
+  }
+  g_input = (int8_t*)alloc(in_max);
+  g_filter = (int8_t*)alloc(filter_max);
+  g_output = (int8_t*)alloc(out_max);
+  g_bias = (int32_t*)alloc(ch_max * sizeof(int32_t));
+  g_mult = (int32_t*)alloc(ch_max * sizeof(int32_t));
+  g_shift = (int32_t*)alloc(ch_max * sizeof(int32_t));
+  void* scratch = alloc(std::max(scratch_max, 16));
+  if (g_input == nullptr || g_filter == nullptr || g_output == nullptr || g_bias == nullptr ||
+      g_mult == nullptr || g_shift == nullptr || scratch == nullptr) {
+    return false;
+  }
+
+  // Werte sind für die Zeit egal, nur nicht konstant (kein Sättigungspfad)
+  uint32_t x = 1;
+  for (size_t i = 0; i < in_max; i++) g_input[i] = (int8_t)((x = x * 1103515245u + 12345u) >> 24);
+  for (size_t i = 0; i < filter_max; i++) g_filter[i] = (int8_t)((x = x * 1103515245u + 12345u) >> 24);
+  for (int32_t i = 0; i < ch_max; i++) {
+    g_bias[i] = (int32_t)((x = x * 1103515245u + 12345u) >> 20) - 2048;
+    g_mult[i] = 1 << 30;
+    g_shift[i] = -8;
+  }
+  g_scratch = scratch;
+  return true;
+}
+
+void nn_parallel_bench(int i, size_t n, NnParallelTiming* timing) {
+  const NnParallelLayer& l = g_layers[i];
+  Plans plans;
+  CreatePlan(l, &plans);
+  timing->serial_us = TimeLayer(l, plans, nullptr, 0, n);
+  timing->split_us = TimeLayer(l, plans, g_pool, -1, n);
+  timing->auto_us = TimeLayer(l, plans, g_pool, 0, n);
+}
+
+#endif  // TH_NN_PARALLEL
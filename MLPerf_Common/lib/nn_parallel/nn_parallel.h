@@ -0,0 +1,95 @@
+/*
+ * nn_parallel.h
+ *
+ * Zeilenparallele ESP-NN-Faltungen auf beiden Kernen (ESP32, ESP32-S3).
+ *
+ * esp_nn_conv_s8_parallel / esp_nn_depthwise_conv_s8_parallel teilen die
+ * Ausgabezeilen einer Schicht in Bänder, eines pro Worker; der zweite Worker
+ * ist ein FreeRTOS-Task auf dem anderen Kern. Das Ergebnis ist bitgleich
+ * zum seriellen Aufruf. Schichten unter ESP_NN_PARALLEL_MIN_MACS pro Worker
+ * bleiben seriell (Kostenmodell in ESP-NN), das Aufwecken des Helfers
+ * lohnt sich dort nicht.
+ *
+ * Im Modell laufen CONV_2D und DEPTHWISE_CONV_2D über diesen Pool:
+ * ohne Fusion über die Kernel hier (nn_parallel_*_registration, über
+ * ThTflmKernels in th_tflm.h), mit TH_FUSE_DW_PW über die einzeln laufenden,
+ * ungepackten Faltungen von lib/dw_pw_fusion; die fusionierten Paare und
+ * die Conv+Add-Fusion bleiben seriell. Was ESP-NN nicht rechnet (kein int8,
+ * Batch > 1, Dilation), läuft über den Standardkernel.
+ *
+ * Der Befehl "parallel [N]" misst jede Faltung des geladenen Modells für
+ * sich, seriell gegen parallel; die Schichten liest nn_parallel_init() aus
+ * dem Flatbuffer (gleiche Formen nur einmal, mit Anzahl).
+ *
+ * Stand: auf dem Gerät noch nicht gemessen. Der Host (pthread-Pool, eine
+ * CPU) zeigt nur den Overhead des Pools, für den FreeRTOS-Pool auf ESP32
+ * und S3 gibt es noch keine Zahlen; ESP_NN_PARALLEL_MIN_MACS ist geschätzt.
+ *
+ * Aktivierung über Build-Flags (platformio.ini):
+ *   -D TH_NN_PARALLEL=2   Worker inklusive Aufrufer (0 = aus)
+ */
+
+#ifndef TH_NN_PARALLEL_H_
+#define TH_NN_PARALLEL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef TH_NN_PARALLEL
+#define TH_NN_PARALLEL 0
+#endif
+
+#if TH_NN_PARALLEL
+
+#include "esp_nn_defs.h"
+#include "tensorflow/lite/micro/micro_common.h"
+
+namespace tflite {
+struct Model;
+}
+
+// Pool mit TH_NN_PARALLEL Workern, beim ersten Aufruf angelegt;
+// nullptr, wenn die Tasks nicht angelegt werden konnten (dann seriell)
+esp_nn_pool_t* nn_parallel_pool(void);
+
+// CONV_2D und DEPTHWISE_CONV_2D über den Pool, sonst der von esp-tflite-micro
+TFLMRegistration nn_parallel_conv2d_registration(void);
+TFLMRegistration nn_parallel_depthwise_registration(void);
+
+struct NnParallelLayer {
+  char name[16];                // conv_<Op-Index> bzw. dw_<Op-Index>
+  bool depthwise;
+  int32_t in_wd, in_ht, in_ch;  // Eingang
+  int32_t out_wd, out_ht, out_ch;
+  int32_t filter_wd, filter_ht;
+  int32_t stride_wd, stride_ht;
+  int32_t pad_wd, pad_ht;
+  int32_t ch_mult;              // nur Depthwise
+  int repeat;                   // so oft im Modell
+};
+
+typedef void* (*nn_parallel_alloc_fn)(size_t bytes);
+
+// Schichten der Messung aus dem Modell lesen (int8, Batch 1, ohne Dilation);
+// vor nn_parallel_bench_init() aufrufen
+void nn_parallel_init(const tflite::Model* model);
+
+int nn_parallel_layer_count(void);
+const NnParallelLayer* nn_parallel_layer(int i);
+
+// Puffer für die größte Schicht einmal anlegen; false, wenn der Speicher,
+// der Pool oder die Schichten fehlen
+bool nn_parallel_bench_init(nn_parallel_alloc_fn alloc);
+
+// Mittlere Zeit einer Schicht über n Läufe: seriell, über alle Worker
+// aufgeteilt und mit dem Kostenmodell
+struct NnParallelTiming {
+  uint32_t serial_us;
+  uint32_t split_us;
+  uint32_t auto_us;
+};
+void nn_parallel_bench(int i, size_t n, NnParallelTiming* timing);
+
+#endif  // TH_NN_PARALLEL
+
+#endif  // TH_NN_PARALLEL_H_
@@ -0,0 +1,688 @@
+/*
+ * streaming_conv.cpp
+ *
+ * Zeilen-Cache-Ausführung für zeitliche Faltungsnetze (siehe streaming_conv.h).
+ *
+ * Adressierung: Ausgabezeile r der Schicht l im Fenster mit Startframe s
+ * bekommt die absolute Position
+ *     pos = s + pos_offset[l] + r * pos_step[l]
+ * (= erster Frame ihres rezeptiven Feldes). Zeilen, deren rezeptives Feld
+ * an keiner Stelle vom Fensterrand abgeschnitten wird ("untainted"), hängen
+ * nur von absoluten Frames ab und dürfen über Fenster hinweg wiederverwendet
+ * werden. Welche Zeilen abgeschnitten sind, hängt nur von der Geometrie ab
+ * und wird einmalig in stream_init() bestimmt.
+ */
+
+#include "streaming_conv.h"
+
+#if TH_STREAMING
+
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+
+#if defined(ESP_PLATFORM)
+  // Gleiche Kernel wie esp-tflite-micro -> bitgleich zu Invoke()
+  #include "sdkconfig.h"
+  #include "esp_nn.h"
+  #define STREAM_USE_ESP_NN 1
+#else
+  #include "tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+  #include "tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h"
+  #include "tensorflow/lite/kernels/internal/reference/softmax.h"
+  #define STREAM_USE_ESP_NN 0
+#endif
+
+namespace {
+
+constexpr int kMaxLayers = 16;
+constexpr int32_t kNoTag = INT32_MIN;
+// TFLM: kScaledDiffIntegerBits in softmax_common
+constexpr int kSoftmaxDiffBits = 5;
+
+struct StreamLayer {
+  bool depthwise;
+  int32_t kh, kw, stride_h, stride_w, pad_h, pad_w, depth_mult;
+  int32_t in_h, in_w, in_c, out_h, out_w, out_c;
+  const int8_t* filter;
+  const int32_t* bias;
+  int32_t* mult;
+  int32_t* shift;
+  int32_t in_offset, out_offset, act_min, act_max;
+  int8_t in_pad_value;  // Nullpunkt der Eingabe: liefert 0 im Akkumulator
+
+  // Absolute Position der Zeile r: s + pos_offset + r * pos_step
+  int32_t pos_offset, pos_step;
+
+  // Zeilen-Cache, adressiert über pos mod cache_rows
+  int32_t cache_rows;
+  size_t row_bytes, row_stride;
+  int8_t* cache;
+  int32_t* tag;
+  uint8_t* tainted;      // pro Ausgabezeile des Fensters
+  const int8_t** rows;   // Zeiger auf die Zeilen des aktuellen Fensters
+};
+
+const tflite::Model* g_model = nullptr;
+StreamLayer g_layers[kMaxLayers];
+int g_num_layers = 0;
+bool g_ready = false;
+
+// Eingangs-Ringpuffer (ein Slot pro Fensterzeile)
+int32_t g_win_h = 0;
+size_t g_frame_bytes = 0;
+int8_t* g_frames = nullptr;
+const int8_t** g_frame_rows = nullptr;
+int32_t g_next_pos = 0;   // absolute Position des nächsten Frames
+int32_t g_filled = 0;
+
+// Kopf: [AVERAGE_POOL_2D] -> [RESHAPE] -> FULLY_CONNECTED -> [SOFTMAX]
+bool g_has_pool = false;
+int32_t g_pool_act_min = -128, g_pool_act_max = 127;
+int8_t* g_head_in = nullptr;
+int32_t g_fc_depth = 0, g_fc_units = 0;
+const int8_t* g_fc_filter = nullptr;
+const int32_t* g_fc_bias = nullptr;
+int32_t g_fc_in_offset = 0, g_fc_filter_offset = 0, g_fc_out_offset = 0;
+int32_t g_fc_mult = 0, g_fc_shift = 0;
+int32_t g_fc_act_min = -128, g_fc_act_max = 127;
+int8_t* g_logits = nullptr;
+bool g_has_softmax = false;
+int32_t g_sm_mult = 0, g_sm_shift = 0, g_sm_diff_min = 0;
+int8_t* g_output = nullptr;
+
+// Zeilen-Sammelpuffer (kh Eingabezeilen) und Kernel-Scratch
+int8_t* g_gather = nullptr;
+void* g_nn_scratch = nullptr;
+
+// Frame-Quelle (db load)
+const int8_t* g_src = nullptr;
+size_t g_src_frames = 0;
+size_t g_src_next = 0;
+
+uint32_t g_rows_computed = 0;
+uint32_t g_rows_total = 0;
+size_t g_mem_bytes = 0;
+stream_alloc_fn g_alloc = nullptr;
+
+// ---------------------------------------------------------------
+// Hilfsfunktionen
+// ---------------------------------------------------------------
+
+// 16-Byte-ausgerichtete Allokation (ESP-NN/CMSIS erwarten Ausrichtung)
+void* AllocAligned(size_t bytes) {
+  uint8_t* raw = (uint8_t*)g_alloc(bytes + 15);
+  if (raw == nullptr) return nullptr;
+  g_mem_bytes += bytes + 15;
+  return (void*)(((uintptr_t)raw + 15) & ~(uintptr_t)15);
+}
+
+inline int32_t PosMod(int32_t pos, int32_t n) {
+  int32_t m = pos % n;
+  return m < 0 ? m + n : m;
+}
+
+const tflite::Tensor* GetTensor(int32_t index) {
+  return g_model->subgraphs()->Get(0)->tensors()->Get(index);
+}
+
+const void* GetTensorData(const tflite::Tensor* t) {
+  const tflite::Buffer* buf = g_model->buffers()->Get(t->buffer());
+  return (buf != nullptr && buf->data() != nullptr) ? buf->data()->data() : nullptr;
+}
+
+int32_t Dim(const tflite::Tensor* t, int i) {
+  return t->shape()->Get(i);
+}
+
+float Scale(const tflite::Tensor* t, int channel = 0) {
+  const tflite::QuantizationParameters* q = t->quantization();
+  if (q == nullptr || q->scale() == nullptr || q->scale()->size() == 0) return 0.0f;
+  if ((uint32_t)channel >= q->scale()->size()) channel = 0;
+  return q->scale()->Get(channel);
+}
+
+int32_t ZeroPoint(const tflite::Tensor* t) {
+  const tflite::QuantizationParameters* q = t->quantization();
+  if (q == nullptr || q->zero_point() == nullptr || q->zero_point()->size() == 0) return 0;
+  return (int32_t)q->zero_point()->Get(0);
+}
+
+// Wie CalculateActivationRangeQuantized() in TFLM
+void ActivationRange(tflite::ActivationFunctionType act, const tflite::Tensor* out,
+                     int32_t* act_min, int32_t* act_max) {
+  const float scale = Scale(out);
+  const int32_t zp = ZeroPoint(out);
+  auto quantize = [scale, zp](float f) {
+    return zp + (int32_t)roundf(f / scale);
+  };
+  int32_t lo = -128, hi = 127;
+  if (act == tflite::ActivationFunctionType_RELU) {
+    lo = std::max(lo, quantize(0.0f));
+  } else if (act == tflite::ActivationFunctionType_RELU6) {
+    lo = std::max(lo, quantize(0.0f));
+    hi = std::min(hi, quantize(6.0f));
+  } else if (act == tflite::ActivationFunctionType_RELU_N1_TO_1) {
+    lo = std::max(lo, quantize(-1.0f));
+    hi = std::min(hi, quantize(1.0f));
+  }
+  *act_min = lo;
+  *act_max = hi;
+}
+
+// Ausgabehöhe/-breite und Padding wie ComputePaddingHeightWidth() in TFLM
+void ComputeGeometry(tflite::Padding padding, int32_t in, int32_t k, int32_t stride,
+                     int32_t* out, int32_t* pad) {
+  if (padding == tflite::Padding_SAME) {
+    *out = (in + stride - 1) / stride;
+  } else {
+    *out = (in - k + stride) / stride;
+  }
+  const int32_t total = std::max((*out - 1) * stride + k - in, (int32_t)0);
+  *pad = total / 2;
+}
+
+bool SetupConvLayer(const tflite::Operator* op, bool depthwise, StreamLayer* L) {
+  const tflite::Tensor* in = GetTensor(op->inputs()->Get(0));
+  const tflite::Tensor* filter = GetTensor(op->inputs()->Get(1));
+  const tflite::Tensor* out = GetTensor(op->outputs()->Get(0));
+  const int32_t bias_index = op->inputs()->size() > 2 ? op->inputs()->Get(2) : -1;
+
+  tflite::Padding padding;
+  tflite::ActivationFunctionType act;
+  if (depthwise) {
+    const tflite::DepthwiseConv2DOptions* o = op->builtin_options_as_DepthwiseConv2DOptions();
+    if (o == nullptr || o->dilation_h_factor() != 1 || o->dilation_w_factor() != 1) return false;
+    padding = o->padding();
+    act = o->fused_activation_function();
+    L->stride_h = o->stride_h();
+    L->stride_w = o->stride_w();
+  } else {
+    const tflite::Conv2DOptions* o = op->builtin_options_as_Conv2DOptions();
+    if (o == nullptr || o->dilation_h_factor() != 1 || o->dilation_w_factor() != 1) return false;
+    padding = o->padding();
+    act = o->fused_activation_function();
+    L->stride_h = o->stride_h();
+    L->stride_w = o->stride_w();
+  }
+
+  L->depthwise = depthwise;
+  L->in_h = Dim(in, 1);
+  L->in_w = Dim(in, 2);
+  L->in_c = Dim(in, 3);
+  L->kh = Dim(filter, 1);
+  L->kw = Dim(filter, 2);
+  L->out_c = Dim(out, 3);
+  L->depth_mult = depthwise ? L->out_c / L->in_c : 1;
+
+  int32_t out_h = 0, out_w = 0;
+  ComputeGeometry(padding, L->in_h, L->kh, L->stride_h, &out_h, &L->pad_h);
+  ComputeGeometry(padding, L->in_w, L->kw, L->stride_w, &out_w, &L->pad_w);
+  L->out_h = out_h;
+  L->out_w = out_w;
+  if (out_h != Dim(out, 1) || out_w != Dim(out, 2)) return false;
+
+  L->filter = (const int8_t*)GetTensorData(filter);
+  L->bias = bias_index >= 0 ? (const int32_t*)GetTensorData(GetTensor(bias_index)) : nullptr;
+  if (L->filter == nullptr) return false;
+
+  L->in_offset = -ZeroPoint(in);
+  L->out_offset = ZeroPoint(out);
+  L->in_pad_value = (int8_t)ZeroPoint(in);
+  ActivationRange(act, out, &L->act_min, &L->act_max);
+
+  // Pro-Kanal-Multiplikatoren wie PopulateConvolutionQuantizationParams()
+  L->mult = (int32_t*)AllocAligned(L->out_c * sizeof(int32_t));
+  L->shift = (int32_t*)AllocAligned(L->out_c * sizeof(int32_t));
+  if (L->mult == nullptr || L->shift == nullptr) return false;
+  const float input_scale = Scale(in);
+  const float output_scale = Scale(out);
+  for (int32_t c = 0; c < L->out_c; c++) {
+    const double effective = (double)input_scale * (double)Scale(filter, c) / (double)output_scale;
+    int shift = 0;
+    tflite::QuantizeMultiplier(effective, &L->mult[c], &shift);
+    L->shift[c] = shift;
+  }
+  return true;
+}
+
+bool SetupHead(const tflite::Operator* op, int code, const StreamLayer& last) {
+  if (code == tflite::BuiltinOperator_AVERAGE_POOL_2D) {
+    const tflite::Pool2DOptions* o = op->builtin_options_as_Pool2DOptions();
+    if (o == nullptr || g_has_pool || g_fc_units != 0) return false;
+    // Nur globales Pooling über das ganze Fenster
+    if (o->filter_height() != last.out_h || o->filter_width() != last.out_w) return false;
+    ActivationRange(o->fused_activation_function(), GetTensor(op->outputs()->Get(0)),
+                    &g_pool_act_min, &g_pool_act_max);
+    g_has_pool = true;
+    return true;
+  }
+  if (code == tflite::BuiltinOperator_RESHAPE) {
+    return g_fc_units == 0;
+  }
+  if (code == tflite::BuiltinOperator_FULLY_CONNECTED) {
+    if (g_fc_units != 0) return false;
+    const tflite::Tensor* in = GetTensor(op->inputs()->Get(0));
+    const tflite::Tensor* filter = GetTensor(op->inputs()->Get(1));
+    const tflite::Tensor* out = GetTensor(op->outputs()->Get(0));
+    const int32_t bias_index = op->inputs()->size() > 2 ? op->inputs()->Get(2) : -1;
+    const tflite::FullyConnectedOptions* o = op->builtin_options_as_FullyConnectedOptions();
+
+    g_fc_units = Dim(filter, 0);
+    g_fc_depth = Dim(filter, 1);
+    const int32_t expected = g_has_pool ? last.out_c : last.out_h * last.out_w * last.out_c;
+    if (g_fc_depth != expected) return false;
+    g_fc_filter = (const int8_t*)GetTensorData(filter);
+    g_fc_bias = bias_index >= 0 ? (const int32_t*)GetTensorData(GetTensor(bias_index)) : nullptr;
+    if (g_fc_filter == nullptr) return false;
+    g_fc_in_offset = -ZeroPoint(in);
+    g_fc_filter_offset = -ZeroPoint(filter);
+    g_fc_out_offset = ZeroPoint(out);
+    ActivationRange(o != nullptr ? o->fused_activation_function()
+                                 : tflite::ActivationFunctionType_NONE,
+                    out, &g_fc_act_min, &g_fc_act_max);
+    // Wie GetQuantizedConvolutionMultipler(): Produkt erst in float
+    const double real = (double)(Scale(in) * Scale(filter)) / (double)Scale(out);
+    int shift = 0;
+    tflite::QuantizeMultiplier(real, &g_fc_mult, &shift);
+    g_fc_shift = shift;
+    return true;
+  }
+  if (code == tflite::BuiltinOperator_SOFTMAX) {
+    const tflite::SoftmaxOptions* o = op->builtin_options_as_SoftmaxOptions();
+    if (g_fc_units == 0 || g_has_softmax) return false;
+    const float beta = o != nullptr ? o->beta() : 1.0f;
+    int shift = 0;
+    tflite::PreprocessSoftmaxScaling((double)beta, (double)Scale(GetTensor(op->inputs()->Get(0))),
+                                     kSoftmaxDiffBits, &g_sm_mult, &shift);
+    g_sm_shift = shift;
+    g_sm_diff_min = -1 * tflite::CalculateInputRadius(kSoftmaxDiffBits, shift);
+    g_has_softmax = true;
+    return true;
+  }
+  return false;
+}
+
+// Eine Ausgabezeile mit dem Plattform-Kernel rechnen. src enthält genau kh
+// Eingabezeilen (fehlende Randzeilen mit dem Eingangs-Nullpunkt gefüllt),
+// daher läuft der Kernel in der Höhe immer ohne Padding.
+void RunKernel(const StreamLayer& L, const int8_t* src, int8_t* dst) {
+#if STREAM_USE_ESP_NN
+  const data_dims_t in_dims = {L.in_w, L.kh, L.in_c, 1};
+  const data_dims_t filter_dims = {L.kw, L.kh, L.in_c, L.out_c};
+  const data_dims_t out_dims = {L.out_w, 1, L.out_c, 1};
+  const quant_data_t quant = {L.shift, L.mult};
+  if (L.depthwise) {
+    const dw_conv_params_t params = {
+        L.in_offset, L.out_offset, L.depth_mult,
+        {L.stride_w, L.stride_h}, {L.pad_w, 0}, {1, 1}, {L.act_min, L.act_max}};
+    esp_nn_set_depthwise_conv_scratch_buf(g_nn_scratch);
+    esp_nn_depthwise_conv_s8(&in_dims, src, &filter_dims, L.filter, L.bias,
+                             &out_dims, dst, &params, &quant);
+  } else {
+    const conv_params_t params = {
+        L.in_offset, L.out_offset,
+        {L.stride_w, L.stride_h}, {L.pad_w, 0}, {1, 1}, {L.act_min, L.act_max}};
+    esp_nn_set_conv_scratch_buf(g_nn_scratch);
+    esp_nn_conv_s8(&in_dims, src, &filter_dims, L.filter, L.bias,
+                   &out_dims, dst, &params, &quant);
+  }
+#else
+  const tflite::RuntimeShape in_shape({1, L.kh, L.in_w, L.in_c});
+  const tflite::RuntimeShape out_shape({1, 1, L.out_w, L.out_c});
+  const tflite::RuntimeShape bias_shape({L.out_c});
+  if (L.depthwise) {
+    tflite::DepthwiseParams op;
+    op.input_offset = L.in_offset;
+    op.weights_offset = 0;
+    op.output_offset = L.out_offset;
+    op.stride_width = L.stride_w;
+    op.stride_height = L.stride_h;
+    op.dilation_width_factor = 1;
+    op.dilation_height_factor = 1;
+    op.padding_type = tflite::PaddingType::kSame;
+    op.padding_values.width = L.pad_w;
+    op.padding_values.height = 0;
+    op.depth_multiplier = L.depth_mult;
+    op.quantized_activation_min = L.act_min;
+    op.quantized_activation_max = L.act_max;
+    tflite::reference_integer_ops::DepthwiseConvPerChannel(
+        op, L.mult, L.shift, in_shape, src,
+        tflite::RuntimeShape({1, L.kh, L.kw, L.out_c}), L.filter,
+        bias_shape, L.bias, out_shape, dst);
+  } else {
+    tflite::ConvParams op;
+    op.input_offset = L.in_offset;
+    op.weights_offset = 0;
+    op.output_offset = L.out_offset;
+    op.stride_width = L.stride_w;
+    op.stride_height = L.stride_h;
+    op.dilation_width_factor = 1;
+    op.dilation_height_factor = 1;
+    op.padding_type = tflite::PaddingType::kSame;
+    op.padding_values.width = L.pad_w;
+    op.padding_values.height = 0;
+    op.quantized_activation_min = L.act_min;
+    op.quantized_activation_max = L.act_max;
+    tflite::reference_integer_ops::ConvPerChannel(
+        op, L.mult, L.shift, in_shape, src,
+        tflite::RuntimeShape({L.out_c, L.kh, L.kw, L.in_c}), L.filter,
+        bias_shape, L.bias, out_shape, dst);
+  }
+#endif
+}
+
+void ComputeRow(const StreamLayer& L, const int8_t* const* in_rows, int32_t r, int8_t* dst) {
+  const size_t in_row_bytes = (size_t)L.in_w * L.in_c;
+  const int32_t y_origin = r * L.stride_h - L.pad_h;
+
+  // Liegen die kh Eingabezeilen schon lückenlos und ausgerichtet im Cache?
+  bool direct = y_origin >= 0 && y_origin + L.kh <= L.in_h &&
+                ((uintptr_t)in_rows[y_origin] & 15) == 0;
+  for (int32_t i = 1; direct && i < L.kh; i++) {
+    direct = in_rows[y_origin + i] == in_rows[y_origin] + i * in_row_bytes;
+  }
+  if (direct) {
+    RunKernel(L, in_rows[y_origin], dst);
+    return;
+  }
+
+  for (int32_t i = 0; i < L.kh; i++) {
+    const int32_t y = y_origin + i;
+    int8_t* row = g_gather + i * in_row_bytes;
+    if (y < 0 || y >= L.in_h) {
+      memset(row, L.in_pad_value, in_row_bytes);
+    } else {
+      memcpy(row, in_rows[y], in_row_bytes);
+    }
+  }
+  RunKernel(L, g_gather, dst);
+}
+
+void RunHead(const StreamLayer& last) {
+  const size_t row_bytes = last.row_bytes;
+  const int8_t* fc_in = nullptr;
+
+  if (g_has_pool) {
+    // Globales AVERAGE_POOL_2D, Rundung wie reference_integer_ops::AveragePool
+    const int32_t count = last.out_h * last.out_w;
+    for (int32_t c = 0; c < last.out_c; c++) {
+      int32_t acc = 0;
+      for (int32_t y = 0; y < last.out_h; y++) {
+        const int8_t* row = last.rows[y];
+        for (int32_t x = 0; x < last.out_w; x++) {
+          acc += row[x * last.out_c + c];
+        }
+      }
+      acc = acc > 0 ? (acc + count / 2) / count : (acc - count / 2) / count;
+      acc = std::max(acc, g_pool_act_min);
+      acc = std::min(acc, g_pool_act_max);
+      g_head_in[c] = (int8_t)acc;
+    }
+    fc_in = g_head_in;
+  } else if (last.out_h == 1) {
+    fc_in = last.rows[0];
+  } else {
+    for (int32_t y = 0; y < last.out_h; y++) {
+      memcpy(g_head_in + y * row_bytes, last.rows[y], row_bytes);
+    }
+    fc_in = g_head_in;
+  }
+
+  int8_t* fc_out = g_has_softmax ? g_logits : g_output;
+  for (int32_t o = 0; o < g_fc_units; o++) {
+    const int8_t* w = g_fc_filter + o * g_fc_depth;
+    int32_t acc = 0;
+    for (int32_t d = 0; d < g_fc_depth; d++) {
+      acc += (w[d] + g_fc_filter_offset) * (fc_in[d] + g_fc_in_offset);
+    }
+    if (g_fc_bias != nullptr) acc += g_fc_bias[o];
+    acc = tflite::MultiplyByQuantizedMultiplier(acc, g_fc_mult, g_fc_shift);
+    acc += g_fc_out_offset;
+    acc = std::max(acc, g_fc_act_min);
+    acc = std::min(acc, g_fc_act_max);
+    fc_out[o] = (int8_t)acc;
+  }
+
+  if (g_has_softmax) {
+#if STREAM_USE_ESP_NN
+    esp_nn_set_softmax_scratch_buf(g_nn_scratch);
+    esp_nn_softmax_s8(g_logits, 1, g_fc_units, g_sm_mult, g_sm_shift, g_sm_diff_min, g_output);
+#else
+    tflite::SoftmaxParams params;
+    params.input_multiplier = g_sm_mult;
+    params.input_left_shift = g_sm_shift;
+    params.diff_min = g_sm_diff_min;
+    const tflite::RuntimeShape shape({1, g_fc_units});
+    tflite::reference_ops::Softmax(params, shape, g_logits, shape, g_output);
+#endif
+  }
+}
+
+}  // namespace
+
+// ---------------------------------------------------------------
+// Öffentliche API
+// ---------------------------------------------------------------
+
+bool stream_init(const tflite::Model* model, stream_alloc_fn alloc) {
+  g_ready = false;
+  g_model = model;
+  g_alloc = alloc;
+  g_num_layers = 0;
+  g_has_pool = false;
+  g_has_softmax = false;
+  g_fc_units = 0;
+  g_mem_bytes = 0;
+
+  const tflite::SubGraph* sg = model->subgraphs()->Get(0);
+  const tflite::Tensor* input = GetTensor(sg->inputs()->Get(0));
+  if (input->type() != tflite::TensorType_INT8 || input->shape()->size() != 4) return false;
+
+  // 1. Graph durchlaufen: Conv-Kette, danach Kopf
+  int32_t prev_out = sg->inputs()->Get(0);
+  bool in_head = false;
+  for (uint32_t i = 0; i < sg->operators()->size(); i++) {
+    const tflite::Operator* op = sg->operators()->Get(i);
+    const int code = tflite::GetBuiltinCode(model->operator_codes()->Get(op->opcode_index()));
+    if (op->inputs()->Get(0) != prev_out) return false;
+    prev_out = op->outputs()->Get(0);
+
+    const bool is_conv = code == tflite::BuiltinOperator_CONV_2D ||
+                         code == tflite::BuiltinOperator_DEPTHWISE_CONV_2D;
+    if (is_conv && !in_head) {
+      if (g_num_layers >= kMaxLayers) return false;
+      if (!SetupConvLayer(op, code == tflite::BuiltinOperator_DEPTHWISE_CONV_2D,
+                          &g_layers[g_num_layers])) {
+        return false;
+      }
+      g_num_layers++;
+      continue;
+    }
+    if (g_num_layers == 0) return false;
+    in_head = true;
+    if (!SetupHead(op, code, g_layers[g_num_layers - 1])) return false;
+  }
+  if (g_num_layers == 0 || g_fc_units == 0 || prev_out != sg->outputs()->Get(0)) return false;
+
+  // 2. Positionen, abgeschnittene Zeilen und Cache-Größen
+  g_win_h = g_layers[0].in_h;
+  g_frame_bytes = (size_t)g_layers[0].in_w * g_layers[0].in_c;
+  int32_t offset = 0, step = 1;
+  const uint8_t* prev_tainted = nullptr;
+  size_t gather_bytes = 0;
+  int32_t scratch_bytes = 0;
+
+  for (int l = 0; l < g_num_layers; l++) {
+    StreamLayer& L = g_layers[l];
+    L.pos_offset = offset - L.pad_h * step;
+    L.pos_step = step * L.stride_h;
+    offset = L.pos_offset;
+    step = L.pos_step;
+
+    L.tainted = (uint8_t*)AllocAligned(L.out_h);
+    L.rows = (const int8_t**)AllocAligned(L.out_h * sizeof(int8_t*));
+    if (L.tainted == nullptr || L.rows == nullptr) return false;
+    for (int32_t r = 0; r < L.out_h; r++) {
+      const int32_t y_origin = r * L.stride_h - L.pad_h;
+      bool t = y_origin < 0 || y_origin + L.kh > L.in_h;
+      for (int32_t y = std::max(y_origin, (int32_t)0);
+           !t && prev_tainted != nullptr && y < std::min(y_origin + L.kh, L.in_h); y++) {
+        t = prev_tainted[y] != 0;
+      }
+      L.tainted[r] = t ? 1 : 0;
+    }
+    prev_tainted = L.tainted;
+
+    // Alle Positionen eines Fensters müssen verschiedene Slots haben; dann
+    // überschreibt ein Fenster nie eine Zeile, die später noch gebraucht wird.
+    L.cache_rows = (L.out_h - 1) * L.pos_step + 1;
+    L.row_bytes = (size_t)L.out_w * L.out_c;
+    L.row_stride = (L.row_bytes + 15) & ~(size_t)15;
+    L.cache = (int8_t*)AllocAligned(L.cache_rows * L.row_stride);
+    L.tag = (int32_t*)AllocAligned(L.cache_rows * sizeof(int32_t));
+    if (L.cache == nullptr || L.tag == nullptr) return false;
+
+    gather_bytes = std::max(gather_bytes, (size_t)L.kh * L.in_w * L.in_c);
+#if STREAM_USE_ESP_NN
+    const data_dims_t in_dims = {L.in_w, L.kh, L.in_c, 1};
+    const data_dims_t filter_dims = {L.kw, L.kh, L.in_c, L.out_c};
+    const data_dims_t out_dims = {L.out_w, 1, L.out_c, 1};
+    if (L.depthwise) {
+      const dw_conv_params_t params = {
+          L.in_offset, L.out_offset, L.depth_mult,
+          {L.stride_w, L.stride_h}, {L.pad_w, 0}, {1, 1}, {L.act_min, L.act_max}};
+      scratch_bytes = std::max(scratch_bytes, (int32_t)esp_nn_get_depthwise_conv_scratch_size(
+                                                  &in_dims, &filter_dims, &out_dims, &params));
+    } else {
+      const conv_params_t params = {
+          L.in_offset, L.out_offset,
+          {L.stride_w, L.stride_h}, {L.pad_w, 0}, {1, 1}, {L.act_min, L.act_max}};
+      scratch_bytes = std::max(scratch_bytes, (int32_t)esp_nn_get_conv_scratch_size(
+                                                  &in_dims, &filter_dims, &out_dims, &params));
+    }
+#endif
+  }
+#if STREAM_USE_ESP_NN
+  if (g_has_softmax) {
+    scratch_bytes = std::max(scratch_bytes, esp_nn_get_softmax_scratch_size(g_fc_units, 1));
+  }
+  if (scratch_bytes > 0) {
+    g_nn_scratch = AllocAligned(scratch_bytes);
+    if (g_nn_scratch == nullptr) return false;
+  }
+#endif
+
+  const StreamLayer& last = g_layers[g_num_layers - 1];
+  g_frames = (int8_t*)AllocAligned(g_win_h * g_frame_bytes);
+  g_frame_rows = (const int8_t**)AllocAligned(g_win_h * sizeof(int8_t*));
+  g_gather = (int8_t*)AllocAligned(gather_bytes);
+  g_head_in = (int8_t*)AllocAligned(g_has_pool ? last.out_c : last.out_h * last.row_bytes);
+  g_logits = (int8_t*)AllocAligned(g_fc_units);
+  g_output = (int8_t*)AllocAligned(g_fc_units);
+  if (g_frames == nullptr || g_frame_rows == nullptr || g_gather == nullptr ||
+      g_head_in == nullptr || g_logits == nullptr || g_output == nullptr) {
+    return false;
+  }
+
+  g_ready = true;
+  stream_reset();
+  return true;
+}
+
+void stream_reset(void) {
+  if (!g_ready) return;
+  for (int l = 0; l < g_num_layers; l++) {
+    for (int32_t i = 0; i < g_layers[l].cache_rows; i++) g_layers[l].tag[i] = kNoTag;
+  }
+  g_next_pos = 0;
+  g_filled = 0;
+  g_rows_computed = 0;
+  g_rows_total = 0;
+}
+
+void stream_push_frame(const int8_t* frame) {
+  if (!g_ready) return;
+  memcpy(g_frames + PosMod(g_next_pos, g_win_h) * g_frame_bytes, frame, g_frame_bytes);
+  g_next_pos++;
+  if (g_filled < g_win_h) g_filled++;
+}
+
+bool stream_invoke(void) {
+  if (!g_ready || g_filled < g_win_h) return false;
+
+  const int32_t s = g_next_pos - g_win_h;
+  for (int32_t r = 0; r < g_win_h; r++) {
+    g_frame_rows[r] = g_frames + PosMod(s + r, g_win_h) * g_frame_bytes;
+  }
+
+  const int8_t* const* in_rows = g_frame_rows;
+  for (int l = 0; l < g_num_layers; l++) {
+    StreamLayer& L = g_layers[l];
+    for (int32_t r = 0; r < L.out_h; r++) {
+      const int32_t pos = s + L.pos_offset + r * L.pos_step;
+      const int32_t slot = PosMod(pos, L.cache_rows);
+      int8_t* dst = L.cache + slot * L.row_stride;
+      L.rows[r] = dst;
+      if (!L.tainted[r] && L.tag[slot] == pos) continue;
+      ComputeRow(L, in_rows, r, dst);
+      L.tag[slot] = L.tainted[r] ? kNoTag : pos;
+      g_rows_computed++;
+    }
+    g_rows_total += L.out_h;
+    in_rows = L.rows;
+  }
+
+  RunHead(g_layers[g_num_layers - 1]);
+  return true;
+}
+
+const int8_t* stream_output(void) { return g_output; }
+
+size_t stream_frame_bytes(void) { return g_frame_bytes; }
+
+int stream_window_frames(void) { return g_win_h; }
+
+void stream_copy_window(int8_t* dst) {
+  const int32_t s = g_next_pos - g_win_h;
+  for (int32_t r = 0; r < g_win_h; r++) {
+    memcpy(dst + r * g_frame_bytes, g_frames + PosMod(s + r, g_win_h) * g_frame_bytes,
+           g_frame_bytes);
+  }
+}
+
+bool stream_set_source(const int8_t* frames, size_t bytes) {
+  if (!g_ready || bytes < g_win_h * g_frame_bytes) return false;
+  g_src = frames;
+  g_src_frames = bytes / g_frame_bytes;
+  stream_reset();
+  for (int32_t i = 0; i < g_win_h - 1; i++) {
+    stream_push_frame(g_src + i * g_frame_bytes);
+  }
+  g_src_next = g_win_h - 1;
+  return true;
+}
+
+bool stream_step(void) {
+  if (g_src == nullptr) return false;
+  do {
+    stream_push_frame(g_src + g_src_next * g_frame_bytes);
+    g_src_next = (g_src_next + 1) % g_src_frames;
+  } while (g_filled < g_win_h);
+  return stream_invoke();
+}
+
+void stream_get_stats(uint32_t* rows_computed, uint32_t* rows_total) {
+  *rows_computed = g_rows_computed;
+  *rows_total = g_rows_total;
+}
+
+size_t stream_memory_bytes(void) { return g_mem_bytes; }
+
+#endif  // TH_STREAMING
@@ -0,0 +1,92 @@
+/*
+ * streaming_conv.h
+ *
+ * Inkrementelle (Streaming-) Ausführung von Faltungsnetzen, deren
+ * Höhen-Achse die Zeit ist (kws01 DS-CNN: 49 MFCC-Frames x 10 Koeffizienten,
+ * strww01: 30 Frames x 40 Mel-Bänder, nur VALID-Faltungen).
+ *
+ * Der Zustand zwischen zwei th_infer()-Aufrufen sind die Zeilen-Caches. Bei
+ * strww01 (ohne Padding) entsteht pro Hop genau eine neue Zeile je Schicht,
+ * die Arbeit pro Entscheidung ist also unabhängig von der Fensterlänge.
+ *
+ * Statt bei jedem Hop das komplette Fenster durch Invoke() zu schicken,
+ * hält das Modul einen Ringpuffer der Merkmals-Frames und pro Schicht einen
+ * Zeilen-Cache, der über die absolute Zeitposition adressiert wird. Neu
+ * berechnet werden nur Ausgabezeilen, die
+ *   - von neu eingetroffenen Frames abhängen oder
+ *   - vom SAME-Padding am Fensterrand beeinflusst sind.
+ * Alle anderen Zeilen kommen aus dem Cache. Die Kernel sind dieselben, die
+ * TFLM auf der jeweiligen Plattform benutzt (ESP-NN auf ESP32, sonst die
+ * TFLM-Referenzkernel), das Ergebnis soll daher bitgleich zum vollen Fenster
+ * sein. Geprüft wird das auf dem Host mit tflm_host/stream_test (braucht die
+ * TFLM-Quellen, sonst "Skipped") oder auf dem Gerät mit TH_STREAMING_VERIFY.
+ *
+ * Unterstützter Graph: Kette aus CONV_2D / DEPTHWISE_CONV_2D, danach
+ * optional AVERAGE_POOL_2D (global), RESHAPE, FULLY_CONNECTED, SOFTMAX.
+ *
+ * Aktivierung über Build-Flags (platformio.ini):
+ *   -D TH_STREAMING=1         Streaming-Modus für th_load_tensor/th_infer
+ *   -D TH_STREAMING_VERIFY=1  jedes Streaming-Ergebnis gegen Invoke() prüfen
+ */
+
+#ifndef TH_STREAMING_CONV_H_
+#define TH_STREAMING_CONV_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef TH_STREAMING
+#define TH_STREAMING 0
+#endif
+
+#ifndef TH_STREAMING_VERIFY
+#define TH_STREAMING_VERIFY 0
+#endif
+
+namespace tflite {
+struct Model;
+}
+
+// Speicherbeschaffung liegt beim Board (SRAM/PSRAM/SDRAM-Strategie)
+typedef void* (*stream_alloc_fn)(size_t bytes);
+
+// Analysiert den Graphen und legt Caches an. false = Modell nicht
+// streamingfähig oder zu wenig Speicher (Aufrufer bleibt bei Invoke()).
+bool stream_init(const tflite::Model* model, stream_alloc_fn alloc);
+
+// Verwirft Ringpuffer und alle Caches (z.B. nach neuem "db load")
+void stream_reset(void);
+
+// Hängt einen Frame (Breite x Kanäle Bytes, int8) an das Fenster an
+void stream_push_frame(const int8_t* frame);
+
+// Berechnet das aktuelle Fenster. false, solange noch nicht genug Frames
+// für ein volles Fenster vorliegen.
+bool stream_invoke(void);
+
+// int8-Ausgabe des letzten stream_invoke() (gleiche Quantisierung wie output(0))
+const int8_t* stream_output(void);
+
+size_t stream_frame_bytes(void);
+int stream_window_frames(void);
+
+// Kopiert das aktuelle Fenster zusammenhängend nach dst (für Invoke()-Vergleich)
+void stream_copy_window(int8_t* dst);
+
+// Frame-Quelle für den Benchmark-Betrieb: "db load" liefert eine Folge von
+// Frames (mindestens ein Fenster). Legt die ersten Fensterzeilen - 1 Frames
+// vor, sodass der erste stream_step() genau das geladene Fenster rechnet.
+// Der Puffer muss gültig bleiben, solange gestreamt wird.
+bool stream_set_source(const int8_t* frames, size_t bytes);
+
+// Nächsten Frame der Quelle anhängen (zyklisch) und Fenster berechnen.
+// Nach stream_reset() wird das Fenster dabei zuerst komplett neu gefüllt.
+bool stream_step(void);
+
+// Zeilenstatistik seit stream_reset(): neu berechnete vs. benötigte Zeilen
+void stream_get_stats(uint32_t* rows_computed, uint32_t* rows_total);
+
+// Belegter Speicher für Ringpuffer, Caches und Scratch
+size_t stream_memory_bytes(void);
+
+#endif  // TH_STREAMING_CONV_H_
@@ -0,0 +1,50 @@
+/*
+ * th_stock_kernel.h
+ *
+ * Rückfall eines eigenen Kernels (Fusionen, nn_parallel) auf den
+ * Standardkernel von esp-tflite-micro für Knoten, die er nicht abdeckt
+ * (z.B. Dilation, Batch > 1, anderer Datentyp). Statt Prepare mit
+ * kTfLiteError abzubrechen, legt der eigene Kernel in Prepare die
+ * Knotendaten des Standardkernels an und ruft in Eval dessen invoke().
+ *
+ * node->user_data bleibt beim eigenen Kernel; nur für die Dauer des
+ * Aufrufs zeigt er auf die Daten des Standardkernels:
+ *
+ *   Prepare:  if (!unterstützt) return th_stock_prepare(ctx, node, stock, &data->stock);
+ *   Eval:     if (data->stock != nullptr) return th_stock_invoke(ctx, node, stock, data->stock);
+ *
+ * Der Standardkernel wird erst hier initialisiert, Knoten ohne Rückfall
+ * kosten also keine Arena.
+ */
+
+#ifndef TH_STOCK_KERNEL_H_
+#define TH_STOCK_KERNEL_H_
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/micro_common.h"
+
+// init() wie im Interpreter (eingebaute Ops: builtin_data, Länge 0) und
+// prepare(); *stock_data ist danach nie nullptr
+inline TfLiteStatus th_stock_prepare(TfLiteContext* context, TfLiteNode* node,
+                                     const TFLMRegistration& stock, void** stock_data) {
+  void* own = node->user_data;
+  void* data = stock.init != nullptr
+      ? stock.init(context, static_cast<const char*>(node->builtin_data), 0) : own;
+  TF_LITE_ENSURE(context, data != nullptr);
+  *stock_data = data;
+  node->user_data = data;
+  const TfLiteStatus status = stock.prepare != nullptr ? stock.prepare(context, node) : kTfLiteOk;
+  node->user_data = own;
+  return status;
+}
+
+inline TfLiteStatus th_stock_invoke(TfLiteContext* context, TfLiteNode* node,
+                                    const TFLMRegistration& stock, void* stock_data) {
+  void* own = node->user_data;
+  node->user_data = stock_data;
+  const TfLiteStatus status = stock.invoke(context, node);
+  node->user_data = own;
+  return status;
+}
+
+#endif  // TH_STOCK_KERNEL_H_
@@ -0,0 +1,546 @@
+/*
+ * th_tflm.cpp
+ *
+ * Modellseitige th_-Methoden, für alle Boards gleich (siehe th_tflm.h).
+ */
+
+#include "th_tflm.h"
+#include "th_hal.h"
+
+#include <stdint.h>
+#include <string.h>
+
+// Streaming-Ausführung (kws01/strww01, -D TH_STREAMING=1)
+#include "streaming_conv.h"
+
+// Gebatchte Autoencoder-Ausführung (ad01, -D TH_AD_BATCH=B)
+#include "ad_batch.h"
+
+namespace {
+const tflite::Model* model = nullptr;
+tflite::MicroInterpreter* interpreter = nullptr;
+TfLiteTensor* model_input = nullptr;
+TfLiteTensor* model_output = nullptr;
+
+#if TH_STREAMING
+  bool stream_active = false; // false -> normales Invoke()
+#if TH_STREAMING_VERIFY
+  uint32_t stream_verify_runs = 0;
+  uint32_t stream_verify_fails = 0;
+#endif
+#endif
+
+#if TH_SUMMARY
+  // Für m-summary; die Latenz pro th_infer() zählt th_stats.cpp
+  size_t arena_bytes = 0;
+  const char* arena_location = "internal";
+#endif
+
+#if TH_AD_BATCH
+  bool ad_batch_active = false; // false -> normales Invoke()
+#if TH_AD_BATCH_VERIFY
+  uint32_t ad_verify_runs = 0;
+  uint32_t ad_verify_fails = 0;
+#endif
+#endif
+
+// Caches, Batch-Puffer und Messpuffer wie die Arena: erst intern, dann extern
+void* FeatureAlloc(size_t bytes) { return th_alloc(bytes, nullptr); }
+
+// Mittlere Dauer von n Invoke() in µs
+unsigned long InvokeMeanUs(size_t n) {
+  unsigned long t0 = th_hal_micros();
+  for (size_t i = 0; i < n; i++) interpreter->Invoke();
+  return (unsigned long)(th_hal_micros() - t0) / n;
+}
+} // namespace
+
+// ===================================================================
+// BOARD-HOOKS (vom Board überschreibbar)
+// ===================================================================
+
+__attribute__((weak)) void th_board_load_done(void) {}
+__attribute__((weak)) void th_board_run_begin(void) {}
+__attribute__((weak)) void th_board_results(void) {}
+
+// ===================================================================
+// INITIALISIERUNG
+// ===================================================================
+
+const tflite::Model* th_tflm_model(const unsigned char* model_data) {
+  // Liegen die Gewichte 16-Byte-ausgerichtet? (m-model-align-[...])
+  th_model_align_check(model_data);
+  model = tflite::GetModel(model_data);
+#if TH_CONV_ADD_FUSED
+  // Mustererkennung läuft in Prepare, also vor AllocateTensors()
+  fusion_init(model);
+#endif
+#if TH_FUSE_DW_PW
+  dwpw_init(model);
+#endif
+#if TH_NN_PARALLEL
+  // Faltungen des Modells für den Befehl parallel
+  nn_parallel_init(model);
+#endif
+  return model;
+}
+
+bool th_tflm_start(tflite::MicroInterpreter* interp, size_t arena_size,
+                   const char* location) {
+  interpreter = interp;
+  if (interpreter->AllocateTensors() != kTfLiteOk) {
+    th_printf("FEHLER: AllocateTensors() fehlgeschlagen (%u von %u Bytes belegt).\r\n",
+              (unsigned)interpreter->arena_used_bytes(), (unsigned)arena_size);
+    return false;
+  }
+  model_input = interpreter->input(0);
+  model_output = interpreter->output(0);
+#if TH_SUMMARY
+  arena_bytes = arena_size;
+  arena_location = location;
+#else
+  (void)location;
+#endif
+
+#if TH_CONV_ADD_FUSED
+  int fused_pairs = 0, fused_direct = 0;
+  fusion_get_stats(&fused_pairs, &fused_direct);
+  th_printf("DEBUG: Conv+Add-Fusion: %d Paare erkannt.\r\n", fused_pairs);
+#if TH_PACK_WEIGHTS
+  // Arena-Kosten der umgepackten Filter (Flash-Kopie bleibt)
+  int packed_convs = 0;
+  size_t packed_bytes = 0;
+  fusion_get_pack_stats(&packed_convs, &packed_bytes);
+  th_printf("DEBUG: Vorgepackte Gewichte: %d Faltungen, %u Bytes Arena.\r\n",
+            packed_convs, (unsigned)packed_bytes);
+#endif
+#endif
+
+#if TH_FUSE_DW_PW
+  DwPwStats dwpw;
+  dwpw_get_stats(&dwpw);
+  th_printf("DEBUG: DW+PW-Fusion: %d Paare erkannt, Maske 0x%08lx, %d Zeilen/Streifen.\r\n",
+            dwpw.pairs, (unsigned long)dwpw_get_mask(), TH_FUSE_DW_PW_ROWS);
+#if TH_PACK_WEIGHTS
+  th_printf("DEBUG: Vorgepackte Gewichte: %d Faltungen, %u Bytes Arena.\r\n",
+            dwpw.packed, (unsigned)dwpw.packed_bytes);
+#endif
+#endif
+
+#if TH_FC_PLAN
+  int fc_layers = 0;
+  size_t fc_bytes = 0;
+  fc_plan_get_stats(&fc_layers, &fc_bytes);
+  th_printf("DEBUG: FC-Kanaltabellen: %d Schichten, %u Bytes Arena.\r\n",
+            fc_layers, (unsigned)fc_bytes);
+#endif
+
+#if TH_STREAMING
+  stream_active = stream_init(model, FeatureAlloc);
+  if (stream_active) {
+    th_printf("DEBUG: Streaming aktiv (%d Frames/Fenster, %u Bytes Cache).\r\n",
+              stream_window_frames(), (unsigned)stream_memory_bytes());
+  } else {
+    th_printf("WARN: Modell nicht streamingfaehig, nutze Invoke().\r\n");
+  }
+#endif
+
+#if TH_AD_BATCH
+  ad_batch_active = ad_batch_init(model, TH_AD_BATCH, FeatureAlloc);
+  if (ad_batch_active) {
+    th_printf("DEBUG: Batch aktiv (B=%d, %u Bytes Puffer).\r\n",
+              ad_batch_max(), (unsigned)ad_batch_memory_bytes());
+  } else {
+    th_printf("WARN: Modell nicht batchfaehig, nutze Invoke().\r\n");
+  }
+#endif
+  return true;
+}
+
+TfLiteTensor* th_tflm_input(void) { return model_input; }
+TfLiteTensor* th_tflm_output(void) { return model_output; }
+
+// ===================================================================
+// MLPERF API
+// ===================================================================
+
+void th_load_tensor() {
+  size_t input_size_bytes = model_input->bytes;
+  static uint8_t temp_host_buffer[MAX_DB_INPUT_SIZE];
+
+#if TH_STREAMING
+  // Streaming: der Host darf eine längere Frame-Folge laden, jeder th_infer()
+  // schiebt dann einen Frame (ein Hop) weiter.
+  if (stream_active) {
+    size_t stream_bytes = ee_get_buffer(temp_host_buffer, MAX_DB_INPUT_SIZE);
+    if (!stream_set_source((const int8_t*)temp_host_buffer, stream_bytes)) {
+      th_printf("FEHLER: Streaming braucht mindestens %u Bytes!\r\n", (unsigned)input_size_bytes);
+    }
+  }
+#endif
+#if TH_AD_BATCH
+  // Batch: der Host darf eine längere Frame-Folge laden, daraus entstehen
+  // überlappende Fenster im Abstand TH_AD_BATCH_HOP.
+  if (ad_batch_active) {
+    size_t batch_bytes = ee_get_buffer(temp_host_buffer, MAX_DB_INPUT_SIZE);
+    if (!ad_batch_set_source((const int8_t*)temp_host_buffer, batch_bytes, TH_AD_BATCH_HOP)) {
+      th_printf("FEHLER: Batch braucht mindestens %u Bytes!\r\n", (unsigned)input_size_bytes);
+    }
+  }
+#endif
+
+  size_t host_buffer_size = ee_get_buffer(temp_host_buffer, input_size_bytes);
+
+  if (host_buffer_size != input_size_bytes) {
+    th_printf("FEHLER: Host-Puffer (%d) passt nicht zur Tensor-Groesse (%d)!\r\n",
+              (int)host_buffer_size, (int)input_size_bytes);
+  }
+
+  if (model_input->type == kTfLiteInt8) {
+    int8_t* tensor_data = model_input->data.int8;
+#if (TH_MODEL_VERSION == EE_MODEL_VERSION_IC01) || (TH_MODEL_VERSION == EE_MODEL_VERSION_VWW01)
+    // Bilder: der Host sendet uint8, das Modell erwartet int8
+    for (size_t i = 0; i < input_size_bytes; i++) {
+      tensor_data[i] = (int8_t)((int16_t)temp_host_buffer[i] - 128);
+    }
+#else
+    // kws01, ad01, strww01: die .bin-Dateien sind bereits int8
+    memcpy(tensor_data, temp_host_buffer, input_size_bytes);
+#endif
+  } else if (model_input->type == kTfLiteUInt8) {
+    memcpy(model_input->data.uint8, temp_host_buffer, input_size_bytes);
+  } else {
+    th_printf("FEHLER: Unbekannter Input-Tensor-Typ!\r\n");
+  }
+
+  th_board_load_done();
+}
+
+void th_results() {
+  th_printf("m-results-[");
+  TfLiteTensor* output = model_output;
+  size_t output_size = output->dims->data[output->dims->size - 1];
+  float scale = output->params.scale;
+  int32_t zero_point = output->params.zero_point;
+  int8_t* output_data = output->data.int8;
+#if TH_STREAMING
+  if (stream_active) output_data = (int8_t*)stream_output();
+#endif
+#if TH_AD_BATCH
+  // Rekonstruktion des ersten Fensters im letzten Batch
+  if (ad_batch_active && ad_batch_last_count() > 0) output_data = (int8_t*)ad_batch_output(0);
+#endif
+
+  for (size_t i = 0; i < output_size; i++) {
+    float float_val = ((float)output_data[i] - (float)zero_point) * scale;
+    th_printf("%f", float_val);
+    if (i < output_size - 1) th_printf(",");
+  }
+  th_printf("]\r\n");
+
+#if TH_CONV_ADD_FUSED
+  // direct: Paare, deren Faltung ohne Kopie in den ADD-Ausgang schreibt
+  int fused_pairs = 0, fused_direct = 0;
+  fusion_get_stats(&fused_pairs, &fused_direct);
+  th_printf("m-fusion-[pairs=%d,direct=%d]\r\n", fused_pairs, fused_direct);
+#endif
+
+#if TH_FUSE_DW_PW
+  // mid_bytes: Zwischentensor-Bytes, die im letzten Invoke() nicht mehr
+  // geschrieben/gelesen wurden; strip_bytes: größter Streifenpuffer
+  DwPwStats dwpw;
+  dwpw_get_stats(&dwpw);
+  th_printf("m-dwpw-[pairs=%d,fused=%d,rows=%d,mid_bytes=%u,strip_bytes=%u]\r\n",
+            dwpw.pairs, dwpw.fused, TH_FUSE_DW_PW_ROWS, (unsigned)dwpw.mid_bytes,
+            (unsigned)dwpw.strip_bytes);
+#endif
+
+#if TH_STREAMING
+  if (stream_active) {
+    uint32_t rows_computed = 0, rows_total = 0;
+    stream_get_stats(&rows_computed, &rows_total);
+    th_printf("m-stream-rows-[%lu/%lu]\r\n", (unsigned long)rows_computed, (unsigned long)rows_total);
+#if TH_STREAMING_VERIFY
+    th_printf("m-stream-verify-[%lu/%lu mismatches]\r\n",
+              (unsigned long)stream_verify_fails, (unsigned long)stream_verify_runs);
+#endif
+  }
+#endif
+
+  th_board_results();
+
+#if TH_AD_BATCH
+  if (ad_batch_active) {
+    // MSE-Anomaliescores aller Fenster des letzten Batches
+    const float* scores = ad_batch_scores();
+    int count = ad_batch_last_count();
+    th_printf("m-ad-scores-[");
+    for (int i = 0; i < count; i++) {
+      th_printf("%f", scores[i]);
+      if (i < count - 1) th_printf(",");
+    }
+    th_printf("]\r\n");
+#if TH_AD_BATCH_VERIFY
+    th_printf("m-ad-verify-[%lu/%lu mismatches]\r\n",
+              (unsigned long)ad_verify_fails, (unsigned long)ad_verify_runs);
+#endif
+  }
+#endif
+}
+
+void th_tflm_run(void) {
+  th_board_run_begin();
+#if TH_STREAMING
+  if (stream_active) {
+    if (!stream_step()) {
+      th_printf("FEHLER: stream_step() ohne geladene Frames!\r\n");
+      return;
+    }
+#if TH_STREAMING_VERIFY
+    // Gleiches Fenster komplett durch Invoke() und bitweise vergleichen
+    stream_copy_window(model_input->data.int8);
+    if (interpreter->Invoke() != kTfLiteOk) {
+      th_printf("FEHLER: interpreter->Invoke() failed!\r\n");
+    }
+    stream_verify_runs++;
+    if (memcmp(stream_output(), model_output->data.int8, model_output->bytes) != 0) {
+      stream_verify_fails++;
+    }
+#endif
+    return;
+  }
+#endif
+#if TH_AD_BATCH
+  if (ad_batch_active) {
+    // Ein th_infer() bewertet TH_AD_BATCH Fenster
+    ad_batch_step(TH_AD_BATCH);
+#if TH_AD_BATCH_VERIFY
+    for (int b = 0; b < ad_batch_last_count(); b++) {
+      memcpy(model_input->data.int8, ad_batch_window(b), model_input->bytes);
+      if (interpreter->Invoke() != kTfLiteOk) {
+        th_printf("FEHLER: interpreter->Invoke() failed!\r\n");
+      }
+      ad_verify_runs++;
+      if (memcmp(ad_batch_output(b), model_output->data.int8, model_output->bytes) != 0) {
+        ad_verify_fails++;
+      }
+    }
+#endif
+    return;
+  }
+#endif
+  if (interpreter->Invoke() != kTfLiteOk) {
+    th_printf("FEHLER: interpreter->Invoke() failed!\r\n");
+  }
+}
+
+void th_infer() {
+#if TH_SUMMARY
+  if (th_latency_measuring()) {
+    unsigned long t0 = th_hal_micros();
+    th_tflm_run();
+    th_latency_add((uint32_t)(th_hal_micros() - t0));
+    return;
+  }
+#endif
+  th_tflm_run();
+}
+
+void th_pre() {
+#if TH_SUMMARY
+  // Latenzstatistik nur über die gemessenen Durchläufe (ohne Warmup)
+  th_latency_begin();
+#endif
+}
+
+void th_post() {
+#if TH_SUMMARY
+  th_latency_end();
+#endif
+}
+
+#if TH_SUMMARY
+void th_summary(size_t n, size_t n_warmup) {
+  const char* exec = "invoke";
+#if TH_STREAMING
+  if (stream_active) exec = "stream";
+#endif
+#if TH_AD_BATCH
+  if (ad_batch_active) exec = "batch";
+#endif
+  th_summary_info_t info;
+  info.cpu_mhz = th_hal_cpu_mhz();
+  info.arena_size = arena_bytes;
+  info.arena_location = arena_location;
+  info.arena_used = interpreter ? interpreter->arena_used_bytes() : 0;
+  info.exec = exec;
+  info.kernels = th_kernel_backend();
+  th_summary_print(n, n_warmup, &info, nullptr);
+}
+#endif
+
+// ===================================================================
+// MESSBEFEHLE
+// ===================================================================
+
+#if TH_STREAMING
+// Verwirft Ringpuffer und Zeilen-Caches; der nächste th_infer() füllt das
+// Fenster aus dem geladenen Puffer komplett neu.
+void th_stream_reset(void) {
+  if (stream_active) stream_reset();
+}
+
+// Latenzvergleich: n Streaming-Hops gegen n volle Invoke() auf einem Fenster
+void th_stream_compare(size_t n) {
+  if (!stream_active) {
+    th_printf("e-[Streaming nicht aktiv]\r\n");
+    return;
+  }
+  stream_step(); // Caches füllen, nicht mitgemessen
+  unsigned long t0 = th_hal_micros();
+  for (size_t i = 0; i < n; i++) stream_step();
+  unsigned long stream_us = (unsigned long)(th_hal_micros() - t0) / n;
+  stream_copy_window(model_input->data.int8);
+  th_printf("m-stream-latency-us-[stream=%lu,full=%lu]\r\n", stream_us, InvokeMeanUs(n));
+}
+#endif
+
+#if TH_FUSE_DW_PW
+// Fusion pro Paar schalten (Bit i = Paar i in Modellreihenfolge)
+void th_dwpw_set_mask(unsigned long mask) {
+  dwpw_set_mask((uint32_t)mask);
+  th_printf("m-dwpw-mask-[0x%08lx]\r\n", mask);
+}
+
+// Latenz pro Paar: n Invoke() mit nur diesem Paar fusioniert gegen n Invoke()
+// ganz ohne Fusion. Die Maske wird danach wiederhergestellt.
+void th_dwpw_compare(size_t n) {
+  DwPwStats dwpw;
+  dwpw_get_stats(&dwpw);
+  if (dwpw.pairs == 0) {
+    th_printf("e-[Keine DW+PW-Paare im Modell]\r\n");
+    return;
+  }
+  const uint32_t saved = dwpw_get_mask();
+  dwpw_set_mask(0);
+  interpreter->Invoke();
+  const unsigned long unfused = InvokeMeanUs(n);
+
+  for (int p = 0; p < dwpw.pairs; p++) {
+    dwpw_set_mask(1u << p);
+    interpreter->Invoke();
+    th_printf("m-dwpw-latency-us-[pair=%d,fused=%lu,unfused=%lu]\r\n", p,
+              InvokeMeanUs(n), unfused);
+  }
+  dwpw_set_mask(saved);
+}
+#endif
+
+#if TH_PACK_WEIGHTS
+namespace {
+// Pro vorgepackter Faltung eines Moduls: Arena-Bytes und n Invoke() mit nur
+// dieser Faltung vorgepackt gegen n Invoke() ganz ohne; die Differenz ist der
+// Gewinn der Schicht. Danach sind wieder alle vorgepackt.
+void PackCompare(const char* lib, int convs, size_t bytes, void (*set_mask)(uint32_t),
+                 size_t (*conv_bytes)(int), size_t n) {
+  set_mask(0);
+  interpreter->Invoke();
+  const unsigned long unpacked = InvokeMeanUs(n);
+  for (int i = 0; i < convs && i < 32; i++) {
+    set_mask(1u << i);
+    interpreter->Invoke();
+    th_printf("m-pack-latency-us-[lib=%s,conv=%d,bytes=%u,packed=%lu,unpacked=%lu]\r\n",
+              lib, i, (unsigned)conv_bytes(i), InvokeMeanUs(n), unpacked);
+  }
+  set_mask(0xffffffffu);
+  interpreter->Invoke();
+  th_printf("m-pack-total-[lib=%s,convs=%d,bytes=%u,packed=%lu,unpacked=%lu]\r\n",
+            lib, convs, (unsigned)bytes, InvokeMeanUs(n), unpacked);
+}
+} // namespace
+
+void th_pack_compare(size_t n) {
+  int libs = 0;
+#if TH_CONV_ADD_FUSED
+  int convs = 0;
+  size_t bytes = 0;
+  fusion_get_pack_stats(&convs, &bytes);
+  if (convs > 0) {
+    PackCompare("conv_add", convs, bytes, fusion_set_pack_mask, fusion_get_packed_bytes, n);
+    libs++;
+  }
+#endif
+#if TH_FUSE_DW_PW
+  DwPwStats dwpw;
+  dwpw_get_stats(&dwpw);
+  if (dwpw.packed > 0) {
+    PackCompare("dwpw", dwpw.packed, dwpw.packed_bytes, dwpw_set_pack_mask,
+                dwpw_get_packed_bytes, n);
+    libs++;
+  }
+#endif
+  (void)n;
+  if (libs == 0) {
+    th_printf("e-[Keine vorgepackten Faltungen (Fusion aus, Budget oder S3/P4)]\r\n");
+  }
+}
+#endif
+
+#if TH_AD_BATCH
+// Durchsatz gegen Batchgröße: n Schritte je Batchgröße (1, 2, 4, ... max),
+// B=0 ist die Referenz mit einem Invoke() pro Fenster.
+void th_ad_batch_sweep(size_t n) {
+  if (!ad_batch_active || ad_batch_source_windows() == 0) {
+    th_printf("e-[Batch nicht aktiv oder kein Puffer geladen]\r\n");
+    return;
+  }
+  ad_batch_step(1);
+  memcpy(model_input->data.int8, ad_batch_window(0), model_input->bytes);
+  unsigned long t0 = th_hal_micros();
+  for (size_t i = 0; i < n; i++) interpreter->Invoke();
+  unsigned long us = (unsigned long)(th_hal_micros() - t0);
+  th_printf("m-ad-batch-[B=0,us_per_window=%lu,windows_per_s=%lu]\r\n",
+            us / n, (unsigned long)(1000000ULL * n / (us ? us : 1)));
+
+  const int max_batch = ad_batch_max();
+  for (int b = 1;; b *= 2) {
+    if (b > max_batch) b = max_batch;
+    t0 = th_hal_micros();
+    for (size_t i = 0; i < n; i++) ad_batch_step(b);
+    us = (unsigned long)(th_hal_micros() - t0);
+    th_printf("m-ad-batch-[B=%d,us_per_window=%lu,windows_per_s=%lu]\r\n", b,
+              us / (n * b), (unsigned long)(1000000ULL * n * b / (us ? us : 1)));
+    if (b == max_batch) break;
+  }
+}
+#endif
+
+#if TH_NN_PARALLEL
+// Jede Faltung des Modells für sich: seriell, auf alle Worker aufgeteilt und
+// mit dem Kostenmodell; die Summe gewichtet mit der Anzahl im Modell.
+void th_nn_parallel_report(size_t n) {
+  if (!nn_parallel_bench_init(FeatureAlloc)) {
+    th_printf("e-[Parallel: kein Pool oder kein Speicher]\r\n");
+    return;
+  }
+  unsigned long serial = 0, split = 0, autom = 0;
+  for (int i = 0; i < nn_parallel_layer_count(); i++) {
+    const NnParallelLayer* l = nn_parallel_layer(i);
+    NnParallelTiming t;
+    nn_parallel_bench(i, n, &t);
+    th_printf("m-nn-parallel-[layer=%s,shape=%ldx%ldx%ld>%ldx%ldx%ld,filter=%ldx%ld,"
+              "stride=%ld,repeat=%d,"
+              "serial_us=%lu,split_us=%lu,auto_us=%lu]\r\n",
+              l->name, (long)l->in_wd, (long)l->in_ht, (long)l->in_ch,
+              (long)l->out_wd, (long)l->out_ht, (long)l->out_ch, (long)l->filter_wd,
+              (long)l->filter_ht, (long)l->stride_wd, l->repeat,
+              (unsigned long)t.serial_us, (unsigned long)t.split_us,
+              (unsigned long)t.auto_us);
+    serial += (unsigned long)t.serial_us * l->repeat;
+    split += (unsigned long)t.split_us * l->repeat;
+    autom += (unsigned long)t.auto_us * l->repeat;
+  }
+  th_printf("m-nn-parallel-total-[workers=%d,serial_us=%lu,split_us=%lu,auto_us=%lu]\r\n",
+            TH_NN_PARALLEL, serial, split, autom);
+}
+#endif
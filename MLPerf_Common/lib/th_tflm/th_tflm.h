@@ -0,0 +1,157 @@
+/*
+ * th_tflm.h
+ *
+ * Board-unabhängiger TFLM-Teil der Submitter: Operator-Tabellen der Modelle,
+ * th_load_tensor(), th_infer() mit Streaming und Batch, th_results(),
+ * th_summary() und die Messbefehle (stream, batch, dwpw, pack, parallel).
+ *
+ * Das Board behält, was von der Hardware abhängt: Modell-Array und
+ * Arenagröße, Ablage der Arena, den Interpreter (Konstruktor je nach
+ * TFLM-Version), th_kernel_backend() und Board-Extras wie Cache oder
+ * Dual-Core. Ablauf in th_final_initialize():
+ *
+ *   const tflite::Model* model = th_tflm_model(g_model);
+ *   static tflite::MicroInterpreter interpreter(
+ *       model, *th_tflm_resolver<>(), arena, kTensorArenaSize);
+ *   if (!th_tflm_start(&interpreter, kTensorArenaSize, arena_location)) return;
+ *
+ * Zeitmessung über th_hal_micros(), CPU-Takt über th_hal_cpu_mhz().
+ */
+
+#ifndef TH_TFLM_H_
+#define TH_TFLM_H_
+
+#include <stddef.h>
+
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+#include "submitter_implemented.h"
+#include "internally_implemented.h"
+#include "th_stats.h"
+#include "conv_add_fusion.h"
+#include "dw_pw_fusion.h"
+#include "fc_plan.h"
+#include "nn_parallel.h"
+
+// Standard-Kernel der Faltungen, mit TH_NN_PARALLEL zeilenparallel über den
+// Pool (lib/nn_parallel). Ein Board, das eigene Kernel einhängt, leitet davon
+// ab und überdeckt die statische Methode (GIGA: SDRAM-Tiling).
+struct ThTflmKernels {
+  template <typename Resolver>
+  static void AddConv2D(Resolver& resolver) {
+#if TH_NN_PARALLEL
+    resolver.AddConv2D(nn_parallel_conv2d_registration());
+#else
+    resolver.AddConv2D();
+#endif
+  }
+  template <typename Resolver>
+  static void AddDepthwiseConv2D(Resolver& resolver) {
+#if TH_NN_PARALLEL
+    resolver.AddDepthwiseConv2D(nn_parallel_depthwise_registration());
+#else
+    resolver.AddDepthwiseConv2D();
+#endif
+  }
+};
+
+// FULLY_CONNECTED, mit TH_FC_PLAN über die Kanaltabelle (lib/fc_plan)
+template <typename Resolver>
+void th_tflm_add_fully_connected(Resolver& resolver) {
+#if TH_FC_PLAN
+  resolver.AddFullyConnected(fc_plan_registration());
+#else
+  resolver.AddFullyConnected();
+#endif
+}
+
+// Minimaler Resolver für TH_MODEL_VERSION; die Fusionen (TH_FUSE_CONV_ADD,
+// TH_FUSE_DW_PW) haben Vorrang vor den Kerneln des Boards. Conv+Add nur,
+// wo ESP-NN wirklich im Epilog addiert (TH_CONV_ADD_FUSED, nicht auf S3).
+template <typename Kernels = ThTflmKernels>
+tflite::MicroOpResolver* th_tflm_resolver(void) {
+#if TH_MODEL_VERSION == EE_MODEL_VERSION_IC01
+  static tflite::MicroMutableOpResolver<6> resolver;
+  th_tflm_add_fully_connected(resolver);
+#if TH_CONV_ADD_FUSED
+  // Residualblöcke: ADD im Epilog der Faltung (lib/conv_add_fusion)
+  resolver.AddConv2D(fusion_conv2d_registration());
+  resolver.AddAdd(fusion_add_registration());
+#else
+  Kernels::AddConv2D(resolver);
+  resolver.AddAdd();
+#endif
+  resolver.AddAveragePool2D();
+  resolver.AddReshape();
+  resolver.AddSoftmax();
+#elif TH_MODEL_VERSION == EE_MODEL_VERSION_KWS01
+  static tflite::MicroMutableOpResolver<6> resolver;
+#if TH_FUSE_DW_PW
+  // DS-CNN-Blöcke: Depthwise + 1x1 streifenweise (lib/dw_pw_fusion)
+  resolver.AddDepthwiseConv2D(dwpw_depthwise_registration());
+  resolver.AddConv2D(dwpw_conv2d_registration());
+#else
+  Kernels::AddDepthwiseConv2D(resolver);
+  Kernels::AddConv2D(resolver);
+#endif
+  resolver.AddAveragePool2D();
+  resolver.AddReshape();
+  th_tflm_add_fully_connected(resolver);
+  resolver.AddSoftmax();
+#elif TH_MODEL_VERSION == EE_MODEL_VERSION_VWW01
+  static tflite::MicroMutableOpResolver<7> resolver;
+#if TH_FUSE_DW_PW
+  // MobileNet-Blöcke: Depthwise + 1x1 streifenweise (lib/dw_pw_fusion)
+  resolver.AddConv2D(dwpw_conv2d_registration());
+  resolver.AddDepthwiseConv2D(dwpw_depthwise_registration());
+#else
+  Kernels::AddConv2D(resolver);
+  Kernels::AddDepthwiseConv2D(resolver);
+#endif
+  resolver.AddAveragePool2D();
+  resolver.AddReshape();
+  resolver.AddSoftmax();
+  th_tflm_add_fully_connected(resolver);
+  resolver.AddMean();
+#elif TH_MODEL_VERSION == EE_MODEL_VERSION_AD01
+  static tflite::MicroMutableOpResolver<2> resolver;
+  th_tflm_add_fully_connected(resolver);
+  resolver.AddRelu();
+#elif TH_MODEL_VERSION == EE_MODEL_VERSION_STRWW01
+  // Zeitliche Depthwise/Pointwise-Faltungen über 30 Frames, kein LSTM
+  static tflite::MicroMutableOpResolver<5> resolver;
+  Kernels::AddDepthwiseConv2D(resolver);
+  Kernels::AddConv2D(resolver);
+  th_tflm_add_fully_connected(resolver);
+  resolver.AddSoftmax();
+  resolver.AddReshape();
+#else
+  #error "TH_MODEL_VERSION nicht erkannt in th_tflm_resolver()"
+#endif
+  return &resolver;
+}
+
+// Ausrichtungsprüfung, GetModel() und die Mustererkennung der Fusionen;
+// vor dem Interpreter aufrufen (die Fusionen entscheiden in Prepare)
+const tflite::Model* th_tflm_model(const unsigned char* model_data);
+
+// AllocateTensors(), Ein-/Ausgabe und Start von Streaming bzw. Batch.
+// arena_location erscheint in m-summary. false = Meldung ist ausgegeben.
+bool th_tflm_start(tflite::MicroInterpreter* interpreter, size_t arena_size,
+                   const char* arena_location);
+
+TfLiteTensor* th_tflm_input(void);
+TfLiteTensor* th_tflm_output(void);
+
+// Ein Inferenzschritt: Invoke(), Streaming-Hop oder Batch (ohne Zeitmessung)
+void th_tflm_run(void);
+
+// Board-Hooks, leer vorbelegt (schwache Symbole in th_tflm.cpp; th_board_summary
+// für m-summary in th_stats.h)
+void th_board_load_done(void);  // Ende von th_load_tensor(), vor th_timestamp()
+void th_board_run_begin(void);  // vor jedem th_tflm_run()
+void th_board_results(void);    // zusätzliche m-...-Zeilen nach m-results
+
+#endif  // TH_TFLM_H_
@@ -0,0 +1,155 @@
+/*
+ * ad_batch_test.cpp
+ *
+ * lib/ad_batch gegen FULLY_CONNECTED der TFLM-Referenz: ad_batch_run() mit
+ * zufälliger Batchgröße (1..TH_AD_BATCH) über Fenster an zufälligen, auch
+ * unausgerichteten Stellen eines Spektrogramms; jede Rekonstruktion muss
+ * bitgleich zur Referenzausführung des einzelnen Fensters sein (ref_graph),
+ * der MSE-Score gleich dem aus der Referenz-Rekonstruktion. Danach dasselbe
+ * über die Frame-Quelle (ad_batch_set_source/ad_batch_step, zyklisch).
+ *
+ *   ad_batch_test [-n BATCHES] [-s SEED]
+ *
+ * Rückgabe 0 wenn alles gleich ist, sonst 1.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <random>
+#include <vector>
+
+#include "tensorflow/lite/schema/schema_generated.h"
+
+#include "ad_batch.h"
+#include "ref_graph.h"
+
+#include "ad01_model_data.h"
+
+namespace {
+
+void* Alloc(size_t bytes) { return malloc(bytes); }
+
+float g_in_scale = 0.0f, g_out_scale = 0.0f;
+int32_t g_in_zp = 0, g_out_zp = 0;
+size_t g_window = 0;
+
+// MSE wie der Host auswertet, hier aus der Referenz-Rekonstruktion
+float RefScore(const int8_t* in, const int8_t* rec) {
+  float sum = 0.0f;
+  for (size_t i = 0; i < g_window; i++) {
+    const float diff =
+        (float)(rec[i] - g_out_zp) * g_out_scale - (float)(in[i] - g_in_zp) * g_in_scale;
+    sum += diff * diff;
+  }
+  return sum / (float)g_window;
+}
+
+// Fenster b eines Batches gegen die Referenz; false bei Abweichung, gemeldet
+// wird nur mit report (die erste)
+bool Check(const char* what, long n, int b, const int8_t* window, float score, uint32_t seed,
+           bool report) {
+  const int8_t* ref = ref_graph_run(window);
+  const int8_t* got = ad_batch_output(b);
+  if (memcmp(ref, got, g_window) != 0) {
+    size_t i = 0;
+    while (ref[i] == got[i]) i++;
+    if (report) {
+      printf("FEHLER ad01 %s (-s %u): Batch %ld Fenster %d [%zu] ref=%d batch=%d\n", what, seed,
+             n, b, i, ref[i], got[i]);
+    }
+    return false;
+  }
+  const float expected = RefScore(window, ref);
+  if (fabsf(score - expected) > 1e-5f * fabsf(expected)) {
+    if (report) {
+      printf("FEHLER ad01 %s (-s %u): Batch %ld Fenster %d Score %g statt %g\n", what, seed, n, b,
+             (double)score, (double)expected);
+    }
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  long batches = 50;
+  uint32_t seed = 1;
+  int opt;
+  while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+    switch (opt) {
+      case 'n':
+        batches = strtol(optarg, nullptr, 0);
+        break;
+      case 's':
+        seed = (uint32_t)strtoul(optarg, nullptr, 0);
+        break;
+      default:
+        fprintf(stderr, "Aufruf: %s [-n BATCHES] [-s SEED]\n", argv[0]);
+        return 2;
+    }
+  }
+
+  const tflite::Model* model = tflite::GetModel(ad01_int8_tflite);
+  if (!ref_graph_init(model)) {
+    printf("FEHLER ad01: Referenz: %s\n", ref_graph_error());
+    return 1;
+  }
+  if (!ad_batch_init(model, TH_AD_BATCH, Alloc)) {
+    printf("FEHLER ad01: ad_batch_init() lehnt das Modell ab\n");
+    return 1;
+  }
+  g_window = ad_batch_window_bytes();
+  if (g_window != ref_graph_input_bytes() || g_window != ref_graph_output_bytes()) {
+    printf("FEHLER ad01: Fensterbreite %zu passt nicht zur Referenz (%zu -> %zu)\n", g_window,
+           ref_graph_input_bytes(), ref_graph_output_bytes());
+    return 1;
+  }
+  ref_graph_io_quant(&g_in_scale, &g_in_zp, &g_out_scale, &g_out_zp);
+
+  // Spektrogramm mit Platz für 32 Fenster im Abstand TH_AD_BATCH_HOP
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> value(-128, 127);
+  std::vector<int8_t> spectrogram(g_window + 31 * TH_AD_BATCH_HOP);
+  for (auto& v : spectrogram) v = (int8_t)value(rng);
+
+  const int max_batch = ad_batch_max();
+  std::uniform_int_distribution<int> batch_size(1, max_batch);
+  std::uniform_int_distribution<size_t> start(0, spectrogram.size() - g_window);
+  std::vector<const int8_t*> windows(max_batch);
+  std::vector<float> scores(max_batch);
+
+  long checked = 0, bad = 0;
+  for (long n = 0; n < batches; n++) {
+    const int batch = batch_size(rng);
+    for (int b = 0; b < batch; b++) windows[b] = spectrogram.data() + start(rng);
+    ad_batch_run(windows.data(), batch, scores.data());
+    for (int b = 0; b < batch; b++) {
+      checked++;
+      if (!Check("run", n, b, windows[b], scores[b], seed, bad == 0)) bad++;
+    }
+  }
+
+  // Frame-Quelle: zyklisch über mehr Fenster, als die Quelle hat
+  if (!ad_batch_set_source(spectrogram.data(), spectrogram.size(), TH_AD_BATCH_HOP)) {
+    printf("FEHLER ad01: ad_batch_set_source() abgelehnt\n");
+    return 1;
+  }
+  for (long n = 0; n < batches; n++) {
+    ad_batch_step(max_batch);
+    for (int b = 0; b < ad_batch_last_count(); b++) {
+      checked++;
+      if (!Check("step", n, b, ad_batch_window(b), ad_batch_scores()[b], seed, bad == 0)) {
+        bad++;
+      }
+    }
+  }
+
+  printf("%-10s %zu Bytes/Fenster, Batch bis %d, %zu Bytes  %ld/%ld %s\n", "ad01", g_window,
+         max_batch, ad_batch_memory_bytes(), checked - bad, checked, bad ? "ABWEICHUNG" : "ok");
+  return bad == 0 ? 0 : 1;
+}
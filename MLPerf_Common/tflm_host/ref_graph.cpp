@@ -0,0 +1,367 @@
+/*
+ * ref_graph.cpp
+ *
+ * Referenzausführung mit den TFLM-Kerneln (siehe ref_graph.h).
+ *
+ * Die Parameter entstehen einmal in ref_graph_init() wie in Prepare:
+ * ComputePaddingHeightWidth, PopulateConvolutionQuantizationParams (pro
+ * Kanal, in double), GetQuantizedConvolutionMultipler (Produkt der Skalen in
+ * float), CalculateActivationRangeQuantized und PreprocessSoftmaxScaling.
+ * Zwischentensoren liegen getrennt, nicht in einer geplanten Arena.
+ */
+
+#include "ref_graph.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/pooling.h"
+#include "tensorflow/lite/kernels/internal/reference/softmax.h"
+
+namespace {
+
+// TFLM: kScaledDiffIntegerBits in softmax_common
+constexpr int kSoftmaxDiffBits = 5;
+
+struct RefOp {
+  int code;
+  int32_t in, out, filter, bias;  // Tensorindizes, -1 = keiner
+  tflite::ConvParams conv;
+  tflite::DepthwiseParams dw;
+  tflite::PoolParams pool;
+  tflite::FullyConnectedParams fc;
+  tflite::SoftmaxParams softmax;
+  std::vector<int32_t> mult, shift;  // pro Kanal (CONV_2D, DEPTHWISE_CONV_2D)
+};
+
+const tflite::Model* g_model = nullptr;
+std::vector<RefOp> g_ops;
+std::vector<std::vector<int8_t>> g_tensors;  // Nicht-konstante Tensoren
+int32_t g_input = -1, g_output = -1;
+char g_error[128] = "";
+
+const tflite::Tensor* GetTensor(int32_t index) {
+  return g_model->subgraphs()->Get(0)->tensors()->Get(index);
+}
+
+const void* GetConstData(int32_t index) {
+  const tflite::Buffer* buf = g_model->buffers()->Get(GetTensor(index)->buffer());
+  return (buf != nullptr && buf->data() != nullptr && buf->data()->size() > 0)
+             ? buf->data()->data()
+             : nullptr;
+}
+
+int8_t* GetData(int32_t index) {
+  const void* c = GetConstData(index);
+  return c != nullptr ? (int8_t*)c : g_tensors[index].data();
+}
+
+tflite::RuntimeShape Shape(int32_t index) {
+  const flatbuffers::Vector<int32_t>* s = GetTensor(index)->shape();
+  return tflite::RuntimeShape((int)s->size(), s->data());
+}
+
+int32_t Dim(int32_t index, int i) { return GetTensor(index)->shape()->Get(i); }
+
+float Scale(int32_t index, int channel = 0) {
+  const tflite::QuantizationParameters* q = GetTensor(index)->quantization();
+  if (q == nullptr || q->scale() == nullptr || q->scale()->size() == 0) return 0.0f;
+  if ((uint32_t)channel >= q->scale()->size()) channel = 0;
+  return q->scale()->Get(channel);
+}
+
+int32_t ZeroPoint(int32_t index) {
+  const tflite::QuantizationParameters* q = GetTensor(index)->quantization();
+  if (q == nullptr || q->zero_point() == nullptr || q->zero_point()->size() == 0) return 0;
+  return (int32_t)q->zero_point()->Get(0);
+}
+
+// CalculateActivationRangeQuantized()
+void ActivationRange(tflite::ActivationFunctionType act, int32_t out, int32_t* act_min,
+                     int32_t* act_max) {
+  const float scale = Scale(out);
+  const int32_t zp = ZeroPoint(out);
+  auto quantize = [scale, zp](float f) {
+    return zp + (int32_t)roundf(f / scale);
+  };
+  int32_t lo = -128, hi = 127;
+  if (act == tflite::ActivationFunctionType_RELU) {
+    lo = std::max(lo, quantize(0.0f));
+  } else if (act == tflite::ActivationFunctionType_RELU6) {
+    lo = std::max(lo, quantize(0.0f));
+    hi = std::min(hi, quantize(6.0f));
+  } else if (act == tflite::ActivationFunctionType_RELU_N1_TO_1) {
+    lo = std::max(lo, quantize(-1.0f));
+    hi = std::min(hi, quantize(1.0f));
+  }
+  *act_min = lo;
+  *act_max = hi;
+}
+
+// ComputeOutSize() und ComputePaddingWithOffset()
+bool Padding(tflite::Padding padding, int32_t in, int32_t k, int32_t stride, int32_t dilation,
+             int32_t out, int16_t* pad, int16_t* offset) {
+  const int32_t eff = (k - 1) * dilation + 1;
+  const int32_t expected =
+      padding == tflite::Padding_SAME ? (in + stride - 1) / stride : (in + stride - eff) / stride;
+  if (expected != out) return false;
+  const int32_t total = std::max((out - 1) * stride + eff - in, (int32_t)0);
+  *pad = (int16_t)(total / 2);
+  *offset = (int16_t)(total % 2);
+  return true;
+}
+
+bool Fail(const char* what, uint32_t op_index) {
+  snprintf(g_error, sizeof(g_error), "Operator %u: %s", (unsigned)op_index, what);
+  return false;
+}
+
+bool SetupConv(const tflite::Operator* op, bool depthwise, uint32_t i, RefOp* R) {
+  tflite::Padding padding;
+  tflite::ActivationFunctionType act;
+  int32_t stride_h, stride_w, dil_h, dil_w, depth_mult = 1;
+  if (depthwise) {
+    const tflite::DepthwiseConv2DOptions* o = op->builtin_options_as_DepthwiseConv2DOptions();
+    if (o == nullptr) return Fail("ohne Optionen", i);
+    padding = o->padding();
+    act = o->fused_activation_function();
+    stride_h = o->stride_h();
+    stride_w = o->stride_w();
+    dil_h = o->dilation_h_factor();
+    dil_w = o->dilation_w_factor();
+    depth_mult = o->depth_multiplier();
+  } else {
+    const tflite::Conv2DOptions* o = op->builtin_options_as_Conv2DOptions();
+    if (o == nullptr) return Fail("ohne Optionen", i);
+    padding = o->padding();
+    act = o->fused_activation_function();
+    stride_h = o->stride_h();
+    stride_w = o->stride_w();
+    dil_h = o->dilation_h_factor();
+    dil_w = o->dilation_w_factor();
+  }
+
+  int16_t pad_h, pad_w, off_h, off_w;
+  if (!Padding(padding, Dim(R->in, 1), Dim(R->filter, 1), stride_h, dil_h, Dim(R->out, 1),
+               &pad_h, &off_h) ||
+      !Padding(padding, Dim(R->in, 2), Dim(R->filter, 2), stride_w, dil_w, Dim(R->out, 2),
+               &pad_w, &off_w)) {
+    return Fail("Ausgabeform passt nicht zum Padding", i);
+  }
+
+  int32_t act_min, act_max;
+  ActivationRange(act, R->out, &act_min, &act_max);
+
+  const int32_t out_c = Dim(R->out, 3);
+  R->mult.resize(out_c);
+  R->shift.resize(out_c);
+  for (int32_t c = 0; c < out_c; c++) {
+    const double effective =
+        (double)Scale(R->in) * (double)Scale(R->filter, c) / (double)Scale(R->out);
+    int shift = 0;
+    tflite::QuantizeMultiplier(effective, &R->mult[c], &shift);
+    R->shift[c] = shift;
+  }
+
+  if (depthwise) {
+    tflite::DepthwiseParams& p = R->dw;
+    p.padding_type = tflite::PaddingType::kSame;
+    p.padding_values.height = pad_h;
+    p.padding_values.width = pad_w;
+    p.padding_values.height_offset = off_h;
+    p.padding_values.width_offset = off_w;
+    p.stride_height = (int16_t)stride_h;
+    p.stride_width = (int16_t)stride_w;
+    p.dilation_height_factor = (int16_t)dil_h;
+    p.dilation_width_factor = (int16_t)dil_w;
+    p.depth_multiplier = (int16_t)depth_mult;
+    p.input_offset = -ZeroPoint(R->in);
+    p.weights_offset = 0;
+    p.output_offset = ZeroPoint(R->out);
+    p.quantized_activation_min = act_min;
+    p.quantized_activation_max = act_max;
+  } else {
+    tflite::ConvParams& p = R->conv;
+    p.padding_type = tflite::PaddingType::kSame;
+    p.padding_values.height = pad_h;
+    p.padding_values.width = pad_w;
+    p.padding_values.height_offset = off_h;
+    p.padding_values.width_offset = off_w;
+    p.stride_height = (int16_t)stride_h;
+    p.stride_width = (int16_t)stride_w;
+    p.dilation_height_factor = (int16_t)dil_h;
+    p.dilation_width_factor = (int16_t)dil_w;
+    p.input_offset = -ZeroPoint(R->in);
+    p.weights_offset = 0;
+    p.output_offset = ZeroPoint(R->out);
+    p.quantized_activation_min = act_min;
+    p.quantized_activation_max = act_max;
+  }
+  return true;
+}
+
+bool SetupOp(const tflite::Operator* op, uint32_t i, RefOp* R) {
+  switch (R->code) {
+    case tflite::BuiltinOperator_CONV_2D:
+      return SetupConv(op, false, i, R);
+    case tflite::BuiltinOperator_DEPTHWISE_CONV_2D:
+      return SetupConv(op, true, i, R);
+    case tflite::BuiltinOperator_AVERAGE_POOL_2D: {
+      const tflite::Pool2DOptions* o = op->builtin_options_as_Pool2DOptions();
+      if (o == nullptr) return Fail("ohne Optionen", i);
+      tflite::PoolParams& p = R->pool;
+      p.padding_type = tflite::PaddingType::kSame;
+      if (!Padding(o->padding(), Dim(R->in, 1), o->filter_height(), o->stride_h(), 1,
+                   Dim(R->out, 1), &p.padding_values.height, &p.padding_values.height_offset) ||
+          !Padding(o->padding(), Dim(R->in, 2), o->filter_width(), o->stride_w(), 1,
+                   Dim(R->out, 2), &p.padding_values.width, &p.padding_values.width_offset)) {
+        return Fail("Ausgabeform passt nicht zum Padding", i);
+      }
+      p.stride_height = o->stride_h();
+      p.stride_width = o->stride_w();
+      p.filter_height = o->filter_height();
+      p.filter_width = o->filter_width();
+      ActivationRange(o->fused_activation_function(), R->out, &p.quantized_activation_min,
+                      &p.quantized_activation_max);
+      return true;
+    }
+    case tflite::BuiltinOperator_RESHAPE:
+      if (g_tensors[R->in].size() != g_tensors[R->out].size()) {
+        return Fail("RESHAPE mit verschiedener Größe", i);
+      }
+      return true;
+    case tflite::BuiltinOperator_FULLY_CONNECTED: {
+      const tflite::FullyConnectedOptions* o = op->builtin_options_as_FullyConnectedOptions();
+      tflite::FullyConnectedParams& p = R->fc;
+      p.input_offset = -ZeroPoint(R->in);
+      p.weights_offset = -ZeroPoint(R->filter);
+      p.output_offset = ZeroPoint(R->out);
+      // Produkt der Skalen in float wie GetQuantizedConvolutionMultipler()
+      const double real = (double)(Scale(R->in) * Scale(R->filter)) / (double)Scale(R->out);
+      int shift = 0;
+      tflite::QuantizeMultiplier(real, &p.output_multiplier, &shift);
+      p.output_shift = shift;
+      ActivationRange(o != nullptr ? o->fused_activation_function()
+                                   : tflite::ActivationFunctionType_NONE,
+                      R->out, &p.quantized_activation_min, &p.quantized_activation_max);
+      return true;
+    }
+    case tflite::BuiltinOperator_SOFTMAX: {
+      const tflite::SoftmaxOptions* o = op->builtin_options_as_SoftmaxOptions();
+      const float beta = o != nullptr ? o->beta() : 1.0f;
+      int shift = 0;
+      tflite::PreprocessSoftmaxScaling((double)beta, (double)Scale(R->in), kSoftmaxDiffBits,
+                                       &R->softmax.input_multiplier, &shift);
+      R->softmax.input_left_shift = shift;
+      R->softmax.diff_min = -1 * tflite::CalculateInputRadius(kSoftmaxDiffBits, shift);
+      return true;
+    }
+    default:
+      return Fail(tflite::EnumNameBuiltinOperator((tflite::BuiltinOperator)R->code), i);
+  }
+}
+
+const int32_t* BiasData(const RefOp& R) {
+  return R.bias >= 0 ? (const int32_t*)GetConstData(R.bias) : nullptr;
+}
+
+tflite::RuntimeShape BiasShape(const RefOp& R) {
+  return R.bias >= 0 ? Shape(R.bias) : tflite::RuntimeShape();
+}
+
+}  // namespace
+
+bool ref_graph_init(const tflite::Model* model) {
+  g_model = model;
+  g_ops.clear();
+  g_error[0] = '\0';
+
+  const tflite::SubGraph* sg = model->subgraphs()->Get(0);
+  g_tensors.assign(sg->tensors()->size(), std::vector<int8_t>());
+  for (uint32_t t = 0; t < sg->tensors()->size(); t++) {
+    const tflite::Tensor* tensor = sg->tensors()->Get(t);
+    if (GetConstData(t) != nullptr || tensor->shape() == nullptr) continue;
+    size_t bytes = 1;
+    for (uint32_t d = 0; d < tensor->shape()->size(); d++) bytes *= tensor->shape()->Get(d);
+    g_tensors[t].assign(bytes, 0);
+  }
+  g_input = sg->inputs()->Get(0);
+  g_output = sg->outputs()->Get(0);
+
+  for (uint32_t i = 0; i < sg->operators()->size(); i++) {
+    const tflite::Operator* op = sg->operators()->Get(i);
+    RefOp R = {};
+    R.code = tflite::GetBuiltinCode(model->operator_codes()->Get(op->opcode_index()));
+    R.in = op->inputs()->Get(0);
+    R.out = op->outputs()->Get(0);
+    R.filter = op->inputs()->size() > 1 ? op->inputs()->Get(1) : -1;
+    R.bias = op->inputs()->size() > 2 ? op->inputs()->Get(2) : -1;
+    if (GetTensor(R.in)->type() != tflite::TensorType_INT8 ||
+        GetTensor(R.out)->type() != tflite::TensorType_INT8) {
+      return Fail("kein int8", i);
+    }
+    if (!SetupOp(op, i, &R)) return false;
+    g_ops.push_back(R);
+  }
+  return true;
+}
+
+size_t ref_graph_input_bytes(void) { return g_tensors[g_input].size(); }
+
+size_t ref_graph_output_bytes(void) { return g_tensors[g_output].size(); }
+
+void ref_graph_io_quant(float* in_scale, int32_t* in_zp, float* out_scale, int32_t* out_zp) {
+  *in_scale = Scale(g_input);
+  *in_zp = ZeroPoint(g_input);
+  *out_scale = Scale(g_output);
+  *out_zp = ZeroPoint(g_output);
+}
+
+const int8_t* ref_graph_run(const int8_t* input) {
+  memcpy(g_tensors[g_input].data(), input, g_tensors[g_input].size());
+
+  for (const RefOp& R : g_ops) {
+    const int8_t* in = GetData(R.in);
+    int8_t* out = GetData(R.out);
+    switch (R.code) {
+      case tflite::BuiltinOperator_CONV_2D:
+        tflite::reference_integer_ops::ConvPerChannel(
+            R.conv, R.mult.data(), R.shift.data(), Shape(R.in), in, Shape(R.filter),
+            GetData(R.filter), BiasShape(R), BiasData(R), Shape(R.out), out);
+        break;
+      case tflite::BuiltinOperator_DEPTHWISE_CONV_2D:
+        tflite::reference_integer_ops::DepthwiseConvPerChannel(
+            R.dw, R.mult.data(), R.shift.data(), Shape(R.in), in, Shape(R.filter),
+            GetData(R.filter), BiasShape(R), BiasData(R), Shape(R.out), out);
+        break;
+      case tflite::BuiltinOperator_AVERAGE_POOL_2D:
+        tflite::reference_integer_ops::AveragePool(R.pool, Shape(R.in), in, Shape(R.out), out);
+        break;
+      case tflite::BuiltinOperator_RESHAPE:
+        if (in != out) memcpy(out, in, g_tensors[R.out].size());
+        break;
+      case tflite::BuiltinOperator_FULLY_CONNECTED:
+        tflite::reference_integer_ops::FullyConnected(
+            R.fc, Shape(R.in), in, Shape(R.filter), GetData(R.filter), BiasShape(R),
+            BiasData(R), Shape(R.out), out);
+        break;
+      case tflite::BuiltinOperator_SOFTMAX:
+        tflite::reference_ops::Softmax(R.softmax, Shape(R.in), in, Shape(R.out), out);
+        break;
+    }
+  }
+  return g_tensors[g_output].data();
+}
+
+const char* ref_graph_error(void) { return g_error; }
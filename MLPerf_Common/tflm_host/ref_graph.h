@@ -0,0 +1,39 @@
+/*
+ * ref_graph.h
+ *
+ * Referenzausführung eines int8-Modells auf dem Host: Subgraph 0 Operator
+ * für Operator mit den TFLM-Referenzkerneln auf den vollen Tensoren, die
+ * Quantisierungsparameter wie in den Prepare-Funktionen von TFLM. Ersetzt
+ * Invoke() für die Host-Tests, die keinen Interpreter haben.
+ *
+ * Unterstützt: CONV_2D, DEPTHWISE_CONV_2D, AVERAGE_POOL_2D, RESHAPE,
+ * FULLY_CONNECTED, SOFTMAX (alles int8, Batch 1, Bias int32).
+ */
+
+#ifndef TH_REF_GRAPH_H_
+#define TH_REF_GRAPH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace tflite {
+struct Model;
+}
+
+// Tensoren anlegen und Operatoren prüfen. false = Operator nicht
+// unterstützt, Grund über ref_graph_error().
+bool ref_graph_init(const tflite::Model* model);
+
+size_t ref_graph_input_bytes(void);
+size_t ref_graph_output_bytes(void);
+
+// Quantisierung von Ein- und Ausgabe (für dequantisierte Vergleiche)
+void ref_graph_io_quant(float* in_scale, int32_t* in_zp, float* out_scale, int32_t* out_zp);
+
+// Rechnet den Graphen für input (ref_graph_input_bytes() Bytes) und liefert
+// die Ausgabe; gültig bis zum nächsten Aufruf
+const int8_t* ref_graph_run(const int8_t* input);
+
+const char* ref_graph_error(void);
+
+#endif  // TH_REF_GRAPH_H_
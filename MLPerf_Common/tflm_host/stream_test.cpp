@@ -0,0 +1,127 @@
+/*
+ * stream_test.cpp
+ *
+ * lib/streaming gegen das volle Fenster: zufällige Frames werden mit
+ * zufälligem Hop (1..3 Frames, also auch Sprünge über den Zeilen-Cache
+ * hinweg) angehängt, jedes stream_invoke() muss bitgleich zur
+ * Referenzausführung des ganzen Fensters sein (ref_graph, TFLM-Referenz-
+ * kernel). Zwischendurch verwirft ein stream_reset() alle Caches.
+ *
+ *   stream_test [-n HOPS] [-s SEED]
+ *
+ * Rückgabe 0 wenn alles gleich ist, sonst 1.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <random>
+#include <vector>
+
+#include "tensorflow/lite/schema/schema_generated.h"
+
+#include "ref_graph.h"
+#include "streaming_conv.h"
+
+#include "kws01_model_data.h"
+#include "strww01_model_data.h"
+
+namespace {
+
+struct TestModel {
+  const char* name;
+  const unsigned char* data;
+};
+
+const TestModel kModels[] = {
+    {"kws01", kws_ref_model_tflite},
+    {"strww01", str_ww_ref_model_tflite},
+};
+
+void* Alloc(size_t bytes) { return malloc(bytes); }
+
+bool RunModel(const TestModel& m, long hops, uint32_t seed) {
+  const tflite::Model* model = tflite::GetModel(m.data);
+  if (!ref_graph_init(model)) {
+    printf("FEHLER %s: Referenz: %s\n", m.name, ref_graph_error());
+    return false;
+  }
+  if (!stream_init(model, Alloc)) {
+    printf("FEHLER %s: stream_init() lehnt das Modell ab\n", m.name);
+    return false;
+  }
+
+  const size_t frame_bytes = stream_frame_bytes();
+  const int win = stream_window_frames();
+  if (frame_bytes * win != ref_graph_input_bytes()) {
+    printf("FEHLER %s: Fenster %d x %zu passt nicht zur Eingabe (%zu Bytes)\n", m.name, win,
+           frame_bytes, ref_graph_input_bytes());
+    return false;
+  }
+  const size_t out_bytes = ref_graph_output_bytes();
+
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> value(-128, 127);
+  std::uniform_int_distribution<int> hop(1, 3);
+  std::vector<int8_t> frame(frame_bytes), window(frame_bytes * win);
+
+  long checked = 0, bad = 0;
+  for (long h = 0; h < hops; h++) {
+    if (h == hops / 2) stream_reset();
+    const int n = h == 0 || h == hops / 2 ? win : hop(rng);
+    for (int f = 0; f < n; f++) {
+      for (auto& v : frame) v = (int8_t)value(rng);
+      stream_push_frame(frame.data());
+    }
+    if (!stream_invoke()) {
+      printf("FEHLER %s: stream_invoke() ohne volles Fenster (Hop %ld)\n", m.name, h);
+      return false;
+    }
+    stream_copy_window(window.data());
+    const int8_t* ref = ref_graph_run(window.data());
+    const int8_t* got = stream_output();
+    checked++;
+    if (memcmp(ref, got, out_bytes) != 0) {
+      size_t i = 0;
+      while (ref[i] == got[i]) i++;
+      if (bad++ == 0) {
+        printf("FEHLER %s (-s %u): Hop %ld [%zu] ref=%d stream=%d\n", m.name, seed, h, i, ref[i],
+               got[i]);
+      }
+    }
+  }
+
+  uint32_t rows_computed = 0, rows_total = 0;
+  stream_get_stats(&rows_computed, &rows_total);
+  printf("%-10s Fenster %dx%zu, Zeilen %u/%u neu, %zu Bytes  %ld/%ld %s\n", m.name, win,
+         frame_bytes, rows_computed, rows_total, stream_memory_bytes(), checked - bad, checked,
+         bad ? "ABWEICHUNG" : "ok");
+  return bad == 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  long hops = 200;
+  uint32_t seed = 1;
+  int opt;
+  while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+    switch (opt) {
+      case 'n':
+        hops = strtol(optarg, nullptr, 0);
+        break;
+      case 's':
+        seed = (uint32_t)strtoul(optarg, nullptr, 0);
+        break;
+      default:
+        fprintf(stderr, "Aufruf: %s [-n HOPS] [-s SEED]\n", argv[0]);
+        return 2;
+    }
+  }
+
+  bool ok = true;
+  for (const TestModel& m : kModels) ok &= RunModel(m, hops, seed);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,211 @@
+/*
+ * tiling_test.cpp
+ *
+ * SDRAM-Tiling des GIGA (MLPerf_Arduino_Giga/lib/sdram_tiling) auf dem
+ * Host: zufällige CONV_2D/DEPTHWISE_CONV_2D-Schichten (SAME/VALID, Strides,
+ * Kernelgrößen, Offsets, Aktivierungsbereiche) laufen gekachelt mit
+ * zufälligem Arbeitspuffer und müssen bitgleich zum TFLM-Referenzkernel auf
+ * dem ganzen Tensor sein. Die Ausgabe hat Schutzbytes.
+ *
+ * Die MDMA ist durch eine simulierte DMA ersetzt, die jede Kopie erst in
+ * tile_copy_wait ausführt: liest tiling_run() einen Eingabepuffer vor dem
+ * Warten oder überschreibt es eine Quelle, bevor deren Kopie fertig ist,
+ * weicht das Ergebnis ab. Ein zweiter Start auf einem belegten Kanal, eine
+ * Kopie über 64 KB (MDMA-Block) oder eine offene Kopie am Ende von
+ * tiling_run() sind ebenfalls Fehler.
+ *
+ *   tiling_test [-n ITER] [-s SEED]
+ *
+ * Rückgabe 0 wenn alles gleich ist, sonst 1.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h"
+
+#include "sdram_tiling.h"
+
+namespace {
+
+constexpr size_t kSramBytes = 70000;
+constexpr size_t kGuardBytes = 32;
+constexpr int8_t kGuard = 0x5a;
+
+// Simulierte DMA: Kopie erst beim Warten
+struct Pending {
+  void* dst;
+  const void* src;
+  size_t bytes;
+  bool busy;
+};
+Pending g_pending[2];
+const char* g_dma_error = nullptr;
+
+void DmaStart(int channel, void* dst, const void* src, size_t bytes) {
+  if (g_pending[channel].busy) g_dma_error = "Start auf belegtem Kanal";
+  if (bytes > 65536) g_dma_error = "Kopie über 64 KB";
+  g_pending[channel] = {dst, src, bytes, true};
+}
+
+void DmaWait(int channel) {
+  Pending& p = g_pending[channel];
+  if (!p.busy) return;
+  memcpy(p.dst, p.src, p.bytes);
+  p.busy = false;
+}
+
+// Ausgabegröße und Padding wie ComputePaddingHeightWidth() in TFLM
+void Geometry(bool same, int32_t in, int32_t k, int32_t stride, int32_t* out, int32_t* pad) {
+  *out = same ? (in + stride - 1) / stride : (in - k + stride) / stride;
+  *pad = std::max((*out - 1) * stride + k - in, (int32_t)0) / 2;
+}
+
+// Ungekachelter TFLM-Referenzkernel auf dem ganzen Tensor
+void Reference(const TileConv& L, const int8_t* in, int8_t* out) {
+  const tflite::RuntimeShape in_shape({1, L.in_h, L.in_w, L.in_c});
+  const tflite::RuntimeShape out_shape({1, L.out_h, L.out_w, L.out_c});
+  const tflite::RuntimeShape bias_shape({L.out_c});
+  if (L.depthwise) {
+    tflite::DepthwiseParams op = {};
+    op.input_offset = L.in_offset;
+    op.output_offset = L.out_offset;
+    op.stride_width = L.stride_w;
+    op.stride_height = L.stride_h;
+    op.dilation_width_factor = 1;
+    op.dilation_height_factor = 1;
+    op.padding_type = tflite::PaddingType::kSame;
+    op.padding_values.width = L.pad_w;
+    op.padding_values.height = L.pad_h;
+    op.depth_multiplier = L.depth_mult;
+    op.quantized_activation_min = L.act_min;
+    op.quantized_activation_max = L.act_max;
+    tflite::reference_integer_ops::DepthwiseConvPerChannel(
+        op, L.mult, L.shift, in_shape, in, tflite::RuntimeShape({1, L.kh, L.kw, L.out_c}),
+        L.filter, bias_shape, L.bias, out_shape, out);
+  } else {
+    tflite::ConvParams op = {};
+    op.input_offset = L.in_offset;
+    op.output_offset = L.out_offset;
+    op.stride_width = L.stride_w;
+    op.stride_height = L.stride_h;
+    op.dilation_width_factor = 1;
+    op.dilation_height_factor = 1;
+    op.padding_type = tflite::PaddingType::kSame;
+    op.padding_values.width = L.pad_w;
+    op.padding_values.height = L.pad_h;
+    op.quantized_activation_min = L.act_min;
+    op.quantized_activation_max = L.act_max;
+    tflite::reference_integer_ops::ConvPerChannel(
+        op, L.mult, L.shift, in_shape, in, tflite::RuntimeShape({L.out_c, L.kh, L.kw, L.in_c}),
+        L.filter, bias_shape, L.bias, out_shape, out);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  long iterations = 400;
+  uint32_t seed = 1;
+  int opt;
+  while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+    switch (opt) {
+      case 'n':
+        iterations = strtol(optarg, nullptr, 0);
+        break;
+      case 's':
+        seed = (uint32_t)strtoul(optarg, nullptr, 0);
+        break;
+      default:
+        fprintf(stderr, "Aufruf: %s [-n ITER] [-s SEED]\n", argv[0]);
+        return 2;
+    }
+  }
+
+  std::mt19937 rng(seed);
+  auto range = [&rng](int lo, int hi) { return std::uniform_int_distribution<int>(lo, hi)(rng); };
+  static int8_t sram[kSramBytes];
+  tiling_set_copy(DmaStart, DmaWait);
+
+  long checked = 0, bad = 0, tiled = 0;
+  for (long it = 0; it < iterations; it++) {
+    TileConv L = {};
+    L.depthwise = range(0, 1);
+    L.in_h = range(1, 40);
+    L.in_w = range(1, 24);
+    L.in_c = range(1, 16);
+    L.kh = range(1, 5);
+    L.kw = range(1, 5);
+    L.stride_h = range(1, 3);
+    L.stride_w = range(1, 3);
+    L.depth_mult = L.depthwise ? range(1, 2) : 1;
+    L.out_c = L.depthwise ? L.in_c * L.depth_mult : range(1, 16);
+    const bool same = range(0, 1);
+    Geometry(same, L.in_h, L.kh, L.stride_h, &L.out_h, &L.pad_h);
+    Geometry(same, L.in_w, L.kw, L.stride_w, &L.out_w, &L.pad_w);
+    if (L.out_h < 1 || L.out_w < 1) continue;
+
+    std::vector<int8_t> filter(L.kh * L.kw * (L.depthwise ? L.out_c : L.out_c * L.in_c));
+    for (auto& v : filter) v = (int8_t)range(-127, 127);
+    std::vector<int32_t> bias(L.out_c), mult(L.out_c), shift(L.out_c);
+    for (int32_t c = 0; c < L.out_c; c++) {
+      bias[c] = range(-5000, 5000);
+      mult[c] = range(1 << 30, 0x7fffffff);
+      shift[c] = range(-10, -4);
+    }
+    L.filter = filter.data();
+    L.bias = bias.data();
+    L.mult = mult.data();
+    L.shift = shift.data();
+    L.in_offset = range(-127, 128);
+    L.out_offset = range(-128, 127);
+    L.act_min = range(-128, -50);
+    L.act_max = range(50, 127);
+
+    std::vector<int8_t> in((size_t)L.in_h * L.in_w * L.in_c);
+    for (auto& v : in) v = (int8_t)range(-128, 127);
+    const size_t out_bytes = (size_t)L.out_h * L.out_w * L.out_c;
+    std::vector<int8_t> ref(out_bytes), got(out_bytes + kGuardBytes, kGuard);
+    Reference(L, in.data(), ref.data());
+
+    // Mal knapper Puffer (viele Bänder), mal der volle; Anfang unausgerichtet
+    const size_t budget = range(0, 1) ? (size_t)range(200, 4000) : 65536;
+    memset(sram, 0x7b, sizeof(sram));
+    tiling_init(sram + range(0, 31), budget);
+    g_dma_error = nullptr;
+    const int32_t rows = tiling_band_rows(L);
+    tiling_run(L, in.data(), got.data());
+    if (g_pending[0].busy || g_pending[1].busy) g_dma_error = "offene Kopie nach tiling_run()";
+
+    checked++;
+    tiled += rows > 0;
+    bool guard_ok = true;
+    for (size_t i = 0; i < kGuardBytes; i++) guard_ok &= got[out_bytes + i] == kGuard;
+    if (g_dma_error == nullptr && guard_ok && memcmp(ref.data(), got.data(), out_bytes) == 0) {
+      continue;
+    }
+    if (bad++ == 0) {
+      printf("FEHLER tiling (-s %u, Iteration %ld): %s in %dx%dx%d f %dx%d s %d/%d %s "
+             "Puffer %zu Band %d -> %s\n",
+             seed, it, L.depthwise ? "dw" : "conv", L.in_h, L.in_w, L.in_c, L.kh, L.kw,
+             L.stride_h, L.stride_w, same ? "SAME" : "VALID", budget, rows,
+             g_dma_error != nullptr ? g_dma_error
+                                    : guard_ok ? "Abweichung" : "Schutzbytes überschrieben");
+    }
+  }
+
+  uint32_t layers = 0, bands = 0, untiled = 0;
+  tiling_get_stats(&layers, &bands, &untiled);
+  printf("%-10s %ld gekachelt, %u ungekachelt, %u Bänder  %ld/%ld %s\n", "tiling", tiled,
+         untiled, bands, checked - bad, checked, bad ? "ABWEICHUNG" : "ok");
+  return bad == 0 ? 0 : 1;
+}
@@ -0,0 +1,150 @@
+"""
+dwpw_arena.py
+
+Arena-Bilanz der DEPTHWISE_CONV_2D + CONV_2D-1x1-Paare, die
+-D TH_FUSE_DW_PW=1 fusioniert (lib/dw_pw_fusion/dw_pw_fusion.h):
+
+    python dwpw_arena.py ../../MLPerf_ESP32-S3/lib/model_data/kws01_model_data.h
+    python dwpw_arena.py --rows 4 ../../MLPerf_ESP32-S3/lib/model_data/*.h
+
+Pro Paar (Aktivierungen in Byte, int8):
+    plan     max(in + mid, mid + out)  so plant TFLM heute, mit und ohne Fusion
+    ohne_mid in + out                  Zwischentensor aus dem Plan genommen
+    overlay  Ausgang streifenweise über den Depthwise-Eingang gelegt, so nah
+             wie es die Zeilen erlauben, die spätere Streifen noch lesen
+             (Scratch nicht mitgezählt)
+
+Dazu die Spitze der ganzen Kette (größte Summe aus Ein- und Ausgängen eines
+Ops) heute und mit overlay für alle Paare. Ohne Zwischentensor allein sinkt
+die Spitze nie: Eingang und Ausgang der fusionierten Stufe leben dann
+gleichzeitig.
+"""
+
+import argparse
+import struct
+
+from model_align import deref, field, i32, table_items, u32, vector
+from model_pack import read_model
+
+OP_CONV_2D = 3
+OP_DEPTHWISE_CONV_2D = 4
+
+
+def scalar(b, t, i, fmt, default=0):
+    f = field(b, t, i)
+    return struct.unpack_from(fmt, b, f)[0] if f else default
+
+
+def ints(b, t, i):
+    v, n = vector(b, t, i)
+    return [i32(b, v + 4 + 4 * k) for k in range(n)]
+
+
+def table(b, t, i):
+    f = field(b, t, i)
+    return deref(b, f) if f else 0
+
+
+class Graph:
+    def __init__(self, b):
+        self.b = b
+        root = u32(b, 0)
+        # deprecated_builtin_code (int8) bzw. builtin_code (int32)
+        self.codes = [max(scalar(b, c, 0, "<b"), scalar(b, c, 3, "<i"))
+                      for c in table_items(b, root, 1)]
+        self.buffers = table_items(b, root, 4)
+        sg = table_items(b, root, 2)[0]
+        self.tensors = table_items(b, sg, 0)
+        self.ops = table_items(b, sg, 3)
+
+    def code(self, op):
+        return self.codes[scalar(self.b, op, 0, "<I")]
+
+    def shape(self, t):
+        return ints(self.b, self.tensors[t], 0)
+
+    def size(self, t):
+        n = 1
+        for d in self.shape(t):
+            n *= d
+        return n
+
+    def is_activation(self, t):
+        buf = scalar(self.b, self.tensors[t], 2, "<I")
+        return buf >= len(self.buffers) or vector(self.b, self.buffers[buf], 0)[1] == 0
+
+    def live(self, op):
+        ts = [t for t in ints(self.b, op, 1) + ints(self.b, op, 2) if t >= 0]
+        return sum(self.size(t) for t in ts if self.is_activation(t))
+
+
+def pairs(g):
+    """Paare wie in dw_pw_fusion: DW, danach CONV_2D 1x1 Stride 1 auf dessen Ausgang."""
+    b = g.b
+    for k, op in enumerate(g.ops[:-1]):
+        pw = g.ops[k + 1]
+        if g.code(op) != OP_DEPTHWISE_CONV_2D or g.code(pw) != OP_CONV_2D:
+            continue
+        mid = ints(b, op, 2)[0]
+        pw_in = ints(b, pw, 1)
+        if pw_in[0] != mid:
+            continue
+        _, kh, kw, _ = g.shape(pw_in[1])[:4] if len(g.shape(pw_in[1])) == 4 else (0, 0, 0, 0)
+        po = table(b, pw, 4)
+        if kh != 1 or kw != 1 or scalar(b, po, 1, "<i", 1) != 1 or scalar(b, po, 2, "<i", 1) != 1:
+            continue
+        yield k, op, pw
+
+
+def overlay(g, op, pw, rows):
+    """Kleinster Platz für Eingang + Ausgang, wenn der Ausgang den Eingang überdeckt."""
+    b = g.b
+    din = ints(b, op, 1)
+    src, filt = din[0], din[1]
+    out = ints(b, pw, 2)[0]
+    _, h_in, w_in, c_in = g.shape(src)
+    _, h_out, w_out, c_out = g.shape(out)
+    kh = g.shape(filt)[1]
+    do = table(b, op, 4)
+    stride = scalar(b, do, 2, "<i", 1)
+    same = scalar(b, do, 0, "<b", 0) == 0
+    pad = max(0, ((h_out - 1) * stride + kh - h_in) // 2) if same else 0
+    ri = w_in * c_in
+    ro = w_out * c_out
+    # Versatz d des Ausgangs gegen den Eingang: nach Streifen [y, y + rows)
+    # darf der geschriebene Ausgang nicht in Zeilen reichen, die ein späterer
+    # Streifen noch liest
+    d = h_in * ri
+    for y in range(0, h_out - rows, rows):
+        first = max(0, (y + rows) * stride - pad)
+        d = min(d, first * ri - (y + rows) * ro)
+    return max(d + h_out * ro, h_in * ri) - min(d, 0)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[1])
+    ap.add_argument("models", nargs="+")
+    ap.add_argument("--rows", type=int, default=2, help="TH_FUSE_DW_PW_ROWS")
+    args = ap.parse_args()
+
+    for path in args.models:
+        name, raw = read_model(path)
+        g = Graph(raw)
+        print(f"== {name}")
+        print(f"{'paar':>4} {'in':>7} {'mid':>7} {'out':>7} {'plan':>7} {'ohne_mid':>8} {'overlay':>7}")
+        fused = {}
+        for i, (k, op, pw) in enumerate(pairs(g)):
+            src, mid, out = ints(g.b, op, 1)[0], ints(g.b, op, 2)[0], ints(g.b, pw, 2)[0]
+            s_in, s_mid, s_out = g.size(src), g.size(mid), g.size(out)
+            plan = max(s_in + s_mid, s_mid + s_out)
+            ov = overlay(g, op, pw, args.rows)
+            fused[k] = ov
+            fused[k + 1] = ov
+            print(f"{i:>4} {s_in:>7} {s_mid:>7} {s_out:>7} {plan:>7} {s_in + s_out:>8} {ov:>7}")
+        peak = max(g.live(op) for op in g.ops)
+        peak_ov = max(fused.get(k, g.live(op)) for k, op in enumerate(g.ops))
+        print(f"Spitze der Kette: {peak} heute, {peak_ov} mit overlay für alle Paare")
+
+
+if __name__ == "__main__":
+    main()
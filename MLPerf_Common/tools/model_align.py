@@ -0,0 +1,297 @@
+"""
+model_align.py
+
+Richtet die Gewichte (Buffer.data) in TFLite-Flatbuffern auf 16 Byte aus
+und schreibt die Modell-Header (xxd-Format) bzw. .tflite-Dateien neu:
+
+    python model_align.py ../../MLPerf_ESP32-S3/lib/model_data/*.h
+    python model_align.py --check ../../*/lib/model_data/*.h
+
+Ältere Konverter legen die Gewichte nur 4-Byte-ausgerichtet ab; dann lesen
+die ESP-NN-Kernel auf dem S3 byteweise oder fallen auf den C-Pfad zurück.
+Zusammen mit alignas(16) am Array (wird ergänzt) liegt danach jeder
+Gewichtstensor auf einer 16-Byte-Grenze; die Firmware prüft das beim Start
+(m-model-align-[...]). model_pack.py und model_store.py richten ihre
+Eingaben ebenfalls mit align_model() aus.
+
+Vorgehen: Die Daten liegen beim TFLite-Konverter vorne im Flatbuffer, direkt
+hinter Model, Metadaten und den Buffer-Tabellen. Vor jedem schlecht
+ausgerichteten Datenvektor werden 4..12 Nullbytes eingefügt und alle Offsets
+korrigiert, die über die Einfügestelle zeigen. Das geht nur, wenn vor der
+Stelle ausschließlich bekannte Objekte liegen; sonst bricht das Werkzeug ab
+statt ein kaputtes Modell zu schreiben. Am Ende wird auf ein Vielfaches von
+16 aufgefüllt, damit der Rest (Subgraphen, int64-Nullpunkte) seine
+Ausrichtung behält. Das Ergebnis wird gegen das Original geprüft.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+from model_pack import read_model
+
+ALIGN = 16
+
+# Felder mit Offset (Tabelle/Vektor/String) je Tabellentyp des TFLite-Schemas,
+# soweit sie im vorderen Teil des Flatbuffers vorkommen
+MODEL_OFFSET_FIELDS = (1, 2, 3, 4, 5, 6, 7)
+SIGNATURE_OFFSET_FIELDS = (0, 1, 2, 3)
+
+
+# ===================================================================
+# FLATBUFFER-ZUGRIFF
+# ===================================================================
+
+def u16(b, o):
+    return struct.unpack_from("<H", b, o)[0]
+
+
+def u32(b, o):
+    return struct.unpack_from("<I", b, o)[0]
+
+
+def i32(b, o):
+    return struct.unpack_from("<i", b, o)[0]
+
+
+def field(b, t, i):
+    """Position von Feld i der Tabelle t, 0 wenn nicht vorhanden."""
+    vt = t - i32(b, t)
+    if 4 + 2 * i >= u16(b, vt):
+        return 0
+    fo = u16(b, vt + 4 + 2 * i)
+    return t + fo if fo else 0
+
+
+def deref(b, p):
+    return p + u32(b, p)
+
+
+def vector(b, t, i):
+    """(Position des Vektors, Länge) für Feld i, (0, 0) wenn nicht vorhanden."""
+    f = field(b, t, i)
+    if not f:
+        return 0, 0
+    v = deref(b, f)
+    return v, u32(b, v)
+
+
+def table_items(b, t, i):
+    v, n = vector(b, t, i)
+    return [deref(b, v + 4 + 4 * k) for k in range(n)]
+
+
+# ===================================================================
+# BEKANNTE OBJEKTE UND OFFSETS IM VORDEREN TEIL
+# ===================================================================
+
+class Layout:
+    def __init__(self, b):
+        self.b = b
+        self.extents = [(0, 8)]  # Root-Offset + "TFL3"
+        self.offsets = [(0, "u")]
+        self.data = []           # (Vektorposition, Länge) je Buffer mit Daten
+        root = u32(b, 0)
+        self._table(root, MODEL_OFFSET_FIELDS)
+        f = field(b, root, 3)
+        if f:
+            self._string(deref(b, f))
+        f = field(b, root, 5)
+        if f:
+            v = deref(b, f)
+            self.extents.append((v, v + 4 + 4 * u32(b, v)))
+
+        for bt in self._tables(root, 4, (0,)):
+            v, n = vector(b, bt, 0)
+            if v:
+                self.extents.append((v, v + 4 + n))
+                if n:
+                    self.data.append((v, n))
+        for mt in self._tables(root, 6, (0,)):
+            if field(b, mt, 0):
+                self._string(deref(b, field(b, mt, 0)))
+        for st in self._tables(root, 7, SIGNATURE_OFFSET_FIELDS):
+            for k in (2, 3):
+                f = field(b, st, k)
+                if f:
+                    self._string(deref(b, f))
+            for k in (0, 1):
+                for tm in self._tables(st, k, (0,)):
+                    if field(b, tm, 0):
+                        self._string(deref(b, field(b, tm, 0)))
+        self.data.sort()
+
+    def _table(self, t, offset_fields):
+        b = self.b
+        vt = t - i32(b, t)
+        self.extents += [(vt, vt + u16(b, vt)), (t, t + u16(b, vt + 2))]
+        self.offsets.append((t, "s"))
+        for k in offset_fields:
+            f = field(b, t, k)
+            if f:
+                self.offsets.append((f, "u"))
+
+    def _tables(self, t, i, offset_fields):
+        v, n = vector(self.b, t, i)
+        if not v:
+            return []
+        self.extents.append((v, v + 4 + 4 * n))
+        self.offsets += [(v + 4 + 4 * k, "u") for k in range(n)]
+        items = table_items(self.b, t, i)
+        for it in items:
+            self._table(it, offset_fields)
+        return items
+
+    def _string(self, s):
+        self.extents.append((s, s + 4 + u32(self.b, s) + 1))
+
+    def check_known(self, end):
+        """Alles vor `end` muss bekannt oder Null-Padding sein."""
+        cur = 0
+        for s, e in sorted(self.extents):
+            if s >= end:
+                break
+            if s > cur and any(self.b[cur:s]):
+                raise ValueError(f"unbekanntes Objekt bei Offset {cur}, Layout nicht unterstützt")
+            cur = max(cur, e)
+
+
+def insert_padding(b, pos, pad):
+    """Fügt pad Nullbytes bei pos ein und korrigiert alle bekannten Offsets."""
+    for loc, kind in Layout(b).offsets:
+        if kind == "u":
+            target = loc + u32(b, loc)
+        else:
+            target = loc - i32(b, loc)
+        nloc = loc + (pad if loc >= pos else 0)
+        ntarget = target + (pad if target >= pos else 0)
+        if kind == "u":
+            struct.pack_into("<I", b, loc, ntarget - nloc)
+        else:
+            struct.pack_into("<i", b, loc, nloc - ntarget)
+    b[pos:pos] = bytes(pad)
+
+
+# ===================================================================
+# AUSRICHTEN UND PRÜFEN
+# ===================================================================
+
+def tensor_buffers(b):
+    """Pro Subgraph und Tensor: (Name, Buffer-Index, Daten oder None)."""
+    root = u32(b, 0)
+    bufs = table_items(b, root, 4)
+    out = []
+    for sg in table_items(b, root, 2):
+        for t in table_items(b, sg, 0):
+            f = field(b, t, 2)
+            idx = u32(b, f) if f else 0
+            v, n = vector(b, bufs[idx], 0) if idx < len(bufs) else (0, 0)
+            f = field(b, t, 3)
+            name = bytes(b[deref(b, f) + 4:deref(b, f) + 4 + u32(b, deref(b, f))]) if f else b""
+            out.append((name, idx, bytes(b[v + 4:v + 4 + n]) if n else None, v + 4 if n else 0))
+    return out
+
+
+def count_misaligned(b):
+    """(Tensoren mit Gewichten, davon nicht 16-Byte-ausgerichtet)."""
+    consts = [addr for _, _, data, addr in tensor_buffers(b) if data is not None]
+    return len(consts), sum(1 for a in consts if a % ALIGN)
+
+
+def align_model(raw):
+    """Liefert den Flatbuffer mit 16-Byte-ausgerichteten Gewichten."""
+    b = bytearray(raw)
+    layout = Layout(b)
+    if not layout.data:
+        return bytes(b)
+    end = max(v + 4 + n for v, n in layout.data)
+    layout.check_known(end)
+
+    shift = 0
+    for k in range(len(layout.data)):
+        v, _ = Layout(b).data[k]
+        pad = -(v + 4) % ALIGN
+        if pad:
+            insert_padding(b, v, pad)
+            shift += pad
+    if shift % ALIGN:
+        insert_padding(b, end + shift, -shift % ALIGN)
+        shift += -shift % ALIGN
+
+    # Gegenprobe: der hintere Teil ist unverändert (nur verschoben), die
+    # Tensoren zeigen auf dieselben Gewichte, und alle sind ausgerichtet
+    before = [t[:3] for t in tensor_buffers(raw)]
+    after = [t[:3] for t in tensor_buffers(b)]
+    if (before != after or count_misaligned(b)[1] or
+            bytes(b[end + shift:]) != bytes(raw[end:])):
+        raise ValueError("Gegenprobe nach dem Ausrichten fehlgeschlagen")
+    return bytes(b)
+
+
+# ===================================================================
+# HEADER NEU SCHREIBEN
+# ===================================================================
+
+def rewrite_header(path, data):
+    with open(path, "r") as f:
+        text = f.read()
+    m = re.search(r"unsigned\s+char\s+(\w+)\s*\[\s*\]", text)
+    start = text.index("{", m.end()) + 1
+    end = text.index("}", m.end())
+    # Format der Datei beibehalten (Einrückung, Bytes pro Zeile, letztes Komma)
+    old = text[start:end]
+    first = old.strip("\n").split("\n")[0]
+    indent = first[:len(first) - len(first.lstrip())]
+    per = max(1, first.count("0x"))
+    body = ["\n"]
+    for off in range(0, len(data), per):
+        body.append(indent + ", ".join(f"0x{x:02x}" for x in data[off:off + per]) + ",\n")
+    if not old.rstrip().endswith(","):
+        body[-1] = body[-1].rstrip(",\n") + "\n"
+    text = text[:start] + "".join(body) + text[end:]
+
+    # Array selbst auf 16 Byte ausrichten, falls noch nicht geschehen
+    decl_start = text.rfind("\n", 0, m.start()) + 1
+    decl = text[decl_start:m.end()]
+    if not re.search(r"aligned\(16\)|alignas\(16\)", text[decl_start:start]):
+        new = re.sub(r"alignas\(\d+\)\s*", "", decl)
+        text = text[:decl_start] + "alignas(16) " + new + text[m.end():]
+
+    name = m.group(1)
+    text = re.sub(rf"({name}_len\s*=\s*)\d+", rf"\g<1>{len(data)}", text)
+    with open(path, "w") as f:
+        f.write(text)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Gewichte in TFLite-Modellen auf 16 Byte ausrichten")
+    ap.add_argument("inputs", nargs="+", help="*_model_data.h/.cc oder *.tflite")
+    ap.add_argument("--check", action="store_true", help="nur prüfen, nichts schreiben")
+    args = ap.parse_args()
+
+    print(f"{'Datei':<32}{'Tensoren':>10}{'falsch':>8}{'Bytes':>10}{'neu':>10}")
+    bad = 0
+    for path in args.inputs:
+        _, raw = read_model(path)
+        total, mis = count_misaligned(raw)
+        out = raw
+        if not args.check:
+            try:
+                out = align_model(raw) if mis else raw
+            except ValueError as e:
+                sys.exit(f"{path}: {e}")
+            if not path.endswith(".tflite"):
+                rewrite_header(path, out)  # ergänzt auch alignas(16)
+            elif mis:
+                with open(path, "wb") as f:
+                    f.write(out)
+        bad += mis
+        name = path.replace("\\", "/").split("/")[-1]
+        print(f"{name:<32}{total:>10}{mis:>8}{len(raw):>10}{len(out):>10}")
+    if args.check and bad:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,237 @@
+"""
+model_pack.py
+
+Erzeugt aus den Modell-Headern (xxd-Format, lib/model_data/*_model_data.h)
+oder .tflite-Dateien komprimierte Header für -D TH_MODEL_LZ=1:
+
+    python model_pack.py ../../MLPerf_ESP32-S3/lib/model_data/*.h -o ../lib/model_lz
+
+Im PlatformIO-Build übernimmt das pio_model_pack.py (extra_scripts) für das
+gewählte Modell; die erzeugten Header sind nicht eingecheckt.
+
+Format: LZ4-Block (ohne Frame), entpackt von lib/model_lz/model_lz.cpp.
+Die int8-Gewichte selbst komprimieren kaum; gespart wird vor allem an
+Flatbuffer-Padding, Nullblöcken und wiederholten Quantisierungsparametern.
+
+Ausgabe pro Modell: <id>_model_lz.h mit `model_lz_blob` und eine Tabelle
+(Rohgröße, Flash, eingespart) auf stdout.
+"""
+
+import argparse
+import os
+import re
+import sys
+import zlib
+
+# Reihenfolge wie EE_MODEL_VERSION_* in internally_implemented.h
+MODEL_IDS = ["kws01", "vww01", "ad01", "ic01", "strww01"]
+
+MIN_MATCH = 4
+MAX_OFFSET = 65535
+LAST_LITERALS = 5    # LZ4: die letzten 5 Byte sind immer Literale
+MFLIMIT = 12         # LZ4: kein Match beginnt in den letzten 12 Byte
+
+
+def read_model(path):
+    """Liest ein Modell aus .tflite oder einem xxd-Header, liefert (name, bytes)."""
+    if path.endswith(".tflite"):
+        with open(path, "rb") as f:
+            return os.path.splitext(os.path.basename(path))[0], f.read()
+    with open(path, "r") as f:
+        text = f.read()
+    m = re.search(r"unsigned\s+char\s+(\w+)\s*\[\s*\]", text)
+    if m is None:
+        raise ValueError(f"{path}: kein 'unsigned char name[]' gefunden")
+    body = text[text.index("{", m.end()) + 1:text.index("}", m.end())]
+    data = bytes(int(h, 16) for h in re.findall(r"0x([0-9a-fA-F]{2})", body))
+    return m.group(1), data
+
+
+def _write_len(out, n):
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+
+
+def _emit(out, literals, match_len, offset):
+    lit = len(literals)
+    token = (min(lit, 15) << 4) | (min(match_len - MIN_MATCH, 15) if match_len else 0)
+    out.append(token)
+    if lit >= 15:
+        _write_len(out, lit - 15)
+    out += literals
+    if match_len:
+        out += bytes((offset & 0xFF, offset >> 8))
+        if match_len - MIN_MATCH >= 15:
+            _write_len(out, match_len - MIN_MATCH - 15)
+
+
+def lz4_compress(src):
+    """Greedy LZ4-Block-Kompression (Hash über 4 Byte, wie LZ4 'fast')."""
+    n = len(src)
+    out = bytearray()
+    if n < MFLIMIT + 1:
+        _emit(out, src, 0, 0)
+        return bytes(out)
+    table = {}
+    anchor = 0
+    i = 0
+    match_limit = n - LAST_LITERALS
+    while i < n - MFLIMIT:
+        key = src[i:i + 4]
+        cand = table.get(key)
+        table[key] = i
+        if cand is None or i - cand > MAX_OFFSET:
+            i += 1
+            continue
+        # Match verlängern (vorwärts und rückwärts bis zum Anker)
+        length = 4
+        while i + length < match_limit and src[cand + length] == src[i + length]:
+            length += 1
+        while i > anchor and cand > 0 and src[i - 1] == src[cand - 1]:
+            i -= 1
+            cand -= 1
+            length += 1
+        _emit(out, src[anchor:i], length, i - cand)
+        i += length
+        anchor = i
+        # Positionen im Match nachtragen, damit Wiederholungen gefunden werden
+        if i - 2 >= 0 and i - 2 < n - 4:
+            table[src[i - 2:i + 2]] = i - 2
+    _emit(out, src[anchor:], 0, 0)
+    return bytes(out)
+
+
+def lz4_decompress(src, size):
+    """Referenz zum Prüfen des Encoders (gleiche Logik wie model_lz.cpp)."""
+    out = bytearray()
+    i = 0
+    while i < len(src):
+        token = src[i]
+        i += 1
+        lit = token >> 4
+        if lit == 15:
+            while True:
+                b = src[i]
+                i += 1
+                lit += b
+                if b != 255:
+                    break
+        out += src[i:i + lit]
+        i += lit
+        if i >= len(src):
+            break
+        offset = src[i] | (src[i + 1] << 8)
+        i += 2
+        mlen = token & 15
+        if mlen == 15:
+            while True:
+                b = src[i]
+                i += 1
+                mlen += b
+                if b != 255:
+                    break
+        mlen += MIN_MATCH
+        start = len(out) - offset
+        for k in range(mlen):
+            out.append(out[start + k])
+    if len(out) != size:
+        raise ValueError(f"Entpackt {len(out)} statt {size} Byte")
+    return bytes(out)
+
+
+def model_id(path, name):
+    base = os.path.basename(path).lower()
+    for mid in MODEL_IDS:
+        if base.startswith(mid + "_") or base.startswith(mid + "."):
+            return mid
+    return name
+
+
+def write_header(path, mid, name, raw, packed, source):
+    crc = zlib.crc32(raw) & 0xFFFFFFFF
+    guard = f"TH_MODEL_LZ_{mid.upper()}_H_"
+    lines = [
+        f"// Erzeugt von MLPerf_Common/tools/model_pack.py aus {source}, nicht editieren.",
+        f"// {name}: {len(raw)} Byte roh, {len(packed)} Byte LZ4",
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        '#include "model_lz.h"',
+        "",
+        f"const unsigned char {name}_lz[] TH_MODEL_LZ_ATTR = {{",
+    ]
+    for off in range(0, len(packed), 12):
+        chunk = packed[off:off + 12]
+        lines.append("  " + ", ".join(f"0x{b:02x}" for b in chunk) + ",")
+    lines[-1] = lines[-1].rstrip(",")
+    lines += [
+        "};",
+        "",
+        "const model_lz_blob_t model_lz_blob = {",
+        f"  {name}_lz, sizeof({name}_lz), {len(raw)}u, 0x{crc:08x}u",
+        "};",
+        "",
+        f"#endif  // {guard}",
+        "",
+    ]
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+def header_crc(path):
+    """CRC der Rohdaten aus einem vorhandenen <id>_model_lz.h, sonst None."""
+    try:
+        with open(path, "r") as f:
+            m = re.search(r"sizeof\(\w+\), \d+u, 0x([0-9a-f]{8})u", f.read())
+    except OSError:
+        return None
+    return int(m.group(1), 16) if m else None
+
+
+def pack_model(path, out_dir, only_changed=False):
+    """Packt ein Modell nach out_dir/<id>_model_lz.h, liefert (id, roh, flash).
+
+    Mit only_changed bleibt ein Header, dessen CRC schon zu den Rohdaten passt,
+    unangetastet (flash = None). Die Header liegen für alle Boards in einem
+    Ordner, die Modelle der Boards sind aber nicht alle gleich: verglichen
+    wird deshalb der Inhalt, nicht der Zeitstempel.
+    """
+    from model_align import align_model  # hier, model_align importiert read_model
+
+    name, raw = read_model(path)
+    raw = align_model(raw)  # Gewichte 16 Byte ausgerichtet, wie im RAM-Ziel
+    mid = model_id(path, name)
+    out = os.path.join(out_dir, f"{mid}_model_lz.h")
+    if only_changed and header_crc(out) == zlib.crc32(raw) & 0xFFFFFFFF:
+        return mid, len(raw), None
+    packed = lz4_compress(raw)
+    if lz4_decompress(packed, len(raw)) != raw:
+        sys.exit(f"{path}: Rundlauf fehlgeschlagen")
+    os.makedirs(out_dir, exist_ok=True)
+    write_header(out, mid, name, raw, packed, os.path.basename(path))
+    return mid, len(raw), len(packed)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Modelle für TH_MODEL_LZ komprimieren")
+    ap.add_argument("inputs", nargs="+", help="*_model_data.h oder *.tflite")
+    ap.add_argument("-o", "--out", default=".", help="Zielordner für *_model_lz.h")
+    ap.add_argument("--changed", action="store_true",
+                    help="nur packen, wenn sich die Rohdaten geändert haben")
+    args = ap.parse_args()
+
+    print(f"{'Modell':<10}{'roh':>10}{'flash':>10}{'gespart':>10}{'Quote':>8}")
+    for path in args.inputs:
+        mid, raw_len, packed_len = pack_model(path, args.out, args.changed)
+        if packed_len is None:
+            print(f"{mid:<10}{raw_len:>10}  unverändert")
+            continue
+        saved = raw_len - packed_len
+        print(f"{mid:<10}{raw_len:>10}{packed_len:>10}{saved:>10}"
+              f"{100.0 * packed_len / raw_len:>7.1f}%")
+
+
+if __name__ == "__main__":
+    main()
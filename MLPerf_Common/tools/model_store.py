@@ -0,0 +1,92 @@
+"""
+model_store.py
+
+Baut das Abbild für die Partition "models" (-D TH_MODEL_STORE=1) aus
+Modell-Headern (xxd-Format) oder .tflite-Dateien:
+
+    python model_store.py ../../MLPerf_ESP32-S3/lib/model_data/*.h -o models.bin
+
+Der Name eines Eintrags ist die Modell-ID (kws01, vww01, ...), sonst der
+Array- bzw. Dateiname; mit NAME=PFAD lässt er sich vorgeben. Die Firmware
+sucht nach ee_model_name().
+
+Flashen ohne neuen App-Build (Offset aus partitions_models.csv):
+
+    parttool.py write_partition --partition-name models --input models.bin
+    esptool.py write_flash 0x180000 models.bin
+
+Im Host-Build liest mlperf_core_posix dieselbe Datei (TH_MODEL_STORE_FILE).
+
+Format (little endian), muss zu lib/model_store/model_store.h passen:
+    Kopf     magic "TMS1", count, total, reserved        (je u32)
+    Tabelle  count x {name[32], offset, size, crc32, reserved}
+    Daten    Flatbuffer, jeder auf 16 Byte ausgerichtet, die Gewichte darin
+             ebenfalls (model_align.py)
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+from model_align import align_model
+from model_pack import model_id, read_model
+
+MAGIC = 0x31534D54  # "TMS1"
+NAME_LEN = 32
+ALIGN = 16
+HEADER = struct.Struct("<IIII")
+ENTRY = struct.Struct(f"<{NAME_LEN}sIIII")
+MAX_ENTRIES = 64  # wie kMaxEntries in model_store.cpp
+
+
+def align(n):
+    return (n + ALIGN - 1) // ALIGN * ALIGN
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Abbild für die Partition 'models' bauen")
+    ap.add_argument("inputs", nargs="+", help="[NAME=]*_model_data.h oder *.tflite")
+    ap.add_argument("-o", "--out", default="models.bin", help="Ausgabedatei")
+    ap.add_argument("--size", type=lambda s: int(s, 0), default=0,
+                    help="Partitionsgröße, Abbruch wenn das Abbild nicht passt")
+    args = ap.parse_args()
+
+    models = []
+    for arg in args.inputs:
+        name, path = arg.split("=", 1) if "=" in arg else ("", arg)
+        array, data = read_model(path)
+        data = align_model(data)  # Gewichte 16 Byte ausgerichtet wie der Eintrag
+        name = name or model_id(path, array)
+        if len(name.encode()) >= NAME_LEN:
+            sys.exit(f"{path}: Name '{name}' zu lang (max. {NAME_LEN - 1})")
+        if any(m[0] == name for m in models):
+            sys.exit(f"{path}: Name '{name}' doppelt")
+        models.append((name, data))
+    if len(models) > MAX_ENTRIES:
+        sys.exit(f"Höchstens {MAX_ENTRIES} Modelle")
+
+    offset = align(HEADER.size + ENTRY.size * len(models))
+    table = bytearray()
+    blob = bytearray()
+    print(f"{'Name':<16}{'Offset':>10}{'Bytes':>10}  CRC-32")
+    for name, data in models:
+        blob += bytes(offset - HEADER.size - ENTRY.size * len(models) - len(blob))
+        crc = zlib.crc32(data) & 0xFFFFFFFF
+        table += ENTRY.pack(name.encode(), offset, len(data), crc, 0)
+        blob += data
+        print(f"{name:<16}{offset:>#10x}{len(data):>10}  {crc:08x}")
+        offset = align(offset + len(data))
+
+    total = HEADER.size + len(table) + len(blob)
+    image = HEADER.pack(MAGIC, len(models), total, 0) + table + blob
+    if args.size and total > args.size:
+        sys.exit(f"Abbild {total} Byte, Partition nur {args.size} Byte")
+    with open(args.out, "wb") as f:
+        f.write(image)
+    print(f"{args.out}: {total} Byte")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,60 @@
+"""
+pio_model_pack.py
+
+PlatformIO-Vorstufe für -D TH_MODEL_LZ=1, eingebunden in [env] der Boards:
+
+    extra_scripts = pre:../MLPerf_Common/tools/pio_model_pack.py
+
+Packt vor dem Build das per TH_MODEL_VERSION gewählte Modell aus
+lib/model_data/<id>_model_data.h des Projekts nach
+MLPerf_Common/lib/model_lz/<id>_model_lz.h (model_pack.py). Neu gepackt wird
+nur, wenn der Header fehlt oder seine CRC nicht zu den Rohdaten des Projekts
+passt, sonst kostet der Schritt nur das Einlesen. Ohne TH_MODEL_LZ tut das
+Skript nichts.
+"""
+
+import os
+import sys
+
+Import("env")  # noqa: F821 (von SCons bereitgestellt)
+
+
+def _defines(flags):
+    out = {}
+    for d in flags.get("CPPDEFINES", []):
+        if isinstance(d, (list, tuple)):
+            out[d[0]] = str(d[1]) if len(d) > 1 else "1"
+        else:
+            out[d] = "1"
+    return out
+
+
+def _pack():
+    defines = _defines(env.ParseFlagsExtended(env.get("BUILD_FLAGS", [])))  # noqa: F821
+    if defines.get("TH_MODEL_LZ", "0") in ("0", ""):
+        return
+
+    version = defines.get("TH_MODEL_VERSION", "")
+    prefix = "EE_MODEL_VERSION_"
+    if not version.startswith(prefix):
+        sys.stderr.write(f"pio_model_pack: TH_MODEL_VERSION fehlt oder unbekannt ({version!r})\n")
+        env.Exit(1)  # noqa: F821
+    mid = version[len(prefix):].lower()
+
+    project = env.subst("$PROJECT_DIR")  # noqa: F821
+    tools = os.path.normpath(os.path.join(project, "..", "MLPerf_Common", "tools"))
+    source = os.path.join(project, "lib", "model_data", f"{mid}_model_data.h")
+    if not os.path.isfile(source):
+        sys.stderr.write(f"pio_model_pack: {source} fehlt\n")
+        env.Exit(1)  # noqa: F821
+
+    sys.path.insert(0, tools)
+    from model_pack import pack_model
+
+    out_dir = os.path.join(os.path.dirname(tools), "lib", "model_lz")
+    _, raw_len, packed_len = pack_model(source, out_dir, only_changed=True)
+    if packed_len is not None:
+        print(f"pio_model_pack: {mid} gepackt, {raw_len} -> {packed_len} Byte")
+
+
+_pack()
@@ -0,0 +1,314 @@
+/*
+ * th_hal_esp32s3.cpp
+ *
+ * Board-Schicht (th_hal.h) für den Arduino Nano ESP32 (ESP32-S3).
+ * - PERFORMANCE MODE: Native USB (USB Serial JTAG), Zeit über esp_timer
+ * - ENERGY MODE: Hardware UART (Pin 43/44), Timestamp-Impuls auf GPIO 5
+ * - Speicher: interner RAM, danach PSRAM
+ * - TH_LOW_POWER: DFS und Light Sleep zwischen den Befehlen. Die Ersparnis
+ *   ist noch nicht gemessen (kein Joulescope-Lauf mit und ohne); mit
+ *   TH_LOW_POWER=2 gehen die Zeichen verloren, die den Chip wecken; der
+ *   Host muss Füllzeichen voranstellen (MLPerf_Host_Runner --wake-prefix).
+ */
+
+#include "submitter_implemented.h"
+#include "internally_implemented.h"
+#include "th_hal.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/gpio.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#include "rom/ets_sys.h"
+#include "esp_heap_caps.h"
+
+// TREIBER-WEICHE
+#if EE_CFG_ENERGY_MODE
+    #include "driver/uart.h"
+    // Beim Nano ESP32 sind TX0/RX0 auf GPIO 43 und 44 gemappt (siehe Pinout unten)
+    // Wir nutzen UART_NUM_0
+    #define EX_UART_NUM UART_NUM_0
+    #define TX_PIN GPIO_NUM_43 // Nano Pin D1 (TX)
+    #define RX_PIN GPIO_NUM_44 // Nano Pin D0 (RX)
+    #if TH_LOW_POWER
+      #include "esp_pm.h"
+      #include "esp_sleep.h"
+      #include "esp_attr.h"
+      #include "esp_freertos_hooks.h"
+    #endif
+#else
+    #include "driver/usb_serial_jtag.h"
+    #if TH_LOW_POWER
+      // Light Sleep und Frequenzwechsel vertragen sich nicht mit USB-JTAG
+      #error "TH_LOW_POWER nur im Energy Mode (UART)"
+    #endif
+#endif
+
+// Takt zwischen zwei Befehlen mit TH_LOW_POWER (40 = direkt vom Quarz)
+#ifndef TH_PM_MIN_MHZ
+#define TH_PM_MIN_MHZ 40
+#endif
+// TH_LOW_POWER=2: so lange bleibt der Chip nach einem Zeichen ohne Befehlsende wach
+#ifndef TH_PM_AWAKE_MS
+#define TH_PM_AWAKE_MS 100
+#endif
+
+namespace {
+#if EE_CFG_ENERGY_MODE
+  // WICHTIG: Pin D2 auf dem Nano ESP32 ist GPIO 5?
+  // BITTE PRÜFEN: Arduino Nano ESP32 Pinout!
+  // D2 = GPIO 5, D3 = GPIO 6, D4 = GPIO 7.
+  // Wir nehmen D2 (GPIO 5) für den Timestamp.
+  const gpio_num_t TH_GPIO_TIMESTAMP_PIN = GPIO_NUM_5;
+#endif
+
+#if TH_LOW_POWER
+  // Volle Frequenz (und damit kein Light Sleep) nur während ee_infer()
+  esp_pm_lock_handle_t pm_busy_lock = nullptr;
+#if TH_LOW_POWER >= 2
+  // Kein Light Sleep, solange ein Befehl eintrifft oder beantwortet wird
+  esp_pm_lock_handle_t pm_cmd_lock = nullptr;
+  volatile bool cmd_lock_held = false;
+  volatile bool cmd_partial = false;
+  // Vom Sleep-Exit-Callback gesetzt, im Idle-Hook (Task-Kontext) abgearbeitet
+  volatile bool wake_pending = false;
+  // cmd_lock_held und die Sperre gemeinsam: Idle-Hook (beide Kerne) und
+  // th_hal_serial_getchar() dürfen sie nicht doppelt nehmen
+  portMUX_TYPE cmd_mux = portMUX_INITIALIZER_UNLOCKED;
+#endif
+#endif
+} // namespace
+
+// -----------------------------------------------------------
+// HYBRID COMMUNICATION LAYER (USB JTAG vs UART)
+// -----------------------------------------------------------
+
+void th_hal_serial_init(void) {
+#if EE_CFG_ENERGY_MODE
+    // --- ENERGY MODE (UART) ---
+    uart_config_t uart_config = {
+        .baud_rate = 9600, // Langsam für IO Manager
+        .data_bits = UART_DATA_8_BITS,
+        .parity    = UART_PARITY_DISABLE,
+        .stop_bits = UART_STOP_BITS_1,
+        .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,
+#if TH_LOW_POWER
+        // Quarztakt: die Baudrate bleibt gleich, wenn der APB-Takt sinkt
+        .source_clk = UART_SCLK_XTAL,
+#else
+        .source_clk = UART_SCLK_APB,
+#endif
+    };
+    // Installiere UART Treiber (Puffergröße 512)
+    ESP_ERROR_CHECK(uart_driver_install(EX_UART_NUM, 512, 0, 0, NULL, 0));
+    ESP_ERROR_CHECK(uart_param_config(EX_UART_NUM, &uart_config));
+
+    // Setze Pins: TX=43 (D1), RX=44 (D0) auf Nano ESP32
+    ESP_ERROR_CHECK(uart_set_pin(EX_UART_NUM, TX_PIN, RX_PIN, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE));
+
+#else
+    // --- PERFORMANCE MODE (USB) ---
+    // Warte kurz, damit PC Treiber ready ist
+    vTaskDelay(pdMS_TO_TICKS(1500));
+
+    // Treiber ist oft schon in main installiert, aber sicher ist sicher:
+    usb_serial_jtag_driver_config_t usb_config = {
+        .tx_buffer_size = 1024, .rx_buffer_size = 1024
+    };
+    if (usb_serial_jtag_driver_install(&usb_config) != ESP_OK) {
+        // Ignoriere Fehler, falls schon installiert
+    }
+#endif
+}
+
+void th_hal_serial_write(const char *buf, size_t len) {
+#if EE_CFG_ENERGY_MODE
+  // Sende via UART
+  uart_write_bytes(EX_UART_NUM, buf, len);
+#else
+  // Sende via USB
+  usb_serial_jtag_write_bytes(buf, len, portMAX_DELAY);
+#endif
+}
+
+#if TH_LOW_POWER >= 2
+// Sperre nehmen, falls noch nicht gehalten (Task-Kontext)
+static void CommandLock(bool partial) {
+  portENTER_CRITICAL(&cmd_mux);
+  if (!cmd_lock_held) {
+    esp_pm_lock_acquire(pm_cmd_lock);
+    cmd_lock_held = true;
+  }
+  if (partial) cmd_partial = true;
+  portEXIT_CRITICAL(&cmd_mux);
+}
+
+// Aufwachen per UART: das weckende Zeichen geht verloren, der Rest des
+// Befehls darf es nicht. Der Callback läuft im Sleep-Pfad bei gesperrten
+// Interrupts, daher nur IRAM und nur ein Flag; die Sperre nimmt der
+// Idle-Hook. Der läuft im Idle-Task vor dem nächsten Schlafversuch, der
+// Chip schläft also nicht wieder ein, bevor sie gehalten wird.
+static esp_err_t IRAM_ATTR LightSleepExit(int64_t sleep_time_us, void* arg) {
+  (void)sleep_time_us;
+  (void)arg;
+  wake_pending = true;
+  return ESP_OK;
+}
+
+static bool WakeIdleHook(void) {
+  if (wake_pending) {
+    wake_pending = false;
+    if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_UART) CommandLock(true);
+  }
+  return true;
+}
+
+// Zwischen zwei Befehlen darf der Chip in den Light Sleep. Vorher muss die
+// Antwort komplett aus dem UART sein, sonst bricht sie ab.
+static void CommandIdle(void) {
+  if (pm_cmd_lock == nullptr) return;
+  if (cmd_lock_held && !cmd_partial) {
+    uart_wait_tx_done(EX_UART_NUM, portMAX_DELAY);
+    portENTER_CRITICAL(&cmd_mux);
+    if (cmd_lock_held && !cmd_partial) {
+      esp_pm_lock_release(pm_cmd_lock);
+      cmd_lock_held = false;
+    }
+    portEXIT_CRITICAL(&cmd_mux);
+  }
+}
+
+// Ab dem ersten Zeichen eines Befehls wach bleiben, bis er beantwortet ist
+static void CommandByte(char c) {
+  if (pm_cmd_lock == nullptr) return;
+  cmd_partial = (c != EE_CMD_TERMINATOR);
+  CommandLock(false);
+}
+#endif
+
+char th_hal_serial_getchar(void) {
+  uint8_t data = 0;
+  int len = 0;
+  while (len <= 0) {
+#if TH_LOW_POWER >= 2
+    // Wach (Befehl angefangen): höchstens TH_PM_AWAKE_MS auf den Rest warten,
+    // danach war es Rauschen oder ein abgebrochener Befehl -> wieder schlafen
+    CommandIdle();
+    len = uart_read_bytes(EX_UART_NUM, &data, 1,
+                          cmd_lock_held ? pdMS_TO_TICKS(TH_PM_AWAKE_MS) : portMAX_DELAY);
+    if (len <= 0) cmd_partial = false;
+#elif EE_CFG_ENERGY_MODE && TH_LOW_POWER
+    // Ohne Timeout: die CPU wartet im Idle-Task (waiti), bis ein Zeichen kommt
+    len = uart_read_bytes(EX_UART_NUM, &data, 1, portMAX_DELAY);
+#elif EE_CFG_ENERGY_MODE
+    // Lese von UART (Blockierend mit Timeout/Yield)
+    len = uart_read_bytes(EX_UART_NUM, &data, 1, 10 / portTICK_PERIOD_MS);
+#else
+    // Lese von USB
+    len = usb_serial_jtag_read_bytes(&data, 1, 10 / portTICK_PERIOD_MS);
+#endif
+    if (len <= 0) taskYIELD();
+  }
+#if TH_LOW_POWER >= 2
+  CommandByte((char)data);
+#endif
+#if !EE_CFG_ENERGY_MODE
+  // Echo nur im Performance Mode (USB), im Energy Mode stört es den Runner
+  th_hal_serial_write((const char*)&data, 1);
+#endif
+  return (char)data;
+}
+
+// -----------------------------------------------------------
+// ZEIT & TIMESTAMP-PIN
+// -----------------------------------------------------------
+
+unsigned long th_hal_micros(void) { return (unsigned long)esp_timer_get_time(); }
+
+unsigned long th_hal_cpu_mhz(void) { return CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ; }
+
+void th_hal_timestamp_init(void) {
+#if EE_CFG_ENERGY_MODE
+  gpio_reset_pin(TH_GPIO_TIMESTAMP_PIN);
+  gpio_set_direction(TH_GPIO_TIMESTAMP_PIN, GPIO_MODE_OUTPUT);
+  gpio_set_level(TH_GPIO_TIMESTAMP_PIN, 0);
+  th_printf("DEBUG: Timestamp GPIO %d\r\n", (int)TH_GPIO_TIMESTAMP_PIN);
+#endif
+}
+
+void th_hal_timestamp_pulse(void) {
+#if EE_CFG_ENERGY_MODE
+  // Kurzer Impuls für Joulescope
+  gpio_set_level(TH_GPIO_TIMESTAMP_PIN, 1);
+  ets_delay_us(100); // 100us ist sicher für Joulescope 10kHz+
+  gpio_set_level(TH_GPIO_TIMESTAMP_PIN, 0);
+#endif
+}
+
+// -----------------------------------------------------------
+// SPEICHER (SRAM -> PSRAM Fallback)
+// -----------------------------------------------------------
+
+void* th_hal_alloc(th_mem_tier_t tier, size_t bytes) {
+  if (tier == TH_MEM_INTERNAL) {
+    return heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  }
+  return heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+}
+
+const char* th_hal_tier_name(th_mem_tier_t tier) {
+  return tier == TH_MEM_INTERNAL ? "internal" : "psram";
+}
+
+// -----------------------------------------------------------
+// LOW POWER
+// -----------------------------------------------------------
+
+#if TH_LOW_POWER
+// Dynamische Frequenz (und mit TH_LOW_POWER=2 automatischer Light Sleep)
+// zwischen den Befehlen. Braucht CONFIG_PM_ENABLE und
+// CONFIG_FREERTOS_USE_TICKLESS_IDLE (sdkconfig.nano_s3_energy).
+void th_hal_power_init(void) {
+  esp_pm_config_t pm_config = {};
+  pm_config.max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+  pm_config.min_freq_mhz = TH_PM_MIN_MHZ;
+  pm_config.light_sleep_enable = (TH_LOW_POWER >= 2);
+  esp_err_t err = esp_pm_configure(&pm_config);
+  if (err != ESP_OK) {
+    th_printf("WARN: esp_pm_configure() fehlgeschlagen (%d), kein Low-Power-Idle.\r\n", (int)err);
+    return;
+  }
+  ESP_ERROR_CHECK(esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "th_busy", &pm_busy_lock));
+#if TH_LOW_POWER >= 2
+  ESP_ERROR_CHECK(esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "th_cmd", &pm_cmd_lock));
+  // Die Zeichen, die den Chip wecken, gehen verloren: der Sender muss jedem
+  // Befehl Füllzeichen voranstellen (Leerzeichen überspringt der Parser).
+  // Gezählt werden steigende Flanken, ein Leerzeichen liefert zwei, daher
+  // zwei Leerzeichen (MLPerf_Host_Runner --wake-prefix 2).
+  ESP_ERROR_CHECK(uart_set_wakeup_threshold(EX_UART_NUM, 3));
+  ESP_ERROR_CHECK(esp_sleep_enable_uart_wakeup(EX_UART_NUM));
+  for (int cpu = 0; cpu < portNUM_PROCESSORS; cpu++) {
+    ESP_ERROR_CHECK(esp_register_freertos_idle_hook_for_cpu(WakeIdleHook, cpu));
+  }
+  esp_pm_sleep_cbs_register_config_t cbs = {};
+  cbs.exit_cb = LightSleepExit;
+  ESP_ERROR_CHECK(esp_pm_light_sleep_register_cbs(&cbs));
+  // Timestamp-Pin behält im Light Sleep seinen Pegel (LOW)
+  gpio_sleep_sel_dis(TH_GPIO_TIMESTAMP_PIN);
+  // Der laufende Befehl (Initialisierung) hält den Chip noch wach
+  esp_pm_lock_acquire(pm_cmd_lock);
+  cmd_lock_held = true;
+#endif
+  th_printf("DEBUG: Low-Power-Idle %d aktiv (%d..%d MHz).\r\n",
+            (int)TH_LOW_POWER, (int)TH_PM_MIN_MHZ, (int)CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ);
+}
+
+void th_busy_begin(void) {
+  if (pm_busy_lock) esp_pm_lock_acquire(pm_busy_lock);
+}
+
+void th_busy_end(void) {
+  if (pm_busy_lock) esp_pm_lock_release(pm_busy_lock);
+}
+#endif
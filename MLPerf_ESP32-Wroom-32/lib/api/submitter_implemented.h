@@ -31,56 +31,14 @@ methods from th_libc.h and all testharness methods from th_lib.h are here.
 #define TH_VENDOR_NAME_STRING "ESP32-Wroom-32"
 
 #define MAX_DB_INPUT_SIZE (96 * 96 * 3)
-#ifndef TH_MODEL_VERSION
-// See "internally_implemented.h" for a list
-#error "PLease set TH_MODEL_VERSION to one of the EE_MODEL_VERSION_* defines"
-// e.g.: to inform the user of model `ic01` use this:
-// #define TH_MODEL_VERSION EE_MODEL_VERSION_IC01
-#endif
-
-// Use this to switch between DUT-direct (perf) & DUT-inderrect (energy) modes
-#ifndef EE_CFG_ENERGY_MODE
-#define EE_CFG_ENERGY_MODE 0
-#endif
 
-// This is a visual cue to the user when reviewing logs or plugging an
-// unknown device into the system.
-#if EE_CFG_ENERGY_MODE == 1
-#define EE_MSG_TIMESTAMP_MODE "m-timestamp-mode-energy\r\n"
-#else
-#define EE_MSG_TIMESTAMP_MODE "m-timestamp-mode-performance\r\n"
+// Low-power idle between commands (energy mode): 1 = frequency scaling with a
+// PM lock held during `infer` (light sleep needs UART0/1, not available here)
+#ifndef TH_LOW_POWER
+#define TH_LOW_POWER 0
 #endif
 
-#include <stdarg.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-
-/// \brief required core API
-void th_load_tensor();
-void th_results();
-void th_infer();
-void th_timestamp(void);
-void th_printf(const char *fmt, ...);
-char th_getchar();
-
-/// \brief optional API
-void th_serialport_initialize(void);
-void th_timestamp_initialize(void);
-void th_final_initialize(void);
-void th_pre();
-void th_post();
-void th_command_ready(char volatile *msg);
-
-/// \brief libc hooks
-int th_strncmp(const char *str1, const char *str2, size_t n);
-char *th_strncpy(char *dest, const char *src, size_t n);
-size_t th_strnlen(const char *str, size_t maxlen);
-char *th_strcat(char *dest, const char *src);
-char *th_strtok(/*@null@*/ char *str1, const char *sep);
-int th_atoi(const char *str);
-void *th_memset(void *b, int c, size_t len);
-void *th_memcpy(void *dst, const void *src, size_t n);
-int th_vprintf(const char *format, va_list ap);
+// Flags shared by all boards and the th_ prototypes
+#include "th_api.h"
 
 #endif  // MLPERF_TINY_V0_1_API_SUBMITTER_IMPLEMENTED_H_
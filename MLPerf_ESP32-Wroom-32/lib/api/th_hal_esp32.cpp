@@ -0,0 +1,182 @@
+/*
+ * th_hal_esp32.cpp
+ *
+ * Board-Schicht (th_hal.h) für den ESP32 (ESP-IDF) auf Lolin D32.
+ * - Kommunikation in beiden Modi über UART2 (TX 17, RX 16)
+ * - ENERGY MODE: Timestamp-Impuls auf GPIO 13
+ * - Speicher: nur interner Heap (kein PSRAM auf dem Board)
+ * - TH_LOW_POWER=1: DFS zwischen den Befehlen
+ */
+
+#include "submitter_implemented.h"
+#include "internally_implemented.h"
+#include "th_hal.h"
+
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/uart.h"
+#include "driver/gpio.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#include "rom/ets_sys.h"
+#if TH_LOW_POWER
+  #include "esp_pm.h"
+#endif
+
+// Konfiguration UART
+#define EX_UART_NUM UART_NUM_2
+
+// Light Sleep mit UART-Wakeup geht beim ESP32 nur über UART0/1
+#if TH_LOW_POWER >= 2
+  #error "TH_LOW_POWER=2 wird auf dem ESP32 (UART2) nicht unterstuetzt"
+#endif
+
+// Takt zwischen zwei Befehlen mit TH_LOW_POWER (40 = direkt vom Quarz)
+#ifndef TH_PM_MIN_MHZ
+#define TH_PM_MIN_MHZ 40
+#endif
+
+namespace {
+#if EE_CFG_ENERGY_MODE
+  const gpio_num_t TH_GPIO_TIMESTAMP_PIN = GPIO_NUM_13;
+#endif
+
+#if TH_LOW_POWER
+  // Volle Frequenz nur während ee_infer()
+  esp_pm_lock_handle_t pm_busy_lock = nullptr;
+#endif
+} // namespace
+
+// ===================================================================
+// UART
+// ===================================================================
+
+void th_hal_serial_init(void) {
+    uart_config_t uart_config = {};
+
+    // Konfiguration setup
+    uart_config.data_bits = UART_DATA_8_BITS;
+    uart_config.parity    = UART_PARITY_DISABLE;
+    uart_config.stop_bits = UART_STOP_BITS_1;
+    uart_config.flow_ctrl = UART_HW_FLOWCTRL_DISABLE;
+#if TH_LOW_POWER
+    // REF_TICK (1 MHz): die Baudrate bleibt gleich, wenn der APB-Takt sinkt
+    uart_config.source_clk = UART_SCLK_REF_TICK;
+#else
+    uart_config.source_clk = UART_SCLK_APB;
+#endif
+
+#if EE_CFG_ENERGY_MODE
+    // ENERGIE-MODUS: Standard ist meist 9600 Baud für den IO Manager
+    uart_config.baud_rate = 9600;
+#else
+    // PERFORMANCE-MODUS: Schnell für USB-Ausgabe
+    uart_config.baud_rate = 115200;
+#endif
+
+    // Treiber installieren für UART 2
+    ESP_ERROR_CHECK(uart_driver_install(EX_UART_NUM, 256, 0, 0, NULL, 0));
+
+    // Konfiguration anwenden
+    ESP_ERROR_CHECK(uart_param_config(EX_UART_NUM, &uart_config));
+
+    // Pins explizit zuweisen: TX = 17, RX = 16
+    ESP_ERROR_CHECK(uart_set_pin(EX_UART_NUM, 17, 16, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE));
+}
+
+void th_hal_serial_write(const char *buf, size_t len) {
+  uart_write_bytes(EX_UART_NUM, buf, len);
+}
+
+char th_hal_serial_getchar(void) {
+  uint8_t data = 0;
+  int len = 0;
+  while (len <= 0) {
+#if TH_LOW_POWER
+    // Ohne Timeout: die CPU wartet im Idle-Task (waiti), bis ein Zeichen kommt
+    len = uart_read_bytes(EX_UART_NUM, &data, 1, portMAX_DELAY);
+#else
+    len = uart_read_bytes(EX_UART_NUM, &data, 1, 10 / portTICK_PERIOD_MS);
+#endif
+    if (len <= 0) {
+        taskYIELD();
+    }
+  }
+  return (char)data;
+}
+
+// ===================================================================
+// ZEIT & TIMESTAMP-PIN
+// ===================================================================
+
+unsigned long th_hal_micros(void) { return (unsigned long)esp_timer_get_time(); }
+
+unsigned long th_hal_cpu_mhz(void) { return CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ; }
+
+void th_hal_timestamp_init(void) {
+#if EE_CFG_ENERGY_MODE
+  gpio_config_t io_conf = {};
+  io_conf.intr_type = GPIO_INTR_DISABLE;
+  io_conf.mode = GPIO_MODE_OUTPUT;
+  io_conf.pin_bit_mask = (1ULL << TH_GPIO_TIMESTAMP_PIN);
+  io_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;
+  io_conf.pull_up_en = GPIO_PULLUP_DISABLE;
+  gpio_config(&io_conf);
+  gpio_set_level(TH_GPIO_TIMESTAMP_PIN, 0);
+  th_printf("DEBUG: Timestamp GPIO %d\r\n", (int)TH_GPIO_TIMESTAMP_PIN);
+#endif
+}
+
+void th_hal_timestamp_pulse(void) {
+#if EE_CFG_ENERGY_MODE
+  gpio_set_level(TH_GPIO_TIMESTAMP_PIN, 1);
+  ets_delay_us(500);
+  gpio_set_level(TH_GPIO_TIMESTAMP_PIN, 0);
+#endif
+}
+
+// ===================================================================
+// SPEICHER
+// ===================================================================
+
+// malloc() statt statischer Arena verhindert den DRAM-Overflow beim Linken
+void* th_hal_alloc(th_mem_tier_t tier, size_t bytes) {
+  if (tier != TH_MEM_INTERNAL) return nullptr;
+  return malloc(bytes);
+}
+
+const char* th_hal_tier_name(th_mem_tier_t tier) {
+  return tier == TH_MEM_INTERNAL ? "internal" : "none";
+}
+
+// ===================================================================
+// LOW POWER
+// ===================================================================
+
+#if TH_LOW_POWER
+// Dynamische Frequenz zwischen den Befehlen. Braucht CONFIG_PM_ENABLE und
+// CONFIG_FREERTOS_USE_TICKLESS_IDLE (sdkconfig.lolin_d32_energy).
+void th_hal_power_init(void) {
+  esp_pm_config_t pm_config = {};
+  pm_config.max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+  pm_config.min_freq_mhz = TH_PM_MIN_MHZ;
+  pm_config.light_sleep_enable = false;
+  esp_err_t err = esp_pm_configure(&pm_config);
+  if (err != ESP_OK) {
+    th_printf("WARN: esp_pm_configure() fehlgeschlagen (%d), kein Low-Power-Idle.\r\n", (int)err);
+    return;
+  }
+  ESP_ERROR_CHECK(esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "th_busy", &pm_busy_lock));
+  th_printf("DEBUG: Low-Power-Idle aktiv (%d..%d MHz).\r\n",
+            (int)TH_PM_MIN_MHZ, (int)CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ);
+}
+
+void th_busy_begin(void) {
+  if (pm_busy_lock) esp_pm_lock_acquire(pm_busy_lock);
+}
+
+void th_busy_end(void) {
+  if (pm_busy_lock) esp_pm_lock_release(pm_busy_lock);
+}
+#endif
@@ -1,5 +0,0 @@
-#FIXME
-
-COMPONENT_ADD_INCLUDEDIRS := include/
-
-COMPONENT_SRCDIRS :=  src/
@@ -0,0 +1,84 @@
+/*
+ * dataset.cpp
+ */
+
+#include "dataset.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+namespace {
+
+std::string Trim(const std::string& s) {
+  size_t a = s.find_first_not_of(" \t\r\n");
+  if (a == std::string::npos) return "";
+  size_t b = s.find_last_not_of(" \t\r\n");
+  return s.substr(a, b - a + 1);
+}
+
+}  // namespace
+
+bool LoadLabels(const std::string& dir, std::vector<SampleRef>* samples, std::string* error) {
+  const std::string path = dir + "/y_labels.csv";
+  std::ifstream in(path);
+  if (!in) {
+    *error = path + " nicht lesbar";
+    return false;
+  }
+  std::string line;
+  while (std::getline(in, line)) {
+    line = Trim(line);
+    if (line.empty() || line[0] == '#') continue;
+    std::vector<std::string> cols;
+    std::stringstream ss(line);
+    std::string col;
+    while (std::getline(ss, col, ',')) cols.push_back(Trim(col));
+    if (cols.empty() || cols[0].empty()) continue;
+
+    SampleRef ref;
+    ref.file = cols[0];
+    if (cols.size() > 1) ref.classes = cols[1];
+    if (cols.size() > 2) ref.label = cols[2];
+    samples->push_back(ref);
+  }
+  if (samples->empty()) {
+    *error = path + " enthaelt keine Eintraege";
+    return false;
+  }
+  return true;
+}
+
+bool EncodeSample(const std::string& dir, const SampleRef& ref, size_t chunk,
+                  EncodedSample* out, std::string* error) {
+  const std::string path = dir + "/" + ref.file;
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    *error = path + " nicht lesbar";
+    return false;
+  }
+  std::vector<uint8_t> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  if (data.empty()) {
+    *error = path + " ist leer";
+    return false;
+  }
+
+  static const char kHex[] = "0123456789abcdef";
+  out->ref = ref;
+  out->bytes = data.size();
+  out->commands.clear();
+  out->commands.push_back("db load " + std::to_string(data.size()) + "%");
+  for (size_t pos = 0; pos < data.size(); pos += chunk) {
+    size_t n = std::min(chunk, data.size() - pos);
+    std::string cmd = "db ";
+    cmd.reserve(3 + 2 * n + 1);
+    for (size_t i = 0; i < n; i++) {
+      cmd.push_back(kHex[data[pos + i] >> 4]);
+      cmd.push_back(kHex[data[pos + i] & 0x0f]);
+    }
+    cmd.push_back('%');
+    out->commands.push_back(cmd);
+  }
+  return true;
+}
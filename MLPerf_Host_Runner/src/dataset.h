@@ -0,0 +1,35 @@
+/*
+ * dataset.h
+ *
+ * Testdaten im Format des EEMBC-Runners: ein Ordner pro Modell mit den
+ * .bin-Dateien und einer y_labels.csv ("datei, klassen, klasse" pro Zeile).
+ */
+
+#ifndef MLPERF_HOST_DATASET_H_
+#define MLPERF_HOST_DATASET_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+struct SampleRef {
+  std::string file;
+  std::string classes;
+  std::string label;
+};
+
+// Eine Probe, fertig als "db"-Befehle kodiert
+struct EncodedSample {
+  SampleRef ref;
+  size_t bytes = 0;
+  std::vector<std::string> commands;  // "db load N%" gefolgt von "db HH..%"
+};
+
+bool LoadLabels(const std::string& dir, std::vector<SampleRef>* samples, std::string* error);
+
+// Liest dir/ref.file und zerlegt es in "db"-Befehle zu je chunk Bytes
+bool EncodeSample(const std::string& dir, const SampleRef& ref, size_t chunk,
+                  EncodedSample* out, std::string* error);
+
+#endif  // MLPERF_HOST_DATASET_H_
@@ -0,0 +1,179 @@
+/*
+ * dut_session.cpp
+ */
+
+#include "dut_session.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+namespace {
+
+constexpr int kCmdTimeoutMs = 2000;
+constexpr int kIdentifyTries = 3;
+
+bool StartsWith(const std::string& s, const char* prefix) {
+  return s.compare(0, strlen(prefix), prefix) == 0;
+}
+
+// Inhalt zwischen "[" und dem letzten "]"
+std::string Bracket(const std::string& s) {
+  size_t a = s.find('[');
+  size_t b = s.rfind(']');
+  if (a == std::string::npos || b == std::string::npos || b <= a) return "";
+  return s.substr(a + 1, b - a - 1);
+}
+
+}  // namespace
+
+bool DutSession::Open(const std::string& path, int baud, const std::string& log_path,
+                      std::string* error) {
+  if (!port_.Open(path, baud, error)) return false;
+  if (!log_path.empty()) {
+    log_.open(log_path);
+    if (!log_) {
+      *error = log_path + " nicht schreibbar";
+      return false;
+    }
+  }
+  return true;
+}
+
+void DutSession::SetWakePrefix(int spaces, int delay_ms) {
+  wake_spaces_ = spaces;
+  wake_delay_ms_ = delay_ms;
+}
+
+bool DutSession::Send(const std::string& cmd) {
+  if (log_.is_open()) log_ << "> " << cmd << "\n";
+  if (wake_spaces_ > 0) {
+    if (!port_.Write(std::string(wake_spaces_, ' '))) return false;
+    std::this_thread::sleep_for(std::chrono::milliseconds(wake_delay_ms_));
+  }
+  return port_.Write(cmd);
+}
+
+bool DutSession::ReadLine(std::string* line, int timeout_ms) {
+  if (!port_.ReadLine(line, timeout_ms)) return false;
+  if (log_.is_open()) log_ << *line << "\n";
+  return true;
+}
+
+bool DutSession::WaitReady(std::vector<std::string>* lines, int timeout_ms, std::string* error) {
+  std::string line;
+  for (;;) {
+    if (!ReadLine(&line, timeout_ms)) {
+      *error = "Timeout beim Warten auf m-ready";
+      return false;
+    }
+    if (line == "m-ready") return true;
+    if (StartsWith(line, "e-[")) {
+      *error = "Board meldet " + line;
+      return false;
+    }
+    if (lines) lines->push_back(line);
+  }
+}
+
+bool DutSession::Identify(DeviceInfo* info, std::string* error) {
+  // Manche Boards starten beim Öffnen des Ports neu; Startmeldungen verwerfen
+  // und "name" wiederholen, bis eine Antwort kommt.
+  std::vector<std::string> lines;
+  bool named = false;
+  for (int i = 0; i < kIdentifyTries && !named; i++) {
+    port_.Drain();
+    lines.clear();
+    Send("name%");
+    std::string ignored;
+    if (!WaitReady(&lines, kCmdTimeoutMs, &ignored)) continue;
+    for (const auto& l : lines) {
+      if (StartsWith(l, "m-name-")) {
+        std::string rest = l.substr(7);
+        size_t dash = rest.find("-[");
+        info->name = rest.substr(0, dash);
+        named = true;
+      }
+    }
+  }
+  if (!named) {
+    *error = "keine Antwort auf \"name\"";
+    return false;
+  }
+
+  lines.clear();
+  Send("profile%");
+  if (!WaitReady(&lines, kCmdTimeoutMs, error)) return false;
+  for (const auto& l : lines) {
+    if (StartsWith(l, "m-profile-")) info->profile = Bracket(l);
+    if (StartsWith(l, "m-model-")) info->model = Bracket(l);
+    if (StartsWith(l, "m-kernel-backend-")) info->kernel_backend = Bracket(l);
+  }
+  if (info->model.empty()) {
+    *error = "Board meldet kein Modell (m-model fehlt)";
+    return false;
+  }
+  return true;
+}
+
+bool DutSession::Upload(const EncodedSample& sample, int window, std::string* error) {
+  if (window < 1) window = 1;
+  const auto& cmds = sample.commands;
+  std::vector<std::string> lines;
+
+  // "db load N" allein, damit der Puffer sicher angelegt ist
+  if (!Send(cmds[0]) || !WaitReady(nullptr, kCmdTimeoutMs, error)) return false;
+
+  size_t sent = 1, acked = 1;
+  while (acked < cmds.size()) {
+    while (sent < cmds.size() && sent - acked < (size_t)window) {
+      if (!Send(cmds[sent++])) {
+        *error = "Schreiben fehlgeschlagen";
+        return false;
+      }
+    }
+    if (!WaitReady(&lines, kCmdTimeoutMs, error)) return false;
+    acked++;
+  }
+  for (const auto& l : lines) {
+    if (l == "m-load-done") return true;
+  }
+  *error = "m-load-done fehlt nach " + std::to_string(sample.bytes) + " Bytes";
+  return false;
+}
+
+bool DutSession::Infer(int iterations, int warmups, InferResult* result, std::string* error) {
+  std::vector<std::string> lines;
+  Send("infer " + std::to_string(iterations) + " " + std::to_string(warmups) + "%");
+
+  // Die Laufzeit hängt vom Modell ab; Zeilen kommen aber mindestens zu
+  // Beginn/Ende von Warmup und Messung, daher großzügiges Zeilen-Timeout.
+  if (!WaitReady(&lines, 10 * 60 * 1000, error)) return false;
+
+  std::vector<uint64_t> laps;
+  result->results.clear();
+  result->summary.clear();
+  for (const auto& l : lines) {
+    if (StartsWith(l, "m-lap-us-")) {
+      laps.push_back(strtoull(l.c_str() + 9, nullptr, 10));
+    } else if (StartsWith(l, "m-results-")) {
+      std::stringstream ss(Bracket(l));
+      std::string v;
+      while (std::getline(ss, v, ',')) result->results.push_back(v);
+    } else if (StartsWith(l, "m-summary-{")) {
+      result->summary = l.substr(10);
+    }
+  }
+  if (laps.size() < 2) {
+    *error = "m-lap-us fehlt (Energy-Firmware?)";
+    return false;
+  }
+  result->start_time = laps[laps.size() - 2];
+  result->end_time = laps[laps.size() - 1];
+  result->iterations = iterations;
+  result->warmups = warmups;
+  return true;
+}
@@ -0,0 +1,74 @@
+/*
+ * dut_session.h
+ *
+ * Host-Seite des EEMBC-Protokolls, wie es lib/api/internally_implemented.cpp
+ * der Firmwares spricht: Befehle enden mit '%', jede Antwort endet mit
+ * "m-ready". Verwendet werden name, profile, db load/db HH.., infer N W und
+ * die dabei gesendeten m-lap-us/m-results-Zeilen.
+ *
+ * Weckpräfix (--wake-prefix): Mit TH_LOW_POWER=2 schläft der ESP32-S3
+ * zwischen den Befehlen im Light Sleep, und die Zeichen, die ihn über den
+ * UART wecken, gehen verloren. Dann geht jedem Befehl eine Reihe
+ * Leerzeichen voraus (der Parser trennt an Leerzeichen, führende stören
+ * nicht), danach eine kurze Pause, bis der UART wieder empfängt. Ein
+ * Leerzeichen liefert zwei steigende Flanken, die Firmware weckt ab drei.
+ */
+
+#ifndef MLPERF_HOST_DUT_SESSION_H_
+#define MLPERF_HOST_DUT_SESSION_H_
+
+#include <stdint.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "dataset.h"
+#include "serial_port.h"
+
+struct DeviceInfo {
+  std::string name;     // aus m-name-NAME-[VENDOR]
+  std::string profile;  // aus m-profile-[...]
+  std::string model;    // aus m-model-[...], z.B. kws01
+  std::string kernel_backend;  // aus m-kernel-backend-[...], z.B. cmsis-nn
+};
+
+struct InferResult {
+  uint64_t start_time = 0;  // m-lap-us vor der Messschleife
+  uint64_t end_time = 0;    // m-lap-us danach
+  std::vector<std::string> results;  // m-results-[...] wie gesendet
+  int iterations = 0;
+  int warmups = 0;
+  std::string summary;  // JSON aus m-summary-{...}, leer bei älterer Firmware
+};
+
+class DutSession {
+ public:
+  // log_path leer = kein Mitschnitt
+  bool Open(const std::string& path, int baud, const std::string& log_path, std::string* error);
+
+  bool Identify(DeviceInfo* info, std::string* error);
+
+  // Sendet die "db"-Befehle einer Probe. window > 1 schickt bis zu window
+  // Befehle, bevor das erste m-ready zurückkommt (Pipelining über den
+  // Empfangspuffer des Boards).
+  bool Upload(const EncodedSample& sample, int window, std::string* error);
+
+  bool Infer(int iterations, int warmups, InferResult* result, std::string* error);
+
+  // spaces Leerzeichen und delay_ms Pause vor jedem Befehl (0 = aus)
+  void SetWakePrefix(int spaces, int delay_ms);
+
+ private:
+  bool Send(const std::string& cmd);
+  // Liest bis m-ready; sammelt alle Zeilen dazwischen
+  bool WaitReady(std::vector<std::string>* lines, int timeout_ms, std::string* error);
+  bool ReadLine(std::string* line, int timeout_ms);
+
+  SerialPort port_;
+  std::ofstream log_;
+  int wake_spaces_ = 0;
+  int wake_delay_ms_ = 0;
+};
+
+#endif  // MLPERF_HOST_DUT_SESSION_H_
@@ -0,0 +1,306 @@
+/*
+ * main.cpp
+ *
+ * Paralleler Benchmark-Runner für mehrere Boards. Jedes Board (oder jede
+ * Host-Instanz an einem Pseudo-Terminal) bekommt einen eigenen Thread, der
+ * per "profile" das geflashte Modell erfragt, die passenden Proben aus dem
+ * Datensatz hochlädt und performance/accuracy misst. Während ein Board
+ * rechnet, wird die nächste Probe bereits gelesen und hex-kodiert.
+ *
+ * Beispiel:
+ *   mlperf_host_runner --device s3=/dev/ttyACM0 --device teensy=/dev/ttyACM1 \
+ *       --dataset kws01=datasets/kws01 --dataset vww01=datasets/vww01 \
+ *       --modes p,a --out results.json --split Data
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <future>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "dataset.h"
+#include "dut_session.h"
+#include "results_json.h"
+
+namespace {
+
+struct Options {
+  std::vector<std::pair<std::string, std::string>> devices;  // Name -> Pfad
+  std::map<std::string, std::string> datasets;                // Modell -> Ordner
+  std::string modes = "p";
+  int baud = 115200;
+  int iterations = 100;
+  int warmups = 10;
+  size_t perf_samples = 5;  // wie der EEMBC-Runner: 5 Fenster im Performance-Modus
+  size_t max_samples = 0;   // 0 = alle (Accuracy)
+  int window = 1;
+  size_t chunk = 32;
+  int wake_spaces = 0;   // TH_LOW_POWER=2 auf dem S3, siehe dut_session.h
+  int wake_delay_ms = 3;
+  std::string out = "results.json";
+  std::string split_dir;
+  std::string log_dir;
+};
+
+std::mutex g_mutex;  // schützt g_entries und die Konsolenausgabe
+std::vector<RunEntry> g_entries;
+
+void Usage() {
+  printf(
+      "mlperf_host_runner --device NAME=PFAD [--device ...] --dataset MODELL=ORDNER [...]\n"
+      "  --modes p,a         Performance (p) und/oder Accuracy (a), Standard p\n"
+      "  --iterations N      Messdurchläufe im Performance-Modus (100)\n"
+      "  --warmups N         Warmup-Durchläufe im Performance-Modus (10)\n"
+      "  --perf-samples N    Proben im Performance-Modus (5)\n"
+      "  --max-samples N     Proben im Accuracy-Modus begrenzen (alle)\n"
+      "  --baud N            Baudrate (115200)\n"
+      "  --window N          db-Befehle ohne m-ready in Folge (1)\n"
+      "  --chunk N           Bytes pro db-Befehl (32)\n"
+      "  --out DATEI         zusammengefasste results.json (results.json)\n"
+      "  --split ORDNER      zusätzlich ORDNER/<board>_<modell>_<modus>/results.json\n"
+      "  --log ORDNER        serieller Mitschnitt pro Board\n"
+      "  --wake-prefix N[:MS] N Leerzeichen und MS ms Pause (3) vor jedem Befehl,\n"
+      "                      für den Light Sleep des S3 mit TH_LOW_POWER=2 (N=2)\n");
+}
+
+bool SplitPair(const std::string& arg, std::string* key, std::string* value) {
+  size_t eq = arg.find('=');
+  if (eq == std::string::npos || eq == 0 || eq + 1 == arg.size()) return false;
+  *key = arg.substr(0, eq);
+  *value = arg.substr(eq + 1);
+  return true;
+}
+
+bool ParseArgs(int argc, char** argv, Options* opt) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : nullptr; };
+    const char* v = nullptr;
+    std::string key, value;
+    if (a == "--help" || a == "-h") {
+      return false;
+    } else if (a == "--device" && (v = next()) && SplitPair(v, &key, &value)) {
+      opt->devices.emplace_back(key, value);
+    } else if (a == "--dataset" && (v = next()) && SplitPair(v, &key, &value)) {
+      opt->datasets[key] = value;
+    } else if (a == "--modes" && (v = next())) {
+      opt->modes.clear();
+      for (const char* p = v; *p; p++) {
+        if (*p == 'p' || *p == 'a') opt->modes.push_back(*p);
+      }
+    } else if (a == "--iterations" && (v = next())) {
+      opt->iterations = atoi(v);
+    } else if (a == "--warmups" && (v = next())) {
+      opt->warmups = atoi(v);
+    } else if (a == "--perf-samples" && (v = next())) {
+      opt->perf_samples = (size_t)atoi(v);
+    } else if (a == "--max-samples" && (v = next())) {
+      opt->max_samples = (size_t)atoi(v);
+    } else if (a == "--baud" && (v = next())) {
+      opt->baud = atoi(v);
+    } else if (a == "--window" && (v = next())) {
+      opt->window = atoi(v);
+    } else if (a == "--chunk" && (v = next())) {
+      opt->chunk = (size_t)atoi(v);
+    } else if (a == "--out" && (v = next())) {
+      opt->out = v;
+    } else if (a == "--split" && (v = next())) {
+      opt->split_dir = v;
+    } else if (a == "--log" && (v = next())) {
+      opt->log_dir = v;
+    } else if (a == "--wake-prefix" && (v = next())) {
+      opt->wake_spaces = atoi(v);
+      const char* ms = strchr(v, ':');
+      if (ms) opt->wake_delay_ms = atoi(ms + 1);
+    } else {
+      fprintf(stderr, "Unbekanntes oder unvollständiges Argument: %s\n", a.c_str());
+      return false;
+    }
+  }
+  // "db " + 2 Hex-Zeichen pro Byte + '%' muss in EE_CMD_SIZE (80) passen,
+  // bei wachem Board samt Weckpräfix
+  if (opt->wake_spaces < 0 || opt->wake_spaces > 16 || opt->wake_delay_ms < 0) {
+    fprintf(stderr, "--wake-prefix erwartet 0..16 Leerzeichen und eine Pause >= 0\n");
+    return false;
+  }
+  const size_t max_chunk = (size_t)(76 - opt->wake_spaces) / 2;
+  if (opt->chunk < 1 || opt->chunk > max_chunk) {
+    fprintf(stderr, "--chunk muss zwischen 1 und %zu liegen\n", max_chunk);
+    return false;
+  }
+  if (opt->iterations < 1 || opt->warmups < 0) {
+    fprintf(stderr, "--iterations muss >0 und --warmups >=0 sein\n");
+    return false;
+  }
+  return !opt->devices.empty() && !opt->datasets.empty() && !opt->modes.empty();
+}
+
+void Report(const std::string& device, const char* fmt, const std::string& text) {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  printf("[%s] ", device.c_str());
+  printf(fmt, text.c_str());
+  printf("\n");
+  fflush(stdout);
+}
+
+// Ein Thread pro Board: alle Modi nacheinander, Proben mit Vorauskodierung
+void RunDevice(const Options& opt, const std::string& device, const std::string& path) {
+  std::string error;
+  DutSession dut;
+  std::string log_path = opt.log_dir.empty() ? "" : opt.log_dir + "/" + device + ".log";
+  if (!dut.Open(path, opt.baud, log_path, &error)) {
+    Report(device, "FEHLER: %s", error);
+    return;
+  }
+  dut.SetWakePrefix(opt.wake_spaces, opt.wake_delay_ms);
+  DeviceInfo info;
+  if (!dut.Identify(&info, &error)) {
+    Report(device, "FEHLER: %s", error);
+    return;
+  }
+  Report(device, "%s", info.name + ", Modell " + info.model + ", " + info.profile +
+                           (info.kernel_backend.empty() ? "" : ", Kernel " + info.kernel_backend));
+
+  auto ds = opt.datasets.find(info.model);
+  if (ds == opt.datasets.end()) {
+    Report(device, "FEHLER: kein --dataset fuer %s", info.model);
+    return;
+  }
+  std::vector<SampleRef> samples;
+  if (!LoadLabels(ds->second, &samples, &error)) {
+    Report(device, "FEHLER: %s", error);
+    return;
+  }
+
+  for (char mode : opt.modes) {
+    size_t count = samples.size();
+    if (mode == 'p') count = std::min(count, opt.perf_samples);
+    if (mode == 'a' && opt.max_samples) count = std::min(count, opt.max_samples);
+    // Accuracy: ein Durchlauf ohne Warmup, wie beim EEMBC-Runner
+    const int iterations = mode == 'p' ? opt.iterations : 1;
+    const int warmups = mode == 'p' ? opt.warmups : 0;
+
+    auto encode = [&](size_t idx) {
+      EncodedSample enc;
+      std::string err;
+      if (!EncodeSample(ds->second, samples[idx], opt.chunk, &enc, &err)) enc.commands.clear();
+      return enc;
+    };
+    std::future<EncodedSample> next = std::async(std::launch::async, encode, 0);
+
+    for (size_t idx = 0; idx < count; idx++) {
+      EncodedSample current = next.get();
+      if (idx + 1 < count) next = std::async(std::launch::async, encode, idx + 1);
+      if (current.commands.empty()) {
+        Report(device, "FEHLER: Probe %s nicht lesbar", samples[idx].file);
+        continue;
+      }
+
+      RunEntry entry;
+      entry.device = device;
+      entry.model = info.model;
+      entry.mode = mode;
+      entry.sample = current.ref;
+      if (!dut.Upload(current, opt.window, &error) ||
+          !dut.Infer(iterations, warmups, &entry.infer, &error)) {
+        Report(device, "FEHLER: %s", samples[idx].file + ": " + error);
+        continue;
+      }
+      std::lock_guard<std::mutex> lock(g_mutex);
+      g_entries.push_back(entry);
+    }
+    Report(device, "Modus %s fertig", std::string(1, mode));
+  }
+}
+
+std::string ShortModel(const std::string& model) {
+  std::string s = model;
+  while (!s.empty() && isdigit((unsigned char)s.back())) s.pop_back();
+  return s;
+}
+
+// Kurzübersicht pro Board/Modell/Modus: Median-Durchsatz bzw. Top-1
+void PrintSummary() {
+  std::map<std::string, std::vector<const RunEntry*>> groups;
+  for (const auto& e : g_entries) {
+    groups[e.device + "_" + ShortModel(e.model) + "_" + e.mode].push_back(&e);
+  }
+  for (const auto& g : groups) {
+    const auto& list = g.second;
+    if (list[0]->mode == 'p') {
+      std::vector<double> tp;
+      for (const auto* e : list) tp.push_back(Throughput(e->infer));
+      std::sort(tp.begin(), tp.end());
+      printf("%-24s %3zu Proben, Median-Durchsatz %.3f inf./s\n", g.first.c_str(), list.size(),
+             tp[tp.size() / 2]);
+    } else {
+      size_t hits = 0, rated = 0;
+      for (const auto* e : list) {
+        const auto& r = e->infer.results;
+        if (r.empty() || e->sample.label.empty()) continue;
+        size_t best = 0;
+        for (size_t k = 1; k < r.size(); k++) {
+          if (strtod(r[k].c_str(), nullptr) > strtod(r[best].c_str(), nullptr)) best = k;
+        }
+        rated++;
+        if ((int)best == atoi(e->sample.label.c_str())) hits++;
+      }
+      printf("%-24s %3zu Proben, Top-1 %.1f %%\n", g.first.c_str(), list.size(),
+             rated ? 100.0 * hits / rated : 0.0);
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options opt;
+  if (!ParseArgs(argc, argv, &opt)) {
+    Usage();
+    return 1;
+  }
+  if (!opt.log_dir.empty()) mkdir(opt.log_dir.c_str(), 0755);
+
+  std::vector<std::thread> threads;
+  for (const auto& d : opt.devices) {
+    threads.emplace_back(RunDevice, std::cref(opt), d.first, d.second);
+  }
+  for (auto& t : threads) t.join();
+
+  // Reihenfolge unabhängig vom Thread-Timing: Board, Modus, Probe
+  std::stable_sort(g_entries.begin(), g_entries.end(), [](const RunEntry& a, const RunEntry& b) {
+    if (a.device != b.device) return a.device < b.device;
+    return a.mode > b.mode;  // p vor a
+  });
+
+  if (!WriteResultsJson(opt.out, g_entries, true)) {
+    fprintf(stderr, "FEHLER: %s nicht schreibbar\n", opt.out.c_str());
+    return 1;
+  }
+  if (!opt.split_dir.empty()) {
+    mkdir(opt.split_dir.c_str(), 0755);
+    std::map<std::string, std::vector<RunEntry>> runs;
+    for (const auto& e : g_entries) {
+      runs[e.device + "_" + ShortModel(e.model) + "_" + e.mode].push_back(e);
+    }
+    for (const auto& r : runs) {
+      std::string dir = opt.split_dir + "/" + r.first;
+      mkdir(dir.c_str(), 0755);
+      if (!WriteResultsJson(dir + "/results.json", r.second, false)) {
+        fprintf(stderr, "FEHLER: %s/results.json nicht schreibbar\n", dir.c_str());
+      }
+    }
+  }
+
+  PrintSummary();
+  return g_entries.empty() ? 1 : 0;
+}
@@ -0,0 +1,92 @@
+/*
+ * results_json.cpp
+ */
+
+#include "results_json.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <fstream>
+
+namespace {
+
+std::string Quote(const std::string& s) {
+  std::string out = "\"";
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      out.push_back('\\');
+      out.push_back(c);
+    } else if ((unsigned char)c < 0x20) {
+      char buf[8];
+      snprintf(buf, sizeof(buf), "\\u%04x", c);
+      out += buf;
+    } else {
+      out.push_back(c);
+    }
+  }
+  return out + "\"";
+}
+
+// Leere Felder wie beim Runner als null, sonst als String ("12", "7")
+std::string OptString(const std::string& s) { return s.empty() ? "null" : Quote(s); }
+
+// Zahl im Stil von Python-json (0.0 statt 0)
+std::string Number(double v) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%.17g", v);
+  // kürzeste Darstellung, die denselben double ergibt
+  for (int prec = 1; prec <= 17; prec++) {
+    char tmp[32];
+    snprintf(tmp, sizeof(tmp), "%.*g", prec, v);
+    if (strtod(tmp, nullptr) == v) {
+      snprintf(buf, sizeof(buf), "%s", tmp);
+      break;
+    }
+  }
+  std::string s = buf;
+  if (s.find_first_of(".eEn") == std::string::npos) s += ".0";
+  return s;
+}
+
+}  // namespace
+
+double Throughput(const InferResult& r) {
+  uint64_t elapsed = r.end_time - r.start_time;
+  return elapsed ? (double)r.iterations * 1e6 / (double)elapsed : 0.0;
+}
+
+bool WriteResultsJson(const std::string& path, const std::vector<RunEntry>& entries,
+                      bool with_origin) {
+  std::ofstream out(path);
+  if (!out) return false;
+
+  out << "[";
+  for (size_t i = 0; i < entries.size(); i++) {
+    const RunEntry& e = entries[i];
+    const InferResult& r = e.infer;
+    if (i) out << ", ";
+    out << "{\"file\": " << Quote(e.sample.file)
+        << ", \"classes\": " << OptString(e.sample.classes)
+        << ", \"class\": " << OptString(e.sample.label)
+        << ", \"bytes_to_send\": null, \"stride\": null, \"total_length\": null"
+        << ", \"infer\": {\"start_time\": " << r.start_time
+        << ", \"end_time\": " << r.end_time << ", \"results\": [";
+    for (size_t k = 0; k < r.results.size(); k++) {
+      if (k) out << ", ";
+      out << Number(strtod(r.results[k].c_str(), nullptr));
+    }
+    out << "], \"elapsed_time\": " << (r.end_time - r.start_time)
+        << ", \"total_inferences\": 1, \"iterations\": " << r.iterations
+        << ", \"warmups\": " << r.warmups;
+    if (e.mode == 'p') out << ", \"throughput\": " << Number(Throughput(r));
+    out << "}, \"mode\": \"" << e.mode << "\"";
+    if (with_origin) {
+      out << ", \"device\": " << Quote(e.device) << ", \"model\": " << Quote(e.model);
+      if (!r.summary.empty()) out << ", \"summary\": " << r.summary;
+    }
+    out << "}";
+  }
+  out << "]";
+  return (bool)out;
+}
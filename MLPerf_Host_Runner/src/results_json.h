@@ -0,0 +1,33 @@
+/*
+ * results_json.h
+ *
+ * Schreibt Ergebnisse im Schema der results.json des EEMBC-Runners
+ * (siehe Python Modellerstellung/DataVisualizer/Data/<board>_<modell>_<modus>),
+ * damit die Visualizer-Skripte sie unverändert lesen können.
+ */
+
+#ifndef MLPERF_HOST_RESULTS_JSON_H_
+#define MLPERF_HOST_RESULTS_JSON_H_
+
+#include <string>
+#include <vector>
+
+#include "dataset.h"
+#include "dut_session.h"
+
+struct RunEntry {
+  std::string device;  // Name aus --device, z.B. s3
+  std::string model;   // m-model des Boards, z.B. kws01
+  char mode = 'p';     // 'p' Performance, 'a' Accuracy
+  SampleRef sample;
+  InferResult infer;
+};
+
+// with_origin = true ergänzt "device", "model" und ggf. "summary" (m-summary
+// der Firmware) pro Eintrag (für die zusammengefasste Datei über mehrere Boards)
+bool WriteResultsJson(const std::string& path, const std::vector<RunEntry>& entries,
+                      bool with_origin);
+
+double Throughput(const InferResult& r);
+
+#endif  // MLPERF_HOST_RESULTS_JSON_H_
@@ -0,0 +1,131 @@
+/*
+ * serial_port.cpp
+ */
+
+#include "serial_port.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <chrono>
+
+namespace {
+
+speed_t BaudToSpeed(int baud) {
+  switch (baud) {
+    case 9600: return B9600;
+    case 19200: return B19200;
+    case 38400: return B38400;
+    case 57600: return B57600;
+    case 115200: return B115200;
+    case 230400: return B230400;
+#ifdef B460800
+    case 460800: return B460800;
+#endif
+#ifdef B921600
+    case 921600: return B921600;
+#endif
+    default: return 0;
+  }
+}
+
+}  // namespace
+
+SerialPort::~SerialPort() { Close(); }
+
+bool SerialPort::Open(const std::string& path, int baud, std::string* error) {
+  Close();
+  fd_ = ::open(path.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (fd_ < 0) {
+    *error = path + ": " + strerror(errno);
+    return false;
+  }
+
+  struct termios tio;
+  if (tcgetattr(fd_, &tio) == 0) {
+    cfmakeraw(&tio);
+    tio.c_cflag |= CLOCAL | CREAD;
+    speed_t speed = BaudToSpeed(baud);
+    if (speed == 0) {
+      *error = "nicht unterstuetzte Baudrate " + std::to_string(baud);
+      Close();
+      return false;
+    }
+    cfsetispeed(&tio, speed);
+    cfsetospeed(&tio, speed);
+    if (tcsetattr(fd_, TCSANOW, &tio) != 0) {
+      *error = path + ": tcsetattr: " + strerror(errno);
+      Close();
+      return false;
+    }
+  }
+  // Kein tty (z.B. FIFO/Socket einer Host-Instanz): einfach roh weiter
+  pending_.clear();
+  return true;
+}
+
+void SerialPort::Close() {
+  if (fd_ >= 0) ::close(fd_);
+  fd_ = -1;
+}
+
+bool SerialPort::Write(const std::string& data) {
+  size_t done = 0;
+  while (done < data.size()) {
+    ssize_t n = ::write(fd_, data.data() + done, data.size() - done);
+    if (n < 0) {
+      if (errno == EAGAIN || errno == EINTR) {
+        struct pollfd pfd = {fd_, POLLOUT, 0};
+        poll(&pfd, 1, 100);
+        continue;
+      }
+      return false;
+    }
+    done += (size_t)n;
+  }
+  return true;
+}
+
+bool SerialPort::ReadLine(std::string* line, int timeout_ms) {
+  using Clock = std::chrono::steady_clock;
+  const auto deadline = Clock::now() + std::chrono::milliseconds(timeout_ms);
+
+  for (;;) {
+    size_t nl = pending_.find('\n');
+    if (nl != std::string::npos) {
+      line->assign(pending_, 0, nl);
+      pending_.erase(0, nl + 1);
+      while (!line->empty() && (line->back() == '\r' || line->back() == '\n')) line->pop_back();
+      return true;
+    }
+
+    auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+    if (left <= 0) return false;
+
+    struct pollfd pfd = {fd_, POLLIN, 0};
+    int r = poll(&pfd, 1, (int)left);
+    if (r < 0 && errno != EINTR) return false;
+    if (r <= 0) continue;
+
+    char buf[512];
+    ssize_t n = ::read(fd_, buf, sizeof(buf));
+    if (n > 0) {
+      pending_.append(buf, (size_t)n);
+    } else if (n == 0 || (errno != EAGAIN && errno != EINTR)) {
+      return false;  // Gerät getrennt
+    }
+  }
+}
+
+void SerialPort::Drain() {
+  if (fd_ < 0) return;
+  char buf[512];
+  struct pollfd pfd = {fd_, POLLIN, 0};
+  while (poll(&pfd, 1, 50) > 0 && ::read(fd_, buf, sizeof(buf)) > 0) {
+  }
+  pending_.clear();
+}
@@ -0,0 +1,39 @@
+/*
+ * serial_port.h
+ *
+ * Zeilenorientierter Zugriff auf ein serielles Gerät (USB-CDC, UART-Adapter)
+ * oder ein Pseudo-Terminal einer Host-Instanz. Reines POSIX (termios/poll).
+ */
+
+#ifndef MLPERF_HOST_SERIAL_PORT_H_
+#define MLPERF_HOST_SERIAL_PORT_H_
+
+#include <string>
+
+class SerialPort {
+ public:
+  SerialPort() = default;
+  ~SerialPort();
+
+  SerialPort(const SerialPort&) = delete;
+  SerialPort& operator=(const SerialPort&) = delete;
+
+  // Öffnet path im Raw-Modus. Bei Pseudo-Terminals wird die Baudrate ignoriert.
+  bool Open(const std::string& path, int baud, std::string* error);
+  void Close();
+  bool IsOpen() const { return fd_ >= 0; }
+
+  bool Write(const std::string& data);
+
+  // Liest eine Zeile ohne "\r\n". false bei Timeout oder Fehler.
+  bool ReadLine(std::string* line, int timeout_ms);
+
+  // Verwirft alles, was noch im Empfangspuffer liegt
+  void Drain();
+
+ private:
+  int fd_ = -1;
+  std::string pending_;  // Empfangene, noch nicht abgeholte Zeichen
+};
+
+#endif  // MLPERF_HOST_SERIAL_PORT_H_